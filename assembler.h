@@ -7,18 +7,43 @@
  * assembler.
  */
 
+#include "diagnostics.h"
+#include "layout.h"
 #include "translator.h"
 #include "parser.h"
+#include "source.h"
 
 /**
  * @brief Perform the first pass of the assembler on the assembly file to build
  * the symbol table.
  * @param table The symbol table that will hold the symbols and their addresses
  * in the machine code.
- * @param am_file_name The name of the assembly file.
- * @param input_file_name The assembly file.
+ * @param source The preprocessed assembly source.
+ * @param diagnostics The list collecting the diagnostics of the file.
  */
-bool do_first_pass(Symbol **table, FILE *am_file, const char *input_file_name);
+bool do_first_pass(Symbol **table, const SourceFile *source,
+                   DiagnosticList *diagnostics);
+
+/**
+ * @brief Perform the first pass of the assembler over chunks of the assembly
+ * file parsed on several threads.
+ *
+ * Builds the same symbol table and reports the same diagnostics as
+ * do_first_pass(). Each chunk is parsed with addresses relative to its start,
+ * and the symbols are merged into the table in source order once the address
+ * of every chunk is known.
+ *
+ * @param table The symbol table that will hold the symbols and their addresses
+ * in the machine code.
+ * @param source The preprocessed assembly source.
+ * @param diagnostics The list collecting the diagnostics of the file.
+ * @param threads_count The number of chunks, each parsed on its own thread.
+ * @param layout The layout to initialize with the place of every line in the
+ * code image, or NULL if it is not needed. It is freed with free_layout().
+ */
+bool do_parallel_first_pass(Symbol **table, const SourceFile *source,
+                            DiagnosticList *diagnostics, int threads_count,
+                            Layout *layout);
 
 /**
  * @brief Perform the second pass of the assembler on the assembly file to
@@ -26,16 +51,97 @@ bool do_first_pass(Symbol **table, FILE *am_file, const char *input_file_name);
  * @param translator The translator that will hold the machine code.
  * @param symbol_table The symbol table that holds the symbols and their
  * addresses in the machine code.
- * @param am_file_name The name of the assembly file.
- * @param am_file The assembly file.
+ * @param source The preprocessed assembly source.
  * @param instruction_counter The number of instructions in the machine code.
  * @param data_counter The number of data entries in the machine code.
- * @param input_file_name The assembly file.
+ * @param diagnostics The list collecting the diagnostics of the file.
  */
 bool do_second_pass(Translator **translator, Symbol **symbol_table,
-                    const char *am_file_name, FILE *am_file,
-                    int *instruction_counter, int *data_counter,
-                    const char *input_file_name);
+                    const SourceFile *source, int *instruction_counter,
+                    int *data_counter, DiagnosticList *diagnostics);
+
+/**
+ * @brief Perform the second pass of the assembler over the chunks of the
+ * layout recorded by do_parallel_first_pass(), encoding them on several
+ * threads.
+ *
+ * The code image is allocated once at its final size and every chunk is
+ * encoded straight into its slot. The machine code, the external uses and the
+ * diagnostics are the same as the ones of do_second_pass().
+ *
+ * @param translator The translator that will hold the machine code.
+ * @param symbol_table The symbol table that holds the symbols and their
+ * addresses in the machine code.
+ * @param source The preprocessed assembly source.
+ * @param layout The layout of the code image recorded by the first pass.
+ * @param instruction_counter The number of instructions in the machine code.
+ * @param data_counter The number of data entries in the machine code.
+ * @param diagnostics The list collecting the diagnostics of the file.
+ */
+bool do_parallel_second_pass(Translator **translator, Symbol **symbol_table,
+                             const SourceFile *source, Layout *layout,
+                             int *instruction_counter, int *data_counter,
+                             DiagnosticList *diagnostics);
+
+/**
+ * @brief Validate the references of the assembly file as the second pass
+ * does, without encoding the machine code.
+ *
+ * Every symbol the second pass would look up is looked up, and the ones that
+ * are undefined are reported as by do_second_pass(). The .entry lines make
+ * their symbols internal, so the symbol table is left as the second pass
+ * leaves it.
+ *
+ * @param symbol_table The symbol table built by the first pass.
+ * @param source The preprocessed assembly source.
+ * @param diagnostics The list collecting the diagnostics of the file.
+ * @return true if a symbol is undefined, false otherwise.
+ */
+bool do_check_pass(Symbol **symbol_table, const SourceFile *source,
+                   DiagnosticList *diagnostics);
+
+/**
+ * @struct ConstantScope
+ * @brief The symbols the names of the constant expressions are resolved in.
+ */
+typedef struct {
+  const SymbolIndex *index; /**< The index of the symbols, or NULL. */
+  Symbol *table;            /**< The symbol table, used without an index. */
+  bool is_strict;           /**< Whether only the defines are resolved. */
+} ConstantScope;
+
+/**
+ * @brief Resolves a name of a constant expression to the value of its symbol.
+ *
+ * A strict scope only resolves the defines, which is how the first pass
+ * validates the names. The second pass resolves any symbol, since a .entry
+ * may have made a define internal by then.
+ *
+ * @param name The name to resolve.
+ * @param value Where to store the value of the symbol.
+ * @param scope The ConstantScope to resolve the name in.
+ * @return true if the name was resolved, false otherwise.
+ */
+bool resolve_constant(const char *name, int *value, void *scope);
+
+/**
+ * @brief Folds the constant expressions of a line naming symbols.
+ *
+ * @param current_node The AST of the line, its expressions removed once
+ * folded.
+ * @param scope The symbols the names are resolved in.
+ * @param line The line in the assembly file.
+ * @param diagnostics The list collecting the diagnostics of the file.
+ * @return true if an expression could not be folded, false otherwise.
+ */
+bool fold_constants(AST *current_node, ConstantScope *scope, int line,
+                    DiagnosticList *diagnostics);
+
+/**
+ * @brief Frees a translator with its code image and its symbol lists.
+ * @param translator The translator to free, ignored when NULL.
+ */
+void free_translator(Translator *translator);
 
 /**
  * @brief Get the number of tokens in the current node.
@@ -44,6 +150,15 @@ bool do_second_pass(Translator **translator, Symbol **symbol_table,
  */
 int get_tokens_count(AST **current_node);
 
+/**
+ * @brief Gets the number of words a line takes in the code image, whether the
+ * first pass counts them or not.
+ *
+ * @param node The AST of the line.
+ * @return The number of words of the line.
+ */
+int get_line_size(AST *node);
+
 /**
  * @brief Handle the instruction in the current node.
  * @param translator The translator that will hold the machine code.
@@ -55,12 +170,12 @@ int get_tokens_count(AST **current_node);
  * the machine code.
  * @param line The current line in the assembly file.
  * @param has_error A flag indicating if an error occurred.
- * @param input_file_name The assembly file.
+ * @param diagnostics The list collecting the diagnostics of the file.
  */
 void handle_instruction(Translator *translator, AST *current_node,
                         Symbol **symbol_table, int *instruction_counter,
                         int reg_offset, int *line, bool *has_error,
-                        const char *input_file_name);
+                        DiagnosticList *diagnostics);
 
 /**
  * @brief Handles the directive in the current AST node during the second pass
@@ -69,8 +184,8 @@ void handle_instruction(Translator *translator, AST *current_node,
  * This function handles the ENTRY, DATA, and STRING directives. For ENTRY, it
  * sets the attribute of the symbol to INTERNAL. For DATA, it adds the data to
  * the instructions of the code image, either by looking up the symbol or by
- * encoding the number. For STRING, it adds each character of the string to the
- * instructions of the code image.
+ * encoding the number. For STRING, it adds the characters of the string to the
+ * instructions of the code image at once.
  *
  * @param translator The translator that will hold the machine code.
  * @param current_node The current AST node being processed.
@@ -80,15 +195,71 @@ void handle_instruction(Translator *translator, AST *current_node,
  * the machine code.
  * @param line The current line number in the assembly file.
  * @param has_error Pointer to a boolean indicating if there was an error.
+ * @param diagnostics The list collecting the diagnostics of the file.
  */
 void handle_directive(Translator *translator, AST *current_node,
                       Symbol **symbol_table, int *data_counter, int *line,
-                      bool *has_erro, const char *input_file_name);
+                      bool *has_erro, DiagnosticList *diagnostics);
+
+/**
+ * @brief Handles a line the scanner recognized, when it needs no AST.
+ *
+ * The empty, .define and .extern lines take no word, the data lines without
+ * names and the strings are added at once and the .entry lines are applied as
+ * handle_directive() does.
+ *
+ * @param translator The translator that will hold the machine code.
+ * @param scanned The scanned line, referring to no symbol.
+ * @param symbol_table The symbol table.
+ * @param data_counter The data counter that holds the number of data entries in
+ * the machine code.
+ * @return true if the line was handled, false if it must be parsed.
+ */
+bool handle_scanned_line(Translator *translator, ScannedLine *scanned,
+                         Symbol **symbol_table, int *data_counter);
+
+/**
+ * @brief Add a word at the end of a code image, growing it when needed.
+ *
+ * A preassigned code image never grows: words past its capacity are dropped.
+ *
+ * @param code_image The code image to add the word to.
+ * @param word The 14-bit word to add.
+ */
+void add_word(CodeImage *code_image, int word);
+
+/**
+ * @brief Add the words of data elements at the end of a code image at once,
+ * growing it at most once.
+ *
+ * A preassigned code image never grows: words past its capacity are dropped.
+ *
+ * @param code_image The code image to add the words to.
+ * @param values The values of the elements.
+ * @param count The number of elements.
+ * @param repeat The number of times the elements are added.
+ */
+void add_data_words(CodeImage *code_image, const int *values, int count,
+                    int repeat);
 
-/** @brief Reallocate the instructions in the code image of the translator.
+/**
+ * @brief Add the words of a string and of its terminating zero at the end of a
+ * code image at once, growing it at most once.
+ *
+ * A preassigned code image never grows: words past its capacity are dropped.
+ *
+ * @param code_image The code image to add the words to.
+ * @param string The decoded string.
+ */
+void add_string_words(CodeImage *code_image, const char *string);
+
+/**
+ * @brief Add the internal symbols of the symbol table to the translator.
  * @param translator The translator that will hold the machine code.
+ * @param symbol_table The symbol table that holds the symbols and their
+ * addresses in the machine code.
  */
-void reallocate_instructions(Translator *translator);
+void add_internal_symbols(Translator *translator, Symbol *symbol_table);
 
 /**
  * @brief Add a symbol to the symbol table.
@@ -117,11 +288,11 @@ void add_to_table(char symbol_name[MAX_LABEL_LENGTH], Attribute attribute,
  * array.
  * @param line The current line number in the assembly file.
  * @param has_error Pointer to a boolean indicating if there was an error.
- * @param input_file_name The assembly file.
+ * @param diagnostics The list collecting the diagnostics of the file.
  */
 void code_immediate_operand(Translator *translator, AST *current_node,
                             Symbol **symbol_table, int operand_index, int *line,
-                            bool *has_error, const char *input_file_name);
+                            bool *has_error, DiagnosticList *diagnostics);
 
 /**
  * @brief Encodes a direct operand during the second pass of the assembler.
@@ -145,12 +316,12 @@ void code_immediate_operand(Translator *translator, AST *current_node,
  * array.
  * @param line The current line number in the assembly file.
  * @param has_error Pointer to a boolean indicating if there was an error.
- * @param input_file_name The assembly file.
+ * @param diagnostics The list collecting the diagnostics of the file.
  */
 void code_direct_operand(Translator *translator, AST *current_node,
                          Symbol **symbol_table, int *instruction_counter,
                          int operand_index, int *line, bool *has_error,
-                         const char *input_file_name);
+                         DiagnosticList *diagnostics);
 
 /**
  * @brief Encodes a register operand during the second pass of the assembler.
@@ -187,11 +358,11 @@ void code_register_operand(Translator *translator, AST *current_node,
  * array.
  * @param line The current line number in the assembly file.
  * @param has_error Pointer to a boolean indicating if there was an error.
- * @param input_file_name The assembly file.
+ * @param diagnostics The list collecting the diagnostics of the file.
  */
 void code_indexed_operand(Translator *translator, AST *current_node,
                           Symbol **symbol_table, int operand_index, int *line,
-                          bool *has_error, const char *input_file_name);
+                          bool *has_error, DiagnosticList *diagnostics);
 
 /**
  * @brief Encodes an instruction operand during the second pass of the
@@ -211,10 +382,10 @@ void code_indexed_operand(Translator *translator, AST *current_node,
  * is a register.
  * @param line The current line number.
  * @param has_error Pointer to a boolean indicating if there was an error.
- * @param input_file_name The assembly file.
+ * @param diagnostics The list collecting the diagnostics of the file.
  */
 void code_inst_operand(Translator *translator, AST *current_node,
                        Symbol **symbol_table, int *instruction_counter,
                        int operand_index, int reg_offset, int *line,
-                       bool *has_error, const char *input_file_name);
+                       bool *has_error, DiagnosticList *diagnostics);
 #endif
\ No newline at end of file
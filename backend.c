@@ -1,94 +1,165 @@
+#define _POSIX_C_SOURCE 200809L
 #include "backend.h"
+#include "converter.h"
 #include "errors.h"
 #include "utils.h"
 #include <string.h>
 
+/* Opens the memory stream the content of an output file is written to */
+static FILE *open_output(char **text, size_t *size) {
+  FILE *out = open_memstream(text, size);
+
+  if (out == NULL) {
+    fprintf(stderr, ERROR_OUT_OF_MEMORY);
+    exit(EXIT_FAILURE);
+  }
+
+  return out;
+}
+
 void rename_file(char **new_file_name, const char *old_file_name,
                  const char *extension) {
+  char *base_name = NULL;
   char *extension_dot = NULL;
+  char *directory_name = NULL;
 
-  *new_file_name = strdup(old_file_name);
-  removeSubstring(*new_file_name, "input/");
+  base_name = strdup(old_file_name);
+  removeSubstring(base_name, "input/");
 
-  extension_dot = strrchr(*new_file_name, '.');
+  extension_dot = strrchr(base_name, '.');
 
   if (extension_dot) {
     *extension_dot = '\0';
   }
 
-  *new_file_name = STR_CAT_WITH_MALLOC(
-      STR_CAT_WITH_MALLOC("output/", *new_file_name), extension);
+  directory_name = STR_CAT_WITH_MALLOC("output/", base_name);
+  *new_file_name = STR_CAT_WITH_MALLOC(directory_name, extension);
+
+  free(directory_name);
+  free(base_name);
 }
 
-void print_ob_file(Translator *translator, const char *output_file_name,
-                   int *instructions, int *data) {
-  char *ob_file_name = NULL;
-  FILE *ob_file = NULL;
+void write_ob(FILE *out, const int *words, int words_count, int instructions,
+              int data) {
+  char word[ENCRYPTED_WORD_LENGTH + 1];
   int i = 0;
 
-  rename_file(&ob_file_name, output_file_name, ".ob");
-  ob_file = fopen(ob_file_name, "w");
+  fprintf(out, "   %d  %d\n", instructions, data);
 
-  if (ob_file) {
-    fprintf(ob_file, "   %d  %d\n", *instructions, *data);
+  for (i = 0; i < words_count; i++) {
+    to_base4_encrypted(words[i], word);
+    fprintf(out, "%04d   %s\n", i + 100, word);
+  }
+}
 
-    for (i = 0; i < translator->code_image->count; i++) {
-      fprintf(ob_file, "%04d   %s\n", i + 100,
-              translator->code_image->instructions[i]);
+void write_ent(FILE *out, const Symbol *entries) {
+  for (; entries; entries = entries->next) {
+    if (entries->attribute == INTERNAL) {
+      fprintf(out, "%s\t%04d\n", entries->symbol_name, entries->value);
     }
+  }
+}
 
-    fclose(ob_file);
-  } else {
-    fprintf(stderr, ERROR_CANNOT_WRITE, ob_file_name);
+void write_ext(FILE *out, const Symbol *externals) {
+  for (; externals; externals = externals->next) {
+    if (externals->attribute == EXTERNAL) {
+      fprintf(out, "%s\t\t%04d\n", externals->symbol_name, externals->value);
+    }
+  }
+}
+
+void write_map(FILE *out, const char *source_file_name,
+               const LineTable *lines) {
+  int i = 0;
+
+  fprintf(out, "%s\n", source_file_name);
+
+  for (i = 0; i < lines->count; i++) {
+    if (lines->runs[i].call_line > 0) {
+      fprintf(out, "%04d\t%d\t%d\n", lines->runs[i].address + 100,
+              lines->runs[i].line, lines->runs[i].call_line);
+    } else {
+      fprintf(out, "%04d\t%d\n", lines->runs[i].address + 100,
+              lines->runs[i].line);
+    }
   }
+}
+
+void print_ob_file(IoBatch *batch, const char *output_file_name,
+                   const int *words, int words_count, int instructions,
+                   int data) {
+  char *ob_file_name = NULL;
+  char *text = NULL;
+  size_t size = 0;
+  FILE *out = open_output(&text, &size);
+
+  rename_file(&ob_file_name, output_file_name, ".ob");
+  write_ob(out, words, words_count, instructions, data);
+  fclose(out);
+  write_output(batch, ob_file_name, text, (long)size);
 
   free(ob_file_name);
 }
 
-void print_ent_file(Translator *translator, const char *output_file_name) {
+void print_ent_file(IoBatch *batch, const char *output_file_name,
+                    const Symbol *entries) {
   char *ent_file_name = NULL;
-  FILE *ent_file = NULL;
+  char *text = NULL;
+  size_t size = 0;
+  FILE *out = NULL;
 
   rename_file(&ent_file_name, output_file_name, ".ent");
-  ent_file = fopen(ent_file_name, "w");
-
-  if (ent_file) {
-    Symbol *current_symbol = translator->internal_symbols;
-
-    while (current_symbol) {
-      if (current_symbol->attribute == INTERNAL) {
-        fprintf(ent_file, "%s\t%04d\n", current_symbol->symbol_name,
-                current_symbol->value);
-      }
-      current_symbol = current_symbol->next;
-    }
 
-    fclose(ent_file);
+  if (entries) {
+    out = open_output(&text, &size);
+    write_ent(out, entries);
+    fclose(out);
+    write_output(batch, ent_file_name, text, (long)size);
   } else {
-    fprintf(stderr, ERROR_CANNOT_WRITE, ent_file_name);
+    remove_output(batch, ent_file_name);
   }
+
+  free(ent_file_name);
 }
 
-void print_ext_file(Translator *translator, const char *output_file_name) {
+void print_ext_file(IoBatch *batch, const char *output_file_name,
+                    const Symbol *externals) {
   char *ext_file_name = NULL;
-  FILE *ext_file = NULL;
+  char *text = NULL;
+  size_t size = 0;
+  FILE *out = NULL;
 
   rename_file(&ext_file_name, output_file_name, ".ext");
-  ext_file = fopen(ext_file_name, "w");
 
-  if (ext_file) {
-    Symbol *current_symbol = translator->external_symbols;
+  if (externals) {
+    out = open_output(&text, &size);
+    write_ext(out, externals);
+    fclose(out);
+    write_output(batch, ext_file_name, text, (long)size);
+  } else {
+    remove_output(batch, ext_file_name);
+  }
 
-    while (current_symbol) {
-      if (current_symbol->attribute == EXTERNAL) {
-        fprintf(ext_file, "%s\t\t%04d\n", current_symbol->symbol_name,
-                current_symbol->value);
-      }
-      current_symbol = current_symbol->next;
-    }
+  free(ext_file_name);
+}
 
-    fclose(ext_file);
+void print_map_file(IoBatch *batch, const char *output_file_name,
+                    const char *source_file_name, const LineTable *lines) {
+  char *map_file_name = NULL;
+  char *text = NULL;
+  size_t size = 0;
+  FILE *out = NULL;
+
+  rename_file(&map_file_name, output_file_name, ".map");
+
+  if (lines->count > 0) {
+    out = open_output(&text, &size);
+    write_map(out, source_file_name, lines);
+    fclose(out);
+    write_output(batch, map_file_name, text, (long)size);
   } else {
-    fprintf(stderr, ERROR_CANNOT_WRITE, ext_file_name);
+    remove_output(batch, map_file_name);
   }
-}
\ No newline at end of file
+
+  free(map_file_name);
+}
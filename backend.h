@@ -7,7 +7,9 @@
  * backend.
  */
 
+#include "io_batch.h"
 #include "translator.h"
+#include <stdio.h>
 
 /**
  * @brief Renames a file by changing its directory and adding an extension.
@@ -24,49 +26,123 @@
 void rename_file(char **new_file_name, const char *old_file_name,
                  const char *extension);
 
+/**
+ * @brief Writes the object file (.ob) content of the translated assembly code.
+ *
+ * Writes the number of instructions and data, followed by the words of the
+ * code image. Each word is written on a new line with its address (starting
+ * from 100) and its encrypted base 4 representation.
+ *
+ * @param out The stream to write to.
+ * @param words The words of the code image.
+ * @param words_count The number of words of the code image.
+ * @param instructions The number of instructions.
+ * @param data The number of data.
+ */
+void write_ob(FILE *out, const int *words, int words_count, int instructions,
+              int data);
+
+/**
+ * @brief Writes the entry file (.ent) content of the translated assembly code.
+ *
+ * Each internal symbol is written on a new line with its name and its address.
+ *
+ * @param out The stream to write to.
+ * @param entries The internal symbols.
+ */
+void write_ent(FILE *out, const Symbol *entries);
+
+/**
+ * @brief Writes the external file (.ext) content of the translated assembly
+ * code.
+ *
+ * Each use of an external symbol is written on a new line with its name and
+ * the address it is used at.
+ *
+ * @param out The stream to write to.
+ * @param externals The uses of the external symbols.
+ */
+void write_ext(FILE *out, const Symbol *externals);
+
+/**
+ * @brief Writes the map file (.map) content of the translated assembly code.
+ *
+ * The name of the assembly file is written first. Each run of words coming
+ * from a single line is then written on a new line with the address of its
+ * first word and the line of the assembly file, followed by the line of the
+ * macro call for a line expanded from a macro. A run ends at the address of
+ * the next one, the last one at the end of the code image.
+ *
+ * @param out The stream to write to.
+ * @param source_file_name The name of the assembly file.
+ * @param lines The runs of words of the code image.
+ */
+void write_map(FILE *out, const char *source_file_name,
+               const LineTable *lines);
+
 /**
  * @brief Prints the object file (.ob) for the translated assembly code.
  *
- * This function creates an object file with the specified output file name and
- * extension ".ob". It then writes the number of instructions and data to the
- * file, followed by the instructions from the code image. Each instruction is
- * printed on a new line with its address (starting from 100) and its binary
- * representation. If the file cannot be opened, the function does nothing.
+ * This function renders the object file with write_ob() and writes it through
+ * write_output(), named after the output file name, in the output directory
+ * and with the extension ".ob". The file is left untouched when it already
+ * has that content, and an error is printed when it cannot be written.
  *
- * @param translator The translator that holds the machine code.
+ * @param batch The batch the file is written through, or NULL.
  * @param output_file_name The name of the output file.
- * @param instructions Pointer to the number of instructions.
- * @param data Pointer to the number of data.
+ * @param words The words of the code image.
+ * @param words_count The number of words of the code image.
+ * @param instructions The number of instructions.
+ * @param data The number of data.
  */
-void print_ob_file(Translator *translator, const char *output_file_name,
-                   int *instructions, int *data);
+void print_ob_file(IoBatch *batch, const char *output_file_name,
+                   const int *words, int words_count, int instructions,
+                   int data);
 
 /**
  * @brief Prints the entry file (.ent) for the translated assembly code.
  *
- * This function creates an entry file with the specified output file name and
- * extension ".ent". It then writes the symbol name and its value for each
- * internal symbol in the symbol table to the file. Each symbol is printed on a
- * new line with its name and its address. If the file cannot be opened, the
- * function does nothing.
+ * This function renders the entry file with write_ent() and writes it through
+ * write_output(), named after the output file name, in the output directory
+ * and with the extension ".ent". Without internal symbols, the entry file left
+ * by an earlier run is removed instead.
  *
- * @param translator The translator that holds the machine code.
+ * @param batch The batch the file is written through, or NULL.
  * @param output_file_name The name of the output file.
+ * @param entries The internal symbols, or NULL.
  */
-void print_ent_file(Translator *translator, const char *output_file_name);
+void print_ent_file(IoBatch *batch, const char *output_file_name,
+                    const Symbol *entries);
 
 /**
  * @brief Prints the external file (.ext) for the translated assembly code.
  *
- * This function creates an external file with the specified output file name
- * and extension ".ext". It then writes the symbol name and its value for each
- * external symbol in the symbol table to the file. Each symbol is printed on a
- * new line with its name and its address. If the file cannot be opened, the
- * function does nothing.
+ * This function renders the external file with write_ext() and writes it
+ * through write_output(), named after the output file name, in the output
+ * directory and with the extension ".ext". Without uses of external symbols,
+ * the external file left by an earlier run is removed instead.
+ *
+ * @param batch The batch the file is written through, or NULL.
+ * @param output_file_name The name of the output file.
+ * @param externals The uses of the external symbols, or NULL.
+ */
+void print_ext_file(IoBatch *batch, const char *output_file_name,
+                    const Symbol *externals);
+
+/**
+ * @brief Prints the map file (.map) for the translated assembly code.
+ *
+ * This function renders the map file with write_map() and writes it through
+ * write_output(), named after the output file name, in the output directory
+ * and with the extension ".map". Without a line table, the map file left by
+ * an earlier run is removed instead.
  *
- * @param translator The translator that holds the machine code.
+ * @param batch The batch the file is written through, or NULL.
  * @param output_file_name The name of the output file.
+ * @param source_file_name The name of the assembly file.
+ * @param lines The runs of words of the code image.
  */
-void print_ext_file(Translator *translator, const char *output_file_name);
+void print_map_file(IoBatch *batch, const char *output_file_name,
+                    const char *source_file_name, const LineTable *lines);
 
 #endif
\ No newline at end of file
@@ -0,0 +1,620 @@
+/**
+ * @file bench_runner.c
+ * @brief Benchmark runner that times each phase of the assembler pipeline.
+ *
+ * Every workload is assembled in a forked child so that its peak resident set
+ * size is measured in isolation. The preprocessor, the first pass, the second
+ * pass and the backend are timed separately and the results are written as
+ * JSON. When a baseline file from an earlier run is given, the throughput of
+ * every workload is compared against it and regressions are reported.
+ *
+ * With -j the first pass runs over chunks parsed on that many threads, and
+ * with -f the run stops after the first pass, which is how the scaling of the
+ * chunked first pass is measured on sources too large for the second pass.
+ *
+ * With -e every workload is instead assembled once by the incremental
+ * assembler, then edited that many times, one register operand of a random
+ * line at a time, and the time of an edit is compared with the time of the
+ * full assembly. Since such an edit keeps the size of its line, the time it
+ * takes should not grow with the size of the source.
+ *
+ * Usage:
+ *   bench_runner [-o results.json] [-b baseline.json] [-t percent]
+ *                [-j threads] [-f] [-e edits] workload.as...
+ */
+
+#define _POSIX_C_SOURCE 200809L
+#include "assembler.h"
+#include "backend.h"
+#include "errors.h"
+#include "incremental.h"
+#include "preprocessor.h"
+#include "utils.h"
+#include <fcntl.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/resource.h>
+#include <sys/wait.h>
+#include <unistd.h>
+
+/* The number of first pass threads, 0 for the sequential first pass */
+static int threads_count = 0;
+
+/* Whether to stop every run after the first pass */
+static int first_pass_only = 0;
+
+/* The number of incremental edits timed per workload, 0 for the pipeline */
+static int edits_count = 0;
+
+/**
+ * @struct BenchResult
+ * @brief The measurements of a single workload.
+ */
+typedef struct {
+  int ok;               /**< Non zero when both passes succeeded. */
+  long lines;           /**< Number of lines in the preprocessed source. */
+  double preprocess_s;  /**< Time spent expanding macros. */
+  double first_pass_s;  /**< Time spent building the symbol table. */
+  double second_pass_s; /**< Time spent encoding the code image. */
+  double backend_s;     /**< Time spent writing the output files. */
+  long peak_rss_kb;     /**< Peak resident set size of the run. */
+} BenchResult;
+
+static long count_lines(const char *file_name) {
+  FILE *file = fopen(file_name, "r");
+  long lines = 0;
+  int c = 0;
+
+  if (!file) {
+    return 0;
+  }
+
+  while ((c = getc(file)) != EOF) {
+    if (c == '\n') {
+      lines++;
+    }
+  }
+
+  fclose(file);
+  return lines;
+}
+
+/* Runs the whole pipeline on one workload, as main() does. */
+static void run_workload(const char *base_name, BenchResult *result) {
+  Translator *translator = NULL;
+  Symbol *symbol_table = NULL;
+  SourceFile source;
+  char *am_file_name = NULL;
+  DiagnosticList diagnostics;
+  Layout layout;
+  bool has_error = false;
+  int instruction_counter = 0;
+  int data_counter = 0;
+  struct rusage usage;
+  double start = 0;
+
+  start = now_seconds();
+  am_file_name = preprocess(NULL, base_name);
+  result->preprocess_s = now_seconds() - start;
+
+  if (!am_file_name) {
+    return;
+  }
+
+  result->lines = count_lines(am_file_name);
+  init_diagnostics(&diagnostics, am_file_name);
+
+  /* Reading the source is part of the first pass, as it was with a stream */
+  start = now_seconds();
+  if (!load_source(&source, am_file_name)) {
+    free_diagnostics(&diagnostics);
+    free(am_file_name);
+    return;
+  }
+
+  if (threads_count > 0) {
+    has_error =
+        do_parallel_first_pass(&symbol_table, &source, &diagnostics,
+                               threads_count, first_pass_only ? NULL : &layout);
+  } else {
+    has_error = do_first_pass(&symbol_table, &source, &diagnostics);
+  }
+  result->first_pass_s = now_seconds() - start;
+
+  if (!has_error && first_pass_only) {
+    result->ok = 1;
+  } else if (!has_error) {
+    start = now_seconds();
+    if (threads_count > 0) {
+      has_error = do_parallel_second_pass(
+          &translator, &symbol_table, &source, &layout, &instruction_counter,
+          &data_counter, &diagnostics);
+    } else {
+      has_error = do_second_pass(&translator, &symbol_table, &source,
+                                 &instruction_counter, &data_counter,
+                                 &diagnostics);
+    }
+
+    if (!has_error) {
+      result->second_pass_s = now_seconds() - start;
+
+      start = now_seconds();
+      print_ob_file(NULL, am_file_name, translator->code_image->words,
+                    translator->code_image->count, instruction_counter,
+                    data_counter);
+
+      if (translator->internal_symbols) {
+        print_ent_file(NULL, am_file_name, translator->internal_symbols);
+      }
+
+      if (translator->external_symbols) {
+        print_ext_file(NULL, am_file_name, translator->external_symbols);
+      }
+      result->backend_s = now_seconds() - start;
+      result->ok = 1;
+    }
+  }
+
+  if (threads_count > 0 && !first_pass_only) {
+    free_layout(&layout);
+  }
+
+  free_translator(translator);
+  free_table(symbol_table);
+  free_diagnostics(&diagnostics);
+  free_source(&source);
+  free(am_file_name);
+
+  getrusage(RUSAGE_SELF, &usage);
+  result->peak_rss_kb = usage.ru_maxrss;
+}
+
+/* Forks a child for the workload so that memory use is measured alone. */
+static int bench_workload(const char *source_name, BenchResult *result) {
+  char *base_name = strdup(source_name);
+  char *extension = strrchr(base_name, '.');
+  int fds[2];
+  pid_t pid = 0;
+  int status = 0;
+
+  memset(result, 0, sizeof(*result));
+
+  if (extension && strcmp(extension, ".as") == 0) {
+    *extension = '\0';
+  }
+
+  if (pipe(fds) != 0) {
+    free(base_name);
+    return 0;
+  }
+
+  /* The child must not inherit and flush a copy of the pending report */
+  fflush(stdout);
+  pid = fork();
+
+  if (pid == 0) {
+    int null_fd = open("/dev/null", O_WRONLY);
+
+    close(fds[0]);
+
+    /* Keep the diagnostics of the passes out of the report */
+    if (null_fd >= 0) {
+      dup2(null_fd, STDOUT_FILENO);
+    }
+
+    run_workload(base_name, result);
+
+    if (write(fds[1], result, sizeof(*result)) != sizeof(*result)) {
+      _exit(EXIT_FAILURE);
+    }
+
+    _exit(EXIT_SUCCESS);
+  }
+
+  close(fds[1]);
+
+  if (pid < 0 || read(fds[0], result, sizeof(*result)) != sizeof(*result)) {
+    result->ok = 0;
+  }
+
+  close(fds[0]);
+  waitpid(pid, &status, 0);
+  free(base_name);
+
+  return result->ok;
+}
+
+static double total_seconds(const BenchResult *result) {
+  return result->preprocess_s + result->first_pass_s + result->second_pass_s +
+         result->backend_s;
+}
+
+static double lines_per_second(const BenchResult *result) {
+  double total = total_seconds(result);
+  return total > 0 ? result->lines / total : 0;
+}
+
+static const char *workload_name(const char *source_name) {
+  const char *slash = strrchr(source_name, '/');
+  return slash ? slash + 1 : source_name;
+}
+
+/*
+ * Finds the throughput recorded for a workload in a results file written by
+ * this runner. Returns 0 when the workload is not in the baseline.
+ */
+static double baseline_lines_per_second(const char *baseline,
+                                        const char *name) {
+  char key[256];
+  const char *entry = NULL;
+  const char *field = NULL;
+  double value = 0;
+
+  sprintf(key, "\"name\": \"%.200s\"", name);
+  entry = strstr(baseline, key);
+
+  if (!entry) {
+    return 0;
+  }
+
+  field = strstr(entry, "\"lines_per_s\": ");
+
+  if (!field || sscanf(field, "\"lines_per_s\": %lf", &value) != 1) {
+    return 0;
+  }
+
+  return value;
+}
+
+static char *read_file(const char *file_name) {
+  FILE *file = fopen(file_name, "r");
+  char *content = NULL;
+  long size = 0;
+
+  if (!file) {
+    return NULL;
+  }
+
+  fseek(file, 0, SEEK_END);
+  size = ftell(file);
+  rewind(file);
+
+  content = malloc(size + 1);
+
+  if (content) {
+    content[fread(content, 1, size, file)] = '\0';
+  }
+
+  fclose(file);
+  return content;
+}
+
+/* Finds the digit of a register operand in a line, -1 if there is none */
+static long find_register(const char *line, long length) {
+  long i = 0;
+
+  for (i = 1; i + 1 < length; i++) {
+    if (line[i] == 'r' && line[i + 1] >= '0' && line[i + 1] <= '7' &&
+        (line[i - 1] == ' ' || line[i - 1] == ',') &&
+        (i + 2 == length || line[i + 2] == '\n' || line[i + 2] == ',' ||
+         line[i + 2] == ' ')) {
+      return i + 1;
+    }
+  }
+
+  return -1;
+}
+
+/* Tells whether an incremental assembly has the result of a full one */
+static int same_result(const AsmResult *result, const AsmResult *other) {
+  const Symbol *symbol = NULL;
+  const Symbol *other_symbol = NULL;
+
+  if (result->status != other->status ||
+      result->words_count != other->words_count ||
+      result->instructions_count != other->instructions_count ||
+      result->data_count != other->data_count ||
+      memcmp(result->words, other->words,
+             result->words_count * sizeof(int)) != 0) {
+    return 0;
+  }
+
+  for (symbol = result->entries, other_symbol = other->entries;
+       symbol && other_symbol;
+       symbol = symbol->next, other_symbol = other_symbol->next) {
+    if (strcmp(symbol->symbol_name, other_symbol->symbol_name) != 0 ||
+        symbol->value != other_symbol->value) {
+      return 0;
+    }
+  }
+
+  if (symbol || other_symbol) {
+    return 0;
+  }
+
+  for (symbol = result->externals, other_symbol = other->externals;
+       symbol && other_symbol;
+       symbol = symbol->next, other_symbol = other_symbol->next) {
+    if (strcmp(symbol->symbol_name, other_symbol->symbol_name) != 0 ||
+        symbol->value != other_symbol->value) {
+      return 0;
+    }
+  }
+
+  return symbol == NULL && other_symbol == NULL;
+}
+
+/**
+ * @struct EditResult
+ * @brief The measurements of the incremental edits of a single workload.
+ */
+typedef struct {
+  int ok;              /**< Non zero when every edit gave the full result. */
+  long lines;          /**< Number of lines in the source. */
+  double full_s;       /**< Time of the first, full, assembly. */
+  double edit_s;       /**< Mean time of an edit. */
+  int edits;           /**< Number of edits timed. */
+  int full_edits;      /**< Number of edits that assembled everything. */
+  double parsed;       /**< Mean number of lines parsed by an edit. */
+  double encoded;      /**< Mean number of lines encoded by an edit. */
+} EditResult;
+
+/* Assembles a workload, then times edits of random register operands. */
+static void edit_workload(const char *source_name, EditResult *result) {
+  IncrementalAssembly assembly;
+  AsmResult full;
+  SourceFile source;
+  AsmOptions options;
+  char *text = read_file(source_name);
+  double start = 0;
+  int edited = 0;
+  int i = 0;
+
+  memset(result, 0, sizeof(EditResult));
+
+  if (text == NULL) {
+    return;
+  }
+
+  init_source(&source, text, strlen(text));
+  init_incremental(&assembly, source_name);
+  result->lines = source.lines_count;
+
+  start = now_seconds();
+  result->ok = update_incremental(&assembly, source.text, source.size);
+  result->full_s = now_seconds() - start;
+  srand(1);
+
+  for (i = 0; result->ok && source.lines_count > 0 && i < 100 * edits_count &&
+              edited < edits_count;
+       i++) {
+    int line = rand() % source.lines_count;
+    char *line_text = source.text + source.line_starts[line];
+    long length = source.line_starts[line + 1] - source.line_starts[line];
+    long digit = find_register(line_text, length);
+
+    if (digit < 0) {
+      continue;
+    }
+
+    line_text[digit] = '0' + (line_text[digit] - '0' + 1) % 8;
+
+    start = now_seconds();
+    result->ok = edit_incremental(&assembly, line, 1, line_text, length);
+    result->edit_s += now_seconds() - start;
+    result->full_edits += assembly.stats.is_full;
+    result->parsed += assembly.stats.parsed_lines;
+    result->encoded += assembly.stats.encoded_lines;
+    edited++;
+  }
+
+  if (edited > 0) {
+    result->edit_s /= edited;
+    result->parsed /= edited;
+    result->encoded /= edited;
+  }
+
+  result->edits = edited;
+
+  /* The edited source must give what a full assembly of it gives */
+  options.threads_count = 0;
+  options.check_only = false;
+  options.optimize = false;
+  options.strip = false;
+  options.line_table = false;
+  asm_assemble(NULL, source_name, source.text, source.size, &options, &full);
+  result->ok = result->ok && same_result(&assembly.result, &full);
+
+  asm_free_result(&full);
+  free_incremental(&assembly);
+  free_source(&source);
+}
+
+/* Runs the incremental benchmark on every workload. */
+static int bench_edits(char **source_names, int count, FILE *output) {
+  int failures = 0;
+  int i = 0;
+
+  fprintf(output, "{\n  \"incremental\": [\n");
+
+  printf("%-24s %9s %9s %9s %9s %9s %9s %9s\n", "workload", "lines",
+         "full(s)", "edit(us)", "speedup", "parsed", "encoded", "full");
+
+  for (i = 0; i < count; i++) {
+    EditResult result;
+    const char *name = workload_name(source_names[i]);
+
+    edit_workload(source_names[i], &result);
+
+    if (!result.ok) {
+      fprintf(stderr, "bench_runner: '%s' failed to assemble\n",
+              source_names[i]);
+      failures++;
+    }
+
+    printf("%-24s %9ld %9.3f %9.1f %9.0f %9.1f %9.1f %9d\n", name,
+           result.lines, result.full_s, result.edit_s * 1e6,
+           result.edit_s > 0 ? result.full_s / result.edit_s : 0,
+           result.parsed, result.encoded, result.full_edits);
+
+    fprintf(output,
+            "%s    {\n"
+            "      \"name\": \"%s\",\n"
+            "      \"ok\": %s,\n"
+            "      \"lines\": %ld,\n"
+            "      \"full_s\": %.6f,\n"
+            "      \"edits\": %d,\n"
+            "      \"edit_s\": %.9f,\n"
+            "      \"full_edits\": %d,\n"
+            "      \"parsed_lines\": %.1f,\n"
+            "      \"encoded_lines\": %.1f\n"
+            "    }",
+            i == 0 ? "" : ",\n", name, result.ok ? "true" : "false",
+            result.lines, result.full_s, result.edits, result.edit_s,
+            result.full_edits, result.parsed, result.encoded);
+  }
+
+  fprintf(output, "\n  ]\n}\n");
+
+  return failures > 0 ? EXIT_FAILURE : EXIT_SUCCESS;
+}
+
+static void usage(void) {
+  fprintf(stderr, "usage: bench_runner [-o results.json] [-b baseline.json] "
+                  "[-t percent] [-j threads] [-f] [-e edits] "
+                  "workload.as...\n");
+  exit(EXIT_FAILURE);
+}
+
+int main(int argc, char **argv) {
+  const char *output_name = NULL;
+  const char *baseline_name = NULL;
+  char *baseline = NULL;
+  double threshold = 10;
+  FILE *output = stdout;
+  int regressions = 0;
+  int failures = 0;
+  int first = 1;
+  int i = 1;
+
+  for (; i < argc && argv[i][0] == '-'; i++) {
+    if (strcmp(argv[i], "-f") == 0) {
+      first_pass_only = 1;
+      continue;
+    }
+
+    if (i + 1 >= argc) {
+      usage();
+    }
+
+    if (strcmp(argv[i], "-o") == 0) {
+      output_name = argv[++i];
+    } else if (strcmp(argv[i], "-b") == 0) {
+      baseline_name = argv[++i];
+    } else if (strcmp(argv[i], "-t") == 0) {
+      threshold = atof(argv[++i]);
+    } else if (strcmp(argv[i], "-j") == 0) {
+      threads_count = atoi(argv[++i]);
+    } else if (strcmp(argv[i], "-e") == 0) {
+      edits_count = atoi(argv[++i]);
+    } else {
+      usage();
+    }
+  }
+
+  if (i >= argc) {
+    usage();
+  }
+
+  if (baseline_name) {
+    baseline = read_file(baseline_name);
+  }
+
+  if (output_name && !(output = fopen(output_name, "w"))) {
+    fprintf(stderr, ERROR_CANNOT_WRITE, output_name);
+    return EXIT_FAILURE;
+  }
+
+  if (edits_count > 0) {
+    failures = bench_edits(argv + i, argc - i, output) != EXIT_SUCCESS;
+
+    if (output != stdout) {
+      fclose(output);
+    }
+
+    free(baseline);
+    return failures > 0 ? EXIT_FAILURE : EXIT_SUCCESS;
+  }
+
+  fprintf(output, "{\n  \"workloads\": [\n");
+
+  printf("%-24s %9s %9s %9s %9s %9s %12s %10s\n", "workload", "lines",
+         "prep(s)", "pass1(s)", "pass2(s)", "back(s)", "lines/s", "rss(KB)");
+
+  for (; i < argc; i++) {
+    BenchResult result;
+    const char *name = workload_name(argv[i]);
+
+    if (!bench_workload(argv[i], &result)) {
+      fprintf(stderr, "bench_runner: '%s' failed to assemble\n", argv[i]);
+      failures++;
+    }
+
+    printf("%-24s %9ld %9.3f %9.3f %9.3f %9.3f %12.0f %10ld\n", name,
+           result.lines, result.preprocess_s, result.first_pass_s,
+           result.second_pass_s, result.backend_s, lines_per_second(&result),
+           result.peak_rss_kb);
+
+    if (baseline) {
+      double before = baseline_lines_per_second(baseline, name);
+
+      if (before > 0) {
+        double change = 100 * (lines_per_second(&result) - before) / before;
+
+        printf("%-24s %+.1f%% vs baseline%s\n", "", change,
+               change < -threshold ? "  REGRESSION" : "");
+
+        if (change < -threshold) {
+          regressions++;
+        }
+      }
+    }
+
+    fprintf(output,
+            "%s    {\n"
+            "      \"name\": \"%s\",\n"
+            "      \"threads\": %d,\n"
+            "      \"ok\": %s,\n"
+            "      \"lines\": %ld,\n"
+            "      \"preprocess_s\": %.6f,\n"
+            "      \"first_pass_s\": %.6f,\n"
+            "      \"second_pass_s\": %.6f,\n"
+            "      \"backend_s\": %.6f,\n"
+            "      \"total_s\": %.6f,\n"
+            "      \"lines_per_s\": %.1f,\n"
+            "      \"peak_rss_kb\": %ld\n"
+            "    }",
+            first ? "" : ",\n", name, threads_count,
+            result.ok ? "true" : "false",
+            result.lines, result.preprocess_s, result.first_pass_s,
+            result.second_pass_s, result.backend_s, total_seconds(&result),
+            lines_per_second(&result), result.peak_rss_kb);
+    first = 0;
+  }
+
+  fprintf(output, "\n  ]\n}\n");
+
+  if (output != stdout) {
+    fclose(output);
+  }
+
+  free(baseline);
+
+  if (regressions > 0) {
+    printf("%d workload(s) regressed by more than %.0f%%\n", regressions,
+           threshold);
+  }
+
+  return failures > 0 ? EXIT_FAILURE : EXIT_SUCCESS;
+}
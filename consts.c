@@ -14,4 +14,4 @@ char *keywords[KEYWORDS_COUNT] = {
     "mov",   "cmp",     "add",    "sub",     "lea",     "not", "clr", "inc",
     "dec",   "jmp",     "bne",    "red",     "prn",     "jsr", "rts", "hlt",
     ".data", ".string", ".entry", ".extern", ".define", "r0",  "r1",  "r2",
-    "r3",    "r4",      "r5",     "r6",      "r7"};
\ No newline at end of file
+    "r3",    "r4",      "r5",     "r6",      "r7",      ".fill", ".space"};
\ No newline at end of file
@@ -9,10 +9,15 @@
 #define MAX_LINE_LENGTH 80
 #define MAX_LABEL_LENGTH 31
 #define INST_TABLE_SIZE 16
-#define KEYWORDS_COUNT 29
+#define KEYWORDS_COUNT 31
+/* Overridable so that benchmarks can assemble sources beyond the line limit */
+#ifndef MAX_MEMORY_SIZE
 #define MAX_MEMORY_SIZE 4096
+#endif
 #define MAX_WORD_SIZE 14
-#define MAX_ERROR_LENGTH 200
+#define FIRST_ADDRESS 100
+/* The words of an image loaded at FIRST_ADDRESS that fit the memory */
+#define MAX_IMAGE_SIZE (MAX_MEMORY_SIZE - FIRST_ADDRESS)
 
 #define STR_CAT_WITH_MALLOC(str1, str2)                                        \
   strcat(strcpy(malloc(strlen(str1) + strlen(str2) + 1), str1), str2)
@@ -1,83 +1,57 @@
 #include "converter.h"
-#include "errors.h"
-#include <string.h>
 
-char *to_binary14(int num) {
-  char *binary14 = (char *)malloc(15);
-  int i = 0;
-
-  if (binary14 == NULL) {
-    fprintf(stderr, ERROR_OUT_OF_MEMORY);
-    exit(EXIT_FAILURE);
-  }
-
-  for (i = 13; i >= 0; i--) {
-    int bit = (num >> i) & 1;
-    binary14[13 - i] = bit + '0';
-  }
-  binary14[14] = '\0';
-
-  return binary14;
+/* The digit of every character, -1 for the characters of no digit */
+static const signed char digit_values[256] = {
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, 3, -1, 1, -1, 2, -1, -1, -1, -1, 0, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1};
+
+int to_word(int num) { return num & WORD_MASK; }
+
+int rotate_left(int word, int offset) {
+  word = to_word(word);
+
+  return to_word((word << offset) | (word >> (14 - offset)));
 }
 
-char *shift_left(const char *binary_14, int offset) {
+void to_base4_encrypted(int word, char encoded[ENCRYPTED_WORD_LENGTH + 1]) {
+  static const char digits[] = {'*', '#', '%', '!'};
   int i = 0;
-  int len = strlen(binary_14);
-  char *shifted_str = (char *)malloc(len + 1);
-
-  if (shifted_str == NULL) {
-    fprintf(stderr, ERROR_OUT_OF_MEMORY);
-    exit(EXIT_FAILURE);
-  }
 
-  for (i = 0; i < len; ++i) {
-    int newIndex = (i + offset) % len;
-    shifted_str[i] = binary_14[newIndex];
+  for (i = 0; i < ENCRYPTED_WORD_LENGTH; i++) {
+    encoded[i] = digits[(word >> (2 * (ENCRYPTED_WORD_LENGTH - 1 - i))) & 3];
   }
 
-  shifted_str[len] = '\0';
-
-  return shifted_str;
+  encoded[ENCRYPTED_WORD_LENGTH] = '\0';
 }
 
-char *add_binary_numbers(const char *binary14_1, const char *binary14_2) {
-  int num1 = strtol(binary14_1, NULL, 2);
-  int num2 = strtol(binary14_2, NULL, 2);
-  int sum = num1 + num2;
-
-  return to_binary14(sum);
-}
-
-char *to_base4_encrypted(char *binary14) {
-  int len = strlen(binary14) / 2;
-  char *encoded = (char *)malloc((len + 1) * sizeof(char));
+int from_base4_encrypted(const char *encoded, int *word) {
+  int digit = 0;
   int i = 0;
 
-  if (!encoded) {
-    fprintf(stderr, ERROR_OUT_OF_MEMORY);
-    exit(EXIT_FAILURE);
-  }
-
-  for (i = 0; i < len; i++) {
-    int base4_digit = 2 * (binary14[2 * i] - '0') + (binary14[2 * i + 1] - '0');
+  *word = 0;
 
-    switch (base4_digit) {
-    case 0:
-      encoded[i] = '*';
-      break;
-    case 1:
-      encoded[i] = '#';
-      break;
-    case 2:
-      encoded[i] = '%';
-      break;
-    case 3:
-      encoded[i] = '!';
-      break;
+  /* The null character has no digit, so a short string stops the loop */
+  for (i = 0; i < ENCRYPTED_WORD_LENGTH; i++) {
+    if ((digit = digit_values[(unsigned char)encoded[i]]) < 0) {
+      return 0;
     }
-  }
 
-  encoded[len] = '\0';
+    *word = (*word << 2) | digit;
+  }
 
-  return encoded;
-}
\ No newline at end of file
+  return 1;
+}
@@ -3,61 +3,60 @@
 
 /**
  * @file converter.h
- * @brief This file contains functions for converting integers to binary strings
- * and shifting, adding, and encrypting binary strings.
+ * @brief This file contains functions for converting integers to 14-bit machine
+ * words and encrypting the words.
  */
 
 #include <stdio.h>
 #include <stdlib.h>
 
+#define WORD_MASK 0x3FFF
+#define ENCRYPTED_WORD_LENGTH 7
+
 /**
- * @brief Converts an integer to a 14-bit binary string.
+ * @brief Converts an integer to a 14-bit word.
  *
- * This function takes an integer and converts it to a 14-bit binary string.
+ * This function keeps the 14 least significant bits of the two's complement
+ * representation of the integer.
  *
  * @param num The integer to convert.
- * @return A pointer to the 14-bit binary string.
+ * @return The 14-bit word.
  */
-char *to_binary14(int num);
+int to_word(int num);
 
 /**
- * @brief Shifts a 14-bit binary string to the left by a specified offset.
+ * @brief Rotates a 14-bit word to the left by a specified offset.
  *
- * This function takes a 14-bit binary string and an offset, and returns a
- * new string where each bit is shifted to the left by the offset.
+ * The bits shifted out on the left are shifted back in on the right.
  *
- * @param binary_14 The 14-bit binary string to shift.
- * @param offset The number of positions to shift the string to the left.
- * @return A pointer to the shifted binary string.
+ * @param word The 14-bit word to rotate.
+ * @param offset The number of positions to rotate the word to the left.
+ * @return The rotated word.
  */
-char *shift_left(const char *binary14, int offset);
+int rotate_left(int word, int offset);
 
 /**
- * @brief Adds two 14-bit binary numbers.
+ * @brief Converts a 14-bit word to an encrypted base-4 string.
  *
- * This function takes two 14-bit binary strings, converts them to integers,
- * adds them together, and then converts the sum back to a 14-bit binary string.
+ * Each pair of bits, from the most significant one, is converted to a base-4
+ * digit, which is then encrypted to a character according to the following
+ * mapping: 0 -> '*', 1 -> '#', 2 -> '%', 3 -> '!'.
  *
- * @param binary14_1 The first 14-bit binary string.
- * @param binary14_2 The second 14-bit binary string.
- * @return A pointer to the 14-bit binary string representing the sum.
+ * @param word The 14-bit word to convert.
+ * @param encoded The buffer receiving the encrypted base-4 string.
  */
-char *add_binary_numbers(const char *binary14_1, const char *binary14_2);
+void to_base4_encrypted(int word, char encoded[ENCRYPTED_WORD_LENGTH + 1]);
 
 /**
- * @brief Converts a 14-bit binary string to an encrypted base-4 string.
- *
- * This function takes a 14-bit binary string and converts it to an encrypted
- * base-4 string. Each pair of binary digits is converted to a base-4 digit,
- * which is then encrypted to a character according to the following mapping:
- * 0 -> '*', 1 -> '#', 2 -> '%', 3 -> '!'.
- * The resulting string is allocated on
- * the heap and should be freed when no longer needed. If memory allocation
- * fails, the function prints an error message and exits the program.
- *
- * @param binary14 The 14-bit binary string to convert.
- * @return A pointer to the encrypted base-4 string.
+ * @brief Converts an encrypted base-4 string back to a 14-bit word.
+ *
+ * This function reverses to_base4_encrypted(), reading exactly
+ * ENCRYPTED_WORD_LENGTH characters.
+ *
+ * @param encoded The encrypted base-4 string.
+ * @param word The 14-bit word.
+ * @return 1 if every character is one of the mapping, 0 otherwise.
  */
-char *to_base4_encrypted(char *binary14);
+int from_base4_encrypted(const char *encoded, int *word);
 
-#endif
\ No newline at end of file
+#endif
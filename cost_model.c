@@ -0,0 +1,154 @@
+#include "cost_model.h"
+#include "errors.h"
+#include <string.h>
+
+extern Instruction inst_table[INST_TABLE_SIZE];
+
+/* The names of the addressing modes in a cost file */
+static const char *mode_names[ADDRESSING_MODES_COUNT] = {
+    "immediate", "direct", "indexed", "register"};
+
+void init_cost_model(CostModel *model) {
+  int opcode = 0;
+
+  for (opcode = 0; opcode < INST_TABLE_SIZE; opcode++) {
+    model->opcode_cycles[opcode] = 1;
+  }
+
+  model->opcode_cycles[OPCODE_JMP] = 2;
+  model->opcode_cycles[OPCODE_BNE] = 2;
+  model->opcode_cycles[OPCODE_JSR] = 3;
+  model->opcode_cycles[OPCODE_RTS] = 3;
+
+  model->mode_cycles[MODE_IMMEDIATE] = 1;
+  model->mode_cycles[MODE_DIRECT] = 2;
+  model->mode_cycles[MODE_INDEXED] = 3;
+  model->mode_cycles[MODE_REGISTER] = 0;
+}
+
+/* Finds the cost a cost file names, NULL if it names none */
+static int *find_cost(CostModel *model, const char *name) {
+  int i = 0;
+
+  for (i = 0; i < INST_TABLE_SIZE; i++) {
+    if (strcmp(inst_table[i].name, name) == 0) {
+      return &model->opcode_cycles[i];
+    }
+  }
+
+  for (i = 0; i < ADDRESSING_MODES_COUNT; i++) {
+    if (strcmp(mode_names[i], name) == 0) {
+      return &model->mode_cycles[i];
+    }
+  }
+
+  return NULL;
+}
+
+bool read_cost_model(CostModel *model, const char *file_name) {
+  char line[MAX_LINE_LENGTH + 2];
+  char name[MAX_LINE_LENGTH + 2];
+  char extra[2];
+  FILE *file = fopen(file_name, "r");
+  int current_line = 0;
+  int cycles = 0;
+  int *cost = NULL;
+
+  if (file == NULL) {
+    fprintf(stderr, ERROR_CANNOT_READ, file_name);
+    return false;
+  }
+
+  while (fgets(line, sizeof(line), file)) {
+    current_line++;
+
+    if (sscanf(line, "%s", name) != 1 || name[0] == ';') {
+      continue;
+    }
+
+    if (sscanf(line, "%s %d %1s", name, &cycles, extra) != 2 ||
+        (cost = find_cost(model, name)) == NULL || cycles < 0) {
+      line[strcspn(line, "\r\n")] = '\0';
+      fprintf(stderr, ERROR_INVALID_COST, line, current_line, file_name);
+      fclose(file);
+      return false;
+    }
+
+    *cost = cycles;
+  }
+
+  fclose(file);
+
+  return true;
+}
+
+void init_execution_stats(ExecutionStats *stats, const CostModel *model) {
+  memset(stats, 0, sizeof(ExecutionStats));
+  stats->model = model;
+}
+
+/* Whether an operand is accessed in memory */
+static bool is_in_memory(const MachineOperand *operand) {
+  return operand->mode == MODE_DIRECT || operand->mode == MODE_INDEXED;
+}
+
+void count_instruction(ExecutionStats *stats,
+                       const DecodedInstruction *instruction, int address,
+                       int next_address) {
+  int opcode = instruction->opcode;
+  const MachineOperand *source = &instruction->operands[0];
+  const MachineOperand *destination = &instruction->operands[1];
+
+  stats->cycles += stats->model->opcode_cycles[opcode];
+  stats->fetches += instruction->size;
+
+  if (inst_table[opcode].source_operand[0] != '\0') {
+    stats->cycles += stats->model->mode_cycles[source->mode];
+    stats->reads += (opcode_accesses[opcode] & ACCESS_READS_SOURCE) &&
+                    is_in_memory(source);
+  }
+
+  if (inst_table[opcode].destination_operand[0] != '\0') {
+    stats->cycles += stats->model->mode_cycles[destination->mode];
+    stats->reads += (opcode_accesses[opcode] & ACCESS_READS_DESTINATION) &&
+                    is_in_memory(destination);
+    stats->writes += (opcode_accesses[opcode] & ACCESS_WRITES_DESTINATION) &&
+                     is_in_memory(destination);
+  }
+
+  switch (opcode) {
+  case OPCODE_BNE:
+    stats->branches++;
+    stats->taken += next_address != address + instruction->size;
+    break;
+  case OPCODE_JMP:
+    stats->jumps++;
+    break;
+  case OPCODE_JSR:
+    stats->calls++;
+    break;
+  case OPCODE_RTS:
+    stats->returns++;
+    break;
+  default:
+    break;
+  }
+}
+
+void print_execution_stats(const ExecutionStats *stats,
+                           unsigned long instructions, const char *file_name,
+                           FILE *out) {
+  fprintf(out, "Statistics of '%s':\n", file_name);
+  fprintf(out, "  instructions   %14lu\n", instructions);
+  fprintf(out, "  cycles         %14lu\n", stats->cycles);
+  fprintf(out, "  cycles/instr   %14.2f\n",
+          instructions > 0 ? (double)stats->cycles / instructions : 0);
+  fprintf(out, "  words fetched  %14lu\n", stats->fetches);
+  fprintf(out, "  memory reads   %14lu\n", stats->reads);
+  fprintf(out, "  memory writes  %14lu\n", stats->writes);
+  fprintf(out, "  branches       %14lu\n", stats->branches);
+  fprintf(out, "  taken          %14lu\n", stats->taken);
+  fprintf(out, "  jumps          %14lu\n", stats->jumps);
+  fprintf(out, "  calls          %14lu\n", stats->calls);
+  fprintf(out, "  returns        %14lu\n", stats->returns);
+}
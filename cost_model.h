@@ -0,0 +1,106 @@
+#ifndef __COST_MODEL__H__
+#define __COST_MODEL__H__
+
+/**
+ * @file cost_model.h
+ * @brief This file contains the definition of the cost model of the machine
+ * and of the counters of an execution under it.
+ *
+ * An instruction costs the cycles of its opcode plus the cycles of the
+ * addressing mode of each of its operands. By default every opcode costs one
+ * cycle, except for the jumps, two, and the calls and returns, three, and the
+ * operands cost the words they add to the instruction and their access to
+ * memory: an immediate one cycle, a direct two, an indexed three, and a
+ * register none. A cost file changes any of them, one per line as the name of
+ * the opcode or of the mode, 'immediate', 'direct', 'indexed' or 'register',
+ * followed by its cycles. The lines starting with ';' are comments.
+ *
+ * The counters are updated only by the loop the machine runs in when it
+ * collects them, so the loop that does not is left without a single added
+ * instruction.
+ */
+
+#include "machine.h"
+#include <stdio.h>
+
+#define ADDRESSING_MODES_COUNT 4
+
+/**
+ * @struct CostModel
+ * @brief The cycles of every opcode and addressing mode.
+ */
+typedef struct {
+  int opcode_cycles[INST_TABLE_SIZE];       /**< The cycles of every opcode. */
+  int mode_cycles[ADDRESSING_MODES_COUNT];  /**< The cycles of every operand,
+                                               by its mode. */
+} CostModel;
+
+/**
+ * @struct ExecutionStats
+ * @brief The counters of an execution.
+ */
+typedef struct ExecutionStats {
+  const CostModel *model;   /**< The costs of the instructions. */
+  unsigned long cycles;     /**< The cycles of the executed instructions. */
+  unsigned long fetches;    /**< The words of the executed instructions. */
+  unsigned long reads;      /**< The operands read from memory. */
+  unsigned long writes;     /**< The operands written to memory. */
+  unsigned long branches;   /**< The executed bne. */
+  unsigned long taken;      /**< The bne that jumped. */
+  unsigned long jumps;      /**< The executed jmp. */
+  unsigned long calls;      /**< The executed jsr. */
+  unsigned long returns;    /**< The executed rts. */
+} ExecutionStats;
+
+/**
+ * @brief Initializes a cost model with the default costs.
+ *
+ * @param model The model to initialize.
+ */
+void init_cost_model(CostModel *model);
+
+/**
+ * @brief Reads the costs of a cost file into a model.
+ *
+ * An error is printed for the first line that does not name an opcode or a
+ * mode followed by a number of cycles.
+ *
+ * @param model The model, whose costs the file does not name are kept.
+ * @param file_name The name of the cost file.
+ * @return true if the file was read, false otherwise.
+ */
+bool read_cost_model(CostModel *model, const char *file_name);
+
+/**
+ * @brief Initializes the counters of an execution.
+ *
+ * @param stats The counters to initialize.
+ * @param model The costs of the instructions.
+ */
+void init_execution_stats(ExecutionStats *stats, const CostModel *model);
+
+/**
+ * @brief Counts an executed instruction.
+ *
+ * @param stats The counters.
+ * @param instruction The instruction.
+ * @param address The address of the instruction.
+ * @param next_address The program counter after the instruction.
+ */
+void count_instruction(ExecutionStats *stats,
+                       const DecodedInstruction *instruction, int address,
+                       int next_address);
+
+/**
+ * @brief Prints the counters of an execution.
+ *
+ * @param stats The counters.
+ * @param instructions The number of executed instructions.
+ * @param file_name The name of the object file reported.
+ * @param out The stream to write the counters to.
+ */
+void print_execution_stats(const ExecutionStats *stats,
+                           unsigned long instructions, const char *file_name,
+                           FILE *out);
+
+#endif
@@ -0,0 +1,388 @@
+#define _POSIX_C_SOURCE 200809L
+#include "coverage.h"
+#include "errors.h"
+#include "parallel.h"
+#include "utils.h"
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+extern Instruction inst_table[INST_TABLE_SIZE];
+
+/* The characters of the line a coverage file starts with */
+#define COVERAGE_HEADER_LENGTH 64
+
+/**
+ * @struct CoverageWorker
+ * @brief The coverage files a thread reads, and what they cover.
+ */
+typedef struct {
+  char **file_names; /**< The names of all the coverage files. */
+  int count;         /**< The number of coverage files. */
+  int first;         /**< The first file of the thread. */
+  int stride;        /**< The number of threads. */
+  bool is_ok;        /**< Whether every file of the thread was read. */
+  Coverage coverage; /**< What the files of the thread cover. */
+} CoverageWorker;
+
+static bool is_set(const unsigned char *bitmap, int address) {
+  return (bitmap[address >> 3] >> (address & 7)) & 1;
+}
+
+static double share(int count, int total) {
+  return total > 0 ? 100.0 * count / total : 0;
+}
+
+void init_coverage(Coverage *coverage, const ObjectFile *object) {
+  int i = 0;
+
+  memset(coverage, 0, sizeof(Coverage));
+  coverage->words_count = object->words_count;
+
+  /* Kept to 32 bits, so the files read the same on every machine */
+  for (i = 0; i < object->words_count; i++) {
+    coverage->checksum =
+        (coverage->checksum * 31 + object->words[i]) & 0xFFFFFFFFUL;
+  }
+}
+
+void cover_instruction(Coverage *coverage,
+                       const DecodedInstruction *instruction, int address,
+                       int next_address) {
+  unsigned char bit = (unsigned char)(1 << (address & 7));
+
+  coverage->executed[address >> 3] |= bit;
+
+  if (instruction->opcode == OPCODE_BNE) {
+    if (next_address == address + instruction->size) {
+      coverage->not_taken[address >> 3] |= bit;
+    } else {
+      coverage->taken[address >> 3] |= bit;
+    }
+  }
+}
+
+void merge_coverage(Coverage *coverage, const Coverage *other) {
+  int i = 0;
+
+  coverage->runs += other->runs;
+
+  /* Loops of ORs the compiler turns into vector instructions */
+  for (i = 0; i < COVERAGE_BITMAP_SIZE; i++) {
+    coverage->executed[i] |= other->executed[i];
+  }
+
+  for (i = 0; i < COVERAGE_BITMAP_SIZE; i++) {
+    coverage->taken[i] |= other->taken[i];
+  }
+
+  for (i = 0; i < COVERAGE_BITMAP_SIZE; i++) {
+    coverage->not_taken[i] |= other->not_taken[i];
+  }
+}
+
+bool write_coverage(const Coverage *coverage, const char *file_name) {
+  FILE *file = fopen(file_name, "wb");
+  bool is_ok = false;
+
+  if (file == NULL) {
+    fprintf(stderr, ERROR_CANNOT_WRITE, file_name);
+    return false;
+  }
+
+  fprintf(file, "%s %lu %d %lu\n", COVERAGE_MAGIC, coverage->runs,
+          coverage->words_count, coverage->checksum);
+  fwrite(coverage->executed, 1, COVERAGE_BITMAP_SIZE, file);
+  fwrite(coverage->taken, 1, COVERAGE_BITMAP_SIZE, file);
+  fwrite(coverage->not_taken, 1, COVERAGE_BITMAP_SIZE, file);
+  is_ok = !ferror(file);
+
+  if (fclose(file) != 0 || !is_ok) {
+    fprintf(stderr, ERROR_CANNOT_WRITE, file_name);
+    return false;
+  }
+
+  return true;
+}
+
+bool read_coverage(Coverage *coverage, const char *file_name) {
+  FILE *file = fopen(file_name, "rb");
+  char header[COVERAGE_HEADER_LENGTH];
+  char magic[COVERAGE_HEADER_LENGTH];
+  Coverage *other = NULL;
+  bool is_ok = false;
+  bool is_same = false;
+
+  if (file == NULL) {
+    fprintf(stderr, ERROR_CANNOT_READ, file_name);
+    return false;
+  }
+
+  other = (Coverage *)allocate(sizeof(Coverage));
+
+  is_ok = fgets(header, sizeof(header), file) &&
+          sscanf(header, "%s %lu %d %lu", magic, &other->runs,
+                 &other->words_count, &other->checksum) == 4 &&
+          strcmp(magic, COVERAGE_MAGIC) == 0 &&
+          fread(other->executed, 1, COVERAGE_BITMAP_SIZE, file) ==
+              COVERAGE_BITMAP_SIZE &&
+          fread(other->taken, 1, COVERAGE_BITMAP_SIZE, file) ==
+              COVERAGE_BITMAP_SIZE &&
+          fread(other->not_taken, 1, COVERAGE_BITMAP_SIZE, file) ==
+              COVERAGE_BITMAP_SIZE &&
+          getc(file) == EOF;
+
+  is_same = is_ok && other->words_count == coverage->words_count &&
+            other->checksum == coverage->checksum;
+
+  if (is_same) {
+    merge_coverage(coverage, other);
+  } else if (is_ok) {
+    fprintf(stderr, ERROR_COVERAGE_OF_OTHER_IMAGE, file_name);
+  } else {
+    fprintf(stderr, ERROR_INVALID_COVERAGE_FILE, file_name);
+  }
+
+  fclose(file);
+  free(other);
+
+  return is_same;
+}
+
+static void *run_worker(void *arg) {
+  CoverageWorker *worker = (CoverageWorker *)arg;
+  int i = 0;
+
+  for (i = worker->first; i < worker->count; i += worker->stride) {
+    if (!read_coverage(&worker->coverage, worker->file_names[i])) {
+      worker->is_ok = false;
+    }
+  }
+
+  return NULL;
+}
+
+bool read_coverage_files(Coverage *coverage, char **file_names, int count,
+                         int threads_count) {
+  CoverageWorker *workers = NULL;
+  bool is_ok = true;
+  int i = 0;
+
+  if (threads_count <= 0) {
+    threads_count = (int)sysconf(_SC_NPROCESSORS_ONLN);
+  }
+
+  if (threads_count > count) {
+    threads_count = count;
+  }
+
+  if (threads_count < 1) {
+    return true;
+  }
+
+  /* Every thread merges its files on its own, the threads at the end */
+  workers = (CoverageWorker *)allocate(threads_count * sizeof(CoverageWorker));
+
+  for (i = 0; i < threads_count; i++) {
+    workers[i].file_names = file_names;
+    workers[i].count = count;
+    workers[i].first = i;
+    workers[i].stride = threads_count;
+    workers[i].is_ok = true;
+
+    /* Every thread covers the same image, with no address covered yet */
+    memset(&workers[i].coverage, 0, sizeof(Coverage));
+    workers[i].coverage.words_count = coverage->words_count;
+    workers[i].coverage.checksum = coverage->checksum;
+  }
+
+  run_parallel(run_worker, workers, sizeof(CoverageWorker), threads_count);
+
+  for (i = 0; i < threads_count; i++) {
+    merge_coverage(coverage, &workers[i].coverage);
+    is_ok = is_ok && workers[i].is_ok;
+  }
+
+  free(workers);
+
+  return is_ok;
+}
+
+/* Marks the addresses of the code image where an instruction starts */
+static int find_instructions(const Machine *machine, const ObjectFile *object,
+                             bool *is_start) {
+  int end = IMAGE_START + object->instructions;
+  int count = 0;
+  int address = IMAGE_START;
+
+  memset(is_start, 0, MAX_MEMORY_SIZE * sizeof(bool));
+
+  while (address < end && address < MAX_MEMORY_SIZE) {
+    int size = machine->decoded[address].size;
+
+    is_start[address] = true;
+    count++;
+    address += size > 0 ? size : 1;
+  }
+
+  return count;
+}
+
+/* Finds whether the words of a run hold instructions, and whether they ran */
+static bool is_run_code(const Coverage *coverage, const ObjectFile *object,
+                        const bool *is_start, int index, bool *is_covered) {
+  int address = IMAGE_START + object->lines.runs[index].address;
+  int end = IMAGE_START + (index + 1 < object->lines.count
+                               ? object->lines.runs[index + 1].address
+                               : object->instructions);
+  bool is_code = false;
+
+  *is_covered = false;
+
+  for (; address < end && address < MAX_MEMORY_SIZE; address++) {
+    if (is_start[address]) {
+      is_code = true;
+      *is_covered = *is_covered || is_set(coverage->executed, address);
+    }
+  }
+
+  return is_code;
+}
+
+static bool is_code_label(const ObjectFile *object, const Symbol *label) {
+  return label->value >= IMAGE_START &&
+         label->value < IMAGE_START + object->instructions;
+}
+
+static void print_total(const char *name, int covered, int total, FILE *out) {
+  fprintf(out, "  %-18s %6d of %6d %7.2f%%\n", name, covered, total,
+          share(covered, total));
+}
+
+void print_coverage(const Coverage *coverage, const Machine *machine,
+                    const ObjectFile *object, const SourceFile *source,
+                    const char *file_name, FILE *out) {
+  char location[LOCATION_LENGTH];
+  bool *is_start = (bool *)allocate(MAX_MEMORY_SIZE * sizeof(bool));
+  const Symbol *label = NULL;
+  long *starts = NULL;
+  int lines_count = 0;
+  int instructions = find_instructions(machine, object, is_start);
+  int covered_instructions = 0;
+  int directions = 0;
+  int covered_directions = 0;
+  int code_lines = 0;
+  int covered_lines = 0;
+  int labels = 0;
+  int covered_labels = 0;
+  bool is_covered = false;
+  int i = 0;
+
+  if (source) {
+    starts = find_physical_lines(source, &lines_count);
+  }
+
+  for (i = 0; i < MAX_MEMORY_SIZE; i++) {
+    if (is_start[i]) {
+      covered_instructions += is_set(coverage->executed, i);
+
+      if (machine->decoded[i].opcode == OPCODE_BNE) {
+        directions += 2;
+        covered_directions +=
+            is_set(coverage->taken, i) + is_set(coverage->not_taken, i);
+      }
+    }
+  }
+
+  for (i = 0; i < object->lines.count; i++) {
+    if (is_run_code(coverage, object, is_start, i, &is_covered)) {
+      code_lines++;
+      covered_lines += is_covered;
+    }
+  }
+
+  for (label = object->entries; label; label = label->next) {
+    if (is_code_label(object, label)) {
+      labels++;
+      covered_labels += is_set(coverage->executed, label->value);
+    }
+  }
+
+  fprintf(out, "Coverage of '%s' over %lu runs.\n", file_name,
+          coverage->runs);
+  print_total("Instructions", covered_instructions, instructions, out);
+  print_total("Branch directions", covered_directions, directions, out);
+
+  if (object->lines.count > 0) {
+    print_total("Lines", covered_lines, code_lines, out);
+  }
+
+  print_total("Labels", covered_labels, labels, out);
+
+  /* The lines say which instructions ran, which only the addresses can say
+     without a map file */
+  if (object->lines.count > 0) {
+    fprintf(out, "\nLines:\n");
+
+    for (i = 0; i < object->lines.count; i++) {
+      const LineRun *run = &object->lines.runs[i];
+
+      if (!is_run_code(coverage, object, is_start, i, &is_covered)) {
+        continue;
+      }
+
+      fprintf(out, "  %5d ", run->line);
+
+      if (run->call_line > 0) {
+        fprintf(out, "%5d", run->call_line);
+      } else {
+        fprintf(out, "    -");
+      }
+
+      fprintf(out, "  %-9s  ", is_covered ? "covered" : "uncovered");
+      print_physical_line(source, starts, lines_count, run->line, out);
+      fprintf(out, "\n");
+    }
+  } else {
+    fprintf(out, "\nUncovered instructions:\n");
+
+    for (i = 0; i < MAX_MEMORY_SIZE; i++) {
+      if (is_start[i] && !is_set(coverage->executed, i)) {
+        int opcode = machine->decoded[i].opcode;
+
+        format_location(object, i, location);
+        fprintf(out, "  %04d %-24s %s\n", i, location,
+                opcode >= 0 ? inst_table[opcode].name : "?");
+      }
+    }
+  }
+
+  fprintf(out, "\nLabels:\n");
+
+  for (label = object->entries; label; label = label->next) {
+    if (is_code_label(object, label)) {
+      fprintf(out, "  %04d %-24s %s\n", label->value, label->symbol_name,
+              is_set(coverage->executed, label->value) ? "covered"
+                                                       : "uncovered");
+    }
+  }
+
+  fprintf(out, "\nBranches:\n");
+
+  for (i = 0; i < MAX_MEMORY_SIZE; i++) {
+    if (is_start[i] && machine->decoded[i].opcode == OPCODE_BNE) {
+      bool is_taken = is_set(coverage->taken, i);
+      bool is_not_taken = is_set(coverage->not_taken, i);
+
+      format_location(object, i, location);
+      fprintf(out, "  %04d %-24s %s\n", i, location,
+              is_taken && is_not_taken ? "both ways"
+              : is_taken               ? "taken only"
+              : is_not_taken           ? "not taken only"
+                                       : "never run");
+    }
+  }
+
+  free(starts);
+  free(is_start);
+}
@@ -0,0 +1,128 @@
+#ifndef __COVERAGE__H__
+#define __COVERAGE__H__
+
+/**
+ * @file coverage.h
+ * @brief This file contains the definition of the coverage of executions,
+ * which instructions of the image ran and which ways every bne went.
+ *
+ * The coverage is a bitmap with a bit per address, set with a single OR after
+ * every instruction the machine executes, and two more bitmaps for the bne
+ * that jumped and the bne that did not. The bitmaps of many executions merge
+ * by ORing them, so the coverage file of every execution is small and merged
+ * in loops of ORs the compiler vectorizes, the files spread over several
+ * threads that each merge their own before the threads are merged.
+ *
+ * A coverage file starts with COVERAGE_MAGIC, the number of executions it
+ * covers and the size and checksum of the image they ran on a line, followed
+ * by the three bitmaps. Only the files of the same image are merged.
+ */
+
+#include "machine.h"
+#include "object_file.h"
+#include "source.h"
+#include <stdio.h>
+
+#define COVERAGE_MAGIC "ASMCOV2"
+#define COVERAGE_BITMAP_SIZE (MAX_MEMORY_SIZE / 8)
+
+/**
+ * @struct Coverage
+ * @brief The instructions and branches executions covered.
+ */
+typedef struct Coverage {
+  unsigned long runs;                            /**< The executions
+                                                    covered. */
+  int words_count;                               /**< The size of the image
+                                                    covered. */
+  unsigned long checksum;                        /**< The checksum of the
+                                                    words of the image. */
+  unsigned char executed[COVERAGE_BITMAP_SIZE];  /**< The addresses
+                                                    executed. */
+  unsigned char taken[COVERAGE_BITMAP_SIZE];     /**< The addresses of the bne
+                                                    that jumped. */
+  unsigned char not_taken[COVERAGE_BITMAP_SIZE]; /**< The addresses of the bne
+                                                    that did not. */
+} Coverage;
+
+/**
+ * @brief Initializes a coverage of the image of an object file with no
+ * address covered.
+ *
+ * @param coverage The coverage to initialize.
+ * @param object The object file.
+ */
+void init_coverage(Coverage *coverage, const ObjectFile *object);
+
+/**
+ * @brief Covers an executed instruction.
+ *
+ * @param coverage The coverage.
+ * @param instruction The instruction.
+ * @param address The address of the instruction.
+ * @param next_address The program counter after the instruction.
+ */
+void cover_instruction(Coverage *coverage,
+                       const DecodedInstruction *instruction, int address,
+                       int next_address);
+
+/**
+ * @brief Adds what a coverage covers to another.
+ *
+ * @param coverage The coverage to add to.
+ * @param other The coverage added.
+ */
+void merge_coverage(Coverage *coverage, const Coverage *other);
+
+/**
+ * @brief Writes a coverage to a coverage file.
+ *
+ * An error is printed when the file cannot be written.
+ *
+ * @param coverage The coverage.
+ * @param file_name The name of the coverage file.
+ * @return true if the file was written, false otherwise.
+ */
+bool write_coverage(const Coverage *coverage, const char *file_name);
+
+/**
+ * @brief Reads a coverage file and adds what it covers to a coverage.
+ *
+ * An error is printed when the file cannot be read, is not a coverage file or
+ * covers another image than the coverage.
+ *
+ * @param coverage The coverage to add to.
+ * @param file_name The name of the coverage file.
+ * @return true if the file was read, false otherwise.
+ */
+bool read_coverage(Coverage *coverage, const char *file_name);
+
+/**
+ * @brief Reads coverage files on several threads and adds what they cover to
+ * a coverage.
+ *
+ * @param coverage The coverage to add to.
+ * @param file_names The names of the coverage files.
+ * @param count The number of files.
+ * @param threads_count The number of threads, 0 for one per processor.
+ * @return true if every file was read, false otherwise.
+ */
+bool read_coverage_files(Coverage *coverage, char **file_names, int count,
+                         int threads_count);
+
+/**
+ * @brief Prints the instructions, branches, lines and .entry labels a
+ * coverage covers and does not.
+ *
+ * @param coverage The coverage.
+ * @param machine A machine the image is loaded into.
+ * @param object The object file.
+ * @param source The assembly file the map file names, or NULL.
+ * @param file_name The name of the object file reported.
+ * @param out The stream to write the report to.
+ */
+void print_coverage(const Coverage *coverage, const Machine *machine,
+                    const ObjectFile *object, const SourceFile *source,
+                    const char *file_name, FILE *out);
+
+#endif
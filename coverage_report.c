@@ -0,0 +1,101 @@
+/**
+ * @file coverage_report.c
+ * @brief Merges the coverage files the emulator writes with -v and reports
+ * what they cover.
+ *
+ * The file is named as the assembler writes it, without its extension, so
+ * that the entry file names the .entry labels and the map file names the
+ * lines of the assembly file, when it was assembled with -g. The coverage
+ * files are merged on -j threads, one per processor by default, and the time
+ * the merge took is printed on stderr. The report says how many of the
+ * instructions, of the ways the bne instructions go, of the lines and of the
+ * .entry labels of the code ran, and lists which did and which did not. With
+ * -o the merged coverage is also written to a coverage file of its own, which
+ * merges again as the others do.
+ *
+ * Usage:
+ *   coverage_report [-j threads] [-o merged.cov] file file.cov...
+ */
+
+#include "coverage.h"
+#include "errors.h"
+#include "machine.h"
+#include "object_file.h"
+#include "source.h"
+#include "utils.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+static void usage(void) {
+  fprintf(stderr, "usage: coverage_report [-j threads] [-o merged.cov] file "
+                  "file.cov...\n");
+  exit(EXIT_FAILURE);
+}
+
+int main(int argc, char **argv) {
+  const char *merged_file_name = NULL;
+  char *ob_file_name = NULL;
+  Machine *machine = NULL;
+  Coverage *coverage = NULL;
+  ObjectFile object;
+  SourceFile source;
+  bool has_source = false;
+  bool is_ok = false;
+  int threads_count = 0;
+  double start = 0;
+  int i = 1;
+
+  for (; i < argc && argv[i][0] == '-'; i++) {
+    if (i + 1 < argc && strcmp(argv[i], "-j") == 0) {
+      threads_count = atoi(argv[++i]);
+    } else if (i + 1 < argc && strcmp(argv[i], "-o") == 0) {
+      merged_file_name = argv[++i];
+    } else {
+      usage();
+    }
+  }
+
+  if (i + 2 > argc) {
+    usage();
+  }
+
+  ob_file_name = STR_CAT_WITH_MALLOC(argv[i], ".ob");
+  machine = (Machine *)allocate(sizeof(Machine));
+  coverage = (Coverage *)allocate(sizeof(Coverage));
+  init_object_file(&object);
+
+  /* The image is loaded to find where its instructions start */
+  if (read_object_file(&object, argv[i]) &&
+      load_machine(machine, &object, ob_file_name)) {
+    init_coverage(coverage, &object);
+    start = now_seconds();
+    is_ok = read_coverage_files(coverage, argv + i + 1, argc - i - 1,
+                                threads_count);
+    fprintf(stderr, "Merged %d coverage files in %.6f seconds.\n",
+            argc - i - 1, now_seconds() - start);
+
+    /* The lines are shown when the assembly file is where it was assembled */
+    if (object.source_file_name) {
+      has_source = load_source(&source, object.source_file_name);
+    }
+
+    print_coverage(coverage, machine, &object, has_source ? &source : NULL,
+                   ob_file_name, stdout);
+
+    if (merged_file_name && !write_coverage(coverage, merged_file_name)) {
+      is_ok = false;
+    }
+  }
+
+  if (has_source) {
+    free_source(&source);
+  }
+
+  free_object_file(&object);
+  free(coverage);
+  free(machine);
+  free(ob_file_name);
+
+  return is_ok ? EXIT_SUCCESS : EXIT_FAILURE;
+}
@@ -0,0 +1,364 @@
+/**
+ * @file debugger.c
+ * @brief Runs a program the assembler writes under the commands read from the
+ * standard input.
+ *
+ * The file is named as the assembler writes it, without its extension, so
+ * that the .entry labels of the entry file name its addresses. The program is
+ * loaded stopped before its first instruction. It runs at full speed until it
+ * reaches a breakpoint, which replaces the handler of its address in the
+ * machine rather than being looked for after every instruction. The red
+ * instructions read the file given with -i, or nothing.
+ *
+ * Commands:
+ *   break location        Stops before the instruction at the location.
+ *   delete location       Clears the breakpoint at the location.
+ *   continue              Runs until a breakpoint or the end of the program.
+ *   step [count]          Executes one instruction, or count of them.
+ *   registers             Prints r0 to r7, the PSW and the program counter.
+ *   memory location [n]   Prints the word at the location, or n words from it.
+ *   where                 Prints the instruction at the program counter.
+ *   quit                  Ends the debugger.
+ *
+ * A location is an address or an .entry label, and every command can be
+ * shortened to any start of its name, down to its first letter.
+ *
+ * Usage:
+ *   debugger [-i input] file
+ */
+
+#include "converter.h"
+#include "errors.h"
+#include "machine.h"
+#include "object_file.h"
+#include "utils.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define COMMAND_LENGTH 256
+#define COMMANDS_COUNT 8
+
+extern Instruction inst_table[INST_TABLE_SIZE];
+
+/* The names of the commands, no two starting with the same letter */
+static const char *commands[COMMANDS_COUNT] = {
+    "break", "delete", "continue", "step",
+    "registers", "memory", "where", "quit"};
+
+/* Finds the command a word is the start of the name of, NULL if none */
+static const char *find_command(const char *word) {
+  size_t length = strlen(word);
+  int i = 0;
+
+  for (i = 0; i < COMMANDS_COUNT; i++) {
+    if (strncmp(commands[i], word, length) == 0) {
+      return commands[i];
+    }
+  }
+
+  return NULL;
+}
+
+/* Finds the address of a location, printing why when there is none */
+static bool parse_location(const ObjectFile *object, const char *text,
+                           int *address) {
+  char label[MAX_LABEL_LENGTH];
+  const Symbol *symbol = NULL;
+  char *end = NULL;
+  long value = strtol(text, &end, 10);
+
+  if (end != text && *end == '\0') {
+    if (value < 0 || value >= MAX_MEMORY_SIZE) {
+      printf("Address %ld is outside of the memory.\n", value);
+      return false;
+    }
+
+    *address = (int)value;
+    return true;
+  }
+
+  if (strlen(text) < MAX_LABEL_LENGTH) {
+    strcpy(label, text);
+    symbol = lookup(label, object->entries);
+  }
+
+  if (symbol == NULL) {
+    printf("No .entry label '%s'.\n", text);
+    return false;
+  }
+
+  *address = symbol->value;
+
+  return true;
+}
+
+/* Prints an address as the .entry label before it and the distance */
+static void print_location(const ObjectFile *object, int address) {
+  const Symbol *label = find_entry_label(object, address);
+
+  if (label == NULL) {
+    printf("%04d", address);
+  } else if (label->value == address) {
+    printf("%04d <%s>", address, label->symbol_name);
+  } else {
+    printf("%04d <%s+%d>", address, label->symbol_name,
+           address - label->value);
+  }
+}
+
+static void print_operand(const MachineOperand *operand) {
+  switch (operand->mode) {
+  case MODE_IMMEDIATE:
+    printf("#%d", operand->value);
+    break;
+  case MODE_REGISTER:
+    printf("r%d", operand->value);
+    break;
+  default:
+    printf("%04d", operand->value);
+    break;
+  }
+}
+
+/* Prints the instruction at an address, with the line it was assembled from */
+static void print_instruction(const Machine *machine,
+                              const ObjectFile *object, int address) {
+  const LineRun *run = find_line_run(&object->lines, address - IMAGE_START);
+  DecodedInstruction instruction;
+  const Instruction *entry = NULL;
+
+  decode_instruction(machine, address, &instruction);
+  print_location(object, address);
+
+  if (instruction.opcode < 0) {
+    printf(":  (not an instruction)");
+  } else {
+    entry = &inst_table[instruction.opcode];
+    printf(":  %s", entry->name);
+
+    if (entry->source_operand[0] != '\0') {
+      printf(" ");
+      print_operand(&instruction.operands[0]);
+      printf(",");
+    }
+
+    if (entry->destination_operand[0] != '\0') {
+      printf(" ");
+      print_operand(&instruction.operands[1]);
+    }
+  }
+
+  if (run) {
+    printf("  (line %d)", run->line);
+  }
+
+  printf("\n");
+}
+
+static void print_word(int word) {
+  char encoded[ENCRYPTED_WORD_LENGTH + 1];
+
+  to_base4_encrypted(word, encoded);
+  printf("%s  %6d", encoded, word_value(word));
+}
+
+static void print_registers(const Machine *machine) {
+  int i = 0;
+
+  for (i = 0; i < MACHINE_REGISTERS_COUNT; i++) {
+    printf("r%d   ", i);
+    print_word(machine->registers[i]);
+    printf("\n");
+  }
+
+  printf("PSW  Z=%d\n", machine->is_zero ? 1 : 0);
+  printf("PC   %04d\n", machine->pc);
+}
+
+static void print_memory(const Machine *machine, int address, int count) {
+  for (; count > 0 && address < MAX_MEMORY_SIZE; count--, address++) {
+    printf("%04d   ", address);
+    print_word(machine->memory[address]);
+    printf("\n");
+  }
+}
+
+/* Prints where the machine stopped after it ran */
+static void print_stop(const Machine *machine, const ObjectFile *object,
+                       const char *file_name) {
+  switch (machine->status) {
+  case MACHINE_RUNNING:
+    print_instruction(machine, object, machine->pc);
+    break;
+  case MACHINE_BREAKPOINT:
+    printf("Breakpoint at ");
+    print_instruction(machine, object, machine->pc);
+    break;
+  case MACHINE_HALTED:
+    fflush(machine->output);
+    printf("The program ended after %lu instructions.\n", machine->steps);
+    break;
+  default:
+    fflush(machine->output);
+    print_machine_status(machine, file_name, stdout);
+    break;
+  }
+}
+
+static bool is_stopped(const Machine *machine) {
+  return machine->status == MACHINE_RUNNING ||
+         machine->status == MACHINE_BREAKPOINT;
+}
+
+/* Runs a command, returning false once the debugger is to end */
+static bool run_command(Machine *machine, const ObjectFile *object,
+                        const char *file_name, const char *line) {
+  char word[COMMAND_LENGTH];
+  char argument[COMMAND_LENGTH];
+  const char *command = NULL;
+  int count = 1;
+  int address = 0;
+  int arguments = sscanf(line, "%s %s %d", word, argument, &count);
+
+  if (arguments < 1) {
+    return true;
+  }
+
+  command = find_command(word);
+
+  if (command == NULL) {
+    printf("Unknown command '%s'.\n", word);
+    return true;
+  }
+
+  switch (command[0]) {
+  case 'b':
+  case 'd':
+    if (arguments < 2) {
+      printf("A location is expected.\n");
+    } else if (parse_location(object, argument, &address)) {
+      if (command[0] == 'b') {
+        set_breakpoint(machine, address);
+        printf("Breakpoint set at ");
+      } else {
+        clear_breakpoint(machine, address);
+        printf("Breakpoint cleared at ");
+      }
+
+      print_location(object, address);
+      printf(".\n");
+    }
+    break;
+  case 'c':
+  case 's':
+    if (!is_stopped(machine)) {
+      printf("The program is not running.\n");
+      break;
+    }
+
+    if (command[0] == 's' && arguments >= 2) {
+      count = atoi(argument);
+    }
+
+    /* The instruction of the breakpoint stopped at runs before the others */
+    if (command[0] == 'c' && step_machine(machine) == MACHINE_RUNNING) {
+      run_machine(machine);
+    }
+
+    for (; command[0] == 's' && count > 0 && is_stopped(machine); count--) {
+      step_machine(machine);
+    }
+
+    print_stop(machine, object, file_name);
+    break;
+  case 'r':
+    print_registers(machine);
+    break;
+  case 'm':
+    if (arguments < 2) {
+      printf("A location is expected.\n");
+    } else if (parse_location(object, argument, &address)) {
+      print_memory(machine, address, count);
+    }
+    break;
+  case 'w':
+    print_stop(machine, object, file_name);
+    break;
+  case 'q':
+    return false;
+  default:
+    break;
+  }
+
+  return true;
+}
+
+static void usage(void) {
+  fprintf(stderr, "usage: debugger [-i input] file\n");
+  exit(EXIT_FAILURE);
+}
+
+int main(int argc, char **argv) {
+  char line[COMMAND_LENGTH];
+  const char *input_file_name = NULL;
+  char *ob_file_name = NULL;
+  Machine *machine = NULL;
+  ObjectFile object;
+  int i = 1;
+
+  for (; i < argc && argv[i][0] == '-'; i++) {
+    if (i + 1 < argc && strcmp(argv[i], "-i") == 0) {
+      input_file_name = argv[++i];
+    } else {
+      usage();
+    }
+  }
+
+  if (i + 1 != argc) {
+    usage();
+  }
+
+  ob_file_name = STR_CAT_WITH_MALLOC(argv[i], ".ob");
+  machine = (Machine *)allocate(sizeof(Machine));
+  init_object_file(&object);
+
+  if (!read_object_file(&object, argv[i]) ||
+      !load_machine(machine, &object, ob_file_name)) {
+    free_object_file(&object);
+    free(machine);
+    free(ob_file_name);
+    return EXIT_FAILURE;
+  }
+
+  /* The commands are read from the standard input, so red reads a file */
+  machine->input = input_file_name ? fopen(input_file_name, "r") : tmpfile();
+
+  if (machine->input == NULL) {
+    fprintf(stderr, ERROR_CANNOT_READ,
+            input_file_name ? input_file_name : "tmpfile");
+    free_object_file(&object);
+    free(machine);
+    free(ob_file_name);
+    return EXIT_FAILURE;
+  }
+
+  print_stop(machine, &object, ob_file_name);
+
+  do {
+    printf("(debugger) ");
+    fflush(stdout);
+  } while (fgets(line, sizeof(line), stdin) &&
+           run_command(machine, &object, ob_file_name, line));
+
+  if (feof(stdin)) {
+    printf("\n");
+  }
+
+  fclose(machine->input);
+  free_object_file(&object);
+  free(machine);
+  free(ob_file_name);
+
+  return EXIT_SUCCESS;
+}
@@ -0,0 +1,259 @@
+#include "diagnostics.h"
+#include "errors.h"
+#include <stdarg.h>
+#include <stdlib.h>
+#include <string.h>
+
+/**
+ * @brief The message of each diagnostic code and the arguments it expects.
+ *
+ * In the argument list 's' is a text argument, 'd' a number argument, 'L' the
+ * line and 'F' the file name. Only 's' and 'd' are passed when recording.
+ */
+static const struct {
+  const char *format;
+  const char *args;
+} descriptors[DIAG_CODES_COUNT] = {
+    {"", ""},
+    {ERROR_MACRO_NAME, "sLF"},
+    {ERROR_MISSING_MACRO_NAME, "LF"},
+    {ERROR_UNEXPECTED_COMMA_AFTER_KEYWORD, "sLF"},
+    {ERROR_LABEL_NAME_TOO_LONG, "sdLF"},
+    {ERROR_LABEL_CANNOT_START_WITH_NUM, "LF"},
+    {ERROR_LABEL_NAME_NOT_LETTER_OR_NUM, "LF"},
+    {ERROR_LABEL_NAME_IS_KEYWORD, "sLF"},
+    {ERROR_WHITESPACE_AFTER_LABEL, "LF"},
+    {WARN_LABEL_IGNORED, "sLF"},
+    {ERROR_EXPECTED_LABEL, "sLF"},
+    {ERROR_UNEXPECTED_COMMA, "LF"},
+    {ERROR_EXTRA_COMMA_AFTER_NUMBER, "sLF"},
+    {ERROR_MISSING_COMMA_BETWEEN_NUMBERS, "ssLF"},
+    {ERROR_UNEXPECTED_COMMA_AFTER_DIRECTIVE, "LF"},
+    {ERROR_INVALID_DEFINE_DEFINITION, "sLF"},
+    {ERROR_INVALID_STRING_DEFINITION, "sLF"},
+    {ERROR_INVALID_INSTRUCTION, "sLF"},
+    {ERROR_UNEXPECTED_COMMA_AFTER_INSTRUCTION, "sLF"},
+    {ERROR_EXPECTED_COMMA_AFTER_OPERAND, "ssLF"},
+    {ERROR_UNEXPECTED_COMMA_AFTER_OPERAND, "ssLF"},
+    {ERROR_UNEXPECTED_COMMAS_AFTER_OPERAND, "ssLF"},
+    {ERROR_UNEXPECTED_OPERANDS_AFTER_INSTRUCTION, "sdLF"},
+    {ERROR_EXPECTED_OPERANDS_AFTER_INSTRUCTION, "sdLF"},
+    {ERROR_INVALID_OPERAND, "ssLF"},
+    {ERROR_INVALID_OPERAND_TYPE, "sssLF"},
+    {ERROR_UNEXPECTED_INSTRUCTION_OPERANDS, "sLF"},
+    {ERROR_INVALID_DATA_ELEMENT, "sLF"},
+    {ERROR_INVALID_DATA_ELEMENT_TYPE, "sLF"},
+    {ERROR_UNDEFIND_DATA_SYMBOL_ELEMENT, "sLF"},
+    {ERROR_UNDEFIND_SYMBOL, "sLF"},
+    {ERROR_REDEFINITION_OF_SYMBOL, "sLF"},
+    {ERROR_MEMORY_OVERFLOW, "Fd"},
+    {ERROR_IMAGE_OVERFLOW, "Fd"},
+    {ERROR_INVALID_BLOCK_DIRECTIVE, "ssLF"},
+    {ERROR_INVALID_BLOCK_SIZE, "sdLF"},
+    {ERROR_UNDEFINED_CONSTANT, "ssLF"},
+    {ERROR_DIVISION_BY_ZERO, "sLF"},
+    {ERROR_EXPRESSION_OUT_OF_RANGE, "sdLF"}};
+
+void init_diagnostics(DiagnosticList *list, const char *file_name) {
+  list->file_name = file_name;
+  list->diagnostics = NULL;
+  list->count = 0;
+  list->capacity = 0;
+  list->errors_count = 0;
+}
+
+void free_diagnostics(DiagnosticList *list) {
+  free(list->diagnostics);
+  list->diagnostics = NULL;
+  list->count = 0;
+  list->capacity = 0;
+}
+
+static void vset_diagnostic(Diagnostic *diagnostic, DiagnosticCode code,
+                            int line, int column, va_list args) {
+  const char *spec = descriptors[code].args;
+  int used = 0;
+
+  diagnostic->code = code;
+  diagnostic->line = line;
+  diagnostic->column = column;
+  diagnostic->args_count = 0;
+
+  for (; *spec != '\0'; spec++) {
+    DiagnosticArg *arg = &diagnostic->args[diagnostic->args_count];
+
+    if (*spec == 'd') {
+      arg->length = -1;
+      arg->number = va_arg(args, int);
+      diagnostic->args_count++;
+    } else if (*spec == 's') {
+      const char *text = va_arg(args, const char *);
+      int length = text ? strlen(text) : 0;
+
+      if (length > MAX_DIAGNOSTIC_TEXT - used) {
+        length = MAX_DIAGNOSTIC_TEXT - used;
+      }
+
+      if (text) {
+        memcpy(diagnostic->text + used, text, length);
+      }
+
+      arg->offset = used;
+      arg->length = length;
+      used += length;
+      diagnostic->args_count++;
+    }
+  }
+}
+
+void set_diagnostic(Diagnostic *diagnostic, DiagnosticCode code, int line,
+                    int column, ...) {
+  va_list args;
+
+  if (diagnostic == NULL) {
+    return;
+  }
+
+  va_start(args, column);
+  vset_diagnostic(diagnostic, code, line, column, args);
+  va_end(args);
+}
+
+static Diagnostic *append_diagnostic(DiagnosticList *list) {
+  if (list->count == list->capacity) {
+    int capacity = list->capacity ? 2 * list->capacity : 8;
+    Diagnostic *temp =
+        realloc(list->diagnostics, capacity * sizeof(Diagnostic));
+
+    if (temp == NULL) {
+      fprintf(stderr, ERROR_OUT_OF_MEMORY);
+      exit(EXIT_FAILURE);
+    }
+
+    list->diagnostics = temp;
+    list->capacity = capacity;
+  }
+
+  return &list->diagnostics[list->count++];
+}
+
+void report_diagnostic(DiagnosticList *list, DiagnosticCode code, int line,
+                       int column, ...) {
+  Diagnostic *diagnostic = append_diagnostic(list);
+  va_list args;
+
+  va_start(args, column);
+  vset_diagnostic(diagnostic, code, line, column, args);
+  va_end(args);
+
+  if (!is_warning(diagnostic)) {
+    list->errors_count++;
+  }
+}
+
+void add_diagnostic(DiagnosticList *list, const Diagnostic *diagnostic) {
+  if (diagnostic->code == DIAG_NONE) {
+    return;
+  }
+
+  *append_diagnostic(list) = *diagnostic;
+
+  if (!is_warning(diagnostic)) {
+    list->errors_count++;
+  }
+}
+
+bool is_warning(const Diagnostic *diagnostic) {
+  return diagnostic->code == DIAG_LABEL_IGNORED;
+}
+
+void print_diagnostic(const Diagnostic *diagnostic, const char *file_name,
+                      FILE *out) {
+  const char *format = descriptors[diagnostic->code].format;
+  const char *spec = descriptors[diagnostic->code].args;
+  int arg_index = 0;
+
+  for (; *format != '\0'; format++) {
+    /* The text up to the next conversion is written at once */
+    if (*format != '%') {
+      const char *end = strchr(format, '%');
+      size_t length = end ? (size_t)(end - format) : strlen(format);
+
+      fwrite(format, 1, length, out);
+      format += length - 1;
+      continue;
+    }
+
+    format++;
+
+    if (*format == '%') {
+      putc('%', out);
+      continue;
+    }
+
+    switch (*spec++) {
+    case 'L':
+      fprintf(out, "%d", diagnostic->line);
+      break;
+    case 'F':
+      fputs(file_name, out);
+      break;
+    default: {
+      const DiagnosticArg *arg = &diagnostic->args[arg_index++];
+
+      if (arg->length < 0) {
+        fprintf(out, "%d", arg->number);
+      } else {
+        fwrite(diagnostic->text + arg->offset, 1, arg->length, out);
+      }
+      break;
+    }
+    }
+  }
+}
+
+static int compare_by_line(const void *a, const void *b) {
+  const Diagnostic *first = *(const Diagnostic *const *)a;
+  const Diagnostic *second = *(const Diagnostic *const *)b;
+
+  if (first->line != second->line) {
+    return first->line < second->line ? -1 : 1;
+  }
+
+  /* Keep the recording order of diagnostics on the same line */
+  return first < second ? -1 : (first > second ? 1 : 0);
+}
+
+void print_diagnostics(const DiagnosticList *list, int first, int count,
+                       FILE *out) {
+  const Diagnostic **ordered = NULL;
+  int i = 0;
+
+  if (count <= 0) {
+    return;
+  }
+
+  ordered = malloc(count * sizeof(Diagnostic *));
+
+  if (ordered == NULL) {
+    fprintf(stderr, ERROR_OUT_OF_MEMORY);
+    exit(EXIT_FAILURE);
+  }
+
+  for (i = 0; i < count; i++) {
+    ordered[i] = &list->diagnostics[first + i];
+  }
+
+  qsort(ordered, count, sizeof(Diagnostic *), compare_by_line);
+
+  for (i = 0; i < count; i++) {
+    print_diagnostic(ordered[i], list->file_name, out);
+  }
+
+  free(ordered);
+}
+
+void flush_diagnostics(DiagnosticList *list, FILE *out) {
+  print_diagnostics(list, 0, list->count, out);
+  list->count = 0;
+}
@@ -0,0 +1,193 @@
+#ifndef __DIAGNOSTICS__H__
+#define __DIAGNOSTICS__H__
+
+/**
+ * @file diagnostics.h
+ * @brief This file contains the definition and manipulation functions for the
+ * diagnostics collected while assembling a file.
+ *
+ * A diagnostic is recorded as an error code, a position and the arguments of
+ * its message. The text of the message is only formatted when the diagnostics
+ * are reported, so recording one never allocates memory.
+ */
+
+#include "consts.h"
+#include <stdbool.h>
+#include <stdio.h>
+
+#define MAX_DIAGNOSTIC_ARGS 4
+#define MAX_DIAGNOSTIC_TEXT (2 * MAX_LINE_LENGTH + 8)
+
+/**
+ * @brief The codes of the diagnostics, one for each message in errors.h.
+ */
+typedef enum {
+  DIAG_NONE,
+  DIAG_MACRO_NAME,
+  DIAG_MISSING_MACRO_NAME,
+  DIAG_UNEXPECTED_COMMA_AFTER_KEYWORD,
+  DIAG_LABEL_NAME_TOO_LONG,
+  DIAG_LABEL_CANNOT_START_WITH_NUM,
+  DIAG_LABEL_NAME_NOT_LETTER_OR_NUM,
+  DIAG_LABEL_NAME_IS_KEYWORD,
+  DIAG_WHITESPACE_AFTER_LABEL,
+  DIAG_LABEL_IGNORED,
+  DIAG_EXPECTED_LABEL,
+  DIAG_UNEXPECTED_COMMA,
+  DIAG_EXTRA_COMMA_AFTER_NUMBER,
+  DIAG_MISSING_COMMA_BETWEEN_NUMBERS,
+  DIAG_UNEXPECTED_COMMA_AFTER_DIRECTIVE,
+  DIAG_INVALID_DEFINE_DEFINITION,
+  DIAG_INVALID_STRING_DEFINITION,
+  DIAG_INVALID_INSTRUCTION,
+  DIAG_UNEXPECTED_COMMA_AFTER_INSTRUCTION,
+  DIAG_EXPECTED_COMMA_AFTER_OPERAND,
+  DIAG_UNEXPECTED_COMMA_AFTER_OPERAND,
+  DIAG_UNEXPECTED_COMMAS_AFTER_OPERAND,
+  DIAG_UNEXPECTED_OPERANDS_AFTER_INSTRUCTION,
+  DIAG_EXPECTED_OPERANDS_AFTER_INSTRUCTION,
+  DIAG_INVALID_OPERAND,
+  DIAG_INVALID_OPERAND_TYPE,
+  DIAG_UNEXPECTED_INSTRUCTION_OPERANDS,
+  DIAG_INVALID_DATA_ELEMENT,
+  DIAG_INVALID_DATA_ELEMENT_TYPE,
+  DIAG_UNDEFINED_DATA_SYMBOL_ELEMENT,
+  DIAG_UNDEFINED_SYMBOL,
+  DIAG_REDEFINITION_OF_SYMBOL,
+  DIAG_MEMORY_OVERFLOW,
+  DIAG_IMAGE_OVERFLOW,
+  DIAG_INVALID_BLOCK_DIRECTIVE,
+  DIAG_INVALID_BLOCK_SIZE,
+  DIAG_UNDEFINED_CONSTANT,
+  DIAG_DIVISION_BY_ZERO,
+  DIAG_EXPRESSION_OUT_OF_RANGE,
+  DIAG_CODES_COUNT
+} DiagnosticCode;
+
+/**
+ * @struct DiagnosticArg
+ * @brief An argument of a diagnostic message.
+ *
+ * Text arguments are spans of the text buffer of the diagnostic, number
+ * arguments are stored by value.
+ */
+typedef struct {
+  int offset; /**< The start of a text argument in the text buffer. */
+  int length; /**< The length of a text argument, -1 for a number. */
+  int number; /**< The value of a number argument. */
+} DiagnosticArg;
+
+/**
+ * @struct Diagnostic
+ * @brief A diagnostic recorded for a line of the assembly file.
+ */
+typedef struct {
+  DiagnosticCode code; /**< The code of the diagnostic, DIAG_NONE if unset. */
+  int line;            /**< The line the diagnostic refers to. */
+  int column;          /**< The column the diagnostic refers to, 0 if none. */
+  int args_count;      /**< The number of recorded arguments. */
+  DiagnosticArg args[MAX_DIAGNOSTIC_ARGS]; /**< The message arguments. */
+  char text[MAX_DIAGNOSTIC_TEXT]; /**< The text of the text arguments. */
+} Diagnostic;
+
+/**
+ * @struct DiagnosticList
+ * @brief The diagnostics collected for a single assembly file.
+ */
+typedef struct {
+  const char *file_name;   /**< The file the diagnostics belong to. */
+  Diagnostic *diagnostics; /**< The collected diagnostics. */
+  int count;               /**< The number of collected diagnostics. */
+  int capacity;            /**< The number of allocated diagnostics. */
+  int errors_count;        /**< The number of errors among them. */
+} DiagnosticList;
+
+/**
+ * @brief Initializes an empty diagnostic list for a file.
+ *
+ * @param list The list to initialize.
+ * @param file_name The name of the file reported in the messages.
+ */
+void init_diagnostics(DiagnosticList *list, const char *file_name);
+
+/**
+ * @brief Frees the memory allocated for a diagnostic list.
+ *
+ * @param list The list to free.
+ */
+void free_diagnostics(DiagnosticList *list);
+
+/**
+ * @brief Records a diagnostic.
+ *
+ * The variable arguments are the arguments of the message of the code, in the
+ * order they appear in it, without the line and the file name. Text arguments
+ * are copied, so they do not have to outlive the call.
+ *
+ * @param diagnostic The diagnostic to record into, ignored when NULL.
+ * @param code The code of the diagnostic.
+ * @param line The line the diagnostic refers to.
+ * @param column The column the diagnostic refers to, 0 if unknown.
+ * @param ... The arguments of the message.
+ */
+void set_diagnostic(Diagnostic *diagnostic, DiagnosticCode code, int line,
+                    int column, ...);
+
+/**
+ * @brief Records a diagnostic straight into a diagnostic list.
+ *
+ * @param list The list to add the diagnostic to.
+ * @param code The code of the diagnostic.
+ * @param line The line the diagnostic refers to.
+ * @param column The column the diagnostic refers to, 0 if unknown.
+ * @param ... The arguments of the message, as for set_diagnostic().
+ */
+void report_diagnostic(DiagnosticList *list, DiagnosticCode code, int line,
+                       int column, ...);
+
+/**
+ * @brief Adds a copy of a recorded diagnostic to a diagnostic list.
+ *
+ * @param list The list to add the diagnostic to.
+ * @param diagnostic The diagnostic to add, ignored if it is unset.
+ */
+void add_diagnostic(DiagnosticList *list, const Diagnostic *diagnostic);
+
+/**
+ * @brief Checks if a diagnostic is a warning rather than an error.
+ *
+ * @param diagnostic The diagnostic to check.
+ * @return true if the diagnostic is a warning, false otherwise.
+ */
+bool is_warning(const Diagnostic *diagnostic);
+
+/**
+ * @brief Formats the message of a diagnostic.
+ *
+ * @param diagnostic The diagnostic to format.
+ * @param file_name The name of the file reported in the message.
+ * @param out The stream to write the message to.
+ */
+void print_diagnostic(const Diagnostic *diagnostic, const char *file_name,
+                      FILE *out);
+
+/**
+ * @brief Prints a range of the collected diagnostics ordered by line.
+ *
+ * @param list The list to print from.
+ * @param first The index of the first diagnostic of the range.
+ * @param count The number of diagnostics in the range.
+ * @param out The stream to write the messages to.
+ */
+void print_diagnostics(const DiagnosticList *list, int first, int count,
+                       FILE *out);
+
+/**
+ * @brief Prints the collected diagnostics ordered by line and clears the list.
+ *
+ * @param list The list to print.
+ * @param out The stream to write the messages to.
+ */
+void flush_diagnostics(DiagnosticList *list, FILE *out);
+
+#endif
@@ -0,0 +1,700 @@
+/**
+ * @file disassembler.c
+ * @brief Writes the programs the assembler writes back as assembly.
+ *
+ * Every file is named as the assembler writes it, without its extension, so
+ * that the entry file and the external file next to the object file name the
+ * addresses and the external symbols. The words of the object file are decoded
+ * with tables: a table of the 256 characters gives the digit of every
+ * character of a word, and a table of the 256 values of the opcode and mode
+ * bits of a first word gives the instruction and the modes of its operands,
+ * so that decoding a word takes no search. The operand words are then decoded
+ * as the second pass encodes them.
+ *
+ * The assembly is written to the standard output: the .entry and .extern
+ * lines, then the lines of the image in order. The image keeps the order of
+ * the lines of the assembly file, so the data written before the last
+ * instruction is among the instructions, and a word there that is not an
+ * instruction is written as data. An address an operand names gets the .entry
+ * label of the entry file, or a label Lnnnn after its address, and an external
+ * symbol missing from the external file gets a name Xnnnn after the address
+ * of the word using it. Assembling the output writes the same object file
+ * again, which makes a round trip for checking the words an optimization
+ * writes. A word the assembly cannot write back, or data among the
+ * instructions that decodes as an instruction, which makes fewer data words
+ * than the header counts, is warned about, and the program then exits with a
+ * failure.
+ *
+ * With -a every line starts with its address and its words, as a listing, and
+ * is no longer assembly.
+ *
+ * Usage:
+ *   disassembler [-a] file...
+ */
+
+#include "converter.h"
+#include "errors.h"
+#include "machine.h"
+#include "object_file.h"
+#include "utils.h"
+#include <stddef.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+/* The first word of an instruction has the opcode and the modes in bits 2-9 */
+#define LAYOUTS_COUNT 256
+#define LAYOUT_SHIFT 2
+#define LAYOUT_MASK 0xFF
+
+/* The values of a .data line at most */
+#define DATA_PER_LINE 8
+
+/* The width of the labels, and of the words of the listing */
+#define LABEL_COLUMN 8
+#define WORDS_COLUMN (MACHINE_MAX_INSTRUCTION_SIZE * (ENCRYPTED_WORD_LENGTH + 1))
+
+extern Instruction inst_table[INST_TABLE_SIZE];
+
+/**
+ * @struct Layout
+ * @brief The instruction the opcode and mode bits of a first word encode.
+ */
+typedef struct {
+  int opcode;              /**< The opcode, -1 if the bits are not those of
+                              an instruction. */
+  int operands;            /**< The number of operands, a single one being
+                              the destination. */
+  AddressingMode modes[2]; /**< The modes of the source and destination. */
+} Layout;
+
+/**
+ * @struct Operand
+ * @brief An operand decoded from its words.
+ */
+typedef struct {
+  AddressingMode mode; /**< The addressing mode. */
+  int value;           /**< The number, the register or the address, 0 for
+                          an external symbol. */
+  int index;           /**< The index of an indexed operand. */
+  int word;            /**< The address of the word of the address. */
+  bool is_entry;       /**< Whether the address is relocated as a .entry
+                          label is. */
+} Operand;
+
+/**
+ * @struct Decoded
+ * @brief An instruction decoded from its words.
+ */
+typedef struct {
+  const Layout *layout; /**< The instruction. */
+  int size;             /**< The number of words. */
+  Operand operands[2];  /**< The source and destination operands. */
+} Decoded;
+
+/**
+ * @struct Disassembly
+ * @brief The names of the addresses of an object file.
+ */
+typedef struct {
+  const ObjectFile *object;                       /**< The object file. */
+  const char *file_name;                          /**< The name of the object
+                                                     file. */
+  int code_end;                                   /**< The address after the
+                                                     instructions. */
+  int image_end;                                  /**< The address after the
+                                                     image. */
+  bool is_instruction[MAX_MEMORY_SIZE];           /**< Whether an instruction
+                                                     starts at every
+                                                     address. */
+  bool is_line_start[MAX_MEMORY_SIZE];            /**< Whether a line starts
+                                                     at every address. */
+  bool is_referenced[MAX_MEMORY_SIZE];            /**< Whether an operand
+                                                     names every address. */
+  bool is_entry[MAX_MEMORY_SIZE];                 /**< Whether the label of
+                                                     every address is a .entry
+                                                     label. */
+  int last_plain_use[MAX_MEMORY_SIZE];            /**< The last instruction
+                                                     relocating every address
+                                                     as a label that is not a
+                                                     .entry label yet, or 0. */
+  int first_entry_use[MAX_MEMORY_SIZE];           /**< The first instruction
+                                                     relocating every address
+                                                     as a .entry label, or
+                                                     0. */
+  int declarations[MAX_MEMORY_SIZE + 1];          /**< The first address whose
+                                                     .entry line comes before
+                                                     the line of every
+                                                     address, plus 1, or 0. */
+  int next_declarations[MAX_MEMORY_SIZE];         /**< The next address whose
+                                                     .entry line comes before
+                                                     the same line, plus 1, or
+                                                     0. */
+  const char *labels[MAX_MEMORY_SIZE];            /**< The label of every
+                                                     address, or NULL. */
+  const char *externals[MAX_MEMORY_SIZE];         /**< The external symbol
+                                                     every word uses, or
+                                                     NULL. */
+  int data;                                       /**< The words written as
+                                                     data. */
+  int failures;                                   /**< The words that cannot
+                                                     be written back. */
+  /* The names are only read once made up, so they are not cleared */
+  char names[MAX_MEMORY_SIZE][MAX_LABEL_LENGTH];  /**< The labels made up for
+                                                     the addresses. */
+  char external_names[MAX_MEMORY_SIZE]
+                     [MAX_LABEL_LENGTH];          /**< The names made up for
+                                                     the external symbols. */
+} Disassembly;
+
+/* The instruction of every value of the opcode and mode bits */
+static Layout layouts[LAYOUTS_COUNT];
+
+/* Whether to write the addresses and words of every line */
+static bool is_listing = false;
+
+/* Checks a mode against the modes of the instruction table, none for "" */
+static bool is_mode_allowed(const char *modes, int mode) {
+  if (modes[0] == '\0') {
+    return mode == 0;
+  }
+
+  return strchr(modes, '0' + mode) != NULL;
+}
+
+static void init_layouts(void) {
+  int bits = 0;
+
+  for (bits = 0; bits < LAYOUTS_COUNT; bits++) {
+    const Instruction *entry = &inst_table[bits >> 4];
+    Layout *layout = &layouts[bits];
+
+    layout->modes[0] = (AddressingMode)((bits >> 2) & 3);
+    layout->modes[1] = (AddressingMode)(bits & 3);
+    layout->operands = (entry->source_operand[0] != '\0') +
+                       (entry->destination_operand[0] != '\0');
+    layout->opcode =
+        is_mode_allowed(entry->source_operand, layout->modes[0]) &&
+                is_mode_allowed(entry->destination_operand, layout->modes[1])
+            ? entry->opcode
+            : -1;
+  }
+}
+
+/* Gets the signed value of the 12 bits of an operand word above the A,R,E */
+static int operand_value(int word) {
+  word >>= 2;
+
+  return word & 0x800 ? word - 0x1000 : word;
+}
+
+/* Decodes the words of an operand, returning whether the second pass writes
+   them so */
+static bool decode_operand(const Disassembly *disassembly, int *next,
+                           AddressingMode mode, int reg_offset,
+                           Operand *operand) {
+  const int *words = disassembly->object->words;
+  int word = 0;
+
+  if (*next >= disassembly->code_end) {
+    return false;
+  }
+
+  operand->mode = mode;
+  operand->word = *next;
+  word = words[(*next)++ - IMAGE_START];
+
+  switch (mode) {
+  case MODE_IMMEDIATE:
+    operand->value = operand_value(word);
+    return (word & 3) == 0;
+  case MODE_REGISTER:
+    operand->value = (word >> reg_offset) & 7;
+    return word == operand->value << reg_offset;
+  case MODE_DIRECT:
+    /* A .entry label is relocated with 01, others and externals with 10 */
+    operand->value = word >> 2;
+    operand->is_entry = (word & 3) == 1;
+    return operand->is_entry ? operand->value != 0 : (word & 3) == 2;
+  default:
+    break;
+  }
+
+  operand->value = word >> 2;
+
+  if ((word & 3) != 2 || *next >= disassembly->code_end) {
+    return false;
+  }
+
+  word = words[(*next)++ - IMAGE_START];
+  operand->index = operand_value(word);
+
+  return (word & 3) == 0;
+}
+
+/* Decodes the instruction at an address, returning whether the second pass
+   writes its words so */
+static bool decode(const Disassembly *disassembly, int address,
+                   Decoded *decoded) {
+  int word = disassembly->object->words[address - IMAGE_START];
+  const Layout *layout = &layouts[(word >> LAYOUT_SHIFT) & LAYOUT_MASK];
+  int next = address + 1;
+  bool is_ok = true;
+
+  memset(decoded, 0, sizeof(Decoded));
+  decoded->layout = layout;
+  decoded->size = 1;
+
+  if ((word & 3) != 0 || (word >> 10) != 0 || layout->opcode < 0) {
+    return false;
+  }
+
+  if (layout->operands == 2 && layout->modes[0] == MODE_REGISTER &&
+      layout->modes[1] == MODE_REGISTER) {
+    /* Two registers share a word, the source in bits 5-7 */
+    if (next >= disassembly->code_end) {
+      return false;
+    }
+
+    word = disassembly->object->words[next++ - IMAGE_START];
+    decoded->operands[0].mode = MODE_REGISTER;
+    decoded->operands[0].value = (word >> 5) & 7;
+    decoded->operands[1].mode = MODE_REGISTER;
+    decoded->operands[1].value = (word >> 2) & 7;
+    is_ok = word == (decoded->operands[0].value << 5 |
+                     decoded->operands[1].value << 2);
+  } else if (layout->operands == 2) {
+    is_ok = decode_operand(disassembly, &next, layout->modes[0], 5,
+                           &decoded->operands[0]) &&
+            decode_operand(disassembly, &next, layout->modes[1], 2,
+                           &decoded->operands[1]);
+  } else if (layout->operands == 1) {
+    /* The register of a single operand is in bits 0-2 */
+    is_ok = decode_operand(disassembly, &next, layout->modes[1], 0,
+                           &decoded->operands[1]);
+  }
+
+  if (is_ok) {
+    decoded->size = next - address;
+  }
+
+  return is_ok;
+}
+
+static bool is_name_taken(const ObjectFile *object, const char *name) {
+  const Symbol *symbol = NULL;
+
+  for (symbol = object->entries; symbol; symbol = symbol->next) {
+    if (strcmp(symbol->symbol_name, name) == 0) {
+      return true;
+    }
+  }
+
+  for (symbol = object->externals; symbol; symbol = symbol->next) {
+    if (strcmp(symbol->symbol_name, name) == 0) {
+      return true;
+    }
+  }
+
+  return false;
+}
+
+/* Makes up a name after an address, longer until no symbol has it */
+static void make_name(const ObjectFile *object, char prefix, int address,
+                      char name[MAX_LABEL_LENGTH]) {
+  int length = 1;
+
+  do {
+    memset(name, prefix, length);
+    sprintf(name + length, "%04d", address);
+    length++;
+  } while (is_name_taken(object, name) &&
+           length + 5 < MAX_LABEL_LENGTH);
+}
+
+static void warn_word(Disassembly *disassembly, const char *warning,
+                      int address) {
+  fprintf(stderr, warning, address, disassembly->file_name);
+  disassembly->failures++;
+}
+
+/* Names the external symbols and the .entry labels of the files */
+static void read_names(Disassembly *disassembly) {
+  const Symbol *symbol = NULL;
+
+  for (symbol = disassembly->object->entries; symbol; symbol = symbol->next) {
+    if (symbol->value >= 0 && symbol->value < MAX_MEMORY_SIZE) {
+      disassembly->labels[symbol->value] = symbol->symbol_name;
+      disassembly->is_entry[symbol->value] = true;
+    }
+  }
+
+  for (symbol = disassembly->object->externals; symbol;
+       symbol = symbol->next) {
+    if (symbol->value >= 0 && symbol->value < MAX_MEMORY_SIZE) {
+      disassembly->externals[symbol->value] = symbol->symbol_name;
+    }
+  }
+}
+
+/* Records the addresses an operand of an instruction names, and the external
+   symbol it uses */
+static void reference_operand(Disassembly *disassembly, int address,
+                              const Operand *operand) {
+  int target = operand->value;
+
+  if (operand->mode != MODE_DIRECT && operand->mode != MODE_INDEXED) {
+    return;
+  }
+
+  if (operand->value == 0) {
+    if (disassembly->externals[operand->word] == NULL) {
+      make_name(disassembly->object, 'X', operand->word,
+                disassembly->external_names[operand->word]);
+      disassembly->externals[operand->word] =
+          disassembly->external_names[operand->word];
+    }
+
+    return;
+  }
+
+  disassembly->is_referenced[target] = true;
+
+  /* A label relocated as a .entry label is one, from its .entry line on */
+  if (operand->is_entry) {
+    disassembly->is_entry[target] = true;
+
+    if (disassembly->first_entry_use[target] == 0) {
+      disassembly->first_entry_use[target] = address;
+    }
+  } else if (operand->mode == MODE_DIRECT) {
+    disassembly->last_plain_use[target] = address;
+  }
+}
+
+/* Finds the instructions among the words of the code, which are the lines of
+   the map file whose words make a single instruction when there is one */
+static void find_instructions(Disassembly *disassembly) {
+  const LineTable *lines = &disassembly->object->lines;
+  Decoded decoded;
+  int address = IMAGE_START;
+  int end = 0;
+  int i = 0;
+
+  if (lines->count == 0) {
+    while (address < disassembly->code_end) {
+      disassembly->is_instruction[address] =
+          decode(disassembly, address, &decoded);
+      address += decoded.size;
+    }
+
+    return;
+  }
+
+  for (i = 0; i < lines->count; i++) {
+    address = IMAGE_START + lines->runs[i].address;
+    end = i + 1 < lines->count ? IMAGE_START + lines->runs[i + 1].address
+                               : disassembly->image_end;
+
+    if (address < disassembly->code_end &&
+        decode(disassembly, address, &decoded) &&
+        address + decoded.size == end) {
+      disassembly->is_instruction[address] = true;
+    }
+  }
+}
+
+/* Finds the line the .entry line of an address comes before, after the
+   instructions relocating it as a label that is not a .entry label yet */
+static void place_entry(Disassembly *disassembly, int target) {
+  int plain = disassembly->last_plain_use[target];
+  int entry = disassembly->first_entry_use[target];
+  int line = 0;
+
+  if (plain > 0 && entry == 0) {
+    line = disassembly->image_end;
+  } else if (plain > 0 && plain < entry) {
+    line = entry;
+  } else if (plain > 0) {
+    warn_word(disassembly, WARN_WORD_NOT_WRITTEN_BACK, plain);
+  }
+
+  disassembly->next_declarations[target] = disassembly->declarations[line];
+  disassembly->declarations[line] = target + 1;
+}
+
+/* Finds where the lines start and names every address an operand names */
+static void find_labels(Disassembly *disassembly) {
+  Decoded decoded;
+  int address = IMAGE_START;
+
+  find_instructions(disassembly);
+
+  while (address < disassembly->image_end) {
+    disassembly->is_line_start[address] = true;
+
+    if (disassembly->is_instruction[address]) {
+      decode(disassembly, address, &decoded);
+      reference_operand(disassembly, address, &decoded.operands[0]);
+      reference_operand(disassembly, address, &decoded.operands[1]);
+      address += decoded.size;
+    } else {
+      address++;
+    }
+  }
+
+  for (address = 0; address < MAX_MEMORY_SIZE; address++) {
+    if ((disassembly->is_referenced[address] ||
+         disassembly->is_entry[address]) &&
+        disassembly->labels[address] == NULL) {
+      make_name(disassembly->object, 'L', address,
+                disassembly->names[address]);
+      disassembly->labels[address] = disassembly->names[address];
+    }
+
+    if (disassembly->labels[address] &&
+        !disassembly->is_line_start[address]) {
+      warn_word(disassembly, WARN_LABEL_INSIDE_LINE, address);
+    }
+
+    if (disassembly->is_entry[address]) {
+      place_entry(disassembly, address);
+    }
+  }
+}
+
+/* Prints the .entry lines that come before the line of an address */
+static void print_entries(const Disassembly *disassembly, int line) {
+  int target = disassembly->declarations[line];
+
+  for (; target > 0; target = disassembly->next_declarations[target - 1]) {
+    printf(".entry %s\n", disassembly->labels[target - 1]);
+  }
+}
+
+static void print_declarations(const Disassembly *disassembly) {
+  int address = 0;
+  int other = 0;
+
+  print_entries(disassembly, 0);
+
+  /* Every external symbol is declared once, where it is first used */
+  for (address = 0; address < MAX_MEMORY_SIZE; address++) {
+    const char *name = disassembly->externals[address];
+
+    for (other = 0; name && other < address; other++) {
+      if (disassembly->externals[other] &&
+          strcmp(disassembly->externals[other], name) == 0) {
+        name = NULL;
+      }
+    }
+
+    if (name) {
+      printf(".extern %s\n", name);
+    }
+  }
+}
+
+/* Prints the address and the words of a line of the listing */
+static void print_words(const Disassembly *disassembly, int address,
+                        int count) {
+  char encoded[ENCRYPTED_WORD_LENGTH + 1];
+  int width = 0;
+  int i = 0;
+
+  printf("%04d  ", address);
+
+  for (i = 0; i < count; i++) {
+    to_base4_encrypted(disassembly->object->words[address - IMAGE_START + i],
+                       encoded);
+    width += printf("%s ", encoded);
+  }
+
+  printf("%*s", width < WORDS_COLUMN ? WORDS_COLUMN - width : 0, "");
+}
+
+static void print_label(const Disassembly *disassembly, int address) {
+  const char *label = disassembly->labels[address];
+
+  if (label == NULL) {
+    printf("%*s", LABEL_COLUMN, "");
+  } else if ((int)strlen(label) + 2 <= LABEL_COLUMN) {
+    printf("%s:%*s", label, LABEL_COLUMN - (int)strlen(label) - 1, "");
+  } else {
+    printf("%s: ", label);
+  }
+}
+
+static void print_operand(const Disassembly *disassembly,
+                          const Operand *operand) {
+  switch (operand->mode) {
+  case MODE_IMMEDIATE:
+    printf("#%d", operand->value);
+    return;
+  case MODE_REGISTER:
+    printf("r%d", operand->value);
+    return;
+  default:
+    break;
+  }
+
+  if (operand->value == 0) {
+    printf("%s", disassembly->externals[operand->word]);
+  } else {
+    printf("%s", disassembly->labels[operand->value]);
+  }
+
+  if (operand->mode == MODE_INDEXED) {
+    printf("[%d]", operand->index);
+  }
+}
+
+/* Prints the instruction at an address, returning its size */
+static int print_instruction(const Disassembly *disassembly, int address) {
+  Decoded decoded;
+
+  decode(disassembly, address, &decoded);
+
+  if (is_listing) {
+    print_words(disassembly, address, decoded.size);
+  }
+
+  print_label(disassembly, address);
+  printf("%s", inst_table[decoded.layout->opcode].name);
+
+  if (decoded.layout->operands == 2) {
+    printf(" ");
+    print_operand(disassembly, &decoded.operands[0]);
+    printf(",");
+  }
+
+  if (decoded.layout->operands > 0) {
+    printf(" ");
+    print_operand(disassembly, &decoded.operands[1]);
+  }
+
+  printf("\n");
+
+  return decoded.size;
+}
+
+/* Prints the data words from an address, up to the next label or instruction,
+   returning how many */
+static int print_data(Disassembly *disassembly, int address) {
+  int limit = is_listing ? 1 : DATA_PER_LINE;
+  int count = 0;
+
+  if (is_listing) {
+    print_words(disassembly, address, 1);
+  }
+
+  print_label(disassembly, address);
+  printf(".data ");
+
+  do {
+    printf(count > 0 ? ", %d" : "%d",
+           word_value(disassembly->object->words[address + count -
+                                                 IMAGE_START]));
+    count++;
+  } while (count < limit && address + count < disassembly->image_end &&
+           disassembly->labels[address + count] == NULL &&
+           !disassembly->is_instruction[address + count]);
+
+  printf("\n");
+  disassembly->data += count;
+
+  return count;
+}
+
+/* Disassembles the object file of a file, returning whether all of its words
+   were written back */
+static bool disassemble_file(Disassembly *disassembly, const char *base_name) {
+  char *ob_file_name = STR_CAT_WITH_MALLOC(base_name, ".ob");
+  ObjectFile object;
+  int address = IMAGE_START;
+  bool is_read = false;
+  bool is_ok = false;
+
+  init_object_file(&object);
+  is_read = read_object_file(&object, base_name);
+
+  /* The tables of the disassembly span the memory, as the machine's do */
+  if (is_read && object.words_count >= MAX_MEMORY_SIZE - IMAGE_START) {
+    fprintf(stderr, ERROR_IMAGE_TOO_LARGE, ob_file_name, MAX_MEMORY_SIZE);
+  } else if (is_read) {
+    memset(disassembly, 0, offsetof(Disassembly, names));
+    disassembly->object = &object;
+    disassembly->file_name = ob_file_name;
+    disassembly->image_end = IMAGE_START + object.words_count;
+    disassembly->code_end =
+        IMAGE_START + (object.instructions < object.words_count
+                           ? object.instructions
+                           : object.words_count);
+
+    read_names(disassembly);
+    find_labels(disassembly);
+
+    printf("; Disassembly of '%s': %d words, %d of them data.\n",
+           ob_file_name, object.words_count, object.data);
+    print_declarations(disassembly);
+
+    while (address < disassembly->image_end) {
+      print_entries(disassembly, address);
+      address += disassembly->is_instruction[address]
+                     ? print_instruction(disassembly, address)
+                     : print_data(disassembly, address);
+    }
+
+    print_entries(disassembly, address);
+
+    if (disassembly->data != object.data) {
+      fprintf(stderr, WARN_DATA_COUNT, disassembly->data, object.data,
+              ob_file_name);
+      disassembly->failures++;
+    }
+
+    is_ok = disassembly->failures == 0;
+  }
+
+  free_object_file(&object);
+  free(ob_file_name);
+
+  return is_ok;
+}
+
+static void usage(void) {
+  fprintf(stderr, "usage: disassembler [-a] file...\n");
+  exit(EXIT_FAILURE);
+}
+
+int main(int argc, char **argv) {
+  Disassembly *disassembly = NULL;
+  int failures = 0;
+  int i = 1;
+
+  for (; i < argc && argv[i][0] == '-'; i++) {
+    if (strcmp(argv[i], "-a") == 0) {
+      is_listing = true;
+    } else {
+      usage();
+    }
+  }
+
+  if (i >= argc) {
+    usage();
+  }
+
+  /* A single disassembly is cleared for every file, rather than allocated */
+  disassembly = (Disassembly *)allocate(sizeof(Disassembly));
+  init_layouts();
+
+  for (; i < argc; i++) {
+    if (!disassemble_file(disassembly, argv[i])) {
+      failures++;
+    }
+  }
+
+  free(disassembly);
+
+  return failures > 0 ? EXIT_FAILURE : EXIT_SUCCESS;
+}
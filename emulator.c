@@ -0,0 +1,390 @@
+/**
+ * @file emulator.c
+ * @brief Runs the programs the assembler writes.
+ *
+ * Every file is named as the assembler writes it, without its extension, so
+ * that the entry file and the map file next to the object file are read with
+ * it. Its image is loaded into a machine of its own and run until it ends, the
+ * red and prn instructions reading the standard input and writing the standard
+ * output.
+ *
+ * With -p the execution is profiled, and the report is written to a .prof
+ * file next to the object file: the executions of every opcode, address and
+ * line, the branches taken by every bne and the calls to every address, each
+ * from the hottest. The addresses are named by the .entry labels, and by the
+ * lines of the assembly file when it was assembled with -g.
+ *
+ * With -s the cycles of the execution under the cost model, the words fetched,
+ * the memory reads and writes, the branches and the calls are printed on
+ * stderr once it ends, and with -c the costs of the model are read from a cost
+ * file first.
+ *
+ * With -t every executed instruction is recorded in a .trace file next to the
+ * object file, which trace_reader prints.
+ *
+ * With -v the instructions executed and the ways every bne went are recorded
+ * in a .cov file next to the object file, which coverage_report merges with
+ * the coverage files of other runs and reports.
+ *
+ * With -r the program is run once for every line of an input file, the line
+ * being what red reads. The program is run until the first red, or until the
+ * address given with -a, and every run goes on from a snapshot of the machine
+ * taken there, so the steps before it, which read the standard input, run
+ * once. The runs per second are printed on stderr once they end, and with -l
+ * every run loads the program and runs the steps before the snapshot again
+ * instead, for a comparison. With -v the coverage file covers all the trials
+ * and the steps before the snapshot.
+ *
+ * Usage:
+ *   emulator [-p] [-s] [-t] [-v] [-c costs] [-n steps] file...
+ *   emulator -r inputs [-a address] [-l] [-v] [-n steps] file...
+ */
+
+#define _POSIX_C_SOURCE 200809L
+#include "cost_model.h"
+#include "coverage.h"
+#include "errors.h"
+#include "machine.h"
+#include "object_file.h"
+#include "profiler.h"
+#include "source.h"
+#include "trace.h"
+#include "utils.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+/* The characters of a line of the inputs of the trials */
+#define TRIAL_INPUT_LENGTH 1024
+
+/* Whether to profile the executions */
+static bool is_profiling = false;
+
+/* Whether to count the cycles and accesses of the executions */
+static bool is_counting = false;
+
+/* Whether to write the traces of the executions */
+static bool is_tracing = false;
+
+/* Whether to record the coverage of the executions */
+static bool is_covering = false;
+
+/* The costs the cycles are counted with */
+static CostModel cost_model;
+
+/* The number of instructions to execute at most per file */
+static unsigned long step_limit = MACHINE_STEP_LIMIT;
+
+/* The file of the inputs of the trials, one per line, or NULL */
+static const char *inputs_file_name = NULL;
+
+/* The address the trials start from */
+static int trial_address = MACHINE_FIRST_INPUT;
+
+/* Whether every trial runs the program from its start */
+static bool is_reloading = false;
+
+/* Writes the profile of an execution to the .prof file */
+static bool write_profile(const Profile *profile, const Machine *machine,
+                          const ObjectFile *object, const char *base_name,
+                          const char *ob_file_name, double seconds) {
+  char *file_name = STR_CAT_WITH_MALLOC(base_name, ".prof");
+  FILE *out = fopen(file_name, "w");
+  SourceFile source;
+  bool has_source = false;
+
+  if (out == NULL) {
+    fprintf(stderr, ERROR_CANNOT_WRITE, file_name);
+    free(file_name);
+    return false;
+  }
+
+  /* The lines are shown when the assembly file is where it was assembled */
+  if (object->source_file_name) {
+    has_source = load_source(&source, object->source_file_name);
+  }
+
+  print_profile(profile, machine, object, has_source ? &source : NULL,
+                ob_file_name, seconds, out);
+  fclose(out);
+
+  if (has_source) {
+    free_source(&source);
+  }
+
+  free(file_name);
+
+  return true;
+}
+
+/* Writes the coverage of the executions of a program to the .cov file */
+static bool write_coverage_file(const Coverage *coverage,
+                                const char *base_name) {
+  char *file_name = STR_CAT_WITH_MALLOC(base_name, ".cov");
+  bool is_written = write_coverage(coverage, file_name);
+
+  if (is_written) {
+    printf("Coverage file created.\n");
+  }
+
+  free(file_name);
+
+  return is_written;
+}
+
+/* Runs the program of a file, returning whether it ended without an error */
+static bool run_file(const char *base_name) {
+  char *ob_file_name = STR_CAT_WITH_MALLOC(base_name, ".ob");
+  Machine *machine = (Machine *)allocate(sizeof(Machine));
+  Profile *profile = NULL;
+  ExecutionStats stats;
+  char *trace_file_name = NULL;
+  Tracer *tracer = NULL;
+  Coverage *coverage = NULL;
+  unsigned long records = 0;
+  unsigned long bytes = 0;
+  ObjectFile object;
+  double start = 0;
+  double seconds = 0;
+  bool is_ok = false;
+
+  init_object_file(&object);
+
+  if (read_object_file(&object, base_name) &&
+      load_machine(machine, &object, ob_file_name)) {
+    machine->step_limit = step_limit;
+
+    if (is_profiling) {
+      profile = (Profile *)allocate(sizeof(Profile));
+      init_profile(profile);
+      machine->profile = profile;
+    }
+
+    if (is_counting) {
+      init_execution_stats(&stats, &cost_model);
+      machine->stats = &stats;
+    }
+
+    if (is_tracing) {
+      trace_file_name = STR_CAT_WITH_MALLOC(base_name, ".trace");
+      tracer = open_tracer(trace_file_name);
+      machine->tracer = tracer;
+    }
+
+    if (is_covering) {
+      coverage = (Coverage *)allocate(sizeof(Coverage));
+      init_coverage(coverage, &object);
+      coverage->runs = 1;
+      machine->coverage = coverage;
+    }
+
+    start = now_seconds();
+    is_ok = run_machine(machine) == MACHINE_HALTED;
+    seconds = now_seconds() - start;
+
+    if (tracer && close_tracer(tracer, &records, &bytes)) {
+      printf("Trace file created: %lu records in %lu bytes.\n", records,
+             bytes);
+    } else if (tracer) {
+      fprintf(stderr, ERROR_CANNOT_WRITE, trace_file_name);
+      is_ok = false;
+    }
+
+    fflush(machine->output);
+    print_machine_status(machine, ob_file_name, stderr);
+
+    if (is_counting) {
+      print_execution_stats(&stats, machine->steps, ob_file_name, stderr);
+    }
+
+    if (profile && write_profile(profile, machine, &object, base_name,
+                                 ob_file_name, seconds)) {
+      printf("Profile file created.\n");
+    }
+
+    if (coverage && !write_coverage_file(coverage, base_name)) {
+      is_ok = false;
+    }
+  }
+
+  free_object_file(&object);
+  free(profile);
+  free(coverage);
+  free(trace_file_name);
+  free(machine);
+  free(ob_file_name);
+
+  return is_ok;
+}
+
+/* Runs the program of an object file from its start to the trials */
+static bool run_to_trials(Machine *machine, const ObjectFile *object,
+                          const char *ob_file_name, Coverage *coverage) {
+  if (!load_machine(machine, object, ob_file_name)) {
+    return false;
+  }
+
+  machine->step_limit = step_limit;
+  machine->coverage = coverage;
+
+  if (run_machine_to(machine, trial_address) == MACHINE_RUNNING) {
+    return true;
+  }
+
+  fflush(machine->output);
+
+  if (machine->status == MACHINE_HALTED) {
+    fprintf(stderr, ERROR_TRIAL_POINT_NOT_REACHED, ob_file_name);
+  } else {
+    print_machine_status(machine, ob_file_name, stderr);
+  }
+
+  return false;
+}
+
+/* Runs the program of a file once per input, from the snapshot */
+static bool run_trials(const char *base_name) {
+  char *ob_file_name = STR_CAT_WITH_MALLOC(base_name, ".ob");
+  Machine *machine = (Machine *)allocate(sizeof(Machine));
+  MachineSnapshot *snapshot =
+      (MachineSnapshot *)allocate(sizeof(MachineSnapshot));
+  Coverage *coverage = NULL;
+  FILE *inputs = NULL;
+  ObjectFile object;
+  char line[TRIAL_INPUT_LENGTH + 2];
+  unsigned long trials = 0;
+  unsigned long stopped = 0;
+  unsigned long setup_steps = 0;
+  unsigned long trial_steps = 0;
+  double start = 0;
+  double seconds = 0;
+  bool is_read = false;
+  bool is_ok = false;
+
+  init_object_file(&object);
+
+  is_read = read_object_file(&object, base_name);
+
+  if (is_read && is_covering) {
+    coverage = (Coverage *)allocate(sizeof(Coverage));
+    init_coverage(coverage, &object);
+  }
+
+  if (!is_read || !run_to_trials(machine, &object, ob_file_name, coverage)) {
+    free_object_file(&object);
+    free(coverage);
+    free(snapshot);
+    free(machine);
+    free(ob_file_name);
+    return false;
+  }
+
+  if ((inputs = fopen(inputs_file_name, "r")) == NULL) {
+    fprintf(stderr, ERROR_CANNOT_READ, inputs_file_name);
+  } else {
+    snapshot_machine(machine, snapshot);
+    setup_steps = machine->steps;
+    is_ok = true;
+    start = now_seconds();
+
+    while (fgets(line, sizeof(line), inputs)) {
+      if (!is_reloading) {
+        restore_machine(machine, snapshot);
+      } else if (!run_to_trials(machine, &object, ob_file_name, coverage)) {
+        is_ok = false;
+        break;
+      }
+
+      machine->input = fmemopen(line, strcspn(line, "\r\n"), "r");
+
+      if (machine->input == NULL) {
+        fprintf(stderr, ERROR_OUT_OF_MEMORY);
+        exit(EXIT_FAILURE);
+      }
+
+      stopped += run_machine(machine) != MACHINE_HALTED;
+      trial_steps += machine->steps - setup_steps;
+      trials++;
+      fclose(machine->input);
+    }
+
+    seconds = now_seconds() - start;
+    fflush(machine->output);
+    fclose(inputs);
+    fprintf(stderr,
+            "Trials of '%s': %lu trials in %.6f seconds, %.0f trials per "
+            "second, %.1f instructions per trial after %lu before the "
+            "snapshot, %lu stopped on an error.\n",
+            ob_file_name, trials, seconds, seconds > 0 ? trials / seconds : 0,
+            trials > 0 ? (double)trial_steps / trials : 0, setup_steps,
+            stopped);
+
+    if (coverage) {
+      coverage->runs = trials;
+      is_ok = write_coverage_file(coverage, base_name) && is_ok;
+    }
+  }
+
+  free_object_file(&object);
+  free(coverage);
+  free(snapshot);
+  free(machine);
+  free(ob_file_name);
+
+  return is_ok && stopped == 0;
+}
+
+static void usage(void) {
+  fprintf(stderr,
+          "usage: emulator [-p] [-s] [-t] [-v] [-c costs] [-n steps] file...\n"
+          "       emulator -r inputs [-a address] [-l] [-v] [-n steps] "
+          "file...\n");
+  exit(EXIT_FAILURE);
+}
+
+int main(int argc, char **argv) {
+  int failures = 0;
+  int i = 1;
+
+  init_cost_model(&cost_model);
+
+  for (; i < argc && argv[i][0] == '-'; i++) {
+    if (strcmp(argv[i], "-p") == 0) {
+      is_profiling = true;
+    } else if (strcmp(argv[i], "-s") == 0) {
+      is_counting = true;
+    } else if (strcmp(argv[i], "-t") == 0) {
+      is_tracing = true;
+    } else if (strcmp(argv[i], "-v") == 0) {
+      is_covering = true;
+    } else if (i + 1 < argc && strcmp(argv[i], "-c") == 0) {
+      if (!read_cost_model(&cost_model, argv[++i])) {
+        return EXIT_FAILURE;
+      }
+
+      is_counting = true;
+    } else if (i + 1 < argc && strcmp(argv[i], "-n") == 0) {
+      step_limit = strtoul(argv[++i], NULL, 10);
+    } else if (i + 1 < argc && strcmp(argv[i], "-r") == 0) {
+      inputs_file_name = argv[++i];
+    } else if (i + 1 < argc && strcmp(argv[i], "-a") == 0) {
+      trial_address = atoi(argv[++i]);
+    } else if (strcmp(argv[i], "-l") == 0) {
+      is_reloading = true;
+    } else {
+      usage();
+    }
+  }
+
+  if (i >= argc) {
+    usage();
+  }
+
+  for (; i < argc; i++) {
+    if (inputs_file_name ? !run_trials(argv[i]) : !run_file(argv[i])) {
+      failures++;
+    }
+  }
+
+  return failures > 0 ? EXIT_FAILURE : EXIT_SUCCESS;
+}
@@ -8,6 +8,7 @@
 
 /* Syntax errors */
 #define ERROR_MACRO_NAME "ERROR: Macro name '%s' cannot be a keyword on line '%d' in file '%s'\n\n"
+#define ERROR_MISSING_MACRO_NAME "ERROR: Missing macro name on line '%d' in file '%s'\n\n"
 #define ERROR_UNEXPECTED_COMMA_AFTER_KEYWORD "ERROR: Unexpected comma after keyword '%s' on line '%d' in file '%s'\n\n"
 #define ERROR_LABEL_NAME_TOO_LONG "ERROR: Label '%s' is longer than '%d' characters on line '%d' in file '%s'\n\n"
 #define ERROR_LABEL_CANNOT_START_WITH_NUM "ERROR: Label name can't start with number on line '%d' in file '%s'\n\n"
@@ -20,13 +21,15 @@
 #define ERROR_EXTRA_COMMA_AFTER_NUMBER "ERROR: Extra comma after a number '%s' on line %d in file '%s'\n\n"
 #define ERROR_MISSING_COMMA_BETWEEN_NUMBERS "ERROR: Missing comma between numbers '%s' and '%s' on line '%d' in file '%s\n\n"
 #define ERROR_UNEXPECTED_COMMA_AFTER_DIRECTIVE "ERROR: Unexpected comma at the end of the directive definition on line '%d' in file '%s'\n\n"
-#define ERROR_INVALID_DEFINE_DEFINITION "ERROR: Invalid define definition: '%S' on line '%d' in file '%s'\n\n"
+#define ERROR_INVALID_DEFINE_DEFINITION "ERROR: Invalid define definition: '%s' on line '%d' in file '%s'\n\n"
 #define ERROR_EXPECTED_NUMBER_AFTER_EQUAL_SIGN "ERROR: Expected a number after the '='"
+#define ERROR_EXPECTED_EXPRESSION_AFTER_EQUAL_SIGN "ERROR: Expected a constant expression after the '='"
 #define ERROR_EXPECTED_EQUAL_SIGN_AFTER_DEFINE_NAME "ERROR: Expected an '=' after the define name"
 #define ERROR_EXPECTED_NAME_AFTER_DEFINE "ERROR: Expected a name after .define keyword"
 #define ERROR_INVALID_STRING_DEFINITION "ERROR: Invalid string definition: '%s' on line '%d' in file '%s'\n\n"
 #define ERROR_EXPECTED_STRING_QUOTES "ERROR: Expected a string enclosed in quotes"
 #define ERROR_EXPECTED_NAME_AFTER_STRING "ERROR: Expected a name after the .string keyword"
+#define ERROR_INVALID_STRING_ESCAPE "ERROR: Expected an escape of \\n, \\t, \\r, \\\\ or \\\" in the string"
 #define ERROR_INVALID_INSTRUCTION "ERROR: Invalid instruction '%s' on line '%d' in file '%s'\n\n"
 #define ERROR_UNEXPECTED_COMMA_AFTER_INSTRUCTION "ERROR: Unexpected comma at the end of the '%s' definition on line '%d' in file '%s'\n\n"
 #define ERROR_EXPECTED_COMMA_AFTER_OPERAND "ERROR: The instruction '%s' expects a comma after the '%s' operand on line '%d' in file '%s'\n\n"
@@ -40,17 +43,47 @@
 #define ERROR_INVALID_DATA_ELEMENT "ERROR: Invalid data element '%s' on line '%d' in file '%s'\n\n"
 #define ERROR_INVALID_DATA_ELEMENT_TYPE "ERROR: Invalid data element type '%s' on line '%d' in file '%s'\n\n"
 #define ERROR_UNDEFIND_DATA_SYMBOL_ELEMENT "ERROR: Undefind data symbol element '%s' on line '%d' in file '%s'\n\n"
+#define ERROR_INVALID_BLOCK_DIRECTIVE "ERROR: Invalid directive '%s', expected '%s' on line '%d' in file '%s'\n\n"
+#define ERROR_INVALID_BLOCK_SIZE "ERROR: Invalid block size '%s', a block takes at least one word and at most the '%d' words an image can hold, on line '%d' in file '%s'\n\n"
+#define ERROR_UNDEFINED_CONSTANT "ERROR: The name '%s' in the expression '%s' is not a previously defined constant on line '%d' in file '%s'\n\n"
+#define ERROR_DIVISION_BY_ZERO "ERROR: Division by zero in the expression '%s' on line '%d' in file '%s'\n\n"
+#define ERROR_EXPRESSION_OUT_OF_RANGE "ERROR: Invalid expression '%s', a value is beyond '%d' on line '%d' in file '%s'\n\n"
+#define USAGE_DATA ".data <value>, <value>..."
+#define USAGE_FILL ".fill <count>, <value>"
+#define USAGE_SPACE ".space <count>"
 
 /* Files */
 #define ERROR_MISSING_FILE_NAME "ERROR: Missing the file name\n\n"
+#define ERROR_INVALID_THREADS_COUNT "ERROR: Invalid number of threads '%s', usage: -j <threads>, a positive number\n\n"
+#define ERROR_INVALID_IO_BACKEND "ERROR: Invalid I/O backend '%s', usage: -i <uring|threads>\n\n"
 #define ERROR_CANNOT_READ "ERROR: Cannot read the file: '%s'\n\n"
 #define ERROR_CANNOT_WRITE "ERROR: Cannot write the file: '%s'\n\n"
+#define ERROR_CANNOT_WATCH "ERROR: Cannot watch the files for changes\n\n"
 #define ERROR_LINE_TOO_LONG "WARN: Line number '%d' longer than the max allowed '%d'\n\n"
+#define ERROR_INVALID_OBJECT_FILE "ERROR: Invalid object file '%s' on line '%d'\n\n"
+
+/* Execution */
+#define ERROR_IMAGE_TOO_LARGE "ERROR: The image of '%s' does not fit in the '%d' words of memory\n\n"
+#define ERROR_EXECUTED_INVALID_INSTRUCTION "ERROR: Invalid instruction at address '%04d' in file '%s'\n\n"
+#define ERROR_EXECUTED_OUTSIDE_IMAGE "ERROR: Jumped to address '%04d' outside of the image in file '%s'\n\n"
+#define ERROR_EXECUTED_INVALID_ADDRESS "ERROR: The instruction at address '%04d' names an address outside of the memory in file '%s'\n\n"
+#define ERROR_EXECUTED_EXTERNAL "ERROR: The instruction at address '%04d' uses an external symbol, which is not linked, in file '%s'\n\n"
+#define ERROR_EXECUTED_STACK_OVERFLOW "ERROR: The call at address '%04d' overflows the stack of '%d' calls in file '%s'\n\n"
+#define ERROR_INVALID_COST "ERROR: Invalid cost '%s' on line '%d' in file '%s', expected an opcode or an addressing mode and its cycles\n\n"
+#define ERROR_TRIAL_POINT_NOT_REACHED "ERROR: The program of '%s' ended before the point the trials start from\n\n"
+#define ERROR_INVALID_TRACE_FILE "ERROR: Invalid trace file '%s' after '%lu' records\n\n"
+#define ERROR_INVALID_COVERAGE_FILE "ERROR: Invalid coverage file '%s'\n\n"
+#define ERROR_COVERAGE_OF_OTHER_IMAGE "ERROR: The coverage file '%s' covers another image than the object file\n\n"
+#define WARN_WORD_NOT_WRITTEN_BACK "WARN: The word at address '%04d' is not written back as the assembler wrote it in file '%s'\n\n"
+#define WARN_LABEL_INSIDE_LINE "WARN: The label of address '%04d' is not at the start of a line in file '%s'\n\n"
+#define WARN_DATA_COUNT "WARN: The disassembly has '%d' data words where the header counts '%d' in file '%s'\n\n"
+#define WARN_EXECUTION_STOPPED "WARN: Stopped at address '%04d' after '%lu' instructions in file '%s'\n\n"
 
 /* General errors */
 #define ERROR_UNDEFIND_SYMBOL "ERROR: Symbol '%s' declared but was never defined: on line '%d' in file '%s'\n\n"
 #define ERROR_REDEFINITION_OF_SYMBOL "ERROR: Redefinition of symbol '%s' on line '%d' in file '%s'\n\n"
 #define ERROR_OUT_OF_MEMORY "FATAL: MEMORY ALLOCATION FAILED\n\n"
 #define ERROR_MEMORY_OVERFLOW "ERROR: Memory overflow: too many lines in file '%s', max is '%d'\n\n"
+#define ERROR_IMAGE_OVERFLOW "ERROR: Memory overflow: too many words in file '%s', max is '%d'\n\n"
 
 #endif
\ No newline at end of file
@@ -0,0 +1,208 @@
+#include "expression.h"
+#include "utils.h"
+#include <ctype.h>
+#include <stdlib.h>
+#include <string.h>
+
+/**
+ * @struct ExpressionParser
+ * @brief The state of the evaluation of an expression.
+ */
+typedef struct {
+  const char *next;         /**< The next character to read. */
+  ConstantResolver resolve; /**< The resolver of the names, or NULL. */
+  void *context;            /**< The context of the resolver. */
+  char *name;               /**< Where to store the first unresolved name. */
+  int unresolved;           /**< The number of names not resolved. */
+  bool is_invalid;          /**< Whether the text is not an expression. */
+  bool divides_by_zero;     /**< Whether a known divisor is zero. */
+  bool is_out_of_range;     /**< Whether a value is too large to fold. */
+} ExpressionParser;
+
+static long parse_sum(ExpressionParser *parser);
+
+/* Keeps every value in range, so that no operation on two of them overflows */
+static long check_range(ExpressionParser *parser, long value) {
+  if (value > MAX_EXPRESSION_VALUE || value < -MAX_EXPRESSION_VALUE) {
+    parser->is_out_of_range = true;
+    return 0;
+  }
+
+  return value;
+}
+
+static void skip_spaces(ExpressionParser *parser) {
+  while (*parser->next == ' ' || *parser->next == '\t') {
+    parser->next++;
+  }
+}
+
+/* A name, resolved to its value or counted as unresolved with the value 0 */
+static long parse_name(ExpressionParser *parser) {
+  char name[MAX_LABEL_LENGTH];
+  int length = 0;
+  int value = 0;
+
+  while (isalnum((unsigned char)parser->next[length])) {
+    length++;
+  }
+
+  if (length >= MAX_LABEL_LENGTH) {
+    parser->is_invalid = true;
+    return 0;
+  }
+
+  memcpy(name, parser->next, length);
+  name[length] = '\0';
+  parser->next += length;
+
+  if (parser->resolve && parser->resolve(name, &value, parser->context)) {
+    return check_range(parser, value);
+  }
+
+  if (parser->unresolved++ == 0 && parser->name) {
+    strcpy(parser->name, name);
+  }
+
+  return 0;
+}
+
+/* A number, a name, a signed operand or a sum in parentheses */
+static long parse_operand(ExpressionParser *parser) {
+  long value = 0;
+  int digits = 0;
+
+  skip_spaces(parser);
+
+  if (*parser->next == '+' || *parser->next == '-') {
+    bool is_negative = *parser->next++ == '-';
+
+    value = parse_operand(parser);
+
+    return is_negative ? -value : value;
+  }
+
+  if (*parser->next == '(') {
+    parser->next++;
+    value = parse_sum(parser);
+    skip_spaces(parser);
+
+    if (*parser->next != ')') {
+      parser->is_invalid = true;
+      return 0;
+    }
+
+    parser->next++;
+
+    return value;
+  }
+
+  if (isalpha((unsigned char)*parser->next)) {
+    return parse_name(parser);
+  }
+
+  while (isdigit((unsigned char)*parser->next)) {
+    value = 10 * value + (*parser->next++ - '0');
+    digits++;
+  }
+
+  if (digits == 0 || digits > MAX_NUMBER_DIGITS) {
+    parser->is_invalid = true;
+  }
+
+  return value;
+}
+
+static long parse_product(ExpressionParser *parser) {
+  long value = parse_operand(parser);
+
+  skip_spaces(parser);
+
+  while (!parser->is_invalid &&
+         (*parser->next == '*' || *parser->next == '/')) {
+    bool is_division = *parser->next++ == '/';
+    int unresolved = parser->unresolved;
+    long operand = parse_operand(parser);
+
+    if (!is_division) {
+      /* The product is checked before it is computed */
+      if (operand != 0 && labs(value) > MAX_EXPRESSION_VALUE / labs(operand)) {
+        parser->is_out_of_range = true;
+        value = 0;
+      } else {
+        value *= operand;
+      }
+    } else if (operand != 0) {
+      value /= operand;
+    } else if (parser->unresolved == unresolved) {
+      /* An unresolved divisor is not known to be zero */
+      parser->divides_by_zero = true;
+    }
+
+    skip_spaces(parser);
+  }
+
+  return value;
+}
+
+static long parse_sum(ExpressionParser *parser) {
+  long value = parse_product(parser);
+
+  while (!parser->is_invalid &&
+         (*parser->next == '+' || *parser->next == '-')) {
+    bool is_subtraction = *parser->next++ == '-';
+    long operand = parse_product(parser);
+
+    value = check_range(parser, is_subtraction ? value - operand
+                                               : value + operand);
+  }
+
+  return value;
+}
+
+ExpressionStatus evaluate_expression(const char *text, ConstantResolver resolve,
+                                     void *context, int *value,
+                                     char name[MAX_LABEL_LENGTH]) {
+  ExpressionParser parser;
+  long result = 0;
+
+  parser.next = text;
+  parser.resolve = resolve;
+  parser.context = context;
+  parser.name = name;
+  parser.unresolved = 0;
+  parser.is_invalid = false;
+  parser.divides_by_zero = false;
+  parser.is_out_of_range = false;
+
+  result = parse_sum(&parser);
+  skip_spaces(&parser);
+
+  if (parser.is_invalid || *parser.next != '\0') {
+    return EXPRESSION_INVALID;
+  }
+
+  if (parser.unresolved > 0) {
+    return EXPRESSION_UNRESOLVED;
+  }
+
+  if (parser.divides_by_zero) {
+    return EXPRESSION_DIVISION_BY_ZERO;
+  }
+
+  if (parser.is_out_of_range) {
+    return EXPRESSION_OUT_OF_RANGE;
+  }
+
+  *value = (int)result;
+
+  return EXPRESSION_FOLDED;
+}
+
+bool is_expression(const char *text) {
+  int value = 0;
+
+  return strpbrk(text, "+-*/()") != NULL && !is_integer(text) &&
+         evaluate_expression(text, NULL, NULL, &value, NULL) !=
+             EXPRESSION_INVALID;
+}
@@ -0,0 +1,82 @@
+#ifndef __EXPRESSION__H__
+#define __EXPRESSION__H__
+
+/**
+ * @file expression.h
+ * @brief This file contains the definition of the constant expressions and
+ * the functions evaluating them.
+ *
+ * A constant expression combines numbers and the names of defines with the
+ * '+', '-', '*' and '/' operators and parentheses, the division truncating
+ * the quotient. It can be the value of a .define, an immediate, an index or a
+ * data element. An expression of numbers only is folded as soon as it is
+ * parsed; one naming defines is folded by the first pass, which only accepts
+ * the defines of the lines before it. Every value the expression goes
+ * through must be of at most MAX_NUMBER_DIGITS digits, as its numbers are.
+ */
+
+#include "consts.h"
+#include <stdbool.h>
+
+/* The digits of a number, so that it fits a long before it is folded */
+#define MAX_NUMBER_DIGITS 9
+/* The largest value of a number and of every step of an expression */
+#define MAX_EXPRESSION_VALUE 999999999L
+
+/**
+ * @brief The results of evaluating a constant expression.
+ */
+typedef enum {
+  EXPRESSION_FOLDED,          /**< The value of the expression is known. */
+  EXPRESSION_INVALID,         /**< The text is not an expression. */
+  EXPRESSION_UNRESOLVED,      /**< A name of the expression is unknown. */
+  EXPRESSION_DIVISION_BY_ZERO, /**< The expression divides by zero. */
+  EXPRESSION_OUT_OF_RANGE      /**< A value is beyond MAX_EXPRESSION_VALUE. */
+} ExpressionStatus;
+
+/**
+ * @brief Gets the value of a name of a constant expression.
+ *
+ * @param name The name.
+ * @param value Where to store the value of the name.
+ * @param context The context the resolver was given.
+ * @return true if the name has a value, false otherwise.
+ */
+typedef bool (*ConstantResolver)(const char *name, int *value, void *context);
+
+/**
+ * @struct ConstantExpression
+ * @brief An expression of a parsed line, still to be folded.
+ */
+typedef struct {
+  char *text; /**< The text of the expression. */
+  int *value; /**< Where the value of the expression goes in the line. */
+} ConstantExpression;
+
+/**
+ * @brief Evaluates a constant expression.
+ *
+ * The spaces between the numbers, the names and the operators are ignored.
+ *
+ * @param text The expression.
+ * @param resolve The resolver of the names, NULL to resolve none.
+ * @param context The context passed to the resolver.
+ * @param value Where to store the value, only set when it is folded.
+ * @param name Where to store the first name that could not be resolved, or
+ * NULL.
+ * @return The result of the evaluation.
+ */
+ExpressionStatus evaluate_expression(const char *text, ConstantResolver resolve,
+                                     void *context, int *value,
+                                     char name[MAX_LABEL_LENGTH]);
+
+/**
+ * @brief Checks if a text is a constant expression with an operator or
+ * parentheses, rather than a lone number or name.
+ *
+ * @param text The text to check.
+ * @return true if the text is such an expression, false otherwise.
+ */
+bool is_expression(const char *text);
+
+#endif
@@ -1,5 +1,8 @@
 #include "assembler.h"
 #include "errors.h"
+#include "scanner.h"
+#include "source.h"
+#include "symbol_index.h"
 #include "symbol_table.h"
 
 Symbol *lookup(char symbol_name[MAX_LABEL_LENGTH], Symbol *current) {
@@ -19,6 +22,7 @@ void add_symbol(char symbol_name[MAX_LABEL_LENGTH], Attribute attribute,
   strcpy(new_symbol->symbol_name, symbol_name);
   new_symbol->attribute = attribute;
   new_symbol->value = value;
+  new_symbol->entry_line = 0;
 
   if (*table == NULL) {
     *table = new_symbol;
@@ -32,6 +36,58 @@ void add_symbol(char symbol_name[MAX_LABEL_LENGTH], Attribute attribute,
   }
 }
 
+void free_table(Symbol *table) {
+  while (table != NULL) {
+    Symbol *next = table->next;
+
+    free(table);
+    table = next;
+  }
+}
+
+Attribute attribute_at(const Symbol *symbol, int line) {
+  if (symbol->entry_line > 0 && symbol->entry_line < line) {
+    return INTERNAL;
+  }
+
+  return symbol->attribute;
+}
+
+bool resolve_constant(const char *name, int *value, void *scope) {
+  ConstantScope *constants = (ConstantScope *)scope;
+  Symbol *symbol = NULL;
+
+  if (constants->index) {
+    symbol = index_lookup(constants->index, name);
+  } else {
+    symbol = lookup((char *)name, constants->table);
+  }
+
+  if (symbol == NULL ||
+      (constants->is_strict && symbol->attribute != MDEFINE)) {
+    return false;
+  }
+
+  *value = symbol->value;
+
+  return true;
+}
+
+bool fold_constants(AST *current_node, ConstantScope *scope, int line,
+                    DiagnosticList *diagnostics) {
+  Diagnostic error;
+
+  memset(&error, 0, sizeof(Diagnostic));
+
+  if (fold_expressions(current_node, resolve_constant, scope, &error, line)) {
+    return false;
+  }
+
+  add_diagnostic(diagnostics, &error);
+
+  return true;
+}
+
 int get_tokens_count(AST **current_node) {
   int token_counter = 0;
   int i = 0;
@@ -87,133 +143,248 @@ int get_tokens_count(AST **current_node) {
   return token_counter;
 }
 
-bool do_first_pass(Symbol **symbol_table, FILE *am_file,
-                   const char *input_file_name) {
+int get_line_size(AST *node) {
+  if (node->ASTType == INSTRUCTION) {
+    return get_tokens_count(&node);
+  }
+
+  if (node->ASTType != DIRECTIVE) {
+    return 0;
+  }
+
+  if (node->ASTOpt.Dir.DirOpt == DATA) {
+    return get_data_size(node);
+  }
+
+  if (node->ASTOpt.Dir.DirOpt == STRING) {
+    return strlen(node->ASTOpt.Dir.ParamsOpt.string) + 1;
+  }
+
+  return 0;
+}
+
+/* Adds the symbol of a scanned line as the parsed line would, counting words */
+static bool add_scanned_line(ScannedLine *scanned, int current_line,
+                             int *instruction_counter, SymbolIndex *index,
+                             Symbol **symbol_table,
+                             DiagnosticList *diagnostics) {
+  char *name = scanned->label;
+  char *element = scanned->elements;
+  Attribute attribute = CODE;
+  int value = *instruction_counter;
+  bool has_error = false;
+  int i = 0;
+
+  switch (scanned->type) {
+  case SCAN_DEFINE:
+    name = scanned->name;
+    attribute = MDEFINE;
+    value = scanned->value;
+    break;
+  case SCAN_EXTERN:
+    name = scanned->name;
+    attribute = EXTERNAL;
+    value = 0;
+    break;
+  case SCAN_DATA:
+  case SCAN_STRING:
+    /* Data takes its words where it is, labeled or not */
+    if (name[0] == '\0') {
+      *instruction_counter += scanned->size;
+      return false;
+    }
+
+    attribute = MDATA;
+    break;
+  case SCAN_INSTRUCTION:
+    *instruction_counter += scanned->size;
+
+    if (name[0] == '\0') {
+      return false;
+    }
+    break;
+  default:
+    return false;
+  }
+
+  if (index_lookup(index, name)) {
+    report_diagnostic(diagnostics, DIAG_REDEFINITION_OF_SYMBOL, current_line,
+                      0, name);
+    return true;
+  }
+
+  /* The elements of a data label must be defines known by now */
+  for (i = 0; i < scanned->elements_count; i++) {
+    Symbol *symbol_to_find = index_lookup(index, element);
+
+    if (symbol_to_find == NULL) {
+      report_diagnostic(diagnostics, DIAG_UNDEFINED_DATA_SYMBOL_ELEMENT,
+                        current_line, 0, element);
+      has_error = true;
+    } else if (symbol_to_find->attribute != MDEFINE) {
+      report_diagnostic(diagnostics, DIAG_INVALID_DATA_ELEMENT_TYPE,
+                        current_line, 0, element);
+      has_error = true;
+    }
+
+    element += strlen(element) + 1;
+  }
+
+  index_add_symbol(index, name, attribute, value, symbol_table);
+
+  if (attribute == MDATA) {
+    *instruction_counter += scanned->size;
+  }
+
+  return has_error;
+}
+
+bool do_first_pass(Symbol **symbol_table, const SourceFile *source,
+                   DiagnosticList *diagnostics) {
   char line[MAX_LINE_LENGTH] = {0};
   int max_lines = MAX_MEMORY_SIZE / MAX_WORD_SIZE;
   int instruction_counter = 100;
   int data_counter = 0;
+  long image_size = 0;
   bool has_error = false;
   int current_line = 0;
   int i = 0;
 
   Tokens *tokens = NULL;
   AST *current_node = NULL;
-  Symbol *new_symbol = NULL;
+  ScannedLine scanned;
+  SymbolIndex index;
+  ConstantScope constants = {NULL, NULL, true};
 
-  am_file = fopen(input_file_name, "r");
-
-  if (!am_file) {
-    fprintf(stderr, ERROR_CANNOT_READ, input_file_name);
-    exit(EXIT_FAILURE);
-  }
-
-  while (fgets(line, sizeof(line), am_file)) {
-    tokens = split_line_to_tokens(line);
+  /* The symbols are looked up and appended through an index, as the table
+     can hold the labels of thousands of lines */
+  init_symbol_index(&index, *symbol_table);
+  constants.index = &index;
 
+  while (current_line < source->lines_count) {
+    read_source_line(source, current_line, line);
     current_line++;
-    current_node = parse_tokens(tokens, current_line, input_file_name);
 
     if (current_line >= max_lines) {
-      printf(ERROR_MEMORY_OVERFLOW, input_file_name, max_lines);
+      report_diagnostic(diagnostics, DIAG_MEMORY_OVERFLOW, current_line, 0,
+                        max_lines);
       has_error = true;
       break;
     }
 
-    if (current_node->ASTType == EMPTY || current_node->ASTType == COMMENT) {
+    /* Well-formed lines are sized without building an AST */
+    if (scan_line(line, &scanned)) {
+      if (scanned.type == SCAN_DATA || scanned.type == SCAN_STRING ||
+          scanned.type == SCAN_INSTRUCTION) {
+        image_size += scanned.size;
+      }
+
+      if (add_scanned_line(&scanned, current_line, &instruction_counter,
+                           &index, symbol_table, diagnostics)) {
+        has_error = true;
+      }
+
       continue;
     }
 
-    if (current_node->ASTType == ERROR) {
-      printf("%s", current_node->syntax_error);
-      has_error = true;
-      continue;
+    tokens = split_line_to_tokens(line);
+    current_node = parse_tokens(tokens, current_line);
+
+    if (current_node->ASTType != EMPTY && current_node->ASTType != COMMENT) {
+      add_diagnostic(diagnostics, &current_node->warning);
+    }
+
+    /* The names of the expressions are the defines of the lines before */
+    if (current_node->ASTType != ERROR && current_node->expressions_count > 0) {
+      if (fold_constants(current_node, &constants, current_line,
+                         diagnostics)) {
+        has_error = true;
+      }
     }
 
-    new_symbol = (Symbol *)malloc(sizeof(Symbol));
-    new_symbol->next = NULL;
+    image_size += get_line_size(current_node);
 
-    if (current_node->ASTType == DEFINE) {
-      if (lookup(current_node->ASTOpt.Define.name, *symbol_table)) {
-        printf(ERROR_REDEFINITION_OF_SYMBOL, current_node->ASTOpt.Define.name,
-               current_line, input_file_name);
+    if (current_node->ASTType == ERROR) {
+      add_diagnostic(diagnostics, &current_node->error);
+      has_error = true;
+    } else if (current_node->ASTType == DEFINE) {
+      if (index_lookup(&index, current_node->ASTOpt.Define.name)) {
+        report_diagnostic(diagnostics, DIAG_REDEFINITION_OF_SYMBOL,
+                          current_line, 0, current_node->ASTOpt.Define.name);
         has_error = true;
       } else {
-        add_symbol(current_node->ASTOpt.Define.name, MDEFINE,
-                   current_node->ASTOpt.Define.number, new_symbol,
-                   symbol_table);
+        index_add_symbol(&index, current_node->ASTOpt.Define.name, MDEFINE,
+                         current_node->ASTOpt.Define.number, symbol_table);
       }
     } else if (current_node->ASTType == DIRECTIVE) {
       if (current_node->ASTOpt.Dir.DirOpt == DATA ||
           current_node->ASTOpt.Dir.DirOpt == STRING) {
-        if (lookup(current_node->label_name, *symbol_table)) {
-          printf(ERROR_REDEFINITION_OF_SYMBOL, current_node->label_name,
-                 current_line, input_file_name);
+        if (index_lookup(&index, current_node->label_name)) {
+          report_diagnostic(diagnostics, DIAG_REDEFINITION_OF_SYMBOL,
+                            current_line, 0, current_node->label_name);
           has_error = true;
         } else {
           if (strcmp(current_node->label_name, "") != 0) {
             if (current_node->ASTOpt.Dir.DirOpt == DATA) {
-              data_counter += current_node->ASTOpt.Dir.ParamsOpt.Data.count;
+              char **names = current_node->ASTOpt.Dir.ParamsOpt.Data.names;
 
-              for (i = 0; i < current_node->ASTOpt.Dir.ParamsOpt.Data.count;
+              data_counter += get_data_size(current_node);
+
+              for (i = 0;
+                   names && i < current_node->ASTOpt.Dir.ParamsOpt.Data.count;
                    i++) {
-                if (!is_integer(
-                        current_node->ASTOpt.Dir.ParamsOpt.Data.elements[i])) {
-                  Symbol *symbol_to_find = lookup(
-                      current_node->ASTOpt.Dir.ParamsOpt.Data.elements[i],
-                      *symbol_table);
+                if (names[i]) {
+                  Symbol *symbol_to_find = index_lookup(&index, names[i]);
 
                   if (symbol_to_find != NULL) {
                     if (symbol_to_find->attribute != MDEFINE) {
-                      printf(
-                          ERROR_INVALID_DATA_ELEMENT_TYPE,
-                          current_node->ASTOpt.Dir.ParamsOpt.Data.elements[i],
-                          current_line, input_file_name);
+                      report_diagnostic(diagnostics,
+                                        DIAG_INVALID_DATA_ELEMENT_TYPE,
+                                        current_line, 0, names[i]);
                       has_error = true;
                     }
                   } else {
-                    printf(ERROR_UNDEFIND_DATA_SYMBOL_ELEMENT,
-                           current_node->ASTOpt.Dir.ParamsOpt.Data.elements[i],
-                           current_line, input_file_name);
+                    report_diagnostic(diagnostics,
+                                      DIAG_UNDEFINED_DATA_SYMBOL_ELEMENT,
+                                      current_line, 0, names[i]);
                     has_error = true;
                   }
                 }
               }
             } else {
-              for (i = 0;
-                   i <= strlen(current_node->ASTOpt.Dir.ParamsOpt.string);
-                   i++) {
-                data_counter++;
-              }
+              data_counter +=
+                  strlen(current_node->ASTOpt.Dir.ParamsOpt.string) + 1;
             }
 
-            add_symbol(current_node->label_name, MDATA, instruction_counter,
-                       new_symbol, symbol_table);
+            index_add_symbol(&index, current_node->label_name, MDATA,
+                             instruction_counter, symbol_table);
 
             instruction_counter += data_counter;
             data_counter = 0;
+          } else {
+            instruction_counter += get_line_size(current_node);
           }
         }
       } else if (current_node->ASTOpt.Dir.DirOpt == EXTERN) {
-        if (lookup(current_node->ASTOpt.Dir.ParamsOpt.label, *symbol_table)) {
-          printf(ERROR_REDEFINITION_OF_SYMBOL,
-                 current_node->ASTOpt.Dir.ParamsOpt.label, current_line,
-                 input_file_name);
+        if (index_lookup(&index, current_node->ASTOpt.Dir.ParamsOpt.label)) {
+          report_diagnostic(diagnostics, DIAG_REDEFINITION_OF_SYMBOL,
+                            current_line, 0,
+                            current_node->ASTOpt.Dir.ParamsOpt.label);
           has_error = true;
         } else {
-          add_symbol(current_node->ASTOpt.Dir.ParamsOpt.label, EXTERNAL, 0,
-                     new_symbol, symbol_table);
+          index_add_symbol(&index, current_node->ASTOpt.Dir.ParamsOpt.label,
+                           EXTERNAL, 0, symbol_table);
         }
       }
     } else if (current_node->ASTType == INSTRUCTION) {
       if ((strcmp(current_node->label_name, "") != 0)) {
-        if (lookup(current_node->label_name, *symbol_table)) {
-          printf(ERROR_REDEFINITION_OF_SYMBOL, current_node->label_name,
-                 current_line, input_file_name);
+        if (index_lookup(&index, current_node->label_name)) {
+          report_diagnostic(diagnostics, DIAG_REDEFINITION_OF_SYMBOL,
+                            current_line, 0, current_node->label_name);
           has_error = true;
         } else {
-          add_symbol(current_node->label_name, CODE, instruction_counter,
-                     new_symbol, symbol_table);
+          index_add_symbol(&index, current_node->label_name, CODE,
+                           instruction_counter, symbol_table);
         }
 
         instruction_counter += get_tokens_count(&current_node);
@@ -223,10 +394,20 @@ bool do_first_pass(Symbol **symbol_table, FILE *am_file,
     }
 
     free_ast(current_node);
+    free(current_node);
     free_tokens(tokens);
     current_node = NULL;
     tokens = NULL;
   }
 
+  /* The image holds the words of every line, labeled or not */
+  if (image_size > MAX_IMAGE_SIZE) {
+    report_diagnostic(diagnostics, DIAG_IMAGE_OVERFLOW, current_line, 0,
+                      MAX_IMAGE_SIZE);
+    has_error = true;
+  }
+
+  free_symbol_index(&index);
+
   return has_error;
 }
\ No newline at end of file
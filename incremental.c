@@ -0,0 +1,1479 @@
+/**
+ * @file incremental.c
+ * @brief The incremental assembler, which keeps the state of every line of the
+ * last assembly and redoes only what an edit invalidates.
+ *
+ * The first pass gives a label the address reached by the sizes of the lines
+ * before it, and the second pass encodes every line from its operands and the
+ * values of the symbols they name. So when the edited lines parse cleanly and
+ * define the same symbols as the ones they replace, the symbol table keeps its
+ * shape and the attributes of its symbols, and only the values of the labels
+ * after a line whose size changed, and of the defines edited, can move. The
+ * edited lines are parsed and encoded, the lines after them are laid out again
+ * until their place is the one they had, and the lines referring to a moved
+ * symbol are encoded again in place, since the number of words of a line
+ * depends on the attributes of its symbols and not on their values.
+ */
+
+#include "incremental.h"
+#include "assembler.h"
+#include "errors.h"
+#include "utils.h"
+#include <stdlib.h>
+
+/* A line encodes to at most one word for every character of a .string */
+#define MAX_LINE_WORDS MAX_LINE_LENGTH
+
+/* The address the first pass gives the first word */
+
+typedef struct TrackedSymbol TrackedSymbol;
+
+/**
+ * @struct ExternalUse
+ * @brief An external use of a replaced line.
+ */
+typedef struct {
+  Symbol *symbol; /**< The external symbol. */
+  int counter;    /**< The instruction counter before the line. */
+} ExternalUse;
+
+/**
+ * @struct Reference
+ * @brief A line referring to a symbol, linked with the other lines referring
+ * to it.
+ */
+typedef struct Reference {
+  IncrementalLine *line;      /**< The line. */
+  TrackedSymbol *symbol;      /**< The symbol. */
+  struct Reference *previous; /**< The previous line referring to it. */
+  struct Reference *next;     /**< The next line referring to it. */
+} Reference;
+
+/**
+ * @struct TrackedSymbol
+ * @brief A symbol of the table with the lines defining and referring to it.
+ */
+struct TrackedSymbol {
+  Symbol symbol;         /**< The symbol, first so that the symbol table can
+                            link it. */
+  IncrementalLine *line; /**< The line defining the symbol. */
+  Reference *references; /**< The lines referring to the symbol. */
+  bool is_moved;         /**< Whether the update changed its value. */
+};
+
+struct IncrementalLine {
+  char text[MAX_LINE_LENGTH]; /**< The line, as read by fgets(). */
+  int index;                  /**< The index of the line, from 0. */
+  AST *node;                  /**< The parsed line, kept while it refers to
+                                 symbols. */
+  TrackedSymbol *symbol;      /**< The symbol the line defines, or NULL. */
+  Reference *references;      /**< The symbols the line refers to. */
+  int references_count;       /**< The number of symbols referred to. */
+  Symbol **externals;         /**< The external symbols used, in order. */
+  int externals_count;        /**< The number of external uses. */
+  bool is_instruction;        /**< Whether the line is an instruction. */
+  bool is_entry;              /**< Whether the line is a .entry line. */
+  int symbol_size;            /**< The words counted by the first pass. */
+  int size;                   /**< The words encoded by the second pass. */
+  int data_size;              /**< The data words among them. */
+  int address;                /**< The first pass address of the line. */
+  int offset;                 /**< The offset of its words in the image. */
+  int counter;                /**< The instruction counter of the second
+                                 pass before the line. */
+  int update;                 /**< The update that last encoded it. */
+  int listed;                 /**< The update that last listed its external
+                                 uses. */
+};
+
+/* Makes room for more elements at the end of a growing array */
+static void *reserve(void *array, int count, int *capacity, size_t size) {
+  if (count > *capacity) {
+    int new_capacity = *capacity ? *capacity : 64;
+
+    while (count > new_capacity) {
+      new_capacity *= 2;
+    }
+
+    array = realloc(array, new_capacity * size);
+
+    if (array == NULL) {
+      fprintf(stderr, ERROR_OUT_OF_MEMORY);
+      exit(EXIT_FAILURE);
+    }
+
+    *capacity = new_capacity;
+  }
+
+  return array;
+}
+
+static IncrementalLine *create_line(const char *text, int index) {
+  IncrementalLine *line = (IncrementalLine *)calloc(1, sizeof(IncrementalLine));
+
+  if (line == NULL) {
+    fprintf(stderr, ERROR_OUT_OF_MEMORY);
+    exit(EXIT_FAILURE);
+  }
+
+  strcpy(line->text, text);
+  line->index = index;
+
+  return line;
+}
+
+static AST *parse_text(const char *text, int line_number) {
+  char line[MAX_LINE_LENGTH];
+  Tokens *tokens = NULL;
+  AST *node = NULL;
+
+  strcpy(line, text);
+  tokens = split_line_to_tokens(line);
+  node = parse_tokens(tokens, line_number);
+  free_tokens(tokens);
+
+  return node;
+}
+
+static void free_node(AST *node) {
+  free_ast(node);
+  free(node);
+}
+
+/* Gets the symbol the first pass adds for a parsed line, if any */
+static const char *declared_name(AST *node, Attribute *attribute) {
+  if (node->ASTType == DEFINE) {
+    *attribute = MDEFINE;
+    return node->ASTOpt.Define.name;
+  }
+
+  if (node->ASTType == INSTRUCTION && node->label_name[0] != '\0') {
+    *attribute = CODE;
+    return node->label_name;
+  }
+
+  if (node->ASTType != DIRECTIVE) {
+    return NULL;
+  }
+
+  if (node->ASTOpt.Dir.DirOpt == EXTERN) {
+    *attribute = EXTERNAL;
+    return node->ASTOpt.Dir.ParamsOpt.label;
+  }
+
+  if ((node->ASTOpt.Dir.DirOpt == DATA || node->ASTOpt.Dir.DirOpt == STRING) &&
+      node->label_name[0] != '\0') {
+    *attribute = MDATA;
+    return node->label_name;
+  }
+
+  return NULL;
+}
+
+/* Adds the names code_inst_operand() looks up for an operand */
+static int operand_names(AST *node, int index, const char **names,
+                         int count) {
+  switch (node->ASTOpt.Inst.InstOperands[index].OperandType) {
+  case IMMEDIATE:
+    if (node->ASTOpt.Inst.InstOperands[index]
+            .OperandOpt.Immediate.ImmediateType == IMLABEL) {
+      names[count++] = node->ASTOpt.Inst.InstOperands[index]
+                           .OperandOpt.Immediate.ImmediateOpt.label;
+    }
+    break;
+  case DIRECT:
+    names[count++] = node->ASTOpt.Inst.InstOperands[index].OperandOpt.label;
+    break;
+  case INDEXED:
+    names[count++] =
+        node->ASTOpt.Inst.InstOperands[index].OperandOpt.Index.label;
+
+    if (node->ASTOpt.Inst.InstOperands[index].OperandOpt.Index.IndexType ==
+        INLABEL) {
+      names[count++] = node->ASTOpt.Inst.InstOperands[index]
+                           .OperandOpt.Index.IndexOpt.label;
+    }
+    break;
+  case REGISTER:
+    break;
+  }
+
+  return count;
+}
+
+/* Lists the names the second pass looks up to encode a line */
+static int referenced_names(AST *node, const char **names) {
+  int count = 0;
+  int i = 0;
+
+  if (node->ASTType == INSTRUCTION) {
+    switch (node->ASTOpt.Inst.InstType) {
+    case RTS:
+    case HLT:
+      break;
+
+    case MOV:
+    case CMP:
+    case ADD:
+    case SUB:
+    case LEA:
+      if (node->ASTOpt.Inst.InstOperands[0].OperandType != REGISTER ||
+          node->ASTOpt.Inst.InstOperands[1].OperandType != REGISTER) {
+        count = operand_names(node, 0, names, count);
+        count = operand_names(node, 1, names, count);
+      }
+      break;
+
+    default:
+      count = operand_names(node, 1, names, count);
+      break;
+    }
+  } else if (node->ASTType == DIRECTIVE && node->ASTOpt.Dir.DirOpt == DATA &&
+             node->ASTOpt.Dir.ParamsOpt.Data.names) {
+    for (i = 0; i < node->ASTOpt.Dir.ParamsOpt.Data.count; i++) {
+      if (node->ASTOpt.Dir.ParamsOpt.Data.names[i]) {
+        names[count++] = node->ASTOpt.Dir.ParamsOpt.Data.names[i];
+      }
+    }
+  }
+
+  return count;
+}
+
+/* Links a line to the symbols it refers to, once for every symbol */
+static void link_references(IncrementalAssembly *assembly,
+                            IncrementalLine *line, AST *node) {
+  const char *names[MAX_LINE_WORDS];
+  int count = referenced_names(node, names);
+  int i = 0;
+  int j = 0;
+
+  line->references_count = 0;
+  line->references =
+      count > 0 ? (Reference *)malloc(count * sizeof(Reference)) : NULL;
+
+  if (count > 0 && line->references == NULL) {
+    fprintf(stderr, ERROR_OUT_OF_MEMORY);
+    exit(EXIT_FAILURE);
+  }
+
+  for (i = 0; i < count; i++) {
+    TrackedSymbol *symbol =
+        (TrackedSymbol *)index_lookup(&assembly->index, names[i]);
+    Reference *reference = NULL;
+
+    for (j = 0; symbol && j < line->references_count; j++) {
+      if (line->references[j].symbol == symbol) {
+        symbol = NULL;
+      }
+    }
+
+    if (symbol == NULL) {
+      continue;
+    }
+
+    reference = &line->references[line->references_count++];
+    reference->line = line;
+    reference->symbol = symbol;
+    reference->previous = NULL;
+    reference->next = symbol->references;
+
+    if (symbol->references) {
+      symbol->references->previous = reference;
+    }
+
+    symbol->references = reference;
+  }
+
+  /* Only a line referring to symbols can have to be encoded again */
+  if (line->references_count > 0) {
+    line->node = node;
+  } else {
+    free_node(node);
+  }
+}
+
+static void unlink_references(IncrementalLine *line) {
+  int i = 0;
+
+  for (i = 0; i < line->references_count; i++) {
+    Reference *reference = &line->references[i];
+
+    if (reference->previous) {
+      reference->previous->next = reference->next;
+    } else {
+      reference->symbol->references = reference->next;
+    }
+
+    if (reference->next) {
+      reference->next->previous = reference->previous;
+    }
+  }
+
+  free(line->references);
+  line->references = NULL;
+  line->references_count = 0;
+}
+
+/* Frees what an assembly left in a line, keeping its text */
+static void clear_line(IncrementalLine *line) {
+  free(line->references);
+  free(line->externals);
+
+  if (line->node) {
+    free_node(line->node);
+  }
+
+  line->node = NULL;
+  line->symbol = NULL;
+  line->references = NULL;
+  line->references_count = 0;
+  line->externals = NULL;
+  line->externals_count = 0;
+}
+
+/**
+ * @brief Encodes a line on its own, as the second pass does at its place.
+ *
+ * The uses of external symbols are recorded without their address, which
+ * is given when the result is listed.
+ *
+ * @param assembly The assembly.
+ * @param line The line.
+ * @param node The parsed line.
+ * @param words The buffer the words are encoded into.
+ * @return true if the line was encoded, false if it has an error.
+ */
+static bool encode_line(IncrementalAssembly *assembly, IncrementalLine *line,
+                        AST *node, int *words) {
+  CodeImage code_image;
+  Translator translator;
+  DiagnosticList diagnostics;
+  Symbol *external = NULL;
+  int counter = line->counter;
+  int line_number = line->index + 1;
+  bool has_error = false;
+  int i = 0;
+
+  code_image.words = words;
+  code_image.count = 0;
+  code_image.capacity = MAX_LINE_WORDS;
+  code_image.preassigned = true;
+  translator.code_image = &code_image;
+  translator.internal_symbols = NULL;
+  translator.external_symbols = NULL;
+  translator.last_external_symbol = NULL;
+  translator.symbol_index = &assembly->index;
+  init_line_table(&translator.lines);
+  init_diagnostics(&diagnostics, assembly->name);
+  line->data_size = 0;
+
+  if (node->ASTType == INSTRUCTION) {
+    handle_instruction(&translator, node, &assembly->symbol_table, &counter, 0,
+                       &line_number, &has_error, &diagnostics);
+  } else if (node->ASTType == DIRECTIVE && node->ASTOpt.Dir.DirOpt != ENTRY) {
+    /* The .entry lines are applied through the entry line of the symbols */
+    handle_directive(&translator, node, &assembly->symbol_table,
+                     &line->data_size, &line_number, &has_error,
+                     &diagnostics);
+  }
+
+  free(line->externals);
+  line->externals = NULL;
+  line->externals_count = 0;
+
+  for (external = translator.external_symbols; external;
+       external = external->next) {
+    line->externals_count++;
+  }
+
+  if (line->externals_count > 0) {
+    line->externals =
+        (Symbol **)malloc(line->externals_count * sizeof(Symbol *));
+
+    if (line->externals == NULL) {
+      fprintf(stderr, ERROR_OUT_OF_MEMORY);
+      exit(EXIT_FAILURE);
+    }
+  }
+
+  for (external = translator.external_symbols; external;
+       external = external->next) {
+    line->externals[i++] =
+        index_lookup(&assembly->index, external->symbol_name);
+  }
+
+  free_table(translator.external_symbols);
+  free_diagnostics(&diagnostics);
+
+  line->size = code_image.count;
+  line->update = assembly->update;
+  assembly->stats.encoded_lines++;
+
+  return !has_error;
+}
+
+static bool encodes_words(AST *node) {
+  return node->ASTType == INSTRUCTION ||
+         (node->ASTType == DIRECTIVE && (node->ASTOpt.Dir.DirOpt == DATA ||
+                                         node->ASTOpt.Dir.DirOpt == STRING));
+}
+
+/* Gets the instruction counter of the second pass after a line */
+static int counter_after(const IncrementalLine *line) {
+  return line->is_instruction ? line->offset + line->size : line->counter;
+}
+
+static void move_symbol(TrackedSymbol *symbol, int value,
+                        TrackedSymbol ***moved, int *moved_count,
+                        int *moved_capacity) {
+  if (symbol->symbol.value == value) {
+    return;
+  }
+
+  symbol->symbol.value = value;
+
+  if (!symbol->is_moved) {
+    symbol->is_moved = true;
+    *moved = (TrackedSymbol **)reserve(*moved, *moved_count + 1,
+                                       moved_capacity, sizeof(TrackedSymbol *));
+    (*moved)[(*moved_count)++] = symbol;
+  }
+}
+
+static int compare_lines(const void *first, const void *second) {
+  return (*(IncrementalLine *const *)first)->index -
+         (*(IncrementalLine *const *)second)->index;
+}
+
+/**
+ * @brief Lists the entries and the external uses of the image, and counts its
+ * instructions.
+ *
+ * @param assembly The assembly.
+ * @param is_entry_moved Whether the value of an entry symbol moved.
+ * @param is_use_moved Whether an external use was added, removed or moved.
+ */
+static void list_result(IncrementalAssembly *assembly, bool is_entry_moved,
+                        bool is_use_moved) {
+  AsmResult *result = &assembly->result;
+  IncrementalLine **lines = NULL;
+  Symbol **next = NULL;
+  Symbol *entry = NULL;
+  int lines_count = 0;
+  int lines_capacity = 0;
+  int i = 0;
+  int j = 0;
+  Reference *reference = NULL;
+
+  /* The entries keep their order, only their values can move */
+  for (entry = result->entries; is_entry_moved && entry; entry = entry->next) {
+    entry->value = assembly->entries[i++]->value;
+  }
+
+  result->instructions_count =
+      assembly->lines_count > 0
+          ? counter_after(assembly->lines[assembly->lines_count - 1])
+          : 0;
+
+  if (!is_use_moved) {
+    return;
+  }
+
+  /* Only the lines referring to an external symbol can use one */
+  for (i = 0; i < assembly->externals_count; i++) {
+    TrackedSymbol *symbol = (TrackedSymbol *)assembly->externals[i];
+
+    for (reference = symbol->references; reference;
+         reference = reference->next) {
+      IncrementalLine *line = reference->line;
+
+      if (line->externals_count > 0 && line->listed != assembly->update) {
+        line->listed = assembly->update;
+        lines = (IncrementalLine **)reserve(lines, lines_count + 1,
+                                            &lines_capacity,
+                                            sizeof(IncrementalLine *));
+        lines[lines_count++] = line;
+      }
+    }
+  }
+
+  if (lines_count > 1) {
+    qsort(lines, lines_count, sizeof(IncrementalLine *), compare_lines);
+  }
+
+  free_table(result->externals);
+  result->externals = NULL;
+  next = &result->externals;
+
+  for (i = 0; i < lines_count; i++) {
+    for (j = 0; j < lines[i]->externals_count; j++) {
+      /* The address code_direct_operand() gives an external use */
+      add_to_table(lines[i]->externals[j]->symbol_name, EXTERNAL,
+                   lines[i]->counter + 101, next);
+      next = &(*next)->next;
+    }
+  }
+
+  free(lines);
+}
+
+/* Frees what the last assembly left in the lines and the symbols */
+static void drop_state(IncrementalAssembly *assembly) {
+  Symbol *symbol = assembly->symbol_table;
+  int i = 0;
+
+  for (i = 0; i < assembly->lines_count; i++) {
+    clear_line(assembly->lines[i]);
+  }
+
+  while (symbol != NULL) {
+    Symbol *next = symbol->next;
+
+    free(symbol);
+    symbol = next;
+  }
+
+  free_symbol_index(&assembly->index);
+  free(assembly->entries);
+  free(assembly->externals);
+  assembly->symbol_table = NULL;
+  assembly->entries = NULL;
+  assembly->entries_count = 0;
+  assembly->externals = NULL;
+  assembly->externals_count = 0;
+  assembly->is_incremental = false;
+}
+
+static bool same_symbols(const Symbol *symbol, const Symbol *other) {
+  for (; symbol && other; symbol = symbol->next, other = other->next) {
+    if (strcmp(symbol->symbol_name, other->symbol_name) != 0 ||
+        symbol->value != other->value) {
+      return false;
+    }
+  }
+
+  return symbol == NULL && other == NULL;
+}
+
+/* Tells whether the words of a line fit the buffer it is encoded into */
+static bool fits_line(AST *node) {
+  return node->ASTType != DIRECTIVE || node->ASTOpt.Dir.DirOpt != DATA ||
+         get_data_size(node) <= MAX_LINE_WORDS;
+}
+
+/**
+ * @brief Builds the state of every line from the result of an assembly
+ * without diagnostics, checking that it encodes to the same result.
+ *
+ * @param assembly The assembly, with its lines and its result.
+ * @return true if the state gives the same result as the assembly.
+ */
+static bool build_state(IncrementalAssembly *assembly) {
+  AsmResult *result = &assembly->result;
+  Symbol **last = &assembly->symbol_table;
+  Symbol *entries = result->entries;
+  Symbol *externals = result->externals;
+  Symbol *symbol = NULL;
+  Symbol **next = NULL;
+  int words[MAX_LINE_WORDS];
+  int address = FIRST_ADDRESS;
+  int offset = 0;
+  int counter = 0;
+  int data_count = 0;
+  int entries_capacity = 0;
+  int externals_capacity = 0;
+  bool is_same = true;
+  int i = 0;
+
+  /* The symbols, as the first pass adds them */
+  for (i = 0; i < assembly->lines_count; i++) {
+    IncrementalLine *line = assembly->lines[i];
+    AST *node = parse_text(line->text, i + 1);
+    Attribute attribute = CODE;
+    const char *name = declared_name(node, &attribute);
+
+    line->index = i;
+    line->node = node;
+    line->is_instruction = node->ASTType == INSTRUCTION;
+    line->is_entry =
+        node->ASTType == DIRECTIVE && node->ASTOpt.Dir.DirOpt == ENTRY;
+    line->symbol_size = get_line_size(node);
+    line->address = address;
+
+    if (name) {
+      TrackedSymbol *tracked =
+          (TrackedSymbol *)calloc(1, sizeof(TrackedSymbol));
+
+      if (tracked == NULL) {
+        fprintf(stderr, ERROR_OUT_OF_MEMORY);
+        exit(EXIT_FAILURE);
+      }
+
+      strcpy(tracked->symbol.symbol_name, name);
+      tracked->symbol.attribute = attribute;
+      tracked->symbol.value = attribute == MDEFINE ? node->ASTOpt.Define.number
+                              : attribute == EXTERNAL ? 0
+                                                      : address;
+      tracked->line = line;
+      line->symbol = tracked;
+      *last = &tracked->symbol;
+      last = &tracked->symbol.next;
+    }
+
+    address += line->symbol_size;
+  }
+
+  assembly->stats.parsed_lines += assembly->lines_count;
+  init_symbol_index(&assembly->index, assembly->symbol_table);
+
+  /* A symbol is internal from its first .entry line on */
+  for (i = 0; i < assembly->lines_count; i++) {
+    if (assembly->lines[i]->is_entry) {
+      symbol = index_lookup(&assembly->index,
+                            assembly->lines[i]->node->ASTOpt.Dir.ParamsOpt.label);
+
+      if (symbol && symbol->entry_line == 0) {
+        symbol->entry_line = i + 1;
+      }
+    }
+  }
+
+  for (symbol = assembly->symbol_table; symbol; symbol = symbol->next) {
+    if (symbol->entry_line > 0) {
+      assembly->entries = (Symbol **)reserve(
+          assembly->entries, assembly->entries_count + 1, &entries_capacity,
+          sizeof(Symbol *));
+      assembly->entries[assembly->entries_count++] = symbol;
+    }
+
+    if (symbol->attribute == EXTERNAL) {
+      assembly->externals = (Symbol **)reserve(
+          assembly->externals, assembly->externals_count + 1,
+          &externals_capacity, sizeof(Symbol *));
+      assembly->externals[assembly->externals_count++] = symbol;
+    }
+  }
+
+  /* The words, checked against the ones of the assembly */
+  for (i = 0; i < assembly->lines_count; i++) {
+    IncrementalLine *line = assembly->lines[i];
+    AST *node = line->node;
+
+    /*
+     * A source with larger lines, or with expressions whose value depends on
+     * the defines before them, is only assembled in full
+     */
+    if (!fits_line(node) || node->expressions_count > 0) {
+      return false;
+    }
+
+    line->node = NULL;
+    line->offset = offset;
+    line->counter = counter;
+    line->size = 0;
+    line->data_size = 0;
+
+    if (encodes_words(node)) {
+      is_same = encode_line(assembly, line, node, words) && is_same;
+      is_same = is_same && offset + line->size <= result->words_count &&
+                memcmp(result->words + offset, words,
+                       line->size * sizeof(int)) == 0;
+    }
+
+    offset += line->size;
+    data_count += line->data_size;
+    counter = counter_after(line);
+    link_references(assembly, line, node);
+  }
+
+  result->entries = NULL;
+  result->externals = NULL;
+  next = &result->entries;
+
+  for (i = 0; i < assembly->entries_count; i++) {
+    add_to_table(assembly->entries[i]->symbol_name, INTERNAL,
+                 assembly->entries[i]->value, next);
+    next = &(*next)->next;
+  }
+
+  list_result(assembly, false, true);
+
+  is_same = is_same && offset == result->words_count &&
+            counter == result->instructions_count &&
+            data_count == result->data_count &&
+            same_symbols(entries, result->entries) &&
+            same_symbols(externals, result->externals);
+
+  free_table(entries);
+  free_table(externals);
+
+  return is_same;
+}
+
+/* Splits an expanded source into the lines of the assembly */
+static void set_lines(IncrementalAssembly *assembly, const SourceFile *source) {
+  char text[MAX_LINE_LENGTH];
+  int i = 0;
+
+  for (i = 0; i < assembly->lines_count; i++) {
+    clear_line(assembly->lines[i]);
+    free(assembly->lines[i]);
+  }
+
+  assembly->lines = (IncrementalLine **)reserve(
+      assembly->lines, source->lines_count, &assembly->lines_capacity,
+      sizeof(IncrementalLine *));
+  assembly->lines_count = source->lines_count;
+
+  for (i = 0; i < source->lines_count; i++) {
+    read_source_line(source, i, text);
+    assembly->lines[i] = create_line(text, i);
+  }
+}
+
+/* Tells whether a source expands to itself and is read line by line as is */
+static bool is_direct_text(const char *text, long size) {
+  long start = 0;
+
+  while (start < size) {
+    const char *line = text + start;
+    const char *end = (const char *)memchr(line, '\n', size - start);
+    long length = end ? end - line + 1 : size - start;
+    long spaces = 0;
+
+    if (length > MAX_LINE_LENGTH - 1 || memchr(line, '\0', length)) {
+      return false;
+    }
+
+    while (spaces < length && line[spaces] == ' ') {
+      spaces++;
+    }
+
+    if (length - spaces >= 3 && strncmp(line + spaces, "mcr", 3) == 0) {
+      return false;
+    }
+
+    start += length;
+  }
+
+  return true;
+}
+
+/* Keeps the source, unless it is direct and so held by the lines */
+static void set_source(IncrementalAssembly *assembly, const char *text,
+                       long size) {
+  char *copy = NULL;
+
+  free_source(&assembly->source);
+  assembly->is_direct = is_direct_text(text, size);
+
+  if (!assembly->is_direct) {
+    copy = (char *)malloc(size + 1);
+
+    if (copy == NULL) {
+      fprintf(stderr, ERROR_OUT_OF_MEMORY);
+      exit(EXIT_FAILURE);
+    }
+
+    memcpy(copy, text, size);
+    copy[size] = '\0';
+    init_source(&assembly->source, copy, size);
+  }
+}
+
+static void start_update(IncrementalAssembly *assembly) {
+  assembly->update++;
+  assembly->stats.is_full = false;
+  assembly->stats.parsed_lines = 0;
+  assembly->stats.encoded_lines = 0;
+  assembly->stats.laid_out_lines = 0;
+}
+
+/* Assembles the whole source again, keeping the state of its lines */
+static bool assemble_text(IncrementalAssembly *assembly, const char *text,
+                          long size) {
+  AsmResult *result = &assembly->result;
+  AsmOptions options;
+
+  options.threads_count = 0;
+  options.check_only = false;
+  options.optimize = false;
+  options.strip = false;
+  options.line_table = false;
+  drop_state(assembly);
+  asm_free_result(result);
+
+  asm_assemble(NULL, assembly->name, text, size, &options, result);
+  set_lines(assembly, &result->source);
+  free_source(&result->source);
+  result->source.size = 0;
+  set_source(assembly, text, size);
+
+  assembly->words_capacity = result->words_count;
+  assembly->stats.is_full = true;
+
+  if (result->status == ASM_OK && result->diagnostics.count == 0) {
+    assembly->is_incremental = build_state(assembly);
+  }
+
+  if (!assembly->is_incremental) {
+    drop_state(assembly);
+  }
+
+  assembly->stats.parsed_lines = assembly->lines_count;
+  assembly->stats.encoded_lines = assembly->lines_count;
+  assembly->stats.laid_out_lines = assembly->lines_count;
+
+  return result->status == ASM_OK;
+}
+
+/* Tells whether a line parses without any diagnostic the passes report */
+static bool is_clean(AST *node) {
+  if (node->ASTType == ERROR) {
+    return false;
+  }
+
+  if (node->ASTType == DIRECTIVE && node->ASTOpt.Dir.DirOpt == ENTRY) {
+    return false;
+  }
+
+  if (!fits_line(node) || node->expressions_count > 0) {
+    return false;
+  }
+
+  return node->ASTType == EMPTY || node->ASTType == COMMENT ||
+         node->warning.code == DIAG_NONE;
+}
+
+/* Tells whether a symbol is defined before a new line of an edit */
+static bool is_defined_before(TrackedSymbol *symbol, int first,
+                              TrackedSymbol **declared, int new_index) {
+  int i = 0;
+
+  if (symbol->line->index < first) {
+    return true;
+  }
+
+  for (i = 0; i < new_index; i++) {
+    if (declared[i] == symbol) {
+      return true;
+    }
+  }
+
+  return false;
+}
+
+/**
+ * @brief Checks that new lines can replace a range of lines without any
+ * diagnostic and without changing the symbols.
+ *
+ * @param assembly The assembly.
+ * @param first The index of the first line replaced.
+ * @param removed The number of lines replaced.
+ * @param nodes The new lines, parsed.
+ * @param declared Set to the symbol every new line defines, or NULL.
+ * @param count The number of new lines.
+ * @return true if the lines can replace the range.
+ */
+static bool check_lines(IncrementalAssembly *assembly, int first, int removed,
+                        AST **nodes, TrackedSymbol **declared, int count) {
+  const char *names[MAX_LINE_WORDS];
+  int old = first;
+  int i = 0;
+  int j = 0;
+
+  for (i = 0; i < count; i++) {
+    Attribute attribute = CODE;
+    const char *name = declared_name(nodes[i], &attribute);
+    int names_count = 0;
+
+    if (!is_clean(nodes[i])) {
+      return false;
+    }
+
+    declared[i] = NULL;
+
+    /* The new lines must define the symbols the old ones did, in order */
+    if (name) {
+      while (old < first + removed && assembly->lines[old]->symbol == NULL) {
+        old++;
+      }
+
+      if (old == first + removed ||
+          strcmp(assembly->lines[old]->symbol->symbol.symbol_name, name) !=
+              0 ||
+          assembly->lines[old]->symbol->symbol.attribute != attribute) {
+        return false;
+      }
+
+      declared[i] = assembly->lines[old++]->symbol;
+    }
+
+    names_count = referenced_names(nodes[i], names);
+
+    for (j = 0; j < names_count; j++) {
+      TrackedSymbol *symbol =
+          (TrackedSymbol *)index_lookup(&assembly->index, names[j]);
+
+      if (symbol == NULL) {
+        return false;
+      }
+
+      /* The first pass wants the elements of labeled data to be defines
+       * known by then */
+      if (nodes[i]->ASTType == DIRECTIVE && attribute == MDATA && name &&
+          (symbol->symbol.attribute != MDEFINE ||
+           !is_defined_before(symbol, first, declared, i))) {
+        return false;
+      }
+    }
+  }
+
+  for (; old < first + removed; old++) {
+    if (assembly->lines[old]->symbol || assembly->lines[old]->is_entry) {
+      return false;
+    }
+  }
+
+  return true;
+}
+
+/**
+ * @brief Replaces a range of lines by new ones, updating the state of the
+ * assembly for them.
+ *
+ * Nothing is changed when the new lines cannot be handled incrementally. When
+ * they can but turn out not to encode, the lines are still replaced and the
+ * assembly is left for a full one.
+ *
+ * @param assembly The assembly.
+ * @param first The index of the first line replaced.
+ * @param removed The number of lines replaced.
+ * @param source The source holding the new lines.
+ * @param source_first The index of the first new line in the source.
+ * @param added The number of new lines.
+ * @return true if the lines were replaced.
+ */
+static bool replace_lines(IncrementalAssembly *assembly, int first,
+                          int removed, const SourceFile *source,
+                          int source_first, int added) {
+  AsmResult *result = &assembly->result;
+  int max_lines = MAX_MEMORY_SIZE / MAX_WORD_SIZE;
+  char text[MAX_LINE_LENGTH];
+  AST **nodes = NULL;
+  TrackedSymbol **declared = NULL;
+  TrackedSymbol **moved = NULL;
+  IncrementalLine **new_lines = NULL;
+  int *new_words = NULL;
+  int moved_count = 0;
+  int moved_capacity = 0;
+  int start = 0;
+  int old_size = 0;
+  int new_size = 0;
+  int data_size = 0;
+  int address = FIRST_ADDRESS;
+  int counter = 0;
+  int offset = 0;
+  int laid_out = 0;
+  ExternalUse *old_uses = NULL;
+  int old_uses_count = 0;
+  int old_uses_capacity = 0;
+  int uses_count = 0;
+  bool is_encoded = true;
+  bool is_entry_moved = false;
+  bool is_use_moved = false;
+  int i = 0;
+  int j = 0;
+
+  if (!assembly->is_incremental ||
+      assembly->lines_count - removed + added >= max_lines) {
+    return false;
+  }
+
+  nodes = (AST **)malloc((added + 1) * sizeof(AST *));
+  declared = (TrackedSymbol **)malloc((added + 1) * sizeof(TrackedSymbol *));
+
+  if (nodes == NULL || declared == NULL) {
+    fprintf(stderr, ERROR_OUT_OF_MEMORY);
+    exit(EXIT_FAILURE);
+  }
+
+  for (i = 0; i < added; i++) {
+    read_source_line(source, source_first + i, text);
+    nodes[i] = parse_text(text, first + i + 1);
+  }
+
+  assembly->stats.parsed_lines += added;
+
+  if (!check_lines(assembly, first, removed, nodes, declared, added)) {
+    for (i = 0; i < added; i++) {
+      free_node(nodes[i]);
+    }
+
+    free(nodes);
+    free(declared);
+    return false;
+  }
+
+  /* The old lines go, and the new ones take their place */
+  start = first < assembly->lines_count ? assembly->lines[first]->offset
+                                        : result->words_count;
+
+  for (i = first; i < first + removed; i++) {
+    for (j = 0; j < assembly->lines[i]->externals_count; j++) {
+      old_uses = (ExternalUse *)reserve(old_uses, old_uses_count + 1,
+                                        &old_uses_capacity,
+                                        sizeof(ExternalUse));
+      old_uses[old_uses_count].symbol = assembly->lines[i]->externals[j];
+      old_uses[old_uses_count++].counter = assembly->lines[i]->counter;
+    }
+
+    old_size += assembly->lines[i]->size;
+    data_size -= assembly->lines[i]->data_size;
+    unlink_references(assembly->lines[i]);
+    clear_line(assembly->lines[i]);
+    free(assembly->lines[i]);
+  }
+
+  assembly->lines = (IncrementalLine **)reserve(
+      assembly->lines, assembly->lines_count - removed + added,
+      &assembly->lines_capacity, sizeof(IncrementalLine *));
+
+  if (first + removed < assembly->lines_count) {
+    memmove(assembly->lines + first + added, assembly->lines + first + removed,
+            (assembly->lines_count - first - removed) *
+                sizeof(IncrementalLine *));
+  }
+
+  new_lines = assembly->lines + first;
+
+  for (i = 0; i < added; i++) {
+    read_source_line(source, source_first + i, text);
+    new_lines[i] = create_line(text, first + i);
+    new_lines[i]->is_instruction = nodes[i]->ASTType == INSTRUCTION;
+    new_lines[i]->symbol_size = get_line_size(nodes[i]);
+
+    if (declared[i]) {
+      new_lines[i]->symbol = declared[i];
+      declared[i]->line = new_lines[i];
+
+      if (declared[i]->symbol.attribute == MDEFINE) {
+        move_symbol(declared[i], nodes[i]->ASTOpt.Define.number, &moved,
+                    &moved_count, &moved_capacity);
+      }
+    }
+  }
+
+  assembly->lines_count += added - removed;
+
+  /* The lines after the edit, and the .entry lines among them, move along */
+  if (added != removed) {
+    for (i = first + added; i < assembly->lines_count; i++) {
+      assembly->lines[i]->index = i;
+    }
+
+    for (i = 0; i < assembly->entries_count; i++) {
+      if (assembly->entries[i]->entry_line > first + removed) {
+        assembly->entries[i]->entry_line += added - removed;
+      }
+    }
+  }
+
+  /* The labels take the address of the first pass, as far as it changed */
+  if (first > 0) {
+    address = assembly->lines[first - 1]->address +
+              assembly->lines[first - 1]->symbol_size;
+  }
+
+  for (i = first; i < assembly->lines_count; i++) {
+    IncrementalLine *line = assembly->lines[i];
+
+    if (i >= first + added && line->address == address) {
+      break;
+    }
+
+    line->address = address;
+    laid_out++;
+
+    if (line->symbol && (line->symbol->symbol.attribute == CODE ||
+                         line->symbol->symbol.attribute == MDATA)) {
+      move_symbol(line->symbol, address, &moved, &moved_count,
+                  &moved_capacity);
+    }
+
+    address += line->symbol_size;
+  }
+
+  /* The new lines are encoded with the values the symbols have now */
+  new_words = (int *)malloc((added + 1) * MAX_LINE_WORDS * sizeof(int));
+
+  if (new_words == NULL) {
+    fprintf(stderr, ERROR_OUT_OF_MEMORY);
+    exit(EXIT_FAILURE);
+  }
+
+  for (i = 0; i < added; i++) {
+    if (encodes_words(nodes[i])) {
+      is_encoded = encode_line(assembly, new_lines[i], nodes[i],
+                               new_words + new_size) &&
+                   is_encoded;
+      new_size += new_lines[i]->size;
+      data_size += new_lines[i]->data_size;
+    }
+
+    link_references(assembly, new_lines[i], nodes[i]);
+  }
+
+  if (new_size != old_size) {
+    result->words = (int *)reserve(result->words,
+                                   result->words_count - old_size + new_size,
+                                   &assembly->words_capacity, sizeof(int));
+    memmove(result->words + start + new_size, result->words + start + old_size,
+            (result->words_count - start - old_size) * sizeof(int));
+    result->words_count += new_size - old_size;
+  }
+
+  if (new_size > 0) {
+    memcpy(result->words + start, new_words, new_size * sizeof(int));
+  }
+
+  result->data_count += data_size;
+
+  /* The words of the lines after move as far as the edit moved them */
+  offset = start;
+
+  if (first > 0) {
+    counter = counter_after(assembly->lines[first - 1]);
+  }
+
+  for (i = first; i < assembly->lines_count; i++) {
+    IncrementalLine *line = assembly->lines[i];
+
+    if (i >= first + added && line->offset == offset &&
+        line->counter == counter) {
+      break;
+    }
+
+    is_use_moved = is_use_moved || (i >= first + added &&
+                                    line->counter != counter &&
+                                    line->externals_count > 0);
+    line->offset = offset;
+    line->counter = counter;
+    offset += line->size;
+    counter = counter_after(line);
+  }
+
+  /* The external uses of the new lines may be the ones of the old lines */
+  for (i = 0; i < added; i++) {
+    for (j = 0; j < new_lines[i]->externals_count; j++, uses_count++) {
+      is_use_moved = is_use_moved || uses_count >= old_uses_count ||
+                     old_uses[uses_count].symbol !=
+                         new_lines[i]->externals[j] ||
+                     old_uses[uses_count].counter != new_lines[i]->counter;
+    }
+  }
+
+  is_use_moved = is_use_moved || uses_count != old_uses_count;
+  assembly->stats.laid_out_lines = i - first > laid_out ? i - first : laid_out;
+
+  /* The lines referring to a moved symbol are encoded again in place */
+  for (i = 0; i < moved_count; i++) {
+    Reference *reference = NULL;
+
+    for (reference = moved[i]->references; reference;
+         reference = reference->next) {
+      IncrementalLine *line = reference->line;
+      int size = line->size;
+
+      if (line->update == assembly->update) {
+        continue;
+      }
+
+      is_encoded =
+          encode_line(assembly, line, line->node, new_words) && is_encoded;
+      is_encoded = is_encoded && line->size == size;
+
+      if (is_encoded) {
+        memcpy(result->words + line->offset, new_words, size * sizeof(int));
+      }
+    }
+
+    is_entry_moved = is_entry_moved || moved[i]->symbol.entry_line > 0;
+    moved[i]->is_moved = false;
+  }
+
+  free(nodes);
+  free(declared);
+  free(moved);
+  free(new_words);
+  free(old_uses);
+
+  /* An image that no longer fits is left for a full assembly to report */
+  is_encoded = is_encoded && result->words_count <= MAX_IMAGE_SIZE;
+
+  if (is_encoded) {
+    list_result(assembly, is_entry_moved, is_use_moved);
+  } else {
+    drop_state(assembly);
+  }
+
+  return true;
+}
+
+void init_incremental(IncrementalAssembly *assembly, const char *name) {
+  assembly->name = name;
+  assembly->lines = NULL;
+  assembly->lines_count = 0;
+  assembly->lines_capacity = 0;
+  assembly->symbol_table = NULL;
+  assembly->index.slots = NULL;
+  assembly->index.capacity = 0;
+  assembly->index.count = 0;
+  assembly->index.last = NULL;
+  assembly->entries = NULL;
+  assembly->entries_count = 0;
+  assembly->externals = NULL;
+  assembly->externals_count = 0;
+  assembly->words_capacity = 0;
+  assembly->update = 0;
+  assembly->is_incremental = false;
+  assembly->is_direct = true;
+  assembly->source.text = NULL;
+  assembly->source.line_starts = NULL;
+  assembly->source.lines_count = 0;
+  assembly->source.size = 0;
+
+  /* An empty source is assembled like any other */
+  asm_expand(name, "", 0, &assembly->result);
+  start_update(assembly);
+  assemble_text(assembly, "", 0);
+}
+
+/* Builds the text of the lines with a range of them replaced */
+static char *join_lines(const IncrementalAssembly *assembly, int first,
+                        int removed, const char *text, long size,
+                        long *joined_size) {
+  long before = 0;
+  long after = 0;
+  long length = 0;
+  char *joined = NULL;
+  int i = 0;
+
+  if (!assembly->is_direct) {
+    before = assembly->source.line_starts[first];
+    after = assembly->source.size -
+            assembly->source.line_starts[first + removed];
+  } else {
+    for (i = 0; i < assembly->lines_count; i++) {
+      length = strlen(assembly->lines[i]->text);
+      before += i < first ? length : 0;
+      after += i >= first + removed ? length : 0;
+    }
+  }
+
+  *joined_size = before + size + after;
+  joined = (char *)malloc(*joined_size + 1);
+
+  if (joined == NULL) {
+    fprintf(stderr, ERROR_OUT_OF_MEMORY);
+    exit(EXIT_FAILURE);
+  }
+
+  if (!assembly->is_direct) {
+    memcpy(joined, assembly->source.text, before);
+    memcpy(joined + before + size,
+           assembly->source.text + assembly->source.line_starts[first + removed],
+           after);
+  } else {
+    for (i = 0, length = 0; i < assembly->lines_count; i++) {
+      long line_length = strlen(assembly->lines[i]->text);
+
+      if (i == first) {
+        length += size;
+      }
+
+      if (i < first || i >= first + removed) {
+        memcpy(joined + length, assembly->lines[i]->text, line_length);
+        length += line_length;
+      }
+    }
+  }
+
+  memcpy(joined + before, text, size);
+  joined[*joined_size] = '\0';
+
+  return joined;
+}
+
+bool update_incremental(IncrementalAssembly *assembly, const char *text,
+                        long size) {
+  AsmResult expanded;
+  bool is_replaced = false;
+  int prefix = 0;
+  int suffix = 0;
+  char line[MAX_LINE_LENGTH];
+
+  start_update(assembly);
+
+  if (!assembly->is_incremental) {
+    return assemble_text(assembly, text, size);
+  }
+
+  /* Only the lines between the first and the last that differ are edited */
+  if (asm_expand(assembly->name, text, size, &expanded) &&
+      expanded.diagnostics.count == 0) {
+    while (prefix < assembly->lines_count &&
+           prefix < expanded.source.lines_count) {
+      read_source_line(&expanded.source, prefix, line);
+
+      if (strcmp(line, assembly->lines[prefix]->text) != 0) {
+        break;
+      }
+
+      prefix++;
+    }
+
+    while (suffix < assembly->lines_count - prefix &&
+           suffix < expanded.source.lines_count - prefix) {
+      read_source_line(&expanded.source,
+                       expanded.source.lines_count - suffix - 1, line);
+
+      if (strcmp(line,
+                 assembly->lines[assembly->lines_count - suffix - 1]->text) !=
+          0) {
+        break;
+      }
+
+      suffix++;
+    }
+
+    is_replaced = replace_lines(assembly, prefix,
+                                assembly->lines_count - prefix - suffix,
+                                &expanded.source, prefix,
+                                expanded.source.lines_count - prefix - suffix);
+  }
+
+  asm_free_result(&expanded);
+
+  if (!is_replaced || !assembly->is_incremental) {
+    return assemble_text(assembly, text, size);
+  }
+
+  set_source(assembly, text, size);
+
+  return true;
+}
+
+bool edit_incremental(IncrementalAssembly *assembly, int first_line,
+                      int removed_count, const char *text, long size) {
+  int lines_count = assembly->is_direct ? assembly->lines_count
+                                        : assembly->source.lines_count;
+  const IncrementalLine *previous = NULL;
+  SourceFile edit;
+  char *copy = NULL;
+  char *joined = NULL;
+  long joined_size = 0;
+  bool is_assembled = false;
+
+  first_line = first_line < 0 ? 0 : first_line;
+  first_line = first_line > lines_count ? lines_count : first_line;
+  removed_count = removed_count < 0 ? 0 : removed_count;
+  removed_count = removed_count > lines_count - first_line
+                      ? lines_count - first_line
+                      : removed_count;
+  previous = assembly->is_direct && first_line > 0
+                 ? assembly->lines[first_line - 1]
+                 : NULL;
+
+  /* Lines of a direct source that stay whole replace the lines in place */
+  if (assembly->is_direct && assembly->is_incremental &&
+      is_direct_text(text, size) &&
+      (size == 0 || text[size - 1] == '\n' ||
+       first_line + removed_count == lines_count) &&
+      (size == 0 || previous == NULL ||
+       previous->text[strlen(previous->text) - 1] == '\n')) {
+    copy = (char *)malloc(size + 1);
+
+    if (copy == NULL) {
+      fprintf(stderr, ERROR_OUT_OF_MEMORY);
+      exit(EXIT_FAILURE);
+    }
+
+    memcpy(copy, text, size);
+    copy[size] = '\0';
+    init_source(&edit, copy, size);
+    start_update(assembly);
+
+    if (replace_lines(assembly, first_line, removed_count, &edit, 0,
+                      edit.lines_count)) {
+      free_source(&edit);
+
+      if (assembly->is_incremental) {
+        return true;
+      }
+
+      /* The lines were replaced, so they are the new source */
+      joined = join_lines(assembly, 0, 0, "", 0, &joined_size);
+      is_assembled = assemble_text(assembly, joined, joined_size);
+      free(joined);
+
+      return is_assembled;
+    }
+
+    free_source(&edit);
+  }
+
+  joined = join_lines(assembly, first_line, removed_count, text, size,
+                      &joined_size);
+  is_assembled = update_incremental(assembly, joined, joined_size);
+  free(joined);
+
+  return is_assembled;
+}
+
+char *incremental_source(const IncrementalAssembly *assembly, long *size) {
+  char *text = NULL;
+  long length = 0;
+  int i = 0;
+
+  *size = 0;
+
+  for (i = 0; i < assembly->lines_count; i++) {
+    *size += strlen(assembly->lines[i]->text);
+  }
+
+  text = (char *)malloc(*size + 1);
+
+  if (text == NULL) {
+    fprintf(stderr, ERROR_OUT_OF_MEMORY);
+    exit(EXIT_FAILURE);
+  }
+
+  for (i = 0; i < assembly->lines_count; i++) {
+    long line_length = strlen(assembly->lines[i]->text);
+
+    memcpy(text + length, assembly->lines[i]->text, line_length);
+    length += line_length;
+  }
+
+  text[*size] = '\0';
+
+  return text;
+}
+
+void free_incremental(IncrementalAssembly *assembly) {
+  int i = 0;
+
+  drop_state(assembly);
+
+  for (i = 0; i < assembly->lines_count; i++) {
+    free(assembly->lines[i]);
+  }
+
+  free(assembly->lines);
+  asm_free_result(&assembly->result);
+  free_source(&assembly->source);
+  assembly->lines = NULL;
+  assembly->lines_count = 0;
+  assembly->lines_capacity = 0;
+}
@@ -0,0 +1,134 @@
+#ifndef __INCREMENTAL__H__
+#define __INCREMENTAL__H__
+
+/**
+ * @file incremental.h
+ * @brief This file contains the incremental assembler, which reassembles an
+ * edited source by redoing only the work the edit invalidates.
+ *
+ * After an assembly without any diagnostic, every line of the expanded source
+ * keeps its parsed form, the words it takes in both passes, its place in the
+ * code image and the words it encoded to. When lines are then edited, only the
+ * edited lines are lexed and parsed again. The addresses are laid out again
+ * from the first line whose size changed, only as far as they differ from the
+ * ones of the last run, and besides the edited lines, only the lines referring
+ * to a symbol whose value moved are encoded again.
+ *
+ * An edit that could change the diagnostics or the symbols themselves, such as
+ * a line that does not parse cleanly, a symbol defined or removed, or a .entry
+ * line, is handled by assembling the whole source again, so the result is
+ * always the one of asm_assemble() without a context.
+ */
+
+#include "libasm.h"
+#include "symbol_index.h"
+
+/**
+ * @struct IncrementalLine
+ * @brief A line of the expanded source and what its last assembly left,
+ * defined by the incremental assembler.
+ */
+typedef struct IncrementalLine IncrementalLine;
+
+/**
+ * @struct IncrementalStats
+ * @brief The work done by the latest update.
+ */
+typedef struct {
+  bool is_full;       /**< Whether the whole source was assembled again. */
+  int parsed_lines;   /**< The number of lines lexed and parsed. */
+  int encoded_lines;  /**< The number of lines encoded. */
+  int laid_out_lines; /**< The number of lines given a new place. */
+} IncrementalStats;
+
+/**
+ * @struct IncrementalAssembly
+ * @brief A source assembled incrementally and the state kept from its last
+ * assembly.
+ */
+typedef struct {
+  const char *name;         /**< The name reported in the diagnostics. */
+  AsmResult result;         /**< The result of the latest assembly. Its
+                               words are the code image kept by the
+                               assembler and its source is left empty, see
+                               incremental_source(). */
+  IncrementalStats stats;   /**< The work done by the latest update. */
+  IncrementalLine **lines;  /**< The lines of the expanded source. */
+  int lines_count;          /**< The number of lines. */
+  int lines_capacity;       /**< The number of allocated lines. */
+  Symbol *symbol_table;     /**< The symbols, with their first pass
+                               attributes and first .entry line. */
+  SymbolIndex index;        /**< The index of the symbol table. */
+  Symbol **entries;         /**< The symbols of .entry lines, in table
+                               order. */
+  int entries_count;        /**< The number of entry symbols. */
+  Symbol **externals;       /**< The external symbols. */
+  int externals_count;      /**< The number of external symbols. */
+  int words_capacity;       /**< The number of allocated words. */
+  int update;               /**< The number of updates so far. */
+  bool is_incremental;      /**< Whether the lines hold the state of an
+                               assembly without diagnostics. */
+  bool is_direct;           /**< Whether the source has no macro, so that
+                               its lines are the expanded ones. */
+  SourceFile source;        /**< The source, kept when it is not direct. */
+} IncrementalAssembly;
+
+/**
+ * @brief Initializes an incremental assembly of an empty source.
+ *
+ * @param assembly The assembly to initialize.
+ * @param name The name reported in the diagnostics. It must outlive the
+ * assembly.
+ */
+void init_incremental(IncrementalAssembly *assembly, const char *name);
+
+/**
+ * @brief Assembles a new version of the whole source.
+ *
+ * The lines of the new version are compared with the ones of the last, and
+ * the ones in between the first and the last that differ are handled as if
+ * they had been edited.
+ *
+ * @param assembly The assembly.
+ * @param text The source, followed by a null character.
+ * @param size The number of characters of the source.
+ * @return true if the machine code was generated, false otherwise.
+ */
+bool update_incremental(IncrementalAssembly *assembly, const char *text,
+                        long size);
+
+/**
+ * @brief Replaces lines of the source and assembles the result.
+ *
+ * The lines are the ones of the source as the assembler reads it, which ends
+ * a line after a newline or after MAX_LINE_LENGTH - 1 characters.
+ *
+ * @param assembly The assembly.
+ * @param first_line The index of the first line replaced, from 0.
+ * @param removed_count The number of lines replaced.
+ * @param text The lines replacing them.
+ * @param size The number of characters of the lines.
+ * @return true if the machine code was generated, false otherwise.
+ */
+bool edit_incremental(IncrementalAssembly *assembly, int first_line,
+                      int removed_count, const char *text, long size);
+
+/**
+ * @brief Builds the expanded source of the latest assembly, the content of
+ * its .am file.
+ *
+ * @param assembly The assembly.
+ * @param size Set to the number of characters of the expanded source.
+ * @return The expanded source, allocated on the heap and followed by a null
+ * character.
+ */
+char *incremental_source(const IncrementalAssembly *assembly, long *size);
+
+/**
+ * @brief Frees the memory allocated for an incremental assembly.
+ *
+ * @param assembly The assembly to free.
+ */
+void free_incremental(IncrementalAssembly *assembly);
+
+#endif
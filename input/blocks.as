@@ -0,0 +1,23 @@
+; Blocks of words reserved with .space and .fill, and data, with and without
+; a label. The first pass counts the words of every data line, so that the
+; labels after one without a label still get the addresses the words are
+; written at.
+.entry END
+.entry TABLE
+.define count = 3
+MAIN:   mov  #count, r1
+        jmp  SKIP
+        .space 5
+SKIP:   lea  TABLE, r2
+LOOP:   prn  TABLE[2]
+        dec  r1
+        cmp  r1, #0
+        bne  LOOP
+        jmp  END
+        .fill 4, -1
+        .data 9, count
+        .string "ok"
+END:    hlt
+TABLE:  .fill 3, count
+        .space 2
+LAST:   .data 7
@@ -0,0 +1,3001 @@
+.define K0 = 63
+.define K1 = 49
+.define K2 = 37
+.define K3 = 28
+.extern X0
+.extern X1
+.extern X2
+.extern X3
+.extern X4
+.extern X5
+.extern X6
+.extern X7
+.extern X8
+.extern X9
+.extern X10
+.extern X11
+.extern X12
+.extern X13
+.extern X14
+.extern X15
+MAIN:   mov  r0, r1
+D0:   .string "ucwpaguqzxlbm"
+D1:   .data 7767, 6068, 1733, -6962, K2
+D2:   .string "ekikr"
+L0:   cmp  D2[K0], D1
+; generated comment line
+D3:   .string "sojwenf"
+D4:   .string "bkqxvbmqpajlc"
+D5:   .data 7324, 213, 7752, -2081, K2, -6456, 442, 1997
+D6:   .data 1612, -1905
+D7:   .data K0
+D8:   .data K3, K2, K1, 2531
+D9:   .string "nvemkweyzlhzvsu"
+D10:   .data 5209, K1, 4275, K3, 4764, -1608, -1106
+D11:   .data 1854, 3452, -7603, K3, -7192, -1925
+D12:   .string "et"
+D13:   .data 3951, 5060, -3732, -4589, -6384, 4678
+; generated comment line
+D14:   .string "mvideygcjozbjwfjlyrq"
+D15:   .data -4414, K0, 3327, 3338, 3546, 6018, -5120
+D16:   .data 2215
+D17:   .data 1100, 7467, 6446, -1228, 4585, 4644
+D18:   .data -5086, -3373, -7259, -7516, 4955, -2897, K2, K0
+D19:   .data -6574, -2132, -3615, K1
+D20:   .string "zznbrzveis"
+D21:   .data -6142
+D22:   .data -6931, 1751, K1, 917, -4671, K1, -7892
+D23:   .data -1016
+D24:   .data 4936, -6267, K3
+D25:   .string "ekqcxaeknwgt"
+D26:   .data -3479, K0, K3, K1, 7426, 4994, -5817, -6349
+D27:   .data -4086, 3173, 7492, 6406, -3625, 1934, 527
+D28:   .string "lruuyeinrrznza"
+D29:   .data -181, 4993
+D30:   .data 1005, K1, K1, -5274, 1950, K3, -5946, 3788
+D31:   .data K3, 111, -6648, -670
+D32:   .data -1804, -5891, -2536, 2979, 2423, 3658
+D33:   .data K3, 7953, -6298, -5504, K0, -5488, -5592, -5748
+D34:   .string "xhrdlzqupy"
+D35:   .string "nbadtq"
+D36:   .data K2, -2242
+D37:   .data K3, -3772
+D38:   .data K2, -2839, -4750, K0, -3917, K2, K2
+D39:   .string "zujiunlruetikyqgkmiu"
+        inc  D27
+D40:   .string "uhjky"
+D41:   .data K0, K0, -2148, K3, 4282
+D42:   .string "cidr"
+D43:   .string "nkfjo"
+L1:   jsr  D17
+D44:   .data -6564, 1526, K0, -805, -3786, 5592
+D45:   .string "vsogadjrufkwun"
+D46:   .string "agz"
+D47:   .data K0, 3842, 6455, 3771, 6038, 3758, K0
+D48:   .string "vmpsxamzipw"
+D49:   .string "ksrkllyflytp"
+D50:   .string "ipwqpttg"
+D51:   .data 6345, K2, 5980
+D52:   .data 2537, -6331, 5727, -1856, K2, -598, -4717
+D53:   .data -2277, -5577, -6914, K0
+D54:   .string "ccpzyjikemkxmkvdqob"
+D55:   .data 4005, K3, 3925, 4268, -3899, 1917
+D56:   .string "nhdjuzhnvcqgojgzj"
+D57:   .data -1625, 2835, -2467
+D58:   .data 3601, 4877, 4642, -2148
+D59:   .data -1880, 3679, K0, 5953, 4878, -6609, 2435
+D60:   .data -6310, -5911, 4193, 633
+D61:   .data -6573
+D62:   .data 2678, -6646, K0, K1, K2, K1
+D63:   .string "xcbltssgjaxbeqmbhj"
+D64:   .string "k"
+D65:   .string "hfmzut"
+D66:   .string "qvvbxxtwaueydbvfdvytq"
+D67:   .string "gv"
+D68:   .string "unelud"
+D69:   .data K2, 3336, K1, -1460, -1743, -4795
+D70:   .data 7748, K3, 3675, -1214, K3, -2618, 3841, 3333
+D71:   .string "efivdxfqpmoohe"
+D72:   .data 7325, -2937, 7035, 3193, -1761, K2
+D73:   .data 1731, 1577, K3, -874
+D74:   .string "wkdgccxwraqhxwwo"
+        mov  D46[K1], D14
+D75:   .data 5417, K0, -7245, 368, -1951, -4406
+        bne  D16
+D76:   .data -7806, 2521, K3, 6186, -6249, 7228
+D77:   .string "mwqgpqqhfod"
+.entry L0
+        rts
+D78:   .data 6266, -1076, -1779, K1, -6709, 7704
+D79:   .data K3, -28, -1179, K2, 6601, -2407, K1, -6536
+D80:   .data K0, K0, -2801, 7556, 4012, -7528, -2314, -7312
+D81:   .string "tkakusyrtltbsqwqqcvqtkty"
+D82:   .string "fajwfqtcglmhfktbw"
+D83:   .data K1, K3, K2, -733, 4918
+D84:   .string "f"
+D85:   .data -2958, K2, K3, 4360, -6152
+        add  D13, D79
+D86:   .data -1556, K2, 6970, 6224, K2
+; generated comment line
+D87:   .data 7214, 3340, -5106, K1, 4578, -4311, 696
+D88:   .data 5789, K3, 5802, K3
+D89:   .data -7226, 5237, 6163, K1
+D90:   .string "uwmq"
+D91:   .data 1438, 3288, 1389, K1, -3837, 5567, -245, -2747
+D92:   .data K2
+D93:   .data -3506, 6645, -4006, -1097, 756
+D94:   .string "hnktdkwfwjqtrooyzf"
+D95:   .string "wfkwiqviuijgazfsh"
+D96:   .data K0, 6528, -2077, -3330, -7909
+D97:   .string "yagbwnfnedunpjgg"
+D98:   .data 5731, -1266, K0, K2, -6729, 1453
+D99:   .data 3508, 7054, 7270, -6361, 4411
+D100:   .string "tyxru"
+D101:   .data 478, 599, K2, -5289, K3
+D102:   .data K2, 5549, -3719, -2288, 3193, 372
+D103:   .data 2194, -1221, -7453, K3, 3581, -5198
+D104:   .string "qxeksnexz"
+        cmp  D94, r7
+D105:   .string "vdrefvmcdb"
+D106:   .data 4458, 1669, K3, 5424
+D107:   .data K2, -5499, -786
+L2:   hlt
+D108:   .data 4855, 735, 6764, -7654, -2287
+.define K4 = 15
+D109:   .string "amcao"
+D110:   .data 5158
+D111:   .data K4, 3394
+D112:   .string "jlsmabwskosheqbbe"
+D113:   .string "miptzckf"
+D114:   .data -1833, -7335, -7978, 2207
+        jmp  D78
+D115:   .string "bpktqohtdoskeftx"
+D116:   .data K2, 6164, 318
+D117:   .string "zowmawuzlvxfmaeeqehafo"
+; generated comment line
+D118:   .string "najkrgrechwhtyzbwndgqxk"
+D119:   .string "lvtaaegfvkmdsaggnpgpq"
+D120:   .data K0, 5894, 5839, -6692, 2117
+D121:   .string "yoko"
+D122:   .data 2732, 7003, K2, K4, K3, 1433, K4
+D123:   .string "k"
+D124:   .data -419, 5040, -4730, -2805, K1, -4597, 4409
+D125:   .string "xxvufbztmiuwli"
+D126:   .string "csbnmrbvpbhrfhnnqkkji"
+        inc  D61[13]
+        red  D79
+D127:   .data -6747, -5763, 4981, 6908, K4, -1041, 4169
+D128:   .string "qsyqdqaqzqgvny"
+D129:   .data -7234, 209, -3989, -1316
+.define K5 = 18
+        rts
+D130:   .string "chlvoxazfhikrjtrth"
+D131:   .data 3160, -3731, -1069, 6607, 7313, -109, K3
+D132:   .string "erujcb"
+D133:   .string "ytyozwwbywxhktknlaqu"
+D134:   .data -418, K1, -4958, -7491, 673, K4, -1576, 7210
+.define K6 = 52
+D135:   .string "oekpiamralfbzr"
+D136:   .string "rkylsjndhtcbpocvhashuq"
+D137:   .string "haebdcywkdp"
+D138:   .data K2, 236, 6312, -669, 5721, 6213, K3
+D139:   .string "mgrwquwiuw"
+D140:   .string "ubzdsrfez"
+D141:   .string "ngyofwya"
+D142:   .data -2626, -3111, K5, K3, K6, -3665
+        cmp  #1093, #-999
+D143:   .data K1, -1565, K6, 7376, 1329, K2, -4139, -1659
+D144:   .data K4, -3821, K3
+D145:   .string "vvsrkggtmpugctjauc"
+D146:   .data -5887, 5013, -5632, K0, -6354
+D147:   .string "lstafoyfahexajkmbifxg"
+D148:   .string "jlwmvifay"
+D149:   .data 2460, 3588, -6933, 4776, 798, K2, K2, 2132
+D150:   .string "wsmwncxrty"
+D151:   .data K0, K1, -3202, 1626, K4, 2583
+D152:   .data 6462, -6862, K2, 896, -4129, -4478, -1693, K1
+D153:   .data -5172, -5695, -1220, -5087, -6721, -78, 3905
+D154:   .data -3565, 167, K5, K3, 3148
+        lea  D18[11], D148
+L3:   cmp  #-1884, r7
+D155:   .data K0
+D156:   .string "uqvdjitpfv"
+D157:   .data 7780, K6, K4, K6, 1258, 64
+D158:   .string "lcytykamdgomvyslpcvlz"
+D159:   .string "nylxagsbt"
+D160:   .data 3158, 4322, -4355, -3940, -7650
+D161:   .data -966, 7087, 6397, 7003, -6216, K5
+.define K7 = 36
+D162:   .data 6464, -5424, -7158, -5694, -2589, -1705
+D163:   .string "pwdncvuirayzeevfo"
+D164:   .data 1376, -5510, -6841, 5287, K6, 1531, K1, 2209
+D165:   .data 7110, -6840, -6703
+D166:   .data 3160, K0, -6552, 6976, -2588, 1395, 729
+D167:   .string "btcqvevtthjk"
+D168:   .data -4007
+D169:   .data 7990, 7782, 4520
+D170:   .string "rfgkqelvcqewj"
+D171:   .data -2877
+D172:   .data K3, 506, 893, 2506, K3, K4, 696, 7108
+L4:   lea  D42[11], r3
+D173:   .string "gxbsgonimmcqzkydrwtmr"
+D174:   .data 1743, K4
+D175:   .data 5118, 265, -155, 3513, -4679, 2949, 2822, K7
+D176:   .data -621
+D177:   .data K2, -3731, -990, 6034, 4159, 7577, -1699, 3440
+D178:   .data 2010
+D179:   .string "rcamgcatbv"
+D180:   .string "ycogytarcdihmwngxmtenae"
+D181:   .data 4158, -5939, 4779, -7042, 3623, -6491
+D182:   .data 3565, K2, K2, -7647
+D183:   .string "kkoqzjwpajwosijw"
+D184:   .data K3, -5453, 3727, 1686
+.entry D0
+D185:   .data K2, 5352, -5129, K5, K4
+D186:   .string "tkatvoolncvrrwl"
+        not  D19
+D187:   .data 6951
+D188:   .data -4383, -2139, -7384
+D189:   .data 1025, -4784, K2, 7359
+        clr  D83
+D190:   .data -5286, 5396, -6530, 5309, K3, 3548
+D191:   .data 5798, -2681
+D192:   .data 2259, -5742, -4383, 1817, -6159, 4184, K6, 11
+D193:   .string "ozo"
+D194:   .data 5164
+D195:   .data K4, -3437, -3963, -2497, 5210, 7501
+D196:   .data K0, K5, -859, 3850, K4, 5592
+D197:   .string "wtclnpgixd"
+.define K8 = 6
+D198:   .string "waaltpttlutqzknkhjinqhi"
+D199:   .data -6356, -6572, 3957, K6
+D200:   .string "hzsbitjuqwfxznogfxslh"
+D201:   .string "ibuballhrsbmi"
+D202:   .string "oszubxxlpvnjnsaxchpxxtk"
+D203:   .data K2, -898, K0, K3, K6, -5323, K4
+D204:   .data 1572, K7, -7256, 7042, K5
+D205:   .data K1, -223, 3966, 5244, K7, 2693, K0
+D206:   .data K8, K7, K4
+D207:   .data -6763
+D208:   .data -580, -7990, -5941, 7738, K2, -3854
+L5:   rts
+D209:   .data 6149, K1, K5
+; generated comment line
+D210:   .string "amnsdpathzhipp"
+.define K9 = 12
+D211:   .string "zkw"
+D212:   .string "tklkubzfqaqglplwnm"
+D213:   .data -7161, K6, 2079, -7928, K6, 5632
+D214:   .data 5201, 1436, K8, -6518, -499, K9
+D215:   .data -2598, K7, K9, -4623, -7151
+D216:   .data K1, 172, 7659, K5
+D217:   .data 5864, 2256, -7855, 1875, 5320
+D218:   .data -78, K7
+D219:   .string "ixtapofgmwijevtdwfz"
+D220:   .data K0, 3818, 1318, K6, 3107, 6094
+D221:   .data -7826, K9, -644
+D222:   .data -1727, -3568, -1137
+D223:   .string "onhmmnbbpiordhfevxhfay"
+D224:   .string "gbloislfghflljdvdl"
+D225:   .string "qspqitixp"
+D226:   .data 4171, K3
+D227:   .data 6596, -2595
+D228:   .data K3, K1, 4294, -4484, -2087, K9, K4, 224
+D229:   .string "vuyuxyipxqrfnyyqnsfbaui"
+D230:   .string "fscq"
+        jmp  r0
+        red  r2
+D231:   .data 409, 2263, 5012, K8
+D232:   .data 6725, 7697, K1, K1, 7215, 4613, -1386, 1102
+D233:   .string "gz"
+D234:   .string "oyvygtcmphob"
+D235:   .string "eiqbvp"
+D236:   .string "npmntxxeutk"
+D237:   .string "dtjypwcwloagrspxhvzb"
+D238:   .data 5580, -5414, 2769, -2179, -214, 2171
+D239:   .string "fwilqq"
+D240:   .string "tcclb"
+.define K10 = 3
+D241:   .data 4416, K4
+D242:   .data K3, -2835, -2701, K6, -4746, 2265, 1926
+.entry L1
+D243:   .string "eqqgiikcsmrbj"
+D244:   .data -135, K8, 3509, K4, -3969, K4, K0, K1
+D245:   .data -5266, -7954, 6094, K1, 2315, K9, 962, -7437
+D246:   .data -5167, 5765, -6299, -239, 242, K3
+D247:   .data 7087, 7594, -916, -1851, 1149
+D248:   .string "urtfolkqapermoqrbokceao"
+D249:   .string "fhqkmemkpqtojgxewxcv"
+D250:   .data 7128
+.entry D1
+D251:   .data -6249, -1503, -7470, -4235, 4738, -2306, -4650
+D252:   .data 5724, 4416
+.define K11 = 14
+.entry L2
+        mov  D245, D155
+D253:   .data K6, -1730, 1863, -2028, -2627
+D254:   .string "kqiiooiomvdw"
+.define K12 = 9
+        cmp  D142, #K1
+D255:   .data 7225, K4
+D256:   .data K0, 1507, 3793, K3
+D257:   .data -3722, -3715, -5727, -2044, -542, -7306, 1237, K12
+D258:   .data 4567, 3137, 3757, 1577
+D259:   .data -5066, -7216
+D260:   .data -7156, -2589, K10
+D261:   .data 599, 7527
+.define K13 = 59
+D262:   .string "ubudglrwsqlpezcopsiimzs"
+D263:   .data K6, 655
+; generated comment line
+D264:   .data 6690, 6270, -3183
+D265:   .data -4167, 1525, -2220, K1, K5
+D266:   .string "zorprwkndbvjjacsgeprjjr"
+D267:   .data 2539, K9
+D268:   .string "kxihufmtpcpautemdumllk"
+D269:   .data -7230, K4
+D270:   .data 3990, K9, 4442, -4299, 217, K6, 4496, -4190
+D271:   .string "zgpemyjggwrazrzjfnbp"
+D272:   .string "fgpzxbjurrw"
+D273:   .data 1940, -4368, K8, 1410
+D274:   .data -1407, K12, K4, 2127, K10, -7764, 162
+        clr  r5
+D275:   .data K2, 6343, -1244, -7243, 2622, K0
+D276:   .data K2, K8, -3007, -1370, -2403
+D277:   .data -3321, 470, K8, -7858, 2230, -2486, -3698
+D278:   .data K5, K7
+D279:   .data 2985, -6066, -3776, 4129
+D280:   .string "zzynfpozjawhcysdtbwt"
+D281:   .data 3019, K2, K6, -5437
+D282:   .string "ggmrwfaqsfpyaiugwbxtlrsm"
+D283:   .data 1481, K5, 5667, K1, -4468, 2600, -5090
+        lea  D215[8], D175
+L6:   dec  D96
+D284:   .data -4790, K0, K9, -1362, K13, 1764, 3104, -7653
+D285:   .data 2188, 1830, K9, K11, -6147
+D286:   .data -1792, 416, K12, 1326
+D287:   .data -3537
+D288:   .data -3978, 6186, K13, 5496, -4585, -7046, 7579, K5
+D289:   .data 2660, -487, 3028, 3321, 7383, 3338, -3495
+.entry D2
+D290:   .string "lrznc"
+D291:   .data -3580
+        rts
+D292:   .data K7, 6375
+D293:   .data -4365, 5055, 3492, K0, -4504, K11
+        lea  D233, D9
+D294:   .data -7895
+D295:   .string "whybticizvqh"
+.define K14 = 12
+D296:   .data -6421, 7996, -6521, -586, -627, K7, -1959
+        inc  D204[K5]
+        inc  r4
+D297:   .data -385, 163, K12, -7509, 6461, -6286, -1881, -3915
+D298:   .data K11, K8, 3323
+D299:   .string "bajgxkzetfifkz"
+D300:   .data 3441
+D301:   .data K4, -7114, -2372, -1929, 5320, -1234, -479
+D302:   .data -7265, -5057, K9
+D303:   .data 531
+L7:   bne  r6
+D304:   .string "phrktsgy"
+D305:   .data K2, K5, 5033
+D306:   .string "lbfwolmlntbbsltycftymf"
+D307:   .data -224, 3806, K7, -5538, K4, 5209, 5218
+D308:   .data 872, -6840, 2907
+D309:   .data K10, 242, 4277, 6594, K7, K6, 6128, 3260
+D310:   .string "ugxtzsjjsdisj"
+        lea  D297, r4
+D311:   .data 2887, -325, 6771, 7096, -4003
+D312:   .data -6850, -5553, 7691, -211, -6454
+D313:   .data 5149, 3294
+D314:   .data K1, -7605, 4134, -2232, -511, -3815, 1974
+D315:   .data 1969, -4299, 5640, 1439, K9, -3742, K4, -5686
+D316:   .string "cmxxx"
+D317:   .string "kgmgojy"
+D318:   .string "khectmbkrk"
+.define K15 = 53
+D319:   .data -3082, -6843, -4893, 7286, 4447, 29
+D320:   .data 2693, K10, K2, 3065
+D321:   .string "weykthopivegiutk"
+D322:   .data K11, 203, -1817, 1454
+D323:   .data K2, -5792, 4015, K5, K4
+D324:   .data -6520, 2739, -7300, K3, -5006, -6079, 4916
+D325:   .data -7652, 2613, -7059, -2912, K1, -5629
+D326:   .data 5219, -6802, K14, -7853
+D327:   .data K12, -1647
+D328:   .data -7923, 2905, 821, 5119
+D329:   .data -7156, 1334, -1355
+        not  D47
+D330:   .string "thtcpfmw"
+D331:   .data 7529, -7920
+; generated comment line
+        jsr  D282
+D332:   .data -7868
+D333:   .data K4, 395, -5699, 55, -2670, -2619
+        mov  L4, D171[13]
+D334:   .data -5359, 3735, K9, -5829, K0, 7045
+D335:   .data 7256, 3554, 5884, -975, 5303, -1965
+        inc  r1
+D336:   .data K13, K11
+D337:   .data -1161, K13, K6, -72, K1, -2692, -2335
+D338:   .string "jnwoyjzbbqshnyhdvtwib"
+.entry L3
+D339:   .data -7337, 5693, K1, 1138, 3383, 1688, -5275
+        inc  r3
+D340:   .data -2760, -2325
+D341:   .data -7721, 1172, -5131, -4772
+D342:   .data K13, K4, K15, 2381, K10, 1997, K10
+        red  r2
+D343:   .string "eu"
+D344:   .data 7033, -4074
+D345:   .data 675
+D346:   .data 542, 6368, -3228
+D347:   .data 7324
+D348:   .data 7090, -7031, K11, -6950, 839, -148
+D349:   .data 6770, 614, 7050
+D350:   .data K1, K9, K14, 7219, 2918, -3387
+D351:   .string "spxlny"
+        not  D10
+D352:   .data -3207, -3127, K13, 7464, -5685, 3760, K0
+D353:   .data -7564, 7196, -7416, 4838, -4384, K10, 1783, K4
+D354:   .data K11
+D355:   .string "nwauomytepgfqfqoji"
+; generated comment line
+D356:   .data 2810, 2840
+D357:   .string "tlgnrwatwdcarpjoaysll"
+D358:   .data -5216, 7996, -105, K3, K13, K14
+D359:   .data K1, -6903, 5041, -2639, K13, K4, -1854, 7614
+D360:   .string "rfghaegyypgwttserpidrba"
+D361:   .data 1306, K3, -7989, -2770
+D362:   .data 3651, K1, 7833, 2836, -4412, K9
+D363:   .data 3098, K15, -456, 7929, -4619, 6857, 1807, -2885
+.define K16 = 25
+D364:   .string "kbazx"
+D365:   .data -2749, K6
+D366:   .data -612, 117
+D367:   .string "wfcxdwme"
+D368:   .string "xoyfcsoyhsgahwkzj"
+D369:   .data 2428, K11
+D370:   .string "fiycjtzpmakjqd"
+D371:   .data 4802
+D372:   .data 4942, -413
+L8:   hlt
+D373:   .data K14
+D374:   .data 5977, -1292, -7772, 4862
+D375:   .string "xofupw"
+D376:   .data -2190, -5110
+D377:   .data -1529, K3, 3719, K8, -85, -1244, -2722
+D378:   .string "bmqzbmxlvh"
+D379:   .data -5997, K0, 6701, 6114
+D380:   .data K4
+D381:   .data 5224, -3305, -2915, 4625, 1815
+D382:   .data 2002, 1033, 6005, 5602, -3725
+D383:   .data 1180, 4451, 2330, -6347, K16, -288
+D384:   .data K4, -2443, 4446
+D385:   .data -1932, -7372, 423, 7183, 1436, 586, -3519
+D386:   .data K12, K0, -692, 2296, -5034, K6, 1591
+; generated comment line
+D387:   .data 7441, K11, -6707, K1, -6505, K3, K3, K8
+D388:   .data 1638, 3110, 70, K16, 1667, K2, 5562, -6741
+        jmp  r6
+D389:   .data 5545, 2762, K8, -7140, K8, -6849
+D390:   .data 4413, 6837, -5070, -746, -4771
+D391:   .string "ueqhujmgaf"
+D392:   .data K12, 3054, -2301
+; generated comment line
+D393:   .data -272, K3, -2306
+D394:   .data 3917, K5, 7954, 152, -8, 5840
+D395:   .data 5167, -4999, 4202, -1587, -6758, -6698, -3858
+D396:   .string "va"
+D397:   .data -7835, K5, -72, 456, 3453, 30, -7938
+D398:   .data K14, 7926, 4031, -4660, 1589
+D399:   .string "uyakwgoqghvs"
+D400:   .string "e"
+D401:   .string "oulrsarlqjtjaruvhy"
+D402:   .data 2409, K4, -5493, 537
+D403:   .data 4249, -2884, 2906, -5202, 6093, K16
+D404:   .data -2129, -6695, -1403, -6975
+D405:   .string "tkyansapwx"
+D406:   .string "x"
+        hlt
+D407:   .data -814, 27, -7810, 2890, -5094, -6345, K15, 5519
+D408:   .data -6974, 4790
+D409:   .data -5616, 3944, -1972, K1, -4210
+D410:   .string "aksxerjegcpnxdmccfch"
+D411:   .string "rclbbqc"
+D412:   .string "hdhi"
+D413:   .data K15, -4327, 6407, -6190, -3534, -4164, 6468
+D414:   .data 348, -3326, -5366, -5885, K14
+D415:   .data K0, 3750
+D416:   .string "yzghfqmkppdvya"
+        sub  #-1311, D171
+D417:   .data -5389, -6599, K1
+D418:   .data -5086, K1, 702
+; generated comment line
+        inc  r5
+D419:   .data -752, -1801, 7955
+D420:   .string "riifnguheccfsjey"
+D421:   .data 3928
+.entry D3
+D422:   .data K4, 4, -5446, K10, K7, 1189, 7970, 3904
+D423:   .string "lcmnkiokaagywsuz"
+D424:   .data 1397, K1, -250, -6189, -168, K0, -3146
+D425:   .data 7814, 4221, 1732
+        not  r3
+D426:   .data 1969, K7, 3736
+D427:   .data -5628, 2685, -4432, 775, K10, -6032, -6110, -2187
+D428:   .data 2004, -7081
+D429:   .string "u"
+D430:   .string "nqhumcpwhgci"
+D431:   .data K3, -3260, K11, 2297, -1813
+D432:   .string "swcvmfufqtqwporqt"
+D433:   .data -2617, K7, -7104, -5857, K3, 1392, K6
+D434:   .data 2837, -3657, -1460, 3124, 411
+D435:   .data -4388, 3032
+D436:   .string "vgzocowboxpnyhpnmrqma"
+D437:   .data K3, 967, -110
+D438:   .data -862, K12, -7184, 847, 7922, -1837, K11
+D439:   .data 6268, 4209, -1044, 2513, -4497, 7266, -6543
+D440:   .string "rltdemeanahzycaxzqpdj"
+; generated comment line
+.entry L4
+D441:   .string "lvducubcmrsthgobhfmh"
+D442:   .data 2440, 7873, K12, 976, -2416, -7779
+D443:   .string "b"
+D444:   .data K12, 2452, -2850, 6115, 5492, -7553, 2158, -7419
+D445:   .string "pumidwxhcmsllv"
+D446:   .string "shazjlspavd"
+D447:   .data 4383, -3219, -1845
+D448:   .string "guxdh"
+D449:   .string "cnarmhgzvstotm"
+.entry D4
+D450:   .string "xojwyv"
+D451:   .data K1, -3117, K8, -7241
+D452:   .string "kbpbbuqntejplzyezubwzxx"
+D453:   .data K14, K9, K15, K16
+L9:   cmp  r1, L5
+.define K17 = 14
+D454:   .string "dvpktp"
+; generated comment line
+D455:   .data 3023
+        cmp  #1509, #1286
+L10:   lea  D88, D301[K8]
+D456:   .data 6657, -3289, K15, -4630, 1005, -7110, K17
+.define K18 = 19
+D457:   .data -5134, K18, 1683, 4597, K13
+D458:   .data K4, 7001, K6, -7581, K1, K16
+D459:   .string "ujzubmnoapnls"
+D460:   .data 4999, 5763, -1307, 7746, -2197, 3662, -4779
+D461:   .string "cysnnpmxkcnvxmocythronmy"
+D462:   .data -822
+        cmp  D120[3], D66[K14]
+D463:   .data 4924, K12, 3210, -7500, -3706, -1356, 5597
+        red  D28[K12]
+D464:   .string "szdybbicnklo"
+D465:   .data -3344, -7820, -7293, 7460, -4585, K4
+D466:   .data 6634, -7382
+D467:   .data K9
+D468:   .data 5147, K10, 7907, -6209
+D469:   .string "qoyiiwzpkvwowkybo"
+D470:   .data K0, -2335, 7301, 5709, K13, -5251
+D471:   .data -3097, -6027, K15
+D472:   .data 2090, -1711, 4245, 6936
+D473:   .data -7759, -5760, K7, -1169
+.define K19 = 52
+D474:   .data 973, 727
+D475:   .data -7804, 878, -6867
+        prn  #-1575
+D476:   .string "rdjj"
+D477:   .string "cibidapx"
+D478:   .data 251, -5195, 5150, -2446, K12, K5, K14
+D479:   .data K13
+D480:   .data 6447, -4150, 3133, -5065, -5112, K0
+D481:   .string "vwyyvq"
+; generated comment line
+D482:   .data K9, 3251, K4, 637, -2309, 6793, K2, -5198
+D483:   .data 3023, 2859
+        hlt
+D484:   .data -143
+D485:   .data 5070
+D486:   .data -3300, 3524, -6811, K12
+D487:   .string "rbutm"
+D488:   .data K0, -2739, 1053, -4692, 5841, -6545, 727
+        jsr  D87
+D489:   .string "ajeaybkykfijjtvrjvjlss"
+D490:   .string "zhlrodfeadjeidiugvab"
+D491:   .string "tacs"
+D492:   .data K10, -2512, -5306, K10
+D493:   .data -6011, -431, K0, 4827, 5592, 1673, -6350, K10
+D494:   .string "kkmivlvilxmxyoxzi"
+D495:   .data -1950, 4590
+D496:   .data -4391, 1408, 3152
+        hlt
+D497:   .string "enerbqn"
+D498:   .data K7, -6465, K15, 6636
+D499:   .data 3294, -7663, -3492, -5138, K19
+        prn  #K1
+D500:   .data -1644, 960, -7970, 7320, K6
+D501:   .data K14
+D502:   .data 6221
+D503:   .data K4, K18, 6134, 7952, 1450, 1260, 5898, K3
+D504:   .string "tuxeqzibbgjjghxmedy"
+D505:   .string "jtxmsuwhnucvqgi"
+D506:   .data K3, K9, K18, 1972, 3072, 5465, -3466, 6895
+D507:   .data K4, -5862, -5802, K12, -3885, 4990
+D508:   .string "qcghuqjnyqt"
+        hlt
+D509:   .data K11, -5102, K3, -1085, 3046, 5559
+D510:   .data K13, -2319, 4140, -4836
+D511:   .data -4473
+D512:   .string "ddkntnjjdfzbntkuo"
+        red  r1
+D513:   .string "vpvqtjfftwrfiunyjah"
+D514:   .data K5, 1976, -4048, K11, K14, -2170, 962
+D515:   .string "ogrpctrhsygfsxvqkszt"
+D516:   .data -5742
+D517:   .data -1225, K17, 5375, 689
+        red  r1
+.define K20 = 23
+        bne  r7
+D518:   .string "pm"
+D519:   .string "ahyblijczinkrtmxgqrcgp"
+D520:   .string "lyfkhfumoxhl"
+L11:   cmp  D102, r4
+D521:   .data -3477, K0, 2821, 1658
+D522:   .data K10
+D523:   .string "fqpznpzjjlleulmvtfltq"
+; generated comment line
+D524:   .data -3404, 3515, -1358, 6285, K0, -3912
+D525:   .data K10, -3795, -2218
+D526:   .string "joaiqvlhhkhmafxzgolsuya"
+D527:   .data 2568, 2158, -5349, -7536, 6935, 2217, K8
+; generated comment line
+D528:   .data -7600, K10, K7
+D529:   .data -1333
+D530:   .data 5310, K17, -901, K13, 4274, 4451, 1343
+D531:   .data -5323, -6251
+; generated comment line
+D532:   .data -6150
+        hlt
+D533:   .data K14, 6057, 4670, -882
+D534:   .string "buvwkqzapymybrysymuqfr"
+; generated comment line
+D535:   .string "aiaolkfghibecxafmlw"
+D536:   .string "x"
+D537:   .data 6353, -2046, -6363, 946, 7214, -3962, K5, 3433
+D538:   .data 4255
+.entry L5
+.define K21 = 11
+D539:   .string "aabpiba"
+D540:   .string "iuzyfxjgdjropammumaso"
+D541:   .data K9, K18, K0, 1089
+D542:   .data 6528, K7, -3914, -1499, -4552, -5042, 7059, K18
+D543:   .data 2420, K21
+D544:   .data -4881, -6617
+D545:   .data 3282, 5606, -2875, K0, 5061
+D546:   .string "xdhrxxrhlzciojgw"
+        sub  D541[7], D155[9]
+D547:   .data -6818, -7539, 7077, 3549, 2852, K4, -4073, -6607
+D548:   .string "aokkpguyxiidts"
+D549:   .data -5274, 2873, -749, 4292
+L12:   jmp  r5
+D550:   .data -2188
+        rts
+L13:   cmp  #-119, r0
+.entry D5
+D551:   .data 5637, K0, 3566, K7, -3055, -5313, 5450, 4970
+D552:   .data K19, -5364, 5940, -4070, -3358, 6939
+D553:   .string "a"
+D554:   .string "x"
+D555:   .data -2934, -1216
+; generated comment line
+D556:   .string "hzxvuizpyzjnveohubgrl"
+D557:   .data 6474
+D558:   .data -7156, -7815, 5185, 3659
+D559:   .data 901, 2652, 4527, K21, -5129, -6147, K1, -1622
+D560:   .data 4, -7200, K14, 7922
+D561:   .string "xpgoyarjmesapkimmnfntkz"
+D562:   .data -799, K14, 4322, -188, 5992, 5340, K6, K4
+D563:   .string "qplwrwgrfgssnoammgfqqvfk"
+D564:   .data K20, 183, 6538, 5001, K21, -3344
+D565:   .data 2812, 53, 6184, 191, K16, 2088, -1254, -3539
+D566:   .data -4692, -529
+D567:   .data K6
+D568:   .string "ejokabajmcmnbciymicl"
+D569:   .data -2264, K16, 1238, -7239, K13, -237
+.define K22 = 55
+D570:   .data -4978
+        lea  D163, D4[13]
+D571:   .string "ercjukfbxcqayvrsu"
+D572:   .data 7184, 7691, K18, K15, K18
+D573:   .data K8, 6829, -3979, 7061
+D574:   .string "cecyeowkn"
+D575:   .data 5478, -5222, K6, 4072, -3833, -5142, -4725, K19
+D576:   .data 5652, -7607, -4220, -5079, 5639, -1862, 1545
+D577:   .data 7227, -2673, K15, K0, 2292
+D578:   .string "ssj"
+D579:   .data -1641, -4493, 2783, 7097, -4473, K6
+D580:   .data K11
+D581:   .data -2514, 1451
+D582:   .string "fltbelfyibmpgtfoaufzml"
+D583:   .data K21, -3214, 4494, K2
+D584:   .data 2813, K15, -5431, K17, K14, K11, 98
+D585:   .data 6343, -6788, -6370, 1386, -7867, -3676, -4378, -6857
+; generated comment line
+D586:   .data 1701, -4157, -4256, K15, 5071, -6385, -3603, 4776
+        add  r2, D138[2]
+D587:   .data K20, 1222, 6270, K21, -1882, -5460
+D588:   .data K3, 4687, -792, -3390
+D589:   .string "pmitpyjlljskhkfqxvrhut"
+D590:   .data -5904
+D591:   .data K8, 5145, -2595, 7211, 6049, 2264, 710, 5021
+D592:   .string "mzjikhtsolqgmpqfowzn"
+D593:   .string "mvheuwm"
+D594:   .data K19, 3641, -7393
+D595:   .data 6565, 1207, 5476, -2408, K12, K9, K11
+L14:   bne  r7
+D596:   .string "nwdmadrsukzaygae"
+        sub  D454[7], D245[K19]
+D597:   .data -6513, -3066, 3153, 5613, -511, 5569, -947, 4878
+        mov  r0, D485[6]
+        jmp  D484
+D598:   .string "wzyoifmtcughjkggym"
+D599:   .data 7323, 6006, 7694, K19, K17, -5889, K10, -7711
+D600:   .data 6981, K11, K16, K7, 1490, -365
+        rts
+D601:   .data 7759, 4109, -7784, 3525, 7848, 4588, -6853
+D602:   .data -2244, 3820, 1729, -3198, 3842, 2818, K12
+D603:   .data 6387, 5536, 7209
+D604:   .string "qwmyoyekejdivsoyoabugvdq"
+.entry L6
+D605:   .data 3453, -251
+D606:   .data 1023, K4, 7615
+D607:   .data K14
+        add  D126[K8], D397
+L15:   dec  D359
+D608:   .data 2487, 3803, 113, 493
+D609:   .data K0, 3998, -760
+D610:   .string "gdldmtxpxnifxwwpynapp"
+D611:   .data -7629, 5421, 1750, -5398, K16, K16, K1
+D612:   .string "wdnmfzpyqcfynrwmi"
+D613:   .string "bywmxk"
+D614:   .data -5113, K10
+D615:   .data K13, 4367, -5043, 5256, 6546
+D616:   .string "lxfvbsfipcdylxijchwfgj"
+D617:   .data K20, 3560, K4, 812, -6127, 6181
+L16:   rts
+D618:   .data 6331, 1058, K4, 6182, -6815, -27, K19, 3420
+D619:   .data -5209, -7956, 2294, -1930, -410, K5
+D620:   .data 1767, -2597, -5927, -6913, K0, 7300
+D621:   .data -7927, K16, -2826, K1
+D622:   .data 2268
+D623:   .data 2685, K0, 637, K21, K20, 2795, K12, -4344
+D624:   .string "a"
+D625:   .string "fnotqydftiiraioy"
+; generated comment line
+D626:   .data K3, 3101, 2658
+D627:   .data -4878, -205, -4126, K8, 3226
+D628:   .string "mbyclxutytmwhjncahwhzuz"
+D629:   .data K22, 3607, K10, 2500
+        lea  D328, D607
+D630:   .data K16, K6, 4335, 7780, 3084, -1928, -4394, -816
+D631:   .string "vascocgvpjrlcquomexyfobq"
+D632:   .string "lqvulidkszivnujhc"
+D633:   .string "ybmvq"
+D634:   .data 5142, K11, K0, 1690
+D635:   .string "uocljcnyxqu"
+D636:   .string "gtnbsxhtklamgmqo"
+        red  D557
+D637:   .data K4, -6172, -29, 6054, 3367, K8, -1165
+D638:   .data -1227
+D639:   .data -1733, -2914, -337, 2529
+D640:   .data 713, -2748
+D641:   .data 656, 1279, 3210, K15, -4312
+        clr  D625[5]
+        dec  D302[K17]
+D642:   .data 826, -489, -1836, 4965, 3625, 6220
+D643:   .data K3
+D644:   .data 1793, -1330, K7, -7664, -4792
+D645:   .string "s"
+D646:   .data 648, -4941, -6590, -775, K15, 7557, K19, K19
+.entry D6
+D647:   .data 5598, 3835, -877, -6104
+D648:   .string "kpzv"
+D649:   .string "lll"
+D650:   .data 2069, 5827, 6894, K4
+D651:   .data -4085, -5431, 2276, -4588
+D652:   .string "efxivgruluhbwrmi"
+D653:   .string "hoqltetqnrweijvvpwa"
+D654:   .data 2751, 4339, 166, -4918, 6124
+D655:   .data -4206, 7308, K13, 2396, -2860, -4328
+D656:   .data -3623, -3193, -6691, -1548, 2882, 2681
+D657:   .string "kztyqvloyvqgklizigvngyqa"
+D658:   .data K19, -305, K17, K3, 4373, 7771, K20
+D659:   .string "zzairygcwyqeukyubv"
+D660:   .data -2270, -4448, K8, -3856
+D661:   .data K5, K12, K17, K9, -5597, -2185, 5647, 7604
+D662:   .data K17, -470, -5861, -2761
+; generated comment line
+D663:   .data 6893, 6617, -774, K5, 4300, K10
+D664:   .data 2196, 2221, 6821
+D665:   .data -1549, -6803, 2513, 3460, -773, K2, -3586
+D666:   .data -5630, K13, -5538, 7027, 1495, -3694
+D667:   .data K14
+D668:   .data K9, 2621, K3, -4222
+D669:   .data K21, K4, 1086, -2337, -6231, 5786, 6653, 2634
+D670:   .data -4044, -5183
+D671:   .data K1, -6891, K9, -2968, -776, -3923, -3634
+D672:   .data 6204, K0, 1510, 6447
+D673:   .data 6215, 2883, -4246, K2, K14, 3922, K9, -948
+D674:   .data K15
+D675:   .data -3665, 4568, K7, 4622, -6979
+        lea  D631, r3
+D676:   .string "atrrnqtvvjqekatyhjyie"
+; generated comment line
+D677:   .data -1389, -5865, -755, 1257, 2910, -3912, 6338, -991
+D678:   .string "ggbjjavlthtw"
+D679:   .data 5381, 4445, -4779, -6564, K13, 5583, -3543
+D680:   .data -7648, K21, -704, 7192, 5500, K0
+D681:   .data -3485, 5278
+D682:   .data -5863, K4, K11, -4551, 5694, K2, 2252
+; generated comment line
+D683:   .data K14, -1113, K13, 2865
+D684:   .data -4524, 6846
+D685:   .string "drdrfozyzc"
+.define K23 = 36
+D686:   .data K15, -5953
+D687:   .data K1, K10, -6252, K5
+        jsr  D481
+D688:   .string "w"
+L17:   cmp  r5, D48[2]
+D689:   .data K1
+D690:   .data -5917, -6231, K5
+D691:   .data 7122, K2, -274
+D692:   .data 5719, -2763, -325, K10
+D693:   .data 1615, -2795, K15, -4926, K3, 3410, K9, K0
+D694:   .data 7352, -1337, 5720
+D695:   .data -297, K14, 3124, 2538, K10
+D696:   .data 441, -7003, K12, 6639
+D697:   .string "jsqkooaimwgcjlpizbojccp"
+D698:   .string "afqkaaibkebvihsje"
+D699:   .string "jasvwzds"
+D700:   .data 4212, 6765, 5792, 7159, K22, 2400, 658, 1509
+.entry L7
+D701:   .string "mglpfqukyxllwxoaib"
+D702:   .string "eevhiwwiasxfxnvokoceo"
+L18:   rts
+D703:   .string "wglqjqrolcotylxcnvsn"
+D704:   .data -4836
+        clr  L11
+D705:   .data -7146, K9, -7348, -440, -1917, K15
+D706:   .data -7762, K19, K13, 7493, 7373
+D707:   .data -2168
+D708:   .string "ausssxn"
+D709:   .data 7482, 3192, 3802
+D710:   .data -7454, -3517, K7, 6223, 6585, K7, 7174, K15
+D711:   .data 7954, -2015, -225, K21, -587, -3568, 6816, K13
+D712:   .data -4378, K3, 5444, -1179
+L19:   clr  r3
+        prn  #K17
+D713:   .data 5477, -3746, -5115, -7889, K13, -5523, 1113, K5
+D714:   .data 896, 1984, 7885, 3194, K21
+D715:   .data K0, 1796, -1458, -3501, 3300, -5777, -6050, 7285
+D716:   .data 6968, K0, 3244, -4241, 490, -5529
+; generated comment line
+D717:   .data 1671, -4249, -2741
+D718:   .data 2447, -6138, -3257, 3361, -6609, -4038, K4
+D719:   .data -6649, -3419, 1312, 3888, 1514, -3038, 2243, -585
+D720:   .data -6064
+D721:   .string "juwxqkjushvwdil"
+D722:   .data 2281, -3435, 6540, 6741, -3664, -2565, -2801
+D723:   .data -6673, K23, -1975, -1058, 1720, K0, 2376, 2080
+D724:   .data 1745, -4395, 6755, 3225, -7152, -194, -3115, 2721
+D725:   .data 232, 7353, 2648, -1, -3690, -2031
+D726:   .data K5, 7046, K6, 6273, 2122, K12, -117
+D727:   .string "m"
+        inc  D66
+D728:   .string "cmnesswqmsmcwejp"
+D729:   .data 7582, 5756, K5, -7796, -5106, -3100, K12, K8
+D730:   .string "hryngjkyhxpey"
+D731:   .string "hyfbrzavjdmjbqkrmmsnjrsb"
+L20:   jsr  r2
+D732:   .string "ndhwxcwczqf"
+D733:   .data 7153, -706, K12, -4646, -817
+D734:   .string "am"
+D735:   .data K7, 951, K17, -7015, K18
+D736:   .data K11, K19, K4, 6570, 3627, -43
+D737:   .data 6238, -5753, 1669, -3760
+        mov  D523, D331
+D738:   .data -231, 7322, -4262, -2918, K12
+D739:   .string "rrzovbnujygcoiyywqb"
+.define K24 = 30
+D740:   .string "emlmyvzye"
+D741:   .data 6537, -7364, 5874
+D742:   .data -6307, 4053, -5176, K10, 939
+D743:   .data 1515, 6070, K17, 7835
+        mov  D403, r2
+D744:   .data -4397, -5719, 3685, -2246, -5388, -7074, 1053, K4
+D745:   .string "rnrcfdrldahru"
+D746:   .data -6986, 4019, K13, -6709, -1742, -3654, 553
+D747:   .string "gtismdwuhjwxf"
+D748:   .data 685, 3111, 3576
+D749:   .data -635, -4758, K21, 440, -4925, -3630
+D750:   .data 6307, K10
+D751:   .string "hvrmsuuobxvhpbix"
+D752:   .string "babzensrc"
+D753:   .string "futaqzmyjqcrfohwvdaq"
+D754:   .string "npimdzcxhpjakz"
+D755:   .data -4737, 2853, K0, -2086, 479, 7680, 2061
+D756:   .data -1553, 3379
+        mov  #-1989, r3
+        cmp  D159[14], #-1107
+D757:   .data K17, -7386, 7508, 2499, -3916
+D758:   .data 3651
+D759:   .string "ahaoaufdxzs"
+D760:   .data 2379
+D761:   .string "jaggywgcauc"
+D762:   .string "hghdwtyufhqmudyoskifmu"
+D763:   .data -2752
+D764:   .string "dbreyhshfeztbtq"
+        prn  r3
+D765:   .string "yympfhezamflhcqoobvlyt"
+D766:   .data 1998
+D767:   .data -3329
+D768:   .data 7346, K7, 4413, -7119, 5116
+.entry D7
+D769:   .data -4058, -6848, -4902
+D770:   .data -1104, -7316, 7554, -5902, 4442, 1491, K10, 4492
+D771:   .string "ndywn"
+        rts
+D772:   .data 6824, 3568, -5961, -7724
+D773:   .string "kqjfclwhuqestwrxt"
+D774:   .data 1156, 2500, K12, 7954, 360, K16, -411, -1893
+D775:   .data -3580, 1734, K7, -2662, 161, 3696, -6161
+D776:   .data K5, -3454, K10, -717, 2134, 5031
+D777:   .string "grprhwqqwlsh"
+D778:   .data K11, -1696, -6815
+D779:   .data 1667, 6909, -6677, K11, -931, K4, 70, 1197
+D780:   .data -1237, K18
+D781:   .string "tm"
+.entry L8
+D782:   .data K3
+D783:   .string "znyuibvibeadamugxeeyr"
+D784:   .string "xclzhesw"
+D785:   .data -4458, -2634, 1179, -6233, K22, -4829
+D786:   .data 4136, -758
+        add  D54, D416
+D787:   .data -5853
+        cmp  #773, X3
+D788:   .string "drobepg"
+D789:   .data -4838, 882
+D790:   .data -1201, K1, -7985, K21, -1037, 2732, 1702
+D791:   .data 1064, -2095
+D792:   .data -2291, 6986, 7603, 2715, K18, -4171
+D793:   .data K2, K6, K11, K10, K7, -4883, -4911, 5055
+D794:   .data K21, 5713, -4143, 3687, -927, 4788, 6757
+D795:   .data 7058, 3490, -2620, -990, K16, 7010, K21
+D796:   .data 6944, K17
+D797:   .data K11, 7885, 6099, K3, 4822, 1337, 1510
+D798:   .data K22, K21, K19, 4024, -4194
+D799:   .data K8, 26
+D800:   .data -3435
+D801:   .data 448, K16, K22
+D802:   .string "t"
+D803:   .data -2969, -7732, -1647, 884, K9, 6131, -6134, -7051
+D804:   .string "ppdwjtguficazvlcrconxho"
+D805:   .data 6725, 5546, 3778, K1, 5868, -4138, 3808
+D806:   .string "gmooontnjfsiqogczilmnsr"
+D807:   .data 3977, K23
+D808:   .data K24
+D809:   .data 5249, -6734, -3755, 738, 3166, -1994, K8, 4761
+D810:   .data 6671
+D811:   .data -6592, 4240, 3589
+D812:   .string "cvyoecdgld"
+D813:   .data 3039, -4197, 4610, K12, K12, -7638, K24, 5924
+D814:   .data K0
+D815:   .data 6983, 4912, K10, 2406, -5803
+.entry D8
+D816:   .data -5879, 7808, -1607, 6673
+        clr  D576
+D817:   .data -4734, K8, -7513, -4659, 4348, K24, -4053, -4937
+D818:   .string "zfjjvnfgiqdmyjmjfwgl"
+D819:   .data 6931, 3591, -5414
+D820:   .data -5251, 6037, 7373, -4332, K23, -6905, 2849
+D821:   .data -6088, K18, 216, 2544, -620, K6
+D822:   .string "pjakwfmjhu"
+        jmp  r5
+D823:   .data 2724
+D824:   .data -6725, K12, 1439, K1, -5207, -5881
+D825:   .data -746, 2512, 805, 5835, -4601
+D826:   .data 804, -2324, 6941
+D827:   .data 1738, -1518, 7243, K5, K8
+D828:   .string "doiplihod"
+D829:   .data K10
+D830:   .string "yqhlktddja"
+; generated comment line
+.entry L9
+D831:   .data 1819, -4447, K6
+D832:   .data 1578, K0, -5818
+D833:   .string "zbtf"
+D834:   .data 2911, K3, 423, -1363, K16
+D835:   .string "pdgebccqj"
+D836:   .string "i"
+D837:   .string "meiprsiquvaymoxpx"
+D838:   .string "ichffuifwecawuiwskkjrp"
+D839:   .string "erkyhlgkopcwsokneyzbev"
+D840:   .data 2763, 3465, -4050, 3488, 385
+        hlt
+        clr  r0
+D841:   .data -7895
+        jsr  r5
+D842:   .data K16, -7765, K3
+D843:   .data 2827, K0
+D844:   .data 4490, -92, K20, 2555, K15
+D845:   .string "erdpvtkckkgwz"
+D846:   .string "juhkgfi"
+D847:   .data -2275, 590, -6772, 7389, K7, 2808
+D848:   .string "mpczcopfhwqeeppqs"
+D849:   .string "yknjcdcnyaqmtsvptopzf"
+.entry D9
+D850:   .data K5
+D851:   .string "ukebnirgiakczgqvrmm"
+D852:   .data -6213, -6210, -3900, -3207, 1332
+D853:   .string "hycvpndundtxsgyerijpmimx"
+D854:   .data 711, -5469, -2929, -5783, 6199, K17
+D855:   .data K8
+D856:   .string "mq"
+D857:   .data K14, -411, 1809, K7, 764, K12, K7, K4
+D858:   .string "sxr"
+D859:   .data K4, K11, -2398, -1474, K10
+D860:   .data -3219, K10, -7111, K1, K7, K17, -6574
+D861:   .string "tvliugtq"
+D862:   .string "mbej"
+D863:   .data 2975, -7367, 7815, 3538, K17, K21, 6747
+D864:   .data -2792, 4712, -5662, -5926, -2245, 3311
+D865:   .data 6312
+D866:   .string "zketewjqsdvydgbbykalzvb"
+D867:   .string "pmrlbbqwxmninp"
+        sub  #601, r4
+D868:   .string "n"
+D869:   .data -4207, -731, 715, 5906
+D870:   .string "fxvpxgvbuktleyf"
+D871:   .data -3200, -2882, K24, 958, K17, 5049, -5950
+D872:   .string "dsqomxbzlyv"
+D873:   .string "hnqwrw"
+D874:   .data -356
+D875:   .string "kmvfxqpxcfisd"
+D876:   .data -4565, K0, K13, K23, K3, -7385, -7653
+D877:   .data K21, -7385, K1
+D878:   .data 6966, -2047, -4323, 5425, 4593, -1155, 1982, K13
+D879:   .data 6187
+D880:   .string "sudnxscssdnzojmwshkdcaen"
+D881:   .string "wiwqjbx"
+        lea  D156, r4
+D882:   .data -6191, K17
+        prn  r4
+D883:   .data -6014, -1853, 2861, 5438, -4287
+D884:   .string "ebogrpvk"
+D885:   .data -5287, K3, -2708
+D886:   .data 1721, -4331, 6831, 3472, K6, -902, 4451
+D887:   .data -4693, -7609, -5362, K19
+D888:   .data -2240, -6897, K7
+D889:   .data K6
+D890:   .data -4187, K4, 6793, 109, -4747, K14, -7771
+D891:   .data -529, 4157, K1
+D892:   .data -1390, -135, 2173, -1728
+D893:   .string "aljw"
+D894:   .string "xi"
+; generated comment line
+        red  D266[13]
+D895:   .data 3862, 917, K22, 2228, K21
+        sub  r7, r3
+D896:   .data -3278, 3102, 1934, 4555, K8, -2077, 7690, 1746
+D897:   .string "aqgrygqxymf"
+D898:   .data 7959, -1678, -731, 1759, 1776, K7
+L21:   cmp  D142, D210[0]
+D899:   .string "tf"
+        clr  r3
+D900:   .data -1854
+D901:   .data -3075, 267, -2314, 2806, -3936, -3128
+D902:   .data -4784
+D903:   .string "cbxi"
+D904:   .data 5016, K6, -6948, 449, -683, K6, -3442
+D905:   .data -6741, 4370, K23, 1302, -3631, -4011, K4, 7884
+D906:   .string "npfkhimwjwmipm"
+D907:   .data 4555, 841, 7023, K6, -268, -6277, -5065, 1396
+D908:   .data K20, -394, K11, K23, K1, -7123, K8
+D909:   .data -2948, K24, 4096, -3174, K22
+D910:   .string "mnjvzmx"
+D911:   .data 3645, K2, -5762, 5568
+L22:   dec  D796[K19]
+D912:   .data 1641, K6, -3142
+D913:   .string "okd"
+D914:   .string "kql"
+D915:   .data -664, -3976
+D916:   .data 2835, 3526, 1829, K6, -6324, -761, 6675
+D917:   .data -1068, 1355
+D918:   .data K5, -2983, -1751, K11, 6152, 7979
+D919:   .string "kqhhtypquatkpaokfpeey"
+D920:   .data 7157
+.entry L10
+D921:   .data K7, K24, -2, -7464, -4942, -972, -6894, K3
+.define K25 = 59
+D922:   .string "kg"
+        jmp  D100
+D923:   .data K13, K7, K10, -1933, 6278
+D924:   .string "z"
+D925:   .data 4354, K6, K11, 664, 4616
+D926:   .data 668, 680, 3649, 3742, 3927, -2628, -6724
+.entry D10
+        bne  D764
+D927:   .string "bqwemiroubpmibj"
+D928:   .string "jkhudtos"
+D929:   .data 2190, -7905, 2257, -2768
+D930:   .data -4748, 7716
+D931:   .string "p"
+D932:   .data K25, -7528, 985
+D933:   .string "zhhbbjqwipcchihj"
+D934:   .data -6237, K5
+        jsr  D340
+L23:   hlt
+.define K26 = 50
+D935:   .data -5647, K4, K4, -6984, -4958
+D936:   .data K13, 1254, -5169
+.entry L11
+D937:   .data 2933, K25, K16, K16
+D938:   .data 811, 4419, -6824, -4262, -2042, 6081, -4224
+D939:   .data 6425, 6318, 3523, -79, -1489, 3500, K13, -933
+D940:   .data 2889, K0, K20, 7079, -1987, 3470
+D941:   .data K20, K16
+D942:   .data -7204, 1646, 2663, K17
+        red  D309[K19]
+D943:   .string "xbuennsvpnbiadgtsddx"
+D944:   .string "siexgaehqdphdhznbzcofitz"
+D945:   .data 7353, -7220, 6333, 5116, 6467, 4218, -3691, K2
+.define K27 = 58
+L24:   bne  D684
+D946:   .data -5548, -6892, 4743, -4625, -2948, 1450, -2271
+D947:   .data K11, K0, -4308, 6360, 2614, K26, -1257
+D948:   .data -7137
+D949:   .data K25
+        add  #1255, D252[K0]
+D950:   .data 4166, 4742, 6694, K25, 1251, K8, 6810, 2571
+.define K28 = 14
+D951:   .data -785, -4238, 3993, -5848, -5086, K25, 327
+D952:   .data K25, 6769, -3514, 4310
+D953:   .data -3870, -3142, K24, 7652, 7694, -4776
+D954:   .string "ywiwoxt"
+D955:   .string "oesmoybufsvcpi"
+D956:   .string "joxsxgurgnv"
+D957:   .string "et"
+D958:   .data 1206, 6862, K4
+D959:   .string "auotj"
+D960:   .data K7, K0, 4789, 5489
+D961:   .string "ikgvwxbfmbhpqdyokwyiqyc"
+D962:   .data 28, K10, K4, 4180, -4385
+D963:   .data 1317, 2665, -303, K1, 6593
+D964:   .string "hzxpeyv"
+D965:   .data 7863, -2385
+        bne  D303
+D966:   .data 5037
+D967:   .string "tdfxdvhrrrqyepeq"
+        red  D13
+D968:   .data 3391, 1915, 6695, 134, -7435, -4147, -7995, -6452
+D969:   .data -650, 3614, -5459, -7600, K17, 3184, -7736, -6356
+D970:   .data 761, -1581, 14, 6817, -7365, 5036, K12, 1553
+; generated comment line
+L25:   jmp  D647
+D971:   .data -7415
+D972:   .data 1953, 831, 3309, K1, 1494
+D973:   .data 4451, 3807, 2081, -7133, K14, K15
+D974:   .data K22, 5935
+D975:   .string "cbws"
+D976:   .string "niedvonql"
+D977:   .data K25
+D978:   .data 2336, 7653
+D979:   .data 3569, K2, -5720, 3194, 3411, 7449
+D980:   .data 2994, 3458, K20
+        jsr  r3
+D981:   .data -5333, K1, 7152, 4695, -6797, 4240
+        dec  D446
+D982:   .string "erejcglzwokobtiki"
+D983:   .string "ygorzrzuzao"
+        prn  D18[K24]
+.define K29 = 55
+D984:   .data K20, -5127, 4126, 4437, K11, 1382, 5683
+D985:   .data 3430
+D986:   .data -4851, 5070, -5911
+D987:   .data 3684, -509, 4737, 7398, -6376
+D988:   .data -365
+D989:   .string "djfarbiedcuun"
+D990:   .string "vyqndruioohjbkbek"
+D991:   .string "buoqffoguywmtzlxhkm"
+D992:   .string "kzapmrk"
+D993:   .data 3520, 1910, -2682, -2802, -1753
+D994:   .data K15, -2416, 995, K26, 1484, 1876
+D995:   .data -414, K8, K23, -1274, K23, 700, -7880, -909
+D996:   .string "nuoae"
+D997:   .data 6389, -2435, -5539, K19, K2, -5106
+D998:   .data K18, -4807, -4977, -5362, -1662
+D999:   .string "urp"
+D1000:   .string "vqzppw"
+.define K30 = 16
+D1001:   .data -6991, -5425, -7230, 1489, -1201
+D1002:   .string "vdikuejebbogozradzdt"
+D1003:   .data 4673, 3151, K2, 1153, K15, -4438, -2255, -2314
+        mov  D476, r1
+D1004:   .string "gxazyppauullytucbumye"
+        rts
+D1005:   .string "prcrxlieulezxgiizdlbsay"
+D1006:   .data -3781, K14, 67, -6379, -6262, -6785, 4941, 6571
+D1007:   .data K20, -4045, -4087, 6517, K16
+D1008:   .string "nof"
+D1009:   .data 6069, K1, K16, 4846, 1510, K10, -5362, 6996
+D1010:   .data K20, 1175, 2544, 3338
+; generated comment line
+.entry D11
+D1011:   .string "udtgzpfxucfmr"
+D1012:   .data 6551, 7579
+        cmp  r4, #K30
+D1013:   .string "brrrftqudifvjvxmjn"
+D1014:   .data -7032, -2897
+D1015:   .string "jgbwmbfaycepxukiaxioqed"
+D1016:   .data K10, 1994, 5709, -4710, K4, K9, -1912, 3860
+D1017:   .data 3586, 2767, -6684, -7029, 701
+D1018:   .string "douqhkeciuvqsvtufitosx"
+        not  X7
+D1019:   .data -4923, -478, 2251, -3282
+D1020:   .data K12, -1112, K7, 6283, 7567, K2, 4861
+D1021:   .data 978, -3847, -4738, -6602, K13, 7840, 7082
+        cmp  D157[3], D890[K11]
+D1022:   .string "cookfunmzqtoipk"
+D1023:   .data K27, K1, 2522, 1627
+D1024:   .data -1157, -3762, -5897, 6261, -3776, 1069
+        not  D240
+D1025:   .string "esobjytsvyquwrybbtcxh"
+D1026:   .data 7462, K26, K21, -1618, K20, -7320, 7784, K28
+D1027:   .string "eofvmcdjadpjyhaddqyxtb"
+D1028:   .data 1847
+D1029:   .string "xpl"
+D1030:   .data 3190
+D1031:   .data -4000, K5
+        red  r5
+        jsr  r7
+D1032:   .data -5788, 4046, 6285
+L26:   prn  #601
+D1033:   .string "ftlzqnzqqhad"
+        dec  X11
+        bne  D462
+        prn  D301[K17]
+D1034:   .data -7757, -2834, -2234
+D1035:   .string "ryeedjvzamcvextpwhqzzfsk"
+D1036:   .data -2475, 2640, 3738, 3060, -6167, 7471, -7157, 2349
+.define K31 = 25
+D1037:   .data -5664, -1112, -6738, -3434, -7185, K21, K14, -6160
+D1038:   .string "gtlmtyxrqki"
+D1039:   .data 1482, K3, -5938, 2633
+L27:   mov  D783, r4
+D1040:   .data -3714, 4414, -5906, K22, -6454
+D1041:   .data -1725, 5121, 4967, K14, -4244, -3789, 6447, -4692
+D1042:   .string "ondogdccavsbemhlacagzla"
+D1043:   .data -5722
+D1044:   .string "txlpm"
+.define K32 = 9
+D1045:   .string "yabkyeseeeyscm"
+D1046:   .string "oddwrckfhseg"
+D1047:   .data -1586, 6137, 7450
+D1048:   .string "nilqgtxde"
+D1049:   .string "znofn"
+D1050:   .data -1223
+D1051:   .data -1844, -6131, K1, 4721
+D1052:   .data 2894, K0, 1791, K22, K8
+D1053:   .string "qxksmjsj"
+D1054:   .string "xzw"
+D1055:   .string "cqjzrbdemsg"
+D1056:   .string "wfmbob"
+D1057:   .string "olmrmleexsrvwvnuhpac"
+D1058:   .data K4, -3605, -5442, K23
+D1059:   .string "smdwyesdzqfshmum"
+D1060:   .string "rvpojtlczackqiusq"
+D1061:   .string "kbqwec"
+D1062:   .data K8, -2998, 7633, -480, -993, 962, -1304
+D1063:   .data K1, 1443, 6470
+D1064:   .data -5893, K27, -303, 140, -6276, K15
+        lea  D973[7], D438[0]
+D1065:   .data 1043, 1688, K27, 1052, K5, 7473, 4490, 4113
+D1066:   .data -7571, -143, 5588, -2451, K5
+D1067:   .data K18, 7702, 332, -5975, K0, K26, 5552, 3674
+D1068:   .data K0, 894, 3239
+D1069:   .data -403, K3, K23, K5
+D1070:   .string "cxttfiaeturxrwhgntdsepj"
+D1071:   .string "veqyewdvphxf"
+L28:   clr  D30[15]
+D1072:   .data -3372, -6484, 885, -6005, 1268, -1210, 2175
+D1073:   .data 1596, 6594, 6741, K27
+        cmp  D441[K19], r0
+D1074:   .string "aepgfolnpzqtwymdqkyn"
+D1075:   .data -427, 5641, 2511, 5558, K3, -5631, 3201, 535
+D1076:   .data K26, -7939, K7, -7934
+D1077:   .data K11, -5608, -917, 5096, 7006, 3177
+D1078:   .string "u"
+D1079:   .data K24, -4035, -1597, K32, 3270, -6103, -3882
+D1080:   .data K28, K27, K1, -1176, -2354
+D1081:   .data K11, 3210
+.define K33 = 41
+D1082:   .data -1286
+D1083:   .data K6
+D1084:   .data K9
+D1085:   .data 4631, -2564, -4287, 420, K33, 2467, 6202, 1317
+D1086:   .data -5593, 618, 465, -3296, -5158, K0, -5377
+D1087:   .data K4, -1527, -5090, -1298
+D1088:   .data 26, -3278, K14, 3036, -7098, -7728
+D1089:   .data -800, K18, 1385, -165, 2589, -6086, -2200
+D1090:   .string "yledkrqyfatmxmdcyxqf"
+D1091:   .string "pcbxaapwvs"
+D1092:   .data -6356, -5104
+D1093:   .data K6, 2160, -6464, -203, -7530, -74
+D1094:   .data K22, 7566, 7191, 6116, -3827
+D1095:   .data -1742, K28, K6, -3366
+D1096:   .data K15, K30, K6, -7135
+D1097:   .string "bkadjsjv"
+D1098:   .data -7559, -1808, 7977, -2943
+D1099:   .data 5379, 3921, -7089, -7417, 2354
+D1100:   .data 1606, 5797, K24
+D1101:   .string "yfpznrtbhxlt"
+D1102:   .string "jgubgrbmy"
+        add  r7, r3
+D1103:   .data -5570, -1171, 3461, -2883, 644, K32, 119, -6383
+        rts
+.entry L12
+D1104:   .data -7800, -864, -4924, K5, 2694
+D1105:   .data -6586, 6425, 627, 3876
+D1106:   .string "nzbyakdqfjfojottvq"
+D1107:   .string "jx"
+D1108:   .string "eoqmf"
+; generated comment line
+D1109:   .string "ibizkpmrfuhmbqvk"
+D1110:   .data -224
+D1111:   .data K15, 4896, -219, -5415, K3
+; generated comment line
+D1112:   .data -7585, -6554, K7, -2518
+D1113:   .string "fwmzydkhjxhoxakuzsis"
+D1114:   .string "bjrdzthbgy"
+D1115:   .data -5417, -6691, K13, -4854, K1, 1434, K27, K8
+D1116:   .data 6240, -7249, -2176
+        red  D790[K12]
+D1117:   .data 5360, -6933, 289, 6989, K2
+D1118:   .string "cydoqosaws"
+D1119:   .data K19
+D1120:   .data 5549, K3, -4930, -1461, -7536, K19, -5778
+D1121:   .string "biwhtepotos"
+D1122:   .data -866, 3088
+D1123:   .data -2005
+D1124:   .data 7317, 7432, -6113, K32, 2056
+; generated comment line
+D1125:   .data K19, 7948, -3249, -7852, K24, K13
+D1126:   .string "duekhspoi"
+D1127:   .data K4, 958, K32, -6647
+D1128:   .data K4, K16, 5890, 7548
+D1129:   .data K21, 6236, -3208, 3182
+D1130:   .string "qstcrv"
+D1131:   .data K7, 456, K29, K9, K26, 6887, -6374, K14
+D1132:   .data 848, -4474, K32, K29
+D1133:   .data K17, K2, 1424, 6844, 3061, -4238, -7605, -2480
+D1134:   .data -2330
+D1135:   .data K10, -5391, -121, -5562, -6406
+D1136:   .data K23, 3446, 3549
+D1137:   .data -1545, 5665, K15, -1170, K33, 2655, -414, 1811
+D1138:   .data K9, -1219, 600, -2136, K13, K9, 4114, 1900
+D1139:   .data -3635, 3049, 2141, -2365, 7055
+D1140:   .data -3175, K10, -5182, -2039, 6798
+D1141:   .data K3, -171, 7681, K13, 3564, K31, K23, K27
+D1142:   .string "qbxmzskdyea"
+D1143:   .data K4, 6794, -4717, -4564, 1781, -4352, K32
+L29:   inc  D151
+D1144:   .data K12, 7855, 6863, 7411
+D1145:   .data -7145, -4402, -561, 7657, 1847, 6530, K20
+D1146:   .data 3311, -6323, 648, -6312, 82, 7114, 6187, 4191
+D1147:   .data -3112
+D1148:   .string "twcfaul"
+; generated comment line
+D1149:   .data -2946
+D1150:   .string "auzttzigl"
+        sub  D283[9], D1043[K3]
+        sub  #105, r4
+D1151:   .data -2484
+D1152:   .string "hbrthvsqne"
+D1153:   .data -6365, 893, -2384, 7105, -2784, -2297
+D1154:   .string "feramhnqggwvbwucilocwmh"
+D1155:   .data K1, -7998, -1275, 2194, K7, K10, -4544, 5132
+D1156:   .string "uixdp"
+        lea  D549, D748[1]
+D1157:   .data K8, -420, K19, -1670, -3110
+D1158:   .string "x"
+D1159:   .data K31
+D1160:   .string "svjvnutlpqljaojy"
+D1161:   .string "ldgp"
+D1162:   .data -4119, -6650
+D1163:   .data -7743, 4421, -2408, 559, K5, -4878, K13, 1754
+D1164:   .string "ugvnjdvauqwuiduzityjm"
+D1165:   .string "xobcloi"
+D1166:   .data -3898, 6933, 2739, 5318, -1745, 4077
+D1167:   .string "tdgqqetvgsvcokgphqdm"
+D1168:   .string "aslgjpdovbzolakyu"
+D1169:   .data -4560, 4735, K13
+D1170:   .data K18
+D1171:   .data 3221, K8, 249, -1315, -3867, K5, 2709
+D1172:   .data 543, -19, K26
+; generated comment line
+D1173:   .data 3177, 7405, 7472
+D1174:   .data 2793, -2440, K4, 1383
+D1175:   .data 1687, -7877, 4049, -7859
+D1176:   .data K5, 5246, 5480
+        not  D54
+D1177:   .data 4047, 1435, -3686, 3369
+L30:   jmp  r0
+.entry D12
+D1178:   .string "lepwctkigyloeibgqbbq"
+D1179:   .data 7906, -1515, 4175, -7328, K14, -251, -4063, -4384
+D1180:   .data 395
+D1181:   .data K1, -6517, K32, -5035, 3475, 1505, K24, -6006
+L31:   jsr  r3
+; generated comment line
+D1182:   .data K17, K25, -6536, -2560, 2246, 3310, -377, K15
+D1183:   .data K4, 4442, K23, -6458, 1884, 5631
+D1184:   .string "hdpzqufxg"
+D1185:   .data -4388, K33, K23, -1083, -121, -436, 5846, -6570
+D1186:   .data 1845
+        inc  D839[1]
+D1187:   .data 868, -1045, -2137, 3684, -7739, -4308, -2025
+        prn  #K13
+D1188:   .data -6357, 4956, -788, K27, -2192
+D1189:   .string "pimqujfhf"
+D1190:   .data K9, 6381, K30, -3026, -6672
+D1191:   .data K32, -660, K29
+D1192:   .data -2919, K1, 7018
+; generated comment line
+D1193:   .data -2310, -2238, 6326, -3366, -6287
+D1194:   .string "kpssnbzccv"
+D1195:   .data K13, -245, -5800, 4977, 964, 3899
+D1196:   .string "yqibzbglwonjrk"
+.define K34 = 57
+L32:   not  D1162[K27]
+; generated comment line
+D1197:   .data -1209, K10, -5030
+D1198:   .string "btnpqqqgmujahuhclwaz"
+D1199:   .data 7578, 2242, 1531
+D1200:   .data K29, 7476
+D1201:   .string "yrilu"
+D1202:   .data -3210, K34, K25, -7302
+D1203:   .string "eqgzxqpqlao"
+D1204:   .data K24, -7783, -7871, 4161, K32, K0, 7378, -6834
+D1205:   .data -4979, 4867, 2978, 1078, K30, -3644, -2877
+        inc  D1081[10]
+D1206:   .data -7958, K9, -4197, 5758
+D1207:   .data -2861, K20, 7465, 3620, -6572, K14
+D1208:   .data -3734, K3, -7672, -3127, -1467, 2585, -6561, -1269
+.define K35 = 41
+D1209:   .string "ovilrasjhtcdxrndkjrak"
+D1210:   .string "mpxuashxwbusnywawrgokjkk"
+D1211:   .string "dvjcecvcbjagqttvj"
+D1212:   .data -6346, 1265, 3120
+        sub  D1208, L3[3]
+D1213:   .data K10
+D1214:   .data -3159, 3652, 1524, -4274
+D1215:   .data 318, -4298, -2708, 1412, -3955, 7395
+        rts
+D1216:   .string "izvopqpzckmfhlzgo"
+D1217:   .string "phxjwexgjqvbzbilscyvu"
+D1218:   .string "kvzpbnzfrpsu"
+D1219:   .data -5031, -6353
+D1220:   .string "swpfokjyomdqjiarbcko"
+D1221:   .data 6760, K2
+D1222:   .data K26, 5749, -7621, K19, -2242, 4193, -2482
+D1223:   .string "kaukq"
+D1224:   .data -1818
+D1225:   .data K23, 4098
+D1226:   .data 3933
+D1227:   .string "xkcouijukvr"
+D1228:   .string "fewhxzaspyvvurzdzcfphch"
+D1229:   .data 2962
+D1230:   .data -305, -4109, K18, 4257, 4342, 3078, 595, 2381
+D1231:   .string "gwnylositpm"
+D1232:   .string "k"
+D1233:   .data -329, 626, -7574, K8
+D1234:   .string "dyjsveitkxelefokrwzvinj"
+D1235:   .string "wqbanc"
+D1236:   .string "zy"
+D1237:   .data 6773, K14, 7752, 600, -2291, 4398, 7310
+D1238:   .data K30, -2234, 3087, 3356, 6661
+D1239:   .data 5834, K4, K20, 5682
+D1240:   .data K13, K0, K12, -2727
+D1241:   .string "bwifbopb"
+.define K36 = 60
+D1242:   .data K20, -821, -2695, K28
+        jmp  D972
+D1243:   .string "oohgv"
+D1244:   .data -3299
+D1245:   .data -3479, 405, 1873, 5115, -615, -4674, K19, -278
+D1246:   .data -1568, K24, 2897, -3361, -1361, 6635, -1385, -7690
+D1247:   .data -1494, 3655, K7
+D1248:   .data -6007, 4498, -7546, K32, K22, K18, K27, K32
+.define K37 = 31
+; generated comment line
+L33:   bne  r6
+D1249:   .string "cgjdf"
+        mov  D736, L29
+D1250:   .data K28, -3951, -721, -1059, K12, 6214, K7, -3991
+; generated comment line
+D1251:   .string "shujkhvevexkjcfpkd"
+D1252:   .data K0, 5750
+D1253:   .data -5327, K5, -2646, K20, 1841, -6111
+.define K38 = 56
+.entry L13
+D1254:   .data -6181, -2488, K3, K11
+D1255:   .string "lxoh"
+D1256:   .string "jyuufuprptp"
+D1257:   .data -7852, 4967, K9, -7633, -4235, K24
+D1258:   .data 4691
+D1259:   .data K36, K8
+D1260:   .string "uxlyaselvcoqkzgiw"
+D1261:   .data 409, 3205, K10, -5681
+        jsr  X12
+D1262:   .data K10, 2024, K20, -3929, -5175, 3072, -722
+D1263:   .string "ssyzckkagfey"
+        jsr  D954
+D1264:   .string "sctmdvyxnzjubtdkvd"
+D1265:   .data K37, 6805
+        jmp  D751
+        prn  #539
+D1266:   .data K2, K23, 4923, K4, 1939, 7068, K10, -2220
+D1267:   .data -427, -7488
+D1268:   .data -166, 6036, -1330, -2640, 1774, K24, K12
+D1269:   .data 510, -233, K28, 4368, 7663, K21, 7488
+D1270:   .data 1924, 7973, -5049, -7844, -4156
+D1271:   .data K17, 3756, -7640, 2019, K32, K32, K15
+        not  D858
+.entry D13
+D1272:   .data K7, K5, -4674, 7066, K2, 6231
+D1273:   .data 1278, 754, K19, 448, -2913, 1602, 2083, K28
+D1274:   .data 268, -4095, 2556, 7905, 7423, -6286, 3969
+D1275:   .data -3885, 7271, K3, K8, 2060
+D1276:   .string "matrahbxtlfddrxjqeg"
+D1277:   .string "dkhzmonjl"
+D1278:   .string "fnfqlvoedq"
+D1279:   .string "voushlsjmmle"
+D1280:   .string "jagehaqrxghdfwmodor"
+; generated comment line
+D1281:   .string "ddvwmczuphpodeltluyrhvxn"
+D1282:   .data K36
+D1283:   .data 7609, 1701, K16, K0
+D1284:   .data 3107, 1175, 805
+D1285:   .data 4761
+D1286:   .data K19, -2306, -4668, 7871, 1104, 4342, 6313
+D1287:   .data -4601, 103, K32
+D1288:   .data -7845
+        add  D326, D951[K15]
+D1289:   .string "ctmiu"
+D1290:   .data 6961, -5707, -2365, -7943, 3696, -4578, -6475, 5889
+D1291:   .data 3784, -3559, -6216, -5665, 246, 7793
+.entry L14
+D1292:   .data K1, -2586, K22, -7711, -5718, K35, -5653
+D1293:   .string "m"
+D1294:   .string "lqbmiddnokdkkqcuiuma"
+D1295:   .data -4795, K24, 4606, 1244
+D1296:   .string "omwfgacuuvcubrwpsp"
+D1297:   .string "btamzyjhkhdlfuvjdc"
+.entry D14
+D1298:   .data K16, -2984, K15, -4549, -449, K16, 429
+.entry L15
+D1299:   .data -574, -23, -2322, 4262, K31, -4976, 1818
+D1300:   .data 2354, -124
+D1301:   .string "hfbtnycuaim"
+D1302:   .string "yzsbscrs"
+D1303:   .data K11, K30, 7818, 7819
+        lea  D192, D94[K35]
+D1304:   .data K29, K6, 7905, K23, 4852, -6940
+D1305:   .data 189, 7959
+        lea  D697[K0], r2
+D1306:   .data -3066, 7192, K17, K31, -6744, 1975, K16
+D1307:   .data K34
+D1308:   .string "rvwshfepblwfodzkyzlbloi"
+        clr  r3
+D1309:   .data -792, 1894, -2406, -4583, K8, 7129
+D1310:   .string "tblr"
+D1311:   .string "tn"
+D1312:   .data K37, 4822, 4736
+        prn  r1
+D1313:   .string "ltxvmjjecfev"
+D1314:   .data K17, 2219, -6126, -6502
+        prn  #K6
+D1315:   .data -1944, K38, 2026, 5219, 1182
+D1316:   .data 7943, 1368, K11, -5635, -6311, -6056
+L34:   clr  D460[4]
+        prn  #-1539
+D1317:   .data 7296, 2506, -2652, 5785, -929, 2875
+D1318:   .string "dsjuvzg"
+D1319:   .string "edkztgfoabou"
+D1320:   .string "xfobufbuaclznxgszxqjr"
+        mov  r7, D706[K18]
+D1321:   .data -1478, 191
+        jsr  L33
+D1322:   .string "hdruopepddxbirjiibvu"
+D1323:   .string "sonalycvduqgyrdqqqeri"
+D1324:   .string "jvjxy"
+D1325:   .string "p"
+D1326:   .string "utassqwum"
+        dec  r5
+D1327:   .data -5124, 906, 6539, -3462, K2, -7246
+D1328:   .data -1367, 6602, -7099, K23, K35, K12, -1253
+D1329:   .data -6780, 6661, K3
+D1330:   .data K31, 2895, K22, 7804
+D1331:   .data -2642, 2017, 1964, -66, K33
+D1332:   .string "q"
+D1333:   .data 2527, K14, K28, K16, -1721, K25
+D1334:   .string "ockmocxdnfrsaseo"
+D1335:   .string "vincxkovm"
+D1336:   .string "ibganqnlonvgdjeyhs"
+D1337:   .data 1755, -5458, K9, K6, 3314, K20, -1048
+.define K39 = 48
+D1338:   .string "shqyaalsnldw"
+D1339:   .data K5, K4
+D1340:   .string "ekcsxvuxioyuebgonps"
+D1341:   .string "evxbixmx"
+D1342:   .string "fdbpgyvzx"
+D1343:   .data 3201, -1092
+D1344:   .data 4008, -5673, -6110, K31, -4416
+D1345:   .data 4567, -1949, 861, 5323
+D1346:   .data 652, K35, -3807
+D1347:   .data -6705, 5836, 5917
+D1348:   .data K25, 3072, K7, K15, K7, 4230
+        jmp  D1176
+D1349:   .string "mkj"
+D1350:   .data 5678, -2089, 7312
+D1351:   .string "eqczqjxgkondbb"
+.entry D15
+D1352:   .data 6158, -375, -3960
+        red  D206
+D1353:   .data 5015, 6100
+D1354:   .data 5199, -3195, -7727
+D1355:   .data -442, -6946, 7135, -589, -6111
+D1356:   .data 1829, 3131, 3876, 5622, -4561
+D1357:   .data -5972, -4046, -5435, K10
+D1358:   .data -5261, K18, -3193, K37
+D1359:   .string "imns"
+L35:   jsr  r3
+D1360:   .data K20, -6892, -1972, -1712, 4671
+        jmp  r7
+D1361:   .data 5274, 785, -1475, 874, -2245
+D1362:   .data 1732, -1077, -1598, 3741, K11, -7352
+D1363:   .data K18, -4227, -3418
+        inc  D632[K31]
+D1364:   .data K15, -5578, 7833, -2874
+D1365:   .string "guewi"
+D1366:   .string "c"
+D1367:   .data -3040, 3623, -1223, K32
+D1368:   .data -7318
+D1369:   .string "yaixosjzkzmngghdn"
+D1370:   .string "szrcrvthwnhf"
+D1371:   .string "ecfycadnxi"
+D1372:   .data -1095, -2866, -5346, -3285, -1435, 7433, -4996
+D1373:   .string "pqwkfzuaeocmbdfxlkugs"
+        lea  D215[K30], r0
+        mov  r0, r0
+D1374:   .data 5207, -3487, -7662, 6453, -7358, 2366, -3434
+D1375:   .string "bcssurhgmluiyundkj"
+D1376:   .data K32, 1053, -3569, 2231, K23, -833, 4219
+D1377:   .string "ukuikehlezwomyejsyppu"
+.entry L16
+D1378:   .string "wbzjwl"
+        mov  r1, r1
+D1379:   .data -1613, -2047, 639, -713, 3810
+D1380:   .string "dobvemafbijptjtnlbz"
+D1381:   .data -3568, -5542, 121, K23, 7896, K7, -7095
+D1382:   .data -7577, -7750, 3011, -7450
+D1383:   .string "irfwuijduhwidu"
+D1384:   .data -7624, -6448, 3444, K29, -1994
+.define K40 = 60
+D1385:   .data -3010, -1967, K14
+; generated comment line
+D1386:   .data 5140, K13, K39, -7563, 27, K4
+        not  r1
+D1387:   .data -820, 3446
+D1388:   .data 1249, -4593
+D1389:   .data 2091, K27
+; generated comment line
+D1390:   .data K37, -4009
+D1391:   .data K24, K17, -2228, K6
+D1392:   .data 3674, -6640
+D1393:   .string "euj"
+D1394:   .data 808, -723
+D1395:   .data -3687, K4, -4272, -2846, -7813, -7679
+D1396:   .data 2042, 3722, K36
+D1397:   .string "bb"
+D1398:   .data -7915, 1260, 6847, K32, 4999, -6131, K30, -1094
+D1399:   .data -3884, -2256, K10, 4290
+D1400:   .data -7359, K35, K7, 2447, K16, -1556, 5218
+        clr  D798[K27]
+D1401:   .data -7695, K33, 5106, 6228, -2312, -5012, K12, K20
+        lea  D1335, D429
+D1402:   .string "r"
+D1403:   .data 5130, 5582, 4997, 1164, 1468, 5708, 6699
+D1404:   .string "qvmxpirlbnkzptqtpyq"
+D1405:   .string "shdrcxiuhrt"
+D1406:   .data K8, 5611, K14, K33, K16
+D1407:   .string "oavjwoaioybzl"
+D1408:   .string "gqymihaza"
+D1409:   .data -180, 1640, 2014, 6446
+D1410:   .data -3732, 4029, K17, -2472, 3947, K4, -1324
+D1411:   .data 3031, -1654, K13
+D1412:   .data -384, -74, K26, K15
+L36:   prn  D1322
+D1413:   .data -539, 5730, -581, -1984, 6624
+D1414:   .data 562, K38, -4113, 6138, 7114, -398, -7952
+D1415:   .data -4265
+D1416:   .data 7740, 7195, -4834, 3876, -5415, 4756
+D1417:   .data -2606, 7171, -2859, 6484, 1163, -929, K36, K34
+D1418:   .data 7746, -4708, 7121, K32
+D1419:   .string "pzlbdtpeikdmifelbg"
+D1420:   .data 3992, 5193, -595, -912
+L37:   prn  r0
+D1421:   .data 5730, -8, 821, K24
+.entry D16
+D1422:   .string "mqykhiouzskrfcthpcsg"
+D1423:   .data -5070, -462
+D1424:   .string "beeolsdxnmbanxtq"
+D1425:   .data -2315, 403, 6704, K21, 159, -1697, 3645, 5880
+D1426:   .data 1595, -1039
+D1427:   .data -3683, K11, K26, -4202, -1970, K36, -6922, -3588
+D1428:   .data K24, -7457, 2168, -1326
+D1429:   .data 6180, 6445, 7752, -6829, -1881, 5754
+D1430:   .string "edtjdkto"
+.define K41 = 42
+D1431:   .data -1284
+D1432:   .string "ddfflzsojctllnnyfh"
+D1433:   .string "bgotgiqlkh"
+D1434:   .string "jkskihrmacytwcmctdpbsb"
+D1435:   .data -7353, 116, 6696, K30, K16, K4
+D1436:   .string "mlftwnz"
+D1437:   .data K11, -604, -4890, -900, K30
+L38:   prn  #-713
+D1438:   .data 2186, K31, -3577
+D1439:   .string "gfnivbnruvjzyrve"
+D1440:   .data K16, -4597, 4070, -1144, 2369, -5031, 5622
+D1441:   .string "bnwrqmghsfuiifrowqaespxl"
+D1442:   .data -34, K16, K33, 1871, K5, -7887, K12
+; generated comment line
+D1443:   .data K21, K28, -4638, 3747
+D1444:   .data -861, 6070, 1439, -6819, 1256, 6805
+D1445:   .data K30, 2873, K18
+D1446:   .data K12, -6375, -4747
+D1447:   .string "mckdebvlulblctkimwu"
+D1448:   .data K11, -1040, 5808, K24, K36, -4408, -909
+D1449:   .data -7831
+D1450:   .data 2676, -1430
+D1451:   .data -5387, 685, -7584, K19, 7875
+D1452:   .data -7645, -7250, K14, 6931
+D1453:   .string "kqinrcptzn"
+D1454:   .string "nrtzyeexikvaxv"
+D1455:   .data 7365, -141, -3485, 6463
+D1456:   .data -3822, 510, 7406, 4139, K38, 3523, -7958, 2482
+D1457:   .string "ieq"
+D1458:   .string "era"
+        add  r6, r3
+        bne  r5
+D1459:   .string "zhntiiobm"
+D1460:   .data 4823, K33
+.define K42 = 37
+.entry L17
+D1461:   .data 5379, -5423, K4, -2182, K33, -4643
+D1462:   .data 1141, 3479, K32, K20
+        mov  r4, D410[K19]
+D1463:   .data 3832, K27, 5308, -7647, -7115, K0, -7570
+D1464:   .data 4747, 1778, K12, -6154, -5455, 3765, K18, 5292
+D1465:   .data 4919, -7300, -4730, 1030, 5494, K13
+D1466:   .data -4041, -7637, 7465, 3919, K18, -5292
+D1467:   .data -6887, K16, 7302, K34
+D1468:   .data 2348
+D1469:   .data 4493, K4, -371, K21, K22, -1285, K32, 24
+D1470:   .data 6748
+D1471:   .data 7638, 916
+        jsr  D542
+D1472:   .string "mwoiwsepzjuhlqd"
+D1473:   .string "nimcdqmoiclycjvqrchi"
+D1474:   .string "lgszefdilzvb"
+; generated comment line
+D1475:   .data 299, K16, 6228, 4646, -7655
+D1476:   .data 5352, 3979, -656, K28, K13, -137
+D1477:   .data -4152, -7258, 672, K22, -7625
+D1478:   .string "wsc"
+D1479:   .data -6369, K41, K28, -3874, 2488, -7918
+D1480:   .data -5752, -2428, 7514, -3574, -5710, -7317, K12, -6620
+D1481:   .data 2007, K26, 6912, -7896, -4759
+D1482:   .string "koafzqc"
+D1483:   .data 4348
+D1484:   .data 5608
+D1485:   .data -3460, -5240, 6945, -514, 6839, 2460, 4380
+D1486:   .data -1410, K41, 1787
+; generated comment line
+        rts
+D1487:   .data 1588, -5581, 502, -7689
+D1488:   .string "vifwrncm"
+D1489:   .data 7790, 3071, 3761, -5744
+.entry D17
+D1490:   .string "ts"
+D1491:   .string "pgxhakmtfcpvn"
+D1492:   .data -305, -3845
+L39:   bne  r4
+        jmp  r2
+L40:   sub  D961, D740
+D1493:   .data 1028
+D1494:   .string "dgmizhsdeybayksnkeqruyzn"
+D1495:   .data 2620, K1
+D1496:   .data 4206, -4402, -3981, 2751, K27, -5957
+D1497:   .data 1504, -7422
+D1498:   .data -882, -5725
+D1499:   .string "dkuqsohpvllj"
+; generated comment line
+D1500:   .data -5610, -3241, -7061, 1305, K19, K15, -7886
+D1501:   .string "zsgdi"
+D1502:   .data K16, 4587, 4836, 1054, 2827, -7157, K26, -3041
+D1503:   .data 1859, -2954, -2790, -3396, 7909, 1915, -3681, K14
+        lea  D1065[7], D392[7]
+        not  D745[9]
+D1504:   .data -6733, K42, -6299
+D1505:   .string "wyqxmnqutramqoxtysey"
+D1506:   .data K37, 6373, 1195, K41, -6738, -4399, 1726
+D1507:   .string "womss"
+D1508:   .string "u"
+D1509:   .data 7224, -2945, -2479, K22
+D1510:   .data 6626
+D1511:   .string "kswniubxi"
+; generated comment line
+D1512:   .data 7497, -276, K35, -4373, 6722
+D1513:   .data 2950, 1615
+D1514:   .data -1398, K2
+D1515:   .data 4775, -7326, 4068, 4477, -523
+D1516:   .string "epzjifakyxyfeomxbeygqyu"
+D1517:   .data -6939, 6210, 2352, K2
+        dec  D702
+D1518:   .string "rwb"
+D1519:   .data K36
+D1520:   .data -2119, 6570, -6643, 4314, -6378, -82, K11, -2031
+D1521:   .data -1625
+.define K43 = 51
+D1522:   .data K10, 5653, -6063, -181, -2548, K18, 7222
+D1523:   .data K15, 6231, -3885, -5510, K8, K36, 5602, K13
+D1524:   .data K32, K32
+D1525:   .string "wprew"
+D1526:   .data 7757, -864, 1654, -3077, K2, 2683, 425
+D1527:   .string "nzpmjb"
+D1528:   .data K6, 6687, -1403
+D1529:   .data 1549
+D1530:   .data 1689, -4795, -4735, 2603, 7625, -3602, K23, 26
+.define K44 = 8
+D1531:   .data 5533
+D1532:   .string "zzfhgpjc"
+D1533:   .data 3034, 2679, K19
+D1534:   .string "mfwohwswizwkwfgc"
+D1535:   .string "jxxuumhkpvwysvn"
+D1536:   .data K34, -4004, 2311, 6710, -1208, -2199, -2704
+.entry L18
+D1537:   .string "lbjfqkwiwv"
+L41:   inc  D1518
+D1538:   .string "ovrqfalatobjmtkobwifui"
+D1539:   .string "pkvtqycbbdbggftkbln"
+D1540:   .string "juzyxfdngzeqo"
+D1541:   .data -5759, -3191, -4653, 3751, 3205
+D1542:   .data 7063, K39, 479, 6053, K14
+D1543:   .string "rrcojseydarecnlsk"
+D1544:   .data 7388, -1962, K19, 4764
+.define K45 = 14
+        add  r1, D943
+D1545:   .string "sqwccwgimyaxbjczzexmsx"
+D1546:   .string "kpeciymdmmnbyviha"
+D1547:   .string "zmibebrk"
+D1548:   .data 1604, 317, -2704, 7879, K16, 2224, -2206, -1483
+D1549:   .data 6932, -745
+D1550:   .string "quhvvujyqchgpmawf"
+D1551:   .string "scocztlrbukeeaszw"
+D1552:   .data K45, 5316, 4000, -426
+D1553:   .data 4806, -7740, 7765, K9, -1808, -7485
+D1554:   .data K9, K10
+D1555:   .string "ueeazbws"
+D1556:   .data -2152, 4435, K3, K27, K32
+D1557:   .data K15, -1195, 3549, 829
+; generated comment line
+D1558:   .data 2790, 1500, K28
+D1559:   .data 1122, -2998, 5384
+; generated comment line
+.entry D18
+D1560:   .data -5966, 2579, K15, 3743, -2423, K1, 4310, K21
+D1561:   .string "smrvrfgndxniaksn"
+D1562:   .data 2870, K41, 4884, 5557
+        clr  D1235[15]
+        cmp  D238[K6], #K37
+D1563:   .data K33, 4797, -1879, K1, -2924, K15, K1, K29
+D1564:   .data K9, 3212, -2780
+L42:   lea  D965, D1310
+D1565:   .data K15, 913, K30, K41, K23, 1066
+D1566:   .string "tjhkeypcjfvypubdpuqhpnph"
+        not  D1459[7]
+D1567:   .string "ibyvunolpypctopunjinsa"
+D1568:   .data 2740, -6097, -4800, -6042, -4711, K2, 57
+D1569:   .string "cmdnypnhlqyfwhqv"
+.entry L19
+D1570:   .string "oxyasxgkatmnzthv"
+        jmp  D165
+D1571:   .string "tzsbjkcdpucdym"
+D1572:   .data -6954
+D1573:   .string "awwqzfawigzyauwbnrfmzomf"
+D1574:   .string "utq"
+D1575:   .data -1932
+D1576:   .data 4706, 6575, -3516, 7531, -7907
+D1577:   .data 1884, 4446, -2636, K20, K24, 708
+D1578:   .data 4755, -245, 7568, 2549, -6024, K31, 4023, 5102
+D1579:   .data 3330, -1877, -7410, 3861, 7044, -6178
+D1580:   .string "dzcjagfddagg"
+; generated comment line
+D1581:   .data 7830, K16, 4608, 6410, -4684, -7231, 6414
+D1582:   .string "sfb"
+D1583:   .string "sgcogyhuny"
+D1584:   .data K8, -6546
+D1585:   .data K1, K44, -2758, 6203
+D1586:   .data -1573, -2258, 7255, 469, -1632, 141
+D1587:   .string "cwlhqqrguuuzdqpenok"
+D1588:   .data -4205, -5285
+D1589:   .string "pubkqqwski"
+D1590:   .data -4536, -3768, K22, K44, -5728, -3701
+.entry D19
+D1591:   .data 3489
+D1592:   .data -52, 5378
+D1593:   .data -4435, -1115, 4888, K31, -1669
+D1594:   .data 4859, 7878, K28, -3541
+D1595:   .string "ua"
+L43:   add  D723, r3
+D1596:   .data 5525, 6554, K11, -2298, -5584, -5465, K34, 1289
+        inc  D591[K3]
+D1597:   .data 6422, 3398, -7997
+D1598:   .data 6203, -6027, 1246, 4914, K44, K31, K28
+.entry L20
+D1599:   .data K9
+D1600:   .data -7697, 2186, -2435, -4617, 6472, K22
+D1601:   .string "hekons"
+.entry D20
+D1602:   .data 6223, K9
+D1603:   .string "uttnrzheiygez"
+D1604:   .string "jpadihutarfmvyfi"
+D1605:   .string "vkfiytaypkgf"
+D1606:   .data K29, 3782, K32, -4467, -7459, -5140
+D1607:   .data 5033, 749, K30, 3940, 6038, 4815, -4619
+D1608:   .data 3614, 4430, K0, 3882, 5033, 1919, 323
+D1609:   .data K30, -7348, -7789, -4465, -3188, -3027, 3412, 3199
+D1610:   .string "gemjihgmlxecsurvcyiebe"
+D1611:   .data 2159, -4283, -6767, K42, -7653
+D1612:   .data 1718, 7992, 6140
+D1613:   .string "acwdzbclx"
+.entry L21
+D1614:   .string "ullgoudowwumzqwrbwz"
+        lea  L37[4], D479[K8]
+D1615:   .string "boxn"
+D1616:   .data 6188, 3821, K30, 4561
+D1617:   .data -6866, K29, 5215, K6, K38
+D1618:   .string "kfcigncxakklfeig"
+D1619:   .data -3699
+D1620:   .data K22, K22, -6474, 6864, -7190, 6188, -2230, K13
+.define K46 = 19
+D1621:   .data 2258, 7088
+D1622:   .data -1765, K38, 4140, K35, K19
+D1623:   .data 5187, -4808
+D1624:   .data 226, K15
+D1625:   .data K5, -112, -1984
+D1626:   .data 1524, 5696, -743, 7094, -4689, 4180, -236
+; generated comment line
+D1627:   .data K12, 6163, -4930, 6574, 118, -364, 2390
+D1628:   .data -5138, -2129, K31, 4347
+D1629:   .data 4125
+D1630:   .data 6787, 1318, -5897, -1175
+D1631:   .data -4559, -7956
+D1632:   .data -7400, -4665, -1262, K5, -2384
+D1633:   .string "dfjt"
+D1634:   .data -4488, K20, -5892, K46
+; generated comment line
+D1635:   .data 7935, 1660, -5555
+D1636:   .string "kjdkcfefwftmsgzfqxmaxw"
+D1637:   .data -2814, K6, 7134, -2681, -4544, -1623, 5844
+D1638:   .data K32, -922, -6650, 363
+D1639:   .data 6866
+D1640:   .data -905, K26, 3519, 3185
+L44:   red  D288[6]
+D1641:   .string "edfbdnvyp"
+D1642:   .string "verfmtk"
+D1643:   .data K6, -6934
+D1644:   .data 3494, 1375, K4, 4063, K7
+; generated comment line
+.define K47 = 43
+D1645:   .string "dtuqrpcztvtq"
+D1646:   .data -1100, -5731, 5619
+D1647:   .data K4, -5948, -4740, 2944, 5871
+D1648:   .string "jdzjcqxqpxhjbmvrum"
+D1649:   .data -7685, 5490, 973, K11, 2424
+D1650:   .data K34, 5485, -2410
+D1651:   .data -1204, -7476, -3585, 1319, 4468, 1378, -2279
+D1652:   .string "wrkgwswggcuoizfhutrazwa"
+D1653:   .string "gqzooakwf"
+D1654:   .string "xepmbmmf"
+D1655:   .data K19, -3325, -614, 3461, 4673
+D1656:   .data -7094, -5967, -3200, -5958, K28, 4319, 2394, 1948
+D1657:   .data -5122, 3406
+D1658:   .data -2054, -7278, K30, 3004, -6234, 2352
+D1659:   .data 6848, K38, 6985, -7621, -7171, 6938, 1864
+D1660:   .data 3875, K37, 3653, K14
+D1661:   .data K23, K39
+D1662:   .string "kvlsfruppi"
+D1663:   .string "xigznvyigwvfsmv"
+D1664:   .data -4971
+D1665:   .data -3517, -4412
+D1666:   .data -961, -5529, K15, -3089, -1621, 786
+D1667:   .string "awyutzufe"
+D1668:   .string "wtiethaclhoplrmloptwa"
+D1669:   .string "xu"
+D1670:   .string "dzklrfjuemuh"
+        prn  #K5
+D1671:   .data -4687, -483, 6681, 1027, -31, 4422, K35, 1650
+D1672:   .data 4296, K15, -6727, -3961, -5097, 3347, 2303, 3102
+; generated comment line
+D1673:   .string "jtu"
+; generated comment line
+D1674:   .data 406, -6939, -184, K28, 7528, -4992, -7516
+.entry D21
+D1675:   .data -623, -597, 6310, -3207, 2643, -508, K4, 3433
+D1676:   .string "osfezbh"
+D1677:   .data -7999
+D1678:   .string "jxtltrkccgwhx"
+D1679:   .data -5494, -7254, -1292, 7868, -5267, K1, K15, 7367
+        dec  D353
+D1680:   .data 256, -7547, -4807, K25, -2638, K28
+D1681:   .data -6970, K47, 4746, 5989, -2935, K28, -6976, -5294
+D1682:   .data -7840, -4342, 7210, -7622
+D1683:   .string "kfnvvpdxrx"
+D1684:   .data K7, -2761, 317, K23, 6250, K27, 4090, K17
+D1685:   .data 6834
+D1686:   .data -4495, K46, K36, 4543, K38, -4836, -7406
+.entry L22
+D1687:   .data -4405
+D1688:   .string "bkwxdvqybgweomsoqoq"
+D1689:   .data -618, 7053
+D1690:   .data 951, -7418, K24, 3198, 1126, 5370, -1730
+D1691:   .data K5, K45
+D1692:   .data -167, -3714, 7792, -7983
+        hlt
+D1693:   .data -3797, K7, 6040, 953
+D1694:   .data 7661, -360, -2166
+.entry D22
+D1695:   .data 692, K36, K17, 923, K47, K34, K9, 6915
+D1696:   .data 2123, K8, -4322, K4, -1815, -6851, 232
+D1697:   .data 2274, -5796, -5674, -3336, 5110, K47, K31
+D1698:   .data 358, 1343, K47, -4680, 87, K21, 7336
+D1699:   .string "testxlskoorlmkdwomaft"
+        cmp  #-1085, #K6
+D1700:   .data 7378, -7637, 1456, -2608, K2, 3550
+D1701:   .string "w"
+D1702:   .data 1658, -6750, 800
+D1703:   .data 3911
+D1704:   .string "lkjjjy"
+D1705:   .string "beojrtvq"
+D1706:   .data -2553, K37
+D1707:   .string "kqwmpohvuocxlmdzdpzbxddd"
+D1708:   .data 3449, K8, -3806, -7703, 5230
+        dec  D222
+D1709:   .data -180, K27, K19, K27, 7634, -24
+D1710:   .string "zgmrsgemnwywx"
+D1711:   .data 1932, -4011, 4832, K40
+D1712:   .data -6110, 4258
+D1713:   .data 2492, -1698, 298, 3845, -6044, 7846, -6921, -3282
+.define K48 = 24
+D1714:   .data -6558, K38, K12, -4245, -3583, 3885, K0, K2
+D1715:   .string "fbmzozejmnrgjwivocl"
+D1716:   .data -136, -7714, 1745, K6, -5391, 7773, -2412, 5789
+D1717:   .data 2089, -2618
+L45:   inc  r7
+D1718:   .string "cxckuxuwirgpjlthvvzjkutw"
+D1719:   .data -3709, -1827, 2704, 3489, -7808, 1639
+D1720:   .data 5200, -6386, K21, 5774, K38, -5751, 402
+D1721:   .string "zqq"
+D1722:   .data -1709, -4736, -6322, -2459
+D1723:   .data K37, K29, 7200
+D1724:   .data 5684, -2438, -6137
+D1725:   .data -4506, 3076, K29, -5100, -4650, 7148, K48, K10
+D1726:   .string "xbgnedswhffyqnidvipzz"
+D1727:   .data -6527, -3315
+D1728:   .data -5994, K38, 3707, 7510, 3832
+        jmp  D1712
+D1729:   .data -1243, 4728
+D1730:   .data -446
+D1731:   .string "daaiucarrd"
+D1732:   .string "qsyegzmhilghauj"
+D1733:   .string "vsbmabybzkvjktrycjmna"
+D1734:   .string "tgimwbbqehqkeg"
+D1735:   .data -7870, -6718, K17
+D1736:   .data 7475, -6816, 1897
+D1737:   .string "usaekaaemhjelwwokevccfdu"
+        add  D1163[K0], D1077[K45]
+.entry L23
+; generated comment line
+D1738:   .string "wnnddcfvnnouwinkn"
+D1739:   .data -2367, -6118, -2261, 1527, -741
+        jsr  r2
+D1740:   .data 222, -5944, -7937, K39, 7649, -5074, -689, 6691
+; generated comment line
+D1741:   .data -2551, 7041, 5785
+D1742:   .string "erdkfimzsokingeqh"
+D1743:   .data -846, 6635
+D1744:   .string "kdc"
+D1745:   .data K12
+D1746:   .string "vauyfm"
+D1747:   .string "gxcnppyujh"
+D1748:   .data -1336, 5970, 1388, -4191, 4519, -6845
+        inc  D145
+D1749:   .data K13, 5027, -2573, 4756, 7036, -2083
+D1750:   .string "omffmvibhm"
+D1751:   .data 4091, -4126, K5, 4838, -1247, -7259, K28, 5020
+        inc  r5
+D1752:   .data 3126, -5210, K0, -6526, -4799, 4055, -5413
+D1753:   .data K26, 6468, 7115, -6649, -956, 7461, -7284, -7817
+D1754:   .data K41, K15, 3133, K32, 3389, K16
+D1755:   .string "jccqyjaqggtljvyp"
+D1756:   .string "jzmazcycqgcq"
+D1757:   .data K38, 3403, 4493, -4892, 3762
+L46:   add  D1038[10], D911[K15]
+D1758:   .data K22, K6, K0, 2979, -1834, 7349
+L47:   prn  D1292
+        inc  r3
+        clr  r6
+D1759:   .string "dmtkenlnqs"
+D1760:   .string "xlcbygmhmpimunlwwgaycx"
+L48:   hlt
+        bne  D1384
+D1761:   .string "wzekhivitsbgmner"
+D1762:   .data 916, 3079, K43, -6992
+D1763:   .string "pvniiuoptwmzcmy"
+L49:   dec  r0
+D1764:   .data -6164, -4872, -2287, -6162, 1959, -756, -6644
+D1765:   .data -1618, K17, 5163
+D1766:   .string "giiogxkyhxsadlurdlad"
+D1767:   .data -1520, 3989, -1325, -7962, 1941, 2611
+D1768:   .string "vfyygctw"
+D1769:   .data -5512, 3085, K12, 6051, -6561, 7851, -5275
+D1770:   .data K39
+D1771:   .data -7186, 1941, -6150, 4695, -7660
+D1772:   .data 1533, K7
+D1773:   .data -6732
+D1774:   .string "rqoyptuvqwzugcafkemzqotr"
+D1775:   .data -5524, K29
+D1776:   .data -930, -1218, -3357, 3247, K22, 1835
+D1777:   .data 6928, 5810
+D1778:   .data 3454, 6163
+D1779:   .data -6994, K7, K10, 3415
+        jmp  D261
+D1780:   .data 199, -1701, 5641, K38, K28, -6366, 4282
+D1781:   .data -4361, K33, 6519, K29, -7653, -2412, 6350
+D1782:   .data -720, 7449
+.define K49 = 30
+D1783:   .string "maxylybblfwrwwazkuat"
+D1784:   .string "vrvfppzaczwhbvbb"
+D1785:   .data K8, 5077, K42, -7462
+D1786:   .data K35, -1456, 6883, -736, 4822, 5153
+D1787:   .string "wfyuaapth"
+D1788:   .string "iwlvtkanqyewwaksukqdzpen"
+D1789:   .string "uexvicctqc"
+D1790:   .string "lmsln"
+.define K50 = 23
+D1791:   .data -6151, -4452, K5, -3685, 5746
+        jmp  D1773
+D1792:   .data 6904, -6286
+D1793:   .string "hlozkcbh"
+D1794:   .data 838, 3725, -2382
+D1795:   .data -6341, K49, 7358, K7, -922
+D1796:   .data 5918
+D1797:   .string "dnmqqymejivk"
+D1798:   .string "ucvotetqbwspelhupxavju"
+D1799:   .data 6366, K23, 321, K41, K1, 7381, K9
+        dec  D1150
+D1800:   .data -3204, K42, -7770, 2543
+D1801:   .data -1145, 1795, -1750, K4, K7, 7954, K4, -4724
+D1802:   .data K2
+D1803:   .data -7825, -7656, K35, -1074, -2307
+D1804:   .data 1297, 200, -831, -1063
+D1805:   .data 7675, 137, 5447, -1601, 2474
+D1806:   .string "dej"
+.entry D23
+D1807:   .data -771
+D1808:   .data -5559, -779, -3279, 7003, -7943, -4706, K27, -4150
+D1809:   .string "lekrdjqzlvbfodpu"
+D1810:   .data 7690, -6105, K26
+D1811:   .string "kzawvsca"
+D1812:   .string "gqrsonvap"
+D1813:   .string "wodqzjwgenn"
+D1814:   .data K19, 2572, 3383, 2406, 6520, -5095, -2400
+D1815:   .data -1649, -6467
+D1816:   .string "waxhfzr"
+D1817:   .data -3789, K37
+D1818:   .data K1, K41, -6657, 5807, 7728, -5512
+D1819:   .data K44, 4056, -3683, -2287, K13
+D1820:   .data K30
+D1821:   .string "oyvjedhvrgqlcrsbhp"
+D1822:   .data -5794, -6269, -5052, 2033, -5383, -5181
+D1823:   .data 5277, -3660, 2503, K16, -369, 6229, K40, -5886
+D1824:   .data 3708, -104, K33, -1494
+D1825:   .data -5111, K34, K1, -5993, K36, 7924, -726
+D1826:   .data -3837
+D1827:   .string "nqcjpruufowaksgqaaw"
+D1828:   .data 1198, -1307
+D1829:   .string "ahrycgn"
+D1830:   .data -3662, 6454, -595, -2700, -5276, -2380, -7341
+D1831:   .data -1375, K50, -1400
+D1832:   .data 7476, -4179, -5664, 5687, K18, 2080, 7378, 421
+        add  #-324, D1311[12]
+        sub  #289, D1065
+D1833:   .string "ecvbo"
+D1834:   .string "kkvtxnjusgwyspo"
+D1835:   .data K35, 1716, 4240, 6982
+D1836:   .string "empgdrullmhncwxgjmalpx"
+D1837:   .string "oxxqkdi"
+D1838:   .data -7229
+D1839:   .string "rsuww"
+D1840:   .data 1541, 3341, 3693, K5, K24, 7966
+D1841:   .data K14, -7287, -4897, 3038, -7214
+D1842:   .string "qvn"
+D1843:   .string "zwxjto"
+D1844:   .string "zkitbfxw"
+.define K51 = 34
+D1845:   .data 7091, 3655, K14, K8, -3348
+D1846:   .data 1060, 409, K9
+D1847:   .string "fxphffhcwg"
+D1848:   .data 2234
+D1849:   .data 6597, -7313, K41, -1747, 25, K49, 6148
+D1850:   .string "lgjhwqkvbmlqsveim"
+D1851:   .data K34, 4866, 5195, 1188, -7635, 6776, K28
+D1852:   .data -1382, -294
+; generated comment line
+; generated comment line
+.entry L24
+D1853:   .string "bwlzlynwthjiavd"
+D1854:   .string "lcqygcnhzpfrcrod"
+D1855:   .string "hjgdwnubart"
+D1856:   .data K7, 222, 4004, 31, 3632, -5418, 5513
+D1857:   .data 6503, 5191, K38
+.entry D24
+D1858:   .string "tppriqlqv"
+; generated comment line
+D1859:   .data -3349, K8, K21, K46, K19, K27, -3183, -4203
+D1860:   .data -4678, K13, 1605, -5403
+D1861:   .data 3487, K30, 1553, K6, 3798, -122, 3272
+D1862:   .data -5201, -2612, 1762, -2291, -6764
+D1863:   .string "kiawjdzfmrqmdvzyqxqm"
+.define K52 = 23
+D1864:   .string "msixjlezdwfmshzmkkl"
+D1865:   .string "oiniq"
+D1866:   .string "luxgwftjqqpcrxkvzxn"
+D1867:   .data 4734, -4731, -7180, 2382
+D1868:   .string "dpghimrrxyuy"
+D1869:   .data -2098, -2682
+D1870:   .data K12, -5718, K9, 2834, -1948, K20, -3027, -5313
+D1871:   .data 4422, K50, K21, 4983, K46, 4697, K0
+D1872:   .string "klazicrqzjiljoxriwtavc"
+D1873:   .string "bqymkdxeybeyqo"
+D1874:   .data 4890, -678, K50
+D1875:   .data -3157, 2456, -1823
+D1876:   .data -2634, K15, K45, -4034, K52, 3832, -5256, K27
+D1877:   .data K16, -6611, K15, 4497, 1077, -2179
+L50:   jsr  r4
+D1878:   .data -3099, K20, 5959, 5685, -4013, -1365, 1910, K36
+; generated comment line
+D1879:   .data K33, 6073
+D1880:   .data -1387, 7713, 573, 3911
+L51:   bne  D611
+D1881:   .string "lycbvnovttddmvveehap"
+D1882:   .data K36, 267, -782, 4986
+D1883:   .string "eecroyudmofbcbdxygi"
+D1884:   .data -4808, K51, -3107, 4793, -1224, K20, K40, -2439
+        cmp  D104, D506
+D1885:   .data -6486
+D1886:   .data 6213, 1043, 6334, 3454, -1816, -7216
+D1887:   .data 7480
+D1888:   .data 363, 4428, -5004, -6763
+D1889:   .data -1980, 7145
+; generated comment line
+D1890:   .data 7388, K37, -4621, -4838, K51, 5534, 921, 4957
+D1891:   .string "udwhrt"
+D1892:   .string "ukyfmccdyd"
+D1893:   .string "ftxppmct"
+D1894:   .string "bhxm"
+D1895:   .string "itxwqtcyivcpccd"
+D1896:   .data K12, -1917, K12
+D1897:   .string "yg"
+D1898:   .data 4289, 4766
+D1899:   .data 4107
+D1900:   .data 3686, 4712, -84
+D1901:   .data 6084
+D1902:   .string "xgxrajqodnsuih"
+D1903:   .data -1074, 6962, -4855
+D1904:   .data K43, K34
+D1905:   .string "ikjklxcfzrvolv"
+D1906:   .string "fsqx"
+D1907:   .data -191, -4852, 7710, K46, -5681, K43, K38
+D1908:   .string "mjmwabav"
+D1909:   .data 4063, K40, 7538
+D1910:   .string "rpxbyioswejkjonejiyb"
+D1911:   .string "paxcsrcfdevvajduufm"
+        cmp  D778[K50], r3
+D1912:   .data -1814, K15, K25, -3520, 6768
+D1913:   .data 5476, 1840, 2313, 5286, -5217, -5564, 7940
+D1914:   .data -6074, K17, -1213
+D1915:   .data -4038, 6030, K31, -1124
+D1916:   .data -3487, 6192, 1583
+D1917:   .string "kbtuqbfrhyetvzjqfldrwm"
+L52:   dec  D968[K35]
+D1918:   .data -4447
+D1919:   .data -445, -2243, -2773, K12, -2787, K23, -762, 3437
+D1920:   .data -7957, K4
+D1921:   .string "tc"
+D1922:   .data K48
+D1923:   .string "vlucivxcjsatu"
+D1924:   .string "ticixeaprwxpnmskpaxdgqe"
+D1925:   .data -3648, 6914, 7278, -4887
+D1926:   .string "oxdrygvpdhpncs"
+        sub  #-1133, D1190[1]
+        hlt
+D1927:   .string "abmdsxmbbmnkihii"
+        red  D1834
+D1928:   .string "qaxpxnieppcft"
+; generated comment line
+D1929:   .data -549, K13, -5643, -534
+D1930:   .data K22
+D1931:   .data -1360, 6175, 4965, -2407, -3233
+.entry L25
+D1932:   .data -3334, 2929, -3683, 4554, -229
+D1933:   .data -1372, 1835, -4446, 2813, K23, 936
+D1934:   .data K52, 4445, 518
+        inc  r6
+D1935:   .data -7465, -604, -4462, -4535, 1659, -3896, 796, K36
+D1936:   .data 3134
+D1937:   .string "bdxkdrgruuppimg"
+D1938:   .string "c"
+D1939:   .data K18, 5563, 4943, 5415, 2444, -4399, 4276, K19
+D1940:   .data 7535, 1457, 5998, 1271
+D1941:   .data -7790, K12
+D1942:   .data 2255, 7882, 2828, 5093, 2461
+D1943:   .data -4981, -1851, 3177, -1572, -2029, K37, 6294
+D1944:   .string "ysegeuxrzjlgug"
+D1945:   .data 902, -4592, -4286, 1360, -7719
+D1946:   .string "j"
+D1947:   .data K15
+D1948:   .data -2495, 3314, 1173, -7902, 2078, 2678, K45, -4519
+D1949:   .data -6321
+        sub  D1793, D1448
+D1950:   .data K10, 381, -2705, -5225, K18, 2847, 6363
+D1951:   .string "oeicwqxvwhukguadgmnre"
+D1952:   .data 5553, 4057, K43, 5321, 5568, -2311
+D1953:   .string "sctdjtmxtr"
+D1954:   .string "sgdudjoyshpgx"
+D1955:   .data 7119, -6523, 6433, 4566
+D1956:   .string "uufarxsgdtfa"
+; generated comment line
+D1957:   .string "ordqorijyxdqqutrqvey"
+D1958:   .data K15
+D1959:   .data K51, K16, -1745, -4735, 3227, 2454, 6249
+D1960:   .string "ieandbpekwlsrjfibc"
+D1961:   .string "aohjldzp"
+D1962:   .data 1680, 1253, -3445, 4039, -1335, -757, K24
+        prn  D1445
+D1963:   .string "nktqkluaxoedvefojrwkgrpd"
+        hlt
+D1964:   .data 5715, -128, K4, K25
+D1965:   .data 7905, K27, 4566, 2747
+L53:   jmp  D659
+D1966:   .data -5515, -52, 4511, K40, 3303, 3437, K0, 1178
+D1967:   .string "uergompejsaplikuovzs"
+D1968:   .data -7358, K9, K41, -147, -4950
+D1969:   .string "tdvwwpsqwsumamwgatxri"
+        hlt
+D1970:   .string "jqsmbyqi"
+D1971:   .string "wmfrcnmzmwzvpg"
+D1972:   .string "xpmjhjbmp"
+D1973:   .data -5649
+D1974:   .data K52, -499
+D1975:   .data -5766
+D1976:   .data -540, K18, K46, -2485, K0, K36, K26, 6835
+        red  D1834[K2]
+        jmp  r5
+.define K53 = 1
+D1977:   .data 2281, K9, -1981, K21, -7380, -312, 7614
+D1978:   .data 2446, -6964, -995, K39, -200, 459
+D1979:   .data K5, K42
+D1980:   .data -1772, 6588, 2659, -1312, 6806, K32, K15, 6284
+D1981:   .string "iioclszvbs"
+D1982:   .data K19, K8, 5238, -4846, K40, -1329
+D1983:   .string "aiweudec"
+D1984:   .data -5395, 1308, 507, 6270, 7556, 2105, 6516
+D1985:   .string "byadvxtqnnljugys"
+D1986:   .string "hkuwjhclvbtt"
+D1987:   .data 607, 2244, K22, 4744
+D1988:   .data -2279, 2974, 1307
+D1989:   .data -6619, 4433, K49, -6724, K47, K33
+D1990:   .data -6638, K9, -3948, -2836, K15, K52
+D1991:   .data -5668, 3367, -7210, -6739
+D1992:   .data 3344, K28, -5884, 7175, 4930, -769
+D1993:   .data K40, -1921, -1121, -6333
+D1994:   .string "vfhgefh"
+D1995:   .data 2578, K28, K0, -7653, -3535, 1757, K15, K23
+; generated comment line
+D1996:   .data 1967, -2179, K43, K39
+D1997:   .data 6608, 2, -2021, K24, -3493, K15, -6081, -4264
+D1998:   .data 5325, 5636
+D1999:   .data K39, -1959, 1398, -1985
+D2000:   .data 6441
+D2001:   .data 464, K18, -1056, -3592, -5412, 427, -7087
+        red  D575
+D2002:   .data -4263, 742, -3049, K10, 4745, K0
+D2003:   .data -1367, K31, -7148, 1479, -1884, -3846, -5275
+D2004:   .data -6077, K16, K10, -2071, -5681
+        add  #-685, D1077
+D2005:   .data K8, K24, -796
+D2006:   .string "tzib"
+D2007:   .data K4, -2847, K50, -6805, K52, K34
+D2008:   .data K39, 5322, 5674, -1302, K21
+D2009:   .data K51
+D2010:   .data 1323, -179, 1642, -5421, -4490, -5699, 4460, -6266
+D2011:   .data 2035, 5815, K0, 5157
+D2012:   .data 3802, -5951, -3066, 1022, K20, -7192, -462
+D2013:   .data -918, 5244
+D2014:   .data 455, -1461, 3622
+D2015:   .data K42, -6126, 4732, 3342, -1156
+D2016:   .string "pcbgfiy"
+D2017:   .data -490, 741, -3709, 6294, -1537, -4803
+D2018:   .data 6949, K40, K4, 4761
+D2019:   .string "gyqszzcj"
+D2020:   .data K14, 1865, 1179
+D2021:   .string "rphyfqaqg"
+D2022:   .string "yahtqpcskoepkipnwen"
+D2023:   .data 2869, K9, 6501, -5700, -2859, -1395
+D2024:   .data -2209
+; generated comment line
+        sub  D435[1], D655
+D2025:   .data -4617, 5987, 173
+D2026:   .data 1569, -1891, 2482, -2644
+D2027:   .string "nglxkkj"
+D2028:   .data 2303, -2221, -4858, -3857, -1422, -3746, -2610
+D2029:   .data K2
+; generated comment line
+; generated comment line
+D2030:   .data -4988, K10
+D2031:   .string "gjyurxqnnlyectctvyk"
+D2032:   .data -6799, -6352, K49, K1, -4431, -5193
+D2033:   .data 6660, K43, -3073, 4157, -6024, 514
+D2034:   .string "lfjrve"
+D2035:   .string "wnehhonizkleddyn"
+D2036:   .data K44, -5462, K7, -5226, -1236, -7601
+D2037:   .string "xnxxmebxovnbbuupe"
+D2038:   .string "fphgrq"
+D2039:   .string "ccefshdxbltpvxqa"
+D2040:   .data -3053, -3591, K47, 6758
+D2041:   .string "outiqujktumnbimqepvowskt"
+D2042:   .data K49, 2841, -6218, 4596, K11, 1533, K48
+; generated comment line
+D2043:   .data K36, K8, -1092, K51, 1723, 7421, -300
+D2044:   .data 1895, 6796, K53
+D2045:   .data 4742, -1622, 5313
+D2046:   .data K19, K26
+D2047:   .data -7158, 7772, -6371, K21, 4699, 5288
+D2048:   .data K15, -4812, 2997, K48, 6041, -4247, K33, 7496
+; generated comment line
+D2049:   .data K16, -7009, -5484, 5948, -7384
+D2050:   .data K16, -425, -7296, K2, -3080, K11, -6291, -1153
+D2051:   .string "oycnqpwbmjuipilozsdqu"
+D2052:   .data -508, 3331, K31, -5356
+D2053:   .data -2040
+D2054:   .data -2362, K22, K15, -1206
+D2055:   .string "ske"
+D2056:   .data -6456
+        add  D1410, D1964
+D2057:   .string "jyuii"
+D2058:   .data K42
+D2059:   .string "tguesmj"
+D2060:   .data -4302, -4743
+D2061:   .data 5795, -7123, K45, -5062
+D2062:   .string "nfkuptllyznpts"
+D2063:   .data 4416, 2991, 442, K15, 600
+D2064:   .data 6799, 1883, 5909, -7741
+D2065:   .string "jsonsvjwehlnejlbdda"
+; generated comment line
+.define K54 = 24
+D2066:   .data -6927, 1214, K52, 1408, 2488
+D2067:   .string "gowhsqmtkshlofvzo"
+D2068:   .data K12, 334, -4178, -5421
+D2069:   .data 26
+D2070:   .data -6753, K24, 4327, 6361
+D2071:   .data 1669, 563, -2722, K28
+.entry D25
+D2072:   .data -837, -5895, 2452, -1084
+D2073:   .data -1155, 974, 7110, 6268, -5228, 4893, -13, 5916
+D2074:   .data -4232, 1939, 4932
+D2075:   .data 6468, 3838, 7275, 2155
+D2076:   .data -6652, -7953
+D2077:   .string "gde"
+D2078:   .data -1715, -2046, 1276, K45
+D2079:   .data K48, K4, 1509, -6263, -7881, -4723, -5852
+D2080:   .string "pp"
+D2081:   .string "jvq"
+D2082:   .data K49, -1206, 1818, 380, 5018, K53
+D2083:   .data -6394
+D2084:   .string "uwkfgmimpttlade"
+D2085:   .data -226, K10
+D2086:   .data K34, K10, -304, -1546, 7907, -3432, 1759
+D2087:   .data K16
+D2088:   .string "exw"
+D2089:   .string "mdsgnnujinwax"
+; generated comment line
+D2090:   .string "qtry"
+D2091:   .data 5222, 2223
+D2092:   .data 6506, K11
+D2093:   .data 647, -5566, 5828, -1443, -1067
+D2094:   .data 2659, -2851, -4415, 5492, -7957, K44, 4718
+D2095:   .data 5938, K50, -7154, -2013, 6407, -2366
+D2096:   .data K28
+D2097:   .string "ebml"
+D2098:   .data -5983, K54
+D2099:   .string "knwltcbxaltkktkbk"
+D2100:   .data 2100, 88
+D2101:   .data K28, 5464, -1304, 2333, -4802, 7838
+D2102:   .string "mgjqxdbunvvatyqqkugic"
+D2103:   .data K23, K24, K24, 5033
+D2104:   .string "xyezhozf"
+D2105:   .data 5505, 7352, -6991, 7241
+D2106:   .data 7339, 5945, -6537, -273, 1498
+D2107:   .data 2894, 877, K27
+D2108:   .string "qfdzhfpplzdx"
+D2109:   .data -7822
+        inc  r0
+D2110:   .string "tcvnrjrqtlqqty"
+D2111:   .string "vaswjz"
+D2112:   .string "itgemurcmmdqclzcnljogqv"
+D2113:   .string "imszddtsowpgbjlerm"
+D2114:   .data K28, -3615, -1025, -723, K36, 6422, K27, -7495
+L54:   add  D1090, D1169
+D2115:   .data 5666, -3926, -2269, K20, K52
+D2116:   .data 7238
+D2117:   .data 2881, K37, -6342, K19, -191, 5297
+        clr  D1131
+D2118:   .data -536, -6598, -4717, -1575, K2
+D2119:   .string "tmuuvaplxhphjvvsmze"
+D2120:   .data -3707, K45, 2226, K24, -5950, K19, K36, K12
+D2121:   .string "mzdsgmsjpayawjgug"
+D2122:   .string "tlqhwmptfusheeskewsa"
+D2123:   .data -3911, 5854, 7701, K51, -7386
+D2124:   .string "ikhckccqvwedtinezampthw"
+        cmp  r7, D1680
+.define K55 = 30
+D2125:   .string "riypqsapplwrkazhlaoaehfx"
+D2126:   .data -7548
+D2127:   .data K28, 1699, 2220, K22
+D2128:   .string "zrzjpiiycoclmxyhsbmit"
+D2129:   .string "vorgcnwlrmdrkjpegbgnksv"
+        prn  D1309[6]
+D2130:   .string "kekttcxqvoymmpwntjordhk"
+D2131:   .data -2610
+D2132:   .data K18, -6663, -1201, 4942, 7618
+D2133:   .data K21, -3362, 901
+D2134:   .string "xdkrohpyezbxtiyddpxcplnh"
+D2135:   .data K53
+D2136:   .data -1642, K35, 4980, -491
+L55:   clr  r3
+        prn  #K17
+D2137:   .data 3477, 5006, 7861, -7713, K21, -1891, 5001, K37
+        sub  X10, D863
+D2138:   .data K55, K16, 6068, -6914, -2941, 3092
+D2139:   .string "slt"
+D2140:   .string "jsokhcrfsimdtnfesstexp"
+D2141:   .data 3203, -2347
+D2142:   .data -5743, -2017, -3542, K4, K30, 7027, 6985, 1845
+D2143:   .data -4838
+D2144:   .data 1626, -5710
+D2145:   .string "ebhyruglmwdsiltgtobzcu"
+D2146:   .string "nvssbbutjdraenwl"
+; generated comment line
+        rts
+D2147:   .data K9, K42, K15, K55, 6529
+        sub  D1297, D1492
+D2148:   .string "ctpwkdjietuqcxcxewrx"
+D2149:   .data -5071, -3590, K36, -5701, K42, K22, 289
+D2150:   .string "rgwjbrwkb"
+D2151:   .data K22, K34, 1468
+D2152:   .data 277, K55, -4274, 3116
+D2153:   .string "wq"
+D2154:   .data K4, K16, -6876, K11, -3134
+D2155:   .data -2320, 2773, -5544, K15
+D2156:   .string "gxlbrcflxcvdoopkoaxltgno"
+D2157:   .data -4750, 3810, 3343, 617, 3757, -2240
+D2158:   .string "jsqojhmas"
+D2159:   .string "nldrvkkmwca"
+D2160:   .data K25, 329, K34, 2126, -716, 1780, -2772, K29
+D2161:   .data -7227, -4074, 4697, 6662
+D2162:   .data -1280, 2029, 400, -3948, -349, 964
+D2163:   .data -6796, -119, -6518, 6346, 5386
+.define K56 = 23
+D2164:   .data 5179, K42, 1155, -7713
+D2165:   .data K3
+D2166:   .data K56, -1240, -984, K16, K30, -7168, -5653
+.define K57 = 49
+D2167:   .data -3463, 7852, -5278
+L56:   add  #-1239, D1509[8]
+D2168:   .string "qnjnvqkwybkljk"
+D2169:   .data -4926, -493
+D2170:   .string "flpjrzqmkb"
+D2171:   .string "glveqjbpszjflpqzlsilgr"
+        dec  r6
+D2172:   .data 3498, 281, 5916
+D2173:   .string "auyzqilzsj"
+D2174:   .data 6406, -6398, -843, K16, K31, 4213, 3674
+D2175:   .data K53, -1687, 2607, K9, 3539, K40
+D2176:   .data -7787, -7664, 1754, -5324, -727, -273, -7221, 1005
+D2177:   .string "z"
+D2178:   .data K9, K25
+        red  D1252[K2]
+D2179:   .data 1250, K45, 3790, 6948, -5881
+D2180:   .string "rbbhemznyxzjhgsxm"
+D2181:   .data 2415, 7156, -4290, 1150, -7506, K12
+D2182:   .data 4047, 3331, -319, 7591, K36, -7636
+D2183:   .data -3695, K37, -3202, K49
+D2184:   .string "h"
+D2185:   .string "lijmm"
+D2186:   .data 180, K39, -6984, 7442, K7
+D2187:   .string "yrdxtan"
+.entry L26
+.define K58 = 20
+D2188:   .string "kbaeewsamkkmonbtw"
+D2189:   .string "bysbvyasteswkqhcqdzch"
+D2190:   .string "qhphqwxyxjavnhdkh"
+D2191:   .data 3267, K7, 5612, 1278, -207
+D2192:   .string "oiflze"
+D2193:   .data 3479
+D2194:   .string "sgst"
+D2195:   .data K49
+D2196:   .data K35
+D2197:   .string "xpvzlcckiugtmhybs"
+        sub  D35, D864[2]
+.define K59 = 2
+D2198:   .data K13, -6388, K9, K43
+; generated comment line
+L57:   rts
+.entry D26
+D2199:   .string "b"
+D2200:   .string "fymsm"
+D2201:   .data 6560
+D2202:   .data 6740, 5536, 377, -490, 2959, -3148, 6516
+D2203:   .data -906, K24, -525
+        rts
+        not  r6
+D2204:   .string "yaxj"
+D2205:   .data 130, 2600, 6141, -6824, -3939, -3685, -4754, -4515
+D2206:   .data -3649
+D2207:   .data -5188, K1, K31, 134, 1152
+D2208:   .data -7791
+D2209:   .string "vrpjxpsogvqwbulv"
+D2210:   .data -1573, K37
+D2211:   .data -1388, 557
+D2212:   .data K15, K55, -2090, -116, -4247, K7, K36, 1264
+D2213:   .data 6370, K14, -4290, 1127, -1504, -6903, -7884
+D2214:   .data K17, -5178, 3430, -3765
+D2215:   .string "y"
+D2216:   .string "frhubop"
+D2217:   .data -3741, 3741, 7051
+D2218:   .data K16, -7597, -2765, 3633, -2420
+D2219:   .data -2945, 2261, -5018, 7582, -7404, 2924
+L58:   red  D631[K6]
+D2220:   .string "nvofmjhqywtvptymdru"
+D2221:   .data -4294, 1955, 6411, K31, -7387, 4250
+D2222:   .data K53
+D2223:   .data 1376, 3151, 1685, 3529, 7311
+D2224:   .string "lcjzj"
+.define K60 = 59
+D2225:   .data -939, -4396, 4699, -6190, -4307
+D2226:   .string "cdd"
+D2227:   .string "mfd"
+D2228:   .data -777
+D2229:   .data 5343, 2183, 4820, 5826, 1401
+D2230:   .string "knucgumicmaocpf"
+D2231:   .string "xqlk"
+D2232:   .string "keghayqaabcqnx"
+        inc  r4
+        not  r3
+D2233:   .data -3489, -5599, -162, 5735
+D2234:   .string "dgitwkgvtj"
+D2235:   .data -2859, 653, -694, 5102, 1781
+        add  D1112[13], D1263[K45]
+D2236:   .data K8
+D2237:   .data 4223, 6266, 1458, K31
+        sub  D980[K28], r5
+D2238:   .data 6352
+.define K61 = 57
+D2239:   .string "jwrduvvoanwxuyvjhk"
+D2240:   .data -1315, K10, 6704, 2304, 6773, -6058, 630
+D2241:   .data K2, 4814, 5335, -5852, -2995
+D2242:   .data -7566, K14, K30, 6042
+.entry L27
+D2243:   .string "mfgyiyqpkkvr"
+D2244:   .data 3926, 5829, 6104, 6638, -1613, K36, 819, 5409
+D2245:   .data -3401, -6778, 5389, 433, -5740, 1394
+D2246:   .string "faoahnghrnltdt"
+D2247:   .data -5818, 6624
+D2248:   .data 348, -6989, K32
+D2249:   .data -3097, -5769
+D2250:   .data -6317, 758, -766
+D2251:   .string "vwmsdzszeancgqqnogcxym"
+D2252:   .data -1377, -7750, 3954, -1074, 353, K24, K61
+        lea  D1439[K57], D1780
+D2253:   .data -1048, K17
+D2254:   .data -7131, K56, 1934, K59, -7503, -4257, 5866, 1162
+D2255:   .string "slnmzy"
+D2256:   .string "ebtsrsor"
+D2257:   .string "qgnzurwrbausrd"
+D2258:   .string "mthotnd"
+D2259:   .data -7904, 2226, 3659, -943, K29
+D2260:   .data 4506, K16, -5578
+D2261:   .data 1279, -4707, -3229, K18
+D2262:   .data 407, 3229, K33, 6474, K55, 5082, K49, K46
+; generated comment line
+D2263:   .string "m"
+D2264:   .string "s"
+D2265:   .string "veaaengmgyhbztipwcxn"
+D2266:   .data 4866, -5532, -4728, -3844, K0, K22, 2705
+D2267:   .string "jsfqgrpoyo"
+.entry D27
+D2268:   .data -5606, -5211, 6054, 1409, K17, K7, K38
+D2269:   .data 862, -7472
+D2270:   .data -5525
+D2271:   .string "xxbufrgajakyl"
+D2272:   .data 2794
+D2273:   .data 2964, K16, K9, -4613, K35, K40, K43, 3427
+D2274:   .data -2901, K32, -2178, K40, -5559, 285, -3384
+D2275:   .string "oclevwhyfwaxktmtqdowvml"
+D2276:   .string "hefhaefybaqbldaoeopdgkpw"
+D2277:   .data 1835
+D2278:   .string "nygoadgtfjibnjsxywewm"
+D2279:   .data 3199
+D2280:   .string "gmkiotus"
+D2281:   .data -483, -3892, -7765, 5166, 2228, -4247, 4772
+D2282:   .data -4830, -2093, 6437, 6564, 3803, -3025, K0, K52
+D2283:   .string "bumuhpgntbnx"
+D2284:   .data -7729, -1228, K52, -6408
+D2285:   .string "fnwmpjdwdfpfjszdoeh"
+D2286:   .data 2901
+D2287:   .data 3205
+D2288:   .data K3, K54, -3182, -3026, K52
+; generated comment line
+D2289:   .string "abjjssibkzdyiy"
+D2290:   .string "ruggxorl"
+D2291:   .string "cb"
+D2292:   .string "avldrjvaegiwrrl"
+D2293:   .data K11, K19, -4277, -1663, -5390, -1014
+D2294:   .data K19, -5530, 6558, K29, -6714, 6988
+D2295:   .string "slcxzewchdtraeppoxxf"
+D2296:   .data -3186, 3664, 5657
+D2297:   .data 512, K2, -6000, -6360, -1524, 4571, -6271
+D2298:   .data -1599, -6664, -7322, -835
+D2299:   .data 5181, 6128, 385, 1504
+D2300:   .string "ianajkw"
+D2301:   .data K16, -3351, 5490, K38, 1971, K32, K40
+D2302:   .data 3040, 6190, 5317, 1367
+D2303:   .string "gcyiieaooskx"
+        hlt
+D2304:   .data K0, -5743, K58, -4709, K12, K28
+D2305:   .data K41, -3142, -614, 6618, K59
+D2306:   .string "ylurlmhxhdwlblezb"
+.define K62 = 64
+D2307:   .string "v"
+D2308:   .string "tmkptzikwyxptmx"
+L59:   hlt
+D2309:   .data -3956, 6489, -2586
+        add  r3, r7
+D2310:   .string "suesrmtinixcsfq"
+D2311:   .data K50, K56, -398, 1075
+D2312:   .data 6259, -1018, 1519, 1325, 7608, -5147
+D2313:   .data K33, 201, K62
+D2314:   .data K50, -2199, -7995
+D2315:   .string "wkormzvngvdrslyiucy"
+.entry L28
+D2316:   .data K18, 512, -2624, K34, K46, -1960, -1661
+D2317:   .data 1849
+; generated comment line
+D2318:   .data -6022, 2847, K3, -417, 5293
+        hlt
+D2319:   .string "vvpbgaqohcp"
+D2320:   .data -7007, 4602, 6027, -425, -6789
+D2321:   .string "xfmmqrcazyztgiprlcjzpvjo"
+        add  D716, D920
+D2322:   .data 2509, 2294, -5110, K34
+D2323:   .data 908, -5872, K36, 274, 5963
+; generated comment line
+D2324:   .string "wftkgw"
+D2325:   .data 1970, K38, 7040, 3659, 1946, -1716
+D2326:   .data K45, 6421, 3795, 7585
+D2327:   .data -2356, 129, 6791
+D2328:   .data -7386, -2480, 6776, 2057, K21, K53, -3965
+D2329:   .data K38, K8, 5384, K16, -7220, -2127, -7739, K51
+D2330:   .data K10, 1627, -4798, K38, 3910
+D2331:   .string "jiyzivettxbubooclaasdcrt"
+D2332:   .data -4743, -7393, K51, -1116
+D2333:   .string "jvet"
+D2334:   .data 5207, 5312, -6020, K62, 4174
+D2335:   .string "xnk"
+D2336:   .string "v"
+D2337:   .data -1112, 3070, K41
+D2338:   .data 3869, -6615, K22, -1997, 2032, -2079, 2250, K14
+D2339:   .string "okusrpxmz"
+L60:   add  r2, r3
+D2340:   .string "iuuucdwghr"
+D2341:   .data 1944
+D2342:   .string "pkuzythizbbxadjteppg"
+        lea  D834, D227
+D2343:   .string "kyemtdbixkmidgvgwoxzoiug"
+D2344:   .data -4451, -1105, K15, K41
+D2345:   .data K43, 2735, K6, 1240, 340, 6954
+D2346:   .data 6730, -2328
+D2347:   .string "vxmpboijqjkyxhdioqabb"
+D2348:   .string "ueocpr"
+D2349:   .data 1640
+D2350:   .string "lgvfb"
+D2351:   .data 4076, 6508, K61, 1466, 5456, K29, -4659, 2755
+D2352:   .data 5772, 4878, K43, -6302, -7511, -4040, -2825
+D2353:   .data K31, 7978, K29, -677, 6590, 4815
+D2354:   .string "wvdpxaygkfapzcysfnez"
+L61:   hlt
+.define K63 = 32
+D2355:   .data K40, -6171, K52, 5710
+D2356:   .data 4361, -813, K49
+D2357:   .string "jobhgonefk"
+D2358:   .string "qoffszuelcyigri"
+D2359:   .data -6686, -3303, K59, 933
+D2360:   .string "fazbkckrrdnacklcjjtkn"
+D2361:   .string "beufhrdxxgyukktfxxjp"
+        jsr  D1205
+D2362:   .data -5399, K49, K49, 5634
+D2363:   .data -6434, -3369, K2, -2089, K27
+D2364:   .data K2, 5677, 633, -2800, 121, 7668
+D2365:   .string "nqurib"
+; generated comment line
+D2366:   .data -5137, K32, K21, K38
+D2367:   .string "jdfvnrdnh"
+D2368:   .data 7769, 5529
+; generated comment line
+D2369:   .data K26, -3147, K14, 6970
+D2370:   .data K35, -4176, 835, 256, -330, 2561
+.define K64 = 57
+D2371:   .data -892, -1033, 5983, 492, 2714
+D2372:   .data 398, K10
+D2373:   .data K23, K49, 7680, -1882, -3437, 4680, -1393
+D2374:   .string "y"
+D2375:   .data 5810
+D2376:   .data K56
+.define K65 = 25
+D2377:   .string "wzoh"
+        jmp  r4
+D2378:   .data 2875, 215, 1753
+D2379:   .data 3469, -1031, 6170, K51, 876, K43
+D2380:   .string "pieznjegqyflxalaiet"
+D2381:   .data 3336, 5557, -2654, K6, -2306, 7059, -6665
+D2382:   .data -3264, K22, 6606
+.define K66 = 46
+        lea  D692, D2219[K55]
+; generated comment line
+D2383:   .string "rjy"
+D2384:   .data 1355, -7575, 4436
+        not  D1351
+.entry D28
+D2385:   .data 1160, 5144, 4941
+D2386:   .data 7323, 6620
+D2387:   .data 4087, 1759, K51, -537, 6627, 2570
+D2388:   .data K33
+L62:   red  D2186[K56]
+D2389:   .data K50, 7345
+D2390:   .data 6062, -291, -336, 7174, 2571, K48, 7435, 3897
+        red  D1680[5]
+        prn  D62[K30]
+        rts
+D2391:   .string "fznzdxr"
+D2392:   .data 7550, 7640
+D2393:   .data 3956, -1269, K4
+D2394:   .data -737, -1937
+D2395:   .string "lvqaruritrskizbaham"
+D2396:   .string "sgvmqabme"
+D2397:   .data -6025, 4818, 5194, -7706, 2617, K21, K43
+L63:   rts
+D2398:   .string "un"
+D2399:   .data -1576, -5895, 6528, K13, -2373, -7463, -7052
+D2400:   .data K62, -4183, 1175, 1890, -2238, -6708, 7508
+D2401:   .data -7124, 5970, 3290, -6317, K30
+D2402:   .data K23, -7626
+D2403:   .data -5519, K27, -7318, K19, -527, 4065
+.define K67 = 56
+D2404:   .string "dndagbmlqrpt"
+D2405:   .string "yqiheegjsxhtdd"
+D2406:   .data -1132, -6233, K11, -6161, -971, K11
+D2407:   .data 6931
+        dec  D1874
+D2408:   .string "xjygecxfskmqliikmnvzpsv"
+D2409:   .data -1319, K46, 5978, 7804, -800, -1132, K2, K36
+D2410:   .string "wjtspwgt"
+D2411:   .data K13
+D2412:   .data 4242, 3862, -7155, -2860, -6076, -7020, -717
+D2413:   .string "idwhrofrdzqzzrqhlmw"
+D2414:   .data 6229, -635, K9
+D2415:   .data -3053, K20, K16, -6453
+D2416:   .string "accfotosytxyaimqqlnrrhke"
+D2417:   .data -5295, K29, 7979, K11, -2284, -144, 2086
+D2418:   .data 6486, -7596, 3941, K23, -7168, 3667
+D2419:   .data K47, K18
+D2420:   .data 2332, 1796, 1131, -7512, -7650, K62, K59, -4524
+D2421:   .data K66, 4424
+        jsr  r2
+D2422:   .data K21, K0, 7550, 986, K28, 7575
+D2423:   .string "geowgdawdpaevnsphxwrqzlc"
+D2424:   .data 3263, 7986
+D2425:   .data -5860, 2707, -3929, K42, K12, -1332
+D2426:   .string "ysbdynjpvzlvptlngcs"
+D2427:   .data -3686
+D2428:   .data 7589, -6193, K37, -2419, -5383, K1, -5404
+D2429:   .data -2848
+D2430:   .data -3264, -4803, K11
+D2431:   .data K50, 1898, 2502, K34
+D2432:   .string "njmxlnomexunzqs"
+D2433:   .string "zdwoetmf"
+D2434:   .string "virjr"
+D2435:   .data 3649, -1585, -2726, K8, K54, 2723, 7801, 6757
+.entry L29
+D2436:   .data 1290
+D2437:   .string "ve"
+D2438:   .data K29, K25, -7906, -3050, K15, -1218
+        hlt
+D2439:   .string "kdrgsyrvpzwsdlmr"
+D2440:   .data -4670, -1210, -2872, -2735, -5561, -6325, K4, K37
+D2441:   .data -4636
+.define K68 = 50
+D2442:   .data -7533, -7526, K51, 7077, 3653, -6789
+D2443:   .string "yulvqwbmsidajqyb"
+        lea  D1460, D2233[K59]
+D2444:   .data -4719, 7863, K14, -4870, 1405, 586, K9
+D2445:   .data K6, K10, 7788
+D2446:   .string "vdadnwngybvowizuewco"
+D2447:   .string "dvabofgurzjay"
+D2448:   .data -4226, 1929, -6299, -6087, -5575, 3333, 7430, K56
+D2449:   .data 4883
+D2450:   .string "ewbdpascsrjdwjso"
+D2451:   .string "lyiazjkmk"
+D2452:   .data 239, -5069, 4302
+D2453:   .data K63, 1754, -6652, -6442, -7292
+; generated comment line
+D2454:   .string "bynkuxgnhkvhs"
+; generated comment line
+D2455:   .data -91, 4592, 1245, -7168, 516, 7827, -6220, 6695
+D2456:   .data -3783, 6458, -1158, -7878, K62
+D2457:   .string "tjz"
+D2458:   .string "baleoamays"
+D2459:   .data 600, -4520, K32, K66, -4176, 5531
+D2460:   .data 6257
+D2461:   .data -7460, 5010
+D2462:   .string "szlvzycllfjkhxvlukqur"
+D2463:   .data K62, 7833
+; generated comment line
+D2464:   .data -6527, 5789, -3801, -3803, -1878, K33
+D2465:   .data K60, 4700, K17, 525, 7675, 2731
+D2466:   .data 6327, -3846, -5338, 1366, -1581, K10, -3349
+D2467:   .string "cwjkkg"
+        add  D833, D1996
+D2468:   .data -7114, -3662, -5531, K24, K68, 1189, 2570
+        dec  D80[K35]
+L64:   sub  r3, D2013
+D2469:   .string "e"
+D2470:   .data 4953, -3553, -3461, 3869, -3841
+END:    hlt
@@ -0,0 +1,3001 @@
+.define K0 = 14
+.define K1 = 12
+.define K2 = 34
+.define K3 = 27
+.extern X0
+.extern X1
+.extern X2
+.extern X3
+.extern X4
+.extern X5
+.extern X6
+.extern X7
+.extern X8
+.extern X9
+.extern X10
+.extern X11
+.extern X12
+.extern X13
+.extern X14
+.extern X15
+MAIN:   mov  r0, r1
+D0:   .data 5581, 4596, K1, 4975, -1619
+D1:   .data 3210, K1, 4461, 3963, -2970, 614, -7792
+D2:   .string "xyvmdczwrxcdeoho"
+D3:   .string "cnf"
+        clr  D0[K3]
+D4:   .data -7964, -567, 7719, -2225, 6876, K1
+D5:   .data 6823, 4749, K1, 4802, 4359, 5352, 4021
+D6:   .data 375, -3461
+D7:   .data K2, -4508, 6763, -5209, 3684, -1467, 2604, 1943
+D8:   .string "qqsbodourleqgaphkykolg"
+D9:   .data -5561, 349, 2025, K0, 4083
+D10:   .data -6482, -6160, 1268
+D11:   .data 7660
+D12:   .data -6078, -3303, K3, 6506, 3415, -2436
+D13:   .data 2242, -1098, 2906
+L0:   dec  D7[K2]
+D14:   .data -6982, -7540, -6835, K1, -7669, 5080
+        not  D8[K1]
+D15:   .data 6185, 6580, -7546, K3, 3767, K0, K0
+.define K4 = 8
+.entry L0
+D16:   .string "aafcv"
+D17:   .data 3015, K4, -294
+D18:   .string "jbjbycswqebqdyfyfgab"
+        jmp  D11
+D19:   .string "tcpfqrzkehqh"
+D20:   .data -4101, 3504
+D21:   .string "heircewalz"
+.entry D0
+D22:   .string "n"
+D23:   .data K2, K4, -5991
+D24:   .data 2732, 5420, K0, -6150, -2928, K0, -7283, -2941
+L1:   lea  D7[K2], D4
+D25:   .data -6829, 3933, K3, -5270
+.entry L1
+; generated comment line
+D26:   .data -6778, -2635, -1197, K0
+D27:   .data K0, K0, -5520, -2465
+D28:   .data -3283
+; generated comment line
+D29:   .data -3815, -2849, -2165, 1488, K4, -4012
+D30:   .data -587, -6118, -6281, -4044, -3131, -5879, -3412
+D31:   .data K0
+D32:   .data -543, 6446, K4, 4336, -4312
+        bne  D23
+D33:   .data 6690, -6951, K4, -5659
+D34:   .string "rinjueedxfnsymhsdzjet"
+D35:   .data -486, 5883, 7285, 3875
+D36:   .data K2, -3253, -7445, -2903, 3012
+D37:   .data 2263, 3181, -5442, -1994, -404, 900
+D38:   .data -6566, K1, -1982
+D39:   .data 7319, K3, 5947
+D40:   .data 2541, -711, -3888
+D41:   .data K0, 6357, 4946, 763, -4701, K0, -3139, 7026
+D42:   .data K2
+D43:   .data 4984, 7975, 45, -7903, 2855
+D44:   .string "lkbxtzhwlrwojtyshuekl"
+.entry D1
+D45:   .data K1, -1910, K2
+D46:   .data -3992, K0
+D47:   .data K3, 885, 1979, K3, -7618, -6815, -3762
+L2:   dec  D24
+D48:   .data -5402
+D49:   .data K3, -254
+D50:   .data -1059
+D51:   .string "pucqqqjaaln"
+D52:   .data 3606, K3, -3885, K1, -4982, 6523, 7063
+D53:   .string "chhrktpkiz"
+D54:   .string "ztjspyujjxuyc"
+D55:   .data -46, 1322, K4, 2516, -3458, -7096
+D56:   .string "gkiiapp"
+        add  r6, D16[K3]
+D57:   .data -4963, K1, 3938, -2072, -6712, 1056
+.entry L2
+D58:   .data -6721, -503, -1542, 733, -3158, -1562, 3710
+D59:   .data 3428, 6664
+D60:   .data K4, -3000, 5592, -115, 4782, 7182
+D61:   .string "yadmzndovfjyvucycagim"
+D62:   .string "mbsggqgbokjh"
+        clr  r1
+D63:   .string "vkbxoaznhzosjnrbg"
+D64:   .data -310, K4, -6801, 6485, -1724, K4, 2291, -4545
+D65:   .data -521, -1043, 2889, -5058
+D66:   .data -5142, -4428, -7221, K0
+D67:   .data 6495, -6481
+D68:   .string "hhg"
+D69:   .data 4906, -1465, K0
+D70:   .string "cnumracqmniawnwg"
+D71:   .string "ftvkycj"
+        prn  #K2
+D72:   .string "iychopdnoferrv"
+        cmp  D34, r7
+D73:   .data -7507
+D74:   .data 7074, -7038, 1548, 5012, -6139, K2, K2, -7521
+D75:   .string "evie"
+D76:   .data 4854
+D77:   .string "wbsntu"
+D78:   .data 6103, -866, K2, -2078
+D79:   .string "jmwtyxgdbbhwxssozssg"
+D80:   .string "dn"
+D81:   .data -6595, -7596, 2407, K1, -7121, 4981, K2, -1118
+D82:   .string "umzm"
+D83:   .data -2071, K1, -4951, K3
+D84:   .data -916, -2458, K1, 7852
+        sub  #300, D59
+D85:   .data K4, 5274
+D86:   .data K4, K1, 616
+.entry D2
+D87:   .string "tuflebimrrqqkfcimq"
+D88:   .string "cxbslcjoirbxgod"
+D89:   .string "yjnbharblspleqfcss"
+D90:   .data K0, -2972, 2919, 4140, K4, K3
+.define K5 = 33
+        not  D30
+D91:   .data 2460, K2, 2132, K3
+D92:   .string "twcuuqwhohcbkhykpqzabk"
+D93:   .data 1172, -5851, K5, 2240, -109, K2, 764
+D94:   .data 7263, 4946, K2
+        lea  D11, D71[K0]
+D95:   .data K0, -248
+D96:   .data -3675, -1619, -5875, K3, K4, 2110
+D97:   .data K0, 2217, -3713, 2686, 3826
+D98:   .data K3, -4530, 629
+D99:   .string "ddgfcrvcudbtnkgbztnwndbn"
+D100:   .data K1
+D101:   .data -698, K5, -92, 2629
+D102:   .data 3799, -4623, 7679, K4
+D103:   .data K1
+D104:   .string "eqvdbirfthnktzikts"
+D105:   .string "paou"
+D106:   .data -6540, K3, K4, 4266, -7034
+D107:   .string "ycztcvjtkgylwjnakejhpfaq"
+D108:   .string "pjj"
+D109:   .string "lnpsqhr"
+D110:   .data 7450, K2, K2, 5091, -1095, -91, K1, K5
+D111:   .data 4771, -2025, 1189
+D112:   .string "fjivcqbya"
+D113:   .string "tnsbalbcaqtrlnsovnivlxx"
+D114:   .string "chovtfnabuoyfkau"
+D115:   .data 4017, -6603, -3901, 4985, 1904, 7454, -6347, -7167
+D116:   .data 1224, -3047, -1608, -7969, -3082, -1295
+D117:   .string "wxzkokexrscigns"
+D118:   .string "hnxfenm"
+D119:   .string "vgojamaowoqwum"
+D120:   .data -7020, -2245, -1555, K0, 2793, K4, 7283, K2
+D121:   .string "d"
+D122:   .data 3058, 2194, -2926, K3
+D123:   .data K1
+D124:   .data 3155, -1355, -6638, -1861, 2718, 3877, -5228, 6766
+D125:   .data 4795, 5183, K4, -5331
+D126:   .string "cuhvbwraaujwxkauvraceoy"
+D127:   .string "pbjiocuiqhyhqperwargxqzm"
+D128:   .string "fuhna"
+D129:   .string "tvcavufiebxbgiy"
+D130:   .data K4, -6540
+        jmp  r2
+; generated comment line
+D131:   .string "i"
+D132:   .string "tnx"
+D133:   .string "nwhiqocaoc"
+D134:   .data 7576, 6040, K0, K2, -2064, -6309
+D135:   .data -7247
+D136:   .data 3612, -4526
+L3:   add  #-1448, L0
+D137:   .data -7302, -2911, -1947, -664
+D138:   .data -2495, 2064, K4, -6529
+D139:   .data -6321, -5453, -5111, 4549
+D140:   .data K3, -7466, -7040
+        prn  r1
+D141:   .data -1941, -4729, -4333, 5330
+; generated comment line
+L4:   cmp  #-1650, r0
+D142:   .data -7014, 5769, -1012
+D143:   .data K0, K3
+D144:   .data -1814, -1181
+D145:   .string "yrw"
+L5:   mov  D0, r5
+D146:   .data K3, 3609, 4447, K3, -893, K4
+D147:   .data 6789, 1, -1590, -4444, -2151, 351, -2629, 1373
+D148:   .data 7280
+D149:   .data -6568
+        lea  D98, D83
+D150:   .string "etp"
+D151:   .string "nrkeutjhvgefp"
+D152:   .data 1277, K4
+D153:   .data 7133, -2081, -3484, 6830, -4370, 1822
+D154:   .string "afjdzv"
+D155:   .data 1120, 2131
+        red  D64[13]
+D156:   .string "vcidumipsnqcxdikgibdiusa"
+D157:   .data -2972
+D158:   .data 3134, -5188
+D159:   .string "lagv"
+D160:   .string "e"
+; generated comment line
+D161:   .data K0, 85, 2650
+D162:   .data -4982, 7563, -134, K2, 2994
+D163:   .string "czgirhe"
+D164:   .data K2, 7323
+.entry L3
+D165:   .data 3460, -6267, K5
+D166:   .string "cxdt"
+D167:   .string "ecbisqflhmxk"
+.define K6 = 52
+D168:   .data K4, 3015, -5252, 4196, -2672
+D169:   .data K3, 7647, -6968, K3, 3008, K2, -7499, -1401
+D170:   .string "yesxq"
+D171:   .data K3, 528, -2356, 3554, 2002, -7750, -4045, K5
+D172:   .data 2892, 5631, K4, -4184
+D173:   .data -5669, -7250, K1, K2, -782, K4, -2584
+        hlt
+D174:   .data -4288
+D175:   .string "vojhr"
+D176:   .string "nqdkwqcuqwmqvdqd"
+D177:   .data -6556, 1446, K6, -7174, 6273, -6704, -7985
+D178:   .data K3, -6558, K1, -6893, -2634, 2951
+D179:   .string "antbfaqactoppsswhpib"
+D180:   .data -6895, 5015, 1155, -120, K0, 7564
+D181:   .string "jtooxht"
+D182:   .data -2015, 7300, -5219, K4, -7956, -3956
+D183:   .data -452, 5017, K3, K0, -5728, -3766, -3281
+D184:   .data 942, -7593, 6672
+D185:   .data K3, K5, K3, -2698, -3434, -6917
+D186:   .string "kkpatlvuh"
+; generated comment line
+D187:   .data -4909, 3981, -1285
+D188:   .string "gkinjrzhdgranotkzziba"
+        prn  L5
+D189:   .data -3398, -3360, 1723, 6700
+D190:   .string "lmmaxhrpqmhx"
+D191:   .string "ndiqhojarrfvijokmdmekbkn"
+L6:   cmp  D73[K2], D181
+D192:   .data -534, -4293, K0, 3181, K5, 5490
+D193:   .data K0, 3784, 2971, -7912, 4110, 3097
+D194:   .string "ajemuajjzrwhiovjl"
+D195:   .data K6, 2132, -3008, -1442, K6, -5697, -6143, K3
+; generated comment line
+D196:   .data 117
+.entry D3
+D197:   .data -5728, K2, K3
+D198:   .data -293
+D199:   .data 270, K0, 6731, K0, 3458, 1587, -6129
+D200:   .string "utxhmbbygrgqurlzgt"
+        jmp  r6
+D201:   .string "vbhyhaeuhgtaoktlsecasyr"
+D202:   .data -2902, 2018, K5, K4, -1101, K5, -3499, K4
+D203:   .string "wzgvcujohv"
+D204:   .data -4089, -4294
+D205:   .data 6678, K6, 4857, K3, K2, 1229, K0
+D206:   .data K3, 413, 5785, -7597, -5036, K1, -1794
+D207:   .data K4, -5697, -1797, 7394, K6, K4, 2442, K5
+D208:   .data K1, K6
+D209:   .data 935, -7792, K6, 4934, -203
+D210:   .string "ctvegxdxtiunlvvcxhdp"
+        add  #-352, D125
+D211:   .string "mxnt"
+D212:   .data 2725, 7873, -3210, 272, 3418, 3705, K5, 3928
+D213:   .string "lkhftxtsrlwuhufczdeiwl"
+D214:   .string "civmuoanscynyabrgt"
+D215:   .string "gkn"
+D216:   .data K1, K6
+D217:   .data 1684, K2, K1, -7179, -2277, K4
+D218:   .string "afbnxnfoi"
+D219:   .string "t"
+D220:   .data -2073, -2839, 4267, K5
+D221:   .data K1, K6, 7639, 7879, 1672, 6032
+        dec  D93
+L7:   mov  r1, D216[K5]
+D222:   .data K0, 5402, -3083, -2535, K6, 5968, -5022
+D223:   .string "zmng"
+D224:   .string "ioyx"
+D225:   .data 4667, -1825, -2667, -4116, 5439, K3
+D226:   .data -4296, -2247, -6976, 5579
+        mov  #1134, D49[K2]
+D227:   .string "a"
+D228:   .data -6556, -1890, K2, -1180
+D229:   .string "rfleng"
+; generated comment line
+D230:   .data -779, -5122, K4, K0, K6
+D231:   .data 3457, 7142, -2723, K1, -3858
+D232:   .string "ysdkcou"
+D233:   .string "elvsjcx"
+D234:   .string "xhao"
+D235:   .data 6016, 3675
+D236:   .data 1541, 7544, 6799, K2, -2184
+D237:   .data 2717, K5, -1348, -5761, -7164, K4
+D238:   .data 5912, -32, -5012, 5610
+D239:   .string "gxlsesqiqrxtx"
+D240:   .string "q"
+        jmp  D194
+D241:   .data K1, K1, -5379, -1923, 2990, -20, 6077
+D242:   .data K3, 7480, K3, K0, K6, 1879, 7434, K3
+D243:   .data 7552, -6602, K0, K1
+D244:   .data K6, K5, 5504, -4436, -4507, -2846, -2885, -2880
+D245:   .data -4202
+; generated comment line
+D246:   .data -2591, 6647, -2890
+D247:   .data -7534
+D248:   .data 7098, -5413, K0, 1767, 4497, K5, 6238, K1
+D249:   .data 7114, -103, 7255, K6, 1261, -6392, 2776, K4
+D250:   .string "uosb"
+        jsr  r1
+        sub  D196[K5], D35[K2]
+D251:   .string "ky"
+D252:   .data K2, -2363, -783, K6, -2852, K3, K1, K4
+D253:   .data K3, 820, 3340
+D254:   .string "ekwbk"
+D255:   .data 5878, -7219, K1, 3609, K4, K6, K3, 2482
+D256:   .string "vvjmgulabrtmxqljjgozbtbl"
+D257:   .data K0
+D258:   .data -815, 1021, K0, K5
+D259:   .data -3557, -7729, -6755
+D260:   .string "hfopmmhiklkcdhwpc"
+D261:   .string "uspvxdkir"
+D262:   .data 5625, -618
+D263:   .string "pepxvfyjegitcmw"
+D264:   .data 7785, -4307, 7931, 6769, -6104, -1898, 1261, 5625
+D265:   .string "hisdnkatmgghat"
+        inc  D252[K5]
+L8:   prn  D224[K2]
+; generated comment line
+D266:   .data K3, -1230, -6795, 2946, K2, K6, -4304, 6524
+D267:   .string "iohrl"
+.define K7 = 20
+D268:   .data K5, 6436, -1690, 1660, K4
+D269:   .data K4, 3975, 6907, -3277
+        jsr  r0
+L9:   hlt
+D270:   .data 5101, -3446, 5235, -362
+D271:   .data K7, 2992, K3, 6035, 727, K2, -2491
+D272:   .data -3078, 353, -2394, -6754, K2, 3720, 7122
+D273:   .data -4214, 3228
+D274:   .data -5017, 1771, -2618
+D275:   .data K0, 7474, -5860, -1618, -4708
+D276:   .string "tefmvsoboxjsznw"
+        rts
+D277:   .data 6504, 789, 2552, 1084, 5003, 6892
+D278:   .data -132, 1873, 2194, -1774, 1938
+D279:   .data -6694, -2621, 3440, -7303, 1326, -4482, -560
+D280:   .data -3274
+D281:   .string "abqasymn"
+D282:   .data -7876, K3, -6478, 4097
+D283:   .string "wjvsafrllqyfvbrarbbbmeqa"
+D284:   .data -344, K2
+D285:   .data -4677, 2695, 6955
+D286:   .string "fvciwpowrwhposlr"
+        hlt
+D287:   .string "qbjgcjcdivjasyft"
+L10:   lea  D202[K5], L2[K0]
+D288:   .string "fqhzvumyja"
+D289:   .data K0
+; generated comment line
+; generated comment line
+D290:   .data 4720, 6971, 7818, 2108, 765
+L11:   clr  D151[1]
+D291:   .data 6844, 753, -1417
+D292:   .data -3114, -2560, 2344, -7239, K5, K3, 7987
+D293:   .data K5, K6, -4616, K1, 7484, 3745, 2997, K5
+D294:   .data K7, -1013, -3854, K3, 3574
+        clr  D282
+D295:   .data 4791, -3076, 6150, 2438, 1270, K6
+D296:   .string "blzxnrpjmatarl"
+D297:   .data K3, -122
+D298:   .string "uqvcoifm"
+D299:   .data -5363, K2, K0
+D300:   .string "yaqtskwgz"
+D301:   .data 601, K0, -3485, -2656, 1041, -4742
+D302:   .data -4744, K2, K0, 1325, 242
+D303:   .data 2626, 4355, -6478, K4, -7446
+D304:   .string "kdiatdkpmfgkvlx"
+D305:   .data K5, -3924, -4249, -7565, K7, 4391
+D306:   .string "uwrw"
+D307:   .string "vrozmmfbbiyygnlpsf"
+D308:   .data -3418
+        bne  r7
+D309:   .string "wwu"
+        jmp  r4
+D310:   .data -2082, 7608, -4718
+        add  D152, D229[10]
+D311:   .string "lxqzjsdzs"
+.entry L4
+D312:   .data -4440
+        red  D186
+D313:   .string "anwwikvdufe"
+D314:   .data 1020, 2824, 2465, -7426, -5193, 5660, -2916
+        bne  D210
+D315:   .data -3434, -4322, 892, -1154, K1, -4910, -4327
+D316:   .string "vjih"
+        bne  D33
+D317:   .data 5989, -7677, K1, -295, -7596, -2172, K1
+D318:   .string "imcvnurldlltzhtr"
+.define K8 = 25
+D319:   .string "yngtneinvvclplzfytrwk"
+D320:   .string "srrkuuxpstounqcomhoyexmc"
+D321:   .data 4561
+D322:   .data K8
+        rts
+D323:   .data 6307, 1592, -4294, -2714
+D324:   .data K4, -4473, -6151, -7026, 6947, 3729, -2417, 6796
+D325:   .string "rnrznbypcpixenbynsh"
+D326:   .data 7357, -7277, -196, -3634, 6471
+D327:   .string "panm"
+D328:   .data 4510, -1525, -3701, K0, -6753
+D329:   .data 6723, -6282, -230, 7228, 5221, -645, 927, K0
+D330:   .data 2916, 424, -2857, -6947, 593
+D331:   .data 6596, -622, 5705, 2485, 5538, -3021
+D332:   .string "pqglcyypcbcqnx"
+D333:   .data -6603, 1822, K2
+.define K9 = 53
+D334:   .data 3813, 3883, K9
+D335:   .string "nvkwzqwsciwaomcgpr"
+D336:   .string "bkfa"
+D337:   .data K6, -1449, K6, K2, K5, K6
+D338:   .data 5478, -1018, K1, -573, K8, 6010, 363
+D339:   .data -3479, 6877, 6909, 5225, 4874, K5
+D340:   .data 4007, -3870, 1764, -4611, 6517
+D341:   .string "gftpyraoelgbaykdlumiass"
+.entry D4
+D342:   .data -1691, -5054, -7632, K0
+D343:   .data K3, 7309, K8, -1582
+D344:   .string "shkatgrf"
+D345:   .data -2881, -4046
+D346:   .data 1966, K9, 6417, K2, K6, -7515, K2
+        dec  D193[K7]
+D347:   .data K8, 3893, -409, -817, K7, -6697, 7251
+D348:   .data K0, K6, -3620, -4597, K3
+.define K10 = 53
+D349:   .data K0, 3041
+D350:   .string "dwnxziluzvuslvlb"
+D351:   .string "rxhsbfvryoccvi"
+D352:   .data K0, 803, -3217, -7911, -3003
+        red  r1
+D353:   .data -622
+D354:   .string "jzocrlbwrbxbd"
+D355:   .data -5570, 1290, -4262, -137
+D356:   .string "hdqbgmfmeki"
+.define K11 = 7
+D357:   .string "ojferpvkqotobdaaythxn"
+        jmp  D239
+D358:   .string "r"
+; generated comment line
+D359:   .string "dljztemqoq"
+        sub  D194[12], r7
+D360:   .data -2892, 3228, -1598, -6198
+D361:   .data -5752
+D362:   .string "mpiknjyrwlbum"
+D363:   .string "vf"
+D364:   .data 466, -4883, 1489, K0, -3448, 2650, -6221, -5895
+D365:   .string "qmngkqhkxzdxldvfjoa"
+        inc  r3
+D366:   .string "jeatbecjeswtczacnfyeeedz"
+D367:   .string "qvwccqz"
+; generated comment line
+; generated comment line
+D368:   .string "bhnwolowcuqme"
+        prn  D324
+D369:   .string "j"
+D370:   .string "nysgfoku"
+D371:   .data 6062, 3529, K5, K1, K6, 4127
+        cmp  #1461, #73
+D372:   .string "chtjynlkelqqkrdn"
+D373:   .string "irhrywmmvpjunsiytct"
+D374:   .data 2963, K8, 102, K8, -3151, 3397, -3792
+D375:   .string "uibypchsvycdshgbwnosnoh"
+D376:   .data 7792, 7107, K8, -1748, 3892, -7851, -2697, 7436
+D377:   .data 1126, K9, -3684, 1176, -6189, K7
+D378:   .string "qoazqdrlurdfw"
+D379:   .data 366
+D380:   .data K2, 1433, 879, -1426, 5730
+.entry L5
+D381:   .string "mdxcihpgdlbedsphiwx"
+.define K12 = 48
+D382:   .string "nfvynpjjqumq"
+.define K13 = 60
+D383:   .data K3, 3476, 5941, 1681, -4795, -1301, -2953
+.define K14 = 5
+D384:   .data K13
+D385:   .data -6570, -5485
+D386:   .data 1725, -4311, K7, 2068, K6, K11
+D387:   .string "waadnofgonkcsy"
+D388:   .data 1471, -7122, -6843, K14, -5487
+D389:   .data 1596
+D390:   .string "isrtrbyewbc"
+D391:   .data K1, 3747, -1419, 5226
+D392:   .data 5823, -4790
+D393:   .data -3113, 6871, -2187, 4080, -7424
+D394:   .data -55, 5882, 1490, 2024
+D395:   .data 6222, -3386, K5, -7570, 6196, -6353
+.define K15 = 56
+D396:   .data K14, -4807
+D397:   .data K6, 1387, K9, -6895, 1006, -777, 2559, K7
+        rts
+D398:   .data K1, K2, K15, K7, -3679
+; generated comment line
+D399:   .string "dgabydnljxkz"
+D400:   .string "dzemvcc"
+D401:   .string "zecjtwogq"
+        not  D373[K10]
+D402:   .string "jfjkhyelpdci"
+D403:   .data 4968, -4492, -5070, K6, 467
+D404:   .data 491, 5021, K12, 5785, K14
+D405:   .data K12, K0, -5308, K11, 5986
+D406:   .string "ccnftampezdghvvjovtf"
+D407:   .string "mszqos"
+D408:   .data 5231, K10, 5213, -6638
+; generated comment line
+D409:   .string "dy"
+D410:   .string "c"
+D411:   .data -7046, K9
+D412:   .data K4, 1450, 2079, -5917, -4226, 5974, K12
+D413:   .data 4468, -5562, 7540
+        jsr  D325
+        bne  r3
+; generated comment line
+D414:   .string "zushkreavrzq"
+D415:   .data -7535, K14, -6620
+D416:   .data 7313, -4307, 3463, 1832, K6, 1682, -6213
+D417:   .data 3875, 511, -5626, K4
+D418:   .data -2664, 5799, K13
+.define K16 = 33
+; generated comment line
+D419:   .data 2749, K2, -2399, 3269, 1421, K13, -579
+D420:   .string "prlnqyxzxrg"
+D421:   .string "zwgmivgpvgkmppwjjrlr"
+D422:   .data 7477, 7306
+D423:   .data 3718, -5840, -1881, K14, -3063, 6038, 4983, -2037
+L12:   inc  D177[K13]
+D424:   .data K15, 987, 4674, 2634
+D425:   .string "eue"
+D426:   .data K6, K11, 5443
+        hlt
+D427:   .data 7202, 1237, K3, K16, 6293, -4614, K14
+D428:   .data 7561, 6735, K3, 3187, K0, -6083
+D429:   .data 5936, -2694, 4820, 841, 4623, -3861
+L13:   hlt
+D430:   .data -719
+D431:   .data -1650
+D432:   .data -1188, 1156, -7387, K9
+D433:   .string "xverg"
+D434:   .data K8, 5261, -1443, -6164, -7279, -1617, 1943
+D435:   .data 5604
+D436:   .string "xltslkaonoggvyvzntfdbl"
+.define K17 = 47
+D437:   .data -5365, -4175, K11, -3298
+D438:   .data 4008, 1828, K12, 1654, -1372, -2029, -7036, -4652
+D439:   .string "eyuk"
+D440:   .data 3668
+L14:   clr  r1
+D441:   .string "rjuwlqucqigy"
+D442:   .data K1, -941, -7083, 4076, 122
+; generated comment line
+L15:   prn  D192
+D443:   .data -1798, 7797
+        cmp  r5, #K9
+D444:   .data K15, 7556, 2687, -5045, K9, -5889
+D445:   .data K10, -6772, 4382, 1233
+D446:   .string "uexvdakeytjfqficivkdki"
+D447:   .string "awsmiarhvzryugiq"
+D448:   .string "vkpwhgojg"
+D449:   .string "orustwtpgnfgxjmqpu"
+        cmp  D288[K17], r3
+D450:   .data 1338, K12, K15, 528, 5056
+D451:   .data 2548, 3520, 7321, 5942, -4177, 3924, 5012
+D452:   .data -7402, K0, -7405
+D453:   .data 4554, 6558, K17, 6188
+D454:   .data -6607, 7680, -2561
+D455:   .data K7, -3886, K15, -5629, 7718, -1161
+; generated comment line
+D456:   .data 6961, -7188
+D457:   .data -7272, 455, 3858, K9, 7088
+D458:   .string "dbfd"
+        red  r0
+D459:   .string "ejydh"
+D460:   .data -3973, K17
+        clr  D333[K4]
+D461:   .data K5, 3446, -5460, 521, K11, K2, 3088, 1594
+D462:   .data K16, 4702, 903
+D463:   .data 2253, K8, K7, K17
+D464:   .data -2589, -6725, 4880, 3794, -6210, 4153, -2248
+D465:   .string "xxambjbx"
+D466:   .string "aksixvvvbtsrqla"
+D467:   .data 4870, -7618, 1204, -1524, -5675, 2283
+D468:   .data 4266, 4816, 4779, -228
+D469:   .data -1860, 6198, 4707, -1885
+D470:   .string "tgrvbtasxu"
+D471:   .string "vhbmpgkqpkoy"
+.define K18 = 36
+D472:   .data -4119, -81, -3818, K9, -2335, 5473
+D473:   .data -3029, K0, -4643
+D474:   .data 1650, -6451, K17, -136
+D475:   .string "yys"
+.entry D5
+D476:   .data K11, 3863, K0, K13, 7197, -733, K18
+D477:   .string "tnsmzgesgewoouuezf"
+D478:   .data 2794, 4904, K9, 5496
+D479:   .string "gckuyteujvwnevom"
+        not  D370[3]
+D480:   .data -7103, -1931, -7083, 5889, 3682, K12
+D481:   .string "xdvah"
+D482:   .string "dbcykg"
+D483:   .string "epgqypwjakmvpm"
+        lea  D323[10], r1
+D484:   .data K2
+D485:   .string "ovgpmmtufmzcpwofidrw"
+D486:   .data -3099, 882, -5906
+D487:   .string "nxfoskcthkencmsabrqnw"
+D488:   .string "yalon"
+.define K19 = 5
+D489:   .data -5333, -3310, K0, K12, -2118, K9, 1716, -492
+        bne  r4
+D490:   .string "isvvwvltol"
+D491:   .string "yyrd"
+D492:   .data K17, 5975, -7130, -467, 3665
+D493:   .data -2505, -4643, -1268
+D494:   .string "jurzzzzvfzjrxy"
+D495:   .data 7026, 7548, -3373, K8
+D496:   .string "aj"
+D497:   .data 3818, 3955, 5270, -1246, 2354, 2447, K8, -3737
+D498:   .string "iy"
+D499:   .data K0
+D500:   .data K13, K0, -1857, 2193, 5803, 7718, 3577
+D501:   .data K8, K1
+D502:   .string "iaafebrhslaxpx"
+        jmp  r7
+D503:   .data -5722, -6944, -7627, -37, 3607
+        red  D179
+D504:   .string "eb"
+D505:   .data 4699, K13, K6
+D506:   .data 7966
+; generated comment line
+D507:   .data K17, 1202
+D508:   .data 3775, -5178, K7, -886
+D509:   .string "bqcrotirdltirokyfksg"
+D510:   .data 5771, -1889
+; generated comment line
+D511:   .string "mhwjtrbngrxcsvnmsvoiq"
+D512:   .data K18, 4849
+D513:   .string "irxckcmzo"
+D514:   .string "x"
+D515:   .data 1965, K4
+        not  D262[K4]
+D516:   .data K8, 3024, K17, 1039, 4721, -536, 7382
+D517:   .data 1904, K17, 6734, -6982
+D518:   .data 2037, -2308, -980, 1724, -2405, 7897, -5122
+        cmp  r7, #763
+D519:   .string "tipvgchuqanxzo"
+D520:   .data 687, -1612, K0, K17, -869
+D521:   .data -3748
+; generated comment line
+D522:   .data 3931, 1060, K14, -1700, K15
+; generated comment line
+D523:   .string "oucoetqrsjunwsnwx"
+D524:   .data -6554, -4033, K7, 3896, -1961, K1, -5336
+D525:   .data 5580, -2131, -2033, 2916, 5772
+D526:   .string "qlywkuppcvupwuo"
+D527:   .data 5205, 7890, -7637, 2864, -304
+D528:   .data 1506, K4, -4961, 4010, -4742, 7970, 4768
+D529:   .data 7879
+D530:   .data -7444, -3893, 4814, -7212, -3063, -1212
+        inc  D226[5]
+D531:   .data -7011, -3144, 4744, K1, K15, -4494
+D532:   .string "nwtnbhrxxxdtnioszaon"
+D533:   .data 4974, 2411
+D534:   .data 6197, -4895, K17, 1356, K19, K15
+D535:   .data 4194, K9, -796, 2876, K7, K2
+D536:   .string "uwynianfgfxv"
+D537:   .data -1580
+D538:   .data 1698, -4377, -7213
+D539:   .data -7382, -1915, 3556, 4902, 3959, -1362, -2129
+D540:   .string "vncsksihhnvlje"
+D541:   .data -6677, -5343
+D542:   .data 5645, K17, K9, 4742, 6974, K11, -7834, 748
+.define K20 = 44
+D543:   .string "rvwyajf"
+D544:   .data -3555, -7240, 67, -6121, -5654
+D545:   .string "slrdpaxoieruiwnezrbrphln"
+D546:   .string "dotnfnxmlrwophwqx"
+        jmp  D502
+D547:   .data K0, 7945, 2194, K5, -1709, K5, K17
+D548:   .data -640, -1330, -3099, -2441
+D549:   .data K16, -352, 4332, 5482
+D550:   .data -3193, 2524, 4547
+D551:   .data K6, 4244, 7638, -3988, K16
+D552:   .string "gqbj"
+D553:   .data 3578, K4, -4873
+D554:   .data 5711, 7366, -111, -2131, 5825, 4353, 5517, 5710
+D555:   .string "kgxxrqlwutlbkwicfjpgpqe"
+D556:   .data -446
+D557:   .data -5062, -3380
+D558:   .string "fdt"
+D559:   .data 4814, K16, K5, -6721, K16, -1631, K18
+D560:   .data K20, K0, K12, -4846, 6739, -6211
+D561:   .string "fsap"
+D562:   .data K19, 629, K3
+D563:   .data 5340, 4751, K19, K2
+D564:   .data 4034, 1474, K15
+D565:   .data 5555, 2528, 3817
+D566:   .data 5406, K13, K10, -3226, K9, 4896, -800, K13
+D567:   .string "ginxka"
+D568:   .string "xpz"
+.entry L6
+D569:   .string "vlamrhxdycx"
+D570:   .data -3141, 3539, -2466, K3, -1085, -4663
+D571:   .string "slhabxhhlrlth"
+D572:   .string "agleavujbuc"
+D573:   .data 6371, 4179, 5679, -2565, 4346, 3081
+D574:   .data -6693, K0, 6387, -1638, -6046, -1775, -684
+        not  D460
+D575:   .string "azjx"
+D576:   .data -1734, 1581, K8, K17, 1965, -7598, K9
+D577:   .string "lhodwrphmkznjxjjemckod"
+D578:   .string "nhszkjorarpqjczqhelhejmq"
+D579:   .data -5446, K17, 1702, -2500, 7647
+D580:   .data -5403
+        not  r1
+D581:   .data 7077, K9
+D582:   .data 5541, 7655, -4052, 7094, -2378, -7130
+        add  r3, D434
+D583:   .string "skrsbvhdpwdryift"
+        prn  #K7
+D584:   .data -5493, 1340, 204, K15, 1488
+D585:   .string "zqceevvnxwtembzty"
+D586:   .data 720, 6996, 1960, K14, K14, -4003, -3550
+D587:   .data -3278, -1805, -2014, K3, -7334
+D588:   .data 5937, 2066, -6451, K2, K12, K9, -989
+L16:   clr  D29[K8]
+D589:   .data K14, 983, K1, -6012
+D590:   .string "cyvjpyxigpzde"
+D591:   .data 7087
+D592:   .string "csmh"
+D593:   .string "owbpkikyy"
+D594:   .data 2809, -7420, K2, 3826, -5451, K14
+D595:   .data -2014, K13, K10, 2809, -1063
+D596:   .data K17, -7404, 659, K15
+D597:   .data -4432, -7848, -6759, -7205, -3184
+D598:   .data -2726, K18
+D599:   .data K9, -5592, -7144
+D600:   .data 620, 5496, 2321, -3986, -7769, -4468, -4852
+D601:   .string "yeuwqvlwpik"
+D602:   .data -3410, K0, 6530, -7351, 2136
+D603:   .data 4797, K5, -6710, K19
+; generated comment line
+D604:   .data -2411, -7117, K17, -4599, -5756, 6708, K20
+D605:   .data 842, K15, -6808, 6569, 6565, -4231, 3519, -3221
+D606:   .data 5509
+D607:   .data -6455, 610, 5801, 627
+D608:   .data 233, 4364, 7781, K15, -2380, 1684
+D609:   .data 7588, -6335, K5, K4, 6536, 7154, 663
+D610:   .data 2550, -5921, 2776
+D611:   .string "kusdqx"
+; generated comment line
+        sub  #-434, r7
+D612:   .data -4015, -112, 50, 5987, -2182, -2853, -6187
+D613:   .data -3972, K19, 6955, 331, 2185, -4188, -3628, 7342
+D614:   .data 1310, 150, -2612, -6044, 1133, 963
+D615:   .string "uelgwvrankrh"
+D616:   .data 7483, -4293, K1, -3889, K8, -4939, 2226
+D617:   .data -1364, -3115, 3179
+D618:   .data K4, 4636, -2668, -3880, -7801
+D619:   .string "flzzkqradz"
+D620:   .string "enrqexrm"
+D621:   .string "okx"
+; generated comment line
+D622:   .data 6890, K8
+D623:   .data -1592, K10
+D624:   .data K7, -1707, -5989, K3, -3298, -447, -7122
+D625:   .data K11, K8, K4, 3104, -1210
+.define K21 = 42
+D626:   .data 6657, K6, -1219, K0, 2439, K10, K10, K1
+        sub  D497[3], D532
+D627:   .data -6373, 6898, 3357, 5913
+L17:   jsr  D154
+D628:   .data K18, 5015, -5038
+D629:   .string "ppxskyglblczskohcdakotx"
+D630:   .string "mqgjlzfbw"
+D631:   .data K4
+D632:   .data K7, -259, K12, -4030
+D633:   .string "wtakfurfkjlcptac"
+D634:   .data 4212, -6399
+D635:   .data K8, -3755, K4, -3160, 696, -147, 6542
+        rts
+D636:   .data 38, 6895, -7044
+D637:   .string "kxoquwyyeiczvyfoyqgkbccz"
+D638:   .data -6667, -5447, -2143, K15, 3473
+D639:   .data -7381, -4903, K20, -2693, 2697, -569, -4033
+D640:   .string "gitcd"
+.entry D6
+D641:   .data 2429
+        inc  D57
+D642:   .data 4857, -7650, K9, -4406
+D643:   .data 2112, K17, 3761, 7487, 7823, -4533, -3849, 2390
+D644:   .data 2698, 167, K8
+D645:   .string "yfuepsyy"
+D646:   .string "m"
+D647:   .string "yxdoh"
+D648:   .data -7574, -3450, 473
+D649:   .string "vrhzcmixkzxtetcrxzkwf"
+D650:   .string "vjygementdxtrunm"
+L18:   not  D553[12]
+D651:   .data -6609, -4304, 2296, 5945, K16, -5546, K9, -6142
+D652:   .data -246, K18
+D653:   .data -2818, K19, 1346, 861, 3777, K0, 1016, 1098
+D654:   .string "jcruuojuyijedhhprxxr"
+        inc  D256
+D655:   .data 4769
+D656:   .data 786, K17, K16, K17
+D657:   .data 2823
+D658:   .data K4, -1257, K4, 5236, -6230, K2, K19
+D659:   .data -6811, K16
+D660:   .data K0, 3322
+L19:   mov  #252, D253
+D661:   .data -7127, -416, 6926, -2385, 4030, K8, -586, 4446
+D662:   .string "cyltwzctcitvzm"
+D663:   .string "xnmplvpmtvlqxzkuf"
+D664:   .data -5211, 2704, -5438
+D665:   .data 6028, K20, K17, -973, K13, K20, K9, -101
+D666:   .string "zxyemsgynntdrou"
+.entry L7
+D667:   .data 7025, K11, -5941, K11, -7884, -4592, 582
+D668:   .string "umbapradzwxboyzqlwqhpb"
+D669:   .string "udjauxc"
+D670:   .data 451
+D671:   .string "zoquktuxppcnb"
+D672:   .data K16, 3358
+D673:   .data K2, 5897, -1825, 6622, 466
+.entry D7
+D674:   .data K21, 4526, -6059
+D675:   .data -4465, 4857, K9, 3142, K1, -4681, -646, 363
+D676:   .string "aldxvqsa"
+D677:   .data -4805, 7078, K15, 7684, 6565
+D678:   .data 4663, 6993, 4703, K16
+        mov  D388[15], D238
+L20:   jsr  r1
+.entry L8
+D679:   .data K16, -5440
+L21:   jsr  D317
+D680:   .data K20, 4804, 6286, -3949, -3164, -7633, 1182, -3019
+D681:   .data 888, K14, -5012, -1489, -5206, 6567
+D682:   .string "gyujgfvzmfozvtmkrhpp"
+D683:   .string "eai"
+D684:   .string "dbxp"
+D685:   .data -3542
+D686:   .data 7978, 7810
+L22:   mov  #1527, D544[6]
+        not  D271[K21]
+D687:   .data K16, 7337
+L23:   prn  D11[K3]
+D688:   .data 3554, 7654, 1896, 113, -1177, -3989, K0, K17
+D689:   .data -1148
+D690:   .data -491, 5795
+D691:   .data K19, -7867, -3995
+D692:   .data -225, K12, -2287, K0, -938, 7302, 2888
+D693:   .data 6063, -2612, 98, 3341, -2156
+D694:   .string "ywymdjxtujko"
+; generated comment line
+D695:   .data -7248, K12, K16, K14, -884
+D696:   .data -987, K7, -5026, 3004
+        prn  D15[K12]
+.entry D8
+D697:   .data 1332
+D698:   .data 5827, 2363, -3008, 6821, -3032, K13, -2201, 2334
+D699:   .data 3186, -2277, -2, 4229, 5620, 2510
+D700:   .data 6555, 4255, K14, 5645
+D701:   .data -7518, -3383, 2894, 6150, K8, 752, 1402
+L24:   cmp  D225[3], D566[K6]
+D702:   .data 3628, K8, 5754, -7388, -7306, -3292, -5299
+L25:   red  D699
+D703:   .data 4830, -531, -821, -2530, 7495, -3003
+        jsr  r0
+        sub  #986, D647
+D704:   .data 4442, -7270
+D705:   .data K16
+D706:   .string "rrqhbhaxiqya"
+.define K22 = 59
+D707:   .data 6008, 6264, K22, K7, 848, -4037
+D708:   .data 7697
+        jsr  D337
+D709:   .data 2135, 7141, K10
+D710:   .string "ryjpnhuiwcjk"
+D711:   .data K14
+D712:   .data 5795, -3537, -7917
+        clr  r2
+D713:   .string "agnsftksznbwzbbzbedhicdq"
+D714:   .string "zqqyvbsfesjkcugnsk"
+        prn  D349
+        bne  D218
+D715:   .data K9
+D716:   .data 440, K22
+D717:   .string "rahsllxaajxdxxtkwuce"
+D718:   .string "tbfsfstslwtban"
+        red  r3
+D719:   .data K1, -3456, K5, 3652, 3561, 5949
+D720:   .string "yscpflrc"
+D721:   .data 735, -5433
+D722:   .data 5716
+D723:   .data -3137, 1348, 1934, 1998, 1022, K7
+D724:   .string "nxhfxp"
+D725:   .string "s"
+D726:   .data 4155, 3169, K9, -2482
+D727:   .data 3736, -748, K15, 3302, -6124, 3459, -268, 6724
+D728:   .data K4, -3424, -2762, K22
+; generated comment line
+D729:   .data -2175, K4, -3189, 6280, -5959, 4962
+D730:   .string "smiqmgrrxedhahkihboia"
+D731:   .data 1630, 7817, 6826
+        jmp  D174
+D732:   .data 1234, 7524, -4763, K9, -7517, -5968
+D733:   .data K4, 2140, 541, K20, -7423, -7023, K13, 240
+D734:   .data K22, K0, -7385, 3676, -572, 2544, 1422, 1992
+D735:   .data -1880, K14, 6432, K2, -2155, -4249, K5, K19
+D736:   .string "mjedyjecpqvohcxsujsrfq"
+L26:   jmp  r4
+D737:   .data 7536
+        sub  r2, D64[K19]
+D738:   .data K12, K9, -576
+D739:   .data K20, -7196, 1968, -3319, -2778, -2401
+D740:   .string "gcuiokyiexfspy"
+D741:   .string "ybkcjxk"
+        mov  #1323, D435[K10]
+; generated comment line
+.define K23 = 46
+D742:   .data -3353, -2343, 5368, -5297, -7485, K22, K20
+D743:   .string "zkiafrgnlnfvfxxfjhygmhck"
+D744:   .string "rw"
+D745:   .data -2516, -4867, -6015, 3812, -3715, K16, 3916, 236
+D746:   .data -4068, 5881, K11, K12, 128, 5418, -7409
+D747:   .data -1650, -1865, -2064
+        not  r4
+D748:   .data -1578, 7542, 5723, 1383, K14, -2845
+D749:   .data 7784, -3126
+D750:   .data 310, 5515
+D751:   .string "pqme"
+D752:   .data 4291, -3519, -2020, 4492
+D753:   .data 37, -1866, -6418, -924, -5956, -6651, -2021, 4484
+D754:   .string "peixlozwxza"
+D755:   .string "rxlmov"
+D756:   .data 973, 778, 7539, -5669, K19, -3851
+D757:   .data K8, K21, K14, K19, K19, -3411, 2577, -2689
+        prn  D251
+D758:   .data 6689, -5388, -5211, -4188, 3499, -5982, 6909, K11
+D759:   .string "duymkrnimkcdeocmzh"
+; generated comment line
+.define K24 = 19
+D760:   .data -4570, K8
+D761:   .string "wykasamuznjctlademtxoee"
+D762:   .data K12
+D763:   .data K12
+D764:   .data -6873, 4876, -4143, 5940, K7, -6989, -3894, 7861
+D765:   .data -3209, 4794, -3167, -4112, -3414, K24, 335
+D766:   .string "ganxduuqutrn"
+D767:   .data K12, -7764, -4202
+D768:   .data 2366, -1936, K16, 1145, 4331, 4269
+D769:   .data K18, K14, -749
+D770:   .data -432, -423, 5577
+D771:   .string "hwovcvjqvdwdriqlc"
+D772:   .string "htrswumhjwqzmymahhqxi"
+D773:   .data K22, 4830, -6297, 3124, -6307
+D774:   .data 7874, K15, K12, -4246
+D775:   .string "qzqoagcdyqpp"
+D776:   .data 7078, 277, 3112, 6974, -1149, K10, -2045, -527
+D777:   .data -5433, -1258, -7139, 6593, 1316, 1538
+D778:   .data 6204, K21, -21, 7415, 6497, 1997
+D779:   .string "vnhcsspoevmpbc"
+D780:   .string "tyjvfxvclfmiza"
+D781:   .string "hekobd"
+D782:   .string "sdwicsdwmsfcgrn"
+D783:   .string "tcqilibxuicnfxbi"
+D784:   .data K3, -2859
+; generated comment line
+D785:   .string "biixzntrlo"
+D786:   .string "crznhlz"
+D787:   .data 3428, 7724, 1373
+; generated comment line
+D788:   .string "ret"
+D789:   .data K12, 2988
+D790:   .data K17, -198, 1520, -77, 1112, K18, 2223
+        hlt
+D791:   .string "nldkkhedmxjddgzgewly"
+D792:   .data -7823, -133
+D793:   .data 4341, 5964, -1505, K22, 359, -6803, K5, 1178
+D794:   .data 6836, -3696, K22, 5410
+L27:   hlt
+D795:   .data K19, 5871, K3, -2612, -4926, K9, K16
+; generated comment line
+D796:   .data K23, 7015, -6588, -1707, 222, K18
+D797:   .data K19, K4, -2719, -6714, -5571
+        rts
+D798:   .data K9, 2158, 982, 4074, 1966, 1509, -3092
+D799:   .string "euvvjskvqxxknf"
+D800:   .string "dbxgzxkgpwcud"
+D801:   .string "diyfffiocgftpyvcs"
+; generated comment line
+; generated comment line
+D802:   .data 7483, K23, -5106, K11, 7513, 3245, 344
+D803:   .data 4114, 3212, 4358, -2136, 806, K21, K7
+D804:   .data -3242, -6481, K19, 296, -4665, K17, 4376
+D805:   .string "huofl"
+D806:   .data 956, 355, 2016, 4886, K5
+D807:   .string "ufodwosoroxx"
+D808:   .string "ljqras"
+D809:   .string "oyyslbwzwooqqlo"
+D810:   .string "ggflszxb"
+D811:   .string "vrisjvpfsmrpt"
+D812:   .string "vzbewcyjsbrwkkttilfjvv"
+D813:   .data -2081, 3268, K22, -4856
+D814:   .data -7527, -4194, -485
+D815:   .data 5157, 849, K14, 6332, K18, K22
+D816:   .data 658, K6, -6892, 5996, K12, K5
+D817:   .data 2012, 4519, 6486, 429
+D818:   .string "hmkqdqnzyqwxzr"
+D819:   .string "qbizltgbmnx"
+D820:   .string "hxhtfzkeisk"
+D821:   .string "drpkhkzc"
+D822:   .data 3778, -1318
+D823:   .data K14, -1802, -4690, K8, 2134, -7972
+D824:   .string "kbqprkmqntxzgafjydrh"
+D825:   .data 5662, -7200, -2519
+D826:   .string "pwcsjmo"
+D827:   .string "pbpltvpvvmaxc"
+D828:   .string "vlurryczhmobgi"
+D829:   .string "p"
+D830:   .data -4354, K1, 4217, -6526, K2, 2243
+        rts
+D831:   .string "ngpgyhhlimny"
+D832:   .data -2852
+D833:   .data 2218, -2121, -7028, -2829, 2277
+.entry L9
+D834:   .data 516, -3898, 2524, K7, K6, 1708
+D835:   .data 7643, -2157, 3544, -7939, 6976, K24, 4479, 4214
+D836:   .data -918, 979, -3466, -6979, -2196, 6406
+D837:   .data 7923, 7991, K14, 5157
+D838:   .data 5850, 6209, -1530, -386, K3, 1512, -7374
+D839:   .string "dkgygsknrz"
+D840:   .data 3262, K14, K13, -6609, K9, -6383, K7
+D841:   .string "ojezwkdwdbuthy"
+        rts
+D842:   .data 6216, -1419, 600, 2588, 2539, 1100
+L28:   add  D24[2], D289
+D843:   .data 4922, 1955, 80, 857, -6898, -6946, -5072
+D844:   .data 6038
+D845:   .string "shmooaivmyhrkcjf"
+D846:   .string "lq"
+D847:   .data -7236, 7893, -5491, -2368, K5, 3235
+D848:   .string "fjdi"
+        sub  D387, r1
+D849:   .string "xtptnlxnpflmictuypu"
+D850:   .string "stvla"
+        sub  D567[K23], D587
+D851:   .string "mccp"
+D852:   .data 4742, 1946, K12, K1, K8, K1
+D853:   .data -158, 7835
+D854:   .data -2715, -7905, -7120
+        clr  D802
+D855:   .string "r"
+        inc  D59
+D856:   .data -7553, -1603, -776, -7038, -4068, 209
+.define K25 = 12
+D857:   .data -7945, K17, K15, 4104, -368, 5590
+D858:   .data 5892, -6548, -6579, K20
+D859:   .string "xtevyvlsquljxtecnbkrl"
+L29:   dec  r4
+.entry D9
+D860:   .data -745, 5340, 3686, -5914, 598, K4
+        cmp  r3, r7
+        dec  r3
+D861:   .data -3465, 5812, -1003, 380
+D862:   .data K17, K8, K9, -5779, K10, 1133, K18
+D863:   .data 7616, -7590, K19, 7136, -2628, 3351, -2131, -71
+        sub  D670[K24], D570[14]
+D864:   .string "ckvbngxtszsqhxaquru"
+D865:   .string "glkmhxe"
+D866:   .string "uktrzmytcptsxrzvqn"
+D867:   .data -1781, K16, 436, 5382, 6393
+D868:   .data 2504, 3691, -4912, K6, K21, 6103
+D869:   .data -2008, 3974, 4864, K14, -2665
+D870:   .data -392, K5, 6125
+D871:   .data K16, 3682, 1317, K1, 6207
+D872:   .data K7, K19, -599
+D873:   .data 971, K19, -3964
+D874:   .data 3511, K22, 2400, 6024, -1975
+D875:   .data K24, K11, -4150, K5, -7360, 6108, 1975
+D876:   .data -7624
+D877:   .data -280, -2815, 7134, -1641, -2436
+D878:   .data -2078, 5470, K4, -293, 7494
+D879:   .data 7942, K11, 7700
+D880:   .data -2311, -7288, -6585
+D881:   .string "wlhsmf"
+D882:   .string "kcppzlydblxeeoovsrpi"
+D883:   .data -7080, 3481, 3605, -7319, -209, -2085, 5792, K20
+D884:   .data -3170, 3781, -3286, -6905, -6588
+        jmp  r4
+L30:   dec  r4
+D885:   .data -610, 788, 5169, K25, K0, -136, 5602, -4089
+.define K26 = 51
+D886:   .data 1449, K9, -2763
+D887:   .string "ruzvkqellvxswmpexhvgv"
+D888:   .string "lsilhjdzrksa"
+D889:   .string "xrhxpulkzknwnbgxqpgb"
+D890:   .data -6669, 5532, -7634, -6489, K8, 5799
+D891:   .data -4771, K2, 6333
+D892:   .data K2, 2559, K22, -667
+D893:   .string "vspajtjtkxscsde"
+D894:   .data K10, -5403, -6519, 2615
+D895:   .data K1, -5847, -535, -6977, -6407, 6924, 7165
+        sub  r2, D90[12]
+D896:   .string "ewqiflaysqro"
+D897:   .string "ppfjczmgbptugbawugi"
+D898:   .data K25, 3159, 6105, K19, -814, -5040, K21
+.define K27 = 3
+D899:   .string "k"
+D900:   .data 1704, K7, 4614, 1350, -6938
+D901:   .data 76, K15
+L31:   add  D705[2], D731
+        dec  D350[K23]
+D902:   .string "tiklpfioywn"
+D903:   .data -4870, K2, -3420
+L32:   dec  r5
+D904:   .string "goqznjhjm"
+; generated comment line
+D905:   .string "tylqvmlmmnszmxsdkmzib"
+D906:   .string "hmbzaipgbwcrnlomye"
+D907:   .data -2853
+D908:   .string "gvpqborguqktubdhc"
+D909:   .string "gpqoaqiecuedrejg"
+D910:   .data -3415, K10, -7999, K8, -4635
+D911:   .data 2304, -5674, 5211, K22, 3291, 3081
+D912:   .string "lpbchdzbogugvc"
+D913:   .string "cgrhy"
+D914:   .data 5285, -3999
+D915:   .data -2802, 6504
+D916:   .string "jqtfkyjpfsr"
+D917:   .string "tilryozipyrrascj"
+D918:   .data 2146, -2346
+D919:   .string "locspwifrobxp"
+D920:   .string "nozdsigrdfd"
+D921:   .data 4156
+D922:   .data -3341, K13, 6999, K20, -2591, -129
+D923:   .string "kiwqnxnbxzijaxcxkzxct"
+D924:   .data -3670, 3619, K21
+D925:   .data K8, -2746
+D926:   .string "cnuxbwucznrnuqzhehfxrm"
+D927:   .data -838
+D928:   .data 808, -4846, -7566, 1474
+D929:   .string "cvnzpztrzr"
+D930:   .data K27, 4031, -3579, K27, 3378, K3, 6978, K21
+D931:   .data -3174
+D932:   .data 6713, K26, K20, -57, K18, 2212, 5850
+D933:   .data 7411
+D934:   .data -5280, K3, 2729
+D935:   .data -6186, K14, K26, K20, -72, K5
+D936:   .data -2411, K23, -1626, 4083, 5880, K21, -554
+D937:   .data -7258, 3229, 4580
+D938:   .data K22, 5503, -6894, -7727, K17, 824
+D939:   .string "ngnjdutp"
+D940:   .string "gqmjpdevyu"
+D941:   .string "iyoc"
+D942:   .data K19, K10, K5, 459
+D943:   .string "njciowmmnhfvhmgqkcytubc"
+        rts
+D944:   .string "r"
+D945:   .data 1998, -281, K23, -6944, 447, K17, -4080
+D946:   .data -1004, 437, -3753, 1132, 212
+D947:   .data K9, -4356, -6280, 6579, K11, K17, K18
+D948:   .data K9, 2229, -4547, 7197
+D949:   .data K26
+D950:   .data K12, -5913, -1614
+        bne  D263
+D951:   .data -7662, -13, K19, -6913, -1687, K3, -5194, K27
+D952:   .data -3198, 2833, -7281, K25, 5029, -4224, -6896, K13
+D953:   .data -2794, K3, -1036, 4501
+D954:   .string "rxjbptmcwpqavyvjomnx"
+D955:   .data 6429, -2039, K9, -6412, K11, K19
+D956:   .data -534, K1, 3052, 2052, K11, K14
+D957:   .string "uisf"
+D958:   .data 84, 733, -2264, K0
+D959:   .string "rcywnndfym"
+; generated comment line
+D960:   .data 7276, -7570, 2559, -2570, -6601, 1553
+.define K28 = 44
+        not  D189[9]
+D961:   .data -6944
+D962:   .string "qvry"
+D963:   .data K6, K22, 2350, -1498, K13, -3634
+D964:   .string "rfgzgfx"
+        jmp  r5
+        clr  D19[1]
+D965:   .data 6102, 216, 4705
+D966:   .string "xwcmdyi"
+        inc  D633
+D967:   .string "puup"
+D968:   .string "zlnolhskjzyudsmwfkhqud"
+        lea  D397, D645
+D969:   .data -3053
+.entry L10
+D970:   .data K5, 1930, 2957, -2342, K10, K11, -4024, -2860
+D971:   .data -4542, 1295, -3292, 4171, 6141
+D972:   .string "xgwatagqkotksf"
+D973:   .string "gzecxxbumzgf"
+L33:   jmp  r5
+D974:   .data 4846, -1419, 7012, -4290
+D975:   .string "hpifeonzhocwuvrxknss"
+D976:   .string "pmqsldeue"
+D977:   .data -6785, -2493, -3234
+D978:   .string "supstghyfeitmpmfgtmgj"
+D979:   .string "qvfmfpyitsva"
+D980:   .data -1136, 7572, -5853, -572, -2121, K23
+D981:   .data -4470, 5706
+D982:   .data K17
+D983:   .data 443, K8, -3197, 607
+D984:   .string "c"
+D985:   .data 6136, -3193, K27
+D986:   .string "a"
+D987:   .string "o"
+        mov  D557[12], r1
+D988:   .string "bqmjrv"
+D989:   .data 5879
+        sub  X8, r3
+D990:   .string "kxlqgcdvobbh"
+D991:   .data 3801, -6123, -3094, -2396
+D992:   .data -4336, 6663, K8, -6039, 1782, -425, 747
+        inc  r2
+D993:   .data -2303, 6376
+D994:   .string "pypewjksowdoqaxyubrs"
+D995:   .data -4374, 2909, 2647, 5544, K20, -1843, -3799, -3544
+        clr  L8[4]
+        prn  #-563
+D996:   .data -1264, 4570, 6580, -4183, 7919, 971
+D997:   .string "vwjifpmdmjijulpgjekjcan"
+D998:   .string "nkzurp"
+D999:   .string "dbzhuovjglvnregfw"
+; generated comment line
+        clr  r1
+D1000:   .string "jeckpsl"
+D1001:   .data 803, 7673, -4496, -5277, K6, -4501, 401, K17
+D1002:   .data 3423, -7288, 5380, K0, -4650
+.define K29 = 35
+        add  #-1990, D461
+        lea  D278[K7], D776
+D1003:   .data -6571, K2, -3434, 4376
+D1004:   .data K26, 3380, K1
+D1005:   .string "nrujcwpfekufacagqxq"
+D1006:   .data K5, K5, K4, -981, -482, -3395
+D1007:   .data K11, -621, -2912, 1017, 5132, 7363
+D1008:   .data K4, -1999, 1217, K3, -3168, 3587
+D1009:   .string "oezpxiheuahyr"
+D1010:   .data 4815, K0, -7582
+D1011:   .string "llxfmwogaynk"
+D1012:   .data K19, -4384, 2716, 1330, -7518, 6666, -1021, K27
+D1013:   .data 3804, -3569, K26, 2488
+D1014:   .data 7979, -3074, K28, K5, -4414, K5, -328
+D1015:   .string "tarqtocwwtyxrpyx"
+L34:   clr  r4
+D1016:   .data 6936, K24, -3051
+L35:   bne  D65
+D1017:   .data 2186, 5905
+D1018:   .data 4827, -1627, K25, -6606
+D1019:   .data -1765, -5906, -5411, 3643, K13, 7825
+D1020:   .data K6, 6264, 1191, 4210, K29, 4112, 3473
+D1021:   .data -2061, -6547, 2523, K24, 4557, K24, -5194, -2531
+D1022:   .string "bxejthtdszxouxgxon"
+D1023:   .data K17, 6360, -4144, K27, K2, 6054, 4322
+D1024:   .string "ombx"
+D1025:   .string "he"
+D1026:   .data K25, -6202, -5402, 3403
+D1027:   .data -6222
+D1028:   .string "zxapslvvmyxhxnxpywog"
+; generated comment line
+D1029:   .string "prufgvyxelzodktczujhgh"
+D1030:   .data 10, -6480, -6389, -4996
+L36:   clr  r2
+D1031:   .data 1923, K16, -873, K3
+D1032:   .string "kwpmngtrthmb"
+D1033:   .data -1244, -292, 7520, 3151, -4203
+D1034:   .string "ztyefohr"
+D1035:   .data 5073, -2780, 5845, -4908, -7333, 1362, 2093, K9
+D1036:   .data 3986, K2
+D1037:   .string "as"
+.entry D10
+D1038:   .data K22, K28, 4477, -7677, K7, -4602, -1815, -4842
+D1039:   .data K8, K12, K10, 3240, 1678
+D1040:   .string "abbghqmlna"
+D1041:   .data K16, K22, K29, K14, -5781, -3201, -3241, 1468
+D1042:   .data K28, -2094, 4739, 5471
+D1043:   .string "qdxnghdqcv"
+D1044:   .string "zhpcjcsjrfusy"
+D1045:   .string "xoriaapajqwkdj"
+; generated comment line
+.define K30 = 7
+; generated comment line
+D1046:   .string "rmqueeeheritqtsk"
+D1047:   .data K13, K16
+D1048:   .data -3007, 7338
+D1049:   .data 5701, 2898, 3278
+D1050:   .data 5609, -6292, 2512, 2751, -3904
+; generated comment line
+.entry L11
+D1051:   .data 1013
+D1052:   .string "kd"
+D1053:   .data -6227
+D1054:   .data -2780, 4045, -2654, -238, -2812, K19, K30, 1076
+D1055:   .data 6388, K14, K23, 3692, -2505
+D1056:   .data -3043, -7647, -7479, K16, -3911
+D1057:   .data 1843, -3295, K1, 5571, 657, -5489, -4025
+D1058:   .data -6286, 6662, 4453, K10, -4507
+        hlt
+D1059:   .data 3065, -5533, -959, 7590, K14, 5970
+D1060:   .data 7848, K9, 3097, 999, -649, 4595, -2593, -4098
+D1061:   .data 530, -5777, K3
+        rts
+; generated comment line
+D1062:   .data K28, K16, K13, K13, K3, 6175, -3087
+D1063:   .string "aor"
+D1064:   .data K18, K23
+D1065:   .data -1820, K25, K16, 4933, -2197, K11
+D1066:   .string "spnhptpum"
+D1067:   .string "lbffrfsvyrqbmhnib"
+.define K31 = 59
+D1068:   .string "xodwixmyrwulpcra"
+D1069:   .string "aqjzhbekpfcdvxnecfg"
+D1070:   .data -4133, 3904
+D1071:   .data 811, 4524, 2841, -4895, 3819, -7297, -227
+.entry D11
+D1072:   .data -6961, K7, -233, -4707, K7
+D1073:   .string "zlaqruwsh"
+D1074:   .string "ypvqygmxv"
+D1075:   .data K21, 3764, -2000, 1579, -543, 1165, K4
+D1076:   .string "ikdskgyyuaecyunvjs"
+        hlt
+D1077:   .string "paschekokajycznk"
+D1078:   .string "kslfjmwlsdnypv"
+D1079:   .string "vtreh"
+D1080:   .string "zomixdp"
+D1081:   .string "obd"
+D1082:   .data K28
+.entry L12
+D1083:   .string "kjkqcfwloiul"
+D1084:   .data 894
+D1085:   .data 2417, 3107, K16, K14, 6082, 3260, 1590, 2776
+D1086:   .data 1336, 6830, -4738, 4294, 5535
+.define K32 = 14
+D1087:   .string "cdxiipklyozhvmqo"
+        rts
+D1088:   .string "yekrnuz"
+D1089:   .string "wcwhm"
+D1090:   .data 917, 3125, K15, K11, -730, 5442
+D1091:   .data -7503, 199, -506
+L37:   hlt
+D1092:   .data -3146, 7069, 6988, 7979, -6610, 3636
+D1093:   .data K15, 2847, 7842, -2477, -6619, 1316, -5925
+D1094:   .data -24
+D1095:   .string "pvqysblwjnfzvzrdljduk"
+D1096:   .string "studzqwzl"
+D1097:   .data -5483, 449, K11, -6356, K18, K29
+D1098:   .data -5054, K0, 964, 5916, K18, K23
+D1099:   .string "ossncclbsrlzccolatvg"
+D1100:   .data 5735, -5988, -962, 6666, 229, 964, -1914, 2519
+D1101:   .string "txjndhoakskxjlnbfwv"
+D1102:   .data -7414, -7317, 1311
+D1103:   .string "x"
+D1104:   .string "wreelcqvakzjejsfvy"
+D1105:   .string "xp"
+D1106:   .string "rpefftj"
+D1107:   .data 2615, K20, 7697, -7194, 6016, K26, 2576, -5336
+.define K33 = 64
+D1108:   .data 277, 5819
+D1109:   .data -7834
+D1110:   .data 3939, -7363, 2416, -255, 4960, 2631
+D1111:   .data -1232, 366, K25, -2834, K0, -1047, -4110
+D1112:   .data -5448, -104, -4181
+.entry D12
+; generated comment line
+D1113:   .data 5890, 837, 7122, K9
+D1114:   .string "wgmemqecxhx"
+        lea  D1064[K21], D224
+D1115:   .string "sudaythsfuheurpjmivkp"
+D1116:   .string "nhbkxnzajhwu"
+D1117:   .string "gpfrkdoilflmyeyvb"
+D1118:   .string "emajebowwbhagk"
+D1119:   .data 5687, 3515, -1130
+        not  r7
+D1120:   .string "fcpoezuvebgju"
+; generated comment line
+D1121:   .string "evpkzpmstino"
+D1122:   .string "xaackjzwybmssithehcdoi"
+D1123:   .data 1995, -5293
+D1124:   .data -5378, -1970
+D1125:   .data K0, -5050, K21, -3072, 5568
+D1126:   .string "enyqdpgkhfefrvkjs"
+.define K34 = 45
+        jsr  r0
+D1127:   .data -4035, 5659, -4045, 4158, K16, 547, -4439, -6216
+D1128:   .data -2822, 2699
+D1129:   .data -1787, 847
+D1130:   .string "uynmclwndmmvlvmjvff"
+D1131:   .data 218, 4585, 1633, -4999
+D1132:   .data 1491
+D1133:   .string "mwlsocodyqshom"
+D1134:   .string "jtfmmshopvs"
+D1135:   .string "vpzmaa"
+D1136:   .data -1247, -1113, K23, 1611, K3, -5739
+D1137:   .data 2600, 3634, -5300, -2175, 6919, 5155
+        inc  D873
+        mov  r4, D787[K7]
+D1138:   .data -5368, K31, -7348, 6961, -6715, K3, -7170
+        clr  D226[K13]
+D1139:   .data 7055, 7708, K20, K21, 6405, -4409, 2316, -6506
+D1140:   .data 1064, -3083, 2717, -1017, -2821, 1401, -481, K33
+D1141:   .data -5949, 6313, K29, 5526
+D1142:   .data 3776, 6012, K0, -6834, 6204, -2325, 7196, 3756
+D1143:   .string "qyieliecutxxrsxkkthr"
+D1144:   .data 1098, K4
+        dec  D55[13]
+D1145:   .string "bujacflasmlqik"
+D1146:   .data 1266, -3795
+D1147:   .string "z"
+D1148:   .data -7307, 4602, -4788, -2291, K11, 5707, 5272, 2865
+D1149:   .data -4124, -667, K8, 4041
+D1150:   .data -2106, K6, -3465, K28, K14
+.define K35 = 8
+D1151:   .data -3688, 5878, 5872, K14, -121
+D1152:   .data 1576, K23, 1053
+D1153:   .data K12, 4306, 3093, K25, -6993
+D1154:   .string "elw"
+D1155:   .string "udsknufhelfafniozm"
+D1156:   .string "rpxammw"
+D1157:   .data K29, -7632, -4148
+D1158:   .data -2952
+D1159:   .data -1460, -5288, 3057, -1714, -2809, -4244, -3092
+D1160:   .data 5518, K0, 7947
+D1161:   .data -926, 3574, K7, 4740
+D1162:   .data -2775, -7368, 887
+D1163:   .data K7, 3882, K7, -2725, 7358, 3919
+D1164:   .string "sjnvlkqcytil"
+        dec  D243[9]
+D1165:   .data -2549, -571, -1805, K32, -411, K12, 2766, 245
+D1166:   .data -7213, K1
+        jsr  D199
+        hlt
+D1167:   .data -1170, K9
+D1168:   .data K16, 4200, -6702, -137
+        sub  r1, D871[8]
+D1169:   .data K7
+        rts
+D1170:   .data 3251, -5688, 4682, 1654
+D1171:   .data K33, -7465, 5577, 3550, -6669, -1823, -4385, 4188
+D1172:   .data -5705, 301, -583
+D1173:   .data 1934, -6426, -7897, -709, 4713
+        cmp  #-453, D348
+D1174:   .string "uwlpyrmprioelxtp"
+D1175:   .data 5748, -7713
+D1176:   .data 5051, -2589, K3
+D1177:   .string "mbce"
+D1178:   .string "kcdgzthvblfrngizczrrd"
+D1179:   .data 6716, 6829
+        sub  #-1421, D729
+D1180:   .data 330, K14
+D1181:   .string "kiieneuskb"
+D1182:   .string "srsw"
+D1183:   .data -7792, -4444, K2, K10
+D1184:   .data K10, 1095, 6473, K23, -1854, 320, K17
+D1185:   .data 7143, K24, K12
+D1186:   .data K19
+        lea  D33[K23], D787
+D1187:   .data -1065, -3623, 2646, 3743
+D1188:   .string "jiyreygtnvspcktpbe"
+D1189:   .data 5229, 146, -2454, K34, -4716, -6594, 1288
+D1190:   .data 3384, K18, -6207, 6131, -523, -4014, 448
+D1191:   .string "ojgd"
+D1192:   .data -6623
+D1193:   .string "dsjmgbwhfgfdubzcc"
+D1194:   .data 2260, -2847
+D1195:   .string "amfrsojuqgevtev"
+D1196:   .data K16, 6725, -905, 2143, K7, -6553, -541
+D1197:   .data K20, K34, -5076, -1061, K33
+D1198:   .data K2, 6340, 847, 2296, K7
+D1199:   .data -2047, K3
+D1200:   .data K22, -6389, 5561, K12
+        jmp  D1009
+L38:   bne  D916
+D1201:   .data -3619
+D1202:   .data 1577, 469, -4463, 1723, 7257, 6654, K11, 6058
+D1203:   .data -6880, K7, 2705, -6881, -7057, -1493, -4649, -1354
+D1204:   .data -5782, 135, K12
+D1205:   .data -7479, 4178, -6330, K0, K5, K26, K17, K32
+D1206:   .data -5001, -4270, -1590, -1050, 6969, K16, K25
+D1207:   .data -6308, K25, K9, -3459, 1763, K1
+D1208:   .string "eprnnzrkaqsobjntt"
+D1209:   .string "ifqrevbudc"
+D1210:   .data 4111, 2704, 5720, 153, K0, 694, K33, 2530
+D1211:   .data 2282, K20
+        cmp  r5, D627[2]
+D1212:   .data K33
+D1213:   .data 2947, 2505, K13
+; generated comment line
+D1214:   .data K18, -6002, 4141
+D1215:   .data 597, 1499, K14, 2208, 5127, 4643, 7872, 2049
+D1216:   .data -1550, K13, K12, K3
+        lea  D151, D482[K24]
+D1217:   .data 7818, K6, K29, 3957, -4110
+.define K36 = 61
+D1218:   .string "yktmyikgmaugmqztfy"
+D1219:   .data 6766
+D1220:   .data 6952, K5, 5766, 4914
+D1221:   .data 1421, -7084, 1348, -6124, -3661, 4273, 5910
+.define K37 = 34
+D1222:   .string "dflwph"
+D1223:   .string "fsiluewt"
+D1224:   .data 7074
+        sub  #-1500, r0
+D1225:   .data K35, K24, K1, -2309
+D1226:   .data 7907, K0, -2378, K30, -3071, 7189, 4480
+D1227:   .string "sorutcpazgalqhmzgjyqlmh"
+.define K38 = 32
+D1228:   .data 384, K31, K31, K27, -97, 6674
+D1229:   .data 2283, -728, -6114, K6, K19
+D1230:   .data K27, K18, -3128, 7348, -1875, -7574, -2045, 840
+.define K39 = 17
+D1231:   .data 1452, K34, 7785, -3905, -4802, -78, K39
+D1232:   .data 7310, -843, 2980, 2371, 6022, -820
+D1233:   .data K39, -2793, -5286, -2869, 2013, 1436, 5523
+D1234:   .string "osuhqzjmwutdmbplf"
+D1235:   .data -3663, 6847, K20, 5233, K8, 6554, 1953, 2278
+D1236:   .string "kjvxpvupfsylcfsp"
+D1237:   .string "qvzudqufuscwngeafqq"
+D1238:   .data 2829, 5080, K32, -2868, 3855
+D1239:   .data 5823, -6677, K10
+D1240:   .data -1027, 412, -482
+D1241:   .string "owdhfdnfwyeior"
+D1242:   .string "rjedodsvyhtmtufgfa"
+        hlt
+D1243:   .data -2242, 5252, 1663, -7408, 3894, -791, K22, -5111
+D1244:   .data K22, -1797, K9, 1185, 5118, -6649, -5233, K7
+D1245:   .data -2357, K12, K33, K26, K23, K15, 7153, -7563
+D1246:   .data 7322, K21, 2213, 453
+D1247:   .data -4225, K38, -399, K10, 6454, -282, -7000
+D1248:   .string "xlsysezhyoquzmiyofvlf"
+; generated comment line
+D1249:   .data 2991, 3100, -4592, K18, K14, K10
+D1250:   .data 4131, 7941, K15, 2238, -7268, K13, 3372
+D1251:   .string "kmkaopqyznwn"
+D1252:   .string "ilzxiuvsxlw"
+D1253:   .data -174, 4731, -6690, 2789, 5716, 5678
+        sub  r0, r6
+D1254:   .string "nwscqtfbwvikmfsnceolpm"
+D1255:   .data 5370, -2193, -5965, 4046, 5286
+D1256:   .data 346
+D1257:   .data -6471, K34
+.entry L13
+D1258:   .string "qlevgizyzbmfnednygtyzm"
+D1259:   .string "rgmaolhymlokawdrmxmfsm"
+        add  r0, r3
+D1260:   .data 5391, -1130, K12, K24
+D1261:   .data 1399
+; generated comment line
+D1262:   .string "aqlconxkgdnylbhit"
+D1263:   .data K34, -3657, -2363, K32, 1959, -1003, -7373, 1931
+D1264:   .string "u"
+D1265:   .data -6567, K20, -3303
+D1266:   .data -4491, -5247, -7395, -5337
+D1267:   .string "wcr"
+D1268:   .string "knfuurfjgndrthyhvumjab"
+D1269:   .string "iyonfypsqtcocmpggsbk"
+D1270:   .string "uzvtooipgdvc"
+D1271:   .data 5029, 906, K28, -3752, 5987, -6798
+        clr  D616[13]
+D1272:   .data -5184, 6154, -7708, -2983, -2273, 7035
+D1273:   .data -6840, 4400, 7041, K21, K3, -5573, 5835
+        not  D350
+D1274:   .data -55, -4067, K13, -2474, K0
+D1275:   .string "vosptwhldziydwnirvth"
+.entry D13
+        bne  D716
+D1276:   .data 4921, -113, 1875
+D1277:   .data K14, -1124, -5277, 3679, 2140, -3971, 3364, 7247
+D1278:   .data K28, K7, -75, K2, 1717, K10
+D1279:   .string "ngkmkxkgaophltqv"
+D1280:   .data -5499, K34, -5690, 1352
+        mov  #-1055, X4
+D1281:   .string "lve"
+D1282:   .data 1839, 3348, K17
+D1283:   .data 6702, -6766, -7575
+D1284:   .data K33, K14
+; generated comment line
+        jsr  D107
+D1285:   .data -7152, -1943, -516, -4045
+D1286:   .string "somhrn"
+L39:   mov  #-1336, D1002
+D1287:   .data 4028, -2524, -816, 5230, 6440, K34, 7743, K4
+D1288:   .data K27
+        inc  D922
+D1289:   .data K13, -1113, K23, 5328, 524, 4258
+D1290:   .string "so"
+D1291:   .data 2604, 6507, K1, 5244
+.entry L14
+D1292:   .data 5840
+D1293:   .data 6638, K18, K33, 306
+D1294:   .string "gke"
+D1295:   .data 2128
+D1296:   .data 4036, -1264, -7575, 4742, -4737, -7132, -1564
+D1297:   .string "sye"
+; generated comment line
+D1298:   .data 4158, 518, 7460, 2150, K9, 7098, 6081
+D1299:   .data 3275, 7829, K19, -5214
+D1300:   .string "lbcuxx"
+D1301:   .string "dlbxcusgt"
+D1302:   .string "wcebzunphxbxlphn"
+D1303:   .data -515
+D1304:   .string "axpcuzdvcnddjhgjpssv"
+        hlt
+        prn  D1229
+D1305:   .data K18, 2518, 1682, K26, -5906, 6807, 3536, 3385
+D1306:   .data K27
+D1307:   .string "wgkbjbdisers"
+L40:   dec  D311
+D1308:   .data -4501, 6937, 3287, -1388, K32, 6979, 2979
+D1309:   .data K35, K13
+        clr  D833[K17]
+D1310:   .data -4763, -1029, 356, 5174, -2577
+D1311:   .data 3948, -3214, 3589, K26
+D1312:   .data -4557, K2, -5049, K29
+D1313:   .string "cmrm"
+D1314:   .data 2005, -6326, -2684, K20
+D1315:   .string "ovanrdzfbffziod"
+D1316:   .data -643, -1750
+D1317:   .string "knziuvwcsfkpayjbwqskr"
+D1318:   .string "cshkuywjv"
+D1319:   .data 3570, -599, 2139, -4696, -6020
+D1320:   .data 2048, -738, K18, -5377, -703
+D1321:   .data -3591, K0, 7477, K2, 4223, K16, K20, K7
+D1322:   .string "bcrynmslnpqifoffghjfjyxt"
+        cmp  #727, D24[K4]
+.define K40 = 43
+        clr  D476[K11]
+        clr  r1
+D1323:   .data 5644, -3594, 7552, -2323, -2278, K38, 5622
+D1324:   .string "zrwqksuwbqnm"
+D1325:   .data K8, 5210, 7200, 1088, 856, K25
+D1326:   .data 5665, 6482, -4619, -7934, 6910, 5590, K14, -967
+        lea  X3, r5
+D1327:   .string "w"
+D1328:   .data -2394, 5190, K0, -4515, 4047, 3191, K26
+D1329:   .string "bomweeqcqkpnclcuoga"
+D1330:   .data -4631, K25, 1293
+D1331:   .string "jilqhb"
+        sub  r7, D1020[K19]
+D1332:   .data 5495, -862, K2, 2119, 1005, 2076, K21, 7115
+D1333:   .string "brthtltt"
+D1334:   .data K10, 7938, -3828, 611, K1, -2683, 6514
+D1335:   .string "dbmdtgkb"
+D1336:   .string "vti"
+D1337:   .data 7230, 4390, -3723, -6056, K40, -6920, -496, 4788
+        lea  D1230[K17], r7
+; generated comment line
+D1338:   .string "mfjxrakuxytfjkpirtfeg"
+D1339:   .data -4815, -1140, 6710, -7056
+        red  D1057
+D1340:   .data -1140, -2115, K39, K18, 4887
+D1341:   .data K19, K35, 524, K11
+D1342:   .string "rgjybdeqgr"
+D1343:   .string "ycjjkbvbdyqlshqtlv"
+D1344:   .string "uwwhce"
+D1345:   .data -3899, 6267, 2975, 5077, 5164, -5505, K20
+; generated comment line
+D1346:   .string "f"
+D1347:   .data 4619
+D1348:   .string "yi"
+D1349:   .data 4624, 5727, 7088
+        red  D948
+D1350:   .data K40, K9, -1971
+D1351:   .string "qujvtkqpcgkiww"
+D1352:   .string "qofpbazhixkcnxquydcyaau"
+D1353:   .data -2127, K24, K3, K26, -3961, 1754, -7079
+L41:   mov  #-1445, D1027
+        inc  r0
+D1354:   .string "g"
+D1355:   .data 1640, 6106, K20, -1461, K29, K4
+D1356:   .data K17, K19, K40, -6637
+D1357:   .data -3045, K34, 5358, K12, 7481, -4211, 5048
+D1358:   .data -5518, -4628, -1050, -120, -5498, K34, K18
+D1359:   .string "foejollkprcjney"
+D1360:   .data K36, -4073, -7734, K31, K3, -82, K9, -2204
+D1361:   .string "tcforgssglon"
+D1362:   .data 5115, -5376, 3744
+        rts
+D1363:   .data -2897
+D1364:   .data -2058, 5546, K6, -6408, 4631, 890, -7013, K33
+D1365:   .data -2716, -5991, -1964, 1913, -1321, -1142, 4825
+D1366:   .data -5173, 2335, K36, K19, -7932
+; generated comment line
+D1367:   .data 6929, K18, 2535, -4541, 6703
+D1368:   .string "feumlsktwlpewnblwnbfjxwh"
+D1369:   .data 6712, 3384, -4859, 3058, K27
+D1370:   .data K31, 4252, -2650, 2539, -7492, 5127, 7734, 4109
+        jmp  D257
+D1371:   .data -3422, 6495, 6423, 7884, -3730, -6726, 4373, 5620
+D1372:   .data 3517, 2418, -7641, 7989
+D1373:   .data K0, K3, -7941
+D1374:   .data 6712, -7288, -5118, -4486, 5851, 5775
+D1375:   .string "l"
+D1376:   .string "wxgovminmwhncbabtm"
+D1377:   .string "fhpugrjorl"
+D1378:   .data -5089, -2841, K0, -5823, 2070, -5200, K5
+D1379:   .data K18, K5, -1367
+D1380:   .data -6293, -590, K9, -3907, -6883, 2963
+D1381:   .data K12, -5655, K22, 6830, 5662, 3616, 2782, K5
+D1382:   .data -7590, 7109, 7180, K24, 4200
+        red  r3
+D1383:   .data -2446, -7371, -4542, K8
+D1384:   .data K39, K19, -3772
+D1385:   .data 3325, K28, 3766, -5420
+D1386:   .string "kacjkesuidusvvyviv"
+        jsr  r0
+        hlt
+D1387:   .string "xnpe"
+D1388:   .data -5603, -674
+        mov  D670[K28], D340
+        lea  D1373, D808[1]
+D1389:   .data 1554
+D1390:   .data -4662, 7260
+D1391:   .string "bphrbgawucqtynsxgde"
+D1392:   .data 3612, -612, -4588, K25, -2515, -6282, 3653
+        lea  L29, D1120
+D1393:   .string "oen"
+D1394:   .data -5876, -7748, 2705, 7762, 6482, -5806, K19
+D1395:   .data -6653, -2640, 5049
+        rts
+D1396:   .data K39, 2294, K35, -2256, 3824
+D1397:   .data 5869
+D1398:   .data 6652, K33, 7666, -6847
+.entry D14
+D1399:   .data 2373, -868, 6453, 6637, 2464, K29, -3453, -1742
+D1400:   .string "dkoemvsrtoca"
+D1401:   .string "jfxftrjlhdhmwgfsaxa"
+D1402:   .data K29, -2683, -973, -733, -5889
+        bne  D292
+D1403:   .data K15, 2051, 6058, 3954
+D1404:   .data K35, K37, K8
+D1405:   .data K28
+D1406:   .data -201, 1042, 5445, -5889, -6256, K8
+D1407:   .string "xgakrq"
+D1408:   .data 791, K40
+D1409:   .data K19, -3361, 6813, -1832, -3870
+D1410:   .data 6557, 2731, 2582, 5398, 7488, -1432
+D1411:   .string "fetsfmpbyhqkjosxi"
+D1412:   .string "kh"
+D1413:   .data 7348, K25, 7627, -2766, K27, 1718, 3953, -1163
+D1414:   .string "otcvjbtyvkmopuqubqbzfd"
+D1415:   .data -7409, K7
+        red  D124
+D1416:   .data K38, -1258, K3, K1, K40, -2099, K12
+D1417:   .string "qwednsgcudcaemvlrxerg"
+D1418:   .data -6944, 7249, -3142, K36
+D1419:   .data K15
+D1420:   .data -4453, -291
+D1421:   .data 4442, 4423, -7444, K7
+D1422:   .data 2918, -5494, -95
+D1423:   .string "obusjllespqxtcvxpd"
+.entry L15
+        inc  r3
+D1424:   .data 3348, -5914, 5465
+D1425:   .data -6232, 5323, -3408, K23, K22, -7625
+.entry D15
+        rts
+        hlt
+D1426:   .string "dne"
+D1427:   .string "uiplnddiasy"
+D1428:   .data K29, -2273, K12, 2888, 580, 3866
+D1429:   .string "ymvkzfwjtw"
+D1430:   .data K40, K24, K13, -6125, -2010
+        jmp  r2
+D1431:   .data K25, K35, -6728
+D1432:   .string "ewiytordlkttdojkwekegk"
+        jsr  D34
+D1433:   .data -194, K8, -1774, -1959, -7320
+D1434:   .data 7565, K36, 7322, K23
+D1435:   .string "ucnvjpmnnzbe"
+D1436:   .data -3680, 1807, -6758, K7, 3512
+        clr  D1039[5]
+        dec  r5
+D1437:   .string "sppe"
+D1438:   .data -7260, -2251, -2695, -2276, 5109, K17, -4284, -2652
+D1439:   .data 6388, 7313, K39, K39, 3544, -4542, -3481
+D1440:   .data 2950, -5521, -1432
+D1441:   .data K2, K4, K21, 6318, -6514, -4813
+D1442:   .string "y"
+D1443:   .data 3809, -5984, -7230, -1037, -3062, -6933, -795
+D1444:   .data 4684, K36, 6011, 7579, 6105, 1140, 2596, 894
+D1445:   .data 558, 3238, 348, -396, -643, -5549
+D1446:   .string "eutqgrxkvqvh"
+D1447:   .data -5685, -2741, K6, 991, K8, -4283, 2754
+D1448:   .string "fyn"
+D1449:   .data 3423, K31, K38, K34
+D1450:   .string "xhrxrrppd"
+D1451:   .data 2697, 1865
+D1452:   .data 7667, K4, 6053
+D1453:   .string "issbuzsuvbyk"
+D1454:   .string "tqoiwvgykybvbd"
+D1455:   .data 6081, 2995, 5568
+        lea  D102, D366
+D1456:   .data K4, -5582
+D1457:   .data 3533
+D1458:   .string "twyookdoypx"
+D1459:   .data 5958, K8, 1539, K0, 2234, -7893, 6727
+D1460:   .data -4323, -3395
+D1461:   .data -5176, 4290
+D1462:   .string "fzstuabzlucsqvvrijkyqran"
+D1463:   .data 7717
+; generated comment line
+D1464:   .data 625, 1827, -5979, 1922, 1904, K21, -4482
+D1465:   .string "wvqwzw"
+D1466:   .string "kzisxkjr"
+D1467:   .data 1919, 5746
+.define K41 = 23
+D1468:   .data 593, -2156, 6072, -7833, -3544
+        rts
+D1469:   .string "tmnmlyigofqjbx"
+D1470:   .data -7350, 6650, -3540, K8, K2, 5788
+D1471:   .data -836, K10, K16, 5364, -1281
+.entry L16
+D1472:   .string "vvozjpihspbqelzxregrl"
+D1473:   .data -4043, 153, -708, 6490, -3666, -2995, K30
+D1474:   .string "uthh"
+        cmp  D800[2], D271
+D1475:   .data 2875, K4, 3037, 7690, 2315
+D1476:   .string "athwahmrixlo"
+.entry D16
+D1477:   .data 5398, 3774, -7091, 4208, K38, 3344, -6936, -564
+        rts
+D1478:   .data 2094, 4929, -3109, 1484
+D1479:   .string "xtxcsqhelf"
+D1480:   .data K33, 5431, K34, 65
+D1481:   .string "vq"
+D1482:   .data K39, -615, -4473, 6994, 4914, -4292, -5692
+L42:   jmp  D614
+D1483:   .string "wjsy"
+D1484:   .data -2010
+D1485:   .data 7201, K13, 3738, K28, 4897, 1553
+D1486:   .data 6162, -2643, 5777, K38, 584, 7706, -6285, 6713
+D1487:   .string "oapaewpipjl"
+D1488:   .data 2477, 5828, -3881, K35, -1505, 3173, K33, -6254
+D1489:   .string "qabikwhoxckjxcyowtji"
+        jsr  D638
+D1490:   .data -5214, 4800, K41, 393, K2, 266
+D1491:   .data K2, K40, -7272
+; generated comment line
+; generated comment line
+D1492:   .data K37, -7418, 3923, 1368, K17, 3126
+D1493:   .string "baszrwnuluo"
+        add  #1921, r1
+D1494:   .data 2519, -6012, -1027, 5936, -5497, K36
+D1495:   .string "yvthylquzzhskmkjhha"
+        not  D532
+D1496:   .data 5772, K32, 5188, K33
+D1497:   .data -528, K14, 6174, -7999, K1, -4581
+        not  D528
+D1498:   .data -6138, 644, -5227, K41, 1584, -5885
+D1499:   .string "kf"
+D1500:   .data -6473, -4660, 4916, -613, 7256, -5682
+D1501:   .data -621
+D1502:   .string "bcioe"
+D1503:   .string "rrurxxuncoagmsyyurhqzg"
+D1504:   .data K35, 5488, 7247
+D1505:   .data -940, -525, 566, 7164, -6415, 236
+D1506:   .string "powflrto"
+        inc  D1309
+D1507:   .data 1306, -332, 425, K41
+D1508:   .data 4229, 1963
+.entry L17
+        prn  #K9
+D1509:   .data 5621, -6290, 3733, 6207, K29, 7165, 873, K3
+.entry D17
+D1510:   .data 3920, 5264, 7325, -7094, K3
+L43:   not  D659[K16]
+D1511:   .data K30, 6674, 3547, 1844, 7357, 4488, K26
+D1512:   .string "dswexrvnyeszufrlyn"
+D1513:   .data -6186, -745, 7793, 7295, 4874, K2, K8, -3373
+L44:   clr  D126[10]
+D1514:   .string "vmhsdobuzzsbyqpaqx"
+D1515:   .data -3584, -1370, 4697, K18, 2297, -1499, 5148, 6245
+D1516:   .string "fjhywdaxyx"
+D1517:   .string "olmoifwqodgxltbrbzdzqgrk"
+D1518:   .string "xxixrsqdjmunse"
+D1519:   .data 7446
+D1520:   .data -1956, -4750, -867, -4572, K36, 6016, 5024, 2419
+D1521:   .string "evwizjdeurscysuaiiquyvjh"
+D1522:   .data -3619, K2, 985, K26
+D1523:   .data K2, K16, -1660, K7, 6562
+; generated comment line
+D1524:   .data -4683
+D1525:   .data 3766, -2169, 3971, -7067, -4798
+.entry L18
+D1526:   .string "eh"
+D1527:   .data -2018, K12, 6275, -1378, -5888
+D1528:   .data -7470, 2114, -3089, -3895, 7821, 7456
+D1529:   .data -1206
+D1530:   .data -4830, 6900
+; generated comment line
+D1531:   .data -3037, 5182, -4202, K16, K23, 5191, K19, 6569
+D1532:   .data 2925, K7, K15, K2, -6022, 2683
+; generated comment line
+D1533:   .data -2450, 1687, -4843, -5280
+D1534:   .string "gmsupb"
+D1535:   .data K0, K20, -3375, -6547, 7623, 1768, K26, 6226
+D1536:   .string "uhpvchqaoogs"
+D1537:   .string "rjsrwqumq"
+D1538:   .string "fpckdranzhilefv"
+D1539:   .data 613, -7592, K41, 7867, 4010, -4783
+D1540:   .data K16, -5653, -5327, -7936, K38, -6033, 411
+L45:   cmp  D751, r5
+D1541:   .data -3090, -3667, K33, 1228, K39
+D1542:   .data 3895, 1867, -7874, 743, -5974, 982, -5370
+D1543:   .string "u"
+D1544:   .data 1205, -2914, -3470, K14
+D1545:   .string "uafispbknbjqyezkjpkca"
+        jmp  D207
+D1546:   .data -350, 1044, -7275, -5252
+D1547:   .data -1925, 5129, K8, -4046, K5, -5867
+D1548:   .data -4403, -7121, K15, K33
+D1549:   .data K11, 7339, -7237, 4508, 7492, 6757
+D1550:   .data -7084, 2297
+D1551:   .string "trokklfzvwqlf"
+D1552:   .data -3923, K34
+.define K42 = 22
+D1553:   .string "bvgzoeijiwibmnhjltfdxtko"
+.define K43 = 60
+D1554:   .string "fktdeyhdoiteiozupywjbyws"
+D1555:   .data K10, -6224, -442, K38
+D1556:   .data 3845, 6737, K20, -37, -6824, 265, -7118, K30
+        mov  #-1007, r4
+        clr  D1425
+D1557:   .string "uqwvogekezsubxml"
+D1558:   .data 6527
+D1559:   .string "mxapzgprpjgnfry"
+        add  D1557, D1542[K25]
+D1560:   .data -2913, K24, K4, 1143, 684, -620, 3136, 734
+D1561:   .data -2481
+D1562:   .string "qauutfbfnemgm"
+D1563:   .data K21, -1257, K7, 5440, -7812, 4498
+D1564:   .data -3438, -7824
+; generated comment line
+D1565:   .string "ifzakhkfgijn"
+D1566:   .string "sgrduybas"
+D1567:   .string "xwbohcoakjejtfyfrzkpqioo"
+D1568:   .data K2
+; generated comment line
+D1569:   .string "wocebws"
+; generated comment line
+D1570:   .data 7360, 4543
+D1571:   .data K43, -6510, K35, -61, -3098, 1079
+D1572:   .string "mnfpvemcmtondiwmlvqr"
+D1573:   .data 4929, 5319, 7987, -6728, K22, -1860
+D1574:   .data 2045, -5982, -2113, -5700, 7693, -4719, 7668
+        mov  D606, D392[K35]
+D1575:   .data -2384
+D1576:   .data 2810
+D1577:   .data K30, -3810, -6969
+        jmp  r4
+D1578:   .data K17, 3750, 710, 6699
+D1579:   .data 4882
+D1580:   .string "hrojgfhrsovdntzpokue"
+D1581:   .data 1141, 4673, K15, K29, 6239, -7755, -7610, 382
+D1582:   .data K1, -5846
+D1583:   .data 5862, -5217, K34, 7327, K23
+D1584:   .data K10, -43, -2079, 2104, -543, 6172
+D1585:   .string "diypwtqvrhlifw"
+D1586:   .data K14, K11, K35, -1923, 7009, 7503
+        prn  D169
+D1587:   .string "whbgwbvc"
+D1588:   .string "oczujwshjqu"
+D1589:   .data 6614, K40, 6103, K14, K22, -6819
+.define K44 = 53
+D1590:   .data 7241, 246, K36, K37, 1668, -1168, 5774
+D1591:   .data -5861, 2448, -2793, -4695, K17, 1125, K26
+D1592:   .data K31
+D1593:   .data K6, 4171, -33, -4809, -5988, 3937, 836, K38
+D1594:   .data -4161, 1153, -4290, 3143
+D1595:   .data 6690, K1
+D1596:   .data 2975, 3354, -548, 3893, 4973
+D1597:   .string "kzhhqhiqspcrywgtvwycacg"
+D1598:   .string "npikquaybidc"
+D1599:   .data K32, -7350, -3440, 4144, 3272, K39
+D1600:   .string "ktpmzhmunszwcrll"
+D1601:   .string "wfpuwtysy"
+D1602:   .string "qbaxkucoryjrzapldypwue"
+D1603:   .data -5254, K36, 2164, 2388, K29
+D1604:   .string "iixheqtpcn"
+; generated comment line
+D1605:   .data -5101, K31, -5869, -4991, K35, 5411, 1393
+D1606:   .string "pvksaivgprwcsfnkvjbfpb"
+D1607:   .string "dvog"
+D1608:   .string "qnarzmqvdvcjhzfncjd"
+D1609:   .string "onmvzu"
+; generated comment line
+D1610:   .data -5034, 3237, 4616, K14, -344, 3776, -5532
+D1611:   .string "ghrlceat"
+        not  r4
+D1612:   .data 4582, K28
+D1613:   .data -7003, -1973
+D1614:   .string "fmmphzrllsmuwadlxh"
+D1615:   .data -5398, -6092, 5884
+D1616:   .data 7988, -2022, -1310, 4507, K9
+D1617:   .string "yipyatvclc"
+D1618:   .data K13, 4217, 2089
+D1619:   .data -2870, -5979, 1737, K16, 1920, -3310, -7509, -5583
+D1620:   .data -790, 6650, K27
+D1621:   .data 2507, -673
+D1622:   .string "viqdwxnfbrmtresrtwebyq"
+D1623:   .string "xuwjdsmwkvhuqyahuyc"
+D1624:   .data -5311, 7789, K32, -3017
+D1625:   .data -3614, 6340, -280, 6876, K9, K1, 6385
+; generated comment line
+D1626:   .data -618
+D1627:   .data -7376, K13, -6770, 5370
+D1628:   .string "yrxelof"
+D1629:   .data -1383, -4546, -7888, -5103
+D1630:   .data -2697, K10, 875, K31
+D1631:   .data -2136, -7270, -1619, -4520, 74, K26, -7237
+D1632:   .data K24, 2395, K23, K41, K20
+D1633:   .data K27, 4235, K41, -930, K20
+; generated comment line
+D1634:   .data K23, K19, 1314, 4764
+D1635:   .data K25, 892, -872, 5262
+; generated comment line
+D1636:   .data -3620, -2643, K32, -5176, -7333, K25, -6844
+D1637:   .string "bznsqwizdwwnmysqhjg"
+D1638:   .data K22, 3120
+D1639:   .data 5933, 5877, 533, K1, K29, -762
+D1640:   .data K3, -3439, -7769, -666, -4710
+D1641:   .data K0, 6934, -6659
+D1642:   .data -4329, -5439, K38, -6770, K7, 5759, 5378, 4403
+D1643:   .string "etxvzwwu"
+D1644:   .data 3, -466, K9, -1652, -915
+D1645:   .string "ztbtxbkuadowjaxpkcvr"
+D1646:   .data -5131, -2783, K42, -6644, K22, K30
+D1647:   .data 2210, K23, 3236, 4860, K23, K10
+; generated comment line
+        lea  D652, r2
+D1648:   .data K0, K33
+D1649:   .data -7726, 2703, 1479, -1028, -5218, 5226, 7493, -7900
+L46:   inc  r6
+D1650:   .data -1243, -1085, 480, K20, 2255, -1649, -5523, 5288
+D1651:   .data 6187, 1633
+D1652:   .data 7501, K38, K17, -1082, -1026, K25, 2086, 4652
+D1653:   .string "edcbzaqkldlb"
+D1654:   .data -2056, -6781, 1111, -3414, -274, 5168
+D1655:   .string "bkroimfcge"
+D1656:   .string "xzthlzbdyktslfbn"
+D1657:   .data -432, -5023, -1216, -3801, -258, 7609
+D1658:   .string "mhrkeuw"
+L47:   prn  #K21
+D1659:   .string "idtbjefsmhzfiejau"
+D1660:   .string "oqykmoxxtipdovw"
+D1661:   .data K27, 6523
+D1662:   .data K20, 4860, K41, 7322, -5126
+D1663:   .string "d"
+D1664:   .data K2
+D1665:   .string "qrznrurhfqbjgyrq"
+D1666:   .data 1539, -4537, K11, 4533
+        bne  D388
+D1667:   .string "aylmvwmgfbykkuq"
+D1668:   .data 2587, 1142, 2830, K17, K23, 7295, K11, 1889
+D1669:   .data -7739, K19, K2, K40, -4398, -2797
+D1670:   .data -429, -4890, 2255, -243, 5400, 4549
+.entry D18
+D1671:   .data K0, 1577, K43
+D1672:   .string "uknlmpajysu"
+D1673:   .data -2445, 3872, -3799
+D1674:   .data -290, K2, K1, 2854, K17, 5472, 1056, K15
+D1675:   .data K31, 4533, K20, -3559, -2435, 4997
+; generated comment line
+D1676:   .string "eedpnjckpfzvuttz"
+        rts
+D1677:   .data -831, K20, -5119
+D1678:   .data 5693, -6391, -4123, -1873
+D1679:   .data -6276, -1114, -1883
+D1680:   .data K28, -735, 4590, -5233, 4067, -618, -1793, -6270
+D1681:   .data 3801, 6912
+D1682:   .data -3238, -6878, 4689, 3604
+D1683:   .string "ysipwmdzgx"
+D1684:   .string "gynibvuouvznzwgmvobzvsz"
+D1685:   .data -1388, K24, 655, 1997, 1928, -4334
+D1686:   .string "lxfzzqxkrcbadrixkjojwt"
+D1687:   .data K7, -2840, K26, -2772, 4881, -2651
+D1688:   .string "wqwxbdva"
+D1689:   .string "ithrxgazkrknvfpmxy"
+D1690:   .string "qcurqvvtbbztxpoi"
+D1691:   .data 2467, -887, K44, 5878
+D1692:   .string "mczqkoxgvqwjrksmuhjqwuah"
+        prn  D946
+D1693:   .data K32, 7181, K33, 3918, -2160
+D1694:   .string "owi"
+D1695:   .data -629, -6707
+D1696:   .data 6282, -6665, 7068, K31
+D1697:   .data -6954, -2054, -6383
+D1698:   .string "oraottdywx"
+        prn  D912
+D1699:   .data 2532, 7387
+D1700:   .string "agsbvxovwcvnvg"
+.entry L19
+D1701:   .data -2065
+.define K45 = 28
+D1702:   .data -3114
+D1703:   .string "udhwcsoyc"
+D1704:   .data 4751, K12, K2, 7886, 1192, 7426
+        add  D1363[2], D967
+D1705:   .data -6663
+.entry D19
+D1706:   .string "qzvkqheveuhf"
+D1707:   .data -7720
+; generated comment line
+D1708:   .data -368, 300, 6791, K31, K15, K36
+D1709:   .string "chxryxphwpgaeomkckmzlcng"
+D1710:   .data K33, 6756, -2461, 4646, -4697, K41, 4467
+D1711:   .data 7861
+D1712:   .data 7867, -5090, 3759, -543
+D1713:   .data 329, 3012
+D1714:   .data -3952, 5503, 1290, K9, 7592
+D1715:   .data -3937, -3477, 1829, -813
+D1716:   .data 2036, K29, 5769
+D1717:   .string "fvhidfprvoj"
+D1718:   .data -4620
+D1719:   .data 750, -3996, 7169, K23, K12, -2104, -3918, 1879
+.define K46 = 3
+D1720:   .string "dlm"
+        prn  #K46
+.entry L20
+D1721:   .string "ucopxbtqisngjznmfwvv"
+.entry D20
+L48:   red  D283
+D1722:   .data K23, 4075, -7669, -4151, -924
+D1723:   .data -4873, 5005, 7390, -7594, -5236, 2468
+D1724:   .string "los"
+D1725:   .string "tak"
+D1726:   .string "jmhfk"
+D1727:   .data -2343, -1168, -679, -4780, -7617, -6797
+D1728:   .data 451, K4, 221, -7662
+D1729:   .data K40
+D1730:   .data -1640, 1223, 3405, 2753, 6727
+; generated comment line
+D1731:   .data 3321, -3867, 6994
+        bne  r5
+D1732:   .data -566, -795, K18, 1424
+D1733:   .data K38, -667, -2994
+D1734:   .data 7716, -2460, 5335, 2495, -692, -1414, 369
+.define K47 = 47
+.entry L21
+D1735:   .data K22, K42, K30, -3488, 2182
+D1736:   .string "epbcxugvhqomtgkecm"
+D1737:   .data -5213
+D1738:   .data 6070, K5, -1933, K8, 6570, -5861, 311
+; generated comment line
+D1739:   .data -4499, -1063, 634, K43, -4276, K47
+.define K48 = 19
+D1740:   .data 1985, -4842, 6182, -3597, 6637, -7087, 7044
+; generated comment line
+; generated comment line
+D1741:   .data -7019
+D1742:   .data K0
+D1743:   .data -169, -3182, 266, K17
+L49:   red  D845
+D1744:   .data -4687, K26
+D1745:   .string "kbmvzgpfgftoixsho"
+D1746:   .data 2948, 40
+D1747:   .data K39, 488, -7304, 1325, -6578, -1874
+; generated comment line
+D1748:   .data 4454, -6097, -452
+D1749:   .data 2627, -4502, K12, K2, 3026, K34, 5580, 5356
+D1750:   .data 3961, K33, 3729, K9, -971
+D1751:   .data 5904, -1562, -4245, K39, 4331, 5145
+.define K49 = 46
+D1752:   .data -6393, -4737
+D1753:   .data -5814, 5022, 5181, K24, 2365
+D1754:   .data -1655, 7349, 5233, 2459, -1223, -1314, K49, -5750
+D1755:   .data 5376, K17, -2319, -7041, 6095, -245, 4151, 2326
+D1756:   .string "rubvmuypxstcobgyycz"
+.entry D21
+D1757:   .data 3452
+D1758:   .data -5623, -6301, -7266, -5455, -821, -580, K28, -7135
+D1759:   .data K6, -6836, -7945, -1242, 4280, -1831, -2336
+D1760:   .string "jjrjekqwstnvxxfkdu"
+D1761:   .string "yjhazklgjqnfuxogxeutae"
+D1762:   .data -5832, -2757, -352
+D1763:   .string "tbeeljcdjr"
+D1764:   .string "hglit"
+D1765:   .data K21, -3810
+D1766:   .string "qiv"
+D1767:   .data -2813, 1255, -4899, -4620, -5625, K17
+D1768:   .string "vyxv"
+D1769:   .string "zmongqwdmxmwjdaccafj"
+D1770:   .string "udagskxnbfydeov"
+D1771:   .data 3165, -6618, K48, K20, K14
+D1772:   .string "rbbkvzuximhtasuzcgwog"
+D1773:   .data -711, K1, K37, K48, -5105, 6434, 7009
+D1774:   .data K33, -6329
+D1775:   .string "jbelpaunwmud"
+D1776:   .string "f"
+D1777:   .string "nxoa"
+D1778:   .data -4365, K17
+D1779:   .data -1134, 2668, K18, -2749, K26
+D1780:   .data K7, 4009, -2405, K40, K14
+D1781:   .string "ul"
+D1782:   .data 3342
+        inc  D1080[14]
+        inc  r0
+D1783:   .string "vlyydkxge"
+D1784:   .data -4996, 6884, -7989, -6392, -2818, K42, K25, 6196
+D1785:   .data K26, 4264
+D1786:   .data -3131, -3891, -2515, K43, K24, 3038
+D1787:   .data K30, -5687, -3169, 7198, -4590
+.entry L22
+D1788:   .string "mdlmqdbudfj"
+; generated comment line
+D1789:   .data 540, 2561
+D1790:   .data -3285, 4157, 6524
+D1791:   .data 4112, -4064, K31, K7, -566, -1564
+D1792:   .data 2533, 4033, 6005, 6811, 39
+D1793:   .string "obuuholbachft"
+D1794:   .data 4021, -3528
+D1795:   .string "gdsfgjnemkfdw"
+D1796:   .string "xiuqwbcom"
+D1797:   .string "bnqtdjc"
+D1798:   .data K11, -4262, -3942, 3871, 1995, K30, 3719, -1049
+.define K50 = 61
+.entry D22
+D1799:   .data -1755, -486, -6129, -4131
+D1800:   .data K12, K47, -5117
+D1801:   .string "pazmbuhidjyjwrkpklneno"
+D1802:   .data 3395, K22, 7171
+D1803:   .data -7351, K41, -3351, -2027, -1396, 5973, -2000
+D1804:   .data 2526, 7271
+D1805:   .data 4401
+D1806:   .data 1208, K49, -1592, 1696, -7868, 1747, 2617
+D1807:   .string "hzcqfqttndna"
+        lea  D630, r1
+D1808:   .data K36, 6908
+D1809:   .string "yawzjymoqpuyyaplnbibicb"
+D1810:   .string "ujqggagugca"
+D1811:   .string "hfsvvcnwoxfuscjkwwce"
+D1812:   .data 1487, -5117, -7685, 5888, 3941
+D1813:   .string "tkbdehnlbijjv"
+D1814:   .data -7372, 270, K47, -1677, -6642, -2320
+D1815:   .string "psuguh"
+D1816:   .data 3142, K47, 7984, 6970, 6244, -7311, -7362
+D1817:   .data 5997, -7809, 2785
+D1818:   .data K12, K32, 2103, K3, 6553, K11, -1122
+D1819:   .data K50, K39, 2346, 7467
+D1820:   .string "wbdsgr"
+D1821:   .string "otl"
+D1822:   .data K32, 3201, K16
+D1823:   .data K34, 321, 5469
+D1824:   .string "wsk"
+D1825:   .data 1867, K29, -621, 4079
+D1826:   .string "k"
+D1827:   .data 4680, -5673, K5
+D1828:   .data K43
+D1829:   .data -5907, K37, -4143, -6923, 957, K22, 493
+D1830:   .string "fbjlueddply"
+D1831:   .string "zqssypoffcwaztezjfhv"
+D1832:   .data 6757, 6074
+D1833:   .data 7030, -3808, -6889, K48, 3065, 3974, 7399, 2043
+D1834:   .data -7182, 7233, -7815, -1711
+        rts
+D1835:   .data 6202, -6615, 1580
+D1836:   .data K33, K11
+D1837:   .string "rc"
+D1838:   .data 3002, 2477, -5849, -2568, K12, -2659, -5895, 2552
+        clr  D1599
+D1839:   .data -5844, K40, 295, 4005, -6880, -3990
+D1840:   .data 4485, -4781, -5122, -1090, 6312, 2704
+D1841:   .string "dsbgvivtu"
+D1842:   .data -3264, K44, 3332, 1449, -4355, K2, 1846
+        jsr  r5
+D1843:   .data -4002, 2009, -5987, K30
+D1844:   .data -7043, 7935, 3588, 5326, 7310, 3390
+D1845:   .data 4469, 7967, 6099, 2449, 2295, K11
+D1846:   .data 6907, -223, K35, -2162
+D1847:   .data 5208, -1580, K29, -3674, -1708, 7235, -7244, 6660
+D1848:   .data K47, -3104, -2442, K46
+D1849:   .data -779, 5825, K17, 5451, -5176, -4615, 4002, K7
+D1850:   .string "ukcstjdix"
+.entry L23
+D1851:   .data 7266, 4879, 372, K30
+        rts
+D1852:   .data 5065, 4592, -3392
+D1853:   .data -1221, 46, 2893, K9, -3724, 1903, 3387
+D1854:   .string "bkndkkzcau"
+D1855:   .data K24, -5584
+; generated comment line
+D1856:   .data K16, 5479, -4196, 772, 3248
+D1857:   .data K50, 5759, 5480, K4, -1184, K17, 3285, 5415
+L50:   add  D1108, D682
+D1858:   .data -6292
+D1859:   .data -3087, 962
+D1860:   .data 12, 1739, K3, 3548
+D1861:   .data -6736
+D1862:   .data -3890, K21, K2, -5102
+D1863:   .data K10, K47, 768
+D1864:   .string "uimwtu"
+        lea  D511[K18], D1416
+D1865:   .data K40
+        red  D1756[K44]
+D1866:   .string "hligh"
+        hlt
+D1867:   .string "mnfksb"
+D1868:   .data -1410, -4499, 2123, K4
+D1869:   .data K45, K17, -1208, 6007
+D1870:   .data -2587
+D1871:   .data 6429, 3761
+D1872:   .string "pvuwgvsalqxngo"
+D1873:   .string "mbhvxrqldysxulmrdgkg"
+; generated comment line
+D1874:   .data K0
+D1875:   .data 4431, 3904, 7211
+D1876:   .string "bynfriccnurdkgovbrjomgrc"
+D1877:   .data K48, 751, 417, -1290, 6731, -5511, 5559, 1140
+D1878:   .data -6161, -5979, -1551
+        clr  r7
+L51:   lea  D644, D1482[K46]
+D1879:   .data 4374, -1969, K18, 6863, K24
+D1880:   .string "sawlzdncibvibx"
+D1881:   .data 6451, -4453, K42
+D1882:   .string "itmikteucfwj"
+D1883:   .data -2215, 3103, 5254, K24, 3025, -4527
+D1884:   .data 3675, K42, 141
+D1885:   .data -3102, -6979, K17, -1560
+D1886:   .string "iiejfgiyijyeiqnbxvo"
+D1887:   .string "rvjwchuscigisiouknbdmhz"
+        dec  D938
+D1888:   .data K45
+        mov  D508[K14], D1674[K25]
+; generated comment line
+L52:   add  D406, D557[5]
+D1889:   .string "bbqwdumaptt"
+D1890:   .data 1445, -6179, -614, -578, -5563
+D1891:   .data -7012, -173
+        lea  D46[K19], r5
+D1892:   .data -6101, 877
+; generated comment line
+D1893:   .data K41
+D1894:   .data -4862
+        jmp  D1568
+D1895:   .data K36
+D1896:   .data 5505, -6478, -1835, -2846, -1314, -5450, K34, -4199
+D1897:   .data 6671
+D1898:   .data 7744, 3984, 3717
+D1899:   .string "azqqkchmnb"
+D1900:   .data 6879, -2789, -5374, K30, K17, -6870, K4, -1884
+D1901:   .string "eeedqkvrg"
+D1902:   .data -3471, 5017, K6, 6153, 1, -5447
+D1903:   .string "cshbpxmplz"
+D1904:   .string "qojah"
+D1905:   .string "u"
+D1906:   .string "jvdljbjjfxzkeyjmqtenxoc"
+D1907:   .string "infjrzyfbe"
+D1908:   .data 5794, -1537, K28
+D1909:   .data 2081, -2966, -3042, K8, K40, K13, K42, K29
+D1910:   .data 5423, -2742, 5762, -290, -1935, K25, K22
+        lea  D1643[0], D496[K39]
+D1911:   .string "iwlzvxbd"
+D1912:   .string "eontxxxhqpkfcbq"
+D1913:   .data 356, 330, -2926, 1355, K13
+D1914:   .data K18, 3022
+D1915:   .string "oxyjrg"
+D1916:   .data -3473, 1782, K34, 5818
+L53:   jmp  D215
+D1917:   .string "rn"
+D1918:   .data -6890, 5371, -2308, -663, 5937, 4027
+D1919:   .string "fhxswtsvfbtvgnjgwvzoezuu"
+D1920:   .data -5136, -4929, 3088
+D1921:   .string "lbsgo"
+D1922:   .string "saqtfvhwbwkbljyifcg"
+        rts
+D1923:   .string "ochbjyftsrsajbsaevqkway"
+        clr  D1404
+D1924:   .data -6169, -5062, 6073
+D1925:   .data K20, -4481
+D1926:   .data 3867, K42, 7944, -3671
+D1927:   .data -6755, -1976, -3014
+D1928:   .data -1756, K30, K25, 6411, K23, K22, K35, 2163
+D1929:   .data 3067, K26, 7246, K29, -1127, 7149, 7960
+D1930:   .string "eangzulczsahyno"
+D1931:   .data 2638, -1140, -7459, K27, -1672, -501
+D1932:   .string "qfoejvjeosmlnmgrya"
+        red  r7
+D1933:   .string "muizsrtvervzafmaaksas"
+D1934:   .data -4966, 5354, -5614, 3856, 7218, K10, 3014, 4397
+D1935:   .data -2041, 3633, K0, -5122, K7, 6511, 626, -6493
+; generated comment line
+D1936:   .data 6157, -2008, -6152, K34, K9, 354
+D1937:   .data -4484, -2211, 1657, 5869
+D1938:   .data 1591, K46
+D1939:   .string "c"
+        jmp  D395
+D1940:   .data -3355, 1169, K32, -3460, K29, K8
+D1941:   .data -814, K2, 84, 6316, K17, K6
+D1942:   .data 6428, 1767, 7190, 3821
+D1943:   .data -1328, K46, -1340, 4423, 642, 3647
+D1944:   .data K16, 7103, 7519, 4483
+D1945:   .data 231, 2206, 6943, -5191, 3591, 3794, K3
+D1946:   .data -6913, 6493, 5656, 2792, 7778, 3418, 3387, -3729
+D1947:   .data 3624
+D1948:   .string "vauvcqt"
+D1949:   .string "bybwhzcouhfpzyab"
+D1950:   .data -2535, -5194
+L54:   inc  D893
+D1951:   .data K24, K14, K19, K40
+D1952:   .data 4113, -3419, -7221, 7570
+        jsr  r5
+D1953:   .data -4777, K18, -5943, K42, 2958, 1662, -3840
+; generated comment line
+D1954:   .data 2276, 3514, 6437, -4500, K41, 6728, -5976, -1221
+D1955:   .data K28, -2222, 3477, 546, K4, K3, 7120, 5276
+D1956:   .data 2538, -1161, -7220, -7757, -3291
+.entry D23
+        cmp  r4, #K16
+D1957:   .data K36
+D1958:   .string "pcru"
+        jmp  r7
+D1959:   .data 3391, 6710, 7809, 2845, -3535, 1521, -2819, 318
+D1960:   .data K44, -6229, 1926, 808, 6881, 377, 3606
+D1961:   .data 2193, 6165, -1304, -1, K7, 834, K25, 6314
+D1962:   .data 4946, -4601, 3723, -6938, -2690
+D1963:   .data -4910
+D1964:   .data 4561, K22
+D1965:   .string "obajwmvcvhwjzydhqaxazo"
+D1966:   .data 2968, 476, 6315, -6388, 2111, K49
+D1967:   .string "vcdefueuur"
+D1968:   .data -7152, 5273, -1074, -994
+D1969:   .string "oeisarxglaqikwjkiblee"
+D1970:   .string "hrloborvyml"
+D1971:   .data K16, 415, -4787, 5547, -1725, 7758
+D1972:   .data -1422, 7089, K26, -911, 6090, 6235, -5593
+D1973:   .string "znllekilgedorpmovhdgdh"
+D1974:   .string "gtpowtwzsztimsdholgmpwei"
+; generated comment line
+D1975:   .data -3808, K33, -3678, 3163, -554
+D1976:   .string "mrnacm"
+D1977:   .data 1090, K28, -3056, -4773, 6698, 1884
+D1978:   .data K11, 613, 5539, 2417
+D1979:   .data 7900, 3089, 6295
+D1980:   .string "jqtgjkb"
+D1981:   .string "wbyrqdxkpmspcm"
+D1982:   .data -7999, -3755, K45, 2702, K32
+D1983:   .data -3694, K26, 5142, -7599
+D1984:   .string "cfste"
+D1985:   .data 5532, -4058, -4826, -3562, K16, 1266, -463, -5177
+D1986:   .data -4241, K44
+D1987:   .data 3411, -1479, K6, 2214
+        lea  D751, r5
+D1988:   .string "axfwqucttkukklmuqsdbj"
+        not  r3
+D1989:   .data -2511
+; generated comment line
+D1990:   .data -2536, K25, K35, -3635, -1134
+D1991:   .data 5346, -7133, -814, K13, -374
+; generated comment line
+D1992:   .data 5122, 5821
+D1993:   .data 4968
+D1994:   .data 4678, 549, K24, -7860
+D1995:   .string "nwzxrspziyhq"
+        jmp  r4
+D1996:   .data 5291
+        mov  r4, D1374[4]
+        lea  D83[K40], D1932
+D1997:   .data -5771
+; generated comment line
+D1998:   .string "gkqotsrgnonou"
+        bne  r2
+D1999:   .data 7288, -2519, K41
+D2000:   .data -7468, K22
+D2001:   .data -6775
+        mov  D573[K1], D1519
+D2002:   .data -7912, 6664, 7032, -1934, K41, K36, 361, 1681
+D2003:   .string "loqeywqmgqtre"
+D2004:   .string "uae"
+D2005:   .string "hlsyp"
+D2006:   .string "pzahwvlimrrj"
+D2007:   .string "jhjhkfdnpmmcmhi"
+        bne  D1440
+D2008:   .data -3761, 7195, -171, 6147
+L55:   clr  D50
+; generated comment line
+D2009:   .string "lj"
+D2010:   .data -6567, -6788, -2347, K15, -3676, 5124
+D2011:   .data 1236, 881, K41, K24, 3256, 1954, -6841
+D2012:   .string "bmopzmbjnyyehaxdauy"
+D2013:   .string "nkke"
+        cmp  X7, r0
+D2014:   .string "knxzfpxsosiadvltptg"
+        rts
+D2015:   .data 4110, -6906, -7236, 980, 7645, 5299
+D2016:   .data -430, -1864, 723, -2044
+D2017:   .data 4100, 830, -2389, -1365
+D2018:   .data 2500, -3665
+D2019:   .data 4555, 3315, K13
+D2020:   .data -193, K4, K26, K24
+D2021:   .data 7287
+; generated comment line
+D2022:   .data 4045, 1380, -3278, 2281, 7765, -190, -5549, K15
+D2023:   .string "mbiui"
+D2024:   .string "mkjvimymldqy"
+        not  D140[5]
+D2025:   .string "nywjfrsirwogo"
+D2026:   .string "camslbvevvybwwv"
+D2027:   .string "ibaagocbasp"
+D2028:   .data 4415, -7964, -4759, -3060, K47, -6517, 6370, 269
+D2029:   .data 4207, -6926, -2663, -2904, 6818, K49, -6713
+D2030:   .string "yqbr"
+D2031:   .data 3446, -579, 7778
+D2032:   .data -85, K19, 686, K14, 7382
+D2033:   .string "iedjfjpga"
+D2034:   .string "atqlsraxu"
+D2035:   .string "tcrsxqgzoppczzkjnmu"
+D2036:   .string "ew"
+D2037:   .string "cc"
+D2038:   .data 7560, -1893, K46, K30, 3637, -3855, 3179, 2220
+D2039:   .data -4729, -6161, K28, -3977, 2163, -5862
+D2040:   .string "s"
+D2041:   .data -213, K14, K22, K29, -3607
+D2042:   .data 5256, K14, -5186, -1299, -960, 7702, -4069, K7
+D2043:   .data 5788, K44
+D2044:   .data 5047, -593
+D2045:   .string "uudczzswmzpujtlxzvhxh"
+        rts
+D2046:   .data 3345, K20, 7408
+        cmp  r2, D548[15]
+D2047:   .data -6411, 2125, 6725, -4788, K32, 2111, 4377
+D2048:   .data 5328, K39, -1552, 6472, -2644, K34
+; generated comment line
+D2049:   .data 4622, 2081, -2373, 3756
+D2050:   .data 6121, 4590
+D2051:   .data K14, -6707
+L56:   clr  D84
+D2052:   .data -7959, 1156, -5778, 7016
+D2053:   .data -6937, -5198
+D2054:   .data K48, K41, 340, 1468
+D2055:   .data 6751, 2656, -7256, 7017, K38, 6150, K18, -6606
+D2056:   .data 250, K32
+D2057:   .data 174, K27, 754, -4083, 7665, K26, -2264, 3066
+D2058:   .data 4584, -3374, 1586, -2558
+D2059:   .string "cvzpbtvxdl"
+D2060:   .data K15, 2687, -7739, K33, -1550, K20, 5762, K15
+        red  D1520
+D2061:   .string "ciwnjeuiinuuamnfv"
+.entry L24
+D2062:   .data K14, -7969, 380, 589, 7574, K0
+D2063:   .string "mcqkdxrizzodqofhcwgxo"
+D2064:   .data 1805, 5326, 5737
+D2065:   .data -284, -2045, -2943, 7782, 1048
+        clr  D136
+D2066:   .string "gbvikdkeipnz"
+D2067:   .data K47, -6813, K7
+D2068:   .data 291, K48
+D2069:   .string "nshym"
+D2070:   .string "ysiymsjdjjtagioegjwz"
+D2071:   .data -3906
+D2072:   .data -3338
+D2073:   .data 5478, -3612, -5643, K28, -624, -5789
+.entry D24
+D2074:   .data K18, K40
+.define K51 = 24
+D2075:   .string "ofhuotomqclhsjs"
+D2076:   .data 7320, -4092, -2563
+D2077:   .data 6749, K17, K20, -4722, 7914, K24
+        add  D1401[K40], D1204
+D2078:   .data -1595, 820, -173, 1558, -420, -4527, 4428
+D2079:   .string "xgetprtm"
+D2080:   .data 6464, -1328, K21, K43, -3462, -4972
+D2081:   .data 3285, 689, 2789, -5877, 3863
+D2082:   .data -3327, K48, 5034, 3633, 6646
+D2083:   .data K5, 3933, -4791, K45, 1332, K47, K3, K7
+D2084:   .data K1, 1068, 324
+D2085:   .data 1470, -7357, 4052, -7073, 974
+D2086:   .data 7709, -6424, K28, 1884, 7199
+D2087:   .data 5647, -6341, K6
+D2088:   .data 4621, 1196, 3246
+D2089:   .string "ealhjpnhskcekz"
+D2090:   .data 6773, K51
+D2091:   .data 7058, -3533, 4903
+D2092:   .data -512
+D2093:   .string "noqngyb"
+D2094:   .string "dqtyhhwcafhplgqf"
+D2095:   .data 4785, 6030
+.define K52 = 23
+D2096:   .data -7943, 4238, -7320, K7, 4216, -4528, -3468, -1021
+D2097:   .string "tbvtsitgdbdhpu"
+D2098:   .string "m"
+D2099:   .data -2769
+D2100:   .data -8, -3082, K20, 7286, K36, -7951, 698
+D2101:   .data 7648, 2176, 6227
+D2102:   .string "sbwgllro"
+D2103:   .string "m"
+D2104:   .data K40, -5124, 2946, 7119, 5860, -501, 957
+D2105:   .data 5372, 2558, 596, K36, K49, 996
+.define K53 = 64
+D2106:   .string "roy"
+        dec  D1421[7]
+D2107:   .data 5109, -7223
+D2108:   .data 3765, -3164, 894, K18, -4381, 3582, 4192
+D2109:   .string "zussqj"
+D2110:   .data -330, K36, -3296, -6998, -556, 5089, -4178
+D2111:   .data -867, -3793, -6639
+D2112:   .data K0, K21, -2521, K13, 2697, K42, -1522
+D2113:   .data K45, K14, 4058, -4773
+D2114:   .string "wbjmkryvoqbvhowoqbjwwf"
+D2115:   .data 6089, -4278, 6282, 6090, K38
+D2116:   .data -5797, 6216, 3857
+D2117:   .data 3494, K2, K10, 7470, K11, 4584, 4200, K34
+; generated comment line
+D2118:   .data 6877, K48, 2625, -4763, 301, K7, -5411
+D2119:   .string "vhv"
+D2120:   .data -4297
+D2121:   .string "hvd"
+D2122:   .string "midedjsky"
+D2123:   .data -6317, 2271, -3261
+D2124:   .data -843, -7878, K1, -3802, 464, -4281, K38, 7977
+D2125:   .data -5381, 5527, 7587, -1822
+        jmp  D1280
+.entry L25
+D2126:   .data 482, -3862, -1703, -4900
+D2127:   .data K6, K33
+D2128:   .data 6458, -6989
+L57:   lea  D324, D208[8]
+        dec  r5
+D2129:   .data -766, 3572, -3723, -2852
+D2130:   .data -5669, 4329, K20, -6126, K39, -3851
+D2131:   .data 5549, 6287, K37, K39
+        dec  D1611[K1]
+D2132:   .string "qwzwetasztwfcdjemkljjr"
+L58:   cmp  #96, D530[13]
+D2133:   .data 7725, 3631, -7500, 254, 2750, -3090
+D2134:   .data 5221, 2575, 7235, -5247, 2279, K30
+D2135:   .data 7979, 2129, K17, 574
+D2136:   .data 1608, 7364, K22, 406, 4036, 3635, -1500, -140
+D2137:   .data K16, 7056, 1446, K38
+D2138:   .data -3611, -5839, K38, 7099, 2872, 361, 3218, K48
+D2139:   .data K16
+D2140:   .data 6387, -1419
+D2141:   .string "oibjowwtgkgwkpgwbdub"
+D2142:   .data 6367
+D2143:   .data -4611, K51, -5084, -3041, -5013, K41, -5345
+; generated comment line
+D2144:   .string "pooandryzicrtvksecz"
+D2145:   .data -5132, 6304, -2626, -6792, K30
+D2146:   .data K8
+D2147:   .data 5805
+D2148:   .data K40, K52, 4694, -4624, 1162, -5684, 2154, K41
+D2149:   .data -3358, 3018, -6077
+D2150:   .data K5, 6940
+D2151:   .data K35, K1, K32, -5013, 1086
+D2152:   .data -4761
+D2153:   .data -2568, 84, -2577, K1, K19, K6
+D2154:   .string "ovfpcnpx"
+D2155:   .data K50, 3202, 600, K44, 7253
+.define K54 = 15
+D2156:   .string "kpuclzomjnqtrhe"
+D2157:   .data 5618, K50, 4771, -6586
+D2158:   .data 1147, K20, -47, -7284, -7172, K13
+D2159:   .data -2382, K48, -2352, -431, 2061, 4385, -3289, -6893
+D2160:   .data -1267
+D2161:   .string "urvqgfnfklpp"
+D2162:   .data -4883, K8, -5572, 7388, 4297
+D2163:   .data -2263, K36, K37, -7632, -1446
+D2164:   .data K43, -386, -4313
+D2165:   .string "jpkw"
+D2166:   .string "v"
+D2167:   .data -4221, 4955, 3504, -1678, -290, 6873, 600
+D2168:   .data 6929, 4710, 3643, -6039, -5465, 1252, K44, -1261
+D2169:   .data -5343, K35, K19, -3137, 2197, 1830
+D2170:   .data K34, K12
+D2171:   .data 1524, 3142, -2049, K15
+D2172:   .string "lojbgowhddxsa"
+D2173:   .string "pxzbgkjwbkfjvnkzyeszq"
+D2174:   .string "mnzljbbjrpom"
+D2175:   .string "tpvlcrdiiv"
+.define K55 = 23
+D2176:   .data -2067, K35, 4504
+D2177:   .string "gmwjrwwgcdqekelrtxc"
+D2178:   .data 7721, -1066, K55, K8, 7908, 208, 4974
+D2179:   .data -2565, -3472, 5495, -2935, K24, -955, K2
+        dec  L31[0]
+; generated comment line
+D2180:   .string "ivoiblhukvmljmxd"
+D2181:   .data 3367, -278, 6993, -7776, -5286, K4, 7551
+D2182:   .string "oelpxgyimfdl"
+D2183:   .string "ocr"
+D2184:   .data -3888, 6973, -406, K48, -1466, -4453, -7361
+; generated comment line
+D2185:   .data K44
+D2186:   .string "yhinumzkvidc"
+D2187:   .data 6598
+        cmp  D2107[K17], D865
+D2188:   .data -7351, K6, K6, -3043, K2, -2960, 5824, 5685
+D2189:   .data 2019, -5532
+L59:   rts
+D2190:   .string "qrhnypws"
+D2191:   .string "muqubpqzyuecypeqh"
+D2192:   .string "dtgfhrutwfncg"
+D2193:   .data -4908, K21
+D2194:   .data 5583, 5255
+; generated comment line
+D2195:   .data -6586, -1627, K0
+D2196:   .data 7143, -1583, 6589, -6983
+.define K56 = 18
+D2197:   .data K14, -1390, 7836, 1267, K41, 4117, 386
+D2198:   .data 4019, 2847, 2366, -7571, 6917, -4803, -508, K8
+D2199:   .data -6346, -763, -2200, K2, -6264, -7776, 5060
+D2200:   .data -4943, -2741, 1990, 1049, 2803, 4388, K37, 7177
+D2201:   .data K49, 6100, -2753, 3118, -3712, -3615, -1240
+        sub  D1672[K39], D2108
+D2202:   .string "hpspmbqrwdze"
+D2203:   .data 4071, -937, -6376, 6944, -3807, K48, 958, K32
+D2204:   .data K10, 3154
+D2205:   .data -2593, 3942, K23, -726
+D2206:   .string "vuipcnshpndy"
+D2207:   .string "alkugfmxvdbtxzvriyjypjn"
+        inc  D208[11]
+D2208:   .string "mgidatquzt"
+D2209:   .data K15
+D2210:   .data 2364, -1358, K42, K43, 4317, 7322, 2424
+D2211:   .string "jywvgwkk"
+D2212:   .string "ckuiffzcddircojleeoru"
+D2213:   .data 4837, -2330, 5569
+D2214:   .data -36, -5701, -1799, 3486, 3088
+D2215:   .data -2261
+D2216:   .data -6123, 3464, 3103, K14, 136
+D2217:   .string "dlitew"
+D2218:   .data K35, K36, 1555, -2264
+D2219:   .string "wvqhimyntek"
+D2220:   .string "stbpbjgauckstelifgtoi"
+D2221:   .data -5939, 2253, 2942, 1468, 5133, K27, -1496, 4283
+.define K57 = 2
+.entry D25
+D2222:   .string "ufbbo"
+D2223:   .data -1325, 464, -1658, K8, K5
+D2224:   .string "abqyeajgvxhwpxha"
+D2225:   .data -7066
+        mov  r2, D1462
+D2226:   .data K41, 7496, 999
+D2227:   .data -5748, -5269, -2706, 1908, 6057, 4324
+D2228:   .string "fmyfppnopvnlaiqw"
+        sub  #627, r6
+D2229:   .data -5129, -1837, 4415, 2201, 999, K46
+D2230:   .data K33
+; generated comment line
+D2231:   .data -6261, -3992, -6759, 4733, -2112, 3641, K40
+D2232:   .string "mtviwedhopawdsusgrki"
+.define K58 = 11
+D2233:   .data K16, 3881, K18, K56, K49, -6974
+D2234:   .string "xbfoekjutnnmzsjn"
+D2235:   .data 3063, -1531, 2339
+D2236:   .string "mwrbnftnmzmnqnojrklgh"
+D2237:   .string "r"
+D2238:   .data 4800, 2418, 6667, K37, -4149, K19, -5329, 456
+D2239:   .data -4995, -972
+D2240:   .data K44, 2121, 1766, 5935
+; generated comment line
+D2241:   .data -753, 6227
+        jmp  D1359
+; generated comment line
+D2242:   .data 6229, -5253
+D2243:   .data 4134
+D2244:   .string "jxmrroebdcynmq"
+; generated comment line
+D2245:   .string "mlnuigqnbcaguzo"
+D2246:   .data 5785, 6911, K52, -446, 6533, 1298, K42
+        mov  #1982, D506
+D2247:   .string "nahboxocvvmkafqw"
+D2248:   .data 4828
+; generated comment line
+D2249:   .data 1923, -6328, 621, -5712
+D2250:   .data 5791, -549, 1661, 6938, -2941, -3930, -2195
+D2251:   .string "qckvjtelykzpfsuq"
+D2252:   .data -7370, 5678
+D2253:   .string "sxiqodzw"
+D2254:   .data -5566, 2551, -4741, -5162, -4114
+D2255:   .data -1278
+D2256:   .data -5823, K10
+D2257:   .data K39, K19, K25, 5810, 4723, 1885
+D2258:   .data 198, 1839, 2029, 7672
+D2259:   .data K7, K1, -4215, K17, 7580, 5196
+        add  #1340, D1322
+D2260:   .data 6995, -3712, -2167
+D2261:   .string "qoiuesqgondqfsys"
+D2262:   .data K57, -1899, K1, 3193, 1885, 3685
+D2263:   .data 3807, K8, -3297
+; generated comment line
+        hlt
+D2264:   .data 6377, 5869, -6096
+D2265:   .data -6807, 3960, K13, 5095
+D2266:   .data 2327, -4933, -7087, -4275
+; generated comment line
+D2267:   .data 4862, 2792, 1695, K21, -127, -4018, 6639, 6979
+D2268:   .data 7450, 2473, 6049, -583
+        lea  D1651, D2242[2]
+D2269:   .string "symhmclxup"
+D2270:   .data 7710, -2854, 1869, K19, K1, -1203, -1806
+D2271:   .string "mfrvwz"
+; generated comment line
+D2272:   .data K28, -3473, 4397, -2840, 4210
+D2273:   .string "thjfpsnejglsdpwxcxkrgt"
+D2274:   .string "kcpowxskfhmpst"
+D2275:   .data K30, -2917, 3842, K39, -7034
+D2276:   .data 6236, K42, K27, 709, 647, 844, -4522, -1962
+D2277:   .data -5707
+        inc  D1103
+D2278:   .data 4091
+L60:   sub  #-1469, r1
+D2279:   .data 4887, 384, -6596, K5, 4238
+D2280:   .data 2269, K49, K58
+D2281:   .data -7286
+D2282:   .data K42, K48, 9, -7770, -1820, K5, -1299
+.entry L26
+D2283:   .data -2422, K16
+D2284:   .data K10
+L61:   jsr  r2
+        red  r2
+D2285:   .data K22, -518, 5186
+D2286:   .string "euzhofkxcuvvzuwhgx"
+L62:   inc  D1875[1]
+D2287:   .string "noklkwepbvgr"
+D2288:   .string "fliwuivtfedmaudm"
+D2289:   .data 7623
+D2290:   .data 4058, K25, -5403, 3481, 6180
+D2291:   .string "qmnubotqjsyzafybqfm"
+D2292:   .data -6183
+D2293:   .data K16, -5692, K41, K33
+.entry D26
+D2294:   .data 7419, 3120
+D2295:   .data 5114, K49
+D2296:   .data K51, 3784, -6600
+D2297:   .string "wqvqdptwfjbelwegciymmmf"
+D2298:   .data 2338, 182, K37, -4412
+D2299:   .string "intoxllwzqndsgzjdfu"
+D2300:   .data 5843, K32, -6615, 2468, 3412, K42
+D2301:   .string "siqxbatt"
+D2302:   .string "lpzhrveamzomxipfompbtelh"
+D2303:   .data K33, -6584, K39, K3, K15, -5426
+D2304:   .string "pi"
+D2305:   .data 3624, -2926, -6857, -3992, -5997
+D2306:   .data -7816, 4001, -756, K54, 5696, -3037, 958, -805
+D2307:   .data K52, 6475, 2251, -6577, K41, -2281, 6025, 1694
+D2308:   .string "ldlmcm"
+D2309:   .data 1771, 7209, -6460, 6132
+.entry L27
+D2310:   .data -3219, 6718, -1482, 1132, 1924, 2317, 7523, -6772
+; generated comment line
+D2311:   .data -1341
+D2312:   .data 4923, -6860, -4498, 5211
+D2313:   .data -4551
+D2314:   .data 7893, -2350, 7035, -2781, K6, -4419
+D2315:   .data K45, K32, K1, K21, K56, -2539, 3001, -4889
+D2316:   .data K42, -5735, 2009, -1745, -6935, 508, -6547
+D2317:   .string "tcuglon"
+D2318:   .string "vgcmudvycw"
+D2319:   .data 580, 695, -2145, -212, -4774
+D2320:   .string "pm"
+D2321:   .data K46, K51, K9, -4800, -1050
+        dec  r7
+; generated comment line
+D2322:   .string "dwuarsgumgjqyjdgtc"
+        clr  r3
+D2323:   .data -7237, -2926, -3395, -967
+D2324:   .string "tajtwszeierllifkqhxjescm"
+D2325:   .data 3889, -540, -7845, K8, -1186, K7
+D2326:   .data K53, -2242, -6445
+D2327:   .data 6930, 2560, K18, 4494, 5336, 2634
+D2328:   .data -6174, -1688, 2888, 3104, K47, 4857, 546
+D2329:   .data 5469, 1834, 7142
+D2330:   .data -863, 1636, 2824, 5047, -6920
+D2331:   .data -3624
+D2332:   .data -1951, -1061, 5788, K38, -6202, -7153
+D2333:   .string "rzsfgyiweuqmmthmfwkaoqxw"
+D2334:   .data K11, -6379
+        cmp  D1300, #854
+D2335:   .data -4596, K2
+D2336:   .data 6375, -7713
+.entry D27
+D2337:   .data 6954, -7426, -7139, K51, -4835
+D2338:   .data 233, -1259, 4049, 3707, 4633, 7230, K16, -1046
+D2339:   .data 4448, K2, -4527, -6561, 6063, 1643, 2199, -2570
+D2340:   .data 4010, -7353, K48
+D2341:   .string "edysbece"
+D2342:   .string "wmjykdvkxpjsiydap"
+L63:   prn  D999
+D2343:   .data 5548
+D2344:   .string "ehcrtjqsjbnxxl"
+D2345:   .data 4376, -4947, -3949, 5007, -3887, -1325, K44
+D2346:   .string "ansnez"
+D2347:   .data K29, K2, 3956, K45
+D2348:   .data 930, -4072
+D2349:   .data K30, 433, -4319
+        clr  r3
+D2350:   .data K2, -4840
+D2351:   .data 7795, -1512
+D2352:   .string "glicube"
+D2353:   .data -3401, -7275, -6373, K24
+D2354:   .data -6481, -4363, K21, 1570, K11, 2354, K25, K30
+D2355:   .data 5784, 6567, 4280
+D2356:   .data -3273, K33, 2964, -1078, K6
+D2357:   .data 1433, -763, K54, -3505
+.entry L28
+D2358:   .data 5402, -6340, 928, -5676, K8, K51, 4009
+D2359:   .string "fmxqavnymo"
+D2360:   .data -1934, 7357, 126, -1383, K30, K58, K19
+D2361:   .string "kqbgdtudjz"
+D2362:   .string "dduddwqvquqtvvetoufl"
+D2363:   .data K29
+D2364:   .data K9, K0, K42, 1851
+D2365:   .string "vfmakou"
+L64:   jmp  r3
+D2366:   .string "amkrqvshg"
+D2367:   .string "xifab"
+D2368:   .data -7913, K22, -7792, -1169, K49, 2496, K1
+.entry D28
+D2369:   .data -2779, 6983, 3804, 3268, 7467
+D2370:   .string "cemintetmxeweidgtv"
+        sub  #282, D1336
+; generated comment line
+D2371:   .string "gxrafmiok"
+D2372:   .string "utdusrryjzpmdmfpsib"
+D2373:   .data -1038, 1409, 1791, K34, 4501, 3184, 3840, K24
+D2374:   .string "yycf"
+        clr  r1
+D2375:   .string "pxxxcsatogxqnpyibzdqrbdn"
+        cmp  #539, #K15
+D2376:   .string "eecvlmvuoruqiw"
+D2377:   .string "ylmuvhgfdbkkipyfvycyx"
+D2378:   .data K15, 3559, 7495, 1963
+D2379:   .data 3311, 2662, 3495, -2815, -6129, 5018, K10
+D2380:   .string "xldfxgdoninwzjer"
+D2381:   .data 5040
+D2382:   .string "zwqpioveutvqnob"
+D2383:   .data -951, 2549, -916, -5067, 4496, -3621, -7953
+D2384:   .string "gbcvffxq"
+D2385:   .string "izagqngfjxvnfjtfouhev"
+D2386:   .data 1102, -1345
+D2387:   .data -6216, 223
+D2388:   .data -2328, -1562, K51, 7398, K56, -6559, 5674
+D2389:   .data 3472, 3248, 7683
+D2390:   .string "ujwgrdxgcvsioega"
+D2391:   .data 562, 6655, -5740, 955, 7405
+        jmp  D603
+D2392:   .string "ymfco"
+D2393:   .data 5522, -4718, K35
+D2394:   .data K2
+        rts
+D2395:   .data 3986, 2235, -2402, -603, -1644, 2286
+D2396:   .string "lfap"
+D2397:   .data 6433, -1538
+D2398:   .data 3161, 797, 1328, 4359, K24, -1974, K34, -2894
+L65:   bne  D2276
+D2399:   .data -3226, K33, K30, -1897, K13, -4999, K3
+D2400:   .data K30, K16, K39, 5898, 7179, 5429
+D2401:   .data -6210, -6937, 3173, -1872
+D2402:   .data K27, K17, 2145, K47, -7948, -4636
+D2403:   .data -4803, 6807
+D2404:   .string "yjwrbdaxhhyxgwokkgeic"
+.entry L29
+.define K59 = 25
+D2405:   .string "ouifc"
+D2406:   .data K56, 1073, -683, 2589, K59, 7757
+D2407:   .string "pjn"
+D2408:   .data -3097
+D2409:   .data -7391, 2661, 5608
+D2410:   .data 4801, -2160, K22, 6911
+D2411:   .data -5425, 6451, -3703, 197
+D2412:   .data K27, 6102, -7680
+D2413:   .string "uzfdkblrrfctr"
+D2414:   .string "evkzteqatlobemdsis"
+; generated comment line
+D2415:   .data -1944, K29, 2026, 2531, -5218
+D2416:   .data -7929, -2472, K44, 6141, 89, -2344
+D2417:   .data -1885
+D2418:   .string "cnrliipz"
+D2419:   .data -3456, -4406, -4060, -6119, 2015, -1605
+D2420:   .data -504, -784, -4671, K45, K59, -2181, 1163
+D2421:   .string "uklqoluojzqlqvxguqbjhz"
+D2422:   .data 6078, 7481, -1155, K32
+END:    hlt
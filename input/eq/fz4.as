@@ -0,0 +1,3001 @@
+.define K0 = 63
+L6489 : hlt
+.define K2 = 37
+D11: .string "abc"
+.extern X0
+.extern X1
+.extern X2
+.extern X3
+.extern X4
+.extern X5
+.extern X6
+.extern X7
+L3512 : hlt
+.extern X9
+D395: .data 1, K0, L333
+.extern X11
+.extern X12
+.extern X13
+.extern X14
+.extern X15
+mcr m0
+    hlt
+    not  r4
+    clr  r5
+    red  r7
+    cmp  #34, #K1
+    dec  r6
+endmcr
+mcr m1
+    mov  #895, r5
+    bne  r6
+    jmp  r0
+    jmp  r0
+D175: .data 1, K0, D351
+    inc  r3
+endmcr
+mcr m2
+    clr  r7
+    dec  r0
+    bne  r5
+    jsr  r2
+    prn  r7
+    red  r4
+endmcr
+.extern D281
+    cmp  #1695, r3
+    mov  r4, r4
+    prn  r3
+    not  r4
+    not  r1
+    cmp  #448, r0
+endmcr
+mcr m4
+    rts
+    rts
+    jsr  r4
+    hlt
+    jsr  r7
+    dec  r0
+endmcr
+mcr m5
+L1009 : hlt
+    prn  r7
+    bne  r3
+    rts
+    mov  r3, r0
+BAD: jmp #3
+endmcr
+mcr m6
+D217: .data 1, K0, D430
+.extern D170
+    mov  #1792, r2
+    add  r2, r0
+D172: .data 1, K0, L134
+    jsr  r4
+endmcr
+mcr m7
+    hlt
+    red  r4
+    inc  r4
+    inc  r2
+    bne  r1
+    clr  r0
+endmcr
+MAIN:   mov  r0, r1
+        mov  #1485, r1
+D0:   .string "zznbrzveis"
+D27: .data 1, K0, D276
+        dec  r1
+; generated comment line
+; generated comment line
+L1:   prn  r0
+L82: .string "abc"
+        dec  L1
+.define K5 = 28
+        add  #998,, r6
+; generated comment line
+D1:   .data K1, -3479, K0, K5, K1, 7426
+
+.define K6 = 40
+D300: mov r1, r2
+        clr  L1[K5]
+; generated comment line
+L343: mov r1, r2
+        lea  D1[8], r3
+L3:   add  D0[0], D1
+D2:   .data -5274, 1950, K2, -5946, 3788, 5511
+        rts
+; generated comment line
+        cmp  r4, r5
+        dec  L1[6]
+D250: mov r1, r2
+        not  L0[K0]
+        red  L1
+        add  D2[9], r5
+L4:   inc  D2
+        m7
+L108: mov r1, r2
+        inc  L3[14]
+
+D3:   .data -164, K4, 3768, 3992, 5931, -3405
+D4:   .string "iunlruetikyqgkmiumwb"
+        hlt
+D5:   .string "iuhjky"
+        not  L0[12]
+        bne  r2
+        jmp  r7
+        rts
+        red  r5
+D6:   .string "zjgntmqjwy"
+        sub  D1, D2
+L5:   inc  r1
+L6:   dec  L0[2]
+L85: .string "abc"
+        lea  D2[6], L3[K6]
+        not  D0[12]
+        m1
+        lea  L0, L6[K4]
+        jsr  r6
+        rts
+D7:   .data -328, -5403, -3640, 3340, -6437, 1596
+        add  D5, r6
+        mov  r3, L6[K0]
+L7:   red  D6[K4]
+        add  L0, L5[0]
+        dec  L5[K6]
+D8:   .data 5521, -3836, -6150
+        bne  r7
+D9:   .data K4
+        m5
+        sub  r2, D0[K2]
+; generated comment line
+        cmp  r3, r2
+
+        cmp  L4, r5
+        clr  r3
+        red  D7
+        hlt
+; generated comment line
+; generated comment line
+; generated comment line
+; generated comment line
+        mov  D5, L3[10]
+D10:   .data K0, K6, K2, K5, -6245
+D11:   .data 4038, -3618, -358, 3853
+        clr  D5[K0]
+        m0
+L8:   bne  r4
+        not  L8[3]
+        rts
+        jsr  r5
+L9:   lea  L7, D11[K6]
+
+        rts
+; generated comment line
+        lea  X1, L4[10]
+        clr  L4
+
+D12:   .data K1, -2618, 3841
+        dec  D5[K4]
+        prn  D1
+D13:   .data -139
+.define D429 = 3
+; generated comment line
+        lea  D7[K5], L3
+L11:   inc  L1
+D14:   .data 7118, 5692, 3819, 796, 1836
+        mov  L10[K1], L5
+        lea  L0[K5], D10
+
+        bne  L8
+D512: .data 1, K0, D211
+        sub  D10[K0], L8[K2]
+.extern D333
+; generated comment line
+        cmp  r3, r4
+
+        lea  D13[K4], r1
+        mov  r4, D8[15]
+        dec  r6
+; generated comment line
+.define D381 = 3
+        dec  r2
+        add  L2, L4[10]
+D17:   .data 2969
+        not  r7
+        mov  r3, L5
+        dec  L10[K3]
+        prn  r7
+        jsr  D12
+        cmp  L8, L7
+        m2
+        prn  D13[K1]
+Q: .data UNDEF, 5
+
+        bne  r0
+L13:   mov  r3, r5
+D18:   .string "nbranbtb"
+        prn  D13
+D19:   .data 1389
+        sub  L7, r7
+L14:   dec  L8[K2]
+D105: .data 1, K0, L2
+; generated comment line
+BAD: jmp #3
+Q: .data UNDEF, 5
+        rts
+        add  D6, L5
+D21:   .string "qnithsoml"
+.define K7 = 16
+; generated comment line
+        red  r7
+        inc  r1
+
+L15:   cmp  D16[K2], r7
+L19: .data 1, K0, D377
+D23:   .data -4610, 4598, -5716, -5948, 6861, -2909
+        rts
+
+        inc  D3
+D24:   .data 5549, -3719, -2288
+; generated comment line
+D25:   .string "znjsqtghufbrxalouqxeks"
+.define K8 = 60
+D26:   .string "rxllnyqbkdpvdrefvmcdbi"
+        bne  L3
+        sub  L8, D25
+        not  r4
+L16:   hlt
+D27:   .data -2, 6945, -7666, K5, K6, -2340, 7560, -4378
+D28:   .string "zvzotrshqajlsma"
+D29:   .data K5
+        dec  L2
+D30:   .string "iptzckf"
+        add  D8[2], D10
+D31:   .data K7, 6636, K3
+; generated comment line
+.define K9 = 53
+        clr  D6[K5]
+        cmp  L12, D6[4]
+.define L262 = 3
+        add  #323, L13
+        jsr  D10
+        dec  L8[K4]
+L17:   hlt
+        bne  r5
+D11: .data 1, K0, D320
+D33:   .string "mdsaggnpgpqxmqyer"
+.define K10 = 16
+        clr  D6
+L19:   dec  r6
+        red  r1
+        not  L8[K6]
+D34:   .data -1067, 4889, 1025, K4, 4593
+        cmp  D15, r1
+        rts
+L20:   jmp  D10
+L21:   jsr  D34
+        inc  L3[1]
+Q: .data UNDEF, 5
+        jmp  D17
+L22:   not  r3
+        jsr  r2
+L23:   hlt
+        red  r6
+        bne  r7
+        hlt
+        rts
+D35:   .data K0, K4, K5, K1, K10, 4119, 4521
+        rts
+        red  L20[K8]
+        rts
+D36:   .string "chlvoxazfhikrjtrth"
+D37:   .data 3160, -3731, -1069, 6607, 7313, -109, K0
+D38:   .string "erujcb"
+.define K11 = 20
+        add  D23[2], D14
+L24:   red  L19
+D39:   .data -4592, 597
+; generated comment line
+        dec  D24[10]
+
+D116: .data 1, K0, D330
+        cmp  r7, L19[3]
+L25:   not  r7
+
+; generated comment line
+        m0
+D313: .data 1, K0, D41
+L26:   red  D8[K3]
+D41:   .string "wkdpqwkudiyygxn"
+L27:   clr  r4
+.define K12 = 26
+        bne  D2
+        lea  D11[K4], r4
+        rts
+L28:   rts
+        lea  L22, D4[K12]
+        clr  r2
+L29:   add  #-1103, r1
+.entry L1                              xx yy
+        sub  L1, L5                xx yy
+D42:   .string "hocwzdbmhiitvjcmgefvvsr"
+D43:   .data 178, -3444, K2, -2333, K7
+        prn  r1
+        mov  D30, L26[K0]
+        rts
+        inc  r5
+; generated comment line
+
+        clr  D8
+L13: .string "abc"
+; generated comment line
+.extern D161
+L30:   not  D23                                                                                  xx yy
+L31:   jsr  r5
+D45:   .string "fefc"
+        lea  D27[K8], L8[K5]
+        inc  D41
+        sub  L12[1], D43
+        m7
+        bne  L29
+        sub  #1445, L16[K11]
+; generated comment line
+D46:   .data K1, 7908, 5125, -2847, -7915, -3781, -3641
+L32:   lea  D21, D23
+D47:   .data -3392, -3279, -2731, 856
+        not  L7
+        bne  D44
+D48:   .string "t"
+.entry D1
+        bne  r6                     xx yy
+D49:   .data -2562, 7189, K8, 6753, K1, K0, K11, -7046
+D50:   .string "tjdaaqvg"
+L33:   prn  D37
+        inc  D1[11]
+.define K13 = 53
+D51:   .data -1625, 5957, 6464, -5424, -7158, -5694, -2589, -1705
+.define K14 = 57
+   xx yy
+
+; generated comment line
+D52:   .string "ayzeevfoxchzeeebrvnkydje"
+L34:   hlt
+.extern D71
+        dec  D27
+
+        jsr  r3
+L35:   jsr  D0
+D53:   .string "bhsgdze"
+; generated comment line
+
+        hlt
+        hlt
+L36:   add  D26[K11], L6[K14]
+        red  r0
+D54:   .string "zrrawpmyogaoycscgjt"
+D55:   .string "fsjogxbsgonimmcqzkydrwtm"
+; generated comment line
+        hlt
+.define K15 = 56
+L5845 : hlt
+D56:   .data -2478, -6789, -6050, -1691, -3884, -5970
+        sub  r0, r6
+; generated comment line
+L37:   rts
+L257: mov r1, r2
+D57:   .string "rswqdgjqccxrcamgcatbvbh"
+
+        mov  r4, r2
+        not  D14[4]
+D58:   .string "aelohjqjnghh"
+; generated comment line
+L38:   bne  L23
+        bne  r1
+.extern D142
+        dec  D7[K15]
+; generated comment line
+.entry L2
+        mov  #-1043, L34[7]
+        mov  #14, r5
+D60:   .string "olncvrrwlohdmipblzusj"
+        bne  r1
+D61:   .data K6, -7109, 1025, -4784, K10, 7359, -5397
+.extern D437
+L212: mov r1, r2
+        prn  r1
+
+        red  L19
+L39:   lea  D53, D61[8]
+.define D478 = 3
+        add  L13[K12], D6[12]
+D62:   .data -93, -418, -4938
+.entry D2
+L40:   clr  L21
+        bne  D30
+.define K16 = 26
+        cmp  X7, D55
+.define D136 = 3
+D63:   .string "waaltpttlutqzknkhjinqhi"
+L41:   hlt
+D446: .data 1, K0, L14
+D430: .data 1, K0, L57
+; generated comment line
+D64:   .string "uqwfxznogfxslhdf"
+        not  L19[15]
+        rts
+        rts
+        bne  r1
+        sub  r0, r1
+.define K17 = 29
+        hlt
+        m3
+        hlt                                                                 xx yy
+        clr  D24[6]
+D65:   .string "jtgeeypjicm"
+D66:   .data K14, K1, -223, 3966, 5244, K7, 2693
+        lea  D28, L38[K16]
+        sub  D47, r5
+        bne  L10
+L42:   rts
+D261: .data 1, K0, D162
+        mov  r5, r7
+        m5
+L43:   not  L15[0]
+        prn  r3
+L44:   prn  L25[1]
+        mov  #896, L24[K0]
+        prn  r4
+D67:   .data -7161, K4, 2079, -7928, K4, 5632
+.extern L168
+        add  L5, r6
+; generated comment line
+        sub  L12[K15], L12
+L45:   prn  r3
+D68:   .data K8, 5864, 2256, -7855, 1875, 5320, 7056, 855
+.extern L321
+        m3
+D129: .string "abc"
+        not  D34
+        lea  L0, L14[14]
+
+        bne  D9
+D69:   .data -5867, K13, -2654, K9
+D70:   .data -1890, -4339, 7787, K5
+D349: .data 1, K0, L79
+D72:   .data 5253
+        red  L33
+D73:   .data -6456, K10, 4172, K7
+Q: .data UNDEF, 5
+        jmp  r5
+L46:   mov  #1311, L15
+
+        jmp  D8
+        bne  L44
+.define L351 = 3
+        jsr  L21
+        lea  D65[0], r6
+        rts
+        dec  D27[1]
+        m3
+; generated comment line
+        lea  L40, r0
+L47:   cmp  L20, #124
+L48:   sub  D71, D34[12]
+L49:   lea  L43, r7
+        sub  D69[1], r4
+D74:   .string "npmntxxeutk"
+D75:   .data -1451, -6838, 2692, K14
+L50:   prn  r0
+        clr  L32
+L19: mov r1, r2
+        jmp  D1
+        cmp  L37[K8], r4
+        add  #-783, D54
+        m0
+L51:   jmp  D50
+        prn  D21[3]
+D76:   .string "ulbhisfeeqq"
+        rts
+L3269 : hlt
+L52:   dec  D73
+D78:   .data -5266, -7954, 6094, K13, 2315, K14, 962, -7437
+        cmp  D18, D53
+        bne  L33
+
+.define K18 = 39
+D79:   .string "ewsurtfolkqapermoqrbok"
+L15: mov r1, r2
+D80:   .data 4171, 7309
+L53:   dec  L52
+D81:   .data -2027, K1, 3802, -224, 3136, 7128
+.entry D3
+        cmp  L51, r2
+        sub  L15[9], r1
+
+        jsr  X3
+; generated comment line
+Q: .data UNDEF, 5
+        hlt
+        red  L52
+        m6
+D83:   .data -6332, -3804
+D73: .data 1, K0, D120
+; generated comment line
+        jmp  L3
+        jmp  L9
+D84:   .data 1507, 3793, K15, -141, -4799, -4161, 887
+        add  D30, L7
+        m6
+        red  D79
+        lea  L37, L48
+D85:   .data -2043
+        sub  r2, r7
+; generated comment line
+D86:   .data -2635, -787, -3020, K13, -7385, -2751
+D430: .data 1, K0, D84
+D88:   .data 5755, 4470
+        sub  L31, L22
+        m0
+        hlt
+        mov  #-327, D10
+        cmp  D80[1], L14
+        bne  r2
+L54:   prn  r5
+.define D98 = 3
+L55:   inc  L39
+D89:   .string "mdumllkdyrtoygttzheuv"
+        clr  L40[K3]
+; generated comment line
+        red  r0
+L56:   bne  r2
+L57:   lea  D49[13], r5
+D261: .data 1, K0, D139
+; generated comment line
+D90:   .string "xbjurrwybtkkbqaybavcurvu"
+D115: mov r1, r2
+D91:   .data 3744, -5477, 5969, 637, K4
+        not  r5
+L58:   add  L20[1], D40
+        jsr  D50
+        mov  D10[K14], r5
+        clr  r4
+D92:   .string "uktxju"
+        jmp  r0
+
+D93:   .data -1339, -840, 2127, K2, -5960
+; generated comment line
+
+        bne  D27
+L60: mov r1, r2
+L60:   prn  D14
+        red  r0
+        not  D13[3]
+
+Q: .data UNDEF, 5
+        dec  r6
+        lea  D29[8], D47
+L61:   dec  D32
+        hlt
+        prn  L28
+        lea  L46, L51[K19]
+D94:   .data K13,, -6147, -1979, 6629
+        m0
+D95:   .data 6386, K0, -3537, 442, 778, -7886, 1840
+.extern D30
+        prn  r3
+        not  r1
+        jmp  r7
+        jmp  r7
+        jsr  r0
+        jsr  L36
+        cmp  r1, #1709
+D96:   .data 4105, -6953, K16, 4617, K12, -5582, -5127, -642
+        dec  L19
+L62:   jmp  D69
+.define K20 = 44
+L63:   dec  D60[12]
+L64:   rts
+        rts
+        m7
+D324: .data 1, K0, L243
+        inc  D5[K5]
+        inc  r4
+.define D258 = 3
+        mov  D71[1], r4
+        hlt
+D98:   .data -4742, 2523, -7665
+D126: mov r1, r2
+; generated comment line
+        inc  L25[K12]
+        add  D94, r7
+        cmp  r6, r1
+        inc  L51[15]
+D100:   .data K7
+        dec  r4
+L1: .data 1, K0, D175
+        dec  r6
+        jmp  r6
+.define K21 = 33                                                                  xx yy
+D102:   .data K10, -6994
+        mov  #877, r6
+D103:   .data -6822, 6469, -5620, K4, 872
+D104:   .data 4169, 175, K9, 242, 4277, 6594, K19
+        mov  #1326, D40
+D105:   .data 1132, -3501, -2747, K4, 5057, K10, 7627, K10
+        red  r4                                                       xx yy
+; generated comment line
+D106:   .string "nkulptqchmh"
+        cmp  r1, L65
+        rts
+L66:   mov  r0, D38[6]
+; generated comment line
+.define K22 = 59
+L67:   inc  D89[14]
+        dec  L48
+.define K23 = 11
+D107:   .data -1934, 1191, -2261, -6906, -4322
+L16: .data 1, K0, L314
+
+D108:   .string "bkrkdiy"
+        sub  r1, L42
+
+D109:   .data 1320, -683, -584, 5372, 4427, -2388
+D110:   .data -4932, 2833, 4818, 850, 1490
+        jmp  L11
+L68:   red  D55
+        dec  L49
+        mov  #-1210, r0
+        m6
+.define K24 = 61
+D111:   .data -499, 7189
+D342: .data 1, K0, D349
+L69:   prn  L62[13]
+D112:   .string "lj"
+L70:   jmp  r5
+        rts
+        cmp  L56, #K19
+D113:   .string "rhtzllreukxuwfmt"
+        m4
+D114:   .data -333, -1629, 1151, 6859, -1590, 5593
+D115:   .data -5909, K12, -2557, 7850, 6130, -1375, 1124
+D116:   .string "egqncuhdgb"
+        add  D14[K21], r5
+        jsr  r2
+        mov  #1865, D103[K10]
+D117:   .data K2, 6111, 3101, 7256, 3554
+.define K25 = 46
+L71:   red  D24
+
+D140: .string "abc"
+        sub  D106[K3], L60
+L72:   cmp  D114[5], D70[15]
+; generated comment line
+        jmp  D1
+D187: .string "abc"
+L2: mov r1, r2
+L0: mov r1, r2
+        red  r1
+L73:   red  D50
+        m4
+D119:   .data K5, 3990, K3, K22, K3, 2381, K8
+
+.entry L4
+D120:   .data K9, -5216, -4038, K5, 1088
+L74:   inc  L61
+        sub  D85[K6], L41
+        bne  D87
+; generated comment line
+D121:   .data -5246, 4291, 1138, K16, 3626
+D117: mov r1, r2
+        clr  L14
+D100: .data 1, K0, D259
+D123:   .data 5524, 4966, 6105
+L92: mov r1, r2
+        red  r6
+        hlt
+        inc  r0
+        dec  r3
+D221: .data 1, K0, L38
+        prn  L38[8]
+        m7
+.entry D4
+D124:   .data K9, K25, -6263
+        bne  r0
+.define K26 = 37
+        cmp  #573, r4
+.extern D236
+
+        sub  #1449, D60
+L39: .string "abc"
+BAD: jmp #3
+        jsr  D112
+        cmp  D22, L11
+        bne  L14
+D125:   .data 2774, 1374, -836, 1086, K3, 1554, -39
+        inc  r2
+        clr  L47[11]
+        hlt
+D126:   .string "otjznqimovojbiuadbet"
+        hlt
+L5582 : hlt
+L77:   sub  D112[4], D126
+        jmp  r4
+L78:   dec  D84[K7]
+
+
+D127:   .string "xoyfcsoyhsgahwkzj"
+        clr  L53[0]
+        rts
+
+L79:   dec  D102
+L80:   mov  r3, r2
+; generated comment line
+D475: mov r1, r2
+; generated comment line
+L81:   jmp  r4
+        rts
+; generated comment line
+L82:   red  D43[4]
+L83:   sub  r0, D30[K26]
+L84:   not  L33
+        m6
+.define K27 = 42
+        jmp  r4
+BAD: jmp #3
+L85:   red  r7
+L283: .data 1, K0, D256
+L86:   inc  L62[2]
+.entry D5
+        clr  X9
+        m2
+        rts
+        bne  r4
+L87:   jmp  r2
+L88:   clr  L24
+D130:   .data -7372, 423, 7183, 1436, 586
+        m1
+        hlt
+; generated comment line
+        dec  D69
+; generated comment line
+
+        add  #-335, r0
+        add  #-281, L72[K8]
+L89:   sub  D80[3], D0
+; generated comment line
+D131:   .data -3838, -5075, 5161, -4195
+        jmp  r2
+        prn  #-1481
+        not  L85[6]
+        sub  #38, D14[10]
+        rts
+; generated comment line
+        add  r3, L78[K1]
+        add  r6, D84
+D423: .data 1, K0, L233
+        cmp  r0, #1992
+L337: mov r1, r2
+.entry L6
+L90:   hlt
+        red  r1
+        cmp  D69[K2], L40
+        dec  L23[K25]
+        prn  #K13
+        hlt
+D132:   .data 1866, 890, 4140, K4, K2, -3556
+D67: mov r1, r2
+        mov  #1954, D101
+; generated comment line
+
+        jmp  r1
+        m6                                                                              xx yy
+        lea  L4[K17], r3
+        rts
+        jmp  D64
+
+.entry D6
+; generated comment line
+        jsr  r6
+D133:   .data -1403, -6975
+.define K28 = 58
+        dec  r2
+; generated comment line
+L91:   mov  L13[15], D61
+; generated comment line
+        rts
+; generated comment line
+        inc  D24[15]
+L92:   add  #-907, L48
+        cmp  r6,, #K9
+; generated comment line
+        bne  r6
+D134:   .data K23,, 3121, -2387, 6220, K24
+        jsr  D99
+D135:   .data K24                               xx yy
+        jmp  r4
+        dec  D91
+L93:   cmp  r5, L29[4]
+        inc  D122[3]
+        add  #573, r4
+        jsr  D73
+.extern D91
+        mov  L38, D131
+; generated comment line
+        cmp  D66, r3
+        add  D3, L18
+        jsr  r4
+        hlt
+L2364 : hlt
+D388: mov r1, r2
+D136:   .data -3709
+        dec  D87[K23]
+; generated comment line
+        lea  L88[K8], X3
+L94:   bne  L59
+D137:   .data K22, 2431, -4196, -7187, 950, K13
+; generated comment line
+        m6
+        jmp  r6
+L165: .data 1, K0, D425
+.entry L7
+        lea  D52, D108
+        jsr  D23
+L95:   clr  r2
+        add  #-1823, r1
+        sub  D97, L67
+        cmp  L64, #K16
+D138:   .string "jztgiumjhnqhu"
+; generated comment line
+        prn  #K27
+; generated comment line
+        not  L25
+; generated comment line
+D139:   .string "swcvmfufqtqwporqt"
+L96:   lea  L32[15], r4
+; generated comment line
+; generated comment line
+.define L127 = 3
+D310: mov r1, r2
+        m0
+D324: .string "abc"
+L112: .data 1, K0, L340
+        jsr  r5
+        jsr  D8
+Q: .data UNDEF, 5
+; generated comment line
+        bne  D18
+        rts
+.define K29 = 20
+L5939 : hlt
+
+D140:   .data 1942, K2, 4103, 6218, 5947, 7245, -1780, -7037
+        m0
+        clr  L30[K27]
+.entry D7
+        not  L25[11]
+.entry L8
+.define K31 = 44
+        prn  #K1
+        bne  r1
+        sub  L22, D102
+D141:   .string "odktu"
+L85: mov r1, r2
+        sub  D114[2], D104[K3]
+        not  L91
+        prn  L16
+L97:   hlt
+; generated comment line
+; generated comment line
+D142:   .data -5541, K17, 6243, 5045, 7978, 4383, -3219, -1845
+D143:   .string "guxdh"
+; generated comment line
+.define K32 = 8
+.entry D8
+        sub  r2, D10
+.entry L9
+.define L190 = 3
+        not  D0
+        jmp  D137
+Q: .data UNDEF, 5
+L99:   rts
+D144:   .data 3128, 449, 5175, -7493, K19, K13, K20
+L100:   inc  D49
+        jmp  D125
+
+        rts
+.entry D9
+.extern D228
+.define K33 = 23
+D181: .string "abc"
+        mov  #-1709, D37[7]
+D145:   .data 3679, 2124, -2368, K32, K28, K4
+        add  r6, L92[K5]
+        jsr  r4
+L101:   not  D110
+        red  L31[K33]
+        clr  r0
+        inc  r6
+        clr  L55
+        lea  L3, r7
+L102:   hlt
+        jsr  r2
+D146:   .data -1255, -610, 4566
+L103:   mov  L19[2], r2
+        bne  D79
+D147:   .data 22, K22, K21, 5191, K19, 937, K14
+D415: mov r1, r2
+; generated comment line
+        prn  L51
+        lea  D58, r1
+L104:   red  L42
+L105:   cmp  #650, #K29
+D148:   .data 6634, -7382
+        not  D44[11]
+
+L106:   lea  L52, r6
+
+        inc  r5
+        mov  D66, L37[K9]
+; generated comment line
+.entry L10
+        m5
+        jsr  r4
+L107:   clr  L36[7]
+D450: .data 1, K0, L52
+        cmp  L43, D69
+        cmp  L77, r5
+        inc  L17[K9]
+D149:   .data 4425, -6826, -2761, 1995, -4674
+        bne  r6
+        sub  D51[K17], r0
+        add  #434, L73
+L108:   prn  D141
+        bne  L31
+; generated comment line
+D150:   .data 5461, -5062, K8, -1656, -5101, 4642
+D151:   .data 3251, K12
+        red  r1
+        add  r3, L99[15]
+        hlt
+        hlt
+D152:   .data K17, 7723, 4795, -3300, 3524, -6811
+        add  #1613, D151[K17]
+
+        m7
+        bne  L27
+        m7
+        jsr  L108
+D153:   .string "ajeaybkykfijjtvrjvjlss"
+; generated comment line
+        hlt
+        jsr  D141
+        not  D28
+L6678 : hlt
+; generated comment line
+; generated comment line
+
+.entry D10
+        jmp  r1
+        prn  #-1173
+.define D194 = 3
+D154:   .string "ewwycskkmivlvilxmxyoxzi"
+        add  L65[0], L92[K5]
+L109:   mov  D25[5], D33[14]
+        m7
+L110:   hlt
+D207: .data 1, K0, L108
+        red  D107
+        m6
+L111:   prn  L110
+        prn  #K31
+        sub  D25[K22], D50
+        prn  L0[K31]
+L9406 : hlt
+L8118 : hlt
+        mov  #1593, D85[11]
+; generated comment line
+        sub  D152[K1], L65[3]
+BAD: jmp #3
+        hlt
+        clr  D1[K11]
+        cmp  D79, D34[4]
+        dec  r6
+        red  D71[K16]
+L112:   cmp  L15[K7], r2
+        clr  L21[K24]
+D157:   .string "hwkbjffshzjlqmicrixr"
+; generated comment line
+L113:   mov  L9, D13[7]
+L114:   mov  #620, r5
+        jsr  D61
+        jsr  r1
+D158:   .data 7856, K31
+
+        lea  D51[0], D47[8]
+        hlt
+        red  r2
+D159:   .data -663
+D160:   .string "gfsxvqksz"
+D161:   .string "sscngnfpszuldtoubnvhthei"
+        sub  D38, D1
+L115:   rts
+.entry D11
+        sub  #1833, r1
+L116:   bne  r2
+L117:   bne  r0
+        m7
+
+.define K34 = 54
+        clr  r1
+L118:   cmp  L65, r4
+        add  L67, L62
+D162:   .string "xcqqfqpznpzjj"
+        prn  D1
+D163:   .string "qthqspjgsfcegtopgmrlyesu"
+        mov  D82[13], L11
+        hlt
+
+        lea  D10, L8[K9]
+D164:   .data -3985, -4431, K17
+L119:   dec  r1
+.define K35 = 59
+
+.entry L12
+        not  D20[K23]
+; generated comment line
+
+        jsr  r3
+L8108 : hlt
+D165:   .string "vkhpyuvasirxzgzs"
+D166:   .data 4670, -882                                                                             xx yy
+L132: .data 1, K0, L165
+        add  r4, r6
+D167:   .data K25, 7502, -3328, K32, 905, -5765, -7747
+        dec  D107[K18]
+D168:   .data 736, -6551, 89
+; generated comment line                                               xx yy
+D169:   .data K32
+        bne  r1
+        bne  D105
+        jmp  r4
+        hlt
+.entry D12
+
+        lea  L59[K6], D159[6]
+        rts
+        not  r5
+BAD: jmp #3
+L120:   not  r3
+        dec  L77
+        jmp  D83
+D170:   .string "jihwbd"
+D171:   .data 2081, 2420
+        m3
+L121:   hlt
+.define K37 = 18
+D172:   .string "ghwhpgcglbg"
+        red  r7
+.define K38 = 4
+
+        sub  D162, r2
+D173:   .string "tlmnzftj"
+        rts
+BAD: jmp #3
+L64: mov r1, r2
+.define K39 = 39
+        bne  D46
+D176:   .string "ocfdx"
+L122:   dec  L59[5]
+L123:   jsr  r7
+
+        inc  D132[K14]
+        clr  r3
+        jmp  D175
+L124:   prn  D83
+L5640 : hlt
+D177:   .string "x"
+D178:   .data -2934, -1216
+
+; generated comment line
+L125:   hlt
+; generated comment line
+L126:   bne  r5
+D179:   .data K9                                                                                       xx yy
+
+D84: .string "abc"
+        jmp  D178
+        jsr  r3
+        dec  r7
+        dec  r1
+        red  L16
+        add  L49[K6], r0
+D205: mov r1, r2
+        m3
+        m6
+        add  #-171, r2
+        bne  r0
+Q: .data UNDEF, 5
+        rts
+; generated comment line
+.define K40 = 16
+        dec  D102[11]
+        clr  r6
+        clr  D130
+.entry D13
+D181:   .data 7548, 3035, 25, -6594, 1200
+D182:   .string "j"
+D320: .data 1, K0, D218
+.define K41 = 8                                 xx yy
+        jmp  D123
+D183:   .data 3402                                                                    xx yy
+        red  r0
+        m1
+D184:   .data -7280
+L127:   bne  r4
+        m3
+        lea  L61[8], L47
+        lea  D118, r1
+
+.define K42 = 48
+        jsr  L94
+L86: mov r1, r2
+D185:   .string "ercjukfbxcqayvrsu"
+L128:   lea  D170, D59[K20]
+        prn  D162
+        mov  L98[K12], L31[K35]
+        inc  L81
+; generated comment line
+D186:   .string "lqivxuxzvgxehveovrpvuc"
+        inc  L87[15]
+
+D187:   .data K37, -3790, -4980, 4161, K25, -1641
+        hlt
+
+        prn  D80[K32]
+D188:   .data -2514, 1451
+D189:   .string "fltbelfyibmpgtfoaufzml"
+D190:   .data K10, -3214, 4494, K22
+        sub  r5, r4
+.define K43 = 53
+        cmp  D60[7], r2
+Q: .data UNDEF, 5
+; generated comment line
+        not  D180
+
+.define D290 = 3
+        prn  #K31
+        jsr  r0
+D138: .string "abc"
+L129:   dec  D169[14]
+        lea  D73[K15], D93
+        add  D29[K5], L87[4]
+
+D191:   .data 7790, -7120, 7417                xx yy
+        sub  L63[K23], D112[0]
+        jsr  r3
+        dec  L71
+; generated comment line
+        inc  D89
+        rts
+L130:   mov  r6, D13
+        jmp  r2
+.extern D239
+; generated comment line
+        add  r7, D57
+        add  r0, D183[K4]
+        rts
+        not  r2
+L131:   prn  r3
+L132:   not  D38
+        not  L3[12]
+        bne  r2
+        jmp  r7
+        rts
+        red  r5
+        sub  L78, r6
+D192:   .data K7
+        inc  r2
+L133:   bne  D99
+        clr  r0
+        jmp  D113
+        prn  #K14
+D193:   .data -3895, -2874, -6828, K0, -1886, -7156, -4706, 6028
+; generated comment line
+        m4
+        not  D191
+L134:   clr  D118
+        jsr  D137
+        prn  D69[K42]
+        prn  L117[K37]
+L135:   mov  r3, D140
+        jmp  r6
+; generated comment line
+; generated comment line
+
+        mov  #-1515, r7
+L136:   dec  L38
+D194:   .string "ydhutflgvcxpy"
+D385: .data 1, K0, D187
+        jmp  r0
+D196:   .data -5286, -1173
+; generated comment line
+.entry D14
+        cmp  L58, r5
+D197:   .data -760, 6079, K0, -5471, -4370, 2447, -2077
+        hlt
+Q: .data UNDEF, 5
+        red  L64[3]
+        lea  L18, X4
+L351: mov r1, r2
+L137:   clr  r7
+        m0
+        jsr  r2
+        mov  r4, L60
+        not  r5
+D198:   .data -4095, K38, -1238, K1
+D199:   .data -1405, -6171, -6777, K37, K23, -5608, 4512, -5530
+D200:   .data -6956, -3012, 5149, K4
+; generated comment line
+        lea  L44[K0], r4
+
+        not  L135
+        prn  #1420
+L138:   inc  D11
+        inc  r0
+BAD: jmp #3
+        jmp  r7
+        not  L57
+        clr  D48
+; generated comment line
+D201:   .data K35, 2685, K6, 637, K2
+.define K44 = 24
+; generated comment line
+        cmp  r1, D34[K13]                                xx yy
+        not  L62
+        rts
+D202:   .string "mcaekgatbbcxhszkyxxwkwv"
+D203:   .data 5590, -6662, -495
+; generated comment line
+
+; generated comment line
+; generated comment line
+; generated comment line
+
+        jsr  D131
+        cmp  r3, r4
+.entry L15
+L139:   not  L48[9]
+; generated comment line
+; generated comment line
+L140:   mov  #-307, r0                                                   xx yy
+D204:   .data 3084, -1928, -4394, -816, K33
+
+; generated comment line
+        mov  L78, r5
+        add  L133[2], D156
+        red  r1
+BAD: jmp #3
+        dec  L67
+D205:   .string "naybmvqobdrukgarrm"
+D206:   .data K25, K33, 2920
+BAD: jmp #3
+D208:   .data K17, -5774, 2286, K10, -661, 726
+        rts
+D209:   .string "gudvqwhpsjlnqhyrtykr"
+D210:   .data 4134, 6613, -7821, K22
+        not  r4
+        hlt
+.define D213 = 3
+        jmp  r7
+L142:   mov  #1939, L66
+        add  D48, L141[4]
+D159: .string "abc"
+        not  D204[K5]
+D211:   .string "r"
+        m7
+        rts
+D72: .data 1, K0, L206
+D481: .string "abc"
+; generated comment line
+        red  D195
+BAD: jmp #3
+D213:   .data 1215, -4164
+        red  r3
+D214:   .data K31, K24
+BAD: jmp #3
+
+        not  r5
+        m2
+; generated comment line
+D305: .data 1, K0, L235
+D215:   .data K12, 4749, -7463, -3856, 985, -3244
+        sub  r2, r6
+        clr  D103
+L144:   clr  L4[8]
+        jsr  r1
+.define K45 = 30
+        add  L116, r1
+        bne  r5
+        bne  D28
+        jmp  r2
+        m6
+        dec  L80[K40]
+; generated comment line
+D216:   .string "vgvainzz"
+Q: .data UNDEF, 5
+L145:   prn  L4[K44]
+        sub  L105, L25[2]
+        add  #-48, r0
+; generated comment line
+        m0
+L146:   inc  r7
+        jmp  r4
+D217:   .data -5861, -2761, -2503
+        hlt
+L147:   jmp  D198
+.entry D15
+        inc  D91[K44]
+        lea  L5, r6
+        not  r3
+        rts
+        lea  L71, D190
+L148:   add  #116, r0
+        dec  D95[K26]
+        m1
+        hlt
+.entry L16
+L149:   rts
+D135: .string "abc"
+D219:   .data 4254, K35, 769, K18, K24, -6891, K32
+        dec  r5
+D220:   .data -2437, 6204
+D221:   .data -425, 2751, K45, 6215, 2883, -4246
+D225: .string "abc"
+        prn  #K38
+        add  #1844, r1
+D486: .data 1, K0, L139
+        cmp  D92, #-1738
+        jmp  L9
+; generated comment line
+D222:   .data 4617, 1708, -3766, 2334, -2883, K22
+; generated comment line
+L150:   inc  r3
+.entry D16
+        jsr  r1
+        dec  D5
+; generated comment line
+        inc  r1
+        m3
+
+D223:   .data -490, 5381, 4445, -4779, -6564, K36, 5583, -3543
+        lea  D86, r0
+D224:   .string "wjfwd"
+        rts
+        red  r4
+        cmp  #-1207, D181
+        jsr  L108
+; generated comment line
+L151:   cmp  D40, r7
+D225:   .string "hdrdrfozy"
+        not  r5
+        inc  L18[3]
+        add  #-1235, r4
+        jsr  D111
+; generated comment line
+; generated comment line
+L152:   cmp  r5, D155[2]
+D278: mov r1, r2
+        dec  r2
+L153:   add  D19, L148
+
+        not  D222[7]
+D226:   .data K17, -4926, K1, 3410, K27, K4
+        jmp  D156
+        prn  r7
+        not  r2
+        jsr  r5
+; generated comment line
+D227:   .string "nnveqjsqkooai"
+D228:   .data K39
+; generated comment line
+        mov  r6, D196
+        lea  L53, L82[K35]
+        clr  r2
+
+
+D436: .string "abc"
+        sub  X2, L39[K20]
+D229:   .string "vodmglpfqukyxllwxoaibg"
+; generated comment line
+L154:   sub  #-1172, L12                                     xx yy
+L155:   clr  D204
+        cmp  r0, #-162
+        inc  r7
+        clr  r6
+        clr  L148
+Q: .data UNDEF, 5
+D110: .data 1, K0, L98
+        dec  L128
+        bne  L82
+BAD: jmp #3
+        sub  D192[K44], D147[K12]
+
+; generated comment line
+L157:   rts
+        inc  r0
+D230:   .string "gbvgfhxchwntssxhdnyujtd"
+        sub  #-539, D151[K2]
+        bne  D92
+D231:   .string "zlfzzrrzfimqbm"
+        clr  D181
+L158:   jsr  r5
+        clr  D3
+D232:   .data 7885
+
+.entry L17
+.define K46 = 30
+        mov  L39[6], r4
+.entry D17
+D233:   .data -6050, 7285, K0, -191, K8, K17, K1, -1190
+D234:   .data 2399, 3156, 7094, -6078, -7203, 7932, 3454, 2447
+D235:   .data 5903, 1629, -1989
+        not  L6[9]
+D236:   .data 3888
+        add  D17[8], r3
+        jmp  L14
+        sub  r6, D150[0]
+        rts
+L337: .data 1, K0, L99
+        lea  L149, r3
+        inc  D149
+L159:   rts
+        dec  D83[K19]
+L160:   cmp  r1, D27
+        rts
+.define K47 = 38
+L261: mov r1, r2
+D237:   .data 7353
+        hlt
+L161:   cmp  #1237, #1942
+        lea  D31, D166
+D238:   .string "m"
+        inc  D27
+D239:   .string "cmnesswqmsmcwejp"
+L162:   red  r5
+.define K48 = 14
+D484: mov r1, r2
+L163:   prn  #K35
+L164:   hlt
+        red  L67
+D240:   .data 3494, 7159, -2445, 2261, 3890
+L165:   rts
+        not  D123[K44]
+        hlt
+L166:   jsr  r2
+D241:   .data -3447, -1906, -1978
+        mov  #361, X10
+        not  D197
+        cmp  #1311, L98[K17]
+Q: .data UNDEF, 5
+        not  r4
+        clr  D25[K7]
+        jmp  D68
+; generated comment line
+L167:   jsr  D84
+D242:   .data -1529, K29, K40, 1729, -3235
+        dec  D201
+L168:   dec  D131[K20]
+        m0
+        bne  D209
+D243: .data 1, K0, D166
+D244:   .string "lmyvzyefhwnztcjkdbmazzh"
+        jmp  r3
+        cmp  D57[K43], r5
+        mov  D128, r2
+        cmp  D156,, r5
+L169:   inc  L152
+        prn  r1
+BAD: jmp #3
+        m3
+        cmp  #-1312, D149[3]
+.define L184 = 3
+        bne  L18
+        prn  L47[K19]
+.define K49 = 11
+
+        lea  L129, D26[8]
+        dec  D191
+; generated comment line
+D245:   .data -7611, -3540, K13, -2265, 2085                                                           xx yy
+D246:   .string "uuobxvhpbixqhcbabzensrc"
+; generated comment line
+L170:   clr  D103
+L6095 : hlt
+
+        lea  L132[10], r0
+.entry L18
+
+        jmp  r5
+D247:   .data K7, -3587, -1409, 5124, 7118, -1266
+        lea  L7[1], D113
+.entry D18
+        rts
+D248:   .data 1403, 2465, K37, -7922
+.extern L206
+L172:   prn  #-1386
+.entry L19
+L173:   sub  #767, L39
+        add  L138[K43], r1
+L174:   rts
+        sub  #818, r5
+
+L175:   prn  L7[K26]
+        m5                xx yy
+D249:   .data -868, -7254, -5717, 6426, K46, 2130
+        rts
+        jmp  r0
+L176:   mov  r5, r7
+        not  L71[15]
+        hlt
+        red  D19
+L177:   cmp  D143[15], D5
+        mov  r4, r7
+
+D197: .data 1, K0, D95
+L178:   add  #-1844, r7
+        dec  D131
+L179:   not  D31
+        inc  D218[K37]
+        cmp  #-1565, D192[K41]
+; generated comment line
+; generated comment line
+D250:   .string "ywnmxoqtfdkeiqpxsgdogkqj"
+L180:   mov  D28[0], r0
+        lea  D124, L60[K31]
+D251:   .data K16
+D356: mov r1, r2
+        bne  L21
+D252:   .data -2662, 161
+
+L181:   add  r5, r0
+        jsr  r3
+
+        red  L121
+        prn  #216
+        add  L123, D245[K45]
+D253:   .data 5283, 3624, K18, 2092, K9, 1089, -7910, -3039
+D254:   .data -7235, -6335, 4260, 61, K34
+        prn  r1
+; generated comment line
+        dec  L0[0]
+L181: mov r1, r2
+; generated comment line
+        bne  r1
+        jsr  D5
+        lea  L145[K36], D144
+D255:   .data -473, K45, -5265, 1953
+L183:   red  L17
+        mov  X1, D195
+.entry D19
+; generated comment line
+D256:   .string "fadrobepgtmpduvuqzwsjmk"
+.define D85 = 3
+        sub  #-315, L95
+        bne  D246
+        clr  D42[K2]
+        m4
+        mov  D80, L109[1]
+        bne  r1
+D257:   .data -927, 4788, 6757, -6044, 3307, -414, -1603, K41
+D258:   .string "jsumirnwuo"
+
+        add  #-897, D208
+        jmp  r6
+        mov  D12[K49], L58[K44]
+; generated comment line
+.define K50 = 8
+        dec  r5
+D259:   .data 448, K16, K23
+D260:   .string "t"
+L184:   rts
+        jsr  r3
+        add  L99[1], r3
+D261:   .data -4102, -927, -592, -6038, K34, -1137, 1802, 5836
+        m1
+.entry L20
+        rts
+        clr  L178[K7]
+D262:   .data -4906, K31, 3838, 688, K17, -6343
+        jsr  L87
+; generated comment line
+        mov  L74, r2
+D263:   .string "x"
+D264:   .data K11
+        bne  r1
+        bne  L31
+D148: .data 1, K0, D494
+D265:   .data 4205, K41, -6592, 4240, 3589, -2330, -4474
+        mov  r4, L113[7]
+        add  L137[K5], r2
+D266:   .data 2803, K34, K27, K18, -4559
+        jmp  L93
+D267:   .data -3480, -6658, 4931, K32, -3645, -4431
+D268:   .data -2041, -1834, -7587, -7423, -2076, -4670
+        m5
+.entry D20
+L185:   lea  L35[15], L113
+        cmp  r2, D60
+; generated comment line
+L210: .data 1, K0, L106
+        inc  L41[14]
+        clr  L23[K44]
+.define K51 = 8
+L186:   bne  r6
+D83: .string "abc"
+        bne  D152
+D270:   .data K4, -3047, 2773, 52, K33
+         xx yy
+D470: .data 1, K0, L224
+        sub  D72, r1
+        clr  D212
+        red  L147
+        not  L60
+        cmp  #-696, #K17
+D271:   .data -395
+        jmp  r2
+        jmp  r1
+D272:   .string "lktddjacfknotdvp"
+        m2
+D273:   .data 6524, 2025, 3377, -2757
+; generated comment line
+        sub  r0, r2
+        red  L175
+L187:   red  D145[K28]
+
+D274:   .data -1345
+D324: mov r1, r2
+        red  D60
+D275:   .data -6255, K34, 658, 3700, -5352, -4724, K18, K36
+.define K52 = 64
+; generated comment line
+.entry L21
+D276:   .string "kyhlgkop"
+L188:   bne  D193
+        clr  r5
+        m3
+D277:   .data 185, K12, -5984
+; generated comment line
+L189:   red  L128
+        jmp  D183
+.define K53 = 9
+        m4
+D278:   .data K6, K50, 2211, 1080
+L190:   prn  D124
+D279:   .data 788, K46, -948, K27
+        sub  #1006, r0
+        prn  D232
+D280:   .data -4984, -7554, -4530, 3734, 1519
+        dec  L24
+D281:   .data -2828
+        jsr  r7
+        prn  D124
+L124: .string "abc"
+.entry D21
+L191:   dec  r6
+        mov  D37[K12], D226[K9]
+        jsr  r6
+L192:   prn  r3
+; generated comment line
+        jmp  D53
+D283:   .string "cvpndundtxs"
+D284:   .data -2588
+        rts
+        prn  X7
+L193:   hlt
+        inc  L83
+BAD: jmp #3
+; generated comment line
+; generated comment line
+        jsr  r4
+; generated comment line
+        red  r2
+        clr  D186[K51]
+; generated comment line
+        rts                                                                       xx yy
+L194:   bne  L16
+        mov  r2, D112[K25]
+D285:   .data -7561, 6188, -3122, 7706, -2315, 84, 7062, -4761
+L195:   hlt
+.define D39 = 3
+Q: .data UNDEF, 5
+D286:   .data -2792, 4712, -5662, -5926, -2245, 3311
+        clr  r5
+BAD: jmp #3
+D287:   .data -3877, K14, 4763
+        hlt
+        add  #-1810, L31
+L197:   cmp  r6, r1
+        inc  L137[15]
+D288:   .data K13
+.entry L22
+        m2
+        hlt
+
+        red  D172
+        jsr  r1
+        inc  L145
+        rts
+        mov  D20[K49], D89[7]
+        prn  D47[K27]
+        sub  D37, D100[K23]
+; generated comment line
+        mov  #1806, L170
+        jsr  D132
+        clr  r4
+        prn  #K23
+        prn  r7
+L198:   sub  r0, L107
+        hlt
+.define L185 = 3
+BAD: jmp #3
+; generated comment line
+; generated comment line
+; generated comment line
+        cmp  D39[1], L40
+L199:   dec  r7
+D290:   .data -2340, -1623, 7478
+        add  D107[K39],, D226[9]
+        m2
+        rts
+        clr  r5
+; generated comment line
+D291:   .data K49, 1677, 6358, 5797, -6589
+L215: mov r1, r2
+        m7
+        rts
+        clr  L72
+        bne  r3
+BAD: jmp #3
+        lea  D90, L103[K37]
+D349: .data 1, K0, D157
+D295:   .data 6793
+        clr  L29
+D86: mov r1, r2
+        cmp  L65, r3
+D296:   .string "mwebaljwccdxilv"
+        red  L151[13]
+D297:   .data 3862, 917, K32, 2228, K16
+        sub  r7, r3
+        bne  L169
+        mov  D127, D229[10]
+        dec  r4
+        mov  r7, D115[K30]
+L9910 : hlt
+D298:   .string "itjbdaqir"
+; generated comment line
+; generated comment line                                                               xx yy
+D299:   .data 1053, 2628, K46, -2881, 2941
+        add  r3, L13[13]
+D483: .data 1, K0, D455
+        mov  r1, r0
+L200:   red  L30[7]
+D300:   .string "gnquvystzmnmrbcksbdpb"                         xx yy
+        jmp  D95
+L201:   clr  D53
+D301:   .string "khimwjwmipmjhl"
+        jmp  r7
+.extern D389
+
+        prn  r7
+L58: mov r1, r2
+D302:   .string "abzqeugpngqyidessmnjv"
+L251 : hlt
+D303:   .string "ymwcqmyooohpnsn"
+; generated comment line
+        sub  #-268, r2
+L251: mov r1, r2
+L202:   lea  L179[K4], D113
+; generated comment line
+        lea  L56, D140[13]
+        cmp  r3,, r4
+        not  L31
+
+        hlt
+
+        dec  r7
+D304:   .string "quatkpaokfpeeywuejjt"
+L203:   prn  #K16
+.define K55 = 25
+L259: .data 1, K0, L233
+D310: .data 1, K0, D86
+D305:   .data -6694, -392
+; generated comment line
+D306:   .data K41, -428, K53, K35
+; generated comment line
+D307:   .data 2688, 8, -2161, 4972
+        add  #893, D179[K35]
+        prn  r0
+D154: mov r1, r2
+        rts
+L204:   prn  D114
+.define L208 = 3
+        add  r3, L148[K35]
+        sub  r3, L140[5]
+        clr  L127[7]
+        rts
+        mov  r5, D8[K0]
+D309:   .data 3669, -6999
+L205:   red  L120[K13]
+D310:   .string "ihjeclpbefzvnbkhrgot"
+        inc  r6
+L206:   cmp  #-729, #-504
+        rts
+Q: .data UNDEF, 5
+D311:   .data K3
+.extern L333
+D387: .string "abc"
+BAD: jmp #3
+; generated comment line
+        rts
+        red  L7
+.define D505 = 3
+        hlt
+        dec  D207[13]
+; generated comment line
+D161: .data 1, K0, D133
+        lea  L83, D299
+; generated comment line
+Q: .data UNDEF, 5
+
+L208:   not  D187[4]
+BAD: jmp #3
+        hlt
+D312:   .data 5859, 6422, -2630, -1188, -5243, -4837, -5185, K5
+        lea  L12, r3
+        inc  D48[K27]
+D313:   .data -4651, 4290
+        bne  r5
+        bne  D208
+D314:   .data -2989
+        lea  D118, r1
+L209:   not  L131
+        bne  L85
+        not  D182[K39]
+D24: .data 1, K0, L32
+.entry D23
+; generated comment line
+        mov  X2, r1
+.define K57 = 57
+        m4
+        dec  D212
+D315:   .string "qtldscj"
+        add  D29, r5
+.define K58 = 51
+; generated comment line
+        add  r7, r4
+        not  L205
+L210:   lea  L168[K34], L10
+BAD: jmp #3
+L300: mov r1, r2
+D317:   .data 3889
+Q: .data UNDEF, 5
+D380: mov r1, r2
+L211:   red  L111
+        not  D136[5]
+        dec  L125
+
+
+        m4
+L212:   lea  L150[10], D113[K59]
+        dec  D248[K5]
+        prn  #K32
+        add  r5, L35
+D318:   .data -3520, -7018, -6117, K30, 4891, 2249
+        red  L95[5]
+BAD: jmp #3
+        m2
+L257: mov r1, r2
+L4003 : hlt
+        sub  L59, r7
+        dec  r2
+L213:   inc  D135
+.define K60 = 43
+        hlt
+D319:   .string "bgivklcl"
+L214:   add  D278[K40], D310[14]
+        lea  D121[3], D44[K33]
+        cmp  #1617, D9[K31]
+        rts
+.entry L24
+Q: .data UNDEF, 5
+D320:   .data 407, K22, 1953, 831, 3309, K44
+D259: mov r1, r2
+        jmp  r7
+        add  D164, L83[K12]
+; generated comment line
+        sub  #1696, D140[K50]
+        cmp  D251, D161
+
+L7061 : hlt
+        add  #-796, D4
+        m1
+D160: mov r1, r2
+L216:   jmp  r3
+        m7
+BAD: jmp #3
+
+        m3
+        cmp  #1545, L141[2]
+        red  r1
+        jmp  D295
+D321:   .data 7670, K4, -5572, -2824, -5453
+        clr  L163[9]
+D238: .string "abc"
+D322:   .data 3704, K1, 7479, 7001, -1520
+        hlt
+        mov  L85[K58], D296
+; generated comment line
+        clr  r2
+D323:   .data 7398, -6376
+D324:   .data -365
+D325:   .data -2211, 6416, 615, K44, 2384
+D305: mov r1, r2
+L217:   red  r3
+D326:   .data K27, -349, K14, K15, K23                                        xx yy
+        not  L175[K20]
+L218:   prn  r1
+L340: mov r1, r2
+; generated comment line
+; generated comment line
+        inc  r7
+D327:   .string "vgwnavp"
+        mov  #-944, r3
+.define K61 = 24
+        hlt
+; generated comment line
+.extern L227
+        dec  r6
+.entry D24
+D328:   .data -909
+D22: .data 1, K0, D88
+        jsr  r2
+        dec  D92[K40]
+        dec  D124
+        bne  D296
+        rts
+; generated comment line
+L220:   sub  D223, D165[K21]
+        bne  L192
+        sub  #-1003, D188[K6]
+        bne  L186
+
+L221:   red  r7
+D330:   .string "duaynyofgdfiaxrnsbdtndoj"
+D331:   .string "xazyp"
+        mov  #1920, L131
+D332:   .data -5638, 2006, K58, 3570, 827, -3948, 5661
+        mov  D249[15], D197[10]
+        lea  L159, L23[11]
+        bne  r7
+        red  L60[K20]
+        jmp  r5
+        jmp  D237
+        add  L151, L90
+D333:   .data -5362, 6996, 3151, 7776, -6266, -199, K10, 7641
+        prn  L67[K3]
+D334:   .data -6126, -5994, -3304, -3679, 6551, 7579, K8, K27
+        hlt
+
+        clr  D66[10]
+        clr  D32
+        dec  D18
+L222:   lea  D29, D167[6]
+        m2
+        m2
+D335:   .string "xioqedhrjal"
+
+L223:   bne  L117
+; generated comment line
+D336:   .data -4100, 3586, 2767
+D326: .string "abc"
+        prn  D254[K40]
+D337:   .data -4892
+        add  D68, D253[K42]
+L225:   inc  D71
+D338:   .data 2251, -3282, -4171
+
+        mov  r6, r3
+L301: .string "abc"
+        add  D290, r1
+L226:   mov  X2, D260
+L227:   bne  D101
+        rts
+D339:   .data K29, -4825, K61, 3977, K26
+        not  L71[K32]
+        red  D30
+D340:   .string "klkncujhjqescfhwgjoesob"
+; generated comment line
+D341:   .data 6216, K46, 946, -6693, -6456, -1647, -4346, -6122
+D342:   .data K52, -1618, K51, -7320, 7784
+D343:   .data -4219
+        jsr  D25
+        jsr  D325
+        jsr  r5
+D344:   .data 1847
+D345:   .data 7985, 6517, -5768
+; generated comment line
+D228: .data 1, K0, D289
+D346:   .data 7813, 2705, 173, -3913                                                           xx yy
+L228:   bne  D198
+L229:   inc  r4
+        lea  D344[K59], r7
+        cmp  #368, L14[3]
+D182: .data 1, K0, D76
+BAD: jmp #3
+D347:   .data -7052, -3144, K41, 3002, -7757
+D348:   .data 6941, 7447, 2664
+L231:   jsr  r1
+D178: mov r1, r2
+; generated comment line           xx yy
+; generated comment line
+L232:   jsr  r7
+        mov  L65[5], r2
+        rts
+        dec  L119[0]
+; generated comment line
+D349:   .data 155, 4988, 1828, 5701
+        add  #1133, D145[K19]
+D350:   .data K25, -2269, 1482, K29, -5938
+L233:   jsr  D69
+        hlt
+D310: .data 1, K0, L44
+; generated comment line
+        clr  L57
+        inc  D111[K27]
+        cmp  L91[14], #1085
+Q: .data UNDEF, 5
+L9723 : hlt
+        mov  #1225, L66
+
+
+
+.entry D25
+        clr  D209[K20]
+D351:   .string "eeysc"
+
+        clr  r4
+        red  D60
+.extern L195
+D353:   .data -976
+        hlt
+D354:   .data 1789, K9, 1572, -3041, 7915, K39, 1951
+        prn  L226[K38]
+L5281 : hlt
+        rts
+        hlt
+L234:   mov  r4, L198
+        rts
+D82: .data 1, K0, D93
+        dec  D170[K38]
+        cmp  #1988, r4
+        jsr  D228
+
+D355:   .string "olmrmleexsrvwvnuhpac"
+        mov  #-414, L230[14]
+.define K63 = 40
+D356:   .data 3448, 1748, -6161, K59, K5, K22
+        mov  L78, D220
+L2: .data 1, K0, L156
+L235:   lea  D43, L60[K4]
+D357:   .data 1086, K19, 4428
+D343: mov r1, r2
+        hlt
+D358:   .data 962, -1304, -4163, -6760, -7331, -2469, 4142, 3869
+        jmp  r1
+        prn  #-120
+        add  D33, D12
+D359:   .data -4179, 3227, K16, -3315
+.extern L66
+        not  r5
+        m7
+D360:   .data 7753, -6314, K1, -5480, -6256
+        add  r2, r6
+.entry D26
+D361:   .data 7274, -7967, K3, -403
+D362:   .data -1368, 7371, 3750, 771, 2651                                                         xx yy
+        m6
+        sub  #829, r7
+        cmp  D131, D90[13]
+        m0
+        sub  D271, r1
+D363:   .data -3435, 1702, -6178, -3372, -6484, 885, -6005, 1268
+; generated comment line
+D364:   .string "gjlqrefto"
+L236:   sub  r4, L228[K1]
+        red  r6
+D365:   .data K51, 357, 4186, -1516
+        not  L226[K3]
+D366:   .string "tfxlfaqxcbzflh"                                                  xx yy
+        not  r5
+
+        add  #315, r5
+; generated comment line
+.define K64 = 19
+L237:   jsr  r6
+BAD: jmp #3
+.define K65 = 4
+        lea  D221[12], r1
+        add  D234[1], D109
+        bne  r0
+        dec  D339[K0]
+        hlt
+.define K66 = 40
+        rts
+        jsr  r3
+D367:   .data 2467, 6202, 1317, -2463
+L238:   clr  X1
+        bne  D319
+D368:   .data K8, -1527, -5090, -1298
+        clr  D305[K32]
+        lea  D107, D298
+        red  L145[K56]
+        prn  r6
+        add  D59[0], r0
+        dec  L145
+        m1
+D369:   .data 3786, -557, 1585, -2852, -5463, -6356, -5104, 2943
+        sub  #82, r6
+.define K67 = 23
+        lea  D61, D355
+D370:   .string "retqokaqqyguzrcdwguskb"
+        m7
+D200: .data 1, K0, D55
+        m6
+        rts
+        cmp  r7, #K53
+L239:   jsr  r1
+L240:   add  L224, r6
+D371:   .string "yfpznrtbhxlt"
+        m0
+        jmp  D64
+BAD: jmp #3
+
+        rts
+        clr  L86
+.entry L27
+L855 : hlt
+L6637 : hlt
+; generated comment line
+D372:   .data 2694, 2911, -3206, -4814, -370, 4385
+L350: mov r1, r2
+L297: mov r1, r2
+L243:   rts
+D373:   .data 5007, K56, -5223, -6665, -4507, K42
+        cmp  r2, D219
+L244:   not  D285
+D374:   .data -4870, 2754, 2043, K37, K18
+        clr  r0
+L4374 : hlt
+        m2
+        sub  D196, D257
+.define K68 = 62
+        sub  L220, L169[0]
+D375:   .string "xakuzsisz"
+.define K69 = 22
+
+        clr  L13[8]
+        red  r0
+        mov  L241[K62], r3
+        cmp  D112, #K41
+D376:   .data K24, -452, 7730, K30, K59, 2525, -4070, -2440
+        cmp  L142[K22], #K15
+BAD: jmp #3
+        not  D144
+L245:   hlt
+D235: .data 1, K0, D97
+L246:   prn  D197[10]
+        jmp  r0
+
+L247:   red  L130[15]
+; generated comment line
+L248:   bne  r5
+L249:   bne  L94
+L250:   prn  L108
+D378:   .string "khspoikvloc"
+        not  D104
+D379:   .string "yquqnwlkl"
+        prn  r0
+        m5
+        rts
+D380:   .string "vuphsrnswrmvcmltnogiwxhq"
+        not  D112
+.define L131 = 3
+        jsr  L49
+        dec  D128
+        hlt
+D178: .string "abc"
+        jsr  r6
+L252:   prn  r3
+        not  r1
+        jmp  r7
+D381:   .data 741, 4068, -5861, -6417
+.entry L28
+        mov  D87[12], L83[2]
+D382:   .data -4013, 1855, -2535, -153, K66, -3175, K18, -5182
+D383:   .data 2221, -7145, K63, -171, 7681, K35, 3564
+.define L306 = 3
+        red  r2
+        clr  L17
+D384:   .data -1454, 7534, K28, 6794, -4717, -4564, 1781
+        dec  D258[2]
+D385:   .string "lfrocofk"
+L253:   not  D179
+
+        jmp  r7
+        prn  #K35
+        jsr  r0
+; generated comment line
+        m3
+        add  #1797, D151[K43]
+        rts
+D386:   .string "ulambtenondoauzttzi"
+
+        sub  D75[9], D196[K57]
+        sub  #105, r4
+        inc  D156
+        m5
+        add  D310, L34[13]
+D512: .data 1, K0, L47
+        mov  D30, D153[K54]
+        rts
+D387:   .data 3413, -2916, K4
+        dec  D215
+        rts
+.define K70 = 6
+
+        prn  L52[K13]
+        bne  r7
+L254:   sub  L232, D204[K42]
+
+L255:   dec  r4
+D388:   .string "qjwjkoxrpgaruxvsvjvnutlp"
+L54: .data 1, K0, L109
+        mov  r0, D193[6]
+L257:   jmp  D222
+; generated comment line
+BAD: jmp #3
+        dec  r2
+D389:   .string "xyyqaugvnjdvauqwui"
+        m7
+L28: mov r1, r2
+L168: .string "abc"
+        bne  r2
+        clr  r2
+D391:   .data -7684, -3025, K6, K45
+        clr  D112
+L277: mov r1, r2
+        jmp  r6
+        mov  #-811, D280[K69]
+D392:   .string "kwsayjeydhsgnlcnztwruj"
+        clr  L92
+        sub  r1, r2
+        mov  r2, r6
+        prn  L87[K29]
+        jmp  r5
+        jsr  D145
+L258:   dec  D106
+        rts
+        sub  L60[K35],, D356
+        mov  D320, D370[10]
+        dec  r4
+
+D393:   .string "bbqnnjyemzqtv"
+D394:   .string "zttjmcify"
+
+        prn  D128
+        hlt
+L259:   dec  r2
+D395:   .data -5907, 7931, 4198, 742, -496, 1976
+D396:   .data -2560
+        rts
+D247: .data 1, K0, L226
+D397:   .data K45, -6458, 1884
+D163: mov r1, r2
+        add  r1, D386
+L260:   dec  L193[K29]
+        m5
+; generated comment line
+        inc  r0
+        jsr  r7
+        jmp  r7
+L261:   not  D5
+.define K71 = 52
+        inc  D360[12]
+        rts
+L262:   red  r4
+        inc  D240
+; generated comment line
+        prn  D343
+D398:   .data K3, 6381, K42, -3026, -6672
+        dec  L156[K65]
+.define D418 = 3
+L263:   sub  D306, L40
+        bne  D356
+L264:   dec  L21
+        prn  D260
+L2: .data 1, K0, D333
+        clr  D3
+        jsr  L38
+        mov  r4, L38[4]
+
+        mov  r7, r2
+        bne  L108
+.extern D372
+Q: .data UNDEF, 5
+        not  r2
+.extern L57
+        dec  D267[3]
+        not  D133
+D399:   .data -261, -4304
+        hlt
+        add  #1251, D268[7]
+L2933 : hlt
+D401:   .data 4401
+L120: .data 1, K0, D203
+D402:   .data -980, K30, -6022, -5616, K22
+        sub  #1435, D381
+        sub  #-373, L228
+D442: mov r1, r2
+L266:   red  L187
+        mov  L97, r7
+        m1
+        rts
+D73: .data 1, K0, L125
+        sub  L43, L188[K26]
+; generated comment line
+L267:   prn  D248
+.define K72 = 48
+        rts
+        cmp  #-297, #1368
+        rts
+        add  D197[K59], r6
+        mov  #1837, r3
+        rts
+        hlt
+        red  L153[0]
+        sub  D75, D382[3]
+Q: .data UNDEF, 5
+D404:   .data 1524, -4274, 1062, -281, -2565
+        m4
+L268:   jsr  L184
+D405:   .data -3416, -4285, -5132
+
+; generated comment line
+; generated comment line
+        jmp  r0
+        not  L110
+        m3
+D406:   .data -3595, 4491, -209, K61, K26
+
+        red  D148[1]
+        rts
+        jmp  r1
+        jmp  r4
+        m5
+                                                                                   xx yy
+        bne  r4
+D407:   .string "rbckoadza"
+        hlt
+        bne  r5
+        m4
+; generated comment line
+        sub  #1862, D340
+        rts
+        lea  D299[2], r3
+L269:   cmp  r0, D202
+        not  D120[3]
+        m6
+D408:   .data -3815, -6212, K31, -1477, 3346
+D409:   .string "zcfphchrwq"
+D410:   .data K33, -305, -4109, K48, 4257
+        lea  L244[10], r3
+        not  D248[K53]
+
+.extern L249
+; generated comment line
+D411:   .data -329, 626, -7574, K50
+; generated comment line
+D412:   .data -6966
+D413:   .string "tkxelefokrwzvinjitlwqba"
+        hlt
+; generated comment line
+        rts
+D414:   .string "qtquqchlsbwnsukmj"
+        m7
+L71: .data 1, K0, L231
+        prn  #K45
+        m4
+L271:   cmp  #-1374, #K60
+        hlt
+D391: .string "abc"
+L272:   jsr  r0
+D415:   .string "jiefbzpwwttdhknhfx"
+        bne  r6
+        dec  L48[K55]
+D53: .data 1, K0, L95
+        jmp  L263
+        not  D160
+        bne  r3
+        add  L121[K37], r3
+; generated comment line
+        add  L264[K12], L170[14]
+        lea  X5, r1
+        inc  r2
+L9380 : hlt
+D417:   .string "dflquwpqvpvehanbja"
+        red  r1
+        rts
+.define D322 = 3
+        cmp  r5, D64[4]
+L275:   inc  L136
+        dec  L72[K38]
+D418:   .data 4258, 920
+; generated comment line
+        red  r7
+; generated comment line
+D419:   .string "ivvlvmydklefrlxohecojy"
+        rts
+D420:   .string "tppr"
+D240: .data 1, K0, D145
+L276:   sub  #-568, L96[8]
+        dec  r7
+; generated comment line
+L277:   sub  D0[10], r4
+D422:   .data -7133
+        clr  L91
+        jsr  X12
+        not  D123[K20]
+D423:   .data -7547, K61, -2154, -7069, -5784, K16, 2246
+        jsr  D161
+.define D45 = 3
+; generated comment line
+D520: mov r1, r2
+        cmp  #773, #1401
+D90: mov r1, r2
+        lea  L259[K48], L63
+        inc  r4
+; generated comment line
+        sub  #449, L86
+        not  L261[K15]
+        prn  r1
+D424:   .string "iusc"
+        not  L200[K30]
+        mov  D117, D272
+        mov  #1216, L139[3]
+        not  r5
+L279:   prn  D278[6]
+Q: .data UNDEF, 5
+D425:   .data K42, 7304
+D426:   .data -2651, -2899, 6157, K8, K37, -4674
+D427:   .data K56, -6359, 4607, 1278, 754
+L280:   mov  D263, D398
+        jmp  L264
+L281:   inc  r2
+        jsr  r4
+        inc  D300
+D428:   .data 4906,, 2628, -7495, K65
+        m1
+        m7
+D429:   .string "jqegxkmdkhzmonjl"
+        m1
+        dec  r1
+; generated comment line
+L282:   mov  D372[13], r5
+Q: .data UNDEF, 5
+D430:   .data K24, K65, 3370, -890, K58
+; generated comment line
+        not  r5
+        mov  D387, r4
+L283:   hlt
+L284:   lea  D1[K11], r2
+D431:   .data 230, -7897, -7807, 6671, 1946, K31, K9, -2077
+L285:   clr  D57
+D47: .data 1, K0, D481
+L286:   dec  D333[14]
+L916 : hlt
+D432:   .data 4387, K32, -2205
+        inc  r0
+        inc  L257
+        jmp  r1
+D433:   .data 4102, -3704, 7825
+D55: .string "abc"
+        prn  #1816
+.define D351 = 3
+        jmp  D420
+L316: mov r1, r2
+; generated comment line
+        lea  D344[15], L210
+L287:   add  L74[K47], D126[K70]
+        red  L115[K13]
+        bne  L36
+        not  L12[K50]
+L288:   not  D365
+.define K73 = 46
+.entry D29
+        rts
+; generated comment line
+L289:   mov  r2, L229
+        add  #756, D89
+        inc  L141
+.extern D422
+L290:   add  D117[14], r2
+D435:   .data 7559
+L291:   bne  L221
+D436:   .string "eohfbtnycuaim"
+; generated comment line
+D437:   .data -4871, K28
+.entry L30
+        not  r4
+        clr  D416
+        red  D46[2]
+        red  r5
+        bne  r1
+D438:   .data K54, K4, 929, 189, 7959, -4296, K14, -2654
+.define K74 = 44
+L292:   sub  #228, L170[K67]
+        dec  D43
+        mov  D303, D37[K51]
+        jmp  r4
+        inc  L30[5]
+        jmp  r3
+        cmp  D346[K24], r5
+L293:   mov  D414, r2
+        cmp  D289, r5
+        inc  L252
+        prn  r1
+; generated comment line
+        red  L165[2]
+        jmp  L124
+L294:   red  L260[K5]
+.define K75 = 61
+D439:   .data 2212, -1944, K9, 2026, 5219
+        m2
+.extern L137
+        bne  D240
+L295:   add  D244, r4
+L264: .string "abc"
+        clr  L43                     xx yy
+        prn  L5
+L296:   add  D249, r5
+        m6
+L19: .data 1, K0, L189
+D441:   .string "xqjr"
+        mov  r7, L207[K33]
+        rts
+D442:   .string "qewlsrvzlpzhdruo"
+        sub  L35, r7
+L298:   hlt
+        not  D135
+L299:   sub  #1791, L175
+D443:   .string "qeriowyjvjx"
+        dec  D161[K22]
+D444:   .data K34, K54, K24
+D445:   .string "hxdwnxmrykzncwcvc"
+        rts
+L300:   jmp  r0
+L301:   mov  D323[K61], D69
+.define L192 = 3
+
+L302:   hlt
+        prn  L287[K66]
+BAD: jmp #3
+        prn  L33
+.define K76 = 25
+D446:   .string "fzrqbockd"
+        m0
+; generated comment line
+; generated comment line
+D447:   .string "mocxdnfrsas"
+        jsr  L193
+        mov  D58, D418                                                                              xx yy
+
+        prn  r3
+        prn  #-1288
+D102: .data 1, K0, L43
+        clr  r0
+
+L26: .data 1, K0, L349
+D448:   .data K58,, K44, 4017
+        jmp  D212
+        m2
+        lea  L7, D241[14]
+L303:   cmp  L253[K15], r2
+L202: .data 1, K0, D310
+        m3
+D450:   .data -5299, -5589, K76, 3201, -1092, 44, K66
+D108: .string "abc"
+        jsr  r3
+        jsr  L134
+D451:   .data -6271, -1397, K30
+L131: .data 1, K0, D504
+L304:   prn  r4
+        lea  D41[K68], r1
+D453:   .string "mkj"
+L305:   red  D225
+        jsr  D247
+.define L100 = 3
+        inc  D21
+BAD: jmp #3
+.entry L31
+D454:   .data 4611
+L306:   cmp  L274, D411
+L307:   sub  #1689, D45
+        m3
+D455:   .string "iohmwnvazkll"
+        clr  r1
+D456:   .string "vdgdnrnimns"
+L308:   jsr  r3
+        dec  L38[K32]
+; generated comment line
+D457:   .data -4175, 3103, 2741, 2316, 5274, 785
+        bne  r3
+        jsr  L150
+        not  L159[11]
+.extern L210
+
+BAD: jmp #3
+.entry D31
+        prn  L177[13]
+
+        lea  D352, D90
+        mov  r3, D94[K10]
+D430: mov r1, r2
+        m7
+L309:   not  r7
+BAD: jmp #3
+L5773 : hlt
+D459:   .data 4750, K40, 715, K37, -1918, -5709, 5391
+        rts
+.entry L32
+        bne  r1
+
+        prn  r7
+L291: .data 1, K0, L10
+        red  D394[2]
+        prn  L114
+L310:   bne  L142
+        hlt
+Q: .data UNDEF, 5
+        cmp  D278, L168[K31]
+        rts
+D461:   .data -4711, -612, 6144, -6929, -6544
+        lea  D205[K9], D395[6]
+        rts
+        not  D226
+D462:   .data K0, K53, 3338
+        not  r4
+D463:   .string "ejsyp"
+D464:   .string "flwbzjwlcnpmerzddegzz"
+        hlt
+; generated comment line
+D425: mov r1, r2
+        inc  r1
+        jmp  r3
+        lea  D118[8], L178
+; generated comment line
+        inc  D178[10]
+        lea  D210[K26], D373
+
+        m6
+L312:   dec  r4
+D465:   .string "etqmfrgjtfiwmzezxwcaddp"
+
+        not  D34
+.define K77 = 30
+L234: mov r1, r2
+        clr  X6
+        clr  L302[10]
+D16: .data 1, K0, L94
+; generated comment line
+L268: .data 1, K0, L97
+D425: .data 1, K0, D469
+D466:   .string "j"
+L313:   clr  r1
+        add  r1, r4
+D467:   .data K69, -2662, -5771, -3687, K6, -4272, -2846                                                            xx yy
+; generated comment line
+        clr  r6
+.define D147 = 3
+D469:   .data 6861, 6035, K28, -1704, 6271, -6693, 4280, -4551
+D210: .string "abc"
+        m6
+Q: .data UNDEF, 5
+        dec  L253[4]
+L315:   rts
+        rts
+L316:   mov  D9, D381[6]
+        red  r0
+L317:   rts
+
+.define K78 = 15
+
+D471:   .data K56, K60, 3271, -3686, -2023, K15
+        red  D332[5]
+D472:   .string "pyqbmosh"
+        cmp  #1640, D337[11]
+        sub  #754, X15
+        m2
+        rts
+D473:   .data K61, 812, K16, -543, -6125
+D474:   .string "ymihazajm"
+        hlt
+L318:   jsr  L48
+D475:   .data 4168, -4505, K24, -2760, K39, K60, K64, 3031
+        rts
+        rts
+
+L319:   mov  L155, D268[12]
+        clr  D18[11]
+L320:   mov  L96[K67], L174
+        bne  X10
+        dec  D306[K9]
+        red  L58[K20]
+        inc  D399[K7]
+D242: mov r1, r2
+D476:   .data K28, K71, -956, -4781, 3838, K73, -4132, -4675
+; generated comment line
+D477:   .string "bdtpeikd"
+        add  D299[7], r1
+.extern L79
+L321:   prn  r0
+        clr  r2                                                                              xx yy
+.define L342 = 3
+L322:   dec  L102[K0]
+        lea  D150, r2
+D479:   .string "csgjwpdagojtrbeeol"
+        sub  r5, D427
+        inc  D103[2]
+        lea  L322[K45], L255[13]
+
+D480:   .data -1073, -3683, K6, K78
+
+        hlt
+        m3
+
+D481:   .data -2834
+        lea  D314[3], L169
+        jmp  r6
+D482:   .data 7040, -1207, -7297, 5315, K38, K12, K20
+L323:   hlt
+.define K79 = 50
+D396: .data 1, K0, L177
+D484:   .data 4041, K55, 1588, 487, -4796, -102, -5755
+L324:   add  r1, L234[K14]
+.define K80 = 17
+        clr  D294[K4]
+D485:   .string "meckkimmlftwnzkbygh"
+.entry D32
+
+        prn  #K46
+        prn  r7
+        sub  #972, D391[7]
+D486:   .data -106, -1823, 1405, 7441, -1455, -2339, 3614, K22
+.define K81 = 9
+        lea  L47[K2], D159[5]
+        lea  L174, r6
+        prn  D131
+        add  L41, L198
+D487:   .string "rutiryjeu"
+
+        prn  r4
+        jsr  r6
+        sub  X8, L207[10]
+        dec  D418[9]
+L325:   prn  D262[9]
+L326:   hlt
+        rts
+D488:   .data 6595, K55, 4747, -3673
+L327:   prn  #K48
+        hlt
+
+        m0
+        dec  r3
+L328:   sub  D86, r2
+D489:   .data -4644, -5387, 685, -7584, K35, 7875
+        jmp  r5
+        rts
+        cmp  D311, #K42
+; generated comment line
+        m3
+
+        add  L257[15], D314
+        cmp  r3, D363
+L137: .data 1, K0, D171
+D495: mov r1, r2
+L329:   red  r5
+.define L52 = 3
+        bne  r5
+        m0
+        cmp  D488, L120[0]
+D491:   .data -5, K44
+        sub  #1614, r1
+Q: .data UNDEF, 5
+        lea  D79[8], D100
+        lea  D118[8], D335[4]
+        prn  L35
+        rts
+        clr  L228[K51]
+L330:   cmp  #-152, r5
+.entry L33
+; generated comment line
+        inc  L223[6]
+L249: .string "abc"
+L332:   dec  D391
+L333:   jmp  L312
+        lea  D73, D132
+        m3
+.define K82 = 27
+D492:   .string "xyqmczyuightdryp"
+D493:   .string "fvwifcamsmwo"
+; generated comment line
+L334:   jsr  r2
+        red  D137[2]
+.define K83 = 50
+; generated comment line
+D494:   .string "lycjvqrchiczvlg"
+D495:   .string "fdilzvbgvtdwx"
+Q: .data UNDEF, 5
+D496:   .data -3548, 5622
+.define K84 = 12
+        mov  r4, D485[4]
+L336:   lea  D332[K52], L314
+D497:   .string "xrldjyoyy"
+        dec  D312
+.extern L310
+        red  L204[2]
+.define K85 = 25
+        sub  #324, D483
+        dec  r1
+; generated comment line
+        dec  L220[K7]
+D397: mov r1, r2
+D499:   .data -3460, -5240, 6945, -514, 6839, 2460, 4380
+        bne  L69
+D334: mov r1, r2
+L337:   add  r7, D212
+        mov  r5, D496
+D500:   .data 3071, 3761, -5744, -4313, 1371, K48, K52
+.extern D25
+        hlt
+D104: mov r1, r2
+D501:   .string "rhznimkpiizwfjombnvu"
+D226: .data 1, K0, L296
+        dec  L119[K37]
+        not  D400[8]
+D502:   .data 6658
+D503:   .data K26, -5178, 175
+        cmp  r0, L195
+D504:   .string "kkfllhmqyjsdfrodmrdbqsh"
+; generated comment line
+        rts
+        add  D244, D112
+.extern D258
+L98: mov r1, r2
+; generated comment line
+
+        inc  D66[4]
+D505:   .data 4836, 1054, 2827, -7157
+        hlt
+        clr  D181
+L340:   red  L234
+L341:   prn  D182
+        inc  r5
+; generated comment line
+.extern L8
+D506:   .data -1847, -3275, -5598
+D507:   .data 2461, -1828, -7005, -4774, -523
+        mov  D454[K69], r3
+        dec  L47[K68]
+D508:   .data 1195, K41, -6738, -4399, 1726, K53
+        prn  D371[K14]
+        sub  D314[K53], L292
+D509:   .string "wxuakswniub"
+        lea  D434[K35], L184
+L343:   add  L267, r5
+        jmp  r2
+        prn  #-1225
+D510:   .string "igbp"
+        lea  L50[10], r3
+D511:   .string "yfeomxbeygqy"
+Q: .data UNDEF, 5
+L344:   red  D484
+        add  #-1136, D230[K65]
+L345:   hlt
+        m1
+        add  D158[1], L79
+D513:   .data -1625
+
+
+        bne  r5
+        red  r4
+.entry D33
+        lea  L126[10], L329[K65]
+L154: .data 1, K0, L301
+L346:   red  L228
+L347:   jmp  L197
+L348:   clr  D107[0]
+        red  r6
+.define K86 = 42                                          xx yy
+L108 : hlt
+L349:   clr  r1
+        m2
+; generated comment line
+
+        rts
+L350:   hlt
+; generated comment line
+        cmp  L45[2], L257
+        inc  L154[13]
+; generated comment line
+D514:   .string "fhgpjcybulepbwgy"
+        jmp  L191
+.define K87 = 37
+        dec  D424
+L351:   inc  L202[K41]
+; generated comment line
+        prn  X9
+L276: mov r1, r2
+        mov  D243, r1
+; generated comment line
+        dec  D206[7]
+L352:   add  D101, r4
+        inc  r7
+D515:   .data K1, K82, -7004, K85
+L353:   jsr  D473
+
+D516:   .data -5561, -7410, K39, 2642                                                                  xx yy
+.define K88 = 12
+D517:   .string "juzyxfdngzeqo"
+L354:   bne  r6
+        sub  D312, r7
+D518:   .data -6601
+.define K89 = 38
+L8370 : hlt
+; generated comment line
+                                                                                   xx yy
+        jmp  D133
+; generated comment line
+        jmp  D262
+        rts
+D519:   .string "mugqrlltobyoxv"
+        jsr  D210
+D520:   .string "imyax"
+D521:   .data 1205, K63, -3258, 6675, -7400, K43, 3574
+        jsr  D179
+.entry L34
+
+L355:   bne  r7
+D452: mov r1, r2
+D522:   .data 793
+        inc  L11[3]
+        mov  D409, D507[K24]
+        red  r3
+D523:   .string "uhvvu"
+; generated comment line
+
+L356:   prn  #K75
+; generated comment line
+L91: .data 1, K0, D406
+L622 : hlt
+; generated comment line
+D524:   .data -3190, 7364, -7938, -2080, -6370, K53, K1
+        clr  D260
+D525:   .data 4447
+L357:   mov  #-158, L101
+D244: .data 1, K0, L322
+        not  L243
+L166: .data 1, K0, D473
+        jmp  D36
+END:    hlt
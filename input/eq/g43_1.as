@@ -0,0 +1,32 @@
+S0: .data 5
+ .fill 3, 7
+; comment
+ inc r2
+
+ .fill 3, 7
+ inc r2
+ clr r6
+ inc r1
+; comment
+ lea S0, r3
+L0: inc r1
+ inc r1
+; comment
+; comment
+
+mcr m0
+ red r7
+endmcr
+ sub r1, r2
+ m0
+ add #2, r4
+; comment
+L1: .data 1, 2
+ .string "ab"
+ m0
+ .string "ab"
+ sub r1, r2
+ add #2, r4
+ red r7
+ lea S0, r3
+ hlt
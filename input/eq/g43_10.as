@@ -0,0 +1,69 @@
+S0: .data 5
+mcr m0
+ lea S0, r3
+ inc r1
+ cmp r3, #-1
+endmcr
+ inc r2
+ inc r2
+ m0
+mcr m1
+ not r5
+ mov r1, r2
+ cmp r3, #-1
+endmcr
+ .string "ab"
+mcr m2
+ lea S0, r3
+endmcr
+; comment
+
+ add #2, r4
+ .data 1, 2
+
+ cmp r3, #-1
+ inc r1
+ m0
+ add #2, r4
+ cmp r3, #-1
+ clr r6
+ not r5
+ m0
+L0: cmp r3, #-1
+ inc r2
+L1: .data 1, 2
+L2: mov r1, r2
+ not r5
+ m0
+
+ cmp r3, #-1
+
+; comment
+ m1
+ m2
+ m0
+ m1
+ m2
+ prn #3
+ inc r2
+ m1
+ m2
+ not r5
+ m1
+
+ clr r6
+ inc r2
+ .string "ab"
+ sub r1, r2
+ inc r2
+ m2
+ inc r2
+; comment
+
+ sub r1, r2
+ sub r1, r2
+ clr r6
+ red r7
+mcr m3
+endmcr
+ hlt
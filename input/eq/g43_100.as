@@ -0,0 +1,42 @@
+S0: .data 5
+
+ prn #3
+ clr r6
+mcr m0
+endmcr
+mcr m1
+ add #2, r4
+ inc r1
+ ;c
+endmcr
+ cmp r3, #-1
+ m0
+L0: prn #3
+ m1
+ cmp r3, #-1
+ inc r2
+ m1
+ m0
+ m1
+ m0
+ m0
+ cmp r3, #-1
+L1: clr r6
+ inc r1
+ .fill 3, 7
+ .string "ab"
+ not r5
+ red r7
+mcr m2
+endmcr
+ .data 1, 2
+ m2
+ .fill 3, 7
+ lea S0, r3
+mcr m3
+ not r5
+ prn #3
+ inc r1
+ add #2, r4
+endmcr
+ hlt
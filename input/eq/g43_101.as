@@ -0,0 +1,76 @@
+S0: .data 5
+ sub r1, r2
+ inc r2
+ cmp r3, #-1
+ red r7
+; comment
+ mov r1, r2
+; comment
+
+ cmp r3, #-1
+; comment
+ clr r6
+mcr m0
+ add #2, r4
+ cmp r3, #-1
+ mov r1, r2
+endmcr
+ lea S0, r3
+ add #2, r4
+; comment
+
+; comment
+ inc r1
+ m0
+ m0
+; comment
+; comment
+ m0
+L0: clr r6
+mcr m1
+ clr r6
+endmcr
+ .string "ab"
+ lea S0, r3
+ inc r2
+ add #2, r4
+ m0
+L1: mov r1, r2
+ m1
+ mov r1, r2
+ lea S0, r3
+ prn #3
+ cmp r3, #-1
+ red r7
+ mov r1, r2
+ not r5
+mcr m2
+ 
+ not r5
+ red r7
+ inc r1
+endmcr
+ m2
+ mov r1, r2
+ m1
+ m0
+ .fill 3, 7
+ m0
+ m0
+mcr m3
+ lea S0, r3
+ red r7
+ ;c
+endmcr
+ .fill 3, 7
+ red r7
+ sub r1, r2
+mcr m4
+ add #2, r4
+endmcr
+ m2
+ clr r6
+L2: sub r1, r2
+ m0
+ m0
+ hlt
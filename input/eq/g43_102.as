@@ -0,0 +1,38 @@
+S0: .data 5
+L0: not r5
+L1: lea S0, r3
+; comment
+
+ .string "ab"
+ sub r1, r2
+; comment
+ red r7
+; comment
+L2: .string "ab"
+ sub r1, r2
+L3: sub r1, r2
+ .data 1, 2
+mcr m0
+ mov r1, r2
+ not r5
+ clr r6
+ 
+endmcr
+ m0
+ clr r6
+ m0
+; comment
+mcr m1
+ ;c
+endmcr
+ m0
+ red r7
+ add #2, r4
+ red r7
+ .space 2
+ .data 1, 2
+ m0
+ sub r1, r2
+ not r5
+; comment
+ hlt
@@ -0,0 +1,86 @@
+S0: .data 5
+
+ .string "ab"
+ lea S0, r3
+ red r7
+ mov r1, r2
+; comment
+L0: inc r1
+L1: .string "ab"
+ prn #3
+ lea S0, r3
+; comment
+ lea S0, r3
+ mov r1, r2
+ .string "ab"
+ inc r2
+; comment
+; comment
+; comment
+ .fill 3, 7
+ .string "ab"
+mcr m0
+ prn #3
+endmcr
+
+ m0
+ inc r2
+ m0
+ m0
+ lea S0, r3
+mcr m1
+ add #2, r4
+ inc r1
+ sub r1, r2
+endmcr
+ inc r2
+ clr r6
+
+L2: mov r1, r2
+ not r5
+ sub r1, r2
+ m0
+ m1
+ m0
+L3: clr r6
+
+mcr m2
+ ;c
+endmcr
+mcr m3
+ ;c
+ ;c
+endmcr
+L4: sub r1, r2
+
+; comment
+ m2
+; comment
+ inc r1
+ .data 1, 2
+L5: not r5
+L6: .string "ab"
+mcr m4
+ ;c
+ 
+ prn #3
+endmcr
+; comment
+ .fill 3, 7
+ m4
+ m2
+ m0
+; comment
+ not r5
+L7: prn #3
+ .data 1, 2
+ .fill 3, 7
+mcr m5
+ inc r1
+ not r5
+ prn #3
+endmcr
+ m3
+ clr r6
+ m0
+ hlt
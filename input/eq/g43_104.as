@@ -0,0 +1,34 @@
+S0: .data 5
+ .string "ab"
+; comment
+mcr m0
+ inc r1
+endmcr
+ mov r1, r2
+mcr m1
+ not r5
+ ;c
+endmcr
+mcr m2
+ lea S0, r3
+endmcr
+ m1
+ prn #3
+; comment
+ inc r2
+ add #2, r4
+L0: inc r1
+L1: .fill 3, 7
+ m2
+; comment
+ not r5
+ .space 2
+mcr m3
+ sub r1, r2
+ red r7
+ ;c
+endmcr
+ m1
+ prn #3
+ m3
+ hlt
@@ -0,0 +1,113 @@
+S0: .data 5
+ lea S0, r3
+ add #2, r4
+L0: add #2, r4
+; comment
+L1: prn #3
+; comment
+ .space 2
+; comment
+ inc r2
+ .data 1, 2
+ lea S0, r3
+ sub r1, r2
+mcr m0
+ lea S0, r3
+ mov r1, r2
+endmcr
+; comment
+ .data 1, 2
+ .space 2
+; comment
+ sub r1, r2
+ red r7
+ lea S0, r3
+ .space 2
+ mov r1, r2
+; comment
+L2: lea S0, r3
+mcr m1
+ clr r6
+ not r5
+ lea S0, r3
+endmcr
+L3: sub r1, r2
+mcr m2
+ not r5
+endmcr
+ clr r6
+L4: .space 2
+mcr m3
+endmcr
+; comment
+ add #2, r4
+ not r5
+mcr m4
+endmcr
+ red r7
+
+ mov r1, r2
+mcr m5
+ cmp r3, #-1
+endmcr
+ .space 2
+ sub r1, r2
+ add #2, r4
+mcr m6
+ sub r1, r2
+ red r7
+ inc r1
+ lea S0, r3
+endmcr
+ m5
+ m1
+ inc r1
+
+ not r5
+ not r5
+mcr m7
+ ;c
+ clr r6
+endmcr
+ m1
+ m4
+ .fill 3, 7
+ .space 2
+L5: .data 1, 2
+mcr m8
+endmcr
+ not r5
+ red r7
+ inc r2
+ inc r2
+mcr m9
+ add #2, r4
+endmcr
+L6: .string "ab"
+ mov r1, r2
+; comment
+; comment
+ inc r1
+mcr m10
+ 
+ 
+ red r7
+endmcr
+ .fill 3, 7
+ .string "ab"
+; comment
+ lea S0, r3
+ sub r1, r2
+mcr m11
+ 
+endmcr
+mcr m12
+ sub r1, r2
+ lea S0, r3
+ ;c
+ mov r1, r2
+endmcr
+ red r7
+ add #2, r4
+ inc r2
+ hlt
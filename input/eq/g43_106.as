@@ -0,0 +1,92 @@
+S0: .data 5
+L0: red r7
+ .space 2
+ add #2, r4
+; comment
+ not r5
+ add #2, r4
+ add #2, r4
+ prn #3
+ inc r2
+mcr m0
+ not r5
+ prn #3
+endmcr
+ m0
+mcr m1
+ mov r1, r2
+ 
+endmcr
+ m1
+
+ lea S0, r3
+
+ m0
+ inc r2
+ m0
+ m0
+ not r5
+ m1
+ red r7
+ m1
+ m1
+; comment
+ .space 2
+ prn #3
+ sub r1, r2
+ .fill 3, 7
+ red r7
+ m0
+ m0
+ mov r1, r2
+ cmp r3, #-1
+ mov r1, r2
+ .data 1, 2
+ m0
+ .space 2
+
+ mov r1, r2
+ add #2, r4
+ inc r2
+ m0
+mcr m2
+ inc r1
+ sub r1, r2
+endmcr
+ m2
+ not r5
+L1: not r5
+ inc r1
+ .fill 3, 7
+mcr m3
+ sub r1, r2
+ not r5
+ lea S0, r3
+ sub r1, r2
+endmcr
+; comment
+mcr m4
+ cmp r3, #-1
+ ;c
+endmcr
+ inc r2
+ not r5
+; comment
+ clr r6
+mcr m5
+ add #2, r4
+ prn #3
+ sub r1, r2
+ red r7
+endmcr
+ add #2, r4
+mcr m6
+ ;c
+ cmp r3, #-1
+endmcr
+ m2
+L2: add #2, r4
+ m4
+ red r7
+ m1
+ hlt
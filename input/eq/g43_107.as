@@ -0,0 +1,50 @@
+S0: .data 5
+ .fill 3, 7
+ red r7
+ clr r6
+ add #2, r4
+mcr m0
+ not r5
+ cmp r3, #-1
+endmcr
+ m0
+ .string "ab"
+ m0
+mcr m1
+ mov r1, r2
+endmcr
+ inc r2
+ m1
+mcr m2
+ clr r6
+ clr r6
+endmcr
+L0: cmp r3, #-1
+ m1
+L1: .fill 3, 7
+; comment
+ .string "ab"
+ m0
+ lea S0, r3
+
+ m2
+ .data 1, 2
+ m1
+ inc r2
+ sub r1, r2
+mcr m3
+ lea S0, r3
+ inc r1
+ red r7
+ clr r6
+endmcr
+ mov r1, r2
+L2: add #2, r4
+; comment
+ sub r1, r2
+ m3
+; comment
+ .data 1, 2
+ lea S0, r3
+ clr r6
+ hlt
@@ -0,0 +1,39 @@
+S0: .data 5
+ mov r1, r2
+; comment
+; comment
+; comment
+mcr m0
+ prn #3
+endmcr
+ m0
+ m0
+mcr m1
+ clr r6
+ mov r1, r2
+ sub r1, r2
+ not r5
+endmcr
+ .space 2
+ .string "ab"
+ .string "ab"
+L0: red r7
+ not r5
+ cmp r3, #-1
+ cmp r3, #-1
+ red r7
+L1: lea S0, r3
+; comment
+ cmp r3, #-1
+ inc r1
+ prn #3
+; comment
+ m0
+ .fill 3, 7
+ inc r2
+mcr m2
+ inc r1
+endmcr
+L2: lea S0, r3
+ not r5
+ hlt
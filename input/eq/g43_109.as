@@ -0,0 +1,46 @@
+S0: .data 5
+; comment
+
+mcr m0
+ sub r1, r2
+endmcr
+ inc r2
+ m0
+ red r7
+
+ add #2, r4
+ sub r1, r2
+ .data 1, 2
+ lea S0, r3
+ prn #3
+ .data 1, 2
+ m0
+ m0
+ inc r1
+; comment
+ inc r2
+ add #2, r4
+ sub r1, r2
+ mov r1, r2
+mcr m1
+ not r5
+ lea S0, r3
+ ;c
+endmcr
+ inc r2
+mcr m2
+endmcr
+; comment
+ inc r2
+L0: .fill 3, 7
+ cmp r3, #-1
+ inc r2
+ .space 2
+ m0
+ lea S0, r3
+L1: not r5
+ inc r1
+L2: lea S0, r3
+; comment
+ m2
+ hlt
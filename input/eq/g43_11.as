@@ -0,0 +1,65 @@
+S0: .data 5
+ .space 2
+ inc r2
+L0: lea S0, r3
+ red r7
+ mov r1, r2
+; comment
+ .string "ab"
+ clr r6
+ lea S0, r3
+ .space 2
+mcr m0
+ cmp r3, #-1
+endmcr
+ .fill 3, 7
+
+ sub r1, r2
+ m0
+ red r7
+; comment
+L1: .space 2
+ m0
+L2: inc r1
+L3: clr r6
+ m0
+ .space 2
+ m0
+ inc r2
+ clr r6
+ cmp r3, #-1
+ m0
+ m0
+ .fill 3, 7
+ m0
+mcr m1
+ red r7
+ prn #3
+ ;c
+endmcr
+ red r7
+L4: .fill 3, 7
+ mov r1, r2
+ inc r1
+ .fill 3, 7
+ inc r1
+; comment
+ .data 1, 2
+mcr m2
+ cmp r3, #-1
+endmcr
+
+mcr m3
+ not r5
+ add #2, r4
+ clr r6
+ mov r1, r2
+endmcr
+mcr m4
+ lea S0, r3
+endmcr
+ inc r1
+; comment
+
+ red r7
+ hlt
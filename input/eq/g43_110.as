@@ -0,0 +1,99 @@
+S0: .data 5
+ .fill 3, 7
+; comment
+ inc r2
+; comment
+ mov r1, r2
+L0: .string "ab"
+L1: mov r1, r2
+ sub r1, r2
+ .fill 3, 7
+; comment
+; comment
+ clr r6
+ red r7
+ .data 1, 2
+; comment
+; comment
+; comment
+
+ red r7
+; comment
+; comment
+; comment
+ add #2, r4
+mcr m0
+ 
+ prn #3
+endmcr
+mcr m1
+ cmp r3, #-1
+ cmp r3, #-1
+ red r7
+endmcr
+ not r5
+ sub r1, r2
+ m1
+
+ not r5
+mcr m2
+endmcr
+ inc r2
+ m0
+L2: mov r1, r2
+mcr m3
+ 
+endmcr
+ m0
+ sub r1, r2
+L3: .space 2
+mcr m4
+ sub r1, r2
+endmcr
+L4: mov r1, r2
+L5: .string "ab"
+mcr m5
+ sub r1, r2
+endmcr
+ m2
+ inc r1
+mcr m6
+endmcr
+ cmp r3, #-1
+
+ .string "ab"
+
+ .space 2
+ .data 1, 2
+ .data 1, 2
+ inc r2
+ cmp r3, #-1
+ m1
+L6: inc r1
+mcr m7
+ sub r1, r2
+endmcr
+ inc r1
+ m3
+ m7
+ m3
+ prn #3
+mcr m8
+endmcr
+ m1
+ mov r1, r2
+ m3
+; comment
+ cmp r3, #-1
+ cmp r3, #-1
+ .fill 3, 7
+ prn #3
+ m6
+L7: .fill 3, 7
+ m2
+ m4
+ cmp r3, #-1
+ add #2, r4
+L8: add #2, r4
+ m8
+ hlt
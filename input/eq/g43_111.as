@@ -0,0 +1,99 @@
+S0: .data 5
+ not r5
+; comment
+ prn #3
+ sub r1, r2
+ clr r6
+ clr r6
+ .fill 3, 7
+ not r5
+ lea S0, r3
+mcr m0
+ sub r1, r2
+ mov r1, r2
+ add #2, r4
+endmcr
+mcr m1
+ cmp r3, #-1
+ not r5
+ cmp r3, #-1
+endmcr
+ sub r1, r2
+mcr m2
+endmcr
+
+ .data 1, 2
+ .string "ab"
+ .space 2
+ .fill 3, 7
+ m0
+ m2
+ red r7
+ inc r1
+ m2
+ m0
+ sub r1, r2
+L0: red r7
+ lea S0, r3
+ prn #3
+L1: .space 2
+ add #2, r4
+
+ .fill 3, 7
+mcr m3
+ mov r1, r2
+ clr r6
+ not r5
+ cmp r3, #-1
+endmcr
+ lea S0, r3
+ mov r1, r2
+; comment
+ m0
+ m0
+
+ cmp r3, #-1
+ red r7
+mcr m4
+ clr r6
+endmcr
+L2: lea S0, r3
+mcr m5
+ add #2, r4
+ not r5
+endmcr
+ .data 1, 2
+ add #2, r4
+; comment
+ m4
+ m4
+ .data 1, 2
+ mov r1, r2
+ cmp r3, #-1
+ mov r1, r2
+L3: .string "ab"
+ inc r2
+ .string "ab"
+ add #2, r4
+ cmp r3, #-1
+ mov r1, r2
+ m5
+ lea S0, r3
+mcr m6
+ red r7
+ inc r1
+ red r7
+ not r5
+endmcr
+
+ m4
+mcr m7
+endmcr
+ sub r1, r2
+ m7
+ .fill 3, 7
+ m0
+ .string "ab"
+ clr r6
+ m4
+ hlt
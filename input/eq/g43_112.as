@@ -0,0 +1,71 @@
+S0: .data 5
+ lea S0, r3
+ clr r6
+; comment
+; comment
+
+; comment
+ .string "ab"
+; comment
+; comment
+ .data 1, 2
+; comment
+
+; comment
+L0: add #2, r4
+mcr m0
+ add #2, r4
+endmcr
+; comment
+ mov r1, r2
+L1: .fill 3, 7
+ add #2, r4
+ inc r2
+mcr m1
+ ;c
+ clr r6
+endmcr
+ prn #3
+
+ lea S0, r3
+ m1
+ m0
+
+ m0
+ not r5
+L2: lea S0, r3
+ m1
+mcr m2
+ sub r1, r2
+ prn #3
+ add #2, r4
+ mov r1, r2
+endmcr
+mcr m3
+endmcr
+ not r5
+ inc r2
+ cmp r3, #-1
+ mov r1, r2
+ m3
+
+mcr m4
+ clr r6
+ lea S0, r3
+endmcr
+ .space 2
+ m2
+ m3
+ not r5
+mcr m5
+ add #2, r4
+ add #2, r4
+ inc r1
+ lea S0, r3
+endmcr
+ red r7
+ .data 1, 2
+ inc r1
+ .space 2
+ m3
+ hlt
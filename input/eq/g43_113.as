@@ -0,0 +1,32 @@
+S0: .data 5
+ .fill 3, 7
+mcr m0
+ not r5
+ cmp r3, #-1
+ clr r6
+ inc r1
+endmcr
+L0: add #2, r4
+ m0
+ m0
+; comment
+ inc r2
+ .string "ab"
+ prn #3
+ lea S0, r3
+ inc r2
+ inc r2
+ m0
+ cmp r3, #-1
+mcr m1
+ inc r1
+endmcr
+ .string "ab"
+L1: .space 2
+mcr m2
+ red r7
+endmcr
+L2: sub r1, r2
+ .space 2
+ m2
+ hlt
@@ -0,0 +1,56 @@
+S0: .data 5
+ not r5
+; comment
+ prn #3
+ sub r1, r2
+mcr m0
+ not r5
+ 
+endmcr
+mcr m1
+endmcr
+ red r7
+ sub r1, r2
+; comment
+ .string "ab"
+
+
+ inc r2
+ cmp r3, #-1
+ m1
+ .data 1, 2
+mcr m2
+endmcr
+ lea S0, r3
+ m0
+ .fill 3, 7
+ inc r2
+mcr m3
+ mov r1, r2
+endmcr
+ m2
+mcr m4
+ mov r1, r2
+ add #2, r4
+ not r5
+endmcr
+mcr m5
+ cmp r3, #-1
+endmcr
+
+ m3
+ not r5
+ m4
+mcr m6
+ inc r1
+endmcr
+ m4
+mcr m7
+ inc r1
+ inc r1
+ not r5
+endmcr
+; comment
+L0: .space 2
+ m4
+ hlt
@@ -0,0 +1,95 @@
+S0: .data 5
+; comment
+L0: sub r1, r2
+ .space 2
+; comment
+ add #2, r4
+ inc r2
+L1: prn #3
+; comment
+ prn #3
+ lea S0, r3
+; comment
+; comment
+; comment
+ prn #3
+ .fill 3, 7
+mcr m0
+ sub r1, r2
+endmcr
+ m0
+ .data 1, 2
+ cmp r3, #-1
+ .space 2
+ red r7
+ m0
+ lea S0, r3
+L2: add #2, r4
+ prn #3
+ m0
+ .data 1, 2
+mcr m1
+endmcr
+; comment
+ m0
+ m0
+ sub r1, r2
+ clr r6
+ not r5
+ m0
+ mov r1, r2
+mcr m2
+endmcr
+ .space 2
+ m2
+ m1
+ lea S0, r3
+ .data 1, 2
+ m2
+ m2
+ prn #3
+mcr m3
+ mov r1, r2
+endmcr
+ sub r1, r2
+L3: sub r1, r2
+ m3
+ inc r2
+L4: cmp r3, #-1
+mcr m4
+ lea S0, r3
+ mov r1, r2
+ lea S0, r3
+endmcr
+L5: .data 1, 2
+ add #2, r4
+ .string "ab"
+mcr m5
+ inc r1
+ clr r6
+endmcr
+ .fill 3, 7
+mcr m6
+ not r5
+ cmp r3, #-1
+endmcr
+ m1
+ mov r1, r2
+; comment
+ inc r2
+
+ prn #3
+ cmp r3, #-1
+ red r7
+ m3
+ m3
+ m4
+ add #2, r4
+ add #2, r4
+
+ m6
+ .space 2
+ not r5
+ add #2, r4
+ inc r2
+ hlt
@@ -0,0 +1,103 @@
+S0: .data 5
+ sub r1, r2
+mcr m0
+endmcr
+ red r7
+ add #2, r4
+ .space 2
+mcr m1
+endmcr
+ m1
+ inc r2
+ .fill 3, 7
+L0: red r7
+ prn #3
+mcr m2
+ lea S0, r3
+ cmp r3, #-1
+ lea S0, r3
+endmcr
+; comment
+ m2
+ .space 2
+
+ clr r6
+ cmp r3, #-1
+L1: .data 1, 2
+ not r5
+; comment
+; comment
+ .string "ab"
+ .data 1, 2
+; comment
+mcr m3
+ inc r1
+ prn #3
+endmcr
+ m2
+mcr m4
+endmcr
+ m2
+ inc r1
+ prn #3
+ red r7
+ red r7
+ not r5
+mcr m5
+endmcr
+ m2
+; comment
+; comment
+ m3
+ m2
+ .fill 3, 7
+ not r5
+mcr m6
+ inc r1
+ inc r1
+ prn #3
+ not r5
+endmcr
+mcr m7
+ ;c
+ cmp r3, #-1
+ add #2, r4
+ lea S0, r3
+endmcr
+ prn #3
+ add #2, r4
+ sub r1, r2
+ .string "ab"
+; comment
+
+mcr m8
+endmcr
+ .string "ab"
+ mov r1, r2
+; comment
+ sub r1, r2
+
+; comment
+; comment
+
+ .string "ab"
+L2: cmp r3, #-1
+ cmp r3, #-1
+ add #2, r4
+mcr m9
+ red r7
+ add #2, r4
+endmcr
+ m8
+ m3
+mcr m10
+ clr r6
+ inc r1
+ mov r1, r2
+endmcr
+ not r5
+ mov r1, r2
+ m5
+L3: not r5
+ inc r2
+ hlt
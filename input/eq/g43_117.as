@@ -0,0 +1,58 @@
+S0: .data 5
+; comment
+; comment
+ sub r1, r2
+mcr m0
+ lea S0, r3
+ not r5
+ not r5
+ red r7
+endmcr
+L0: inc r1
+; comment
+mcr m1
+ clr r6
+ ;c
+ clr r6
+endmcr
+; comment
+ m1
+ lea S0, r3
+ prn #3
+ clr r6
+ m0
+ mov r1, r2
+mcr m2
+ not r5
+endmcr
+; comment
+ not r5
+ cmp r3, #-1
+ inc r1
+ inc r1
+ m1
+
+mcr m3
+ 
+ prn #3
+ inc r1
+endmcr
+
+ .data 1, 2
+ .string "ab"
+L1: clr r6
+ cmp r3, #-1
+; comment
+mcr m4
+ ;c
+ add #2, r4
+ not r5
+endmcr
+mcr m5
+ add #2, r4
+endmcr
+ .string "ab"
+ .string "ab"
+ inc r2
+ lea S0, r3
+ hlt
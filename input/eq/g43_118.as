@@ -0,0 +1,84 @@
+S0: .data 5
+L0: add #2, r4
+; comment
+ add #2, r4
+mcr m0
+ sub r1, r2
+ lea S0, r3
+ not r5
+endmcr
+L1: sub r1, r2
+ .string "ab"
+mcr m1
+ lea S0, r3
+endmcr
+ m1
+ m0
+ inc r1
+ not r5
+ red r7
+
+ m0
+L2: red r7
+mcr m2
+ cmp r3, #-1
+endmcr
+; comment
+L3: cmp r3, #-1
+ add #2, r4
+mcr m3
+ sub r1, r2
+ prn #3
+endmcr
+ .space 2
+ prn #3
+ cmp r3, #-1
+L4: add #2, r4
+L5: red r7
+ clr r6
+ .fill 3, 7
+ m0
+ m0
+ .fill 3, 7
+ m3
+ m3
+ add #2, r4
+ m1
+ prn #3
+mcr m4
+endmcr
+ .string "ab"
+ m0
+ m3
+mcr m5
+ lea S0, r3
+endmcr
+ m5
+L6: not r5
+ inc r2
+ sub r1, r2
+ lea S0, r3
+L7: lea S0, r3
+L8: not r5
+ sub r1, r2
+mcr m6
+endmcr
+ m4
+ clr r6
+ .data 1, 2
+ add #2, r4
+L9: cmp r3, #-1
+L10: add #2, r4
+ m0
+mcr m7
+endmcr
+L11: red r7
+ prn #3
+ red r7
+ sub r1, r2
+
+
+ not r5
+mcr m8
+endmcr
+ hlt
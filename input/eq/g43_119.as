@@ -0,0 +1,115 @@
+S0: .data 5
+; comment
+ sub r1, r2
+ .fill 3, 7
+mcr m0
+ ;c
+ cmp r3, #-1
+ prn #3
+endmcr
+ m0
+ m0
+; comment
+ m0
+ inc r1
+ m0
+ inc r2
+ sub r1, r2
+ inc r2
+; comment
+mcr m1
+ cmp r3, #-1
+endmcr
+ clr r6
+ lea S0, r3
+ m0
+mcr m2
+endmcr
+L0: lea S0, r3
+ m1
+ m2
+; comment
+ cmp r3, #-1
+ clr r6
+; comment
+L1: inc r1
+
+; comment
+mcr m3
+ ;c
+ lea S0, r3
+ mov r1, r2
+ add #2, r4
+endmcr
+ prn #3
+; comment
+ m1
+ clr r6
+mcr m4
+ not r5
+ prn #3
+ 
+ add #2, r4
+endmcr
+ m4
+ m0
+L2: .data 1, 2
+L3: .space 2
+ lea S0, r3
+mcr m5
+ mov r1, r2
+endmcr
+ m4
+L4: red r7
+ .string "ab"
+ cmp r3, #-1
+
+ m5
+ mov r1, r2
+L5: inc r1
+ inc r1
+ lea S0, r3
+ m0
+L6: not r5
+ m1
+ lea S0, r3
+ clr r6
+mcr m6
+ red r7
+endmcr
+ red r7
+ mov r1, r2
+mcr m7
+endmcr
+mcr m8
+ not r5
+ red r7
+ not r5
+endmcr
+ .space 2
+ m5
+mcr m9
+endmcr
+ m0
+; comment
+ m8
+ sub r1, r2
+mcr m10
+ not r5
+ mov r1, r2
+ mov r1, r2
+endmcr
+
+ red r7
+ .space 2
+ .fill 3, 7
+ m6
+ .string "ab"
+ m8
+ clr r6
+mcr m11
+ mov r1, r2
+ prn #3
+endmcr
+
+ hlt
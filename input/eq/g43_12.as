@@ -0,0 +1,68 @@
+S0: .data 5
+; comment
+L0: not r5
+mcr m0
+ red r7
+ add #2, r4
+endmcr
+ red r7
+L1: sub r1, r2
+ red r7
+ m0
+mcr m1
+ mov r1, r2
+endmcr
+ .space 2
+; comment
+ inc r1
+ .data 1, 2
+mcr m2
+ red r7
+ mov r1, r2
+ ;c
+endmcr
+
+ m1
+L2: sub r1, r2
+ inc r1
+ mov r1, r2
+; comment
+ red r7
+ .data 1, 2
+ .fill 3, 7
+; comment
+; comment
+ .data 1, 2
+ m1
+; comment
+ .fill 3, 7
+ m1
+L3: clr r6
+mcr m3
+ inc r1
+ clr r6
+ cmp r3, #-1
+endmcr
+ mov r1, r2
+ m0
+ inc r1
+ inc r2
+L4: .string "ab"
+
+ m2
+
+ .space 2
+ prn #3
+L5: prn #3
+L6: lea S0, r3
+ m2
+ m0
+ cmp r3, #-1
+ sub r1, r2
+mcr m4
+ ;c
+ add #2, r4
+endmcr
+ cmp r3, #-1
+ red r7
+ hlt
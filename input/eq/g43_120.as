@@ -0,0 +1,68 @@
+S0: .data 5
+; comment
+ .data 1, 2
+L0: red r7
+ cmp r3, #-1
+ not r5
+ .string "ab"
+; comment
+; comment
+; comment
+; comment
+L1: .string "ab"
+; comment
+L2: .string "ab"
+mcr m0
+ clr r6
+ clr r6
+ 
+endmcr
+ clr r6
+ .fill 3, 7
+mcr m1
+endmcr
+; comment
+ .string "ab"
+ prn #3
+ not r5
+ m1
+ m1
+ m1
+mcr m2
+ sub r1, r2
+ cmp r3, #-1
+endmcr
+ cmp r3, #-1
+ .fill 3, 7
+ m2
+L3: mov r1, r2
+ m2
+mcr m3
+ prn #3
+endmcr
+; comment
+L4: lea S0, r3
+ inc r2
+mcr m4
+endmcr
+mcr m5
+ prn #3
+endmcr
+ not r5
+ cmp r3, #-1
+ lea S0, r3
+ not r5
+ clr r6
+; comment
+ m1
+ m5
+L5: .data 1, 2
+ inc r2
+ m5
+mcr m6
+endmcr
+ mov r1, r2
+ m5
+ .fill 3, 7
+ .data 1, 2
+ hlt
@@ -0,0 +1,29 @@
+S0: .data 5
+; comment
+ .data 1, 2
+L0: sub r1, r2
+; comment
+; comment
+ inc r1
+ .fill 3, 7
+
+; comment
+ inc r2
+ .fill 3, 7
+ prn #3
+
+mcr m0
+ ;c
+endmcr
+
+ inc r2
+ mov r1, r2
+ m0
+ inc r2
+; comment
+L1: lea S0, r3
+ m0
+ clr r6
+ cmp r3, #-1
+L2: prn #3
+ hlt
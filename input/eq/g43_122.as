@@ -0,0 +1,63 @@
+S0: .data 5
+; comment
+ mov r1, r2
+ red r7
+L0: lea S0, r3
+; comment
+ cmp r3, #-1
+; comment
+ prn #3
+; comment
+ mov r1, r2
+ sub r1, r2
+ sub r1, r2
+ inc r2
+; comment
+L1: lea S0, r3
+ not r5
+ .data 1, 2
+mcr m0
+endmcr
+L2: lea S0, r3
+ m0
+; comment
+ m0
+ inc r1
+L3: red r7
+ lea S0, r3
+ inc r1
+ .fill 3, 7
+ .fill 3, 7
+ .string "ab"
+ lea S0, r3
+ .space 2
+ .fill 3, 7
+ m0
+ not r5
+ clr r6
+ m0
+ mov r1, r2
+ .space 2
+L4: .space 2
+L5: clr r6
+ m0
+; comment
+ m0
+ lea S0, r3
+ not r5
+mcr m1
+ mov r1, r2
+ ;c
+ ;c
+ sub r1, r2
+endmcr
+mcr m2
+ cmp r3, #-1
+ cmp r3, #-1
+endmcr
+L6: inc r1
+L7: not r5
+ m1
+ not r5
+ lea S0, r3
+ hlt
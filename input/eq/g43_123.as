@@ -0,0 +1,38 @@
+S0: .data 5
+; comment
+L0: add #2, r4
+ inc r1
+ not r5
+; comment
+; comment
+; comment
+; comment
+mcr m0
+ mov r1, r2
+ lea S0, r3
+ clr r6
+endmcr
+mcr m1
+ 
+ red r7
+endmcr
+mcr m2
+endmcr
+mcr m3
+ prn #3
+endmcr
+ inc r1
+
+ inc r2
+ inc r2
+mcr m4
+ not r5
+ sub r1, r2
+endmcr
+ cmp r3, #-1
+ lea S0, r3
+ m3
+ .data 1, 2
+ .data 1, 2
+ .space 2
+ hlt
@@ -0,0 +1,56 @@
+S0: .data 5
+ prn #3
+mcr m0
+ not r5
+ inc r1
+endmcr
+ m0
+ .space 2
+ lea S0, r3
+ m0
+; comment
+ m0
+ m0
+ .fill 3, 7
+mcr m1
+ lea S0, r3
+ ;c
+ 
+ mov r1, r2
+endmcr
+; comment
+L0: .fill 3, 7
+L1: mov r1, r2
+ .fill 3, 7
+ m0
+ red r7
+ not r5
+L2: mov r1, r2
+ inc r1
+mcr m2
+ sub r1, r2
+ mov r1, r2
+ 
+ lea S0, r3
+endmcr
+ inc r2
+ inc r2
+ inc r2
+ .data 1, 2
+mcr m3
+ clr r6
+endmcr
+L3: cmp r3, #-1
+ m2
+ inc r2
+ m3
+ sub r1, r2
+; comment
+ inc r1
+ m0
+mcr m4
+ sub r1, r2
+endmcr
+ cmp r3, #-1
+L4: .fill 3, 7
+ hlt
@@ -0,0 +1,116 @@
+S0: .data 5
+; comment
+ lea S0, r3
+L0: not r5
+; comment
+ mov r1, r2
+; comment
+ .space 2
+mcr m0
+ add #2, r4
+ prn #3
+endmcr
+ inc r2
+ m0
+ inc r1
+ sub r1, r2
+mcr m1
+ ;c
+ 
+ 
+ prn #3
+endmcr
+L1: mov r1, r2
+ lea S0, r3
+; comment
+ inc r1
+ .string "ab"
+ .fill 3, 7
+mcr m2
+ cmp r3, #-1
+ 
+ not r5
+ ;c
+endmcr
+ inc r2
+ cmp r3, #-1
+ add #2, r4
+
+ .string "ab"
+L2: mov r1, r2
+
+ m2
+ red r7
+
+L3: add #2, r4
+ m1
+ lea S0, r3
+ m2
+ m2
+ mov r1, r2
+ add #2, r4
+ m2
+ .fill 3, 7
+ .data 1, 2
+ m2
+ m1
+ .fill 3, 7
+ m2
+mcr m3
+ red r7
+ clr r6
+ red r7
+ prn #3
+endmcr
+ sub r1, r2
+ m3
+ red r7
+mcr m4
+ red r7
+ clr r6
+ sub r1, r2
+ clr r6
+endmcr
+; comment
+
+L4: .fill 3, 7
+ inc r1
+mcr m5
+ 
+endmcr
+ not r5
+mcr m6
+ ;c
+ inc r1
+ mov r1, r2
+ add #2, r4
+endmcr
+
+ m4
+L5: sub r1, r2
+ m6
+ inc r2
+mcr m7
+ lea S0, r3
+ red r7
+endmcr
+ cmp r3, #-1
+ inc r2
+ clr r6
+mcr m8
+ sub r1, r2
+ inc r1
+ clr r6
+endmcr
+ prn #3
+L6: .fill 3, 7
+ .space 2
+ m0
+
+ m0
+L7: mov r1, r2
+ .space 2
+ cmp r3, #-1
+ m1
+ cmp r3, #-1
+ hlt
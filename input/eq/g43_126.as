@@ -0,0 +1,80 @@
+S0: .data 5
+mcr m0
+ red r7
+ cmp r3, #-1
+ ;c
+ prn #3
+endmcr
+ inc r2
+ inc r2
+ m0
+L0: red r7
+L1: sub r1, r2
+ m0
+; comment
+; comment
+ red r7
+ .fill 3, 7
+ m0
+ m0
+; comment
+ m0
+mcr m1
+ cmp r3, #-1
+ 
+ inc r1
+endmcr
+ .string "ab"
+ prn #3
+ lea S0, r3
+L2: .fill 3, 7
+ inc r2
+ not r5
+; comment
+ .fill 3, 7
+mcr m2
+endmcr
+ inc r2
+ red r7
+ .fill 3, 7
+mcr m3
+ mov r1, r2
+ add #2, r4
+ clr r6
+ add #2, r4
+endmcr
+L3: sub r1, r2
+ inc r2
+ m2
+
+ cmp r3, #-1
+ clr r6
+ lea S0, r3
+ lea S0, r3
+ not r5
+mcr m4
+ sub r1, r2
+ 
+endmcr
+ .string "ab"
+ add #2, r4
+ .space 2
+ m4
+ lea S0, r3
+ sub r1, r2
+ .fill 3, 7
+ m4
+ m0
+ inc r1
+ add #2, r4
+; comment
+ m4
+ add #2, r4
+L4: .space 2
+ sub r1, r2
+mcr m5
+ clr r6
+ lea S0, r3
+ cmp r3, #-1
+endmcr
+ hlt
@@ -0,0 +1,36 @@
+S0: .data 5
+ lea S0, r3
+mcr m0
+endmcr
+ m0
+; comment
+ m0
+; comment
+mcr m1
+ sub r1, r2
+ 
+endmcr
+L0: clr r6
+mcr m2
+ not r5
+ not r5
+ inc r1
+ red r7
+endmcr
+ .string "ab"
+ .space 2
+ m2
+ m2
+mcr m3
+ sub r1, r2
+ inc r1
+endmcr
+ m1
+
+ cmp r3, #-1
+ .space 2
+ m1
+ .fill 3, 7
+; comment
+ .fill 3, 7
+ hlt
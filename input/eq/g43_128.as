@@ -0,0 +1,124 @@
+S0: .data 5
+ clr r6
+; comment
+mcr m0
+ not r5
+endmcr
+ add #2, r4
+ sub r1, r2
+ inc r1
+; comment
+ .string "ab"
+ clr r6
+; comment
+ inc r2
+ inc r2
+ clr r6
+ cmp r3, #-1
+ prn #3
+mcr m1
+ red r7
+ add #2, r4
+ red r7
+ sub r1, r2
+endmcr
+; comment
+ lea S0, r3
+mcr m2
+ 
+ prn #3
+ red r7
+endmcr
+mcr m3
+ sub r1, r2
+ add #2, r4
+ not r5
+endmcr
+ inc r2
+; comment
+ sub r1, r2
+L0: clr r6
+mcr m4
+endmcr
+L1: add #2, r4
+ m0
+ prn #3
+ .space 2
+ m0
+ sub r1, r2
+ .fill 3, 7
+; comment
+ m0
+ .fill 3, 7
+ m1
+mcr m5
+ ;c
+ sub r1, r2
+ sub r1, r2
+endmcr
+ red r7
+ add #2, r4
+mcr m6
+ mov r1, r2
+ sub r1, r2
+ inc r1
+endmcr
+ .space 2
+ m3
+ mov r1, r2
+ .data 1, 2
+ red r7
+mcr m7
+ clr r6
+ ;c
+ not r5
+endmcr
+ m3
+L2: inc r1
+ red r7
+ m6
+ m2
+mcr m8
+ not r5
+ lea S0, r3
+ cmp r3, #-1
+ add #2, r4
+endmcr
+ m0
+ inc r2
+; comment
+ m2
+ cmp r3, #-1
+ .space 2
+
+mcr m9
+ ;c
+ clr r6
+endmcr
+; comment
+ clr r6
+ .string "ab"
+ .string "ab"
+mcr m10
+ 
+endmcr
+L3: prn #3
+ m2
+L4: sub r1, r2
+ m6
+ m4
+mcr m11
+ add #2, r4
+ sub r1, r2
+ red r7
+endmcr
+ m6
+ m8
+
+L5: not r5
+ mov r1, r2
+ m5
+L6: add #2, r4
+ m7
+ .fill 3, 7
+ hlt
@@ -0,0 +1,63 @@
+S0: .data 5
+ sub r1, r2
+ .string "ab"
+ not r5
+; comment
+L0: prn #3
+ lea S0, r3
+ red r7
+ prn #3
+; comment
+ .string "ab"
+mcr m0
+ inc r1
+ cmp r3, #-1
+ lea S0, r3
+endmcr
+ m0
+ m0
+ m0
+ m0
+ m0
+L1: .string "ab"
+ prn #3
+ m0
+ m0
+ red r7
+; comment
+L2: sub r1, r2
+ .fill 3, 7
+ m0
+ m0
+ mov r1, r2
+; comment
+ inc r1
+; comment
+ m0
+ prn #3
+; comment
+ m0
+ clr r6
+ m0
+ inc r2
+ clr r6
+ cmp r3, #-1
+ red r7
+ m0
+ mov r1, r2
+ inc r2
+ .space 2
+
+ mov r1, r2
+ .string "ab"
+; comment
+ not r5
+ sub r1, r2
+ cmp r3, #-1
+ m0
+ .data 1, 2
+ prn #3
+ not r5
+ lea S0, r3
+ m0
+ hlt
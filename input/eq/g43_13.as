@@ -0,0 +1,42 @@
+S0: .data 5
+; comment
+ .fill 3, 7
+; comment
+; comment
+; comment
+; comment
+L0: prn #3
+ .string "ab"
+
+ lea S0, r3
+L1: .space 2
+ .fill 3, 7
+; comment
+
+
+; comment
+ not r5
+ inc r2
+ lea S0, r3
+ clr r6
+ not r5
+ add #2, r4
+ .string "ab"
+
+L2: sub r1, r2
+; comment
+ add #2, r4
+; comment
+; comment
+ lea S0, r3
+; comment
+; comment
+; comment
+; comment
+mcr m0
+ clr r6
+ inc r1
+ 
+endmcr
+
+ hlt
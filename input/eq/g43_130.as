@@ -0,0 +1,73 @@
+S0: .data 5
+
+ .data 1, 2
+ inc r1
+ cmp r3, #-1
+ sub r1, r2
+ sub r1, r2
+ cmp r3, #-1
+mcr m0
+endmcr
+L0: not r5
+ red r7
+ m0
+L1: clr r6
+mcr m1
+ sub r1, r2
+ sub r1, r2
+ ;c
+ prn #3
+endmcr
+L2: .string "ab"
+ mov r1, r2
+L3: .fill 3, 7
+
+mcr m2
+ clr r6
+ mov r1, r2
+ not r5
+endmcr
+ sub r1, r2
+ m0
+ m2
+L4: clr r6
+
+ m2
+ cmp r3, #-1
+ m1
+ .space 2
+ cmp r3, #-1
+ .fill 3, 7
+ m1
+ inc r1
+
+ inc r2
+ lea S0, r3
+ m0
+; comment
+ m1
+ inc r2
+ m0
+; comment
+ not r5
+ m1
+mcr m3
+ prn #3
+ prn #3
+ add #2, r4
+endmcr
+ m1
+ .data 1, 2
+ m3
+ m0
+
+L5: add #2, r4
+L6: inc r1
+mcr m4
+endmcr
+mcr m5
+ red r7
+ clr r6
+endmcr
+ cmp r3, #-1
+ hlt
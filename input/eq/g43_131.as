@@ -0,0 +1,49 @@
+S0: .data 5
+; comment
+ clr r6
+; comment
+ not r5
+L0: .string "ab"
+ sub r1, r2
+ red r7
+L1: sub r1, r2
+; comment
+
+ .string "ab"
+
+L2: mov r1, r2
+ red r7
+L3: .space 2
+mcr m0
+endmcr
+ lea S0, r3
+ lea S0, r3
+ lea S0, r3
+ inc r2
+ m0
+
+ m0
+
+ m0
+
+ .fill 3, 7
+mcr m1
+ red r7
+ mov r1, r2
+ prn #3
+ clr r6
+endmcr
+ clr r6
+ m1
+ add #2, r4
+mcr m2
+endmcr
+ m0
+ m1
+ red r7
+L4: sub r1, r2
+ inc r1
+ m0
+ m0
+; comment
+ hlt
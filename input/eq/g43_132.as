@@ -0,0 +1,56 @@
+S0: .data 5
+; comment
+mcr m0
+ inc r1
+endmcr
+ m0
+ m0
+ m0
+ m0
+ m0
+ .space 2
+ .fill 3, 7
+ not r5
+L0: not r5
+L1: sub r1, r2
+ not r5
+L2: lea S0, r3
+mcr m1
+ add #2, r4
+ not r5
+endmcr
+L3: .data 1, 2
+ inc r2
+L4: .fill 3, 7
+ m0
+ lea S0, r3
+ not r5
+mcr m2
+ ;c
+ lea S0, r3
+endmcr
+ add #2, r4
+ m2
+ prn #3
+ m0
+ mov r1, r2
+ m0
+ .string "ab"
+ prn #3
+ m2
+ m0
+ .string "ab"
+ m0
+ clr r6
+; comment
+ .data 1, 2
+ .fill 3, 7
+ .fill 3, 7
+L5: prn #3
+ m2
+ m2
+ m2
+ cmp r3, #-1
+ inc r2
+L6: sub r1, r2
+ hlt
@@ -0,0 +1,71 @@
+S0: .data 5
+; comment
+; comment
+ .fill 3, 7
+ lea S0, r3
+ inc r1
+ .data 1, 2
+L0: cmp r3, #-1
+L1: prn #3
+ inc r1
+; comment
+ lea S0, r3
+; comment
+ prn #3
+L2: not r5
+ add #2, r4
+mcr m0
+endmcr
+ .space 2
+ m0
+mcr m1
+ red r7
+ 
+ add #2, r4
+endmcr
+; comment
+ .space 2
+mcr m2
+ clr r6
+ clr r6
+ clr r6
+ sub r1, r2
+endmcr
+ m1
+ m1
+
+ red r7
+ .space 2
+mcr m3
+ lea S0, r3
+endmcr
+ m2
+ m0
+ m0
+ .fill 3, 7
+ m2
+ m1
+ not r5
+ inc r2
+ sub r1, r2
+
+L3: prn #3
+mcr m4
+ add #2, r4
+ inc r1
+ ;c
+endmcr
+mcr m5
+ 
+endmcr
+ red r7
+ sub r1, r2
+; comment
+ add #2, r4
+ m1
+ .data 1, 2
+ .string "ab"
+L4: clr r6
+L5: not r5
+ red r7
+ hlt
@@ -0,0 +1,65 @@
+S0: .data 5
+ .string "ab"
+ .string "ab"
+; comment
+L0: red r7
+; comment
+ inc r2
+; comment
+ red r7
+mcr m0
+ 
+ add #2, r4
+ add #2, r4
+ mov r1, r2
+endmcr
+ .string "ab"
+ .data 1, 2
+; comment
+ .space 2
+ prn #3
+ sub r1, r2
+ lea S0, r3
+ sub r1, r2
+ mov r1, r2
+ m0
+L1: .fill 3, 7
+ cmp r3, #-1
+ m0
+ m0
+L2: .fill 3, 7
+ cmp r3, #-1
+ mov r1, r2
+ sub r1, r2
+ m0
+mcr m1
+ prn #3
+endmcr
+ m0
+ sub r1, r2
+mcr m2
+ not r5
+endmcr
+; comment
+; comment
+ cmp r3, #-1
+mcr m3
+ clr r6
+endmcr
+ inc r2
+ inc r1
+ not r5
+mcr m4
+ red r7
+endmcr
+ .data 1, 2
+ inc r2
+ inc r1
+ red r7
+ inc r1
+ mov r1, r2
+ m2
+
+ clr r6
+ add #2, r4
+ hlt
@@ -0,0 +1,81 @@
+S0: .data 5
+; comment
+ add #2, r4
+ mov r1, r2
+mcr m0
+ not r5
+endmcr
+ not r5
+ m0
+L0: add #2, r4
+ m0
+ mov r1, r2
+ not r5
+mcr m1
+endmcr
+ m0
+ .string "ab"
+ inc r1
+ inc r2
+
+L1: prn #3
+ prn #3
+ inc r2
+ .fill 3, 7
+ m0
+ m0
+ m0
+; comment
+mcr m2
+endmcr
+L2: .data 1, 2
+ inc r1
+
+ lea S0, r3
+ .string "ab"
+ lea S0, r3
+ .fill 3, 7
+L3: prn #3
+mcr m3
+ red r7
+ lea S0, r3
+ not r5
+ red r7
+endmcr
+mcr m4
+ mov r1, r2
+ add #2, r4
+ ;c
+endmcr
+ lea S0, r3
+ mov r1, r2
+ m4
+ add #2, r4
+ clr r6
+ m1
+ inc r2
+ prn #3
+L4: prn #3
+
+L5: not r5
+ .space 2
+ sub r1, r2
+ m0
+ inc r2
+ m4
+ red r7
+ m4
+; comment
+L6: not r5
+ prn #3
+L7: cmp r3, #-1
+ m3
+mcr m5
+ cmp r3, #-1
+ not r5
+ not r5
+endmcr
+ m3
+ m5
+ m1
+ hlt
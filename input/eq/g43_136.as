@@ -0,0 +1,75 @@
+S0: .data 5
+
+mcr m0
+ cmp r3, #-1
+ clr r6
+ 
+endmcr
+ m0
+mcr m1
+endmcr
+L0: inc r1
+ lea S0, r3
+ clr r6
+L1: inc r1
+ add #2, r4
+ .string "ab"
+ m1
+ cmp r3, #-1
+
+mcr m2
+ lea S0, r3
+ ;c
+endmcr
+; comment
+ .fill 3, 7
+mcr m3
+ ;c
+ cmp r3, #-1
+ cmp r3, #-1
+ sub r1, r2
+endmcr
+ m1
+ .data 1, 2
+ prn #3
+ m3
+ m3
+ inc r2
+ m3
+ m1
+ m3
+ prn #3
+ m0
+ red r7
+; comment
+L2: sub r1, r2
+ .fill 3, 7
+mcr m4
+ red r7
+ ;c
+endmcr
+ m2
+L3: mov r1, r2
+ lea S0, r3
+ m3
+ inc r1
+; comment
+ mov r1, r2
+ m0
+ not r5
+
+ m0
+ sub r1, r2
+mcr m5
+endmcr
+ m5
+ sub r1, r2
+ red r7
+ cmp r3, #-1
+L4: .fill 3, 7
+ .fill 3, 7
+ inc r2
+ .data 1, 2
+; comment
+ .data 1, 2
+ hlt
@@ -0,0 +1,35 @@
+S0: .data 5
+; comment
+; comment
+; comment
+ inc r2
+mcr m0
+ sub r1, r2
+ not r5
+ clr r6
+endmcr
+ sub r1, r2
+ sub r1, r2
+mcr m1
+endmcr
+L0: .string "ab"
+ prn #3
+ m1
+ .fill 3, 7
+ .string "ab"
+mcr m2
+ 
+ sub r1, r2
+endmcr
+mcr m3
+endmcr
+ sub r1, r2
+L1: not r5
+ mov r1, r2
+L2: .string "ab"
+ .space 2
+ m3
+ m3
+ cmp r3, #-1
+ add #2, r4
+ hlt
@@ -0,0 +1,46 @@
+S0: .data 5
+; comment
+ add #2, r4
+L0: cmp r3, #-1
+ prn #3
+ cmp r3, #-1
+ red r7
+L1: mov r1, r2
+; comment
+ inc r1
+L2: cmp r3, #-1
+ lea S0, r3
+; comment
+ clr r6
+mcr m0
+ sub r1, r2
+ inc r1
+ lea S0, r3
+endmcr
+ .fill 3, 7
+ .fill 3, 7
+L3: .fill 3, 7
+ sub r1, r2
+mcr m1
+ clr r6
+ inc r1
+ not r5
+ sub r1, r2
+endmcr
+ cmp r3, #-1
+L4: inc r1
+L5: prn #3
+mcr m2
+ not r5
+ add #2, r4
+endmcr
+ .string "ab"
+ m2
+ m2
+ add #2, r4
+ sub r1, r2
+ clr r6
+ m1
+ .string "ab"
+ clr r6
+ hlt
@@ -0,0 +1,28 @@
+S0: .data 5
+ lea S0, r3
+ .space 2
+L0: sub r1, r2
+ not r5
+; comment
+ prn #3
+ add #2, r4
+ .data 1, 2
+; comment
+mcr m0
+ not r5
+endmcr
+ mov r1, r2
+ sub r1, r2
+mcr m1
+ add #2, r4
+ sub r1, r2
+ inc r1
+endmcr
+ m0
+ mov r1, r2
+ clr r6
+ inc r1
+ .data 1, 2
+ cmp r3, #-1
+ m1
+ hlt
@@ -0,0 +1,42 @@
+S0: .data 5
+ .fill 3, 7
+ add #2, r4
+; comment
+mcr m0
+ add #2, r4
+ red r7
+ ;c
+endmcr
+ clr r6
+mcr m1
+ not r5
+endmcr
+; comment
+ m0
+ m1
+ m0
+ m1
+mcr m2
+ cmp r3, #-1
+ clr r6
+endmcr
+; comment
+ red r7
+mcr m3
+endmcr
+ .data 1, 2
+ m0
+ red r7
+ m3
+ red r7
+L0: mov r1, r2
+ add #2, r4
+mcr m4
+ mov r1, r2
+ ;c
+ sub r1, r2
+endmcr
+ clr r6
+ sub r1, r2
+ m3
+ hlt
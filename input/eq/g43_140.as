@@ -0,0 +1,88 @@
+S0: .data 5
+ inc r1
+ inc r1
+; comment
+ .string "ab"
+ add #2, r4
+ cmp r3, #-1
+ clr r6
+ inc r1
+
+; comment
+mcr m0
+ ;c
+ sub r1, r2
+ prn #3
+endmcr
+ m0
+ .string "ab"
+mcr m1
+ ;c
+ red r7
+ 
+ cmp r3, #-1
+endmcr
+ m0
+L0: clr r6
+ inc r2
+ m0
+; comment
+ .space 2
+; comment
+ lea S0, r3
+ lea S0, r3
+ .fill 3, 7
+; comment
+ .space 2
+ m1
+ red r7
+ prn #3
+ prn #3
+ m1
+mcr m2
+ prn #3
+ cmp r3, #-1
+endmcr
+ add #2, r4
+ m0
+ clr r6
+ cmp r3, #-1
+ cmp r3, #-1
+; comment
+ m1
+ clr r6
+ .fill 3, 7
+ .data 1, 2
+ m2
+ m1
+ red r7
+ .data 1, 2
+L1: mov r1, r2
+; comment
+ m1
+ mov r1, r2
+
+L2: lea S0, r3
+ m1
+ red r7
+ inc r2
+ m2
+; comment
+ prn #3
+ m0
+ m2
+ lea S0, r3
+ add #2, r4
+ m0
+mcr m3
+endmcr
+L3: .data 1, 2
+; comment
+ cmp r3, #-1
+ inc r1
+mcr m4
+ 
+ ;c
+ ;c
+endmcr
+ hlt
@@ -0,0 +1,79 @@
+S0: .data 5
+ lea S0, r3
+; comment
+ inc r1
+ inc r1
+ clr r6
+ lea S0, r3
+L0: prn #3
+; comment
+ lea S0, r3
+; comment
+ add #2, r4
+; comment
+ cmp r3, #-1
+ .data 1, 2
+ inc r2
+ lea S0, r3
+mcr m0
+ inc r1
+ not r5
+endmcr
+ sub r1, r2
+ inc r2
+; comment
+; comment
+ .string "ab"
+ m0
+ inc r1
+mcr m1
+ ;c
+ lea S0, r3
+endmcr
+ inc r1
+ m0
+ inc r1
+mcr m2
+endmcr
+
+ prn #3
+ add #2, r4
+ .data 1, 2
+ m2
+L1: .data 1, 2
+ .string "ab"
+ m2
+ .fill 3, 7
+L2: prn #3
+ m1
+mcr m3
+ 
+ prn #3
+ inc r1
+ cmp r3, #-1
+endmcr
+; comment
+L3: not r5
+mcr m4
+ clr r6
+ add #2, r4
+ sub r1, r2
+ inc r1
+endmcr
+ m2
+mcr m5
+ add #2, r4
+ not r5
+ red r7
+endmcr
+L4: add #2, r4
+ red r7
+ .fill 3, 7
+; comment
+ m0
+ m1
+mcr m6
+ 
+ add #2, r4
+endmcr
+ hlt
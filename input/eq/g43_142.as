@@ -0,0 +1,74 @@
+S0: .data 5
+ .data 1, 2
+ inc r2
+; comment
+L0: add #2, r4
+; comment
+ cmp r3, #-1
+ inc r1
+ .string "ab"
+; comment
+ red r7
+L1: .fill 3, 7
+; comment
+ inc r1
+; comment
+ .string "ab"
+L2: .space 2
+ .string "ab"
+mcr m0
+endmcr
+L3: sub r1, r2
+ not r5
+ m0
+ m0
+ cmp r3, #-1
+ m0
+ inc r1
+ .string "ab"
+L4: add #2, r4
+mcr m1
+ cmp r3, #-1
+ not r5
+endmcr
+ prn #3
+mcr m2
+endmcr
+ sub r1, r2
+ .fill 3, 7
+ clr r6
+ .space 2
+mcr m3
+ lea S0, r3
+ mov r1, r2
+ 
+endmcr
+ prn #3
+ inc r1
+ inc r2
+ sub r1, r2
+L5: not r5
+ red r7
+ inc r1
+ m1
+ add #2, r4
+ m2
+ m0
+ clr r6
+ red r7
+mcr m4
+ 
+endmcr
+; comment
+
+ not r5
+ m2
+mcr m5
+ add #2, r4
+ clr r6
+ lea S0, r3
+endmcr
+; comment
+ cmp r3, #-1
+ red r7
+ hlt
@@ -0,0 +1,113 @@
+S0: .data 5
+; comment
+ inc r1
+; comment
+L0: red r7
+; comment
+mcr m0
+ clr r6
+ mov r1, r2
+endmcr
+ m0
+ .data 1, 2
+ add #2, r4
+ m0
+ m0
+mcr m1
+ not r5
+ 
+ cmp r3, #-1
+ sub r1, r2
+endmcr
+ .space 2
+ cmp r3, #-1
+ .fill 3, 7
+ not r5
+ lea S0, r3
+ m0
+L1: sub r1, r2
+mcr m2
+ inc r1
+ prn #3
+ red r7
+endmcr
+ m2
+; comment
+ m0
+ red r7
+ sub r1, r2
+ prn #3
+ .fill 3, 7
+ inc r2
+ inc r1
+mcr m3
+ cmp r3, #-1
+ red r7
+endmcr
+mcr m4
+ mov r1, r2
+ clr r6
+endmcr
+ cmp r3, #-1
+mcr m5
+ prn #3
+ cmp r3, #-1
+ 
+ 
+endmcr
+ sub r1, r2
+ .string "ab"
+ m2
+ not r5
+ not r5
+ prn #3
+ .string "ab"
+ prn #3
+
+ inc r2
+ m1
+; comment
+mcr m6
+ prn #3
+ prn #3
+ 
+ mov r1, r2
+endmcr
+ mov r1, r2
+ m6
+ add #2, r4
+; comment
+ m0
+ red r7
+; comment
+ m5
+ sub r1, r2
+
+ m6
+
+ not r5
+mcr m7
+ add #2, r4
+ clr r6
+ inc r1
+endmcr
+L2: clr r6
+ m6
+
+ sub r1, r2
+ .string "ab"
+ m7
+ prn #3
+ cmp r3, #-1
+ sub r1, r2
+ m6
+L3: .string "ab"
+ .string "ab"
+mcr m8
+endmcr
+
+ m8
+ m2
+ lea S0, r3
+ cmp r3, #-1
+ hlt
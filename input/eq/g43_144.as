@@ -0,0 +1,69 @@
+S0: .data 5
+mcr m0
+endmcr
+L0: .string "ab"
+; comment
+ red r7
+ inc r2
+ m0
+mcr m1
+endmcr
+ sub r1, r2
+L1: add #2, r4
+ sub r1, r2
+ .string "ab"
+; comment
+mcr m2
+ 
+ lea S0, r3
+ cmp r3, #-1
+endmcr
+ lea S0, r3
+L2: add #2, r4
+
+ not r5
+ cmp r3, #-1
+L3: red r7
+L4: prn #3
+ clr r6
+ m2
+
+mcr m3
+ lea S0, r3
+endmcr
+ .fill 3, 7
+ .data 1, 2
+L5: lea S0, r3
+ inc r2
+ .fill 3, 7
+ .data 1, 2
+ m1
+ .data 1, 2
+ m2
+
+ inc r1
+ lea S0, r3
+ m0
+ inc r2
+; comment
+ m1
+ m0
+ mov r1, r2
+ .fill 3, 7
+ m2
+mcr m4
+ add #2, r4
+ red r7
+ prn #3
+endmcr
+mcr m5
+ clr r6
+ prn #3
+ red r7
+ not r5
+endmcr
+mcr m6
+ sub r1, r2
+endmcr
+; comment
+ hlt
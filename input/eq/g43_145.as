@@ -0,0 +1,110 @@
+S0: .data 5
+ clr r6
+mcr m0
+endmcr
+ .string "ab"
+ .string "ab"
+ inc r2
+ mov r1, r2
+ m0
+ inc r1
+ m0
+ .string "ab"
+ inc r1
+ prn #3
+L0: cmp r3, #-1
+ clr r6
+ add #2, r4
+
+; comment
+mcr m1
+ add #2, r4
+ clr r6
+ cmp r3, #-1
+endmcr
+ m1
+L1: sub r1, r2
+; comment
+ mov r1, r2
+ red r7
+; comment
+L2: .data 1, 2
+ .space 2
+ red r7
+ m1
+ clr r6
+L3: inc r1
+mcr m2
+ cmp r3, #-1
+ clr r6
+endmcr
+ mov r1, r2
+ mov r1, r2
+ .space 2
+ cmp r3, #-1
+L4: clr r6
+ m1
+ inc r1
+ m2
+L5: .space 2
+mcr m3
+ sub r1, r2
+ sub r1, r2
+ red r7
+endmcr
+L6: inc r1
+L7: .data 1, 2
+ inc r1
+ cmp r3, #-1
+mcr m4
+endmcr
+ .data 1, 2
+ m1
+ m2
+L8: not r5
+; comment
+ m1
+ inc r2
+ m2
+ .data 1, 2
+mcr m5
+endmcr
+ m1
+ clr r6
+ cmp r3, #-1
+ .space 2
+ m0
+ m2
+mcr m6
+ 
+ lea S0, r3
+ mov r1, r2
+endmcr
+mcr m7
+ inc r1
+ prn #3
+ add #2, r4
+ prn #3
+endmcr
+mcr m8
+ prn #3
+ red r7
+endmcr
+ cmp r3, #-1
+mcr m9
+ lea S0, r3
+endmcr
+ m1
+mcr m10
+ ;c
+ prn #3
+ prn #3
+ clr r6
+endmcr
+ m7
+; comment
+ red r7
+ m5
+ red r7
+ inc r2
+ hlt
@@ -0,0 +1,34 @@
+S0: .data 5
+; comment
+; comment
+ prn #3
+ not r5
+; comment
+ add #2, r4
+L0: clr r6
+; comment
+; comment
+ inc r1
+
+mcr m0
+ 
+endmcr
+
+ red r7
+ m0
+; comment
+ m0
+ not r5
+ not r5
+L1: cmp r3, #-1
+ m0
+L2: red r7
+ clr r6
+ m0
+
+mcr m1
+ red r7
+endmcr
+ add #2, r4
+ lea S0, r3
+ hlt
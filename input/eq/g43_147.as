@@ -0,0 +1,87 @@
+S0: .data 5
+ clr r6
+
+ .string "ab"
+ add #2, r4
+ inc r2
+mcr m0
+ mov r1, r2
+ clr r6
+endmcr
+ not r5
+ cmp r3, #-1
+ m0
+L0: sub r1, r2
+ cmp r3, #-1
+ m0
+ clr r6
+ m0
+ m0
+L1: .string "ab"
+ m0
+mcr m1
+ clr r6
+ lea S0, r3
+ not r5
+ clr r6
+endmcr
+ cmp r3, #-1
+ m1
+
+ m1
+ m1
+ inc r2
+mcr m2
+endmcr
+ .data 1, 2
+L2: clr r6
+ add #2, r4
+ sub r1, r2
+ cmp r3, #-1
+ .string "ab"
+mcr m3
+endmcr
+mcr m4
+ sub r1, r2
+endmcr
+L3: lea S0, r3
+ m1
+; comment
+L4: .space 2
+
+ inc r2
+ m0
+ sub r1, r2
+ add #2, r4
+ .data 1, 2
+ sub r1, r2
+ add #2, r4
+mcr m5
+endmcr
+ clr r6
+ red r7
+ m1
+ m3
+ .fill 3, 7
+mcr m6
+ clr r6
+ cmp r3, #-1
+ cmp r3, #-1
+endmcr
+ m1
+
+ not r5
+mcr m7
+ cmp r3, #-1
+ lea S0, r3
+ clr r6
+ 
+endmcr
+ red r7
+mcr m8
+ not r5
+ red r7
+ sub r1, r2
+ 
+endmcr
+ hlt
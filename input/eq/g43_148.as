@@ -0,0 +1,63 @@
+S0: .data 5
+ .fill 3, 7
+mcr m0
+ not r5
+ add #2, r4
+ add #2, r4
+endmcr
+mcr m1
+ ;c
+ mov r1, r2
+ add #2, r4
+endmcr
+ sub r1, r2
+ clr r6
+ clr r6
+ inc r1
+mcr m2
+ lea S0, r3
+ ;c
+endmcr
+L0: sub r1, r2
+ m0
+
+
+ red r7
+; comment
+ not r5
+ m2
+
+ inc r2
+mcr m3
+ prn #3
+endmcr
+ add #2, r4
+ cmp r3, #-1
+ m3
+
+ sub r1, r2
+ m0
+ inc r1
+ .data 1, 2
+L1: clr r6
+
+ m2
+ inc r2
+ m2
+ .fill 3, 7
+
+ inc r1
+L2: lea S0, r3
+ cmp r3, #-1
+mcr m4
+ red r7
+ 
+endmcr
+ .space 2
+ m4
+ inc r1
+ m4
+L3: prn #3
+L4: .space 2
+ m3
+ hlt
@@ -0,0 +1,39 @@
+S0: .data 5
+mcr m0
+ prn #3
+ prn #3
+ inc r1
+endmcr
+mcr m1
+ lea S0, r3
+endmcr
+mcr m2
+endmcr
+mcr m3
+endmcr
+ m1
+mcr m4
+endmcr
+ m3
+ m3
+ clr r6
+ inc r2
+ inc r1
+ cmp r3, #-1
+ m4
+ m0
+ m2
+mcr m5
+ add #2, r4
+ prn #3
+ prn #3
+endmcr
+ m0
+ add #2, r4
+ sub r1, r2
+ inc r1
+ inc r1
+ cmp r3, #-1
+ .fill 3, 7
+ inc r1
+ hlt
@@ -0,0 +1,50 @@
+S0: .data 5
+mcr m0
+endmcr
+ m0
+mcr m1
+ 
+endmcr
+L0: cmp r3, #-1
+ inc r2
+; comment
+; comment
+ m0
+ .fill 3, 7
+ m1
+ m1
+L1: red r7
+ not r5
+ m1
+; comment
+ mov r1, r2
+L2: inc r1
+ lea S0, r3
+L3: .string "ab"
+ prn #3
+mcr m2
+endmcr
+; comment
+mcr m3
+ add #2, r4
+ clr r6
+ sub r1, r2
+ cmp r3, #-1
+endmcr
+ m2
+mcr m4
+ add #2, r4
+ prn #3
+endmcr
+ not r5
+ inc r2
+L4: .fill 3, 7
+ .fill 3, 7
+ m3
+; comment
+mcr m5
+ 
+ mov r1, r2
+endmcr
+ m0
+ hlt
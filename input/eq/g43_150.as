@@ -0,0 +1,99 @@
+S0: .data 5
+; comment
+; comment
+; comment
+L0: prn #3
+mcr m0
+ not r5
+ add #2, r4
+endmcr
+ .space 2
+ inc r1
+ .space 2
+ inc r2
+ .data 1, 2
+ m0
+mcr m1
+ lea S0, r3
+endmcr
+ .fill 3, 7
+ red r7
+ .space 2
+ .fill 3, 7
+ prn #3
+L1: red r7
+L2: add #2, r4
+ inc r1
+ add #2, r4
+mcr m2
+endmcr
+ lea S0, r3
+ m1
+mcr m3
+ not r5
+ prn #3
+endmcr
+L3: .data 1, 2
+mcr m4
+ add #2, r4
+endmcr
+ .string "ab"
+ clr r6
+ m4
+L4: add #2, r4
+mcr m5
+endmcr
+ inc r2
+ m0
+ inc r1
+; comment
+ sub r1, r2
+ clr r6
+ cmp r3, #-1
+
+ lea S0, r3
+ add #2, r4
+ m2
+ cmp r3, #-1
+mcr m6
+endmcr
+ .data 1, 2
+ .string "ab"
+mcr m7
+ mov r1, r2
+ red r7
+ inc r1
+ cmp r3, #-1
+endmcr
+L5: .string "ab"
+mcr m8
+ sub r1, r2
+endmcr
+L6: add #2, r4
+ prn #3
+ prn #3
+ prn #3
+ m7
+ mov r1, r2
+; comment
+ m1
+; comment
+ sub r1, r2
+mcr m9
+ not r5
+ clr r6
+ ;c
+endmcr
+ mov r1, r2
+ red r7
+ m7
+ m6
+ m2
+ inc r2
+ .space 2
+ cmp r3, #-1
+; comment
+mcr m10
+endmcr
+ m3
+ hlt
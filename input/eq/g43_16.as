@@ -0,0 +1,64 @@
+S0: .data 5
+ inc r2
+; comment
+; comment
+mcr m0
+ cmp r3, #-1
+ ;c
+endmcr
+ m0
+ m0
+ .string "ab"
+mcr m1
+ lea S0, r3
+endmcr
+ m0
+ .data 1, 2
+ inc r2
+ .string "ab"
+ m1
+; comment
+
+mcr m2
+ clr r6
+ sub r1, r2
+ ;c
+endmcr
+ m2
+ m0
+ m0
+L0: .fill 3, 7
+; comment
+ inc r2
+ m1
+ inc r2
+mcr m3
+ 
+ inc r1
+ red r7
+endmcr
+L1: red r7
+ .string "ab"
+
+ red r7
+ .string "ab"
+; comment
+; comment
+ .data 1, 2
+ red r7
+ .fill 3, 7
+ mov r1, r2
+mcr m4
+endmcr
+L2: cmp r3, #-1
+L3: .space 2
+ .space 2
+ m2
+ m4
+mcr m5
+ cmp r3, #-1
+ mov r1, r2
+ mov r1, r2
+ ;c
+endmcr
+ hlt
@@ -0,0 +1,82 @@
+S0: .data 5
+; comment
+; comment
+; comment
+; comment
+ sub r1, r2
+mcr m0
+endmcr
+ m0
+ m0
+ .data 1, 2
+; comment
+L0: inc r1
+L1: cmp r3, #-1
+ sub r1, r2
+ not r5
+L2: .data 1, 2
+; comment
+ .space 2
+ prn #3
+; comment
+L3: not r5
+; comment
+mcr m1
+ inc r1
+ red r7
+endmcr
+; comment
+ .space 2
+mcr m2
+ cmp r3, #-1
+endmcr
+L4: not r5
+mcr m3
+ cmp r3, #-1
+ 
+endmcr
+ sub r1, r2
+ add #2, r4
+L5: not r5
+mcr m4
+ lea S0, r3
+ add #2, r4
+ not r5
+ inc r1
+endmcr
+mcr m5
+ inc r1
+ red r7
+endmcr
+ red r7
+ add #2, r4
+ .string "ab"
+mcr m6
+ sub r1, r2
+ ;c
+ prn #3
+ clr r6
+endmcr
+ inc r2
+ lea S0, r3
+ m2
+L6: .data 1, 2
+ m6
+ add #2, r4
+ .fill 3, 7
+ m3
+mcr m7
+ add #2, r4
+ ;c
+endmcr
+L7: red r7
+mcr m8
+ cmp r3, #-1
+endmcr
+ add #2, r4
+ inc r1
+ inc r2
+; comment
+ inc r2
+ sub r1, r2
+ hlt
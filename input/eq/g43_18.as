@@ -0,0 +1,35 @@
+S0: .data 5
+; comment
+
+; comment
+ .data 1, 2
+ inc r2
+
+; comment
+; comment
+ not r5
+ prn #3
+L0: cmp r3, #-1
+; comment
+; comment
+ .fill 3, 7
+ .space 2
+L1: add #2, r4
+ cmp r3, #-1
+; comment
+; comment
+ add #2, r4
+ add #2, r4
+; comment
+L2: sub r1, r2
+ .data 1, 2
+; comment
+ .fill 3, 7
+; comment
+ inc r2
+mcr m0
+ lea S0, r3
+endmcr
+ m0
+ .space 2
+ hlt
@@ -0,0 +1,91 @@
+S0: .data 5
+mcr m0
+ mov r1, r2
+ sub r1, r2
+ cmp r3, #-1
+ clr r6
+endmcr
+ m0
+ lea S0, r3
+ m0
+L0: .space 2
+ m0
+mcr m1
+ cmp r3, #-1
+ mov r1, r2
+ cmp r3, #-1
+ mov r1, r2
+endmcr
+ clr r6
+mcr m2
+endmcr
+; comment
+mcr m3
+ clr r6
+ red r7
+ ;c
+endmcr
+ lea S0, r3
+ .fill 3, 7
+; comment
+ lea S0, r3
+L1: clr r6
+ m3
+mcr m4
+ inc r1
+ red r7
+ red r7
+endmcr
+ sub r1, r2
+ not r5
+ prn #3
+ m0
+ inc r2
+
+ .data 1, 2
+ m2
+
+ m1
+ inc r2
+ m0
+mcr m5
+ ;c
+ clr r6
+endmcr
+mcr m6
+endmcr
+ inc r2
+
+ prn #3
+ m0
+ m3
+ m3
+ cmp r3, #-1
+ .data 1, 2
+
+L2: prn #3
+; comment
+ .data 1, 2
+ lea S0, r3
+ m2
+L3: inc r1
+ m6
+ m1
+ m3
+ prn #3
+ .fill 3, 7
+ .string "ab"
+ m5
+ add #2, r4
+ .space 2
+mcr m7
+ prn #3
+endmcr
+mcr m8
+endmcr
+L4: .space 2
+ .string "ab"
+ m5
+ m5
+ mov r1, r2
+ hlt
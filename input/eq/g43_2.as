@@ -0,0 +1,100 @@
+S0: .data 5
+L0: inc r1
+; comment
+; comment
+ .space 2
+L1: lea S0, r3
+ clr r6
+ .space 2
+ sub r1, r2
+ inc r1
+; comment
+ clr r6
+ prn #3
+; comment
+mcr m0
+ prn #3
+ prn #3
+endmcr
+ not r5
+ prn #3
+
+; comment
+ .fill 3, 7
+ not r5
+ prn #3
+; comment
+ .data 1, 2
+ inc r2
+ sub r1, r2
+ .data 1, 2
+ red r7
+ sub r1, r2
+ inc r2
+ m0
+L2: .space 2
+ add #2, r4
+ inc r2
+ m0
+ m0
+ inc r2
+; comment
+ mov r1, r2
+ m0
+ cmp r3, #-1
+mcr m1
+ ;c
+ inc r1
+ add #2, r4
+ lea S0, r3
+endmcr
+ m0
+ prn #3
+ m0
+ inc r1
+L3: inc r1
+; comment
+ m0
+mcr m2
+endmcr
+mcr m3
+endmcr
+; comment
+ m1
+ sub r1, r2
+; comment
+mcr m4
+ prn #3
+endmcr
+ inc r1
+ .string "ab"
+ m3
+mcr m5
+ sub r1, r2
+ lea S0, r3
+ 
+endmcr
+mcr m6
+ clr r6
+ lea S0, r3
+endmcr
+ red r7
+mcr m7
+ mov r1, r2
+ inc r1
+endmcr
+
+ prn #3
+ red r7
+ m5
+ m6
+ .string "ab"
+ m0
+ m2
+ m1
+
+ m0
+ cmp r3, #-1
+mcr m8
+endmcr
+ hlt
@@ -0,0 +1,117 @@
+S0: .data 5
+ .fill 3, 7
+ add #2, r4
+ mov r1, r2
+L0: prn #3
+; comment
+mcr m0
+ not r5
+endmcr
+ inc r2
+ clr r6
+ m0
+ m0
+ .fill 3, 7
+; comment
+ m0
+mcr m1
+endmcr
+mcr m2
+ 
+ add #2, r4
+endmcr
+ m1
+ m0
+ add #2, r4
+ cmp r3, #-1
+mcr m3
+ add #2, r4
+ add #2, r4
+ prn #3
+ 
+endmcr
+ lea S0, r3
+ .data 1, 2
+L1: prn #3
+L2: .space 2
+ m3
+ m0
+ inc r1
+
+L3: .space 2
+L4: add #2, r4
+ not r5
+; comment
+
+L5: .string "ab"
+ mov r1, r2
+L6: inc r1
+ mov r1, r2
+ .data 1, 2
+L7: .fill 3, 7
+ m0
+ m1
+L8: .space 2
+ m3
+mcr m4
+ cmp r3, #-1
+endmcr
+ mov r1, r2
+ prn #3
+
+mcr m5
+ ;c
+endmcr
+ m0
+ add #2, r4
+ prn #3
+mcr m6
+ inc r1
+ clr r6
+endmcr
+; comment
+ clr r6
+L9: .fill 3, 7
+ cmp r3, #-1
+mcr m7
+ mov r1, r2
+ sub r1, r2
+ lea S0, r3
+ not r5
+endmcr
+ prn #3
+L10: mov r1, r2
+ cmp r3, #-1
+ clr r6
+mcr m8
+ add #2, r4
+ red r7
+endmcr
+mcr m9
+ lea S0, r3
+endmcr
+; comment
+ clr r6
+mcr m10
+ mov r1, r2
+ lea S0, r3
+ red r7
+endmcr
+ m3
+ m5
+; comment
+L11: not r5
+mcr m11
+ inc r1
+ mov r1, r2
+endmcr
+ inc r2
+ add #2, r4
+mcr m12
+ not r5
+ sub r1, r2
+endmcr
+ m3
+
+
+ hlt
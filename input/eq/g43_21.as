@@ -0,0 +1,52 @@
+S0: .data 5
+; comment
+; comment
+; comment
+ .fill 3, 7
+ prn #3
+; comment
+mcr m0
+ lea S0, r3
+ clr r6
+endmcr
+mcr m1
+ cmp r3, #-1
+endmcr
+ clr r6
+ clr r6
+mcr m2
+ sub r1, r2
+ red r7
+endmcr
+ .data 1, 2
+; comment
+ m0
+ m0
+
+ not r5
+ m2
+mcr m3
+ mov r1, r2
+endmcr
+ cmp r3, #-1
+ .data 1, 2
+ lea S0, r3
+mcr m4
+ red r7
+ sub r1, r2
+ clr r6
+ cmp r3, #-1
+endmcr
+ m1
+ clr r6
+ sub r1, r2
+ clr r6
+ prn #3
+L0: red r7
+mcr m5
+ 
+ sub r1, r2
+ cmp r3, #-1
+ lea S0, r3
+endmcr
+ hlt
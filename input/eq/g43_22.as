@@ -0,0 +1,130 @@
+S0: .data 5
+; comment
+mcr m0
+ prn #3
+ 
+ mov r1, r2
+endmcr
+ not r5
+mcr m1
+ inc r1
+ not r5
+endmcr
+ prn #3
+ clr r6
+mcr m2
+endmcr
+ add #2, r4
+ m0
+ .string "ab"
+L0: lea S0, r3
+ m1
+ m1
+ m2
+ add #2, r4
+ prn #3
+ m0
+; comment
+ m1
+ clr r6
+ prn #3
+; comment
+ add #2, r4
+ sub r1, r2
+ sub r1, r2
+mcr m3
+ not r5
+ mov r1, r2
+ clr r6
+endmcr
+ inc r1
+ sub r1, r2
+mcr m4
+ cmp r3, #-1
+ prn #3
+ inc r1
+endmcr
+L1: not r5
+L2: .data 1, 2
+mcr m5
+ prn #3
+ ;c
+ 
+ cmp r3, #-1
+endmcr
+L3: mov r1, r2
+; comment
+ lea S0, r3
+ red r7
+ m2
+ .string "ab"
+ inc r2
+mcr m6
+ mov r1, r2
+ lea S0, r3
+endmcr
+ m0
+mcr m7
+ not r5
+ ;c
+ mov r1, r2
+ not r5
+endmcr
+mcr m8
+ clr r6
+ 
+ add #2, r4
+ prn #3
+endmcr
+mcr m9
+ not r5
+endmcr
+ cmp r3, #-1
+ inc r2
+mcr m10
+endmcr
+ m1
+ lea S0, r3
+ m8
+ inc r1
+L4: lea S0, r3
+ m7
+ inc r1
+ red r7
+ mov r1, r2
+mcr m11
+ prn #3
+ prn #3
+ ;c
+ not r5
+endmcr
+mcr m12
+ prn #3
+ lea S0, r3
+ add #2, r4
+endmcr
+mcr m13
+ 
+ inc r1
+ add #2, r4
+endmcr
+ inc r1
+ red r7
+ m8
+
+; comment
+ m13
+ .string "ab"
+ prn #3
+ lea S0, r3
+; comment
+ sub r1, r2
+ m8
+ m13
+ red r7
+L5: sub r1, r2
+; comment
+L6: .fill 3, 7
+L7: sub r1, r2
+ m0
+ hlt
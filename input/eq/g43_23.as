@@ -0,0 +1,106 @@
+S0: .data 5
+ add #2, r4
+mcr m0
+ add #2, r4
+ clr r6
+ clr r6
+ sub r1, r2
+endmcr
+; comment
+ add #2, r4
+ m0
+L0: mov r1, r2
+L1: clr r6
+ clr r6
+mcr m1
+endmcr
+L2: .data 1, 2
+ m1
+ .space 2
+ .data 1, 2
+ .space 2
+ lea S0, r3
+L3: prn #3
+ m1
+L4: sub r1, r2
+mcr m2
+endmcr
+
+ lea S0, r3
+ mov r1, r2
+ m1
+ red r7
+ m0
+ mov r1, r2
+ cmp r3, #-1
+ m2
+L5: clr r6
+ inc r1
+; comment
+ m0
+ cmp r3, #-1
+ sub r1, r2
+
+mcr m3
+endmcr
+ clr r6
+mcr m4
+ red r7
+ sub r1, r2
+endmcr
+ m3
+L6: cmp r3, #-1
+L7: .data 1, 2
+ .space 2
+mcr m5
+ inc r1
+endmcr
+
+ m3
+ lea S0, r3
+; comment
+ .space 2
+ sub r1, r2
+; comment
+ sub r1, r2
+mcr m6
+ mov r1, r2
+ inc r1
+endmcr
+ not r5
+ clr r6
+ mov r1, r2
+ mov r1, r2
+ red r7
+L8: add #2, r4
+; comment
+ prn #3
+; comment
+L9: inc r1
+
+
+mcr m7
+ red r7
+ lea S0, r3
+endmcr
+ sub r1, r2
+ m4
+ m1
+ m0
+ red r7
+mcr m8
+ lea S0, r3
+ clr r6
+ add #2, r4
+endmcr
+ clr r6
+ m5
+ m0
+; comment
+ red r7
+ sub r1, r2
+mcr m9
+ add #2, r4
+endmcr
+ prn #3
+ hlt
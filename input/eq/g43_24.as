@@ -0,0 +1,79 @@
+S0: .data 5
+; comment
+ cmp r3, #-1
+; comment
+ mov r1, r2
+ .fill 3, 7
+L0: .fill 3, 7
+ inc r2
+L1: .data 1, 2
+ red r7
+
+; comment
+ mov r1, r2
+; comment
+ .data 1, 2
+; comment
+ not r5
+mcr m0
+ not r5
+endmcr
+ m0
+ m0
+L2: .fill 3, 7
+ red r7
+ m0
+ mov r1, r2
+L3: .data 1, 2
+ inc r2
+L4: .fill 3, 7
+ sub r1, r2
+L5: cmp r3, #-1
+ m0
+ .data 1, 2
+ m0
+; comment
+ inc r2
+ add #2, r4
+ .space 2
+ cmp r3, #-1
+mcr m1
+ 
+ not r5
+ red r7
+endmcr
+
+L6: inc r1
+ m1
+ sub r1, r2
+ .space 2
+ m1
+; comment
+ m0
+ .data 1, 2
+L7: sub r1, r2
+ clr r6
+ add #2, r4
+ not r5
+ clr r6
+ inc r2
+ prn #3
+ sub r1, r2
+L8: red r7
+ mov r1, r2
+mcr m2
+endmcr
+ .string "ab"
+ m1
+ mov r1, r2
+mcr m3
+ mov r1, r2
+ lea S0, r3
+ sub r1, r2
+ red r7
+endmcr
+ add #2, r4
+ red r7
+; comment
+ .data 1, 2
+ hlt
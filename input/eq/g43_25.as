@@ -0,0 +1,58 @@
+S0: .data 5
+ .space 2
+; comment
+ .data 1, 2
+ .fill 3, 7
+; comment
+
+ mov r1, r2
+ cmp r3, #-1
+ lea S0, r3
+ sub r1, r2
+ inc r2
+mcr m0
+endmcr
+ not r5
+ m0
+L0: mov r1, r2
+ sub r1, r2
+ inc r1
+mcr m1
+ cmp r3, #-1
+ clr r6
+ sub r1, r2
+ red r7
+endmcr
+
+ inc r2
+ red r7
+ red r7
+mcr m2
+ clr r6
+ ;c
+ red r7
+endmcr
+mcr m3
+ clr r6
+endmcr
+ not r5
+L1: mov r1, r2
+ .data 1, 2
+ m1
+ .fill 3, 7
+ m3
+; comment
+; comment
+ inc r2
+ inc r2
+
+; comment
+ mov r1, r2
+ m2
+ .string "ab"
+ cmp r3, #-1
+ m2
+ .string "ab"
+L2: inc r1
+ .string "ab"
+ hlt
@@ -0,0 +1,94 @@
+S0: .data 5
+ .data 1, 2
+L0: inc r1
+L1: red r7
+L2: sub r1, r2
+
+; comment
+ .string "ab"
+L3: .space 2
+L4: cmp r3, #-1
+; comment
+ inc r2
+ clr r6
+L5: inc r1
+ .space 2
+; comment
+mcr m0
+endmcr
+ inc r2
+ not r5
+ clr r6
+ inc r1
+ m0
+ lea S0, r3
+mcr m1
+endmcr
+ m0
+mcr m2
+ not r5
+endmcr
+ mov r1, r2
+ m1
+ clr r6
+ inc r1
+L6: .fill 3, 7
+ m1
+ m2
+ .data 1, 2
+ m1
+L7: .string "ab"
+mcr m3
+ inc r1
+ sub r1, r2
+ mov r1, r2
+ lea S0, r3
+endmcr
+ .string "ab"
+ .space 2
+ .fill 3, 7
+ m3
+ m2
+ m0
+mcr m4
+endmcr
+ .space 2
+
+mcr m5
+ red r7
+ not r5
+endmcr
+ sub r1, r2
+mcr m6
+endmcr
+ red r7
+ m6
+ clr r6
+L8: .string "ab"
+ mov r1, r2
+L9: inc r1
+; comment
+ m1
+ m3
+ inc r2
+L10: cmp r3, #-1
+L11: .string "ab"
+mcr m7
+ mov r1, r2
+endmcr
+ m2
+mcr m8
+ ;c
+ 
+ sub r1, r2
+ prn #3
+endmcr
+ sub r1, r2
+mcr m9
+ sub r1, r2
+ mov r1, r2
+ clr r6
+endmcr
+ cmp r3, #-1
+ m8
+ hlt
@@ -0,0 +1,87 @@
+S0: .data 5
+ inc r2
+; comment
+; comment
+mcr m0
+ sub r1, r2
+ not r5
+endmcr
+ m0
+ m0
+ inc r2
+mcr m1
+ ;c
+ mov r1, r2
+ lea S0, r3
+ clr r6
+endmcr
+L0: .string "ab"
+
+ m1
+ m1
+ cmp r3, #-1
+ mov r1, r2
+ .string "ab"
+mcr m2
+ mov r1, r2
+ prn #3
+ red r7
+ 
+endmcr
+ m2
+ prn #3
+ red r7
+ m2
+ mov r1, r2
+
+L1: not r5
+ m1
+ m1
+ inc r1
+ m2
+ inc r2
+mcr m3
+ inc r1
+ clr r6
+endmcr
+ m0
+ m0
+ m3
+ m0
+ add #2, r4
+ sub r1, r2
+L2: mov r1, r2
+mcr m4
+ add #2, r4
+endmcr
+L3: .space 2
+ clr r6
+ prn #3
+L4: .string "ab"
+ m3
+ m2
+ .space 2
+ m0
+ m0
+ m1
+ lea S0, r3
+mcr m5
+ not r5
+ add #2, r4
+ inc r1
+ ;c
+endmcr
+ inc r2
+ m3
+ m3
+ .data 1, 2
+ prn #3
+ m4
+L5: cmp r3, #-1
+ lea S0, r3
+ m2
+ m1
+mcr m6
+endmcr
+; comment
+ hlt
@@ -0,0 +1,40 @@
+S0: .data 5
+ sub r1, r2
+; comment
+; comment
+ inc r2
+; comment
+; comment
+; comment
+ prn #3
+; comment
+; comment
+mcr m0
+ not r5
+ 
+ prn #3
+endmcr
+ m0
+ .data 1, 2
+ m0
+L0: add #2, r4
+ add #2, r4
+ prn #3
+mcr m1
+ red r7
+ not r5
+ prn #3
+endmcr
+; comment
+ m1
+ .data 1, 2
+ m1
+ cmp r3, #-1
+ inc r1
+mcr m2
+ not r5
+ ;c
+endmcr
+L1: clr r6
+ prn #3
+ hlt
@@ -0,0 +1,69 @@
+S0: .data 5
+mcr m0
+ lea S0, r3
+ add #2, r4
+ mov r1, r2
+ sub r1, r2
+endmcr
+ clr r6
+ mov r1, r2
+ .fill 3, 7
+ not r5
+ .space 2
+
+ m0
+ .data 1, 2
+ cmp r3, #-1
+
+ m0
+ .fill 3, 7
+ m0
+ lea S0, r3
+ inc r2
+ .space 2
+mcr m1
+ prn #3
+ add #2, r4
+endmcr
+ m1
+ sub r1, r2
+; comment
+ red r7
+ prn #3
+ .string "ab"
+ .string "ab"
+ m1
+mcr m2
+endmcr
+; comment
+; comment
+L0: clr r6
+ .space 2
+ .fill 3, 7
+ m2
+ inc r1
+L1: inc r1
+ not r5
+mcr m3
+ add #2, r4
+endmcr
+ inc r2
+ m0
+L2: .space 2
+ .space 2
+ m1
+ cmp r3, #-1
+L3: lea S0, r3
+ add #2, r4
+ .fill 3, 7
+ clr r6
+ add #2, r4
+mcr m4
+endmcr
+; comment
+ inc r2
+ .data 1, 2
+ m1
+ m3
+; comment
+ hlt
@@ -0,0 +1,53 @@
+S0: .data 5
+ prn #3
+ .data 1, 2
+ .space 2
+ cmp r3, #-1
+ inc r2
+ red r7
+ cmp r3, #-1
+ sub r1, r2
+mcr m0
+endmcr
+ m0
+ m0
+ add #2, r4
+ clr r6
+ clr r6
+ prn #3
+mcr m1
+ red r7
+endmcr
+ m1
+ .space 2
+ clr r6
+ clr r6
+ .data 1, 2
+mcr m2
+ lea S0, r3
+ ;c
+endmcr
+ .string "ab"
+ lea S0, r3
+ cmp r3, #-1
+ add #2, r4
+mcr m3
+ mov r1, r2
+ not r5
+ mov r1, r2
+endmcr
+; comment
+ m2
+
+; comment
+mcr m4
+ lea S0, r3
+ inc r1
+ clr r6
+ 
+endmcr
+ sub r1, r2
+ sub r1, r2
+mcr m5
+endmcr
+ hlt
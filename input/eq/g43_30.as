@@ -0,0 +1,69 @@
+S0: .data 5
+L0: lea S0, r3
+ cmp r3, #-1
+mcr m0
+ ;c
+ prn #3
+ mov r1, r2
+endmcr
+ inc r2
+L1: cmp r3, #-1
+ .space 2
+ clr r6
+ sub r1, r2
+; comment
+ m0
+L2: lea S0, r3
+ m0
+L3: add #2, r4
+ m0
+ m0
+ m0
+mcr m1
+endmcr
+; comment
+L4: add #2, r4
+ red r7
+ .space 2
+ m1
+mcr m2
+endmcr
+ inc r2
+ inc r2
+ add #2, r4
+L5: .data 1, 2
+ m0
+ clr r6
+ red r7
+
+ lea S0, r3
+ .data 1, 2
+; comment
+ .data 1, 2
+ inc r2
+ m0
+ add #2, r4
+ m2
+ m1
+ lea S0, r3
+ m1
+ .space 2
+mcr m3
+ ;c
+ inc r1
+ prn #3
+endmcr
+ red r7
+; comment
+
+ prn #3
+; comment
+mcr m4
+ inc r1
+ cmp r3, #-1
+endmcr
+; comment
+L6: inc r1
+
+ clr r6
+ hlt
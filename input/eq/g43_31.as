@@ -0,0 +1,31 @@
+S0: .data 5
+ inc r2
+ prn #3
+; comment
+mcr m0
+ 
+endmcr
+ prn #3
+mcr m1
+endmcr
+ m1
+ cmp r3, #-1
+mcr m2
+endmcr
+ clr r6
+ m1
+; comment
+ cmp r3, #-1
+; comment
+ inc r1
+L0: not r5
+ m1
+mcr m3
+ red r7
+ ;c
+ cmp r3, #-1
+ cmp r3, #-1
+endmcr
+ .string "ab"
+ m1
+ hlt
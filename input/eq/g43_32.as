@@ -0,0 +1,49 @@
+S0: .data 5
+ prn #3
+L0: red r7
+mcr m0
+ sub r1, r2
+ not r5
+endmcr
+ sub r1, r2
+ red r7
+mcr m1
+ sub r1, r2
+endmcr
+mcr m2
+ add #2, r4
+endmcr
+ cmp r3, #-1
+ m0
+ mov r1, r2
+
+
+ sub r1, r2
+ m1
+L1: red r7
+ .string "ab"
+ mov r1, r2
+ cmp r3, #-1
+mcr m3
+ add #2, r4
+ clr r6
+ 
+endmcr
+mcr m4
+ inc r1
+ prn #3
+ red r7
+endmcr
+ m0
+ prn #3
+mcr m5
+ prn #3
+ clr r6
+endmcr
+mcr m6
+ inc r1
+ red r7
+ inc r1
+ sub r1, r2
+endmcr
+ hlt
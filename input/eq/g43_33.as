@@ -0,0 +1,80 @@
+S0: .data 5
+; comment
+; comment
+ red r7
+L0: sub r1, r2
+ lea S0, r3
+; comment
+ red r7
+L1: .data 1, 2
+; comment
+ inc r1
+ .data 1, 2
+ not r5
+ mov r1, r2
+; comment
+ cmp r3, #-1
+mcr m0
+ mov r1, r2
+ ;c
+endmcr
+ m0
+L2: not r5
+ add #2, r4
+; comment
+ inc r1
+ .data 1, 2
+ m0
+mcr m1
+ inc r1
+ inc r1
+endmcr
+; comment
+ m0
+ clr r6
+ inc r2
+; comment
+ .fill 3, 7
+ inc r2
+mcr m2
+ clr r6
+ not r5
+ mov r1, r2
+endmcr
+L3: cmp r3, #-1
+ red r7
+ .space 2
+ m1
+L4: red r7
+mcr m3
+ 
+ add #2, r4
+ red r7
+ add #2, r4
+endmcr
+
+ add #2, r4
+ .fill 3, 7
+mcr m4
+ not r5
+ not r5
+ prn #3
+endmcr
+mcr m5
+ 
+endmcr
+ m2
+ prn #3
+ .space 2
+ not r5
+ .fill 3, 7
+ inc r1
+L5: .string "ab"
+ inc r2
+ .space 2
+ cmp r3, #-1
+ m4
+mcr m6
+endmcr
+ sub r1, r2
+ hlt
@@ -0,0 +1,61 @@
+S0: .data 5
+; comment
+mcr m0
+ inc r1
+endmcr
+ not r5
+mcr m1
+ not r5
+ mov r1, r2
+endmcr
+L0: .space 2
+ m0
+ .fill 3, 7
+ not r5
+L1: .space 2
+; comment
+ m1
+ m1
+ m1
+L2: lea S0, r3
+ sub r1, r2
+ m0
+L3: .string "ab"
+
+; comment
+ cmp r3, #-1
+; comment
+ not r5
+ sub r1, r2
+ clr r6
+; comment
+
+ m0
+ m0
+L4: sub r1, r2
+ clr r6
+; comment
+ .fill 3, 7
+ .fill 3, 7
+ .space 2
+mcr m2
+endmcr
+ m1
+ m0
+ not r5
+ inc r1
+ add #2, r4
+ prn #3
+ mov r1, r2
+L5: .fill 3, 7
+L6: .fill 3, 7
+ .data 1, 2
+L7: prn #3
+ m0
+ add #2, r4
+
+ sub r1, r2
+ lea S0, r3
+ inc r1
+ inc r2
+ hlt
@@ -0,0 +1,83 @@
+S0: .data 5
+; comment
+; comment
+; comment
+; comment
+
+; comment
+mcr m0
+ add #2, r4
+ ;c
+ not r5
+ 
+endmcr
+L0: .fill 3, 7
+mcr m1
+ inc r1
+ mov r1, r2
+ 
+ red r7
+endmcr
+; comment
+mcr m2
+ inc r1
+ inc r1
+ cmp r3, #-1
+endmcr
+L1: mov r1, r2
+ m0
+ inc r2
+; comment
+ m2
+mcr m3
+ sub r1, r2
+endmcr
+ red r7
+ inc r2
+; comment
+; comment
+ m3
+L2: .fill 3, 7
+ mov r1, r2
+L3: mov r1, r2
+; comment
+ m3
+ add #2, r4
+ cmp r3, #-1
+ inc r1
+mcr m4
+endmcr
+L4: prn #3
+ red r7
+mcr m5
+ sub r1, r2
+ prn #3
+ sub r1, r2
+endmcr
+ m3
+L5: .fill 3, 7
+; comment
+ lea S0, r3
+ not r5
+ m5
+mcr m6
+ mov r1, r2
+ lea S0, r3
+ lea S0, r3
+ not r5
+endmcr
+ .data 1, 2
+; comment
+
+L6: red r7
+ .fill 3, 7
+L7: sub r1, r2
+
+ m6
+ mov r1, r2
+ clr r6
+L8: inc r1
+L9: .string "ab"
+ m6
+ mov r1, r2
+ hlt
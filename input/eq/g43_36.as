@@ -0,0 +1,62 @@
+S0: .data 5
+mcr m0
+endmcr
+ .fill 3, 7
+mcr m1
+ ;c
+ prn #3
+ cmp r3, #-1
+ add #2, r4
+endmcr
+ clr r6
+ m0
+ .space 2
+; comment
+ clr r6
+; comment
+ m1
+ cmp r3, #-1
+ m1
+L0: sub r1, r2
+ clr r6
+ inc r2
+ cmp r3, #-1
+; comment
+ m1
+ .string "ab"
+L1: lea S0, r3
+ red r7
+ m0
+ add #2, r4
+ m0
+ not r5
+ inc r1
+ m0
+ .string "ab"
+mcr m2
+ cmp r3, #-1
+ cmp r3, #-1
+ 
+endmcr
+ prn #3
+ prn #3
+mcr m3
+ add #2, r4
+ add #2, r4
+endmcr
+mcr m4
+ 
+ sub r1, r2
+endmcr
+ inc r1
+ inc r2
+mcr m5
+endmcr
+ m3
+ m2
+L2: cmp r3, #-1
+
+mcr m6
+ mov r1, r2
+endmcr
+ hlt
@@ -0,0 +1,87 @@
+S0: .data 5
+ lea S0, r3
+ .data 1, 2
+ not r5
+ .data 1, 2
+ clr r6
+
+; comment
+L0: .space 2
+; comment
+ not r5
+
+ not r5
+ inc r1
+ sub r1, r2
+mcr m0
+ not r5
+ mov r1, r2
+ 
+ lea S0, r3
+endmcr
+ m0
+; comment
+ m0
+ cmp r3, #-1
+ m0
+ add #2, r4
+ m0
+ inc r2
+ m0
+
+mcr m1
+endmcr
+ m0
+mcr m2
+ not r5
+endmcr
+; comment
+mcr m3
+ mov r1, r2
+endmcr
+ .data 1, 2
+ m2
+ inc r2
+ sub r1, r2
+ m0
+ clr r6
+L1: .data 1, 2
+ m0
+ m1
+; comment
+ m1
+mcr m4
+ inc r1
+ cmp r3, #-1
+endmcr
+ .string "ab"
+ red r7
+L2: lea S0, r3
+ .data 1, 2
+ .space 2
+mcr m5
+ lea S0, r3
+ sub r1, r2
+endmcr
+ add #2, r4
+
+ m4
+; comment
+ m5
+ mov r1, r2
+ inc r2
+mcr m6
+ lea S0, r3
+ lea S0, r3
+ sub r1, r2
+endmcr
+ .data 1, 2
+ add #2, r4
+mcr m7
+ inc r1
+endmcr
+ not r5
+ mov r1, r2
+ prn #3
+L3: cmp r3, #-1
+ hlt
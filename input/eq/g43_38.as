@@ -0,0 +1,97 @@
+S0: .data 5
+
+L0: mov r1, r2
+L1: not r5
+ lea S0, r3
+; comment
+; comment
+ red r7
+ clr r6
+ sub r1, r2
+
+; comment
+; comment
+ .data 1, 2
+L2: sub r1, r2
+ inc r2
+; comment
+L3: red r7
+ add #2, r4
+; comment
+ red r7
+; comment
+
+ prn #3
+mcr m0
+ 
+ lea S0, r3
+ cmp r3, #-1
+ add #2, r4
+endmcr
+L4: inc r1
+ cmp r3, #-1
+ inc r1
+ .space 2
+ not r5
+ inc r1
+ m0
+L5: mov r1, r2
+ sub r1, r2
+mcr m1
+ prn #3
+ sub r1, r2
+ lea S0, r3
+endmcr
+ .string "ab"
+mcr m2
+ ;c
+ 
+endmcr
+mcr m3
+endmcr
+ inc r2
+ cmp r3, #-1
+ m1
+mcr m4
+ 
+ cmp r3, #-1
+endmcr
+; comment
+mcr m5
+ mov r1, r2
+ sub r1, r2
+ 
+ red r7
+endmcr
+ add #2, r4
+mcr m6
+ add #2, r4
+ clr r6
+ ;c
+endmcr
+ inc r2
+ m1
+; comment
+ lea S0, r3
+L6: prn #3
+ cmp r3, #-1
+ m1
+ mov r1, r2
+
+mcr m7
+ clr r6
+ red r7
+ ;c
+ cmp r3, #-1
+endmcr
+ cmp r3, #-1
+; comment
+mcr m8
+ lea S0, r3
+ add #2, r4
+ not r5
+ mov r1, r2
+endmcr
+L7: inc r1
+ clr r6
+ hlt
@@ -0,0 +1,50 @@
+S0: .data 5
+; comment
+mcr m0
+ clr r6
+endmcr
+ inc r1
+ m0
+L0: .space 2
+L1: .space 2
+mcr m1
+ not r5
+ clr r6
+ mov r1, r2
+endmcr
+ sub r1, r2
+ m0
+ inc r2
+ m1
+ .string "ab"
+mcr m2
+ lea S0, r3
+endmcr
+ red r7
+ .fill 3, 7
+ add #2, r4
+; comment
+ m1
+mcr m3
+ ;c
+ add #2, r4
+endmcr
+ m0
+; comment
+ .space 2
+ mov r1, r2
+mcr m4
+ inc r1
+ lea S0, r3
+ lea S0, r3
+endmcr
+ clr r6
+ .string "ab"
+L2: cmp r3, #-1
+
+ m1
+ .string "ab"
+ lea S0, r3
+ m4
+ m1
+ hlt
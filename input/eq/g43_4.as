@@ -0,0 +1,58 @@
+S0: .data 5
+; comment
+L0: red r7
+mcr m0
+ sub r1, r2
+ add #2, r4
+ inc r1
+endmcr
+ m0
+ m0
+ add #2, r4
+ .space 2
+ m0
+ m0
+ m0
+mcr m1
+ not r5
+ ;c
+ clr r6
+ sub r1, r2
+endmcr
+ m0
+ inc r2
+mcr m2
+ add #2, r4
+ inc r1
+ add #2, r4
+ lea S0, r3
+endmcr
+ add #2, r4
+ clr r6
+ m1
+ m1
+ m0
+mcr m3
+ ;c
+ add #2, r4
+ sub r1, r2
+endmcr
+ red r7
+ m1
+mcr m4
+ ;c
+endmcr
+L1: add #2, r4
+
+ .data 1, 2
+ mov r1, r2
+ add #2, r4
+L2: cmp r3, #-1
+ add #2, r4
+mcr m5
+endmcr
+ add #2, r4
+ inc r1
+ m1
+ clr r6
+ hlt
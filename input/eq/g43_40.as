@@ -0,0 +1,80 @@
+S0: .data 5
+L0: sub r1, r2
+; comment
+ .data 1, 2
+ add #2, r4
+
+mcr m0
+ inc r1
+endmcr
+ lea S0, r3
+L1: inc r1
+ mov r1, r2
+ m0
+; comment
+mcr m1
+ 
+ not r5
+endmcr
+ m0
+ m1
+ add #2, r4
+ lea S0, r3
+
+mcr m2
+ cmp r3, #-1
+ lea S0, r3
+ lea S0, r3
+ inc r1
+endmcr
+mcr m3
+ add #2, r4
+ mov r1, r2
+ cmp r3, #-1
+ cmp r3, #-1
+endmcr
+ inc r2
+mcr m4
+ lea S0, r3
+ red r7
+endmcr
+ m4
+ .fill 3, 7
+L2: .fill 3, 7
+; comment
+ .string "ab"
+L3: clr r6
+mcr m5
+ sub r1, r2
+ cmp r3, #-1
+ cmp r3, #-1
+endmcr
+
+L4: cmp r3, #-1
+ m2
+ prn #3
+ m1
+mcr m6
+ inc r1
+endmcr
+ cmp r3, #-1
+ red r7
+ inc r1
+L5: .fill 3, 7
+ m6
+ m6
+ add #2, r4
+ .fill 3, 7
+ inc r1
+ sub r1, r2
+ inc r2
+L6: sub r1, r2
+ lea S0, r3
+ add #2, r4
+mcr m7
+ sub r1, r2
+ sub r1, r2
+ lea S0, r3
+ inc r1
+endmcr
+ hlt
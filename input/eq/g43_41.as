@@ -0,0 +1,64 @@
+S0: .data 5
+; comment
+ clr r6
+ sub r1, r2
+ .fill 3, 7
+ .data 1, 2
+mcr m0
+ prn #3
+endmcr
+L0: not r5
+ lea S0, r3
+mcr m1
+ inc r1
+ clr r6
+ add #2, r4
+ 
+endmcr
+ m1
+ prn #3
+mcr m2
+endmcr
+ .string "ab"
+ m1
+ m2
+mcr m3
+ prn #3
+ clr r6
+ inc r1
+ add #2, r4
+endmcr
+; comment
+mcr m4
+endmcr
+; comment
+ red r7
+ m0
+ m3
+ clr r6
+L1: sub r1, r2
+mcr m5
+ not r5
+ prn #3
+ prn #3
+endmcr
+L2: .string "ab"
+ .space 2
+ .data 1, 2
+ clr r6
+ lea S0, r3
+ mov r1, r2
+ m3
+; comment
+
+ .fill 3, 7
+ add #2, r4
+ cmp r3, #-1
+ not r5
+ .fill 3, 7
+L3: .string "ab"
+L4: cmp r3, #-1
+ m5
+ m1
+L5: lea S0, r3
+ hlt
@@ -0,0 +1,85 @@
+S0: .data 5
+mcr m0
+ cmp r3, #-1
+ cmp r3, #-1
+endmcr
+ m0
+L0: sub r1, r2
+
+mcr m1
+ cmp r3, #-1
+endmcr
+ inc r1
+ .string "ab"
+ m1
+ inc r1
+ m1
+ m0
+ m1
+mcr m2
+ mov r1, r2
+ not r5
+ not r5
+endmcr
+L1: .fill 3, 7
+
+ m1
+mcr m3
+ ;c
+ lea S0, r3
+endmcr
+ not r5
+ inc r1
+ mov r1, r2
+ clr r6
+L2: not r5
+; comment
+ .string "ab"
+ lea S0, r3
+L3: cmp r3, #-1
+; comment
+ .data 1, 2
+ m2
+L4: .fill 3, 7
+ .fill 3, 7
+ m1
+ lea S0, r3
+ m3
+; comment
+L5: red r7
+ m2
+ clr r6
+; comment
+ m1
+ mov r1, r2
+ prn #3
+ clr r6
+; comment
+ red r7
+ .space 2
+ mov r1, r2
+ add #2, r4
+ m2
+
+
+ .string "ab"
+ prn #3
+mcr m4
+ ;c
+ sub r1, r2
+endmcr
+ prn #3
+ m4
+ lea S0, r3
+mcr m5
+ add #2, r4
+ cmp r3, #-1
+endmcr
+mcr m6
+ mov r1, r2
+ mov r1, r2
+ 
+ red r7
+endmcr
+ .fill 3, 7
+ hlt
@@ -0,0 +1,34 @@
+S0: .data 5
+; comment
+ red r7
+ mov r1, r2
+ inc r2
+mcr m0
+ lea S0, r3
+ not r5
+ lea S0, r3
+endmcr
+ sub r1, r2
+L0: clr r6
+L1: .space 2
+ m0
+L2: red r7
+; comment
+ add #2, r4
+; comment
+mcr m1
+endmcr
+ m0
+ add #2, r4
+mcr m2
+ mov r1, r2
+ lea S0, r3
+ ;c
+ ;c
+endmcr
+ mov r1, r2
+
+ .string "ab"
+ .string "ab"
+ m0
+ hlt
@@ -0,0 +1,58 @@
+S0: .data 5
+ .string "ab"
+; comment
+; comment
+mcr m0
+endmcr
+L0: mov r1, r2
+ add #2, r4
+; comment
+; comment
+ not r5
+ m0
+ mov r1, r2
+ add #2, r4
+mcr m1
+ inc r1
+ not r5
+endmcr
+; comment
+ inc r2
+L1: cmp r3, #-1
+L2: .fill 3, 7
+ .space 2
+ .string "ab"
+ .data 1, 2
+; comment
+ inc r2
+
+ prn #3
+
+ .data 1, 2
+ .space 2
+ m0
+ m0
+ lea S0, r3
+ not r5
+; comment
+; comment
+mcr m2
+ lea S0, r3
+endmcr
+ clr r6
+L3: red r7
+ m2
+ inc r1
+ m2
+mcr m3
+endmcr
+mcr m4
+ prn #3
+ 
+endmcr
+L4: .data 1, 2
+L5: .space 2
+ inc r2
+ mov r1, r2
+ .fill 3, 7
+ hlt
@@ -0,0 +1,50 @@
+S0: .data 5
+; comment
+; comment
+; comment
+mcr m0
+ inc r1
+ mov r1, r2
+ add #2, r4
+endmcr
+ add #2, r4
+L0: lea S0, r3
+ m0
+ m0
+mcr m1
+ prn #3
+ 
+ inc r1
+endmcr
+ prn #3
+; comment
+L1: not r5
+mcr m2
+ not r5
+ clr r6
+endmcr
+ .string "ab"
+ .data 1, 2
+ .data 1, 2
+ red r7
+L2: not r5
+ cmp r3, #-1
+ add #2, r4
+; comment
+; comment
+L3: sub r1, r2
+; comment
+ lea S0, r3
+ sub r1, r2
+ add #2, r4
+ m0
+ inc r1
+ inc r1
+ not r5
+
+ m1
+ .data 1, 2
+ cmp r3, #-1
+ m0
+ add #2, r4
+ hlt
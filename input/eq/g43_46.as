@@ -0,0 +1,107 @@
+S0: .data 5
+mcr m0
+endmcr
+ .space 2
+ prn #3
+L0: inc r1
+ .data 1, 2
+ prn #3
+ m0
+L1: .fill 3, 7
+ red r7
+ inc r2
+ red r7
+ mov r1, r2
+ m0
+L2: add #2, r4
+ mov r1, r2
+ inc r2
+; comment
+; comment
+; comment
+L3: .space 2
+ m0
+mcr m1
+ mov r1, r2
+ not r5
+endmcr
+ not r5
+ .data 1, 2
+ m0
+mcr m2
+endmcr
+L4: not r5
+mcr m3
+ add #2, r4
+endmcr
+; comment
+ inc r1
+ cmp r3, #-1
+; comment
+mcr m4
+ red r7
+ ;c
+ prn #3
+endmcr
+ m3
+ .space 2
+ red r7
+ .fill 3, 7
+ m1
+; comment
+mcr m5
+ mov r1, r2
+endmcr
+; comment
+ m5
+ .space 2
+ inc r1
+ m3
+ m4
+mcr m6
+endmcr
+ not r5
+ .space 2
+ m0
+ .string "ab"
+ inc r2
+mcr m7
+ add #2, r4
+ ;c
+endmcr
+
+ inc r1
+mcr m8
+ lea S0, r3
+ 
+ cmp r3, #-1
+ inc r1
+endmcr
+; comment
+ m0
+mcr m9
+ 
+ ;c
+ 
+ clr r6
+endmcr
+mcr m10
+ sub r1, r2
+endmcr
+ m5
+ inc r1
+ m0
+ m2
+ add #2, r4
+ m1
+ m3
+ m4
+ m5
+ .space 2
+ mov r1, r2
+ inc r2
+ m3
+ clr r6
+ sub r1, r2
+ lea S0, r3
+ hlt
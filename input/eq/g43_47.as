@@ -0,0 +1,69 @@
+S0: .data 5
+mcr m0
+ red r7
+ lea S0, r3
+ not r5
+ add #2, r4
+endmcr
+ clr r6
+L0: .data 1, 2
+mcr m1
+ red r7
+ 
+endmcr
+ .space 2
+ cmp r3, #-1
+ red r7
+mcr m2
+ 
+ 
+endmcr
+; comment
+ m2
+ cmp r3, #-1
+L1: inc r1
+mcr m3
+ clr r6
+ sub r1, r2
+ sub r1, r2
+ add #2, r4
+endmcr
+mcr m4
+ 
+endmcr
+ cmp r3, #-1
+mcr m5
+ lea S0, r3
+ not r5
+ ;c
+endmcr
+ .fill 3, 7
+ add #2, r4
+ red r7
+ add #2, r4
+ cmp r3, #-1
+ cmp r3, #-1
+ m4
+L2: sub r1, r2
+mcr m6
+ sub r1, r2
+endmcr
+L3: .fill 3, 7
+ m6
+ red r7
+
+ inc r1
+ lea S0, r3
+ red r7
+ not r5
+ cmp r3, #-1
+ .space 2
+ m1
+ m1
+ lea S0, r3
+; comment
+ m0
+L4: clr r6
+mcr m7
+endmcr
+ hlt
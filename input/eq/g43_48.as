@@ -0,0 +1,73 @@
+S0: .data 5
+; comment
+ sub r1, r2
+ cmp r3, #-1
+
+; comment
+L0: .data 1, 2
+ cmp r3, #-1
+L1: sub r1, r2
+; comment
+mcr m0
+endmcr
+ m0
+ inc r1
+ m0
+ mov r1, r2
+ m0
+ lea S0, r3
+ not r5
+ m0
+ .space 2
+ m0
+mcr m1
+ add #2, r4
+ lea S0, r3
+ red r7
+ 
+endmcr
+mcr m2
+endmcr
+ m1
+ inc r2
+ .fill 3, 7
+ .fill 3, 7
+; comment
+ m2
+ .data 1, 2
+
+ m1
+ m2
+ cmp r3, #-1
+ prn #3
+ m2
+ .string "ab"
+ sub r1, r2
+; comment
+
+L2: .space 2
+
+ m2
+mcr m3
+endmcr
+ .data 1, 2
+; comment
+mcr m4
+ red r7
+ sub r1, r2
+ red r7
+ mov r1, r2
+endmcr
+L3: lea S0, r3
+ m0
+ .data 1, 2
+ m1
+; comment
+; comment
+ inc r1
+mcr m5
+ clr r6
+ ;c
+endmcr
+
+ hlt
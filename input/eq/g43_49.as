@@ -0,0 +1,31 @@
+S0: .data 5
+; comment
+ not r5
+ inc r1
+L0: add #2, r4
+ .data 1, 2
+; comment
+ add #2, r4
+; comment
+; comment
+; comment
+
+; comment
+ add #2, r4
+ lea S0, r3
+ .string "ab"
+ .data 1, 2
+mcr m0
+ sub r1, r2
+ lea S0, r3
+endmcr
+ prn #3
+ m0
+ lea S0, r3
+ .fill 3, 7
+ .fill 3, 7
+mcr m1
+ inc r1
+endmcr
+ m0
+ hlt
@@ -0,0 +1,75 @@
+S0: .data 5
+; comment
+; comment
+ .space 2
+ inc r1
+ cmp r3, #-1
+ mov r1, r2
+ clr r6
+ inc r1
+; comment
+; comment
+L0: clr r6
+ prn #3
+
+; comment
+ inc r1
+; comment
+L1: .space 2
+; comment
+; comment
+ .data 1, 2
+L2: .string "ab"
+ clr r6
+; comment
+; comment
+; comment
+mcr m0
+ lea S0, r3
+ lea S0, r3
+endmcr
+mcr m1
+ mov r1, r2
+ add #2, r4
+endmcr
+; comment
+ m1
+ m1
+ inc r1
+ .string "ab"
+; comment
+ clr r6
+ inc r1
+ lea S0, r3
+ m0
+ red r7
+; comment
+ .fill 3, 7
+ .fill 3, 7
+ inc r1
+ cmp r3, #-1
+ prn #3
+L3: sub r1, r2
+L4: add #2, r4
+mcr m2
+ 
+endmcr
+L5: red r7
+mcr m3
+ sub r1, r2
+ clr r6
+ inc r1
+ cmp r3, #-1
+endmcr
+ not r5
+
+
+mcr m4
+endmcr
+ not r5
+ m4
+ .data 1, 2
+; comment
+ m2
+ m3
+ hlt
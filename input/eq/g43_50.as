@@ -0,0 +1,74 @@
+S0: .data 5
+ not r5
+; comment
+ inc r2
+ mov r1, r2
+; comment
+ prn #3
+mcr m0
+ not r5
+ cmp r3, #-1
+endmcr
+ m0
+ lea S0, r3
+mcr m1
+endmcr
+ .space 2
+ .space 2
+ m1
+ clr r6
+mcr m2
+ add #2, r4
+ 
+ lea S0, r3
+endmcr
+
+ m0
+ mov r1, r2
+ .string "ab"
+mcr m3
+ red r7
+ clr r6
+ sub r1, r2
+ sub r1, r2
+endmcr
+ prn #3
+L0: add #2, r4
+; comment
+ inc r1
+ .data 1, 2
+ .space 2
+L1: cmp r3, #-1
+L2: .space 2
+; comment
+ m0
+ inc r1
+mcr m4
+ ;c
+endmcr
+ sub r1, r2
+ .fill 3, 7
+ inc r2
+; comment
+; comment
+L3: inc r1
+L4: lea S0, r3
+ m2
+ .data 1, 2
+ inc r2
+ m3
+ m0
+L5: inc r1
+mcr m5
+ inc r1
+endmcr
+ m5
+L6: not r5
+ cmp r3, #-1
+ add #2, r4
+mcr m6
+ clr r6
+ clr r6
+ not r5
+endmcr
+ hlt
@@ -0,0 +1,50 @@
+S0: .data 5
+L0: sub r1, r2
+ cmp r3, #-1
+; comment
+ sub r1, r2
+ sub r1, r2
+; comment
+ clr r6
+; comment
+L1: .space 2
+ inc r1
+ prn #3
+; comment
+
+ .space 2
+; comment
+ red r7
+; comment
+mcr m0
+endmcr
+ .space 2
+ .fill 3, 7
+ m0
+ .data 1, 2
+; comment
+ m0
+mcr m1
+ prn #3
+ lea S0, r3
+ not r5
+ red r7
+endmcr
+ inc r2
+ red r7
+ .space 2
+mcr m2
+ sub r1, r2
+ ;c
+ sub r1, r2
+endmcr
+mcr m3
+ sub r1, r2
+ red r7
+endmcr
+ inc r1
+ lea S0, r3
+; comment
+ add #2, r4
+ lea S0, r3
+ hlt
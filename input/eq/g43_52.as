@@ -0,0 +1,51 @@
+S0: .data 5
+mcr m0
+ red r7
+ not r5
+ clr r6
+ inc r1
+endmcr
+ prn #3
+L0: .space 2
+ m0
+mcr m1
+ red r7
+ inc r1
+ cmp r3, #-1
+endmcr
+mcr m2
+ red r7
+endmcr
+ m1
+ inc r2
+ inc r2
+ m0
+ clr r6
+ .data 1, 2
+; comment
+ m1
+ sub r1, r2
+ m1
+ m2
+
+ .string "ab"
+mcr m3
+endmcr
+ m3
+
+ m0
+L1: mov r1, r2
+ add #2, r4
+ mov r1, r2
+ .fill 3, 7
+ .space 2
+ red r7
+ m1
+ .space 2
+ clr r6
+ mov r1, r2
+ inc r1
+ not r5
+; comment
+ m1
+ hlt
@@ -0,0 +1,74 @@
+S0: .data 5
+ cmp r3, #-1
+ .string "ab"
+L0: .string "ab"
+ prn #3
+; comment
+; comment
+L1: inc r1
+; comment
+
+; comment
+; comment
+ .data 1, 2
+ clr r6
+mcr m0
+ prn #3
+ mov r1, r2
+endmcr
+ sub r1, r2
+
+ m0
+ red r7
+ inc r2
+ lea S0, r3
+ m0
+mcr m1
+endmcr
+ inc r1
+ sub r1, r2
+ m1
+; comment
+L2: prn #3
+ .data 1, 2
+ m0
+L3: not r5
+ m1
+mcr m2
+ mov r1, r2
+ clr r6
+ clr r6
+endmcr
+mcr m3
+ ;c
+endmcr
+; comment
+ lea S0, r3
+ m1
+ .space 2
+ inc r2
+ m1
+ prn #3
+ m3
+ m3
+L4: .space 2
+ mov r1, r2
+ clr r6
+ m2
+ red r7
+ .data 1, 2
+ prn #3
+L5: not r5
+ clr r6
+ .fill 3, 7
+ red r7
+ .data 1, 2
+ lea S0, r3
+mcr m4
+ clr r6
+ sub r1, r2
+endmcr
+ sub r1, r2
+ m2
+ m3
+ hlt
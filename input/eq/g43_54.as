@@ -0,0 +1,104 @@
+S0: .data 5
+ red r7
+ inc r2
+ clr r6
+; comment
+ cmp r3, #-1
+mcr m0
+ red r7
+ lea S0, r3
+ mov r1, r2
+ sub r1, r2
+endmcr
+ m0
+ add #2, r4
+mcr m1
+ add #2, r4
+ red r7
+endmcr
+ inc r1
+mcr m2
+ inc r1
+ cmp r3, #-1
+endmcr
+ prn #3
+ prn #3
+ inc r1
+
+ red r7
+ inc r1
+ .space 2
+; comment
+
+ not r5
+ red r7
+ add #2, r4
+ inc r2
+ m0
+ red r7
+ inc r2
+ m1
+ sub r1, r2
+ m0
+ lea S0, r3
+; comment
+; comment
+
+ m1
+ lea S0, r3
+ m2
+ m1
+L0: .data 1, 2
+ m2
+ .fill 3, 7
+ .space 2
+ mov r1, r2
+ cmp r3, #-1
+ m2
+ m1
+ m0
+ not r5
+ m1
+ m0
+ .space 2
+mcr m3
+ add #2, r4
+endmcr
+ red r7
+
+L1: cmp r3, #-1
+ red r7
+ m3
+
+ inc r1
+ cmp r3, #-1
+; comment
+ cmp r3, #-1
+; comment
+
+ inc r1
+ m1
+; comment
+ inc r1
+ .fill 3, 7
+ inc r2
+ add #2, r4
+mcr m4
+ ;c
+endmcr
+mcr m5
+ ;c
+ cmp r3, #-1
+ red r7
+ inc r1
+endmcr
+ not r5
+mcr m6
+ 
+ sub r1, r2
+ sub r1, r2
+endmcr
+ m2
+
+; comment
+ hlt
@@ -0,0 +1,43 @@
+S0: .data 5
+L0: cmp r3, #-1
+L1: .space 2
+; comment
+mcr m0
+ sub r1, r2
+ clr r6
+ clr r6
+endmcr
+ not r5
+
+L2: .data 1, 2
+ m0
+ inc r1
+ inc r1
+mcr m1
+ cmp r3, #-1
+ cmp r3, #-1
+ cmp r3, #-1
+endmcr
+; comment
+ m0
+mcr m2
+ add #2, r4
+ not r5
+ not r5
+endmcr
+ cmp r3, #-1
+ cmp r3, #-1
+ m0
+ m0
+ .string "ab"
+ inc r2
+ mov r1, r2
+ mov r1, r2
+ .string "ab"
+ m0
+mcr m3
+ red r7
+ red r7
+ red r7
+endmcr
+ hlt
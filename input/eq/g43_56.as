@@ -0,0 +1,105 @@
+S0: .data 5
+ red r7
+; comment
+ clr r6
+mcr m0
+ mov r1, r2
+ not r5
+ ;c
+ add #2, r4
+endmcr
+L0: cmp r3, #-1
+ inc r1
+ clr r6
+ clr r6
+ m0
+L1: red r7
+; comment
+ mov r1, r2
+L2: prn #3
+ m0
+L3: not r5
+ lea S0, r3
+L4: .data 1, 2
+ lea S0, r3
+ red r7
+ m0
+L5: .data 1, 2
+ prn #3
+L6: prn #3
+ m0
+ inc r2
+ inc r1
+ m0
+L7: mov r1, r2
+ .string "ab"
+ clr r6
+mcr m1
+ ;c
+ 
+ sub r1, r2
+endmcr
+ m0
+mcr m2
+ prn #3
+ prn #3
+ ;c
+endmcr
+ .fill 3, 7
+ .string "ab"
+mcr m3
+ add #2, r4
+ mov r1, r2
+ sub r1, r2
+endmcr
+ m2
+ prn #3
+ lea S0, r3
+ clr r6
+ cmp r3, #-1
+mcr m4
+ prn #3
+ sub r1, r2
+endmcr
+ m4
+mcr m5
+ clr r6
+endmcr
+ clr r6
+ m1
+L8: add #2, r4
+L9: .data 1, 2
+L10: mov r1, r2
+ sub r1, r2
+L11: .fill 3, 7
+ .data 1, 2
+ clr r6
+ .fill 3, 7
+ m3
+ not r5
+ mov r1, r2
+ m4
+; comment
+ m4
+ inc r1
+
+
+ m4
+ inc r1
+ m3
+ sub r1, r2
+ .space 2
+mcr m6
+ cmp r3, #-1
+ not r5
+ inc r1
+ ;c
+endmcr
+mcr m7
+ clr r6
+endmcr
+L12: lea S0, r3
+ prn #3
+ m7
+ m2
+ hlt
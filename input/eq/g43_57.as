@@ -0,0 +1,36 @@
+S0: .data 5
+; comment
+ cmp r3, #-1
+ add #2, r4
+
+L0: clr r6
+ sub r1, r2
+; comment
+; comment
+mcr m0
+ ;c
+ red r7
+ sub r1, r2
+ add #2, r4
+endmcr
+L1: lea S0, r3
+ m0
+ prn #3
+ sub r1, r2
+ not r5
+ cmp r3, #-1
+ clr r6
+; comment
+mcr m1
+ red r7
+ inc r1
+ clr r6
+endmcr
+mcr m2
+ red r7
+ sub r1, r2
+endmcr
+ .string "ab"
+L2: add #2, r4
+ m1
+ hlt
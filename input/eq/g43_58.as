@@ -0,0 +1,83 @@
+S0: .data 5
+; comment
+L0: cmp r3, #-1
+
+; comment
+; comment
+ red r7
+; comment
+L1: mov r1, r2
+; comment
+ red r7
+; comment
+; comment
+mcr m0
+ add #2, r4
+endmcr
+mcr m1
+ add #2, r4
+ prn #3
+endmcr
+ .string "ab"
+L2: mov r1, r2
+
+ m0
+mcr m2
+ ;c
+ 
+endmcr
+mcr m3
+ ;c
+ lea S0, r3
+ add #2, r4
+ lea S0, r3
+endmcr
+ not r5
+ m2
+ m1
+ red r7
+mcr m4
+endmcr
+ inc r2
+ m3
+ inc r2
+ prn #3
+L3: mov r1, r2
+ inc r1
+mcr m5
+ mov r1, r2
+ mov r1, r2
+ inc r1
+ red r7
+endmcr
+mcr m6
+ ;c
+ red r7
+endmcr
+ lea S0, r3
+ .space 2
+L4: .fill 3, 7
+ m1
+ not r5
+ .fill 3, 7
+ m6
+ lea S0, r3
+mcr m7
+ lea S0, r3
+endmcr
+ inc r1
+; comment
+L5: red r7
+ inc r1
+; comment
+ .fill 3, 7
+ .fill 3, 7
+ m3
+ prn #3
+L6: .fill 3, 7
+L7: .string "ab"
+L8: cmp r3, #-1
+; comment
+ m7
+ .space 2
+ hlt
@@ -0,0 +1,56 @@
+S0: .data 5
+mcr m0
+ inc r1
+ prn #3
+ add #2, r4
+endmcr
+ .data 1, 2
+ red r7
+ sub r1, r2
+ m0
+ prn #3
+L0: mov r1, r2
+ .space 2
+mcr m1
+ 
+endmcr
+mcr m2
+ mov r1, r2
+ add #2, r4
+ add #2, r4
+ mov r1, r2
+endmcr
+ .space 2
+ .space 2
+ m1
+mcr m3
+endmcr
+
+ cmp r3, #-1
+ clr r6
+ prn #3
+mcr m4
+ clr r6
+ lea S0, r3
+ red r7
+ sub r1, r2
+endmcr
+; comment
+ .string "ab"
+ m1
+ inc r2
+ m3
+ m4
+
+ sub r1, r2
+ inc r1
+mcr m5
+ lea S0, r3
+ clr r6
+endmcr
+ inc r1
+ mov r1, r2
+; comment
+L1: red r7
+ sub r1, r2
+ hlt
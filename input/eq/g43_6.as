@@ -0,0 +1,87 @@
+S0: .data 5
+ mov r1, r2
+; comment
+mcr m0
+ red r7
+ 
+ not r5
+ not r5
+endmcr
+ add #2, r4
+ m0
+ sub r1, r2
+ m0
+ lea S0, r3
+ not r5
+; comment
+; comment
+ m0
+ .string "ab"
+ m0
+ cmp r3, #-1
+ red r7
+ sub r1, r2
+ .fill 3, 7
+ .data 1, 2
+ add #2, r4
+mcr m1
+ ;c
+ sub r1, r2
+ cmp r3, #-1
+ mov r1, r2
+endmcr
+ add #2, r4
+ m1
+ m0
+ .string "ab"
+ m0
+mcr m2
+ sub r1, r2
+ ;c
+endmcr
+ add #2, r4
+L0: add #2, r4
+L1: inc r1
+L2: clr r6
+
+ mov r1, r2
+ red r7
+L3: .fill 3, 7
+
+ m1
+ cmp r3, #-1
+ m1
+L4: prn #3
+ add #2, r4
+; comment
+ m1
+ m2
+ m1
+ clr r6
+ m1
+L5: red r7
+; comment
+ m1
+ m2
+ m2
+; comment
+ not r5
+ .string "ab"
+ add #2, r4
+L6: inc r1
+L7: lea S0, r3
+ not r5
+ inc r2
+L8: cmp r3, #-1
+ m0
+
+ .space 2
+mcr m3
+ mov r1, r2
+endmcr
+; comment
+ .data 1, 2
+L9: prn #3
+L10: .string "ab"
+ red r7
+ hlt
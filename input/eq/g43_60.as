@@ -0,0 +1,54 @@
+S0: .data 5
+; comment
+; comment
+; comment
+ inc r2
+ inc r1
+ .data 1, 2
+; comment
+mcr m0
+endmcr
+; comment
+ prn #3
+L0: .data 1, 2
+ .fill 3, 7
+ mov r1, r2
+ m0
+ m0
+ mov r1, r2
+ m0
+ cmp r3, #-1
+ lea S0, r3
+ m0
+ not r5
+L1: .data 1, 2
+mcr m1
+endmcr
+mcr m2
+ 
+ not r5
+ sub r1, r2
+endmcr
+ .string "ab"
+ .space 2
+ m1
+ mov r1, r2
+L2: clr r6
+ m2
+ m0
+; comment
+mcr m3
+ inc r1
+ sub r1, r2
+ red r7
+endmcr
+ clr r6
+ lea S0, r3
+ .data 1, 2
+mcr m4
+ ;c
+ clr r6
+endmcr
+ prn #3
+ lea S0, r3
+ hlt
@@ -0,0 +1,60 @@
+S0: .data 5
+; comment
+; comment
+ add #2, r4
+ red r7
+mcr m0
+ not r5
+ prn #3
+ not r5
+endmcr
+ sub r1, r2
+L0: not r5
+ prn #3
+ m0
+ .space 2
+ lea S0, r3
+L1: .data 1, 2
+ add #2, r4
+ m0
+mcr m1
+ red r7
+ inc r1
+endmcr
+ mov r1, r2
+L2: clr r6
+ inc r2
+ clr r6
+ lea S0, r3
+ add #2, r4
+; comment
+ m1
+ inc r2
+ add #2, r4
+L3: clr r6
+ .string "ab"
+; comment
+ prn #3
+ .space 2
+ mov r1, r2
+ .fill 3, 7
+ m0
+ cmp r3, #-1
+ m1
+; comment
+ inc r2
+ m0
+ m0
+; comment
+ m0
+ mov r1, r2
+ prn #3
+ m1
+ clr r6
+ m1
+ .data 1, 2
+ .string "ab"
+L4: .fill 3, 7
+ m1
+L5: red r7
+ hlt
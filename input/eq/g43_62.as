@@ -0,0 +1,99 @@
+S0: .data 5
+ mov r1, r2
+; comment
+ inc r2
+L0: not r5
+; comment
+mcr m0
+ ;c
+ prn #3
+endmcr
+ inc r1
+ .fill 3, 7
+L1: .data 1, 2
+ m0
+ m0
+ lea S0, r3
+ not r5
+ inc r1
+ m0
+ m0
+ m0
+L2: lea S0, r3
+ m0
+mcr m1
+ red r7
+ red r7
+endmcr
+ .space 2
+ .space 2
+ m1
+ clr r6
+ inc r2
+; comment
+L3: sub r1, r2
+ .string "ab"
+mcr m2
+ ;c
+endmcr
+ not r5
+L4: clr r6
+ m0
+ not r5
+ .fill 3, 7
+ clr r6
+ inc r2
+ .data 1, 2
+; comment
+ m2
+ m2
+ inc r1
+ m1
+ inc r2
+ m0
+ m1
+mcr m3
+ lea S0, r3
+ cmp r3, #-1
+endmcr
+ m0
+ m2
+mcr m4
+ 
+ sub r1, r2
+ add #2, r4
+endmcr
+ clr r6
+ prn #3
+ clr r6
+ inc r2
+ m3
+ inc r1
+L5: not r5
+ m2
+ clr r6
+L6: not r5
+
+ not r5
+ .space 2
+ .space 2
+ .string "ab"
+ m0
+ m4
+ clr r6
+ .string "ab"
+ not r5
+mcr m5
+ inc r1
+ prn #3
+endmcr
+ .string "ab"
+ .string "ab"
+ m5
+ cmp r3, #-1
+ not r5
+ .space 2
+ m2
+ lea S0, r3
+ inc r2
+ hlt
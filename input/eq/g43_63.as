@@ -0,0 +1,76 @@
+S0: .data 5
+
+ add #2, r4
+mcr m0
+endmcr
+mcr m1
+ add #2, r4
+endmcr
+mcr m2
+ 
+ lea S0, r3
+endmcr
+mcr m3
+ not r5
+endmcr
+ m0
+ lea S0, r3
+ m3
+
+; comment
+ mov r1, r2
+mcr m4
+ lea S0, r3
+ not r5
+endmcr
+L0: mov r1, r2
+ prn #3
+ clr r6
+mcr m5
+endmcr
+; comment
+ m0
+ m5
+L1: sub r1, r2
+ lea S0, r3
+L2: red r7
+L3: .space 2
+; comment
+; comment
+ m4
+ m3
+ m3
+ m2
+ m2
+mcr m6
+ inc r1
+endmcr
+mcr m7
+ clr r6
+endmcr
+ .fill 3, 7
+L4: add #2, r4
+ inc r1
+ lea S0, r3
+ .data 1, 2
+mcr m8
+ lea S0, r3
+ red r7
+ not r5
+ clr r6
+endmcr
+ cmp r3, #-1
+ inc r2
+ m5
+ mov r1, r2
+ add #2, r4
+; comment
+mcr m9
+ add #2, r4
+ clr r6
+ inc r1
+ red r7
+endmcr
+ not r5
+ inc r2
+ hlt
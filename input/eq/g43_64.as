@@ -0,0 +1,67 @@
+S0: .data 5
+; comment
+ sub r1, r2
+mcr m0
+ 
+ ;c
+endmcr
+ cmp r3, #-1
+L0: prn #3
+; comment
+ m0
+mcr m1
+endmcr
+L1: prn #3
+mcr m2
+ add #2, r4
+ cmp r3, #-1
+ sub r1, r2
+ cmp r3, #-1
+endmcr
+mcr m3
+endmcr
+ clr r6
+ m1
+ not r5
+ .string "ab"
+ m0
+ m1
+ m0
+ cmp r3, #-1
+ inc r1
+ .space 2
+ add #2, r4
+ .data 1, 2
+ .data 1, 2
+ lea S0, r3
+ add #2, r4
+ m1
+L2: add #2, r4
+mcr m4
+endmcr
+ inc r1
+ sub r1, r2
+
+ inc r1
+ m4
+ inc r1
+ .data 1, 2
+ m0
+ add #2, r4
+ m3
+L3: not r5
+; comment
+ add #2, r4
+ prn #3
+ m4
+ red r7
+
+ m2
+mcr m5
+ 
+ ;c
+endmcr
+mcr m6
+endmcr
+ inc r2
+ hlt
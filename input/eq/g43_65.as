@@ -0,0 +1,58 @@
+S0: .data 5
+; comment
+ cmp r3, #-1
+ sub r1, r2
+ clr r6
+mcr m0
+ red r7
+ add #2, r4
+ cmp r3, #-1
+ ;c
+endmcr
+ inc r2
+L0: add #2, r4
+L1: .space 2
+L2: mov r1, r2
+; comment
+ not r5
+ .space 2
+; comment
+ inc r2
+L3: .fill 3, 7
+ add #2, r4
+L4: add #2, r4
+ mov r1, r2
+L5: inc r1
+ lea S0, r3
+
+ m0
+ .string "ab"
+ m0
+ m0
+ m0
+ m0
+ prn #3
+ m0
+ m0
+ clr r6
+L6: .space 2
+ .data 1, 2
+; comment
+ m0
+ .data 1, 2
+ m0
+ .space 2
+L7: sub r1, r2
+mcr m1
+ not r5
+ sub r1, r2
+ 
+ inc r1
+endmcr
+ add #2, r4
+ prn #3
+ add #2, r4
+ prn #3
+ .data 1, 2
+L8: .data 1, 2
+ hlt
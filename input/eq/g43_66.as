@@ -0,0 +1,37 @@
+S0: .data 5
+; comment
+ .fill 3, 7
+; comment
+L0: sub r1, r2
+ .space 2
+ inc r2
+; comment
+ mov r1, r2
+ clr r6
+
+L1: sub r1, r2
+; comment
+; comment
+mcr m0
+endmcr
+ .string "ab"
+ .data 1, 2
+ inc r2
+ m0
+mcr m1
+ ;c
+ not r5
+endmcr
+L2: clr r6
+mcr m2
+ inc r1
+ lea S0, r3
+endmcr
+mcr m3
+ lea S0, r3
+ clr r6
+ inc r1
+endmcr
+ sub r1, r2
+ lea S0, r3
+ hlt
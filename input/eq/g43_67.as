@@ -0,0 +1,42 @@
+S0: .data 5
+mcr m0
+ red r7
+ clr r6
+ add #2, r4
+endmcr
+ clr r6
+ m0
+L0: .data 1, 2
+mcr m1
+ prn #3
+ mov r1, r2
+ ;c
+endmcr
+mcr m2
+ cmp r3, #-1
+ clr r6
+endmcr
+L1: lea S0, r3
+ .string "ab"
+ not r5
+ red r7
+ .data 1, 2
+L2: .space 2
+; comment
+
+ inc r1
+
+ m0
+L3: .space 2
+ m2
+
+; comment
+mcr m3
+ red r7
+ prn #3
+ 
+ cmp r3, #-1
+endmcr
+ inc r1
+ clr r6
+ hlt
@@ -0,0 +1,102 @@
+S0: .data 5
+ inc r2
+ .space 2
+mcr m0
+ cmp r3, #-1
+ clr r6
+ red r7
+ add #2, r4
+endmcr
+ .data 1, 2
+L0: not r5
+ .fill 3, 7
+mcr m1
+ mov r1, r2
+ not r5
+ inc r1
+endmcr
+mcr m2
+ prn #3
+ cmp r3, #-1
+ cmp r3, #-1
+ inc r1
+endmcr
+ clr r6
+; comment
+ m2
+ inc r1
+ lea S0, r3
+ m0
+mcr m3
+ clr r6
+ lea S0, r3
+ 
+endmcr
+ m1
+
+; comment
+ m2
+; comment
+L1: inc r1
+ clr r6
+ mov r1, r2
+; comment
+; comment
+ .space 2
+ lea S0, r3
+; comment
+
+ .fill 3, 7
+ add #2, r4
+mcr m4
+ mov r1, r2
+ red r7
+ cmp r3, #-1
+ lea S0, r3
+endmcr
+ lea S0, r3
+ m2
+ inc r2
+ m0
+ mov r1, r2
+ prn #3
+ m2
+ m3
+
+ .fill 3, 7
+; comment
+ .data 1, 2
+mcr m5
+ cmp r3, #-1
+endmcr
+ clr r6
+ lea S0, r3
+ .string "ab"
+ not r5
+mcr m6
+ add #2, r4
+ red r7
+ inc r1
+endmcr
+ mov r1, r2
+ m5
+mcr m7
+endmcr
+ red r7
+ prn #3
+ .string "ab"
+L2: .space 2
+mcr m8
+ red r7
+ mov r1, r2
+endmcr
+ m5
+L3: mov r1, r2
+ prn #3
+L4: mov r1, r2
+
+ m7
+ m7
+ m2
+ not r5
+ hlt
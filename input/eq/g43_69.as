@@ -0,0 +1,97 @@
+S0: .data 5
+mcr m0
+ mov r1, r2
+endmcr
+ not r5
+ .fill 3, 7
+; comment
+ lea S0, r3
+ sub r1, r2
+
+; comment
+; comment
+; comment
+ m0
+ cmp r3, #-1
+ .fill 3, 7
+L0: cmp r3, #-1
+; comment
+ mov r1, r2
+ lea S0, r3
+mcr m1
+endmcr
+ m0
+ m0
+ m1
+ mov r1, r2
+ sub r1, r2
+mcr m2
+endmcr
+ add #2, r4
+L1: add #2, r4
+ inc r2
+L2: red r7
+ .fill 3, 7
+; comment
+ clr r6
+
+ mov r1, r2
+ sub r1, r2
+mcr m3
+ 
+ clr r6
+ prn #3
+endmcr
+ m2
+ inc r2
+ m3
+; comment
+ lea S0, r3
+ m2
+mcr m4
+ inc r1
+ red r7
+ red r7
+ lea S0, r3
+endmcr
+ lea S0, r3
+L3: mov r1, r2
+ prn #3
+ mov r1, r2
+mcr m5
+ prn #3
+ sub r1, r2
+ red r7
+endmcr
+ .string "ab"
+ mov r1, r2
+ lea S0, r3
+ m0
+ mov r1, r2
+mcr m6
+endmcr
+ prn #3
+mcr m7
+ not r5
+endmcr
+L4: lea S0, r3
+mcr m8
+ lea S0, r3
+ not r5
+endmcr
+mcr m9
+ clr r6
+ add #2, r4
+ lea S0, r3
+ sub r1, r2
+endmcr
+ m6
+ red r7
+mcr m10
+ lea S0, r3
+ prn #3
+ inc r1
+endmcr
+ prn #3
+ .space 2
+ hlt
@@ -0,0 +1,52 @@
+S0: .data 5
+ clr r6
+mcr m0
+ mov r1, r2
+ not r5
+ lea S0, r3
+ inc r1
+endmcr
+L0: cmp r3, #-1
+
+mcr m1
+endmcr
+ inc r1
+ m0
+ lea S0, r3
+L1: clr r6
+ m0
+ m0
+ lea S0, r3
+L2: prn #3
+ cmp r3, #-1
+ mov r1, r2
+ red r7
+
+ m1
+; comment
+ m0
+L3: cmp r3, #-1
+ m1
+ .string "ab"
+L4: mov r1, r2
+; comment
+ prn #3
+
+ mov r1, r2
+ .space 2
+ lea S0, r3
+ mov r1, r2
+ red r7
+mcr m2
+ ;c
+ lea S0, r3
+endmcr
+ .space 2
+ .data 1, 2
+L5: not r5
+mcr m3
+endmcr
+ m2
+ m1
+; comment
+ hlt
@@ -0,0 +1,123 @@
+S0: .data 5
+mcr m0
+ red r7
+ prn #3
+ not r5
+endmcr
+ prn #3
+ cmp r3, #-1
+; comment
+; comment
+; comment
+mcr m1
+ add #2, r4
+ clr r6
+endmcr
+ red r7
+mcr m2
+ not r5
+ add #2, r4
+ prn #3
+endmcr
+mcr m3
+ mov r1, r2
+ red r7
+ 
+endmcr
+ prn #3
+ lea S0, r3
+ sub r1, r2
+mcr m4
+ prn #3
+ lea S0, r3
+endmcr
+L0: mov r1, r2
+ m4
+L1: .data 1, 2
+ m0
+ m3
+ sub r1, r2
+L2: .string "ab"
+ m2
+L3: .string "ab"
+mcr m5
+ inc r1
+ inc r1
+ ;c
+endmcr
+ add #2, r4
+ m5
+ lea S0, r3
+ mov r1, r2
+ inc r2
+ cmp r3, #-1
+ prn #3
+ .data 1, 2
+ inc r1
+L4: inc r1
+mcr m6
+ cmp r3, #-1
+ not r5
+ clr r6
+endmcr
+L5: red r7
+mcr m7
+ ;c
+ lea S0, r3
+ clr r6
+ not r5
+endmcr
+ m0
+ lea S0, r3
+ m3
+ m7
+ .string "ab"
+ clr r6
+; comment
+ m4
+ m5
+ inc r2
+ .space 2
+
+ add #2, r4
+ sub r1, r2
+mcr m8
+ red r7
+endmcr
+L6: .data 1, 2
+ cmp r3, #-1
+ .fill 3, 7
+mcr m9
+ lea S0, r3
+ prn #3
+endmcr
+ .space 2
+ .data 1, 2
+mcr m10
+endmcr
+mcr m11
+ mov r1, r2
+endmcr
+mcr m12
+endmcr
+ sub r1, r2
+ inc r2
+ m0
+ red r7
+mcr m13
+endmcr
+ inc r1
+ .space 2
+ m13
+ cmp r3, #-1
+ lea S0, r3
+ prn #3
+ m2
+ .data 1, 2
+ .data 1, 2
+ clr r6
+mcr m14
+ prn #3
+endmcr
+ m0
+ hlt
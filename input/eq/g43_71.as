@@ -0,0 +1,66 @@
+S0: .data 5
+L0: .fill 3, 7
+ .space 2
+; comment
+mcr m0
+ inc r1
+ lea S0, r3
+ cmp r3, #-1
+ sub r1, r2
+endmcr
+mcr m1
+ not r5
+ red r7
+ prn #3
+ not r5
+endmcr
+ inc r1
+mcr m2
+ cmp r3, #-1
+ prn #3
+ not r5
+ clr r6
+endmcr
+
+mcr m3
+endmcr
+ m1
+ m2
+ m0
+ m1
+; comment
+mcr m4
+ mov r1, r2
+endmcr
+ m3
+ inc r2
+ lea S0, r3
+ m0
+ m4
+ m4
+
+L1: add #2, r4
+ lea S0, r3
+ m0
+mcr m5
+ cmp r3, #-1
+endmcr
+ inc r2
+ sub r1, r2
+ cmp r3, #-1
+ m0
+ inc r2
+ inc r2
+ m4
+mcr m6
+ add #2, r4
+ red r7
+ clr r6
+endmcr
+ add #2, r4
+ lea S0, r3
+L2: red r7
+ cmp r3, #-1
+ sub r1, r2
+L3: .data 1, 2
+ hlt
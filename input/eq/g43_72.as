@@ -0,0 +1,27 @@
+S0: .data 5
+ .string "ab"
+; comment
+ not r5
+L0: lea S0, r3
+ .string "ab"
+; comment
+ .string "ab"
+
+mcr m0
+endmcr
+ mov r1, r2
+ .space 2
+ m0
+; comment
+; comment
+ inc r2
+ m0
+ add #2, r4
+ lea S0, r3
+
+L1: inc r1
+; comment
+; comment
+ prn #3
+L2: red r7
+ hlt
@@ -0,0 +1,57 @@
+S0: .data 5
+; comment
+ inc r2
+; comment
+; comment
+mcr m0
+ sub r1, r2
+ sub r1, r2
+ cmp r3, #-1
+endmcr
+
+mcr m1
+ inc r1
+ clr r6
+ not r5
+endmcr
+ red r7
+
+ add #2, r4
+ m0
+ inc r2
+ add #2, r4
+ m0
+ .fill 3, 7
+ m0
+ .space 2
+ m1
+mcr m2
+endmcr
+L0: cmp r3, #-1
+ m1
+ red r7
+ not r5
+ m1
+mcr m3
+ clr r6
+ inc r1
+ ;c
+endmcr
+ mov r1, r2
+ m3
+mcr m4
+ mov r1, r2
+endmcr
+ sub r1, r2
+ clr r6
+; comment
+ inc r2
+L1: mov r1, r2
+ add #2, r4
+ mov r1, r2
+ m1
+mcr m5
+ cmp r3, #-1
+ 
+endmcr
+ hlt
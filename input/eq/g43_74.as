@@ -0,0 +1,101 @@
+S0: .data 5
+L0: .space 2
+; comment
+; comment
+ cmp r3, #-1
+
+
+L1: red r7
+; comment
+ .string "ab"
+; comment
+L2: red r7
+ cmp r3, #-1
+ .space 2
+ cmp r3, #-1
+L3: lea S0, r3
+; comment
+L4: inc r1
+ mov r1, r2
+ .string "ab"
+L5: lea S0, r3
+ red r7
+L6: cmp r3, #-1
+ red r7
+; comment
+; comment
+L7: .data 1, 2
+ sub r1, r2
+L8: not r5
+ cmp r3, #-1
+; comment
+ clr r6
+ .data 1, 2
+mcr m0
+endmcr
+L9: cmp r3, #-1
+ add #2, r4
+mcr m1
+ lea S0, r3
+ red r7
+ ;c
+ 
+endmcr
+ add #2, r4
+; comment
+ inc r1
+L10: cmp r3, #-1
+; comment
+ sub r1, r2
+L11: .string "ab"
+ m1
+ inc r2
+ cmp r3, #-1
+ cmp r3, #-1
+ cmp r3, #-1
+; comment
+ mov r1, r2
+L12: clr r6
+mcr m2
+ inc r1
+endmcr
+L13: not r5
+mcr m3
+ clr r6
+endmcr
+ mov r1, r2
+; comment
+L14: prn #3
+ mov r1, r2
+mcr m4
+ clr r6
+ lea S0, r3
+ add #2, r4
+ not r5
+endmcr
+; comment
+ lea S0, r3
+ m1
+ m4
+ sub r1, r2
+ m0
+L15: red r7
+mcr m5
+ lea S0, r3
+ clr r6
+ red r7
+ clr r6
+endmcr
+mcr m6
+ red r7
+ lea S0, r3
+endmcr
+; comment
+L16: cmp r3, #-1
+ clr r6
+mcr m7
+endmcr
+ not r5
+ inc r2
+ m0
+ hlt
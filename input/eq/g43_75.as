@@ -0,0 +1,59 @@
+S0: .data 5
+L0: red r7
+ .data 1, 2
+ .data 1, 2
+ .space 2
+ not r5
+ add #2, r4
+ not r5
+ inc r2
+; comment
+; comment
+ .data 1, 2
+L1: prn #3
+; comment
+ inc r2
+ .space 2
+; comment
+L2: inc r1
+; comment
+; comment
+mcr m0
+ mov r1, r2
+ add #2, r4
+ not r5
+endmcr
+ mov r1, r2
+ inc r2
+ m0
+ clr r6
+L3: .fill 3, 7
+ m0
+
+mcr m1
+ sub r1, r2
+endmcr
+ inc r1
+L4: not r5
+ m1
+ inc r2
+ inc r2
+ m1
+; comment
+ red r7
+ m1
+; comment
+ m1
+ lea S0, r3
+; comment
+mcr m2
+ lea S0, r3
+ prn #3
+endmcr
+ inc r1
+ lea S0, r3
+ not r5
+ prn #3
+ inc r1
+ .data 1, 2
+ hlt
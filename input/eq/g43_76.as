@@ -0,0 +1,55 @@
+S0: .data 5
+ inc r2
+; comment
+ inc r1
+; comment
+; comment
+ red r7
+; comment
+; comment
+; comment
+ inc r1
+ lea S0, r3
+; comment
+; comment
+L0: inc r1
+L1: clr r6
+; comment
+L2: .data 1, 2
+ .data 1, 2
+L3: sub r1, r2
+mcr m0
+ red r7
+ prn #3
+ lea S0, r3
+endmcr
+ clr r6
+
+ lea S0, r3
+; comment
+ m0
+ not r5
+ m0
+L4: lea S0, r3
+ lea S0, r3
+ mov r1, r2
+; comment
+; comment
+ m0
+mcr m1
+ inc r1
+ red r7
+ mov r1, r2
+ 
+endmcr
+ m1
+
+ .space 2
+mcr m2
+endmcr
+ m2
+ m0
+L5: .data 1, 2
+; comment
+ .space 2
+ hlt
@@ -0,0 +1,112 @@
+S0: .data 5
+; comment
+; comment
+; comment
+ add #2, r4
+ lea S0, r3
+ .data 1, 2
+ inc r1
+ inc r2
+ cmp r3, #-1
+ prn #3
+mcr m0
+ add #2, r4
+ sub r1, r2
+ red r7
+ cmp r3, #-1
+endmcr
+ m0
+mcr m1
+ 
+endmcr
+ red r7
+ mov r1, r2
+ .string "ab"
+ m0
+mcr m2
+ mov r1, r2
+ sub r1, r2
+ mov r1, r2
+endmcr
+ m2
+ sub r1, r2
+; comment
+ .space 2
+ .fill 3, 7
+ cmp r3, #-1
+ inc r2
+ .fill 3, 7
+mcr m3
+endmcr
+mcr m4
+endmcr
+ .fill 3, 7
+mcr m5
+ lea S0, r3
+ 
+ red r7
+ inc r1
+endmcr
+ .space 2
+mcr m6
+ sub r1, r2
+ mov r1, r2
+endmcr
+mcr m7
+ not r5
+ clr r6
+ lea S0, r3
+endmcr
+mcr m8
+ prn #3
+ inc r1
+ 
+endmcr
+mcr m9
+endmcr
+L0: red r7
+; comment
+ inc r2
+ prn #3
+ m1
+ m2
+mcr m10
+ ;c
+endmcr
+ clr r6
+ .string "ab"
+ inc r2
+ m1
+ inc r2
+; comment
+ add #2, r4
+ m9
+ inc r2
+mcr m11
+ inc r1
+endmcr
+mcr m12
+endmcr
+L1: .data 1, 2
+
+mcr m13
+ add #2, r4
+ red r7
+ red r7
+endmcr
+ .space 2
+ m13
+ .space 2
+L2: .space 2
+ not r5
+ not r5
+ red r7
+ .data 1, 2
+ clr r6
+ m11
+ .space 2
+ m1
+ m1
+ m5
+L3: .string "ab"
+ hlt
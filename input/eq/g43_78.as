@@ -0,0 +1,95 @@
+S0: .data 5
+; comment
+; comment
+ .space 2
+
+mcr m0
+ ;c
+endmcr
+; comment
+ .string "ab"
+ inc r1
+ m0
+ m0
+ clr r6
+ m0
+; comment
+ m0
+ m0
+ m0
+L0: .space 2
+ .string "ab"
+; comment
+L1: .string "ab"
+L2: inc r1
+ cmp r3, #-1
+mcr m1
+ cmp r3, #-1
+ ;c
+ ;c
+endmcr
+ m1
+ m1
+ m0
+ m0
+ inc r1
+
+; comment
+ m1
+ m1
+L3: clr r6
+ m0
+ red r7
+ inc r2
+mcr m2
+ inc r1
+ add #2, r4
+ not r5
+ cmp r3, #-1
+endmcr
+ not r5
+ .space 2
+L4: red r7
+ inc r1
+ inc r1
+ m1
+ m0
+; comment
+ inc r2
+ m1
+L5: .fill 3, 7
+ not r5
+ m0
+; comment
+ inc r2
+; comment
+ .space 2
+mcr m3
+ ;c
+ sub r1, r2
+ not r5
+ lea S0, r3
+endmcr
+
+ m1
+ m1
+ .space 2
+; comment
+mcr m4
+ red r7
+ sub r1, r2
+ sub r1, r2
+ add #2, r4
+endmcr
+ sub r1, r2
+
+ lea S0, r3
+L6: add #2, r4
+ .space 2
+ m1
+ not r5
+ .string "ab"
+ lea S0, r3
+ not r5
+ prn #3
+ hlt
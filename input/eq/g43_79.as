@@ -0,0 +1,37 @@
+S0: .data 5
+
+ cmp r3, #-1
+L0: prn #3
+mcr m0
+endmcr
+ red r7
+ m0
+ not r5
+mcr m1
+endmcr
+ m1
+mcr m2
+ 
+ 
+endmcr
+L1: .string "ab"
+mcr m3
+endmcr
+L2: cmp r3, #-1
+ m1
+ not r5
+ m0
+ .string "ab"
+ prn #3
+ .string "ab"
+ inc r1
+ prn #3
+ sub r1, r2
+ .fill 3, 7
+; comment
+ .fill 3, 7
+L3: inc r1
+ cmp r3, #-1
+
+ m2
+ hlt
@@ -0,0 +1,43 @@
+S0: .data 5
+; comment
+; comment
+; comment
+mcr m0
+ cmp r3, #-1
+endmcr
+ sub r1, r2
+ red r7
+; comment
+ .space 2
+ inc r2
+ .string "ab"
+; comment
+ clr r6
+ mov r1, r2
+mcr m1
+ clr r6
+ mov r1, r2
+ ;c
+ inc r1
+endmcr
+ m0
+ inc r2
+ cmp r3, #-1
+ m0
+ inc r1
+ m1
+ red r7
+; comment
+L0: prn #3
+ sub r1, r2
+ .data 1, 2
+ cmp r3, #-1
+; comment
+ m0
+ .space 2
+ cmp r3, #-1
+ add #2, r4
+ m1
+ m1
+L1: clr r6
+ hlt
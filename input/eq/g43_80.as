@@ -0,0 +1,45 @@
+S0: .data 5
+; comment
+ .space 2
+; comment
+L0: not r5
+ clr r6
+ inc r1
+; comment
+L1: inc r1
+ prn #3
+; comment
+; comment
+ cmp r3, #-1
+L2: not r5
+mcr m0
+endmcr
+ m0
+ m0
+ inc r1
+ cmp r3, #-1
+ sub r1, r2
+
+ m0
+ not r5
+mcr m1
+endmcr
+; comment
+ m0
+mcr m2
+endmcr
+ not r5
+mcr m3
+endmcr
+ .fill 3, 7
+ prn #3
+; comment
+ m3
+; comment
+ m0
+mcr m4
+ clr r6
+endmcr
+ sub r1, r2
+ sub r1, r2
+ hlt
@@ -0,0 +1,70 @@
+S0: .data 5
+ not r5
+; comment
+L0: prn #3
+ .space 2
+ add #2, r4
+; comment
+L1: lea S0, r3
+ add #2, r4
+ prn #3
+L2: not r5
+ .fill 3, 7
+ cmp r3, #-1
+mcr m0
+ not r5
+ add #2, r4
+ not r5
+endmcr
+ add #2, r4
+L3: mov r1, r2
+ .data 1, 2
+ m0
+ cmp r3, #-1
+ m0
+ m0
+; comment
+ inc r1
+ m0
+ clr r6
+mcr m1
+ inc r1
+ 
+endmcr
+ m1
+
+mcr m2
+endmcr
+
+ m0
+ .data 1, 2
+L4: .string "ab"
+ lea S0, r3
+mcr m3
+ clr r6
+ sub r1, r2
+ not r5
+ cmp r3, #-1
+endmcr
+ m3
+ clr r6
+L5: lea S0, r3
+ lea S0, r3
+ prn #3
+ m2
+mcr m4
+ sub r1, r2
+ cmp r3, #-1
+endmcr
+ m3
+ m0
+ m4
+; comment
+; comment
+ cmp r3, #-1
+ m2
+ .fill 3, 7
+ m2
+ inc r2
+
+ hlt
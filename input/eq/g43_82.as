@@ -0,0 +1,45 @@
+S0: .data 5
+ sub r1, r2
+ prn #3
+ prn #3
+mcr m0
+ lea S0, r3
+ mov r1, r2
+ cmp r3, #-1
+endmcr
+ m0
+ m0
+ .fill 3, 7
+ inc r2
+ inc r2
+ m0
+ m0
+mcr m1
+ sub r1, r2
+ 
+endmcr
+ clr r6
+ .data 1, 2
+; comment
+mcr m2
+ add #2, r4
+endmcr
+mcr m3
+endmcr
+; comment
+ lea S0, r3
+ not r5
+; comment
+ clr r6
+ m1
+L0: .data 1, 2
+ clr r6
+mcr m4
+ 
+ not r5
+ sub r1, r2
+endmcr
+ inc r2
+ mov r1, r2
+ clr r6
+ hlt
@@ -0,0 +1,69 @@
+S0: .data 5
+L0: red r7
+; comment
+mcr m0
+ cmp r3, #-1
+endmcr
+ m0
+ inc r1
+; comment
+ cmp r3, #-1
+ cmp r3, #-1
+ inc r1
+mcr m1
+ not r5
+ clr r6
+ lea S0, r3
+endmcr
+ sub r1, r2
+ m1
+ .space 2
+ m0
+ m1
+L1: sub r1, r2
+ inc r1
+ .data 1, 2
+mcr m2
+endmcr
+ inc r2
+L2: clr r6
+ m1
+mcr m3
+endmcr
+ m3
+L3: mov r1, r2
+ red r7
+ clr r6
+ not r5
+ m2
+L4: .space 2
+
+ .string "ab"
+ .space 2
+L5: red r7
+ inc r2
+ inc r2
+mcr m4
+ ;c
+ inc r1
+ clr r6
+endmcr
+ lea S0, r3
+; comment
+ m2
+; comment
+ m0
+ .data 1, 2
+ .data 1, 2
+ inc r1
+mcr m5
+ mov r1, r2
+ 
+ inc r1
+endmcr
+ cmp r3, #-1
+
+; comment
+ mov r1, r2
+ sub r1, r2
+ hlt
@@ -0,0 +1,96 @@
+S0: .data 5
+; comment
+L0: red r7
+ not r5
+ inc r2
+ .fill 3, 7
+ sub r1, r2
+ sub r1, r2
+ .string "ab"
+; comment
+L1: red r7
+L2: prn #3
+ add #2, r4
+mcr m0
+ clr r6
+endmcr
+ m0
+ m0
+ red r7
+ m0
+mcr m1
+ ;c
+ ;c
+ prn #3
+ sub r1, r2
+endmcr
+L3: cmp r3, #-1
+ m1
+ prn #3
+ red r7
+ .data 1, 2
+mcr m2
+endmcr
+mcr m3
+ lea S0, r3
+endmcr
+ m0
+ prn #3
+ clr r6
+ not r5
+ .space 2
+mcr m4
+ lea S0, r3
+ not r5
+endmcr
+ .string "ab"
+ lea S0, r3
+ .space 2
+ .fill 3, 7
+ sub r1, r2
+ inc r2
+; comment
+L4: .space 2
+ m3
+ m3
+ red r7
+ m0
+mcr m5
+ prn #3
+ prn #3
+ cmp r3, #-1
+ not r5
+endmcr
+
+ m0
+ .space 2
+ mov r1, r2
+ m1
+; comment
+mcr m6
+ sub r1, r2
+ inc r1
+ add #2, r4
+endmcr
+ mov r1, r2
+ .data 1, 2
+ lea S0, r3
+L5: sub r1, r2
+ .space 2
+
+ m6
+ m2
+mcr m7
+ cmp r3, #-1
+ add #2, r4
+endmcr
+ m7
+ m7
+mcr m8
+ sub r1, r2
+ not r5
+endmcr
+ not r5
+ red r7
+L6: add #2, r4
+ hlt
@@ -0,0 +1,39 @@
+S0: .data 5
+L0: .space 2
+ cmp r3, #-1
+ .space 2
+ .data 1, 2
+ sub r1, r2
+ lea S0, r3
+L1: mov r1, r2
+ clr r6
+ .fill 3, 7
+ .data 1, 2
+; comment
+ mov r1, r2
+; comment
+; comment
+; comment
+ .data 1, 2
+mcr m0
+ 
+ not r5
+ prn #3
+endmcr
+mcr m1
+endmcr
+; comment
+ not r5
+ cmp r3, #-1
+L2: .space 2
+ m1
+
+ m1
+ m0
+ inc r1
+ .fill 3, 7
+ m0
+ m1
+; comment
+ m1
+ hlt
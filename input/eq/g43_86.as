@@ -0,0 +1,95 @@
+S0: .data 5
+ sub r1, r2
+; comment
+mcr m0
+endmcr
+ .string "ab"
+ .space 2
+L0: sub r1, r2
+L1: red r7
+ cmp r3, #-1
+mcr m1
+ clr r6
+endmcr
+ m0
+ inc r2
+mcr m2
+ prn #3
+ red r7
+ not r5
+endmcr
+
+ .string "ab"
+ inc r1
+ m2
+ not r5
+ lea S0, r3
+L2: add #2, r4
+ .fill 3, 7
+ .string "ab"
+
+mcr m3
+endmcr
+L3: prn #3
+; comment
+ inc r2
+ cmp r3, #-1
+L4: .data 1, 2
+ .fill 3, 7
+ m1
+
+mcr m4
+ prn #3
+ not r5
+endmcr
+ red r7
+ sub r1, r2
+ clr r6
+ .fill 3, 7
+ .string "ab"
+ not r5
+mcr m5
+ not r5
+ cmp r3, #-1
+endmcr
+ inc r2
+ sub r1, r2
+ m3
+mcr m6
+endmcr
+ m0
+L5: clr r6
+ m0
+; comment
+ clr r6
+ m4
+ .space 2
+ prn #3
+ add #2, r4
+ m4
+; comment
+ m6
+; comment
+; comment
+L6: inc r1
+mcr m7
+ sub r1, r2
+ ;c
+endmcr
+; comment
+ m2
+ m1
+ .data 1, 2
+mcr m8
+ 
+ lea S0, r3
+ prn #3
+ cmp r3, #-1
+endmcr
+ m5
+ prn #3
+ m2
+ mov r1, r2
+ .data 1, 2
+ clr r6
+ hlt
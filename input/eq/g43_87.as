@@ -0,0 +1,47 @@
+S0: .data 5
+ .space 2
+mcr m0
+ ;c
+ sub r1, r2
+endmcr
+ .string "ab"
+ inc r1
+ .space 2
+L0: .string "ab"
+ add #2, r4
+ mov r1, r2
+ clr r6
+ .fill 3, 7
+ .string "ab"
+ cmp r3, #-1
+ .space 2
+ inc r2
+L1: add #2, r4
+ m0
+ .space 2
+mcr m1
+ add #2, r4
+ red r7
+ lea S0, r3
+ inc r1
+endmcr
+mcr m2
+ mov r1, r2
+ 
+ inc r1
+ add #2, r4
+endmcr
+ cmp r3, #-1
+ m2
+ m0
+; comment
+ m0
+ .space 2
+ cmp r3, #-1
+mcr m3
+ add #2, r4
+ ;c
+endmcr
+ cmp r3, #-1
+ .fill 3, 7
+ hlt
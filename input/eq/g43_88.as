@@ -0,0 +1,80 @@
+S0: .data 5
+ not r5
+ sub r1, r2
+mcr m0
+ ;c
+ red r7
+endmcr
+ m0
+L0: lea S0, r3
+; comment
+ prn #3
+mcr m1
+ inc r1
+ prn #3
+endmcr
+ cmp r3, #-1
+ m0
+ cmp r3, #-1
+ red r7
+mcr m2
+ 
+ clr r6
+ sub r1, r2
+endmcr
+; comment
+L1: red r7
+mcr m3
+ clr r6
+endmcr
+ .string "ab"
+mcr m4
+ mov r1, r2
+endmcr
+ mov r1, r2
+ m1
+ not r5
+ .string "ab"
+ m4
+ prn #3
+ sub r1, r2
+ clr r6
+ clr r6
+ .space 2
+mcr m5
+ sub r1, r2
+endmcr
+
+ .string "ab"
+ .string "ab"
+mcr m6
+ cmp r3, #-1
+ ;c
+ cmp r3, #-1
+ 
+endmcr
+mcr m7
+ prn #3
+ ;c
+ clr r6
+endmcr
+mcr m8
+ ;c
+ 
+ prn #3
+ 
+endmcr
+ red r7
+L2: add #2, r4
+ sub r1, r2
+ cmp r3, #-1
+mcr m9
+ prn #3
+ cmp r3, #-1
+endmcr
+ lea S0, r3
+ inc r2
+ lea S0, r3
+ cmp r3, #-1
+ add #2, r4
+ hlt
@@ -0,0 +1,33 @@
+S0: .data 5
+ .string "ab"
+; comment
+ prn #3
+; comment
+; comment
+L0: not r5
+ red r7
+; comment
+ .space 2
+L1: .string "ab"
+; comment
+mcr m0
+ 
+ not r5
+endmcr
+L2: inc r1
+ sub r1, r2
+mcr m1
+ inc r1
+ ;c
+endmcr
+ m0
+ .space 2
+ m1
+; comment
+ red r7
+ sub r1, r2
+ .space 2
+ add #2, r4
+ .fill 3, 7
+ .fill 3, 7
+ hlt
@@ -0,0 +1,77 @@
+S0: .data 5
+L0: add #2, r4
+ inc r1
+ inc r2
+ not r5
+ inc r1
+; comment
+ .string "ab"
+; comment
+mcr m0
+ sub r1, r2
+endmcr
+L1: lea S0, r3
+ .fill 3, 7
+mcr m1
+ cmp r3, #-1
+ ;c
+endmcr
+ m1
+ .fill 3, 7
+ m1
+ m0
+ m0
+ inc r1
+L2: prn #3
+
+ mov r1, r2
+mcr m2
+ cmp r3, #-1
+ cmp r3, #-1
+ not r5
+ inc r1
+endmcr
+ prn #3
+mcr m3
+endmcr
+ sub r1, r2
+
+; comment
+ mov r1, r2
+ m0
+mcr m4
+ ;c
+ lea S0, r3
+ prn #3
+ 
+endmcr
+ m4
+ mov r1, r2
+; comment
+ prn #3
+mcr m5
+ ;c
+ sub r1, r2
+endmcr
+ .fill 3, 7
+ mov r1, r2
+ red r7
+ m4
+ clr r6
+ m3
+mcr m6
+ red r7
+endmcr
+ m6
+mcr m7
+ mov r1, r2
+ sub r1, r2
+endmcr
+ inc r1
+ clr r6
+ cmp r3, #-1
+mcr m8
+ mov r1, r2
+endmcr
+ clr r6
+ hlt
@@ -0,0 +1,51 @@
+S0: .data 5
+ red r7
+ .data 1, 2
+ lea S0, r3
+ add #2, r4
+; comment
+L0: prn #3
+ .space 2
+
+mcr m0
+ sub r1, r2
+ prn #3
+ inc r1
+ ;c
+endmcr
+mcr m1
+endmcr
+ .fill 3, 7
+mcr m2
+ mov r1, r2
+ inc r1
+ inc r1
+endmcr
+mcr m3
+ inc r1
+endmcr
+ clr r6
+L1: .fill 3, 7
+ m2
+L2: .space 2
+; comment
+
+ m3
+ inc r2
+ inc r1
+ red r7
+L3: .string "ab"
+L4: add #2, r4
+mcr m4
+ red r7
+ prn #3
+ mov r1, r2
+endmcr
+ .fill 3, 7
+ prn #3
+ m4
+ m1
+ .data 1, 2
+ m0
+; comment
+ hlt
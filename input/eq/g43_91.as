@@ -0,0 +1,32 @@
+S0: .data 5
+ .data 1, 2
+; comment
+
+ red r7
+L0: cmp r3, #-1
+ .fill 3, 7
+ cmp r3, #-1
+mcr m0
+endmcr
+ .data 1, 2
+ add #2, r4
+ .space 2
+ .fill 3, 7
+ sub r1, r2
+ m0
+ .string "ab"
+ cmp r3, #-1
+ sub r1, r2
+mcr m1
+ clr r6
+ prn #3
+ sub r1, r2
+endmcr
+ m1
+; comment
+ add #2, r4
+L1: .fill 3, 7
+ .space 2
+ not r5
+ cmp r3, #-1
+ hlt
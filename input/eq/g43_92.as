@@ -0,0 +1,72 @@
+S0: .data 5
+ sub r1, r2
+ .fill 3, 7
+ .fill 3, 7
+L0: red r7
+ mov r1, r2
+L1: inc r1
+mcr m0
+ lea S0, r3
+endmcr
+ m0
+ red r7
+L2: .string "ab"
+ prn #3
+mcr m1
+ clr r6
+ inc r1
+endmcr
+ m0
+ cmp r3, #-1
+ .space 2
+ inc r2
+mcr m2
+ add #2, r4
+ add #2, r4
+endmcr
+ .fill 3, 7
+ .data 1, 2
+mcr m3
+ prn #3
+ lea S0, r3
+ lea S0, r3
+endmcr
+ not r5
+mcr m4
+ red r7
+ prn #3
+ add #2, r4
+endmcr
+ prn #3
+ m4
+ .space 2
+ m2
+mcr m5
+endmcr
+ m4
+ red r7
+ prn #3
+ sub r1, r2
+L3: mov r1, r2
+ clr r6
+ .data 1, 2
+ m3
+; comment
+ prn #3
+ clr r6
+ clr r6
+ m3
+mcr m6
+ ;c
+ not r5
+ prn #3
+ not r5
+endmcr
+ .fill 3, 7
+; comment
+ .data 1, 2
+mcr m7
+ 
+endmcr
+ not r5
+ hlt
@@ -0,0 +1,111 @@
+S0: .data 5
+ lea S0, r3
+ mov r1, r2
+; comment
+; comment
+; comment
+mcr m0
+ mov r1, r2
+ ;c
+ lea S0, r3
+ not r5
+endmcr
+; comment
+ m0
+ .data 1, 2
+ m0
+ m0
+ not r5
+L0: mov r1, r2
+ m0
+ mov r1, r2
+ m0
+ m0
+ prn #3
+ .string "ab"
+ inc r2
+ .string "ab"
+ m0
+ add #2, r4
+ not r5
+ add #2, r4
+mcr m1
+ inc r1
+ inc r1
+ ;c
+ lea S0, r3
+endmcr
+L1: inc r1
+; comment
+L2: .space 2
+ m0
+ m0
+mcr m2
+endmcr
+ m2
+mcr m3
+ cmp r3, #-1
+ red r7
+endmcr
+mcr m4
+ lea S0, r3
+ add #2, r4
+endmcr
+ prn #3
+ m4
+; comment
+ m2
+mcr m5
+ sub r1, r2
+ inc r1
+ prn #3
+endmcr
+ sub r1, r2
+mcr m6
+ lea S0, r3
+ not r5
+ inc r1
+ inc r1
+endmcr
+ .data 1, 2
+L3: add #2, r4
+L4: add #2, r4
+ sub r1, r2
+ inc r2
+ inc r2
+ prn #3
+ clr r6
+L5: sub r1, r2
+ inc r2
+ inc r2
+
+ m5
+; comment
+ m3
+L6: clr r6
+ inc r1
+ m0
+L7: not r5
+mcr m7
+ sub r1, r2
+endmcr
+ m3
+ m4
+ m3
+ clr r6
+mcr m8
+ prn #3
+ prn #3
+endmcr
+ .data 1, 2
+ prn #3
+ lea S0, r3
+; comment
+ m2
+ lea S0, r3
+ m5
+ m7
+ inc r1
+; comment
+ m2
+ hlt
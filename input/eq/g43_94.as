@@ -0,0 +1,67 @@
+S0: .data 5
+; comment
+ add #2, r4
+mcr m0
+ not r5
+ add #2, r4
+ clr r6
+endmcr
+ add #2, r4
+mcr m1
+endmcr
+ not r5
+
+ .data 1, 2
+; comment
+L0: .space 2
+ m1
+ inc r2
+L1: .space 2
+; comment
+L2: not r5
+ inc r1
+ inc r1
+ m1
+ m0
+ .string "ab"
+L3: red r7
+ sub r1, r2
+ .data 1, 2
+ lea S0, r3
+ m0
+ m0
+mcr m2
+ lea S0, r3
+ lea S0, r3
+ 
+ prn #3
+endmcr
+ prn #3
+ inc r2
+ prn #3
+
+ not r5
+; comment
+ lea S0, r3
+ not r5
+
+ m0
+ not r5
+ m0
+L4: not r5
+ sub r1, r2
+ m2
+L5: prn #3
+ inc r2
+ m0
+
+L6: mov r1, r2
+ .space 2
+ m1
+mcr m3
+endmcr
+L7: .fill 3, 7
+ mov r1, r2
+ m2
+ .fill 3, 7
+ hlt
@@ -0,0 +1,88 @@
+S0: .data 5
+ .string "ab"
+ prn #3
+mcr m0
+endmcr
+ .data 1, 2
+ m0
+ mov r1, r2
+ clr r6
+ m0
+L0: lea S0, r3
+; comment
+ m0
+mcr m1
+endmcr
+ .space 2
+ m0
+; comment
+ lea S0, r3
+ cmp r3, #-1
+ mov r1, r2
+ mov r1, r2
+mcr m2
+ ;c
+endmcr
+; comment
+ .space 2
+ .string "ab"
+ .data 1, 2
+ m2
+ red r7
+ cmp r3, #-1
+ m2
+ m0
+ m0
+ m2
+ m0
+ m1
+L1: .space 2
+ .space 2
+ .space 2
+ m0
+ .string "ab"
+ m2
+ clr r6
+ red r7
+ .fill 3, 7
+ inc r2
+mcr m3
+ not r5
+ cmp r3, #-1
+ add #2, r4
+ inc r1
+endmcr
+ m3
+ m0
+ m1
+L2: cmp r3, #-1
+ clr r6
+
+ not r5
+; comment
+L3: cmp r3, #-1
+ sub r1, r2
+mcr m4
+ red r7
+ sub r1, r2
+ mov r1, r2
+ mov r1, r2
+endmcr
+; comment
+ sub r1, r2
+ m2
+ m4
+ .string "ab"
+mcr m5
+ sub r1, r2
+ mov r1, r2
+ inc r1
+endmcr
+ not r5
+ m0
+ inc r2
+ inc r2
+ .fill 3, 7
+ m1
+ .space 2
+ hlt
@@ -0,0 +1,70 @@
+S0: .data 5
+; comment
+L0: cmp r3, #-1
+; comment
+mcr m0
+endmcr
+ m0
+mcr m1
+ not r5
+ add #2, r4
+endmcr
+ m0
+ red r7
+ inc r2
+ m1
+ .fill 3, 7
+ m0
+mcr m2
+ sub r1, r2
+ cmp r3, #-1
+ not r5
+endmcr
+mcr m3
+ lea S0, r3
+endmcr
+ sub r1, r2
+ .space 2
+ m1
+ clr r6
+mcr m4
+ not r5
+ ;c
+ lea S0, r3
+ ;c
+endmcr
+
+ mov r1, r2
+ cmp r3, #-1
+ .fill 3, 7
+ m4
+ prn #3
+ m3
+mcr m5
+ prn #3
+endmcr
+L1: mov r1, r2
+
+L2: .fill 3, 7
+ inc r1
+ mov r1, r2
+L3: prn #3
+mcr m6
+ add #2, r4
+ ;c
+endmcr
+ sub r1, r2
+ m0
+ m4
+ m2
+ m2
+ .space 2
+mcr m7
+ not r5
+ clr r6
+ prn #3
+endmcr
+mcr m8
+endmcr
+
+ hlt
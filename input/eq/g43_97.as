@@ -0,0 +1,47 @@
+S0: .data 5
+
+ .space 2
+mcr m0
+endmcr
+L0: inc r1
+ add #2, r4
+mcr m1
+ red r7
+ ;c
+ mov r1, r2
+endmcr
+ cmp r3, #-1
+ m1
+ prn #3
+ m0
+mcr m2
+ mov r1, r2
+endmcr
+ sub r1, r2
+L1: lea S0, r3
+mcr m3
+endmcr
+L2: cmp r3, #-1
+ prn #3
+ m0
+L3: cmp r3, #-1
+ inc r1
+ m0
+ sub r1, r2
+ inc r1
+
+
+mcr m4
+ inc r1
+ inc r1
+ sub r1, r2
+ ;c
+endmcr
+ sub r1, r2
+ clr r6
+ m0
+ .fill 3, 7
+ not r5
+ cmp r3, #-1
+ m0
+ hlt
@@ -0,0 +1,60 @@
+S0: .data 5
+ inc r1
+mcr m0
+ add #2, r4
+ 
+ ;c
+endmcr
+ .fill 3, 7
+ m0
+ .fill 3, 7
+; comment
+ .fill 3, 7
+ .fill 3, 7
+mcr m1
+ cmp r3, #-1
+ sub r1, r2
+ prn #3
+endmcr
+; comment
+L0: .space 2
+ prn #3
+ m1
+ sub r1, r2
+ prn #3
+ m0
+L1: sub r1, r2
+ inc r1
+ sub r1, r2
+L2: sub r1, r2
+mcr m2
+ cmp r3, #-1
+ not r5
+ add #2, r4
+ cmp r3, #-1
+endmcr
+L3: inc r1
+ red r7
+ .fill 3, 7
+
+; comment
+ add #2, r4
+ m0
+ m2
+mcr m3
+ ;c
+ 
+endmcr
+ m3
+ .space 2
+; comment
+ .fill 3, 7
+
+
+ .string "ab"
+ .data 1, 2
+; comment
+ clr r6
+ clr r6
+
+ hlt
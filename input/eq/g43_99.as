@@ -0,0 +1,60 @@
+S0: .data 5
+; comment
+ cmp r3, #-1
+ add #2, r4
+ .string "ab"
+L0: red r7
+ lea S0, r3
+ not r5
+L1: cmp r3, #-1
+ .space 2
+mcr m0
+ ;c
+ mov r1, r2
+ red r7
+ not r5
+endmcr
+; comment
+ m0
+
+; comment
+ mov r1, r2
+ lea S0, r3
+mcr m1
+ cmp r3, #-1
+endmcr
+L2: .string "ab"
+ lea S0, r3
+ m0
+mcr m2
+endmcr
+ m2
+ mov r1, r2
+ prn #3
+mcr m3
+ prn #3
+ sub r1, r2
+endmcr
+; comment
+ inc r1
+
+ .space 2
+; comment
+L3: inc r1
+ lea S0, r3
+ m3
+ m0
+ m1
+L4: clr r6
+ m2
+ .fill 3, 7
+ m2
+ m0
+ inc r1
+mcr m4
+ clr r6
+endmcr
+; comment
+ clr r6
+L5: sub r1, r2
+ hlt
@@ -0,0 +1,3001 @@
+.define K0 = 63
+.define K1 = 49
+.define K2 = 37
+.define K3 = 28
+.extern X0
+.extern X1
+.extern X2
+.extern X3
+.extern X4
+.extern X5
+.extern X6
+.extern X7
+.extern X8
+.extern X9
+.extern X10
+.extern X11
+.extern X12
+.extern X13
+.extern X14
+.extern X15
+MAIN:   mov  r0, r1
+L0:   dec  r4
+L1:   rts
+L2:   rts
+L3:   mov  L0[K3], L0
+L4:   red  r0
+L5:   rts
+L6:   clr  r6
+L7:   clr  L6
+L8:   bne  L1
+L9:   red  L8
+L10:   inc  r0
+L11:   bne  L7
+L12:   prn  r7
+L13:   not  L8
+.entry L0
+L14:   add  L4[K2], r1
+L15:   dec  L9
+L16:   jsr  r0
+L17:   lea  L8[K0], L8[6]
+L18:   rts
+L19:   lea  L6[8], L14
+L20:   dec  L3[K2]
+L21:   bne  L8
+L22:   cmp  r4, L2[K3]
+L23:   prn  L17[12]
+L24:   add  L0, r3
+L25:   rts
+L26:   add  L14[K3], L14[10]
+L27:   inc  r2
+L28:   hlt
+L29:   cmp  L21[15], #-1415
+L30:   sub  r5, L21[K1]
+L31:   dec  r5
+L32:   add  #1485, L1
+L33:   sub  r7, L25
+L34:   jmp  L22
+L35:   rts
+L36:   dec  r1
+L37:   mov  #444, r1
+L38:   dec  L14[K0]
+L39:   hlt
+L40:   prn  L10[14]
+L41:   bne  L25
+L42:   mov  L22, L16
+L43:   inc  r4
+L44:   bne  r5
+L45:   lea  L13[7], L29[K2]
+L46:   prn  #K3
+L47:   jsr  r0
+L48:   add  L42[0], L11
+L49:   cmp  L19[K2], L38[K3]
+L50:   hlt
+L51:   dec  L41
+L52:   rts
+L53:   cmp  r6, r1
+L54:   inc  L29[15]
+L55:   not  L17[K0]
+L56:   red  L29
+L57:   add  L38[9], r5
+L58:   inc  L31
+L59:   rts
+L60:   mov  L58[K1], L28[7]
+L61:   prn  L60[K0]
+L62:   sub  r6, r0
+L63:   inc  L15
+L64:   rts
+L65:   not  r2
+L66:   prn  r3
+L67:   not  L19[K2]
+L68:   not  r0
+L69:   sub  r2, r2
+L70:   jmp  r7
+L71:   rts
+L72:   red  r5
+L73:   sub  #1615, L52[14]
+L74:   sub  L55[10], L12[8]
+L75:   inc  r1
+L76:   dec  L36[2]
+L77:   jmp  L63
+L78:   inc  r3
+L79:   rts
+L80:   inc  L44[14]
+L81:   clr  r5
+L82:   sub  r6, L53[K1]
+L83:   sub  L3, L4[10]
+L84:   bne  L17
+L85:   prn  L83[9]
+L86:   hlt
+L87:   rts
+L88:   sub  r6, L25
+L89:   mov  #1042, r4
+L90:   hlt
+L91:   not  L10
+L92:   clr  r0
+L93:   jsr  r5
+L94:   clr  r4
+L95:   jsr  r0
+L96:   sub  r1, r2
+L97:   mov  L75, L78
+L98:   bne  r3
+L99:   red  X15
+L100:   add  L77[K3], r7
+L101:   red  L66
+L102:   hlt
+L103:   bne  L8
+L104:   mov  L49, L35[10]
+L105:   dec  L69[K1]
+L106:   red  r5
+L107:   add  #-1592, L104[13]
+L108:   jsr  r2
+L109:   mov  L50, r3
+L110:   not  L85[3]
+L111:   rts
+L112:   jsr  r5
+L113:   lea  L9, L65[K1]
+L114:   lea  L52, L35
+L115:   cmp  L87, L86[6]
+L116:   hlt
+L117:   add  L113, r3
+L118:   dec  L23[K1]
+L119:   prn  L93
+L120:   rts
+L121:   cmp  r3, r7
+L122:   dec  r3
+L123:   sub  #-1789, r1
+L124:   inc  L37
+L125:   hlt
+L126:   bne  r5
+L127:   mov  #1089, L76[K2]
+L128:   prn  L93
+L129:   mov  L33, L70[K2]
+L130:   dec  L60
+L131:   add  L22[2], L39
+L132:   bne  L102
+L133:   cmp  L52, L110
+L134:   bne  r4
+L135:   jmp  r3
+L136:   cmp  r3, r4
+L137:   not  L8
+L138:   lea  L70[K0], r7
+L139:   inc  r3
+L140:   clr  L28[K2]
+L141:   not  L120[K3]
+L142:   hlt
+L143:   bne  L42
+L144:   not  L59
+L145:   jmp  L83
+L146:   jmp  L20
+L147:   not  L138[K2]
+L148:   lea  L54, r2
+L149:   mov  #-1149, L101
+L150:   rts
+L151:   dec  L146[K1]
+L152:   jsr  L146
+L153:   prn  L121[K3]
+L154:   lea  L14[K1], L8
+L155:   inc  L15
+L156:   mov  r3, r5
+L157:   clr  r3
+L158:   jmp  r4
+L159:   jmp  L7
+L160:   jsr  L3
+L161:   red  L94
+L162:   clr  L123[K1]
+L163:   jmp  r3
+L164:   cmp  L99, L5
+L165:   inc  r6
+L166:   cmp  #567, #952
+L167:   rts
+L168:   add  L153, L119
+L169:   not  L20
+L170:   red  r3
+L171:   bne  r6
+L172:   mov  L155[5], L127[9]
+L173:   rts
+L174:   add  r5, r7
+L175:   red  r5
+L176:   jsr  r6
+L177:   prn  L41
+L178:   prn  r6
+L179:   add  r5, L94[10]
+L180:   jsr  r1
+L181:   jmp  r4
+L182:   sub  r4, L32
+L183:   red  L176
+L184:   lea  L121[7], L176[7]
+L185:   not  L125[9]
+L186:   jmp  r4
+L187:   prn  L132[K2]
+L188:   bne  L74
+L189:   clr  r6
+L190:   hlt
+L191:   bne  r5
+L192:   inc  r6
+L193:   rts
+L194:   dec  L140[K2]
+L195:   lea  L84[2], r3
+L196:   cmp  r0, L106
+L197:   not  r0
+L198:   lea  L59[K0], L49[K0]
+L199:   red  r7
+L200:   lea  L145[10], r7
+L201:   prn  #487
+L202:   not  L73
+L203:   lea  L117, L67[K1]
+L204:   rts
+L205:   lea  L24, r0
+L206:   clr  L58[K0]
+L207:   red  L95[8]
+L208:   cmp  r0, #-744
+L209:   jmp  r2
+L210:   hlt
+L211:   red  r1
+L212:   cmp  L25[K2], L48
+L213:   dec  L176
+L214:   rts
+L215:   clr  L202
+L216:   inc  L162[K0]
+L217:   rts
+L218:   red  r1
+L219:   not  L178[K3]
+L220:   hlt
+L221:   jsr  r0
+L222:   red  r6
+L223:   jmp  L30
+L224:   inc  L170
+L225:   hlt
+L226:   not  L151
+L227:   jmp  r5
+L228:   red  r1
+L229:   red  L36
+L230:   mov  r3, L82
+L231:   add  L87[K1], r3
+L232:   prn  #K3
+L233:   rts
+L234:   mov  #545, L185[K2]
+L235:   inc  L211
+L236:   cmp  #-1183, L101[K0]
+L237:   rts
+L238:   prn  L214
+L239:   jmp  r0
+L240:   red  r1
+L241:   rts
+L242:   jsr  r3
+L243:   cmp  r5, L148[4]
+L244:   inc  L187
+L245:   dec  L82[K1]
+L246:   jsr  L89
+L247:   not  L220[14]
+L248:   add  #-1455, L75[8]
+L249:   cmp  L59, r3
+L250:   add  L95, L36
+L251:   jsr  r4
+L252:   hlt
+L253:   clr  r7
+L254:   sub  #1273, r2
+L255:   red  L126[K3]
+L256:   dec  r3
+L257:   lea  L158, L64
+L258:   clr  r4
+L259:   prn  L238[K0]
+L260:   not  L228
+L261:   rts
+L262:   inc  r6
+L263:   dec  r5
+L264:   add  L45[4], r5
+L265:   not  r3
+L266:   lea  L232[3], r0
+L267:   sub  #1926, L67[7]
+L268:   add  L254, r5
+L269:   sub  #-412, r0
+L270:   mov  L16[K2], L0[K1]
+L271:   mov  #-1332, r6
+L272:   clr  L72[K2]
+L273:   not  L214[K3]
+L274:   mov  L219[K3], L245[K1]
+L275:   hlt
+L276:   mov  #727, r1
+L277:   hlt
+L278:   lea  L230[K0], L49[K0]
+L279:   hlt
+L280:   bne  L76
+L281:   bne  r3
+L282:   dec  r2
+L283:   prn  #K3
+L284:   add  r2, L244
+L285:   rts
+L286:   not  r3
+L287:   prn  r1
+L288:   cmp  L235[13], r7
+L289:   sub  #1445, L230[K0]
+L290:   bne  L213
+L291:   hlt
+L292:   inc  r1
+L293:   not  L138[K3]
+L294:   rts
+L295:   hlt
+L296:   jsr  r1
+L297:   not  L24
+L298:   bne  L155
+L299:   mov  L185[K0], X6
+L300:   rts
+L301:   inc  r1
+L302:   hlt
+L303:   bne  L242
+L304:   bne  L71
+L305:   cmp  L232[13], L53[6]
+L306:   dec  r4
+L307:   inc  L27
+L308:   bne  r2
+L309:   inc  L79[0]
+L310:   hlt
+L311:   bne  L271
+L312:   inc  r7
+L313:   bne  r7
+L314:   lea  L261, r3
+L315:   inc  L15
+L316:   rts
+L317:   dec  L61[K3]
+L318:   cmp  r1, L293
+L319:   rts
+L320:   cmp  L182, r6
+L321:   bne  r6
+L322:   dec  L1
+L323:   lea  L172, L4
+L324:   lea  L20[6], r1
+L325:   hlt
+L326:   mov  #1830, r2
+L327:   prn  L123[5]
+L328:   rts
+L329:   jsr  r4
+L330:   not  L82
+L331:   red  L169
+L332:   cmp  r6, L140
+L333:   sub  L101, r5
+L334:   clr  r4
+L335:   mov  r0, L15
+L336:   cmp  L237, L34[K3]
+L337:   inc  L257[K0]
+L338:   rts
+L339:   bne  r7
+L340:   rts
+L341:   prn  #-1462
+L342:   lea  L133, L297
+L343:   prn  L169
+L344:   lea  L288, L102[K3]
+L345:   mov  L278[K2], r4
+L346:   not  L138
+L347:   bne  L150
+L348:   red  L241[6]
+L349:   dec  r4
+L350:   dec  L162[8]
+L351:   rts
+L352:   red  L283
+L353:   jmp  r4
+L354:   inc  r2
+L355:   clr  L310[11]
+L356:   cmp  L94[K3], r5
+L357:   mov  L332, r2
+L358:   cmp  L347, r5
+L359:   inc  L355
+L360:   prn  r1
+L361:   inc  L141
+L362:   bne  r6
+L363:   sub  r2, L26
+L364:   jmp  L296
+L365:   not  L95
+L366:   sub  L249, L102
+L367:   jsr  r5
+L368:   prn  L35
+L369:   not  L36
+L370:   inc  L366
+L371:   not  L307
+L372:   jsr  L277
+L373:   mov  L310[K1], L239[K3]
+L374:   mov  L225, L76
+L375:   lea  L6[K3], L344
+L376:   jmp  r5
+L377:   not  L349[15]
+L378:   rts
+L379:   rts
+L380:   bne  r1
+L381:   sub  r0, r1
+L382:   red  L95
+L383:   rts
+L384:   rts
+L385:   prn  #1174
+L386:   sub  #-833, L178
+L387:   add  L302[K1], r1
+L388:   rts
+L389:   sub  L294[K0], L288[K1]
+L390:   add  r2, L87
+L391:   sub  #380, L109[10]
+L392:   bne  L154
+L393:   mov  r3, L278[K2]
+L394:   jsr  L82
+L395:   red  L182[12]
+L396:   add  L229, L22[K1]
+L397:   sub  #-955, L350
+L398:   sub  L16, X0
+L399:   hlt
+L400:   add  L244, L211[5]
+L401:   lea  L228[K3], r0
+L402:   prn  r2
+L403:   bne  L124
+L404:   red  r1
+L405:   clr  r3
+L406:   red  L264[K0]
+L407:   not  L21
+L408:   mov  L135[K1], L141[K2]
+L409:   jmp  r1
+L410:   prn  L122[K0]
+L411:   clr  L364[K2]
+L412:   lea  L68, L90
+L413:   add  L276[3], L382
+L414:   inc  L299[K1]
+L415:   prn  L39[8]
+L416:   add  L87, L5[K1]
+L417:   jsr  r3
+L418:   jsr  L374
+L419:   add  L219, L161[K1]
+L420:   mov  #1311, L343
+L421:   prn  L188
+L422:   mov  L352[K2], r2
+L423:   inc  L374[13]
+L424:   red  L251[K2]
+L425:   red  r0
+L426:   rts
+L427:   dec  L44[1]
+L428:   red  L367
+L429:   mov  L403, L89[5]
+L430:   hlt
+L431:   lea  L294[K1], r6
+L432:   add  #842, L102[K3]
+L433:   sub  L196[3], L7[K2]
+L434:   inc  L183[11]
+L435:   add  r5, r4
+L436:   inc  L421
+L437:   red  r3
+L438:   cmp  L359[K1], L433
+L439:   inc  L369[K2]
+L440:   lea  L147, X2
+L441:   red  L213[K1]
+L442:   mov  #966, r7
+L443:   jsr  r3
+L444:   lea  L436[K0], L355[K0]
+L445:   rts
+L446:   hlt
+L447:   sub  L439, L345[K0]
+L448:   dec  L95
+L449:   red  L416
+L450:   cmp  #979, r4
+L451:   bne  r5
+L452:   clr  X10
+L453:   mov  #1180, r2
+L454:   bne  r4
+L455:   jsr  L410
+L456:   bne  r2
+L457:   prn  L67
+L458:   bne  L234
+L459:   hlt
+L460:   add  L324[2], L135
+L461:   jmp  L108
+L462:   dec  r6
+L463:   cmp  L152[K1], L314
+L464:   jmp  r4
+L465:   hlt
+L466:   sub  L110, L76[K1]
+L467:   mov  r7, L272
+L468:   hlt
+L469:   add  #1180, r0
+L470:   jmp  r4
+L471:   prn  #K1
+L472:   jmp  L461
+L473:   jmp  L62
+L474:   jmp  r1
+L475:   clr  L403
+L476:   cmp  L89[K0], L130[K3]
+L477:   rts
+L478:   red  L367
+L479:   lea  L383, L333
+L480:   hlt
+L481:   inc  L237
+L482:   rts
+L483:   clr  L84
+L484:   inc  L466[K1]
+L485:   prn  L314
+L486:   jsr  r6
+L487:   bne  L371
+L488:   prn  #1833
+L489:   not  r1
+L490:   clr  L82[1]
+L491:   jmp  r3
+L492:   prn  L478[K1]
+L493:   hlt
+L494:   bne  r4
+L495:   jsr  L117
+L496:   inc  L32
+L497:   dec  L70[5]
+L498:   jmp  r2
+L499:   jmp  r1
+L500:   jsr  L183
+L501:   jmp  L484
+L502:   mov  r2, L416
+L503:   lea  L478[13], r5
+L504:   bne  r0
+L505:   red  L341[10]
+L506:   bne  L138
+L507:   cmp  L402, #K3
+L508:   not  L84[2]
+L509:   clr  r5
+L510:   dec  L37
+L511:   add  #-1412, L385[K2]
+L512:   jsr  r7
+L513:   dec  L149
+L514:   dec  L162[K2]
+L515:   lea  L139[7], L197[12]
+L516:   jmp  L284
+L517:   inc  L480[8]
+L518:   rts
+L519:   bne  r5
+L520:   bne  L139
+L521:   prn  L43
+L522:   prn  L508
+L523:   red  r0
+L524:   not  L241[3]
+L525:   rts
+L526:   prn  L16
+L527:   hlt
+L528:   jsr  L78
+L529:   jsr  L328
+L530:   dec  L374
+L531:   hlt
+L532:   prn  L68
+L533:   lea  L301, L330[K3]
+L534:   prn  L318
+L535:   mov  #-1134, r0
+L536:   not  L241
+L537:   lea  L355, L378[2]
+L538:   prn  r3
+L539:   not  r1
+L540:   jmp  r7
+L541:   jmp  r7
+L542:   jsr  r0
+L543:   jsr  L455
+L544:   cmp  r1, #1709
+L545:   sub  L371[K3], L317[K0]
+L546:   lea  L485, L303
+L547:   jsr  r4
+L548:   sub  L385[4], L522
+L549:   red  L411
+L550:   lea  L514, r2
+L551:   mov  L40, L181
+L552:   inc  r4
+L553:   bne  r5
+L554:   lea  L389, L120
+L555:   add  #678, r4
+L556:   cmp  #-1231, L43
+L557:   cmp  r2, r2
+L558:   dec  r1
+L559:   mov  L550[K3], L310[12]
+L560:   dec  L255
+L561:   rts
+L562:   cmp  r6, r1
+L563:   inc  L451[15]
+L564:   not  L180[K0]
+L565:   red  r1
+L566:   red  L85
+L567:   jsr  r3
+L568:   mov  L190[K2], L40
+L569:   rts
+L570:   rts
+L571:   jmp  r2
+L572:   sub  r1, L46
+L573:   red  L444[7]
+L574:   dec  L530
+L575:   not  L71[13]
+L576:   lea  L11, L4[1]
+L577:   mov  #-1460, r3
+L578:   red  L188[K1]
+L579:   prn  r6
+L580:   red  L17[K1]
+L581:   jsr  r6
+L582:   mov  r0, L173[6]
+L583:   jmp  L19
+L584:   lea  L258, L432[K3]
+L585:   bne  L210
+L586:   inc  L496[K2]
+L587:   inc  L57[14]
+L588:   clr  L63
+L589:   not  r2
+L590:   jsr  r6
+L591:   rts
+L592:   add  #1722, L373
+L593:   jmp  L514
+L594:   cmp  r2, L262
+L595:   jmp  L62
+L596:   red  L494
+L597:   dec  L145
+L598:   mov  #-1210, r0
+L599:   sub  r1, X8
+L600:   clr  L237
+L601:   clr  r5
+L602:   cmp  L481, r3
+L603:   mov  L185[K0], X3
+L604:   bne  r3
+L605:   red  r1
+L606:   add  L149, L505[K2]
+L607:   cmp  r3, L2
+L608:   hlt
+L609:   rts
+L610:   red  L223
+L611:   add  L253[K1], r1
+L612:   clr  L417[2]
+L613:   lea  L450[K1], L449[K3]
+L614:   add  L263, r4
+L615:   prn  L216
+L616:   hlt
+L617:   dec  L363[K1]
+L618:   red  L214
+L619:   dec  L263
+L620:   sub  r4, r3
+L621:   jsr  L88
+L622:   lea  L505, L79[14]
+L623:   not  r1
+L624:   hlt
+L625:   clr  L410[7]
+L626:   cmp  #622, L126[6]
+L627:   cmp  r3, r7
+L628:   dec  L179
+L629:   jmp  L443
+L630:   lea  L131[K2], L22[K0]
+L631:   bne  L495
+L632:   dec  L488[K0]
+L633:   jsr  L258
+L634:   mov  #-1842, L632
+L635:   dec  r4
+L636:   red  r5
+L637:   add  r2, r3
+L638:   bne  L48
+L639:   cmp  L119, L174
+L640:   bne  r4
+L641:   jmp  r3
+L642:   cmp  r3, r4
+L643:   not  r6
+L644:   not  r6
+L645:   inc  r4
+L646:   hlt
+L647:   prn  L515[K3]
+L648:   inc  r0
+L649:   dec  r3
+L650:   hlt
+L651:   bne  L510
+L652:   not  L587
+L653:   jmp  L106
+L654:   jmp  L280
+L655:   not  L384[K2]
+L656:   lea  L610, L344[15]
+L657:   inc  L612
+L658:   add  #-543, r7
+L659:   cmp  #-403, r1
+L660:   add  #988, r6
+L661:   lea  L157, r6
+L662:   jmp  r2
+L663:   dec  L521[K1]
+L664:   bne  L659
+L665:   hlt
+L666:   mov  L446, r7
+L667:   mov  #-897, L160
+L668:   jmp  r5
+L669:   hlt
+L670:   mov  L257, r2
+L671:   add  #1553, L217
+L672:   jsr  L344
+L673:   hlt
+L674:   rts
+L675:   cmp  #1703, #1288
+L676:   rts
+L677:   add  #859, L345[9]
+L678:   mov  r6, L73
+L679:   sub  #254, r7
+L680:   red  r7
+L681:   inc  r1
+L682:   sub  L174[K2], L295
+L683:   jsr  r1
+L684:   jsr  L521
+L685:   lea  L129[2], r4
+L686:   red  L107[K2]
+L687:   red  r3
+L688:   rts
+L689:   red  L350[4]
+L690:   sub  r4, L384
+L691:   red  r7
+L692:   clr  L151
+L693:   clr  r1
+L694:   jsr  L102
+L695:   clr  X9
+L696:   jsr  r4
+L697:   bne  L305
+L698:   sub  L608, L350[K1]
+L699:   rts
+L700:   clr  r3
+L701:   rts
+L702:   rts
+L703:   dec  r4
+L704:   lea  L633, r2
+L705:   add  #-335, r0
+L706:   add  #-281, L650[K0]
+L707:   sub  L72[3], L106
+L708:   bne  r3
+L709:   jmp  r6
+L710:   add  L96[7], L432[K3]
+L711:   not  L661[6]
+L712:   sub  #38, L42[10]
+L713:   rts
+L714:   clr  L658
+L715:   sub  L49, r7
+L716:   sub  L224[K1], L365
+L717:   hlt
+L718:   mov  L261, L159[2]
+L719:   red  r1
+L720:   cmp  L165[K2], L536
+L721:   dec  L625[K1]
+L722:   prn  #K1
+L723:   hlt
+L724:   inc  L238[K0]
+L725:   rts
+L726:   red  r1
+L727:   not  r1
+L728:   cmp  L45, #K3
+L729:   lea  L673[K0], L13[K1]
+L730:   jmp  L195
+L731:   bne  L114
+L732:   rts
+L733:   hlt
+L734:   clr  L45[9]
+L735:   dec  r2
+L736:   inc  r0
+L737:   cmp  r2, L332[15]
+L738:   rts
+L739:   bne  r7
+L740:   hlt
+L741:   rts
+L742:   mov  L129[K0], L16
+L743:   jmp  r3
+L744:   cmp  #-175, L449[K0]
+L745:   rts
+L746:   prn  L140
+L747:   jmp  r0
+L748:   red  L16
+L749:   dec  L314
+L750:   cmp  r5, L86[4]
+L751:   inc  L562[3]
+L752:   add  #573, r4
+L753:   jsr  L109
+L754:   not  r1
+L755:   mov  L685, L379
+L756:   jmp  L51
+L757:   add  L536[13], L64[K0]
+L758:   inc  r5
+L759:   inc  r7
+L760:   clr  r7
+L761:   sub  #496, L78
+L762:   jmp  L455
+L763:   prn  r7
+L764:   not  r2
+L765:   jsr  r5
+L766:   mov  #-394, L571
+L767:   prn  L494[K0]
+L768:   clr  L126[5]
+L769:   lea  L388, L494
+L770:   jsr  L149
+L771:   clr  r2
+L772:   add  #-1823, r1
+L773:   sub  L642, L536
+L774:   cmp  L160, #K2
+L775:   red  L151
+L776:   red  L248
+L777:   add  r4, L633[K3]
+L778:   not  L513
+L779:   dec  L437[K1]
+L780:   red  L42[K3]
+L781:   clr  L721
+L782:   clr  r7
+L783:   sub  r4, L146
+L784:   inc  L228
+L785:   dec  r6
+L786:   sub  L508, L494
+L787:   jsr  r5
+L788:   jsr  L180
+L789:   bne  L379
+L790:   add  L541[14], L358[K3]
+L791:   not  r3
+L792:   prn  r1
+L793:   cmp  L792[13], r7
+L794:   sub  #-1574, r7
+L795:   prn  r3
+L796:   red  L713[15]
+L797:   inc  L89[12]
+L798:   mov  L97[15], L444[1]
+L799:   jsr  r1
+L800:   not  r3
+L801:   sub  L774, L160[K1]
+L802:   lea  L692, L610
+L803:   not  L284
+L804:   prn  L122
+L805:   hlt
+L806:   lea  L691[K3], L763
+L807:   bne  r7
+L808:   red  L324[K2]
+L809:   jmp  r5
+L810:   jmp  L463
+L811:   add  L358, L726
+L812:   bne  L686
+L813:   inc  L369[K2]
+L814:   clr  L107
+L815:   red  L28[K3]
+L816:   inc  L606
+L817:   dec  L146[K3]
+L818:   cmp  r1, L263
+L819:   rts
+L820:   cmp  L98, r6
+L821:   bne  r6
+L822:   dec  r6
+L823:   lea  L604[K2], L210
+L824:   mov  #-1709, L129[7]
+L825:   jsr  r2
+L826:   not  L510[K2]
+L827:   add  r6, L425[K3]
+L828:   jsr  r4
+L829:   not  L531
+L830:   red  L105[K3]
+L831:   clr  r0
+L832:   inc  r6
+L833:   clr  L89
+L834:   lea  L447, r7
+L835:   hlt
+L836:   jsr  r2
+L837:   hlt
+L838:   jsr  L457
+L839:   bne  L826
+L840:   bne  L583
+L841:   rts
+L842:   mov  L50, L830
+L843:   jsr  L540
+L844:   bne  r3
+L845:   lea  L335, r1
+L846:   red  L756
+L847:   cmp  #650, #K3
+L848:   cmp  #1316, L458[10]
+L849:   sub  r6, L798[1]
+L850:   dec  L386[K2]
+L851:   dec  L166
+L852:   mov  L683, r3
+L853:   jmp  r4
+L854:   inc  L515[5]
+L855:   jmp  r3
+L856:   cmp  L302[K3], r5
+L857:   mov  L525, r2
+L858:   cmp  L347, r5
+L859:   inc  L391[K3]
+L860:   sub  r3, L511
+L861:   sub  L504, L449[6]
+L862:   red  L548
+L863:   prn  #K1
+L864:   jsr  L547
+L865:   hlt
+L866:   jsr  L96
+L867:   jsr  r1
+L868:   clr  L277
+L869:   cmp  L335, L847
+L870:   lea  L1[3], X4
+L871:   rts
+L872:   mov  r6, L520[8]
+L873:   hlt
+L874:   rts
+L875:   jmp  L777
+L876:   jsr  r6
+L877:   jsr  r5
+L878:   cmp  #1792, L557[13]
+L879:   lea  L152, L312
+L880:   mov  L51, L213
+L881:   inc  L423[K3]
+L882:   cmp  L131[14], #-1987
+L883:   prn  #-1914
+L884:   sub  L260[3], r4
+L885:   mov  L794, L855[K0]
+L886:   dec  L349[K2]
+L887:   dec  L39[K0]
+L888:   cmp  L122, L501
+L889:   bne  L270
+L890:   rts
+L891:   jmp  r0
+L892:   mov  L736[5], L135[14]
+L893:   sub  r1, r0
+L894:   sub  L504, r2
+L895:   prn  L364
+L896:   prn  #K1
+L897:   sub  L422[K2], L629
+L898:   prn  L154[K3]
+L899:   inc  r4
+L900:   lea  L420, L485[K3]
+L901:   add  L754, r2
+L902:   prn  r3
+L903:   prn  #840
+L904:   cmp  L538[K1], r3
+L905:   clr  r0
+L906:   hlt
+L907:   clr  L354[K3]
+L908:   cmp  L782, L863[4]
+L909:   dec  r6
+L910:   red  L822[K0]
+L911:   cmp  L378[K3], r2
+L912:   clr  L13[K0]
+L913:   red  L57
+L914:   jmp  r1
+L915:   prn  #1800
+L916:   add  L335, L601[K1]
+L917:   jsr  r3
+L918:   jsr  L842
+L919:   add  r4, r7
+L920:   cmp  #-496, L781
+L921:   prn  r1
+L922:   cmp  #31, L138
+L923:   lea  L873, L288[K3]
+L924:   jsr  L755
+L925:   lea  L183[K3], L569[11]
+L926:   inc  L186[11]
+L927:   sub  L872, r5
+L928:   bne  r7
+L929:   cmp  L863, #-532
+L930:   sub  #1833, r1
+L931:   bne  r2
+L932:   bne  r0
+L933:   prn  r2
+L934:   bne  L93
+L935:   cmp  L620, r4
+L936:   add  L255, L525
+L937:   jsr  L614
+L938:   jsr  r1
+L939:   clr  r4
+L940:   cmp  L382, L222
+L941:   lea  L74, L495[K1]
+L942:   dec  L357[6]
+L943:   inc  r6
+L944:   jsr  r3
+L945:   lea  L633[K0], L225[K0]
+L946:   rts
+L947:   hlt
+L948:   sub  L133, r2
+L949:   bne  r0
+L950:   prn  r0
+L951:   rts
+L952:   rts
+L953:   red  L136[K3]
+L954:   clr  L290[7]
+L955:   cmp  #679, L940[K0]
+L956:   red  r6
+L957:   rts
+L958:   red  L879
+L959:   sub  L502, L843[K0]
+L960:   lea  L893[K2], r3
+L961:   prn  r6
+L962:   add  L754[0], r0
+L963:   dec  L168
+L964:   jmp  L598
+L965:   cmp  #-1186, L360[9]
+L966:   jsr  L252
+L967:   clr  L369
+L968:   mov  r7, L287
+L969:   hlt
+L970:   add  #812, r0
+L971:   jmp  r4
+L972:   prn  #K1
+L973:   jmp  L829
+L974:   jmp  L945
+L975:   jmp  r1
+L976:   clr  r7
+L977:   jsr  r1
+L978:   add  #1968, L211
+L979:   rts
+L980:   red  r7
+L981:   cmp  r2, L925
+L982:   hlt
+L983:   hlt
+L984:   inc  L559[10]
+L985:   lea  L579[4], r2
+L986:   inc  L538
+L987:   dec  L577[K0]
+L988:   jsr  r6
+L989:   bne  L633
+L990:   prn  #345
+L991:   not  L8[15]
+L992:   mov  #-119, L904
+L993:   cmp  L283[1], L631
+L994:   bne  r2
+L995:   prn  r5
+L996:   hlt
+L997:   inc  L353[K2]
+L998:   clr  L831[10]
+L999:   sub  r1, L404[9]
+L1000:   jsr  L619
+L1001:   jmp  L719
+L1002:   mov  L421[K0], r2
+L1003:   cmp  r5, L713
+L1004:   bne  r0
+L1005:   red  L791[10]
+L1006:   bne  L758
+L1007:   cmp  L906, #K3
+L1008:   not  L76[2]
+L1009:   clr  L874
+L1010:   hlt
+L1011:   rts
+L1012:   not  L954[K0]
+L1013:   jsr  r7
+L1014:   dec  L630[11]
+L1015:   clr  r6
+L1016:   clr  L529
+L1017:   jsr  L839
+L1018:   jmp  L938
+L1019:   inc  L449[8]
+L1020:   rts
+L1021:   bne  r5
+L1022:   bne  L595
+L1023:   prn  L774
+L1024:   prn  L500
+L1025:   red  L887
+L1026:   jmp  r5
+L1027:   mov  L699, L51[12]
+L1028:   hlt
+L1029:   jsr  L127
+L1030:   jsr  L184
+L1031:   dec  L401
+L1032:   hlt
+L1033:   prn  L364
+L1034:   lea  L562, L605[K3]
+L1035:   prn  L999
+L1036:   mov  L616[K2], L412[K2]
+L1037:   inc  L335
+L1038:   dec  L984
+L1039:   hlt
+L1040:   cmp  L151[15], #-1607
+L1041:   sub  r4, r5
+L1042:   hlt
+L1043:   mov  r3, r4
+L1044:   sub  L63, L981[7]
+L1045:   inc  L702
+L1046:   add  L892, L410
+L1047:   jsr  r0
+L1048:   prn  r0
+L1049:   clr  r2
+L1050:   not  L60[12]
+L1051:   red  r4
+L1052:   lea  L1001, r5
+L1053:   inc  L608
+L1054:   inc  L196
+L1055:   hlt
+L1056:   jmp  L13
+L1057:   inc  r5
+L1058:   mov  r7, L597
+L1059:   dec  L988[K3]
+L1060:   add  L188, r2
+L1061:   inc  L745[K2]
+L1062:   inc  L561[K3]
+L1063:   add  L397[K1], L383[4]
+L1064:   lea  L825, L135
+L1065:   mov  L233[K3], L766
+L1066:   jsr  r3
+L1067:   dec  L1064
+L1068:   lea  L101, r7
+L1069:   rts
+L1070:   mov  r6, L817
+L1071:   jmp  r2
+L1072:   sub  L704, L152[K3]
+L1073:   clr  L270[K3]
+L1074:   mov  L252[K2], r4
+L1075:   prn  r3
+L1076:   not  L154
+L1077:   not  L141[12]
+L1078:   bne  r2
+L1079:   jmp  r7
+L1080:   rts
+L1081:   red  r5
+L1082:   sub  L268, r6
+L1083:   dec  L128
+L1084:   cmp  L535[1], L194
+L1085:   dec  L613[2]
+L1086:   jmp  L768
+L1087:   inc  r3
+L1088:   rts
+L1089:   inc  L585
+L1090:   bne  r6
+L1091:   prn  r4
+L1092:   jsr  r6
+L1093:   sub  L589[2], r6
+L1094:   clr  r2
+L1095:   jmp  L936
+L1096:   cmp  L258[K0], X5
+L1097:   red  L386
+L1098:   inc  L920
+L1099:   lea  L962, L405[K1]
+L1100:   lea  X3, r5
+L1101:   cmp  L240, L289
+L1102:   jsr  L225
+L1103:   red  L398
+L1104:   sub  L1090, r1
+L1105:   sub  r1, r5
+L1106:   hlt
+L1107:   add  L130[K3], r7
+L1108:   red  L595
+L1109:   hlt
+L1110:   bne  L715
+L1111:   mov  r3, r6
+L1112:   lea  L876, X4
+L1113:   mov  r7, L424[K1]
+L1114:   clr  r7
+L1115:   mov  L1093[0], L964
+L1116:   bne  r4
+L1117:   not  r5
+L1118:   jsr  r0
+L1119:   prn  L123
+L1120:   clr  r7
+L1121:   inc  L618
+L1122:   rts
+L1123:   jsr  L51
+L1124:   prn  L737
+L1125:   rts
+L1126:   clr  r5
+L1127:   jmp  L558
+L1128:   clr  L262[7]
+L1129:   cmp  #-194, L401[6]
+L1130:   cmp  r3, r7
+L1131:   dec  L27
+L1132:   jmp  L242
+L1133:   lea  L455[K2], L356[K0]
+L1134:   bne  L631
+L1135:   dec  L220
+L1136:   jmp  r6
+L1137:   red  L40
+L1138:   mov  L568[13], L1072[K0]
+L1139:   jmp  L308
+L1140:   prn  #1226
+L1141:   lea  L408, L621[13]
+L1142:   sub  L580[13], r6
+L1143:   red  r0
+L1144:   not  L380[K1]
+L1145:   jmp  r1
+L1146:   dec  L202
+L1147:   jsr  r7
+L1148:   rts
+L1149:   hlt
+L1150:   inc  L892[K2]
+L1151:   clr  L289[K0]
+L1152:   rts
+L1153:   add  r4, L455[K0]
+L1154:   bne  r2
+L1155:   red  L309
+L1156:   not  L383
+L1157:   sub  L397, L673[K0]
+L1158:   add  #-275, L755[K3]
+L1159:   prn  r0
+L1160:   rts
+L1161:   prn  L264
+L1162:   mov  r6, L377[6]
+L1163:   prn  r6
+L1164:   add  r3, L611[K3]
+L1165:   sub  r3, L362[5]
+L1166:   clr  L261
+L1167:   not  r4
+L1168:   hlt
+L1169:   dec  L593[9]
+L1170:   jmp  r7
+L1171:   mov  #1939, L682
+L1172:   add  L853, L699[4]
+L1173:   clr  r0
+L1174:   not  L520[K0]
+L1175:   red  r4
+L1176:   add  r6, L690[K2]
+L1177:   dec  r1
+L1178:   not  X13
+L1179:   rts
+L1180:   hlt
+L1181:   red  L886
+L1182:   inc  r1
+L1183:   sub  r7, r1
+L1184:   dec  L503[13]
+L1185:   red  L1064[6]
+L1186:   red  L456[4]
+L1187:   sub  r0, L323[K2]
+L1188:   not  L881
+L1189:   jsr  r1
+L1190:   jmp  r4
+L1191:   sub  r2, r6
+L1192:   clr  L463
+L1193:   clr  L1050[8]
+L1194:   jsr  r1
+L1195:   rts
+L1196:   jmp  r1
+L1197:   jmp  r4
+L1198:   prn  L982[K2]
+L1199:   bne  L51
+L1200:   clr  L888[K2]
+L1201:   not  L478
+L1202:   bne  L1053
+L1203:   not  L73[K0]
+L1204:   bne  L753
+L1205:   add  L265, L968
+L1206:   mov  r3, L991[K0]
+L1207:   hlt
+L1208:   jmp  r4
+L1209:   red  r2
+L1210:   jmp  L393
+L1211:   bne  L895
+L1212:   hlt
+L1213:   rts
+L1214:   lea  L883, r6
+L1215:   not  r3
+L1216:   rts
+L1217:   lea  L71, L940
+L1218:   add  #116, r0
+L1219:   dec  L639[K2]
+L1220:   dec  L419[K0]
+L1221:   hlt
+L1222:   bne  r5
+L1223:   lea  L1097[K0], L970
+L1224:   dec  L590
+L1225:   clr  L388
+L1226:   bne  r6
+L1227:   prn  r5
+L1228:   bne  L904
+L1229:   prn  L770
+L1230:   not  L186
+L1231:   not  r5
+L1232:   cmp  L102, #-1738
+L1233:   jmp  L1062
+L1234:   inc  L820
+L1235:   hlt
+L1236:   not  r6
+L1237:   hlt
+L1238:   clr  r1
+L1239:   jmp  L954
+L1240:   not  L968[K3]
+L1241:   hlt
+L1242:   red  L397[K2]
+L1243:   bne  r7
+L1244:   hlt
+L1245:   rts
+L1246:   mov  L355[K0], L978
+L1247:   jmp  r3
+L1248:   cmp  #353, L569[K0]
+L1249:   rts
+L1250:   prn  L680
+L1251:   jmp  r0
+L1252:   red  L249[K2]
+L1253:   jmp  r1
+L1254:   add  r4, r2
+L1255:   clr  L266[2]
+L1256:   sub  L1173, L282
+L1257:   jsr  L1174
+L1258:   not  L325
+L1259:   clr  L263[1]
+L1260:   dec  L1223
+L1261:   jsr  L764
+L1262:   cmp  r7, L91[3]
+L1263:   not  L775[7]
+L1264:   mov  r3, L840
+L1265:   dec  L573
+L1266:   inc  L684[K0]
+L1267:   rts
+L1268:   bne  L261
+L1269:   add  #135, r0
+L1270:   lea  L1230, L864[K2]
+L1271:   clr  L1034[5]
+L1272:   lea  L574, L880
+L1273:   jsr  L736
+L1274:   clr  r2
+L1275:   add  L125, X8
+L1276:   not  r5
+L1277:   inc  L605
+L1278:   clr  r0
+L1279:   red  L439
+L1280:   red  r0
+L1281:   not  r2
+L1282:   lea  L892, L322
+L1283:   clr  L434
+L1284:   cmp  r0, #-162
+L1285:   inc  r7
+L1286:   clr  r6
+L1287:   clr  L1045
+L1288:   mov  L383[2], L452
+L1289:   clr  L704
+L1290:   dec  L729
+L1291:   bne  L246
+L1292:   bne  r3
+L1293:   dec  L1050[K2]
+L1294:   inc  L683[K2]
+L1295:   inc  r0
+L1296:   add  r7, L199
+L1297:   hlt
+L1298:   hlt
+L1299:   bne  L423
+L1300:   sub  #-539, L532[K0]
+L1301:   bne  L570
+L1302:   hlt
+L1303:   inc  L1084[12]
+L1304:   mov  L997, L165
+L1305:   jsr  r5
+L1306:   clr  L1245
+L1307:   sub  L644, L875[K1]
+L1308:   lea  L1190, L2
+L1309:   not  L113
+L1310:   prn  L1230
+L1311:   hlt
+L1312:   lea  L705[K3], L797
+L1313:   bne  r7
+L1314:   red  r0
+L1315:   inc  L1236
+L1316:   mov  r2, r2
+L1317:   inc  r5
+L1318:   jsr  r6
+L1319:   inc  L308
+L1320:   mov  r1, r6
+L1321:   jmp  r5
+L1322:   clr  L1045[1]
+L1323:   inc  L950
+L1324:   rts
+L1325:   dec  L464[K3]
+L1326:   cmp  r1, L1071
+L1327:   rts
+L1328:   cmp  L774, r6
+L1329:   bne  r6
+L1330:   dec  L1162[15]
+L1331:   add  #-134, L966
+L1332:   mov  L1176, r3
+L1333:   jsr  r7
+L1334:   mov  #1318, r2
+L1335:   prn  L286[5]
+L1336:   rts
+L1337:   jsr  r4
+L1338:   not  r4
+L1339:   not  L37
+L1340:   add  #-1900, L139
+L1341:   inc  L223
+L1342:   red  L1009[6]
+L1343:   dec  L355[14]
+L1344:   jmp  r1
+L1345:   add  L722, r1
+L1346:   mov  #361, X10
+L1347:   not  L1252
+L1348:   cmp  #1311, L998[K0]
+L1349:   jmp  L858
+L1350:   not  r4
+L1351:   clr  L165[K1]
+L1352:   jmp  L1298
+L1353:   red  L24[K0]
+L1354:   not  r7
+L1355:   lea  L980, r1
+L1356:   lea  L979[3], L1099
+L1357:   lea  L1149, L293
+L1358:   dec  L454
+L1359:   red  L1188
+L1360:   jmp  r4
+L1361:   inc  L492[5]
+L1362:   jmp  r3
+L1363:   cmp  L1069[K3], r5
+L1364:   mov  L403, r2
+L1365:   cmp  L611, r5
+L1366:   inc  L264
+L1367:   prn  r1
+L1368:   inc  r3
+L1369:   inc  L1199
+L1370:   sub  r2, L711
+L1371:   jmp  L1353
+L1372:   not  L1129
+L1373:   sub  L814[K0], L1089[K1]
+L1374:   clr  r2
+L1375:   dec  L1370
+L1376:   clr  r4
+L1377:   inc  L999[K2]
+L1378:   clr  L397[11]
+L1379:   hlt
+L1380:   hlt
+L1381:   dec  L163[K3]
+L1382:   not  L1110[K1]
+L1383:   jmp  L681
+L1384:   mov  r5, r5
+L1385:   cmp  #-1936, L153[13]
+L1386:   lea  L1268, L423
+L1387:   mov  L216, L175
+L1388:   inc  r6
+L1389:   sub  L1033, L1343[K3]
+L1390:   clr  L382[6]
+L1391:   sub  #767, L1053
+L1392:   add  L486[K1], r1
+L1393:   rts
+L1394:   sub  #818, r5
+L1395:   dec  L1236
+L1396:   dec  r5
+L1397:   cmp  L8[K0], #-1254
+L1398:   add  L211[0], L433
+L1399:   mov  r5, r7
+L1400:   not  L292[15]
+L1401:   hlt
+L1402:   red  L479
+L1403:   cmp  L410[15], L72
+L1404:   mov  r4, r7
+L1405:   mov  #-334, L1049
+L1406:   prn  L36[K3]
+L1407:   inc  L667[K2]
+L1408:   clr  L1223
+L1409:   prn  r2
+L1410:   bne  L235
+L1411:   red  L992[K0]
+L1412:   mov  L210[K1], L127
+L1413:   clr  r0
+L1414:   hlt
+L1415:   clr  r6
+L1416:   mov  L580, L854
+L1417:   lea  L694, L772
+L1418:   bne  L501
+L1419:   red  L862
+L1420:   red  r5
+L1421:   add  L1067[9], L581[11]
+L1422:   hlt
+L1423:   lea  L642[K0], L1411
+L1424:   cmp  L1085, L775
+L1425:   mov  r6, L179
+L1426:   add  L433, L211[K1]
+L1427:   mov  #991, L199
+L1428:   prn  L1003
+L1429:   mov  #-54, L60[2]
+L1430:   inc  r0
+L1431:   not  r4
+L1432:   red  r6
+L1433:   red  L769
+L1434:   jmp  r0
+L1435:   red  r2
+L1436:   jsr  r3
+L1437:   mov  r5, L242
+L1438:   sub  L1037, L184[14]
+L1439:   jmp  L1045
+L1440:   sub  r0, r2
+L1441:   prn  r2
+L1442:   bne  L1163
+L1443:   cmp  L737, r4
+L1444:   add  r2, L1287[5]
+L1445:   not  L823
+L1446:   hlt
+L1447:   jmp  r7
+L1448:   jmp  L489
+L1449:   cmp  L1038[K2], r4
+L1450:   add  r2, r4
+L1451:   add  L1359[K0], r2
+L1452:   prn  L1022[13]
+L1453:   hlt
+L1454:   jmp  r6
+L1455:   mov  L624[K3], L896[K2]
+L1456:   sub  L1434, L201[K0]
+L1457:   dec  L409[0]
+L1458:   rts
+L1459:   rts
+L1460:   red  r0
+L1461:   sub  L914[10], L1337[1]
+L1462:   mov  #1660, r2
+L1463:   bne  r4
+L1464:   jsr  L934
+L1465:   bne  r2
+L1466:   prn  L1200
+L1467:   bne  L761
+L1468:   hlt
+L1469:   add  r0, L990[6]
+L1470:   mov  #-1177, L1097
+L1471:   dec  r6
+L1472:   cmp  L291[K1], L149
+L1473:   jmp  r4
+L1474:   hlt
+L1475:   sub  L236, L753
+L1476:   not  r2
+L1477:   inc  L1357[15]
+L1478:   add  L33[4], L712[K2]
+L1479:   prn  #K1
+L1480:   jmp  L93
+L1481:   jmp  L601
+L1482:   jmp  r1
+L1483:   clr  L485
+L1484:   cmp  L1297[K0], L270[K3]
+L1485:   rts
+L1486:   red  L75[3]
+L1487:   lea  L608[8], L260
+L1488:   jmp  L455
+L1489:   hlt
+L1490:   jsr  L193
+L1491:   bne  r7
+L1492:   bne  r6
+L1493:   jsr  L1318
+L1494:   hlt
+L1495:   red  L776[14]
+L1496:   prn  #-1047
+L1497:   not  r1
+L1498:   clr  L1233
+L1499:   not  L982[1]
+L1500:   lea  L1473[15], r0
+L1501:   bne  r4
+L1502:   jsr  L197
+L1503:   inc  L586
+L1504:   dec  L272[5]
+L1505:   jmp  r2
+L1506:   jmp  r1
+L1507:   jsr  L933
+L1508:   jmp  L1085
+L1509:   mov  L902[K0], r2
+L1510:   cmp  r5, L137
+L1511:   bne  r0
+L1512:   red  L1161
+L1513:   red  L1436[K0]
+L1514:   cmp  L228, #K3
+L1515:   not  L1176[2]
+L1516:   clr  r5
+L1517:   dec  L1296
+L1518:   add  #604, L626[K2]
+L1519:   jsr  r7
+L1520:   dec  L1454[11]
+L1521:   clr  L1418
+L1522:   lea  L1104[7], L544[12]
+L1523:   jmp  L840
+L1524:   inc  L1499
+L1525:   dec  r1
+L1526:   jsr  r5
+L1527:   prn  r7
+L1528:   not  r1
+L1529:   hlt
+L1530:   jmp  L1104
+L1531:   not  L72[K0]
+L1532:   jsr  r0
+L1533:   lea  L647, r1
+L1534:   prn  r0
+L1535:   rts
+L1536:   hlt
+L1537:   dec  L591
+L1538:   cmp  L1329[10], #940
+L1539:   jsr  r6
+L1540:   not  L495
+L1541:   cmp  #947, #K2
+L1542:   jsr  L827
+L1543:   dec  r6
+L1544:   mov  L194[K0], L129[K3]
+L1545:   jsr  r6
+L1546:   prn  r3
+L1547:   not  L540[K3]
+L1548:   add  X7, r3
+L1549:   jsr  r0
+L1550:   jsr  L674
+L1551:   cmp  r1, #-499
+L1552:   sub  #-1058, L740
+L1553:   inc  r5
+L1554:   jsr  r7
+L1555:   clr  L1387
+L1556:   red  L1220[5]
+L1557:   jsr  r4
+L1558:   red  L1508[K3]
+L1559:   inc  L826
+L1560:   jmp  L727
+L1561:   add  r7, r2
+L1562:   add  L107, L1435
+L1563:   jsr  L463
+L1564:   sub  #172, r0
+L1565:   hlt
+L1566:   dec  L263[K3]
+L1567:   add  L117, r2
+L1568:   inc  r0
+L1569:   red  r6
+L1570:   hlt
+L1571:   dec  L1543
+L1572:   rts
+L1573:   cmp  r6, r1
+L1574:   inc  L1343[15]
+L1575:   not  X0
+L1576:   prn  r3
+L1577:   clr  r3
+L1578:   clr  r5
+L1579:   sub  L1250, L1457[K2]
+L1580:   rts
+L1581:   rts
+L1582:   rts
+L1583:   jmp  r2
+L1584:   sub  #-1522, r2
+L1585:   hlt
+L1586:   add  r2, r5
+L1587:   prn  L471[K2]
+L1588:   bne  r7
+L1589:   sub  #-172, r5
+L1590:   lea  L84, L1488[K0]
+L1591:   bne  r2
+L1592:   jmp  r7
+L1593:   rts
+L1594:   red  L315[K1]
+L1595:   jsr  r6
+L1596:   mov  r3, r3
+L1597:   add  L337[1], L1564[K2]
+L1598:   dec  r7
+L1599:   add  #-1780, L1281[K2]
+L1600:   inc  L1209[K2]
+L1601:   dec  L333
+L1602:   prn  L68[12]
+L1603:   not  L569[3]
+L1604:   rts
+L1605:   rts
+L1606:   add  L1010[9], L463[8]
+L1607:   prn  L600[9]
+L1608:   hlt
+L1609:   rts
+L1610:   sub  r6, L1529
+L1611:   mov  #-315, L514[K2]
+L1612:   mov  L1103, L930
+L1613:   sub  #-161, L1060[5]
+L1614:   prn  L1337[13]
+L1615:   hlt
+L1616:   red  L798
+L1617:   sub  L319[K3], L1305[K0]
+L1618:   jmp  r5
+L1619:   jsr  L66
+L1620:   dec  L748[K3]
+L1621:   sub  r7, r3
+L1622:   bne  L445
+L1623:   mov  L1534, L918[10]
+L1624:   dec  r4
+L1625:   mov  r7, L77[K1]
+L1626:   clr  r7
+L1627:   mov  #-1436, L1568[2]
+L1628:   red  r2
+L1629:   jsr  r4
+L1630:   hlt
+L1631:   dec  L242[K1]
+L1632:   red  r6
+L1633:   mov  r1, r0
+L1634:   red  L1044[7]
+L1635:   lea  L606, L1350[10]
+L1636:   hlt
+L1637:   hlt
+L1638:   add  L684, L1461[K3]
+L1639:   jsr  L1579
+L1640:   lea  L389, L495[K0]
+L1641:   red  r1
+L1642:   lea  L1215[K3], L387
+L1643:   inc  r6
+L1644:   not  r7
+L1645:   bne  r5
+L1646:   mov  #1378, r3
+L1647:   rts
+L1648:   cmp  L132, r1
+L1649:   jsr  X1
+L1650:   rts
+L1651:   dec  L53[13]
+L1652:   jmp  L1206
+L1653:   prn  #986
+L1654:   lea  L821[K1], L85
+L1655:   sub  #-1419, L1449
+L1656:   inc  r3
+L1657:   inc  L1017[K2]
+L1658:   lea  L639[K0], r1
+L1659:   mov  #-995, r0
+L1660:   red  L513
+L1661:   dec  L925[K0]
+L1662:   mov  r4, L203
+L1663:   add  r4, L1220[2]
+L1664:   red  r3
+L1665:   jmp  L838
+L1666:   sub  #637, L601[4]
+L1667:   lea  L1382, L199
+L1668:   jsr  L796
+L1669:   sub  L923[K1], L720
+L1670:   cmp  #173, r1
+L1671:   add  #60, r6
+L1672:   lea  L380, L1490[K2]
+L1673:   lea  L1640[0], L483
+L1674:   mov  r3, r5
+L1675:   clr  L707[7]
+L1676:   rts
+L1677:   mov  r5, L806[K0]
+L1678:   sub  r5, L1605
+L1679:   dec  r5
+L1680:   rts
+L1681:   bne  r7
+L1682:   clr  L1338
+L1683:   dec  L573[K3]
+L1684:   not  r1
+L1685:   not  L12
+L1686:   dec  L54[K3]
+L1687:   cmp  r0, L663
+L1688:   rts
+L1689:   sub  L573[0], L446[K3]
+L1690:   sub  L123[1], r2
+L1691:   prn  #K2
+L1692:   jsr  r1
+L1693:   jsr  L904
+L1694:   lea  L107[2], r4
+L1695:   red  L808[K2]
+L1696:   red  L317[K2]
+L1697:   jmp  r0
+L1698:   not  r7
+L1699:   lea  L137[13], r2
+L1700:   prn  #K1
+L1701:   sub  r5, r3
+L1702:   inc  L230[K1]
+L1703:   jmp  r7
+L1704:   prn  L773[K2]
+L1705:   bne  r4
+L1706:   jmp  r2
+L1707:   clr  L244
+L1708:   rts
+L1709:   clr  L200
+L1710:   cmp  #1839, r6
+L1711:   prn  L1374[K0]
+L1712:   sub  r7, r0
+L1713:   mov  L884[K0], L1302
+L1714:   dec  L612
+L1715:   lea  L223, L693[12]
+L1716:   jsr  r1
+L1717:   jsr  L182
+L1718:   prn  #-1673
+L1719:   not  L1459
+L1720:   lea  L28[K3], L1050
+L1721:   rts
+L1722:   lea  L1177, r0
+L1723:   clr  L37
+L1724:   rts
+L1725:   bne  r0
+L1726:   cmp  r0, #-1880
+L1727:   jmp  r2
+L1728:   hlt
+L1729:   red  L657
+L1730:   not  L1284[5]
+L1731:   dec  L1095
+L1732:   rts
+L1733:   dec  r5
+L1734:   hlt
+L1735:   inc  L790
+L1736:   not  r2
+L1737:   prn  L849
+L1738:   not  L1145[K0]
+L1739:   jmp  r1
+L1740:   cmp  L611[9], r0
+L1741:   red  L1522[5]
+L1742:   prn  L1135[K1]
+L1743:   rts
+L1744:   hlt
+L1745:   clr  L1596
+L1746:   rts
+L1747:   bne  r4
+L1748:   mov  r7, L965[K3]
+L1749:   inc  L902
+L1750:   clr  L514
+L1751:   jmp  L902
+L1752:   clr  L136[12]
+L1753:   rts
+L1754:   add  L1416, L171[K3]
+L1755:   jsr  X0
+L1756:   inc  L751[K1]
+L1757:   prn  L1217
+L1758:   bne  L665
+L1759:   inc  L1729
+L1760:   not  L500[12]
+L1761:   bne  r3
+L1762:   add  #1793, L1050[6]
+L1763:   dec  L1702
+L1764:   inc  L1144[5]
+L1765:   red  L889[8]
+L1766:   sub  L943[K0], L1106[2]
+L1767:   jmp  r3
+L1768:   clr  r3
+L1769:   mov  r3, r7
+L1770:   cmp  #1545, L381[2]
+L1771:   red  r1
+L1772:   jmp  L1736
+L1773:   rts
+L1774:   bne  L167
+L1775:   add  #-1513, r0
+L1776:   lea  L372, L1430[K2]
+L1777:   clr  L1011[5]
+L1778:   lea  L1520, L1754
+L1779:   jsr  L419
+L1780:   clr  r2
+L1781:   add  L1124, L878
+L1782:   sub  r0, L1177
+L1783:   add  L1651, r5
+L1784:   inc  r4
+L1785:   jmp  r3
+L1786:   bne  L567
+L1787:   sub  #572, L247[K2]
+L1788:   clr  L416
+L1789:   cmp  r0, #-1810
+L1790:   inc  r7
+L1791:   clr  r6
+L1792:   clr  r7
+L1793:   sub  r4, L593
+L1794:   inc  r4
+L1795:   red  r0
+L1796:   rts
+L1797:   not  L121[K2]
+L1798:   not  L1250
+L1799:   dec  L446[K2]
+L1800:   dec  L394
+L1801:   bne  L1008
+L1802:   rts
+L1803:   not  L484[K1]
+L1804:   lea  L266[1], L1395
+L1805:   jsr  r5
+L1806:   mov  L112[9], L1516[11]
+L1807:   hlt
+L1808:   inc  L1159[12]
+L1809:   mov  L416[15], L191[1]
+L1810:   jsr  r1
+L1811:   not  L1138[0]
+L1812:   bne  L1296
+L1813:   sub  L1039[K2], X14
+L1814:   red  L199[1]
+L1815:   hlt
+L1816:   bne  L487
+L1817:   bne  L1068
+L1818:   cmp  L683[13], L607[6]
+L1819:   dec  L938
+L1820:   clr  r0
+L1821:   bne  r2
+L1822:   inc  r5
+L1823:   jsr  r6
+L1824:   inc  r6
+L1825:   hlt
+L1826:   lea  L521, r1
+L1827:   prn  L337[K1]
+L1828:   rts
+L1829:   hlt
+L1830:   jmp  r6
+L1831:   dec  r0
+L1832:   not  r3
+L1833:   jsr  r3
+L1834:   jsr  L1083
+L1835:   clr  L63
+L1836:   hlt
+L1837:   cmp  #-507, #454
+L1838:   lea  L849, L1470
+L1839:   lea  L1430[13], L1474[8]
+L1840:   red  L1528
+L1841:   add  L395[4], r6
+L1842:   jsr  L1489
+L1843:   sub  r4, L492[K0]
+L1844:   add  L1536, L743[K0]
+L1845:   inc  L229
+L1846:   jmp  r1
+L1847:   lea  L1043, L1756
+L1848:   bne  r5
+L1849:   add  L250[K2], L28
+L1850:   bne  X9
+L1851:   not  L712[15]
+L1852:   rts
+L1853:   prn  #1178
+L1854:   lea  L1379, r4
+L1855:   red  L1302
+L1856:   clr  r6
+L1857:   lea  L666[13], r2
+L1858:   not  L1200
+L1859:   bne  L48
+L1860:   inc  L12[K1]
+L1861:   red  L1509
+L1862:   lea  L209, L70[K2]
+L1863:   prn  #K2
+L1864:   red  L1736[1]
+L1865:   jsr  L1437
+L1866:   jsr  r5
+L1867:   jmp  r3
+L1868:   cmp  L1670[K3], r5
+L1869:   mov  L65, r2
+L1870:   cmp  L1057, r5
+L1871:   inc  r6
+L1872:   inc  r4
+L1873:   lea  L657[K3], r7
+L1874:   cmp  #368, L1514[3]
+L1875:   add  #-1028, L1503[2]
+L1876:   add  L729, L1456
+L1877:   bne  L180
+L1878:   dec  L1801
+L1879:   clr  L114[2]
+L1880:   clr  L29
+L1881:   clr  L747
+L1882:   jmp  r7
+L1883:   jsr  L913
+L1884:   mov  r6, L210
+L1885:   clr  r6
+L1886:   jmp  L1071
+L1887:   jsr  r6
+L1888:   jsr  r5
+L1889:   cmp  #1824, L1029[13]
+L1890:   lea  L712[14], r7
+L1891:   rts
+L1892:   bne  r1
+L1893:   sub  r4, L1304[K2]
+L1894:   hlt
+L1895:   jsr  L360
+L1896:   not  r4
+L1897:   not  r3
+L1898:   not  L323[K2]
+L1899:   lea  L270[K1], L413
+L1900:   red  L1454[6]
+L1901:   prn  L661[K0]
+L1902:   sub  L184, r5
+L1903:   bne  L1601
+L1904:   rts
+L1905:   jmp  r0
+L1906:   mov  L244[5], L857[14]
+L1907:   sub  #427, L716[15]
+L1908:   jsr  L477
+L1909:   clr  r0
+L1910:   dec  L466[7]
+L1911:   not  L48[K3]
+L1912:   hlt
+L1913:   bne  L820
+L1914:   inc  L1144
+L1915:   mov  L613[K3], L643[K3]
+L1916:   cmp  L1727, L1087[K3]
+L1917:   prn  #-344
+L1918:   cmp  L396[K1], r3
+L1919:   clr  r0
+L1920:   hlt
+L1921:   clr  L0
+L1922:   jmp  r6
+L1923:   not  L61
+L1924:   dec  L1163[14]
+L1925:   lea  L1478[11], r4
+L1926:   hlt
+L1927:   red  L1356
+L1928:   red  L243[K2]
+L1929:   red  L1535
+L1930:   prn  #-120
+L1931:   add  L199, L1319
+L1932:   inc  L412
+L1933:   prn  #-602
+L1934:   add  L297, L802
+L1935:   jsr  L1571
+L1936:   jmp  L577
+L1937:   mov  #1202, r7
+L1938:   add  r6, r2
+L1939:   mov  #-693, L608[K0]
+L1940:   lea  L1658[K3], L111[11]
+L1941:   inc  L1163[11]
+L1942:   sub  L402, r5
+L1943:   bne  r7
+L1944:   cmp  L1382, #-884
+L1945:   sub  #1417, r1
+L1946:   bne  r2
+L1947:   bne  r0
+L1948:   prn  r2
+L1949:   bne  L744
+L1950:   cmp  L1639, r4
+L1951:   add  r2, L214[5]
+L1952:   not  r4
+L1953:   mov  L98, L213[1]
+L1954:   bne  r1
+L1955:   bne  r3
+L1956:   jsr  L374
+L1957:   not  r2
+L1958:   add  L1400[K3], L734[9]
+L1959:   add  r3, r5
+L1960:   lea  L888[12], r1
+L1961:   add  L639[1], L106
+L1962:   bne  r0
+L1963:   dec  L869[K0]
+L1964:   hlt
+L1965:   red  L191
+L1966:   cmp  #1187, r4
+L1967:   bne  r5
+L1968:   clr  L138[1]
+L1969:   bne  L321
+L1970:   prn  L1243[14]
+L1971:   red  X10
+L1972:   rts
+L1973:   lea  L1422, L1918
+L1974:   red  L519[K2]
+L1975:   prn  r6
+L1976:   add  L338[0], r0
+L1977:   dec  L1818
+L1978:   jmp  L1756
+L1979:   cmp  #1726, L187[9]
+L1980:   jsr  L20
+L1981:   clr  L397
+L1982:   mov  r4, L1832[7]
+L1983:   add  #1612, L571[K0]
+L1984:   jmp  r4
+L1985:   prn  #K1
+L1986:   jmp  L475
+L1987:   jmp  L1473
+L1988:   jmp  r1
+L1989:   clr  L1682
+L1990:   cmp  L477[K0], L780[K3]
+L1991:   rts
+L1992:   red  L1037
+L1993:   lea  L949, L1310
+L1994:   hlt
+L1995:   inc  L781[10]
+L1996:   lea  L1628[K3], L1869[K1]
+L1997:   lea  X8, r5
+L1998:   rts
+L1999:   dec  r7
+L2000:   red  L425
+L2001:   not  L389
+L2002:   not  L343
+L2003:   red  L1330[8]
+L2004:   sub  L706, r1
+L2005:   clr  r3
+L2006:   jmp  L1615
+L2007:   prn  L1926
+L2008:   red  L1970
+L2009:   clr  r0
+L2010:   jmp  L168
+L2011:   jmp  r1
+L2012:   jsr  L1531
+L2013:   jmp  L434
+L2014:   mov  L536[K2], X6
+L2015:   clr  r3
+L2016:   clr  L1546[8]
+L2017:   red  r0
+L2018:   mov  L703[K0], r3
+L2019:   cmp  L742, #K3
+L2020:   not  r6
+L2021:   not  r0
+L2022:   cmp  r1, L34[K3]
+L2023:   add  #1484, L350[K2]
+L2024:   jsr  r7
+L2025:   dec  L450
+L2026:   dec  L1930
+L2027:   rts
+L2028:   prn  L1444
+L2029:   jmp  L1068
+L2030:   jsr  r7
+L2031:   clr  r0
+L2032:   rts
+L2033:   bne  r5
+L2034:   bne  L1141
+L2035:   prn  L2028
+L2036:   prn  L1244
+L2037:   red  r0
+L2038:   not  L1919
+L2039:   mov  L1987, L1366[12]
+L2040:   hlt
+L2041:   jsr  L369
+L2042:   jsr  L1198
+L2043:   dec  X15
+L2044:   inc  r2
+L2045:   jsr  r6
+L2046:   not  L325
+L2047:   cmp  #-1053, #K2
+L2048:   jsr  L1461
+L2049:   dec  L1211
+L2050:   hlt
+L2051:   bne  L1364
+L2052:   jsr  r6
+L2053:   prn  r3
+L2054:   not  r1
+L2055:   jmp  r7
+L2056:   jmp  r7
+L2057:   jsr  r0
+L2058:   jsr  L718
+L2059:   cmp  r1, #-1635
+L2060:   sub  L608[K3], L1147[K0]
+L2061:   lea  L1089[1], L941[8]
+L2062:   prn  #760
+L2063:   clr  r2
+L2064:   not  r4
+L2065:   rts
+L2066:   rts
+L2067:   bne  L634
+L2068:   mov  L506, L1408
+L2069:   inc  L787
+L2070:   clr  L651[K3]
+L2071:   add  L456, r7
+L2072:   prn  L811[1]
+L2073:   hlt
+L2074:   red  L1777[K3]
+L2075:   clr  L1806[K3]
+L2076:   add  r0, L944[K3]
+L2077:   cmp  L1664, #K2
+L2078:   sub  r6, L963
+L2079:   inc  L1400
+L2080:   mov  L2024, r0
+L2081:   red  L465
+L2082:   add  L2032, L1072[13]
+L2083:   rts
+L2084:   add  L342, L1462
+L2085:   rts
+L2086:   jmp  r2
+L2087:   sub  #1790, r2
+L2088:   hlt
+L2089:   add  #1859, L869
+L2090:   mov  L1148[K2], r4
+L2091:   prn  r3
+L2092:   not  L416[K2]
+L2093:   not  L2003[K0]
+L2094:   red  r3
+L2095:   jsr  r0
+L2096:   hlt
+L2097:   cmp  r1, L308
+L2098:   rts
+L2099:   mov  r0, L1942[6]
+L2100:   jmp  L958
+L2101:   lea  L106, L1591[K3]
+L2102:   bne  L1930
+L2103:   inc  L1304
+L2104:   dec  L303[K1]
+L2105:   bne  r6
+L2106:   prn  r4
+L2107:   jsr  r6
+L2108:   sub  L1094[K3], L1927
+L2109:   bne  L1864
+L2110:   prn  L1734[9]
+L2111:   hlt
+L2112:   rts
+L2113:   sub  r1, r0
+L2114:   rts
+L2115:   prn  #K2
+L2116:   mov  #822, L1936
+L2117:   sub  L385[4], L760[9]
+L2118:   hlt
+L2119:   hlt
+L2120:   mov  r5, r7
+L2121:   sub  #1262, r6
+L2122:   jmp  r0
+L2123:   inc  r3
+L2124:   jmp  r5
+L2125:   jsr  L464
+L2126:   dec  L330
+L2127:   rts
+L2128:   sub  L1593[K1], L1887
+L2129:   mov  L503, L280[10]
+L2130:   dec  r4
+L2131:   mov  L1569[6], X11
+L2132:   bne  r5
+L2133:   clr  r5
+L2134:   not  r0
+L2135:   bne  r4
+L2136:   not  r5
+L2137:   jsr  r0
+L2138:   prn  L295
+L2139:   clr  L1070[8]
+L2140:   jsr  L1663
+L2141:   not  L1663[8]
+L2142:   prn  L1951
+L2143:   rts
+L2144:   clr  L68
+L2145:   inc  r7
+L2146:   clr  r5
+L2147:   inc  L626
+L2148:   lea  L1411[11], L845[K1]
+L2149:   dec  L787
+L2150:   jmp  L642
+L2151:   lea  L1119, r5
+L2152:   bne  r5
+L2153:   mov  #993, L1746[K2]
+L2154:   prn  L203
+L2155:   mov  L1399[K0], L527
+L2156:   dec  L1936[K1]
+L2157:   jsr  r4
+L2158:   sub  L734, L1594
+L2159:   bne  L1073
+L2160:   dec  L2133
+L2161:   prn  L820
+L2162:   dec  L383[K3]
+L2163:   clr  L1557
+L2164:   jsr  L1435
+L2165:   mov  r4, L268[4]
+L2166:   lea  L2056[K2], L1862[K3]
+L2167:   clr  L506[K0]
+L2168:   rts
+L2169:   add  #1771, L644
+L2170:   jmp  L918
+L2171:   jmp  L1835
+L2172:   not  r0
+L2173:   jmp  r3
+L2174:   dec  L722[K1]
+L2175:   prn  r7
+L2176:   jsr  L588
+L2177:   cmp  L1696, L1846
+L2178:   bne  L2038
+L2179:   sub  #1435, L412
+L2180:   sub  #-373, L1983
+L2181:   jsr  L1492
+L2182:   red  L1355
+L2183:   mov  L2176, r7
+L2184:   mov  L368[13], r7
+L2185:   sub  L996, L1295[15]
+L2186:   not  r3
+L2187:   add  r3, r1
+L2188:   cmp  L120, X12
+L2189:   not  r1
+L2190:   jmp  r0
+L2191:   inc  r2
+L2192:   bne  L1830
+L2193:   dec  r1
+L2194:   not  L773
+L2195:   red  r3
+L2196:   bne  r6
+L2197:   mov  r1, X7
+L2198:   sub  r7, r1
+L2199:   dec  L1522[13]
+L2200:   red  L726[6]
+L2201:   red  L2026[4]
+L2202:   sub  r0, L1619[K2]
+L2203:   not  L328[4]
+L2204:   red  L1298
+L2205:   jsr  r5
+L2206:   red  L1959
+L2207:   add  #-106, L937[K1]
+L2208:   red  L621[1]
+L2209:   rts
+L2210:   jmp  r1
+L2211:   jmp  r4
+L2212:   prn  L1586[K2]
+L2213:   bne  L1889
+L2214:   clr  r6
+L2215:   hlt
+L2216:   bne  r5
+L2217:   inc  L1198
+L2218:   hlt
+L2219:   prn  L1750[K0]
+L2220:   sub  L808[K1], L1003
+L2221:   add  #1588, L1038
+L2222:   hlt
+L2223:   lea  L1845, r6
+L2224:   bne  r3
+L2225:   jmp  r6
+L2226:   add  r2, L842
+L2227:   inc  L896
+L2228:   clr  L974[K3]
+L2229:   cmp  L797, L335[4]
+L2230:   add  r3, L360[K1]
+L2231:   add  #-1708, r0
+L2232:   dec  L968
+L2233:   cmp  r0, #-488
+L2234:   jmp  r2
+L2235:   hlt
+L2236:   red  L384
+L2237:   not  r0
+L2238:   dec  r3
+L2239:   bne  r5
+L2240:   red  L458
+L2241:   hlt
+L2242:   clr  r2
+L2243:   prn  #K0
+L2244:   cmp  L304, r4
+L2245:   not  L1985
+L2246:   rts
+L2247:   mov  L280, r6
+L2248:   jmp  L1507
+L2249:   inc  L1522
+L2250:   hlt
+L2251:   not  L654[6]
+L2252:   sub  L558, L1921[11]
+L2253:   bne  r4
+L2254:   mov  r7, L2097[K3]
+L2255:   inc  L557[10]
+L2256:   inc  r4
+L2257:   lea  L1564, r6
+L2258:   mov  #869, L64
+L2259:   inc  r2
+L2260:   lea  L1289[14], L896[K0]
+L2261:   prn  L2087
+L2262:   jmp  r0
+L2263:   red  r1
+L2264:   rts
+L2265:   jsr  r3
+L2266:   cmp  r5, L416[4]
+L2267:   inc  L1058
+L2268:   dec  L1932[K1]
+L2269:   jsr  L995
+L2270:   not  r1
+L2271:   mov  L1788[1], r5
+L2272:   dec  r2
+L2273:   jmp  L66
+L2274:   not  L968[13]
+L2275:   inc  r5
+L2276:   inc  L1631
+L2277:   hlt
+L2278:   sub  #-568, L1284[8]
+L2279:   dec  r7
+L2280:   dec  r3
+L2281:   lea  L452, L2264
+L2282:   clr  L85
+L2283:   jsr  X12
+L2284:   not  L560[K1]
+L2285:   jmp  r0
+L2286:   hlt
+L2287:   mov  L137[K1], r6
+L2288:   jmp  L1221
+L2289:   hlt
+L2290:   cmp  #773, #1401
+L2291:   not  L979
+L2292:   lea  L1393[K1], L582
+L2293:   inc  r4
+L2294:   jmp  r3
+L2295:   bne  L363
+L2296:   sub  L468[1], L918
+L2297:   mov  L868[4], r0
+L2298:   mov  r6, L1868[0]
+L2299:   rts
+L2300:   inc  r0
+L2301:   jsr  r0
+L2302:   inc  L1745[7]
+L2303:   not  L2108[K1]
+L2304:   dec  L911
+L2305:   bne  L1459
+L2306:   bne  r3
+L2307:   dec  r2
+L2308:   prn  #K3
+L2309:   add  L2202[14], L1410[K3]
+L2310:   not  L575[K1]
+L2311:   lea  L390, L1924[15]
+L2312:   jsr  r5
+L2313:   mov  #1019, r5
+L2314:   not  L2295
+L2315:   red  L1997
+L2316:   not  L1432[K3]
+L2317:   rts
+L2318:   hlt
+L2319:   jsr  r1
+L2320:   not  r3
+L2321:   sub  X7, L697[K1]
+L2322:   not  r6
+L2323:   not  r7
+L2324:   clr  L1133[8]
+L2325:   prn  L523
+L2326:   hlt
+L2327:   lea  L1042[K1], r2
+L2328:   clr  L1807
+L2329:   red  L1173
+L2330:   inc  L232
+L2331:   bne  r2
+L2332:   inc  L593
+L2333:   rts
+L2334:   inc  L84
+L2335:   mov  r1, r6
+L2336:   jmp  r5
+L2337:   clr  r0
+L2338:   hlt
+L2339:   lea  L519[14], r0
+L2340:   dec  L644
+L2341:   sub  r1, L1971[3]
+L2342:   rts
+L2343:   cmp  L2091, r6
+L2344:   bne  r6
+L2345:   dec  r6
+L2346:   lea  L2160, L208[13]
+L2347:   mov  L2059, r3
+L2348:   jsr  r7
+L2349:   mov  #1610, L1922
+L2350:   add  L733, r7
+L2351:   prn  X12
+L2352:   not  L280[K3]
+L2353:   hlt
+L2354:   red  L1999
+L2355:   inc  L783
+L2356:   clr  r1
+L2357:   clr  r6
+L2358:   dec  r3
+L2359:   hlt
+L2360:   jsr  r2
+L2361:   hlt
+L2362:   jsr  L329
+L2363:   bne  L1158
+L2364:   bne  L191
+L2365:   rts
+L2366:   mov  L278[K1], L1349[K1]
+L2367:   red  L43[K1]
+L2368:   rts
+L2369:   red  L1493[2]
+L2370:   red  r5
+L2371:   bne  r1
+L2372:   not  L1309
+L2373:   bne  r2
+L2374:   cmp  r1, L619[8]
+L2375:   lea  L1252, r0
+L2376:   inc  L1932
+L2377:   clr  L1168[4]
+L2378:   bne  r1
+L2379:   add  #-1902, r7
+L2380:   clr  L1043
+L2381:   sub  L2370, r3
+L2382:   cmp  L1839, L942
+L2383:   cmp  L647, r5
+L2384:   inc  L928
+L2385:   prn  r1
+L2386:   inc  r3
+L2387:   inc  L646[K1]
+L2388:   dec  r6
+L2389:   clr  r6
+L2390:   prn  #-1828
+L2391:   dec  r1
+L2392:   sub  L517, L1830
+L2393:   jsr  r5
+L2394:   prn  X5
+L2395:   hlt
+L2396:   sub  r3, L2301
+L2397:   lea  L803[11], L1156
+L2398:   hlt
+L2399:   hlt
+L2400:   dec  r6
+L2401:   hlt
+L2402:   rts
+L2403:   jmp  L786
+L2404:   jsr  r6
+L2405:   jsr  r5
+L2406:   cmp  #-496, L105[13]
+L2407:   lea  L493, L51
+L2408:   mov  r7, L642[9]
+L2409:   jmp  r0
+L2410:   red  L113[12]
+L2411:   not  L849[K1]
+L2412:   inc  L310
+L2413:   add  r3, r0
+L2414:   mov  #-1959, L862
+L2415:   rts
+L2416:   sub  #1746, r5
+L2417:   dec  L2072
+L2418:   dec  r5
+L2419:   cmp  L1500[K0], #-1094
+L2420:   add  L1625[0], L2253
+L2421:   mov  L771[K1], L562
+L2422:   hlt
+L2423:   hlt
+L2424:   red  L1058[12]
+L2425:   cmp  #887, L1334
+L2426:   prn  #K1
+L2427:   sub  r0, L413[14]
+L2428:   hlt
+L2429:   add  L1130, L1551
+L2430:   bne  L2177
+L2431:   inc  L1260
+L2432:   add  L1216[1], r2
+L2433:   prn  L1817
+L2434:   mov  L518[K1], L793
+L2435:   clr  r0
+L2436:   hlt
+L2437:   clr  L972[K3]
+L2438:   cmp  L1538, L2145[4]
+L2439:   dec  L175[14]
+L2440:   lea  X11, L1182
+L2441:   hlt
+L2442:   red  r5
+L2443:   add  L1353, r3
+L2444:   jmp  r0
+L2445:   sub  L1657, L2395
+L2446:   inc  L1119[11]
+L2447:   sub  r3, r5
+L2448:   jsr  L1590
+L2449:   add  L223, L835
+L2450:   jsr  L1248
+L2451:   jmp  L1831
+L2452:   mov  L1815[K0], L1554
+L2453:   bne  r1
+L2454:   jsr  L1799
+L2455:   lea  L1443[K3], L1021[11]
+L2456:   inc  L223
+L2457:   lea  L2141[6], r3
+L2458:   bne  r7
+L2459:   cmp  L1383, #636
+L2460:   sub  #1689, L2105
+L2461:   add  L2066[K2], r3
+L2462:   sub  L469[3], L765[K2]
+L2463:   inc  L2235
+L2464:   sub  #-781, r3
+L2465:   bne  r4
+L2466:   not  L1399[K3]
+L2467:   cmp  L779[K1], L295
+L2468:   inc  L892
+L2469:   not  L102[K2]
+L2470:   add  #1298, L876
+L2471:   lea  L946, L47[12]
+L2472:   not  r2
+L2473:   red  L1294
+L2474:   add  L2132[K3], r6
+L2475:   sub  L717, L1252[K0]
+L2476:   dec  L739
+L2477:   red  r7
+L2478:   prn  L1844
+L2479:   sub  r5, r2
+L2480:   clr  L785
+L2481:   sub  r7, L771
+L2482:   lea  L1016[K2], r1
+L2483:   bne  r2
+L2484:   prn  L172
+L2485:   bne  L367
+L2486:   hlt
+L2487:   add  L868[2], L2383
+L2488:   jmp  L1543
+L2489:   dec  L2487
+L2490:   add  L1383[K1], r5
+L2491:   jmp  r4
+L2492:   hlt
+L2493:   sub  L1602, L82[K1]
+L2494:   mov  r7, L1921
+L2495:   hlt
+L2496:   add  #-1220, r0
+L2497:   jmp  r4
+L2498:   prn  #K1
+L2499:   jmp  X7
+L2500:   clr  L715[K1]
+L2501:   jmp  r1
+L2502:   clr  L2295[K3]
+L2503:   add  L1921[5], r2
+L2504:   clr  L943[1]
+L2505:   jmp  r3
+L2506:   lea  L1805[8], L1972
+L2507:   jmp  L1287
+L2508:   hlt
+L2509:   jsr  L1213
+L2510:   bne  r7
+L2511:   bne  r6
+L2512:   jsr  L2169
+L2513:   hlt
+L2514:   red  L725
+L2515:   not  L567[1]
+L2516:   dec  r4
+L2517:   rts
+L2518:   cmp  #-903, r0
+L2519:   cmp  L451[1], L2136
+L2520:   bne  r2
+L2521:   prn  r5
+L2522:   hlt
+L2523:   inc  r0
+L2524:   cmp  L2289[10], #K1
+L2525:   sub  #739, r0
+L2526:   lea  L223[K0], L1677[K3]
+L2527:   add  #1413, L2209
+L2528:   red  L1257
+L2529:   red  L431
+L2530:   bne  r0
+L2531:   red  L1909[10]
+L2532:   bne  L176
+L2533:   cmp  L1736, #K3
+L2534:   not  L2353
+L2535:   mov  L1026, r3
+L2536:   inc  L2414[2]
+L2537:   dec  L1510
+L2538:   cmp  L1629, r6
+L2539:   red  r0
+L2540:   rts
+L2541:   clr  r6
+L2542:   clr  L484[K3]
+L2543:   rts
+L2544:   cmp  r7, #-501
+L2545:   red  r7
+L2546:   jmp  L763
+L2547:   cmp  #1640, L1448[11]
+L2548:   sub  #754, X15
+L2549:   sub  r4, L1670
+L2550:   prn  #297
+L2551:   dec  L354[K2]
+L2552:   lea  L1511[K1], L419[K0]
+L2553:   rts
+L2554:   jsr  L794
+L2555:   dec  L1431[K2]
+L2556:   bne  L1861
+L2557:   cmp  r4, L474[K3]
+L2558:   prn  L1032[12]
+L2559:   add  L2508, L2426
+L2560:   not  X15
+L2561:   bne  X10
+L2562:   dec  L208[K1]
+L2563:   red  L100[K3]
+L2564:   inc  L351[K2]
+L2565:   inc  r5
+L2566:   dec  r0
+L2567:   sub  L1422[12], r2
+L2568:   jmp  r5
+L2569:   hlt
+L2570:   rts
+L2571:   inc  L1384[K2]
+L2572:   dec  L1401[1]
+L2573:   prn  #488
+L2574:   clr  r2
+L2575:   not  X8
+L2576:   lea  L1014[13], L1038[K2]
+L2577:   jmp  L1200
+L2578:   add  r3, L2187
+L2579:   hlt
+L2580:   sub  r5, L2467
+L2581:   inc  L554[2]
+L2582:   lea  L1985[K1], L1399[13]
+L2583:   cmp  r2, r2
+L2584:   dec  L703
+L2585:   add  r3, L1718
+L2586:   hlt
+L2587:   add  L2087[K1], L888[4]
+L2588:   lea  L1745[6], L438[0]
+L2589:   mov  L1807[K3], r0
+L2590:   jsr  r3
+L2591:   dec  L1357[13]
+L2592:   jsr  r0
+L2593:   mov  L141, L2498[K2]
+L2594:   rts
+L2595:   jmp  r2
+L2596:   sub  #-1586, r2
+L2597:   hlt
+L2598:   add  r2, r5
+L2599:   prn  L48[K2]
+L2600:   bne  r7
+L2601:   sub  X4, L2026
+L2602:   prn  #K0
+L2603:   prn  r7
+L2604:   sub  #972, L1417[7]
+L2605:   hlt
+L2606:   jsr  r2
+L2607:   lea  L893, X14
+L2608:   sub  X9, L1074
+L2609:   bne  r1
+L2610:   rts
+L2611:   dec  L1993
+L2612:   lea  L1339[6], L786[K1]
+L2613:   not  r7
+L2614:   cmp  L1272[12], L1954[K1]
+L2615:   jsr  L2192
+L2616:   sub  X8, L2590[10]
+L2617:   dec  L2287[9]
+L2618:   prn  L460[9]
+L2619:   hlt
+L2620:   rts
+L2621:   sub  r1, r0
+L2622:   rts
+L2623:   prn  #K2
+L2624:   mov  #-58, L2056
+L2625:   sub  #3, r4
+L2626:   cmp  L1166, L2464
+L2627:   jsr  L1484
+L2628:   red  L322
+L2629:   sub  L1992[K3], L749[K0]
+L2630:   jmp  r5
+L2631:   jsr  L1389
+L2632:   dec  L572
+L2633:   rts
+L2634:   sub  L1839[K1], L363
+L2635:   mov  r3, r6
+L2636:   lea  L1014, L1712
+L2637:   not  r3
+L2638:   inc  L583
+L2639:   mov  L1800, r0
+L2640:   jsr  L209
+L2641:   jmp  r3
+L2642:   clr  L49[8]
+L2643:   prn  L84
+L2644:   clr  L2292[8]
+L2645:   jsr  L1929
+L2646:   not  L155
+L2647:   bne  L2386
+L2648:   hlt
+L2649:   hlt
+L2650:   add  r1, L2296
+L2651:   dec  L2371[K1]
+L2652:   prn  L1530
+L2653:   rts
+L2654:   cmp  r3, r7
+L2655:   dec  L1195
+L2656:   jmp  L838
+L2657:   lea  L478, L348
+L2658:   jsr  L2314
+L2659:   add  L2177[9], L2569[K0]
+L2660:   not  r3
+L2661:   bne  r6
+L2662:   not  L900[K0]
+L2663:   red  r5
+L2664:   add  #884, L2426
+L2665:   add  L645[K1], L752
+L2666:   rts
+L2667:   lea  L1033[11], L1225
+L2668:   cmp  r3, r4
+L2669:   not  L2312[9]
+L2670:   dec  L1254
+L2671:   jsr  r7
+L2672:   rts
+L2673:   hlt
+L2674:   inc  L1622
+L2675:   red  L699[4]
+L2676:   add  L864[2], L669
+L2677:   red  L1235[2]
+L2678:   red  r4
+L2679:   cmp  #1341, r4
+L2680:   lea  L944[K0], r3
+L2681:   prn  L939
+L2682:   dec  L598
+L2683:   hlt
+L2684:   jmp  L2317
+L2685:   not  r2
+L2686:   prn  L1865[K3]
+L2687:   lea  L1149[K1], L1525
+L2688:   inc  L781[K3]
+L2689:   sub  r6, r3
+L2690:   cmp  L1251, r0
+L2691:   prn  L917
+L2692:   hlt
+L2693:   jmp  r5
+L2694:   hlt
+L2695:   mov  r6, L1472[K0]
+L2696:   bne  r7
+L2697:   clr  L2600[K1]
+L2698:   inc  r7
+L2699:   rts
+L2700:   cmp  #-1433, #-1176
+L2701:   rts
+L2702:   add  L1353, L303
+L2703:   not  L1266[14]
+L2704:   sub  r6, L2664[K2]
+L2705:   mov  L1340[5], L1010[9]
+L2706:   rts
+L2707:   add  L255, L2679
+L2708:   inc  L2566
+L2709:   prn  L121
+L2710:   prn  r6
+L2711:   add  L1900[K2], L1163
+L2712:   jmp  r0
+L2713:   not  L2633[2]
+L2714:   sub  r2, L2427
+L2715:   prn  L655
+L2716:   inc  r5
+L2717:   inc  r6
+L2718:   jmp  r1
+L2719:   jmp  r4
+L2720:   prn  L2090[K2]
+L2721:   bne  L2183
+L2722:   clr  L704
+L2723:   rts
+L2724:   clr  L1483
+L2725:   cmp  #1967, r6
+L2726:   prn  L2672[K0]
+L2727:   sub  L1717[K1], L847
+L2728:   add  #-1632, r0
+L2729:   dec  r7
+L2730:   lea  L1994[K3], L1241
+L2731:   add  L1233, r5
+L2732:   jmp  r2
+L2733:   prn  #-1225
+L2734:   not  L1637[6]
+L2735:   sub  L2049[K2], r5
+L2736:   rts
+L2737:   clr  L470
+L2738:   sub  L426[K0], L1462
+L2739:   dec  L2154
+L2740:   cmp  r0, #1672
+L2741:   jmp  r2
+L2742:   hlt
+L2743:   red  L2133
+L2744:   not  L2230[5]
+L2745:   dec  L1797
+L2746:   rts
+L2747:   dec  r5
+L2748:   hlt
+L2749:   inc  L84
+L2750:   not  L2656[11]
+L2751:   mov  L358[K0], L1468[4]
+L2752:   jmp  r1
+L2753:   cmp  L1330[9], r0
+L2754:   red  r1
+L2755:   hlt
+L2756:   bne  L1757
+L2757:   rts
+L2758:   hlt
+L2759:   clr  L324
+L2760:   rts
+L2761:   bne  r4
+L2762:   mov  r7, L1377[K3]
+L2763:   inc  L1196[10]
+L2764:   inc  L2522[15]
+L2765:   add  L1621, L346[K0]
+L2766:   clr  X9
+L2767:   rts
+L2768:   red  r4
+L2769:   cmp  #-1607, L1698
+L2770:   jsr  L1085
+L2771:   prn  L2478
+L2772:   bne  L97
+L2773:   inc  L914
+L2774:   not  r5
+L2775:   inc  r7
+L2776:   mov  #-1696, L1993
+L2777:   cmp  L1236, L656
+L2778:   inc  L2190[5]
+L2779:   red  L1551[8]
+L2780:   sub  #1853, r1
+L2781:   sub  L2424, L2563[14]
+L2782:   jsr  r4
+L2783:   hlt
+L2784:   clr  L146
+L2785:   add  r2, L864[K0]
+L2786:   inc  r0
+L2787:   sub  L847[10], r4
+L2788:   jsr  r5
+L2789:   mov  L1948[K0], L729[12]
+L2790:   not  L642
+L2791:   rts
+L2792:   inc  r6
+L2793:   dec  r5
+L2794:   add  X13, L1898[K1]
+L2795:   bne  r7
+L2796:   cmp  #1909, #-1207
+L2797:   not  L1524
+L2798:   lea  L711, r0
+L2799:   add  r3, r3
+L2800:   not  r3
+L2801:   dec  L1233[K3]
+L2802:   sub  L874[1], L1060
+L2803:   mov  L2385, L1731[K2]
+L2804:   rts
+L2805:   inc  L2742[14]
+L2806:   inc  r0
+L2807:   jsr  r0
+L2808:   inc  L1093[7]
+L2809:   not  r3
+L2810:   rts
+L2811:   sub  L461, L2367
+L2812:   jsr  r5
+L2813:   jsr  L2698
+L2814:   bne  L1169
+L2815:   add  L2486[14], L355[K3]
+L2816:   not  L1503[K1]
+L2817:   lea  L726, L1410[15]
+L2818:   jsr  r5
+L2819:   mov  L766[9], L126[11]
+L2820:   hlt
+L2821:   inc  r1
+L2822:   not  L668
+L2823:   cmp  #1677, L62[15]
+L2824:   jmp  L580
+L2825:   red  r3
+L2826:   mov  #-397, L38[4]
+L2827:   bne  r6
+L2828:   add  r5, L1220
+L2829:   mov  L1788[15], L2603
+L2830:   bne  L53
+L2831:   cmp  L1814[13], L2802[6]
+L2832:   dec  r4
+L2833:   inc  L230[K3]
+L2834:   sub  r2, L1766
+L2835:   mov  L338[K3], r1
+L2836:   not  L2771[K3]
+L2837:   mov  L1384, r2
+L2838:   red  r1
+L2839:   rts
+L2840:   hlt
+L2841:   jmp  r6
+L2842:   dec  r0
+L2843:   not  r3
+L2844:   jsr  r3
+L2845:   jsr  L923
+L2846:   clr  L1876[1]
+L2847:   lea  L712[15], L1734
+L2848:   add  L452[K3], r5
+L2849:   lea  L276[6], r1
+L2850:   hlt
+L2851:   mov  L1431[K2], L147[K0]
+L2852:   not  r3
+L2853:   prn  L1102
+L2854:   prn  #K0
+L2855:   red  L2070[K3]
+L2856:   clr  L919
+L2857:   rts
+L2858:   clr  r1
+L2859:   clr  r6
+L2860:   dec  r3
+L2861:   hlt
+L2862:   jsr  r2
+L2863:   hlt
+L2864:   jsr  L599
+L2865:   bne  L2326
+L2866:   bne  L1059
+L2867:   rts
+L2868:   mov  r4, r2
+L2869:   not  L1701[4]
+L2870:   prn  #-758
+L2871:   clr  L1770[14]
+L2872:   clr  L1331[13]
+L2873:   bne  r1
+L2874:   not  L33
+L2875:   bne  r2
+L2876:   cmp  r1, L1823[8]
+L2877:   lea  L2332, r0
+L2878:   inc  L2192
+L2879:   clr  L165[4]
+L2880:   bne  r1
+L2881:   add  r5, L1928[K1]
+L2882:   jmp  r3
+L2883:   cmp  L2656[K3], r5
+L2884:   mov  L1443, r2
+L2885:   cmp  L2760, r5
+L2886:   inc  X13
+L2887:   prn  #-711
+L2888:   inc  L2071[K3]
+L2889:   cmp  #-1584, L2150[3]
+L2890:   add  #-868, L2826[2]
+L2891:   add  #-1812, r5
+L2892:   clr  r7
+L2893:   jsr  L2467
+L2894:   jsr  r1
+L2895:   clr  L849[2]
+L2896:   clr  L536[13]
+L2897:   jmp  L1584
+L2898:   clr  L2416
+L2899:   dec  L1448
+L2900:   sub  #933, L990[15]
+L2901:   mov  L763[14], r1
+L2902:   inc  L1390[13]
+L2903:   prn  r1
+L2904:   inc  L1808[4]
+L2905:   hlt
+L2906:   jmp  L891
+L2907:   jsr  L592
+L2908:   cmp  r4, L518
+L2909:   hlt
+L2910:   jsr  L1299
+L2911:   not  r4
+L2912:   not  L101[K2]
+L2913:   sub  L2423[K0], r2
+L2914:   hlt
+L2915:   cmp  r5, #K3
+L2916:   lea  L1304, L2790[K2]
+L2917:   sub  r2, L1302
+L2918:   bne  L246
+L2919:   rts
+L2920:   jmp  r0
+L2921:   mov  L451[K1], L524
+L2922:   hlt
+L2923:   hlt
+L2924:   red  L1178[12]
+L2925:   cmp  #967, L384
+L2926:   prn  #K1
+L2927:   sub  #1853, r6
+L2928:   mov  r0, r7
+L2929:   mov  r4, L643[1]
+L2930:   bne  L797
+L2931:   inc  r0
+L2932:   add  L1375, r2
+L2933:   prn  r3
+L2934:   prn  #200
+L2935:   cmp  L1957[K1], r3
+L2936:   clr  r0
+L2937:   hlt
+L2938:   clr  L2218[K3]
+L2939:   cmp  L929, L2444[4]
+L2940:   dec  r6
+L2941:   red  L497
+L2942:   prn  L1598
+L2943:   sub  L1653[13], r3
+L2944:   jsr  r3
+L2945:   jsr  r3
+L2946:   cmp  L2666[8], r4
+L2947:   add  L196, r7
+L2948:   cmp  L496, r7
+L2949:   prn  #-1626
+L2950:   add  L189, L2710
+L2951:   jsr  L1967
+L2952:   jmp  L1521
+L2953:   mov  L699[K0], L1080
+L2954:   bne  r1
+L2955:   jsr  L938
+L2956:   lea  L1242[K3], L1939[11]
+L2957:   inc  L1994[11]
+L2958:   sub  r6, L2157
+L2959:   bne  r7
+L2960:   cmp  L750, #-596
+L2961:   sub  #425, r1
+L2962:   bne  r2
+L2963:   bne  r0
+L2964:   prn  r2
+L2965:   bne  L2201
+L2966:   cmp  L525, r4
+L2967:   add  L2296, X3
+L2968:   not  r4
+L2969:   mov  L641, r7
+L2970:   lea  L453, r1
+L2971:   cmp  L2711[K2], r4
+L2972:   add  r2, r4
+L2973:   add  L1667[K3], L1[9]
+L2974:   add  r3, r5
+L2975:   lea  L1373[K0], L2546[K0]
+L2976:   rts
+L2977:   hlt
+END:    hlt
@@ -0,0 +1,3001 @@
+.define K0 = 14
+.define K1 = 12
+.define K2 = 34
+.define K3 = 27
+.extern X0
+.extern X1
+.extern X2
+.extern X3
+.extern X4
+.extern X5
+.extern X6
+.extern X7
+.extern X8
+.extern X9
+.extern X10
+.extern X11
+.extern X12
+.extern X13
+.extern X14
+.extern X15
+MAIN:   mov  r0, r1
+L0:   jmp  r3
+L1:   clr  L0[8]
+L2:   prn  L1
+L3:   clr  L0
+L4:   dec  L3[K3]
+L5:   not  r4
+L6:   not  L4[1]
+L7:   clr  L5[K3]
+L8:   add  L4, L1[K3]
+L9:   jsr  L2
+L10:   lea  L0, L8
+L11:   inc  r3
+L12:   dec  r3
+L13:   sub  L3, L0
+L14:   jsr  L1
+L15:   bne  r5
+L16:   mov  L1[K0], L2
+L17:   inc  L1[4]
+L18:   jsr  L14
+L19:   not  L0[K0]
+L20:   red  r5
+L21:   add  #1988, L18
+L22:   add  L15, r6
+L23:   dec  r0
+L24:   clr  L21[K1]
+L25:   inc  r3
+L26:   inc  L22
+L27:   lea  L3[6], r1
+L28:   inc  r4
+L29:   hlt
+L30:   prn  L3[K3]
+L31:   inc  r0
+L32:   dec  r3
+L33:   hlt
+.entry L0
+L34:   bne  L26
+L35:   not  L22[4]
+L36:   bne  r2
+L37:   red  r4
+L38:   cmp  #1229, r4
+L39:   lea  L15, L4
+L40:   jsr  L28
+L41:   sub  L14[K1], L14
+L42:   cmp  #-259, r1
+L43:   add  r5, L18[K2]
+L44:   add  #1243, r6
+L45:   sub  r7, L7[8]
+L46:   mov  L27[11], r5
+L47:   hlt
+L48:   mov  L28[0], L25[4]
+L49:   bne  L38
+L50:   clr  L33[5]
+L51:   dec  r5
+L52:   rts
+L53:   bne  r7
+L54:   clr  r1
+L55:   clr  L30[K3]
+L56:   rts
+L57:   cmp  #-1897, #1688
+L58:   rts
+L59:   add  #-181, L28[9]
+L60:   mov  #-1491, r3
+L61:   rts
+L62:   hlt
+L63:   red  L4[0]
+L64:   sub  L31, L30[3]
+L65:   dec  L20
+L66:   not  r4
+L67:   lea  L15, L37
+L68:   add  L48[K3], L32[14]
+L69:   bne  r5
+L70:   jsr  r1
+L71:   jmp  r4
+L72:   sub  r2, r6
+L73:   clr  L55[12]
+L74:   prn  L71[K3]
+L75:   jmp  r7
+L76:   not  L33
+L77:   add  L39, L47
+L78:   bne  r4
+L79:   jmp  r2
+L80:   clr  L8[K2]
+L81:   not  L22
+L82:   bne  L49
+L83:   not  L68
+L84:   mov  r3, r6
+L85:   hlt
+L86:   mov  #-606, r5
+L87:   mov  #1423, L5[8]
+L88:   lea  L75, r6
+L89:   bne  r3
+L90:   jmp  r6
+L91:   add  L25[7], L75[K3]
+L92:   not  r5
+L93:   add  L80, L37
+L94:   not  L38[K1]
+L95:   dec  r6
+L96:   sub  L74[K0], r5
+L97:   red  L40[8]
+L98:   cmp  r0, #-712
+L99:   jmp  r2
+L100:   hlt
+L101:   red  L27[K3]
+L102:   lea  L58[K3], r6
+L103:   bne  r5
+L104:   red  r4
+L105:   lea  L55[10], L74[K3]
+L106:   dec  L100[K1]
+L107:   prn  #K0
+L108:   add  #1908, r1
+L109:   jmp  r1
+L110:   cmp  L55[9], r0
+L111:   red  L10
+L112:   bne  L111
+L113:   not  L4[6]
+L114:   sub  L9, r7
+L115:   dec  r2
+L116:   inc  r0
+L117:   cmp  r2, L48[15]
+L118:   rts
+L119:   bne  r7
+L120:   hlt
+L121:   rts
+L122:   mov  L20, r4
+L123:   clr  L1[3]
+L124:   cmp  #-1983, L25[K0]
+L125:   rts
+L126:   prn  L54
+L127:   jmp  r0
+L128:   red  r1
+L129:   rts
+L130:   jsr  r3
+L131:   cmp  r5, L68[4]
+L132:   inc  r7
+L133:   mov  #-1360, L83
+L134:   cmp  L118, L10
+L135:   inc  r6
+L136:   add  #-1999, L83[8]
+L137:   cmp  L10, r3
+L138:   add  L91, L77[K1]
+L139:   red  L95[K3]
+L140:   clr  L62
+L141:   add  #-1536, r1
+L142:   jmp  L93
+L143:   prn  r7
+L144:   not  L122
+L145:   clr  r2
+L146:   inc  r1
+L147:   bne  L72
+L148:   lea  L71[K1], r4
+L149:   rts
+L150:   rts
+L151:   lea  L53, L77[K1]
+L152:   clr  L111
+L153:   cmp  #-1979, #1593
+L154:   not  r5
+L155:   inc  L151
+L156:   clr  r0
+L157:   red  r3
+L158:   not  r3
+L159:   dec  L67
+L160:   lea  L86, r3
+L161:   cmp  #-744, L130
+L162:   cmp  r0, #-1858
+L163:   inc  L78[6]
+L164:   inc  L17[K3]
+L165:   sub  r4, L59
+L166:   inc  L158
+L167:   dec  L27
+L168:   not  L44
+L169:   red  r5
+L170:   jsr  r5
+L171:   mov  #666, L29[K0]
+L172:   hlt
+L173:   add  L132[14], r7
+L174:   not  r3
+L175:   prn  r1
+L176:   cmp  L123[13], r7
+L177:   sub  #-1142, r7
+L178:   prn  r3
+L179:   red  L123
+L180:   clr  L3
+L181:   lea  L44, L78
+L182:   hlt
+L183:   jsr  r1
+L184:   not  r3
+L185:   sub  L48[12], r2
+L186:   sub  r6, L62
+L187:   add  X7, r3
+L188:   prn  #1180
+L189:   bne  L129
+L190:   lea  L151, L73[11]
+L191:   bne  r7
+L192:   red  L116[K2]
+L193:   jmp  r5
+L194:   jmp  L159
+L195:   add  L35, r0
+L196:   dec  r2
+L197:   rts
+L198:   inc  L51[K2]
+L199:   clr  L172[11]
+L200:   cmp  L22[8], r6
+L201:   inc  L102[K0]
+L202:   mov  r3, r4
+L203:   jsr  r3
+L204:   jsr  L57
+L205:   clr  L203[1]
+L206:   lea  L51, L189[K3]
+L207:   add  L52[K0], L197[K0]
+L208:   red  L195[K2]
+L209:   bne  L155
+L210:   not  L72
+L211:   clr  L134[K1]
+L212:   jmp  L91
+L213:   dec  L13
+L214:   sub  L126, L96[K1]
+L215:   inc  L85[5]
+L216:   jmp  L46
+L217:   dec  L186[14]
+L218:   jmp  r1
+L219:   add  L193, r1
+L220:   mov  L44, L34[K1]
+L221:   jsr  r7
+L222:   rts
+L223:   mov  L68[K1], L97[K1]
+L224:   red  L28[K1]
+L225:   rts
+L226:   red  L135
+L227:   mov  #26, L175[K2]
+L228:   rts
+L229:   not  L102
+L230:   bne  L169
+L231:   red  r3
+L232:   hlt
+L233:   not  L49
+L234:   dec  r0
+L235:   rts
+L236:   red  r4
+L237:   bne  r1
+L238:   add  r5, L184[K1]
+L239:   jmp  r3
+L240:   cmp  L86[K3], r5
+L241:   mov  L52, r2
+L242:   cmp  L83, r5
+L243:   inc  r6
+L244:   inc  r4
+L245:   lea  L40, L189[7]
+L246:   jmp  L108
+L247:   red  r5
+L248:   add  #-63, r4
+L249:   jsr  L47
+L250:   hlt
+L251:   jsr  L229
+L252:   jsr  r1
+L253:   clr  r5
+L254:   hlt
+L255:   sub  L5, r0
+L256:   lea  L31[11], L117
+L257:   hlt
+L258:   hlt
+L259:   dec  L219[K3]
+L260:   not  L92
+L261:   jsr  r6
+L262:   inc  L174[13]
+L263:   prn  r1
+L264:   inc  L29
+L265:   jsr  r7
+L266:   rts
+L267:   rts
+L268:   bne  r1
+L269:   sub  L101[3], L264
+L270:   prn  r5
+L271:   hlt
+L272:   not  L182
+L273:   sub  L112[3], r4
+L274:   mov  L237, L236[K0]
+L275:   dec  L246[K2]
+L276:   dec  L96
+L277:   dec  L121[K1]
+L278:   bne  L242
+L279:   add  L60[K2], r2
+L280:   jmp  L246
+L281:   rts
+L282:   jsr  r4
+L283:   red  L117
+L284:   prn  L48[K2]
+L285:   prn  L220
+L286:   prn  #K1
+L287:   sub  L42[K2], L4
+L288:   prn  L160[K3]
+L289:   inc  r4
+L290:   lea  L281[K3], r0
+L291:   prn  r2
+L292:   bne  L143
+L293:   red  L287
+L294:   sub  L134[K1], L71[3]
+L295:   clr  r0
+L296:   hlt
+L297:   clr  r6
+L298:   mov  L172, L110
+L299:   lea  L289, r2
+L300:   red  L234
+L301:   prn  L89
+L302:   sub  L180[13], r3
+L303:   jsr  r3
+L304:   jsr  r3
+L305:   cmp  L260[8], r4
+L306:   add  L69, L96
+L307:   inc  L263
+L308:   prn  #-1482
+L309:   add  L229, L138
+L310:   jsr  L134
+L311:   jmp  L94
+L312:   mov  L138[K2], L88[K2]
+L313:   inc  L26[13]
+L314:   red  L261[K2]
+L315:   red  L204[K3]
+L316:   inc  L290[11]
+L317:   sub  r6, L202
+L318:   bne  r7
+L319:   cmp  L298, #1884
+L320:   sub  #1465, L233
+L321:   add  #-342, L20[K3]
+L322:   sub  L175[1], L232
+L323:   cmp  L176, r4
+L324:   add  r2, L31[5]
+L325:   not  L322
+L326:   hlt
+L327:   jmp  r7
+L328:   jmp  L1
+L329:   cmp  L249[K2], r4
+L330:   add  #1905, L310
+L331:   add  L225[K3], X9
+L332:   add  #1311, L119
+L333:   jmp  r6
+L334:   mov  L194[K2], L50
+L335:   mov  L15[K1], r7
+L336:   bne  r0
+L337:   prn  r0
+L338:   rts
+L339:   rts
+L340:   red  L38
+L341:   hlt
+L342:   rts
+L343:   bne  r1
+L344:   bne  L15
+L345:   prn  L49[14]
+L346:   red  L290[2]
+L347:   prn  L304
+L348:   bne  L2
+L349:   hlt
+L350:   add  L254[2], L109
+L351:   jmp  L207
+L352:   dec  L279
+L353:   add  L234[K3], L318[K3]
+L354:   rts
+L355:   jsr  L209
+L356:   clr  r6
+L357:   lea  L13[K3], L246[14]
+L358:   red  r2
+L359:   prn  L144[3]
+L360:   dec  r4
+L361:   bne  r1
+L362:   jsr  L119
+L363:   jmp  r0
+L364:   cmp  r7, L13
+L365:   jsr  r1
+L366:   add  #-352, L121
+L367:   rts
+L368:   red  r7
+L369:   cmp  r2, L209
+L370:   hlt
+L371:   hlt
+L372:   inc  L243
+L373:   rts
+L374:   clr  r5
+L375:   bne  r7
+L376:   bne  r6
+L377:   jsr  L78
+L378:   hlt
+L379:   red  r6
+L380:   sub  L177, L160
+L381:   cmp  L327, #-1505
+L382:   dec  L233[7]
+L383:   add  L322, L166
+L384:   bne  r4
+L385:   jsr  L209
+L386:   inc  L273[K2]
+L387:   clr  L225[10]
+L388:   sub  L346, L355
+L389:   bne  r5
+L390:   prn  L18
+L391:   cmp  L148[K0], #-982
+L392:   cmp  r5, L327
+L393:   bne  r0
+L394:   red  L143[10]
+L395:   bne  L129
+L396:   cmp  L380, #K3
+L397:   not  L122[2]
+L398:   clr  L378
+L399:   hlt
+L400:   rts
+L401:   not  r0
+L402:   rts
+L403:   cmp  L68, r6
+L404:   red  L401
+L405:   bne  L245
+L406:   clr  L116[K3]
+L407:   rts
+L408:   cmp  r7, #1675
+L409:   red  L124
+L410:   bne  L7
+L411:   prn  r7
+L412:   not  L131
+L413:   add  #-1010, L107[4]
+L414:   dec  r6
+L415:   jmp  r5
+L416:   mov  #945, L361
+L417:   sub  r6, L47
+L418:   lea  L141[8], L205
+L419:   dec  L204
+L420:   hlt
+L421:   prn  L342
+L422:   lea  L86, L73[K3]
+L423:   prn  L54
+L424:   mov  #-174, r0
+L425:   not  L108[10]
+L426:   add  L252, L131[K0]
+L427:   hlt
+L428:   cmp  L35[15], #-759
+L429:   sub  r4, r5
+L430:   hlt
+L431:   mov  L190[1], L196
+L432:   inc  r3
+L433:   jmp  r7
+L434:   jmp  L374
+L435:   rts
+L436:   dec  r1
+L437:   mov  #1011, L340[K3]
+L438:   add  r4, L231[4]
+L439:   rts
+L440:   rts
+L441:   bne  L84
+L442:   mov  r4, r0
+L443:   add  #1186, L0[3]
+L444:   hlt
+L445:   jmp  L150
+L446:   inc  r5
+L447:   mov  r1, L108[11]
+L448:   hlt
+L449:   red  r1
+L450:   bne  r0
+L451:   cmp  L114[K2], L375[K3]
+L452:   hlt
+L453:   dec  L97[13]
+L454:   jsr  r0
+L455:   inc  L89[K3]
+L456:   cmp  r0, r6
+L457:   mov  r1, L196[K3]
+L458:   red  r1
+L459:   lea  L385, L264[3]
+L460:   mov  L364[14], L334
+L461:   rts
+L462:   jmp  r2
+L463:   sub  #430, r2
+L464:   hlt
+L465:   add  r2, r5
+L466:   prn  L212[K2]
+L467:   bne  r7
+L468:   sub  #564, r5
+L469:   lea  L226, L462
+L470:   inc  r3
+L471:   dec  r5
+L472:   hlt
+L473:   lea  L157[K1], L84[10]
+L474:   hlt
+L475:   sub  L409[10], L438[8]
+L476:   inc  L410[14]
+L477:   dec  L456[K1]
+L478:   prn  #K2
+L479:   red  r6
+L480:   not  L274[12]
+L481:   prn  L233[12]
+L482:   not  L294[3]
+L483:   rts
+L484:   rts
+L485:   add  #-806, L118
+L486:   jmp  L368
+L487:   cmp  r2, L378
+L488:   jmp  L371
+L489:   red  L244[K0]
+L490:   add  #1957, L33
+L491:   dec  r5
+L492:   clr  L425
+L493:   clr  L414[15]
+L494:   hlt
+L495:   mov  L428[13], L373
+L496:   rts
+L497:   cmp  L207, #K2
+L498:   jmp  r5
+L499:   jsr  L290
+L500:   dec  L28[K3]
+L501:   sub  L392[K2], L69
+L502:   rts
+L503:   dec  L418
+L504:   cmp  #-1542, L4[K1]
+L505:   not  L0
+L506:   add  L374, L149
+L507:   cmp  L382, L301[0]
+L508:   jsr  r4
+L509:   hlt
+L510:   dec  L484
+L511:   inc  L477[6]
+L512:   dec  r1
+L513:   red  L23
+L514:   prn  L334[K1]
+L515:   cmp  L58[5], L403[15]
+L516:   not  r1
+L517:   hlt
+L518:   clr  r5
+L519:   inc  L370[K2]
+L520:   dec  L21
+L521:   red  r1
+L522:   lea  L493[9], r4
+L523:   lea  L36[12], r7
+L524:   rts
+L525:   red  L474[K0]
+L526:   add  #846, L90
+L527:   jmp  r6
+L528:   red  L10
+L529:   mov  #1866, L514
+L530:   jsr  r2
+L531:   red  L41
+L532:   cmp  L1, L214[K2]
+L533:   dec  L346
+L534:   bne  r4
+L535:   jmp  r3
+L536:   cmp  r3, r4
+L537:   not  r6
+L538:   not  r6
+L539:   inc  L17[K1]
+L540:   red  L105
+L541:   dec  L497[K0]
+L542:   mov  #-708, L391[15]
+L543:   rts
+L544:   add  #1659, L466
+L545:   jmp  L516
+L546:   jmp  L330
+L547:   not  L314[K2]
+L548:   lea  L364[2], L25
+L549:   inc  X3
+L550:   rts
+L551:   dec  L256[K1]
+L552:   jsr  L514
+L553:   prn  L364[K3]
+L554:   lea  L551, r3
+L555:   inc  L464[10]
+L556:   clr  L61
+L557:   lea  L291[7], r5
+L558:   rts
+L559:   mov  r5, L255[K0]
+L560:   sub  r5, L299
+L561:   dec  r5
+L562:   rts
+L563:   bne  r7
+L564:   clr  L512
+L565:   dec  L116
+L566:   rts
+L567:   mov  L475[10], L275[8]
+L568:   lea  L180[K0], L345[K3]
+L569:   sub  r3, L370
+L570:   bne  r6
+L571:   mov  L296[5], L520[9]
+L572:   rts
+L573:   add  X4, L436
+L574:   rts
+L575:   inc  r3
+L576:   cmp  L10[K3], #1357
+L577:   dec  L421
+L578:   jsr  L381
+L579:   mov  L465, L235
+L580:   bne  r4
+L581:   red  L357
+L582:   lea  L393[1], L183
+L583:   rts
+L584:   jmp  r1
+L585:   jmp  r4
+L586:   prn  L580[K2]
+L587:   bne  L493
+L588:   clr  L248
+L589:   rts
+L590:   clr  L479
+L591:   cmp  #-1297, r6
+L592:   prn  L510[K0]
+L593:   sub  r7, r0
+L594:   mov  r0, L68[K2]
+L595:   not  L222
+L596:   lea  L568[K3], L333
+L597:   add  L249[2], L389
+L598:   dec  L62[K3]
+L599:   sub  L86, r6
+L600:   sub  L410[K2], r5
+L601:   rts
+L602:   clr  L96[K2]
+L603:   sub  #-672, L489[K2]
+L604:   red  L93
+L605:   add  r0, L257
+L606:   jmp  r2
+L607:   hlt
+L608:   red  r1
+L609:   cmp  L21[K2], L149
+L610:   dec  L603[K1]
+L611:   prn  #K1
+L612:   hlt
+L613:   inc  L408[K0]
+L614:   rts
+L615:   red  L591
+L616:   jmp  L25
+L617:   clr  r1
+L618:   red  r1
+L619:   cmp  L368, r1
+L620:   rts
+L621:   jmp  L183
+L622:   jsr  L53
+L623:   inc  L400
+L624:   jmp  r6
+L625:   add  #-1289, r1
+L626:   inc  L391
+L627:   red  L460
+L628:   jsr  L392
+L629:   hlt
+L630:   add  #-1963, L368
+L631:   cmp  r6, #K1
+L632:   add  r1, L302
+L633:   cmp  #-112, L444
+L634:   inc  r6
+L635:   jmp  r0
+L636:   red  r1
+L637:   rts
+L638:   jsr  r3
+L639:   cmp  r5, L417[4]
+L640:   inc  r7
+L641:   mov  #-160, L227
+L642:   cmp  L470, L616
+L643:   inc  L543
+L644:   jsr  r1
+L645:   dec  r2
+L646:   jmp  L396
+L647:   not  L41[13]
+L648:   inc  L524
+L649:   hlt
+L650:   clr  L30
+L651:   add  r2, L46[K0]
+L652:   inc  r0
+L653:   sub  #-403, L18
+L654:   dec  L219[2]
+L655:   inc  L307[K1]
+L656:   bne  L132
+L657:   clr  L76
+L658:   rts
+L659:   rts
+L660:   lea  L209, L434[K1]
+L661:   clr  L489[1]
+L662:   dec  L396[3]
+L663:   sub  r0, L91
+L664:   add  L627, L613[0]
+L665:   mov  r0, L332
+L666:   not  L359[K0]
+L667:   prn  #K2
+L668:   cmp  #680, L492
+L669:   cmp  r0, #-946
+L670:   inc  L259
+L671:   lea  L142[15], r4
+L672:   mov  #-1721, r1
+L673:   hlt
+L674:   lea  L668[14], r5
+L675:   sub  L419, L571
+L676:   jsr  r5
+L677:   jsr  L652
+L678:   bne  L435
+L679:   add  L665[K0], r2
+L680:   add  #-137, r3
+L681:   jmp  L539
+L682:   inc  L242[1]
+L683:   jsr  r5
+L684:   mov  r2, L43
+L685:   jmp  L565
+L686:   inc  r1
+L687:   not  r1
+L688:   bne  r1
+L689:   sub  L249, L17
+L690:   not  X11
+L691:   bne  L333
+L692:   mov  r6, L318[K2]
+L693:   add  r5, L191
+L694:   mov  L281[15], L251[10]
+L695:   lea  L47, L58[11]
+L696:   bne  r7
+L697:   red  L156[K2]
+L698:   jmp  r5
+L699:   jmp  L185
+L700:   add  L159, L364
+L701:   bne  L558
+L702:   inc  L655[K2]
+L703:   clr  r4
+L704:   mov  L118[8], L465[14]
+L705:   inc  L537
+L706:   add  #-745, r7
+L707:   clr  L488
+L708:   rts
+L709:   cmp  L100, r6
+L710:   bne  r6
+L711:   dec  L342[15]
+L712:   add  #298, L628
+L713:   mov  r0, L377
+L714:   jsr  r7
+L715:   mov  #1014, r2
+L716:   prn  L327[5]
+L717:   rts
+L718:   jsr  r4
+L719:   not  L415
+L720:   red  L146
+L721:   cmp  r6, L91
+L722:   sub  L678, L212
+L723:   not  L53[K3]
+L724:   hlt
+L725:   jsr  r2
+L726:   hlt
+L727:   jsr  L245
+L728:   bne  L82
+L729:   bne  L125
+L730:   rts
+L731:   mov  L96, L524
+L732:   jsr  L91
+L733:   bne  r3
+L734:   lea  L342, r1
+L735:   red  X0
+L736:   sub  L454[1], L62[4]
+L737:   inc  L514[K1]
+L738:   red  L149[6]
+L739:   dec  L92
+L740:   inc  L436
+L741:   clr  r6
+L742:   mov  L210, X10
+L743:   inc  L273[5]
+L744:   jmp  r3
+L745:   cmp  L78[K3], r5
+L746:   mov  L587, r2
+L747:   cmp  L240, r5
+L748:   inc  L620
+L749:   prn  r1
+L750:   inc  r3
+L751:   inc  L197[K1]
+L752:   dec  r6
+L753:   clr  L376[K0]
+L754:   prn  L623[K0]
+L755:   clr  L694
+L756:   inc  r0
+L757:   jsr  r1
+L758:   clr  L383
+L759:   cmp  L302, L754
+L760:   lea  L517, r2
+L761:   rts
+L762:   dec  L347[0]
+L763:   rts
+L764:   hlt
+L765:   rts
+L766:   jmp  L153
+L767:   jsr  r6
+L768:   jsr  r5
+L769:   cmp  #-32, L340[13]
+L770:   lea  L576, L439
+L771:   mov  r7, L656[9]
+L772:   jmp  r0
+L773:   red  L667
+L774:   rts
+L775:   rts
+L776:   prn  #-346
+L777:   sub  L304[3], r4
+L778:   mov  L111, L242[K0]
+L779:   dec  r3
+L780:   jmp  L250
+L781:   mov  L549, L314
+L782:   bne  L434
+L783:   add  L713, L33
+L784:   mov  L525, L54[11]
+L785:   not  L641[0]
+L786:   prn  r3
+L787:   prn  L752[1]
+L788:   mov  #-304, L371[K0]
+L789:   prn  r4
+L790:   rts
+L791:   add  #-100, r7
+L792:   dec  r5
+L793:   prn  #K2
+L794:   mov  r2, L564
+L795:   sub  L544[K3], r1
+L796:   prn  r3
+L797:   prn  #1608
+L798:   cmp  L750[K1], r3
+L799:   clr  r0
+L800:   hlt
+L801:   clr  L559
+L802:   jmp  r6
+L803:   not  L63
+L804:   dec  L69
+L805:   bne  L183
+L806:   red  L109
+L807:   red  r5
+L808:   add  L783[9], L149[11]
+L809:   hlt
+L810:   lea  L160[K0], L598
+L811:   cmp  L638, L202
+L812:   mov  r6, L540
+L813:   add  L23, L766[K1]
+L814:   mov  r1, L448[12]
+L815:   cmp  #-1601, L41
+L816:   lea  L346[1], L154
+L817:   jsr  L177
+L818:   lea  L591[0], r6
+L819:   rts
+L820:   dec  L455[1]
+L821:   red  L704[6]
+L822:   bne  r7
+L823:   cmp  L144, #-1044
+L824:   sub  #937, r1
+L825:   bne  r2
+L826:   bne  r0
+L827:   prn  r2
+L828:   bne  L149
+L829:   cmp  L29, r4
+L830:   add  r5, r4
+L831:   inc  L123[4]
+L832:   mov  L681, r7
+L833:   lea  L485, r1
+L834:   cmp  L263[K2], r4
+L835:   add  L581, L642[K0]
+L836:   jmp  L786
+L837:   prn  L613[3]
+L838:   lea  L0[12], r1
+L839:   add  L12[0], L49[K2]
+L840:   jmp  L189
+L841:   hlt
+L842:   not  L110
+L843:   hlt
+L844:   prn  L212
+L845:   sub  L599, L775
+L846:   cmp  L418[15], L771
+L847:   prn  L566[14]
+L848:   red  L826[2]
+L849:   prn  L738
+L850:   bne  L478
+L851:   hlt
+L852:   add  L580[2], L27
+L853:   jmp  L830
+L854:   dec  L207[10]
+L855:   inc  L500
+L856:   prn  r1
+L857:   mov  L497[K0], L270
+L858:   lea  X13, L683[K0]
+L859:   inc  r7
+L860:   red  L568[K0]
+L861:   not  r3
+L862:   dec  r4
+L863:   bne  r1
+L864:   jsr  L329
+L865:   jmp  r0
+L866:   cmp  r7, L263
+L867:   jsr  r1
+L868:   add  #-1136, L689
+L869:   rts
+L870:   red  r7
+L871:   cmp  r2, L724
+L872:   hlt
+L873:   hlt
+L874:   inc  L695[10]
+L875:   lea  L177[4], r2
+L876:   inc  L866
+L877:   dec  L337
+L878:   dec  L82[15]
+L879:   add  r1, r6
+L880:   jmp  r1
+L881:   dec  L339
+L882:   mov  #1700, X15
+L883:   inc  r5
+L884:   rts
+L885:   cmp  r2, r7
+L886:   not  L805[12]
+L887:   bne  r2
+L888:   cmp  #-1704, #K1
+L889:   jmp  r2
+L890:   sub  L852, L707
+L891:   bne  r5
+L892:   prn  L78
+L893:   cmp  L44[K0], #-1734
+L894:   cmp  r5, L671
+L895:   bne  r0
+L896:   red  L359[10]
+L897:   bne  L99
+L898:   cmp  L110, #K3
+L899:   not  L765
+L900:   mov  L65, r3
+L901:   inc  L384
+L902:   add  #1228, r6
+L903:   jsr  r7
+L904:   dec  r6
+L905:   lea  L169, L702
+L906:   clr  r4
+L907:   prn  L769[10]
+L908:   jmp  r0
+L909:   inc  r3
+L910:   inc  r0
+L911:   bne  L706
+L912:   prn  r7
+L913:   not  L665[8]
+L914:   prn  L660
+L915:   red  L308
+L916:   jmp  r5
+L917:   mov  L19, L761[12]
+L918:   hlt
+L919:   jsr  L279
+L920:   jsr  L872
+L921:   dec  L540
+L922:   hlt
+L923:   prn  L913
+L924:   lea  L330, L327[K3]
+L925:   prn  L265
+L926:   mov  #-350, r0
+L927:   not  r2
+L928:   inc  r6
+L929:   hlt
+L930:   inc  L183[12]
+L931:   rts
+L932:   jmp  L521
+L933:   bne  r1
+L934:   clr  r5
+L935:   dec  L505
+L936:   prn  r1
+L937:   inc  r3
+L938:   jmp  r7
+L939:   jmp  L824
+L940:   rts
+L941:   dec  L147[1]
+L942:   prn  #1880
+L943:   clr  L305[5]
+L944:   dec  L198
+L945:   prn  L688[K3]
+L946:   clr  L592
+L947:   inc  L9[7]
+L948:   add  L621[4], r7
+L949:   inc  L303
+L950:   inc  r2
+L951:   lea  L881[K1], L98[13]
+L952:   cmp  r2, r2
+L953:   dec  L835[14]
+L954:   lea  L809[K3], L141
+L955:   add  L36[K1], L633[4]
+L956:   lea  L563, r7
+L957:   lea  L154, L943[K1]
+L958:   jmp  r5
+L959:   cmp  L539, L771[K1]
+L960:   mov  r6, L409[K2]
+L961:   mov  r6, L16
+L962:   jmp  r2
+L963:   sub  #-546, r2
+L964:   hlt
+L965:   add  r2, r5
+L966:   prn  L328[K2]
+L967:   bne  r7
+L968:   sub  L310, L156[K1]
+L969:   not  L129[K0]
+L970:   red  r3
+L971:   jsr  r0
+L972:   hlt
+L973:   cmp  r1, L474
+L974:   rts
+L975:   mov  r3, r3
+L976:   add  L26[1], L970
+L977:   rts
+L978:   dec  r2
+L979:   jmp  L942
+L980:   inc  r3
+L981:   rts
+L982:   inc  r7
+L983:   cmp  L14[12], #K1
+L984:   jsr  L22
+L985:   sub  L639[2], r6
+L986:   clr  r2
+L987:   jmp  L516
+L988:   cmp  r2, L226
+L989:   jmp  L334
+L990:   red  L56
+L991:   dec  L856[15]
+L992:   not  L742[8]
+L993:   prn  #1993
+L994:   clr  L132[15]
+L995:   hlt
+L996:   mov  r1, L851[2]
+L997:   mov  L944, L857
+L998:   bne  r3
+L999:   red  r1
+L1000:   add  L799, L887[K2]
+L1001:   cmp  r3, L542
+L1002:   hlt
+L1003:   rts
+L1004:   red  L258[3]
+L1005:   lea  L813, L191
+L1006:   not  r3
+L1007:   inc  L216
+L1008:   mov  L513, r0
+L1009:   jsr  L610
+L1010:   jmp  r3
+L1011:   clr  L379[8]
+L1012:   prn  L911
+L1013:   clr  r7
+L1014:   inc  L399[K3]
+L1015:   sub  L282[K1], L367
+L1016:   cmp  L992[5], L364[15]
+L1017:   not  r1
+L1018:   hlt
+L1019:   clr  L340[7]
+L1020:   cmp  #702, L362[6]
+L1021:   cmp  r3, r7
+L1022:   dec  r3
+L1023:   sub  L464[6], L189[5]
+L1024:   not  L1021
+L1025:   jsr  L732
+L1026:   add  #-450, L916
+L1027:   jmp  r6
+L1028:   red  r5
+L1029:   rts
+L1030:   not  L242
+L1031:   jsr  r2
+L1032:   red  L399
+L1033:   cmp  L201, L536[K2]
+L1034:   dec  L287
+L1035:   bne  r4
+L1036:   jmp  r3
+L1037:   cmp  r3, r4
+L1038:   not  L997[9]
+L1039:   dec  L269[K0]
+L1040:   hlt
+L1041:   prn  L280[K3]
+L1042:   inc  r0
+L1043:   dec  L992
+L1044:   prn  #K2
+L1045:   jsr  L438
+L1046:   not  L985[K1]
+L1047:   dec  r1
+L1048:   not  L844
+L1049:   dec  L1016[6]
+L1050:   jmp  r2
+L1051:   mov  r0, L57[8]
+L1052:   add  L997, L153
+L1053:   jsr  L910
+L1054:   prn  L467[K3]
+L1055:   lea  L426, r3
+L1056:   inc  L727[10]
+L1057:   clr  L305
+L1058:   lea  X7, L519
+L1059:   rts
+L1060:   mov  r5, L794[K0]
+L1061:   sub  L981, r7
+L1062:   dec  L210[K3]
+L1063:   add  r3, r1
+L1064:   cmp  L287, L193
+L1065:   inc  r6
+L1066:   cmp  #1655, #792
+L1067:   rts
+L1068:   add  #-309, L358[9]
+L1069:   mov  #1037, r3
+L1070:   rts
+L1071:   hlt
+L1072:   red  L241[0]
+L1073:   sub  L26[1], r2
+L1074:   prn  #K2
+L1075:   jsr  r1
+L1076:   jsr  L565
+L1077:   lea  L429[2], r4
+L1078:   red  L419[K2]
+L1079:   red  L631[K2]
+L1080:   jmp  r0
+L1081:   not  r7
+L1082:   lea  L263[K3], L445[K3]
+L1083:   clr  L81
+L1084:   clr  L247
+L1085:   not  L711
+L1086:   add  L660, L236
+L1087:   bne  r4
+L1088:   jmp  r2
+L1089:   clr  L697[K2]
+L1090:   not  L123[11]
+L1091:   rts
+L1092:   rts
+L1093:   dec  r4
+L1094:   lea  L1079[2], L1066[3]
+L1095:   cmp  r0, L490
+L1096:   not  L647
+L1097:   lea  L135[10], L671[9]
+L1098:   inc  r1
+L1099:   hlt
+L1100:   jmp  L978
+L1101:   inc  L104
+L1102:   clr  r2
+L1103:   jsr  r2
+L1104:   lea  L86, L485[K2]
+L1105:   rts
+L1106:   sub  #-336, L1078[K2]
+L1107:   red  L662[8]
+L1108:   cmp  r0, #-1448
+L1109:   jmp  r2
+L1110:   hlt
+L1111:   red  L8
+L1112:   not  L303
+L1113:   red  L108[K1]
+L1114:   rts
+L1115:   dec  r5
+L1116:   hlt
+L1117:   inc  L170
+L1118:   not  r2
+L1119:   prn  L333
+L1120:   not  L152
+L1121:   rts
+L1122:   mov  L815[9], L303[8]
+L1123:   red  L970
+L1124:   bne  L7
+L1125:   not  L44
+L1126:   jmp  r5
+L1127:   red  L527[K0]
+L1128:   cmp  #1104, #1851
+L1129:   bne  r3
+L1130:   add  L738, L136
+L1131:   not  L259[K1]
+L1132:   lea  L990, r0
+L1133:   mov  L605[2], r7
+L1134:   lea  L605, r1
+L1135:   rts
+L1136:   prn  L230
+L1137:   jmp  r0
+L1138:   red  L608
+L1139:   dec  L578
+L1140:   cmp  r5, L480[4]
+L1141:   inc  L741[3]
+L1142:   add  L891[2], L809
+L1143:   red  L1005
+L1144:   rts
+L1145:   add  #-972, L122
+L1146:   bne  r3
+L1147:   jsr  L1009
+L1148:   cmp  r7, L69[3]
+L1149:   not  L706
+L1150:   clr  r7
+L1151:   sub  #1593, r2
+L1152:   red  L454
+L1153:   lea  L515[K2], r4
+L1154:   prn  L413[5]
+L1155:   mov  r1, r7
+L1156:   bne  L836
+L1157:   lea  L392[0], L402
+L1158:   hlt
+L1159:   mov  L1025[K1], r6
+L1160:   jmp  L461
+L1161:   hlt
+L1162:   cmp  #-91, #-679
+L1163:   not  L1057
+L1164:   lea  X5, r0
+L1165:   jmp  L730
+L1166:   prn  #-101
+L1167:   dec  L70[K3]
+L1168:   sub  #1836, L176[K2]
+L1169:   clr  L189[K2]
+L1170:   not  L788
+L1171:   inc  L29
+L1172:   lea  L1028[3], L775[0]
+L1173:   prn  r4
+L1174:   inc  r4
+L1175:   red  r0
+L1176:   rts
+L1177:   not  r4
+L1178:   rts
+L1179:   jsr  r5
+L1180:   jsr  L556
+L1181:   bne  L923
+L1182:   add  L721[K0], r2
+L1183:   add  #-1497, r3
+L1184:   jmp  L966
+L1185:   inc  L388
+L1186:   prn  L999
+L1187:   dec  L1092[10]
+L1188:   jmp  L127
+L1189:   inc  r1
+L1190:   not  L702[K3]
+L1191:   rts
+L1192:   hlt
+L1193:   jsr  r1
+L1194:   not  L1179
+L1195:   bne  X5
+L1196:   not  r3
+L1197:   bne  r6
+L1198:   add  r5, L310
+L1199:   mov  L305[15], L965
+L1200:   bne  L1143
+L1201:   cmp  L831[13], L739[6]
+L1202:   dec  r4
+L1203:   inc  r5
+L1204:   mov  r2, L451[K1]
+L1205:   dec  r0
+L1206:   hlt
+L1207:   bne  L555
+L1208:   inc  L200
+L1209:   inc  L156
+L1210:   jmp  r1
+L1211:   inc  r7
+L1212:   jmp  r6
+L1213:   dec  r0
+L1214:   not  L307[5]
+L1215:   jmp  L1164
+L1216:   cmp  L1046, r6
+L1217:   bne  r6
+L1218:   dec  r6
+L1219:   lea  L214[K2], L53
+L1220:   mov  L808, r3
+L1221:   jsr  r7
+L1222:   mov  #-694, L982
+L1223:   add  L999, r7
+L1224:   prn  L822
+L1225:   prn  #K0
+L1226:   red  L589[K3]
+L1227:   clr  L517[6]
+L1228:   sub  L403, r5
+L1229:   clr  L635[K0]
+L1230:   red  L888
+L1231:   add  L786, L307
+L1232:   inc  L378
+L1233:   add  L954[3], L700
+L1234:   lea  L65, r4
+L1235:   jmp  L876
+L1236:   not  L1
+L1237:   rts
+L1238:   red  L209
+L1239:   mov  L238[1], L1173
+L1240:   not  L494[1]
+L1241:   inc  L850
+L1242:   red  r0
+L1243:   lea  L408, r6
+L1244:   dec  L553
+L1245:   mov  #-594, r5
+L1246:   mov  L409, L337
+L1247:   not  r5
+L1248:   dec  L423[5]
+L1249:   red  L1046[K2]
+L1250:   jmp  L45
+L1251:   sub  L188, L803[13]
+L1252:   inc  r6
+L1253:   inc  r4
+L1254:   lea  L791[K3], r7
+L1255:   cmp  #1, L311[3]
+L1256:   add  L532[K1], L1153
+L1257:   jsr  L50
+L1258:   hlt
+L1259:   jsr  L616
+L1260:   jsr  r1
+L1261:   clr  L1239
+L1262:   cmp  L787, L688
+L1263:   lea  L1003, r2
+L1264:   rts
+L1265:   dec  L904
+L1266:   sub  L755[K1], r3
+L1267:   mov  L801, L71[K1]
+L1268:   prn  #909
+L1269:   prn  r1
+L1270:   inc  r4
+L1271:   clr  r5
+L1272:   not  L242[K3]
+L1273:   jsr  L1076
+L1274:   cmp  r4, L902
+L1275:   hlt
+L1276:   jsr  L767
+L1277:   not  r4
+L1278:   not  L1241[K2]
+L1279:   sub  L401[K0], r2
+L1280:   hlt
+L1281:   cmp  r5, #K3
+L1282:   lea  L228, L170[K2]
+L1283:   sub  r2, L854
+L1284:   bne  L770
+L1285:   rts
+L1286:   jmp  r0
+L1287:   mov  L438[K1], L18
+L1288:   hlt
+L1289:   hlt
+L1290:   red  L441
+L1291:   cmp  L580[15], L485
+L1292:   mov  #-1402, L691[K3]
+L1293:   inc  L415
+L1294:   bne  L1211
+L1295:   inc  r4
+L1296:   lea  L199[K0], L122
+L1297:   add  r0, L374[K2]
+L1298:   red  L941
+L1299:   dec  L475[11]
+L1300:   add  r2, r1
+L1301:   dec  L614[0]
+L1302:   mov  L248, L66[0]
+L1303:   not  L1208[K2]
+L1304:   not  L142
+L1305:   lea  L1256, L334
+L1306:   mov  #1323, L1003[K1]
+L1307:   red  r3
+L1308:   inc  r1
+L1309:   hlt
+L1310:   lea  L507[6], r4
+L1311:   clr  L1246
+L1312:   sub  #-368, L1227
+L1313:   prn  r6
+L1314:   add  r4, r7
+L1315:   cmp  #-1632, L150
+L1316:   prn  r1
+L1317:   cmp  #-1393, L812
+L1318:   lea  L228[1], L600
+L1319:   jsr  L889
+L1320:   lea  L1248[K2], L243
+L1321:   jmp  r0
+L1322:   red  L921
+L1323:   red  r6
+L1324:   bne  r7
+L1325:   cmp  L472, #-1508
+L1326:   sub  #-1927, r1
+L1327:   bne  r2
+L1328:   bne  r0
+L1329:   prn  r2
+L1330:   bne  L215
+L1331:   cmp  L523, r4
+L1332:   add  r2, L859[5]
+L1333:   not  L1240
+L1334:   hlt
+L1335:   jmp  r7
+L1336:   jmp  L729
+L1337:   cmp  L199[K2], r4
+L1338:   add  L130, L503[K0]
+L1339:   jmp  L1159
+L1340:   prn  L309[3]
+L1341:   lea  L559[12], r1
+L1342:   add  L1130[K3], r6
+L1343:   sub  L221, L936[K0]
+L1344:   dec  L63
+L1345:   red  L752
+L1346:   cmp  #1907, r4
+L1347:   bne  r5
+L1348:   clr  r5
+L1349:   add  L1288[15], r3
+L1350:   prn  L183[14]
+L1351:   red  r5
+L1352:   prn  L220[6]
+L1353:   jsr  L167
+L1354:   red  L514
+L1355:   dec  r3
+L1356:   clr  r5
+L1357:   bne  r0
+L1358:   dec  L1210[7]
+L1359:   add  L178[K1], r5
+L1360:   jmp  r4
+L1361:   hlt
+L1362:   sub  L367, L380
+L1363:   not  L290[K3]
+L1364:   hlt
+L1365:   red  r2
+L1366:   prn  L866[3]
+L1367:   dec  L1102[12]
+L1368:   mov  L704, L982
+L1369:   sub  L134, L98
+L1370:   cmp  L532[K3], L301[1]
+L1371:   prn  #K1
+L1372:   hlt
+L1373:   hlt
+L1374:   cmp  r2, L880
+L1375:   hlt
+L1376:   hlt
+L1377:   inc  L1106[10]
+L1378:   lea  L140[K3], L399[K1]
+L1379:   lea  L1108, r5
+L1380:   mov  r6, L829
+L1381:   bne  L532
+L1382:   prn  #1289
+L1383:   not  r1
+L1384:   clr  r3
+L1385:   hlt
+L1386:   jmp  r7
+L1387:   add  L1160, L2[5]
+L1388:   red  L1343
+L1389:   not  r2
+L1390:   red  r1
+L1391:   prn  #-1378
+L1392:   bne  r0
+L1393:   dec  L631[9]
+L1394:   jsr  L843
+L1395:   jmp  L1068
+L1396:   mov  L171[K0], r2
+L1397:   cmp  r5, L1216
+L1398:   bne  r0
+L1399:   red  r0
+L1400:   mov  L1272, L836
+L1401:   mov  #-156, L365[K2]
+L1402:   lea  L980[K0], r4
+L1403:   cmp  r1, L1032[K3]
+L1404:   add  #-1412, L1098[K2]
+L1405:   jsr  r7
+L1406:   dec  L1230[11]
+L1407:   clr  L1370[K2]
+L1408:   clr  L917[K1]
+L1409:   inc  r2
+L1410:   jmp  r0
+L1411:   inc  L806
+L1412:   dec  L1258
+L1413:   jsr  L285
+L1414:   not  L1265
+L1415:   hlt
+L1416:   jmp  L100
+L1417:   not  X14
+L1418:   jmp  r5
+L1419:   mov  #-783, L1271
+L1420:   sub  r6, L252
+L1421:   lea  L541, L879[13]
+L1422:   dec  L345[K2]
+L1423:   bne  L914
+L1424:   cmp  r4, L1318[K3]
+L1425:   prn  L1269[12]
+L1426:   add  L300, r3
+L1427:   rts
+L1428:   add  L1234[K2], r1
+L1429:   add  r6, r5
+L1430:   prn  r3
+L1431:   not  L109
+L1432:   inc  L219[5]
+L1433:   red  L775
+L1434:   not  L720[K0]
+L1435:   jsr  r7
+L1436:   hlt
+L1437:   inc  L1431[8]
+L1438:   jsr  r6
+L1439:   inc  L530
+L1440:   jsr  r4
+L1441:   sub  L543, r3
+L1442:   hlt
+L1443:   prn  L969[14]
+L1444:   bne  L752
+L1445:   mov  L75, L1010
+L1446:   inc  r4
+L1447:   bne  r5
+L1448:   lea  L1026[7], r7
+L1449:   sub  r3, L642[K2]
+L1450:   jsr  L57
+L1451:   cmp  r2, r2
+L1452:   dec  r1
+L1453:   mov  L691[K3], r2
+L1454:   rts
+L1455:   lea  L1010[K2], r1
+L1456:   cmp  r6, r1
+L1457:   inc  L216
+L1458:   mov  #871, L1273[K2]
+L1459:   jmp  r5
+L1460:   cmp  L423, L893[K1]
+L1461:   mov  r6, L1253[K2]
+L1462:   mov  #-723, r6
+L1463:   rts
+L1464:   add  L782[9], L578[8]
+L1465:   red  L1057[7]
+L1466:   dec  L280[K0]
+L1467:   rts
+L1468:   jsr  L1334
+L1469:   clr  L853[K3]
+L1470:   mov  r7, L836
+L1471:   sub  L34, r0
+L1472:   hlt
+L1473:   cmp  r1, L1011
+L1474:   rts
+L1475:   mov  r0, L978[6]
+L1476:   jmp  L142
+L1477:   lea  L606, r6
+L1478:   prn  L1010
+L1479:   add  L28[K0], L695[9]
+L1480:   hlt
+L1481:   cmp  L1188[12], #K1
+L1482:   jsr  L826
+L1483:   sub  L398[K3], L333
+L1484:   bne  L1461
+L1485:   prn  L79[9]
+L1486:   hlt
+L1487:   rts
+L1488:   sub  r6, L921
+L1489:   mov  #1893, L553[K2]
+L1490:   mov  #-154, r0
+L1491:   sub  L1165, L712
+L1492:   bne  r7
+L1493:   hlt
+L1494:   mov  r5, r7
+L1495:   sub  r2, L761[K2]
+L1496:   prn  L783[K3]
+L1497:   jmp  r5
+L1498:   jsr  L181
+L1499:   dec  L1030
+L1500:   rts
+L1501:   sub  L1239[K1], L1342
+L1502:   mov  r3, r6
+L1503:   lea  L1406[K1], L357[K0]
+L1504:   red  L279
+L1505:   clr  L230[K0]
+L1506:   jsr  r2
+L1507:   mov  r4, L534
+L1508:   not  L149[3]
+L1509:   rts
+L1510:   jsr  r5
+L1511:   lea  L1186[K3], r6
+L1512:   mov  r6, r6
+L1513:   jsr  L368
+L1514:   prn  L743
+L1515:   rts
+L1516:   clr  L242[K3]
+L1517:   cmp  #168, r5
+L1518:   rts
+L1519:   jsr  L343
+L1520:   dec  L882[1]
+L1521:   red  L514[K2]
+L1522:   red  r7
+L1523:   clr  L330[6]
+L1524:   not  L1221
+L1525:   jsr  L1087
+L1526:   add  L893[9], L399[K0]
+L1527:   not  L247
+L1528:   rts
+L1529:   not  r0
+L1530:   mov  L10, L115[K1]
+L1531:   add  L729, r4
+L1532:   bne  L1320
+L1533:   dec  L1065[6]
+L1534:   clr  r4
+L1535:   sub  L1200, r7
+L1536:   clr  r6
+L1537:   jmp  L1486
+L1538:   mov  r7, L1055
+L1539:   rts
+L1540:   hlt
+L1541:   inc  r0
+L1542:   dec  L317[9]
+L1543:   prn  L1208[8]
+L1544:   not  r2
+L1545:   red  r1
+L1546:   bne  r0
+L1547:   sub  #-35, L1498[4]
+L1548:   lea  L1371, L299[K0]
+L1549:   add  #1011, L868[7]
+L1550:   rts
+L1551:   dec  r1
+L1552:   inc  L1548
+L1553:   bne  L1545
+L1554:   sub  L454[14], r2
+L1555:   add  r0, r1
+L1556:   bne  r0
+L1557:   mov  r3, r5
+L1558:   clr  L408[7]
+L1559:   rts
+L1560:   mov  r5, L1334[K0]
+L1561:   sub  L1199, r7
+L1562:   dec  L1456
+L1563:   clr  L543[3]
+L1564:   cmp  L459, L393
+L1565:   inc  L1503
+L1566:   red  L1318
+L1567:   inc  L1051
+L1568:   jmp  L949
+L1569:   sub  L1288[15], L262[K2]
+L1570:   red  L617[0]
+L1571:   sub  L824, L452[3]
+L1572:   dec  r3
+L1573:   jmp  r4
+L1574:   rts
+L1575:   inc  r3
+L1576:   cmp  L1026[K3], #-1811
+L1577:   dec  r3
+L1578:   bne  r5
+L1579:   jsr  r1
+L1580:   jmp  r4
+L1581:   sub  r4, L189
+L1582:   red  L484[K0]
+L1583:   not  L1535[5]
+L1584:   inc  r5
+L1585:   add  L983, X9
+L1586:   jsr  r4
+L1587:   bne  L998
+L1588:   sub  L1376, L1402[K1]
+L1589:   rts
+L1590:   clr  r3
+L1591:   rts
+L1592:   rts
+L1593:   dec  L1310
+L1594:   bne  L103
+L1595:   add  #-206, L1393[13]
+L1596:   mov  #-1241, r4
+L1597:   sub  L42[3], L574
+L1598:   bne  r3
+L1599:   jmp  r6
+L1600:   add  L228[7], L1386[K3]
+L1601:   not  L272
+L1602:   lea  L1587, L681[K1]
+L1603:   rts
+L1604:   lea  L1131[5], L1244[K2]
+L1605:   mov  r0, L1526
+L1606:   dec  L1312[8]
+L1607:   mov  L488[K3], L611[15]
+L1608:   red  L1174[K3]
+L1609:   lea  L1388, L127
+L1610:   jsr  r6
+L1611:   rts
+L1612:   clr  L627[12]
+L1613:   bne  r2
+L1614:   dec  L40
+L1615:   cmp  #-1358, #K0
+L1616:   hlt
+L1617:   hlt
+L1618:   jsr  r0
+L1619:   red  r6
+L1620:   jmp  L55
+L1621:   inc  L1537
+L1622:   hlt
+L1623:   not  r6
+L1624:   hlt
+L1625:   clr  X13
+L1626:   rts
+L1627:   add  #1632, L771[11]
+L1628:   bne  r3
+L1629:   add  L364[7], L1067[K1]
+L1630:   hlt
+L1631:   rts
+L1632:   mov  L520, r4
+L1633:   clr  L1193[3]
+L1634:   cmp  #-303, L1143[K0]
+L1635:   rts
+L1636:   prn  L1382
+L1637:   jmp  r0
+L1638:   red  r1
+L1639:   rts
+L1640:   jsr  r3
+L1641:   cmp  r5, L786[4]
+L1642:   inc  L554[3]
+L1643:   add  #-1987, r4
+L1644:   jsr  L21
+L1645:   not  L1023[14]
+L1646:   add  #-1151, L145[8]
+L1647:   cmp  L850, r3
+L1648:   add  L1111, L1089[K1]
+L1649:   red  L1411
+L1650:   sub  #195, L953[2]
+L1651:   jmp  L481
+L1652:   lea  L1576, L228[K0]
+L1653:   jsr  L1047
+L1654:   jmp  L796
+L1655:   prn  L664[K0]
+L1656:   not  r6
+L1657:   jmp  r6
+L1658:   inc  L99
+L1659:   jsr  L1285
+L1660:   rts
+L1661:   jsr  L48
+L1662:   add  #641, r1
+L1663:   sub  r0, L1170[13]
+L1664:   lea  L1173[K1], L1026
+L1665:   inc  L414
+L1666:   sub  #-751, L556
+L1667:   not  L1041[K0]
+L1668:   prn  r1
+L1669:   mov  L1048, L1262[K2]
+L1670:   rts
+L1671:   inc  r5
+L1672:   lea  L664, L765
+L1673:   mov  L1624[2], L605
+L1674:   clr  L598[14]
+L1675:   sub  #-982, L344[K1]
+L1676:   not  L1177[K1]
+L1677:   jmp  L679
+L1678:   dec  L14
+L1679:   bne  L965
+L1680:   rts
+L1681:   not  r3
+L1682:   prn  r1
+L1683:   cmp  L858[13], r7
+L1684:   sub  #-1112, L258
+L1685:   red  L1104
+L1686:   clr  L1383
+L1687:   inc  L1226
+L1688:   hlt
+L1689:   rts
+L1690:   hlt
+L1691:   jsr  r1
+L1692:   not  r3
+L1693:   sub  L366, L941[K1]
+L1694:   lea  L1606, L992
+L1695:   not  r5
+L1696:   mov  L1338, r4
+L1697:   hlt
+L1698:   lea  L1459, L457[11]
+L1699:   bne  r7
+L1700:   red  r0
+L1701:   inc  r7
+L1702:   mov  L1568, r0
+L1703:   inc  L365[0]
+L1704:   hlt
+L1705:   bne  L1102
+L1706:   inc  r7
+L1707:   bne  r7
+L1708:   lea  L971[K2], L765
+L1709:   dec  L1063[14]
+L1710:   dec  r0
+L1711:   not  L765[5]
+L1712:   jmp  L1502
+L1713:   cmp  L50, r6
+L1714:   bne  r6
+L1715:   dec  L1323
+L1716:   lea  L439, L6
+L1717:   lea  L1569[6], r1
+L1718:   hlt
+L1719:   mov  #-1382, L1064
+L1720:   add  L331, r7
+L1721:   prn  L615
+L1722:   prn  #K0
+L1723:   red  L1095
+L1724:   cmp  r6, L172
+L1725:   sub  L488, r5
+L1726:   clr  L1508
+L1727:   sub  L1325[2], L1052
+L1728:   hlt
+L1729:   jsr  L183
+L1730:   bne  L276
+L1731:   bne  L536
+L1732:   rts
+L1733:   mov  L1368[K1], L1593[K1]
+L1734:   red  r3
+L1735:   bne  r3
+L1736:   lea  L1450, r1
+L1737:   red  L895[K0]
+L1738:   not  L1342[K0]
+L1739:   bne  r2
+L1740:   not  L334[11]
+L1741:   cmp  r6, r6
+L1742:   not  r2
+L1743:   inc  r5
+L1744:   mov  L1243, L976[K3]
+L1745:   jmp  r4
+L1746:   inc  L1013
+L1747:   dec  L452
+L1748:   red  L1408[K2]
+L1749:   jmp  L564
+L1750:   sub  L141, L1745[13]
+L1751:   inc  L949[K3]
+L1752:   sub  L951[11], r5
+L1753:   inc  r2
+L1754:   lea  L1250, L1540
+L1755:   jmp  L74
+L1756:   not  L1585
+L1757:   sub  L10[K3], r6
+L1758:   dec  L1203
+L1759:   clr  r5
+L1760:   hlt
+L1761:   sub  L942, r0
+L1762:   lea  L1243[11], L321
+L1763:   hlt
+L1764:   hlt
+L1765:   dec  L547[K3]
+L1766:   not  L1010
+L1767:   jsr  r6
+L1768:   inc  L1615
+L1769:   bne  L948
+L1770:   jsr  L48
+L1771:   hlt
+L1772:   jmp  L519
+L1773:   jsr  L1218
+L1774:   cmp  r4, L1420
+L1775:   hlt
+L1776:   jsr  L1247
+L1777:   not  r4
+L1778:   not  L978
+L1779:   hlt
+L1780:   add  L1506[K1], r1
+L1781:   rts
+L1782:   sub  L590[K0], L506[K1]
+L1783:   add  L1023, r0
+L1784:   sub  r7, r2
+L1785:   jmp  L1562
+L1786:   bne  r5
+L1787:   cmp  r5, #K3
+L1788:   not  r5
+L1789:   sub  r4, L324
+L1790:   add  L573, L994[K1]
+L1791:   sub  #1685, L941
+L1792:   sub  r0, L672[14]
+L1793:   hlt
+L1794:   add  r5, r0
+L1795:   prn  #K2
+L1796:   mov  r4, r2
+L1797:   sub  L793, L1341[2]
+L1798:   prn  r3
+L1799:   prn  #488
+L1800:   cmp  L58[K1], r3
+L1801:   clr  L979[K3]
+L1802:   mov  r0, L982[K0]
+L1803:   lea  L1207[K2], L1593
+L1804:   not  L1630
+L1805:   lea  L151, L946
+L1806:   mov  #-1925, L543[K1]
+L1807:   red  r3
+L1808:   inc  L1419[K1]
+L1809:   prn  L852[8]
+L1810:   add  L173, L342
+L1811:   inc  L1055[K0]
+L1812:   prn  r6
+L1813:   add  r4, r7
+L1814:   cmp  #-304, L1491
+L1815:   prn  r1
+L1816:   cmp  #1247, L1016
+L1817:   lea  L1458, L1680[K3]
+L1818:   jsr  L159
+L1819:   lea  L1694[K2], L1574
+L1820:   jmp  r0
+L1821:   red  L1601[11]
+L1822:   inc  L310
+L1823:   sub  r4, L1220
+L1824:   rts
+L1825:   sub  #-631, L1452
+L1826:   add  #-806, L1772[K3]
+L1827:   sub  L624, r3
+L1828:   sub  L1705, r2
+L1829:   bne  L1455
+L1830:   clr  L1159[K0]
+L1831:   rts
+L1832:   sub  L421, L889
+L1833:   bne  r1
+L1834:   bne  r3
+L1835:   jsr  L1715
+L1836:   not  L889
+L1837:   add  #-586, L656[K0]
+L1838:   prn  L339[3]
+L1839:   lea  L1762[K0], L574[K0]
+L1840:   rts
+L1841:   hlt
+L1842:   sub  L676, L953[K0]
+L1843:   dec  L690[0]
+L1844:   rts
+L1845:   rts
+L1846:   red  L518
+L1847:   hlt
+L1848:   rts
+L1849:   bne  r1
+L1850:   bne  L1823
+L1851:   prn  L568[14]
+L1852:   red  L1046[2]
+L1853:   prn  L1635
+L1854:   bne  L570
+L1855:   hlt
+L1856:   add  #1483, r0
+L1857:   clr  L1445
+L1858:   mov  L933, L219[K0]
+L1859:   add  L1749[K1], r5
+L1860:   jmp  r4
+L1861:   hlt
+L1862:   sub  L511, L1382
+L1863:   not  r2
+L1864:   inc  r4
+L1865:   add  #-496, L773
+L1866:   not  L1275
+L1867:   prn  L1318[K3]
+L1868:   inc  L1041[9]
+L1869:   jmp  r0
+L1870:   cmp  r7, L1331
+L1871:   jsr  r1
+L1872:   add  #560, L1461
+L1873:   rts
+L1874:   red  L1623[3]
+L1875:   lea  L598, L1070[K1]
+L1876:   jmp  L827
+L1877:   hlt
+L1878:   jsr  L195
+L1879:   bne  r7
+L1880:   bne  r6
+L1881:   jsr  L1576
+L1882:   hlt
+L1883:   red  r6
+L1884:   sub  #548, r4
+L1885:   clr  L1269[4]
+L1886:   rts
+L1887:   cmp  #297, r0
+L1888:   cmp  L1569[1], L582
+L1889:   bne  r2
+L1890:   prn  r5
+L1891:   hlt
+L1892:   inc  L621[K2]
+L1893:   clr  L1327[10]
+L1894:   sub  L188, L1801
+L1895:   bne  r5
+L1896:   prn  L1626
+L1897:   cmp  L1656[K0], #58
+L1898:   cmp  r5, L449
+L1899:   bne  r0
+L1900:   red  L1345
+L1901:   red  r4
+L1902:   mov  L1617[K2], L1064
+L1903:   hlt
+L1904:   prn  L914
+L1905:   jsr  r2
+L1906:   hlt
+L1907:   rts
+L1908:   not  r0
+L1909:   rts
+L1910:   cmp  L507, r6
+L1911:   red  r0
+L1912:   rts
+L1913:   clr  L956[12]
+L1914:   prn  L197[10]
+L1915:   jmp  r0
+L1916:   inc  L1729[8]
+L1917:   rts
+L1918:   bne  r5
+L1919:   bne  L1355
+L1920:   prn  L936
+L1921:   prn  L411
+L1922:   red  L404
+L1923:   jmp  r5
+L1924:   mov  L1500[6], r6
+L1925:   lea  L1716[K2], L211[14]
+L1926:   jsr  L1228
+L1927:   dec  L286
+L1928:   hlt
+L1929:   prn  L554
+L1930:   lea  L1350, L1693[K3]
+L1931:   prn  L1692
+L1932:   mov  L18[K0], L782
+L1933:   bne  r2
+L1934:   mov  r6, L989
+L1935:   prn  r3
+L1936:   not  L1102[K3]
+L1937:   add  L576, r3
+L1938:   hlt
+L1939:   mov  L834[12], L540[2]
+L1940:   jmp  r5
+L1941:   hlt
+L1942:   rts
+L1943:   inc  r5
+L1944:   jsr  r7
+L1945:   clr  r1
+L1946:   prn  #1560
+L1947:   clr  L17[5]
+L1948:   dec  L1170
+L1949:   prn  L1847[K3]
+L1950:   clr  r0
+L1951:   not  L1559[K2]
+L1952:   sub  r5, L1918[10]
+L1953:   lea  L175[7], L1340[K2]
+L1954:   prn  #K3
+L1955:   jsr  r0
+L1956:   add  L1479, r2
+L1957:   clr  L834[K3]
+L1958:   add  r0, L664[K3]
+L1959:   cmp  L66, #K2
+L1960:   sub  L1647[K3], L1155[7]
+L1961:   cmp  r0, r6
+L1962:   mov  r4, r0
+L1963:   cmp  L732, L1586
+L1964:   jsr  r3
+L1965:   mov  L186, r1
+L1966:   jmp  L200
+L1967:   not  L460
+L1968:   add  L937[15], L1768
+L1969:   add  r2, r5
+L1970:   prn  L240[K2]
+L1971:   bne  r7
+L1972:   sub  L726, L924[K1]
+L1973:   not  L1822[K0]
+L1974:   red  r3
+L1975:   jsr  r0
+L1976:   hlt
+L1977:   cmp  r1, L499
+L1978:   rts
+L1979:   mov  r3, r3
+L1980:   add  L995[1], L1213[K2]
+L1981:   dec  L931
+L1982:   cmp  #-1950, L304
+L1983:   inc  r1
+L1984:   not  L130
+L1985:   rts
+L1986:   clr  r5
+L1987:   sub  r6, L1366[K1]
+L1988:   sub  L382[2], r6
+L1989:   clr  L153
+L1990:   lea  L1460[2], L458[K2]
+L1991:   prn  L326[3]
+L1992:   jmp  r6
+L1993:   mov  #754, r4
+L1994:   hlt
+L1995:   not  r0
+L1996:   lea  L609[5], L1312[K3]
+L1997:   clr  L1088
+L1998:   mov  L643, L577
+L1999:   mov  L157[K0], X3
+L2000:   bne  r3
+L2001:   red  L428[13]
+L2002:   hlt
+L2003:   dec  r7
+L2004:   cmp  r3, L1623
+L2005:   hlt
+L2006:   rts
+L2007:   red  r0
+L2008:   bne  r2
+L2009:   not  L619
+L2010:   mov  r7, L317[K1]
+L2011:   clr  L1651[K0]
+L2012:   jsr  r2
+L2013:   mov  #-967, L953[K3]
+L2014:   mov  X14, L193[13]
+L2015:   jsr  r5
+L2016:   lea  L56, L1799[K1]
+L2017:   lea  L799[12], r6
+L2018:   not  r2
+L2019:   lea  L931, L1986
+L2020:   add  L328, L509[K3]
+L2021:   jsr  L1146
+L2022:   lea  L1240[K1], r6
+L2023:   inc  r3
+L2024:   hlt
+L2025:   not  L1874
+L2026:   clr  L1379
+L2027:   prn  #K3
+L2028:   bne  r5
+L2029:   mov  L712[K0], L380
+L2030:   inc  L545
+L2031:   sub  L564[K0], r0
+L2032:   dec  L1644[K1]
+L2033:   jsr  r4
+L2034:   sub  L1422, L1374
+L2035:   bne  L171
+L2036:   dec  r7
+L2037:   bne  r4
+L2038:   jmp  r3
+L2039:   cmp  r3, r4
+L2040:   not  L1161[9]
+L2041:   dec  L1882[K0]
+L2042:   hlt
+L2043:   prn  L1399[K3]
+L2044:   inc  L362
+L2045:   red  L1420[4]
+L2046:   add  r4, L510[2]
+L2047:   red  r3
+L2048:   jmp  L40
+L2049:   sub  L814, r4
+L2050:   dec  L661
+L2051:   dec  r7
+L2052:   add  r0, L1543
+L2053:   dec  L60[8]
+L2054:   rts
+L2055:   prn  L1967
+L2056:   mov  L1086[K2], L797
+L2057:   rts
+L2058:   add  r3, L963[K3]
+L2059:   sub  r3, L772[5]
+L2060:   clr  L624[7]
+L2061:   rts
+L2062:   mov  L1002[13], r7
+L2063:   sub  L817, L1933[15]
+L2064:   not  L105
+L2065:   jmp  r3
+L2066:   cmp  L1835, L1825
+L2067:   inc  L743[K1]
+L2068:   dec  L164[K2]
+L2069:   dec  L1627
+L2070:   red  r5
+L2071:   sub  L1729[15], L135[K2]
+L2072:   red  L793[0]
+L2073:   sub  L2044, L514[3]
+L2074:   dec  L1271[13]
+L2075:   red  r5
+L2076:   jsr  r6
+L2077:   prn  L351
+L2078:   prn  r6
+L2079:   add  L1658[K2], L213
+L2080:   jmp  r0
+L2081:   not  L512
+L2082:   bne  r4
+L2083:   red  L1157[K0]
+L2084:   not  r0
+L2085:   jsr  r1
+L2086:   rts
+L2087:   jmp  r1
+L2088:   jmp  r4
+L2089:   prn  L1960[K2]
+L2090:   bne  L640
+L2091:   clr  L325
+L2092:   rts
+L2093:   clr  L135[10]
+L2094:   sub  #-186, L898
+L2095:   rts
+L2096:   lea  L1522[0], L360
+L2097:   mov  #-292, L1841[K0]
+L2098:   dec  L954[6]
+L2099:   clr  L1303[K3]
+L2100:   add  L501, r5
+L2101:   jmp  r2
+L2102:   prn  #1991
+L2103:   not  L1436[6]
+L2104:   sub  L1538[K2], r5
+L2105:   rts
+L2106:   clr  L1098[K2]
+L2107:   sub  #1424, L1202[K2]
+L2108:   red  L893
+L2109:   add  #1504, L1704[K3]
+L2110:   hlt
+L2111:   bne  r5
+L2112:   lea  L353, r6
+L2113:   rts
+L2114:   add  L1193[K1], L1130
+L2115:   prn  #K1
+L2116:   hlt
+L2117:   inc  L1429[K0]
+L2118:   rts
+L2119:   red  L812
+L2120:   jmp  L1945
+L2121:   clr  L924
+L2122:   cmp  L795[9], r0
+L2123:   red  L1582[5]
+L2124:   prn  L335[K1]
+L2125:   rts
+L2126:   hlt
+L2127:   clr  L446
+L2128:   rts
+L2129:   bne  r4
+L2130:   mov  r7, L25[K3]
+L2131:   inc  r6
+L2132:   jsr  L404
+L2133:   hlt
+L2134:   add  L2052, L1756[K0]
+L2135:   clr  r6
+L2136:   add  r1, L70
+L2137:   cmp  #736, L1978
+L2138:   inc  L1005[K1]
+L2139:   prn  L484
+L2140:   bne  L397
+L2141:   inc  r2
+L2142:   prn  L99
+L2143:   inc  L1220[3]
+L2144:   add  #-1455, L672[6]
+L2145:   dec  L1622[K0]
+L2146:   cmp  r5, L1031[2]
+L2147:   not  L631
+L2148:   jmp  L958
+L2149:   not  L380
+L2150:   inc  L1785[4]
+L2151:   hlt
+L2152:   clr  L633[K0]
+L2153:   prn  L1847
+L2154:   dec  L21[K2]
+L2155:   inc  r6
+L2156:   bne  L821
+L2157:   add  #-1977, r0
+L2158:   lea  L124, L960[K2]
+L2159:   clr  L724[5]
+L2160:   lea  L1206[K2], L1998[K0]
+L2161:   rts
+L2162:   jsr  L1062
+L2163:   add  #-603, L630[9]
+L2164:   not  r5
+L2165:   inc  r6
+L2166:   add  L1364, r5
+L2167:   sub  #-1500, r0
+L2168:   mov  L668[K2], L1082[K1]
+L2169:   mov  r1, L642
+L2170:   mov  L1976[4], r0
+L2171:   mov  #471, L1363
+L2172:   clr  r6
+L2173:   clr  L1601
+L2174:   mov  L1908, L1607[K2]
+L2175:   clr  r6
+L2176:   prn  L259[4]
+L2177:   not  L1662
+L2178:   clr  L141
+L2179:   mov  L2064[K2], r6
+L2180:   hlt
+L2181:   add  r6, L1510[K1]
+L2182:   not  L871[K1]
+L2183:   lea  L2147[1], L274
+L2184:   jsr  r5
+L2185:   mov  #-549, r5
+L2186:   not  L784[5]
+L2187:   clr  L1867[15]
+L2188:   cmp  L2037[K2], #K3
+L2189:   mov  L134, r1
+L2190:   not  r0
+L2191:   jsr  L552
+L2192:   not  L308[K2]
+L2193:   not  L766
+L2194:   inc  r1
+L2195:   hlt
+L2196:   bne  L175
+L2197:   bne  L2084
+L2198:   cmp  L1365[13], L771[6]
+L2199:   dec  L218
+L2200:   clr  L1584
+L2201:   add  L1356, L113[2]
+L2202:   hlt
+L2203:   bne  L544
+L2204:   inc  L512
+L2205:   inc  L623[K1]
+L2206:   red  r7
+L2207:   lea  L1980[K0], L2075[9]
+L2208:   add  r1, L631
+L2209:   sub  L1670[K1], r1
+L2210:   red  L745[K2]
+L2211:   bne  r6
+L2212:   dec  L1689
+L2213:   lea  L848, L1670
+L2214:   lea  L1800[13], L475[8]
+L2215:   red  L43[K2]
+L2216:   prn  L387[5]
+L2217:   rts
+L2218:   jsr  r4
+L2219:   not  r4
+L2220:   not  r3
+L2221:   add  r0, L594[5]
+L2222:   inc  r6
+L2223:   clr  L290[14]
+L2224:   not  L1600
+L2225:   rts
+L2226:   jmp  r1
+L2227:   add  L1734[0], L573[K1]
+L2228:   not  L1422
+L2229:   bne  r7
+L2230:   rts
+L2231:   prn  #-1654
+L2232:   lea  L75, L1653
+L2233:   prn  L2000
+L2234:   lea  L1251[K0], L434
+L2235:   mov  #1438, L39[1]
+L2236:   not  L38
+L2237:   bne  L17
+L2238:   red  L1403[6]
+L2239:   dec  L764[K2]
+L2240:   dec  L1200
+L2241:   mov  L1690, r3
+L2242:   jmp  r4
+L2243:   inc  r2
+L2244:   clr  r0
+L2245:   clr  L271
+L2246:   lea  L456, r3
+L2247:   hlt
+L2248:   clr  r1
+L2249:   inc  L2178[K0]
+L2250:   jsr  L994
+L2251:   jsr  L1124
+L2252:   sub  L1606[6], r2
+L2253:   mov  L50, L580
+L2254:   mov  L1721[K0], r4
+L2255:   clr  L1549[K2]
+L2256:   clr  L744[13]
+L2257:   dec  L1890
+L2258:   hlt
+L2259:   sub  r5, L974[7]
+L2260:   bne  L1317
+L2261:   red  r5
+L2262:   jmp  L1948
+L2263:   rts
+L2264:   hlt
+L2265:   rts
+L2266:   jmp  L251
+L2267:   jsr  r6
+L2268:   jsr  r5
+L2269:   cmp  #-1744, L166[13]
+L2270:   lea  L610, L193
+L2271:   mov  L1609[15], r5
+L2272:   jmp  r0
+L2273:   red  L2051[12]
+L2274:   not  L1228
+L2275:   not  L1497
+L2276:   not  L699
+L2277:   add  #-1991, L2002[K2]
+L2278:   rts
+L2279:   sub  L194[K0], L1973[K1]
+L2280:   add  L865[K3], L465[3]
+L2281:   hlt
+L2282:   jmp  L470
+L2283:   bne  r5
+L2284:   cmp  r5, #K3
+L2285:   not  r5
+L2286:   sub  r4, L1117
+L2287:   add  L1524[1], r4
+L2288:   mov  #-1336, L1288
+L2289:   hlt
+L2290:   lea  L1872, r5
+L2291:   dec  L1315[K0]
+L2292:   cmp  #660, r4
+L2293:   jsr  L1755
+L2294:   mov  L1954[K3], L903[K1]
+L2295:   prn  r3
+L2296:   prn  #-424
+L2297:   cmp  L374[K1], r3
+L2298:   clr  r0
+L2299:   hlt
+L2300:   clr  L1070[K3]
+L2301:   cmp  L1133, L812[4]
+L2302:   dec  L1025[14]
+L2303:   lea  L368, L1816
+L2304:   mov  #1899, L1803[K1]
+L2305:   red  r3
+L2306:   inc  L446
+L2307:   sub  #1972, r6
+L2308:   inc  r2
+L2309:   mov  r5, r1
+L2310:   inc  r3
+L2311:   add  #-725, r4
+L2312:   bne  L651
+L2313:   jmp  r5
+L2314:   mov  r1, L1288[12]
+L2315:   cmp  #-1681, L392
+L2316:   lea  L1882, r2
+L2317:   mov  L2111, r1
+L2318:   red  r6
+L2319:   red  r0
+L2320:   rts
+L2321:   dec  L674
+L2322:   sub  r6, L397
+L2323:   bne  r7
+L2324:   cmp  L1898, #1308
+L2325:   sub  #1433, r1
+L2326:   bne  r2
+L2327:   bne  r0
+L2328:   prn  r2
+L2329:   bne  L518
+L2330:   cmp  L1193, r4
+L2331:   add  r2, L228[5]
+L2332:   not  L2042[K3]
+L2333:   jsr  r1
+L2334:   clr  L972
+L2335:   jsr  r2
+L2336:   add  #342, r5
+L2337:   add  L14, L2305[K0]
+L2338:   jmp  L2144
+L2339:   prn  L1028[3]
+L2340:   lea  L1104[K0], L1339[K0]
+L2341:   rts
+L2342:   hlt
+L2343:   sub  L1643, r2
+L2344:   bne  r0
+L2345:   prn  r0
+L2346:   rts
+L2347:   rts
+L2348:   red  L1435[K3]
+L2349:   clr  r1
+L2350:   clr  r1
+L2351:   sub  r2, L2061[15]
+L2352:   clr  L1358[K2]
+L2353:   clr  r1
+L2354:   sub  L1276[13], r5
+L2355:   mov  r5, L1261[11]
+L2356:   dec  L2090
+L2357:   add  L208[0], r0
+L2358:   dec  L284[7]
+L2359:   add  L1944[K1], r5
+L2360:   jmp  r4
+L2361:   hlt
+L2362:   sub  L7, L1092
+L2363:   not  L154[K3]
+L2364:   hlt
+L2365:   red  L642
+L2366:   bne  L496
+L2367:   prn  #K1
+L2368:   jmp  L1933
+L2369:   jmp  L2085
+L2370:   jmp  r1
+L2371:   clr  r7
+L2372:   jsr  r1
+L2373:   add  #86, L1451[12]
+L2374:   inc  L1573[15]
+L2375:   cmp  r2, L1491
+L2376:   hlt
+L2377:   hlt
+L2378:   inc  L769
+L2379:   rts
+L2380:   clr  r5
+L2381:   bne  r7
+L2382:   bne  r6
+L2383:   jsr  L1259
+L2384:   hlt
+L2385:   red  L1958[14]
+L2386:   prn  #681
+L2387:   not  r1
+L2388:   clr  r3
+L2389:   hlt
+L2390:   jmp  r7
+L2391:   add  L735, L678[5]
+L2392:   red  L459
+L2393:   not  r2
+L2394:   red  r1
+L2395:   prn  #1502
+L2396:   bne  r0
+L2397:   dec  L2212
+L2398:   hlt
+L2399:   clr  L1838[K1]
+L2400:   jmp  r3
+L2401:   bne  L2031
+L2402:   lea  L513[12], L1995[15]
+L2403:   inc  r7
+L2404:   inc  L1196[11]
+L2405:   mov  #-1586, L1596[K1]
+L2406:   rts
+L2407:   hlt
+L2408:   prn  L266
+L2409:   jsr  r2
+L2410:   hlt
+L2411:   rts
+L2412:   not  L1304
+L2413:   not  L969[K1]
+L2414:   lea  L2160, L1924
+L2415:   bne  r6
+L2416:   prn  L1468
+L2417:   jmp  L1192
+L2418:   jsr  r7
+L2419:   clr  r0
+L2420:   rts
+L2421:   bne  r5
+L2422:   bne  L1763
+L2423:   prn  L1495
+L2424:   prn  L2404
+L2425:   red  L520[K0]
+L2426:   cmp  #110, L196
+L2427:   prn  L2421
+L2428:   hlt
+L2429:   jsr  L35
+L2430:   jsr  L1964
+L2431:   dec  L1802[K2]
+L2432:   bne  L701
+L2433:   cmp  r4, L2362[K3]
+L2434:   prn  L924[12]
+L2435:   add  #1848, L2106[K1]
+L2436:   add  L2030[K2], L1238[1]
+L2437:   add  L868, L537[K2]
+L2438:   cmp  L1865[15], #9
+L2439:   sub  L596, L1834
+L2440:   mov  L563[12], L1387[2]
+L2441:   jmp  r5
+L2442:   hlt
+L2443:   rts
+L2444:   inc  L1174
+L2445:   inc  L135[13]
+L2446:   jmp  X11
+L2447:   red  L585[K1]
+L2448:   prn  #-1748
+L2449:   red  L681
+L2450:   jsr  L449
+L2451:   inc  L2234[K2]
+L2452:   inc  L1126
+L2453:   clr  L173
+L2454:   rts
+L2455:   jmp  r7
+L2456:   prn  #K3
+L2457:   jsr  r0
+L2458:   add  L2346[0], L2439
+L2459:   cmp  L356[K2], L2189[K3]
+L2460:   hlt
+L2461:   dec  L1262[13]
+L2462:   jsr  r0
+L2463:   inc  L901
+L2464:   jmp  r7
+L2465:   not  r1
+L2466:   inc  L2163
+L2467:   red  L1924[K1]
+L2468:   jsr  r3
+L2469:   mov  r6, L651[K2]
+L2470:   mov  r6, L867
+L2471:   jmp  r2
+L2472:   sub  L928, L2248[K3]
+L2473:   clr  L800[K3]
+L2474:   mov  L1252[K2], r4
+L2475:   prn  r3
+L2476:   not  L996[K2]
+L2477:   not  L1497
+L2478:   bne  r2
+L2479:   jmp  r7
+L2480:   rts
+L2481:   red  L2232
+L2482:   lea  L626, r5
+L2483:   red  L747[K2]
+L2484:   bne  L1279
+L2485:   clr  r0
+L2486:   jmp  L597
+L2487:   prn  #K2
+L2488:   red  r6
+L2489:   not  L2337[12]
+L2490:   prn  L1942[12]
+L2491:   not  L977[3]
+L2492:   rts
+L2493:   rts
+L2494:   add  L1740[9], L831[8]
+L2495:   prn  L282[9]
+L2496:   hlt
+L2497:   rts
+L2498:   sub  r6, L2183
+L2499:   mov  L1371[0], L1907
+L2500:   dec  L869[K2]
+L2501:   dec  r1
+L2502:   clr  r7
+L2503:   prn  L1477[13]
+L2504:   hlt
+L2505:   red  L1400[K0]
+L2506:   add  L687, L634[K2]
+L2507:   jmp  r5
+L2508:   jsr  L1127
+L2509:   dec  L102[K3]
+L2510:   sub  r7, r3
+L2511:   bne  L1923
+L2512:   mov  L1985, L1715[10]
+L2513:   dec  L44[K1]
+L2514:   red  r5
+L2515:   add  L2415, L91
+L2516:   cmp  L238, L1328[0]
+L2517:   jsr  r4
+L2518:   hlt
+L2519:   dec  L644[K1]
+L2520:   red  L869[K3]
+L2521:   inc  r0
+L2522:   lea  L2454[8], L1601[4]
+L2523:   prn  L256
+L2524:   rts
+L2525:   clr  L1431
+L2526:   inc  L1274
+L2527:   jsr  L1985
+L2528:   lea  L2157, L407[K0]
+L2529:   red  L2034[8]
+L2530:   sub  r1, r3
+L2531:   lea  L1692[12], r7
+L2532:   rts
+L2533:   red  L2302[K0]
+L2534:   add  L2185[9], L2217[K0]
+L2535:   not  L2211[0]
+L2536:   bne  L1850
+L2537:   prn  #957
+L2538:   jmp  L496
+L2539:   prn  #1178
+L2540:   lea  L920, r2
+L2541:   dec  L1716[6]
+L2542:   clr  L957
+L2543:   inc  r7
+L2544:   not  L598
+L2545:   jmp  L2403
+L2546:   mov  #1501, r0
+L2547:   red  L397[6]
+L2548:   bne  r7
+L2549:   bne  L2362
+L2550:   not  r4
+L2551:   clr  L1765[4]
+L2552:   red  L1618[10]
+L2553:   red  L587
+L2554:   cmp  #-1091, r4
+L2555:   lea  L867, L869[K0]
+L2556:   add  #1111, r2
+L2557:   dec  L2117
+L2558:   cmp  L500, X14
+L2559:   rts
+L2560:   mov  r6, L2427[6]
+L2561:   prn  r6
+L2562:   add  r7, L792
+L2563:   mov  L1959[11], r5
+L2564:   hlt
+L2565:   mov  L1101[0], L1080[4]
+L2566:   bne  L740
+L2567:   clr  L162[5]
+L2568:   dec  r5
+L2569:   rts
+L2570:   bne  r7
+L2571:   clr  r1
+L2572:   clr  L1059[K3]
+L2573:   rts
+L2574:   cmp  #1831, #1896
+L2575:   rts
+L2576:   add  #-37, L1826[9]
+L2577:   mov  r6, L1763
+L2578:   sub  r6, L870[K2]
+L2579:   mov  r3, r2
+L2580:   red  r5
+L2581:   rts
+L2582:   add  r5, r7
+L2583:   red  L1525
+L2584:   rts
+L2585:   prn  L177
+L2586:   prn  r6
+L2587:   add  #1563, r7
+L2588:   not  L1691
+L2589:   bne  r7
+L2590:   clr  r2
+L2591:   sub  L973, r3
+L2592:   prn  L1412
+L2593:   inc  L598
+L2594:   rts
+L2595:   jmp  r1
+L2596:   jmp  r4
+L2597:   prn  L2496[K2]
+L2598:   bne  L2154
+L2599:   clr  L1961[K2]
+L2600:   not  r7
+L2601:   prn  r2
+L2602:   sub  L2122[K2], L875[K0]
+L2603:   lea  L2213[0], L2494
+L2604:   mov  r0, r2
+L2605:   not  L183[3]
+L2606:   hlt
+L2607:   jmp  r4
+L2608:   red  L535[9]
+L2609:   hlt
+L2610:   jmp  L20
+L2611:   inc  r2
+L2612:   jsr  r5
+L2613:   lea  L206[K3], L580
+L2614:   rts
+L2615:   lea  L1987, L2412
+L2616:   add  r6, L1380
+L2617:   bne  r0
+L2618:   cmp  r0, #1128
+L2619:   jmp  r2
+L2620:   hlt
+L2621:   red  L615
+L2622:   not  r0
+L2623:   dec  L2307
+L2624:   clr  r1
+L2625:   prn  #K1
+L2626:   hlt
+L2627:   inc  r3
+L2628:   dec  r4
+L2629:   cmp  L2210, r4
+L2630:   not  L1921[K0]
+L2631:   jmp  r1
+L2632:   cmp  L1315[9], r0
+L2633:   red  L1563
+L2634:   bne  L461
+L2635:   not  L1685
+L2636:   jmp  r5
+L2637:   red  L1060
+L2638:   bne  r4
+L2639:   mov  r7, L2620[K3]
+L2640:   inc  L1694[10]
+L2641:   inc  L1986[15]
+L2642:   add  L2442, L2528[K0]
+L2643:   clr  r6
+L2644:   add  r1, L1270
+L2645:   cmp  #-944, L2549
+L2646:   inc  L747[K1]
+L2647:   prn  L319
+L2648:   bne  L2177
+L2649:   inc  L951[K3]
+L2650:   sub  L802[3], L1981[K3]
+L2651:   add  #-963, r4
+L2652:   jsr  X8
+L2653:   mov  L1883[2], L793[1]
+L2654:   cmp  #953, #K1
+L2655:   sub  L572, r0
+L2656:   bne  r6
+L2657:   sub  L669, r7
+L2658:   hlt
+L2659:   clr  L2371
+L2660:   add  r2, L1264[K0]
+L2661:   inc  L180
+L2662:   prn  L1238[10]
+L2663:   jsr  r5
+L2664:   mov  L586[K0], L2479[12]
+L2665:   not  L2453[K1]
+L2666:   jmp  r0
+L2667:   hlt
+L2668:   mov  L150[K1], r6
+L2669:   jmp  L2496
+L2670:   hlt
+L2671:   cmp  #-1131, #809
+L2672:   not  L1680
+L2673:   lea  L69[2], L2637[K1]
+L2674:   sub  L1978, L810
+L2675:   not  L2397
+L2676:   sub  L1240[K3], r0
+L2677:   red  r0
+L2678:   bne  r4
+L2679:   mov  #1383, r6
+L2680:   clr  L2382
+L2681:   clr  L756
+L2682:   mov  L2376, L2035[K2]
+L2683:   clr  L281[14]
+L2684:   sub  L94, L108
+L2685:   jsr  r5
+L2686:   jsr  L1654
+L2687:   bne  L1650
+L2688:   add  L791[K0], r2
+L2689:   add  r6, L2495[3]
+L2690:   cmp  r2, L227[7]
+L2691:   jsr  r4
+L2692:   inc  L2116
+L2693:   red  L1797[9]
+L2694:   hlt
+L2695:   inc  X7
+L2696:   lea  L1814, L103
+L2697:   hlt
+L2698:   jsr  r1
+L2699:   not  r3
+L2700:   sub  L2211, L2204
+L2701:   not  L345
+L2702:   hlt
+L2703:   clr  L529[8]
+L2704:   prn  L74
+L2705:   hlt
+L2706:   lea  L2539[K3], L1065
+L2707:   bne  r7
+L2708:   red  r0
+L2709:   inc  L1358
+L2710:   mov  r2, L1195[K1]
+L2711:   dec  r0
+L2712:   hlt
+L2713:   bne  L465
+L2714:   inc  L1117[K2]
+L2715:   clr  L1156[11]
+L2716:   cmp  L1850[8], r6
+L2717:   inc  r3
+L2718:   cmp  r4, #K0
+L2719:   jmp  r5
+L2720:   bne  L2357
+L2721:   red  L1810[K2]
+L2722:   bne  r6
+L2723:   dec  L1938
+L2724:   lea  L2152, L865[K0]
+L2725:   sub  L1954[15], L2256[K3]
+L2726:   mov  #1082, L938
+L2727:   add  L1414, r7
+L2728:   prn  L142
+L2729:   prn  #K0
+L2730:   red  r2
+L2731:   add  L758, r1
+L2732:   inc  L1905
+L2733:   red  L2629[6]
+L2734:   dec  L1725
+L2735:   bne  r5
+L2736:   add  L1650, L393[14]
+L2737:   bne  L402
+L2738:   not  r2
+L2739:   sub  #-1744, L1963[K0]
+L2740:   not  L489[K2]
+L2741:   not  L2210[K0]
+L2742:   red  r5
+L2743:   jmp  L2432
+L2744:   red  L2186
+L2745:   cmp  #-1206, #K3
+L2746:   cmp  #-92, L784[10]
+L2747:   sub  L2510, L1005
+L2748:   not  L1130[K0]
+L2749:   jsr  L363
+L2750:   rts
+L2751:   mov  L1475[12], r1
+L2752:   inc  r2
+L2753:   clr  r0
+L2754:   clr  r3
+L2755:   lea  L899, L247
+L2756:   hlt
+L2757:   clr  L300[9]
+L2758:   bne  L320
+L2759:   sub  L1388, L451
+L2760:   inc  L1490
+L2761:   jmp  L1556
+L2762:   red  r5
+L2763:   add  #-719, r4
+L2764:   jsr  L1511
+L2765:   hlt
+L2766:   jsr  L2552
+L2767:   jsr  r1
+L2768:   clr  L2121
+L2769:   cmp  L1063, L2682
+L2770:   lea  L63, r2
+L2771:   rts
+L2772:   dec  L1721
+L2773:   sub  L1789[K1], r3
+L2774:   mov  #1789, X2
+L2775:   not  L2655
+L2776:   sub  L1889, L1411
+L2777:   mov  L1774, L268
+L2778:   bne  L1398
+L2779:   clr  L2026
+L2780:   inc  r6
+L2781:   sub  L58, r7
+L2782:   hlt
+L2783:   not  L1526[K1]
+L2784:   clr  L408
+L2785:   bne  L528
+L2786:   jmp  r1
+L2787:   prn  #1963
+L2788:   jmp  L342
+L2789:   mov  #-1007, r4
+L2790:   clr  L984
+L2791:   bne  L148
+L2792:   rts
+L2793:   jmp  r0
+L2794:   mov  L170[5], L2343[14]
+L2795:   sub  r4, L2748
+L2796:   add  L2409, L2274[K1]
+L2797:   sub  #-331, L2065
+L2798:   sub  L1584[K2], L2133
+L2799:   prn  L1157[K3]
+L2800:   inc  r4
+L2801:   lea  L2073[K3], r0
+L2802:   prn  r2
+L2803:   bne  L2247
+L2804:   red  L2472
+L2805:   sub  r6, L2300
+L2806:   cmp  #-1867, r2
+L2807:   not  r7
+L2808:   clr  L1596
+L2809:   jmp  r6
+L2810:   not  L642
+L2811:   dec  r6
+L2812:   red  L2378
+L2813:   prn  L130
+L2814:   sub  L2682[13], r3
+L2815:   jsr  r3
+L2816:   jsr  r3
+L2817:   cmp  L716[8], r4
+L2818:   add  L859, L819[K1]
+L2819:   jsr  r3
+L2820:   jsr  L1786
+L2821:   add  L714, L275[K1]
+L2822:   mov  r1, L1032[12]
+L2823:   cmp  #1823, L1972
+L2824:   lea  L985, L2080[K3]
+L2825:   jsr  L748
+L2826:   lea  L195[0], r6
+L2827:   rts
+L2828:   dec  L1991[1]
+L2829:   red  r1
+L2830:   not  L1224[15]
+L2831:   cmp  L2646, #1804
+L2832:   sub  X10, L116[12]
+L2833:   sub  r0, r2
+L2834:   prn  r2
+L2835:   bne  L1216
+L2836:   cmp  L391, r4
+L2837:   add  r2, L1448[5]
+L2838:   not  r4
+L2839:   mov  L868, L1217
+L2840:   jmp  L1249
+L2841:   cmp  L1243[K2], r4
+L2842:   add  r2, r4
+L2843:   add  L2193[K0], r2
+L2844:   prn  L2282[13]
+L2845:   hlt
+L2846:   jmp  r6
+L2847:   mov  L1196[K0], r4
+L2848:   red  r0
+L2849:   jmp  L2278
+L2850:   hlt
+L2851:   not  L2845
+L2852:   hlt
+L2853:   prn  L2664
+L2854:   sub  L1693, L791[1]
+L2855:   cmp  #-1977, L1876[K0]
+L2856:   red  L1213[13]
+L2857:   rts
+L2858:   bne  r2
+L2859:   prn  L2241
+L2860:   bne  L682
+L2861:   hlt
+L2862:   add  L2324[2], L2435
+L2863:   jmp  L483
+L2864:   dec  L1047
+L2865:   add  r6, L2003
+L2866:   inc  L702[K0]
+L2867:   mov  L797[K1], L25[K0]
+L2868:   not  L2138
+L2869:   not  L1946
+L2870:   not  L1814[K2]
+L2871:   not  L2193[K0]
+L2872:   bne  r1
+L2873:   jsr  L1760
+L2874:   jmp  r0
+L2875:   cmp  r7, L2166
+L2876:   jsr  r1
+L2877:   add  L558, r6
+L2878:   rts
+L2879:   red  r7
+L2880:   cmp  r2, L2432
+L2881:   hlt
+L2882:   hlt
+L2883:   inc  L667[10]
+L2884:   lea  L1337[4], r2
+L2885:   inc  L776
+L2886:   dec  r5
+L2887:   jmp  L1477
+L2888:   red  r6
+L2889:   sub  #-1079, X12
+L2890:   lea  L707[K3], L634
+L2891:   hlt
+L2892:   jmp  r7
+L2893:   add  L367, L2804[5]
+L2894:   red  L480[13]
+L2895:   hlt
+L2896:   inc  L880
+L2897:   dec  r6
+L2898:   bne  r0
+L2899:   dec  L2851[9]
+L2900:   jsr  L1055
+L2901:   jmp  L1430
+L2902:   mov  r2, L2384
+L2903:   lea  L988[3], L154
+L2904:   dec  r7
+L2905:   dec  L1476
+L2906:   not  r0
+L2907:   add  #238, L74[1]
+L2908:   hlt
+L2909:   prn  L2472
+L2910:   jsr  r2
+L2911:   hlt
+L2912:   rts
+L2913:   not  L311[K0]
+L2914:   jsr  r7
+L2915:   dec  L96
+L2916:   dec  L1010[K2]
+L2917:   lea  L1658[7], L2484[12]
+L2918:   jmp  L1642
+L2919:   inc  L2324
+L2920:   dec  r1
+L2921:   jsr  r5
+L2922:   prn  r7
+L2923:   not  L1342
+L2924:   add  L2092[K2], r1
+L2925:   dec  r6
+L2926:   jmp  r5
+L2927:   mov  L1569, L592[12]
+L2928:   hlt
+L2929:   jsr  L2159
+L2930:   jsr  L1614
+L2931:   dec  r4
+L2932:   jsr  r7
+L2933:   prn  L1918
+L2934:   lea  L1395[K1], r3
+L2935:   mov  X13, r4
+L2936:   clr  r1
+L2937:   lea  L1753[10], L1788[K2]
+L2938:   mov  #525, r2
+L2939:   jsr  r4
+L2940:   rts
+L2941:   jmp  L1204
+L2942:   bne  r1
+L2943:   clr  r5
+L2944:   dec  r5
+L2945:   add  L2095, L2029[12]
+L2946:   sub  r4, r7
+L2947:   dec  r7
+L2948:   lea  L1433[1], L1623[8]
+L2949:   prn  #-1640
+L2950:   clr  L2343
+L2951:   prn  #-1540
+L2952:   red  L1271
+L2953:   jsr  L2348
+L2954:   inc  L2510
+L2955:   inc  r3
+L2956:   hlt
+L2957:   sub  r5, L1317
+L2958:   inc  L1059
+L2959:   prn  L1442[1]
+L2960:   hlt
+L2961:   red  L315[K3]
+L2962:   clr  L452
+L2963:   hlt
+L2964:   prn  L1007[K3]
+L2965:   dec  L2303
+L2966:   rts
+L2967:   cmp  r6, r1
+L2968:   inc  r7
+L2969:   lea  L607, L1517[K1]
+L2970:   jmp  r5
+L2971:   cmp  L2141, L1012[K1]
+L2972:   mov  r6, L953[K2]
+L2973:   mov  L2379[K1], L2659[7]
+L2974:   prn  L1522[K0]
+L2975:   sub  L919, L542[K2]
+L2976:   prn  L2942[K2]
+L2977:   bne  r7
+END:    hlt
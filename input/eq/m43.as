@@ -0,0 +1,16 @@
+; line table test
+.define k = 2
+mcr twice
+ inc r1
+ inc r2
+endmcr
+MAIN: mov r1, r2
+ twice
+ prn #k
+mcr empty
+endmcr
+ empty
+ twice
+ hlt
+STR: .string "abc"
+ .data 1, 2
@@ -0,0 +1,4030 @@
+.define K0 = 63
+.define K1 = 49
+.define K2 = 37
+.define K3 = 28
+.extern X0
+.extern X1
+.extern X2
+.extern X3
+.extern X4
+.extern X5
+.extern X6
+.extern X7
+.extern X8
+.extern X9
+.extern X10
+.extern X11
+.extern X12
+.extern X13
+.extern X14
+.extern X15
+mcr m0
+    hlt
+    not  r4
+    clr  r5
+    red  r7
+    cmp  #34, #K1
+    dec  r6
+    mov  #895, r5
+    bne  r6
+    jmp  r0
+    jmp  r0
+    jsr  r7
+    inc  r3
+    clr  r7
+    dec  r0
+    bne  r5
+    jsr  r2
+    prn  r7
+    red  r4
+    cmp  #1695, r3
+    mov  r4, r4
+    prn  r3
+    not  r4
+    not  r1
+    cmp  #448, r0
+    rts
+    rts
+    jsr  r4
+    hlt
+    jsr  r7
+    dec  r0
+    dec  r7
+    prn  r7
+    bne  r3
+    rts
+    mov  r3, r0
+    prn  r4
+    cmp  #-1981, #K2
+    prn  r5
+    mov  #1792, r2
+    add  r2, r0
+    dec  r2
+    jsr  r4
+    hlt
+    red  r4
+    inc  r4
+    inc  r2
+    bne  r1
+    clr  r0
+    add  #-509, r5
+    sub  #1485, r1
+    jsr  r1
+    sub  #-1192, r4
+    inc  r1
+    prn  #216
+    sub  #1599, r5
+    prn  #-1444
+    rts
+    hlt
+    clr  r0
+    not  r4
+    cmp  r7, r2
+    inc  r4
+    add  r5, r2
+    sub  r7, r6
+    jmp  r7
+    sub  r3, r4
+    hlt
+    cmp  r2, #136
+    cmp  r2, r2
+    jsr  r0
+    clr  r7
+    rts
+    mov  r3, r4
+    dec  r7
+    cmp  r5, #K2
+    hlt
+    not  r5
+    sub  r1, r1
+    inc  r0
+    hlt
+    jmp  r7
+    hlt
+    red  r1
+    add  r6, r5
+    jsr  r0
+    rts
+    cmp  #-377, #K3
+    rts
+    not  r7
+    rts
+    not  r1
+    clr  r2
+    sub  r6, r0
+    add  #-914, r2
+    prn  #K2
+    red  r5
+    prn  r3
+    not  r0
+    red  r4
+    sub  r2, r2
+    sub  r7, r6
+    jsr  r6
+    mov  r3, r3
+    cmp  #185, #K3
+    add  #-1796, r2
+    add  #-556, r3
+    dec  r4
+    bne  r6
+    clr  r3
+    prn  r4
+    not  r6
+    sub  #-1613, r5
+    clr  r2
+    red  r4
+    mov  #-1861, r3
+    jmp  r6
+    inc  r4
+    dec  r0
+    clr  r4
+    dec  r6
+    jsr  r5
+    prn  #-439
+    add  r4, r2
+    bne  r7
+    jsr  r0
+    mov  r5, r7
+    add  #1614, r5
+    rts
+    sub  #524, r1
+    add  r5, r3
+    jsr  r6
+    rts
+    clr  r3
+    hlt
+    not  r3
+    cmp  r3, r7
+    hlt
+    mov  r2, r3
+    jsr  r2
+    not  r4
+    jmp  r2
+    jsr  r7
+    cmp  #1405, #K1
+    red  r2
+    inc  r5
+    red  r0
+    clr  r7
+    sub  #1677, r6
+    cmp  r6, r3
+    clr  r0
+    cmp  #253, #-615
+    mov  #-1994, r4
+    jsr  r2
+    prn  #1807
+    rts
+    not  r7
+    clr  r4
+    red  r7
+    cmp  #-232, r5
+    clr  r5
+    rts
+    clr  r7
+    jsr  r6
+    add  r7, r6
+    red  r3
+    not  r3
+    inc  r3
+    clr  r7
+    prn  #K3
+    red  r6
+    mov  #1040, r7
+    red  r1
+    rts
+    bne  r0
+    jmp  r3
+    add  r2, r3
+    prn  #-1814
+    bne  r2
+    add  r5, r7
+    inc  r3
+    not  r4
+    inc  r0
+    jsr  r7
+    not  r6
+    dec  r6
+    hlt
+    mov  r0, r7
+    not  r0
+    mov  r4, r1
+    prn  #K2
+    rts
+    clr  r2
+    hlt
+    not  r4
+    red  r1
+    bne  r2
+    bne  r0
+    red  r7
+    not  r3
+    red  r2
+    dec  r2
+    mov  #-1149, r7
+    dec  r1
+    jmp  r7
+    cmp  #1182, #444
+    add  r5, r4
+    sub  r0, r6
+    red  r3
+    bne  r0
+    sub  r3, r5
+    rts
+    prn  #111
+    rts
+    bne  r5
+    dec  r1
+    sub  r7, r7
+    clr  r3
+    rts
+    jmp  r2
+    bne  r7
+    sub  #-375, r5
+    clr  r1
+    rts
+    rts
+    not  r1
+    mov  #-1590, r7
+    add  #-1422, r7
+    sub  #-181, r1
+    cmp  r0, #K0
+    jsr  r6
+    rts
+    rts
+    red  r3
+    hlt
+    dec  r2
+    red  r7
+    mov  r3, r1
+    clr  r3
+    hlt
+    rts
+    prn  #K2
+    red  r1
+    jmp  r4
+    jsr  r6
+    jsr  r6
+    red  r4
+    cmp  #1499, r2
+    rts
+    add  r7, r0
+    not  r2
+    red  r4
+    add  r1, r5
+    red  r5
+    sub  r4, r3
+    red  r4
+    clr  r0
+    red  r5
+    jsr  r1
+    inc  r5
+    rts
+    not  r1
+    jmp  r5
+    hlt
+    add  #1054, r4
+    sub  #339, r2
+    bne  r3
+    bne  r1
+    rts
+    dec  r4
+    rts
+    not  r7
+    red  r6
+    cmp  #1567, r6
+    not  r6
+    mov  #98, r5
+    add  #-780, r0
+    inc  r0
+    hlt
+    sub  r4, r5
+    dec  r3
+    red  r7
+    jsr  r1
+    prn  #487
+    hlt
+    add  r3, r4
+    jsr  r2
+    cmp  #389, #K3
+    rts
+    rts
+    dec  r0
+    dec  r3
+    sub  #560, r5
+    not  r6
+    red  r2
+    jsr  r2
+    cmp  r0, #-744
+    mov  r5, r7
+    add  #-1505, r3
+    cmp  r5, #K0
+    dec  r0
+    bne  r5
+    rts
+    cmp  #488, r6
+    bne  r6
+    inc  r5
+    inc  r4
+    dec  r6
+    add  #1824, r4
+    not  r2
+    jmp  r1
+    dec  r6
+    jmp  r1
+    mov  r1, r6
+    jmp  r3
+    hlt
+    jmp  r5
+    hlt
+    jmp  r6
+    clr  r4
+    dec  r6
+    hlt
+    inc  r7
+    cmp  #-1573, r1
+    add  #-825, r1
+    red  r0
+    inc  r2
+    hlt
+    red  r3
+    add  r4, r3
+    not  r7
+    mov  r3, r6
+    add  r1, r2
+    prn  #K1
+    cmp  #1049, #K1
+    inc  r4
+    cmp  #1562, r7
+    rts
+    jsr  r5
+    not  r2
+    hlt
+    bne  r3
+    mov  #-239, r6
+    jsr  r0
+    cmp  #-924, r2
+    red  r7
+    cmp  r5, #-1403
+    red  r4
+    cmp  r3, #1210
+    jmp  r2
+    rts
+    add  r3, r4
+    inc  r7
+    mov  #627, r7
+    sub  #-96, r4
+    dec  r6
+    dec  r3
+    inc  r6
+    clr  r4
+    inc  r6
+    jsr  r6
+    dec  r6
+    jmp  r0
+    inc  r6
+    hlt
+    sub  r5, r5
+    jmp  r4
+    clr  r2
+    sub  #-1103, r6
+    jmp  r3
+    inc  r5
+    sub  #-1262, r6
+    add  #841, r5
+    add  r4, r7
+    mov  r0, r3
+    inc  r2
+    red  r6
+    sub  #-1332, r6
+    inc  r3
+    mov  #-1639, r6
+    rts
+    red  r7
+    hlt
+    hlt
+    mov  #-1920, r3
+    jmp  r4
+    add  r2, r7
+    prn  #-933
+    jmp  r4
+    jsr  r5
+    bne  r3
+    jsr  r0
+    mov  r1, r0
+    add  #-905, r6
+    bne  r7
+    rts
+    add  r3, r4
+    hlt
+    jsr  r5
+    inc  r2
+    mov  #-1413, r5
+    red  r5
+    hlt
+    cmp  r3, r5
+    cmp  #-1884, r7
+    hlt
+    mov  #-283, r5
+    cmp  #1531, #K3
+    mov  #1749, r5
+    jsr  r4
+    mov  r2, r6
+    rts
+    red  r4
+    inc  r1
+    dec  r0
+    hlt
+    prn  r2
+    bne  r7
+    hlt
+    red  r6
+    inc  r5
+    red  r6
+    sub  r7, r6
+    cmp  #-1276, r3
+    not  r3
+    inc  r0
+    inc  r7
+    add  r6, r5
+    dec  r2
+    rts
+    sub  r1, r7
+    mov  r0, r4
+    jmp  r1
+    hlt
+    rts
+    add  r6, r7
+    red  r4
+    dec  r7
+    sub  r3, r5
+    jmp  r6
+    clr  r3
+    rts
+    clr  r1
+    dec  r7
+    not  r2
+    mov  r7, r3
+    dec  r2
+    prn  r0
+    not  r2
+    add  r7, r2
+    clr  r3
+    rts
+    jsr  r1
+    prn  r4
+    prn  #K0
+    sub  r2, r7
+    red  r0
+    cmp  #1863, r0
+    rts
+    clr  r6
+    not  r6
+    dec  r3
+    rts
+    hlt
+    mov  r1, r1
+    jmp  r6
+    mov  #-943, r7
+    bne  r1
+    add  r7, r4
+    sub  #-916, r6
+    mov  r4, r2
+    jmp  r4
+    add  #-1957, r5
+    not  r4
+    prn  r6
+    clr  r5
+    bne  r5
+    jsr  r1
+    not  r7
+    not  r4
+    add  r0, r3
+    sub  #906, r4
+    rts
+    dec  r5
+    dec  r0
+    mov  #14, r5
+    red  r0
+    red  r5
+    inc  r2
+    jsr  r5
+    clr  r3
+    clr  r6
+    red  r4
+    bne  r7
+    add  r1, r3
+    sub  #-761, r5
+    rts
+    red  r1
+    prn  #-836
+    add  r2, r1
+    clr  r7
+    rts
+    bne  r2
+    inc  r2
+    dec  r5
+    dec  r3
+    jmp  r4
+    cmp  #-1619, r4
+    jsr  r3
+    clr  r0
+    jsr  r0
+    jmp  r1
+    mov  #78, r4
+    clr  r5
+    jmp  r4
+    jsr  r6
+    prn  #-531
+    sub  r1, r1
+    inc  r5
+    not  r5
+    hlt
+    hlt
+    clr  r1
+    rts
+    bne  r6
+    mov  r3, r7
+    cmp  r4, r0
+    red  r4
+    red  r6
+    not  r7
+    rts
+    dec  r5
+    not  r3
+    dec  r0
+    jmp  r7
+    cmp  r5, #K3
+    dec  r4
+    add  #-1087, r4
+    clr  r2
+    clr  r4
+    sub  r2, r3
+    not  r1
+    add  #-839, r1
+    mov  r3, r0
+    jsr  r4
+    jsr  r4
+    cmp  r0, r3
+    hlt
+    jmp  r4
+    red  r4
+    add  #821, r6
+    rts
+    mov  r7, r0
+    prn  r4
+    prn  #K3
+    jsr  r1
+    inc  r4
+    not  r6
+    jsr  r2
+    inc  r4
+    sub  r0, r2
+    sub  #1065, r3
+    hlt
+    prn  #-136
+    sub  r3, r1
+    rts
+    dec  r7
+    add  #-6, r5
+    not  r6
+    bne  r0
+    jmp  r1
+    dec  r6
+    sub  r6, r6
+    bne  r6
+    prn  r2
+    rts
+    cmp  r7, r0
+    red  r5
+    dec  r6
+    rts
+    inc  r0
+    jmp  r1
+    sub  #1841, r4
+    dec  r0
+    inc  r0
+    cmp  r1, r5
+    sub  #-368, r3
+    add  #779, r4
+    cmp  #1856, #-595
+    hlt
+    prn  r4
+    hlt
+    jmp  r1
+    dec  r0
+    add  r2, r6
+    mov  r1, r3
+    mov  #-968, r1
+    prn  r0
+    clr  r6
+    jsr  r3
+    cmp  r7, r3
+    prn  r4
+    clr  r6
+    cmp  r2, #-308
+    not  r7
+    mov  #-1341, r7
+    add  r1, r4
+    sub  r2, r3
+    red  r3
+    bne  r4
+    dec  r5
+    not  r0
+    sub  r5, r7
+    red  r2
+    clr  r6
+    red  r2
+    add  #-783, r2
+    red  r0
+    jmp  r3
+    dec  r2
+    jmp  r5
+    dec  r7
+    mov  #44, r0
+    hlt
+    mov  r6, r7
+    hlt
+    rts
+    inc  r3
+    add  r5, r2
+    cmp  #1075, r5
+    bne  r7
+    inc  r6
+    clr  r6
+    rts
+    red  r5
+    bne  r2
+    prn  r4
+    jsr  r5
+    rts
+    bne  r3
+    red  r3
+    inc  r7
+    dec  r6
+    cmp  r5, r2
+    bne  r6
+    cmp  #-1906, #1289
+    mov  #-598, r7
+    sub  r6, r2
+    not  r6
+    hlt
+    inc  r4
+    hlt
+    jsr  r2
+    red  r0
+    mov  r4, r4
+    jmp  r4
+    bne  r1
+    mov  #1219, r7
+    rts
+    jmp  r0
+    rts
+    jmp  r1
+    cmp  r7, #K1
+    cmp  r1, r5
+    add  r6, r2
+    jsr  r4
+    mov  r7, r3
+    cmp  r1, r5
+    clr  r2
+    jmp  r3
+    dec  r7
+    clr  r7
+    sub  r4, r5
+    prn  r7
+    rts
+    cmp  #-1026, #K0
+    mov  r1, r3
+    not  r4
+    jmp  r1
+    clr  r1
+    not  r7
+    dec  r3
+    inc  r5
+    prn  #1781
+    cmp  r2, r7
+    jmp  r4
+    clr  r7
+    add  #-88, r1
+    clr  r1
+    mov  #-1988, r3
+    sub  r5, r2
+    sub  r3, r0
+    cmp  r2, #42
+    prn  r3
+    hlt
+    hlt
+    jsr  r3
+    prn  r0
+    inc  r7
+    red  r2
+    mov  #977, r2
+    mov  r1, r0
+    mov  #1718, r7
+    rts
+    prn  #K0
+    clr  r5
+    cmp  r1, #K3
+    not  r5
+    add  #222, r4
+    mov  r6, r5
+    cmp  r3, #950
+    clr  r4
+    clr  r4
+    add  #-1367, r6
+    cmp  r7, #-405
+    prn  r5
+    red  r7
+    hlt
+    dec  r0
+    bne  r5
+    jsr  r2
+    prn  r7
+    red  r4
+    cmp  #-945, r3
+    mov  r4, r1
+    prn  r3
+    not  r6
+    rts
+    prn  #1481
+    cmp  #-1904, r0
+    rts
+    hlt
+    rts
+    jsr  r6
+    rts
+    hlt
+    prn  r5
+    dec  r0
+    clr  r0
+    cmp  r7, #1964
+    bne  r3
+    rts
+    mov  r3, r0
+    prn  r4
+    cmp  #-1517, #K2
+    prn  r5
+    mov  #-1134, r0
+    cmp  #1847, #1513
+    jmp  r7
+    add  #1525, r7
+    red  r5
+    not  r3
+    add  r1, r4
+    prn  r1
+    sub  r1, r7
+    hlt
+    inc  r6
+    jmp  r2
+    jsr  r6
+    rts
+    jsr  r7
+    dec  r5
+    jsr  r0
+    jsr  r4
+    prn  r0
+    sub  #429, r2
+    clr  r4
+    dec  r6
+    inc  r3
+    jsr  r5
+    jmp  r4
+    cmp  r7, r2
+    inc  r4
+    add  r5, r7
+    sub  r7, r6
+    jmp  r7
+    sub  #-1748, r0
+    red  r3
+    add  #-43, r2
+    dec  r1
+    cmp  r5, #K2
+    hlt
+    not  r3
+    dec  r7
+    mov  #7, r0
+    prn  r3
+    jmp  r5
+    clr  r6
+    jsr  r5
+    jmp  r6
+    jsr  r0
+    rts
+    cmp  #759, #K3
+    rts
+    not  r4
+    rts
+    bne  r5
+    add  r0, r4
+    add  r7, r3
+    mov  r2, r5
+    not  r2
+    bne  r7
+    jsr  r3
+    dec  r4
+    sub  r0, r1
+    prn  r6
+    hlt
+    hlt
+    clr  r2
+    bne  r1
+    cmp  #489, #K3
+    add  r7, r2
+    red  r7
+    add  #-902, r1
+    clr  r3
+    not  r2
+    jsr  r6
+    jsr  r6
+    sub  r2, r6
+    jsr  r5
+    clr  r2
+    prn  r1
+    prn  r4
+    add  r2, r1
+    mov  #-277, r3
+    jmp  r6
+    inc  r6
+    mov  #1733, r0
+    hlt
+    mov  #-1768, r0
+    dec  r5
+    prn  #-1159
+    add  #799, r5
+    bne  r7
+    prn  r5
+    jsr  r7
+    sub  #1182, r5
+    rts
+    sub  #994, r0
+    cmp  r3, r2
+    jsr  r1
+    red  r1
+    hlt
+    jsr  r2
+    add  #-197, r7
+    hlt
+    not  r6
+    sub  r0, r2
+    dec  r3
+    sub  #-1148, r5
+    dec  r3
+    add  r5, r2
+    mov  #1197, r4
+    red  r4
+    mov  #-1714, r3
+    add  r3, r5
+    sub  r0, r5
+    cmp  #-659, #1897
+    mov  r6, r6
+    sub  #-124, r4
+    cmp  #-75, #-335
+    hlt
+    rts
+    not  r3
+    clr  r3
+    jmp  r1
+    hlt
+    clr  r7
+    inc  r0
+    rts
+    clr  r5
+    cmp  r3, r7
+    jmp  r7
+    dec  r4
+    sub  r5, r4
+    rts
+    jsr  r5
+    prn  #K3
+    red  r2
+    bne  r6
+    mov  r1, r1
+    jsr  r4
+    mov  #906, r3
+    cmp  #632, #K0
+    bne  r5
+    red  r5
+    jmp  r2
+    bne  r7
+    add  r5, r2
+    dec  r3
+    clr  r2
+    clr  r4
+    jmp  r3
+    sub  #-1485, r7
+    red  r6
+    not  r0
+    jsr  r7
+    not  r6
+    dec  r7
+    mov  #914, r0
+    bne  r5
+    jsr  r7
+    not  r2
+    add  #1805, r5
+    add  r4, r0
+    red  r2
+    bne  r0
+    red  r3
+    sub  #573, r4
+    mov  #1449, r2
+    hlt
+    bne  r2
+    mov  #-1266, r0
+    add  #-543, r7
+    cmp  #-403, r1
+    prn  #K2
+    bne  r5
+    sub  r0, r6
+    red  r2
+    jsr  r5
+    bne  r5
+    red  r6
+    mov  #-897, r2
+    jsr  r1
+    sub  r7, r1
+    clr  r0
+    dec  r6
+    jmp  r2
+    bne  r7
+    sub  #-775, r1
+    clr  r0
+    inc  r7
+    not  r4
+    jmp  r0
+    red  r4
+    inc  r2
+    add  #-1790, r7
+    sub  #859, r7
+    cmp  r0, #K0
+    jsr  r6
+    rts
+    rts
+    red  r3
+    hlt
+    dec  r3
+    cmp  r3, r0
+    jmp  r3
+    clr  r0
+    dec  r3
+    jsr  r1
+    not  r4
+    jsr  r6
+    jsr  r6
+    red  r4
+    cmp  r2, #1933
+    prn  r6
+    add  r2, r4
+    red  r0
+    bne  r7
+    not  r7
+    clr  r2
+    sub  r2, r5
+    hlt
+    prn  #K1
+    prn  #-776
+    red  r1
+    cmp  #1809, r7
+    add  r2, r1
+    jmp  r4
+    bne  r5
+    prn  r2
+    bne  r4
+    sub  r2, r0
+    mov  #-1384, r6
+    rts
+    hlt
+    not  r2
+    inc  r3
+    prn  r2
+    rts
+    cmp  #1135, r6
+    not  r4
+    bne  r3
+    jmp  r7
+    add  #-335, r0
+    jsr  r0
+    mov  r0, r4
+    dec  r6
+    hlt
+    add  r5, r5
+    add  #1131, r2
+    add  r2, r7
+    sub  r5, r6
+    jsr  r2
+    not  r5
+    add  r6, r4
+    red  r5
+    bne  r0
+    jmp  r2
+    jmp  r2
+    hlt
+endmcr
+mcr m1
+    jsr  r6
+    jmp  r1
+    cmp  r5, #K0
+    dec  r0
+    bne  r5
+    rts
+    cmp  #1688, r6
+    bne  r6
+    inc  r7
+    prn  r5
+    inc  r2
+    bne  r3
+    prn  #K0
+    not  r1
+    not  r1
+    dec  r7
+    clr  r1
+    mov  r0, r6
+    rts
+    inc  r7
+    jmp  r6
+    clr  r6
+    jsr  r6
+    hlt
+    inc  r5
+    inc  r6
+    rts
+    dec  r2
+    bne  r4
+    inc  r0
+    mov  r7, r3
+    red  r7
+    red  r5
+    bne  r7
+    prn  #K3
+    hlt
+    add  #-1628, r3
+    prn  #K1
+    prn  r5
+    hlt
+    jmp  r4
+    bne  r5
+    jmp  r7
+    hlt
+    add  #1411, r5
+    clr  r2
+    hlt
+    bne  r3
+    mov  #-96, r0
+    jsr  r5
+    add  r1, r3
+    rts
+    mov  r1, r5
+    dec  r1
+    bne  r3
+    sub  r2, r0
+    not  r1
+    rts
+    jmp  r3
+    sub  r4, r5
+    add  r7, r7
+    sub  #-669, r7
+    sub  #-1114, r3
+    inc  r0
+    dec  r3
+    clr  r2
+    clr  r4
+    jmp  r6
+    jmp  r0
+    inc  r6
+    hlt
+    sub  #-979, r0
+    clr  r2
+    sub  #-1823, r1
+    jmp  r3
+    inc  r4
+    sub  #985, r0
+    add  r3, r1
+    mov  r3, r4
+    prn  #K2
+    not  r1
+    clr  r0
+    dec  r4
+    jmp  r0
+    red  r0
+    inc  r6
+    inc  r7
+    hlt
+    mov  #-1182, r7
+    clr  r6
+    not  r6
+    prn  #-221
+    not  r4
+    jmp  r4
+    jsr  r5
+    bne  r3
+    jsr  r0
+    mov  #1928, r6
+    bne  r1
+    add  #1895, r6
+    bne  r7
+    rts
+    add  r3, r4
+    hlt
+    add  r5, r4
+    inc  r0
+    dec  r3
+    bne  r1
+    not  r1
+    red  r6
+    cmp  r7, #K3
+    mov  #-267, r1
+    cmp  #1515, #K3
+    mov  #581, r5
+    jsr  r4
+    mov  r6, r6
+    not  r2
+    rts
+    red  r4
+    inc  r0
+    prn  #-724
+    jmp  r2
+    bne  r7
+    hlt
+    red  r2
+    rts
+    inc  r7
+    jmp  r5
+    mov  r2, r2
+    jmp  r2
+    inc  r5
+    mov  r6, r1
+    dec  r6
+    sub  r1, r6
+    mov  r4, r7
+    dec  r0
+    cmp  r4, #K0
+    inc  r1
+    clr  r3
+    sub  r6, r5
+    clr  r7
+    add  #-982, r4
+    red  r0
+    hlt
+    bne  r0
+    not  r4
+    bne  r7
+    clr  r3
+    rts
+    jsr  r1
+    prn  r4
+    prn  #K0
+    sub  r2, r3
+    sub  #-1535, r2
+    clr  r0
+    not  r6
+    inc  r6
+    sub  r1, r2
+    rts
+    clr  r7
+    rts
+    dec  r7
+    mov  #226, r7
+    inc  r1
+    bne  r1
+    add  r7, r2
+    sub  #636, r6
+    mov  #-309, r2
+    not  r2
+    clr  r6
+    clr  r1
+    rts
+    cmp  #650, #K3
+    not  r5
+    bne  r2
+    dec  r2
+    sub  r6, r6
+    mov  r5, r0
+    not  r3
+    cmp  r4, #1266
+    add  r1, r3
+    red  r6
+    dec  r1
+    jmp  r7
+    add  #-137, r7
+    rts
+    red  r3
+    inc  r7
+    add  r0, r1
+    mov  r2, r3
+    clr  r0
+    cmp  #1996, #K0
+    cmp  r7, r2
+    rts
+    bne  r2
+    inc  r5
+    clr  r0
+    clr  r1
+    clr  r4
+    dec  r7
+    red  r1
+    mov  r3, r1
+    red  r5
+    rts
+    hlt
+    dec  r7
+    cmp  r6, #-520
+    red  r7
+    prn  #K1
+    mov  #957, r1
+    jmp  r4
+    jsr  r6
+    prn  #-739
+    sub  r1, r3
+    inc  r4
+    mov  r7, r5
+    clr  r2
+    rts
+    hlt
+    rts
+    mov  r7, r2
+    sub  r3, r3
+    hlt
+    cmp  #-337, #-1987
+    hlt
+    rts
+    dec  r4
+    not  r4
+    add  #1480, r4
+    hlt
+    sub  r1, r4
+    clr  r1
+    prn  #-1173
+    clr  r1
+    clr  r3
+    bne  r7
+    bne  r2
+    add  #1225, r6
+    mov  r3, r0
+    jsr  r4
+    jsr  r4
+    cmp  r0, r3
+    hlt
+    jmp  r4
+    red  r2
+    jsr  r1
+    cmp  #1479, #862
+    sub  #632, r0
+    mov  r0, r5
+    mov  #1692, r7
+    bne  r5
+    clr  r4
+    not  r5
+    mov  r4, r2
+    inc  r4
+    sub  r0, r2
+    sub  r3, r4
+    prn  r4
+    prn  #784
+    rts
+    cmp  #322, r3
+    mov  #-1867, r7
+    bne  r7
+    mov  #439, r0
+    mov  r1, r1
+    not  r2
+    not  r6
+    prn  r2
+    rts
+    cmp  r7, r0
+    red  r5
+    sub  r5, r6
+    jmp  r0
+    jmp  r1
+    sub  #36, r6
+    cmp  #-1641, #1527
+    clr  r3
+    jsr  r1
+    sub  #-1536, r3
+    add  r6, r4
+    cmp  #425, r3
+    jsr  r1
+    clr  r1
+    jsr  r4
+    inc  r6
+    prn  #1952
+    prn  r0
+    add  #-1030, r7
+    red  r2
+    inc  r0
+    sub  #1996, r4
+    red  r5
+    red  r3
+    red  r0
+    sub  r6, r5
+    clr  r1
+    not  r2
+    red  r2
+    hlt
+    mov  #1299, r7
+    add  #730, r5
+    jsr  r2
+    rts
+    sub  #-1405, r3
+    jsr  r3
+    bne  r4
+    dec  r6
+    prn  r0
+    sub  r5, r7
+    not  r2
+    dec  r2
+    rts
+    jsr  r6
+    mov  #-702, r6
+    hlt
+    jsr  r3
+    not  r1
+    jmp  r6
+    dec  r4
+    mov  r3, r6
+    cmp  #-40, #935
+    jmp  r0
+    bne  r0
+    dec  r0
+    inc  r6
+    inc  r1
+    red  r3
+    bne  r5
+    cmp  #1475, r5
+    bne  r7
+    inc  r6
+    clr  r2
+    rts
+    rts
+    red  r2
+    jmp  r4
+    jsr  r5
+    rts
+    bne  r3
+    red  r2
+    bne  r6
+    sub  #87, r0
+    mov  r5, r1
+    bne  r6
+    cmp  #-1186, #-71
+    mov  r0, r2
+    not  r5
+    hlt
+    add  #1072, r4
+    prn  #-749
+    not  r2
+    inc  r0
+    prn  r5
+    sub  r7, r4
+    cmp  r1, r5
+    add  #1968, r7
+    cmp  #-145, #-294
+    sub  r3, r7
+    inc  r3
+    rts
+    inc  r4
+    jsr  r4
+    dec  r7
+    red  r2
+    jmp  r1
+    not  r4
+    jmp  r1
+    clr  r0
+    cmp  r0, #1903
+    jsr  r7
+    dec  r1
+    jmp  r7
+    cmp  #-815, #K2
+    clr  r3
+    hlt
+    inc  r5
+    prn  r5
+    prn  #1930
+    inc  r1
+    prn  #-1266
+    mov  #-423, r2
+    sub  r1, r3
+    mov  r2, r0
+    prn  r3
+    hlt
+    hlt
+    jsr  r3
+    prn  r0
+    inc  r1
+    bne  r3
+    bne  r0
+    dec  r3
+    add  r1, r0
+    mov  r4, r3
+    not  r7
+    cmp  #-478, #K1
+    dec  r4
+    rts
+    mov  r6, r1
+    cmp  r3, #-570
+    jmp  r0
+    jmp  r0
+    jsr  r7
+    inc  r3
+    dec  r0
+    rts
+    jmp  r5
+    jsr  r2
+    prn  r7
+    red  r0
+    not  r4
+    jmp  r4
+    prn  r3
+    not  r5
+    sub  #-578, r0
+    hlt
+    dec  r6
+    jsr  r4
+    hlt
+    jsr  r7
+    dec  r3
+    dec  r7
+    bne  r3
+    rts
+    mov  r4, r4
+    cmp  #-1469, #K2
+    prn  r5
+    mov  #1, r0
+    add  #991, r2
+    add  r4, r6
+    hlt
+    red  r1
+    not  r1
+    rts
+    not  r1
+    hlt
+    inc  r1
+    clr  r4
+    clr  r5
+    not  r6
+    prn  r1
+    prn  r1
+    sub  r1, r7
+    hlt
+    inc  r6
+    jmp  r2
+    jsr  r6
+    rts
+    jsr  r7
+    dec  r5
+    cmp  #-1476, #-1463
+    red  r3
+    dec  r5
+    add  r4, r0
+    rts
+    clr  r4
+    cmp  r7, r2
+    inc  r2
+    rts
+    hlt
+    bne  r5
+    sub  r5, r3
+    rts
+    add  r3, r5
+    add  #-490, r4
+    hlt
+    red  r1
+    jsr  r0
+    hlt
+    dec  r2
+    hlt
+    bne  r0
+    clr  r2
+    add  r0, r6
+    cmp  r6, r1
+    bne  r6
+    inc  r7
+    jmp  r7
+    jsr  r3
+    red  r5
+    mov  #-217, r6
+    rts
+    not  r6
+    not  r5
+    add  r7, r3
+    mov  r2, r2
+    not  r4
+    bne  r3
+    inc  r4
+    hlt
+    sub  #901, r4
+    cmp  r4, #K2
+    not  r0
+    red  r3
+    bne  r2
+    dec  r0
+    prn  r6
+    hlt
+    hlt
+    rts
+    prn  r6
+    mov  r0, r3
+    add  r1, r1
+    cmp  #-1319, #K3
+    add  #-1700, r4
+    add  r1, r7
+    bne  r6
+    clr  r4
+    sub  r1, r5
+    hlt
+    prn  #K1
+    jmp  r2
+    hlt
+    add  r3, r4
+    sub  r6, r3
+    inc  r0
+    prn  #K2
+    dec  r5
+    prn  #585
+    add  r2, r4
+    clr  r7
+    jsr  r0
+    mov  r1, r5
+    sub  r2, r6
+    jmp  r0
+    prn  r2
+    sub  r1, r5
+    red  r1
+    hlt
+    jsr  r2
+    add  #-1301, r7
+    hlt
+    not  r3
+    hlt
+    sub  r0, r6
+    dec  r3
+    sub  #756, r5
+    dec  r4
+    bne  r0
+    not  r3
+    add  r6, r3
+    add  r5, r2
+    mov  #-1452, r0
+    jsr  r3
+    cmp  r4, r4
+    mov  #1790, r5
+    add  r3, r5
+    sub  r0, r5
+    cmp  #285, #25
+    mov  r6, r6
+    sub  #481, r0
+    bne  r1
+    clr  r4
+    red  r7
+    cmp  #1688, r5
+    clr  r6
+    clr  r1
+    inc  r1
+    hlt
+    dec  r7
+    jmp  r5
+    jsr  r5
+    prn  #K3
+    red  r4
+    cmp  #-272, r1
+    red  r6
+    bne  r0
+    jmp  r3
+    add  r7, r2
+    add  r1, r1
+    jsr  r0
+    jmp  r3
+    clr  r5
+    jsr  r7
+    red  r0
+    inc  r4
+    bne  r4
+    mov  #-307, r0
+    hlt
+    inc  r4
+    rts
+    dec  r6
+    hlt
+    mov  #-908, r7
+    add  #331, r0
+    clr  r7
+    not  r4
+    bne  r0
+    jsr  r4
+    hlt
+    add  r2, r4
+    jmp  r2
+    bne  r0
+    red  r1
+    inc  r0
+    red  r6
+    jmp  r3
+    dec  r0
+    jsr  r0
+    cmp  #-1027, r1
+    prn  #K2
+    bne  r5
+    add  r7, r0
+    sub  r3, r5
+    rts
+    not  r7
+    jsr  r1
+    sub  r7, r7
+    clr  r3
+    mov  r6, r4
+    jmp  r2
+    bne  r7
+    sub  #1544, r1
+    inc  r7
+    cmp  #-741, #-1423
+    dec  r2
+    rts
+    inc  r2
+    sub  r1, r2
+    dec  r1
+    clr  r4
+    sub  r3, r3
+    hlt
+    dec  r5
+    add  r3, r1
+    clr  r7
+    rts
+    prn  #K2
+    red  r3
+    jsr  r1
+    not  r7
+    add  #1787, r2
+    rts
+    add  r7, r2
+    not  r5
+    not  r5
+    red  r4
+    jsr  r5
+    sub  r2, r6
+    sub  r2, r3
+    hlt
+    prn  #K1
+    prn  #1672
+    red  r5
+    jmp  r7
+    inc  r4
+    cmp  r4, r2
+    bne  r5
+    prn  r2
+    bne  r4
+    sub  r2, r0
+    mov  #-1330, r7
+    not  r5
+    hlt
+    red  r1
+    sub  #1112, r7
+    dec  r2
+    cmp  #-1278, #K1
+    add  #-48, r0
+    prn  #1480
+    dec  r6
+    inc  r7
+    jmp  r7
+    jsr  r1
+    bne  r2
+    prn  #1799
+    hlt
+    add  r3, r4
+    jsr  r2
+    cmp  #-1563, #K3
+    rts
+    rts
+    dec  r5
+    bne  r6
+    red  r1
+    dec  r7
+    mov  r2, r1
+    jmp  r2
+    hlt
+    jsr  r6
+    jmp  r1
+    cmp  r5, #K0
+    dec  r6
+    dec  r5
+    clr  r6
+    red  r0
+    bne  r6
+    inc  r4
+    inc  r2
+    sub  #1192, r4
+    not  r4
+    cmp  #480, r4
+    not  r2
+    jmp  r1
+    dec  r5
+    rts
+    jmp  r1
+    mov  r0, r1
+    inc  r2
+    hlt
+    rts
+    clr  r0
+    rts
+    jsr  r6
+    hlt
+    inc  r3
+    clr  r1
+    jsr  r1
+    jmp  r2
+    bne  r4
+    inc  r0
+    mov  r3, r5
+    hlt
+    hlt
+    red  r3
+    prn  #1191
+    rts
+    jmp  r3
+    add  r1, r2
+    prn  #K1
+    cmp  #-1095, #K1
+    inc  r3
+    dec  r1
+    inc  r3
+    hlt
+    jmp  r4
+    bne  r5
+    jmp  r7
+    hlt
+    add  r4, r2
+    jsr  r5
+    not  r7
+    add  r3, r2
+    mov  #-400, r2
+    jsr  r5
+    add  r1, r1
+    rts
+    mov  r1, r5
+    dec  r1
+    sub  r2, r2
+    not  r1
+    rts
+    jmp  r3
+    sub  r4, r5
+    add  r7, r0
+    hlt
+    sub  #1683, r7
+    sub  #1280, r4
+    dec  r1
+    dec  r4
+    sub  #-1091, r6
+    bne  r3
+    clr  r2
+    clr  r7
+    jmp  r2
+    jmp  r6
+    jmp  r0
+    inc  r6
+    not  r3
+    hlt
+    cmp  #-475, #-1511
+    sub  r0, r5
+    hlt
+    inc  r5
+    mov  #763, r2
+    inc  r4
+    not  r0
+    inc  r2
+    red  r4
+    mov  #-1287, r0
+    rts
+    red  r3
+    rts
+    not  r7
+    hlt
+    mov  #681, r0
+    prn  r4
+    add  r6, r4
+    dec  r4
+    rts
+    dec  r4
+    hlt
+    not  r4
+    bne  r4
+    jsr  r5
+    bne  r3
+    jsr  r0
+    mov  #1464, r2
+    bne  r1
+    add  #-1449, r6
+    bne  r7
+    rts
+    add  r1, r4
+    bne  r4
+    red  r3
+    jmp  r5
+    hlt
+    cmp  r3, r5
+    cmp  #-1308, r7
+    sub  #1061, r0
+    cmp  #-37, #K3
+    mov  #1623, r0
+    not  r4
+    jsr  r0
+    prn  #1244
+    jmp  r2
+    bne  r7
+    hlt
+    red  r2
+    bne  r7
+    cmp  #-1180, r3
+    not  r7
+    mov  r2, r2
+    jmp  r2
+    inc  r5
+    dec  r7
+    inc  r7
+    jmp  r7
+    clr  r4
+    cmp  r4, #K0
+    inc  r1
+    bne  r6
+    clr  r3
+    rts
+    clr  r1
+    dec  r6
+    add  #-1578, r0
+    sub  #-733, r7
+    rts
+    jsr  r1
+    prn  r4
+    prn  #K0
+    sub  r2, r2
+    red  r5
+    hlt
+    dec  r7
+    jmp  r5
+    mov  r1, r5
+    jmp  r6
+    mov  #-559, r7
+    bne  r1
+    add  r7, r2
+    sub  r4, r2
+    jmp  r4
+    add  #923, r5
+    not  r3
+    rts
+    clr  r6
+    not  r6
+    inc  r4
+    cmp  r0, r3
+    sub  r6, r6
+    rts
+    clr  r6
+    red  r5
+    jmp  r4
+    inc  r7
+    not  r5
+    inc  r5
+    dec  r7
+    red  r2
+    sub  #-58, r3
+    hlt
+    cmp  r5, r5
+    clr  r4
+    inc  r7
+    prn  #1449
+    jsr  r7
+    red  r7
+    rts
+    sub  r0, r1
+    mov  #-20, r3
+    mov  r2, r4
+    clr  r7
+    rts
+    bne  r2
+    inc  r0
+    dec  r5
+    jmp  r0
+    clr  r1
+    clr  r4
+    dec  r1
+    mov  #-827, r2
+    jmp  r7
+    sub  r0, r5
+    jmp  r1
+    mov  r6, r0
+    red  r3
+    hlt
+    prn  #K1
+    mov  #237, r2
+    jmp  r4
+    jsr  r6
+    prn  #877
+    sub  r1, r4
+    rts
+    hlt
+    jmp  r5
+    not  r4
+    clr  r5
+    not  r2
+    rts
+    hlt
+    rts
+    mov  r7, r1
+    sub  r0, r1
+    rts
+    sub  r5, r4
+    rts
+    not  r6
+    dec  r4
+    add  #888, r2
+    hlt
+    sub  #-1991, r2
+    dec  r5
+    dec  r6
+    add  #-768, r2
+    add  r2, r5
+    clr  r4
+    sub  r2, r3
+    not  r1
+    add  #569, r2
+    mov  r5, r7
+    rts
+    add  r3, r4
+    red  r7
+    jmp  r4
+    red  r2
+    jsr  r1
+    cmp  #1143, #-1202
+    sub  #-512, r4
+    clr  r3
+    not  r7
+    hlt
+    dec  r2
+    add  r5, r0
+    clr  r4
+    add  #-779, r5
+    bne  r4
+    inc  r0
+    sub  r0, r3
+    sub  r4, r4
+    prn  #-1408
+    rts
+    cmp  #146, r3
+    mov  #-1019, r7
+    bne  r7
+    mov  #263, r0
+    mov  r1, r1
+    not  r4
+    bne  r6
+    prn  r2
+    rts
+    cmp  r7, r0
+    red  r5
+    dec  r0
+    red  r3
+    red  r5
+    jmp  r0
+    jmp  r1
+    sub  r6, r7
+    add  #145, r5
+    cmp  r1, r5
+    sub  r0, r3
+    mov  r3, r3
+    prn  #-1939
+    mov  #991, r7
+    jmp  r1
+    dec  r4
+    hlt
+    mov  #-54, r7
+    red  r7
+    cmp  #-1608, #-855
+    prn  r0
+    clr  r6
+    jmp  r0
+    jsr  r3
+    cmp  r7, r3
+    not  r2
+    hlt
+    mov  r4, r3
+    sub  #-1014, r3
+    red  r5
+    sub  #708, r4
+    jsr  r0
+    sub  r7, r5
+    clr  r1
+    jsr  r2
+    cmp  #-1450, r4
+    red  r2
+    jsr  r2
+    dec  r2
+    rts
+    jsr  r6
+    mov  r5, r4
+    inc  r6
+    jmp  r3
+    dec  r3
+    inc  r5
+    dec  r0
+endmcr
+mcr m2
+    dec  r7
+    mov  r6, r6
+    prn  r4
+    mov  r5, r3
+    cmp  #243, r5
+    bne  r7
+    inc  r3
+    prn  r3
+    clr  r2
+    jmp  r4
+    jsr  r5
+    rts
+    bne  r3
+    red  r5
+    bne  r6
+    sub  #350, r2
+    jmp  r0
+    inc  r7
+    dec  r1
+    cmp  #142, #-727
+    mov  r0, r2
+    mov  r7, r6
+    inc  r5
+    hlt
+    add  #-1488, r2
+    mov  #-551, r6
+    sub  #-1942, r1
+    inc  r0
+    prn  r5
+    cmp  r7, #K1
+    cmp  r1, r5
+    add  r6, r2
+    jsr  r4
+    mov  r1, r7
+    red  r5
+    sub  #1523, r1
+    bne  r4
+    hlt
+    sub  r5, r0
+    jmp  r3
+    inc  r3
+    rts
+    rts
+    cmp  #-1538, #K0
+    mov  r6, r0
+    cmp  r1, r3
+    not  r0
+    cmp  r0, #735
+    jsr  r7
+    dec  r7
+    cmp  #1953, #K2
+    clr  r7
+    bne  r2
+    red  r4
+    red  r1
+    not  r2
+    inc  r1
+    prn  #1662
+    mov  r2, r1
+    dec  r3
+    jmp  r1
+    cmp  #-1819, r3
+    bne  r2
+    prn  r3
+    hlt
+    hlt
+    jsr  r3
+    prn  r0
+    inc  r0
+    red  r2
+    not  r0
+    mov  #804, r0
+    red  r2
+    mov  #1668, r3
+    hlt
+    inc  r6
+    clr  r0
+    rts
+    prn  #K0
+    not  r6
+    cmp  r3, #1462
+    clr  r4
+    clr  r5
+    prn  r7
+    jmp  r0
+    jmp  r0
+    jsr  r7
+    inc  r0
+    inc  r0
+    rts
+    jmp  r5
+    jsr  r2
+    prn  r7
+    red  r1
+    sub  #1529, r0
+    bne  r4
+    prn  r3
+    not  r1
+    jsr  r0
+    mov  #-1007, r6
+    rts
+    jsr  r4
+    hlt
+    jsr  r7
+    dec  r0
+    dec  r7
+    bne  r3
+    rts
+    mov  #1222, r6
+    mov  #1409, r7
+    prn  #-1924
+    clr  r5
+    add  #-863, r3
+    mov  #-464, r6
+    add  r2, r2
+    cmp  #1943, #-1207
+    jmp  r7
+    add  r4, r3
+    clr  r0
+    add  r2, r3
+    rts
+    prn  r1
+    prn  r1
+    sub  r1, r7
+    hlt
+    inc  r6
+    jmp  r2
+    jsr  r6
+    rts
+    jsr  r7
+    dec  r1
+    clr  r0
+    jsr  r4
+    prn  r0
+    sub  #-563, r3
+    clr  r2
+    red  r4
+    not  r2
+    add  #1058, r3
+    rts
+    hlt
+    bne  r5
+    sub  r7, r1
+    jsr  r7
+    jmp  r7
+    sub  #172, r0
+    cmp  r2, r2
+    jsr  r0
+    clr  r6
+    inc  r0
+    hlt
+    add  #-1066, r3
+    inc  r2
+    cmp  r4, r5
+    rts
+    jsr  r0
+    cmp  r6, r1
+    bne  r6
+    inc  r1
+    cmp  r0, r6
+    not  r0
+    bne  r4
+    hlt
+    red  r3
+    cmp  r6, #-794
+    jsr  r0
+    rts
+    cmp  #695, #K3
+    rts
+    not  r6
+    not  r2
+    prn  #K3
+    dec  r1
+    sub  r2, r5
+    not  r0
+    prn  #K0
+    add  r7, r4
+    jsr  r3
+    not  r4
+    prn  r7
+    bne  r2
+    sub  #1676, r7
+    hlt
+    rts
+    hlt
+    hlt
+    jsr  r6
+    mov  r3, r3
+    inc  r7
+    dec  r4
+    prn  r7
+    red  r6
+    rts
+    not  r0
+    inc  r6
+    cmp  #-813, #K1
+    prn  r4
+    not  r5
+    sub  r2, r6
+    jsr  r5
+    clr  r4
+    add  r4, r4
+    add  r2, r5
+    mov  #491, r3
+    jmp  r6
+    inc  r0
+    prn  #K2
+    dec  r1
+    add  #-161, r1
+    bne  r7
+    prn  r5
+    jsr  r7
+    sub  r2, r0
+    jmp  r0
+    prn  r2
+    sub  #-289, r5
+    sub  r7, r3
+    mov  #1124, r2
+    dec  r4
+    bne  r0
+    not  r3
+    inc  r2
+    hlt
+    jsr  r5
+    jsr  r2
+    mov  r1, r5
+    bne  r4
+    jmp  r3
+    not  r5
+    clr  r3
+    jsr  r0
+    rts
+    add  r3, r5
+    sub  #919, r0
+    jmp  r0
+    red  r6
+    jsr  r2
+    prn  #1087
+    rts
+    not  r7
+    clr  r1
+    hlt
+    clr  r6
+    clr  r5
+    prn  r6
+    dec  r5
+    cmp  r3, r7
+    jmp  r7
+    dec  r3
+    not  r3
+    inc  r4
+    sub  #1495, r6
+    inc  r7
+    rts
+    jsr  r5
+    prn  #K3
+    red  r2
+    dec  r1
+    inc  r6
+    jmp  r3
+    jsr  r6
+    bne  r0
+    jmp  r3
+    add  r2, r4
+    bne  r7
+    add  #1873, r6
+    dec  r0
+    rts
+    inc  r5
+    jsr  r7
+    red  r0
+    inc  r4
+    sub  #-339, r1
+    prn  #-1226
+    hlt
+    mov  #-1605, r0
+    clr  r1
+    hlt
+    not  r2
+    add  r4, r0
+    hlt
+    add  #795, r3
+    bne  r2
+    jmp  r0
+    red  r3
+    sub  r4, r1
+    not  r3
+    dec  r1
+    sub  #1674, r6
+    dec  r4
+    inc  r0
+    rts
+    add  r1, r1
+    prn  #K2
+    add  #60, r6
+    rts
+    red  r6
+    sub  #-1685, r2
+    rts
+    not  r3
+    add  #1987, r2
+    clr  r3
+    clr  r3
+    rts
+    not  r1
+    mov  #-1409, r6
+    jsr  r1
+    sub  r5, r3
+    red  r2
+    clr  r4
+    sub  r3, r1
+    not  r5
+    cmp  #1624, #357
+    inc  r6
+    rts
+    not  r1
+    mov  r2, r2
+    dec  r1
+    clr  r5
+    sub  r3, r6
+    sub  r6, r2
+    red  r7
+    sub  r3, r2
+    clr  r6
+    prn  #K2
+    red  r1
+    jmp  r4
+    jsr  r6
+    jsr  r6
+    red  r4
+    cmp  r2, #1133
+    prn  r6
+    add  r7, r2
+    not  r5
+    red  r3
+    mov  r5, r5
+    sub  r4, r3
+    red  r5
+    red  r7
+    prn  #K1
+    prn  #-840
+    red  r5
+    jsr  r1
+    inc  r6
+    not  r1
+    sub  r2, r4
+    bne  r4
+    sub  r2, r0
+    mov  #-872, r1
+    rts
+    hlt
+    not  r2
+    inc  r4
+    inc  r6
+    cmp  #1839, r6
+    not  r2
+    dec  r6
+    inc  r1
+    dec  r7
+    add  #-1166, r0
+    add  #1708, r0
+    not  r0
+    dec  r7
+    inc  r5
+    hlt
+    jsr  r1
+    bne  r2
+    prn  #-1673
+    hlt
+    add  r5, r5
+    jsr  r2
+    not  r3
+    not  r6
+    rts
+    dec  r6
+    add  r3, r0
+    inc  r2
+    mov  r6, r4
+    red  r0
+    hlt
+    add  r6, r5
+    jmp  r1
+    cmp  r5, #K0
+    dec  r6
+    dec  r6
+    cmp  #1080, r6
+    bne  r6
+    inc  r4
+    inc  r7
+    bne  r2
+    bne  r3
+    prn  #K0
+    not  r4
+    add  #1019, r7
+    inc  r1
+    bne  r6
+    clr  r5
+    sub  r1, r7
+    sub  r1, r7
+    jmp  r2
+    bne  r4
+    inc  r2
+    hlt
+    red  r7
+    red  r5
+    bne  r2
+    clr  r6
+    add  #1172, r0
+    clr  r4
+    mov  r3, r6
+    add  r1, r6
+    prn  #K1
+    cmp  #1673, #K1
+    inc  r5
+    jmp  r0
+    prn  r7
+    jmp  r4
+    bne  r5
+    jmp  r7
+    hlt
+    add  #1543, r4
+    add  #1696, r0
+    jsr  r5
+    add  r2, r1
+    mov  r1, r3
+    rts
+    mov  #-796, r1
+    cmp  r3, #1194
+    jmp  r2
+    rts
+    add  r7, r3
+    inc  r3
+    not  r7
+    mov  r3, r7
+    clr  r4
+    jmp  r2
+    jmp  r1
+    dec  r4
+    sub  #685, r6
+    bne  r3
+    clr  r0
+    prn  r7
+    jmp  r2
+    rts
+    jsr  r4
+    jsr  r4
+    bne  r7
+    cmp  #-1355, #-439
+    sub  r7, r0
+    mov  #1849, r0
+    add  #1568, r3
+    prn  #-693
+    sub  #874, r7
+    not  r4
+    mov  #572, r6
+    inc  r0
+    inc  r7
+    hlt
+    hlt
+    mov  #-944, r3
+    jmp  r4
+    add  #-27, r4
+    red  r0
+    jmp  r3
+    not  r6
+    dec  r4
+    jsr  r5
+    bne  r3
+    jsr  r0
+    mov  #-568, r2
+    bne  r1
+    add  #-1721, r2
+    bne  r7
+    rts
+    add  #1911, r3
+    sub  #143, r6
+    cmp  r1, r7
+    jsr  r4
+    jsr  r5
+    inc  r2
+    mov  r3, r4
+    bne  r1
+    not  r7
+    red  r7
+    hlt
+    prn  #K1
+    mov  r7, r5
+    mov  #-1515, r1
+    cmp  #875, #K3
+    mov  #-601, r0
+    not  r4
+    clr  r7
+    jsr  r0
+    prn  #-596
+    jmp  r2
+    bne  r7
+    hlt
+    red  r6
+    inc  r5
+    red  r6
+    sub  r3, r7
+    bne  r3
+    inc  r0
+    inc  r2
+    sub  r2, r2
+    clr  r1
+    rts
+    hlt
+    inc  r1
+    mov  r0, r4
+    jmp  r1
+    hlt
+    rts
+    add  r1, r0
+    jmp  r6
+    red  r0
+    cmp  r4, #K0
+    inc  r1
+    jmp  r5
+    sub  r6, r5
+    clr  r6
+    jmp  r0
+    bne  r6
+    bne  r0
+    bne  r1
+    red  r5
+    jsr  r2
+    prn  r0
+    not  r2
+    add  r7, r6
+    clr  r1
+    prn  r4
+    prn  #K0
+    sub  r7, r4
+    add  #-892, r7
+    inc  r7
+    rts
+    sub  r1, r5
+    rts
+    clr  r3
+    sub  r7, r0
+    jmp  r6
+    jsr  r0
+    cmp  #-92, #401
+    bne  r7
+    hlt
+    sub  #-388, r6
+    mov  #1065, r7
+    prn  #522
+    clr  r6
+    clr  r6
+    red  r2
+    clr  r5
+    jsr  r1
+    not  r2
+    not  r1
+    cmp  #292, r2
+    dec  r0
+    rts
+    clr  r3
+    jsr  r1
+    bne  r1
+    jsr  r2
+    jsr  r4
+    add  #-728, r5
+    jmp  r3
+    clr  r3
+    cmp  #982, r5
+    red  r5
+    hlt
+    cmp  r5, r5
+    clr  r2
+    not  r6
+    red  r7
+    rts
+    sub  r0, r2
+    mov  r2, r3
+    clr  r6
+    jmp  r4
+    add  #-671, r0
+    sub  r7, r5
+    rts
+    bne  r2
+    inc  r0
+    dec  r0
+    clr  r1
+    add  r4, r1
+    dec  r7
+    red  r2
+    add  r3, r5
+    red  r5
+    rts
+    hlt
+    dec  r0
+    clr  r3
+    rts
+    red  r3
+    hlt
+    prn  #K1
+    mov  #-387, r1
+    jmp  r4
+    jsr  r6
+    prn  #1533
+    sub  r1, r1
+    inc  r4
+    mov  r7, r4
+    clr  r6
+    bne  r6
+    mov  r7, r5
+    sub  r4, r0
+    red  r3
+    hlt
+    cmp  #-1809, #1085
+    hlt
+    rts
+    dec  r4
+    inc  r2
+    sub  #1576, r4
+    hlt
+    sub  #297, r2
+    clr  r6
+    add  #1698, r6
+    mov  #-109, r2
+    bne  r7
+    bne  r2
+    add  #-1591, r6
+    mov  r3, r0
+    jsr  r4
+    jsr  r4
+    cmp  r0, r3
+    hlt
+    jmp  r4
+    red  r5
+    prn  #894
+    mov  r7, r5
+    prn  r4
+    prn  #K3
+    jsr  r1
+    inc  r0
+    clr  r7
+    prn  r2
+    mov  r0, r3
+    sub  r3, r4
+    prn  r4
+    prn  #464
+    rts
+    cmp  #-414, r3
+    mov  #1194, r5
+    not  r7
+    mov  #262, r5
+    bne  r0
+    jmp  r1
+    clr  r4
+    sub  r0, r3
+    sub  #-421, r2
+    jsr  r5
+    sub  r5, r6
+    jmp  r0
+    jmp  r1
+    sub  #407, r4
+    inc  r0
+    cmp  r1, r5
+    sub  #32, r3
+    add  r3, r3
+    prn  #-451
+    mov  #71, r7
+    prn  r1
+    add  r2, r6
+    mov  r1, r6
+    mov  #-693, r0
+    dec  r3
+    jsr  r3
+    cmp  r7, r3
+    jmp  r2
+    red  r4
+    sub  #-1286, r7
+    red  r4
+    sub  r1, r5
+    sub  r4, r2
+    clr  r3
+    bne  r2
+    red  r5
+    sub  #244, r4
+    jsr  r0
+    sub  r5, r7
+    add  r2, r4
+    add  #315, r5
+    add  #-1982, r2
+    rts
+    jsr  r6
+    mov  r5, r2
+    inc  r7
+    add  r6, r1
+    dec  r6
+    dec  r3
+    cmp  #1720, #135
+    jmp  r0
+    bne  r0
+    dec  r0
+    mov  r6, r6
+    inc  r5
+    cmp  #1187, r4
+    add  r5, r6
+    bne  r1
+    add  r4, r7
+    jsr  r5
+    rts
+    bne  r3
+    red  r2
+    add  #1643, r0
+    mov  #-1471, r0
+    cmp  #1726, #537
+    mov  r0, r0
+    hlt
+    inc  r2
+    not  r4
+    prn  r1
+    mov  #-1421, r1
+    rts
+    jmp  r0
+    rts
+    jmp  r1
+    cmp  r7, #K1
+    cmp  r1, r5
+    add  r6, r2
+    jsr  r4
+    mov  r7, r3
+    cmp  r1, r5
+    clr  r1
+    hlt
+    clr  r3
+    inc  r7
+    sub  r4, r6
+    prn  r7
+    rts
+    cmp  #1230, #K0
+    mov  r3, r7
+    bne  r6
+    sub  #329, r4
+    jmp  r5
+    hlt
+    dec  r1
+    jmp  r7
+    cmp  #-207, #K2
+    clr  r3
+    hlt
+    inc  r1
+    bne  r4
+    clr  r5
+    prn  #1130
+    inc  r7
+    red  r0
+    bne  r4
+    dec  r0
+    jmp  r2
+    jmp  r3
+    add  r1, r3
+    mov  r1, r3
+    mov  #1138, r3
+    jmp  r5
+    red  r7
+    jsr  r3
+    prn  r0
+    inc  r0
+    inc  r0
+    red  r0
+    dec  r3
+    add  r1, r0
+    mov  r4, r3
+    cmp  r1, #K3
+    not  r5
+    add  #1484, r0
+    rts
+    mov  #-129, r1
+    rts
+    mov  r4, r7
+    red  r0
+    inc  r0
+    bne  r5
+    jsr  r2
+    prn  r7
+    red  r1
+    sub  #-606, r7
+    prn  r4
+    prn  r3
+    not  r6
+    prn  #-647
+    cmp  #-736, r0
+    rts
+    hlt
+    dec  r5
+    rts
+    jsr  r4
+    hlt
+    jsr  r7
+    dec  r7
+    prn  r7
+    bne  r3
+    rts
+    mov  #918, r6
+    mov  #1681, r7
+    prn  #844
+    clr  r2
+    clr  r5
+    mov  #-1280, r0
+    add  r2, r2
+    red  r7
+    red  r6
+    cmp  #1927, #-1287
+    jmp  r7
+    add  #805, r7
+    red  r7
+    dec  r0
+    jsr  r3
+    add  r1, r4
+    sub  r7, r1
+    not  r6
+    jmp  r2
+    jsr  r6
+    rts
+    jsr  r7
+    dec  r1
+    clr  r0
+    jsr  r4
+    prn  r0
+    sub  #-227, r3
+    clr  r4
+    dec  r4
+    rts
+    prn  r5
+    jmp  r4
+    cmp  r7, r2
+    inc  r6
+    hlt
+    bne  r5
+    sub  r7, r1
+    jsr  r7
+    jmp  r7
+    sub  #-177, r1
+    dec  r2
+    red  r2
+    hlt
+    bne  r0
+    clr  r2
+    sub  r6, r7
+    sub  #105, r4
+    mov  r4, r0
+    hlt
+    red  r5
+    clr  r3
+    cmp  r6, #406
+    jsr  r0
+    rts
+    cmp  #-1721, #K3
+    rts
+    not  r6
+    not  r5
+    add  r0, r2
+    add  r1, r6
+    sub  r6, r0
+    add  #1859, r2
+    dec  r2
+    mov  #926, r4
+    bne  r7
+    jsr  r3
+    not  r4
+    prn  r7
+    bne  r2
+    sub  r0, r5
+    prn  r6
+    hlt
+    hlt
+    mov  r0, r3
+    add  r1, r1
+    cmp  #-487, #K3
+    add  #604, r4
+    add  r7, r5
+    red  r6
+    bne  r6
+    clr  r4
+    not  r5
+    clr  r3
+    cmp  #-1357, r2
+    clr  r0
+    bne  r1
+    prn  r4
+    add  r2, r2
+    mov  r3, r6
+    sub  r6, r1
+    inc  r0
+    prn  #K2
+    jsr  r5
+    prn  #-1751
+    add  #-1041, r1
+    bne  r7
+    prn  r5
+    jsr  r7
+    sub  r1, r2
+    sub  #1262, r6
+    rts
+    sub  r2, r1
+    sub  r1, r5
+    red  r5
+    add  #363, r7
+    hlt
+    not  r3
+    sub  r2, r3
+    add  r0, r1
+    dec  r3
+    sub  #-1260, r5
+    dec  r4
+    bne  r0
+    not  r3
+    inc  r6
+    clr  r7
+    jsr  r5
+    jsr  r2
+    mov  #797, r5
+    red  r1
+    jsr  r4
+    mov  r3, r5
+    jsr  r0
+    rts
+    add  r3, r4
+    sub  r0, r5
+    cmp  #957, #-1735
+    mov  #-332, r4
+    cmp  #421, #609
+    hlt
+    rts
+    not  r7
+    clr  r1
+    inc  r6
+    dec  r2
+    jsr  r7
+    inc  r3
+    jmp  r7
+    dec  r4
+    sub  #1191, r6
+    inc  r5
+    prn  #K3
+    rts
+    jsr  r5
+    prn  #K3
+    red  r2
+    bne  r6
+    mov  r1, r4
+    jsr  r4
+    mov  #-678, r0
+    dec  r1
+    jsr  r2
+    jsr  r4
+    red  r4
+    not  r2
+    bne  r2
+    add  #-1591, r1
+    dec  r3
+    clr  r2
+    clr  r1
+    inc  r3
+    dec  r4
+    sub  #-762, r2
+    jsr  r7
+    not  r5
+    red  r5
+    jmp  r4
+    prn  #K2
+    rts
+    clr  r5
+    add  #1771, r7
+    not  r2
+    jmp  r2
+    bne  r0
+    red  r1
+    inc  r0
+    red  r3
+    prn  r7
+    dec  r0
+    rts
+    add  r1, r1
+    prn  #K2
+    add  #94, r0
+    red  r6
+    add  #1435, r6
+    rts
+    not  r7
+    dec  r0
+    sub  #-381, r2
+    clr  r7
+    clr  r7
+    jmp  r4
+    rts
+    not  r7
+    rts
+    bne  r5
+    dec  r1
+    sub  r7, r1
+    clr  r3
+    mov  #548, r2
+    sub  r3, r5
+endmcr
+mcr m3
+    not  r5
+    prn  #K3
+    not  r4
+    inc  r6
+    not  r1
+    mov  #-297, r0
+    dec  r2
+    rts
+    inc  r3
+    sub  r3, r6
+    sub  r6, r0
+    red  r5
+    add  r3, r1
+    clr  r3
+    inc  r5
+    jmp  r4
+    red  r6
+    jsr  r6
+    red  r1
+    not  r3
+    bne  r6
+    add  r5, r3
+    not  r3
+    jmp  r0
+    bne  r7
+    not  r5
+    sub  r5, r4
+    jsr  r2
+    hlt
+    prn  #K1
+    prn  #-312
+    red  r1
+    inc  r5
+    rts
+    not  r1
+    jmp  r7
+    add  #894, r2
+    sub  #-1703, r3
+    sub  #1800, r0
+    rts
+    hlt
+    not  r4
+    bne  r5
+    hlt
+    red  r0
+    hlt
+    not  r4
+    bne  r3
+    jmp  r7
+    add  r0, r0
+    mov  #-873, r4
+    dec  r6
+    not  r1
+    sub  r2, r3
+    inc  r6
+    jsr  r5
+    add  #-540, r3
+    hlt
+    inc  r3
+    not  r3
+    jsr  r2
+    cmp  #1605, #K3
+    rts
+    rts
+    dec  r5
+    mov  r0, r3
+    jsr  r0
+    jmp  r2
+    jmp  r2
+    hlt
+    jsr  r6
+    jmp  r1
+    cmp  r5, #K0
+    dec  r3
+    dec  r5
+    rts
+    cmp  #-728, r6
+    bne  r6
+    inc  r5
+    inc  r3
+    bne  r1
+    red  r0
+    not  r0
+    not  r1
+    jsr  r0
+    red  r3
+    dec  r1
+    jmp  r3
+    hlt
+    jmp  r5
+    hlt
+    jmp  r6
+    clr  r3
+    rts
+    dec  r4
+    inc  r7
+    red  r3
+    add  r4, r3
+    not  r7
+    hlt
+    add  r1, r1
+    prn  #K1
+    cmp  #-1639, #K1
+    inc  r3
+    dec  r1
+    inc  r4
+    cmp  #1626, r7
+    rts
+    sub  #1043, r5
+    clr  r1
+    prn  r2
+    hlt
+    bne  r3
+    mov  #-592, r2
+    jsr  r5
+    add  #1828, r3
+    red  r7
+    cmp  r5, #101
+    red  r0
+    not  r2
+    cmp  #-531, r3
+    add  r2, r2
+    not  r1
+    jsr  r3
+    inc  r5
+    red  r2
+    inc  r7
+    sub  #1369, r2
+    dec  r2
+    jmp  r1
+    dec  r3
+    inc  r0
+    jsr  r5
+    jmp  r0
+    prn  r7
+    jmp  r2
+    jmp  r6
+    jmp  r0
+    inc  r6
+    dec  r5
+    not  r4
+    bne  r7
+    cmp  #773, #1401
+    sub  #-861, r7
+    jsr  r0
+    hlt
+    inc  r6
+    cmp  #137, #K2
+    add  r4, r7
+    mov  r3, r1
+    mov  #449, r0
+    add  r3, r4
+    prn  #K2
+    not  r1
+    clr  r0
+    mov  r4, r4
+    add  r2, r7
+    prn  #-357
+    jmp  r4
+    jsr  r5
+    bne  r3
+    jsr  r0
+    mov  #-1384, r6
+    bne  r1
+    add  r6, r0
+    add  #839, r3
+    sub  #591, r6
+    cmp  r7, #1905
+    bne  r1
+    jsr  r4
+    jsr  r5
+    inc  r5
+    prn  r3
+    bne  r1
+    not  r5
+    hlt
+    cmp  r3, r5
+    cmp  #-1788, r7
+    mov  #1588, r0
+    sub  #1667, r3
+    jsr  r5
+    prn  r4
+    mov  r6, r6
+    not  r7
+    add  #-729, r5
+    jsr  r0
+    prn  #540
+    jmp  r2
+    bne  r7
+    hlt
+    red  r2
+    inc  r7
+    clr  r7
+    hlt
+    cmp  #644, r3
+    not  r3
+    inc  r1
+    bne  r2
+    jmp  r2
+    inc  r0
+    jsr  r1
+    rts
+    hlt
+    inc  r7
+    jmp  r7
+    clr  r6
+    clr  r0
+    jmp  r1
+    hlt
+    rts
+    add  r1, r0
+    jmp  r6
+    red  r1
+    dec  r0
+    hlt
+    not  r5
+    jsr  r3
+    jmp  r6
+    clr  r7
+    dec  r1
+    dec  r6
+    cmp  r0, #K2
+    bne  r1
+    red  r5
+    hlt
+    bne  r0
+    not  r0
+    inc  r6
+    jsr  r1
+    prn  r4
+    prn  #K0
+    sub  r2, r3
+    sub  r0, r5
+    not  r7
+    rts
+    sub  r1, r1
+    rts
+    clr  r6
+    not  r0
+    red  r3
+    rts
+    hlt
+    mov  r1, r2
+    jmp  r6
+    mov  #393, r0
+    cmp  r7, #K2
+    sub  #-737, r4
+    bne  r4
+    jmp  r4
+    add  #-1861, r6
+    not  r4
+    prn  r6
+    clr  r6
+    inc  r0
+    red  r5
+    mov  r1, r4
+    not  r7
+    not  r6
+    jmp  r2
+    jsr  r2
+    dec  r1
+    add  #228, r7
+    not  r5
+    inc  r4
+    mov  #1006, r6
+    red  r1
+    jsr  r2
+    jsr  r4
+    add  #1080, r5
+    jmp  r3
+    clr  r3
+    cmp  #454, r5
+    sub  #199, r5
+    rts
+    red  r3
+    red  r3
+    inc  r6
+    jmp  r3
+    dec  r6
+    red  r2
+    clr  r6
+    jmp  r4
+    add  #1660, r5
+    cmp  r7, r2
+    rts
+    bne  r2
+    inc  r0
+    dec  r5
+    jmp  r0
+    clr  r4
+    cmp  #-627, r4
+    jsr  r3
+    clr  r5
+    jmp  r7
+    sub  r0, r5
+    jmp  r1
+    mov  r6, r6
+    red  r4
+    clr  r6
+    clr  r1
+    add  #29, r5
+    inc  r2
+    prn  r1
+    rts
+    hlt
+    jmp  r5
+    not  r5
+    mov  r7, r2
+    sub  r4, r6
+    red  r7
+    cmp  #-289, #-627
+    hlt
+    rts
+    dec  r4
+    prn  #1654
+    clr  r2
+    not  r3
+    dec  r0
+    jmp  r7
+    cmp  r5, #K3
+    dec  r0
+    clr  r3
+    bne  r7
+    bne  r2
+    add  #313, r2
+    mov  r3, r0
+    jsr  r4
+    jsr  r4
+    cmp  r0, r3
+    hlt
+    jmp  r4
+    red  r5
+    prn  #1934
+    mov  r7, r5
+    prn  r4
+    prn  #K3
+    jsr  r1
+    inc  r4
+    add  #-1163, r6
+    bne  r4
+    inc  r2
+    cmp  r1, r0
+    prn  r3
+    prn  r4
+    prn  #832
+    rts
+    cmp  #1426, r3
+    mov  #154, r4
+    not  r3
+    mov  #-121, r0
+    mov  r1, r1
+    not  r4
+    prn  r2
+    rts
+    cmp  r7, r0
+    red  r5
+    dec  r5
+    add  r3, r3
+    cmp  r1, r5
+    sub  r3, r5
+    dec  r3
+    jsr  r4
+    inc  r4
+    cmp  #-1713, #-1200
+    mov  r2, r2
+    mov  r1, r3
+    mov  #1176, r5
+    prn  r0
+    clr  r3
+    red  r2
+    sub  #1997, r7
+    bne  r3
+    cmp  r7, r3
+    clr  r7
+    rts
+    clr  r4
+    jmp  r2
+    red  r3
+    clr  r1
+    sub  r4, r2
+    clr  r6
+    sub  #-781, r3
+    jsr  r3
+    bne  r4
+    dec  r4
+    rts
+    prn  r0
+    sub  r7, r5
+    clr  r1
+    bne  r1
+    cmp  r4, r2
+    add  #-1962, r5
+    red  r1
+    red  r6
+    jsr  r6
+    mov  r4, r6
+    red  r0
+    jmp  r0
+    bne  r0
+    dec  r7
+    mov  r6, r3
+    inc  r4
+    jsr  r3
+    not  r2
+    sub  r5, r2
+    cmp  #531, r5
+    bne  r7
+    inc  r6
+    clr  r6
+    bne  r5
+    clr  r4
+    rts
+    sub  #949, r5
+    jsr  r3
+    red  r2
+    bne  r6
+    sub  #-1090, r5
+    jmp  r0
+    inc  r7
+    dec  r1
+    add  r6, r5
+    cmp  #1134, #1289
+    mov  r0, r2
+    add  r2, r7
+    red  r2
+    not  r0
+    prn  #-701
+    not  r4
+    dec  r4
+    bne  r4
+    bne  r1
+    mov  #-285, r7
+    rts
+    jmp  r0
+    rts
+    jmp  r1
+    cmp  r7, #K1
+    cmp  r1, r5
+    add  r6, r2
+    jsr  r4
+    mov  r7, r3
+    cmp  r1, r5
+    clr  r2
+    add  r3, r4
+    dec  r5
+    jmp  r3
+    inc  r7
+    sub  #-1046, r4
+    inc  r1
+    not  r5
+    hlt
+    not  r1
+    cmp  #273, #K1
+    hlt
+    clr  r3
+    mov  r7, r1
+    cmp  #-1727, #K2
+    clr  r7
+    bne  r2
+    red  r3
+    jsr  r4
+    hlt
+    bne  r2
+    inc  r0
+    cmp  #1512, #K1
+    clr  r0
+    jmp  r2
+    jmp  r3
+    add  r1, r4
+    hlt
+    jmp  r5
+    bne  r5
+    sub  r3, r1
+    cmp  r2, #714
+    prn  r3
+    hlt
+    hlt
+    jsr  r3
+    prn  r0
+    inc  r2
+    mov  #1304, r1
+    mov  #1102, r2
+    hlt
+    cmp  #411, #K0
+    hlt
+    not  r5
+    red  r5
+    dec  r7
+    cmp  #1650, #K1
+    dec  r4
+    rts
+    mov  r6, r1
+    cmp  r3, #1398
+    jmp  r0
+    jmp  r0
+    jsr  r7
+    inc  r0
+    inc  r0
+    rts
+    jmp  r5
+    jsr  r2
+    prn  r7
+    red  r0
+    not  r0
+    add  r4, r1
+    prn  r3
+    not  r6
+    prn  #297
+    cmp  #944, r0
+    rts
+    hlt
+    rts
+    jsr  r6
+    rts
+    hlt
+    prn  r5
+    dec  r5
+    red  r1
+    not  r7
+    bne  r3
+    rts
+    mov  #-53, r4
+    red  r4
+    cmp  #1747, #K2
+    prn  r5
+    mov  r1, r0
+    bne  r2
+    prn  r3
+    inc  r7
+    jmp  r1
+    hlt
+    inc  r2
+    sub  r5, r5
+    hlt
+    dec  r0
+    mov  r3, r4
+    add  r1, r5
+    sub  r1, r7
+    hlt
+    inc  r4
+    rts
+    jmp  r2
+    jsr  r6
+    rts
+    jsr  r7
+    dec  r5
+    cmp  #-1940, #-1095
+    red  r2
+    add  #-1585, r5
+    prn  #-1556
+    rts
+    clr  r0
+    not  r1
+    inc  r2
+    add  r3, r7
+    prn  r2
+    hlt
+    clr  r6
+    red  r5
+    rts
+    add  r3, r7
+    add  r3, r6
+    hlt
+    cmp  r2, #1912
+    cmp  r2, r2
+    jsr  r0
+    clr  r6
+    inc  r7
+    red  r1
+    hlt
+    jsr  r4
+    rts
+    jsr  r0
+    cmp  r6, r1
+    bne  r6
+    inc  r1
+    cmp  r0, r6
+    not  r0
+    bne  r4
+    hlt
+    red  r1
+    jsr  r3
+    red  r5
+    jmp  r6
+    jsr  r0
+    rts
+    cmp  #535, #K3
+    rts
+    not  r4
+    rts
+    bne  r5
+    add  r0, r4
+    add  r1, r6
+    sub  r6, r0
+    add  r2, r5
+    not  r2
+    mov  r7, r4
+    jsr  r3
+    dec  r4
+    prn  r7
+    bne  r2
+    sub  r7, r6
+    prn  r6
+    mov  r6, r3
+    inc  r1
+    clr  r6
+    bne  r1
+    cmp  #-1847, #K3
+    add  r7, r2
+    red  r6
+    prn  #364
+    sub  r1, r3
+    jmp  r4
+    add  r2, r2
+    mov  r0, r3
+    red  r3
+    rts
+    inc  r4
+    dec  r7
+    mov  r5, r0
+    prn  #-1831
+    add  r4, r7
+    bne  r7
+    jsr  r0
+    mov  r1, r5
+    sub  r2, r6
+    jmp  r0
+    prn  r2
+    sub  r5, r3
+    jsr  r6
+    rts
+    clr  r3
+    hlt
+    not  r3
+    cmp  r3, r7
+    hlt
+    not  r3
+    add  r6, r3
+    add  #1220, r0
+    jsr  r3
+    cmp  r4, r4
+    mov  #1614, r5
+    add  r3, r4
+    sub  r0, r5
+    cmp  #-531, #809
+    mov  r7, r3
+    not  r0
+    not  r1
+    clr  r6
+    inc  r7
+    clr  r5
+    prn  r7
+    jsr  r6
+    add  r7, r5
+    red  r3
+    red  r3
+    clr  r7
+    inc  r0
+    jsr  r6
+    jsr  r5
+    prn  #K3
+    red  r2
+    dec  r4
+    cmp  #1472, r1
+    red  r5
+    mov  #1966, r2
+    not  r0
+    bne  r5
+    red  r5
+    jmp  r2
+    bne  r7
+    add  r5, r2
+    dec  r7
+    sub  r3, r4
+    sub  r4, r7
+    sub  #941, r6
+    red  r7
+    mov  r0, r7
+    not  r2
+    dec  r3
+    clr  r7
+    not  r2
+    rts
+    clr  r4
+    hlt
+    add  #635, r3
+    bne  r2
+    jmp  r0
+    red  r4
+    sub  r4, r1
+    not  r6
+    jmp  r3
+    add  #974, r5
+    add  r1, r0
+    prn  #K2
+    add  #860, r6
+    rts
+    red  r2
+    rts
+    red  r5
+    mov  r5, r0
+    red  r7
+    clr  r6
+    not  r0
+    hlt
+    hlt
+    rts
+    bne  r5
+    dec  r5
+    hlt
+    jmp  r7
+    clr  r0
+    dec  r3
+    rts
+    jmp  r2
+    bne  r7
+    sub  #-1767, r1
+    clr  r0
+    inc  r7
+    not  r1
+    rts
+    rts
+    not  r3
+    dec  r7
+    bne  r6
+    add  r1, r0
+    clr  r0
+    not  r3
+    sub  r6, r0
+    red  r7
+    mov  r1, r7
+    bne  r3
+    clr  r7
+    rts
+    prn  #K2
+    red  r1
+    jmp  r4
+    jsr  r6
+    jsr  r6
+    red  r4
+    cmp  #-1013, r2
+    rts
+    add  r7, r0
+    not  r2
+    red  r4
+    add  #-963, r7
+    hlt
+    clr  r6
+    red  r3
+    prn  r5
+    jsr  r2
+    hlt
+    prn  #K1
+    prn  #-1960
+    red  r5
+    jmp  r7
+    inc  r6
+    not  r1
+    clr  r1
+    sub  #494, r2
+    sub  #-1085, r2
+    bne  r3
+    bne  r1
+    rts
+    dec  r4
+    rts
+    not  r4
+    inc  r6
+    cmp  #1967, r6
+    not  r0
+    rts
+    mov  #-558, r5
+    add  #-1632, r0
+    prn  #-1768
+    dec  r7
+    inc  r5
+    hlt
+    jsr  r1
+    bne  r2
+    prn  #-1225
+    hlt
+    add  r5, r6
+    jsr  r2
+    not  r3
+    not  r0
+    jsr  r6
+    add  r3, r1
+    inc  r6
+    red  r1
+    dec  r0
+    hlt
+    mov  r2, r1
+    jmp  r2
+    hlt
+    jsr  r6
+    jmp  r1
+    cmp  r5, #K0
+    dec  r0
+    rts
+    dec  r6
+    red  r4
+    dec  r5
+    add  #1441, r3
+    prn  #K0
+    add  #-1925, r5
+    hlt
+    jmp  r5
+    hlt
+    jmp  r6
+    clr  r4
+    dec  r1
+    sub  #-1621, r1
+    add  #503, r1
+    red  r1
+    bne  r3
+    hlt
+    hlt
+    red  r3
+    hlt
+    hlt
+    add  r1, r6
+    prn  #K1
+    cmp  #-247, #K1
+    inc  r6
+    sub  #-500, r7
+    cmp  #-1174, r7
+    rts
+    sub  #-1271, r3
+    prn  r2
+    hlt
+    bne  r3
+    mov  #-1696, r2
+    jsr  r5
+    add  #-1740, r3
+    red  r7
+    cmp  r5, #-1867
+    red  r4
+    cmp  r3, #-1718
+    jmp  r2
+    rts
+    add  #1914, r2
+    cmp  r7, r3
+    clr  r3
+    not  r7
+    mov  #899, r1
+    sub  #1488, r4
+    dec  r0
+    prn  #739
+    clr  r4
+    inc  r4
+    clr  r6
+    hlt
+    sub  #1613, r0
+    not  r2
+    sub  #-511, r2
+    jmp  r3
+    inc  r0
+    not  r7
+    sub  r0, r3
+    inc  r1
+    add  #1798, r4
+    sub  #-1305, r4
+    cmp  #-440, r0
+    inc  r7
+    hlt
+    hlt
+    mov  #857, r0
+    prn  r4
+    add  r6, r4
+    dec  r3
+    sub  #633, r7
+    not  r0
+    red  r5
+    clr  r5
+    sub  #-982, r0
+    rts
+    bne  r2
+    mov  r4, r2
+    inc  r7
+    add  #1101, r7
+    sub  #666, r7
+    mov  r3, r4
+    bne  r1
+    not  r1
+    red  r1
+    inc  r6
+    cmp  r7, #K3
+    mov  #1269, r5
+    cmp  #-1557, #K3
+    mov  #-507, r2
+    jsr  r4
+    mov  r2, r6
+    rts
+    red  r7
+    prn  r2
+    bne  r7
+    hlt
+    red  r2
+    sub  r2, r0
+    jmp  r2
+    inc  r5
+    dec  r1
+    rts
+    hlt
+    inc  r6
+    bne  r7
+    clr  r1
+    red  r6
+    add  r0, r6
+    inc  r7
+    rts
+    red  r1
+    dec  r4
+    inc  r1
+    clr  r3
+    sub  r6, r5
+    clr  r0
+    bne  r6
+    jsr  r0
+    bne  r1
+    red  r0
+    sub  r2, r5
+    prn  r0
+    not  r0
+    rts
+    jsr  r1
+    prn  r4
+    prn  #K0
+    sub  r2, r3
+    sub  #97, r2
+    clr  r4
+    inc  r3
+    jmp  r5
+    add  #1303, r6
+    rts
+    dec  r3
+    sub  r0, r6
+    bne  r5
+    cmp  #1122, r1
+    inc  r1
+    bne  r1
+    add  r7, r4
+    sub  r4, r2
+    jmp  r4
+    add  #-1860, r3
+    clr  r3
+    rts
+    clr  r6
+    inc  r2
+    mov  r1, r2
+    not  r7
+    not  r6
+    jmp  r2
+    jsr  r2
+    dec  r3
+    cmp  r6, r6
+    rts
+    clr  r5
+    not  r3
+    cmp  r4, #-622
+    add  #232, r5
+    jmp  r3
+    clr  r3
+    cmp  #-1642, r5
+    clr  r3
+    jsr  r7
+    clr  r2
+    bne  r6
+    rts
+    sub  r0, r6
+    mov  #-868, r3
+    mov  #-1812, r5
+    cmp  r7, r2
+    rts
+    bne  r2
+    inc  r0
+    mov  #988, r1
+    clr  r3
+    jmp  r4
+    cmp  #93, r4
+    jsr  r3
+    clr  r0
+    dec  r6
+    red  r7
+    prn  #K1
+    mov  #1085, r1
+    jmp  r4
+    jsr  r6
+    prn  #1533
+    sub  r1, r4
+    rts
+    hlt
+    jmp  r5
+    not  r5
+    not  r6
+    jsr  r7
+    clr  r7
+    rts
+    mov  r7, r5
+    sub  r0, r1
+endmcr
+MAIN:   mov  r0, r1
+END:    hlt
@@ -0,0 +1,4030 @@
+.define K0 = 14
+.define K1 = 12
+.define K2 = 34
+.define K3 = 27
+.extern X0
+.extern X1
+.extern X2
+.extern X3
+.extern X4
+.extern X5
+.extern X6
+.extern X7
+.extern X8
+.extern X9
+.extern X10
+.extern X11
+.extern X12
+.extern X13
+.extern X14
+.extern X15
+mcr m0
+    inc  r1
+    jsr  r4
+    mov  r5, r7
+    cmp  #-883, #K2
+    cmp  r6, r3
+    clr  r7
+    jmp  r0
+    red  r6
+    sub  #628, r4
+    cmp  #101, #1697
+    hlt
+    rts
+    not  r1
+    inc  r5
+    prn  r6
+    dec  r2
+    jsr  r7
+    inc  r3
+    jmp  r7
+    dec  r3
+    not  r7
+    jmp  r5
+    bne  r5
+    prn  #K3
+    red  r0
+    cmp  r1, #K0
+    jsr  r4
+    mov  #1054, r6
+    not  r0
+    jmp  r3
+    add  r7, r3
+    add  #801, r6
+    dec  r0
+    rts
+    inc  r5
+    prn  #231
+    red  r4
+    sub  #-954, r2
+    mov  #-1139, r0
+    hlt
+    inc  r3
+    prn  #1094
+    hlt
+    mov  r7, r2
+    mov  r4, r3
+    prn  #K2
+    rts
+    clr  r5
+    add  r0, r2
+    red  r4
+    sub  r4, r4
+    not  r0
+    red  r6
+    jmp  r3
+    sub  #1649, r7
+    cmp  #-259, r1
+    prn  #K2
+    bne  r5
+    jmp  r0
+    red  r2
+    jsr  r5
+    bne  r5
+    red  r7
+    clr  r1
+    inc  r4
+    rts
+    not  r0
+    hlt
+    hlt
+    rts
+    bne  r5
+    dec  r1
+    sub  r7, r7
+    clr  r3
+    mov  #4, r2
+    sub  r3, r1
+    not  r1
+    jsr  r5
+    dec  r7
+    not  r1
+    rts
+    rts
+    not  r0
+    red  r0
+    bne  r2
+    dec  r3
+    sub  r3, r6
+    sub  #629, r7
+    add  r3, r1
+    clr  r4
+    dec  r7
+    red  r4
+    red  r5
+    rts
+    inc  r5
+    inc  r1
+    prn  #-355
+    add  r6, r4
+    add  r4, r3
+    red  r2
+    rts
+    jsr  r1
+    red  r7
+    not  r3
+    add  r4, r3
+    red  r7
+    prn  #K1
+    prn  #-1016
+    red  r1
+    inc  r5
+    rts
+    not  r1
+    jmp  r7
+    add  #1406, r5
+    sub  #-839, r3
+    sub  #-1656, r0
+    rts
+    hlt
+    not  r4
+    bne  r5
+    hlt
+    red  r6
+    cmp  #1407, r6
+    not  r2
+    dec  r6
+    mov  r3, r6
+    jmp  r7
+    add  #161, r0
+    jsr  r0
+    mov  r0, r4
+    dec  r6
+    not  r3
+    prn  #1018
+    red  r2
+    inc  r7
+    jsr  r1
+    bne  r2
+    prn  #-537
+    hlt
+    add  r3, r4
+    jsr  r2
+    cmp  #-1467, #K3
+    rts
+    rts
+    dec  r6
+    add  r3, r0
+    inc  r0
+    mov  r0, r3
+    jsr  r0
+    jmp  r2
+    jmp  r2
+    hlt
+    jsr  r6
+    jmp  r1
+    cmp  r5, #K0
+    dec  r3
+    dec  r5
+    rts
+    cmp  #1576, r6
+    bne  r6
+    inc  r4
+    inc  r7
+    bne  r2
+    bne  r3
+    prn  #K0
+    not  r2
+    hlt
+    cmp  #-437, #K3
+    jsr  r7
+    jmp  r5
+    hlt
+    jmp  r6
+    clr  r3
+    jmp  r2
+    bne  r4
+    inc  r0
+    mov  r3, r3
+    hlt
+    hlt
+    cmp  r6, #K1
+    jmp  r3
+    add  r1, r6
+    prn  #K1
+    cmp  #-903, #K1
+    inc  r1
+    inc  r3
+    hlt
+    jmp  r4
+    bne  r5
+    jmp  r7
+    hlt
+    add  r4, r2
+    jsr  r5
+    not  r7
+    bne  r3
+    mov  #-1619, r4
+    cmp  #1447, r1
+    clr  r1
+    dec  r3
+    sub  r2, r5
+    not  r6
+    jmp  r3
+    sub  r4, r5
+    add  r7, r0
+    hlt
+    sub  r3, r0
+    add  #-1536, r1
+    dec  r1
+    dec  r4
+    sub  #1501, r4
+    bne  r3
+    clr  r2
+    clr  r7
+    hlt
+    jmp  r2
+    rts
+    jmp  r4
+    clr  r3
+    hlt
+    cmp  #-1979, #1593
+    sub  r0, r5
+    hlt
+    inc  r1
+    mov  #-165, r0
+    inc  r3
+    sub  #1146, r7
+    not  r4
+    not  r3
+    sub  #-1780, r6
+    inc  r1
+    clr  r0
+    dec  r1
+    rts
+    red  r3
+    rts
+    not  r6
+    clr  r6
+    inc  r7
+    mov  #-649, r1
+    not  r7
+    add  #-1995, r6
+    red  r0
+    jmp  r3
+    not  r2
+    rts
+    dec  r5
+    jsr  r2
+    jsr  r5
+    dec  r2
+    prn  #K3
+    jmp  r2
+    rts
+    bne  r2
+    mov  r4, r2
+    inc  r7
+    bne  r1
+    jsr  r4
+    jsr  r5
+    inc  r0
+    dec  r3
+    bne  r1
+    not  r5
+    inc  r1
+    mov  r7, r7
+    mov  #-1275, r5
+    cmp  #1659, #K3
+    mov  #1333, r2
+    jsr  r4
+    mov  #-1506, r3
+    hlt
+    add  #679, r3
+    jsr  r0
+    prn  #1180
+    jmp  r2
+    bne  r7
+    hlt
+    red  r7
+    add  #1393, r3
+    rts
+    sub  r7, r5
+    cmp  #1476, r3
+    not  r7
+    sub  #7, r5
+    mov  r2, r2
+    jmp  r2
+    inc  r0
+    jsr  r1
+    rts
+    hlt
+    inc  r5
+    inc  r6
+    clr  r1
+    red  r7
+    rts
+    add  #-1497, r7
+    cmp  r0, r6
+    prn  #-456
+    add  #-1561, r7
+    sub  r3, r5
+    jmp  r6
+    clr  r6
+    clr  r1
+    dec  r6
+    cmp  r0, #K2
+    bne  r1
+    red  r5
+    jsr  r2
+    prn  r0
+    not  r6
+    not  r4
+    prn  #K2
+    sub  #-1912, r4
+    mov  #-789, r4
+    hlt
+    add  #-249, r0
+    not  r6
+    dec  r3
+    rts
+    hlt
+    mov  r1, r5
+    jmp  r6
+    mov  #1972, r1
+    bne  r7
+    hlt
+    sub  #-500, r6
+    mov  #-1989, r4
+    not  r3
+    rts
+    clr  r3
+    jmp  r2
+    clr  r5
+    mov  r1, r4
+    not  r1
+    bne  r2
+    inc  r0
+    not  r1
+    add  r0, r3
+    sub  #-1308, r6
+    not  r5
+    inc  r0
+    prn  #K2
+    clr  r4
+    mov  #-985, r5
+    add  r5, r4
+    clr  r1
+    inc  r5
+    bne  r1
+    red  r6
+    dec  r6
+    red  r1
+    mov  r2, r2
+    red  r5
+    hlt
+    cmp  r5, r5
+    clr  r6
+    jsr  r7
+    prn  #1225
+    jsr  r7
+    red  r7
+    rts
+    sub  r0, r1
+    mov  #1132, r3
+    mov  #-995, r4
+    dec  r2
+    clr  r7
+    rts
+    bne  r2
+    inc  r0
+    dec  r5
+    clr  r2
+    dec  r5
+    sub  r4, r2
+    cmp  #1197, r4
+    jsr  r3
+    clr  r5
+    hlt
+    sub  r0, r5
+    jmp  r1
+    mov  r7, r6
+    prn  #K1
+    mov  #877, r2
+    jmp  r4
+    jsr  r6
+    prn  #-563
+    sub  r1, r4
+    rts
+    hlt
+    jmp  r5
+    not  r4
+    clr  r2
+    rts
+    hlt
+    rts
+    mov  r7, r5
+    sub  r4, r0
+    red  r7
+    cmp  #-705, #-1811
+    hlt
+    rts
+    dec  r4
+    prn  #1622
+    clr  r2
+    sub  #1080, r4
+    hlt
+    sub  #-103, r2
+    red  r0
+    add  #-1902, r0
+    mov  #-184, r2
+    cmp  #1219, r2
+    bne  r7
+    bne  r2
+    add  #1305, r1
+    mov  r3, r6
+    jsr  r4
+    jsr  r4
+    cmp  r0, r3
+    hlt
+    jmp  r4
+    red  r4
+    add  #-75, r4
+    rts
+    mov  #1100, r7
+    dec  r3
+    not  r5
+    rts
+    inc  r2
+    hlt
+    hlt
+    dec  r0
+    dec  r5
+    clr  r4
+    not  r2
+    prn  r2
+    cmp  r1, r0
+    prn  r3
+    prn  r4
+    prn  #352
+    rts
+    cmp  #-1006, r3
+    mov  #-1723, r7
+    bne  r7
+    mov  #1814, r0
+    bne  r0
+    jmp  r1
+    red  r3
+    red  r0
+    red  r7
+    jsr  r3
+    dec  r7
+    cmp  #-780, r4
+    cmp  #-1561, #1927
+    clr  r1
+    red  r1
+    sub  #80, r3
+    add  r3, r6
+    prn  #781
+    mov  r1, r4
+    sub  r3, r3
+    red  r6
+    add  r0, r3
+    jsr  r3
+    cmp  r7, r3
+    prn  r4
+    clr  r3
+    rts
+    cmp  r2, #556
+    not  r2
+    hlt
+    mov  #-1462, r5
+    inc  r3
+    jsr  r3
+    bne  r4
+    dec  r6
+    prn  r0
+    sub  r7, r5
+    clr  r4
+    jmp  r1
+    cmp  r4, r2
+    add  r2, r6
+    add  #1835, r5
+    add  r2, r1
+    dec  r0
+    mov  #-922, r7
+    prn  r5
+    inc  r2
+    hlt
+    red  r7
+    bne  r0
+    dec  r0
+    bne  r0
+    dec  r4
+    prn  r0
+    mov  r6, r3
+    inc  r1
+    red  r3
+    add  r5, r3
+    cmp  #275, r5
+    bne  r7
+    inc  r1
+    jsr  r5
+    clr  r3
+    prn  #-675
+    rts
+    bne  r3
+    red  r5
+    bne  r6
+    sub  #1671, r1
+    mov  r2, r0
+    cmp  r6, r5
+    cmp  #1166, #1001
+    mov  #1130, r7
+    sub  r6, r2
+    not  r7
+    jsr  r2
+    red  r2
+    not  r6
+    bne  r3
+    not  r4
+    bne  r4
+    bne  r1
+    mov  #867, r7
+    rts
+    jmp  r0
+    rts
+    jmp  r1
+    cmp  r7, #K1
+    cmp  r1, r5
+    add  #-352, r7
+    mov  r3, r4
+    dec  r7
+    clr  r2
+    inc  r6
+    inc  r6
+    bne  r6
+    dec  r6
+    mov  r6, r5
+    cmp  r1, r3
+    not  r1
+    jmp  r5
+    hlt
+    dec  r1
+    sub  #705, r2
+    clr  r7
+    bne  r2
+    red  r4
+    hlt
+    bne  r2
+    inc  r0
+    bne  r4
+    dec  r0
+    jmp  r2
+    dec  r1
+    jmp  r2
+    jmp  r3
+    cmp  r2, #-982
+    prn  r3
+    hlt
+    hlt
+    jsr  r3
+    prn  r0
+    inc  r7
+    red  r2
+    mov  #-1935, r2
+    mov  #-1762, r1
+    mov  #258, r2
+    mov  #964, r3
+    hlt
+    inc  r4
+    rts
+    clr  r0
+    rts
+    prn  #K0
+    not  r1
+    hlt
+    clr  r2
+    bne  r6
+    jmp  r1
+    mov  r7, r0
+    dec  r1
+    dec  r5
+    jsr  r2
+    prn  r7
+    red  r0
+    not  r3
+    red  r0
+    add  #-900, r3
+    rts
+    red  r6
+    rts
+    prn  #969
+    cmp  #304, r0
+    rts
+    dec  r6
+    jsr  r6
+    rts
+    hlt
+    prn  r5
+    dec  r0
+    dec  r7
+    bne  r3
+    rts
+    mov  #-1045, r4
+    red  r6
+    mov  r5, r4
+    mov  #-174, r0
+    prn  r3
+    inc  r4
+    inc  r2
+    sub  r4, r5
+    clr  r0
+    add  #467, r0
+    sub  r1, r4
+    prn  r1
+    sub  r1, r7
+    hlt
+    inc  r1
+    dec  r3
+    inc  r1
+    clr  r3
+    dec  r3
+    clr  r4
+    hlt
+    prn  #716
+    rts
+    clr  r0
+    not  r7
+    not  r7
+    add  r3, r7
+    prn  r2
+    hlt
+    clr  r4
+    jmp  r7
+    jsr  r7
+    jmp  r7
+    sub  r3, r6
+    hlt
+    cmp  r2, #-1960
+    cmp  r2, r2
+    jsr  r0
+    clr  r6
+    red  r6
+    inc  r7
+    rts
+    hlt
+    cmp  r5, #K2
+    hlt
+    not  r5
+    sub  r6, r3
+    bne  r6
+    inc  r1
+    hlt
+    cmp  #741, r3
+    jmp  r6
+    rts
+    rts
+    jmp  r6
+    not  r7
+    rts
+    not  r5
+    add  #1634, r3
+    dec  r7
+    mov  r2, r6
+    not  r2
+    mov  #-978, r2
+    bne  r7
+    jsr  r3
+    not  r4
+    sub  r2, r3
+    dec  r5
+    inc  r7
+    rts
+    hlt
+    hlt
+    hlt
+    bne  r1
+    cmp  #201, #K3
+    add  #-340, r1
+    add  r7, r5
+    red  r6
+    cmp  #-205, #K1
+    prn  r4
+    not  r2
+    jsr  r6
+    jsr  r6
+    sub  r2, r6
+    jsr  r5
+    clr  r2
+    red  r6
+    hlt
+    prn  #K1
+    jmp  r2
+    hlt
+    add  r3, r2
+    sub  r6, r3
+    inc  r0
+    prn  #K2
+    dec  r2
+    jsr  r5
+    not  r2
+    clr  r4
+    bne  r7
+    jsr  r0
+    mov  r5, r3
+    rts
+    mov  r2, r6
+    jmp  r0
+    prn  r2
+    sub  r1, r5
+    red  r2
+    add  #-1541, r5
+    hlt
+    not  r7
+    sub  r0, r2
+    dec  r2
+    not  r0
+    not  r5
+    red  r2
+    rts
+    clr  r0
+    clr  r2
+    mov  r4, r3
+    jmp  r3
+    not  r3
+    jsr  r0
+    rts
+    add  r0, r6
+    cmp  #-1139, #-1239
+    mov  r7, r6
+    not  r4
+    hlt
+    rts
+    not  r5
+    red  r2
+    not  r1
+    inc  r6
+    dec  r2
+    jsr  r7
+    inc  r1
+    cmp  r4, r0
+    sub  r1, r3
+    not  r7
+    inc  r5
+    prn  #K3
+    rts
+    jsr  r5
+    prn  #K3
+    red  r2
+    bne  r6
+    mov  #-1952, r6
+    red  r2
+    mov  #1866, r0
+    prn  #-675
+    red  r7
+    add  r0, r2
+    cmp  r3, #1720
+    clr  r5
+    jsr  r7
+    red  r1
+    inc  r6
+    mov  r7, r5
+    not  r0
+    clr  r7
+    mov  r7, r2
+    mov  #-1216, r2
+    red  r7
+    not  r5
+    dec  r7
+    not  r3
+    bne  r2
+    jmp  r0
+    red  r4
+    sub  r4, r4
+    not  r6
+    mov  #823, r0
+    inc  r0
+    jsr  r0
+    cmp  #109, r1
+    prn  #K2
+    bne  r5
+    sub  r0, r6
+    red  r3
+    bne  r0
+    sub  r3, r5
+    rts
+    rts
+    not  r1
+    mov  r5, r1
+    hlt
+    jmp  r7
+    clr  r0
+    dec  r5
+    not  r3
+    rts
+    jmp  r2
+    bne  r7
+    sub  #985, r5
+    clr  r0
+    inc  r7
+    not  r6
+    rts
+    not  r3
+    dec  r7
+    dec  r6
+    inc  r3
+    mov  r3, r6
+    sub  r1, r3
+    hlt
+    mov  r1, r7
+    bne  r3
+    clr  r6
+    prn  #K2
+    red  r1
+    not  r4
+    jsr  r6
+    jsr  r6
+    red  r2
+    sub  r0, r3
+    add  r1, r2
+    red  r3
+    add  r5, r4
+    jsr  r2
+    hlt
+    prn  #K1
+    prn  #-1576
+    red  r1
+    inc  r4
+    cmp  r4, r2
+    bne  r5
+    prn  r2
+    bne  r4
+    sub  r2, r0
+    mov  r4, r0
+    rts
+    not  r4
+    inc  r1
+    sub  #150, r4
+    prn  #K2
+    mov  r3, r6
+    jmp  r7
+    add  #-1934, r1
+    add  #-320, r0
+    prn  #1944
+    dec  r7
+    add  r5, r1
+    add  #-565, r1
+    add  r7, r4
+    hlt
+    add  r5, r6
+    jsr  r2
+    not  r6
+    dec  r6
+    add  r7, r3
+    clr  r0
+    not  r6
+    red  r2
+    jsr  r2
+    cmp  r0, #-248
+    mov  r5, r2
+    add  #1359, r1
+    cmp  r5, #K0
+    dec  r6
+    cmp  #-1192, r6
+    bne  r6
+    inc  r7
+    prn  r5
+    inc  r4
+    dec  r6
+    add  r4, r1
+    cmp  #-1166, #K0
+    jmp  r1
+    dec  r1
+    jsr  r0
+    red  r1
+    red  r6
+    cmp  #1084, r1
+    jsr  r7
+    jmp  r5
+    hlt
+    jmp  r6
+    clr  r0
+    rts
+    jsr  r6
+    hlt
+    inc  r7
+    cmp  #1035, r1
+    add  #-1289, r1
+    red  r2
+    hlt
+    red  r3
+    add  r4, r6
+    not  r6
+    add  #-588, r0
+    clr  r0
+    cmp  r6, #K1
+    jmp  r3
+    add  #-1500, r1
+    prn  #K1
+    prn  r5
+    jsr  r5
+    jmp  r7
+    hlt
+    add  r4, r2
+    jsr  r5
+    not  r7
+    bne  r3
+    mov  #1217, r6
+    jsr  r0
+    cmp  #916, r2
+    red  r1
+    rts
+    mov  r5, r5
+    red  r4
+    cmp  r3, #650
+    jmp  r2
+    rts
+    add  #-806, r2
+    cmp  r7, r3
+    clr  r4
+    add  r7, r7
+    sub  #-573, r1
+    sub  #-1306, r1
+    inc  r0
+    prn  #-1597
+    clr  r2
+    clr  r7
+    jmp  r2
+    jmp  r6
+    jmp  r0
+    inc  r5
+    clr  r6
+    cmp  #1461, #73
+    sub  #-1517, r7
+    jsr  r0
+    hlt
+    inc  r6
+    cmp  #569, #K2
+    add  r3, r1
+    mov  #-847, r2
+    add  #-26, r4
+    sub  #1854, r4
+    not  r6
+    clr  r6
+    inc  r3
+    mov  #-1721, r1
+    not  r7
+    inc  r5
+    red  r0
+    jmp  r3
+    not  r0
+    red  r5
+    jsr  r2
+    jsr  r5
+    dec  r0
+    mov  #-1974, r4
+    inc  r2
+    hlt
+    add  #-921, r2
+    bne  r7
+    rts
+    add  #-137, r3
+    sub  #1087, r1
+    cmp  r7, #-1215
+    bne  r1
+    jsr  r4
+    jsr  r5
+    inc  r4
+    red  r1
+    not  r5
+    inc  r1
+    inc  r4
+    not  r1
+    mov  r7, r7
+    mov  #1077, r1
+    cmp  #-629, #K3
+    mov  #-411, r5
+    jsr  r4
+    mov  #-690, r6
+    hlt
+    add  #1420, r7
+    mov  r2, r1
+    bne  r7
+    hlt
+    red  r7
+    add  r7, r4
+    clr  r2
+    inc  r7
+    red  r4
+    not  r7
+    sub  #-1129, r1
+    mov  r2, r3
+    inc  r5
+    mov  #-1465, r6
+    bne  r4
+    rts
+    hlt
+    sub  r5, r6
+    inc  r0
+    jmp  r1
+    hlt
+    rts
+endmcr
+mcr m1
+    add  r0, r6
+    inc  r7
+    rts
+    red  r4
+    dec  r0
+    add  #-745, r7
+    sub  r3, r1
+    jmp  r6
+    clr  r1
+    red  r2
+    hlt
+    cmp  r0, #K2
+    bne  r1
+    red  r6
+    bne  r5
+    hlt
+    bne  r0
+    not  r6
+    not  r2
+    sub  #-20, r3
+    jsr  r4
+    rts
+    rts
+    sub  #312, r4
+    mov  r2, r3
+    sub  #-319, r3
+    clr  r0
+    not  r6
+    inc  r1
+    clr  r2
+    jmp  r1
+    rts
+    clr  r6
+    not  r0
+    red  r6
+    hlt
+    mov  r1, r5
+    jmp  r6
+    mov  #-455, r0
+    cmp  r7, #K2
+    sub  #-1220, r6
+    mov  #-1006, r4
+    jsr  r4
+    red  r5
+    bne  r3
+    rts
+    clr  r6
+    red  r0
+    red  r2
+    sub  r4, r6
+    bne  r1
+    bne  r2
+    inc  r4
+    mov  r0, r5
+    jsr  r0
+    rts
+    red  r4
+    mov  r4, r2
+    add  r5, r7
+    bne  r1
+    red  r6
+    dec  r1
+    jmp  r7
+    add  r5, r1
+    jmp  r5
+    clr  r2
+    not  r4
+    sub  r7, r6
+    red  r7
+    rts
+    sub  r0, r6
+    mov  #-1860, r2
+    mov  #-1395, r4
+    dec  r3
+    bne  r3
+    hlt
+    rts
+    bne  r2
+    inc  r0
+    mov  #-676, r1
+    clr  r7
+    not  r0
+    jsr  r7
+    red  r6
+    bne  r1
+    clr  r3
+    red  r1
+    mov  r4, r3
+    clr  r5
+    mov  #909, r4
+    inc  r4
+    mov  r1, r4
+    rts
+    hlt
+    jmp  r5
+    not  r5
+    not  r6
+    bne  r6
+    mov  r7, r5
+    sub  r0, r1
+    rts
+    sub  r5, r4
+    rts
+    not  r0
+    clr  r4
+    not  r6
+    clr  r4
+    add  #1289, r2
+    red  r0
+    add  #870, r6
+    prn  #K2
+    not  r3
+    bne  r1
+    prn  r2
+    add  #377, r4
+    add  #9, r2
+    mov  r5, r7
+    rts
+    add  #1009, r4
+    hlt
+    sub  #974, r4
+    rts
+    cmp  #679, #1150
+    sub  #-304, r4
+    clr  r3
+    not  r0
+    jsr  r0
+    mov  r0, r7
+    prn  #K3
+    jsr  r1
+    inc  r4
+    add  r4, r0
+    inc  r1
+    add  #1163, r3
+    red  r4
+    clr  r3
+    rts
+    dec  r7
+    add  #943, r0
+    hlt
+    mov  r1, r0
+    not  r2
+    add  r6, r5
+    bne  r6
+    prn  r2
+    rts
+    cmp  r7, r0
+    red  r5
+    dec  r2
+    dec  r3
+    red  r7
+    jsr  r3
+    dec  r1
+    sub  #737, r4
+    dec  r6
+    add  r5, r1
+    inc  r0
+    add  #-901, r4
+    cmp  #-528, #957
+    hlt
+    prn  r4
+    hlt
+    jmp  r1
+    dec  r0
+    prn  r0
+    add  #-1766, r7
+    red  r2
+    inc  r0
+    prn  r0
+    clr  r6
+    sub  r0, r3
+    jsr  r3
+    cmp  r7, r3
+    sub  r6, r5
+    clr  r6
+    sub  #937, r1
+    prn  r2
+    not  r2
+    hlt
+    mov  r4, r3
+    sub  #1210, r3
+    inc  r3
+    bne  r2
+    red  r5
+    clr  r6
+    prn  r0
+    sub  r7, r5
+    clr  r4
+    jmp  r1
+    cmp  r4, r2
+    add  r2, r4
+    add  r2, r0
+    dec  r0
+    hlt
+    add  r6, r1
+    dec  r0
+    rts
+    not  r6
+    dec  r7
+    red  r2
+    jmp  r5
+    dec  r2
+    hlt
+    mov  r0, r4
+    mov  r6, r6
+    prn  r4
+    mov  r5, r3
+    cmp  #99, r5
+    bne  r7
+    inc  r4
+    bne  r2
+    prn  r4
+    jsr  r5
+    rts
+    bne  r3
+    red  r2
+    add  #293, r3
+    add  #-969, r0
+    mov  #-1759, r0
+    rts
+    cmp  #702, #761
+    mov  #422, r3
+    mov  r6, r5
+    not  r7
+    inc  r7
+    jsr  r2
+    red  r0
+    mov  #169, r2
+    sub  #-1702, r4
+    inc  r7
+    jsr  r5
+    jmp  r6
+    jmp  r0
+    rts
+    jmp  r1
+    cmp  r7, #K1
+    cmp  r1, r5
+    add  #-1136, r5
+    sub  #1923, r1
+    bne  r4
+    hlt
+    sub  r3, r7
+    bne  r3
+    rts
+    inc  r2
+    clr  r0
+    dec  r6
+    mov  #1389, r4
+    hlt
+    not  r0
+    cmp  r0, #1775
+    jsr  r7
+    dec  r1
+    jmp  r7
+    cmp  #-655, #K2
+    clr  r7
+    bne  r2
+    red  r5
+    prn  #-22
+    inc  r2
+    cmp  #697, #K1
+    clr  r0
+    jmp  r2
+    dec  r3
+    jmp  r1
+    jmp  r2
+    jmp  r3
+    cmp  r2, #-1734
+    prn  r3
+    hlt
+    hlt
+    jsr  r3
+    prn  r0
+    inc  r7
+    jmp  r3
+    bne  r0
+    dec  r1
+    mov  #174, r7
+    mov  #805, r6
+    add  #-396, r3
+    hlt
+    inc  r6
+    clr  r0
+    rts
+    prn  #K0
+    not  r1
+    hlt
+    rts
+    prn  r7
+    jmp  r0
+    jmp  r0
+    jsr  r7
+    inc  r3
+    clr  r0
+    inc  r0
+    rts
+    jmp  r5
+    jsr  r2
+    prn  r7
+    red  r4
+    prn  r3
+    dec  r3
+    not  r4
+    not  r5
+    sub  #-1151, r6
+    rts
+    jsr  r4
+    hlt
+    jsr  r7
+    dec  r1
+    not  r4
+    bne  r7
+    hlt
+    bne  r3
+    rts
+    mov  #411, r4
+    red  r1
+    prn  #-1044
+    clr  r5
+    add  #17, r5
+    mov  #864, r6
+    add  #-1569, r7
+    add  r4, r5
+    hlt
+    red  r6
+    not  r7
+    inc  r5
+    inc  r5
+    red  r7
+    dec  r0
+    mov  r2, r3
+    rts
+    prn  r1
+    prn  r1
+    sub  r7, r1
+    not  r6
+    jmp  r2
+    jsr  r6
+    rts
+    jsr  r7
+    dec  r5
+    jsr  r0
+    jsr  r4
+    prn  r0
+    sub  #-291, r5
+    clr  r4
+    dec  r2
+    red  r2
+    cmp  r7, r2
+    inc  r4
+    add  r5, r7
+    sub  r7, r1
+    jsr  r7
+    jmp  r7
+    sub  r7, r7
+    cmp  r2, #-184
+    cmp  r2, r2
+    jsr  r0
+    clr  r0
+    hlt
+    add  #-1466, r3
+    inc  r7
+    rts
+    hlt
+    cmp  r5, #K2
+    hlt
+    not  r0
+    cmp  r6, r1
+    bne  r6
+    inc  r1
+    hlt
+    cmp  #-235, r3
+    rts
+    rts
+    rts
+    jmp  r6
+    not  r4
+    rts
+    bne  r5
+    add  r0, r2
+    add  r7, r3
+    mov  r2, r6
+    not  r4
+    bne  r3
+    inc  r3
+    mov  r7, r4
+    bne  r2
+    sub  #-1956, r7
+    hlt
+    rts
+    hlt
+    hlt
+    jsr  r6
+    mov  r3, r3
+    cmp  #1817, #K3
+    add  r7, r2
+    red  r6
+    jsr  r6
+    sub  r2, r6
+    jsr  r5
+    clr  r2
+    prn  r1
+    prn  r4
+    add  r2, r1
+    mov  r0, r3
+    red  r6
+    inc  r0
+    prn  #K2
+    jsr  r5
+    prn  #1993
+    add  r2, r4
+    clr  r2
+    clr  r5
+    mov  r1, r3
+    sub  #558, r6
+    rts
+    sub  #748, r1
+    add  r5, r3
+    jsr  r6
+    rts
+    clr  r4
+    not  r1
+    clr  r6
+    red  r2
+    add  r0, r6
+    dec  r3
+    bne  r2
+    not  r3
+    add  r6, r3
+    add  r5, r2
+    mov  #564, r0
+    jsr  r3
+    cmp  r4, r4
+    mov  r3, r5
+    jsr  r0
+    rts
+    add  r3, r4
+    sub  #-1471, r7
+    dec  r1
+    dec  r6
+    sub  r4, r3
+    jsr  r0
+    not  r2
+    prn  #1647
+    rts
+    not  r3
+    clr  r4
+    red  r6
+    inc  r7
+    clr  r0
+    clr  r6
+    clr  r7
+    jsr  r6
+    add  #702, r7
+    clr  r5
+    cmp  r3, r7
+    jmp  r7
+    dec  r3
+    not  r7
+    jmp  r5
+    jsr  r5
+    prn  #K3
+    red  r2
+    bne  r6
+    mov  r1, r1
+    jsr  r4
+    mov  #346, r5
+    cmp  #-984, #K0
+    bne  r5
+    red  r4
+    red  r7
+    add  r0, r2
+    cmp  r3, #-440
+    clr  r2
+    clr  r5
+    prn  r3
+    sub  r4, r1
+    sub  #-1050, r5
+    hlt
+    inc  r0
+    clr  r0
+    dec  r7
+    inc  r5
+    jmp  r4
+    prn  #K2
+    rts
+    clr  r5
+    add  r4, r0
+    red  r1
+    bne  r2
+    bne  r0
+    red  r4
+    sub  r4, r4
+    not  r0
+    red  r6
+    jmp  r3
+    prn  r7
+    dec  r0
+    jsr  r0
+    cmp  #-1699, r1
+    prn  #K2
+    bne  r5
+    inc  r7
+    sub  #515, r5
+    clr  r1
+    sub  r4, r7
+    rts
+    not  r0
+    hlt
+    hlt
+    rts
+    bne  r5
+    dec  r1
+    sub  r7, r7
+    clr  r2
+    clr  r1
+    clr  r1
+    inc  r1
+    clr  r1
+    clr  r0
+    inc  r1
+    rts
+    rts
+    not  r0
+    not  r2
+    sub  #224, r3
+    not  r6
+    rts
+    rts
+    red  r7
+    dec  r3
+    red  r1
+    sub  #-1320, r6
+    dec  r7
+    red  r3
+    not  r6
+    inc  r7
+    rts
+    red  r4
+    cmp  r2, #-867
+    prn  r6
+    add  r7, r2
+    not  r2
+    rts
+    jsr  r1
+    red  r7
+    not  r7
+    clr  r2
+    prn  #K0
+    sub  r5, r3
+    jsr  r1
+    inc  r1
+    jmp  r7
+    add  #-1538, r4
+    sub  #-1101, r2
+    bne  r3
+    bne  r1
+    rts
+    dec  r6
+    hlt
+    not  r4
+    bne  r5
+    hlt
+    red  r6
+    cmp  #1855, r6
+    not  r4
+    bne  r3
+    jmp  r7
+    add  #866, r1
+    add  #1591, r4
+    dec  r3
+    add  r5, r1
+    add  #-540, r2
+    hlt
+    inc  r6
+    jsr  r5
+    jsr  r6
+    add  r3, r0
+    inc  r2
+    mov  #-890, r0
+    cmp  r0, #-1448
+    mov  r2, r6
+    jmp  r2
+    hlt
+    jsr  r6
+    jmp  r1
+    cmp  r5, #K0
+    dec  r3
+    dec  r5
+    clr  r1
+    rts
+    red  r0
+    bne  r6
+    inc  r7
+    clr  r2
+    sub  #-1631, r2
+    red  r4
+    mov  #-238, r2
+    hlt
+    cmp  #-1973, #K3
+    inc  r2
+    prn  r6
+    clr  r4
+    dec  r6
+    hlt
+    inc  r5
+    red  r6
+    rts
+    dec  r0
+    mov  r3, r5
+    hlt
+    hlt
+    red  r7
+    red  r7
+    prn  #K3
+    hlt
+    cmp  #980, r1
+    prn  #K1
+    prn  r5
+    jmp  r4
+    bne  r5
+    jmp  r7
+    hlt
+    add  r4, r2
+    jsr  r5
+    not  r4
+    inc  r0
+    add  #-1999, r0
+    red  r4
+    red  r1
+    rts
+    mov  r5, r5
+    red  r4
+    cmp  r3, #-902
+    jmp  r2
+    rts
+    add  r3, r1
+    inc  r3
+    not  r0
+    hlt
+    inc  r0
+    hlt
+    cmp  #1593, #35
+    dec  r0
+    red  r1
+    dec  r0
+    prn  r7
+    prn  #-230
+    prn  #-1869
+    clr  r0
+    prn  r7
+    jmp  r2
+    rts
+    jmp  r0
+    inc  r3
+    rts
+    dec  r6
+    clr  r2
+    sub  #-15, r1
+    jmp  r3
+    inc  r3
+    jsr  r0
+    hlt
+    inc  r6
+    cmp  #329, #K2
+    add  #-676, r4
+    not  r3
+    mov  #289, r0
+    add  r3, r4
+    prn  #K2
+    not  r5
+    red  r6
+    rts
+    bne  r4
+    jmp  r0
+    red  r7
+    mov  r5, r4
+    mov  #1389, r7
+    sub  #215, r0
+    not  r4
+    hlt
+    not  r0
+    red  r0
+    jmp  r2
+    inc  r2
+    hlt
+    add  #1463, r2
+    bne  r7
+    rts
+    add  #-1497, r3
+    sub  r1, r4
+    inc  r7
+    prn  r5
+    inc  r0
+    clr  r3
+    red  r3
+    jmp  r5
+    hlt
+    cmp  r3, r5
+    cmp  #-412, r7
+    hlt
+    mov  #-1101, r4
+    mov  #-1483, r2
+    jsr  r4
+    mov  r6, r4
+    not  r7
+    jsr  r0
+    prn  #988
+    jmp  r2
+    bne  r7
+    hlt
+    red  r3
+    prn  r7
+    clr  r7
+    hlt
+    cmp  #420, r3
+    not  r7
+    sub  #-985, r5
+    mov  #-1283, r7
+    mov  r2, r0
+    rts
+    sub  r3, r6
+    mov  r4, r7
+    cmp  r4, #K0
+    inc  r1
+    jmp  r5
+    sub  r6, r5
+    clr  r0
+    bne  r6
+    jsr  r0
+    bne  r1
+    red  r6
+    bne  r5
+    hlt
+    bne  r0
+    not  r4
+    bne  r7
+    clr  r6
+    jsr  r1
+    prn  r4
+    prn  #K0
+    sub  r7, r4
+    add  r2, r2
+    mov  r1, r7
+    clr  r1
+    red  r5
+    bne  r5
+    cmp  #-686, r1
+    inc  r4
+    jmp  r2
+    rts
+    not  r5
+    hlt
+    hlt
+    sub  #1612, r6
+    mov  #-1022, r1
+    jsr  r4
+    red  r5
+    bne  r3
+    rts
+    clr  r6
+    inc  r5
+    mov  #986, r7
+    not  r7
+    bne  r2
+    sub  r1, r0
+    sub  #36, r6
+    not  r0
+    prn  #K2
+    clr  r3
+    jsr  r1
+    bne  r1
+    jsr  r2
+    jsr  r4
+    add  #376, r7
+    jmp  r3
+    clr  r1
+    red  r0
+    add  r1, r3
+    sub  r5, r1
+    clr  r4
+    inc  r6
+    jsr  r7
+    prn  #777
+    jsr  r7
+    red  r7
+    rts
+    sub  r0, r2
+    mov  #1612, r2
+    mov  #-228, r4
+    cmp  r7, r2
+    rts
+    bne  r2
+    inc  r0
+    mov  #-1876, r5
+    clr  r7
+    not  r3
+    prn  #1565
+    inc  r5
+    jmp  r1
+    clr  r3
+    rts
+    jsr  r0
+    jmp  r1
+    mov  r6, r0
+    red  r3
+    hlt
+    prn  #K1
+    mov  #669, r1
+    inc  r0
+    inc  r2
+    prn  r1
+    rts
+    hlt
+    jmp  r5
+    not  r5
+    hlt
+    hlt
+    clr  r6
+    hlt
+    rts
+    mov  r7, r1
+    sub  r3, r3
+    hlt
+    cmp  #1023, #-1907
+    hlt
+    rts
+    dec  r4
+    not  r6
+    clr  r4
+    add  r3, r0
+    dec  r1
+    dec  r1
+    bne  r1
+    prn  r2
+    add  r5, r2
+    mov  #-323, r6
+    clr  r1
+    hlt
+    sub  r1, r0
+    hlt
+    prn  r3
+    prn  #K2
+    cmp  #1463, #814
+    sub  #1480, r0
+    mov  r0, r5
+    mov  r0, r7
+    prn  #K3
+    jsr  r1
+    inc  r4
+    not  r5
+    bne  r4
+    inc  r3
+    prn  r2
+    cmp  r1, r0
+    prn  r3
+    prn  r4
+    prn  #1536
+    rts
+    cmp  #-302, r3
+    mov  #-1926, r4
+    not  r0
+    red  r4
+    inc  r1
+    jmp  r6
+    jmp  r1
+    not  r6
+    bne  r5
+    rts
+    red  r2
+    sub  #1323, r3
+    jsr  r5
+    sub  r5, r6
+    jmp  r0
+    jmp  r1
+    sub  #-812, r6
+    cmp  #1767, #-1529
+    clr  r1
+    red  r3
+    red  r2
+    jsr  r6
+    cmp  #-647, r3
+    jsr  r1
+    clr  r0
+    hlt
+    prn  r4
+    hlt
+    jmp  r1
+    dec  r0
+    prn  r0
+    add  r6, r2
+    bne  r1
+    mov  #1048, r1
+    prn  r0
+    clr  r6
+    jsr  r3
+    cmp  r7, r3
+    prn  r6
+    clr  r6
+    cmp  r2, #44
+    not  r6
+    bne  r0
+    bne  r7
+    prn  r2
+    sub  r1, r2
+    sub  r4, r1
+    clr  r3
+    bne  r2
+    red  r3
+    bne  r4
+    dec  r5
+    not  r4
+    red  r1
+    jmp  r7
+    clr  r1
+    cmp  r4, r2
+    add  r2, r4
+    add  #-15, r2
+    red  r0
+    add  r6, r1
+    dec  r4
+    mov  #274, r6
+    rts
+    hlt
+    red  r1
+    dec  r7
+    mov  r0, r4
+    mov  r4, r4
+    mov  r5, r1
+    bne  r1
+    add  #1724, r3
+    inc  r4
+    sub  #-592, r0
+    red  r5
+    mov  #-15, r0
+    cmp  #-722, #1225
+    mov  #-86, r5
+    sub  r6, r5
+    not  r7
+    inc  r3
+    add  #-807, r4
+    sub  #1052, r0
+    bne  r4
+    bne  r1
+    mov  #163, r5
+    rts
+    jmp  r0
+    rts
+    jmp  r1
+    cmp  r7, #K1
+    cmp  r1, r5
+    add  r6, r2
+    jsr  r4
+    mov  r5, r7
+    hlt
+    jmp  r3
+    cmp  #1311, #1258
+    sub  r3, r7
+    inc  r3
+    bne  r3
+    rts
+    bne  r6
+    dec  r4
+    jsr  r4
+    dec  r6
+    cmp  r1, r3
+    not  r1
+    clr  r1
+    not  r7
+    clr  r3
+    mov  r0, r1
+    not  r4
+    add  r7, r1
+    inc  r5
+    prn  #-6
+    inc  r0
+    cmp  #-1080, #K1
+    clr  r1
+    sub  #1443, r0
+    jmp  r1
+    jmp  r2
+    jmp  r3
+    cmp  r2, #-54
+    prn  r3
+    hlt
+    hlt
+    jsr  r3
+    prn  r0
+    inc  r7
+    red  r0
+    inc  r2
+    mov  #-1167, r2
+    mov  r2, r0
+    cmp  #542, #K3
+    mov  #278, r7
+    rts
+    prn  #K0
+    clr  r4
+    hlt
+    inc  r4
+endmcr
+mcr m2
+    rts
+    clr  r6
+    mov  #-1297, r7
+    bne  r6
+    jmp  r1
+    mov  r4, r7
+    red  r3
+    dec  r7
+    dec  r2
+    bne  r5
+    jsr  r2
+    prn  r7
+    red  r1
+    sub  r4, r4
+    prn  r3
+    not  r4
+    hlt
+    jmp  r5
+    sub  #-783, r0
+    jsr  r7
+    dec  r0
+    cmp  r7, #1132
+    bne  r3
+    rts
+    mov  r4, r3
+    inc  r5
+    clr  r3
+    clr  r1
+    mov  #432, r2
+    add  r2, r1
+    jsr  r4
+    hlt
+    red  r1
+    not  r2
+    bne  r1
+    clr  r4
+    clr  r0
+    jsr  r3
+    add  r1, r4
+    prn  r1
+    sub  r1, r7
+    hlt
+    inc  r6
+    jmp  r2
+    jsr  r6
+    rts
+    jsr  r7
+    dec  r5
+    jmp  r0
+    sub  #1581, r3
+    clr  r3
+    prn  r6
+    prn  r2
+    not  r7
+    add  r3, r7
+    prn  r2
+    hlt
+    clr  r3
+    inc  r6
+    add  r3, r7
+    add  #934, r4
+    hlt
+    red  r5
+    jsr  r0
+    cmp  r2, r2
+    hlt
+    bne  r0
+    clr  r1
+    rts
+    hlt
+    cmp  r5, #K2
+    hlt
+    not  r1
+    inc  r2
+    hlt
+    rts
+    inc  r1
+    cmp  r0, r6
+    not  r3
+    jmp  r5
+    clr  r3
+    cmp  r6, #-154
+    jsr  r0
+    rts
+    cmp  #1111, #K3
+    rts
+    not  r6
+    not  r1
+    clr  r3
+    dec  r0
+    rts
+    red  r7
+    mov  r2, r6
+    not  r0
+    rts
+    prn  #K2
+    red  r7
+    sub  #916, r5
+    clr  r6
+    bne  r2
+    dec  r0
+    prn  r6
+    hlt
+    hlt
+    jsr  r6
+    mov  r0, r3
+    add  r1, r5
+    cmp  #1321, #K3
+    add  #1708, r1
+    add  r7, r5
+    red  r2
+    hlt
+    prn  #K1
+    jsr  r6
+    sub  r2, r6
+    jsr  r5
+    clr  r3
+    jmp  r4
+    add  r2, r5
+    mov  r3, r1
+    sub  r6, r6
+    rts
+    mov  #1893, r0
+    hlt
+    mov  #-154, r0
+    jsr  r5
+    prn  #-1287
+    add  r2, r4
+    clr  r5
+    hlt
+    jsr  r0
+    mov  r5, r7
+    add  #-194, r3
+    rts
+    sub  #1468, r1
+    add  r1, r3
+    red  r5
+    jsr  r6
+    rts
+    clr  r3
+    cmp  r3, r7
+    hlt
+    dec  r2
+    jsr  r2
+    not  r1
+    not  r4
+    clr  r3
+    add  #-1544, r7
+    mov  r1, r0
+    bne  r4
+    jmp  r3
+    not  r5
+    cmp  #-963, #K2
+    cmp  r6, r3
+    clr  r0
+    cmp  #-1939, #-343
+    mov  r6, r6
+    sub  #294, r5
+    jsr  r2
+    prn  #-545
+    rts
+    not  r3
+    jmp  r1
+    hlt
+    clr  r4
+    jsr  r7
+    inc  r6
+    add  r7, r1
+    red  r6
+    red  r3
+    red  r7
+    jmp  r5
+    bne  r5
+    prn  #K3
+    red  r1
+    rts
+    mov  #427, r4
+    sub  #-1942, r0
+    dec  r0
+    jmp  r3
+    add  r7, r3
+    add  r2, r4
+    cmp  #-274, #-1432
+    inc  r6
+    bne  r4
+    clr  r4
+    jmp  r3
+    sub  r4, r7
+    sub  #-842, r2
+    dec  r7
+    inc  r4
+    rts
+    dec  r0
+    not  r0
+    mov  r4, r5
+    prn  #K2
+    rts
+    clr  r4
+    hlt
+    add  r0, r2
+    red  r3
+    not  r4
+    not  r1
+    sub  #-1430, r6
+    dec  r4
+    jsr  r7
+    dec  r0
+    rts
+    add  #-511, r7
+    cmp  #-467, r1
+    prn  #K2
+    bne  r5
+    add  r0, r1
+    red  r0
+    sub  r3, r5
+    rts
+    jmp  r7
+    rts
+    bne  r5
+    dec  r1
+    sub  r7, r7
+    clr  r0
+    dec  r1
+    clr  r1
+    inc  r4
+    cmp  #-1576, #901
+    inc  r4
+    inc  r0
+    not  r2
+    sub  #1563, r1
+    cmp  r0, #K0
+    jsr  r6
+    rts
+    rts
+    red  r6
+    bne  r6
+    red  r7
+    mov  r1, r7
+    bne  r3
+    clr  r3
+    hlt
+    rts
+    prn  #K2
+    red  r1
+    not  r5
+    rts
+    inc  r5
+    inc  r3
+    rts
+    add  r7, r0
+    not  r2
+    red  r4
+    add  r0, r3
+    bne  r7
+    not  r3
+    add  r4, r3
+    red  r3
+    add  #828, r4
+    clr  r4
+    sub  #881, r7
+    add  r4, r2
+    bne  r5
+    prn  r2
+    bne  r4
+    sub  r2, r0
+    mov  #1016, r5
+    rts
+    hlt
+    not  r4
+    bne  r5
+    hlt
+    red  r7
+    bne  r1
+    sub  #-56, r7
+    dec  r1
+    jsr  r0
+    mov  #-1241, r4
+    dec  r6
+    hlt
+    add  r5, r1
+    add  r2, r0
+    prn  #1271
+    hlt
+    add  r5, r6
+    jsr  r2
+    not  r6
+    dec  r5
+    add  r0, r3
+    jsr  r0
+    hlt
+    jsr  r6
+    jmp  r1
+    cmp  r5, #K0
+    dec  r6
+    cmp  #1048, r6
+    bne  r6
+    inc  r3
+    bne  r1
+    red  r1
+    prn  #K0
+    add  #-988, r7
+    hlt
+    clr  r1
+    jsr  r0
+    red  r3
+    dec  r3
+    jmp  r4
+    prn  r7
+    jmp  r5
+    hlt
+    jmp  r6
+    clr  r6
+    jsr  r6
+    hlt
+    inc  r5
+    inc  r3
+    jmp  r6
+    rts
+    dec  r2
+    bne  r4
+    inc  r7
+    jsr  r2
+    hlt
+    red  r6
+    rts
+    clr  r5
+    bne  r7
+    prn  #K3
+    hlt
+    prn  #-1673
+    rts
+    jmp  r3
+    add  #-303, r4
+    cmp  #297, #K1
+    inc  r3
+    dec  r1
+    red  r1
+    jsr  r5
+    jmp  r7
+    hlt
+    add  r5, r4
+    not  r2
+    hlt
+    sub  #1362, r1
+    jmp  r6
+    dec  r5
+    add  r2, r0
+    mov  #1303, r1
+    clr  r3
+    cmp  #-1895, #K1
+    bne  r3
+    sub  #-1734, r3
+    cmp  r7, r3
+    clr  r3
+    not  r3
+    clr  r1
+    add  #105, r3
+    dec  r0
+    red  r6
+    inc  r0
+    jsr  r5
+    jmp  r0
+    prn  r7
+    jmp  r2
+    jmp  r6
+    jmp  r0
+    inc  r7
+    sub  r6, r0
+    jsr  r4
+    jsr  r4
+    bne  r7
+    cmp  #149, #-1879
+    sub  r5, r4
+    sub  #886, r7
+    cmp  #-935, #K2
+    add  r3, r3
+    prn  #K0
+    jmp  r3
+    mov  #-751, r2
+    add  r3, r6
+    prn  #K2
+    not  r5
+    red  r1
+    rts
+    red  r3
+    rts
+    not  r5
+    jsr  r0
+    mov  r7, r2
+    add  #798, r0
+    dec  r6
+    dec  r5
+    sub  #-1656, r6
+    bne  r1
+    add  #1703, r2
+    bne  r7
+    rts
+    add  #1847, r3
+    sub  #1631, r6
+    cmp  r7, #129
+    bne  r1
+    jsr  r4
+    jsr  r5
+    inc  r5
+    prn  r3
+    bne  r1
+    not  r1
+    inc  r1
+    mov  r7, r5
+    mov  #1668, r5
+    sub  #-667, r2
+    jsr  r4
+    mov  r2, r4
+    rts
+    red  r5
+    cmp  r4, #K0
+    jmp  r2
+    bne  r7
+    hlt
+    red  r6
+    inc  r7
+    jsr  r4
+    cmp  r7, r7
+    cmp  #-1548, r3
+    not  r7
+    jmp  r5
+    mov  r2, r0
+    jmp  r2
+    inc  r5
+    mov  r6, r1
+    dec  r0
+    inc  r7
+    jmp  r7
+    clr  r4
+    inc  r7
+    rts
+    red  r0
+    add  r1, r7
+    jmp  r5
+    sub  r6, r5
+    clr  r1
+    cmp  #335, #K3
+    not  r1
+    red  r3
+    dec  r4
+    bne  r7
+    clr  r7
+    red  r6
+    sub  r2, r3
+    sub  #-1759, r3
+    clr  r0
+    not  r7
+    inc  r3
+    jmp  r5
+    add  #1559, r1
+    rts
+    dec  r3
+    rts
+    hlt
+    mov  r1, r1
+    jmp  r6
+    mov  #129, r7
+    bne  r1
+    add  r7, r2
+    sub  #-1456, r4
+    hlt
+    bne  r4
+    jmp  r4
+    add  #-21, r6
+    not  r4
+    clr  r3
+    rts
+    clr  r1
+    rts
+    sub  r4, r4
+    bne  r1
+    bne  r2
+    inc  r0
+    not  r3
+    dec  r3
+    mov  #-1413, r4
+    cmp  r4, #-430
+    add  #872, r7
+    jmp  r3
+    clr  r3
+    cmp  #-810, r5
+    red  r5
+    clr  r4
+    inc  r5
+    mov  #-1357, r4
+    jmp  r6
+    red  r2
+    cmp  #-1026, r0
+    red  r1
+    add  #-1486, r1
+    not  r3
+    bne  r3
+    hlt
+    rts
+    bne  r2
+    inc  r0
+    jsr  r5
+    jmp  r0
+    clr  r4
+    dec  r1
+    mov  r3, r1
+    red  r0
+    jmp  r1
+    mov  r6, r3
+    red  r1
+    add  #493, r5
+    inc  r4
+    sub  r5, r7
+    not  r4
+    clr  r7
+    hlt
+    clr  r1
+    rts
+    bne  r6
+    mov  r7, r5
+    sub  r0, r1
+    rts
+    sub  r7, r3
+    cmp  #-1073, #1405
+    hlt
+    rts
+    dec  r4
+    not  r5
+    not  r5
+    not  r3
+    dec  r2
+    mov  #486, r6
+    not  r1
+    clr  r0
+    sub  #70, r2
+    prn  #K2
+    not  r1
+    clr  r1
+    prn  r2
+    add  #-532, r2
+    jmp  r2
+    bne  r5
+    mov  #1414, r0
+    hlt
+    red  r6
+    add  #1201, r4
+    hlt
+    sub  #-1045, r7
+    sub  #-347, r1
+    rts
+    mov  r0, r3
+    prn  #K1
+    inc  r7
+    dec  r2
+    hlt
+    hlt
+    dec  r2
+    mov  r4, r5
+    not  r0
+    clr  r7
+    prn  r2
+    mov  r0, r2
+    sub  #963, r4
+    mov  r3, r1
+    rts
+    dec  r7
+    add  #-822, r2
+    not  r3
+    mov  r1, r0
+    not  r4
+    rts
+    bne  r6
+    prn  r2
+    rts
+    cmp  r7, r0
+    red  r0
+    red  r3
+    red  r5
+    jmp  r0
+    jmp  r1
+    sub  #-1983, r4
+    dec  r2
+    mov  #-1823, r5
+    cmp  r1, r5
+    sub  #1906, r0
+    jsr  r6
+    cmp  #1193, r3
+    jsr  r1
+    clr  r1
+    jsr  r4
+    inc  r1
+    jsr  r0
+    clr  r6
+    inc  r2
+    hlt
+    red  r3
+    red  r3
+    inc  r3
+    hlt
+    sub  #-1643, r3
+    prn  r2
+    not  r6
+    bne  r0
+    bne  r7
+    prn  r2
+    sub  r1, r4
+    sub  r4, r2
+    clr  r2
+    rts
+    sub  #291, r3
+    jsr  r3
+    bne  r4
+    dec  r4
+    rts
+    prn  r0
+    sub  #1129, r6
+    bne  r1
+    cmp  r4, r2
+    add  #-1701, r2
+    add  #642, r2
+    rts
+    jsr  r6
+    mov  #-1982, r4
+    hlt
+    jsr  r3
+    not  r7
+    prn  #K0
+    add  r3, r0
+    cmp  #-1384, #-569
+    jmp  r0
+    bne  r0
+    dec  r7
+    mov  r6, r7
+    hlt
+    rts
+    inc  r4
+    mov  r5, r3
+    cmp  #67, r5
+    bne  r7
+    inc  r4
+    jsr  r5
+    rts
+    bne  r3
+    red  r2
+    dec  r6
+    sub  #-1490, r5
+    jmp  r0
+    inc  r0
+    dec  r1
+    jmp  r5
+    bne  r6
+    cmp  #-322, #-391
+    mov  r0, r0
+    add  r7, r6
+    inc  r7
+    jsr  r2
+    red  r0
+    mov  #348, r4
+    prn  #K3
+    jmp  r5
+    not  r7
+    jsr  r1
+    add  r6, r2
+    jsr  r4
+    mov  r7, r6
+    cmp  r1, r5
+    clr  r1
+    cmp  #-849, #570
+    sub  r3, r7
+    bne  r3
+    rts
+    rts
+    dec  r6
+    mov  r6, r5
+    cmp  r1, r3
+    not  r4
+    jmp  r1
+    clr  r1
+    hlt
+    clr  r1
+    hlt
+    dec  r3
+    inc  r4
+    add  r4, r7
+    clr  r3
+    jsr  r4
+    hlt
+    bne  r2
+    inc  r1
+    mov  #249, r6
+    clr  r1
+    mov  #-1140, r3
+    sub  r5, r5
+    sub  r3, r0
+    cmp  r2, #58
+    prn  r3
+    hlt
+    hlt
+    jsr  r3
+    prn  r0
+    inc  r5
+    dec  r1
+    bne  r3
+    bne  r0
+    dec  r1
+    mov  #-658, r7
+    mov  r4, r3
+    jsr  r7
+    cmp  #578, #K1
+    dec  r4
+    prn  #K1
+    cmp  #1247, r6
+    rts
+    rts
+    jmp  r1
+    mov  r7, r3
+    prn  r5
+    red  r7
+    dec  r0
+    bne  r5
+    jsr  r2
+    prn  r7
+    red  r0
+    not  r1
+    sub  r0, r0
+    add  #510, r4
+    red  r4
+    dec  r4
+    hlt
+    jmp  r5
+    sub  #1150, r0
+    rts
+    jsr  r6
+    rts
+    hlt
+    prn  r5
+    dec  r0
+    dec  r2
+    not  r3
+    rts
+    mov  #-1561, r3
+    prn  #K2
+    mov  r5, r5
+    mov  #-352, r0
+    add  r2, r1
+    jsr  r4
+    hlt
+    red  r6
+    cmp  #647, #-679
+    jmp  r7
+    add  r4, r3
+    clr  r7
+    dec  r0
+    jsr  r3
+    add  #-1939, r1
+    jsr  r1
+    sub  r4, r7
+    prn  #K3
+    add  r7, r6
+    dec  r5
+    jsr  r0
+    jsr  r4
+    prn  r0
+    sub  #1341, r3
+    clr  r3
+    prn  r6
+    prn  r2
+    add  r3, r7
+    prn  r2
+    hlt
+    clr  r3
+    inc  r6
+    add  r3, r7
+    add  r3, r4
+    hlt
+    cmp  r2, #-1240
+    cmp  r2, r2
+    jsr  r0
+    clr  r6
+    inc  r2
+    add  r4, r5
+    rts
+    jsr  r0
+    cmp  r6, r1
+    bne  r6
+    inc  r1
+    cmp  r0, r6
+    not  r1
+    mov  r4, r0
+    hlt
+    red  r5
+    clr  r3
+    cmp  r6, #-1834
+    jsr  r0
+    rts
+    cmp  #-1881, #K3
+    rts
+    not  r2
+    prn  #K3
+    dec  r1
+    sub  r6, r0
+    add  r2, r5
+    not  r2
+    not  r4
+    hlt
+    sub  #-906, r1
+    inc  r2
+    sub  r7, r7
+    jsr  r6
+    mov  r3, r3
+    inc  r2
+    hlt
+    dec  r2
+    prn  #K2
+    add  #-1676, r1
+    dec  r4
+    cmp  #-861, #K1
+    prn  r4
+    not  r2
+    jsr  r6
+    jsr  r6
+    sub  r2, r6
+    jsr  r5
+    clr  r1
+    prn  r4
+    add  r2, r2
+    mov  r0, r3
+    red  r6
+    inc  r4
+    dec  r6
+    mov  #533, r7
+    mov  #502, r0
+    jsr  r5
+    prn  #1897
+    add  r2, r4
+    clr  r2
+    clr  r5
+    mov  r5, r7
+    add  #1486, r6
+    rts
+    sub  #1132, r1
+    add  r3, r7
+    jsr  r1
+    red  r5
+    jsr  r6
+    rts
+    clr  r7
+    not  r7
+    sub  r7, r7
+    bne  r6
+    cmp  #-1098, r0
+    sub  #-1644, r2
+    dec  r2
+    prn  #K1
+    red  r3
+    inc  r6
+    clr  r0
+    dec  r5
+    jsr  r2
+    mov  #1565, r5
+    red  r2
+    inc  r4
+    mov  #-1026, r1
+    add  r3, r5
+    sub  #-345, r0
+    jmp  r0
+    red  r6
+    sub  #-1708, r6
+    cmp  #-507, #961
+    hlt
+    rts
+    not  r1
+    add  #-1154, r7
+    clr  r1
+    inc  r3
+    red  r0
+    mov  #1386, r7
+    red  r2
+    bne  r6
+    mov  r1, r1
+    jsr  r4
+    mov  #-1766, r5
+    cmp  #-1784, #K0
+    bne  r5
+    red  r2
+    bne  r7
+    add  r2, r4
+    cmp  #-1762, #88
+    inc  r4
+    jmp  r3
+    sub  r4, r1
+    sub  #-99, r6
+    rts
+    dec  r0
+    bne  r7
+    mov  #-848, r2
+    red  r7
+    not  r4
+    bne  r0
+    jsr  r4
+    hlt
+    add  #-1877, r3
+    bne  r2
+    jmp  r0
+    red  r4
+    cmp  #269, r4
+    mov  #-1670, r3
+    dec  r7
+    bne  r2
+    mov  #734, r5
+    add  r1, r1
+    prn  #K2
+    add  #-1428, r6
+    rts
+    red  r6
+    add  #-743, r3
+    sub  r2, r7
+    jsr  r5
+    bne  r5
+    red  r5
+    cmp  r1, r0
+    red  r4
+    prn  #815
+    rts
+    bne  r5
+    dec  r1
+    red  r3
+    sub  #836, r0
+    sub  r3, r2
+    not  r4
+    jmp  r0
+    dec  r7
+    cmp  #-1797, #-687
+    dec  r2
+    add  #-174, r2
+    sub  #-1013, r7
+    cmp  r0, #K0
+    jsr  r6
+    rts
+    rts
+    red  r7
+    dec  r2
+    red  r7
+    mov  r3, r6
+    clr  r7
+    rts
+    prn  #K2
+    red  r5
+    rts
+    inc  r7
+    rts
+    red  r1
+    prn  #-259
+    add  #-453, r2
+    rts
+    add  r4, r3
+    red  r3
+    jsr  r3
+    jmp  r0
+    bne  r7
+    not  r3
+    prn  r5
+    jsr  r2
+    hlt
+    prn  #K1
+    prn  #1768
+    red  r5
+    jsr  r1
+    inc  r4
+    cmp  r4, r2
+    bne  r5
+    prn  r2
+    bne  r4
+    sub  #-774, r2
+    hlt
+    red  r7
+    bne  r1
+    sub  #-186, r4
+    prn  #K2
+    mov  r1, r7
+    dec  r7
+    add  #1825, r0
+    jsr  r0
+    mov  r6, r7
+    inc  r1
+    sub  r3, r2
+    add  r5, r5
+    add  #603, r1
+    add  r7, r7
+    add  r5, r5
+    jsr  r2
+    not  r5
+    rts
+    rts
+    dec  r5
+    add  #1510, r0
+    cmp  r0, #1240
+    mov  r5, r7
+    add  #-673, r3
+    cmp  r5, #K0
+endmcr
+mcr m3
+    dec  r2
+    jsr  r6
+    cmp  #-728, r6
+    bne  r6
+    inc  r7
+    clr  r0
+    dec  r1
+    red  r0
+    not  r1
+    not  r7
+    cmp  #1739, #K3
+    hlt
+    jmp  r6
+    clr  r0
+    rts
+    jsr  r6
+    hlt
+    inc  r5
+    red  r2
+    bne  r4
+    inc  r0
+    inc  r7
+    red  r7
+    red  r7
+    red  r2
+    jsr  r7
+    prn  #K3
+    hlt
+    rts
+    jmp  r3
+    add  r1, r6
+    prn  #K1
+    cmp  #-1895, #K1
+    inc  r5
+    jmp  r0
+    prn  r7
+    jmp  r4
+    bne  r5
+    jmp  r7
+    hlt
+    add  #-9, r4
+    add  r3, r2
+    mov  #-80, r2
+    jsr  r5
+    add  #1355, r0
+    cmp  #807, r1
+    clr  r5
+    red  r4
+    cmp  r3, #1626
+    jmp  r2
+    rts
+    add  r7, r3
+    inc  r7
+    mov  r3, r7
+    clr  r2
+    dec  r3
+    add  #-1184, r1
+    dec  r6
+    dec  r6
+    mov  r1, r7
+    prn  #K0
+    rts
+    jsr  r4
+    bne  r7
+    cmp  #-603, #1689
+    sub  r5, r4
+    sub  #-1422, r6
+    add  #1993, r5
+    add  #-656, r3
+    prn  #-1189
+    sub  #826, r7
+    not  r2
+    red  r6
+    sub  #-969, r4
+    cmp  #-1608, r0
+    inc  r5
+    jsr  r0
+    mov  #-1578, r2
+    not  r6
+    dec  r3
+    sub  r4, r0
+    jsr  r5
+    bne  r3
+    jsr  r0
+    mov  #1560, r6
+    bne  r1
+    add  #-201, r2
+    bne  r7
+    rts
+    add  #79, r6
+    cmp  r7, #1841
+    bne  r1
+    jsr  r4
+    jsr  r5
+    inc  r0
+    clr  r6
+    not  r4
+    clr  r7
+    cmp  r3, r5
+    cmp  #740, r7
+    sub  #-859, r1
+    cmp  #859, #K3
+    mov  #821, r5
+    jsr  r4
+    mov  r6, r4
+    not  r2
+    rts
+    red  r7
+    jsr  r0
+    prn  #-868
+    jmp  r2
+    bne  r7
+    hlt
+    red  r2
+    clr  r2
+    inc  r1
+    jsr  r3
+    bne  r3
+    inc  r5
+    clr  r7
+    mov  r2, r2
+    inc  r1
+    rts
+    hlt
+    inc  r0
+    rts
+    bne  r7
+    clr  r4
+    dec  r1
+    inc  r3
+    dec  r1
+    dec  r5
+    jsr  r3
+    jmp  r6
+    clr  r1
+    red  r7
+    dec  r1
+    cmp  #-321, #K3
+    not  r3
+    mov  r1, r6
+    red  r3
+    jsr  r4
+    rts
+    rts
+    sub  #1096, r4
+    mov  r7, r4
+    add  #-1017, r0
+    rts
+    clr  r6
+    not  r0
+    mov  r0, r6
+    bne  r5
+    cmp  #-782, r1
+    inc  r2
+    not  r2
+    rts
+    not  r2
+    jsr  r7
+    sub  #-852, r6
+    mov  r4, r2
+    jmp  r4
+    add  #-197, r5
+    not  r4
+    prn  r6
+    clr  r6
+    red  r2
+    clr  r0
+    red  r0
+    add  #-1306, r2
+    jmp  r2
+    jsr  r2
+    dec  r3
+    red  r1
+    sub  #1892, r7
+    not  r2
+    rts
+    dec  r0
+    mov  #1104, r3
+    red  r2
+    clr  r5
+    prn  r2
+    jsr  r4
+    add  r3, r0
+    clr  r3
+    clr  r3
+    bne  r1
+    mov  r2, r2
+    red  r7
+    cmp  r5, r5
+    clr  r2
+    not  r6
+    inc  r2
+    cmp  #-1874, r0
+    red  r2
+    rts
+    jmp  r4
+    add  #-1807, r0
+    sub  r5, r2
+    dec  r1
+    bne  r0
+    clr  r1
+    clr  r5
+    inc  r5
+    jmp  r1
+    clr  r5
+    rts
+    hlt
+    dec  r0
+    hlt
+    cmp  r6, #-56
+    red  r3
+    hlt
+    prn  #K1
+    mov  #-1331, r1
+    jmp  r4
+    jsr  r6
+    prn  #-1107
+    sub  #899, r2
+    cmp  r5, r1
+    not  r5
+    not  r6
+    jsr  r7
+    clr  r6
+    bne  r6
+    mov  r7, r5
+    sub  r0, r1
+    rts
+    sub  #-737, r3
+    hlt
+    rts
+    dec  r4
+    add  #1810, r5
+    not  r7
+    sub  #1814, r0
+    not  r0
+    sub  #-394, r2
+    prn  #K2
+    not  r3
+    bne  r1
+    prn  r2
+    add  #-836, r7
+    jmp  r2
+    bne  r5
+    mov  #-586, r0
+    hlt
+    red  r2
+    jsr  r5
+    not  r3
+    red  r1
+    hlt
+    prn  r3
+    prn  #K2
+    cmp  #663, #-594
+    sub  #-1336, r0
+    mov  r0, r5
+    mov  #-1976, r4
+    sub  #660, r4
+    add  r4, r0
+    inc  r0
+    sub  r0, r2
+    sub  r4, r3
+    jmp  r4
+    prn  #-160
+    rts
+    cmp  #-782, r3
+    mov  #-315, r7
+    bne  r7
+    mov  #-1962, r0
+    bne  r0
+    jmp  r1
+    red  r1
+    hlt
+    mov  #187, r2
+    jsr  r3
+    mov  r5, r1
+    inc  r7
+    jsr  r3
+    dec  r5
+    prn  #-74
+    cmp  #-807, r3
+    jsr  r1
+    clr  r5
+    mov  #-1343, r7
+    jmp  r0
+    prn  r0
+    add  #-54, r7
+    red  r3
+    jmp  r4
+    dec  r6
+    jmp  r0
+    jsr  r3
+    cmp  r7, r3
+    prn  r6
+    clr  r6
+    cmp  r2, #-1524
+    not  r6
+    bne  r0
+    bne  r7
+    prn  r2
+    sub  r1, r4
+    sub  r4, r2
+    clr  r2
+    red  r5
+    sub  #-1554, r5
+    prn  r0
+    sub  r7, r5
+    clr  r7
+    bne  r3
+    not  r5
+    not  r3
+    add  r2, r0
+    dec  r6
+    jsr  r6
+    mov  #1382, r7
+    prn  r5
+    inc  r4
+    hlt
+    add  r4, r0
+    mov  #1846, r2
+    rts
+    dec  r7
+    red  r7
+    bne  r0
+    dec  r5
+    dec  r0
+    not  r0
+    inc  r6
+    inc  r3
+    not  r3
+    add  r5, r3
+    cmp  #1427, r5
+    bne  r7
+    inc  r3
+    prn  r3
+    clr  r2
+    jmp  r4
+    jsr  r5
+    rts
+    bne  r3
+    red  r5
+    bne  r6
+    sub  #-1282, r5
+    jmp  r0
+    inc  r1
+    inc  r5
+    bne  r6
+    cmp  #1902, #1481
+    mov  #-1398, r7
+    sub  r6, r0
+    not  r7
+    not  r5
+    hlt
+    add  #-704, r4
+    prn  #-1149
+    not  r4
+    dec  r4
+    bne  r4
+    bne  r1
+    mov  #1059, r5
+    rts
+    jmp  r0
+    rts
+    jmp  r1
+    cmp  r7, #K1
+    cmp  r1, r5
+    add  r6, r2
+    jsr  r4
+    mov  r5, r7
+    hlt
+    jmp  r3
+    cmp  #1759, #522
+    sub  r5, r0
+    jmp  r3
+    inc  r6
+    jsr  r2
+    jsr  r4
+    prn  r7
+    rts
+    cmp  #1886, #K0
+    mov  r6, r0
+    cmp  r1, r3
+    not  r4
+    jmp  r1
+    clr  r1
+    not  r5
+    rts
+    red  r1
+    jmp  r7
+    cmp  #-383, #K2
+    clr  r3
+    not  r5
+    prn  #-6
+    inc  r0
+    cmp  #584, #K1
+    clr  r0
+    jmp  r2
+    dec  r6
+    dec  r2
+    red  r3
+    jmp  r0
+    cmp  #869, r3
+    bne  r2
+    prn  r3
+    hlt
+    hlt
+    jsr  r3
+    prn  r0
+    inc  r7
+    red  r1
+    bne  r3
+    bne  r0
+    dec  r6
+    hlt
+    cmp  #-1029, #K0
+    hlt
+    not  r5
+    red  r4
+    hlt
+    inc  r4
+    rts
+    clr  r4
+    add  #-1548, r4
+    jsr  r7
+    rts
+    rts
+    prn  r7
+    jmp  r0
+    jmp  r0
+    jsr  r7
+    inc  r3
+    clr  r0
+    inc  r0
+    rts
+    jmp  r5
+    jsr  r2
+    prn  r7
+    red  r3
+    red  r7
+    mov  r4, r4
+    prn  r3
+    not  r6
+    rts
+    prn  #1481
+    cmp  #848, r0
+    rts
+    hlt
+    rts
+    jsr  r6
+    rts
+    hlt
+    prn  r5
+    dec  r7
+    dec  r0
+    dec  r7
+    prn  r7
+    bne  r3
+    rts
+    mov  #331, r4
+    red  r1
+    prn  #-772
+    clr  r0
+    cmp  #80, #K2
+    add  r2, r1
+    cmp  #1911, #9
+    jmp  r7
+    add  #-1387, r7
+    red  r7
+    dec  r0
+    jsr  r3
+    add  r5, r7
+    hlt
+    sub  r4, r7
+    prn  #K3
+    add  #-1699, r5
+    jmp  r0
+    sub  #1773, r3
+    clr  r4
+    dec  r4
+    rts
+    hlt
+    clr  r4
+    cmp  r7, r2
+    inc  r6
+    hlt
+    bne  r5
+    sub  r5, r3
+    rts
+    add  r3, r7
+    add  #1670, r4
+    hlt
+    red  r5
+    dec  r2
+    red  r1
+    red  r7
+    bne  r0
+    clr  r6
+    inc  r2
+    cmp  r4, r5
+    rts
+    jsr  r0
+    cmp  r6, r1
+    bne  r6
+    inc  r0
+    not  r1
+    mov  #1855, r7
+    red  r2
+    dec  r5
+    jmp  r6
+    jsr  r0
+    rts
+    cmp  #1015, #K3
+    rts
+    not  r6
+    bne  r5
+    add  r0, r2
+    add  r0, r3
+    red  r2
+    not  r0
+    rts
+    prn  #K2
+    red  r5
+    prn  r3
+    red  r7
+    bne  r2
+    sub  #1388, r7
+    hlt
+    rts
+    hlt
+    hlt
+    hlt
+    clr  r6
+    clr  r0
+    bne  r0
+    jmp  r1
+    bne  r7
+    inc  r6
+    bne  r6
+    clr  r4
+    sub  r6, r2
+    jsr  r6
+    sub  r2, r6
+    jsr  r5
+    clr  r4
+    add  r4, r6
+    add  r2, r1
+    mov  r3, r1
+    sub  #860, r6
+    prn  #K2
+    mov  #1684, r5
+    dec  r6
+    sub  r1, r0
+    add  r2, r4
+    clr  r7
+    jsr  r0
+    mov  r1, r3
+    sub  #1598, r6
+    rts
+    sub  #956, r1
+    add  r3, r2
+    jsr  r1
+    red  r5
+    add  #-517, r6
+    hlt
+    not  r3
+    cmp  r3, r7
+    hlt
+    mov  r2, r3
+    jsr  r2
+    not  r1
+    not  r4
+    jmp  r2
+    jsr  r7
+    mov  #-1491, r5
+    red  r3
+    not  r5
+    hlt
+    sub  #-1475, r0
+    cmp  r6, r3
+    clr  r0
+    jsr  r6
+    sub  #305, r0
+    bne  r1
+    not  r1
+    clr  r1
+    red  r3
+    not  r3
+    inc  r4
+    sub  #-1897, r6
+    inc  r4
+    hlt
+    rts
+    jsr  r5
+    prn  #K3
+    red  r1
+    rts
+    mov  #1184, r5
+    red  r6
+    bne  r0
+    jmp  r3
+    add  #1972, r2
+    cmp  #-335, r1
+    dec  r6
+    inc  r4
+    jmp  r3
+    sub  r4, r7
+    sub  #-1130, r4
+    mov  #1501, r0
+    hlt
+    inc  r0
+    clr  r2
+    inc  r3
+    clr  r1
+    hlt
+    not  r4
+    bne  r0
+    jsr  r4
+    hlt
+    add  r0, r2
+    red  r4
+    sub  r4, r4
+    not  r0
+    jsr  r7
+    dec  r0
+    jsr  r0
+    cmp  #-531, r1
+    prn  #K2
+    bne  r5
+    inc  r5
+    mov  #1619, r5
+    clr  r6
+    not  r7
+    hlt
+    rts
+    bne  r5
+    dec  r5
+    red  r2
+    clr  r1
+    clr  r1
+    clr  r1
+    jsr  r5
+    dec  r4
+    hlt
+    not  r6
+    rts
+    not  r3
+    dec  r0
+    bne  r2
+    dec  r1
+    clr  r0
+    not  r3
+    rts
+    rts
+    rts
+    red  r3
+    red  r5
+    cmp  #-1336, r7
+    dec  r7
+    red  r1
+    jmp  r4
+    jsr  r6
+    jsr  r6
+    red  r1
+    not  r3
+    rts
+    add  r7, r0
+    not  r5
+    not  r0
+    bne  r7
+    not  r7
+    clr  r2
+    mov  #-925, r6
+    dec  r7
+    clr  r1
+    inc  r1
+    add  r2, r1
+    jmp  r4
+    bne  r5
+    prn  r2
+    bne  r4
+    sub  r2, r0
+    mov  #-808, r6
+    rts
+    hlt
+    not  r4
+    bne  r5
+    hlt
+    red  r6
+    cmp  #-1553, r6
+    not  r6
+    mov  #466, r5
+    add  #492, r0
+    not  r7
+    inc  r1
+    hlt
+    inc  r2
+    sub  r5, r6
+    jsr  r2
+    not  r4
+    clr  r6
+    dec  r5
+    add  #-557, r0
+    rts
+    red  r5
+    bne  r0
+    rts
+    jmp  r2
+    jmp  r2
+    hlt
+    jsr  r6
+    jmp  r1
+    cmp  r5, #K0
+    dec  r5
+    clr  r1
+    rts
+    red  r4
+    dec  r7
+    clr  r2
+    sub  #1150, r0
+    add  #-1822, r4
+    hlt
+    cmp  #-805, #K3
+    hlt
+    jmp  r5
+    hlt
+    jmp  r6
+    clr  r4
+    dec  r7
+    inc  r5
+    inc  r3
+    jmp  r6
+    rts
+    dec  r3
+    mov  r2, r7
+    inc  r5
+    bne  r2
+    clr  r4
+    not  r7
+    mov  r3, r7
+    add  r1, r1
+    prn  #K1
+    cmp  #1833, #K1
+    inc  r5
+    jmp  r0
+    prn  r7
+    jmp  r4
+    bne  r5
+    jmp  r7
+    hlt
+    add  #-1219, r3
+    not  r4
+    inc  r7
+    bne  r3
+    mov  #1152, r1
+    jsr  r5
+    add  r1, r4
+    inc  r3
+    jsr  r1
+    dec  r1
+    dec  r1
+    sub  r2, r0
+    not  r1
+    rts
+    jmp  r3
+    sub  r4, r7
+    add  r7, r7
+    sub  r1, r0
+    add  r2, r0
+    jmp  r1
+    dec  r0
+    prn  r7
+    prn  #1674
+    prn  #-157
+    clr  r2
+    clr  r7
+    jmp  r2
+    jmp  r0
+    inc  r6
+    dec  r5
+    not  r4
+    bne  r7
+    cmp  #-1131, #809
+    sub  #-1837, r7
+    jsr  r0
+    hlt
+    inc  r5
+    clr  r3
+    prn  #K0
+    jmp  r3
+    mov  r4, r4
+    not  r0
+    rts
+    cmp  r0, #-18
+    red  r5
+    rts
+    mov  #-478, r7
+    clr  r7
+    add  #-1186, r1
+    dec  r7
+    not  r4
+    bne  r4
+    jsr  r5
+    bne  r3
+    jsr  r0
+    mov  #-792, r2
+    bne  r1
+    add  #967, r2
+    bne  r7
+    rts
+    add  r6, r3
+    jmp  r1
+    hlt
+    prn  r5
+    inc  r5
+    prn  r3
+    bne  r1
+    not  r5
+    hlt
+    cmp  r3, r5
+    cmp  #1268, r7
+    hlt
+    mov  #-907, r1
+    cmp  #1995, #K3
+    mov  #-889, r5
+    not  r6
+    rts
+    bne  r6
+    not  r2
+    rts
+    red  r4
+    inc  r4
+    mov  r2, r1
+    bne  r7
+    hlt
+    red  r2
+    sub  #343, r5
+    mov  r2, r3
+    inc  r5
+    dec  r0
+    jsr  r6
+    hlt
+    inc  r0
+    rts
+    bne  r7
+    clr  r1
+    hlt
+    rts
+    add  #375, r7
+    cmp  r0, r6
+    prn  #-56
+    add  #-617, r7
+    sub  r3, r5
+    jmp  r6
+    clr  r5
+    cmp  r0, r6
+    clr  r6
+    prn  #K2
+    red  r0
+    red  r4
+    add  #422, r2
+    add  #1463, r7
+    red  r5
+    prn  #-1015
+    prn  r4
+    prn  #K0
+    sub  r2, r3
+    sub  r0, r0
+    not  r7
+    rts
+    sub  r1, r5
+    rts
+    clr  r6
+    not  r3
+    red  r2
+    jmp  r1
+    add  r1, r2
+    jmp  r6
+    mov  #89, r0
+    cmp  r7, #K2
+    sub  r4, r2
+    jmp  r4
+    add  r4, r4
+    red  r5
+    bne  r3
+    rts
+    clr  r1
+    rts
+    not  r4
+    bne  r1
+    bne  r2
+    inc  r1
+    add  r1, r0
+    sub  #-76, r6
+    not  r2
+    rts
+    dec  r4
+    mov  r5, r0
+    not  r1
+    bne  r1
+    jsr  r2
+    jsr  r4
+    add  #-536, r7
+    jmp  r3
+    clr  r3
+    cmp  #-586, r5
+    red  r1
+    inc  r2
+    bne  r6
+    red  r7
+    rts
+    sub  r0, r2
+    mov  r2, r3
+    clr  r6
+    jmp  r4
+    add  r2, r1
+    clr  r7
+    rts
+    bne  r2
+    inc  r0
+    mov  #725, r0
+    dec  r1
+    add  r3, r5
+    clr  r0
+    jsr  r0
+    jmp  r1
+    mov  r6, r3
+    red  r6
+    clr  r4
+    jsr  r6
+    jsr  r7
+    hlt
+    jmp  r5
+    not  r6
+    jsr  r7
+    clr  r1
+    rts
+    bne  r6
+    mov  r7, r2
+    sub  #190, r7
+    sub  r1, r3
+    prn  r5
+    rts
+    not  r4
+    prn  #1862
+    clr  r3
+    clr  r4
+    dec  r2
+    mov  r1, r4
+    clr  r4
+    dec  r1
+    cmp  r7, #1354
+    bne  r2
+    add  #625, r0
+    mov  #-1395, r2
+    clr  r1
+    hlt
+    sub  r4, r7
+    red  r2
+    jsr  r1
+    cmp  #1863, #-1666
+    sub  r4, r4
+    prn  #K3
+    jsr  r1
+    inc  r4
+    not  r0
+    clr  r4
+    inc  r0
+    sub  r0, r2
+    sub  r4, r3
+    jmp  r4
+    prn  #912
+    rts
+    cmp  #1794, r3
+    mov  #1226, r4
+    not  r7
+    mov  #-73, r2
+    mov  r1, r1
+    not  r2
+    not  r4
+    cmp  r0, r2
+    sub  #-1637, r3
+    jsr  r5
+    sub  r5, r6
+    jmp  r0
+    jmp  r1
+    sub  #-124, r6
+    cmp  #1015, #-41
+    clr  r1
+    cmp  r1, r5
+    sub  r0, r3
+    mov  #-532, r5
+    red  r2
+    add  #1353, r3
+    jsr  r1
+    clr  r1
+    jsr  r4
+    inc  r1
+    add  r1, r6
+    mov  #-1720, r5
+    prn  r0
+    clr  r6
+endmcr
+MAIN:   mov  r0, r1
+END:    hlt
@@ -0,0 +1,3001 @@
+.define K0 = 14
+.define K1 = 12
+.define K2 = 34
+.define K3 = 27
+.extern X0
+.extern X1
+.extern X2
+.extern X3
+.extern X4
+.extern X5
+.extern X6
+.extern X7
+.extern X8
+.extern X9
+.extern X10
+.extern X11
+.extern X12
+.extern X13
+.extern X14
+.extern X15
+mcr m0
+    inc  r1
+    jsr  r4
+    mov  r5, r7
+    cmp  #-883, #K2
+    cmp  r6, r3
+    clr  r7
+endmcr
+mcr m1
+    jmp  r0
+    red  r6
+    sub  #628, r4
+    cmp  #101, #1697
+    hlt
+    rts
+endmcr
+mcr m2
+    not  r1
+    inc  r5
+    prn  r6
+    dec  r2
+    jsr  r7
+    inc  r3
+endmcr
+mcr m3
+    jmp  r7
+    dec  r3
+    not  r7
+    jmp  r5
+    bne  r5
+    prn  #K3
+endmcr
+mcr m4
+    red  r0
+    cmp  r1, #K0
+    jsr  r4
+    mov  #1054, r6
+    not  r0
+    jmp  r3
+endmcr
+mcr m5
+    add  r7, r3
+    add  #801, r6
+    dec  r0
+    rts
+    inc  r5
+    prn  #231
+endmcr
+mcr m6
+    red  r4
+    sub  #-954, r2
+    mov  #-1139, r0
+    hlt
+    inc  r3
+    prn  #1094
+endmcr
+mcr m7
+    hlt
+    mov  r7, r2
+    mov  r4, r3
+    prn  #K2
+    rts
+    clr  r5
+endmcr
+MAIN:   mov  r0, r1
+L0:   not  r2
+        red  L0
+D0:   .string "rzkehqhiebpzeaegpheir"
+; generated comment line
+        inc  L0
+        prn  r0
+L1:   rts
+        prn  L0
+        mov  r6, D0[6]
+        prn  r6
+        add  r0, r1
+D1:   .data 3933, K3, -5270, K3
+        rts
+        cmp  L1, r0
+        prn  D1
+L2:   hlt
+        jmp  r5
+.define K4 = 12
+
+        dec  r5
+        rts
+        bne  r7
+        clr  r1
+; generated comment line
+L3:   dec  D1[K0]
+        not  D0[8]
+        bne  D0
+        lea  L3[5], r7
+D2:   .string "rinjueedxfnsymhsdzjet"
+        jmp  L3
+        hlt
+        dec  L3
+
+        not  D2
+        red  r1
+L4:   cmp  #1851, L2
+        dec  r3
+
+        m3
+        rts
+; generated comment line
+D3:   .data 3129
+        hlt
+        lea  D3[K0], L4[K0]
+
+        lea  D1[7], L4[7]
+.define K5 = 15
+.define K6 = 35
+; generated comment line
+        add  D2, L4
+        bne  r4
+        jmp  r2
+        clr  L3[K6]
+        not  L0
+L5:   bne  L0
+.define K7 = 48
+        m6
+
+        mov  r3, r6
+        hlt
+; generated comment line
+; generated comment line
+        add  #212, L2[K0]
+        hlt
+D4:   .data 2799, 7828, -103, 5692, K3, 7227, 6674, 2109
+        jsr  r5
+        bne  D3
+        hlt
+        rts
+        lea  L5, r6
+        not  D3
+L6:   jsr  r6
+; generated comment line
+D5:   .data 7635, -7497, -1294, 6890, K0, K3, 4091
+D6:   .data 2840, 6369, -7407
+        hlt
+        rts
+        m2
+D7:   .data 733, -3158, -1562
+        hlt
+        lea  L2[K3], r6
+.entry L0
+        bne  r5
+        red  r4
+; generated comment line
+        m7
+        m4
+D8:   .data 6307, 7498, K0, K4, 3634, K1, 684, 3788
+        add  L5, L5
+D9:   .data -4031, K3
+        dec  r1
+        prn  #-1269
+D10:   .data 1541, -2199, -2420, 4778, 126, -99, K0
+; generated comment line
+        m7
+        clr  D3
+D11:   .string "aaluurkxxsmtjnehjrtjuhh"
+        m5
+L7:   clr  D0[K7]
+        rts
+        mov  L0, r4
+        m0
+; generated comment line
+        sub  L6[9], r6
+.entry D0
+        cmp  #-1312, D10
+        inc  D7[K5]
+D12:   .data K1
+        jmp  r4
+L8:   dec  L1[7]
+D13:   .string "izoncvhejcbslojlev"
+        not  L7[K1]
+.entry L1
+        dec  r3
+        red  D0
+L9:   add  #-1999, L4[8]
+; generated comment line
+        sub  D13[K4], L0
+D14:   .data 237, -6813, -7481, -6595, -7596, 2407, K7
+        m3
+D15:   .string "lgglbumzmcybotiy"
+        lea  D12[K6], r4
+        prn  L1[5]
+        mov  r1, r7
+        bne  L4
+D16:   .data 616, K5, 3239, -951, 3072
+L10:   hlt
+L11:   mov  D9[K5], r6
+        jmp  D8
+; generated comment line
+D17:   .string "godiflyjnbharblspl"
+        m1
+
+        clr  D10
+        prn  #K4
+        mov  D10, L8
+        sub  #-1161, D8[K4]
+D18:   .string "twcuuqwhohcbkhykpqzabk"
+        inc  D5[K7]
+        sub  r4, L8
+        inc  L0
+
+D19:   .string "mocmpvapav"
+        dec  D17
+        sub  #1850, D8
+; generated comment line
+        bne  r1
+; generated comment line
+; generated comment line
+        inc  D7
+        sub  D8[1], L3
+        cmp  D7[13], r7
+        sub  #-1142, r7
+
+        red  r6
+; generated comment line
+        clr  L11[7]
+D20:   .string "zgsadwovmrdeqvdb"
+D21:   .string "thnktziktsruhpaoul"
+
+D22:   .data 4452
+        sub  D9[K3], r4
+        jsr  r0
+        prn  L2
+; generated comment line
+
+        lea  D10, D10[11]
+L12:   bne  r7
+        red  L11[K6]
+; generated comment line
+        clr  L4[10]
+        sub  L7[0], r7
+        hlt
+L13:   bne  D20
+L14:   inc  L11[K6]
+        clr  D9[11]
+        cmp  L2[8], r6
+        inc  D6[K0]
+        mov  r3, r4
+D23:   .string "bprtuc"
+        clr  D14
+        lea  D14, r1
+L15:   dec  r6
+        m7
+        add  D16[K0], D2[K4]
+
+; generated comment line
+        lea  D10[K3], r5
+        dec  D2
+        sub  r6, D15
+        jsr  r4
+
+; generated comment line
+; generated comment line
+.define K8 = 52
+L16:   hlt
+; generated comment line
+D24:   .data K0, 7055, K3
+L17:   inc  D15[5]
+        jmp  D5
+D25:   .data K7, 6483, -6418, 3024, -1079, 417, 894
+        jmp  r6
+        add  #457, D23[K3]
+        not  D19
+D26:   .string "jiocuiqhyhqperwargxq"
+        prn  #1274
+
+D27:   .string "ctvcavufiebxbg"
+        sub  #-1990, L15
+D28:   .string "joxmnyeigzotnxwhdn"
+        lea  D12, L10
+D29:   .string "ceakoh"
+        m3
+        red  D9[13]
+        jsr  r4
+        clr  L3
+D30:   .data -3981, 1355, 5910, K2, -7557, -2495
+D31:   .data 5209, 2290, 7619, -6321, -5453
+; generated comment line
+L18:   bne  D30
+        sub  D7, D12[9]
+
+        inc  D6
+        sub  r2, D11
+; generated comment line
+D32:   .data K4, K2, K6
+        prn  D24
+        bne  D22
+        dec  r5
+        dec  L7[3]
+        not  D26
+
+D33:   .string "nrouagwjdpxd"
+D34:   .data 1855, K2, K5, 3344, -6568, -5794
+
+        clr  L14
+D35:   .string "etp"
+; generated comment line
+        lea  D28[1], D27[3]
+D36:   .data 1277, K1
+        lea  D0[K2], D21[4]
+        jsr  L5
+        cmp  r4, D32
+; generated comment line
+D37:   .data K6, 6254
+
+        m0
+        not  D32
+        not  r4
+; generated comment line
+        add  D29[1], L17
+        prn  #1627
+L19:   jmp  D24
+
+D38:   .data K6, 85, 2650
+        sub  r7, r2
+.define K9 = 45
+
+D39:   .data 6441, -6838, 6725, K5, K1, K6, 7323
+.entry D1
+        jsr  X5
+        sub  r4, D33
+        add  L5[1], r4
+        mov  #1056, D31[K0]
+        prn  r4
+        rts
+.define K10 = 1
+        dec  D18[K6]
+L20:   cmp  #212, r4
+        jsr  D31
+D40:   .string "mpkhmrehciz"
+D41:   .data K9, 2892
+        prn  D10
+        sub  r2, D8[K0]
+D42:   .string "ucu"
+; generated comment line
+        clr  r6
+        mov  D34, D0
+        lea  D36, r2
+L21:   red  L6
+        prn  D3
+        sub  D16[13], r3
+        jsr  r3
+        m7
+        m3
+        cmp  D38[8], r4
+L22:   add  L15, D41
+        inc  D27
+D43:   .data K5, 4518, -371, -7374, 3535, 2252
+        cmp  L22, X1
+        hlt
+D44:   .data K9, -2232, -1728, K6, K10, -5354, 6098
+D45:   .data 1754, 7889, K2, -2339
+        red  L21[K4]
+        red  D36[K4]
+
+        jsr  D37
+        red  r1
+        not  D26[15]
+D46:   .data 3388, 3884
+        rts
+; generated comment line
+D47:   .string "nudyffs"
+        sub  r0, r2
+        prn  r2
+        bne  L1
+        cmp  D27, r4
+
+
+.define K11 = 36
+L23:   bne  r4
+        not  r4
+        hlt
+L24:   jmp  r7
+
+        cmp  L7[K10], L6
+        m4
+        m2
+        not  L9[11]
+; generated comment line
+L25:   jmp  L22
+        prn  D45[3]
+        lea  D16, D6
+        mov  D27[0], D2
+D48:   .data 3640, K9, 5000
+        mov  r0, D38
+
+        m7
+        m6
+        red  L6
+; generated comment line
+D49:   .data 7569, 1733, 6053, 4945, -5838, K3
+        inc  D38[12]
+D50:   .data 846, 2078
+D51:   .data 4234, 2082, K2, -2356, -4170, -2240
+        bne  L24
+D52:   .data 6861, 6250, -488, K4
+        mov  D31[0], D10
+L26:   dec  r1
+; generated comment line
+D53:   .string "jmtfowfchy"
+        m1
+        mov  D43, r7
+; generated comment line
+D54:   .data -3002, 3174, 2822, K4, 7709, -7409
+D55:   .data -3331, 6866, 5442, -6348, K0
+        m2
+        not  D8[K0]
+        bne  r1
+        jsr  D17
+D56:   .data 2211, K6, 4259, 2065, K8, 563, -2943
+D57:   .data 4833, 7108, -4574, 566, 533, K4
+D58:   .string "mxnt"
+        jmp  r3
+.define K12 = 55
+D59:   .string "cmfijfmijdlkhftxtsrl"
+        add  D40, r2
+        rts
+L27:   clr  r0
+        dec  L4
+        lea  D22, L26
+L28:   prn  #713
+L29:   not  L24[15]
+        mov  D55, L25[K0]
+        add  D23, L15
+; generated comment line
+
+D60:   .string "oxfapudsjujdwx"
+        m1
+; generated comment line
+D61:   .data -7467
+        jmp  r2
+L30:   jmp  r1
+D62:   .string "redpphkqjinsjlzzmngkehio"
+D63:   .data -3579, 4667, -1825, -2667, -4116, 5439, K1
+D64:   .data -4296, -2247, -6976, 5579
+        mov  #1134, L11[K9]
+        m0
+L31:   red  D40
+.entry L2
+        not  L21[13]
+D65:   .data K7, 4359, -7836, -779, -5122, K8
+D66:   .data K1, K9, 3457, 7142, -2723
+.entry D2
+D67:   .data -4537, -7274, K5, 6030, -5130, 5130, 7886
+        prn  L12
+
+        rts
+        cmp  r7, #1675
+        red  D32
+L32:   bne  D25
+        prn  r7
+        not  L6
+; generated comment line
+
+L33:   sub  D55[K4], r4
+D68:   .data K4, -1311, -3437, K6, K8
+; generated comment line
+; generated comment line
+        m3
+        prn  r0
+        m5
+D69:   .string "gdqtlcjhwrrywfqfcadjdoy"
+D70:   .string "dwqpwk"
+D71:   .string "xsjc"
+        lea  L31[5], D12[5]
+D72:   .string "mouogakut"
+D73:   .data -2890, 3434, K1, 1720, 6615, 7098, -5413, K2
+D74:   .data -1628, 1241, 5396, 2361, 279, 7114, -103
+        clr  L25[K0]
+; generated comment line
+.entry L3
+D75:   .data -190, -4836, -559, K8
+        sub  r1, r7
+        prn  D36[K8]
+D76:   .data 6206, -1349
+; generated comment line
+.entry D3
+
+L34:   mov  #1011, L0[K4]
+        add  r4, D59[4]
+        m4
+        red  r4
+        lea  D17[K8], L8
+        inc  D54[7]
+; generated comment line
+; generated comment line
+
+        sub  L23[14], r1
+        jmp  r7
+L35:   prn  #K6
+        jsr  r0
+        add  r2, D11[2]
+D77:   .string "mhfopmmhiklkcdhwpcxhwu"
+        jsr  r4
+
+        sub  D4[9], D34[K11]
+D78:   .data 3824, K8, 6528, -7016, -260, 75, 1265
+        red  r2
+L36:   jsr  r5
+        m6
+        rts
+L37:   add  D52[K6], r6
+        inc  D26[K5]
+L38:   prn  L34[K8]
+
+        mov  L23[2], r6
+        prn  L37[K11]
+D79:   .string "ohrlkbv"
+        not  D36[K12]
+D80:   .data K2, K4, K2, 3975, 6907
+        dec  r5
+D81:   .string "fgnrktnxzerfxexlgqzac"
+        sub  D40, L12
+        m2
+        lea  L27, r6
+.entry L4
+        prn  D2
+D82:   .data 3045, -2633, -4903
+        not  D20
+        rts
+; generated comment line
+; generated comment line
+        m4
+D83:   .data K1, -30, 6563, 7053
+        m3
+        hlt
+D84:   .data K11, -6587, K0
+D85:   .data 6892, -7649, K0, K9
+; generated comment line
+        hlt
+; generated comment line
+        bne  r3
+        jmp  r6
+        mov  #-1502, r4
+D86:   .data -2320, 7088, K5, K12, 5192, -1933
+        sub  L37, r2
+        hlt
+        hlt
+D87:   .data K5
+L39:   add  L29[K7], D85
+        dec  r2
+        sub  r1, r5
+        hlt
+        m2
+L40:   lea  L28, r5
+        clr  L12
+        red  r2
+        cmp  D11[K12], D51[K5]
+        bne  L12
+.entry D4
+L41:   clr  L2
+        inc  r2
+        hlt
+D88:   .data K2
+        add  D80, D51
+        jsr  r4
+        hlt
+L42:   dec  L10
+        inc  L29[6]
+        dec  r1
+D89:   .data 6134
+        inc  r5
+L43:   dec  r1
+.define K13 = 54
+
+        hlt
+D90:   .data -3531
+.define K14 = 51
+        lea  L17, D2[12]
+        inc  D16[K10]
+.define K15 = 55
+L44:   add  r1, D37[11]
+        lea  D5[9], r4
+        m5
+        inc  D8[K4]
+        jsr  D1
+D91:   .string "evdoy"
+        rts
+        cmp  D52, r1
+D92:   .data -2656, 1041, -4742, K14
+
+        prn  #-675
+        jmp  D48
+        prn  #-1446
+        m6
+L45:   add  #1913, D92
+        sub  L37, X10
+        red  L11
+        red  D79[K6]
+
+        jsr  D1
+        mov  r7, r5
+        rts
+        hlt
+.entry L5
+        inc  D56
+D93:   .string "d"
+.entry D5
+        hlt
+; generated comment line
+        m2
+; generated comment line
+        hlt
+        dec  D43[K9]
+        bne  r0
+L46:   sub  D84, r4
+D94:   .data K6, 7123, 998, K10
+D95:   .string "eanwwikv"
+        dec  D18
+; generated comment line
+
+        cmp  #109, r1
+L47:   add  r5, L46[K14]
+        m6
+        m6
+        not  D22
+
+
+D96:   .data 1712, -1339, -4896
+L48:   sub  r5, r6
+        cmp  r4, r1
+        jmp  D3
+        jsr  D37
+        red  D3
+        m2
+L49:   sub  D65, D87[K10]
+        m1
+D97:   .string "trwkpovsrrkuuxpstounq"
+        inc  L24[6]
+        dec  D34
+D98:   .string "ihtesuzzrvqe"
+        red  D13
+        jmp  D45
+        hlt
+
+; generated comment line
+        red  D28[K11]
+
+
+D99:   .data -2837, 4505, K1, K1, 7730, 5450, K11, -2126
+; generated comment line
+
+; generated comment line
+        jsr  L23
+        mov  L23, D80
+        bne  r4
+        red  L34
+        lea  D53[1], D23
+        rts
+        jmp  r1
+        jmp  r4
+L50:   prn  L8[K10]
+        bne  D6
+        clr  D80
+
+        bne  r5
+.define K16 = 29
+        cmp  r4, D24
+L51:   bne  L48
+        sub  r7, r0
+        m0
+D100:   .data K7, -1449, K14, K14, K14, K12
+        inc  D74
+        prn  #10
+D101:   .data 5485, -3479, 6877
+        jmp  r2
+L52:   prn  #-1993
+        not  D51[6]
+; generated comment line
+        jsr  L14
+        clr  r6
+        lea  D79[5], D6[K7]
+        mov  #-947, D83[K13]
+L53:   lea  L20, L30[K13]
+        hlt
+        bne  r5
+D102:   .string "wnwydhnusqwzdgcboqeg"
+; generated comment line
+        red  r4
+        lea  L47[7], r7
+        bne  L26
+        cmp  D86, r4
+L54:   not  r7
+        hlt
+        jsr  r0
+L55:   red  r6
+D103:   .data 2812, K10
+        rts
+.define K17 = 16
+        bne  L21
+D104:   .string "sxngdpjpdbptldvym"
+        bne  r4
+L56:   mov  r7, L17[K5]
+        inc  r6
+        jsr  D89
+        hlt
+        add  #-1963, D53
+L57:   cmp  r6, #K9
+L58:   add  r1, D58
+        cmp  #-112, L25
+D105:   .data -5203, -1133
+.define K18 = 42
+
+        red  r1
+        rts
+        jsr  r3
+        cmp  r5, D100[4]
+.define K19 = 29
+        bne  r3
+D106:   .data -4919
+L59:   lea  D61, L13[K5]
+        cmp  D28[2], r1
+L60:   cmp  #-1799, #K9
+        sub  D42[K14], L52[K2]
+.entry L6
+        jsr  r3
+        jsr  r4
+L61:   hlt
+
+D107:   .string "l"
+        sub  #-791, r2
+        m0
+        dec  D5[K18]
+; generated comment line
+D108:   .data 1110, K17, -7140, 2520, 403
+        clr  D21
+D109:   .string "lowcuqmesymsphnadjwjegf"
+L62:   mov  D104[K1], r6
+D110:   .data -636, 4724, 4804, 5731, -6047, -3258
+        jmp  D68
+D111:   .data -3501, K3, -6080, 4769
+L63:   clr  L9[2]
+        sub  D96, D52
+
+        add  #-26, r4
+D112:   .data K14, -2556, K11, 2873, -6229
+        lea  L57[K11], r2
+        m6
+        inc  L21
+; generated comment line
+        clr  D109
+L64:   mov  D46, L55[K2]
+        clr  D60[14]
+        sub  D46, L61
+        jsr  r5
+        jsr  L24
+D113:   .data -7844, K6, 1433, 879, -1426, 5730, K19
+        hlt
+        sub  r7, r7
+        hlt
+; generated comment line
+        m1
+        add  L13, r1
+        mov  #-533, D29
+L65:   not  r1
+D114:   .data 1681, -4795, -1301, -2953, 3996, K10
+        hlt
+        rts
+L66:   hlt
+D115:   .data 4165, 1864
+        not  X11
+D116:   .data -246, K9, -3188, -4188, K7, K2
+        lea  L38, L15
+L67:   dec  r0
+
+D117:   .string "isrtrbyewbc"
+        prn  L15
+D118:   .data -2977, -6355, 4875
+        m4
+        sub  D88, r1
+        sub  r2, r1
+; generated comment line
+        mov  D102[K10], D54
+
+        mov  L58, X7
+D119:   .data -7332, 805, 4608, -7605, -4513, -3598
+D120:   .data K11, -4391, 5870, 7112, K12, -7848, -7248, -4780
+        jmp  r5
+L68:   bne  D31
+        red  L43
+        dec  r7
+D121:   .data 7256, -4010, K13, 5718, K6, -1071, -3942
+; generated comment line
+        bne  L24
+        sub  D38, r2
+        not  D84
+        lea  D52, D55
+D122:   .string "hrasopaemmetgmrpkzilc"
+        m5
+D123:   .data 3446, -1465, 5059, 4261, 1922
+        rts
+        not  D76[K11]
+        hlt
+        jsr  r2
+
+        m1
+D124:   .data -1440, 823, K1, -7046, K5, 6754
+        bne  L5
+        m6
+D125:   .string "qmvevavyhaebmjmzkfcel"
+        rts
+        red  D82[2]
+        red  X0
+        sub  L63[1], D122[4]
+; generated comment line
+D126:   .data K8, 3457, 1683
+D127:   .data -2831
+D128:   .data -5626, K16, K4, -2162, K1, 2120, -1336, K4
+
+        red  r4
+
+.entry D6
+        jmp  r4
+        inc  L45[5]
+        jmp  r3
+D129:   .string "tjzwgmivgpvgkmppwjjr"
+L69:   jsr  r7
+L70:   bne  L38
+D130:   .data 5772, K19, -3139, -6613
+
+L71:   sub  L63, L64[6]
+        red  L34
+; generated comment line
+        mov  L29[K8], r4
+        clr  D31
+D131:   .data 1237, K12, K13
+; generated comment line
+; generated comment line
+        dec  L50
+        clr  D53
+L72:   clr  D26
+        jmp  r7
+        jsr  L71
+D132:   .string "mzctcbizduduwnmobe"
+D133:   .data -1395, K9
+L73:   mov  #1427, D119[10]
+        jmp  r5
+D134:   .data K13, 5005, -369, 5140, 3166, 6174
+        lea  D39[1], L27
+        rts
+        sub  r5, D85
+; generated comment line
+        dec  D39
+        not  D49
+        hlt
+L74:   add  D50[1], D129
+        prn  #747
+D135:   .data -7498, -4040, 6652
+
+        dec  D19[K17]
+D136:   .string "istbggcjqmuwsjymnbod"
+L75:   lea  D90, D45
+L76:   hlt
+        hlt
+        red  D28
+D137:   .string "vvlsrue"
+; generated comment line
+D138:   .string "eytjf"
+D139:   .data -6144, 2334, 3160, K14, 5615
+        add  L27, L28[5]
+; generated comment line
+D140:   .data K13, -5673, K15, -2176, -2116, 978
+        bne  L58
+        red  D110
+; generated comment line
+        m0
+        sub  r2, D105[K17]
+.define K20 = 59
+L77:   hlt
+L78:   mov  r0, L34[K1]
+        lea  L51, D54[K18]
+
+L79:   sub  D35[K8], D18
+; generated comment line
+        rts
+        sub  L72[13], r3
+        jsr  r3
+; generated comment line
+        red  L79[3]
+        not  D70[6]
+        clr  r1
+D141:   .data 897, -3193, 627, -7432, K18, 3324
+
+        bne  D53
+D142:   .string "zjzwnhucrszirz"
+        cmp  #-1601, D130
+; generated comment line
+L80:   add  D54[K7], D31
+        dec  D134[11]
+        m6
+        inc  D66[14]
+        dec  D73[1]
+; generated comment line
+        jmp  r7
+
+        sub  #-1725, D60[1]
+D143:   .data -1842, 1615, 4003, 2705, K11, K15, 5226
+D144:   .data -7514, -2977, K5, 1375, K14
+L81:   prn  D14[1]
+D145:   .data -4553, K8, 1949
+        sub  D52, D127
+        not  D104[K2]
+        jsr  r1
+
+        prn  D107
+        bne  r3
+        jsr  L20
+; generated comment line
+D146:   .data -136, 6475, -6584, 4670
+.entry L7
+L82:   mov  #-1310, D5[K7]
+
+D147:   .data -2206, -103, 5707, -104, -148
+
+        lea  D73[K18], D26
+
+L83:   jmp  r0
+D148:   .data K3, K8, K14, K17, 779, -1249, -1161, 7260
+        not  L82[3]
+        cmp  L41, D7
+.define K21 = 20
+D149:   .data -6689, -4390, 5404, 6901, -5075
+L84:   rts
+; generated comment line
+        add  D102[13], D117[K9]
+; generated comment line
+D150:   .data 969, -2373, -771, -3174, -6968, K18, 982
+D151:   .data 2245, K14, -3190, -2224, 7664, -4344
+        cmp  L61, r2
+.entry D7
+        sub  r1, D60
+L85:   mov  L14[K2], L62
+D152:   .data 3081, 3523, 6468, K6, 5742, -3337
+; generated comment line
+        add  #1424, D38
+D153:   .data K5, 1716, -492
+        bne  r4
+D154:   .data K12, -323
+        jmp  D100
+        jmp  r1
+        clr  D63[K9]
+        add  D19, L70[6]
+        rts
+        red  r7
+        cmp  r2, D42
+D155:   .data -3373, K2, 885, -7710, 1571
+        bne  r3
+D156:   .data 1125, -4323, -3740, K4, 2519, 6513
+D157:   .data 1608, K14, -5144, -7936, 4644, K5
+        hlt
+L86:   add  r1, r6
+L87:   jmp  r1
+        dec  D45
+; generated comment line
+L88:   cmp  #1737, r0
+
+.define K22 = 6
+        rts
+        cmp  r2, r7
+.entry L8
+        not  L4[12]
+        bne  r2
+
+; generated comment line
+        prn  #1966
+
+        mov  r1, L14[K6]
+        dec  r5
+        sub  D89, L67[0]
+.define K23 = 33
+D158:   .data -2485, 6220, -7239, 4865, 5771, -1889, -1603
+; generated comment line
+        dec  L87[13]
+        bne  D22
+.define K24 = 33
+; generated comment line
+D159:   .data K8, 4849
+D160:   .string "irxckcmzo"
+        m0
+L89:   cmp  r1, D5[K3]
+        add  #1228, D28[K17]
+        jsr  r7
+        dec  r6
+        lea  D121, D127
+D161:   .data -3935, K18, K16, K24, 7287, -3510, 5065
+        mov  r7, r3
+; generated comment line
+
+        m7
+        dec  L55
+D162:   .string "umjtzqaasv"
+        hlt
+        jmp  L46
+        not  L50
+D163:   .string "td"
+; generated comment line
+.define K25 = 47
+
+D164:   .data 3795, K13
+D165:   .data K23, 7341, 6061, 2398, -7396, -2835, K25, -1528
+        dec  D136
+D166:   .data 1402, K4, K25, -2850, K11, 1172, 5584, 2891
+D167:   .data 508, -3434, K17, K17, 7533
+D168:   .data 2864, -304, K2, -7458
+; generated comment line
+        m7
+        bne  D63
+        jsr  r6
+L90:   prn  r3
+        not  D64[K1]
+.define K26 = 8
+        jmp  r7
+        jsr  r0
+L91:   jsr  D114
+.define K27 = 36
+        jsr  r1
+L92:   sub  D13[K23], D13[K24]
+        lea  D134, D119
+        jsr  r4
+        sub  #-291, D0[K10]
+        prn  #892
+; generated comment line
+L93:   prn  D73[K11]
+D169:   .data 5257, K0, K23, K1, 3746, 1698, -4377, -7213
+L94:   hlt
+        sub  L4[14], r1
+D170:   .data -1179, -6269, -1888, K16, -7793, -5553, 1581, -2968
+        add  r2, D24[2]
+D171:   .data K25, 4742, 6974, K19, -7834, 748
+
+        rts
+D172:   .data -7678
+D173:   .string "vioxfk"
+D174:   .data -3642, 2319
+L95:   hlt
+        lea  D172, D100[K21]
+D175:   .string "brphlnjsqdotnfnxmlrw"
+        mov  L78, D62[K14]
+D176:   .data -4492, -5430, -1099, -1156, K14, 6488, 1464, 1099
+        mov  L37[2], r6
+L96:   prn  D1[K18]
+D177:   .string "yptlufx"
+        not  D142
+D178:   .data K16, K20, -196, K19, 730
+L97:   bne  D27
+        rts
+        red  L90
+        lea  D26, L78[K7]
+        inc  r2
+
+D179:   .data 1002, -2223, -4586, 3470, K14, 2808, -446
+        jmp  D44
+        inc  r3
+        rts
+L98:   inc  r7
+; generated comment line
+D180:   .data -7371, 645, K27, K7, K12
+        sub  D152, L71[K7]
+D181:   .data K19, 629, K10
+        jmp  D68
+        cmp  r2, L75
+        jmp  L27
+L99:   red  L56
+D182:   .data K6, -1136, -1569, K13, K12
+D183:   .data -2568, 7203, 2412, K11, -1438, -1103, -7900
+        hlt
+        m5
+        mov  D9[13], L43[13]
+        rts
+D184:   .data 984, K14
+D185:   .data -981, 4087, -2277
+        m7
+D186:   .string "agleavujbuc"
+        rts
+        sub  r7, r6
+        rts
+D187:   .data 832, K22
+
+        lea  D54, L16
+        not  r3
+        inc  D9
+        mov  L45, r0
+D188:   .data 1568, 3691, 58, 364, 685
+        clr  r7
+
+        add  L55, r4
+; generated comment line
+        inc  r1
+D189:   .data K9, K11
+        sub  D112[K9], D122
+        cmp  D176[5], D110[15]
+        not  r1
+L100:   hlt
+        clr  D112[7]
+D190:   .string "baicrigcpirpvjvtjrlsk"
+L101:   red  r7
+        clr  D172[6]
+        not  D145
+; generated comment line
+        bne  D86
+        dec  D62[K8]
+D191:   .data 6150, 7364
+
+        bne  r6
+        not  D170
+D192:   .string "rhmhtsfcadpuaytice"
+        bne  L0
+        dec  D177
+        prn  D114
+L102:   dec  r1
+        red  D149[K26]
+        jmp  D161
+; generated comment line
+        mov  r4, D22[4]
+L103:   lea  L8, r0
+D193:   .data -2232, K11, -6979
+        prn  #K22
+L104:   jsr  D161
+D194:   .data K3, 2809, -1063, 5738
+D195:   .data -7404, 659, K1, 7332
+        red  r6
+        lea  D44[2], D105
+        inc  L16
+        add  D145, L87
+; generated comment line
+        not  D78
+; generated comment line
+        lea  D160, D78[K18]
+        lea  D121[K19], L91[7]
+; generated comment line
+        red  D26[5]
+.define K28 = 1
+.entry D8
+.define K29 = 10
+        not  L94
+D196:   .string "kbn"
+        sub  D179, r7
+        dec  D89[K21]
+        add  r3, r1
+        cmp  D99, L46
+D197:   .data -3263, 1166, K9, 6736, 6792
+        bne  X7
+        sub  r1, L99[8]
+        not  D63[14]
+        sub  #-434, r7
+        red  r7
+; generated comment line
+D198:   .data -2182, -2853, -6187, 2819
+        dec  L20[11]
+.define K30 = 26
+        jsr  D35
+L105:   lea  D36[2], r4
+        red  D131[K7]
+.define K31 = 21
+L106:   jsr  L99
+.define K32 = 60
+        hlt
+D199:   .data 3507, -3610, -374, -1364, -3115, 3179, 7311, K17
+        lea  D149, r3
+
+        jsr  D162
+        m1
+
+D200:   .string "qexrmodgokxu"
+        jmp  r2
+        clr  D94[K4]
+        not  L54[11]
+L107:   rts
+L108:   rts
+        dec  r4
+        lea  D30[2], D148[3]
+D201:   .data -1219
+D202:   .data -1592, K17, K9
+D203:   .data 2531
+        hlt
+; generated comment line
+        prn  #314
+D204:   .data 3357, 5913, 7309
+; generated comment line
+L109:   bne  L74
+L110:   hlt
+        rts
+D205:   .data -1310, -4538, 3853, 7730, 1418, K1
+D206:   .string "akotxg"
+        rts
+; generated comment line
+L111:   clr  L64[K28]
+
+
+L112:   jsr  D14
+.define K33 = 32
+        mov  D30, r6
+D207:   .data -4958, -917, -4471, 4212, -6399, -4156, -1432, -2793
+D208:   .string "rgg"
+        clr  r1
+        prn  #K3
+        hlt
+        inc  D50
+        not  r2
+D209:   .data K5, K0, K2, -4423
+D210:   .data -4968, K5, 7886, -3, 2896, 6182, -1237, K14
+        jmp  D148
+
+        hlt
+        m4
+
+        jsr  D1
+        inc  D47
+L113:   jmp  r6
+D211:   .string "gsrmzxqkjnzwljrhxklz"
+        bne  r2
+D212:   .data K26, -3569, 745, 7666, -3354
+        m4
+        dec  L2[7]
+; generated comment line
+        rts
+        red  L42[K9]
+        rts
+        prn  L104
+L114:   jmp  r0
+        red  D14
+        dec  L18
+        cmp  r5, D57[4]
+L115:   inc  D124[3]
+D213:   .data 5945
+L116:   lea  L5[K29], r1
+        not  L101
+L117:   clr  D121[1]
+L118:   dec  r2
+        m3
+        add  L86[13], D39[K32]
+; generated comment line
+D214:   .data 6267, K2, 5440, -3929, 3139, 3552
+D215:   .data K21, 786, K25
+; generated comment line
+        jmp  D137
+L119:   prn  r7
+        not  D162
+        clr  D197[K12]
+        prn  D154[K10]
+; generated comment line
+L120:   lea  L33[0], D81
+        hlt
+        mov  L96[K33], r6
+; generated comment line
+        jsr  L27
+; generated comment line
+D216:   .data 1256, -2679, K33, 1415, 4020, -979, -928
+        lea  X5, r0
+D217:   .string "n"
+L121:   inc  r4
+        jmp  r3
+        bne  D99
+.define K34 = 39
+; generated comment line
+        lea  D65[K14], L9
+.entry L9
+        bne  r4
+        m3
+D218:   .string "gdujoda"
+D219:   .string "bapradzwxboyzqlwqhpbeec"
+        lea  D76, r1
+L122:   hlt
+L123:   bne  D132
+.define K35 = 6
+        jsr  L12
+        bne  L19
+        add  D23[K12], r2
+        add  #-1497, r3
+        jmp  D102
+        inc  D103
+; generated comment line
+        m5
+        mov  #-1477, L113
+        not  L88[5]
+D220:   .data 4663, 6993, 4703, K4
+        mov  D147[15], L65
+L124:   jsr  r1
+.entry D9
+        not  D87
+.entry L10
+        bne  X5
+D221:   .data K20, 4804, 6286, -3949, -3164, -7633, 1182, -3019
+        cmp  r4, #K4
+L125:   bne  L21
+L126:   lea  D13, D93[11]
+L127:   bne  r7
+        red  r0
+        m6
+        jmp  r5
+        jmp  D37
+        m7
+; generated comment line
+        jsr  r6
+        inc  D21[K34]
+
+        inc  L90
+L128:   inc  D167
+D222:   .data 3279, 3554, 7654, 1896
+        inc  D149[K28]
+        mov  D175, D172[1]
+        mov  L121, L14[5]
+        jmp  r0
+; generated comment line
+        m6
+; generated comment line
+        clr  D136[K10]
+        not  r2
+L129:   mov  L79, r3
+        jsr  r7
+; generated comment line
+L130:   add  #470, D16[K14]
+L131:   clr  D135[K17]
+D223:   .string "rmuwno"
+        mov  r2, D91
+; generated comment line
+; generated comment line
+        m5
+D224:   .data 5862, -5577, 1971, 1557, 3186
+L132:   rts
+        not  r6
+D225:   .data 6555, 4255, K30, 5645
+        add  D35, r7
+L133:   inc  L105
+.entry D10
+        add  L5[3], D194
+L134:   lea  D191, r4
+        jmp  L51
+        not  D95
+        rts
+D226:   .data 7209, -2602, -1934, -2198, K3, 397, K34
+
+L135:   rts
+        not  D221
+.entry L11
+        bne  L81
+        red  D3
+        lea  D160, r4
+        dec  L116[K16]
+; generated comment line
+        jsr  L41
+        jsr  D127
+        jsr  r5
+D227:   .data -7225
+        sub  L62, r3
+L136:   cmp  D155, D166
+.define K36 = 48
+.define K37 = 62
+
+.define K38 = 59
+D228:   .data 3638, -3488, -2217, K31, -1223, -186, 7975, -6981
+
+        bne  r6
+D229:   .data -5896, K37
+L137:   clr  X9
+L138:   mov  L35, D52
+D230:   .data 1503, 7546, 7533, 4583, 1336, K13
+        jmp  D96
+        m3
+        not  L117[K0]
+D231:   .data -3867, -5152, -5974, -5244, -7431, -3521, -2661, -3907
+        jmp  D104
+L139:   rts
+
+        clr  D112
+D232:   .data K17, -4514, -3276
+        prn  #909
+        prn  r1
+        inc  r4
+L140:   clr  r5
+D233:   .data K25, -5734, -3937, -4800, -1459, 6325
+        sub  #1614, L82
+        sub  L132, D65[K19]
+D234:   .data -748
+D235:   .string "axaizzcyempviygyzuewipnr"
+; generated comment line
+        sub  L117[K29], D228[K2]
+        add  r2, D45
+L141:   sub  r7, r2
+        jmp  D38
+        bne  r5
+D236:   .string "huurjfswjyjzexhfj"
+D237:   .data 1180, -3373
+        prn  D47[1]
+L142:   mov  #1480, L128
+L143:   hlt
+.define K39 = 5
+        rts
+; generated comment line
+        hlt
+D238:   .data 6432, K3, -2155
+        not  r2
+
+; generated comment line
+.entry D11
+        prn  r2
+        sub  L67[K3], L97
+        red  L60
+        sub  r6, D3
+
+        add  D100[0], L8
+        mov  D160, D138[0]
+
+.define K40 = 6
+        m6
+        dec  L115[14]
+        lea  D224, L118
+        mov  #1323, L91[K35]
+
+
+.entry L12
+L144:   lea  D177[K34], r7
+L145:   prn  D35[8]
+D239:   .data -7088, -7643, K33, 5051, -5833, 5571, -7491
+
+.entry D12
+L146:   jsr  L144
+        add  r4, r7
+        cmp  #-1632, D45
+        prn  r1
+
+        dec  r0
+        add  D190[K36], D111[K7]
+        jmp  r4
+        dec  r3
+D240:   .data 5723, 1383, K32, -2845, 7715, 5607, K0
+; generated comment line
+; generated comment line
+        red  D177
+        mov  L119, D185
+; generated comment line
+        rts
+        sub  #-1927, r1
+        bne  r2
+        bne  r0
+        prn  r2
+        bne  D181
+D241:   .string "vpq"
+        red  D15[K38]
+L147:   clr  L25
+        not  r4
+
+; generated comment line
+D242:   .string "tt"
+        prn  D114
+        bne  r3
+        jsr  D197
+
+
+D243:   .data 6779
+D244:   .string "krnimkcdeoc"
+        inc  D110[K36]
+        m3
+        prn  #K10
+L148:   rts
+D245:   .string "znjctlademtxoeejecwakrs"
+; generated comment line
+        rts
+        jsr  r3
+L149:   add  D29, L68[5]
+        cmp  D236[15], L91
+; generated comment line
+D246:   .string "nxduuqutrngjwka"
+        lea  D172[K21], r0
+D247:   .data 6763, 3087, -1910, -5054, K29, K21, -749
+        clr  r6
+        m1
+; generated comment line
+        dec  r6
+
+        add  L79[K24], r5
+        jmp  r4
+        hlt
+L150:   sub  D65, D218
+        not  D37[K27]
+        hlt
+D248:   .string "jks"
+L151:   prn  D99[3]
+        dec  D2[12]
+; generated comment line
+D249:   .string "dvyppjevgfrug"
+        cmp  r7, #K20
+        jsr  r1
+        add  #-1354, D123[12]
+        m6
+        red  L17[3]
+        lea  D128, L114[K13]
+; generated comment line
+        inc  D89[10]
+        lea  D176[K2], D63[K34]
+
+; generated comment line
+        dec  r4
+D250:   .string "sfcgrno"
+        bne  D229
+L152:   prn  #1289
+.entry L13
+        not  r1
+        clr  r3
+D251:   .string "biixzntrlo"
+D252:   .data K6, -2367, 5999, 2938, 410, 3428, 7724
+D253:   .string "fupirethwxkuhmmvkirbq"
+L153:   sub  #1443, r0
+        lea  L57[3], r7
+        jmp  D193
+        mov  L145[K7], r2
+        cmp  r5, D73
+; generated comment line
+        dec  D211
+        jmp  D77
+        mov  r2, r0
+L154:   hlt
+        mov  L148[2], L67
+        clr  D10
+.define K41 = 21
+        not  L70[K6]
+        prn  #K20
+        hlt
+; generated comment line
+L155:   lea  L139[K9], r7
+        bne  D100
+D254:   .data 7068, -212, 7051, 457, 7150
+L156:   cmp  r7, #-85
+        red  r7
+        jmp  L33
+D255:   .data -2566
+
+        dec  L154[11]
+        add  #-498, L61[4]
+.define K42 = 21
+        prn  #1513
+        dec  r0
+; generated comment line
+L157:   cmp  #-1329, L58[6]
+        jsr  L114
+L158:   jsr  D120
+        dec  D159[K32]
+; generated comment line
+        rts
+        rts
+        not  L130[12]
+; generated comment line
+; generated comment line
+
+
+D256:   .string "xypljqrassqwoyyslbwzwo"
+D257:   .string "l"
+        inc  r2
+D258:   .data -2053, -7810, 6660, -2631, 2548
+D259:   .string "fsmrptxq"
+D260:   .data -5528, -6856, K6, K4, -606, -3972
+        jsr  r7
+D261:   .data 3475, -2081, 3268, K4, -4856, K19
+D262:   .string "iatjnwljfd"
+        jmp  L137
+        clr  D171[5]
+D263:   .data K29, K2, 2018, -1538, K7
+        sub  #-140, D167[9]
+L159:   cmp  L101[7], r2
+; generated comment line
+; generated comment line
+D264:   .data 2883, K15, -6837, -3235, 6546, -7737, -3371, 7667
+D265:   .string "skvfldrpkhkzc"
+        red  r7
+        clr  D5[K28]
+        add  r3, D244
+
+L160:   dec  L1[13]
+D266:   .data 3763, K37, 857, -6538, 3135, 5895, K12
+        lea  D207, r0
+        prn  r3
+
+.entry D13
+        red  L146
+        jsr  r3
+D267:   .string "yczhmobgiilspaqh"
+        rts
+L161:   add  D226[9], L157[8]
+L162:   red  L83[7]
+; generated comment line
+
+        rts
+        not  D71
+D268:   .string "rwtiwnpu"
+        prn  #K19
+L163:   prn  r7
+        sub  D180, r0
+
+        m7
+D269:   .data -35, -3599
+        jsr  r6
+        m6
+        red  D116
+        jmp  D250
+        lea  D182, r6
+L164:   prn  D256
+        add  L82[K19], D29[9]
+D270:   .data -4356, -5106, 5628
+        clr  L119[4]
+D271:   .string "dbu"
+L165:   sub  D210[K26], L85
+L166:   bne  D121
+.entry L14
+L167:   prn  D174[9]
+        hlt
+        m4
+
+        sub  r6, D217[14]
+        prn  #K28
+; generated comment line
+        mov  #-154, r0
+        sub  D193, D83
+L168:   bne  r7
+        hlt
+        mov  r5, r7
+        sub  r2, D32[K23]
+        m0
+D272:   .data 1802, 6811
+        red  L44
+        prn  r6
+        red  D239[1]
+.entry D14
+D273:   .data -4669, 4895, 747, 1898
+L169:   cmp  D169[K25], L5[K27]
+        bne  L151
+        clr  D25[2]
+        lea  L120[K27], L156
+        cmp  L52, D180[0]
+        jsr  r4
+        hlt
+
+        add  L125, r4
+L170:   clr  L158[8]
+L171:   jsr  D97
+        not  r4
+        not  r2
+        lea  L105, D35[14]
+        not  D256[1]
+L172:   dec  r4
+.entry L15
+        inc  L106
+        inc  D63
+        m1
+L173:   red  L133[K20]
+        red  r7
+L174:   clr  D167[6]
+        not  L121
+        jsr  D6
+; generated comment line
+L175:   dec  D128[K2]
+        jsr  L144
+        mov  #-18, L10
+        dec  D37
+        jsr  r4
+D274:   .data -3993, 5132, K30
+D275:   .data -4986, 2346, -6079
+        dec  r0
+
+        bne  r4
+        jmp  r3
+D276:   .data 4615, K15, 5172, 5301, K41, 2585, 2537, K14
+L176:   red  D140
+        inc  D253
+        hlt
+        inc  r0
+        m2
+D277:   .data 6125, -5889, K34, K27
+D278:   .data K15, 6207, K14, -536, 4964, 4794
+.entry D15
+        add  D82, D173
+L177:   not  D144[8]
+        red  L98
+        prn  L170
+        dec  D125[K10]
+        dec  r1
+L178:   inc  L114
+        bne  D34
+D279:   .string "regsqylysfpmuvjyzztaxwl"
+        sub  L122[3], D262
+.define K43 = 8
+        rts
+        mov  r5, D94[K40]
+D280:   .data 3605, -7319
+; generated comment line
+        mov  r6, D269[K4]
+        m2
+        sub  L60, L133
+.entry L16
+        inc  D166[1]
+; generated comment line
+        mov  #-1062, L159
+D281:   .string "cqufwcxx"
+.entry D16
+D282:   .data 2844, K24
+        sub  L143[15], r6
+D283:   .data -6074, -383, 5440
+D284:   .string "dlsilhjdzrksaakz"
+D285:   .data -887, K15, K9, -5913, 3453, -7090
+        prn  L28
+        prn  r6
+        add  D229[K34], D49
+        jmp  r0
+        not  L57[2]
+        sub  L94, r3
+        prn  D220
+        inc  D117[7]
+        not  D69[9]
+        jmp  r4
+D286:   .data K6, -3126, 666, -3972, -7526, K5
+        bne  L98
+L179:   hlt
+        bne  r5
+L180:   inc  L109[3]
+        not  r6
+        rts
+        lea  D187[0], L148
+L181:   mov  r0, r2
+; generated comment line
+D287:   .string "oytnujwjgcplbiqfwxhqtbtb"
+L182:   jsr  D74
+        prn  #1271
+        m3
+        cmp  L166[2], D182
+        lea  D229, L59
+        m0
+D288:   .string "znjhjmkyaiqtylq"
+L183:   dec  D100[8]
+        mov  D4[K3], D48[15]
+L184:   red  D189[K15]
+        lea  L143, L141
+.define K44 = 43
+        m6
+        rts
+        clr  D49[12]
+        m7
+        bne  D198
+; generated comment line
+        prn  L54
+        not  r7
+.entry L17
+L185:   hlt
+; generated comment line
+        mov  L29[9], D198[8]
+; generated comment line
+D289:   .string "bchdzbogugvchxycgrhyftlf"
+L186:   jsr  r1
+
+L187:   add  #1632, D196[11]
+        bne  r3
+        add  D106[7], L46[K20]
+        hlt
+        rts
+        mov  D58, r4
+        clr  L25[3]
+; generated comment line
+        red  D180
+        jsr  L33
+
+D290:   .string "tgtdrayfhdndvak"
+        jmp  r1
+
+        add  D40, D215[K15]
+        bne  r3
+; generated comment line
+D291:   .data K13, -2746
+D292:   .string "cnuxbwucznrnuqzhehfxrm"
+        jmp  D127
+L188:   add  #-1734, D154
+D293:   .data 6067, 519
+L189:   red  D36
+        sub  #195, D167[2]
+        m4
+D294:   .data K23
+        lea  L106, L142[K10]
+
+        prn  D262[5]
+; generated comment line
+        inc  L70
+L190:   prn  D286[K44]
+L191:   clr  L54[5]
+.entry D17
+.define K45 = 63
+        rts
+        m5
+L192:   add  D250, D152[K1]
+        sub  L176[K21], r1
+        sub  r0, D215[13]
+
+; generated comment line
+        m2
+D295:   .data -7040, 7346, K35, 7075, K16, K36
+        mov  D108, L121
+
+D296:   .data K24, 4452, K17, -3047, 6539
+        lea  D237, L100[K19]
+        mov  D0, D147
+D297:   .data K29, 2128, 3747, K16, 7308, -1004
+        inc  D136
+L193:   dec  D50
+D298:   .data K23, K9, K8, -7464
+; generated comment line
+        bne  r3
+        dec  D3[K10]
+        inc  r2
+        bne  D275
+        rts
+        not  r3
+L194:   prn  r1
+        m7
+        bne  D178
+        sub  #-1112, L163
+        red  D109
+D299:   .data 6943, 7099, 2407, -6399, 6287, K2
+.define K46 = 1
+; generated comment line
+        rts
+L195:   hlt
+        jsr  r1
+D300:   .data K7, -3600
+        jsr  L113
+        not  r3
+        bne  r6
+        add  r5, D14
+L196:   mov  D264, r4
+        hlt
+        lea  D131, L98[11]
+        bne  r7
+        red  r0
+.define K47 = 47
+; generated comment line
+D301:   .string "hctalepqvrytcx"
+L197:   jsr  r6
+        inc  D73[K30]
+.define K48 = 33
+L198:   jmp  D63
+        prn  L179[K44]
+        rts
+L199:   hlt
+L200:   jmp  r6
+.define K49 = 45
+        add  r1, D61
+.entry L18
+        sub  D213, L0
+        rts
+L201:   lea  D248, r1
+        dec  L5
+        lea  L163, L184
+L202:   lea  L54[6], r1
+        hlt
+D302:   .data K0, -4024, -2860, -3950
+        sub  D297[K27], D62[11]
+        rts
+D303:   .string "qkotksfrmzgze"
+        hlt
+        lea  L70[K45], L163
+D304:   .data -1419, 7012, -4290, K34, -7645, 5694, -1760
+        cmp  L12, L147[K31]
+        inc  r1
+        jmp  r2
+        bne  D121
+        rts
+        mov  L79[K15], D147[K23]
+        m4
+L203:   prn  #-374
+D305:   .string "vfmfpyitsvaojvhqcugvtie"
+        not  L145[K3]
+L204:   dec  D298
+D306:   .data K3, -3197, 607, -7706
+
+L205:   rts
+L206:   dec  L68
+        mov  r1, L134[K34]
+L207:   jsr  L101
+        jsr  r5
+        jmp  r3
+        cmp  D227[K9], r5
+        mov  L27, r2
+        cmp  D154, r5
+L208:   inc  L157[K29]
+.define K50 = 61
+D307:   .data -3829, -6085, -41, 6243, -734, 2929
+        cmp  #-1026, r0
+        clr  L47[K42]
+.define K51 = 2
+        jsr  D111
+D308:   .data -6866, 5894, 1922, 565
+        jsr  r5
+.entry D18
+        prn  D202
+
+        clr  L117
+D309:   .string "jbua"
+        clr  r5
+        rts
+        dec  L5
+D310:   .string "jijulpgje"
+        m0
+        not  r1
+        jsr  r6
+D311:   .data -7069, -6262, K47, -3442, -4855, -4403, K32, 1988
+
+        clr  r1
+
+L209:   mov  D59, D37
+        m1
+        sub  r1, L159
+L210:   rts
+        rts
+
+        inc  r5
+D312:   .string "hsoycnxwuecf"
+D313:   .data K21, 5745, -562, -1972, K19, -6571, K50
+D314:   .data K14, K22, K20
+        m0
+        bne  r1
+        add  D72, L78[K20]
+        add  #-1295, D151[K29]
+L211:   red  r6
+L212:   jsr  r4
+.entry L19
+        red  L133
+        prn  L144[K50]
+.entry D19
+L213:   prn  L74
+        prn  #K25
+; generated comment line
+        lea  L113, L168[8]
+D315:   .data -4272, K27, 1861
+L214:   not  D314
+
+L215:   prn  r2
+; generated comment line
+
+        cmp  D111, L211[K11]
+        prn  #488
+        cmp  D26[K9], r3
+; generated comment line
+        dec  L55
+L216:   clr  L82[K19]
+        cmp  L82, D187[4]
+        dec  D137
+L217:   bne  L129
+D316:   .data 2186, 5905
+D317:   .data 4827, -1627, K31, -6606
+        sub  D22, D95
+        sub  #727, D250[K37]
+L218:   mov  #-1823, r5
+L219:   inc  L43[3]
+        add  L158, L164[6]
+        prn  L181
+D318:   .string "xouxgxonzw"
+        jmp  D142
+D319:   .data 6054, 4322, K22
+; generated comment line
+        mov  L192, r1
+        red  D38[11]
+        lea  L80[10], D147
+        add  r5, r3
+        lea  L79[1], L26
+
+D320:   .string "yxelzodktczujhghqqhkal"
+
+; generated comment line
+L220:   sub  L153[1], r4
+        cmp  D314, r4
+D321:   .string "mngtrthmbucoxukonuhp"
+
+D322:   .string "ztyefohr"
+        bne  r3
+
+        lea  L26, r2
+D323:   .data 1451
+.define K52 = 19
+; generated comment line
+        mov  D205[3], L92[K35]
+D324:   .data -7815, -2901, -3720
+L221:   rts
+        lea  D271, r0
+; generated comment line
+L222:   jmp  L21
+L223:   hlt
+
+D325:   .string "jkofpupgdiqxhzakrypvy"
+        cmp  D118, D233[10]
+        m4
+        inc  L60[K42]
+        bne  L149
+D326:   .data -6132, -957
+        m6
+        jsr  L16
+        red  L58
+        m0
+D327:   .string "eritqtskxwba"
+.define K53 = 56
+        lea  D15[10], D97
+        cmp  #-322, D207[9]
+        jsr  L48
+        clr  r6
+        lea  D55[K27], D202[14]
+D328:   .string "dgqoaeueogdfchymmuc"
+; generated comment line
+
+        inc  D53[9]
+        jmp  r0
+D329:   .string "rtey"
+D330:   .data 4230, 2829, 6833, 2964, -6286, 6662, 4453, K6
+; generated comment line
+        hlt
+        hlt
+.define K54 = 36
+        lea  D150, D322[K19]
+        jmp  D244
+
+        rts
+L224:   clr  L68
+D331:   .data 2446, 1398, 7749, 552, K43, -5304, -6944, 4996
+D332:   .data -3087, -2933, 646, 1369, -6349, -3356, K53, 329
+D333:   .data K54, -1900, -4737, 6638, 6464, -5727, -4504
+
+.define K55 = 56
+        add  L95, D183
+        bne  r4
+L225:   jsr  D173
+        inc  D15[K2]
+        clr  D193[10]
+D334:   .string "bqaqjzhbekpfcdvxne"
+        cmp  #1749, L91[1]
+L226:   red  r4
+        cmp  r5, D323
+.entry L20
+        bne  r0
+        red  D260
+; generated comment line
+        not  X8
+D335:   .data 288, -6801, 4416
+        m4
+        lea  X5, L90[K52]
+
+        dec  D199[4]
+L227:   rts
+        m0
+        rts
+        cmp  D143, r6
+        m7
+L228:   dec  r6
+        bne  r6
+L229:   prn  L171
+D336:   .data -2006, -7767, K49, 2192, 3563, 6679, K19, -2421
+        dec  D100
+; generated comment line
+        cmp  #1080, L93[11]
+L230:   sub  r0, r0
+D337:   .data -2205, K52
+        not  D160[K12]
+L231:   jsr  r0
+        lea  L11, D167
+D338:   .data K47, 2317, 6541, 5054, -5764, -5299, K23, 5480
+D339:   .data K1
+        bne  r7
+        rts
+        rts
+.define K56 = 7
+D340:   .data -7637
+        cmp  #-1661, #K1
+        jsr  D234
+.define K57 = 49
+
+        not  r2
+
+
+
+L232:   hlt
+D341:   .data -3146, 7069, 6988, 7979, -6610, 3636
+        not  D147
+        jmp  r7
+        jsr  r0
+D342:   .string "rwpvqysblwjnfzvzr"
+        inc  L179
+        add  L29, L175
+L233:   jsr  r0
+        prn  r0
+        clr  L212[5]
+L234:   dec  D53
+        prn  L17[K33]
+; generated comment line
+.define K58 = 42
+D343:   .string "latvgqgblfpsycnat"
+        jmp  D21
+        inc  D63[2]
+        lea  L137[8], r3
+D344:   .data 587, -3327
+        m7
+D345:   .data 6424
+L235:   inc  D243[K13]
+        m6
+; generated comment line
+        hlt
+        add  D131[K44], D9[4]
+D346:   .string "gstwfezhzdizocyj"
+        m0
+
+        cmp  D86, L139
+D347:   .string "jbledhqufzigtw"
+
+D348:   .data 3780, -4105, -1324, 4778, 4245, 6876, K48, -5448
+
+L236:   sub  r6, r0
+D349:   .data 7122, K40, K1, -1792, 972, 5066
+
+        jsr  D230
+D350:   .string "ndyye"
+        m4
+D351:   .string "daythsfuheurpjmiv"
+        lea  D250[3], r1
+        m5
+        hlt
+
+L237:   sub  #402, r7
+        bne  D71
+
+        m6
+        dec  L12
+; generated comment line
+; generated comment line
+        add  L62[K15], D231[9]
+D352:   .data 1196, 5438, 4140
+        clr  L215
+        add  D270, D115
+; generated comment line
+D353:   .data -5448, 2533, 1864, 6156, 4699, -5828
+        add  L58, L229[2]
+D354:   .data 6058, 147, -3904, 6601, -5378, -1970, 2848
+D355:   .data -5050
+        mov  #-24, r0
+L238:   dec  r3
+D356:   .data 3897
+D357:   .string "vkjsjxwepr"
+D358:   .string "m"
+L239:   jsr  D6
+        rts
+        jmp  r0
+L240:   inc  D224
+        clr  L158[2]
+L241:   lea  D117, L75[15]
+L242:   hlt
+D359:   .string "ulrkmhcn"
+        mov  r3, r6
+        lea  L65, X4
+L243:   mov  r7, D227[K51]
+        m6
+        m7
+L244:   mov  L216, r5
+        jsr  r1
+; generated comment line
+        red  D325[15]
+        dec  L200
+        inc  D61
+D360:   .data 3576
+L245:   jsr  L59
+        not  D147
+; generated comment line
+        clr  r6
+        hlt
+; generated comment line
+        red  L97
+L246:   cmp  #-1992, r5
+; generated comment line
+L247:   inc  L114
+
+D361:   .string "movshpf"
+        m3
+.entry D20
+D362:   .data K50, 2724, 5291, -2201, 1828, -251, 4076, -41
+D363:   .string "osqlcvyubvammgtdqyieli"
+D364:   .data 903, -2275, 7465, K21, 5555
+        cmp  D166[K19], D295[K52]
+D365:   .string "fybbujacflasmlqikialwu"
+L248:   cmp  D303[6], #-1432
+L249:   clr  r4
+; generated comment line
+        inc  L62[11]
+        not  D285[9]
+        dec  L35[K26]
+.define K59 = 62
+
+L250:   rts
+        hlt
+        m2
+        m0
+        dec  L123[9]
+.define K60 = 29
+D366:   .data 3093, K37, -6993
+; generated comment line
+D367:   .string "wnmbudsknufhelfafnio"
+        m3
+; generated comment line
+L251:   lea  D172[2], L227
+D368:   .data 5543, K0, K50, K10, -1460
+        cmp  L204, L175
+D369:   .data 5518, K48, 7947
+        lea  D183, D154[K36]
+        inc  L143
+        sub  r3, D324[5]
+        m7
+; generated comment line
+D370:   .data 1001, -540
+        jmp  D306
+; generated comment line
+D371:   .string "rxptjvzfp"
+
+
+; generated comment line
+L252:   rts
+        bne  r7
+; generated comment line
+L253:   jmp  r4
+L254:   dec  D356
+D372:   .data 388, 1313, K6, K38, 4200, -6702, -137
+        sub  r1, L250[8]
+D373:   .data K39
+        rts
+        sub  #-434, r7
+
+.define K61 = 50
+        add  r3, D231[K34]
+D374:   .string "vwoggaftjbpl"
+        jsr  D116
+        m3
+L255:   cmp  D290[K19], #-259
+; generated comment line
+        sub  L110, D237[K25]
+L256:   red  L239
+        clr  L255[10]
+D375:   .data 5373, 5042, 6316, K16
+D376:   .data K49, K55, 6485, 3577, -5849, 4221, -2668
+D377:   .string "rrdbcpbsml"
+        sub  #-1421, L176
+        sub  L135, L56
+        m7
+D378:   .string "kbdldsrswnzdecxcakiqc"
+        bne  L88
+L257:   add  #1825, r0
+        add  #-1744, r0
+D379:   .string "gkvhsjyn"
+; generated comment line
+        prn  #-1574
+        inc  D26
+.entry L21
+        add  D63[K18], r1
+        hlt
+D380:   .string "ktpbe"
+        sub  L56[K16], r5
+.define K62 = 54
+        jsr  r6
+.define K63 = 41
+        sub  D36[K4], L256
+L258:   dec  L205[K54]
+        dec  L143
+        jmp  r2
+L259:   hlt
+        red  r1
+D381:   .data 3745, K6, K62, -7243, K2, 6408, -5864, 333
+        rts
+
+D382:   .string "lwn"
+        inc  D239[10]
+        dec  X2
+D383:   .string "kvsgouwreejt"
+
+D384:   .data -2595, -464, -4858, 395, K22, -6389, 5561
+L260:   red  D306[5]
+L261:   prn  D49[K21]
+        rts
+D385:   .data 1159, 5683, -4425, 2349, -3447, 3198, -7848
+        cmp  #-1776, #1435
+L262:   bne  r3
+L263:   add  D54[7], L26[K37]
+
+        lea  D300, L205
+D386:   .data K49, K48, 1047, 681, 4611, -6082, -7983
+D387:   .data K4, K17
+D388:   .data -6308, K25, K9, -3459, 1763, K37
+D389:   .data K17
+        jmp  r4
+D390:   .data K25, -3543, -7913, 994, -702, -7732, 5972
+        jmp  D71
+        mov  #-1811, D377[4]
+        jsr  L145
+        m0
+L264:   inc  D284[5]
+        red  D202
+        cmp  D385, r3
+L265:   add  L86, D82
+        jsr  r4
+; generated comment line
+        hlt
+D391:   .data 2049
+L266:   sub  #744, D24
+; generated comment line
+D392:   .string "ntuegknjkywqhugkclrfxyl"
+        hlt
+D393:   .data 1882, 5500, -1952, 404, K54, K12, -4631
+        clr  L8
+D394:   .data K48, 6806, 6974, 7698, 406, 1421, -7084
+        not  D258[2]
+; generated comment line
+
+D395:   .string "dflwph"
+D396:   .string "fsiluewt"
+        jmp  D138
+        prn  #-1189
+        dec  r4
+        prn  #K19
+        rts
+        inc  r1
+        dec  L210[K17]
+        red  D221
+        lea  D284[0], L93[K22]
+L267:   jsr  r0
+        inc  L179
+D397:   .string "yyjbqctgugctz"
+L268:   jmp  L224
+        jsr  r2
+L269:   dec  r0
+        lea  D312[2], D22
+        dec  D73
+        clr  D81[15]
+D398:   .data -6079, 3516, 7841, -5697, -6222
+L270:   hlt
+        clr  L238[K8]
+        red  r6
+        m1
+.entry D21
+; generated comment line
+        red  D187
+        not  L215
+        cmp  #1373, D55[15]
+L271:   jmp  D228
+D399:   .data -4768
+        bne  D60
+        sub  D350[2], D270[K51]
+        not  D280
+        prn  L250
+        hlt
+; generated comment line
+
+        jsr  r4
+        hlt
+        inc  r1
+        bne  D382
+; generated comment line
+
+D400:   .data 2384
+L272:   add  L32, D101[2]
+        hlt
+        bne  D41
+D401:   .data 3894
+        rts
+; generated comment line
+        prn  D67[K41]
+.define K64 = 48
+D402:   .data -5233, K52, 5737, 6142, -6440, K1, -3608, 4288
+        sub  r1, D189[3]
+; generated comment line
+L273:   clr  r1
+        m5
+        jmp  r0
+D403:   .data -282, -7000, 3494, K10, 6694, K44, 1441
+
+L274:   red  L58
+        m3
+        lea  X11, D235
+; generated comment line
+        not  L209
+L275:   clr  r7
+        prn  #-1127
+        sub  #1096, r4
+        not  r7
+L276:   red  D81[15]
+        lea  D342[11], D350[9]
+        clr  D43[K42]
+.entry L22
+        red  r7
+        jsr  r2
+        hlt
+        jsr  L71
+        bne  D282
+        bne  D155
+D404:   .data 5286, K13, K33, -2473, K40, -6471, K49
+.entry D22
+        m5
+        red  D120[K25]
+; generated comment line
+D405:   .data 5897, 182, -1710, 3786, K30, 3949, K25
+        cmp  #-1222, #K37
+
+L277:   jsr  D354
+        add  r0, r3
+        lea  D296, D350[K37]
+        dec  L156
+L278:   mov  D343, r3
+        jmp  r4
+D406:   .data 1700, -2563, -1675, 7528, K12, 3659
+        cmp  D22[K28], r5
+
+
+        hlt
+D407:   .string "rjlfbfrhfuwcrkctknfu"
+        jsr  D187
+D408:   .data -7497, 3834, -3034, 342, -2733, K37, -2965
+        m5
+; generated comment line
+D409:   .data K51, -3284, 1764, 5544, K63
+        sub  D71, D388
+        jsr  r5
+        prn  D7
+        not  D129[K29]
+        red  D88
+; generated comment line
+L279:   clr  D165[K64]
+D410:   .string "bevdytuvoncnpqhke"
+.define K65 = 29
+        jsr  r6
+L280:   inc  L120[13]
+        prn  r1
+        inc  r4
+D411:   .data 6758, 5791, -3387, K5, -1670
+        mov  D257[15], r5
+D412:   .string "zd"
+        prn  r3
+        m1
+.define K66 = 62
+D413:   .data -5634, K49, K35, K11, -75, K8, 1717, K26
+.define K67 = 48
+.define K68 = 27
+        m1
+D414:   .string "ophltqvekrdzykn"
+        lea  D158, D270[K12]
+D415:   .data -5700, 1610, 1739, 2362, K19, 6514
+
+L281:   add  L113, r1
+L282:   hlt
+; generated comment line
+; generated comment line
+        clr  D399[11]
+        hlt
+D416:   .data K28, -1060, 7022, -1119
+L283:   rts
+D417:   .data 2136, K36, K16, 7327
+        lea  D352, r5
+D418:   .data K10, -7342, K6, -5795, -3119, 924, K35, 6538
+        clr  L279
+L284:   prn  r2
+; generated comment line
+        sub  L182, r3
+        m7
+        dec  r0
+        sub  r2, D244[K2]
+.define K69 = 11
+D419:   .data -3169, K19, K23, K8, 4036
+        jmp  r6
+D420:   .data K53, K38
+L285:   lea  D186[K48], D194
+        sub  L161[0], D287
+
+        dec  D16
+        red  r6
+        red  r1
+D421:   .data K16, K62, 6120, 7831
+        inc  r0
+        jsr  r1
+        sub  #-1124, D114[K5]
+L286:   jsr  L237
+        jsr  r1
+L287:   jsr  D244
+L288:   jmp  D203
+L289:   mov  D274[K6], D58[K46]
+
+L290:   mov  L274, r1
+D422:   .data -4426, 726, -1605, -1593, K2, -7229
+D423:   .data -1464, 3498
+
+        sub  r6, L265
+L291:   bne  r7
+        cmp  L82, #1308
+        m6
+; generated comment line
+; generated comment line
+D424:   .string "fs"
+D425:   .data 5174, -2577, K40, 2159, K43
+        m5
+D426:   .data 4979, -4557, K62, -5049, K19, -3923, 1130
+        red  D205
+D427:   .string "quifswovanrdzfbf"
+; generated comment line
+        bne  r1
+        bne  r3
+        jsr  L210
+L292:   not  L48[11]
+        rts
+        mov  L86[13], D24
+        hlt
+D428:   .data 2139, -4696
+        m0
+        mov  r3, L77[K68]
+        inc  r1
+D429:   .data -4664, -4694
+D430:   .data K40
+        mov  D94[14], r3
+
+L293:   mov  D9[1], D84
+D431:   .data 1306, -3071, -1968, 138, K10, -6225, -5334, 1004
+        jsr  L8
+        bne  r2
+        prn  L174
+D432:   .string "yiakmdr"
+L294:   bne  D42
+L295:   sub  #-1282, L262
+L296:   mov  r0, r0
+        cmp  D430, r2
+D433:   .string "vchukjnbgaa"
+        mov  #-862, L221
+        jmp  D276
+        m5
+        inc  D267[2]
+        not  r0
+        not  D273
+.entry L23
+        prn  L239[K63]
+; generated comment line
+        lea  L137[K53], r5
+D434:   .data 1379, -4783, K4, -3213, -2495, -6337, 5495
+        add  #-960, D77[5]
+D435:   .string "ynzb"
+        m7
+        cmp  r2, L33
+        hlt
+D436:   .data -2683
+        sub  r6, L133[K11]
+        clr  r5
+D437:   .string "ezbar"
+        rts
+        jsr  D385
+
+L297:   cmp  D8[14], r3
+        prn  #681
+        not  r1
+.entry D23
+.define K70 = 48
+L298:   mov  D367, L273[K49]
+        add  D363, L37[5]
+        red  D209
+        not  r2
+L299:   red  r1
+        m1
+.define K71 = 54
+D438:   .string "rgjybdeqgr"
+D439:   .data 7528, -19
+        sub  #-55, r0
+L300:   jmp  r3
+D440:   .string "uwwhce"
+        cmp  r5, L220
+        bne  r0
+
+D441:   .string "gfpesxfwapyiqx"
+.define K72 = 17
+        mov  #342, D308[15]
+L301:   add  D365, L61[11]
+        m7
+        rts
+        not  D358
+L302:   not  D53[K70]
+D442:   .data 1966, -1605, 6144, K54, -6434, -3638, 3669, -5034
+D443:   .string "dwtmyztjewvwlvwjphtqv"
+        inc  r0
+D444:   .data -5078
+        m5
+D445:   .data K49, -1461, K50
+        sub  #281, D403[K2]
+D446:   .data K65, -3045, K33, 5358, K20
+        m1
+        mov  L159[K28], r6
+.define K73 = 9
+        hlt
+        jsr  D213
+        jsr  L215
+L303:   dec  D388[K20]
+        bne  L93
+L304:   cmp  r4, L118[K1]
+        prn  D79[12]
+L305:   add  #1848, D14[K25]
+
+; generated comment line
+        m2
+        inc  r6
+L306:   hlt
+; generated comment line
+        bne  r3
+
+L307:   cmp  L269[15], #9
+        m2
+        inc  D264[15]
+        mov  D235[12], D23[2]
+; generated comment line
+D447:   .data 6703, -6007, -4649, K0
+D448:   .data K31
+        lea  L301[1], L303[8]
+.entry L24
+        prn  #712
+.define K74 = 44
+        dec  D386[12]
+        rts
+        m3
+        inc  L213
+        jmp  L203
+        add  r3, L119
+D449:   .data -6726, 4373, 5620, 3510, 7687, 4286, 575
+        inc  r2
+        lea  D413[8], r3
+        add  D50[0], D151
+D450:   .data 3286, 7310, K50, -4298, 6588, 5879
+D451:   .data -4193, -7752, -6126, 927, 2879, K40, 403, K45
+; generated comment line
+D452:   .data -5122, 2240, 1161
+        sub  #-1110, D127
+
+        jmp  r5
+D453:   .data -590, K3, -3907, -6883
+D454:   .data -905, K31, -5655, K44, 6830, 5662, 3616
+        m4
+        not  r2
+        prn  #K38
+.entry D24
+
+D455:   .data 4579, -752, 3934, -6667
+        m2
+        prn  D230[K1]
+        bne  r7
+L308:   sub  #-1004, r5
+D456:   .data -3290, -5188, K10, K59, 4236
+        bne  r2
+L309:   jmp  r7
+; generated comment line
+        hlt
+L310:   jsr  r2
+L311:   lea  D394, r5
+        red  D63[K64]
+L312:   bne  D50
+        clr  r0
+        jmp  D151
+.entry L25
+        prn  #K48
+D457:   .string "rbgawucqtynsxgdemfcfwvad"
+        add  L83, D445
+        bne  r2
+
+D458:   .data 124
+        prn  L53[K27]
+        add  #494, D144[K21]
+        sub  r6, D162
+L313:   mov  D96[0], D20
+        dec  D303[K72]
+; generated comment line
+        jmp  L191
+L314:   clr  D28[15]
+        mov  D418[13], L135
+        rts
+D459:   .data 1256, K10
+D460:   .string "jfxftrjlhdhmwgfsaxa"
+        not  D300
+.define K75 = 36
+        red  D222
+        jmp  r0
+D461:   .data 6058, 3954, 33, 5220
+        not  D14
+        add  D150[13], D449[K66]
+D462:   .data 1077
+        mov  #-1491, r5
+        inc  D197
+        clr  L206
+D463:   .data -644, 177, 3127
+        clr  D129
+
+D464:   .data K31, -3213, -2621, -5404, -1460, 4653
+L315:   bne  D194
+.entry D25
+        hlt
+        hlt
+L316:   add  L129, r3
+        dec  L305
+D465:   .string "tyvkmopu"
+
+        m5
+        red  L23[8]
+L317:   sub  r1, r3
+.entry L26
+D466:   .data -7460, -6713, -4944, 2412, K20, 4030
+.entry D26
+        red  L138[K40]
+L318:   add  L105[9], L87[K60]
+        not  L280[0]
+        bne  L143
+; generated comment line
+        m0
+        add  D265[K32], D38[2]
+        bne  L72
+L319:   jsr  L18
+        sub  D229, D212[12]
+; generated comment line
+L320:   cmp  r3, r4
+        not  D294[9]
+D467:   .data K47, -4633, K40, K56, -7681, 3700, -356
+; generated comment line
+        m7
+D468:   .string "dne"
+        m2
+D469:   .data -6195, -6945, K20, K10
+        dec  L316[K47]
+; generated comment line
+        m3
+        jmp  L222
+.define K76 = 37
+        cmp  #-1091, r4
+L321:   lea  L143, D369[K13]
+D470:   .data -6112, 6844, 1815, K73, K54, K13
+D471:   .data K50, -4599, -4815, -3791, K62, K16, 3394, 2366
+L322:   red  r6
+; generated comment line
+        prn  r6
+        add  r7, L27
+        mov  L223[11], r5
+        hlt
+        mov  L303[0], L320[4]
+L323:   bne  D0
+        clr  D11[5]
+        dec  r5
+D472:   .string "sppe"
+        sub  D187, r1
+L324:   dec  D157
+; generated comment line
+D473:   .data K51, 3424, -104, K18, K70, -2898, -4566
+        lea  D205[K61], D222
+        jsr  r6
+; generated comment line
+; generated comment line
+; generated comment line
+D474:   .data -6490, 3809, -5984
+.entry L27
+D475:   .data -7367, 846, -669, -5295, -561, 4684, K14, 6011
+        m5
+        red  D279
+        rts
+        prn  D17
+        prn  r6
+D476:   .data -5645
+        bne  r5
+        jsr  r1
+L325:   jmp  r4
+L326:   sub  #-437, D427[K58]
+        add  #-1338, L85[K64]
+D477:   .string "xhrxrrppd"
+        add  D236, r1
+D478:   .data 2141, -4196, 2659, -3174, 3637
+L327:   mov  D346[K75], L66[K65]
+; generated comment line
+        not  r7
+D479:   .data K22, -2322, 5265, 1662
+L328:   dec  L290[K9]
+D480:   .data -4809, -2759, K55
+        mov  L263, r1
+        mov  #-1121, L14
+        lea  D416[10], L184[9]
+        inc  D254
+L329:   add  L163[K67], r1
+D481:   .data 2466, -3292, 2365, 3637, 2738, -6890, 5213, -2558
+        m4
+        clr  r6
+L330:   lea  L97, D396
+        add  r6, D244
+; generated comment line
+        dec  r1
+        hlt
+        mov  X10, D455[2]
+        bne  r6
+        hlt
+        lea  D270, D325[8]
+; generated comment line
+        cmp  L105[15], D34[K46]
+        clr  r2
+        prn  #K59
+        cmp  L220, r4
+D482:   .data K21, -2399
+D483:   .string "vozjpihspbqelzxr"
+.entry D27
+        red  L13
+        bne  L180
+L331:   not  D147
+        jmp  r5
+        red  D462
+.entry L28
+L332:   bne  r4
+D484:   .string "o"
+        bne  r3
+D485:   .data 5703, -7898, 5141, -7315
+        prn  #K0
+
+D486:   .string "dewgshioqrggdneptfg"
+; generated comment line
+        jmp  D86
+        rts
+        prn  D337
+        jmp  r0
+        red  D240
+L333:   dec  L105
+D487:   .data 4914, -4292, -5692
+L334:   jmp  L313
+.define K77 = 4
+        add  #-963, r4
+        jsr  X8
+        mov  D463[2], D17[1]
+        cmp  #953, #K27
+L335:   sub  D130, r0
+
+        rts
+        sub  L132, r7
+        hlt
+
+D488:   .string "n"
+        sub  #216, D409[8]
+        dec  L328
+        sub  L202, D109[K36]
+        clr  r2
+        inc  D377[K19]
+; generated comment line
+L336:   lea  D81, r4
+
+L337:   mov  D476[6], L100[3]
+        add  L20, D179
+        sub  #1921, L50[K59]
+        sub  #-1837, r7
+        hlt
+        cmp  D249, #K76
+D489:   .data -5545, 4124, K12, K61, -7741
+L338:   bne  D101
+.define K78 = 55
+        mov  #1756, r6
+D490:   .data -7573, K45
+; generated comment line
+L339:   not  D272[K64]
+        mov  L227[K41], L165[K50]
+        m7
+.define K79 = 14
+        jmp  D379
+        add  D485[K44], L296[11]
+; generated comment line
+        m4
+        not  L147
+D491:   .data -38, 7667, 4536, 2584, K26, -3930
+L340:   bne  r1
+        rts
+D492:   .string "dcmfdqkrrynvjgfqf"
+        hlt
+        bne  L130
+        m5
+D493:   .data K58, K24, 7228, -629, -4490, K75, -4908, 5877
+        clr  r3
+.entry D28
+        prn  #K33
+D494:   .data 5621, -6290, 3733, 6207, K61, 7165, 873, K53
+.entry L29
+L341:   sub  L169[13], L102[13]
+        mov  D463[K78], D460
+D495:   .string "phshfjmwgnyjdswexrvnyes"
+        jsr  r4
+        m3
+D496:   .data -745, 7793, 7295, 4874, K68, K46, -3373
+L342:   clr  L212[10]
+        m1
+        add  D282, r0
+L343:   dec  L332
+L344:   sub  X14, D382
+
+        prn  D412[K57]
+L345:   rts
+        hlt
+D497:   .string "jjolmoifwq"
+        m4
+        jmp  r5
+        bne  L289
+        red  L197[K22]
+        bne  r6
+        dec  L127
+        lea  L144, L303[K68]
+        sub  L149[15], D77[K3]
+        mov  #1082, L294
+D498:   .string "yvjhihxyhywvxeckrswqoct"
+
+D499:   .data -7102, -3390, K49
+D500:   .string "qxgffidpn"
+L346:   red  L85[6]
+D501:   .data K0, 6275, -1378, -5888, -2055, -3503, -7122
+
+L347:   rts
+        add  D448, r0
+        rts
+.entry D29
+D502:   .string "enn"
+D503:   .data 494, 2236
+        bne  r4
+        m1
+        rts
+.define K80 = 60
+D504:   .string "cxwdp"
+
+        jmp  D290
+
+        jsr  D312
+        rts
+        not  r1
+D505:   .data 7623, 1768, K62, 6226, -4229, -3736
+        lea  D364, D76
+        inc  D410
+L348:   clr  D121[4]
+
+        jmp  r4
+        inc  r2
+
+L349:   dec  r7
+L350:   sub  D257[K31], L79[K9]
+D506:   .data -1911, 4002, -4749, -7681, -5661
+L351:   clr  r2
+; generated comment line
+        jsr  D87
+D507:   .data -4138, 3895
+D508:   .data -7101, -4990, 5457, 3081, -2207, 968, K41, -1029
+        rts
+        prn  #-756
+.define K81 = 30
+D509:   .string "bknbjqyezkjpkcabvr"
+L352:   prn  L211
+        not  D235[K36]
+        red  L117
+        clr  D335[11]
+
+        m0
+        m7
+        dec  r6
+D510:   .data 4508, 7492, 6757, K12
+.entry L30
+L353:   jsr  r6
+D511:   .data -4986, K30, -5555, 3741, 300, 5841
+        inc  L27
+        jsr  r7
+        rts
+D512:   .data -5488, 3741, 3333, -2001, -157, -5087, 4103, K44
+
+        hlt
+        jsr  D423
+        not  D448[K65]
+D513:   .data -5436, -7532, K73, 6296
+D514:   .string "pkwaolxdpyzoixdlc"
+D515:   .data 1912, -1220, -2864, K46, K72, -2875, 4554
+        sub  r2, X11
+D516:   .data 1762, -5906
+L354:   bne  r5
+D517:   .string "vmmvnxmmx"
+        not  L52[0]
+D518:   .string "ypdocxiiurffqxmgrzhcagof"
+        sub  L310[K38], L280
+        prn  L210[K25]
+        m1
+; generated comment line
+        bne  D113
+        inc  r0
+END:    hlt
@@ -0,0 +1,59 @@
+.define d0 = 21
+.define d1 = -2+d0
+.define d2 = (d0/d0+7-3+(15)-d0/d1)
+.data (7), d0*5/-d1/(d1)
+.data d2-d2/d0*(-20-15), --(d0)/(4)
+.define d3 = d1
+.data d2/15/(-24)
+.define d4 = 1*23*30-18-d3/d0-12/12*d3*d0
+.data -(11)-24+-(6), 26+1*21/5, (d4-9)
+.data (8)
+.data (5-d0+16*d4-d0), (8), (d4)
+.define d5 = d1+d3-(16)*6+d0+3*d0
+.define d6 = d2-7-6+9*d4
+.data (9)
+.define d7 = 7
+.define d8 = d7
+.define d9 = 5+-d4-16/21-23+19-27/d5-d7
+.data (8), (9), (7)
+.define d10 = d8-d9
+.data (4), (d7/-d5/d5), 23/9
+.define d11 = --(d1)+21
+.data (8)
+.data (4), (1)
+.define d12 = (d8/d2/4/1/d11-d4)
+.data d9+d12, d3/(d6)+d10*30+-23
+.data -d8, (5), d12-2-d6/d9+d0
+.define d13 = (17*d10+d1*d5*(10-d0))
+.data --d12/d6-d0
+.define d14 = --11+d11*d7+27/6/10
+.data (5)
+.define d15 = d4
+.define d16 = d4
+.define d17 = --d14-d15-d3*27--d8+20+d10
+.define d18 = d6
+.data (-18+(22)), (-d1+3-7-d6-6)
+.define d19 = d6
+.data d13/-d10+13+1
+.data 16+26, (4), (3)
+.define d20 = 30/(-d5-6*d16)
+.define d21 = 28+-d4*15/2
+.define d22 = d20+(5)*(d11+18)*19
+.define d23 = -8-28/d0*29
+.define d24 = 2/d5/d3
+.define d25 = d19-d23+1--3/9/d10
+.data (4), -d3--d1-2, 12+18
+.data d3/30
+.data (5), (21), (5)
+.define d26 = d22
+.data (9), -(-d20)*d8
+.data (7), (5), (4)
+.define d27 = d25/(10)
+.data (4)
+.data (2), (4)
+.data (7)
+.data (1), (3)
+.data (8), (1)
+.define d28 = -d26+20+d21/15+d1-d20/5
+.data d0*((25)+d12/22), d28+d0/28, (8)
+hlt
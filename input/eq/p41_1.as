@@ -0,0 +1,76 @@
+.define k = 3
+.extern X1
+L1: cmp r7, #-2
+L0: red r6
+add r1, r2
+cmp DAT[2], #1
+L10: mov r6, r6
+clr L1
+ dec r3
+inc r3
+red r0
+red r1
+L6: mov r5, r6
+red r3
+jmp L7
+jmp L0
+ dec L5
+inc L5
+jmp L6
+ inc r6
+inc r6
+clr L1
+jmp L6
+jmp L7
+jmp L0
+red r2
+jmp L6
+ dec X1
+dec X1
+mov r5, r5
+L5: jmp L8
+L8: hlt
+lea DAT, r2
+L11: mov r0, r0
+cmp r2, #-2
+L9: red r4
+cmp DAT[k], #k
+dec r1
+cmp L0, #-2
+L3: inc L6
+bne L7
+jmp L6
+bne L6
+L4: mov r3, r4
+ dec r2
+L2: inc r2
+L7: jmp L3
+cmp r0, #1
+bne L6
+ dec r6
+inc r6
+red r4
+cmp r2, #k
+
+ inc r7
+inc r7
+cmp r3, #k
+ inc r7
+inc r7
+ inc r2
+dec r2
+jmp L9
+red r1
+cmp DAT[k], #1
+; comment
+cmp DAT[2], r1
+cmp DAT[1], #k
+bne L5
+bne L0
+lea DAT, r2
+ inc r6
+dec r6
+red r1
+ hlt
+DAT: .data 1, 2, 3, k
+.entry L2
@@ -0,0 +1,78 @@
+.define k = 3
+.extern X1
+dec L3
+bne L2
+ inc r5
+L7: inc r5
+ dec r4
+dec r4
+mov r3, r6
+L0: cmp r4, #k
+inc r5
+cmp r4, #1
+
+L11: red r2
+ dec r3
+L2: dec r3
+bne L2
+cmp r7, #-2
+ inc r0
+dec r0
+cmp r2, #-2
+red r4
+jmp L1
+L1: inc r2
+mov r5, r5
+cmp r6, DAT[1]
+mov r1, r1
+
+mov r6, r7
+cmp DAT[k], #-2
+mov r3, r3
+; comment
+; comment
+ inc r4
+inc r4
+cmp L2, #-2
+cmp L6, #k
+ dec DAT[2]
+inc DAT[2]
+ inc L0
+dec L0
+red r3
+L6: add r1, r2
+ dec r3
+dec r3
+jmp L4
+L4: prn r1
+cmp r7, #k
+dec DAT[2]
+L8: mov r5, r5
+L10: jmp L4
+ inc L0
+inc L0
+cmp L7, r0
+
+jmp L9
+ inc r0
+dec r0
+jmp L2
+ inc r5
+dec r5
+L5: bne L9
+dec L5
+jmp L7
+L3: mov r2, r2
+L9: red r5
+red r0
+red r3
+cmp L5, #1
+add r1, r2
+cmp r6, #k
+cmp r6, #1
+; comment
+ inc L4
+dec L4
+jmp L0
+ hlt
+DAT: .data 1, 2, 3, k
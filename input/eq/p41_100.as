@@ -0,0 +1,69 @@
+.define k = 3
+.extern X1
+L7: red r2
+not r1
+mov r1, r1
+mov r3, r3
+sub #4, r3
+mov r5, r5
+
+inc r6
+cmp L2, #-2
+L0: red r3
+not r1
+L10: add r1, r2
+bne L8
+bne L5
+ dec r5
+inc r5
+red r6
+
+bne L8
+red r4
+L6: cmp DAT[2], #-2
+jmp L3
+jmp L5
+L5: hlt
+; comment
+L8: cmp r1, r2
+mov r7, r7
+red r0
+red r2
+L2: cmp r4, #1
+inc r7
+inc DAT[k]
+red r6
+
+L3: red r6
+mov r4, r4
+L9: cmp r1, #1
+inc L7
+L1: mov r5, r2
+L4: bne L0
+jmp L2
+cmp r4, #-2
+
+bne L2
+jmp L3
+ inc r1
+dec r1
+jmp L7
+L11: jmp L2
+jmp L2
+jmp L1
+ dec L7
+dec L7
+red r3
+jmp L2
+lea DAT, r2
+cmp r4, #-2
+jmp L3
+mov r5, r1
+mov r4, r7
+cmp r5, #-2
+bne L1
+jmp L5
+inc DAT[1]
+ hlt
+DAT: .data 1, 2, 3, k
+.entry L2
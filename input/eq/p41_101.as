@@ -0,0 +1,76 @@
+.define k = 3
+.extern X1
+cmp r5, #-2
+ dec DAT[k]
+inc DAT[k]
+L7: lea DAT, r2
+L5: cmp DAT[k], r6
+mov r5, r5
+ inc r6
+dec r6
+L9: cmp r0, #1
+; comment
+dec r2
+ inc L7
+dec L7
+cmp L0, #1
+jmp L7
+L10: sub #4, r3
+red r3
+red r7
+red r1
+red r5
+mov r5, r5
+L6: mov r2, r2
+mov r5, r5
+red r2
+L8: inc DAT
+cmp X1, #k
+L1: cmp L6, #-2
+cmp L2, #1
+bne L5
+jmp L3
+L3: prn r1
+ inc r6
+dec r6
+cmp L5, DAT[k]
+cmp DAT[1], #1
+L11: bne L9
+ inc DAT[2]
+dec DAT[2]
+mov r1, r7
+sub #4, r3
+red r1
+cmp r1, #-2
+L4: prn #k
+ inc r3
+inc r3
+red r2
+ inc r1
+inc r1
+ inc r0
+inc r0
+cmp r6, #-2
+red r5
+cmp r3, r3
+L0: dec r3
+cmp DAT[1], #1
+dec r5
+
+L2: mov r0, r0
+mov r6, r6
+mov r2, r2
+mov r2, r2
+not r1
+red r3
+cmp r2, #k
+ inc r0
+inc r0
+ dec r5
+dec r5
+mov r7, r6
+add r1, r2
+mov r7, r7
+ hlt
+DAT: .data 1, 2, 3, k
+.entry L1
@@ -0,0 +1,75 @@
+.define k = 3
+.extern X1
+ inc NOPE
+L9: dec NOPE
+mov r2, r6
+jmp L1
+jmp L7
+bne L8
+L10: inc r1
+dec r6
+ dec r3
+L2: dec r3
+lea DAT, r2
+jmp L7
+mov r1 r2
+jmp L3
+L3: rts
+red r2
+red r0
+red r2
+clr L1
+ inc r2
+inc r2
+cmp r2, #-2
+ inc r1
+L5: dec r1
+not r1
+ inc NOPE
+inc NOPE
+; comment
+
+cmp r2, r6
+L4: cmp r6, #-2
+jmp L7
+L7: rts
+prn #k
+L0: bne L2
+ inc r5
+L11: dec r5
+prn #k
+L8: red r2
+inc r1
+red r0
+ dec L2
+inc L2
+mov r1 r2
+red r1
+bne L1
+jmp L3
+bne L6
+red r2
+lea DAT, r2
+red r3
+bne L6
+L6: inc L1
+cmp r0, #1
+L1: red r6
+cmp DAT[k], #k
+; comment
+red r1
+cmp r4, #-2
+clr L1
+bne L4
+bne L3
+inc r3
+jmp L8
+jmp L8
+prn #k
+ dec DAT[zz]
+inc DAT[zz]
+lea DAT, r2
+
+ hlt
+DAT: .data 1, 2, 3, k
+.entry L2
@@ -0,0 +1,71 @@
+.define k = 3
+.extern X1
+inc DAT[2]
+prn #k
+red r1
+mov r0, r0
+bne L9
+cmp r6, #1
+jmp L9
+L9: prn r1
+red r7
+bne L4
+L2: mov r4, r7
+mov r1, r1
+mov r1, r4
+L8: jmp L6
+L6: inc r2
+red r2
+mov r4, r3
+jmp L3
+L1: jmp L6
+mov r2, r2
+bne L3
+red r4
+cmp r0, #k
+L10: jmp L1
+dec DAT[k]
+; comment
+red r5
+cmp r7, #-2
+L5: red r0
+L0: 
+L11: bne L6
+cmp r1, #-2
+red r0
+; comment
+cmp r1, DAT[k]
+inc r7
+L4: bne L8
+red r7
+bne L4
+mov r2, r2
+jmp L5
+dec r1
+red r2
+ inc r4
+inc r4
+red r2
+dec X1
+jmp L0
+cmp r4, L5
+L7: mov r4, r4
+red r0
+red r3
+mov r4, r4
+mov r4, r4
+ dec r3
+L3: dec r3
+mov r2, r2
+jmp L7
+red r4
+cmp DAT[2], #-2
+jmp L9
+ inc L1
+inc L1
+jmp L6
+ dec DAT[2]
+inc DAT[2]
+ hlt
+DAT: .data 1, 2, 3, k
+.entry L2
@@ -0,0 +1,70 @@
+.define k = 3
+.extern X1
+red r3
+mov r2, r0
+mov r2, r2
+ dec L3
+dec L3
+cmp r0, #k
+red r0
+L9: add r1, r2
+cmp r1, #1
+L11: inc DAT[k]
+cmp L0, #-2
+cmp r0, #-2
+cmp r6, X1
+bne L4
+L0: 
+
+jmp L0
+L1: cmp r7, #-2
+; comment
+inc L2
+L5: red r6
+cmp r3, #1
+jmp L6
+L6: rts
+red r7
+L7: mov r4, r4
+jmp L0
+cmp r7, #k
+L10: red r7
+cmp r0, #1
+cmp r1, #k
+ inc r7
+L8: inc r7
+lea DAT, r2
+red r3
+cmp L2, #-2
+inc L3
+mov r5, r5
+L2: lea DAT, r2
+L3: red r7
+L4: jmp L4
+cmp DAT[2], #1
+cmp r3, #-2
+mov r5, r7
+bne L5
+mov r7, r0
+bne L8
+not r1
+ inc r2
+dec r2
+jmp L4
+add r1, r2
+ dec r5
+inc r5
+jmp L5
+; comment
+not r1
+clr L1
+mov r4, r1
+
+red r1
+jmp L3
+jmp L8
+prn #k
+ inc r2
+dec r2
+ hlt
+DAT: .data 1, 2, 3, k
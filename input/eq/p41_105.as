@@ -0,0 +1,75 @@
+.define k = 3
+.extern X1
+ dec DAT[1]
+dec DAT[1]
+
+L2: mov r6, r6
+L7: jmp L7
+bne L2
+red r4
+L6: red r1
+prn #k
+red r6
+mov r1 r2
+jmp L7
+jmp L8
+ inc DAT[k]
+L9: dec DAT[k]
+red r0
+cmp L2, r6
+jmp L2
+L1: inc r4
+ inc r1
+inc r1
+jmp L1
+L3: cmp r5, #k
+mov r7, r2
+mov r3, r3
+L11: inc r5
+dec r6
+L4: cmp r4, #1
+mov r1, r1
+bne L5
+bne L7
+ inc r0
+dec r0
+cmp r0, #1
+mov r7, r7
+add r1, r2
+red r5
+bne L7
+jmp L1
+L0: mov r1, r1
+ dec r4
+dec r4
+bne L8
+cmp r5, #-2
+cmp L6, #k
+mov r0, r0
+not r1
+mov r1 r2
+bne L5
+clr L1
+mov r7, r7
+ inc r7
+dec r7
+L10: cmp r4, #-2
+inc r7
+ inc r5
+inc r5
+dec r3
+
+not r1
+ dec DAT[k]
+L8: inc DAT[k]
+ inc DAT
+inc DAT
+ inc r6
+dec r6
+cmp DAT[1], #k
+cmp DAT[1], #1
+L5: jmp L0
+dec r2
+ hlt
+DAT: .data 1, 2, 3, k
+.entry L2
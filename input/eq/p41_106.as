@@ -0,0 +1,74 @@
+.define k = 3
+.extern X1
+red r0
+jmp L7
+L7: prn r1
+cmp r5, #-2
+cmp r2, r5
+cmp r2, #1
+L5: mov r2, r5
+jmp L9
+L9: inc r2
+cmp r3, #k
+jmp L2
+L2: rts
+red r5
+inc r6
+not r1
+bne L2
+L0: clr L1
+bne L8
+ inc L3
+inc L3
+mov r3, r3
+jmp L1
+L1: prn r1
+red r1
+; comment
+L10: jmp L1
+cmp r3, #1
+mov r2, r2
+inc r5
+; comment
+add r1, r2
+L11: red r5
+inc r5
+jmp L5
+jmp L6
+L6: hlt
+jmp L2
+dec DAT[1]
+red r3
+red r0
+ dec r7
+inc r7
+ dec r1
+inc r1
+ inc DAT[1]
+L4: dec DAT[1]
+add r1, r2
+L8: add r1, r2
+L3: red r1
+cmp L7, #-2
+; comment
+jmp L9
+cmp DAT[k], #1
+jmp L5
+jmp L0
+jmp L5
+mov r1, r7
+bne L2
+cmp L7, r5
+bne L1
+
+ dec r3
+inc r3
+bne L1
+jmp L5
+red r3
+mov r7, r1
+; comment
+red r7
+red r3
+ hlt
+DAT: .data 1, 2, 3, k
@@ -0,0 +1,73 @@
+.define k = 3
+.extern X1
+jmp L6
+L6: prn r1
+ dec L1
+inc L1
+red r4
+cmp r3, #-2
+mov r2, r2
+L8: cmp r6, #1
+inc r4
+red r4
+L3: jmp L9
+cmp L3, L7
+jmp L8
+L0: dec r1
+L10: red r4
+inc r5
+red r6
+L9: dec DAT[2]
+cmp L0, #k
+red r7
+L11: red r5
+red r5
+L2: red r2
+cmp r1, r2
+inc r2
+cmp L4, #-2
+L4: bne L3
+jmp L5
+L5: hlt
+jmp L7
+ inc r2
+dec r2
+mov r6, r6
+mov r7, r7
+sub #4, r3
+cmp DAT[k], r1
+mov r3, r3
+mov r5, r5
+ dec r6
+dec r6
+dec r6
+cmp DAT[1], #1
+not r1
+jmp L3
+ dec r6
+dec r6
+L1: inc DAT[1]
+red r5
+ inc r7
+inc r7
+cmp r4, #k
+clr L1
+dec L1
+red r2
+ dec r5
+inc r5
+add r1, r2
+red r3
+L7: 
+cmp r1, #k
+cmp r0, #k
+bne L6
+cmp L7, #1
+cmp r2, r4
+ dec L2
+dec L2
+
+cmp r6, #k
+cmp r4, #1
+ hlt
+DAT: .data 1, 2, 3, k
@@ -0,0 +1,75 @@
+.define k = 3
+.extern X1
+L1: red r6
+ inc r4
+dec r4
+L4: mov r6, r6
+red r6
+mov r1 r2
+red r7
+L7: red r3
+not r1
+mov r1, r1
+red r1
+cmp r7, #k
+sub #4, r3
+jmp L0
+L0: inc r2
+cmp L2, #-2
+mov r5, r5
+ dec r4
+dec r4
+L11: cmp r2, #k
+L10: bne L6
+L2: jmp L2
+mov r1, r5
+dec r6
+bne L8
+mov r7, r7
+red r7
+mov r7, r3
+ inc DAT
+dec DAT
+cmp NOPE, #-2
+L3: red r2
+ dec r1
+inc r1
+red r6
+ dec L4
+L6: inc L4
+; comment
+cmp r6, #-2
+mov r2, r0
+ dec r7
+dec r7
+red r1
+L8: red r1
+ inc DAT[2]
+inc DAT[2]
+ dec DAT[zz]
+inc DAT[zz]
+mov r7, r6
+add r1, r2
+cmp r6, L5
+add r1, r2
+jmp L9
+jmp L1
+red r2
+ inc r1
+inc r1
+cmp r4, #1
+bne L4
+; comment
+L5: mov r1 r2
+mov r4, r4
+mov r2, r2
+jmp L9
+L9: inc r2
+sub #4, r3
+jmp L4
+cmp DAT[k], r5
+cmp r5, #1
+cmp L6, r2
+cmp r5, #-2
+ hlt
+DAT: .data 1, 2, 3, k
@@ -0,0 +1,69 @@
+.define k = 3
+.extern X1
+ inc L1
+dec L1
+jmp L3
+L3: prn r1
+bne L4
+jmp L8
+L8: rts
+mov r5, r5
+L2: red r7
+L7: cmp r0, r6
+L6: bne L7
+jmp L1
+L5: inc DAT[k]
+dec DAT[1]
+cmp r7, #k
+cmp DAT[2], #k
+L10: cmp r5, #-2
+cmp DAT[k], r7
+red r4
+bne L6
+mov r1, r3
+inc DAT[1]
+L9: cmp r2, #1
+bne L2
+red r0
+cmp r5, L2
+jmp L8
+
+cmp r4, #k
+cmp DAT[k], #-2
+jmp L6
+L0: jmp L4
+jmp L9
+jmp L9
+ dec DAT[1]
+inc DAT[1]
+L4: clr L1
+jmp L5
+L1: bne L2
+cmp r5, r1
+bne L0
+red r3
+jmp L4
+mov r6, r0
+L11: not r1
+red r3
+clr L1
+red r4
+jmp L9
+dec L6
+prn #k
+cmp r1, #1
+mov r0, r0
+cmp X1, #k
+red r1
+cmp r5, DAT[1]
+cmp r4, #1
+mov r7, r7
+red r0
+cmp r3, r1
+inc r1
+cmp DAT[k], #1
+clr L1
+cmp L5, r2
+ hlt
+DAT: .data 1, 2, 3, k
+.entry L1
@@ -0,0 +1,75 @@
+.define k = 3
+.extern X1
+jmp L7
+L7: rts
+ inc L2
+L9: inc L2
+L0: jmp L6
+jmp L2
+mov r0, r0
+mov r7, r7
+cmp r4, r1
+ dec L1
+inc L1
+mov r1, r1
+ inc r0
+inc r0
+red r6
+jmp L3
+mov r5, r5
+red r2
+mov r0, r0
+bne L3
+cmp DAT[1], #1
+red r0
+red r4
+mov r2, r2
+jmp L1
+L1: rts
+cmp DAT[k], #1
+L5: jmp L3
+L3: prn r1
+inc r7
+ inc r3
+L4: inc r3
+ dec r1
+inc r1
+L8: cmp DAT[k], #k
+red r1
+L11: jmp L9
+red r3
+mov r6, r6
+L2: cmp L2, r2
+bne L8
+mov r0, r7
+bne L0
+L6: inc DAT[k]
+L10: prn #k
+mov r5, r5
+red r6
+mov r7, r7
+ inc DAT
+inc DAT
+red r5
+clr L1
+ inc X1
+inc X1
+cmp L7, DAT[2]
+mov r4, r4
+jmp L5
+red r5
+cmp L3, #-2
+dec r7
+bne L4
+mov r7, r7
+dec L7
+jmp L5
+red r0
+cmp r0, L6
+lea DAT, r2
+mov r0, r1
+jmp L5
+cmp r2, #1
+ hlt
+DAT: .data 1, 2, 3, k
+.entry L1
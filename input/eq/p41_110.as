@@ -0,0 +1,78 @@
+.define k = 3
+.extern X1
+ dec DAT[1]
+dec DAT[1]
+bne L8
+ inc r1
+inc r1
+ dec L3
+dec L3
+red r7
+red r2
+ inc r3
+L6: dec r3
+ inc r4
+dec r4
+mov r6, r6
+ dec X1
+dec X1
+red r5
+mov r1, r1
+L2: red r1
+L0: mov r2, r1
+jmp L4
+
+add r1, r2
+L5: prn #k
+L4: jmp L1
+L1: hlt
+mov r1, r3
+ dec L4
+dec L4
+cmp r7, #k
+cmp L7, #1
+ inc L6
+L3: dec L6
+cmp r3, #1
+L7: mov r1, r1
+ inc DAT[k]
+inc DAT[k]
+bne L8
+inc r6
+mov r2, r4
+cmp r4, #k
+L10: jmp L5
+red r5
+sub #4, r3
+
+red r7
+ dec r5
+inc r5
+inc L0
+cmp r7, #1
+ dec r7
+L8: inc r7
+jmp L7
+jmp L0
+jmp L0
+cmp L1, #-2
+cmp r7, DAT[2]
+cmp DAT[1], #-2
+mov r3, r3
+L9: cmp r2, DAT[k]
+mov r7, r7
+cmp r2, r1
+jmp L4
+mov r7, r7
+mov r2, r2
+cmp r3, #k
+jmp L0
+ inc r5
+inc r5
+L11: jmp L6
+mov r7, r0
+bne L2
+mov r2, r6
+ hlt
+DAT: .data 1, 2, 3, k
+.entry L0
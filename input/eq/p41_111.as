@@ -0,0 +1,75 @@
+.define k = 3
+.extern X1
+cmp r7, #-2
+bne L8
+bne L6
+bne L6
+bne L5
+mov r3, r7
+mov r1 r2
+mov r1, r1
+ inc r0
+dec r0
+inc r1
+L7: red r7
+red r0
+cmp L2, X1
+jmp L0
+red r3
+L2: jmp L4
+L4: inc r2
+L8: prn #k
+L1: mov r1 r2
+bne L9
+add r1, r2
+ dec r1
+inc r1
+red r3
+not r1
+mov r3, r3
+mov r0, r0
+red r4
+ dec r2
+dec r2
+ dec r3
+inc r3
+jmp L1
+inc DAT
+red r0
+bne L4
+clr L1
+mov r7, r7
+cmp r0, #-2
+jmp L9
+L9: inc r2
+L3: bne L9
+L10: cmp L4, r5
+ dec DAT[zz]
+L11: dec DAT[zz]
+cmp DAT[zz], r4
+bne L4
+cmp r6, #-2
+cmp r6, #k
+jmp L0
+L0: prn r1
+prn #k
+L5: cmp r7, #1
+jmp L7
+ dec r2
+dec r2
+L6: red r1
+cmp DAT[2], #-2
+mov r4, r4
+mov r7, r6
+red r6
+cmp r4, #-2
+jmp L7
+mov r1, r1
+ dec L4
+dec L4
+jmp L0
+; comment
+mov r6, r6
+ hlt
+DAT: .data 1, 2, 3, k
+.entry L2
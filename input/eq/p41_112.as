@@ -0,0 +1,72 @@
+.define k = 3
+.extern X1
+bne L9
+ dec r2
+dec r2
+L9: red r7
+ dec r2
+dec r2
+cmp r3, #1
+L3: cmp L0, r4
+red r4
+mov r1, r1
+jmp L9
+jmp L2
+bne L1
+jmp L1
+L10: jmp L4
+L4: hlt
+red r5
+dec DAT[1]
+L2: prn #k
+sub #4, r3
+jmp L3
+cmp r5, #k
+
+L11: dec DAT[k]
+L5: red r4
+dec L7
+cmp L2, #k
+cmp r3, r1
+ inc r4
+inc r4
+cmp DAT[k], #-2
+clr L1
+
+L7: cmp L2, #k
+L8: bne L9
+L0: bne L5
+L1: bne L5
+ inc DAT[1]
+L6: inc DAT[1]
+jmp L1
+mov r2, r2
+red r6
+mov r4, r7
+mov r6, r6
+mov r4, r4
+jmp L5
+ inc X1
+inc X1
+ dec r0
+inc r0
+jmp L9
+cmp r5, r3
+cmp r4, #-2
+dec r0
+add r1, r2
+ dec r7
+inc r7
+mov r1, r1
+dec L7
+bne L5
+
+mov r2, r2
+red r5
+jmp L8
+red r4
+jmp L4
+dec DAT[k]
+mov r3, r3
+ hlt
+DAT: .data 1, 2, 3, k
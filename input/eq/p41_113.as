@@ -0,0 +1,72 @@
+.define k = 3
+.extern X1
+L11: cmp r5, #1
+jmp L7
+dec r6
+L5: cmp L3, L7
+L7: bne L3
+L0: mov r2, r2
+clr L1
+
+L3: add r1, r2
+jmp L9
+L4: jmp L9
+L9: hlt
+mov r3, r3
+mov r2, r4
+prn #k
+L2: not r1
+ inc r3
+L6: inc r3
+ dec r3
+dec r3
+jmp L5
+cmp r3, #-2
+cmp r7, #k
+dec r5
+red r4
+inc r4
+L8: mov r7, r7
+red r5
+red r5
+red r4
+ inc r0
+inc r0
+
+lea DAT, r2
+; comment
+ dec r7
+inc r7
+L1: mov r1, r1
+cmp r5, #-2
+cmp r3, #1
+jmp L0
+L10: mov r0, r4
+jmp L1
+inc L4
+cmp r1, #-2
+dec r5
+mov r3, r7
+ dec L1
+inc L1
+bne L9
+mov r2, r2
+mov r3, r3
+mov r4, r7
+add r1, r2
+red r3
+not r1
+cmp r1, #1
+ inc DAT[k]
+inc DAT[k]
+mov r1, r5
+red r0
+not r1
+mov r6, r6
+red r3
+red r6
+jmp L1
+cmp DAT[2], #k
+ hlt
+DAT: .data 1, 2, 3, k
+.entry L2
@@ -0,0 +1,74 @@
+.define k = 3
+.extern X1
+mov r3, r3
+L8: red r4
+jmp L5
+L5: hlt
+mov r7, r7
+red r4
+jmp L6
+red r3
+inc r1
+jmp L5
+red r7
+jmp L1
+L1: prn r1
+L9: mov r5, r5
+ dec r7
+inc r7
+jmp L2
+L2: hlt
+mov r5, r5
+
+cmp r7, #k
+L11: sub #4, r3
+inc r7
+not r1
+cmp DAT[k], #1
+mov r1 r2
+L4: dec DAT
+mov r5, r5
+L0: cmp X1, #1
+red r7
+inc r2
+jmp L6
+L6: inc r2
+cmp r7, #1
+bne L6
+cmp DAT[1], #k
+cmp r4, DAT
+mov r7, r7
+dec DAT[zz]
+mov r1 r2
+jmp L0
+inc r0
+cmp L1, #1
+L7: jmp L6
+inc r1
+mov r5, r5
+jmp L0
+cmp r1, #k
+red r0
+red r7
+jmp L5
+ inc L0
+dec L0
+cmp r4, DAT[zz]
+ dec L7
+inc L7
+ dec r2
+L3: dec r2
+mov r1 r2
+cmp X1, r5
+ inc DAT[2]
+inc DAT[2]
+red r5
+cmp r5, #1
+jmp L3
+mov r2, r5
+ dec DAT[zz]
+dec DAT[zz]
+red r7
+sub #4, r3
+ hlt
+DAT: .data 1, 2, 3, k
@@ -0,0 +1,71 @@
+.define k = 3
+.extern X1
+cmp r1, #k
+ inc L2
+inc L2
+clr L1
+cmp r3, r2
+L3: jmp L9
+L9: prn r1
+cmp DAT[k], r3
+dec r6
+L10: bne L9
+cmp DAT, r1
+mov r2, r0
+red r4
+bne L4
+cmp r2, #-2
+L1: dec r0
+jmp L8
+L8: inc r2
+jmp L7
+cmp X1, #-2
+mov r2, r1
+jmp L7
+L7: rts
+ inc r3
+L5: dec r3
+jmp L9
+mov r4, r1
+L4: mov r1, r3
+cmp r5, #1
+inc r6
+L11: red r3
+red r7
+cmp r3, #k
+; comment
+cmp DAT[k], r6
+cmp r3, r4
+ inc DAT[k]
+inc DAT[k]
+red r1
+red r3
+; comment
+add r1, r2
+jmp L8
+mov r0, r0
+lea DAT, r2
+jmp L5
+red r7
+mov r3, r3
+bne L2
+jmp L9
+jmp L9
+mov r7, r3
+cmp r2, #k
+ inc DAT[k]
+L2: inc DAT[k]
+L0: mov r2, r2
+jmp L3
+L6: mov r4, r0
+cmp L4, #k
+mov r5, r5
+cmp DAT[1], #-2
+mov r0, r0
+red r0
+cmp DAT, #1
+inc r6
+mov r0, r0
+cmp L0, #1
+ hlt
+DAT: .data 1, 2, 3, k
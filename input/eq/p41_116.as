@@ -0,0 +1,77 @@
+.define k = 3
+.extern X1
+jmp L4
+L4: hlt
+ dec r3
+dec r3
+jmp L7
+L7: prn r1
+red r1
+ inc L5
+inc L5
+jmp L9
+L9: prn r1
+; comment
+mov r0, r0
+bne L5
+red r1
+ dec r7
+L8: dec r7
+bne L6
+mov r4, r4
+
+L0: mov r4, r4
+L6: red r2
+jmp L7
+red r6
+inc L1
+dec r7
+sub #4, r3
+ inc r0
+inc r0
+red r3
+; comment
+L3: jmp L4
+jmp L2
+L2: inc r2
+red r6
+L1: 
+
+ dec L6
+L10: dec L6
+cmp r1, #-2
+jmp L0
+add r1, r2
+red r4
+L11: red r0
+L5: ; comment
+red r5
+
+red r4
+bne L5
+ inc r4
+dec r4
+jmp L8
+ inc r7
+inc r7
+clr L1
+red r1
+mov r5, r5
+; comment
+cmp r2, r0
+jmp L4
+bne L9
+mov r2, r2
+red r1
+mov r2, r4
+cmp r7, r0
+red r4
+cmp DAT[k], #k
+red r4
+mov r0, r0
+ dec r0
+inc r0
+jmp L6
+ hlt
+DAT: .data 1, 2, 3, k
+.entry L1
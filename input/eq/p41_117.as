@@ -0,0 +1,69 @@
+.define k = 3
+.extern X1
+cmp r2, #k
+; comment
+ dec r6
+L5: inc r6
+jmp L9
+mov r7, r3
+L1: jmp L1
+L4: mov r1 r2
+bne L5
+jmp L3
+mov r4, r4
+L10: dec r0
+ dec DAT[2]
+dec DAT[2]
+jmp L4
+jmp L5
+L11: cmp L7, r5
+cmp r5, #-2
+cmp DAT[1], r7
+mov r5, r5
+mov r6, r6
+red r0
+cmp r6, #1
+sub #4, r3
+cmp r1, r2
+cmp r7, r3
+L7: red r0
+jmp L6
+mov r7, r7
+
+jmp L8
+L8: hlt
+jmp L7
+L0: red r3
+clr L1
+bne L5
+red r0
+mov r1, r1
+mov r4, r4
+cmp L7, #1
+red r1
+cmp r4, #-2
+mov r1 r2
+inc L2
+L6: mov r0, r6
+jmp L7
+; comment
+cmp DAT[2], #1
+add r1, r2
+bne L1
+bne L7
+L3: jmp L7
+cmp r6, #1
+L2: bne L2
+jmp L8
+inc NOPE
+jmp L5
+inc r5
+ dec r6
+inc r6
+bne L1
+mov r3, r3
+bne L2
+mov r1, r1
+ hlt
+L9: hlt
+DAT: .data 1, 2, 3, k
@@ -0,0 +1,73 @@
+.define k = 3
+.extern X1
+cmp r5, #k
+mov r7, r7
+jmp L8
+L8: hlt
+jmp L6
+L6: hlt
+red r5
+not r1
+ dec r0
+inc r0
+L2: red r5
+
+L5: cmp r4, #1
+jmp L8
+jmp L4
+L4: prn r1
+mov r6, r1
+
+L1: ; comment
+L0: prn #k
+L10: cmp r3, #k
+cmp r0, r4
+L11: mov r0, r7
+L3: jmp L6
+dec DAT[k]
+ dec r5
+dec r5
+L7: mov r6, r6
+jmp L1
+mov r3, r3
+cmp r0, r1
+L9: mov r7, r7
+jmp L7
+red r4
+red r0
+jmp L4
+clr L1
+bne L2
+jmp L4
+clr L1
+mov r1, r1
+mov r6, r6
+cmp r7, r0
+red r4
+lea DAT, r2
+ inc r5
+dec r5
+jmp L5
+cmp r5, #k
+red r5
+
+mov r1, r1
+red r0
+cmp r7, #-2
+ inc r1
+dec r1
+red r6
+cmp DAT, #-2
+
+
+cmp L1, #k
+ dec r1
+dec r1
+dec L7
+red r5
+red r6
+red r4
+bne L5
+ hlt
+DAT: .data 1, 2, 3, k
+.entry L0
@@ -0,0 +1,73 @@
+.define k = 3
+.extern X1
+cmp DAT[2], X1
+L6: jmp L3
+; comment
+jmp L6
+add r1, r2
+dec r0
+mov r3, r6
+red r2
+mov r1, r2
+lea DAT, r2
+ inc L3
+inc L3
+jmp L0
+L0: inc r2
+mov r4, r4
+jmp L1
+L1: rts
+dec r2
+L8: mov r4, r4
+jmp L9
+L9: hlt
+cmp r3, #1
+jmp L4
+L4: inc r2
+clr L1
+not r1
+L11: bne L3
+L2: mov r0, r0
+red r4
+L3: red r5
+L7: cmp r5, L0
+mov r3, r3
+L5: red r0
+mov r6, r7
+mov r6, r6
+dec r0
+cmp L4, #1
+dec r1
+red r5
+ inc r2
+inc r2
+ inc r4
+inc r4
+L10: red r7
+mov r6, r6
+add r1, r2
+jmp L9
+red r6
+red r1
+mov r5, r5
+cmp r1, #1
+jmp L7
+cmp r6, #-2
+red r4
+mov r2, r2
+ dec X1
+dec X1
+cmp r6, X1
+cmp r0, #1
+; comment
+red r7
+red r3
+bne L0
+jmp L0
+jmp L7
+cmp r6, r5
+mov r0, r0
+ inc r5
+inc r5
+ hlt
+DAT: .data 1, 2, 3, k
@@ -0,0 +1,73 @@
+.define k = 3
+.extern X1
+bne L5
+L0: red r7
+; comment
+jmp L8
+L8: rts
+ inc r3
+inc r3
+L6: bne L1
+L1: ; comment
+cmp r6, r1
+jmp L9
+L9: hlt
+jmp L1
+jmp L7
+jmp L1
+bne L5
+mov r1 r2
+ dec r5
+inc r5
+L11: 
+L2: cmp r6, #-2
+L5: mov r4, r4
+clr L1
+cmp r7, #-2
+cmp r5, #1
+red r5
+L3: jmp L3
+red r2
+L7: red r4
+cmp L7, #k
+dec DAT[zz]
+L10: red r7
+cmp r4, #1
+L4: dec r6
+jmp L4
+jmp L6
+ inc r6
+inc r6
+add r1, r2
+jmp L6
+cmp r7, #-2
+bne L6
+mov r5, r5
+mov r1, r4
+prn #k
+dec r3
+mov r5, r5
+mov r3, r3
+cmp r6, #k
+ dec L3
+inc L3
+cmp L6, #1
+jmp L4
+ dec r5
+dec r5
+jmp L4
+dec r4
+jmp L2
+
+not r1
+bne L5
+ inc r6
+inc r6
+mov r4, r4
+
+; comment
+lea DAT, r2
+
+ hlt
+DAT: .data 1, 2, 3, k
+.entry L0
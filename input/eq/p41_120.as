@@ -0,0 +1,68 @@
+.define k = 3
+.extern X1
+cmp r7, #-2
+lea DAT, r2
+red r5
+cmp r3, #1
+red r3
+mov r7, r6
+bne L6
+
+; comment
+mov r6, r6
+clr L1
+dec r5
+ dec r6
+dec r6
+L5: jmp L8
+red r4
+L10: red r1
+L6: cmp r3, #-2
+red r7
+L3: cmp r3, #-2
+cmp DAT[1], r2
+L11: 
+bne L7
+cmp DAT[1], L1
+dec DAT[k]
+L1: ; comment
+cmp r0, #-2
+L4: bne L1
+L7: jmp L4
+cmp L4, #-2
+ dec NOPE
+dec NOPE
+ dec r2
+inc r2
+sub #4, r3
+prn #k
+L0: cmp r6, r7
+cmp r7, #1
+L9: mov r0, r0
+red r2
+bne L3
+jmp L1
+L8: add r1, r2
+add r1, r2
+mov r3, r2
+red r0
+red r0
+jmp L1
+not r1
+lea DAT, r2
+sub #4, r3
+jmp L2
+L2: red r3
+mov r1 r2
+mov r0, r0
+mov r2, r2
+inc r5
+red r7
+bne L7
+dec r6
+jmp L4
+; comment
+jmp L6
+ hlt
+DAT: .data 1, 2, 3, k
+.entry L0
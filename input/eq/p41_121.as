@@ -0,0 +1,74 @@
+.define k = 3
+.extern X1
+L9: red r2
+jmp L5
+L5: inc r2
+L11: dec r7
+ dec L2
+inc L2
+cmp r7, #1
+mov r5, r5
+jmp L9
+L0: bne L6
+jmp L3
+cmp r6, #1
+L4: jmp L2
+L2: prn r1
+dec r5
+jmp L4
+dec DAT[k]
+cmp r6, #1
+red r1
+jmp L7
+L7: prn r1
+bne L2
+jmp L4
+jmp L1
+prn #k
+ inc DAT[k]
+inc DAT[k]
+L3: red r5
+L6: prn #k
+mov r6, r4
+L1: mov r7, r7
+L10: jmp L6
+ dec r2
+inc r2
+ dec DAT[k]
+dec DAT[k]
+cmp r0, #k
+L8: cmp L1, #-2
+inc L0
+jmp L6
+red r2
+dec L5
+cmp r1, r0
+; comment
+mov r1, r1
+jmp L9
+mov r2, r2
+jmp L1
+
+mov r2, r2
+cmp r4, #-2
+ inc r3
+inc r3
+mov r7, r7
+red r4
+mov r7, r7
+ inc r0
+inc r0
+mov r1, r0
+jmp L8
+
+inc r0
+mov r6, r5
+mov r0, r0
+jmp L2
+red r2
+sub #4, r3
+mov r4, r4
+ inc r3
+dec r3
+ hlt
+DAT: .data 1, 2, 3, k
@@ -0,0 +1,73 @@
+.define k = 3
+.extern X1
+jmp L4
+L5: not r1
+bne L9
+L4: dec r6
+lea DAT, r2
+dec r1
+red r4
+red r0
+red r6
+mov r5, r5
+red r0
+ inc r7
+L9: inc r7
+inc r5
+L1: prn #k
+mov r4, r4
+jmp L8
+ inc DAT
+inc DAT
+dec r2
+red r1
+bne L6
+cmp r2, #1
+mov r1, r1
+bne L9
+lea DAT, r2
+mov r1, r1
+jmp L7
+jmp L0
+L0: prn r1
+L3: bne L5
+red r7
+; comment
+mov r5, r5
+inc r1
+L2: red r3
+cmp r4, r5
+bne L8
+jmp L3
+mov r7, r7
+mov r2, r2
+cmp r2, #-2
+cmp L7, #1
+inc r0
+ dec r6
+dec r6
+cmp L4, #-2
+jmp L7
+ dec r1
+inc r1
+inc r2
+jmp L2
+bne L3
+ dec r7
+inc r7
+L6: cmp r6, r1
+red r2
+mov r6, r6
+jmp L4
+mov r1, r4
+red r7
+; comment
+jmp L4
+jmp L3
+prn #k
+cmp r4, #1
+ hlt
+L7: hlt
+L8: hlt
+DAT: .data 1, 2, 3, k
+.entry L1
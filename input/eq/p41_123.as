@@ -0,0 +1,72 @@
+.define k = 3
+.extern X1
+L1: lea DAT, r2
+ inc L5
+L0: dec L5
+bne L2
+L8: clr L1
+mov r7, r7
+L4: mov r0, r0
+ dec r0
+dec r0
+jmp L8
+mov r6, r6
+bne L7
+inc NOPE
+L11: bne L2
+jmp L1
+add r1, r2
+L2: 
+red r3
+jmp L0
+red r3
+red r2
+ inc DAT[1]
+inc DAT[1]
+L6: bne L6
+mov r1, r1
+mov r0, r6
+L9: mov r5, r5
+lea DAT, r2
+mov r2, r6
+L5: inc r1
+ dec r4
+dec r4
+jmp L9
+ dec r7
+L3: inc r7
+L10: mov r1 r2
+mov r1, r1
+red r5
+L7: cmp r6, #-2
+add r1, r2
+jmp L1
+jmp L2
+jmp L7
+mov r7, r7
+
+jmp L0
+jmp L7
+bne L5
+ dec L6
+dec L6
+sub #4, r3
+; comment
+ dec r2
+dec r2
+cmp DAT[2], #1
+cmp r5, #k
+jmp L5
+jmp L4
+mov r6, r6
+dec r2
+cmp r7, #k
+red r0
+ dec L1
+dec L1
+mov r0, r0
+mov r2, r3
+mov r1 r2
+cmp r7, #k
+ hlt
+DAT: .data 1, 2, 3, k
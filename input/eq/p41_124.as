@@ -0,0 +1,77 @@
+.define k = 3
+.extern X1
+jmp L2
+L4: add r1, r2
+ inc r6
+dec r6
+L3: mov r5, r5
+prn #k
+cmp r1, r1
+ dec DAT[2]
+dec DAT[2]
+red r7
+mov r7, r7
+ inc L7
+inc L7
+mov r1, r1
+ inc r7
+dec r7
+cmp DAT[2], r7
+L9: clr L1
+ dec L0
+inc L0
+jmp L9
+red r3
+mov r0, r0
+jmp L1
+L1: rts
+L10: inc r0
+add r1, r2
+dec r4
+ dec DAT[k]
+dec DAT[k]
+red r5
+add r1, r2
+jmp L9
+mov r0, r0
+red r2
+dec L0
+
+not r1
+L5: mov r7, r7
+ inc r6
+dec r6
+clr L1
+bne L9
+
+mov r2, r3
+ inc DAT[k]
+inc DAT[k]
+L8: dec r6
+mov r0, r0
+red r1
+cmp r4, #k
+L6: mov r6, r6
+ inc L5
+inc L5
+jmp L9
+jmp L7
+L7: rts
+mov r6, r6
+red r1
+red r0
+cmp r6, r0
+L2: prn #k
+cmp r1, #-2
+red r5
+L11: jmp L6
+red r2
+red r0
+mov r3, r2
+mov r6, r6
+inc r4
+jmp L9
+ hlt
+L0: hlt
+DAT: .data 1, 2, 3, k
+.entry L1
@@ -0,0 +1,71 @@
+.define k = 3
+.extern X1
+cmp DAT[k], #k
+L4: jmp L0
+L0: rts
+bne L6
+lea DAT, r2
+L3: red r2
+mov r6, r6
+bne L2
+mov r6, r1
+jmp L0
+red r5
+dec r0
+dec r3
+bne L7
+
+jmp L1
+L1: inc r2
+dec DAT[k]
+L8: mov r3, r3
+red r6
+L5: jmp L3
+dec L4
+bne L5
+ inc r6
+inc r6
+jmp L4
+jmp L8
+cmp r5, #-2
+cmp r7, #k
+red r1
+inc L0
+inc r0
+cmp X1, #1
+cmp DAT[2], #-2
+ inc r6
+dec r6
+mov r1, r1
+L2: jmp L3
+red r7
+L9: red r0
+mov r6, r6
+ dec r1
+inc r1
+mov r1, r2
+cmp r2, #k
+bne L0
+; comment
+jmp L5
+inc r0
+L6: lea DAT, r2
+mov r2, r2
+red r5
+; comment
+red r3
+prn #k
+L7: inc r1
+red r4
+ inc r6
+inc r6
+jmp L1
+red r4
+L10: red r1
+L11: jmp L1
+jmp L1
+jmp L7
+cmp DAT[1], #-2
+ hlt
+DAT: .data 1, 2, 3, k
+.entry L0
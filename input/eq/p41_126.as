@@ -0,0 +1,73 @@
+.define k = 3
+.extern X1
+jmp L7
+L7: rts
+ dec r2
+dec r2
+ inc DAT[zz]
+dec DAT[zz]
+jmp L0
+L2: cmp r6, #1
+inc DAT[1]
+L0: red r5
+sub #4, r3
+jmp L5
+L5: inc r2
+cmp DAT[1], r0
+cmp DAT[k], #1
+dec DAT[1]
+L9: inc r3
+dec r3
+L11: red r5
+jmp L4
+L4: hlt
+; comment
+L10: dec r5
+L1: jmp L8
+L8: hlt
+L3: cmp r3, #k
+mov r0, r0
+L6: ; comment
+bne L6
+red r6
+mov r0, r0
+red r3
+jmp L3
+inc r4
+mov r6, r6
+bne L4
+ dec r2
+dec r2
+mov r1, r6
+inc DAT[2]
+mov r3, r3
+dec L5
+jmp L7
+mov r6, r6
+bne L8
+inc r3
+jmp L6
+mov r5, r5
+cmp r4, #-2
+add r1, r2
+mov r5, r4
+jmp L7
+cmp DAT[zz], r4
+cmp DAT[zz], #-2
+jmp L9
+jmp L7
+mov r1 r2
+bne L4
+prn #k
+mov r5, r4
+mov r7, r7
+red r0
+cmp r6, #k
+ inc L7
+inc L7
+red r1
+dec L7
+lea DAT, r2
+ hlt
+DAT: .data 1, 2, 3, k
+.entry L2
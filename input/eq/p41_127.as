@@ -0,0 +1,71 @@
+.define k = 3
+.extern X1
+L9: jmp L1
+L1: prn r1
+dec r4
+red r1
+dec DAT[2]
+L3: prn #k
+
+mov r1, r1
+L7: jmp L4
+cmp r0, #-2
+red r3
+red r7
+L4: not r1
+cmp r3, #1
+jmp L9
+ dec L1
+inc L1
+L6: cmp r2, r4
+cmp r6, #1
+L0: jmp L3
+cmp r3, #k
+bne L0
+L5: mov r6, r0
+dec r4
+red r2
+cmp r7, #-2
+ inc r5
+dec r5
+prn #k
+mov r5, r3
+jmp L6
+mov r3, r5
+mov r2, r2
+red r4
+mov r4, r4
+L11: bne L8
+red r5
+L8: mov r7, r7
+ inc r5
+L10: inc r5
+L2: jmp L3
+sub #4, r3
+bne L7
+mov r0, r0
+cmp r1, #k
+jmp L4
+; comment
+cmp r4, #k
+ dec r0
+inc r0
+bne L9
+cmp L4, #-2
+mov r3, r1
+ dec r5
+inc r5
+jmp L9
+bne L0
+
+red r6
+; comment
+ inc DAT[1]
+dec DAT[1]
+bne L6
+cmp r6, #1
+mov r0, r0
+red r2
+; comment
+ hlt
+DAT: .data 1, 2, 3, k
@@ -0,0 +1,75 @@
+.define k = 3
+.extern X1
+cmp L2, #k
+cmp X1, #1
+inc r7
+ dec r7
+dec r7
+
+L9: 
+L2: mov r7, r7
+ dec DAT[2]
+dec DAT[2]
+ dec r4
+dec r4
+red r6
+cmp r0, #k
+L5: red r2
+red r2
+jmp L8
+L8: rts
+cmp r1, #-2
+mov r7, r7
+bne L4
+mov r7, r7
+jmp L2
+mov r7, r7
+bne L6
+bne L2
+cmp r2, r5
+cmp DAT[1], #-2
+jmp L4
+L4: hlt
+ inc r2
+dec r2
+cmp L5, r0
+
+; comment
+L11: mov r2, r2
+mov r1, r1
+clr L1
+ inc r4
+L1: dec r4
+ dec r4
+inc r4
+ dec r1
+dec r1
+cmp r7, #1
+red r3
+; comment
+bne L0
+red r1
+jmp L7
+L7: inc r2
+not r1
+red r3
+red r0
+red r4
+jmp L9
+L6: cmp r7, #k
+jmp L2
+bne L2
+L0: mov r6, r2
+bne L8
+red r3
+
+cmp r4, #k
+bne L5
+dec r1
+inc L7
+red r6
+jmp L5
+mov r3, r4
+ hlt
+L3: hlt
+DAT: .data 1, 2, 3, k
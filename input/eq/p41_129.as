@@ -0,0 +1,76 @@
+.define k = 3
+.extern X1
+lea DAT, r2
+L11: red r3
+; comment
+L8: cmp L4, L2
+sub #4, r3
+cmp DAT[1], #1
+cmp r7, #k
+mov r7, r7
+red r2
+L2: jmp L2
+ dec r5
+dec r5
+L10: cmp r3, #-2
+red r1
+ inc L0
+inc L0
+L3: jmp L6
+; comment
+jmp L8
+L4: dec DAT[k]
+lea DAT, r2
+L6: bne L1
+ dec DAT
+inc DAT
+bne L8
+bne L5
+red r5
+cmp L2, #-2
+jmp L5
+jmp L0
+L0: hlt
+mov r1 r2
+ dec r6
+inc r6
+jmp L4
+bne L0
+ inc L4
+inc L4
+not r1
+cmp L5, #k
+ dec r0
+inc r0
+cmp L6, #1
+L5: lea DAT, r2
+mov r6, r6
+cmp r4, #1
+mov r1, r2
+red r6
+jmp L8
+ inc r3
+L7: dec r3
+jmp L0
+ dec r7
+dec r7
+dec r6
+mov r5, r5
+L9: mov r5, r5
+L1: cmp r0, #k
+ inc r7
+inc r7
+ inc r5
+inc r5
+dec r7
+; comment
+jmp L9
+jmp L7
+cmp r3, #-2
+red r0
+cmp L6, #k
+mov r3, r3
+cmp X1, #-2
+ hlt
+DAT: .data 1, 2, 3, k
+.entry L2
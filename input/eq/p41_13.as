@@ -0,0 +1,73 @@
+.define k = 3
+.extern X1
+bne L2
+bne L3
+cmp r3, DAT[1]
+L10: jmp L0
+mov r4, r6
+lea DAT, r2
+cmp r6, #k
+ dec L4
+inc L4
+clr L1
+L3: cmp r5, r4
+jmp L8
+L8: rts
+bne L2
+ inc DAT[1]
+L9: dec DAT[1]
+cmp r4, #-2
+jmp L8
+L4: sub #4, r3
+mov r0, r0
+inc r2
+L5: jmp L8
+red r5
+jmp L2
+L2: red r1
+jmp L0
+L0: prn r1
+L11: cmp r0, #-2
+bne L3
+jmp L5
+ inc L6
+dec L6
+L1: jmp L0
+ dec r6
+dec r6
+mov r0, r0
+cmp r6, #-2
+ inc r6
+L7: dec r6
+L6: inc r2
+bne L1
+inc r3
+red r7
+inc r0
+lea DAT, r2
+cmp r4, #1
+cmp r4, r5
+red r4
+mov r1, r1
+ dec r2
+inc r2
+cmp r3, r5
+
+inc r7
+
+red r7
+cmp r2, #1
+prn #k
+mov r0, r2
+jmp L0
+sub #4, r3
+jmp L3
+jmp L5
+jmp L6
+mov r5, r7
+
+prn #k
+mov r2, r2
+ hlt
+DAT: .data 1, 2, 3, k
+.entry L0
@@ -0,0 +1,73 @@
+.define k = 3
+.extern X1
+cmp DAT[k], #k
+inc r1
+L0: red r5
+L11: ; comment
+inc DAT[k]
+jmp L8
+L9: red r2
+cmp r2, DAT[k]
+L7: not r1
+ inc r2
+dec r2
+jmp L6
+L6: inc r2
+ inc DAT[1]
+dec DAT[1]
+; comment
+clr L1
+lea DAT, r2
+L3: jmp L0
+ inc DAT
+inc DAT
+cmp r2, #-2
+ inc r5
+inc r5
+cmp r3, #-2
+lea DAT, r2
+inc L4
+cmp r0, r4
+jmp L3
+bne L3
+prn #k
+; comment
+jmp L9
+L1: cmp r4, #-2
+red r5
+
+mov r5, r5
+red r5
+ dec r1
+inc r1
+L10: jmp L3
+jmp L6
+L5: red r4
+L4: red r7
+jmp L9
+red r6
+cmp r7, #k
+cmp r3, #-2
+L8: bne L7
+ inc r7
+L2: dec r7
+ dec DAT[1]
+dec DAT[1]
+jmp L0
+cmp DAT[1], #-2
+red r7
+red r3
+
+cmp DAT[k], DAT[1]
+ dec r3
+dec r3
+jmp L5
+cmp r7, #-2
+sub #4, r3
+red r2
+bne L3
+clr L1
+red r6
+cmp r7, r2
+ hlt
+DAT: .data 1, 2, 3, k
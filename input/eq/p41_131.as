@@ -0,0 +1,74 @@
+.define k = 3
+.extern X1
+add r1, r2
+mov r1, r1
+mov r2, r2
+bne L7
+sub #4, r3
+not r1
+sub #4, r3
+; comment
+mov r7, r7
+; comment
+cmp r5, #-2
+jmp L7
+L11: cmp r0, #k
+mov r3, r1
+; comment
+L2: red r6
+ inc r5
+inc r5
+red r4
+L1: cmp r2, r2
+cmp L0, L4
+mov r6, r6
+cmp r1, DAT[2]
+red r2
+inc r3
+L4: bne L2
+L5: jmp L9
+L9: rts
+cmp L4, r1
+red r0
+jmp L9
+cmp r5, #-2
+jmp L2
+L7: cmp DAT[k], #-2
+L0: mov r4, r4
+L3: inc L3
+L8: jmp L2
+L6: sub #4, r3
+
+bne L1
+mov r4, r3
+ inc r2
+inc r2
+ inc DAT[2]
+inc DAT[2]
+jmp L8
+red r3
+bne L8
+cmp r3, DAT[k]
+ inc r5
+dec r5
+cmp r2, #k
+red r5
+mov r4, r4
+cmp L0, #k
+jmp L1
+ dec DAT[2]
+inc DAT[2]
+ dec r7
+dec r7
+; comment
+ dec r2
+inc r2
+L10: cmp r4, #1
+red r2
+inc r5
+ inc r3
+inc r3
+jmp L1
+ hlt
+DAT: .data 1, 2, 3, k
+.entry L2
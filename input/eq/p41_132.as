@@ -0,0 +1,71 @@
+.define k = 3
+.extern X1
+ dec r0
+inc r0
+inc r7
+cmp L7, DAT[2]
+jmp L5
+L5: hlt
+jmp L5
+red r2
+mov r1 r2
+prn #k
+L8: red r3
+ dec r0
+inc r0
+L6: bne L1
+ inc r2
+inc r2
+mov r3, r7
+not r1
+L4: inc r2
+mov r7, r7
+mov r7, r7
+prn #k
+inc r2
+cmp DAT[k], #k
+jmp L0
+L0: prn r1
+mov r6, r7
+red r5
+L10: prn #k
+cmp r1, DAT[1]
+cmp r1, #k
+L11: jmp L3
+cmp r1, #1
+L2: mov r0, r0
+dec r5
+lea DAT, r2
+
+; comment
+clr L1
+L3: red r7
+L7: clr L1
+; comment
+jmp L0
+L9: jmp L7
+mov r3, r6
+red r3
+L1: jmp L7
+prn #k
+jmp L2
+mov r4, r6
+mov r3, r3
+ dec L5
+dec L5
+inc DAT[k]
+add r1, r2
+red r6
+jmp L3
+mov r7, r3
+cmp r2, #k
+dec r3
+bne L8
+bne L3
+red r6
+dec r2
+bne L6
+jmp L4
+ hlt
+DAT: .data 1, 2, 3, k
+.entry L1
@@ -0,0 +1,75 @@
+.define k = 3
+.extern X1
+inc DAT[k]
+bne L4
+cmp r6, #-2
+red r6
+bne L2
+jmp L2
+ dec r5
+inc r5
+mov r6, r3
+L1: dec r4
+jmp L0
+ dec L7
+dec L7
+red r7
+jmp L0
+; comment
+L2: cmp r1, #-2
+cmp DAT[1], #k
+L10: red r6
+L4: mov r1, r1
+mov r1, r2
+bne L7
+; comment
+; comment
+jmp L4
+cmp DAT, #1
+ inc L5
+dec L5
+mov r5, r5
+L5: dec DAT[1]
+dec DAT
+ inc r6
+dec r6
+cmp r6, #1
+mov r5, r5
+bne L3
+jmp L2
+ inc L7
+inc L7
+add r1, r2
+
+L0: bne L4
+ dec r5
+inc r5
+jmp L9
+jmp L4
+ inc L6
+inc L6
+ inc DAT[k]
+dec DAT[k]
+L3: mov r1, r1
+L7: bne L6
+sub #4, r3
+cmp r7, r3
+jmp L4
+cmp L4, #k
+L11: cmp DAT[1], #-2
+bne L8
+L8: cmp r4, #k
+jmp L8
+cmp L0, #k
+bne L8
+ dec X1
+dec X1
+ inc r7
+inc r7
+inc r3
+jmp L9
+L6: jmp L8
+red r0
+ hlt
+L9: hlt
+DAT: .data 1, 2, 3, k
@@ -0,0 +1,74 @@
+.define k = 3
+.extern X1
+cmp r2, #1
+cmp r7, #k
+red r4
+mov r4, r4
+prn #k
+red r4
+mov r6, r4
+jmp L9
+L3: cmp r1, #1
+cmp r6, #-2
+; comment
+cmp r1, #1
+L1: mov r3, r3
+cmp X1, #k
+ dec r3
+inc r3
+bne L1
+ dec r5
+inc r5
+cmp DAT[k], #1
+red r7
+add r1, r2
+; comment
+L7: dec r6
+dec L3
+cmp r7, #1
+clr L1
+sub #4, r3
+jmp L2
+ inc r0
+inc r0
+mov r3, r7
+cmp r1, #-2
+jmp L7
+red r0
+bne L3
+mov r5, r6
+L9: bne L7
+ dec DAT[k]
+inc DAT[k]
+jmp L1
+ dec r6
+dec r6
+bne L3
+ inc L1
+inc L1
+ dec r1
+dec r1
+mov r7, r7
+L8: mov r0, r5
+jmp L7
+mov r4, r5
+L6: cmp DAT[1], #1
+dec r0
+bne L2
+red r2
+bne L6
+cmp r1, #k
+cmp r0, #1
+red r5
+L0: dec L7
+bne L0
+cmp DAT[2], L1
+mov r7, r7
+bne L6
+jmp L2
+L2: inc r2
+L4: sub #4, r3
+ hlt
+L5: hlt
+DAT: .data 1, 2, 3, k
+.entry L2
@@ -0,0 +1,75 @@
+.define k = 3
+.extern X1
+jmp L9
+L9: prn r1
+mov r4, r4
+ dec r5
+dec r5
+cmp r0, #k
+prn #k
+cmp DAT[1], r2
+mov r7, r7
+inc r4
+jmp L5
+L5: rts
+mov r2, r2
+L1: red r2
+cmp r7, #-2
+ inc r7
+dec r7
+L11: mov r7, r5
+bne L6
+L2: 
+jmp L1
+
+cmp r2, #-2
+L6: inc r1
+red r4
+mov r5, r5
+red r4
+jmp L6
+cmp DAT[k], #1
+jmp L0
+ inc r2
+L4: inc r2
+L7: not r1
+dec L2
+add r1, r2
+mov r0, r0
+jmp L0
+
+ dec r6
+inc r6
+jmp L0
+jmp L0
+lea DAT, r2
+ dec r4
+inc r4
+L8: red r1
+ dec L1
+inc L1
+mov r3, r3
+dec DAT[k]
+L10: red r2
+jmp L4
+; comment
+red r6
+jmp L5
+mov r6, r6
+mov r3, r3
+inc DAT[k]
+mov r0, r0
+mov r6, r6
+jmp L4
+L0: cmp r1, #1
+inc r6
+cmp r6, #1
+ dec L5
+dec L5
+mov r4, r4
+mov r6, r6
+jmp L2
+ hlt
+L3: hlt
+DAT: .data 1, 2, 3, k
+.entry L2
@@ -0,0 +1,71 @@
+.define k = 3
+.extern X1
+jmp L6
+L6: rts
+mov r7, r7
+bne L0
+L10: clr L1
+inc DAT[1]
+jmp L0
+L5: jmp L3
+L3: inc r2
+bne L4
+inc DAT[2]
+cmp DAT, #1
+ dec L2
+dec L2
+ dec r7
+L11: dec r7
+red r2
+cmp r7, r5
+jmp L1
+dec r5
+cmp DAT[1], r0
+L8: dec r6
+red r3
+mov r5, r6
+jmp L8
+L0: cmp L1, L7
+jmp L3
+; comment
+red r7
+L4: red r6
+cmp r5, DAT
+jmp L8
+ dec r7
+dec r7
+L2: cmp r3, #1
+L7: red r5
+
+inc L3
+bne L2
+mov r5, r3
+inc r3
+L1: dec r6
+L9: red r7
+prn #k
+mov r1, r1
+dec X1
+bne L7
+jmp L0
+jmp L2
+
+cmp r4, #-2
+add r1, r2
+jmp L3
+red r4
+ dec r6
+dec r6
+red r3
+mov r1, r1
+jmp L9
+cmp r3, r1
+jmp L0
+mov r4, r1
+bne L2
+inc r0
+jmp L0
+bne L4
+ hlt
+DAT: .data 1, 2, 3, k
+.entry L1
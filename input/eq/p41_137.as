@@ -0,0 +1,72 @@
+.define k = 3
+.extern X1
+ dec r7
+L6: dec r7
+jmp L6
+mov r6, r6
+jmp L2
+L2: prn r1
+L4: 
+; comment
+mov r6, r6
+bne L1
+L8: red r5
+L1: inc L0
+red r7
+ dec DAT[k]
+L10: dec DAT[k]
+bne L6
+red r6
+bne L1
+L0: 
+L3: prn #k
+L5: 
+
+cmp L3, #-2
+not r1
+jmp L6
+ inc r5
+dec r5
+add r1, r2
+; comment
+ dec L6
+inc L6
+red r2
+L9: mov r7, r7
+jmp L6
+L7: 
+red r5
+clr L1
+not r1
+bne L5
+jmp L5
+bne L4
+jmp L3
+mov r5, r5
+ inc L7
+dec L7
+L11: lea DAT, r2
+cmp r4, r3
+jmp L8
+clr L1
+red r3
+ inc r0
+inc r0
+lea DAT, r2
+red r1
+jmp L9
+red r6
+jmp L7
+jmp L6
+mov r4, r4
+bne L8
+ dec DAT[1]
+inc DAT[1]
+jmp L8
+mov r5, r5
+prn #k
+sub #4, r3
+jmp L0
+red r3
+ hlt
+DAT: .data 1, 2, 3, k
@@ -0,0 +1,77 @@
+.define k = 3
+.extern X1
+L7: red r4
+mov r1 r2
+mov r7, r7
+sub #4, r3
+bne L7
+
+L11: cmp r0, #-2
+L4: jmp L2
+bne L1
+jmp L9
+inc r0
+cmp r6, #-2
+
+L6: cmp r1, #k
+lea DAT, r2
+ inc DAT[2]
+L5: dec DAT[2]
+dec r7
+ inc DAT[k]
+dec DAT[k]
+mov r1, r1
+L2: mov r7, r7
+jmp L8
+L8: prn r1
+mov r6, r6
+mov r5, r5
+jmp L6
+jmp L7
+cmp DAT[k], #k
+L0: add r1, r2
+ dec r1
+dec r1
+cmp L1, #-2
+dec L2
+ inc r1
+dec r1
+
+mov r7, r7
+jmp L1
+cmp r1, #k
+mov r1, r1
+inc r2
+cmp r2, L1
+bne L1
+ inc r7
+dec r7
+bne L3
+jmp L7
+L1: cmp r3, #1
+dec DAT[1]
+ inc r4
+dec r4
+ dec L5
+inc L5
+; comment
+bne L7
+ inc r7
+inc r7
+bne L1
+; comment
+red r5
+mov r7, r7
+mov r0, r0
+mov r3, r3
+mov r2, r2
+bne L4
+mov r3, r1
+ dec X1
+inc X1
+ inc r0
+inc r0
+ hlt
+L3: hlt
+DAT: .data 1, 2, 3, k
+.entry L0
@@ -0,0 +1,72 @@
+.define k = 3
+.extern X1
+L11: jmp L9
+bne L8
+L5: lea DAT, r2
+clr L1
+
+cmp r7, #-2
+dec r1
+mov r7, r7
+cmp L1, L6
+bne L0
+jmp L8
+L8: rts
+cmp r7, #k
+prn #k
+mov r7, r7
+L9: dec r5
+inc r4
+L3: 
+red r2
+sub #4, r3
+L1: cmp DAT[k], #-2
+jmp L6
+bne L3
+; comment
+cmp r3, r0
+L10: bne L3
+cmp L3, #k
+jmp L2
+L2: rts
+red r6
+; comment
+ inc r3
+inc r3
+L0: jmp L3
+jmp L2
+L6: dec r5
+ inc r3
+L7: dec r3
+cmp L2, #1
+mov r1, r1
+red r4
+L4: jmp L6
+bne L3
+red r7
+mov r2, r6
+mov r5, r5
+bne L1
+red r6
+red r1
+bne L0
+jmp L0
+ dec DAT[1]
+dec DAT[1]
+lea DAT, r2
+ inc DAT[k]
+dec DAT[k]
+mov r0, r1
+mov r0, r0
+inc r0
+jmp L2
+jmp L6
+ dec L6
+dec L6
+jmp L9
+cmp L2, #1
+cmp DAT[k], r1
+bne L6
+ hlt
+DAT: .data 1, 2, 3, k
+.entry L2
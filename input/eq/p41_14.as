@@ -0,0 +1,75 @@
+.define k = 3
+.extern X1
+L11: clr L1
+cmp r1, L4
+ dec DAT[1]
+dec DAT[1]
+cmp DAT[2], #k
+L10: mov r5, r5
+
+jmp L7
+L1: jmp L5
+L5: hlt
+dec L4
+cmp r1, #k
+mov r6, r6
+mov r7, r2
+ dec r6
+inc r6
+ inc r7
+dec r7
+jmp L0
+red r0
+jmp L7
+L7: prn r1
+mov r7, r1
+mov r4, r4
+L6: cmp r5, #1
+add r1, r2
+red r4
+L2: jmp L5
+ inc DAT
+inc DAT
+dec r5
+cmp r7, #k
+mov r0, r0
+L4: inc r6
+ dec r2
+inc r2
+cmp r3, #1
+inc r5
+L0: red r1
+red r0
+red r1
+ inc r6
+L9: dec r6
+red r0
+red r3
+jmp L8
+L8: rts
+mov r5, r1
+ inc r5
+dec r5
+; comment
+red r7
+L3: red r5
+not r1
+not r1
+not r1
+inc r1
+
+not r1
+jmp L0
+jmp L4
+cmp DAT[2], #k
+cmp r5, #k
+; comment
+cmp L2, r4
+jmp L2
+dec r4
+mov r0, r0
+red r3
+ dec r7
+inc r7
+ hlt
+DAT: .data 1, 2, 3, k
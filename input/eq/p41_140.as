@@ -0,0 +1,77 @@
+.define k = 3
+.extern X1
+mov r4, r4
+bne L3
+L3: red r6
+inc r2
+ inc r4
+dec r4
+ inc DAT[2]
+inc DAT[2]
+clr L1
+L9: red r7
+ dec X1
+dec X1
+cmp r7, r7
+red r6
+dec r5
+clr L1
+sub #4, r3
+jmp L2
+L2: prn r1
+L1: mov r2, r4
+cmp r0, #-2
+ dec L5
+dec L5
+dec L0
+cmp L3, r4
+bne L1
+ inc r6
+L10: dec r6
+sub #4, r3
+dec r7
+ inc r2
+dec r2
+; comment
+cmp r5, #1
+bne L6
+cmp L0, L0
+prn #k
+
+bne L1
+jmp L0
+L0: prn r1
+L6: jmp L8
+L8: inc r2
+jmp L5
+L5: rts
+ dec r3
+dec r3
+; comment
+cmp r1, #k
+L4: cmp r2, #1
+L11: lea DAT, r2
+red r5
+
+mov r1, r1
+jmp L5
+cmp L4, #k
+dec L4
+jmp L4
+ inc L2
+dec L2
+bne L1
+L7: jmp L0
+cmp L3, #1
+prn #k
+mov r2, r3
+bne L8
+red r3
+mov r1, r1
+ inc r0
+dec r0
+jmp L8
+jmp L3
+
+ hlt
+DAT: .data 1, 2, 3, k
@@ -0,0 +1,72 @@
+.define k = 3
+.extern X1
+mov r7, r7
+mov r4, r4
+L5: dec r5
+ dec r4
+L6: dec r4
+dec L3
+jmp L8
+mov r0, r0
+jmp L9
+L9: inc r2
+cmp r6, #1
+mov r5, r5
+bne L0
+ inc L0
+inc L0
+ dec L2
+inc L2
+cmp r6, #k
+red r5
+L2: bne L4
+cmp L1, #k
+L3: mov r3, r3
+red r0
+red r6
+jmp L4
+L7: cmp r3, r6
+red r3
+cmp r4, L0
+prn #k
+mov r4, r4
+L8: jmp L6
+ inc r7
+L4: inc r7
+bne L5
+bne L9
+bne L2
+mov r4, r2
+L11: mov r6, r1
+jmp L0
+L0: rts
+L1: cmp r7, #1
+bne L3
+L10: dec DAT[1]
+bne L3
+; comment
+jmp L5
+bne L0
+cmp r5, #-2
+cmp r6, #-2
+add r1, r2
+red r4
+cmp NOPE, #-2
+jmp L6
+red r0
+; comment
+jmp L2
+ dec r4
+inc r4
+red r6
+jmp L7
+mov r5, r5
+jmp L2
+mov r7, r7
+ dec r0
+dec r0
+sub #4, r3
+red r7
+mov r5, r1
+ hlt
+DAT: .data 1, 2, 3, k
@@ -0,0 +1,74 @@
+.define k = 3
+.extern X1
+bne L7
+ inc DAT[k]
+L4: inc DAT[k]
+cmp L0, #k
+mov r1, r1
+; comment
+L2: bne L0
+dec DAT[2]
+cmp r5, #-2
+ inc r0
+inc r0
+L11: cmp DAT[1], #-2
+red r2
+ inc r2
+L9: inc r2
+jmp L6
+red r6
+; comment
+; comment
+L10: jmp L0
+L0: hlt
+ inc r3
+L1: dec r3
+bne L0
+cmp DAT[2], #k
+cmp r4, #k
+bne L0
+cmp r7, #k
+mov r4, r4
+cmp r6, #-2
+cmp r7, #-2
+L6: red r7
+L8: inc r7
+ inc r7
+inc r7
+cmp r4, r0
+jmp L3
+L3: prn r1
+L7: cmp r5, r5
+cmp L6, #-2
+L5: bne L7
+ dec X1
+inc X1
+inc r2
+mov r3, r3
+dec r5
+red r4
+ inc r1
+inc r1
+ dec r4
+inc r4
+; comment
+red r3
+
+red r2
+inc DAT[2]
+red r0
+bne L6
+mov r5, r5
+red r5
+jmp L7
+mov r4, r4
+cmp r6, #-2
+cmp r7, r1
+red r3
+cmp r6, DAT[k]
+red r1
+mov r2, r2
+
+inc r5
+ hlt
+DAT: .data 1, 2, 3, k
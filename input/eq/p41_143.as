@@ -0,0 +1,73 @@
+.define k = 3
+.extern X1
+
+L3: mov r1, r7
+L2: clr L1
+dec r7
+L6: red r4
+cmp r3, #-2
+ inc r3
+inc r3
+dec r6
+jmp L1
+L1: hlt
+L11: cmp r5, #1
+mov r7, r7
+cmp r2, r7
+mov r1, r3
+cmp r3, L1
+cmp DAT[k], #k
+prn #k
+mov r5, r5
+red r5
+ dec r5
+L4: dec r5
+L10: sub #4, r3
+L0: red r1
+cmp DAT[2], #k
+L8: mov r2, r2
+ dec L5
+inc L5
+ inc r5
+dec r5
+red r0
+dec r6
+jmp L9
+; comment
+L7: bne L3
+jmp L8
+L9: prn #k
+L5: lea DAT, r2
+mov r3, r3
+cmp DAT[k], L3
+inc r3
+cmp r5, r2
+inc r5
+add r1, r2
+ inc L6
+dec L6
+bne L1
+dec X1
+ inc r3
+inc r3
+bne L6
+; comment
+red r2
+red r5
+mov r5, r5
+ inc r6
+dec r6
+red r3
+ inc L4
+inc L4
+mov r5, r5
+cmp X1, #k
+dec DAT[k]
+cmp r7, #k
+red r3
+; comment
+jmp L7
+jmp L5
+jmp L1
+ hlt
+DAT: .data 1, 2, 3, k
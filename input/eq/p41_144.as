@@ -0,0 +1,75 @@
+.define k = 3
+.extern X1
+ dec r2
+dec r2
+cmp L3, #1
+red r4
+red r0
+mov r5, r5
+jmp L6
+sub #4, r3
+jmp L4
+not r1
+inc r5
+red r0
+ dec r6
+dec r6
+L8: cmp X1, DAT[zz]
+mov r0, r0
+add r1, r2
+jmp L2
+red r5
+mov r6, r6
+L5: jmp L9
+L9: rts
+ inc r4
+inc r4
+mov r2, r2
+mov r4, r4
+ inc r5
+L11: dec r5
+clr L1
+jmp L3
+L3: rts
+L10: bne L6
+bne L4
+jmp L7
+L7: inc r2
+mov r0, r0
+cmp r3, #-2
+dec r2
+ dec r1
+inc r1
+L0: cmp r2, #-2
+lea DAT, r2
+jmp L4
+L4: inc r2
+mov r1, r5
+L6: add r1, r2
+inc r1
+clr L1
+mov r3, r5
+inc r0
+ dec r3
+inc r3
+L1: inc r3
+inc r4
+jmp L9
+bne L0
+jmp L5
+L2: cmp r6, #1
+bne L6
+add r1, r2
+mov r0, r0
+dec DAT[1]
+; comment
+cmp r4, #1
+not r1
+jmp L6
+
+mov r5, r7
+bne L6
+cmp DAT[1], #1
+ hlt
+DAT: .data 1, 2, 3, k
+.entry L1
@@ -0,0 +1,74 @@
+.define k = 3
+.extern X1
+; comment
+mov r0, r0
+bne L7
+cmp r2, r5
+L4: cmp r2, DAT[1]
+L2: red r3
+L11: dec DAT[2]
+ dec r6
+dec r6
+jmp L4
+not r1
+mov r6, r6
+ dec r2
+dec r2
+jmp L6
+L6: hlt
+L0: red r3
+red r3
+mov r3, r5
+cmp r1, r1
+L7: bne L0
+inc L2
+dec r1
+not r1
+red r7
+inc r1
+mov r3, r3
+ dec r3
+dec r3
+jmp L0
+L3: jmp L6
+red r0
+jmp L9
+L9: prn r1
+L10: bne L1
+L8: mov r2, r2
+L5: mov r7, r3
+mov r3, r4
+L1: mov r2, r2
+dec L2
+ dec L7
+inc L7
+
+cmp r0, #k
+mov r6, r6
+cmp r0, #1
+red r2
+ dec r2
+inc r2
+red r4
+bne L4
+ dec r0
+inc r0
+cmp r0, r6
+inc L2
+lea DAT, r2
+red r6
+
+ dec r0
+inc r0
+red r0
+cmp r2, #k
+mov r4, r4
+jmp L8
+jmp L0
+ inc DAT[k]
+inc DAT[k]
+red r1
+clr L1
+bne L8
+ hlt
+DAT: .data 1, 2, 3, k
@@ -0,0 +1,75 @@
+.define k = 3
+.extern X1
+L9: dec DAT[1]
+mov r6, r6
+red r2
+red r1
+mov r7, r6
+clr L1
+L10: 
+red r6
+ dec r5
+inc r5
+bne L1
+mov r5, r5
+mov r6, r6
+L5: dec r2
+bne L9
+jmp L9
+L4: ; comment
+bne L7
+inc r7
+mov r6, r6
+bne L9
+jmp L7
+ inc DAT[k]
+dec DAT[k]
+mov r2, r0
+bne L0
+jmp L7
+L7: rts
+red r3
+ inc DAT[1]
+inc DAT[1]
+L6: jmp L1
+L1: inc r2
+jmp L8
+L8: inc r2
+jmp L7
+L2: jmp L2
+ dec r2
+dec r2
+ inc r4
+inc r4
+jmp L6
+L3: not r1
+red r3
+bne L3
+L0: jmp L4
+ inc r3
+inc r3
+L11: clr L1
+ inc r6
+inc r6
+cmp r6, #k
+mov r4, r0
+cmp DAT[k], #-2
+red r1
+jmp L5
+jmp L0
+mov r2, r0
+cmp r1, #k
+cmp L5, #1
+jmp L0
+jmp L8
+bne L1
+mov r0, r3
+
+; comment
+cmp r3, #-2
+cmp L1, #1
+ dec DAT[2]
+inc DAT[2]
+cmp L7, #1
+ hlt
+DAT: .data 1, 2, 3, k
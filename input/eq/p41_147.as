@@ -0,0 +1,74 @@
+.define k = 3
+.extern X1
+mov r6, r6
+jmp L4
+L4: inc r2
+ dec r6
+inc r6
+cmp L7, #k
+cmp r4, DAT[zz]
+jmp L3
+L3: rts
+cmp r4, #k
+mov r3, r3
+inc r5
+red r7
+ inc DAT[zz]
+dec DAT[zz]
+inc r4
+bne L1
+red r0
+L10: bne L9
+L5: not r1
+ dec r7
+dec r7
+L7: red r6
+jmp L4
+add r1, r2
+inc r7
+cmp r6, #1
+red r3
+L6: cmp r5, #1
+jmp L9
+L9: hlt
+mov r5, r5
+jmp L3
+dec NOPE
+mov r6, r4
+cmp L3, #k
+red r1
+ inc r4
+inc r4
+mov r0, r7
+ dec DAT[zz]
+dec DAT[zz]
+cmp L6, #k
+mov r1 r2
+red r1
+red r4
+lea DAT, r2
+cmp r6, #1
+cmp r5, #k
+mov r2, r2
+bne L8
+mov r7, r7
+inc L2
+mov r5, r5
+mov r4, r4
+jmp L5
+L1: cmp r1, #k
+L11: red r3
+L8: dec r6
+mov r6, r6
+jmp L8
+cmp r0, #-2
+L0: jmp L2
+L2: prn r1
+; comment
+red r4
+bne L9
+cmp DAT[zz], DAT
+red r5
+ hlt
+DAT: .data 1, 2, 3, k
+.entry L2
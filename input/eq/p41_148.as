@@ -0,0 +1,74 @@
+.define k = 3
+.extern X1
+jmp L0
+dec r3
+red r3
+ dec r5
+inc r5
+jmp L9
+L9: hlt
+red r6
+jmp L7
+
+red r0
+jmp L3
+L3: rts
+lea DAT, r2
+sub #4, r3
+cmp r3, #k
+prn #k
+ dec DAT
+dec DAT
+not r1
+mov r5, r5
+inc DAT[k]
+dec r4
+; comment
+L0: jmp L0
+jmp L4
+L4: rts
+; comment
+; comment
+mov r1, r1
+mov r1, r1
+ inc r0
+inc r0
+; comment
+L11: ; comment
+L6: jmp L9
+L10: red r3
+mov r5, r5
+add r1, r2
+red r5
+
+red r5
+cmp r5, #k
+L1: jmp L4
+L2: not r1
+
+cmp r7, DAT[1]
+jmp L2
+red r2
+jmp L3
+mov r6, r7
+inc DAT[2]
+add r1, r2
+mov r7, r3
+L7: red r6
+red r0
+cmp r2, #-2
+jmp L1
+ dec r2
+dec r2
+ inc r2
+dec r2
+; comment
+; comment
+red r5
+L5: jmp L8
+red r0
+bne L8
+ hlt
+L8: hlt
+DAT: .data 1, 2, 3, k
+.entry L1
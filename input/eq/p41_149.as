@@ -0,0 +1,75 @@
+.define k = 3
+.extern X1
+ inc r0
+L4: dec r0
+L5: ; comment
+L2: mov r1, r1
+dec r6
+L7: mov r7, r7
+L9: lea DAT, r2
+cmp L5, #k
+L1: mov r4, r4
+jmp L0
+L0: inc r2
+L10: cmp r3, #-2
+cmp r3, #1
+L3: dec L0
+cmp r4, #-2
+; comment
+cmp r6, #1
+L6: mov r4, r4
+cmp DAT[1], #k
+cmp L3, L5
+bne L3
+mov r6, r6
+cmp r6, #1
+inc r6
+red r0
+ inc r7
+dec r7
+jmp L5
+sub #4, r3
+ dec r1
+inc r1
+jmp L4
+cmp r6, #-2
+ dec r7
+dec r7
+jmp L4
+L11: dec r1
+ dec X1
+inc X1
+L8: cmp L5, #1
+dec r2
+ dec L5
+dec L5
+add r1, r2
+cmp DAT[k], r2
+ inc r3
+inc r3
+mov r1, r1
+mov r6, r6
+dec DAT[2]
+bne L2
+jmp L7
+; comment
+red r0
+mov r3, r1
+jmp L6
+red r7
+mov r5, r5
+cmp r0, r2
+jmp L5
+mov r3, r3
+bne L0
+ dec r5
+inc r5
+ inc DAT
+inc DAT
+cmp r6, #1
+mov r0, r0
+mov r2, r2
+not r1
+ hlt
+DAT: .data 1, 2, 3, k
+.entry L1
@@ -0,0 +1,78 @@
+.define k = 3
+.extern X1
+mov r0, r0
+mov r2, r5
+ dec DAT[2]
+inc DAT[2]
+cmp r5, #-2
+
+dec DAT[zz]
+dec r1
+cmp DAT, #k
+cmp r1, r1
+red r4
+jmp L2
+L2: prn r1
+L5: dec DAT[2]
+ dec r4
+dec r4
+mov r4, r1
+mov r0, r2
+jmp L7
+L7: hlt
+mov r7, r7
+ inc DAT[1]
+dec DAT[1]
+mov r4, r4
+; comment
+red r6
+L8: jmp L8
+inc L5
+dec L3
+jmp L8
+ dec r2
+L10: dec r2
+jmp L9
+L9: hlt
+add r1, r2
+L1: bne L7
+bne L9
+jmp L5
+jmp L8
+clr L1
+ dec DAT
+L4: dec DAT
+ inc r7
+L6: dec r7
+bne L7
+red r3
+jmp L0
+L0: rts
+mov r1 r2
+jmp L8
+red r7
+inc r7
+inc r2
+jmp L7
+red r4
+; comment
+jmp L1
+ inc r7
+inc r7
+L11: bne L6
+ dec r7
+dec r7
+mov r3, r3
+red r2
+jmp L2
+mov r3, r6
+cmp r6, DAT[zz]
+red r7
+ dec r5
+dec r5
+ inc r3
+L3: dec r3
+cmp r7, r3
+cmp NOPE, #1
+ hlt
+DAT: .data 1, 2, 3, k
@@ -0,0 +1,74 @@
+.define k = 3
+.extern X1
+red r3
+; comment
+L6: mov r4, r4
+red r7
+ inc r2
+inc r2
+inc r0
+cmp r7, r0
+L0: not r1
+L10: red r1
+L5: red r0
+bne L4
+mov r1, r1
+jmp L4
+L4: hlt
+L11: inc r6
+L2: red r4
+ dec r3
+inc r3
+ dec r1
+dec r1
+clr L1
+jmp L6
+cmp r7, #-2
+red r6
+L7: red r3
+mov r0, r0
+bne L9
+ dec r2
+L1: inc r2
+jmp L2
+bne L4
+L3: red r2
+inc r7
+cmp r5, #k
+jmp L1
+ dec r0
+dec r0
+ inc r3
+L8: dec r3
+L9: cmp r3, #k
+bne L3
+cmp r3, #1
+cmp r4, #k
+mov r3, r3
+red r7
+; comment
+bne L3
+jmp L9
+ inc DAT
+dec DAT
+jmp L4
+mov r1, r1
+mov r5, r5
+cmp r6, #k
+jmp L6
+cmp DAT[zz], #-2
+mov r1 r2
+mov r7, r7
+bne L5
+mov r2, r6
+mov r7, r7
+red r0
+red r7
+ dec r1
+dec r1
+inc r4
+ inc r0
+dec r0
+cmp r5, #k
+ hlt
+DAT: .data 1, 2, 3, k
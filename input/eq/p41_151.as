@@ -0,0 +1,71 @@
+.define k = 3
+.extern X1
+
+jmp L3
+L3: prn r1
+jmp L7
+L7: hlt
+; comment
+bne L9
+mov r2, r2
+L2: cmp r5, #k
+ dec X1
+inc X1
+; comment
+jmp L1
+cmp DAT[2], #1
+
+inc r7
+; comment
+add r1, r2
+red r7
+L10: bne L5
+mov r6, r6
+jmp L1
+L1: inc r2
+jmp L4
+L4: hlt
+mov r0, r0
+jmp L4
+L11: cmp L6, #-2
+jmp L0
+L0: hlt
+jmp L0
+L9: bne L4
+cmp r3, #1
+
+L5: jmp L3
+L8: red r5
+mov r3, r3
+cmp L7, L5
+cmp r1, r5
+not r1
+cmp r5, L4
+inc r4
+L6: dec r7
+jmp L3
+dec r7
+inc DAT[k]
+; comment
+mov r0, r0
+cmp r6, L3
+sub #4, r3
+red r3
+lea DAT, r2
+mov r3, r3
+mov r5, r5
+mov r4, r4
+red r4
+red r0
+mov r3, r7
+red r3
+
+jmp L7
+ dec r3
+inc r3
+mov r5, r5
+red r2
+jmp L3
+red r5
+ hlt
+DAT: .data 1, 2, 3, k
@@ -0,0 +1,75 @@
+.define k = 3
+.extern X1
+inc r3
+jmp L0
+L0: inc r2
+red r3
+cmp r0, #k
+cmp r6, #1
+L2: 
+mov r6, r6
+cmp DAT[1], #1
+inc L5
+bne L8
+L6: ; comment
+bne L7
+red r6
+ inc r6
+dec r6
+ inc r6
+dec r6
+cmp r3, L5
+ dec r7
+L10: dec r7
+add r1, r2
+mov r4, r4
+red r0
+L7: sub #4, r3
+ dec L4
+L4: inc L4
+ dec r7
+dec r7
+cmp r2, #1
+cmp r5, r5
+L8: cmp DAT[2], r5
+ inc r5
+inc r5
+; comment
+not r1
+red r7
+ inc DAT[k]
+dec DAT[k]
+; comment
+ dec r4
+dec r4
+L11: jmp L6
+red r4
+bne L5
+L9: red r0
+cmp r3, #-2
+cmp DAT[k], #-2
+dec r7
+mov r2, r7
+L5: cmp L6, #1
+L1: cmp DAT[2], #k
+cmp r5, #k
+mov r6, r6
+bne L4
+mov r3, r0
+cmp DAT[2], #-2
+ dec r7
+dec r7
+ inc r1
+dec r1
+mov r7, r7
+L3: cmp r0, #-2
+
+red r6
+red r3
+red r7
+cmp DAT[k], #k
+red r1
+; comment
+jmp L0
+ hlt
+DAT: .data 1, 2, 3, k
@@ -0,0 +1,76 @@
+.define k = 3
+.extern X1
+mov r4, r6
+jmp L9
+L9: prn r1
+red r5
+jmp L3
+; comment
+bne L9
+L4: lea DAT, r2
+add r1, r2
+red r6
+ inc r0
+dec r0
+jmp L2
+L2: inc r2
+L6: clr L1
+L1: cmp r7, #1
+jmp L7
+L7: prn r1
+cmp X1, #1
+add r1, r2
+jmp L9
+ dec r3
+inc r3
+dec DAT[1]
+ inc DAT[k]
+L11: dec DAT[k]
+
+bne L0
+jmp L3
+L3: rts
+cmp r7, #1
+jmp L4
+mov r3, r0
+mov r6, r2
+jmp L3
+L10: 
+cmp r3, #-2
+ dec L7
+inc L7
+inc r0
+jmp L8
+ inc r2
+dec r2
+L0: cmp r0, #1
+; comment
+bne L9
+ inc r0
+L8: inc r0
+L5: jmp L8
+cmp r4, #k
+red r5
+mov r1, r3
+
+lea DAT, r2
+red r2
+not r1
+
+mov r3, r3
+ dec r6
+inc r6
+jmp L3
+jmp L2
+dec DAT[2]
+mov r4, r4
+cmp X1, r6
+bne L0
+mov r1, r0
+jmp L5
+dec L4
+red r3
+cmp L5, #1
+ hlt
+DAT: .data 1, 2, 3, k
+.entry L0
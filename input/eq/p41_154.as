@@ -0,0 +1,69 @@
+.define k = 3
+.extern X1
+red r6
+cmp L7, r6
+jmp L0
+jmp L0
+dec r1
+ dec DAT[1]
+L0: dec DAT[1]
+; comment
+L6: red r1
+mov r3, r3
+mov r0, r0
+cmp r6, #-2
+bne L3
+cmp DAT[k], #-2
+inc r1
+; comment
+cmp DAT[1], #-2
+L10: cmp r6, #1
+L8: mov r4, r4
+red r7
+
+inc L5
+mov r7, r7
+red r2
+L4: inc r4
+L1: jmp L3
+L3: inc r2
+mov r4, r4
+red r2
+jmp L9
+L9: hlt
+not r1
+L11: dec r6
+
+inc r5
+cmp r4, #k
+jmp L3
+L5: inc r3
+L2: inc r3
+; comment
+jmp L0
+mov r3, r0
+red r5
+cmp DAT[2], #-2
+red r5
+L7: red r3
+cmp r4, #-2
+cmp r3, DAT[1]
+mov r0, r0
+ inc L0
+inc L0
+dec DAT
+cmp r7, #1
+red r0
+ dec L2
+dec L2
+jmp L1
+; comment
+mov r7, r7
+jmp L7
+mov r1, r7
+mov r2, r2
+red r5
+jmp L9
+jmp L4
+ hlt
+DAT: .data 1, 2, 3, k
@@ -0,0 +1,73 @@
+.define k = 3
+.extern X1
+jmp L4
+dec DAT
+red r0
+mov r2, r2
+clr L1
+L9: jmp L5
+L5: inc r2
+jmp L3
+L3: inc r2
+ dec r4
+inc r4
+L10: sub #4, r3
+L8: cmp r7, r5
+cmp r7, #1
+jmp L0
+L0: inc r2
+cmp r2, r4
+jmp L0
+cmp r4, #1
+L7: mov r1, r1
+dec r7
+cmp r5, #1
+ dec r6
+dec r6
+red r6
+red r5
+red r0
+red r3
+sub #4, r3
+lea DAT, r2
+
+L4: red r4
+red r4
+cmp r3, #1
+jmp L0
+mov r1, r1
+red r1
+cmp r0, #1
+dec L5
+L11: red r6
+jmp L2
+L2: inc r2
+red r7
+bne L2
+ dec r2
+inc r2
+add r1, r2
+red r7
+L6: red r7
+bne L5
+L1: jmp L5
+ inc r4
+inc r4
+mov r5, r5
+jmp L3
+dec DAT[2]
+jmp L3
+mov r2, r0
+red r5
+bne L5
+sub #4, r3
+cmp r4, #-2
+jmp L6
+cmp r6, r6
+not r1
+red r5
+inc r4
+dec r6
+ hlt
+DAT: .data 1, 2, 3, k
+.entry L0
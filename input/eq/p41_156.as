@@ -0,0 +1,74 @@
+.define k = 3
+.extern X1
+red r3
+cmp r2, DAT[zz]
+cmp r0, r0
+red r5
+L5: mov r2, r2
+cmp r3, r2
+mov r6, r6
+L1: jmp L9
+bne L7
+red r2
+dec r1
+ dec r1
+dec r1
+bne L6
+jmp L3
+mov r4, r4
+sub #4, r3
+cmp r3, L2
+red r2
+cmp r6, #-2
+cmp r0, #k
+cmp r6, #-2
+jmp L6
+jmp L5
+L0: red r5
+mov r6, r6
+L4: inc DAT[k]
+cmp r7, #k
+cmp L3, #1
+jmp L5
+red r3
+L6: jmp L9
+L9: rts
+ dec DAT[1]
+inc DAT[1]
+mov r6, r4
+jmp L7
+mov r7, r2
+jmp L2
+jmp L3
+L3: rts
+jmp L3
+L11: mov r5, r5
+ dec DAT[2]
+dec DAT[2]
+inc r4
+inc r4
+L10: jmp L8
+L8: prn r1
+ inc r6
+inc r6
+jmp L3
+inc r6
+L7: mov r4, r4
+red r4
+dec r3
+ dec DAT[2]
+L2: dec DAT[2]
+inc r2
+mov r6, r1
+ dec r2
+inc r2
+cmp r5, #k
+inc r0
+inc r0
+jmp L2
+
+jmp L0
+inc r3
+ hlt
+DAT: .data 1, 2, 3, k
+.entry L2
@@ -0,0 +1,75 @@
+.define k = 3
+.extern X1
+cmp r5, #-2
+L3: add r1, r2
+ dec r1
+L7: inc r1
+mov r1, r1
+red r5
+cmp r4, #1
+jmp L8
+bne L5
+L6: jmp L2
+jmp L2
+L2: prn r1
+add r1, r2
+red r1
+cmp r5, #-2
+red r5
+inc L6
+mov r4, r4
+cmp DAT, r7
+L4: dec DAT[2]
+L8: mov r3, r4
+mov r0, r0
+dec r7
+bne L8
+mov r3, r3
+L5: jmp L9
+L9: hlt
+red r1
+red r3
+; comment
+red r2
+ dec r7
+inc r7
+cmp L3, #k
+L10: mov r3, r3
+not r1
+L0: bne L4
+red r4
+ inc r5
+dec r5
+dec r5
+mov r4, r2
+red r2
+mov r6, r2
+jmp L9
+ inc r3
+inc r3
+jmp L8
+clr L1
+add r1, r2
+ inc r5
+dec r5
+L11: jmp L6
+ dec r6
+dec r6
+mov r2, r2
+cmp DAT[1], #k
+cmp r5, #1
+ inc r7
+dec r7
+red r4
+red r0
+lea DAT, r2
+mov r1, r1
+L1: jmp L2
+mov r3, r3
+
+ dec r7
+inc r7
+ dec r1
+inc r1
+ hlt
+DAT: .data 1, 2, 3, k
@@ -0,0 +1,75 @@
+.define k = 3
+.extern X1
+red r1
+L9: lea DAT, r2
+ inc r1
+inc r1
+L10: bne L8
+cmp DAT[k], L1
+add r1, r2
+cmp DAT[2], #k
+ inc L4
+dec L4
+bne L2
+; comment
+mov r2, r2
+cmp r7, #-2
+cmp DAT[1], r4
+clr L1
+L1: 
+red r6
+lea DAT, r2
+cmp DAT[k], r6
+dec L4
+L4: dec DAT[k]
+mov r7, r7
+mov r1, r6
+bne L9
+L8: red r6
+ inc DAT[k]
+inc DAT[k]
+L2: cmp r4, r1
+cmp r0, #1
+; comment
+ inc r0
+dec r0
+L6: mov r0, r0
+cmp X1, #1
+mov r4, r4
+bne L1
+bne L5
+ inc r4
+inc r4
+; comment
+jmp L2
+ inc r1
+dec r1
+jmp L4
+cmp r5, #-2
+mov r1, r1
+inc r4
+prn #k
+ inc L4
+dec L4
+jmp L8
+mov r5, r5
+; comment
+not r1
+jmp L5
+L5: inc r2
+L3: mov r2, r4
+mov r5, r5
+mov r3, r5
+mov r6, r6
+ dec DAT[1]
+dec DAT[1]
+L7: ; comment
+lea DAT, r2
+ inc DAT[k]
+inc DAT[k]
+inc r6
+cmp DAT[1], #-2
+cmp r2, #1
+ hlt
+L0: hlt
+DAT: .data 1, 2, 3, k
@@ -0,0 +1,76 @@
+.define k = 3
+.extern X1
+bne L3
+cmp r7, #k
+cmp r4, #k
+jmp L3
+L3: inc r2
+mov r2, r2
+sub #4, r3
+cmp r4, #1
+L9: cmp L5, #-2
+red r4
+red r1
+bne L1
+ dec r4
+dec r4
+L1: red r5
+ inc r1
+dec r1
+jmp L4
+L4: rts
+cmp L6, L5
+cmp r0, #1
+L8: red r1
+cmp r5, #1
+dec r2
+mov r5, r5
+cmp r1, #1
+ dec r2
+inc r2
+clr L1
+ inc r0
+dec r0
+L0: 
+
+prn #k
+bne L3
+red r6
+L5: not r1
+dec r7
+cmp r7, #k
+bne L7
+bne L5
+ inc DAT[k]
+dec DAT[k]
+cmp r3, #-2
+red r2
+jmp L2
+mov r4, r4
+bne L6
+red r3
+mov r0, r3
+inc L4
+inc r4
+ inc r2
+dec r2
+sub #4, r3
+L6: bne L6
+L11: cmp L6, #1
+L10: mov r2, r2
+red r7
+jmp L4
+inc r4
+jmp L2
+L2: inc r2
+L7: mov r1, r1
+cmp DAT[k], #1
+ inc r0
+dec r0
+jmp L4
+ dec DAT[1]
+inc DAT[1]
+jmp L5
+ hlt
+DAT: .data 1, 2, 3, k
+.entry L2
@@ -0,0 +1,74 @@
+.define k = 3
+.extern X1
+ inc r7
+dec r7
+cmp r5, #k
+L3: red r4
+L2: ; comment
+mov r7, r7
+red r4
+ dec r7
+inc r7
+cmp r1, #k
+cmp r7, r2
+mov r7, r7
+bne L1
+jmp L7
+bne L6
+mov r0, r0
+ inc L1
+inc L1
+cmp r0, #1
+sub #4, r3
+bne L3
+L0: cmp r1, #k
+mov r7, r7
+mov r0, r6
+red r6
+L6: mov r1, r1
+mov r6, r6
+red r6
+inc r7
+dec r4
+lea DAT, r2
+cmp L3, #-2
+mov r1, r5
+L4: ; comment
+mov r5, r5
+ inc r3
+L7: inc r3
+cmp r3, r0
+mov r3, r3
+jmp L8
+lea DAT, r2
+jmp L8
+ inc r7
+inc r7
+L8: prn #k
+red r2
+L11: bne L1
+lea DAT, r2
+ dec r1
+inc r1
+cmp DAT[1], #1
+mov r6, r6
+L10: jmp L5
+mov r3, r3
+ inc DAT[2]
+dec DAT[2]
+L5: inc L6
+ inc r7
+L1: inc r7
+L9: bne L4
+red r6
+mov r1, r0
+ dec DAT
+dec DAT
+jmp L6
+sub #4, r3
+cmp r7, #1
+; comment
+ inc r7
+dec r7
+ hlt
+DAT: .data 1, 2, 3, k
@@ -0,0 +1,75 @@
+.define k = 3
+.extern X1
+ dec r5
+L5: inc r5
+ dec r1
+inc r1
+red r5
+
+red r3
+L10: bne L4
+L1: cmp r7, r0
+inc r0
+inc r4
+ dec DAT[2]
+inc DAT[2]
+mov r2, r3
+jmp L1
+L2: red r0
+red r0
+ inc r2
+L4: dec r2
+dec r2
+jmp L8
+inc r7
+; comment
+cmp r4, #1
+mov r4, r2
+ dec DAT[k]
+dec DAT[k]
+cmp DAT[k], r3
+inc r3
+dec DAT[1]
+L3: cmp r6, #k
+mov r6, r6
+ inc r0
+inc r0
+jmp L1
+jmp L4
+red r5
+red r1
+L11: 
+jmp L9
+L9: rts
+jmp L5
+bne L9
+L6: red r5
+jmp L2
+ inc DAT[1]
+L0: inc DAT[1]
+red r4
+mov r3, r3
+prn #k
+dec r2
+bne L1
+cmp r3, r6
+; comment
+bne L3
+jmp L1
+ inc r4
+dec r4
+cmp r6, #-2
+; comment
+inc r5
+red r7
+red r4
+jmp L3
+cmp r6, #-2
+cmp DAT[k], L6
+cmp r5, r5
+L8: red r0
+mov r7, r1
+ hlt
+L7: hlt
+DAT: .data 1, 2, 3, k
+.entry L1
@@ -0,0 +1,74 @@
+.define k = 3
+.extern X1
+jmp L3
+jmp L0
+red r7
+dec r1
+L0: 
+jmp L6
+L6: prn r1
+ dec r2
+dec r2
+L8: cmp L6, r4
+cmp L0, #1
+cmp r3, #1
+red r0
+cmp DAT[2], #1
+; comment
+ dec L3
+inc L3
+cmp r4, #k
+jmp L5
+L5: rts
+mov r7, r7
+inc r7
+jmp L7
+L7: rts
+
+L3: jmp L4
+L4: inc r2
+mov r2, r2
+L10: red r7
+dec r0
+dec r7
+mov r7, r7
+dec DAT[k]
+inc r0
+red r4
+ inc X1
+inc X1
+mov r1, r1
+cmp r7, r7
+cmp r7, #-2
+cmp r0, #k
+L1: jmp L3
+L11: jmp L2
+L2: rts
+inc L3
+ dec r1
+L9: dec r1
+mov r1, r1
+mov r5, r5
+ inc DAT[2]
+inc DAT[2]
+cmp L0, DAT[1]
+jmp L0
+mov r5, r5
+red r4
+bne L6
+mov r1, r1
+red r4
+red r6
+mov r7, r7
+cmp r2, #-2
+prn #k
+red r6
+red r3
+bne L9
+bne L3
+mov r7, r7
+cmp r5, r1
+bne L6
+
+ hlt
+DAT: .data 1, 2, 3, k
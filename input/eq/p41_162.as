@@ -0,0 +1,70 @@
+.define k = 3
+.extern X1
+L10: cmp r7, DAT[2]
+cmp r5, #1
+mov r4, r4
+add r1, r2
+red r2
+red r1
+cmp L3, #k
+bne L9
+
+jmp L0
+L0: hlt
+mov r4, r4
+jmp L7
+L7: inc r2
+cmp L7, L6
+cmp r5, #1
+ inc r2
+inc r2
+red r3
+dec L2
+not r1
+L9: cmp L0, #1
+mov r2, r2
+mov r2, r2
+L6: lea DAT, r2
+red r2
+mov r7, r7
+mov r3, r1
+L3: red r5
+dec DAT[2]
+jmp L9
+ dec DAT[zz]
+inc DAT[zz]
+jmp L6
+mov r2, r2
+jmp L9
+L5: lea DAT, r2
+jmp L7
+sub #4, r3
+jmp L5
+cmp r4, #k
+mov r5, r5
+prn #k
+
+L4: mov r3, r3
+mov r2, r2
+cmp DAT, #k
+L8: bne L7
+ dec r2
+dec r2
+bne L0
+L2: red r3
+mov r3, r3
+mov r7, r7
+bne L1
+prn #k
+ inc L3
+inc L3
+jmp L2
+dec r2
+jmp L7
+bne L0
+L11: mov r7, r5
+L1: dec r5
+jmp L1
+mov r6, r0
+ hlt
+DAT: .data 1, 2, 3, k
@@ -0,0 +1,78 @@
+.define k = 3
+.extern X1
+ dec L7
+inc L7
+mov r2, r2
+ dec r1
+dec r1
+ inc L2
+dec L2
+ inc r3
+inc r3
+ inc r1
+inc r1
+bne L0
+dec X1
+dec DAT[k]
+jmp L0
+L0: rts
+red r3
+ dec r6
+L7: inc r6
+red r3
+mov r5, r5
+jmp L2
+red r3
+red r2
+mov r3, r3
+mov r1, r7
+L5: red r4
+L9: bne L0
+L4: 
+mov r0, r0
+jmp L7
+; comment
+L10: cmp r5, #k
+cmp r6, #-2
+L11: bne L0
+ inc r6
+inc r6
+ dec r5
+inc r5
+mov r5, r5
+red r4
+mov r3, r2
+cmp r5, #k
+bne L8
+L3: red r1
+red r6
+dec L5
+dec r6
+red r6
+ inc r6
+L6: dec r6
+bne L1
+cmp r1, r4
+; comment
+; comment
+L2: mov r3, r3
+ dec r4
+dec r4
+L1: mov r7, r7
+L8: red r4
+mov r3, r3
+cmp r5, #-2
+ dec r0
+inc r0
+not r1
+bne L5
+cmp r3, r4
+ inc r1
+dec r1
+bne L2
+jmp L2
+jmp L9
+cmp DAT[k], r7
+ hlt
+DAT: .data 1, 2, 3, k
+.entry L2
@@ -0,0 +1,71 @@
+.define k = 3
+.extern X1
+L4: red r4
+jmp L1
+L1: inc r2
+L11: cmp DAT[k], #1
+
+L2: bne L0
+mov r5, r5
+jmp L3
+mov r3, r3
+L0: bne L7
+mov r2, r2
+dec L5
+mov r6, r1
+
+ inc r5
+inc r5
+cmp DAT[2], #-2
+red r3
+ dec r2
+L9: inc r2
+cmp r4, r7
+not r1
+L3: jmp L0
+cmp L6, #1
+ inc r7
+L7: dec r7
+dec r5
+cmp r5, #k
+cmp DAT[k], #1
+red r7
+jmp L5
+cmp DAT[2], #1
+red r1
+cmp r7, #-2
+jmp L3
+L6: bne L6
+jmp L4
+ dec r3
+inc r3
+jmp L4
+jmp L5
+L5: prn r1
+cmp L1, #-2
+L10: sub #4, r3
+mov r7, r4
+inc r0
+jmp L0
+red r5
+red r4
+; comment
+ dec r1
+inc r1
+L8: red r2
+add r1, r2
+mov r7, r7
+dec r4
+bne L4
+cmp r7, #-2
+cmp r7, #1
+add r1, r2
+clr L1
+cmp r6, #k
+cmp r1, #k
+mov r2, r7
+red r5
+red r4
+dec r4
+ hlt
+DAT: .data 1, 2, 3, k
@@ -0,0 +1,70 @@
+.define k = 3
+.extern X1
+L11: red r1
+red r6
+bne L5
+; comment
+L1: bne L2
+red r6
+L7: red r6
+mov r7, r7
+mov r4, r3
+L10: jmp L3
+L3: rts
+L5: inc L5
+jmp L4
+cmp NOPE, #k
+L0: red r2
+bne L8
+L4: dec DAT[1]
+ inc L2
+L9: inc L2
+inc DAT[k]
+mov r4, r5
+sub #4, r3
+cmp DAT[2], DAT[k]
+bne L7
+; comment
+sub #4, r3
+L2: bne L8
+ inc r3
+inc r3
+cmp r0, #1
+ dec r0
+dec r0
+cmp r1, r7
+prn #k
+cmp DAT[k], DAT[zz]
+jmp L1
+sub #4, r3
+dec r0
+L8: cmp r3, L6
+red r7
+; comment
+
+mov r7, r7
+ inc r1
+dec r1
+bne L5
+cmp DAT[k], #-2
+; comment
+L6: red r6
+jmp L8
+mov r3, r3
+bne L1
+dec r3
+dec r5
+not r1
+inc L2
+cmp r4, #k
+jmp L2
+cmp DAT[k], #1
+ dec r7
+dec r7
+red r3
+inc L3
+bne L8
+cmp r6, #-2
+bne L2
+ hlt
+DAT: .data 1, 2, 3, k
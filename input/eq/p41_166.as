@@ -0,0 +1,73 @@
+.define k = 3
+.extern X1
+L9: dec r0
+cmp DAT[1], #1
+L6: mov r2, r2
+dec L5
+cmp DAT[k], #k
+cmp r2, #k
+red r1
+mov r0, r0
+dec DAT[2]
+dec r4
+L0: ; comment
+ dec r6
+inc r6
+sub #4, r3
+ inc r2
+inc r2
+red r1
+cmp L1, #1
+mov r7, r5
+L11: inc r6
+ inc r7
+dec r7
+
+cmp r0, #1
+bne L1
+L5: 
+red r6
+red r7
+mov r7, r7
+lea DAT, r2
+cmp L3, #k
+jmp L1
+L1: rts
+L8: lea DAT, r2
+inc r0
+L7: red r0
+L2: dec r6
+cmp r6, #k
+red r4
+mov r0, r5
+jmp L7
+cmp r7, #1
+mov r7, r2
+jmp L9
+ inc r6
+dec r6
+cmp r7, r7
+cmp r5, #1
+ dec r5
+dec r5
+add r1, r2
+bne L8
+red r1
+inc L0
+jmp L4
+L4: prn r1
+red r5
+
+L3: red r0
+ dec DAT[2]
+inc DAT[2]
+add r1, r2
+mov r3, r0
+mov r7, r7
+red r0
+not r1
+cmp L0, #k
+L10: bne L4
+ hlt
+DAT: .data 1, 2, 3, k
+.entry L2
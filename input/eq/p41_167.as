@@ -0,0 +1,70 @@
+.define k = 3
+.extern X1
+mov r6, r6
+add r1, r2
+jmp L6
+red r0
+mov r2, r2
+mov r4, r4
+mov r1, r1
+mov r0, r0
+red r5
+mov r0, r0
+L4: 
+cmp DAT[k], #-2
+prn #k
+L9: red r3
+inc r6
+bne L9
+mov r3, r5
+dec L1
+dec r5
+inc r7
+add r1, r2
+bne L4
+red r4
+; comment
+L3: mov r1, r1
+ inc r0
+dec r0
+
+jmp L0
+L6: inc r5
+red r4
+L10: dec r2
+L7: inc DAT[1]
+ dec r0
+dec r0
+mov r7, r7
+red r5
+not r1
+
+inc r4
+L0: add r1, r2
+cmp DAT[1], #1
+bne L0
+mov r5, r5
+mov r5, r5
+jmp L0
+red r3
+L1: mov r2, r6
+L8: bne L0
+inc r3
+cmp r3, #k
+mov r4, r6
+cmp DAT[k], r1
+ inc r6
+inc r6
+red r2
+jmp L3
+ dec r3
+dec r3
+jmp L0
+bne L9
+red r0
+; comment
+jmp L2
+L2: inc r2
+ hlt
+L5: hlt
+DAT: .data 1, 2, 3, k
@@ -0,0 +1,75 @@
+.define k = 3
+.extern X1
+jmp L6
+L6: rts
+L9: jmp L7
+bne L1
+mov r5, r5
+cmp r4, #-2
+cmp DAT[zz], DAT[1]
+ dec NOPE
+inc NOPE
+bne L0
+inc r1
+jmp L1
+L1: rts
+red r0
+jmp L3
+L3: inc r2
+cmp DAT[1], #k
+not r1
+L7: bne L8
+dec DAT[1]
+L4: cmp r5, #1
+dec r4
+L0: cmp r4, #-2
+red r2
+L5: cmp r7, r1
+dec DAT[2]
+jmp L1
+L2: jmp L3
+inc r3
+red r2
+cmp L1, #1
+; comment
+mov r3, r3
+ dec r0
+inc r0
+red r2
+cmp r4, #1
+cmp L4, #k
+mov r2, r2
+bne L3
+L8: mov r0, r1
+mov r3, r1
+red r4
+ dec r3
+inc r3
+L10: add r1, r2
+jmp L1
+mov r5, r5
+not r1
+mov r2, r5
+ dec DAT[k]
+L11: dec DAT[k]
+bne L6
+ inc r6
+inc r6
+bne L0
+mov r3, r6
+cmp r0, #1
+red r4
+lea DAT, r2
+red r1
+ inc r7
+inc r7
+ dec r4
+inc r4
+cmp r2, r7
+bne L3
+sub #4, r3
+jmp L1
+mov r6, r5
+ hlt
+DAT: .data 1, 2, 3, k
+.entry L0
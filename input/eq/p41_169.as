@@ -0,0 +1,74 @@
+.define k = 3
+.extern X1
+jmp L8
+L8: prn r1
+jmp L7
+L7: hlt
+mov r0, r0
+L10: cmp r0, #-2
+ dec L5
+inc L5
+cmp L1, #1
+L4: prn #k
+bne L6
+jmp L6
+L6: inc r2
+bne L9
+L3: inc r2
+inc r3
+clr L1
+clr L1
+jmp L5
+L5: prn r1
+
+mov r0, r4
+red r0
+bne L9
+bne L7
+mov r2, r4
+mov r5, r5
+L1: red r7
+L9: bne L8
+jmp L6
+L0: ; comment
+red r6
+L11: prn #k
+inc r5
+ dec r6
+dec r6
+mov r4, r4
+L2: bne L2
+dec r6
+bne L2
+jmp L6
+ dec DAT[2]
+dec DAT[2]
+jmp L3
+jmp L4
+cmp r0, #k
+mov r6, r6
+inc r0
+; comment
+jmp L0
+bne L7
+red r7
+bne L9
+; comment
+bne L2
+mov r6, r6
+red r3
+jmp L3
+bne L1
+ inc r5
+dec r5
+red r5
+mov r1, r1
+red r5
+mov r1, r1
+
+mov r4, r4
+ inc r4
+inc r4
+ hlt
+DAT: .data 1, 2, 3, k
+.entry L1
@@ -0,0 +1,79 @@
+.define k = 3
+.extern X1
+; comment
+cmp DAT[2], #1
+cmp DAT[k], r5
+L8: mov r3, r3
+jmp L3
+L3: hlt
+jmp L4
+L4: inc r2
+jmp L6
+mov r5, r5
+add r1, r2
+ inc DAT[k]
+inc DAT[k]
+jmp L5
+L5: hlt
+cmp X1, #k
+red r5
+L1: red r4
+mov r5, r5
+ dec r3
+dec r3
+L9: jmp L2
+L2: inc r2
+L7: red r1
+mov r4, r5
+mov r6, r6
+
+ inc r1
+dec r1
+; comment
+L11: jmp L7
+jmp L1
+cmp r3, r0
+L6: red r2
+jmp L9
+ inc r1
+L0: inc r1
+red r2
+ dec X1
+dec X1
+red r7
+ inc r1
+dec r1
+ inc r1
+inc r1
+mov r6, r6
+add r1, r2
+L10: cmp r6, #k
+add r1, r2
+red r5
+dec L3
+cmp r6, r3
+cmp r2, DAT[1]
+red r2
+mov r5, r5
+cmp r1, #-2
+ inc r7
+inc r7
+jmp L5
+ inc r6
+dec r6
+inc DAT[k]
+ dec r2
+dec r2
+cmp r6, #k
+red r3
+mov r0, r0
+dec L4
+sub #4, r3
+
+bne L3
+jmp L6
+dec L2
+mov r3, r6
+ hlt
+DAT: .data 1, 2, 3, k
+.entry L1
@@ -0,0 +1,75 @@
+.define k = 3
+.extern X1
+red r5
+cmp r1, r0
+ inc r5
+dec r5
+red r2
+inc DAT[2]
+red r1
+mov r0, r0
+clr L1
+mov r0, r0
+jmp L2
+L2: inc r2
+cmp r1, #1
+jmp L0
+L0: hlt
+bne L1
+jmp L9
+L6: jmp L2
+mov r5, r5
+lea DAT, r2
+red r1
+dec DAT[2]
+L10: bne L9
+jmp L3
+L3: prn r1
+cmp r2, #-2
+L8: dec r4
+ inc L3
+inc L3
+ inc r3
+inc r3
+L1: cmp L0, #1
+L5: red r5
+ inc r0
+dec r0
+L4: lea DAT, r2
+L9: mov r5, r5
+inc DAT[k]
+cmp X1, #-2
+mov r0, r0
+cmp L6, #1
+dec L2
+jmp L8
+cmp r7, DAT[k]
+jmp L8
+jmp L7
+L7: rts
+jmp L7
+L11: cmp r3, r4
+not r1
+jmp L5
+mov r1, r1
+red r4
+jmp L6
+dec r2
+lea DAT, r2
+mov r4, r4
+; comment
+cmp r2, #k
+ dec r2
+inc r2
+mov r4, r6
+red r6
+ inc L2
+inc L2
+mov r1, r1
+bne L1
+inc DAT[1]
+clr L1
+mov r5, r5
+ hlt
+DAT: .data 1, 2, 3, k
+.entry L0
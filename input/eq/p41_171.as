@@ -0,0 +1,70 @@
+.define k = 3
+.extern X1
+jmp L6
+L6: inc r2
+cmp r5, #-2
+red r3
+
+jmp L3
+L9: jmp L5
+L5: prn r1
+prn #k
+mov r2, r2
+ inc L6
+dec L6
+ dec r3
+dec r3
+; comment
+ inc L2
+dec L2
+sub #4, r3
+jmp L0
+red r7
+L3: jmp L3
+mov r3, r3
+L11: mov r7, r7
+jmp L0
+dec r5
+mov r6, r6
+jmp L9
+jmp L3
+L2: mov r6, r1
+mov r4, r4
+bne L6
+red r2
+L10: red r5
+L1: sub #4, r3
+mov r5, r0
+L8: inc r0
+mov r2, r2
+cmp r5, r6
+cmp L0, #k
+sub #4, r3
+red r7
+dec r3
+add r1, r2
+bne L5
+L7: jmp L7
+mov r4, r4
+L0: red r2
+L4: cmp r5, #1
+red r2
+jmp L3
+
+
+cmp r5, #k
+jmp L0
+bne L0
+cmp r4, #-2
+cmp DAT[zz], #-2
+add r1, r2
+jmp L7
+dec DAT[2]
+jmp L3
+bne L0
+; comment
+cmp r3, #-2
+red r0
+ hlt
+DAT: .data 1, 2, 3, k
+.entry L0
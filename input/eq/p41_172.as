@@ -0,0 +1,72 @@
+.define k = 3
+.extern X1
+cmp DAT[2], r6
+; comment
+add r1, r2
+cmp r6, #-2
+cmp r3, #1
+red r6
+jmp L8
+L8: hlt
+red r6
+red r7
+dec r2
+cmp r4, #k
+cmp r1, #k
+red r4
+inc r3
+; comment
+ dec r1
+inc r1
+; comment
+bne L4
+L6: cmp L5, #k
+jmp L4
+cmp r4, r3
+L1: mov r5, r5
+cmp r4, #k
+mov r4, r4
+cmp DAT, #k
+ inc r1
+dec r1
+L3: cmp r0, #-2
+cmp DAT[k], r5
+red r4
+L2: 
+bne L2
+bne L6
+mov r0, r0
+cmp r5, #1
+cmp r4, #1
+red r3
+inc r1
+; comment
+cmp r2, #1
+mov r5, r3
+
+bne L8
+dec r7
+cmp L1, #k
+L10: not r1
+jmp L4
+L4: inc r2
+cmp r6, #-2
+mov r4, r4
+L7: red r7
+red r4
+mov r3, r3
+mov r5, r5
+
+ inc r5
+inc r5
+ dec DAT[1]
+inc DAT[1]
+sub #4, r3
+cmp r5, #k
+dec r1
+ inc r5
+L9: dec r5
+L0: jmp L2
+ hlt
+L5: hlt
+DAT: .data 1, 2, 3, k
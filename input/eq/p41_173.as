@@ -0,0 +1,77 @@
+.define k = 3
+.extern X1
+bne L8
+red r3
+bne L5
+cmp r2, #-2
+L9: add r1, r2
+mov r6, r6
+ inc r6
+inc r6
+mov r3, r3
+bne L4
+jmp L5
+cmp DAT[2], r3
+jmp L1
+red r4
+red r4
+jmp L6
+L6: prn r1
+L4: mov r5, r4
+red r2
+red r4
+L5: mov r1, r1
+L1: jmp L7
+L7: prn r1
+L3: 
+ inc r6
+dec r6
+mov r1, r6
+cmp r0, #-2
+cmp r4, #1
+red r3
+mov r1, r1
+mov r4, r4
+L8: cmp r1, r5
+ dec r6
+L2: dec r6
+; comment
+L0: red r6
+L10: jmp L9
+prn #k
+dec r1
+mov r1, r1
+
+mov r6, r2
+jmp L1
+lea DAT, r2
+ inc r6
+dec r6
+red r4
+ inc r3
+dec r3
+bne L2
+L11: red r7
+ inc r3
+inc r3
+ dec L0
+dec L0
+ inc r0
+dec r0
+ dec r0
+dec r0
+mov r2, r2
+ inc r6
+inc r6
+mov r4, r4
+jmp L3
+jmp L9
+mov r4, r4
+mov r3, r5
+ dec r3
+dec r3
+jmp L6
+cmp r7, #k
+mov r7, r7
+ hlt
+DAT: .data 1, 2, 3, k
@@ -0,0 +1,70 @@
+.define k = 3
+.extern X1
+ inc r5
+inc r5
+L11: inc L5
+jmp L5
+L1: jmp L0
+L0: inc r2
+cmp L0, #1
+cmp r2, #1
+cmp r0, #1
+lea DAT, r2
+sub #4, r3
+red r6
+red r2
+L4: jmp L1
+not r1
+ inc r6
+L5: dec r6
+lea DAT, r2
+bne L1
+jmp L0
+L2: clr L1
+mov r3, r3
+ inc DAT[k]
+dec DAT[k]
+L8: dec DAT[2]
+mov r2, r1
+L3: mov r1, r3
+L7: bne L3
+red r5
+L9: mov r1, r1
+jmp L7
+
+mov r1 r2
+L6: red r3
+cmp DAT[1], #-2
+prn #k
+dec r4
+jmp L1
+mov r3, r3
+
+cmp r3, #-2
+cmp r3, L6
+red r7
+cmp r7, #k
+mov r6, r0
+cmp r4, r1
+mov r6, r6
+
+bne L2
+cmp r2, #1
+inc r2
+jmp L6
+mov r3, r3
+sub #4, r3
+mov r4, r6
+mov r7, r2
+jmp L2
+mov r1, r5
+L10: mov r6, r6
+cmp r2, #k
+jmp L2
+ dec L1
+dec L1
+jmp L1
+cmp DAT[2], #-2
+ hlt
+DAT: .data 1, 2, 3, k
+.entry L0
@@ -0,0 +1,80 @@
+.define k = 3
+.extern X1
+mov r3, r1
+; comment
+mov r2, r4
+ inc r5
+L8: dec r5
+red r1
+mov r5, r5
+dec L6
+ inc DAT[k]
+dec DAT[k]
+L3: red r3
+bne L9
+ dec r2
+inc r2
+prn #k
+mov r0, r0
+mov r2, r2
+jmp L8
+cmp DAT[2], #1
+cmp L5, #k
+ dec r6
+dec r6
+mov r0, r0
+red r0
+mov r7, r7
+mov r4, r4
+cmp r5, DAT[2]
+ inc DAT[k]
+inc DAT[k]
+
+cmp L4, #1
+L7: red r3
+jmp L8
+L5: jmp L3
+cmp r2, #k
+ dec r5
+dec r5
+bne L5
+cmp r2, #1
+L10: inc DAT[2]
+red r1
+
+ inc r3
+dec r3
+L9: red r6
+cmp r4, #1
+cmp r3, DAT[2]
+bne L3
+ dec r2
+inc r2
+
+prn #k
+red r1
+; comment
+cmp r6, #-2
+red r6
+jmp L2
+L2: prn r1
+mov r7, r5
+mov r2, r3
+mov r2, r2
+ dec r3
+inc r3
+prn #k
+ dec r2
+L1: inc r2
+jmp L6
+ inc r5
+dec r5
+
+ dec r0
+dec r0
+red r1
+ hlt
+L0: hlt
+L4: hlt
+L6: hlt
+DAT: .data 1, 2, 3, k
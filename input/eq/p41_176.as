@@ -0,0 +1,77 @@
+.define k = 3
+.extern X1
+L3: not r1
+jmp L9
+L9: hlt
+ dec r5
+dec r5
+red r7
+red r2
+cmp L6, #k
+lea DAT, r2
+ inc r4
+inc r4
+ dec r2
+dec r2
+mov r0, r0
+cmp r1, #-2
+dec r7
+L2: cmp r1, #-2
+ dec r4
+inc r4
+
+jmp L8
+L8: inc r2
+mov r4, r4
+mov r5, r5
+cmp L1, #k
+cmp r7, #k
+red r1
+ dec r0
+L4: inc r0
+ dec DAT[1]
+L10: dec DAT[1]
+L1: cmp r3, #1
+bne L8
+L11: jmp L2
+mov r0, r0
+sub #4, r3
+L0: dec r7
+L5: cmp r4, L0
+inc r2
+jmp L4
+red r3
+ dec r0
+L7: inc r0
+L6: jmp L8
+red r3
+jmp L2
+mov r5, r5
+red r1
+ dec r3
+dec r3
+not r1
+bne L9
+bne L7
+cmp r5, r1
+inc r0
+not r1
+jmp L4
+bne L6
+ dec r5
+inc r5
+red r0
+ inc r2
+dec r2
+; comment
+cmp r5, #k
+cmp DAT[2], #-2
+mov r7, r7
+cmp r4, L7
+mov r6, r6
+jmp L2
+inc r1
+cmp r5, #k
+ hlt
+DAT: .data 1, 2, 3, k
+.entry L2
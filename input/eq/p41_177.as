@@ -0,0 +1,72 @@
+.define k = 3
+.extern X1
+ inc L6
+dec L6
+cmp r1, r5
+red r7
+prn #k
+red r1
+cmp DAT[k], #-2
+red r5
+L6: dec r5
+L9: red r3
+jmp L3
+L3: rts
+bne L5
+red r1
+dec r5
+mov r5, r5
+mov r2, r7
+mov r4, r4
+L5: prn #k
+jmp L5
+ dec r6
+dec r6
+jmp L2
+add r1, r2
+jmp L5
+mov r6, r6
+red r3
+; comment
+L8: cmp r2, #-2
+sub #4, r3
+ dec r0
+inc r0
+jmp L1
+L1: inc r2
+jmp L6
+ dec DAT[k]
+L0: inc DAT[k]
+inc L5
+mov r1 r2
+red r5
+dec DAT[k]
+cmp L5, #-2
+sub #4, r3
+dec r2
+
+mov r3, r3
+red r4
+mov r0, r1
+mov r1 r2
+mov r7, r2
+cmp DAT, #-2
+cmp r7, #-2
+L7: red r3
+ inc NOPE
+L2: dec NOPE
+ dec r2
+dec r2
+jmp L1
+jmp L0
+L4: jmp L6
+add r1, r2
+bne L0
+red r7
+L11: mov r3, r3
+jmp L1
+red r4
+; comment
+cmp DAT[2], #1
+ hlt
+DAT: .data 1, 2, 3, k
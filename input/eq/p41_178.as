@@ -0,0 +1,71 @@
+.define k = 3
+.extern X1
+red r7
+lea DAT, r2
+dec r1
+cmp r7, r2
+mov r2, r1
+dec r6
+red r1
+L2: cmp r7, #k
+sub #4, r3
+jmp L9
+mov r2, r2
+bne L3
+dec r5
+dec L4
+cmp r6, L2
+L10: ; comment
+L1: bne L5
+; comment
+mov r2, r2
+bne L5
+L8: red r2
+L0: jmp L1
+cmp r3, #1
+jmp L3
+ inc DAT[2]
+inc DAT[2]
+L11: cmp L5, DAT[2]
+jmp L2
+L6: red r2
+inc L4
+cmp r5, #1
+ dec r4
+dec r4
+
+red r5
+cmp L7, #-2
+jmp L3
+L3: prn r1
+jmp L1
+mov r5, r5
+ inc L0
+dec L0
+dec DAT
+L4: cmp L4, #-2
+cmp r5, #k
+red r3
+ inc r7
+dec r7
+ dec r1
+L7: inc r1
+red r3
+L9: cmp r4, r2
+bne L8
+cmp r3, #-2
+cmp r1, #k
+cmp r0, #1
+cmp DAT[2], r6
+not r1
+cmp r1, r1
+red r7
+cmp r6, #-2
+cmp r6, #k
+
+L5: bne L3
+cmp r3, #k
+mov r0, r0
+ hlt
+DAT: .data 1, 2, 3, k
+.entry L0
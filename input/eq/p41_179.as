@@ -0,0 +1,78 @@
+.define k = 3
+.extern X1
+cmp DAT[1], r4
+jmp L4
+L4: rts
+jmp L2
+L2: rts
+jmp L2
+L0: not r1
+L1: jmp L9
+L9: hlt
+ inc r0
+dec r0
+L5: red r1
+jmp L1
+jmp L7
+L7: hlt
+lea DAT, r2
+L6: inc r0
+red r3
+L8: mov r4, r4
+ inc L4
+inc L4
+jmp L4
+L3: sub #4, r3
+jmp L6
+cmp L0, #1
+cmp L0, #-2
+red r5
+; comment
+cmp r4, #1
+ dec L3
+dec L3
+red r7
+red r2
+mov r3, r3
+
+clr L1
+L11: red r4
+bne L9
+L10: bne L2
+mov r1, r1
+red r6
+add r1, r2
+ dec DAT[k]
+inc DAT[k]
+mov r3, r3
+cmp DAT, #-2
+cmp DAT, #1
+bne L3
+bne L6
+; comment
+red r3
+red r6
+mov r1, r5
+bne L0
+ dec r0
+inc r0
+red r1
+jmp L4
+cmp r0, #k
+red r1
+bne L1
+ dec r0
+dec r0
+mov r1, r1
+ dec r4
+inc r4
+inc r7
+ inc DAT[k]
+dec DAT[k]
+ inc X1
+inc X1
+red r7
+
+ hlt
+DAT: .data 1, 2, 3, k
+.entry L0
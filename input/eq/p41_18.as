@@ -0,0 +1,75 @@
+.define k = 3
+.extern X1
+ dec r7
+L10: dec r7
+cmp r1, #-2
+L3: clr L1
+; comment
+not r1
+cmp r6, #k
+jmp L4
+L4: prn r1
+cmp X1, #-2
+bne L6
+ dec r3
+L11: dec r3
+
+ inc r7
+inc r7
+jmp L3
+inc X1
+ dec DAT[k]
+L1: dec DAT[k]
+bne L5
+L5: clr L1
+mov r0, r6
+L2: jmp L6
+L6: inc r2
+mov r4, r4
+jmp L7
+
+cmp r2, r4
+L0: red r2
+jmp L3
+L9: bne L3
+L8: mov r5, r5
+jmp L5
+ inc X1
+dec X1
+mov r4, r4
+L7: cmp r7, #k
+jmp L7
+bne L7
+red r2
+sub #4, r3
+jmp L7
+not r1
+ inc r3
+dec r3
+ dec r0
+inc r0
+ dec r3
+dec r3
+sub #4, r3
+mov r7, r7
+inc L5
+red r4
+jmp L3
+jmp L3
+cmp DAT[k], #1
+jmp L7
+dec r7
+mov r6, r5
+bne L8
+red r5
+bne L1
+red r2
+mov r4, r4
+mov r1, r2
+mov r5, r5
+cmp r2, #-2
+mov r5, r0
+sub #4, r3
+ hlt
+DAT: .data 1, 2, 3, k
+.entry L2
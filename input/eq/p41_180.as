@@ -0,0 +1,75 @@
+.define k = 3
+.extern X1
+L10: mov r4, r4
+cmp r1, #-2
+L2: 
+bne L1
+mov r3, r3
+L11: cmp DAT[zz], #1
+L4: cmp r6, #1
+bne L6
+ dec r6
+dec r6
+red r0
+cmp DAT[2], r1
+red r4
+ inc DAT[k]
+dec DAT[k]
+jmp L4
+mov r3, r3
+inc r6
+; comment
+L6: cmp r1, r3
+L3: mov r3, r3
+jmp L4
+jmp L5
+L5: prn r1
+red r0
+mov r1 r2
+ inc r2
+inc r2
+inc DAT
+ inc DAT[2]
+L8: inc DAT[2]
+cmp DAT[2], #1
+ inc L1
+inc L1
+cmp r5, #k
+mov r3, r7
+L7: jmp L3
+L9: cmp r7, #1
+jmp L8
+ dec L2
+dec L2
+ dec r7
+dec r7
+mov r4, r4
+ inc r5
+inc r5
+ dec L2
+dec L2
+mov r4, r4
+jmp L3
+jmp L6
+red r6
+L1: red r2
+cmp L0, #-2
+jmp L7
+L0: mov r7, r1
+bne L6
+ inc DAT[2]
+inc DAT[2]
+red r5
+jmp L8
+cmp r6, r7
+red r5
+red r3
+mov r6, r6
+lea DAT, r2
+jmp L2
+red r5
+jmp L1
+bne L4
+jmp L0
+ hlt
+DAT: .data 1, 2, 3, k
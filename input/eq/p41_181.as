@@ -0,0 +1,73 @@
+.define k = 3
+.extern X1
+mov r5, r3
+sub #4, r3
+sub #4, r3
+L0: mov r4, r4
+red r6
+red r4
+not r1
+prn #k
+
+cmp DAT[2], #-2
+red r0
+bne L1
+jmp L6
+L6: prn r1
+ dec r5
+inc r5
+L8: cmp L2, #k
+L7: mov r3, r1
+L5: mov r2, r0
+clr L1
+inc L5
+L9: bne L7
+L10: mov r7, r7
+L1: mov r5, r4
+inc L2
+ inc L2
+dec L2
+L3: mov r3, r3
+red r2
+mov r0, r5
+L4: cmp L6, DAT
+ dec r5
+inc r5
+cmp r7, #k
+jmp L7
+ dec r6
+inc r6
+mov r6, r1
+dec DAT[1]
+L11: mov r4, r4
+ dec r5
+dec r5
+mov r5, r5
+
+ inc r7
+dec r7
+jmp L8
+mov r2, r7
+cmp L1, #1
+cmp r6, DAT
+jmp L9
+L2: cmp L1, #k
+cmp r3, r0
+sub #4, r3
+bne L7
+cmp r5, #1
+red r5
+red r3
+bne L6
+inc L0
+jmp L0
+ dec L7
+dec L7
+ dec X1
+inc X1
+cmp r3, #k
+red r0
+red r3
+; comment
+ hlt
+DAT: .data 1, 2, 3, k
@@ -0,0 +1,75 @@
+.define k = 3
+.extern X1
+cmp r5, #k
+ inc r1
+L8: inc r1
+bne L2
+sub #4, r3
+jmp L0
+ inc r5
+dec r5
+red r7
+ dec r7
+L6: inc r7
+prn #k
+ inc r3
+L2: dec r3
+mov r3, r3
+L0: cmp DAT[1], #-2
+mov r5, r7
+
+jmp L9
+bne L6
+cmp DAT[2], #-2
+jmp L0
+L7: jmp L1
+L1: cmp r1, #1
+ inc DAT[k]
+inc DAT[k]
+jmp L1
+add r1, r2
+cmp r3, r2
+L10: cmp r0, #-2
+cmp r5, #-2
+red r1
+jmp L7
+cmp r3, #k
+cmp r1, #1
+red r7
+jmp L6
+jmp L1
+jmp L2
+red r0
+cmp L4, #-2
+mov r0, r0
+red r3
+mov r5, r5
+jmp L1
+cmp r7, r5
+red r6
+ dec r0
+inc r0
+ dec r7
+dec r7
+add r1, r2
+ inc DAT[1]
+L5: dec DAT[1]
+cmp L3, DAT[2]
+ inc r1
+inc r1
+ dec r2
+inc r2
+cmp r6, #k
+jmp L3
+; comment
+cmp L5, #1
+L9: mov r5, r5
+bne L7
+L3: jmp L4
+L4: red r3
+red r6
+mov r7, r7
+
+ hlt
+DAT: .data 1, 2, 3, k
+.entry L0
@@ -0,0 +1,74 @@
+.define k = 3
+.extern X1
+L11: 
+add r1, r2
+mov r0, r0
+bne L3
+red r0
+bne L9
+L6: dec DAT[1]
+inc r4
+jmp L6
+L3: bne L5
+bne L1
+clr L1
+lea DAT, r2
+jmp L0
+L0: prn r1
+jmp L6
+not r1
+bne L7
+red r5
+ inc r3
+L4: inc r3
+ dec DAT
+inc DAT
+ inc DAT[1]
+inc DAT[1]
+red r5
+jmp L1
+L1: rts
+bne L6
+L8: cmp r5, r0
+L7: cmp L1, #-2
+mov r1, r1
+bne L7
+mov r1, r3
+mov r7, r7
+mov r1, r1
+mov r1, r1
+red r6
+ dec r0
+inc r0
+jmp L8
+prn #k
+cmp r3, #k
+ dec L3
+dec L3
+L9: red r3
+jmp L9
+red r4
+L2: cmp r5, r4
+dec L2
+ inc r5
+dec r5
+L10: jmp L5
+L5: inc r6
+; comment
+mov r1 r2
+bne L5
+lea DAT, r2
+mov r3, r3
+cmp L4, DAT[2]
+inc DAT[2]
+ dec r4
+inc r4
+bne L9
+mov r1, r2
+ dec L0
+inc L0
+dec r5
+red r0
+mov r1 r2
+ hlt
+DAT: .data 1, 2, 3, k
@@ -0,0 +1,77 @@
+.define k = 3
+.extern X1
+cmp r5, r3
+mov r4, r4
+mov r5, r5
+mov r1, r1
+mov r5, r1
+jmp L5
+; comment
+jmp L8
+L8: prn r1
+cmp L3, #1
+bne L4
+red r4
+prn #k
+not r1
+ dec X1
+inc X1
+L7: cmp r0, #-2
+L0: inc L7
+cmp r2, #-2
+add r1, r2
+L5: cmp r2, #k
+inc r1
+L10: mov r4, r4
+ inc r3
+dec r3
+ inc r4
+dec r4
+ dec DAT[1]
+inc DAT[1]
+cmp r4, #-2
+jmp L1
+lea DAT, r2
+ inc L6
+dec L6
+cmp X1, #k
+ dec r2
+inc r2
+mov r0, r0
+ inc r2
+dec r2
+L3: jmp L0
+L6: mov r2, r2
+ inc r3
+dec r3
+lea DAT, r2
+red r6
+ inc r4
+dec r4
+cmp r7, #k
+mov r2, r2
+ inc r2
+L2: dec r2
+red r0
+red r0
+jmp L3
+jmp L4
+L4: inc r2
+jmp L6
+red r7
+mov r2, r2
+inc L6
+cmp r2, #-2
+jmp L4
+L9: jmp L2
+
+L11: mov r3, r1
+L1: 
+mov r2, r2
+clr L1
+mov r3, r0
+ dec L6
+inc L6
+jmp L4
+ hlt
+DAT: .data 1, 2, 3, k
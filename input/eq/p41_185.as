@@ -0,0 +1,72 @@
+.define k = 3
+.extern X1
+; comment
+L4: red r7
+ dec r3
+inc r3
+red r6
+jmp L7
+inc DAT[1]
+L0: ; comment
+ inc L2
+dec L2
+ dec r2
+dec r2
+jmp L6
+red r0
+L1: cmp r2, #1
+bne L3
+L9: jmp L2
+L2: inc r2
+mov r3, r3
+red r6
+not r1
+prn #k
+ dec r1
+dec r1
+mov r4, r4
+L7: jmp L7
+L11: mov r5, r2
+red r0
+L5: prn #k
+dec r4
+sub #4, r3
+ dec r1
+inc r1
+ inc L4
+dec L4
+jmp L5
+red r0
+bne L0
+mov r0, r1
+; comment
+
+L3: bne L7
+jmp L7
+L10: inc DAT
+L8: inc r7
+ dec r5
+inc r5
+L6: jmp L6
+lea DAT, r2
+jmp L6
+not r1
+bne L8
+red r7
+cmp L3, #1
+red r3
+jmp L7
+dec r4
+cmp r5, #-2
+inc r0
+; comment
+red r3
+jmp L4
+red r2
+inc r6
+cmp r3, #k
+sub #4, r3
+clr L1
+inc r1
+ hlt
+DAT: .data 1, 2, 3, k
@@ -0,0 +1,73 @@
+.define k = 3
+.extern X1
+ inc L7
+inc L7
+cmp r1, r0
+bne L2
+jmp L8
+cmp r1, #-2
+bne L0
+red r0
+mov r6, r6
+L6: mov r1 r2
+cmp r7, #k
+jmp L8
+L8: inc r2
+L11: cmp r6, #k
+; comment
+; comment
+; comment
+ inc r0
+L7: dec r0
+jmp L8
+L2: 
+L9: mov r2, r2
+L0: mov r6, r3
+L10: dec r7
+jmp L0
+; comment
+ inc r5
+dec r5
+mov r1 r2
+mov r6, r0
+red r1
+mov r0, r0
+L4: red r6
+L3: jmp L5
+dec NOPE
+cmp DAT, #1
+cmp r1, #k
+red r1
+ dec DAT
+L1: inc DAT
+red r2
+L5: jmp L1
+bne L2
+cmp L3, #-2
+mov r4, r4
+red r5
+dec r2
+cmp r6, #k
+ dec r3
+dec r3
+; comment
+red r3
+clr L1
+ inc r5
+dec r5
+ inc r4
+inc r4
+red r5
+cmp r5, #1
+inc r2
+jmp L1
+not r1
+red r4
+ inc r0
+dec r0
+mov r6, r6
+cmp r0, #1
+jmp L4
+; comment
+ hlt
+DAT: .data 1, 2, 3, k
@@ -0,0 +1,76 @@
+.define k = 3
+.extern X1
+inc DAT
+ inc DAT[k]
+dec DAT[k]
+dec r5
+L5: bne L8
+ inc r7
+dec r7
+red r7
+L4: inc r7
+L7: cmp L4, #1
+ inc DAT[2]
+L8: dec DAT[2]
+ inc r7
+L0: dec r7
+
+mov r4, r3
+red r0
+L1: cmp r0, r7
+L6: cmp r3, #k
+ inc L0
+L3: dec L0
+jmp L4
+ inc r2
+inc r2
+mov r7, r7
+jmp L7
+red r7
+L10: ; comment
+ dec r5
+dec r5
+jmp L7
+L11: jmp L0
+ inc r3
+dec r3
+jmp L5
+cmp L5, DAT[1]
+cmp r7, #k
+red r3
+L9: bne L9
+inc DAT[k]
+L2: cmp DAT[k], #1
+red r3
+bne L8
+ inc DAT[1]
+inc DAT[1]
+red r0
+mov r0, r1
+bne L4
+cmp DAT[k], r3
+jmp L9
+ dec r6
+inc r6
+; comment
+jmp L9
+mov r3, r3
+red r5
+cmp X1, DAT[1]
+dec r5
+ inc r3
+inc r3
+mov r5, r5
+bne L9
+cmp r7, r1
+cmp L7, #-2
+red r4
+red r3
+mov r3, r3
+cmp L7, #k
+cmp DAT[2], #1
+jmp L3
+red r4
+ hlt
+DAT: .data 1, 2, 3, k
+.entry L2
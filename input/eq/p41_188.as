@@ -0,0 +1,73 @@
+.define k = 3
+.extern X1
+
+red r3
+L4: dec r4
+L9: bne L7
+cmp DAT[1], r3
+bne L1
+L2: 
+ inc r1
+L7: dec r1
+cmp DAT[2], #-2
+red r0
+inc L6
+ dec r6
+inc r6
+jmp L1
+L1: hlt
+ inc r7
+dec r7
+
+mov r6, r5
+cmp DAT[1], #1
+cmp r1, #k
+inc r1
+mov r0, r0
+add r1, r2
+; comment
+jmp L4
+mov r2, r2
+dec r5
+bne L4
+cmp r6, #1
+L10: cmp r4, #k
+ dec r0
+inc r0
+cmp r6, #k
+cmp r6, #-2
+cmp r5, #k
+cmp r4, #k
+prn #k
+mov r4, r0
+red r2
+jmp L6
+cmp DAT[1], #k
+L8: mov r7, r3
+jmp L2
+cmp L7, #k
+L5: mov r0, r2
+mov r6, r6
+
+jmp L3
+; comment
+jmp L5
+jmp L8
+cmp DAT, #1
+L0: jmp L8
+red r2
+mov r3, r3
+red r2
+red r1
+clr L1
+mov r6, r2
+mov r3, r3
+jmp L2
+red r1
+ dec L3
+inc L3
+ hlt
+L3: hlt
+L6: hlt
+DAT: .data 1, 2, 3, k
+.entry L2
@@ -0,0 +1,73 @@
+.define k = 3
+.extern X1
+sub #4, r3
+mov r6, r0
+jmp L3
+L3: hlt
+mov r1, r1
+inc DAT[k]
+
+mov r4, r4
+L8: jmp L1
+L1: prn r1
+red r1
+red r1
+mov r1, r1
+mov r5, r5
+ dec L5
+dec L5
+jmp L5
+L5: inc r2
+
+prn #k
+mov r7, r2
+L6: inc r2
+
+cmp r6, #-2
+prn #k
+red r5
+jmp L2
+L2: inc r2
+L4: cmp L3, #1
+ inc r7
+dec r7
+mov r7, r7
+L11: cmp DAT[zz], #-2
+red r6
+L7: cmp r7, r3
+mov r6, r6
+L0: cmp L0, #1
+red r2
+bne L2
+jmp L9
+L9: hlt
+; comment
+L10: ; comment
+bne L7
+jmp L8
+; comment
+mov r4, r4
+cmp r4, X1
+mov r0, r0
+cmp r1, #1
+cmp r1, r0
+not r1
+bne L5
+mov r7, r4
+mov r1, r1
+ dec r5
+inc r5
+dec DAT
+mov r4, r4
+jmp L8
+mov r7, r7
+mov r0, r0
+
+inc r5
+red r7
+jmp L3
+mov r4, r4
+red r1
+ hlt
+DAT: .data 1, 2, 3, k
+.entry L0
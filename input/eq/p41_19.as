@@ -0,0 +1,74 @@
+.define k = 3
+.extern X1
+clr L1
+ inc r4
+L3: inc r4
+dec r1
+L10: cmp r3, r7
+mov r1, r1
+L7: not r1
+red r2
+red r3
+jmp L1
+mov r7, r7
+mov r7, r1
+; comment
+ inc L2
+inc L2
+ inc L4
+dec L4
+not r1
+ inc DAT[1]
+dec DAT[1]
+ inc r0
+L1: dec r0
+L4: cmp r7, DAT[1]
+bne L1
+red r2
+L6: jmp L4
+jmp L9
+L9: prn r1
+jmp L0
+L0: prn r1
+cmp r7, #k
+; comment
+bne L4
+bne L4
+jmp L7
+cmp r1, #k
+bne L5
+cmp r5, r1
+mov r5, r5
+ dec DAT[1]
+inc DAT[1]
+dec r2
+bne L8
+L2: jmp L0
+L8: cmp DAT[1], #-2
+jmp L7
+dec r3
+L5: cmp r3, #1
+add r1, r2
+jmp L7
+ inc r7
+inc r7
+bne L8
+not r1
+bne L3
+L11: bne L7
+not r1
+jmp L0
+red r4
+cmp L4, #1
+cmp DAT[k], #k
+cmp r4, #1
+red r7
+mov r6, r6
+red r4
+mov r0, r0
+mov r5, r5
+jmp L1
+jmp L0
+ hlt
+DAT: .data 1, 2, 3, k
+.entry L2
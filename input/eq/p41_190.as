@@ -0,0 +1,78 @@
+.define k = 3
+.extern X1
+L5: red r3
+ inc r1
+inc r1
+ dec r0
+inc r0
+ inc r1
+inc r1
+jmp L6
+L6: inc r2
+jmp L7
+lea DAT, r2
+L2: cmp r7, #-2
+jmp L4
+red r3
+red r4
+bne L2
+ inc r2
+dec r2
+jmp L5
+ dec r3
+dec r3
+ inc r7
+L3: inc r7
+ dec L0
+dec L0
+bne L1
+cmp L2, #1
+jmp L9
+L9: prn r1
+dec r4
+red r7
+
+mov r1, r1
+mov r5, r5
+L1: jmp L4
+dec r1
+jmp L4
+bne L3
+red r6
+ inc r5
+dec r5
+red r3
+red r7
+dec r4
+red r0
+cmp r6, #1
+L4: jmp L5
+ inc DAT[k]
+dec DAT[k]
+mov r2, r2
+L7: bne L3
+cmp r2, #1
+inc r4
+red r0
+L8: not r1
+red r5
+; comment
+jmp L8
+add r1, r2
+cmp r1, L6
+L11: red r4
+bne L4
+inc DAT[k]
+red r0
+jmp L9
+ inc DAT[1]
+inc DAT[1]
+ dec L1
+L10: inc L1
+mov r0, r0
+L0: red r2
+cmp r4, DAT[2]
+cmp r0, L0
+ hlt
+DAT: .data 1, 2, 3, k
+.entry L2
@@ -0,0 +1,77 @@
+.define k = 3
+.extern X1
+clr L1
+prn #k
+mov r1, r6
+inc r1
+L8: jmp L5
+dec DAT[1]
+bne L9
+jmp L5
+L5: rts
+ inc L5
+inc L5
+ inc r0
+inc r0
+bne L1
+clr L1
+L10: bne L2
+jmp L9
+ inc r1
+inc r1
+cmp r1, #k
+ dec DAT
+dec DAT
+bne L4
+prn #k
+jmp L9
+L9: hlt
+L4: red r0
+cmp DAT[k], #k
+L0: 
+ inc r1
+L2: inc r1
+jmp L3
+ inc r0
+dec r0
+clr L1
+ inc r2
+inc r2
+cmp r5, #1
+mov r0, r0
+cmp r4, r2
+L1: red r5
+cmp r6, DAT[1]
+cmp r4, #k
+dec DAT[1]
+red r7
+cmp r0, #k
+ inc r0
+L7: inc r0
+ inc r7
+inc r7
+mov r3, r3
+cmp L7, #k
+jmp L3
+L3: hlt
+red r0
+cmp r6, #-2
+L11: cmp r3, #k
+bne L9
+cmp r7, #1
+jmp L9
+L6: jmp L7
+mov r4, r5
+cmp X1, #1
+bne L8
+jmp L1
+clr L1
+cmp L0, #k
+bne L3
+prn #k
+jmp L6
+mov r7, r7
+mov r3, r3
+ hlt
+DAT: .data 1, 2, 3, k
+.entry L1
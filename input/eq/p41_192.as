@@ -0,0 +1,75 @@
+.define k = 3
+.extern X1
+cmp r6, #k
+inc DAT[zz]
+cmp L4, r4
+jmp L3
+L3: rts
+cmp L3, #1
+mov r2, r4
+jmp L0
+L0: rts
+bne L7
+ inc NOPE
+inc NOPE
+inc L4
+ inc DAT
+dec DAT
+mov r3, r3
+mov r0, r0
+bne L9
+jmp L2
+not r1
+lea DAT, r2
+bne L5
+jmp L3
+inc r7
+sub #4, r3
+jmp L5
+L5: inc r2
+mov r2, r2
+red r6
+not r1
+ dec r5
+inc r5
+; comment
+clr L1
+cmp r7, #-2
+ inc r7
+inc r7
+L4: dec L1
+cmp DAT[2], #1
+mov r3, r3
+cmp r2, #k
+L8: bne L7
+L11: 
+red r6
+mov r6, r6
+ inc r0
+dec r0
+L2: jmp L3
+mov r7, r7
+L7: red r1
+mov r6, r7
+ inc L3
+dec L3
+cmp r1, r1
+mov r1, r1
+ dec DAT[2]
+inc DAT[2]
+ inc r4
+dec r4
+L1: jmp L3
+mov r5, r5
+cmp r2, #k
+red r0
+red r6
+L6: cmp r6, r2
+mov r5, r5
+L10: mov r1 r2
+dec r3
+cmp L5, #1
+L9: ; comment
+; comment
+ hlt
+DAT: .data 1, 2, 3, k
@@ -0,0 +1,72 @@
+.define k = 3
+.extern X1
+red r2
+jmp L8
+L2: red r3
+; comment
+jmp L5
+L5: rts
+cmp DAT[k], #k
+jmp L8
+red r6
+jmp L3
+L3: hlt
+mov r5, r5
+prn #k
+
+mov r0, r1
+ inc r6
+dec r6
+jmp L0
+cmp L6, #-2
+dec r1
+red r2
+L8: jmp L8
+inc L7
+L7: mov r1, r1
+L0: dec r1
+mov r6, r6
+cmp DAT[k], r0
+ inc L1
+inc L1
+ dec L3
+dec L3
+; comment
+jmp L2
+cmp DAT[1], #1
+mov r7, r7
+jmp L9
+L9: prn r1
+jmp L9
+mov r5, r6
+red r1
+jmp L2
+mov r3, r1
+L6: red r6
+mov r3, r3
+cmp r4, #-2
+cmp r5, DAT[2]
+mov r6, r6
+; comment
+inc r1
+cmp L0, r6
+jmp L0
+cmp r6, L0
+red r6
+L11: dec DAT[k]
+red r7
+L10: bne L3
+mov r4, r4
+cmp r5, #1
+dec r7
+L4: mov r0, r0
+L1: prn #k
+ dec L3
+inc L3
+jmp L7
+jmp L6
+mov r2, r2
+cmp r5, #k
+ hlt
+DAT: .data 1, 2, 3, k
+.entry L0
@@ -0,0 +1,76 @@
+.define k = 3
+.extern X1
+mov r2, r2
+not r1
+red r6
+ dec L2
+inc L2
+jmp L2
+red r3
+prn #k
+ inc r3
+dec r3
+jmp L6
+L6: inc r2
+not r1
+bne L4
+red r6
+jmp L2
+L2: inc r2
+cmp DAT[1], #-2
+inc L1
+L8: mov r1, r1
+cmp L5, #k
+clr L1
+L7: red r3
+not r1
+mov r6, r6
+jmp L6
+ inc r3
+dec r3
+ inc r5
+inc r5
+inc L3
+; comment
+; comment
+L11: red r0
+L10: jmp L1
+L1: hlt
+bne L4
+mov r7, r2
+L9: mov r4, r7
+L3: jmp L4
+; comment
+jmp L0
+L0: inc r2
+jmp L1
+red r2
+jmp L4
+bne L4
+ dec DAT[2]
+inc DAT[2]
+L4: red r6
+cmp r0, #k
+ dec r2
+inc r2
+cmp r2, DAT[k]
+ dec L0
+inc L0
+ dec r4
+dec r4
+L5: cmp L3, #1
+red r5
+inc r1
+cmp r6, #1
+jmp L8
+mov r7, r7
+mov r6, r4
+lea DAT, r2
+jmp L4
+mov r1, r1
+mov r3, r3
+mov r5, r5
+cmp L4, #-2
+jmp L8
+ hlt
+DAT: .data 1, 2, 3, k
@@ -0,0 +1,72 @@
+.define k = 3
+.extern X1
+mov r3, r3
+jmp L9
+
+jmp L6
+L1: cmp r0, #-2
+bne L2
+L9: mov r4, r4
+mov r1 r2
+dec DAT
+red r0
+L5: bne L3
+clr L1
+mov r0, r1
+L2: jmp L5
+jmp L7
+cmp r2, #1
+red r6
+mov r1 r2
+cmp L1, #k
+cmp r3, r3
+prn #k
+sub #4, r3
+mov r0, r0
+ dec L4
+inc L4
+L7: cmp DAT[2], #k
+inc r4
+mov r0, r5
+inc r6
+jmp L4
+L4: prn r1
+cmp r5, #k
+inc r3
+jmp L5
+mov r5, r0
+cmp r3, #1
+; comment
+mov r1 r2
+mov r1 r2
+prn #k
+bne L4
+
+dec r5
+jmp L0
+L0: rts
+add r1, r2
+prn #k
+red r2
+mov r3, r3
+L10: cmp r7, #1
+L8: jmp L8
+jmp L1
+mov r1, r7
+ inc r4
+inc r4
+dec r0
+ dec r5
+inc r5
+jmp L8
+mov r1 r2
+mov r6, r6
+ dec L7
+inc L7
+L6: cmp r7, #-2
+L11: cmp L6, L2
+red r7
+ hlt
+L3: hlt
+DAT: .data 1, 2, 3, k
+.entry L2
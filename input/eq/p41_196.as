@@ -0,0 +1,77 @@
+.define k = 3
+.extern X1
+bne L0
+cmp r5, #-2
+jmp L2
+L2: prn r1
+ dec r7
+dec r7
+mov r2, r2
+jmp L8
+L8: inc r2
+mov r5, r7
+red r7
+jmp L6
+ dec r7
+inc r7
+inc DAT[1]
+cmp L6, r7
+ dec r1
+inc r1
+red r7
+bne L0
+cmp r7, #k
+L9: sub #4, r3
+mov r1, r1
+L11: bne L8
+lea DAT, r2
+jmp L6
+L6: rts
+L7: inc r2
+mov r0, r0
+add r1, r2
+cmp r1, #-2
+ inc r1
+inc r1
+
+red r7
+red r1
+bne L7
+dec DAT[k]
+red r1
+jmp L7
+bne L0
+red r5
+jmp L4
+L1: bne L9
+mov r4, r4
+L10: inc L7
+inc r5
+L4: cmp r7, #1
+mov r4, r6
+ inc r2
+inc r2
+mov r6, r3
+mov r7, r1
+ inc L2
+inc L2
+L3: dec r2
+ inc DAT
+L5: inc DAT
+inc r3
+inc DAT[1]
+mov r4, r4
+ dec r1
+inc r1
+ inc r7
+dec r7
+red r3
+jmp L1
+L0: 
+mov r5, r6
+cmp r4, #1
+
+jmp L9
+ hlt
+DAT: .data 1, 2, 3, k
+.entry L1
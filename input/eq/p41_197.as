@@ -0,0 +1,74 @@
+.define k = 3
+.extern X1
+mov r0, r0
+mov r7, r7
+red r6
+bne L2
+ dec r4
+L11: inc r4
+cmp DAT[2], #k
+not r1
+; comment
+ dec r5
+dec r5
+bne L4
+red r5
+sub #4, r3
+jmp L6
+ dec r6
+inc r6
+mov r5, r5
+bne L7
+mov r2, r3
+L8: red r5
+jmp L9
+L9: prn r1
+ inc r0
+dec r0
+cmp r5, #-2
+jmp L6
+L6: prn r1
+ inc r1
+inc r1
+L7: cmp L1, #k
+L0: red r7
+cmp L0, #-2
+mov r4, r0
+L10: red r3
+mov r5, r5
+inc r4
+L1: red r6
+; comment
+L3: jmp L5
+
+L2: red r6
+mov r4, r0
+red r6
+cmp r6, r1
+jmp L9
+inc r0
+cmp L6, #k
+mov r5, r0
+inc r5
+red r4
+L5: bne L2
+jmp L0
+ dec DAT[k]
+dec DAT[k]
+red r0
+ inc L5
+inc L5
+mov r3, r3
+bne L4
+L4: dec r3
+mov r7, r7
+cmp r5, #k
+not r1
+cmp r7, #k
+jmp L1
+cmp r5, #1
+mov r4, r4
+bne L2
+ hlt
+DAT: .data 1, 2, 3, k
+.entry L2
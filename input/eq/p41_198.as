@@ -0,0 +1,76 @@
+.define k = 3
+.extern X1
+ dec L7
+L11: dec L7
+L2: red r0
+jmp L9
+inc L1
+ dec r6
+dec r6
+inc r0
+mov r6, r6
+dec L7
+ inc r6
+inc r6
+red r6
+ inc r3
+inc r3
+L10: jmp L1
+L1: hlt
+red r4
+red r2
+ dec r0
+inc r0
+ dec r7
+dec r7
+L7: mov r3, r3
+red r4
+dec r6
+cmp r3, #k
+inc r2
+L9: cmp DAT[zz], #-2
+cmp L3, #1
+L5: red r1
+jmp L2
+inc r0
+
+L4: bne L5
+ dec r7
+L3: dec r7
+inc r1
+L8: bne L2
+L6: inc r1
+mov r7, r7
+mov r3, r3
+
+bne L4
+mov r3, r3
+add r1, r2
+ inc r6
+inc r6
+L0: inc r5
+
+cmp r4, L7
+mov r2, r2
+mov r1, r5
+cmp r7, #k
+cmp r3, r0
+dec r5
+cmp r3, #-2
+mov r5, r5
+bne L4
+cmp r0, #-2
+ dec r6
+inc r6
+ inc r2
+dec r2
+red r1
+cmp DAT[k], #-2
+mov r7, r7
+red r2
+inc DAT[zz]
+bne L4
+red r4
+ hlt
+DAT: .data 1, 2, 3, k
+.entry L1
@@ -0,0 +1,77 @@
+.define k = 3
+.extern X1
+ inc r4
+dec r4
+lea DAT, r2
+ dec L6
+dec L6
+L11: 
+dec DAT[k]
+cmp DAT[k], #1
+jmp L9
+L9: rts
+ inc L1
+inc L1
+mov r5, r5
+red r1
+ dec r6
+dec r6
+dec r0
+cmp r5, #k
+ inc r6
+dec r6
+L2: red r4
+cmp r7, r0
+L6: mov r2, r2
+; comment
+L0: red r5
+jmp L2
+L8: jmp L8
+mov r6, r4
+L3: mov r3, r6
+ dec DAT[1]
+inc DAT[1]
+L1: mov r2, r2
+cmp r5, #k
+ dec r0
+L4: dec r0
+jmp L3
+red r4
+cmp r2, #k
+jmp L5
+L5: rts
+mov r6, r3
+ inc r0
+inc r0
+red r3
+clr L1
+red r3
+dec L5
+mov r1, r1
+red r4
+add r1, r2
+jmp L4
+ inc r4
+L10: dec r4
+L7: mov r3, r3
+dec r5
+cmp r4, #1
+inc r3
+red r1
+mov r3, r3
+red r2
+ inc X1
+inc X1
+; comment
+red r4
+red r0
+cmp r6, #k
+mov r7, r1
+red r3
+red r0
+dec DAT[2]
+cmp L7, X1
+cmp L5, #-2
+ hlt
+DAT: .data 1, 2, 3, k
+.entry L0
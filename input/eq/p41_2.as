@@ -0,0 +1,77 @@
+.define k = 3
+.extern X1
+red r0
+L5: 
+bne L4
+cmp r2, #k
+ inc r0
+dec r0
+ inc r2
+inc r2
+L2: mov r5, r2
+ dec r5
+dec r5
+L8: bne L7
+cmp r7, L5
+ dec X1
+inc X1
+; comment
+red r4
+dec r6
+dec L1
+cmp DAT[1], #k
+bne L1
+mov r4, r4
+red r6
+add r1, r2
+cmp L1, #1
+ inc r2
+L0: inc r2
+mov r3, r3
+L9: red r1
+dec r0
+bne L7
+mov r5, r0
+red r2
+not r1
+mov r5, r5
+ inc r2
+inc r2
+ inc r0
+L1: dec r0
+L3: jmp L9
+ inc L4
+dec L4
+mov r1, r1
+L6: add r1, r2
+jmp L7
+L7: inc r2
+red r3
+inc DAT
+jmp L1
+mov r1, r1
+red r5
+red r6
+L10: cmp DAT[1], DAT[1]
+ inc r1
+dec r1
+sub #4, r3
+cmp L6, #k
+mov r1, r1
+ inc r3
+dec r3
+not r1
+red r2
+cmp L7, DAT[2]
+
+cmp r4, #1
+L4: red r2
+red r1
+bne L0
+ dec DAT[2]
+L11: dec DAT[2]
+jmp L6
+bne L4
+ hlt
+DAT: .data 1, 2, 3, k
+.entry L0
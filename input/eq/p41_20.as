@@ -0,0 +1,74 @@
+.define k = 3
+.extern X1
+bne L2
+jmp L1
+cmp r1, r5
+ dec r5
+inc r5
+; comment
+mov r3, r3
+L3: cmp DAT[k], #1
+cmp r3, #1
+jmp L4
+L4: prn r1
+ dec r4
+dec r4
+red r2
+jmp L5
+L5: hlt
+inc r1
+; comment
+bne L6
+jmp L0
+L10: jmp L0
+L0: hlt
+L6: jmp L4
+cmp L0, #k
+ inc r1
+inc r1
+L2: jmp L2
+mov r3, r4
+
+cmp r4, #1
+red r5
+cmp r7, DAT[1]
+red r1
+jmp L5
+L8: jmp L1
+L1: hlt
+cmp r1, #k
+; comment
+ dec r6
+L11: dec r6
+L9: dec DAT[k]
+cmp r2, #1
+ inc L4
+dec L4
+mov r3, r3
+red r6
+
+jmp L4
+bne L4
+mov r3, r3
+red r2
+bne L8
+mov r4, r4
+dec r4
+mov r4, r1
+cmp r5, #k
+L7: red r7
+mov r7, r7
+add r1, r2
+mov r4, r4
+red r7
+red r7
+cmp r1, r6
+lea DAT, r2
+mov r3, r3
+red r3
+red r7
+jmp L2
+cmp r6, #1
+ hlt
+DAT: .data 1, 2, 3, k
+.entry L2
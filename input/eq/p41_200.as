@@ -0,0 +1,71 @@
+.define k = 3
+.extern X1
+L3: add r1, r2
+L5: red r7
+bne L7
+dec r1
+jmp L7
+L7: inc r2
+bne L2
+ dec r3
+inc r3
+jmp L5
+L11: bne L0
+bne L2
+dec r4
+L8: red r5
+L10: cmp X1, #-2
+bne L0
+dec r0
+mov r0, r0
+bne L6
+red r3
+cmp r1, #k
+red r0
+L2: jmp L0
+L0: rts
+red r7
+L9: cmp r3, #1
+mov r1, r1
+L6: bne L6
+mov r1, r1
+jmp L3
+ dec L3
+L1: dec L3
+jmp L0
+jmp L0
+mov r0, r0
+L4: ; comment
+red r2
+ inc r7
+inc r7
+mov r6, r6
+jmp L6
+inc r7
+ dec L2
+inc L2
+prn #k
+cmp DAT, #1
+red r4
+red r1
+mov r4, r4
+jmp L4
+; comment
+red r7
+mov r5, r5
+cmp L5, #k
+ inc r5
+inc r5
+red r4
+mov r3, r3
+red r7
+inc r0
+lea DAT, r2
+mov r0, r5
+sub #4, r3
+jmp L1
+red r2
+red r5
+cmp r2, #-2
+ hlt
+DAT: .data 1, 2, 3, k
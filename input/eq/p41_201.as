@@ -0,0 +1,69 @@
+.define k = 3
+.extern X1
+L5: dec DAT[2]
+inc L7
+mov r3, r3
+cmp r3, L2
+mov r1, r6
+
+jmp L4
+L4: prn r1
+red r6
+ inc r4
+L8: inc r4
+red r0
+jmp L5
+red r4
+not r1
+cmp DAT[1], #1
+mov r5, r5
+L3: not r1
+jmp L5
+red r0
+L0: mov r5, r5
+bne L0
+jmp L5
+red r6
+cmp r7, #-2
+red r0
+add r1, r2
+jmp L6
+clr L1
+prn #k
+jmp L3
+mov r5, r5
+mov r0, r6
+bne L2
+mov r1, r1
+cmp r7, #k
+jmp L6
+L6: rts
+jmp L4
+L11: dec DAT
+jmp L9
+mov r5, r5
+L10: jmp L0
+sub #4, r3
+L7: mov r7, r7
+cmp r7, #-2
+red r7
+dec r4
+bne L6
+mov r7, r3
+jmp L6
+L2: red r0
+inc r5
+red r2
+
+jmp L2
+ inc DAT[k]
+L1: inc DAT[k]
+sub #4, r3
+jmp L3
+red r7
+bne L2
+jmp L8
+
+ hlt
+DAT: .data 1, 2, 3, k
+.entry L1
@@ -0,0 +1,76 @@
+.define k = 3
+.extern X1
+jmp L6
+L6: red r6
+ inc r5
+inc r5
+ inc r7
+dec r7
+red r7
+mov r2, r1
+L4: mov r3, r1
+red r3
+cmp r5, #k
+red r3
+clr L1
+ dec DAT[k]
+L8: inc DAT[k]
+ dec r3
+dec r3
+dec r2
+red r4
+bne L2
+bne L7
+L0: red r2
+jmp L7
+L11: mov r2, r2
+; comment
+mov r6, r6
+L9: bne L1
+ dec r4
+inc r4
+red r2
+ inc DAT[1]
+L5: dec DAT[1]
+mov r5, r5
+bne L8
+red r6
+ inc r2
+dec r2
+jmp L1
+L1: rts
+dec r1
+inc r0
+red r3
+red r4
+cmp r3, #1
+bne L4
+mov r2, r6
+ dec DAT[k]
+L2: inc DAT[k]
+bne L7
+bne L2
+cmp r2, #-2
+bne L5
+jmp L3
+L3: hlt
+red r3
+jmp L5
+mov r3, r3
+jmp L2
+lea DAT, r2
+red r4
+cmp DAT[k], #-2
+not r1
+ inc r1
+inc r1
+bne L6
+cmp r0, #-2
+L10: jmp L8
+cmp r7, #1
+L7: red r7
+jmp L5
+mov r5, r3
+ hlt
+DAT: .data 1, 2, 3, k
+.entry L0
@@ -0,0 +1,72 @@
+.define k = 3
+.extern X1
+L7: jmp L3
+L3: prn r1
+sub #4, r3
+mov r2, r2
+red r5
+jmp L7
+cmp r7, #1
+L8: ; comment
+L11: red r1
+red r7
+inc r5
+add r1, r2
+mov r1, r1
+cmp r1, r2
+add r1, r2
+; comment
+red r2
+red r0
+jmp L6
+cmp r4, #1
+; comment
+; comment
+L1: cmp L0, #1
+L0: red r4
+mov r3, r3
+L10: dec r4
+L9: add r1, r2
+lea DAT, r2
+red r1
+cmp DAT[1], #1
+bne L8
+jmp L3
+prn #k
+jmp L4
+L4: inc r2
+ dec r0
+L2: dec r0
+bne L6
+jmp L4
+mov r0, r4
+L6: jmp L4
+red r3
+cmp r0, #k
+ dec r0
+inc r0
+red r4
+jmp L2
+ inc r7
+inc r7
+ inc r4
+inc r4
+ dec r3
+L5: inc r3
+mov r7, r7
+mov r2, r2
+jmp L1
+red r1
+red r4
+jmp L7
+jmp L3
+dec r1
+
+mov r7, r4
+ inc r6
+dec r6
+red r1
+red r1
+cmp DAT[k], #k
+ hlt
+DAT: .data 1, 2, 3, k
@@ -0,0 +1,75 @@
+.define k = 3
+.extern X1
+mov r3, r3
+dec L2
+L1: inc r5
+
+red r7
+ inc DAT[2]
+inc DAT[2]
+mov r7, r7
+red r1
+red r2
+cmp r7, DAT[k]
+red r6
+; comment
+inc DAT[2]
+mov r7, r0
+bne L9
+ inc r6
+dec r6
+; comment
+cmp r2, #-2
+mov r3, r3
+red r4
+L11: dec r3
+; comment
+jmp L6
+L6: inc r2
+cmp r7, #1
+L5: mov r4, r4
+dec DAT[2]
+bne L8
+L8: cmp r5, #k
+cmp DAT[k], #1
+cmp r5, #1
+red r5
+cmp DAT[1], #-2
+mov r1 r2
+L3: cmp r4, #-2
+red r5
+red r0
+jmp L3
+jmp L6
+jmp L4
+L4: inc r2
+bne L7
+ inc r0
+inc r0
+clr L1
+jmp L6
+jmp L3
+mov r0, r0
+mov r1, r1
+bne L1
+dec L1
+jmp L9
+L9: rts
+jmp L6
+red r3
+lea DAT, r2
+cmp r6, #k
+red r6
+L10: inc X1
+bne L3
+ dec r7
+dec r7
+
+cmp r0, #-2
+ dec DAT[1]
+inc DAT[1]
+ hlt
+L2: hlt
+L7: hlt
+DAT: .data 1, 2, 3, k
+.entry L1
@@ -0,0 +1,75 @@
+.define k = 3
+.extern X1
+clr L1
+ inc DAT[2]
+inc DAT[2]
+L10: bne L3
+prn #k
+mov r4, r4
+
+L1: jmp L3
+L3: rts
+jmp L5
+L5: prn r1
+red r4
+red r1
+bne L2
+bne L5
+dec r1
+lea DAT, r2
+L11: jmp L5
+jmp L7
+L7: hlt
+cmp r5, #k
+red r2
+ inc r1
+dec r1
+cmp r5, r6
+sub #4, r3
+L8: dec L5
+ dec r6
+inc r6
+L0: jmp L3
+mov r3, r3
+jmp L4
+L4: rts
+sub #4, r3
+L2: mov r5, r5
+ inc r3
+inc r3
+L9: clr L1
+dec r7
+L6: red r0
+; comment
+jmp L6
+jmp L5
+red r4
+cmp L7, #1
+mov r7, r7
+mov r1, r1
+red r4
+bne L0
+add r1, r2
+bne L4
+bne L1
+; comment
+cmp r2, #1
+inc r4
+not r1
+inc L3
+ dec r1
+dec r1
+ dec r7
+dec r7
+cmp r5, r4
+red r4
+cmp DAT[k], #-2
+mov r4, r4
+red r5
+mov r0, r0
+cmp DAT, #k
+mov r1, r1
+mov r1, r1
+ hlt
+DAT: .data 1, 2, 3, k
+.entry L1
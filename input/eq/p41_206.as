@@ -0,0 +1,72 @@
+.define k = 3
+.extern X1
+L4: red r3
+red r3
+L5: red r2
+cmp DAT[k], #k
+mov r4, r4
+ dec L3
+inc L3
+jmp L1
+L1: hlt
+L8: prn #k
+sub #4, r3
+cmp DAT[1], #k
+jmp L6
+L6: rts
+jmp L5
+L0: jmp L0
+lea DAT, r2
+bne L8
+red r2
+L3: bne L9
+prn #k
+mov r6, r6
+mov r0, r0
+jmp L3
+sub #4, r3
+cmp r5, #-2
+bne L3
+mov r5, r3
+L11: cmp r0, #1
+ dec r0
+inc r0
+prn #k
+red r5
+jmp L0
+red r7
+mov r2, r3
+bne L1
+cmp DAT[2], #k
+lea DAT, r2
+mov r0, r3
+L2: jmp L4
+ inc r7
+L7: inc r7
+mov r2, r2
+ inc r7
+dec r7
+bne L0
+bne L2
+prn #k
+mov r5, r6
+ dec DAT[k]
+inc DAT[k]
+L10: ; comment
+L9: jmp L8
+mov r4, r6
+red r0
+
+bne L6
+bne L2
+jmp L8
+prn #k
+cmp L0, #1
+bne L3
+inc r6
+mov r7, r7
+cmp r5, #-2
+jmp L5
+ hlt
+DAT: .data 1, 2, 3, k
+.entry L0
@@ -0,0 +1,76 @@
+.define k = 3
+.extern X1
+bne L3
+mov r5, r5
+mov r5, r5
+L5: jmp L7
+L7: inc r2
+jmp L1
+L1: rts
+dec DAT[2]
+L6: mov r7, r7
+bne L6
+inc L3
+jmp L8
+L8: prn r1
+jmp L3
+L3: rts
+L4: bne L9
+; comment
+jmp L7
+red r7
+mov r1 r2
+ dec r4
+L2: dec r4
+L9: bne L1
+mov r4, r4
+jmp L4
+ inc r1
+dec r1
+cmp r1, #k
+red r3
+cmp DAT[2], #1
+jmp L4
+
+prn #k
+ dec NOPE
+dec NOPE
+; comment
+inc r7
+mov r4, r6
+mov r5, r5
+L0: mov r4, r4
+clr L1
+L10: 
+red r4
+jmp L1
+ inc r4
+dec r4
+L11: ; comment
+lea DAT, r2
+ dec DAT[1]
+dec DAT[1]
+cmp r4, #1
+ dec r7
+dec r7
+clr L1
+cmp DAT[2], #1
+clr L1
+jmp L0
+inc L5
+red r0
+mov r4, r1
+red r7
+mov r6, r0
+clr L1
+ dec r4
+dec r4
+red r7
+dec r2
+dec r4
+jmp L6
+red r4
+mov r6, r5
+ hlt
+DAT: .data 1, 2, 3, k
+.entry L2
@@ -0,0 +1,75 @@
+.define k = 3
+.extern X1
+add r1, r2
+jmp L9
+; comment
+red r7
+cmp r4, #-2
+inc r3
+L6: cmp DAT[k], #-2
+cmp r0, #1
+cmp r5, r3
+ inc r0
+inc r0
+red r7
+ inc r7
+inc r7
+L0: inc r1
+ dec DAT[1]
+dec DAT[1]
+bne L1
+mov r3, r3
+dec r3
+L8: cmp r3, #-2
+mov r4, r2
+mov r2, r2
+ dec r5
+inc r5
+not r1
+red r7
+dec DAT[2]
+bne L5
+mov r0, r0
+ dec r3
+L5: dec r3
+jmp L7
+L2: red r3
+dec DAT[k]
+dec r1
+
+mov r4, r4
+L10: jmp L2
+ inc r0
+dec r0
+jmp L5
+cmp r5, #1
+ dec r3
+L7: inc r3
+; comment
+bne L3
+cmp L2, #k
+red r6
+dec r2
+jmp L3
+L9: 
+ inc r1
+dec r1
+red r5
+L4: inc r7
+ dec r6
+L11: inc r6
+L3: cmp r1, #1
+mov r5, r2
+mov r2, r2
+ dec r7
+L1: dec r7
+ inc r4
+dec r4
+jmp L0
+bne L8
+cmp r7, #k
+red r4
+red r7
+mov r4, r5
+ hlt
+DAT: .data 1, 2, 3, k
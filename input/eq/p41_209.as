@@ -0,0 +1,72 @@
+.define k = 3
+.extern X1
+mov r4, r4
+mov r2, r6
+cmp r7, #1
+cmp r5, #-2
+bne L8
+mov r1, r2
+cmp r2, DAT[1]
+cmp L4, #k
+jmp L2
+L2: hlt
+dec r6
+mov r6, r1
+; comment
+sub #4, r3
+cmp L2, #k
+mov r3, r3
+red r3
+red r7
+cmp r3, #k
+add r1, r2
+red r1
+red r4
+mov r1, r1
+ inc r1
+inc r1
+add r1, r2
+L1: cmp L7, #1
+L4: jmp L2
+mov r1, r1
+jmp L0
+L0: hlt
+L5: bne L6
+jmp L4
+jmp L3
+L3: rts
+sub #4, r3
+red r2
+cmp r3, #-2
+mov r6, r4
+mov r2, r2
+mov r4, r4
+jmp L1
+L9: cmp r1, #-2
+dec r0
+red r5
+mov r4, r4
+bne L0
+jmp L9
+mov r4, r4
+L7: cmp r1, #-2
+cmp r4, #1
+
+clr L1
+red r2
+red r0
+not r1
+cmp r4, #k
+inc L6
+mov r3, r4
+red r6
+red r0
+dec r2
+ inc r5
+dec r5
+L11: cmp r0, #k
+ hlt
+L6: hlt
+L8: hlt
+DAT: .data 1, 2, 3, k
+.entry L0
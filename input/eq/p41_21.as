@@ -0,0 +1,83 @@
+.define k = 3
+.extern X1
+L11: dec r3
+jmp L3
+L9: inc r3
+red r6
+mov r5, r5
+jmp L5
+L5: hlt
+ dec L5
+L0: inc L5
+ inc DAT[1]
+inc DAT[1]
+L10: jmp L6
+L6: rts
+ dec r7
+dec r7
+mov r1, r1
+red r0
+jmp L8
+L8: prn r1
+jmp L2
+
+lea DAT, r2
+cmp r2, #-2
+bne L3
+red r0
+ inc r3
+inc r3
+ dec DAT[1]
+dec DAT[1]
+mov r3, r3
+L3: jmp L2
+inc r7
+ dec r5
+dec r5
+jmp L4
+L4: hlt
+mov r0, r0
+cmp r6, #-2
+ inc r7
+L1: inc r7
+mov r5, r5
+jmp L2
+L2: inc r2
+add r1, r2
+jmp L0
+L7: mov r1 r2
+jmp L3
+ inc r6
+dec r6
+; comment
+jmp L8
+clr L1
+bne L8
+cmp L5, #1
+red r1
+bne L7
+red r7
+jmp L6
+bne L0
+bne L6
+ dec r6
+inc r6
+cmp r3, #-2
+ inc r6
+inc r6
+ inc r2
+dec r2
+ dec r2
+dec r2
+jmp L3
+ inc r2
+dec r2
+cmp r6, #-2
+jmp L1
+mov r5, r5
+mov r7, r3
+red r2
+ dec r0
+dec r0
+ hlt
+DAT: .data 1, 2, 3, k
@@ -0,0 +1,74 @@
+.define k = 3
+.extern X1
+bne L6
+bne L4
+jmp L1
+L1: inc r2
+
+dec L2
+red r4
+cmp r1, #1
+red r4
+mov r0, r0
+inc L6
+jmp L3
+bne L8
+L7: jmp L6
+L6: rts
+mov r3, r3
+L8: cmp r6, r6
+; comment
+clr L1
+mov r1 r2
+cmp DAT[k], #-2
+ dec DAT[1]
+inc DAT[1]
+jmp L0
+L0: prn r1
+ inc L6
+inc L6
+bne L7
+mov r3, r3
+; comment
+ inc r5
+L4: dec r5
+cmp r0, r3
+prn #k
+jmp L0
+cmp NOPE, r0
+jmp L5
+L5: hlt
+mov r2, r2
+bne L4
+L10: cmp r7, #k
+L3: bne L4
+L9: cmp DAT[k], #k
+bne L2
+L2: inc r4
+cmp r1, #1
+mov r5, r4
+mov r6, r6
+jmp L5
+mov r1 r2
+mov r6, r5
+not r1
+ inc DAT[2]
+L11: inc DAT[2]
+bne L2
+cmp DAT[zz], r0
+jmp L1
+ inc DAT
+inc DAT
+cmp L3, L6
+bne L0
+mov r2, r2
+inc r0
+
+jmp L1
+
+jmp L6
+cmp DAT[k], L7
+cmp DAT[2], r3
+ hlt
+DAT: .data 1, 2, 3, k
+.entry L1
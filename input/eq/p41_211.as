@@ -0,0 +1,74 @@
+.define k = 3
+.extern X1
+add r1, r2
+red r5
+jmp L2
+L2: inc r2
+; comment
+bne L9
+; comment
+bne L8
+red r5
+red r2
+red r2
+jmp L8
+L8: inc r2
+mov r6, r6
+L5: mov r0, r0
+L4: jmp L6
+red r4
+ dec r4
+dec r4
+jmp L9
+L9: rts
+jmp L8
+ dec r5
+dec r5
+cmp DAT, #1
+; comment
+bne L8
+not r1
+cmp r4, #-2
+jmp L7
+dec r6
+; comment
+mov r1, r1
+lea DAT, r2
+red r1
+jmp L7
+ inc r5
+L7: dec r5
+
+L1: mov r4, r1
+mov r2, r2
+
+jmp L7
+cmp r3, #1
+mov r6, r6
+mov r3, r3
+L0: bne L3
+L3: mov r6, r6
+cmp DAT[k], #k
+mov r4, r3
+ dec r0
+dec r0
+prn #k
+cmp r2, #k
+mov r1, r1
+L11: mov r3, r3
+mov r5, r5
+jmp L1
+ dec r2
+inc r2
+red r0
+jmp L0
+mov r2, r2
+bne L8
+ inc L5
+L10: dec L5
+L6: bne L1
+ dec r0
+dec r0
+inc L3
+ hlt
+DAT: .data 1, 2, 3, k
@@ -0,0 +1,73 @@
+.define k = 3
+.extern X1
+red r0
+mov r0, r0
+ dec r1
+L8: inc r1
+mov r0, r0
+ dec L7
+L3: inc L7
+mov r3, r0
+mov r3, r7
+jmp L3
+red r1
+cmp r3, #-2
+bne L4
+mov r2, r2
+jmp L6
+L6: inc r2
+mov r2, r2
+red r1
+red r4
+ dec r1
+inc r1
+L0: mov r5, r1
+cmp r3, #-2
+sub #4, r3
+L5: mov r3, r7
+jmp L3
+jmp L8
+not r1
+red r7
+mov r6, r6
+cmp r0, L1
+jmp L9
+L9: hlt
+L11: red r1
+dec r2
+not r1
+dec L4
+cmp r7, #-2
+cmp DAT[1], L1
+cmp L1, #k
+inc r0
+ inc r2
+inc r2
+red r2
+sub #4, r3
+ inc r0
+dec r0
+mov r4, r2
+mov r2, r6
+L1: jmp L7
+L7: prn r1
+jmp L5
+mov r4, r4
+mov r7, r7
+not r1
+L2: mov r7, r7
+L4: mov r4, r1
+L10: dec r3
+mov r4, r5
+cmp r3, #k
+dec r2
+jmp L3
+red r1
+cmp r3, #-2
+inc r4
+red r6
+jmp L9
+mov r6, r6
+ hlt
+DAT: .data 1, 2, 3, k
+.entry L1
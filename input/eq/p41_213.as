@@ -0,0 +1,73 @@
+.define k = 3
+.extern X1
+L3: cmp r4, #-2
+red r7
+clr L1
+jmp L4
+ dec r7
+L5: dec r7
+ dec r6
+inc r6
+red r4
+red r2
+ inc r0
+L2: inc r0
+red r0
+inc r7
+cmp r7, r4
+mov r2, r2
+jmp L0
+jmp L4
+L4: hlt
+ dec r0
+dec r0
+clr L1
+mov r5, r5
+jmp L5
+jmp L2
+cmp r4, #k
+jmp L1
+L7: cmp r3, r0
+mov r5, r5
+jmp L2
+L6: cmp r2, #-2
+mov r7, r7
+mov r0, r0
+; comment
+ inc r3
+dec r3
+red r5
+cmp r5, #k
+cmp r5, r0
+L11: jmp L9
+jmp L9
+L9: rts
+cmp r7, #k
+not r1
+mov r2, r2
+mov r1, r0
+cmp r0, #-2
+mov r1, r1
+cmp r0, r4
+cmp r4, #1
+red r3
+red r2
+add r1, r2
+jmp L1
+jmp L1
+L1: rts
+cmp r1, #-2
+jmp L5
+inc r7
+mov r0, r0
+bne L2
+jmp L1
+mov r2, r2
+jmp L0
+L0: cmp r3, #1
+L10: cmp r1, #k
+mov r1, r1
+add r1, r2
+ hlt
+DAT: .data 1, 2, 3, k
+.entry L1
@@ -0,0 +1,74 @@
+.define k = 3
+.extern X1
+ inc r7
+dec r7
+red r1
+cmp L0, #1
+red r5
+bne L5
+L6: red r7
+mov r1, r3
+jmp L0
+L0: hlt
+red r6
+cmp L4, r6
+mov r3, r3
+jmp L8
+L8: prn r1
+L4: mov r7, r7
+red r5
+cmp r0, DAT[1]
+inc r5
+sub #4, r3
+sub #4, r3
+red r1
+L10: jmp L8
+L5: inc r7
+L3: red r0
+bne L7
+L2: jmp L5
+ dec r7
+inc r7
+ inc r5
+dec r5
+jmp L8
+add r1, r2
+jmp L2
+ inc DAT[2]
+dec DAT[2]
+L1: jmp L5
+red r2
+cmp DAT, #k
+L11: not r1
+L7: red r6
+jmp L4
+red r1
+not r1
+cmp DAT[1], #-2
+ dec r6
+dec r6
+red r0
+cmp r4, #1
+jmp L3
+jmp L0
+jmp L9
+L9: rts
+jmp L0
+red r1
+jmp L8
+red r0
+ dec r6
+inc r6
+cmp r2, #1
+jmp L6
+lea DAT, r2
+mov r0, r1
+jmp L9
+mov r2, r4
+bne L7
+jmp L0
+mov r0, r0
+cmp DAT[k], #1
+ hlt
+DAT: .data 1, 2, 3, k
+.entry L2
@@ -0,0 +1,75 @@
+.define k = 3
+.extern X1
+L5: mov r4, r4
+jmp L4
+jmp L2
+L2: hlt
+inc DAT[2]
+jmp L3
+L3: prn r1
+ inc r0
+dec r0
+ dec r0
+L6: dec r0
+L9: jmp L9
+inc r0
+red r5
+L1: cmp r5, #k
+L10: mov r1, r1
+mov r2, r2
+jmp L5
+cmp r2, DAT[k]
+cmp L7, #k
+L7: bne L6
+red r0
+prn #k
+ inc r4
+L8: inc r4
+mov r6, r6
+jmp L4
+L4: rts
+jmp L2
+not r1
+L11: bne L2
+cmp r6, #1
+red r6
+jmp L3
+L0: jmp L7
+ dec DAT[2]
+inc DAT[2]
+bne L9
+; comment
+cmp DAT[2], #k
+mov r2, r2
+bne L9
+cmp r7, #1
+
+mov r4, r4
+red r5
+; comment
+inc r2
+red r5
+dec L3
+bne L3
+add r1, r2
+
+ inc r6
+inc r6
+dec r0
+add r1, r2
+not r1
+jmp L8
+red r7
+mov r5, r5
+inc r4
+cmp DAT, #-2
+ inc r7
+dec r7
+mov r6, r6
+ inc DAT[2]
+dec DAT[2]
+red r5
+red r1
+ hlt
+DAT: .data 1, 2, 3, k
+.entry L0
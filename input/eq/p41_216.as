@@ -0,0 +1,74 @@
+.define k = 3
+.extern X1
+jmp L7
+L7: inc r2
+L0: cmp r7, DAT[zz]
+inc r7
+dec r4
+L6: cmp r4, #k
+red r3
+ dec r6
+dec r6
+mov r3, r3
+; comment
+ inc r3
+L3: inc r3
+cmp L7, L4
+dec L6
+red r7
+L10: mov r7, r7
+red r4
+jmp L0
+bne L3
+inc DAT[zz]
+red r3
+cmp DAT[2], #1
+L2: mov r1, r1
+red r3
+ inc L7
+dec L7
+mov r2, r2
+jmp L4
+cmp L2, #1
+L9: mov r7, r7
+jmp L8
+L8: hlt
+L1: sub #4, r3
+cmp DAT[1], #-2
+ inc L3
+inc L3
+dec r0
+ inc r0
+L11: inc r0
+cmp r6, r6
+jmp L9
+mov r1, r1
+jmp L1
+cmp DAT[2], #1
+mov r4, r4
+jmp L5
+L5: inc r2
+
+L4: cmp r0, r6
+
+red r6
+mov r6, r6
+jmp L1
+ dec r0
+dec r0
+; comment
+bne L9
+red r3
+bne L2
+; comment
+bne L7
+mov r0, r0
+prn #k
+jmp L3
+; comment
+dec r1
+jmp L5
+jmp L2
+ hlt
+DAT: .data 1, 2, 3, k
+.entry L1
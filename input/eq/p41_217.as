@@ -0,0 +1,75 @@
+.define k = 3
+.extern X1
+cmp r3, #k
+bne L6
+red r3
+L4: red r0
+
+mov r4, r4
+red r5
+jmp L2
+L2: prn r1
+jmp L6
+lea DAT, r2
+mov r0, r0
+ dec DAT[2]
+dec DAT[2]
+ dec r4
+inc r4
+cmp DAT[1], #1
+red r2
+jmp L8
+L8: rts
+red r7
+cmp DAT, #k
+lea DAT, r2
+dec r6
+jmp L0
+L0: inc r2
+cmp DAT[k], #-2
+cmp r7, #k
+jmp L4
+red r2
+L3: jmp L7
+L7: inc r2
+L1: jmp L5
+L5: inc r2
+jmp L4
+red r5
+mov r4, r4
+ dec r5
+dec r5
+L9: bne L7
+mov r2, r2
+cmp r7, #-2
+red r4
+ inc r7
+inc r7
+cmp L3, #1
+jmp L1
+cmp r6, #1
+cmp r1, #-2
+bne L2
+cmp r4, #-2
+jmp L4
+L11: cmp r3, r5
+L6: red r2
+L10: prn #k
+red r0
+cmp DAT[1], #1
+ dec r5
+dec r5
+; comment
+prn #k
+mov r6, r6
+clr L1
+jmp L9
+jmp L9
+red r0
+dec r7
+jmp L0
+ inc r1
+inc r1
+not r1
+ hlt
+DAT: .data 1, 2, 3, k
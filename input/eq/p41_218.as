@@ -0,0 +1,75 @@
+.define k = 3
+.extern X1
+mov r5, r5
+red r5
+ dec L3
+inc L3
+inc r2
+L7: bne L4
+jmp L7
+red r4
+L2: ; comment
+jmp L8
+ inc r0
+inc r0
+ inc r2
+dec r2
+L6: cmp r4, #1
+cmp r7, #k
+L11: mov r6, r6
+L4: red r5
+cmp DAT[1], L0
+L0: not r1
+red r2
+mov r7, r7
+bne L8
+ inc r4
+inc r4
+jmp L3
+L3: hlt
+clr L1
+jmp L3
+inc r6
+jmp L4
+cmp r6, #1
+cmp r7, #-2
+inc r2
+mov r6, r2
+L5: mov r6, r6
+L9: inc r2
+ dec L6
+inc L6
+L8: mov r4, r4
+cmp r6, r3
+ inc DAT[k]
+dec DAT[k]
+jmp L2
+mov r2, r2
+cmp r5, #1
+bne L0
+ inc r2
+inc r2
+prn #k
+bne L9
+L1: prn #k
+cmp r0, #1
+jmp L7
+mov r0, r7
+L10: not r1
+jmp L7
+dec r2
+inc r7
+ inc r2
+inc r2
+cmp DAT[2], r7
+add r1, r2
+red r7
+ dec r5
+inc r5
+
+ inc DAT[1]
+inc DAT[1]
+mov r4, r4
+red r7
+ hlt
+DAT: .data 1, 2, 3, k
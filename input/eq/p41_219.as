@@ -0,0 +1,72 @@
+.define k = 3
+.extern X1
+ dec r1
+dec r1
+mov r0, r0
+jmp L2
+L2: prn r1
+red r1
+not r1
+bne L5
+mov r0, r0
+jmp L0
+L6: red r6
+L1: lea DAT, r2
+jmp L5
+dec DAT[zz]
+L5: bne L8
+cmp L2, #1
+red r6
+red r5
+dec r3
+cmp r0, #-2
+L3: prn #k
+red r0
+mov r6, r6
+bne L9
+bne L9
+inc DAT[1]
+jmp L3
+bne L6
+ inc DAT[k]
+dec DAT[k]
+lea DAT, r2
+red r2
+L10: mov r1 r2
+ dec DAT[k]
+L8: inc DAT[k]
+jmp L5
+cmp L4, r0
+red r5
+mov r3, r3
+dec r1
+mov r5, r5
+
+cmp r7, #1
+cmp r3, #k
+mov r3, r3
+L9: jmp L1
+cmp r7, #1
+inc r0
+cmp r4, #k
+inc DAT[1]
+ dec r4
+dec r4
+bne L6
+jmp L4
+L4: rts
+dec r2
+bne L5
+L7: cmp r6, #1
+ dec r3
+inc r3
+L11: red r7
+mov r3, r3
+mov r1, r1
+L0: jmp L7
+bne L3
+red r0
+mov r5, r5
+ hlt
+DAT: .data 1, 2, 3, k
+.entry L0
@@ -0,0 +1,74 @@
+.define k = 3
+.extern X1
+mov r0, r0
+bne L5
+mov r4, r5
+cmp L6, #1
+inc r1
+cmp r4, #k
+bne L2
+ dec r6
+dec r6
+red r2
+dec L4
+ dec r7
+dec r7
+L3: jmp L6
+L6: inc r2
+cmp L5, #-2
+mov r2, r3
+mov r3, r3
+red r7
+L1: dec DAT
+dec DAT[2]
+L7: red r0
+L9: jmp L5
+L5: inc r2
+cmp r3, #-2
+dec r0
+jmp L6
+red r2
+L8: 
+cmp DAT[2], r6
+red r1
+mov r2, r2
+ dec r2
+dec r2
+cmp DAT[1], #-2
+inc r4
+mov r5, r5
+cmp r2, r7
+red r3
+dec r1
+bne L1
+ inc r2
+L10: inc r2
+add r1, r2
+L0: ; comment
+mov r1, r4
+red r6
+jmp L8
+red r0
+; comment
+ inc r3
+dec r3
+mov r5, r5
+; comment
+cmp r6, #k
+cmp L5, #k
+cmp r3, #-2
+cmp r2, #k
+jmp L1
+mov r7, r7
+ dec r7
+inc r7
+mov r7, r1
+inc L2
+L4: jmp L9
+dec r2
+not r1
+red r3
+ hlt
+L2: hlt
+DAT: .data 1, 2, 3, k
+.entry L2
@@ -0,0 +1,78 @@
+.define k = 3
+.extern X1
+cmp r4, DAT[k]
+ dec r2
+inc r2
+L10: mov r0, r4
+inc r2
+ inc DAT[1]
+inc DAT[1]
+red r1
+ dec r7
+inc r7
+clr L1
+L7: jmp L9
+not r1
+red r7
+jmp L0
+mov r3, r3
+red r2
+mov r2, r2
+jmp L9
+L9: prn r1
+cmp r5, #-2
+add r1, r2
+L2: red r7
+L0: mov r3, r3
+L8: lea DAT, r2
+L6: red r7
+bne L7
+mov r1, r6
+ inc r5
+L3: dec r5
+red r6
+ inc r3
+dec r3
+cmp r2, #1
+L11: lea DAT, r2
+ dec L4
+inc L4
+cmp r4, r1
+dec DAT[1]
+mov r5, r5
+jmp L1
+ dec r7
+dec r7
+red r5
+mov r2, r7
+cmp r4, #k
+ inc L1
+inc L1
+jmp L5
+mov r3, r3
+sub #4, r3
+ dec L7
+inc L7
+red r4
+cmp r6, L6
+cmp r2, #k
+inc DAT[2]
+dec DAT[1]
+red r6
+red r7
+red r7
+ dec r0
+inc r0
+cmp r0, L4
+cmp r2, DAT[2]
+cmp L2, #1
+dec L3
+jmp L9
+cmp r0, #1
+L5: red r0
+jmp L1
+ hlt
+L1: hlt
+L4: hlt
+DAT: .data 1, 2, 3, k
+.entry L1
@@ -0,0 +1,72 @@
+.define k = 3
+.extern X1
+mov r4, r4
+
+jmp L9
+L9: prn r1
+cmp r7, #1
+red r1
+clr L1
+L8: bne L1
+ dec DAT[2]
+inc DAT[2]
+mov r2, r3
+L7: red r1
+cmp L1, r0
+mov r2, r2
+inc r3
+cmp r0, #1
+L0: bne L6
+ inc r1
+L6: dec r1
+red r0
+mov r6, r6
+ dec r5
+inc r5
+; comment
+mov r5, r5
+jmp L6
+bne L9
+L11: clr L1
+L4: jmp L2
+L2: prn r1
+red r4
+mov r3, r3
+lea DAT, r2
+jmp L1
+cmp r4, #k
+red r1
+L5: jmp L6
+L10: red r7
+
+cmp L4, #-2
+red r6
+red r7
+cmp r7, L3
+inc DAT[1]
+jmp L3
+L3: prn r1
+jmp L8
+ dec X1
+dec X1
+; comment
+sub #4, r3
+L1: red r1
+ inc r3
+dec r3
+
+mov r2, r2
+jmp L0
+mov r4, r4
+cmp DAT[2], r1
+sub #4, r3
+lea DAT, r2
+jmp L5
+cmp r6, #k
+jmp L0
+jmp L7
+cmp r6, #1
+red r7
+red r7
+ hlt
+DAT: .data 1, 2, 3, k
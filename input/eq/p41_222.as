@@ -0,0 +1,71 @@
+.define k = 3
+.extern X1
+cmp r0, r7
+add r1, r2
+mov r7, r7
+bne L8
+inc r3
+cmp r1, #-2
+
+L11: jmp L5
+red r3
+jmp L9
+L9: hlt
+L5: inc r0
+ dec r6
+dec r6
+cmp r6, L7
+bne L5
+L1: jmp L9
+cmp r2, DAT[zz]
+bne L1
+L2: cmp DAT[1], r7
+jmp L9
+L6: cmp r5, #k
+ dec X1
+inc X1
+jmp L9
+red r0
+; comment
+L3: red r0
+red r0
+bne L1
+jmp L0
+L8: sub #4, r3
+cmp r4, r2
+mov r5, r5
+mov r7, r7
+mov r5, r7
+mov r5, r5
+
+L4: bne L3
+red r3
+cmp r6, r7
+sub #4, r3
+jmp L6
+dec X1
+ dec r7
+dec r7
+cmp X1, #-2
+bne L0
+cmp L5, #1
+red r1
+ inc DAT[zz]
+inc DAT[zz]
+L0: jmp L8
+prn #k
+mov r1, r1
+L10: bne L9
+ inc r3
+inc r3
+inc r6
+L7: cmp L3, r4
+jmp L3
+inc X1
+jmp L1
+bne L7
+not r1
+clr L1
+ hlt
+DAT: .data 1, 2, 3, k
+.entry L1
@@ -0,0 +1,75 @@
+.define k = 3
+.extern X1
+inc r1
+red r0
+mov r5, r4
+mov r2, r6
+mov r4, r4
+L10: mov r5, r5
+L5: bne L1
+ dec DAT[2]
+dec DAT[2]
+cmp L0, #1
+cmp r2, r7
+cmp X1, #k
+cmp DAT[k], #-2
+jmp L5
+mov r3, r3
+cmp L7, DAT[2]
+L0: cmp r3, #-2
+L7: mov r7, r7
+ inc r3
+inc r3
+mov r5, r5
+red r3
+ dec DAT[2]
+L11: inc DAT[2]
+add r1, r2
+ inc r1
+inc r1
+mov r0, r2
+mov r6, r6
+jmp L7
+cmp L4, #-2
+L8: red r4
+ inc L1
+inc L1
+ dec r5
+dec r5
+jmp L5
+L4: jmp L0
+dec r0
+dec r7
+red r6
+jmp L9
+red r1
+mov r3, r3
+cmp r0, #-2
+mov r3, r3
+ dec DAT[1]
+dec DAT[1]
+jmp L3
+L3: inc r2
+ inc X1
+L9: dec X1
+L6: ; comment
+mov r4, r4
+cmp X1, #1
+red r0
+jmp L2
+jmp L4
+prn #k
+ inc r5
+L2: dec r5
+jmp L0
+red r0
+bne L7
+L1: inc L2
+mov r5, r4
+mov r4, r4
+bne L5
+jmp L3
+jmp L6
+ hlt
+DAT: .data 1, 2, 3, k
+.entry L0
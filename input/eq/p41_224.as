@@ -0,0 +1,74 @@
+.define k = 3
+.extern X1
+ inc r3
+L3: inc r3
+L6: cmp r2, #k
+L5: inc r1
+ inc L4
+inc L4
+mov r6, r6
+L11: inc L7
+dec L0
+ dec DAT[k]
+dec DAT[k]
+L10: jmp L8
+mov r6, r6
+red r5
+L9: 
+ dec r6
+L7: dec r6
+red r7
+mov r3, r3
+L1: cmp r0, #k
+ dec DAT[k]
+dec DAT[k]
+mov r6, r6
+red r5
+L0: mov r1, r3
+dec r0
+; comment
+red r1
+inc r4
+mov r3, r3
+dec r7
+mov r7, r7
+jmp L3
+ dec r7
+inc r7
+ dec r2
+dec r2
+jmp L9
+red r4
+jmp L8
+L8: rts
+mov r0, r0
+mov r7, r7
+prn #k
+jmp L9
+clr L1
+cmp r4, #1
+inc r1
+L4: jmp L5
+L2: cmp r2, #k
+cmp r5, #1
+jmp L0
+mov r0, r0
+jmp L5
+lea DAT, r2
+dec r2
+sub #4, r3
+jmp L1
+jmp L9
+red r4
+not r1
+
+lea DAT, r2
+jmp L4
+ dec X1
+dec X1
+cmp DAT[1], #k
+jmp L4
+mov r0, r0
+ hlt
+DAT: .data 1, 2, 3, k
+.entry L1
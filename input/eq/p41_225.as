@@ -0,0 +1,71 @@
+.define k = 3
+.extern X1
+cmp DAT[k], #1
+clr L1
+jmp L3
+L3: prn r1
+L7: dec r0
+mov r5, r5
+bne L8
+mov r1 r2
+mov r2, r2
+prn #k
+jmp L4
+bne L6
+mov r3, r3
+jmp L1
+L0: mov r1, r7
+
+L11: dec r7
+L4: dec r7
+red r6
+red r6
+cmp L5, #-2
+L2: jmp L0
+red r7
+L8: mov r2, r2
+sub #4, r3
+L9: bne L1
+red r7
+mov r2, r2
+bne L9
+mov r6, r2
+clr L1
+cmp DAT[zz], #1
+jmp L6
+L6: inc r2
+red r5
+red r4
+jmp L3
+L5: cmp DAT, #-2
+ dec r3
+dec r3
+red r4
+cmp r1, r4
+cmp r4, #-2
+jmp L7
+cmp DAT[zz], #1
+mov r6, r6
+ dec L7
+inc L7
+jmp L0
+ dec r1
+inc r1
+ dec r2
+L10: inc r2
+jmp L6
+cmp r3, #-2
+L1: inc r2
+inc r7
+
+mov r1, r1
+red r3
+mov r6, r6
+jmp L6
+jmp L5
+ inc r7
+dec r7
+red r3
+mov r3, r3
+ hlt
+DAT: .data 1, 2, 3, k
@@ -0,0 +1,75 @@
+.define k = 3
+.extern X1
+
+jmp L0
+L0: prn r1
+inc r5
+mov r5, r5
+ inc r6
+dec r6
+ dec r1
+inc r1
+red r7
+mov r7, r7
+ dec r4
+inc r4
+cmp r6, #k
+bne L3
+cmp r1, r4
+bne L1
+red r6
+L9: bne L3
+ inc r4
+dec r4
+bne L5
+L4: mov r1, r1
+L5: cmp L3, #-2
+jmp L6
+L6: prn r1
+mov r1, r1
+ inc DAT[2]
+inc DAT[2]
+jmp L1
+L1: inc r2
+ dec r3
+dec r3
+cmp r3, #1
+red r1
+L8: red r2
+inc r2
+mov r5, r5
+dec r5
+mov r6, r3
+L2: red r4
+bne L6
+bne L3
+cmp DAT[2], #k
+
+L10: dec r2
+cmp DAT[k], #k
+jmp L1
+red r1
+jmp L5
+not r1
+L11: jmp L8
+bne L2
+cmp r5, r1
+inc DAT[1]
+L7: inc DAT[k]
+dec r5
+L3: jmp L9
+not r1
+cmp r6, L3
+bne L8
+add r1, r2
+ dec L5
+inc L5
+cmp r3, #-2
+jmp L0
+mov r3, r3
+not r1
+red r4
+cmp r0, #-2
+ hlt
+DAT: .data 1, 2, 3, k
+.entry L0
@@ -0,0 +1,72 @@
+.define k = 3
+.extern X1
+; comment
+mov r3, r6
+L1: cmp L1, #1
+ dec r3
+inc r3
+ inc r1
+dec r1
+red r5
+L6: mov r1, r1
+L10: mov r7, r7
+inc r2
+L7: jmp L6
+red r4
+mov r3, r3
+cmp L3, #1
+; comment
+bne L5
+cmp DAT[1], #k
+inc r6
+; comment
+red r6
+mov r7, r2
+red r0
+L4: red r2
+prn #k
+mov r1, r1
+L3: jmp L1
+ inc r0
+inc r0
+mov r0, r0
+ inc r4
+inc r4
+red r7
+ dec r7
+L2: dec r7
+L9: cmp r2, #1
+ inc DAT[2]
+dec DAT[2]
+bne L2
+cmp L6, #k
+mov r7, r7
+cmp r0, #1
+L11: red r6
+cmp r2, #k
+red r6
+L5: cmp r2, r7
+add r1, r2
+bne L2
+mov r2, r2
+L0: mov r6, r6
+mov r4, r3
+jmp L5
+cmp X1, L5
+mov r3, r3
+L8: jmp L8
+cmp r7, r5
+jmp L9
+bne L7
+ dec r2
+inc r2
+inc r7
+cmp r2, #-2
+mov r4, r4
+inc r1
+cmp r5, r0
+mov r2, r2
+mov r0, r0
+ hlt
+DAT: .data 1, 2, 3, k
+.entry L2
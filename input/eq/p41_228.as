@@ -0,0 +1,77 @@
+.define k = 3
+.extern X1
+bne L3
+cmp DAT, #-2
+mov r2, r6
+
+; comment
+cmp NOPE, r1
+mov r5, r6
+ inc r5
+dec r5
+jmp L4
+mov r7, r7
+red r3
+L4: mov r1, r1
+cmp r1, L7
+L10: inc r5
+inc r4
+jmp L3
+L3: inc r2
+ inc r2
+dec r2
+sub #4, r3
+ inc r5
+inc r5
+mov r7, r5
+L8: inc r4
+cmp r2, r7
+ dec r7
+dec r7
+mov r7, r7
+ inc r1
+dec r1
+L7: inc r5
+red r6
+cmp DAT[k], #1
+lea DAT, r2
+cmp r1, r5
+mov r6, r6
+red r0
+mov r1, r1
+ dec r2
+dec r2
+jmp L0
+L0: inc r2
+cmp r3, #1
+bne L9
+jmp L1
+L1: inc r2
+dec r7
+ dec r5
+inc r5
+L5: cmp r5, #k
+jmp L8
+inc DAT[k]
+cmp r2, #k
+L11: cmp DAT[zz], #-2
+cmp L7, #k
+cmp r1, L2
+dec r7
+dec r5
+L6: inc r6
+ inc r2
+dec r2
+L2: jmp L7
+sub #4, r3
+ dec DAT[zz]
+L9: inc DAT[zz]
+ dec r2
+inc r2
+mov r1 r2
+prn #k
+jmp L7
+cmp L4, #k
+dec NOPE
+ hlt
+DAT: .data 1, 2, 3, k
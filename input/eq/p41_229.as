@@ -0,0 +1,72 @@
+.define k = 3
+.extern X1
+cmp L4, #-2
+ inc r0
+inc r0
+cmp r0, #1
+dec r3
+bne L7
+mov r7, r7
+L8: red r5
+dec r6
+jmp L4
+L4: prn r1
+cmp r1, #k
+cmp DAT, r1
+cmp DAT[1], #-2
+L3: red r4
+L2: inc L7
+L1: mov r0, r0
+red r2
+bne L1
+L10: 
+cmp r3, DAT[k]
+jmp L0
+L0: rts
+jmp L7
+prn #k
+ inc r1
+inc r1
+mov r1, r1
+inc r3
+jmp L8
+red r7
+mov r5, r5
+L11: inc r7
+jmp L5
+jmp L9
+L9: inc r2
+L5: mov r0, r0
+L6: dec L2
+L7: mov r7, r1
+cmp L4, DAT[k]
+cmp r5, #1
+lea DAT, r2
+jmp L8
+cmp r1, r6
+jmp L7
+mov r3, r5
+red r4
+red r4
+bne L6
+ dec r6
+dec r6
+dec r3
+red r5
+cmp r6, #-2
+mov r6, r6
+sub #4, r3
+red r6
+jmp L7
+ inc DAT[2]
+inc DAT[2]
+jmp L9
+
+dec DAT[2]
+jmp L3
+
+
+red r0
+ hlt
+DAT: .data 1, 2, 3, k
+.entry L2
@@ -0,0 +1,80 @@
+.define k = 3
+.extern X1
+red r1
+ inc L2
+L4: inc L2
+ dec r1
+dec r1
+mov r0, r0
+jmp L5
+L5: prn r1
+cmp r1, DAT[1]
+ inc L2
+inc L2
+mov r6, r6
+jmp L9
+L9: prn r1
+jmp L7
+L7: prn r1
+L1: bne L7
+jmp L9
+ dec r6
+inc r6
+red r0
+red r1
+red r6
+mov r4, r4
+L6: red r3
+L10: jmp L2
+cmp r2, #k
+inc r6
+jmp L3
+L3: inc r2
+clr L1
+mov r4, r4
+ inc L6
+inc L6
+bne L1
+jmp L7
+cmp r0, DAT[1]
+bne L2
+add r1, r2
+cmp X1, #k
+red r3
+red r7
+mov r7, r7
+dec r4
+ dec r7
+inc r7
+red r2
+mov r7, r4
+ inc r4
+dec r4
+L0: cmp r2, #-2
+inc L4
+jmp L0
+cmp r2, r4
+cmp DAT[1], #1
+mov r1, r1
+red r5
+cmp L6, #-2
+red r4
+bne L2
+red r4
+mov r6, r6
+bne L2
+ dec r5
+inc r5
+inc r5
+cmp DAT[2], r0
+cmp r3, #1
+mov r6, r6
+ inc r4
+inc r4
+; comment
+add r1, r2
+ hlt
+L2: hlt
+L8: hlt
+DAT: .data 1, 2, 3, k
+.entry L2
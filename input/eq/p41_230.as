@@ -0,0 +1,68 @@
+.define k = 3
+.extern X1
+dec r0
+red r7
+jmp L4
+L10: bne L3
+L11: dec r2
+ inc r0
+dec r0
+dec r7
+ inc r5
+dec r5
+L6: red r3
+; comment
+L2: bne L0
+L1: cmp r0, #k
+; comment
+mov r5, r5
+red r5
+cmp r7, #1
+mov r7, r7
+L8: jmp L1
+bne L4
+L4: bne L4
+
+ dec r6
+inc r6
+bne L1
+mov r3, r2
+cmp r5, #1
+mov r1, r1
+mov r1, r1
+jmp L4
+bne L1
+red r6
+inc DAT[k]
+jmp L1
+not r1
+mov r2, r2
+cmp r5, r3
+L0: cmp r4, #1
+jmp L0
+cmp X1, r2
+L9: not r1
+jmp L2
+jmp L8
+cmp L0, #1
+mov r3, r4
+
+jmp L4
+red r2
+mov r2, r2
+L5: cmp r4, r4
+; comment
+mov r1, r1
+cmp r5, #1
+red r4
+L3: not r1
+jmp L9
+cmp L2, #-2
+bne L0
+cmp L0, r5
+bne L5
+jmp L4
+bne L5
+ hlt
+L7: hlt
+DAT: .data 1, 2, 3, k
@@ -0,0 +1,71 @@
+.define k = 3
+.extern X1
+red r6
+red r3
+; comment
+ dec DAT[2]
+inc DAT[2]
+L2: mov r1 r2
+cmp r0, DAT
+mov r7, r7
+red r1
+bne L5
+mov r6, r6
+jmp L5
+L11: jmp L5
+L5: hlt
+red r2
+red r5
+; comment
+L6: mov r0, r6
+red r0
+inc r0
+bne L6
+jmp L7
+L7: prn r1
+red r2
+ inc r0
+dec r0
+jmp L5
+; comment
+cmp r1, DAT[1]
+dec r0
+L1: 
+cmp L3, #1
+red r5
+L4: mov r1 r2
+jmp L7
+red r2
+ dec r6
+L10: inc r6
+
+dec L5
+mov r3, r3
+bne L2
+jmp L7
+prn #k
+inc L3
+cmp DAT[2], r7
+red r0
+red r0
+jmp L1
+mov r1, r1
+mov r1, r5
+; comment
+L8: dec r2
+L3: red r6
+bne L4
+; comment
+bne L8
+L9: add r1, r2
+not r1
+mov r1 r2
+red r2
+ inc r4
+dec r4
+red r7
+jmp L5
+inc DAT[1]
+ hlt
+L0: hlt
+DAT: .data 1, 2, 3, k
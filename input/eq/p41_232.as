@@ -0,0 +1,76 @@
+.define k = 3
+.extern X1
+cmp r4, DAT[1]
+ inc r1
+L1: dec r1
+bne L2
+red r6
+jmp L1
+mov r5, r5
+bne L6
+cmp r5, #k
+mov r3, r3
+jmp L1
+jmp L4
+; comment
+ inc L1
+dec L1
+ dec r2
+dec r2
+L2: red r5
+cmp r7, #1
+red r5
+ inc L2
+inc L2
+L4: mov r4, r4
+jmp L6
+L6: prn r1
+mov r3, r5
+prn #k
+L9: cmp L7, #k
+jmp L0
+L0: inc r2
+L7: cmp DAT, #1
+jmp L5
+L5: prn r1
+ inc r7
+L11: inc r7
+red r7
+jmp L2
+mov r0, r0
+jmp L5
+prn #k
+mov r7, r7
+bne L3
+; comment
+jmp L4
+prn #k
+inc r6
+cmp r4, #-2
+ inc DAT[1]
+L8: dec DAT[1]
+mov r4, r4
+inc r5
+clr L1
+
+red r4
+L10: lea DAT, r2
+ dec r7
+L3: dec r7
+cmp L4, #-2
+clr L1
+mov r5, r5
+ inc r3
+dec r3
+jmp L6
+cmp r4, r0
+
+red r4
+mov r6, r7
+red r2
+
+red r6
+mov r5, r5
+ hlt
+DAT: .data 1, 2, 3, k
+.entry L0
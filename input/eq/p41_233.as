@@ -0,0 +1,73 @@
+.define k = 3
+.extern X1
+jmp L8
+L8: inc r2
+mov r1, r1
+bne L1
+cmp L3, DAT[1]
+mov r4, r4
+red r5
+mov r7, r6
+ inc r1
+dec r1
+clr L1
+red r7
+L5: bne L1
+jmp L0
+L0: hlt
+ inc r0
+dec r0
+L10: inc L2
+mov r2, r2
+jmp L0
+jmp L5
+bne L4
+jmp L1
+L1: hlt
+L7: ; comment
+cmp r1, #k
+ inc L6
+inc L6
+red r4
+jmp L7
+ inc r3
+inc r3
+dec DAT[2]
+inc r2
+jmp L4
+ dec r3
+L9: dec r3
+
+cmp r0, #k
+mov r3, r3
+L6: jmp L9
+L4: jmp L8
+cmp L5, #k
+mov r5, r5
+cmp r1, #1
+L2: red r7
+L11: mov r4, r4
+L3: inc DAT[1]
+ dec L0
+dec L0
+jmp L3
+mov r2, r2
+red r6
+jmp L0
+dec r0
+; comment
+bne L1
+cmp r3, #k
+mov r1, r1
+; comment
+; comment
+red r6
+cmp L1, #-2
+inc r7
+red r7
+inc r0
+mov r0, r0
+red r7
+cmp r4, #1
+ hlt
+DAT: .data 1, 2, 3, k
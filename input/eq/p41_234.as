@@ -0,0 +1,74 @@
+.define k = 3
+.extern X1
+mov r1 r2
+red r7
+sub #4, r3
+ dec r1
+inc r1
+inc r4
+mov r4, r4
+
+
+red r4
+cmp r1, #1
+mov r1 r2
+L2: bne L9
+lea DAT, r2
+ inc r0
+L11: inc r0
+inc DAT[k]
+jmp L0
+L0: hlt
+bne L0
+ inc r1
+inc r1
+red r1
+mov r5, r5
+red r0
+bne L6
+ dec L3
+inc L3
+L5: bne L3
+clr L1
+inc L6
+cmp r4, #k
+L1: mov r6, r6
+ dec L4
+dec L4
+
+mov r2, r2
+ dec r6
+L10: dec r6
+L9: bne L6
+ dec r4
+L8: inc r4
+bne L2
+mov r0, r0
+
+mov r1 r2
+; comment
+red r7
+jmp L5
+jmp L4
+L4: rts
+
+jmp L4
+L3: red r7
+
+cmp DAT[1], #1
+red r6
+jmp L2
+cmp r1, #1
+jmp L7
+L7: hlt
+L6: cmp r6, #1
+red r4
+
+jmp L7
+cmp r5, r7
+cmp r5, L2
+jmp L4
+cmp r3, #1
+prn #k
+ hlt
+DAT: .data 1, 2, 3, k
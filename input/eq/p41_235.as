@@ -0,0 +1,75 @@
+.define k = 3
+.extern X1
+jmp L0
+L0: hlt
+L3: mov r0, r7
+L4: inc r7
+mov r5, r5
+ dec DAT[k]
+inc DAT[k]
+ dec r5
+L11: inc r5
+bne L6
+jmp L6
+L6: prn r1
+jmp L6
+red r5
+ inc L0
+dec L0
+; comment
+L10: red r5
+mov r1, r1
+dec DAT[k]
+ inc r2
+inc r2
+jmp L2
+ dec DAT[1]
+inc DAT[1]
+inc r5
+jmp L4
+; comment
+cmp DAT[1], #k
+ inc L7
+inc L7
+cmp r6, #-2
+mov r6, r6
+inc r6
+red r6
+L8: ; comment
+
+; comment
+red r4
+bne L0
+mov r5, r5
+L5: 
+bne L5
+cmp r4, #-2
+jmp L8
+inc DAT[1]
+mov r0, r0
+ inc L7
+dec L7
+cmp DAT[1], #-2
+red r4
+ dec DAT[1]
+inc DAT[1]
+not r1
+clr L1
+red r0
+mov r4, r7
+L7: dec r3
+jmp L8
+L1: cmp r5, r5
+sub #4, r3
+jmp L1
+mov r6, r6
+cmp L6, #1
+cmp r7, #1
+cmp DAT[2], #-2
+L9: clr L1
+mov r7, r7
+sub #4, r3
+red r5
+ hlt
+L2: hlt
+DAT: .data 1, 2, 3, k
@@ -0,0 +1,69 @@
+.define k = 3
+.extern X1
+dec DAT[1]
+dec r4
+ inc r3
+inc r3
+mov r1, r1
+cmp r4, r5
+sub #4, r3
+L7: red r5
+ inc r2
+inc r2
+bne L4
+bne L0
+not r1
+bne L9
+inc r1
+dec DAT
+inc r3
+mov r6, r6
+cmp DAT[1], #1
+L6: inc r4
+cmp r0, L4
+L4: 
+inc r2
+sub #4, r3
+lea DAT, r2
+L8: mov r3, r2
+cmp DAT[k], #1
+cmp r5, #k
+cmp r4, #-2
+mov r4, r4
+L2: jmp L4
+L3: mov r4, r4
+cmp DAT[1], #-2
+cmp L3, #k
+jmp L1
+L1: hlt
+mov r5, r5
+red r6
+jmp L8
+ dec L4
+inc L4
+bne L3
+L9: bne L7
+red r4
+cmp r7, #k
+ inc DAT[2]
+dec DAT[2]
+mov r6, r6
+dec r4
+L0: ; comment
+red r1
+L10: mov r3, r3
+prn #k
+L11: lea DAT, r2
+cmp DAT[k], #-2
+mov r6, r6
+L5: red r3
+jmp L9
+jmp L8
+not r1
+cmp L7, r4
+red r1
+cmp DAT[1], #-2
+jmp L7
+jmp L6
+ hlt
+DAT: .data 1, 2, 3, k
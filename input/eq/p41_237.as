@@ -0,0 +1,71 @@
+.define k = 3
+.extern X1
+red r3
+mov r2, r2
+bne L8
+ dec r5
+inc r5
+ dec r0
+dec r0
+
+cmp DAT[k], r5
+jmp L6
+L6: rts
+jmp L3
+L3: rts
+mov r0, r0
+L5: lea DAT, r2
+jmp L3
+prn #k
+L11: clr L1
+add r1, r2
+cmp r6, #-2
+mov r3, r3
+jmp L1
+L1: prn r1
+; comment
+L2: cmp r4, r3
+bne L9
+L4: mov r3, r3
+inc DAT[1]
+cmp r7, #1
+L9: red r4
+L7: dec r7
+jmp L3
+cmp r1, r3
+L10: dec r7
+mov r1, r1
+; comment
+L8: bne L7
+jmp L9
+red r1
+mov r0, r0
+jmp L3
+L0: clr L1
+cmp r1, #k
+jmp L2
+cmp X1, #-2
+cmp DAT[2], #k
+ dec DAT[1]
+dec DAT[1]
+jmp L4
+jmp L1
+clr L1
+cmp L0, #k
+not r1
+mov r3, r3
+mov r0, r4
+ inc DAT[zz]
+inc DAT[zz]
+mov r1 r2
+cmp r2, #k
+mov r1, r1
+; comment
+jmp L9
+red r6
+red r7
+jmp L2
+jmp L6
+mov r1, r1
+ hlt
+DAT: .data 1, 2, 3, k
@@ -0,0 +1,74 @@
+.define k = 3
+.extern X1
+mov r1, r1
+red r1
+jmp L0
+L0: prn r1
+mov r6, r6
+
+cmp r6, #1
+mov r5, r5
+ dec DAT[k]
+inc DAT[k]
+ dec r0
+inc r0
+sub #4, r3
+cmp DAT[2], r5
+red r0
+red r6
+ inc L4
+inc L4
+mov r4, r5
+L3: mov r5, r5
+cmp r7, L0
+mov r3, r3
+jmp L6
+L6: prn r1
+mov r2, r6
+mov r3, r3
+red r7
+L2: mov r1, r1
+jmp L8
+L8: prn r1
+red r6
+L10: prn #k
+ inc DAT[1]
+dec DAT[1]
+bne L2
+mov r0, r5
+clr L1
+not r1
+cmp r5, #k
+
+jmp L0
+inc r0
+jmp L9
+L9: hlt
+jmp L4
+mov r7, r4
+jmp L8
+red r3
+jmp L9
+
+red r7
+red r0
+mov r0, r6
+L4: mov r0, r0
+mov r0, r0
+mov r7, r7
+bne L3
+cmp r3, #k
+jmp L5
+not r1
+jmp L4
+red r7
+; comment
+L5: inc L0
+red r7
+red r4
+L1: dec r4
+add r1, r2
+ hlt
+L7: hlt
+DAT: .data 1, 2, 3, k
+.entry L2
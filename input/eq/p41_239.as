@@ -0,0 +1,78 @@
+.define k = 3
+.extern X1
+L11: mov r1, r1
+ dec r4
+inc r4
+red r1
+L3: cmp r0, L6
+dec r1
+ inc r3
+inc r3
+L8: jmp L3
+ dec r1
+inc r1
+red r4
+clr L1
+ dec r6
+inc r6
+L7: inc r7
+ inc L5
+L4: inc L5
+jmp L5
+L5: inc r2
+mov r1, r1
+cmp DAT[1], #1
+ inc r3
+L1: dec r3
+cmp r1, L0
+ inc r1
+dec r1
+
+ dec r1
+L10: dec r1
+L0: bne L1
+L9: dec r4
+L6: red r0
+cmp DAT, #k
+L2: inc DAT[1]
+red r6
+mov r1, r1
+jmp L8
+prn #k
+ dec r4
+dec r4
+red r6
+ inc r0
+dec r0
+jmp L2
+red r5
+jmp L9
+mov r4, r4
+jmp L5
+mov r2, r0
+mov r1, r7
+lea DAT, r2
+
+dec r1
+add r1, r2
+ inc L1
+dec L1
+cmp L0, r7
+ inc r6
+inc r6
+red r1
+bne L3
+bne L1
+
+inc r0
+clr L1
+ inc r3
+dec r3
+bne L4
+red r7
+; comment
+; comment
+
+jmp L7
+ hlt
+DAT: .data 1, 2, 3, k
@@ -0,0 +1,71 @@
+.define k = 3
+.extern X1
+
+L2: cmp L1, #k
+not r1
+prn #k
+L9: cmp r7, #1
+cmp NOPE, #1
+ dec r3
+inc r3
+cmp L2, #k
+sub #4, r3
+L8: prn #k
+L10: cmp L2, #-2
+cmp L4, r3
+ dec r5
+inc r5
+; comment
+red r5
+L11: bne L7
+add r1, r2
+L3: bne L6
+jmp L6
+cmp r2, #1
+red r0
+ dec L4
+dec L4
+not r1
+inc DAT[k]
+red r3
+mov r0, r0
+L1: red r7
+L5: add r1, r2
+mov r1, r1
+jmp L4
+L4: inc r2
+ dec r2
+inc r2
+L6: red r4
+
+mov r1, r1
+jmp L3
+cmp r7, #-2
+red r2
+sub #4, r3
+L7: inc DAT
+cmp r4, #k
+jmp L3
+; comment
+jmp L5
+
+red r7
+cmp r0, #1
+ dec r3
+inc r3
+jmp L3
+bne L2
+
+mov r1 r2
+jmp L6
+mov r7, r3
+inc r7
+
+mov r1, r1
+bne L3
+cmp r6, r4
+jmp L7
+ inc DAT[k]
+inc DAT[k]
+ hlt
+DAT: .data 1, 2, 3, k
@@ -0,0 +1,75 @@
+.define k = 3
+.extern X1
+mov r5, r5
+red r5
+L1: cmp DAT[zz], #-2
+jmp L0
+L0: inc r2
+jmp L5
+
+mov r5, r2
+mov r1, r1
+mov r0, r0
+L9: cmp r7, #1
+L6: dec r2
+cmp L3, DAT[1]
+red r4
+ inc DAT[k]
+L11: inc DAT[k]
+cmp DAT, L1
+ dec r5
+dec r5
+red r4
+L10: mov r3, r3
+bne L6
+lea DAT, r2
+L7: ; comment
+L4: mov r2, r2
+
+ dec NOPE
+inc NOPE
+ inc r0
+dec r0
+mov r7, r5
+cmp L6, #1
+L5: cmp r7, #k
+ dec DAT[1]
+dec DAT[1]
+ dec r2
+dec r2
+bne L4
+inc L4
+cmp r4, L6
+red r3
+mov r2, r0
+; comment
+L2: dec r7
+jmp L0
+ inc r2
+inc r2
+mov r6, r6
+ dec r4
+L3: dec r4
+mov r3, r3
+dec r2
+inc DAT[zz]
+jmp L3
+bne L4
+dec r7
+mov r1, r1
+red r3
+jmp L3
+mov r0, r0
+jmp L5
+L8: ; comment
+cmp r7, r2
+jmp L9
+mov r3, r3
+cmp r4, r6
+ dec r4
+dec r4
+red r5
+ inc r4
+dec r4
+ hlt
+DAT: .data 1, 2, 3, k
@@ -0,0 +1,73 @@
+.define k = 3
+.extern X1
+lea DAT, r2
+; comment
+L9: jmp L8
+
+prn #k
+cmp r3, #-2
+cmp r1, #-2
+L2: red r5
+mov r6, r6
+L5: bne L9
+sub #4, r3
+jmp L0
+L0: prn r1
+cmp r5, #k
+red r4
+jmp L6
+L6: hlt
+cmp r6, r5
+jmp L0
+mov r3, r3
+L7: mov r1, r1
+inc r3
+bne L6
+jmp L6
+red r0
+mov r2, r2
+bne L0
+bne L7
+ dec r1
+inc r1
+cmp r7, #k
+mov r6, r6
+L10: jmp L7
+; comment
+mov r1, r4
+ inc r2
+inc r2
+ inc r7
+dec r7
+sub #4, r3
+cmp L2, #-2
+red r4
+jmp L1
+L1: prn r1
+lea DAT, r2
+inc r4
+not r1
+cmp r5, #1
+L8: inc L0
+bne L2
+bne L6
+mov r3, r3
+lea DAT, r2
+dec r4
+; comment
+bne L3
+jmp L1
+jmp L9
+cmp r6, #1
+cmp DAT[2], #1
+red r1
+lea DAT, r2
+dec L1
+prn #k
+mov r1, r1
+jmp L5
+ hlt
+L3: hlt
+L4: hlt
+DAT: .data 1, 2, 3, k
+.entry L1
@@ -0,0 +1,72 @@
+.define k = 3
+.extern X1
+ inc r7
+dec r7
+cmp DAT[1], DAT[k]
+mov r6, r6
+ inc DAT[2]
+inc DAT[2]
+red r5
+jmp L3
+L3: prn r1
+mov r2, r2
+mov r5, r3
+jmp L2
+red r0
+clr L1
+dec L0
+lea DAT, r2
+L11: mov r1, r1
+jmp L5
+L5: hlt
+jmp L6
+L6: inc r2
+L8: bne L6
+bne L5
+ inc r7
+inc r7
+L1: ; comment
+jmp L3
+L9: mov r4, r4
+ dec r6
+L2: inc r6
+mov r4, r4
+cmp r5, #1
+bne L3
+L4: cmp DAT[2], r4
+bne L8
+cmp r6, #-2
+mov r2, r2
+bne L9
+dec L1
+cmp r2, #1
+mov r0, r0
+red r5
+L7: bne L7
+mov r6, r6
+bne L3
+mov r1, r6
+red r0
+L10: cmp X1, r4
+L0: bne L9
+clr L1
+mov r2, r5
+; comment
+cmp L2, #1
+red r4
+mov r4, r4
+bne L2
+jmp L9
+ dec r1
+inc r1
+sub #4, r3
+; comment
+cmp DAT[1], r1
+lea DAT, r2
+bne L3
+mov r2, r2
+red r6
+mov r4, r4
+clr L1
+ hlt
+DAT: .data 1, 2, 3, k
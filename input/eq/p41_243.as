@@ -0,0 +1,83 @@
+.define k = 3
+.extern X1
+jmp L6
+L6: prn r1
+L1: mov r5, r3
+jmp L0
+L0: rts
+jmp L0
+bne L1
+bne L1
+ inc DAT[k]
+dec DAT[k]
+jmp L7
+L7: prn r1
+L8: cmp r3, #1
+L11: red r1
+bne L5
+ dec r5
+dec r5
+cmp r5, DAT[k]
+L10: bne L6
+ dec DAT[k]
+dec DAT[k]
+L4: mov r5, r5
+dec r4
+ dec r7
+L5: inc r7
+clr L1
+jmp L3
+L3: prn r1
+mov r1, r1
+ dec r4
+inc r4
+mov r4, r4
+dec r0
+cmp r1, #-2
+cmp r4, #k
+ dec r3
+L9: dec r3
+cmp r2, #-2
+ dec r7
+dec r7
+jmp L7
+mov r3, r3
+L2: cmp L3, #1
+jmp L1
+; comment
+dec L4
+jmp L3
+clr L1
+mov r5, r5
+; comment
+ inc r1
+dec r1
+cmp r2, DAT[1]
+
+ inc DAT[2]
+dec DAT[2]
+mov r3, r3
+cmp L2, DAT[k]
+mov r0, r5
+ dec r6
+inc r6
+bne L7
+jmp L0
+bne L1
+red r5
+red r5
+cmp r6, #1
+ inc r7
+dec r7
+ inc r4
+dec r4
+jmp L8
+bne L0
+ dec L4
+dec L4
+ dec r1
+inc r1
+ dec r2
+inc r2
+ hlt
+DAT: .data 1, 2, 3, k
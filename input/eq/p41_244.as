@@ -0,0 +1,75 @@
+.define k = 3
+.extern X1
+prn #k
+not r1
+L1: red r2
+cmp DAT[2], #-2
+cmp r6, #-2
+L3: ; comment
+red r0
+jmp L5
+L5: inc r2
+cmp DAT, L5
+L0: bne L4
+cmp L0, #1
+jmp L6
+L6: hlt
+jmp L4
+L4: rts
+cmp r4, #1
+mov r5, r5
+red r0
+ dec L2
+dec L2
+L9: jmp L1
+mov r4, r4
+clr L1
+red r3
+cmp r5, r5
+cmp DAT[k], #-2
+ dec r4
+L10: inc r4
+mov r5, r5
+sub #4, r3
+L2: cmp DAT[2], #-2
+clr L1
+L11: red r3
+red r6
+cmp r6, #-2
+L7: ; comment
+cmp r5, #1
+ inc r0
+inc r0
+mov r2, r2
+cmp r6, L5
+cmp r1, #-2
+L8: cmp r7, #-2
+cmp DAT[2], r1
+red r5
+jmp L5
+mov r0, r0
+mov r0, r5
+jmp L8
+jmp L1
+ dec r3
+dec r3
+red r4
+jmp L9
+bne L1
+ dec r5
+dec r5
+cmp r6, r2
+cmp r6, L7
+red r6
+red r1
+dec DAT[1]
+; comment
+clr L1
+not r1
+ dec DAT[2]
+inc DAT[2]
+ inc L7
+dec L7
+ hlt
+DAT: .data 1, 2, 3, k
+.entry L1
@@ -0,0 +1,71 @@
+.define k = 3
+.extern X1
+L7: mov r5, r7
+lea DAT, r2
+; comment
+jmp L4
+L4: rts
+bne L9
+L5: cmp r0, DAT[2]
+L1: ; comment
+L0: mov r5, r0
+red r6
+red r5
+jmp L8
+bne L6
+bne L1
+red r6
+dec r0
+mov r1, r1
+cmp r3, #1
+ inc L6
+inc L6
+cmp r6, DAT
+ dec L7
+L8: dec L7
+bne L4
+add r1, r2
+cmp r5, #1
+L6: red r1
+ inc r7
+L10: inc r7
+
+jmp L7
+mov r7, r7
+jmp L5
+L11: red r2
+jmp L3
+jmp L7
+mov r7, r7
+L3: mov r5, r5
+prn #k
+red r3
+; comment
+cmp r2, #k
+mov r2, r2
+L2: bne L6
+red r2
+mov r5, r5
+red r6
+bne L2
+red r2
+mov r2, r2
+ dec r7
+dec r7
+ inc r0
+dec r0
+; comment
+mov r6, r6
+mov r4, r4
+jmp L4
+L9: red r7
+bne L1
+cmp r3, #1
+red r4
+cmp r2, L3
+cmp L5, r2
+jmp L4
+cmp r2, #k
+ hlt
+DAT: .data 1, 2, 3, k
+.entry L2
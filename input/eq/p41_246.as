@@ -0,0 +1,73 @@
+.define k = 3
+.extern X1
+jmp L5
+L5: inc r2
+L2: inc NOPE
+red r4
+mov r0, r0
+mov r7, r2
+ dec r0
+inc r0
+cmp r5, #-2
+mov r3, r6
+ dec r6
+inc r6
+L6: jmp L3
+L3: hlt
+add r1, r2
+; comment
+mov r1 r2
+jmp L9
+L9: rts
+inc L1
+ dec r5
+inc r5
+mov r1 r2
+L0: cmp r3, #1
+cmp L2, #1
+jmp L7
+inc r0
+ inc r0
+L7: dec r0
+red r2
+red r6
+add r1, r2
+mov r3, r3
+red r7
+inc L4
+not r1
+inc L6
+L11: red r4
+cmp NOPE, #1
+L1: jmp L9
+L8: mov r6, r6
+jmp L7
+L10: cmp L6, #-2
+red r0
+L4: lea DAT, r2
+mov r5, r2
+mov r1 r2
+mov r1 r2
+cmp DAT[zz], #1
+red r6
+inc r5
+inc r0
+not r1
+inc r1
+mov r4, r4
+cmp r2, r6
+cmp r0, #k
+mov r1, r1
+
+ inc r3
+dec r3
+jmp L4
+cmp r1, #-2
+jmp L6
+mov r6, r6
+not r1
+mov r1 r2
+jmp L2
+ hlt
+DAT: .data 1, 2, 3, k
+.entry L2
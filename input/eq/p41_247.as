@@ -0,0 +1,75 @@
+.define k = 3
+.extern X1
+mov r7, r0
+mov r0, r0
+red r3
+red r6
+mov r3, r1
+dec r5
+lea DAT, r2
+mov r5, r5
+mov r0, r0
+ inc r4
+inc r4
+ dec r0
+inc r0
+mov r2, r2
+
+ inc L0
+L3: dec L0
+mov r2, r2
+cmp r3, r0
+jmp L7
+cmp r0, #1
+L4: jmp L3
+L2: jmp L1
+L1: prn r1
+ inc r4
+dec r4
+inc DAT
+cmp DAT[1], #k
+bne L6
+; comment
+
+mov r6, r6
+ dec r6
+inc r6
+jmp L1
+cmp X1, #k
+L7: red r3
+ dec r6
+inc r6
+prn #k
+inc DAT[1]
+L9: prn #k
+dec r3
+dec r2
+jmp L7
+clr L1
+bne L5
+ inc r5
+dec r5
+dec r7
+L5: not r1
+red r6
+red r6
+mov r5, r5
+lea DAT, r2
+
+L0: cmp r7, #k
+inc r1
+mov r2, r2
+cmp r6, r7
+cmp r2, #-2
+red r3
+red r7
+jmp L6
+L6: hlt
+bne L2
+bne L8
+mov r2, r2
+cmp DAT[2], r7
+ hlt
+L8: hlt
+DAT: .data 1, 2, 3, k
+.entry L2
@@ -0,0 +1,79 @@
+.define k = 3
+.extern X1
+not r1
+bne L1
+
+ inc r7
+dec r7
+red r2
+cmp L4, #-2
+ inc L6
+dec L6
+L8: red r0
+bne L8
+cmp r3, r2
+L0: 
+L11: mov r1, r1
+jmp L6
+L10: mov r3, r3
+cmp r6, #k
+mov r5, r5
+ inc r6
+dec r6
+ inc r3
+L6: inc r3
+L3: ; comment
+red r5
+mov r7, r0
+red r7
+cmp r6, r5
+cmp r1, #k
+mov r3, r1
+jmp L6
+ dec r5
+inc r5
+ inc r6
+inc r6
+ inc r6
+dec r6
+bne L8
+jmp L6
+ inc L6
+dec L6
+mov r2, r2
+cmp r6, #k
+not r1
+red r4
+mov r5, r5
+L2: inc r4
+jmp L7
+L7: inc r2
+ dec r2
+dec r2
+ inc L0
+inc L0
+L1: red r4
+L9: mov r1, r1
+L5: red r3
+L4: red r5
+red r5
+bne L9
+red r4
+; comment
+ dec r0
+inc r0
+inc L2
+mov r1, r1
+ dec r4
+dec r4
+mov r3, r3
+red r7
+mov r5, r5
+dec DAT[k]
+lea DAT, r2
+cmp L0, DAT[1]
+ inc L0
+inc L0
+ hlt
+DAT: .data 1, 2, 3, k
+.entry L0
@@ -0,0 +1,71 @@
+.define k = 3
+.extern X1
+
+jmp L9
+mov r1 r2
+L6: jmp L1
+L1: hlt
+cmp DAT[k], #k
+dec r6
+ inc r0
+L10: dec r0
+ dec r0
+L9: inc r0
+ inc r7
+inc r7
+ dec r3
+dec r3
+cmp DAT[zz], #1
+cmp X1, r5
+not r1
+L3: inc r2
+bne L9
+jmp L3
+L8: red r4
+jmp L8
+jmp L1
+ inc L2
+inc L2
+lea DAT, r2
+cmp L4, #k
+not r1
+dec L4
+dec DAT[zz]
+L0: bne L5
+ inc r0
+inc r0
+mov r2, r1
+bne L8
+bne L1
+red r4
+inc r2
+dec r4
+cmp r6, r3
+L7: mov r2, r2
+inc DAT[1]
+L11: cmp DAT[zz], #1
+mov r1 r2
+L5: 
+L2: jmp L0
+mov r1 r2
+red r0
+jmp L5
+jmp L1
+red r3
+mov r7, r7
+jmp L2
+L4: bne L3
+dec r2
+red r0
+sub #4, r3
+jmp L7
+bne L5
+mov r2, r2
+sub #4, r3
+bne L9
+not r1
+inc DAT
+mov r3, r2
+mov r4, r4
+ hlt
+DAT: .data 1, 2, 3, k
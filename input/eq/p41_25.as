@@ -0,0 +1,75 @@
+.define k = 3
+.extern X1
+red r0
+red r7
+L4: mov r6, r6
+jmp L3
+L3: prn r1
+cmp r7, #k
+cmp r7, #1
+mov r0, r0
+L11: cmp r7, r7
+; comment
+cmp r6, #1
+cmp L5, #1
+L2: red r2
+mov r5, r5
+red r7
+ dec r7
+dec r7
+red r4
+; comment
+jmp L9
+cmp X1, #1
+L5: bne L0
+red r5
+L7: bne L9
+cmp r4, #-2
+bne L2
+L9: red r5
+jmp L3
+bne L4
+L10: cmp DAT[k], #-2
+ dec L0
+inc L0
+ dec r7
+inc r7
+ dec r2
+inc r2
+L0: red r6
+mov r2, r2
+red r5
+jmp L0
+red r1
+; comment
+L8: bne L7
+L1: ; comment
+mov r2, r4
+sub #4, r3
+dec r1
+; comment
+mov r6, r6
+jmp L3
+red r3
+red r3
+ inc r5
+L6: inc r5
+sub #4, r3
+ dec r7
+inc r7
+ inc r0
+dec r0
+sub #4, r3
+lea DAT, r2
+inc r0
+cmp L4, r0
+ inc r0
+inc r0
+mov r4, r6
+ inc r2
+dec r2
+mov r5, r2
+mov r5, r0
+ hlt
+DAT: .data 1, 2, 3, k
+.entry L2
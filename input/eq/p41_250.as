@@ -0,0 +1,79 @@
+.define k = 3
+.extern X1
+red r1
+jmp L2
+cmp r4, #-2
+cmp L7, r6
+cmp L7, #-2
+ inc r5
+inc r5
+clr L1
+ dec L7
+inc L7
+jmp L3
+mov r1, r1
+mov r1, r1
+mov r1, r1
+mov r0, r0
+bne L8
+mov r2, r2
+red r6
+; comment
+ inc r1
+L2: inc r1
+lea DAT, r2
+bne L1
+
+add r1, r2
+red r6
+ inc L6
+L7: dec L6
+red r2
+ inc r4
+inc r4
+mov r0, r0
+mov r6, r6
+red r3
+L11: red r6
+bne L0
+
+jmp L2
+L8: cmp r5, #-2
+cmp r0, #1
+dec r6
+dec r0
+cmp r1, #-2
+ inc r6
+dec r6
+jmp L2
+L3: jmp L1
+cmp r2, #1
+ dec DAT
+inc DAT
+dec r7
+red r1
+L10: mov r3, r3
+ inc r2
+dec r2
+red r7
+inc r0
+cmp DAT[k], L6
+red r7
+ dec r2
+dec r2
+jmp L7
+L9: mov r5, r5
+jmp L5
+L5: prn r1
+lea DAT, r2
+mov r2, r2
+mov r6, r1
+ dec r6
+L4: dec r6
+inc DAT[k]
+ hlt
+L0: hlt
+L1: hlt
+L6: hlt
+DAT: .data 1, 2, 3, k
+.entry L0
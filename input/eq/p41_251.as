@@ -0,0 +1,71 @@
+.define k = 3
+.extern X1
+ inc L7
+dec L7
+L3: red r6
+red r2
+jmp L1
+L1: rts
+cmp r3, r3
+mov r3, r2
+ inc r3
+dec r3
+mov r4, r1
+L6: inc r7
+ inc DAT[1]
+L8: inc DAT[1]
+L9: 
+L5: dec L7
+mov r7, r7
+L11: mov r7, r7
+mov r5, r5
+red r7
+cmp DAT[2], r4
+cmp r5, L3
+red r4
+bne L1
+inc r5
+L0: red r7
+cmp DAT[k], #-2
+jmp L5
+red r1
+prn #k
+ inc L4
+inc L4
+red r4
+L7: red r3
+red r7
+ inc r1
+dec r1
+jmp L9
+red r6
+red r0
+cmp L3, #-2
+L10: mov r0, r0
+ dec L7
+dec L7
+L4: mov r2, r2
+dec r3
+L2: bne L9
+red r3
+jmp L8
+clr L1
+mov r3, r1
+red r2
+inc r0
+bne L8
+mov r3, r3
+red r3
+bne L7
+red r0
+mov r4, r2
+cmp r2, #-2
+; comment
+bne L1
+mov r2, r7
+cmp r6, L0
+jmp L4
+
+prn #k
+ hlt
+DAT: .data 1, 2, 3, k
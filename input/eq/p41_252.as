@@ -0,0 +1,77 @@
+.define k = 3
+.extern X1
+mov r4, r4
+inc r4
+red r4
+add r1, r2
+mov r3, r4
+jmp L2
+L2: prn r1
+bne L8
+ inc r3
+inc r3
+mov r4, r4
+bne L8
+L11: jmp L1
+L1: inc r2
+cmp DAT[2], #1
+L9: mov r0, r6
+sub #4, r3
+L8: cmp r2, #k
+ dec r6
+inc r6
+jmp L0
+L0: prn r1
+mov r1 r2
+; comment
+jmp L2
+red r0
+add r1, r2
+L4: cmp r1, #1
+L5: jmp L3
+L3: hlt
+ inc L1
+inc L1
+bne L9
+ inc r0
+dec r0
+L7: bne L7
+red r3
+L6: dec DAT[k]
+cmp r1, #-2
+ inc r0
+dec r0
+bne L1
+jmp L7
+cmp r4, #1
+ inc r5
+inc r5
+; comment
+ inc DAT[zz]
+inc DAT[zz]
+red r5
+cmp r5, #1
+inc r3
+bne L5
+L10: jmp L3
+cmp r1, #1
+cmp L0, #k
+red r0
+dec r4
+mov r0, r0
+bne L4
+red r6
+red r7
+ inc DAT[2]
+dec DAT[2]
+red r4
+red r6
+jmp L8
+red r1
+cmp DAT[1], #-2
+inc DAT[k]
+cmp r4, #-2
+mov r3, r0
+ hlt
+DAT: .data 1, 2, 3, k
+.entry L0
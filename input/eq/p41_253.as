@@ -0,0 +1,74 @@
+.define k = 3
+.extern X1
+inc r3
+ inc DAT[2]
+L4: inc DAT[2]
+L7: bne L4
+mov r4, r3
+; comment
+cmp L5, r0
+ dec L0
+inc L0
+L5: ; comment
+inc L3
+ dec r7
+dec r7
+red r3
+L6: red r1
+add r1, r2
+L11: jmp L8
+L8: inc r2
+L3: dec r4
+dec DAT[1]
+red r7
+L1: jmp L3
+inc DAT[2]
+cmp r3, r4
+mov r5, r5
+jmp L2
+mov r1, r1
+jmp L4
+L9: jmp L5
+jmp L3
+ inc r1
+dec r1
+mov r6, r1
+L0: mov r6, r3
+inc r6
+L2: jmp L0
+L10: not r1
+cmp r6, #k
+prn #k
+jmp L7
+inc r1
+jmp L6
+mov r3, r3
+; comment
+cmp r0, #-2
+ dec r5
+inc r5
+inc r5
+mov r1, r1
+jmp L0
+ inc DAT[k]
+dec DAT[k]
+red r0
+prn #k
+ dec r0
+inc r0
+; comment
+red r2
+inc L4
+; comment
+clr L1
+prn #k
+not r1
+ inc L2
+dec L2
+prn #k
+bne L2
+jmp L1
+dec r5
+ hlt
+DAT: .data 1, 2, 3, k
+.entry L1
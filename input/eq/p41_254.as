@@ -0,0 +1,79 @@
+.define k = 3
+.extern X1
+cmp L3, r5
+red r7
+L1: cmp r4, #1
+ dec L5
+L2: dec L5
+ inc r2
+dec r2
+inc r0
+ dec DAT[2]
+inc DAT[2]
+prn #k
+mov r7, r2
+L10: jmp L2
+bne L8
+red r5
+lea DAT, r2
+jmp L2
+mov r7, r7
+L9: red r2
+ dec r3
+dec r3
+ inc L0
+dec L0
+dec r5
+red r2
+ dec r1
+inc r1
+L8: cmp DAT[1], r2
+L7: jmp L6
+L6: prn r1
+mov r6, r4
+mov r2, r2
+cmp r7, #k
+jmp L5
+L5: rts
+L4: jmp L4
+ inc r3
+inc r3
+dec r2
+
+mov r1, r1
+ inc r6
+inc r6
+inc r1
+; comment
+
+bne L0
+inc r3
+ dec r0
+inc r0
+red r2
+ inc r7
+inc r7
+jmp L5
+red r6
+bne L1
+ dec r7
+L3: inc r7
+mov r6, r6
+mov r1, r4
+mov r5, r5
+ dec r7
+dec r7
+sub #4, r3
+cmp DAT[1], #1
+mov r5, r7
+inc r6
+
+ inc r0
+inc r0
+red r3
+L0: dec r0
+L11: red r7
+red r2
+mov r6, r6
+ hlt
+DAT: .data 1, 2, 3, k
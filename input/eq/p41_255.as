@@ -0,0 +1,77 @@
+.define k = 3
+.extern X1
+L10: jmp L9
+L9: prn r1
+mov r4, r4
+ dec r7
+inc r7
+ dec DAT[k]
+dec DAT[k]
+ dec r4
+dec r4
+
+ dec L1
+dec L1
+cmp r4, #k
+cmp DAT[zz], #k
+cmp r4, L0
+bne L5
+; comment
+bne L6
+ dec r4
+dec r4
+L11: not r1
+L1: mov r6, r6
+L4: bne L9
+mov r6, r6
+bne L0
+jmp L8
+; comment
+red r4
+ inc r1
+inc r1
+lea DAT, r2
+ dec L5
+dec L5
+jmp L5
+L5: rts
+inc DAT[k]
+L7: mov r5, r5
+jmp L1
+dec r6
+L2: mov r1, r5
+red r6
+jmp L1
+red r0
+cmp DAT[1], #k
+cmp r2, r1
+ dec r6
+inc r6
+jmp L7
+red r4
+lea DAT, r2
+bne L6
+L8: ; comment
+L0: sub #4, r3
+L6: dec DAT[1]
+L3: jmp L8
+bne L5
+inc r0
+dec r1
+ dec DAT[zz]
+inc DAT[zz]
+bne L2
+ inc r5
+dec r5
+dec r3
+red r3
+mov r0, r0
+jmp L9
+red r4
+inc DAT[2]
+cmp r0, #k
+cmp L5, #-2
+mov r5, r0
+ hlt
+DAT: .data 1, 2, 3, k
+.entry L1
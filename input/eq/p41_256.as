@@ -0,0 +1,69 @@
+.define k = 3
+.extern X1
+dec r0
+jmp L4
+red r1
+cmp r4, #1
+inc DAT[2]
+bne L0
+L6: dec r7
+red r1
+L4: cmp r3, #1
+L0: red r2
+mov r3, r3
+cmp r3, L5
+L10: lea DAT, r2
+mov r7, r7
+red r0
+ inc r0
+dec r0
+cmp L1, #1
+mov r4, r4
+L7: cmp r3, #-2
+ dec DAT[1]
+dec DAT[1]
+cmp X1, #1
+L5: inc r5
+lea DAT, r2
+cmp L3, #1
+L2: cmp DAT[1], r0
+L11: cmp X1, #-2
+red r2
+mov r5, r5
+ inc r7
+inc r7
+cmp r6, r4
+L9: add r1, r2
+L3: mov r5, r5
+jmp L2
+red r5
+jmp L8
+L8: cmp r0, #-2
+mov r0, r3
+red r1
+
+inc DAT[2]
+bne L4
+red r7
+mov r5, r5
+bne L2
+not r1
+cmp L1, #1
+red r0
+cmp L5, L7
+sub #4, r3
+cmp DAT[1], #k
+L1: mov r4, r4
+ inc r5
+inc r5
+mov r6, r6
+jmp L4
+cmp r3, #1
+mov r0, r0
+red r7
+red r1
+mov r5, r5
+jmp L7
+ hlt
+DAT: .data 1, 2, 3, k
+.entry L0
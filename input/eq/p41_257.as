@@ -0,0 +1,76 @@
+.define k = 3
+.extern X1
+mov r3, r3
+; comment
+jmp L3
+L3: inc r2
+red r2
+mov r2, r2
+mov r1, r1
+red r7
+red r3
+L11: jmp L1
+L7: red r4
+L2: inc r4
+L5: cmp r5, #1
+red r3
+mov r5, r3
+ inc L3
+dec L3
+L1: ; comment
+inc r1
+cmp r5, #-2
+L6: bne L8
+not r1
+bne L7
+cmp r4, #k
+red r7
+red r1
+mov r0, r0
+L10: jmp L6
+jmp L7
+
+dec r1
+red r5
+jmp L4
+mov r6, r3
+L8: lea DAT, r2
+ dec r1
+L0: dec r1
+ inc r7
+inc r7
+cmp r4, #-2
+mov r7, r7
+add r1, r2
+add r1, r2
+ inc DAT[1]
+L4: inc DAT[1]
+ inc r3
+dec r3
+ dec r6
+dec r6
+L9: lea DAT, r2
+jmp L6
+cmp r1, #-2
+not r1
+ dec L5
+dec L5
+jmp L3
+ inc DAT[2]
+dec DAT[2]
+add r1, r2
+; comment
+cmp DAT[k], #1
+mov r7, r7
+jmp L2
+ dec DAT[k]
+dec DAT[k]
+ dec r3
+dec r3
+mov r3, r3
+ inc r6
+inc r6
+
+mov r5, r5
+ hlt
+DAT: .data 1, 2, 3, k
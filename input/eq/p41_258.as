@@ -0,0 +1,69 @@
+.define k = 3
+.extern X1
+mov r6, r6
+mov r1 r2
+L5: cmp r3, #-2
+mov r2, r2
+red r3
+jmp L1
+cmp L4, r5
+dec r3
+bne L9
+red r7
+dec L4
+add r1, r2
+L6: mov r5, r1
+mov r3, r3
+red r4
+cmp X1, #1
+L7: red r4
+jmp L4
+mov r1 r2
+L3: red r1
+ dec r0
+dec r0
+ inc r5
+dec r5
+dec r3
+L2: cmp L1, #-2
+red r2
+mov r1 r2
+bne L5
+cmp L0, #1
+mov r7, r6
+L11: inc r1
+cmp r4, #-2
+jmp L0
+mov r1 r2
+ dec r3
+dec r3
+mov r4, r4
+red r3
+inc L5
+cmp r0, #1
+red r5
+red r4
+jmp L8
+L8: inc r2
+L4: mov r2, r2
+inc r4
+cmp r7, r7
+L9: inc r2
+jmp L5
+dec r3
+jmp L1
+bne L3
+inc r7
+dec r7
+L10: not r1
+jmp L4
+L0: red r6
+dec DAT[zz]
+mov r7, r7
+bne L9
+L1: jmp L4
+jmp L7
+mov r2, r2
+ hlt
+DAT: .data 1, 2, 3, k
+.entry L1
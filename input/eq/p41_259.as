@@ -0,0 +1,71 @@
+.define k = 3
+.extern X1
+L8: mov r7, r7
+mov r0, r0
+red r4
+mov r1, r1
+cmp r3, #1
+ inc DAT[2]
+inc DAT[2]
+L6: jmp L0
+L0: hlt
+dec L3
+bne L6
+clr L1
+red r2
+not r1
+jmp L6
+dec L4
+L3: red r6
+cmp r4, r5
+dec L7
+ inc L6
+L1: dec L6
+jmp L5
+L5: inc r2
+jmp L1
+cmp r3, #1
+L11: 
+L4: mov r7, r4
+L7: cmp X1, #k
+L2: red r2
+clr L1
+L10: cmp r3, DAT
+lea DAT, r2
+jmp L8
+prn #k
+bne L4
+ dec r3
+inc r3
+L9: jmp L7
+bne L3
+jmp L1
+mov r4, r4
+mov r1, r1
+cmp L4, r7
+dec r5
+jmp L6
+; comment
+jmp L3
+red r7
+cmp DAT[k], #1
+mov r6, r6
+red r3
+cmp r1, r6
+cmp r1, r5
+bne L2
+sub #4, r3
+cmp r5, #-2
+inc r3
+red r5
+mov r0, r0
+cmp r6, #1
+; comment
+ dec r6
+dec r6
+
+jmp L1
+
+ hlt
+DAT: .data 1, 2, 3, k
+.entry L0
@@ -0,0 +1,70 @@
+.define k = 3
+.extern X1
+cmp r0, #1
+jmp L2
+red r6
+cmp L0, #-2
+ dec DAT[k]
+L9: inc DAT[k]
+L4: 
+jmp L0
+L0: prn r1
+
+
+red r4
+L8: red r2
+L2: mov r0, r0
+jmp L1
+ dec r6
+inc r6
+bne L1
+bne L4
+red r6
+ inc r0
+inc r0
+red r7
+L3: ; comment
+L1: ; comment
+L10: cmp r1, #1
+red r0
+cmp DAT[k], X1
+L5: red r7
+cmp DAT[2], #k
+jmp L1
+mov r2, r2
+cmp r7, #-2
+L11: mov r0, r0
+mov r2, r2
+bne L8
+L6: red r0
+L7: jmp L6
+cmp r0, #-2
+dec L7
+prn #k
+; comment
+lea DAT, r2
+red r0
+sub #4, r3
+cmp r4, #1
+inc r4
+jmp L0
+bne L9
+red r1
+bne L1
+bne L1
+ dec DAT[1]
+dec DAT[1]
+jmp L7
+dec r1
+clr L1
+mov r7, r7
+ dec r7
+inc r7
+mov r3, r3
+; comment
+mov r3, r3
+cmp r6, #-2
+bne L9
+mov r6, r6
+ hlt
+DAT: .data 1, 2, 3, k
@@ -0,0 +1,73 @@
+.define k = 3
+.extern X1
+red r7
+mov r4, r1
+red r1
+jmp L0
+cmp DAT, #k
+jmp L6
+L6: prn r1
+lea DAT, r2
+L11: cmp r2, #k
+jmp L9
+L9: inc r2
+inc r5
+
+red r0
+jmp L3
+L3: prn r1
+cmp r4, #1
+ dec r6
+L5: inc r6
+cmp r3, #-2
+
+L2: jmp L7
+L1: 
+cmp r5, L5
+cmp DAT[1], #k
+cmp r5, r3
+jmp L0
+L0: hlt
+cmp r6, r2
+L7: clr L1
+lea DAT, r2
+cmp r5, r3
+jmp L0
+L10: dec r5
+mov r6, r6
+red r6
+L4: ; comment
+jmp L6
+bne L9
+L8: red r2
+
+mov r5, r5
+ inc L7
+dec L7
+cmp DAT[2], r4
+jmp L7
+cmp r1, r6
+cmp r3, #-2
+red r0
+red r1
+inc r7
+cmp r1, #1
+add r1, r2
+red r4
+cmp r7, L6
+ dec r5
+inc r5
+jmp L5
+cmp L5, #k
+ dec r2
+inc r2
+red r6
+mov r0, r6
+jmp L1
+mov r2, r5
+red r2
+cmp r1, #k
+ inc r5
+inc r5
+ hlt
+DAT: .data 1, 2, 3, k
@@ -0,0 +1,72 @@
+.define k = 3
+.extern X1
+red r2
+jmp L9
+L9: rts
+cmp r3, r4
+L1: cmp r0, r2
+bne L1
+L10: not r1
+L3: dec r5
+prn #k
+mov r2, r2
+mov r1 r2
+sub #4, r3
+jmp L0
+L0: hlt
+bne L3
+cmp L0, #k
+cmp r3, #k
+L6: add r1, r2
+jmp L8
+jmp L6
+jmp L3
+L8: mov r2, r2
+
+L4: bne L4
+jmp L0
+mov r2, r2
+ dec r2
+inc r2
+jmp L6
+ dec DAT[2]
+dec DAT[2]
+jmp L7
+L7: prn r1
+L2: mov r2, r2
+jmp L6
+sub #4, r3
+L5: red r5
+inc r2
+L11: dec r1
+red r2
+mov r1, r1
+; comment
+jmp L5
+red r7
+sub #4, r3
+red r5
+ inc L3
+dec L3
+sub #4, r3
+ inc NOPE
+inc NOPE
+jmp L4
+cmp r5, #k
+clr L1
+red r0
+inc L7
+prn #k
+
+red r7
+clr L1
+mov r1, r1
+lea DAT, r2
+jmp L0
+lea DAT, r2
+red r7
+red r1
+dec r6
+ hlt
+DAT: .data 1, 2, 3, k
+.entry L2
@@ -0,0 +1,72 @@
+.define k = 3
+.extern X1
+jmp L7
+L7: prn r1
+prn #k
+red r6
+L5: red r3
+jmp L5
+red r6
+mov r4, r7
+jmp L4
+red r3
+cmp r4, r2
+L8: prn #k
+mov r7, r7
+L11: mov r6, r6
+mov r7, r7
+jmp L3
+L3: prn r1
+cmp r6, #1
+red r3
+bne L7
+jmp L2
+cmp r4, #1
+jmp L3
+mov r6, r6
+ dec r4
+L1: dec r4
+ dec r2
+inc r2
+mov r5, r1
+cmp L0, #1
+sub #4, r3
+jmp L1
+cmp L5, r3
+L0: jmp L5
+mov r3, r3
+add r1, r2
+ inc r5
+inc r5
+mov r4, r4
+red r7
+red r3
+inc DAT[2]
+mov r5, r5
+cmp L2, #k
+bne L2
+L9: 
+ inc r6
+L2: inc r6
+ dec L6
+dec L6
+prn #k
+L10: jmp L0
+mov r5, r5
+cmp r4, r5
+L6: 
+mov r0, r3
+sub #4, r3
+red r7
+ dec r0
+dec r0
+cmp DAT[2], r1
+mov r5, r5
+L4: red r4
+dec r2
+cmp DAT[2], L5
+red r2
+prn #k
+red r0
+ hlt
+DAT: .data 1, 2, 3, k
@@ -0,0 +1,69 @@
+.define k = 3
+.extern X1
+; comment
+red r6
+; comment
+cmp r0, #k
+dec DAT
+L4: bne L3
+L6: red r2
+cmp r0, r3
+bne L1
+ inc DAT[1]
+inc DAT[1]
+cmp r6, #-2
+mov r0, r0
+lea DAT, r2
+bne L9
+L7: dec DAT[1]
+cmp r1, #-2
+jmp L2
+ dec X1
+inc X1
+
+red r4
+dec r4
+L10: inc DAT[1]
+red r2
+sub #4, r3
+cmp r0, #-2
+bne L9
+red r4
+
+clr L1
+L8: dec r2
+mov r1, r1
+bne L7
+jmp L3
+jmp L1
+L1: inc r2
+mov r0, r0
+mov r0, r0
+L3: jmp L8
+cmp r3, #-2
+L5: red r1
+cmp r2, #-2
+L9: red r2
+ dec r1
+L11: dec r1
+jmp L3
+mov r0, r0
+; comment
+dec L6
+L0: ; comment
+mov r6, r6
+L2: 
+mov r5, r5
+; comment
+cmp r7, #k
+red r1
+mov r6, r5
+jmp L2
+inc DAT[2]
+red r6
+ inc r6
+inc r6
+lea DAT, r2
+sub #4, r3
+ hlt
+DAT: .data 1, 2, 3, k
@@ -0,0 +1,75 @@
+.define k = 3
+.extern X1
+bne L8
+L2: dec r0
+L6: jmp L7
+L7: inc r2
+mov r6, r6
+cmp DAT[k], DAT
+L5: sub #4, r3
+cmp r5, DAT[1]
+mov r6, r6
+L4: mov r4, r1
+jmp L5
+add r1, r2
+L11: jmp L0
+L0: prn r1
+cmp r2, #1
+ inc r4
+inc r4
+; comment
+cmp r0, #k
+red r7
+ dec L2
+dec L2
+dec L4
+L10: inc r2
+cmp r0, #-2
+mov r0, r5
+lea DAT, r2
+L3: inc DAT[zz]
+red r6
+L9: red r6
+L1: jmp L7
+ inc r0
+inc r0
+L8: ; comment
+mov r0, r0
+bne L3
+ dec X1
+inc X1
+red r6
+jmp L8
+ dec L5
+dec L5
+mov r6, r6
+red r5
+mov r2, r2
+
+; comment
+jmp L3
+jmp L1
+dec DAT[1]
+jmp L9
+
+dec L7
+mov r1, r1
+jmp L7
+cmp L0, #k
+bne L8
+red r2
+ dec L2
+dec L2
+red r4
+jmp L2
+cmp r5, #k
+mov r5, r5
+sub #4, r3
+ dec r3
+inc r3
+mov r5, r5
+ dec r4
+inc r4
+ hlt
+DAT: .data 1, 2, 3, k
+.entry L1
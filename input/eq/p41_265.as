@@ -0,0 +1,74 @@
+.define k = 3
+.extern X1
+inc r5
+cmp X1, r2
+cmp r4, #-2
+jmp L0
+L0: hlt
+cmp r1, #k
+jmp L2
+L2: rts
+mov r4, r4
+mov r0, r3
+inc L0
+red r6
+L9: lea DAT, r2
+L3: bne L0
+L1: clr L1
+mov r1, r1
+jmp L3
+jmp L3
+mov r0, r0
+inc L0
+cmp r5, #k
+mov r4, r4
+dec r1
+dec r7
+cmp r1, r2
+dec r1
+L5: cmp r3, r0
+dec r2
+dec r4
+mov r5, r4
+ dec r3
+inc r3
+cmp L5, #-2
+jmp L3
+; comment
+L7: red r5
+inc r7
+ inc r1
+L10: dec r1
+cmp r0, #1
+red r6
+red r7
+jmp L6
+L6: inc r2
+L4: add r1, r2
+ inc r4
+inc r4
+cmp r5, #k
+cmp DAT[1], #-2
+red r6
+ inc r7
+dec r7
+red r1
+inc r0
+mov r0, r0
+cmp r7, #-2
+ dec DAT
+inc DAT
+clr L1
+L8: cmp r3, #k
+red r0
+bne L4
+ inc r4
+L11: inc r4
+bne L9
+cmp L5, DAT[1]
+red r3
+clr L1
+mov r2, r2
+ hlt
+DAT: .data 1, 2, 3, k
+.entry L1
@@ -0,0 +1,72 @@
+.define k = 3
+.extern X1
+jmp L1
+L1: rts
+ inc r1
+inc r1
+red r3
+L0: jmp L2
+L2: inc r2
+ inc r6
+L11: dec r6
+mov r7, r7
+; comment
+clr L1
+cmp r1, r3
+L4: cmp L1, #-2
+red r6
+bne L7
+prn #k
+mov r4, r4
+red r7
+L10: cmp r1, #1
+jmp L2
+red r7
+L6: jmp L4
+ inc DAT[2]
+dec DAT[2]
+red r7
+dec r2
+L3: red r0
+cmp L7, #1
+mov r2, r2
+inc r7
+mov r7, r7
+mov r5, r0
+not r1
+mov r1, r1
+mov r3, r3
+cmp r3, r7
+mov r7, r5
+cmp r4, r0
+cmp r4, #1
+L9: jmp L6
+L7: cmp r2, DAT[k]
+jmp L6
+mov r5, r1
+cmp L6, #-2
+cmp r7, #1
+; comment
+cmp r3, #-2
+bne L7
+L8: jmp L5
+L5: prn r1
+red r2
+mov r0, r3
+; comment
+red r3
+ inc DAT[k]
+dec DAT[k]
+add r1, r2
+ dec r4
+dec r4
+cmp r2, #-2
+jmp L5
+red r7
+jmp L8
+dec r6
+cmp r4, L4
+sub #4, r3
+inc r4
+ hlt
+DAT: .data 1, 2, 3, k
@@ -0,0 +1,74 @@
+.define k = 3
+.extern X1
+L7: red r1
+L8: mov r3, r3
+L11: mov r2, r7
+inc r5
+red r3
+jmp L5
+L5: hlt
+cmp r0, #k
+inc r4
+bne L4
+cmp L2, #k
+ inc r6
+dec r6
+jmp L1
+L1: prn r1
+red r6
+red r1
+L0: lea DAT, r2
+jmp L0
+L10: mov r1 r2
+L3: red r7
+dec r3
+cmp r3, #k
+L4: mov r3, r3
+L9: red r1
+mov r7, r7
+cmp DAT[zz], L3
+red r7
+ dec r2
+inc r2
+inc r5
+ dec X1
+dec X1
+jmp L7
+ dec r3
+dec r3
+mov r1, r1
+jmp L4
+ dec DAT[2]
+inc DAT[2]
+L2: jmp L4
+jmp L1
+cmp DAT[k], #-2
+dec r1
+ dec L4
+inc L4
+
+L6: bne L9
+jmp L8
+ dec L7
+dec L7
+mov r1 r2
+mov r4, r2
+lea DAT, r2
+jmp L7
+cmp L1, #k
+red r0
+mov r4, r4
+jmp L9
+bne L9
+cmp r1, #1
+red r0
+jmp L0
+jmp L3
+jmp L3
+jmp L2
+red r2
+red r2
+red r2
+ hlt
+DAT: .data 1, 2, 3, k
+.entry L1
@@ -0,0 +1,69 @@
+.define k = 3
+.extern X1
+jmp L5
+L5: inc r2
+clr L1
+cmp r3, #-2
+inc r4
+L3: mov r5, r5
+mov r6, r6
+L4: jmp L3
+L10: red r2
+mov r5, r5
+ inc r7
+L2: inc r7
+cmp r4, r3
+L8: cmp DAT, #k
+; comment
+cmp r3, r4
+ inc r4
+dec r4
+red r1
+L0: bne L6
+cmp r5, #1
+mov r3, r3
+jmp L5
+ inc DAT[1]
+inc DAT[1]
+mov r0, r4
+mov r3, r3
+red r2
+L6: cmp r1, #1
+cmp r7, r1
+red r6
+red r5
+
+jmp L4
+jmp L0
+red r3
+sub #4, r3
+L9: mov r6, r7
+mov r6, r6
+jmp L2
+jmp L4
+red r7
+mov r1, r1
+mov r0, r0
+
+bne L6
+L1: red r7
+L7: bne L8
+L11: cmp DAT[2], #k
+mov r1, r1
+inc r1
+mov r4, r4
+red r6
+jmp L7
+red r5
+bne L9
+bne L7
+
+cmp r1, DAT[k]
+bne L2
+ inc L2
+inc L2
+
+jmp L3
+mov r5, r5
+ hlt
+DAT: .data 1, 2, 3, k
@@ -0,0 +1,76 @@
+.define k = 3
+.extern X1
+L1: clr L1
+
+bne L1
+add r1, r2
+ dec r0
+inc r0
+mov r4, r3
+mov r5, r5
+red r1
+mov r3, r3
+; comment
+red r3
+cmp r7, #k
+mov r4, r7
+cmp L5, #k
+red r7
+mov r1, r1
+ dec r3
+inc r3
+cmp r7, #-2
+jmp L4
+L4: rts
+bne L9
+mov r7, r7
+red r1
+L9: red r7
+cmp DAT[k], #-2
+jmp L6
+L6: prn r1
+ inc r6
+inc r6
+cmp DAT[k], #k
+L10: mov r2, r2
+L7: red r7
+ dec DAT
+dec DAT
+mov r1, r4
+clr L1
+bne L6
+jmp L3
+L3: inc r2
+bne L5
+ dec r6
+L2: inc r6
+inc r4
+red r6
+jmp L2
+mov r1, r1
+inc r0
+jmp L0
+L0: rts
+; comment
+L8: cmp r5, #-2
+red r1
+red r3
+red r4
+cmp L6, r6
+jmp L1
+red r3
+mov r2, r2
+mov r4, r6
+mov r5, r3
+sub #4, r3
+ inc L5
+inc L5
+red r4
+
+cmp DAT[k], #-2
+cmp r6, #-2
+jmp L4
+ hlt
+L5: hlt
+DAT: .data 1, 2, 3, k
+.entry L1
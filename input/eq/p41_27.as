@@ -0,0 +1,75 @@
+.define k = 3
+.extern X1
+bne L4
+L1: cmp L4, #-2
+cmp DAT[1], L6
+bne L5
+L11: inc r5
+mov r6, r0
+jmp L2
+L2: rts
+red r2
+bne L7
+ inc L6
+dec L6
+ dec r2
+dec r2
+mov r3, r3
+ inc r5
+inc r5
+prn #k
+cmp r1, #-2
+ inc NOPE
+inc NOPE
+cmp L1, r6
+sub #4, r3
+
+jmp L3
+L3: prn r1
+; comment
+L0: cmp r4, r7
+ inc r7
+L8: dec r7
+red r4
+jmp L2
+jmp L0
+L9: jmp L1
+mov r1, r1
+L5: cmp L0, #1
+jmp L7
+red r3
+L10: dec L3
+L6: cmp r5, r6
+cmp r0, #-2
+L7: jmp L7
+dec L7
+ dec r1
+dec r1
+sub #4, r3
+bne L8
+jmp L3
+ dec r2
+dec r2
+
+L4: jmp L0
+cmp r2, DAT[2]
+red r4
+
+prn #k
+clr L1
+bne L2
+prn #k
+; comment
+ inc r1
+inc r1
+
+cmp r4, #k
+mov r2, r2
+cmp DAT[2], r6
+mov r6, r6
+red r6
+ inc r1
+dec r1
+sub #4, r3
+ hlt
+DAT: .data 1, 2, 3, k
@@ -0,0 +1,77 @@
+.define k = 3
+.extern X1
+ inc r4
+inc r4
+L7: jmp L4
+jmp L4
+dec NOPE
+L5: jmp L9
+jmp L6
+L6: rts
+ inc r5
+dec r5
+inc r5
+bne L9
+not r1
+mov r2, r2
+jmp L9
+L9: inc r2
+cmp DAT[zz], #k
+ dec L0
+dec L0
+jmp L9
+L0: jmp L6
+; comment
+inc r7
+dec r4
+ dec r7
+inc r7
+clr L1
+cmp L1, #-2
+mov r0, r0
+jmp L2
+L11: red r4
+red r3
+mov r3, r3
+bne L3
+ dec r2
+dec r2
+L1: cmp r7, r0
+inc L4
+jmp L2
+L2: inc r2
+ inc DAT[zz]
+dec DAT[zz]
+jmp L3
+jmp L9
+cmp r0, r2
+cmp r3, #k
+ inc r6
+dec r6
+cmp DAT, #k
+jmp L2
+cmp r6, r5
+ dec r1
+inc r1
+cmp r4, #-2
+L10: cmp r5, #-2
+mov r5, r5
+cmp r0, r1
+bne L9
+ dec r0
+L4: inc r0
+L8: red r0
+red r5
+; comment
+cmp r5, r5
+jmp L5
+jmp L1
+L3: red r3
+jmp L7
+jmp L6
+jmp L7
+red r2
+inc r6
+ hlt
+DAT: .data 1, 2, 3, k
+.entry L1
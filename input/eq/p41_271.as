@@ -0,0 +1,70 @@
+.define k = 3
+.extern X1
+dec L5
+L6: mov r6, r6
+; comment
+add r1, r2
+mov r7, r7
+cmp r2, #-2
+L8: cmp L4, #1
+red r3
+cmp r6, #1
+
+L4: inc r6
+mov r5, r4
+L11: red r6
+ dec r1
+inc r1
+mov r0, r0
+mov r5, r5
+L9: inc X1
+dec r1
+; comment
+red r7
+L1: inc L0
+cmp r1, #1
+L3: clr L1
+mov r4, r4
+jmp L0
+L7: red r4
+mov r2, r2
+not r1
+L2: mov r6, r6
+ dec r7
+L10: dec r7
+L5: cmp L2, DAT[2]
+ dec L6
+L0: inc L6
+cmp r4, #1
+dec r6
+prn #k
+cmp r4, #1
+jmp L3
+jmp L6
+red r1
+cmp r0, #-2
+ inc DAT[2]
+dec DAT[2]
+; comment
+jmp L6
+red r5
+ dec r5
+dec r5
+mov r3, r3
+not r1
+cmp r6, r4
+jmp L2
+prn #k
+sub #4, r3
+inc DAT[1]
+cmp DAT, #-2
+red r7
+mov r2, r2
+mov r7, r7
+; comment
+mov r7, r7
+bne L8
+red r4
+ hlt
+DAT: .data 1, 2, 3, k
+.entry L0
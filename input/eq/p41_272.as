@@ -0,0 +1,80 @@
+.define k = 3
+.extern X1
+ dec L7
+dec L7
+cmp L5, DAT[1]
+mov r3, r3
+cmp L3, #-2
+inc r6
+L1: bne L2
+dec r7
+red r0
+cmp DAT[1], L0
+jmp L2
+mov r2, r2
+L6: cmp L4, #-2
+; comment
+mov r3, r3
+mov r7, r7
+cmp DAT[2], #k
+cmp L0, #k
+mov r3, r3
+dec r6
+dec L4
+ inc r2
+dec r2
+ inc r3
+inc r3
+cmp DAT[k], #1
+bne L2
+; comment
+cmp r5, #1
+red r7
+cmp L3, #k
+mov r2, r2
+sub #4, r3
+inc r3
+prn #k
+dec r0
+mov r0, r0
+ dec r1
+dec r1
+mov r4, r4
+lea DAT, r2
+
+mov r7, r7
+ dec r6
+inc r6
+ inc r1
+dec r1
+L2: cmp DAT[k], #k
+L3: dec r3
+ dec r2
+inc r2
+red r2
+ inc L6
+L5: dec L6
+; comment
+ dec r7
+L11: dec r7
+mov r6, r6
+ inc DAT[2]
+dec DAT[2]
+bne L5
+mov r2, r2
+dec L5
+not r1
+L9: cmp DAT[2], #-2
+ inc DAT[2]
+inc DAT[2]
+red r2
+bne L3
+mov r5, r2
+bne L6
+ hlt
+L0: hlt
+L4: hlt
+L7: hlt
+L8: hlt
+DAT: .data 1, 2, 3, k
+.entry L1
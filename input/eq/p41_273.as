@@ -0,0 +1,72 @@
+.define k = 3
+.extern X1
+L10: jmp L4
+mov r1, r1
+inc L4
+cmp r2, #k
+L9: jmp L0
+L6: mov r4, r2
+jmp L3
+red r2
+; comment
+jmp L5
+cmp DAT[k], #-2
+mov r0, r0
+red r6
+jmp L8
+L8: rts
+add r1, r2
+jmp L0
+L0: rts
+inc L0
+inc DAT[2]
+ inc r1
+inc r1
+L7: red r0
+cmp r1, DAT[2]
+not r1
+L5: mov r0, r0
+L1: cmp L6, #1
+red r1
+lea DAT, r2
+jmp L1
+ dec DAT[2]
+dec DAT[2]
+ inc L5
+L3: dec L5
+inc r4
+mov r1, r1
+bne L3
+cmp r0, #k
+ dec r7
+dec r7
+inc r5
+ inc L0
+inc L0
+red r2
+L11: mov r3, r5
+L2: clr L1
+L4: cmp r7, L6
+mov r3, r3
+jmp L6
+mov r5, r5
+mov r1 r2
+jmp L8
+jmp L7
+mov r0, r0
+dec DAT[1]
+ dec r5
+inc r5
+jmp L8
+inc L1
+
+mov r4, r4
+bne L6
+red r1
+; comment
+red r1
+jmp L4
+dec DAT[2]
+dec L1
+ hlt
+DAT: .data 1, 2, 3, k
@@ -0,0 +1,75 @@
+.define k = 3
+.extern X1
+ dec DAT[1]
+L5: inc DAT[1]
+ dec r6
+L7: dec r6
+bne L5
+not r1
+jmp L8
+red r1
+bne L1
+L6: red r2
+not r1
+cmp r3, #k
+jmp L9
+L9: hlt
+; comment
+bne L6
+jmp L2
+L2: inc r2
+bne L3
+ inc L4
+dec L4
+sub #4, r3
+dec DAT[k]
+red r5
+L3: jmp L5
+not r1
+L4: mov r7, r7
+jmp L6
+
+; comment
+L1: red r7
+cmp r6, #k
+L0: 
+; comment
+add r1, r2
+L11: cmp r3, r3
+L10: mov r6, r6
+ dec r2
+dec r2
+cmp r4, #1
+dec r2
+cmp DAT[1], #k
+cmp r3, #-2
+ inc L3
+inc L3
+cmp L2, #-2
+cmp r5, #1
+L8: red r1
+ dec L5
+dec L5
+mov r7, r7
+bne L1
+mov r1, r1
+bne L1
+not r1
+inc DAT[1]
+red r5
+jmp L3
+cmp DAT[2], #1
+mov r4, r4
+sub #4, r3
+mov r1, r1
+ dec r7
+dec r7
+cmp r3, #k
+jmp L5
+ dec r5
+inc r5
+ inc r5
+inc r5
+mov r7, r6
+ hlt
+DAT: .data 1, 2, 3, k
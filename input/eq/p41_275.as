@@ -0,0 +1,73 @@
+.define k = 3
+.extern X1
+; comment
+dec r2
+mov r5, r5
+jmp L6
+cmp DAT, #-2
+; comment
+dec DAT[2]
+cmp r1, r6
+; comment
+L9: ; comment
+cmp r3, #1
+ inc r4
+dec r4
+L7: cmp L6, #k
+inc r2
+clr L1
+L10: jmp L7
+ inc r7
+inc r7
+cmp r3, #k
+mov r5, r5
+mov r3, r3
+mov r1, r1
+cmp r6, #1
+jmp L1
+L1: inc r2
+mov r2, r2
+jmp L5
+L5: rts
+dec DAT[k]
+cmp r1, r2
+cmp r5, #k
+prn #k
+prn #k
+inc L5
+L8: bne L7
+mov r7, r3
+lea DAT, r2
+cmp r6, #1
+mov r4, r4
+jmp L6
+L2: red r1
+bne L3
+L0: mov r7, r7
+cmp r4, #-2
+dec r2
+ dec DAT[1]
+L11: inc DAT[1]
+jmp L2
+mov r1, r1
+lea DAT, r2
+inc r4
+jmp L9
+cmp r0, #1
+ dec DAT[k]
+dec DAT[k]
+ inc DAT[1]
+L4: inc DAT[1]
+L3: add r1, r2
+mov r4, r4
+cmp r1, #1
+cmp L5, #1
+dec r0
+; comment
+mov r4, r4
+jmp L3
+mov r6, r6
+ hlt
+L6: hlt
+DAT: .data 1, 2, 3, k
+.entry L0
@@ -0,0 +1,72 @@
+.define k = 3
+.extern X1
+cmp DAT[2], r0
+L7: cmp r6, #-2
+L11: 
+L6: jmp L7
+red r7
+inc r7
+L4: 
+jmp L7
+red r4
+L9: jmp L4
+mov r7, r7
+cmp r0, r0
+L1: mov r6, r6
+mov r5, r5
+cmp L2, #-2
+ dec r1
+L8: inc r1
+mov r7, r1
+cmp L7, #1
+mov r5, r5
+lea DAT, r2
+clr L1
+bne L6
+L2: mov r2, r2
+jmp L8
+
+red r1
+jmp L3
+ dec r5
+L5: dec r5
+jmp L5
+jmp L2
+L10: cmp r0, #k
+jmp L2
+ inc r0
+L0: dec r0
+ dec r4
+dec r4
+mov r3, r3
+ inc r7
+dec r7
+L3: jmp L0
+
+ inc r1
+inc r1
+bne L5
+red r0
+red r5
+red r0
+bne L9
+ dec L0
+dec L0
+red r0
+red r5
+cmp L7, #-2
+mov r1, r1
+mov r1 r2
+
+mov r2, r0
+ dec DAT[zz]
+dec DAT[zz]
+jmp L6
+mov r6, r3
+; comment
+cmp r3, #-2
+jmp L5
+red r5
+mov r5, r4
+ hlt
+DAT: .data 1, 2, 3, k
@@ -0,0 +1,73 @@
+.define k = 3
+.extern X1
+red r3
+cmp DAT[1], #-2
+; comment
+
+mov r2, r2
+L7: jmp L0
+L0: rts
+mov r6, r6
+clr L1
+red r6
+L8: mov r1, r1
+red r5
+mov r6, r6
+mov r1, r1
+L10: dec DAT[k]
+ dec r5
+inc r5
+ dec r7
+L6: inc r7
+jmp L9
+bne L0
+inc L4
+jmp L0
+cmp L7, r3
+clr L1
+mov r6, r6
+L2: inc r1
+jmp L1
+L1: hlt
+jmp L2
+prn #k
+mov r7, r7
+inc r7
+clr L1
+ inc r0
+dec r0
+red r5
+prn #k
+jmp L9
+L9: prn r1
+L3: jmp L7
+dec r5
+mov r6, r6
+L4: clr L1
+L5: cmp r4, #-2
+red r7
+mov r6, r6
+ dec L7
+inc L7
+prn #k
+sub #4, r3
+cmp r1, #1
+sub #4, r3
+bne L4
+jmp L5
+cmp r2, #-2
+inc r7
+cmp r0, r7
+inc r2
+cmp r0, r7
+L11: mov r2, r2
+ dec r2
+dec r2
+prn #k
+add r1, r2
+mov r1, r1
+cmp DAT[1], #-2
+; comment
+ hlt
+DAT: .data 1, 2, 3, k
+.entry L0
@@ -0,0 +1,77 @@
+.define k = 3
+.extern X1
+ dec r7
+inc r7
+add r1, r2
+jmp L1
+mov r6, r5
+mov r2, r7
+mov r1, r1
+bne L6
+mov r6, r6
+jmp L1
+L1: prn r1
+cmp r4, #k
+red r2
+L0: red r6
+mov r6, r6
+bne L7
+L7: not r1
+ inc r1
+dec r1
+dec r7
+L2: cmp r2, L0
+red r0
+sub #4, r3
+cmp r7, #-2
+ dec r0
+inc r0
+ dec r1
+L5: inc r1
+
+red r6
+cmp L2, #-2
+ inc r2
+inc r2
+cmp r5, #k
+jmp L2
+red r2
+mov r5, r5
+cmp DAT[2], #-2
+lea DAT, r2
+red r2
+cmp r3, DAT[2]
+jmp L8
+L8: rts
+mov r6, r0
+jmp L9
+jmp L5
+jmp L3
+L3: hlt
+cmp DAT[k], #-2
+mov r7, r7
+red r3
+mov r1, r1
+
+; comment
+ inc L7
+inc L7
+ inc r7
+L9: inc r7
+mov r5, r2
+red r3
+; comment
+jmp L3
+mov r4, r4
+L11: mov r4, r4
+cmp DAT[k], #1
+ inc DAT[2]
+dec DAT[2]
+red r1
+mov r3, r3
+red r0
+clr L1
+ hlt
+L4: hlt
+L6: hlt
+DAT: .data 1, 2, 3, k
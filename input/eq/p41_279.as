@@ -0,0 +1,72 @@
+.define k = 3
+.extern X1
+add r1, r2
+red r5
+L9: cmp r1, #k
+L8: cmp DAT[zz], r2
+L10: red r5
+mov r7, r7
+inc r3
+cmp DAT[1], #-2
+jmp L8
+dec r6
+; comment
+L11: 
+ dec DAT[1]
+inc DAT[1]
+red r5
+mov r1, r1
+L6: bne L8
+L4: cmp L6, r5
+red r7
+
+inc r1
+L3: dec DAT[k]
+jmp L0
+jmp L7
+L7: inc r2
+L5: cmp DAT[k], #1
+red r5
+L1: mov r4, r4
+ dec r0
+inc r0
+jmp L4
+dec L5
+L0: cmp r3, r3
+L2: sub #4, r3
+cmp r2, #k
+clr L1
+jmp L1
+prn #k
+clr L1
+mov r7, r7
+jmp L6
+mov r1, r0
+dec r0
+cmp r2, #k
+ dec DAT[k]
+dec DAT[k]
+ inc L3
+inc L3
+bne L1
+cmp L2, r3
+prn #k
+dec r6
+jmp L2
+mov r1 r2
+ dec r6
+dec r6
+jmp L7
+ inc r2
+inc r2
+
+mov r3, r3
+jmp L7
+jmp L2
+mov r5, r5
+mov r6, r6
+mov r1, r1
+mov r7, r7
+ hlt
+DAT: .data 1, 2, 3, k
+.entry L2
@@ -0,0 +1,71 @@
+.define k = 3
+.extern X1
+L2: jmp L2
+sub #4, r3
+ inc DAT[1]
+dec DAT[1]
+mov r5, r5
+cmp r4, #-2
+red r4
+cmp L4, DAT[2]
+cmp r6, #k
+L5: 
+jmp L2
+jmp L8
+L8: hlt
+mov r5, r5
+red r1
+red r7
+jmp L7
+L7: rts
+cmp r4, #1
+L10: bne L4
+; comment
+jmp L0
+bne L1
+cmp r2, r4
+L11: sub #4, r3
+red r7
+red r7
+red r6
+inc L5
+jmp L8
+L3: red r1
+inc r7
+L1: red r2
+; comment
+mov r2, r2
+mov r0, r0
+L9: mov r4, r4
+dec r0
+cmp r1, #1
+jmp L8
+jmp L7
+cmp DAT[k], L3
+L4: jmp L5
+jmp L8
+ dec L3
+inc L3
+jmp L5
+bne L0
+L6: jmp L7
+bne L4
+cmp r7, r1
+cmp X1, #-2
+jmp L1
+ inc r4
+dec r4
+cmp L2, #-2
+mov r4, r4
+cmp r7, r6
+jmp L9
+lea DAT, r2
+mov r6, r6
+; comment
+ inc L0
+L0: inc L0
+inc DAT[k]
+cmp DAT[1], #k
+ hlt
+DAT: .data 1, 2, 3, k
+.entry L0
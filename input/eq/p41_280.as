@@ -0,0 +1,75 @@
+.define k = 3
+.extern X1
+bne L1
+cmp X1, DAT[1]
+mov r3, r7
+jmp L6
+dec r4
+add r1, r2
+L7: bne L2
+ dec r7
+dec r7
+mov r5, r5
+red r0
+L0: jmp L5
+L2: not r1
+L5: cmp r6, #k
+ dec r4
+inc r4
+cmp r1, #1
+; comment
+jmp L0
+mov r2, r7
+ inc r0
+L1: inc r0
+jmp L5
+jmp L2
+add r1, r2
+ dec r0
+L10: dec r0
+bne L5
+not r1
+mov r0, r0
+mov r0, r0
+red r1
+dec DAT[1]
+L6: jmp L7
+red r6
+cmp L4, #k
+L8: red r2
+bne L8
+ inc L7
+inc L7
+jmp L0
+mov r3, r3
+mov r5, r5
+jmp L6
+; comment
+red r2
+bne L7
+dec r1
+L3: cmp r7, #1
+ inc L6
+L4: inc L6
+cmp r3, #1
+ dec r3
+L11: dec r3
+cmp DAT[2], #-2
+sub #4, r3
+bne L9
+mov r7, r7
+ inc L0
+inc L0
+ dec r0
+dec r0
+L9: cmp DAT[2], r0
+jmp L3
+bne L9
+cmp r4, #1
+inc r5
+ dec r1
+dec r1
+ inc r4
+inc r4
+ hlt
+DAT: .data 1, 2, 3, k
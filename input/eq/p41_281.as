@@ -0,0 +1,73 @@
+.define k = 3
+.extern X1
+L4: mov r7, r3
+mov r4, r4
+inc L2
+L5: mov r7, r2
+cmp X1, #1
+mov r4, r4
+jmp L2
+L9: jmp L5
+bne L6
+bne L5
+jmp L6
+L6: hlt
+bne L4
+ inc r6
+dec r6
+L3: cmp r5, r2
+bne L9
+ dec r4
+dec r4
+; comment
+L2: mov r3, r3
+red r6
+red r2
+ inc L6
+inc L6
+not r1
+add r1, r2
+lea DAT, r2
+jmp L8
+L8: hlt
+L7: mov r1, r4
+mov r1, r1
+L11: cmp r3, DAT[2]
+L0: ; comment
+jmp L2
+red r1
+cmp L5, r1
+L1: dec L5
+mov r2, r7
+L10: inc r1
+bne L7
+cmp r1, #-2
+ inc r7
+inc r7
+bne L8
+ dec r4
+inc r4
+add r1, r2
+jmp L9
+dec r2
+bne L3
+mov r5, r6
+cmp L7, #1
+jmp L5
+cmp r6, #1
+jmp L0
+mov r1, r1
+ dec r4
+dec r4
+prn #k
+cmp r3, r3
+jmp L4
+jmp L5
+dec r3
+jmp L4
+not r1
+bne L6
+not r1
+ hlt
+DAT: .data 1, 2, 3, k
+.entry L1
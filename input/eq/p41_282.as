@@ -0,0 +1,69 @@
+.define k = 3
+.extern X1
+red r7
+
+ dec r3
+dec r3
+bne L7
+not r1
+L4: cmp DAT[zz], #-2
+ inc r4
+inc r4
+cmp DAT[2], #k
+L6: cmp r4, #k
+cmp DAT[1], #-2
+mov r4, r5
+L0: ; comment
+inc DAT[1]
+inc r3
+mov r0, r0
+L9: bne L8
+mov r7, r7
+ dec r2
+dec r2
+cmp r1, #-2
+cmp DAT[1], #-2
+jmp L9
+mov r7, r7
+L10: mov r4, r4
+bne L1
+L3: dec r2
+cmp r5, #1
+L2: mov r7, r7
+red r4
+L5: mov r7, r7
+inc r7
+cmp DAT[k], #-2
+cmp L7, #1
+sub #4, r3
+cmp r4, #-2
+mov r7, r7
+L1: jmp L4
+cmp L3, r3
+mov r4, r4
+
+dec r5
+mov r6, r6
+red r2
+inc r3
+
+L11: jmp L2
+cmp r0, r5
+cmp r3, #1
+cmp r3, #k
+mov r0, r0
+cmp L0, #k
+red r4
+
+bne L7
+cmp DAT[2], #1
+cmp r0, #1
+ dec r2
+dec r2
+L7: bne L5
+jmp L8
+red r0
+red r0
+ hlt
+L8: hlt
+DAT: .data 1, 2, 3, k
@@ -0,0 +1,76 @@
+.define k = 3
+.extern X1
+mov r4, r7
+jmp L6
+L6: rts
+jmp L0
+L0: rts
+ dec r3
+dec r3
+L8: jmp L1
+L1: inc r2
+ dec r2
+L3: inc r2
+inc r1
+cmp r5, #k
+mov r2, r2
+mov r0, r0
+L4: jmp L3
+jmp L9
+cmp L4, #-2
+L7: cmp r1, #k
+cmp DAT[1], #-2
+dec r1
+; comment
+; comment
+mov r7, r2
+mov r5, r5
+jmp L2
+ inc r7
+dec r7
+L11: sub #4, r3
+jmp L8
+cmp L5, #k
+cmp r3, #-2
+; comment
+cmp r4, #1
+jmp L4
+mov r7, r6
+L9: mov r1, r1
+inc r1
+red r7
+mov r6, r6
+red r4
+not r1
+cmp r6, #1
+dec r6
+cmp L0, #-2
+mov r4, r4
+inc DAT[k]
+L10: cmp L3, #1
+cmp DAT[1], #-2
+ dec r3
+L5: dec r3
+cmp r5, r0
+jmp L2
+L2: prn r1
+cmp L7, #-2
+dec DAT[1]
+jmp L2
+not r1
+; comment
+red r3
+ inc r3
+dec r3
+ dec r4
+dec r4
+ inc DAT[2]
+inc DAT[2]
+clr L1
+add r1, r2
+ inc r2
+dec r2
+red r4
+red r3
+ hlt
+DAT: .data 1, 2, 3, k
@@ -0,0 +1,71 @@
+.define k = 3
+.extern X1
+ inc r4
+L4: inc r4
+L6: ; comment
+L11: sub #4, r3
+jmp L4
+ dec DAT[2]
+L2: dec DAT[2]
+ inc r1
+inc r1
+ inc r3
+inc r3
+lea DAT, r2
+mov r2, r3
+bne L6
+red r3
+
+cmp DAT[k], #1
+cmp r0, #k
+L8: red r3
+mov r2, r2
+mov r0, r0
+add r1, r2
+cmp DAT[2], DAT[2]
+red r3
+red r6
+ inc r2
+L7: dec r2
+bne L6
+red r7
+L5: cmp r5, #k
+L1: cmp r2, #1
+jmp L4
+jmp L2
+red r3
+jmp L6
+jmp L9
+L9: rts
+jmp L3
+not r1
+red r4
+L3: clr L1
+red r4
+jmp L3
+mov r0, r0
+not r1
+cmp r0, #k
+jmp L8
+prn #k
+L0: cmp r6, #-2
+cmp r2, #-2
+L10: lea DAT, r2
+mov r5, r5
+red r0
+cmp DAT[k], #1
+ dec r3
+dec r3
+mov r3, r3
+
+red r5
+red r7
+cmp X1, #k
+
+jmp L9
+cmp r5, #k
+inc r1
+red r2
+red r4
+ hlt
+DAT: .data 1, 2, 3, k
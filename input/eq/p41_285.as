@@ -0,0 +1,73 @@
+.define k = 3
+.extern X1
+ dec L1
+dec L1
+L7: 
+bne L2
+mov r1 r2
+ inc r3
+L9: dec r3
+sub #4, r3
+mov r7, r7
+jmp L7
+jmp L7
+cmp r2, #-2
+; comment
+L8: jmp L4
+L4: prn r1
+cmp L5, #k
+dec X1
+add r1, r2
+red r0
+cmp r2, #1
+cmp NOPE, DAT[1]
+lea DAT, r2
+L3: bne L0
+cmp r1, L2
+dec r2
+jmp L3
+L6: cmp r2, #-2
+mov r3, r3
+jmp L1
+L1: rts
+inc r7
+ inc r5
+inc r5
+ dec r6
+dec r6
+mov r6, r4
+mov r1, r5
+L2: bne L3
+L11: red r4
+L0: dec r6
+mov r1 r2
+jmp L5
+L5: hlt
+bne L8
+inc DAT[zz]
+ dec L6
+inc L6
+L10: mov r0, r0
+bne L9
+ inc r4
+dec r4
+jmp L5
+mov r2, r2
+jmp L8
+cmp r0, #1
+mov r1, r1
+red r2
+mov r4, r4
+cmp r0, #-2
+jmp L2
+red r6
+jmp L6
+cmp r4, #k
+jmp L7
+red r6
+red r7
+inc r4
+lea DAT, r2
+jmp L5
+ hlt
+DAT: .data 1, 2, 3, k
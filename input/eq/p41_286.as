@@ -0,0 +1,79 @@
+.define k = 3
+.extern X1
+ dec r6
+inc r6
+ inc DAT[2]
+dec DAT[2]
+mov r2, r6
+bne L1
+L0: inc L2
+mov r5, r5
+dec r4
+cmp r6, #k
+jmp L0
+ dec r2
+dec r2
+cmp L2, #1
+mov r1, r1
+jmp L7
+L7: rts
+
+ inc r4
+inc r4
+jmp L6
+ inc r0
+dec r0
+L2: mov r6, r6
+red r2
+L3: mov r6, r6
+ dec r3
+inc r3
+L11: cmp X1, #k
+mov r1, r1
+dec r6
+ dec r6
+inc r6
+prn #k
+bne L4
+cmp r1, #-2
+
+cmp DAT[1], #k
+mov r0, r0
+red r6
+mov r7, r7
+; comment
+jmp L7
+; comment
+bne L8
+cmp r2, r5
+red r6
+cmp r3, #-2
+bne L3
+mov r0, r0
+jmp L6
+mov r7, r7
+ inc r0
+dec r0
+red r1
+; comment
+L6: inc L6
+L8: mov r7, r7
+ inc r0
+inc r0
+jmp L5
+L5: hlt
+jmp L7
+jmp L1
+L1: prn r1
+mov r4, r4
+mov r3, r5
+ inc L0
+inc L0
+L4: sub #4, r3
+red r1
+prn #k
+jmp L7
+ hlt
+L9: hlt
+DAT: .data 1, 2, 3, k
+.entry L1
@@ -0,0 +1,71 @@
+.define k = 3
+.extern X1
+dec r2
+mov r5, r5
+add r1, r2
+prn #k
+prn #k
+L10: dec r7
+cmp r6, #k
+L6: red r6
+bne L8
+cmp r1, #k
+cmp DAT[2], #-2
+jmp L6
+jmp L7
+bne L2
+lea DAT, r2
+mov r4, r4
+ inc r1
+dec r1
+mov r4, r4
+cmp r4, #1
+jmp L9
+L9: prn r1
+jmp L7
+L7: inc r2
+; comment
+jmp L9
+red r2
+; comment
+L11: red r2
+mov r5, r5
+red r7
+mov r6, r0
+cmp r1, #1
+cmp r3, #k
+cmp r6, #1
+cmp DAT[k], #k
+ dec X1
+inc X1
+jmp L5
+bne L0
+L0: cmp r0, #1
+ dec r4
+inc r4
+lea DAT, r2
+red r2
+mov r2, r2
+L1: mov r5, r2
+red r6
+cmp r1, r0
+cmp r5, #1
+cmp DAT[1], #k
+sub #4, r3
+L4: bne L7
+dec r1
+jmp L4
+L2: cmp r3, #k
+; comment
+L3: cmp r7, r0
+L8: cmp DAT[2], r6
+jmp L9
+red r0
+L5: red r1
+ dec DAT[k]
+dec DAT[k]
+clr L1
+cmp r7, r3
+ hlt
+DAT: .data 1, 2, 3, k
+.entry L2
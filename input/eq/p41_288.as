@@ -0,0 +1,75 @@
+.define k = 3
+.extern X1
+cmp r7, #1
+red r7
+L7: cmp L5, #k
+ dec L2
+dec L2
+cmp r1, #1
+L9: bne L7
+mov r3, r3
+not r1
+; comment
+not r1
+jmp L9
+dec r4
+prn #k
+ inc r1
+dec r1
+mov r7, r3
+mov r5, r6
+mov r2, r2
+bne L9
+ dec DAT[1]
+dec DAT[1]
+jmp L1
+L1: prn r1
+mov r1 r2
+red r0
+red r7
+jmp L0
+L0: hlt
+mov r6, r4
+jmp L1
+inc L2
+jmp L1
+ inc NOPE
+dec NOPE
+L11: mov r4, r4
+red r4
+ dec DAT[k]
+L10: inc DAT[k]
+not r1
+mov r0, r0
+L5: cmp r5, DAT
+inc r6
+cmp r2, #1
+bne L3
+bne L4
+inc r5
+bne L9
+red r6
+sub #4, r3
+mov r1 r2
+red r1
+cmp r4, #k
+dec r7
+cmp L0, #-2
+ dec DAT[k]
+inc DAT[k]
+red r7
+L4: bne L5
+mov r7, r7
+L8: cmp L2, r3
+red r7
+mov r4, r4
+inc r0
+ inc DAT[1]
+L2: dec DAT[1]
+red r1
+jmp L2
+L6: bne L9
+ hlt
+L3: hlt
+DAT: .data 1, 2, 3, k
+.entry L1
@@ -0,0 +1,71 @@
+.define k = 3
+.extern X1
+cmp L1, r0
+red r6
+mov r0, r0
+ inc r1
+inc r1
+L2: jmp L0
+L0: hlt
+cmp L0, r2
+dec DAT[1]
+L4: mov r7, r7
+bne L5
+bne L0
+red r0
+jmp L1
+red r6
+ inc r0
+dec r0
+ inc r5
+L5: dec r5
+cmp DAT[k], #1
+mov r6, r6
+
+
+mov r1, r2
+mov r5, r5
+inc r2
+dec r6
+L6: cmp r7, r4
+L11: mov r6, r6
+L9: ; comment
+L7: cmp DAT[k], #k
+L1: cmp L7, #-2
+ inc r5
+inc r5
+jmp L8
+L8: inc r2
+jmp L8
+L10: cmp r5, #k
+mov r6, r1
+mov r0, r0
+mov r5, r0
+; comment
+red r2
+red r5
+jmp L6
+sub #4, r3
+red r5
+red r2
+; comment
+cmp DAT[2], #k
+bne L2
+red r7
+
+jmp L3
+L3: red r2
+cmp L0, #1
+
+red r6
+mov r7, r7
+jmp L0
+cmp r5, #1
+ inc L0
+dec L0
+; comment
+dec r3
+jmp L7
+; comment
+ hlt
+DAT: .data 1, 2, 3, k
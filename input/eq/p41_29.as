@@ -0,0 +1,72 @@
+.define k = 3
+.extern X1
+ inc DAT[k]
+dec DAT[k]
+mov r0, r0
+cmp r7, #-2
+cmp r6, #-2
+dec r3
+mov r4, r7
+jmp L1
+
+bne L1
+cmp L6, #k
+
+jmp L3
+ dec r2
+L0: inc r2
+red r0
+ inc r0
+inc r0
+ dec r3
+L8: inc r3
+L3: 
+inc r3
+; comment
+L2: clr L1
+cmp r0, #k
+cmp r1, r6
+red r5
+cmp r7, #k
+L11: red r7
+jmp L7
+L7: prn r1
+L1: red r7
+L10: red r7
+mov r4, r4
+cmp r2, #k
+ inc r3
+dec r3
+inc r4
+clr L1
+L6: mov r1, r3
+mov r5, r5
+cmp r5, DAT[2]
+bne L5
+
+jmp L2
+cmp r3, r3
+cmp r7, #-2
+cmp DAT[k], #-2
+sub #4, r3
+bne L3
+cmp L0, #-2
+L9: jmp L9
+jmp L1
+mov r4, r4
+bne L5
+jmp L2
+mov r6, r6
+L5: bne L3
+jmp L5
+cmp r0, #k
+mov r0, r0
+jmp L2
+red r5
+cmp DAT[1], #-2
+ inc L4
+L4: dec L4
+jmp L2
+ hlt
+DAT: .data 1, 2, 3, k
+.entry L1
@@ -0,0 +1,76 @@
+.define k = 3
+.extern X1
+ inc r0
+dec r0
+L1: ; comment
+red r6
+red r4
+L8: red r2
+jmp L9
+jmp L4
+L4: prn r1
+cmp r6, #1
+mov r0, r0
+red r2
+jmp L1
+add r1, r2
+bne L2
+inc r4
+L5: inc DAT[2]
+cmp r2, #1
+red r1
+inc r0
+inc DAT[1]
+mov r3, r3
+ dec r4
+dec r4
+red r6
+ inc r1
+dec r1
+L3: mov r1, r5
+L2: 
+red r6
+L11: cmp r5, #k
+mov r0, r0
+jmp L3
+red r4
+ inc L6
+dec L6
+jmp L7
+L7: rts
+jmp L9
+L9: inc r2
+inc r5
+red r5
+jmp L5
+cmp L3, #1
+jmp L6
+L6: hlt
+dec L0
+mov r6, r6
+red r4
+jmp L5
+cmp DAT[2], r6
+jmp L0
+dec DAT[2]
+jmp L9
+ dec r7
+dec r7
+jmp L5
+bne L2
+mov r7, r7
+red r7
+ inc r3
+inc r3
+L0: red r4
+cmp L4, #-2
+lea DAT, r2
+jmp L2
+ inc r3
+L10: dec r3
+ inc r2
+inc r2
+cmp r1, #1
+red r0
+ hlt
+DAT: .data 1, 2, 3, k
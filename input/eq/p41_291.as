@@ -0,0 +1,73 @@
+.define k = 3
+.extern X1
+clr L1
+inc L7
+lea DAT, r2
+
+jmp L5
+L5: rts
+clr L1
+inc DAT[2]
+L3: cmp DAT[1], #-2
+ dec L0
+L8: inc L0
+L2: 
+red r7
+jmp L0
+red r6
+L10: cmp r6, #k
+jmp L1
+L1: prn r1
+red r7
+red r7
+L11: bne L9
+clr L1
+inc L6
+prn #k
+L9: mov r1, r1
+mov r2, r2
+cmp r3, #-2
+mov r1, r1
+ inc r4
+L7: dec r4
+mov r6, r0
+L6: red r6
+bne L9
+prn #k
+L0: inc r0
+L4: cmp r4, #k
+jmp L1
+cmp r4, #k
+clr L1
+ dec r7
+dec r7
+dec DAT[k]
+ inc r5
+inc r5
+cmp r5, #-2
+red r4
+mov r2, r7
+red r3
+red r7
+red r1
+cmp r1, #1
+add r1, r2
+red r7
+jmp L2
+jmp L1
+red r1
+jmp L1
+mov r3, r3
+ inc L0
+inc L0
+; comment
+cmp r3, #1
+ inc r5
+dec r5
+jmp L6
+cmp r6, r7
+ inc r4
+inc r4
+jmp L7
+ hlt
+DAT: .data 1, 2, 3, k
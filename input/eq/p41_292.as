@@ -0,0 +1,75 @@
+.define k = 3
+.extern X1
+sub #4, r3
+dec r5
+ inc L1
+dec L1
+cmp r1, #-2
+L2: mov r4, r4
+L5: clr L1
+dec r1
+
+clr L1
+L0: jmp L0
+
+bne L7
+jmp L8
+dec r4
+prn #k
+bne L7
+; comment
+dec r7
+mov r0, r0
+red r2
+jmp L5
+ inc r3
+dec r3
+cmp r5, #-2
+L4: dec r0
+bne L0
+mov r5, r3
+bne L4
+
+red r2
+jmp L5
+inc r6
+cmp r5, #k
+dec L4
+ dec DAT[k]
+inc DAT[k]
+L11: bne L2
+red r5
+
+inc L1
+jmp L5
+mov r5, r5
+ dec r2
+dec r2
+ dec r1
+inc r1
+jmp L0
+bne L2
+red r1
+add r1, r2
+red r6
+; comment
+not r1
+red r1
+jmp L7
+L8: mov r5, r5
+cmp r4, #1
+red r2
+bne L2
+mov r1, r3
+bne L1
+mov r4, r4
+jmp L4
+red r0
+ hlt
+L1: hlt
+L3: hlt
+L6: hlt
+L7: hlt
+L9: hlt
+DAT: .data 1, 2, 3, k
+.entry L2
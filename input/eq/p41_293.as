@@ -0,0 +1,72 @@
+.define k = 3
+.extern X1
+mov r6, r6
+red r3
+L3: 
+L0: bne L8
+cmp r6, #-2
+red r2
+mov r2, r2
+L7: mov r3, r3
+cmp r1, #1
+mov r4, r4
+mov r4, r4
+jmp L3
+L4: cmp DAT, DAT[1]
+L8: jmp L2
+L2: prn r1
+L6: mov r7, r7
+red r6
+red r4
+inc L6
+L5: red r2
+cmp r4, #1
+L1: jmp L0
+inc L1
+mov r6, r0
+cmp r4, #1
+jmp L4
+L9: jmp L7
+ inc r0
+dec r0
+mov r2, r2
+cmp r2, #-2
+mov r6, r6
+ dec r4
+L11: inc r4
+L10: ; comment
+cmp r4, #1
+cmp L7, #1
+not r1
+red r7
+sub #4, r3
+ inc L2
+dec L2
+jmp L9
+bne L5
+jmp L6
+mov r7, r2
+
+mov r0, r7
+bne L3
+mov r1, r4
+red r2
+ inc r2
+inc r2
+ dec r0
+inc r0
+red r4
+jmp L8
+mov r6, r5
+ dec DAT[2]
+dec DAT[2]
+bne L0
+jmp L1
+mov r6, r6
+red r1
+red r7
+jmp L1
+mov r1, r3
+ hlt
+DAT: .data 1, 2, 3, k
+.entry L2
@@ -0,0 +1,79 @@
+.define k = 3
+.extern X1
+L7: red r1
+jmp L6
+L6: inc r2
+jmp L5
+L5: prn r1
+jmp L4
+L4: prn r1
+red r2
+jmp L3
+L3: rts
+bne L2
+cmp r3, #-2
+mov r7, r7
+L11: not r1
+L9: mov r1 r2
+mov r1 r2
+jmp L3
+jmp L1
+L1: rts
+jmp L4
+L8: bne L4
+; comment
+jmp L9
+cmp L0, #-2
+jmp L1
+inc r7
+cmp r6, #-2
+clr L1
+L2: mov r6, r6
+red r1
+ inc r2
+dec r2
+dec r1
+ inc NOPE
+inc NOPE
+cmp r7, #-2
+mov r0, r0
+jmp L1
+L10: bne L9
+dec r3
+mov r4, r4
+; comment
+mov r6, r6
+ dec r1
+dec r1
+mov r4, r4
+bne L1
+ dec DAT[k]
+inc DAT[k]
+ inc DAT[k]
+dec DAT[k]
+jmp L3
+not r1
+cmp L6, L1
+ inc L3
+dec L3
+; comment
+inc r5
+L0: red r7
+jmp L5
+ inc r6
+inc r6
+ dec DAT[k]
+inc DAT[k]
+add r1, r2
+jmp L8
+cmp r0, #-2
+
+jmp L9
+ dec r3
+inc r3
+dec r1
+ dec r3
+dec r3
+jmp L2
+ hlt
+DAT: .data 1, 2, 3, k
@@ -0,0 +1,71 @@
+.define k = 3
+.extern X1
+cmp DAT[k], DAT[2]
+L4: cmp r0, #k
+sub #4, r3
+
+mov r2, r2
+cmp r1, DAT[1]
+cmp r6, #1
+red r3
+ inc r0
+dec r0
+L9: cmp L3, #1
+add r1, r2
+jmp L9
+cmp r3, r3
+jmp L0
+L0: prn r1
+ dec r5
+dec r5
+bne L8
+cmp r3, #k
+L2: cmp L3, DAT[k]
+mov r0, r0
+jmp L9
+not r1
+cmp r4, #1
+bne L5
+red r0
+ dec L5
+L7: dec L5
+jmp L4
+ dec L3
+L10: dec L3
+dec r3
+red r3
+red r0
+cmp L3, #-2
+red r6
+mov r7, r7
+L11: dec DAT[k]
+mov r7, r5
+L6: red r0
+jmp L5
+L5: rts
+jmp L8
+lea DAT, r2
+red r3
+cmp DAT[2], #-2
+inc r7
+prn #k
+L1: mov r6, r6
+L8: bne L9
+red r0
+
+L3: jmp L5
+dec r1
+ inc r4
+inc r4
+cmp L1, #k
+not r1
+cmp DAT[1], #1
+; comment
+red r2
+mov r1, r1
+bne L2
+mov r4, r4
+inc DAT
+red r7
+ hlt
+DAT: .data 1, 2, 3, k
@@ -0,0 +1,73 @@
+.define k = 3
+.extern X1
+L4: dec DAT
+; comment
+; comment
+cmp r6, #k
+L10: cmp r3, r7
+jmp L3
+L3: prn r1
+L9: 
+jmp L4
+ inc L5
+inc L5
+red r0
+L1: jmp L9
+mov r0, r5
+jmp L1
+jmp L8
+mov r4, r4
+jmp L3
+red r5
+red r7
+bne L8
+bne L2
+jmp L6
+L5: dec r6
+jmp L8
+L8: inc r2
+L6: mov r2, r2
+
+bne L7
+cmp r7, #-2
+mov r4, r4
+cmp r3, #k
+jmp L7
+L0: jmp L0
+cmp L2, #k
+cmp r2, #-2
+cmp L1, #1
+mov r7, r7
+ inc r7
+dec r7
+
+sub #4, r3
+red r0
+red r3
+L7: jmp L1
+jmp L6
+ inc L1
+dec L1
+cmp r4, r3
+mov r0, r0
+ dec DAT[2]
+inc DAT[2]
+ dec L2
+inc L2
+ inc L7
+inc L7
+dec r1
+cmp r4, r6
+L2: bne L6
+cmp r4, #1
+mov r0, r0
+L11: bne L7
+jmp L5
+cmp r3, #1
+mov r7, r3
+jmp L9
+cmp r0, #k
+jmp L4
+ hlt
+DAT: .data 1, 2, 3, k
+.entry L0
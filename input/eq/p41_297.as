@@ -0,0 +1,69 @@
+.define k = 3
+.extern X1
+not r1
+L5: 
+L0: cmp r7, DAT[zz]
+jmp L8
+L8: prn r1
+L4: cmp r3, NOPE
+mov r6, r6
+cmp r2, #k
+prn #k
+jmp L2
+L2: hlt
+cmp r0, r7
+dec L1
+add r1, r2
+L11: cmp L3, #-2
+cmp r4, #1
+cmp DAT[1], #-2
+L1: mov r6, r6
+bne L1
+red r7
+cmp r1, #1
+lea DAT, r2
+mov r3, r3
+red r2
+bne L4
+jmp L9
+L9: rts
+ dec r2
+dec r2
+red r1
+jmp L9
+L7: cmp r1, #k
+L10: jmp L4
+L3: cmp r6, #-2
+red r5
+L6: jmp L9
+mov r1 r2
+jmp L9
+mov r4, r4
+bne L1
+cmp r0, #1
+jmp L4
+cmp r1, #-2
+prn #k
+dec r1
+cmp r6, r3
+inc r2
+; comment
+red r5
+mov r2, r2
+red r5
+mov r6, r6
+lea DAT, r2
+red r3
+red r3
+bne L3
+not r1
+jmp L0
+red r4
+red r3
+jmp L5
+
+mov r2, r2
+jmp L1
+ hlt
+DAT: .data 1, 2, 3, k
+.entry L0
@@ -0,0 +1,76 @@
+.define k = 3
+.extern X1
+jmp L2
+
+red r0
+jmp L2
+L2: inc r2
+
+jmp L9
+L11: jmp L0
+L0: rts
+jmp L9
+L9: inc r2
+jmp L5
+L5: rts
+bne L4
+ dec DAT[k]
+inc DAT[k]
+; comment
+L8: cmp r0, L5
+mov r7, r6
+mov r7, r5
+ dec DAT[k]
+inc DAT[k]
+L1: jmp L3
+L7: sub #4, r3
+L10: lea DAT, r2
+L6: jmp L1
+cmp L4, #1
+mov r4, r4
+prn #k
+cmp r2, #1
+sub #4, r3
+cmp DAT[k], #1
+mov r1, r1
+ inc r5
+inc r5
+; comment
+cmp DAT[k], #-2
+mov r5, r5
+L4: jmp L0
+cmp DAT[1], #k
+L3: mov r7, r7
+bne L6
+cmp L0, L4
+jmp L1
+; comment
+red r1
+
+cmp r5, #k
+cmp r3, #k
+lea DAT, r2
+mov r5, r5
+mov r7, r7
+red r1
+cmp r1, r1
+bne L2
+ inc DAT[1]
+dec DAT[1]
+; comment
+red r3
+ dec r4
+dec r4
+cmp r1, DAT[k]
+ inc r3
+inc r3
+bne L8
+ dec r7
+dec r7
+mov r3, r3
+
+mov r0, r2
+bne L8
+ hlt
+DAT: .data 1, 2, 3, k
+.entry L0
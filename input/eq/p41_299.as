@@ -0,0 +1,72 @@
+.define k = 3
+.extern X1
+bne L0
+jmp L9
+L9: prn r1
+jmp L0
+L0: inc r2
+dec r6
+cmp r6, #1
+mov r2, r2
+L5: bne L7
+mov r3, r3
+
+red r2
+jmp L5
+red r0
+mov r0, r6
+L11: red r0
+ dec r0
+inc r0
+L4: jmp L0
+prn #k
+; comment
+jmp L5
+red r5
+dec DAT[2]
+jmp L2
+L6: bne L0
+red r7
+jmp L5
+bne L9
+mov r7, r1
+prn #k
+red r6
+ inc r4
+inc r4
+red r5
+jmp L2
+L2: hlt
+cmp r4, #k
+cmp DAT[2], #-2
+ inc r2
+dec r2
+red r2
+mov r1, r0
+cmp DAT[2], #1
+L8: red r2
+mov r3, r3
+inc r6
+cmp DAT[k], #k
+not r1
+clr L1
+L7: lea DAT, r2
+L3: dec r3
+bne L8
+mov r0, r0
+mov r4, r3
+inc r3
+L10: mov r4, r4
+jmp L5
+jmp L4
+red r0
+mov r6, r6
+bne L1
+jmp L1
+jmp L0
+ inc r6
+inc r6
+mov r5, r5
+ hlt
+L1: hlt
+DAT: .data 1, 2, 3, k
@@ -0,0 +1,71 @@
+.define k = 3
+.extern X1
+jmp L5
+jmp L9
+L9: inc r2
+cmp r7, X1
+mov r1 r2
+cmp r6, #-2
+jmp L4
+cmp L6, DAT[zz]
+jmp L2
+ dec r6
+L2: dec r6
+jmp L6
+L6: prn r1
+red r4
+bne L2
+inc DAT
+
+cmp r7, r1
+mov r6, r1
+ dec X1
+L0: inc X1
+mov r0, r6
+cmp L5, r2
+mov r1 r2
+mov r1 r2
+mov r4, r4
+cmp r4, #k
+L10: red r5
+L7: jmp L2
+dec L5
+L1: red r0
+cmp r5, #k
+
+add r1, r2
+mov r2, r2
+; comment
+cmp r1, #k
+cmp DAT[k], r3
+add r1, r2
+cmp DAT[k], #1
+ dec r4
+dec r4
+jmp L0
+ inc DAT[zz]
+L3: dec DAT[zz]
+bne L8
+jmp L3
+red r1
+mov r3, r6
+mov r1, r1
+bne L8
+mov r1, r1
+mov r1 r2
+lea DAT, r2
+mov r1, r1
+red r2
+mov r6, r6
+cmp L6, #1
+add r1, r2
+ dec r1
+L4: dec r1
+L8: jmp L9
+red r6
+L5: bne L6
+jmp L0
+not r1
+mov r6, r6
+ hlt
+DAT: .data 1, 2, 3, k
@@ -0,0 +1,77 @@
+.define k = 3
+.extern X1
+cmp r3, r0
+mov r1, r1
+red r3
+L2: red r6
+bne L8
+ dec r4
+dec r4
+red r1
+red r2
+mov r1 r2
+mov r3, r3
+ inc DAT[2]
+L0: inc DAT[2]
+ dec r5
+inc r5
+dec r4
+cmp r2, #-2
+dec r4
+ dec DAT[zz]
+inc DAT[zz]
+red r5
+L5: mov r5, r5
+red r6
+; comment
+bne L0
+L10: jmp L5
+mov r6, r6
+ dec r6
+dec r6
+mov r3, r4
+jmp L5
+ dec r7
+inc r7
+L8: dec r3
+L1: cmp DAT[2], #k
+ inc L2
+inc L2
+L3: jmp L3
+cmp r3, #k
+L9: 
+mov r4, r6
+ inc r1
+dec r1
+cmp r1, #1
+mov r2, r2
+not r1
+ inc r1
+inc r1
+L7: jmp L4
+L4: inc r2
+ inc L6
+inc L6
+jmp L1
+cmp r6, #1
+dec r5
+L6: dec r7
+jmp L2
+cmp r0, #-2
+L11: mov r1 r2
+jmp L9
+cmp r1, #-2
+mov r6, r6
+cmp DAT[2], #-2
+cmp r2, #-2
+jmp L3
+cmp r1, #k
+jmp L5
+ dec r7
+inc r7
+jmp L1
+cmp r1, r4
+jmp L3
+ hlt
+DAT: .data 1, 2, 3, k
+.entry L0
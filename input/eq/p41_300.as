@@ -0,0 +1,74 @@
+.define k = 3
+.extern X1
+ dec r5
+inc r5
+L6: inc NOPE
+jmp L8
+L1: cmp r1, #k
+L2: jmp L6
+; comment
+jmp L2
+inc L4
+bne L6
+ dec DAT[k]
+inc DAT[k]
+jmp L6
+add r1, r2
+ dec r0
+inc r0
+mov r5, r2
+red r5
+red r5
+; comment
+inc r6
+cmp r1, #1
+dec r5
+; comment
+inc NOPE
+red r4
+L5: bne L9
+bne L3
+lea DAT, r2
+cmp DAT[2], #k
+L7: jmp L5
+; comment
+inc r3
+mov r1, r1
+L8: mov r1, r1
+inc r5
+ inc r6
+L4: inc r6
+mov r3, r3
+cmp DAT[zz], r5
+mov r1, r1
+L11: mov r1 r2
+L0: lea DAT, r2
+ inc r7
+dec r7
+ inc L0
+L10: inc L0
+mov r5, r5
+L3: red r6
+mov r6, r2
+jmp L1
+ dec L5
+L9: inc L5
+ dec r2
+inc r2
+mov r6, r6
+jmp L0
+dec r0
+ dec DAT[1]
+inc DAT[1]
+cmp r3, #1
+
+mov r7, r7
+red r7
+jmp L6
+; comment
+ dec L5
+dec L5
+inc r0
+mov r3, r1
+ hlt
+DAT: .data 1, 2, 3, k
@@ -0,0 +1,74 @@
+.define k = 3
+.extern X1
+L1: sub #4, r3
+mov r1, r1
+mov r0, r0
+L9: clr L1
+red r1
+ dec r6
+L7: inc r6
+cmp X1, #-2
+cmp DAT[k], #-2
+ inc r5
+dec r5
+inc r5
+lea DAT, r2
+jmp L8
+cmp r5, L1
+ inc DAT[1]
+dec DAT[1]
+clr L1
+cmp r1, #k
+L3: dec r4
+jmp L1
+jmp L7
+cmp DAT[k], #1
+cmp r0, #-2
+red r4
+jmp L8
+
+jmp L9
+dec r1
+bne L9
+mov r1, r3
+L10: red r3
+bne L8
+red r4
+; comment
+L6: ; comment
+jmp L6
+ inc DAT[k]
+dec DAT[k]
+bne L5
+L2: mov r3, r7
+ dec L2
+dec L2
+L8: 
+cmp r4, #k
+sub #4, r3
+mov r5, r3
+L11: red r7
+
+inc X1
+L5: cmp DAT[1], #k
+mov r0, r0
+not r1
+ inc DAT[k]
+L0: dec DAT[k]
+mov r7, r7
+prn #k
+red r5
+red r7
+mov r6, r5
+cmp r0, #1
+ dec DAT[1]
+dec DAT[1]
+ inc r4
+dec r4
+cmp r6, DAT[k]
+dec r3
+mov r1, r4
+ hlt
+L4: hlt
+DAT: .data 1, 2, 3, k
+.entry L1
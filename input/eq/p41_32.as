@@ -0,0 +1,73 @@
+.define k = 3
+.extern X1
+L3: mov r3, r3
+mov r5, r7
+mov r2, r2
+sub #4, r3
+red r3
+ inc r1
+dec r1
+L0: jmp L3
+red r2
+; comment
+jmp L1
+cmp r3, L4
+add r1, r2
+ inc DAT[1]
+dec DAT[1]
+L6: mov r0, r0
+L1: jmp L8
+ dec r3
+inc r3
+inc DAT[1]
+jmp L2
+inc r0
+red r3
+mov r5, r5
+inc r3
+inc r6
+L5: red r0
+prn #k
+ dec r6
+inc r6
+ inc r0
+dec r0
+L2: mov r1, r1
+red r5
+mov r2, r1
+L4: red r3
+inc L5
+L9: mov r0, r2
+ dec r2
+L8: inc r2
+ inc L3
+dec L3
+
+dec r0
+cmp r4, #1
+cmp r3, #1
+jmp L9
+mov r6, r6
+ dec r7
+inc r7
+dec r5
+prn #k
+mov r5, r5
+L11: jmp L4
+
+bne L1
+red r0
+L7: inc r2
+mov r2, r2
+mov r2, r2
+ inc L2
+L10: inc L2
+jmp L0
+lea DAT, r2
+jmp L2
+jmp L1
+mov r2, r2
+dec L4
+cmp r6, L1
+ hlt
+DAT: .data 1, 2, 3, k
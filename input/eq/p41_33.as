@@ -0,0 +1,77 @@
+.define k = 3
+.extern X1
+jmp L4
+L4: rts
+red r5
+jmp L7
+L7: hlt
+dec r0
+inc DAT[k]
+red r3
+mov r5, r5
+cmp r0, r4
+bne L0
+jmp L8
+L1: mov r5, r5
+ dec r6
+dec r6
+ inc r7
+dec r7
+add r1, r2
+cmp r7, DAT[k]
+ dec DAT
+dec DAT
+ dec r7
+dec r7
+red r2
+L3: red r5
+cmp L5, #k
+mov r1 r2
+jmp L8
+L8: hlt
+mov r4, r1
+cmp r1, r0
+bne L0
+cmp r1, DAT[k]
+L0: jmp L3
+mov r5, r5
+inc r0
+cmp r2, #k
+lea DAT, r2
+mov r3, r4
+L9: jmp L2
+ inc L3
+inc L3
+ inc r4
+L5: dec r4
+red r4
+mov r2, r2
+L2: mov r3, r3
+inc DAT[1]
+L6: not r1
+clr L1
+not r1
+bne L4
+red r6
+bne L6
+dec r1
+L10: ; comment
+ dec r2
+L11: inc r2
+mov r6, r1
+ dec r7
+inc r7
+red r7
+
+red r6
+ dec r3
+dec r3
+dec r0
+cmp r3, #k
+mov r0, r0
+prn #k
+bne L9
+jmp L4
+ hlt
+DAT: .data 1, 2, 3, k
+.entry L0
@@ -0,0 +1,75 @@
+.define k = 3
+.extern X1
+jmp L3
+ dec r6
+inc r6
+L5: jmp L2
+L0: inc DAT[2]
+jmp L4
+L4: prn r1
+ dec r2
+inc r2
+; comment
+not r1
+mov r4, r3
+dec DAT[k]
+ dec r2
+L10: inc r2
+L7: mov r4, r4
+cmp r6, #k
+jmp L7
+ dec r2
+dec r2
+mov r4, r4
+cmp r4, #-2
+bne L2
+cmp L6, #1
+jmp L2
+L2: inc r2
+
+red r7
+L8: jmp L6
+L6: hlt
+red r4
+cmp L7, r4
+clr L1
+bne L2
+jmp L1
+L1: hlt
+ inc r4
+dec r4
+red r5
+bne L5
+mov r4, r6
+mov r1, r6
+red r4
+ dec L2
+dec L2
+
+cmp r6, #k
+not r1
+L3: bne L1
+bne L3
+L9: cmp r5, L5
+jmp L4
+bne L8
+lea DAT, r2
+mov r2, r2
+; comment
+L11: jmp L2
+mov r7, r7
+jmp L8
+cmp r7, #k
+not r1
+jmp L1
+red r1
+red r0
+add r1, r2
+ inc DAT[k]
+inc DAT[k]
+jmp L9
+mov r4, r4
+bne L1
+red r4
+ hlt
+DAT: .data 1, 2, 3, k
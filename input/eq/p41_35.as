@@ -0,0 +1,76 @@
+.define k = 3
+.extern X1
+prn #k
+cmp r4, #k
+; comment
+red r1
+red r0
+ inc r7
+L7: dec r7
+L5: cmp r5, #1
+mov r7, r7
+jmp L0
+L0: inc r2
+add r1, r2
+jmp L1
+L1: inc r2
+ inc L4
+inc L4
+L3: mov r2, r2
+inc L7
+jmp L6
+; comment
+cmp L5, L4
+mov r1, r1
+prn #k
+ inc r7
+dec r7
+jmp L7
+bne L1
+red r6
+jmp L0
+bne L7
+clr L1
+L10: jmp L8
+cmp r6, r3
+cmp r1, #1
+red r6
+cmp DAT[1], #1
+mov r5, r4
+L8: jmp L7
+L2: 
+ dec r2
+dec r2
+ inc r1
+dec r1
+red r0
+dec r5
+L4: jmp L9
+L9: hlt
+red r3
+L11: dec L5
+ dec r7
+dec r7
+bne L2
+inc r6
+cmp r2, r4
+L6: lea DAT, r2
+ dec r4
+dec r4
+inc r2
+ inc r3
+inc r3
+mov r7, r7
+cmp r7, r4
+jmp L7
+jmp L4
+jmp L9
+jmp L1
+mov r4, r4
+mov r3, r2
+jmp L2
+dec r0
+ dec r5
+inc r5
+ hlt
+DAT: .data 1, 2, 3, k
@@ -0,0 +1,74 @@
+.define k = 3
+.extern X1
+red r4
+mov r2, r2
+ inc X1
+dec X1
+ dec DAT[k]
+dec DAT[k]
+cmp r7, #-2
+L6: red r7
+L3: dec r3
+lea DAT, r2
+cmp NOPE, #1
+inc L2
+ dec DAT[1]
+inc DAT[1]
+red r4
+L9: cmp L5, #-2
+mov r4, r4
+L5: bne L0
+ dec r1
+inc r1
+; comment
+mov r7, r7
+cmp r7, L4
+ inc L5
+L2: dec L5
+L4: mov r5, r5
+ inc L6
+dec L6
+cmp r4, #1
+ inc L0
+dec L0
+L8: jmp L2
+cmp r6, #1
+cmp DAT[zz], #1
+bne L6
+bne L0
+jmp L8
+bne L5
+L11: bne L3
+not r1
+inc r4
+lea DAT, r2
+
+cmp DAT[2], #-2
+ dec L0
+inc L0
+sub #4, r3
+clr L1
+mov r1, r1
+jmp L6
+dec NOPE
+L10: cmp r7, #1
+mov r1, r1
+jmp L7
+L7: prn r1
+L1: prn #k
+red r3
+L0: bne L2
+mov r3, r3
+red r2
+jmp L9
+mov r3, r3
+mov r3, r6
+lea DAT, r2
+mov r4, r4
+cmp r4, #1
+mov r6, r6
+red r5
+sub #4, r3
+ hlt
+DAT: .data 1, 2, 3, k
+.entry L2
@@ -0,0 +1,74 @@
+.define k = 3
+.extern X1
+mov r0, r0
+jmp L1
+not r1
+ inc r0
+dec r0
+jmp L6
+jmp L9
+jmp L8
+L8: hlt
+L9: red r1
+cmp r2, #1
+cmp DAT[2], #1
+bne L7
+L4: jmp L0
+L0: hlt
+mov r3, r3
+ inc r2
+inc r2
+cmp r2, #-2
+bne L6
+jmp L0
+L1: cmp r7, #1
+mov r3, r7
+jmp L9
+bne L3
+
+red r0
+red r3
+clr L1
+cmp L5, r5
+red r2
+jmp L1
+ dec r5
+inc r5
+red r2
+bne L3
+L3: red r1
+L10: ; comment
+cmp r1, #-2
+jmp L8
+red r3
+jmp L9
+; comment
+
+ inc L3
+dec L3
+ inc DAT[1]
+inc DAT[1]
+inc r2
+; comment
+mov r0, r0
+L11: jmp L9
+jmp L3
+dec DAT[k]
+jmp L1
+jmp L5
+L5: prn r1
+jmp L8
+L6: red r6
+mov r3, r3
+bne L7
+mov r1, r1
+red r1
+L7: red r0
+L2: cmp r7, DAT[k]
+jmp L2
+ inc DAT[k]
+dec DAT[k]
+jmp L4
+ hlt
+DAT: .data 1, 2, 3, k
+.entry L2
@@ -0,0 +1,79 @@
+.define k = 3
+.extern X1
+dec DAT[1]
+jmp L2
+L2: prn r1
+ dec DAT[k]
+inc DAT[k]
+mov r3, r3
+jmp L9
+L9: rts
+cmp DAT[k], #k
+dec r7
+L5: bne L2
+mov r3, r3
+mov r6, r3
+
+L11: ; comment
+red r0
+mov r7, r1
+L0: jmp L0
+L7: red r4
+L4: bne L0
+ dec L3
+dec L3
+ inc r0
+L10: inc r0
+ dec r0
+dec r0
+ dec r3
+inc r3
+inc r2
+cmp L1, #k
+L8: mov r6, r6
+jmp L3
+L3: prn r1
+ inc DAT[2]
+L6: dec DAT[2]
+ inc r6
+dec r6
+not r1
+jmp L5
+L1: jmp L4
+dec r1
+ dec r2
+inc r2
+ inc DAT[2]
+inc DAT[2]
+cmp r1, DAT[2]
+bne L3
+cmp r5, #-2
+cmp DAT[k], #1
+jmp L4
+inc DAT[2]
+cmp r0, #1
+jmp L6
+mov r4, r4
+jmp L8
+bne L1
+mov r4, r4
+red r2
+cmp r4, #k
+lea DAT, r2
+; comment
+cmp r0, #1
+jmp L0
+cmp r2, L0
+mov r0, r0
+ inc r0
+dec r0
+red r1
+dec L2
+cmp r0, #-2
+jmp L9
+ dec r7
+dec r7
+jmp L1
+ hlt
+DAT: .data 1, 2, 3, k
+.entry L2
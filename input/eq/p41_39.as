@@ -0,0 +1,74 @@
+.define k = 3
+.extern X1
+inc r6
+dec r0
+dec r5
+L6: jmp L4
+L4: hlt
+cmp r0, #-2
+red r7
+jmp L5
+ dec r2
+dec r2
+sub #4, r3
+add r1, r2
+red r7
+jmp L6
+bne L0
+jmp L6
+clr L1
+mov r7, r7
+; comment
+red r3
+L1: jmp L7
+L7: prn r1
+mov r1 r2
+red r2
+ inc r0
+L3: inc r0
+mov r1, r1
+L0: clr L1
+ dec L2
+inc L2
+ inc r1
+inc r1
+mov r2, r2
+bne L5
+red r5
+mov r7, r7
+jmp L8
+cmp r0, #k
+dec r1
+jmp L0
+red r1
+jmp L1
+; comment
+mov r4, r7
+L2: 
+cmp L3, #k
+jmp L0
+sub #4, r3
+cmp r2, r3
+bne L7
+mov r0, r6
+mov r1 r2
+ dec r3
+inc r3
+L11: jmp L5
+L5: hlt
+cmp L7, #k
+
+L10: cmp r7, #1
+L9: mov r1, r1
+bne L7
+dec DAT[1]
+red r3
+not r1
+jmp L5
+cmp r1, #1
+clr L1
+cmp r2, r3
+ hlt
+L8: hlt
+DAT: .data 1, 2, 3, k
+.entry L0
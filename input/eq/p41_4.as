@@ -0,0 +1,78 @@
+.define k = 3
+.extern X1
+mov r6, r6
+ inc r0
+L0: dec r0
+cmp r3, #k
+cmp r5, r5
+cmp r1, #1
+jmp L4
+ dec L6
+dec L6
+add r1, r2
+L11: red r7
+mov r3, r3
+jmp L7
+L7: prn r1
+jmp L8
+L8: prn r1
+L1: bne L4
+jmp L3
+L3: rts
+mov r5, r5
+red r5
+ inc r6
+L5: inc r6
+cmp r2, #k
+ inc DAT[k]
+L4: inc DAT[k]
+cmp r0, #-2
+jmp L9
+L9: hlt
+L10: cmp r3, r3
+mov r6, r6
+ inc r3
+dec r3
+cmp r4, #k
+red r6
+bne L0
+mov r3, r2
+bne L5
+jmp L4
+ inc r4
+inc r4
+cmp r2, L7
+red r3
+cmp r4, #-2
+red r3
+L6: ; comment
+clr L1
+mov r1, r1
+jmp L2
+L2: hlt
+jmp L0
+mov r7, r7
+ dec r7
+inc r7
+lea DAT, r2
+inc r7
+jmp L7
+cmp r2, DAT[k]
+cmp r0, #k
+mov r7, r7
+inc r3
+bne L9
+jmp L7
+red r7
+ dec r5
+inc r5
+bne L9
+red r5
+prn #k
+mov r6, r6
+dec r2
+jmp L1
+red r2
+ hlt
+DAT: .data 1, 2, 3, k
+.entry L1
@@ -0,0 +1,76 @@
+.define k = 3
+.extern X1
+red r0
+bne L3
+L5: cmp DAT[1], #1
+jmp L7
+L10: inc r5
+jmp L1
+L1: hlt
+ inc DAT[1]
+dec DAT[1]
+cmp DAT[1], r3
+mov r3, r3
+mov r4, r4
+ dec r5
+inc r5
+L0: ; comment
+cmp r7, #-2
+ inc L3
+inc L3
+L7: red r1
+L4: cmp r3, #-2
+ inc r4
+dec r4
+mov r2, r2
+ dec r6
+L2: inc r6
+red r4
+cmp DAT[2], #1
+cmp DAT[1], #1
+cmp r2, #1
+ dec r6
+inc r6
+ dec r7
+dec r7
+jmp L6
+L6: inc r2
+
+cmp DAT[2], L6
+L8: red r0
+L3: red r5
+L11: inc DAT[1]
+sub #4, r3
+add r1, r2
+cmp r0, #k
+ inc r3
+L9: inc r3
+mov r7, r7
+dec r1
+cmp r4, r5
+jmp L1
+mov r7, r7
+cmp r7, #k
+mov r1, r1
+bne L7
+jmp L3
+red r6
+red r6
+cmp r5, #k
+mov r7, r7
+dec r3
+jmp L5
+mov r4, r4
+jmp L2
+jmp L8
+mov r4, r4
+mov r2, r2
+cmp r6, #1
+jmp L5
+cmp L1, r3
+ inc L0
+inc L0
+red r3
+ hlt
+DAT: .data 1, 2, 3, k
+.entry L2
@@ -0,0 +1,71 @@
+.define k = 3
+.extern X1
+cmp r6, #k
+clr L1
+L3: bne L0
+cmp r5, #1
+mov r4, r3
+L6: sub #4, r3
+mov r1, r2
+L7: cmp r2, #k
+mov r1, r1
+ inc r0
+dec r0
+inc L4
+inc r1
+
+red r2
+dec DAT[1]
+L4: cmp r7, L6
+L8: jmp L3
+dec r6
+cmp r0, #-2
+L1: jmp L9
+L9: prn r1
+L10: bne L1
+ dec DAT[1]
+dec DAT[1]
+; comment
+L2: jmp L8
+ inc r1
+dec r1
+ dec r4
+dec r4
+; comment
+cmp L4, #-2
+L5: jmp L3
+cmp r7, #1
+red r0
+jmp L6
+ inc r0
+dec r0
+L11: mov r4, r4
+jmp L3
+L0: jmp L2
+sub #4, r3
+cmp r7, #1
+; comment
+red r5
+lea DAT, r2
+cmp r6, #-2
+red r1
+dec r5
+red r1
+red r4
+red r4
+cmp r7, DAT[k]
+bne L9
+cmp L3, #k
+cmp L4, #k
+mov r4, r4
+red r0
+red r5
+dec r7
+cmp r5, r7
+jmp L8
+jmp L1
+mov r1, r0
+bne L4
+ hlt
+DAT: .data 1, 2, 3, k
+.entry L1
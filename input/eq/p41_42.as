@@ -0,0 +1,71 @@
+.define k = 3
+.extern X1
+mov r4, r4
+L1: bne L8
+L7: mov r1, r1
+mov r3, r6
+jmp L0
+ inc r5
+L8: inc r5
+ dec r0
+dec r0
+L5: ; comment
+mov r1 r2
+bne L0
+add r1, r2
+mov r1 r2
+ dec DAT[k]
+dec DAT[k]
+bne L1
+cmp DAT[k], #-2
+
+cmp r5, #-2
+jmp L5
+red r7
+L3: cmp L4, DAT[zz]
+red r2
+mov r0, r2
+not r1
+dec L7
+mov r1, r1
+cmp L1, r2
+L10: mov r1 r2
+jmp L2
+L2: hlt
+cmp DAT, #-2
+clr L1
+jmp L7
+mov r1 r2
+inc r1
+red r2
+L9: red r2
+mov r1 r2
+cmp L3, #k
+jmp L1
+L0: jmp L3
+L11: jmp L3
+L6: mov r3, r3
+jmp L9
+inc r1
+ inc r0
+dec r0
+mov r3, r3
+ inc r3
+inc r3
+L4: red r3
+ inc r6
+inc r6
+cmp DAT[zz], #-2
+cmp r0, #1
+jmp L8
+mov r2, r2
+mov r1 r2
+red r3
+mov r1, r1
+jmp L4
+cmp r4, #1
+red r1
+cmp r5, #k
+inc L4
+ hlt
+DAT: .data 1, 2, 3, k
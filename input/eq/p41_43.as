@@ -0,0 +1,73 @@
+.define k = 3
+.extern X1
+L11: not r1
+bne L1
+dec r6
+red r6
+mov r1, r6
+L2: jmp L7
+L7: inc r2
+jmp L9
+L9: hlt
+L0: cmp r2, #1
+; comment
+jmp L0
+prn #k
+jmp L7
+add r1, r2
+cmp DAT[2], #1
+red r5
+mov r6, r6
+L3: jmp L2
+bne L6
+mov r0, r0
+; comment
+L1: red r5
+L10: dec r7
+bne L1
+
+cmp r6, #k
+mov r2, r3
+red r3
+cmp r3, #-2
+L4: mov r0, r0
+jmp L8
+jmp L4
+ inc r1
+dec r1
+ inc r6
+dec r6
+jmp L2
+L5: mov r7, r7
+jmp L1
+dec r3
+L8: cmp r7, r7
+jmp L9
+bne L2
+mov r1, r1
+red r3
+L6: jmp L8
+red r6
+ dec r4
+dec r4
+ dec DAT[2]
+inc DAT[2]
+inc r6
+jmp L2
+cmp r3, r7
+cmp r1, #k
+
+lea DAT, r2
+jmp L8
+ inc r7
+dec r7
+mov r1, r1
+bne L8
+mov r2, r2
+ inc r5
+dec r5
+
+mov r1, r1
+ hlt
+DAT: .data 1, 2, 3, k
+.entry L0
@@ -0,0 +1,76 @@
+.define k = 3
+.extern X1
+jmp L1
+L1: rts
+cmp L1, r4
+prn #k
+mov r4, r4
+L2: jmp L4
+L6: mov r6, r6
+cmp r3, DAT[1]
+prn #k
+bne L5
+ inc r2
+dec r2
+red r0
+mov r0, r0
+jmp L4
+cmp r5, #1
+prn #k
+mov r2, r0
+cmp L4, #k
+L11: jmp L3
+mov r7, r4
+red r5
+ dec r4
+dec r4
+L7: mov r2, r2
+ inc r7
+L5: inc r7
+jmp L5
+jmp L1
+bne L7
+cmp X1, r5
+L0: mov r6, r6
+red r7
+cmp r0, #-2
+cmp L1, #1
+ inc r2
+dec r2
+jmp L4
+L4: rts
+L3: cmp r1, r2
+cmp r5, #-2
+sub #4, r3
+cmp r7, r7
+cmp L7, r6
+; comment
+cmp DAT[k], #k
+ dec r4
+L8: inc r4
+dec r3
+red r7
+mov r0, r0
+lea DAT, r2
+mov r5, r5
+ dec r1
+inc r1
+mov r3, r3
+red r0
+L10: 
+red r5
+red r7
+ inc DAT[2]
+L9: inc DAT[2]
+jmp L6
+inc DAT[2]
+mov r2, r2
+cmp r5, #1
+ dec DAT[k]
+dec DAT[k]
+cmp L6, #1
+ dec L4
+inc L4
+ hlt
+DAT: .data 1, 2, 3, k
+.entry L1
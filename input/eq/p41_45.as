@@ -0,0 +1,74 @@
+.define k = 3
+.extern X1
+ inc r5
+inc r5
+L1: red r0
+mov r4, r2
+
+mov r6, r6
+L0: cmp r5, #1
+ inc r4
+dec r4
+ inc L0
+dec L0
+ dec DAT[k]
+dec DAT[k]
+L10: jmp L0
+jmp L4
+L4: rts
+L7: mov r1, r1
+bne L9
+ inc r3
+inc r3
+jmp L4
+L8: cmp r1, r2
+cmp NOPE, DAT[zz]
+cmp DAT[zz], #1
+jmp L6
+L6: prn r1
+jmp L6
+mov r6, r6
+jmp L7
+mov r3, r0
+L11: clr L1
+; comment
+; comment
+dec r6
+mov r3, r0
+L5: mov r2, r2
+dec DAT[1]
+
+mov r3, r0
+bne L4
+; comment
+red r5
+lea DAT, r2
+mov r1, r1
+L3: mov r6, r6
+red r4
+mov r1 r2
+red r2
+cmp DAT[k], L7
+mov r6, r6
+ dec r2
+dec r2
+bne L6
+L2: mov r1 r2
+mov r0, r0
+red r7
+dec r0
+cmp r4, #-2
+jmp L6
+prn #k
+lea DAT, r2
+mov r6, r6
+red r7
+ inc L6
+dec L6
+L9: cmp r2, #k
+red r1
+mov r3, r6
+red r4
+ hlt
+DAT: .data 1, 2, 3, k
+.entry L2
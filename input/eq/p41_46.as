@@ -0,0 +1,73 @@
+.define k = 3
+.extern X1
+ inc L3
+inc L3
+L5: jmp L0
+L4: jmp L1
+L1: inc r2
+ inc DAT[k]
+dec DAT[k]
+lea DAT, r2
+L8: red r5
+inc r5
+red r5
+L7: ; comment
+cmp DAT, #-2
+L0: lea DAT, r2
+L2: bne L2
+ inc L0
+inc L0
+mov r6, r6
+L10: jmp L4
+bne L2
+bne L6
+L3: mov r3, r6
+cmp X1, r0
+ inc r0
+dec r0
+red r6
+mov r7, r5
+ inc r0
+inc r0
+L9: cmp r6, #1
+add r1, r2
+mov r0, r0
+L11: red r6
+cmp r5, #k
+jmp L9
+inc r4
+not r1
+jmp L2
+mov r3, r3
+L6: add r1, r2
+jmp L1
+red r0
+jmp L4
+ inc r2
+dec r2
+inc r5
+red r7
+cmp r1, r1
+cmp DAT[1], #k
+cmp r3, DAT[2]
+cmp L5, #k
+mov r6, r6
+
+mov r4, r4
+prn #k
+mov r2, r2
+mov r6, r3
+ dec DAT[2]
+dec DAT[2]
+mov r4, r4
+mov r0, r0
+jmp L5
+mov r5, r5
+jmp L6
+cmp X1, #-2
+bne L1
+dec DAT[k]
+cmp r5, r7
+ hlt
+DAT: .data 1, 2, 3, k
+.entry L2
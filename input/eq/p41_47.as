@@ -0,0 +1,74 @@
+.define k = 3
+.extern X1
+ dec r5
+dec r5
+prn #k
+L1: mov r7, r0
+red r6
+jmp L5
+L5: rts
+L7: bne L5
+jmp L3
+L3: hlt
+L2: inc r4
+red r5
+not r1
+bne L4
+; comment
+red r5
+mov r4, r4
+red r3
+jmp L3
+jmp L8
+L8: hlt
+jmp L1
+jmp L7
+red r0
+red r7
+jmp L5
+cmp r2, #-2
+L11: lea DAT, r2
+mov r7, r7
+L0: inc r2
+cmp DAT[k], #1
+cmp r5, #-2
+inc r4
+jmp L8
+cmp r1, #1
+ dec r4
+inc r4
+mov r7, r7
+mov r1, r4
+dec r3
+L4: jmp L7
+jmp L0
+L10: cmp DAT[2], #1
+bne L9
+lea DAT, r2
+inc L3
+L9: inc r5
+L6: dec r0
+cmp r4, #k
+mov r7, r7
+ dec r4
+inc r4
+ dec r3
+inc r3
+bne L6
+red r7
+cmp DAT[1], #1
+mov r7, r7
+mov r2, r6
+ inc r5
+inc r5
+inc r1
+ dec DAT[k]
+inc DAT[k]
+
+bne L7
+jmp L4
+ inc r1
+inc r1
+bne L4
+ hlt
+DAT: .data 1, 2, 3, k
@@ -0,0 +1,73 @@
+.define k = 3
+.extern X1
+mov r4, r3
+dec r1
+jmp L8
+L8: rts
+L6: mov r7, r7
+mov r4, r5
+L3: cmp DAT, #k
+cmp r4, #k
+jmp L1
+red r7
+ dec r0
+dec r0
+ dec L2
+L9: inc L2
+red r2
+cmp r6, X1
+prn #k
+red r4
+L1: mov r0, r0
+red r7
+
+L5: red r1
+cmp DAT[k], #1
+jmp L0
+L0: hlt
+red r6
+mov r3, r7
+prn #k
+L4: mov r1 r2
+red r1
+ inc DAT[zz]
+L10: inc DAT[zz]
+jmp L4
+L2: mov r1, r1
+not r1
+ dec r4
+inc r4
+ inc L1
+L11: dec L1
+ dec r0
+inc r0
+bne L8
+L7: bne L0
+red r7
+mov r3, r3
+mov r6, r6
+bne L2
+mov r1, r1
+sub #4, r3
+mov r1 r2
+mov r4, r4
+dec r5
+cmp L7, #-2
+bne L4
+red r3
+jmp L7
+; comment
+cmp r6, #1
+red r5
+cmp DAT[2], r2
+mov r0, r0
+red r5
+jmp L3
+cmp L2, #1
+jmp L8
+dec DAT
+dec L7
+red r1
+ hlt
+DAT: .data 1, 2, 3, k
+.entry L0
@@ -0,0 +1,75 @@
+.define k = 3
+.extern X1
+L6: red r5
+jmp L0
+cmp r0, #-2
+jmp L9
+L9: hlt
+mov r6, r5
+cmp r0, #-2
+red r4
+jmp L2
+L2: rts
+jmp L9
+lea DAT, r2
+clr L1
+L3: mov r1, r4
+L8: bne L0
+ dec r3
+dec r3
+L5: dec r6
+red r1
+cmp r0, #k
+jmp L1
+L1: prn r1
+red r1
+red r2
+mov r7, r2
+ dec r1
+dec r1
+red r3
+L0: inc r4
+; comment
+mov r3, r0
+jmp L2
+L7: sub #4, r3
+ inc r3
+inc r3
+mov r1, r1
+jmp L4
+L10: jmp L4
+L4: hlt
+bne L2
+bne L5
+mov r5, r5
+sub #4, r3
+
+jmp L1
+L11: 
+cmp r7, #-2
+ dec r3
+inc r3
+ dec DAT[2]
+inc DAT[2]
+red r0
+mov r4, r2
+mov r2, r5
+mov r5, r5
+sub #4, r3
+ inc r7
+dec r7
+mov r0, r0
+mov r0, r2
+clr L1
+mov r5, r0
+clr L1
+red r7
+bne L8
+ dec r7
+dec r7
+cmp L3, #k
+
+cmp DAT[2], #k
+cmp r4, r5
+ hlt
+DAT: .data 1, 2, 3, k
@@ -0,0 +1,79 @@
+.define k = 3
+.extern X1
+prn #k
+clr L1
+L7: sub #4, r3
+red r1
+red r6
+jmp L0
+cmp r6, #-2
+inc r0
+cmp r5, #-2
+bne L6
+ dec r2
+dec r2
+jmp L9
+ dec DAT[k]
+dec DAT[k]
+mov r0, r5
+mov r6, r6
+mov r0, r3
+L3: red r7
+ inc L7
+dec L7
+mov r1, r1
+ inc r4
+dec r4
+prn #k
+L5: red r2
+mov r6, r6
+ inc r6
+inc r6
+ dec r2
+dec r2
+mov r6, r6
+red r2
+ dec r5
+dec r5
+mov r6, r2
+ dec r1
+dec r1
+L8: bne L0
+ dec DAT[k]
+dec DAT[k]
+ dec r0
+dec r0
+cmp r5, r5
+
+bne L5
+jmp L8
+L9: red r7
+mov r6, r6
+jmp L6
+L6: prn r1
+mov r2, r2
+cmp DAT[1], L0
+cmp r1, r2
+ inc r1
+L0: dec r1
+L10: red r6
+bne L8
+mov r4, r4
+ inc L5
+dec L5
+cmp r7, #1
+red r0
+dec r2
+ dec r3
+dec r3
+
+L4: lea DAT, r2
+dec r4
+L1: mov r7, r7
+L2: ; comment
+L11: cmp r0, #-2
+cmp r7, #1
+mov r4, r4
+ hlt
+DAT: .data 1, 2, 3, k
+.entry L1
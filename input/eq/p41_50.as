@@ -0,0 +1,79 @@
+.define k = 3
+.extern X1
+cmp L3, #1
+cmp L2, #k
+cmp r5, #1
+red r5
+jmp L6
+L6: prn r1
+red r1
+ inc r7
+inc r7
+mov r1, r7
+jmp L8
+L10: ; comment
+
+cmp r6, #-2
+mov r2, r2
+inc L0
+cmp r6, DAT[k]
+ inc DAT[1]
+L1: inc DAT[1]
+
+bne L7
+ inc r1
+L3: inc r1
+L4: mov r5, r5
+cmp r4, #-2
+ inc L3
+dec L3
+ inc r0
+dec r0
+; comment
+ inc DAT[2]
+inc DAT[2]
+L5: jmp L7
+L7: rts
+cmp r3, #1
+dec r4
+jmp L1
+red r7
+jmp L0
+L0: inc r2
+L8: red r5
+mov r3, r4
+ inc X1
+inc X1
+red r1
+mov r7, r7
+red r2
+ dec r1
+inc r1
+L9: jmp L6
+inc r1
+cmp r4, DAT[k]
+red r6
+jmp L0
+cmp L5, r4
+red r1
+bne L8
+red r6
+jmp L6
+lea DAT, r2
+ inc r5
+inc r5
+mov r5, r5
+jmp L6
+jmp L5
+jmp L3
+L11: red r6
+ dec r5
+dec r5
+ inc L1
+dec L1
+L2: cmp r4, #k
+mov r5, r5
+red r5
+ hlt
+DAT: .data 1, 2, 3, k
+.entry L1
@@ -0,0 +1,75 @@
+.define k = 3
+.extern X1
+jmp L2
+L2: rts
+cmp r7, #k
+cmp L0, #k
+L11: ; comment
+L10: cmp r3, DAT[1]
+cmp r0, #-2
+red r0
+red r3
+dec r2
+jmp L7
+; comment
+red r1
+; comment
+
+mov r6, r6
+mov r1 r2
+red r4
+clr L1
+; comment
+ inc r7
+dec r7
+clr L1
+ dec DAT[1]
+inc DAT[1]
+cmp r1, #k
+jmp L7
+mov r4, r4
+red r6
+
+ dec NOPE
+dec NOPE
+jmp L7
+ dec r6
+L3: dec r6
+jmp L0
+mov r7, r7
+jmp L8
+L8: prn r1
+L5: red r0
+sub #4, r3
+add r1, r2
+red r0
+jmp L2
+ dec r6
+inc r6
+ inc r0
+inc r0
+
+jmp L8
+ inc r7
+inc r7
+jmp L2
+L1: mov r1, r7
+mov r0, r0
+cmp r4, #-2
+L6: mov r6, r6
+; comment
+jmp L7
+L7: hlt
+dec DAT[1]
+jmp L5
+L9: red r6
+red r0
+mov r6, r6
+cmp r1, #k
+red r1
+L4: bne L7
+prn #k
+inc r3
+ hlt
+DAT: .data 1, 2, 3, k
+.entry L0
@@ -0,0 +1,77 @@
+.define k = 3
+.extern X1
+mov r7, r5
+red r2
+sub #4, r3
+ dec r6
+inc r6
+L7: cmp r7, r0
+jmp L5
+L5: rts
+bne L2
+ dec DAT[k]
+inc DAT[k]
+ inc r1
+L10: inc r1
+jmp L6
+L6: rts
+sub #4, r3
+
+jmp L9
+cmp L6, #1
+; comment
+ inc r0
+L0: inc r0
+L9: jmp L8
+ inc r2
+L3: inc r2
+cmp r2, #1
+red r3
+ dec r5
+dec r5
+dec DAT[1]
+cmp r6, X1
+jmp L9
+bne L8
+L1: dec r1
+mov r4, r2
+ dec r1
+inc r1
+; comment
+L4: sub #4, r3
+jmp L4
+red r7
+ dec DAT[1]
+L2: inc DAT[1]
+L8: bne L7
+cmp r5, r6
+dec DAT[2]
+red r6
+bne L1
+mov r4, r4
+mov r5, r6
+jmp L8
+add r1, r2
+cmp r7, #k
+L11: jmp L4
+red r6
+jmp L6
+cmp r1, #1
+mov r4, r4
+inc r3
+mov r0, r0
+jmp L2
+dec L1
+ inc r0
+inc r0
+ dec X1
+dec X1
+ inc X1
+dec X1
+jmp L5
+mov r2, r2
+bne L8
+cmp r4, #k
+jmp L5
+ hlt
+DAT: .data 1, 2, 3, k
@@ -0,0 +1,76 @@
+.define k = 3
+.extern X1
+red r7
+dec DAT[k]
+mov r2, r5
+cmp DAT[1], r3
+L2: mov r5, r5
+red r5
+mov r6, r6
+bne L2
+ dec DAT[1]
+inc DAT[1]
+mov r1, r0
+red r5
+mov r6, r6
+cmp L5, #-2
+red r2
+jmp L1
+ dec r2
+dec r2
+red r3
+ inc r2
+L10: inc r2
+cmp r6, #-2
+mov r6, r6
+L5: jmp L7
+bne L9
+cmp L5, r6
+mov r6, r7
+bne L6
+cmp DAT[1], #1
+red r0
+mov r6, r6
+jmp L0
+jmp L0
+jmp L5
+ inc DAT[2]
+dec DAT[2]
+jmp L0
+L0: prn r1
+L9: inc r7
+jmp L6
+L6: rts
+dec r3
+L3: jmp L7
+L7: hlt
+bne L7
+cmp r1, #k
+ inc L0
+dec L0
+ inc L3
+L11: dec L3
+clr L1
+inc L4
+jmp L1
+L1: prn r1
+jmp L0
+jmp L6
+ dec X1
+inc X1
+jmp L1
+cmp r5, #1
+bne L2
+cmp r6, r7
+cmp r1, #1
+red r3
+
+L8: mov r5, r5
+ inc r5
+inc r5
+L4: jmp L7
+cmp DAT[k], #1
+cmp r2, #-2
+red r2
+ hlt
+DAT: .data 1, 2, 3, k
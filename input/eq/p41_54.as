@@ -0,0 +1,74 @@
+.define k = 3
+.extern X1
+mov r4, r4
+inc r6
+L8: dec r5
+mov r4, r7
+mov r0, r0
+L0: cmp r2, #-2
+jmp L7
+L7: hlt
+jmp L5
+dec r0
+cmp r4, r0
+ dec r7
+dec r7
+add r1, r2
+jmp L6
+L6: inc r2
+ inc r1
+L9: dec r1
+red r4
+bne L6
+bne L2
+jmp L4
+L11: mov r3, r3
+L10: cmp r3, #k
+cmp r1, #1
+ dec r5
+L2: inc r5
+red r6
+cmp r7, DAT[1]
+red r4
+mov r3, r3
+ inc L0
+inc L0
+bne L0
+red r4
+L4: 
+L1: bne L9
+cmp r4, r0
+bne L8
+L5: dec r6
+mov r0, r6
+mov r1 r2
+cmp L0, #k
+L3: jmp L5
+ inc r5
+dec r5
+red r2
+mov r1, r1
+jmp L2
+jmp L8
+cmp r5, #-2
+ inc DAT[1]
+dec DAT[1]
+ inc DAT[zz]
+inc DAT[zz]
+cmp DAT[k], #k
+red r6
+cmp r2, #-2
+not r1
+; comment
+cmp r4, #-2
+ dec r7
+dec r7
+
+red r6
+bne L7
+cmp r7, #k
+jmp L5
+mov r1, r1
+red r0
+ hlt
+DAT: .data 1, 2, 3, k
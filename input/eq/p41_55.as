@@ -0,0 +1,76 @@
+.define k = 3
+.extern X1
+L3: mov r4, r2
+ dec DAT[2]
+dec DAT[2]
+ dec r0
+inc r0
+mov r7, r0
+mov r6, r6
+inc r0
+ dec L3
+inc L3
+jmp L7
+L7: rts
+bne L7
+not r1
+red r4
+L5: cmp r1, L7
+ dec L1
+dec L1
+cmp r3, #k
+ inc r0
+inc r0
+dec r6
+red r3
+L4: bne L5
+jmp L0
+L1: jmp L4
+bne L1
+cmp r0, DAT[1]
+ dec r3
+dec r3
+ dec r6
+inc r6
+mov r0, r0
+cmp DAT[k], r1
+cmp r7, r5
+mov r6, r6
+cmp r4, #k
+mov r7, r7
+mov r1, r1
+L11: red r4
+L2: red r1
+bne L7
+mov r6, r6
+; comment
+ inc r1
+inc r1
+red r4
+red r6
+
+L8: inc r0
+jmp L5
+L0: jmp L9
+dec r4
+
+add r1, r2
+ dec L2
+L6: dec L2
+red r1
+bne L0
+mov r7, r7
+cmp r7, #k
+jmp L5
+red r3
+L10: cmp r0, #-2
+red r4
+mov r0, r0
+ dec DAT[1]
+inc DAT[1]
+red r4
+not r1
+L9: mov r4, r4
+ hlt
+DAT: .data 1, 2, 3, k
+.entry L2
@@ -0,0 +1,70 @@
+.define k = 3
+.extern X1
+jmp L7
+jmp L6
+L9: mov r4, r3
+L10: cmp r2, #-2
+cmp r3, #-2
+mov r1, r2
+L2: jmp L5
+L5: hlt
+mov r0, r0
+ inc r5
+L11: dec r5
+bne L3
+L8: bne L2
+L3: mov r4, r4
+mov r4, r2
+mov r4, r4
+bne L8
+lea DAT, r2
+mov r6, r6
+L7: jmp L9
+bne L0
+L6: cmp L0, #1
+ inc DAT[1]
+dec DAT[1]
+L0: red r1
+inc r1
+cmp r1, #1
+L4: jmp L4
+
+red r6
+prn #k
+L1: dec r1
+mov r7, r7
+jmp L7
+
+red r1
+cmp L3, #-2
+red r1
+red r4
+jmp L3
+mov r2, r2
+jmp L2
+inc r7
+cmp DAT[2], #1
+red r5
+jmp L5
+jmp L3
+add r1, r2
+ dec L1
+dec L1
+cmp r3, #k
+dec r7
+
+mov r5, r5
+cmp DAT[k], #1
+ inc X1
+dec X1
+; comment
+jmp L4
+prn #k
+jmp L2
+bne L9
+inc r2
+jmp L0
+cmp L3, #1
+ hlt
+DAT: .data 1, 2, 3, k
+.entry L2
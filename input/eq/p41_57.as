@@ -0,0 +1,73 @@
+.define k = 3
+.extern X1
+L9: jmp L3
+L3: inc r2
+red r6
+L2: jmp L9
+mov r7, r7
+jmp L9
+red r6
+cmp r3, r4
+ dec r7
+dec r7
+ inc DAT[zz]
+L7: dec DAT[zz]
+ inc L4
+inc L4
+L10: cmp r4, #-2
+mov r1, r0
+cmp r3, #-2
+L1: not r1
+cmp r2, #-2
+jmp L6
+L6: inc r2
+L0: ; comment
+L5: mov r0, r7
+mov r4, r4
+ inc r6
+L11: dec r6
+ dec r0
+inc r0
+bne L6
+L8: bne L0
+L4: bne L2
+jmp L0
+ inc DAT[k]
+inc DAT[k]
+mov r3, r3
+clr L1
+
+red r7
+mov r0, r0
+jmp L1
+cmp DAT[zz], #k
+cmp r3, #-2
+mov r4, r4
+jmp L8
+red r5
+cmp DAT[k], #k
+jmp L2
+mov r1 r2
+red r5
+bne L6
+mov r5, r5
+mov r7, r1
+jmp L5
+lea DAT, r2
+
+jmp L8
+mov r3, r3
+cmp DAT[zz], #-2
+red r4
+
+red r1
+mov r3, r2
+jmp L8
+bne L6
+cmp r2, #k
+cmp r7, #k
+lea DAT, r2
+red r5
+ hlt
+DAT: .data 1, 2, 3, k
+.entry L1
@@ -0,0 +1,71 @@
+.define k = 3
+.extern X1
+cmp L3, r7
+cmp r7, #k
+mov r7, r7
+ inc L5
+inc L5
+cmp r2, #1
+L7: mov r2, r3
+L4: bne L1
+; comment
+jmp L5
+L5: rts
+cmp r3, #-2
+mov r4, r4
+cmp r1, #1
+mov r1, r1
+L0: jmp L4
+red r5
+mov r5, r2
+L6: bne L5
+not r1
+L11: red r3
+mov r0, r0
+
+jmp L5
+dec r6
+mov r1, r1
+cmp r1, DAT[2]
+mov r3, r3
+cmp DAT[k], #1
+L1: jmp L1
+L10: mov r3, r3
+inc r3
+L9: dec r3
+ dec DAT[2]
+dec DAT[2]
+L2: clr L1
+cmp L7, #k
+mov r7, r7
+jmp L7
+L3: jmp L9
+; comment
+L8: bne L9
+red r6
+inc L6
+bne L8
+; comment
+inc r5
+red r2
+ inc L3
+inc L3
+red r0
+clr L1
+cmp r6, #k
+clr L1
+cmp r7, #1
+red r2
+cmp r2, #-2
+cmp r2, r0
+ dec r1
+inc r1
+add r1, r2
+jmp L2
+; comment
+ inc DAT[k]
+dec DAT[k]
+mov r6, r6
+ hlt
+DAT: .data 1, 2, 3, k
+.entry L0
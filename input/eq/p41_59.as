@@ -0,0 +1,76 @@
+.define k = 3
+.extern X1
+red r7
+L4: bne L9
+L8: dec DAT[2]
+ inc X1
+inc X1
+ inc r1
+inc r1
+red r1
+jmp L6
+L6: hlt
+jmp L3
+L3: inc r2
+jmp L2
+L10: jmp L8
+lea DAT, r2
+ inc r7
+L1: dec r7
+bne L5
+lea DAT, r2
+dec DAT
+L7: ; comment
+ inc DAT[k]
+L11: dec DAT[k]
+jmp L5
+L5: mov r7, r1
+cmp r3, #1
+ inc DAT[k]
+dec DAT[k]
+L9: mov r4, r4
+prn #k
+; comment
+cmp r2, #-2
+L0: prn #k
+L2: mov r3, r3
+add r1, r2
+cmp L7, DAT[k]
+mov r6, r6
+ dec X1
+inc X1
+clr L1
+jmp L3
+red r4
+bne L4
+dec r3
+jmp L8
+not r1
+mov r4, r4
+cmp L7, #1
+bne L5
+jmp L8
+mov r2, r1
+ inc DAT[2]
+dec DAT[2]
+ dec r6
+inc r6
+red r6
+ inc r4
+inc r4
+mov r0, r0
+jmp L2
+cmp r6, #1
+ dec r4
+inc r4
+mov r6, r6
+mov r2, r2
+cmp r5, #1
+red r4
+cmp r2, DAT[2]
+jmp L8
+red r3
+red r1
+cmp r3, #-2
+ hlt
+DAT: .data 1, 2, 3, k
@@ -0,0 +1,74 @@
+.define k = 3
+.extern X1
+; comment
+cmp r7, #k
+cmp DAT[zz], #-2
+bne L4
+jmp L1
+mov r6, r7
+prn #k
+cmp r3, DAT[2]
+red r0
+cmp r5, #-2
+L10: cmp DAT[zz], #-2
+mov r1 r2
+cmp r5, #k
+jmp L4
+L4: inc r2
+L7: jmp L6
+L6: inc r2
+red r7
+
+jmp L7
+red r3
+cmp r2, #k
+dec r7
+dec r7
+dec DAT[zz]
+ dec r6
+dec r6
+sub #4, r3
+cmp r7, #1
+jmp L5
+L5: inc r2
+mov r3, r3
+mov r7, r7
+ dec r3
+inc r3
+mov r7, r7
+jmp L8
+L8: hlt
+L11: red r7
+mov r2, r3
+ dec DAT[zz]
+inc DAT[zz]
+cmp r5, #k
+red r6
+ inc DAT[k]
+inc DAT[k]
+ dec r3
+inc r3
+ inc r7
+L0: dec r7
+mov r2, r2
+jmp L6
+bne L2
+cmp r3, L0
+L3: 
+mov r2, r5
+cmp r2, #1
+L1: mov r1, r1
+mov r3, r3
+bne L4
+L2: add r1, r2
+L9: mov r1, r2
+red r6
+cmp r3, #k
+cmp DAT[2], #1
+bne L3
+mov r5, r5
+mov r2, r2
+inc r4
+cmp r2, r6
+ hlt
+DAT: .data 1, 2, 3, k
@@ -0,0 +1,74 @@
+.define k = 3
+.extern X1
+jmp L4
+L4: inc r2
+ inc r1
+inc r1
+add r1, r2
+sub #4, r3
+jmp L2
+L2: hlt
+mov r4, r4
+cmp DAT[2], #-2
+cmp DAT[k], #k
+ inc r1
+inc r1
+L8: bne L8
+red r6
+
+L7: red r1
+jmp L6
+L6: prn r1
+mov r3, r3
+L5: mov r7, r6
+red r3
+cmp L7, #1
+mov r1 r2
+cmp r4, #1
+cmp r2, #k
+red r2
+ inc r5
+inc r5
+cmp r7, #-2
+
+cmp NOPE, #k
+L1: jmp L5
+bne L6
+L11: ; comment
+mov r1 r2
+L9: inc r0
+L0: clr L1
+mov r2, r2
+cmp r7, #-2
+jmp L1
+inc r3
+mov r0, r6
+L3: bne L8
+L10: jmp L1
+bne L4
+red r6
+mov r2, r2
+cmp r0, #-2
+jmp L7
+ dec r5
+inc r5
+ dec r7
+dec r7
+prn #k
+red r3
+red r3
+cmp DAT[2], #k
+jmp L2
+mov r1 r2
+jmp L1
+
+not r1
+cmp L0, #1
+cmp DAT[1], #k
+red r7
+ inc r5
+inc r5
+jmp L5
+ hlt
+DAT: .data 1, 2, 3, k
+.entry L1
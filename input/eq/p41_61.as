@@ -0,0 +1,70 @@
+.define k = 3
+.extern X1
+jmp L5
+L5: hlt
+ inc r5
+inc r5
+bne L2
+dec r6
+
+ dec r2
+inc r2
+L0: jmp L7
+L7: inc r2
+L6: red r6
+L11: inc r3
+mov r7, r7
+cmp r7, r4
+inc r5
+red r7
+mov r1, r2
+L1: sub #4, r3
+cmp DAT[k], #1
+cmp r6, #-2
+mov r2, r2
+ dec r4
+L3: dec r4
+bne L6
+clr L1
+sub #4, r3
+bne L7
+L4: bne L9
+mov r5, r5
+red r4
+dec r2
+red r5
+bne L2
+jmp L1
+mov r4, r7
+L9: mov r6, r6
+cmp DAT[k], r1
+cmp DAT[1], #1
+cmp r2, #-2
+not r1
+ dec r4
+L10: inc r4
+cmp L5, #1
+jmp L6
+cmp L3, #1
+L2: dec r3
+mov r3, r3
+mov r5, r5
+jmp L7
+L8: mov r0, r0
+mov r2, r2
+
+mov r1, r1
+sub #4, r3
+mov r3, r3
+mov r1, r1
+jmp L5
+jmp L4
+cmp DAT[2], r3
+cmp r1, #-2
+dec r5
+dec r7
+jmp L5
+mov r4, r4
+jmp L8
+ hlt
+DAT: .data 1, 2, 3, k
@@ -0,0 +1,77 @@
+.define k = 3
+.extern X1
+cmp r3, #k
+L2: cmp r2, r0
+mov r5, r2
+bne L5
+jmp L9
+L9: prn r1
+dec r0
+cmp L3, #-2
+L4: mov r5, r5
+ dec r2
+dec r2
+inc r1
+ dec DAT[1]
+inc DAT[1]
+mov r4, r4
+red r7
+jmp L0
+L0: hlt
+red r4
+bne L9
+cmp DAT[1], L5
+mov r0, r0
+clr L1
+sub #4, r3
+clr L1
+jmp L8
+ inc r4
+dec r4
+ inc r7
+dec r7
+ inc DAT[2]
+L5: dec DAT[2]
+ dec X1
+inc X1
+red r5
+bne L0
+jmp L0
+jmp L3
+L3: inc r2
+red r5
+
+mov r5, r5
+jmp L2
+cmp r5, L7
+L7: jmp L9
+bne L4
+mov r2, r2
+jmp L3
+ inc L5
+inc L5
+L11: red r3
+L6: mov r2, r2
+cmp DAT[2], r0
+cmp r7, #-2
+mov r7, r7
+cmp r5, #-2
+ dec r0
+dec r0
+cmp r1, #k
+cmp r3, #k
+mov r1, r1
+ inc r1
+dec r1
+L8: red r6
+L10: mov r4, r6
+bne L5
+red r7
+mov r1, r1
+L1: bne L8
+red r5
+red r2
+ dec DAT[1]
+dec DAT[1]
+ hlt
+DAT: .data 1, 2, 3, k
@@ -0,0 +1,76 @@
+.define k = 3
+.extern X1
+cmp r7, #1
+L3: cmp DAT[2], #-2
+red r2
+cmp L0, #-2
+jmp L6
+cmp r0, #1
+L2: jmp L6
+L0: dec r1
+bne L8
+L11: cmp r7, #k
+prn #k
+cmp r6, #-2
+L1: inc r6
+clr L1
+cmp L7, #1
+jmp L7
+L7: inc r2
+red r3
+inc r5
+ inc r7
+dec r7
+not r1
+ dec r7
+dec r7
+L9: dec r4
+prn #k
+L5: ; comment
+ inc DAT
+L8: inc DAT
+jmp L4
+L4: prn r1
+mov r0, r0
+ dec r6
+inc r6
+jmp L9
+dec DAT[2]
+L10: mov r4, r4
+bne L7
+ dec r7
+inc r7
+ dec r1
+inc r1
+jmp L6
+L6: prn r1
+cmp r7, #1
+jmp L9
+jmp L5
+ inc L4
+inc L4
+bne L4
+dec r5
+mov r6, r6
+inc r1
+cmp r6, #1
+cmp r1, #-2
+mov r2, r0
+jmp L6
+dec L0
+red r2
+mov r1 r2
+mov r7, r7
+jmp L1
+mov r7, r7
+mov r5, r5
+cmp r7, #k
+inc r5
+ inc L7
+dec L7
+jmp L8
+ inc L7
+inc L7
+cmp L1, r0
+ hlt
+DAT: .data 1, 2, 3, k
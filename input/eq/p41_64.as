@@ -0,0 +1,78 @@
+.define k = 3
+.extern X1
+jmp L6
+L6: hlt
+cmp r3, #1
+dec DAT[1]
+L1: cmp DAT, #1
+not r1
+cmp r6, #k
+jmp L0
+L0: inc r2
+L5: mov r4, r4
+prn #k
+ dec r2
+inc r2
+red r3
+mov r4, r4
+bne L2
+; comment
+mov r1, r1
+
+red r4
+red r7
+L11: inc L0
+bne L2
+red r1
+ dec L6
+dec L6
+bne L4
+jmp L2
+L2: rts
+bne L7
+ inc r4
+dec r4
+mov r1, r1
+red r7
+L9: clr L1
+L10: clr L1
+inc r2
+jmp L3
+red r6
+L4: jmp L2
+inc DAT[k]
+cmp r7, #-2
+cmp r2, #1
+bne L2
+red r4
+inc r4
+; comment
+ dec DAT[k]
+inc DAT[k]
+add r1, r2
+red r2
+ dec r0
+dec r0
+mov r3, r3
+bne L9
+inc DAT[k]
+bne L3
+cmp L4, r2
+ dec L6
+inc L6
+ dec DAT[k]
+dec DAT[k]
+inc r4
+mov r0, r0
+ inc DAT[1]
+dec DAT[1]
+L8: mov r2, r2
+ inc r0
+inc r0
+cmp r6, #1
+red r7
+L7: mov r3, r3
+ hlt
+L3: hlt
+DAT: .data 1, 2, 3, k
+.entry L1
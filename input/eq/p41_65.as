@@ -0,0 +1,74 @@
+.define k = 3
+.extern X1
+cmp DAT[k], #k
+ dec r7
+dec r7
+mov r1, r1
+mov r1, r1
+jmp L5
+red r3
+ dec L0
+dec L0
+cmp r6, #-2
+cmp DAT[k], #k
+cmp r5, #k
+cmp r2, #-2
+L11: dec DAT[2]
+red r6
+L7: red r4
+
+red r2
+ inc DAT[1]
+dec DAT[1]
+mov r2, r2
+cmp r4, #-2
+jmp L8
+L8: hlt
+jmp L8
+cmp L6, #-2
+ inc r4
+dec r4
+bne L1
+mov r2, r2
+jmp L5
+L5: hlt
+mov r7, r7
+lea DAT, r2
+jmp L4
+cmp L2, #-2
+not r1
+
+cmp r3, #1
+mov r3, r3
+cmp DAT[1], #1
+
+L0: bne L5
+mov r0, r7
+; comment
+L6: jmp L1
+; comment
+red r1
+L3: jmp L9
+L9: prn r1
+red r0
+jmp L4
+mov r1, r1
+prn #k
+jmp L8
+jmp L7
+mov r5, r5
+L2: add r1, r2
+ dec r2
+inc r2
+ dec r3
+dec r3
+bne L1
+L4: red r6
+ dec r0
+inc r0
+jmp L3
+jmp L0
+mov r2, r4
+L1: mov r0, r0
+ hlt
+DAT: .data 1, 2, 3, k
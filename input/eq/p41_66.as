@@ -0,0 +1,74 @@
+.define k = 3
+.extern X1
+L6: red r7
+red r1
+red r7
+L9: mov r1, r2
+bne L8
+L1: 
+dec r3
+ inc r4
+inc r4
+ dec L5
+inc L5
+mov r1, r1
+mov r6, r6
+ inc DAT[2]
+L8: dec DAT[2]
+; comment
+red r7
+jmp L2
+mov r0, r5
+mov r0, r0
+L3: add r1, r2
+mov r1, r1
+jmp L9
+not r1
+mov r7, r7
+
+cmp r5, DAT[k]
+L2: bne L9
+mov r0, r6
+mov r1 r2
+L10: cmp r4, DAT[zz]
+bne L1
+ inc r0
+dec r0
+ inc DAT[1]
+dec DAT[1]
+cmp DAT[k], #-2
+mov r1, r4
+sub #4, r3
+mov r1 r2
+red r2
+mov r4, r4
+prn #k
+ dec r6
+dec r6
+jmp L3
+ inc DAT[1]
+dec DAT[1]
+; comment
+inc r7
+inc r4
+L0: red r5
+red r3
+bne L4
+L7: bne L8
+L11: dec r5
+L4: jmp L3
+red r3
+cmp r4, #-2
+ inc DAT
+dec DAT
+L5: jmp L4
+jmp L0
+cmp DAT[zz], #-2
+ inc DAT[1]
+inc DAT[1]
+jmp L6
+jmp L4
+red r0
+ hlt
+DAT: .data 1, 2, 3, k
+.entry L2
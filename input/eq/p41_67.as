@@ -0,0 +1,69 @@
+.define k = 3
+.extern X1
+L6: red r6
+jmp L7
+cmp r2, r2
+L11: mov r4, r4
+jmp L6
+sub #4, r3
+red r0
+dec DAT[1]
+cmp L0, #k
+mov r0, r3
+dec r0
+mov r3, r3
+L7: cmp r6, r7
+cmp r2, #-2
+ dec r6
+inc r6
+mov r3, r3
+L4: red r4
+jmp L7
+L5: jmp L9
+red r3
+L3: not r1
+inc r5
+bne L0
+red r3
+mov r7, r7
+L9: mov r4, r4
+mov r1, r1
+
+red r4
+jmp L6
+ inc r2
+inc r2
+mov r3, r3
+jmp L0
+L0: inc r2
+dec r5
+jmp L8
+inc r5
+cmp r2, L2
+jmp L3
+red r4
+mov r5, r5
+mov r3, r0
+jmp L9
+mov r6, r6
+prn #k
+dec r4
+bne L6
+mov r3, r3
+jmp L0
+mov r5, r2
+L8: cmp DAT[2], #1
+jmp L7
+red r4
+jmp L2
+L2: rts
+red r0
+sub #4, r3
+L1: prn #k
+cmp DAT[1], r2
+sub #4, r3
+red r0
+red r3
+ hlt
+DAT: .data 1, 2, 3, k
+.entry L2
@@ -0,0 +1,74 @@
+.define k = 3
+.extern X1
+red r1
+cmp r5, #-2
+add r1, r2
+L11: inc r0
+L3: mov r6, r6
+mov r0, r0
+jmp L5
+L5: hlt
+ inc L4
+L9: dec L4
+mov r4, r4
+mov r6, r6
+L4: mov r5, r4
+red r3
+ dec DAT[2]
+dec DAT[2]
+mov r1, r1
+; comment
+red r5
+ inc r1
+inc r1
+dec r7
+ dec r4
+inc r4
+; comment
+bne L9
+red r5
+mov r7, r7
+mov r3, r3
+cmp DAT[1], #-2
+; comment
+red r4
+ dec r1
+dec r1
+
+L7: red r4
+ inc r7
+dec r7
+ dec r5
+inc r5
+jmp L4
+L2: cmp DAT[2], #-2
+red r3
+mov r2, r2
+not r1
+mov r1, r1
+jmp L7
+
+L1: jmp L9
+L0: dec r2
+ inc r3
+L10: inc r3
+jmp L1
+L6: ; comment
+cmp r2, #1
+; comment
+red r2
+L8: mov r4, r4
+not r1
+bne L2
+sub #4, r3
+red r5
+red r1
+mov r1, r1
+red r1
+inc DAT[1]
+jmp L7
+not r1
+jmp L8
+ hlt
+DAT: .data 1, 2, 3, k
+.entry L1
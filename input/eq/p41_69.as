@@ -0,0 +1,77 @@
+.define k = 3
+.extern X1
+mov r2, r2
+red r6
+ dec r5
+dec r5
+L4: mov r2, r3
+bne L8
+mov r6, r1
+clr L1
+mov r1, r1
+L3: cmp r1, DAT[2]
+L1: lea DAT, r2
+bne L4
+L10: jmp L7
+L7: rts
+jmp L6
+L6: prn r1
+lea DAT, r2
+mov r5, r5
+ dec r7
+dec r7
+cmp r6, #k
+mov r1, r1
+ dec r3
+dec r3
+red r1
+mov r7, r7
+bne L5
+L8: jmp L9
+; comment
+mov r4, r4
+jmp L2
+L2: hlt
+lea DAT, r2
+jmp L7
+ dec r6
+dec r6
+not r1
+mov r7, r2
+ inc DAT
+L5: dec DAT
+mov r0, r5
+L9: cmp DAT[zz], r2
+ dec r5
+inc r5
+L11: add r1, r2
+L0: cmp r1, #1
+ inc L3
+dec L3
+jmp L0
+cmp r1, #-2
+mov r6, r4
+jmp L4
+lea DAT, r2
+mov r1, r7
+cmp r5, #1
+red r6
+mov r6, r4
+cmp r3, #1
+ dec r2
+inc r2
+mov r5, r5
+inc r5
+bne L1
+ inc r0
+dec r0
+mov r1, r1
+jmp L3
+bne L6
+red r6
+prn #k
+; comment
+jmp L1
+ hlt
+DAT: .data 1, 2, 3, k
+.entry L0
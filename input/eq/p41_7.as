@@ -0,0 +1,73 @@
+.define k = 3
+.extern X1
+cmp L1, #k
+red r3
+L6: inc r6
+L3: jmp L9
+ inc r0
+inc r0
+jmp L8
+L11: jmp L3
+mov r0, r0
+jmp L5
+L5: inc r2
+cmp r3, r4
+lea DAT, r2
+mov r6, r6
+red r6
+L1: clr L1
+; comment
+inc r7
+dec L0
+; comment
+ dec L0
+inc L0
+cmp r3, #1
+L7: jmp L2
+cmp r5, #-2
+L2: cmp L0, #k
+mov r5, r5
+mov r0, r0
+red r6
+ inc r6
+inc r6
+mov r0, r0
+jmp L5
+L4: jmp L2
+jmp L7
+red r7
+ dec r5
+inc r5
+cmp r5, #k
+red r4
+red r5
+jmp L8
+L8: rts
+sub #4, r3
+; comment
+cmp L5, #k
+cmp L5, #k
+L0: cmp r3, r0
+dec L1
+inc r5
+ inc r1
+inc r1
+L10: ; comment
+L9: bne L5
+jmp L0
+jmp L8
+red r3
+cmp r4, #k
+dec r5
+jmp L8
+jmp L7
+sub #4, r3
+ inc DAT[2]
+dec DAT[2]
+mov r0, r0
+clr L1
+mov r1, r1
+jmp L8
+ hlt
+DAT: .data 1, 2, 3, k
+.entry L2
@@ -0,0 +1,79 @@
+.define k = 3
+.extern X1
+cmp r2, #-2
+bne L3
+ inc r6
+dec r6
+red r1
+ dec r0
+L7: inc r0
+
+mov r5, r3
+mov r0, r0
+prn #k
+red r5
+cmp r1, #1
+L6: clr L1
+jmp L1
+bne L1
+jmp L1
+mov r3, r3
+L0: red r6
+mov r7, r7
+ dec r4
+L9: dec r4
+mov r0, r0
+inc r1
+bne L6
+add r1, r2
+red r3
+mov r7, r7
+L3: inc L5
+clr L1
+jmp L5
+L5: rts
+bne L4
+jmp L8
+L8: hlt
+
+bne L2
+dec r5
+L4: jmp L2
+jmp L0
+L1: mov r3, r3
+jmp L8
+cmp r6, #1
+mov r4, r4
+ inc r2
+inc r2
+ inc r3
+dec r3
+bne L9
+ inc r1
+inc r1
+jmp L6
+ inc r6
+dec r6
+L11: jmp L5
+ dec DAT[1]
+dec DAT[1]
+jmp L1
+ dec r4
+dec r4
+ inc r7
+inc r7
+
+mov r3, r3
+jmp L1
+red r1
+; comment
+red r1
+cmp L0, #1
+inc L2
+red r4
+ dec r3
+inc r3
+ hlt
+L2: hlt
+DAT: .data 1, 2, 3, k
+.entry L2
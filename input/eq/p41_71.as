@@ -0,0 +1,77 @@
+.define k = 3
+.extern X1
+jmp L0
+L0: rts
+red r4
+L9: mov r3, r3
+jmp L7
+cmp r0, #-2
+
+mov r0, r0
+L4: ; comment
+ dec L4
+inc L4
+L5: mov r2, r2
+jmp L5
+L7: jmp L2
+L2: inc r2
+cmp DAT, #1
+L3: cmp r4, #-2
+ inc r2
+dec r2
+ dec r4
+dec r4
+jmp L7
+cmp r4, L0
+dec r2
+ dec r4
+dec r4
+clr L1
+bne L0
+dec r4
+L10: jmp L1
+cmp DAT[2], L6
+ inc L2
+L11: dec L2
+jmp L2
+mov r2, r2
+mov r2, r2
+red r7
+mov r5, r1
+red r4
+ dec r0
+dec r0
+L8: prn #k
+cmp r4, #1
+; comment
+cmp r3, #1
+cmp r3, #k
+L6: red r4
+jmp L6
+jmp L1
+L1: inc r2
+mov r3, r3
+inc DAT[1]
+cmp L3, L3
+not r1
+cmp DAT[1], #-2
+cmp r7, #k
+ inc DAT[2]
+inc DAT[2]
+jmp L4
+ dec r5
+inc r5
+cmp r5, #k
+cmp r4, #1
+red r1
+jmp L3
+
+ dec r0
+dec r0
+mov r2, r2
+cmp r5, #k
+mov r1, r1
+cmp L2, #1
+ hlt
+DAT: .data 1, 2, 3, k
+.entry L0
@@ -0,0 +1,70 @@
+.define k = 3
+.extern X1
+L9: sub #4, r3
+jmp L5
+L5: rts
+bne L5
+mov r0, r0
+; comment
+add r1, r2
+not r1
+cmp r5, #k
+bne L4
+red r5
+L3: mov r5, r5
+
+L0: red r7
+L11: jmp L6
+L6: inc r2
+bne L4
+red r0
+L10: dec r3
+not r1
+mov r7, r7
+ inc NOPE
+dec NOPE
+jmp L3
+dec r1
+inc r4
+cmp L6, #k
+red r6
+mov r3, r3
+mov r5, r5
+mov r6, r6
+L8: red r5
+bne L9
+jmp L3
+mov r1 r2
+L1: 
+; comment
+L2: mov r0, r5
+
+mov r1, r3
+ dec r1
+dec r1
+cmp r2, r2
+L7: jmp L4
+L4: prn r1
+bne L8
+jmp L3
+jmp L1
+ dec r6
+inc r6
+jmp L4
+jmp L0
+jmp L4
+jmp L2
+not r1
+red r7
+red r2
+bne L4
+red r4
+inc r7
+cmp r2, #-2
+mov r1 r2
+inc DAT[zz]
+jmp L0
+red r7
+; comment
+ hlt
+DAT: .data 1, 2, 3, k
@@ -0,0 +1,75 @@
+.define k = 3
+.extern X1
+jmp L9
+L9: prn r1
+ dec L3
+dec L3
+
+jmp L7
+L7: inc r2
+L0: red r3
+bne L1
+lea DAT, r2
+cmp r4, #-2
+red r6
+L2: bne L3
+ inc DAT[k]
+L4: dec DAT[k]
+inc DAT[k]
+ inc r7
+inc r7
+jmp L4
+bne L1
+add r1, r2
+L10: red r7
+mov r3, r3
+mov r4, r4
+not r1
+L11: jmp L9
+bne L0
+cmp r3, #-2
+; comment
+ inc L4
+L8: dec L4
+inc r6
+jmp L1
+L1: hlt
+ dec DAT[2]
+L6: dec DAT[2]
+red r7
+add r1, r2
+jmp L1
+cmp L5, #k
+dec r0
+mov r7, r7
+inc DAT[2]
+jmp L8
+bne L1
+ inc r3
+dec r3
+cmp DAT[1], L3
+red r2
+red r3
+bne L1
+cmp L5, #1
+inc r5
+bne L5
+red r2
+cmp L3, r6
+L3: jmp L8
+mov r2, r2
+L5: jmp L4
+red r5
+red r5
+mov r5, r5
+
+cmp r2, #1
+cmp X1, #1
+jmp L5
+sub #4, r3
+ dec DAT
+dec DAT
+cmp r1, #k
+ hlt
+DAT: .data 1, 2, 3, k
+.entry L1
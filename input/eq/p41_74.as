@@ -0,0 +1,79 @@
+.define k = 3
+.extern X1
+jmp L1
+L1: prn r1
+ dec r7
+L4: dec r7
+jmp L8
+L8: rts
+red r6
+cmp L6, #-2
+prn #k
+mov r0, r0
+mov r7, r2
+jmp L6
+L6: inc r2
+cmp r0, #-2
+cmp r0, #k
+ dec r2
+inc r2
+ dec r1
+dec r1
+mov r7, r7
+red r4
+ inc r0
+dec r0
+red r2
+red r2
+lea DAT, r2
+sub #4, r3
+; comment
+; comment
+red r6
+ inc r6
+inc r6
+L9: cmp r2, #1
+ inc L2
+inc L2
+L5: mov r6, r4
+dec DAT
+L3: 
+jmp L3
+ dec r6
+dec r6
+inc r3
+ inc r0
+dec r0
+L10: mov r1, r7
+; comment
+cmp r3, #k
+mov r3, r4
+bne L6
+red r6
+ dec L0
+inc L0
+L0: red r5
+cmp r6, r3
+
+ inc r0
+inc r0
+red r0
+dec r2
+red r1
+jmp L8
+bne L0
+prn #k
+
+; comment
+bne L1
+L11: red r6
+mov r6, r2
+bne L6
+jmp L7
+cmp r0, r7
+L7: bne L9
+mov r0, r0
+ hlt
+L2: hlt
+DAT: .data 1, 2, 3, k
+.entry L0
@@ -0,0 +1,79 @@
+.define k = 3
+.extern X1
+ dec r7
+dec r7
+lea DAT, r2
+mov r1 r2
+bne L4
+dec NOPE
+L3: mov r1 r2
+red r2
+mov r0, r0
+cmp r6, #k
+mov r7, r7
+cmp r0, #k
+mov r2, r7
+L5: jmp L5
+ dec DAT[1]
+dec DAT[1]
+ dec r6
+dec r6
+jmp L5
+L7: jmp L9
+L9: prn r1
+ inc r3
+inc r3
+inc DAT[zz]
+ inc DAT[2]
+inc DAT[2]
+ inc L6
+inc L6
+
+cmp r5, #k
+cmp r5, #-2
+inc r6
+L0: cmp r5, #k
+cmp r5, #-2
+red r6
+L11: cmp DAT[k], r1
+L4: ; comment
+; comment
+mov r7, r7
+jmp L1
+L1: rts
+L2: inc r2
+ dec r7
+inc r7
+L8: red r7
+ dec X1
+L6: inc X1
+mov r3, r3
+jmp L8
+mov r2, r2
+mov r4, r4
+L10: red r5
+ inc r4
+dec r4
+dec r3
+
+jmp L4
+ inc L0
+dec L0
+bne L1
+red r4
+inc r4
+ inc r0
+dec r0
+
+cmp r5, #-2
+ inc r3
+inc r3
+bne L1
+inc r3
+cmp r3, X1
+bne L2
+
+red r1
+ hlt
+DAT: .data 1, 2, 3, k
+.entry L1
@@ -0,0 +1,75 @@
+.define k = 3
+.extern X1
+red r3
+mov r3, r3
+ dec r5
+inc r5
+L6: jmp L9
+cmp L0, #-2
+L11: red r1
+cmp X1, #-2
+red r7
+L10: jmp L6
+red r7
+cmp r5, #-2
+red r0
+L1: jmp L0
+L0: hlt
+ inc r1
+inc r1
+add r1, r2
+clr L1
+inc X1
+bne L1
+L5: red r1
+L7: red r6
+ dec r0
+inc r0
+mov r3, r3
+jmp L4
+L4: prn r1
+; comment
+mov r7, r7
+bne L3
+L8: bne L7
+mov r2, r4
+L9: jmp L9
+red r2
+not r1
+ inc r5
+inc r5
+ inc DAT[k]
+L2: dec DAT[k]
+jmp L2
+mov r0, r0
+ dec r0
+inc r0
+jmp L2
+red r4
+jmp L7
+mov r2, r2
+mov r3, r3
+L3: jmp L2
+dec L4
+ dec L1
+inc L1
+cmp DAT[1], #1
+add r1, r2
+mov r1, r1
+sub #4, r3
+bne L7
+jmp L7
+mov r1, r1
+ inc L5
+dec L5
+; comment
+cmp DAT[1], #-2
+ inc DAT[1]
+dec DAT[1]
+cmp L6, DAT[k]
+jmp L6
+mov r5, r5
+jmp L8
+jmp L2
+ hlt
+DAT: .data 1, 2, 3, k
@@ -0,0 +1,73 @@
+.define k = 3
+.extern X1
+ dec r1
+inc r1
+L10: bne L0
+mov r7, r7
+jmp L6
+L6: prn r1
+L9: clr L1
+cmp r3, #1
+L3: add r1, r2
+L11: ; comment
+add r1, r2
+jmp L8
+jmp L6
+jmp L3
+mov r6, r6
+mov r0, r6
+L5: red r7
+L4: ; comment
+mov r1, r1
+ inc DAT[k]
+dec DAT[k]
+L0: bne L3
+L8: mov r6, r1
+mov r4, r4
+cmp r0, r3
+jmp L9
+jmp L1
+L1: inc r2
+cmp r3, #1
+L2: mov r1, r1
+sub #4, r3
+L7: cmp r6, #k
+red r1
+dec r4
+ dec DAT[2]
+dec DAT[2]
+cmp r4, #1
+inc DAT[1]
+jmp L9
+clr L1
+bne L2
+cmp r0, DAT
+bne L1
+jmp L0
+mov r6, r1
+mov r6, r0
+jmp L4
+jmp L2
+mov r6, r6
+sub #4, r3
+lea DAT, r2
+cmp r6, #-2
+mov r4, r4
+red r6
+jmp L3
+red r5
+
+ inc r3
+inc r3
+cmp r4, L6
+red r1
+; comment
+ dec r2
+dec r2
+cmp r4, r7
+mov r1, r1
+ dec r1
+inc r1
+ hlt
+DAT: .data 1, 2, 3, k
+.entry L0
@@ -0,0 +1,76 @@
+.define k = 3
+.extern X1
+mov r4, r0
+red r6
+cmp L6, #-2
+ inc r6
+dec r6
+cmp r2, #k
+
+bne L6
+red r1
+jmp L1
+L1: prn r1
+not r1
+bne L2
+L6: inc L4
+mov r1 r2
+L8: cmp r1, #-2
+ dec r6
+L4: inc r6
+; comment
+mov r1 r2
+L5: jmp L4
+red r4
+mov r1 r2
+mov r2, r2
+add r1, r2
+ inc r6
+dec r6
+jmp L7
+ inc r2
+dec r2
+mov r2, r1
+bne L5
+jmp L3
+L3: prn r1
+bne L4
+mov r7, r7
+bne L6
+jmp L6
+mov r7, r5
+mov r2, r2
+inc r7
+clr L1
+L0: cmp r4, #1
+dec L0
+; comment
+mov r3, r5
+prn #k
+ inc r2
+dec r2
+ dec r3
+L2: dec r3
+dec r7
+jmp L8
+L10: cmp r7, r4
+ dec r4
+dec r4
+dec r7
+red r1
+jmp L0
+lea DAT, r2
+cmp r5, #k
+cmp r1, #-2
+bne L9
+cmp r1, NOPE
+ dec r3
+inc r3
+sub #4, r3
+mov r1 r2
+mov r3, r3
+L11: jmp L3
+ hlt
+L7: hlt
+L9: hlt
+DAT: .data 1, 2, 3, k
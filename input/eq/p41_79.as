@@ -0,0 +1,71 @@
+.define k = 3
+.extern X1
+L5: jmp L3
+L3: inc r2
+L7: mov r1, r7
+cmp r5, L1
+L10: mov r5, r7
+red r7
+L1: cmp r5, r5
+mov r5, r2
+red r4
+add r1, r2
+bne L2
+jmp L8
+lea DAT, r2
+L11: red r6
+L0: mov r3, r3
+cmp r3, #-2
+jmp L0
+mov r1, r1
+ dec r2
+dec r2
+cmp r4, #1
+L6: inc DAT[2]
+bne L5
+; comment
+inc DAT[k]
+cmp r3, #k
+mov r7, r7
+add r1, r2
+red r2
+jmp L6
+mov r1, r1
+red r4
+bne L8
+ dec r0
+dec r0
+cmp L7, r5
+dec r1
+cmp r5, #-2
+jmp L9
+L9: prn r1
+mov r5, r5
+jmp L4
+L4: inc r2
+cmp r5, r5
+inc r3
+jmp L0
+jmp L9
+red r6
+L8: 
+cmp r3, #-2
+cmp L5, r4
+ dec L4
+dec L4
+red r7
+L2: jmp L8
+
+dec r5
+mov r3, r6
+cmp r4, #k
+red r2
+cmp r4, #k
+ inc r1
+dec r1
+bne L4
+jmp L9
+bne L1
+bne L6
+ hlt
+DAT: .data 1, 2, 3, k
@@ -0,0 +1,70 @@
+.define k = 3
+.extern X1
+red r2
+L0: mov r3, r3
+mov r7, r7
+cmp DAT[1], #k
+ dec r1
+inc r1
+; comment
+ inc L7
+L1: inc L7
+jmp L0
+ dec L7
+L11: dec L7
+L3: jmp L5
+
+cmp r4, #-2
+red r4
+cmp r6, #-2
+mov r0, r0
+dec r6
+red r2
+dec r1
+L4: clr L1
+; comment
+bne L9
+L2: red r5
+jmp L4
+mov r7, r7
+mov r2, r2
+dec r3
+inc r7
+mov r7, r7
+ dec r0
+inc r0
+bne L9
+bne L6
+red r3
+ inc r3
+dec r3
+not r1
+cmp L5, #k
+jmp L5
+
+ inc L4
+L7: dec L4
+bne L5
+jmp L5
+L10: jmp L1
+L8: red r1
+; comment
+cmp DAT[k], #-2
+red r7
+; comment
+; comment
+add r1, r2
+bne L9
+red r2
+L5: bne L1
+L9: red r4
+mov r5, r1
+mov r1, r5
+mov r3, r5
+lea DAT, r2
+L6: red r5
+cmp r2, #1
+mov r2, r2
+red r0
+ hlt
+DAT: .data 1, 2, 3, k
@@ -0,0 +1,74 @@
+.define k = 3
+.extern X1
+jmp L6
+L6: inc r2
+jmp L6
+mov r3, r3
+mov r7, r7
+cmp r2, #k
+mov r1, r1
+cmp r5, #k
+mov r7, r7
+mov r3, r3
+lea DAT, r2
+mov r0, r0
+L1: mov r0, r0
+bne L8
+red r7
+red r7
+cmp r2, #1
+red r4
+cmp DAT[2], #-2
+red r5
+ dec r0
+dec r0
+L2: dec L4
+red r2
+cmp r2, L1
+red r0
+bne L7
+L3: red r1
+L0: red r4
+add r1, r2
+red r3
+inc r6
+ inc L0
+dec L0
+; comment
+
+L7: dec r5
+red r7
+jmp L1
+L10: sub #4, r3
+jmp L4
+L4: hlt
+ inc DAT[1]
+dec DAT[1]
+ dec r4
+inc r4
+
+L5: dec DAT[1]
+add r1, r2
+L11: bne L6
+jmp L8
+L8: rts
+L9: red r4
+red r0
+mov r7, r7
+ inc DAT[1]
+inc DAT[1]
+red r5
+red r3
+ dec r3
+dec r3
+dec DAT[k]
+jmp L6
+red r2
+cmp r6, #1
+ dec DAT[k]
+inc DAT[k]
+red r5
+mov r1, r1
+mov r3, r3
+ hlt
+DAT: .data 1, 2, 3, k
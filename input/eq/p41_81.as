@@ -0,0 +1,74 @@
+.define k = 3
+.extern X1
+dec L6
+L7: bne L9
+L5: cmp r4, #1
+clr L1
+cmp r5, r3
+ dec L6
+dec L6
+bne L1
+L8: bne L4
+cmp r7, #1
+ dec r0
+L4: inc r0
+L10: inc r5
+ inc r6
+inc r6
+L6: prn #k
+cmp r0, #k
+cmp r6, #-2
+red r0
+cmp r4, #-2
+L3: cmp r6, #-2
+clr L1
+L9: lea DAT, r2
+dec r2
+jmp L7
+jmp L9
+bne L7
+L1: inc r3
+red r3
+L0: not r1
+ inc r5
+dec r5
+ dec r3
+L2: inc r3
+jmp L1
+
+ dec r4
+L11: inc r4
+bne L1
+ inc r1
+inc r1
+ dec r4
+dec r4
+inc r0
+jmp L7
+bne L7
+cmp L6, r6
+cmp DAT[1], #k
+red r0
+mov r4, r0
+ dec r0
+inc r0
+red r0
+dec DAT[1]
+jmp L1
+
+mov r4, r4
+ inc r0
+dec r0
+; comment
+jmp L0
+cmp r1, #1
+red r5
+jmp L2
+add r1, r2
+jmp L3
+jmp L4
+mov r2, r2
+red r6
+cmp r5, #1
+ hlt
+DAT: .data 1, 2, 3, k
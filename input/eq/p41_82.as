@@ -0,0 +1,74 @@
+.define k = 3
+.extern X1
+L7: red r4
+; comment
+bne L2
+mov r7, r7
+L4: jmp L2
+L2: hlt
+; comment
+mov r2, r3
+ dec X1
+dec X1
+red r4
+L6: mov r3, r3
+mov r1, r1
+bne L5
+ inc L6
+inc L6
+bne L7
+mov r6, r7
+L9: mov r6, r6
+jmp L8
+L8: rts
+mov r6, r6
+cmp X1, #k
+cmp r3, #-2
+L11: mov r5, r5
+mov r5, r5
+; comment
+inc r3
+L1: bne L4
+jmp L9
+L3: cmp r4, r4
+inc r0
+red r0
+L10: mov r0, r7
+mov r3, r3
+ dec L0
+inc L0
+L5: inc DAT[1]
+red r6
+mov r3, r3
+mov r1, r6
+red r1
+L0: cmp r3, #k
+mov r4, r7
+ inc r2
+dec r2
+bne L1
+bne L3
+bne L8
+ inc r1
+inc r1
+jmp L1
+not r1
+mov r5, r6
+red r4
+cmp r7, #-2
+sub #4, r3
+jmp L6
+bne L5
+ inc r1
+inc r1
+ inc r7
+dec r7
+add r1, r2
+mov r6, r6
+red r2
+jmp L3
+jmp L1
+inc r5
+ hlt
+DAT: .data 1, 2, 3, k
+.entry L0
@@ -0,0 +1,71 @@
+.define k = 3
+.extern X1
+
+L6: mov r3, r3
+; comment
+L2: dec L3
+red r7
+mov r0, r0
+ dec L2
+dec L2
+mov r6, r6
+red r2
+L9: ; comment
+jmp L1
+L1: inc r2
+L5: cmp r5, r1
+mov r4, r7
+bne L6
+jmp L5
+jmp L4
+L4: hlt
+inc r1
+L11: dec r4
+red r0
+mov r7, r7
+; comment
+cmp r0, #1
+mov r6, r6
+jmp L3
+ inc r1
+dec r1
+jmp L3
+jmp L1
+dec L7
+L3: jmp L5
+dec r2
+L7: ; comment
+mov r7, r7
+mov r1, r5
+; comment
+L0: sub #4, r3
+cmp r2, #1
+red r3
+red r7
+L8: mov r2, r2
+mov r6, r6
+dec r5
+bne L2
+L10: cmp r7, #k
+bne L5
+jmp L4
+cmp L3, #1
+mov r7, r2
+jmp L8
+jmp L2
+red r1
+bne L3
+jmp L8
+ dec r7
+dec r7
+
+ dec r4
+inc r4
+ dec r3
+inc r3
+bne L6
+mov r0, r1
+mov r4, r4
+cmp r0, #-2
+ hlt
+DAT: .data 1, 2, 3, k
@@ -0,0 +1,72 @@
+.define k = 3
+.extern X1
+red r0
+jmp L5
+
+ dec r4
+dec r4
+mov r7, r7
+mov r7, r7
+mov r3, r3
+cmp r1, #1
+mov r7, r7
+bne L8
+red r2
+inc r4
+ inc r0
+inc r0
+red r2
+jmp L6
+L6: prn r1
+bne L5
+mov r4, r4
+bne L4
+jmp L3
+ dec L5
+dec L5
+L0: mov r1 r2
+mov r4, r2
+
+; comment
+L2: red r2
+L5: red r6
+L1: jmp L9
+L7: cmp r5, #1
+red r5
+L3: bne L5
+ inc r1
+dec r1
+cmp r1, #k
+dec r1
+red r6
+bne L9
+bne L9
+red r0
+mov r1, r1
+jmp L1
+jmp L5
+L10: jmp L6
+red r5
+red r1
+mov r5, r5
+inc r6
+L9: mov r2, r2
+clr L1
+red r0
+red r5
+L11: not r1
+jmp L7
+ dec r0
+inc r0
+cmp r4, #1
+prn #k
+bne L4
+red r1
+
+red r6
+cmp r1, #k
+mov r0, r7
+ hlt
+L4: hlt
+DAT: .data 1, 2, 3, k
+.entry L1
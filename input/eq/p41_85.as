@@ -0,0 +1,74 @@
+.define k = 3
+.extern X1
+L9: ; comment
+red r3
+lea DAT, r2
+bne L8
+jmp L9
+ dec r1
+dec r1
+ inc r3
+inc r3
+cmp r2, #-2
+L7: bne L2
+ dec r5
+L1: inc r5
+cmp L2, DAT[1]
+cmp DAT[k], #1
+red r2
+L3: mov r4, r4
+L6: mov r1, r2
+jmp L9
+bne L7
+jmp L3
+jmp L7
+bne L5
+ dec r4
+inc r4
+cmp r3, #k
+L8: red r0
+not r1
+mov r2, r2
+ inc DAT[1]
+inc DAT[1]
+cmp r3, #-2
+mov r1, r4
+L2: mov r1, r5
+L11: red r2
+mov r3, r3
+cmp L7, #1
+inc DAT[2]
+ dec r6
+inc r6
+ inc r5
+dec r5
+
+dec L6
+L4: cmp r5, r0
+L0: mov r1, r3
+mov r4, r4
+mov r4, r4
+red r0
+mov r7, r7
+add r1, r2
+dec DAT[k]
+sub #4, r3
+cmp r5, #1
+cmp L5, #k
+mov r6, r6
+sub #4, r3
+clr L1
+red r2
+cmp r5, #-2
+bne L8
+cmp r3, #k
+L10: dec r0
+ dec r3
+dec r3
+cmp r2, r3
+ inc r3
+dec r3
+inc r7
+ hlt
+L5: hlt
+DAT: .data 1, 2, 3, k
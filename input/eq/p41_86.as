@@ -0,0 +1,72 @@
+.define k = 3
+.extern X1
+mov r5, r1
+lea DAT, r2
+; comment
+L8: mov r6, r6
+sub #4, r3
+sub #4, r3
+red r7
+cmp r7, r6
+cmp DAT[k], #k
+inc r4
+ dec L7
+inc L7
+red r1
+red r3
+; comment
+red r0
+mov r7, r7
+jmp L2
+L2: inc r2
+red r3
+jmp L6
+add r1, r2
+clr L1
+ dec DAT[k]
+inc DAT[k]
+jmp L8
+ inc r3
+dec r3
+L5: not r1
+inc r4
+not r1
+L11: cmp r3, #k
+L0: mov r1, r1
+clr L1
+cmp r5, #1
+L7: red r2
+jmp L5
+L4: cmp DAT[2], #-2
+jmp L2
+mov r7, r7
+cmp r2, r5
+red r1
+mov r6, r7
+cmp r4, r2
+red r4
+cmp r2, #-2
+red r5
+; comment
+mov r5, r5
+L1: red r6
+; comment
+bne L9
+red r5
+cmp r4, #1
+red r5
+L3: red r6
+L6: inc DAT[1]
+L10: bne L5
+red r6
+ dec r1
+inc r1
+bne L0
+red r7
+ dec L5
+dec L5
+inc L4
+ hlt
+L9: hlt
+DAT: .data 1, 2, 3, k
+.entry L2
@@ -0,0 +1,72 @@
+.define k = 3
+.extern X1
+L3: mov r1 r2
+mov r5, r5
+red r1
+mov r6, r7
+red r1
+cmp r1, r4
+bne L6
+bne L7
+ dec r7
+dec r7
+L6: prn #k
+cmp L0, #1
+inc L4
+
+inc r3
+ inc r1
+dec r1
+jmp L6
+L10: cmp L5, #k
+L0: mov r0, r0
+sub #4, r3
+ dec r6
+dec r6
+dec DAT[2]
+cmp r6, r3
+jmp L1
+L1: inc r2
+L8: inc r4
+ inc r1
+inc r1
+L11: dec L7
+jmp L0
+ dec r6
+dec r6
+red r0
+
+red r3
+
+L2: jmp L0
+lea DAT, r2
+L4: cmp r0, r3
+L9: red r7
+jmp L6
+; comment
+mov r6, r6
+bne L0
+bne L7
+red r0
+jmp L4
+mov r0, r0
+ inc L2
+L5: inc L2
+L7: mov r5, r5
+jmp L7
+cmp r7, r7
+jmp L3
+red r4
+dec r5
+jmp L9
+jmp L4
+jmp L1
+prn #k
+mov r1, r1
+cmp r3, #1
+inc r1
+prn #k
+mov r1 r2
+ hlt
+DAT: .data 1, 2, 3, k
+.entry L2
@@ -0,0 +1,77 @@
+.define k = 3
+.extern X1
+cmp r0, #k
+mov r1, r1
+ inc r6
+inc r6
+red r0
+L3: inc r2
+jmp L7
+L8: bne L8
+jmp L7
+L7: hlt
+L9: red r0
+mov r1, r1
+cmp r0, #k
+jmp L2
+L2: inc r2
+jmp L5
+L5: hlt
+red r3
+; comment
+L4: red r7
+lea DAT, r2
+L0: sub #4, r3
+L6: red r3
+ dec r2
+inc r2
+not r1
+jmp L4
+jmp L9
+L11: mov r5, r5
+red r2
+clr L1
+bne L3
+bne L4
+ dec r6
+dec r6
+ dec DAT[k]
+inc DAT[k]
+cmp r5, #-2
+L10: mov r2, r7
+dec r5
+cmp DAT[1], #k
+jmp L1
+L1: hlt
+dec L6
+cmp r6, #-2
+red r6
+mov r2, r2
+not r1
+prn #k
+dec r6
+cmp r4, #1
+; comment
+cmp r4, #-2
+ dec DAT[1]
+dec DAT[1]
+
+ inc L7
+dec L7
+red r7
+ dec DAT[1]
+dec DAT[1]
+red r2
+bne L4
+ inc r6
+dec r6
+red r5
+sub #4, r3
+sub #4, r3
+jmp L3
+
+mov r3, r3
+ dec r7
+inc r7
+ hlt
+DAT: .data 1, 2, 3, k
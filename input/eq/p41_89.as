@@ -0,0 +1,72 @@
+.define k = 3
+.extern X1
+L9: bne L4
+L1: mov r6, r6
+bne L5
+L3: dec r2
+L7: red r1
+L11: mov r4, r2
+L2: jmp L1
+ inc L4
+L10: dec L4
+bne L5
+red r4
+cmp r4, #k
+cmp L3, r0
+ inc L4
+L5: dec L4
+inc r7
+red r4
+ dec r0
+dec r0
+jmp L5
+; comment
+L0: ; comment
+mov r6, r6
+L6: ; comment
+mov r6, r6
+jmp L9
+L4: cmp r4, r7
+inc r5
+jmp L3
+L8: jmp L2
+inc L5
+cmp r4, #1
+bne L9
+ inc r0
+inc r0
+red r7
+cmp L3, #-2
+red r2
+jmp L1
+sub #4, r3
+cmp r4, r5
+cmp r5, #1
+jmp L8
+cmp r5, #-2
+ dec L5
+inc L5
+red r5
+mov r1, r6
+mov r0, r0
+jmp L2
+ dec DAT[k]
+inc DAT[k]
+cmp L5, #k
+ dec r5
+dec r5
+mov r5, r0
+cmp r6, #-2
+cmp r1, #-2
+ inc r3
+dec r3
+cmp r6, #-2
+clr L1
+add r1, r2
+bne L7
+cmp r0, #k
+jmp L4
+mov r5, r5
+bne L1
+ hlt
+DAT: .data 1, 2, 3, k
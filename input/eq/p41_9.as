@@ -0,0 +1,71 @@
+.define k = 3
+.extern X1
+ dec r0
+inc r0
+red r0
+cmp r6, #1
+L8: mov r1 r2
+mov r6, r1
+cmp r6, #-2
+ dec r0
+dec r0
+mov r3, r3
+mov r0, r0
+red r3
+red r2
+mov r1, r1
+cmp r3, #-2
+L10: bne L0
+L9: bne L2
+clr L1
+mov r6, r3
+L11: mov r5, r1
+mov r5, r5
+red r0
+jmp L0
+L0: rts
+cmp DAT[2], #1
+L7: jmp L6
+L6: rts
+mov r3, r3
+jmp L8
+cmp DAT[2], #k
+red r2
+L1: inc DAT[2]
+mov r4, r4
+L4: bne L1
+mov r6, r6
+bne L4
+red r7
+red r4
+cmp L1, #1
+ dec X1
+dec X1
+cmp r0, DAT
+jmp L8
+mov r1 r2
+red r1
+add r1, r2
+ inc r0
+L3: dec r0
+; comment
+jmp L3
+jmp L6
+L2: mov r2, r2
+L5: jmp L7
+dec DAT[1]
+red r7
+mov r5, r5
+mov r3, r3
+mov r1, r1
+ inc L5
+dec L5
+bne L0
+red r0
+jmp L6
+
+cmp r4, #-2
+not r1
+mov r1 r2
+ hlt
+DAT: .data 1, 2, 3, k
@@ -0,0 +1,74 @@
+.define k = 3
+.extern X1
+mov r4, r4
+ dec r4
+dec r4
+L11: mov r6, r6
+mov r2, r2
+L1: jmp L3
+L3: inc r2
+L0: mov r2, r0
+ dec DAT[1]
+dec DAT[1]
+
+dec r6
+mov r5, r5
+red r2
+bne L3
+jmp L7
+L7: rts
+jmp L2
+jmp L3
+cmp r5, #1
+jmp L6
+L6: hlt
+ inc DAT
+L10: dec DAT
+mov r6, r6
+mov r1, r1
+ dec L6
+dec L6
+L8: mov r1 r2
+L9: cmp L1, #1
+jmp L7
+mov r1, r1
+inc r5
+inc r4
+mov r4, r4
+cmp L2, #k
+cmp r5, #1
+jmp L5
+L5: hlt
+jmp L6
+dec r6
+jmp L2
+L4: cmp r7, #1
+add r1, r2
+mov r2, r3
+L2: cmp r5, #k
+mov r3, r3
+cmp r4, #k
+mov r4, r3
+dec r2
+jmp L0
+mov r1 r2
+cmp r6, #1
+red r7
+; comment
+cmp r7, #k
+ inc L4
+dec L4
+red r2
+red r3
+dec r5
+mov r2, r2
+red r0
+cmp DAT[2], r0
+not r1
+bne L0
+bne L3
+bne L6
+mov r6, r3
+ hlt
+DAT: .data 1, 2, 3, k
+.entry L2
@@ -0,0 +1,76 @@
+.define k = 3
+.extern X1
+L2: red r2
+ dec DAT[k]
+dec DAT[k]
+jmp L5
+not r1
+add r1, r2
+bne L8
+dec DAT[k]
+red r6
+L3: dec r3
+red r6
+jmp L1
+jmp L4
+L4: prn r1
+jmp L9
+red r7
+; comment
+bne L7
+mov r6, r6
+bne L4
+jmp L8
+L8: hlt
+mov r5, r2
+L10: mov r4, r4
+ inc L3
+dec L3
+red r6
+lea DAT, r2
+red r2
+L0: jmp L9
+L9: rts
+ dec r7
+dec r7
+cmp r2, L0
+L5: red r3
+red r5
+red r4
+mov r1, r1
+prn #k
+mov r1, r1
+mov r5, r5
+ dec r4
+inc r4
+mov r3, r1
+L6: dec r0
+dec L5
+dec r3
+cmp L4, #1
+mov r7, r7
+dec DAT[1]
+mov r3, r2
+ inc r6
+L1: dec r6
+ inc L7
+inc L7
+L7: jmp L7
+mov r5, r5
+jmp L6
+ inc DAT[2]
+dec DAT[2]
+jmp L5
+red r1
+ inc r5
+inc r5
+clr L1
+red r7
+L11: jmp L1
+clr L1
+mov r0, r0
+inc r4
+; comment
+ hlt
+DAT: .data 1, 2, 3, k
+.entry L2
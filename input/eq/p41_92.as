@@ -0,0 +1,75 @@
+.define k = 3
+.extern X1
+jmp L8
+; comment
+add r1, r2
+ dec DAT[1]
+inc DAT[1]
+jmp L2
+L9: cmp r2, #-2
+mov r5, r5
+cmp r2, r2
+dec r4
+mov r0, r0
+L10: red r5
+mov r7, r7
+ inc r5
+dec r5
+cmp r0, r5
+; comment
+red r5
+add r1, r2
+mov r6, r3
+jmp L5
+L5: prn r1
+L3: ; comment
+ inc r6
+inc r6
+jmp L2
+L2: rts
+
+L0: jmp L6
+L6: rts
+jmp L5
+red r3
+prn #k
+ inc DAT[1]
+L8: dec DAT[1]
+jmp L0
+jmp L3
+; comment
+bne L5
+L4: cmp r6, r6
+not r1
+cmp r4, #-2
+dec r7
+ inc DAT[k]
+inc DAT[k]
+mov r6, r6
+cmp r7, #k
+cmp DAT[2], #k
+mov r3, r0
+cmp L1, #-2
+inc r6
+
+prn #k
+jmp L9
+inc r3
+; comment
+mov r4, r4
+L7: jmp L3
+red r5
+red r4
+ dec r6
+inc r6
+
+jmp L8
+jmp L2
+ dec r1
+L1: inc r1
+ dec r2
+inc r2
+; comment
+L11: bne L9
+ hlt
+DAT: .data 1, 2, 3, k
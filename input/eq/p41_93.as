@@ -0,0 +1,70 @@
+.define k = 3
+.extern X1
+ inc L5
+inc L5
+L1: clr L1
+L9: red r5
+mov r1, r3
+red r7
+L5: jmp L5
+red r1
+L2: red r1
+cmp r3, #k
+red r1
+red r2
+bne L4
+
+mov r0, r0
+ inc r7
+dec r7
+red r2
+
+
+cmp r5, #k
+mov r5, r5
+cmp r6, #k
+L10: jmp L0
+L0: prn r1
+ inc r5
+inc r5
+red r0
+mov r7, r7
+L7: red r6
+L11: mov r6, r2
+mov r6, r4
+ inc r6
+dec r6
+L8: cmp r5, #1
+L3: jmp L3
+L6: bne L3
+jmp L8
+mov r5, r5
+red r3
+mov r3, r4
+; comment
+cmp DAT, #k
+red r7
+mov r5, r5
+mov r1, r5
+
+jmp L2
+mov r2, r2
+jmp L2
+
+ dec r6
+inc r6
+L4: red r5
+jmp L2
+inc r4
+cmp r5, r3
+inc r7
+inc r6
+mov r5, r5
+cmp DAT[2], DAT[2]
+dec DAT[k]
+mov r4, r7
+mov r1, r1
+red r6
+dec r4
+ hlt
+DAT: .data 1, 2, 3, k
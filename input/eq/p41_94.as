@@ -0,0 +1,71 @@
+.define k = 3
+.extern X1
+mov r4, r4
+bne L5
+ inc DAT[2]
+dec DAT[2]
+red r5
+bne L0
+
+cmp r4, #1
+ inc L0
+inc L0
+L7: inc r0
+jmp L3
+L3: jmp L8
+L8: prn r1
+L11: bne L2
+cmp r2, #-2
+red r2
+dec r5
+L2: jmp L5
+mov r2, r2
+ dec L5
+inc L5
+
+L9: bne L2
+L5: dec L7
+L1: ; comment
+mov r3, r3
+L0: add r1, r2
+clr L1
+mov r6, r5
+mov r7, r6
+jmp L1
+red r3
+cmp DAT[k], DAT[k]
+inc r0
+cmp r3, DAT[1]
+not r1
+red r2
+red r3
+L10: cmp DAT, #k
+red r3
+jmp L2
+bne L2
+L4: add r1, r2
+jmp L3
+mov r6, r6
+inc DAT[k]
+ inc r6
+dec r6
+L6: cmp r1, #k
+ dec r5
+inc r5
+mov r3, r3
+red r6
+dec L5
+jmp L5
+cmp r6, #-2
+jmp L0
+red r1
+dec L6
+red r5
+red r1
+ inc r1
+inc r1
+jmp L0
+dec r1
+red r4
+ hlt
+DAT: .data 1, 2, 3, k
@@ -0,0 +1,76 @@
+.define k = 3
+.extern X1
+jmp L8
+red r0
+L0: jmp L4
+L9: jmp L1
+L1: inc r2
+cmp r5, DAT
+jmp L2
+L2: hlt
+red r7
+mov r5, r5
+inc r1
+L3: mov r3, r3
+inc DAT[2]
+jmp L7
+L7: hlt
+ dec r5
+inc r5
+cmp r3, #-2
+dec DAT[1]
+cmp r6, #k
+jmp L0
+ inc r7
+dec r7
+inc L5
+L5: inc r1
+cmp r6, #-2
+ dec DAT[2]
+dec DAT[2]
+jmp L2
+dec L1
+dec r4
+bne L7
+L10: jmp L0
+mov r0, r7
+ inc r4
+inc r4
+
+L11: bne L1
+inc r2
+red r0
+cmp r7, r3
+mov r4, r6
+ dec L3
+inc L3
+cmp r3, L3
+mov r4, r1
+bne L2
+L6: bne L9
+
+L8: jmp L9
+L4: mov r2, r2
+sub #4, r3
+jmp L2
+ inc r3
+dec r3
+clr L1
+mov r6, r6
+cmp r4, r6
+mov r2, r6
+ inc r2
+dec r2
+red r1
+; comment
+red r3
+jmp L1
+prn #k
+jmp L6
+cmp r3, DAT
+jmp L2
+ dec r4
+dec r4
+ hlt
+DAT: .data 1, 2, 3, k
+.entry L1
@@ -0,0 +1,75 @@
+.define k = 3
+.extern X1
+red r6
+mov r5, r0
+ dec r5
+L10: inc r5
+ dec L7
+dec L7
+red r5
+L0: mov r3, r3
+jmp L1
+clr L1
+cmp DAT[k], #1
+jmp L9
+dec DAT[k]
+ inc r4
+inc r4
+mov r2, r2
+mov r7, r7
+L3: ; comment
+dec DAT[1]
+L1: mov r5, r5
+red r5
+red r3
+cmp r2, #1
+ inc r3
+L11: inc r3
+jmp L7
+L2: jmp L1
+ dec DAT[k]
+inc DAT[k]
+L6: red r6
+mov r4, r5
+ inc r6
+inc r6
+L7: jmp L4
+cmp L7, #1
+L8: cmp r3, #-2
+red r4
+jmp L7
+L4: not r1
+red r3
+mov r0, r0
+cmp DAT[k], #-2
+
+mov r1 r2
+inc NOPE
+bne L4
+; comment
+ dec r4
+dec r4
+bne L3
+inc L3
+jmp L2
+red r1
+cmp r7, #k
+ inc r5
+inc r5
+bne L9
+cmp DAT[1], #1
+mov r4, r4
+jmp L4
+bne L1
+jmp L9
+cmp r1, L5
+red r2
+cmp r4, r2
+L9: jmp L5
+mov r3, r3
+ dec DAT[k]
+dec DAT[k]
+ hlt
+L5: hlt
+DAT: .data 1, 2, 3, k
+.entry L0
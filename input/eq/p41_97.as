@@ -0,0 +1,73 @@
+.define k = 3
+.extern X1
+L5: red r0
+jmp L0
+L0: prn r1
+mov r7, r7
+L7: cmp r4, #-2
+L2: cmp L1, #1
+jmp L4
+not r1
+L6: cmp r2, #k
+L9: red r0
+L1: red r2
+jmp L8
+L8: hlt
+inc r1
+L3: jmp L9
+jmp L6
+L4: jmp L5
+red r3
+cmp r1, L3
+L10: jmp L0
+cmp r0, r4
+ inc DAT[2]
+inc DAT[2]
+inc L6
+L11: cmp r6, #-2
+red r0
+red r4
+mov r7, r7
+red r4
+mov r2, r2
+; comment
+mov r4, r4
+mov r3, r3
+dec r2
+red r6
+jmp L7
+inc DAT
+red r7
+ dec r3
+inc r3
+bne L8
+; comment
+prn #k
+; comment
+mov r1, r7
+dec r7
+red r0
+jmp L8
+ dec r7
+inc r7
+ dec DAT[2]
+inc DAT[2]
+lea DAT, r2
+bne L8
+red r1
+jmp L2
+jmp L3
+not r1
+ dec r4
+inc r4
+ inc DAT[2]
+inc DAT[2]
+mov r7, r7
+red r2
+red r5
+red r2
+mov r2, r0
+mov r2, r6
+ hlt
+DAT: .data 1, 2, 3, k
+.entry L2
@@ -0,0 +1,73 @@
+.define k = 3
+.extern X1
+
+mov r7, r7
+jmp L7
+bne L5
+L0: lea DAT, r2
+jmp L7
+L7: rts
+jmp L3
+L3: rts
+cmp DAT[2], r2
+L8: inc r4
+L1: red r7
+inc L0
+ inc r4
+inc r4
+ dec r5
+dec r5
+cmp r5, #k
+mov r6, r3
+mov r1, r1
+inc DAT[2]
+dec r7
+inc r0
+mov r4, r4
+red r2
+red r7
+red r5
+
+bne L5
+jmp L3
+ inc DAT[k]
+inc DAT[k]
+clr L1
+L2: cmp r3, #k
+mov r3, r3
+mov r7, r7
+inc r1
+jmp L8
+L11: dec L2
+dec r0
+inc r5
+L6: bne L1
+red r1
+mov r5, r5
+red r3
+jmp L4
+L4: prn r1
+ dec DAT[2]
+dec DAT[2]
+jmp L1
+mov r6, r6
+ dec r4
+inc r4
+ inc DAT[2]
+L9: dec DAT[2]
+red r5
+red r1
+L10: prn #k
+L5: bne L7
+cmp X1, #k
+mov r5, r5
+prn #k
+; comment
+add r1, r2
+jmp L1
+; comment
+sub #4, r3
+jmp L9
+jmp L6
+ hlt
+DAT: .data 1, 2, 3, k
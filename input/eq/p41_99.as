@@ -0,0 +1,69 @@
+.define k = 3
+.extern X1
+cmp r3, #k
+jmp L8
+L8: inc r2
+L10: jmp L5
+cmp r2, #1
+jmp L1
+L1: inc r2
+L11: mov r3, r3
+mov r3, r3
+ dec r2
+inc r2
+bne L0
+L3: dec DAT[1]
+L6: mov r5, r5
+red r0
+dec L2
+mov r2, r2
+mov r2, r2
+dec r5
+mov r5, r5
+L4: mov r0, r0
+dec DAT[zz]
+cmp r5, DAT[zz]
+
+bne L1
+sub #4, r3
+bne L3
+dec r7
+jmp L5
+red r4
+cmp r2, #-2
+red r5
+L5: bne L3
+bne L4
+prn #k
+mov r1 r2
+ inc r3
+inc r3
+; comment
+cmp r6, #-2
+red r4
+L0: red r6
+red r4
+L2: red r6
+cmp r2, r7
+red r2
+cmp r6, r7
+red r3
+jmp L1
+ inc DAT[2]
+dec DAT[2]
+mov r0, r0
+L7: jmp L4
+bne L6
+cmp r4, #1
+cmp L5, #1
+mov r2, r2
+mov r6, r6
+bne L9
+red r2
+mov r5, r6
+L9: sub #4, r3
+red r0
+red r1
+red r7
+ hlt
+DAT: .data 1, 2, 3, k
@@ -0,0 +1,25 @@
+.define sz = 2
+.extern EXT
+MAIN: mov r1, r1
+ mov r2, r3
+ cmp r1, #1
+ cmp r2, #sz
+ bne LOOP
+ jmp NEXT
+NEXT: inc r4
+ dec r4
+ inc LIST[1]
+ dec LIST[1]
+ inc r5
+ jmp LOOP
+ cmp EXT, r1
+ cmp r1, r2
+LOOP: mov r3, r3
+ prn #3
+ inc r6
+ inc r7
+ dec r7
+ dec r6
+ hlt
+LIST: .data 1, 2, 3
+.entry LOOP
@@ -0,0 +1,38 @@
+mov #3, r7
+prn #-15
+.define c0 = (12+20+3*7)
+prn #(c0)/1/1
+.data 3, -16+c0-c0/2, 8-5/4-(18)
+.define c1 = 14
+L0: mov L0[-8*(c0)--c0], r2
+.define c2 = (c1-9)-20/12/5
+L1: .fill 1, c1+9/9+13-c1/19
+mov L0[-12], r2
+prn #c1/3*-c2/3
+cmp #18*12, L0[(c0+18)*2+(9)]
+L2: mov #--c1/5, r7
+.define c3 = 9/3/10/1
+.define c4 = (2) + c1
+.define c5 = -(5+2)
+prn #-19
+.data c3+7-c1, c0-12+c1*c5/5
+L3: .data -11*6/1, 14, 12+12+c1+8+5+c5/5
+.define c6 = 6
+mov #c1, r6
+L4: mov L1[8-c1+7], r2
+mov L1[c6/2], r2
+.define c7 = c5
+L5: prn #c4/12*(10*c7)
+mov #(8*c2)-2/10/3, r2
+mov L4[13], r2
+cmp #15, L1[(18)]
+.fill 4, 5
+mov #c5*c5, r7
+mov #17, r4
+.data 7-(7), (c7-c2)+18/2, -c5-c4, (c0)
+L6: mov L6[c7], r2
+.data (10-c6)-c7
+L7: mov #c0, r0
+cmp #-c1+c0--4, L7[c0-18*8*14+c7-c1]
+prn #c2/1
+hlt
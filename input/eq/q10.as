@@ -0,0 +1,94 @@
+.define c0 = 14
+prn #10
+.define c1 = -(c0)*19
+L0: mov #(c0*c0)-13*7/2, r7
+.data (c1)-3+11
+.fill 2, --c0--1-c1*c0
+.data -15/1*11/4, 16
+prn #14
+.fill 2, 6*c1+3-c1/4
+L1: prn #2+12/1/4
+mov L0[--(14)], r2
+mov #c1*9/5*(2*c1), r1
+mov L1[13-c0], r2
+.define c2 = (12*18 + -6)
+mov #11, r2
+.define c3 = 14*c1
+mov #(c1)--(16), r0
+L2: prn #14/2
+prn #5
+mov #15/2, r1
+mov #c1, r0
+.define c4 = 10
+.define c5 = -(c4+c1)
+mov #18-17-c0-c0, r7
+L3: mov #-(c1*c2), r4
+.define c6 = c0
+mov #c6, r6
+L4: cmp #c0, L1[c4-13]
+L5: mov #5, r2
+.define c7 = (c4-c1--c3)
+cmp #c5*4+2*c5, L3[c1]
+.define c8 = 11/3/1/5
+.data c5, --18, 14
+.define c9 = 13-c7 + c6*2/4
+mov #c7, r6
+.data (c0)+c2+c4*0/5, c5, 11, c0
+.define c10 = (17)+(c6)/1
+L6: .data (19)+(8)+c3-c6, (c5-13)+5, (c7+18-20+5), c3-(c0)/1
+.data 1+16-4/1--19-14, 16, (-9*c5)
+mov #c4-c7-5*c5-c5*(c2), r1
+.define c11 = -c9
+mov L4[(c4*c8)*10], r2
+cmp #(7), L3[(5+-13)]
+mov L4[c7+c7--18], r2
+L7: mov #(18/20)-0*4+9, r2
+prn #(0/5)
+L8: mov L3[15], r2
+L9: .fill 4, -c9
+prn #(c0)/2*c8
+L10: mov #c6, r0
+.define c12 = c3*0+c8*13-13
+.data -c7+14, c5, c11
+.define c13 = 11
+mov #c8, r0
+mov #0/3, r1
+.data 11, -17+c7+c1
+.define c14 = c2+c4*c0/4
+mov L4[-0/4/1], r2
+L11: prn #6
+.define c15 = -(7)*-14*6*c12
+L12: .data (20+(c5)), 3-c14-c5*c14-16, 1, 2
+prn #9-c14*c6+18
+mov #-c13, r6
+L13: .data c0/3-10*c12, (17*2)*c8*c5
+mov L5[c13], r2
+mov #12+(c13)*3, r1
+L14: .data --c2-c10, 18/3+15+c10, -c10-2/2
+mov L5[1+12/3-9+c14*9], r2
+mov L5[(7+(12))], r2
+mov #-17/16+13+c0-c2*20, r2
+.data (-(17)), c11, c4, -14/15+c2+5/5
+cmp #5+5-c12+c4*(9*c2), L3[(-2/1)]
+.define c16 = 12--15-c10
+mov #--c7-c13/3, r5
+L15: .data (c16)*16+11*4, c5+2+15-c12+1+c16, 5, 9
+L16: mov #2/3*(20)/2, r4
+mov #c10-c0, r4
+L17: .data ((9)*c11), 0, 3/4*-1/3
+.define c17 = c11/4/8
+mov L4[c11/4], r2
+.define c18 = 8/3+c11*10
+L18: mov L5[-10*2*(c12)], r2
+.define c19 = (c14)-9+16--11/1
+.data -16/3*c10-c18, c14*6*c17, 12/5+c5+19/4
+L19: mov #15/3*(6)/1, r1
+prn #(17)
+.fill 4, 14
+L20: prn #7
+cmp #13-13, L20[c12]
+.define c20 = -c16
+L21: cmp #13-16+1-11/17, L15[7+3*c11]
+cmp #(0)+c7, L1[c16/1]
+mov L2[c3], r2
+hlt
@@ -0,0 +1,39 @@
+mov #12, r5
+.fill 1, 14
+.data --11-4, -(12/17)
+.define c0 = 0
+.define c1 = c0
+.data 1, 3*10*15/13*c0*15, c0/2-19-3-3*c0, c1+12
+.data 7+c0+12*(c1/8), (c1-20)
+.data -c0-c1-5-0+11
+.fill 1, 11*18+4-c0+13-13
+prn #c0-16-(11)+c0/2
+L0: mov #-c0/1-(c1+3), r7
+prn #15
+mov L0[12/3], r2
+prn #c1
+.data (1)+7+11
+.data (10*c0)*18
+mov #((c1)+c1-c1), r5
+cmp #(c0)*1/20--3/1, L0[9/4-c1+0*c1-12]
+L1: .data -3-(12)-7, -15/3-0, c0*c0/5*1*-c1, c1*9/3*16
+L2: .data (c0)-c1, (4)+c1/10-c1*c1-8*9, (c1*c1)+(c1)
+mov #4, r1
+.define c2 = c0
+prn #(13)+0+c1
+.define c3 = -c1 + c1*(c0)/14
+prn #-1
+mov #18, r4
+mov #20+16/1+c2/3, r2
+mov L2[11], r2
+L3: mov #(15/15)-c0+-14, r1
+.data -15-0
+mov #18, r5
+.define c4 = 7*13-3/5
+.define c5 = 17/3/3-c4
+.define c6 = 15-c2--c3/3
+mov #-18*(18)+c4+c5, r1
+L4: .data 5, c0/15+7-c6*c1
+L5: .data c2, c2
+.define c7 = c1*c6
+hlt
@@ -0,0 +1,95 @@
+prn #-(5)*(6-9)
+.define c0 = -(-12)
+.define c1 = 19
+mov #--(0), r7
+L0: .data --1
+L1: .fill 2, (14+c1*16/16)
+L2: mov L2[c1/1], r2
+L3: .data c0, 19, (c1*9*c0)
+L4: .fill 2, c0-c1
+mov #--c1-10, r3
+L5: mov #c1, r7
+L6: .fill 2, c0+3/4/5
+mov #1/1-4+10-16-c0, r1
+L7: .data -c0/20, (c0), ((c0)), 4--c1
+.data (c1/6)/2, c1, c0
+.define c2 = c1/19
+.define c3 = c1
+mov #(3/1/5), r0
+.define c4 = c2
+mov #2, r3
+.define c5 = 10/10-5 + c2 + (c0)/4
+cmp #-c4*5/1, L3[c5]
+mov L0[-c0-9/11], r2
+.data -c3*(c4)/1, -5
+L8: mov L2[(c4)--19*3], r2
+L9: .data (c1), c1
+.define c6 = --c5
+mov L4[c3/5/4], r2
+L10: mov L3[c1], r2
+.define c7 = 9
+.data c4, -5-c4, -c5-c6+(c0), c3+c3-20+5*3+(c2)
+mov #(c2*1+14*c4), r6
+prn #(c7+6)+c7/7-c2+3
+mov #1/10--16+0*-c5, r0
+prn #c3*0+4/5
+prn #8/4
+mov #c5*17/4*11/4-(c5), r5
+mov #(4/17)/10, r6
+L11: .data ((c7/3)), 1, 1, c7
+.data c2, c6-13-c4+(c3+c2), c2, (17*16*c4)
+mov #(c5), r7
+.data c5, 15, --c2-16+c2*6
+.data (c2/14+18+12), (0*18-c6), 20+c6-1+10-c1/1, c1-14/2-c1
+L12: mov #2+(15/16), r6
+L13: mov L3[c3], r2
+.data -c4+-c3+20, (4-c6), (c1+c3+c2+c3), (13)*c5*2*-c3
+.data -12*7/5, ((c6)), 2
+L14: cmp #c7, L11[0]
+.data 16-c2/3, c1/2, -1/1
+.data 11-c4+1/3, (12)/1+c3-9-c3/12
+L15: mov L15[c6+(-c4)], r2
+L16: .data (15+19), c6, 3*9
+L17: mov #-18, r5
+cmp #2, L7[19-11+c6*c2]
+prn #20
+mov L13[(3)*c2/4], r2
+L18: .fill 3, c0
+.data 18, c0
+.define c8 = ((c4))
+mov L18[((c2*13))], r2
+L19: prn #3
+.define c9 = (c5/16)
+L20: .data c7, c4, c8
+mov L17[c5*c7+c0+c3*4], r2
+mov #14, r0
+.data -(c3/1)
+L21: .data (c9)
+L22: mov L13[0], r2
+mov #c2*-(c1), r1
+mov L15[(7)], r2
+.define c10 = c3/1
+.define c11 = (4 + 8) + 17 + c6 + (c9)
+mov #c9-0/4*c7, r2
+.define c12 = -c9+4*2*c6*c10
+.data 7
+L23: prn #c2
+.data (-5/2), c3+10
+L24: .data 6, 3+c5-7/12
+mov #c0+c4+-c12*(c12), r0
+.fill 1, c3
+mov L19[10-19/4+5*c8*9-c4], r2
+L25: prn #(6)/4*8*12
+cmp #c1, L19[7]
+prn #-c9/2/17
+L26: mov L23[c10+(3)-(12)], r2
+.data c0*c2/4/1, 12, 13/1
+.define c13 = --12/5
+.data c5*c11-c11, (2), c0
+.define c14 = c1-c12-c6+c10/5
+mov #c13+14--9+12/17, r7
+.fill 1, -(2+c2)
+L27: prn #((2+15))
+prn #c0-4+12*c6
+L28: mov L18[c6*c0*10-10], r2
+hlt
@@ -0,0 +1,39 @@
+mov #16/7-1/16--16+17, r2
+mov #(19), r1
+prn #13
+prn #-8/19--7
+prn #(11/5)
+mov #14--5/13, r3
+L0: mov #(15), r3
+.define c0 = 3
+.define c1 = -15-12/5
+.data 0/5/2-10-12+c0/2, c0
+L1: mov #-10-12-8/4+5+6, r5
+mov #c1, r3
+.define c2 = c1-9-c1*c1 + c1
+L2: mov #17, r3
+.data c2+c1+c0/1, c1/2, --c0-15+c2
+mov L2[12-c1*3], r2
+mov #6*19/3-(-c2), r3
+L3: prn #(c2)/3/2
+L4: prn #12-(c2)*20/2
+.fill 3, c0/1--18*14+7/4
+.data (-c0), 15-6+12-9+15, 4, 16-12*c0-c1*c2
+.define c3 = ((7))
+mov L0[12*c1], r2
+L5: mov L3[c1+18], r2
+mov #c3-14/5*-0-c3, r3
+L6: mov #c0*c3*11+-8*c3, r6
+.data 12, -12, ((10)*-c3), -c0*-c2-c2-12-c3-9
+mov L6[7-c2], r2
+L7: .fill 1, (11)
+L8: mov L0[16--0+c0], r2
+L9: mov #c1-7-12/3, r7
+.fill 1, c1*-1/1
+mov #c0/13+(8)+2, r7
+L10: .fill 1, (c3)+c0
+.define c4 = -6+c2/3
+.define c5 = (13-c3+c0-5)
+.data c5, (c4-10+(c4)), 11/5
+L11: cmp #c1-c3+c0-1*c4/1, L0[16--9+8-5]
+hlt
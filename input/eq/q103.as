@@ -0,0 +1,112 @@
+mov #3-0+4/3, r2
+L0: mov #16/9-6/18, r7
+mov #15, r2
+.define c0 = 7 + 18/3/5
+.data c0, -c0+15+-c0-9, c0/4, 12+10
+L1: cmp #17, L0[(16-c0)-16/4*c0+8]
+.data (c0*10*(c0)), -c0*c0*10, -17*c0*20*c0, ((18))+6/5
+.data -c0, 14, c0*12*c0*15-c0, 18-1+11/2
+mov #(1)+18--c0/1, r6
+mov #1+4+16*15, r7
+mov #8, r1
+.data c0*c0-3*c0, (17)*10*c0*c0, 2
+.data c0/14/4*15/4+c0/4, 0-15+4/3, 5, c0/2
+.define c1 = 1-(9)
+L2: .data 18/1*19*c1-18/5, --13*12*c0
+.data (9), c1, 2/18+c0/5, c1/2+(-16)
+.define c2 = 2+3+7*c0+(9)
+.define c3 = 17/5-3/3/5
+mov #-c0-2--0, r2
+mov #c0, r3
+L3: mov L0[c0], r2
+.define c4 = 3
+.data 12-12-0*c2*(c2), c3, c3/1, -c4/1-c3+17+c1
+.define c5 = -c2*c4-19 + c2
+mov #10*c0*5*c5*c1, r5
+.define c6 = 8
+L4: .data 12, 2
+L5: .data ((c4/5)), 12/5/5, c1--8-c4
+L6: .data (1+c1*c0), -14/17/3, -c6-8*11*c1-18, c0+16-c5-c1*((6))
+mov #c5/1/5*17/12*c2/4, r4
+mov L4[c2-c4], r2
+.define c7 = c1
+mov L2[-13/2], r2
+L7: mov #1*c2/1, r7
+L8: prn #1
+L9: mov #-0/3, r6
+.data -c7+c7/3
+.data (8)/3+c1+17+(c2), 5, 13, 15--c6/2
+mov #(c0+c0)/5, r3
+L10: .data (c3)-c7*c3, (c2), c1*6*-c2, c6
+mov L9[-4+-c4/4], r2
+mov #c3, r6
+mov L7[c0], r2
+.data c1, (c7), 15/2
+L11: .data c3, 9*c0+15+13*c4
+.define c8 = (18)-c7
+.data -10-9/16, 19
+.data c2-c4-2*9*-c3/5
+L12: cmp #c0, L4[-(20)/4]
+prn #8
+L13: mov #3+2, r2
+L14: mov #17+1+6*2*10, r6
+L15: cmp #(c5), L1[((c5))-c2]
+mov L11[c0+-c8*c7], r2
+.define c9 = c4
+mov L11[c8+14*12*18], r2
+.define c10 = -((c1))
+.define c11 = c2*18 + 1-c9 + c5
+.data 12/3*c11/5-c4-18, (5)
+mov L11[0-2-c9/2-0+c8], r2
+.define c12 = c3
+mov #(c7+c7)+c3, r7
+mov L11[14+17*13+6], r2
+mov #-14, r3
+mov L7[c9], r2
+.define c13 = 2*6-c6-c12-c8
+.data c13*c2-c0+(c6)/3, 14, -c12-9--1/8, c12/9-c2
+.data (20), (c12--13), c11*10-c9
+prn #c2+(-c10)
+cmp #8+c11/1-c13, L7[-2*c2/2-15+18+c7+13]
+L16: prn #(19+7*3)
+L17: mov L17[c6], r2
+mov #c3, r4
+.data c1, c11+14/3+13-c4, c2*17+10*-8, c5
+mov #14, r3
+.define c14 = 3
+.define c15 = -c14*16*c3+c1
+cmp #(6+19*3), L6[(10)+19-c14+12*c3]
+cmp #c0, L3[5-8/4]
+mov #--1*c13, r6
+.define c16 = 9+(9/4)
+L18: mov #7, r4
+.data -(14-c1), (13), 6
+.data -5/4/3, 14, -13-c4-3*-(9)
+.data c12, c14-13*12+c11-16, 4
+L19: cmp #3/15, L14[(c1)+c7-c1*-19/1]
+.data 0, 7-5, c3-15+-c2*(c4), 8
+L20: mov #c9*c2*16*(17*19), r2
+mov L6[c5-(c6+5)], r2
+mov #c3-13/5*(c1/2), r6
+.define c17 = 0
+.data -c16/1+c9, c11
+.data -(c6)/2, c5/12--11/5
+mov L8[-c15-6-(20)], r2
+.define c18 = (-2/1)
+.define c19 = c13+c3
+L21: mov #11+(15)-c18*c10, r4
+L22: mov #10+-19*2, r7
+mov #c6, r7
+mov #1, r5
+L23: .data (8/4), 13*c1*c18/3+6
+L24: .data -c17/17+c7/2, c6
+.define c20 = c6
+.fill 3, c10-1/1-(c18)*c14/2
+mov #-1-c1--11, r7
+.define c21 = c4/5*c12 + 3 + 7/18
+.define c22 = 3
+prn #-(c4-c14)
+.define c23 = c20*c6/1*c13
+.define c24 = c11
+.data c22*-c17*-c17+c7, 6, c23, 0
+hlt
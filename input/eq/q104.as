@@ -0,0 +1,23 @@
+prn #10
+.define c0 = 20-4
+L0: .data c0/2, -c0-c0-c0+17
+L1: mov #c0, r1
+.define c1 = 18/1
+cmp #5, L0[c0+18+c0+16+(c0-7)]
+prn #-c1
+.data c0*c1+c1+c1*1-(13), 10
+mov #17/2*0-10-3-c0-c0, r0
+.define c2 = (c1)/10+(10-3)
+mov #-8-c1--17, r1
+mov L0[c0], r2
+.data c2--c0*c0, c0, c2+6+11, c0-c0*1-4*(c0)-5+c0
+.define c3 = 19*c1*c2*4-8 + 9/1
+.fill 3, -(4)
+.define c4 = (9/3)+-(c1)
+L2: mov L2[(13+15+c1+2)], r2
+L3: mov L2[-(12)-3*15/5], r2
+mov #(c0-c4+c0), r6
+.data 4-15-c2/15*(c1)
+cmp #-15, L3[c1-c0+(10)]
+.define c5 = (2)-4 + 9*(c3)-12/14
+hlt
@@ -0,0 +1,96 @@
+.data -4*11
+.define c0 = -16-12/1
+mov #(3)-c0+c0/5, r7
+prn #c0+c0
+.define c1 = c0*c0-c0-1*c0
+L0: .data 6, c0--c0+(c0)+14*c1, -20*14+1+14
+.define c2 = c1 + (17) + c0/8
+.define c3 = (5)/4*c1 + c2/1
+L1: .fill 3, 16*18
+.define c4 = ((c2)) + 17*(c1)
+cmp #-(c3-c0), L0[c1]
+L2: .data c2, (1*c0+2-3), c3-c0+2/5-(c3), (0+c4)/5
+.define c5 = -c2
+mov #-c2-12--4-2, r3
+L3: mov L2[18*20*c5-(c5-c1)], r2
+mov L2[c5], r2
+.data c3-13*-c5+2, c1*c1-12/3, 13, c1
+prn #c4+c3
+mov #14, r5
+prn #13
+L4: prn #(c1)*c3-7*9
+L5: .data 14/5, c5
+prn #(1*c2*c2)
+mov #c4, r2
+L6: .data 19, ((14))
+L7: mov L2[2/13/5+(c4)/4], r2
+mov #16, r6
+.define c6 = 15+c1-17*0
+.data (15)/3, -5--c6-0, c0/17-c0/4, 11
+.define c7 = c3*c2 + c1/3
+mov L2[c7/4], r2
+mov #c6+c3/1*-2+-c7, r4
+mov L0[4+c7/3/2], r2
+cmp #(2-c4)+10, L2[c2-c7*c4-(16)]
+mov L0[c0], r2
+.define c8 = (-9)
+L8: .data 0
+mov L0[16], r2
+.data -(2)/2
+mov #-20+13/5, r5
+L9: mov #12, r7
+.data 4-c0-(9)/5
+.define c9 = c1*1 + 18 + 9 + c0
+mov #0/3+c4/18+7-c6, r1
+.define c10 = --8
+.define c11 = c4
+.define c12 = c3
+L10: .data 12
+mov #-c3-2+-c5, r4
+L11: mov #c10, r1
+.data -c11*3, 13, c0, c10/2+c11+c1+c3-9
+.fill 1, 12*(c2)+c10/14
+.define c13 = c12*19
+mov #(11), r1
+.fill 2, -(c12+0)
+.data 17+c4-(14)+c4*(7), (c4)
+.define c14 = (15-c5/2)
+L12: mov #(4*c2/3), r7
+.define c15 = 9
+mov #--c0/3, r6
+mov #--c2*c14*0, r5
+mov #c1-c9+(c1)/1, r2
+.define c16 = -2
+.define c17 = c16
+mov L3[((c16)*(12))], r2
+L13: .data c8, 14, 14, 6
+.define c18 = c16
+L14: .fill 3, (15)
+mov #((-4)), r1
+L15: .fill 2, c7
+prn #(11)
+mov #c5+(c12), r0
+.define c19 = --9*c15
+L16: cmp #c3*c4, L1[11]
+L17: mov L16[c17], r2
+mov #c3, r0
+.define c20 = 20*c6*-19*-c8
+mov #(c17)/5/3, r4
+mov L7[--13+2], r2
+.define c21 = 18
+L18: prn #20+c7*7*c1
+.define c22 = 8*12/5
+mov #c17, r6
+mov L16[c6/2+-c2*c22], r2
+.data --1-(2), (6/5)/3, c2*19*12+13/2, 16+7+1/2/3
+mov #8, r6
+mov #(8)*(9*9), r1
+L19: mov #16, r1
+mov L6[c3], r2
+L20: .data -(c16)+c3*c7, 9, (c2-c21/2), c9--c1*4+c13
+mov L0[-c10*0/5], r2
+.define c23 = --c17+3*c12--c16
+mov L2[16], r2
+L21: mov #10, r0
+mov L2[7-c21-c9-(c23)], r2
+hlt
@@ -0,0 +1,111 @@
+prn #5/15-9/14/8
+.data 10
+L0: mov L0[2], r2
+L1: mov L0[(6)*(4*13)], r2
+.data 4*12*7/6*4, 1
+mov L0[9/3], r2
+L2: .data 9
+mov #10/5*-9+(3), r0
+mov #0*12/2*11+18*1, r6
+L3: .data 16, ((6+8)), -17+11
+mov #-3/3-(19), r3
+.define c0 = 18
+.define c1 = 20 + c0*c0*c0 + 2
+.data c0, c1, (16-c1)*--c1
+mov #c0, r7
+.define c2 = c1/5*2
+.define c3 = c2-c1*18 + c1/2
+.data (c2), c2---16
+.define c4 = (7)/5*12
+L4: mov #10-5-1+13+c3, r4
+mov #7+(9)+7/1, r7
+.define c5 = --5
+.data 2, ((c4))
+L5: .data (8*c2-c1-14), c5, 15+(-20), c0
+prn #c4+2/4
+prn #c4-0
+L6: mov #c5-14-c4*(c4)--c2, r3
+.define c6 = 3 + -c2 + (2-13)
+cmp #(3*c3)-19, L2[-c3/3/5]
+cmp #(9+c0)+19, L0[c2/14-(c6)*3*c2]
+mov L2[-c5/5-(c1)], r2
+mov #-20*3+c4-c2*c0*16-1, r1
+.define c7 = 0
+mov #17/2, r7
+.data c4*-5, c7, 9*13-14-5/5
+L7: .data 4/1, -c7
+prn #(14*c3)
+prn #((10))
+.data c5*11, -10*c3*11+c1
+.define c8 = c1-c4/2
+prn #c7
+.fill 1, 10
+.define c9 = c0-c3-c3-18/2
+.data 8+1+(12), c5
+.define c10 = -4+c1*11+15
+.define c11 = (6) + c0
+L8: mov L1[c2], r2
+L9: prn #11+c11-c3/2
+mov L2[c10-c6*c5/17+(18)], r2
+L10: prn #-17
+mov #c5-(c10), r3
+L11: mov #(c11)/2/1, r7
+mov L5[c4+-c9], r2
+L12: prn #5
+prn #(-8)
+mov L1[(12-c4)], r2
+.define c12 = 1/2+c5*c1-c3
+.fill 1, 18
+mov #-c10/5, r0
+.data 19, 1
+L13: .data (c1/4)*16, -6-c8/3, c6, -c0/3+3*9*13/1
+mov L12[12+(-c3)], r2
+.data c3-1--19/1, c2-c10+7/2, 4+10+c6+c5/4
+mov #-c2-9+c3*c4/5, r2
+.define c13 = 19
+.define c14 = c4
+mov #c8, r1
+prn #c6-c7+12/3-c6-c3
+prn #c14+c13+c7-c2*c12
+mov L7[c7], r2
+mov #-c13/5/1, r1
+L14: .data 7, -c8
+.data c0-18+14-2, (0), c14
+.data c9+c14+13--c13/3
+L15: prn #c12*c6/8+c10
+mov #c7+c7-8/3, r0
+mov #-(16)---c8, r3
+prn #c14+-c1+15
+L16: .data 4*c14-c1-6, c1*c5, -(18/4), 12/2
+mov L13[(-3)+c5-12+0*c8], r2
+L17: mov #11, r0
+.data c12, c6, -c11
+mov #(--c8), r0
+L18: .data 6, c3
+mov L4[16], r2
+.define c15 = (0)
+.define c16 = (c8)-c8/3
+.define c17 = 7
+.data 3*9*12/1/2, ((c16-15)), c9, -19*0/3
+.data 7, c15*c16-c1-c13, 9
+prn #2*14-c0*c4
+mov L0[8*0/1*0+5+20], r2
+.define c18 = 0
+.data (18/3)+c7
+.fill 2, 20-6/2
+L19: mov #6*-10+11/2, r0
+mov L9[20], r2
+L20: .data c17-(20-6)
+.data c1
+.data c10/4/4, 13, c2, (c16)
+mov #7+(-c18), r4
+L21: .data 4
+L22: .data c18, c10
+prn #(-19)+c1+15*c1-11
+mov L14[c9*-c0], r2
+.data 10, c16, c12
+mov #(7*c18)/1, r2
+L23: mov #7, r1
+mov #c0, r6
+.define c19 = -12
+hlt
@@ -0,0 +1,52 @@
+mov #19/1, r0
+prn #10
+.define c0 = 4
+.define c1 = c0
+L0: mov #c0, r1
+mov #c0, r6
+mov L0[c0], r2
+mov #3--18/4, r5
+L1: prn #(c1-13*c1)
+mov L1[16/4*c0], r2
+mov #10, r1
+.define c2 = (9 + c1/4)
+prn #c0
+.data -8+6-c0+6/3
+prn #c1*8
+L2: .fill 2, --c0
+.data 1/1, -(c0)+(c1+c0), (1*c1-c2)
+.define c3 = 8/4-c1
+.define c4 = 20-c1--c0
+.data -15/3+c1*9, c0/4*(4), -0*-c4
+L3: mov #8, r4
+mov L1[c3], r2
+L4: mov #c0--4+c3, r3
+prn #(c1)-c0+(15)
+mov L4[13], r2
+.define c5 = (4)
+.data 16, -c5, c5
+.define c6 = c4
+.define c7 = (c6/4/2)
+L5: mov L4[(c1-16)*c7], r2
+L6: .fill 1, (17)+c3-c1*(c5-12)
+.define c8 = 3
+.data c4, 16
+.data -(20)+3/2-(c1), 1+1/5/1, -c5-18/8+c0*c5, c5
+mov #-2, r7
+L7: .data -(c7)/1
+mov L3[c6], r2
+L8: .data (c4), 6
+mov #c1+8/2/4, r4
+mov #2+c5/4+-12*c3, r4
+mov L5[(20+c7)*11/1-14], r2
+mov L6[-c8], r2
+mov #(17*c3/9), r3
+mov #(20*7)*4, r1
+mov L3[-(c7)+10/5], r2
+.data 2
+L9: .data (10)-(18)-c4, 11
+mov #13-c0*8+c6, r0
+.define c9 = c7
+.data c3*3*c2, -5*c9/1, --c0, 1-c0/15+c8-6+c2
+mov #12, r6
+hlt
@@ -0,0 +1,37 @@
+L0: mov L0[5/2], r2
+.data 2, 14+18/19/10
+.define c0 = -0-15
+mov #15+c0-5-0, r7
+.define c1 = 19
+mov #20, r5
+.define c2 = ((c0/1))
+prn #c1
+.define c3 = 12+14+16/2
+cmp #c0/15, L0[c0-c0/4+6]
+prn #(c1)*19-c1/5
+L1: mov #0, r2
+.fill 4, c1/1+(10)-9+c2*-c2
+.fill 4, -8+14+c0+18/2*(20)
+L2: mov #2*c2-9/3, r2
+L3: mov #-7/5/4, r2
+mov L3[c3], r2
+.define c4 = c3-11+11/4
+mov L2[-c1+8*c2*c4*7*c1], r2
+L4: mov #-c4*c2-2, r5
+.fill 2, 17
+.data 15
+mov L3[6], r2
+prn #8
+L5: .data 16, c2-12, 15
+.define c5 = (5)
+mov L0[-(c2*c0)], r2
+mov L4[6-c4/4*c3], r2
+L6: mov #-3/1+c4, r5
+cmp #(4+17)+c1+17-3-c0, L6[--5*c5]
+.define c6 = (c5)
+.data c4, c5*c0-8+10+(9), 12/7+19/4
+.data 8, c3*16+17
+.data 16, c0, (5)
+mov #c6/4, r6
+.define c7 = 1
+hlt
@@ -0,0 +1,56 @@
+.data 16
+L0: mov #1/11-5+0*5/5, r0
+.data 8, -17-13/15/3, 11+-7, (5)/4*(3)*16*13
+L1: mov #-7-0-12-5, r2
+.define c0 = 13
+mov #7, r4
+.data 10, 1-20, c0
+mov L0[20], r2
+.data 6+c0*18+11/10, -7/3*3
+mov L1[-c0+c0*12], r2
+mov #(8+10)+(c0)*19, r1
+L2: mov L0[8], r2
+.data (8+c0*c0*9), 20, 11, (-c0-c0)
+mov #c0/5+c0, r5
+.define c1 = ((18))/1
+L3: cmp #-c0-c0, L2[c1]
+L4: prn #c0
+mov #-5/3-6-16, r4
+.data -c1*c0, c0*c1
+prn #c0/1*(c1)
+mov L2[c1], r2
+.data 4, c0-2/4*c0*c0+c1/11
+.data -(c0), c0+c1*c1/1-4--c0
+prn #c1-11-9*16+c0
+.define c2 = (3 + 8)*18 + 18 + c0
+.data c2/3, 7/2, -c1*15-10, c0
+mov #11, r1
+mov #(c2)/4, r7
+mov #17*17+c2*c1, r7
+L5: .data c2-c2+(5)+-6-6, -17
+L6: prn #c0+15/1-(3/2)
+L7: prn #-0-c2
+.data 14*c1-5-c1+c2+c2, (13+c2*(19)), c2-c2-5*13+0-18
+.data c1*19/2, 7-3/18/4
+mov L5[(c2)], r2
+mov #12, r3
+.define c3 = 11/4-15*0*c2
+.data ((c1))/14, 14
+prn #6-c0-17*11/7
+prn #(17)
+.define c4 = (1)
+L8: mov #(c2), r7
+.data 0-c3+c2*c0+(20*6), c4, (4/1*14)
+.data (c3+c0+c1), 19*c1
+.data 20
+mov L3[10+4], r2
+mov L5[(10/4)], r2
+mov #18, r0
+L9: prn #-c2*-10*c2+10+c2-18
+.define c5 = ((c0))
+.define c6 = c0
+mov #c4, r2
+.define c7 = c5/5
+cmp #11, L5[-1]
+mov L6[--8-(2)/5], r2
+hlt
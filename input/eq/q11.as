@@ -0,0 +1,78 @@
+prn #(17)/1
+prn #12
+prn #10/2*(14)-6+10+6
+prn #18
+prn #(12)+1/3
+.fill 2, 14+3*--13
+L0: mov L0[(4)], r2
+.fill 4, (8)
+cmp #8+4+12, L0[19*20/2]
+.data 1-1/19/2, 19*12
+mov #1+14+6+15, r2
+.data 4, 2*20-1+11
+mov L0[17], r2
+L1: .data 3+2/3*-0+13, 0+(15)/2
+L2: .data (1)-4/10*13/3, (1)*19/15+(6)
+.data 15*6+(20)*4+8/3, 0, 12--7+8
+.define c0 = 0*10 + 12 + -3*20
+.define c1 = (4)*(2)
+prn #((c1))/5
+.define c2 = (c1)/2
+.define c3 = c2
+.define c4 = 10
+.data c3*c0-3+c2-19*20/16, 11-0, c1-4/5*10, 6
+L3: mov #c2*12/3*c1, r4
+L4: mov #--17+9, r1
+.data 2/3+c2/2, (c2*c2)+-c3/5
+.define c5 = 13-(10+1)
+.data c4+c0/7
+.define c6 = c4
+mov #3, r5
+mov #-(3), r7
+mov L1[(15+c4/4)], r2
+mov L0[c5], r2
+mov #(8*c5*c2), r7
+mov #(16), r3
+.define c7 = 18
+.define c8 = 17-c6-18-9
+.define c9 = c8/10/3+3
+.define c10 = 11
+mov L3[-5+15*c4+12/7], r2
+prn #c0
+L5: .data c7, (10)-(17/9), 16/3/4+(c2)
+.define c11 = 4+0
+.define c12 = 16 + c7*c3/17
+prn #-(c7/2)
+mov L0[(c6)/5+9-c10/14], r2
+.define c13 = 5
+.fill 1, c1
+.fill 3, -(c5)/3
+mov L4[5], r2
+.data c9+c10*10-17, -2, ((0-12)), c0
+.define c14 = 4--c5
+L6: mov #--c0/5, r5
+L7: prn #c4-14*3/4/2
+.define c15 = ((c5-1))
+mov #17/4, r3
+L8: mov #c9*3-16+(3)*c14*c13, r2
+L9: mov #2+17+(2), r2
+.data 0, 1
+mov #5+17+20/3, r1
+L10: mov #(5*1-18), r5
+.define c16 = (((2)))
+.define c17 = c14+19/2-c15/5+-c16
+L11: prn #(c7-c7+-c2)
+.data c1, c5-(-c1)
+mov L7[c14], r2
+mov L7[c12*c3-c4-c12-16/11], r2
+.fill 4, -1+-c6
+.data 20-c6/2*-c6, (9), 6+c8+c12-2*11, (7)
+mov #(c0)+c9+c12-(9), r0
+.data 5, -c0+8/4, c7
+L12: .data c13-c15+12*c0/20
+.data c10, 2, 9, c0
+mov #17-3/1-c8, r7
+.define c18 = (17/2*13)
+.data 8
+L13: mov #c2*-c17, r0
+hlt
@@ -0,0 +1,70 @@
+prn #(20+2*3)
+.define c0 = -13-11
+prn #c0-c0
+mov #c0, r2
+.define c1 = c0
+mov #c0-c0+-15*13, r1
+mov #-c1+(c1)*0+c0+0, r3
+prn #c1
+mov #c1, r3
+mov #c1, r2
+mov #c0, r2
+L0: .data (c1-17)-7+c0+c0, c1/3
+cmp #-c0*-c0-8, L0[c1]
+mov #1+11+18-c1-c0/4, r4
+.define c2 = c0*3/10/4
+.define c3 = 11-5/4 + c0
+.define c4 = 9
+L1: .data (10+c3+c0+c2), c4, 0/4-2, -c3-12
+L2: mov L2[c4], r2
+mov #(3)-3, r7
+.data -7, 14
+cmp #-c3*18, L2[(c1-7/3)]
+mov #c4, r4
+prn #3/1+c2/4/5
+L3: mov #14, r3
+mov #c3-13-c3-(c4)-17-c4, r1
+L4: mov L4[c2], r2
+prn #16
+L5: .data (c3-11)+6/2+c2-7, (c4)
+mov L0[c4], r2
+cmp #c0, L1[-10]
+mov L3[2], r2
+L6: .data -c1-17/18, c1/3
+L7: .data (3), c3, c1+c0/18+7-12
+.data 11, -15
+mov #c4+8*(9)*c3-8-6, r6
+mov #(c4)*20/5, r7
+prn #c3-c3-(5)/4
+.define c5 = -c3/11*-c3
+L8: prn #c5-c0/1-c5+13-15/1
+L9: mov #c5+c3/4/1, r6
+.define c6 = c3
+.data 19/5/5*-c2
+mov L7[(c0)*c2*3/4], r2
+mov L9[c2], r2
+.define c7 = c2-c0 + 7 + 5
+.data c5, c1
+.data 9-(c7)-20-12, (16+c0*c0/12)
+mov #(-9/4), r2
+mov #c4, r1
+mov #20, r4
+mov #17, r0
+mov L6[c4], r2
+L10: cmp #c7*c0*19*0*9*1/13, L9[c6+-c0*0]
+mov #(9)/4/1, r3
+prn #(-2)
+.define c8 = (12)
+mov #-5*c2/1, r1
+.data 8
+.data 5+c6/1/19, 19+c6, 14, c8
+L11: .fill 2, 18
+.define c9 = c4
+mov #c9, r7
+L12: prn #6
+mov #-c4+c8-c7, r3
+L13: .data 19*(c0)*-14, (3)*-c4*c3, -c2*2+15-c0/2, c8
+L14: mov L6[(c5)*-c0-15], r2
+.data c0, 7, c2+17, -c2-c8-0
+L15: cmp #3, L0[5]
+hlt
@@ -0,0 +1,48 @@
+prn #13
+L0: mov #13, r3
+.define c0 = 10/1*-7*1
+L1: .data 4/19/5/4
+mov L0[13*-(20)], r2
+.data 12, c0, -18+8/4, 0*9/17*-(12)
+mov L0[0+c0*18+8*7], r2
+prn #17
+.data c0, 16+(8)
+mov #(6)-4*(c0/12), r4
+L2: cmp #20, L1[(14)+c0+c0-c0*c0*c0]
+.data c0-c0*1, c0*16-c0/12+(c0)
+mov #c0, r6
+.data -2+8*c0+15, 6, 9/2
+prn #c0*0/4--c0
+mov #c0, r1
+prn #c0+c0+c0
+.fill 4, -c0+3/4
+.data -c0, c0*c0-5+c0-c0*c0+13, c0
+mov L1[c0--18*-12], r2
+mov #(20+c0/6), r5
+prn #-c0*c0+c0*c0/20
+prn #c0/2+(11/19)
+.data c0-13+15/1*4
+mov #(c0)/2*c0, r7
+.data ((c0))-(3/3), -(2/1), (c0), (c0/4-c0)
+mov #--c0-7+2, r3
+L3: mov #c0, r6
+mov L2[c0], r2
+mov L2[-c0/2-10+c0], r2
+mov #8-c0+c0, r3
+mov L0[-c0*c0*(0*c0)], r2
+.data -c0*19+-11, 3/2-10
+L4: mov #11, r6
+mov #14*c0+20+18-2, r1
+.data 19, c0, (c0)/2/7, 5
+.data (6), c0*c0-8
+.define c1 = 16
+.fill 2, 5*c1*c0-c0*c1
+mov #((c1+c0)), r6
+L5: .data (c0)-c1+c0*c1, c1, c1
+prn #13*c0
+.define c2 = 20
+.data c2/3, c0/2*-1*8
+L6: mov L2[6], r2
+L7: .fill 2, c1
+mov #3, r1
+hlt
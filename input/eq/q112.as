@@ -0,0 +1,82 @@
+prn #14
+prn #7
+L0: mov #7-2*12-19/6, r4
+.data 17+7
+L1: mov #8/1, r3
+mov #12, r3
+L2: mov #19, r1
+mov #15, r1
+mov #2, r0
+mov #-4*2*15, r6
+L3: .fill 3, (17-(4))
+.data -9+5+10/8, 9/9/4, 9-14/11
+mov #2, r3
+.define c0 = 18*14-13/13
+.define c1 = c0
+L4: prn #1
+.fill 3, c0
+L5: mov L1[c0*20/1*c1-5+-c0], r2
+.data c1, -(c0+19)
+L6: .data -8, c0+(17)*-13
+.data -c0, c1*16/2*-c1/14, -20, 19*-13/14
+.data (9)-10*6+c0, 3
+.data 16+c1*c1+(c0)--16, c0, c1/1
+.data c0, c1, -17/4+c0+c0, c0
+cmp #7, L0[c1/5]
+.data c0*(11*7), c1+2/2/1
+.data -7+8*11-19
+.define c2 = c0
+.define c3 = (c1)*c2*c2/3
+prn #-c0
+prn #20+14+13
+mov #-c1-0/2, r1
+L7: mov L5[c2*20-17-c3], r2
+.data c1, c1
+L8: mov #7+(11)-c1, r2
+mov L5[c3*7], r2
+L9: mov #c2*c1+-0*c2, r4
+mov L5[c1-12*c0+(3)], r2
+mov #((c1)*(20)), r3
+.data 9--11/1
+.data c3, 11+13-8+c3/3
+L10: .data (12*c1/4), 20-c3/5-c0+10/3, (18)*(c3)-16*7
+prn #4*20-c2-c3
+L11: mov L0[-20*c0+-13/2], r2
+cmp #14*c1*(4)+(c3+c0), L3[(3)-c2]
+L12: mov L8[c2], r2
+L13: mov #c1/3, r6
+.define c4 = 10
+prn #7*c1
+mov #---c3, r4
+mov #c2-c1/4, r0
+mov L6[--c0*c4], r2
+.data 2*5+c3/3, 17, c4/1+c1
+L14: .data -c4*13+c0*14, c4*c2/5---7, 17+c1*11/4
+L15: mov L4[14], r2
+mov #((0)), r0
+mov #c1-6+c1*-c4-0, r7
+L16: .data -7*14/3*15, c0+-c0+c1, 20+14+10*c2/4, c0+c0/1/13
+L17: prn #c4
+mov #c2, r4
+L18: prn #0*16+4+-19
+cmp #10, L17[6]
+mov #(c0+20/5), r7
+mov #19, r2
+prn #(7/6)-7*(6)
+.define c5 = c2
+mov #c4, r1
+prn #--(c3)
+mov #(17), r0
+.define c6 = -9/5
+L19: mov #c1, r3
+L20: mov #16+11-c1/4/5, r7
+mov #c4+c1-c2+8*c4/6, r6
+cmp #c1/3, L5[c2/5]
+mov L1[10--4-(10-c4)], r2
+L21: mov #c0, r6
+cmp #13/4-c4*c0+c5*c5+19, L21[c1-16/3+12]
+L22: .data c0, c0
+.data --c3*1
+.define c7 = c2-4/5--c1/5
+L23: prn #6-(14)
+hlt
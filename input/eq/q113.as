@@ -0,0 +1,24 @@
+mov #15, r5
+.data -7+5/3
+mov #2-5-9+1-8, r1
+mov #5*2-(4)--18*14, r3
+mov #9, r5
+prn #6
+mov #6, r5
+.define c0 = (6*7/14)
+prn #15
+mov #12, r0
+.data 13*18*8+11*c0/2, ((c0)*c0*6), c0, -(c0)
+prn #(-c0*c0/12)
+.define c1 = 20
+prn #19*c0--c1-(c1)+1-c0
+mov #c0, r1
+mov #c0-c1*c0-15+(c0)/4, r1
+prn #c0*12+c1+c0
+.define c2 = (-0+8)
+L0: mov #-c0/1-14-17*20+c1, r1
+.define c3 = -c0-c2
+L1: prn #-(8)
+mov #-c1/5, r3
+prn #15/4
+hlt
@@ -0,0 +1,51 @@
+mov #16/19*2*3+16, r4
+prn #(4)*-6/5
+.define c0 = 13
+L0: .data (c0), -c0
+L1: mov L0[(c0)+c0], r2
+L2: .fill 1, 4
+mov #14, r1
+prn #-c0+c0/14/1
+.define c1 = c0/20/3-19/2-c0
+.fill 1, c0*13/1+14*2--17
+prn #12+(5)*2
+mov L1[0], r2
+mov L0[c1+18+c0*-1], r2
+cmp #-c1/3*(3), L0[-10/3]
+mov L1[--4+-3], r2
+mov #(14/1)+c1/5+7, r2
+mov #13, r5
+.data --5/19, c1
+L3: mov L0[c0+-c0+c0-c1+c0], r2
+mov L2[c1], r2
+L4: mov L2[2/2], r2
+prn #c0
+prn #15
+prn #c1+c1
+.fill 3, c1
+.data (13-15-c0), 5
+.define c2 = c1
+L5: .data c1*7, c1, 5/1
+mov #(7), r0
+mov L3[-18/3+10], r2
+.define c3 = (c2-15*8*c0)
+L6: mov #c1, r6
+L7: mov #-c1*14*c1, r4
+mov #(0*c3-c2), r7
+mov L3[-13/2+(c2)*8/5], r2
+L8: prn #(11-c2-16)
+.define c4 = 10
+.data -0-19*-c2*c4, ((c3))+c3, 7, c0*c0-17/16
+L9: mov L5[15+-12+20-c4], r2
+.data c2, c1, c0/1
+.data (18)
+mov L0[c4*2*c2+12/2], r2
+.define c5 = 19
+mov #-c0*c1--18, r2
+mov L5[c3/3/1+14*c1*c2-c1], r2
+.define c6 = c3
+.define c7 = c1
+.define c8 = -(4)/5
+mov L6[(20)/5*--16], r2
+.data c6+(3), c7/3, c3/2-13*c3+c8+c2, -7
+hlt
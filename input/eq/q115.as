@@ -0,0 +1,57 @@
+.define c0 = 17
+mov #5/4, r7
+prn #16
+.data 20/5, c0/5-(c0)-11
+.define c1 = -16*(c0) + 1
+L0: mov #6, r1
+cmp #-c1-15*19+7+c1-5, L0[14*c1/5/3]
+L1: mov #14*17+0-17/3, r0
+mov #-(7)+-10, r4
+mov #(2*c0)*12-17/5, r0
+.define c2 = -9-(c0-c1)
+mov #11, r0
+.define c3 = 0 + 14
+.define c4 = -18
+mov L0[13], r2
+.define c5 = (c1+3+(c4))
+.data -10+18*16, 4, 6
+L2: mov #c1/2+c4, r1
+mov L2[18], r2
+mov #(13+18)-(c3)+8-2, r4
+mov #c5, r2
+.define c6 = 5/12*c1 + 20*-16/18
+mov L1[(c6+7)+c0+-18], r2
+mov L2[15*18+20+-c6-c0], r2
+.define c7 = -c3
+.define c8 = 4-(2)
+.define c9 = -c8+c0/2
+L3: mov #14, r7
+L4: prn #c4
+L5: prn #c3
+mov L1[c3], r2
+.data 2, c7
+mov #(c6)+c0+9+12*c6/2, r5
+mov L1[3+c5+c5+9+c9], r2
+.define c10 = c0 + c6 + c3*c1*14
+.data -(c7)+c9
+.define c11 = 3-(c9)-3/19
+mov #12, r4
+prn #9/18*(11*c0)
+L6: prn #(c0+c4)*16
+mov #6, r1
+.define c12 = 9+c3
+L7: mov L2[(c7)*8+20-(12*12)], r2
+mov L7[-c5*20/4], r2
+.data 9, c8/5, (9/5)*0*c2*c12, 13
+prn #-18+c12-c4
+.data --c7+c7
+L8: cmp #-c2/18-5, L1[(-c0)]
+.define c13 = -18/1
+mov L4[5], r2
+mov L0[-10*c12/3], r2
+.fill 2, c1--1/2
+.define c14 = (c12)
+L9: .fill 4, c9
+mov L0[((c12)+13)], r2
+mov L0[c9], r2
+hlt
@@ -0,0 +1,116 @@
+mov #20, r1
+prn #(13)
+prn #(17+14)+(-10)
+.data -7+13-7*20*1
+.data 8/1, 1, 8
+L0: mov #9*-3-(14/17), r5
+L1: mov #10-8*16+11*2-11, r6
+.data (12)/4-3/1
+L2: .data 15+14-17-17
+mov L2[18+8*6*15*3+11+14], r2
+mov L2[6/5], r2
+.define c0 = (6)
+.define c1 = c0
+.data (c0-c0+17), c1*c1*c1-c0, -c1*c0
+.define c2 = 18
+.data c0
+.data c2+8*11
+.define c3 = 11*c1
+L3: .fill 1, -2
+.define c4 = c0-c1/3*(c3)*-19
+mov L2[c0/5], r2
+mov L3[c3], r2
+L4: mov L4[c4], r2
+mov L3[0], r2
+mov L4[(20/1)-c3/5], r2
+L5: mov L1[(c2+c1)+c1], r2
+L6: mov #(-c1)/9, r4
+.fill 1, c2
+.define c5 = ((9))
+.define c6 = -c1
+.define c7 = (c5)
+cmp #20, L2[c6]
+.fill 1, 18*c0/5
+mov #-19/3, r6
+cmp #3, L0[((9*2))]
+mov #12-17+c4+17*20, r1
+.define c8 = -8/10
+L7: mov #-10+14+(15)/3, r1
+.define c9 = (11)
+mov #16, r1
+mov #c0, r4
+mov L5[-18*c7/2*(c2)/2], r2
+mov #13-c2--c2+c9, r0
+.define c10 = c4-c0
+.define c11 = c9/3
+.data 18, (c6-c5*7-5)
+L8: .data c1
+mov L1[-((15))], r2
+prn #-3*c8+c2*16+(c10)
+mov #7/1/19*-13*c1, r7
+.data 6, c6
+L9: .data -1/3/3, c7-(c4)/1
+mov #1, r3
+cmp #(13/2)*--7, L2[c4-7+3/2]
+L10: .data -14, (4), (c9), 17*0
+.data (19)/5/5, c2/3, c3+5-5-12+3-14--c11, c4
+mov #c4/3, r1
+mov #0+17, r1
+cmp #(c11)/4, L2[(c7*17-c4)]
+.define c12 = c5-3-14*(15)
+.define c13 = c11 + 17/4*(c4)
+prn #2/1
+.data c12/2*c8, c11, c11--9/1
+.define c14 = 2*4
+L11: .fill 4, 2
+L12: mov L4[0/5+13], r2
+.data -6*0*19-14-20*14, (2)/3+c10*c8/4, c2*-9/15, 8/3
+prn #12
+L13: .data 6-c6+c0-11-11, --c10*-10/5, -2-c10
+mov #7, r6
+mov L1[9], r2
+.data 11, c5*(12*2), c13-c0, c8+16-c1*(c6/5)
+.fill 2, c13+c6+16--c13
+.define c15 = 4-14-c13+c4
+mov L1[16], r2
+L14: prn #c4
+prn #c7
+prn #((c14)+c5-14)
+L15: mov #c5, r1
+L16: .fill 1, -c7
+prn #(9/10)*-c8-c7
+.data 13
+L17: mov #c3-c9+c3/10/1, r5
+.define c16 = -14-13/1
+.define c17 = c7--20/1
+mov L9[(20)], r2
+.define c18 = 4+c16*-14
+.define c19 = -c4/3/3
+L18: prn #c5-c13*c10/2
+mov #(c3)*(c8)*5/11, r1
+.define c20 = (16)
+L19: .data -c15/20/2
+L20: mov L14[15+c7+8-0--0], r2
+L21: .data c14-18/19/3, (1)+5
+.fill 4, (c10*4/5)
+.define c21 = 9-c14 + 17 + 20
+mov #5*c6, r1
+L22: cmp #12, L3[(c2/2*c8/1)]
+mov #-c5/1/4, r0
+.define c22 = 15*9/3 + c6
+mov #14/5, r6
+mov #c8, r0
+mov #(15-13/2), r4
+.define c23 = (-(c12))
+mov #(c16)/2*14, r2
+L23: .data (11)+2/5*17, (c21/13*(19)), 2, -8-c10-c6+c8*c19/3
+.data c16, c21/5*-c4/1, 10+4+11, --c9-15
+.define c24 = c11
+.define c25 = -c19*6
+mov #c4, r4
+mov L1[5], r2
+.define c26 = 18
+L24: prn #5
+mov L19[-20-c6-3/2-9], r2
+mov L5[(c4)+7--c22/4], r2
+hlt
@@ -0,0 +1,51 @@
+.define c0 = 13/4
+L0: .fill 4, 11-(0/5)
+L1: .fill 3, --c0
+.define c1 = c0*0 + (18)/4
+mov L1[14*c1], r2
+.define c2 = 15*2*c0*(20)
+L2: .data c1*(c0+13), (c1+4), -18/1*(0)/5
+L3: .data 2-c2*c0+c0*(2)-6/5
+mov #(c1*c2+c0), r5
+mov #2, r3
+mov L0[5/4*6*c1/15], r2
+L4: .fill 2, 4*c1+16+c0/4
+mov #c0*13/4, r1
+L5: mov #c1/4, r2
+mov #(12+c0)/5, r5
+.define c3 = c1
+cmp #(1+c2)*(c0), L4[((1))-c1]
+prn #c0
+prn #c1
+L6: mov #-7+12+9+-c2, r7
+mov #c0, r3
+L7: mov #c0, r7
+L8: prn #c2
+.define c4 = (20)+0
+.data (20+13)--c3, -c1/2, -(c0-c3)
+L9: mov #c2+(2)/3, r3
+.data -20, c4, c1, c3
+cmp #(c1)+0+c1-19, L0[-19*c4+c3/3]
+mov #-5+c1*c2, r5
+.define c5 = 9*12/1
+L10: mov #(11-c0*c3), r2
+mov L3[4], r2
+.define c6 = (10)*c2*19-c1-18
+mov #--13-5, r0
+.fill 1, 11
+.define c7 = -(c1-c3)
+L11: mov #-4/4, r4
+.define c8 = 3/4-(3) + -4/6
+.define c9 = 1
+.fill 3, (c1+(11))
+mov #-c9*c6-19, r7
+L12: .fill 2, -15
+.fill 3, c1
+.data c1, c8+c9-c9+c9+c5, -c7+(2+5)
+.data c2, c6, 16
+mov #-10*-19, r4
+mov #5, r7
+mov L3[--c7/17], r2
+.data (2-c2/3)
+L13: mov #c1, r7
+hlt
@@ -0,0 +1,112 @@
+mov #9, r7
+.fill 3, 8*-5+4/3
+L0: .data 4-7/3-10+5-17, 14+18*4*5+14-14, 15
+.define c0 = -19/5/4
+mov #c0+c0+12*--0, r4
+.define c1 = 14
+L1: mov #7+10*17/4, r6
+mov #c1, r2
+.data (c1)
+.define c2 = (c1*c0+8)
+prn #3*6
+L2: .data 13, -c1, (20/1)+(c1), -c1/17*c1+8/4
+mov #(c1*10/8), r5
+.define c3 = -c0-17/16
+.define c4 = c1
+L3: mov L2[c2-c1], r2
+.data (8)-3+(20)*17, (c0), 8/1-12-c0*c2
+L4: mov L3[c4*c1+12+19/5], r2
+.define c5 = (0-c4*c4 + 6)
+mov L2[(-4-(0))], r2
+.define c6 = (9)*1*-c5/13
+L5: mov #20, r7
+mov L0[0-c3], r2
+L6: prn #c2/13*(c1)--12
+.data -17/19*19, 13*3/6, c3
+.define c7 = -c1
+.define c8 = 16
+.define c9 = c1
+.define c10 = -c0*c4/4
+.define c11 = ((c4))
+mov L5[2*c5+4*5--4/5], r2
+L7: .data 10, 14*-c6+c2, c5
+prn #c5+11
+mov L5[18], r2
+mov #11, r2
+.data 14-c0/2, (-11-14), c1/1, (c1)
+mov #1, r6
+.data (17/1/2), -3+-4
+L8: .data 8, c4-(8/17)
+L9: mov #c8, r2
+.data 4-18+c5/1
+.define c12 = c10
+L10: mov #c12--17+c9, r3
+L11: mov #(c8/6)-c0*2-c4, r1
+L12: mov L9[-c3-14], r2
+.define c13 = 11
+L13: mov #15-c2/19, r0
+.define c14 = c8*c7+4/5
+L14: .data (17), 6-c10-c2
+L15: .data c12-9-10*c1/5, -c2-c3
+.define c15 = c8-0*c13-c6/3
+mov L0[c5], r2
+prn #16-(19*10)
+L16: .data c3
+.define c16 = c3
+prn #-c8+0-3
+.define c17 = -c1*c13/2 + -c10
+mov #c15-14-c9--18, r0
+.define c18 = c17/5/3-13+5/3
+mov L7[c0+c2*8-c5], r2
+.define c19 = 20/2-c17--9/2
+mov L0[(16/11*5+c0)], r2
+.fill 2, 14+c16/5*c3
+mov L15[c7-c12/4-(c6)], r2
+.data 7/4, 6+-3*9/12, 10*(9), -(c8)
+.data (3-20-c7/4), 18*-20*13-c5
+.define c20 = 17*c9 + (c6-10)
+L17: mov #c0, r3
+.define c21 = 14
+.define c22 = -c18 + c6 + c10
+mov #-c21+0/3, r7
+mov #9, r7
+.define c23 = -6*c1/1
+.define c24 = 13
+mov #c5, r4
+.define c25 = ((3))
+L18: mov #12/5-8*9/1, r0
+.define c26 = c25
+mov #c2-c1/5-c14/5, r3
+mov #-(c25), r1
+.data 9+20-c16-6
+mov #6, r7
+mov L18[-c1/4], r2
+L19: cmp #0+11*c3*8-c2/4, L9[4-c14--10*(0)/13]
+L20: .fill 3, c23*15+16-6*18+c13
+mov L13[(c1)], r2
+mov L16[2], r2
+.data 1*8+18*-4, c22, 2
+.data c19
+L21: .data 13+(c23)
+L22: .data -c18/1/4, c9--6*c7-20-c0/12, c14
+prn #20
+.data -18--13, c16*c7+c21-c13*c3/1
+.define c27 = -c3/4-c9
+prn #(c2)*(c18)+c13
+L23: .fill 4, -(7-4)
+mov #c0, r0
+L24: cmp #-c26/5-(12/4), L12[8]
+L25: mov L22[-c10*(c2)*c7+14], r2
+prn #c8*-c0
+.data 16
+.data c22+9
+L26: .fill 2, -c20+17-c1
+.fill 3, c11-20-c4-19/7-c18
+.data --18, (c5)-c13*20/4, -3
+.data -c7-c23*9*19/4, 8
+prn #c23*1
+mov L15[c0/4-0], r2
+prn #(c16)
+L27: mov L24[c1+1*c19-c26], r2
+mov #c2*17-c22+(15-12), r2
+hlt
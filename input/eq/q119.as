@@ -0,0 +1,57 @@
+.define c0 = 8-18*8/13
+L0: mov L0[c0], r2
+prn #c0
+.data 0/3*13*c0+c0, 20
+mov #5, r5
+.data 19-c0-0/1, c0/18*(c0)+c0, 1
+mov L0[c0], r2
+.define c1 = c0
+.define c2 = c0
+mov #11/11/1+9+11/4, r6
+.define c3 = --2 + 7
+mov L0[9], r2
+mov #c2, r0
+mov #c1*-19/1, r1
+prn #(9)/1/3
+.data c1, c3, 0/2
+cmp #17/3, L0[(9/5)]
+.data 20, 12/4
+.data (2)*18+c3+18/3
+mov #18, r2
+L1: mov #2-c1, r1
+.fill 1, -10*10+0
+.data 3
+.define c4 = 0 + 20 + 0 + -5/2
+L2: mov #c1, r2
+L3: mov L1[c1/10-9+9*(c4)*17*1], r2
+.define c5 = 12+14-1
+L4: mov L2[(c0)/4+c5], r2
+L5: prn #20
+.data c1, -c4*-17
+L6: .data (3), --c5+7+c0/3, -2/5*c1, (13/11)/9
+.data 3+-c3/3, (16)
+L7: mov L3[-1/1/3], r2
+.define c6 = 12
+prn #-c3+6-5/2
+L8: mov L8[2], r2
+mov #8-10/3-3-17*18, r3
+.define c7 = -c6-17+c0+18/2*c2-7
+L9: mov #7/3+10, r6
+.data 0
+.define c8 = 17
+mov L0[-c4*5*18], r2
+mov #(c5/8), r2
+mov #c1, r5
+prn #c6
+prn #(5)-11/3*-1+c4
+.data 4, (c1*c4)/2, 6-15*c3
+.data 7/3, c4
+L10: mov L4[((6*c6))], r2
+L11: mov #7, r7
+.define c9 = c0 + c5 + c1/2
+mov L1[-c0], r2
+cmp #(7*c2)-c3, L0[4--18*0*19]
+L12: mov L12[(20)], r2
+L13: cmp #c3/5, L11[c5/19/3-11]
+L14: mov #c6/1, r7
+hlt
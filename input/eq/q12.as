@@ -0,0 +1,81 @@
+.data 0, 6-6-11/14, 10
+mov #1, r3
+.define c0 = -2+19/19-16-1
+prn #--16*c0
+.define c1 = c0 + c0 + c0-c0 + 3
+prn #c1-19
+.define c2 = 0/5-(c1)-(14)*c1-c1
+prn #c0
+mov #c0/5+c1-c0*0*c0/5, r1
+.fill 3, c1
+L0: .data -c1, (14), c0, c1
+mov L0[16], r2
+prn #-c2+20*10/4
+.define c3 = (-(c2))
+.define c4 = c1*4*c0/2
+cmp #6, L0[6]
+prn #1
+mov L0[18], r2
+mov #c3+0*c3/3, r5
+mov L0[c2-c4*-c4/4], r2
+.data 3*c4-c3/6, 15/2-c1+c1-c0, -c3/13*--9
+L1: .fill 1, (-6-c4)
+.define c5 = c3*20/5*c0-17
+L2: mov L2[11-5*2*c0/3], r2
+L3: prn #(19+13*(c1))
+L4: .data --c4, 10+10, 6, 10+c2+13/10
+mov #c0, r1
+mov #1-10/2-c3+c1/4, r3
+mov #8-19-15-c3, r4
+.define c6 = 18
+L5: .fill 2, c0*c3/1
+.define c7 = 8
+.data (c5+3/11), 5-10/3*17/2
+prn #(c6)
+.define c8 = ---c4
+L6: .fill 1, c1-c2
+L7: .data (10)+-0*c2-c7, 12*c6*c6+3*c6, c0, 2*15
+.data 20
+L8: .fill 4, c4+c4/1-11
+mov #(13+c0+16), r6
+.fill 4, 20/4
+mov #c5, r3
+.define c9 = (9)/4/4
+.data 0, 19/2*-c7
+L9: mov #((3)+18+c6), r3
+L10: .data c2-3/3-2, c8*-c7-8/17, 6, 13+16+(c7)*19
+mov #-c9/11*c8+c4, r5
+mov L6[18], r2
+.data (12)*4-c7/2
+L11: .data -6/4, c2
+mov #-c0*c0+13+c9, r5
+mov L7[c6], r2
+mov #--18/5, r2
+L12: mov #18-c1-c8+c1, r4
+L13: prn #13+17/3*1/4
+.define c10 = c4
+L14: mov #-4+-c3+c0, r7
+prn #1/3
+.define c11 = 2*8+c7+15-c8*c9*c3
+.data -(-c5), -17/3, c0-c2-16/4*20*9+-5
+L15: mov #3+c4/5*12, r7
+mov L8[c3*c2], r2
+L16: mov #7*c1+c6/1, r7
+.define c12 = ((5))
+.define c13 = 17
+prn #12+-15--c10-2+c12
+L17: prn #c1
+L18: .data c4*6/5-c2, 4*-15+17, c1*--19
+L19: cmp #(7), L11[c10+2-1/2]
+L20: .data (10+c10)+(c9)-c0, c8, --(c3)
+.fill 2, c6
+L21: .data 12+(c8)/1, 8-c1*-c3*(0/15)
+mov #14*c11, r5
+.data c13, c3
+.fill 4, c13*6*(c8)+4-20*c6
+.define c14 = -(19) + 8 + 14
+mov #c1, r6
+mov L13[3+17/5], r2
+mov #4/1, r6
+.data c1-(c3), c1/3/4
+hlt
@@ -0,0 +1,86 @@
+.data 6, 8, 12+14/6*16+6*9, 13/2
+prn #-16-7*16*12
+L0: mov L0[10], r2
+L1: .data 20, -(16)-11+(6)
+mov #(4)*9*0/7/3, r4
+L2: mov #17+0, r0
+mov L0[11], r2
+L3: mov #20, r6
+.data 12, --20*3, 1+4-0-4*9
+.data --1/1, 12+2+17+20+20, 8-10-1-11+17-15, (6-14*5-16)
+.define c0 = (-14)+5
+.define c1 = (c0)-c0-c0*c0-c0/15
+mov #-c1, r3
+prn #-17+c1*0+17
+.fill 3, (17+14/15)
+mov #11, r3
+mov L1[c0+-c0*c1/4], r2
+mov #-16-c1+12*c0, r6
+L4: cmp #19+0/7/1, L3[c0]
+.define c2 = c0
+L5: .data -2+c0*-1, 13, c1
+mov #c2, r3
+.data c0+10
+.define c3 = 14-c0-18/1
+.fill 2, c2/4
+.fill 1, -(8+c3)
+prn #17
+prn #20
+.define c4 = 10
+L6: mov #7*14+8*c0, r3
+prn #c3
+.define c5 = 15
+.data 17
+L7: mov L1[c4/19*c2*c2], r2
+mov #20, r6
+.define c6 = 4
+mov L6[-9/13+c0+c5--0], r2
+L8: .data (c6)
+.data c0*c1/10, 4, 11/5
+mov L4[2], r2
+prn #2
+mov #c3, r5
+prn #-c0-c5+c6
+mov #5*c5/3-19, r2
+.define c7 = 1
+mov L1[c4/1], r2
+prn #c0
+L9: mov #20-15-c0/3, r1
+.define c8 = -14
+.define c9 = (10*19+-18)
+.define c10 = 14
+.define c11 = 13
+mov L0[c9], r2
+.fill 3, (19)
+L10: .data 0, (2+c2)+0
+mov L2[-c4-4*c5/2*9-13], r2
+mov L0[c10], r2
+.data 15, 15, c6
+L11: mov L4[16*c10/5], r2
+mov #c1-11-9*c5/5, r5
+prn #c9
+mov L9[-4+c2+1+c1], r2
+L12: mov #17-c6/14*-c1-0, r6
+.data --11+(c9)
+.data c4/4, (-c2)/1, c1+5-c10, -c10
+L13: prn #--(1)
+.define c12 = 15-14
+L14: mov #c4, r4
+L15: mov #18*c9/3+c1+5+c10, r7
+.define c13 = 0 + 10/19 + c7
+mov #c3, r3
+mov L2[20], r2
+mov #(c13/5*9), r4
+cmp #c9+6, L15[c9*11*19*16]
+.define c14 = 16*c3*1-13
+mov L14[(5)*-7-12], r2
+L16: mov #9*c7, r5
+L17: prn #3
+mov L13[c2], r2
+.data (-15+12), (c8), c12
+.data 7-17+4/4, 1/6+c3/1
+.define c15 = c1
+mov #-14*c12/1, r4
+.data 7+16-c1+c8+-c5, 1-(8/3), 15
+mov #-c5*(c2/13), r6
+hlt
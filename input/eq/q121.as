@@ -0,0 +1,32 @@
+.data (15)-(19)*20, (3*(11))
+L0: .data 5+17+13-(19)+(10), 12, 18, 11+5-18
+.data -20/12/5
+L1: cmp #-8*20/2, L1[4-15+17/2]
+.data 15, 4/18
+.data 0+0+19-9*10/3, 17, (20-15)*-19-18/1, -12-19*2
+mov L1[17-20-3-(14)], r2
+prn #7+-20*3
+mov #13, r2
+.data 1*3-14-(12)-16/14
+.define c0 = 20*1+(14)-19+5
+cmp #c0, L1[c0+c0+2+5]
+.data -1, (7/3/1), -(c0/6), -4
+.data c0*0+4*c0
+.define c1 = c0+c0+14+c0+c0
+L2: .fill 2, c1
+prn #(c0)+c1
+.define c2 = c1
+L3: .data 18, (3*5/2), (2*c2-5), -19*2-c2/10
+.data (11-c2/9), c1/13, (-12/5), -18-7*(c2)
+L4: cmp #(-(c1)), L3[(c2)]
+.define c3 = 5
+prn #6
+mov L3[-(4)], r2
+.data (5-(c2)), -2/1
+mov #c1/5, r0
+mov #c0, r7
+.define c4 = c0
+.define c5 = c0
+L5: mov L2[(1)-11-1], r2
+L6: prn #(8+16/5)
+hlt
@@ -0,0 +1,86 @@
+.data -16/1-(7-14)
+mov #15/1, r6
+prn #5/19+7*19+3+1*(10)
+prn #-(10)
+.define c0 = -14/1
+mov #11/1+-20, r1
+mov #(c0-14*c0), r3
+L0: .data c0, --(19), -c0-11--c0-9
+.data 14*6+9+13+13+c0, c0-15-c0+-c0+c0, -c0-c0/4, c0/5
+prn #9
+.define c1 = c0
+prn #c1/4-0+c0*c1
+.fill 1, 9--2+17-c0
+mov L0[12], r2
+mov #(c0)+--19, r6
+mov #18-c0, r3
+.define c2 = 17*c0
+.define c3 = -17*(c1)-1/16
+prn #-10/5*c1/2
+prn #-15/2
+.data ((c0))*18+c0+9-c0, 13/3-c3, 6, 11-c2-c1/2
+L1: mov #c2*c1*c3-c0+c0, r3
+.define c4 = (8)*c1/4-c3/17*3
+.data 17/1*(c0)-0, c1+c4/10+15--c1
+.data -13/17/5
+mov L0[14/3], r2
+.data -4+c2+c1-16*2-20, 3, (c4)
+.data c3, -12/5+(c3)*11+15, c1
+.data c4
+.define c5 = 19/5
+mov L0[c4-8*7*(3)+15/4], r2
+.data 1, (16)*c0/11-(c5)*-15, 10
+mov L0[3], r2
+mov #((13)-c5/2), r3
+.data 6*c1
+mov #8, r5
+.define c6 = (c2) + 17/4
+.define c7 = 0*c0/5
+.define c8 = ((c1))
+.data 17, 18
+L2: mov #(8*(c4)), r2
+.data 14
+cmp #((c5-c3)), L0[c0]
+L3: mov L0[20+-17-6+c1/19], r2
+L4: mov L3[c0], r2
+L5: .data c2+0+c8+c8-(9)+5*c1, 13, c4, c1/4/5-19/13
+L6: mov L0[0], r2
+.fill 4, c3/5*(c8)
+.data -c6, 9
+L7: .fill 2, -c6
+mov #6, r3
+L8: mov #1*4+c0/3, r2
+L9: .data c1/4, c5+-17, 12, c1*13/3/2
+L10: .data 11*c7-c8*c7
+L11: mov #-19-c8-13*c7-2/18, r0
+mov #0+-c4/2, r5
+.fill 4, -c7/3
+.define c9 = --18-5
+.define c10 = 0 + 9/4
+.define c11 = c1
+L12: mov L9[c5/3*c10-c0*c10-c9], r2
+.define c12 = 18
+mov #-c2+c7-20, r6
+L13: .data c8-4-c7/6*c11-4*2/5, -c2+c9/3-9*c11/20, (c10)/3, c9
+mov #3/2, r1
+mov #3, r6
+.define c13 = 10
+.data 14, c13, c8-5/2
+prn #16-c13
+mov #(c12*c1)+c11*9/1, r2
+mov #c1/17, r7
+L14: mov #c2/4*18-c5+4/1, r1
+mov L4[5-(20)*c4+c10], r2
+L15: cmp #3, L12[c11]
+mov L1[4+16/4/2], r2
+mov #6, r0
+L16: prn #c9*9+(c6)+c12/1
+prn #c0
+mov L7[((c4))+12*(12)], r2
+cmp #(17), L14[13/4]
+L17: .data c9, -13, (2+c12+c4-c1)
+.data c5
+mov #c1, r7
+mov #12*14/17-20*8, r5
+cmp #5+11/2+c4, L1[c1]
+hlt
@@ -0,0 +1,27 @@
+.data 1, -13*7-17, 13+0+4/10
+L0: mov #20*-10-20, r6
+mov #-14/5, r6
+mov #2, r5
+.define c0 = 17
+L1: mov L1[-c0/16-c0+c0-12], r2
+mov L1[c0], r2
+.define c1 = (5)
+.fill 2, -c0
+mov L1[9], r2
+mov L0[c1*7--7*-c1-c1/14], r2
+.define c2 = c1*c0 + 18-15 + 17 + 2
+mov #-(c0/3), r6
+L2: prn #(-c1-19/3)
+.data c1, 7-c2*-c1*16, (c0)*11+(c2*0)
+.define c3 = 16
+.data 3, ((c1)*20+c3), 10-9-13-1+c3, c2
+mov L1[13], r2
+L3: .data c3+c3/5/5
+.define c4 = 10
+.define c5 = c3/1
+mov L1[19*c1+c0*c1], r2
+cmp #19*c2*11*-c0, L2[(17)]
+.define c6 = c2
+mov #c0--19--c5, r5
+.define c7 = c4
+hlt
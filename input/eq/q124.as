@@ -0,0 +1,56 @@
+L0: mov #5/11, r6
+prn #15
+L1: mov #12, r5
+.data 7/17+-3/14, (0)+18/19/2, ((0))
+mov L1[(15)], r2
+mov L1[-2-20+16*3], r2
+.define c0 = ((0))+13+5
+mov L0[c0], r2
+L2: .data -c0+(19)-10-4+(16), 2*c0/1/5, -(3/20), -10-c0+4-c0--8
+.define c1 = (-c0-14*c0)
+L3: cmp #13*c0+15, L0[-4+c1+8+5]
+.data 4
+mov #c1-c0-3*c1, r4
+.data c1, c0+c1-c1--c1, -c1+(c1+14)
+L4: .data 17
+.define c2 = c1/4
+.define c3 = 19*c0 + c1 + c2-(c1)
+.data 5*c3-3-c1+5-c3*17, 19-9, (c2+16*15*17), 12
+cmp #-(c0), L0[c0]
+mov L4[(17/1)+c3-c2*c2-c2], r2
+L5: .data c0/4, 13+(c2*10), 11
+.fill 3, (8)
+L6: mov #c3*c1-c1-6/5/3, r3
+.define c4 = --16/1
+.define c5 = (10)
+mov L2[6], r2
+L7: mov #c3*c0*c0*c0, r7
+.data -(-1), (c4)*c2
+prn #20*0/5/4
+.define c6 = (15*9)*c3 + 8 + 10
+prn #11
+.define c7 = (16+c6)+(-c2)
+L8: .data c1-c4/6/4, 3/10*10+8*c5, (c2)
+prn #-(c6+18)
+.fill 2, ((c0))-c4/19/1
+L9: mov L3[c6--8+18], r2
+.define c8 = -6 + 17-c5-c6 + 6 + c1
+mov L6[c8], r2
+prn #c0
+.define c9 = 0*c7
+.define c10 = c0
+cmp #(6)-14*c2*-c0, L4[c10/1]
+L10: mov L4[c6*2-13/1], r2
+cmp #c4, L5[-c9-3*10/3]
+.data (c8/7)*7
+mov L7[(4)/3], r2
+.define c11 = 16*c2-c1/3
+.define c12 = (10*6-c9)
+mov #-c12+0/9-c8/5, r2
+mov #13-7+0, r3
+prn #18*-18-c0/2
+L11: prn #-11
+.define c13 = c0*c12 + 5
+cmp #-c2, L2[-c11/5-(-17)]
+.define c14 = (c0 + c5 + 11)
+hlt
@@ -0,0 +1,52 @@
+.data 13+19/2--16+20, 18, 10*17/3-6/16+18
+mov #14+13-(9*14), r2
+mov #9, r1
+mov #19*17-11+18/7, r7
+prn #(12+11)-15-1-(8)
+prn #18
+mov #-(0+17), r2
+mov #(17), r0
+.define c0 = 14-6/17/5
+.define c1 = c0
+.data 18/3
+prn #15*10
+mov #-(0)+c1+18-c1-c0, r0
+L0: mov L0[-c0-0-3*10], r2
+L1: .data c0-3*c0*2-7*-c1, c1
+.define c2 = 2-(c0*2)
+.define c3 = c1-1 + 20/4
+mov L1[c0-c2/5*c0*c3-6], r2
+.data (19+c1--5), c3*c0-5
+.define c4 = 19 + c3 + c2*c0 + 13/9-(c0)
+mov L1[c3-c2+11*6-c3], r2
+.define c5 = (c1/17)
+mov #15/3, r6
+.define c6 = (c5 + 18--c0)
+L2: mov L1[c2+6*-13/12], r2
+L3: mov L0[2], r2
+.fill 2, c5
+.data c1, -c1, c5
+cmp #19, L3[5-15+8*c4*1]
+.define c7 = 18
+.data c0
+mov #6, r4
+L4: .fill 1, (2)*c0*c1+6/5
+L5: mov #c1, r2
+L6: mov #c2, r4
+L7: .fill 3, c6
+.data c0, 18/5+15, (15+c4-15*3)
+mov #c5/1*7+c5+(0-c5), r3
+.define c8 = c7
+L8: mov L8[(9*c3)+(1+2)], r2
+mov L4[-10*0], r2
+mov #c5, r3
+mov L0[-(c2-c5)], r2
+.define c9 = c1
+mov #c0, r4
+mov #c1*c7/3*3/5, r4
+L9: .data (c2*c8)-c2, c3-8
+prn #c4
+mov #2/5, r3
+L10: mov #c1+-c7*c3/17, r5
+mov L1[c5], r2
+hlt
@@ -0,0 +1,94 @@
+.define c0 = 5
+L0: mov #2, r4
+mov #(c0+c0)/4, r0
+.data (c0)+-c0-c0+10-(11)
+L1: mov #-c0, r7
+L2: cmp #c0*19-17/10*(18-13), L2[-(c0)/3]
+L3: .data c0
+mov L3[-7-(c0)], r2
+.data c0, -c0-9+c0-7
+L4: mov #c0, r6
+L5: mov L5[(c0)*(c0)+c0-7], r2
+.data -c0+6*c0-((16)), c0*c0*c0/5*-c0-1
+mov #(c0)/2/3, r7
+.define c1 = -(2/3)
+.data 13, -7/2-14, 17, -c1+c1/2
+mov L0[1], r2
+mov L0[c0], r2
+.define c2 = 7/4
+.data ((3+c2)), (3), 5+17/1+c0
+mov L3[13], r2
+.data 14
+.data --1+c0*c0, -(12)*20/3+16, c0*c1+5/4, 18+1+12-c1*c0*c2/2
+L6: mov #-c1-c2-20, r2
+L7: prn #c1+-c0/1
+.fill 3, c1*c1/3
+prn #(c0)
+.data 4*17
+L8: mov #-c2+c1+1+9, r7
+.define c3 = c1
+mov #c2*8+c1/5, r3
+.data -c2/1, 9
+mov L7[1], r2
+prn #c0*19/1-c1-c0+(18)
+.data (c2-14)+(c2)+(20), (c0), c0+1*16-c0+-9
+mov L5[-7], r2
+.data (10), c2/5, ((-c2))
+mov #(c3-20)--c0+c2, r0
+L9: mov L1[c0], r2
+.data c2-13/1/1, c0
+.data 3/4, c0, (10/1)
+mov #-c0/4-c3-2, r1
+mov #((c1))+c2, r4
+.data (c0)-10, c3, -c3+9*-12
+L10: mov #20, r7
+mov L6[c1], r2
+.define c4 = (c3)
+mov #(19/5)*c1-c3-16, r1
+L11: prn #c3
+prn #c1
+mov #c3/11+-18-15, r2
+L12: prn #20
+.define c5 = c4/19-17-c1+-12*(13)
+mov #13-15/2*11/2, r6
+L13: mov L7[c2/4--c1-(3)-(18)], r2
+cmp #c4-17*c3*0+(18), L2[c5*c0*c2+9/5]
+.define c6 = 12-14-c2-(20)
+L14: mov #1+6+(c2)+(19), r4
+cmp #-c3*18, L7[(18)]
+mov #c3, r4
+.fill 2, c4*2/13
+prn #(c0+c2/2)
+mov #15*11+c2/3-c0/3, r4
+L15: .data -17*8/2, c6*c5, -18-9*c0
+.fill 4, 2
+.define c7 = 18
+.data c0, 19-c5-c6-c5, -c1/2/5
+L16: mov #9, r5
+.data -(c7)*c5, 4-16*(1)+c2/6, 6, (14-6-(c3))
+.define c8 = 11*c4/1-c4
+.fill 2, (c1)
+.data ((6))+-1-c2, 14*c3-12/9, c4-4/2/1, c8-c6-9-c5*c7
+L17: mov #4/5*14*4+c8/2, r0
+mov L10[16], r2
+cmp #(-c0*c0), L7[12+5+c5+c3+15*18/5]
+.data c8, 0-1+c6
+.define c9 = (19)
+.define c10 = c1/5+12-20*c1
+.data -(c10), -11-(c5)*-2, c8-20
+.fill 1, c6/3-14*c9+5+c8
+L18: mov #-(12), r5
+.data c7
+mov #13/4/5/1, r4
+.define c11 = c4/2/3
+prn #c4
+.define c12 = 1/5*-c10/2
+.define c13 = -c1*(c7)-19
+mov #9, r1
+L19: .fill 2, c4*c7/5*c1
+.data 15, -c0/1-c4
+.data c8, c13*16*c3*20
+mov L10[c5], r2
+.define c14 = c8+9/2-17+c0+c12
+prn #c11
+hlt
@@ -0,0 +1,26 @@
+prn #(9)+6
+L0: .data 16*3*3+5*0/2, 6, (4-14-18+8)
+mov L0[18], r2
+L1: mov L1[17], r2
+prn #13/7
+L2: .data 19, 1--0*11/9, 10-0, -15+18+17*8
+cmp #8, L1[0/7]
+mov L0[11*20/4*4*10], r2
+mov L1[13*1*6/18], r2
+mov #14*11*17+-2, r3
+mov #(6+16*1), r2
+mov #8, r7
+L3: mov L0[-(11)], r2
+L4: mov #(-9*14), r0
+.define c0 = 5 + -11*18
+mov #c0-4+18*(c0)/3, r1
+.fill 1, -7+c0+13
+.define c1 = (c0)
+mov L0[c1+c1], r2
+mov #(-c0*(0)), r4
+.define c2 = 17/2/2
+mov #3*c0-10/17, r5
+.define c3 = c1
+mov #2, r5
+.define c4 = 18
+hlt
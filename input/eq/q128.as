@@ -0,0 +1,51 @@
+.fill 4, 4
+.data 3, 11, 20
+L0: .fill 4, 16+14*4*18*(13)
+.data -0/7/4, (16-19*9), 3, 3/5+20-0*-0
+cmp #-0*17+13/3, L0[11]
+mov #(-(18)), r5
+L1: mov #-11, r2
+.define c0 = 17
+.define c1 = (c0+c0+(c0))
+mov #(-c1), r4
+L2: mov #(-(c0)), r1
+L3: mov L2[13+15+10+c1*c1], r2
+prn #(1*17*c0)
+mov L1[-c0-c0-(5)], r2
+mov L1[(c0)*7*2*c0/4-c1-15], r2
+mov #c0/3*9*c0*2/1/1, r5
+mov #((c1))/5, r6
+mov #12, r4
+.define c2 = 2-2*4/4
+prn #19
+L4: mov #(c0*c2-5), r6
+.define c3 = 14*9/1
+mov L0[c1], r2
+L5: .data c1-2/5-(-c0), (-c1/16), 20*14+c0-(c2)
+prn #(9)
+L6: mov L6[c0*(c3)-15], r2
+.define c4 = -6/3
+.data c1, -c1, -7/19+c1+c0
+.data --5-c0, c2, -c1/5, c1/19*14*-c4
+.define c5 = 0/10
+L7: .data c1, (c0/3)+4, c5
+L8: mov #(c5-c0)*c1, r5
+.data -c3*13, (4/3+-c4), 3/16*5/3-(4), 2
+prn #c5-18/2*14-15
+mov #5, r3
+mov L0[--c3], r2
+mov #7, r3
+mov #7, r5
+cmp #c5, L7[c4*0*c2-14]
+.data c5, c4/2
+L9: mov #c3/3, r7
+cmp #c2, L1[1/2]
+.data c2, 8*c3/2*c5, c2*c1, 7
+.define c6 = 15/1-19
+cmp #11/4*c4/18, L8[0]
+L10: .data (c6-12)/5, c5, (-18+15)
+prn #(c5)/5
+L11: cmp #18, L5[c5]
+mov #20, r4
+.define c7 = 5-(c1) + 12 + c0
+hlt
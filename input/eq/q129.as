@@ -0,0 +1,96 @@
+prn #12
+mov #18+13*8+4-19-8, r2
+L0: prn #-10*19*5-5*3*19
+L1: mov L0[-7-4], r2
+L2: mov #-12-9+16*0, r6
+L3: .data (15/3/1), 14
+cmp #20, L0[16-17--16--7/5]
+L4: .fill 3, -9/1+-(12)
+cmp #6*13+5*12+--9, L3[--10]
+L5: .data 20+2*13/3, 8-0/6+18-15-16/17
+.define c0 = 6/4
+cmp #c0+(3), L2[c0*4+-14*c0]
+L6: mov L6[-12*1-c0--c0/3], r2
+.data (16+c0-c0)
+mov L4[18/4-14+2*c0], r2
+.define c1 = -9/3-10*5
+.data 15, -c0-c0*c1/14, -9+14--c1+c0-14, 13-4/2*(c0)
+.data (-0/6), 3, 8
+prn #c0
+.fill 1, (c0)+19*c0+c0
+mov #c1/1, r3
+.define c2 = c1
+prn #(c1)
+cmp #13, L1[c2*-19-18]
+L7: .data c2/10*-15/2, 5/5
+mov #(c0)*0/1/3, r2
+.define c3 = 16
+.data 0
+mov #16, r6
+.define c4 = c2
+L8: mov #-4-20, r0
+.define c5 = (18*11--6)
+mov L3[((17)/3)], r2
+.data --6/2, -c2-c3+c2, c5
+L9: mov #18, r4
+cmp #15, L4[(18-12)--c0]
+mov L6[13], r2
+L10: mov #(((c4))), r5
+L11: mov L3[-c2*11/2], r2
+mov L0[12-c0+14*c4+18], r2
+cmp #((11)+c3/7), L5[(5/1)]
+L12: .data -c5+15-10
+L13: mov #-12+13*c2*16/4, r3
+L14: mov #17, r3
+mov #--11*(16)*(11), r0
+mov #-3--c2+-c0/4, r7
+prn #(c2-8)-12
+.data c1
+L15: mov L7[((6))], r2
+.define c6 = c3-c2+20+c2
+mov L13[0-c5/2+c2], r2
+L16: mov L0[5], r2
+mov L13[1], r2
+L17: mov #c1/5, r0
+L18: mov L8[18], r2
+mov L13[0/5], r2
+.define c7 = (14*2-c3)
+.data 15
+cmp #5, L13[(c2)]
+L19: cmp #c7+-c2/1, L1[c7*-c0-c2/3]
+.define c8 = -c0 + 15 + c1*2
+mov L16[15/2+0], r2
+L20: .data c2, 19+c1, c6*6+c4--18*7, ((c1))
+prn #9*16+(3)+9
+mov #(c5-c1)+c7, r2
+.define c9 = c5
+mov #(-15*18+c0), r3
+mov #(-c4/4), r6
+mov #-c1/2*c4*c4*16, r6
+mov L12[c4], r2
+.fill 4, c4
+.define c10 = c3
+mov L13[(-9)], r2
+cmp #c1, L4[(14)+c10+c4/4]
+mov #c6, r6
+.define c11 = -(c4)
+mov L4[c1], r2
+prn #9-2+c11-6/2/1
+.define c12 = -c4-c4+c4
+prn #c6
+L21: mov L17[14/7/2+13], r2
+.define c13 = -c12*7
+L22: .data (7+c1)---3, -11*c9-c9*c4, 3
+mov #-0, r1
+L23: .data c13/4+c12, c0/5
+L24: mov L8[3], r2
+.define c14 = 14
+mov L0[(-4+(5))], r2
+mov #18, r3
+prn #c1+14-c6*c6
+L25: .data 16, 7, (6/2)*-c3+1
+prn #4
+mov #14, r0
+mov #(c13-4-c13), r2
+mov #c5, r6
+hlt
@@ -0,0 +1,54 @@
+.data 17*7*13+8-19*4-17, 11/2
+.data -15, 15-1/13*13, 15/5
+.data -17*6
+.define c0 = 20
+prn #c0*15+c0*-2+c0
+.data c0*(13-11), -(c0)
+mov #(c0+c0/2), r5
+.define c1 = (7+17/4)
+L0: mov #c0+-14-c0, r0
+.define c2 = c1*c0*8
+prn #((c1)*c0+c1)
+L1: .data 18+9+4*(15/5), c2/1+c0+9+20
+mov #c0*c0-9+14/3, r0
+L2: mov #c0/1+6+c1*-c2, r5
+prn #c2/16+c0/2
+.define c3 = (c2)-9
+L3: .fill 2, 5
+.define c4 = 4*c1 + 2-(c2)-17 + c0
+.define c5 = c2
+.define c6 = (14+c4)/2
+cmp #(14+c3)-1, L1[(12/4+-6)]
+.fill 2, (14)+0+20/18
+mov #c6, r7
+L4: mov #0, r2
+L5: mov #-c3-c0-(2)/2, r5
+.define c7 = 18*19-14-c5*3-7 + c6
+.data (3)*c5
+L6: prn #c7/12+-c6-c1/19/1
+prn #-c6/1
+.data c2, c5, c5*c3+c3/4, 20
+L7: .data 13, ((-c2)), 12
+L8: mov #11, r0
+mov #8/11*(c3)/4, r2
+.define c8 = c6*16+c2+c2-5*c6*c6
+.define c9 = 9
+prn #-8-16/2
+.data c6
+mov L4[-(0)--c7], r2
+mov L4[c8], r2
+.define c10 = (9+5)-c2
+.define c11 = (c8/1)/1
+L9: .data c0/3, 19, (11*c10*c10)
+.data 7--c3-c6
+prn #4
+.define c12 = 6/13--c9+1/2
+mov #c5-10*10*14+(1-c8), r7
+L10: cmp #(3+c7/2), L0[c8--8+c5]
+mov #c9, r2
+.data c9, c0, c0, 4+c2+-17
+L11: .data 20/5+c5+c10/4
+.data c7+(7)+-c9, (16), 2+17+-c3*(-7), c8*-c5*c11
+prn #c8
+L12: .data 1-1+(c7), 9--c12/5
+hlt
@@ -0,0 +1,87 @@
+.fill 4, 12/12-20+11+-3-16
+.define c0 = 13/13*17-3-13/13-2*4
+L0: cmp #c0, L0[(c0+c0)-10*c0]
+mov #c0*1*c0+13-c0+c0, r1
+.fill 4, 9-(c0)-1*18-14
+.data (10), 5, -((c0)), c0
+.define c1 = c0/5-(c0*c0)
+prn #c0
+mov #(1)+(15)/10, r7
+.fill 1, --2-14/11
+L1: mov L0[6], r2
+.define c2 = c0
+mov #10*-c0, r0
+.data (16-7+1), c2/20/3
+mov #16*c2*c1+c0, r5
+.data c0/4-c1+(c2), -c0+9-c2-c2, c0
+.define c3 = 5
+mov #c1+4-3/1, r5
+mov #((c3/4)), r0
+L2: .data c0, (c1)+c0-19/3*-c2
+L3: .data c2, c3/5, -17+12-c0
+.data 20*c2*17+c1/3, 17+c1/17
+mov L3[c1], r2
+mov L1[-14], r2
+cmp #-c1/3-c0/5, L3[c1]
+.data (c3*1/20), 11, c2, c0/5
+.data -c2+1/4, c0-c3*c1-c1
+mov #c0-c0, r1
+prn #16
+mov #-c3-8*(12)/5, r2
+prn #2
+L4: mov #(9*(20)), r2
+.define c4 = c3-0*(c0)+17/4
+mov #6, r4
+mov L0[(-c2)+--12], r2
+.define c5 = c1/4/5
+.data 9-8--c2-c0+9+-c3, -c3/1-0*c5+c4*c1, 16, 2
+mov L3[-(c3)+c2], r2
+.data 7*c2-15-c4-4, c0-(c0)/1
+L5: mov L2[10/13+c3+c4], r2
+mov #c0*0*c4/8, r5
+.define c6 = 2
+mov #6/3/1-(11*5), r1
+mov #2-11, r7
+L6: .data 0, c3, --4-2-14, c4+c1/4/2
+.data 5-c3+19+0-(c3)/5
+.define c7 = 10
+prn #(20)-19+c5*0
+prn #18/1
+.define c8 = (10*19*4)
+L7: mov #c0, r2
+.define c9 = ((2)+(17))
+.define c10 = c1
+.define c11 = 18
+.data (c4), -c4
+L8: mov #c7+-(0), r5
+cmp #c8/3, L0[4]
+.define c12 = 1
+L9: .fill 3, (3)*(13)--c6
+mov L0[(-7)-(18)--c2], r2
+.define c13 = (3*7)/3
+.define c14 = c7
+.data -4, -18, c2*c5, c11
+.data (c6)
+.define c15 = -3
+L10: .data 1, 3/3, c10/1/2*20+c4*15, (19-8)
+L11: prn #c9
+.data -2-14/11+9
+L12: mov L8[-c15+c7], r2
+L13: .data c14, 15*-c0/2
+L14: .fill 1, 9
+L15: mov #-c3*4-7, r7
+cmp #c3, L6[18-c0*c6/5*17]
+.data -c0*c6-c4*c1, 18+-20/14, 7
+mov #-c13-c7+(c14), r2
+.define c16 = 10
+mov #10, r6
+L16: mov #--c8+c2*8, r0
+mov L6[18*c8/4], r2
+mov L0[-c2-c6/2], r2
+L17: .fill 4, c3
+.fill 1, c3*8+16/9+-(c4)
+L18: mov #-14-14/3, r6
+L19: mov #(9+-c8), r4
+L20: prn #(8)+18+c11+(7)
+L21: mov #(c5-c16+-14), r0
+hlt
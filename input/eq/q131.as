@@ -0,0 +1,61 @@
+.data 12, 15-2/4+-17+7, 20, 4
+L0: mov L0[17], r2
+prn #5
+mov #(2/16)+(2)-(0), r2
+prn #-(11)
+L1: mov #1-6+11+-4-4, r6
+mov #11, r1
+mov L1[1+6/3-4*2*5/1], r2
+.data 8, 19
+L2: .data -13-12+7, -9+3
+.define c0 = (4-0-18 + 2)
+mov L2[2], r2
+mov #c0-8+15*c0/4, r3
+prn #c0/1
+L3: mov #((c0)*0+c0), r1
+.data 11-(c0)/3, 9, c0
+.data 2+c0+c0+(10)/3, -c0, c0+0
+cmp #c0/15+(20)*c0*(c0), L1[0]
+.define c1 = (14/20-c0/4)
+L4: mov L0[-3*c1*(4*c0)], r2
+mov #(c1-15)+4-13/4, r2
+.define c2 = 20
+L5: mov #c1, r5
+.define c3 = -c2 + 4 + 20
+.define c4 = 14
+mov #c2/4, r5
+mov #c3, r4
+.data 0, 5, 17*c1/12/1
+mov #c3-0, r6
+mov #c0+12+c1+-(c1), r1
+mov #-c1, r3
+.fill 4, c3*c0-4/1
+L6: prn #7*4+c3*9-c1+14*9/3
+L7: mov L2[(c1)-11*13--1*17], r2
+L8: mov #c3, r5
+prn #0
+mov L2[c1], r2
+mov #-(c3+c4), r4
+L9: mov #c1*(c3-8), r3
+L10: .data 1*c4, -c0*19/13
+prn #0+c1/5-(1+6)
+mov L0[-c3+-2*c0], r2
+prn #15*18+0+16/13
+L11: .data 8+c2*c1/2, c3, (c1)-(c4)--1-c4
+prn #(6*4)+(0+18)
+.data c1*2, ---16, (c3)-c4+c1, c4+1/5+c2
+L12: mov #c3-c4/2/1, r0
+.data 2*c4, 4, c1+20, (c2)
+.data (19)+c1/5*-5/2, 12*5, (-c3-c0)
+mov #c3, r3
+mov #(c2*c0/2), r6
+mov L11[9*9+16+c2-c2+c4-5], r2
+mov L1[(17/1)], r2
+mov L4[(5+c4+15-0)], r2
+mov #--c3/2, r7
+.define c5 = c2-c1-3/4
+mov #c5, r4
+L13: .fill 1, -c0*c0*c5*c4
+.define c6 = c5
+prn #((12))-19-18
+hlt
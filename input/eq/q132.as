@@ -0,0 +1,73 @@
+.define c0 = 1
+prn #17*10-19/15+c0
+.define c1 = -1-c0+c0-8
+L0: .data (c0)+8+17/4, (14)/15-12, c0
+prn #6
+mov #14*c0*11+-15+c0, r4
+L1: mov #(-20+19), r3
+mov #10+(c1)+1, r6
+L2: mov L0[16], r2
+prn #-c1+c1+c1-12/17
+mov #9-17, r1
+L3: prn #8-1
+prn #(c0*c1)+c1
+mov #((3))*(c0), r5
+.define c2 = (-c1-c0)
+.data c1+c1-16, c1/4
+mov #6, r4
+.fill 2, c2+-5
+prn #-(c1)*17-c2
+mov #c1*-17, r6
+mov #c2, r7
+.data 5-6+c2+12
+.data 16/11/5+-16-c0+5, 16/3
+.data c0/1-20*15-6-0, c0*c2*c0*(-6)
+.define c3 = 16*11-c2/5*0
+L4: .data 0, 7, c0
+mov #5, r2
+.data 4-c1/1/1
+.define c4 = 3/7+c1/1-c3*c3*11/3
+.data 5/5-(c0)/5, 11-(c0)/3, 5, 19/4*-c4
+mov L3[(c0*10+4/8)], r2
+cmp #c4, L4[-c0]
+L5: .data c1, c2+9*c0/4
+mov #-12, r0
+prn #10
+.fill 4, -10+14/2
+.data c1*c2, c0, c2
+mov #10*-c3, r1
+prn #c1
+.define c5 = c2
+mov L1[5], r2
+.define c6 = -18/1--16*c5/1
+.define c7 = -5+6*1-13
+mov #-c4/4-c2, r5
+.define c8 = c0-c6/3-14
+mov #9/7, r5
+cmp #c7+c5, L2[(20-20*c4)]
+.define c9 = -c4+7/2
+mov L2[0], r2
+L6: prn #(c3)/1*6
+mov L1[16/1], r2
+mov L5[-(20-16)], r2
+.fill 2, 13*c8-c4
+cmp #-c9+c2+c9+2+17+10, L5[c4]
+mov #c9*c6*c2*c5-16, r2
+L7: .data --c8*20, 1+1/3, (12)*6, c6/11+c6/14*c2
+mov #c3/1-c5/4, r4
+mov #14*c2+17-(c5)/1, r1
+L8: .fill 1, c4--5
+mov #c5, r0
+.data (-c2/1), (7*c7)--c8+c8*c3, c0, c0
+.define c10 = 7
+prn #(c3)*9+8-1+c6+-10
+L9: mov L8[6*4*11-17], r2
+mov L7[(5+c6)+-c8/13], r2
+L10: mov #c3-4+c1/3, r6
+.data 8
+.define c11 = c7
+.define c12 = --2*18+10
+.data --c7, 9, 9+c12/4*c8, (c6-16-2)
+mov L2[4], r2
+cmp #-9*18-c6+c0+c10*-19, L0[8]
+hlt
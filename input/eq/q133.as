@@ -0,0 +1,84 @@
+.data 4/3+(4)*16*6, 2*10, -12/19+12+18/4
+mov #17/20*-16+5-10-3-5, r1
+.define c0 = 2
+.define c1 = c0-c0 + 14/10/1
+.define c2 = c1
+.fill 1, (--16)
+prn #-c0*13-4+c1
+.data c0, c1*8*17*-13, c0/7/2/4
+mov #c1, r2
+.data 12, c2
+L0: .fill 2, 0+c0*c2*c1-17
+L1: mov #1, r3
+L2: mov #c2-(c2)/4, r6
+mov #c2-20+14+c0-11+1-6, r7
+.define c3 = (c2)
+mov #6, r7
+L3: mov #c0, r7
+.define c4 = (c3)
+mov #c0, r1
+.data c4
+prn #17
+mov #c0/2-1*18+c2/19, r2
+prn #-c1*1/1
+.define c5 = c2
+L4: mov #c1*-2/5, r2
+L5: mov #-c1+6*(9/1), r1
+L6: mov L2[c2], r2
+L7: mov L5[8/5], r2
+.data 1, c1, c4, (c5)
+L8: .data c3, c5*c0+2-c4+c3, c4/4+15, c5
+.define c6 = c1
+.data (c1+c2-c6*14)
+.define c7 = 8-15
+L9: .data ((6*10))
+.define c8 = -7/3-2 + 0
+prn #c2
+L10: mov #c2, r7
+.define c9 = -1*19
+L11: .data c3*19/1-c0-20/3
+.define c10 = (-1-c6/1)
+.define c11 = c7 + c6 + -c4-c4
+.data c1
+L12: mov #(c2)+13, r6
+.data c8
+L13: .data (c10)+14+11/1, 15, 12
+.fill 3, 12/17*c4*18+18+19
+prn #12/2
+mov #19/10--c7--c5/4, r2
+mov #-c10/15*c2, r6
+L14: .data c3-20, -(c0)+-13+c10
+L15: .data 8+2, c11-c2/5/4
+.define c12 = c6
+L16: .data 2, --c7/14, c4/11, 5
+.define c13 = 0
+prn #c4
+.fill 4, ((c0+17))
+.define c14 = 0-14/3*c13
+.define c15 = 18/4-c8+1-20*6
+mov L6[15+14/4-15*1-5], r2
+.define c16 = c12-7*(17 + 19)
+mov #-9+c3+c15+15, r5
+L17: mov L9[c12*20], r2
+prn #(6+8)
+.define c17 = 3
+mov #7, r6
+cmp #3, L11[12*18+19]
+.define c18 = (c14/2)/5
+.define c19 = 20*c5-c9-4-17--c18
+.data 14-c11/5+c12, -(c8)*c7
+.data ((c12)-(6))
+.fill 1, c3
+L18: prn #-c15*4/5
+mov L11[(-3)], r2
+prn #--c17+-3
+mov #(c14), r0
+mov #-15-(c9)+15/15-4, r5
+mov L1[c5/1], r2
+prn #18
+L19: mov L3[c8], r2
+L20: mov #(c9), r2
+L21: .data 5*c3-14/14+16+19
+.data c4/4, c12, 6+1*3/4
+mov L2[0*c12], r2
+hlt
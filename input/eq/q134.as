@@ -0,0 +1,82 @@
+mov #12-15, r3
+L0: mov #-19/5/3, r4
+mov L0[7], r2
+L1: .data 8-11
+.data 2-2+16+-11, 7, 19
+prn #(1+11)+-5*-7
+L2: .data (8), (14+10+8/2)
+.data 5-16/5*14, 3/5-6-1/8, -15+12*19/2-1/3
+.data (17*9+7+14), 15, 4
+cmp #11/2/3+2, L0[20]
+prn #12/2
+.define c0 = (20+10)
+.data --1/2, c0
+.define c1 = 2+c0/5*15
+mov L2[7-15/1], r2
+cmp #6, L0[20]
+.define c2 = 19/10+-1+c1
+prn #11
+L3: mov #c1*3/4/5, r7
+L4: mov #18, r3
+L5: mov #-15/9/2, r6
+.data c1, (3/8+1), 9
+prn #-(2)
+.define c3 = (5+15+c0+c0)
+L6: mov #c1--c3*20+20, r4
+mov L2[c0+c3/1*(c3)], r2
+cmp #(18-14*13-4), L6[9]
+prn #c0/1
+.define c4 = c1
+L7: mov L1[14], r2
+.define c5 = 11*8
+mov #c4, r5
+.define c6 = c4
+.define c7 = c4/1-c6-12/1
+mov #14/1*10, r2
+L8: .data -13, -c0
+.define c8 = 8
+.define c9 = 10
+.define c10 = --c9
+L9: mov L5[c4/14/5], r2
+mov #-c4, r3
+L10: mov #15, r0
+.define c11 = 9
+mov #c3, r1
+L11: prn #7
+mov L0[c11/8], r2
+.data c3, 10+c4/3/3, --c0/1, (((20)))
+.data c2
+.data (5+5+6), c10-c9-9--17/12
+cmp #c4, L4[c2*c11-(c0)]
+prn #15*10*8/2
+mov L10[c5--7+6], r2
+mov #16, r7
+L12: .data (5+c2/4), c1*5, 4-20/5+-c6+12/15, c0
+L13: mov L4[(c6+18)], r2
+mov #13, r2
+.define c12 = 12
+.data (c12), 17, 4, -c9/12*c6
+L14: .data (c9-c3), c3, -19+20/3
+.define c13 = (c1/17*c1/1)
+.define c14 = 11
+.define c15 = 10 + 7-c11-c13-2*c14*c12
+L15: .data 1-c10-19-20, -(19)-(c8), 12/4
+.define c16 = 19/2*c8-c0-c1
+mov L1[-(c3/3)], r2
+mov L3[c14-c0+15+c14*c1-16], r2
+.data -(17), --(4), 14, -7+c5-(c13)
+L16: mov #c15*c3+6-c13*5, r3
+.fill 1, (10)
+L17: mov #c2/3/4, r4
+L18: prn #15--c11*16
+L19: mov #c7*c4, r1
+mov #c3, r1
+L20: mov L6[c8+19/1], r2
+mov #c10, r3
+.define c17 = 13*11*c0*c13
+mov #14-0+(10*18), r4
+.define c18 = (c5)
+mov L20[-c8*18-2], r2
+.define c19 = 10
+mov #3, r0
+hlt
@@ -0,0 +1,106 @@
+.data (-11+(4)), 2*2+11*16*9, 5
+prn #-15
+mov #-9, r2
+prn #2*5
+.define c0 = 1
+prn #c0
+mov #(2/18)/3, r1
+.data 13
+L0: .data (c0-4), -(9)-c0*8
+.data 5, 4*c0-c0-c0/3--2, (c0*17+c0), -(c0)*(15)
+.define c1 = 8
+mov #-(12*c0), r1
+mov #8/4*3+18+c0*6, r6
+.fill 3, c0-c1+c1/5
+mov #12, r7
+.define c2 = -c1-(1)-c0
+.data c1, 5, 17*2/1, c0-c0-c2/2
+.define c3 = c2 + 2
+prn #c3
+mov L0[c3+15], r2
+prn #-11*c1-9
+mov #--9+2-17, r6
+.define c4 = -17/4-c2
+L1: .data 2
+.fill 3, 13
+prn #c2
+mov L1[c3/2], r2
+mov L1[c2], r2
+mov #(c0+c0)*c3-11+8/6, r4
+L2: mov L0[c3/1], r2
+mov #-c3+6, r0
+mov #7*c2, r7
+.data c1, c3-12*(c4)---c0
+mov L2[(c0+19--c4)], r2
+L3: mov #c1, r5
+mov L2[-2/5+c3/2], r2
+mov #-6, r1
+mov #-(c3-4), r3
+cmp #18, L1[(7)-((13))]
+.data 4-0-1-c1
+L4: .data -16*c2
+L5: mov #6/3-(18-c2), r2
+.define c5 = -c4+c4-(5)
+L6: mov L5[c0], r2
+mov #18, r4
+.data (5), c2
+mov #18*c0*10-c5, r4
+mov #c1/1, r1
+L7: mov L5[c5], r2
+cmp #-7/1, L6[16]
+.define c6 = (11)-c5+3*17-c0
+.define c7 = 7/4
+mov #c7/4+c6-19*c2/2, r3
+.define c8 = 4
+mov L3[-14/2*(14/4)], r2
+mov #c2*20+c7*c4*14, r4
+.data 14, c1+11-c2*-10*9/20
+.define c9 = c4
+L8: mov #2+13, r4
+L9: mov L5[c8], r2
+.data (c6)/3+c8
+mov #c6-c7-10/3, r1
+mov #10, r4
+L10: .data 4+8-c7-20-8
+L11: cmp #-15, L3[0+((c2))]
+.define c10 = 16
+prn #c7
+.data 9, 14+(c5)*-c5
+cmp #(c0)-(c9)+(0)-c3+c9, L0[7]
+L12: prn #-c8+19+1*9
+mov L0[c1-(c10+5)], r2
+.data c8/10, c8/1+c6, 4-(c4)*-9
+mov #-c3, r7
+mov #c1, r6
+L13: mov L2[17/1-c8+9/3], r2
+.define c11 = -1*c3-c10
+mov #-c0*c11-14+c6, r2
+mov L3[-c11*c11*c9--c5-4], r2
+mov #18-4*c8+6, r4
+L14: mov #17, r4
+.fill 4, 17/11
+L15: mov L4[(15--c4)], r2
+mov L1[17/5], r2
+mov L8[7], r2
+L16: mov #13-10, r3
+L17: prn #-c8/3/3
+prn #c2
+mov #3/3, r2
+.data c10-13/2-c7, 20
+.data c1, 0+-12*c1+4+c0
+L18: prn #c4*(c0+11)
+.data -6*c3, (-c8)-19*17+c11
+L19: .data c6, c2*14/5/2, c10*8/2*(c6)
+.define c12 = (c10/2 + (c7))
+.data c12*c2
+.define c13 = ---3
+.data 12, (7)
+L20: mov L12[c9+c5*c5+(9)], r2
+L21: mov L14[c6], r2
+cmp #-c0*16+3/16, L21[(17/2)-c5+2+c1*c1]
+mov L7[-(c12+c6)], r2
+mov L14[13], r2
+L22: mov #1*18*20-(17)+16, r0
+.data c13-c3, -11*c12/4, 7-15*16, 7*c3*c11/5
+L23: mov #12-3*-5*c5*c7*c0+12, r2
+hlt
@@ -0,0 +1,94 @@
+L0: .fill 4, 1*0/1/3
+.define c0 = (20)*8
+.data (c0)/2+c0/2-c0
+.data 17*c0*13*12/18+c0/8
+L1: mov #-c0/5+2, r1
+mov #6/2, r7
+.define c1 = 15*c0/2
+.data c1
+mov #c0+c1/3+-c0/5, r2
+mov #-7/13-(8), r5
+prn #4-6
+mov #0*c1+4+(c0/1), r0
+L2: mov L2[(c1)], r2
+L3: .data -c1+c0-c1-(c0), 12, 0--c1*15, c1*c0/3
+cmp #18, L1[c0*c0+-c1+11]
+prn #c0+10*c1/5
+mov #c0*c1/19*(-6), r3
+mov L3[17], r2
+.fill 1, 2
+mov L2[(c1+(2))], r2
+mov L0[c0], r2
+mov L2[(1/2)], r2
+prn #20
+mov #6/2+c1/8--6, r0
+cmp #-0--c0/2, L0[c0*11+19*c1+c1]
+L4: mov #(c1+15)*c1, r2
+.data 0, -c1
+mov L1[7-10*12/2], r2
+mov #c0, r1
+.define c2 = 19*c0/5
+mov L1[c0/2+3], r2
+.data -1/15-(7), c0, c0, -(10)+16+11
+.data 17
+.data c0/5/1-c0+0-c2+c0
+mov #c2+(19-16), r2
+L5: mov L2[-18], r2
+.fill 4, 18
+L6: .fill 2, (20)*-5*2/5
+mov L1[-3], r2
+L7: .data 19/2*c0-3/14, (20-8+-c2), 16/5, 0-c0*16*c0+17
+.define c3 = (-c2*13*c0)
+.data -c2+(c2)+6*8/2, 8, c3, 9/4-(c0)-c0
+mov #((4-16)), r4
+.define c4 = -c1-c1/2
+prn #10
+mov L2[c4*c4/5*5/4+-7], r2
+.define c5 = c3
+.define c6 = 8-2 + c5*c2-(c2*c0)
+mov L5[8], r2
+.data -4*10+-(c0)
+.define c7 = c4-c4/1-c6-15
+.define c8 = --c2*c6*c3
+L8: cmp #-(c2*c8), L6[c6*14-c2/3]
+mov #16/2, r7
+.data 4, (c3*20/4)
+mov #c7, r4
+prn #c0*(c4)+3
+.fill 2, (c4)*c0+2*c0+c6
+L9: mov #-(2)/1, r1
+mov #-c2/3+1-0, r6
+L10: .fill 1, c2*7-8+c3
+.define c9 = -c5-c3*-c1-7
+.data --c9/8, -c4+c1-c1, c9--7*c5, 2
+.data 19*c7/13+0*c0/5
+L11: .fill 4, c0
+mov L5[c8+12+15*20-19], r2
+prn #c8
+.data c6/3
+.data (c0), -c7-8+17+c2
+mov #c3*c6, r6
+.define c10 = (c7-4*c2-c0)
+.data -(c1*c3), 4*9, -c9
+.define c11 = -c10
+.define c12 = 3
+.data 11+c12, (c1)/2+-c8--13, -10-20-8/2, (0*0+c11)
+mov #6, r4
+L12: .data 3
+.data c7
+.define c13 = -c3/14/1
+.data -c6, 6*c12
+.define c14 = 10-16 + 11/3*(c7)*17 + c10
+mov L0[-3/3], r2
+L13: mov #17, r7
+mov #-10, r7
+L14: .fill 3, c13
+.define c15 = (c4 + 15)-15
+mov #(6), r5
+mov L1[14+4--9*-c9-12*12], r2
+.data c3-c8+12*c14+c1, -c14, c1-c8*5*c5+16
+.data -c4+c2+15/5*(c3)
+.define c16 = 6
+.fill 1, c0-c11/2
+.fill 3, -6*18
+hlt
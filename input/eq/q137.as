@@ -0,0 +1,30 @@
+.define c0 = 15
+prn #-c0/3
+prn #c0
+prn #-14+c0*3
+.define c1 = 6*c0/2-(12*c0)
+L0: .data (4/14)/1
+mov L0[2], r2
+mov L0[-12*16/3], r2
+.data c1*-20+-c1, -c1, 12+6*c0
+.data (14*c1/2), c0, 12
+mov L0[(12)], r2
+L1: .fill 1, c0+1/1*c1
+L2: mov L0[1], r2
+.define c2 = 17-13*c0 + -16
+.data c1
+L3: .data 14-10/4*((16))
+.fill 4, -16
+prn #--c1*c1*c0
+.fill 1, 5
+.data c0
+.fill 1, 13
+L4: mov #(18), r0
+.fill 1, c0/19-15*7
+.data (c0), 11/1+-c2*9
+.define c3 = c1
+mov #c0*0*-c2-(c2/4), r2
+mov L0[(14--4)], r2
+L5: .data 11, c3, c1
+L6: .data c2, (c3)+-c3-c3, (-6/20)
+hlt
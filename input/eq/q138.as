@@ -0,0 +1,45 @@
+.data 8, 4, 7--17-15
+.define c0 = 12*16-9+8
+mov #6+c0+15, r3
+.data 4
+.define c1 = c0*10
+.data -((15)), 2+c1/5, c1, c1
+.fill 4, (7/4-13)
+mov #(c0/5), r3
+.define c2 = 4 + c1-(19)/4
+.data 15, c2
+prn #--c2+c1
+.define c3 = (20 + c0)/1
+mov #6, r3
+mov #7, r1
+mov #-12/1+--c2, r5
+mov #c0/4-(9)-19, r5
+L0: mov #((1)), r7
+.define c4 = 3
+.define c5 = 6*(c0)+c1+c4
+prn #20
+mov #1, r1
+.data c2, -c0/4*4, c3/4-c0, -9
+.define c6 = (-19/1)
+L1: mov #c1/2, r1
+.data c5-19/3*-c4-c4, 1, -(2)/2
+.data (5)-4/2--11, 4
+.define c7 = --c2/5
+mov L0[5], r2
+prn #-c5/2/5
+L2: mov #c4, r0
+L3: mov #c4-c7-c1/5, r6
+L4: .fill 1, -2
+.define c8 = 5*c2-2
+.data 20, -c6+c8+9, 11, c0-20-18*c7+14
+L5: mov #c7, r1
+mov L4[2/2], r2
+.define c9 = -7 + c0
+.define c10 = c2
+.define c11 = 1*(7)*10-c4-0-c8
+mov #3-6, r1
+L6: prn #c7
+L7: mov #(c8)*18/4/1, r1
+L8: mov #-(c7)*4, r7
+mov L5[(16/2)+11], r2
+hlt
@@ -0,0 +1,21 @@
+prn #16*15*18+4*11
+.define c0 = 17 + 14*3
+L0: mov #15/2, r5
+.define c1 = -13
+prn #17
+.data c0+-c0-5
+mov L0[12], r2
+cmp #3-c0+c1/2, L0[(c0/7+4)]
+L1: mov #c0, r6
+prn #18
+mov #c0, r7
+cmp #c0+-7*c1*c1, L0[10]
+L2: .data c1, 1+1*12+14/1, (c1/11)*c1, c1
+L3: .data 7-c1-12*c1+c1/5+c0
+.data -c0+-12, c0
+.define c2 = 14
+.data 15, 17+0-11/5*c1*10, c2+c2*10+-c1
+.define c3 = 0
+.define c4 = --(16)
+L4: .data (c1)
+hlt
@@ -0,0 +1,34 @@
+mov #2-8, r7
+.data --20*10, 20-8, 19, -6
+prn #(8)/2
+.define c0 = 8
+.define c1 = c0+(c0-c0)
+L0: prn #18
+.fill 4, c1+c1*-c1/11
+mov #c1+c0, r2
+.data 11, 5, (c0+15)---10
+.define c2 = c1-c1
+.fill 1, 4
+.define c3 = 9*5 + c0 + 20/3
+prn #14
+mov L0[7], r2
+.data -8/14-c2+10+c3
+mov #(c3), r3
+.data c0-2
+.define c4 = (8*14)*10/4/2
+L1: .data c4-11-c3*(c4*4)
+mov #-c3-7/2, r1
+L2: .data c0+17/4-17
+.define c5 = -c0*8
+.define c6 = c3
+mov #3/2/17-(17)/2, r4
+.data c0, c5
+mov #c1, r3
+L3: .data 9*6*c5/15-13
+prn #((10/17))
+.define c7 = c3
+.data 16+18, (7*20/2), (c2), -0--c0
+.define c8 = c6 + c0/3/5
+mov #c0, r0
+L4: mov #((6)-15), r2
+hlt
@@ -0,0 +1,119 @@
+L0: cmp #1, L0[6]
+prn #(1)*17/9-6
+mov L0[5], r2
+mov #-15/15/2, r5
+prn #(4)/4/5
+mov L0[17+13-13*10*11+-20], r2
+.define c0 = -(20)-18
+mov L0[14*c0], r2
+mov #c0, r7
+prn #(c0-c0-c0)
+mov #4+1/20-1, r5
+mov #-7/3, r0
+mov L0[c0+c0], r2
+.define c1 = c0
+mov #c1*c1*-9/4, r5
+mov #c1-c0-c0-16/3, r3
+L1: mov #-c0/5/3, r6
+mov #-c0/2+0, r2
+.fill 3, -1+2
+L2: mov #(c0-c1), r5
+.define c2 = -c1+0-17
+L3: .data 1+c1*c2*c0/5, 16, (13)/1/5, 16/1
+.define c3 = 15
+L4: .data -c1*-c2, c1+c1/3-2, c1/1, -c2
+mov L2[c1], r2
+.define c4 = c3
+.define c5 = c3 + 16*7 + 3-2-c3-13*20
+mov #-c3, r4
+mov #12-16-c5/3/2, r4
+.define c6 = 16
+mov L1[(11)+c5*7*19+-5], r2
+mov #((c3))*-18, r1
+.define c7 = c4
+L5: mov #-(c6)-19-c4, r0
+mov L4[8], r2
+.define c8 = 19
+L6: prn #-c1*c4-c4+13*c3
+.define c9 = 5
+.fill 4, c2-c3/7+c3*0+c3
+.define c10 = 1/2 + 17 + 8
+mov #20*13+16, r4
+.define c11 = ((c9)) + (20) + -20
+.define c12 = (c9*0)-c2
+mov L4[c8], r2
+L7: mov #8*17/1-19, r0
+mov #8, r1
+.define c13 = -c7/2*(12)*-c9
+.define c14 = 4
+L8: mov L8[-13-(c9)], r2
+mov L0[c1/3*c12/1], r2
+.define c15 = (c11)/3-c6
+mov #14+c5*1+-c7, r4
+.define c16 = c6-(c0/4)
+mov #--2/14, r2
+mov #c14*20*c1, r7
+.define c17 = -c9*4 + c8/4 + 13 + c0
+.define c18 = 11
+mov #c2, r1
+L9: mov #10-14, r1
+L10: prn #1
+.define c19 = c4/1
+L11: prn #c10+c11+-8/5
+mov #c15, r3
+mov #15, r4
+L12: mov L5[c16--(c5)], r2
+mov #c5*(c11), r7
+L13: mov #(-c13+9), r6
+.define c20 = c4
+L14: .data 7+c6*0+6, 2
+mov L4[7], r2
+L15: mov #c11+3/5*1, r1
+mov L7[(-c6*3/3)], r2
+.define c21 = ((c14)) + -c11
+prn #c3*0*c10*c19*0-(7)
+mov #c9/3+1, r6
+.define c22 = c9-c6
+.data 8/1
+.define c23 = (9/7)*13
+mov #2+6+c20-c5*c2, r3
+mov L10[--c5+13], r2
+.data (c0)*c11/5-16
+L16: mov #3, r4
+.define c24 = ((c1 + c16))
+mov L9[-(c18)], r2
+.define c25 = c24-(c13)*(3-c23)
+L17: cmp #3, L16[c15-c10]
+mov #--c22*14/4, r3
+mov #-14--c10+4, r1
+.fill 3, 7
+.define c26 = c13
+mov L17[14+c8*c13+(12+c25)], r2
+mov L11[17], r2
+L18: .data 13--c22/5, -3, (c20)
+.define c27 = 7
+mov #c7, r6
+L19: mov #20, r2
+.data c15-c2+-c3/1, c18
+cmp #c12*c23-c20/2, L16[13-8/3]
+cmp #c23, L6[c17]
+mov #(14/2+c9), r7
+L20: mov #15+c27*6, r0
+L21: .data 0-12+c1/6*19
+L22: .data (0-c2*9*c4), 10*c20, c6
+.data 14, (4-c9/3)
+L23: mov L22[c8-16-11/5], r2
+.data c13+c20, 5, c19+0/15-15
+mov #(9-c25/4), r0
+mov #--c12, r2
+mov L22[12], r2
+prn #-(0)/20
+mov L2[c23], r2
+.define c28 = c15
+.define c29 = 13 + c26 + -12/1
+mov #(c28+c4*-c0), r5
+mov L11[0*1/4], r2
+.define c30 = 12
+.data 12
+.data 8
+hlt
@@ -0,0 +1,87 @@
+prn #(8+10/8)
+mov #((15)-8*19), r4
+.fill 2, (-2)+18/12/5
+L0: mov L0[8], r2
+mov #8, r5
+L1: .data 2
+mov #5--11--6*20, r4
+L2: mov L2[9], r2
+L3: mov #(12*0)-6, r4
+L4: prn #-17*13+8
+L5: mov L0[2], r2
+L6: .data (16+5)*20*12+-20, (5), 8*13-2, 12-13
+mov L3[4+(3)], r2
+mov #0, r6
+L7: mov #((14/18)), r1
+.data 16/7/3/2, 7-17-1*17*--0, -5
+prn #18-20-(13)
+.data 9/20*6-0/3, 18, -6*(9)/1
+.data 15-1, 6/2
+L8: mov #-5/6+0, r2
+prn #(20-1*(20))
+.data 10*0+0-15*15*5-1, 3*16/17
+mov #2*4*12/3, r5
+mov L4[3], r2
+L9: mov L9[-12-9*14], r2
+cmp #8/16/4+14/3, L1[(5)]
+prn #-13+12/2
+L10: .data -10/4+15/1, (12-5), (6)--20/2
+mov #0, r3
+.data 20, 3/14, -5+(1)-13+15
+.fill 1, -(18)*(9)
+L11: .data 6*11+(16)--3*4-8
+.data 10+13-15-16-3-5, 20/3*13+2+13, 3/4, 7-(8)*19/1*12+8
+L12: mov #4+14*18/5, r1
+mov #-(7+8), r1
+.data 17+13/1+5/20/20, (-2)-4*18/20, 3
+L13: mov L0[(19*9/19)], r2
+L14: mov #6-9/5/2, r6
+cmp #-13, L10[4]
+mov #14, r2
+.define c0 = 17*17 + (1)/1
+.data 10, 15, 20
+L15: prn #c0
+.define c1 = c0
+L16: cmp #(c1), L12[(--19)]
+L17: prn #-2/7/4
+.define c2 = 6*8
+L18: .data 13-(c2), 0, -10, c0-17+c0*0-13
+cmp #17, L14[c2-c2-4/2]
+cmp #--c0*6, L10[(-c1/3)]
+.define c3 = -(19)/1
+mov #-c3/2-c1+19-c0, r4
+mov #c1*c1, r5
+.define c4 = (0-c3/14)
+L19: mov L8[0], r2
+L20: .data 12
+mov #-13, r0
+prn #-5*10-19-6-5
+prn #c0
+mov #c2/9+(c2+15), r2
+.data --20, c2*12, 7/12/1+12, 7+(9)*c4
+mov #14+(8), r7
+cmp #13, L14[-c4*c4/1+(0)]
+.data (c2/8+4/5), 18/5*c0+20, c1, 4*4/3
+prn #1
+.define c5 = 7
+mov #((c2))+-c1/4, r7
+mov #2, r3
+.data c0
+L21: prn #c1+c1/2-15-c0+-20
+mov L8[c4], r2
+.define c6 = ((-c3))
+mov #c4, r5
+mov #2+12-c3-c2*17/2, r6
+.define c7 = c0+(c5)*c3/3/3
+.data 12, 17*c0, 6-(c4)/2
+mov #c1, r3
+.define c8 = c0
+.data c6, 7-c7*c1-1+c7
+L22: mov #-0-14-9+(-c2), r3
+.data 19/15*2+1*c0, c7-17--8/13, (16)-c7-15-5+2-2-9, -1/17*12
+.data 3
+.define c9 = c7/18+20/5
+.define c10 = -((c1))
+.define c11 = 16
+mov #-(c7)+c2, r5
+hlt
@@ -0,0 +1,95 @@
+mov #9, r5
+.data 5
+L0: mov #10/7+0+(15*2), r6
+L1: mov L1[9+7-8+-0-5*10], r2
+.define c0 = -16
+.define c1 = c0*c0/2/4
+L2: mov #(18)+-0+13, r6
+.data -14/12-11-5-16, (c0)-5+-17/2
+L3: mov #(17), r5
+.data 11+6-(c0)/3, c1, c0+8
+.data c0
+mov #8, r5
+L4: .fill 1, c1+9*c0-c0-(c1)
+.define c2 = c0-c0/4
+mov L0[c2], r2
+mov L3[-(2)], r2
+.define c3 = 9
+.define c4 = c2
+mov #((c4-1)), r0
+mov #16*c3*c0*1, r3
+.data c4+-c4, ((-c2)), c0, (-9/1)
+L5: mov #c4-1-c0*15/4, r6
+L6: .fill 4, c4
+.data c1-c3*c3/4
+.define c5 = (9)
+mov #(3), r4
+mov L1[c4-10--c3-9-c4+c3], r2
+mov #c3+10, r7
+.data (c1)+11/3, (20)/5-c1*c2/4, (c1)
+mov L0[c1*7-c1-c5*c3*c4], r2
+mov #c4/2*0*c3+2, r1
+mov #9-18-14--c1, r3
+prn #c5-c2-c2+c4+-8
+mov #c0, r7
+cmp #13/2*-c0+(c3)*16+c2, L5[6+c4/3/15]
+L7: prn #c4
+L8: .data 7/4+-20/1, (20)*-(3), c1/4/12, c5
+.data 0/4
+.data 8+0, c4*8, -9+13/7*c5
+L9: .data 0, 6*c4+(c2)-12/2
+.define c6 = -17 + 5*c1
+L10: mov L4[2/5], r2
+mov #-4, r2
+.define c7 = c5*c6*20*5
+.data c0, -c4-1*(19)
+L11: mov #(c1*c6), r0
+.data 7, -2, -c0
+.data ((20*c1)), (c4-c0)+c7, (-20)-14+c4-c5, c6
+.data c5/4, c2-18, -4*c3+c5
+L12: mov L5[((8))/5], r2
+.fill 4, 9+8+17+14
+prn #c7/4
+mov L2[-c5-c0*c2], r2
+mov #-14+-c7*(19/3), r1
+L13: .data 10
+L14: prn #c6
+L15: mov #c1/1, r2
+mov #-c7+c4/1-(12)-2*5, r2
+mov #-(11*c4), r7
+L16: .fill 2, c1/3-13/3*19-c0-18
+.define c8 = 10--1*(15)
+L17: mov #c0, r5
+L18: prn #4-2+c8+c1*c3/11/4
+mov L2[(c3*13+2)], r2
+.data c1
+prn #8+c1*10+-1+20
+L19: .fill 2, c8
+L20: prn #16*c5
+.define c9 = (4) + c0 + 10
+.data (-12)-(-c2), 14, 11
+mov L6[(-(20))], r2
+mov L4[(-c3)+c8+c2+2], r2
+.define c10 = -3 + 5---5
+.define c11 = 2
+.define c12 = (17*14)+c6
+prn #(c7)+c6+c1/4
+.define c13 = -5-(11)
+.data 5*4
+.data --c13+c12/6, (c11)
+L21: .data (c0)*c6+9, c3/13+(c0)-5*20*3/4, c3+c2-8, c1+-17+c5
+.data 15, 5, -c1
+.data c6/5-c0*c5*-18, 7, c7*((18)), (c1)
+cmp #-(7)/1, L15[(18*9*14)]
+L22: cmp #(c9), L10[-(c10)]
+prn #(20)
+mov L1[(8+11)], r2
+mov L5[4*9], r2
+.define c14 = -11+6-3+10
+.define c15 = c10
+prn #-17-c11/2-(c1)/1
+L23: .fill 3, ((c0/3))
+.define c16 = -c0
+cmp #c16, L3[7]
+.define c17 = 20-5*5/2
+hlt
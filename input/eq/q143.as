@@ -0,0 +1,44 @@
+L0: cmp #7, L0[5*9*20+15/4]
+L1: .fill 3, 14*0+4/5
+.define c0 = 0/2+1
+prn #(c0+c0+c0+c0)
+.data -c0*c0*5, -(c0-c0), (-c0)
+mov #-c0*20*c0, r0
+mov #c0+c0-c0/4, r2
+.define c1 = -c0-c0/2
+.define c2 = (c1)*-c1*c0
+.define c3 = --c0*15
+L2: mov #c1+7*5/4, r6
+.data 17, 5, c1, 3+10+c2/2
+.data 5*c0-c3/4+-c3*0, c2, 18-5*2-c1+14
+mov #(c3)+(c0)--0, r6
+L3: mov #(13)-(c2), r5
+.define c4 = (10*14-c1)
+L4: prn #6
+mov L2[7], r2
+.define c5 = --c4*7-14-5/11
+.define c6 = 9 + 13 + 11 + c1/4
+L5: .data c6*-12/5, (7)-(c0)/4, c1-c2+6/1, c5/13/3+-15
+mov #3+7, r7
+prn #(7+c1)*c3
+.define c7 = (c5)-0-20*c5
+L6: .data (1)*-c1--7-19, 12, -3*c5-5/1-c4+c1, 14
+prn #8
+.define c8 = c6--c5-c2
+.define c9 = -8 + 20--c8
+.define c10 = c4
+mov #(4), r0
+.data ((12-c10))
+.data c0, c4/8/1-3-c10/2, 1*c6, c3*c4/7
+mov #(c2)*1+15/4, r6
+mov #c6+c8/5*c2*c6+c5, r5
+L7: .data 1-c1-8+-c3, c0, -12, (16)
+cmp #c9, L1[-c8*c1]
+mov #c0, r3
+L8: mov #16, r5
+.fill 1, c6/4
+.data c10+(c3)-c9, (17/2)+-c10/3
+prn #11/4-(12)/4
+L9: .data c4/3*12, -c1, 17, (c9/2/2)
+.data 0, c7+17, 10+c7/4*-c8+c4
+hlt
@@ -0,0 +1,78 @@
+.define c0 = 2*8-(7)+7/14
+L0: .data -c0/1, 12/5, c0-11/3-c0, (19)
+.data c0/2, ((12))
+.define c1 = -11
+L1: .data --16-c0, c0+c0/1
+cmp #c1, L0[(c0*-18)]
+L2: .data --8-7, 4
+L3: .data -3
+.fill 2, 17
+mov L0[c0*6+c0/2], r2
+.define c2 = (14)
+L4: mov L2[c2], r2
+mov L3[15], r2
+cmp #--18*c0/3+c1*7, L0[10/4-10-5/16]
+prn #c2
+.data 8+c1
+L5: prn #c2
+mov L4[2-c1*c1/4+c0], r2
+mov L0[c0], r2
+mov #((c2))*c2/3, r5
+mov L4[--19/18], r2
+.data 10+c2*c0*(16), c1, (5+(7)), 18
+.define c3 = 0/4
+L6: mov #(c3), r7
+L7: .data c3/1, -c1-1*c1+c1*c1
+cmp #(-c0+c1), L3[c0/3]
+L8: prn #-8-1+-c1+c2/3
+.data c2, c1, c3+3
+mov #17-c2, r0
+.data 18/10, -c1, 3
+mov #16, r2
+.define c4 = ((18))-7*13/2
+mov #c0, r5
+.data c1*3/17*15+12, c2-7/3*10, 5*-c1/1, 17
+.define c5 = (12+c1/4)
+mov L3[(c5)-c4*c0], r2
+.define c6 = 2/1+-c3
+L9: .data c1-(16), 14+-17+c5, -8
+.data (c0)--c2+(8)
+.define c7 = c5 + 1/17*c6
+L10: .fill 2, -(-c7)
+.define c8 = (c7)-(9/4)
+L11: mov L10[c7], r2
+.define c9 = ((c6/1))
+.fill 1, c7*(c4)/2
+.data 5*17/2*c2*c8+11
+.define c10 = 19
+L12: mov #2, r0
+mov #(c0), r1
+mov L1[c4-c10], r2
+.define c11 = c4
+.define c12 = (c11-c0)*14
+.define c13 = c5 + 17*c7 + (10*6)
+mov L0[-c6/2-c8/5], r2
+.data -c3*13+4*c3*c0+7, 8, (--c5), 14*c3*6/5-c4
+.define c14 = (-c10 + c9)
+mov #-0, r3
+.data -(12)/4, (c8)/20+-c7, c12+6+7+3-c7-5-11
+mov L4[c10], r2
+.define c15 = -7
+L13: prn #11*0/1+(c12)
+L14: .data -4-c2-(14)+c13+c7, c12, 10+c11
+cmp #(7)-(16)+c14*c1-c5, L3[c1]
+.define c16 = c12
+prn #(16)/2
+L15: prn #12*1*(13)/2
+mov #c2, r5
+.define c17 = -16--6-12
+.define c18 = -c1 + c14/15
+L16: .data -(c0*c15)
+.define c19 = 6-16/4/4
+.define c20 = 16
+L17: mov #-20-2+c6/4, r6
+.define c21 = c2
+.fill 1, 11/4
+.fill 3, 10
+L18: cmp #c14+c4+c5/5, L18[4/1*c17+6]
+hlt
@@ -0,0 +1,117 @@
+prn #0
+mov #8/4, r4
+.data 15, 5, (0*13)-19
+.define c0 = 7
+L0: mov #1+c0-20/1, r0
+prn #2
+mov #c0, r3
+.data 20*0-17+(0)
+.define c1 = c0
+.define c2 = 11 + 8
+L1: .data (-17), -c2-16+c1
+.data 1
+L2: cmp #4, L1[3-(c2)]
+.define c3 = (4*15)-(c0)
+L3: mov L2[c2], r2
+.define c4 = 18
+L4: .data (8)
+prn #c0/3-c3*9*c2-c1
+.define c5 = 13/3
+mov L2[((c2)*10)], r2
+cmp #2+c1*(6)*(17)-c2/8, L4[20]
+L5: mov #-12-19/2, r6
+cmp #6*c3, L5[10/3]
+prn #9
+mov #11, r3
+L6: prn #(14+c0)+9
+cmp #13*c3+3+8, L3[c4]
+mov #c4-c4, r3
+.define c6 = 11
+.define c7 = (19)
+cmp #c6, L3[c7]
+.define c8 = (-10)
+L7: mov L7[8], r2
+.define c9 = (c0-2-c0)
+L8: mov L0[c4*12/1], r2
+mov L6[c3], r2
+.data (c1*c4/5), 17
+.define c10 = 19
+.define c11 = c9-c7*11/3*c5+c4*c5*10
+L9: mov #16, r3
+mov #((c1/2)), r3
+mov #1-c1, r7
+.define c12 = 10-c7/5/18
+L10: mov #c2*(-c11), r0
+.define c13 = 2
+.define c14 = 15
+.data c10, 19*c2, 0, 7/3*9-c10-c5
+.define c15 = ---c13
+.fill 2, 15
+mov #c12, r4
+L11: .data -18/3--c7, c2-c13
+.data 14-5/4-c12, c12, c14*-c6/5, c7*c11+-c12+(2)/3
+L12: mov #c2-c12+c2-11*c7, r4
+mov #c4--c7*12, r4
+L13: mov #(1/2+c7), r5
+mov L9[c3-15*c1+c9], r2
+mov L8[-16], r2
+mov #15-c15, r7
+L14: cmp #-13-c7+c9+19+c1, L2[((2)-c14)]
+.define c16 = --c13+15
+cmp #c7, L12[c0]
+.define c17 = ((10))
+.define c18 = c11
+L15: prn #-((13))
+.define c19 = 15
+.define c20 = 8
+.define c21 = (c0) + -6/1
+.define c22 = c20
+.define c23 = --c22
+mov #-c22*c11/1, r7
+L16: prn #c20+(c1)/5
+L17: mov L1[(-c7)], r2
+.define c24 = (c23)
+L18: .data 1-11/3+--c2, (c14*(0)), c1, 3*--c7
+mov #-c14*c24*15-c21+-12, r5
+prn #(c9)+c8-(11)
+mov #-(12*c13), r5
+mov L13[-c19], r2
+L19: .data 18, 15+5+c3/1, c6
+.define c25 = c7--c10/3
+.define c26 = -c14+c4*(c19/2)
+L20: cmp #(4), L10[c6]
+L21: .data (c25), -c9-(c17)
+.data 5, c3--3/5, -c0-8
+prn #c13
+cmp #-c2-c2+c11*c4, L11[c5*c0-c17-10*c23]
+.data 8, c17/2, c14
+L22: mov #c24+c9*c1+((7)), r1
+L23: mov #9, r2
+mov #(-16*15), r1
+L24: prn #((c26))
+.fill 3, c8
+.define c27 = (18)*c1/4+(2)*c22*c23
+.data 8*9+8*c14-c25
+L25: prn #14
+L26: cmp #c19-c21/5/3, L4[-c14]
+L27: mov #0, r2
+cmp #c19, L8[-18*(11)/2]
+mov #-c9, r1
+mov #c8, r2
+cmp #2, L14[16+c1]
+cmp #(0)+18*c10/1, L17[-c18-c9-2*5]
+.define c28 = (-2)
+L28: prn #--10-c26
+L29: mov #-c18-c2*c26/8, r1
+L30: mov #c25, r5
+mov #2, r7
+L31: prn #c22/3-12/5
+.data (c0-c26)*c24
+L32: mov L8[5], r2
+mov L6[--11/17], r2
+.define c29 = c10 + 6/2 + -c22-9
+mov #7*1-c4/2, r2
+mov #-c8+10, r0
+.define c30 = 16
+L33: mov #3--9/4, r6
+hlt
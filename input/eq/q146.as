@@ -0,0 +1,38 @@
+.define c0 = 9--13+-13
+.define c1 = (c0/4)/3
+.data ((16))/4, (c0), c0*c1+-13-14
+L0: mov L0[3+c0/1], r2
+.define c2 = c1*c1-c0/2/4
+.define c3 = c0-6*9-c0
+mov L0[9/3*(12/4)], r2
+prn #(10)
+.define c4 = c0
+mov #c2/2, r2
+prn #-c1-7+c4+c4/3
+L1: .fill 2, 17+c2+c0*15+11/17
+L2: mov L2[(c1+13)--c0], r2
+prn #(-18)
+.define c5 = c1 + 18-6 + 20/14
+.data 5+c4+c3-c1-c4, 9-6-17+c3/5, -2-4/5, 10*c2
+mov #c1, r2
+L3: prn #10/3
+cmp #c3, L0[c2]
+prn #2
+L4: .data c0/11*16+c1-7
+mov #-10+11--18, r7
+mov L2[c2+6], r2
+L5: .data 3, c5
+.data (6)+c3/1, -17+12, 17, c0
+L6: .data -c5/3, 19, 0/8+2*c5*(c0*6)
+.fill 2, (c0-10)/5
+mov L3[-c0+13], r2
+cmp #c1, L5[9]
+.data ((c1)/1)
+.data c0*10, c0*c0/3+c4
+.data (4), c3, c1-6*c5*c1*c2+2-c2
+.define c6 = (c3-c5*c2*14)
+mov #3, r5
+.define c7 = (14)-c2*c6 + 14*(8)
+mov #c4-c6+10--11+c0+12, r0
+.fill 4, c3/4
+hlt
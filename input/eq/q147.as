@@ -0,0 +1,98 @@
+mov #--11-14*14, r5
+.data 8+-1-14, -18-18-19/2
+.data (11)-11, 20
+mov #(1), r6
+.define c0 = -(18)
+prn #c0/2/3*c0*15/4
+prn #-c0-c0
+.define c1 = 19
+L0: mov #(10)/2, r5
+mov #(c0)/1+14+1*c1, r1
+cmp #(c1)*c1, L0[c0]
+.define c2 = (c1*10)/5
+L1: mov L1[(11*c0*c0+c0)], r2
+.define c3 = -c1
+.data c0, (12)*c3/5, --1*12
+mov L1[c2], r2
+L2: .fill 1, c0-c0+16-20/4
+.data c0/1, 7, 1+(c2)/3, -11+c1/3
+.define c4 = 20-c3+c1*16/1
+L3: mov L3[c3], r2
+.data -((c4)), c0*18-5+-c3-1, c3/5-19, -20*c4+c4+18
+L4: mov L0[--c1-c3], r2
+mov #6*c3/5*c0-14/1, r0
+mov #(-c4)-10, r1
+mov #(-8)--9*c3, r2
+L5: mov #c0, r5
+.define c5 = ((c2))
+.define c6 = c1+-c5+c3
+mov #0*(-c6), r1
+cmp #c4*c4*20+-c2*c6, L3[c1-13-6+c4/12-(c3)]
+.define c7 = c6
+.data 10, c6, (12)-14, (c4)
+mov #c2/5+(c1)*c1*4, r2
+.data c4/9+9+c2+0/3, (-c1)-13*15, c4
+L6: .data (c4*c5/1)
+prn #((2-8))
+.data 20, c0, c0
+mov #((c2)*-c1), r7
+L7: .data c2
+L8: mov #-c4, r0
+L9: prn #(c4)/14+12
+L10: mov #c0+c6+5*0, r1
+mov #-((c7)), r1
+mov L5[(c4)/20*c0], r2
+.define c8 = c0 + c3-(15)/2
+L11: cmp #(8)/14/3, L3[(c4)]
+prn #11
+prn #9
+mov #-c3*17-(20)/2, r5
+.define c9 = c7
+.data 8*(c2*c7)
+.define c10 = 3-14 + 16/4*((11))
+L12: .data c8, 7-c4*14-c0*-11/3, (6+c6)*c5-3
+prn #(7/10)-c8-c9
+prn #c6
+mov #-c6, r3
+.data c6/4, 10/3/4/5, -14*9-c4/13
+mov #(20/4*c2+2), r4
+cmp #4/3+3+c10-c3, L8[(19/15)/2]
+prn #20-10*14/3/2
+.define c11 = 14-c7
+mov #(c3+c5-3), r1
+mov L7[19], r2
+cmp #c6, L1[2]
+mov #(-6+c3), r3
+mov #-16, r4
+.data 3*10+15/3, -9+c8/4
+L13: mov L9[(-c1)-c5+16+c7+14], r2
+.define c12 = --13
+mov #9, r4
+mov #10*c9, r5
+.data -c9, c0+17
+L14: mov #-2*(17), r3
+.define c13 = 1-c1-8*-9
+cmp #c0, L13[17*(17)+1+c8+13]
+mov L9[20], r2
+.fill 4, (c9)
+L15: .data -13/14, 17
+.define c14 = (c9)-16*5/4
+.define c15 = c5
+L16: prn #12
+L17: cmp #-3*18*10-c12*9*c4, L7[c8]
+.define c16 = c2
+cmp #-c6+c3, L16[c13]
+L18: .data c7+5+4+2*7*c3-c2+8, -(11/3), 10+c6, (c4)*14*c1/11
+.define c17 = --17-0
+.define c18 = c3
+.data (c1), (c12+1), 18
+mov #15/2, r2
+L19: mov L12[13], r2
+.define c19 = 18*c13 + c0
+mov #9, r5
+L20: mov #c17, r1
+mov #20, r6
+.fill 1, 8
+.data -c1/4-13+7, (14-17), 2, 18
+L21: mov #6, r1
+hlt
@@ -0,0 +1,72 @@
+prn #-9-(0)/5
+.define c0 = 13-10/11*14/20
+.data c0/4, (c0)*-c0+19
+.define c1 = c0
+prn #1+c0*c0
+prn #c1-c0/3*5
+prn #5
+prn #15
+.define c2 = (5/8)
+prn #3
+L0: .data -c0/3--c1, c0/2
+mov #20, r7
+.data c2-19+c2+c0+c0, c2
+mov #20*2-(20)--20/5, r3
+mov #(c2+6)+-c2/5, r3
+.data 17, 1-c2+c2-c2, 16+c0-c1+(13+8)
+mov L0[-c1], r2
+.data (8+1*(4)), -10, 15
+.fill 1, 20/5
+mov L0[c2], r2
+.data -c1/2/3, (-c1/3)
+L1: prn #2-20+2*c0-11-8
+.data c1, c2, 10*c2, -c2-4-2
+L2: mov L0[c0], r2
+mov L0[c0/5+-1/2], r2
+.define c3 = 5*c1+-c1+c1-1-18
+L3: mov L0[9-10+3-13], r2
+mov L1[18/4], r2
+.define c4 = -15-c3 + c1
+.data c4/1+2, (c4), -16
+prn #18/3-c0
+.define c5 = (c4-c1*c0)
+.define c6 = 11-19
+.define c7 = 12
+.define c8 = c1/10*-17
+.data 6, c0+c1-5-c1-c8/11, 9/1/1+c0
+mov L1[6-6-c5], r2
+L4: mov #4+c7/1, r6
+L5: .data c1+0/2*(c7*0), -c0/4*c7+c2+4
+L6: mov #13+-3*6, r0
+mov L2[c1/1], r2
+.data (16)*c1*c8*(12), 8/2+19*-c3*c1, 6
+.data 11
+mov L5[c6], r2
+mov #10*c4/18+19, r0
+mov L0[c4/5-c0/11], r2
+.define c9 = --c2/4
+L7: mov #c5+17+20-17, r6
+mov L4[c2], r2
+.fill 3, 18
+.define c10 = 11
+L8: mov #-7-16, r1
+.define c11 = 9/11
+.fill 2, c8-5
+.define c12 = 20/20-6-c0/1--18
+mov #(c9), r3
+L9: prn #c4-6/4/5
+.data (12-16)/1
+mov L2[c6], r2
+L10: prn #-c9-17*19
+mov #c11, r6
+.define c13 = c9
+.define c14 = 10
+.define c15 = c3/5-c5
+.define c16 = 8 + c13 + c3
+.define c17 = (0)
+mov L1[c1], r2
+L11: mov L3[-c6+(c5)*c5], r2
+.fill 3, c4
+mov #-c11, r5
+L12: .data 10--c1-c17
+hlt
@@ -0,0 +1,30 @@
+.define c0 = 0
+mov #6, r7
+.define c1 = c0
+L0: .data c1, c0/5, c0*9, 15+c1-1*c1-c0-6+1
+L1: mov L0[1*12], r2
+L2: prn #c1
+prn #5
+.define c2 = --c1*c0
+L3: mov L1[-15-c2*5-c1], r2
+.fill 4, c2
+L4: prn #c0*-7-c2
+.define c3 = 9-9
+mov #c3-c0*c2-16*c3, r5
+L5: .data -(6*19), -c0*c0--c3
+.define c4 = c0*c3
+L6: mov #0, r1
+.define c5 = 18
+mov L6[-c2/5*3+15*14-15], r2
+L7: mov L0[c5], r2
+L8: prn #-(c3)/1
+mov #14*(18-18), r5
+L9: .data c5, --12-c1
+.define c6 = (-14)/11
+mov #3, r2
+.define c7 = c0
+L10: mov L6[1], r2
+L11: .data (-c7/9), c6, -c3, 18+-c1
+L12: mov #((7))*16, r3
+L13: .data c2, 14+-c7/2
+hlt
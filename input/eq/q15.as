@@ -0,0 +1,47 @@
+.define c0 = 7
+prn #c0*c0
+L0: prn #---c0
+mov L0[(0+19)*(-c0)], r2
+.data c0-11/4
+mov L0[-(8)], r2
+L1: mov #(-c0+c0), r7
+cmp #-12*c0/4, L0[-3-c0*-15+c0]
+prn #-20+0--c0
+L2: mov #19, r5
+L3: .data 6+(6)/3
+L4: mov L3[14--16+c0], r2
+L5: mov #c0, r3
+mov #((c0+19)), r7
+cmp #c0, L3[8*14*3/2+14]
+L6: prn #7-9
+prn #--c0+c0/15--13
+mov #c0+9, r7
+cmp #-18*-20/5, L5[5]
+L7: .fill 1, c0
+L8: .data c0+4+-16, c0, 9*c0+16/3
+mov #-9+c0*3, r6
+prn #c0
+prn #-c0
+mov #-19+11-c0/5, r3
+L9: mov #c0, r1
+L10: .fill 4, -0/1/1
+.define c1 = (c0)*7*c0*-15-9
+prn #0-c0*19*10-4*c0
+.define c2 = -c0-c0+c0-c0+16/2
+L11: .data c0/7+(c2)--1, c1
+L12: mov #c1-(14)*(17), r7
+L13: .data c1, 20, 2/3+c2
+mov L12[c1], r2
+L14: .data 10, c0-17+c2+c0, (12), -c2+c2+16
+mov #8*7*c2, r1
+L15: mov L14[(c0)+c2/3-c1*c2-c1], r2
+L16: .data -c0+c1*c1+c0, c1, 17
+mov #c1/19, r3
+.define c3 = (c2)
+mov L8[c3+18+(17)/2], r2
+.define c4 = (c2)
+.define c5 = c3 + 11 + c2 + c4 + 16/4/1
+.define c6 = -6-c0
+L17: .fill 1, c2+16+c1+c6-11
+L18: prn #c5-c1+-0
+hlt
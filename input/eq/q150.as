@@ -0,0 +1,62 @@
+L0: cmp #-(2), L0[--9/4]
+L1: mov #4, r3
+mov L1[(17+14/1)], r2
+L2: prn #6/20/5+11*2*18+3
+.data 12, -12, 11, -(19)+14/1
+.data 18-5+7+3-0*11, 9, 2-14-10*3
+L3: .data (-12*13)
+.define c0 = 17
+.define c1 = 14*3-c0/5
+L4: .data (c0), -c1, (c1/5), c0+c0/9/5
+L5: prn #-c1
+.data c1*(0/4), c1+-c1+c0, c1, 0*c1+13/1
+.data --c0/13, 13, c1*15*16/5
+L6: .data c1, (-14/12), 18, c0-11-c0-(1)-c0
+L7: mov #(-0)/5, r4
+.data (c0/3)+8*c0-(2), c1-c1, c1, ((10-0))
+.data c1*c0-0+(7*18), -c1/3
+L8: .data c0/2, (14/1), -0-(c1), ((c1))
+L9: .data c0+-c0, c0/2
+L10: .data -c0+c1+c1*2*7/14, (c0+c1+c1)
+.data (c0/2*c1/8)
+.data -4*10*4-7
+mov #7, r4
+.fill 1, -((6))
+mov #16+7-c1*16-c0+17, r3
+.data 1+c0--12+c1, -c0--7+14, 2-c0+15*c0*10
+.data c1+14/3/5, c0/3, c1
+cmp #12, L10[c1]
+.data c1, c0, c0
+.define c2 = --4 + c1 + c0
+cmp #5-0/15, L7[19/5]
+mov #14, r7
+.define c3 = (20*0)*3*c2
+mov L0[14+11/2/5], r2
+mov #c1*-c0-6*c0, r6
+mov L7[c1/2], r2
+mov L6[((7)/4)], r2
+L11: .fill 1, 1-c0
+.data c1
+.define c4 = c0
+.data (-16)+--8, (13)
+mov #2, r5
+.data c1+12+15/14*5/1, 1, ((4))-c3, 13
+.data --7/4, c1
+L12: mov #14, r7
+.data -11, c4*(18), c1+c0, -17
+prn #c3
+.data c3+-1*0
+.data 18, (13-c1)+c4, -(-c3)
+.data 20*11
+cmp #18+c0*18/2, L5[c2]
+mov #9, r7
+L13: prn #20-c4*8+15
+cmp #17, L13[c4]
+L14: mov L7[-17+5*-c0--c0], r2
+.define c5 = 7/3
+prn #(c1)/1-19/2
+mov L12[c3], r2
+mov #12, r6
+.define c6 = c5
+L15: mov L4[-15], r2
+hlt
@@ -0,0 +1,111 @@
+.fill 2, -3
+mov #(10*5*9), r7
+.define c9 = 18
+L0: .data 4, X9, -7*(8), c9-c9*c9-5/c9-0
+.define c7 = (c9-17/11)
+mov L0[c7/-c7*c7], r2
+L1: .data (c7)*c9/19+c7-9, -c9-c7*6+c9, (20*5)+c9, 5-(c9/c7)
+.define c11 = --c9*15/c7 + c7*16
+.define c6 = c11/3
+.fill 4, 15
+L2: mov #-6-12, r0
+.data (0/c6)+1*12-c7+c9, 10/10*7*c11, -c9
+prn #c9*15*12/6--c9
+L3: mov #0, r7
+mov L1[(c9)*c6*-c9], r2
+.data 18, 6, 10+-16+(8), c7
+mov L0[-9+10/(-c11)], r2
+mov L2[c9-c7*c11/3], r2
+mov #(c6)+(c6)*14, r5
+L4: mov #-2*-8*c11, r4
+cmp #c6/c11+c7-c9, L0[3]
+prn #6+c11+12--(c6)
+L5: mov L3[11+c6-c7-c6/0], r2
+mov L0[-5/19+c6/c11], r2
+mov #13*c9/4*c11*c9/-c11, r0
+.data c6+c7, 5*14/11*c6/12*15*5
+L6: prn #18*10/18-c11*-c7-14
+.define c7 = -c6
+L7: .data (18), c11
+mov L4[(-14-19)], r2
+L8: .data c9
+.define c6 = -(4*c7)
+prn #0+c7-16/c6-c11*9*c7
+.data c7+-6/(c6/15), c6/(6)
+prn #16+17+c7-20-c6/9
+mov L6[c6*16-c7*7/8], r2
+.define c12 = c6
+mov #c6, r1
+.define c13 = c6
+.define c7 = 20/1*c6 + c7 + c12/c7
+.data (c7-c12*16*3)
+mov #5-(18)-c6, r3
+.data c12-c12/nope/4, c7
+.data (-c9)/17*14/c12-c7, 8, 16, 17
+.define c1 = nope
+.define c15 = -c1
+mov L3[8/14+c1*11/c9+c9], r2
+L9: mov #c9*(c12), r1
+.data c15*14/-20-c7/9, c6
+.define c2 = 11
+L10: .data 10-15*c9/nope*11, c7*6+5/8
+.define c15 = 5
+prn #c2
+L11: cmp #((c6))+c6-0*0, L0[7]
+L12: mov L4[(16)*-20], r2
+mov L0[c12], r2
+mov #8, r6
+.define c2 = c6
+mov L7[6*6+1*(c1-c7)], r2
+.define c7 = 17*7-16-X9-20/5+2
+.fill 3, 9-15+10+-17
+L13: mov #c6, r3
+L14: prn #(15)/8
+.define c0 = 15
+.define c6 = 8*c15+c7*c6*15*9*c15
+L15: .data c7*c6/4/c6
+.define c10 = L0
+mov #5/4/0+(c1)/18*c6, r5
+.data -19-c1-c1+c7
+mov #c15*19/c1/c6+-c6/19, r0
+L16: mov L6[-c6-12], r2
+L17: .data 13
+mov #14/2/c1+5-X9-c6+2, r5
+cmp #c7, L5[c11]
+L18: .data 5/12/2/6*15, 9-c7*c7
+.define c3 = c12 + 7 + 14*c0*17-10/c15
+.define c1 = -2*16*4+-(c9)
+.data 7
+L19: mov L16[15], r2
+L20: mov #c7/c7-(8)*c15+c1*c7, r5
+prn #11+2-c13/5
+mov #c7*6*12/c11+X9*3*19, r3
+L21: cmp #-2, L8[15*c11*c2+c7-c7-c0]
+.define c4 = -c12/2/c2*11*c15
+L22: .fill 2, 4
+mov #9, r3
+L23: .data 0/7/6+8*c2+2, -c9+8
+L24: .data c1-c2/2/c13-(11), c15
+.entry c6
+.data 8, (--c15), nope
+.fill 2, c15-3/4/c7/c2-12-8
+.define c14 = 20
+L25: .data ((12-5)), c6/c13-12*c10*c15, 5, c13
+L26: mov #c15, r3
+.define c12 = 4
+.data 9/c2*15*6+7, 17, -9
+L27: mov #--c1+c11, r7
+.fill 4, 10+c15-12-c2
+.fill 1, c2
+.entry c3
+mov L24[c1], r2
+mov L21[2/c4*c14], r2
+L28: cmp #6, L25[(15+18/c4)]
+.data 18-c1-(c6)+(13), -c7, 8
+L29: .data 9*3+17/c4/c12, c7, c13
+.define c15 = c7+1*c10+c15
+prn #c12
+L30: .data c9, (18+7)/9
+.define c9 = L0
+L31: .fill 1, c7
+hlt
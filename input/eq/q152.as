@@ -0,0 +1,117 @@
+L0: .data 5/2*6+10+7+19, -16
+L1: cmp #11--20+20, L0[6/13/3*14]
+mov L0[5], r2
+.data 5*0+8+12/15, 14
+mov L1[(18-4--18)], r2
+L2: prn #4*4
+L3: .data 16/--5, (13)+2/(9), ((20))--10
+.data 12, (7)*(0*17), -18+7-15, 19/-1+18+14
+L4: prn #8*nope-2+16*11-20
+.define c11 = (17+16*14)
+.define c15 = c11
+L5: mov #c15, r5
+.define c5 = 17
+.fill 2, 19
+L6: mov #8, r2
+L7: mov #c15*c5-19+17-17, r6
+.define c13 = (c11/c11)*c15*c5-(8)
+L8: .data c11, 10, 3, 13
+.define c5 = 11/c15
+.data 9*-2/-c13, ((c15))
+.define c7 = c5
+.data c7-X9/7*c5*--18
+mov #10, r4
+.define c11 = 16/20
+L9: cmp #c7*2-c5/-10, L5[c5*c13*c11]
+L10: .data L0, -1/2/c13, 3/-c13+c11
+mov L7[(19+c7)*20+c5+3/12], r2
+cmp #c7/c15+1/-c7/4, L6[c5-0/c7/-c5*c7]
+.define c12 = c11*12*6-3*(c13-c15)
+L11: .data (c12)
+prn #nope
+L12: .data 17, 7/20-16/c15+-2/3+c7
+mov L10[c11/(c11)], r2
+L13: .data 16, c15-c7-(c13)
+.define c2 = 0
+mov #c2, r3
+.data c5, (0-c12)*(c7)+4*14
+L14: mov L8[c12], r2
+mov L3[-19/2--9*c11], r2
+.entry c11
+.data c5-c5, (-nope/4), 3
+.data c2, c13/c12, c5
+prn #c11
+mov #-7-5+c11+c13, r7
+L15: mov L4[18*c13-c5/4*3*c5+c2], r2
+.data (3)-c11/c15+5*c5
+L16: mov L9[c13-2*c15*9+20+6/19], r2
+mov #(-c13-c12+c5), r7
+mov #c11, r3
+.define c6 = -9
+mov #c7, r4
+.entry c7
+.define c8 = 6 + (-c6)
+L17: .data 14+0-c15/c5, 8+-(2), 2, 7
+.data 2+14, c12, 11
+mov L15[c5], r2
+prn #-c5+(6)
+.data 3, c15+1+c13+c6*c12
+.define c5 = c11
+mov #8, r4
+.fill 1, (c7)
+.data c11, c15, c2
+.data (4)*7-c12/(19)
+mov L10[(15)], r2
+.data (7), 18*c7*18*c2/c15, ((c6))*12
+mov L5[(16+1+6+c8)], r2
+L18: .data -10*1-c5/c8*0, c7-c2-c12+19*c6, c8, 6*18*c8/19*4/-7
+L19: prn #c5-c6*18
+.define c5 = 14
+L20: mov L8[17/c2/20-(c11*12)], r2
+mov #c2*c5-6-(7), r1
+.define c3 = (c8)*4*c5+19
+mov L0[0], r2
+.data c8/c11/c11+c12, c8, 13
+mov L12[c11], r2
+prn #c5-14*c12
+L21: .fill 2, 1
+cmp #20, L15[c15]
+mov #-c6-c15, r4
+.fill 2, c5
+L22: mov #(c5-c5)/c12, r4
+prn #--c15*4
+mov L10[c2], r2
+L23: mov #c5, r0
+mov #(c5)/c15-c7-20, r5
+mov #16*c13*1+10, r2
+mov L8[14-14/c5+c3], r2
+mov L3[c15-18+3/10], r2
+mov L17[c2], r2
+mov L4[-(15)+17], r2
+mov #14, r5
+L24: mov #-c15--11*9+c6, r6
+cmp #7, L0[13]
+L25: prn #-(13)/-c5
+.entry c5
+.define c3 = (10*c12*-6)
+.define c3 = -17-c5-c11*4 + c2-c11-c3
+.define c9 = 6
+mov #16--nope, r7
+mov #9, r5
+L26: mov #c3*c5*11*-c13/c12, r0
+mov #-c3*c2*c13-c5, r7
+.data 2, c5+c6-c7+c15/20, 1-(14+c2)
+.define c5 = c13 + 2/16/c6
+mov #-6*5+c5, r1
+.define c3 = 11
+mov #c3/c7+c5-15, r2
+L27: .data 5, (12/5+6), (c6-c7)+c5, (c9+c5-19)
+.define c11 = 6
+.define c7 = (-c13-c2)
+.define c6 = 11*0-4*0
+mov #(10)*c6/--c3, r7
+.entry c8
+L28: .data -X9*c5*13/c13*(c15), c11, -19+c11-10+-6
+.define c2 = c2/15
+L29: mov #19, r5
+hlt
@@ -0,0 +1,83 @@
+.define c13 = 5-5*13*(20)-7*6
+.fill 2, c13
+mov #((c13))+c13, r7
+mov #-14+c13/c13-c13, r3
+.entry c13
+L0: .data c13, c13+-6-c13, 18, -10-c13+5*4+-c13
+L1: mov #((c13)/c13), r0
+.data (-c13), c13, (-5/c13+0)
+.define c14 = c13
+mov #-10, r2
+mov #2-(c14-12), r4
+L2: .data (c14), (20), (c14*2/20), 1/c14
+.define c11 = c14*-16*5
+.define c10 = X9/c13*c13-18/-(c11)
+prn #(c11+20*c13/1)
+cmp #19, L0[c14*4-17/17]
+cmp #12, L0[14]
+mov #(c11-c11)--c10, r0
+mov #13+c10, r2
+.define c4 = 15/3+c13+c10--c13+6*c14
+.define c6 = 3
+.define c10 = 9*18/(13)+X9+c11-c11*1
+mov #c10*(c14)*10, r6
+L3: mov #7, r6
+.define c4 = c14
+.define c13 = c10-6 + c6
+.data c4, c13/c4*(10)---c13, c4/8+19+c13/9, c14
+mov #9, r2
+prn #c14*18+(c11)/-3/3
+.define c12 = 8
+.data (20), 8, c10, 12*c10/c10*19/7/11
+.data 2, c4+c14, 8*c4-5+4+(7)-c11, c10/7+18
+.define c7 = c10
+L4: mov #19, r7
+prn #c10-c10-(4)+-12*11
+.entry c4
+.define c8 = 19
+.define c7 = 13
+mov #-c7/c13/2, r5
+mov #(c11-c8*c8), r7
+mov L3[(0-(5))], r2
+.define c1 = -c6+(10)/8+16-c7*c4
+mov #2, r7
+prn #c10-c12/c6-14*c4
+L5: mov #c4, r3
+mov #(c11), r0
+.fill 4, -9/18*6
+mov L1[8], r2
+L6: .data c10, c13/4/(c13)+c6-c6/1, (3)*1+14*c11, 5
+mov #c13+-4-2-c12, r5
+.fill 1, 8
+mov #18, r7
+.define c3 = c11
+L7: .data c11, c13, c11/(2)
+mov #c7, r2
+.define c10 = c4+3/c14/c7/12
+L8: cmp #c3/20-c10-(13-19), L7[c10+14/14/14/-0*c3]
+.data --c4/c12, c11, c7/8-19/3
+L9: mov L7[c7-20*17/3-15], r2
+.data c14
+L10: .data 7-c4/c13*c6+4
+mov #9, r4
+mov #c3*12*11/c10, r2
+L11: mov #0, r1
+mov #2, r4
+L12: .data 5, 14
+L13: mov #-c10/13-c8/3*14, r6
+.fill 2, -0*17--c14*c10*c4
+.data c1-16/c13*c10*c3
+.define c1 = c6*12/c7*c8 + c3/-6
+.define c11 = c13-c10*c7 + L0/17
+L14: .data (13)-6*c10-18, c1
+mov #19, r0
+.data c1, (6), c1+c14, 4+8+16-10
+.define c9 = 12/12
+mov #20+15, r2
+mov #6/12-0, r2
+mov #-c10*20, r3
+L15: mov L10[-((13))], r2
+L16: .data 19+c1/c14, 7+c10/c3+(c8), 0
+mov L13[c10/1/16-6+c8+c7*0], r2
+mov L16[18], r2
+hlt
@@ -0,0 +1,47 @@
+prn #(14)
+.data 5/16*17+5/19
+.define c3 = -16
+.define c0 = -15-0-c3
+L0: .data c0, 8, 17
+L1: mov #16, r6
+L2: cmp #9, L1[7*c3+5+c3/3/c3]
+mov #-c0*c0*13-8, r7
+L3: .data 10, 19, -(c3)-c0
+mov L1[-14/19-20+16-c3], r2
+L4: cmp #12+2, L1[(c0*c3)-c3/c3*13]
+.define c5 = (-c0) + 15-3/c3-18
+.define c5 = c0*(c5)+10*c5-12
+L5: .data 5/c0*c5-c5-c3, 5, (c0)
+mov L1[-c5*15], r2
+L6: prn #-c3
+mov #(7)-c3*13*19-c3-c5, r4
+.define c6 = c0
+mov #c3/(18)+(c5), r0
+.define c10 = c5/0/14 + c6--7
+.define c8 = (0/13)-c0
+L7: .fill 2, -(15+18)
+mov #-c0, r5
+.data c0, c3, c10
+.data 20/(10)+c10-c3
+L8: .fill 3, (10)
+mov #10+17*20/c6+c5-2-2, r4
+.entry c3
+.data 9/c8
+.define c0 = c10*c10
+L9: mov L8[4], r2
+prn #-16-13-11-c5
+prn #((16/19))
+.data c5, 19, c0*18+c6*11
+mov #(-10)+7, r4
+.data c8+20+3*17
+.define c5 = ((0+c5))
+L10: mov #(17+L0)/c5, r1
+.define c9 = -7*c3+14-c6
+.data 13/0--18+c6/c0/20, (c8), -c8+4-8
+prn #c5
+L11: mov #(2)+-c5/c10, r6
+.data c5-c5/c5+c6*c10-c0, c9-(9)*(18-20), c10, c3
+mov #(c5), r3
+mov L10[6], r2
+L12: mov #10, r7
+hlt
@@ -0,0 +1,95 @@
+mov #13, r6
+prn #1
+mov #20, r1
+prn #12*5/19--11-6
+.data -8--19*7/19-9, 9, ((0)), (13)/nope*16+-17/14
+.data 14*9-9*2/(6-1), L0-0+2+3, X9, 2+5/9*12
+prn #19
+L0: .data (10)/9+2, 10
+.data 9, 19, 13, -1-19*12-10
+.data 14/-3/9, 14, 13/-(15)
+mov L0[(((6)))], r2
+.fill 1, (6)-L0/-14+6
+.define c5 = 17 + 13-10/2/3-15
+.define c12 = c5
+L1: mov L1[c5], r2
+L2: .data 0, -c5
+prn #8
+.define c13 = c12
+L3: .data 2-c13/20*c13*20, -6, c5+2, 8
+mov #c12+c13+c12/8*-4*11, r6
+L4: mov L2[16+8-15*17], r2
+mov #-c5/12/-c5, r1
+L5: mov #8, r4
+.define c9 = -9+c12*2
+L6: mov #5, r5
+L7: mov L2[c13], r2
+L8: mov L4[c13], r2
+.data 1-c13/3-17--7*11, 2, c5*15, 6
+mov L7[--3], r2
+L9: .fill 1, 18
+prn #1
+L10: mov #c5, r6
+L11: mov L10[--(c12)], r2
+prn #-2*c13-c5*8
+.define c15 = --c12+6
+mov #--(c5), r0
+L12: mov #c12-12-0*2-c12, r6
+mov #16, r3
+.define c12 = c9-c12+9-0-2-15-c9*18
+cmp #c13, L1[-c9/-16*20]
+.define c2 = -(12) + -17
+.data 15/c15+-c12-(17), (4-c9)+(14)+c9/c12, 15, 9*-c15-c13
+mov L9[-(c13)], r2
+mov L1[c12+c9*(c12)+-c12], r2
+prn #(11-10-2)
+prn #11/c2
+.define c2 = (c5)-c12 + L0*c12*14-c15
+.define c10 = (3)/19
+mov #2, r3
+prn #3/19-c10*5-(6+0)
+.define c5 = (c2/16*c5)
+mov #c5, r5
+L13: .data -c9+16/c13/c12*c5
+.data -c5-c9+c9*12+13, (2), (c2*3)+20
+L14: mov #-c2-c2+(0)+-c15, r4
+.define c0 = 13
+mov L5[19], r2
+L15: mov L8[-c5+c13/c9+c9], r2
+.data 7, 16*c13, 20*(7)+c5
+prn #-15/(X9)*3*c2
+.data c13, 15, (18-c5/c15*c5), c0-2+c5+(c15)
+mov #0, r1
+.define c5 = c0-2*18*-c12-2-5
+.define c6 = c15/c0*c10--(c2)
+.data 12/3*c5/(c2)
+mov #c0, r2
+.define c15 = 5
+L16: mov #c12*2/c15+c6+c2/c5, r1
+L17: mov L3[11-c6/(1)-2*17/c12], r2
+L18: prn #((-10))
+.define c3 = -(19)
+prn #-c2/9/1*(2)
+.define c6 = 4
+mov #(-14)*-c5/c0+18, r2
+L19: prn #5
+mov #(c6), r5
+mov #-15-19*-c2, r6
+mov #12, r5
+mov #0, r5
+mov #c10, r4
+prn #c6-20+c5/0-20-7+14
+.fill 4, -c12/c3--c15
+.data c12
+.entry c6
+mov #(9)+c6-c6-(6)*c10, r2
+.define c15 = ((14+9))
+mov #c15, r3
+mov L18[5], r2
+cmp #(3-c12/c15), L18[(4)+c13+6*c9]
+L20: mov #c2, r4
+prn #c6*c2-6/c2+c15+14
+.define c2 = (13/c5)-11
+.define c3 = -c0-4*2*c3*c15
+mov #c12+3, r2
+hlt
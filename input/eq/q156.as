@@ -0,0 +1,83 @@
+.fill 3, 4
+prn #-0
+L0: .fill 4, -2-5*1
+.define c14 = 13
+.define c7 = c14*4+19*c14+12*c14+(c14)
+L1: mov L0[-20+c7], r2
+mov L0[5], r2
+.entry c14
+L2: prn #c7
+.define c1 = c7*7-2-8-1
+L3: mov #9-1-6/c14*(15*0), r3
+.data c1/17*c7/c7+1, (7/15/c14), 12*c7/(11)-0+17*c1
+L4: .data -c14-c7+--3, -c7, 6, c14-c1*c7-(-c1)
+prn #7
+.define c1 = 5 + c14/X9 + 15
+mov #c14*-(6), r5
+L5: mov #c14/6+(4)/c1, r1
+mov #-c1/c14+c14, r2
+.data 14, c1, c1, 4/((5))
+prn #c7/c1+-c1/20*14*10
+.data c14, 4, 8, nope
+.fill 1, 17
+.entry c1
+mov #(c1)*(5)*c1, r2
+mov #c1*-5*5, r2
+mov #-c1*c7-10+2+c14, r2
+.define c10 = --c1-4
+.data c1
+L6: mov #4, r2
+L7: mov L7[((4)/c14)], r2
+L8: .data -c1*19+(c10)+4, 3, c1+c1*12*c1-5-0/c7, ((12+c1))
+L9: mov #(c1-c1)*c7, r2
+.define c6 = -6/c1+9
+L10: mov #12/2+13*12, r1
+mov #c7-c14-c6*17, r5
+mov #c7, r7
+.define c2 = ((2))*(c6)/-c7
+.data c1*c1+(c7)-(c2*3), c1, c7/1/6-c10-c10, c1
+.define c14 = c1
+cmp #-19/11-15-c7, L10[c10+(0)+c1]
+.data -c2/13*c7+c2, c2, 4--3/19, ((4)-c6-c1)
+mov #c14/-8+15-X9-c1, r1
+.fill 2, (19)*15*18/13
+L11: mov #((c1)+c10), r2
+.data -c1/nope-c7-(c2+14), c14, 13
+L12: mov #10/3*19+7/c2, r0
+L13: .data 0, c1/((c6)), --19, ((15)/c7)
+.define c13 = 17
+mov L8[(c1)], r2
+cmp #c13+-c10+c14, L1[-c1+c1/c1*10]
+L14: mov #L0, r3
+mov L6[12/-c1-15], r2
+L15: .data 13, c1, --20-5
+.entry c13
+L16: .data (c7), c1, -c13
+L17: mov #-(c10)/19-10, r7
+mov #-15*6+c14*1-c2, r6
+L18: mov L12[-(-15)], r2
+.define c8 = -9/12-13*18*10-c6-13
+mov #-c8*7-c1, r4
+.data 17
+.data -c14, c6
+mov #c6+8*c1+16, r0
+mov #L0, r7
+mov L8[-18+c7/(c1)], r2
+L19: mov L17[3], r2
+L20: cmp #c14/-1-c7, L15[-c8-c10+c8]
+.data c1, c13, 3, c6
+L21: mov #17-c10/c1/c10-17, r4
+.data c1
+.define c7 = -c10/12*c1 + 19
+L22: .data c1-17
+.data (5)/L0+3*(4)/18-c1, c7
+L23: .fill 2, -19
+.define c13 = 15/11 + 18
+cmp #11, L20[c13/1-1-c7--7+-c1]
+mov #c1+12*-5*3, r2
+cmp #(c6+16)+8, L20[--c2-8]
+mov #c8, r6
+mov #c13, r3
+.data 9+3-c7/8, (c13+15+18), c13, 19
+prn #c14
+hlt
@@ -0,0 +1,99 @@
+L0: mov #10, r2
+.define c3 = 12
+prn #--7/(3)
+L1: .data 13+c3*4*c3, 19/9*(2)+-4+c3, 13
+.define c10 = 20 + (19)
+L2: prn #-6*c3*c10*c3
+.data 7, -(c3-18), ((-4))
+mov #16+c10-2-c10, r0
+.data -c3/c3+12-5+c10*c3, c10
+.data c3, c10*c3+6/(X9)--9, c10-(c10)-(c10), c10*-c3+15+20-9
+.entry c10
+.data c10-c3-2/c3-0, (3)*c10-c3
+.define c6 = 10
+mov #c6, r7
+mov L1[((c3))], r2
+.define c13 = c6
+cmp #2, L1[c3]
+mov L1[(14)], r2
+L3: prn #11*9
+.define c3 = (-c6/8-c13)
+mov L1[-5*9*c3-c3], r2
+L4: .fill 1, -6
+L5: .data 9, (10)*(c6)
+.define c6 = c6
+L6: prn #nope*4+c6-c6+c3+15
+mov L6[7], r2
+L7: prn #14-c6*4
+prn #19
+.data 2, 16-19/19/6/18, c3, c6
+cmp #14, L0[c3]
+prn #-17+c3+(16)
+mov L6[c3/-c10], r2
+.entry c6
+L8: .data 4, c3, 6+c13-c13/7-1, (0+17)*(c6)+5-c6
+mov #c3, r7
+mov #c3, r7
+.entry c6
+.define c10 = nope
+mov #3, r6
+L9: cmp #(c10)*c10*4+12, L2[(c13*c10-c13)]
+mov #-17+4/15*(c10), r4
+mov #c10, r3
+mov #c6, r0
+.data 14-12+c6*c3*7, (1-c10)
+.define c5 = (((c3)))
+mov L5[8], r2
+mov #5/0/16-4-c5+c13, r0
+prn #c13
+.data 3-12*1+nope/-c10, 5, (c6)
+mov #-4*9-c5-1/19, r4
+mov #7+14/--20, r0
+.define c6 = 15*c13*c5 + c10 + c5
+mov #--c6, r3
+.define c12 = --7+--6
+.entry c6
+.entry c12
+.define c4 = 0
+L10: mov L8[16], r2
+.data c6-c13*c4, (c3)+10*c12+7*c5, 5, (c6)
+mov L10[15/-18+18], r2
+mov #c3, r3
+L11: mov #-9-c12/c3/-19, r4
+.define c6 = c3-(c3)*8+11
+.data 10, L0
+mov L2[-c3/c10], r2
+.define c5 = -5
+mov #c5*17, r0
+L12: cmp #-(13)+19*6, L1[c12+4-c6-c3]
+.define c12 = c10
+.define c10 = 5*8+c6/(c6)
+L13: .data -c6-2, c12+4+(c10)/-c10-7, (1)*19/19*c3, -(18)
+prn #(15)/c3-14-c10-c5
+.define c11 = 14-3/c12/c12*9-10
+L14: mov #16, r6
+prn #20-(c5)
+.data 5
+L15: prn #(11/20)+c6
+L16: .data 14/c3-c5+(c12), c3--(2), -13-3+17
+.data 19, (c5)+(13)*(5)
+L17: .data -c3, 9
+L18: .data c3/-3/nope
+.entry c3
+cmp #13, L4[3]
+mov L14[2], r2
+mov L11[c13], r2
+L19: mov L14[c6], r2
+.define c12 = c3*((c6))
+L20: mov L17[-c13], r2
+L21: .fill 4, -14/c10-18+c12
+cmp #(11-c10)/3+c5*10, L15[(-c10/(1))]
+mov #14+11/c6/18-c4, r3
+.data -(19)*(8), c6
+mov #-7, r4
+mov #c12-c13/c4, r4
+.define c3 = 14 + 14*19*(11)
+mov L5[(0+11*c4)], r2
+.data 12/-7-(c10), -(16)*11+3, c10+6-c5/c10+(c10)
+.define c5 = c6
+hlt
@@ -0,0 +1,108 @@
+L0: prn #19+(17*1)
+mov #1, r7
+L1: mov #-7*17+17-4, r4
+.data 4-2-1*(10), 16, 11-2/20/14/11+2
+mov L1[17/7+2/-13+17], r2
+mov #17+5, r1
+mov L0[12+6/19+20], r2
+.define c4 = --15-9
+prn #c4+12*c4/-20
+mov #c4, r4
+L2: mov #c4, r1
+L3: mov L1[c4], r2
+.define c13 = -c4-(c4)+19
+.data c4*-4*10
+.data -(c13-c13), --c13-c13
+mov L2[c13], r2
+L4: mov #(c4+c13)-c13*c13/1, r4
+L5: mov L5[c13], r2
+prn #c4-1/c13*17*c4
+L6: mov #-c13, r0
+mov L3[(c13)], r2
+.define c4 = (c4*-c13)
+.entry c13
+.define c1 = 14--c13/13
+.fill 4, 20/c4*10/(c13)
+L7: mov #2*c1/16+c4, r5
+.fill 1, 2
+L8: mov L4[18], r2
+mov #4, r5
+L9: mov #c13-13, r4
+prn #0
+.define c8 = 12*c4 + 9*20-17-15 + 3
+L10: .data -16/c13*1+c1
+.data c1*6, (c8/13-20-c4), c4*(4)/19/9/c1
+.entry c4
+L11: mov L8[-c13*c8-10], r2
+.define c15 = -nope + 10-20-6
+.define c6 = c8
+.define c12 = c4
+cmp #nope, L6[c4]
+mov #-c13*c12+2*c8, r0
+.data c6, 6, (13), ((c13))-15
+mov L4[c13-19+4*11-c6], r2
+.define c8 = 15-c13/13*c15*c6-17
+L12: mov #15, r5
+L13: mov L7[c8], r2
+.define c3 = ((c1))
+.define c5 = 15
+.entry c8
+.define c11 = c13
+.entry c5
+.define c10 = c12
+mov L9[-c3/c1*19+c6], r2
+L14: .data c4
+mov L1[(c4-12+c1)], r2
+L15: mov #5, r2
+.data (c1+c1+5-c3)
+prn #(c11)
+mov #4, r5
+L16: .data ((0)/0-14), c4*(c15*20), 3, c8*c4*(X9)+c13+8
+mov L7[8], r2
+L17: .data c4, 16, -5*(20), (-c15)+(c6*c13)
+mov L6[16*0-c10-c12/4], r2
+.define c14 = -14 + 2 + 15 + 4
+.fill 2, 6
+.data -c8*c3-12, c15, c4
+.data c8+6-18-3+-c11, 6, (-c10), 7
+mov #3, r3
+.define c14 = 5*c3 + 18-L0 + (8*c13)
+.define c0 = -c3
+L18: mov #(-6-c10-c14), r2
+L19: mov #(c8/-13), r6
+mov L4[c8], r2
+.define c0 = 19/1
+L20: mov #-(c11)+18+c8, r6
+L21: .fill 3, c10/4+3-9-c10+18*7
+.entry c4
+L22: mov #12, r3
+prn #10+16/c14-c11
+prn #-c3
+.define c2 = c10
+.define c13 = -c4*c10/c4
+.define c0 = -c3/c6+L0+4*c13/12
+mov L17[(c3-c0)+c1*c5*7+4], r2
+mov L21[(c5+8-1/11)], r2
+L23: mov #-c0/(14-2), r4
+mov #-(15)/c4+c12*17/1, r6
+L24: mov #10+0-19*c13, r5
+L25: mov #-10, r6
+.data c12+20*c11-19-c8, 18, 9
+mov #c8*c13, r7
+mov #-c0*14-c11, r2
+mov L22[c0*c8*4--c0], r2
+.define c5 = 4*c3-(c14)
+.fill 2, 4--c8*c2
+.data 7, 3, (-13)+(-19)
+L26: mov #19+c15+5-8/4-(c5), r5
+L27: mov L4[6], r2
+mov L15[(5-13)], r2
+.data 0-3+13+c6+c13+17/15, 14-6/3*14+c13+20+8, c13/c13
+.data --c14/6, 0, (19-6*c13-20), c8
+.data c13/10, (c10/c0), c11*0-c8+c13*7/c14, 20*16/c5--c4
+.data 8--c12, 3, c13+c11/c0/20*c4/12, -1+16*c1
+L28: .data c4, (c1)*18+c15*-(1), ((c0)-c5), c0/9-13-c3+c15
+mov #c4-c14-c4-c13, r1
+L29: mov #(7/c0)+20*13+-c12, r3
+.define c3 = 9-11 + c14--c0
+hlt
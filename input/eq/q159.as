@@ -0,0 +1,71 @@
+.define c6 = -6 + (8)/-7
+L0: mov #c6--(c6), r0
+.define c5 = 11 + c6 + 15 + -14
+.define c11 = -c6/c5-c5-6+8
+mov L0[19], r2
+.define c13 = -(c11)*c6
+cmp #--14*14, L0[-11]
+.define c6 = c13+-(12)
+mov #(20)*c13+13/c5/-6, r7
+.data (-c5-12), 15, c11
+L1: cmp #-12+-c13, L1[c6-4*c5*c5--c5]
+L2: .data 7, c13/20
+.define c2 = c6-c5+4/9/3
+prn #4
+mov L2[c11], r2
+L3: mov #11*c5*17/5+13-13--8, r3
+L4: mov L0[7+8+15/18/-(c6)], r2
+.fill 1, c6-8-12
+.data c11, c6
+mov L2[15/c5], r2
+mov L0[(c6*9)+11+8*17+16], r2
+.define c1 = -c6
+mov L3[-c13], r2
+prn #-c11+5-3+c11+17*c13
+cmp #(16)/5, L2[-c6]
+prn #0/(c11)
+L5: mov #7/16+14-c6/-c13, r0
+.data 16
+.define c9 = c6
+L6: .fill 2, -6
+prn #-c6
+.define c15 = 18/15/c6/c13
+L7: mov #c2/c9+4*c2/c15, r5
+.data -(0)-c6+16, 6, 4, 10/c13
+mov L2[-(c2)*13], r2
+.define c5 = -c6/c13 + 16
+L8: prn #(-c2)
+mov #16, r3
+cmp #c6, L6[-(9)-(15*5)]
+mov #-c9+6*6-6, r5
+.data c15-c1*c2*c1, 9*19+c1/11-c15-c11, 19*0/c11+c15
+.define c2 = c5
+.define c1 = -(c6-c2)
+.define c14 = (4+12-4)
+.define c10 = -20 + 8 + 16*2*c5
+.data (13)+c2+-(c9), c6*-c9*1/c13-1+nope, 1, c1+c15
+.fill 1, c2
+mov L3[(2+5+2)], r2
+cmp #0, L4[(8)+-7-(13-c5)]
+.define c4 = 8
+.data 12-c1*(1)-(17-c10), 20/6*c14-c5-13, c15, (c11)*c11-16+c2+11
+.define c5 = c1
+.data 7
+L9: .data -7, c2/(c13), 10, 16
+.define c12 = 17
+prn #c5
+mov #2, r1
+.define c3 = (9)
+mov #c11*c3--2, r1
+mov L2[(c14/7)*c11+5*12], r2
+.define c13 = c15*c3*c1+-c1+11
+.define c6 = 1*c11*-10 + c2 + 10*13 + 7
+mov #-(c5), r0
+.data c4, 12-11*c1*c1-c13, (8)*9*-20/c1*5
+.define c14 = -12/c12*c1-c5
+mov L1[c14/-6+c10], r2
+.data -c6
+prn #c13+-6
+.define c6 = c13
+.data -(15)+c2, 18+c14*c14*c2-12, c6, 14+c5+18+5/c5/5+3
+hlt
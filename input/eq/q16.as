@@ -0,0 +1,67 @@
+L0: mov #0, r6
+cmp #7, L0[10]
+mov #-20*-2+9+19*4, r2
+L1: prn #2
+mov L1[4], r2
+.data 15, (12/4)+(3+15), 0+-17/2, -3
+L2: mov L1[20], r2
+L3: mov #14-13+4, r7
+L4: mov #6, r6
+mov #4+(12)+(3), r6
+L5: .fill 2, -(13)
+.data (14+15*7)
+mov #20, r1
+mov L3[15], r2
+L6: mov L2[0+14/2], r2
+L7: mov #-20+20, r0
+.define c0 = 11-0*14-15-20
+prn #(4)--c0-3
+mov #19/4, r3
+.data c0, c0, c0/3, c0/4+9*c0/5
+mov #c0*20, r0
+.define c1 = 5/5*c0/2/8
+mov L1[17], r2
+.define c2 = c1
+.define c3 = 11/2
+.define c4 = -c3/5/4
+.fill 1, c0--10--c1+c1
+prn #20
+mov #19, r2
+.define c5 = c0*c2--c0/3
+prn #-c4
+.define c6 = c5
+.data c5*1/3+c5+c4/17, (c4)/4-20+-c1
+mov L2[2], r2
+mov L6[7], r2
+mov #-(16-c2), r4
+mov #(c5), r5
+.define c7 = (1)+c4*c1*c4/5*c4/10
+.data 9, 11*c7/5-(-c4), (c0)
+.data 11/3, -13, 11, -c2
+.data (c0), -c7*c7-(c0), 2
+.data (c6)
+L8: .data 20
+L9: mov #c6, r6
+.define c8 = 0-c0
+.data 6
+.define c9 = 18
+.define c10 = 0
+mov L8[6], r2
+L10: mov L9[10*(0)-(14)], r2
+L11: .fill 3, 12--c6
+.define c11 = 15-c9/3-c5-0/1
+.data -c11*(c11)+c4, c10
+mov #6, r3
+mov #-6-11-c2, r1
+mov #(14*14)*(-11), r7
+L12: mov L12[(c6)--0+c0-3], r2
+L13: mov #(7*c4)-c6+c5-13*10, r7
+L14: mov #--19*2, r7
+L15: mov #(-c8+12), r2
+L16: mov #c0-8-c7/16, r1
+.define c12 = -c6-c9 + (4)
+L17: mov L0[2-16/1], r2
+mov #15, r6
+L18: prn #15
+prn #-c8*c3+c0/4
+hlt
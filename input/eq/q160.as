@@ -0,0 +1,36 @@
+mov #-9*16/7-8, r3
+.define c9 = 2
+.define c0 = -c9
+L0: mov #5, r4
+L1: mov #(16+c0)+-20*c9, r0
+.define c3 = c9 + 8-(c0)--1/c0
+prn #-c0
+mov #(6), r0
+mov L0[12], r2
+L2: cmp #c9*7--4, L1[c3*19*(c0)/c3/c3/c9]
+.data -12*c9-c9*c3-c0, (5-(c0)), c0
+mov #(6/c9)-2, r3
+.data c9
+mov L0[c9], r2
+cmp #-c9/c0/c0/c9*15-c9, L1[2]
+.define c5 = 6-c9*c9*4*-c3+8
+mov L1[13/c5/c9], r2
+mov #(11)--c9*13*10+-c5, r0
+.data (c9)*3-13/-18
+.define c8 = c9*c3
+mov #(-c0+0), r3
+mov #c3, r1
+L3: cmp #c9, L2[13]
+L4: mov L2[(c8)*14], r2
+mov #c5*2-18+14-c0/c0, r5
+L5: mov #(c9)*c5, r6
+mov L0[c0+c0/18+(19)], r2
+.define c12 = c0-6/c3-c5
+.define c1 = --c3+c9
+.define c2 = 16/9*c1*13
+.define c13 = 20-12*c12 + c12-c3
+.define c13 = -(9)-c1
+.define c7 = c2*19-c3/c1
+L6: .data -c5*10, c1+c13+16*c12, 4+c3+c2+c7*19
+L7: mov #11, r7
+hlt
@@ -0,0 +1,87 @@
+L0: .data 15, (15), -18/15+7/14+6*20, 2
+L1: .data 8
+L2: cmp #nope*10, L2[--4+-18]
+.define c8 = ((-6))
+.entry c8
+mov #(17*12)/(c8)+20*0, r1
+mov #c8*--0, r5
+mov #14, r7
+.define c15 = 7/0-c8-20*(L0)*(c8)
+mov #-(-7), r1
+mov #c8, r2
+mov #c15, r0
+mov L2[-18+8/0], r2
+mov #(11)*c8*c15*18, r2
+mov L2[c8/0*c15/7*15-19], r2
+mov L1[16], r2
+L3: mov L3[-c8*20*6*c8+c8-c15], r2
+.data c15, (X9+c15+c15), c8+-c15*c15
+mov #c15, r1
+.data 15, (19/c8-15), 1*11/9*1*c8/c15
+mov #-8/5+-5, r2
+.define c5 = 1-c8 + c15/-20
+L4: mov #5, r0
+.define c10 = 16-5/c8
+L5: .data 4
+L6: mov L3[-(c8)/c15-c15], r2
+cmp #-(c5), L6[c8]
+mov L5[c8], r2
+.define c6 = c5
+.fill 2, (c10)
+.define c10 = -9/c15/c6 + -c6
+.data -17*c10+13, 1
+.data (c10-2/c6)
+mov L0[c6], r2
+prn #19*15*c8
+L7: mov L0[c8], r2
+prn #20-17*-6+-c5/0*6
+.data -4
+.data c15/c10/-X9/c10
+mov L0[(c15)], r2
+mov L4[c15/c10/c6+-c5], r2
+.define c10 = 10/(c6)/20+c10
+L8: mov #-c5-c15*c15+14*12, r7
+mov #-16+13*(c10), r0
+.data 3, 13
+L9: mov #-c8/-c10, r3
+mov L8[6], r2
+L10: mov #7/c10*(20)*c10+c10, r7
+L11: mov #(6*c5/c8), r5
+.define c6 = (10/c10) + c10
+.data (15), 2-c10*1+(12)+c6
+cmp #8, L7[8]
+.define c5 = 4
+mov L8[-c10*7-c10/15], r2
+.define c4 = c10 + 11-(1)/20
+.define c8 = 0/c10-(16)/c10-c5*c10/13
+prn #-7/(c8)
+.data c6/8*c10*0/c10, -c8*c10*14, c10-10/12/c10+-12
+mov L8[(20)/9+10/(c8)], r2
+mov #-c8, r0
+L12: mov #3, r7
+mov L0[10], r2
+L13: .fill 4, c4-c5
+L14: mov #c10, r1
+.define c6 = c15
+L15: cmp #((c8+2)), L10[17+10-c10*17]
+L16: .data c5*c10/c10+c10+8, 8+15-(9)-c10, c10, (c6)--c5*-16/0*c8
+mov #(18+c10+c4), r6
+mov #c5-10+15+c6, r3
+mov #8, r0
+mov L9[(c4)], r2
+mov #13-16+c8+6, r5
+prn #c4-0*c8
+prn #-c6
+mov L0[-((17))], r2
+.define c11 = 20*13+-c5*c15
+mov #-19, r7
+prn #c8/c10
+mov #c8+c10*17*c8+15, r7
+.define c1 = c10
+L17: mov L4[c6/10], r2
+mov L2[-c10*c1/17-16*3], r2
+L18: .data c5
+mov L9[3-9/11-4/c10-14-c5], r2
+.define c8 = c4-18-c6-c8/9
+.data 7-c5, c8, c11
+hlt
@@ -0,0 +1,27 @@
+mov #20/(17*nope), r4
+.define c1 = (X9*20)-(8)-6+8
+.define c9 = c1-c1/8+c1/(10-12)
+.entry c9
+.define c14 = 19
+L0: .fill 2, (c14*0+-c1)
+L1: mov #--9+c9, r6
+mov L1[3], r2
+.data c1-17+c1+--c9, c9, (c9*17+c9*1), 0+15-14-c1
+.define c1 = (17)-c9
+.data 1, c9, (c14), -c1
+L2: prn #9
+mov #(c9)-12*c9/7, r4
+.data c1, c9
+.define c5 = 8
+L3: mov L3[(c1)], r2
+L4: .fill 4, c5*(c1)+9
+.fill 4, (c1/-15)
+.define c13 = (0+c1+c1-c5)
+L5: mov #((0))*(c5)-9+13, r2
+mov #(-2)+c14, r0
+prn #c14-14+c14+c5
+.data -15, c14, 10
+.define c7 = (8)*((2))
+mov #-8/c14-c1, r4
+prn #c14/c9-c1+c7*c1+-6
+hlt
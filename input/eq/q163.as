@@ -0,0 +1,90 @@
+mov #9, r3
+.data 2, -2
+L0: mov #5*17*0/20/4, r2
+.define c0 = 19*16+1/4*15+11-11
+.define c15 = c0
+cmp #1/c15-(2-c0), L0[8+11---20]
+.data -c15-3-16, (17)--c15*c0/8+c15, c0
+mov L0[10/c15*10/-10], r2
+mov #(c0), r1
+L1: .fill 4, c0
+.data c0/7/9+c0, (c0+4*c0), c0
+.data -c0, 8, ((c15))+-11-9+18
+mov L1[(c15*16+12)], r2
+.entry c0
+L2: mov #c0, r5
+L3: mov L1[12], r2
+.data -(c0)/-X9, c0
+mov L2[c0], r2
+mov L3[c0], r2
+.entry c15
+mov #1, r7
+.data 9, 19*c15-c15-(15), 11
+.data (12-9), -15-16/15*c15
+mov #(-5), r1
+mov #(c15)+7, r0
+.define c9 = c0
+.define c8 = c15-8-11+2-10+14+20
+mov #-13, r1
+cmp #c8+c15-c15-c8, L3[5]
+L4: mov L3[(0)*c0/c9/11], r2
+.define c7 = c0 + 0/c9
+L5: .fill 3, 7+0*-0-c15+c0/0-c0
+mov #2, r2
+.define c2 = 12-(19)*4*9
+.data c0, 1
+mov L3[-13*L0-17*6/12/c9], r2
+cmp #-11/-c7+c0*0, L4[c9]
+L6: cmp #9+c8*c15*c2-12, L3[(9)/c8+6*11]
+mov L1[(8)-1-c2-19+c7*9-c0], r2
+L7: mov #-c7*c2+-8*(c8), r1
+mov L0[(c15)/-c0+((0))], r2
+mov #c7, r0
+L8: .data c0, -18-c7*(c9)-10*c7, 0*-c9/18, c2
+.define c12 = c7+19/c0-8/12*3
+.fill 3, ((c15))+-c15/6/c2
+.fill 3, 7
+mov #17-c0+c2/3, r1
+.fill 2, 17/c2
+.define c8 = 7*-17+c8
+L9: mov #3/c15-c15/4, r1
+.fill 2, c8*c2/c7*-(13)
+L10: prn #c12
+.fill 3, (c8)
+.define c13 = -11-c12/c8/c8
+.define c0 = c2 + c8*c9/c13
+mov #(10-c7/c8), r1
+L11: mov #18-(9)+4, r4
+mov #-12+-c8, r0
+L12: prn #-c0+c9-(c8)*(17)
+mov L3[16/-c13+(c15)], r2
+L13: mov #c12, r3
+.define c2 = c7/4*3*c9/-c12-1
+.fill 4, 12
+.define c8 = -(c9)/c12
+L14: mov #7*0*18-(c12)-c12, r5
+.fill 4, -10
+.data -19-4/c8, (13+2)/13
+L15: mov #13, r4
+.define c7 = c7+12*c15+c7+16+9
+.define c10 = 15*20
+cmp #(c10*0)-c0, L13[4]
+prn #19
+mov #(1)-c0*15+c10, r2
+L16: .data 1
+L17: mov #8, r7
+L18: mov L9[2], r2
+cmp #c8-18, L1[c8+9-16+17+16/c0/0]
+mov #(c8/c9+3), r7
+.fill 4, (19)
+L19: .data c9, 9*--c7
+.define c15 = c2
+L20: .data (4-c0+c15+9), c8
+mov L18[-c2], r2
+.fill 2, 3
+mov L15[4-c12], r2
+.entry c9
+.define c1 = 10+3*6*c0+20-c8
+.fill 2, c0
+.define c2 = --c12*c0/c15/-c2
+hlt
@@ -0,0 +1,33 @@
+prn #12
+.define c0 = 2-20
+L0: mov L0[6+c0], r2
+prn #6
+mov #-10*c0/c0, r1
+.fill 3, -c0
+.data c0, 19*c0
+L1: mov #15, r2
+.entry c0
+mov L1[c0-(20)*((12))], r2
+.fill 4, c0+14-0*(10)
+.data 10, c0*1, c0, c0/19/9-c0/c0
+mov #c0, r3
+L2: .data c0*3*(X9)+c0-c0
+mov #c0-5*6/c0*c0+1/13, r3
+.fill 3, 13/16*c0*10-(c0*c0)
+.define c8 = nope/20+0
+L3: prn #-14*3-c8/c0
+L4: prn #--3--c0
+.fill 2, c0+10
+.data (c8)*c8/c0*c8, --12*8, 14*14+4+(7)
+.define c9 = 7
+mov #c0, r2
+prn #19
+.data ((2/1))
+mov #6*18*c9/18/8-(8), r3
+.data c0/0+(10)/1, c9/12/8+17+--c9, c8+c9+X9-(c9), (20)
+.fill 4, -10+(11)
+mov L0[c8*c9+14/(c8/4)], r2
+mov L3[c0], r2
+L5: mov L1[c9-c9/c0-15], r2
+mov #-10/20/c9, r1
+hlt
@@ -0,0 +1,23 @@
+.define c13 = 5
+.entry c13
+L0: mov L0[c13-6-c13+13/c13], r2
+.data c13, 12*10-17+c13, (7+c13-1+10)
+L1: mov L0[13/7+2+c13*-7-c13/4], r2
+L2: .data (14)
+mov L2[(c13-c13)*(c13)], r2
+L3: mov #-c13/19+(12), r0
+.data 17/c13+7*c13, (c13)/2/c13-6, 2, (2)/c13/17+c13
+prn #c13*c13
+mov L1[(15-c13)-c13], r2
+.entry c13
+.define c14 = c13+3*c13+c13+c13+c13*c13
+L4: mov #c14*nope*c13/4, r5
+L5: .data -X9, -3, 3, 10
+.data c13+-15+8, (-15), c13, c13
+.define c2 = (c14)
+.data 14--11-(c13*c14), 10*c2/(8)*-18/14/4
+.define c15 = 5*11-18 + nope
+.define c10 = ((2))
+mov #9, r2
+.define c5 = c13*0
+hlt
@@ -0,0 +1,43 @@
+mov #15, r5
+.data 20*3+20/14*16-19/8, 10*17*19+(-16)
+.data 3/14-(5)-0, (3), (14/14+7-10), 17
+L0: prn #-15-(9)
+.define c9 = 11-4*2 + 1/10/15
+.data 8-c9/c9-X9
+mov #-c9*11+c9, r4
+L1: mov #c9/(c9)+14+c9--X9, r4
+.data c9*12-c9+c9*3, 8+9+5+17-4+1/12, -10/1
+.data 18*(c9)-9, 3*6*17+c9*c9-(c9)
+L2: mov L0[15], r2
+.define c8 = c9
+mov L1[1-3+c9*(c9)], r2
+L3: mov #11, r6
+.fill 1, 4
+mov #c8+(c9)-5, r4
+.entry c9
+mov #-16+c8*20+c9-19/c9, r0
+mov L0[c8], r2
+mov #14, r5
+L4: mov L2[9/c9], r2
+L5: .fill 1, 1+c8+10+(c9/c9)
+mov #c8, r3
+.entry c9
+mov #c9+c8*c9/2, r2
+.define c11 = -15*c8
+prn #(14)+2+c9-c9
+.fill 1, c9/15+11/8
+L6: .data ((c11))-9, 10+0+c8-c9, (c9)*c9*c9--17*-c11, -0/c8-(7)*19*10
+prn #c11
+mov L0[9-c8+19/19], r2
+L7: mov #-16, r3
+.fill 2, L0+15*c8*12
+.data 3, 20, -c11
+.define c1 = (-13-(c9))
+L8: prn #20
+L9: prn #(-7-19)
+L10: mov #(c8)*c9*12*1+c9, r3
+.data 18*c9/20-(12)
+mov #13/(1), r1
+mov #(c11/c1+20/5), r6
+mov #12+3/c1*c1*X9/(1), r2
+hlt
@@ -0,0 +1,50 @@
+prn #-13+3+15
+.define c9 = 2
+mov #20, r5
+.entry c9
+.define c0 = ((10))-(c9)*c9-2
+.define c7 = 9*c9
+mov #1*-c9*c0-12-c7, r7
+.entry c0
+prn #c7
+L0: mov L0[16+c7/c0+c0---10], r2
+mov L0[-(c7-c9)], r2
+mov L0[(-(0))], r2
+mov L0[c7-c7+-c7*0], r2
+cmp #c9, L0[--9-c9/c9/1]
+L1: .data c9/c0/8+4/(15)-c9, c9*14+c9/10+19, c0
+mov #16*c0*20+c0/(9-11), r0
+mov #c7/(c9)*c9*7, r5
+L2: mov #5, r5
+.data -2*c9/c9/(16/c9)
+mov #(5), r2
+L3: mov #-8, r2
+.define c2 = c9
+mov L1[(c9)*8*5/10*c9], r2
+L4: .data 3, -20-c9*19+c2-18, -(c2)*(c7), 7
+L5: mov #c2, r0
+.entry c9
+.fill 2, (11+12)/(c7)-(c0)
+.define c14 = 1 + c7-c0*15-15*9 + c0
+cmp #17, L2[(1+c0*11/5)]
+.data 1, 0, 18-c2-6+X9/11+-6, 7
+L6: mov #c2, r7
+.data 20, 2
+L7: mov L4[(c2)], r2
+prn #-c0/c14-c9
+mov L5[(14)-c9*-13+c0+15], r2
+.entry c2
+L8: .data (13), -c0*c9*-c2+15, 17-c7+-6, 14-c14
+.data c9
+mov #-c2-(8), r1
+mov #1, r3
+.define c7 = c2
+.define c0 = -c0*19
+L9: prn #(18/6+8-14)
+mov #-4*c0/11-c7, r2
+L10: mov L5[(-3--9)], r2
+mov #13, r5
+.data 13*c2*5/-c0, -c0*19+c7+-c0, c7+14-13/(18), 10
+.define c10 = -(20)/11+11
+mov L10[(c2-c14/17)], r2
+hlt
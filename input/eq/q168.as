@@ -0,0 +1,116 @@
+.define c5 = 17
+.entry c5
+.define c13 = c5*-c5/14
+.data 17+-c5-c13+c13, c5, 12+17-c5, c5
+.data -c13+c13*c13
+.define c9 = 16-c13-1
+.data 5+c9-10*1, -c13+16*c9, c13+(c5-8)
+.fill 3, c5/-16*c9
+.entry c13
+.define c4 = 15
+.entry c4
+.entry c9
+.define c1 = 10 + -c5 + c9-c5
+L0: .data c1, -2*c5+19/c9
+mov L0[c5], r2
+mov #c1, r4
+mov #-(15)+c4*17, r0
+.define c9 = ((c4))
+mov L0[17*c5+-c4-c9], r2
+L1: mov #---5, r4
+.fill 3, 9+-7
+.fill 3, c5
+L2: mov L2[15/4], r2
+L3: mov #c9*c5-16+c13+0-c9, r4
+mov L3[19], r2
+L4: mov L0[c5], r2
+.define c13 = 14
+mov #-8-c13*6-c5*11, r3
+.data c13, c9
+.entry c4
+.data 1-19*13*c13+12-2*19, 15, -7/c5*11/c9, -c1/c5-9/(17)/19
+mov #0, r4
+mov #c13, r5
+mov L4[1], r2
+L5: mov L5[20], r2
+mov L0[-(10)*c1*c13], r2
+L6: mov L6[(c9)], r2
+.data (5)*7, 8, c5*5+c4/12/c9-c5, 1/14/c5-c13-3*0-4
+mov L4[14], r2
+mov #(13*c13*c5), r5
+.fill 1, c9
+prn #8/18+9-c4/(c5)
+L7: prn #--6
+mov L6[(-(c13))], r2
+mov L6[10--c9+c9], r2
+.entry c13
+.define c14 = -c9 + c4/c5-14
+.define c9 = c14+c9*0
+.data c13, 16
+mov #(c5)*6+2+(10)-c13, r4
+.data c4, 12*3
+L8: .data c4, 14+18
+mov #-c13, r3
+mov #12, r4
+L9: .fill 3, ((5+5))
+.fill 2, -5*13-0
+mov L2[(9)], r2
+cmp #3, L3[c9/16*8-11+1-4*10]
+.entry c9
+.define c15 = (c1 + c1 + 2)
+.entry c14
+mov #--10--c5/10/c5, r0
+.define c13 = 3*(3/c4)
+.define c5 = c13/X9*0*(c9-18)
+.data c9+20+8/19*4-c5+c9, 11
+.define c0 = nope
+mov #8, r1
+L10: .data 16, c9, -c1+c5, (c9+c1)*c9
+L11: mov #c5--0/c5, r3
+.define c2 = 16/2*0
+.entry c13
+.define c4 = 8
+.fill 3, c9*c9
+mov #5, r1
+.fill 1, 1
+mov #16, r7
+mov #c2+3*c13*4/c5, r2
+L12: prn #c4+c9/17/15/7*c13
+mov L12[4], r2
+mov #c0, r1
+.entry c4
+L13: .data -c1*9-c4, c2
+.define c13 = 1
+.data 6, -4+(3)-c13
+.data c9+c9/c5*14/c15
+.define c7 = -7
+prn #2
+.data -4, 7
+L14: cmp #11*6*c9+12+(c13-0), L5[(c0*c9*0)]
+L15: mov #-8/(c14)*c9/13, r2
+.define c0 = c13/c2*8+20-6
+.data -1
+.define c3 = c0/(18)+17
+.define c10 = c5*-c0*c15
+mov #2/11-(c5)*9, r4
+.define c14 = 11
+.data c1, (c2), -c9+c5*-8*-3, c13
+.data c4+0*5+(18)+10+1, 4*(12+c9), c13, c13
+.define c7 = 17
+L16: .data c4/(16/4), c1, 6/c1-19-(c4-8)
+mov #(c13), r0
+mov #6+10, r4
+L17: .data c4, 16
+L18: .data 13, (c5)/14
+.define c0 = 10
+prn #(16*15)-c13+-14
+mov #-2/19/(10), r0
+L19: mov #c0/c13*7+-c4, r5
+L20: mov #c7, r5
+L21: mov #(c7)/15, r1
+.data -13-12+-18-(c13)
+.define c9 = nope
+mov #6, r2
+.define c15 = -c3*10*c7-0
+.define c3 = -20*19/c15
+hlt
@@ -0,0 +1,53 @@
+L0: mov #(10)*7*(0), r4
+mov #1, r7
+cmp #14+18+19-9*(11), L0[L0+14*8/17-1]
+mov #3+-18*10, r5
+L1: .data 2/13/3/2, 13*18*18/16*((11))
+L2: mov L1[(8+11/(5))], r2
+mov #17, r3
+.define c12 = 1 + 12 + 3*-13-12*20
+.data 1, -11*15-12+14, c12, c12/7--2+c12+11
+prn #5*(10/16)
+.fill 4, 7*c12-c12-c12/(7)
+.define c0 = c12*9*4*18*c12
+.data 14-c0*c12/(18/16), (16+c12)-c0+9/1, c0, c12+(c12)+c0
+mov L0[12-c12-c12+15], r2
+mov L2[-c12+c0-3], r2
+.define c11 = -(c12)*c0
+.define c2 = (14)
+mov L2[c2], r2
+mov L2[((-13))], r2
+.define c11 = c12
+mov L1[c12/0/c12-17+17], r2
+.define c6 = c12-(c12)/c11 + c2
+prn #7
+.data (c0/c6)-c11, ((c2-14)), (c2), c11
+L3: mov L3[13-c12], r2
+.data c11*13/17--6-(11), 6, -19-3, (14+17)
+mov L0[0+-c12/c2], r2
+L4: mov #-c2, r7
+.fill 2, c11-c2/c0+3/c6+3
+mov L4[c11/c11], r2
+.define c14 = -c12/c0/6
+prn #-(5)
+.define c9 = c6
+.fill 1, -c6
+.define c12 = 0 + c11 + 6-c2*17
+mov L2[-16-16/c14], r2
+cmp #(11), L4[c11]
+prn #3
+.data c11/5*1*14, 12+c9
+mov L3[c0-13--c2/19], r2
+.fill 1, c11/c2-14-16/9-2
+.define c9 = -(2)-c0*20
+L5: cmp #(c12/3/c9+4), L4[13]
+L6: .data 11+c9+8+c9-2/c11
+.define c1 = --4
+mov #13, r1
+cmp #-20, L4[-(6)*c2*16*4/c12]
+.define c9 = -c9*c2*c14*13*(4)
+.define c10 = -5*c12-c14/9
+mov #-c2, r5
+L7: .data 8, 6, 13
+.entry c10
+hlt
@@ -0,0 +1,87 @@
+.fill 3, 17
+L0: mov #12, r6
+.data 6/17, 17, 13--20
+.define c0 = (0*15-11/10)
+.data 17*c0, --8-c0
+L1: .data 15, 4--15, (10-9/4)
+.define c1 = 8
+L2: .fill 1, c1-18
+mov #c1, r1
+prn #c0
+prn #7/18
+mov #17---16, r2
+.fill 2, --c0/4
+.define c2 = -1/1-8/1+c1+7
+cmp #c0, L1[-c0/4]
+mov #c1/2-9-10*c1, r7
+mov L1[-c2/1], r2
+L3: .data c1, -8/20*-16, c1
+mov L2[((c0))*(c2-c2)], r2
+L4: mov L1[11-12], r2
+mov L4[((c1-c1))], r2
+.data --c0, ((c0/15))
+.define c3 = c0+c2*17*c2*(c2)
+.define c4 = (-c3/3)
+L5: mov #--c0+c2*3/1, r7
+.define c5 = 12/5/2
+L6: mov L2[11+c0*(c2-16)], r2
+mov L0[18/4*8-c4+10], r2
+.define c6 = -14/3/1
+.define c7 = c4
+.data 8, 19--c2-c1, 9-10+c5/5, 1*(c5)/13
+.define c8 = -c7*15+-c1
+mov #((8)-10+c4), r4
+.define c9 = (20/4)
+prn #0*18+-c9-c1
+.data 7, 17-c9*c0+c8*19, c8/2
+prn #17
+mov #c3+(3)*(c6), r2
+mov #c8*5-c6/4, r5
+.data -18*(c2), 4+c0-6*c7
+L7: .data -10/1+c2*c5, 18/2/5
+.define c10 = 7*20*15 + 10/4
+.define c11 = (3)
+.define c12 = -c10 + 9-5*6
+mov #c1-c12+c0*20, r4
+mov #(c8)*17, r6
+prn #-2-4+c11*c12
+L8: prn #c8
+.data 8+c6/2--17+c7, -c3
+mov #(5*6), r4
+L9: mov #14*c10, r4
+L10: prn #8/2
+mov #19/3-2--c1/4, r4
+.data -16*-c10, 3, -c8+(17)
+.fill 1, 9-5+c10+(c11)
+.define c13 = c6 + ((9))
+mov L6[c1/4], r2
+.define c14 = 15
+.define c15 = -13/4
+mov #-(c11)+(6)*2*c15, r3
+.define c16 = 1
+.define c17 = (c8)+c4+7-12
+mov #-c17, r4
+mov #(c5)/5/5, r6
+L11: .data 8, -c8, c9*c5-9+c11/2, (c11)
+L12: mov L2[-6-15+c2*11*c11+c16], r2
+L13: mov L10[5], r2
+mov #11, r1
+.data 11, c15, -(c3)*(c7)
+prn #17
+mov L0[c4], r2
+.define c18 = 0
+mov L6[-7], r2
+mov #c10/3--2+(19)/3, r5
+cmp #7, L3[0+6-(c12)+(c7/4)]
+mov #c8, r7
+mov L0[19-1], r2
+mov L1[c4], r2
+.define c19 = -c5
+mov #c14, r7
+L14: mov #c14-14, r6
+L15: mov L4[(17+4/1)], r2
+cmp #(12+5/4), L5[c2-c12+8-9/2]
+mov #---7, r2
+mov #-(c1), r2
+mov L10[(c2)+2-5+5+c3], r2
+hlt
@@ -0,0 +1,121 @@
+.data -3, 12, 1+11+16*0+18-14
+.define c5 = 9-7
+L0: prn #10+c5+4+(c5)
+mov #1, r5
+.entry c5
+mov #c5, r4
+L1: mov #13, r3
+.define c10 = (c5)+c5/c5-4
+.define c0 = c10
+.define c1 = -15--c0/c5
+mov #4, r3
+L2: mov #20, r2
+cmp #-c0, L0[c10*2/19*9/c1*c0]
+.define c13 = c5/7*7/-c5*c5
+.define c5 = 12-c0*(c5)/(10)
+L3: mov #c0/c13-2/13-0, r7
+.define c10 = c10
+L4: mov #c5, r7
+.data 4-nope+1+5, c10, -c10*c13*c0+11+(20)
+.define c14 = -c0 + c5 + c10
+L5: mov L2[11], r2
+.define c6 = -c13--c14/16*0
+mov L4[c10+15], r2
+L6: .fill 3, c1
+mov L0[13], r2
+mov L2[(15)+c10], r2
+.define c2 = c13*3
+L7: .data 4/c1-11/1, -c6
+mov L0[-c5*-11], r2
+mov #15, r0
+L8: mov #c10+(c6)+c13/c0, r7
+.define c4 = (c2)/3 + 3 + (18*0)
+L9: mov #c14, r7
+mov #-18-c5+c4-c6, r3
+.define c2 = c13
+mov L4[c2*c2], r2
+mov #--13*-c5+c10, r6
+mov L7[6], r2
+mov #c5, r2
+.define c8 = 1*-c5/-16
+L10: .data c6-(c6)+c14-18
+mov L2[((c6-c2))], r2
+.define c1 = c13*c5+13/c6-4
+.define c15 = c2*10-c5/c6/1/c4-c5
+cmp #c10*(6+X9), L6[c4-14*6-(11/c2)]
+.data c15+c4/(1)*10, c13
+.entry c13
+mov #11, r1
+.data c5, -c5-10/15/c1, 11, (4/c15*c13)
+L11: mov L9[-c2*6+c1*11+c1-c6], r2
+.data 6, (c1/4-c5), 14
+.define c12 = 15
+L12: prn #c8/9+c2-11/11/1/c5
+L13: mov #c5, r5
+.data (1/-3), 14, 19*16/-15*15, c1+c8/6-8
+.define c8 = 16
+.data (9)-c2-c8+c6, 20-c4
+L14: .data c4-14*c14*X9/c5/-7, c2, 5-c10, (c2+2/13)
+mov #c10-12-(7)-15, r4
+L15: .data c8, c13
+.entry c10
+L16: mov L3[12], r2
+L17: mov #3, r3
+L18: .fill 3, 9+(c1)-c5*c8+4
+L19: .data 20/(c2)/c5
+mov L7[9*c8/c0*c6+c2*-15], r2
+.define c7 = -14/c1/c2
+prn #9
+mov #6-9, r1
+L20: mov L0[3*c8-c10+-14], r2
+L21: mov #c7, r5
+.define c9 = (18-12)+((c12))
+mov #6, r6
+.data c8, c1
+mov L15[7], r2
+.entry c9
+.define c5 = c13
+L22: .data -c1/c5-c12, c10, -c1+c8+(c6)
+.define c14 = c12
+.define c7 = (6+c10*c10)
+.data 20, 11, -15
+.define c13 = 2/2
+.define c10 = 0
+.define c14 = 1-c9+8-8+c15-c14+(c0)
+mov #c10, r2
+mov #9, r1
+.define c11 = 14
+mov L8[c14/0*c1+10], r2
+.data c5, -6+12--c10, ((3)*c6-c6)
+prn #--(17)
+mov #c6-c8, r3
+prn #(c2+c7*-6)
+cmp #c10, L10[(0)-17]
+.define c14 = --17/11/c1*-c2
+L23: mov #10, r1
+L24: .data c13
+mov #(11*16*19), r6
+.data -0
+mov L21[4], r2
+L25: prn #c11/5-10-4
+mov #(c2/3)+(12), r4
+mov L25[(0)+-c14*c7], r2
+mov L9[(c10)/c14-c8/c8], r2
+.entry c1
+prn #c10-c0/9-c1-14
+mov L21[(c2)], r2
+.data (9)/(17), c7, c10, (c8*c5)*10-0*c4+c11
+.define c5 = 14-c8/8-(11-c0)
+mov L4[19], r2
+L26: mov L26[c2+c14/(c14)+6+-5], r2
+.data 11+7*18*c14/3, 12
+mov #c14+18, r3
+mov L23[c5], r2
+L27: mov #(-c10*19*c14), r7
+L28: mov L27[18], r2
+mov #20, r6
+.define c14 = 19*c12*20 + c14-c14
+L29: .data (c1), -c13--c11-0-0*c8+1
+L30: .fill 1, c0
+mov #16, r7
+hlt
@@ -0,0 +1,121 @@
+prn #(20-1/7-5)
+.data 17-13/1+7/15, 17+14+1+20/0-(15), (-(nope)), 16
+L0: .data (4), 18+3-14/19, 7
+mov L0[3], r2
+mov #-6, r5
+mov #(L0)-3/14+14, r1
+.data 20+10/15*5-15
+L1: mov #0/13*4*7+15, r3
+.data 13*2+20*13, 16
+.data 2--6-3/5, --0+2
+.data -(4)
+L2: prn #19+6+10*5+-4
+L3: .data 13, -10*1*19*4/18, 13, 11
+prn #-16-nope*14
+prn #18
+mov #(7)*17*1-19-0-11, r4
+.define c6 = -18*0/20
+.fill 2, 13
+prn #2
+.data (9/c6)*(0)-3, (c6-3)*17/c6*5, c6
+mov #8--17+-c6+c6*10, r5
+mov #(c6)/c6-2*11+18, r6
+mov #c6, r4
+mov L1[c6], r2
+mov L3[c6+12], r2
+.define c11 = 3-8*14*c6
+mov #3, r2
+L4: mov #11/-13*(c11)/c6, r7
+mov #14-c6+c11+18, r4
+.define c13 = 1
+cmp #(c11*13+c13-c11), L1[13+-c11]
+.define c15 = c6
+.data -c6, (10-c6), 9
+.define c15 = c15/c15/c6+c13
+.define c2 = X9-15/15*c15/1
+mov #c15-(13)/c6+9, r2
+L5: prn #c6/14-X9/c2
+L6: .data (c15/c11+2/10), c13
+prn #1
+mov #5, r3
+.define c3 = c13
+.define c6 = (c13)
+L7: .fill 3, 8
+.define c15 = 13-5 + 17 + c15 + c13*c6
+mov #2/(-7), r6
+mov L1[9+2+(c3)+15], r2
+mov #11, r7
+mov #c2, r0
+.data 9, -(3-c11), 11/7+c2/7*14
+L8: .data 9/-c11/(11), (c15), (c15)
+L9: cmp #c15, L0[7]
+.define c10 = ((c15) + c13 + c15)
+L10: mov L3[14], r2
+L11: mov L5[(c6/7+c11/c2)], r2
+.fill 1, c6
+.define c10 = (6/19*c15)
+mov #c6, r6
+L12: mov L6[--(6)], r2
+prn #5
+.define c15 = (16+9)*14-15+c10+c6
+mov L11[6], r2
+.define c10 = (-c3/2)
+L13: .fill 1, c10
+L14: prn #12/c2-c6+c10*-c15
+.define c11 = c6
+mov L13[nope/c15/5/c6/-10], r2
+.define c10 = c13*c11
+.entry c15
+.data 8/c3*c6-17*0, c15*-4-17, -c6-c15*-c11*18, 6
+.define c9 = c11-9
+L15: .fill 1, c11
+mov #-c6+c9-c13/0*-18, r7
+.define c13 = c10
+cmp #-7+c10-3-15, L10[((c15)-12)]
+prn #c6
+.define c13 = -c15-5+c15
+L16: prn #-9/c2*18+c6/c15*14
+.define c1 = -c10 + c6*c11
+.fill 4, 0-c11+-c6
+.entry c2
+.define c14 = c15+17-14*c9
+.data 13/6+c14+17*c9, 2
+L17: prn #c3
+mov L17[c6/c15*c6*c10+-10], r2
+.define c8 = -7-5-c10
+mov #14+-17, r1
+mov #c13-c3+c11*-8, r4
+.define c1 = -9 + 11/1 + -c11*19*c10
+prn #8*c15-c10*1
+.data 13-c13+c1-11+13/c10, c8, c6
+L18: .data -13-c11/nope/15, -c6-8+c10
+mov #c15+11+c2+c1, r6
+mov L6[15-c9], r2
+mov #-0+2+c8*-9+(14), r1
+.data 2, -c10*c9*c1*c13-(18), (c9+c2)-(0)+c10*1
+L19: cmp #c15*c13/8, L12[c1+(6)+8*16]
+mov #5, r6
+.data (2/11)+(c1), 14, -1*(c10)*8, 6
+L20: cmp #((17)*(c15)), L2[2-3-c13/nope]
+.fill 3, 20-(c15)
+mov L19[9], r2
+L21: mov #(16)*10/(c10*c6), r0
+mov #c1-18*c15/4, r0
+L22: mov #3, r3
+.entry c13
+.define c10 = (c15*c15) + 18-11*17
+.define c6 = -4*c1---13
+L23: mov L7[5+c10], r2
+mov L19[c1*10], r2
+mov #-(12)-(12), r2
+.define c3 = 5
+cmp #13/5, L22[c15]
+.define c0 = -(c15)/c3
+.fill 1, -(7)+c2
+mov #3+(9), r7
+mov #c10/(5)*-c15/c15, r3
+.data c2/c15, c10
+mov #c15, r1
+mov L20[(15-9)], r2
+.entry c10
+hlt
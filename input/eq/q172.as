@@ -0,0 +1,66 @@
+.define c11 = (13)/((1))
+mov #(13/12)*-20, r7
+mov #(0/c11/c11), r5
+.entry c11
+.data c11
+mov #c11-(9), r6
+L0: mov L0[c11], r2
+L1: mov #10*c11/c11, r2
+.define c8 = (c11)*9
+mov #-c11-c8*8/18, r5
+.fill 4, -c11-12+12
+.data c11, 7-12, (((c11)))
+cmp #c11*5, L0[-14/c8/9-17]
+mov #-c8-c8/-0, r7
+mov #(-11*c11), r3
+.fill 4, -7/c8*-7
+L2: .data 14, c8, 3
+cmp #c11, L1[-18/6/4]
+L3: prn #c8-18-11*4-3+7+c11
+L4: prn #c8/9-(4)+4
+.data 1*c11-c11*c8+c8
+prn #5-17
+.fill 4, 9
+.fill 2, ((c8))*(18/12)
+.define c4 = (((2)))
+.data c11, 2, -(c8)/5+c11, -c8
+.data (14)
+.define c3 = c8
+.fill 4, c3/c4+c11-3
+L5: mov #12, r3
+mov #c8/1+9, r3
+L6: .data -3-6--c8, 11-c8--11+16, ((5*c4))
+L7: mov #7+c3+20+-9, r1
+L8: prn #(-c4)
+L9: .data 10, 14/c8
+.entry c11
+L10: .data (c8/c4)--c8, -(20)*0+20, c8-c4*--c8
+prn #c3*8-c3-0
+.define c9 = 1 + 16*c11/10
+L11: mov #1, r3
+.data c11-(c8)/c9, -c8
+.data 12*c4/c3/c3*(c4), c3, c8, c11+(14)-c9
+mov L5[(-c9+c4)], r2
+L12: mov L4[16], r2
+L13: .data c3+c9*9/c8*13*c4, -(c8)-(0), 2, c4
+.define c11 = c4
+L14: mov L2[c9/c11], r2
+L15: mov #c9+4, r4
+L16: .data c4, (20/15+c3), c4
+L17: mov #6, r5
+L18: .data c8/-14
+.define c14 = 15
+L19: mov #X9+10, r4
+mov #(15), r4
+mov L18[14+(4+c14)], r2
+mov L6[c11], r2
+prn #c14*c11*16-5
+cmp #c4-c9-c11-c11, L17[c8/(c9)]
+L20: mov #c3*c9+c8+12*c8, r1
+.data (-c3/2), -c14/c3+6/c14, 8
+.fill 3, (15)*9+c3*nope
+L21: mov #7*19*c14/c3, r5
+.define c1 = -15*13*10*13*c3+c4
+.define c1 = --6+c4-c1-11+c9
+mov L21[17], r2
+hlt
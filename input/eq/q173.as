@@ -0,0 +1,62 @@
+mov #(nope-18)*4-(0), r5
+.data -0, 13-(19)
+.define c11 = 13*17/15 + 3/3
+.data 0*14*X9-16
+L0: .data (15)/c11, ((c11)-c11+7), c11-c11+c11+c11, 11/18/c11*c11/1
+L1: .data --c11-c11, c11*c11/c11-c11+11, (nope)
+.entry c11
+.define c12 = 2
+cmp #L0, L0[c12]
+.define c3 = c12*c12
+.define c5 = (7/c12)-9*c12/2
+.data c12/((15)), (19*8+9)
+.define c5 = -c12+2/11
+.data X9/(c5*10), (17*9)*4
+.define c3 = c5+c12+15
+mov #8+c5/-3*11, r5
+L2: .data (c5)*16/6
+mov #17, r4
+L3: mov L3[8], r2
+.data 16+19-c11+c12/7, c3/c5/1-c11-c12, (-c3)*(c12+c12)
+L4: mov #c11*c3/c11/c12, r7
+.fill 1, (c12+c5)*20
+cmp #c11+5-8-c12/(5), L4[-c3*2]
+.data -c5/-(16)
+mov #12, r2
+L5: mov L5[11], r2
+mov #c3+4, r5
+L6: .data c5, 0
+mov L3[(c5)], r2
+mov #c12, r2
+L7: mov #(14-19/2), r7
+.define c8 = 19
+L8: prn #(-c3*c3)
+cmp #(2+X9)+18, L2[2]
+prn #c12*11*c3*c3
+mov #(6/nope/c11), r1
+.data 3+4+c3+c5-c8-7-7, -4
+.fill 3, c5
+mov #-c3+-6, r4
+L9: .data 1*(2), -X9, c3+8*(4)
+L10: mov L2[c11], r2
+L11: .data 15, (c12), c3
+.entry c3
+.data c11, c11, c8
+.data -18-c3/15+c12+3-c8, (c8/(6)), c5, -c3*19*2
+cmp #-7/2*2, L0[-c3+-11+(c5)*12]
+mov #--2+c3, r0
+.define c12 = c3
+.define c0 = -c8*nope-2*(c8)
+L12: cmp #c5, L2[c0*c8-c11*17/(-c3)]
+mov #c5, r5
+.data 8, --c3*15, 10, c8
+prn #(11)
+mov #12*1-18-c12/(c11), r2
+.fill 4, c3*13+15*19
+prn #c12+c5*14/4/-10
+.fill 2, 20+(c3)/6/c0
+L13: cmp #2-c12*c5/6--11+(10), L9[17+19/c12+-c12]
+mov #-(2), r3
+mov #-(13+c3), r2
+.define c13 = 15
+hlt
@@ -0,0 +1,21 @@
+L0: .fill 3, 3
+cmp #-15+5*1+1+3*14, L0[14]
+.define c7 = 4
+mov #-c7/13-2, r6
+L1: mov L0[(-c7*1)], r2
+mov L0[(c7)], r2
+cmp #15, L1[c7]
+.data c7, 19, c7, c7
+.data c7, 14, -X9-c7/(c7)
+.define c15 = -c7 + 7*18
+L2: .data c15--6*c15
+.fill 3, c15+c7*15+1
+mov L2[2-10*6], r2
+mov #-1+18-1, r2
+.entry c7
+.data (4)
+L3: .fill 4, 12
+mov L1[c15], r2
+mov L1[c15], r2
+mov #-3, r1
+hlt
@@ -0,0 +1,77 @@
+.data 11/3-(11)+(17/19), 11
+prn #-18*4+2
+mov #6+1--18/19, r6
+mov #10*10-13, r6
+.data (8)+4+15+8, 9, -17+3/9-11*(14)
+.data 7, -12+4
+.define c10 = (3)-12-nope*-(10)
+mov #18+-12*6, r6
+L0: mov L0[(4)-c10/8+17], r2
+mov #(5*c10+5), r1
+prn #8
+L1: mov L1[7], r2
+prn #c10+c10/12/-0/(c10)
+.data 11, 4, (c10-4)/(10/15), 6
+L2: .data -c10+3+c10*c10+c10, c10+18*4-c10, 12, 3
+.fill 4, 12-c10/c10-5
+mov L0[c10], r2
+.data c10*c10, (c10)/10/11/c10
+mov #c10, r7
+.data 0, 0, ((7+c10)), 1
+mov L1[c10/c10*5+c10], r2
+L3: .data -(c10)+-c10
+L4: mov #((15)), r6
+cmp #3+c10, L3[5*(16)-16*c10+-3]
+.data c10*5-17/-0
+.define c11 = 16 + c10*-c10-c10-16 + c10-20
+mov #c10, r3
+.define c5 = (c11)
+mov #c10, r7
+.data 0, -5/c10/c11, c11, -6*c5/3/9+13+c5
+mov #(c11-(2)), r0
+.fill 3, c11
+.data c10*0/c10+c11/14, 9, c5, 19/c10*12/c11*20
+.fill 3, 14
+mov #(15)-c10+0+c5+19, r5
+.define c3 = -5 + c10
+.define c0 = -c5/c10 + c10
+L5: .data c3, -c10*7
+prn #c5
+L6: mov #(c11+0)-1/-9, r1
+.data c3*-c0+c3-c5*8, -c0, c3+c0/12/-c5-14+c3
+L7: .data 2, c5--2/12, 10/-5*c3, (c11)
+.data c10*(c0)-18, -(20*18), c0-16-c5/-3+7, c10+13+c0*17
+.entry c0
+cmp #(c10*c5-c5), L4[13]
+.define c15 = -3/7*c10-c11
+L8: mov #-15-c15*10, r5
+.fill 1, 9
+.define c9 = -c10
+mov L0[8*c5-c5+c15+c5+c5], r2
+L9: mov L2[3-(c0)-(20)], r2
+.define c3 = c0
+.define c11 = c3 + c5/c11 + 7*c3
+.data 2, c0, 7
+L10: cmp #(c10), L9[-c3]
+prn #c15*18/c3/14*13
+L11: mov #L0, r0
+.data (c11/c11)--c11-c0, -c0/c15+13, (8)+c15+(c15-11)
+mov L10[20], r2
+.data 2, 16-7, 19
+L12: mov #(8-5-20*4), r0
+.data 12-c3-c9+c0, c3/c11*c3+c3, 1
+.define c13 = (--c11)
+.define c0 = --9/c3
+mov #2-17-6-c3-c11, r0
+L13: .fill 4, -c11/12/17/c3
+.fill 1, (c5-c5-c9+16)
+.define c2 = (11)--(c11)
+L14: mov L5[0], r2
+mov #20+c0*-11, r6
+prn #(c3)
+L15: .fill 2, c2+c10+c3/3+-c15*c0
+.define c7 = 9
+L16: .data c0-0*c3-20/c11, c13, c7-c10*6*8*c9*3/c13, c3/c11+12
+L17: mov L12[c10+8+(7)-c0], r2
+mov L6[c10], r2
+hlt
@@ -0,0 +1,24 @@
+.define c3 = 10 + 14 + 20/15*10/9
+.define c14 = --c3/c3
+mov #c3, r4
+L0: prn #(19)
+mov #c14-c3, r7
+L1: .data c3-1+c14, -c14*14--c3, 1*8
+L2: mov L0[2], r2
+L3: mov L3[c3], r2
+L4: .data (4-1+(X9)), 6
+.data c3-c14*16+c3+1-c14, c3, 1*12+9*-c14-19
+mov #c3/(c14), r5
+mov L0[c14/-0--c3*12], r2
+mov #c3-18-c3--c3, r0
+mov #(c14), r7
+mov #c3, r7
+L5: mov #c14, r1
+mov #2+c14+17-5, r1
+L6: mov L5[17-17-c14-c14], r2
+mov L5[15*c3*11*13-c3], r2
+.define c11 = -4 + -(c14)
+.define c12 = (c11*c3/c11-c3)
+.entry c11
+L7: mov #(-6*c11), r4
+hlt
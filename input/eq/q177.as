@@ -0,0 +1,48 @@
+mov #3*12*11*3/20, r3
+L0: mov L0[6-18*X9*11], r2
+.define c10 = (-0+0*14)
+prn #1*c10*7*-(8)
+.data 12, 0, -c10/c10
+mov #(12-X9)*c10-0/c10-4, r7
+L1: .data 5
+.define c1 = (-20+c10)
+mov L0[c1*c1], r2
+.data c10+3
+cmp #(0+4+6-c1), L1[c10+c1/c1/-13+8+c1]
+mov L1[(14)/18/c1--0], r2
+.define c8 = 17-10*1/c10+1*12
+mov L1[c8], r2
+.fill 3, 7+-c1/17
+.entry c8
+mov L0[1], r2
+L2: mov L1[c8], r2
+.define c13 = -13*c1/2/c8/5-c8
+L3: mov L2[0*c13/-c1-18*16-6], r2
+mov #(17+c13)+-c1, r0
+L4: .data -6+c13-c13*13, 7*c8+(2)
+mov #-c8*c1/c1*c13, r2
+.entry c13
+.define c14 = c1 + 11/(7)-c10*c8-4*c1
+L5: mov L2[-c14], r2
+L6: cmp #-c10, L0[c8*-c13]
+.define c15 = c14
+.define c3 = c15/15-c15/8
+L7: mov #c13, r2
+.data 20/20-c14*17, c8*(c10)-(c1), (c8)/20
+L8: mov #-(6)-c13/c14, r3
+.define c0 = ((c15/7))
+.define c9 = 9
+L9: .data c3, 1, c13, c0
+mov #-(4*c10), r6
+.define c0 = c15
+mov #-c0, r3
+.data -c13*c10, c8/c8*7+c15-c0, c14, 10/c9/(11)+17
+.fill 3, c13-1/4/(L0)
+mov L9[20*(-c10)], r2
+.define c0 = 18*c8*14/4
+.data -c10-5-c0/7*14, (15), (14+c1)-c0
+.define c3 = 14
+.entry c0
+mov L4[5], r2
+mov #17, r4
+hlt
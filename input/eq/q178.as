@@ -0,0 +1,35 @@
+prn #2/3*(16)/8-7
+.define c13 = 11*8+5*18*6*17+3
+L0: mov #1*c13/10/(c13*c13), r2
+.data -c13/c13-0
+.data 11+-5-2, 3/-c13-c13
+mov L0[18], r2
+L1: mov #c13+c13, r5
+L2: prn #c13/c13-c13/0
+.data 14-c13/c13+nope-20
+L3: cmp #-c13-c13*5, L3[c13]
+mov L0[c13*c13/c13-7*c13], r2
+.fill 3, (c13)--13*c13
+.define c2 = c13
+mov L1[10], r2
+.data c13/20*5/c13, 5, -18/c2+(0)
+.data 8, c2-c13-c2+18*--c2, -20/10*8
+prn #c2-3+c2/c2
+.define c9 = 14*c2*18 + 12 + c13-c13 + nope*c13
+prn #-c13
+mov #-0-7, r4
+.define c10 = 19/19 + -20--20-c13
+.define c7 = 9
+.data c9, 12, 8, 3
+mov L3[-(14)*(c13)], r2
+L4: .data -4/15+6+7-c9-c9
+.entry c9
+mov #(0)+2/c9/c2+6*17, r3
+mov L3[((c10*7))], r2
+L5: .data X9*6+c9-c7, 0
+.data X9, c13/c9-c7*c13/4-2
+.fill 1, 11
+mov L4[(17*c10)/-nope+c7], r2
+L6: mov #3, r5
+.data -4+11*(13)*c2/4
+hlt
@@ -0,0 +1,46 @@
+.define c9 = (8)
+L0: mov #c9--5, r7
+.define c1 = (4)/5/c9+c9*c9/2
+.entry c9
+.define c4 = 3*c1-1-c9-18
+.data -(c4*5)
+.define c0 = --14-c4
+L1: prn #c1-c9/5-c4-c4
+.data 14, (c9-c1*c1+c9), 13, c9/c1/c9--16
+.define c12 = -c9 + 19
+cmp #-(c4)-c9, L1[c9]
+mov #--0*(c0), r7
+.data c12/1-nope-c0, -0/(-c9), 5/c1+c12+1
+L2: cmp #(13), L0[c9]
+.define c3 = -19 + 16
+L3: prn #-c4/c9/-c0/(6)
+mov #c0*(8/7), r4
+L4: mov #c4, r2
+mov #5*c12+-c9-c12*c9, r1
+mov L4[(-c4-6-1)], r2
+prn #9/c12*c0+(c0)
+L5: mov #c3/7/5-5-10/c9, r5
+.define c3 = c3-c4 + 7*7/(c9)
+mov #((c4))+9/c0--3, r2
+.entry c9
+.fill 1, 17*9--10/-12*c1
+L6: .data c3-2-18-(c3)
+.data c9
+L7: mov L0[c3], r2
+L8: mov #-(c0/c12), r1
+L9: mov #9, r4
+.define c1 = (-c12/c3)
+.define c14 = 14
+.define c14 = 12/c3*13 + 15 + 16/0/c4-4
+L10: mov #15, r7
+.data ((5*0)), c4+-19-c14, -c0
+.define c14 = (5)
+prn #(c14+5*8)
+L11: cmp #14, L5[0]
+.define c0 = (c14+7)-(c14)
+.define c13 = (c0-10/c3*9)
+mov #2/(c3), r2
+mov #(c14)*-19+c14, r4
+.define c3 = -c1 + c13-c3
+prn #(c3)
+hlt
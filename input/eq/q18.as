@@ -0,0 +1,44 @@
+.define c0 = 15
+.define c1 = c0-c0-c0-10
+.fill 4, 18*13*5*4
+.define c2 = -2/16*17/4
+L0: mov L0[11], r2
+.define c3 = 11/4*c2/3/1
+mov L0[c0*0-c3-c2-c2], r2
+mov #c2, r2
+mov #10, r4
+mov L0[20*2+c3], r2
+mov #c2/2, r0
+L1: prn #c3*c1
+mov #(c3-9*6/9), r1
+mov L0[((c2)/15)], r2
+L2: .fill 4, -c0*-8*4*2
+L3: cmp #-(6), L1[-c2*c2--c1+c2]
+.data ((c1)+c1), (11), 13/11/2, (c2)/5+(13*6)
+mov #-10-c3-c0, r2
+L4: mov #c3-0-17-2/3, r1
+mov #(c2)-(19)/1, r2
+.define c4 = c3-10+13-(12)*c2+0
+.data (5+c2)*15+-c3, 6/3, (-15+0), c3
+L5: mov #13-c0-c1-13*c4*17, r2
+mov #8*17*17/4+c3, r0
+mov L1[c1], r2
+L6: mov L6[c2], r2
+.data c3*c4+17+c1/3, 3*c0/17*c0, c4, c0
+.define c5 = 11
+mov #-c0/1/4, r5
+.data 14, (c4/1+c0-0), c5, --c0+c2-c1
+mov #c4+c3, r5
+L7: cmp #9*c0, L0[---4]
+.data c2, -c3
+L8: .fill 1, c3+c5
+mov #13, r0
+mov #c4-c1+c5-17, r5
+L9: .data c2*13*9-15*6, c2, 13/5/5-3
+.define c6 = c0-c1*6/4-16+c1-3
+mov L0[2], r2
+mov #9, r4
+.fill 4, -14+c2/4
+L10: mov #c1, r3
+L11: mov #9, r6
+hlt
@@ -0,0 +1,39 @@
+.define c8 = 7
+.define c0 = c8
+mov #c0+c8, r6
+.fill 1, 1
+.entry c8
+L0: prn #13
+L1: .data 9*c0/-(9), -c0*16/20, c0*(c8)+c8-c8, -nope+12--c0
+mov #c8+c8/11*-c8, r4
+.data 20/1*20/c8
+mov #-10/0-c0/c0+c0*c8, r4
+.data 18, -1+c8/c8*(7*c8)
+.define c7 = 10
+L2: .data -c8/11*14*-c7-9*c8
+mov #9, r3
+.define c10 = c8 + 4 + 1
+L3: mov #c7*c8, r3
+mov #13+2/c7*8*19/-6, r2
+.define c10 = 7/-13+c0
+L4: .fill 4, 2
+L5: mov #-c8/c10*9+14, r2
+.define c9 = c10
+mov #c10+-1, r1
+.define c15 = 20-c7+c0*17+c8
+mov #17*c8-16*0*c10*11, r5
+.define c0 = -c0/-c8--4--2
+mov #c8, r7
+.entry c8
+mov #c7+c0+c8+17/c7, r7
+.define c11 = (--c9)
+.define c6 = -17-19+2+19
+mov #c15-(-c10), r0
+.fill 4, 8
+L6: prn #(c7)*-11+(c8)
+mov L6[19*c11-3/1], r2
+.define c0 = -c11*c10/c10 + 14 + 14/c7
+mov L5[-c11-20*c15], r2
+.define c15 = -8*c8-c15
+mov #15/c11+(10)-4, r7
+hlt
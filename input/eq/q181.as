@@ -0,0 +1,95 @@
+L0: mov #-6*-12-1*7, r0
+mov #1/8+10-17/4/20, r6
+.data 18+17+2*7, -16
+mov #(2)-14+5/10-2, r7
+.define c8 = -17/8+16*10-18
+.define c7 = -((c8))
+mov #18+c8+2/c7, r7
+.define c10 = ((11)*c7/0)
+.data (c7)/3/8+12*8+9, (11-17)--c10+6, --19-13
+.data 20*9-12/c8
+mov #-c10, r3
+mov #18/c7-c8-c8, r7
+.define c11 = 8
+.define c8 = 2/18/8*c7+c7
+L1: .data (10*c7*c11), 2, c10
+mov #20/8+c8*c8, r3
+L2: mov #--c11/c11+15-16*c8, r3
+cmp #(-1), L1[6]
+L3: .data c11*11
+mov L1[((7)*c10-5)], r2
+.define c3 = c8
+cmp #-20, L2[3]
+mov L2[(10/c7+c8)], r2
+L4: prn #15-c7/c8*16+6+c3*6
+L5: prn #-0*c8*13/c8/4
+L6: .fill 1, 11
+.define c7 = -7--c3
+.data -15+c10+14*c8*c7, 0+14/c7*c8
+.define c15 = c3
+L7: mov L2[c3-c15-12*(c8*c15)], r2
+L8: mov #(c10), r6
+L9: .data (17), c11*0+0*c10--14, c15-c10*12*c7-5/c15
+L10: .data 6/14-c7/17
+L11: cmp #-18+16+c10, L0[c11]
+.data 11
+.data L0*6--5, c10, 13
+L12: mov #-c7-c3+20*c8, r3
+prn #3+c10
+.define c14 = c8
+mov #7-c8, r1
+mov L11[c7-2], r2
+.data c8/16--6*16, 1*-c7-16/c11
+.define c7 = 15+c7+c14-0-c11-c7
+L13: mov L12[nope+c3*c14/-1-20], r2
+L14: cmp #-c7+-c7+nope+11, L7[c8]
+L15: prn #(10+c11+6/14)
+.define c0 = c7
+mov #2, r2
+mov #9-c11*c11*c8+12, r0
+mov #c7/-c14+2/3+(c15), r7
+.define c4 = c0
+.define c6 = (0)/c15 + c7 + 7*18 + X9
+L16: mov #-L0+18--(c3), r3
+mov L4[17], r2
+.entry c6
+mov #2*16/14-c15/c6, r0
+mov #(8), r0
+.define c0 = ((1)/c15)
+mov #(-c3)/c7-8-20-c7, r4
+.data 3
+L17: prn #c11-c7/5+18
+mov #c7-14-c7-6, r6
+mov L17[c8+(c7-17)], r2
+.define c5 = 4--10-c0
+prn #c0/c4*6-3-8
+mov #c11, r2
+mov L4[(c8-c0-c14*8)], r2
+mov L17[c10/c5/c8+c6/-c5], r2
+.fill 3, c6+c7-0+13
+.define c0 = 19
+mov #c7, r0
+L18: cmp #c7, L10[(c7)]
+L19: .fill 2, c3*((3))
+.data -17, 8, 14, c0
+L20: mov L17[-c7], r2
+L21: mov L0[12], r2
+prn #12/17
+L22: .data c6+(c14)-19, c0/c3-4*8, 4
+.entry c5
+.define c4 = c0
+.define c0 = c5
+.define c4 = -5 + 16 + 13*c7
+mov #(c4), r7
+mov L1[-20-c8+--c5], r2
+mov L13[c4+c11], r2
+.data 16, 12, ((20+17))
+mov L20[c8], r2
+mov L1[1], r2
+mov #-c15/10-0/c11-c4*c0, r3
+mov L21[7], r2
+mov L18[-c4/c3+(14)], r2
+L23: .data (-(c4)), c0/c15-c10/c3
+.data 2+5-3+c7/c0*1
+L24: mov #c10, r7
+hlt
@@ -0,0 +1,78 @@
+L0: .data -8, 8, 0
+mov L0[(8)/4-6+16-16], r2
+.define c12 = 14/7
+.define c7 = 19 + c12 + 20*15 + c12
+L1: .data c7, c12+c7*8+-c12, c12-c7, c12
+L2: .data 16-12/c7+c7-c7, (20)*15, 4+c7-8/c12
+L3: mov #18, r1
+.define c3 = (c7)/(c7) + c12
+mov L0[c3], r2
+cmp #(-(c7)), L2[(20-20-20)]
+mov L1[c7], r2
+.fill 2, (-18-18*c12)
+.define c12 = 15
+.define c8 = 11
+mov L3[c3], r2
+L4: prn #(c8)-16*13-(c3/c8)
+L5: mov #-17+c12+-c8, r3
+.fill 1, c8
+.define c0 = c3/c8+c8/16/c3
+mov #(14/5*c8), r7
+.fill 3, -c12*c3*(c3+c12)
+.define c14 = c0
+.define c2 = (-16 + c14)
+.define c13 = --c0/c12
+L6: mov L1[(17)], r2
+L7: .data c2+12-14/17+c0
+.entry c0
+L8: mov #17, r2
+.define c12 = 4
+prn #X9/9
+.define c15 = c3-2-(14)
+.data (c2-17--14), 17, 5+c15-15+c2
+L9: mov L9[11], r2
+.define c10 = -c12/(c8) + 0
+mov #9, r0
+.data 10/20-(18), 1, 13+c0*-13, (c14)/3-15+c8
+L10: .data 10
+L11: mov #c14*c10/c7*2*20, r1
+mov #5, r2
+.data -c12/8+--c2, (-10)
+.define c12 = (20)-20 + c3*c15/5/-18
+cmp #c13, L3[2]
+.data -c2+c12+(1)
+.fill 4, 5+c0+c2/c0*c7
+L12: .fill 3, L0
+mov #c10*16, r4
+L13: .data 6
+L14: .data 0, (-2), 10+-c2, -(c13)/20
+.define c10 = --c12
+L15: mov #c7*4+c12-10, r0
+mov #c0/9/c12/-c2*c13, r7
+.define c7 = (((13)))
+.define c12 = (-16*c7)
+prn #-17
+.define c7 = c7*c12
+L16: mov #(c15), r0
+.define c2 = c12-(c7)-0
+prn #--c12/(9)
+prn #8+1*c12/c12+10
+mov #(c8), r3
+.data (9), 16/14-16+-c10, 11, 5
+.define c13 = c12
+mov L13[((-c7))], r2
+prn #c0/c14/c8+0+c3
+L17: mov L4[10-13/c10/((c13))], r2
+.fill 2, (--7)
+.fill 3, 17
+prn #(c7)
+mov #-c12-c13*c12/6+14, r0
+mov #18+c12/c7--c13*c3, r7
+mov L0[14], r2
+L18: mov #(11-c10*(c7)), r7
+.define c10 = 0
+.define c8 = c14/c10*9*12*-c2
+L19: .data -c12-16/6, -(12)+8*c7
+cmp #16+nope, L15[1-c13*3*14]
+mov L10[-19], r2
+hlt
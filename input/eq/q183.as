@@ -0,0 +1,34 @@
+.define c11 = -16
+.define c1 = 7
+L0: prn #13
+.data 1*2/c11*c1/(17)
+L1: mov L0[c1], r2
+mov #(15), r7
+L2: mov #c11---c11, r6
+.define c11 = 15
+L3: mov L3[14+4-4*(c11)], r2
+.define c2 = 7
+.define c15 = c11+(c11)+2-c2
+L4: .data c11, 7, (c1)/8
+.data c11-(18)*(6), 5
+.data c11+(c15)*(c2)-1, c1, 14, ((5)*18*c1)
+.fill 3, 18
+prn #((10))
+.define c2 = c1---c2
+.data 6, c2, c2
+mov L0[c2/16], r2
+L5: mov #3/c1-2, r0
+mov L2[2+c1], r2
+mov L3[(15+3+9)], r2
+L6: .data -(c15/9)
+.entry c11
+L7: mov #c11/17+c1-c11, r1
+mov #c11+c2--c2+0, r2
+prn #7
+.data 6/c11-c11
+.define c11 = -c11/(11)*c2/-17
+mov #L0, r7
+L8: mov #18, r5
+mov #2, r5
+.define c7 = c2
+hlt
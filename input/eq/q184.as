@@ -0,0 +1,56 @@
+.define c10 = --17-20 + 5
+.entry c10
+.entry c10
+.entry c10
+.entry c10
+.entry c10
+mov #-c10-6, r4
+.data 12, ((c10*c10)), (5)/14*c10, 8
+.data -c10+c10+c10--(c10), c10
+L0: .data 15+(c10)*6/2, -12+20*19/14, c10
+L1: .data ---0
+L2: mov #12, r5
+.define c10 = X9
+.data c10, ((c10))/-(c10)
+.entry c10
+mov L0[c10-c10], r2
+mov L0[19], r2
+.define c7 = (5/c10)*c10/c10*-11
+.define c2 = c10*8 + c10 + 13
+mov L2[-c10], r2
+prn #nope/(c7)+c7
+mov L2[c7+12-c10], r2
+mov #9, r1
+.define c6 = 20-c7-19
+cmp #c7*c10+4/c2, L2[19/(15*c7)]
+.define c5 = -c10/c2/3*1
+.define c4 = 19-c7 + c10 + c10
+.define c3 = ((c10+12))
+L3: .data 11, 10*(19)-0
+.define c7 = 12
+.define c12 = 17-c4-3 + 7*5 + -1
+.define c0 = (c4)
+.define c2 = 2/19*c7/13*c7+13+4
+mov L0[c2+7+4*c10*-19], r2
+L4: mov L2[c4-6-c2-c7+10+20], r2
+L5: .data (13), c7-c12-c4/c6/c7, (15-17+11), 13*7*(19)-9
+L6: mov L0[c6], r2
+mov #4, r4
+L7: mov #c2/c2-c5+7*6, r6
+mov #--12+4, r5
+.define c11 = (c7*14)-19 + 12-c12
+.define c13 = (c10/X9*c5)
+L8: .fill 1, (c10)
+mov #(15)/c7-18+-11-c2, r4
+mov #c6/(0+c6), r1
+cmp #c7, L7[9]
+mov #--c7-6, r3
+mov #(5+4*c7/12), r2
+L9: mov #c12, r6
+mov #(c2/c5)--5, r0
+L10: mov L4[c6-9/c7*0], r2
+prn #14
+cmp #-c2+(8)-c2-c0-c11, L3[-15*c11]
+mov #(18*c6/c0+c7), r3
+L11: .data c2*c7-c3+11, 8
+hlt
@@ -0,0 +1,35 @@
+.define c15 = ((7))
+.data 4
+mov #c15, r4
+prn #c15-c15-18
+L0: .data (-12/6), 3
+mov #18*17-5*c15, r0
+prn #0/4+6-1
+L1: mov #15/c15*-L0/(-12), r0
+.define c13 = c15/c15*-10-6-14/-14
+.define c9 = c13-19*c15+(13*15)
+mov #(nope), r0
+L2: prn #(20)
+.data -(c13)-14, (c13)/5
+prn #-c9+1/-c13*9
+.define c11 = 11
+.data c13/(c9*c11), c13, c9, 5
+mov L0[c9-c9], r2
+mov #-20, r2
+.define c13 = c15*c9
+.data -c15, (c11-10)-c13+7/16
+mov L1[1-6-8*18], r2
+L3: prn #c11-nope*9--c11/c13
+L4: prn #c13
+.data --c15/18+6, 19, c11+(-c13), c11
+mov #-c11*20+-19, r4
+L5: cmp #(c13), L3[c11+17/20-c13+-15+8]
+.define c5 = 17
+mov L5[3/(7/8)], r2
+mov #18*-13+c11, r1
+.define c14 = c13-c9/16*12
+L6: mov L6[6], r2
+mov #19, r5
+mov #0, r2
+L7: mov #17, r0
+hlt
@@ -0,0 +1,64 @@
+mov #3/-14+(L0), r5
+L0: mov #3, r2
+L1: .data 13-19*16-13*12-12
+.define c9 = 15--5 + 15
+.define c2 = c9
+.define c1 = 15-2*c2+16
+mov L1[c9-18], r2
+mov #c9/nope, r6
+.define c11 = -8/c2*c9+c2/9/20
+mov L0[10], r2
+mov L0[16/19-15-9+5*c2], r2
+mov L1[15], r2
+.define c1 = c2*c11--17-L0
+L2: .data 0, c1*c1+c9/c1, (12-c2-c9), 16*-12+-c9
+.data c1, 17/10+c11+17
+mov #-c9/11-6/(14), r6
+.define c2 = (9)/14
+L3: prn #c9
+.data (17-c1)/c1, 6*c11*5*6/1, (c9-10+c2), c11-18
+L4: prn #9
+.data 18+nope/15--c2*7/c2, (c1)
+L5: mov #15, r7
+L6: prn #9
+mov L2[((c2+17))], r2
+L7: cmp #c1/c11-c11/c11/2, L4[c9*3--13]
+mov #18-c1, r1
+prn #(c2)
+mov L7[17+18/c1+(c2+c11)], r2
+.define c14 = c2
+L8: cmp #5*7, L4[c1-(c1)*(c2)]
+.define c5 = -c2--c1*(c11*7)
+.define c10 = c2*7*c2/c11
+.entry c2
+L9: mov #(c11), r1
+.define c8 = (16-c1/c14/c1)
+.data 14, 0*14+c1-c14-c1, X9, 5*18*19
+.entry c14
+.fill 1, c2+c1+(c1)+c2*1+c2
+mov L8[11], r2
+mov L6[c8+7+8-2+c2], r2
+mov #c1, r1
+.define c6 = -12+10
+L10: .fill 1, (c1+c9-5*c2)
+.define c7 = 5
+mov #5*16-c2*-2, r2
+mov #-c6*14-c1*-8/c1, r6
+L11: mov #c1, r4
+mov L3[(3)/nope-4*c5-c9], r2
+.define c2 = (13)
+L12: mov #18, r6
+mov #c2/(2/c2), r0
+.define c6 = -8*c1*12
+.define c2 = c1
+mov #6-16, r5
+mov L12[c8+c6+c7-c14-12], r2
+L13: prn #10
+mov L5[c6--7/c2+c2*16-12], r2
+cmp #c8, L9[3]
+.data (c8)/(16)-11+c6, c1, c10
+prn #c2-c7-c1/c2+7
+L14: .data --c9-c1-c2, -10+7*c1+13, 18
+.define c1 = 3
+.fill 2, c9
+hlt
@@ -0,0 +1,65 @@
+prn #18
+mov #(20)/12/11-19*8, r7
+mov #9, r4
+.define c15 = 13
+L0: mov #c15, r4
+.data (c15-c15)/c15, -c15+10+-c15/c15, (13)*c15+c15/7
+L1: .data 3, -14
+.define c15 = c15
+.data c15
+L2: mov L2[17*18-c15+c15], r2
+prn #c15
+mov #c15/-c15-19, r1
+.define c10 = c15-18 + c15 + 8
+.define c8 = (3)--c15
+cmp #(c8+c10-c8), L1[-12]
+.define c6 = (-c15*11)
+.define c14 = (c8)*-c15*18
+L3: mov #c10, r3
+.define c6 = 18
+mov #c6+17*c6/11, r7
+L4: mov #-c10, r7
+L5: .data -c15+c15/(c8), 16-12
+.define c13 = c15
+cmp #c15/c13, L0[(c10)*2*0+-(4)]
+L6: mov L0[(1/c13-5+5)], r2
+.define c12 = -12-11+18
+.define c4 = c15
+mov #-(13)-2, r7
+.define c8 = c13
+L7: mov #c6, r1
+.define c0 = c8*1*12/c6/5 + 14*c6
+mov #c4-12/c10/c14-(16), r1
+mov L5[16-(13)-(-c6)], r2
+.data c8*c8/c12/-c4*c6, 7, ((c14)-10*c14)
+.fill 1, 5*17/8*c6/12
+mov #c6, r7
+.fill 1, 17
+.entry c14
+L8: mov L1[c6+11*0], r2
+L9: mov #c4, r7
+.data --13, 10
+.define c12 = c15
+L10: mov L8[2], r2
+.data -6/c6/19-1
+L11: .data 3, -c12, -14, -18+8+(11-16)
+.data c4/6+2+c0-c12
+mov L10[(-c15-3)], r2
+mov #c8, r5
+mov #5*13+-c8+7, r4
+prn #(5)*(c0)-c13/c6
+mov #c15*9+5+c15+10-11, r4
+L12: prn #-L0+-c15
+.data -10-19-c13/9-13
+.data (c8*c15*2)
+L13: mov #--c15+c8*13, r1
+L14: mov L1[c4], r2
+L15: mov #(16+X9-c8-c0), r7
+L16: mov L7[11-7*c4--2-c12], r2
+.data c12, c15+20/c12
+.define c14 = c10-c6
+.define c1 = --c4-0-c15
+.define c12 = 9*c15/c6+16+(20/c6)
+mov L9[--c12*c15-c12], r2
+L17: mov #-c13*-c8/5-15/2-18, r6
+hlt
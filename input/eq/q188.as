@@ -0,0 +1,111 @@
+L0: mov L0[12], r2
+.data (1)+15, -18, 5
+L1: mov L1[-3], r2
+L2: mov #(15)/5-1*16, r5
+.define c8 = X9
+.define c0 = -14/2/-4/c8
+L3: prn #-18+4*c8
+.define c1 = --c0/c0*20
+mov L2[-c0], r2
+.data 20
+L4: .data 8/14+7*c0/8, c8-16-c0+c0*-17*c0, c0
+L5: mov #(c0)+c1--14, r0
+cmp #nope, L3[((14/c1))]
+mov L4[18*((5))], r2
+mov L0[16], r2
+.define c11 = 6
+.data 5*X9, (-c0)+c8-(15)
+L6: .data (c11), 14/c11-c8+2, c0
+.define c3 = c8-c0*17--19/c0/4
+mov L6[15-5+1/c11*2], r2
+mov L2[11-(c1/0)], r2
+mov #2, r5
+.define c1 = 16*18
+.define c12 = ((c3))
+L7: mov #--c1+7-14, r3
+.entry c1
+mov L2[(0/3-c1)], r2
+mov L4[(c1)-c3*20+-c8], r2
+mov #0+c1*c1*19*16, r0
+.data -c1*c1+c12, -(2-10), 16/c0/c3*c8*c11
+mov #c11, r6
+mov L5[20--c8/5], r2
+.data 9-L0, 13+18+9/9/(19-c8), 19*1/c0/c1*17/c11, 18
+mov L7[-4-9+18], r2
+.define c3 = c8*c11*c8*c12
+cmp #c1/12+20*6, L5[c8]
+mov #12, r3
+L8: mov L2[c12], r2
+.define c7 = 20/c3
+.define c8 = -(c7*10)
+.fill 1, (c8/c8)*5*7-2/1
+L9: mov #c11, r4
+mov #-c1*9/-4, r6
+cmp #5, L1[16-c0-c12+c7+11]
+L10: mov #1, r2
+mov #2*c0*5-(12)/c12/8, r1
+prn #--3*4/3/c8
+.fill 3, c3
+mov L3[(-7/8)], r2
+mov #-L0, r3
+.data c1-c12/c11*c0/c7
+prn #c8
+L11: mov L6[-18+4+X9*17], r2
+cmp #c8+8-9*c1+c1, L7[-c7+c1*c0+4+0/9]
+.data (12-c3*1+16)
+.data 10, c3/c8+10
+.fill 2, 9
+.data 11, -2-c11*-18*-10, -19, (((c8)))
+mov L0[-(c3)-(20)], r2
+L12: mov #4+nope, r6
+prn #4*5/c8-(c8)
+L13: .data c0*13*c3-c8+c8/c1
+.define c10 = 8
+L14: mov L0[c11], r2
+L15: cmp #c3/c8/c12-c8+c3, L11[2]
+mov #6, r4
+L16: prn #c10+13*(c12)/(c10)
+mov L16[3], r2
+.define c9 = c8/12+16-(c8+1)
+L17: mov #c1, r2
+prn #15
+mov #14-c8/(1)-15*c3, r2
+mov #((10))/16, r6
+L18: mov L3[c7/8-(5)], r2
+mov #c8*c9/5-6, r2
+L19: prn #(c8*8/c7*15)
+.define c10 = -0-X9/20 + 11
+L20: mov L19[7], r2
+mov #(c7)/c8, r5
+cmp #1, L8[12-c10+5]
+L21: prn #10
+L22: mov #c7, r0
+.entry c1
+.data -(17)*0
+L23: mov L9[-c0/13+c0], r2
+mov #3, r0
+.define c5 = c9 + 4/-17 + 5
+mov #(7*9-16), r1
+prn #6
+L24: prn #c3
+.fill 2, (20)
+.define c5 = 6
+.data 18, -15/c0*c10+0, 3
+mov #(c12)+18*13+c0, r3
+L25: .data 17/14/c5*14+-7/5, (c12*c3)+4*8-nope
+L26: mov #3, r6
+L27: .data 6, c8/c7--6/(10-c5), -12*(3)+5, -(20)
+mov #c0, r7
+prn #-c7
+.define c3 = c1
+.define c13 = 6
+mov #c5, r6
+.define c9 = (6*c1)*c3
+mov #(0*0)/c8-c9+c3, r1
+mov #c8, r1
+L28: prn #1
+.define c14 = (c5)+c0-11/20-c8
+cmp #c7, L18[(-(X9))]
+mov #-c1/1*c1-c1/4*0+c12, r7
+L29: .data c10, 6/c8*-c7-c10
+hlt
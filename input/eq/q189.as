@@ -0,0 +1,82 @@
+L0: mov L0[13+20+17-3], r2
+mov L0[--5*-16], r2
+mov #20+-16, r0
+.data -20/12*9*0/18
+.define c11 = 17-14 + 10-4 + 12
+L1: mov #--c11, r7
+mov #c11, r2
+mov #(7/c11/1), r7
+L2: prn #(c11)
+prn #c11
+.data 19, (-3)
+.data 6, -c11*c11*c11
+.define c2 = c11
+.entry c2
+L3: mov L0[c2-5+-20*(c2)+c11], r2
+L4: mov #(16)/c11--c2+18/c11, r3
+L5: .data 5, 14-10*(1), c2+0+c2-0
+.data --c11-c11/c11, c2+20-10+11/19, 1
+mov #7+6-c2+12-c2, r2
+.define c0 = c2-c11/c2-c2--10*c11*c2
+.define c15 = c11
+cmp #c11/c15+c2/c15*c11, L1[c11/-c0-0]
+.define c3 = 8-2*0 + 9 + -8-7
+L6: mov L3[c15*9*c11*20/c2], r2
+mov L5[c3/8*(13)/-9], r2
+.define c6 = 20*10-14*9-16-2*c11*12
+L7: mov L4[-c6], r2
+L8: .fill 2, 5-c3+c2
+.define c7 = -c0-(c11)-(-c3)
+mov L1[8], r2
+.define c5 = -c2 + c6-1
+mov #c11, r6
+.data 4, c5-1-19, 5, c2+19+c0*1*(c6)
+cmp #3, L5[(-11)]
+.define c6 = c6
+mov L4[1], r2
+.entry c0
+mov L5[-c6+c5+c3/c5*c6/12], r2
+mov #1-c5*c7, r7
+L9: .fill 4, 6
+.data 4*19*c2-c2/c6, (1/7)/(c0)/(9), (c5/c5-3)
+mov L6[20-9/c6-(c5)], r2
+mov #c5, r0
+cmp #(c2), L1[7]
+L10: mov L5[-c2], r2
+.define c7 = -c2*(1)
+mov #11*c0+c7*c7+c0, r7
+L11: prn #c15
+mov L8[1], r2
+.define c4 = 19
+.fill 1, 3*c15/9/-c0/19
+L12: .data --c2, c3
+.fill 4, (-nope)-c7
+L13: .data 11
+L14: .data 17*X9-c6+11-c6, c7/c5-c6/c15*7, -c0-c5+17/13+c5/12, (-c15+c0-c3)
+L15: .data c7/c0/1+10*c5, 18, c7+c5*c3/(2)*(8)
+.data (18)-(-c6)
+L16: .data (-c3)+-c11/-19, c15, 13, -c11/7*0
+L17: mov #14*c7*c6*-c15, r3
+mov L14[0], r2
+.data 10, c0, 4--11-(6/10)
+mov #c5-c15/c0/3-11/(c7), r0
+mov L12[((c4))*20*c6-c11], r2
+.define c3 = -20 + 19-18
+mov L7[-c7-c15/11], r2
+mov #-8*11+(5), r3
+mov #16, r3
+mov #1, r0
+prn #c5/c6+18-c0+2+-c2
+L18: .data 7+c7*18+c7+c6*2--X9, -0+18*-1, -X9/c3-(10+13)
+mov #9*(19*c3), r4
+.fill 3, --c5-20
+L19: mov L15[3--7/17+18], r2
+L20: mov L6[c6], r2
+mov #((c3))+c7, r1
+L21: mov #(2)-c6+-16+(c11), r5
+.define c7 = (17)
+mov #8*c15/1*5, r1
+mov #5, r1
+mov #2, r4
+.entry c7
+hlt
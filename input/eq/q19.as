@@ -0,0 +1,107 @@
+.define c0 = 6
+L0: prn #c0
+.fill 1, 20/18+13/4*2
+L1: prn #-c0-c0+c0/5/1
+prn #(c0)
+.data c0
+.define c1 = c0+2
+L2: mov L1[c1*6-c0+(18-c1)], r2
+L3: mov L2[c1*c1+c1*c0*7*15], r2
+L4: .fill 3, c1
+mov #c0, r6
+.define c2 = (1 + c1 + 1)
+.define c3 = c2--8/9
+.fill 4, c0
+mov #c3, r0
+L5: mov #c1, r1
+mov L1[14-c3], r2
+mov #c0+c0+c3, r4
+mov #c2+c3*c0*c0, r4
+L6: prn #-8/18+-15
+mov L0[c0], r2
+.define c4 = (c3 + c0-5)
+.define c5 = ((17)*13-1)
+mov #20, r7
+mov #c2/3-c0+4*12/4, r7
+L7: cmp #10, L4[13+15+1-0/12]
+mov #18, r5
+L8: mov L4[c2], r2
+mov #c4, r0
+.fill 1, (c4)
+.define c6 = c4
+prn #10
+.define c7 = -c0-c4-c1*19 + 14
+L9: .data c1, -11+c4/4, c1
+mov #(0)-c2/9--c2*3/13, r1
+mov #c6, r0
+mov #15+c7*7*11, r7
+.define c8 = -(10)-11/5
+mov #(7/5)*14, r7
+L10: .data c3/3-c0/9/3, -c3+c0*2
+mov L9[12/3], r2
+mov #(c6)+c3, r6
+L11: mov #-c8, r4
+L12: mov L2[5+c4/5--16*9], r2
+L13: mov L9[11*c4*7-c2/3], r2
+L14: mov #5+5-17/5, r4
+.fill 1, -(c6)-c2+15
+mov L3[c0/20], r2
+.data 9, c2/5*(16/7), 8---c2, c2+c2+c4/5
+mov L6[-c7+c2], r2
+.fill 4, c0+14+c3-(c2)-14-c7
+prn #-3*c8/4*15
+mov #c5+-c0*(16-c6), r2
+.data ((c6))--c0/7, (-4-8), 0
+mov #(-3+-1), r3
+mov #c7-16-c7-19, r2
+.define c9 = --c6-c3/10
+cmp #16+3+c2-(c9*13), L7[c4/2]
+L15: mov #4/1/3, r5
+.define c10 = c0
+mov #11, r6
+.define c11 = c1/16/4*-10
+cmp #c1--8+-(c5), L15[(20-c11)/5]
+mov #c6-7/18, r6
+mov #c6/4-14--c9+c3, r2
+.define c12 = 18
+mov L13[-c4+c9/4], r2
+mov #4, r3
+prn #(c0/12)-(14)+18+c10
+mov L9[8], r2
+mov #-1+6-0+-c6-c11+c5, r4
+cmp #13+c5, L0[--(c1)]
+mov #3, r4
+cmp #(c9-(c6)), L8[c0-(20)]
+cmp #9, L2[(c2-8)*c12/3-c1]
+mov #c12+(c2)-c11/2, r1
+L16: mov #c1-c2-c8/3, r6
+.data 15/2, 13-3-c12+(20), 16
+L17: .data c12-c4*17/2, c3+12, c7
+L18: mov L14[1*8/5*c9], r2
+mov #4-14-c7-c9, r3
+mov #5, r3
+.data c12, c11, c0*20*c7-((c12))
+.define c13 = 14
+L19: mov #(20+4+20), r2
+mov #c13/3/3, r5
+L20: mov #19, r2
+.data c1, 11
+L21: mov #c13, r3
+L22: .data -c8+c2*8, 8
+.data c2*8*(4), (-8*c9), 17/4, 13
+.define c14 = (3)/18/2
+mov L12[6+13/14+c1-10-5], r2
+mov #8/1*13/9+c12, r7
+mov #0, r7
+mov L20[-17+c5+c2/2], r2
+prn #13-(c8-c3)
+.define c15 = -17/1 + c9
+prn #-c8/10
+L23: mov L15[17-c0*c13-c10], r2
+.define c16 = 6 + 4*12*c7*(c6)
+mov #2, r1
+.fill 2, 12-7
+mov #(c6*5*12*c6), r5
+L24: .data -c5*c11*13, c3+c11-c10/5, c4/1-c7, 6--c6
+L25: mov #-c0-c8+c3+c12, r1
+hlt
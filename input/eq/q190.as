@@ -0,0 +1,30 @@
+.define c11 = 2
+.entry c11
+mov #8, r5
+.entry c11
+.entry c11
+L0: mov #-c11*3*c11, r7
+.define c15 = ((-L0))
+L1: mov #c11, r1
+L2: mov L2[17], r2
+mov #8, r4
+mov #7*17/15*c11-16/-c15, r4
+cmp #20-c11/4/1+10, L0[--c11]
+mov #c15, r6
+mov #-8/c15*c15-c11, r3
+.data c11+(3)+15+9+-9, (c11)-14-c11, 8
+mov #--c11-c15/2--c11, r0
+.define c15 = c11*(c15) + -7
+.data 14
+.fill 2, 7*c11*(16)--10-4
+L3: mov L1[(c15)-(c15)], r2
+mov #c15+2+c15*c15-5, r0
+L4: .fill 4, -c15-c15/c11*13
+mov L4[2], r2
+L5: mov #---c11, r6
+.define c8 = 0/19
+.define c15 = c15
+mov L0[c15], r2
+prn #(6*c8/c15-c15)
+mov L2[(c15*1+c8*20)], r2
+hlt
@@ -0,0 +1,118 @@
+mov #19*7*11-(2)/1, r3
+.define c10 = (13)
+.data c10, --c10
+prn #1
+L0: .data 7, c10, (-c10-6*c10)
+.entry c10
+L1: .data (c10), c10/1-16-(7)-14, (c10*11-c10), (c10)/c10/18/7/(20)
+mov #(c10/c10)+c10*11*11, r0
+.data c10/c10, c10
+mov #-c10/c10*nope, r7
+.define c9 = c10/c10-c10/11
+mov L1[(c10)/7+16], r2
+.define c1 = (18+c10+c10)
+.data c9, 13-(c10/9), (c1-1*c1)
+.define c1 = 14/8+c10/c9
+L2: .data c10*(c10)*16, 0
+.data 15+-c1*c1, 20-16/c10*12-8
+.define c12 = 12
+.data 6, c10, 0+(13/19)
+L3: cmp #c12, L0[11]
+.define c15 = (c9)
+L4: mov #-c15, r5
+mov #13, r2
+prn #-15-c15*c9
+.data 18+13-(17)-2
+.define c8 = c15
+.data (c1)+14+c9-(c15)
+.fill 2, -10-3-10-9
+mov L0[-15+c15/c1], r2
+.define c0 = (-nope/18)
+mov #c1-14*c9*12, r2
+.define c10 = (c15)*c1-c15/c8
+.data c8, c10*(17)+16*c10, (-c1)/7, -11
+.data -c12*16, c9/13, -c10
+.data c9-c15, c10
+prn #c8/c1*c10-2+-c0
+.fill 4, (c1)
+L5: prn #3
+L6: .data 8-2/13-(7*c0)
+.define c9 = c12
+.data c8/0*c10*15
+L7: .data -9, c12
+.define c15 = c15
+L8: mov L6[(c0)], r2
+L9: .data c1, c1*-9, (((c15)))
+mov #(16), r0
+.data -c1*(c1)+-3/3+20, 9, -c9/-15/c12-c1, 4
+.define c1 = c12*-c10*c10*20
+L10: cmp #-5/8+c15+c1-c15, L0[c15/(c10+11)]
+.define c13 = (c15)
+.define c5 = 14/c10/c1+c15+c8-14
+mov L0[-10*11*11], r2
+mov #5, r1
+.data c9*c1-11/c9, 4+11*c5+4*(c1)
+.define c3 = c13
+L11: .data c10-c10*8, c1/16
+mov #0, r2
+L12: mov #(9)/5+6, r7
+.define c7 = 14 + 0*8*c10 + (-c9)
+mov #18, r5
+mov #2, r5
+L13: mov #-c10/c1/12, r4
+L14: .data c1, 17, -(18)-c1, c1*(5/c7)
+L15: .data -c10-c15*c15--12
+.define c4 = -8+11+c9
+.define c3 = (c15)-c0-20-3
+mov #c15+(c5)+5/c8, r5
+.define c14 = 20
+.define c6 = 17
+L16: mov L15[c9], r2
+mov #16, r0
+mov #12/0-5*3, r7
+.entry c3
+mov L1[-c1--13], r2
+L17: mov L3[14], r2
+.data c3-2
+.data c6
+L18: .data 10/-1/(c1)/c6*c5, 4, c1, c3-c15*c15*9-17+c15
+mov L3[9-c5-c3/8*18], r2
+L19: mov #12, r3
+L20: .data c0
+mov L4[c1], r2
+.data c6, 17+5*c1-8, 10
+mov L4[(15+c8)], r2
+.entry c6
+mov L20[11], r2
+.define c5 = -12 + c13-16 + c15
+mov #c3, r5
+L21: .data c0/5+6/--15
+mov L16[(c14)], r2
+mov L14[3*(13)], r2
+L22: prn #4
+.data -4+-c5, 2*c3, -16, c10
+.data -c14, c0--20/1/17, (16/1)-c14/c9
+.define c0 = (-c7-3)
+.data 0, 7
+L23: mov #8+-1/c7, r2
+L24: mov #(7), r0
+mov #11-20/c9+c7/c3, r5
+L25: mov #(8)/14-c7-(c12), r6
+mov #c9, r7
+L26: mov #c0-(5)-c6*L0, r7
+.define c15 = c1*c5
+.fill 4, c6*8+c1/c1-3
+.define c11 = -c5*c4
+.data c10, 9
+.data 12, (-0), c15, c9
+L27: .data (20), c9, 9
+.fill 3, c14
+.data 6*(12+c12)
+.define c7 = c7/9
+L28: mov #16, r2
+mov #3, r6
+mov #14/11, r0
+mov #-c3/17-c13/11, r0
+mov #11-c5+20+2, r0
+.define c2 = 3-9
+hlt
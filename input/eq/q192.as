@@ -0,0 +1,68 @@
+L0: mov L0[-20*8*14*12], r2
+.data 9*(1)-16*12*7, -4*14/13/6, -5-20-2*4/13+-2
+.fill 3, 19/8*11/-14*13-8
+L1: mov L1[-17+20*4/6/13], r2
+L2: .data -12*11+(6)+2
+L3: prn #-16-3-4/5*0
+mov L0[14/20+13/9/2], r2
+L4: mov #(13)*-13, r0
+mov #14, r0
+.define c10 = -13*1-11
+L5: mov L0[1], r2
+L6: mov L3[-15/c10*c10], r2
+mov #10, r6
+prn #5
+mov #18, r4
+.define c10 = 1-(c10)-c10
+.data 11, (-11+-c10), -(c10)+-20, c10
+.entry c10
+mov #2, r0
+prn #c10-12+11+c10*6
+L7: mov #8, r2
+.define c0 = 18*c10/18/0-3
+mov L2[20-(c10/c10)], r2
+.define c8 = (15)
+.define c0 = c0
+prn #11*11*0+6-c0+11
+.data (3*c10*16/c0), -c0+c0/c8, (14/18+15*8), c8
+mov L6[(0)+c10*8*-c10-20], r2
+mov L1[8/15], r2
+.data c10
+L8: mov L5[11+19+c8+1], r2
+L9: .data c10
+mov #--c10*3, r4
+.data c0*1--8-(-c0)
+L10: .fill 1, 6-(13/16)
+L11: mov #-9-12+-c0, r0
+prn #11
+L12: mov #2+12-20/8+-c10--19, r4
+.define c5 = X9+c0+12*19+c10+c10+17
+L13: mov L4[8], r2
+cmp #c8*c10+(16)*-1/c0, L7[7/-12+9]
+L14: .data 18
+cmp #6, L3[0]
+.data 8, c5, 7*c0-7-(1)-c10/c5
+.entry c0
+mov #L0*(15), r4
+L15: .data c10/c10+c8/8-c8
+cmp #-1/18*c10-11, L7[c8]
+prn #20*11/X9/19*(17+c0)
+mov L8[c5], r2
+cmp #c0-c0/(8)+2*4/c8+16, L1[13]
+.data c0+11*10-14-17, -c5+6-6
+.define c7 = 4
+mov #(4+0-13), r6
+.data 20/-c8*6
+mov L15[13+12+c10*c5-4], r2
+mov #(4), r4
+cmp #c0*6+1/-c10/c7, L12[-((17))]
+.fill 3, 14-20-c0+c0+c0*8
+.data c10-c8+(c5)/c10
+mov L15[17-c8], r2
+L16: .data c0
+mov L10[--c0+c0*c10], r2
+.define c4 = (c8-(c0))
+L17: prn #2
+L18: mov #(c5/c10*19/13), r2
+mov L5[6/X9/c7-9], r2
+hlt
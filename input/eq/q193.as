@@ -0,0 +1,92 @@
+mov #8, r3
+.define c14 = 11 + 3*6-10*20/8*17
+mov #(-12)/c14+c14/c14, r2
+.define c4 = c14
+.define c14 = c4 + c4-(2)-11
+.define c8 = 0
+.entry c14
+.entry c14
+L0: .data (c14-c8+10-c4), 2*c14+11+c8*5, -8-c14-c14, (c4-c14-18-8)
+.define c12 = -13*c4-18*c14
+L1: .data 0*13/6+(14+14), 18/-0/c4, c8/(c12)+c4, (c8)/c14+-c8-c4
+.define c5 = 0
+L2: .data -0-c14, (-c8+13)
+L3: mov L1[20/19/0--c4], r2
+.define c8 = -c8/13-(12)
+.define c15 = 7*c14
+.define c15 = (2)-c4+16/3-11-c14*c5
+.data 8-c14+15*2/c15, 8*7*(10)-c4*c15, (17/c5+c12-c8)
+L4: cmp #3, L1[c5*X9+3-(c15)]
+.define c13 = 4
+mov #5, r0
+.data c13, 1+c4-c8-(c14), 7/c8+13/4+c14
+mov L3[c15], r2
+L5: .data -c13-5-c5+16, -18-1*-c13
+.entry c15
+.data -18-3*c8, 8, 8+17/19*c8
+mov #c8, r0
+mov L4[3*c13*c14*20/c5*c4], r2
+mov #c5, r2
+mov L5[6], r2
+.define c6 = c4*12/(-20)
+L6: mov #c12, r5
+mov L1[15-c14+-8-15/3+(20)], r2
+mov #c4, r7
+.define c3 = 14*6/c6*-14-10
+.data (c5+c8)*(c13), c15
+.data 8, -c8, (-12)+c6, 7
+.data c8-c4--c6-c3
+mov L5[13/14], r2
+.data 19*-19-c4
+.define c1 = c13
+L7: mov L6[-c8], r2
+mov #0, r2
+.data 2, -c1/10*9/c12/5
+.define c8 = 5
+mov L3[c12+-c14-c8*c8], r2
+.define c7 = (12-c8*c15)
+L8: prn #c3
+L9: mov L0[--0*c13], r2
+L10: prn #(c1)*c8-13
+.fill 2, 12
+cmp #-c3*10-(c8), L0[(11/17)+15/c15*c1*9]
+.define c10 = c7+10
+mov #c15*c14/c8/-(8), r3
+mov #5+-8+c13-c7, r3
+L11: .data ((c15-c15)), -0*c10-c13
+L12: mov #c1, r6
+.define c14 = c7
+.data -c12+(c1)*c8, (c14)*15*15*5-11, 20
+L13: mov L1[10-6+c6], r2
+mov #7-c10, r6
+mov #-c12+8-(4/c5), r0
+mov L5[18-(8)-c8*c14/3/8], r2
+mov #(15*-9), r2
+L14: mov #c14, r6
+mov L3[c10+c8+-10/-c6/nope], r2
+mov L13[8], r2
+.data -c13+c3*c8*18*20, 2, (-15), c7
+.data -2*c8, 14+-17+c6, (19)/nope/18-1
+.define c0 = (c6*c8/c12)
+L15: .data -15-3/-c15, -19/13/c7*c14+c8+17, c14
+.data 8-7+c6/8-4-10, c15, 4
+L16: .data L0+1-c14/-9
+.define c14 = c8-1/c4 + (c5)
+.define c14 = (17/c10)/1/0*18*17
+.define c0 = 16
+prn #c7
+mov L9[-c15*15-6-c0], r2
+.fill 4, 9
+mov L12[(c1)+-c14/19+19/15], r2
+mov #-3-11-c8/c13-c10, r3
+.define c12 = c14
+mov #c10, r4
+mov L15[-c1/10*-c7/1], r2
+mov L7[20*0/c7*c12+14], r2
+.data 16, 6*12, 11+12*c4+-c13
+.define c9 = 5/20-4/c15-14
+.define c15 = c4-15/(12)-12-c1-c15
+L17: mov L12[18], r2
+mov L1[(11)+c13*c4*-c14/18], r2
+.define c4 = c15
+hlt
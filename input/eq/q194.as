@@ -0,0 +1,98 @@
+.define c12 = 14/6 + 11/20/20
+prn #(c12)-(c12)+-(15)
+.data c12+-(2), (c12/17-c12), c12
+mov #-16/c12/2/c12, r3
+.fill 1, -20+3-c12-c12
+L0: .data c12, c12, c12*9-c12*12/20/9
+.data 5
+L1: .data (-c12*c12), -(c12)+X9-12, 7-2*9+(13)
+mov #c12, r4
+.define c7 = 17
+L2: mov L0[-(c7*nope)], r2
+cmp #17, L1[(c12-19)-(c12)]
+mov #7, r3
+prn #-19-c7+c7/c7-12
+prn #5*c12-c7*c12/c12
+.data (c7+c7+13), 11+-18*c7, (13/16)--c7*c7, c12
+.fill 1, c7+13+16+-(c12)
+.define c13 = 15
+.define c10 = -c13+c7+13
+.define c3 = -7+c12+c10-2
+.data 1/9*15+9+c12, (4)/18-5*c13--c3, ((4))*17
+.fill 3, c7
+.entry c7
+mov #c13, r6
+.define c10 = (c13+16)+13+19/c3
+.define c5 = c3
+.data (-c10)*12-20-17*6, 20-(11)+c10+c13, (19-c13/c13-c5)
+L3: .data c13/-18*9
+cmp #15-c12*15--6*c7+c3, L0[(3)]
+.define c9 = 3
+.define c15 = 14
+prn #20+20+0*c10
+L4: .data -10
+mov L0[c10], r2
+L5: mov L1[c10], r2
+.entry c15
+.define c10 = c9-10*16*6-c10/c9*(3)
+L6: .data (6)-2-c13/9, 3
+mov #c10+19/c5-c13, r1
+mov #(c3+c12+(15)), r0
+mov L2[-10+-(4)], r2
+.data c10, (c10*19)
+.define c1 = -c12*c13
+.define c4 = 11
+.data (7), (-11+-c12), 11
+.entry c5
+prn #c9/-c1*c15
+.define c7 = (3)
+.define c15 = (c13*4/7)
+.define c5 = 11
+.define c9 = --c15*1
+prn #(4)
+L7: mov #-3-c13+-16-(6), r7
+.data 20, 5, 15-3/c12-8
+mov #1+6/11+c10, r5
+mov #9, r1
+.data 2-(0)-4*c5
+mov #2/c5, r6
+mov #c15/18/c5*17, r1
+mov L2[11], r2
+L8: .data c3/c7/c10*7*(c1)
+L9: mov #(c10)/-c5-c10, r0
+L10: .data (c15), c9, c13, --11+c10
+.data c10, c10/(c10)*11, ((c5/c5)), c7*c10*13*-c3
+mov L10[-10+5+7], r2
+mov L9[-14], r2
+cmp #-c13-c10/c7, L10[-14]
+.define c12 = -(8)/c5-0+c5
+.data (c10), 3/4+c10*c12*10*8, 16/(c10)-6+3
+.data (6)-c15/c12/c5, 10/c13-15*c12/6, c1-14-c13-c12*8
+.fill 4, 16+c5-c9/c7
+prn #9/c15+1/19/-10
+.data -9*c12+-(3), 7-c5/13--14, c10/-c9, c10
+mov #c12, r4
+.define c1 = c7
+prn #c12
+L11: mov #c15+-c9-c10+20-c9, r0
+L12: mov #(c7), r1
+L13: .fill 2, (0+c10)*c1*c10/(14)
+.data c5, ((c15-15)), c3-c7-15*14-14, 1
+.define c7 = c10
+L14: .data (c15)*c13/c12*(15), 0+-16, (9)
+mov L2[(c1)+-c5/(0)], r2
+.fill 3, -c9*18-16--c4/c7
+mov #20*15, r1
+mov #-5+c1*c1, r4
+mov L2[0], r2
+L15: mov L1[c5], r2
+mov #13+c10, r7
+mov #c10--c15+5+5, r0
+L16: .data 17, c1, 8
+L17: cmp #(c9), L8[-c1--11]
+L18: .data c12+19*3+15/c12
+L19: mov L0[c9], r2
+mov #c13-c10/c9+c9, r0
+mov #c15/c10*10, r6
+cmp #3, L17[-c9*c1-c9/11]
+hlt
@@ -0,0 +1,97 @@
+.data -16-3*13, 20-1*16*13+13+5
+L0: .fill 4, 5+-19-11+2
+mov #12, r5
+.define c9 = -14
+cmp #c9, L0[c9-4*9*c9-c9]
+L1: .data 11, c9, 14*c9/c9/6
+mov #-(c9)/c9+c9, r4
+L2: mov #c9, r6
+L3: mov L1[-13-4+(16)], r2
+prn #2--c9
+mov #c9-c9+-19+18, r4
+mov #c9, r2
+L4: .data (c9/c9)+14+0*-c9, -(c9), c9
+mov #(2), r0
+.data 8*nope/6*c9-c9, c9, -X9-3+c9-c9/1/c9
+mov #-c9-10*9, r5
+mov L3[(c9+12)+9], r2
+mov L0[-2/3-c9/-(16)], r2
+.define c2 = (0)-c9*c9
+mov #c2+-L0, r1
+.define c3 = 9
+.define c14 = 17
+L5: mov #7/c3*c14+c9--c3, r3
+prn #11
+prn #c2
+.fill 2, -c3-16--c2
+mov L0[-11-8/c2*11], r2
+mov #-(0)*c14*(7), r4
+mov #1, r2
+L6: mov #c14, r1
+L7: mov #10*c2-18+(2), r7
+L8: prn #c9-0/6*c14-c9
+L9: cmp #c3, L2[8]
+mov #12, r7
+L10: mov #c9, r1
+L11: mov L8[--(17)], r2
+L12: mov #c14, r6
+.data c2-10-4*c3+19, (c2)-4-(c14), c9*c3-18, c14/c2
+.entry c9
+L13: mov #-(-c3), r4
+.data c2, (c2-20/(c3)), (1*c2+c2*14), (-13*c2/c9)
+L14: .data c2
+L15: mov #c9-c2+-5+9+L0+14/L0, r3
+.define c9 = c2-8/-c3--(18)
+prn #-c3+c9*c14*1
+.fill 1, c3
+prn #c3
+.data 0
+.define c10 = -2
+L16: mov #-9-c10*-17, r2
+L17: mov #3*14+c9*c10, r2
+.define c15 = -6
+.define c10 = (c2)*0-16*c15*13*15
+L18: mov L1[-(17/c15)], r2
+.data 18, --c2/c10, -c10-c9/(18), 4-8+c3-c9
+.data 1-1+4-18+c2
+mov #1, r0
+mov L4[((c2))], r2
+mov L15[c10], r2
+.data 5-5*18/c2/13
+mov #(c10+c9)-c9-14-c9, r1
+.data c9, 9*(12)*19+-c9, c10/c15/(6)
+mov L10[--11], r2
+.data -c15, 13, c9
+mov L12[c10-c3/2-c2+c9], r2
+.data (c14)-15*16/c10, 4*(c14)-c3, -3/c2/c9+c10*c2*15, 14*c10
+mov #(13*c9*(17)), r5
+prn #2
+L19: .data c3, c3-8*(c10)/16*c10, c3
+.data -13/14/10-19
+.entry c2
+.define c2 = 4
+mov L14[(c14)], r2
+.fill 2, c9
+L20: mov L12[nope-8-c10+-c10/-c2], r2
+.entry c2
+.define c11 = 3*c14 + c10-c3-11-3/18
+L21: mov L14[-c9/-c15-c2/4], r2
+L22: mov #-14/16*c14+c10, r7
+mov L22[(c14*c2)-(18)/c9], r2
+L23: mov L16[c10/19], r2
+.data c10*(c2)+nope/c9, (12*c15+-12), c9/10*c2+c9+12/c9+3
+.data 8-c2/c9+c11
+mov #c2, r6
+.define c1 = 0
+L24: mov L24[c9], r2
+.define c12 = (c2-10)/c9+c14+-c15
+cmp #c11, L10[c3]
+.define c14 = 20/c14/c11*nope
+.fill 1, (-c2+20-c9)
+.define c13 = c14
+.define c2 = (c2*c2)*c15 + (10)
+.data c3-c9+16/17+5/15/16, c12, 0, c14/15-c11+-c12
+.define c1 = (17*c14)/c2
+mov #c1, r5
+L25: .fill 4, (9)
+hlt
@@ -0,0 +1,104 @@
+mov #13, r5
+prn #20-5*13+18*11
+prn #14
+L0: mov #1+(12)*(10/13), r7
+.data 17, 7/15, ((0))*(5+15), 10+6*12+16
+mov L0[1+7+5+11], r2
+.define c4 = -16 + -13*14
+L1: prn #(c4)
+prn #10
+mov L1[0], r2
+.data 3+2, 0/c4-2
+mov L1[-c4*4-9+c4], r2
+mov #(18), r3
+mov #(11+c4+(4)), r6
+L2: .data 9+11+15+c4+8, 8, 1
+L3: cmp #7*14/17--c4, L1[13]
+L4: .data (c4*1)*(c4)/13-20
+mov L0[1], r2
+.define c7 = 13
+mov L4[6*c7/c4-6*6-0], r2
+L5: mov #c7, r1
+mov L3[(X9)], r2
+mov #0, r1
+L6: cmp #c4, L0[c4]
+mov #19*c7, r0
+L7: mov L1[15*9], r2
+.data 1, c7+c7, 0/20*20-18+-16-(2), 0
+.define c13 = 2 + c7*14/19 + c4
+prn #c13
+mov #L0, r2
+mov #-c13/c7, r6
+.define c4 = 4-2*5
+mov #5, r4
+.data c4/c4-c13*10+16--1
+L8: cmp #c7-c4*0/-c4/c4*3, L5[(10)/-15/c13]
+L9: .data 12, c13, c4/7-10/c4*13, 0-(c4)*-1+18
+.define c9 = (4)
+.data -c4*11*-c4/19, (5*10)/c7, 13+c4*(4)*(c7)+13, 3*-c13-(c4)
+mov #c7+20/12/(4)/-c7, r7
+.data 4+7+c4, 9, nope
+mov #10-c13*4+10, r2
+.define c0 = (c4)
+mov L2[13], r2
+prn #6*9+-3+c4
+.define c8 = c9*6+c9*10+19-11/19-16
+.fill 4, 7-2+14/c4+20/-c4
+L10: prn #c13--6/7*c13*18+13
+.data c8+c9+9-10, 11/c0*c0/c4*(c4), 16-c7/11+c4, --c7*14-c4
+.data 17/-c13/c13
+.define c8 = -c7 + c9*c4
+mov #(-c8+1), r0
+L11: prn #c4-c9+15*c13*c8+18
+.define c7 = 7
+.define c0 = 7
+mov #c7, r1
+.define c1 = (c8)*20/c13-c8*(c13)
+.data -c9*3*(c0*c0), (1-c0)+12, ((4)/13-13)
+mov #c0, r6
+mov #-12*c9/c4, r5
+mov #c13, r5
+mov L4[c9], r2
+.define c5 = (1 + 10)
+L12: .data --5-c8+c5
+.define c11 = c8
+.data c0/c11, 4, 8, c1/18/c7
+mov #c0/c5/8/-12, r4
+.define c0 = 15
+mov #(c0)*c9-9+6+c8+6, r2
+.fill 2, 18*c5
+mov L6[--c7-20-c9], r2
+L13: mov L6[-c8*c4+c13], r2
+mov #4, r2
+.define c10 = c9
+.define c9 = c10-c7-c4 + c5/4
+mov L4[-(-c4)], r2
+L14: .data 5*1/c0, c8
+.define c6 = c7/14 + 14/18-20
+cmp #9, L10[(-7)/c5]
+.define c15 = -nope+c9*c11+c9*c4
+mov #17+c0/2-8/c8+c1+14, r7
+L15: mov #c7/8-4+(c0), r1
+.data c8-c6
+.define c0 = 17-c7
+.entry c10
+L16: .data 13, c1*(20), (c1-c0+-c8), 17+2/c8+-7
+mov #c10+c13/c10*15+c13, r4
+.define c15 = -c11
+mov #9+13, r6
+mov L7[-(c11)*c7], r2
+mov L13[16-13-c0/-3-c0], r2
+mov #14-10*c0*c7/c8/6, r6
+L17: mov L3[c8], r2
+cmp #c0, L11[8]
+.define c11 = 5
+.data c11-19*(c7)-14*(12), (c1), 9, 7-c13-c4*c13
+mov #0, r5
+.define c10 = c13/c4 + 4*5/c15
+.data c0-5/-16/(0+11), c7
+mov #-15/3-19+--c4, r6
+mov #14, r7
+.data -c15+20, c6, 17, 13*c5/2*L0
+L18: mov L11[8], r2
+mov L14[(15)], r2
+hlt
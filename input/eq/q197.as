@@ -0,0 +1,90 @@
+.define c6 = 20/13 + 17-18/18
+.data 19, 8+-9, 10--13*7
+.define c10 = -20/(16)
+.data c6, -c6
+.define c7 = 8
+L0: mov #18/-4*c10, r6
+.define c2 = (c6+14)-c10
+.define c13 = c7
+mov #3, r6
+.define c13 = X9
+mov L0[((6))-c2], r2
+mov #c13, r6
+L1: .fill 1, (c6-c13/18)
+mov #7, r7
+.data c13*c13*c13+12/c7
+mov #9/(c10)*6/L0, r0
+mov L1[(c7)/c13*(14)+7], r2
+mov #-c13/c7*11, r6
+.entry c10
+.data 16-(1)/(c2), -c7, c10-(c7/1), 14
+L2: .data 0/c13
+L3: prn #((c6/0))
+cmp #6-9, L2[(L0)]
+L4: mov #-9+c7+c7*3, r0
+L5: .fill 1, -c13-17+c2
+.entry c10
+mov L3[--16-14], r2
+.data -4+c6-c13
+.entry c7
+L6: mov L1[((c13))*c2*c7*c6], r2
+L7: .data 20, 18*(c2), ((14)-8-c13)
+.define c4 = (c7)*1
+.define c3 = -c13*1*c6-11/19/c13
+mov #c13--c4*c7, r1
+.data (19-c13/10/17), (15-c7+14), c2*c3
+mov L0[-10-0-((2))], r2
+mov L6[11], r2
+.define c1 = 13 + nope*c3*-c13
+L8: mov #(12+c4+13*c3), r0
+L9: mov #c4/c1/10*2-14, r0
+.fill 4, (14-16/4*c10)
+mov L8[1], r2
+mov L7[2-c7+c7-c10/-c3], r2
+mov #c1, r7
+.define c4 = (c13-c10-c7)
+mov L7[c10/(c7)], r2
+mov #c4-10+12-c13, r4
+mov #(8)/c4/4/-3*13+7, r4
+.fill 4, 3+c1+15*19
+mov #0, r5
+L10: prn #--17
+L11: prn #7
+L12: mov #18-13-17/c13+c2, r2
+mov L0[0], r2
+.define c3 = (16)/6/10-c6-c7
+L13: cmp #9, L8[-19-0/(c7)+17-c3]
+L14: cmp #c13, L10[5]
+.define c15 = c6-4*1
+mov L14[0+4*c3/-18], r2
+.define c7 = -(3)-15
+mov #10, r4
+L15: .fill 4, c6
+L16: mov L8[20*-16/18], r2
+mov #6+c7+c7/c6+14, r1
+L17: .data 3, 3
+.data 14+c13--19/8
+mov #11, r3
+mov #0/15+c15+c2, r6
+mov #20/c1+-c1-1*c3+c2*1, r5
+L18: .data c4, ((0))+c15, (20)
+.data -20, c7*12-7+19+c4/12, c3+c13*c2, c3*c3-8+18+4
+.data (11-16)/15, ((c15)-16), 11/(12-c10)
+L19: mov L5[-c6/5-12], r2
+L20: .fill 4, -0-9+c13
+cmp #15-8/18+c1+13, L1[c7*6-(15)*(2*c3)]
+.define c0 = -10
+mov #c6, r4
+.define c11 = c0
+.fill 4, c3-c4*19-c1/16-c3
+.define c2 = (3+c10)*2-c7/19
+mov L6[c11+c1/c15/c6+c2], r2
+.define c5 = c13 + c2
+.define c12 = 1+c13*19-10+14
+L21: prn #-19
+L22: mov L1[(c12/c10*c10)], r2
+mov L8[(c10)*2*(c4)], r2
+mov L9[c6-18/c13/1+16*14], r2
+L23: mov #5, r2
+.data 8, (8/0)+5/13+c2-5, c15, 12*7*L0*c10
+hlt
@@ -0,0 +1,27 @@
+mov #19*19/(18-0), r3
+L0: .data (11), -13/7-15*7, (-8)-17-3+nope+14, -3*9-1*11
+.data 5/5*5/19-(12)--18, -15, 1
+L1: mov #11+17, r2
+L2: mov #-nope, r1
+.data 9*16
+.define c10 = --13+19
+mov #2, r7
+.data 1+2*17+6-c10
+.define c10 = c10/c10/c10/c10 + -9 + 11
+mov #(c10)+-c10, r3
+.data c10, -8
+cmp #c10, L1[c10/-(c10)]
+prn #--c10
+mov #c10*-17+c10, r7
+.define c4 = 9/20-20-c10*-17/c10
+mov L1[c4], r2
+mov #c10, r2
+mov L2[(3)/-c4/--9], r2
+mov #4/c10/c10-8+13, r6
+L3: cmp #(c10)/c10-10/c10, L0[7+c10-c10+4/4]
+prn #(7/6/c10-c10)
+mov #-c4/c10-9+c10, r4
+.data c4+3
+L4: mov #c10*c4/8+c4, r4
+.define c12 = ((c4/15))
+hlt
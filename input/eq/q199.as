@@ -0,0 +1,65 @@
+prn #10*11
+prn #0*8*12/(19)
+mov #1/12/17-18+L0/1, r0
+.fill 3, 5+13*-14-nope+13*13
+L0: .data 13*0+0-17*4, -(4+1)
+mov #11, r7
+.define c3 = --nope*14
+mov L0[17-c3/c3/c3/c3], r2
+.entry c3
+mov L0[9+17+8---c3], r2
+.data 14, c3, -12*nope-c3+-c3
+L1: mov L1[7], r2
+.data 16, 4*18/4+(1-11), c3
+mov #c3-c3/c3-16, r4
+.data (3)/c3+16/(c3)/20, c3, c3/c3*12*20, 15
+prn #2
+prn #-0+c3+(8-18)
+.data -12/13-c3, 11, -c3-14*c3
+.define c2 = -c3/c3*c3-c3
+prn #5/c3+c3/-5
+prn #c3
+mov L0[(1)], r2
+mov L1[c3], r2
+prn #6
+mov #c3*-19/c3, r4
+.data c3+20-c2/0+18*2+6*0, 1-c2
+.data 5*-c3
+mov #c2-16*c3*4+-16, r6
+L2: mov L0[c3--c3+10], r2
+.data -c2-c2*c2-17/14+11, (-c3)+c2*c2-c3/c3, (8), 14/1+c3*14-2*7+10
+mov #2, r6
+L3: prn #6+c2-c3*12-c3
+.define c8 = c2
+.data -4-c3/c3/c8
+mov #19/0, r7
+mov #c2-c8-(c3), r1
+.data 19, c8*4+c3+c3+15, 12, c8/c8-c3*5+10
+mov #9-7/(3)/-c3, r2
+L4: prn #0
+mov #(-13)+(0+c3), r3
+.data (13-14)/c8
+mov #12*1/c3*c2, r4
+.fill 4, 20
+L5: mov #c8, r5
+mov #0*c8, r5
+.define c9 = c2
+mov L0[(16+c3*11+8)], r2
+.define c4 = c8-15*c9*(c8)*15/c2
+.data -16--c8*c3, 15/10*c3+15+c3, c8/-c2/6
+.define c2 = (19-18/5)
+.fill 2, c3
+.fill 4, 10*18*c8/c2*c4
+.data c2-6*c9*c9-14-c4
+L6: .fill 2, 10*c8-13*c8+12
+L7: .fill 2, c2*c8/c2/c8*c9
+mov L0[10], r2
+.fill 2, ((19*c9))
+mov L2[(5)/-3+3/1], r2
+.data c2/c8, 14+c8-(c3)*20*c8
+mov #c2*15*(c2)/18-12, r4
+.define c4 = 17*6-9*19*c3-c2+c2*16
+mov L5[1], r2
+.define c6 = 1+c2*20
+.fill 1, 4*11
+hlt
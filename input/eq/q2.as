@@ -0,0 +1,28 @@
+.define c0 = 9
+L0: .data c0/2, 16
+L1: mov #-15/2/4, r4
+.data -19, c0*c0-c0-3+8, c0+c0+-5+c0, (c0+19)+c0
+.define c1 = 13+(c0-15)
+mov #(1)*c0, r3
+.data c1, c0, c0
+.define c2 = c0
+.define c3 = 3*9 + 3-15/1
+.define c4 = 2/14
+.define c5 = c4-c0-c3
+mov #c5+c4/9/4, r1
+mov #c4, r2
+mov L0[14/16*(c4)+c1], r2
+L2: prn #c4-20/2*13-c2-(12)
+mov L2[c3], r2
+prn #-2-(2)-c2-0+-8
+mov L2[4*12/3], r2
+.define c6 = (c5)*18*c3
+mov #-c2, r4
+mov #12+c0*17--16, r5
+.data (c2), (20), c1
+.define c7 = 11
+.define c8 = 12
+mov L2[c5*(c6)*14+c2], r2
+.define c9 = 4/5
+.data c3*c4, c7+--c2
+hlt
@@ -0,0 +1,113 @@
+mov #-16/3*15+3-13, r7
+L0: .fill 2, 3
+.define c0 = 20*8 + 20-7 + 7
+mov L0[(3)/2/2], r2
+L1: mov L1[16+0/3], r2
+cmp #c0/2, L0[c0-c0+c0/4]
+.data -c0/5/2, 14, 10, c0
+prn #c0
+prn #-c0*c0/2
+prn #2
+L2: .data c0, 15, c0
+.data (9)-c0*c0/5
+L3: mov #6, r4
+L4: cmp #c0, L0[-5]
+mov #c0, r2
+.data c0+18-c0+20-1+14+c0, 14*5-2*12/3
+L5: .fill 2, -c0*c0/14
+L6: cmp #c0, L0[c0]
+prn #-c0
+.data c0
+.define c1 = c0*c0-c0*c0*9
+.data c0/1*(2)+c0, (c0)+18+16+c0+(0), (c0)-19-c0/18, 16-7+-c0
+.define c2 = c1
+prn #10
+.data (c0*12)-c2, (c0+(c1)), 7, -c1
+mov #c2, r3
+L7: cmp #c0+-c2/5, L1[(c0/2)+c0]
+.fill 1, (c1)-c2+1--0
+mov #c0, r7
+L8: mov #6, r6
+L9: mov L1[4+c0-c0/5], r2
+.define c3 = c2
+mov L7[-14/3-(1)+11], r2
+L10: prn #18/3
+.define c4 = -12/16*7/17--0
+L11: mov #c1*c0*c2*c4-(c4), r5
+L12: mov #8*9/2*c2, r7
+.define c5 = 9
+.define c6 = c1-1+7+4*c5+1
+.data c1, 3*19+c6*c2+(c1/4), c1, c5-15/11/4
+mov L6[(9)/4/5], r2
+L13: mov #c5*c1*c3/4*c5, r5
+cmp #c3, L6[(c2*14-(8))]
+L14: prn #-c6-c4/4+c1+10
+L15: cmp #c1*c5*c5*c4*c3, L1[(11)/1]
+L16: mov L6[14], r2
+.data 13, (2)*7/4-c4, c1, c4*c5-c6*c5
+cmp #3-9-2-12/2, L9[0*c0+-19--c0]
+mov L2[3], r2
+L17: .data c1, 15*c2*c6/1, 12-c3/12*-4
+.define c7 = -c0-c4/5+-c1-c6/5
+prn #c6
+.define c8 = -10 + c5-12/3-5*11
+prn #(5*c1-c6-12)
+prn #(c2)
+.data 17, 4, 6+c4, c7
+L18: prn #c0
+L19: .data c1, (1+c3)-(c1), (c2)/4
+mov #19/4, r5
+.define c9 = 5+9*14+c8+15
+mov #(c5), r0
+L20: mov #20*(-18), r2
+mov L14[(20)], r2
+.define c10 = 5
+mov #19, r1
+.define c11 = ((c7))/1
+mov #(c3)-c9, r1
+L21: .data -2+c0-c0+17, 7, c0, (8)/5
+.data c5
+L22: cmp #6*10/5*6, L4[9-c3]
+.data 0, c1/4-18
+mov L14[12/4+11*c4+c6], r2
+mov #13, r1
+mov L4[c5], r2
+.define c12 = ((c5-c4))
+L23: mov #1+4-5/4, r6
+.define c13 = 5
+L24: prn #((c12))+10
+prn #6*9*-8+19
+.define c14 = -c4-c7 + -c3
+.define c15 = 16
+.data c11/3-(6), (c5/3)+c15, -6, c7+c5*-3-14+c10/20
+mov L21[-c9+c12], r2
+L25: .data (c12), c5
+.define c16 = c8
+L26: .data c11, c0
+mov #-12-c9/13, r5
+L27: .data -c14--c13--10+1*2, -c8, c8, 3
+.define c17 = c15
+.data -c17
+mov #c2/4*c5/5/5, r4
+L28: .data c1+(18*c15)
+.define c18 = -14*c5-(c14)
+.define c19 = 17*19*14-c16-7
+.define c20 = c0
+.data c1, 0, -(c14)/3
+prn #c10
+.define c21 = -c15/1 + c20 + (c8)
+mov #9, r6
+L29: .data (16*c16*7/15), c12/5*c19*2/1, 1, 7
+mov #13-c14/5---14, r1
+prn #c0+c10
+mov L15[(15)*c9+((c8))], r2
+mov L9[c16*(12/1)], r2
+L30: .fill 3, c16
+.data 7+(c5)-14/3, 9, (0-c6)
+L31: .data (-8*c2+5), c17
+.define c22 = c7
+.define c23 = -c4*13
+mov #-c20+20/8/2, r0
+.define c24 = -(-c10)
+.data c3, 19, c17/2
+hlt
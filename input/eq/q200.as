@@ -0,0 +1,26 @@
+prn #8
+prn #-20*7+((3))
+prn #17*6-14-11/(10/18)
+L0: mov L0[-16+11*3+2], r2
+mov #7/14*4+9-((14)), r7
+mov #0, r1
+L1: .fill 1, ((20))+3
+mov #(-nope)-((11)), r7
+prn #12+1
+mov L0[18*(3)], r2
+mov L0[14], r2
+.define c13 = (18-5)/15
+mov #(15)*8+c13-c13, r5
+.define c10 = c13*c13*c13/c13*c13
+.data c10/c13--c10--c13
+mov #c13*10+c10*5, r7
+mov #0/6*20, r7
+mov L1[20], r2
+mov #10, r1
+.define c7 = -7 + 8 + c10
+.data ((c10)*14-c10), 6+14-20*c7*19, c10*1, c10*12/(c13)*c7
+mov L1[c10*15*11-(4)], r2
+mov #20/c13, r1
+mov #c10*16+9*c7*16, r3
+.data ((c13))*15-12
+hlt
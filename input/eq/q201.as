@@ -0,0 +1,29 @@
+prn #17*6/15*19
+L0: .data (18+7)+1*12+3/17, 15+6+16*16*15, (14), (X9)*-11-0
+cmp #--13+5, L0[16+9+1/20-1]
+prn #-0
+mov L0[0-15+3], r2
+mov #(11)*12/8, r4
+mov L0[-2], r2
+.define c13 = 12*8 + 15/7--7-18
+.define c4 = -c13-19-4/(c13)
+.data -c4/c13-(18)+18-2, 11+c13+14+12
+L1: .data c13/10+18-16*(c13), c4, (10-X9-3/1), (c13)
+mov L1[-(7*c13)], r2
+.entry c13
+L2: .data c13*c13/(4)-9, -(-c13), 11*c4/17*(c4)
+.define c6 = (c13-(c13))
+.define c11 = (c13)
+L3: .data 0, (16/15/-3)
+.data c4
+L4: mov #6-c4/c11+c4*2, r0
+.data (17*0-c13), c6, -7/c6*-nope
+L5: .fill 2, --c13-11+c4/c6*c11
+L6: mov #c11/L0*5*c6*-5, r3
+mov L4[19+c6], r2
+.define c6 = 13
+.data -(c6+14), 4
+mov #(16+-7), r0
+.data -2
+mov #c6, r6
+hlt
@@ -0,0 +1,118 @@
+.data 1, (14*1+6*19)
+mov #5, r1
+.define c5 = 11
+.data (9), 7
+prn #20+19+18/-c5*c5
+mov #19/c5, r2
+.define c5 = (c5)*c5/15 + c5 + (c5)
+.fill 3, 6*c5+7/(7)/17/c5
+.entry c5
+.entry c5
+.define c8 = -9/18-nope*c5*1
+L0: .fill 2, 13
+mov #(c8-c8-14), r3
+L1: .data c5, -c5-8/7-c5, c5+(7*8)
+L2: mov L1[c5*c8*c5--13/c5], r2
+.fill 4, -11/c5
+L3: cmp #c5, L2[c8]
+L4: mov L2[16+-12+20/16], r2
+.data -17/c5-6*c8
+.data (5*c5)*1*c5+-c5, 20/20*c5-2, 5, -15+19-c8/12-8/15
+mov L3[c5/-c8+c8+7], r2
+.define c5 = 1+c5-17*10-9*5+c5*c5
+L5: mov L4[c8], r2
+mov L2[c5/c8*c5-(17)], r2
+.data c5-c5/7-c5, c5/-c5/15
+mov L4[15], r2
+mov L0[11-(17)-c5], r2
+.fill 4, (c8*20--18)
+.define c1 = c5-c5 + 1*c5-14*9 + 20
+mov L4[(c5)+13/14/9*4], r2
+L6: .fill 4, --15-13
+L7: mov #c5*c1, r3
+.data -c5-0*c5+c5
+.entry c5
+mov L2[--c8*c5], r2
+L8: mov #c8, r3
+L9: .data c5*c1+(4)/5, c5, (c5), (c8)
+mov L5[17*c1+1/-c8*c5], r2
+L10: cmp #(13)+c5*-14+8/c8, L7[c5]
+L11: mov #c5+c1+-20-c1, r1
+mov L7[c5], r2
+.define c11 = (-c8-c5)
+.data 13+1
+L12: .data 13
+mov L3[-c11], r2
+cmp #(11*11-12+c11), L2[c5/1-c5/12/-17+6]
+L13: .data --2-(11), c5
+.fill 4, c5+c5-c11+17
+mov #c8+-14/4, r7
+.define c6 = (c5)
+mov #(c5*10)*c11, r3
+.data c8, X9*(c8-8)
+L14: mov L13[c8/c5/c6+c5/7*0-c6], r2
+.data 8, 7-14*-5, c1
+.define c4 = -c5/15*c5-c6-4 + c1
+.define c4 = (c11) + 10 + 18/3 + 16
+.data (c11/c5*20+c5), c11+(14-13), -c4+2
+L15: mov L0[-12*(7)/--17], r2
+.data -c8+0*11+0+11, -15*c6--c4, (1*c11)-18/c4, 9
+L16: .data 4/c5/c4*19*6+(c8), c5*4-c5/(4-c5), 5-(2)/c5*20-c6
+L17: .data --c1, c4, c11+8, -15-7/12+11-10/6
+.data (8*c5)/(0), 1, c5+c4+1-0-c6, -c5/14
+L18: mov #17-4-4-c4, r1
+.fill 4, c4
+.data -((c5))
+L19: .data 20, c1, c5/1*c5-4*-5+10/18, (((c6)))
+.define c10 = (-c6*X9)
+L20: .data -nope+17/(4*c5)
+.entry c6
+L21: .data 0, 17*15*4*(c6/20), 7, -16/7-(c6)
+mov L4[11], r2
+L22: .fill 2, 2
+L23: mov #-c1/19+c5+9, r4
+.data X9*0-20/c6*-15*13, (16-6)*c5/c6, 1, c11-c1*c4/19
+mov #14*c5-c6+14+c10, r0
+mov L12[c11], r2
+mov L6[6+c5-13-c5*c5+19+c6], r2
+.define c9 = 0+c5/c11*c1-(-13)
+mov #(0*14+c8), r5
+.data 14, c8+8-L0/c1-20*18*c5
+mov L18[20*12/c8/15*c4], r2
+mov L18[c10], r2
+L24: prn #12-c5-c5/c5+-15
+.data (c8), 11, -c5*7+7, (c10*c5)*c4
+mov #c1, r2
+.define c8 = 0*2
+mov #--9-(-14), r6
+.fill 3, (16-c10)+c8
+L25: mov #2, r7
+L26: mov L15[0], r2
+prn #(16+10)-c5
+prn #c4/c5/c10-(c6/c10)
+L27: mov #-20*c1, r3
+L28: mov #-17/10-8, r3
+L29: prn #1/13/c1/c11-19
+prn #--c10
+.data --13/c4+15, c8/c5-19/c11/(7)
+prn #20
+.data c5, (c4)*10-14+6*1*c11
+prn #c8
+L30: mov #c11-(10)+-19, r2
+L31: mov #8*c9-c8*c5+-14-c1, r1
+.data 6, -7, c6, -c9+c8+-0
+mov L18[3-c5/c8*(c5)/-1], r2
+.data c5, 17, 0*c5*18, 18
+.define c7 = c4
+mov #c10, r6
+mov L19[-(c7-2)], r2
+L32: .data 7*c4
+.fill 4, 18
+.define c2 = 8
+mov #(c6/c10)+c4, r2
+.entry c10
+.data -20*c6+4/c9-7, (c2+c8+15/c11), c8*-15*c5
+L33: mov L32[c1], r2
+.data c1*-c8-2*c11, c4-c8*-c8-9-5-17+3, -(-c2), -c5/17-c4
+L34: mov #c5, r6
+hlt
@@ -0,0 +1,32 @@
+.define c6 = 8
+.entry c6
+mov #c6, r4
+mov #(14), r4
+L0: mov #16+6-4/c6-(c6), r1
+.define c13 = 0/c6+(12+11)
+L1: mov L1[c6], r2
+mov #20*20+c6-c6, r0
+cmp #(18-20)*-c6+c6, L1[c13]
+.define c13 = (6*18*1/8)
+.define c0 = --c13*c13
+.define c3 = c0
+mov L1[c13], r2
+mov #--1+6, r2
+L2: mov #3-0+c0, r0
+.define c8 = 9-c6 + c13/(-1)
+mov #(16), r1
+mov #c3, r2
+.fill 1, 14*13
+.fill 1, c6-c6+20*c13/c8-c0
+mov L0[((5/c13))], r2
+cmp #6+19+L0+c6/c6, L1[c8+c0+c13/c3]
+prn #19+15/(L0)/-10--c13
+L3: cmp #c13, L1[18--c0*c13-c13]
+mov #c0, r4
+prn #c6/-14+c6+c3
+mov #(c0+8-4-19), r3
+.define c2 = 17*c0-20-15/3 + 0
+.define c14 = c13
+mov #(0-0+c13), r5
+L4: .fill 3, c2
+hlt
@@ -0,0 +1,71 @@
+prn #10
+.define c10 = -4-6-5 + ((11))
+.entry c10
+mov #(c10+(c10)), r2
+.entry c10
+.data 7, -14+c10, 0*0/15-8
+.define c3 = 15*c10-5/9
+.data c3/c3, 12, 7
+mov #0/4-0*15-17*10*4, r1
+.data 1/7, 8-13/6/(8)*3
+.data -6
+.data (c10*c10+10*12), 7, 0, 9
+.entry c10
+L0: mov #c3-19-(c3)/-19+13, r7
+mov #((c10))-(c3)+19, r0
+mov L0[c10], r2
+mov L0[20], r2
+.data 10*c10-c10+13*c3, 12, -(c3)*-18, c3-c10-(c10)/--12
+L1: cmp #13/19*c10/-c10, L0[18-6-1*c3/c10]
+cmp #(14/c3-c10-c3), L0[15]
+.data c3-c10/c10--c3
+L2: mov #c3/-c10+c3-c3, r1
+.define c1 = -3/15/18-7+9*16
+.define c5 = (-c3-(c3))
+mov #8-c5+c3-c1+c3, r2
+mov L2[c5], r2
+L3: prn #-11
+mov #c10, r6
+mov L1[c10-L0-c10+c5], r2
+.data -(L0*c10)
+mov #10/16+16+17-c10, r3
+mov #7/(c10)-(7), r3
+.data c1+12, c5-c3-c10*2, c5
+cmp #c1-2*c1-7/c5/c1, L1[c3]
+mov #c10-c5+-c10/6, r2
+mov #12/c10/7*c3/1, r5
+.data (c1)
+.define c6 = (-c5-18-c1)
+.data 0, -c10*c10/17-c5, c5*(c1)+20, (5)
+mov L1[(c5/2)+4], r2
+mov #(c10/14+c5/c10), r7
+L4: .data (17)-13/15-6
+mov L2[X9*c6], r2
+mov #c5, r2
+.entry c3
+.data 5, -nope/(c10)+c5
+mov #c3--c10*c5, r4
+.define c1 = (c1+18)*--17
+.entry c10
+prn #19-c1*(18)+0
+.define c14 = c6
+.data c14, c3, 8, 13
+.data c1+c1/c3/5*c5, 19
+.define c14 = (14*13-(19))
+mov L0[-c10*c10--c1/11], r2
+.entry c1
+L5: mov #-c14-4*c14*c1/c1-16, r5
+L6: mov #13, r3
+mov L0[6], r2
+L7: prn #c14/c3+-(c14)
+prn #c6
+.define c6 = -c14/-8
+.data 5*c6-c3-16, 15, c1-10
+.data 1
+mov L2[19], r2
+mov #6, r2
+.data c10
+.data 5
+mov L4[(c14)--6--c6], r2
+mov #(20/-c6), r2
+hlt
@@ -0,0 +1,76 @@
+L0: mov #-4+7/8*16-6-7, r4
+mov #(7*X9*11+4), r4
+.define c11 = -4-(8/14)
+.define c2 = 7*c11 + c11-17*c11-c11
+mov L0[-12-11+14-c2], r2
+prn #c2+17/9-17+c2
+mov #15, r3
+.entry c2
+.data 18, 6
+mov #(1+14)-16, r7
+mov #-c2-c2+c2+20, r1
+.data c2
+cmp #c2, L0[c11]
+.define c7 = --c11*-1
+cmp #1/13, L0[3-c7*7+0]
+.data 0, 13, 2
+L1: prn #19-19*c7/c2*c7
+mov #(19+16)-c2-17-c7, r6
+.define c1 = c7-11-c7/14
+.define c7 = c2 + c7*c2*(c1/19)
+L2: mov L0[8*c7/c11-19], r2
+L3: .data c7+19*4+2+-10+-7
+.fill 1, (c2)+0*c1--14*c1/19
+mov L2[(2+c1)-(18)/3], r2
+.data c1+c7/(1)-c7/c7
+.data 0/20+9*c1
+mov #7+4/c1/(20)*13*13, r3
+.data --19+14, X9, (c7)
+mov #-c1, r7
+.define c6 = -c7 + (0)*-12--c1
+.fill 1, c11+c6-20*c7
+cmp #c1-c7/6, L1[c6]
+.fill 2, c6*-c6-c1
+.data --c6*c7-7, (c6)
+.data c7
+.define c1 = 3/10*0
+.define c8 = ((20-c2))
+mov #-17+c6/13-17*14, r2
+.data c7, -c7-8/c2, c1, c8
+mov L2[4], r2
+L4: mov L0[c2], r2
+cmp #c7+c7, L0[c6/10+-c1-17+X9+10]
+mov #(c11-c1)-c7/c2*(c1), r4
+.fill 2, 16
+L5: mov #c8/13*c2+(19), r0
+L6: .fill 1, -c11/3-15-(15/c6)
+cmp #19, L2[c6/c1-c1*c7]
+.data -5/10-c7, -14/c1/c7-17-5, (-4)+10
+mov #-c8, r6
+mov L6[17], r2
+.entry c1
+.entry c8
+mov L0[(c11/8)*(c8)], r2
+L7: mov L7[(17)+13], r2
+prn #c1*5+19-c1*2
+cmp #-2, L5[9]
+.data -7-(c2)-13-2+8, -(c2)+c6
+L8: .data (6/6)/19, -3*c7-8/c6
+.fill 1, c2
+mov #-14*16+(c11), r2
+.define c4 = 9
+.define c10 = c11*c2/(c4)*c8+c7/(c7)
+.define c1 = c2/c10-(13)+-c10-16
+.define c9 = 8-5/20*-c11
+mov #c1, r3
+prn #-c8*c1
+L9: .fill 3, 14
+.entry c1
+.data c10-(c2*c1), -c1-5/c11
+L10: .fill 3, 12
+L11: mov #14*c11+c10*13+(c1), r7
+mov #(2)/c8*c11-c4+(c11), r0
+.define c15 = c10/nope+15+17
+.data (10+20)*0, c2+(6)
+cmp #9-c4/c7*c8--8+8, L2[c7]
+hlt
@@ -0,0 +1,22 @@
+.define c7 = -6/11*17-8--16
+.define c3 = c7-10/20-c7+c7
+.define c10 = 20
+L0: mov #19-c3/5+c3, r5
+L1: .data 10, 2-3, (7)-2*c10/9
+.data (19)
+L2: mov L1[18/c10*c10+c10], r2
+L3: mov #10+8+(20)+15*c3+c10, r6
+.define c12 = c10-16*15/19+((c3))
+L4: .data (c10)
+.data 6/c7, c10, --c3+11, (c3)+1-c7*c3-c10
+prn #(-(6))
+.fill 4, c7*--18
+.define c5 = c7*c10 + c7
+.data 20/-16+c3, c7*c12
+.define c4 = -c5*20-c3/14*c12
+.define c4 = c7*c5*c4-c12*18-c10 + c12 + c7
+.define c5 = (14+c12--c10)
+L5: mov #(1+c5*14-5), r7
+mov L4[c5], r2
+L6: .data (20)+c7-12
+hlt
@@ -0,0 +1,85 @@
+mov #14+5-4, r3
+.data -14*12*3, --7/6
+mov #-14+20*-19-0, r1
+.data 12, -4+14*2, 10-0+9/(0-18), -3
+mov #4, r2
+.data 15, L0/0/X9*1/2
+.define c0 = 6/1+8/13+8+9+16
+.entry c0
+.fill 3, 11-c0+11*(c0)+c0
+mov #c0*-0*4, r5
+.define c14 = c0-17
+.data -c0, -c0/c0/c0/c0+c14*c0, (c0)-(14)*7*-8
+.data 19-(14)*-9*c14
+.entry c14
+.define c6 = 4
+.entry c6
+mov #(6), r7
+prn #20-c0+9-c6-19
+.define c7 = c0
+.entry c6
+.entry c7
+.data (--c6), -18*c7-17-c7/c14/0, 8*8*c7+c6/15-c0+c14, 11
+prn #16+1-13*9+7/c14
+.entry c14
+.define c12 = -(14)
+.define c3 = c7+c0-c12
+L0: .data c0-c3*c12+3/c7, c14, -6, (9)
+mov #(19)-3+-c0, r6
+.define c11 = 19 + c0*11--10*17
+.fill 3, 15
+.define c6 = c0 + c7*c12*12/c7
+mov #4/c11+12+0*c0, r3
+L1: .data 14*(10)+8
+.define c11 = c11
+L2: mov #16, r2
+L3: mov L0[c11], r2
+mov L0[(-3)], r2
+L4: mov #(4)+c6-0/3, r7
+mov #c11+c6*4/6*c14, r1
+.define c3 = 6-13 + 6 + c12/7*0 + 19/1
+mov #c6, r0
+.data 5, c11
+.data -19, c11, nope, -(18*18)
+.define c10 = (20*9-c7-20)
+mov #c12, r2
+mov #-c3-c7+c11+c14, r2
+L5: mov #c0*15, r0
+L6: .fill 3, 18*11
+mov #8+1, r4
+mov #c6+5-(11)*(c11/17), r7
+.define c2 = (c3/c0*(c3))
+.data 18*-c11-c10-16/c6, c10+5/c14+9/(-c11)
+.define c1 = 11
+.define c12 = c0
+.data 20
+mov L5[c12/c2*12-(c2+1)], r2
+mov #c11+14-5/c11-c11, r1
+prn #(4*4)/c11
+.data 18, c6, --16*4
+.fill 1, c6/8--11*-6*c14/3
+L7: .data (13)*13*c11+c10, c6, 7+-c3-c6*c7
+mov #-c2-7/c6-12+c3+8, r3
+.define c1 = 18 + 7 + c0-4 + c2 + c12-c11
+L8: .data 5, (c11+20)*6-c2*2, 0, -c12--7*c1
+mov #11-6-c14/20, r0
+.data c0, (c7/c0+-13)
+L9: mov L9[c1], r2
+L10: .data 3, -c1/13, -2, (c1*13-18)
+mov L2[(12)-c2/6+1/8/c0], r2
+L11: mov #c0, r5
+.define c6 = c6
+.data -c3/6-3/c10, 1+c11+c7*-9/c0, c14/12-16-7-3/16+0
+cmp #14*9/13+c6+11, L10[(c6)]
+.define c6 = c1*0+1*17
+cmp #c12, L2[0+c6*c6*8]
+L12: mov #-nope-16--c3, r3
+.define c10 = 5
+L13: prn #4
+mov L7[c1/2/c10-0/(c6)], r2
+mov L4[12], r2
+.data c6, (3)+c12*c12*c6*c0, -15/5*c1*c6, c14-(11)+(9)
+L14: .data c2, c6+10, 7, c6
+prn #c6*-c3/15
+.define c15 = X9-17/c6+c7-13/c10
+hlt
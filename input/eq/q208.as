@@ -0,0 +1,56 @@
+L0: mov #-17-8*(7)/20, r2
+L1: mov #15-1-0/-20, r5
+.data 14/5-15/(2), 5
+.define c1 = (-7)
+mov #(c1)*c1/c1-7+c1, r0
+mov #c1, r6
+mov #(c1+7)*7, r5
+L2: .data c1
+L3: .fill 2, (4)-14-15
+L4: mov #14, r6
+mov L0[-19], r2
+L5: prn #(14*18)-(7+20)
+.define c12 = 2
+mov #c12, r2
+cmp #(c12/4*13), L3[-c12-(9)+c12]
+.define c14 = 10
+.define c6 = 16
+.entry c14
+L6: prn #(c1)
+L7: .data c14
+L8: .data -(17+c14), 7
+mov L5[3], r2
+cmp #3, L8[---c6]
+mov #-14+(c14)+(c1), r3
+.data 5*(17+c14), c14, -c14
+mov L3[c12], r2
+mov #(c14-c6+c1*2), r0
+.data c6, (11)
+L9: mov L9[18+(c1)], r2
+L10: mov #-(17-1), r3
+.define c6 = 10
+.define c3 = -c12 + 12 + c6 + c1/19
+L11: mov #c6-18, r6
+mov #-c1+5-c14, r3
+mov L2[18], r2
+mov #-c12*6+6/8-c12, r0
+prn #c6+-13*-c14-17-c6
+L12: mov #16/7/c14+5, r2
+mov #c6, r5
+cmp #3/20*c14-c3, L11[-(c3)*-5]
+L13: mov L4[-c6], r2
+mov L2[19+c6*c1/9], r2
+prn #c12
+mov L2[-(19)-c12], r2
+mov #(4)+0-c12-(c6)-20, r7
+mov L5[10/c1*13*c6-1-c14], r2
+.entry c1
+L14: .data 17, 5-L0, c3, (c6)
+.data --3*14
+mov L5[c6*-11], r2
+L15: mov #2, r0
+.fill 1, c3/-c6+c6
+.fill 2, 10-0+-c6
+cmp #c14+1--20-(c12*c12), L13[-c12-7*c6-c3-c14+16]
+.data c12/c14/c6-(c1*c3), c12
+hlt
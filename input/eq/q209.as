@@ -0,0 +1,92 @@
+L0: mov #11+4-19*9+0*13-7, r2
+L1: mov L0[8], r2
+mov #-7, r0
+cmp #13/17, L1[1]
+mov #18, r4
+mov #1, r3
+.fill 1, 3*2-7-14
+.data (10), 14/20+0-4, 18
+L2: mov #17*1, r1
+mov #7/20-5+7, r3
+L3: mov L3[20*9+8/1*2+13+8-4], r2
+mov #(20+18)-11+nope, r2
+L4: .data 2, 9*3/13-11+12-1, (-10)+(-X9), 8-8*0*19
+.fill 1, 3
+L5: mov #6-19/9-8/13, r6
+.define c4 = (1/2*20*4)
+.define c5 = c4
+.define c13 = (c4)-c4-14/5*c4
+.data c13/3*9+-19-3, (15)+5/17-17-c4
+.data 6, (c5-0)
+L6: mov #5, r3
+cmp #10, L4[-c5/c4*c4]
+L7: mov L7[(c13)+c4], r2
+.define c2 = c5*c13/c13/c13
+L8: prn #c13
+.define c4 = -c4-4*20/5
+L9: mov #-5+17--7-c4, r1
+L10: .data c4, 15-16
+.data c4+-4/9, 11-c4+20*-c5+19+c2, 7, c4
+.data 1, 18, 0, 11
+.define c13 = -14-12-(11)
+L11: .data 9-L0, (16+c4*(c13))
+.data 18, 19-6-5, 3, 9+(c13)+c4
+.define c15 = c13*(c4)-7
+mov #(17-20-16), r6
+.data 16, (16/20)+c13/17*c4, c4, (c4)
+mov #nope-15, r3
+L12: mov #--12+c4, r4
+L13: mov #c13, r1
+.data c13*(8)*12
+.data (4+17+16*2), 10, -(c15+c5)
+mov #9, r1
+.data 3/c4*4, X9/(c4)/17, c4/7
+L14: prn #6
+mov #(c5)*c4*7-c5+0, r2
+.define c1 = 5-c13*7+1/-8+5
+.data 15+c15-c2-c4+0*9
+.data 14-c13+c2, -8, 0
+mov #c15, r7
+.define c0 = 16 + 18*c4*c4 + c2
+mov #10+6+(18)/8, r0
+mov #((17)/-4), r5
+.define c9 = 5
+prn #(c4/c1/c2*16)
+mov #14, r0
+L15: mov #(13)-c13+c4, r2
+.define c1 = c13/13
+L16: .data c13, (-20-16), 1+c2-5-c1*20+c2*16
+cmp #-c9-16/c13/1, L3[c0]
+mov #c1-12+12-4*c0+8, r0
+.define c15 = 18
+mov L15[-c0+(c15)], r2
+mov L13[1-c1], r2
+.entry c0
+mov #c2, r2
+L17: mov #---7, r7
+.define c4 = (16)-c9 + c1*9
+mov #11*-c5--X9, r3
+mov #-c13*9-(-c4), r7
+L18: .data -19, -10*0-2--c13, -c4
+L19: .data 0, 15
+L20: mov #0, r4
+.define c10 = 7/c2
+.data 13, (1+13)+c5-(c5)
+L21: mov L16[13/c1/-10-11*c5], r2
+.data c1, c2, -6*(7-c4), c0
+.data (-c4+20*c10), (11/c15)*c9
+mov #(c1+c15*c1), r0
+prn #(4*7)/14-16*c13
+.define c14 = (20*c4 + c10 + 6)
+.define c13 = 14
+mov L3[c4], r2
+mov #c5, r3
+mov #11+c15*10-17, r4
+mov #-c2/c1*-6/2, r1
+mov L6[c2/c15+19+c5/3*18], r2
+.define c5 = 0
+.data c13
+L22: mov #7, r5
+mov L22[7], r2
+.define c2 = 1
+hlt
@@ -0,0 +1,42 @@
+.fill 3, (15)
+prn #3+17+(13)-7+-2
+mov #2, r1
+L0: mov L0[(18+6)*(1)], r2
+L1: prn #2*12/14/4
+.define c0 = 5+(19-10)
+mov L1[c0], r2
+mov L0[c0-(7+c0)], r2
+mov L1[c0], r2
+.define c1 = -8*c0-11/1
+mov L0[c0/2+c0], r2
+.define c2 = 20
+.data (c0), 9+c2*15-c1-8+c2+c1, 17, 10
+prn #-c1/1+20+14
+.define c3 = -c0/2/4
+.define c4 = c3-12/2
+L2: mov #c2, r1
+.define c5 = 11
+L3: mov #c3/2, r5
+cmp #13, L0[-(0-18)]
+L4: mov #(c2/10-c4), r4
+L5: mov #--8+c1, r6
+.define c6 = 0-c3*(19/6)
+L6: mov #c3+c4/3, r2
+.define c7 = c6/17
+L7: .data c6/20*c6*11*3+0, c0, 14*18-c6/10, c7
+L8: mov #c4*c4+6+c7-((19)), r1
+L9: mov #c7, r7
+.data 13*9, 19, 0+18-20-20/17
+cmp #--c2+-c4, L3[4]
+L10: .data c1/5+-11+16-7-c3
+L11: mov L7[-c7/2-c7], r2
+L12: prn #c3/5
+.define c8 = 20
+.data 5, 7+c4+5-c8/3, c7+c1*1/4, 3
+.define c9 = c4*(-c5)
+prn #c8
+.data c1, 0, c6-9+19-7+c3
+.data 1-5+14+c4, 14-20+c0/15, c9
+cmp #(20), L12[15-c8*c1*11*5]
+L13: .data -c9-8/5, 12-13-12+0+2, (c3/2*c5/7)
+hlt
@@ -0,0 +1,70 @@
+.define c12 = 19+18+20-17
+.data c12
+mov #c12, r3
+L0: mov L0[17], r2
+prn #17
+.define c4 = --c12-c12
+prn #10/20/0/5/c12+1
+mov L0[15], r2
+L1: mov #c4*c12*c4/13, r0
+.define c7 = -16/14-c4 + c12/0
+L2: .fill 3, c7
+mov L0[-c4+-c12], r2
+.define c5 = c7
+.define c13 = c7*1+-11
+mov L2[c4+c5-c12-c5/--c5], r2
+L3: .data 2, (13/c7)-0*1/(c13)
+mov #(16+1)+c12, r7
+mov #(8*14+14*8), r1
+L4: mov #(-c5), r3
+mov #15/10/0+14-2, r0
+.define c10 = c7*16+c13*14-4*c7
+.data 8, 19/-12, c12
+.define c7 = -0 + 9-18 + 14
+.define c8 = -(c4*c4)
+.entry c13
+L5: .data -c7/(c13*17), c8, -c13/15*-c4*0
+L6: prn #c13-c7/c8+c7+3
+.data c4/7, c8, c12/c8*2*4
+.define c12 = c13 + c7-14/c13 + c12
+mov L2[13], r2
+.define c4 = ((2-15))
+mov #(-(L0)), r3
+.define c14 = -14/7/c12*15/c8/5
+.define c13 = (7)+13
+.data (18+c5+8), c5, (c4/5/9)
+mov #10+20+15*(12*c4), r4
+L7: mov #(-10-c8), r1
+.data c10
+L8: .data 11, 11
+.data (c8*17*c12), (c7)
+.data -15, c4, 8
+mov #c4-c4/c13, r3
+.define c3 = 7
+mov #-19+-12, r1
+mov #c4, r5
+L9: mov #-15-3+15, r2
+prn #16
+L10: mov #(10*c3/-c7), r4
+prn #c7
+L11: .fill 3, 13
+L12: mov L8[(16)*c14/c10/c7/16], r2
+.data c12*L0/6-5/(c13+c7), 1
+mov #19, r5
+prn #19/14+c4
+cmp #9, L8[c7/c7]
+L13: mov L13[2], r2
+mov L8[((c8))*2*11], r2
+mov L0[(c7)/-(c8)], r2
+.define c1 = -c10-c5+c13+20-c3
+prn #c4
+.fill 4, c7-c7*-1+15
+L14: .fill 1, c4/c12*(8)*c13
+mov #0, r5
+.data 17-c8*19*5-c5, (20-c8*5), (c8), c13/c4
+.data -14, c7
+.define c11 = -18/7-10*17/20
+L15: prn #(-c8/15)
+mov #c3, r4
+mov #2, r6
+hlt
@@ -0,0 +1,93 @@
+L0: .data 3+2/5*11-16-(19), 18*X9, (7+19)*(15)+10
+.data 6--8*-0*19, 14, 14*3+12-(11)
+L1: mov #(0)+15/6/14+18*8-12, r6
+mov #14, r0
+.define c6 = 2
+mov L1[-9], r2
+mov L0[17*c6*c6*20/15], r2
+L2: mov #6, r3
+.define c4 = c6
+mov #((c6)/(c6)), r7
+L3: mov L1[c4-nope+c4/(c4)], r2
+mov L1[7], r2
+mov #5*(c4*c4), r5
+L4: mov #c6, r2
+mov #c6+c4+-c4, r3
+L5: .data c4-c4
+mov #-12*c6-3*6*13*12+11, r7
+.define c14 = 20 + 19/9-10/19
+.data 6, 2+3+19+-c4, 9, 13
+mov L5[c4], r2
+cmp #10, L2[c4]
+mov #c4, r7
+L6: .fill 1, -1/c6
+cmp #(c14), L4[(16+c4*0)]
+mov #-c6*5*c14*0, r5
+mov #4+1*20-X9-19*8*20, r3
+mov L5[12*14*c4+12-c14], r2
+.define c14 = (c4*2+c14*c4)
+mov #-16+(16), r3
+L7: .fill 1, c4
+.data c6, 13, c14/c4-c14/c14/12, -19
+mov #16/(18)+8/2, r5
+mov L1[-3+20+6/11/1+12], r2
+.define c6 = c4
+L8: mov #-(c14), r2
+L9: mov L2[20], r2
+L10: cmp #8+4*-c4+3, L7[14]
+.define c6 = (c14)/c14/10--(4)
+mov #5, r4
+cmp #(17-(c6)), L0[6]
+mov L6[5], r2
+L11: mov L8[c6], r2
+.data 20*5-c4-c4/2, (17)*c14*c4, 0+5*16-16, c4*13+14*20/c14+9-4
+.data c4, 18, 6, (c4+10/c14-c6)
+.fill 2, c14
+.define c15 = 8 + -2
+.define c5 = (4-c6)+c14
+prn #(c5*8)/5
+mov #9, r6
+prn #7
+mov L9[18-c15-c14/c6+c6], r2
+L12: mov #c6*(c14), r5
+mov #c4, r3
+L13: prn #0
+prn #14
+L14: .data 13, -13/4+14
+.data c15+-c6*c14, c14
+mov #2, r5
+.define c13 = 15
+.entry c4
+.fill 4, c14
+.data -c14/c6/-c14+5+c13, 9*13*8*c6*5, 2
+.data -c14*c6/1-c6, 1, 5+c4/c4-(c4)
+.define c14 = -c6-3 + 11-c6*c6-c14/1
+mov #3, r5
+.define c0 = c15
+mov #4, r6
+mov #3, r5
+cmp #c15, L11[c15*c5-c14*-c15]
+mov #-c4+c6/15*0, r7
+mov #0, r6
+L15: prn #2
+mov #-c4/17/c13, r6
+mov #((c6)+c4-c13), r0
+.entry c14
+prn #(-c14-17+0)
+.define c14 = (12)
+cmp #c14, L7[7-15+c4/c14*c15]
+L16: .data -(c13)--1/c6-11
+L17: .data (3-c0)/(6*c4)
+.define c13 = -6/c13/c14
+mov L3[(c14+c4-c6-2)], r2
+.define c2 = -10-c13-c14 + 13
+.define c3 = 11
+mov #c4, r3
+L18: .data 0, (0), 13, c13+c13/c6+2+c14
+L19: .data 15*1*X9*8/c6, 5, (7-20+14)
+L20: mov #-c6, r3
+mov #-c6, r3
+.data (c14), c14-15--7-c6
+mov #c14/c14/c0/6-5, r0
+L21: mov #(11*c4)+13*12, r5
+hlt
@@ -0,0 +1,71 @@
+L0: mov #1*(1)-2*16, r4
+.define c14 = 19
+L1: .data 17+(c14)+19, 5*c14
+.define c15 = c14/1
+.define c3 = 8
+.define c15 = c14 + 0
+.define c6 = c15-c15
+mov #c15, r4
+.fill 4, 2+20/(c6)/c15
+.define c7 = c15
+.define c2 = -(c7)/c6
+L2: mov #(c14), r3
+L3: mov #c2+c7+c2-c2*c2*17, r6
+L4: .data c2
+.define c8 = (18)--19
+.data c15+7--c6*-c8/c2/12, (9/2)-11, 19+c7*6
+mov L0[(c2/8)*6], r2
+L5: mov #--(c15), r3
+.define c0 = -5
+mov #-(20-0), r4
+.data c8/c7
+mov #c7*7, r5
+mov #c0, r0
+mov #-8*-c8/11-c15, r0
+.entry c6
+mov #7, r1
+mov #c2+c15+X9/-c15, r7
+L6: mov #c7/c15/c7+18+-c3, r4
+.define c8 = (c8-c0 + c6)
+mov #10+c3-c7, r6
+mov #15, r3
+.data 14, c3-c2
+.define c4 = -c15*c7/c15+c0-c2
+.define c7 = (c6)
+L7: mov L1[--c6*-c8/15], r2
+.define c14 = c2*(c8)-19 + 16
+prn #-c8/c2+c15-c8*18
+mov #c6, r7
+L8: mov #2, r5
+.define c9 = (c2) + c6
+prn #4
+.define c3 = c15
+L9: mov #c3, r1
+L10: mov L3[-(19)], r2
+.define c12 = (c0/5*c2)
+.entry c9
+L11: mov #-c6*(5), r1
+L12: .data c6+17*c8-19+18/c8, -(7), (c15*8)+(c14), 4/c8/c15/c3-c7
+mov #((12-c4)), r4
+mov #c8*20-15+c14*(7), r0
+.define c0 = -(c3)-9
+mov L7[-16], r2
+L13: .data (7/c7+c0), c3*19*16/5/c8
+L14: .data --c12/c14, -(3/c15)
+.define c7 = 18
+.data (c7-16/(c9)), 10, 10, 7+c8-11
+.define c5 = -c14
+mov L0[c9-18-16/4], r2
+L15: prn #-c14*-c14
+mov L7[(c7)], r2
+.define c5 = (0*6)--8-c15
+.define c14 = 7
+.define c4 = 12+c14/c7/6-8
+L16: mov #14+(c4-c4), r2
+mov L0[18/7+16+12/1*-c15], r2
+mov L15[9*(c0*c9)], r2
+L17: .fill 1, c9
+mov #c8/0-0-c3, r4
+.entry c3
+L18: prn #4
+hlt
@@ -0,0 +1,40 @@
+L0: .fill 2, (9/18*6)
+L1: prn #18
+.fill 3, 0
+mov #4, r4
+.data 9, 19
+.define c5 = (19 + 15)
+.define c15 = -c5*(c5)
+.define c8 = 13
+.define c0 = 7
+mov #-c8, r5
+mov L0[3], r2
+prn #3
+L2: mov #c15, r1
+.define c14 = 12+c8-c8+c15-c8
+.data 6, (c15)
+L3: .fill 1, c5+c8/c14*-17
+prn #8
+.define c7 = c15-c15*17--17-2
+mov #c5, r1
+L4: mov #2+c7-c7+c15, r4
+mov L1[c14], r2
+L5: .data -c7-X9+c8
+L6: mov #-c8+-18, r3
+mov #c14*(c8)/(8), r6
+.define c14 = (c5-19)-11
+mov #(0-c15*c7-12), r6
+.data 19
+L7: mov L1[(6)], r2
+.define c4 = c15*c8/1-c14*3/17+10
+mov L1[(8*c4-c14-c14)], r2
+L8: mov #9, r6
+.data (nope-c8*13), c8
+.data (17*12)+c8
+mov L6[(--L0)], r2
+mov #c14/c4, r4
+mov #c7, r6
+.data 8-1*c15*c8-c7/1, (7)*0/17*-1, (c14-14*12*c5)
+mov #19, r1
+.fill 2, (((c14)))
+hlt
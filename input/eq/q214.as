@@ -0,0 +1,87 @@
+prn #(16)+15*11/19-1/7
+prn #14/-8+20
+L0: mov #6-5*11-12*1-11*4, r0
+L1: cmp #15*15+5*6/(1)*12, L1[7]
+mov #--17+10, r2
+.fill 1, (6/13-4+16)
+mov #-7/15*2+(X9)*19, r4
+L2: .data (18)*17+6/(2*1), 17/5-8*1+16-17+2
+L3: mov #12, r7
+L4: mov #20+7-16+3+20, r0
+.define c1 = 0 + 13 + (11)
+.entry c1
+mov #c1-c1/11, r7
+.data c1+c1+c1-c1*16
+L5: mov L1[11-c1+(2)], r2
+.data 20, (c1*10)+(c1/16)
+L6: mov #-11/20-c1, r4
+.data ((c1))*c1*c1-15-c1, 4-(c1)/12+c1, -0
+mov #(9-(c1)), r1
+.data 12, c1+c1-L0/c1, c1
+mov #c1/10-14*c1, r3
+mov #c1-(c1), r4
+L7: .data 8
+.data -5-15*14, 7, -(c1)+L0, 11+c1-c1-c1
+.entry c1
+mov #9-c1-c1*c1+c1--14, r0
+.entry c1
+prn #c1+15*1
+.data -c1+3/6, 12
+mov L3[-15], r2
+.data 17, c1/0*-c1-13, 2
+.define c12 = 15
+.data -(c1*c12), 19, ((c12)*11*6), 15+18+17/c12
+.data -11*c1, (c12)*c12/(20+c1)
+L8: mov #L0-10, r6
+.entry c12
+mov L6[13/(c12)*c1-9], r2
+L9: mov #15, r5
+.define c0 = (17+12*c12/6)
+mov L0[(18-c1)-c1/c1-15+8], r2
+L10: .data 14/c1-9-c1*c1-c12, 1/c1+18, 7, 11-(2)+c12
+.define c4 = c1
+.define c0 = 6*3/8-2 + 14-12*3
+L11: cmp #--c1/-L0+9+c0, L7[2]
+.define c8 = 18
+.data c0, 0/-c1*16/c0
+.entry c4
+mov L11[((16-c0))], r2
+.fill 3, c12+c4
+.data -2-1+c0+6/12
+prn #2
+mov #(c0), r7
+mov #-1, r1
+L12: mov #c8-c0*c12-c8+13/c0, r2
+.define c15 = ((16))+16
+mov #(c15)/X9-c1*11, r6
+.define c10 = -c4
+.define c11 = 18/12 + c0-c0/(8-c15)
+mov #(c10/X9)*9, r4
+.define c7 = -c11-X9/c15
+mov #0, r6
+.data c11-11*c8+(c15)
+mov L3[-9], r2
+.define c0 = (c0) + -c15
+L13: .data -1+17*9, c0, 7, 16*c0+nope
+L14: mov #c0/(c11+2), r7
+.define c13 = -c0+c0+c15/c8
+.data 11, 20, -5/c1, c13
+mov L10[--c12-13], r2
+.data 2
+L15: mov #c15*11*-19-6, r6
+mov L7[((-c15))], r2
+.data -c7/c7*c8+18, 6, 10, -c10
+.define c15 = 11
+.entry c13
+.define c2 = -c11/-c15+c13
+.define c4 = c2
+L16: .fill 4, c4
+.data -9, (14/c7)*17+7/13+6, c4, c0
+.data (c8)+(c12)/11+10, (c15+18), -14, 20/c0
+.define c15 = (L0-c7)
+mov #-X9+c11/c1, r2
+.data 5, c1
+.data 3, (6)*c0/c11/-c15
+.define c11 = c4
+mov #11+c0/c15-9-(11), r0
+hlt
@@ -0,0 +1,26 @@
+mov #3-12, r2
+L0: .data 1/6/10/8, 3*10+15/-11*18, 10, 6*4/20+16*2
+mov #20+14-5+2-3/7, r5
+mov #0--5/0, r6
+.define c2 = 6
+.fill 2, (c2)
+L1: mov #-c2-19/c2*c2*c2, r6
+.entry c2
+mov L0[c2], r2
+cmp #-c2/c2-3/c2/c2, L0[12]
+.data L0/-13/c2, 16*c2-(-14)
+L2: .data 15, c2+8/11*0+12, --c2+11, (c2)
+mov #-c2, r6
+L3: mov L0[18], r2
+L4: mov #9/12/9/6-c2-c2+(c2), r7
+mov #-c2, r5
+cmp #8, L2[3+-L0--c2-0]
+.define c1 = -c2*c2-7*-10
+L5: cmp #c2-(c1/c1), L0[17]
+cmp #-c1, L0[3+c1+c2*13-c1-c2]
+.fill 4, --12
+L6: .data (c1+4)/(0), c1/c1+c2/12, (18*11)
+.data -0+10*c2
+.define c13 = c2 + -9
+.define c10 = -c2-((c1))
+hlt
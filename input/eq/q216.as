@@ -0,0 +1,47 @@
+mov #(-8*15), r7
+.define c15 = 11/20+9/6*15
+L0: mov L0[-9+7/c15+c15], r2
+mov #((16)*5/12), r4
+.define c7 = ((0/18))
+L1: mov L0[17], r2
+mov #16--c15/c15, r5
+mov #10, r2
+.data 1-L0+12+c7
+L2: prn #10
+.define c0 = -c15/16/c7/c15
+.define c2 = 2
+L3: cmp #16*L0, L2[-c15*c15]
+.define c9 = 9/(c0 + c2)
+.data 3, 7
+.entry c0
+.define c14 = 8-9 + 15 + 11-c7 + c7*c15
+.data 18, --c0-8, 18-10, -c0
+.data (-10)---20, (c7-c0)+c14, c2-12-c2*c14-6-1-X9
+mov #(c14/(c9)), r5
+mov #14-(c0)-11*c14, r6
+.define c5 = c7*c7+c15/(c9)/c0
+.entry c0
+L4: .data ((-16)), ((c2))/(c9/c5), c5, 2
+.define c8 = 13
+.define c0 = (20)
+mov L0[(7*5)+-c15/c14], r2
+.define c2 = --L0*c0
+L5: .data -(13), c0, 6+(c14)/2+4+c8
+mov L4[c2], r2
+mov #--c8*-c5, r3
+.data c2, c5
+.data -((c15))
+L6: mov #c0*-10, r2
+.define c5 = 14
+.define c13 = c5*c15-c5/c9-16
+mov L1[7*c2--c5], r2
+mov #1+c0-8*3-c8/9/c7, r0
+L7: mov #((18)), r2
+.entry c5
+.define c11 = 11
+cmp #13-c5/2-c15-15+7, L0[c2]
+.data (c2+c5)*(20), (c5)/-c8+c15/5--12, 6, (16)-20+c5-c0
+mov #c0, r3
+mov #-20+0, r6
+.data 10*-c7/L0, 16+15/c7
+hlt
@@ -0,0 +1,57 @@
+L0: .data 10, 10*13--5/13+2-9
+L1: mov L0[16*12*9/((19))], r2
+cmp #6, L0[0-20]
+mov L0[7], r2
+L2: mov #8/13*20*(5), r5
+.define c6 = (2)/15-19*(5)*11+5
+mov L1[14/(nope)], r2
+.define c1 = (-c6+c6/c6)
+.entry c6
+.data -c1, 1-4-c1-14
+L3: mov #(11)+17-2*c6*15, r0
+cmp #(c1/2)+-12/c1/20, L0[8]
+L4: prn #10
+mov L1[4/6], r2
+mov #(c6*1)--14+-c1, r5
+.data 3, ((c1))
+.data -20/15-1, -c6-c6*c6-15, 18-13--14+((7)), -c1+c1-c6*(c6)+(10)
+.define c0 = 9+13+c6-6+c1/19*16
+.define c2 = c1/12/17/8/c6-19 + c1
+L5: mov #(c0)-6, r6
+L6: mov #7-c0*2/17/c0, r7
+mov #18, r7
+.define c14 = c1-12
+L7: mov L5[8/6-c14/18/c2], r2
+L8: .data c0, (c2-X9*10+c1)
+L9: mov #2/(6), r6
+.define c0 = -19 + c14 + (c2)
+L10: prn #-c2--c14-c0
+.define c3 = -c6+6*c1
+.define c4 = c6 + 12
+mov #(0*4*1), r1
+mov L5[15+--13], r2
+L11: .data c6+(5)*20*15/(c2)
+mov L6[19+c2+10/c2], r2
+mov #((c0)+19/c6), r5
+.data 17-16+X9+c4, 2+c0+9/12
+mov #c6, r1
+mov L5[c0+-4+7-c0-17*c14], r2
+.data (c3-c2)--c6/c2
+mov #c3, r3
+L12: .data 19, c1, 20, 12-c2/5*c6-c6
+.data 3/(c0)*c4+c1
+L13: .data 16*3+-16+c3*c1/17, X9/(14+c0), (c6+c3*9-c2)
+mov #c6, r5
+.data (5), 20*c3*2/c0*8+c3+3
+mov #c14/14+16-c14*c6, r3
+.data 14-5-5+c1+(16+c4), c4, c3*(5/c4), 13
+.define c5 = 7
+mov #-c4, r7
+.define c7 = c1+c2-c6*c4
+.fill 4, c2
+cmp #c14, L3[c0-12--20/20+-11]
+mov #c1-c0/-9-c0, r6
+.define c14 = -13
+.fill 2, 7
+L14: prn #8
+hlt
@@ -0,0 +1,59 @@
+.define c11 = -(15) + 14*18
+L0: mov L0[8], r2
+.entry c11
+.define c4 = 6
+mov #(c11), r1
+.define c11 = c11
+mov #c4, r7
+L1: mov #12, r7
+.define c0 = -c11
+L2: .data 1, c11
+L3: prn #-16/7+8
+L4: mov #-19, r7
+L5: mov #(19*13+c11), r1
+L6: cmp #((5)), L1[(20)-c4+-c0-18]
+cmp #20, L3[20]
+mov #(c11-6)-c11, r1
+mov #c11*(c11)--c4, r1
+prn #c11/c0/c0-c11-0
+L7: mov #6*7/17+c0/c0, r7
+mov L6[20], r2
+.define c4 = 13+11*9/(-c0)
+L8: .data -(8/2), 15, -8
+.data 7+c4/11, -6*c0+L0, (c4*c4*c4)
+mov #c4/c11/-0+12, r1
+cmp #(c4), L3[3]
+mov #2, r6
+.define c0 = c0/c4+c11
+.data 19+(c0+10)
+mov #(c4)+c0/(3), r0
+L9: mov #-5*17-2*10+0/c11*20, r7
+.define c1 = -c4*c0-c0
+mov #1-(c4)*-14, r4
+L10: mov #-5/17*0*15/c4+c11, r5
+.define c6 = c11
+mov #6, r3
+mov #16/20, r7
+mov #6+c1/18/c0-c1--11, r1
+mov #(11)+20-10-14, r5
+mov #8, r5
+.data c0
+mov #13, r7
+.data (c1/6/c11-c4), 2, 2, c11
+.define c9 = 13
+mov #nope, r6
+.data c0
+mov #c11, r6
+cmp #c9+14+15, L7[8+16/7-c0/(-c4)]
+.define c10 = (5)/X9+14
+.define c9 = c6/3/(0)
+prn #c9-c1
+mov #(c9-c0-19/1), r3
+prn #-16/c4-(11)+14/c11
+L11: mov #c11, r1
+L12: mov #1*(6), r1
+mov #c9, r4
+mov L4[-c6-15+19/c11*11], r2
+L13: mov #19--c4-9-c10*-c10, r1
+L14: .data --c0+c10, c6-9-(12)-6/9*c4*13, 8, c9/-16
+hlt
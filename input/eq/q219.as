@@ -0,0 +1,110 @@
+mov #-11*(4), r2
+L0: prn #10
+mov L0[(1)+(17*nope)], r2
+.data 14
+.data 2+5+20*12, 19, -3/0*5/13
+mov L0[18+(9/8)], r2
+prn #7+9-11--10
+L1: .data 0, -(9)/(11-0)
+cmp #6, L1[7]
+mov #--11+14, r5
+prn #2*10
+L2: .data (14)+-11/6, -(17/0)
+mov L2[-(4)*(2*0)], r2
+L3: mov L3[-(20)*12], r2
+.data 4/2-19/(8)
+mov #11, r3
+L4: prn #1
+mov #(0+11-1), r2
+mov L4[X9], r2
+.define c2 = (((14)))
+L5: mov #-1+12*11/17, r5
+mov #12, r3
+prn #3
+.define c2 = 20+19
+L6: .fill 2, ((9)+c2)
+L7: mov #c2+(c2)/(c2), r6
+cmp #20, L0[(9/13-c2+3)]
+mov L6[7], r2
+mov L3[7+13/1*(c2)], r2
+mov #(c2)+c2-c2-2+c2, r4
+mov #(8*c2+16*4), r1
+.define c13 = -12 + c2/8-c2
+prn #c2+-L0-c13
+.define c12 = c2/5/c2 + c2
+L8: cmp #18*c13, L5[(8)+c2+c2/c12]
+mov L2[(-10-c2)], r2
+.fill 4, c2
+mov #c13*c12--7-15, r0
+L9: mov #13, r4
+L10: cmp #-c12-1/5/2, L5[c13]
+.define c4 = c2
+mov #c4-14, r6
+mov L2[((18))+(c12)/(c2)], r2
+L11: .fill 3, c2
+cmp #c2+9+-c13/c2, L7[c4]
+.define c11 = c2
+.define c3 = 7
+.data c13*7/(9)+4, 13, c12*c11+11*1, 12
+.data 6, c12, -c2*nope+c13/c11, 3
+.define c5 = -17
+L12: mov #-12-c3--c11, r2
+mov #-11*L0/0+((18)), r3
+mov L12[9], r2
+.data 17
+L13: .data -6-c5*15+c11, c3, -11/c2/16+-c5+c2
+mov L10[-c5-c2], r2
+cmp #19, L7[18*(1)/-c12/4]
+.define c6 = c12-c4*c4-c11*c2/c11
+L14: mov #-17*c3*(c13), r2
+L15: mov #13+(-3), r2
+.data 6, c6/15/c3+20--c4
+L16: mov L2[c3/5+c6/c3-6], r2
+.data c12*(c2)-c12, c2+c4, (18-4*c2/13)
+mov #(18*5*1), r3
+.data 11
+L17: cmp #1/15, L12[(c2)]
+.define c7 = -7/c2*c4/c3
+L18: mov #c3, r3
+.data 14-c6+5/18-c5-(c5), (-c3*-c3)
+.data c6/18/c7+c12-1+c11
+.data c13-(c13)-20, c5*c11-10+(16), -16+6/-1, c2
+.define c0 = c5
+cmp #0, L3[20]
+.define c14 = c4
+mov #6, r1
+.data c11
+mov #c0*c7+((2)), r7
+mov L5[nope/c2], r2
+L19: mov L13[-X9*-c0+c7+c0+c4], r2
+.data -11--c7
+L20: .data -c12-5*2*c2+c0-2, c12+4, 19+6+c0-16+c7+c6*c3
+prn #-17
+mov #5/2/c4-8, r5
+mov #c3-10*c6-16+4, r5
+.data 10-c12+(0), c14, ((c2))
+mov #(-11--c13), r2
+L21: mov L2[-3/c5*c2*20], r2
+.define c3 = c4/c6-c0-c11
+L22: .data 7, (5)/c4+15-c3/c14
+.define c9 = c5 + ((1))
+.define c1 = 17*16*c11+(c6)*4
+.define c10 = (11 + 15-c9/4)
+L23: .data 16*c3/2/(14)/-c1
+mov #c4-15+c1*c2*8/c1, r5
+L24: .data c9-17/-8, -c2+10-c1-5/(c0), -20-14/c2*18, (-11)
+.define c8 = 10*16*-2/c2-10+c3*c10
+mov #c1, r0
+mov L7[4/1-(c4)], r2
+.data c2+19
+L25: .data 0-c8+c0, c14, (c8*(c3))
+L26: .fill 1, c10+4-c6+c8
+.data (8)/c14*c2, 6, 0, c13
+cmp #((c10)/(4)), L5[(c3)]
+.data (c4), -18+c3/c3*17+c5, c2, c4--c2+14-c10/c11*3
+L27: mov #((c1)/c0*9), r5
+prn #-17*9+16+nope
+mov #c3, r6
+.entry c7
+.data -12+8/0/c1+c5+c2, -c3*c5+c5-c0+3, -0-9*((12))
+hlt
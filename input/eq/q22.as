@@ -0,0 +1,38 @@
+.data 3, 3/4*-17+1, (9)*1-10+-20*12, 6/4/3
+mov #6, r2
+.define c0 = 11
+L0: .fill 2, (3)-15/5+c0
+mov L0[20], r2
+.define c1 = (c0)/5
+.data 20
+.data (c1), c1-10, c0, 6
+mov #c0*8+19-((c0)), r5
+mov L0[4+c0-(-c0)], r2
+.define c2 = c1 + c1/3 + c1 + c0 + 1
+prn #c2-((9))
+prn #16
+L1: mov #14+c2-18*c0/4, r5
+.data 2
+.data 9/7+(14)-c1*6, -c2-7-16-c2--c0, 16*c1
+mov #c0, r2
+mov L1[c2/3/1], r2
+.data 5+-c0*c0-0, (c0)+10, c1
+.fill 4, c2*15+14*8*c0*7
+.data c0, c0-c0*-9*c1/2-7, c2-c1-(4)/5, (-c0*c2)
+L2: mov #--11/1, r6
+.data c2, -c1*c2/3
+.fill 1, (c1/4-c0)
+.define c3 = c2
+.fill 4, (0)*1+c2/1
+cmp #(c1), L1[1]
+L3: .data c0-c2-c1-1+c3, 1*-8, 20, 18
+L4: mov #(8+19*c1+c3), r1
+mov L2[(16*c3*(10))], r2
+mov L0[((13))*c0*19-c1], r2
+cmp #12, L2[-(19)-7+c0-15-13]
+.fill 2, 5/10/7
+.define c4 = 8/3-c1*16 + -c1 + -c3
+.define c5 = 14/1
+mov #8, r1
+L5: .data 5+17
+hlt
@@ -0,0 +1,116 @@
+prn #(-18/(5))
+L0: cmp #9, L0[5]
+prn #10
+.define c5 = 0
+.define c11 = 16/((2))
+mov L0[2], r2
+.data 15, -0/c5/c5, c5/c5+-c5
+.data 19
+.data -20*c11*-7, c11, 12+c11-12*3*9
+mov #20, r7
+L1: .data c11, 2/c11*(7)-c5*12
+.data 0, 6, c5, 0
+prn #c11*4+c11/c11
+.define c2 = (c5 + 13)--4*c11
+mov #(c2+12), r4
+.define c12 = c11
+.define c14 = -0/c11-10 + c12*3*c11
+prn #c2-9
+mov L1[-c5-3-17*c14], r2
+L2: .data 6*-c12/c12*5+6+c11, 4, c11-c11-c14/6
+mov #-17+10/17/c5/14*3, r7
+.define c2 = 4*c5
+.define c1 = c12+0+9*c5+4+15+c14
+.fill 1, -18*c1-7
+mov #-5/3*(c11), r1
+L3: .fill 4, 9
+mov #(c1+c14)-c2*-7, r6
+prn #c2*10*0+c12
+L4: .data c14, ((c14)/c5/2)
+mov L1[9+c11-c14-(12)], r2
+.data 1, (7)/c2+c11/c14, 10-c14*c2-20+c2, 18
+prn #(c1)
+mov L4[c12+9-18+c12+11-c1], r2
+L5: prn #c2-c2+9*c2+17
+mov #-c5/-c11, r3
+prn #c5-14/17/4/c2-c2
+.fill 2, -c14/4*c11+13+15
+.data c1
+L6: .data 7, 1/c11*(c11)/18*c2*7, c11
+.define c14 = -c2/c1
+.define c12 = 7/15
+mov L5[2+(15)/c14-6/-15], r2
+.data 5, 5, 4
+.data X9-c14/16+c14+4
+L7: mov L3[-16+c12/5], r2
+.define c1 = 0-11-c5-9/(c12)
+mov L4[c1*17+c12-19-3], r2
+mov #c1/5+15--16+12, r4
+mov #(c2+c12/16), r5
+mov L4[(c5)+5/5], r2
+.define c8 = c12
+mov L1[c11-4/c8/c14+12+c2], r2
+.define c15 = c14 + L0 + 13*19 + c1
+.data -19*c2*-12+(8), 19, (-13*c1), c14
+.data 9*c1*1*-(c1), (c2/4-(14)), 13, c11/(c12+c12)
+L8: .fill 1, c8
+.define c15 = (16)/3-c14+8
+L9: prn #c2*c5/9-c12/4*19/0
+L10: mov #8, r5
+.data c14, 10
+.define c9 = -18+15+11
+mov #-9, r7
+.data c9*(1)+c14+c14, 12+c2+17/0-(3)
+.data -19-20*c15
+.data c1
+L11: mov #17, r4
+.define c12 = 7*c1
+.data -1-c12+c1*11
+.entry c14
+mov #(-c15+5*8), r6
+L12: mov #-(c12)*c2, r5
+.define c12 = 3
+.define c5 = 7
+.define c2 = c14+c12/6-c2/18*19*9
+mov #c2-7/c12/6/-c1*c14, r3
+.define c5 = 1-18-16-c5
+mov #11, r0
+cmp #4, L4[1/15*13-(8-c12)]
+.data -c11+5, (nope)/(c9)+c2, 7*c2*-c8-18
+mov #c15, r7
+L13: mov #(12-17-c14/0), r4
+.define c0 = 3+-c2
+.data -8-20+3*15-9, c11-c14*c14/c8, c14, 19+19-1
+L14: mov #3, r4
+mov L12[c12], r2
+.define c14 = 20
+L15: mov #18/c11*c14-3*c11, r6
+mov L10[c5], r2
+.define c6 = -(c11)-c1*9-1/c12
+prn #c8
+mov L9[13/2], r2
+mov L1[-c15/9-11-c9+-c1], r2
+.define c6 = 9
+.define c5 = (7)
+.data c5, 8*19/6*c12, ((c6))-c5-3*(c14)
+.data (c6/c5-c2-c5), c14, 5, c14/-20
+L16: mov #-c6*14--c14*18*11, r2
+mov #5, r7
+mov #19, r5
+L17: mov L1[12*c5+c5/(19)], r2
+.data -c6, -10*19/c2+13*c2-c15
+.define c2 = -(c0)-14*c12
+L18: mov #c2, r7
+.data (c15+9)*4/16-6+5, 4+5-c6/-c1, 6, c5-c6-3-c5+1+8
+.data (2+-c6), ((2/15)), (2)+c12*c2, 16+17
+L19: mov #11, r0
+mov L17[((c9))/c5], r2
+.define c11 = -c6
+.define c7 = 13
+L20: mov #6/15*c1/c15*c5, r5
+L21: mov #-17/1+16/-14, r7
+cmp #c5*17*-2*-15/c15, L1[c12+(c7)]
+.define c3 = 3/c2+(c6)+c9-c1*12
+.define c5 = c8/c15 + c9/10/c5*17
+cmp #10+18/14*c2+c6, L9[(15/c6+c6)]
+hlt
@@ -0,0 +1,52 @@
+.fill 2, 13-19+3*15+2
+.define c8 = 16+19+6
+.entry c8
+.entry c8
+.data (13), (c8), nope
+.entry c8
+.data c8, -1*1/c8
+.entry c8
+L0: .fill 2, c8*20*c8+c8--8/9/c8
+L1: mov L0[(15)], r2
+L2: mov #7-c8-c8*c8/13, r2
+cmp #c8+c8*c8*0/c8, L0[(7+c8)]
+L3: mov L0[(3)], r2
+mov #-(15)*c8*12, r0
+.define c3 = c8*20/16/c8
+.define c0 = --c8+c8*c3-c8
+L4: .data c3, (3+15)+c8, 17, c3-c8*X9+c8*c8
+mov L2[-17/c8*14], r2
+mov #c0, r7
+.define c0 = (c0)
+mov #12-c3, r2
+.define c1 = c0
+.data c3
+mov #c3, r6
+L5: mov #c0, r6
+L6: .data c0
+L7: cmp #c0, L0[0]
+.entry c0
+cmp #c3*c3*c0*c8-1, L3[-c0*c8-c1]
+.data c8+20, 7+(c1*9)
+.define c2 = 1
+mov #c1, r1
+.define c14 = c2 + c3--c1 + 20/c1
+.define c2 = c3
+mov #8, r4
+.define c5 = c1
+mov #13+(-c14), r0
+.fill 1, -c0*8*5+c2*c0
+L8: .data -17/c2+-c0, c0, (5)/-(4)
+.define c7 = c2+2/-c5*-2*nope
+L9: .data 11, c2--(16), -5
+.define c3 = 15-c0 + 5/c1
+mov #18, r5
+mov #((c1)), r4
+.define c13 = 10-c2/7
+mov #1--c2/-c3/c13, r5
+L10: mov L3[c3*2+c3+c3/-8], r2
+.define c11 = (20*6)
+.define c13 = 4/c14
+.define c15 = (0)-11-11*(-c13)
+L11: cmp #7+9, L1[12-(c2)*c5]
+hlt
@@ -0,0 +1,120 @@
+.define c1 = 14
+L0: mov L0[c1], r2
+L1: .data 19*c1/16/c1, c1-c1--2, c1/c1
+cmp #-c1, L1[c1]
+L2: .fill 2, c1/(0)
+L3: mov L3[14*17*c1-10-c1], r2
+.entry c1
+L4: mov L1[18/c1--c1+c1+L0*c1], r2
+mov #c1-14/c1+18/L0, r5
+mov #14-c1*c1/3/c1, r3
+L5: mov L2[-c1/c1/16], r2
+.data c1*c1-c1+c1, -(6)-0*14+c1, 17
+mov #(c1), r5
+.fill 2, c1*c1*16-(11+13)
+mov #19+5*c1-c1*c1, r2
+mov #17, r2
+.entry c1
+.define c9 = --17-20
+.data (18-12)-c1*13+6*16, (3), -13*c1*5, -9+-3-c9
+.data 2, c9+-(8), 14, -c9+c9
+L6: prn #c1
+mov L3[-c1], r2
+.data 20
+L7: mov L5[c9], r2
+.data 19, (c9-19/14+0), c1+-c9*c1, 5
+cmp #13, L3[c9]
+.data 0-17/c9*c9/c9/c1
+L8: .data 7, c9, 17--c1-c9/c1+19*3
+mov L0[c1+15-c9-c1/c9], r2
+mov #c1+(c1)-c9*c9, r0
+cmp #-c9+c1*13*c9*c9, L1[c9/20-c9+11/13+10]
+.data -7, 18*c1, 14*4/c9-c9/c1
+.define c8 = c9 + 7-4*c9
+.data 15*c1-2/17*c1+c9
+.define c7 = -c9*c1-(8)*6
+mov #(15), r3
+.define c4 = c1
+.data 17, 10-c9-7/c9*14*2+c9, 2+(c4)*-16
+cmp #13*c8*11*2/c7, L7[((c1))*10*c1+8]
+.data 7, 0, c8, (c8)
+cmp #c7-17+4-18+16+(c9), L3[c7/15]
+.define c7 = (c7)-c1*c9--0
+.define c7 = 2+c1+19/10
+.data -14-16, 7, c7, 5+3/(c7)-c8
+.data (7/c8-c7*3), c9*c8-(c7)-10-c7-c7, c4
+.entry c7
+L9: prn #16/6+c4+19-10/12*18
+L10: cmp #-c8*c7+4-c4, L6[-c7*c1*19]
+L11: .fill 3, c7
+prn #c7*c4/c4-c7/6
+mov #13--6-19/5/c7, r5
+L12: mov #7/c4*c8*c4*c7, r5
+.define c14 = c4
+.define c11 = 1/c7/14-6
+mov #c1-c11+c11-1*3, r4
+.define c7 = 16
+L13: .data c11-c1+8*18, c7-8/c7/c8*c4-c7+c1
+.data 9+-14-c8, (5*9), 14
+mov #(c11)+4-c1+3/c4, r3
+prn #c7
+mov L12[((L0)-(c14))], r2
+.define c1 = 15
+.define c12 = 6*c8/c9-c7/8
+.define c6 = -14*18-c7
+mov #c7, r1
+mov #c6, r3
+.data -c7/18+c7*17/20*c7, 11, -c4/5
+mov L8[4], r2
+.data 13
+mov #-(1-c11), r4
+mov L12[12], r2
+.data 6-c7
+.data (18), c14-6+c6+c8*-c6+7, -20*c7/c8*10
+.fill 4, -c7*c7+c1/c11
+mov L10[-c7*c6+13], r2
+.define c11 = -7 + X9-c9-0
+.define c10 = (3*16)
+L14: mov #c7, r3
+prn #13
+L15: .data 13+c11/c12+13, c12+c1-c14, 6/c9+-c10--c12+1-4, 8
+L16: .data c7, 2*c6-c6*8+c4/c6, -4+17/0, 14
+mov #-c11/c14-13/5, r0
+mov #18--c12/15, r6
+L17: mov L5[13/20+c10-2/c7], r2
+mov L13[c14], r2
+mov #c9, r4
+.define c4 = c8-2+c1/-12*20-c1
+mov #c12+(c6-10), r5
+cmp #15, L7[c4*20*0-c9*c7+c6]
+.data 9, 18/-0*20, 14
+.data -c7/c11*c1/-c14, -5*c7*0
+.entry c10
+prn #16
+L18: cmp #c9, L5[13+8/-c14-(c11)]
+.data (11)+4, 13+9, c10/c7/10/20
+L19: prn #-1-4
+prn #16/9
+.define c2 = ((20))-c7/c8 + 11-5
+.define c5 = 18*c8-c1 + 6/c9/c10-c8
+L20: .data c7, -(c7)-c14, c9+13-c1
+mov #c7, r1
+.define c7 = c4-7-1+3+20
+L21: mov L4[-c11*c7], r2
+mov #20, r7
+cmp #-c12-14+2, L14[c7+c7/1*10*0]
+mov #((X9))*5+c8*2, r2
+.data c5*L0, c2-0/0/7+-c9, (c7)/-c1-c8*20+14, (0)
+L22: .data (-9*c14), 11-6/16*6
+.data -6, 5
+mov #18-c1/7, r5
+.data -4, 17, c1, c9
+L23: .data -7*c1+c7/c7
+L24: prn #c6/6*-c10/4-18
+L25: mov #(8-15)--c10+0, r5
+.fill 2, (c4)
+mov #3, r7
+.data c10, 11, (c4-12--c7), 15+3+c7+5/c5*(c1)
+prn #12*16/1
+mov #0, r2
+hlt
@@ -0,0 +1,63 @@
+L0: .data 20/(8)+5*11+11
+.define c15 = 2*0*0 + 9/18
+.entry c15
+.fill 1, 18-c15*c15-c15*c15
+mov #7, r4
+L1: .data 16, (c15), c15/-c15-8+c15+(10)
+L2: .data 15-c15+c15/c15, 19-20, -0*c15+16+(17)--c15
+L3: .fill 4, c15+7-L0/c15/(2+20)
+.define c14 = 12
+mov #-1-0-c14, r3
+.data (15), c15, c15+c15-(11)+5*20
+mov L3[c15], r2
+mov L0[1], r2
+L4: prn #--17*10
+mov #6, r7
+.data 7
+mov #c15, r7
+.define c13 = 18-7/11/c14
+L5: mov #c14, r2
+.data 6
+.data (-19/10)
+prn #9
+.data --c13, 8, --c13, 1
+.define c14 = (5)/c15
+mov #(c14/15+c14-10), r5
+.define c15 = c13 + c13 + 9/c13/c13 + 1/c14
+.define c5 = c13
+.fill 3, (20/c15*c15)
+L6: .data 5, c14
+mov #c15-12, r3
+mov #-6/1/c15+11*(c14), r3
+mov #-(c15)+6, r7
+.data (c14/18)*c14, (c15), 12
+.define c4 = -c14-c13*(4 + 19)
+.define c7 = (c5)*5*(7)/15
+L7: mov L0[-7], r2
+.data (c5*4)+-c4/c4, 15+c5-1, c15
+L8: mov L6[7*(20/c14)], r2
+mov #nope-c15*16*20+0, r6
+mov #4*c15-14*c5/12, r5
+.data -c5+c15+-13*8, c15, 9/c13/c13/-c14
+.define c10 = 10
+mov L7[((c15*c14))], r2
+prn #c13-c14
+mov #1, r0
+prn #c14-(c14*0)
+.define c8 = (c4/8) + 10
+.data c8-11-c8-13, 4
+L9: .data (c4/18+2*7), 4, (9/c4)
+L10: mov L8[8], r2
+L11: mov L6[c10], r2
+.entry c8
+.data c14+c14, ((c13))-c15, c8+(10)/3+c4+15*c14
+prn #10-(18)+12*16
+L12: mov #2, r5
+mov L5[8], r2
+mov L4[0], r2
+L13: mov #8, r7
+mov #1, r4
+.data (c13+8-c7), 19, -18*4*5-c5-c13
+mov L3[20+0+(6)], r2
+mov L1[c15--c13], r2
+hlt
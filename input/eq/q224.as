@@ -0,0 +1,29 @@
+prn #8-16
+L0: mov #20/2/19-(3), r0
+L1: mov #18, r7
+.define c14 = -3/16+0-14
+mov #1, r2
+.define c3 = -c14/9/13
+.define c0 = -c14-14
+mov #((c3*20)), r5
+L2: mov #c3, r3
+prn #--c0
+.entry c3
+L3: mov #15/7*c0+c0+c0, r6
+.define c11 = (c0)-c14+8-(19)
+cmp #(-0)/(8/16), L2[c14]
+cmp #c0, L1[9-c3]
+L4: mov #c0*-c14-c14, r6
+.define c7 = (-20)
+.data c11+c3, 11-3/c7*4, c11+c14*17, 6
+L5: mov #(11+c0*-c14), r0
+.data -c3-2, c14
+L6: mov #c3, r0
+.define c10 = -2*c0-9*c11
+.data -(c10), 18
+.define c6 = c10
+.entry c14
+L7: mov L4[6+20+6*9*-0-c3/c0], r2
+cmp #-1, L0[-c11]
+.fill 3, 14/11*c10/2*-17
+hlt
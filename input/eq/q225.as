@@ -0,0 +1,110 @@
+L0: prn #(13)-13*6-4
+L1: mov #-6*11*9*-0+9, r3
+mov #12+9-10-(15), r3
+.data (5*nope)/-2, 8, (5*7+13/10), 0
+mov #3-13+0*20, r5
+prn #0
+.data 18, (6-18--6), 4, 3
+.define c9 = 0/9 + 2--13-(16)
+.entry c9
+mov #-7*19+c9+10, r5
+L2: mov #(c9-14), r4
+.fill 2, (19)
+L3: mov L0[c9], r2
+.define c3 = c9*4+c9/-c9-10
+mov #-c9*c9*0-c9, r1
+L4: mov #2*c9+1/-18, r3
+mov #c3/c3/15-17+2-c9-c9, r0
+L5: mov #13*15-c9*c3*c3/(c9), r0
+L6: .data c3, c3, c9, c3/(c9)-X9-10
+L7: .data -4-c9-7/c3/c9-1
+.data c9*c9/c3, 20, c9+c9*3+c3/c3*c9/20
+.data -18/1/19, c3*20, 11, 0
+.fill 1, 20--c3-1/-17
+mov #-c9+c9--15/-c9, r1
+.data 18
+mov #12/-12, r4
+.entry c9
+.data c3*13-0+5-c3
+L8: mov L1[(c3/4)/0*c3-c9], r2
+L9: prn #c3/c9
+.define c7 = c3
+mov L0[c9], r2
+mov #11, r3
+prn #c7/c7-19+-6
+prn #(16+c3)*c7
+mov #c3-(c3*9), r5
+.define c9 = (c7)/-7/-10
+.data --11+3, 14, 12, --c9-2+c9
+cmp #-c3*10, L7[12/-c9+0/c9]
+.fill 1, 0
+mov #(-3/c3), r0
+mov #(18-c9)/c3-19+-c3, r0
+.define c7 = -c3-c7*(c3 + c7)
+.define c11 = 3/18*15/9
+L10: .data c11*-12*4, (6/(3))
+L11: mov #13*c11*4/c9, r7
+.data c3+7*c9/(12), 3/(12+18)
+.data 2, c11/c7/c7-c7*-c9*c7, 9, 14
+cmp #5, L8[9*c11]
+cmp #6*1/(11)-16/c9*c11, L1[c3*L0/c11-c11--c7]
+L12: mov L11[c3-4+10+19*17], r2
+.data -14/c7*c7-13+c7, c11/c9
+.define c7 = 15 + 4-c7 + c11-c11
+.define c9 = (15*9)+5*0*c7-7
+mov #c9, r7
+.define c9 = c7
+L13: cmp #-10/c3-9, L7[2]
+mov #c9, r0
+L14: .data -(3/X9), (c9)
+L15: .data 1, -16*12/(9*19), c7/c11-c3/10
+.entry c9
+prn #c9
+prn #15
+.define c8 = 3*c9-11-8-(12)-1
+.data 6, -6/c3, 17, c7+18+16+c11
+.define c12 = 13
+L16: .data -c7*3-10/1+c7*(9), --c12--17, ((-13)), 3
+.define c4 = 10/16/18--(c3)
+mov L1[((12))+L0], r2
+mov L13[(c8)*(c9)/5/11/0], r2
+mov L10[(1)-c9/c9+c7-7], r2
+cmp #5-14/-c9+-9/(11), L6[c7/12-c12-c11/10]
+.data c9, (c8)*c9+c8-11
+.data (17)-c11+-1
+prn #c12-c7+9
+mov L12[(-c8+c8)], r2
+.define c9 = (c12-2)*(18)
+.define c1 = 14/20
+cmp #-c4+c9+(c9)+c7/c9, L4[(c9+18/c3)]
+L17: mov #-c11/c9+4, r6
+.data -(20-c9), 17-19*13*10*((1)), --9/12, -c11/c1+1
+L18: mov #1-11/(c3)+5, r3
+.data c7, 11/7, -20
+L19: mov #6, r4
+.data c9-(1)-(c7)-11, X9-15*4+(17)
+mov L5[(0*20)*13/c9-(c9)], r2
+.define c8 = 12
+mov L17[((3*c7))], r2
+.data 0-19+c9+c3+19, -c9*-nope-6*c9, c3+c9-8-10+9
+prn #-20+12/10
+.data 15, c11/c8
+.data c7*2*-c7-c9
+L20: mov #c9, r7
+mov L4[c9], r2
+L21: mov L20[0], r2
+prn #(7)--2+c9
+mov L13[6], r2
+mov #-((c8)), r4
+mov #12/9+15+c7-(6), r6
+.data 4+13+c8+12*c8, -12, -0, c9/(c7)
+.data -4/7*c1*c11/-c9, 4-c3-c11/c9, -c9/c9+(3*c12)
+.data -c9/16/8, (16/17)-(-c8), c7, 8-c9-(4)/20
+.data c11, 19
+.data 2, 5, c12, -c9-c8*c8*0*c1/c11
+mov #-c9, r6
+L22: mov L17[6/1], r2
+.define c12 = c8
+L23: .fill 3, (-16-19)
+L24: mov L24[c4], r2
+hlt
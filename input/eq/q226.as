@@ -0,0 +1,82 @@
+.define c1 = 12
+mov #c1*c1*1+17, r3
+.entry c1
+L0: mov #(c1), r4
+.entry c1
+L1: cmp #c1/1-c1-c1/(c1), L0[-c1*c1]
+.data 19, c1
+L2: .data 13, (7)/10+c1-L0
+L3: mov #5, r2
+mov #c1, r2
+.define c7 = c1
+.data 5+5-c7-c1*c7+c1/11, c1, 3*2
+mov #20/11*c7*2-c7-5/17, r2
+mov #(c7-c7*c7-17), r7
+mov L2[c1], r2
+mov L1[c1/0--14+6], r2
+.define c12 = -17+5-c1/-c7
+L4: .data c7-14+6/c12, c7/c7-15+(-c1), -c7, 6+12*(c1)
+.define c1 = --2-(20)
+L5: mov #5, r6
+.data -10/10*c1-(c1), 9, (c1)
+mov L5[(c1+c12-17-20)], r2
+.define c11 = -c1/c7*(c1)
+.define c15 = c1--c7-c12
+L6: mov L6[2], r2
+.fill 3, -(1)+8
+prn #3
+.define c9 = (c11)*c12
+L7: .data 8
+.define c5 = 0+14*(19)*13
+.define c5 = 1*c1
+prn #c1
+.data (-c5)/8+20/(14), c12
+mov #0, r5
+L8: prn #-3/20+16-c5
+.define c7 = c1*(7)*c12
+mov #c7, r7
+prn #-13--c9--4
+.define c4 = c1
+L9: .data (c4), c1
+cmp #((c7-14)), L3[9]
+.define c7 = c4
+.define c12 = (7 + c9) + c4 + c15
+L10: .data (c12)+c12/c5-c12+5, (-20), 15-12*c1/c15+3*9
+.data c7+4*c9-c7-c7
+mov #-c5+19*-c5, r7
+prn #(16)
+.define c9 = c5--1
+mov #-2/c7+6/c15, r7
+.fill 1, c12
+L11: .data -c7*11/c12, c12, c12*14-c12*19/15, (19)-c5-c7-c12
+.entry c1
+L12: .data c11*c1-18+(c5*c15), -c9-c7-20/-c1, c1+c1-7, ((c5/9))
+.fill 4, (-11)/-20
+.entry c9
+mov #4, r0
+L13: cmp #15*-c7*c1, L7[-5-5+11+6]
+L14: .data c5/c7-5
+mov #c1/15-c9*c5-9, r1
+mov #7*4*3+c5, r7
+.data -(2)*2*18, 12*c7/c7/17, 13*14+c7-c7
+.fill 2, c12/0+c7/19+c12/-3
+L15: mov L2[17*0], r2
+.data -c7, 4/c12, -8*c7*c7, (c5)
+.define c1 = c12*c15/-6 + 12 + 20/0
+.data c5/c12+c1+1*(c9-c7)
+.entry c4
+prn #c7*16-5*19-17
+mov #5*(c4)/(c7-18), r7
+.define c15 = c7
+cmp #9, L9[-c12/10-c9+c7]
+mov L8[(2-3)-c12+1/-c9], r2
+.data c5, -14, c9+18+-13*(c1+c4)
+.define c12 = (c15)
+mov #(4*19+20), r0
+L16: mov #-7*-19, r6
+L17: prn #(13)/10*(c1)*c5
+.define c9 = 20+12*c1+10
+cmp #1*9*c7+3/c9, L16[c1+0/c7]
+.data 6/2, --15+7
+.data c12/(c11)*2+c15, 0
+hlt
@@ -0,0 +1,72 @@
+prn #-(1)
+L0: mov L0[0], r2
+.data -2/11/4-5, (3-0+12+14), 6-7-11, 0
+mov L0[-6], r2
+.define c6 = (19/9/-5)
+mov #c6, r0
+.define c6 = 16
+.define c8 = -c6
+L1: mov L0[3], r2
+L2: .data -c8/10*9/15, (19), 3/(14), 0
+.data c6, (c6), -c8+c8/c8, -4*15/c8
+L3: mov #0, r3
+.define c12 = (c6)*c8*16*c6
+prn #5*13/c6-16/15
+mov L1[c6], r2
+.data -c8, c6*c6+15
+mov #1--c6-c6+14, r6
+.define c3 = (18/15 + (c6))
+L4: prn #0/c8+c12*(c8)
+.data 7*c12, -c6-9*8, c6
+mov #8, r6
+.data (13)/13/c12/7, ((9/11)), 1, 16*-2/c6
+mov L3[c12], r2
+.data 0*c3*5*(8), (17), 6
+mov #c12/7, r5
+mov #c8-10/14*0*18-8*19, r2
+prn #1
+.define c6 = 20-c8 + c8 + 10/11 + c6
+mov #-c6*X9, r2
+.data c6/c6+16*(c3+X9)
+.define c14 = (c12*c6)+13
+.data c6, c14/19/c12+c3, c12, (c6)*3*c8
+mov #c6+c8, r5
+L5: .fill 1, 4
+.define c12 = c6-c3*c8-15 + c12
+L6: mov #c12/4, r7
+L7: mov L0[(c6/c6/c12/c6)], r2
+L8: mov #((18)), r4
+L9: mov L4[(c3)], r2
+.data c3
+L10: mov #17, r7
+mov #14/c6+17/5, r0
+.data 7, 8+c14, c14*17+4/c6*c12, 18
+L11: .data 6--18/c12, 5
+mov L6[c3], r2
+L12: mov L0[9], r2
+L13: .data c14, (-7-c12/c12), c12+7-c6/c14/c12
+L14: mov L12[(c12*c8)--c12-18], r2
+mov #c12, r4
+L15: .data 17/17
+cmp #c8-(18), L11[19-c8/c6+c6/c12]
+.fill 2, c12+20+c6+((8))
+L16: mov #c12/(c3/c6), r3
+mov #-c12, r3
+L17: mov #c8/14/7*0/c3*6+12, r0
+.define c12 = -c14--18
+.entry c3
+mov L13[16*17], r2
+.data (6)/c3, --c6-12+2-c12*18, c12*(c6+c6)
+L18: mov #c12+(c6), r5
+cmp #c6, L3[c12/1-c12-8*X9]
+L19: .data 14/c14*c6-15-20, 19+c6/9*-c12-c14, 20/c6/12*-5+8, (-19/3)
+L20: .data 9, 1
+.define c12 = --18*-11
+.data -18*-c12+((c14)), -X9+c6-c12/c12
+.define c7 = 3-11-c12*c8/1-1/c8/c8
+mov L9[c6*c12*(19)-c12/17], r2
+L21: .fill 2, (15+c12/1*19)
+L22: mov L3[(-4*12/c12)], r2
+mov L9[15-3/c8-c12*c7], r2
+mov #c12+c6-9*c6+2/7, r7
+hlt
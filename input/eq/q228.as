@@ -0,0 +1,117 @@
+L0: mov #19, r7
+mov L0[9*2/14-19+13/20*18], r2
+cmp #3, L0[8-3]
+L1: mov #-19*16/2/8, r7
+.data 5, (9)*6+20+((4)), (1*18), 20
+mov #-2/X9/18-20, r7
+.define c14 = 17*nope-6+7+10
+.define c11 = (2/12)/-11
+.define c12 = L0
+L2: mov #c11*-14*18, r5
+cmp #(9), L0[c11]
+mov #2, r2
+mov L2[9], r2
+.define c10 = c12 + c12
+L3: .data (c10), c14
+cmp #L0*((7)), L2[(c10-c12/c10*0)]
+.data c11*c10-c12/10
+mov L2[(c11)], r2
+mov L3[1-c12-15*c10/5], r2
+.fill 3, 19
+.define c13 = -c12 + c14--c11
+cmp #4, L1[(2)-0*4/2]
+.define c4 = c10
+.fill 3, 20+c11*c4*9-(-c11)
+L4: .data c12
+.define c5 = c11
+prn #2
+.entry c11
+.data c10, -c11+11-(20)-11, c4
+mov L4[c12], r2
+.data -4-c4/-c12, 1
+.define c6 = -9
+L5: mov #c4, r4
+mov #c14, r7
+mov L1[20], r2
+L6: mov #0, r4
+mov #-16*16, r1
+mov L2[((11-13))], r2
+L7: mov #c6/1/c14/c10-c10, r2
+L8: mov L4[c4/17/-5*c6/c11/11], r2
+mov #9*c5+(c5/c6), r4
+.data c14/-12-10*19, -16-c5-(c14), 11+16/7+7*c13, (c4)
+L9: mov #(c10+7/7*c13), r6
+mov #4, r4
+mov #-c11*10/13+12, r5
+.define c8 = --c11*c10
+.define c1 = -4/c8
+.define c14 = -c14
+mov L6[5], r2
+L10: .fill 3, (c1*19)+c11
+mov #c1/(-9), r7
+L11: mov L0[-9/10], r2
+L12: .data (1)*-0*(c14+c6)
+.define c4 = -c8*c10-1
+.define c7 = -c12 + 16-15
+mov #7/c13, r3
+L13: .data c8, 6
+L14: .fill 4, 2
+mov L2[19], r2
+cmp #(20), L11[c4/c4-0-18-17/c4]
+.define c10 = -c14-c7/14*(c12)
+mov L12[(19)], r2
+cmp #c14/8-0-X9, L9[3+17/c8*c11+c4]
+L15: mov #c1*c10, r6
+.define c3 = (15/13)
+L16: prn #3/15-c4-18/-20+(c4)
+L17: prn #c14
+L18: cmp #c5, L4[4*c1+c4+13-c3]
+L19: mov #-c1-2*(c12)-14, r4
+mov #6, r7
+.data c6+-c8*17
+mov #16/c5-c12, r1
+.data 9, c6/6/c4--c8*16
+mov #-(14*c12), r3
+mov #c10/c6/0*7*5*c6, r2
+mov #17/11-c13*c4, r3
+cmp #6, L5[c11]
+prn #-(19+c10)
+.data (c6*5*4*2), 4, 8, -8+c13/3/c8
+prn #c12*-11+14+c6
+mov #11, r6
+mov #0, r6
+.data 0
+prn #c1--5/c1
+mov #c11*16*(c11)+-c8, r6
+L20: mov #18, r5
+.fill 3, -17
+.entry c14
+.define c1 = c14
+.data 6, c7, 8/c5-c1-c14
+mov #-1, r7
+cmp #4/c1-c13+4/18/20*c3, L6[-(c4)-6]
+.define c15 = c14+c13-c5+c7-16
+mov #0, r5
+.data c10/20-c1*(6)
+mov L6[c11], r2
+.entry c12
+.entry c14
+mov L12[((16))], r2
+mov L9[17/c11+c8+10*c14*15], r2
+.data (10)/c10, (c4)/c4+c12, c1+c13, 20
+mov L16[(c15)], r2
+cmp #((18)-c11), L10[(c10)]
+.data (c14/18)*5-4-c12, c12-4+2+c4/c10*(9), -(c14/3), --11/20
+L21: .data 10
+mov L20[(7*1)+19], r2
+.define c5 = 12/8 + c7*7*(20)
+.define c10 = c1
+prn #c12-3+c12/16/c13
+L22: prn #--12/4-c10
+.define c3 = 0
+.define c6 = ((1))
+.define c1 = 5-18/c3/c13-c1*12
+cmp #(c11+0)*-c14, L17[5*c5*(13)+c1]
+L23: .data 11*(0*6), 4, -12/c12*1
+.define c3 = c1 + c5-(8)*20*c4*7
+hlt
@@ -0,0 +1,88 @@
+.define c13 = 19-0/10 + 5
+.data (9/17/11+c13), (c13)
+.entry c13
+L0: prn #0+9
+L1: .fill 1, 5
+.data 4, -c13-c13/(20), -3, c13/c13*5*4/17+c13
+.data -c13-c13-c13/c13, (-c13-c13)
+mov #((14)), r5
+.data ((10)), (c13*13*9), -13-20*c13+17*17+5, 16+6/c13-c13
+L2: mov #4, r1
+prn #12
+L3: mov #c13, r2
+.define c4 = 9
+L4: .fill 2, ((10))*c4/16*6-c4
+mov #(-1)+3, r2
+L5: .fill 3, c13+-c4-8-19
+prn #7
+.define c15 = 15
+.entry c15
+mov #c13---15, r3
+L6: .data 1, ((-10)), 18, c15
+.define c7 = 6
+.define c9 = 11
+L7: mov L6[10], r2
+mov #17, r0
+L8: .data 14/c9*c15+14*c13, 18, -18+-c4, 14+(c7)
+L9: mov L6[c9--10-c7], r2
+cmp #-5-c15, L3[8]
+L10: mov #c15, r1
+L11: .data c7, (c4*c13*17-c15), -8, 8
+.define c2 = 10
+.data c2, 19-9+c15-(c9*c9), -3*2*c2/c15/(c2)
+.define c9 = c13/c2+c15
+mov L3[--c9-c15], r2
+mov L1[c4], r2
+.define c10 = c9*2 + 11 + c9
+mov #c13*12+c10-c7-14/c9, r7
+.define c4 = 14*-c15*8
+L12: mov L12[-c9], r2
+prn #c2-c7+c7+14/L0
+.define c6 = c9*1*16
+cmp #c6-10+c13/c9*3, L11[c9/(3)]
+.define c12 = (c15-c7 + 9-c15)
+L13: mov #0, r7
+.define c7 = c4*c4
+mov L12[3], r2
+.fill 2, (7-16*c12/c4)
+mov #c4*-c7+c7+c9/-c13, r7
+prn #c15
+.define c6 = c2*c4+8/c9
+.data c9-(8*c6), --16/-c4-18, -c7*6, c9
+.define c13 = (c6)-c10+(c9*1)
+.data c4, c2/(c6), -(2*c13)
+.entry c12
+L14: mov #L0+5*18/4*2, r3
+L15: .data 10-20+c4, (c4), c15
+mov L15[c4-c4/20+(11/c12)], r2
+.data c6+19-19/4, ((17))*c10, c4
+mov #(-17), r1
+.data c2*c13/c9*-c2/14
+.data 6, c9+4*3*c9+c13-c6+14
+mov #((c13))+(15)--16, r6
+L16: mov L6[c13], r2
+mov #0, r5
+L17: .data 9+c10/c12*5+c13, 2*1*6*(11-c7), --13*6-5--c6, 17
+.define c12 = 1-c4/c9/20*c7
+.data -c15-c15*c6/c9*L0, c12/c6*1*(19/c13)
+L18: prn #(-c7)
+.data c9+-c15-19
+.define c7 = c6
+L19: mov #9, r4
+.data c6, c10, 1
+.define c12 = c10*c10/c12*c13*20
+L20: .fill 1, c9/16+-19/c12-c12
+.data 7, 2, ((13)), 12
+.define c0 = 4
+.define c12 = c15
+mov #6, r0
+.define c14 = (c13*(c10))
+L21: .data -c7, (c12*19-c4+c6)
+L22: mov L8[14/3/c7*13], r2
+mov #--(13), r3
+.define c9 = 20/(c6 + 5)
+prn #-c4+0+6-0*1
+.entry c2
+.define c2 = (19/7)
+mov #(c10)*(c6-7), r0
+hlt
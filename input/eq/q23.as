@@ -0,0 +1,120 @@
+prn #18
+.data 6, 0, 14
+L0: prn #-6/5
+prn #18-18+1*5/5*15*15
+.data (7)-(20)/1, (14)-(8)+12/11, (13)-0-13-17
+mov L0[20], r2
+mov L0[(17/2+17+4)], r2
+.define c0 = 0/4
+.fill 1, (17)
+L1: mov L1[7], r2
+cmp #(15/4), L1[c0+-c0-c0]
+.data 8, 19, c0*18*c0-c0+19, c0+-c0
+L2: mov L2[(c0)/3], r2
+L3: mov #(18)*c0, r7
+prn #-14*c0/4
+L4: mov #c0, r4
+.define c1 = 17-0-17*c0
+mov #1+c0+8-c0+6+c1*c1+2, r0
+.define c2 = -1/3
+.data c2
+L5: mov #10-c0-4*c2, r1
+L6: mov L5[-c0+4/7], r2
+mov L0[11], r2
+mov L6[20+(c2)*c1], r2
+L7: prn #c2*2/1*0/4+c1*4
+mov #-(13)-4*6, r5
+L8: .data 14+-10*c0+c0, 13+c2-c1-c2-14+c1/4, (12), 7/8
+L9: .data c0*2+0-c0/2, c0-c0, -16+16/2
+mov L7[-c2], r2
+mov L9[c0*5/2-(c0)], r2
+mov #c1/16-5/5, r2
+cmp #15, L2[c1/4]
+.define c3 = 19
+.define c4 = c0*7-14/2
+.define c5 = c0
+mov #-c2--c3, r1
+.data 13, c3+5*(19)-c0/3
+mov L9[18+c4+-5*4*c1-c3], r2
+L10: .data ((c3)/15), -c5*c5+4
+L11: mov L8[6], r2
+prn #(-c3*c5)
+.define c6 = c0/3-16
+.define c7 = c1
+L12: .data 2+17*-c5+8, 13, (c4/4), 10/5
+.define c8 = c3
+cmp #-c2*c5/2, L6[c3+c6-(c8)-c2]
+.data 13/5-(19)
+cmp #0/3, L11[-c2-5/3]
+.define c9 = -c3 + 1/5
+L13: mov #-5, r3
+cmp #c0, L9[16-c4*c9*c6]
+.data c4, -c3*c4*-20+(c1), c6-10/3--(c7)
+L14: mov #(c2-c0)/5, r7
+mov L3[--3], r2
+.define c10 = c8-0/5
+mov #7, r1
+L15: mov #c4*c2+18+c6+c9, r7
+mov #-15, r7
+mov #c6, r5
+mov #(17*c8)+c2+15/1, r3
+.define c11 = 9
+.define c12 = (c6)
+.define c13 = c12
+mov #c3*5/3/2, r2
+.fill 4, (c9+18)/3
+cmp #(4-15/3), L2[8+c4*(13)*4]
+mov #(2-c8), r0
+L16: mov #c12, r3
+mov L13[-c12-10*12+c13], r2
+.data 0, 5, c12*9*-0/3
+L17: mov #c5, r5
+.data 6, -((16)), -c12, (c6)/1+-c12-c12*3
+.define c14 = c5
+L18: mov #6+(19+13), r2
+L19: .fill 4, c11*2*c1*6*16
+L20: .data 6/14, c4*0, --c10-14
+mov L9[10-c3*c2*16+c8], r2
+.data ---c6, 16, 0, 17
+L21: cmp #c6, L16[5*c5/4/1]
+L22: prn #(-14)
+.data 4
+.fill 2, c6
+mov #(c0-c1-17), r1
+mov #c12+c7/1/1, r7
+.define c15 = -c0/3
+L23: mov L18[(c5)/1], r2
+cmp #5, L1[5/3]
+mov #c8*c15, r5
+.define c16 = -c11-18-11-(c4)
+.define c17 = -c1/20*(-8)
+mov #-12--c10-c17, r1
+.define c18 = c13/2
+mov #c0, r5
+.define c19 = 12
+L24: .data 9, 4*c5-6, -10/1/1
+prn #c10
+.define c20 = (c5*c12)
+mov #-2+12*c19-2, r1
+L25: mov L7[c16-10+3/4], r2
+.data (c14/12)*14/10, c11+c6+c12/3, c3, c19
+.data c1, (c18)
+mov #9, r2
+mov #3/5, r0
+L26: prn #18+19
+.data (c6/2)
+L27: mov L9[c14], r2
+cmp #13, L8[c18+15/4*c4]
+.fill 1, 3+(3)+-(19)
+mov #7, r2
+L28: mov #-(8)/3, r6
+cmp #c3, L4[5+c0-c5*10]
+.define c21 = (c10-4 + 10)
+mov #2, r4
+.define c22 = 1-c4+13-c4/4
+.define c23 = 12-c13/18--8-6 + c11
+.data 5
+cmp #17, L6[c1/5-c4*11*c3]
+prn #-c12*20
+mov L2[5], r2
+hlt
@@ -0,0 +1,111 @@
+.define c0 = 10-18-9 + (X9/8)
+prn #9+c0*c0*c0-(14)
+mov #1, r5
+mov #c0, r5
+mov #-17-(4), r1
+.entry c0
+.data --c0/c0
+mov #14, r2
+L0: mov L0[4*c0], r2
+prn #(-19*-12)
+mov #6, r7
+mov L0[18-5/c0-((20))], r2
+L1: .data c0*4/c0+c0-20-17/c0, c0-14*c0+-c0*c0
+L2: mov L2[c0/(c0*c0)], r2
+L3: .data 15, --c0-c0, (-c0)--1/(9)
+L4: mov #9, r5
+L5: mov #-13*c0*X9, r6
+.data 20-c0-3/c0*16*c0
+.define c11 = 2/14
+L6: .data c11, (14/L0-7-3), c11
+L7: .data -15*13/-c11-7, c11-(c0)*14, 5, -13
+L8: mov #c0/0, r0
+mov #c0, r4
+prn #c0
+L9: mov #(-11-2), r3
+.define c14 = 0-c11+c0-9/c11
+.define c8 = 6+8+4/(11)
+mov L8[(c14)], r2
+.define c0 = 17*c14 + c0 + 14
+mov #c11, r2
+prn #14/c0*c0+9+10/9/c0
+.entry c11
+L10: .data (c8-14)
+L11: .data 11/(3), -(12)*c11-8+c14
+.define c8 = 0 + 0 + 1/c11-20/c11*16
+mov #8, r4
+.define c9 = c8
+.data c9*2-2+c9/(14+c0)
+.data 5-18*c8*6*-c14, 9-20-c14+19-18+(15)
+mov L2[c11-c11*c9/3/2], r2
+mov L3[(c0)*c9+(14)], r2
+prn #20
+L12: mov L8[c0], r2
+mov #c8, r2
+.define c2 = (17)/11*c14/14-c8
+.define c11 = c8 + c0-(c14) + c0
+mov L4[c2], r2
+mov #-19+c0/4+c0, r4
+.data c11*c8+c2-c11
+L13: mov #16+c11*4+13/16+-c8, r4
+L14: prn #20
+L15: .data c2
+L16: mov #8, r3
+L17: .data 1
+.data -9/c8-c11/c11, -c9+6-c0, -8-c2/c8*4*c11, 2
+.data (-20*17), -15/15, (c2+9+11+6), (17)-X9*1/13+c11-19
+mov #9+c8*16*-2, r6
+cmp #17-(6)-(c0), L6[-c11/(c11)+-c8+c11]
+L18: mov L2[10], r2
+.fill 4, -6+c2
+mov L1[3*5*c8*c8*9*c11], r2
+L19: mov L8[c11/c2/-c0], r2
+mov #0, r4
+.define c2 = (X9/c11*c0)
+prn #18
+L20: prn #c0/10
+mov #(c0)-c11/c0--c0*8, r3
+.data c0+-2/14, c9, -c0-18/11/0, -6*2
+.data 10*14/5+7
+mov L11[(c11)], r2
+.fill 3, c9
+.data 9+c11/16/1
+mov #c2, r7
+L21: .data c2-c14-c0*0, -(c11/c11), -(c11)+c14-c2+c2, 7+9*(9-0)
+L22: .fill 4, c2*19-9+16
+prn #(20-19)-20+3/c2
+.data 7+11, -c0/6+4, (c0-c2)*--20
+prn #c11+1*-c14+-c11/1
+.fill 4, c11+c14-7+16
+cmp #c14, L2[12]
+.fill 4, (c2)*L0-c0/-4+c0
+.data 13-6-1, c8+1/5*c2*8-c2/c9, c11, 19/18*0-1*0
+prn #10
+mov L9[13+-c8-5], r2
+mov #(c11--c2), r7
+.data -12/c0/c14-c0+c2, 12+c2+0-(c0)
+.data c14, 18
+.data 16*c11, c8, c2/-19, ((-c8))
+.define c11 = (c0)
+L23: mov #14, r1
+L24: mov #10, r3
+L25: mov #(c9)+6+(17), r4
+L26: .data -15+c11-3/c14*1
+.define c8 = c2/-c8-18
+L27: .fill 3, 19
+L28: cmp #c8/6+c14+c8/c8, L1[18/c8]
+.define c6 = -9
+mov L9[15*c0], r2
+L29: mov L11[0], r2
+mov #8, r2
+.data c14-c6-13+17+-14
+.define c2 = (16-7+c8)
+mov L24[-c2/8+-9+(1)], r2
+cmp #c9*X9-c8*2/c14+11, L7[7]
+mov #7, r6
+.define c9 = 17
+.data c11
+.data 16, 19*c0/c2+-c11-15
+.define c2 = c2
+.define c7 = (X9+c8--16)
+hlt
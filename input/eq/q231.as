@@ -0,0 +1,23 @@
+prn #14+12*8/5*(18)-9
+.define c3 = nope*9-(11)*2*X9 + 10
+L0: .data (c3), 4, 18+5-c3+c3, 18/(11)/(c3/19)
+L1: .fill 1, (5)
+prn #1
+.data 10, -(c3-5), c3
+mov #(6)*17+18/(14)+-0, r1
+.define c15 = 13
+cmp #c15, L0[-1/5-(c3)/nope]
+L2: mov #5, r1
+mov L2[18], r2
+mov #(2+c15*(15)), r7
+L3: mov #(c3)*9+c3-X9/14, r3
+.define c10 = c15/c15
+.data -19-3*0/2, 16
+.data 2*c15+0-3, 2, c15, -c3-10-16+5
+L4: mov #c15, r0
+mov L3[c15-3-10/c10-c3-13], r2
+prn #0
+L5: mov #c15, r6
+.define c9 = 15 + c10/c10*3*c10
+mov L2[c10], r2
+hlt
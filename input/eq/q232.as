@@ -0,0 +1,56 @@
+.define c2 = (2-13)*-8-(8)
+L0: .data -c2+3/c2, c2, -10/c2*c2/16
+.define c8 = -(15)*(11)*c2
+.entry c2
+.define c10 = -0 + 10*-7*10
+L1: .data c10+-c2--c8, c8/9/19-c2, c8*c8+c8*c8+19/10-0, 14*9/(9*17)
+L2: mov #c8, r7
+L3: mov #3, r2
+mov #c2/c8, r0
+mov #--(18), r2
+mov #c2, r3
+.data -5-13-5/c10/16/4, c2*((13)), (c2)+c2+c2/-c8-4
+mov #19, r6
+.data (c10)*c2+7+(c8/3), 17
+.define c1 = 2-11/-nope-c8/(16)
+L4: .data (c8/c8)/(9)
+.data c8, -1-c8/(18)*(16), c8+9/16*c8--c2, (c10)
+.data -12-4*c1, 12/c2/(c2)*12, -c8+13-c1
+mov L1[-c1+(13)*c8*17+7], r2
+mov #c8, r2
+mov #3-c8*1*-17+c1, r5
+mov #c1, r0
+L5: mov L0[--c2*c1*c8/c1], r2
+.define c10 = 1*9-(c10)+--c8
+mov #(15+0)--c1/c1, r6
+.define c4 = c2-(nope)/18-c10
+mov #(c1), r6
+L6: .fill 2, 14-7-15-15*16+c1
+L7: prn #6
+.define c8 = (-1-19)
+.data c1, ((c10))*c10
+mov #9, r6
+.define c6 = (8)
+mov L1[c6-18/c4*c8+c4+0], r2
+.fill 4, c10
+.data -c8*3, -3, -c2
+.data 18+5/-18-c10, 1, -13+c4+c8, c4
+mov #--(14), r6
+cmp #c8, L6[c10*8+c1-c2/c2-4]
+L8: mov #--12+c1, r3
+.entry c10
+mov #(-c10*6/3), r6
+mov #c4, r1
+.data 0, -c4/5*-c2
+mov #c8-c6, r3
+mov L3[3], r2
+mov #c8, r4
+L9: prn #4*1+c10*c2-0
+.define c2 = 6+11*c10-9+12-14+6-0
+L10: prn #-9
+.entry c10
+.define c7 = 16-17-c4/18*(17-c2)
+mov L1[3*-c8-0/c1*-c10], r2
+mov #-8+13*c1/0-c4-c1, r1
+mov L4[(4+c7)*c8], r2
+hlt
@@ -0,0 +1,108 @@
+L0: mov L0[(1*14)/9-10+19*0], r2
+L1: .fill 1, 3/L0+10
+mov #17, r0
+mov #(12), r2
+mov #(6-3)-4, r5
+prn #9+6*6+11*13-1
+.data 7/5/12*-(20), 0*16+15/9, 1*11-11+18/11, -12-19+15-14/3
+.fill 1, 15
+L2: mov #(17/0-19), r6
+.fill 1, 6+18*-15+3*3*13
+mov #5, r3
+mov #(1/11/6), r4
+L3: mov L0[(7*19/9)], r2
+.data (0), 6/20+9*4*2, 13/4-6-(-3), 18
+mov #(0*14*3), r6
+mov #--nope+0, r2
+L4: mov L2[(-18+11)], r2
+L5: mov #-0-4/4/(4), r7
+L6: mov #(7), r1
+L7: .data 13+20/5+7, 20*12*0/15+15, 0+(20)*(0)
+mov #(7)*-2/(8/15), r6
+.data 14, -(17)/13-3, 4+7+8/-7, 19/10
+L8: mov #-(9+X9), r5
+.fill 1, (9*10+4/0)
+L9: .data -4*11*15, 3
+.data 9-17/0/2*11
+prn #9
+.define c3 = (14)-12/0*-20
+.data -c3-18/c3/-c3*6, (c3/5)/20-c3*6
+L10: .data -c3-(9), -1-14*3, 16
+.define c11 = -11/c3-(c3-0)
+.data c3*5+2/9/c3+c11
+L11: .data 11+8*10*3+c3+13*c11
+L12: mov #c11, r7
+L13: .data c3+7, 12, c11/17--4/-18+c3
+mov #1-6, r1
+L14: mov L14[(c11-6-6)], r2
+mov L8[(13)-c3/1], r2
+cmp #c11*c11-c11-c3, L14[c11]
+.define c9 = c11-17/c11*(20)*c3*11
+mov #9, r2
+mov #20*10*18+17*8, r5
+mov #c3, r4
+.data (1)/0, c3
+.define c11 = (c11)/1*c3
+.define c10 = (-19)
+mov L8[-20/20-8*20], r2
+mov #7/14, r0
+.define c0 = c11
+prn #-c0+c11*0+-c3
+L15: mov #-c3, r1
+mov #-7/2-c3*17-15-c3, r2
+mov L9[15], r2
+.data -5/17*12+3+2*3+7
+mov #c11, r6
+.define c0 = c3
+cmp #2*c0, L3[c9/5-c9+17+nope]
+.entry c9
+.define c12 = c0+7--c9*c10-(6)
+L16: .data c10, 15, -12--5+12, 3*16*c9-c9+17+c9-14
+mov #8, r2
+mov #-c11, r6
+.fill 4, --c3
+.data c0--20
+L17: mov #10, r7
+prn #11/c12*c9*c3
+.data c3, c9+19-c0*4, 19-12/c0*12*18, (c0)*11+14*c0
+.fill 1, -c9+c10/c11*12
+mov L15[20/2*17/c11], r2
+mov #(8*c11*(c3)), r1
+.fill 3, -c0+c12+c9
+mov #-c9+c12/6, r1
+L18: .data 5, (15)
+mov L14[10], r2
+.data (-3+0)
+L19: mov #c9, r3
+L20: .data -(0)+14*c10, c0/2/c11-c0, c0, -(c10)+16
+.define c1 = 7-8
+mov #c0, r7
+mov #c9--c1, r4
+mov #3, r1
+.data ((6*c1)), 18+1-15
+.define c3 = (-7 + 15)
+.data c3+c1*1*2, c12, c1
+.data (-(1)), c11+7-1/c10*8/c12, 0
+mov #-(c0)*c0*12*c9+1, r4
+L21: .data 2, c11+18*c12, c9, c3+c0*1+16
+.define c11 = -c3
+.data (c11)
+mov L9[c9-19+16-12], r2
+L22: .data 3, c9-18-14-15*10, c11*c0, 20*-L0+c0-c3
+L23: .data (c1), 12, (-3)*(1+c11), 5
+prn #c1
+.define c8 = ((c0*c12))
+prn #(c3/c0-14/19)
+L24: .data 5, (c0*c9/15), 2, c9-14
+cmp #17, L17[-(11*14)]
+L25: mov #7, r4
+.define c15 = -3/11*c11*(c8)
+mov L7[c3+c12*c9-10], r2
+prn #c1/c12/c0-5*15
+L26: mov #c11, r7
+.define c14 = -c9-c0/c9/c3
+.define c11 = c8
+L27: prn #(1)
+.data -c11, -(c1/12), c8, -6*18-12*2
+.data c11, c3+c0*c11/-c3*c11, (c0*c11/c11), (c0)+c8+c0--8/14
+hlt
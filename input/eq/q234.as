@@ -0,0 +1,64 @@
+L0: .data 13*5/18/-9-0*2, -2+19+18, 18, 2+-(1)
+.data 7+4*18+(0), 3
+.fill 2, 8+0-(1)
+cmp #1-11*9/4, L0[(10+-8)]
+prn #10-1+10
+.fill 4, (-20)
+.define c4 = 10+L0+8/16+10-14+18
+mov L0[c4+c4-12], r2
+.define c15 = c4*17 + c4/c4/c4
+.entry c15
+mov L0[-c4*4-c4-(8)], r2
+mov #c4/8+c4*c4, r6
+.define c15 = 4
+mov #6, r7
+mov #4, r3
+.define c12 = 4
+L1: mov #10*c15, r6
+.data 6+c12*c4+11/c12
+.define c4 = c15
+L2: .data 3+13/-c4--c12, 11, (0)*8/c15*20, c15-18+(14)
+mov L2[0], r2
+mov #(c12-12)+11*c4*(X9), r0
+.define c6 = -(c4)*c12-c4
+mov #(-1*(c6)), r5
+.data c12*(c12)*3, 9, c15
+.define c5 = (4 + 9) + 11
+mov #17, r6
+L3: .fill 3, 13+-18+9
+prn #c4/19
+.entry c6
+L4: .data c6, -5-c4-19
+L5: .data -c5-11+8-c4, --c15/20
+.data c12+c15-c15
+.fill 2, 4-(10*11)
+.define c0 = c4
+L6: .data c6/c15/c5/c4-X9*19, 8+c15*5+c0/13+7, 11
+.define c9 = 2*(c12*X9)
+.define c14 = nope/c9 + 12*5-c9/-c4
+.define c13 = 19*8
+mov L5[c4], r2
+L7: mov L7[7/c15*c12+15], r2
+L8: cmp #c9*(-c13), L0[c4-c13/c5-20/c0/14]
+.define c6 = c12
+mov L1[14-c6-1+nope-9], r2
+L9: mov L8[c9], r2
+prn #8--c9*c5
+.data (c6)*c6-5+(9), 8, c13
+L10: mov L8[(c9*20/20-c15)], r2
+L11: mov #7, r5
+mov #17*8, r1
+.define c12 = --12-c4
+.data 17, 15/-0+c0, 11, 16-12-15+c12
+mov #3, r0
+.data 10, (2)+c4*c15*11, 5-9-c4*-15/nope
+mov #17, r0
+mov #c15, r2
+mov #c4, r1
+mov #(2)*5+18*(c12), r0
+L12: mov #-c12+c15+c12/c6, r2
+mov #(c15/c5*10-c9), r3
+.data -17*c14--c9+17, 5, -c9*1+14*15, 8
+.define c15 = 8
+L13: mov L8[9], r2
+hlt
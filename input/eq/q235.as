@@ -0,0 +1,65 @@
+prn #8
+L0: cmp #5, L0[-((17))]
+.define c15 = 15/(10) + (17)
+mov L0[8/c15*c15/c15], r2
+L1: mov L1[7*5-14+20], r2
+mov L0[6+20+18/15*(c15+7)], r2
+L2: .data -c15*13/-12, c15/c15/c15+(c15)
+cmp #c15*15*-c15-c15*19, L1[c15]
+L3: .data -12/c15, (c15)
+L4: .fill 4, 8+(c15)
+L5: .data -(c15)*-20+13, -c15+14, (5+c15)/15, c15
+mov #c15*c15*9*-20/10, r5
+L6: mov L3[10/-9-5], r2
+.define c6 = c15/10
+L7: prn #c15
+L8: prn #c6
+.define c0 = 20
+.fill 4, 5
+L9: .data 7, 2*c6-18--c15, c6*(c15*4), c0
+mov #1, r6
+L10: prn #-14*c15-7-c15
+cmp #4, L3[(2+c15)*5]
+mov #19+20+12+c0*c0, r5
+mov L6[c6*7-4-17-9/(19)], r2
+mov #c6, r6
+L11: mov #-17-13*X9, r0
+.define c11 = 1
+prn #(8)
+.define c7 = (c6+4)
+.define c0 = (c6/18)-2/-16
+.define c13 = (c0*X9)*(10/c7)
+L12: mov L9[(-13*10)], r2
+mov #14, r0
+L13: .data 16
+mov #c6, r5
+.data (6*13)*-c0/18, c13-15+c7*c0/c0, -c7
+.fill 3, 7
+.define c1 = (c0/11)
+L14: prn #((19-20))
+.define c13 = c1/8-18
+mov #7, r7
+.fill 2, 3+8/c15-c13/-19
+mov #((-c11)), r6
+mov #-c7+10-c7*c1, r7
+L15: prn #18/1-8-c7+14
+L16: .fill 4, 9
+.define c2 = c6+c6-c7*2*c11-c13-(c0)
+L17: mov L3[-5+(8)-c15], r2
+.define c4 = c6
+mov #(4*c6-3), r5
+.define c0 = c0*c1-(c13/c0)
+mov #5, r2
+.data 9, c0
+mov L9[-14/c11+9/0], r2
+L18: mov L11[c13], r2
+L19: .data c1*0/c0*9/c11
+L20: mov L17[(c13)/16/c11*(c13)], r2
+L21: .fill 2, -4+c1*14*c6
+.data c0
+L22: mov #X9-6*15/c6, r6
+L23: mov L12[c0+19-c0], r2
+.data c1, -c15-7/c7*c13/17
+mov #(c4)/-c6+c2, r3
+mov #(c11*c6)*-c0, r3
+hlt
@@ -0,0 +1,107 @@
+.data 18, -11, -0/8+2*(16)
+.define c5 = 5*(-4)
+L0: mov L0[c5+c5/c5+14/(2*c5)], r2
+L1: .data c5, c5, -12*20, c5
+.data 20, c5
+.define c6 = c5
+.define c6 = -c6 + c6
+.data c6/9, 0, 8
+mov L1[-c6/5*c6/c6], r2
+L2: mov #-c6+c6*(13), r7
+L3: mov L0[13-c5*13+c5], r2
+.data 3, 8
+L4: cmp #c5+c6-4/9*c6, L0[7]
+mov L1[8], r2
+.define c8 = 19
+L5: .data (11)*c8-c6/c5/10+c6, -6
+.define c12 = 9
+mov L2[6], r2
+.entry c8
+.data c6, 2/c5/-20, (c6)*-c5+-c6, 0/c5*c6*9
+L6: mov #11+c5-c12*18, r6
+.data L0, 12-17*1*c6/c12*11
+prn #c8/7*c5/c12*c6+c6
+.define c14 = -c5/16+c12
+L7: mov L4[16], r2
+.fill 1, 9
+mov L0[(-c6)/c14], r2
+mov #1, r0
+mov #c6, r4
+mov #-c6*c12/c6+15/c12, r6
+L8: mov L7[c14-9--9/(c8+c6)], r2
+.define c14 = (c8)
+.define c13 = 0
+L9: mov L7[c5/c6/c5/-14], r2
+.data 10/c8-c5-18/c8, c12*-3*(9), 15*6/17-2/12+10-c14, c5*1
+.data 17, 10, 4
+cmp #10, L0[-c6+c13-11-c14]
+.data -c14-12/-13, c8*18-c14+(c6+5), c8+-X9/c14
+mov L7[-c6+c12--c14], r2
+prn #-8*c6+c14/7+3
+L10: cmp #4+9, L4[3]
+L11: mov #5, r4
+.define c3 = 2-c14*c14 + (c12/1)
+L12: mov #18/20/20/15, r3
+mov #6/c6+13-c14, r0
+L13: .fill 2, -3
+.entry c13
+.define c7 = 10-c3/(c14)--X9/6
+mov #(c6)*c14+5/15*6, r5
+.define c13 = (c6)
+L14: .data --6/(11*2), 13, 19, 9/12*19/c12+(c3)-7
+.data 8, (-(c6)), c6, (17)/6/c13
+.define c8 = 17
+.define c5 = 13*c3/3/13--9+c13
+mov #c14-10*c12*c3, r6
+.define c13 = c8
+L15: .data (16)-6*9*c6, ((8))/12*c6+16, 13+c13*18*8/-20, c13
+L16: mov L13[(c14/4+-c13)], r2
+mov #c13/(c14), r1
+L17: mov L17[1], r2
+L18: mov L12[5*15/15/16+c6], r2
+L19: .data (-c8)-c14-c6-14*c8, 9/c14-c6/18--8, 5
+L20: cmp #(c7*11)+c6, L12[c13]
+.data c8
+mov #-c14/c6-4, r7
+.define c11 = 19
+mov #8, r4
+L21: mov #6, r5
+.data 18
+mov #-c14+c5+7, r3
+mov #4, r2
+L22: .data 17, (-1)*6, 19/c13
+L23: prn #(c8/0)-15*-17
+mov #((0)), r4
+L24: .data 15, -1, -5+c11-13+7
+mov #15+-(18), r7
+L25: cmp #c6--c14+8-c5, L20[((-c14))]
+.define c7 = c14 + (c13/c8)
+.define c4 = c3*5 + c8-6
+mov #c14, r0
+mov L24[(c14+(c13))], r2
+.data 13, c13, 12+c11+(c3)*c14
+L26: mov L11[-c14], r2
+.data -(c14+c7), 4
+L27: .data 5, -c4*c13*16, -5/c7+8
+L28: mov #0+c8, r1
+.define c7 = 8
+mov #-c14, r1
+L29: mov #-16--0*c6, r1
+.data c14*0+16/nope, ((c14)), 4, 10+c5/15-c13
+mov #(c14), r3
+mov L21[11/c3+c8/12], r2
+mov L10[c5], r2
+.data -c5*L0/6/c14, c7, -c11-c13, 19+17-c5*14+c3+(c7)
+mov L5[-18], r2
+.data c12, c7*c7/c14*c5
+.data (c5)-13
+cmp #4, L20[4]
+mov #c7, r4
+mov L15[5/1-c4/c3], r2
+L30: prn #(-9/14)
+.data 13-9+13+(-5), c6-19*c14*c3+c5
+cmp #0+c14/c12*2, L23[0*-18/c11+0]
+.entry c14
+.data -c11, 4/c5-c14-c5, c3
+.data c5, 8, c13
+hlt
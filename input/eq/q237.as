@@ -0,0 +1,100 @@
+L0: mov #5, r6
+prn #(11)
+L1: .data ((16)), (7)*(13), (-5/12), 1-12
+cmp #9, L0[13]
+mov L0[-7+19*7/6+18*20], r2
+.data 12, 1-1/(15)+(nope)-17, -(16)*7
+.data (nope)-2+10*19, 8+16-20/16+0
+L2: mov #16*9+3*16+8, r1
+.fill 2, 16
+.data 17
+L3: prn #L0+0-7*13
+.data (13)-2*4+5
+.data -12*13*19/4/18*8, -13, 4
+cmp #6, L1[12]
+.define c5 = (15/7/18)
+mov #-c5-c5*c5+c5*c5/c5, r3
+.define c12 = c5-8-c5
+L4: mov #16, r3
+L5: mov L0[16], r2
+.define c4 = c5-c5-20-19*((c12))
+L6: .data -c5/15--c5/3, c12/7/c4-20/nope+c4, c4*11-c5+14, 4
+mov #2+c12-(nope), r0
+L7: .data 19, -(9)
+mov #(c12*0*11*5), r6
+mov #c12, r1
+mov #19, r6
+mov L4[c4], r2
+L8: mov #-1/c4-14, r3
+L9: mov L9[c12+7*18/8/14], r2
+L10: .data -8*9*(7/c4)
+.entry c4
+mov #13, r2
+prn #3
+L11: mov L9[c4], r2
+mov #13, r7
+.data --c12+c5
+.data 0/((1)), X9, 0/6-c4*16-c5+2/c4
+L12: .data 6+18-5+18-c12*12, -c12+c12-(15), 5, c5*12-c5*c4+17/6
+.define c7 = 17--c12*c4
+.define c5 = 18
+mov L12[8], r2
+L13: mov L8[--16/9], r2
+.define c7 = -c5*c5 + c7/c5
+mov L9[(c7-11-c7)], r2
+L14: prn #((c4))-(5/c4)
+mov #c4-c5+11-c4*4, r1
+.define c9 = c7*7*1-c5*-2
+cmp #(-4*c4-19), L8[7+c5-7+c5/11]
+L15: mov L1[16], r2
+.data (c7/c9*17-14), c7
+.define c3 = c7--c5+c9
+L16: .data c7
+mov L5[6+5+c5-19+c7*-6], r2
+.define c13 = c7
+prn #(c3)*-c7--c9/c9
+mov #c5/c7*c5-c9, r7
+mov #(c7), r6
+.data 7, (c4*c4)
+.define c3 = c5
+.define c7 = 10
+.data -c7, -((c7))
+.define c6 = -((c7))
+.define c11 = -14-c7 + 3/4/2
+L17: .data (10*c7--c13), 8, c7-c7+1-13/15
+L18: mov L12[-c12/c12/(1)/7/11], r2
+.fill 3, (16)
+.define c14 = 7
+.define c13 = 19
+.fill 1, (-(c5))
+mov L18[10], r2
+cmp #-c14/9+8/c7, L3[-4]
+mov #c7, r4
+L19: .data c5
+.data (1)*14/5, c14, 4, -13
+.data (c5)/17-c11/5, 3/c14-15+8, -3*16/12, (c7*9+17)
+L20: mov #-6, r2
+prn #c3
+L21: mov L11[5], r2
+mov #c3-c11*20-16-16*c7, r5
+mov #(-c4), r2
+.data (-(15)), (c13--c4)
+mov L18[(c3)-13*10+c7-c7], r2
+.define c2 = -(15)/c7/7
+L22: prn #-c5/c7-c14
+.define c13 = 3
+cmp #c4*14/11-c13*c7, L22[19]
+L23: prn #c4+c14*7*(8)
+.data c13
+L24: prn #c14
+.fill 1, (-14-13+11)
+L25: mov L2[19], r2
+mov L1[c13*13--5+5-c7*c7-1], r2
+mov L2[c2], r2
+.define c2 = c13/c4*(10)*7
+mov #4+c13+-c14-c13, r3
+L26: mov L4[6-c7+c6/-20], r2
+.define c12 = 7
+mov #(c13-c14/-0), r3
+.entry c13
+hlt
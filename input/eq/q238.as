@@ -0,0 +1,68 @@
+.define c2 = 5
+mov #c2, r0
+L0: prn #-(12)-20+c2-(20)
+.define c1 = 10*0--8/c2
+L1: mov #5, r1
+L2: mov L2[3], r2
+.define c10 = c1
+cmp #16+(c10), L2[14+15-18*c1/c10]
+prn #14*nope*c2-c1
+.data c10*(15)--c10-c10-4, 10/8+c2
+.data 15/8*-c10+(19+c10), (18*c1)/(17-14), (c10-4)+c10
+prn #19*c10+2*c2+(12)
+L3: .data 13, -17/c10+8, c10
+.define c12 = c1
+.data c1*c1, ((11)-c10/c1), 8*10
+.define c0 = -15 + c12 + c2
+mov #19/((c2)), r4
+prn #c2
+L4: prn #--c1+c1
+.define c0 = 18
+.define c6 = c12
+L5: mov L5[(c10)/5+c0/9*13*c2], r2
+prn #-13+c2+(-15)
+L6: mov #c0*c6-13-5, r4
+mov L2[15*--c6], r2
+.data -9+c12+c12/-c10/c0, -18, -5/c10+c0-4
+L7: .data c1/c1, 12
+L8: mov #5, r0
+L9: mov L8[(c12*(c10))], r2
+mov #7, r2
+.fill 1, 17-X9-15*-c1*-1
+mov #c12-L0*c10-c10, r7
+.define c0 = 3
+L10: .data 13/c0*c1+c0/-c6*c10, c0
+mov L10[c12], r2
+.data -(17)*18/0, c1, c0, ((7)-(c0))
+.data 10/17*17*10+c0+7, c2*9-(8)/c2-5-c0-c2, (c0+c10)-(c6)-9
+L11: mov #16, r6
+.data (c1*10+(15))
+.data 6, (c0/7*18-c0), (c6), 14+18*11*20+c0
+prn #-c0/11*c12/c1
+L12: cmp #16, L0[c6/-(c0)]
+.define c2 = -(5)*c1-c10
+.define c5 = --c1--13-c2
+.define c12 = ((1))
+L13: mov #14/c2, r6
+.define c1 = 12-c0*(9)/c0 + c10 + c6 + X9
+L14: mov #10+17/(0)*-c6, r0
+L15: mov #c12, r1
+.data c6, (19*15/c2*17), c0*(13/c10), 4
+mov #5, r4
+.entry c6
+mov L0[c12], r2
+mov #(9/0)/6*c0-c1, r3
+.entry c2
+mov #c5, r6
+.data c5, c10
+mov #7, r5
+.data --c5, c2, (c12)/(c10)+17-15, (c0)
+.define c4 = -c1 + 0
+mov #c5/(c1+c4), r5
+L16: mov L11[((c4))], r2
+.define c4 = -c5*7*c2
+.define c10 = c5*8*20/c12+-c0-X9
+.define c10 = c12
+mov L12[-11*c10/1], r2
+L17: .data (c0+7+X9-3), c5, 6-c2*c2-c6-18-c5/18
+hlt
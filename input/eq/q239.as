@@ -0,0 +1,36 @@
+.define c13 = 11
+L0: cmp #0, L0[c13]
+mov #5, r2
+.data (c13), 5*c13/c13-2/c13, 9, c13-15*c13*(c13)
+mov #-nope/c13/3, r1
+.define c3 = 0
+L1: cmp #c13-12-c13*c13, L1[-c13*c13+c3/c3]
+cmp #(11-9/19-c3), L0[c13*c13+0/4-c13]
+mov #-1/c3+15, r2
+.data c3-13
+L2: .fill 1, -16/10-8-c3+7
+.data 16, 14, c3/c13
+mov #c3+X9/c3/c13+0+7+12, r3
+mov L0[2], r2
+.define c9 = c13
+.define c9 = -2-c3*c13-c3
+mov L0[c9], r2
+L3: prn #-((c9))
+.data c9+c9+3+c3*c9-3
+mov L0[15*-c13+13], r2
+L4: prn #14+0/c3/0
+.data 16, (c13)*-c9-c9
+L5: mov L2[c9/c13+(15)/c9*c3], r2
+.data 14*c9*3-5-c3+18, c9, c3*c9-(12)/-(2)
+.data c9
+.define c9 = 20
+.entry c9
+.data 0/12/5*2-6, 18/18-c9+10, (-12+18)
+.fill 4, c13
+cmp #9, L3[0*2+20*c3*-c9-9]
+cmp #11-16-c9-13/20/c13, L1[6]
+.data -c3-c13*(-c13), -18-13/--20, 1
+.define c9 = c9 + c13 + c9*c13*10
+L6: mov L5[c9], r2
+L7: .data -c13*18/-(5), c9+c9+c9+c9/4, c9
+hlt
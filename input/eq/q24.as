@@ -0,0 +1,112 @@
+.data 16-20*0-2, 15
+prn #-20+9*5
+.data -8/8+-19, 20-4+(16)-4*19
+L0: mov #9, r6
+.define c0 = -14/1
+.fill 1, 13
+mov L0[-c0+0-c0], r2
+L1: prn #-c0-c0*c0+c0
+prn #c0+c0
+mov L1[(-4)*14], r2
+L2: .data c0, 7
+L3: mov #20, r3
+prn #c0
+mov #(0-c0+c0-7), r3
+.data 14-11+c0*19*9/2/3, 9, (15)--7
+prn #7
+mov L0[c0-16/3+-c0-c0], r2
+mov L1[c0], r2
+L4: mov #13, r3
+L5: mov #(3*19-c0), r4
+.define c1 = -c0*2/4
+.define c2 = 12
+mov L3[c1/3/5+8], r2
+.define c3 = 20
+prn #c1
+mov #18, r4
+.define c4 = 9*-13*13-4
+prn #-3+c2-20
+mov #c0*10+c0*c3-12-c4/4, r6
+mov #3*c0-13-c0, r2
+L6: prn #c3
+mov #13, r2
+mov #-c2, r4
+prn #(c1*c2)+-19*c2
+L7: mov L1[0], r2
+.define c5 = (18)
+L8: mov L2[2], r2
+L9: mov #(c1/3+-3), r6
+.define c6 = c2
+L10: .data -3/2, -c0+19*-18/4, (c2+13*16), -10-c2
+mov #(10), r0
+mov #11*-c6/3, r6
+.define c7 = (c2)/5/5
+prn #c6
+L11: mov #9*-c0*c4, r7
+.define c8 = -c7
+.define c9 = c6
+.define c10 = 0
+cmp #(9+18*c10+9), L9[c5]
+mov #19, r7
+.data c1/4, -c8/2, (0/11/2)
+prn #c6/1+15+c3*c9+c7
+.data -c10/5-7
+.data c9, -9/5, -8, c8/1
+.data c9, 0*c8-((c3)), 0
+mov L2[--c7*10], r2
+mov #17, r7
+L12: .data 8, 7/3-c7-c3*-c7*5/1, 8, 5*1
+mov #17, r2
+.fill 1, c9+c9*5*16/5
+L13: prn #c9
+mov #(19/4)*c7, r3
+.define c11 = (12+c5)+-c6+4
+L14: mov #16*18-c6-14, r1
+mov #-c2-c0*4*19-8, r2
+L15: mov #c2-(c5/3), r0
+prn #18+12/16-c2*1
+mov L8[(c3)], r2
+mov #c0/7/2/2, r2
+L16: .fill 1, 5--c6
+L17: prn #(c3-2/5)
+mov #19/1, r7
+.define c12 = (c0)*c6
+.define c13 = 3+(c5)+c10*c1-18/7
+mov #(c4*7-5), r1
+.define c14 = c5
+mov L15[--6*9], r2
+prn #c8
+prn #c1/17
+.data -c7, -c14+c4-c4
+L18: .data c0+c11
+.data 13*c6-9-18, (c1)-c12*c11*(c12), 2/2, -3/2-(c3)
+mov #c8-c5+-9*3*0+c6+0, r7
+.fill 3, 1
+mov #c10, r6
+mov #19+16-2/3, r5
+mov #-4-18+18/3, r0
+.data -2-c10+(17)/1, 17/5, c2+c11/5+c1
+L19: .data 7, -18-13*3, c12, c11
+L20: mov L1[c4+c13-15-13*((c5))], r2
+mov L1[-7], r2
+prn #16+((16))
+.define c15 = 13/4
+cmp #19-c6/4*(c4*c4), L16[c15/13*-c9/2]
+prn #15-c7*c5
+L21: .data (0), c12/4+0*7*c14, 2--c11/1, 20
+.define c16 = 20+c1-8+(c0-18)
+prn #c0/1
+.define c17 = 14
+mov L17[-17--c17-c10], r2
+mov #2*-13*(14), r6
+L22: .fill 2, 3*c17*c9/1
+mov #(1)+c16, r5
+.data c7--12*c9
+.fill 4, c13*8*3/5
+.define c18 = 19
+.define c19 = c13-17
+mov L12[c8], r2
+mov #0+13+14*c4, r4
+.data 0-c8+c9/5
+mov #c0+3-(15)/2, r4
+hlt
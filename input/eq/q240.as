@@ -0,0 +1,99 @@
+.define c10 = 20
+.define c0 = 17/19
+L0: mov L0[c10+-c10*c0], r2
+L1: mov #5+(11), r4
+.data (c0*6)*3*14*1, -9
+.data 12*7, -18*1*17, 1
+prn #c10
+.data -16, c0+c0*4, c0, -10*c10*15+(15)
+L2: mov #(c0), r6
+.data 4, (c0*c10+(7))
+.define c4 = -c10*8/-c0/c0
+L3: cmp #-c4+2-1-X9, L3[(c10)-(c10-c4)]
+L4: mov L1[(19/c10)/(4)/10/6], r2
+mov #c10, r0
+mov #2, r3
+mov #(c4), r6
+mov L4[11], r2
+.define c11 = 15-20-c10*c10*-nope*14-10
+.define c8 = 7*(c10)
+.data c11
+.fill 4, c8
+mov #4, r1
+mov #c0, r5
+.data 13, (c0+-14)
+.define c2 = c10/10
+mov #-c8/c4-17, r6
+prn #3
+prn #(6*c4)
+.define c8 = 0*c11
+.define c3 = 8
+.define c13 = 3
+mov #c0/c8/16+c2*(2/c13), r7
+L5: mov #15/-11*9, r7
+mov #--c11/c8, r6
+mov #(c0)+(c3)-c0+7, r7
+L6: mov #5*4--c11-c4, r3
+mov #(-9)*13+17*c10, r3
+mov #c2+c10/3/11+c0, r3
+.fill 3, (8)+-12
+mov #c3, r1
+.entry c3
+L7: mov L4[c10], r2
+L8: .fill 4, c0-c11/7+c8
+prn #c0+17+17*4/(4)
+.define c15 = 0-10 + c2*nope*16*c0
+.define c9 = (c13*12)/c0-c8
+.define c5 = (10/12+c9)
+mov #c0, r0
+mov L8[c11-11*5+c9-20], r2
+mov #c0*16, r4
+cmp #9, L6[2]
+.data c2
+.define c1 = c13/c0
+mov #7+15-c1/(7*c4), r6
+.define c4 = 11
+.define c4 = (3)*c9-(4)*c8
+.fill 1, c8+(c8*0)
+mov #c0*c10, r0
+.define c2 = 14/9-2 + -c8
+mov #c5+-c10-c15, r6
+.define c5 = (0+c2--4)
+.data (10)+c1*c2-19-(2), 2, ((8)+14)
+L9: .data -c0-c1+c4
+L10: mov L1[6], r2
+L11: .data c9, c5+2/c0/1, -c10-c5*1-10
+.define c0 = 19
+L12: mov L10[(c8/c4+(14))], r2
+L13: mov #c1+11, r5
+mov L10[c8--c1-c15], r2
+mov #c10/c8*(6)*c2, r0
+.entry c4
+.define c6 = (((19)))
+.define c5 = 20
+cmp #-c4, L12[4]
+.define c8 = 20/19-c3*nope-(c5)/c1
+L14: .fill 3, 4
+.define c9 = 20/2*10/18*17-c5/c6
+L15: mov #(-19+c10), r4
+prn #c5+10+16*16*c8
+L16: .data 11-c8+13/2, (15-0*(c4)), 8+c8+10*(-c2), 6
+L17: mov L6[c1-11+14-(11)], r2
+L18: .fill 4, ((c6))/c10
+.fill 2, c5
+.fill 3, c3
+L19: mov #(((c8))), r3
+cmp #13/9, L15[8/19*-17]
+L20: .data c15*nope, -11/c3*11*c6, c5-c5/-c0/13
+.define c4 = c1-1+c8/c5
+.data -(16/13), -7/c13--18/18, c0+c9+19+12/8
+L21: mov #((19))*1-c11, r0
+mov L18[c8+c3*(12)-c9-c0+6], r2
+.fill 3, c0---1
+.data -5-18/0, 4-(19), c8, c5/c4+c8*c5-7*c4-19
+prn #c4
+L22: mov #20*(c1/11), r4
+.define c2 = 7
+mov #1-c8/c8+c2, r2
+mov #-c8/4+12-c6, r1
+hlt
@@ -0,0 +1,109 @@
+L0: mov #18*19*0+17, r3
+L1: mov #20, r1
+mov L0[-L0*12], r2
+mov L1[--8-(1+15)], r2
+mov #(8)+X9*17--20, r0
+L2: .data -12/(7)
+.fill 4, 9-0/15/12+1+3
+.define c0 = ((6) + -14)
+.define c11 = c0
+mov L0[((15)+7/7)], r2
+L3: mov L0[5], r2
+mov #c11*7--c0/c0+c0*c11, r1
+.define c13 = c0/9
+L4: .data c13*c0+10, 2, -c13*c11
+.fill 4, -c0+11/9*c13
+L5: .fill 2, 9
+.define c1 = 8*c0 + 20/12*c11-c13*c11
+mov #c11-10, r1
+mov #c13+14*4*(c0), r0
+.data -10, c11+c1/20+c1/20
+mov #8, r1
+.data 5, 7, 9--14, 16
+.data c1, c0*5*20*c0+c11, 0
+mov #((12))/(-c11), r1
+prn #--1
+.data 3/c1/3
+.entry c0
+L6: mov #((c11+3)), r3
+.fill 2, 16
+.entry c0
+.fill 3, c0
+.entry c13
+L7: mov L4[---c13], r2
+.define c12 = -14-18*17 + c0-c11
+L8: .data c1
+.define c1 = 16-16-9*c13
+.define c12 = (0+c12*c0)
+.data 18, 11+12*c1-c1, -c0, c1-c0-c0/c12+18/X9
+prn #(14)
+mov #((11))*(0+16), r0
+cmp #c1/-8+c12, L5[c13]
+L9: mov #20, r6
+.data 19/17-1-c11, (14)+4-7--15+c13+8, c1/2-7+(c12), 13*7/c12/c12-5*9
+.define c5 = -c11
+.define c0 = c12
+prn #8
+.data -13-(c0)
+L10: mov L6[--c1*-c12], r2
+.data 13+c12-c1, --15
+.data --0-c0, 19, c12, c11*12-5
+mov #c0, r6
+.define c3 = -19-c0+c0*15*c5
+.data 6
+mov #--13+c13, r7
+L11: .data 11, (4-c12/(c3))
+.data 9, -(20)+c5, (-18)/-c0
+.define c13 = 0/5/c13+14+X9+c0
+mov L6[c0], r2
+.define c9 = --c12-14
+L12: .data -4/c12*c1, 15/(c12+4), -13+14-c3, c13
+.data L0, nope, 1+(c13), 14*5-10*c1
+.define c3 = c13+c5-12/c13
+mov #(3*7/(c3)), r3
+.data (L0)*c12/c0+13, (c5)/4
+cmp #-c13-10-c11+(c0), L8[c13]
+.data c13+18+11-c0, c0*0+1-nope*c0, c3
+.define c3 = -c3*c9 + 12 + 20
+.define c4 = 13
+.define c7 = c5
+L13: mov L7[(c13)-5+c1/(c3*c1)], r2
+mov L7[(c4/8+5+c13)], r2
+L14: mov L14[(c12)], r2
+.define c1 = (c13 + 8)
+mov #12/c3-c7-c0+18+-15, r3
+cmp #c13+9+c1*c7/c5*20/1, L9[c3]
+.fill 1, -7-c1+c13+c12
+mov #-c3-c12, r1
+.entry c13
+.fill 4, -16/c13+11*18/c13
+.fill 2, 16
+mov L10[8], r2
+L15: mov #(L0)+4-9+(16), r1
+.define c15 = c5*c11
+L16: mov #0, r5
+L17: .fill 1, 3/4-c12*c0/(15)
+L18: mov L18[13+13/c13-c3], r2
+.define c4 = 14-7*-c13-c4
+mov #c7, r7
+L19: mov L2[-c11+17/16*-c1/c12], r2
+mov L3[(c5-5)-c4-c3/(c4)], r2
+L20: mov #(2), r1
+mov L17[L0], r2
+.fill 4, (c13)
+.define c5 = 0/1/c15 + 11
+L21: mov L4[c7*0/11*-c1], r2
+.data -16/2*2+10
+.define c7 = c7
+mov #8, r5
+prn #c7/c4+c13/7/c15*-5
+mov #17*c1-12+16, r3
+mov #c13, r2
+cmp #-c5+c4/c12/-9--c7, L0[c7-c12+(c0+c1)]
+prn #c0-(-c4)
+L22: .data 2, (2/c4*16/3), -c1-20+20
+L23: mov #-c7/-4, r3
+.define c9 = 15
+mov #9*c7+nope--c3, r3
+.data X9, 0
+hlt
@@ -0,0 +1,63 @@
+.define c15 = 1-6
+.data 10, -c15*8-4
+.define c3 = --19
+.entry c3
+.entry c15
+.entry c3
+.data 5
+.data 18
+mov #c3/0/11*c3, r2
+.data 17
+L0: mov #--c3*c15, r7
+L1: mov #c3*c15-c15/-c15-c3, r2
+.define c4 = c15
+.data 13, nope-4, 1, -0+20/7+2
+.define c5 = c4+c4
+mov L0[17], r2
+mov L1[5], r2
+mov #(18)+1-18*c4, r0
+mov L0[4], r2
+mov L0[-18/c4/16*3], r2
+mov #(c5-c5)/7*20-c5, r4
+.define c12 = c3
+prn #-c5/c12+c5/c15
+mov #4, r6
+.define c1 = c15/15*c3
+.data 1*4--12-c1, c3*-7+-7, c3-15
+L2: mov #10/c4+c12/c15, r6
+mov #8, r5
+L3: .data 0, c4*0, c3-c15*5+9, 4
+mov #-c12-c4-14+(c15), r2
+mov #-c5+15-c3/0+7+c1, r3
+.data 11, 9-c12+9*c5+16
+.define c5 = 8
+.entry c5
+.define c8 = (14)
+L4: mov #X9*c1*c3/c8+c12+c8, r3
+.fill 4, (c8)/(c3)/12+(17)
+mov L0[c5], r2
+prn #c4
+.data 14+c15/c3/c3/11*16
+L5: prn #c15/(c15)*14/11
+L6: mov L4[c8+10], r2
+prn #c8+c8-c1-2/c4
+mov L5[-19/c1*c3*-c4], r2
+mov L0[c5/c1], r2
+.define c2 = (c12*c12-c5*c3)
+.entry c8
+prn #7
+.define c7 = c15-16-c4/13+-c5*c12*c3
+.define c3 = c15+18/c8+c3/nope-c2/14
+mov #c5-c2-9*c12/-2, r5
+mov L4[15/c3*-c1--8*c7], r2
+.define c15 = 12
+L7: .data c3-c12*12+16-8
+mov #c8/5*c15*-c2-0, r3
+mov L7[20], r2
+.define c0 = (c8)-c8-c7*9
+.data 17/(c15)/c3+6, -6/c2+20, c5, c0
+L8: .data (c0+8*c12-c12)
+mov #11, r1
+.data 7/(c8)-9, 10, c12, c1
+prn #3
+hlt
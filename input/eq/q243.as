@@ -0,0 +1,88 @@
+L0: .data 3, --9-1, (3+4)+3
+.define c13 = -9/2 + 0/7*1
+.data 8, -c13*c13/c13-(13), c13/((0))
+cmp #-14*7-0*c13, L0[(10)]
+.entry c13
+.data 1
+mov L0[((5)*c13/c13)], r2
+L1: mov #((9)*c13/1), r4
+.define c10 = 1
+.entry c13
+cmp #15*c13*19/11, L0[(2+c13)]
+.define c10 = 6-c13*3
+.data (11)+c10*-7/c13, c13-20/c10*c10--c13, (--1)
+mov L1[11+0+13*c10-4/4+c10], r2
+.data 16, c10*7*c13-12/c10, 11/13/18+c10-(6)
+mov L1[--18*-8], r2
+L2: .data ((c10)*c10+c13), 5/20
+mov #4, r2
+.entry c10
+.define c0 = 17
+.data c13, (c10*15)*(c10*c0), 5+c0+6*11-c10
+mov #--c10, r6
+mov L1[c10-c0*c0+c0-16], r2
+prn #6+c13
+mov #c10, r1
+prn #c10/c13-2-c10/5
+mov L1[c10+12+c0-c10*c0], r2
+.fill 1, 16
+.define c12 = c10 + c0-15 + 14*c10-5/(c13)
+L3: .fill 2, -c12-11*L0*10
+prn #19+14+4
+.define c15 = 6
+mov #20, r7
+.data 14, (16+4)-c15-14, 0*c10, -5-c13/X9+20
+prn #c15-18
+L4: mov #((18))+c10, r4
+L5: mov L0[6*9*c0-(c0)], r2
+mov #c12/1+13+c12+14, r6
+mov #14, r7
+.define c5 = 17/17
+.define c0 = 5*9/10 + c10
+mov #7, r5
+.data c0, c0/1, -1+7*c5
+.define c15 = ((c0)/15)
+.define c3 = c10-c5--13/7
+L6: mov L1[5], r2
+.define c4 = ((c15))
+.define c14 = (--c0)
+mov L2[X9], r2
+mov #-c5*c12/c4+12, r0
+.fill 2, -c10-4
+.data -19-16+15
+L7: .data c15/c0/7/c10+12, (12)+c14-c5/c15, -c3/c0-11
+.define c8 = 13*6*c10/17-c0
+.data 18/c13-15-c14
+mov L7[nope], r2
+cmp #8, L7[-11*c10-c8]
+L8: .data (2), (4+-5), c3, 8
+L9: mov #-c15/12+2*(17-8), r4
+cmp #X9-(1)--c0, L5[c10]
+mov #(10)--12/c0*4, r5
+L10: mov #c0/c12+6--c0/c14, r7
+.define c11 = (c15*c15+c15*c15)
+.define c12 = c0
+.define c9 = 16
+mov L9[1], r2
+L11: mov #c12, r7
+.define c5 = (20*2)/9
+.define c0 = -c11+13/14
+.define c4 = L0
+.define c12 = c10
+.data c13/12-8-c14, (c8+1), 9, (((c4)))
+.define c3 = c0+13/10+18
+.define c1 = -4*-20*4-c14
+.define c1 = -18/c0 + 5 + 13/c15
+cmp #8/c8-5/((c3)), L8[c0-10*0]
+mov #c14, r3
+L12: prn #(c4-c5*c9+3)
+cmp #-c11*3+9, L1[c12]
+L13: .data c4, (13)-c15+X9*14, c1, c10/3+c0+-c8-c11
+.define c5 = --c11+((c3))
+mov #(c5*c12+5/c8), r4
+prn #4
+L14: .fill 1, c3
+L15: .fill 2, 16/6+c5+3
+mov #12, r4
+L16: .data 19, 9*8-5*-10*c12, 19--c4-2+c5
+hlt
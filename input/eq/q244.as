@@ -0,0 +1,117 @@
+prn #-19+-10
+L0: mov L0[12], r2
+.data 2, -6+10
+L1: mov L1[2*1/5], r2
+.define c13 = -12+11/6
+L2: mov L0[-c13-15*((c13))], r2
+L3: .data 17, 8/c13+c13-(c13)
+.data 6, (c13+1)/12, 2+3*13/4-(-11), -17-11*19/10
+.define c14 = c13
+L4: mov L3[15*c13+9+c14/17], r2
+L5: mov #c14, r7
+L6: mov #c13*c14/c14+3, r6
+.define c1 = (c14/c14*9)
+mov #(3*17)*c13, r3
+.define c3 = c13+-(10)
+.data -9-c3-c14+c3, 12, c3, (20+(c3))
+L7: .data c13*c14+4/c1, c14, c1*c13/c13-9+10*X9, ((1))
+.define c13 = -(13)
+.fill 3, c3/4/2/2*c1+13-c14
+L8: mov #c14/c13-3*0, r2
+L9: mov #c13/c13/c14-c14*0, r7
+mov #(c14)/18/12+(c14), r7
+.fill 4, 18
+.define c0 = (4)
+cmp #--20*(c14), L3[-10/c3-4*-0/20]
+mov #0-c1/-6/0*9, r7
+.data ((7*10))
+mov #2, r7
+L10: mov L1[c1+c0-6--c13/c13], r2
+.define c8 = c0 + c13 + 6/12-c3 + 0
+.define c10 = (c3)/19/c13-c13/9
+mov #(c1), r3
+L11: mov #6-c0, r6
+L12: mov #17, r1
+.define c1 = 7/c13-c13+(c10)+c8+c8
+L13: mov L5[c13], r2
+.define c0 = c14
+.data 19, -(10)*(c0), -c13*15
+.data 14-c13, (1), -7/c8/c8+X9*c8
+mov #13-20, r2
+mov L10[15], r2
+L14: mov L0[(c8)*c3+-9/0], r2
+L15: mov #c0/c0, r0
+.data 12*(14)-6/c1/c3, c1
+mov L15[c0*-15/18], r2
+mov #((c0)*c1), r2
+cmp #c13, L4[(c14/-3)]
+.data -(1)*c0/c13, (c14-14+(c0)), (14-13)+(c3)/c1-11, (c1/15+c13-c1)
+prn #17
+mov #6*c8, r0
+.define c9 = (c1)
+mov L5[c9--c14/c8], r2
+L16: mov #(c1)*6*12+-c13, r3
+L17: prn #-20+c8-c14+2
+.define c3 = 6+12+c14/17+c8-13
+.define c0 = c14-c0/12*11/-6
+L18: mov #17, r1
+prn #19+c9/4--c1
+.data c0/c0+4/-L0*0, (9)/17-2/(c1/c0)
+L19: mov #--7, r0
+mov #--4-10-c1+14*12, r1
+mov #c13, r5
+L20: .data 17
+prn #-18+-9+L0
+.define c13 = 18
+L21: mov L21[c3/c13-c3/c14*6*c8], r2
+mov #(19/c13)*(19*c10), r2
+.define c13 = 15
+.fill 4, 16
+L22: mov L18[c14+1], r2
+prn #c0
+.data c1, (c0)
+mov #-7+c1/c13*c3-c9, r6
+L23: mov L19[0], r2
+.define c9 = 1/c9/1
+.define c3 = -1/16-20
+.data c13*14
+mov L18[8], r2
+L24: .data 20+10, -2/17-3+-c9*c13/6
+mov #9-c0-c8+c10, r3
+mov #15, r5
+L25: mov L0[-c0*19-0-c0], r2
+.entry c1
+.define c11 = (4/19)*(5)+16-6
+cmp #11, L20[7]
+mov L2[((c1)+(c0))], r2
+mov #-2+-14, r4
+L26: mov #c1, r0
+.data -18+3, -(13), 18, c13
+mov #c13+c13+11*11, r1
+mov L14[c9/17/3*-15*18], r2
+mov L9[c13*-c13/-c8], r2
+.data -14/c14*6*6/c13*13, -c13-c13-c0, 4, 10+3*c10-19/(c3)
+mov #c0, r5
+prn #c8
+prn #2
+mov L0[-2/18+(18)], r2
+prn #((0+9))
+mov L26[11/3*12], r2
+.entry c0
+.define c7 = c3
+.entry c11
+mov #c10+c14+(10), r0
+L27: cmp #(c9), L4[19]
+.data c1
+mov L3[-c13], r2
+mov #c9, r6
+mov L16[(c1+c11)/-c14], r2
+L28: .data -c8+9+-9, 7, 20-20+14+3+14-c1, c13
+mov #8, r4
+L29: .data 9, 16+(c3)/c7
+.define c12 = (17+14)-c1*4
+mov #c1, r1
+L30: mov L17[8], r2
+.data -((12)), c13/-14+20
+.define c4 = (13-c0)*13
+hlt
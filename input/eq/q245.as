@@ -0,0 +1,37 @@
+L0: .data 12-11/2/1*9-6-20, nope+10/1/18/17*-17, -1*18-3
+L1: mov #(9/12/19), r2
+mov L0[0], r2
+.define c10 = -(3-1)
+mov L0[2], r2
+L2: .data 5/9-c10+4*18-8, (c10-c10/4-c10), c10/c10*c10/-(c10), c10
+.entry c10
+L3: mov #(7+18*13), r2
+L4: mov #c10*(c10)*c10, r4
+mov #c10+c10-18*(8+8), r4
+.data 16+c10*--c10, (-0/14+c10), c10, -20
+.data 12+20*c10*c10*c10, (c10*11)*11
+prn #(c10/c10)
+prn #3
+.fill 4, (c10/5)+((15))
+.data 15, -c10-15-10, 3, -c10+14*(16)
+mov L2[1], r2
+.data 15-2/c10/13, 5, 15-c10/16*-1
+.define c2 = c10 + 4 + c10-(14*6)
+.data (-c10-20), 3, --c2+16
+.define c14 = 1
+mov L0[(c14)--c2*8], r2
+.define c7 = c14
+cmp #X9*1*(3), L1[15]
+mov L3[16], r2
+mov #15, r0
+mov #c2+(c7)*15+c10, r6
+.data -c2, (13+c7-c7), c2*c2
+L5: .data (0), c14
+L6: mov L3[16/-19/c14], r2
+mov #c14/-c10, r5
+.data (17/0/16)
+mov L3[-2*-9-5-18/19+16], r2
+.define c8 = 1/c10*c7/2*20*c10
+mov #c7, r4
+.define c4 = 15 + c7
+hlt
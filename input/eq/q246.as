@@ -0,0 +1,28 @@
+mov #18, r2
+.data 11-4/15*1*(0)
+prn #14
+.data -9/19, 1-12+-14-11, (19+9)/7/0*20, 9-1+15+-16/13
+prn #10-16*8+14/19-9+14
+.data 3-4+18*3, 16*17-12/10-10*9, 5*0+(3)*4, 12/1
+L0: .data (4), (5)+8---7, 3*6+17/17
+.data 4/-20*(15), -3/12*(12)
+L1: prn #5
+.define c4 = -13/20-20+8
+.define c2 = -(20/9)
+.define c5 = c4
+L2: .data 9, -c4*c4+-c5, (18*10+-11)
+.define c1 = 19+9/c5-c2/c2
+mov L1[(c5)], r2
+.data (3), c5, c1, c5-3-20/11/c2
+mov #(c5)+7-c2-c1, r6
+.entry c2
+L3: prn #c5/19--c1+17
+.define c8 = (12/c5)*14-c1/15
+mov #10, r5
+.define c8 = c5/5
+.define c11 = 10/12/19
+mov L2[(3)-(c1)-9], r2
+mov #16, r0
+.data 14
+prn #7
+hlt
@@ -0,0 +1,79 @@
+.data 12+4-17+13-(20), 8*19+(X9)*10, 6+20+3/9*20, (3*0)/5-1-5-5
+.define c6 = 4
+L0: mov L0[10*c6/0*15], r2
+mov L0[(c6+20+c6+c6)], r2
+.define c0 = c6
+.data (c6), -8/c6+17/c6, 14/13/c0/c0-10*11*9, c0*-(4)
+.define c0 = -4
+L1: mov L0[-(c6)*c0], r2
+.data c6, 19-11-10+(1)
+cmp #7/16/c0-20/c6, L1[((c0-c0))]
+cmp #10, L1[7]
+L2: prn #-c0/c0/0
+.define c3 = 2
+mov L0[(3)-0*c0+7], r2
+mov #c0, r6
+mov #c0, r1
+L3: mov L0[(c0+1)/c0], r2
+prn #-18/c3-3*c0
+L4: mov #-c0*c0*c3, r2
+mov #9+9+1*c6/9/8+16, r1
+.define c12 = (6)
+L5: mov L0[5], r2
+mov #5, r7
+.fill 3, 20
+.data 13, c0
+.data 18+-7, -c3-8
+L6: prn #16
+mov L2[c12], r2
+L7: mov L6[0], r2
+mov L7[(19)/2-c3*c12], r2
+mov #3, r5
+cmp #c0, L0[c12/16]
+L8: mov L4[c6], r2
+L9: mov #c0, r2
+cmp #18, L9[-10-c3-16*10]
+L10: mov L3[c6/c12-c12], r2
+.define c10 = 17-0-c0-18
+mov L9[c0], r2
+L11: mov #-c10*c12, r0
+.define c12 = -14/L0 + 16 + c6*(5)
+.fill 4, c12
+.data 1, c3-c0, (14)--c3/c0-18, c10
+mov L10[19], r2
+mov L6[0], r2
+L12: .data c12, (c0-c6)/7+(c12), 10
+mov L6[c0+c12-c0*c6], r2
+L13: .data ((17)+11*c0), (16)+(c3)-c12, -c6*c6
+L14: mov #c0-(20)/c3, r2
+.define c9 = 18 + c6-c10/c10*8/-12
+.data -12-15-6, ((14-12)), (19/c12)+c12
+mov #0, r0
+mov L5[(c10)/-(c9)], r2
+L15: .data -c3+14-9, (13), (19), c3-c0
+.data (15+c9), (c6), c9
+mov #c3+7*c12-nope*8*c9, r0
+prn #c3/18*(20)*19/L0
+mov #5, r5
+L16: mov #c0*18*c9*8*12, r6
+.fill 1, 7
+mov L16[16-c6-c6--11], r2
+.entry c9
+.data 13-7*11/9
+mov #5, r5
+L17: .data (16+c0-12), c6, 1+10*c3/13, 11+c10*1*c0-10*10+0
+mov #-c3*10+1-c9, r4
+L18: mov L3[X9*12+15/(c6)], r2
+prn #-11*c3-7/c0+17
+.define c5 = 7
+L19: .data 10
+mov #(c12-c6*c0), r4
+mov L5[-3*17+17], r2
+mov #c0*L0-L0-3+(c0)/(5), r0
+cmp #-6, L1[6*c9]
+.define c4 = 20*-c0/18
+prn #15+nope*c0+14
+L20: prn #17-c0-c9/((c0))
+L21: .fill 4, -3+7
+L22: .data c3, c5--13/11, 20-c0
+hlt
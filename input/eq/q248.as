@@ -0,0 +1,74 @@
+prn #15/(3)*14
+mov #6-(13)-7, r0
+mov #13*18+17+6-(nope)*7, r6
+.data 8, -3-(18)+11, 11*((0)), 13/10*--19
+.data -2, --nope+L0-14+11-19, 19, 0
+.data ((9)-nope/12), 17-18*12*-10, -6*14
+mov #14/7+18*3/2+3/11-10, r5
+prn #1*(14)*1*14
+L0: prn #15
+cmp #((-6)), L0[-5]
+.define c6 = 15
+cmp #16/-2*-0, L0[(14)]
+mov #c6, r4
+.define c15 = c6+11-5+c6+(19)-16
+mov #c6+0+c15+3-(c15-18), r0
+mov L0[(-18/10)], r2
+L1: .data c15, c15, c15/c6-c15+0/c15, c6
+mov #9, r3
+L2: cmp #0*0-1+0+8, L0[3/7-5/c6]
+.fill 2, c6
+.define c5 = c6
+mov #1, r1
+prn #8
+mov L1[1], r2
+mov #((19))-c5+1/16/c5, r1
+prn #c15
+prn #-c6+c5+16-c15
+.data c15+c6+c5*c15
+L3: mov L3[18], r2
+cmp #0, L3[(15+c15-5)]
+mov #c5/12+c6/-c5, r7
+L4: .data 15, ((17)), 3, c15
+.define c15 = --20*c6
+mov #-1, r4
+.define c3 = c6
+.define c7 = c15-c5 + 2-6-0
+mov L3[1/20/c15], r2
+.data 4, -17, c6, (10+13)-c3
+L5: .fill 2, -11*7+6/5
+mov L2[(c3+c6/c5+c7)], r2
+mov L5[(6)], r2
+mov #c15, r1
+L6: cmp #3, L1[c15/5*6+7-16]
+L7: .data c15, 14+3
+L8: mov #c15, r3
+prn #c3-9-(7)-8*19+18
+.define c6 = c6/c15-c5/14-c15
+L9: .fill 4, c5-c3+-19/c6+0-5*18
+.data 16*-c15/(17)+c6+c5
+L10: mov L6[(11/8-3-c7)], r2
+.data c3, 11+(c5)/17*5, c7, c5
+L11: mov L5[c3+-c6/(15)], r2
+.define c3 = 3
+.data -20/19/0, -2*20/19
+mov L1[(13+8/11)], r2
+prn #c3
+cmp #-((11)), L9[14]
+.define c4 = (17)+8
+.data 17-c6+c6*c15+0*-11, 4-c6+c4*9*c4
+mov #1*(2/6), r6
+L12: prn #c7-8+20
+mov #c7, r7
+L13: cmp #c3+c7*3/-13, L8[(c3)]
+.data 13+13-c15, 14/7/6*c3+16-c5/6+1, (8)+(c4*c3), c6/10-c6-0-(1)/(c7)
+.data 10-c7+X9-c6, X9, c15, -c5
+prn #--16/0/c15
+L14: mov #-c6*6/c7-11, r5
+.data c15, -(18), 6*(c6)
+.define c2 = (c7*7/13)
+mov L1[c3/6], r2
+.data c15-c15-c15, 13
+.data c3/c6*nope--c3*4, (c6)+(4/16)
+L15: mov #c6-c15, r1
+hlt
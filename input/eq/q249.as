@@ -0,0 +1,55 @@
+mov #(-13)/4*4-13, r7
+L0: prn #1/10+15
+L1: mov L0[6], r2
+.data 6, 14, (1)-10/7-12, ((1))
+mov #-6-16*11-20+9, r5
+L2: mov L1[16], r2
+mov #3, r7
+.data -9+5*-10*18/1, 5+13-3+20, 0-12/7*4-4*13/8
+mov #2, r0
+L3: mov #nope-16-14+-3+0, r5
+mov #(12)-4, r0
+.define c5 = (15)/11
+mov #c5, r7
+.define c2 = 15+c5/16*c5*c5
+.data c5, -c2/c2*14*c2*9*4
+.define c8 = (0*c2 + 0*c5)
+cmp #0, L3[c5/19/c5/c2]
+prn #c5
+.fill 4, ((c5+10))
+mov #7, r6
+.data 1-c5+c8/16
+mov #(18)+c8+-6/c2, r2
+L4: .data 4, c8--c8*c8, c2/c5+8*c5
+mov #15*c5+(c8)/--c2, r3
+L5: mov #(-c8), r2
+mov L0[(15-14)-5], r2
+L6: mov #c8+(3/c2), r6
+L7: prn #10*1--9-c5
+.define c8 = c5
+.define c0 = 9*c5-(c8)/c8/6-c5-10
+.data --18, c0+(12-c2), (c5-c8)/c0*-15
+.data -12-c0, c5/17*6/18*(17*c0)
+.data 16, 1, 6*4-c5*14, (12-c2)+c8
+.data 14/(c0)/-L0/-c8, -c8, 17
+mov L0[-c0--c2], r2
+L8: mov #14/5*(13/c5), r6
+.data 9
+mov #c5*8-c8*2, r0
+mov L8[--c8], r2
+mov #-13, r3
+L9: mov #-c2/1-19, r5
+mov L5[c2+c8/20*3/c8], r2
+prn #9+c2
+.define c4 = -9/2-c5
+.define c8 = 1*-c5
+.data c0, (-1/(c4)), (c5), c4+c8/c0*9+-c2
+L10: mov L10[-c4-c5+6+19/c2/c5], r2
+.define c5 = c5
+.data c5, (-0*c8*c0), ((c4)*11+12), 20/c8-7+c2*1
+.define c9 = (c8-c5) + 20
+L11: .data c8, 2, -(c8/16), 15
+L12: mov L12[-(6)+9*c0], r2
+L13: mov #-c5-2+19, r4
+mov #18-c9*(c2)+(7), r7
+hlt
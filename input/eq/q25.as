@@ -0,0 +1,69 @@
+prn #9
+L0: mov #(19+6)*18, r5
+L1: mov L1[20+(18)+19*6], r2
+.define c0 = 5
+mov #c0/4, r6
+mov #(11), r1
+L2: mov L0[19-c0], r2
+mov L1[-((c0))], r2
+mov #19+1*(8-c0), r5
+.define c1 = c0 + -8-c0-20-c0
+L3: mov #c1*c0, r0
+L4: prn #-c0+c0--(c1)
+prn #-4
+mov #c0*1, r1
+cmp #15, L0[-c0-3+-c0-5/19]
+.data --5*((c1)), (c0)
+mov L3[-c1-11/5], r2
+L5: cmp #((12)), L0[(c0)]
+L6: prn #c0
+.define c2 = c0/5+(c1)*4+c1/5
+L7: prn #17
+.data c2
+L8: cmp #-0*3+c0/5, L1[13/1-0-18+15]
+mov #c2--10+-(c1), r6
+cmp #10+(c2)+2+11, L3[c2]
+.data 2, c1
+mov L7[7-12+c1+c1*(0)], r2
+.define c3 = --c2-c1
+L9: prn #c0-15-c1-c0+-(5)
+.define c4 = 9+c0
+.define c5 = 7
+mov #(c4+c1*-13), r3
+mov #12, r6
+.data 2
+mov #-9+10+c2+c3, r0
+mov #c2/3*c3*-19*c2, r1
+mov L9[10-(c3)*c2-c5], r2
+L10: prn #--2+c4
+mov L8[(-c1*11)], r2
+mov L8[16-13-15-17], r2
+.data 15, 14
+.define c6 = 12/2
+mov L8[c3+c4*11+(c1)-c2/4], r2
+.fill 4, c6/3
+.data c6-c5, -c6*c5/1, c0, 12-4
+prn #c2-c6*7+c4-3
+L11: mov #c4+c5+c2*4, r4
+L12: mov L2[2], r2
+.define c7 = (14)*20/3*c0+c5/2
+cmp #-20*c7-16-19, L7[-c1--c3]
+prn #11-c1-c1-c7
+L13: .data 4
+.define c8 = 4
+L14: mov L7[-(c0)-c6*4], r2
+mov L12[c2-c1-c7*c1*8-12/2], r2
+.fill 1, c6*11+c5+6-c0/4/4
+prn #-c5
+mov L14[9/4], r2
+mov #15, r5
+L15: mov #c5+-19/3, r5
+L16: mov L10[c4*c4], r2
+.data (-9), --c1
+.data 18-(c3/17), 4/5, c3*0/4*-c2+0
+mov #-16-c8/6, r3
+.define c9 = (c3/5)
+.data (16/9+-c0), c7, c0
+.fill 1, c6
+L17: .data 20*c3, c1+c5+2*c1, c8
+hlt
@@ -0,0 +1,70 @@
+L0: .fill 1, 3
+.data 4+-16/6-(5)
+L1: .data --16+0
+L2: .data 5, -8+0-1
+cmp #8, L2[((13))]
+.define c8 = 13/4--9/15
+.data -13+19-12, c8, -10+X9-c8
+L3: prn #((15+c8))
+.data L0
+.data c8, (-6)+c8+c8
+mov #((c8/c8)), r0
+L4: .fill 3, 6
+.data 19
+.data -c8/10*20*c8, c8/c8+c8, (c8/4)/7
+mov L2[6--c8], r2
+.data --c8+c8*c8, -c8--c8-c8
+prn #c8
+mov L2[c8], r2
+mov L0[18-(c8)*18/15/(6)], r2
+L5: mov #-c8, r0
+.define c2 = (c8*c8-c8)
+mov #5, r3
+mov #17, r0
+.define c13 = -19-c8*10 + c8
+mov #4*-c2-10, r2
+mov #c13, r2
+.data c13
+.define c0 = (((17)))
+L6: .fill 3, -c13
+mov L5[c0], r2
+L7: .data c0/c2-c8*c2, (19/c0*12+14)
+mov L5[-5], r2
+prn #0
+mov L1[(c8)], r2
+L8: mov L5[(c0)], r2
+mov #(c2+7+12*19), r7
+.fill 2, c13
+mov #11, r5
+.entry c0
+mov #11-2+4/13/7, r7
+.define c0 = (20*17/14)
+mov L7[5], r2
+.data (-2-c2/16), 16*(c2)/c0
+mov #--1-c8, r0
+L9: .data 2+c0+(c0)*(c13), -c2/(4)/c13-1, 19*(c0)*c0
+mov #5/11-c13+16, r2
+.entry c2
+prn #17+13+8--c0
+.entry c0
+.define c5 = c8+c8-c2/14+(9)
+prn #c5/5+5+c0+1+3-c13
+.define c11 = 8-16/c0-c13*9-c0-c2*c2
+mov L9[c0*c0*c8-c13/7+c0], r2
+L10: mov #3-c13--2+-19/c11, r3
+.data 1, c8-19
+.define c5 = 15
+.entry c2
+mov L4[7], r2
+mov L8[9], r2
+mov #5, r4
+L11: .data -c13/2*13-c5, -c5+9, ((6))/1*c11/c13
+mov #c5, r6
+.define c12 = c8
+mov L8[13*c2*c2/c13*c5], r2
+.entry c0
+.entry c11
+.fill 1, (c13-17--c13)
+cmp #(c0/18-12/2), L1[--c11-13/c2]
+.data (8)-c0*7/c0, 17/5+-10
+hlt
@@ -0,0 +1,77 @@
+mov #19-((12)), r2
+prn #1+17-3/-13-19
+.data -16, 9, (14)
+.define c0 = 2
+prn #-19
+.data (c0*c0)-c0/X9/c0, 12*c0-4+c0*2-15/4, (10)-3+7--c0, (9+19*c0+c0)
+mov #c0/16-19/c0*c0, r1
+.data (c0+6)*c0/c0-13+c0, 20
+mov #2, r4
+.entry c0
+L0: .fill 1, 1+c0+13+5-7
+mov L0[c0+9+13-1-c0], r2
+mov L0[5], r2
+.entry c0
+.data 17+c0-2, c0
+L1: .data 9/14, 6, c0/15+4+18/9*c0
+.data (6)+6, (-c0/3), c0, ((c0)*(c0))
+mov #10, r0
+L2: mov #-9+18+c0, r4
+.data -c0+18+L0+c0+c0/c0, -(c0)-(11), 15--c0*15, c0
+L3: .fill 1, -20-17*c0
+.define c11 = 16
+L4: prn #7
+.define c6 = -c0 + 8*9
+.fill 2, -c11*10*c11/2
+.data c0, 20, --17+(c11), 1+0*0
+L5: mov L4[2], r2
+mov L1[(c11)], r2
+mov #(c6), r1
+L6: mov #(10-c6/c11), r1
+.entry c6
+.define c13 = -c0/6*-11/c11
+.fill 1, (9*11-11/17)
+mov L5[17-16*(6+19)], r2
+.define c12 = 12-(5)
+.entry c0
+.define c0 = 1 + L0-12-16/5
+mov L3[c0], r2
+mov #20, r0
+.define c15 = 0
+mov #(c12), r3
+L7: mov #0, r7
+.define c3 = -3 + 19 + 2-8
+.data c12+(c0), 17*c11+c0-18, --16, 0+c13-c15+c0*c11
+prn #c15
+mov L1[c6], r2
+mov #(13), r1
+.data -c11-14/7, -c0/-11, (c13/16)+c11, (-c0/11-4)
+.data c12+c6*17-c3, ((c15))
+.define c10 = c6
+mov L6[9], r2
+.fill 3, c6-(c11)
+mov #c11+(c12)*-8, r1
+.data -(c0)-c13, (c0)
+mov #-(5-19), r6
+mov L0[12], r2
+mov L5[--9*c15*15], r2
+L8: mov L5[(20/c13*10)], r2
+mov #8*(5)*17-c6, r5
+L9: mov L0[1-13*c15*-8-c11/c0], r2
+.data --c12+-7, -4-c10-2*c3-2-14
+L10: mov #-c0*c0/c10, r7
+prn #c15-c15
+mov #-15*6-17, r3
+mov #X9, r5
+mov #((c3)-4/c0), r1
+mov #20*5-c10-c11, r4
+cmp #3, L5[c11-(c13)]
+mov L4[c0], r2
+L11: .fill 4, 6
+.define c13 = (-c0/(8))
+prn #(18+15)-c0/1*-15
+cmp #-20/-18+3, L4[15-7/15+19+6]
+mov #c13, r0
+L12: .data (c3)-17+c13-c10, c3+c12*(12/13), 2, -(c0)/c13*c6
+.data 7+c12, (4-c0)-(10)+c3, c13*18/c6/c3/c6, -3*(0)/(7)
+hlt
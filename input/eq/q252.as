@@ -0,0 +1,120 @@
+mov #6, r5
+.data 1+9-2*20+7
+.define c0 = 3+9-12/17
+.define c12 = --c0*8 + c0
+prn #c12+c0+-5-5
+.data c0
+L0: mov #--c12+-6*7+c0, r7
+.data 3, (c12-c12*20)
+L1: .data (10)/c0*6/c0*c12+3
+L2: .fill 2, 10/8/5-c12*c0
+L3: .data X9, 0
+mov #13, r1
+.define c1 = 8
+prn #c12
+.define c8 = c12-5*-c0-2
+.define c8 = c8-9
+.define c6 = c12 + c8--c1 + 12
+mov #(c6/c8/c6), r1
+.fill 4, (15)*(c8)-9/7
+prn #c1/c8-8/c0/-c6*c8
+.define c0 = (c12 + 0)*6
+.data -c0*9/c6+(12*c6), -c6+11+4-18*1*10, 0
+mov #18/5+c0+-20, r2
+.define c14 = 5-9/c0
+.define c2 = 20
+prn #(c1)*0-1+17-c14*-16
+.define c15 = -c0/16/c1-c6*0-c2
+.entry c15
+mov L1[-8], r2
+L4: .data 17, -c6, c0*(c2)*(12), (c14)*-c8*c0
+L5: .data -10*c15/-(18)
+L6: .data (c2)/(2)/10+c8-(0), 5*(11)*(c12), (c8/c8)-13/c12+c8
+L7: .data 6, (3)-19/7/7*-c0, c6, 19
+mov #c0, r7
+mov L6[c6+c12], r2
+mov L7[0], r2
+L8: cmp #10-0, L1[c1-20*c1-c15]
+L9: .data c8, -1, 14, (3)/4+c2
+mov L7[18], r2
+.entry c0
+mov L2[(c8)], r2
+L10: mov L0[-c15/4+c2-3-8], r2
+.data c8/15*17*c1+c14, 11+5/8
+L11: .fill 1, 19/17/(18)
+mov #(17/c15/14/c0), r4
+mov #(2)*-c8*(19+12), r4
+L12: mov #8, r7
+.define c4 = -c14-12-2-c6
+.data 17-c4+c8-20, (c8-L0)+-c6/-c6, c4/c6+c12*c14
+L13: mov L13[(-18)], r2
+L14: mov #c4*c12/c8*(13), r3
+.define c13 = (12)-c6*13-c15-c15-c0+c14
+mov #-(16), r5
+mov #6+(c0+2), r3
+.data (c2)+c6/4+4, (2)/11/0+5-c6-1/c6, c14, -17+c6/15
+L15: .data 14/c15*c14*c14+c13
+L16: .data 13, c0, c1
+mov #19/3/-c6+-c15*7, r2
+L17: mov #-c6*12*c2-(c0), r4
+L18: prn #c4+--c4
+mov #(c15), r1
+mov L2[c6*c15], r2
+.fill 3, c1-11-7-(X9-10)
+.define c14 = 10
+.data 9/c4, -c0-14-c13, (18)/(11)-5-X9-9
+.data (4)*-c4
+.define c5 = c4
+prn #8
+mov #---c15, r3
+.data 6, c6, --c14--c5, -(19)+12
+cmp #c0, L6[0-c12+-3/(18/12)]
+.entry c12
+mov #(-(c1)), r1
+.define c2 = c8/c8*c15*c14
+cmp #10, L5[10]
+L19: mov #11, r4
+.data 9-18/17*20*-c2+c0, 1, 0
+mov #c6, r6
+L20: mov #6, r4
+.define c11 = -c2/1*3
+mov L11[c2+c0--8+c6+c2*-c0], r2
+L21: mov #--c5/c13, r4
+prn #8
+mov L11[(c15)], r2
+.define c13 = c14/2+c13-c12+17+0
+L22: .fill 2, (c11)/16-c8*17
+L23: mov #c13, r7
+mov L16[(3)], r2
+prn #((c4))/-1--7
+mov L2[6*c11/1-c14], r2
+mov L6[-6/c5-c6/((c12))], r2
+.define c6 = c2 + 2-15 + c13*c11*c11 + 2*c12
+.define c6 = 7
+L24: mov L2[c13], r2
+.entry c14
+mov #c14, r2
+.entry c2
+.define c1 = (-5)
+mov #0/c13-2-c5, r0
+cmp #18-7+c6, L1[12*7/c13*c1-c1]
+L25: mov #6, r4
+L26: mov #c6, r1
+.data c13+14-15/15-c6
+mov #11, r6
+mov L8[c8/7/2*3-7], r2
+L27: mov L17[c1], r2
+mov L20[1-c13+c5-c0], r2
+mov #(-c12)*5/c2*4, r2
+.define c1 = ((18*16))
+prn #nope
+L28: mov #c13, r5
+L29: cmp #13, L10[-19--c15+-20-c4/c2]
+.data c8, 6/c6
+cmp #-(5)+20, L22[7-c1*-8/1]
+.data 15
+mov L13[c14], r2
+.fill 4, c2
+prn #c13-c1/c11+1-c12
+.define c3 = (c13+7/1)
+hlt
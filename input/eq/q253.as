@@ -0,0 +1,89 @@
+mov #7, r1
+L0: cmp #17, L0[-20]
+.fill 1, 12*5-(5)
+mov #12/-20-12, r4
+.data (11+2-0*6), 18-17*(0)/18, (11)+6/1--4-0/L0
+mov #4-16+16/12+4, r5
+mov #13, r6
+mov #16/10+3/8-4+19-18, r0
+mov L0[(6*2*0)], r2
+mov L0[((2))/L0], r2
+L1: mov L0[1], r2
+prn #(15/15/L0*11)
+L2: mov #7/13/18+18-13/1, r1
+L3: prn #(16)*5+12
+.data (6--6)
+.define c2 = 11*X9*14-6
+L4: .data 8, (-8)/c2, -20*5-(c2), 18
+.data ((5)/0), -c2+--7, 15*6, c2*c2*c2*c2
+prn #-7/c2
+.define c12 = -(7) + (c2)
+.data (13), --13/12-6, c12, 12/c12-12+10*0*(11)
+.define c7 = ((14+c12))
+.define c3 = 16
+.define c10 = -(c7)*(19)
+L5: mov #c2*-L0/c2+3, r1
+L6: .data c7*(17)+-4, -1-20+3*c7/c3+16, --3
+L7: .data 4, 7+-c10+c12-c7, 7
+prn #c2-c10
+.fill 1, c7+c12/(c2)*L0/c12
+.entry c10
+L8: .fill 2, c12
+prn #c2*c10*c10+c12
+.define c12 = 1*17
+L9: .data c2-13*(15)/(17-c12)
+.data c2, -c12/c2*5*c2/-c7
+mov #17, r6
+L10: mov #(3), r1
+.data (14/c3)-c7, 11-(15)*-10
+.data c2, (c7+7*12+c7), -c12*c3+16, c2
+prn #c10+(c7)/c10+19
+.define c13 = -(11)
+.define c8 = 10
+.fill 3, 7
+L11: mov L11[6], r2
+.define c0 = c3/c3+X9/-7+20
+.data 12, 7, 11
+.define c6 = ((c2)-7/c10)
+L12: mov L1[1], r2
+L13: .data 1, c12*c10+14/-20
+L14: mov #c8-c8, r1
+.fill 4, 1/11+(c6)/(-c12)
+L15: mov #c12, r6
+L16: .fill 4, 13-6*c12/20*c7
+.define c5 = -17 + 17*2
+.entry c13
+L17: .data 0, (c5/c7)*(c12*6), 3-c8+1+2+8/15/c12, c7*(c7)-c12*-c6
+mov L7[8+c12+1-8-8*20*c5], r2
+cmp #(11-c10+c12), L17[((c6))/14]
+.fill 4, c12/c8
+.entry c0
+prn #-c6
+mov L9[(c5-c12)], r2
+.define c10 = (c12)/c10-14
+.data 1*17/2--7*c3, c10
+L18: prn #2
+mov #c12, r6
+.data --12/3
+.define c13 = 6
+.define c0 = c12*15--15/c13
+.define c6 = c0
+.define c1 = 5
+mov L12[-6*8+4], r2
+.define c3 = (18+c13*c13+c3)
+L19: .data (8)/(c5/18), c0, c10-c12+c5*c3+5
+cmp #9, L11[5]
+.data (11)-0, c0/6/c3+c5/3-c3, 3, -c6/c12*c6
+.define c13 = -c10/9*c3 + 2-(c6)
+cmp #--7*19, L10[c0-12/c12/16-c3-(6)]
+L20: .fill 4, c0-10*11/12*-13*c10
+.data 19, 9+(1)*c0
+.define c13 = 8
+.define c15 = -2*c7*c2*c8*-c13
+.fill 4, 0+c13*8+c13
+L21: .data c6-18/c0-7-(6)
+.fill 2, -(10+13)
+mov #--c1/c13, r0
+mov #c13-3*c0, r3
+.fill 3, 18+c10-8+c12
+hlt
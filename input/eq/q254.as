@@ -0,0 +1,68 @@
+mov #-10, r7
+mov #(-8-nope*16), r6
+.data 20, 19, -5+17/5/17/0, 18*3+18-11
+.define c10 = 8
+.data 2, 5, 15*c10*(c10)/4
+.fill 1, 15-6*-8
+.define c4 = -8*c10 + 13
+L0: prn #19/c10/c10+c4*c10
+mov #-c4, r5
+L1: prn #-c4+c4/c10+c4
+mov #7, r6
+.data 13*12-4*c10/c4, -c10-0*-15, 8, c4--12+(c4/4)
+L2: mov #9+13+c4, r7
+.define c1 = 13
+L3: .data -c1*c10-c10
+.entry c4
+.define c0 = 11-4/c10+20
+.data c4*c4*5/-4*c1, --17*c0
+mov #15-4-7-3--11, r4
+mov L0[c0+-c0/9/10/(c4)], r2
+mov #(nope-c10)+(c0/c4), r5
+.entry c4
+L4: .data 8
+L5: mov L5[-c0+c1*c4], r2
+.define c3 = 19
+.define c3 = 12 + c1*c1*(6)-c10 + 7
+L6: mov #-(c0)*c0+8*18, r3
+mov #c3, r3
+mov #c1-7-c1-0*c3-c0+1, r0
+.fill 4, c1
+.fill 3, c3
+.define c13 = 1
+L7: mov L1[(20+15/(c3))], r2
+mov L0[10/c10-5-c3/9], r2
+mov L6[c0-0], r2
+.define c5 = -15-c3+c4*c3
+L8: mov L5[-c10/c3+c4], r2
+L9: mov #(c0/c3), r6
+.define c6 = (5)*c13-19/-4
+L10: mov #3, r2
+mov #c4, r1
+L11: prn #--c3
+mov #-c5-(0)-c4, r7
+.define c3 = -c3/-10*c4
+.define c7 = 18+16-c3--c3
+L12: .data c1-c3/16*c10*10, -11, c5
+L13: mov #8/((18)), r4
+prn #c10
+.data (c3+-9), 15
+.define c9 = c5
+.define c13 = ((c3))
+cmp #c7, L1[-c1/c3]
+.data (15)*9-c0*-c0*1
+prn #19/-c3
+.data c4*c3-c3-c6, 3-15
+mov #(c0/L0/c10), r6
+.fill 2, 4
+mov #(c3*18+c13), r5
+mov L5[-c1], r2
+cmp #6, L6[(c10)]
+mov #3/c13*11/c6/c10+c5, r4
+mov #9/6-19-c3/(17), r6
+.fill 2, c6
+.define c0 = 5/c3
+.data 3, 15-16/-2*c3/c7
+.entry c0
+L14: prn #-c13
+hlt
@@ -0,0 +1,28 @@
+.data 17*6-14*-11-14*14
+.data (17/17+15), 8, (8/12)/20*1/-19, -X9+13/(-9)
+mov #(17)--13/16/4, r1
+.data 17, 4, -7*17/13, 8
+prn #0
+mov #-7*16-4-14, r3
+mov #(19), r4
+mov #1/20, r3
+.define c6 = 10 + 2*14/11 + 17
+mov #c6, r4
+.define c12 = 15
+mov #--c6, r4
+L0: mov #19-c6, r1
+L1: mov #11, r0
+cmp #c6, L0[9]
+L2: .data 3, 1, c12
+.define c4 = (11)*12*(c6)+c6
+.entry c6
+mov #11, r4
+.data 3-c4*c4*20/c4, (1-11-c12/c4), c6*c4*c6+(c12), 8
+mov #0-c12+12*c4, r4
+L3: .data c4, 17+6+5/c6*16, --15*c4-3*c12
+L4: mov L1[5], r2
+mov #12, r4
+.define c2 = (c6+6-c6/0)
+.define c8 = (c6*c4)+c6
+.define c7 = -nope/7+9
+hlt
@@ -0,0 +1,83 @@
+.data ((17-10))
+L0: .data 1, 2-18+12/-15-13-20, -10-14-6
+.fill 3, -(0/X9)
+mov L0[7], r2
+.define c0 = (14) + 7 + 17
+.data --(17), (c0)
+cmp #5*c0/6, L0[6+c0+4/15]
+mov #(c0-c0/c0), r7
+L1: mov L1[19], r2
+.data 20, c0/c0-0+c0-c0
+mov #-15/c0-18*-4/c0, r7
+mov #1, r1
+L2: prn #-(17)*c0
+.data c0+(c0), c0
+.data c0
+L3: .data 15, -16*(13), 13, 1*(c0-1)
+mov #7-c0+c0/c0, r6
+.define c7 = (4+19)+c0
+mov #c7+17, r1
+mov #--19*c7, r3
+mov L1[5/-7+5], r2
+.entry c0
+.define c2 = 17*c0*c0-19/c0*-19
+.define c7 = -5/c7/-c7
+L4: .data c2
+L5: .data c7/c0
+mov L1[(-c7)*c7], r2
+.data 14, 2, 16
+.data c7, c0
+.define c11 = nope
+.define c8 = 17/4*-13--c11*(X9)
+.define c12 = ((c8)-c2-c8)
+mov L0[(8)], r2
+L6: mov #c7-(11+c7), r3
+mov #6, r4
+L7: mov L1[c12*(c7)/-8+-c12], r2
+L8: mov #c2, r5
+.entry c12
+.data -c11+14-(-c12)
+.define c11 = 17*17/c2-0*c7-c7
+mov L7[c7+(11)*20*8], r2
+mov L3[15+8+c2*c11], r2
+.define c6 = -c0/c11-8-c2/c7/c0
+.define c2 = c11
+.define c12 = c11*X9-1+c7/11
+.data -5-3, c11/5+15/c2, c7*11-9+c11+c2
+L9: mov L0[(9*c11-2/3)], r2
+mov #6, r4
+mov #c11, r4
+mov #c11, r6
+prn #(c0-4)
+mov L3[18], r2
+cmp #-15-7+4/-c0+11, L7[c12+4*-17*3]
+.entry c11
+.entry c2
+.define c13 = --4/5
+L10: mov #19, r4
+L11: mov L9[1/4-(10/9)], r2
+mov L1[c0+nope], r2
+L12: .fill 1, c11-c7/-6
+L13: mov #-8*c12-c7/-9*16, r0
+mov L0[c11], r2
+L14: .data c7-15, 17+15, 16/7+c6*6*c13/6, (c11/c13)/(c11)
+.data -c13/1/c6-19/14, c13+13/c2+(c2), c11
+mov L2[c7], r2
+.define c7 = c8*c6/0/9
+L15: mov #8/-c2/-c12, r5
+.data -c6*19, 14+c7+(c12)-c13*c0, (15)*1+c6/c12+c12/0, 9
+.define c2 = (14)/c11/5*X9 + 2
+L16: mov #c7+6, r7
+mov L13[c13/13], r2
+L17: .data c7*(4)
+prn #(4+c12)+c8
+mov #c2, r0
+L18: mov #5/((c2)), r2
+mov #c6, r0
+mov #16-c13*10-c7, r1
+.data c11, (16-c11/c7+c7), 7+10*(c7)+c0*3+X9
+.define c9 = 9
+L19: .data -5+c7, 9/11-c12*(-1), (11)
+mov #5, r4
+.data (c13+c11)-c7+5
+hlt
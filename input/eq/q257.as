@@ -0,0 +1,61 @@
+L0: .fill 2, 14
+L1: mov L0[-12-3+1], r2
+prn #-9+5-12-16
+mov #7, r3
+.define c9 = 16+-15+19*16-11
+.define c7 = 13+5/c9+c9+-13+c9
+mov L0[c7/17+c7/7], r2
+mov L1[3], r2
+.define c2 = c9 + 3
+.data c7, (-16)*(17/c2)
+prn #c2-c7/19*14+c2
+.define c8 = c7-6
+mov L0[c8-6+c7/(15)-(c2)], r2
+mov L0[6], r2
+.define c7 = c2
+L2: mov #5-c2, r7
+mov #0, r7
+mov #(c7*nope*c9), r7
+L3: prn #c8
+.data (c8-9)*1/c8, c2-(5), 2
+.data 18+5*c9/c8+5/18, c7+(12-18), 9, 1
+.data c9, (2), 18*6*-c8--c2+-3, 15/c9
+mov #7, r7
+.define c15 = 3 + 0--c9/-2
+L4: .data c15/(18)*c8/c2, 12, c8
+prn #8
+.data 19*16+8, c15
+L5: mov L5[5], r2
+.define c8 = c2
+.fill 3, -2+19-c9/c7/c8
+mov L4[-2-c2-1-c15], r2
+mov L1[c7], r2
+mov #-c7-c7+c2/(13)+(c7), r3
+.define c9 = 14+c9-8-c2
+.data -c9+(c8)*c2-11+8/19, c8
+mov #14, r1
+cmp #18, L5[c7/c2/c9-15]
+L6: .data (c8+c8)-c9*3*-c7, 7-2/c2*3, -c15+c9+17*(c2), 2
+mov L4[(19)--c9+(c7)/14*16], r2
+.data c9/20*c2*11+c7, 3, c15
+L7: mov #(-c9)/c15+19+-c8, r3
+mov L1[c9--c8*12*L0], r2
+L8: mov #14+c8+c2-8, r6
+L9: mov L0[20+c7+10-c7/1], r2
+L10: mov #(9-c15+c15), r2
+.data (4), --19*c8*(c9), 20*1+17/c9-c9
+.fill 4, 16
+L11: mov #c9, r2
+.define c10 = (16*15 + c7 + c8)
+cmp #4, L1[c7+11+L0-8]
+.define c3 = 11+15+(1)--c10-11+3
+mov #(11/c2+c7), r0
+mov #7/-20, r1
+.entry c10
+L12: .data 20, 17
+mov #(12/2+-15), r7
+mov L3[9], r2
+.define c15 = 5-8*-X9-c7 + 18/(6)
+L13: .data ((16)-c15-5), c8/15
+mov #c9, r2
+hlt
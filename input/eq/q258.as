@@ -0,0 +1,104 @@
+L0: cmp #18-18, L0[10*9-3-17+18]
+L1: .fill 4, 10
+mov L0[4+11*-2*-(4)], r2
+.define c6 = 3*15*20*0*nope
+L2: prn #c6
+L3: cmp #-c6*c6, L0[-c6-11-c6+c6]
+cmp #3, L3[11+11--14/c6/10]
+L4: .data c6, 8*c6+-0, (c6*15+c6)
+L5: mov #5*(5)/c6, r5
+.data c6*12-(16)-c6-12, (8-4)-(c6)*-c6, c6*8/2*c6/c6, ((c6)-20)
+.define c5 = c6 + c6
+.data 1+c5-c5/11
+L6: .fill 4, 17
+.entry c6
+.data nope+c6, -20
+L7: .data c6, (-17), -c6, -c5
+mov #c6, r4
+L8: .fill 3, c5+c6
+L9: cmp #-20-c5-((9)), L3[(20)-0-5/2-15]
+.define c8 = c6/7-c5/c5/c6*3*4
+mov #c5*9/16, r6
+.data 12, 15+9+c5/c6*c8-L0
+.define c13 = -16+2+-10
+mov #c13, r5
+mov #1+(-10), r0
+.define c8 = c8
+L10: mov #4*c8-c5--c6-nope, r4
+.entry c8
+mov #(15/-c6), r3
+mov #12, r4
+.data -17-4--16, 8, -c5-1/9/c8
+mov #12, r1
+mov #18, r7
+mov L4[(16-c5)*c8], r2
+mov #-18/(19), r3
+L11: .data c5-c6/c8*8, c13, 9
+L12: .data c8
+.define c13 = -c8
+mov #c5, r7
+L13: mov L10[7], r2
+.entry c5
+L14: .data 8, --c8-c13, 15+4/c8/6*c8
+mov L4[-c8], r2
+.define c12 = -(10-c13)
+.fill 3, -8+c13*c8
+.data 15+8+6/c6, c12/6*0/c8+c12/19, -(c8-16)
+mov L7[c8], r2
+.data (12)/13-13-8, (c12+9+c13)
+L15: mov L14[-(9)+c6*c13], r2
+L16: mov #8, r6
+.define c9 = 15+c6/3+3/7-12/16
+.data c8, c5/10-10
+.define c14 = c8
+L17: prn #(-16)/0
+L18: prn #((c12))+17
+.data 12/5/c13-8+8-c5, c6, c12
+L19: mov L14[c13], r2
+prn #c8
+mov #7/5, r0
+.define c12 = c6
+L20: .data (c13)+12, (6), 11, c9
+L21: cmp #c14+c8-c6-c12+L0, L8[c13-0+15/4]
+L22: prn #-2*20
+mov #20, r0
+.fill 3, 8
+.data -20/6+c13, (13)/16-8+c13+c13, (c13+c8)-c8, 9-c6/c6*0*c5
+mov #c12, r4
+.define c5 = c12-c14/c13*7+12+5
+L23: mov #-c12/nope-((c6)), r5
+mov #12*c12*11+c5, r4
+L24: mov L17[11], r2
+L25: mov L12[14-17+8+nope], r2
+L26: mov #-19+15-8+10, r4
+cmp #-c12+(0)+9+c8/c12, L14[3-c13-8/9*-15+-8]
+.define c4 = c9
+mov #(0), r6
+.data c9, c5
+mov L22[c14], r2
+mov L0[c8+c4/-7], r2
+.fill 4, 4
+.define c2 = -c8*16*c5
+mov #11-c5+-2, r3
+mov #(19*-c12), r7
+.define c4 = c6-3
+.define c2 = c5-c6*12/13
+mov #1, r5
+mov #--c2*c14, r6
+L27: mov L0[-c2+14*15], r2
+mov #-c6, r3
+L28: mov #0, r0
+L29: .data (20)*-19
+mov L2[4], r2
+mov L9[c4--c6-8], r2
+mov #(-c4-8), r6
+.fill 4, 1*10*1+-1
+mov #(c9)-0+c4, r2
+L30: mov L7[12-(c5)+c8/17], r2
+L31: mov #c13, r4
+mov L29[(3-c2)-c13*18], r2
+L32: prn #11
+.entry c14
+mov L31[c13/c13+15/1/c8], r2
+cmp #c8--c14, L25[0]
+hlt
@@ -0,0 +1,26 @@
+L0: mov L0[-19+5-7/15+18+4], r2
+mov #9, r3
+mov L0[-19/14-0+3], r2
+.define c13 = --12-9
+.data (17-c13/13), c13-6--2, 20, -20-8/c13*(c13)
+mov L0[c13/c13/8*c13], r2
+L1: mov #c13, r6
+mov #5, r5
+L2: mov #-X9, r3
+L3: .fill 3, 16
+.define c3 = c13*5-c13/(c13)
+.entry c13
+prn #c13+-c3*c13
+mov #c13*9+c13+((c3)), r2
+L4: prn #1
+mov #15, r0
+mov L4[14], r2
+mov L1[c13], r2
+.data 6, 4+15*(c3)+16, 7
+prn #-20/12/c13*18
+prn #c3
+.define c3 = c3 + 15 + -5*c13
+mov L4[-8+c13], r2
+mov #(13-c13)*-c13-19*14, r2
+.define c5 = c3
+hlt
@@ -0,0 +1,116 @@
+prn #((13)-20/19)
+L0: mov L0[1*17/1-6], r2
+mov #-(1)*19/3, r1
+.define c0 = -1+10+6
+mov L0[--c0+13*19], r2
+L1: prn #c0
+.define c1 = c0/4 + 20/8 + 2 + c0
+mov L0[c1+c1], r2
+mov #3, r1
+.define c2 = 4
+mov #c1-(c0)+c0, r6
+.define c3 = 18/5/3
+mov L0[c2*c1+2*c0/16], r2
+mov L1[6/5/4*1-11-9], r2
+L2: mov L2[20/3], r2
+.data -18-c3+16/5, c0-c1/4, -18*c3/3
+.define c4 = -10 + 17*16-15-4-c1
+.data 18/4+9/3*c2+c0
+.fill 2, c1-c2+c2-((c4))
+prn #(c3)/1
+L3: .data 12, ((20))-(-c2), -(c4)/1
+.define c5 = 19
+mov #-c0+c4/5, r6
+.data -c2+c4+c5*c0+(c0), ((c0)+20+4)
+.data c0
+.data (c1-c1/4)
+cmp #(-11/17), L0[1]
+mov #16/4-c5/3, r4
+.define c6 = c3
+.fill 1, c4
+.define c7 = (12-c2)
+L4: .data (--c6), c1*13*c7, (12-20/4)
+cmp #(10)-14, L0[20*c4-(c6)/4]
+.data c0+c3+17-1*c5, 15-0-c4+12
+.define c8 = -(c6)*c6*c0
+mov #18-c8-c5--(c0), r0
+mov L2[c1*c4+c7+c7], r2
+.define c9 = (18-20/4)
+mov L4[-c7/4*7], r2
+mov L1[c6], r2
+L5: mov #-13*-19, r2
+.define c10 = c0/2
+.define c11 = (c4)-20-18 + 14*8 + -11
+L6: .fill 2, 0
+L7: mov L2[c7+c8-18+4+(c5*13)], r2
+.data (-c0)+3, c0*(9/5), 8-c10*c0*c9, 4/3
+.define c12 = 19 + c5/2/4
+mov L0[c4], r2
+L8: .data c2-(7)/2, 0-3-19+c7, 12, c1*(-c3)
+L9: mov #c1, r6
+L10: mov #(20)+15+c4-8+c12, r6
+L11: .data 9/3-8*15/8
+.data -7-c11*c7-(c8)/6, -c12*(17), c10
+.define c13 = c5/3+0/3-16*c5
+L12: .data -(5)-2*c12-c3, 7, 8, --c11/5
+cmp #13, L2[c11/2]
+mov #7, r4
+mov #c5*-8+12, r3
+prn #-c2-c10+c6
+.define c14 = 18 + c10
+prn #1/15
+L13: .fill 3, 16/5-0*10-c5-1
+.define c15 = (15-c10)
+.define c16 = c15/1*-1*c13-c2
+L14: mov L4[8], r2
+L15: mov L15[c3], r2
+.define c17 = 10/3
+.define c18 = ((c7)*9)
+mov #12, r7
+mov L1[c10--c11/5], r2
+.define c19 = -0-16 + c12--19*20
+.data c16, c2, c15, 3
+mov #c7-c16+c5+3/5, r6
+.define c20 = -7 + 0 + 16
+.data c20-9+c2*19+10+c4+2, 4
+mov #(-c14), r7
+mov L6[(c3/4)-(16*1)], r2
+L16: .fill 1, 5
+.define c21 = 3
+prn #12
+.data 4/5, (-8)+-c11/3, 12*-c14+-c3/1, c8*c21*c11-19-c6
+L17: mov L12[c12], r2
+mov #c0-c4, r3
+L18: .data (14), c19/3
+prn #c7-c2+9/5
+.fill 1, 16+8/16/3
+.define c22 = c21*c14+1-(16)
+.data c9*c2+c6+c13, c5, -c9/3-2-c3, -c4/2
+L19: .data 11
+prn #c21
+mov L6[(4)], r2
+.define c23 = 17-4
+.data -12*c9*11*17*c14, (16), 8-(c21)+(17), c0-c13+c9-(12+19)
+mov L19[4+c17-c0*6], r2
+.define c24 = -4
+.define c25 = 0
+L20: mov L12[-4-c6*6*(c5)], r2
+mov #16, r1
+cmp #c25+c14, L4[-(c8)/5]
+mov #6, r5
+.data 19, -4/4-(c22)
+mov #(-c9/3), r2
+cmp #13, L2[c16+(8)*19/3+-c17]
+L21: mov #-c20, r3
+cmp #19, L3[(c17)+c4]
+cmp #15/3, L15[11]
+prn #19
+prn #c21*c18
+cmp #5, L9[c5*-18*14]
+.fill 3, c10
+cmp #-15+c1*0*c20*7/2, L6[1]
+mov L5[(6-12)+10*c23], r2
+prn #18+c11
+.data 1
+prn #c20--1
+hlt
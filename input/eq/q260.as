@@ -0,0 +1,47 @@
+.define c15 = 8
+.define c2 = 1*1/11-c15
+mov #c2, r1
+prn #c2/c15-8-c2/c15*c15
+L0: prn #c2*15/c2-5-11
+.data (c15)-7, 7, -3+-17/4-c2-8/c15
+L1: mov #(4)+c2-(12*c15), r4
+mov #19, r4
+prn #-c2/5
+mov #(14), r2
+mov L0[c2+9+1+c15+c15], r2
+mov #19+12-17/13*(2), r7
+L2: .data (c15), 8, -10-20*c2*(-8)
+mov #17, r3
+mov #c2+c15-4, r7
+L3: .data 1/(c2+nope), 11*15/c15-nope
+.define c9 = c2/10/18*c15*c15
+.fill 3, -15
+mov #-c15, r4
+.data c2*c15, -15*1+c15/-c2*19
+mov #c9-(5)/-c9*(c2), r3
+mov #(c15+2/c15), r1
+mov #20+(c9*c2), r5
+.entry c9
+.data L0-13-c15-7/(c2/6), ((c9/c9)), (c9), 9
+.data (c15-c15+2+c2), (c15)/-(16)
+.data 5/c15, 6
+.fill 4, 1
+L4: .data -c2, 20, c2-18-13
+.define c13 = 8
+prn #-15
+mov L2[9+--c13], r2
+.data -19+19+(2), --c13/c9
+L5: mov #-c15, r0
+mov #11, r3
+.define c8 = c13/15+(c2)
+.define c5 = c13
+L6: .fill 3, -6+13/10/8
+L7: prn #2
+mov #4, r4
+L8: .data c13, --c9-c5, 10-3/c2/c5+c5, ((c13))/(c2*c9)
+L9: .fill 1, c8-12/9*1+9
+.entry c9
+mov L5[16], r2
+L10: mov #13, r2
+.define c12 = (c5/c8-3)
+hlt
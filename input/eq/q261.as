@@ -0,0 +1,76 @@
+L0: prn #0*2*-20
+.fill 4, ((11))/9
+.define c10 = 4/18-7--7/5
+mov L0[3-0], r2
+mov #-7-(5)/--c10, r4
+mov #11/-c10*(10)-c10-14, r3
+.entry c10
+.define c10 = c10
+.data c10, -9+c10*(c10)
+.define c5 = -5
+mov L0[(12)], r2
+L1: mov L0[6], r2
+L2: mov L2[-2*12/c10], r2
+.define c2 = (c5 + c5)*-c10 + c5
+mov #c2/-10*-c10*c2, r1
+prn #(-c10)*10/1/c2/c2
+prn #15
+L3: prn #c5+8+c10-nope/c10
+mov #6/-15-14+c5, r7
+L4: mov L4[2+4-5/20], r2
+mov L1[c10*15*c10/c10/14], r2
+.define c3 = (2)
+L5: cmp #c3, L0[-c10]
+prn #c5-c10/c10-(1)
+.define c9 = (c2)
+.define c11 = 19
+L6: mov #-19+9, r2
+mov #3--12+11, r1
+cmp #c9+0*8*c5, L0[-19+c3]
+L7: mov L3[3+(c11)-c11-1], r2
+.define c8 = 6
+L8: .fill 3, c10/-13/c2
+.data 4, c2, 15
+mov L4[-c10], r2
+.fill 1, 8/2+-c9/c3+7
+.fill 2, (2)
+mov L5[-c2/15-c3], r2
+L9: mov L2[5], r2
+prn #c8
+mov #(c9*c3*13*c2), r6
+prn #-c11
+mov #((19))/-19/c5+19, r3
+L10: .fill 2, 17
+.data 11, 3+12/5+7*c3, c10/c10/10/c10+-0
+.entry c10
+mov L5[-1/11+c5/c5], r2
+cmp #10+-c5*-c10, L0[8]
+mov #c3*c5/19*19*5--c2, r3
+prn #(c5)/c3+13*-L0/c10
+prn #-c8-c11-c5
+L11: mov #L0, r4
+mov #-c10/18*8*-0, r2
+mov L9[-(c8)/2], r2
+.define c15 = (((c5)))
+L12: mov L4[-c9+c10+0--c2], r2
+L13: mov L10[(c10)], r2
+mov #(c11*13/8), r5
+L14: mov L6[(8)+c11/20+c3], r2
+.define c12 = -11-13/2
+.fill 3, 8
+L15: prn #12+2+2-c10*16
+.data 19, c12-4+(12)*-(c5)
+L16: mov L15[4], r2
+mov L7[c8*c10*c11+16+c10], r2
+mov #5/12/c3*10*-4+-c12, r5
+.define c8 = (c2)
+L17: .data (-c3/8), 3, c3+-c8*c12-c5+c15, c11*c8
+.fill 1, --9*c3/0-c15
+mov L16[c10*13], r2
+.define c3 = c9
+L18: prn #-5
+mov #c3, r0
+L19: .fill 4, (c12)/(9/c10)
+mov #c11, r5
+mov L2[2], r2
+hlt
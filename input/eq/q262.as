@@ -0,0 +1,61 @@
+prn #-9*16-18-10
+prn #(-15*19-9)
+.data 0, 15+6, 7*0-(19)/9
+.data -3-0-7+8, --20*L0, 3, 16+12*L0+19
+.define c0 = 11
+.entry c0
+.define c13 = c0 + 9
+.fill 2, (9)
+.entry c13
+.entry c0
+mov #(5)*c0-c13+(0)*16, r3
+.entry c13
+L0: .data -2+15+11, -(13)+c13-c0+c0, c0*8+c0-2, -2/c13*c13
+.data 11, c13, (c13)
+prn #nope
+L1: prn #--c13/(11+c0)
+.define c5 = 16*c0
+mov #-(9)/(-c13), r2
+mov #1+(16)/(c13), r7
+.data 7
+mov #(c13), r2
+L2: prn #((9))
+.entry c5
+L3: .data (c0), 8
+.fill 3, c5
+mov L0[0], r2
+mov #c0-c5, r6
+.fill 2, -(c0)
+.data 11
+L4: .data -c0*20+c13, 19*c0/c5/14, (-19)*c5+c13+c0
+.entry c0
+.define c9 = c13
+mov #-20, r3
+cmp #(14-2)*10, L1[(c0)-c13-9*-c9]
+L5: mov #5, r5
+L6: mov #7, r0
+.define c0 = 14--17*c5
+.define c14 = c5*c0
+mov L3[14], r2
+.entry c14
+mov #12, r6
+mov #16/c9-11/(14-c9), r4
+prn #c9
+.define c0 = 3
+.entry c5
+.define c4 = (3)
+.define c14 = (c5)*6*18
+.data (L0)*(c13)*10-c0, (3*15-c14), 16, (c14)-c4
+.define c9 = c0+(c0/c13)
+L7: .data (c4/c14*8), -18+12
+mov #c0*17, r3
+.data 7+(13)+-(9), (c14)-c9*20*3*-c0, -c0/c0-c5
+mov #c0/12, r2
+mov #c5, r2
+.define c11 = c14
+.data c13+5+9+3-20+6, (6)
+L8: mov #-2, r5
+.define c9 = 0*c0/-20*(c0)*c0/c5
+.define c12 = 16
+.data -(X9)*c14*c0, 14+c12*2/12-c12, 1*6-14-((c9)), c12
+hlt
@@ -0,0 +1,115 @@
+prn #7*4*20/-0/14
+.define c5 = 6-8-1/20-6+1+(12)
+L0: .data 5/20*c5+4-c5, -c5*c5-c5*c5
+.define c13 = (c5-1+6*3)
+mov #4-2*2-c13-6+c13*4+3, r6
+mov L0[(c5)], r2
+mov L0[c13+12*c5], r2
+L1: prn #13
+L2: .data -11/-2-c5, (c5+12--c13), -c13/c5*-18
+mov L0[c5*19/c13*9*c13], r2
+L3: mov L3[-(c5/13)], r2
+mov L2[16+(-c13)], r2
+mov #11, r7
+mov #-c13-1+4*14+2-c5, r4
+.define c3 = (X9*c5-c13)
+mov L2[0/c3], r2
+.data -c5*7+1*c13, c13*17*c3+c13
+.define c11 = c13
+L4: .data -18/10/0/c13, c5
+.data 18, 9
+.define c14 = -(c11-19)
+.define c14 = c13-c14
+.define c11 = 2/(c13)*-19
+mov #1, r4
+prn #--10-c5
+.data L0, 2
+L5: mov #(c5+(c11)), r3
+.data 2, -c13, 6
+mov #c11-0+6/19-c11, r3
+cmp #10, L1[(6)]
+.data (c14)
+L6: cmp #-(7)-9, L1[20+6/7-(8)]
+.define c4 = (16)
+.entry c11
+L7: mov #(c11/12)+-1/11+c3, r6
+L8: .data -c11*16-10, c5-9
+.define c10 = c11*-18-c11
+cmp #(c14), L5[17]
+.fill 3, c11
+.define c7 = c13 + c10 + 10-c3 + c14
+.define c10 = 8
+.fill 1, c5
+L9: mov L9[c14], r2
+.define c10 = (c11)
+prn #c10
+mov #c10, r4
+L10: prn #6-2*c5-(-17)
+cmp #-1, L0[c14]
+cmp #c5-16+c5+c10, L10[c13/c5]
+mov #(4), r6
+.define c8 = c13/16+6/c3*6-4
+.define c3 = c11
+mov L6[c10-c3], r2
+.data 3*0, 9
+.data c3+c5-c10+7, c11
+mov L4[c14], r2
+.define c5 = 1
+mov #c13+c14, r7
+.data c3/c11*12+c5-4, (12+c3)+c11+c8/(c3), c13
+mov L2[c8+5/14*17*-c4], r2
+L11: .data -(c10)-(1), c13*20/c14/8/3/-16, 3/12+(0)/8-c10-12
+.define c12 = (c4)-1--c10-8
+L12: mov L10[c5], r2
+L13: .fill 2, 20-c13
+.fill 4, -c5
+mov #c10, r6
+prn #8
+L14: mov #2/c10*(c5)-5, r2
+L15: prn #-c7-2*(c14/5)
+.define c11 = 5
+mov L6[6], r2
+mov L4[-20], r2
+mov #c7+(1)/c14, r4
+mov L14[5], r2
+mov #c12, r6
+mov #c5/c14-8-5, r7
+.define c3 = 17/c11
+L16: mov #-3*5-c14, r5
+mov #-(c13), r3
+.define c10 = -c5
+.entry c13
+.entry c12
+mov #c11, r0
+.data 4, 13, c10
+.entry c3
+mov #c10-3/15*11/(c3), r7
+mov #-(-15), r5
+.fill 2, c10*c10+c10-c3
+.define c10 = ((c13-c10))
+mov #-4+c10*c3--(c3), r4
+.data (6)*6-c10+13, -c10, c8
+mov #((6)), r5
+.data c3
+.data -c8, 11, c3*c5, --c3-12-c3
+L17: .data c10*c14*c3--1
+L18: .data c8, 17+c3+(c10)
+mov #0, r1
+L19: mov #c12, r2
+L20: mov L4[-10*-c5+0*5], r2
+.define c0 = -(c13)
+.define c4 = c14
+mov #c10/6-9+3, r2
+mov #10, r7
+mov L1[c10], r2
+mov #c10+c5*-c10+17, r1
+prn #(c11)
+.entry c14
+.fill 1, (10)
+mov L8[c13], r2
+mov #--c5, r4
+mov #0, r7
+.data -((3)), -15-2*15-9, -c0*c5*c3, 5
+L21: .data 1, ((19-c5))
+.define c8 = (12)-c4/c10 + 13 + -10
+hlt
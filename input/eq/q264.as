@@ -0,0 +1,100 @@
+L0: mov L0[-L0*20+14*0], r2
+.define c8 = 16
+.fill 2, -1
+L1: mov #-0+c8-c8+7-c8, r0
+mov L0[(c8)/c8*X9*c8], r2
+mov #c8, r6
+.data 18, (c8), -c8/c8*c8*11-10
+cmp #1*12*c8-c8-c8+3/0, L1[19]
+.fill 4, (19)
+.entry c8
+.define c4 = (17*2-3)
+L2: mov #c8-c4/-c8--c4/c4, r2
+.entry c8
+.define c7 = (10-18*(5))
+mov #3+c4+--14, r5
+mov #-c8/c7-10, r3
+cmp #-c7, L1[c4]
+.data -c7+2/c7
+cmp #7*7/(1), L0[12/c7*20+c7-c8]
+.data c4, c4, c7, c7+(8)-c8/13-c8
+L3: mov L1[1], r2
+mov L0[13], r2
+L4: mov L0[c7], r2
+L5: .data c7*c4*-15/9-c4, ((c8)), -c4+c8*19, c7
+mov #1+-10, r1
+L6: prn #c7
+L7: mov #6, r6
+mov #-c8/-c7, r2
+cmp #c7, L6[c4/c4-c4+c4*10]
+L8: .data 17*c7/c4+19-8, c7, c7
+mov L5[6+c7+c7], r2
+.define c14 = (c7)+-c4+(c7)
+.define c5 = c4
+L9: mov #-c4+16+15-8, r2
+prn #c8*12
+.data c5-5/c14-5*c8+c14
+cmp #19*3, L7[18]
+.define c15 = c14
+mov #9, r1
+mov #c4, r5
+mov L0[1+(9)/c5/c5], r2
+L10: mov #7, r5
+mov #-(c4/2), r3
+mov #1, r7
+.data 20+2/2*c4+L0, c5*17+c14-c8
+mov #-20+c4/0+-17, r6
+.data c7-c8+-c7*c7/c7*-c7, --0*c5, 12+7+1+11+c8, -c4-1+c15*5+11
+cmp #20, L8[c14]
+.define c13 = 14
+.data 13-9
+mov #---2, r7
+.define c4 = c5
+mov L9[c4], r2
+mov #16, r3
+L11: mov #-c13+10-c7-11+c4+c4, r5
+mov #8-c4/c5, r1
+cmp #8, L11[17]
+.fill 2, 10
+mov #8, r6
+.define c5 = c4
+mov #c5/c7, r7
+prn #-c4/c8/c15
+mov #c4*c5*17/(4)*(c8), r7
+L12: .data c8, c14+c7-6*8/(12)-5*9, -18, (c5/c5-c4/c7)
+.data 11
+L13: mov #c7*15+c5-c13--L0, r3
+prn #c8
+.define c7 = c14*c8*6+4+14/c5*17
+mov L12[-c14-9-17], r2
+.define c9 = c5-20-19-X9/(c8)-c5/19
+L14: .fill 1, c14
+.define c4 = (15) + (4)-(9)-(c7)
+L15: mov #15, r1
+cmp #c4, L11[c7]
+cmp #-c5*8+10, L10[c8]
+L16: prn #--c15*c5
+.data (c4)/c4
+L17: .data -17/c4/c4+c7, 20*(c9)-13
+mov #7, r4
+.define c2 = 13-c4-c7/c4 + 20
+.data (-c4)-0-c5, c9
+.define c4 = (c2)-(c8)+17-6/c13
+mov #c4+c4+c5/3+nope, r3
+mov #4, r5
+.define c6 = (c4)
+.define c10 = -9
+mov #(-8/4/19), r4
+prn #((16-5))
+cmp #c6, L10[c14]
+.define c13 = 11-(-c4)
+mov #17, r5
+L18: mov #-c7-16+(11), r2
+mov #c9, r0
+mov L14[-2-6+c10+3/c7], r2
+.data c13/19, (18)+c6/c4+c2-c13, -4
+L19: prn #-4
+.data 0-5*c9/3/c9, c7, c5+4*c2-19
+.define c12 = 6+4*11/1+c13/4-5/c15
+L20: mov #c10/c6, r4
+hlt
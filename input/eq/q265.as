@@ -0,0 +1,71 @@
+mov #17*6, r0
+L0: .data 16, 6+10-18, 10, 16-15*(0)/16
+mov #5, r5
+.define c1 = 1
+mov #c1, r3
+L1: .data -c1, c1
+.define c3 = -c1 + c1*11
+.define c10 = 11*-c1/17
+prn #c1
+prn #(18)-9/c3+c3+(c10)
+.data 10*c1, -12-5*c1
+.define c15 = 14
+.define c1 = -20/20-6
+mov #X9, r7
+L2: mov #c1+8, r4
+L3: prn #c3+c1-12-19/c10
+L4: prn #c3
+.data -c10*c3-19*18, 20+-c1-18*c3, 10, c1-5+c1+c1/17
+cmp #c1/c3+c1+c10-c1, L1[-8-18*-11+16]
+.data 3, -0/(c1), 11
+.data 4, -4*2*c3-4, c1, --7
+.fill 4, c1
+prn #c15*2/19*6*1
+.data 4, 5/17+6/c1+c15, c3-17-c3/1+-8+19
+L5: mov #c10/10+c3, r4
+mov L5[c15+c1-(c10+c10)], r2
+mov L3[5*-18+-4], r2
+mov L3[-6*6-5*c1/0/19/c1], r2
+.define c3 = c3
+mov #20, r0
+mov #-c3-c3*c10, r6
+.fill 2, --c10
+mov L0[c1], r2
+L6: mov #c1, r5
+mov #7+c1, r5
+.entry c1
+mov #8*(c3/12), r1
+.define c12 = c10+c3+c10+c1
+.data c15, c3, c1-c10*1+c15-12
+mov #c3, r5
+.fill 4, c15
+.fill 3, 4
+L7: .data 4+12*c3, -c10+c1, c10
+mov #17-c1-c1/13, r5
+mov #(17), r4
+L8: .data (3)
+mov #c15+3/c3*19*(c3), r2
+.define c7 = -c15*c3+c12/11/-c1
+.define c3 = c15
+mov #-c10, r2
+.data (c3+20/13), 1*c3/c15*20*19, c10
+mov #(c10), r3
+mov #c7-c12*c15+c3/13, r3
+mov L4[12/-c3/c15], r2
+mov #c3, r2
+.define c10 = (c12*1)*15+10-nope-16
+.data 17
+.data -19, (c10), -17+c15-c12+4/-15, c15*10-3-c1/9
+.fill 3, c3-3-c3/c10*1-11-L0
+mov #c12+--c10, r3
+mov #5, r7
+mov #-1/c3+2, r1
+L9: .data c3+-17, c7-c3-12+c3+3, 6-16/17/11/c1
+mov #c3, r0
+cmp #0, L1[8-17/X9+(c1)*c15/c3]
+prn #19
+.data -c1, -5
+L10: cmp #c10+15/15*18, L8[c3]
+mov L7[11*c3*c1/c10*17], r2
+.define c8 = (c12/c12)-c1
+hlt
@@ -0,0 +1,29 @@
+mov #(18), r0
+L0: prn #0
+cmp #20-20, L0[9]
+.data 2+5-14/(15), 0, 6*14, 13
+mov #(7--15), r1
+L1: .data (0)+(4)*14
+mov #(9), r6
+.define c4 = -12 + 5 + 13 + 20
+L2: mov #-c4, r1
+mov L1[-19+15/9/nope+3], r2
+.data 7-5+nope*14, 5, 5+3*c4*c4/(2/c4), 2+20/c4-9-5
+mov #-c4+(c4)/3, r5
+L3: .fill 2, 20*c4/8*c4
+.data 3/0-8-c4/c4/-7, -c4-c4, 11, -(c4)-c4
+mov L3[c4-18], r2
+.define c1 = c4
+L4: .data c4, c1--c4-3
+mov L2[-c1-c4+c4], r2
+mov #(0)-6-14+5, r2
+.data -c1-c1, -6+8+c4, c1, 15
+.define c6 = 19/c4/18+13-16-5
+.data (c6/1)+12*c6*1
+.fill 4, (-c1*16-c4)
+mov L1[c1+8/c6+13], r2
+cmp #c6*1*X9, L1[4]
+.fill 3, 10-(c1)+c6
+L5: cmp #c4, L2[2/8*c1*19-c1]
+L6: cmp #(-5*c1), L1[-c4*c6/c6/c6]
+hlt
@@ -0,0 +1,46 @@
+.define c3 = 20
+prn #c3
+.fill 3, 3
+.entry c3
+.entry c3
+L0: mov #c3, r0
+L1: mov #-5-c3/11*c3, r6
+L2: .data -c3-c3+14, 8
+.define c3 = -c3+c3-c3/c3*c3/-7
+.data (c3)/c3*c3, -c3/5*6, -19, (4*14)-c3*18-12
+.data 4*14/8+10+c3*10/c3
+.define c10 = 10
+.data 20
+cmp #17*1, L0[0*c3+-18/c10]
+prn #3
+.data -17*11-c3*15/c3-3, 13*c3*c10/c10, 19, c3+9+3-(10)
+L3: prn #c10
+.data c3/c10/20/1*16-11, 12+-1/18, -c10, 8/(c10*c3)
+mov L2[(c3)], r2
+L4: mov #12*c3-c10+10, r3
+L5: mov #(c3*c3/c3), r7
+mov #(-18), r7
+.data 10, 6/c10, c10/13*c10/18, (12/15)-11
+cmp #--19/7, L4[-(2)*c10-5]
+.fill 1, c10*11/c3
+.entry c10
+.define c7 = (-c3*c3+20)
+mov L2[(c10+c3*16)], r2
+mov L1[16/c7-8*4], r2
+mov L3[(c3)], r2
+.define c1 = c7-7 + c3
+mov L0[c7+c7+-c10-c3], r2
+prn #(X9)-4/0-(11*11)
+.define c5 = -16 + c10 + -c10-L0
+mov #(c3+7*2-1), r0
+mov #6-15-7/16-c1*c7, r4
+.define c15 = 8
+.data (c10)*7-c3+c3+c3, 18
+L6: mov #-18+0/2*0, r1
+.data c3+-c10/13, (15/c15/2*c7)
+.data c3, 3
+mov #(11)-c1-18/(19/19), r5
+.data 0
+mov #13, r7
+mov #8, r1
+hlt
@@ -0,0 +1,117 @@
+prn #3
+prn #5*X9
+.data 10-11+4+(7)-19+17, (6+12), ((19))
+.define c9 = (10*12/6)
+L0: .data c9*c9-8/5+L0, (7), c9
+.data -2+(c9)-c9
+mov #c9-13+(19)/(c9*17), r0
+L1: .data -13, c9+c9*14, 1, 4-c9/c9/c9
+cmp #(c9/8+20), L0[1]
+.entry c9
+mov #5, r2
+.define c2 = (-c9)
+.define c15 = (3)*2/17 + -16
+.entry c15
+L2: mov #18*11/15/c2+c9, r0
+mov #6*c9*c15, r2
+.data (16), -5/8-c9-c2*c15*(c2), c9, ((-c15))
+mov L2[-c2-c2+-(c15)], r2
+mov L2[c9+(11)], r2
+mov #c2-17-16-c2, r7
+.data 13+7*(c9)*c2, ((c2)/c2), 1/4-7*10-c9, c9
+mov #c15, r3
+mov #(c9-7+c9+c2), r2
+.data (16*c9/5+17), -2*14+c9--c9, c9--2+-c15
+L3: mov #(--c2), r5
+.data 3-4, c2, -7, 2
+mov L1[c9], r2
+mov #(c9)+c15+12*6, r0
+L4: mov L2[c15], r2
+.fill 4, (c2)*c15/10
+mov L2[c9+c15+c15/13+13], r2
+prn #17/6--8-c15
+prn #-c15-c15/(12)
+.define c10 = 13
+.define c14 = c2*c10 + -c15-(20)
+L5: mov L5[-5/c14/c2], r2
+mov #2, r2
+.define c2 = -c14*19+15-16
+L6: mov #(0-0+-8), r5
+.data 5, -c15/c9+-c9+c15, (-c2)
+cmp #(-c2+0/c2), L5[c2*c15*7*14]
+mov L4[5], r2
+.data c15, -17, (c15)+4*11
+L7: mov #5, r7
+mov #c10*(c9)+(18/c2), r0
+.define c15 = 0
+L8: mov L2[c15-c10*c15], r2
+mov #9, r5
+cmp #0-1-c2-14, L5[7]
+.data 12+c14-7/c2*(c9-c2), 6+6*c2/14*c2
+mov L3[c2-(19*c9)], r2
+cmp #8+c10/7-c14-6*c10, L5[nope]
+L9: mov #2, r7
+.define c7 = -18*c2-c2
+.data -(10+1), c7+4/c15-18, ((c15)), c7/c15*20*6+3+c7
+mov #(13)*c2*c7-6, r4
+.data 5, (-12)-20/c2/6/c15
+.data 14, -11*c7/-c10+11
+mov #15/c15/c14+5, r5
+.define c3 = c2+c7/7/c14+c15-c10
+.define c12 = -3*0*14-c3-c15
+L10: mov #(c9)/(c15), r3
+.define c0 = (7/5)
+prn #3
+.define c14 = 8
+cmp #c15, L1[7/(c2)*9+17*(c7)]
+L11: mov L2[c12], r2
+.entry c3
+L12: .data c9/3+11/6
+L13: mov L6[7], r2
+.define c2 = 8-c7+7+5
+mov #(c14+15)+7-20--c12, r5
+L14: mov #-c9*18/2/(c14-5), r2
+L15: mov #16, r4
+L16: .data c2+4, c14+(c9-c2), 3-17*c2-c12--9/13, c15-nope
+.define c8 = 6
+.data c14, (2-c2)+(4+c8), 14+c12/-19-((12))
+.data 4/-15+c2+10, 5*c2/14+c10*c2, 20/2+5*7-(c2)
+.define c5 = c14
+mov #1, r5
+L17: mov #0*9+c3--c5, r7
+prn #c3-c15-c2-10
+mov L2[6], r2
+L18: mov #c3, r5
+.fill 3, c2
+mov #-14-3*7, r4
+mov #19, r6
+L19: prn #((c15*1))
+.define c4 = c2
+.define c1 = c8
+.define c0 = c2 + c2 + c2 + c4*1*c15
+mov L11[c8], r2
+.define c3 = c2
+L20: mov #11, r1
+mov L14[(c2)*c2*c2+-3+c1], r2
+prn #--7*X9*c8*c5*c3
+mov #c14-c5/(4+c3), r6
+.define c0 = -c14*c0*c2+1
+.define c13 = (c10/c0*5)
+cmp #(-c2-c5), L0[(17)]
+mov #(c12), r0
+L21: mov #(4), r6
+L22: mov #c14-c12, r6
+mov #(2), r3
+mov #(c15)*(c8)-c0, r2
+mov #c0*c2+16*19*4, r3
+.entry c3
+.define c1 = c4
+.define c5 = -(c14 + 17)
+.data -c1, 15-c5+c4, -c0, 3+1/-c1/c0
+.define c15 = 5
+L23: cmp #-0/2/13+-3, L1[c3+c0/(16)+-c15*c2]
+.define c9 = 3*c10
+.data c2, 8+15-12, c4+-c1/18
+.data 3
+mov #(0/1)*11-c5+9, r6
+hlt
@@ -0,0 +1,26 @@
+.define c9 = 9/(8)--0+3
+.define c10 = ((18+c9))
+mov #c10, r3
+mov #-c9-3*c10*c9+6/c10, r7
+.entry c10
+.data (4)*c10, (c9/-18)
+mov #c10*c9*c9, r4
+.define c3 = (16*c9)-(4)
+mov #((c9)/-c10), r2
+L0: .data (c9-c10)*(18)*(19), 4+20, -c10, -c9/2*-19+c3-9
+mov #0--c9*4-c3*c3/c3, r1
+L1: .data c10+c9*c10/6, -2+c10/2, c3
+.data -c10, 12, -c9*15-11/3, 1-c10+17*6/c3
+.data c10+18, 14+c9-c3*8, 4*16, (c3+16*c10)
+.define c2 = c3
+.data -c10-c3, -19, 17
+prn #6+c2*c10--c3
+mov L1[5], r2
+L2: mov L0[6+c9], r2
+.data --17/c2, 5
+mov L2[-c9+4+-7/c10], r2
+.define c12 = -c9-c2--(14)
+.define c0 = c2/-11+c3*5*11
+mov #-14, r3
+mov L2[0], r2
+hlt
@@ -0,0 +1,104 @@
+L0: mov #2, r1
+.data -(20)-7, 1+4-1-12+19/4, 20
+.define c0 = -8/11/14
+.data 15, -6+c0*-c0
+cmp #3+c0, L0[19+9/3]
+L1: mov L1[19+7-10--13], r2
+L2: mov #-c0, r5
+L3: prn #-c0/3+c0
+.define c1 = -c0/16*c0-15/1
+prn #-(-20)
+.data c1, c1-3+c0/1
+prn #c0
+mov #15-7+c1, r5
+mov L0[c1+15-15*c0], r2
+prn #c0
+mov L1[13], r2
+.data 2-c1/12/4, ((0+c0)), -c1/2, c1
+.define c2 = c1-5/4
+.data c2, c1-c1+c1-c2, c1, ((c2+17))
+mov #((17)*c2), r7
+mov #(c2+(13)), r6
+mov #c0*(c0)*-c0*c0*c0, r3
+.fill 4, (10-c0+c2/5)
+.define c3 = (c0)
+mov L1[8], r2
+cmp #c1-c0, L1[c1/1/3*10-c0*0]
+.define c4 = c0-c3*c1-7+14*8
+L4: mov #(-c1-c2), r4
+L5: prn #c3-14/5*c4
+mov L5[10+c4], r2
+mov L1[1-18], r2
+.data ((c4)*13-1), c4, c1, 6-12/5*(c3)*(c1)
+.data -c4, 18
+.data 17, c2, c0, 11
+.define c5 = 0
+mov L0[4], r2
+mov L1[0/20/3-c3+c0+c4+c4], r2
+mov #19, r4
+L6: prn #4
+L7: prn #c0
+mov L3[-c4-3*9], r2
+mov #1+(20)+--c0, r1
+prn #12
+prn #6/2
+.fill 3, (c2)
+mov L7[-14/3], r2
+.define c6 = c3+c2+1-13
+mov #(c6*2)/2, r7
+L8: mov L7[c1/5*c6], r2
+.define c7 = (19)
+prn #4
+cmp #-9+c2-c2, L7[c5]
+L9: prn #-5
+.define c8 = 17*(c4)*(c6/10)
+.define c9 = c3
+L10: cmp #(-2/5), L3[(c4)*7/15-c5/3]
+prn #c4/4-c8+c6/3
+.define c10 = ((c1*7))
+mov #0, r7
+mov #18, r5
+.define c11 = (17/11) + c5/2
+L11: cmp #c4, L9[(c0/5-c7/3)]
+.define c12 = -c6*11+(c3)
+prn #c0--(0)
+prn #c12
+cmp #11+c0*4/3, L9[-18/2-c12/4]
+L12: .fill 3, 2/5+(c9)*c9
+.define c13 = -2/3
+mov #5-12/5*2, r5
+mov #(c13), r1
+L13: mov #2, r6
+.define c14 = ((c12)+(c11))
+.define c15 = 19
+mov #1/16+c11*c7, r6
+prn #2*c8
+prn #c3*1+(14)/3
+prn #c8
+.data c3
+mov L3[10/9], r2
+mov L13[19*(c11)/3], r2
+L14: mov L3[c9*(0*14)], r2
+L15: cmp #20, L11[(c6)/1]
+.define c16 = 3
+L16: mov #(8-16/1), r6
+mov L1[7], r2
+mov #c0, r1
+.data 3+5+c14, c6
+mov #-(16), r6
+.define c17 = c9/4
+mov #(2), r3
+L17: .data 18+c7/1*17/2*-16, c8
+mov #(-(2)), r2
+.fill 1, 15
+L18: mov #c9, r6
+L19: mov #c11/1*13, r7
+mov L12[c17+20*c10/1], r2
+.data -15, (c14-c16-c10*5), c11
+mov L15[15/3-c7*c3*(c2)], r2
+mov L8[0-7/1*c2/1+18*17], r2
+mov L19[(-10)*c0], r2
+.fill 1, c14-19/2*5
+prn #(5)
+mov #7, r3
+hlt
@@ -0,0 +1,43 @@
+L0: .data 4, 17, 20
+L1: mov #2-14/-15/-1/10, r5
+.define c13 = -(18)+20/18-16
+mov #--20+(19), r6
+.data (15)+c13/c13, 1, c13-((c13)), 4
+L2: prn #c13*2/c13+c13-c13
+mov #c13, r0
+L3: mov #4, r4
+mov #-c13, r3
+.fill 1, c13
+L4: prn #14
+mov #18, r7
+.define c3 = (10)-4--c13
+.data -c13+(c13)*1
+mov #c3, r6
+.define c12 = --c3/c3
+.data c3-16
+mov #((4)*c12), r0
+.data 13, (4), c13/c3, -(14+1)
+.define c0 = (12+c13)
+.define c10 = 5
+mov #(c0), r0
+.fill 1, (1-c12)*-c12/-c3
+.define c9 = ((c13*c10))
+.define c14 = 14-c9
+.entry c0
+.fill 3, (17)
+mov L4[3], r2
+mov #((8)), r4
+L5: mov L3[(-4+13)], r2
+mov #20*10+c10-c3, r6
+cmp #c10/(c14)-17+5, L3[(11)]
+mov #5, r1
+mov #c3, r7
+prn #-c12+c14
+L6: .data -(0-c0)
+mov L6[((17))/(c13)], r2
+L7: .data c9-X9*c13*c10-(c14), 1
+mov L1[c3*c9*-c0+17+c0], r2
+mov #(L0/c9+3), r3
+.entry c13
+mov #-8+c12+c14-c13, r5
+hlt
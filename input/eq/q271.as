@@ -0,0 +1,82 @@
+mov #15, r1
+.define c3 = 8+14-4*8+15
+mov #-11-(c3)*8-2, r6
+.entry c3
+.data 0/(17/c3), (15-c3)*c3, 20, c3
+L0: mov #(17+2), r4
+L1: .fill 3, 1
+L2: prn #(2*X9+19)
+mov #1-c3-(c3)/-5/17, r0
+.data -c3/c3+(18), -2-c3/20, 18, 13*c3-(c3)+c3
+.define c7 = 12
+L3: .data 13, c7*c7+7, -10, 18
+.data -16/c3-15, 11
+cmp #-0*c3-c3/9, L1[(c7-c3/-9)]
+.fill 4, 8*c3/c7*17
+L4: mov L2[9/(-8)], r2
+prn #((c7))/17
+L5: prn #c7
+.define c10 = (c3*7)+-7-c7
+mov #(c7), r4
+.data -c7, -c7/c3-17-c3, c10, 15
+L6: mov #(14), r6
+mov #--c10/c10, r6
+mov #-c3/c10-3, r0
+L7: mov L3[--16+c7], r2
+.data c3, 4-15/(c7)*1, -8/c3+c7/4, 15
+mov L1[-c3-(c10)*-(16)], r2
+prn #-X9/3-c3*-17-15+c3
+mov L0[c3-(c7)], r2
+L8: mov #c10-c3, r6
+cmp #(-2)-10/c10--6, L8[-10-6*15]
+.data -(11), (c3)
+L9: .data c7+c7*(16)-c7/c7-c7
+.fill 1, -18*10/c3-c3/c7
+.data c3, -c7
+L10: mov L8[-(c7-c7)], r2
+prn #c7
+mov #15, r2
+.define c5 = 13
+mov L6[(4)-c10-c7], r2
+.data (c7)*15*15+(c5+c10), (c10)+c7+c7*c7+-c3
+mov #-c7/c10*c7+c5-1+c5, r5
+.data c5+c7
+.define c10 = L0/5-c5-2/17/1-13
+prn #c10+(c5-c5)
+L11: .fill 3, c5
+mov #-(7)*12*13, r4
+mov #(c5-11), r0
+.define c1 = c10*X9
+L12: .data c3, (2+7)-c3, 5
+.entry c7
+mov #(-c7*c7-4), r4
+.data (c7), 16+c3/13+c3, c5
+.data 18, 0, c7
+mov L3[(18*7)+-c1*c10], r2
+mov #20*17, r5
+.define c1 = 19-c1/c7*10+0
+L13: mov #c7*-1/c3/18, r7
+.define c5 = -0+c10/19-16
+L14: prn #7
+mov #((c7))/(12), r6
+.define c2 = c10-c7/-c5
+mov #-12+c5, r5
+.define c8 = 4/c7
+mov #c7*c8-2-9+14-10/(3), r3
+mov L13[(c8-c3)*9], r2
+.fill 4, 0
+.define c1 = -12
+.define c2 = c5 + -(c10)
+L15: .data -7*X9-1/5
+mov #c2+c1/c5-c5, r0
+.define c7 = 0-2-c1*c1-(10*c10)
+mov #12+-17*c10/c10, r7
+prn #7
+.define c13 = 12
+prn #16
+L16: mov #c3/0+c3/11-5, r4
+mov #9-19-c7-14/(10+c1), r6
+L17: mov #c7, r6
+mov L8[-L0+-c2+1*c10/1-19], r2
+mov #15/17/c1-2/c2, r3
+hlt
@@ -0,0 +1,82 @@
+.data -7*7-5, 14+17+13-2-18-(13), 19-(9)*(1), X9-4/15/13
+.data (15)*16+13*1, (8)*5+15--4
+L0: cmp #1/6/9-14-11-14*4, L0[15+-3+18+10/14*0]
+.data (20/-13), -7/19*14/5+14/9, 18
+prn #L0
+prn #12
+cmp #(13/15)+-20/5, L0[20]
+mov L0[(19*20*X9)], r2
+.fill 4, 8
+L1: cmp #11-13/16, L0[1+(6)+15]
+L2: mov L2[-18*17+-nope+(1)], r2
+.define c0 = (3)*13-18 + 14-14
+L3: mov L2[17], r2
+.define c8 = c0/15
+mov #3*c0*c8*c8/0-(0), r3
+mov #10, r0
+L4: .data -9-8--6, 6, 1, c0
+.fill 3, c0
+.entry c0
+.entry c0
+prn #8
+.define c11 = ((L0*c8))
+.define c14 = c0*c8*c0/-(c8)
+.fill 3, c14
+L5: .data c14
+.define c4 = c0
+.define c12 = 6
+.data 11, -c8/6+10*c8
+mov #7, r4
+mov L4[(14*10/3+c12)], r2
+prn #16
+L6: mov L3[13+c8*c0-3*c11], r2
+mov #-4, r7
+mov #2, r3
+.data 6*19-c0+6/11*10, c11-11/c8/((c14)), ((X9))*c14-2/17
+.fill 1, c11
+.data c11, -c8
+L7: .data 16+-c4*20, (c4), 19/c11+-18*c4+16+13
+.define c14 = 4
+L8: mov L6[14], r2
+L9: .data (-c12)
+.define c4 = (0 + c12/c11)
+prn #(c12/(c14))
+.define c7 = 16*-c8+c4*17
+mov L3[19+2-2*18+-c8--19], r2
+L10: mov #10, r0
+L11: mov #1, r0
+.define c2 = (3)*c11/-c0+c11
+.data c14, -(c14+13), 11, 9+c12*c11-14+9
+mov #6+15+16*c8, r4
+mov #-5/10--c4, r6
+mov #6-c14-4+c11/7, r5
+mov #8+15/c7+-c11, r5
+.define c0 = -16-4*c4*(c4)
+mov #6, r1
+L12: mov #-c12-12+2/c14+c2, r7
+mov #c8, r5
+L13: .data c12, c2/c7-8-c7-c4*c4*c8, -c8, 2-19+17/c4*1+13/c0
+.define c4 = (c14+c0)
+mov #c4, r0
+L14: mov L13[c11+c14/(c0*10)], r2
+prn #c12
+mov #c11*10/c0/9, r1
+.data 2/3+15+20/18-10+c4, (--12)
+.fill 2, 18
+cmp #20, L12[12]
+.define c14 = -18/(c12)
+mov #((c12))+-c14/c7/13, r0
+mov #6, r4
+.define c10 = c0
+mov L5[9], r2
+.define c7 = c2
+L15: .data c7, c14, --L0-c0
+prn #(c8)
+L16: mov #(c0*15)-7*c14, r6
+L17: .data -5-(13)-c14, c7-8, c12+(c0*14)
+mov #20*18+c4*c4-4/2/c8, r5
+L18: .data c10-(14)
+L19: .data c12-c4*14/c7, 18, 15+(c10-2)
+.define c3 = c11-8
+L20: mov L11[c12*5-c8/-c4], r2
+hlt
@@ -0,0 +1,45 @@
+mov #-20*16, r6
+prn #L0*18/11-5
+.define c2 = (4*13-7)
+mov #(17*4+7-c2), r0
+L0: mov #c2*c2-c2/c2, r1
+mov L0[c2--16+c2], r2
+.define c0 = 12
+L1: mov L0[9/c0], r2
+L2: mov L2[c2*2*c0*-19], r2
+mov #c2*(c0)+(4), r4
+.fill 1, c2
+cmp #c0-c2+(10), L2[(c2*17*11-c2)]
+.fill 4, 18
+mov #(c0), r5
+.data (3/3)/-15-15+c2, 16, (c0)
+mov #(-0)/-13+7, r0
+.data 6/1/c0-((15)), 11, (11)
+.data (c0-c2/8), 7, c2
+mov #c0, r0
+mov #--8+17, r3
+.data -16/(c2)*1*c2*(12), (c0)
+.define c13 = (c0*c0/c0)
+L3: mov #-17/c13-c2/15/(7), r4
+L4: cmp #c0-20/(c13+c2), L4[c0+c13+c0--c13*20]
+L5: .data 3, nope, c13*c2-11*-2, --13
+cmp #(7)-c13+(5), L0[c2*-6+14]
+.define c11 = 7-c0/18*5
+.define c7 = c13 + -c0-11
+.define c6 = (11)
+L6: mov L2[4], r2
+.data 1*nope/c11-13*c7, --c13*c13+18-11, 12-c11*(c7)+11
+.define c15 = 17
+mov L5[c6], r2
+.define c11 = -(5)-c2
+L7: .fill 1, 11
+mov #(15*20*0+c13), r4
+.data c15*-c11+11, -c6*16/-c13/c11/c15, 11+c6
+mov #c2, r3
+L8: cmp #0, L7[-c11*(c6)]
+.define c5 = c7
+L9: mov #-c2-c13-(c15), r4
+.define c0 = c0 + c11
+mov #c5, r6
+L10: mov #(c2)*18, r3
+hlt
@@ -0,0 +1,39 @@
+mov #17+13*11-11-15, r6
+L0: .fill 1, 8+18
+prn #6
+prn #19*3--15*12-9+20/4
+.define c3 = (9/13)/4
+.entry c3
+L1: mov #3, r5
+.define c3 = 5*(13)+c3+6
+L2: mov #c3, r0
+.fill 3, 18/c3-(6)*c3-c3
+.data 2-(c3)/c3, 1*c3, c3+18/c3, 14
+mov #4, r5
+mov L0[6], r2
+mov L0[c3], r2
+.define c7 = c3
+.define c11 = c3
+mov #c3, r5
+mov L2[c11], r2
+.fill 4, (c11)
+.data (c3/11--c11)
+.data c3, c11/2/c3*c3, c3+5*c11/c3, c3*c3+5--c3
+.define c14 = c3/c11/c11*c3 + c11-c3
+.fill 1, -c3
+.define c13 = c3
+mov #(19), r7
+L3: .data -c7--20-c3+5, (c13), -c3+2-17+c3-c14/(4), c3
+.fill 1, 8-c3
+mov #6, r4
+mov #c14/19-c3*13*--10, r1
+L4: mov #10, r7
+L5: .data c11*12-c3/c7+10, (-5)+18+5*(c13), -c13, 15*(4)*c13
+L6: .data --12+1/20, 4*13*c7*17, (3/c14)-0/5-c11
+L7: prn #c7
+.define c2 = c7 + 17*17*4*4/c3*4 + c14
+.fill 2, 12-c11
+.define c7 = c3
+.define c7 = (c7)*-17*((8))
+prn #4
+hlt
@@ -0,0 +1,118 @@
+L0: mov L0[18-7*13*20], r2
+.define c10 = 11
+.define c15 = (c10/19)/6
+L1: .data 8, 14, 8
+mov #---c10, r7
+.data c10*c15+11/5, 7, -12+11-10+c15/0+c15
+mov #X9*c15/13*c15+c15, r7
+L2: .fill 4, c15-14-c10
+.data c15*c10/-c15-X9+7, c10, 20-c15/(5-c10), -3+c10*16
+.data (c10-c10*(c15))
+L3: .fill 3, (14+c10-7+c10)
+L4: .data 15+c10-(c10-12)
+cmp #c10--c15, L4[1]
+L5: mov L0[8-(c15)+-8*c10], r2
+mov #(c15), r2
+mov L5[c10], r2
+L6: mov #-c10, r3
+L7: mov #20-c10+20*9/c15-(4), r0
+prn #c15
+.define c4 = 4/9-10/4/c15
+mov L0[(4)], r2
+cmp #-c10*c4*-18, L0[16]
+.data 19/-c10+7*6
+.define c13 = c4/6-(2)-(8)/-c4
+mov L7[c4], r2
+.define c4 = -c10-c13 + c15-10/0
+L8: mov #2+2*20-c15--(c10), r3
+.define c10 = 18-c13/5/10--c13
+.define c7 = ((1)+c13)
+mov L7[c10+c4/c10-c10], r2
+mov #c4-13/9/15-16/9*6/7, r2
+L9: mov #c15, r5
+L10: mov #19*c15/7, r3
+.data 0, (-c4-c7-c7)
+.define c2 = 16
+.define c7 = --4-c10*9
+L11: .fill 4, 4-4/c7/5
+L12: mov #c7, r1
+mov #c4, r3
+.define c8 = --(c4)
+mov #-c4/14*c7/c4, r4
+L13: mov #0-(18), r7
+mov L4[(c10)], r2
+.data (10), 14
+mov #-(c8/16), r1
+L14: mov #c10+(c4+c4), r2
+.define c2 = -12
+mov L14[c13], r2
+mov #13, r7
+.define c5 = 5+12
+mov L11[c10], r2
+L15: .data 12, -20*c4*7/4, 4*c10/1-c8/3/c8-15
+prn #11+3+7*20+10
+.entry c2
+mov #c15, r4
+mov L5[0], r2
+L16: mov #13, r2
+mov L10[1], r2
+mov #4, r0
+prn #(-c8/17)
+.fill 2, 8
+L17: prn #8-(13)
+mov #(c7/3+c2*13), r1
+.define c4 = -(X9)*c5
+cmp #c4, L3[c2*5]
+L18: mov L6[c7+6-c8-c8+L0/3], r2
+L19: mov L2[c2*c10+c7], r2
+mov #(c15), r5
+.define c6 = c2
+L20: .data (6)/c15, c4+15*c2*((c2))
+mov #4, r4
+mov #6*c15/c13, r1
+.data 8, 2, 16, -3/11/c2
+cmp #(15)*(c10)+c2/8-0, L2[12+2/c8*8/c6-c7*12]
+mov #6, r3
+L21: mov #c4, r5
+mov #12, r4
+.define c7 = c13
+L22: prn #c6/12-c4+c8
+.define c6 = c4+-2+15
+L23: mov L23[20/15*20/9/-7/20+0], r2
+L24: mov L22[c10], r2
+L25: mov L20[-c15], r2
+.entry c6
+L26: mov L26[((12))*c15], r2
+prn #c2+c4
+mov L11[c4], r2
+mov L14[6-c8/c5-c7-(c7)], r2
+mov L1[c8*c8+c6*19/3], r2
+L27: .data (c6)+3*c10*1-15, 5
+mov #c6/12-7+((19)), r0
+prn #-c7/c10+c5-13
+.data (-0/c7)
+prn #0
+mov L17[5/-c6+14/4/(c10)], r2
+mov L13[1/3*c7-15/5], r2
+.data -14/4+c10/7-13, 1, 7, c15*c7+3/17/-5
+.define c11 = c13 + 3 + -c13
+L28: .data c4/c11*(1)-2, c10-7*c7, c2+c4*c2+9/c11*c8
+L29: mov L17[-c4-10-c4], r2
+mov #15, r4
+mov #11, r0
+L30: .data (-c6-0), 1+(c6)*c2*nope, 20, 11-4*c6/c4*16*13*c8
+mov #c4, r7
+mov #(c7*c15)/20, r7
+.define c12 = c2
+L31: mov L23[c4], r2
+mov L4[6], r2
+mov L1[10], r2
+.data 2/c13, 13, 16*14*c12-11/-(17), -5-c7--2
+.define c15 = c10
+prn #17
+.data 3*c2
+L32: mov #c6, r1
+.data 9
+mov L24[c2], r2
+mov #c4*c4-c4*17-15, r0
+hlt
@@ -0,0 +1,68 @@
+.define c10 = L0
+L0: mov #-13, r0
+.define c13 = (c10-9/c10)
+.define c8 = c13
+L1: mov L1[14], r2
+mov #c10-c8*5+14/c13, r5
+mov #13*19/2+(c8)+11, r2
+L2: mov L0[(7*4+(20))], r2
+.fill 2, c8
+.define c6 = c10*c10/4 + c10-c8/4 + c13
+mov L0[c13-2/c13], r2
+.define c1 = 11
+.define c1 = (c8/c1*X9 + 19)
+.define c14 = c1*c10
+mov L0[-10+17+19*8], r2
+.data c13, 3
+.fill 3, (c1)
+L3: mov #14, r6
+.define c11 = -0
+.data 7, 7, 4
+mov #c1, r4
+.define c11 = c11
+mov #0, r2
+mov L2[8], r2
+mov #19/17+-c11-3, r3
+.fill 3, -15-c1*12+-c14
+mov L1[19], r2
+.define c0 = c8/1*5-c1
+L4: .fill 3, c1/2--12*c8
+.define c7 = (c1)
+mov L4[c6], r2
+L5: mov #c6, r6
+mov #c6, r2
+mov #c14, r6
+L6: mov L6[--10], r2
+.define c10 = (10)+c13+9*10+11*c14
+.data c14*17*4*c6--c14*1
+.data 9, (7+11)-c11, (-c14)-c1, 13*0+(2)-(11/c0)
+mov #c6, r0
+L7: mov L0[14], r2
+mov L0[c10], r2
+L8: prn #-c10-c7*c11/7*c0
+.define c14 = 15/6
+.define c7 = (c1-5+c8)
+mov #-9, r4
+L9: mov #10/17+2+9, r2
+.data c13, -c10, (18)/19-9+c1, 6
+mov #--5*1, r5
+.fill 3, c11-c10*14-c7
+.define c2 = (-c0)
+mov #c11*13, r3
+.define c4 = 19*c2*c7 + c7/-19/c1
+.data c11, -c8
+.define c1 = (c2/9)-(11 + c11)
+mov #-20*c10*c1*1, r0
+L10: mov #7, r5
+mov L10[(4)], r2
+.entry c10
+.entry c14
+L11: mov #2, r4
+.data -c1, (c14)*17/12+-c8+c2
+.define c6 = c14+20+16/c11*c10-7*10
+.data c6, -20*(1)/-c7*-c6, 10
+.data 4
+L12: mov L7[-c10*c7--19*c10/c8], r2
+mov L3[c6], r2
+L13: prn #7
+hlt
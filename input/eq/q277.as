@@ -0,0 +1,32 @@
+L0: prn #18
+.define c6 = 9
+.define c15 = c6
+mov #c6, r4
+.data c6, 5, -c6, -c15
+.define c14 = (12*c6*-c6)
+.data 14
+L1: mov L1[c15/-1+17+6], r2
+.data 15*c15-19+17
+prn #14/2*2-17*19/15+c14
+cmp #c6, L0[c15]
+L2: mov L1[5/c14+9/c15], r2
+L3: mov #c6, r3
+L4: mov #5, r4
+mov #--c15, r2
+L5: mov #c15-c14+13-15---c14, r3
+mov #4, r5
+mov L3[7], r2
+mov #(10), r5
+.define c5 = c14*-c14
+mov L2[10], r2
+mov L4[12-c14*16*c6], r2
+mov #18-c15*1+c15-c15-4, r5
+.data (c6+13)+-11*20-6, c5*c15-2+c15-14*17
+L6: mov #4, r5
+.define c13 = c15 + c5
+mov #((c6)+c6+c5), r4
+L7: mov #((9)*2+c14), r4
+.data c13-1/-13+4/c5*X9
+L8: .fill 4, (6)+c6/9+c15/c15
+mov #3, r1
+hlt
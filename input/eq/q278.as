@@ -0,0 +1,58 @@
+L0: mov #2/-(11), r6
+L1: mov #19+10/8+19*7+7+6-17, r6
+L2: mov L2[(-0*9+13)], r2
+L3: cmp #(13), L0[-5]
+mov #11+2*15/16+-5, r0
+.define c3 = 3
+cmp #(5), L1[1*19*16]
+.data 9-19*c3/-c3-c3*c3, c3
+mov #-c3-c3*-c3+-18, r5
+mov #c3+18*16+18, r4
+mov L3[3--16-4], r2
+L4: mov #(c3*c3), r2
+.fill 4, 0
+mov #c3+c3+0/8+-c3/18, r4
+.fill 2, c3
+L5: cmp #-19, L0[2]
+mov #--c3/c3, r7
+L6: mov #-c3/18*c3-c3, r7
+L7: .fill 3, (c3)
+mov L4[c3*c3/18-c3], r2
+mov L3[7], r2
+prn #c3/c3+c3-9
+mov L5[-c3+c3-4/c3], r2
+.entry c3
+mov #c3*-10-c3/c3/3/c3, r1
+L8: mov #5+c3*c3-11/(nope), r5
+mov L8[c3*9+2+7], r2
+L9: .fill 1, (5+c3*13-9)
+.entry c3
+mov #15, r5
+L10: mov L8[5], r2
+mov #c3, r1
+.define c12 = --c3
+mov L8[(15)], r2
+.define c1 = c12/c3*L0*7*13
+prn #c12
+mov #2*-14, r7
+.data 15+5+2-c3-9, 3/c3-20-14
+.define c10 = -c3
+L11: mov #5, r2
+cmp #15+c1/5+4/c1, L11[c12/c10+(12-c1)]
+.data c10, -c3-c10-18, 6*c12*14-18, -c12
+.data c1/-c3/c3, c12+16/c10/nope, c3-(10/6), (c12*16)-((c10))
+.data c3, c12, c10
+L12: .data -c3, -(16/c1)
+.define c9 = ((c3+20))
+.fill 4, 5
+prn #7
+mov #c9, r2
+L13: mov L11[0], r2
+L14: mov #c1, r6
+mov L9[20], r2
+.data 19
+.data -6*c1, 16
+.fill 3, 10
+L15: mov L11[-7+-c1-c1], r2
+.entry c9
+hlt
@@ -0,0 +1,73 @@
+.data 2, -3, 13*20-(18)/-15, (4)/0-8
+mov #(3+0/12), r6
+mov #-20+0-1, r1
+.define c13 = (20)*1/2/7
+mov #c13+15/-c13, r1
+.data c13, -8, c13
+.entry c13
+L0: mov #(7*5), r7
+.define c4 = c13*c13+3-(8)-16*c13
+cmp #(14), L0[6]
+.define c8 = c13 + c13*nope*16/c4
+.fill 1, --c8/5
+L1: .fill 4, -c4*7*c8-c13*0
+.define c5 = c13/c8/c8*X9
+L2: .data ---c5
+.data ((c13)*c13), 2+7*c8/15/11*c4+c4, c5
+L3: cmp #(-(c4)), L1[16-c5]
+.define c9 = -c5 + 8
+mov #c5*c13+c13-16*2+18, r2
+.data 1, 7, (7*c5)/17*c8-9, (19)
+.define c10 = (0*c4)+(12)+(7)
+.define c12 = c10-c13-16
+mov L1[-9*c5/10*c8/18], r2
+.define c7 = 10/c13
+cmp #-16/(10)+16, L1[9]
+L4: mov #11+20-12+(c8), r2
+mov #c13, r0
+.data 1, 16-10, c7, c5-(6+1)
+.data --6, --c10/16
+.data ((c4+13)), 2-17*4--3/c10, (2), (c8/c7)/10-c4/-c9
+.fill 1, c8
+.define c2 = 5-c13/8 + 19
+.data 11/c12
+.data 18, --10
+.define c9 = c8/c10/20+c13
+mov #c8, r4
+.fill 4, c7
+mov L3[1*12+18+10/c9/L0+8], r2
+.define c12 = -c12/14*8-c4*14-8
+.data c12, ((c4))+(16), c4-14/5+6, -11-10*c5+9--8
+.data 10, c4, 6
+mov #c13-c12+c12-c9-16, r2
+.define c1 = 14-c10/13*14*c5*16*15
+L5: .data c5
+prn #(c7)
+.define c8 = (c9)/c2-c1+3
+.define c2 = 10-c12-c9*c9/c8--8
+L6: mov L3[c8], r2
+L7: prn #0
+.entry c7
+L8: mov #19*c8-c4*0, r3
+.define c13 = (0)
+L9: cmp #12*--c12, L7[-(9)+c13]
+mov L0[12/(4+19)], r2
+.define c15 = 2
+.data c2/c8+3/c8/c4/-16, 4
+L10: mov #7+c9/c2-4+15, r5
+mov #--c9*(c2), r3
+L11: mov #-10*17--c2+7, r6
+L12: .data 18/14+2-20*c9*7, c4
+L13: .data c5, 16-11-c1-20-3
+L14: .data (-c2-9), 13*18-13/c5+7, c9
+.define c6 = 4
+.define c0 = c6 + c2-c8/-14-10*15
+mov #9, r1
+mov #(-c12+c2/c15), r3
+.data c6, c7
+mov L8[0], r2
+cmp #c12, L7[-c2/9-c2*1]
+.define c13 = 6
+L15: .data 19, 5*X9+19/17/6+8-c4, -c12*13*c7, 15*c4
+.entry c5
+hlt
@@ -0,0 +1,35 @@
+prn #4-12-14
+L0: mov #(13), r5
+mov #16, r4
+mov #(9), r4
+.define c0 = --12+15-2
+L1: mov #6, r6
+L2: prn #11
+mov #-(c0/14), r3
+mov #(c0), r6
+L3: mov #16, r0
+mov #2+6*14+c0, r7
+mov #(3*11/2), r6
+.data -11/3+(4-20), c0-3
+mov #-c0-5*c0/3, r0
+mov L0[(5*7)+(c0*c0)], r2
+mov #15, r6
+mov L1[c0], r2
+.data 7, -c0+8-9-10-12
+.define c1 = (c0)
+prn #16/9+1*c0
+.data c1, 2, -2, 17--6-10+c1
+cmp #-3-1+c0/17+20-17, L0[c0-6+c1*c1+7]
+L4: .data c0, 1, 3
+L5: cmp #-c1-c1/1, L1[c0+-c1/8]
+L6: mov L3[-11*c1--8], r2
+.data 4, 10, 15
+mov L0[c0+--4], r2
+mov #c0-c1*c1+20/5, r5
+.define c2 = 12
+.data c1-c2, 14, -8*3, (2)
+L7: prn #((5)--10)
+L8: .data c2, -10/6, ((16)), 9
+.define c3 = (0/3)
+.data c2, 6/2, c3, (c1+c2-12/1)
+hlt
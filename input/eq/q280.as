@@ -0,0 +1,60 @@
+.fill 1, 1*17-15/12*(-X9)
+.define c11 = 15
+.data (c11), -12+7+X9, (17*9*-c11), 3+c11+17/(nope)
+L0: .data 4*-10+0-0, c11
+.data c11-c11/13+(L0+c11)
+.data -c11-2/c11-c11
+.data (c11*c11)/-c11-17, c11, -c11-c11/9-0-c11
+.define c4 = c11-4
+mov #-c4/(c11), r4
+mov L0[-c4], r2
+L1: mov #-(c4)+19*c4-2, r6
+.define c8 = c11+11-c11-4+c11
+mov #7--13*c4, r4
+prn #-c4*14/nope/c11
+.define c11 = -13
+L2: cmp #c8+c11-(c11)+c8, L2[2]
+.entry c4
+prn #15-0+c11*7
+L3: .data c11, c8-c8
+L4: mov #c4+c8/c8-10*c11, r0
+.define c10 = --c8+c8
+L5: prn #-14*0*20--13
+mov #(4)-(c10)/c4, r0
+L6: mov L0[(c10)+c8*c11-c8], r2
+L7: cmp #(19/c4*4+nope), L0[9/17+20*(c11)]
+.data c8*c4/c8*c11+c4, c11, c11, --(4)
+.define c14 = c10 + (0)*16*18
+cmp #c11, L3[9]
+prn #c11
+.data (c10/c11), -c8, -(c11)/12
+L8: mov L3[c4], r2
+.define c8 = c11-(4-18)
+L9: mov L4[c14], r2
+.define c10 = (c8)/3-c4
+mov L1[-3], r2
+.define c13 = c10
+mov #(4)+c14, r1
+mov #5, r6
+.define c12 = -c14*-c8*(c14)-c8+c13
+L10: mov L4[(c13/c10*18)], r2
+L11: mov L4[-8*c11/c10/c12], r2
+prn #(6)-c4-8*-2*c8*4
+.data 19, 9, 20+3*16/X9
+mov L3[20], r2
+.data c4*(c8-c10)
+mov L10[c11+c8-((19))], r2
+prn #7
+mov #12-19+(19), r1
+mov L2[c11], r2
+mov L7[9], r2
+.define c7 = -c10
+L12: .fill 3, -11
+.data (5+20)+-13-16, (c8+12)+12
+mov #-(c8)-c10*c8, r1
+prn #c13
+mov L11[(c13)], r2
+.define c4 = -1+14
+L13: mov #c8*0*c10/20*11, r3
+L14: mov #(c12)+8-17-c11-1, r2
+hlt
@@ -0,0 +1,23 @@
+L0: .data 20/17+16-16+14+4*13, 12/14*3+15/14, 17, X9/7
+L1: .data 8*3*1-7/12+17/(17), 12-2/3-2, 6, 20-2/0
+mov #-2, r7
+.define c6 = (nope*(6))
+L2: mov #16+c6+(c6)+c6/c6, r2
+L3: .fill 4, c6
+mov #1-12*c6-6/c6, r4
+mov L0[-4-c6+c6+18], r2
+mov #c6, r3
+.data c6/8*12/c6-c6*(3)
+L4: .data 4/1-13/(20)
+.data 11, -10+c6/4*16-c6-c6, c6*20+c6-(6), c6+17-c6*c6
+.define c12 = (((c6)))
+L5: .data c6+c12-5*-c12/(c6)
+L6: mov #((10*13)), r3
+L7: mov #0, r5
+L8: mov L7[c6], r2
+mov #c12, r3
+mov #0*c6-c6*c12/c6, r5
+.define c6 = -4/12-((c6))
+.define c3 = 12/-c12
+mov #c6/20+7/c3-c12/c6, r1
+hlt
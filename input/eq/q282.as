@@ -0,0 +1,106 @@
+.define c12 = 15*12/5/15-18
+.entry c12
+L0: .data (c12)/c12*c12*-(8), c12, (-c12+11)
+prn #2
+.data c12
+.data 10, c12*1*8/2, (c12+c12)/c12, 2
+L1: prn #c12/18+19/c12+7
+.define c11 = c12/7-1/(c12) + -c12
+L2: mov #c12*((6)), r4
+mov #-nope-c12, r4
+cmp #-17+-c12*14/c11*c11, L2[-14]
+mov #(c11), r3
+.data 6+-c12+c11/c11
+cmp #19, L0[c11]
+mov L1[11+12-c11*c11], r2
+.define c6 = (c12*20*c11)
+.data -c11/14*18*c11-c11, 0, 9+c12+-c11+c6-(2), 4
+L3: .data c11/c11-2*c6
+mov L2[-10], r2
+L4: .data 1*16+10*c11+15
+.data --c6/9, ((c6))/c6/c6
+.define c7 = (0)
+prn #c12-c12
+mov L2[(20)], r2
+L5: .data c6/c6+18/13, (10/6)+-c6*15
+.define c4 = c11+c11
+.define c12 = -(12-c6)
+mov L4[20*3+3/c6], r2
+mov L2[(c12/c11-7-10)], r2
+mov #13-c11/0+(c6)-3, r5
+.entry c6
+mov L5[3/c4/c12*5+c11], r2
+mov L2[c12*c6], r2
+L6: mov #10, r4
+.define c5 = c12
+.data ((17)-1*c12)
+L7: mov #-(c5)+9, r1
+.data (--14), 5*c7+(14)-9-X9/(1), -9/c7+-c5+c12-c5
+.data 0, 4, c5
+L8: .data -0-c12+14+0*18-c7, 4, (12), -17
+mov #c12+11*c11+20, r4
+mov L3[c12-18/c7+c4], r2
+L9: .data c7+2*3
+.data -4*-6-15, 9, (c7+17+c12/11)
+.define c10 = -8+14-0+3/8*c6-c11
+mov #5/18*4+c10*(1+10), r6
+cmp #((nope))-9-c10/11, L6[c12]
+mov #-15/-13-6, r1
+L10: .data -c7*c6*(c4)
+mov L10[18*18/20-(c10)], r2
+L11: mov L9[12], r2
+.entry c12
+mov #c5+(c10)*-c4+4, r7
+mov L4[c4], r2
+.define c3 = 3/6*c6-17
+.define c7 = (17)/c3+4*c12*1--c12
+.fill 2, c7-14/6+6+(c5-c12)
+cmp #c5, L1[18/13+c4/1]
+mov L7[18], r2
+.define c0 = -c4*c7-c6*6 + c12
+L12: .fill 1, c7
+mov #c11, r7
+mov L1[(c0-c12*c6/4)], r2
+.define c7 = c0/19 + c3/2-((4))
+.define c13 = c11
+.define c12 = c4
+.define c7 = c7
+.entry c11
+L13: .fill 1, 16
+mov L8[c4], r2
+L14: .data c4/-c7+4, -6-19/c6-11+14, (18)+-13--c4-c12
+mov L9[--c0], r2
+L15: .fill 3, c12
+mov #(c7), r2
+cmp #c7/c13+c7-17/-(c0), L10[(c4)/c11/19---c6]
+mov #((9-15)), r0
+mov #12/c4+-1/c12/(9), r6
+.define c15 = (4 + c5/20)
+mov #c0-13+6+-17, r6
+mov #(c3-c6), r3
+prn #-2+3*c12
+mov #(12+c15)*19, r7
+.data c12-4*20*11, 7/-8+19, 6, 5*c7+nope
+.fill 3, c4*c11*c6
+.data c7, 5*c12*8-c3
+prn #c3
+L16: mov L13[13/c4/0/7], r2
+L17: .data (-c12-(1)), 17
+prn #-18+c15/(c12)/(10)
+.define c4 = c15
+.define c6 = 8
+cmp #(c3), L9[-c11]
+L18: mov #-c7/6+5+18-c3, r4
+L19: prn #c6
+.data 12, c12/c11+(c13)-X9
+L20: mov L6[2], r2
+.define c9 = c7
+L21: .fill 1, --c12-17
+mov #8, r0
+mov #c7-c12/c11*6*7/c12, r3
+.data 1, (c15/12)+-c12-c15-3, -(10)+c12/20, 14
+mov L1[((13))+11], r2
+L22: mov L11[-4-15*c6], r2
+.define c4 = c10*(c9+6)
+.define c11 = c5
+hlt
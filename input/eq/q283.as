@@ -0,0 +1,113 @@
+.define c8 = 6 + 15/12/16/17/(18)
+.entry c8
+.data 17+16-18*-c8, (c8)*c8-c8+-5/c8*c8, -11+7/c8, 5
+.entry c8
+.define c14 = c8
+L0: mov L0[c8-c14*14*2-6-1*6], r2
+.define c8 = c8
+.entry c14
+L1: mov L1[2], r2
+.define c9 = 20
+L2: mov #(c8), r3
+.define c1 = c8-18
+.data -6, 6-c9/c8+c9*c1+-9, c14
+L3: mov L1[c8], r2
+mov #(c1)+(18)*--c8, r6
+mov #16, r4
+mov #15/11, r7
+mov L2[c8*c14+c1-c14], r2
+.data 3, 9
+L4: prn #c8
+L5: .data c8/14-15+c14/c1, 5
+.data c14+7*L0-c8, c8
+.define c5 = c1*c8*4*1/16
+.define c8 = 18/15*c1+17+-6
+mov L0[(9)], r2
+.define c11 = 4/c1/2/c9
+mov #1+c8-c11-c8/c14, r1
+mov L2[((12*c1))], r2
+L6: .data c1, 12, c11, -c14*-3+0
+L7: .fill 3, 14
+prn #c11+c14/(1)+c8
+mov L1[c11-(13/c1)], r2
+.data c8*c9-c5*c8, 9
+.define c11 = 17
+.data (9)
+L8: prn #c8
+.define c11 = c5
+.data c8, -c5, c8
+prn #(-c11+c8)
+.define c8 = c5
+L9: .data 16, c11, c11/c11-3-(14*18), c1*-15*11
+.define c12 = -c1/12-c11/c11
+.define c10 = 2
+.fill 3, c12
+.define c5 = c11--c8
+L10: .data 3, (c8)/11, (15), 13
+prn #7
+prn #13+19/8/20-c11
+.define c0 = -c5+14
+mov #c11-18-2+X9/6-20, r3
+L11: mov #c11, r3
+.define c2 = c8/(10) + c11*c12/-c12
+prn #-c8+19+1/18
+.define c1 = ((10))/c8/c10*c8
+L12: prn #c11-1+15+c11-(11)
+.define c1 = c1*c0/c5-19*2/12 + -X9
+.define c0 = 6-8-c11*c5
+.define c0 = c1
+L13: .data 2, 17, 1
+.data -c9+(c11+3), c0-c12/-c11*-c1/c1, c1, ((c11)*c11)
+.fill 3, (c1)
+L14: mov #13*c8-c0+(c11+10), r0
+.define c7 = c1 + 11/c0-16*-c8 + nope
+mov #(-c8/(12)), r0
+.define c6 = 14
+mov #(6), r7
+mov #(c6), r5
+.define c13 = 18
+.define c13 = (-14*c1)
+cmp #c12+c7/nope+(c8+c0), L8[c13]
+.fill 2, --c0-11
+L15: prn #(c13)/12*L0-c8*c6
+mov #-(13+7), r0
+.define c5 = (c2)-c1-c8-c5-c1*c13+8
+mov L9[(10)], r2
+mov L9[c0*c1+0-10-(7)], r2
+.define c8 = (c8*c8)/(c5)*c5
+prn #-(0/c11)
+mov #16, r7
+.define c4 = -c10 + c5/(8)
+.define c13 = c9
+mov #20/-8*5, r6
+.data 0, (7)
+mov #c6, r7
+.fill 2, c8
+.data (17)-6--11+(c6), 14
+mov #0, r1
+.define c6 = (c6)/4-c9/13
+.data c8+13*13/10, 16, -12+c1
+mov #-c7*18/2/13, r1
+.define c3 = 2*c13/c1-19*c6+c8+c8
+mov #(-(9)), r4
+mov L2[(c8)], r2
+.data (-8*c11+c8), -17/c0*(11)
+mov #-19/0, r0
+cmp #c7*1, L9[(8)*c11-c10]
+.define c8 = c2
+.data -(c14)*c0-c7
+mov L0[c8-c5+-c0/10], r2
+mov #20/18+c11+c1*12, r1
+mov #c4, r0
+mov L9[(c8+9)*-(c13)], r2
+mov #-c14, r5
+.define c10 = -c10-c2 + -X9
+mov #(9+0+c1), r0
+.define c4 = -c1 + c1/15
+.define c4 = c13-c11 + c14*14
+mov #-3, r6
+L16: .fill 3, 6*7+-10+7
+.data 2, c10, 15, 15
+.data 1
+.define c3 = 2*(8)
+hlt
@@ -0,0 +1,25 @@
+prn #9*6-(4)
+L0: mov L0[-3/11], r2
+.define c6 = -9/(6)*16*4/0
+L1: mov L0[16-c6+c6-17-c6*c6], r2
+.define c6 = -c6/12-c6/5
+.data -c6, c6-8/14/7-c6+19+5, c6+c6
+L2: mov L1[c6/-c6], r2
+.data 17, 19*12
+mov #7, r1
+mov L1[c6+c6/14*3*8], r2
+.define c13 = 19*5*20 + (17)
+prn #(-c6)
+.data L0-14*1+0*12*20-c13, 15
+.data c6+c6-c6*c13*c6*15
+L3: prn #c6/(c6)+c6
+L4: mov L0[4], r2
+.define c8 = c6*c6--17-c13
+L5: mov #13, r5
+.entry c6
+L6: .data 8-13/1/0, c6*2/2*c6, c8-(c8)-(17)+-c13
+.data c6*2+18/-c8/10, c13, 5
+.entry c8
+.data 9, -5---c13
+mov #c6--c13/c6, r2
+hlt
@@ -0,0 +1,95 @@
+.data 14, 4, -15*6-3, (15-11+6)
+.data 10+16, 1
+.data 9, 6, ((15-13))
+prn #14/11/3+9-20/3-(5)
+mov #18/6+12*(8), r5
+.define c0 = 8
+.define c12 = ((20)*c0-0)
+.entry c0
+.fill 2, 1
+mov #-17-14, r5
+.data -20+c0-17, 15-19+c12+c0+8-20, c0*(8)+1/13/(17)
+.entry c12
+mov #20, r1
+mov #c12, r3
+.data c12, c12
+.entry c0
+.define c9 = 6/12/(c0)*c0 + c0*14*19
+.define c12 = (c9)
+mov #(9/c12/c0), r2
+L0: mov L0[3+(14)+8], r2
+mov #-c0-L0, r4
+.define c6 = --17-c12 + 5
+L1: cmp #2-c12, L0[L0]
+.entry c12
+cmp #(10)*14*20/c9, L1[c12]
+L2: .data c9-X9
+L3: .data X9, c12-c12+c9-c6+10
+L4: .data 0
+.data 6/c9, 6/-c12*c0-c6/c0, 9, 12
+L5: .data (c12/12/c12+17)
+cmp #c6, L4[4]
+.entry c12
+L6: mov #0, r5
+mov #-15-20/(c0)*L0*13, r2
+mov L5[-c0/c12/12], r2
+.data (c9)+-c0+-(8), 19+c12, (18/c9+(c6)), c0--16/(3-c9)
+.define c14 = 17-3 + 20-15/(11)
+.define c3 = c12
+.define c11 = c12
+mov #9, r2
+mov #c12, r4
+prn #-c12
+prn #3+c0+c3-c12
+L7: mov L6[c14], r2
+L8: .data c3*-19*8+7, (16), -4, (20*4*-0)
+mov #c11, r7
+.define c7 = c9
+mov L3[c12-2/c7+c12/c0], r2
+.define c12 = c0+c12-c11-c3*-c7/c12
+.fill 4, 2
+prn #c6/13
+.define c5 = (-20*c11/19)
+.data c12-c0/(7)--c12, (c12)-c7-c5-c0+c12, (c0)-c5+12
+.data 18, c14-7*-12/1
+.data ((c14)*c0*7), 9/11*6*c12/(c9-6), c5/c5-c6-c6---c12
+L9: cmp #(c11), L8[8+1/c12-c6*(18)]
+L10: .data 17, -(11)/c14
+.define c12 = -3+20*2
+prn #19-(8)-c12+c12
+prn #-7/c12-8/17
+mov L5[7], r2
+mov #(3+15-c12), r2
+mov #8, r0
+prn #c6-13*10
+.data c12+-12*(c12*c12), -6*2-c0*8*15
+mov #-c11*c7+c9*7/c7, r6
+.define c12 = c0+17+c3+c7--5
+.fill 2, -1/4-0--15
+.data c9, (c5)/c0/-12, 13+c3*15-16
+mov #c3-c11+c12+c14-3, r1
+mov #c12-15-c3/(c9)*4, r6
+L11: prn #-c5-c12-12-X9*10/c0
+.define c11 = c12/((12))
+mov L10[-c5-L0*L0*c11], r2
+prn #12/7+20-4-c0
+L12: prn #10
+.data -1/c12-c3, c12-c9
+.fill 4, 3-1*c3
+L13: mov #8, r7
+.entry c12
+mov #-14-c7+5, r6
+mov #5-14+14-6*c14, r7
+.entry c6
+L14: mov #c0+(c7), r2
+L15: mov L7[c6-5+2+c0], r2
+mov #20, r7
+.define c0 = 2*6/c12*5
+mov #c11*c12/11, r0
+.data 20-9*-c7+c9/-1, -c12-9*c11/--19
+.define c14 = 1/c14-20*c3-4
+.define c4 = (16)
+L16: .data 5--c4*c0-14*14, 9
+prn #c12-c12-8+c6
+mov L12[14/c14*19*20*--3], r2
+hlt
@@ -0,0 +1,83 @@
+.define c2 = --7/(4)
+mov #c2, r0
+.define c13 = 1
+mov #-(18*c13), r0
+.define c12 = (15)
+L0: .fill 3, (c2)-c2
+.define c14 = c13
+.fill 3, 2
+.define c0 = 5/(c2)-7
+mov L0[X9], r2
+mov L0[-c0-13-c14], r2
+.define c12 = (c0)
+mov L0[--c14+8-6-c12*c13], r2
+.data (12)+c14*19*-11, 1, c12, (c14)+18/c0+-c0
+mov #11, r6
+.data -c2*--c12, c2, c14, c12
+mov #-8*6, r0
+mov #1/2/5, r2
+mov #(c0-18-c12-20), r6
+mov #-7/14*3*c14, r7
+.define c3 = -13 + c0/c2*c14
+L1: mov L0[c2], r2
+.define c8 = 13 + ((c2))
+L2: .data c14, -((c2))
+mov #14-c14, r5
+L3: mov L1[c8/16-11+c8+16-0], r2
+L4: mov #c2/c13*12*7, r5
+.fill 2, -4/1
+.data 3, 13*c12-c2, 1/11/c2+12/c3, (c12)
+cmp #7+c12+c12/13, L4[-11-18-X9-c8]
+L5: .data c8*0-c12+c2*c12-(3)
+prn #(c12+c14)/4
+.data --4/(14)
+.data -8+c12-1+c13, ((1))
+.define c12 = c8
+.define c10 = -(9)
+L6: .data c3, (c12)*0, 4, 17
+.data 15+-c8
+.data (17)/7, 7/c13+c10*c3-c2, -c12/c2--c14/c14, -1-18/13*c0+1
+L7: mov L1[(c14)-11*14], r2
+cmp #-6--c14-12, L7[c10/16+-14-c8/19-7]
+L8: mov L2[-c3/15/c0+12*c12], r2
+.entry c2
+L9: cmp #c14+-20-1, L1[(c13--16)]
+L10: .fill 4, --c3/3/13
+mov #6, r6
+.define c1 = 16
+mov #c12, r1
+.data c12, -c3*-10/-c14/(10), c13, -19
+L11: mov #-c8, r1
+prn #c1/c10+3
+mov #14, r3
+.define c10 = 20-0+(8)+-20
+.define c10 = 4+c10*c12-0
+.data (-c10-8), c12*-15
+.data -10/5/c10+3, 3, 7, -c10/10*19
+.define c0 = 19
+.define c13 = (-c13) + 12
+.data 2*10-6-c12-c13, c3*c14-(4+c10)
+mov #c12-9+c13-14-12, r5
+L12: prn #4/c12/11+c10*c2
+mov #(c13-7)*(c12+c1), r2
+.data c12, -20, ((-c12)), --(14)
+L13: mov L12[6], r2
+L14: mov L6[c0*c3/0], r2
+.define c0 = c1
+.fill 4, c0/-13+c14*3
+mov L10[6], r2
+.data c14, c12/(0), 4, 9
+mov #c2, r4
+mov #c12-6-c8/c0*c0, r6
+mov #((c3))*(c0), r2
+.data c13, c0, ---c12
+mov #c12-(c2), r3
+.define c1 = -c12 + 20/L0 + c3
+mov #5, r6
+mov #c12, r5
+mov #c1+c1*6*17+((c14)), r1
+cmp #3, L5[6]
+L15: mov #(-c10), r5
+.define c14 = c13*12/c10 + 15 + c13
+.define c14 = c14-15+(c10)/c14-19
+hlt
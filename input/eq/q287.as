@@ -0,0 +1,92 @@
+.define c5 = (3-10)
+mov #c5/4/18/3*11-5/14, r3
+.define c15 = c5
+mov #-4/4*c5, r6
+L0: mov #17, r5
+L1: mov L1[17-(c15)], r2
+prn #18+8-c5+c5/((c5))
+L2: mov #(c15+15)+c15, r3
+L3: .data c15, -c5, c15, c15*0+10+16
+.define c12 = c15/c5*0-c15*13
+.define c12 = (((nope)))
+L4: .data 17, 11, c12
+.entry c15
+.define c10 = (c15*c5-20)
+.fill 1, 3
+prn #11
+.data (20-X9/3), 10*c10/12*9/11, -c5+c12, c12
+L5: mov #2/((16)), r2
+L6: mov #--c12+-c15-7, r4
+.data c10, -c15+c15/-c12
+.define c12 = --c15-c5 + 5 + -0
+cmp #c12, L2[8]
+L7: mov L3[13], r2
+.define c15 = 16
+L8: .fill 2, c5
+.data ((8))-0
+mov #7-17*17+c12*(3+c15), r2
+mov L7[c5], r2
+.define c6 = -(c5)/c12*12
+L9: .data (c12)-13*c12*c10
+.define c3 = (c6+c15+c15-X9)
+cmp #11, L1[c12]
+.data c15
+.entry c12
+L10: mov L10[-9], r2
+.data c6--11*5, c12
+mov L10[7+4*6/(c10)*5/c12], r2
+mov L6[--c12+0], r2
+.define c1 = c12-7
+L11: .data -8+X9-c6/6, 3, c12
+.data 17+15/c5*c10*14, 15+6
+.data 4, 7-16/-c15, c12*c15
+.define c4 = -c12+c15/(c6)*c5
+mov L7[(-c4*0)], r2
+.fill 1, -9/c15*c12
+L12: cmp #-18/c6*12, L12[c12]
+mov #10-c15, r4
+mov #c10+-14+c15, r3
+mov #(4)*4/c15*13+(15), r1
+L13: mov #(14), r3
+.fill 4, 6+19-c4
+prn #13-c6*19+14-c6
+mov #17, r0
+L14: mov L14[c3], r2
+.data 1, (11-1-(1)), c4+16, ((c12+15))
+.define c13 = 16 + c12/18 + c12
+L15: mov #-c3, r4
+mov L10[1], r2
+.data 5, 5/5, 0*11+c6-1-c4
+mov L1[-10], r2
+mov #(17), r2
+mov L8[-10], r2
+.define c12 = L0
+mov L3[10/4*19/-c12/11], r2
+L16: mov #(3+8/c1), r0
+.define c6 = (6) + 3 + 3-1/1
+.define c6 = -(c1/15)
+.data 7, -(c12)+c6/c13, 8
+L17: prn #c12-c12+c5*(8+10)
+prn #-20*8/c12
+.data 16/c1/(9)+c15-c12, (-c10)*c5*c10, c5, --6
+.data 1+c1+10-c12-c6/c12, -c13
+cmp #2, L2[c6-5-13]
+L18: mov L2[(14*c5+13)], r2
+mov #-c12, r7
+.entry c5
+mov #(15)/c4-4/-1, r7
+L19: .data --19, (c6+11)--c6*(c12), --c1, c15/c3--19+6
+L20: mov L18[18], r2
+.fill 4, (2/c12)/20
+.data (20-(c15)), c6, 15/9*c15-c1-c6, 3/7*c3/-19
+L21: prn #19
+mov #--c6, r5
+L22: mov L3[(7+c10+16/c12)], r2
+L23: .fill 4, c12+-c12*(c6)
+.data c6, -5, c4-6-c3/15+(c12)-c5
+.fill 4, 20+2*4+1+c10*10
+mov #1, r1
+mov L9[c10], r2
+mov L12[1], r2
+mov #(-14-c10), r5
+hlt
@@ -0,0 +1,57 @@
+prn #(0)
+mov #(15*19-(3)), r7
+prn #15
+.define c1 = 7
+.define c11 = ((c1)/-c1)
+.entry c11
+mov #c1, r6
+L0: mov #4/c11-c11+0, r2
+.data X9/-c11-2+c11, 20-3-16/1/10, c1/c11+4+c11-c1
+L1: mov #c11, r6
+mov #3-c1*18/c1/c1/c11/4, r4
+mov #c1, r4
+.data c1, 9, c1, 17-12/c11/1-14
+mov #7, r6
+.data 20-c11+c11-c1*c1
+cmp #-c11/c11-c1, L1[c1]
+cmp #7, L1[1]
+prn #c1/15/1
+mov L1[(17*18)], r2
+.define c1 = 7*9-8/c11*9
+.data 17+c1*c11, -c11*c1/(c11), c11+14/c1/15/11
+prn #c1+0/10/-20/8
+L2: prn #-6+-7/c11
+mov L2[(10*c1)/c1], r2
+L3: mov #16/10, r3
+mov L0[(c1-(18))], r2
+mov #2, r5
+.data 17, c1+--6, 8/c1*17/c11+c1/-6, c1
+.fill 4, (14)/-19-c1
+.define c5 = 4/11
+L4: prn #c1
+cmp #(c1*c5)+-1+c11, L0[20*c1+c5+5/c1/18]
+.define c8 = c1 + 17
+L5: .data (-8/c8), (c8), (c5)-15+c5-8, 20*14-c5
+.fill 3, c8
+L6: mov L3[-11], r2
+L7: mov L1[11-14], r2
+mov L7[c11/5+c11*18], r2
+L8: .data c5
+.fill 2, c5/13-c5+-c5-20*c5
+mov #0, r4
+prn #c1*6-c1/c8/16-c1
+mov #13, r3
+mov L0[3/c1*10], r2
+L9: mov #-6/c1+c8-c8, r5
+mov #(c5)/c5, r5
+mov #c8, r5
+cmp #c5, L8[-c11*c11*11+15]
+.data -11*c1*(12-2), 7, -c8, c1
+mov L0[c8*c1], r2
+.data ((18)*c11)
+.fill 2, 5
+.define c10 = (c11)/1*c11/(15)
+.define c2 = -4-c1/7+10+0+c11+0
+mov L5[c11-13+nope+7+14], r2
+.define c15 = 19+c1-(10+c1)
+hlt
@@ -0,0 +1,117 @@
+.data (4+1/13+15)
+L0: mov #(5-12), r6
+.fill 2, 3+15
+.data 6*2-4*0+10+(14), 3, 12-6+(17)/5/3+15+14, -5+20*4*nope/15*4
+L1: mov #-20*7/5, r1
+.data (2*13)*11
+L2: mov #17, r0
+.define c1 = -13*12/5
+.fill 3, (12)-17*14*2
+.entry c1
+mov #1, r0
+.define c13 = -c1 + c1 + c1
+mov L1[-(9)-c13], r2
+.define c14 = (-19)*-14/9
+.define c6 = 1/-20/c14+c1
+mov #c13*c13*c14+c13-9, r1
+mov #-c14/(11)/-9-(19), r6
+L3: mov #(16+20+c13), r3
+.define c15 = 5
+mov #c15, r1
+L4: mov #-1, r5
+cmp #(16*(0)), L2[(17)+10+(7/6)]
+.define c10 = 14
+mov #c1*8-2*-12-c1, r7
+mov #c6/5*-11, r5
+.define c12 = c10
+mov #(0*c1)*-c14, r5
+.define c4 = 1
+mov #((c14)), r6
+mov #c10, r6
+.data 14/(12+c6), (11)*c10-0/-14, 5-c10, 7/c1+13*c13
+.define c13 = c10-c6
+.data -c13/19*c13/4, c15
+.data -c4, (c13), -c13, 18
+prn #((2)-5-c12)
+L5: mov L4[12], r2
+.define c2 = 20/11
+.entry c4
+cmp #((-c2)), L4[-c14*c14/11]
+L6: mov #c15/(15), r5
+.define c3 = -(9)/c10-c13
+.fill 1, c13
+L7: mov #19, r1
+L8: mov #c2, r5
+L9: .data 20/13, 12-c13
+L10: .fill 1, 7
+L11: .data 5/c15*c15/c13*5, c12
+mov #c14, r2
+cmp #5, L7[17-(c15)*c10]
+.data (c3)*-c13*c14*-c6, --c13/c13, 8
+.define c5 = 13+16*10+-c6-c15/12
+.define c1 = -c2
+mov #c5, r7
+L12: mov L5[17], r2
+.define c13 = -12*2*c6*c1/c3
+cmp #((1*12)), L0[-15/c13/c1-2/-15]
+.entry c13
+mov #(2)*c5, r7
+prn #-18*c3-c5/3
+L13: cmp #-4*3+2, L9[-7+c1*1]
+L14: .data c6/c13, c15
+.define c13 = c1-c10*c13*14
+.data c1, c15
+L15: mov L5[3], r2
+prn #c12/17+c3/c1/4
+mov #1, r5
+.data 17, c5
+.fill 1, 14+2
+mov #9+-1, r3
+L16: mov #(12)+0+c5+-L0, r2
+mov #11*c1*15, r1
+cmp #-(c14-c13), L6[17/19-c15*15-c13+16]
+prn #8
+L17: .data (c13*c1*c6), 6
+mov L1[-c1/c10], r2
+mov #13--c10/(c13), r4
+.data 7, --15, c2, 20
+.define c4 = c1
+.fill 1, 0
+mov #(2/c10)-c14, r7
+prn #c4+c4/16/c6
+mov #c14*c13*(17/c6), r7
+.define c3 = -c1-c13
+L18: prn #-20-c13/11*5
+.data -3+c12/c4*c4, 4*c13*0+18/-18
+L19: mov #c10*c15+-c13+(9-c5), r0
+.define c14 = 7
+.define c10 = (14+15+(19))
+.data 19/c3*2-c13+c14/1, 10
+.data 13, 13
+mov L19[-c4], r2
+.data -c1+4+10
+mov L6[c13/11/8+c13], r2
+.define c1 = -12/c15/-c13
+.define c14 = c10 + nope*0*c3
+mov #c1, r0
+.define c2 = 11-1 + 11/12/c13/-c4
+mov #((c13))-c14, r1
+mov #6, r1
+mov L0[-17*10/c1], r2
+mov #(-7-12), r4
+mov L0[c13/c14+7*20+-14], r2
+mov #13, r7
+.data c1-19/4-6-10/c12*3, -15+11/5, 11, -c13/c4/18
+L20: mov #(c1)-3, r5
+.define c4 = -20 + 8*-c1 + c14
+mov #2, r0
+.data (c14), (5*13/X9+5)
+.define c14 = c1
+.data -(14)/5, ((9))-(c14-c14)
+mov L9[15], r2
+mov #6+(c10+c1), r3
+.fill 3, (c1*c6)-c2+c13+c10
+.data -c14/c10*19+18
+mov L9[c13], r2
+L21: mov #-c4+c13, r6
+hlt
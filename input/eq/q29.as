@@ -0,0 +1,91 @@
+.define c0 = -13*15+14*-1
+.define c1 = 18
+mov #13, r7
+mov #-(c0)/5, r5
+prn #c0+c0+11-16+9+c0+c0
+.define c2 = 7
+mov #c0, r1
+prn #--10+c0/9
+L0: .data c2+c1/14/1, c1, --c0
+.fill 3, c1
+L1: mov #c2, r1
+L2: mov #c1*5/5+10*c0-c1, r3
+mov L0[1-15-7/5], r2
+mov #(c2), r5
+.data 1
+.define c3 = c2
+L3: .data c1, 5, (12), 0-c2-(11)-0+c2*8
+L4: .data c3*19+c1+c1, 16+19+c0+4, c0
+.data ((18))*-c2*c1*c3
+L5: mov L5[---c1], r2
+mov #c2+7, r0
+cmp #--c0--c2+(c1), L4[17]
+.data c2, -(17)/3, c0*18+c0-7+-c1*c1
+mov #(4), r3
+.data -0*c2*5, c2+c3-8*c0+c0, c2*c3*18/2, 3
+L6: .data c1/3, -19, c2, c2
+L7: mov #c3+9*6-c3, r1
+L8: prn #c1+(11)-12*c0
+.data c2, -13*c1*c2, (-c3*9*c0), --c3+c3
+L9: mov #--14*-c0, r3
+cmp #17, L7[c0]
+.data 17, 0+12*(0)/1
+L10: prn #18-(c0)-14
+L11: mov #1, r4
+mov #c2/3, r4
+.define c4 = 0 + 8*-20
+prn #(c3-c4)
+mov L10[c3+c0/5-c2], r2
+mov #-11-7--13/5, r7
+prn #(2)*(c0)+14
+.define c5 = c1*c1 + c4*11
+mov L1[c4], r2
+.data 17-(c1)-(c3+18), 4/10*12+c2-c4-c4-c2, --c1*11+15, 1*c0
+.define c6 = 0-13/4-14/9
+L12: mov #((20)*9*c0), r0
+mov #c6--c0, r2
+L13: mov #c5, r5
+mov #-(6)-6*c4, r3
+prn #12*c3+7/14*(16)
+L14: prn #(6*3)-c2
+.define c7 = 17-7+c4+20+-c5-c3
+mov L14[(c2-15)/3], r2
+.define c8 = -8
+prn #-c1*c8+-c3--c8
+L15: mov L6[c8], r2
+L16: mov #c1, r3
+.define c9 = -5/2-c1-c1
+.define c10 = (c1*16)-c1
+.define c11 = c3-3*c0*8-20
+.define c12 = 2
+L17: .data 1+15*-c11+0*-c0, c11, c8+2*c2+5
+L18: mov #-c6, r6
+mov #c2/4, r4
+.define c13 = -c2-c2/2
+.data 2, c13, (c12/1), ((2)*-c12)
+mov #(c9/5)+7*c11/4, r5
+L19: .fill 3, -7/17-c13/7
+L20: cmp #9*c7+6+-8--6, L14[13+1+c1/2-10]
+mov L15[-c3], r2
+cmp #1-c2/5, L17[8+6/1]
+mov L9[c1/3], r2
+prn #6+7/5/4
+L21: prn #(6/4-c12-0)
+mov #9, r3
+mov #5-8+c2-18+c7/2--c12, r4
+.fill 2, ((c13))-8*c12+2
+L22: mov #c10/2, r1
+L23: prn #(17)+-c8*-16
+.fill 3, 9
+mov L1[(7*c9*17)], r2
+L24: .data (c11+c5*-12)
+mov #--13+c4, r7
+.define c14 = 3
+mov #-c11+-c5+c11, r3
+mov L23[-14/3/1], r2
+L25: mov L18[8], r2
+.define c15 = c0/20
+mov #1/2, r0
+mov #c10, r6
+.data 19
+hlt
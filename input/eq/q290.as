@@ -0,0 +1,90 @@
+prn #20-3
+prn #-18*9
+prn #-4*16*19
+.define c2 = (8-5 + 10)
+.entry c2
+.fill 2, -c2/c2-4-c2-12/0
+.data (10/-c2), 8, 1
+.define c13 = (c2*c2/0)
+mov #3, r3
+L0: mov L0[c13/(c13/X9)], r2
+.data (18+19)-6, c13*4*11*16, (-c2/c2)
+.define c13 = 11/15
+mov #L0, r5
+.fill 2, 9
+.define c15 = -0-(c13)
+mov #6, r4
+L1: prn #c13-c15-c13/c13/15
+L2: prn #(c13)*-8/c13+14*L0
+.data 17
+mov #c13-c13*c15*(c2), r0
+.fill 3, c2+--17
+mov #(18), r4
+.data c2*20-c13*(c13), 3
+L3: mov L3[4], r2
+L4: mov #c13+c13+c2-c15*2, r5
+.define c4 = (-c13/c15)
+.data 4, -c13*3*1, c2*c4+(18)*c13
+mov #(1)*(c15)+c13, r7
+mov #(2), r6
+L5: mov L0[(1/19/20)], r2
+.define c7 = (8/c2)/1
+.define c10 = c7+c2+17/7+c13-c13-c15-1
+L6: .fill 2, 16+c13+-c7+c7
+.data X9/2*5/c7, (c15*2)+(c7)
+.fill 1, -c7-c10/c2*c4*3
+mov #7, r1
+mov #(L0+c4--10), r3
+mov #c13/-9+c4, r3
+mov #c13-c2*-c10--0, r2
+.data (c13)/c13, c4*(9)
+.define c4 = c13
+L7: mov #16, r6
+prn #13
+mov #-c10+0*-c13, r4
+.define c7 = nope*c7*c13-9-c15
+.data 1
+.entry c15
+L8: .data c2*c13+7/8
+L9: mov L2[c7*(20)-5], r2
+L10: prn #c13-15*c13*c2--4
+mov L6[c7], r2
+mov L4[(-4+0)], r2
+prn #-c4/c10*c13+c13
+mov #(c2+14)+17, r7
+.fill 2, 3-c4/c13+c2
+mov L5[X9], r2
+cmp #15+c13/2/6+3, L7[c10]
+mov L9[1], r2
+.data (((c13))), 4, c13, (20-0/8-c7)
+.data c2
+L11: mov #16, r4
+L12: mov #6, r4
+.define c5 = (10*c7-(2))
+.define c4 = -8+(c5)-c13
+.data -c15+c5/(c2/c5), 14-c7+18/8*(-5), 1+9, c4+c5
+L13: mov #9, r0
+mov #c5-17-c4-(c2-c4), r1
+.data c7+c15+c13-(c4)
+.define c13 = 1/3 + c4*c7--18/7
+mov #6, r4
+mov L11[12*7], r2
+mov #-c7+c13*10*11, r7
+prn #6*L0+5-c13/c15
+.fill 2, -c10
+.define c11 = c7
+L14: mov #18-6-6+c7, r6
+.data c10+8-8*(11), 11
+prn #-c11-0*-7
+.define c6 = 16-13-5 + 11
+prn #(c13--c7)
+prn #20
+mov #c15-c15+(8), r3
+L15: cmp #c10-(c4), L15[18+-1*c13]
+.define c2 = 12*20*14*c6 + -14*16
+.data 20, -18-c13+c11, c4, ((4/17))
+cmp #c7, L14[c13-c7-13/c5]
+prn #(c4+19/8)
+L16: .fill 2, (19/16)+-(11)
+.define c4 = -20-c2 + 18
+hlt
@@ -0,0 +1,105 @@
+mov #5+-19/6, r3
+.data 7, 8, (20)-19+12+2/5-20
+mov #(-19)+17*18/14, r1
+prn #12-20
+.define c4 = 20--16-10
+L0: mov L0[(-c4/c4+12)], r2
+.define c4 = 1 + 0
+L1: mov #5, r2
+.define c9 = c4
+L2: .fill 2, 3/5/c9-c4-c4-(c4)
+L3: .data 7-c4+c4-16, (c4+16+c4)
+L4: .data (14)+1*c4, 1*3*1/c4--16, -15
+prn #((c4))-5*-15
+L5: mov L5[6], r2
+cmp #11-c4*c4-c9, L4[9-c4*6-c4+c4]
+mov #c4-c4+3*1/13*c4, r0
+.define c12 = (16)
+mov #c4+c4/c9, r5
+prn #c9
+L6: mov #c4, r2
+.define c11 = (c9+1/-c12)
+.entry c4
+L7: mov #c4+--c9, r2
+mov L1[c11--c12/-5], r2
+.define c4 = (6*10)/5/14/6
+.data 18, 20
+L8: mov #c9, r2
+mov L5[15*c4], r2
+mov #c12*c9*c11+13-c12, r7
+mov #-6*c4*c4, r7
+mov #8, r7
+.define c6 = (-c9*(6))
+.data c4+c11/c4-5/c6/10, (c12/0)*13*12-20+c9, 16/2*c4*(15)
+.fill 2, c4
+.define c4 = c4*20/c4-c12
+.define c9 = 19
+L9: mov L6[(c4)+c4+9+6], r2
+prn #3+12-c12*c12
+L10: .data 1+c9/c11*-4
+L11: .data 1
+L12: prn #16+5/10/14-c9
+.define c0 = 0
+prn #X9
+L13: mov #((18)/7/c12), r5
+mov #1, r3
+mov L12[c4], r2
+mov L1[13-14/11-(15)/c0/c0], r2
+.define c10 = c11*15/0*20
+mov #12-c4-7+c9+6/0, r5
+mov #2, r7
+.define c10 = 6+14*-L0/13
+mov L5[(18-6+c6)], r2
+.data -(c9)*-(c0), c9-1+-c4*14, 16-13+c11/12
+mov L3[(c4/c12)+0/4+c10], r2
+mov #c0, r6
+.define c1 = (15-14*c4)
+L14: .data 8, -14-c10-c4+12
+.data 9*5+c4/c10-c12+c4
+.define c15 = (c6*c9-(3))
+mov L4[c4*c10], r2
+cmp #c4, L13[c9*c4+19/-13/c0]
+mov #-c12/(c4)-3*c0/(c9), r6
+.entry c11
+cmp #-8/(c4), L13[-1*c4]
+mov L1[12], r2
+mov #8+c4, r3
+.fill 3, 17
+.entry c12
+L15: mov L7[--(c6)], r2
+mov #c4, r2
+.entry c10
+mov L5[12], r2
+.define c1 = 15
+.define c14 = 17
+cmp #(20), L13[--0/-c4]
+L16: mov #-13/c1/16-c11--c4, r4
+.define c6 = c6/((15))
+L17: .data c10, 14+5+8-c6-18
+.define c3 = 16 + 6*c12
+.define c2 = -c14*15/13*(c4)*c4
+.define c15 = c1*-4/L0/c3
+.define c5 = 12
+mov #-8/1/-(4), r3
+L18: .data 1-c0*c0-c1+c4, 8, 0, 10
+mov L15[c4], r2
+L19: .data 15, -(c2*7), -1
+.data (5/1+(4)), L0/4-14+20*0+4/X9
+L20: mov #-c15-c1-9, r7
+L21: .data (13+c10)/6--14, (c6)*c5+19/8, (c3)
+.data (0-c4)*c0*L0*18
+mov #c6*X9, r6
+.data c15
+.define c2 = 0
+mov #-16+c4-c12-c11, r2
+.define c2 = c15 + 16 + -c10*18 + c11*X9
+.data c14, 13, -c12-4*(2)
+L22: mov #5, r7
+.data -c4*3, c1+10*c4*c1/(0)
+L23: mov L7[18+c10-16*(14)], r2
+mov L16[c15-18], r2
+mov #-8/-17, r2
+.fill 3, (-c4-19)
+.data -(c1)+--c10
+.data nope
+hlt
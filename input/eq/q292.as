@@ -0,0 +1,119 @@
+.define c10 = 18
+L0: .data 5-c10/19+15, c10*18+11*-0, 5*2+(4)/7/12+12/9, (-(c10))
+.define c9 = 13
+.define c8 = c9-c9-9/c9
+.entry c8
+mov #c9/c9/-c9-11, r4
+L1: mov #(c9)/3*11-6, r4
+mov #2-20+c8-c10*c8/c10, r3
+L2: mov #(-15*c8), r5
+.define c11 = 9
+.data 7+12+19+17--19-c10
+.define c3 = -c8*-c8*c11
+L3: mov L1[8*c8*c11*12+(15)/16], r2
+L4: .data c11+c3+(18)
+L5: mov L3[(c3)*4+(8)], r2
+mov #c9*0-0/(c8), r6
+mov #-5/c8-c11-c11+c11, r3
+.define c5 = 9
+mov L4[12+c9], r2
+.data -c3*c5-c3/2, c8/7+c9-c9, 8, 18/c3+-20*c9
+.define c14 = c8
+L6: mov #16, r7
+.entry c5
+mov L1[(c10)*18+c11-1-0], r2
+mov #18-1, r2
+L7: .data -(c11/0), 4, -c3--c11/c3/(7), (-c10+11)
+.fill 4, c8*10*14-8*c11
+L8: .data c10/18+4/10*c5/c14, 4, -11+c5+c11
+.define c6 = c8*c9 + 6-9 + -c9/-c5
+mov #--19/18, r7
+mov #2, r1
+L9: mov #-(18)/9, r7
+.entry c11
+cmp #-c5, L6[c10]
+mov L7[5*c10*c10/5], r2
+mov L6[17], r2
+L10: mov L10[0+-c3/19], r2
+L11: .fill 3, 16
+L12: mov L5[(-17/9)], r2
+L13: .data -(20)*-(c10), c14, c3+c14
+mov #3+6-c5*7, r7
+prn #c3/c10
+L14: mov #c9/(0)+c11, r6
+mov #7, r4
+.define c5 = (c5)*-c14*c10/c3
+mov #c11*2*c8*19+11, r4
+.define c1 = 1+c5/-18/20+c8+10/8
+mov #c5-11*2+c10*0/16/9, r5
+.data 1*c8-19+10/17/c1, 8+c11/20*19/-c11, (18), c6
+.fill 1, c8
+.data -c10/14*4*c11, -c3*c1+c1/c8, 3+(13+c6)
+.data 18, (c1+c5+c11), -12
+mov #c6/(c11/c6), r2
+L15: mov #-18/20/(c14*14), r0
+.entry c11
+.define c12 = (-7 + c8)
+prn #c3
+L16: .data c5-5-(4)/10/19
+L17: mov #-c3-c10/20+c1-20/19, r3
+mov L5[10], r2
+L18: .fill 2, 5
+mov #c5, r0
+.define c10 = c1
+L19: mov #-13-1/c5, r7
+L20: mov #2, r5
+L21: .data -17-c12-c10/4, (1)/2-c12/c5, (c5*c11), c11*c11
+L22: mov L18[c3], r2
+L23: .data (c10*c6)
+mov #c5/c1+c5*c8+c6+-c10, r4
+mov #9/c6, r7
+.data 4
+mov #c8-11/c8+c3*c8, r6
+.define c3 = (c12*12 + c1*c11)
+.define c14 = 9
+L24: mov L9[(8)/-2-7], r2
+.data -(1+c9), 10*11/-c14/2*2+4+0, -17
+prn #9
+mov #6, r5
+.fill 2, c5/7
+mov L11[12*-15], r2
+L25: mov L25[((10)/-2)], r2
+prn #c12
+.define c15 = c6
+mov #-7, r2
+mov #(c11/19)-c3+(10), r5
+.data 4, -5
+mov #c14+13*15+c9, r4
+L26: mov #c11+-3/c3, r3
+L27: mov #1-11+c14*c3+2*-4, r3
+L28: mov #19+((9)), r7
+.define c11 = (5)/2/14*c5
+.data -14-8+c6+9*c11, (--c9), (c14)*c9*c3/2+13-14, 13--2-c11
+.fill 4, 11+c14+c12
+L29: mov #(2)*c12, r0
+L30: mov L28[-c3], r2
+.define c13 = -5/c5+L0
+.define c4 = 15
+mov #3, r2
+mov #--c14-2, r5
+mov #-c6/10/c3, r7
+mov L29[c12], r2
+.fill 4, -17+16/-4*11/c5
+.define c10 = c14*c4/c4-13/c4+c12+c3
+.data c10-c5*c5-0*1
+.define c7 = 17
+L31: mov #(-19/c5+c3), r2
+L32: cmp #(4), L7[c11-c5*c10]
+cmp #c14, L9[c9]
+L33: mov #(15*c13)/-c8*(nope), r6
+.define c4 = 19/8-(c11)-16
+mov #-c14, r3
+L34: .data 20, 4, 9/16--(7), 1+14*2-6+-18-1
+mov #c7-7/c14*11*6/5, r1
+L35: mov L3[(18-c10/2)], r2
+.define c12 = c12
+L36: mov #(10/6+(c4)), r0
+L37: mov L21[c6/-19/c5], r2
+L38: .data 12+c10*17*7+-1
+hlt
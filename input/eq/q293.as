@@ -0,0 +1,82 @@
+L0: mov #(6)+17+(16-15), r6
+.define c4 = (0)/11-2
+.define c11 = c4
+L1: mov L1[3], r2
+mov #c11+(c4), r4
+.define c10 = c4+c11+c4/c4/c4-c4*4*6
+prn #2-(0)+c4
+mov #(c10), r2
+L2: cmp #c11--c10, L0[c10]
+L3: cmp #2, L1[-16/-c4*c4/8+0]
+L4: mov L0[-12], r2
+mov #-c11-1/(c11), r7
+mov L1[c11+c4+5*15], r2
+mov #(c10+17)--16, r4
+.define c9 = c4
+L5: .data 19+c11+18+c11, -c9-c9, X9*15-13-c4, (1)
+mov L4[c4*(17+c11)], r2
+mov #-(10*14), r0
+L6: prn #c11
+mov L3[c11], r2
+L7: .data -0-c9+c9-0-c4*4, -(1)
+mov #14+0-c10-7+14, r0
+mov L0[12/X9*13+1], r2
+L8: .data c10, c10, c10, -c4*15/20+15
+mov L7[6/c9*c4+c11], r2
+mov L3[(c11+13)+c4], r2
+.data 10, (c10)-6-L0/1, c4, c9/--c11
+.define c9 = -(14)*4
+.define c10 = c9
+.data -5--15
+mov L6[-c10-c4+X9], r2
+L9: .data 18+c10/c9*11
+L10: .data c9
+.data -(14)--c9, 0
+.define c1 = -c4
+.define c5 = c4
+mov #X9, r1
+mov #19, r7
+L11: mov #c5, r4
+mov L5[c10], r2
+.entry c11
+L12: mov #c5, r2
+mov L3[-3-c1+c11-c4+0], r2
+L13: mov L0[10*c9*c4], r2
+prn #17
+.data c10, 1*c10, 0+8--c5-12-(6)
+L14: mov L3[c11], r2
+L15: mov L8[--c11*c10], r2
+L16: mov #9, r3
+mov #c10/15+5*c10+c10, r5
+mov L15[7], r2
+.entry c10
+mov L12[(18-c5)*-c10+c1/15], r2
+mov L11[15*c1+c4-(c10)], r2
+L17: .data c10-c1+c10--c10, 8/(8)*c11, c11-c4*c10, 14*c10-4/15
+.define c4 = (c11*c11-(13))
+L18: mov #-9*4, r1
+.fill 1, c9-4*c5+4
+mov #13, r7
+L19: .fill 2, c10
+mov L14[-c10-19-c1], r2
+mov L17[8], r2
+prn #c11
+.data -11+c11--c9, (c9/c4*20), c9, 10-1-14/c4*7*11
+.data c10-c5-16/-c5*-c5
+.entry c5
+mov L0[(-2+15/3)], r2
+mov L9[-c4/9*c4*7], r2
+.define c9 = c10+c1
+.define c1 = 2+c4+-15/-c10
+L20: mov L17[c11], r2
+.data c9/9--c9+13, -c9-2-12/12-c10
+mov #19-c9-c9*(c5+7), r1
+.define c11 = c9+8
+mov #(c9), r2
+L21: mov L17[-7+c9+9*8], r2
+mov #10+-5+1, r5
+mov #-(c5)+c9+c9, r5
+prn #-0*-c11
+mov L20[L0+-c10-(c5)], r2
+mov L18[3+9/c11-c10--c11], r2
+hlt
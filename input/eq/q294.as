@@ -0,0 +1,43 @@
+.define c2 = (14/-19)
+mov #c2, r2
+.define c6 = -c2-c2*c2-c2
+.data (4-2)
+mov #(c2-c2)*(8), r3
+.define c2 = (5)*(4)/2
+.define c13 = c2
+.define c4 = c2-c2/c13/(17)
+.define c12 = c4--c2+c2
+.data -((c2)), 3
+.data -2, 18/--c2, 15/(c4), 4
+.define c2 = 13/c12+10*c6*c12
+.fill 3, 12+c12/-16*(18*19)
+.data 19, 9, c12-c6+c12+c2-c6, 9
+mov #-4*c13+c13, r2
+.data 3-20*8*15
+.entry c2
+.entry c12
+.entry c13
+mov #-5, r4
+mov #10, r7
+L0: mov #0, r1
+L1: mov #0-c2+17*17/11, r1
+L2: mov L1[c2], r2
+prn #c13/9/X9+3
+mov L2[(20)/19+15/4], r2
+.data (c2), c12, (c2--c2)
+L3: .data 0, c6
+.data 3, -c4-c4+c12+c6/6+c6
+.define c15 = 19
+.data c2*19-c2*-4
+L4: mov #10, r1
+mov L2[--13*18-16], r2
+L5: mov L0[(c12)], r2
+L6: mov #c2, r5
+L7: mov #c6, r5
+.define c5 = (c15)
+mov #11, r1
+.define c11 = c6
+L8: mov #8, r0
+.define c15 = c12*c2
+mov #(10)/c2*12+(c11), r3
+hlt
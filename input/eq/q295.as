@@ -0,0 +1,57 @@
+prn #7+9/7
+.fill 4, 4
+.data 3, 2-15+(0)/0, 14
+L0: prn #4
+.define c10 = 13-20*-16*7
+.define c0 = c10
+.define c10 = (((3)))
+L1: .data c0-20*(19)+c10, (c10)
+.data 5, c10/-11, -10-11*16
+L2: cmp #17+-(c10), L0[4]
+.entry c10
+L3: mov L2[c10-4*c10/c10], r2
+L4: mov #(c10)-c0, r6
+mov L0[c10-c10*c10-3/13/c0], r2
+mov L3[c0], r2
+.fill 2, (-c0*6)
+.define c14 = L0*c0
+.data (c10), c10/17*c0-c0
+mov L0[9], r2
+L5: mov #(c0+X9)/-(4), r0
+.data c10
+mov #-c0, r7
+L6: .fill 2, 11*1-(2)*c10
+L7: prn #c10
+mov #4, r5
+.fill 1, c10
+.fill 3, 4+c10*9+c10+18
+.define c15 = 6/c10 + 7-13 + c10 + c0-18
+.define c6 = c10
+.define c11 = c10
+mov #4*c15*11/(-c6), r2
+L8: .data c10-c14*c6/7, c14*c10, -c14-c10-8+13, 0+14*-(14)
+.data 20--c10*19
+mov #(c6-c10)-c6, r7
+mov L6[c0], r2
+.fill 3, c15
+.define c8 = 12 + 6*c10-3*(0)
+mov #c15+c0+-c14/c14, r7
+L9: mov #(c10)+1+c15*15/c6, r5
+mov #(15*11*18+c10), r5
+prn #6
+L10: .data 19+c15*7*(2), c8
+L11: mov L10[-c11], r2
+.define c7 = 12
+.data c10, c11*c6
+mov #(-2+16), r4
+.data 3, (c8/c8)/13, c7/c14-c0/17*11*1
+.entry c10
+mov #c11-(c14), r2
+prn #c11
+L12: mov L7[9], r2
+mov L2[9+c15], r2
+.define c7 = (c10)+(c10)*c10
+mov #2*-3-c7/c10*c8, r7
+.define c6 = -c15*c10/c0+-c7*c0
+.define c11 = --c15
+hlt
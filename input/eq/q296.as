@@ -0,0 +1,30 @@
+L0: prn #13*16-6-13+(4)/0+5
+cmp #-14+13*5, L0[nope]
+.data 16
+.data 8, --8-20, 10/(19)+10-13
+.data 17, 10+19/11-5, -0-5+13*19*14
+L1: .data 0-20*0/18/1-4-1-16, 10/1*-6/-9/-12
+mov #7-(13)*(13), r2
+.define c14 = 9+X9+(1)+8/4-3-19
+cmp #-13+20, L1[2-c14+c14/0]
+.data -0*7/(18)/c14*9, 6*c14
+mov #c14, r4
+.define c9 = 19
+.define c6 = -17
+L2: .data c6, 19/c14
+cmp #18+c9--0, L2[c9/c9-X9]
+mov L0[0-3], r2
+.define c13 = 7*18-8-c9*c14
+mov #(15+20)+(c14)*15, r1
+.define c3 = 1-16/12+c6-c14
+mov L2[c6], r2
+cmp #4, L2[16-2-13/c6]
+.define c6 = c3 + --c13
+.define c2 = (18)
+.entry c6
+.data 7, c3, -c2-2/(10)
+prn #c14
+mov L2[1*c9], r2
+mov #9-c2/13/c14/c6, r6
+.define c1 = (1)-3+10/c14
+hlt
@@ -0,0 +1,88 @@
+.data 3, L0, -(11/12), 6
+.fill 4, -5
+L0: .data -11+12/17-3*0/16, 17+8--4/6, 0
+.data (6)*18+8+nope+9/7*3, (((12)))
+prn #3
+mov #13*-L0+18-11*17, r7
+mov L0[19], r2
+mov #5-3+8/19-13/19/X9, r6
+.define c2 = 12
+.entry c2
+L1: .fill 4, 0+c2/19/-c2
+.entry c2
+L2: .fill 4, c2
+L3: .data 6, 7+c2*c2-2+15/c2/(7), 19-c2+16-7/c2, 11
+mov L0[((c2)+(c2))], r2
+L4: mov #-c2-c2--16*11, r3
+.data 11*c2+11-11+c2, 15-15, (c2+6), c2
+prn #11
+.fill 3, 0
+.define c9 = c2
+L5: mov #c9, r5
+L6: mov L3[c9+13-12*1-c2], r2
+L7: prn #-c9
+mov L2[(c9)-(X9)+16/c2-7], r2
+cmp #(c2), L0[c2]
+.define c8 = 19*X9/10 + c9/c2*9/4
+L8: mov #-c9, r0
+mov L5[5*(c2)*c2*L0], r2
+L9: mov L4[-c9], r2
+L10: .data c9*c9+c8, X9/20, 15-c9/c9
+mov L0[14], r2
+.entry c2
+.data 13*c8/-c8*((17)), c2
+mov L10[c2], r2
+mov L2[(c9)], r2
+.data 18, (c9/1/c9*11), 2
+mov #c2, r5
+.define c5 = c8
+.data c9*c5-(c8)-c2*c8/8, 8, (6)+3
+L11: mov #6+c9*11+c5, r5
+.define c13 = (7) + c9*c8 + 12*c8*c2
+L12: mov L6[5], r2
+.define c11 = c2*12-19 + 3/18/10-3
+cmp #3, L2[((c13))]
+mov L4[c13-16/c11+(10)], r2
+mov L0[(c2)*c2/-(18)], r2
+mov L7[15-c5-c9], r2
+.define c9 = c13*c13+c8*13/3*9*c2+0
+.entry c11
+mov L12[11*13], r2
+mov L8[c2], r2
+.define c12 = c8*9-c5-c8/c8-20
+.define c11 = c9/c12+c11-c9
+cmp #(12*13-10), L9[(c5/8+(c11))]
+mov #2, r6
+mov L4[13+c12*c8*-19*20+11], r2
+.define c7 = c9
+cmp #c11+8/12/19-17, L8[-3*19+20*c13]
+mov L6[(c2)], r2
+L13: .fill 3, c12
+.define c12 = --14*-c2
+.data 15, 15/16, c11
+mov L0[6], r2
+.fill 3, -16-6/c2
+.define c8 = --c5/12*13/9*c11
+mov L9[-15], r2
+mov L5[c2-7+11+c2/c12], r2
+mov #-14*c13*-1+19, r0
+.define c1 = 1
+mov #4-19/c11-c12+c12-17, r2
+.data L0-11*c8-20-c2
+.define c1 = ((c1))
+prn #(c12)+c12-13
+mov #3*10+18/c1+c1/12*X9, r4
+mov L4[-c13--15], r2
+.data (--18), c13, c1+c9*c11/c11
+mov #(c8/c11)*c8-11, r1
+.define c14 = 19
+.define c7 = c12
+L14: cmp #17+c11/c1/c8*c1, L3[--c1-14]
+cmp #c5, L5[-5/c7/c2+c1+-5]
+L15: .fill 4, (c7)-11
+L16: mov #c9, r5
+mov #c1/13/c9+5-c5, r7
+mov #9, r7
+mov L6[8-(c14)*17+c5], r2
+mov #--c9/1, r7
+hlt
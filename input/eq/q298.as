@@ -0,0 +1,47 @@
+mov #(5*1)*13*0/(17), r5
+.data 20, -11*10/8
+.fill 4, 10-12
+mov #(11)+12, r6
+prn #-(20)/16-14-7
+L0: mov #17--10, r4
+prn #((X9-17))
+mov L0[10], r2
+.define c3 = 4*6 + 4*X9
+mov #c3, r5
+.define c10 = (13) + --7
+mov L0[-6-2*(11*9)], r2
+prn #9
+.define c15 = c10
+.data -3+16-3
+.data 5, c10/17*c15+14, (c15/c10)-20, c3
+L1: mov #(c10), r4
+L2: mov #0, r0
+cmp #c10, L1[(c10)*c10+12]
+.fill 2, (c10)/c3-18/16+2*9
+mov #c3--c3, r3
+.define c13 = -19
+L3: .data 3
+.define c5 = 12-3+c10-c10+(c10*15)
+.define c5 = 8 + 14/c15 + c10*12
+.define c7 = c3-c5-c13--0
+L4: .fill 4, (c5)+14+18-4-6/(4)
+.define c7 = 10
+mov #c7, r1
+L5: mov #11--12+2*c15, r2
+L6: cmp #(19*1)*7/16/c3, L2[-20/c15*(c10)*-c10]
+.define c15 = -(c5-8)
+mov L2[-c5], r2
+L7: .data c3*15*c15*c5*7, 6-c15-c15-c3, 8
+mov L6[15+2-6/2-(19)-c15], r2
+mov L3[-(7)*12/c5], r2
+L8: .data c7+9*17/c7+7
+mov #c5*-1+10, r3
+mov #(12)-c5-c5-7+4, r5
+cmp #5, L8[c5]
+L9: .data c7
+.define c5 = -17
+prn #c3+(12)
+L10: .data -20-12+-c5, c7+4-9-6, 6
+mov #0, r4
+L11: .data c7, c5/17+8--9, 18, c3
+hlt
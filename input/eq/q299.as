@@ -0,0 +1,67 @@
+L0: mov #(12*7*12+15), r3
+cmp #4, L0[8]
+mov #16-6, r5
+mov #8*15*6+4-10+L0*16, r3
+mov #-14, r5
+cmp #(8)-18/10+1, L0[8+nope*4/18*5]
+mov #-20, r2
+mov L0[18], r2
+.data 10/-12-0*15+14+6
+.define c8 = (15+1)*(7)/18+9
+.data 8*-c8, c8, -(c8)+-16
+mov #c8+c8*c8+c8, r2
+.entry c8
+prn #16*14/(c8)
+mov #c8, r0
+prn #-15*c8/14
+.define c8 = (-c8) + c8
+mov L0[16+-15*0], r2
+.define c2 = (10)*(4)*c8
+.entry c2
+.define c6 = -c8*c8/c2-c8
+mov L0[-c8+c8+c8], r2
+mov L0[-4-c8+13*9/c2/11-c8], r2
+.fill 3, (20/8-3)
+L1: prn #7+18+-c8/7
+L2: mov #c8, r5
+mov L0[-c8], r2
+prn #-c8
+cmp #15+18/8/(17/9), L0[16*2+13*2--17]
+L3: .data -c2/3-17, c6, -c2/c8/c6*11+15*c8
+.define c1 = c8
+prn #c8
+.data -c8*14-(20)
+L4: mov #10/c2/c1--(c2), r7
+mov #c8+-2+12+15, r3
+L5: mov #15, r7
+mov L5[c1*14-17], r2
+.define c1 = 20 + c8
+mov #0*6/2-c6/13, r6
+mov L5[c6/c1-(c1)*3], r2
+.fill 3, 14
+cmp #-9, L3[c1]
+L6: .fill 1, c1--1
+.define c9 = c8
+L7: cmp #c8, L0[-16+(11)]
+L8: mov #((c1)), r2
+.data ((10))+(c9)-7*c9
+.data c2/18-c9/c9, --17*-c2*12+1
+.define c11 = c8
+.data 20-c1, c8*(c8+11)
+.fill 1, c1-14-15-(9-c8)
+mov L7[-2*-9], r2
+L9: prn #c1-c1+c8/17
+mov #c8, r0
+.define c6 = 9
+mov #9, r5
+L10: .data c8, -20/12*c6+c6, 20, -c1/c1+c11
+.data -6+17, L0, 16-14/20*6
+.define c7 = ((c11/c2))
+mov #3+9, r2
+.define c12 = c8
+L11: mov #--c2--18, r4
+L12: mov #14-c8*c8/11*12, r2
+L13: mov #c6+(8), r0
+L14: .data -c6, c2, c11+c1*13*10*1+5
+mov #-10-c2/c9, r0
+hlt
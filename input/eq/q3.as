@@ -0,0 +1,51 @@
+L0: mov #-2/5, r2
+mov L0[(8*4)*(18/13)], r2
+prn #3-18+18-10*(10*13)
+.define c0 = 13+-4
+L1: cmp #-12/3+-c0*9, L1[(20*c0+c0*7)]
+.define c1 = --c0*c0
+mov #---9, r6
+.define c2 = -c0 + c1--7
+L2: mov L2[(c2)], r2
+prn #(c2-c2)-(c2)*8+c0
+.data c2-c0-18*c0, 1, 4+-3+-15
+L3: mov L3[c1], r2
+mov #c0, r0
+L4: mov L0[2], r2
+mov #c1, r6
+mov #c0, r2
+mov #-c1, r7
+mov #-(c0)/10, r3
+mov #c1, r2
+cmp #-15+3*16, L1[c2]
+.define c3 = c2-17-c2*18 + c1
+.define c4 = 16/2/5
+mov #4, r5
+prn #(c0-20)*-4/5
+cmp #1*c2+(c0), L2[c1]
+.fill 1, c2
+.define c5 = -15*c3
+L5: mov #3, r7
+cmp #11, L5[18+1*10/20]
+mov L5[c4/1*c4/2--20/4], r2
+.data 6/18+c3/5, (c1)*7/1--c3-12*c3, c4+c4-19-20
+.define c6 = --10+1
+L6: .data (c3/17/2), -(c4/3)
+.data (c3)*14-c0-c4
+L7: .data c3
+.define c7 = c3
+L8: .data 0*c6*(c5)*14
+.define c8 = 15
+mov #15, r5
+mov L0[-12*12/1], r2
+mov L2[-(15)], r2
+.data (10)+1+20+0, --6+c1, c2, c1+2*c0-1-13+c3
+mov #c1*(c8+14), r5
+.data c3*(c1-1)
+mov L7[c3+c8/2/4], r2
+L9: mov L6[c3], r2
+L10: mov L1[(7*c7/4)], r2
+.data c5, c0+c7+(c5)*11-c7+4, c2
+prn #c6
+mov #(c2)/5*c7, r1
+hlt
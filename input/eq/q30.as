@@ -0,0 +1,90 @@
+prn #5-(7)+-2
+prn #(-9)/5
+L0: .data 15*7/2+20*2/3, -(12*12)
+.data -14*20-10*6, 13-(0)-10/5, -(3)+-10*19, -3/2
+.define c0 = 16
+cmp #11, L0[c0]
+.define c1 = 9-(c0-6)
+L1: .data (11+c1/5)
+.define c2 = -c1/1
+.data 16, 20, c2/12, -(c0)*c0/19
+mov #20, r3
+L2: .data 19
+mov L2[c0], r2
+L3: .data -7
+.define c3 = 19 + c0*11*8
+.data c3+19, (5-3)+c3
+.define c4 = c3
+L4: mov #c2+c0, r5
+.define c5 = c2
+.data c5/4*20-20, ((-c2))
+L5: .data c5*c1*c3/2
+.define c6 = 18
+.define c7 = c0*3-12-7+3
+.define c8 = 0*c2+14/2
+L6: mov #18*13+c7, r7
+cmp #(c5*1+0/3), L3[20]
+cmp #c0*20-c3*2+19-12, L0[c8]
+mov L1[(14+c3)+13], r2
+prn #c2/7+c7-c3/5
+prn #(19*c2)
+L7: mov #c1/4, r6
+mov #-4-c4/5, r0
+.data -c3, (9+15--c4)
+.define c9 = 16 + 8/2
+.define c10 = 18/4-11/4+(-c6)
+.data 12*c0-c8--c3
+L8: .data c4, 18*(c4)--c5
+L9: mov #9-c7, r4
+.define c11 = 2/4
+.data c5, (7+c6-14/2), (10)/13+c6/2/3, (13-12)
+cmp #-6+17-19*c7, L6[3-c10+c8+c9--c8-c3]
+.data ((13)), 18, c7/8--c2-c0
+mov L8[14], r2
+mov L3[5], r2
+mov #12, r7
+mov #c5, r7
+mov L2[(c8)], r2
+mov #c2*2, r2
+.define c12 = 1+6*c2+12+-c4/2
+L10: .data 5-7
+prn #-c7+9+9
+mov L5[9], r2
+.define c13 = (c1/1)/1
+mov L0[c9+16+17*17-20-(c6)], r2
+.fill 1, c10*9+c11
+L11: mov #c3*18/5+c5*14/1, r5
+cmp #-c13/10+-c6-17, L10[8/3]
+cmp #19, L0[15]
+L12: mov L5[c5-3*8/1+-c12], r2
+mov #(c5)/2*2, r3
+L13: prn #-c2+c13/2
+mov #0, r2
+mov #c9, r5
+mov #18, r4
+prn #3/4
+.data --5--10, 8
+.data c9*c3-c2*c9+4*0-19, -c13+20-15
+.define c14 = (17/4-5+c10)
+prn #c11
+.define c15 = 1*(c6 + 10)
+L14: .data c1/2/5, -c3/1/3
+mov L8[-c3-1-8*c14], r2
+L15: .data c4, c11, -c2-(19)-(0)/4, 14
+.data -c5-c15/1, c10+c5+c1+c8
+mov #c8, r1
+.define c16 = (13)-17-c15/4
+.define c17 = 11/5
+L16: mov L12[c7], r2
+.define c18 = c15+c6+12/4
+.data c8, 14*c0+13/4, 3-c3+c11*(20-c11), c4
+mov L12[c11*c14-c8-15/5], r2
+mov #c13, r0
+.fill 2, c4
+prn #(6)--c12+-c16*2
+mov L1[15/3], r2
+L17: .data 2, c13
+L18: prn #2
+.define c19 = 19
+L19: mov #0, r1
+hlt
@@ -0,0 +1,97 @@
+.data -8+20/3-11, 9+19, (-4)+14/8-20/8, 11+0*19+6
+mov #-nope/6/12, r3
+.define c1 = ((16/16))
+prn #3*18+8-6*c1
+prn #c1
+.define c6 = c1 + c1 + c1
+.define c13 = -(c1)
+.entry c1
+.define c7 = 0
+.entry c7
+.entry c1
+L0: mov #-(c13)+4, r3
+prn #4
+mov #X9, r6
+mov #c7+(20*16), r1
+L1: .data 13-9
+.define c0 = 12/5
+mov L0[11+2*17+15*(14+6)], r2
+L2: cmp #(c6*X9), L1[3+c0/6*(10*c7)]
+.define c7 = 1
+.fill 4, -c0/15*c0
+mov L1[(-c6*c6)], r2
+prn #c7-c1
+mov L0[5*4*c13*20+18+12*12], r2
+.define c15 = (4)+12*10*-c6+4
+L3: mov #c6, r7
+prn #c13/20+7-c1--1*5*c7
+L4: mov L3[((c7))-(c13)-c7/15], r2
+mov #15, r0
+L5: mov #4/2/c7+18-0, r2
+mov #-(18-16), r4
+mov L2[c7/c1*c7], r2
+L6: mov L2[18+1-1/(c7)*c15*c7], r2
+L7: cmp #(-16)--5+c1/2, L2[-(c1+3)]
+.define c15 = c1*(20-c0)
+prn #(-10-15-c6)
+.data c0, (c7/19)*c1/c1/c1*3, (1)*c1*20--c15, c1-c1-c15*14+6
+.entry c7
+.define c11 = c7-17*9-(20)-c7+15
+L8: cmp #c13, L6[-c7/c11*c7]
+L9: .data c1+c7*c11/c11/c6
+.data -c1, -5-c13/8*8+-0
+.define c6 = 1 + 13*X9*-c15
+.data 19
+mov L9[c15-c15+(c6)+-13], r2
+cmp #-12/c7, L3[--c7]
+mov L4[10/15/2+4*c6/c7], r2
+mov L5[c7*2+10/12-c6+-19], r2
+prn #((-c7))
+mov #c0, r0
+mov L3[(c15-c7*4/c15)], r2
+mov #-20/2/15, r4
+.define c8 = c11
+.define c2 = 13
+.data 2, 5, 9, -c15--c6/c7
+.define c13 = 17
+.define c13 = -11
+L10: mov #7, r4
+.entry c13
+.define c9 = c7*20+1-c6
+L11: mov #-(15), r7
+mov #c1, r1
+.define c8 = -c8
+mov #0, r3
+L12: .fill 2, -12/c8/5*c1
+mov L12[(c8+5--c8)], r2
+mov #2, r2
+mov L6[c15], r2
+L13: .data 17, (18)
+.fill 4, -c8
+L14: mov #-11-14+13--c13*c7/0, r6
+mov #-7*18+-14+c11, r5
+mov #-14, r3
+.define c4 = (9/0 + (c8))
+.fill 3, ((c15))
+.define c0 = -c15
+.define c5 = 3
+mov #c15, r3
+L15: mov #1, r5
+prn #--17/20
+.fill 4, 5/c8-0+c9+2/(c6)
+.define c2 = 0
+mov L2[(c2+c4/6-15)], r2
+mov #c7, r0
+.define c12 = -c13*c0/4
+.define c3 = 18/9/(c13)/-10*7-c11
+L16: .data c8, 16/(c13)/10
+.define c10 = -c8
+.define c9 = -17
+mov #16*12-16/12, r3
+L17: mov #c4/c0-(c0)/0*7, r0
+L18: prn #c13
+.define c2 = 19
+.define c7 = c9+14*c10*19+12*c4
+mov L9[10--c6+c15*c1], r2
+mov L11[(c12-19)+c6], r2
+hlt
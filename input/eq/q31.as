@@ -0,0 +1,22 @@
+mov #1, r2
+prn #12-2-14-1
+L0: .data -12*4-1/17, 16, 10--15-13, 18
+.data 9+-12*19*6, 20/3-6, 6
+L1: .data ((18*19)), 3
+mov #5/5, r0
+.define c0 = (11/11)-(19)*16/16
+prn #c0-13
+.data -c0-c0*c0+8, 3, -6-c0+18+c0/4
+.define c1 = (-(c0))
+.data 7, 10, c0, -c1-c0/1
+.fill 4, c1-16/14+c0+c1*14
+mov L0[c0+c1*3/3*c1-c0], r2
+.data (c0), 10, c1-5*15*5*12-5*19, c0*c1*c0-c1/4
+prn #c0
+L2: mov #c0, r6
+prn #(c0/20)+-19
+L3: mov #c0, r4
+mov #-c1, r3
+.data 9+1/4/5, 3*c1/2/4, c0
+mov #(c0/5), r1
+hlt
@@ -0,0 +1,30 @@
+L0: prn #6/5-(16+10)
+mov L0[(-16)], r2
+.define c0 = 1
+L1: mov #(c0+7/9), r4
+L2: .fill 4, c0
+L3: mov L0[c0], r2
+.define c1 = 16-c0/5/10
+mov #-c1*c0+(c0), r6
+.define c2 = 6
+L4: mov #c1-c2*-c2*-6+0, r0
+L5: mov #16, r3
+prn #0+-c0
+L6: prn #-20+5*19
+prn #(c0-(9))
+L7: mov L7[7*-c1-(c2)], r2
+.define c3 = 13
+L8: mov #4/4+c3, r5
+L9: .data -3, 17-2+2+c1+c2+20*c3, 8-c0-c3
+.data -2, -(c1)
+mov #2*(c0), r7
+mov #c2, r5
+L10: .fill 4, c2*14/3-1
+L11: cmp #6*c0+(c1), L3[(19)]
+.define c4 = 11
+mov #5+c4/3, r3
+mov #c2+c1, r0
+.data -17, (c2-0*c1/1)
+.data 6-c0/3+15
+.data (13-16)-c4*19-1-6, c2, c3-4*(c2)/11
+hlt
@@ -0,0 +1,94 @@
+.define c0 = 2*9/1/5
+.define c1 = c0
+mov #-c1+-3, r0
+.define c2 = c1
+mov #0*(c1), r7
+prn #(c0/10)-(8)/3
+prn #-c1+0-18*c1
+L0: mov L0[c2], r2
+.define c3 = c0/4
+L1: .data 15, (c0)-c3*c1+-c1+3/10, c1
+L2: .data -20+(c0*c0), c3-12+c2/3/5, (16)/5*c3-3
+.define c4 = -9-(c3)/3
+.define c5 = c4*c0*20-c4-c4
+.define c6 = c2
+.define c7 = c2*-c2+c6
+L3: .data c5, -(5)*-c1, -c1*5/2
+.define c8 = c2
+.fill 4, -4-c1+c5-c4/1
+.define c9 = c5 + 10-1 + 13/2
+.define c10 = c4
+.define c11 = c7
+mov L0[19], r2
+mov L3[--c2+c4-c6], r2
+mov L0[-9-16-2], r2
+cmp #c0, L3[c7*(c5)]
+prn #c5
+.data 0+c11+c11*8, 4, c9*c5+3/1, (c7)/5+4
+cmp #c8*12/6, L2[11]
+L4: mov #c1+c6/3+12, r5
+.data c10/3*c2-c9-c10, (-4+15), 18+8+(7)-(c5), (-16-0-2)
+.data 17
+.define c12 = ((c6) + 7 + c1)
+.fill 3, -c8
+.data 9-c9+c9+(19), (10*3)+c4/1
+mov L3[18], r2
+.define c13 = 14/3 + c10*c12*c9-16
+mov #(11)/3, r0
+mov L3[(-c4)+20], r2
+mov #c8, r4
+mov #c2*c11+19+c2, r0
+L5: mov #(14*17-c3-18), r2
+prn #-c1
+.data -0--c7-(15), 9
+.define c14 = 20-c2*c5*c12 + c1*-11
+.data 0, --6*3-14+2-3, 9
+mov #6, r7
+L6: mov #c14, r3
+mov #20+0*c7+c14*c13, r3
+L7: .data -(1+4), (-2)+-15+19, 7, --c9+2
+.data c14, (c4)-c3+9-c4
+cmp #((c3/3)), L5[1+c6]
+mov #(c7)/16*0/2, r7
+.data -10, c10, (4), 20/12+c6
+mov #-(10), r4
+mov #0+c12/2/3, r7
+L8: mov L0[(c13-13)*(c6)], r2
+.define c15 = (c13/3)/3
+.data 3
+mov #6+-14, r0
+.define c16 = 1 + c12 + -10 + c7 + -c2
+L9: .data -(c3/5), c10, c15
+mov L5[-c3-c3+20/4], r2
+prn #14*(c3)-(-c10)
+.define c17 = 2+c7+c10
+L10: mov #-c6/2, r3
+cmp #-17*14+c16, L2[c10*c9*17*c11/1/1]
+mov #c17, r2
+mov #c6, r6
+mov #c16, r2
+L11: prn #-c4-c4-16
+.data 4-c8+20+c7*5, (c11)-12/3*-(c17)
+mov #-12+18*c0-c1, r4
+.data c11/3, c14, --9-c5
+.data -(8-20), 18+-c6+16
+L12: .fill 4, c12
+mov #(17), r3
+prn #-c0
+prn #c15
+L13: prn #(c16)
+L14: mov L0[15], r2
+L15: mov #-(10*c3), r2
+.define c18 = 16-5
+L16: mov L8[14], r2
+mov #6, r1
+L17: mov #c14*c12+c6/17, r3
+.define c19 = 14
+.define c20 = c11*4*13 + 15 + 7*19*10-c5
+.define c21 = c6*8/4 + (0)
+.define c22 = (1)*0*4*20
+mov #19/2/11-20, r5
+mov L3[c2*(c0)--c7-19+16], r2
+.data 14
+mov L12[-19], r2
+hlt
@@ -0,0 +1,88 @@
+L0: .data 11/2, -17-12-20+1*17
+.define c0 = 2/10+6*18/3
+mov L0[-(c0)], r2
+.define c1 = 13
+.fill 3, (c1)/10
+.data 20, 1, c1
+prn #(12)-4
+L1: prn #(c0/19-17)
+.define c2 = c1*11/1-c0+c1/4
+.data c2
+mov #c0/4*16/2, r1
+mov L0[8], r2
+L2: prn #c1*-c0/3
+.define c3 = -20*12-c0*19 + c1
+prn #c1+-c2+0
+mov #c2--c2, r1
+.define c4 = 0
+.define c5 = 16-c4-7 + c4 + 11 + 3/13
+L3: prn #c2/1
+L4: mov #-12/10/4, r4
+.define c6 = c1-11
+.define c7 = 17*-c6/4
+.define c8 = 16
+prn #c3*2-1+7*c2
+.data c8*(c1+c2), --c6/1, (11*c0)-15, 18*c6+18-6/16
+mov L1[c0*(5)], r2
+.define c9 = 7*c3-12*-c8
+.define c10 = 12/1
+prn #c0
+.fill 1, c5-c8-(15+6)
+cmp #10-13+14+(15), L3[7]
+L5: mov #(6/2), r6
+.fill 1, 14/4+18+c1
+mov L3[18*c6*c7/3], r2
+mov L0[c6+c0+1/2+(13)], r2
+.data -c7*0/3+4, 17*5*(0)/2
+L6: mov #10*(c3-c5), r5
+L7: mov #11/2+-3*14, r1
+L8: mov #16-12, r2
+L9: mov #c9-19*c10+c9+6, r2
+mov L4[19], r2
+.define c11 = c4
+L10: cmp #((13)), L3[-c4/2-c8]
+mov #c7/5/3, r4
+mov L2[15], r2
+.data c9/5+11, (7-c9)/5, c5*15/1*c10
+.data 6+c11/5/1, 5+c3-c7*c2-c7-c7/3, (c5)--9-6+19, 3
+.fill 4, c0/7+-c8-c9
+L11: mov #20+c7, r6
+mov #6, r1
+.define c12 = 10
+mov L6[11], r2
+L12: mov #c1, r6
+mov L4[c0+14-11*10], r2
+mov #7+8*8, r2
+mov #12, r6
+prn #c11*5+c9
+mov L12[(((7)))], r2
+.define c13 = c2
+mov #c2, r7
+mov #c4/13/5*4*c9-c8, r5
+mov L7[c4], r2
+L13: .data -20/3*1, c6--13*c6+c6, (c0)+4/4
+L14: .data c1/2/3, c4-1-c9/5, c9
+mov L2[(c5+c0+12+c2)], r2
+.data 10*6*6-14, c10/3/3, c11*c6+(2)-c1
+mov #-19/4, r1
+cmp #16, L7[c2/3*1*c8+-3]
+mov #c4*(0)+16, r0
+mov L9[c10], r2
+L15: mov #(c9)+6*c13*3, r5
+L16: mov #c0, r0
+mov L13[3], r2
+mov #-(5)*-c2+c1+6, r7
+.define c14 = 5 + c4
+mov #3-13+c12+c0+c2-20, r5
+.data 3/3+3+c7+19, c4-19-c5+c0-19, c10, c0
+mov #c9, r0
+.fill 1, c14/6+12+16+14
+.define c15 = 3-c13
+.define c16 = 1-c4*c6/13
+.define c17 = 8-3+c4*1-c5/5
+mov #c9+c17/3-19+c5, r5
+.define c18 = c10
+L17: .data (c10)
+.fill 3, -c4/7/3
+prn #(-c3)*18*(c17)
+hlt
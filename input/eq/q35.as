@@ -0,0 +1,91 @@
+L0: .data -15*15+16*(1), 7, 19/15/5+5
+L1: .data 5+2-18+(8)+6/12, 15, 3+15*5-12*12, -11*3/19
+mov #13+9, r0
+.fill 1, 3
+mov #(6)/1+-7-6/7, r0
+prn #--1*6
+mov #2, r6
+mov #(18)+10-15/2, r1
+.define c0 = 18*-1 + 10
+.define c1 = (c0)
+mov #c0, r3
+.fill 4, 9/4
+mov L1[c0-c0-3/2], r2
+.data ((19))
+.define c2 = (c0*2-c1)
+L2: .data 4, -(c2)-10
+prn #--19
+mov #16, r6
+.define c3 = 16
+mov L2[c1/2], r2
+.data (-c1*2), c1, c2/1, 20*c2+c3+6
+L3: prn #c3
+L4: .data -17+7+14+5, 13, 5, c3-c2-c0+(c1)
+mov #(11+7)+c0+10, r1
+.define c4 = -14
+.define c5 = c2
+.define c6 = 4-2-8/2
+L5: prn #2*4/3
+L6: prn #16*c5/3*-(5)
+.define c7 = 19
+L7: prn #(((0)))
+mov #c4, r3
+.data 11+13+c6/5*5, 12, (c2+16)/2
+.data 0, -c1+c7
+mov L5[12], r2
+prn #7
+.define c8 = c2*10
+.data c0, c3, (c8), -(c7)/2
+.define c9 = 4+-c7-c7
+L8: mov L6[5], r2
+.data (-14*(c1)), (12)/3+c6/4/1
+mov L2[c2-5], r2
+prn #c7
+mov #10+c0+c1*-3-7, r1
+L9: mov L0[-c1-14*c1], r2
+mov L6[---c2], r2
+.data -c4/5, c9+c3-(0)*-4-(13), 15*19/6
+L10: .data -14+0-2+3, 1-13+12*c6, 12-16*c2*c6, c9-c9*2+-c1
+.data 3-(18)-20/3, 13-15/5-9*c0*c3
+.define c10 = (c4)
+.define c11 = 20*-(c1)
+mov #1-4/5+6, r5
+L11: mov L8[c2/8-c5*(17)], r2
+cmp #-5+16/3, L11[(3)/3-5]
+prn #c10
+.data --c6-10, 1
+L12: mov #8-15+c5*(9)-2-6, r6
+mov #c11+c8*c9/5, r3
+L13: mov #-c11*c11/5, r3
+.data c11-4*c10/2, c4-10+(c7)+c10
+mov #c0, r5
+L14: mov #5-6-10+15/1, r1
+.define c12 = c8 + (12 + c0)
+L15: mov #20, r2
+mov #c0, r1
+L16: mov #((17)--c9), r2
+.data 10, 13/1-11-c1-12+19, (c7-c4-3/20), c12/3/1
+.define c13 = -(c4)
+mov L8[c8], r2
+.define c14 = c10
+.define c15 = c3
+.data -9+c9*6+7+-20
+mov #c14, r6
+.fill 2, 8-15*-c7/5
+L17: .data c13+7
+mov #-3-c7-c3-c9-6, r5
+.data c2*(c2+c3), 4/1-c7*15*9, 6/13-6+c11+c0/3*c4
+.define c16 = c15/12/2-c8
+L18: mov #16, r2
+.define c17 = 14
+.define c18 = 16
+.data -c16*c11/5, c0, 13, 8
+.define c19 = c3
+L19: mov #0, r2
+prn #c11
+.data (c2)/3, 2+c19-c5+c5
+prn #c8+2-12+10-c19
+.define c20 = -c17/2*8-c15+17-c14
+.define c21 = c12/2
+.data (c4-15), 6
+hlt
@@ -0,0 +1,63 @@
+.define c0 = 15/2*2+17-20
+L0: .data 13*c0-c0*c0*13-15, 4+6*(8), c0-c0+(9), -c0
+.data c0, c0-c0/4-(1)
+mov #((c0))/1, r1
+.fill 2, -0*16-c0/3
+.fill 1, c0*c0/3*6
+.data 10-18*2*c0
+mov L0[-18*-c0*c0], r2
+L1: mov #(4)/2/4, r4
+L2: mov #8, r0
+L3: mov L3[-c0*c0*c0+c0], r2
+mov #16*5, r3
+.define c1 = -13
+L4: mov L0[(5/3-8+14)], r2
+mov #c1+c0*20-19-8, r4
+mov #11, r7
+L5: mov L3[c1*c0*13/4+15], r2
+mov #((15*c0)), r6
+mov #-(13)+c0, r1
+.define c2 = (11-7-c1*20)
+.define c3 = --15
+.define c4 = c0
+.define c5 = 11-c1-c0
+L6: .data -(c2)*8+18, 5/5, 6, 20/5
+.define c6 = (17)
+mov #c4, r0
+.data -11/1
+L7: prn #8/3
+L8: mov L0[16], r2
+mov #12, r4
+prn #15
+L9: mov #17, r2
+L10: cmp #14+-4-c6, L7[c1*10+(14)/1]
+.data c4, (c4+11)/1, 7, (c4)
+L11: mov L9[c2], r2
+mov #(19-10), r3
+.define c7 = 4/2/3*-(1)
+mov L6[c7], r2
+L12: prn #--c1/1
+L13: .data 20
+mov #17*-0/5, r6
+mov #c1, r1
+.define c8 = -19
+.data 5-4/3*3*6/9, 15, 6*c7+c6/3
+L14: .data -c2+0
+mov L6[c2-c5*7/13+2/18+19], r2
+L15: .data 13
+L16: cmp #(c2/5), L1[18+-3/15]
+prn #c2
+.define c9 = -c0+c3+c0*c3
+L17: prn #c2
+.data c6+7
+L18: mov #16, r1
+.data -c3/2--c3, -8, c1-c3/5*-c1-1
+L19: mov #(c1*10), r3
+L20: .data c8+c5/4/4
+.fill 4, 19
+prn #-c3/3+c8
+L21: cmp #c6*12-7*-c8-c9/1, L11[c3+8+17+7+-c1]
+.data ((3+11)), c0+5/3
+L22: cmp #c8, L0[-3-14*c5/9]
+L23: mov #7/1+-c3+(4)/5, r5
+hlt
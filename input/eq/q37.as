@@ -0,0 +1,108 @@
+mov #2+1*13*(14), r4
+prn #(0*13+19)
+mov #18, r3
+.define c0 = 0
+L0: cmp #c0+7+(c0)-(8)*1*c0, L0[(c0+c0)*c0]
+L1: .data 14, -6+7/1, 4
+L2: mov #(c0)*c0+20*13+c0--2, r1
+mov L2[10], r2
+.define c1 = 18
+.define c2 = (20) + 16-11 + (c1)-c1*c1
+.data -c0-12/4, -15+c1*16-13
+mov L2[c2-c0-c0+0], r2
+mov #c2, r2
+mov #5-c1+-3--7, r2
+L3: mov #(14)*14/10+(1), r2
+L4: mov L3[-c0], r2
+prn #-c0/16+-c2*c2
+prn #(5)/3*c1
+mov #c2, r5
+.data (-20), -c1*14*14*c1
+.data 0*-c2--2*c0
+.data (c2)*4+6/3, c1+c2+10/3, 2, 3
+.data ((-c2)), (c0+(c1))
+L5: mov L4[c1], r2
+.define c3 = (8)--15-(0/4)
+L6: .fill 1, -c3
+mov #10-c0, r6
+.define c4 = c3-0+2-3
+mov #c3+(c3/13), r2
+.fill 3, ((2)+-c2)
+L7: .data c1, 1, -c0+(9), ((12))*c2
+prn #(3)*c3*16+5-1/5
+.define c5 = 2
+mov #-17, r7
+.fill 4, 2*c5
+prn #12
+mov L4[-(c3)], r2
+.define c6 = -7
+prn #c2
+.define c7 = 6
+L8: mov #20+18-4-c0*c0, r4
+L9: mov #(12+c5)+c0, r7
+.data c3-c5--c2-18*c2/3
+L10: .data c2, c7+14
+mov #c7, r0
+mov L3[15*-19/4], r2
+L11: .data -c7+7*c3, -(c7)*(12)*-18
+L12: .data 15-13*c6/1, c1, (14+c0--16)
+mov #0, r1
+mov #(5)-13*-9*4/17, r7
+mov #c4, r1
+L13: mov L12[-12/9-19+12], r2
+mov L13[8], r2
+.define c8 = 10+c2-17
+L14: prn #c8
+.fill 2, 8
+.fill 1, 7/9*-c8*c3
+prn #c6/2*7-9
+prn #c6*(-c2)
+L15: cmp #(1), L6[17-8]
+L16: mov L0[-13], r2
+.data 18, 6*1, 6
+L17: mov #c4, r6
+L18: .data c0+(4*c3)
+L19: .fill 1, 5
+cmp #2, L12[1]
+prn #15
+.data 15, 4, 7
+mov L5[c6], r2
+L20: .data 12/4
+.define c9 = c1
+mov #c2, r2
+.define c10 = c0
+L21: mov #14, r1
+mov L2[-c0+c2*(5)], r2
+.define c11 = c6
+mov #-c10-c9-c8, r5
+L22: mov L15[(((c9)))], r2
+.data c6, (-9)-c11-c3/3
+.define c12 = -c3
+.define c13 = -7*9-c9*c4
+.fill 2, ((-12))
+L23: .data c9+(c12)-c6, 6-c5-c12, 12
+mov L7[c0+1-c10+11], r2
+L24: mov L2[c8+(9)*c12*c8], r2
+.data -3+(c1)
+.define c14 = c8*c2-c0-20/3
+.define c15 = 7 + 3
+mov L22[3], r2
+mov L24[(c12*8-c4)], r2
+L25: .data (c4), 8, c10
+prn #-c5/3+2*-16
+mov L14[-0*-c0-c3-10*18], r2
+mov #18/3, r5
+.define c16 = c10
+.define c17 = 13
+.define c18 = ((c3+11))
+.define c19 = c13
+L26: .data 19, -16/16/4
+L27: mov #(-3), r4
+L28: mov #17, r6
+L29: mov #c16, r6
+L30: mov #6, r6
+L31: .data 12, 10, 6, 7-(9)+c17+c14+c0+0
+mov #-c18-c3+c6/8+6+c9, r1
+mov #7, r1
+L32: prn #-c18
+hlt
@@ -0,0 +1,102 @@
+.fill 1, 14
+.data (2)*(18)*10, -4+3-(12)
+L0: cmp #18*2-5*(9), L0[-16-2/7]
+mov L0[14+18+4], r2
+L1: mov L0[(9)+4/6*10], r2
+mov L0[9*7-18+18/5/4], r2
+.define c0 = 16*14
+mov #8, r1
+.define c1 = 11/2*-c0+12
+.define c2 = 8+c0/5*c1
+L2: mov L1[1], r2
+L3: mov L3[(16)/5-(c1)], r2
+L4: mov #c2, r2
+mov #16, r0
+.define c3 = c1*c2/2+c1/2
+mov L1[10], r2
+.define c4 = -c0-12 + 4
+.data ((5)-(c0)), c2/1/1*-c0-19+5
+L5: .fill 2, c1/1
+mov L5[3+c0-(c0)-c2*17/4], r2
+L6: mov L5[13-c4/14/3], r2
+.define c5 = (13) + (17)*14
+.define c6 = c5
+.data 6/17, c3*c4, (16*9-c2), c1
+.data --4*16, c3*13+(c2)/2
+.fill 1, --c6-c3
+mov #c6*c3+0+c2+c2, r6
+mov L6[6], r2
+L7: cmp #16, L6[c4]
+.define c7 = (c1 + c0/2)
+mov #c0, r1
+cmp #3, L3[c1]
+L8: mov #c7*-c4*13-9+c3-c6, r3
+.data c0-c6-20/4, 10, -9*13
+L9: mov #4, r7
+L10: mov #c7/3+(c5)/5, r5
+.data (c1-c4*20/13)
+mov #c3+-c5*11, r7
+mov #c3-1+(c4)+17/1, r6
+.define c8 = c7-(c5)
+.data c7-c8, 20
+L11: mov #c4, r7
+.data c0, 18*c7*19-9*19/4
+.data c6, -18+2/3-18*18-16
+.fill 3, -(16)+2-1
+L12: mov #-19, r4
+mov L2[13-c6+4/4+4], r2
+.data ((c2))+c2-c3*c1, (2), -c1+18/3
+L13: mov L4[8/10-4*c0], r2
+cmp #12, L1[13/3-c3+11/2]
+L14: mov #19, r7
+L15: mov L15[-18/5+18*c2], r2
+L16: mov L8[8], r2
+mov #(17), r3
+L17: .fill 4, c7+c2
+L18: prn #(c1)
+L19: mov L16[c0], r2
+.data (1*9)-19-18, -c4-5/6
+.data c2, 9*4
+mov #(15+c5)-0, r5
+L20: mov #4+-c8/10, r4
+.data c3*c7
+mov L3[2], r2
+mov #c0/4+-6*(10)*c1-c5, r2
+L21: mov L9[13], r2
+mov #c1, r3
+L22: prn #c2*c3/4/5
+mov #c6, r1
+cmp #0, L9[-c7]
+mov #((13))+12, r2
+.fill 3, 16-c1/4*13/15
+.fill 2, -c8*c5
+.define c9 = -3-c8/5
+cmp #-c7-4+c9, L14[7/3+15-c3/3*(9)]
+L23: mov #20-(c3/5), r4
+mov #-c4+(11), r7
+L24: cmp #11-c0/12/3, L22[9*13-17/3*12]
+.define c10 = c8
+L25: .data c2+18-1/3+c8, 10-19*6
+mov #c4/4, r0
+L26: mov L13[(-c0)/6], r2
+L27: .data c7+-7*1
+.data 14, 1
+.data c9, (13/14)/4, 17+c9-18/15, 3
+mov L10[c9/5/4], r2
+mov #11/4-c3-c3+c1, r5
+.data -(c0), (0/1*7)
+.define c11 = c5
+L28: mov #(15*c7)-c6, r0
+.data -19*15-c9*(c3+c8), 16
+mov #c3, r0
+.define c12 = -(c4)-19*8*c8
+L29: mov #c12+-17-c9, r6
+mov #13+c3/1*(19)-c9, r5
+.data 4-18, c8*7, c2+8
+.define c13 = c8
+mov L0[9+c12-c12*7*c12-c1], r2
+.data c7*(c11), c7/3, c13, 7
+cmp #7, L16[3]
+.define c14 = 13+14+c2/5
+prn #2+-11/4
+hlt
@@ -0,0 +1,47 @@
+L0: .data --11*2-0, (-1/5)
+mov #3/3, r6
+mov L0[19+(13)], r2
+mov #-16-15-2-14, r4
+cmp #18--1-5, L0[5+6+11/17]
+L1: .data (17)
+.define c0 = -(10)--6
+prn #c0*c0+c0/5
+mov #7+11+-c0*c0+3, r2
+L2: .data (c0)+6/13*c0-c0/14
+mov #c0*16-(c0), r7
+L3: prn #11/4*(3)+c0
+mov #c0, r2
+mov #c0+12-c0*c0*4, r6
+L4: .data 19
+prn #16
+mov L0[c0/11*c0*19*c0], r2
+mov #14+c0-2*c0/10*(c0), r5
+.define c1 = c0/13+3+15
+L5: .data c0, 15, c0
+L6: .data c0, 8
+L7: mov #c1, r0
+.data 6
+L8: mov #-14-c0*0+c0/3*c1*c0, r0
+L9: mov #12*c1-c1*(c1+9), r4
+mov L5[c1], r2
+mov #--c1+c1, r3
+.data (12)
+L10: prn #-4--8-c1
+.define c2 = (5)
+L11: mov #3/4, r0
+.define c3 = 1-c0 + c2-c1/2
+mov #c3/5, r6
+L12: mov #0, r0
+.fill 1, 20/3+c0+19*-18/14
+mov L12[-3/2-(c1)], r2
+L13: mov L8[c0-11--7-c2], r2
+.define c4 = c0
+.define c5 = (-c0/1)
+.define c6 = (7-c5--20)
+.define c7 = 18*10/2 + c1
+.fill 1, c2*c7-18/3
+.define c8 = c5
+.fill 3, 5+c6
+.define c9 = (c7+c5-13*c2)
+L14: mov #-6-c3+-c4*2, r0
+hlt
@@ -0,0 +1,51 @@
+.data 2, 17, -8+0+17, -7*19-9
+.define c0 = 17
+.define c1 = c0*c0-(c0)
+mov #2, r6
+prn #(c1)
+L0: mov #-9-7, r7
+.define c2 = 9
+L1: prn #20
+.fill 1, c1
+L2: .data -c0, -3-18*c0/1
+L3: mov L3[c2-(c0)], r2
+cmp #(c0), L1[-c2--20/5]
+mov L3[3+c0/12*c0-4], r2
+.data c0*2-c2+c2/1-17, -10+5-15*-c2/3, (-c2+c1), -10+14/16/5
+.define c3 = 5
+L4: prn #--19+5
+.define c4 = c0/3*c2/2*c1 + 3 + 15
+cmp #c4-c1*19*15*(-14), L4[2*c0]
+.define c5 = -c0/4*c1-17/2
+mov #15+0, r2
+cmp #(c5*13)/1, L1[18]
+.data 10+(7)*c0+11, c5*c5/5-11+c2+c5+c2, (c3)
+L5: prn #c0-c1*5/2
+L6: mov #9-c0, r2
+L7: prn #-c0*17/4-1-c0+c4-c4
+L8: mov L2[-c1], r2
+prn #-10+c1-c4
+prn #c5
+L9: mov L6[c1-c4*-(c5)], r2
+prn #19
+L10: .data -19
+.define c6 = c2
+.data c4, c4, 16*6*8+c6-(19+5)
+mov #c0-2+6*c0+11, r4
+mov #10, r2
+mov #17*c0*18+c1, r6
+mov L2[17-c2+14-18/5], r2
+L11: mov #-c6-c2*c2, r0
+cmp #11, L10[-c5]
+.fill 3, -c1/1+c3
+mov #(c3+c3/2), r5
+.fill 4, (15)/13+7/5*c6+c5
+L12: cmp #5/4*(18*c1), L10[-(2)+(c6*c1)]
+.define c7 = c3-c3-c1-2
+mov L5[-c6+14+c6+c3*10], r2
+L13: prn #c7
+mov #((c5/8)), r4
+mov L1[5], r2
+mov #0-c6+6-3+c4, r1
+.data -8+c4*c7/3-6/3, (c3)/4
+hlt
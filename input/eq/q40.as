@@ -0,0 +1,79 @@
+mov #20, r3
+.define c0 = 10/3
+mov #c0+(10), r4
+L0: mov #10-c0+3-(c0), r7
+.data c0, c0-6/7/6
+L1: mov #-15+c0, r4
+L2: .data 18*c0+c0+8/17--c0, -c0+6*5, c0, (15*14)/7
+.define c1 = -0*10/1
+L3: mov #18, r1
+L4: mov L3[9], r2
+L5: .data 1/12, (c0)-(c1)-(-c1), (c1-c1)+20
+.define c2 = 11
+.fill 2, -c0/13
+mov L1[10], r2
+L6: prn #-c0+17/4
+.define c3 = 1
+.define c4 = c3
+.define c5 = (17)+7*(c3*c2)
+.define c6 = c0/2
+mov #((19))/1, r0
+mov #16, r4
+mov #c1, r7
+L7: mov #(-18), r0
+L8: mov L7[(c3)/3+c5/3], r2
+L9: .data -c5/14/2, c6, -4*1*c0
+mov L2[c5/1], r2
+L10: mov L9[c1/3], r2
+.define c7 = 14/5 + c0/3
+mov L5[13+c1+20/3], r2
+.define c8 = -10+12*3+c5
+mov #c2+18/5/5, r1
+prn #c0*1/2+c1+1/1
+L11: .data 15, 1, 12, -5*8
+L12: cmp #(c7/9+19*c3), L7[-(c7)-3*17]
+mov #3, r6
+.define c9 = -c2*10*c1
+.define c10 = 9
+mov L10[c9], r2
+.data c0*c2*c4+-c4-c6
+mov L3[(17)], r2
+prn #19
+prn #7
+L13: mov L3[-8*c6-c5-20], r2
+mov #6, r0
+mov L9[c2*c3-0-c5], r2
+mov L11[c9], r2
+L14: prn #c5
+.define c11 = -12+c0*c7
+prn #9+(18)-c10*c8/3
+mov #((c9)/2), r3
+L15: mov #c7/2, r0
+L16: mov L9[c1/3*0-7+c9], r2
+.define c12 = (1+7)-c2/4*8
+L17: mov #(19), r4
+mov #-17*c9, r5
+mov L16[20/2/5/4], r2
+.define c13 = c1
+prn #c0+9+4/7
+.fill 2, -4-12*0+5*(11)
+.define c14 = -c6-2-18+3/5
+mov #(3)*-16*(c4)*-c12, r0
+L18: mov L11[-15*c2*c9+8/4], r2
+mov #6-c8+17*17/5, r1
+.define c15 = c8
+.data -c9
+.data 16/1/3, 0
+mov #c0*8-6/2, r6
+cmp #-c1+(8)-12/4--11, L5[18]
+mov L10[c3], r2
+.data 5, c10-20--c10*c11+5, c9+c3*14+19
+mov #5*-6*6+c0*(c7), r7
+prn #14
+L19: .data 19*c1-(c8)
+L20: prn #-c12
+L21: prn #-c9
+mov #c11, r5
+L22: .data 14--4*(13+13), 10*(19)-c5-c1, (c0/4)-c0
+.fill 4, c7/3
+hlt
@@ -0,0 +1,69 @@
+.data 18*18*20/2, 9, 10-5+4-11, 0
+L0: mov #(4/7)+-2, r1
+mov #(13+4+1/4), r1
+mov #-19/3-11, r6
+L1: mov L1[6+14-(12)-(7)-5], r2
+mov #3-19*8*19-2+4, r4
+mov #((15+19)), r2
+L2: prn #15
+prn #17
+.define c0 = 15
+L3: .data 16
+L4: .fill 4, 8
+mov #-c0-(6)--18, r0
+L5: mov L3[-3*c0*c0*c0-c0], r2
+cmp #c0+9+9*7/5*-15, L4[-(c0+11)]
+L6: .fill 2, 0
+.define c1 = 15
+mov #8/1, r7
+prn #(10-c0)-8-c0+16/5
+mov L1[c0], r2
+L7: .data c0, c1-11, c0, c0
+L8: .data -c0-c0/5
+prn #10-c1
+L9: .data c1-(12)/4, c1, c1*c0, c1/13
+.define c2 = 16
+.define c3 = 19
+mov #14-c0/19*-c0+c0, r3
+mov #12, r2
+.define c4 = 1
+.define c5 = c4*c0+11*c2
+mov #20, r4
+.define c6 = 19/5-9+c5/3
+mov L9[c6], r2
+.data 6, c6*c1, 20+11+c6--c6*c4
+mov L9[c3+6+4-c2+c2-c5/2], r2
+prn #c1
+mov #(1)*7+c3+c2/12+5/2, r6
+mov #c4*4-13+c2+5, r4
+.data c3, 9, -4-c1+5+13-20, -18-c5+c5
+.data -15, -c4, c6/2, (c0)
+mov #c1, r3
+mov #--c5+-4, r4
+mov #-6, r6
+mov L7[(c1*1+-2)], r2
+L10: mov L8[8], r2
+.fill 4, (16)
+.define c7 = (10)*1 + c1*(c2-1)
+.data c2+19-c2*c4
+.data (c6/12*17-c2)
+L11: mov #(8*c2)+c7, r7
+mov #(c5/1+6/3), r6
+.data c3, c2+5-13*-c3, c6
+.define c8 = c3 + c7
+mov #-2+-c4, r0
+.define c9 = c6
+L12: prn #11-4-c4
+L13: mov #19, r2
+.define c10 = c4
+mov L5[15*5*c8+(c7)], r2
+cmp #c9, L4[11/2]
+L14: .data 6, (-0-9), 8/4*c3-c9-8
+mov L0[(-15/3)], r2
+prn #c9
+L15: mov #-(18), r3
+mov #c3+-c0--c3, r4
+.define c11 = 18+(15)*c3-10
+.define c12 = -16
+.define c13 = c1 + c5-c0*(c0)/4
+hlt
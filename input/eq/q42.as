@@ -0,0 +1,6 @@
+MAIN: mov r1, r2
+ .data 5, 6
+L: hlt
+ jmp L
+D: .data 7
+ .string "ab"
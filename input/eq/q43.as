@@ -0,0 +1,25 @@
+.data -13*17+(0), -3, 18*12/12/5, 1
+L0: mov L0[-1/2+(10)+19], r2
+L1: cmp #-17-9+2+13+11, L1[(0)]
+.define c0 = 6/1-(14)*17
+L2: mov #-6/10, r0
+mov #c0, r6
+mov L0[(c0)], r2
+L3: mov #4, r3
+.define c1 = 6
+.define c2 = c0
+.define c3 = c1
+.data (--c1)
+.data 19-20+20/5, (c2)+c3, (c2)
+.data --9-c2, 16+c2+4*c1-c1, --(c0), 15
+L4: mov L1[(13)], r2
+mov #-c0, r1
+cmp #6, L2[c1+c1-1/1]
+mov L2[(c3-5/1)], r2
+.define c4 = 20
+L5: mov #c4+c3, r1
+mov #c0, r6
+mov L2[17*-c3+0], r2
+.data 12, -c2, 17
+.define c5 = 3*(8)/4
+hlt
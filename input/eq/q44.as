@@ -0,0 +1,73 @@
+mov #12, r3
+L0: .data 16
+mov #15*12/1, r3
+.define c0 = 1
+prn #c0*-(4)
+mov #c0/15*19*c0*c0, r4
+L1: prn #c0
+mov #1, r4
+mov #4*-c0/4, r1
+prn #-(4)
+.data 17, (16+c0/2), (0)
+L2: .data 1-c0, 3+-c0*(5)
+.define c1 = c0
+L3: mov #--c0-5, r4
+mov #(15/5), r2
+.data (c1), c1, 6, -9*15*18*(1)
+L4: .data c0, --c1+17, (13+7/5)
+L5: mov #(17-c1/4), r5
+.define c2 = c0+-(c0)
+.data c2-6*18/1, c0, c1
+mov #17, r3
+mov #c2-16*2/3, r7
+.data c2*(8/1)
+mov #((c1))*11, r0
+.fill 1, 5/13/2/3
+mov #c2*1, r1
+.define c3 = c1
+L6: mov L4[7], r2
+L7: .fill 2, c1
+L8: .data (c2)
+mov #c3/4, r0
+.data 20*2*c2-20+0+c0, 2, c0--c1/3, (c3)+16/3-(c2+c1)
+mov #2*0-1-20/4, r0
+L9: mov L5[c1*c1/5-c2/6*12/2], r2
+.data 18-10*8+7-c0+c3*14, c1
+mov #-c1, r0
+L10: mov #2/2*c3-c0*16, r3
+mov #-c2, r2
+.data 20, 10, -18/1-5*c0/4, (18+c1*0)
+.data (13*c3)/5, 13*c2+c1+--20
+L11: .data c0
+mov L6[14], r2
+L12: cmp #c2, L12[12/1]
+L13: mov #c1, r5
+mov #c3, r3
+mov #c2*c1/2/2, r5
+.define c4 = 2*c2 + c3 + c1*9
+mov L10[-c4*4], r2
+L14: prn #c2
+.fill 4, c4
+.data 19, 1*9/4-c4, c3-19*7*c3+(c2)+c3, 16*c4-10+11-8*c2*c2
+L15: .data -c4
+.data 1*14*15/2, c3, 19-13-20*c0*-19*3, (17)
+.data -c1+c1/4+c2+14+6, 20-9/1*c4-c1-12+c1, 3
+L16: cmp #-c0, L8[13-c1]
+.define c5 = --6-16-3
+mov #14, r6
+mov #c4+13/10-c3, r1
+cmp #-0/4, L1[c0]
+L17: mov L1[6], r2
+.define c6 = (3-c5+9)
+mov #13, r2
+L18: .data (7)-9+c0*c4/2+1+7, c3+14/4, 7+(8)
+cmp #(13)+5-1/2, L17[c1-16+2/9+5-c6+3-c1]
+L19: mov L16[3], r2
+cmp #--5-8*16, L3[(c1)-c3+16/1]
+.define c7 = -c5*15-(8)
+.define c8 = (((c0)))
+.data c0, 14, -2+c1/4, 3
+L20: mov L10[7+17], r2
+mov #c0, r5
+mov #-c3*c1/1, r7
+hlt
@@ -0,0 +1,55 @@
+L0: .fill 3, -0
+.define c0 = 13 + 13 + 4
+.define c1 = --c0*c0
+.define c2 = (c0*c1)*7
+.define c3 = 3*-c1
+prn #(c2)/2
+L1: mov L0[0/4-14+c3], r2
+.define c4 = 7 + 1 + 14/4
+.define c5 = c2*c3/5
+mov #c5, r2
+mov #c4*-c1/2, r0
+L2: mov L1[5*(c4*13)], r2
+mov #16*18/5/2, r7
+.data 13/1-3-13*20, -c2*0/3, c3+13
+.define c6 = 8-0-9*6*-c0 + 13
+mov #15*c6*4/2+c6, r0
+.define c7 = c5
+mov L2[c3], r2
+mov #(8/13)-c7*c2-20, r0
+prn #((c3))/1
+.data 14/3, (17), c6-7
+.data 10+c4+18+(c2)-11/3, 18-3/1--8+c5+c0, (c7-10)+c5, c2+-c2-(6)
+mov L1[c6-c6/8], r2
+mov L2[c2+c0+7+14], r2
+.define c8 = c5/4
+mov L0[(c2)], r2
+.data c0
+mov L1[-c0/4], r2
+L3: mov #-c3+c0-5+4, r3
+.fill 4, c0
+cmp #-16*c5/16, L1[-3*6]
+L4: mov L3[11], r2
+mov #(c8*15), r0
+mov #(c1), r1
+mov L0[17], r2
+L5: mov #-c0+12*c7, r3
+.define c9 = -19*c2 + -18-15-c5
+.define c10 = 13
+mov #c3*3/2-19+14-c5, r2
+.data -c8/4+9/4-c1*3
+mov #(18)*c1-c10+c4, r3
+.define c11 = 16
+L6: .data (c2), c1, c4/8+-c3+-18+-c3
+.define c12 = 14/4*c11+10--c4/2
+.data 1-(1), -c7-11, 9
+L7: mov #(c8/8+c5), r2
+.define c13 = (6+18/2)
+mov #6, r2
+L8: .data c2/3*16-c12*19, c12/5, 0
+L9: mov #c8--11+c4+c10, r6
+.define c14 = 15
+.define c15 = -1*3-c5/3
+.define c16 = 15+c1-8+18*-c4
+cmp #-c3+8-c5-2, L6[16*7]
+hlt
@@ -0,0 +1,30 @@
+.data 14+-11-9+4+10, -6-11/5
+prn #10-3*5*18*9
+.define c0 = -3*9/4-12 + 20/3
+prn #-(c0)*c0
+prn #c0+19*c0/1
+.define c1 = -c0/5/5
+.define c2 = c1
+.data ((c1))
+mov #c2+2/2/2, r0
+.define c3 = c2
+prn #c2
+L0: .data 11-7/1, c3, 18
+.data 9*-c1*c3, --c3*10, c2/9-c3, 4
+.data c0
+L1: .data --16/5
+L2: prn #-16-11+--c3
+.fill 2, c3
+mov #--c3+2, r1
+mov #(c2+5)-13, r3
+cmp #c3, L0[-c0-c3/1/2]
+.define c4 = (c1)*c1*17-16/11/2
+mov L1[-3], r2
+prn #1*2
+mov #12+c1/2/1, r4
+.data (-20/5), 19
+mov L0[10/1], r2
+L3: mov #c0, r6
+.data c3, 15
+mov L2[4], r2
+hlt
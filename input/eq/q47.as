@@ -0,0 +1,66 @@
+.define c0 = -1-16*10/5
+prn #-c0-1
+mov #7, r5
+.data (13+19)*c0-6-8*15, --5*6/10, 4, 18
+.data (15/2), 15, 17+c0-c0*c0
+.define c1 = 18
+mov #c0+c1*c0/4, r7
+prn #6
+L0: mov #c1, r7
+prn #((8))+c0
+.data ((18*c1)), c1+c0+-3/1
+mov #10, r6
+L1: mov L1[c0*c0+c1+c0-9/5/3], r2
+.define c2 = c0+11
+L2: .data c2, c0, -15-15/1
+L3: mov #0-19/1, r4
+L4: .data --c0, -14*c2*c0+15*(c1)
+L5: cmp #c0/6, L2[0]
+L6: .data (-0*(13)), c0, -16-c2+1
+.data (c1+13)*14, -c2, ((4))-c0
+mov L5[18/4], r2
+.define c3 = 4
+L7: prn #-c2/4/5
+mov L6[8], r2
+.define c4 = c2*c1-10-7+6/3*c0*4
+L8: mov #6+c4-(c2)+--c1, r4
+mov #c3, r5
+L9: mov #20, r5
+mov #c0*(10*c1), r4
+mov #c0, r6
+mov #c0/1-7-c1, r1
+mov #(9)/3, r5
+.fill 3, 13/3*c3*c3-19*c1-0
+.define c5 = -c2
+L10: .data c2, c4, c4+7/5/4, -8-3/1
+L11: .data c0, 15-c2+5
+mov #(c1)*c5/1-7, r6
+mov #c1-7*c3--c2, r4
+L12: mov L9[c2*(5)+c4/4], r2
+cmp #7, L3[0]
+mov L8[-16*c2*c2+11], r2
+L13: mov L4[-5-4-c3], r2
+.define c6 = 9
+.define c7 = 6-c6+7*c2-c2
+L14: mov L13[c3-7-c6], r2
+.fill 4, c7/6*(16)+(-c0)
+mov #((17)), r1
+mov L8[17*11+8], r2
+mov L3[c0], r2
+.define c8 = -0*8-c5
+L15: .data c3*0, (c2-c3)-15*17, c5, 6
+mov #20, r7
+mov #12, r0
+L16: mov #3-(c4+3), r5
+L17: mov #((13)-11), r1
+mov #c2, r3
+mov #17, r1
+mov L1[8], r2
+.define c9 = c1*(2)-c1/5
+.data 15, (c3)*c2+c2, 10-c7-c7/3, -c7+c4
+cmp #-c7, L7[(c7/2)]
+.fill 1, c6/5*c7*2*1
+L18: mov #c8-c2/5+9, r2
+mov #c5, r4
+.define c10 = (0*4)*-c5-c9 + 18
+hlt
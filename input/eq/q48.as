@@ -0,0 +1,91 @@
+.data 15-(13)-(16)/3, 10-17, 19+5*11*0
+.data 11/19*(0)/1, 18, 0+0/4-20-5
+mov #(0)--17/5, r5
+prn #(4/1)
+prn #7
+L0: .data 14/2/1, ((12)+5)
+.define c0 = 4 + 2-11 + 4-10
+.define c1 = 9*19-c0-17*c0 + 11*7
+L1: cmp #15, L1[20-2-10*(11+1)]
+.define c2 = -c0/3
+.define c3 = 11 + c1 + c0*c1/3*-c2
+.data (16)
+.data -(c3/2)
+.define c4 = (c0)-c2 + 3-16 + 7*c3
+prn #13/2
+L2: mov L1[c0-12-(c4)+c1], r2
+mov #18, r5
+prn #-c3+5+7
+mov #6, r4
+mov L2[16*7/4*-c0], r2
+prn #c4+c2/1+-9
+mov L2[-c1/14-14], r2
+mov L2[5*c0-c4/4], r2
+mov #18/2/5-c2*c1-9, r7
+.define c5 = 1*7/5*13
+.define c6 = c2*-c1/14
+.define c7 = c4
+mov #19-13/2*15, r7
+mov L0[c3-c4/8+c5], r2
+cmp #-c0-1/13, L2[3-10+1*c0]
+L3: mov #(c1--1), r7
+.data -14+-c7/1
+.define c8 = 5
+mov L3[c6*18-(c8)], r2
+.data 12*11/2*-14, -17*(0)*18+c2-(c8), -0--(10)
+mov #11, r2
+.define c9 = 19
+.define c10 = 10
+.data -(-13), -2+1/3, 5
+.data c7
+L4: .data c5, c2, 9-(6)/2
+mov L0[-c1*c7], r2
+mov #c0, r7
+.data (15+18)+6+18*6*c8, c2
+prn #0*2*c9*14*c7
+cmp #c9-5-c2*6, L4[6]
+mov #c0, r2
+L5: mov #-5+(c4)-1*c2/3, r7
+mov #(11/18)/3, r6
+.data c2, 11+c10-19*(c4)+-c7, 9
+.fill 2, -c1+11-10/1
+.define c11 = 4
+mov L1[-12], r2
+mov L3[c3], r2
+L6: mov #14+5*14*c9*c0, r4
+mov #(c2-2+(c10)), r7
+prn #-19/1+5/15
+.data (19*c4*c7), 5/5, 13
+.define c12 = c3*c11
+.data 6, (c4+0*11-c4), 18
+prn #c3
+prn #(c3)
+.fill 2, 4
+prn #c11/3/4
+.data c2*-c0*(18+15)
+mov #c12, r4
+prn #-c10
+.data 17-c5+12/1*13, c2
+mov #12, r2
+.fill 2, c11
+mov L1[9+-14+c10-c8], r2
+.define c13 = c10+(c6)*5+3
+L7: mov L3[--c11], r2
+.define c14 = c7
+mov #-c1-c11-(10), r4
+mov L7[-c8-5+-c12], r2
+mov #-18-c10, r2
+mov #2/4, r4
+L8: .data 1, c11/4+(1)
+prn #2
+mov #c9, r3
+cmp #c4, L2[c8/2]
+.data 0/3, 18-c7+c1/3-11
+.data c0, c7, (c14)
+L9: mov L0[c10+16-3*c5/4+4], r2
+.fill 2, -5-c8-5
+mov L4[c0], r2
+.define c15 = 8/5/5-(15/9)
+L10: mov #1/2+16, r5
+mov #19*16/1/1, r4
+hlt
@@ -0,0 +1,29 @@
+.data (4)+11-19*1, 12, --6+17
+mov #-8/15*7, r0
+L0: mov #2, r4
+.define c0 = -10/2
+.define c1 = 19-(18) + 11 + c0 + c0-c0
+mov #7*c1/15/1, r2
+cmp #--c0, L0[c1]
+prn #c1
+.fill 3, 20+-c1-10
+L1: .data -4, -5+c1+c0
+mov #1/4, r0
+mov L0[19+9-8-c1], r2
+cmp #c0/4, L0[16/20+(17)+16-c0]
+.data -c1+c0+16-c1, --2/2
+.data 13, -c1*10/2, c1
+mov L1[-(19*0)], r2
+mov L1[c1-c0-18*c0-(c0-4)], r2
+mov L0[4], r2
+mov L0[c0-c0], r2
+L2: mov #c0, r0
+mov L2[(6)], r2
+L3: mov #(c1/3)-12*c0-10, r2
+.define c2 = c1+c0*c0-c0
+.fill 2, -17/5*5
+.fill 4, 6
+mov L2[c2-14/4], r2
+mov L0[-19+16--c2--9], r2
+prn #5
+hlt
@@ -0,0 +1,100 @@
+.data (12)-6/18-15
+.define c0 = 19
+.define c1 = 5
+.data 6, c0/2
+mov #c1, r7
+L0: mov #(c0), r5
+L1: mov L1[-c1+(6)], r2
+.data 12*c0*c0+-9*4+6, 11, (9)/2
+.define c2 = 10*0+9*15-11-c1/4
+mov #6*-16/14, r5
+prn #19/1/18
+L2: mov #(-c0)+-c0-3, r3
+mov L1[(c0)], r2
+mov #0/19*c0-20*10, r6
+.define c3 = -c1-c1--12/15
+.data (14), c1
+L3: mov L2[c0], r2
+L4: .data c1*0+c2*15, c3
+L5: mov #c3/15/3-13, r7
+prn #(1+c0+c0)
+.define c4 = 11-c3*12+c3-c1/13
+.define c5 = 20*c3*c1-8
+L6: mov #11+6+c1+c1/15, r3
+.data 11/20, c3*c1*c4-c3/2, c1*c0-11/2
+.define c6 = 5
+mov L5[c5], r2
+.data -14, c5, c4, (16+(5))
+mov #c2-12-1/4/2, r1
+.define c7 = c5
+.define c8 = (c1/5)
+.data c3, c2+(17)/3
+mov #17+c0*c4/12, r0
+.define c9 = c4
+L7: mov #(--5), r1
+.data (19-5/4), c6
+L8: mov #7, r7
+mov L7[c3], r2
+.data -6+c6/4, -18*((c3))
+mov #19, r4
+mov #c1/2, r5
+mov #6/4-(c5)/3, r5
+L9: .data c4, -5, c2
+L10: .data ((c6-c9)), c9, c2-15+c6-10-(-10), c5
+L11: mov #11-9/4*c9+14-c7+6, r3
+prn #c1
+L12: mov #-17+17/3, r6
+L13: cmp #(c2), L5[8+c7+c6]
+mov #(c8), r6
+cmp #c5+c6/4+c6, L4[5]
+L14: mov L10[-c6/5-c7], r2
+.define c10 = --7*c6-17
+.define c11 = c3
+L15: mov L6[(c9/11-c0+c11)], r2
+prn #(c2-c11)*-c1+17+12
+.data (c4), c11*-19-14, -c11
+mov L1[c6], r2
+mov L7[(10)+8+8+9], r2
+mov #(c4), r5
+L16: prn #c1
+mov #c8/5/2, r4
+L17: mov L3[c8], r2
+.data -c5*3+17+-18
+.fill 1, c0
+prn #9/4
+mov #--c2, r3
+.define c12 = 17
+.define c13 = (-10+4)
+L18: mov L9[14], r2
+.data 8, ((14+c11)), c10-14
+.define c14 = 8
+mov #((c10))-c8*c5/5, r3
+mov L0[(13)], r2
+mov #20/5/5, r1
+.data c6/8*(11)+c1, c12
+.define c15 = c5-16/5
+mov #c1, r6
+.define c16 = (c6)-4/12
+cmp #c1+15/10-c13/2/3, L11[c16/1/10]
+.define c17 = 19
+.define c18 = c1
+L19: mov #c2+c13+15, r3
+cmp #-c15+c6*(13), L10[1]
+mov #-(c6*c16), r6
+L20: prn #c1
+.data c9
+.define c19 = 1 + c9
+.data 17+-4/3, (c13), 10, 13
+prn #c6
+mov L7[c15+1*c11], r2
+L21: mov #10, r3
+L22: .data 17*c1*c15*9+18*20
+.data c8
+.define c20 = c0+18*c8--0
+.define c21 = (8)*19-3 + c20
+.define c22 = 6 + 15*c17 + c19*12 + 19
+.define c23 = (c21/5) + c4*c8-c8
+L23: mov #((14)-13-1), r7
+prn #c3+c13-4--0-20
+mov L13[(c8)*-0-(17)], r2
+hlt
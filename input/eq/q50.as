@@ -0,0 +1,84 @@
+prn #10/2*10*6/1
+prn #(8)
+prn #(9)+4/16-19*18/19
+.define c0 = 18 + -7/20
+.define c1 = c0
+.define c2 = -c1+18/1
+mov #c0, r1
+L0: mov #0, r4
+mov #-c2, r4
+L1: mov #((c1-9)), r5
+.define c3 = 19*c1 + c0/10
+mov L0[1], r2
+prn #12
+mov L0[c3/5], r2
+.data c0
+prn #c3
+.define c4 = (14 + 13)---11
+mov #-c0/3+1/12+16-15, r1
+cmp #c3*c1+10*16*c1*c2/5, L1[-c2-c2/1]
+L2: mov #-c2, r0
+L3: .data c0*-7-c4
+.data c2*12*18-c1, -12*3-3-16, -1-c0, 2
+mov #-0+13-17*19, r0
+.data 14, -c3, -11/4, 1
+mov #8*((c2)), r0
+.define c5 = 15
+mov #12, r6
+.define c6 = c3*-c1-12
+.define c7 = c2+(18)*(18)
+.define c8 = c0
+.define c9 = (18)+c8+c4+-16/5
+.data 4, c1+16/1*4*c4
+L4: mov #16/2, r2
+L5: mov #c6/5*19*(c3)*2/1, r5
+.define c10 = (17 + 13/4)
+mov L3[(10-14/1)], r2
+.define c11 = ((11-c6))
+.fill 2, 2
+mov L2[((1-c9))], r2
+prn #(9)
+.data 10, 4-8+c3+c0*c9+3+16
+.data 1
+L6: mov #-9+(6+c2), r5
+L7: mov #-19, r2
+L8: .data 14*-c9, -c10, --c6, 3
+mov #-13, r4
+L9: .fill 4, -((c2))
+prn #-13
+.fill 4, 3+c11/2+c11/1
+.data c5, -(c8*c5), 5/4, 13-c10/2
+mov #c6, r7
+mov L6[c10], r2
+.data (2)+11/3/5, c4
+.data (c6), (-c5/1)
+.data c0, c5
+L10: mov #12-c6*c3+10, r3
+.data c5*(c10/9), 11+-19, -c2
+mov #(20), r1
+L11: .data -20-9*c3/17
+.define c12 = ((3*5))
+L12: mov L7[10], r2
+.define c13 = 2 + 18
+.data c1*c5/12*9/4, (c1/12)/13, 8
+.define c14 = 12*8+-c5*(4)
+L13: prn #c14*c4/4/20
+mov #16/3, r4
+mov L12[(c4/3/1)], r2
+mov L8[--c7-16], r2
+.define c15 = -11/11*(18)-7
+L14: mov #c9-1-c2+c6*12, r4
+.define c16 = (4)-c8*16*(0*16)
+.fill 3, 14
+mov L7[(11/4*c15)], r2
+mov #(c8/14)/2, r0
+mov L1[c8/4], r2
+L15: .data c12-0*c3-c2*19
+.define c17 = -c11*17*c2-c12
+mov L15[c14], r2
+mov #-c17*6/2, r7
+mov L4[--c0*c9], r2
+.define c18 = 14*10/10 + 15
+.data 3-7/1+12-c0, --17-c4*20, (c11+(c10)), -c3
+.define c19 = 12
+hlt
@@ -0,0 +1,52 @@
+prn #7
+L0: mov L0[0*(20)/3], r2
+.fill 4, 1
+prn #20/16/2+14
+.define c0 = 14/5 + -18 + 0*14
+mov #c0, r4
+L1: mov #18/5/4/5, r5
+L2: mov #-c0+18/2, r2
+mov L0[c0+(3)-14/4], r2
+cmp #c0-c0/2, L0[2]
+cmp #(c0), L1[c0]
+.define c1 = 10
+mov L2[-13/3*13], r2
+mov #(5+c1)*(13), r7
+mov #13, r4
+mov L0[c1], r2
+L3: mov L2[9/2], r2
+mov L1[c1], r2
+mov #c1, r2
+L4: .data 6+c1+15*10*c0
+L5: .data -c1+c0/2, c0, 11*10*14/4
+L6: mov #3, r5
+.data -c0*9+15
+.data (c0), c0-20-c1/2
+.define c2 = (15)/19
+L7: .data ((c2+7)), c2, 6
+.data c0, 2+(c1)*c0+2+c0+c2, -c1/2-c1+c1, (15)
+.define c3 = 19/2
+L8: .fill 1, --c1*c3/5
+mov L2[18*7-6-c3], r2
+.data (18), c0, c2/2/5/3
+mov L4[c2], r2
+.define c4 = 9-7*-19 + c3-13
+.define c5 = c4*(c1) + c3
+prn #-0
+mov #20, r7
+.define c6 = c0*c5*4-1
+mov #(c6*16/20), r6
+.data (c1+16), 6
+mov #c5, r5
+mov L6[12], r2
+L9: mov #-(c3-c0), r6
+L10: mov L2[c5], r2
+mov #(c5), r7
+.define c7 = -8
+.define c8 = c1
+L11: prn #c2
+mov #c1*10*1/3, r7
+cmp #(c6)*-c2/3, L0[-8]
+.fill 2, c3
+.fill 3, (4+-c6)
+hlt
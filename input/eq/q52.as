@@ -0,0 +1,55 @@
+.define c0 = (13/4)
+prn #14
+.define c1 = c0
+L0: mov #12, r1
+mov #c0/5*c1-16, r2
+.define c2 = c1
+.define c3 = 7
+mov #c1+c0-12-c1/3, r2
+.define c4 = 11
+L1: mov L1[c1], r2
+.data c0*8, -8, -(c0/19)
+mov #c0, r4
+cmp #8, L0[16*c1-c0]
+L2: mov L2[(10)*15/1], r2
+.data ((3/12)), (16), 7, c0
+.data (c1)
+mov #-c0*8+c4-c0/5+4+c4, r1
+.data (c0)*-c0+c3, -c0+c0-c3/4
+.data 13, (c1)
+mov #4*(c1)+(c1*8), r0
+mov L0[(-c3*2)], r2
+.define c5 = c0/2-(c3)/4
+.define c6 = c5/1
+.data (c1-6)*c1
+.define c7 = 10+c5+-19+3
+.data c6+2+c2-(20)/4, (c6)
+mov #9*c1+c7+2, r4
+mov #15+16, r0
+prn #-11-c3*(3*19)
+cmp #c0/1-18/3, L0[c2]
+L3: .fill 3, 7+c0
+.data 8+c4, -c4-12+15
+mov L1[c5], r2
+mov #17, r4
+.define c8 = (4-4)/1
+.define c9 = 13/4
+L4: prn #3-18*(c8)/11
+prn #20
+.data (-8*c9+c4), (6)/3+c4-2+8+3, (c2)/1, -11/10-20-c5
+mov #c2-4+15*c6+15, r2
+prn #3/2
+.define c10 = c4 + -c8
+.data 16*c1, (c6)*20
+.fill 1, 6
+mov #19, r6
+.define c11 = (c8)
+.data 12-15*c7-4, c2
+mov #c7-c7+4, r0
+mov #c2/2, r2
+mov #19/4-17+7+-8*c9+17, r4
+.fill 2, (4/10)-17
+mov #16+0-(c8)-10--c3, r6
+L5: mov #c11, r5
+cmp #-c8/1/3, L0[7+3+c4-19-16]
+hlt
@@ -0,0 +1,99 @@
+L0: cmp #(4)/2, L0[3/2*-4/4]
+L1: mov L1[-5*1], r2
+.define c0 = 4/12-(3*6)
+.data ((c0))-19, c0
+.data (10)/5+20
+L2: mov #(c0/4)*12, r0
+.data 0/4+1+17*c0
+prn #13
+.data (c0)
+.data c0, -c0-c0/4, -c0/3, c0-1+c0/2
+.data c0+c0*c0-c0/4, 14+c0-c0+c0/2, 11/19-4/1*5*c0*c0/3, 18+c0*10*c0+-c0-c0
+.define c1 = (-16)
+.define c2 = 7
+mov #7/1, r5
+L3: mov L1[c0/4-(c2)], r2
+.define c3 = -7+-c2
+.data -c1*c3*c3+c1
+.define c4 = c2
+L4: .data -5, c1
+mov #c1+15, r1
+.data 17+-19+(c2)
+prn #17
+mov #c1, r0
+L5: mov L2[-4/1*c0/5], r2
+.define c5 = -2*17*2
+L6: prn #c4+(19)+c0*c2-c4
+mov L5[(-c5)+c5*c0-8+5], r2
+prn #-c4/5*c1+9
+L7: mov L2[c4-14-c1/1], r2
+mov #(-c2*c1), r7
+L8: .data (8), (c3)
+.define c6 = c5+c4-13/15+18
+mov L2[-10/5], r2
+.data (c4/7-5/2), (20)+3, 14-6+15*c6
+mov L5[c4], r2
+L9: mov L8[c1], r2
+mov #20-c2*c4+4/4, r7
+cmp #(3+c5+1), L2[-(c6)*c1]
+mov #(c6)+c4, r7
+mov #3, r7
+mov #13+c4, r0
+.define c7 = 7 + 12*c1*c4*5
+L10: mov #-c5, r2
+L11: mov #8, r7
+.data c3
+L12: mov L7[19*c3+20*(c0/14)], r2
+.data c6*17, c0, (-1-(1)), ((c6)*c1/9)
+mov #--c4/18, r7
+.define c8 = ((c4))/3
+L13: mov L2[-c6-(c4)], r2
+cmp #(-14+(19)), L7[-12+c7/3]
+L14: mov L1[14*c8+c5*4/9], r2
+L15: mov L5[c8+3+c5*c7/14], r2
+.data 3, 13, --19*5
+mov #(16), r2
+mov L10[10+c2-c3/9+8], r2
+mov L11[(c4/4)], r2
+mov L9[c2-8/4], r2
+L16: prn #3
+prn #c6
+.define c9 = 15
+.fill 4, c5
+L17: mov L1[15/3*c3*15], r2
+L18: mov #c2, r3
+.define c10 = c9/2
+L19: .data c3--c7/2, c2
+.data -5
+cmp #12--c4+20, L14[(19-c9+c2/14)]
+.data c7
+L20: mov #c4*17*5/4, r4
+L21: mov #--c2, r2
+mov #c10, r0
+.fill 2, c8-c6/8-c4*-c4
+mov #10-c3*17+-6-2/15, r7
+mov #c9, r5
+.define c11 = 19
+mov #c4, r6
+.define c12 = 4
+.define c13 = c9-c4/5/2
+.data 8
+mov #c13, r6
+mov #(--c0), r1
+L22: .data -c12, --c0*-c7
+.fill 4, c3
+.define c14 = c11/4
+cmp #-c11-13, L10[16*-c6*(c4+c5)]
+.define c15 = 20-1/3-(18)-c0*7
+mov #-c1*15, r6
+L23: mov #9, r7
+mov L10[c14], r2
+.data -c13+13*c0/4, (c2)/4+c7, 9, -c6+(c1)
+.data (c1)
+mov #(-c9-c8), r3
+L24: mov #-c6/1+c12*4, r4
+mov #-c8, r2
+mov L19[c6+17*-c13], r2
+mov #--16, r5
+.define c16 = 11*c13-13/4
+hlt
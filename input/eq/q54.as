@@ -0,0 +1,38 @@
+L0: .fill 4, -(1/6)
+mov #(10), r4
+L1: prn #20
+L2: .data 0+-8, 4, -19+7/5, 15
+mov #15/3, r4
+.define c0 = (11)-12 + 19-8/16
+.fill 1, 14
+mov L2[c0-10*c0+6-(16)], r2
+L3: .data 5
+.data (7-c0-15), c0, -((c0))
+.define c1 = c0
+prn #8
+L4: mov L1[c1-(16*c1)], r2
+.define c2 = 19/3/1
+.data -c0, -4, c2
+mov L0[-c0-c2], r2
+mov #3, r5
+mov #c0*4/4/2, r0
+cmp #(c1), L2[10]
+prn #14
+L5: .fill 2, -14/4
+.define c3 = -18
+.data 20+7*(c2), c0*c2+c3-9--18
+mov #-3*1*14, r4
+cmp #17/10/4*c2+5*10+c1, L4[(--0)]
+mov L0[19], r2
+cmp #19-c0*c2-c2*c2*c2*5, L1[c2-17/9/1]
+prn #10/4+(6+11)
+L6: mov L1[-c0-(c2/10)], r2
+L7: cmp #11, L1[18-12-5]
+mov #14*c3-c0*11, r1
+mov L1[c3], r2
+.define c4 = 14*c1*6-c0
+mov L4[(10)*c1], r2
+.define c5 = 17+c1+c2+17
+L8: cmp #c0, L1[--19+c4]
+mov L3[c2], r2
+hlt
@@ -0,0 +1,32 @@
+L0: prn #3
+.define c0 = (6)
+.data -c0/2
+mov L0[c0/1+-c0+8], r2
+L1: mov #20, r5
+mov L1[((8))+6], r2
+L2: mov #(c0+c0)-c0, r3
+mov #c0, r0
+L3: mov L3[7/4*c0*20-c0*4+-c0], r2
+L4: .data 2+(c0)*20+c0+-c0, (c0*19)-c0/3, c0
+mov #-5-4/1, r6
+.define c1 = 9 + -19 + c0/5 + c0
+L5: .data 18, -c1-9, (c1+c1)/3
+mov #c1-13*c0*c0, r5
+prn #2+c0-(14)/1
+.define c2 = 12/8*20-c0*c1-c0*c1
+.define c3 = -4*c0/3
+L6: mov #-14, r3
+cmp #((c1))+c2, L3[c2]
+L7: mov L1[8-18], r2
+mov #2, r2
+.data (-1/4)
+mov L4[15], r2
+mov L4[(3+12*c1+c3)], r2
+L8: mov L3[c2*14*c2*c3-c0-4-9], r2
+mov L3[--16/5], r2
+.define c4 = -20-14+13-6
+.define c5 = -c1-c0/2
+.define c6 = 6
+L9: mov #c4, r1
+L10: .data 18-c0*c0*6/7, -(2)+c6
+hlt
@@ -0,0 +1,92 @@
+.define c0 = -18/5
+prn #-c0
+.define c1 = 0*18-c0/2
+.define c2 = c0/5
+prn #1
+prn #-13/5
+.define c3 = 4-1+15
+prn #3*20+(6)/2
+.define c4 = (0)*c2*3-c3/1
+.fill 3, 1
+L0: .fill 4, (5)+-c1*7
+L1: .data -14, (c2-c0)/15, (10+c4*c4), 9*c2
+prn #c2/4
+L2: .data -13-c1/5
+L3: cmp #c4, L0[c0]
+L4: .data 9/5, 3/1
+.fill 2, c2*15-c3
+L5: cmp #c1--16/1, L0[11]
+.fill 1, c2+c1-c2-12
+.data 8, 8-19/4-7, 5/3+1/16*(19)+20*15, c3-c2/1+(20-9)
+mov #-5+c2*12-c0, r1
+mov L4[-c3*c3/5], r2
+.data c4, 17-14, 14/6
+L6: mov L0[c0-c2-12/2*0/4/2], r2
+.define c5 = c2
+.fill 3, c3-c4
+L7: mov #13, r3
+mov #-c3-c0*-5+c5, r6
+.data c2+7-12-c4, c1/5, c4
+.define c6 = 14
+.data 1
+.data c6--c4, 4, (0-c4)*14/4
+prn #c6
+.data (4)+c4/5, 4, (2)*14*8*(c4/3)
+.data c6*c4-4/10/1, 0/3, -4
+mov #19, r2
+L8: .data 13+1, c2, -17*8-7-c2+c1, 2
+mov #19, r6
+mov #-c2/1/3, r5
+mov #11, r7
+mov L1[c6*20-c2*c5+2], r2
+.fill 4, c3
+L9: mov #c4, r3
+L10: .data c0-c6-c1-0+12
+.define c7 = -4/9+(7*c6)
+.define c8 = (c6+6)*c3
+mov #1/2-8, r1
+prn #1
+mov L10[c5/20], r2
+.data c3+c7-c4-c0*4/3, 4-c3, (10)-6-0-11/2+c1/11, ((12)-(11))
+mov #-19-14*c3, r3
+mov #(((c7))), r7
+.data (c0)-11+19+1-12, c0/4, c1, 6
+L11: mov #c3, r6
+L12: mov #(18), r3
+.fill 4, 14
+L13: mov #4/5/2+3*(3), r0
+mov #14, r5
+mov L13[c3], r2
+mov #(6), r0
+mov #((c7)+-18), r1
+.define c9 = 2/4
+.data (8/4)+c4+c0/5, -c1/15
+L14: mov #c6-17/1-13, r0
+L15: mov #10/3, r5
+L16: mov L5[-(19-14)], r2
+.fill 2, 13
+mov L13[c8], r2
+L17: .data 1, c2-1+20+((3)), c9, c8+c7-18/4
+.define c10 = -1*c2/3 + c7
+.data --c9, c7, -(5)--11, ((4)*-11)
+.fill 4, c9+9/2+c4--9
+L18: .data c9, ((12))
+cmp #5/4, L9[20*c0+1-c2/4]
+.define c11 = c6/2/5
+mov L10[c2*c1], r2
+mov L4[(1)-c8*c3-c2], r2
+L19: .data (1+19+12), ((c9))*(c5*c9)
+mov L11[c5-c4], r2
+mov #-c11/1, r4
+mov L8[-9-c11/1], r2
+.data 14-c5+4+c5*c11-c4+2, c6+c10-8, c9, (0)
+L20: cmp #2, L3[1-c5-7*1+11]
+L21: .data -20+4+9/16*-c6, (-(8)), (c10-c5/2), 8*8+(4)
+mov #10, r1
+mov #17/1/1, r0
+.define c12 = 1
+L22: mov #3/7, r4
+.data (c1)-19, c9*19
+L23: mov #((c10*1)), r1
+.define c13 = c9-c3 + 9/4
+hlt
@@ -0,0 +1,26 @@
+.data 18*3/5/13, 8*16-11-13-4
+L0: .data 14, (11*9+17/1), 13*5, 5
+.define c0 = 18
+mov L0[c0], r2
+L1: mov L0[c0-13/5-c0], r2
+L2: mov L0[c0], r2
+L3: cmp #c0+12-(15)*11--c0, L0[c0-15*16+-12-7-c0]
+.define c1 = -9 + c0 + -c0*c0/10
+L4: prn #-20-c1-c1
+.define c2 = c1
+L5: mov #(-c0*c1), r1
+mov #c0+-c1/5, r6
+.define c3 = 5
+L6: mov #c3, r1
+L7: mov L6[(4)*-c0*5/1*c2], r2
+prn #5
+.define c4 = c2-c3-11
+L8: prn #-c0-c0-c2*-(c2)
+mov L4[(0/5)/3], r2
+L9: mov #18, r6
+.data 16*c0/15, c2/3-(c0)/4, (c4)/5
+L10: cmp #c4, L9[-16*c1]
+mov #c3, r5
+L11: mov #19-c0/3-17, r4
+.data 6, --11, -c1--18*(2)
+hlt
@@ -0,0 +1,95 @@
+.define c0 = (18*19)-14
+mov #12, r5
+.define c1 = 7*9
+L0: prn #(7)
+.define c2 = 19 + (c1*10)
+L1: mov #c2+(15), r1
+.define c3 = c0
+.define c4 = 8
+mov L1[-2], r2
+L2: prn #c2
+.fill 4, 18
+L3: .data 3/4+-(c2), c1+c3-(c1)/4
+.fill 3, -11*6*5
+L4: .data c2/3/4, 17-(c1)-c1*c3, -11-c1-1+20-0*c2, c0-5/1
+.data -(-c4), (-0+15)
+mov #c0/1, r1
+L5: mov #c0, r6
+L6: mov L3[12/20*(-c3)], r2
+mov #c4+c4-17-c3, r6
+prn #12/4
+.data 12+15-(13)*c1, c0, (c4*c3/4), -(c2*0)
+mov #-12/3+-c0*c0, r1
+mov #c1, r6
+L7: .data -16/2*-c4/5, (9)/3, c2, 20*16/5
+mov L7[c4*0*17-5/3], r2
+mov #11--c0, r6
+L8: mov #-14+13+6, r3
+prn #c3
+L9: mov #(c4)*20, r7
+.define c5 = -5--14/1
+.data 3, 11, (8*c5)*-c1*2+17, 5
+L10: .data 6/1, 5, 1/5
+mov L9[12-3+c5/16*1*20/6], r2
+.data c1+c5+13+18/14
+.data c1, 9-6/3+c0, c5/1
+prn #(c1)/5-8/2
+prn #c2-10+(c4*c4)
+.fill 4, 1*c3/2/5
+L11: mov #c4/14, r0
+mov #c0-(c5), r0
+.data -(14-c4)
+L12: .data c2, c3
+.data --15/2, c3
+.define c6 = 7*-13-c1+c4
+.data c4*-0+-18-c3-c6, 19
+.fill 4, c1*20
+.define c7 = c2
+L13: prn #(c2*c6)/1
+L14: mov #-c6+-17+c4, r4
+mov L14[c2], r2
+.fill 1, -4
+mov L5[-13-c7*15*c2+14/5], r2
+L15: mov L14[c4/2-c6-11-20], r2
+.data 7, c2*c0+-c1--c0, c7, c0
+mov #c5, r4
+.define c8 = 11*(6)/2
+mov #(6/15), r6
+mov #(12)*c2-c0+c8, r2
+mov #-7, r7
+.define c9 = (6-8-(2))
+.data c8-c6-4*2/1
+.define c10 = ((c4*c7))
+mov #15, r0
+mov L13[c9], r2
+.define c11 = (-c7) + c6/4 + c7 + 6
+.define c12 = (c7+c9/5)
+.define c13 = c5/4
+mov #6, r5
+mov #2, r3
+prn #-10/3+c0
+L16: mov #--c6/1, r5
+.data 11/2, c13*6+7/1, c2, 0
+.define c14 = c7*16/5*(c2-c2)
+L17: mov #(c10)*7/2, r0
+L18: mov L11[(15*c13)*c12], r2
+mov L10[-(17)], r2
+L19: mov L5[13-c14+c4+13], r2
+.data 18*c13*9-c9*2, c3-7*5*20*12-c1*c11
+.define c15 = c14
+mov L14[c3*16+(9)], r2
+.define c16 = (13/1) + -1-c8/1
+.fill 3, c7-19*9-(13)/17
+.define c17 = c11
+.data c10+c9/2+6+0-1, c0, ((18)), c8
+L20: cmp #(c6), L13[9]
+mov L11[c17], r2
+L21: mov L0[-9-c8/1], r2
+mov L16[c4+17/7-c10], r2
+L22: mov #c9, r1
+cmp #-12*19*c9-16, L10[c5]
+.define c18 = 0
+.define c19 = -4+11
+mov L11[15], r2
+L23: mov #-(10)+20-c16+c14, r5
+hlt
@@ -0,0 +1,49 @@
+.define c0 = (9)
+L0: mov #-c0/1, r0
+.define c1 = 8-c0-12 + c0 + c0
+mov #7, r6
+.data c1+c0+-11, (c1), -10-c1*c0
+.fill 1, 1
+.data c1*((7)), 5, 2
+mov #c0+c0-0*5, r5
+.fill 4, -5
+mov #c1+5/2*12/18, r3
+.define c2 = c0
+mov #10/5/4-(19)/1, r7
+.define c3 = c0
+cmp #(c2)*c3+c1, L0[c3]
+.fill 1, c2+c1/1
+mov L0[c1+c1+0*(16)-(19)], r2
+mov #c2--c0, r6
+mov #c0-c3*c2/5, r0
+.define c4 = -11
+L1: prn #c1
+cmp #13+(c3)+(6), L0[--3*14/4]
+cmp #c1, L0[-c1]
+L2: mov #-c3/14-(c2)-(8), r1
+mov L0[-(16)*c0-c3-12], r2
+prn #4/20-4-c4-13
+mov #13, r6
+.data -13/10*c4/1, 2/2
+prn #19*12-c1
+.data 19, -20-16/1
+mov L2[--c4], r2
+.data -(c2)/1, -c4*c2-13, c1+c4
+.define c5 = c3/3+3
+.define c6 = c0
+.data c0+c1, 5
+.data c0+17+c2+c6, (c3)
+mov #3+c1+20+-3/12, r2
+.data 10*c1+c0/4+17
+mov L2[-20-c4+-20], r2
+L3: mov L2[c4], r2
+prn #(11-3-18)
+.define c7 = c1/4*--18
+.data c7/4, 7
+L4: .data (-20*c2), 6, ((c3))/1, 7*10+4/2
+L5: mov L2[16], r2
+mov #c5/5, r3
+.define c8 = (13)
+.define c9 = -c5-20/3
+.define c10 = c9+18+(9)*-8
+hlt
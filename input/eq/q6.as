@@ -0,0 +1,94 @@
+prn #0
+.define c0 = 13/2/5*-15
+L0: .fill 2, 16-c0*(c0)*c0
+.define c1 = 12
+.define c2 = c1*-c1 + c1
+.fill 1, (c1-8)/3
+mov #18*1*-c0/4, r1
+mov #8+c0-c2-3/2, r7
+L1: mov #2-11/5, r4
+.data (-10-17), -6, c0*-c2-c0+c2, c1-12*c0/5
+L2: mov L2[c2*10/3*c2-c0+c2/9], r2
+mov #8-c1+c1+-c2, r3
+.define c3 = 12
+.fill 4, (17)+c3+16*6
+mov L2[(4-c3)-c0/2], r2
+mov #-7/2, r2
+L3: prn #c3
+mov #6, r5
+mov L2[11*-c2+c0+10], r2
+mov #(4), r1
+prn #(17+c0)-8-c2/2
+L4: mov #c1, r4
+.define c4 = c2
+mov L0[(8)+c0+19*(3)*7], r2
+mov #-16-c4*13, r0
+.define c5 = (c0*c2-c0*c2)
+mov L3[20], r2
+mov #c1, r1
+.define c6 = 5
+.define c7 = c6-20-c3*18-14/2
+.data -5*7+9, -(19*c7), c0, 0/1*c0*8-19/1
+mov L3[c2/4], r2
+.data c4+0/5+c3+20-(1), c4, 6
+mov #c5-c6-c0-13/19, r5
+mov L2[17*(c4)*c4/3], r2
+.define c8 = -c0
+.data c8, 9*19/1+c0+6
+.define c9 = -5
+mov #c8, r0
+.data 13-(7/12), 7-c3/10, 19+-c6
+.define c10 = c5
+.define c11 = 20--1-c10
+L5: mov #10, r5
+L6: cmp #(5/1), L6[0]
+L7: .fill 1, c3*6
+L8: mov #c2+c2/5/5, r0
+mov #-3+7-14/3, r2
+.define c12 = c4*1
+.data 4+-10+c8, c11, c7+-4-10
+L9: prn #0+c3*c8+((1))
+mov #c0, r1
+L10: mov L3[c10], r2
+.data c7, c10, c1
+mov L7[7], r2
+mov #-c5, r1
+L11: cmp #-c1, L6[(c11/3)*20-c1]
+.data c8/3*c0*6+c4*13, c9, c3+15-9/3
+mov #17+17-c7+(8), r6
+L12: .data 9*c5-(8)-c10, (1+c12+c11)
+mov #c4+c3-c9+c6/10, r2
+cmp #c10/5, L1[12]
+.define c13 = 19
+.data 9--c12-c1*17
+.data (-c0/4), -15, c11/5, -c8
+mov #6, r3
+.define c14 = (0)+(c7*c5)
+L13: cmp #13, L2[c10]
+.fill 2, 6
+cmp #2-(c0), L13[(-2*c10-c2)]
+L14: mov #c9+c10+c12*20/1, r1
+.define c15 = 9+-3/4
+.data 15+c0+c8-7, -c6/4/2, -(9)+7+c9
+L15: .data -c6+11
+mov #(7*10*c5), r1
+.data c3, 17, 1, ((-6))
+mov L2[6*13--13], r2
+.fill 1, -15
+mov #-c15, r2
+L16: mov #c10*c5--2+-2*20*c3, r5
+.data 16
+.define c16 = c4
+mov L8[17], r2
+.define c17 = c5*12-c8-c2
+.define c18 = -c11
+mov L9[4-c11-8], r2
+mov #(c3)-7-20-c7+c8/7, r3
+mov L7[c3], r2
+mov L10[c13], r2
+mov #c1, r7
+L17: mov L15[c18], r2
+L18: prn #c8
+.define c19 = c15
+mov L4[c2], r2
+hlt
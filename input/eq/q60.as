@@ -0,0 +1,60 @@
+L0: .data 1-17-19/4, 15-3+6-8+7-18
+L1: .data 17
+L2: mov L1[15-(13)/1], r2
+prn #1
+mov #8+(7)-7--15, r7
+L3: mov L1[7], r2
+mov L1[12*1], r2
+L4: mov #-0+4, r7
+L5: mov #18-(0/17), r5
+.data 18/1/18, 20-14--5-(18), 18, (18)+4/5
+mov #(6)--6*18+2-4, r2
+L6: .data 13/5, -20, (-14/16), 6--11-8
+mov L5[6-15+14/6], r2
+L7: .data 13
+.data 18*14*16+3*(14)*17
+.define c0 = 18 + 17-16*-16
+.define c1 = -c0-(c0)*c0
+.data (16/1), c1*c1-7-c0-c1, --c1/1
+mov #c0+(c1-8), r5
+cmp #(19)*-1*14, L4[-c0]
+.fill 1, c0
+.define c2 = 8+-c0-c1/2
+mov L0[12/4/2+0/15*(11)], r2
+.data (10*c2)+-11*15*c0, 4+11/1-12
+.data c2, 12*9-c2+15, c1-7-(c2)/2, -13
+mov L0[c1], r2
+L8: mov L5[18], r2
+mov L2[6+9/3-5+20], r2
+mov #-(c0)/5, r7
+.define c3 = c2*5+-c2-c2
+cmp #11, L0[c1]
+L9: .fill 1, 17
+mov L2[(c2*18)*-c0+c3], r2
+L10: mov #c3*12*16+20+c2-4-15, r4
+.define c4 = -6
+mov #-c4*19+c1-2, r5
+.data c1, c2, -(-c1), 10
+.data c2
+.define c5 = 13*c3/5-(18*5)
+.fill 4, c3+-17+c0
+mov #-c3*c3*18--(c1), r7
+mov #c4/4/5/5, r6
+L11: .data c5
+.data -15
+mov #c0, r1
+mov #c3, r2
+mov L9[14-(-4)], r2
+mov L9[7+c2-6], r2
+L12: mov #c1, r4
+.fill 1, c5--9/3
+mov #(c3), r0
+.define c6 = 1 + (-16)
+mov #15, r6
+.data (11+17/3)
+mov #c4, r1
+cmp #16, L10[c4/4]
+cmp #c3, L6[3]
+mov #(c2-1)*c4+c1-6, r7
+L13: mov L4[(2+c3*7-c6)], r2
+hlt
@@ -0,0 +1,84 @@
+.define c0 = 12*4 + 10*-10/2
+.data (--19), c0, 15
+.define c1 = -c0 + (c0)
+mov #-c0, r4
+mov #(c1-c1*c0*16), r6
+L0: .data c1, 4
+L1: mov #(c0)-c0, r6
+mov #3-c0*8*c1+c1-1*c0, r2
+mov #(3), r5
+.define c2 = (c1)
+mov #5-12+19*c0/2, r4
+mov L1[c1--10], r2
+prn #-c0/14*6
+L2: .data 2, c0*c2
+prn #7+c0+16-4
+L3: mov L0[c1*c0--c2-11-c0], r2
+L4: mov #c0, r2
+mov #15, r7
+.define c3 = -(c0-11)
+L5: .data -13*c0+c2-15, 6
+L6: mov L0[(20)--(18)], r2
+prn #14
+mov #(c1)+c1-1+c0, r6
+.data (c0/5)*6, 13-c3
+.data -(12+c1), (6), 19+c3/4-5
+L7: cmp #(-c2)-5, L6[18+-c2*2]
+cmp #8+-12/4, L7[c0-c3-c2*10]
+L8: mov L8[6], r2
+.define c4 = c2/1
+mov #(c1-c2)-18+6-c3, r2
+L9: .data 5, c0
+.define c5 = c0/1*7-5*(c4)
+mov #(17)/5, r7
+mov L8[-c4+c3/1], r2
+.define c6 = (-2/2)
+mov #c3+c0/1+c1, r7
+mov #c6, r5
+mov L7[c0+c0*c5/5], r2
+prn #-20+c6/6
+mov #-c2-4-14-c4, r0
+.fill 2, --3*6-15
+.data 18*c2*19+15+4
+.define c7 = -c6*15-c4-20
+.data -c1-c5/1, 4*c6/2/1, c4+4-1+3*c5*6*5
+mov #c3*1*0-c3, r3
+mov L4[-10/5*-9], r2
+prn #c1
+mov #5-c3+7+c1/18, r1
+L10: prn #-15
+L11: mov L7[c2], r2
+.data -2+9*0/4+6*c5, 14
+.data (c4+6/3), 2*c3*c7/8
+.define c8 = (19) + c6*c7
+.define c9 = c8 + 11/1/3
+L12: mov #3-10*c6-7, r7
+prn #c6+9/4*c3*c3/1
+L13: prn #19/1-c5+c0+c7
+mov L5[c0--c0/5], r2
+mov L10[-0+c4-c3*13/2/3], r2
+mov #c0, r2
+.define c10 = 4
+L14: .fill 4, 20
+.define c11 = 19
+L15: .data -18+2+15+c9-c10, -(c6)/3, -3-0-c9, -c3+c6--c0
+mov #15/20-20/2*-8-6, r3
+.data c9+9*-9, c8
+mov #-18-c11, r2
+prn #c1-5+18*(4)
+mov L9[(2*-c2)], r2
+.fill 4, -(15)
+.define c12 = c7
+.define c13 = -1 + 14-c1 + c7/12
+L16: prn #c0+c5/5+-0*13
+L17: prn #(15/5)+1
+L18: .data 14, 15, c5, (c1)
+.define c14 = -c5 + c7/8
+.define c15 = -(16/2)
+mov #-c3-14*10/3, r1
+L19: mov L13[(c11/20*c7-c1)], r2
+.define c16 = ((c7+c5))
+.define c17 = 19
+mov L15[c0], r2
+L20: mov L8[19], r2
+hlt
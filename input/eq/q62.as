@@ -0,0 +1,94 @@
+.define c0 = 14
+L0: mov #c0, r2
+L1: cmp #(18), L0[c0-c0*(c0)+-(c0)]
+.define c1 = c0
+mov L0[--c1*c0], r2
+.define c2 = 10
+prn #c0
+prn #c2/3
+.data -19, -11/1*13/5
+.define c3 = (6)*0*1/5
+.data -c3+c0*19+11
+L2: mov L1[c1-c1+19*(11)*c1+c2], r2
+cmp #--10+19/5, L1[c3]
+.data c2, (c1), -19/2+c1, ((c0))
+cmp #-(16/5), L1[(c3-1*16/5)]
+cmp #c1/8/5/5, L2[0*c3]
+L3: mov #c2+-c2+c0-4, r1
+L4: .data 13*c3-c0/1
+.define c4 = c3*9*c0*19 + 8*6*c2
+.define c5 = 6-(3)
+mov #c0, r2
+.define c6 = ((c4))/5
+L5: .data 0/5, 11-13/6
+.fill 1, -c1*(c5)+-1
+mov #9*c1*10/2*0+c5+(c6), r1
+.define c7 = c1
+mov #6/3/3, r1
+.data c4, c7
+.data c5/1-c6+c2/11/8
+cmp #(c4+16/3), L2[((c7)+(8))]
+mov #-7, r4
+prn #17
+.data -c4*c4, c5, c2
+mov L3[c5], r2
+.define c8 = c7-7-c1-c7*c3/5
+mov #c0, r3
+mov L5[14+c2/8+c6+5+9], r2
+.define c9 = c6
+L6: .data 6, (c4*c3/1), c2
+L7: .data c3
+.data 9
+L8: mov L7[c0], r2
+.data 1, -16, 17
+mov #c7-c7+c3+18, r0
+.define c10 = -c1 + 4/1
+.data -5/2+c6*18-7-6, 15, c7/5
+L9: mov #-19/18/5, r0
+mov #-c9/2+c0+8, r2
+L10: mov L0[2-4/4*18], r2
+L11: mov L3[9+20*c6+c0], r2
+prn #(0)/4
+L12: mov L4[11+c6-17+c1], r2
+.define c11 = 11*0
+.data (c11/4)
+.define c12 = --18/5
+L13: mov L9[c4*c12-c6-1+9/1], r2
+mov L13[c2-14+c3], r2
+L14: .data -(c11/14), 12-12/4-c4+c8--c5, (20*6*c7)
+L15: prn #(c0/2-c5/4)
+mov L7[-7*c8/16], r2
+.data -15+(-17), 2+19+6/2
+mov L11[-4+c11], r2
+.data c0, c8*9+c8-1/3
+.define c13 = c2
+.define c14 = c13+10/2-c8/4
+.fill 1, c7
+L16: .data c13, (0)*9*c4/5, 11-c5-8*c9
+L17: .data c4-10/19+c3/8, -12*20-17*5
+mov L11[(-c13)], r2
+L18: .data 1/12+c13*17
+L19: .data (-7+c12)
+L20: mov #c13, r6
+mov #4, r7
+mov #c12, r3
+.define c15 = c3
+prn #1
+L21: prn #13
+.data c1*15*(16)-(c9)
+prn #11
+L22: mov #(19/8)+-13/13, r7
+.data 12, 9, 9*9/4, c6
+L23: mov #c10+c1/3*c1, r1
+L24: .data c6*17/2, 0
+mov #c7/5*c14, r3
+L25: .fill 4, (c11)*1
+L26: mov L11[0*17*(c10)], r2
+L27: cmp #(20+8)+-c4, L26[c0+2]
+.define c16 = (c1*c5+c0)
+L28: mov #10-c14*c15+c1/5, r5
+.define c17 = 3/2+-15*-c0
+L29: mov L14[c6], r2
+L30: .data (c3*7)+(2), 3, 13+c16+1/1, c0/2/2-5/1
+L31: .fill 4, c6/2*c14*10-7
+hlt
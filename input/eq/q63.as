@@ -0,0 +1,77 @@
+.fill 3, (2)
+.define c0 = 20
+L0: mov L0[-1], r2
+prn #c0/3+5-c0/1
+prn #c0-c0/1+c0
+.define c1 = c0
+L1: .fill 4, 18*1
+mov L1[(19)], r2
+prn #(15)
+.data --14+11/4, -c1, 13
+mov #-20*c0+-3/5, r0
+.define c2 = (13)
+mov #--10/5, r6
+.define c3 = (c2)
+.data 10+13+c1-c0, c1*c2+c2+18-c3, 4/19/3+9, 0+3
+.data (13+c0)/3, c3+c3+14-c2+(c3/14), 1, 0
+L2: mov L0[(c2)*5*8/5], r2
+L3: mov L1[-7/3+c0], r2
+.define c4 = 4
+mov L3[19/5-c3/1], r2
+prn #8
+L4: cmp #-c4, L2[(c2)-12/7-c1]
+mov L2[18], r2
+L5: .data 7-2--10+15-c1/1, 9-5
+prn #-c3
+.fill 3, c3+17/4-(17)-c0-c3
+mov L1[c3-18*c4+c2+c4], r2
+.define c5 = 2+c4*(c4)*0*c1+3/2
+prn #c2-11+18*-11
+cmp #-5/3/4, L2[15*17/5/2]
+.define c6 = c2
+mov #17, r2
+mov L2[c0*c5+c3+c5*-c6+c4], r2
+.define c7 = -c3*12+c3*c4/9
+mov L0[(18+c4/4)], r2
+mov #-c2, r2
+L6: mov #-12*20+-5, r5
+mov #c0, r0
+mov #-c4+c7--c4-c0, r0
+.define c8 = c6-15*2*18
+L7: mov L4[1], r2
+prn #-c4+c0
+mov #c7*(c2-c8), r7
+.fill 2, c2/5
+.define c9 = 2
+mov #c9, r1
+L8: mov L1[c3/3+(c3)], r2
+mov #(c6)-c4/2, r1
+mov L1[5/20*9*14+c1+c1*8], r2
+L9: mov #8, r7
+mov L5[11], r2
+L10: mov L8[c4], r2
+mov L4[(c2-c1/4)], r2
+mov #(-c1-3), r4
+mov L1[4/5], r2
+.define c10 = -15/1/5
+prn #(0-8/2)
+.define c11 = c7
+.define c12 = c3/8*c4-c2*0 + 6
+mov #c9+13+c0/1, r7
+.define c13 = ((c7))/4
+mov L7[-8/5], r2
+L11: .data c8-c2*c8*5-c2, c2, 15*c0/5, c3-17+9*20/4
+L12: mov #13-2+(11)+c3, r2
+mov L6[c2+1+c1+19/4], r2
+mov #5, r5
+mov L5[c9], r2
+mov #20*c5+-3, r6
+.define c14 = --12-c7
+mov #c10*c13*c13+12/4, r2
+.fill 1, 10
+.define c15 = -3-14+c6-c6
+.data c8-9/3-c8+8, 12/9/1, c14-14, (c13)
+.define c16 = -(0)-c9
+prn #c14*(-c10)
+.data -c14*12*15, c3, c11
+hlt
@@ -0,0 +1,81 @@
+.define c0 = 0-0-13+8
+.define c1 = c0/5*c0
+.data c0+c1-c1*7+c0, c0
+prn #2-c0/3*c0*3/1
+L0: .data 12*c0+(c0)*19+16/1, c1, c1, (c1)
+L1: mov #(c1+20)/2, r6
+.data 12+17*(c0)/1
+.fill 4, c1
+L2: mov #c0, r6
+mov #c1, r2
+prn #(13)-c0+12--8
+.data c1*c0/19, (c1)/1/4, (17), 0
+L3: mov L1[c0], r2
+.define c2 = 6*12+9/2
+.data 15-4*c0-11, (9), 12, (0/3)
+mov #(0/3+c2-7), r6
+prn #8
+mov #-15, r6
+prn #-c2+11
+.data -(17-c0), 4*c1*(c2/2)
+.fill 2, 5+14+c1*9-c2*c2/1
+L4: mov L1[c2], r2
+mov #-16, r1
+.define c3 = ((1))-(c0+3)
+L5: .data ((-20)), 0/1/4, 15*c3*-c2/2, 5/3
+L6: mov #-(0)+(1+c2), r6
+mov L0[15], r2
+.data (17/4-3/17), 10*18+c3*c0-c2*c0/5, c3+18+14-c3+c2
+.data 12, 6, 9/5
+mov L6[c2/4], r2
+mov #c1*c1/3, r4
+mov L5[(c3-c1)-11], r2
+.define c4 = --16-15/18
+mov L2[--c1+-17], r2
+.define c5 = --16*c3
+L7: mov #-c2*6+-(c4), r0
+L8: mov #6/3-c1-12-c2/3, r4
+.data 11*c3+8*(10), c3+c0+c0-(4)
+.define c6 = -c5
+mov #7, r7
+L9: .data (c3), c2*c6*9/5
+cmp #(-c3)/4, L7[-6-2/4]
+prn #5
+.define c7 = -2
+mov L5[c3], r2
+mov L8[-c5-8*c2-2/13], r2
+mov #10, r6
+L10: mov #(1), r6
+prn #4
+.define c8 = c5/7+(c0)-17*3/1
+.define c9 = 14 + (5 + 9)
+L11: mov L8[((12-20))], r2
+.define c10 = c7*9 + 0/14 + 13 + 10-12
+prn #((9))-c9*20+11
+.data c7, 7*14-c5+c8*(c8)
+mov #19+7+9/1, r6
+.data c9*-2-18, 14, c7-15+7-c4-16/5, c7
+.data 17+c3
+mov #5+c7-1-11, r1
+prn #c4
+L12: mov #c1, r5
+L13: cmp #c10*6-c0/5-(6), L0[-6*8+13+-0]
+.define c11 = -c4
+prn #-(10)/1
+L14: .data -20, (c4)+c1/17+12, c5
+L15: .fill 1, (20+c0)*(14)
+mov #-c10+c11-c9-c11, r2
+mov L3[16-(0)], r2
+mov L4[-c10*c3/1], r2
+prn #8-19*11-0
+mov #(-c11*c2), r2
+mov L4[-10*12+c6*c5], r2
+.define c12 = 2
+.define c13 = 10-c6 + 13-8 + c2
+.data c0, 13*-(14)
+.define c14 = -17/3-c10
+.define c15 = c12-20-c9-10-c12/2/5
+.data c13-(3)-15/1, c13*12/3+c5*14*13, (18)+c14/3
+.data -18*c2/1, 0-c14/3, 19
+.fill 1, -c10+c4+c0-c9
+hlt
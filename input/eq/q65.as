@@ -0,0 +1,74 @@
+.data (20*14/2), (11-3*16)
+.data 17*13*10--(0), 5
+mov #(14+2/3), r2
+L0: cmp #13, L0[9-6/5+9*16/15]
+.data (10/8*16/7), 11
+.data 15+1+11-18+18, 15, -17/4/1, (6+3-17*19)
+.data 5, 19/16+(0)-10+1, -17*0+0+8/3
+mov #1*11*14/20, r2
+L1: mov L0[-19], r2
+.define c0 = 13
+.data -(c0)/1, 19+c0/3/2
+.data c0, c0
+.data c0, -c0-((c0)), 12+20/4+-19, ((16)--c0)
+cmp #c0--c0+9, L0[19/2*6+19/1]
+cmp #(-6), L0[c0]
+.data 3, c0/2/2+c0+c0-17+12, 5-(15)+5
+.define c1 = c0*c0+20*c0-7/4
+mov #c0, r7
+L2: mov L2[7-20/1+-c0-2+7], r2
+L3: mov L0[c0], r2
+cmp #18/3+10/2, L0[8]
+L4: mov #c1/5, r3
+.define c2 = c1
+L5: mov L0[14-11*7+(9)], r2
+.define c3 = 6 + 5--c1-(c0)*19
+.fill 4, -c1-6*2/9
+L6: cmp #16, L3[-c0-c2--c0]
+L7: mov #1+8+17/1, r4
+mov #(c3)+-11*9*c1, r4
+.define c4 = c1*-1+c1
+L8: mov L8[-c4*c0/11+17/1], r2
+.data c3*(0)+-c3/5, c0/3/5/3, c3--c3-c4
+.data (14*c4*c2)
+.define c5 = (20)
+mov L0[18], r2
+.fill 2, 11
+.define c6 = 0-11-c2+c4
+.data ((c0+16)), -c4+c3*c4-c4, 10+7+c0*19+c0
+L9: mov L1[-(c3)-11], r2
+.define c7 = c1
+mov L4[4/9--c0*(c4)+(c5)], r2
+L10: .data c2, c1+12*6-(9/5)
+L11: prn #14
+L12: mov #(20-16)/5, r0
+mov #7, r5
+.data 11, (-c5/2)
+L13: .fill 3, (-9*19)
+.define c8 = (c7)*c2*20+11
+L14: .fill 3, -2-12
+.data (8-c2)*11+16-2, (6+0)*(c4), 2/2/1*c3, 18
+mov L12[1], r2
+.define c9 = c8 + 7/2/1
+L15: mov #3*-16*19, r7
+L16: mov #2, r4
+L17: mov #15/3+(c6), r7
+.define c10 = -c4 + c7-16
+mov #c10+c5+(5)*2*(c1), r3
+.define c11 = c10+2*17*12
+prn #6*11
+L18: prn #c8
+mov #13, r4
+L19: mov L10[c7], r2
+L20: cmp #18, L11[19+3/4/4]
+mov #c10, r3
+L21: mov #18/2, r7
+mov #15, r4
+mov #0, r2
+.define c12 = 15/1
+.define c13 = 2*(5)-(0)
+mov #c13/9-3/2, r7
+L22: mov #19/3, r0
+mov #9+c6+14*2/3, r2
+.define c14 = 8*4 + 17*3/4
+hlt
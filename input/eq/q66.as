@@ -0,0 +1,30 @@
+.data 17, 15, 16, 2
+prn #(19/6+0/11)
+mov #6, r5
+prn #(3)/2
+.data 5/19+10+10/2
+prn #1
+prn #12
+.define c0 = 17-2-1 + 18 + 9
+L0: .data (c0), -c0-c0*12-(3-0), c0/2
+cmp #(-12)--20, L0[-c0+10/4]
+L1: prn #10
+mov L0[7-11-c0+7+-c0+c0*10], r2
+prn #c0-13
+.data c0+12+0-c0/7, 14+9-c0, 14
+mov #(c0)/5, r5
+mov #11/1+-15/4, r1
+.define c1 = --c0 + -15
+mov #12, r5
+.data -12/1+c1, 7
+L2: mov #-15*c1*c1*c0, r3
+prn #c1-8/4-c1+0
+L3: mov #19/3+8/3, r5
+L4: mov L0[20], r2
+.define c2 = c1
+mov #-c0, r6
+L5: mov L2[c0], r2
+.define c3 = 15
+.define c4 = (c3)
+L6: mov #-11-(2)-(0)/2, r2
+hlt
@@ -0,0 +1,30 @@
+.define c0 = (19)
+mov #c0, r4
+.define c1 = c0
+prn #-0/5-20*14
+mov #c0, r2
+mov #(-18), r7
+.define c2 = c0/1
+L0: mov L0[14*c1--(12)], r2
+.define c3 = c0+3*11*c0-14+c2+c2
+mov #-c1-c2+9+10, r1
+.data --c2+c2+c2-20
+mov #c0, r0
+L1: mov #(c0+19)-c0*c2-c2/7, r0
+mov #--c3*17, r1
+.define c4 = c0 + 16-9 + (c2)
+mov #c2-4-0+(9), r2
+.define c5 = 4
+.fill 2, (c0+3-0)
+L2: mov #9-c1/2+(c0), r7
+.data 2*(19+c5), -12, 7-5-c4+-c2/6, c5/3*c4*(0-9)
+mov #-7+13/5, r5
+L3: .data 10, -c3*(c0)*c2/3
+.define c6 = c3
+.define c7 = 9*6*c4/3
+.fill 2, c5
+L4: .data (8+9)+11*c3/3, c3/1--c3+20, 10+((c0))
+L5: mov #c6*-2*c7, r2
+mov #1/4+(0)+17+6+c0, r1
+L6: prn #c7
+hlt
@@ -0,0 +1,115 @@
+mov #10+15+(5)-(10), r0
+.define c0 = 6
+prn #-17
+prn #(8)/4*0
+.fill 1, 12
+prn #11
+prn #18
+.data 10*c0-c0/3/5, (c0)+11-c0/3, c0, 15*c0-9+15
+.define c1 = -c0 + c0 + 5
+.define c2 = 20*c1*(c1)
+.data -c1/3-c0+c1+c0, c1-c0+(6)--6/2
+L0: mov #((5)+6+19), r1
+.define c3 = 13
+L1: mov L0[((c1*0))], r2
+mov #17/4, r7
+cmp #20, L1[1]
+.define c4 = c1-c1-(c0)---c3
+.define c5 = (-c1)--c0/10
+.data c0, 15/2, c0, c0
+.data 2+(c5), 8*c3/4--c0
+prn #-c0+c2+c3+c3
+mov #3-c0-c0-18-c4, r1
+.define c6 = (c2)
+.define c7 = 8*c4
+.define c8 = 16
+.define c9 = 8 + 10
+L2: .fill 1, 4
+.data 5-13-13/3, c2*c1-(c4)-c8+c0, 12/2, c6*c1/2
+mov L1[c9--7+c0], r2
+mov #(-5)*(1), r5
+L3: prn #c7
+.define c10 = (15/1)-c1/3*7
+.define c11 = c4+3*c0*c0+c8+c1
+.data -(14)/5
+.define c12 = c6/10*c9-c9/5
+.data (20), c7+10*7-c4+14, 18
+mov L3[(19/5)], r2
+mov #1, r5
+cmp #c6+c1+2/8*10, L1[c8]
+mov #c12, r3
+.data -(13*8), -c12*c4*13, (c5-1+4), c6
+mov #c11-c5-12-15, r0
+L4: mov #(15)/3-19/14/5, r3
+L5: mov L5[-c7], r2
+mov #7/1, r4
+L6: .data 1-c7+c7/16
+.define c13 = c12/3 + -0/4
+.define c14 = -16/8/5
+mov #((3*c4)), r0
+L7: prn #(c12)
+cmp #-5*c6+10, L4[c5*-0/15]
+cmp #((12)), L0[19]
+.fill 1, -13+c5
+mov L5[c3], r2
+mov #c10/1, r6
+prn #9
+L8: cmp #13, L7[c7]
+mov L3[-2*14], r2
+mov #(c7-1)*(c6)/4, r5
+.data 3, c11
+.define c15 = -12
+L9: .data c11
+prn #c5/4
+.define c16 = 20-c3
+.data c9/3, (-c4+c16)
+mov #12+c0*18/4, r1
+cmp #-19+-17*12*0+c10, L3[c10*6-0/1-(19)/5]
+.fill 1, (c16)-13
+.data c9/3, ((c0*c16)), 14+-15+2-16*13/3, 3
+L10: .fill 1, c12*5/14+c15
+.data c9+1+10*c1*7+2, c1, c6, c3
+prn #-0/1+c6/1/4
+.fill 4, c7
+.define c17 = -0*15*20
+mov #14, r2
+.define c18 = -c7
+L11: .data -c17+c5*-(6), 18+9*-13/1, c8, ((c6))/5
+cmp #1, L11[(c2)*-c15]
+.data c7, 16/12*c0+c2-c2+c5, (c2-13-3), (c4/10)-c6
+prn #1*c14/1+c15-4-(9)
+.define c19 = -19
+.data 7, -3+20/5/2, 16+c6-c0*(7*c14), (16+14)+-12/1
+.define c20 = (6)+0+((8))
+mov #c14, r3
+.fill 3, -c4+c7
+cmp #c19+0, L3[--8*c9*14/3]
+cmp #(14/4-6*12), L0[3*c3*c2/5]
+mov L1[c0], r2
+.fill 2, (2*c15+c4)
+.define c21 = (c18 + 3)--c17/2
+.define c22 = (c4)-(c13)*c1
+prn #--c11*c10
+mov #c20*-c7, r3
+.data 11*3/3, 10+12*9/2, 17*14/5
+mov L6[c2*(18)], r2
+.data (6+9)-2, (c11)-c20, --c1/3
+.data 11, (-10)/3
+mov L11[-4-14*0+c7], r2
+mov #c17, r2
+L12: prn #(17)*c5-6*c14/9
+L13: mov #-1*11*3, r5
+mov #c11+c0, r7
+mov #c20, r6
+.define c23 = (c3)/1--c12
+L14: mov #(16*6)/1, r4
+L15: mov L7[-14/19], r2
+.define c24 = 5-c23 + 5/3
+mov L3[5], r2
+.data (c19+c5)--c18+c5, -c1+c16-(4/13)
+L16: mov #(c18), r1
+mov L0[(c0-c2+17)], r2
+.define c25 = -c15*-5
+mov #0, r3
+.define c26 = 16
+hlt
@@ -0,0 +1,108 @@
+.define c0 = 11
+prn #6-(c0)/5
+mov #19-c0, r5
+L0: cmp #c0, L0[c0]
+mov L0[c0], r2
+.data c0, 20, c0--1/5
+.define c1 = (12)
+prn #(c0)
+mov #c0*c1+15+14*c0, r2
+.define c2 = c1*15*9+-c0-c0
+.define c3 = 20
+L1: mov #--c1, r5
+.define c4 = 4+c3*8*0/1
+L2: .fill 4, -(10)-c2*c0
+.data 13
+mov L0[c2+c2/5*10/3], r2
+.define c5 = -5
+.data c1*7*9-c5*13
+.define c6 = ((c1))
+mov #c2---c6, r1
+prn #c6
+L3: prn #c1*c0+7/2
+mov #8, r6
+.define c7 = c0/5
+mov #(12)*2/17*c3*15-18, r0
+mov #4*c6, r7
+mov #-c4*c5/16, r6
+.data -c4*18, c7/1/4/1, 6-c6+6/1, c6
+mov L1[(15)], r2
+.define c8 = c7 + c5/2*c6
+mov L1[2], r2
+.define c9 = c8
+mov #c1-(c2*c0), r6
+.define c10 = 9--16/4
+L4: .fill 1, (19*6)*-c7+c6
+mov #2*10*c3*(c4), r2
+prn #c1+12*c0*-3/2
+mov #c1*20+-c1, r1
+.define c11 = 4-6 + -c0-c2*-18
+.data 8-c1+-c1-c8, c6, c10*12*c10+13, (12*0)+-17*c6
+L5: mov #20, r6
+mov L4[c10--c6+7], r2
+.data c6, c3/2, 18, 15
+.data 10*c5/5-c11*8, c8/5
+.define c12 = (c4)
+L6: mov L5[c10/8/4*c6/18+c0], r2
+mov #(-c4-8), r5
+.fill 2, (-c9)
+mov L4[c6], r2
+.data c7+(10), -3+c11, 4, -8*9+(c1-c9)
+.data (c6)--c12+4
+.define c13 = c10
+mov L4[12], r2
+L7: mov #(c5-1)/3, r1
+mov #-(-c5), r1
+L8: prn #15+c11/3/2
+L9: .data 7-14*10*c4, c0, 18/3*18*c2-c12+c10
+L10: mov L3[-13+1*18-c6], r2
+mov #15*(c3/4), r4
+.define c14 = 5/1
+.data 9, 13+c2
+.data 1*7-c1-c14/12, --9*c13-16, 10, c7+-c4+4/4
+prn #7*-c3-10
+L11: mov #3, r0
+L12: prn #c5*3/8+c3
+.data -c3+3-c14, (12)
+mov #-c9*c5/1, r5
+L13: cmp #20, L7[c2/1/5*-4*-9]
+.define c15 = -10
+.data (c10)-c13+12+c2, (c13), 12
+prn #c6/2+c1-18/3+-7
+L14: .data c7--c4
+.define c16 = c4/2-8-18*c8+10*c3
+.data -(15), c9*16+c13/1+c6
+.data -6*c2, ((c8))-4, 15, c8+c0*6/10
+prn #8
+mov L3[c0-c10*c15/19], r2
+prn #-12*c6*16-19
+mov L8[18], r2
+L15: mov #5-2/3, r5
+.define c17 = c2
+mov L13[c12], r2
+mov #0, r3
+mov L2[c6], r2
+prn #3
+L16: mov #c14--4, r7
+L17: .data c4
+prn #(15/19*c4/3)
+.define c18 = 4
+mov #((c11))*c5*11/4, r7
+.data c6*13--19--10*c17/2
+L18: mov L15[c12], r2
+L19: .data (c15-c16)+c11-3/5, -2-4/2, (c5*c9)-2+19-2*19, -c18/3/3
+mov L5[c7], r2
+mov L12[(18/11*c6-8)], r2
+mov #c0-c13-c0/3, r7
+prn #7
+mov #19*c3/5-c13+c5/1, r4
+mov #15/3, r1
+L20: mov #7-10-c6*4+10, r6
+L21: prn #((c6))*4+13
+mov #c18, r2
+L22: .data 18, -c0/2/4
+.data c12, -c15-20/9, 13
+mov #c10, r7
+.data c6, 14
+L23: mov L10[(2)], r2
+hlt
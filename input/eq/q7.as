@@ -0,0 +1,62 @@
+prn #17
+.define c0 = (17)-13
+L0: mov L0[-c0-6+(17)/3], r2
+mov #2-c0/3*(c0*7), r5
+.data c0/1+20/4, (c0), -c0*12/2, 0
+mov #c0, r5
+mov #19, r0
+mov #c0/1/1, r5
+L1: mov #c0, r5
+mov #c0, r7
+L2: mov #c0, r7
+L3: mov L0[11], r2
+.define c1 = 20
+L4: mov #-17, r5
+mov #(c1*c0)-11/3, r3
+mov #c0/2+(15+c1), r7
+L5: mov L4[20*0], r2
+.define c2 = 6
+L6: .data 14*c0, 16/5, c0*6*(c0)+19+14+c0
+.data (c0), -c2-c1-c2-12*14
+mov #-5*c1+7, r4
+mov L6[c0*2*(c0/2)], r2
+.data 8+5-6-c1, c2, 8-(c0)--c0-16+15
+L7: .fill 4, -6*(17)*c1
+L8: .data c2, 0, 4, -c1
+L9: mov #-17-c2-18-18/4, r0
+mov #14+c0+c0/5, r7
+L10: mov L10[c2], r2
+L11: mov #c2, r4
+L12: mov #((c1+9)), r7
+mov L8[15], r2
+.define c3 = c2/5
+mov #--c2-(13/4), r6
+.define c4 = c2+-c0*c3
+.define c5 = (-17/20)
+L13: mov L11[(c5-c2*17)], r2
+L14: prn #14*(17+c1)
+.fill 2, c0
+.data -0-12/2, c3
+prn #16
+cmp #c1, L2[c3/1+c2-c5/3]
+.data (c3), c2+11*c5
+mov L6[16], r2
+.define c6 = 6
+.data 19, c3, 12--14+-3-5+4
+mov L7[c2], r2
+.define c7 = (1)--c5--c4*c0
+mov #c1, r5
+.data 10
+L15: prn #19-c5/3+c7
+.define c8 = c7-(c1/1)
+.define c9 = 6-c2 + c7*11
+.data c8+18*c1+c3, c7+c4-13/2
+L16: mov #c8, r2
+L17: mov #13, r4
+mov #11, r6
+.fill 3, 11/4
+L18: mov L11[2], r2
+.define c10 = 5-c3-6--2 + c0
+.define c11 = 14*c3*17-1
+.define c12 = 2 + c11/1/14
+hlt
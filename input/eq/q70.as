@@ -0,0 +1,36 @@
+.data -19, 13
+L0: mov L0[14*-4+15], r2
+mov L0[2+17], r2
+mov L0[15+12+4*19], r2
+prn #1-3+6*2*5
+prn #7+1-11*11+10/2
+.data 2, 1/5, (-11/4), 9
+.data ((16)-(9)), 10+-10/4, 13/9+2/1
+L1: .fill 3, 13-3*18
+prn #18-17-3/12*20
+mov #13, r4
+L2: .data 15/12+8*9+6-15/5, 20-0/6
+.define c0 = 3
+prn #6
+prn #c0
+.define c1 = 19
+L3: mov #8, r5
+mov #14, r6
+L4: mov #6, r3
+cmp #c1-14+c0*c1-5, L4[-c1*-c0/1]
+mov L4[c1], r2
+mov L3[c1], r2
+mov L0[(9*c0)-c1-12*c0], r2
+L5: mov L3[1--c1/7], r2
+.data -4-10+-c0, 7-10, (c0+0/3), ((c1))-c0
+.data (-0), -c0+c1*c1*c0+4
+mov #c1*18, r1
+L6: mov L0[-0+4/5], r2
+prn #12-c1/2-14*(12)
+L7: mov L7[16/2], r2
+.data 12-(10)*7, 0, -6*7+8+3-18
+.data -17*(15)
+L8: cmp #17/3, L8[8]
+L9: mov #c1, r3
+.define c2 = --5 + 10*-10
+hlt
@@ -0,0 +1,62 @@
+mov #4, r3
+L0: .data 16+4--14+-20*1/11
+.data --7, 4, ((19*3))
+.data 1*8*10+6*19, ((19)), 20, (13/4)
+.data -11-18+(7), 8+12*-16+3, -14/14/5
+.define c0 = 2
+L1: mov L0[c0], r2
+L2: .data 20, c0*c0/4+19+c0/5
+.fill 3, 0/2
+L3: cmp #c0, L1[11-19]
+.data 14/3
+mov L3[c0], r2
+.define c1 = --c0*c0
+.data (2/4-c1+17)
+.fill 1, -4+c0
+prn #(c0)
+.define c2 = 15--14 + 19 + c0*20
+mov #-c2-5/14-c2-8+c1-c0, r7
+mov #c1, r4
+mov L2[-4-c2+4-c2], r2
+mov #(-c1)+-8/4, r3
+L4: .data c2, (c0), ((11/4))
+mov #7, r3
+mov L2[c0/2], r2
+L5: .data c0, 10+-c1*18/2, 4+12, 17
+mov L0[16], r2
+.data c0, c1, 12
+.define c3 = 14--15+(20)
+L6: cmp #(-c2)*19*(c1), L4[5-0-(c2)+12]
+L7: prn #c3--11
+prn #(c1)/3
+L8: .data 14, -c1
+.data 0, c2, (c3*c0*2*1)
+.data -17+-c3+-c0*c2, 9/1+-c3/4
+mov L1[c3-c2-(15)-c1-13+c3], r2
+mov #c0, r2
+.data c2/2, (10), 15
+.define c4 = c3-(10)--c0
+L9: .fill 2, -15
+mov #1, r2
+.data -9*4--c1*17
+L10: .data c3, c4, -16+c1/2, c2
+.data c4, -c2, 4+c1-c3+c2
+.define c5 = 4/4
+.data -(c3)+15+c1, c5
+L11: mov #16, r6
+mov L6[(17*c1*-14)], r2
+mov L5[c3], r2
+mov #11-c1-(c3)+5, r7
+mov #2, r6
+mov #3*(7)--c0, r0
+L12: prn #14+17/1/3
+mov #(c0)+c1-c1/3, r6
+.data c5-5*c5*(1)*5-2
+.data c3, c2+12-c5/3*-(18)
+.data 0+c3+2-c4/12, -15, c3-16+c4*c4, c1
+mov #0-c2+4-c0*15, r0
+mov L3[11], r2
+.define c6 = (c2)
+.data 12+c3*9+12-2/3+c0/2, (19*c0-2+c4), (15), -c2-c2*(c6)/4
+L13: .fill 4, 2-(-9)
+hlt
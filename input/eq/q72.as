@@ -0,0 +1,30 @@
+prn #17
+mov #10-9-0*4, r0
+prn #11
+.data -(13), 10*6
+.fill 2, 14
+mov #11+20+10/15, r3
+L0: prn #6*18-15/3
+mov #18*9+19/12+-(20), r2
+L1: cmp #(17)/5/16, L0[2-12*6+1*-17*1+13]
+mov L0[3], r2
+.define c0 = (8)*5*4*17/3+7-2
+.data 15-12*4+c0/3, 17, 13
+L2: .data (c0)/5/5, (4)+20, (9*c0/1)
+mov #(4-13+c0*c0), r1
+.define c1 = 13
+.data --c1-(12), 13, 17/9/12
+mov #19, r2
+prn #18*7+c1+13/20
+.data -(1), (c0/3)/3
+L3: cmp #17-c1+10+c0*-c1, L3[-(12)-5*19]
+mov L0[20+19/3-c1], r2
+mov #((c0)*5-c0), r7
+.data c0, -12*3, (c0-9)--c1*16, --c1/11
+.data 7, c0, --c0--6, c1
+mov #-c0, r3
+L4: mov #10, r6
+L5: prn #(17/4)+(2-7)
+mov #15, r6
+.define c2 = c1
+hlt
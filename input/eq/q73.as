@@ -0,0 +1,56 @@
+.define c0 = 9
+mov #c0, r6
+L0: mov L0[17-c0+2-13/3], r2
+.data c0, -2
+L1: .data c0, 4*c0*2+8/1, (c0+c0/2), -((9))
+.data 2
+mov #(c0*11)*c0*3/1, r0
+cmp #(17/1)+20, L1[c0]
+.define c1 = c0 + c0-6/4-1--c0
+mov L0[13-c1*5*c0], r2
+L2: mov #-c0*17+19*c1+-c1, r6
+prn #19*c1*c0+11
+prn #c1
+L3: .fill 1, c1+c1+7*14
+mov #--c1+19, r3
+mov L2[-2-19+c0], r2
+L4: .data 10/5*-c0+3
+.data 20--12-3, -13-16/4
+L5: mov #0/18/1*((15)), r0
+.define c2 = c1
+mov #c1-15*c2+c0*3/2-6, r0
+L6: mov L1[-c1/3+(c1)], r2
+.data 0-7, c2-10+c1*4+(-9)
+.data 2, c0+-c2/5
+mov L0[3], r2
+.data 11/1, -4*11-c2*c0, -15, 7+c1*(2)*-17-c2
+.define c3 = -11
+L7: mov #(11), r3
+L8: .data c3, (10)-4, -(c3)-11+c0, c3/4
+.fill 2, -10*c1-c0
+L9: prn #5+c0-9+c0*c0-c2+c2
+L10: mov #(c0+5-13), r5
+mov #--10+c3, r6
+L11: mov #((c3)), r1
+.fill 3, (c0-c1-c3+c1)
+L12: cmp #c1-6/1, L9[8-(6*3)]
+.define c4 = (c0)-(c2)
+mov #19*(15), r3
+.define c5 = 17*13 + 10 + c1
+.data (c0+c3)+15+18*2, c0-c4-c2/3*-15*9+c4
+mov #c3, r6
+mov L11[c5-9+c5/20--4*c3], r2
+mov L9[c3], r2
+L13: cmp #11/5, L1[((c5+c1))]
+mov #-(1)+18+12-(c3), r3
+prn #-0/5
+.data ((18))-c1*1+(14), -17+19+1, 15*((17))
+.fill 2, 6
+mov L12[c0], r2
+mov L1[-(5)], r2
+mov #8, r5
+.data 20, (c1), -10*(c4)*18/13/20, 6-5/5*c2*12+c1
+.define c6 = 5
+.data c0-c6+c5+(1/2), -c0
+.define c7 = c1
+hlt
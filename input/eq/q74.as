@@ -0,0 +1,99 @@
+L0: mov #9, r2
+cmp #-((14)), L0[-(13)+19+7]
+.define c0 = 5--12-3*0
+mov L0[-c0], r2
+.fill 4, 0
+.data 3*(c0)*--5, 4-c0+c0/9-9, c0*c0/1*(6-7)
+.data 3, c0/4-(c0)+15/2
+.define c1 = (c0-c0)+c0+-c0
+L1: cmp #c1*16-3--0*c0/18, L1[((5)/3)]
+mov #-(2)--17-c1, r2
+prn #-16+2-19
+mov L0[-c0/8--15], r2
+.define c2 = c1
+prn #((13))
+L2: mov #-c2-c0, r1
+L3: cmp #c0/1+17/2, L0[c2+c0*c0*c1+c0/1]
+cmp #8-17-c2/4/4, L2[4]
+mov #c1-14/4-3, r3
+mov #(10), r6
+mov L3[-16+14*17], r2
+.data 6, -0, (-c2+c1)
+mov #c2---c1, r0
+mov #(0/16*c0+14), r1
+mov L1[-c1/3+c0], r2
+.define c3 = (c1 + c0)/1
+.fill 3, c0/5/1/5
+mov #-20+9/20, r0
+mov L1[7], r2
+mov #2-c3*17, r3
+.define c4 = 15 + 17-c3--13*-2
+.define c5 = c4*(3)
+.data c1+12*2*19, -c3-c5/5*5-c3, (-3)
+.data c3
+L4: mov L1[-17+c2-c1+5], r2
+.fill 4, c4*6+c2+1*(c1)/4
+.define c6 = c0
+.define c7 = ((c4))*7
+mov #((18)/4), r1
+mov L3[c6*c5*c1+c1+-0/3], r2
+mov #6, r0
+mov L3[3/3], r2
+L5: mov #16, r7
+L6: mov #11-c6+8/3, r3
+L7: mov #8/4, r0
+mov L4[c5], r2
+L8: .data (c0*c2)/5, (c7*12)+c4-c7+17+c5, c5, (9*9)+4
+.data (3-c3)-14/18+c7, 20-(12), -c3*c7-c0+c2
+L9: cmp #7/2, L7[13]
+mov #-16+c4/2, r0
+L10: mov #3/1-(c1*9), r6
+mov #c4*(19/2), r6
+.data 8-c2+c1/2*c2-16, (c4), c3-12/2-c4/3, -c5-c7+-1
+mov #11-c1, r5
+.define c8 = 9
+L11: mov #c4, r2
+mov #c6+c2+c4+1, r6
+.define c9 = 16
+.data 9*0, 0/3, (17-c5+9), -c8/5+(c3-c5)
+prn #-8*c2*-c2
+.data -6*10/1, 17*19*9+c3, -c8, -6-(c7)/5
+prn #17*5*0*(15)/5
+L12: mov L4[-(c3)*1+14/12], r2
+L13: .data c8
+prn #-16/3+c1
+mov #4, r2
+mov L1[c4], r2
+L14: .data 2-9/3
+mov #c9+c2-(13), r7
+.data 8+c2*9*c2+c6, c9*c1/3, 2/1
+prn #11
+mov #-11-c6/4, r3
+.data 20/19+c6+4, ((c9+c5)), -c9*c9-18+c3
+.define c10 = (c7)
+.data (c8)/4/4
+L15: mov #c7/2, r0
+mov #c8-(c8)+c8, r2
+L16: mov #c2/5+-c6*c2/2, r7
+.data 1, (c8)+4+c8+12, c3, c3+c2/4-c8-9-c1/2
+mov L14[c10], r2
+.fill 1, (c9)/5/1
+L17: prn #19
+.define c11 = 20-7/3*12+c6*c4-c4
+mov L5[(-0*9)], r2
+L18: mov #c8, r2
+L19: mov L4[-5*16/10], r2
+mov #11-c10, r6
+mov L15[16], r2
+mov L2[-6/3/1], r2
+L20: cmp #c10, L3[0+c8]
+prn #c11*-c5+5
+L21: mov #c8, r5
+mov L21[c1/17+(c6)/4], r2
+.data ---c6, -14
+cmp #-19*c11+c11/4, L21[c3+9-19*-c4/9]
+mov #-c7+c9--c7, r1
+L22: .data --2+12, 1-15+c11+c2*c11, (18)
+L23: mov #4, r1
+.fill 2, -5
+hlt
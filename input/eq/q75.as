@@ -0,0 +1,78 @@
+mov #(-14)/3, r3
+.define c0 = -10-2 + 19
+.define c1 = -14+c0*c0*17*c0+c0/6
+L0: .data -7*c0/4, (12)+-c1/4, 11, -7-c0-17-11*15
+L1: mov L0[c1], r2
+cmp #-c0+c1, L1[15]
+mov L0[c0], r2
+prn #(19*14)
+L2: .fill 2, c0
+L3: .data c1--c1
+prn #c0
+mov #9, r0
+prn #9+3+c0/5
+prn #9+c1
+mov L0[-9+19/3+5], r2
+mov #-10-c1/3, r5
+.data -((c1)), ((6+c0))
+prn #18
+.define c2 = ((3)*4)
+.data c1-3*c0-c0+8, c1+5+14
+.data 9, 9, c2, (9*c0)+0-(7)
+L4: .data -(-10), (c1/11)+(c1)*7+c1, --c2+-15
+.data (-(c1))
+.define c3 = c2-c0*c2 + 18-c0/5
+.data 5
+L5: cmp #(-10), L4[-3-6/1]
+mov L3[-c2-18*c1+-1-12], r2
+mov L0[12/6], r2
+mov L5[5-c2/4*19], r2
+mov L1[5*17/1-c1-c2*c3], r2
+prn #c3-c3
+cmp #(19/20)+19, L0[12-c3+7+(c0)]
+mov L4[7/3*c1*14+c3*1/1], r2
+.define c4 = c1
+.define c5 = c3/3
+.define c6 = c1
+mov L0[c0*(8)], r2
+.define c7 = 13 + 2 + c1/17
+prn #(c5)/2/3
+L6: mov #c1--10-17, r2
+L7: .data c4-c0--10/1
+L8: mov L0[-(c2*c2)], r2
+mov #-c0+c7, r7
+prn #c7+c3*14+0
+.define c8 = -12-17/3
+L9: prn #-c6+10+5
+.define c9 = 1
+.define c10 = (-7*c9)
+.fill 2, --19
+L10: cmp #12, L10[c4]
+L11: prn #c0+c1/3*-16/10
+L12: cmp #c9*-17*c5, L6[-c3+c2+-3]
+mov L11[19+(8/3)], r2
+.data 19*6*12*c1, (2)*c9+c8/1
+.data c7+16
+mov #c6, r2
+.define c11 = c10 + c5 + 18/19
+L13: cmp #(c9/11-12), L4[12-2*6/3]
+mov #8, r6
+L14: prn #(-17-c5)
+.define c12 = 12-c4+c8/1/3
+mov L6[8], r2
+mov L0[c10], r2
+mov L11[c4/1], r2
+.data c3, 2*(11/7)
+mov L9[c3/2], r2
+.define c13 = (c10-c6 + (c8))
+.define c14 = c3*c3+7/3
+.data (c8*c6)*9, -11*c10-c9, 9
+.define c15 = c8*1/5 + c9
+L15: mov #4/1/5/2, r6
+.define c16 = c0+c10*1-c1
+L16: prn #11-c1+-7*-c14
+.define c17 = --c11
+L17: .data 4+c13, 8
+.data 3, c6/1
+prn #c16
+hlt
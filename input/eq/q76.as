@@ -0,0 +1,68 @@
+mov #-0/2+(9), r6
+mov #3+9-20--(20), r1
+.define c0 = 0+3/5/5
+.define c1 = -(c0)-1
+mov #(-1)+-c1+c0, r4
+.data c0
+mov #17+9-14/1*14, r7
+.data c1*1/2-13-3/3, 16-c1*14/5, 8-18*c1*13-c1, (c0+5+2)
+mov #(15), r1
+.define c2 = 11
+prn #--19*c2
+prn #(c2)-15*c2-c1
+L0: mov #c1-2-0*-c1/4, r1
+.data c2/2, c1, 20-12*c2+16-11, 7+c2/2/2
+mov L0[2*7+c2-9*c2-c2-c2], r2
+L1: mov L1[12], r2
+.define c3 = -10-c2*c2-c2
+cmp #4, L1[4+-c3--c3+c3]
+mov L1[c2/4], r2
+L2: mov #7, r0
+mov #(-3), r5
+prn #7*c2
+mov L2[-0+3-19], r2
+L3: mov #6/2-11+(20)+c2/3, r6
+mov L0[c0*12-5*2], r2
+L4: mov #c1*-(2), r7
+.define c4 = 19-c2/20/4
+.define c5 = (c1)-3-c0/1
+prn #17+10/20-c1/7*6
+L5: mov #7-9+17*c1*9/14, r7
+.define c6 = -c1
+.define c7 = 13
+mov L4[(-3)-(c2)--2], r2
+mov L5[19], r2
+prn #-c5/5+c0
+L6: .fill 4, (6)+c5+c5/5
+mov #8, r6
+L7: mov #9*10/4+c7/4, r0
+.data c0, (-c0), 18*3, 14*c1+-c1
+mov L2[-c5/6+13-c6], r2
+prn #(c6)/3
+mov L7[0*3], r2
+L8: mov #1/3/2, r0
+mov #11+c5*20/1, r5
+L9: cmp #(c1/2), L7[(c7*c4)-8/1*8*20]
+L10: mov L8[c2], r2
+.data c4-c0*c5/9+c2, c0/5, c5*17, c0
+.define c8 = -c2+20/4
+L11: mov #13-(13), r2
+.define c9 = c2/15+c1/2+0/1-c6*c8
+L12: .data c3*c8*c9, -2, 19
+mov #c5/12-12/15+(6/3), r6
+mov #20, r6
+cmp #c6*19/6/3, L8[--c0+4]
+prn #2+19*5-c5/3
+L13: mov #19-12/4+c1, r6
+L14: cmp #(--13), L1[c5]
+mov #c2, r4
+.data 3/1-c6-13--c4-c2, 4+c0+c6-c3-c8
+mov #(c7), r5
+.define c10 = 14
+mov #(-0/1), r7
+.define c11 = 12
+.define c12 = 2
+mov #11*(c7+c5), r0
+mov #0+c7/5+12/3-c3, r4
+.define c13 = 9
+hlt
@@ -0,0 +1,53 @@
+L0: .data 17
+L1: prn #17+10+12/6
+mov L0[2], r2
+.define c0 = 20/1
+L2: mov #18+(c0)/1, r7
+.define c1 = 3-3*0/2+0
+.define c2 = 0+c1-19/19+c0
+.define c3 = c0
+mov #12, r4
+mov #9/4*15+c1/13, r1
+L3: .data -4+18+19, c2
+.define c4 = -17+4/2
+.define c5 = 1
+L4: mov #-c3*(10)-c5+12, r6
+mov L1[(20)], r2
+prn #(c1)*3*c2*c1/20
+prn #c0+c3*c2/1/1
+L5: mov #-8, r2
+.define c6 = 16
+.data c2/3
+L6: mov #(c3)+c3*15-1-6+5, r1
+L7: .data 16, c4*-(c6), 0, (c5)
+mov #c6/2--3, r7
+.data (c0)+c1*0/3
+mov #4/3*7-c0+4+20, r4
+.fill 2, 4
+mov L5[16-c3/2], r2
+cmp #-c0-c5, L1[8]
+L8: .data -c5*9/4, c1
+prn #3
+mov #--c5+0/5, r6
+.data c5
+cmp #(1)*18/18+c5, L1[c1]
+L9: .data 16-3+c3--11, c0+c6-3/6, (7*c3)/2, c2
+L10: mov #((-14)), r7
+L11: prn #(c0-c5)*c3
+L12: mov #c1-c3-c2-c3, r1
+mov #11-0+c5*c2, r0
+.define c7 = c3 + 17/5*12/4-2
+prn #-18+16-(c5-c4)
+mov #(4), r0
+mov L3[c4+1*13*2/4], r2
+L13: mov #c7-10+-12/8, r1
+.data 4/7*3-c1*c4/9+c0*0, 12*0*10+20+c3+c0, -20
+.define c8 = 12+0-2*c7-c2
+.data 17, (c5+c2)/4, c0-8+c0, 7+4
+.fill 3, 2*(13)/3
+.data 8+9/4, c1*-c5+c5, 9
+.data (c1)*-1/5, c2/3, c6+c3
+mov #(c2)+-c8*(7)/5, r5
+L14: mov #c6, r0
+.fill 2, c1+11*(c2)+16/2/2
+hlt
@@ -0,0 +1,45 @@
+.define c0 = 6-11*(13)*-7+15/6
+.define c1 = 16
+L0: prn #c0*-c0/1
+.define c2 = (c0)/4-c1
+L1: .data c0*(c1)-0/3, 2/2
+L2: mov L1[15], r2
+L3: mov #c2-19/5/4, r0
+mov L0[(c0-7)*14], r2
+.data (-c1*4/2), -2/20/4
+prn #20
+.data (-c2), -c0/1/2, c2*6-14/2
+mov #11, r0
+.define c3 = 2
+.fill 4, 5-(-5)
+.fill 3, -15*2*(c1)+15-c2
+L4: .data (3), -10/4+13/15/1, c0/2*c1+c3-c1+13
+mov #(c2)+(7)-15, r3
+.define c4 = 19*19-c3
+mov L4[c2+c0*16/4/4], r2
+L5: mov L5[c2/4-c2], r2
+L6: .data --5+12, 20-11/5*10
+L7: .data c4/19, c0+c3*1/1
+.define c5 = 5
+.data c2/3+3-16-c5
+prn #c1/4*7*14/10
+prn #c5-c3/4
+.data c2, 4, 10
+L8: mov L3[c4+10/2+5/5], r2
+.data -8, 11/9-(c0)-(20/2), 5
+.define c6 = (c5-9/1)
+.data 1-9+c3-c5+14
+.fill 1, -(c0)*c0-1+10*c2
+L9: .fill 1, 1
+.define c7 = 15
+prn #c3
+L10: mov L4[-14/2], r2
+L11: mov #c7, r3
+mov #c7--c5, r3
+prn #c7
+L12: mov #-18-(c6)*(2), r1
+.define c8 = (c4-c4-c7/4)
+.data 2, -(2)/1
+prn #4
+mov #c2*11-c7/2, r5
+hlt
@@ -0,0 +1,39 @@
+.fill 2, 15
+.define c0 = 15
+.define c1 = (10)*c0/14 + -1
+.define c2 = 0*13*16 + 5--10
+L0: mov L0[(17)], r2
+mov #7-c1-(c2)/11, r3
+L1: prn #c2
+L2: .data -20-16-12+-8*9*8
+mov #-c2+-c1/4, r3
+L3: prn #-c1/5
+mov #-(18+c0), r4
+.define c3 = ((7))--20/19
+L4: .data c1, 10*c3+-c3-c1+c1/14, 19/4/2-19+16
+mov L1[(c2)], r2
+.define c4 = c0*c1*3*c2 + c2
+L5: .fill 3, (c3/5)/2
+L6: .data -(7)+(19)--c1
+mov L6[2*c2*c0+16-c0/11], r2
+prn #c2
+.define c5 = 5*c4
+L7: .data 5
+mov #c5+8/3*c4*15, r6
+mov #(5), r6
+L8: mov L3[(10)-c5*c0*c4*18], r2
+mov #-c3, r1
+L9: mov #(c4-c4/1), r4
+.define c6 = 4
+.define c7 = 9/2-15-c4-(c4/3)
+prn #7*19*c3
+.define c8 = 8*11/2
+L10: prn #c7
+.data 7*c8*c8/4, -c8/3/3
+mov #c7, r5
+.define c9 = (c4+c2*11/2)
+.define c10 = (c9)
+mov L2[c0-c4-3*(c4-c6)], r2
+mov L1[9], r2
+L11: mov #(-c5), r5
+hlt
@@ -0,0 +1,50 @@
+.data 20+16, 15
+mov #12, r1
+mov #-15/1/4, r3
+L0: mov #1, r7
+L1: mov L1[10/19/11], r2
+mov L1[-13--9---2], r2
+L2: .data 12, 0, 5, -12
+L3: .data 3-((18)), 3, (19)*16, 0
+prn #10+18-19*-20
+prn #19
+.data -14, 0/1
+mov L0[13/9/1], r2
+prn #12*-9*11*3
+mov #(8/19)*2*2-16, r4
+.data 20, (-6/19), -6+4+-18
+L4: mov #(1*20+11), r1
+cmp #-5+19-2*11, L1[12]
+.define c0 = 17
+L5: .data c0, 2*c0
+prn #c0
+.define c1 = (c0/16/5)
+L6: mov L5[c0*-0/3], r2
+mov L4[c0+20/3+-c0*c1], r2
+mov #(c1), r0
+mov L4[8+9/2/3], r2
+prn #-c0+6
+mov L5[-c1], r2
+cmp #c1/2+11+c0-13, L2[-c0]
+mov L1[20], r2
+prn #c1/6*c0-c1--15*13
+.define c2 = -(3)-c1/6/4
+L7: .fill 1, 2
+.define c3 = 11-9*19/1
+.define c4 = -c0-(c2)+10*c0/1
+.fill 3, (13-c3)+c4
+mov #(c2+c2/2), r6
+prn #18
+.define c5 = 20
+.data 2, -c2+20/5, c0*19, 0+8*c5+-11
+.define c6 = (c0)
+cmp #-c5--8-c4*0*9*0, L2[-(c0-20)]
+mov #7, r6
+L8: mov #18-10+c3--c2, r2
+L9: .data -c6*c0+4-19/4, c5+2/13-11+c2
+L10: mov #c2, r4
+L11: .fill 4, 9+2+9-c6+4
+L12: mov #c2, r0
+mov L8[-(c5)/3], r2
+L13: .data 7
+hlt
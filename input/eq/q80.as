@@ -0,0 +1,55 @@
+.data -18+5*12, 14, -0-2-11, 9
+.data --11-8*1
+L0: mov #1/3, r4
+.data 5/4/1
+mov #8-3*5-6/3, r0
+mov L0[3], r2
+L1: prn #10+2/5+-7*-2
+prn #12/3-(18)*-10
+mov #2, r6
+.define c0 = (9)
+mov L0[8], r2
+.define c1 = -3+3+((c0))
+mov #3, r4
+cmp #12, L1[c1]
+mov L0[-5-c0-11], r2
+cmp #-3-c0*4, L0[c1]
+L2: .data 14
+mov L1[c1], r2
+prn #c1
+.data 6+c1/2*-5
+mov #(c0+6+5), r7
+mov #2/3, r2
+L3: .data c0, c0, --(c1)
+mov #9, r2
+L4: .data -12*c0/1
+mov #c1, r6
+.fill 4, c1
+mov #-16, r4
+.data --19--6--0, c0, c1+3+c1, c0*(c1)/3
+mov L3[(c0*c1+19)], r2
+.define c2 = 10
+prn #20
+.define c3 = (8)
+.define c4 = -9
+mov #2, r5
+.define c5 = 20
+L5: mov #10, r6
+mov #c5, r0
+prn #((16-4))
+.data c3*(6)
+L6: mov L0[8], r2
+.define c6 = 0 + 20-17
+L7: mov #(5), r7
+mov L7[4-(11)+0*c5], r2
+L8: mov L3[((-15))], r2
+mov L5[c5/5+12/4], r2
+L9: mov #c3, r5
+mov L2[(17-(13))], r2
+mov #20, r1
+mov #0+c6-6*c6*c1*c0-c3, r4
+.define c7 = c1*12+20/3*-10+c0
+mov #--c5*c3-10, r7
+cmp #-(11)/3, L6[c7]
+L10: mov #10, r5
+hlt
@@ -0,0 +1,85 @@
+prn #9--2/3
+prn #10
+.define c0 = 13/14
+.data 12+4-12-c0+9, 0, c0*12+(c0)*c0+15/4
+prn #16+c0
+.data -16/3--9/2, 13/20
+.data 15, ((3))-14, -7/1, (c0*c0/1)
+L0: mov L0[c0*20*1/1+-c0], r2
+L1: prn #-13/3
+cmp #-c0+-c0*1, L1[19]
+L2: prn #(c0+13/3)
+L3: .data c0, -3/1, c0-18-c0*(c0)
+.define c1 = c0--17/1
+mov #17*c0/4, r5
+L4: mov #(12), r5
+L5: mov #c1, r4
+L6: mov L4[7+c0*c1+19+16*11/14], r2
+mov #3, r6
+.define c2 = 4
+.data c2
+prn #c0
+mov L6[-17*4/1], r2
+.define c3 = -1-c2/5
+.data 16, 11
+mov #(1+15--4), r2
+.data 11, (c2)
+prn #c2
+.data c3, 12, 0/3/1-5+-c0, c2
+.define c4 = (c3)/3/2
+.data (6), c1*-20, c0
+.define c5 = c0 + c1/4-(c0 + c0)
+mov L6[(8-c0)*c2*c4-11*c5], r2
+.define c6 = -c4-c2 + c4
+L7: prn #-c2/1
+L8: mov L5[-c3], r2
+mov #c1, r0
+.data (14-0)+(c4*c6), 2, --c3-20-c6, -10/5
+.define c7 = c4
+mov #(19), r5
+.define c8 = c1/3
+L9: prn #2
+.define c9 = ---c8
+.define c10 = c1
+mov #(0/6)*10-c2+c9, r1
+.define c11 = -11
+mov #c10*c5*c1/1-(8+3), r5
+mov #--c0, r0
+.define c12 = 20 + 0 + c9*(2)*-9
+L10: mov #--2/3, r6
+.fill 3, c6/3--18*c7
+.data -c8-7+-10*c8, c3
+L11: .data c5-(17-c4), 12, c12+1, c12-17+20*11
+L12: mov #20, r2
+mov L9[19], r2
+prn #8/4
+L13: mov #c7, r7
+L14: mov #6, r3
+mov #6/4/2--12/1, r1
+.fill 3, c8-c10+3-16+--c2
+prn #13*c6+-c9/4
+cmp #c10*c5-c10, L4[(c0)]
+prn #--(c6)
+mov L11[c6], r2
+L15: cmp #-c4*10+-13+c1, L4[c9+-17/3]
+L16: mov L8[1*(19)/1], r2
+L17: mov #-c5*18-13+18-17/1, r7
+.define c13 = c7
+.fill 3, 2
+L18: .data 6+17, 15/3/4--c9
+L19: prn #-c13
+.define c14 = c2 + c12*18/4 + c3/3
+L20: .fill 2, 7
+mov #c12-c8*7-c5*--c4, r7
+L21: .data c12, c5/5+c2, c14
+L22: .data 11, -16*c6, c3
+.data -c13*c4-17/1, 6
+L23: prn #(11)/3*0
+L24: mov #c10, r6
+mov L7[c11-c11-17/2-5], r2
+.define c15 = 13
+mov L8[1], r2
+L25: mov L19[(c12+8)], r2
+mov L10[13], r2
+.data 11
+hlt
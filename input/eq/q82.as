@@ -0,0 +1,39 @@
+prn #5
+prn #1
+.fill 1, 17
+L0: mov L0[11*9+(0)], r2
+mov #(-7*9), r4
+.define c0 = --6*0/19
+mov #(-c0+c0*c0), r5
+prn #1
+.data 16, 8
+L1: mov #(c0-14/5), r3
+.define c1 = (c0)*-8-9
+.define c2 = 4
+L2: .data 16+-6/4
+mov #-(6)-16, r2
+.data 11-c2/1, 6+2+c1/1, (17/1/5), -c0/3
+cmp #((7))/3, L2[((5)/2)]
+prn #2
+.data c2/2+8+(c0)
+mov #2+c2, r3
+mov #((8)+9*11), r2
+L3: mov L3[12+c1*15*c0], r2
+mov #c2-c1/3*(c0*6), r7
+mov #c2*-c1/16, r4
+mov L0[4], r2
+mov #((8)), r5
+mov #((c2))/3, r6
+.data c2*-c2-15
+.data c1, c1
+L4: .data c2+-c2/2, 15*12/3/13
+.define c3 = 14*c1/3-c1-c0/1
+.define c4 = c2 + (15-c1)
+mov #10, r5
+prn #c3
+.data c2, c2-c4+c4+c3, (12/2-c3/4), (-18/3)
+mov #-c3-4+c4/20, r5
+mov L1[c1*c2+c4/1], r2
+L5: mov #c4, r1
+L6: prn #-18*12/4
+hlt
@@ -0,0 +1,84 @@
+prn #1
+.define c0 = 9
+prn #-5-c0-(7)
+mov #(c0-c0*(13)), r0
+mov #-18/1, r1
+.define c1 = (-20/20)
+L0: mov L0[(-c1+c1)], r2
+mov L0[(12)], r2
+.define c2 = -2
+L1: mov #7, r5
+L2: cmp #11, L2[4*5*2-c1/3]
+L3: mov #c1, r0
+prn #c0
+mov #c0, r0
+mov L3[15], r2
+cmp #0*0/2*c1-13, L1[(c2-3/5)]
+cmp #2+c2+c2*2*8, L2[14]
+.define c3 = 3-c1-(c1)/5
+mov #(12)*c2*11*15-3+-10, r7
+.define c4 = -c3-c0/17/3
+L4: mov L3[6/5], r2
+L5: .data 18
+mov L3[14-17*c2*c4], r2
+mov L1[-0/5], r2
+.data (c4+6)+20/14+12*17, 16+2-c0/9, --10/3
+mov #(c1*c2*c4+c1), r6
+.data --(c3), -8, 11, c1
+.define c5 = c3
+L6: .data ((c5))+c5
+mov #17, r2
+L7: .fill 3, c2
+.define c6 = c4*7 + c5-13*20
+mov #7/1/4, r0
+L8: mov #-c4*5/4, r7
+L9: mov #c2+c6+c3*18, r7
+.define c7 = -20*-c2-10/15/1
+mov L8[-c7/3/12], r2
+mov #(-c7/5), r3
+L10: mov L4[15], r2
+prn #c5*(c1)+c1
+.define c8 = 3
+L11: .data 10*14
+.data 1, 9-14/2+14
+mov #(7-c8)+11*(c3), r1
+.define c9 = 9
+.define c10 = c9
+L12: .data 0/16, (c0)+0-c9/4
+.data c0+4-10-0*18, -(c5)+-c7
+mov #6, r1
+mov #c1, r5
+cmp #13+c7/1/1, L8[c9]
+.data c8+4-11+19, 14, (19/2), (-5/19)
+L13: .data 9/5*4*11-c1, 1*c5-c0+13*c7+-12, c8, ((c6))/2
+.data c9/2-15+-11, 4, c3-11
+.define c11 = -19
+.data ((12)+c9+7), 14/14/1--3+c7/3
+mov L1[c7], r2
+L14: mov L12[7], r2
+L15: .fill 4, (10-c8-c11*c10)
+.define c12 = -c1/4 + c0*8/3
+.define c13 = (20/3)/3
+prn #-c4
+mov #-5, r0
+L16: mov #(c5), r5
+.define c14 = (c5-7*c11)
+mov #1*c0*13--c10, r6
+L17: cmp #18/1, L17[c2]
+mov L15[0], r2
+L18: mov #c10, r5
+mov #c9+2+-1+16, r7
+.data c10/4, -20, c3+11+c12+1-c14+c0, -(c5/1)
+.data 13/16/1/5, (c10)*c1/3
+mov #-6*20, r7
+L19: .data -c10/5*7+1, (16)*c10, c8*c5*0+14
+prn #c6/5
+L20: mov L14[-8-c11*4+3+7/4], r2
+L21: mov #c13, r6
+.define c15 = 8*3/4
+mov #2, r3
+.define c16 = 16/15-9 + c0--c0/5
+L22: .fill 3, c14
+L23: .data -c12+c10+--7, -(11)+3
+.define c17 = c3-0-c4*c16*19
+hlt
@@ -0,0 +1,114 @@
+.data 10, (15*4)/5, 1, 15
+L0: mov #7, r3
+L1: prn #11-5/2*3
+L2: mov #2/5, r2
+.fill 4, -12*18*9*3
+L3: mov #17-(3)*5+9/3, r2
+.define c0 = -19
+.define c1 = 17 + (c0)
+L4: mov L0[((11))*c1*c1*c1+0], r2
+mov #(c0)*c1/4, r6
+prn #19-c1+c0-7*14*c1+11
+L5: .data ((c1))/4, 19, --c1*4+15+c1/2
+L6: .data 18/4-1-17, c1, 16
+mov #-c0-(c0)*4+18*-c0, r7
+mov L2[-(2)+c1*c0], r2
+.define c2 = c1
+.define c3 = c0
+.fill 4, c1
+.define c4 = c3
+L7: mov #-c3/3, r2
+.define c5 = --c1
+prn #18
+mov #(c5-2-12), r1
+.define c6 = 11
+.data -14+c3-6+4, (18-c6)/3, 1/3, ((-6))
+mov L6[c2/3+c6], r2
+L8: .fill 4, (c2-c1*0)
+prn #18+c5-(c6)+9
+L9: mov #20, r0
+.define c7 = 11
+L10: mov #(c0-c1), r1
+mov L3[13], r2
+.data 6+8/1*6-c5, -c3/4, c4*(17)/5, 4
+.define c8 = c0 + (c6) + c0
+L11: mov #(c2), r4
+.data --(17), -15, -6*(18)/5
+.define c9 = (12*c7*13*19)
+prn #c6+c5+0/4*10*11
+mov #c9-8*c9, r0
+prn #2/1*c1-c2-5
+mov #1*(c7)-8-c5*13, r5
+mov L2[15], r2
+mov #c2+c6*c1+20*13, r2
+.data c9-c2-c5+(8), c5, c9+11, 15+7/4/1
+.define c10 = 20*-19*-c0*4
+mov #11+(c7/2), r5
+.data -2*9-(c4/3), c0
+.data c3*6-18-15, c9, (16), 10+(c3)
+.fill 4, -c1*c4+c1+15
+.define c11 = c2/3
+cmp #5*c3+-c10*2, L6[c2-12-12-c4]
+.data 11, c1*(c5+c1), -10/1
+mov #0*6-c5+c2, r5
+mov #(9)/1*-14/3, r7
+.define c12 = -9
+.define c13 = (16/3/5)
+.define c14 = c10
+mov #c0-c5, r7
+L12: .data (2)+13*4*6-10*13+c0
+L13: mov #6+4, r7
+mov #2, r0
+mov #-c3*9, r3
+mov #20-c0*9+c9*3*-20, r7
+L14: mov #(10)+20/5*18/2, r6
+mov #(1-15*-13), r2
+.define c15 = 16-c5 + 11*c0/1
+prn #12-c12+c8/4
+.define c16 = -10
+L15: mov #11, r0
+prn #15
+.define c17 = (c3*c10) + (14)*c6 + c2
+L16: mov #18-c2+8+c12, r5
+mov #16-2+16*c2*(6), r2
+.define c18 = c5 + -c15
+mov #c10, r3
+.data 0/14+c1-c11-c9, c6, -c2+1/16, ((19)-c9)
+mov L3[-1-c5-c8-c6], r2
+mov #8*c13/1--c9*13, r7
+.define c19 = 8
+prn #c17*c10+(7)
+mov L11[c18], r2
+.define c20 = (c3) + 7/11*c8
+L17: prn #-10*4-20+3
+L18: mov #c4, r4
+.data c5/5-(2)+c5*c0, -(13), -3-7/3
+.data (5)+13*c4/2
+mov #c3+-c0, r1
+L19: .data c10, c13+18/16*10-c11-c6, 10
+L20: cmp #14/7, L18[4]
+L21: cmp #c9-c15, L4[--0/3]
+mov #c8/1, r2
+cmp #((11*3)), L17[0*13]
+L22: .data c3/1, -c3, 4, c3-c1-6/4
+L23: mov L15[10/5], r2
+L24: mov L18[c11/5], r2
+.define c21 = c17-13
+.define c22 = (-(c17))
+.define c23 = (-c10-c7*c22)
+L25: mov #(-c2*c6), r0
+.define c24 = -c12-c15*c20+12*9
+.define c25 = c21
+L26: mov L6[-c16-c12+(c2)-c12], r2
+L27: mov #19-c3-c18/2-c10, r5
+mov L26[-c23+18], r2
+.data (c16+16-c12), (c23*2-(c25))
+L28: .data (-c10), 6+c24/3+17/1/1
+.define c26 = 17/1
+L29: mov #-(15)/4, r4
+cmp #(19)*c23*20+10, L28[-11]
+mov L5[((c3)/13)], r2
+L30: mov #-19/4*c4/3, r2
+.fill 4, (8)
+mov L16[(12/5)], r2
+hlt
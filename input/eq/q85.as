@@ -0,0 +1,46 @@
+prn #-18/17-(11)
+mov #(17), r1
+.fill 4, 17/5
+.data (7*5)-3, --20-8-3, 8*-19-4, 8
+.define c0 = 9 + 15-13-10*13
+prn #((c0))
+L0: mov #c0, r5
+.define c1 = c0 + c0 + c0/2
+mov L0[1-c1], r2
+.define c2 = 17/13/5-c1
+mov #(-c1*c0), r6
+.fill 3, c1-6-c0*c2
+L1: mov #c1, r4
+L2: mov #18, r2
+L3: mov L3[11], r2
+mov L1[-c1/4-c0+c2*10], r2
+L4: mov #5, r5
+L5: mov #(c0), r7
+mov #((19)-16), r7
+.define c3 = c1 + 18*c2*8
+prn #11
+L6: mov #c0/4-(c0)/4, r5
+mov #-10-c1+18*c0-c2-c1, r1
+prn #c2
+mov L3[(-c2+c3)], r2
+L7: mov L6[c3], r2
+L8: mov L4[c1*c3/1/1], r2
+L9: .fill 1, c1
+.define c4 = c2-c2
+.data c3-(19)/3, c1, 12/5
+prn #(-4+11)
+mov #-0/4*(c2), r4
+prn #c1/3
+L10: mov L8[(((c1)))], r2
+L11: prn #c4*(12)*-4-c1
+.data -c1, -(c1)*14-c2, (20), c4/1
+prn #-2
+mov #-c1*9-10*-c2-6, r3
+mov L10[c3/8], r2
+.data (4)
+L12: .data -5+(20)+c4*c4, (19/15*c3), -9*15-c1-c4+c1/2
+L13: prn #16/3*c4-c1
+.define c5 = c2-10/2+c3+16-c2/4
+mov L6[14], r2
+.define c6 = -c3*16-18
+hlt
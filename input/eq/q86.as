@@ -0,0 +1,120 @@
+.define c0 = -2
+prn #5/3/3
+.data -c0, -(-1), 15*-8*19, -15+16+c0/5
+prn #c0/4
+mov #c0, r1
+prn #12+(15/5)
+.define c1 = -1
+L0: prn #c1
+mov #c0, r1
+mov L0[18], r2
+.define c2 = c1/3-4-4-(3)
+prn #c1+-(c0)
+.define c3 = -c1-c1/3/5
+.data c2/2
+mov #-15-(7), r0
+L1: mov #(((c2))), r6
+.fill 4, ---c2
+.data 10/1, c3, c0, c0*(15)
+L2: mov #c3-12, r3
+.define c4 = c0/4-17 + c0 + 12
+.data -((6)), c2, 20-c3
+L3: prn #13-c4*c2/2
+L4: mov #-11-c4+c1, r1
+mov #c3+c3+4-c3-c1-6/5, r3
+.data 9, -16
+.data 1+c1, 15, 10
+prn #15
+.define c5 = 6
+mov L2[2-9+c0--13-c0], r2
+cmp #-c2*20-c2, L4[-c5-5*5-c2]
+mov #-0*c0+c1, r2
+.data 19, 4, c0
+.define c6 = -18 + 4-3
+L5: mov #13, r3
+L6: mov L4[3+c0/2*13-7/3], r2
+L7: .data c1+c0*c4-13+0/2, 20, c3*c3-7/2
+.define c7 = -c1*c2/3
+mov L4[-20-19/5], r2
+L8: .data c3/2+c1
+.data 8, c1/5/4, 10/14
+L9: mov #c4*18, r2
+.define c8 = c6
+.define c9 = 0
+cmp #-11*c8*c0-c5*c4+14, L0[16]
+mov #c8+12*c6*c4, r5
+.define c10 = c3*-c1-c8
+.define c11 = 5
+cmp #c3-c7, L0[3]
+.define c12 = c6
+.define c13 = c3-c4/17/4
+mov L4[(c13/5)/4], r2
+L10: prn #c0+c0+18/20
+mov L8[c6], r2
+.define c14 = c8
+L11: .data -c1/2
+.define c15 = -7-c12*-c6
+mov L11[c7], r2
+L12: .data 3+c0, 19*c14*2+c8+(3), 11, 19
+.define c16 = c10+17/2/2
+mov #-c5, r3
+mov #c0/3, r6
+mov #(11), r3
+.data c3*0, (16)-c0-18*0*c3/4
+cmp #c15*c16*c9/5, L3[c10+15*c3+7+(c10)]
+.data c4, c7
+cmp #(19), L2[12-c9*c0+18]
+.define c17 = c7 + c8/4-c8
+mov #c1, r7
+.define c18 = (7)/4+c14-(c14)
+L13: mov #-2, r2
+.define c19 = 7+13*19-3+-(17)
+L14: .fill 2, 11/1
+prn #(3*c2+2*c0)
+mov L1[-0-17/6], r2
+.define c20 = 4-11-16*c5/2
+L15: prn #(9*c17)*10*c8-8
+mov L11[8], r2
+L16: prn #((c19))/3
+mov #c2, r6
+.data c10, 16, c10-c15+3/8/17, -c19-c10/3
+mov #c18, r3
+mov #c7-15+15+17-14+4, r2
+L17: .data 7, (18-c16), 4
+.define c21 = 19*(c3-c3)
+.define c22 = c5/5-15+(3)
+.define c23 = c12/4-18 + 11/3
+L18: .data c12/2
+.data 10, (c6), (11)+c10-(16)-c20
+.fill 1, c18-c12*c4-c23
+.define c24 = ((12))-4+12+c5/16
+.define c25 = -12
+.fill 2, c8
+L19: mov #-c0, r3
+L20: .data c14-c15+2*10-c15*10, 19, c23, c7*c16/2
+mov L19[16+c15+-14-c19], r2
+L21: mov #18, r1
+mov #(3), r2
+L22: prn #7
+mov #-c23+c7-c24, r5
+mov #(11)+(1), r5
+mov #4, r7
+L23: cmp #(-9+c23), L18[c2/1]
+mov #3/5/1*-c25/1, r7
+L24: .fill 4, c11
+mov #-6, r7
+L25: mov #c17, r2
+L26: .data (c13*c15), 11, 10
+.data 2, ((c25/2)), c11-c1*c25+18
+mov #11, r0
+mov #12, r6
+L27: .data 9/1+1+c20/1, c7, 16+c7--c22, 16
+.data 19
+mov #-c5, r0
+mov #c9, r3
+L28: .data (14), c22/2, (c14*c18/2)
+L29: mov L24[(10)-c10-1+(c10)], r2
+.fill 1, c1
+.data c19
+L30: mov #-c17, r1
+hlt
@@ -0,0 +1,39 @@
+prn #5+6*2+0+10
+mov #-18-15/2, r4
+.define c0 = 10
+mov #(10+c0+3), r2
+.data c0*c0, 13
+L0: mov L0[18*c0-0-0], r2
+.define c1 = 20
+.define c2 = (c1)
+.define c3 = c2
+L1: mov L1[c2], r2
+L2: .fill 3, 6+((5))
+.define c4 = 1-2/1 + (c3 + 11)
+mov L1[c4], r2
+L3: .data c0, 6/2+c1/1, ((c1*20)), 15
+.define c5 = (c2)*-9/6
+L4: .data 0/3/2, 14*2/2*c3/3/4, c4*1*11/5-(20)-c3
+mov L3[(4*1--18)], r2
+L5: .data 13*5-1
+mov #c1/4+c3*c4+c0-c0, r0
+L6: .data 15, c3+c2+11--c4*12, c5
+L7: mov #-c1-c2-c0+c4/1, r4
+L8: .data c1*(c1)-(11)/7, (c3), 0-11, -c4
+.define c6 = (12) + c3 + 8 + (c1)
+mov #c6/1, r1
+mov L2[7/3], r2
+L9: cmp #-(c1)-18/2, L6[6/9]
+L10: mov L10[7+10+12*c1--9+(c0)], r2
+.define c7 = -4 + c0*c2/12/1
+mov L10[c7+c3-3/5-c1+15], r2
+.define c8 = 9
+mov #13/1, r1
+mov L0[13/3/2], r2
+.data c1+c5/2*c6, (-13)+c2*c8/4
+mov L1[((c8))*(8+c8)], r2
+L11: mov #-(c1*20), r2
+mov #2-2/13+14, r0
+mov #4, r3
+mov #(c8)/2-11-7, r1
+hlt
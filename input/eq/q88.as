@@ -0,0 +1,71 @@
+prn #0
+mov #5-(13)/3, r1
+mov #7, r7
+L0: cmp #-13-4/5, L0[13*1*16/9+-14+13+10]
+mov L0[10], r2
+prn #4-13-17*1
+L1: mov #0-6*18/1, r0
+L2: cmp #11*5/4-(11/20), L0[5/6/4/1]
+L3: mov #-7+5, r5
+mov #(4+2-7/3), r5
+.define c0 = -(13/3)
+mov #c0/5, r1
+L4: .data (-8+c0), 4-c0+c0/1/3
+.define c1 = c0*(c0)/2
+L5: .data c0/4/2, 13, c0/2-19*c1/3
+L6: mov #-c0-c1*16/4, r0
+cmp #-c0-c1/20, L0[(c0+17)*-c0+c1]
+prn #-10+5-3/14
+mov #c1+c0-c1*c0+(13), r5
+L7: mov #(0)/5+-c0*6-c1, r4
+.data c1/3/3*10+c1-13*9, c1, 8*c0*c0+7+11, c0*c0+11+c1*7
+cmp #c0/11/4+c0, L7[c1*5*13+c0/13+c1]
+L8: .fill 2, -1-4*11-18
+mov L2[11*-1+c0-c1], r2
+mov L7[0/4+c1+c1+c0/4], r2
+L9: .data c0
+.data 19, -c1+6+3*14, c0/2, (0)
+.define c2 = (c0*14) + c1 + 1-c1
+L10: .data (17/5+18-c2), -c2*c2+c0+c1+c0/1, 14--c2-(4/16), ((4))*17
+.fill 4, 1*19+c1*c0/2
+prn #-c2--c2
+.define c3 = c0
+.data c3, (c1)-c0-18-c1, -13, c3
+prn #-(c1)+(-15)
+.define c4 = c2+-15/4
+L11: .data c2-9/3/4, ((c1))
+.fill 2, c1*18
+L12: mov #(4)*14, r6
+mov #c4-14-18/19/20, r2
+mov #c3, r2
+.fill 1, c3--3/5
+.define c5 = c4-7/17 + c3/5 + c0/19
+.define c6 = -4/3
+.define c7 = -2+11+c1
+L13: mov L3[(9)/1-16/4], r2
+.define c8 = 14/3-c4/2/3
+mov L0[14+0*14*c2], r2
+cmp #c5, L3[c6]
+.fill 1, c4*c8+c3/3
+L14: mov #4*c6*13/3, r6
+.data 18, 18, 2
+.define c9 = 0*c5/3/2
+L15: mov #-c5*12+c4, r0
+.data c1, c6*(20)+c1+c3
+mov #20/1/18*c9/9, r2
+prn #1
+L16: mov L10[c2], r2
+L17: mov L13[17], r2
+.define c10 = (12/5)*c0
+mov #((7)), r2
+mov #-19/2*12-7, r3
+L18: .fill 3, 8*c10-17*-19*c0-5
+.data c0/19/3-4+-14, (c3*c7)+-19-c10, (c6*5)+16
+.define c11 = 18--c10/1
+mov #14/1, r0
+.data -c10/7/1, 2/2*c8
+mov #13, r5
+prn #-c0-c2/1
+mov #-11*17-9/1, r0
+.define c12 = 7
+hlt
@@ -0,0 +1,31 @@
+prn #11
+L0: cmp #(18*0*5), L0[11+0-4+8+15]
+L1: mov #(16)*11-18*17*6/3, r4
+mov #-13*13/9, r7
+L2: mov #16+18*8-8*14/16, r6
+.define c0 = 19
+L3: mov L1[18], r2
+L4: mov L0[c0], r2
+.fill 2, -c0
+cmp #17/2+1*17-c0-c0-9*7, L1[17]
+L5: cmp #-13-20+c0-c0, L0[4*c0/5/3]
+.define c1 = -12*c0/10
+.data (--c0), -1, c1-c1-(c1)*18/1
+.data c0+14-c1
+mov #20, r2
+mov L1[-(c1/2)], r2
+.define c2 = (-c0+8)
+.define c3 = -6/5-18 + 8
+mov #c1, r3
+prn #(c1+20+c2)
+L6: mov L5[(-6+c1)], r2
+L7: .data c2/14
+.define c4 = 18+1+(3)
+mov #c4/1, r7
+prn #8-c0/2+12
+mov #-(16)*13, r6
+mov #c1, r4
+L8: .fill 1, 0
+.data 16+c1*1+4*13-c4
+.define c5 = c0
+hlt
@@ -0,0 +1,80 @@
+L0: mov #0, r5
+mov #17, r0
+L1: mov L1[4/7], r2
+mov #12/4, r7
+.define c0 = -18-0 + 6 + 18
+prn #-7*1+19-1
+.define c1 = -2*15 + c0 + (c0) + 0*c0
+.data 5*c1, c0, c1+c1, c1
+.define c2 = c0-5-8*15 + c1
+mov #14*c0+20/17+c1, r0
+mov #11, r3
+L2: cmp #-4+c0/1, L0[c2-(3)]
+prn #c1*c1/4/1
+mov #6/1/5, r3
+mov L0[10+-(12)], r2
+.define c3 = (16)
+L3: mov #c1-c2, r1
+mov #(13-c0/2), r1
+L4: .data (c1*c0--c0), c0+7-5+c1-c1*c3/1, (16+18)--7*c2, (c2+c3)/5
+L5: .data c3*2*-0, -20+c3+c3, -c3/10, (c3)-c2/5
+L6: .data c2, c3+5-c2+12, c2-10/5*c1+10/15, -10
+mov #(c0+c2*c3*8), r3
+.define c4 = c0
+L7: cmp #(c1), L2[6*c1+5]
+mov #(c4-12*(c2)), r1
+mov L5[c1], r2
+.data c4
+mov #c0, r7
+.data -c4, 3
+.define c5 = c2 + c4-c3/8
+L8: prn #9+1-c0*7*c1+c4
+mov L8[6], r2
+mov #c2, r0
+mov #(14*c1)*c0+18+4*c0, r7
+.data 4-14, (((c4))), c0, 16+12*c3
+cmp #1, L5[(12)+8/4]
+.define c6 = -5 + (11)
+.define c7 = -0
+prn #-c6+c3+-11
+.data c5-19+10+-c5+(c3), 7/4*6-0, c0/1
+L9: prn #-18+c6/14
+L10: .data (c3)+c3+17+18+c2+c5
+cmp #(c0), L1[19*18+3/3]
+mov L0[c4+0], r2
+.data -c1-c5+-5, c1, 15-1/3
+.fill 4, 0*20-13/4
+cmp #5-16, L2[1+3/20]
+.define c8 = 17+c6/6-c1+9
+mov L8[16+13+c7-c5-c0*13], r2
+mov #c7, r5
+prn #19
+.data c6-c8/3/2, (5)--c8, -c8, 20/20/1-10-19/1
+mov #16, r4
+.fill 1, 1+15+-16*-c0/1
+prn #1+8+c2-17
+L11: mov #-c3*c7/12-5*c7, r1
+mov #((c8)), r6
+L12: mov L7[15], r2
+.define c9 = (18)/5
+mov #8, r1
+mov L7[--1], r2
+mov #8*(8), r0
+.define c10 = 6
+mov L9[3], r2
+cmp #c3*c8, L3[-18/14*16*19]
+L13: mov L13[8], r2
+L14: mov L8[c1*c4+c3-10], r2
+prn #c10
+.define c11 = c7/1*c10/3*(c0)*(20)
+mov #9+7/1*c8, r1
+.define c12 = 14*(c5)
+.define c13 = 17*4/1 + 3-c3-c4
+prn #c13*c4/3
+cmp #c5-c1/1-19, L7[0*c9-12+c4/5+-14]
+.define c14 = 14*c2/1*5
+.define c15 = 14
+mov L14[c12*c7], r2
+mov L3[9], r2
+mov #c13, r6
+hlt
@@ -0,0 +1,47 @@
+prn #-2-16*12+20*17*8
+.define c0 = 0-13
+mov #-6/5/4, r4
+.define c1 = 17
+L0: mov L0[c1*(12)-c0*c1], r2
+prn #c1+-1+13
+prn #(c0-8)/1
+mov #-c1-11+(c0), r0
+L1: mov L0[(20-2)-(c0)+4], r2
+L2: .data -1/18/1
+L3: .data (c1-4/5), -7, c1+7+9+c1*c0, 10
+mov #c0+(0)+-c1, r7
+mov #9-8, r7
+.define c2 = 15*c0-c0+(-17)
+.define c3 = -(-c0)
+.fill 1, (c1)-12
+.data 0, 11
+.data (c2)-2+c2-9-c2-c1
+L4: mov #20+(9)*c0, r2
+prn #c3/2
+mov #-c1-9*18*c0, r6
+.data --c0--11, 10-c0-c0+c3, (c1)/5/3
+L5: mov #---c2, r4
+cmp #c0, L1[(c2)-c1-18-9]
+L6: .data -11-20*15+c2, (c3), (c3+c3-8-c3), c1
+.define c4 = -16-c3*6/4
+L7: mov #(14), r5
+.define c5 = 8
+mov L0[2*c3*13/5], r2
+mov L1[c3+8], r2
+mov L7[-c5], r2
+mov #10*5+c3-c1/1, r4
+L8: prn #1
+mov #--12*15/1+c4, r3
+L9: mov L2[c3], r2
+mov #c3, r1
+mov #((c1)), r4
+L10: .fill 1, ---c4
+.fill 3, -c2*c5*c4/16-2+c2
+L11: cmp #10*c3*c0+14/5, L5[-10]
+cmp #c0, L2[c4-12/2*9*15]
+.define c6 = 13*11 + 8*11
+L12: mov L11[11*c2-c4*c3], r2
+prn #c0+6
+L13: .data -0/1*3+3/5, (-5), c0+(17)*c6*19
+prn #(c6*c1/1)
+hlt
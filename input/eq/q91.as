@@ -0,0 +1,31 @@
+mov #17*20+17/20/4, r6
+.define c0 = (19*11)-17+6+13
+prn #9-13/3
+.data 5--9-18, c0, c0+(-c0), 3-(c0)+c0/5
+.define c1 = c0+c0*c0*16
+.define c2 = 8-c0*(16)-c1/1+c0
+.define c3 = 14
+mov #7+c3-3+6*c1, r6
+prn #3
+.define c4 = 18/2
+.data -c0-c2/2, c0+18*1/3/4, 12
+.data 4-c1/4-c0*c3-c2*8, 6/4+3+15-14, c4+c2/4+12
+.define c5 = c3/2 + 13 + c0*c0*18
+mov #-c3+-c2+c2*(c5), r5
+.data -8/3+(c5), c3/2*(13)--6-11, 1*c1/1, 18
+L0: .data (17+c1+c4), (-c1), c3
+mov #15+c0*c3+(18), r2
+.data c4, 5, 10-c4/1+-c5
+prn #-13*2-6
+.data c5, -4/14+16, -18, (c0)+20+c4/20
+L1: .data -5*13/1+-c1, 12*c5-c4+(c5)
+.define c6 = c0
+mov #c2, r6
+.data (2)/1
+L2: mov #c3, r0
+mov #(-8*c1), r7
+cmp #((c3*c3)), L2[9*c2/19/5]
+.define c7 = (20-c4--c4)
+mov #(c7)*(20), r2
+L3: mov L2[(c3/2)], r2
+hlt
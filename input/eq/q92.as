@@ -0,0 +1,74 @@
+mov #2-4-15-5*-0+20/2, r6
+L0: .data 15*2+-19-3-9-0, (10)
+cmp #17, L0[14-20*12+16-5*3+4]
+.fill 2, 17/6/2/2
+.define c0 = 11-(3-12)
+mov #8/3*13-c0--18, r1
+L1: cmp #c0-0+c0+c0*c0*c0-c0, L0[c0+-2]
+L2: mov #(3), r5
+mov #(c0)-c0*9/2, r4
+.data -3--4, c0-18*(14)/3, c0+(c0)
+cmp #c0, L0[c0*--c0]
+mov #c0, r1
+mov #12, r0
+cmp #-c0, L0[15-c0-10/8/4]
+L3: mov L3[7/16+c0+c0*c0], r2
+L4: .data c0/9-c0+6+-c0*(c0), 7+c0/3+14-c0-4, -(c0)
+.define c1 = (11/5)-13
+.fill 3, c0
+L5: prn #c0*c0-12*c0+6
+L6: prn #c1+c1/2
+L7: .fill 4, c0*c0*c1
+L8: .data c0+c0, -c0*c0-(5-c1), c1+13*6+c0-c0*c1, c1+(c1/4)
+mov L7[c0], r2
+.define c2 = 15
+.define c3 = c0
+mov #14/3-c0-c3+c0, r6
+L9: .data c3, c1/2, (c0), c2-10-20-c2
+mov #-c2-c1/3*8+2+(c2), r3
+.define c4 = 3
+mov #c1, r1
+L10: cmp #(9-1)+17*c3/2, L10[8]
+L11: .data --1/3, 17/3+-c3/2, 11--c1+c0-c4
+mov #-(c2)*-20, r0
+mov #2, r2
+L12: .data -3+1*15/2
+prn #--13+(c1)-9
+mov L8[c4+c4*16*-3/5], r2
+.define c5 = c1
+L13: mov #4/16-c1*17*-c2-11, r2
+L14: prn #c5
+mov #c5/1-0, r0
+L15: mov #c2+c5/4/5, r4
+mov #(c4+14+17-c5), r0
+.define c6 = 9
+.define c7 = 2
+prn #(11)-(2)+(c2)/4
+mov L14[c6/1], r2
+prn #c2
+.data c3+c1+c5/1, ((-c1)), (c0)
+mov L4[(-c4+(7))], r2
+.define c8 = -6 + -5
+mov #-15*c7/4, r6
+.data (12)*12/5*-c6-9*7, --c5+(1), (17)/5-14, c7
+mov L13[4-8*c0-c6/1], r2
+mov #-(c8), r7
+mov #c7, r4
+.define c9 = (12*c1-(10))
+L16: .fill 2, ((8))
+.define c10 = -(-9)
+L17: mov #-3-2+c5*17, r4
+L18: mov L14[c2*c2-5*14], r2
+.data 12, 9, 17+20, --c8+-c2
+.data c8-c0
+mov #((c8)), r7
+mov #12+11, r1
+L19: mov #(c9/10)*c4, r5
+L20: mov #(c8)*10-0, r1
+.data c4*c0+0+16/8, c3, 19, 19+5
+.data (c5)*(7)*-15, c0+-c8*11, c8
+mov #(c6*8-16/4), r6
+L21: mov #--c0*c5/18, r5
+L22: mov #17, r4
+.define c11 = (-20-3)
+hlt
@@ -0,0 +1,84 @@
+prn #5-20+3+11+-3
+mov #-9/1, r0
+.data 14, 19*1+0+(8-2), 2-1-7+13, 0*12-10*1
+.data -16+17, 2+14+-1*20, ((13-19)), ((12))-1
+mov #13/13, r3
+mov #10+19, r3
+L0: mov L0[1--11/2], r2
+L1: prn #14/3-8
+L2: mov #5+0-20*4-17--11, r1
+cmp #((0/8)), L0[18]
+mov #-0-16+20/15, r3
+.data (-14), 11+0/11*-19, 20, 9
+mov L1[-2*15/5], r2
+.data -0/5
+.define c0 = 9*11+12+8-13
+.data 4+1-1-c0-c0/6/3
+.data 10*-9/4
+cmp #-0/3-c0*c0+c0, L1[(c0)-c0-c0+14/5]
+L3: mov #6, r3
+.define c1 = (-7)/4
+mov L3[c0-(0)*c1*c0], r2
+.data 8-c1/19/1, --c1/5
+mov #19+(c0-c1), r5
+prn #11
+prn #(12)+12-c0-c1/2
+.define c2 = 17
+mov L0[(c0/11)+c2], r2
+.define c3 = --15/3
+mov #11, r2
+prn #3-c3+2+(15)
+mov L2[-0*6-7+2*c0], r2
+.data (-5/4), -(0*4)
+.fill 1, 14
+.data 14
+.define c4 = 7
+L4: prn #17
+L5: mov #-c0/2-5+4, r5
+mov #c3, r0
+prn #c2-(c2)+(8)
+.fill 4, c1/4
+mov L5[c4], r2
+.fill 2, -5+c2/3
+cmp #c3, L3[(-20)/3]
+mov #0, r5
+.data (15+c2-c0)
+mov L0[(c1+c2-19)], r2
+prn #0/4
+.define c5 = 3
+.data 16, 5/2/2, -1-20/5, 15
+.define c6 = (c1*c2)
+.data c5
+prn #--c3
+.define c7 = -4
+.fill 3, c4/4+c7-c7+9/3
+.fill 3, c1
+cmp #(0), L3[-13+c2-c7]
+.data 12, (c6), 2-13*17/1
+mov #16, r4
+mov L4[10], r2
+L6: .data (17*c5)/5, --c7+19, -c1*4-(19), -c0+c6*17
+L7: mov L2[c5*(20+c4)], r2
+mov #2-c7*0+(12-c0), r3
+.data --c0/1, 11--c6/3
+.define c8 = c5/5--3
+.data c0/2, c2, 20+13*c3*9+c1-c8/4
+L8: mov #c3/1, r7
+.define c9 = -c7-c8-c0
+.define c10 = 3
+L9: mov #8*(c8)-6+8, r0
+L10: mov #c4, r7
+mov #c10+8+c10-19/5+13+2, r0
+mov #((c0)+c10*3), r4
+.data c3, -c6+c1, (17), c1
+prn #13-15+c4*c4/4
+L11: mov L7[c5], r2
+.data 10*c7/1, c10/4*c0+c9/5
+.data -7, 5
+L12: .fill 1, (3*c3)
+L13: .data c9, c10+20+1/2
+.data 12*c5, -c5
+mov L6[0-c7+9+-16], r2
+mov L9[12], r2
+mov #7-c4/4, r7
+hlt
@@ -0,0 +1,90 @@
+.define c0 = -14 + 13/3
+.data ((11)-c0), (5+c0+1), -19-c0-c0/4, c0-c0-c0*-c0/3
+.data 14*c0/2+(19)/3
+.define c1 = 8
+.define c2 = 8
+prn #9-16
+mov #15, r5
+mov #c0, r2
+.fill 2, 3
+L0: mov L0[(11/4)-c2/2*12], r2
+.define c3 = (c0*5)+(c1)
+mov #(c2), r6
+cmp #8*c1, L0[c2]
+.define c4 = 9+18
+.fill 3, c0+13/6+5/3
+.data c4
+L1: .data 1*c1+((c3)), c0*16/5+12*0, (c1), 6
+.define c5 = c3*7
+cmp #--c5*9, L0[6]
+.data c1
+mov #c1, r0
+L2: cmp #c4*6-c2/2, L1[c4]
+.define c6 = 17
+.data c2-c5/3*1-c3*18-17
+.data c5+14, c6+11-c4-c4, 9
+.data 5*c6*12
+mov #(c5-5)+(16), r0
+mov L0[8], r2
+.data -20-19*-c6*c6/4, 14
+L3: .data c2, (c2/3)*c3/1-13*1, 14
+mov #(4), r4
+.define c7 = (c1)
+.data c2+c0*10+c2-12+8, -12, 5
+L4: .data c3
+mov L0[c0*12-7/18-c1-6], r2
+mov L1[4+c1+10*(c4)], r2
+prn #(c1)/5-(c7)
+L5: mov #4, r0
+.define c8 = -c7-5*15
+.define c9 = 1/4
+mov #17-c8+(c9), r6
+.define c10 = -(c0)
+.data -(-11), (c9)/1+16-c5-c4, --3+c5-c9, -3
+mov #20, r2
+prn #19
+L6: .fill 1, -c6/2/2
+L7: mov L0[0], r2
+.define c11 = (7*8/3)
+.data c7+20/2/5, 15/3*c7-c10-c6-4-11
+mov #4, r0
+L8: mov #c6*c6*c2-6*c2, r5
+L9: mov #((8)/3), r1
+.fill 1, 19
+.define c12 = c10
+.define c13 = c7
+.fill 4, 10
+L10: .data 10*-16-c9, 0
+.define c14 = 5*4/3
+mov #-c6-c5, r6
+prn #c12+8
+L11: prn #(4*16)/2
+.data c2-15+9*10*(8)
+L12: .data -c5-11-c4, 17*c6*-c5-c6
+mov L8[c8*c11/5], r2
+L13: mov #c0, r1
+L14: mov L3[19*2*6*-8], r2
+.data (c8)/4
+L15: mov L9[c5/4--7*17/4/11], r2
+.data (-11)*20/5/2, c2, c9+c12/2+c11, 19-(12)
+cmp #12+18+0/4, L8[-c4-c5+12*c3]
+mov #18+18, r6
+.define c15 = (c12+2)
+.define c16 = c14
+mov L13[1], r2
+mov L13[4/2], r2
+.define c17 = -12
+.fill 3, 16+16*-16/15
+prn #c3/2-(c17)/5
+.define c18 = c10*14*14 + c10
+prn #c18
+.data c2, (c9/4)*-c5, 12+19/3*c12, 8
+mov #12/12*1/15+-c0+11, r6
+mov #c8*-c0, r7
+.define c19 = 7-c14/3/5
+cmp #4, L7[(c14)-c9/4]
+prn #c0/3-7+(c17)
+L16: .fill 3, -0*5*11
+.data -10-17*3-c16-c0, c1, (c8*c12-c11-13)
+mov L0[c17], r2
+hlt
@@ -0,0 +1,118 @@
+mov #-12+-12-16*1+0, r5
+mov #12*6/5-3, r1
+prn #0
+.define c0 = -6+14-4/20
+.data c0, 2
+L0: cmp #19+-12, L0[-c0/14-13]
+.define c1 = -(-19)
+.define c2 = -c1-15-c1*c1
+mov #20, r4
+.data c2*9-c2/1
+cmp #c1/1, L0[7-c0*19-(18-c2)]
+mov #16, r1
+.data c2, (c0)-6*c1+c2/3
+.data 18-9-4, c2+3*7/3, -c0/1/1, 10
+L1: cmp #-(0)*(15), L1[c0]
+L2: mov #0--0-c1, r2
+L3: mov #c0, r1
+L4: .data 1, c2+c0*c2/20, (12)-(9)
+mov #8, r1
+mov #c2-17, r3
+.define c3 = c0+8-2-13+5-(c1)
+.data c0, 9, c3+-4+c3
+.data 20
+.fill 1, c3+1
+L5: mov #c0/1, r1
+mov L3[c2/14], r2
+L6: cmp #(c3+1)/4, L6[((c3))+0+c3-c1]
+mov #17+c3/3*13, r4
+.data 1-c1+c3-c3+c1, --10/17
+mov #-19/5, r4
+L7: mov #c1, r6
+.fill 4, c2
+mov #c2/5, r1
+.define c4 = c2
+mov #18*(19), r4
+.fill 2, (c4*c3)/3
+mov #-c2+c3+c3+12, r4
+L8: cmp #7*-c2*17-c2, L5[((7)*c1)]
+L9: mov #(3), r4
+prn #c3/2
+mov #((c0)), r7
+.define c5 = 17
+.define c6 = 6*c3*c5 + c5 + 7
+.fill 1, 9--7+2
+L10: mov #c1+-9+c0-c0, r5
+.define c7 = --4-c0
+mov #11/2/2, r3
+mov #(c0*c5+c7*c3), r0
+mov #(8)/5*c3, r2
+L11: mov #c2*5-c0, r1
+L12: mov L11[c2], r2
+L13: mov #(c3/1), r4
+cmp #10-c3/4-12, L7[10+14/2-14*c4*6/3]
+mov L6[-16], r2
+L14: prn #--c7+9
+L15: mov L5[6/1], r2
+L16: mov L4[(c7-16+8+c0)], r2
+L17: .data -11-17*11+c6/2, c2, c1, (16)*-14/2
+.define c8 = c2
+.define c9 = c0+c1
+mov L0[(14*c3/1)], r2
+.data c9/3, (3-9), 0*13+3-20*c9
+L18: mov #5+--16, r4
+.define c10 = 16
+.define c11 = 19
+L19: .data c9, c1*c9/1*--c2, c2-c5+c0*c3, c3
+prn #5
+L20: mov L17[c8/5], r2
+L21: mov L21[c11], r2
+L22: mov #c6/11-(c1)*-13+15, r4
+L23: mov L12[c6-11/1/5], r2
+.data 11*17/3/4, 20*c4*-5+15-15-(c1), c4, (c11-c7)/5
+.define c12 = -5/8
+mov #14*9-16-c9, r2
+mov #c9+2/1, r7
+mov L10[c6-c9], r2
+.define c13 = c1
+mov L15[c11], r2
+L24: mov L23[10], r2
+.define c14 = c12
+prn #c0
+cmp #6*-8-(13), L23[(0-c2)-5*c3+-c2]
+mov L17[(c5)*1], r2
+mov #(15/1*4), r1
+.define c15 = -(-8)
+mov #-c11*5+4/4, r3
+.define c16 = -18
+L25: .fill 2, -14
+.data 9
+L26: mov #c14+c9+c10, r6
+L27: mov L17[-((15))], r2
+prn #c12/5
+cmp #-c12-c13-19-9, L18[10]
+L28: mov L23[c14], r2
+prn #(9-5/3)
+mov #13/2-c4/3, r4
+L29: mov #c0, r5
+.define c17 = (c8*11)-c11
+L30: mov L5[14], r2
+.data -4-16+9
+.data 18
+.define c18 = c2
+.fill 4, -c5
+.define c19 = c4
+L31: mov #(c8*c5), r3
+prn #c13
+.define c20 = c8
+mov #c15, r7
+.data c19+3/4/2, -18*c15+9*c16, 3+c14
+.fill 2, 10
+mov L17[c20+-c11*3], r2
+prn #c15
+mov #(((11))), r1
+L32: .data 10+(8)/2, ((c6-0))
+mov L10[11], r2
+.data (c2)/2, -c3/4+c17*c0
+.define c21 = c2
+hlt
@@ -0,0 +1,68 @@
+.data 10, -10+20
+L0: .data -18+9/2
+L1: mov #0-5*18-6/19/5, r7
+.define c0 = 14
+.define c1 = 2+-c0+4
+.data 14
+L2: cmp #-3, L2[11*c0*13/1/4]
+.fill 1, 18*-c1*c0/2
+prn #4
+L3: mov #c0-8-c0-c0-16-c1, r1
+L4: mov L1[c0*c1/3/4], r2
+mov #--c1-(2), r4
+L5: .data c0*c0--6, c0, c1*19, c1/4
+.fill 4, 8
+mov #(c0-16)+c1, r4
+.define c2 = 15*3*3 + (c1)
+L6: .data --c1+5, -(c0-c1), 15
+L7: mov #c0, r1
+L8: .data c0/2-4
+.fill 1, 20-19*13-c0/3
+mov #c2, r0
+.define c3 = 2
+L9: .data (18), c3
+.data (19+19)+-0, 2, 17-(5)--14-10, (c2)
+L10: mov L7[c2/4], r2
+mov #7+18*10+(c3-7), r3
+.data c1, c0--(c1), (c3)
+.define c4 = c3
+L11: mov #--c2-3, r5
+L12: .data c1*c2*-14
+.data 4
+mov #-11-c2*c0*c0, r2
+.define c5 = c2
+L13: prn #c5/2
+.define c6 = -c5
+mov L11[c5*8*(8)/5], r2
+L14: .fill 3, 5*c5*-c4-20/1
+.data ((3)+-c2)
+mov #20+8*c6/5, r6
+mov #5*c2/5*c0--11, r4
+.define c7 = 16+c1/2+5+14*c1
+L15: mov L9[-(c0)*-c7], r2
+mov L3[c3], r2
+L16: mov #c4, r7
+L17: .data -c2-3/16
+L18: cmp #15, L14[14+c4]
+L19: mov L1[-2+c2-c3/17*20], r2
+.data -13/2
+mov #(13), r0
+.define c8 = c2
+.data c6-13*17*c3*c5+9, 7, 12*-c1, c6*10+c4
+.define c9 = (-19)-12
+.define c10 = c2+16-c6-c7*15/2
+L20: .data c10+c3-16-c10*11, c9
+mov #(c9)/2, r0
+.define c11 = c10*c7/10-c3*18
+prn #7-8/2-2+7+c1
+.define c12 = -c2-c8+c0-c0
+L21: mov #-c11+c5-c2/1, r1
+prn #-20
+mov #-(19)--10-c11, r0
+.define c13 = 3 + 0
+L22: mov #c7, r7
+mov #-(10), r5
+.define c14 = (13)*c4 + c2-8
+.data c12, 1, (3)
+.define c15 = (12/5)
+hlt
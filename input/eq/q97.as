@@ -0,0 +1,45 @@
+.fill 1, -14+8
+L0: mov #-4-7-13, r1
+L1: mov L0[-4-0*6+18/7], r2
+mov #1*9-19/5+1+16/3, r3
+L2: .data 17, 9+1-14+17, 6+17
+.data -4, (15/4)
+.define c0 = 18*19 + 6-1
+.define c1 = c0
+L3: mov L1[3*c1], r2
+.define c2 = (c0)
+prn #16/4
+.define c3 = -c0/14-16+16
+L4: mov #c3, r7
+mov #16-c2*c2, r3
+L5: .data 5
+L6: mov #c3+c3-c0-c2/13, r2
+.define c4 = (c2*1)-7/19-c1-1
+cmp #0*4*c3*2, L0[c3-c2+5/1]
+L7: prn #-17/5*5/13/5
+prn #c0/1
+L8: mov #-7/5/5, r5
+.define c5 = 13
+cmp #18/5, L4[17]
+prn #11
+L9: .data c3, (c5*12*c1*c3), (4*12-9+10), c0
+.data 1+c3-3/2, c0/4*2, (c3)+(c1)+11/20, c2/5
+.define c6 = c4+6+c4+(c3)
+mov #c6+c0/1/5, r7
+mov L1[-12/18*13/2], r2
+.define c7 = 2
+.define c8 = c5-17*12*15-11
+mov L2[-c2], r2
+.data 13, c3, 11+c2
+mov L4[(9)+(c7)*19*5], r2
+mov L3[8], r2
+.data (c7*4)+c8-c3+c8
+.define c9 = c5
+.define c10 = -16/16-1--c2
+mov #(6*c8-c2), r7
+.data 8/14*0-19*13/1, (c2+7)*c2
+.define c11 = c1/2+c9/1/1
+L10: .data 15+3+12+c4
+L11: .data 3/5+(5)*12*8, 16*(13-c5), -17*19-3, 10
+mov L11[c9], r2
+hlt
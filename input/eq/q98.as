@@ -0,0 +1,66 @@
+L0: mov #(9*0*20+6), r5
+.define c0 = 5/17
+L1: mov L0[c0], r2
+mov #10-17/11-5*c0, r4
+prn #1
+mov #(-10/8), r0
+cmp #6, L1[c0]
+.fill 4, c0*c0+15/2
+mov #-c0+c0*11-c0, r0
+L2: mov #11/3+c0+18/4, r1
+prn #(c0)
+.data c0, 16+12+14-c0+20, (15), 3
+.define c1 = c0
+.define c2 = -c1
+.data -18*c2/5, 2-13+c0-3/7, (c1)
+mov L2[--(10)], r2
+L3: cmp #c2, L3[3/2*c2+-0+15]
+L4: mov #((20))+1/3/3, r3
+L5: mov L3[5], r2
+.define c3 = c1
+prn #c2-c1
+.fill 1, -c3--3
+L6: .fill 1, c0-17-c0-c1
+cmp #(4)--17-14, L2[16/8*c3+c2*(c2)]
+mov #(c1*9+2), r7
+.define c4 = 16-1*c0*20 + c1 + 5-c3-12
+mov L6[c4-c0-c3], r2
+mov #c0-10, r1
+.define c5 = c4*-c4-c2+c4
+L7: .data --c2, ((c2))-14+c4--5, c2*9*c1*13+4-c1*2/3
+.define c6 = 16
+mov #(4)*6*c6/2, r7
+.data -4, c6, c5, 2/2+c5-15+7
+.fill 1, -(c2)/3
+.data -13/4, c1*-0*9
+.data (8*12)+-c1+c0, c2
+.data -c3, (c6*(c2))
+.data 2-(c1/5), 11, -c0/3
+L8: mov #18/3, r0
+.define c7 = -c0--c0
+mov #-c2, r4
+.data c4, (9/1)*(c1)+c5
+mov L4[18], r2
+.data -20/3-(2), c0*c7/3, c7-13-10, 10*c5+15*c6
+L9: .fill 3, 8
+.data c5/4, --c4*12-c1-2, c5+c7/14/1, (11-14/1)
+mov L8[(--c7)], r2
+mov #2, r0
+mov L4[12], r2
+.define c8 = c5
+mov #c7*5*17*3+3+c5, r4
+.define c9 = (13)*c0*12-(5)
+.define c10 = -c8 + c8-c2
+L10: mov #(7), r7
+.fill 4, 7
+L11: .data c9+c4*c8/3, c7/4, c6+0
+mov #(c1+c2+16), r7
+mov #3+(c5)-9/4, r0
+L12: prn #2
+mov L3[(c2/2)-2], r2
+.fill 3, 14-c4*6*c5/2
+.define c11 = 18
+mov L2[18], r2
+.data --c2+6+4*8-10, 19/2, c8*-8
+.fill 3, 5
+hlt
@@ -0,0 +1,72 @@
+.data 2, 12
+mov #19, r7
+.define c0 = ((0))*2*16-5
+.data (c0+c0/5)
+.define c1 = -c0
+.fill 2, -c0-c0+19
+.fill 3, -c1+c1-c1+10*c1
+.data 7*10, -(10/2)
+prn #c1*(19)
+.define c2 = c1
+L0: prn #c0*c0-19/4-c2*6-12
+prn #--c0*c1
+cmp #-c2/1/2, L0[c2+c2-c1+c0*-17*(1)]
+.define c3 = c1-c1--c2-c2
+.define c4 = 17/4-c2 + c1 + 3
+.define c5 = c4
+mov L0[-c1], r2
+L1: mov #16-4-c2*c0/5, r6
+prn #10
+.fill 1, -15
+.data 5-7, -c5-10+13, c0, -6*8
+L2: mov L1[--c3*c0], r2
+.define c6 = c3--20 + c1
+mov L1[(7*-c4)], r2
+.data 2-16, c4+c4/4+(c1)*(14), c3
+.define c7 = 3 + 6
+.fill 3, c4
+prn #13
+L3: .data c4+2*5, 7*c0/1-c2-2*c2*14, c4
+L4: mov L4[(c5)-c0-c0], r2
+L5: .data c5-17*c1/1, c1/11/5+c2*13, 0*-c2+8
+mov #c2, r4
+.data 0*1/5*c7
+mov #-18/1/2, r6
+mov L3[9-0*(0)*c4*c1-c6+11], r2
+.data c2, 14, 20, -2/17*6+18
+.define c8 = -2/2
+.data (14/4-19/10), 15, 17*(6)/4
+.fill 1, 6
+.define c9 = c2*c4+c5+-6+c3
+.define c10 = 17*7*c5 + c9/4
+L6: mov #c5, r6
+cmp #19-c3/3+c4-0*c7/10, L0[--7-6]
+.data 6, (16), c5, 8-1
+cmp #c3, L0[c0]
+mov L6[-20*6*c1-(c7)], r2
+.data 15/14-c9+c9/1, -10*c7+16*19+9+c8, -8
+.data (c6)/5
+mov L2[c5+c9/5--c1-c0], r2
+.define c11 = 2 + (1)-c10-1
+mov #9, r1
+.define c12 = -(2)
+L7: .data c3/15+(6)*-c7*12/4, -c3*18/10
+.fill 2, c5
+.define c13 = c5
+.data 12/5*c4*1+18, 2
+L8: mov #10, r1
+L9: mov #c11-12, r2
+L10: mov #c3, r6
+.fill 3, c10
+prn #c4+c5+-4-7*12--13
+.define c14 = (14)*c13
+mov L5[11*c9*20*11/18], r2
+mov #-c0/3, r1
+.data 0-5, -c0-7/2, c9
+L11: mov #(c12)--c4/2, r4
+.data -c4--c4/14, 18
+.define c15 = 18+(-7)
+L12: mov L1[c7], r2
+L13: mov #18, r6
+.define c16 = 17
+hlt
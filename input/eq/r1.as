@@ -0,0 +1,62 @@
+.define K = 3
+.string "byb1#11:0#xb"
+.entry L38
+L2: mov L28, r2
+.string "bzaaa:9a0"
+.string "x#119xzx", "1ya0"9:bc:.""
+mov L45, r2
+.string "":xyy;1"" ";"a1x."
+L7: .string ".#:.zb1:"
+L8: mov L25, r2
+.string "ay.";;;"
+L10: .string ""
+.string "09z" "z1y:9;.a0"
+prn #K
+mov L33, r2
+L14: mov L60, r2
+.string "9x901"z0z"
+.string "1;a#x" ";c"b#9#""
+.string "bb"a1a##yx"
+L18: mov L18, r2
+L19: .string "c:y:.y1."
+L20: .string "z0#xyb"
+mov L38, r2
+.string "a0c"
+L23: .string ":09"x:#.", "9:a"
+L24: .string "0a.ycxayb"" ".c0;"
+.string ""
+.string "c"""#.;"
+L27: .string ";:0"
+.string "y91az;"
+.entry L12
+.entry L36
+L31: mov L13, r2
+L32: .string "9z":91"
+L33: .string "" "c9"
+mov L53, r2
+L35: .string "y"
+.string "1c;9#bza0b0", "c"czb;;#0b;9"
+L37: .string ";9b1"
+L38: .string "a;:a"
+.string ""
+L40: mov L10, r2
+L41: .string "c.""
+L42: .string ""y9y.1zb", "aaa#y"
+L43: .string "bbz;1b"
+mov L57, r2
+.string "zyc9xyxxzb" "#"
+.data 1 , K , -5
+L47: .string "azcz", "yxzb9;;#;"
+.string "by9"b."
+L49: .data 1 , K , -5
+L50: mov L55, r2
+.entry L49
+L52: mov L60, r2
+L53: .data 1 , K , -5
+L54: .string "yb.9""
+.string "9."
+.string ":9"..xcy09ca"
+L57: .data 1 , K , -5
+.string "09y91"91a0"z"
+.string ";aa.z;"
+ hlt
@@ -0,0 +1,62 @@
+.define K = 3
+L0: .string "ax1"1"y:#" "1zbx.za0"
+L1: .data 1 , K , -5
+.string "c:y:zc1"
+.string "0a;axcxy9", "z:9"
+.string ""9c"x"
+L5: .string "";:b"
+.entry L36
+.string "b#", "c#xz001"
+.string ""b"
+.string "#c"
+L10: .string ""
+.string "by1"
+.string ":x.9y91"
+L13: .string "0c09;z9"
+L14: mov L6, r2
+L15: .string "", "9bazbcb"
+prn #K
+.string "91z.y#.10z:9"
+L18: .string "a:x:;;":1"
+L19: .string ".yb"
+.string """, "1cz;0#xzcb"
+.string "y1".#."9.0"
+L22: mov L38, r2
+.string "ax0;0"0"#:"
+mov L52, r2
+L25: .string "0#x:.y1"
+L26: .string "01:z" "11"1"
+L27: .string "#.0#c"
+.string ";", "a;z:"
+mov L18, r2
+L30: .data 1 , K , -5
+L31: .string ""
+mov L12, r2
+.string "";a0xz";x9#;" ""a:.;"
+.string "z;:c#c" ""zca.99#zb01"
+L35: .string ".1;1.1;"
+prn #K
+L37: .string "0xb0:ca"
+.string "0#z90a;ac"
+L39: .string "b:", "y""
+L40: .string "#x1cc" "1#zac"c;.0c9"
+.data 1 , K , -5
+.string "b0."
+L43: mov L54, r2
+.entry L58
+L45: .string "9ya" "0.xb9:#1b;"
+L46: .string "x" "9ab0#aa:"
+.string "azz:1#caxcy"
+.string ";9;;0""
+L49: .string ""
+.data 1 , K , -5
+.string "a"
+L52: mov L26, r2
+L53: .string "", "11zca0:11"
+mov L8, r2
+L55: .string "acyb9yc"
+L56: .string "#z#a;y:#9" "c.a:a;a:"
+L57: .string ""0c"az9:.b1"
+.entry L40
+L59: .string "1:"
+ hlt
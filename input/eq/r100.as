@@ -0,0 +1,62 @@
+.define K = 3
+L0: .string "c.0.z09#b9bb"
+.string "xzxy"#xccx"
+L2: .string "019"
+L3: mov L54, r2
+L4: .data 1 , K , -5
+L5: .string "";cxc"a:x1#:"
+.string "a;x.;#9.y.;z"
+.string "10#a""
+L8: .string """."
+L9: mov L31, r2
+L10: .string "", "ca#y."
+mov L56, r2
+L12: .string "x:#..;zz1"
+L13: .string "b.;xa0.b"
+mov L42, r2
+.data 1 , K , -5
+L16: .string ""
+.entry L12
+L18: .string "", "bbyb..0a90"
+L19: .string ";;""
+L20: .string "b;y0"y"
+L21: .string ""
+L22: .string "aa"9"
+.string "y::"
+L24: .string "zz:1a.#cb"
+L25: .data 1 , K , -5
+L26: prn #K
+.entry L47
+L28: .string "c00.1x"
+.string "yb:1:.c0"
+L30: .string "c"b;" ""
+.string "b"
+L32: .string "1b"
+.string ";"cc#9;c"
+.string "..b:"1", ":"
+mov L18, r2
+.string "xaax9"
+L37: .string ""
+L38: .string "a:"9;ya"
+.string "." ".x1.abxzz"
+L40: .string "1;xzbcz;#:;"
+L41: .string "z"
+L42: .string "1"
+L43: .string "c1.;":a"", "ab1a0"
+L44: .string "yyx"
+.string "yza.yx"
+.string "."
+.string "x#:9x"
+.string ""
+L49: .string "z" "y#;1;;."y9"
+.string "cz1#0;0x#1."
+L51: .string "a"
+prn #K
+.string "0.a;y"
+.data 1 , K , -5
+L55: .data 1 , K , -5
+.entry L23
+L57: .string "aayb9."
+L58: .data 1 , K , -5
+mov L59, r2
+ hlt
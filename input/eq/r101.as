@@ -0,0 +1,62 @@
+.define K = 3
+L0: .string "z1a:9x;x" ".#xz1by"
+.string "x1#zx"
+L2: .string "1yxb:""
+.string "0#0x"
+.string ""
+L5: .string "az.zay;"ca0c"
+L6: mov L46, r2
+prn #K
+L8: .string "y""c.9:"" "b"
+.string """b:.;#"
+.string "c#x.91cbcy"
+L11: .string "z1axy:"zbyc"
+L12: .string "zxby:caa:0";"
+.string "#y1" ";9zzacyz"
+.entry L3
+L15: mov L13, r2
+L16: .string "bza1""
+.data 1 , K , -5
+.string "xc199zy:"
+.string "1y#"
+.string "11:ay9.xa#1"
+.data 1 , K , -5
+.string "y#;c1.#":a"
+.entry L7
+.data 1 , K , -5
+L25: mov L46, r2
+L26: .string "byaxzx"
+.string "x:cc.;#:.x1" "9.#"
+L28: .string "9az9c;:1c" ""
+.string ";by0#c.ab" "abyyxc.""
+L30: .string "#.:z.axy0x1" "c;c111"
+.entry L48
+L32: .string "", "ya#0cy;""
+.data 1 , K , -5
+.string ";y"a1:y"
+L35: .data 1 , K , -5
+.entry L60
+L37: .string "a0c"
+L38: .string "c0.:#..1yz""
+L39: .data 1 , K , -5
+.string ":1yx0"9a"
+.string ".1y1:z;ycz1x"
+mov L24, r2
+.string "9"
+L44: .data 1 , K , -5
+L45: .string "b9#x"#".99#0"
+mov L3, r2
+.string "a"
+L48: prn #K
+.string ";;:x9;.."
+L50: .string "b;c11yc"
+L51: .string "acz#b;yc:aaz"
+.string "c."0x:"xzc"
+L53: .string "0zx;yyy90#c" ".a"
+.string ""cyx11;xcbb0" ""0#ayc;c9;.0"
+L55: mov L5, r2
+L56: .data 1 , K , -5
+.entry L52
+L58: .string ""
+L59: .string "":"".91.cx#z", "1#::xy1"
+ hlt
@@ -0,0 +1,62 @@
+.define K = 3
+.string "9."
+L1: .string ";;a.99"
+.string "#01x9cb#a.c" "9"x.99c"
+L3: .string "x"
+L4: prn #K
+L5: .string "0"0c#czxb"
+L6: .data 1 , K , -5
+L7: .string "#y"z:.1:91" ":x0x.x;;"
+L8: .data 1 , K , -5
+L9: .string "b1"cyb", "0.y0:cxz"
+L10: .data 1 , K , -5
+L11: .string "9xabx0y"
+L12: .string "yzy.10"
+.string ":xa1x##"#1;"
+L14: .data 1 , K , -5
+L15: .string ".0:"#:1cayy0"
+.data 1 , K , -5
+.string ":", """
+L18: .data 1 , K , -5
+.string "x:cc1.;01.b"
+L20: .string "1:x#c.ay;y9c"
+.string "b"
+mov L1, r2
+L23: .string ";c1yyb.#."
+.string "..bb#"::xc#b"
+.entry L40
+.entry L21
+L27: mov L16, r2
+L28: .string ":x0ba.:", "9..b;a#"
+L29: .string "ab"y9.a", "".0a1x1"
+.string "xyzc#y.".:", ""b:"
+L31: .data 1 , K , -5
+.string "y.9x" ""
+L33: .string ""y".ax"1;" ";x;;.c.01"9"
+L34: .string "9b9x" "#"
+L35: .data 1 , K , -5
+L36: mov L30, r2
+.string ""
+L38: mov L20, r2
+.entry L40
+.data 1 , K , -5
+L41: .string "z9"c9a"
+.string "#a10z0a"a.1" "9zyy::bxy"
+L43: .string "b0::zc"
+.string "yz"
+L45: prn #K
+L46: prn #K
+.string "zcab.;"#"
+.string "a0.1"c9cb;9;", "#z1a";#"
+L49: prn #K
+.string ".x.", "zzb#9z1"
+.string "ba.z:;0yb;" ";cx#:z:."
+L52: .string "x:"
+L53: prn #K
+.string "y"";y".1x9."
+.string ""
+L56: .string ""#"ab;#x"
+.string "c1;;""cz#", "1;1#1#ba"y0b"
+.string "#0by1z."
+L59: .string ""0"
+ hlt
@@ -0,0 +1,62 @@
+.define K = 3
+L0: .string ".."x.b;.b:0", "":b1b"
+.string "" "."
+L2: .string "".;.:0" ";#";xbzx;x"
+L3: .data 1 , K , -5
+L4: .string "#9#"
+.string "a1"c" "yb1zb"":"
+L6: .string ";"
+L7: .string ""
+L8: .string "1y.bc1#az:y" "x;x;xx0c"
+L9: .data 1 , K , -5
+L10: .string "c:azy::""
+L11: .string "ccyz9""
+.data 1 , K , -5
+.data 1 , K , -5
+L14: .string ":.b"a;0:.c"
+prn #K
+L16: prn #K
+L17: .string "yy9a0#", "###0c"
+mov L43, r2
+.string ";ab1a"zcx;1." "y"
+L20: .data 1 , K , -5
+L21: .data 1 , K , -5
+L22: .data 1 , K , -5
+L23: .string "#a##9y.xy0#b"
+L24: mov L30, r2
+L25: .string ";91.;xzbzy"
+L26: .string "1", ".a:y1ac#c9#b"
+L27: .string "zxbbb:"
+mov L59, r2
+L29: .string "z.:yb"
+.entry L19
+.string ":.9z""
+L32: .string "c1#c0ay:"#." ":z0byzb.y."
+L33: .data 1 , K , -5
+L34: .string "xzyazybz"
+L35: prn #K
+L36: .data 1 , K , -5
+.string ".y;"
+.entry L37
+prn #K
+L40: .string "y0"
+L41: .string "#:.y;#y#..:c" ";b:"
+.string ";9zbxa." "9x0c."
+.string "1acxb..."0x"
+.string "z;1;c;"
+.string ":;;b10:zc:"
+L46: .string "..a"
+L47: .data 1 , K , -5
+.string ";ab#:;1ya99" ".0;0#.:ya"
+mov L9, r2
+L50: prn #K
+.string "9;cbx.0#"
+L52: .string ".a:y"zb"
+L53: prn #K
+L54: .string "##.0:".0ca;", ";za;.0.xza"
+.data 1 , K , -5
+.string ".b"
+.data 1 , K , -5
+.string "z"9;b0c:z":"
+L59: .string "c9ay;09""
+ hlt
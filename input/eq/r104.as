@@ -0,0 +1,62 @@
+.define K = 3
+.string "#x0za.c#"ac", "bb"
+.string ";y0"
+L2: .string "0a11", "c";a"
+.string "y9" "z"
+.string "a" "##91:cx"
+L5: .string ""
+L6: .string ";1b"
+L7: .string "xbb1;9.0:"9"
+L8: .string ""
+.data 1 , K , -5
+.entry L33
+.data 1 , K , -5
+.string "ax#1"
+L13: .string ";b""
+L14: .data 1 , K , -5
+L15: mov L4, r2
+L16: prn #K
+L17: .data 1 , K , -5
+L18: .string "xb"
+.entry L37
+L20: mov L12, r2
+L21: .data 1 , K , -5
+L22: mov L58, r2
+L23: .string "ab"y;b0"
+L24: .string ""
+L25: .string ";1yb9c9za#;c"
+L26: .string "ayz91a"
+L27: .string "y"
+L28: .string "1"
+L29: .string "z"
+.data 1 , K , -5
+.string "z110.9:"x;.x"
+L32: .string "c:0y;"
+L33: .string """b"
+L34: mov L9, r2
+.string "zcx..a"y:;1c"
+.string "a." "9;ac0b;9xb0z"
+.data 1 , K , -5
+L38: .string "b9:z"1y0:z1.", "#y;:;"#"
+.string ":#c0bz"y":9:"
+L40: .data 1 , K , -5
+L41: .string "y;b"
+mov L17, r2
+L43: .string "z"
+L44: .string "xzz;azzbxy##" "b1xb#099abyc"
+L45: .string ".bxx;"
+L46: .string ":9z.:x#;."
+L47: .string ";:"
+.entry L2
+.string "9#;c"
+L50: .string "a;0x.9cax"y" ".b"
+L51: prn #K
+L52: .string ".;0"b:."
+L53: .string "b:xby1."
+.string ";1y."
+L55: .string "c0zb0:"""
+.string "z;b;b"
+L57: .string "yz1yac#bca#z"
+L58: .string "0", "acxb."
+.data 1 , K , -5
+ hlt
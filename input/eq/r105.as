@@ -0,0 +1,62 @@
+.define K = 3
+.entry L50
+L1: .string "#;zyc"zc"
+.string "c"0;0"
+.string "x.c;y"9yaz"
+L4: .data 1 , K , -5
+prn #K
+.entry L52
+L7: mov L34, r2
+.entry L40
+.data 1 , K , -5
+L10: .string ""9.b;0zy.y;c" "1"#0"z";"
+L11: .string ""cz#.01#;" ":a"
+L12: .data 1 , K , -5
+L13: .string ":z0", "bb1#c0";zbx#"
+.entry L7
+.entry L33
+.string "y"b1"
+L17: .string "#a;c.c#", "a:.1"""z#x:"
+L18: .string ":0z:#"
+.string "yb#:"xa:a9bz"
+.string "":111:1c1aa:"
+L21: .string "c;"
+L22: mov L24, r2
+.entry L46
+L24: .string "#."19b#0a.;"
+.data 1 , K , -5
+.data 1 , K , -5
+.string "c.ab99;:b:a" "9yy91z"
+.string "9y.x0zyzazx" ";001"
+.string """ "by#"
+L30: .string "#y.0.z:", ";ab1a"
+L31: .string "1cyz0xb9ycyx", ";a#;c9a0b"
+.string "11ayc"
+.string ""
+L34: .string ":z9"
+L35: prn #K
+mov L10, r2
+L37: .string ";;.x""
+.string "z1:0;cc"
+L39: .string "b"
+.entry L24
+L41: .string "".;a:.cz9#xb"
+mov L43, r2
+L43: .string "b"
+.data 1 , K , -5
+.string "xb:c91:" "";0#9cc99:"
+prn #K
+L47: .string ""ax1"
+L48: .string "xz;", ":yab90:9."
+prn #K
+L50: .string ""b9zab0:"
+.entry L32
+.string "19#ccyx.;"
+mov L42, r2
+L54: .string "1.c.x", "0"c00yx#;xaz"
+L55: .string "9.#9;cxa0"" "zc"
+L56: .data 1 , K , -5
+L57: .string ".x9.#;c:"
+L58: mov L50, r2
+L59: .string "a0:xx##.1#" "0y;9"
+ hlt
@@ -0,0 +1,62 @@
+.define K = 3
+mov L1, r2
+L1: .string "a#y#bx#" "01.:y"
+L2: mov L30, r2
+L3: .data 1 , K , -5
+L4: .string "zz"""
+L5: .string "zb.c#.z1.9y"
+L6: .string "c1"
+L7: .string "xczyc;"""
+L8: .string "90x:0x:", "#:0":."
+.string "9b.b#9.." ".x9"ax"b"
+L10: .string "x#c:"
+.string ""ybz"1a099" "y"ay"
+L12: .string "a;"
+.string "9z."zb##a"y9" ""
+prn #K
+L15: .string "azzx#:1x;#z9"
+.entry L26
+L17: .string "yc910y":"
+.entry L49
+.data 1 , K , -5
+.string "9ayc"
+.string "1;xc1ba"
+L22: mov L34, r2
+L23: .string "b" "x#xbxa"
+.string "0aazy.1aa.b"", "y9z1c1"
+.data 1 , K , -5
+L26: .string "9:;"
+L27: .string "19"":"
+L28: .string "yy0;a"
+L29: .string ""
+.entry L39
+.string ".101:c1cc0"
+L32: .string "#91a""
+.entry L53
+L34: .string "0#"
+L35: .string "a":b9;;0z"
+.string "xx0a:1"c"
+.string "19#"yxa;"
+L38: .string ".;c"1z:bax" "zy"
+.string "#""
+L40: .string "9zxx.#;."
+L41: .string "y"y9c"
+L42: .string ":"#9b11#yax"
+.entry L4
+L44: .string "1;0#", ":.#:x:9"1.#z"
+L45: .string "#"
+L46: .string "09"
+.string ""
+L48: .string "1"
+prn #K
+mov L12, r2
+.string ""
+.data 1 , K , -5
+.string "y9z01"
+.data 1 , K , -5
+mov L50, r2
+L56: .string "9xb#a", "0cb"
+L57: mov L37, r2
+.string "b1ya0az", ""
+L59: .string "#ccc.ab1"
+ hlt
@@ -0,0 +1,62 @@
+.define K = 3
+L0: .string ":01#yc09#by"
+.string ""zxc"
+L2: .string "cxzbbcb1"
+L3: .string "00"""
+L4: .data 1 , K , -5
+L5: .string "a"0..ycxx;b;"
+L6: .string "":x:y#11##"
+.entry L0
+.string "a10".b:9z"
+L9: .string ".9;yy00:":z"
+.string "000", "1##0;:"0.by"
+L11: .string ""
+L12: .string "1b"
+.data 1 , K , -5
+.string "0yz" ""1"
+.string ""
+L16: .string "c:1.0.a#:c"
+L17: .string ":"yaa", "c""
+L18: .string "b:zc;."a9;"
+L19: .data 1 , K , -5
+L20: .string "xx"
+L21: .string ";baab;"
+.data 1 , K , -5
+.string ":by"
+L24: mov L48, r2
+.string "9cxx0c"
+L26: .string "yz"
+L27: .string "0bx011.09"
+mov L14, r2
+L29: .string ""
+L30: .string "" "b1z.;ax01yc"
+L31: .string "0#yb19"
+.string "x."
+L33: .data 1 , K , -5
+.entry L28
+L35: .data 1 , K , -5
+L36: .data 1 , K , -5
+L37: .string "ac"
+mov L26, r2
+L39: mov L46, r2
+L40: .string ";.1z"
+L41: .string "yyc1xz0cca"
+L42: mov L42, r2
+L43: .string "c"#;"", "b:"a"
+L44: prn #K
+.string ""zza;:y0;"
+L46: .string ";x"
+L47: mov L52, r2
+L48: .string "0zc0"
+mov L42, r2
+L50: .data 1 , K , -5
+L51: .string "x0y;09a.xyz#"
+L52: .string "yz".a;aacx#"
+.string "#119xa1.:1:;"
+L54: .string "9;a01" ""
+L55: .string "axx1;"
+L56: .string "9a1#";"cc119"
+L57: mov L1, r2
+.string "::.9b;b0"
+L59: .string ""
+ hlt
@@ -0,0 +1,62 @@
+.define K = 3
+.string "0.y0xbyxcx"
+L1: .string "9"
+L2: .string "x:.;:a"
+.string "" "z:xx9#1xab1"
+L4: mov L25, r2
+L5: .string "1.:az###cx;"
+L6: .string "#1"1xb9:c"
+L7: .string "czyab##:z", "a1.0z#y.91b"
+L8: .string "cc"
+.string "0x", "zby".0b1b9xc"
+L10: .string "#9"b"b"z#1" ":zb#;."
+.string "", "c:0;b91"
+.string ".x;b009"
+L13: .data 1 , K , -5
+L14: .string ""9" "bcb0.aa9c:0"
+L15: .string ""
+L16: mov L19, r2
+L17: .string "x1a;.#..y", "y#a"
+L18: prn #K
+.string ";0zy9a.#c;a"
+.string ""
+L21: .string "190czyz#"
+L22: .string "bz9", ";.#y"
+L23: prn #K
+.data 1 , K , -5
+.string ";za9x1"
+.string ":0.#b#1y"
+.string ".z;;1:b#.b"
+L28: .string ";a9" ""bz0xbc.#01"
+mov L17, r2
+L30: .string "y:y#y1cxaz." "1"xb"
+L31: .string "yy;"
+L32: .string "xc;#;0..09"
+L33: .string "by1;bzy9"
+L34: .string "1ca1z:##"
+.string ":"0xc#"
+L36: mov L18, r2
+L37: .string "9""
+.string "."
+L39: .string "y"0x#azya", "y1ya:"
+L40: .string "bz""z" "bx:#ybc"
+prn #K
+L42: mov L28, r2
+L43: .string "axzyxc"
+.string "z""x"
+.string ":.9.9"
+.data 1 , K , -5
+L47: .string "."bz0" "9.zxycc##y"
+L48: .string "01.:;"
+L49: .string "9xc;"ay01""
+L50: .string ".ax"b1:;"
+L51: mov L1, r2
+.string "cab#:0cz0xy"
+L53: .string "#a1"c:c:"":z", "z"
+L54: .string "#:ca"
+L55: .string "9y;zyb0z0"
+.string "#90;bzc:1" "z9c"
+L57: .data 1 , K , -5
+L58: .data 1 , K , -5
+.entry L24
+ hlt
@@ -0,0 +1,62 @@
+.define K = 3
+L0: .string "abx91y;9"
+L1: .string "":cy.9"
+L2: .string "#a.z;xc;.c"
+.entry L28
+L4: .string "a."
+L5: .string "b"y.x#1"
+.data 1 , K , -5
+L7: .data 1 , K , -5
+L8: .string "1a#a0b1y##"
+L9: prn #K
+L10: .string ""90y;x9"
+.data 1 , K , -5
+L12: .string "ay""
+.string "y;" "01"911x"b.y"
+mov L56, r2
+L15: .data 1 , K , -5
+L16: prn #K
+L17: .string "b"
+L18: .data 1 , K , -5
+.string "#""
+.string "1"
+.data 1 , K , -5
+.entry L16
+L23: .string ":ac"0"
+.data 1 , K , -5
+.string "yxy"
+.string ""
+L27: mov L48, r2
+.string "#"ac;z:x"0", "c"
+.string ":;;.", ";99c;bz"1"
+L30: mov L32, r2
+L31: .data 1 , K , -5
+.data 1 , K , -5
+L33: mov L52, r2
+L34: .string "" ""
+.string "z";"
+L36: mov L36, r2
+L37: .string ".1.#.aa0a"x" "y"".yaz""
+.string "", ".y0cbc"
+.string "0a99::.#"" ";z#;0:z09"
+.string ".9.a;x.z.b"
+L41: prn #K
+L42: prn #K
+.entry L43
+.string ";01."#:#"
+L45: .string "." "cy.z#"
+L46: .string "by:9:yx";"
+.string "1a:##"
+L48: .string "xz:b0x:0"
+.string "bb01x.":" ";"ca#x#:9b;c"
+L50: .string "c:#0"
+L51: .string ":a0c0"
+.string "y#cc;0"", "ycx"
+L53: .string ""
+.string "0xba"
+.string ":xc"
+L56: .string ""cx00" "zcby:c"
+L57: .string "z9x"1ya"
+.data 1 , K , -5
+.string "a90y;#"
+ hlt
@@ -0,0 +1,62 @@
+.define K = 3
+L0: .string "119";xc#91:;"
+L1: .string "9"
+L2: .data 1 , K , -5
+.string ".;:c;a"9ba", ";a#"
+.string "x:y1a:b1"
+L5: .string "."
+L6: mov L1, r2
+.string "b"y0ba"
+L8: .string ""
+L9: .string ";", ":yzbyza0#bcx"
+L10: .string "c:9x19x"
+L11: mov L24, r2
+L12: .string "ay""
+L13: prn #K
+.entry L25
+.string "bacx1ya#;", "0bbb"
+L16: .data 1 , K , -5
+.string ";1"
+L18: .string "cyx";x.xc."
+.string "1;b0ab" "yx..0y0""
+L20: .string "bcx19:";;by"
+.string "y", "aac"
+.string "z" "z:..9;c"
+L23: .string ".yaa;", "b.yzcbb"
+L24: .string "..c#zzb:1b""
+L25: .string ";a;:00;", "b"
+L26: .string ".z0..;"
+L27: .string "#9ay;b1a"
+L28: .data 1 , K , -5
+.data 1 , K , -5
+L30: .string "c:;x"
+L31: mov L59, r2
+.string "0:yx:"
+prn #K
+.entry L37
+L35: .string "1z", ""
+L36: .string "b1", ""00"
+L37: .string "1zb"ay";a"
+L38: .string "#;a:c01xa#"
+L39: .string ""
+L40: .string "::#zb:xx"
+.string "19.acxy#z9.9"
+L42: .string ".xb0.0c11x:a", ":9#"z1z:x"
+.entry L59
+L44: mov L57, r2
+L45: .string "9#zy"
+.entry L5
+L47: .string "#y1ax#"
+L48: .string "z:#c1c9."
+L49: .data 1 , K , -5
+.entry L44
+L51: .string "9y".9:c9"
+L52: .string "0"";xy"c99", "x09b9a;"
+L53: .string "9#;b1b" "9"
+.string "yx11cz", "9zbx0;a"
+.string ""
+L56: .string "z.zx"
+.string """
+L58: .string "0a0:0"9;"
+.string "x9x"9;;"cx"
+ hlt
@@ -0,0 +1,62 @@
+.define K = 3
+L0: prn #K
+L1: .string "0;#c:x", "xc:10"0."
+.string "z1#az:#:x;10"
+L3: .string "bz1x"
+.entry L51
+L5: .string "9:.y.11"1""
+mov L39, r2
+.string "1:"
+L8: .string ""
+.string ";#"
+L10: .string "" ";.xc###"c"
+L11: .data 1 , K , -5
+.string "":b";b"0zx.x"
+L13: mov L33, r2
+L14: .string "y"
+.string "x""
+L16: .string ""
+L17: .string ";baa9zyzx:";", "zc0z"
+L18: .string ";:z";0b0"." "9yb:#a.x9"
+.string "zy9;;x"b#", """
+.string "9.b;;1a1z"
+L21: .string "ay9:ax:19y"
+L22: .data 1 , K , -5
+L23: .string ";a01xx.y"
+L24: prn #K
+mov L55, r2
+L26: .data 1 , K , -5
+L27: .string "#01c"9#0111"
+L28: .data 1 , K , -5
+L29: mov L28, r2
+.string "xy"yy;y#:0:"
+.string ":cy"
+L32: .string ":;y9."
+L33: .string "xa#a", ":"
+L34: mov L52, r2
+L35: .string ":c119";110"
+.entry L50
+L37: mov L39, r2
+L38: .string "b.0"
+L39: mov L54, r2
+L40: .string ":ba"
+L41: .string "a"1"c;09010"
+L42: .string ";;y":;9yc"
+L43: .string "yax" "b0x.y.:#y0"
+L44: .data 1 , K , -5
+L45: .string "#""1#9bc#" "bb9"
+L46: .string "bx;"zx"z1"
+.string ";ccbb#by."
+L48: prn #K
+L49: .string "y9y1b;;..y"
+.string "azy0;y##:a.y"
+L51: mov L37, r2
+L52: prn #K
+L53: .string "."
+L54: .data 1 , K , -5
+mov L4, r2
+L56: .string "9xy" "c"
+.entry L26
+L58: .string ";10z9;"
+L59: .string ":zc.:x#x"
+ hlt
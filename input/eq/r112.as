@@ -0,0 +1,62 @@
+.define K = 3
+.string "y.10#:czx"
+L1: .string ".11"
+.string ".c.19z0;0y"
+L3: .string ":#b;"#"
+L4: .string "1a"y:#0"", "y9"
+.string "x" ";.;"
+.string ".b"
+L7: .data 1 , K , -5
+L8: .string "1b199cyba9.."
+.string "01z""
+.data 1 , K , -5
+L11: .string ".00#bcz0;9#""
+L12: .string ""
+.string "" "#yy""a;"11"y"
+.string "yc"#.y11;0"
+L15: .string "9;1"
+.string ".xx:"
+L17: .string "1x0y9a:.y"
+.string "".z"
+L19: .string ".0;0:"0b"1x"
+L20: .string ".byax0:b"
+L21: .string "a0c:9"
+L22: .string "#zb"
+L23: prn #K
+L24: .string "ab." "0cc"
+.string ""ca9";;", "x09bb#"
+.string "#:z0a9bzb:a"
+.string "#xx#c:zzz1", "..a0x;b;:;1;"
+.entry L60
+L29: .string "x1:y91"yz"
+.string "ca1"9".9b1"
+L31: .data 1 , K , -5
+L32: .string "aa0a#b;zzz0", "9#;1"zc"
+mov L55, r2
+L34: .string ""
+.string "..;:9"
+.string "bb9#"
+.data 1 , K , -5
+L38: .string "1b.:#10:0b:"
+.data 1 , K , -5
+.string ""
+.string "c#z"
+.string "z.z1;cc0"
+.string ""9ya0cc"c:" ".z"a1"""
+L44: .data 1 , K , -5
+L45: .string "a1z"a0b#"
+.string ""
+L47: .string ";#xy0."
+.string "", "cy0;c1"90.:c"
+.string "z11bzya.yx" "9bcz0:"b1."
+.data 1 , K , -5
+L51: prn #K
+L52: .string "9.;.:#ax"
+.string "100y91x"ybx"
+L54: .string ".b;y.a90x":"
+.string ""91"
+L56: .string "x9c;c.a"a99a"
+L57: .data 1 , K , -5
+L58: .string "xa";b0c90#"" "xb#"
+.string "#"
+ hlt
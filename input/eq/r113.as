@@ -0,0 +1,62 @@
+.define K = 3
+.string "ya19zx0a"by"
+.string "0z0x"
+.string "", ";#"
+L3: .string "cy0:y:x"
+L4: .string ""
+.entry L54
+L6: .data 1 , K , -5
+.string "1#b9b9:;"#bx"
+L8: .data 1 , K , -5
+.string "."
+.data 1 , K , -5
+L11: .string "b:#", "#y"
+.string "cc#x1c:;xy"
+mov L1, r2
+L14: .string ";czxza"
+L15: .string ";91cy"
+L16: prn #K
+L17: .data 1 , K , -5
+L18: prn #K
+.string "9;:yy10"
+.string "#;;"1.xz1"
+.string "y"
+L22: .string "a9y", "19y.;"az9""
+L23: .string "y;:zyx#a;b"
+L24: .string ".9zb"
+L25: .string "01yzyac"
+.string "z"
+L27: .data 1 , K , -5
+.entry L38
+.entry L11
+L30: .string "y9;x019"
+.string "a;1bcyca"
+mov L59, r2
+L33: .data 1 , K , -5
+.string "#" "0x9cy;"
+L35: .data 1 , K , -5
+L36: .string "0"
+L37: .string "yy#;#z#zz;a:"
+.string ";;z#;bb"
+.string "1"
+L40: .string ""
+L41: .string ""
+.string "b#9."
+.string "z"b;xy."xcb"
+L44: .string "99baca"
+.string ";bb"".""
+L46: .data 1 , K , -5
+.string "az.zbabb#10"
+L48: .string "a"."
+L49: .string "0;"bbx:yy##"
+L50: .string "0#:c", "z9":#..:by"
+L51: .string "":9x1z:y##" "9bb#1.10a;9:"
+L52: .string "abcy""
+.data 1 , K , -5
+L54: .string "acxcab.x"zz"
+.string "y:""x"01aab"
+L56: mov L54, r2
+L57: .string ";x"
+.string "11"ccyc:"
+L59: .string "#zay.;x"
+ hlt
@@ -0,0 +1,62 @@
+.define K = 3
+L0: .string "x:;ac99:9y"
+.string "z.b"b" "0b;#9yz"
+.string ";1x1:#", ";y:bb"
+.string "c#9#x" "9"
+L4: .string "0by"
+L5: .string "c"
+L6: mov L6, r2
+L7: .string "cay99a;1aazz"
+L8: mov L8, r2
+L9: .string "11yzab##"
+L10: .string "b":19b", ":#.090x"
+.data 1 , K , -5
+mov L11, r2
+L13: .string ".", ""
+.string "1.0:bzzzz"
+L15: .string "9zx"ca"
+.string ""1:z1zybc:#x", ".;0c11;b"
+.string "y#0:;az"
+.string ";xa.bb#czx"
+L19: .data 1 , K , -5
+.entry L16
+L21: .data 1 , K , -5
+L22: .string "#11:0a#", "za0".yb9"a01"
+.string "9::a"byx9;"
+L24: .string ""
+.string "#cz:yc"
+.string "c."zzb"
+.string "x" "b:bby";"
+L28: .string "#91"#9zz#."
+L29: .data 1 , K , -5
+L30: .string "1ay"x:"
+.entry L28
+L32: .string "91:1a0ac."
+.string "zb"
+.string ".y09"
+.entry L29
+L36: mov L48, r2
+L37: prn #K
+L38: .string "z"
+.string ":.:z;a.9:a"
+.string "0;a;9"#c.z" "1"c.00"
+L41: mov L24, r2
+prn #K
+L43: .string "#:c;y#"b9", "01z0x"
+.string "0z:9;z"
+L45: .string ""1"1" "9"
+.entry L15
+mov L57, r2
+L48: .string "c"
+L49: .string "ax"
+.entry L46
+L51: .string "x1xy0"
+.string "ya;0ay##y#y:"
+.string ""
+L54: .string "9aa"xb#"0b"
+L55: mov L7, r2
+.string "aa:1"
+.data 1 , K , -5
+L58: .string "0a"
+L59: .string ".;9yya"
+ hlt
@@ -0,0 +1,62 @@
+.define K = 3
+L0: prn #K
+L1: mov L41, r2
+L2: .string "xy0;0";"
+.string "z1a9#9b""
+L4: .string "19"
+L5: .string "9y."z""
+.string ":#:.xz"
+L7: .string "0zyxz10c#."", ""
+L8: .string "acz""
+L9: .string "91a;"
+.entry L35
+.entry L46
+.string "09yz0;a#.b" "z9zb"
+.string "y#xc"1zyb"
+L14: .string "", ""
+.entry L36
+L16: prn #K
+L17: .string "99a9"c"
+L18: mov L60, r2
+L19: .string "b"b.1";bb""z"
+L20: .data 1 , K , -5
+L21: .string "x0c:b."
+L22: .string "9axxz9#y", ";"
+L23: .string ":#9yxab#1#0a"
+L24: .data 1 , K , -5
+.data 1 , K , -5
+L26: .string "z.;za11ccx"y"
+L27: .string "#.9".#.11"
+L28: .data 1 , K , -5
+L29: mov L48, r2
+.string "xb99"
+.string "#1b"
+L32: .string ""
+L33: .string ";y0:9::;:" "9:":#.c1#b"
+mov L3, r2
+L35: .string "#:y:xczz1baa"
+L36: .string "y""
+L37: .string "1#:y"
+L38: .string "a"
+L39: .string ":zby9x;c"
+L40: .string "y", "cyx"0:;:a:bz"
+mov L23, r2
+.string "." "azc."
+L43: .string "yb:c9yc.::#", ":0ba#9a"
+.string "c"
+.string "#0yza"
+.data 1 , K , -5
+L47: .string "9b;c:x"
+L48: .string "zyz:xy:"
+.data 1 , K , -5
+.string "y1"0119bb"
+.string "xc1"b.z#", "az0"
+L52: .string "1x#9#:"
+L53: .string ""
+L54: .string "::x11bc" ";cab"
+L55: prn #K
+L56: .string "09#x.9a;"
+.string ":"c"
+L58: .string "9c1:;";", "ayxy.x.:19y"
+.string "x19#y0"
+ hlt
@@ -0,0 +1,62 @@
+.define K = 3
+L0: mov L6, r2
+L1: mov L1, r2
+.string "19;z;#9c""
+mov L58, r2
+L4: .string "y##b;""
+.string "z#;10" "y"""
+.string "1"
+.string "0#"xc", "yycb"y9c#"x:"
+L8: .string "x:#9"ycc", "c##0#.""
+L9: .string "c" ""
+mov L2, r2
+L11: .string "1:xy.zzz#c", ".;"
+L12: .string "ac1aya#"
+L13: .string "c.."0zbz1"
+L14: mov L47, r2
+.string "0;b"9zzbz"
+L16: .string "" ".#0;:"::"
+L17: prn #K
+.entry L32
+L19: mov L29, r2
+L20: .string "b.1c:ac"#;"
+L21: .string "#1b1#zy"a"", ".:.:y0c9.#9c"
+L22: .data 1 , K , -5
+L23: .data 1 , K , -5
+.string "9b"aa:;b"
+L25: mov L25, r2
+.string "yy" "c09..a0"
+L27: .string "zc1z1."zbby#", "99zb"
+L28: prn #K
+.string ";yz:9"
+mov L18, r2
+.string "a:#", "b00az#y0z1c1"
+L32: .string "ybcb:01"
+L33: .string "c;b."
+.data 1 , K , -5
+L35: .string ""1z0"1c0:b"
+L36: .data 1 , K , -5
+L37: mov L49, r2
+mov L23, r2
+L39: prn #K
+L40: .string ""zx91:y"" "9#z;z9""
+mov L17, r2
+.string "c1b90"
+L43: .string ""#0##"
+L44: .string "a9c:.c9b#0", ""
+.string "ac"
+.string "9z:0:x"
+L47: .string "bbzy"
+.string ";0ay"
+L49: prn #K
+L50: .data 1 , K , -5
+.string ""cb9;y#b" "0#y1:"
+L52: .string "yyz."
+.string """x.#z"#"a"" "#1.xx""
+.string "y""x"0:1.;#"
+mov L5, r2
+.string "9ya;#:bxxx0z"
+L57: .string "xyby;a":119;"
+.string ";:z#a0c.z#xy" "9"
+L59: .string "#";c"
+ hlt
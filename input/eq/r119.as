@@ -0,0 +1,62 @@
+.define K = 3
+L0: .string "9:#9#0bb0:xc", "yx1;a0.y0..a"
+L1: .string ""
+.string "baxx10" ";9c#bac.b"
+.data 1 , K , -5
+L4: mov L38, r2
+L5: .string ".x0"
+L6: .string ""
+L7: .string ""
+.string ""#by.9czy", "z""
+L9: .data 1 , K , -5
+prn #K
+L11: .string "yca"9x;b"::" "c"cx";9xbcc"
+.string "a1.z.;;"
+L13: mov L14, r2
+L14: mov L6, r2
+.string ""
+L16: .data 1 , K , -5
+.string "ycybza9yyc"
+L18: .data 1 , K , -5
+.string ""
+L20: .string ".b9aab.#0"
+.string "9yza1:"
+L22: .data 1 , K , -5
+L23: .string "90ca"
+L24: .string "9"
+.string """:#z", ""0c.;bc"
+L26: .string "b1".y"" "0#"
+mov L32, r2
+L28: mov L13, r2
+.string ":.bx0zx", ";a:999#;#y:0"
+L30: .string "", "##x;a"
+.string "9"
+L32: .string "#b90"
+.string "yz"
+L34: .data 1 , K , -5
+L35: .string "01"
+L36: .string """ "x"a"
+.string ".1#9yza9" ""yb:0"za;1#1"
+L38: .string ":;az:", ""
+L39: .data 1 , K , -5
+L40: .string "y9:0"
+L41: prn #K
+.string "" "11y9zxz"
+.string "00:"a0"bzy90" "0x;"
+L44: .string "xcb.9#:" "00bax.yb"
+L45: .string "za:b:a" ""b#9"
+L46: .string "a:#y##1"", "bc1:1."a#"
+.string "b10##x1#";c:" ""b:x"
+.string "1"
+prn #K
+.string "9"
+L51: .string ""
+.data 1 , K , -5
+L53: .string ":9;zy"
+.string "#bby"abcyz:"
+.string ""
+.string "c91cxyx""
+mov L1, r2
+L58: .data 1 , K , -5
+.string "ac"
+ hlt
@@ -0,0 +1,62 @@
+.define K = 3
+.string "zc0az1y:#1"
+L1: .data 1 , K , -5
+L2: .data 1 , K , -5
+L3: .string "a;""
+.string "0#"baa":9x" "1b:0c9"
+L5: .data 1 , K , -5
+L6: .data 1 , K , -5
+.string ";0:;11"
+.string "x" "yzz".0:yby"
+L9: .string "#9ca0""0a9ax"
+L10: .string "b#9xcb.ya"
+.string "a91zxzy11.""
+L12: .string "zcx#.x;a", "#zcx#a9ax;bz"
+L13: .string "#:"y:" "9911:zy:1.c1"
+.entry L60
+.entry L28
+L16: mov L18, r2
+L17: .string "" "9y"
+L18: .string ""
+.data 1 , K , -5
+.string "0;b0#x", "z:.0;"
+L21: .data 1 , K , -5
+L22: .string "0"
+L23: mov L6, r2
+L24: mov L17, r2
+.string "1;;bx9;.", "xb0zzb:zc"
+L26: mov L11, r2
+mov L59, r2
+L28: .string "1;1"
+L29: .string "xzbxazz"
+L30: .string "9c9"
+L31: .string ";9".x1"
+.entry L14
+.string "09:1:ab9;:yz"
+.string ":ycc1"
+L35: .string "" "y0:;y"
+.entry L20
+L37: .string ""
+.data 1 , K , -5
+.string "z0#0"
+.string "c#", "by9a"
+.data 1 , K , -5
+mov L58, r2
+L43: .string """x."
+L44: .string ""
+L45: .string "yxc#y9"a;bz:"
+L46: .string ""
+L47: prn #K
+L48: .data 1 , K , -5
+L49: .data 1 , K , -5
+L50: .string ""yac1#"z.b""
+L51: .string "z#b"czaxb"
+prn #K
+L53: .string ":;;.:."a;x", "1:x1#z0:9"z#"
+.string ""
+mov L23, r2
+L56: .string ";c:yaxx"
+L57: .string "#zz;0#"
+L58: .string ";:9", "x"
+L59: .string ":1.yyz0b"
+ hlt
@@ -0,0 +1,62 @@
+.define K = 3
+L0: .string ":c;#9c"
+.string "a:."#""
+L2: prn #K
+.string "z1;xczc0#bzx"
+L4: .string "b0acz" ".;;a9"
+.entry L16
+L6: .string "x#"
+L7: .string "x1;;:b"
+L8: .string ":ca"
+.entry L43
+L10: .string "#.;1#"
+.string "0001#az0.1"
+L12: .string "00#bb:"ab:"
+L13: prn #K
+.string "yczx;:yxc""
+.string "#..0z#"
+.string "#x9yaaax.zc:"
+L17: mov L46, r2
+.string "a"
+L19: .string "ybcxa.1" "#1;"
+L20: .string "cy"c1"
+.string ";0" "bzz9xz"0y9y"
+.entry L25
+.string "c.ay" "b.z#9x"0:"
+L24: .string "y;10;0c:#", "a;.:zy0"
+L25: .string "b0b;a0..":y"
+L26: .string "#c91;ax"
+L27: .string "z""
+.string ":b"bzx""b0" ":a"
+L29: .string "y90cx9zy"a."
+L30: mov L10, r2
+L31: .string ":910y09"
+.entry L27
+L33: .string "a", ""
+L34: .string ":x:xbab.cab", "9"b19"c1;z"
+.entry L40
+.string "bx0" ";0b:""
+L37: mov L33, r2
+.string ".cbc." "x"
+.string "910z"
+.string "."09#""
+L41: mov L8, r2
+.string ""
+L43: .string "ayz"zx" "xz"0#."
+mov L13, r2
+L45: .string "" ":1."
+.string "x###;.zyxx#"
+.entry L7
+.string ";9"
+L49: .string ":0b9cc"
+L50: .string """a".;b1z0;", "ay.xb"#9"
+.entry L2
+L52: .string "9b0.b"
+L53: .string "axyaa0"
+L54: .string "1bxcc", ";"
+L55: .string "yxx.:"
+L56: .string "c."z;9"
+.string "c"
+.entry L46
+L59: mov L42, r2
+ hlt
@@ -0,0 +1,62 @@
+.define K = 3
+L0: .string "b.z#" ".;cby1.x90"
+L1: .data 1 , K , -5
+.string "b0#b9:1"
+.string "z;a9" "00c:z"
+.string "aax"10#yz"
+.string "z1b1z;.b""
+.string "b#z#:"b.yy#."
+.entry L54
+.string ";xxc.c.0zz1.", "za0b9;:#"0:."
+.string "c9cb;9"
+L10: .string ":#;0"#z"
+L11: .string ":9b1yxx;"a"
+L12: .string "" "."z""
+.string "119#.:yazc.#"
+L14: .string "a1bbaz"#xz"
+L15: .string ":"
+.data 1 , K , -5
+.data 1 , K , -5
+.string "xzzc1yxyza;" "b#yx#"
+L19: .string "cy1:z1xb#bx"
+mov L41, r2
+.string "0.c.:#"
+L22: .string "xy"::y#b9"
+L23: .data 1 , K , -5
+mov L35, r2
+L25: .string "b9"
+L26: .data 1 , K , -5
+.string "b#"
+L28: .string "cay"b.1x:z"
+.string ""19:ab1bc#"
+.string ":;";cz"
+L31: .string "0:y:0"
+L32: .string "yyy1"
+prn #K
+.data 1 , K , -5
+mov L39, r2
+L36: .string "..x.z0yy"c"
+.string "bz"
+L38: .string "".yb.b;:9"
+L39: prn #K
+.data 1 , K , -5
+L41: mov L14, r2
+.string ""
+.data 1 , K , -5
+L44: mov L3, r2
+L45: .data 1 , K , -5
+L46: .string "z1"#b:"
+.string "#x1x0#ac;##"
+L48: .string ":#b"
+L49: mov L41, r2
+.entry L35
+L51: .string "a"azzzb1b", ";"
+L52: .string ";;1xy10"
+.string "xca919xyb"
+L54: mov L33, r2
+L55: .data 1 , K , -5
+.string ""
+L57: .string "#9aa9#a9"
+L58: .string "c""y0a"
+L59: prn #K
+ hlt
@@ -0,0 +1,62 @@
+.define K = 3
+L0: .string "yb""a0"
+.string "cz"
+L2: mov L57, r2
+L3: .string "0baz.1bab"
+.string "0;1y"
+L5: .string "#1x";:9;"
+L6: .string ":90:9:#:;"19"
+L7: .string ":c."b1:yczz9"
+L8: .string "#zax;b":z"
+L9: .string "9."a:y1#"
+L10: .string "c9"
+L11: mov L8, r2
+L12: .string "z:y0:0ab;b9z"
+.string "90b9.:0azy1a"
+L14: .string ":c0b.":cz:"
+.string ""
+L16: .string "#y#"0zc9z9"
+L17: .string "a.c1:a"
+.entry L45
+L19: .data 1 , K , -5
+L20: mov L33, r2
+L21: .string "cz9b9.zx"
+L22: .string "xxzy0a9b"
+.string "" "xb;zbz99c"
+L24: prn #K
+L25: mov L46, r2
+L26: .string """;"1z0x"9c"
+.string ";1z.;b.az"
+.string "zzx#1z"
+.string "#a"009"
+.string "zbyby9", "a0a;0"
+.string "zx:1y"1;;zx"
+L32: .string "zacb"
+.data 1 , K , -5
+L34: .string "cz"zx;"a"
+.entry L49
+.string "", "x.b"yy"
+L37: .string "a1:cxay9c"
+.string "1"1x", "b"
+L39: .string "9b:" "##1ba;"
+L40: .data 1 , K , -5
+L41: .string "xax"
+.string ""
+L43: .string "."0"
+L44: .string "::"z", ""
+L45: mov L26, r2
+.string "09x0b1"
+L47: .string "bcb1"z9;a19"
+L48: .string ""
+prn #K
+L50: .string "#" "c0c1c""
+.string "abcx1"
+L52: .string ""
+L53: .string "az1#"x"xx#"
+L54: .data 1 , K , -5
+L55: .string "z#x"aa"
+L56: .string "c9#"
+.entry L41
+.entry L16
+.string "zz:c"0a;", "."a#z"
+ hlt
@@ -0,0 +1,62 @@
+.define K = 3
+L0: .string "a0", "azc0y"
+L1: .string "axxb0z"
+.string "z9y#0cb1.9"
+.string ";91#b;", "c"
+L4: .string "1."
+L5: prn #K
+.string "#1bcb9a#a"
+.string "#1;1b;1" "a1x0:cxa#z9"
+L8: .string "#.9"zzb"
+.string "bb0x9""
+L10: .string "x#bbaac..b", "x"
+L11: .string "1#.a:a"b1z#b"
+L12: .string "y90"
+L13: .string "a0:9.:99zxz1"
+.entry L40
+L15: .string "b"
+.string "zzy1cb9#a" "z;cbzb."
+.string "9""yy.:1cb", "b"#x0.0"
+.data 1 , K , -5
+L19: .string "#91#..;:x"
+L20: .data 1 , K , -5
+L21: .string ":xzb1c#;"
+L22: mov L38, r2
+L23: .string "#c0"0x"
+.string "c9zby"
+L25: .string "9a"
+L26: .string "0"z10;"
+.entry L54
+prn #K
+.data 1 , K , -5
+L30: .string "1x.cabx.0", "0:b:#"
+.data 1 , K , -5
+L32: .string "y;;a;#"
+.data 1 , K , -5
+L34: .data 1 , K , -5
+L35: .string "bya;1c1:"99"
+L36: .data 1 , K , -5
+L37: .string "c:c"x;a.c"
+.entry L8
+L39: mov L24, r2
+L40: .string "zayx.1."
+L41: .string "#0b#.1", ""x;y91ab:"
+.data 1 , K , -5
+L43: prn #K
+.data 1 , K , -5
+L45: .string "aa";#11yby" "10zc#0c0z"
+L46: .string "99abx1:z1":"
+.entry L14
+L48: .string "xc"
+L49: .string "yxb9y9", "0"
+.data 1 , K , -5
+L51: .string "z"
+mov L46, r2
+mov L23, r2
+.string ""
+.string "abcaz"
+L56: .string "xz;:1""
+L57: .string "9zy;.9zb" "z"
+L58: mov L20, r2
+L59: .string "z#99cz;bb:xy"
+ hlt
@@ -0,0 +1,62 @@
+.define K = 3
+L0: .string "x:c11xc" "1b.:y9czx#"
+L1: .string "119a"
+.string ":x0"
+L3: .string "0x.a9.:c:xc0", ""
+mov L48, r2
+L5: .string ""z100.9y#"
+.string ""
+L7: mov L10, r2
+prn #K
+L9: .string "#", "#b9b"
+.entry L46
+L11: mov L58, r2
+prn #K
+L13: prn #K
+.string "#;;"xz.1a#z"
+.data 1 , K , -5
+.string "";b";"" "90;z.:z9;"
+.string "a;c9"
+.string "y1"
+.string ""zyza#."a", "9x""
+L20: prn #K
+.data 1 , K , -5
+.string "a"
+.string "xz;;b"xc;0a"
+L24: .string ""#cc"0x:;x:b"
+L25: .string "yc;"
+L26: mov L1, r2
+.string "c:0..c", "9b1.c"
+.string "zb" "9;z1""1c901a"
+.string "0xbzb.c9zx0"
+prn #K
+mov L1, r2
+L32: .data 1 , K , -5
+L33: .string "a;axz;c" ":c.#"
+L34: mov L59, r2
+.string "axax.z."y.y9"
+L36: .string ".#9"
+.string "yx.b.:1yaac"
+L38: .string ":1"1ca";99.1" "x#z.c;ac9"
+L39: mov L10, r2
+L40: .string ";;"1c"
+L41: .data 1 , K , -5
+L42: .string "x9;"
+L43: .string "y00:"
+L44: mov L42, r2
+.string "b" "y9.1y"
+.string "xy;0."
+L47: .string "#"b9"0z::yc"
+L48: .string ":";y::xabb9z"
+L49: .string "09x;x.ba" "c:x:ya.y"
+L50: .string ".:.b:c"
+L51: .string ":;yx"
+.string ".0".zay9"
+.string ":#" "1.axc"
+L54: .string ""z9#z1"
+L55: .string "b"c"bx1x0cba" "0;1;9#cb;a"
+L56: .string ";#"y"c9."
+.string "b1""
+.string "zcz"
+L59: .string "###a.1" "ay#b0cczb#:b"
+ hlt
@@ -0,0 +1,62 @@
+.define K = 3
+.string ""baayx0xy"
+.entry L24
+L2: .string "."b0b#b.", "a1c.;"
+L3: .string "b9by"
+L4: .string "..x0"
+.string ""
+.string ";".:;xx#1x0""
+L7: mov L5, r2
+L8: .string "y"
+L9: prn #K
+L10: .string "9;.0a1b:xb90" "b"0"
+.entry L38
+.string "##y0;yyyz09", ""
+L13: .string "xaa"
+L14: .string ""
+.string "yaa9"xab";0"
+.string "1xyy19"
+.string "ca#""
+.string "z9xy.0yxzx0"
+.string ".:"
+.data 1 , K , -5
+mov L34, r2
+L22: .string ""byxx::zz"
+L23: .data 1 , K , -5
+.entry L33
+L25: mov L59, r2
+L26: .string "by1."
+.data 1 , K , -5
+L28: .string "ac1x9", "11.zcca"
+.string "09#x.c99"
+L30: .string ""1.ab9:.a0"
+.data 1 , K , -5
+.string "0yz:;#"y"
+.string ""
+.string "z"
+L35: .string "a"zyccyz."
+.entry L32
+L37: .string "1";.xx", ":x#0."
+L38: .string "z;""
+.data 1 , K , -5
+L40: .string "1::;#"xb:" "c"cy0"#:0b"
+L41: prn #K
+.string "c." ".b0yxxy1;""
+L43: .string ""
+L44: .string ""#c19"x"a"
+L45: mov L45, r2
+.string "xy"
+L47: .string "1"z09bb::a0a"
+.string "b1x#"
+.string ""
+L50: .string "y"
+mov L25, r2
+.string "9z"
+.entry L48
+L54: .string ";z#c", "0y"x9;x9#.y9"
+L55: .string ""axby"
+mov L6, r2
+.string "bbc9y9a9#1"
+.data 1 , K , -5
+L59: .string "b1"0;xz""
+ hlt
@@ -0,0 +1,62 @@
+.define K = 3
+L0: .string "zc1acz:9", ";.9yb#bay#"
+.string "c09z"1z", "z0:y"yx;"
+L2: .string ";"
+L3: .string ".#;0z"
+prn #K
+L5: .string "yz1#0##9"
+L6: prn #K
+L7: .data 1 , K , -5
+mov L16, r2
+L9: .string "9"
+.entry L55
+L11: .data 1 , K , -5
+L12: .string "bx#:y0zx"
+.string "9xzca:1#:"
+L14: .data 1 , K , -5
+.entry L57
+.string "#"
+.string "c01""b#.":""" "0.b.0#0"
+L18: .data 1 , K , -5
+L19: .string "" "1#x1."
+L20: .string "z;xycza1z"
+.string ".:""
+L22: .string "y:0z" ""
+L23: .data 1 , K , -5
+.entry L45
+L25: mov L13, r2
+mov L1, r2
+.string ".c#9bc10zayb"
+L28: .string "10yz"
+L29: .string "x#"
+L30: mov L23, r2
+.entry L12
+.data 1 , K , -5
+L33: mov L5, r2
+mov L52, r2
+L35: .string "1:.:az;:9"
+L36: .string "c:.09.1"
+L37: .data 1 , K , -5
+.entry L35
+.string ".y:c", ";a.x1zx0c10c"
+L40: .string "cc9xb.9#" "xab#"
+.string "y9#xxx""1yc"
+mov L26, r2
+.data 1 , K , -5
+L44: mov L25, r2
+L45: .data 1 , K , -5
+.string "0zz.:b1c1."
+.string "1zx9"#b:"
+prn #K
+.entry L32
+L50: .string "9"
+L51: .string "#b"1::", ""
+.string "z.zxzx1c"
+L53: .data 1 , K , -5
+.string ";cx"
+L55: .data 1 , K , -5
+L56: .string "", ".#1"00y0z"
+mov L22, r2
+L58: .string ""
+mov L36, r2
+ hlt
@@ -0,0 +1,62 @@
+.define K = 3
+.string "a.0:" "b.9"
+L1: .data 1 , K , -5
+.string ".;#1cby"
+.string "0"
+.string "1#a" "zcz1"
+mov L46, r2
+L6: .string "c91c:.;zy;z;" "#zc::"
+.string "xaxcxyx99b:;"
+L8: .data 1 , K , -5
+L9: .string ""
+L10: .string ":y00#"" "x9x1a;z0;"
+.string "#xyb:"0" "#"
+L12: .string ""1y9:b#b."
+L13: mov L44, r2
+.entry L53
+L15: .string ";yx:1", "9:9;"
+.string "az#90;xa", ""
+.entry L31
+L18: .string ";0az"a"
+L19: .string "" "aaz;zb91y#"
+L20: .string "#0y9c;:z#z"0", "0zb"
+L21: .string "c;.c99#0""
+.string ".y9"
+.string "xbyy", "0ay"by9:#b""
+prn #K
+L25: .string "1##9;9x#", ";"
+L26: .string "yx99"
+L27: .string "a"
+L28: .string "xz1x11"
+.string "a""z;""
+.string "babb;"
+L31: .string "a01#c"
+L32: mov L20, r2
+.string "cz..c;xyb1."
+.string "c.:0:b;1:#"
+L35: .string "999" "z9.:"
+prn #K
+.data 1 , K , -5
+L38: .string "", "#0"
+.string ":b0y0yzb1"
+L40: .string "0xy;;", "a1cax9c9";z""
+L41: mov L30, r2
+.data 1 , K , -5
+L43: .data 1 , K , -5
+.entry L10
+L45: .data 1 , K , -5
+L46: .string ";19ba#9x0"
+L47: .string "0az09", "9."
+.string "1""
+L49: .string "1b"c.a.a:ay""
+.string "z"
+L51: .string "z.z"
+.string "xc91bxc"
+.string "a."
+L54: .string ".y."
+L55: .string "c.z"019y" ""
+L56: .string "#1ac""
+L57: .string "y9#."y1a"
+L58: .string "0a;""xb1910." "c"0;#::..#"
+L59: .string "##c1b9c0" "y10z#.10"
+ hlt
@@ -0,0 +1,62 @@
+.define K = 3
+.string "#"c:x:c"x:"
+L1: .string ".ya"
+prn #K
+L3: .string "b""
+.entry L28
+mov L50, r2
+.entry L14
+.string "0:z0:z:bz"
+mov L44, r2
+.string "1:"
+L10: .string "9z" "y;y0c;1"
+.string "zcb0::10a.0" ""
+.string ":yc.0.""
+L13: mov L45, r2
+.entry L45
+.data 1 , K , -5
+L16: mov L31, r2
+.string ".;az;.;zc"
+.string "x"
+L19: .string "9.a1"z:b9acy"
+L20: .string ".b19z""aa"
+L21: .string "9"1x:xy#"
+.string "cy0:""xy0;x" ";y0"
+L23: .string "1bb#a;"
+L24: .data 1 , K , -5
+.string "zay90c"
+L26: .string "xy"
+L27: .string "bz"
+L28: .string "az9yc#" "9."
+L29: .string "cb1zbzy#"x"
+.string "9##"
+.string "ab;c9##z" "c9yy"
+L32: .string "ab9.y"bz#:0"
+.string "y#abby0010y", "1y"
+L34: .string "xx""z"
+.string "0yc1;91", ".1"xa;"
+L36: .string "ba"
+.string ";9."ax."
+L38: .data 1 , K , -5
+L39: .string "cy";c:a.90", "x1a;"
+L40: .string "1#z:x;a9."
+L41: .string ""
+.string ""c:z.", ";by."
+L43: mov L3, r2
+L44: .string "9a#1z0;";1#" "b"19yz"
+L45: .string "0;b#1"
+.string ""
+L47: .string ".abyxac9z"
+L48: prn #K
+L49: .string ""
+L50: .string ":", "9"
+L51: .string ""
+L52: .string ";c:#.0"
+mov L9, r2
+L54: .string ""
+.string "b." "0yxy"
+L56: .string "y..x" "bca"b#yc#x"
+L57: .string "ba.;90c.1"
+L58: .string ""
+.string "#""y1a0c.a:9"
+ hlt
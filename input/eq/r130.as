@@ -0,0 +1,62 @@
+.define K = 3
+L0: .string ":#1:1azx;zx" "9:.b9::x"z"
+.string "a:"
+.entry L46
+.string ":"
+L4: mov L40, r2
+prn #K
+L6: .string "bc"c", "10by0#"0"bz#"
+L7: mov L7, r2
+L8: .string "c.0y0:"
+L9: .string "z#9"1.;."
+L10: .string ""ya#z9aa;" "19b;:by"
+L11: .string "1c;x0"
+.string "#z"
+.string "yyx:"
+L14: .string "0y0b1z:yc#""
+L15: .string "ab1y10;"x."
+.string "b.x"
+L17: .string "x;9a#ax1x"
+L18: mov L38, r2
+L19: .string ""11#cz"
+L20: .string "cz1z0a.bzac"
+L21: mov L12, r2
+L22: .string "x0..a"ya"
+mov L29, r2
+L24: .string "199090zax"
+.string "b9c#z#9"
+.entry L12
+L27: .string ""
+.string "cy;cz9b"
+.string "1b1:.aa"
+L30: .string "9az;x.0a9c"
+.string "zb;x.b""
+L32: .string "1#xc";0ay1:", ";09"
+.string "zzcz"
+L34: .string "za09:"x"
+mov L14, r2
+.data 1 , K , -5
+L37: .string ""
+mov L15, r2
+.string ";0."0;9y"
+.string ";9"
+mov L44, r2
+L42: .string ":xbx;1z"9z""
+L43: prn #K
+L44: mov L44, r2
+L45: .data 1 , K , -5
+.string "19.b9#"
+L47: prn #K
+.string "zbc;c:b0:"
+.string "zbz.11"
+.entry L53
+.entry L2
+.string "b:c.xz"
+.string "9bz"
+L54: mov L45, r2
+.data 1 , K , -5
+.string "yxcyxaaxcb" "x;:;cz"
+L57: .string ""0b;"ya:x"
+mov L32, r2
+.entry L42
+ hlt
@@ -0,0 +1,62 @@
+.define K = 3
+.string "0"
+.string ";;b.c"
+.data 1 , K , -5
+.string "xx9a.c1.;#.", ""..ba."
+L4: .string """
+L5: .string ";zb#9;0xc;1#"
+L6: .string "aa0c", "1"
+L7: .string """
+.string "900"1c"
+L9: .string "y#", "."aya#bxz1#"
+.string "c9:aa9zy"
+L11: .string ";xx1z.b.y."
+L12: .data 1 , K , -5
+L13: .data 1 , K , -5
+.entry L20
+L15: .string "a#.c;c.zcb" "9;"
+.string ";c1x:;9y"
+L17: prn #K
+L18: .string ""
+L19: .string "cb.:ybx;z"
+L20: .string ":#c0#;0c."
+L21: .string ""0b"#0"caybb"
+L22: .string "b"
+.string ""b#bzy;#c:" "x#.cxx"b"
+L24: .data 1 , K , -5
+L25: .string "x00#" "9:"
+L26: .string ""
+.string "bzy"b1.9x"
+.data 1 , K , -5
+L29: .string ".", ":xy#x#.#0#"
+L30: .string "z"
+L31: .string "9c"
+.string "11;."
+L33: mov L18, r2
+.string "":#a"
+L35: .string "9.b"
+L36: .string "90acc9cz:xx1"
+.entry L52
+L38: .string "z", "".ya0cc;"
+mov L16, r2
+L40: .data 1 , K , -5
+L41: .string ";c#"
+.string "a""
+L43: .string "xz#b#;9bxxb:"
+.string "a.ya909x9", "bxxaa1"
+.entry L51
+.entry L16
+L47: .string "z;""
+prn #K
+.entry L20
+.string "abxbb;""
+L51: .string "9#y":9;9"
+.string ".1y0"
+.string ";xybaa", "1:.9c:x#"
+.entry L21
+.string "1#00b:"99;"
+.string "::b#:"1yy#", ""
+L57: prn #K
+L58: .string ""za9a0.;"
+L59: .string "" ".9"
+ hlt
@@ -0,0 +1,62 @@
+.define K = 3
+L0: .string "ay"
+mov L34, r2
+.string "x#1c"
+L3: .string "#"1"";#9#"", "z0;zx.#b9a;""
+.data 1 , K , -5
+.entry L4
+.entry L50
+L7: .string ""x#b1c""
+prn #K
+L9: prn #K
+.string ";.by1#c0::"
+L11: prn #K
+L12: .string ";x#a#1"
+L13: mov L39, r2
+L14: prn #K
+L15: .string ""
+L16: .data 1 , K , -5
+L17: .string "b;:11x", "..#1bzcc"
+L18: .string "x".x9a1z9b;", ""
+.string "0#999"
+L20: .string "zby.#z.yzc"
+L21: .string "1"
+L22: .string "1"
+L23: .string ";z#x:::x1:9", ""
+L24: mov L13, r2
+L25: .string "x1a:"
+.string "ay;#"9z#..x#"
+.string "1a##z#9"
+prn #K
+L29: .string "b#y" ":0z.ax""
+.string "cy"" "a1#1"y#b"
+L31: .string "ab"
+.string ".yy;0xacxc.0"
+.string "yb1009##c9", ""
+.string ""
+L35: .string ";ax.bzb", "1zx:#x.b"
+L36: .data 1 , K , -5
+L37: .string ";z9bz1z;;xz"", ".a:9.z.bxaz"
+.string "1c"9".#1zy"
+L39: .data 1 , K , -5
+L40: .string "c9z9;9:0b";" "ya11cy0x1"
+L41: .string ";.x9y0x#c"a" "z"
+.string "ca0by;x:091"
+L43: .string "yx9b91z:z", "9y"9##"
+L44: .string ""c9b", "y#0:z#:ba"
+L45: mov L46, r2
+.data 1 , K , -5
+.data 1 , K , -5
+L48: .string ".09""
+.data 1 , K , -5
+.string ""
+L51: mov L13, r2
+.string "xy"
+.string "b:x"#a00;b" "c"
+L54: .string ""
+.string ".y9a.z.z;c", ""
+.data 1 , K , -5
+.string """"y9"
+prn #K
+L59: .string "c1y:a:#" ""
+ hlt
@@ -0,0 +1,62 @@
+.define K = 3
+L0: .string ";##z9.;.."a."
+.string "xa09"
+.string ""
+.string "cyb;c;b.z"
+L4: .string """, ""1xcyb"
+L5: .string "9"9.a;000"
+L6: .string "0y01z9"
+prn #K
+.entry L53
+L9: .string "aa"
+L10: mov L48, r2
+L11: .string ":y"
+.string "9"0b::cb9b"
+L13: .string "."
+mov L29, r2
+.string """00.;y." "c#::;:b."
+L16: prn #K
+.string "" "1;cx"
+L18: .string "ya"
+.string ".zb;0;:y:"
+.string "0"
+L21: .string ";c#" "#9"0abxz"
+L22: .data 1 , K , -5
+mov L52, r2
+L24: .string "c:z9.0z:"
+L25: .string "#yaxz"
+L26: .string "y:"zz09z9"
+.string ";#yx;byb"
+.entry L43
+L29: .string ""
+.string ":c1zybc"
+L31: .string "a:x.;"
+L32: .string "cxab"
+L33: .string "0y.", "y1;:"
+L34: .data 1 , K , -5
+L35: .string "0yx"#c."z#x"
+L36: mov L48, r2
+.string ".ya#0y.#;b"
+.string ":"
+L39: .string "y::a#9x11y9."
+L40: .string "0.1x1:b"
+L41: .string "09x#c::b9."
+prn #K
+.string ""
+L44: .string "c0"
+L45: .string ""
+L46: .data 1 , K , -5
+L47: .string "1b0", "cz:"";;1az"
+L48: .string ".;01"
+L49: .string ".x"1;zxabb.", "bb#119b"
+L50: mov L43, r2
+prn #K
+L52: .string "#by.bby"x;.9"
+L53: .string "".#90z#a"
+L54: .data 1 , K , -5
+.string "0", "zcb;9;""
+L56: .data 1 , K , -5
+.entry L35
+L58: .string "", "cxc"
+.string "9z0;1" "y#9#9b"
+ hlt
@@ -0,0 +1,62 @@
+.define K = 3
+L0: .string "..:"ca:#"
+L1: .string ";91", "y"
+.string "yyb.;.:y:":.", "z":y:zc".90"
+prn #K
+L4: mov L36, r2
+L5: .string "x.c", "cbzx:yz0:xy."
+.data 1 , K , -5
+L7: .string ";#;b."
+mov L10, r2
+L9: .data 1 , K , -5
+L10: .string "c#;99b;x#"
+.string "zab" "01"
+L12: .string ""
+L13: .string "x1#x:#y1#."
+.string "99.ba"y", "9"
+.entry L49
+.string "":zx"
+L17: mov L50, r2
+.entry L18
+.entry L3
+mov L37, r2
+.data 1 , K , -5
+.string "a.c;"90a", "a;c9zx;zab.x"
+L23: .string ""b#y9.x#0;"
+.entry L49
+.string ""
+L26: .data 1 , K , -5
+L27: .string "#:0b:"
+L28: mov L9, r2
+.string "1y;:a"
+L30: .string "1.1:x.0." ""
+L31: mov L32, r2
+L32: mov L9, r2
+.entry L7
+.string ";0x:b:.19"
+L35: .string "1;b;9zbca"
+L36: .string "01;1#ba9", "#zcc"
+L37: .string ".0"
+L38: .string ""ay.zy1:.cy:", "yx"
+L39: .string "c";b9z"
+L40: .string "x.ay;0bya"xz"
+L41: .string "1y#1z:aa:;", "a9:cb01yba1c"
+L42: .string "0""9;c1x1b.9"
+.string "a.""
+L44: .string "bab"
+L45: .string ".91"
+.string "x;ayyyx9"
+L47: prn #K
+mov L3, r2
+L49: mov L36, r2
+L50: .string "", "z:"yc:"#z"
+L51: .string ";.;1"
+L52: mov L24, r2
+mov L43, r2
+L54: mov L24, r2
+L55: prn #K
+.string "bb;ac0919abb" "x:;x9zy"0"
+prn #K
+.string "#yc1cc9.c9x"
+.data 1 , K , -5
+ hlt
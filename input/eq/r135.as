@@ -0,0 +1,62 @@
+.define K = 3
+.data 1 , K , -5
+L1: .string "b1ya;"cz:yz" "y;"""
+L2: .string ""
+.string "y"
+mov L4, r2
+.string "x"
+.string ";ba.1:"
+L7: mov L15, r2
+L8: mov L15, r2
+L9: .string "zybcy"bx.:"c"
+L10: .string ":"
+L11: .string "1z:c;x1" "zx#1;"x9c#""
+L12: .string ""
+.string "1b:#0"
+.data 1 , K , -5
+.string """ "9byz#"0zz"
+.string "y:"
+L17: .string ":1zb;x"
+mov L35, r2
+L19: .data 1 , K , -5
+.string "901yyz"
+.string "c#"cc"
+mov L4, r2
+L23: prn #K
+L24: .string ""zyx1"
+L25: .data 1 , K , -5
+.string ""
+.data 1 , K , -5
+L28: .string ";xc19#y#"
+L29: .data 1 , K , -5
+L30: .string "x.a0z1"."
+L31: .string "11za9b"
+L32: .string "9."
+mov L29, r2
+L34: .string "0"y"
+.string "c"
+L36: .string "1"
+L37: .data 1 , K , -5
+L38: .string ":9##xyza#" "z#1b""
+L39: .string ""1b":0"
+L40: mov L0, r2
+L41: .string ";#"#yy" "zb;#zz"
+.string "099abxzx9""
+L43: mov L13, r2
+L44: .string "y", ""
+.string "91c;y:"
+L46: .string "bc"
+.string ""
+L48: .string "0by9c"0c"
+L49: .string "9c.z"0b:1"
+.string "bx#."
+.string ";;0x909#", ":0"
+L52: .string ";1;c1:"c9y"
+L53: .string ":;ac"
+L54: .string ""
+.string "yxx.0#:#;:a:"
+.string "ayz00z1"
+L57: .string ""xy";9yyac0" "."cy0::"z"
+L58: .string "b#1" "1:""
+mov L4, r2
+ hlt
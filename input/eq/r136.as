@@ -0,0 +1,62 @@
+.define K = 3
+L0: .string "1#x0.c" "aca.;ax"
+.string "z01".#ab"", "9##a"
+.string "9yxyy"
+.string "##y;:0b.9#"
+L4: .string "xx9z;.;c9a"
+.string "zx"
+L6: .string "1.x0"1y"
+L7: .string "c#x1a11"
+.string "b:#z#zaz"
+.string "#bb1a;;1c"
+.string "00"9ybx0"b:"
+L11: prn #K
+L12: .string "91babxz."
+.string "11z;9x90.x#a" "1b1y9:;"0".x"
+L14: .string ";1"
+.string ":0xzb011" "a#"xxbx"
+L16: .string "xz"911"
+L17: .string ":c"xbaz.x"
+L18: .string "xc.bbb0.z;" ":zb:b1"
+mov L35, r2
+.string "b9"
+L21: .data 1 , K , -5
+L22: mov L43, r2
+L23: .string ":.a10##:xc"
+.string "", "azy"
+L25: .string ";azc;xx1.b9""
+L26: mov L24, r2
+.entry L35
+L28: .data 1 , K , -5
+L29: prn #K
+.string "xxb"
+L31: .string "c;y9zxa1:"
+.string "xb;1ay"
+.string "#:b1" "c""z0zx"
+mov L0, r2
+.string "91:a11;..z"
+.string "9.bcx10"
+L37: .string ":c."c#.0"
+.string "z."
+L39: .string "9"
+.string "zxx:z1z;#"
+L41: .string ":.a", ";"bba""
+L42: .data 1 , K , -5
+L43: .string ".b."
+prn #K
+L45: .string ""
+.string "x:x"
+.entry L8
+L48: .string "x::9ay;yz"a"
+L49: .string """9y0:", "#"aczaax#b:""
+L50: .string "yb:a#0#"
+.string "##zzyy;y;:", "ca0;a"
+L52: .string "11za"
+.data 1 , K , -5
+L54: .string "#", ":yc"x"yzb"
+.string "91y"99"
+L56: .string "ab:.xb.0:yz"
+L57: .string ":.yba", ""
+L58: prn #K
+L59: .string "b9.", "a9#y1y9.#0"
+ hlt
@@ -0,0 +1,62 @@
+.define K = 3
+L0: .string "x1z"
+.string "0""91"
+L2: .string ""
+.data 1 , K , -5
+L4: .string "#x"10"
+L5: .string "zb.z.9"
+L6: .string ";9;.zax#"
+.string "a..x"zxx91c"
+.string "#yy:91#"
+prn #K
+mov L24, r2
+mov L58, r2
+L12: .string """, "b#"
+L13: .string "y."11xc.b"
+.string "b#b0;y" "0;.#.zaa#z#"
+L15: .string "z#0a1", "a1a;x"
+mov L2, r2
+.data 1 , K , -5
+.string ""
+L19: .string "1:#.c9#0yzc"
+L20: .string "zyz#y9y#.y0y"
+.string "az0y:z.0y0"
+L22: prn #K
+L23: .string "zabx"
+prn #K
+.string ".ybbx.ay"
+L26: .string ";y0xx1c;9"
+L27: .data 1 , K , -5
+L28: mov L43, r2
+.string "0a01:acc", "9."
+.string "0"
+L31: .string "0"x;""10ac" "00byb9"
+L32: .string "9";0"
+L33: .string ""
+L34: .string "9.bbc;za"
+L35: .string "b.#cbx:0ac9"
+L36: .string "a09#.9;0yy0", ""
+prn #K
+L38: .string "z1z.9"bc"
+L39: .string "a#a:"
+L40: .string ".;9:9#" "x"19a1"x:c"
+L41: mov L10, r2
+L42: prn #K
+L43: mov L27, r2
+L44: prn #K
+.string "0ca;;.9", "zzy9yz.#;."
+L46: .string "x.c"
+.string "ab"
+L48: .string "", "c0#z""
+L49: .string "00ac09"
+L50: .data 1 , K , -5
+L51: .string ";#;..a0;0"
+.data 1 , K , -5
+.string "##x"0xay"
+L54: .string "xz#c"#"
+L55: .string "xzyx" "y9x"
+L56: .string ""
+L57: .string "0b#"
+L58: .data 1 , K , -5
+.string "b9:"
+ hlt
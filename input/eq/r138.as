@@ -0,0 +1,62 @@
+.define K = 3
+L0: .string "yx9"yxcc"1c"
+mov L5, r2
+L2: .data 1 , K , -5
+L3: .string ":x", "a.:zx"
+.string "c:y0:9b.09", ".0a#":9#aa:9"
+.string ";0az9#xxy""a"
+L6: prn #K
+L7: .string "zy:#."
+L8: .string ";.0yxz"
+.string "0"0y009" ".a0zyx."
+L10: .string "x"
+L11: .string ""bcc#yc9", "0x;19"
+L12: .data 1 , K , -5
+.string ".0;bbz"
+L14: .string "09#10:;1bb"
+.string ""x"
+.string "0b:zzz11b"zx"
+L17: .string ";::", "b""c19z."
+.string "1;bx;0:1zz"
+L19: .string "099#9cb", "1x0"
+L20: .string "0", "zb;bxbz1z."1"
+.string "91"
+L22: .string "":":b"y"
+L23: .string ":b91.1yc:;xx"
+L24: .string ""
+L25: .string "y;a0y00#yb99"
+L26: .string "09"
+.string "."z;"z"
+L28: mov L25, r2
+prn #K
+L30: .data 1 , K , -5
+.string ";:1#"
+L32: .string ":0"
+.string "b9z;aa.1;"
+.string "a91abaxbb#.b"
+.string "0#y9ba#x#;b"
+L36: .string "z9.##c0#"
+.string ""
+L38: .string "z:x1:c:;" "c:##ab"
+.string "" ""
+L40: .string "9.", "9#0xc9c.x;"
+L41: .string "0#"""a", "bc"
+L42: .data 1 , K , -5
+L43: mov L31, r2
+.string "0x"#"
+.entry L12
+L46: .string "aabyc"
+.string "":0c"1:#b##"
+L48: .string ""
+L49: .string "91y:xzxay;9#"
+L50: .string "b"
+.string "z:#y0a;".;x0"
+L52: .string ";;#:"
+L53: .string "x"
+.string "9;;xz":y09"
+L55: .string ":..0;"zyy:"b"
+L56: .string "z##yby"
+mov L54, r2
+.string "x0ybz"xz9y"1", "xb9a9c0a"
+.entry L35
+ hlt
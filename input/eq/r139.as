@@ -0,0 +1,62 @@
+.define K = 3
+.string ";":y.9a9"
+L1: .string "#c;"#"y"x"
+L2: .data 1 , K , -5
+L3: .string "9zb#b" "aa91y#9a"
+.string ";" "0.0:;a"
+.string ".xby" ":1b."
+.string "0:.xbx.1zax""
+L7: .string "0:9cz" "#.9y:.a#aa"x"
+.string "yz"
+L9: .string "1"x"
+L10: .string ";:0"y1", ""
+L11: .string "cba9xx;9;a", "."
+L12: mov L46, r2
+.string "b01"
+L14: .string ":;c#09"
+L15: .string "#x1x0x;:xbc#"
+.string "0#xba9;;c", ""
+L17: .string "z1"b;0z:"
+L18: .string "9#1#y09"
+L19: .data 1 , K , -5
+L20: .data 1 , K , -5
+.string "" "yab0;"
+L22: .string "y"x"y.."1:c"
+prn #K
+L24: .string "b#", ".;:1bb9#0x9."
+L25: .string "#ay.9#a9;"
+L26: .string "1a#."
+.string ""
+L28: prn #K
+L29: .string "aca#"
+L30: .string ""
+.entry L5
+L32: .string "."
+L33: .string "":"
+L34: .data 1 , K , -5
+L35: .string ";"0"
+.string "00;a" "xx;"
+.string "azaxx.0"0x"
+L38: .string "0cc9y#b"
+.string "y", "9:yb.y19"
+.string "z.x:yxz:x1"
+.string ":9.0##z;19#"
+L42: .string ""
+L43: mov L4, r2
+L44: .data 1 , K , -5
+L45: .string "9ya9#a"
+L46: mov L25, r2
+L47: .string ":aa", ""
+L48: .data 1 , K , -5
+.entry L11
+L50: .string "9yy;#9"
+L51: .string ""
+L52: .string "c:y"
+L53: .string "ycac"
+L54: .string "yyzb"
+.string "zc:czbybbz", "9z1.b"
+.string """
+mov L2, r2
+L58: .string "0##9b1z0b9.c"
+L59: .string "", ""
+ hlt
@@ -0,0 +1,62 @@
+.define K = 3
+.string "9xy.yy.b:1"
+L1: .data 1 , K , -5
+L2: mov L14, r2
+.entry L51
+.string "9cc9::yca:"
+L5: .string "x"00" ";b"::b;"
+L6: .data 1 , K , -5
+.string ":xy1;x1#"
+L8: .string "y"
+.string ":"
+L10: .string "c901y1100;"
+L11: .string "";1b;c1"
+L12: .string "00az.;z1yzy" ""
+L13: .string "baxyaa"
+.string "ybac#"
+.string "cxx;"
+.string "a9;.#"
+.string "10x09" "1;ax:"
+L18: .string "#bcx"
+L19: .string "1c90a#b", "900c1"
+.string "a:"
+.string ";:"9.", "1y1zb""
+.string "9"b"b0"b"a", "ba"
+L23: .string ";ca11#"
+L24: mov L5, r2
+L25: .string ";:9a9#x.az", "0"
+.string "aycy;"
+mov L33, r2
+.string "" "1"
+.string ":#0x"
+.string "0"9"
+mov L12, r2
+.string "#b1"
+L33: .string "#:;:y#01x." "."
+L34: mov L12, r2
+.string "x#:zz19"
+L36: .string "1c""y1y9ac"
+L37: .string ":yz:."
+L38: mov L32, r2
+mov L56, r2
+.string ""0;1" "zczx""9:zz"9"
+L41: .string ""ycy"
+L42: mov L54, r2
+mov L18, r2
+L44: .string "b1#;##b."9"x" "x99#;0x9"
+.string ""bb#.b""
+.string "c"
+L47: .string ":"
+L48: .string "z"yc11.#", "a91za"
+L49: .string "bz9.#cy0" "b0:z1"x9.0c#"
+.string ".x#y" ":byx9:axcx0"
+L51: .string "::#yay9xxzc"
+prn #K
+.string ":9y11#"
+.string "x..:yx9"
+.data 1 , K , -5
+L56: .string "9z0zy9z"
+.string "bxcx1"
+.string "0a0;x".byb9;"
+mov L30, r2
+ hlt
@@ -0,0 +1,62 @@
+.define K = 3
+L0: mov L17, r2
+.string ".xa9x.0":0"
+L2: .string "x:"0.1ya9"
+L3: .string "1:9cc"c:0.#"
+.data 1 , K , -5
+L5: prn #K
+L6: .string ".9"
+.string ""x0"
+L8: .string "1;:1;", "0;:y#0:z:"
+L9: .string "";1z#"
+.string "c0bzc1bcy"c#"
+.string ".ba0" ":xxzzx9.zy"
+.string ";a#;0c:9cy9"
+L13: .data 1 , K , -5
+.string ":" "#.bb"0zcay"
+L15: .string ":#;cxx0"
+.string "c.0bc#c" "#9#;9"
+.string "abbb."
+L18: .string "x9""
+L19: .string "##.::."
+.string "b.;ab.zc:z" "0;#1"9;1"
+.string "1ba#;xzx9:"
+.string "c"c;bybyy"
+L23: .string ":ccaaa.1."z1"
+.string "#9"
+prn #K
+L26: .string "#z.09y#;"
+L27: .string ""
+.data 1 , K , -5
+.string "z109y.z;#1z:"
+L30: .string "9#:aba1"
+L31: .string "yy;xx:z"
+.string "a.yxc;c#cx." "9:;0x91b"
+L33: .string "0zbb"
+.string "9a91"9b"
+L35: .string "9#1":;z"
+mov L38, r2
+L37: .string ".bab".az0"
+L38: .string "z"a"
+.string "09"
+L40: mov L28, r2
+L41: .data 1 , K , -5
+.string "a"
+L43: .string "#1b#", "xc"
+L44: .string "99:xzbaa9;"
+L45: .string ".;9" "x"
+L46: .string "x" "#yzby1"
+.string "19a9#zybc#"
+L48: .string "1x.z#", "b.:1.:"#;;ac"
+L49: .data 1 , K , -5
+L50: .data 1 , K , -5
+.string "y.1.#9yyc"
+L52: .string "c:axb0"
+L53: .string "99;#9;1#99""
+L54: mov L0, r2
+L55: mov L40, r2
+.string "#a0"
+L57: .string "aay.."
+L58: .string ";19."
+L59: .string "9a;z"
+ hlt
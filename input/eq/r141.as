@@ -0,0 +1,62 @@
+.define K = 3
+L0: .string "1c;.1ay:9a:z" "9z;."
+L1: .string "z;x;." "91y1y0c"
+L2: .string ""
+L3: .string ";1abayaz;:" "100zc;1.0"
+.string ""
+.string ";::azyzx;a"
+.string "b0999cz"
+.string "0x"#;"":cz"
+.entry L11
+.string "#c;;"
+.data 1 , K , -5
+L11: .string "ca"x01#za.a;"
+L12: .string "ac0y", "ya0"
+.string "#:x0ac1b"
+L14: .string "y.y:bzy:.9;"
+L15: .string ":0y;c", "cb;91a"
+mov L43, r2
+prn #K
+L18: mov L12, r2
+L19: mov L27, r2
+L20: .string "9"ca"
+.string "bb0;"a0axbby"
+L22: .string "#a.0"
+L23: .string "z9.1b9"
+L24: .string ":;x"
+L25: prn #K
+.string "c:c1." ""
+L27: .string ";a0cx"
+L28: .data 1 , K , -5
+L29: .string "zz"
+L30: .string ".y"
+.string "aa"b99ccx9"
+.string "az"
+.string "c09x"0c1" ";z;:by#01:"
+L34: .string "ba9z;;y9"
+L35: .data 1 , K , -5
+L36: .string "x9:0x:a", "#;;0"
+L37: mov L59, r2
+.string ":#c"z.b", ""b.0z1"
+.string "yzxya"
+L40: .string "#".;:xcz"
+L41: .string ""
+.string "0z;::#;;"
+mov L59, r2
+L44: .string "bx"
+.data 1 , K , -5
+.string "b", "0:1xxccc0b1"
+L47: .string "y":c;#"
+L48: .string "":xa#1"x#:#", "9;"
+.string "a9:cc#y091.y"
+mov L6, r2
+L51: .string ":ac0.z";9#z" "x;9cb#9"
+L52: prn #K
+prn #K
+L54: .string "", "yb."##"0"
+.string "bz.ay"
+L56: .string "x;zxa1y;:"
+prn #K
+.entry L24
+mov L29, r2
+ hlt
@@ -0,0 +1,62 @@
+.define K = 3
+.string "c1yzz"#" "y"
+.string ""a1xb.z9" "1"
+.data 1 , K , -5
+.string ""
+.string "#z0"by:y.za"
+L5: mov L20, r2
+L6: mov L3, r2
+L7: .string "a;"
+mov L42, r2
+.data 1 , K , -5
+.string "x;y", "1"
+.string "#c"
+.string ":0#;:."
+L13: .string ""
+.string "ac.;#ba;b199" "czx##;11":0a"
+.string ".y:y;yx:b"
+L16: .string "1..a"
+.string "1";bzyccya", "y0;0y:"
+.string "1x9"
+mov L58, r2
+.string "cb" "z01cc;90z;a"
+.string "a"z.;0yy0;1", "z9#9a9"
+.string "c0a1"
+L23: .string "yc1yc#b9zy;#" ""##19"
+.data 1 , K , -5
+L25: prn #K
+.data 1 , K , -5
+L27: .string "b.a10z0:;.#"" "9zz;"c1bzaa"
+.string "1", "xayzxya:z:1:"
+L29: .string "yz"
+L30: .string "bcby9.x1b"
+.string "z0;b"
+prn #K
+.entry L55
+L34: .string "acc.0y"
+L35: .data 1 , K , -5
+L36: .string "9a" "b0b9cyzzcy""
+mov L50, r2
+L38: .string ":1"bza;9#y"
+L39: prn #K
+.string "9xcccac1a"
+.string ""by"
+.string "#0#0y:0"a.""
+L43: .string "::"
+L44: prn #K
+.string "x0y::"
+mov L36, r2
+L47: .data 1 , K , -5
+L48: mov L56, r2
+L49: prn #K
+L50: .string ".99z#9za#"a." ""abz"1z:"
+.entry L33
+L52: .string "91#.ayaa#y."
+.string "b0z1.y9"
+.string "b0c"
+L55: .string "0":9azy"
+mov L55, r2
+L57: .string ""axxz".1"
+L58: .string "a1abc#b:", "a.#"
+L59: .string "010b.#:0"
+ hlt
@@ -0,0 +1,62 @@
+.define K = 3
+.string "", "xb"
+L1: .string "b;y"0by;10:;"
+.entry L18
+L3: .string "bx;z"
+L4: .string ";:#" ""
+.string "#zyy:;.0z", "99bbc1ac"
+.string "zay:aa11a"
+.string "c1a" "9:11a..b#yx1"
+L8: .string "9#b"
+.string "y9b;:.yxc.z""
+.string "y9#ac"
+prn #K
+L12: .data 1 , K , -5
+L13: .string "yzyx0zb"
+L14: mov L44, r2
+.string "9"
+.string "1xzb" ""
+.string "c;:z9"
+L18: .string "b"z::b"
+L19: .string ""
+.string ""01::99;#"
+mov L39, r2
+L22: .string "1:cx0;;;9"
+L23: .string "."
+mov L18, r2
+L25: .string "x;9xcc;#;z;"
+.string "";1z9b#:xx:"
+L27: .string "zxyc#1"
+.string ":zb#c"#"a"
+.string "byyzy:"
+L30: mov L36, r2
+.string ".b"""
+L32: .string ""
+L33: .data 1 , K , -5
+.data 1 , K , -5
+mov L32, r2
+.string "c." ";bbza"
+L37: .data 1 , K , -5
+L38: .string "zx", "b9xz0";cy:""
+L39: mov L3, r2
+L40: .string "x;0yb", ".bc9;"";"
+L41: .string "#"
+.data 1 , K , -5
+L43: .string ""1zz#y"
+L44: .string ""#.x9", "99#.9zx"
+L45: mov L46, r2
+.string "1#0a.9"
+L47: prn #K
+L48: .string "bbb:.zc1#"
+.entry L32
+.string "z"
+L51: .string ""
+.string "1"ax.;0z.y"
+.string ""
+L54: .data 1 , K , -5
+.data 1 , K , -5
+L56: .string "x0"
+.string ""
+L58: prn #K
+.entry L57
+ hlt
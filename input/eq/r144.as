@@ -0,0 +1,62 @@
+.define K = 3
+L0: .string "c#0b:01;x1:"
+L1: .string "9yx"
+L2: .string "9"
+.data 1 , K , -5
+.string "0.;x#c;" "yb"
+L5: .string "y9zx"
+.string "" "cx.:"0"
+L7: .string "b"
+L8: mov L50, r2
+L9: .string "b.;az11###" "::y.c#x9:z9c"
+.string ""
+L11: .data 1 , K , -5
+.string "90yyccx" "by"
+.string "by", "y1ca##9"
+.string ""
+L15: .string "z9xx:x.#xy1x" "b0.z::y"9;"
+L16: .string "a":"
+.string "xcb1x;9x""
+L18: prn #K
+.string "0x1:"b:zz9#"
+L20: .data 1 , K , -5
+.string "ax"y9.c#.:x"
+L22: .data 1 , K , -5
+prn #K
+mov L5, r2
+L25: .data 1 , K , -5
+L26: mov L5, r2
+L27: prn #K
+.string "0"
+L29: .data 1 , K , -5
+L30: mov L12, r2
+.string ".9:0axzxzax;", ""
+L32: .string "x10", "b"
+L33: .string ":;"
+L34: .string "yx019...;1"
+L35: .data 1 , K , -5
+L36: .string ":z.;acy;;"
+L37: .string ".b0zx#"
+L38: .string ""
+L39: .string "1;b:0x9y#;x"
+.string "90:a"
+L41: mov L20, r2
+L42: .string ""a" ".z"
+L43: .string ""
+L44: .string ";9a90bbxxyyx" "y."
+L45: .string "#z:9;#"ax9"
+L46: .string "0zc1xy0bz"
+L47: .data 1 , K , -5
+L48: .string "9.0b.0" "a"
+L49: .string "cz#c1#b."
+L50: .string "y.:9", "z"yc;01";191"
+.string "";z...;z" "b1;1:;;;##;z"
+L52: .string "a"
+L53: .string ""9#9zzx9x#b"
+L54: .string "", "xa0y0"
+.entry L37
+.string "a1a", ":z;ayz:a..0"
+.entry L44
+mov L30, r2
+L59: .string "a0;."
+ hlt
@@ -0,0 +1,62 @@
+.define K = 3
+.entry L58
+L1: .string "z.#::.1;9y" "a;"
+.string "y0c."
+L3: .string ""ca;xa1.;01." ":.0z"
+L4: .string "xyx#;."
+L5: .string "00:xbx901;;0" ":a.."
+L6: mov L13, r2
+.data 1 , K , -5
+.string "a;"" ""
+.string ";"
+.string "zxx1#b0b0cc0", ""
+.string ""a"
+L12: .string "" ":by##"
+.string "0bz"b"""
+.string "yaz"
+.string "x.x10z:"
+L16: mov L0, r2
+L17: prn #K
+L18: .string "#9:x.#;"
+L19: .string "x", ""
+L20: .data 1 , K , -5
+L21: .string "yc"
+.string "9x1abxx";yc#"
+.string ":cc0ca1z:"
+L24: .string "z#91.19a"#"
+L25: .string "y"
+L26: .string "zyb:b.;00x9x"
+.string "".ya.b#c;"
+L28: .string "01" "abyby0#.xy9"
+.string "b#bcyy"
+L30: .string "9:990c"
+L31: .string ".:#"
+.string "0z1":b"za.az"
+L33: .string "9#a#", "zx;c.1;ya"
+.entry L19
+L35: .string "y09a"
+.data 1 , K , -5
+.string "bc"
+mov L59, r2
+.string ":9cy.09z:1;y" "zz9xyy"
+L40: .string ""
+L41: .string "x001z;b:"
+L42: prn #K
+.string "::y"
+L44: .string "a::z"
+L45: .string "b"y90"cbx"
+.string ":a:"
+L47: .string "1y"."
+L48: .string "y"
+L49: .string "10x"
+L50: .string "b""
+.string "."
+L52: .string "y1"000x"
+.string "0#:::cb.09a"
+L54: .string ";a"" "cy."1"
+.string "1"b#"bz"
+L56: .string "x1b.01b"
+.string "x"..x"
+.string "ay:b"
+L59: .string ".#cxyxbaz1", "a"
+ hlt
@@ -0,0 +1,62 @@
+.define K = 3
+.string "#bc;ybz#ax:0"
+.string "yz" ""
+.string "c.1#;x", "00:"
+L3: .string "1;cz:"
+L4: .string "z1"
+L5: .string "zac#z0"
+.string "y1.#;#:z;9"
+.string "#.#10"1c"1"
+.string "x.c0" ";:9:"
+L9: .string ""1z9x0.";y"
+L10: .string "c"
+L11: mov L3, r2
+L12: .data 1 , K , -5
+L13: .string "#1a"c9cbxxcz", ""
+L14: .string ""
+.entry L26
+L16: .data 1 , K , -5
+L17: .string ";1.9""1", "y"
+L18: .string "0;x0c11"
+L19: .data 1 , K , -5
+L20: .string "zc"
+L21: .string ""
+.string "0#"ax0#91#" "#:x;a::".x"
+L23: .string "y""9"
+.string "", "b"
+L25: .string ";0y0910" ".c"
+L26: .string "b#y99z"
+.string "x"a0"
+L28: .string "ca90x" ".b01;zz""
+.string "bzzbzc.99" "yz1ybb"
+L30: .string "91"
+.string ""
+L32: .string ":a9z:#999", "x.9b#b"
+.string "1"9zx""
+L34: mov L41, r2
+L35: .string ""#x1#" "x.by"xa"0"
+.entry L11
+.data 1 , K , -5
+L38: .string "1ya.a"by""a"
+L39: .string ":a9"cy"
+L40: .string "."
+.string "a.z#b#"
+.entry L59
+L43: .string "0#a9;.;ay:;."
+L44: .string "" "b;x1c;"
+.data 1 , K , -5
+.string ";""", "ba1a;a#x"
+L47: .string "a1:";c"
+L48: .string "a9z9;xbz1#"
+L49: .string "0b0zb9" "0:c"y#.:x"
+.string "bcza;c"
+.string ""0." "#""xxy0:"
+L52: mov L58, r2
+L53: .data 1 , K , -5
+L54: .string "1900zc"
+.string "zcx" "b"
+L56: .string ":yy0#" "a.ab"b#"
+L57: .string "y1#b.1y99z9", ".1.zx.:":.z""
+.string "1by1a.y", ""by#1by#a0"
+.string "1"."
+ hlt
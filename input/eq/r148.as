@@ -0,0 +1,62 @@
+.define K = 3
+.string ""
+L1: .string "bx1:"
+.string ";.x0z0;a0z"
+L3: .string ""
+L4: .string "byx0.0::" "09"
+.string ""
+L6: .string "::cc#1y1#x" ""10x"
+L7: .string "a:a1x99:#;#" "001"
+L8: .string ""
+.entry L49
+L10: .string ""
+L11: prn #K
+L12: .string "bbay"", "":cya;#a:z:;"
+.string "c#"
+L14: .string "z" "00x"
+L15: mov L15, r2
+.string "axy":c#:#ca9" "b.0;1;1"
+prn #K
+.string "z1"
+L19: .string "1bz;b"c9ac"
+L20: .string "z#;1zb"
+L21: .data 1 , K , -5
+L22: .data 1 , K , -5
+L23: mov L38, r2
+.entry L18
+L25: .string ";x1#b:9c;:xc"
+.string "yab.0#:1z9"
+prn #K
+.data 1 , K , -5
+L29: mov L13, r2
+L30: .string "#xc#zx09;;aa"
+.string "c;abc9a#by", "0;:"cza;z9"
+.data 1 , K , -5
+.data 1 , K , -5
+mov L45, r2
+L35: .string """""
+L36: .data 1 , K , -5
+L37: mov L42, r2
+L38: prn #K
+.entry L15
+.string ""
+L41: .data 1 , K , -5
+.string "0b"
+.string ":a:yyx"
+L44: .string "b:z"
+.entry L53
+L46: .string "c9;a.a;x9"
+.string "#.cc"
+.string "ab.;a100b;" "yxa""0:cb0"
+L49: prn #K
+L50: .string "b" ":"
+mov L32, r2
+L52: .string "x;"1z91"
+.string "y1y00x9", "zba0"ca00:"
+L54: .string ";czx":.10x:"
+.data 1 , K , -5
+.data 1 , K , -5
+L57: mov L26, r2
+.string ""
+L59: .string "a:.0#x91a"
+ hlt
@@ -0,0 +1,62 @@
+.define K = 3
+L0: .string "ca"
+L1: .string ""
+L2: prn #K
+L3: .string "a0"
+L4: .string ":1c9"
+.string "zxc"
+L6: .string "c:" ""
+L7: .string "xb"
+.string "x9"##.ax#" ""
+L9: mov L57, r2
+.data 1 , K , -5
+mov L2, r2
+L12: .data 1 , K , -5
+L13: .string "#".;9xbz"
+L14: .data 1 , K , -5
+L15: .string ""
+L16: .data 1 , K , -5
+L17: mov L54, r2
+L18: .string "yyx#0"
+L19: .data 1 , K , -5
+.string "0"zxab#"
+L21: .string ";"yc"
+L22: prn #K
+.string "c;1"
+L24: mov L12, r2
+.string "y::x0cy01""
+L26: .string "0:;z"a"1" ";0c#c0.za#z;"
+L27: .string "y"9;yz;.z."
+L28: .string "cb:"
+L29: .string "yc;#y1c10"
+.entry L8
+L31: .string "9y" "."
+L32: .string ";z:"yb#c"
+.string "by"
+L34: .string ":.9#zyybc", "19"z"
+.string ";a.a#x0";" "z9c119yz:;zb"
+.string "baay"yxzc;"
+.entry L14
+L38: .data 1 , K , -5
+.string ""
+L40: .string ""
+L41: .string "10""":9.z"0:"
+L42: mov L57, r2
+.data 1 , K , -5
+L44: .string "#1:9aa:"
+L45: .string "bz":y#0x"
+L46: .string ""911aby#zx"
+.string ":;aazc"00.:"
+L48: .string ""
+L49: mov L30, r2
+.data 1 , K , -5
+.entry L19
+L52: .string "z:bc;0", "b09.;xc;c"
+L53: .string "xacyc.:axb"
+.string "z".a""
+.string "1y;9#z1z0.b9"
+L56: .string "a.0b;cc;0a0"
+.string "yz""0c9""
+L58: .string "0..11c"
+L59: .string "yx;1ac", ""0z"a"a.x#b"
+ hlt
@@ -0,0 +1,62 @@
+.define K = 3
+L0: .string "acxaa#:c".z", "1.zy0"
+.string "#zxy."
+L2: .string "1b1;#z"
+.string "0#"#b1""
+L4: .string ".".ay91c"bb0"
+.string "y09xc99z"
+L6: .string "z01z"1#b#""
+L7: .string "00a"y.b"
+.string "c"1;"
+L9: .string "", ";"
+.string "..y:b;a"
+mov L27, r2
+.string "y;1y9"a#0"0"
+L13: .data 1 , K , -5
+L14: .string "yx"
+L15: .string ":;z" ""
+L16: mov L3, r2
+.entry L32
+L18: mov L53, r2
+L19: mov L55, r2
+.entry L6
+L21: .string "9;1;b0#;a"
+prn #K
+L23: .string ";99"
+L24: .string ":9:b9.1;"
+mov L21, r2
+.string ":0ayzc#yz"
+.string ";#xbb:yx.:b"
+L28: mov L56, r2
+.entry L39
+.entry L26
+.string "z#"
+L32: .string "11;c0b0" ".x:a1z0"
+.string ""
+L34: .string "1;#y01#"
+L35: .data 1 , K , -5
+.string "11z.;"
+.string "#9"
+.data 1 , K , -5
+L39: .data 1 , K , -5
+.entry L11
+L41: .string "by..xy", "yc1:"
+L42: .string "b:x#x00x", ".:1:::"
+prn #K
+L44: mov L24, r2
+L45: .string ":zb#c"
+.string ":"bc.9.yy", "y1"c"x""
+L47: .string "::x9"9;#", "z;b#;ay#axa"
+L48: .string ":;zzz0:9:"
+.string "";:x0.b:c0c"
+L50: .data 1 , K , -5
+.string "0zcx9z"bcaz9"
+.entry L3
+L53: .string ""
+L54: mov L44, r2
+L55: .string "0x#.x.0"z"
+L56: .string "9c0";yz###:b"
+L57: .string "", "c#0y:b;"
+L58: .string "a.1;zccxbby", "xc"
+.string "1x.ac9::#"
+ hlt
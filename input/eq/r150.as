@@ -0,0 +1,62 @@
+.define K = 3
+prn #K
+L1: .string "cc0b".y"
+mov L28, r2
+L3: .string "c""c1zb:y1zc", "#"
+.string ";:119;9";a:", ":1cxa#y1x#"
+L5: .string "a9:#"
+.string "9"
+L7: .string "0bbz#z"" ":cabcy"
+L8: mov L43, r2
+L9: .string ";.xyab0a10"
+L10: .string "0c#9#"
+L11: prn #K
+L12: .data 1 , K , -5
+L13: .string "xc#y;0c:z"
+L14: .string "a;"
+L15: .string "a19b1ax#""
+.string ":;ycy#c."
+.string "c"
+L18: .string "b.b0:y;"
+prn #K
+L20: .string "z0::0b"
+.entry L20
+L22: .string "0cac1"1"9"
+L23: mov L23, r2
+.string ""x.x"
+L25: .string ".;x1xy0"
+L26: .string "y"
+L27: .string "01"9" "a"a::"
+L28: .string ".1.z":1z:"
+L29: mov L37, r2
+.data 1 , K , -5
+.string "9#b9919;;"
+L32: .string ""
+L33: .string "bzz9by"
+.string "#099y0"
+.entry L13
+.string "#.9.ac:"
+L37: .string "1.::a"
+.string "z0.zcc1;"0y"
+L39: .string ":"::1.#1#"1"
+.string "0"0ybyc"
+L41: .string "a"
+prn #K
+L43: .data 1 , K , -5
+.string "zby;:ay."0y"
+.string "c1x0b1"
+L46: .string ":10", ";;c1a0""
+L47: .string "9x9#", "zc"0;"
+L48: .string "z;z9;9" "z990#.90x:y1"
+L49: .string "y;"
+.string "y901x1b"
+L51: .string "1a;;9:c""
+L52: .string "y", "xb19a;"
+L53: .string "x"#xb;9""
+.entry L42
+.string "y0z:9ba", ""
+L56: .string "y##;;"
+mov L6, r2
+L58: prn #K
+L59: .string "#a#":yx0"
+ hlt
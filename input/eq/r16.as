@@ -0,0 +1,62 @@
+.define K = 3
+L0: .string "x1a0":"
+L1: .string "y"z:"
+L2: mov L50, r2
+.string ""
+prn #K
+L5: .string ".yx#yzy0#b"
+.string "y;ayb"#a9"
+L7: .string "11bc."
+L8: prn #K
+.entry L53
+.string "";b1:ac"
+.string "", ":0;z19:"#:"
+L12: prn #K
+L13: .string "x"
+.data 1 , K , -5
+.string "0c:.yxc;ax9x"
+L16: .string "0a01.1"
+L17: .string "0:y"
+L18: .string "b0:" "1"
+L19: prn #K
+.entry L27
+L21: .string ":1"c"" "0"a1y;yb"b"
+mov L15, r2
+L23: .string "19c19b#::" "za1b#1.#a9"
+.string "y0bxx1"
+L25: .string "0;;xa"
+L26: .data 1 , K , -5
+.string ".xx9#":""
+prn #K
+L29: .string "", "#9x1;1zc.1.."
+L30: .string ".y:":"
+L31: .string ".#.b.#xzx"
+.string "ba;cc:."
+L33: mov L48, r2
+.string "0yb;0;"
+L35: mov L1, r2
+.string "00#"
+.string "9za90za:c0"
+L38: .string "a"0:"."
+L39: .string "", ":;y"
+L40: .string "", ""9acz;;b"
+L41: .string "y;;#09"
+.data 1 , K , -5
+L43: .data 1 , K , -5
+.string ".zb"":y"
+.entry L36
+L46: mov L7, r2
+.string ""1y""
+L48: .string "a.x"b#0c;xz"
+mov L53, r2
+.string "#azcz0;yz#xc"
+L51: prn #K
+L52: .string "a9b"."yxbb1" ""
+L53: .string ""bz0;1"
+L54: .string "x:"
+.string "c"
+L56: .string "#:0b.y"y0z.#"
+L57: .string "1a9", "a1909"
+L58: .string "x9xacacyxz1" "c""xz10"
+L59: .string "0:a0"
+ hlt
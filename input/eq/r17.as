@@ -0,0 +1,62 @@
+.define K = 3
+.string "yc#.." "bax0"
+.string "z:":.0c9ac"#"
+.string "#:xz9b.:"
+L3: .string ":;c:#0""
+L4: .string "a#.za1z;#"
+L5: .string "x9z"
+L6: .string ";"999cy:yzz"
+L7: .string "yzaa#za1.y1:"
+L8: .string ".1a;;9:c01."
+.string "xy", "bxa"9y#z#z"
+L10: .string "y"y:01b9b9:x", ";c#y"
+.entry L52
+L12: .string ":1b1#xx1"
+L13: .string ""
+L14: .string "" ";c9x;"
+.string "y0z"
+L16: .string ""
+.string "c111"9c9911a" "a""
+L18: .string ""
+.string "" "y;x#b#""a19"
+.string "", "b0a.9ax9yyzz"
+.string "0a9#zb" "a:."yzzbzc9""
+L22: .string "y"
+L23: .data 1 , K , -5
+L24: .string "9#;"
+L25: .string "0#9;#c:9"
+.string "#"y0b;x" "c#x09z9#1#9"
+L27: .string "9xza"
+L28: .string "9"
+.string "y"
+L30: mov L9, r2
+L31: mov L55, r2
+L32: .string "c0b"#::##y"
+.string "00yby0:xzaa"
+L34: .string "100;y.y1#c" "xx""
+.entry L14
+mov L4, r2
+L37: .string "9#c;1.1":bc"
+L38: .string "001z"".#xz"
+.string "a1b0":1", "1a"
+L40: .string "a""
+L41: .string "";:y"
+L42: .data 1 , K , -5
+L43: prn #K
+.data 1 , K , -5
+.string "."
+L46: .string "x#9bazz"
+.string "zxa;##b"
+mov L7, r2
+.data 1 , K , -5
+L50: .string ":"
+L51: .string "1a:"ya;b#bc1"
+L52: mov L38, r2
+L53: .string "0"
+.string "#z.1#a"1"
+L55: .data 1 , K , -5
+.string "":c#b:z:a", ":x"y.0#bb"
+L57: .string "00##:y;x"
+mov L49, r2
+mov L53, r2
+ hlt
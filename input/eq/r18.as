@@ -0,0 +1,62 @@
+.define K = 3
+.string "xx1:1"
+.string "y.b"
+.data 1 , K , -5
+.entry L15
+L4: .string ";9x#:"
+L5: mov L45, r2
+L6: .string "x#.09z"
+.string ".y9by1;9c" ":#cxx::#0c09"
+.string "y9"z##"":"
+L9: .string "1b"
+L10: .string ":0#;"9:#9ac#"
+.entry L52
+L12: .string "y."
+L13: mov L21, r2
+mov L58, r2
+.string ""a;0c#c;"
+L16: .data 1 , K , -5
+L17: .string "9ba#;#y" "1;91"0"
+prn #K
+.string "z."
+.string "z"
+mov L33, r2
+L22: .string "c"
+.data 1 , K , -5
+L24: .string "zbzzb;yz."
+.data 1 , K , -5
+L26: .string "ay0#.a;y0yb"
+L27: .string ":1bb#"z":y"
+L28: .string "bx.b"1#zc" "bxz"9:19#9#"
+L29: .string "a9:"x:xab0:#"
+L30: .string "x9c"
+.string "..1"
+.string "9cy0c1;x;y1" ".#z9a;1y#"
+.string ""
+L34: .data 1 , K , -5
+.entry L19
+L36: .string "b"9"ca", "x1b.."11xx"
+L37: .string "cx0""
+mov L35, r2
+.string "xa::." "0b"
+L40: .string "1bb", "zz"
+L41: .string "x"xc"
+.string ""
+.string "zcax:#.czy.9"
+.string "z"yyzx1z0" "9#by1c:"x1zx"
+L45: prn #K
+.string "z#y"1yxy;a."
+.data 1 , K , -5
+.data 1 , K , -5
+L49: .string "za##0#0"#""
+.string "z1z"9x:0#y"
+L51: .string "#9bxb##;90z#" ":z9z;"
+L52: .string "az" "0#x"
+L53: .string ""z"c", "xyx."
+L54: .string "zz#;x"
+.entry L50
+.data 1 , K , -5
+L57: .data 1 , K , -5
+.string "", ""9b;c""
+L59: .string "zc:"
+ hlt
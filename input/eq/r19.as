@@ -0,0 +1,62 @@
+.define K = 3
+.data 1 , K , -5
+L1: .string "z9y;c;" "0zy""
+L2: .string ";xbxb910""
+L3: prn #K
+.string ""01:y;9"c#:0"
+.string "x0xcc:1b9.1a" ";b91"91"
+.entry L56
+L7: .string "01b:.:y"
+L8: .string ".c11"
+L9: .data 1 , K , -5
+.string "0b1b191:ac0:"
+L11: .string "1"bx"
+.entry L4
+.string "a0"
+.string ""
+.string "y9z" "y:"xbxy91#9c"
+prn #K
+.string "y:.:9y:9;0"" ""
+L18: .string "9"
+.string "0:zzzc1""z."
+L20: .data 1 , K , -5
+L21: .string "bz0z1"
+L22: .string "bx0a"
+.string "b.;9b"a;"
+L24: mov L20, r2
+.string ""
+L26: .string ""1cb.1y90"
+.string "xycz19x91y"
+L28: prn #K
+.string "c09y1z1", "a;x:y9"
+L30: mov L8, r2
+L31: .data 1 , K , -5
+.string "by#01;b"
+L33: .string """b", "c.90y10"
+L34: .string "ay;#1;zxyc#b"
+L35: .string ""
+L36: .string "a", ".1yzzy"
+.string ""
+.string "zy.:1b9"
+L39: mov L38, r2
+.string "zax91#"
+.string ":;c", "0c.9b#xybc"
+L42: .string "9b;" ";xz9c"
+L43: .string "" ""
+prn #K
+L45: .string "9b.:09a";;:"
+L46: .string ";y#1"0#;zb" "90ca.#0;"
+.entry L5
+prn #K
+L49: .string "9"
+L50: .string ""a:1cz11", "c#y""
+L51: .string "00:a#x9.x" "a#c"
+L52: .string "z"
+L53: .string "90011"
+.string "z#zcxyczy"
+L55: .string ";9a01"
+.data 1 , K , -5
+L57: .data 1 , K , -5
+L58: .string "c;;"xzc9"
+L59: .string """:z"
+ hlt
@@ -0,0 +1,62 @@
+.define K = 3
+.string "", ""c.#:"
+L1: .string ""
+L2: .string "#."9z9"
+.string "" "009c9"
+L4: .string "c9"
+.string "1#", "#z#;zz"1"
+mov L29, r2
+L7: .data 1 , K , -5
+L8: .string ""#z:11z;"
+L9: .string "xz"."c;y#1" "."9999:;;0y."
+.string "b#"z.a"x." ":ay;x:b#9"
+.string ""
+L12: mov L23, r2
+L13: .string ""
+L14: .string "azyc"c.c9.a", ""
+.string ""
+.data 1 , K , -5
+L17: .string ""
+.string "" "0";.c1xb::z""
+.string "9;"
+L20: .string "yy;0:"
+L21: .string "" "cc"
+L22: .data 1 , K , -5
+.string "x.1", ";"
+mov L23, r2
+L25: .string "#aca00cb"
+L26: .string ""
+L27: .string ":11y9:0x"
+L28: mov L51, r2
+L29: .string ";a09;cb:#"
+.string ";"
+.data 1 , K , -5
+.string "bbyx"#"
+L33: .string ":11x;;"
+L34: .string "bx#1xb;z0.1"
+.string "bbb;"
+.data 1 , K , -5
+L37: .data 1 , K , -5
+.data 1 , K , -5
+L39: mov L22, r2
+L40: .string "y19"1", "#01":y0xc1;"
+.string ";"
+L42: .string "9c" "#"
+.entry L41
+.string "x.::z1"
+L45: .string "0bz9x.9ycc1."
+.entry L48
+L47: .string ".a#;0.c" ""
+.string ".:1z9z"
+L49: .string "x9;x0":0:az", "1:c"ba0x.;;"
+.string ""9##xy"
+L51: .string ";ca;:01y9;c1" "bza19"::b#;1"
+L52: .string "1ab;#zc#", "0y::#"".cac1"
+L53: .string ""
+L54: .string ""
+L55: .string "y1:c1.9.yb"
+L56: .string "y::09"b9:x0;"
+.entry L40
+L58: .string "9x9yabb"
+mov L13, r2
+ hlt
@@ -0,0 +1,62 @@
+.define K = 3
+.string "cy::"b"z;ca0", "b"
+L1: .string "xxz::z"
+L2: .string "0bx;xax"
+.string "y.yc"
+L4: .string """x", ""
+L5: .data 1 , K , -5
+.string ".1c:y9"0c"
+.string "c#;0zxb;a9x", ""b"
+.entry L41
+mov L25, r2
+L10: .string ".a":cb19zab;", "z"
+.string ":a#a"
+.string "a:" "y""
+L13: .string "xx""
+L14: .string ":b"
+L15: .string "y0"b"yxz;y"
+L16: mov L3, r2
+.entry L18
+.string "#bb;1xa"
+.string ";z.acyy;" "a"
+.string "0.;b;"z#y"
+L21: prn #K
+.data 1 , K , -5
+L23: .string "" "b;"1zx#"
+.string "x;azcb"
+.string "x9cy#.a"
+L26: .string ""
+L27: .string "0.9".y" ".y;##b:1yz"
+.string "1cz"
+.string "c:...::9"
+L30: .string ""
+L31: .string ".y"1:ccc"
+.string "#"
+.string "zbcyybcyb1"
+L34: .string ""9.:b:c".y9"
+L35: .string ":#91"cc", "bx10"
+.entry L19
+L37: .data 1 , K , -5
+.string ".y""
+.string "bz9x.#c" ""ycaz"
+L40: .string "c9bc;"99ab""
+.string "x;":110."
+.data 1 , K , -5
+L43: prn #K
+L44: mov L40, r2
+L45: .string "xbb9"
+L46: .string "x9.c9a1b9aya" "zyy90:":b:"z"
+.string "cx" "10"aa;#x099"
+.string ".":#"9y"
+L49: .string "b.a"zc:xcx"
+.string "9:;0:y"
+L51: .data 1 , K , -5
+L52: .string "", "9"
+.string "9"z"
+.entry L18
+L55: mov L58, r2
+L56: .string "b"
+L57: .string "zyz."ay.a1az", "1"1#yaaaba9"
+L58: .string "b"":"
+.string ""
+ hlt
@@ -0,0 +1,62 @@
+.define K = 3
+.string "y1"x#1#9c9"
+L1: mov L59, r2
+L2: .string "#xx.a0.#0;1a" "1.b:zac."
+.string "c9.z01c"
+.string "b#x"
+.string "#;.bb919"0xz", "0yz190z1"
+L6: .string ".1a1b9;.9x;"
+.string ":c" "z#;yx"
+.string "0zc:a:9:x0c."
+.entry L24
+.data 1 , K , -5
+L11: .string "#0#.1a""
+.entry L2
+L13: .string """
+.entry L47
+L15: mov L8, r2
+L16: .string "1ax"z#cz;#0", "yc9;yc#"
+L17: .string "ay;z:x";0y:"
+.string "cb", "a:"
+.string "ycy9z01x;c"
+.entry L47
+L21: .string "9".#a#a01"b" "c".xy.;z."
+L22: .string ""9#9"
+L23: .string "" "z9yy.;9#9xb"
+L24: .string "z"
+.string "b:"##19;a:"
+L26: .string "0bxaa:"
+.string ".01#x0"
+.string "ba1c1z.;x#"
+.data 1 , K , -5
+mov L52, r2
+L31: .data 1 , K , -5
+L32: .string "0"9.aczxy", "cb9cb9y;0.."
+.string "0x:zz:;:xyb"
+L34: .string ":9"
+L35: .string "c01001" ":c:0"
+.string "az#"
+.entry L4
+L38: .string "1.1xa9cby" "azcc;"
+L39: prn #K
+L40: .string "9xx;#""
+.string "", "b"
+prn #K
+L43: .data 1 , K , -5
+L44: .string ";11:#:zc"
+L45: .string "a#b:bc9b:""
+L46: .string ""
+.string "cabxz9"
+L48: .string "0bz"xx9a"
+.data 1 , K , -5
+L50: .data 1 , K , -5
+L51: .string "#ay:ax:"
+L52: .string "y", ".#zazc;"
+L53: .string "cc990xx99y#"
+mov L58, r2
+L55: .string "z9"
+.entry L1
+.string "a:.x.bx99z9y", ":0;"
+mov L41, r2
+L59: .string "x11ya9"
+ hlt
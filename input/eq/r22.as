@@ -0,0 +1,62 @@
+.define K = 3
+L0: .string "", "c.b.:z#"
+.string ";c9:."
+L2: mov L56, r2
+L3: .string "xc"b;9"
+mov L36, r2
+L5: .string "yc0y#"
+L6: .string ""y:.", ""
+L7: .string "9y90", "y;"
+L8: .string "9990#:90b" "zb0#0a""
+L9: .string "1" "a9"
+.string "x1ab9c##:."
+L11: .data 1 , K , -5
+.string "1a"b1.9c;"
+.data 1 , K , -5
+L14: .string "z#b"#;ybac9"
+L15: .string ".;0.ycabxz"
+L16: .string ""bcay#b", "x0zb.9"ca"
+prn #K
+.string "0a#..01yxx"
+.string "cc:zaa1c;", ".ay##ax"
+.string "190", "y"".a"
+L21: .data 1 , K , -5
+prn #K
+.data 1 , K , -5
+.string "xyy9"
+L25: prn #K
+.data 1 , K , -5
+L27: .string "z"#b0:", ".cb"
+L28: .string "9"cx9z";"
+.string "9"
+prn #K
+L31: .string "y9"
+.string ";9.9zz:#."
+L33: .string ":yaxx"
+L34: .string "", "b"
+prn #K
+L36: .string "zc"0yx"
+.entry L23
+L38: .string "99xb", "#y9"
+.string "b9"
+L40: prn #K
+L41: .string "c:;10:"
+L42: .string "1zxy.abbc""
+L43: mov L30, r2
+L44: mov L8, r2
+.string "#y9x;.x#z"
+.string "0:19#"0y#"x#"
+L47: .data 1 , K , -5
+L48: .string ";9x"
+L49: mov L7, r2
+L50: .string "zc.ca9" ":#bc"
+.string "cbz9:." ""
+L52: .string "c9;c.by", "cc.b.9:"
+L53: .string "#;zx"c.":a;"
+.string "0:z0#.bx"
+L55: .string "z;9yc.z09", ""
+L56: .string "" "0bz;a""
+L57: .string "#cy:ba1""
+L58: .string "cba"
+L59: .string "#1:yy;:z.y"
+ hlt
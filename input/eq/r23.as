@@ -0,0 +1,62 @@
+.define K = 3
+.string "a", "09zc.x"
+.string ""
+L2: .string "", "0z#ax#a;z:c"
+L3: .string ""z;y:z;b"1c.", "1::cc#c9z:"9"
+L4: .string ""
+L5: .string "zbzy9y#19", "b;"
+mov L15, r2
+L7: .string ";b0c1aa:00a"
+L8: .string "#.a"
+.string "a#01x", "19x#"
+L10: .string "9", ".9"
+L11: .string "a1"
+L12: .data 1 , K , -5
+.string "0b.":.x9y00y"
+L14: .string "ba:c" "."0xc:bz"
+L15: .string "1#1.yaz0" ".""
+L16: mov L41, r2
+L17: .string "0"
+.string ".9c99yyb"
+.string "#a:1;0"
+L20: .string "yzc0"
+.entry L48
+L22: .string ".b0x" "9z"
+L23: .string "#1a"ay#"b"
+.string "", "y"
+.string "bc.90;:zyb;." "ab"
+L26: .string ":c.y1.y;#"
+prn #K
+L28: .string "zb" "x0z"
+L29: .string ":z9:x."
+L30: mov L42, r2
+.string "z0", ""a10"
+.string "xz"
+L33: .string "1"c;0z"
+.string ""c0"z;1"
+.string "";c1x:" "1"
+L36: .string ""
+L37: .string ":.:"y.cc;b#"
+L38: .string "b" "c:#yb;a#9;"
+.data 1 , K , -5
+L40: mov L45, r2
+L41: .string "#9yz.ax#"
+L42: mov L4, r2
+.data 1 , K , -5
+L44: .data 1 , K , -5
+.string """, "#"
+.string ""
+L47: .string ":ax.:.:b:""
+L48: prn #K
+mov L16, r2
+L50: .string "0#a;#;0#a:ac", ""
+L51: .string "a"1b1z" ";a"cxy#"#bc"
+prn #K
+.string "9x#c9:9:;;#x"
+.string ".#"#cb90z"
+L55: .data 1 , K , -5
+.string "xcz:01xc99#"
+L57: .string "#"
+.entry L23
+.data 1 , K , -5
+ hlt
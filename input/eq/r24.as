@@ -0,0 +1,62 @@
+.define K = 3
+mov L11, r2
+L1: .string "::"
+L2: mov L45, r2
+.string ""
+.entry L7
+L5: .string "."1:y1b"
+.string "zyb9:z:axz"
+L7: mov L15, r2
+.data 1 , K , -5
+prn #K
+.entry L47
+L11: .string "1#c:cz1x:"
+L12: mov L16, r2
+.string "#xb:cyz:", "0x#"
+L14: .string "y#c.;"
+.string "aa"1."
+.string ""
+L17: .string "91;90""
+L18: .string "cz.b"
+L19: .data 1 , K , -5
+L20: .string ":00:0yy10:#"
+.entry L58
+L22: .string "c"
+L23: prn #K
+.entry L28
+.string """
+L26: .string "1acz#yb"cbc"
+L27: mov L33, r2
+.string "::11"
+.string ""czbx9ccc1z"
+.entry L39
+L31: .string ":;;xy1bxx0;"
+L32: .string "1."c"acc"x.""
+L33: .string ";.;xzyxy19"
+L34: .string ";yxz"x#"#"
+L35: .string ""1z11;0"
+L36: .string ""#y:#9"b;:zx"
+mov L22, r2
+L38: .string "x9y;:.zc"
+L39: prn #K
+.entry L37
+.string "x"
+L42: .string "#1c9.x""
+.string "bz:.c:;#x;", ";0"
+mov L24, r2
+L45: .string "yx1"." "x:c9"#"ay:c"
+L46: .string "x."1#:z;x" ";"#1;"
+L47: .data 1 , K , -5
+.string "bx0";y#.x1"
+.entry L32
+.string ".#9" "."
+L51: .string "c9az:c"
+.string "bx"b", "yc;z.b"x0x"c"
+L53: .string ""
+L54: .string "091byz", ";000ccy"b"
+.string "a;"
+mov L55, r2
+.string "", ":"
+L58: .string "b;#;y"
+L59: .string "y:#:;.9z:zc:"
+ hlt
@@ -0,0 +1,62 @@
+.define K = 3
+L0: mov L13, r2
+L1: .string "##"
+mov L10, r2
+.data 1 , K , -5
+L4: .string "#."", "ccx"
+prn #K
+.string ""
+mov L34, r2
+L8: .string ""
+L9: .data 1 , K , -5
+.string "".xayx"
+L11: .string "cabbc99."
+L12: .string "#b"9zb0#a"
+L13: mov L2, r2
+.string "bc:yz##;#:.0"
+L15: .string ""
+L16: .string ";"
+L17: .data 1 , K , -5
+.string "a#0ay0cbycb"
+.entry L54
+L20: .data 1 , K , -5
+.string ""z::9.0"
+L22: .string "yxc"
+L23: .string "#z.b9:b.c" ""
+L24: .string "yz0"
+L25: .data 1 , K , -5
+.string "b" "#bc"
+.string ".9c#c9aa01"
+.string "cxa9a"
+.string "";.1zy#"
+.string ""1#a"y0a#"
+L31: .data 1 , K , -5
+L32: .string ";y9" ";a;.z#x1yb""
+L33: .string "", ":;#;##bc0::"
+.string "b101#"
+L35: .string "y#b:#1:bz"
+L36: .string "y"
+.string "zc"1a;#;1"
+L38: .string ".11xcby"
+.string "#x#aby#::x"
+.entry L22
+L41: .string "9xyx:b" "#c90y1:b1"
+L42: .string "c;:"" "z:19z;z":."
+.data 1 , K , -5
+.string "a."azc.zzx;", ""
+L45: .string "b#c.ax9." "1c#c;9b"
+L46: mov L3, r2
+L47: .data 1 , K , -5
+L48: .string "xa1yc#:xc"
+L49: .string "91;bc"
+.entry L21
+L51: .data 1 , K , -5
+L52: .string "#1yy:""
+.string "11z." "az0;y#:c""
+L54: .string "bb;" "x1"
+.string "y"#x9y0"
+L56: .string "", ""
+.string "xz00;"
+L58: .string "z;#b1", "a9:y"
+L59: mov L19, r2
+ hlt
@@ -0,0 +1,62 @@
+.define K = 3
+.data 1 , K , -5
+L1: .string "y", "yz""0"
+L2: .string ".", ":b;"0#0.a"
+L3: .string "1yc;z;:x."", "0"
+.string "", "bc1.cy9a"
+L5: .string "cz;;0by1""1z", "#y"
+L6: .string "xcx#.19b"
+L7: mov L40, r2
+L8: .string "..by11y9"
+L9: .string "199:ba;az#xy"
+.entry L27
+L11: .string ""
+L12: .string "", "0x""
+prn #K
+.string ""
+.entry L8
+.string "bx;z"ya", "y9"
+L17: prn #K
+L18: .string "c..z;.axb1;;"
+L19: .string "acb0"
+L20: .string "9..ac1a;;9"""
+L21: .string "xb9;9#1z"
+L22: .string "caz" ".z0"
+L23: .string "#."a.#:ca"
+L24: .string "b:.cy:;", "z.990"z;b1z"
+L25: .string "x;#:x9."
+L26: .string "by.y:", "1y0ya""
+L27: .string "a1"x#ybbc#xy" ";"0;yy9a"c:"
+.string "#"
+mov L43, r2
+L30: .data 1 , K , -5
+mov L1, r2
+L32: prn #K
+L33: .string "b9azy:bbc""
+.entry L35
+.string "az.;b1:cz1z"
+L36: mov L21, r2
+.string "19cb0:00"
+L38: .data 1 , K , -5
+L39: .string "bb", "0#x#.cy19."
+L40: .string "bb""b"
+.string "a"a::cy9"
+L42: .string "#"#1b"19.0", "0z"z9xa.y"
+.string "a0c#:90" ":90"9a99yx;"
+L44: .string "xa#1911"
+L45: .data 1 , K , -5
+L46: .string "xy1;"
+L47: .string ":#xbyy.9#"
+.data 1 , K , -5
+L49: prn #K
+L50: .string "x0c:yb"
+L51: .data 1 , K , -5
+.string ""
+L53: .string "1..##a1b#:y", ";.19"
+L54: .data 1 , K , -5
+L55: .string "":";9.:b1:x1"
+L56: .string "a;".09z.b", ";.:#"
+.string "x"0.b"
+L58: .string "b1"
+prn #K
+ hlt
@@ -0,0 +1,62 @@
+.define K = 3
+L0: .string ".cxc:1#0x"
+.string ";x"
+L2: .string "z."cc9"
+mov L39, r2
+.string "xa"
+.string "9"
+.string "0cxzba0#"", "c0#y""
+.entry L11
+L8: .string "x..90axxa"
+.string "0b1""c.19x9#"
+.string "1"y"
+L11: .string "0:9y1c"
+L12: .data 1 , K , -5
+.string ":zbx0"
+L14: .string ":y"9;:1bc#"
+L15: .string "1"
+L16: .string "#.00#0".bzx", ";;9z9"
+.string ":"
+.string ".."
+L19: .string "1":x"
+mov L30, r2
+L21: .string "bb0", ""y1"zz0zx#a"
+mov L44, r2
+.string "" "bbzbb;x;"
+L24: .string ""1.9cx"z0;"
+L25: .string "9xzz:yy"
+.string "a9z"." "z;0"cz9cz;"
+mov L2, r2
+L28: .string "y"y#:;"" "yb0b1c"
+.string ":"#9x"
+L30: mov L16, r2
+L31: .data 1 , K , -5
+.entry L24
+L33: mov L13, r2
+L34: .string "xx;cyy;cx.a:"
+L35: .string "1"0##0z.:;;x"
+.entry L26
+.entry L57
+L38: .string "ca.xy1:x"a"
+.string "#0ybb"
+.string ";"."
+L41: .string ""
+.string "".1:" "y.z"9""
+.string "yaa:b"
+L44: mov L26, r2
+.string "" "a09"
+L46: .string ".zxb"
+L47: .string ""
+L48: .data 1 , K , -5
+.entry L44
+L50: .string "::"9c09:9ba"
+L51: .data 1 , K , -5
+L52: .string "9xbb0#bz.:""
+L53: .string "", "#b"a"b:c;:y"
+L54: .string ":x:01.0.;:", "cyc.x"
+L55: .string "bz9y"
+.string "bx9:c##;a1a#"
+.string "9"xc0cb1;"
+L58: mov L2, r2
+L59: .string "#"
+ hlt
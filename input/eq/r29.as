@@ -0,0 +1,62 @@
+.define K = 3
+L0: .string "yb9z00aab" "x#zb1z;90""
+L1: .string "#0:#:;"
+L2: .string "9#x"" "19c#y#y;.:10"
+prn #K
+mov L54, r2
+L5: .string "#b90c"
+L6: .data 1 , K , -5
+.string "."".:", "x:ya#a009c"
+L8: .string ""
+L9: mov L0, r2
+L10: .string "", "#acc.1zx"
+L11: mov L1, r2
+L12: .string ""a"
+L13: .string ":"9"
+.string "a;b#.;yzx:0#"
+.entry L36
+.entry L43
+L17: .string "1#a:z0"
+.string ":9bzx1"
+L19: .string ""1c"
+L20: .string "a:" "9.1.yabyxz"
+.string ".x"
+.string ""
+.string "x:yy9z"
+L24: .string "."
+L25: .string "yb##b#xxca" "#z#:z.by:b:#"
+.string "zb::zy"
+.string "c9#.c"
+L28: .string "#0."
+L29: .string "99;"ax", "1.z"
+.string "y9."
+prn #K
+.string ":y#a:b""
+L33: .string ";.;:z0;;ybx"
+L34: prn #K
+L35: .data 1 , K , -5
+.string "zc91cbzcaa90"
+.string "0.0#x#:;;:"
+.string ".y.a"
+.string "#"
+L40: .string "9"#:#c1."
+.string "#xx#zxy;x#", "czy9by"
+L42: .data 1 , K , -5
+.string "b:"
+L44: prn #K
+L45: .string "ay09"
+L46: .string "bx.zcc" "x;"aa"."
+L47: mov L33, r2
+L48: .string "9by"yxa.bz"
+.string "bzx:"", "xxc0cayy:z1;"
+prn #K
+.string ":z#z" "9ca"..x;x1"
+L52: mov L41, r2
+L53: .string ""
+.string "x9.;cca0z0"
+L55: .string "11::y"
+L56: .string "a.b#9a"
+L57: .string ".#9.yaza.zc", "x:a1zyy"
+L58: .data 1 , K , -5
+.string ""
+ hlt
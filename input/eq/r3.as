@@ -0,0 +1,62 @@
+.define K = 3
+L0: .string ";1:;b"
+L1: .string "xx.19"91", "x:"
+L2: .string "", "c"
+L3: .string "" "1;.0"
+L4: .string ";1czbac1xy:0", "09"0"
+L5: .string "z:a" ":.c."z9;;"
+.data 1 , K , -5
+L7: .string "b", "1bz#b0cay0"
+.entry L39
+L9: mov L37, r2
+.string "9xay"
+L11: .string "0y;"
+.data 1 , K , -5
+L13: .string ""0"
+.entry L55
+L15: .string "#9y0:..xy" "9y9z"
+L16: .string ""
+L17: .string ":z1z:z;.y." "a:azy:1y;"
+L18: .string "z";yy#0b#"a;"
+L19: .string "#yxzc:0:.b"
+L20: .string "1#""
+.string ";1y"
+L22: .string "z#""
+L23: .string "":b#;z;c0y9#"
+.string "0;0a"
+L25: .string "909.xa.1""
+mov L34, r2
+L27: .string """
+.string ""
+L29: prn #K
+.string ";aa1.b"
+.string "90a;bzcy"
+.string "" "b9""
+L33: .string "c"a1:;"0a#yx"
+L34: .string "z#"a"a#" "a"
+.string "9", "czbz0"
+L36: .string "z0b" ""
+L37: .string "az"
+L38: .data 1 , K , -5
+L39: .data 1 , K , -5
+.entry L40
+.string ".01axx"
+L42: .data 1 , K , -5
+L43: .string ""
+.string ""yb1.b".:"9#"
+L45: .string "b#;.a1cx"
+L46: .string ":"
+L47: .string "a"
+.data 1 , K , -5
+L49: .string "ba#;99.xb9.b", ""
+.entry L4
+L51: .string "1;."
+L52: .string "z90b09"
+.string "0.", ":9:1c:0cc"
+mov L33, r2
+L55: .string "cy", ";9"
+.string "y:."0;";;yxy"
+L57: .string ";z"
+.string ".1.;x1"
+.string "", "b"0#.a1xx:."
+ hlt
@@ -0,0 +1,62 @@
+.define K = 3
+L0: .string "" "ya0"
+L1: .string ""
+L2: .string "c", "90":z9b0a"
+L3: .string ";b:y:9" ";"
+.string "y9bc"
+.string ".9yc9:"
+L6: .data 1 , K , -5
+.entry L33
+L8: .string "b11y1y;y.:"
+L9: .string "0:xx"
+.string "y90::0y##", "1zy9c.cy9za"
+L11: .string ""
+.string "#":9a.1:ac"", ""zy1"9cc""
+.string ""ax0;" ""
+.string "x#y#y#"
+L15: .string ""
+L16: .string "#1;.cbx"
+L17: .string ".bb0bcc"
+.string ";c#"#".z99"
+L19: .string "x.;" "c1"
+L20: .string "cxcy0xya", ".ya"0""
+L21: mov L6, r2
+.string "b1bxa9:1"
+L23: .string "1"
+L24: .string "z"
+.string "1:10bx.bca;;"
+.string "a;1."
+.data 1 , K , -5
+L28: .string "a"#::b;#"
+L29: .string "yb"
+.string ";zz0ba;""
+L31: .string ":z#0:c9"
+.entry L23
+L33: .data 1 , K , -5
+.string "c"
+.string ":x#;c"c"
+L36: .string "bz9a#"#xa9a"
+L37: .string "c##""
+.string "caxz1"
+L39: mov L58, r2
+L40: .data 1 , K , -5
+L41: .string "x:z.:"";9"
+L42: .string ";y0"
+.entry L1
+L44: .string "111;c;#;yb1"
+L45: .string "ba"
+L46: .string ""xa#c9ab1c"
+L47: .string "zc.0"
+L48: .string "yy1zzc", "#0xc"
+.string "#z:""0"
+mov L28, r2
+.data 1 , K , -5
+L52: .data 1 , K , -5
+.string "0"
+L54: .data 1 , K , -5
+.string "x##yzb", "0#:0".a""
+L56: .string "ca.0xb" "z.c1z9;:z0a0"
+L57: .data 1 , K , -5
+.string ".a.:bxx;.b"
+.string "#z9":x""bz9"
+ hlt
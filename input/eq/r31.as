@@ -0,0 +1,62 @@
+.define K = 3
+L0: .string "c:acb9"
+L1: mov L47, r2
+L2: .string "9.1"
+L3: .string "a"
+.entry L13
+L5: .string "x.x"
+L6: .data 1 , K , -5
+L7: .string "xc"
+L8: .string "9"1:#xx#0.z", ""x1ayzyz;0"
+L9: .data 1 , K , -5
+.string "#"
+.entry L59
+.string "c" ";z.b:0yy:"xb"
+L13: prn #K
+L14: mov L7, r2
+.string "bxxzc."c1a"
+L16: mov L23, r2
+L17: .string "a"b1c#.;.", "ay1##1zxab0;"
+L18: .string ";"
+.string "#x""
+L20: .data 1 , K , -5
+L21: .string ""90x9x.;1y." "czb9#"
+L22: .string ";#ca":"
+L23: .string "yx0.y9"
+L24: .string "", ""yy9x0".z"
+L25: .string "xxxzzy.zb#x"
+.string "11:y:c0"
+L27: .string ""aay0y#"
+.entry L19
+.string "x;c"
+L30: .string ":" "az9"
+L31: .string "y#00"
+L32: .string "a";x.x" ":zyb#9"
+L33: .string "c#ayz#"
+L34: .string "9cba1#1"
+L35: .string "a:".:zxcb1"
+L36: .string ";0x0x"
+.data 1 , K , -5
+.string "#0c".#."
+L39: .string "#b1a"
+.string "c:0" "zz0#"
+L41: .string "0zbc:xy"cb"
+.string ":#10"
+L43: .string ""11zc.01" ";zz""
+.string "." """.x99;;#"
+L45: .string ";19z";"
+L46: .string "cc.c19."."
+L47: .string "c1"
+L48: .data 1 , K , -5
+L49: prn #K
+L50: .string ""
+L51: .data 1 , K , -5
+.string "x."
+L53: .string "#b"
+L54: .string "bb", ""
+L55: .string "z"
+L56: .string "0"bb"
+L57: .string "azb9c0y"#."
+L58: .string "1#z900.:c"
+mov L15, r2
+ hlt
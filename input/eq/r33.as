@@ -0,0 +1,62 @@
+.define K = 3
+.string "1:99" ";9z:911y::"
+L1: .string ""
+.entry L52
+prn #K
+.string """ "xb.z"
+L5: .string "zaz9"
+L6: .string "baz":.:9"b" "b"
+L7: .string "x"x::"
+.string "91#"y1ba1" "#zb:"xa9:1.z"
+prn #K
+.string "a.b;.y1", "0y1;#10a"
+.string "bc"
+.string "c#.z"00#z"
+.entry L37
+L14: .data 1 , K , -5
+mov L0, r2
+L16: .string "";b;"
+.entry L38
+.string "a;09:za"c0ab"
+L19: .string ""
+L20: .string "bzzb#.1"ya"
+L21: prn #K
+.string "zz9c.zbz0"
+L23: .string "9"
+L24: .string "9cc#19"
+.string ""
+L26: .string ".yxy;"
+L27: .string ";y.yx#"
+.string "bb"x:"
+L29: .string "a"x:#c"
+L30: mov L56, r2
+mov L31, r2
+L32: .string """.yy."
+L33: .string ":.0#11:0b"
+L34: .string ""
+L35: .string ""0"
+.string "0c;9b#"0"
+.entry L24
+L38: .string "1x9"yc9"
+L39: .string "x0yayc"1y""
+L40: .string "xy1a"xy;0"9"
+L41: .string ""
+.string "":.;";z":y"
+L43: .string "9xa".ya"09zz"
+L44: .string "#yzxa"
+L45: .string "by1ybz0;z." ".y"
+.string "zy#yy"
+L47: .string "b09.;"zc"" ":c0xc:""
+L48: .string "::1"
+.string "cz9"
+L50: .string ".zcyc.:"bb9b", "#c"
+.string "1;x.a.";;9"
+.string "a"1bx"
+L53: .data 1 , K , -5
+.string ".x9#:"
+L55: .string "z"
+L56: prn #K
+L57: mov L13, r2
+L58: .string "1b.;zy0"
+L59: .string "c:yx#" ":"
+ hlt
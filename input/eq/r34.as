@@ -0,0 +1,62 @@
+.define K = 3
+L0: .string "a0z" "0"
+L1: .string "by"
+L2: .string "b#azy.9."
+prn #K
+.string "0zxx" ";c"
+L5: .string ":"b"
+mov L17, r2
+L7: .string "#c0"
+L8: .string "9", "0"1zc1y"
+L9: .string "9b;9"
+L10: .string "#9.#", ";""1bb.az0z"
+L11: .string "z:ya.;:"
+L12: .string "b9yb" "1#cy:.#c"
+.string ""0cb1z;c#cy"
+.string "."";;91a"
+L15: .string "ccb009"
+.string "1x0;.y1", "9;#b:xc.9:y:"
+L17: .string "11"9yx9"
+L18: .string "z"#:y"
+L19: .string "azyc091aab", "";;0"b;y""
+L20: prn #K
+L21: mov L40, r2
+.string ".cax"
+.string "z#xz"b" "cx.xb."
+L24: mov L58, r2
+.string "z9y"
+.entry L10
+L27: .string "y;.9.;#" "xba.cxz"
+L28: prn #K
+L29: .string "##", "b""
+L30: mov L21, r2
+.string "0bz1" "y9b#b0#x;."
+.string ";":bz;yaa.#"
+L33: .string "ax1c", "x;c9#;c0"
+L34: .string "zb.0y";.:#"
+L35: .string "c191"
+.entry L17
+L37: .string "a#x."b9a0";1"
+.string "b"
+.data 1 , K , -5
+L40: .string ".x"ab1y09c"
+mov L39, r2
+L42: .string ".9:b0#9c:x#"
+L43: mov L21, r2
+L44: .string "b:0z0"
+L45: mov L2, r2
+.string ":yb0"1.0"
+L47: .string "z:yx"0"09z"
+L48: .string "#0y"
+mov L10, r2
+.string "x;c"c"
+L51: .string "90a1::1:yzz"
+.string "#09;;cb""x1."
+.string "#::z"
+.string "c#a.c;99a0:#"
+.data 1 , K , -5
+.string "z::#.bxya"
+L57: .string "yz1;"#"
+L58: .string "xcb;1", "a"
+mov L39, r2
+ hlt
@@ -0,0 +1,62 @@
+.define K = 3
+.string "z"cy0y;a.9#" "y:z#.;#bza9a"
+.string ":1aax"
+L2: .string "b1"zbyc;b"
+.string ""1z0;0a"
+.string "9#a""b:z" "b"
+.entry L43
+.string "xx#;"ca:bbb"
+L7: .string ";;a:19""
+L8: prn #K
+.string "a.0"9.;y99cz" "1:bz"
+L10: .string ".1:#0"
+.entry L6
+.string ":9c1b"
+L13: prn #K
+.string "z19.ac"
+L15: .string "##9b.", ".:91#"xcx0xy"
+mov L60, r2
+.string "1b"
+.data 1 , K , -5
+L19: .string "z.0";yx.#" "a9ca1"
+L20: .string ";#.1;a", "0azyac"
+L21: .string "y"
+L22: .string "9bcz9y9#;"
+.entry L45
+L24: prn #K
+L25: mov L7, r2
+L26: .string "a" "xb"0y:"
+L27: .string "y1"
+L28: .string "."
+L29: .string "z""
+L30: .string "axxy9xa9ca""
+.string "#9z9"
+L32: mov L19, r2
+.string "zy";ccyc0"
+L34: .string "b"
+L35: .string "1"czx;a"
+L36: .string ";b10c1.:zyac"
+.string ";:.#"
+L38: .string ".y;a#", "#x#"
+L39: .string "cc#az1yc:"
+L40: .data 1 , K , -5
+L41: .string "yba;1"
+.string "990bx"
+L43: .string "9;b#z#x;9x"."
+L44: prn #K
+L45: .data 1 , K , -5
+prn #K
+L47: prn #K
+.string "::", "byx"
+L49: .data 1 , K , -5
+L50: .string ":01"#0yxb"
+L51: prn #K
+L52: .string "ac"
+L53: .string ":"ca9;"
+.string ";..."00x"
+L55: .string "z;9;y:#acb""
+prn #K
+.string "y0"
+L58: .string "a:."" "xaxb#c91x."
+.data 1 , K , -5
+ hlt
@@ -0,0 +1,62 @@
+.define K = 3
+.string "#yba9:cxy.:0"
+L1: .string ""10z##"
+L2: .string "1.#x9yc1"
+.string "a;"
+L4: .string "x0z#x"1.#y;a", "1:9y1.b""
+L5: .string "."
+.string "a;0z1c9;"
+L7: .string "xx..zc#"
+L8: mov L5, r2
+.string "ya9y"
+L10: .string "", "0"
+L11: .string "z"xc"
+.string "bc"
+L13: .string ""
+.string "x1xzb"
+L15: .string "1"
+L16: .string "c"
+.string "#.zc:ab.;", "b.::"
+L18: .string "1", "aa9:0b00;"
+L19: .string "x.":0.a"
+L20: .string ".10y9c"
+mov L26, r2
+.string ""
+L23: .string "" "c".9."
+L24: .string ""b0xb.y"
+L25: .string "y"z0y"
+L26: .string "#c0b19"
+L27: .string ""
+.string ".#;"
+L29: .string "9;"
+.string "0.:b:0.zc"0y"
+.entry L33
+L32: .data 1 , K , -5
+.string "#;;bbx.:;11"
+L34: .string "y#:zz:xa1:a."
+L35: mov L15, r2
+L36: .string "c.:99;y"
+L37: .string "ya#;x"
+.string "y:bbyb"01yx1"
+L39: mov L6, r2
+.string ";"
+.string ";zyzzbz#c"
+L42: mov L15, r2
+.string "aaa9:"
+L44: .string ":b"
+.entry L12
+.data 1 , K , -5
+mov L55, r2
+.string "1y":"y:;1#z"
+L49: .string "z:b", ""c.zzz;##b9"
+L50: .string ""#""y90;;1z#"
+.string "9"
+L52: .string "9:1""y99xc#"
+L53: .string ""
+L54: mov L6, r2
+L55: .string ".zz.""0"
+L56: .string "1ba9y.09xz;"
+.string "90" "1;";1#0a"0z"
+.string "1#"
+L59: .string "z"
+ hlt
@@ -0,0 +1,62 @@
+.define K = 3
+L0: .data 1 , K , -5
+.data 1 , K , -5
+L2: prn #K
+L3: .data 1 , K , -5
+L4: .string "1;#y0.01c#" ""
+L5: .string ":.0";"
+L6: .data 1 , K , -5
+L7: .string "90b"
+.data 1 , K , -5
+L9: .string ""
+.string "" "..y"
+.string "ayy.x1cxy" ""
+.string ":xb1"
+L13: .string "b;"
+L14: .string "y1a;c9yc" "c0;99:azyb;"
+L15: .string "zbxbyax"
+mov L44, r2
+.string ";a"""
+prn #K
+prn #K
+L20: .string "", "xz#";zx"
+.entry L54
+.string ";;9c:#;"
+L23: .string "ca..z1;"
+.string ".z"
+L25: .string "z"b", "#by1xbabz"
+L26: .string "1#9b:9byx0", ";a0"1#yc"9"
+L27: .string "xbcx111zx#"
+L28: mov L44, r2
+.string "c.cc:"
+L30: prn #K
+L31: .string "ca9:x;y.y9#"
+L32: .string ".01";1:0;9;9"
+mov L14, r2
+.string ":.9b9"
+.string "0zyc1""x.x"
+L36: .data 1 , K , -5
+L37: mov L24, r2
+L38: .string ""bb" "aa;yx"a;1""
+L39: .string "9:#c.#:b0c"
+L40: .string ";.9"#"
+.string "#9"", "z.9:zb:c#099"
+.entry L48
+L43: mov L10, r2
+L44: .string ".c#.axx1" "c11c"
+.string "1yc"b"
+L46: .string ";:#c00c" "xa."
+.string ";b#xbyxzz;1z"
+L48: .string "bbx.ab0", "9"a#"
+L49: mov L42, r2
+L50: .string "z9z..11yy0b"
+L51: mov L56, r2
+L52: .string "1b"
+L53: .string ":azz#0.z0;ac", "ya1":""
+L54: .string "0zb0abc0"
+L55: mov L50, r2
+.string "0#.;1a"c#"b1"
+L57: .string ":#"
+L58: .string ":#:zx0;z"
+.string "9;"
+ hlt
@@ -0,0 +1,62 @@
+.define K = 3
+L0: .data 1 , K , -5
+L1: mov L44, r2
+L2: .string "c;zzy.z;.y"
+L3: .string ";b9", "9xa0z."
+.data 1 , K , -5
+L5: .data 1 , K , -5
+L6: .string "c1bb#0y:cz1"
+.string "0y"
+L8: .string "9.;"
+L9: mov L54, r2
+prn #K
+L11: .string "a"
+.string ";z";ax0c:1:", ";a91#ac0c"
+.entry L43
+L14: mov L2, r2
+L15: .string "a#b1.9:xyyc"
+L16: .string "0ab"
+L17: .string "1;0y.:a#0y0", "1zcx0;."
+mov L59, r2
+.string "xx;ybc;bza01"
+L20: .string ":xx" "bc"9"
+.string ":"
+.string "zyzy:#"
+L23: .string "#;1xc;.z9""
+.string "yyx0", "#"
+L25: .string ";c9y"
+L26: .string "#."b"
+.string ""
+.string "0:::x0accc"
+prn #K
+L30: .string "c"
+.entry L40
+.string ".9a"19." ""
+.string "c;:9ayy##"
+L34: .string "b"
+L35: .string "1b#yxx;c;", "0;:"
+.string "", "z0cc"
+.string "9az#"
+.string "z#xbbazccaz:", ";:"
+L39: .string "9a"
+L40: .string ""
+L41: .string "1#"
+.string "cb00#:c"
+mov L39, r2
+.string "" "acz;x;z1"1""
+L45: .data 1 , K , -5
+L46: .string ":;;#b.", "9"
+L47: mov L2, r2
+L48: .string "1#y1a" ""c"
+mov L23, r2
+L50: .string ":z.9"
+L51: .string "#."#yya:b:1"
+L52: .string "9;:0xyz:"::"
+L53: .string "x9c"
+.string "y"x" "xz#"
+.string "" "c"a;ab"
+.string "1bz:#1"
+L57: .data 1 , K , -5
+mov L28, r2
+.string "c";0;9"9", "c:".;z"
+ hlt
@@ -0,0 +1,62 @@
+.define K = 3
+L0: .string "x0."
+L1: .data 1 , K , -5
+L2: .string ""
+.entry L0
+L4: .string "#b"09;yy.b10"
+L5: .string ""a:x;;1;#:0"
+.string ":z1c90", ":#yx"
+mov L25, r2
+prn #K
+.string "0"
+mov L0, r2
+.entry L41
+L12: .string "9;xb91:x9#""
+.entry L8
+.string "z9y"."x" ""#;"
+L15: .string "cabx", "ab:"
+.string "1"zy:xcz", "b"b1bya9"
+L17: .string "1cz"c:x1"."
+.string "#a"1x"
+L19: .string ";by"x#a9"
+.string "0x.b;" ""
+.string "#yy;b1#;a"" ":z"
+L22: .string "y91b"
+prn #K
+L24: .string ":cy"
+.string "y:..1xz#c" ".czzx1zz."
+L26: mov L1, r2
+.entry L55
+L28: .string "a11x1;"
+.string "z9:"b;zy"
+.string "y#:"9"
+L31: .string "x1x1", "c"
+L32: .string "xz:.z11"
+mov L47, r2
+mov L6, r2
+.entry L15
+prn #K
+.string ":z;z1bxybc"
+L38: .string "a":.z;y9y;a"
+L39: .string "1.xc"a190a:"
+L40: mov L0, r2
+L41: .string "", "acy9;z11aa#a"
+mov L58, r2
+L43: .string "yybx.a#""
+L44: .data 1 , K , -5
+prn #K
+L46: .string "b9.0"yzz"
+.entry L39
+.string "#.z0"
+.string "9"
+L50: .string "z""b9.y:9xa"
+.string ".#b;x0bxy9x" "x0:"."
+L52: .string "1"" "y"
+L53: .string "9a.00y9"
+L54: .string "z9yya", "#"acyx1yxy"
+L55: .string "xycyc"#""9:"
+.string "1;ac"
+L57: .string "9.ax0;.::"
+L58: .string "x:;"
+L59: mov L55, r2
+ hlt
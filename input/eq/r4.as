@@ -0,0 +1,62 @@
+.define K = 3
+L0: .string "1cbba0"
+.string ""
+L2: .string ""b" ""
+prn #K
+L4: .string "".""zb";z:"
+L5: .string "b""9"
+L6: .string "y"#9x00;y01"
+.string ""
+.string "9:1.zc:x"
+.string "ycz0.;z", "zb""
+.string ""xbzcy1aa"
+.string ".:za"
+L12: .string "0"";:"by;x"
+L13: .string "cz;aza1cz"
+L14: .string "1"
+L15: .string ""
+L16: mov L9, r2
+L17: .data 1 , K , -5
+L18: .string "" "y#0:x1xx"
+L19: .string "x:0"x1x"
+L20: .string "#x0"
+L21: .string ";b;0:"
+mov L31, r2
+L23: .string "czy:1#:z""
+.string "yz01b"y::xa0"
+.string ""a"c.:1;1."
+.string "ca;"
+.string "0x9axc:;z"9#"
+L28: .string "a", "1"
+.string ""
+L30: mov L0, r2
+L31: .string "b"
+L32: .string "0x#1"
+L33: .string "#z900".#1"
+.entry L19
+L35: .string "#", ""cc.c"
+.entry L57
+L37: .string "yb9b1#.;19"
+.string "x#c":"
+.string "1#;y"9#1"
+L40: .string ";z:zc0b;c:#;"
+L41: .string "#z:;bb0:c", "zcya;"
+.string "z#"bcc;1:;b#", "c"
+.data 1 , K , -5
+.data 1 , K , -5
+.string ";x1.xy"
+L46: mov L33, r2
+.string "90"zy1", ""
+.entry L35
+L49: .data 1 , K , -5
+.string "9b", "z;#yb#y1x:"
+.entry L9
+L52: .string "ac", ":;9.9ya9x"
+L53: .string "bbya:"
+.entry L46
+L55: .string ".."
+L56: .string "c90cx"y1"
+L57: .string "909:"
+L58: .string ""
+.string ""
+ hlt
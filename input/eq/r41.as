@@ -0,0 +1,62 @@
+.define K = 3
+L0: .string "0;"
+L1: .string "#;a#x:"a1cc"
+L2: .string ";;ab#;a0"y""
+L3: .string "c9:abbc"
+L4: .string "x;a;;", ""ay0cb:b0a::"
+L5: .string "b1"
+L6: .string "9aa:"
+.string "a.":""#"b:."
+.entry L47
+L9: .string ""bxx0z.1:"
+L10: mov L42, r2
+L11: .string "xy0.z#;0#y"
+L12: mov L10, r2
+L13: .string ":xbx9;;"
+L14: .string ".b"1;..x9#"
+.string "ac;.c", "9:c0.#ba"
+L16: .string "0yycy"0;x"" "y;;0y0#1."x"
+L17: .string "c1ybx11"
+L18: prn #K
+prn #K
+L20: mov L48, r2
+L21: .data 1 , K , -5
+.string "c0"axc";9"
+L23: .string "ax""y;"
+mov L24, r2
+L25: mov L20, r2
+.string "b;9.axz" "b#:#""1"
+L27: .string "b9"z:1#.z9#c"
+L28: .string "cycbb"a"
+L29: .string "", """.bac"
+.string "yzc#"1#9#01:"
+L31: .data 1 , K , -5
+.string "#"a"
+L33: .string "zyyy"yyybb" "yc099#.az"
+.string ";:10:x"
+L35: .string "ac10."
+.string ";a".b:01:b9." ".b"#."#ab:;y"
+L37: .string ""
+mov L59, r2
+.string "00z1xz.;", ".9c:.yxc"
+.data 1 , K , -5
+.string "9xc"
+L42: .data 1 , K , -5
+.entry L20
+prn #K
+.string "cz"
+L46: mov L4, r2
+.string "z:cbxyzxbcyb" "bc.1x9xy1xy"
+L48: .string "11z#0" "cba1"
+L49: .string "1""
+L50: .string "b"
+.string "xa9:;"
+mov L37, r2
+L53: .string "91x.b;0c0:c"
+.string "xx0"z"0x."
+L55: .string ""
+L56: prn #K
+.entry L43
+L58: .data 1 , K , -5
+L59: mov L25, r2
+ hlt
@@ -0,0 +1,62 @@
+.define K = 3
+L0: .data 1 , K , -5
+L1: .string "b:.9b;0aabx"
+L2: .data 1 , K , -5
+mov L26, r2
+L4: .string ""a##c.0zycx#"
+L5: .string ";y#a."
+.string "9"
+.data 1 , K , -5
+L8: .string "a"
+mov L54, r2
+L10: .string "1:"z"
+.string "::b;:c9.xc1"
+.string "x:z"##ax", "z0ybx;.zx:10"
+L13: .data 1 , K , -5
+.string "y.;0;0zx"
+L15: .string "a"bc:c#:0;b0"
+L16: .string ""a:.b:9#", "zby0c1a..y"
+L17: mov L6, r2
+.entry L40
+L19: .string "#c9#9" "z1abz"#yx"
+.entry L5
+mov L48, r2
+L22: .string "19cy9";0x9" "x.y0::z191b"
+L23: .string "x;xab.:a"
+.string "9", "1x9c.;;1x#"
+L25: .string "0z001".a::"
+L26: .string "#"bxx"
+L27: .string "1x"b"
+.entry L3
+L29: .data 1 , K , -5
+L30: .string ""xc011x"0ac0"
+.string "1y0..#9:.1cx"
+L32: .string "a.zaa;19", "ca9b"cb;"
+.entry L60
+.entry L38
+L35: .string ";;9zyx:.zx"
+.string "z#ba1;;"
+L37: .string "czbx"
+.string "y;#:9a:"9y:"
+.entry L56
+L40: .string "y;x."
+.data 1 , K , -5
+L42: .string "" ""yaaz#"
+L43: .string "9.09abb", "c9a"z;9c0ca"
+.entry L55
+L45: .string "x:bz#9"0;."
+.string "#c0ac.z#0#:"", "yc#"
+L47: .string "xx"1zy""
+L48: .string "0zy"
+L49: .string "90:"9zabyc", "ab;0"
+L50: mov L32, r2
+.string "ya."
+.string "...:xz0b:z" ""b.y9y:0z0"
+L53: .string "0:.c;;y09"" "x0#;"
+L54: .string "x91##.c:by"
+L55: .data 1 , K , -5
+prn #K
+L57: .data 1 , K , -5
+L58: .string "1;""
+.string "x..010xc:"
+ hlt
@@ -0,0 +1,62 @@
+.define K = 3
+.string "1z"
+L1: mov L31, r2
+L2: .data 1 , K , -5
+.string "#00ca"b"" "bc"
+.string "9y;c0ba;a"
+L5: .string "b9;b"
+prn #K
+L7: .data 1 , K , -5
+L8: prn #K
+.data 1 , K , -5
+.string "cc"b#za"
+.string ";b9:by1#.z"
+.string "#bzc:b":."
+L13: prn #K
+L14: .string "" "#"
+.string ""#zb.91y#.1""
+L16: .string "", "":0"
+L17: .string ";0#z0zac9", "..a"
+L18: .string "#x0", "xa19ab"
+.string "9"9b;zyx" "0cxab.xb;;0x"
+L20: .string "z"
+L21: .string ".x" ""
+.string "#b1.zczxa."
+L23: .string ":1y.11y#.", ";0.09";b"
+.string ";.", "#"
+.data 1 , K , -5
+.entry L12
+.data 1 , K , -5
+L28: .string "10ybz11" "cb#zzzz"
+.string "y"#xx"
+L30: .string "x";y9:"
+.string "cxcc.:;9..xy"
+L32: .string ""b"."
+.string "9#yb"
+L34: .data 1 , K , -5
+L35: .string "919:ba:"
+L36: .string ":"
+L37: .string "901cczabyz"
+L38: .string "ca:zx"
+L39: .string ""
+.string ";xx"
+.string "y"
+L42: .data 1 , K , -5
+.entry L43
+L44: .string "c#c:.z1#;"
+.data 1 , K , -5
+L46: .data 1 , K , -5
+L47: .string ":"1"a9" "1a"
+.string "1"
+L49: .string ".:9""
+.string ""
+L51: .string "a9"
+.data 1 , K , -5
+L53: .string ":b990#9az.;"
+L54: .string ""
+L55: mov L0, r2
+L56: .string ""9ya"
+L57: .string "0y#y#zbza#"
+L58: .string ";1yb1" "b1"
+L59: .string ".yy1:0bzz"
+ hlt
@@ -0,0 +1,62 @@
+.define K = 3
+L0: .string "c"
+L1: .string "abc#9.y.:"
+.string "zbz"y"
+L3: .string "y"
+.string "az0b"
+L5: .string ".x#a", "0.a....":#"
+prn #K
+L7: .string "11#" ";"".a"
+.string "#;:99yz;x"
+L9: .string ";.a"
+mov L30, r2
+L11: .string "."a;:y:byb"
+.string ":x"""ay1yb"
+mov L21, r2
+L14: .string "1y00" "bzycc:c"
+.string "by;#cy."
+L16: prn #K
+L17: mov L4, r2
+.string "c1ycx;z9bzz" "ab"
+.string "#00;:.:91xx"
+.string "ya9.x"
+L21: .string "b"
+L22: .string "0cy"" ";.bz9;z:;""
+L23: .string "acb"
+.string "c0.y0"zx;ycy"
+.string "c1cy111y#y"
+.entry L24
+L27: .string "y;xy"x1:#cz"
+L28: .string ""
+.string "a" "yac#:x::"
+mov L21, r2
+.string ";ayc:x#;z"
+L32: .string ""
+.string "y"
+L34: .string "9az"
+L35: mov L35, r2
+L36: mov L53, r2
+L37: .data 1 , K , -5
+L38: .string "91aaa0a".9:" ";#x:;;909.a0"
+L39: prn #K
+L40: .string "9", "9#cxbyyyx#"
+L41: .string "0.9azx0a" "0ca0xxx"
+L42: .string "a0z1:"
+L43: .string ""
+L44: .string "y"
+L45: mov L38, r2
+L46: .string "" "1yx"
+.entry L10
+L48: .string "0"
+.string ";"x" "1y;"
+L50: .string ""9;0z9azyb", "b9z9a#09::1z"
+.string "1.:0"
+L52: .string "0:.ya"
+L53: .data 1 , K , -5
+.string "aa"c", "y09b"y"
+L55: .string "101#9:xxz.", ""#acz."
+L56: .string "#x;"0ya.9"
+.string ";1"
+.data 1 , K , -5
+.string ""
+ hlt
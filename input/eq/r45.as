@@ -0,0 +1,62 @@
+.define K = 3
+L0: .string "y"
+L1: .string "#by""
+.string "y#"
+.string ".0b;0c.aaczy"
+L4: mov L26, r2
+.string "#0..9"
+.entry L51
+L7: mov L42, r2
+.string "zc:"
+.string "yx00"0"
+L10: .string "a9;a;""
+.data 1 , K , -5
+L12: .string ""
+.string "a"
+L14: .string "11xz" "::9"
+L15: .string ""
+L16: .string ";x"
+.entry L8
+.string "b:", ".1""0:"y0#00"
+L19: .string ";:".0" "1;x"0"
+L20: .string ";a"":"" "#;:ax;xxaa"
+L21: mov L18, r2
+prn #K
+prn #K
+L24: .string "0:1.0;a0x"0a"
+L25: .string "c0zxa0z.", ";"
+mov L51, r2
+.string "c:##xb.ac:"
+.data 1 , K , -5
+.string ";.z0;#y0x" "b"
+L30: prn #K
+L31: .string ":#9yyy""
+L32: .string "9yx.b#c"
+.string "1bb;90zx9z"c"
+mov L31, r2
+.data 1 , K , -5
+L36: .string ";:az"
+L37: prn #K
+L38: mov L45, r2
+L39: .string ""
+.string "9y"
+.string "99##;cz;;y", ""c"
+L42: prn #K
+mov L17, r2
+L44: .string "z##c;1"
+L45: .string "..0c1bybybyy"
+L46: .string "c:"yaab."
+.string "0c99;yz1:"
+.string "119"b:"
+.entry L21
+.string "z0."
+L51: .string ".cac1#:.y1"
+L52: .data 1 , K , -5
+L53: .string "#"#"
+L54: .data 1 , K , -5
+L55: .string ";09"
+.string "y:y#"
+L57: prn #K
+L58: .string "19azx":##z" "#bx1"
+L59: mov L43, r2
+ hlt
@@ -0,0 +1,62 @@
+.define K = 3
+.entry L37
+.string "9c;9#aab#z" ""
+.string "z.#b0.1z"
+L3: .string ".9;b0xz91#."
+L4: .string ";"
+.entry L19
+.string ";"
+.data 1 , K , -5
+L8: .data 1 , K , -5
+L9: .string "cz9#:;:;"
+L10: mov L25, r2
+.string ";a"
+.entry L25
+.string "" "ax#xzbb01:c"
+.string ".:10"
+L15: .string "0c0a"
+L16: .string "y:;.""
+L17: .string "y01", "axa;z":0"
+.string "1a.#zy:0"
+L19: .string "c", ";.xazyc:a"
+.string "b;x#9b" ":a0:cxaz;c."
+.string "bczx"
+.string ".";::b1;1"
+.string "1#:090" ";#bx0cc#:b#"
+L24: .string "bx;zb"9ac#"
+L25: .string "0#1cxzy0z"
+.string ":ax:#"
+prn #K
+.string "c"
+L29: .string "#"" ""x"
+mov L7, r2
+L31: .string "x.";"
+L32: .data 1 , K , -5
+L33: .string """, "bx0cb"
+.entry L2
+mov L18, r2
+L36: .string "#.yba.czy0a"
+.data 1 , K , -5
+L38: .string "0""99"0y1;y"
+L39: .string "#"
+.string ""acyya;az0x;"
+L41: .string "c"::0:z0c"
+L42: .string "":"
+mov L21, r2
+L44: mov L11, r2
+.string ".;cczc"
+L46: .string "#90x99:"
+L47: .string "1;z09y"
+L48: .string "1z;#0b;0#"
+.string ":#0"
+.string "" "1#"c"xc;"
+.entry L12
+L52: mov L7, r2
+L53: .string "z0.c;0yx.:z" ".bxy"9#x#c#""
+L54: .string "#1"", "za:0zaz"
+L55: mov L59, r2
+L56: prn #K
+L57: .string "#1"
+L58: .string "xa"
+.string "z#y#b"#9.z.y"
+ hlt
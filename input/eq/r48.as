@@ -0,0 +1,62 @@
+.define K = 3
+L0: .string "9y#9x.#0cc#" "1"
+L1: .string "c1xab0bc"
+L2: .string "9yz.zb"xyy:"
+.entry L40
+.string "x0"
+prn #K
+L6: .string "y;1.b#bxc"
+.string "0b#a#z00za#;"
+L8: .data 1 , K , -5
+L9: .data 1 , K , -5
+L10: .string "x":;cxccy":"
+L11: mov L33, r2
+.string "0#:."a19y" "a"
+.string "b:#";"
+.entry L59
+L15: .string "cx#b":;"
+.entry L25
+L17: .string ";a.z", ":0b.x1"
+mov L4, r2
+L19: .string ";bc"
+.string ":0#ab;;b0"
+L21: .string "c"bc"bb#0"
+L22: .string "10:y#" "ca:"
+L23: .string "ac0"
+.string ""
+mov L10, r2
+.string "c9#9x:#a"
+.string "baxab", "x0"
+.string ""b"
+L29: .data 1 , K , -5
+mov L26, r2
+.string "b;"9ycx.z0"
+.string "#z""x" "#1"
+mov L47, r2
+.string ":y0"bx#y;1" "#9#y1b0by;y"
+prn #K
+L36: prn #K
+prn #K
+.entry L41
+L39: .string ""b.a9:"
+mov L26, r2
+.entry L59
+L42: .string ":#cz"
+L43: .string "9:a"
+.string "y.0.zzc9a"
+prn #K
+.entry L29
+.string "xxa0", "b#1;.."
+prn #K
+L49: .string "b;a"zb", "#b1yba#"
+L50: .string "bz1.0;1bcb."
+L51: .data 1 , K , -5
+L52: .string ""
+.data 1 , K , -5
+L54: .string "y1;b;.1b#x", "x99z"
+L55: .string ""
+.string """
+L57: .string "9xacby.z:0" ""
+L58: mov L37, r2
+L59: .string "xa1xba"
+ hlt
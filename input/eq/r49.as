@@ -0,0 +1,62 @@
+.define K = 3
+L0: .string "z"
+L1: .string "" "c1.a"
+.string "y;z0ax.cb" "z#zy:0"
+L3: .data 1 , K , -5
+L4: .string "x:#b;y9;9"
+L5: .string ";0;1"
+L6: .string ".9a9caxb""yb"
+mov L3, r2
+L8: .string "1"
+.string "y1"
+.string ""1:b:;b"
+L11: .string ";"a:czzb"
+L12: mov L16, r2
+mov L5, r2
+.string "::9.c1:b#;1"
+.string ";ay9bz" "0.:99"
+L16: mov L14, r2
+L17: .string "y##9a0."
+.string "x""a1;c" "y;"
+L19: .string "zxab"
+L20: mov L5, r2
+.string ".yyx11:y" ""
+.data 1 , K , -5
+.data 1 , K , -5
+L24: .string "."
+.string "#:xa"."
+L26: .string "c:z"9bxbbb1b" "z11"
+L27: mov L3, r2
+L28: .string "#"
+L29: .string "...#ca.:a#"
+mov L10, r2
+L31: .string "c"", ""
+.string "yx;:0yax;1;a"
+.entry L6
+L34: .string "00b"
+L35: .string "a9acbyz9ax:", ":1a1by.""
+L36: .string ":0199zz"
+.string "yby"
+.entry L14
+L39: .string "a.#::9zx"
+L40: .string "cbz."
+L41: .string "c9x9#x"" "x9;"
+L42: .string "#b#y"
+.entry L21
+.string "by.09"
+L45: mov L47, r2
+prn #K
+L47: .data 1 , K , -5
+L48: .string "y#."
+L49: .string ";1y#;#":yx:" "0"
+L50: prn #K
+L51: .string "ab0:0.z"
+L52: .data 1 , K , -5
+.string ";9zyy:#a".;"
+.string """x0.0#"
+L55: .string "xyab##c"cy0:"
+L56: .string ";:z9c#zz1"
+L57: prn #K
+prn #K
+L59: .string "c.9.:9ac"
+ hlt
@@ -0,0 +1,62 @@
+.define K = 3
+.data 1 , K , -5
+mov L47, r2
+L2: .data 1 , K , -5
+prn #K
+L4: .string "bz"
+L5: .string "xa.x0yc"#"
+L6: mov L39, r2
+L7: .data 1 , K , -5
+.string "#xc"
+.string "::xc.x0y"
+.string "bzy""
+.string "byz"y"
+L12: .string "caya.z"0a9#"
+.string "a.c;xb#"
+L14: prn #K
+.string "#1b;" "z"ya0bxz9;zc"
+L16: .string ":zyc", "c..y1c.ab;"
+L17: .string "z"y1:0ca:"
+.string ".;"
+.data 1 , K , -5
+L20: .string "a""
+.string ""c911..z1"
+.string "0"
+L23: .string ""zcb1y9" "zb###z.;"
+L24: mov L45, r2
+.data 1 , K , -5
+.string "yz:c;"a19#y"
+L27: .string "::#zzy:z"
+L28: prn #K
+prn #K
+.data 1 , K , -5
+L31: .string "cx"z"1y.", ".0c;#;9:0y"
+mov L46, r2
+L33: .string "1;:cx#:c:", "xcacbzc"
+L34: .string "0:;b;" "zaz0y"0"b.""
+L35: .string "by99", "yz"c00";:"
+L36: .string ";1xc;b"
+.entry L6
+.string "cz:;000x"
+.string ""c;;y."
+L40: .string "y1yc1"
+.data 1 , K , -5
+L42: .string ""0"
+L43: .string "#ax1y"c" "y1;1"
+.entry L57
+.string "y9.z"
+L46: mov L22, r2
+.string "caay91:b:"
+.string ";;..::"
+L49: .string ":".xy1", "y"
+L50: .data 1 , K , -5
+.string "cc1."
+L52: .string "0;"
+.string ""b#b"
+.string "0"
+.string ";:""
+L56: mov L18, r2
+L57: mov L11, r2
+L58: .data 1 , K , -5
+.string ""
+ hlt
@@ -0,0 +1,62 @@
+.define K = 3
+L0: .string "x""
+L1: prn #K
+.entry L29
+L3: mov L40, r2
+.string "y0.a"b"
+L5: .string "z;"
+.string ":x##a1"c1aab"
+prn #K
+L8: .string "a:00xzb" "#c;z11b9"
+.data 1 , K , -5
+prn #K
+.string ""9b9#"y9"1", ""
+.string "09"yx.1;1" "az1y9:;1"
+.string "y1#c" "#cby1."
+.data 1 , K , -5
+L15: mov L32, r2
+mov L37, r2
+mov L46, r2
+L18: .string "#.yc#:#00""
+L19: .string ":z9109.;z1"
+L20: .string "#0y"
+L21: mov L3, r2
+L22: .string "#ay1b" "9#9cz"yb.19"
+.string "c.##b;"
+L24: mov L33, r2
+.data 1 , K , -5
+.string "1:cc"9900"
+.string "0b9aby9", ""c:"
+L28: prn #K
+L29: mov L14, r2
+mov L31, r2
+.string "9xc#0x9"
+.string """
+L33: prn #K
+L34: .string "ybc9"
+L35: mov L0, r2
+L36: .string "zbb#":#9.0ya"
+L37: prn #K
+L38: .string "" "za.9a0:"
+.string "#b;#01a"
+prn #K
+L41: .string "cc11:##b"
+L42: mov L39, r2
+.entry L7
+L44: .string ".1xz"
+mov L29, r2
+L46: .data 1 , K , -5
+.string "c"a"z."
+.string "#:xx0", ":#z:.yayxa"
+.string "b;1ya1x;"
+.data 1 , K , -5
+L51: prn #K
+L52: .string "zxa#.19""a"
+.string "ya9""
+L54: .string "0".:"
+L55: .string ""x"
+L56: .string "xb;y"9c:0y""
+L57: .string """, "#y:.zy1"
+L58: .string ""#"1y."
+.string "z:9"
+ hlt
@@ -0,0 +1,62 @@
+.define K = 3
+L0: .string "91"z0acc#0"", "1:aa9"
+L1: .string "1x"
+L2: .string """
+L3: .data 1 , K , -5
+L4: .string "9cc09"
+L5: mov L20, r2
+.string ";:.0;axax:.9"
+.string "cbc:;xyx9;0b"
+mov L9, r2
+.string "";1" "#x"
+prn #K
+L11: .string "xb::"ca.;a", "0"
+L12: .string ".;09":acy1a" "#c"
+.data 1 , K , -5
+L14: .string "x"cb"
+L15: .string ":", "x9z"
+.entry L10
+L17: .data 1 , K , -5
+.string ""
+.string "z#0:"
+L20: .string ".1y:b9a.b"
+.string ".y;ay#"y"9c"
+L22: .string ":"
+.string "ab"
+mov L16, r2
+mov L18, r2
+.string "1" ""
+L27: mov L21, r2
+.string "xacb:.10.cc0"
+L29: .string "1:1#.b"
+prn #K
+.string "#x:0b0", ";y.9"
+.string "0#":0"
+L33: .data 1 , K , -5
+L34: mov L50, r2
+L35: .string "1czx0"#"
+L36: .data 1 , K , -5
+L37: .string "z00a;x0yc#1c"
+L38: .data 1 , K , -5
+L39: .string "bbxy0x9", ";;:"
+.entry L37
+mov L39, r2
+L42: .string "0.:cc.:0"
+L43: .string ":;z0:"a;xy"
+L44: mov L40, r2
+L45: mov L21, r2
+L46: .string "yy0z;#0"" "bx:zc:.z"
+L47: .string "a0" "09b1ccccya0"
+L48: .string "zz#z:1#"
+.data 1 , K , -5
+L50: mov L48, r2
+L51: .string ""
+.string "b"."
+L53: prn #K
+L54: .string "x:1z9."b0#9"
+.entry L37
+.string "" "c1"z1y;zx;"
+.string "a."
+L58: .string "c"9yx"
+mov L14, r2
+ hlt
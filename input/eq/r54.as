@@ -0,0 +1,62 @@
+.define K = 3
+L0: .string "y110x1z;", ".xa"
+L1: mov L5, r2
+L2: .string "y9cb:y" ";a0:azy"
+L3: mov L58, r2
+L4: mov L15, r2
+L5: .string "10;", "xx:;a:1"
+prn #K
+L7: .string "9a""1"
+L8: prn #K
+.string "a"
+L10: .string "#1"
+L11: .string "###ab;z0000c" "10".;"
+L12: .string "#"y;:c0"
+L13: mov L32, r2
+.string ".yb1" "x"
+.string "9yc"
+L16: .data 1 , K , -5
+L17: .string "y;b9"."
+.string ""11z"
+L19: prn #K
+.entry L56
+L21: .string "#;a0:;x"
+L22: .string "0a0"
+.entry L56
+L24: .string "x0z:.abc#yb1"
+L25: mov L35, r2
+L26: .string "#"
+L27: mov L38, r2
+L28: .string ""
+.string "9cz1zc";"
+.string "yb0a#10y""
+L31: prn #K
+L32: .string "yzbyz;yzz0y"
+L33: .string "0c"
+.string "b0" ".b1:b9;cb"
+L35: .string ""
+L36: mov L27, r2
+L37: .string "b"y;#x"xyb", "#"
+L38: .string ""1:" "."c01;"
+L39: .string ""xb"
+.string ";.z;:", ""0b"y0c9"
+L41: .string "#1"
+L42: .string "9yc""
+.string "", ".0bc;1yz#"
+.string "x"0b:"
+L45: .string "x"
+L46: prn #K
+L47: .string "0zaax"a1b"
+.string ";a:;aayy;#"
+L49: .string "z0"z9a;ybz.;" "9:#.;c"#xza"
+.entry L8
+L51: .data 1 , K , -5
+.string "a"1a"0":c9"", "c0"
+.string ""
+.string "#:#9";:"
+L55: .string "1"";b" ";z.9"z"z#"
+L56: .string "01z"
+L57: mov L18, r2
+prn #K
+L59: .string ".#9#"
+ hlt
@@ -0,0 +1,62 @@
+.define K = 3
+.string ".y"
+L1: mov L22, r2
+.string "190090z.09", ""
+L3: .string "a;1"xa0xb9:"
+.string "cyz"ab"
+L5: .string "xx1c"cxy9"
+.string ".0"1;;.b0":"
+.string "yyzycb;0#11"
+L8: .string "y"
+L9: .string ":y" "#:."
+L10: prn #K
+.string ""
+L12: mov L20, r2
+L13: .string "0y:1x:"x"
+.string "1;:1a"
+L15: .string "yc1x::0b"
+.string "9a.:x1#;1;#x"
+L17: .string "0"
+.string "ba"#c" ""
+L19: .string "".y.".za"::9" ".x.a91ba"
+L20: .data 1 , K , -5
+.string "xycc";#;.y9"
+.string ".b019azb", "b:;a:".yb"
+.string "1"
+L24: mov L5, r2
+L25: .string "9c#10az#0.bb", ";";;b1y"."
+mov L54, r2
+L27: .string "", "z1"
+.string ".1;9"
+L29: .string "", ""z:1yy;y."
+L30: .string "xb.;bcza1099"
+L31: .data 1 , K , -5
+mov L53, r2
+prn #K
+L34: .string ""
+L35: .string "1azxxx9xz19"
+L36: .string ""
+L37: .string "xa.yyya0y", ".;::#cy"z"
+L38: .string "1"
+.string "#z"
+.string "9##""y"
+L41: mov L16, r2
+.string "yyb.;z9x.z"
+.string "y.zx"
+.string "9"
+mov L26, r2
+L46: .string ".yz;0##1z"
+L47: .string ";..zb:9x01a1"
+L48: .string "a;xbzxb;:"
+.string "..z"
+L50: .string ".9"y:.x#0" "y"
+L51: .string "#x#;z"
+.string "ax#:z:"c"
+L53: .string "yx:.0"
+L54: .string "z;z1""
+L55: .string "9xb90x.z:y""
+L56: .string "xcxy:cb"0", "."
+L57: .string ":;#:acyx;#;z" "b1#bxc1"
+L58: .string "xb"
+L59: .string ".;a;y:x.#xa"", ";;cz1z:a"
+ hlt
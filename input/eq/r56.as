@@ -0,0 +1,62 @@
+.define K = 3
+L0: .string ":9y#90.", ";bz:y"
+.string "a;9"
+.data 1 , K , -5
+L3: .string ";"
+L4: .string "c:b#x9"
+L5: .string ".:za::a"
+L6: .string ""
+L7: .string "z1#zx9191:"
+.entry L50
+L9: .data 1 , K , -5
+L10: .string "1aca"
+L11: .string "9ba;"."y;#0x"
+.string "y;xa:.:0" ":;"
+L13: .string ":aaa:.1yb9c" ".c#;";#.b0.""
+L14: .string "c9c.9"
+.string ".bx#xy"
+.string "ba:", ""y;#c".;"
+L17: .data 1 , K , -5
+L18: .string ""
+.string "z"
+L20: .string "c0";z1y" ""a.0b0ayy"
+L21: .string "x0"
+.string "."#ya1;"xza#", "c0.x;b#"
+.string "c9";1"
+.string "c."", "1.bx1bz"
+.data 1 , K , -5
+.string "zx"y1;.;b"
+L27: .string ":bz9y##.zy"
+L28: .string "xyx:y:#0"
+L29: .string ";9a""
+L30: .string "cb", "xabbyx"
+L31: .string "c0.0#" "9b#"
+.string ":;9"c9yb.c#"
+.data 1 , K , -5
+L34: .string "#;"
+.data 1 , K , -5
+L36: .string ";;"
+L37: .string ";:9ay.:y#0"
+L38: .string ":"cayb."
+.string "9:c9;#"
+.string ".1#c9".yy:.1"
+prn #K
+.entry L45
+.string "90"cb;#a"
+.string "bzaay9y9az;x"
+L45: .string ";a#.b:"
+.string "yaz"
+.string "x19c;y##"
+L48: .string ".yx11z"
+.string "y9."
+.string "x:;1y""9#c."
+mov L38, r2
+.string ";0y9"
+L53: .string ":c1." "#:1b.z.;9"
+.string "y9"x9#z", "a;c1"9cab:"
+L55: .string "b0z#.":cycy1"
+L56: .data 1 , K , -5
+L57: .string "a:b#9x11"
+L58: .string ".:za.y9."."
+L59: .string "0.0:a"
+ hlt
@@ -0,0 +1,62 @@
+.define K = 3
+L0: .string ""
+L1: .string ":"0a"."
+L2: .string "b:.;:1", ";c;cc09c";"
+L3: .string "z;99xx" "0:x0"
+L4: .data 1 , K , -5
+L5: .string "19#a.", "ayayzzz:;"
+.string "a:"
+L7: .string ".0xc"
+L8: .string "ayzx:c";x:"""
+L9: .string "#." "cb1c990""
+.string "x#0c.b"
+.string ""
+mov L55, r2
+.entry L54
+L14: .data 1 , K , -5
+L15: .data 1 , K , -5
+L16: .string "0c0.zz.0"
+L17: .data 1 , K , -5
+L18: .data 1 , K , -5
+L19: .string ""0aby.9aa:"
+L20: .string ".1"
+L21: .string "z##"c.#x0aa9"
+L22: .string ".;.:"
+L23: .string "ya" "c:#"
+.string "#"b##y9."
+.string "z"cbz;x"
+L26: .string ""
+L27: .string ";:#9y"
+L28: .string "1x.#.", "x#:"y.x;9c"
+.string "z:a:"
+L30: .string ":0.yc"
+L31: .string ";z", "z..b"
+L32: .string ":"
+.data 1 , K , -5
+L34: .string "9"x:.x:.90a"
+L35: .string "y;0"a;9z99b"
+L36: .string "c109a.9"
+mov L42, r2
+L38: .string "y.cc1x"
+L39: .string "z91.""
+mov L49, r2
+.string "y000"" "a0b;"
+L42: .string "zc;zz9:y"
+L43: mov L35, r2
+.entry L46
+L45: .string "b9":"ccc"
+.string "b." "xcxy""0b9z"
+L47: .string "."
+.string "a1":01" "#;c90x9;yzc"
+L49: .string ":y", "".b.:y#9"0"
+L50: .string "abx0b1;zy;."
+.entry L44
+L52: .string ""#:#z"
+L53: prn #K
+L54: .string ""
+.data 1 , K , -5
+L56: .string "c"
+L57: .string "901y"
+L58: mov L26, r2
+.string "1c"x#bax#x"
+ hlt
@@ -0,0 +1,62 @@
+.define K = 3
+L0: .string "xax10zy#y1" "y";ba1"
+L1: mov L42, r2
+L2: .string "#"
+L3: .string "yc;;"
+mov L10, r2
+L5: .string ".x"
+prn #K
+L7: .string ";y;:z;0cyy"
+.string ";;bcb1.", "11y.1c#.bca"
+L9: .string ";bb"
+L10: .string ""y:1".;zz9a"
+L11: .string "ccx:x:"z0b.#"
+.string ";x#aac;#az#"
+.entry L41
+mov L58, r2
+.string "#01###0bzb;" "#0c"
+.entry L57
+.data 1 , K , -5
+.string "9"
+.string "a"#09ac"
+L20: .string "" ""
+L21: .string "z" "bbc"
+L22: .string ":x1"y9yzb"0"
+.string "", "cb.:""
+.string "1xx" "ca199"19c1c""
+.entry L20
+.string """ "1:;"
+L27: .string "0..0b"y", "#b#zbb1""
+.string ":y"
+L29: .string "cx#x19b1y"
+L30: .string "9bc#1c90y0.z"
+mov L0, r2
+.entry L25
+.entry L28
+L34: .string "a#9cc", "c1:#"
+L35: mov L14, r2
+L36: .string "0""
+L37: .string "zb"
+L38: .string ".x"
+prn #K
+L40: .string "b0yzz.czc0:z"
+.string "cya."a"
+mov L44, r2
+L43: .string "a9a"
+.data 1 , K , -5
+L45: prn #K
+L46: .string "bx.a0"
+L47: .string ":zcx"
+L48: .string "x9"byx"
+L49: .string ""
+L50: .data 1 , K , -5
+.string "z0:"
+L52: .string ";1;001y"
+L53: prn #K
+prn #K
+L55: .string ""y.xc#x"
+.string ""9x", "cx;1b1#;0.""
+L57: .string ""x""
+L58: .string ""#1y"
+.string "x1zc:"#0;a0"
+ hlt
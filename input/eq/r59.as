@@ -0,0 +1,62 @@
+.define K = 3
+.string "ac"y.a:"
+L1: .string "#9y#c.;", "c9bbz:a"zy"
+L2: .string "byyb:;".:"
+.entry L42
+.string "y99xz9:"
+L5: .string "c#a:;0;19z:"
+L6: mov L34, r2
+L7: .string ":1x"
+.string "z9#az"az"
+L9: .string "a"
+L10: prn #K
+L11: .string "1cy.z9" ".b#yby1..b"
+.string "1;b"
+L13: prn #K
+L14: mov L14, r2
+L15: .string ";az"
+L16: .string ""
+mov L45, r2
+L18: .string ""
+.string "c"b"
+.data 1 , K , -5
+.string "a.#x" ":..b;cy"
+L22: .string "cxax:0c"
+L23: .string "91yc".c9;9:x"
+.string ""a.1"
+L25: prn #K
+L26: mov L42, r2
+.string ""
+L28: .string "#:1#ca" ":y#xb;y"
+.string ".", "#:z"
+.string "c1"azc#x" "1"
+L31: .string "999", "1"
+L32: .string "#..0z9a#""1"
+L33: .string "1x;y.baaac"
+.entry L54
+.string "0y0" "c9azczc:01"
+L36: .string "ccyy#", "1;9:bb"
+L37: mov L16, r2
+.string "", ""ccy"
+.string ""
+.entry L53
+L41: .string "#0" "9;99"99"
+.string ""
+.data 1 , K , -5
+.string "x9bz.x:a1;:"
+L45: .string "bxay.yxy01#y"
+L46: .string "c#1:zz" ":bcczy#01"
+.entry L6
+L48: prn #K
+L49: .string "zc:zb"zx"
+L50: .string "ac9a"
+.string "0;cxcz"
+L52: .string ""byx", "a9#;b;1."
+.string ".x0xa#10"
+.string "9"czy;"
+.string "0c90c110911" "0.cb"""
+prn #K
+L57: .data 1 , K , -5
+L58: mov L12, r2
+.string """#x#"
+ hlt
@@ -0,0 +1,62 @@
+.define K = 3
+mov L31, r2
+L1: mov L9, r2
+L2: .data 1 , K , -5
+L3: mov L49, r2
+L4: .string "."0"
+L5: .string "9.#.y:#;:" "zbz#0#"
+.data 1 , K , -5
+mov L6, r2
+L8: .string "":z", "9;:"
+.entry L58
+L10: .string "0yz;bb9:9"
+L11: .data 1 , K , -5
+L12: mov L14, r2
+L13: .string "9ax#ca:z9:;"
+L14: .string "c:1a"
+.string "1" ";"
+.entry L53
+L17: .string "1y."0b"
+L18: .data 1 , K , -5
+mov L1, r2
+L20: .string "#zxy91z9y"
+L21: .string "y;1:11c", "y:#1zz:"
+.string ";yz:01.#c"y", "1aca;#;b:"
+.string "axcy;a0##"
+L24: .string "bzz" ":x;zca::b."
+L25: .data 1 , K , -5
+.entry L44
+.string "c" "":11"
+L28: mov L60, r2
+.string "#119y1."
+L30: prn #K
+L31: .string ""
+.entry L30
+.string ""
+.string "9.a"
+L35: .string "##x.0zbc.:b"
+.string "bcbz9ac9.c"
+L37: mov L54, r2
+L38: .string ".;."
+L39: .string "x9;a#"
+.string "91a0"9"
+.data 1 , K , -5
+.data 1 , K , -5
+.string "c."
+L44: .string ""
+.string "b:z;aa9x"
+L46: .string "b1b."
+.string "bb.ca:a"
+.data 1 , K , -5
+L49: .data 1 , K , -5
+L50: .string "#9#:xy;ay9"
+mov L45, r2
+.entry L33
+L53: .string ""
+L54: .data 1 , K , -5
+L55: mov L44, r2
+L56: .string "", ""
+L57: .string "b:;;"
+L58: .string "x:"
+L59: .string ""1yycyax#1" ";b"
+ hlt
@@ -0,0 +1,62 @@
+.define K = 3
+L0: .string "x#11"
+L1: .string ":", "0a"
+L2: mov L50, r2
+L3: mov L39, r2
+.data 1 , K , -5
+L5: .string "a;;byca;x" "9yb"
+.string "."""
+L7: .data 1 , K , -5
+L8: .string "b"9:ba"
+L9: mov L54, r2
+L10: .string "0.#09."."
+mov L60, r2
+.string "a1y9cb"
+L13: .string "0a91a0ba"
+mov L13, r2
+.entry L42
+L16: .string ".#x;a1z":""
+.string "#zb"xyz"
+.string "9z" "ac"01x9z".x9"
+L19: .data 1 , K , -5
+L20: .string ":"
+.string "0x"" "09099yayc;"
+L22: mov L42, r2
+.entry L60
+L24: .string ""0c.y19ba" "9:x#.c1a."
+L25: .string "a", ":"cxc"1y.:"
+.entry L32
+mov L34, r2
+.data 1 , K , -5
+prn #K
+.string ""b;a.c0cx"
+.string "c9y9bb:1" "xyx#c01bab"
+.entry L19
+L33: .data 1 , K , -5
+L34: .string "cyc"
+L35: .data 1 , K , -5
+L36: .string "##z#:.:z" "9ac"00a:1."
+.data 1 , K , -5
+.string ":1;9x0.x"9x"
+.string "zabx#zz:9;"
+.string "."
+L41: .string "xa""
+.string "cxy"
+.string ""
+.string "#9b;:z#.;"
+L45: .string "111":z.a"
+L46: .string "z:za"#1c:#;b"
+L47: mov L45, r2
+.string "91:9:"
+mov L47, r2
+L50: mov L34, r2
+L51: .string "aac9:a;;ybzy"
+L52: mov L28, r2
+.entry L56
+mov L22, r2
+L55: mov L56, r2
+.string "zy#"#y1z.", ":0a:a.b#""
+.string ""
+.string """cbyzy0" "x.1xy"
+.string "y#."
+ hlt
@@ -0,0 +1,62 @@
+.define K = 3
+L0: .string "zyz#.a1zzb01"
+.string ".b:cza0#"
+L2: mov L18, r2
+mov L28, r2
+.string ""::c#.;y00xc", "z1a90b"y"
+L5: .string ".b0xb"
+L6: .data 1 , K , -5
+L7: .string "xcb01b"
+L8: .string "a"z.x."
+L9: .string ""911b"b.x#cb", "0x:xy"#;10z"
+L10: .string "c"
+.string ";y"
+L12: .string "bcc1"" "0x01"
+L13: .data 1 , K , -5
+.string "b#a#c"9:z#1x", ":;;aa1z1"z"
+.entry L60
+.string "9"", ";:c:zyc."
+L17: .string "0#bc9#c1.", "1b;:;zb;091y"
+.string "y:"
+L19: mov L29, r2
+.string "ax"b999a", "c1yc"
+.string "x;1#z" ""
+L22: .string ";z1;"
+L23: .string "a;" "xcbz"
+.string "zx;x9:#1bcb1" "x0"
+L25: .string "cx:"
+.string "za#x9x:11b"", "ca""a;cx"
+L27: mov L38, r2
+L28: .string "acbx"
+L29: .string "a"a"
+L30: .string "ab"
+L31: .string "::cz;"
+L32: .string "9"x."
+mov L27, r2
+L34: .string "bcbc"
+L35: .string "z1"1b0.zb"
+.data 1 , K , -5
+.data 1 , K , -5
+.entry L1
+.string "xyzx"
+.string "xxb;119.y.x." "a"
+L41: .string ";"
+.string "0y0;x.:xb"
+.string "01" "0;1xx0."
+.string ""."
+L45: .string "9b", ""
+L46: .string "x"
+L47: .string ";c0", ""
+L48: mov L15, r2
+.string ""#"
+L50: .string "y9c.0.0"
+prn #K
+.data 1 , K , -5
+.string "xbaz#0ca:"
+.data 1 , K , -5
+.string "zz1:xaaa" "x;a#z#00"
+.string "#cx"
+L57: .string "xyzzc09", "1."
+L58: prn #K
+.data 1 , K , -5
+ hlt
@@ -0,0 +1,62 @@
+.define K = 3
+L0: .string "1y:", "ccay:c"b"
+L1: .string ";:c.x"
+L2: .string ""
+L3: .string "z1ay"", "x.;yxc"
+L4: .string "acx"
+L5: .data 1 , K , -5
+L6: .string "z;""
+L7: .string "0z01az9"9bb"
+L8: mov L46, r2
+L9: .data 1 , K , -5
+L10: .string "c0b:yyb0z#" ";z"a0b1:y00."
+L11: mov L52, r2
+mov L21, r2
+L13: mov L8, r2
+L14: .string "b#y#"
+L15: .string ".:;yb:1.9y.0"
+L16: .string "09y1cz019a" "za0c0..z;c0."
+L17: prn #K
+L18: .string ";b"#9"
+mov L47, r2
+L20: .string ""
+L21: .string "x:.x" "z0az#""
+L22: mov L32, r2
+L23: mov L43, r2
+L24: mov L7, r2
+L25: mov L50, r2
+.string ";1"0acz9"
+L27: .string "#y0bzczy9;9" "xx1"
+L28: .string ";bc9x"
+mov L38, r2
+L30: .string "a;c", "#x"#z91."
+.data 1 , K , -5
+L32: .data 1 , K , -5
+L33: .string "#1" ""
+L34: .string ";z;0xa0" "zzxxx.#1xa.a"
+L35: prn #K
+.string "yb9bxc0"
+L37: .string "x#x."
+L38: .string "b"
+L39: .string "#ba0b#"
+L40: .string "90bx1b9y"
+.string "01c:."#:" """1zbaa"b9zb"
+L42: .string ":z" ""
+L43: .string "c:y1".0b"
+.string "9z9#yb;y;b1"
+.string ";;"
+.string "a#.9x"
+L47: .string "0y"
+L48: .string "1zx9.y"
+.string """" "x1."9by"
+L50: .data 1 , K , -5
+L51: mov L6, r2
+L52: .string ".cc"9yy1y9"
+L53: .string "yb9c"
+L54: mov L27, r2
+L55: .string "a" "0"bx"
+.string "b:#a0a0"
+L57: prn #K
+L58: .string "#9#yza;bay.:"
+.entry L18
+ hlt
@@ -0,0 +1,62 @@
+.define K = 3
+L0: .string "1:b0"
+L1: .string """
+prn #K
+.string "zx"
+.data 1 , K , -5
+.string "cx#;900:z1.", ""
+L6: .string "a"
+.string ""1azaz", "by.9:9"
+L8: .string "":1c."" ""
+.string "9cy1b"0c#z"
+L10: .string ""
+.data 1 , K , -5
+.entry L32
+L13: .string "#1axz#;.a" "01bb.;;1z0"
+.string "cz"z"
+.string "yc01a9"
+.string ""zz0z1."
+L17: .string "a1;zxc""
+.data 1 , K , -5
+mov L15, r2
+L20: prn #K
+L21: .string ";:a9;b"
+L22: .data 1 , K , -5
+L23: prn #K
+.string "ac1z"0:x90"
+.string "0y" ":.1y0x#a9"
+.string ".#0ba"
+L27: .string "1;1;x0;"
+L28: .string ";;xyz;b"by1"
+.data 1 , K , -5
+L30: .data 1 , K , -5
+L31: .data 1 , K , -5
+.string "ac"
+.data 1 , K , -5
+.entry L31
+L35: .string "yb;z" ""zz1zbzz9cyc"
+L36: prn #K
+L37: .data 1 , K , -5
+L38: .string "z00y:a19":"
+.string "90", "9"bcyay"
+.string "b0:ya1."
+.string "cay" "0:"
+prn #K
+.string "b.1b:a"
+L44: .data 1 , K , -5
+.string "0"#z0b#", ""b9:by0bb"
+L46: .string "0abz:ca"x", "#.1"
+.string "cbzxb"
+L48: .data 1 , K , -5
+.string "z:z1" "9.;"
+L50: .string ";y:z;;c1"
+L51: .string "c.x", "b"
+.string "", ":11::;;c0.z"
+.data 1 , K , -5
+L54: .string "ba:"
+L55: .string ";1."
+prn #K
+L57: .string "", ":ybx1c.1#c0;"
+L58: .string "zy:c99xza"
+.string ""
+ hlt
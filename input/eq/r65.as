@@ -0,0 +1,62 @@
+.define K = 3
+L0: .string "119"
+.string "xb91yx", ".aybc9."c"
+L2: prn #K
+L3: .string ";x":x"
+.string "a#"zyz#yac.0"
+L5: .string ""#", "900c9#0..zxx"
+L6: .string ".":#ay:by"
+L7: mov L53, r2
+L8: .string ".0;.0:z9"b#:"
+L9: .string ""1:y1z""
+L10: .data 1 , K , -5
+L11: .string "9abc9#z9.ac"
+L12: .data 1 , K , -5
+.string "xy"0"
+.string ".9y:b;;.91"
+L15: .string "#"0.yycx."
+L16: .string ".0..:9"
+L17: .string "#9;c0a;y9"
+.string "yac"" "1c0"#1z.91.:"
+.string "c:b"
+L20: .string "##"
+.string "ayx1;x.#9:bb"
+.string ";#ya"
+.string ";"
+.string ""
+.string "yc;.ac", "9c9;9xb;.0.#"
+L26: .string "b"
+mov L36, r2
+.string "y.ay09"
+mov L7, r2
+L30: .string ".:b#:0x"
+L31: .data 1 , K , -5
+L32: .string "y.#1bza", "9.c.cbxx0x"
+L33: .string "ya:0z1y:.", "1c1y."
+.string "00az9za"
+L35: .string "c:c:"
+L36: mov L55, r2
+L37: mov L32, r2
+L38: .string "c;"
+.data 1 , K , -5
+L40: .string ";bc0z.;"xz9."
+.data 1 , K , -5
+L42: .string "1""
+L43: .string "z" "z;y.ab91"
+.string ":x:..1by0" "19#z:xy"
+L45: .data 1 , K , -5
+L46: .string "0:z1y0" ""z9":##cz"a1"
+L47: .string ";ayaxc" ""#y.#:0:""
+.string "91.ybb"zb1"
+.string "x"90"#a.ca"
+L50: .string "1xx0c.;""
+L51: .string "99c"
+.string "1yxz1:zb""
+.string "", "cb"
+L54: .string "9:9.:;azx", """;cb;1x"
+L55: .string "y:;x:cbb:c" "1z1"
+L56: .string ""#y#.#"
+L57: mov L11, r2
+mov L26, r2
+.entry L23
+ hlt
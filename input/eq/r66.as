@@ -0,0 +1,62 @@
+.define K = 3
+L0: .string "#1y"
+.entry L47
+.entry L11
+L3: .string ".b.z.c0..1:9"
+L4: .string "za"
+mov L39, r2
+L6: .string "yxybx#z"
+.entry L25
+L8: .string "a;bz"
+.string ".b.";0z1"
+mov L46, r2
+L11: .string "#y"ay", ";.1za"
+.data 1 , K , -5
+L13: .string ""
+L14: .string "ac#c9:"
+.string "9", "by.0;";x"
+L16: mov L49, r2
+L17: .data 1 , K , -5
+L18: .string "b"y0.xy0b" "0c"
+L19: mov L60, r2
+L20: .string ";"
+.string ";c;"y.9#", "#x.#bz"
+L22: .data 1 , K , -5
+L23: .string "19.z9":bxxx"
+mov L17, r2
+.string "x"90x:#b0"
+L26: .string "xx9c""9z:.c#"
+L27: .string "##:1z9"
+.string ":91;".", "0.b9ax99;"
+L29: prn #K
+L30: .string "zy"y:x", "#"
+.entry L20
+L32: .string "a"
+.string "#;19x"
+mov L0, r2
+.string ":y9cz" "cxy"#z"
+.string ".c:;"9" ".:xaz.x";xca"
+L37: .string "xz1"
+L38: .string "";"0by9xy:"
+L39: .string "c9x"
+L40: mov L34, r2
+L41: .string ""c:aaz1"
+L42: .string ""0b"za"
+.data 1 , K , -5
+.string ""
+L45: .string "##yb", "1b"
+.entry L24
+.string "bca1c;1"
+.entry L45
+mov L22, r2
+.data 1 , K , -5
+L51: .string "xza0;19xc" "cyy9"
+L52: .string "#:" ""
+mov L60, r2
+.string "cy1x1bc"
+L55: .string ""9;bczbc0" ";9;a"
+.string "yz09abc"
+L57: .string "" "zza#y:"
+L58: .string ".000", "0:909xbb"9a0"
+mov L44, r2
+ hlt
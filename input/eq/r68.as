@@ -0,0 +1,62 @@
+.define K = 3
+mov L47, r2
+L1: prn #K
+L2: .data 1 , K , -5
+.string "z19zc9:###"
+L4: .string "ab#;c" "a9""
+L5: .string ":9a;:c;;zc#" ""
+.string "ybx0000b.y0"
+L7: mov L26, r2
+L8: .string "b"."
+.string ";";x"
+.string "#10:y"aa"
+L11: mov L13, r2
+L12: .string "x"z1"y:b#bb;" "c"zayc;109#z"
+L13: .string "zb.cx."
+.string ""01.";z0:"
+.string "axby;zy"
+L16: .string "1#;.9cx#y."
+mov L6, r2
+L18: .string "z"
+L19: prn #K
+.string "#0bb", ""
+.string "bc"
+.string "1zc0"
+.entry L52
+.string "b""
+L25: .string "#x;a"x:#"
+.string "#a1.ybz."
+.entry L20
+.string "":a1x;#"
+L29: .data 1 , K , -5
+.entry L20
+.string "z.", ".0c0#xba##"
+.data 1 , K , -5
+L33: mov L5, r2
+prn #K
+L35: .string "x9yy9c"10b0:"
+.string "b:"
+.string "1x9#x1xa:"
+.entry L49
+.string "9"
+.string "y"
+L41: .string ":yb.0a.#"
+.string "x9c;1xcb.b", "999"11:"
+.string "b"#ab"1", ";##c0;z"
+.entry L31
+L45: .string "bya" ""
+L46: .string "c"cbz"
+L47: .string "#xxzc..1c"
+L48: .string "0#"a1"
+.string "9z"
+.data 1 , K , -5
+L51: .string ""a9" "".10ba;"
+L52: .string "b:xc191y"ac"
+L53: .string "z:yx" "0"
+.string ""
+.string ""0#c", "1b9b.a;0yc"
+.string "bbx1c;."
+.string "b", "#baabz0a"
+L58: .string "1b1;yay:#" "9"
+L59: prn #K
+ hlt
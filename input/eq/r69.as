@@ -0,0 +1,62 @@
+.define K = 3
+L0: .data 1 , K , -5
+.string ""##"9"
+L2: prn #K
+L3: prn #K
+L4: .string "0b0ycx" "x.:#"
+L5: .string "0" "by"#.;zabbx"
+L6: .string "1:"
+mov L59, r2
+L8: .string "b.by" ""yc:1:::1x"
+.string "x:y01#"
+L10: .data 1 , K , -5
+.string "0ab#1.0cb"
+L12: .string "00.x;y1cayb9"
+.string "x;.9#zbb0"
+.string "b#:b"..#", "91"
+mov L21, r2
+L16: .string ";#1x"
+L17: .string "a.b:"
+L18: .string "xz;;a1b9y;za"
+L19: .string "0.y1"
+L20: .string "ca.#cz::""
+L21: .string "zyb0ac", "zzc"
+L22: .string "0y"
+L23: .string "1z1:."
+.entry L49
+L25: .string "c1y"
+L26: .string "bb1z9#"
+L27: .string "z9"
+.string "y11"
+L29: .string "xbyc990" "y#b:zy#1#a"
+L30: .data 1 , K , -5
+L31: .string "y:#.", "b#x0yaa#0"
+L32: .string "bxbc"
+L33: .string "0b.#c"
+.string ""
+L35: .data 1 , K , -5
+L36: .data 1 , K , -5
+L37: .string "c0by.:by"
+L38: .string ":xy:0xcayb" "09yx"
+.string ".0".c0zz##:", ""
+L40: .string "ayz#bx." "#0zxbbxa;"
+L41: .string "yax0".xabxbc" "c99"
+.string "." "9#xc";;;;"
+L43: .string "x;"
+.data 1 , K , -5
+mov L44, r2
+L46: .string ""
+L47: .string "#a0x.0"
+mov L12, r2
+.string ";;0.zx", ""
+L50: .string "zb"
+L51: .string "9"
+mov L60, r2
+L53: .string ":;9.:xx:#9;"
+mov L0, r2
+.string ":"y"
+.entry L59
+.string "9#xab00"
+.string "a:c.c;", "bz0"#"
+L59: .string "c;19c1yzb9"
+ hlt
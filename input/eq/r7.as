@@ -0,0 +1,62 @@
+.define K = 3
+L0: .string "ab"9bz;a9x"
+L1: .string "9"
+L2: prn #K
+.string ""
+.string ""
+L5: .string "b;y9":cb"
+L6: .data 1 , K , -5
+L7: .string "" ":90#z1;"
+L8: .string ".#"
+L9: .string ".1y;b" "c#zc10"
+.data 1 , K , -5
+.string "z.z;1" "b"by1.:"
+L12: mov L36, r2
+.string ".0:z", "zc;b1ax"
+L14: .string ""1bc10"
+.entry L55
+.string ":0xcb" ":xa"
+L17: .string "" "z;;zc."9"
+.data 1 , K , -5
+.string "#90000b1:0"
+L20: .string "bz"
+L21: .string "bz;ab"x;"
+.data 1 , K , -5
+L23: .data 1 , K , -5
+L24: .string "11ybcb."
+.string "9a"
+L26: .string "9a#9y:"b."y", "z#"
+L27: .string "x;###"x#x"" "xx91z.aa#y1y"
+L28: .data 1 , K , -5
+prn #K
+.string "x"
+L31: .string ";;"a1:z"
+.string "#.#x1c"
+L33: .data 1 , K , -5
+.string "0.b.ccc", "1#:c;";1:"
+L35: .string ""
+.string ".c0"x""x", "y9x"
+L37: .string "a."
+L38: .string "0"9c9c99"
+L39: .string ""
+L40: .string ".b9az:999"
+mov L3, r2
+L42: .string "b919a#b1z;9;"
+L43: .data 1 , K , -5
+L44: .string ".9y" ""1c"
+L45: .string "x0bx:y#b#c"
+L46: .data 1 , K , -5
+L47: .string "x.b01c:"
+L48: .string "0z0xzzb."
+L49: .string "a0z9;y9bb#x"
+L50: .string ""
+.string "":"y0c"
+L52: .string "bya#." "y"
+.data 1 , K , -5
+.string "y"
+L55: .string "0y;ca9.x"
+L56: .string "xy", "#xy19:cy"
+L57: .string ""
+.string "1x1b:":0" ""09y.xxz"
+.entry L8
+ hlt
@@ -0,0 +1,62 @@
+.define K = 3
+L0: .string "1czbc":", ".:0"
+.string "z#y0#1"b"
+L2: .string "ay"
+L3: mov L51, r2
+prn #K
+L5: .string "x;#b#a90"
+mov L19, r2
+.string "bx"c;"
+.data 1 , K , -5
+L9: .string "#y9;"9"
+L10: .string "z"b.c;bb1#a"
+L11: .string "y", "a;"0.cb1y."
+L12: .string "9:"
+.data 1 , K , -5
+L14: .string "ab9aa0xz0"
+.string ";":;0zy.;a"
+.string ";xc", ".1a9c01;"
+L17: .string "#;"
+.entry L29
+.string "c1y:xy1"99", ""
+.entry L43
+.data 1 , K , -5
+.string "z#0#bb"#y;"
+.entry L40
+.string "a;", "bb:"
+.string "0yya.01"
+.string "ya1;91"cxc""
+L27: .string ";x"
+L28: prn #K
+L29: .string "#"#:;0101z"
+L30: .string "a;;900az", "y0x9"
+.string "1z9.:0;""
+L32: .string "x9y"b#"
+L33: .string "y#.y;x;01y0c"
+L34: .string ""
+.data 1 , K , -5
+L36: .string ":b."
+.string "1"
+.string ".".xabx"
+L39: .string "x.a:", "x19:xcx9."
+.string ";#x#:", ":#aaa:"
+L41: mov L14, r2
+.entry L41
+L43: .string "c.a#xz:cx", "9a#1c9x"
+L44: .string "#.##."1.;"
+L45: mov L28, r2
+L46: .string "y;"z.b0:1az", "#"az"
+L47: mov L53, r2
+L48: .string "cb9", ":11y;z"
+.string "a"b#c"
+L50: .data 1 , K , -5
+.string "x0a#."
+L52: .string ";"
+L53: .string "z0x1.:#9c;y"
+L54: .string "0"xc;91a0:a."
+.string ""
+.string ""
+.string "za#y;:", ":#bz"
+L58: .string "z:1;c#x"x"
+L59: .string ""x09#:0axza0" "bbyya:a:"
+ hlt
@@ -0,0 +1,62 @@
+.define K = 3
+.string ""
+.string "ybx"
+L2: .string "9z"1#cz:caz" ":;xcz""
+.string "ax;ccx#."9", "ayzx0abbx"
+L4: .string ";;"zybxy;xc;"
+L5: .string "#.;#;y.."a" "x1z"
+L6: .string "xy"c" "91xc;bx"
+.string ""yy09."
+.string "a"0x1y:"
+.string "aa00bzxz;"", ":;9"z;1"
+L10: .string ":yy".99#y.""
+L11: prn #K
+.string ";b;1;"
+L13: mov L10, r2
+.string ";#00c1:11c"
+L15: .string ".1xc:cx1"
+L16: .string "cc.#c:#:a19"
+.string ":"
+.data 1 , K , -5
+L19: mov L20, r2
+prn #K
+L21: mov L17, r2
+.string "#:":91y"b"
+.string ":::.;y#;a;y"
+L24: .string "yxz.;"
+.string "1"x.:09z"
+L26: .string ";"9:y1999"
+L27: mov L45, r2
+.string "c"
+L29: .data 1 , K , -5
+.entry L15
+.string "bc:c9#xc:;"
+.string "x#:1a"
+.string "00x9;yxx1.;1"
+L34: .string "x;cx:c":#.yc"
+.string ":9;1b"
+.entry L17
+.entry L23
+.entry L51
+.string "a.ya"
+.entry L60
+.string "x9a:"9a"
+L42: .string "", "1;:a9c1"
+L43: .data 1 , K , -5
+L44: mov L54, r2
+L45: .string "b"
+.string "y:0"
+L47: .string "1"
+.string "cy", "xb.:#"b""
+.string "19b#bcb.z;", ""czyz9b1"
+.string "1ba9b#"ax0", "c;abx":x"
+prn #K
+L52: .string "0cy#"
+.string "00c.c.10##9c", "za9.1:z10b"
+mov L20, r2
+mov L14, r2
+.string """
+L57: .string "xx"ac":9x0"
+L58: .string "c9;b;b".", "1"c;x#1cay""
+L59: mov L29, r2
+ hlt
@@ -0,0 +1,62 @@
+.define K = 3
+L0: .string "z."
+.string ";c..zx0c:a"
+.string "b#yb9z."
+L3: .string "zxz"1"
+L4: .string "y0"
+L5: .string "aaz" "b"cya1"
+.entry L35
+.entry L14
+.string ".by1z1ab"
+L9: .string "#"9"
+.entry L6
+.string ""
+L12: .string "x;":""
+.string "z;:"
+L14: mov L31, r2
+.entry L6
+.string "..y1;" "a"":"
+.entry L24
+prn #K
+L19: .string "9;0"
+.string "z.a.z:;#b"
+L21: .string ";.9:."
+L22: .string "a9x:bxy"0b.b"
+.string ""
+.string "a.:9z""b9:"
+.data 1 , K , -5
+.string "0"
+L27: .string "#9#:y;0yz" ".c"
+L28: .string "yc.:y9."
+.data 1 , K , -5
+prn #K
+.string ""
+L32: .string "zza.01"
+L33: .string "9ayz", "9.ax;"
+.data 1 , K , -5
+.string "9.c.#9.0", "1c.c9"
+L36: mov L35, r2
+.string ":c09"
+mov L42, r2
+.string "c;:c9"zcx"", "c"9"
+.string "#:1.;b#"b:c"
+.string "10;#0.x9z"
+L42: .data 1 , K , -5
+.data 1 , K , -5
+L44: .string "xc01";0yyc0"
+.entry L56
+L46: .string "b;"
+.string "y9aza1x"9a", ":xz9y"
+L48: .string ";cb9"0#00"
+L49: mov L49, r2
+L50: mov L15, r2
+L51: .string "0.."
+.string "z0"b", "a"
+.entry L3
+prn #K
+.entry L6
+.entry L34
+L57: .string "0;;.990a".."
+L58: .string ":a#b."b;"
+L59: .string ":y"
+ hlt
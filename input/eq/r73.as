@@ -0,0 +1,62 @@
+.define K = 3
+L0: .string "c1y;b1099"
+L1: .string ""a0z90190c"a"
+L2: .string ""b1.#zycxax" "yy.a#"x9c;0b"
+.data 1 , K , -5
+L4: .string "1##1".9"
+.entry L26
+L6: .string ""
+L7: .string "z#", "xb"
+L8: .string "0y.0b1" "bb:y919b:xza"
+L9: .string "#c0a:.;";0;"
+L10: .data 1 , K , -5
+.entry L33
+.string "c#0"#b"
+L13: .string "xy#1"
+L14: .string "c1yz9:"
+.string ";"
+.string "9b:z"" ".110#a"
+mov L3, r2
+.string "9#:zba9"
+L19: mov L23, r2
+L20: .string ".bx.:#:1"
+L21: .data 1 , K , -5
+L22: mov L50, r2
+L23: .string "9"
+.string "1", """x".:c"
+L25: .string "xy#" "0x:"0."""
+L26: .string "x.9:"
+L27: .string "zx.cby"0#c"
+.data 1 , K , -5
+L29: .string ".0"
+.string "xy"
+L31: .string ";01cab9x9""
+L32: .string "ya#y"
+L33: .string ":z;:"
+.string "" "b"
+prn #K
+L36: .string "00"
+L37: .data 1 , K , -5
+L38: .string "y#"acy9:zx" "##caaz"
+L39: mov L55, r2
+L40: .string "9#y;0x00c"
+.string "yx."#1:b"
+L42: .data 1 , K , -5
+.string "9.z9y"
+.string "x0#za9" ";:z0zy"
+mov L49, r2
+L46: .string "yax:zc" ""x"
+.string "091bxcc" "c#z0"1b19#yb"
+.string ";:"
+L49: .string "y.z;b#9bz0.0"
+L50: .data 1 , K , -5
+L51: .data 1 , K , -5
+L52: .string "#b1#x".0b#" ".;0:1z9x.0"
+.entry L60
+L54: .string "11z:.99:"
+L55: .string "x#.90.b"" "0c0y;"
+.data 1 , K , -5
+L57: mov L54, r2
+.entry L0
+.entry L2
+ hlt
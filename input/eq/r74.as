@@ -0,0 +1,62 @@
+.define K = 3
+.entry L7
+.string ""x"
+L2: .string "1czy"
+L3: .string ""x"
+L4: .string "y:"0", "":c"
+mov L21, r2
+L6: .string "0"
+L7: .string "c;c#0110;bx"
+L8: .string "c1cxy:a", "9y9.yzcz"bx"
+L9: .string ".#x:.z"
+.entry L30
+.string "y9ca"
+prn #K
+.data 1 , K , -5
+L14: .string "0", "a.."#xc:01"
+L15: .string ".c9y.9y" "0x;;"cx#y:c"
+L16: mov L38, r2
+L17: .string ";0c1b;xa#:z"
+L18: .string "xb1x0":#c"
+L19: prn #K
+.string ";yzz.9"
+L21: .string "y""
+L22: .string "1b."
+L23: .string "#";010a1"
+L24: .string "xa..0.ba"
+.string ""
+L26: .string "1:"
+prn #K
+L28: .string "bxx"
+.entry L55
+mov L44, r2
+.string "a.0."0";"
+L32: .string ";"a"
+L33: .string "x"
+mov L21, r2
+L35: mov L14, r2
+L36: .string ".90"
+L37: prn #K
+L38: .string ""
+L39: .string "cxcazy0;zz#"
+.string ":1.y"" ";"
+.string ".ya" ".:;x"9;"#;.b"
+L42: .string "9#00xaz0#cz:"
+L43: prn #K
+.string "x9;y.y:9.ax" "b1z:z;9"
+L45: .string "c..x."0"
+.string "xa:xbz.c;1"
+.data 1 , K , -5
+.string "y90.b1"
+L49: .data 1 , K , -5
+.data 1 , K , -5
+.string "c:9:"axx;:9"
+L52: .string "0", ""
+L53: .string ".z991xb"
+.string "a:x#b90a" "azy0bcb"a""
+L55: .string "".1", ".0xa"
+L56: .string ";#"
+.string "0bbz:".#cz""
+.string "y" "1c;b;y9y#.ca"
+.string ""
+ hlt
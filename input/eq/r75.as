@@ -0,0 +1,62 @@
+.define K = 3
+L0: .string ""
+.string "::"."zb" "b#yy1"
+.data 1 , K , -5
+L3: .string "9;:1:x"
+.entry L38
+L5: .string ";.ab"
+L6: .string "b#yz9:"
+L7: .string ":x"x0:..a", "z1ya"
+mov L35, r2
+L9: .string "9.zc" "1.1.b0"
+L10: .string "by00z", ""1#z;"z0"
+L11: prn #K
+L12: .string "#;9y#xz1", "c9."
+L13: .string "z:1.x"a0#z#b", "yx"
+L14: .string "c0#bz""
+prn #K
+.entry L43
+prn #K
+.string "c::9z"
+.string "0yy"
+.string "#zc"
+L21: prn #K
+L22: .string "#cz;9"
+L23: .string "c;cx"
+L24: .string "#y1.0:xc"
+.string "1x"
+L26: .string "1a".;0"b"
+L27: .string "axccb"
+L28: mov L4, r2
+.string ""ba;"
+L30: mov L21, r2
+L31: .string "1xb9by#a"
+.data 1 , K , -5
+.string "c#9:9:;b;c"
+L34: .string "acbx"
+.string ""
+.data 1 , K , -5
+.string "c", ":0b0"xy"z"9""
+.string ":", "aa":c;b":"
+L39: .string ""
+L40: .string ""
+L41: .string ":;c.b1zz:zaa"
+L42: .string ""z"
+.string "zzx0"9cza0b"
+L44: mov L31, r2
+L45: .string "#:::#bx;0xc"
+L46: .string "9xcab##.;" "91;#.y"
+L47: mov L46, r2
+.string "a", ";:c;"
+L49: .string "x:a#;.yz1c"
+L50: .string "cz" "#0byzcz1;a"
+L51: .string ".b"
+L52: prn #K
+.string "zx1x1a9:yc;"
+.string ".9.a;x19"
+L55: prn #K
+L56: .string ""
+L57: .string "z#c":#ayy1y" "#"zz#1z0"
+.string "::a"xy#.9a"
+L59: .string """
+ hlt
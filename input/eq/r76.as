@@ -0,0 +1,62 @@
+.define K = 3
+.string "ya0"
+.string "1xbz"yx"
+L2: .string ";;#0.x" "ab::0cb"
+.string ".y:;b".9baa", "1c;;019"
+L4: .string "0x#1#;z", "9;"
+L5: .string "9b" ""
+L6: .string "0.b.ca"
+.entry L46
+.string ":;#y1#;b"9b#"
+L9: .string "#", "bbz0"011z;"
+L10: mov L24, r2
+L11: .data 1 , K , -5
+L12: .string "1x0"
+L13: prn #K
+.string "9ax9.."" "10.19:.xb0y."
+L15: .data 1 , K , -5
+L16: .string ".99"
+L17: mov L60, r2
+L18: .string ";9cb."1y", "1.z"#:xcab1#"
+.string ";a0b"
+L20: .string "cc"
+.string "z:c10c:a."
+L22: .string ":c:99"
+L23: .string "yxy;a1#;9:"
+.string "a:.9:xc.bz;y"
+.data 1 , K , -5
+L26: .string "y0.zzy;z:b:"
+.string "0#ba"
+L28: mov L53, r2
+L29: mov L46, r2
+L30: .string ":##x"
+L31: mov L9, r2
+.data 1 , K , -5
+L33: .string "c" "b9#"z9.za"
+.string ".#x9""
+L35: .string "#"";c9ay.#c:"
+.string "."
+L37: .data 1 , K , -5
+L38: .data 1 , K , -5
+L39: .string "9zxb#9zzz9"
+L40: .string "";1#c"""0"z#"
+.string ""a;9c1"
+.string ""
+L43: .string "1;#0;"z91"
+.string ":9b0##z"
+L45: .string "zzc#"
+L46: .string "", "by1"y:ccx9"
+.string ""
+.string "99x;99ycy"
+.entry L50
+mov L4, r2
+.string "", ";#x.91cx"
+L52: .string "#1b".x"11";"
+.entry L43
+L54: mov L11, r2
+L55: .string ""
+.string ":"x#yy"
+mov L13, r2
+.data 1 , K , -5
+.string "9z:.c:z0.y" "y.z#x.""
+ hlt
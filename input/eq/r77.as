@@ -0,0 +1,62 @@
+.define K = 3
+L0: mov L15, r2
+.string "19;x"
+L2: .data 1 , K , -5
+.entry L31
+.string ""0czzbb9"
+L5: .string "bb"" "1;.9bb"#"
+mov L54, r2
+L7: .string "#"
+L8: .string "#9bz9a""#0", "9xx;10.c#"
+.string ""
+L10: .string "by9;.1"
+.string "c"
+.string ""#0;a"
+.string "a.axb:1b"01b"
+L14: .string ""bcccaa"x:9#"
+.string "019y;"b1;", "yy1"xa;1"
+L16: .string ":"
+.string "0cb:0y119."#" "0"yy""b"9z"
+L18: .string "#.:1."
+L19: .data 1 , K , -5
+.string "0.9"" "by:b"
+.string ""
+prn #K
+L23: .data 1 , K , -5
+.string "b:."cy#c:" ""
+L25: mov L24, r2
+.string "z"
+.data 1 , K , -5
+.string "10"
+.string "aba0#c" ":#y";y:"c9:b"
+.string "9.bc.1" "#.zz1xx1;"
+.string "#x0.bx#;" "y::zz:0x99"
+L32: .data 1 , K , -5
+mov L22, r2
+.data 1 , K , -5
+L35: .string "1x.b" "byycay;009"
+L36: .string "b:1#"9z110c0"
+.string "a;yy" ":;a;b0z"
+L38: .string "z"
+.string "ca"
+L40: .string ":"
+L41: mov L27, r2
+L42: .data 1 , K , -5
+.string "x.:"
+.string ";", ""
+L45: .string "y09b"x9"
+.string "a::#;..cc"9"
+.string ""
+L48: .string ":1.:1" "9"
+mov L37, r2
+L50: .string ":"
+.string ".yz1z"
+.string ""
+L53: .string """a0"bx..", "x;1.#x"
+.string ":"
+L55: .string "10cca"" "az"
+L56: .string "b"y0"9b;"
+L57: .string "1"cb#"
+L58: .string "b.z"" ""
+L59: .string ".zc:"
+ hlt
@@ -0,0 +1,62 @@
+.define K = 3
+L0: prn #K
+.string ".0a:", "0#:x.109a""
+L2: mov L21, r2
+L3: .string "c#", "zax#b"
+L4: .string ""9y."c:9:."
+.string "b."9ab1:zx0"
+L6: .string "ca;#zz#99y"
+.string "ax0caab1.0" "y"
+L8: .data 1 , K , -5
+L9: .string "#x", "x1bbx;a"
+L10: .string ""y":x"
+L11: .string "a.0a1az#0x"
+L12: .string "9y"
+L13: mov L22, r2
+L14: .string "c0z190a9c""
+L15: .string "#z;19zxc"
+.data 1 , K , -5
+L17: prn #K
+L18: .string "199y9:90;"
+L19: .string "yay" """c9c"
+L20: .data 1 , K , -5
+.string "x:;1z.:9c"
+.entry L55
+.string "xa;"1;ya1", "a"#9a;x;zy"
+mov L29, r2
+.string "#9"
+L26: .string "bz"
+prn #K
+L28: .string "9z"110"#"
+L29: .string "0y"
+L30: .string "y1"90:zy"
+L31: .string "09#1;9z"::c#"
+.string "x#:y11yz1xz#"
+.string "9y10."
+.string ".."
+.string "", "#b;y."
+.string "zzx9yc;"
+L37: .string "0"1:a."
+L38: .string "9xxx.z;;:"
+L39: .string "9..bz0#9"
+.data 1 , K , -5
+L41: .string "9ccc0:""c0."
+.data 1 , K , -5
+L43: .string "c:.xbyy:9"1"
+L44: .string "#c:#ybz#", "y1a#c"
+.string ":;z1ax.c" "b"190:"
+.string "b"
+L47: mov L6, r2
+.string "#0.911" "0zy;0:a#"
+L49: .string ":z:y", "9x"
+L50: .string "01bxxa", "a"
+L51: mov L9, r2
+L52: .string "10z#:cayx" "a;"
+L53: .data 1 , K , -5
+L54: .string "xy1"
+L55: .string "a0.y"9cx1;"
+L56: .string ""b"
+.string "9cbyxb:1xa#", ";y#.;cy"az"
+.data 1 , K , -5
+.string ":zz0:0xx::;"
+ hlt
@@ -0,0 +1,62 @@
+.define K = 3
+L0: .string "xx"
+L1: .string ""
+L2: .string "c01"", ""b0by#1a."
+.string ".ba1b:b"
+L4: .string "z1ycba;:.9z"
+L5: .string "yz#a9#.:c"9"
+L6: .string "#9za"#0b:a" ".x0:11xxz#x"
+L7: .string "c1b9"az#9c1" "c"
+.data 1 , K , -5
+L9: .string "y1.xx:"
+L10: .string "y1a#b.a.0"
+.data 1 , K , -5
+L12: .data 1 , K , -5
+L13: prn #K
+.string "#cz."
+.string "9b."
+.data 1 , K , -5
+L17: .string ";1" ":9#"b1."
+L18: .string "09y;bcb"
+.string "":19"
+L20: .string ""
+L21: .string ".:x"
+L22: .string "#1""1z:9b""
+L23: mov L25, r2
+L24: .string ":zx"
+L25: .string "y""ab" "#;"yx90"
+L26: .string "0.9;""
+.data 1 , K , -5
+.string "b"0"
+L29: .string "::" "c"""0bx9;"
+.entry L12
+mov L17, r2
+L32: .string "x".bzb;y;0"
+.string "1byz"
+.string "a", "9b"
+.string "":101z" "";;b"
+mov L24, r2
+L37: .string "9y1cc.z;#" ".c0:xccycaz"
+.string "z9.bbyyyyz"
+L39: prn #K
+.data 1 , K , -5
+L41: .string "b#b:x0;ccc" "10"
+.string "::9xc::"
+.string ""
+L44: .string ";"
+L45: .string "10"
+L46: .string ""
+L47: .data 1 , K , -5
+L48: .string "c"
+prn #K
+L50: .data 1 , K , -5
+L51: .string "x#01y"
+.string "#0cb""zx;"
+L53: .string ""9"bx"
+L54: .string "x""
+L55: .string "z:.y1"
+.string "0xybzacx0." "zx;b0;xa";c"
+L57: .string ""
+L58: mov L8, r2
+.string ""
+ hlt
@@ -0,0 +1,62 @@
+.define K = 3
+.string "x."
+.string "x0:a1110"
+.string "1"
+L3: .string "10.b:y"
+L4: prn #K
+L5: prn #K
+L6: .string "1"
+L7: .string "c;b9a1.xc";1" "y9z"0cc"
+.string "z:"19;xycz9"
+.data 1 , K , -5
+.entry L34
+L11: .string ""
+L12: .string "0y"."
+L13: .string ":""
+.string "ba##"
+L15: prn #K
+L16: .string "100b;by.b", "b#99zc#91."
+L17: .data 1 , K , -5
+L18: .string ";b.yzzza:"", ""
+.string "#";ccz01bbx;"
+prn #K
+L21: .string "1:c.19.b.1;"
+L22: .string "a1b"
+mov L39, r2
+.string "9b.#;9", "x9xz90.9:"
+L25: .string "."
+L26: .string "yb90.z#."z", ""z#y:"bx1z"
+.string "y0;" "9..z":;;z:"
+L28: .string "y"
+.string "#b;""y"
+.string "y:0x"
+.string "1xx"#;9"xz1", "b0b:c#;0a#ca"
+L32: .data 1 , K , -5
+.string ";bc;"
+L34: .string "a"b"c:#z"b"x", "#zxy.zzb9"
+.string "ccy0c0", "b"
+.string ".xbaa"
+mov L35, r2
+L38: .data 1 , K , -5
+L39: .string ";"
+L40: .string "cxzx0ccc#1a"
+.string "0"0;"
+L42: mov L36, r2
+L43: .string "."#9c", "1"c""y1:99"
+.string "90#c"1:1b" ""
+.string "0.a;c"
+.string ";c#"0;:"
+.entry L32
+.string "zzbz:b1"c:"
+L49: .string "##0z."
+L50: .string "::zaax9z1z1"
+.string "a#1.y;:y1"yy"
+.string "1"
+L53: .string "bz.;:1z1;0x"
+L54: mov L9, r2
+L55: .string "#:#yxc:0" "xbaa1."xzzaa"
+L56: mov L40, r2
+L57: .string "zz""
+.string "b99x1#."0b"
+L59: .string "##:.z;0:ay0"
+ hlt
@@ -0,0 +1,62 @@
+.define K = 3
+L0: .string ""0zz90za9#""
+L1: .string "a0xc9;ac1"
+L2: .string ";c:xy", "z"
+L3: .string "yyz;;az1"
+L4: .string "9.a1x"
+.string ".:a9a", ":"
+.string "1.a9b"
+mov L58, r2
+L8: .string "cx"
+.data 1 , K , -5
+L10: mov L9, r2
+.string "zy#"9#:9", "x;c;9#z"
+L12: .string "ayz00ax.""
+L13: .string ";yz;""
+.string "#""
+L15: .string "y""a#..", ""b"
+.string ""axyz.#zbz"
+.string ""0:09b"
+L18: .string "a:ba#z1"x", ";y"
+.string ".:;c9."
+L20: .string "#", "9#yx"0;1.y"
+L21: .string "#1xczyy#b11"
+.string ":#"
+.string "b0a..x"
+L24: .string "bb"
+L25: .data 1 , K , -5
+L26: mov L55, r2
+L27: .string "c"" "..b;y9"bab"
+L28: .string "xz"
+L29: .data 1 , K , -5
+.data 1 , K , -5
+L31: .string ";#:x."
+.string "zc;#:0z."
+L33: mov L16, r2
+L34: mov L35, r2
+L35: .string ";"
+L36: .string ":1y0" ""
+L37: .data 1 , K , -5
+L38: .string "zaz" "zbxcc"
+.entry L39
+.string "yz0c.yc."
+L41: .string "x.bb"
+L42: .string ":x;y"
+L43: .string "y"
+L44: .string """
+L45: .string ":x11z."
+L46: .string "0:1zb:", "yx"
+L47: .data 1 , K , -5
+L48: .string "ccy" "x091"
+L49: mov L27, r2
+.data 1 , K , -5
+.string "cx"x"
+prn #K
+.entry L37
+L54: .data 1 , K , -5
+L55: .data 1 , K , -5
+.data 1 , K , -5
+L57: .string "1ya0abz"
+L58: .string "bxc;"."
+L59: .string "c101." "ayz;y9"
+ hlt
@@ -0,0 +1,62 @@
+.define K = 3
+L0: .string "y"#c#c:y"
+L1: .string ""bxy9"cb1", "#z#1b"
+L2: .string ".ya9z"
+L3: mov L24, r2
+L4: .string "yazyb.xyax"
+.string ".za0:;0ay"
+L6: .string ":b."10ab90.z" """
+.data 1 , K , -5
+L8: .string ""
+L9: .data 1 , K , -5
+.string ":9b"
+L11: .string "0:"
+.string ":cxy"
+mov L25, r2
+L14: .string "b.#;z:1y:c9", ""#"
+.string "b#." ".yz"
+.string ""#"
+L17: .string "0y.0"
+L18: .string ""
+.string "ac"
+.string "a":.1zbbx"
+L21: .string "..a0ya9"", "9"
+L22: mov L9, r2
+L23: mov L50, r2
+.string "0x"axcz0", "b#x:010"
+.string "b", "9x#y.z"
+L26: .string "1"
+L27: .string "caz0y9.bb"
+L28: .data 1 , K , -5
+.string "1"zxabb0"
+L30: .string "#"
+L31: .string "0.aaaz"a.0"z" "1"x0"
+L32: .data 1 , K , -5
+L33: .string "y#xczz:"
+L34: .string ":z11#z9"bx9"
+L35: .data 1 , K , -5
+L36: .string ";#"
+mov L59, r2
+L38: .string ":.0:".c."
+L39: .string "x"
+.entry L7
+.entry L25
+L42: prn #K
+L43: .string "xz"
+prn #K
+.entry L24
+.string "b0b;.9cy0bxx", ";:9"
+L47: .string """ "x":b:x99"
+.string ""
+.entry L33
+.entry L27
+L51: .data 1 , K , -5
+.string "#yc.yx.1:"
+.string ""c.":99b:0"
+.string ";09ycx..0::", "y1b9:.z;c0"
+L55: prn #K
+.string ";0bx:1bz"
+L57: .string ";"
+mov L38, r2
+.string ":1x:", "z1#yazxz"
+ hlt
@@ -0,0 +1,62 @@
+.define K = 3
+.string "c"
+.string "cyb"
+L2: .string "9#x1"
+mov L52, r2
+L4: .string "aa#1z0;.c9"z"
+mov L54, r2
+L6: .string ".0:99c;caz1""
+L7: .string "1"
+L8: .string "yyb", "b;"
+L9: .data 1 , K , -5
+L10: prn #K
+.string "c;z:;x9"
+.string ""
+L13: .string "ba"1b;.1ca"
+L14: .string ":a0;c;"
+L15: .string "0cx"b"
+L16: .data 1 , K , -5
+.string "aya10b.a;9x" ""0:b#b"
+.string "1x9c", "#09xbz."
+.string ";.z""a."
+.string "z;.101y1cz" "y9"
+.string "#1", "0a:.bx"
+.string "a.;c:xcy"
+.string "#"99"
+.string "z"a", ""aba:"
+L25: prn #K
+.string "0y191"0;z"y", ":.:cx:.9"
+L27: mov L54, r2
+.string "y1:#z"
+L29: .string "x;yy;z#xa#0#" "b.1."ca"
+L30: .string "#x9:#::#"
+.string "b", ";"x9y91""9b"
+.string "1y;:y", "b:yac;"
+mov L20, r2
+L34: .string "1byx;#x1b9"
+L35: .string ".bxa#bxc" ";."""
+.entry L37
+.string ".9###x#ab"
+.string """
+L39: .data 1 , K , -5
+L40: prn #K
+L41: .string "yz:a".9.x"
+.string "" "19.y"
+.data 1 , K , -5
+prn #K
+L45: .string "z0.1y"x01b;;"
+L46: .string "9cy.x." "x.#9b1a"
+.string "zbzz.1", ".b10c0x:1x#"
+L48: .string ".99a.b"
+L49: .string "axb9z;"z."
+mov L22, r2
+L51: .string ":1;:zac1"
+L52: .string ":c:"
+L53: .string "1.9" "xx:19x:.90b:"
+.string "a##"a0";z"1", "x;;.;x99"
+.string "ay;y;z::b;c9"
+.string "9z.1;c91c#a0"
+L57: .string "1a.9:199z"b"
+.data 1 , K , -5
+L59: mov L1, r2
+ hlt
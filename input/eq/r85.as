@@ -0,0 +1,62 @@
+.define K = 3
+.string "z"
+L1: .string ""z;x:09""9x#"
+L2: .data 1 , K , -5
+L3: .string "b01;:1#1"
+L4: .data 1 , K , -5
+.string "ca0;c"
+L6: .string "", ".z#cayb"
+.entry L35
+mov L15, r2
+.string "#y"
+L10: .string "yzxc":az09#"
+L11: .string "yzyc9ya0."
+mov L37, r2
+L13: .string "9..;yx;." "1z;::xx".0;"
+L14: .string ""z91c1:y1x"
+L15: .string """
+L16: .string ""
+L17: .string "#;", "a"
+.string "b.a#ac;"
+.entry L3
+L20: .string "cczcyb"
+L21: .string "bb""
+L22: .string ""
+.string ".xb#x#y#:.1:"
+L24: .string ".a;"
+L25: .string "x:;0;1" "9.c:900#"
+L26: .string """z01"
+L27: .data 1 , K , -5
+L28: .string "cx;".#9zb", ".1c1bbbb""
+L29: .string "by", "aay"
+.string ":aya#1:;"c"
+.string "#90"
+L32: mov L46, r2
+mov L12, r2
+.string ";;" "a.1x9"
+L35: .string "z"
+L36: .string ";#00.1"
+L37: .string "c..:c"x1xbzc"
+prn #K
+.string "9.0y0xx;cy"
+L40: .string "a."0#a:", "x#x"
+L41: mov L36, r2
+L42: .string "0bcy"
+.string "0:10.;xxx", "0001;0;;"
+.string "".yax:;."
+L45: .string "z;99aa0z;", "z.cz019:0"
+L46: .string "", "1x:zc091:c11"
+.string "10yb"010c9a"
+L48: .string "", "a;x"
+L49: .string "x;y90zc:z"
+.string "0#"zca1yc"
+L51: .string "" "zb.x:x0z.x0"
+L52: .string "0a;ax1.1".b"
+.entry L53
+L54: .string ""0by1:;0.c", "#0;#"
+L55: .data 1 , K , -5
+L56: .string "0b.", "y;a"
+.string ":bazb0z"
+prn #K
+.string "#yx"cz91", ""
+ hlt
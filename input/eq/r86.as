@@ -0,0 +1,62 @@
+.define K = 3
+L0: mov L53, r2
+.string "b.9.:y"."0b"", "1a;##x"
+.string "0y"
+L3: .string "c"1z00#"
+.string ""
+L5: .string "zz#:0;00;#"
+.data 1 , K , -5
+L7: .string "#10ab.acb#0"
+prn #K
+.string "a9a##az1x1" "y#cz.01."
+L10: .string ".0.9.c#za."
+.string "y#ayy"
+L12: .string "901z"
+L13: .string "b0"
+L14: .string ":00"y;:x";y:"
+L15: .string "0cxx"
+mov L23, r2
+.string "aabb1"#."
+L18: .data 1 , K , -5
+L19: .string "#"
+L20: .string ".";cxy9;z", "9y"
+L21: prn #K
+.string ":9;", ";1c.10"
+.string "zc"
+L24: .string "1" ""1ycxb"
+.string ":c" "#"0;y0#"
+.entry L47
+.string "9z;"99#c9z"
+.string "9"0"x#"
+L29: .string "".".z""cb"
+L30: .string ""
+L31: .string "b;#0axbz#", "b""
+L32: .string "z.;x0:"
+L33: .string "1a9;a10" ""
+L34: .string "00::z", "x09z0""
+L35: .data 1 , K , -5
+mov L51, r2
+L37: mov L31, r2
+L38: .string ";xyz"y:""
+L39: .string ";z", "z;1c"
+.data 1 , K , -5
+.string ""#1xxa"
+L42: .string "x:;;.cy:#" "0bb.#0.;xa;x"
+L43: .string ".#"
+L44: .data 1 , K , -5
+L45: .string "zc;"ab#.c"
+L46: .string "c;":"
+L47: .string "x1czc;by0z1z"
+L48: .string "#9"90."
+L49: mov L34, r2
+L50: .string "cyx"
+L51: mov L43, r2
+.data 1 , K , -5
+.string ":""
+L54: prn #K
+L55: .string "9xbyz0yb1bx"
+.string "0a:1.ac:"
+L57: .string "c0#b0;#"
+.string ".b9yy;#zc1#"
+L59: .string "##cb9z"
+ hlt
@@ -0,0 +1,62 @@
+.define K = 3
+.string "cz"b"
+.string ".:zb"
+.string "c;1"
+L3: .string "bb01b0"y.zc"
+.entry L14
+L5: mov L0, r2
+L6: mov L35, r2
+.string "9c91"
+L8: mov L35, r2
+L9: .string ""9"", "9:;#"
+prn #K
+L11: .string "9y:xz99a1cyy"
+.entry L57
+.data 1 , K , -5
+.string ".:a:".c"
+.string ""a9a1xy", ""za:.y";b0"
+.string ".90abccy", "a;#0yxxc;"
+.string "", ""
+L18: .string "1cy0a:z"
+.string "119cx9" ":y"
+L20: .string "";y.z"" "0x0"b"
+.entry L25
+L22: .data 1 , K , -5
+L23: .data 1 , K , -5
+.entry L47
+L25: .string "0"
+.data 1 , K , -5
+L27: .string ".9x"
+L28: prn #K
+L29: .data 1 , K , -5
+.data 1 , K , -5
+.string "##c;ycyy0:z" "xc""
+L32: .data 1 , K , -5
+mov L26, r2
+L34: .string ":9:0xx:"
+L35: .data 1 , K , -5
+.string ";0;yz":" "9c:"".".9z19"
+.string ";" "a""
+.string ";0c;.z0#"z"
+L39: .string "z:;"
+.string ".yy0azzza1#"
+.string "::a:c"zz;"
+.string ";#c"
+L43: .string "1cc91:0##"
+L44: .string "x0b;"
+.string "ccx#b9;y.bx"
+L46: .string "xx"
+L47: mov L48, r2
+L48: .string ".yxz", "z10c::#b:11"
+L49: prn #K
+L50: .string ".;b:aa"
+L51: prn #K
+.string "a:.bc1zb:#xc"
+.string "yz;:;19cy"
+L54: .string ";1" "cz0c""
+.string ""1.#", "9a90zyy:y;a"
+L56: .string "c#bcz:1a"
+mov L19, r2
+L58: mov L16, r2
+L59: .data 1 , K , -5
+ hlt
@@ -0,0 +1,62 @@
+.define K = 3
+L0: .string "c""
+L1: .string "bz9;.a.0c"
+.string "cx"
+.string "b#.0#.byx"
+L4: mov L5, r2
+mov L25, r2
+.string ".a0"
+L7: .string ""
+mov L38, r2
+.string ""xz"
+L10: .string ""
+L11: .string "0b0" "b.;cc;.aay9:"
+L12: .string "ab".0xc;9"
+.string ";#.b"zb";"
+L14: .string ".a0#;za0b"
+L15: .string "y"
+.string ""
+L17: .string ".#x;." "xb#09z"9zc"
+.string "aa#c"
+L19: .string "aa"
+L20: .string "a#zyc19yc"
+L21: mov L7, r2
+L22: .string "9##0;#c:.y#"
+L23: .data 1 , K , -5
+L24: .string "c#", "c"
+L25: .string "11"
+L26: .string "1;y9b:a;" "9y999:"
+.string "yb.x.cbb"
+L28: .string ".a:;azx1xz"
+mov L56, r2
+.string ";"
+L31: .string "x"
+L32: mov L1, r2
+L33: .string "1a.#bzb#"
+L34: .string "01"
+L35: .string "1#c"
+L36: .string "b"
+L37: .string "a1:9xz":bxa", ":xa1y;ab"
+.string ""z;"x:a"
+L39: .string "z#"
+L40: .string ""baz"
+L41: .string "z"00xbyy1"
+L42: .string "cz0azb", "axx.z:c:"
+.string "#:.0x.9#z", "901x".z#"#"
+.string "9xbx"
+L45: .string "zc", ""#0:"00;"
+.string "yxz0;"
+.data 1 , K , -5
+L48: .string "ay19"#:0#b" "91"
+L49: .string ".:", "a9yza;c9#"
+L50: mov L21, r2
+L51: .string "x9x":;"
+prn #K
+.string "zaz##01", "x9bc;bzyx#1"
+L54: .string "9z:xcaa.";"
+.string ".czy"
+.string "11."
+L57: .string ".x::#9;0""
+.entry L53
+.string "cy01.c"
+ hlt
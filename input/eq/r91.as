@@ -0,0 +1,62 @@
+.define K = 3
+L0: .string ":c01"#.111"
+.string "#1x#x"
+.string ":1.9:y09#"z0"
+mov L44, r2
+L4: .string "0:" """xy#a9a"
+L5: .string "9"
+.data 1 , K , -5
+.string "c;";"1:z1;"x" "#za;0c."
+mov L13, r2
+.string ";b" ""
+L10: .string ""
+L11: .string "9yxzzb0"::" ";90"
+L12: .string "#9yy", "ac"
+.string "#b" ""1:z1"
+.string "y;.c:.a.;:"
+L15: .string "90z"
+.string "yybx"
+L17: .string "#c."
+.string "":;b9z9y"
+L19: .string "1#byzazc.x"
+.entry L12
+mov L12, r2
+L22: .string "."
+L23: .string "b91z#", "9z0"b9;9.;"
+L24: .string "x9:", "cb;"c.;#"
+L25: mov L37, r2
+.string ""
+L27: .string "c"
+.data 1 , K , -5
+L29: prn #K
+.entry L29
+.string "bb#yx0"
+L32: .string "bb.b9:1b";b"
+L33: .data 1 , K , -5
+L34: .string "9z:y1b" "bz:yx;9xz;y"
+.string "11yz:c0", ".z;1.1b99:"
+L36: .string "x;9#"
+L37: mov L2, r2
+.string "zxy;99"
+L39: .string "z#9#yy#y0y9"
+L40: .string "9cc.b"z", ":b1;".0;xb"0"
+L41: .string "9"
+.string "ac:"cx01#x", "a#"::b9z.z"
+L43: .string ""b9:;0x.x#1"
+.string ".bb", "#0.z0bby.11"
+L45: .string "a1.#yaab:9c" "0b"
+.string "y";:;a:0ba"
+L47: .string "a:y:b0"
+L48: .string "b"
+L49: .data 1 , K , -5
+L50: .string "."
+L51: mov L34, r2
+.string ".ay"
+.string ""
+.string ":a0bz0#z0"
+.entry L41
+L56: .string "0y:b1.bzya:#", "y"
+.data 1 , K , -5
+L58: .string "::yz:z;yy"xz" ""
+.string ".#"", "9y19##:.:0:"
+ hlt
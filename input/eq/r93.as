@@ -0,0 +1,62 @@
+.define K = 3
+L0: .string ".zbbzcc0b", "a;9b:;"z0"
+.data 1 , K , -5
+.data 1 , K , -5
+.string ";y", "x#1bb"
+.string "b" "#ax;"
+L5: .string "".b10c." ":9"
+L6: .string ";b9ay", ""
+.string "1aa90"c9y"
+prn #K
+L9: .string "aza", "b:zx1a9z;y"
+.string "90ycaya":"
+.entry L48
+L12: .string "9;zaa" ";;byb9aybc"
+L13: .string ":0cx;c0" "#9cx1a1"0cy"
+L14: .string "#0b1"0a#0x;"
+L15: .string ""
+L16: .string ";xcz:yxy:9x"
+L17: .string "cca:x"
+L18: .string "y;:"0:xyc.x;"
+L19: .string "1:ya#"z.z9:"
+.string "9"x#"9c#"."
+L21: .string ""
+L22: .string "a;y.."c", "b"c;x0b1""
+L23: .string "aca#;9a;z"
+.string "cx.1cb#" "x"b9"
+L25: .string ":x911z", "19#a#"
+L26: .string "0az"aa:zc"
+.data 1 , K , -5
+L28: .string ""
+.entry L31
+L30: .string "1;z1"by.b1#"
+.string ""
+L32: .string ".:01;0y"y#yz"
+prn #K
+L34: .data 1 , K , -5
+L35: .string "c"1#y"
+.string "x0axy:z9"
+.data 1 , K , -5
+.string "zx1"
+L39: .string "b1"9a:#9b"
+.string ".1c9"
+L41: .string "a9;b"#c;", "yc"
+L42: .string "", "1"
+L43: .string "bcx#xa.ayz:."
+L44: mov L31, r2
+.string "11#:yc"#9zb"
+L46: mov L58, r2
+mov L18, r2
+L48: .string "cb1", """"
+L49: .string "yz090;.;0"
+L50: .string "..az.yx"bb"
+prn #K
+L52: .string "#91y:", "#xxa"
+.string "b1.b01cc9c:c"
+L54: .string "x"
+.string ":1bca#" "y#"
+L56: .string ":1:.x", "1019y:x"""
+L57: .string "x;:0"
+.string "ac#bzbxx;ax""
+L59: .string "";:19::.", ""
+ hlt
@@ -0,0 +1,62 @@
+.define K = 3
+L0: .string "y0"a" "y0;"y"
+L1: .string "z1z#x:"
+.string "yc"
+L3: .string ""b#z", "za9#ay:"xa"
+L4: .string ""
+.string ";x1a.x9"
+.string ".;;yac:9::" "xa0;;;.c.xc:"
+mov L32, r2
+L8: .data 1 , K , -5
+L9: .string "c9:;"c", ":0c1""
+mov L19, r2
+.string "x;:a9" "x:"
+L12: .string "x:a10.0"
+.string "czx0bab.b"
+.string "1yby9#0:z"
+.string "#.#1#y0za"
+.string "9"
+L17: .string "1#z#1#b"
+L18: .string ""..y9bx.c9#"
+.string ";zcyz9xc:"
+L20: .data 1 , K , -5
+L21: .string ":9x:a"
+.string ":ccz"
+.string "x", "x#..ya":"
+L24: .data 1 , K , -5
+.string "#b:;10""
+L26: mov L24, r2
+L27: prn #K
+L28: mov L54, r2
+L29: .string ".b0.cy1110bz" ""
+L30: prn #K
+.string ":x1", "0#czx;#"
+.string "9;."#za91"
+.string "#ax9"
+L34: .string "bb#;0";x"
+prn #K
+.string "z;.b"z0;"
+.string ""cc#"
+L38: .string "c#b;:#0"
+mov L19, r2
+mov L2, r2
+.string ";".#9a" "#;za."
+.string "00y."b"
+.entry L22
+.string "a;"
+L45: .string "a;xza.;a"
+.string "1" ""
+L47: .string "x1a;"
+L48: mov L34, r2
+L49: .string "1"a1x"
+L50: .string ".b"
+L51: mov L19, r2
+L52: .string "bcz"
+L53: .string ":azzy9"
+L54: .string "9;#:#y;", "cy.9z":xz#0"
+L55: .string ";"#"
+L56: .string "a""
+.string "y91y:#cx"
+L58: .string "yzzx#9bxy"
+.data 1 , K , -5
+ hlt
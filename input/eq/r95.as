@@ -0,0 +1,62 @@
+.define K = 3
+L0: mov L47, r2
+.string "1a" ""
+.data 1 , K , -5
+.string "x::bzy.#0"
+L4: .string ";c;0;"
+L5: .data 1 , K , -5
+L6: .string "1yaaz.99;z"
+L7: .string "bc#b;a"
+L8: .string "1".:;c.:"
+.data 1 , K , -5
+.string "1"
+.entry L20
+.string "xycx#bc9"
+L13: .string "#1:."az#y"#c"
+L14: prn #K
+L15: .string "#9ca:.y0z0:" ""
+mov L29, r2
+L17: .string "yaz"
+.string "#c"
+L19: .string "0;#1x""z1#0"
+L20: .string "19"cb91#9bb0"
+L21: .string "9..:"
+L22: .string "z1ab19ba:xz", "aa1"
+L23: .string "ycc0x;""9a9#"
+mov L27, r2
+mov L12, r2
+L26: mov L41, r2
+.string ""
+.string ":x19#ax"
+.string "0.;;xy"
+L30: .string "xxcxxazx;.x", ";bb9y"9bxc:"
+L31: .string ";9c"ba#y91"
+L32: .string "b0cb9"
+L33: mov L13, r2
+L34: .string "#x1#axxbby" "#19cca0c9#"
+L35: .string "b.";"
+.entry L24
+L37: .string "";" "0bx#c;"
+.string "#y;x;9#b.""
+.string "x:";"ba"xc."
+L40: mov L38, r2
+L41: .string ""
+L42: .string ";1"
+.string "y;" "0xay0z"
+L44: .string ""
+L45: .string "a.9"
+L46: .string "zzby0y"
+.entry L28
+L48: .string "ayx9y"
+.entry L6
+L50: .string "y11"
+L51: .string "91axx;ac1cc."
+L52: .string "xb"#y"
+.entry L32
+.string ";91y;.#.:" "0x1b""
+L55: .string "y"" "::1x1zx;9yy1"
+L56: .string ";;0.x0" "b;.a"
+L57: .data 1 , K , -5
+L58: prn #K
+L59: mov L47, r2
+ hlt
@@ -0,0 +1,62 @@
+.define K = 3
+.string "xb"z#a"
+L1: .string "byzzy"
+prn #K
+L3: .string "zx."z9#"
+L4: .string "1"
+L5: .string ";."
+.string "";:y" "x#00#;ay"9z""
+.data 1 , K , -5
+.string "x.1#zxa;y"
+L9: .string "" "ba"
+L10: .string "#."
+.string "9"
+L12: .string "x"
+mov L5, r2
+L14: .string "x" "1y"
+L15: .string "ab9"##1z0ca"
+.string "#91#"
+.data 1 , K , -5
+L18: .string "09""
+L19: .string "9#y"
+L20: .string """
+.entry L35
+L22: .string "#bc1.x"
+L23: .string "::0c"
+.string ";c99bc:"" "x#xccxy0y"
+.data 1 , K , -5
+L26: .string "#a0" "xz0a"ayc"0yc"
+L27: .string "zcx""11"9zz" ":9a#xx:9y"
+L28: prn #K
+L29: .string ":y..1xz."
+L30: .string "0:b"
+.string "b;;"c" "cb"bzy"
+.string "y#yz"
+.string "zx9#9czx.a#"
+L34: .data 1 , K , -5
+L35: .string "bcy1acazyac."
+L36: prn #K
+mov L6, r2
+L38: .string ""0"ya19b9", "1xc:c:1y"
+L39: .string "c1b#9;:y:" "ab;x1:"
+.string "c1b9z9yx"
+.string "yb0:x90.y", "a1x9.c:0:#"
+.string "0:", "x"
+L43: .string ""b#yz"
+L44: mov L35, r2
+L45: .string "czyzx10"x9az"
+mov L10, r2
+L47: .string "9b9bcaa" "by"x;9;a:bx"
+.data 1 , K , -5
+.string "0:0b9" "b91"
+.string "ay;00y09#9"
+L51: prn #K
+L52: .string ""ay:"
+L53: .string "x"
+.data 1 , K , -5
+L55: mov L44, r2
+.string "9::1;:9a:"
+prn #K
+L58: .string ""
+.string "xyb9"
+ hlt
@@ -0,0 +1,62 @@
+.define K = 3
+.string """#a;"
+L1: mov L47, r2
+L2: prn #K
+L3: .string "b"zxycy#09"
+.entry L34
+.string "bb"
+.string "."
+.string "a;"
+L8: .string ";xac.a"c1a;", "a..a91."
+.string ""
+.string "9;x900z#"
+.string ";yzax"
+L12: .string "99;:.b;x"
+L13: .string "a1y9ac9"
+.string """ "xz".b9"
+L15: .string "1x"
+.string "c1c"
+L17: prn #K
+.string "a.a"
+.string "b#;1ycbay", "cbc#;c0c:#"
+L20: .string "c#:""
+L21: prn #K
+L22: .string "9c91:.", "";9."""
+L23: .string "09;x#x", ".";"
+L24: .string "cx1"
+.string "9bz#;0c#b:"
+prn #K
+L27: .string "91z1"""9.:1y"
+mov L46, r2
+L29: .string "y9zxxzb01" "..:x:"
+L30: .string "xabx:"
+L31: .string "9xy"
+L32: prn #K
+.string ":9" "0x99;.x"1""
+L34: .data 1 , K , -5
+.entry L49
+.string "#"
+L37: .string ""
+L38: .string "90.9#"
+.string "x.#;c"
+L40: .string "ac;b#ca#0c"
+L41: .string "9x1:#z#baaxa"
+.string ""y"
+L43: .string "9:b", "z:0.0"
+.data 1 , K , -5
+.string ""
+mov L53, r2
+mov L13, r2
+L48: .string "b1x"1b;a" "cacyxa0:1y"
+prn #K
+.entry L29
+.string ";"z0ya"
+.string "c.y.;;01y9":"
+.string ".0.9:z" ".1yz.ac;x:"
+.string "#b1yx:19y"
+L55: .string "z:c;z;"
+.string "#y9#;;xx"zb9"
+.string "x""#"b"
+L58: .string ".0" "c;0:1:":"
+L59: .string "";"
+ hlt
@@ -0,0 +1,62 @@
+.define K = 3
+.string "0a1y."
+.string "0a:" "#za###a#0#y"
+.data 1 , K , -5
+L3: .string "c0c;9"xy", "x9"
+L4: mov L58, r2
+.entry L52
+.string "1c.y9"
+prn #K
+.string "#z::9a9a", "zyx"
+.string ""
+L10: .string "0a0.."
+L11: .string ""
+.data 1 , K , -5
+L13: .data 1 , K , -5
+.entry L55
+L15: .string "b#;b0"0x"
+mov L31, r2
+L17: .data 1 , K , -5
+L18: .string ""#00a1;.ac"
+L19: prn #K
+L20: .string "z;c9cy1"" ":""bz"
+L21: .string "xx#az10b."
+.string "a", ""#";a"
+L23: .string ";x":#1z1:a"
+.string "" "c1"
+mov L34, r2
+.string "0;9byc..", "a.cz#:0zb""
+L27: .string "1c"
+.string "0"
+.string "b;":"
+mov L56, r2
+.string "acx19"
+L32: .string ":y" "x.9909"
+L33: .string "9", ""
+.string ""
+.data 1 , K , -5
+L36: .string ";xa1y0"
+.string """#0"
+.string "abcc:", "b:c"0:z10x."
+L39: .string """;z."a;z.0z" "":;;#zx;#1a""
+L40: .string "b#""
+L41: mov L26, r2
+.string "x::;x0.z;" "1"
+.string "##99zzx0.c:"
+mov L6, r2
+mov L12, r2
+L46: .data 1 , K , -5
+L47: .string "" "b1z:#:"a9c"y"
+.string ""001"
+.data 1 , K , -5
+.data 1 , K , -5
+L51: .string "yb."
+L52: mov L40, r2
+.string """"
+.string "9b#x:ycb.", "y190;:"
+L55: mov L24, r2
+.string "cc1.b:10yb11"
+.entry L25
+L58: .string "9#y", "a#:9"xz#a"
+L59: .string "b"
+ hlt
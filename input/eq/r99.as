@@ -0,0 +1,62 @@
+.define K = 3
+L0: .string "xx"
+.string ":.9b;1x0"
+.string "z"0":xc1:c";" "9:#b1z0ay9a"
+.string "1"
+L4: .string ""
+.string ".#"
+L6: .string ":cabac1:", "0"
+.string "zc90x#"
+L8: .data 1 , K , -5
+.string "z." ""
+.entry L47
+.string "b"
+.string "cx9z#1"
+L13: prn #K
+L14: prn #K
+L15: .string ""azx00z"#"
+L16: .string "c"
+.string "#1xy":", "yb"..zx##.:"
+L18: .string "1"
+L19: .string ":"z#", "y0"
+.string "cy0::;";:"
+L21: .string "za:"
+.string ":c#:y:0.#""
+.string "0ab99xa9y:"
+L24: .string "1xy.".0199:;", ";#yx.ab#yb;a"
+L25: .string ":.;;yx#b"
+L26: mov L11, r2
+L27: .string "1""
+L28: mov L45, r2
+L29: .string "1;"."
+prn #K
+.string ":cb9x19"
+L32: .string ":.a;:"
+L33: .data 1 , K , -5
+L34: .string "a0aaz9x9#"
+L35: prn #K
+L36: mov L12, r2
+L37: .string ":zb9"
+L38: mov L22, r2
+.data 1 , K , -5
+.string "c"cc9ba#9:0"
+.entry L39
+.data 1 , K , -5
+.string "#:0xy"
+L44: .string ".ax0:#b#"
+L45: .string ";"b"c"c#1zyz"
+L46: .string "ca" "9yyb10#bazc;"
+prn #K
+prn #K
+L49: .string "9c."
+mov L47, r2
+L51: .string "xc90axx:yc";"
+.string "cc:"
+L53: .string "#0ca:a901", "xz0c1;bz9"
+L54: mov L45, r2
+.entry L12
+L56: .string ".xc":yc", "#9""9bxx9x"
+L57: .string "x"
+L58: mov L12, r2
+.string ""
+ hlt
@@ -0,0 +1,24 @@
+.define n = 2
+.extern EXT
+.entry LIB
+MAIN: mov r1, r2
+ jsr SUB
+ lea MSG, r3
+ prn DAT[1]
+ hlt
+ inc r1
+DEAD: dec r2
+ jmp DEAD
+SUB: add #2, r1
+ rts
+LIB: clr r4
+ jmp HELPER
+UNUSED: not r5
+ mov UNDAT, r1
+HELPER: rts
+MSG: .string "hi"
+DAT: .data 1, 2
+ .data 3
+UNDAT: .data 9, n
+ .data 4
+ORPHAN: .string "zz"
@@ -0,0 +1,42 @@
+.define K = 3
+.string "byb1#11:0#xb"
+.entry L38
+L2: mov L28, r2
+.string "bzaaa:9a0"
+.string "x#119xzx", "1ya0"9:bc:.""
+mov L32, r2
+L6: .string "xyy;1"90;"", ".#0"
+L7: .string "#:.zb1:9b#c"
+L8: .string ""
+.string ";;0:cc9xa"
+.string "09z" "z1y:9;.a0"
+prn #K
+mov L33, r2
+L13: mov L3, r2
+L14: .string "x901"z0z"
+.string "1;a#x" ";c"b#9#""
+.string "bb"a1a##yx"
+L17: mov L18, r2
+L18: .string "c:y:.y1."
+L19: .string "z0#xyb"
+mov L38, r2
+.string "a0c"
+L22: .string ":09"x:#.", "9:a"
+L23: .string "0a.ycxayb"" ".c0;"
+.string ""
+.string "c"""#.;"
+L26: .string ";:0"
+.string "y91az;"
+.entry L12
+.entry L36
+L30: mov L13, r2
+L31: .string "9z":91"
+L32: .string "" "c9"
+mov L16, r2
+L34: .string "x";#"
+.entry L35
+L36: mov L26, r2
+.string "c"czb;;#0b;9"
+L38: .string ";9b1"
+L39: .string "a;:a"
+ hlt
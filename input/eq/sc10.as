@@ -0,0 +1,42 @@
+.define K = 3
+L0: .string "ax1"1"y:#" "1zbx.za0"
+L1: .data 1 , K , -5
+.string "c:y:zc1"
+.string "0a;axcxy9", "z:9"
+.string ""9c"x"
+L5: .string "";:b"
+.entry L36
+.string "b#", "c#xz001"
+.string ""b"
+.string "#c"
+L10: .string ""
+.string "by1"
+.string ":x.9y91"
+L13: .string "0c09;z9"
+L14: mov L6, r2
+L15: .string "", "9bazbcb"
+prn #K
+.string "91z.y#.10z:9"
+L18: .string "a:x:;;":1"
+L19: .string ".yb"
+.string """, "1cz;0#xzcb"
+.string "y1".#."9.0"
+L22: mov L38, r2
+.string "ax0;0"0"#:"
+mov L3, r2
+L25: .string "#x:.y1"
+L26: .string "01:z" "11"1"
+L27: .string "#.0#c"
+.string ";", "a;z:"
+mov L18, r2
+L30: .data 1 , K , -5
+L31: .string ""
+mov L12, r2
+.string "";a0xz";x9#;" ""a:.;"
+.string "z;:c#c" ""zca.99#zb01"
+L35: .string ".1;1.1;"
+prn #K
+L37: .string "0xb0:ca"
+.string "0#z90a;ac"
+L39: .string "b:", "y""
+ hlt
@@ -0,0 +1,42 @@
+.define K = 3
+L0: .string "c.0.z09#b9bb"
+.string "xzxy"#xccx"
+L2: .string "019"
+L3: mov L40, r2
+L4: .string "c#";cx"
+.string "#:0c;9#"
+.data 1 , K , -5
+L7: mov L18, r2
+L8: .data 1 , K , -5
+L9: .data 1 , K , -5
+.string "#a"by:", """."
+L11: mov L31, r2
+L12: .string "", "ca#y."
+mov L14, r2
+.entry L13
+.data 1 , K , -5
+L16: .string "" "x"9b.;x"
+L17: mov L9, r2
+.data 1 , K , -5
+L19: .string "1ca#1"#axxc"
+.string "y"
+L21: .string "011z.19x", "0c"x"
+.string "0"y""
+.string "yay#ya"
+L24: .string "0a:", "::.:"
+L25: .string ":1a.#"
+L26: .string ""z"#9cc.a", ""
+L27: .string ".1xxc;" "yb:1:.c0"
+L28: .string "c"b;" ""
+.string "b"
+L30: .string "1b"
+.string ";"cc#9;c"
+.string "..b:"1", ":"
+mov L18, r2
+.string "xaax9"
+L35: .string ""
+L36: .string "a:"9;ya"
+.string "." ".x1.abxzz"
+L38: .string "1;xzbcz;#:;"
+L39: .string "z"
+ hlt
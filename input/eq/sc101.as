@@ -0,0 +1,42 @@
+.define K = 3
+L0: .string "z1a:9x;x" ".#xz1by"
+.string "x1#zx"
+L2: .string "1yxb:""
+.string "0#0x"
+.string ""
+L5: .string "az.zay;"ca0c"
+L6: mov L23, r2
+.entry L10
+.string """c."
+.entry L4
+L10: .string "1""b:.;#;#1"
+L11: .string "x.91cbcyz0ba"
+L12: .data 1 , K , -5
+L13: .string "bycy1"
+.string "xby:c"
+.data 1 , K , -5
+L16: .string "zx#y1:x9;9zz"
+L17: .string "00:a."
+L18: .string "c"
+L19: .string "x:::"z9::9"
+L20: .string ":y.y"
+L21: .string "#axa"
+.string ":ay9.xa"
+.string ""
+.string ";c1.#":aa."y", "."
+L25: .data 1 , K , -5
+L26: .string ".0byaxz" "9bx.x:cc.;#:"
+L27: .string "9.#"
+L28: .string "9az9c;:1c" ""
+.string ";by0#c.ab" "abyyxc.""
+L30: .string "#.:z.axy0x1" "c;c111"
+.entry L12
+L32: .string "9ya#"
+L33: .string ".::;z##1;y"
+.string "c"
+.string ""
+L36: .string "a0c"
+L37: .string "c0.:#..1yz""
+L38: .data 1 , K , -5
+.string ":1yx0"9a"
+ hlt
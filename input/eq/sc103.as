@@ -0,0 +1,42 @@
+.define K = 3
+L0: .string ".."x.b;.b:0", "":b1b"
+.string "" "."
+L2: .string "".;.:0" ";#";xbzx;x"
+L3: .data 1 , K , -5
+L4: .string "#9#"
+.string "a1"c" "yb1zb"":"
+L6: .string ";"
+L7: .string ""
+L8: .string "1y.bc1#az:y" "x;x;xx0c"
+L9: .data 1 , K , -5
+L10: .string "c:azy::""
+L11: .string "ccyz9""
+.data 1 , K , -5
+.data 1 , K , -5
+L14: .string ":.b"a;0:.c"
+prn #K
+L16: prn #K
+L17: .string "yy9a0#", "###0c"
+mov L36, r2
+.string "ab1a"zcx;" "0"by:a:;#:"
+L20: .string "9z"
+mov L35, r2
+L22: .string "#b#y#0"
+L23: .string ":;91.;xzbz"
+.data 1 , K , -5
+.string "0#.a:y1"
+L26: mov L6, r2
+L27: .data 1 , K , -5
+L28: .string "bbb"
+L29: .string "yc1zz.:yb90"
+.string ".1"
+L31: mov L28, r2
+mov L2, r2
+L33: mov L10, r2
+.string ""#.::z0byz"
+.string "a:a"19xzya"
+L36: .string ""
+.string "1y0"
+L38: .string "#":"
+prn #K
+ hlt
@@ -0,0 +1,42 @@
+.define K = 3
+.string "#x0za.c#"ac", "bb"
+.string ";y0"
+L2: .string "0a11", "c";a"
+.string "y9" "z"
+.string "a" "##91:cx"
+L5: .string ""
+L6: .string ";1b"
+L7: .string "xbb1;9.0:"9"
+L8: .string ""
+.data 1 , K , -5
+.entry L33
+.data 1 , K , -5
+.string "ax#1"
+L13: .string ";b""
+L14: .data 1 , K , -5
+L15: mov L4, r2
+L16: prn #K
+L17: .data 1 , K , -5
+L18: .string "xb"
+.entry L37
+L20: mov L12, r2
+L21: .data 1 , K , -5
+L22: mov L15, r2
+.string ""
+.entry L25
+L25: .string ""
+L26: .string ";#;1yb"
+L27: .string ";c1ac9y0ayz9"
+L28: .string "1#"
+L29: mov L19, r2
+L30: .string "x"
+L31: .string ".""byb#z#z11"
+L32: mov L13, r2
+L33: .data 1 , K , -5
+L34: .string "zc:0y;x"x" """
+.string "x."
+L36: .string ".a"y:;1cxb9", "ca.y"
+L37: .string "b;9xb0" "::""
+L38: .string "b9:z"1y0:z1."
+L39: .string ";"#a0z:9#:"
+ hlt
@@ -0,0 +1,42 @@
+.define K = 3
+.entry L6
+L1: .string ";zyc"zc#cb:0", ""0"
+L2: prn #K
+.entry L11
+.data 1 , K , -5
+L5: prn #K
+.string "bz".#:c"""
+L7: .string ";#::1";9"
+.string ".b;0zy.y"
+L9: .string "0"z";#a9xxa;", "#.01#"
+.entry L4
+L11: .data 1 , K , -5
+L12: .string "x:z0yb"#bb" "0""
+.string "xx#b"
+.string "x;"yy"b1"
+L15: .string "#a;c.c#", "a:.1"""z#x:"
+L16: .string ":0z:#"
+.string "yb#:"xa:a9bz"
+.string "":111:1c1aa:"
+L19: .string "c;"
+L20: mov L24, r2
+.entry L26
+L22: .string "#."19b#0a.;"
+.data 1 , K , -5
+.data 1 , K , -5
+.string "c.ab99;:b:a" "9yy91z"
+.string "9y.x0zyzazx" ";001"
+.string """ "by#"
+L28: .string "#y.0.z:", ";ab1a"
+L29: .string "1cyz0xb9ycyx", ";a#;c9a0b"
+.string "11ayc"
+.string ""
+L32: .string ":z9"
+L33: prn #K
+mov L10, r2
+L35: .string ";;.x""
+.string "z1:0;cc"
+L37: .string "b"
+.entry L24
+L39: .string "".;a:.cz9#xb"
+ hlt
@@ -0,0 +1,42 @@
+.define K = 3
+mov L1, r2
+L1: .string "a#y#bx#" "01.:y"
+L2: mov L30, r2
+L3: .data 1 , K , -5
+L4: .string "zz"""
+L5: .string "zb.c#.z1.9y"
+L6: .string "c1"
+L7: .string "xczyc;"""
+L8: .string "90x:0x:", "#:0":."
+.string "9b.b#9.." ".x9"ax"b"
+L10: .string "x#c:"
+.string ""ybz"1a099" "y"ay"
+L12: .string "a;"
+.string "9z."zb##a"y9" ""
+prn #K
+L15: .string "azzx#:1x;#z9"
+.entry L26
+L17: .string "yc910y":"
+.entry L12
+.string "ayczcb9:"
+L20: .string "1b"
+L21: .string "9;11:bb;z" "xbxa":y;;#0a"
+L22: .string ""
+.string "0", "z1c1;#;y"
+L24: .string "9:;"
+L25: .string "19"":"
+L26: .string "yy0;a"
+L27: .string ""
+.entry L39
+.string ".101:c1cc0"
+L30: .string "#91a""
+.entry L15
+L32: .string "#."xyc", ""
+L33: .data 1 , K , -5
+L34: .data 1 , K , -5
+L35: .data 1 , K , -5
+.entry L15
+.string "b1"
+.data 1 , K , -5
+L39: .string "xa;9" "b:.;c"1z:ba"
+ hlt
@@ -0,0 +1,42 @@
+.define K = 3
+L0: .string ":01#yc09#by"
+.string ""zxc"
+L2: .string "cxzbbcb1"
+L3: .string "00"""
+L4: .data 1 , K , -5
+L5: .string "a"0..ycxx;b;"
+L6: .string "":x:y#11##"
+.entry L0
+.string "a10".b:9z"
+L9: .string ".9;yy00:":z"
+.string "000", "1##0;:"0.by"
+L11: .string ""
+L12: .string "1b"
+.data 1 , K , -5
+.string "0yz" ""1"
+.string ""
+L16: .string "c:1.0.a#:c"
+L17: .string ":"yaa", "c""
+L18: .string "b:zc;."a9;"
+L19: .data 1 , K , -5
+L20: .string "xx"
+L21: .string ";baab;"
+.data 1 , K , -5
+.string ":by"
+L24: mov L6, r2
+L25: mov L35, r2
+L26: .string "za"
+L27: .string "z0y#9"
+L28: .string "1.09#0."
+L29: .string """
+.string ""
+L31: mov L38, r2
+L32: .string "c09a"
+L33: .string "b19#"
+L34: .string ".0""
+.string ".1:10;1abac"
+L36: .string "#z#0"
+.string "b#y;.1" "0b1":yyc1"
+L38: .string "az"
+L39: mov L13, r2
+ hlt
@@ -0,0 +1,42 @@
+.define K = 3
+L0: .string "abx91y;9"
+L1: .string "":cy.9"
+L2: .string "#a.z;xc;.c"
+.entry L28
+L4: .string "a."
+L5: .string "b"y.x#1"
+.data 1 , K , -5
+L7: .data 1 , K , -5
+L8: .string "1a#a0b1y##"
+L9: prn #K
+L10: .string ""90y;x9"
+.data 1 , K , -5
+L12: .string "ay""
+.string "y;" "01"911x"b.y"
+mov L4, r2
+.string ".c1"
+.string "a;0c#bc#"""
+L17: .data 1 , K , -5
+.string "#z"
+L19: .string "ab"
+.string "::#"
+.string "yxy"
+.string ""
+L23: mov L31, r2
+.data 1 , K , -5
+.data 1 , K , -5
+L26: .string ""0:"
+L27: .string ":y:;;.;:;;9"
+L28: .data 1 , K , -5
+L29: .string "az9:aa:z.99:"
+.data 1 , K , -5
+.string "ac.xxz";.9"
+L32: .string "b"..1.#.aa0a"
+.string "y"".yaz"", "aaz0.y0cbc:"
+L34: .string "a99::."
+.string "#;0:z"
+L36: .string "":.9.a;x.z"
+prn #K
+.string "c"
+.string "y:;9"
+ hlt
@@ -0,0 +1,42 @@
+.define K = 3
+L0: .string "119";xc#91:;"
+L1: .string "9"
+L2: .data 1 , K , -5
+.string ".;:c;a"9ba", ";a#"
+.string "x:y1a:b1"
+L5: .string "."
+L6: mov L1, r2
+.string "b"y0ba"
+L8: .string ""
+L9: .string ";", ":yzbyza0#bcx"
+L10: .string "c:9x19x"
+L11: mov L24, r2
+L12: .string "ay""
+L13: prn #K
+.entry L25
+.string "bacx1ya#;", "0bbb"
+L16: .data 1 , K , -5
+.string ";1"
+L18: .string "cyx";x.xc."
+.string "1;b0ab" "yx..0y0""
+L20: .string "bcx19:";;by"
+.string "y", "aac"
+.string "z" "z:..9;c"
+L23: .string ".yaa;", "b.yzcbb"
+L24: .string "..c#zzb:1b""
+L25: .string ";a;:00;", "b"
+L26: .string ".z0..;"
+L27: .string "#9ay;b1a"
+L28: .data 1 , K , -5
+.data 1 , K , -5
+L30: .string "c:;x"
+L31: mov L28, r2
+L32: .string ":yx:0#"
+.string "x;zxcc", ""
+L34: .string "b1", ""00"
+L35: .string "1zb"ay";a"
+L36: .string "#;a:c01xa#"
+L37: .string ""
+L38: .string "::#zb:xx"
+.string "19.acxy#z9.9"
+ hlt
@@ -0,0 +1,42 @@
+.define K = 3
+L0: .string "x01.y:9.b", "z.ab"9bc"
+.string "#:xyyzz9b"
+.string "y:cxy01", "x"b1zzx"
+.string "ca;y"
+L4: .string "191"
+mov L23, r2
+.string "9"az0b"
+L7: .string "9b"
+.string "c:b;:9.y"a9"
+L9: .string "a"
+L10: .string ""
+L11: .string "" ""
+L12: prn #K
+L13: .string "y:1xy"c9x:;", "9.1yxx09x1"
+L14: .string ""
+L15: .string ".y.x" "x;#x;0c"
+L16: .string ""b"bb:"
+L17: .string ";xx0:#"x", ":#""9c0z0""
+L18: .string "zc"
+.string ";0;" ".9ya1z99z".;"
+L20: .string "1c9x"0"yy19a"
+L21: .string "xa"
+.string ""
+L23: prn #K
+L24: .string "xb11::x" "c"
+L25: .string ""zbya1;"
+L26: prn #K
+.string ".9aay" ""
+.string "0xy0y;z09;;1" "0zxc9.bxaac"
+L29: .string "c"
+prn #K
+L31: .string ""0"
+L32: .string "a:"ccc;czbb"
+L33: prn #K
+L34: prn #K
+L35: .string "1a.aca1"
+L36: .string "", "#a1;y90z#;"
+L37: .string ":9;cby9b:a#."
+L38: .string "b", "c#a.:c0"
+.string "xbcc"#" "zbb"
+ hlt
@@ -0,0 +1,42 @@
+.define K = 3
+L0: prn #K
+L1: .string "0;#c:x", "xc:10"0."
+.string "z1#az:#:x;10"
+L3: .string "bz1x"
+.entry L1
+L5: mov L32, r2
+.string "y.11"1"9b.:", "c#ac1:#19"
+L7: .string "1.c", ";#"
+L8: .string "" ";.xc###"c"
+L9: .data 1 , K , -5
+.string "":b";b"0zx.x"
+L11: mov L33, r2
+L12: .string "y"
+.string "x""
+L14: .string ""
+L15: .string ";baa9zyzx:";", "zc0z"
+L16: .string ";:z";0b0"." "9yb:#a.x9"
+.string "zy9;;x"b#", """
+.string "9.b;;1a1z"
+L19: .string "ay9:ax:19y"
+L20: .data 1 , K , -5
+L21: .string ";a01xx.y"
+L22: prn #K
+mov L20, r2
+.string "#01c"9#0111"
+L25: .data 1 , K , -5
+L26: mov L28, r2
+.string "xy"yy;y#:0:"
+.string ":cy"
+L29: .string ":;y9."
+L30: .string "xa#a", ":"
+L31: mov L4, r2
+.string "c119";110a"
+L33: .string "yx#;0a9axb.", ".:yb"x9."
+L34: .data 1 , K , -5
+L35: .data 1 , K , -5
+L36: .string ""c;0901"
+L37: mov L39, r2
+.data 1 , K , -5
+.entry L32
+ hlt
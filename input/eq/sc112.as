@@ -0,0 +1,42 @@
+.define K = 3
+.string "y.10#:czx"
+L1: .string ".11"
+.string ".c.19z0;0y"
+L3: .string ":#b;"#"
+L4: .string "1a"y:#0"", "y9"
+.string "x" ";.;"
+.string ".b"
+L7: .data 1 , K , -5
+L8: .string "1b199cyba9.."
+.string "01z""
+.data 1 , K , -5
+L11: .string ".00#bcz0;9#""
+L12: .string ""
+.string "" "#yy""a;"11"y"
+.string "yc"#.y11;0"
+L15: .string "9;1"
+.string ".xx:"
+L17: .string "1x0y9a:.y"
+.string "".z"
+L19: .string ".0;0:"0b"1x"
+L20: .string ".byax0:b"
+L21: .string "a0c:9"
+L22: .string "#zb"
+L23: prn #K
+L24: .string "ab." "0cc"
+.string ""ca9";;", "x09bb#"
+.string "#:z0a9bzb:a"
+.string "#xx#c:zzz1", "..a0x;b;:;1;"
+.entry L5
+L29: .string "1:y"
+.string "xxc:.", "a1"
+.string "1", "x011z.aa0"
+mov L23, r2
+L33: .string "9#;1"zc"
+mov L26, r2
+L35: .string "9cc#"z.."
+L36: .string "yybb9#:" ".:yzy.1b.:#1"
+L37: .string "x;x.1xc..a", "ba"xc"
+L38: .string "x9z.z1;cc0#y"
+.data 1 , K , -5
+ hlt
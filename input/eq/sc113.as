@@ -0,0 +1,42 @@
+.define K = 3
+.string "ya19zx0a"by"
+.string "0z0x"
+.string "", ";#"
+L3: .string "cy0:y:x"
+L4: .string ""
+.entry L39
+L6: prn #K
+L7: .string "#b9b9:;", "x"
+L8: .data 1 , K , -5
+.string "."
+.data 1 , K , -5
+L11: .string "b:#", "#y"
+.string "cc#x1c:;xy"
+mov L1, r2
+L14: .string ";czxza"
+L15: .string ";91cy"
+L16: prn #K
+L17: .data 1 , K , -5
+L18: prn #K
+.string "9;:yy10"
+.string "#;;"1.xz1"
+.string "y"
+L22: .string "a9y", "19y.;"az9""
+L23: .string "y;:zyx#a;b"
+L24: .string ".9zb"
+L25: .string "01yzyac"
+.string "z"
+L27: .data 1 , K , -5
+.entry L38
+.entry L11
+L30: .string "y9;x019"
+.string "a;1bcyca"
+mov L19, r2
+L33: .string "b#:x00x9cy"
+.string "yy00b0"
+L35: .string "yy#;#z#zz;a:"
+.string ";;z#;bb"
+.string "1"
+L38: .string ""
+L39: .string ""
+ hlt
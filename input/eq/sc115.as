@@ -0,0 +1,42 @@
+.define K = 3
+.entry L7
+L1: .string "y::y:z1a" "ca"
+L2: prn #K
+.string "cc""
+.string "#:"
+L5: .data 1 , K , -5
+L6: .string "#:."
+.entry L26
+.entry L12
+.string ""#"
+L10: .string ";:..1yx9:c;", "99:;"
+L11: .data 1 , K , -5
+L12: .string ""
+L13: .string "0y#yz0c:a9x", "z"
+prn #K
+prn #K
+L16: .string "09;9" "#cy99z19bc"
+L17: .string "9"
+L18: .string "b;", "1x.xa0"
+.data 1 , K , -5
+.string "9:xb""y"c" ";ba;za0.b#x"
+L21: .string "xy"c."
+L22: .string "z0aac:1"
+.string "1.:x00zx"
+mov L18, r2
+.string ""x1""
+.string "0xzx;:x", "#1x1"
+L27: prn #K
+L28: .string "1", ""b#yb".x#";"
+mov L0, r2
+L30: .data 1 , K , -5
+.string "b::a1a1z" "#:9az"
+.string ":yb99x:"
+.string "9z;z;#:"";19" ""
+.string "1y9", "c:;#c9yb"
+L35: .string ""
+L36: .string "bx;" ":;"
+L37: .string ""
+L38: .string "9"
+mov L2, r2
+ hlt
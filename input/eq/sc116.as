@@ -0,0 +1,42 @@
+.define K = 3
+L0: prn #K
+L1: mov L7, r2
+L2: mov L30, r2
+L3: .string "0";b1bz#9", ""
+L4: prn #K
+L5: .string "zc19b91;"
+L6: .string ""z"0a0#:a0:"
+L7: .data 1 , K , -5
+.string "" "yxz10"
+mov L2, r2
+L10: .data 1 , K , -5
+.string ""
+L12: .string "ac"y91a", "1x"
+L13: .string "1:09yz0;", "bx:yz9zbz#1"
+L14: .string "c"1"
+.string ";aacza#9":xy"
+.string "0y099a9"c9"
+L17: .string "0ay"#b""
+L18: .string """
+.string "01a0#0"
+L20: .string "cxc99axxz"
+.string "y1yc1"#:#"
+L22: .string "1#0ab".z.:"b", "#z.;"
+L23: .string ""y."
+L24: .data 1 , K , -5
+.string "#.11:.:1by#" "#y"
+.string "9"
+L27: .string "x#1byxyxac"
+L28: .string ";;y0:9:"
+L29: .string "9:":#.c1#b", "b"1aa:;c##:y"
+L30: .string "baa1#zz"
+.string "xzcy1#", "b:ca"
+L32: .string "a9:zby9"
+L33: .string "0.by1z#cyx"
+.data 1 , K , -5
+L35: .data 1 , K , -5
+L36: .string "z9."ab."bya"
+L37: mov L26, r2
+.string ":"
+.string ":#"z1:0ba#"
+ hlt
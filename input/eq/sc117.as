@@ -0,0 +1,42 @@
+.define K = 3
+L0: .string ""c90.b"
+L1: .string "#:acz0b", ":00ac."
+.string "1."
+.string "zb", ";"
+.string "0:yzy"
+L5: .string "za"
+L6: .string "zay1"a:" ".c#a19"
+.data 1 , K , -5
+.entry L32
+L9: .string "x;0y" ":y"za:x"
+L10: .string "...1b.;;..9z", ""
+.string "x9z;x"
+.string "bbz:#1;90"
+.string "#z1y9bbx0:"
+L14: .string "ax.c0z1#0;9." "#ycx.x9"
+L15: .string "0:"
+.data 1 , K , -5
+.string ":91b1;aaz1;"
+.entry L3
+.string "zya"#;;a#"
+L20: .string "91."
+L21: .string ".##x1;#b" ":"
+.string "ay#a"b0"zb"
+L23: .string "yy9x1.b::#"
+L24: .data 1 , K , -5
+L25: .string "c"
+L26: .data 1 , K , -5
+mov L26, r2
+L28: .string ""c1z9;zcb.yb"
+L29: .string "" "yc9z1;"
+L30: prn #K
+.string "y9"x9a1x"
+.string "b9..c1"
+L33: .string "a:1xbx:"
+L34: prn #K
+mov L9, r2
+.string "c.y.0x;1"
+L37: prn #K
+L38: mov L8, r2
+.string "01x;zcc1a"
+ hlt
@@ -0,0 +1,42 @@
+.define K = 3
+L0: mov L6, r2
+L1: mov L1, r2
+.string "19;z;#9c""
+mov L13, r2
+.string "y##b;"" """:zz#;1"
+L5: .string ":a#1b1abcx"
+L6: mov L11, r2
+L7: prn #K
+.string "9c#""
+.entry L38
+.entry L12
+L11: .data 1 , K , -5
+L12: .string "1c##0"
+prn #K
+.entry L9
+L15: prn #K
+.string "a."
+.data 1 , K , -5
+L18: .string "#c.0c"
+L19: .string ".1ac"
+.string "1a0c;c.."0"
+L21: .string "9z.0;:z;0;b"
+L22: .string ";90aac:9"
+.string ":b""yyc";x"
+L24: mov L29, r2
+L25: .string "b.1c:ac"#;"
+L26: .string "#1b1#zy"a"", ".:.:y0c9.#9c"
+L27: .data 1 , K , -5
+L28: .data 1 , K , -5
+.string "9b"aa:;b"
+L30: mov L25, r2
+.string "yy" "c09..a0"
+L32: .string "zc1z1."zbby#", "99zb"
+L33: prn #K
+.string ";yz:9"
+mov L18, r2
+.string "a:#", "b00az#y0z1c1"
+L37: .string "ybcb:01"
+L38: .string "c;b."
+.data 1 , K , -5
+ hlt
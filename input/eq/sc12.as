@@ -0,0 +1,42 @@
+.define K = 3
+.string "zc0az1y:#1"
+L1: .data 1 , K , -5
+L2: .data 1 , K , -5
+L3: .string "a;""
+.string "0#"baa":9x" "1b:0c9"
+L5: .data 1 , K , -5
+L6: .data 1 , K , -5
+.string ";0:;11"
+.string "x" "yzz".0:yby"
+L9: .string "#9ca0""0a9ax"
+L10: .string "b#9xcb.ya"
+.string "a91zxzy11.""
+L12: .string "zcx#.x;a", "#zcx#a9ax;bz"
+L13: .string "#:"y:" "9911:zy:1.c1"
+.entry L32
+L15: .data 1 , K , -5
+mov L33, r2
+.string "ac9y0cxx01a"
+.data 1 , K , -5
+.string "0;b0#x", "z:.0;"
+L20: .data 1 , K , -5
+L21: .string "0"
+L22: mov L6, r2
+L23: mov L17, r2
+.string "1;;bx9;.", "xb0zzb:zc"
+L25: mov L11, r2
+mov L27, r2
+L27: .string ";11ca:;"
+L28: .string "azz"
+L29: .string "9c9"
+L30: .string ";9".x1"
+.entry L14
+.string "09:1:ab9;:yz"
+.string ":ycc1"
+L34: .string "" "y0:;y"
+.entry L20
+L36: .string ""
+.data 1 , K , -5
+.string "z0#0"
+.string "c#", "by9a"
+ hlt
@@ -0,0 +1,42 @@
+.define K = 3
+L0: .string ".;:1bz#xx"" "z.cb."
+L1: .string "xx99"
+.string ".ab"
+.string "#.;00"", ".0baa0z.y.#."
+L4: .string "z1#yz.0yy"
+L5: .string "9zaz9x9xzz9#"
+.string "ba:zx;b#"xc0"
+L7: .string "b1ab;"x"
+L8: .string "x##99;;;.cz""
+mov L26, r2
+.entry L20
+.string ":a11"
+L12: .string ""
+.string ":#.#c9y"
+.string ".acxac99.a#9"
+.string ":0bbc"
+.string "9yy;0y0"
+L17: .string "z;z:"y"
+L18: .string "b0##", "9;99"
+.string ".#a".cxa" "00x#1009y9"
+L20: .data 1 , K , -5
+.string ""
+L22: mov L3, r2
+.string ""
+.data 1 , K , -5
+L25: .string "c"
+.string "#b.0.cax1c9;"
+.string "a9.a."
+.string "#y1;.."
+mov L14, r2
+L30: .string ":1"
+.string "b1"" "axac1#0c"
+L32: .string ".z;zc#"
+L33: .string ""1y9.z1.b0x"
+L34: mov L14, r2
+.string "yb0b"
+L36: .string "1.z.b""
+L37: prn #K
+L38: .string "x9zxbbz"
+.string ";acy99;:"
+ hlt
@@ -0,0 +1,42 @@
+.define K = 3
+L0: .string ":c;#9c"
+.string "a:."#""
+L2: prn #K
+.string "z1;xczc0#bzx"
+L4: .string "b0acz" ".;;a9"
+.entry L16
+L6: .string "x#"
+L7: .string "x1;;:b"
+L8: .string ":ca"
+.entry L25
+mov L37, r2
+L11: .string ";y:0"
+.string "0.1;x"
+L13: .string "bb:"ab:9;#1z"
+.entry L9
+L15: .string "xc":"
+L16: .string "..0z#.az###x", ""
+.string "c:9:#", ".y#"
+.string ";0"1ybcx"
+L19: .string "1;c0xz;bzcy""
+L20: .string ".c;01c.bzz9x" "y9ya:""
+L21: .string "ayc.ayc9;b"
+L22: .string ":9"aa;", "0;0c:#c"
+L23: .string "zy0xcy:.b0"
+L24: .string "":ybx9bc1#c"
+L25: .string "b";:cz" "9":::b"b"
+L26: prn #K
+L27: .string ""
+L28: .string "y90cx9zy"a."
+L29: mov L10, r2
+L30: .string ":910y09"
+.entry L27
+L32: .string "a", ""
+L33: .string ":x:xbab.cab", "9"b19"c1;z"
+.entry L40
+.string "bx0" ";0b:""
+L36: mov L33, r2
+.string ".cbc." "x"
+.string "910z"
+.string "."09#""
+ hlt
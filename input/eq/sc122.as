@@ -0,0 +1,42 @@
+.define K = 3
+L0: .string "b.z#" ".;cby1.x90"
+L1: .data 1 , K , -5
+.string "b0#b9:1"
+.string "z;a9" "00c:z"
+.string "aax"10#yz"
+.string "z1b1z;.b""
+.string "b#z#:"b.yy#."
+.entry L25
+prn #K
+L9: .string ".0"
+L10: .string "za0b9;:#"0:."
+.string "c9cb;9"
+L12: .string ":#;0"#z"
+L13: .string ":9b1yxx;"a"
+L14: .string "" "."z""
+.string "119#.:yazc.#"
+L16: .string "a1bbaz"#xz"
+L17: .string ":"
+.data 1 , K , -5
+.data 1 , K , -5
+.string "xzzc1yxyza;" "b#yx#"
+L21: .string "cy1:z1xb#bx"
+mov L0, r2
+.string ".c.:#0"
+L24: .string "y":"
+L25: mov L13, r2
+L26: .data 1 , K , -5
+mov L35, r2
+L28: .string "b9"
+L29: .data 1 , K , -5
+.string "b#"
+L31: .string "cay"b.1x:z"
+.string ""19:ab1bc#"
+.string ":;";cz"
+L34: .string "0:y:0"
+L35: .string "yyy1"
+prn #K
+.data 1 , K , -5
+mov L39, r2
+L39: .string "..x.z0yy"c"
+ hlt
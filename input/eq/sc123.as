@@ -0,0 +1,42 @@
+.define K = 3
+L0: .string "yb""a0"
+.string "cz"
+L2: mov L27, r2
+mov L24, r2
+L4: .string "bab:cc#"
+L5: .string "y1"a#yz"
+.string "9;#za0#:90"
+.data 1 , K , -5
+.entry L26
+L9: .string ":c."b1:yczz9"
+L10: .string "#zax;b":z"
+L11: .string "9."a:y1#"
+L12: .string "c9"
+L13: mov L8, r2
+L14: .string "z:y0:0ab;b9z"
+.string "90b9.:0azy1a"
+L16: .string ":c0b.":cz:"
+.string ""
+L18: .string "#y#"0zc9z9"
+L19: .string "a.c1:a"
+.entry L28
+.string ""
+L22: .string "cz9b9.zx"
+L23: .string "xxzy0a9b"
+.string "" "xb;zbz99c"
+L25: prn #K
+L26: mov L25, r2
+L27: mov L36, r2
+.entry L14
+prn #K
+L30: .data 1 , K , -5
+mov L31, r2
+L32: .string "az"1z:"0zzx"
+.string "0#"
+L34: .string ""9"
+L35: .string "9";z"
+L36: .string "b1;#"
+.string ""1;;"
+L38: .string "yzacba0:1", "9a19cz""
+L39: .string "", "#y.;az.0x"
+ hlt
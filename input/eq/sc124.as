@@ -0,0 +1,42 @@
+.define K = 3
+L0: .string "a0", "azc0y"
+L1: .string "axxb0z"
+.string "z9y#0cb1.9"
+.string ";91#b;", "c"
+L4: .string "1."
+L5: prn #K
+.string "#1bcb9a#a"
+.string "#1;1b;1" "a1x0:cxa#z9"
+L8: .string "#.9"zzb"
+.string "bb0x9""
+L10: .string "x#bbaac..b", "x"
+L11: .string "1#.a:a"b1z#b"
+L12: .string "y90"
+L13: .string "a0:9.:99zxz1"
+.entry L40
+L15: .string "b"
+.string "zzy1cb9#a" "z;cbzb."
+.string "9""yy.:1cb", "b"#x0.0"
+.data 1 , K , -5
+L19: .string "#91#..;:x"
+L20: .data 1 , K , -5
+L21: .string ":xzb1c#;"
+L22: mov L38, r2
+L23: .string "#c0"0x"
+.string "c9zby"
+L25: .string "9a"
+L26: .string "0"z10;"
+.entry L9
+mov L37, r2
+L29: .string "1x.cabx.0", "0:b:#"
+.data 1 , K , -5
+L31: .string "y;;a;#"
+.data 1 , K , -5
+L33: .data 1 , K , -5
+L34: .string "bya;1c1:"99"
+L35: .data 1 , K , -5
+L36: .string "c:c"x;a.c"
+.entry L8
+L38: mov L24, r2
+L39: .string "zayx.1."
+ hlt
@@ -0,0 +1,42 @@
+.define K = 3
+L0: .string ";y;.czc;y;:a", "c19:"0:b#y"
+L1: .string "cay.;:9"
+L2: .string "#.c"cba0#;#"
+L3: .string "x;b.z;:"
+L4: .string "9x.z:1#;x0;:"
+L5: .data 1 , K , -5
+.string "9zbb" "c1;""
+L7: .string "yb9x;z:z;0a"
+L8: .string "b1;;xyz.yy":" ";10:.0x;;x11"
+prn #K
+L10: .string "101#c;b9"
+.string "c11ca;1090z9"
+.string "#9aa;c" "z1xa9:aby1#x"
+.data 1 , K , -5
+L14: .string "1xb#y;1cx0x1"
+.string "" "9a09bcz"
+.entry L36
+.string "a"
+.string ""
+.string ""00:9xzcx"
+L20: .string "x11a9b#a", "xx0x..cxx;z"
+L21: .data 1 , K , -5
+.string ":z1#.0zx1"
+L23: .data 1 , K , -5
+prn #K
+L25: mov L37, r2
+.string "c#"
+.string "zc"1:", "xa##.a:"bzx0"
+.string "#"##", "0y1"
+L29: prn #K
+L30: .data 1 , K , -5
+L31: mov L35, r2
+.string "by"
+L33: .string "#:ba1z9:."by"
+L34: prn #K
+.string "c19::zx.#."
+L36: .string "b"
+L37: .string ".0.0#y.xb1zz", "b"
+L38: .string "x.;c1by0;0:" "ay#c00b"
+.data 1 , K , -5
+ hlt
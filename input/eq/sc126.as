@@ -0,0 +1,42 @@
+.define K = 3
+L0: .string "x:c11xc" "1b.:y9czx#"
+L1: .string "119a"
+.string ":x0"
+L3: .string "0x.a9.:c:xc0", ""
+mov L5, r2
+.string "100.9"
+L6: prn #K
+L7: mov L9, r2
+L8: .string "#a"
+L9: .string "#b9b"
+.entry L20
+.string ":c""
+.string ".#;;"xz.1"
+L13: mov L21, r2
+L14: mov L18, r2
+L15: .string ""xx;90;z."
+.string "#.bya;" ""
+.string "y1"
+.string ""zyza#."a", "9x""
+L19: prn #K
+.data 1 , K , -5
+.string "a"
+.string "xz;;b"xc;0a"
+L23: .string ""#cc"0x:;x:b"
+L24: .string "yc;"
+L25: mov L1, r2
+.string "c:0..c", "9b1.c"
+.string "zb" "9;z1""1c901a"
+.string "0xbzb.c9zx0"
+prn #K
+mov L1, r2
+L31: .data 1 , K , -5
+L32: .string "a;axz;c" ":c.#"
+L33: mov L10, r2
+.string "axax.z."y.y9"
+L35: .string ".#9"
+.string "yx.b.:1yaac"
+L37: .string ":1"1ca";99.1" "x#z.c;ac9"
+L38: mov L10, r2
+L39: .string ";;"1c"
+ hlt
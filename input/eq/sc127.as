@@ -0,0 +1,42 @@
+.define K = 3
+.string ""baayx0xy"
+.entry L24
+L2: .string "."b0b#b.", "a1c.;"
+L3: .string "b9by"
+L4: .string "..x0"
+.string ""
+.string ";".:;xx#1x0""
+L7: mov L5, r2
+L8: .string "y"
+L9: prn #K
+L10: .string "9;.0a1b:xb90" "b"0"
+.entry L38
+.string "##y0;yyyz09", ""
+L13: .string "xaa"
+L14: .string ""
+.string "yaa9"xab";0"
+.string "1xyy19"
+.string "ca#""
+.string "z9xy.0yxzx0"
+.string ".:"
+.data 1 , K , -5
+mov L34, r2
+L22: .string ""byxx::zz"
+L23: .data 1 , K , -5
+.entry L33
+L25: mov L1, r2
+L26: .string "y"
+prn #K
+.string "bz", "x9b1111"
+L29: .string "ca.909#x.c9"
+L30: .string ":"1.ab9:.a"
+L31: .string "9;b90"
+L32: .data 1 , K , -5
+prn #K
+.string ""
+.string "z"
+L36: .string "a"zyccyz."
+.entry L32
+L38: .string "1";.xx", ":x#0."
+L39: .string "z;""
+ hlt
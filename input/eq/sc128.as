@@ -0,0 +1,42 @@
+.define K = 3
+L0: .string "zc1acz:9", ";.9yb#bay#"
+.string "c09z"1z", "z0:y"yx;"
+L2: .string ";"
+L3: .string ".#;0z"
+prn #K
+L5: .string "yz1#0##9"
+L6: prn #K
+L7: .data 1 , K , -5
+mov L16, r2
+L9: .string "9"
+.entry L33
+L11: .string "9"
+.entry L18
+L13: .string ""
+L14: mov L23, r2
+.string ":99:;1.yaa1b"
+L16: .string "#c01""b#.""
+.entry L30
+L18: .string "#0"#:z"
+L19: .string "" "1#x1."
+L20: .string "z;xycza1z"
+.string ".:""
+L22: .string "y:0z" ""
+L23: .data 1 , K , -5
+.entry L2
+L25: .string "caby#.c#9"
+L26: .string ""
+L27: .string "1y10yz91"
+L28: .string "#b.0c#z"0ycx"
+.data 1 , K , -5
+L30: .string "" "y#;1:.:"
+.string "b1y;y11c" "09.10#:zxy#"
+.string ".y:c"
+L33: .string "x1zx0c10c.9", ""9cc9xb.9"
+L34: .string "#"
+.string "y9#xxx""1yc"
+mov L26, r2
+.data 1 , K , -5
+L38: mov L25, r2
+L39: .data 1 , K , -5
+ hlt
@@ -0,0 +1,42 @@
+.define K = 3
+.string "a.0:" "b.9"
+L1: .data 1 , K , -5
+.string ".;#1cby"
+.string "0"
+.string "1#a" "zcz1"
+mov L32, r2
+L6: mov L10, r2
+L7: .string ";zy;z;1z#zc" "c0:#xaxc"
+L8: .string "b:;0c:xa", "0cac."
+L9: .string "00#"" "x9x1a;z0;"
+.string "#xyb:"0" "#"
+L11: .string ""1y9:b#b."
+L12: mov L40, r2
+.string "9zz;yx:1cz"
+.string "9c:19az#9", "aza"
+.entry L31
+L16: .string ";0az"a"
+L17: .string "" "aaz;zb91y#"
+L18: .string "#0y9c;:z#z"0", "0zb"
+L19: .string "c;.c99#0""
+.string ".y9"
+.string "xbyy", "0ay"by9:#b""
+prn #K
+L23: .string "1##9;9x#", ";"
+L24: .string "yx99"
+L25: .string "a"
+L26: .string "xz1x11"
+.string "a""z;""
+.string "babb;"
+L29: .string "a01#c"
+L30: mov L20, r2
+.string "cz..c;xyb1."
+.string "c.:0:b;1:#"
+L33: .string "999" "z9.:"
+prn #K
+.data 1 , K , -5
+L36: .string "", "#0"
+.string ":b0y0yzb1"
+L38: .string "0xy;;", "a1cax9c9";z""
+L39: mov L30, r2
+ hlt
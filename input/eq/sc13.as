@@ -0,0 +1,42 @@
+.define K = 3
+.string "#"c:x:c"x:"
+L1: .string ".ya"
+prn #K
+L3: .string "b""
+.entry L28
+mov L16, r2
+L6: .string "9;0:z0:z:bz""
+L7: .data 1 , K , -5
+.string "1:"
+L9: .string "9z" "y;y0c;1"
+.string "zcb0::10a.0" ""
+.string ":yc.0.""
+L12: mov L40, r2
+.string ".;"
+.string ""
+L15: .string ";zcyxc#:9bx" ":;9#9."
+L16: .string "9"
+L17: .string "y;;.", "9z""aaz"
+.string ""1x:xy#a"
+L19: mov L9, r2
+.string "y0;"
+L21: mov L27, r2
+L22: .string ""
+L23: .string ""
+.string "119"
+L25: .string "c""
+L26: .string "y;0y"
+L27: .string ";;0az9y"
+L28: prn #K
+.entry L8
+.string "cb1zbzy#"x", ":"x"
+L31: .string "0;a"9ab;c", "#z90yc9yybza"
+L32: .string ".y"bz#:0"
+.string "y#abby0010y", "1y"
+L34: .string "xx""z"
+.string "0yc1;91", ".1"xa;"
+L36: .string "ba"
+.string ";9."ax."
+L38: .data 1 , K , -5
+L39: .string "cy";c:a.90", "x1a;"
+ hlt
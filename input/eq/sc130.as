@@ -0,0 +1,42 @@
+.define K = 3
+L0: .string ":#1:1azx;zx" "9:.b9::x"z"
+.string "a:"
+.entry L24
+L3: .string "a9#999:"c9", ";""
+.string "b#10by0#"0"b", "#cczby09"
+.string "0:#x"
+L6: .string ""1.;.x#9"
+mov L2, r2
+L8: prn #K
+.string "119b;"
+L10: .string "ycz1c;x"
+L11: prn #K
+.entry L4
+L13: .string "yy" "::9"
+.string "0b1z"
+.string "ax:a#:ab1y"
+L16: .string ".0#", "xxb.x:"1#z"
+.string "" "1x#"
+L18: .string "yz0"11#"
+L19: .string "", "z1"
+.string "accb."
+L21: .string "9x0."
+.entry L19
+L23: .string "1y;9:;19"
+L24: .string "", "c:#1b"
+mov L12, r2
+.string "yb1"
+L27: .data 1 , K , -5
+L28: .string ";cz9", "9xy.11b"
+L29: mov L27, r2
+L30: .string "9az;x.0a9c"
+.string "zb;x.b""
+L32: .string "1#xc";0ay1:", ";09"
+.string "zzcz"
+L34: .string "za09:"x"
+mov L14, r2
+.data 1 , K , -5
+L37: .string ""
+mov L15, r2
+.string ";0."0;9y"
+ hlt
@@ -0,0 +1,42 @@
+.define K = 3
+L0: .string "ay"
+mov L34, r2
+.string "x#1c"
+L3: .string "#"1"";#9#"", "z0;zx.#b9a;""
+.data 1 , K , -5
+.entry L4
+.entry L8
+.data 1 , K , -5
+L8: .string "1", ";";"
+L9: prn #K
+.string ";.by1#c0::"
+L11: prn #K
+L12: .string ";x#a#1"
+L13: mov L39, r2
+L14: prn #K
+L15: .string ""
+L16: .data 1 , K , -5
+L17: .string "b;:11x", "..#1bzcc"
+L18: .string "x".x9a1z9b;", ""
+.string "0#999"
+L20: .string "zby.#z.yzc"
+L21: .string "1"
+L22: .string "1"
+L23: .string ";z#x:::x1:9", ""
+L24: mov L13, r2
+L25: .string "x1a:"
+.string "ay;#"9z#..x#"
+.string "1a##z#9"
+prn #K
+L29: .string "b#y" ":0z.ax""
+.string "cy"" "a1#1"y#b"
+L31: .string "ab"
+.string ".yy;0xacxc.0"
+.string "yb1009##c9", ""
+.string ""
+L35: .string ";ax.bzb", "1zx:#x.b"
+L36: .data 1 , K , -5
+L37: .string ";z9bz1z;;xz"", ".a:9.z.bxaz"
+.string "1c"9".#1zy"
+L39: .data 1 , K , -5
+ hlt
@@ -0,0 +1,42 @@
+.define K = 3
+L0: .string ";##z9.;.."a."
+.string "xa09"
+.string ""
+.string "cyb;c;b.z"
+L4: .string """, ""1xcyb"
+L5: .string "9"9.a;000"
+L6: .string "0y01z9"
+prn #K
+.entry L23
+L9: .string ""
+.string "#zx"
+.string "yb1##", "b::cb9"
+.string "b.c..1;:#9"
+.string ".:x9"
+.data 1 , K , -5
+L15: .string "b"a0c9;" ""
+.string "zy0"
+.entry L14
+L18: .string "zb;0;:y:10c"
+L19: .string ";z1;x;", "9#9"0abxzb"
+.string ":"xc99c:z9"
+L21: .string ""
+L22: .string "axz""
+mov L18, r2
+L24: .data 1 , K , -5
+L25: .string "0xc;9;"
+L26: .string "b0y""
+L27: .string "ya" "##.1:c1"
+.string "9"
+.string ".;0"
+L30: mov L10, r2
+L31: .string "1ayx0y.9cyy"
+L32: .data 1 , K , -5
+L33: .string "" "0yx"#c."z#x"
+L34: mov L28, r2
+L35: .string "ya#0y.#;b9#"
+L36: .string ":a;bb#y:", "9x11y9.91a00"
+L37: .string ":b99b;a"
+L38: .string "::"
+.string "." ""9ax0a1a"
+ hlt
@@ -0,0 +1,42 @@
+.define K = 3
+L0: .string "..:"ca:#"
+L1: .string ";91", "y"
+.string "yyb.;.:y:":.", "z":y:zc".90"
+prn #K
+L4: mov L36, r2
+L5: .string "x.c", "cbzx:yz0:xy."
+.data 1 , K , -5
+L7: .string ";#;b."
+mov L10, r2
+L9: .data 1 , K , -5
+L10: .string "c#;99b;x#"
+.string "zab" "01"
+L12: .string ""
+L13: .string "x1#x:#y1#."
+.string "99.ba"y", "9"
+.entry L27
+prn #K
+.string "1.1"
+L18: mov L31, r2
+L19: .string "a#0#"
+L20: .string "".9"
+.string "ay#a;c"
+L22: .string "."
+L23: .data 1 , K , -5
+.string "#"
+mov L37, r2
+.data 1 , K , -5
+.string "#a9c:0xbaz" ":0b:.0.x1xcz"
+L28: mov L17, r2
+L29: .data 1 , K , -5
+.data 1 , K , -5
+L31: .string ":x.0.z1" "#.9x9.1c"
+.entry L7
+.string ";0x:b:.19"
+L34: .string "1;b;9zbca"
+L35: .string "01;1#ba9", "#zcc"
+L36: .string ".0"
+L37: .string ""ay.zy1:.cy:", "yx"
+L38: .string "c";b9z"
+L39: .string "x.ay;0bya"xz"
+ hlt
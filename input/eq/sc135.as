@@ -0,0 +1,42 @@
+.define K = 3
+.data 1 , K , -5
+L1: .string "b1ya;"cz:yz" "y;"""
+L2: .string ""
+.string "y"
+mov L4, r2
+.string "x"
+.string ";ba.1:"
+L7: mov L15, r2
+L8: mov L15, r2
+L9: .string "zybcy"bx.:"c"
+L10: .string ":"
+L11: .string "1z:c;x1" "zx#1;"x9c#""
+L12: .string ""
+.string "1b:#0"
+.data 1 , K , -5
+.string """ "9byz#"0zz"
+.string "y:"
+L17: .string ":1zb;x"
+mov L35, r2
+L19: .data 1 , K , -5
+.string "901yyz"
+.string "c#"cc"
+mov L4, r2
+L23: prn #K
+L24: .string ""zyx1"
+L25: .data 1 , K , -5
+.string ""
+.data 1 , K , -5
+L28: .string ";xc19#y#"
+L29: .data 1 , K , -5
+L30: .string "x.a0z1"."
+L31: .string "11za9b"
+L32: .string "9."
+mov L29, r2
+L34: .string "0"y"
+.string "c"
+L36: .string "1"
+L37: .data 1 , K , -5
+L38: .string ":9##xyza#" "z#1b""
+L39: .string ""1b":0"
+ hlt
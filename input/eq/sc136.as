@@ -0,0 +1,42 @@
+.define K = 3
+L0: .string "1#x0.c" "aca.;ax"
+.string "z01".#ab"", "9##a"
+.string "9yxyy"
+.string "##y;:0b.9#"
+L4: .string "xx9z;.;c9a"
+.string "zx"
+L6: .string "1.x0"1y"
+L7: .string "c#x1a11"
+.string "b:#z#zaz"
+.string "#bb1a;;1c"
+.string "00"9ybx0"b:"
+L11: prn #K
+L12: .string "91babxz."
+.string "11z;9x90.x#a" "1b1y9:;"0".x"
+L14: .string ";1"
+.string ":0xzb011" "a#"xxbx"
+L16: .string "xz"911"
+L17: .string ":c"xbaz.x"
+L18: .string "xc.bbb0.z;" ":zb:b1"
+mov L35, r2
+.string "b9"
+L21: .data 1 , K , -5
+L22: mov L15, r2
+L23: .string ".a10##:xcx", ""
+L24: .string "zxxc:#;azc;"
+L25: .string "y"
+L26: .string "0:9:zx;#9z"
+.entry L14
+.string "by""
+L29: .string "a1:" ":b0xb;1"
+L30: .data 1 , K , -5
+.string "#:b1", "c""z0zx"
+mov L0, r2
+.string "91:a11;..z"
+.string "9.bcx10"
+L35: .string ":c."c#.0"
+.string "z."
+L37: .string "9"
+.string "zxx:z1z;#"
+L39: .string ":.a", ";"bba""
+ hlt
@@ -0,0 +1,42 @@
+.define K = 3
+L0: .string "x1z"
+.string "0""91"
+L2: .string ""
+.data 1 , K , -5
+L4: .string "#x"10"
+L5: .string "zb.z.9"
+L6: .string ";9;.zax#"
+.string "a..x"zxx91c"
+.string "#yy:91#"
+prn #K
+mov L24, r2
+mov L5, r2
+L12: .string "acb#z:c;b""
+L13: mov L28, r2
+.string ".;0"
+.string ";y;.0;"
+L16: mov L23, r2
+mov L6, r2
+L18: .string "#0a1."
+L19: .string "x0.91a::;", ""
+L20: .string "1:#.c9#0yzc"
+L21: .string "zyz#y9y#.y0y"
+.string "az0y:z.0y0"
+L23: prn #K
+L24: .string "zabx"
+prn #K
+.string ".ybbx.ay"
+L27: .string ";y0xx1c;9"
+L28: .data 1 , K , -5
+L29: mov L16, r2
+L30: mov L24, r2
+L31: .string ""
+L32: .string ".0yb#1b0"
+L33: .string "0"x;""10ac" "00byb9"
+L34: .string "9";0"
+L35: .string ""
+L36: .string "9.bbc;za"
+L37: .string "b.#cbx:0ac9"
+L38: .string "a09#.9;0yy0", ""
+prn #K
+ hlt
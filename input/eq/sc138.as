@@ -0,0 +1,42 @@
+.define K = 3
+L0: .string "yx9"yxcc"1c"
+mov L5, r2
+L2: .data 1 , K , -5
+L3: .string ":x", "a.:zx"
+.string "c:y0:9b.09", ".0a#":9#aa:9"
+.string ";0az9#xxy""a"
+L6: prn #K
+L7: .string "zy:#."
+L8: .string ";.0yxz"
+.string "0"0y009" ".a0zyx."
+L10: .string "x"
+L11: .string ""bcc#yc9", "0x;19"
+L12: .data 1 , K , -5
+.string ".0;bbz"
+L14: .string "09#10:;1bb"
+.string ""x"
+.string "0b:zzz11b"zx"
+L17: .string ";::", "b""c19z."
+.string "1;bx;0:1zz"
+L19: .string "099#9cb", "1x0"
+L20: .string "0", "zb;bxbz1z."1"
+.string "91"
+L22: .string "":":b"y"
+L23: .string ":b91.1yc:;xx"
+L24: .string ""
+L25: .string "y;a0y00#yb99"
+L26: .string "09"
+.string "."z;"z"
+L28: mov L25, r2
+prn #K
+L30: .data 1 , K , -5
+.string ";:1#"
+L32: .string ":0"
+.string "b9z;aa.1;"
+.string "a91abaxbb#.b"
+.string "0#y9ba#x#;b"
+L36: .string "z9.##c0#"
+.string ""
+L38: .string "z:x1:c:;" "c:##ab"
+.string "" ""
+ hlt
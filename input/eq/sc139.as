@@ -0,0 +1,42 @@
+.define K = 3
+.string ";":y.9a9"
+L1: .string "#c;"#"y"x"
+L2: .data 1 , K , -5
+L3: .string "9zb#b" "aa91y#9a"
+.string ";" "0.0:;a"
+.string ".xby" ":1b."
+.string "0:.xbx.1zax""
+L7: .string "0:9cz" "#.9y:.a#aa"x"
+.string "yz"
+L9: .string "1"x"
+L10: .string ";:0"y1", ""
+L11: .string "cba9xx;9;a", "."
+L12: mov L9, r2
+L13: .string "0"
+L14: prn #K
+.string "#0"
+L16: mov L38, r2
+prn #K
+L18: .string ";:x"
+L19: mov L1, r2
+.data 1 , K , -5
+L21: mov L32, r2
+.string "cay1a19z", ";"
+L23: .data 1 , K , -5
+.entry L33
+mov L16, r2
+.string "yxa.1ax9#b"
+.entry L16
+L28: .string "0b.0c.y"x"y."
+.string "";"
+L30: .string "zb#.;:1bb9#0"
+.string "bax:;#ay.9", ";#za#zcy"
+.string "c.za0", "yab1"
+L33: .string "b9zay"a;x"x1"
+L34: .string "."
+L35: .string "":"
+L36: .data 1 , K , -5
+L37: .string ";"0"
+.string "00;a" "xx;"
+.string "azaxx.0"0x"
+ hlt
@@ -0,0 +1,42 @@
+.define K = 3
+.string "9xy.yy.b:1"
+L1: .data 1 , K , -5
+L2: mov L14, r2
+.entry L16
+.string "cc9::yca"
+L5: .string "y"
+L6: .string ";b"::b;", "zc"b."19:x"
+L7: .data 1 , K , -5
+L8: .string """
+L9: .string ".0"
+L10: .string ":c901y1" ";"by10"
+.entry L4
+L12: .string ";1a"" "az.;z1"
+L13: .string "91#yb0baxy"
+L14: .string "#zybac#x"
+L15: .string "xx"
+L16: .string "za9;.##c9:"x", "x099#z"
+L17: .string "01#zby#bcx", "xy"
+.string ""
+L19: .string "0c1xbc"
+L20: .string ":":"
+L21: .string ".a;01y1z", "a:::9"
+L22: .string """, "cba#:yac0;"
+.entry L31
+L24: mov L5, r2
+L25: .string ";:9a9#x.az", "0"
+.string "aycy;"
+mov L33, r2
+.string "" "1"
+.string ":#0x"
+.string "0"9"
+mov L12, r2
+.string "#b1"
+L33: .string "#:;:y#01x." "."
+L34: mov L12, r2
+.string "x#:zz19"
+L36: .string "1c""y1y9ac"
+L37: .string ":yz:."
+L38: mov L32, r2
+mov L37, r2
+ hlt
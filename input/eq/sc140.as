@@ -0,0 +1,42 @@
+.define K = 3
+L0: mov L17, r2
+.string ".xa9x.0":0"
+L2: .string "x:"0.1ya9"
+L3: .string "1:9cc"c:0.#"
+.data 1 , K , -5
+L5: prn #K
+L6: .string ".9"
+.string ""x0"
+L8: .string "1;:1;", "0;:y#0:z:"
+L9: .string "";1z#"
+.string "c0bzc1bcy"c#"
+.string ".ba0" ":xxzzx9.zy"
+.string ";a#;0c:9cy9"
+L13: .data 1 , K , -5
+.string ":" "#.bb"0zcay"
+L15: .string ":#;cxx0"
+.string "c.0bc#c" "#9#;9"
+.string "abbb."
+L18: .string "x9""
+L19: .string "##.::."
+.string "b.;ab.zc:z" "0;#1"9;1"
+.string "1ba#;xzx9:"
+.string "c"c;bybyy"
+L23: .string ":ccaaa.1."z1"
+.string "#9"
+prn #K
+L26: .string "#z.09y#;"
+L27: .string ""
+.data 1 , K , -5
+.string "z109y.z;#1z:"
+L30: .string "9#:aba1"
+L31: .string "yy;xx:z"
+.string "a.yxc;c#cx." "9:;0x91b"
+L33: .string "0zbb"
+.string "9a91"9b"
+L35: .string "9#1":;z"
+mov L38, r2
+L37: .string ".bab".az0"
+L38: .string "z"a"
+.string "09"
+ hlt
@@ -0,0 +1,42 @@
+.define K = 3
+L0: .string "1c;.1ay:9a:z" "9z;."
+L1: .string "z;x;." "91y1y0c"
+L2: .string ""
+L3: .string ";1abayaz;:" "100zc;1.0"
+.string ""
+.string ";::azyzx;a"
+.string "b0999cz"
+.string "0x"#;"":cz"
+.entry L11
+.string "#c;;"
+.data 1 , K , -5
+L11: .string "ca"x01#za.a;"
+L12: .string "ac0y", "ya0"
+.string "#:x0ac1b"
+L14: .string "y.y:bzy:.9;"
+L15: .string ":0y;c", "cb;91a"
+mov L22, r2
+.string "xx.bc#0b"", "9"ca"
+.string "bb0;"a0axbby"
+L19: .string "#a.0"
+L20: .string "z9.1b9"
+L21: .string ":;x"
+L22: prn #K
+.string "c:c1." ""
+L24: .string ";a0cx"
+L25: .data 1 , K , -5
+L26: .string "zz"
+L27: .string ".y"
+.string "aa"b99ccx9"
+.string "az"
+.string "c09x"0c1" ";z;:by#01:"
+L31: .string "ba9z;;y9"
+L32: .data 1 , K , -5
+L33: .string "x9:0x:a", "#;;0"
+L34: mov L28, r2
+L35: .data 1 , K , -5
+.string ""0"b.0z1y:a"
+L37: .string "ya1"
+.data 1 , K , -5
+.string ":xczayc1a", ":90"
+ hlt
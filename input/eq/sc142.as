@@ -0,0 +1,42 @@
+.define K = 3
+.string "c1yzz"#" "y"
+.string ""a1xb.z9" "1"
+.data 1 , K , -5
+.string ""
+.string "#z0"by:y.za"
+L5: mov L20, r2
+L6: mov L3, r2
+L7: .string "a;"
+mov L38, r2
+.string "xx;yccb1zxz"
+L10: .string "a;"90:0#;:."
+L11: .string ""
+.string "ac.;#ba;b199" "czx##;11":0a"
+.string ".y:y;yx:b"
+L14: .string "1..a"
+.string "1";bzyccya", "y0;0y:"
+.string "1x9"
+mov L33, r2
+.string "b#"
+L19: .string "c;"
+L20: .string "1.a"z.;0yy0"
+L21: .string "#9a99ycc", "c0a1"
+L22: .string "yc1yc#b9zy;#" ""##19"
+.data 1 , K , -5
+L24: prn #K
+.data 1 , K , -5
+L26: .string "b.a10z0:;.#"" "9zz;"c1bzaa"
+.string "1", "xayzxya:z:1:"
+L28: .string "yz"
+L29: .string "bcby9.x1b"
+.string "z0;b"
+prn #K
+.entry L25
+L33: prn #K
+.entry L24
+L35: .string "x.9zac9a;#"
+L36: .string "zzcy"
+.string "za;9::1"bza;" "0b"a"
+.string "9xcccac1a"
+.string ""by"
+ hlt
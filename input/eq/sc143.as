@@ -0,0 +1,42 @@
+.define K = 3
+.string "", "xb"
+L1: .string "b;y"0by;10:;"
+.entry L18
+L3: .string "bx;z"
+L4: .string ";:#" ""
+.string "#zyy:;.0z", "99bbc1ac"
+.string "zay:aa11a"
+.string "c1a" "9:11a..b#yx1"
+L8: .string "9#b"
+.string "y9b;:.yxc.z""
+.string "y9#ac"
+prn #K
+L12: .data 1 , K , -5
+L13: .string "yzyx0zb"
+L14: mov L5, r2
+.entry L33
+L16: .string ":y1xzbyza#c1" "zc;:z9"
+L17: .string "b"z::b"
+L18: .string ""
+.string ""01::99;#"
+mov L39, r2
+L21: .string "1:cx0;;;9"
+L22: .string "."
+mov L18, r2
+L24: .string "x;9xcc;#;z;"
+.string "";1z9b#:xx:"
+L26: .string "zxyc#1"
+.string ":zb#c"#"a"
+.string "byyzy:"
+L29: mov L36, r2
+.string ".b"""
+L31: .string ""
+L32: .data 1 , K , -5
+.data 1 , K , -5
+mov L32, r2
+.string "c." ";bbza"
+L36: .data 1 , K , -5
+L37: .string "zx", "b9xz0";cy:""
+L38: mov L3, r2
+L39: .string "x;0yb", ".bc9;"";"
+ hlt
@@ -0,0 +1,42 @@
+.define K = 3
+L0: .string "c#0b:01;x1:"
+L1: .string "9yx"
+L2: .string "9"
+.data 1 , K , -5
+.string "0.;x#c;" "yb"
+L5: .string "y9zx"
+.string "" "cx.:"0"
+L7: .string "b"
+L8: mov L34, r2
+L9: .string "."
+.entry L30
+.string ""
+.data 1 , K , -5
+prn #K
+L14: .string "ay", "a"
+L15: .data 1 , K , -5
+.string "90yyccx" "by"
+.string "by", "y1ca##9"
+.string ""
+L19: .string "z9xx:x.#xy1x" "b0.z::y"9;"
+L20: .string "a":"
+.string "xcb1x;9x""
+L22: prn #K
+.string "0x1:"b:zz9#"
+L24: .data 1 , K , -5
+.string "ax"y9.c#.:x"
+L26: .data 1 , K , -5
+prn #K
+mov L5, r2
+L29: .data 1 , K , -5
+L30: mov L5, r2
+L31: prn #K
+.string "0"
+L33: .data 1 , K , -5
+L34: mov L12, r2
+.string ".9:0axzxzax;", ""
+L36: .string "x10", "b"
+L37: .string ":;"
+L38: .string "yx019...;1"
+L39: .data 1 , K , -5
+ hlt
@@ -0,0 +1,42 @@
+.define K = 3
+.entry L33
+L1: .string ".#::."
+L2: .string "y"
+L3: .string "a;yyy0c"
+L4: .string ""ca;xa1.;01."
+.string "0:ac0"
+L6: .string ".y;;9a#00"
+L7: .string "1;;09#"
+.string "#c1x:z:y;b0x"
+.entry L1
+L10: .string ";", ";"
+.string "xx1#b", "0"
+L12: .string ""z9::"c""
+L13: .string ""ab;z:by"
+L14: .string "10b"
+.string "bx#xyaz9"
+L16: .string ".x1"
+L17: .data 1 , K , -5
+.data 1 , K , -5
+L19: prn #K
+L20: .string "#9:x.#;"
+L21: .string "x", ""
+L22: .data 1 , K , -5
+L23: .string "yc"
+.string "9x1abxx";yc#"
+.string ":cc0ca1z:"
+L26: .string "z#91.19a"#"
+L27: .string "y"
+L28: .string "zyb:b.;00x9x"
+.string "".ya.b#c;"
+L30: .string "01" "abyby0#.xy9"
+.string "b#bcyy"
+L32: .string "9:990c"
+L33: .string ".:#"
+.string "0z1":b"za.az"
+L35: .string "9#a#", "zx;c.1;ya"
+.entry L19
+L37: .string "y09a"
+.data 1 , K , -5
+.string "bc"
+ hlt
@@ -0,0 +1,42 @@
+.define K = 3
+.string "#bc;ybz#ax:0"
+.string "yz" ""
+.string "c.1#;x", "00:"
+L3: .string "1;cz:"
+L4: .string "z1"
+L5: .string "zac#z0"
+.string "y1.#;#:z;9"
+.string "#.#10"1c"1"
+.string "x.c0" ";:9:"
+L9: .string ""1z9x0.";y"
+L10: .string "c"
+L11: mov L3, r2
+L12: .data 1 , K , -5
+L13: .string "#1a"c9cbxxcz", ""
+L14: .string ""
+.entry L26
+L16: .data 1 , K , -5
+L17: .string ";1.9""1", "y"
+L18: .string "0;x0c11"
+L19: .data 1 , K , -5
+L20: .string "zc"
+L21: .string ""
+.string "0#"ax0#91#" "#:x;a::".x"
+L23: .string "y""9"
+.string "", "b"
+L25: .string ";0y0910" ".c"
+L26: .string "b#y99z"
+.string "x"a0"
+L28: .string "ca90x" ".b01;zz""
+.string "bzzbzc.99" "yz1ybb"
+L30: .string "91"
+.string ""
+L32: .string ":a9z:#999", "x.9b#b"
+.string "1"9zx""
+L34: mov L37, r2
+L35: .string "x1#yy;x.by"x"
+L36: .string "9yc:a"zc;9.", "a.a""
+.string "xbz", "a9"cy;;0xz"
+L38: mov L25, r2
+.entry L20
+ hlt
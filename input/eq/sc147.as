@@ -0,0 +1,42 @@
+.define K = 3
+L0: .data 1 , K , -5
+L1: .string "c:.#"y0", "b1zb"0#zzz."
+L2: .string ""
+L3: .string "9b", "x#a"
+prn #K
+.string "bx;0.x.b"
+L6: .string "0#";z0ax."
+.string "1x#zc"
+.string "1a0a.":" "0bz.yyx0"
+L9: .string ";z#" ".b0."
+L10: .string "y;c0x#c0:z"
+mov L15, r2
+L12: .string "9:##9y1#"
+.string "yxy1#ba"
+L14: .string "1xc9#cxb"09"
+L15: .string "0xxx0x"
+L16: .data 1 , K , -5
+.string "x;0.;b1:c"
+L18: .data 1 , K , -5
+L19: mov L12, r2
+.entry L21
+.string "0c#cb.:0#"
+L22: mov L14, r2
+L23: .string "z;:0;"
+L24: .string "z0#y"
+L25: .string "a;a11;a0"
+mov L20, r2
+.string "by;;9#0a0#a"
+mov L5, r2
+.entry L39
+.string "yy0.:"
+L31: .string ":0:.#c"
+L32: .string ":z01y0"
+L33: .string ":y.z:9x1bx"
+.string "9;zc;:" "1c;#."
+.string "y10"9z"#"
+.string "bc"
+.string "b0xxc"
+L38: .string "0.a.zb"
+.string ":999;yca1"
+ hlt
@@ -0,0 +1,42 @@
+.define K = 3
+.string ""
+L1: .string "bx1:"
+.string ";.x0z0;a0z"
+L3: .string ""
+L4: .string "byx0.0::" "09"
+.string ""
+L6: .string "::cc#1y1#x" ""10x"
+L7: .string "a:a1x99:#;#" "001"
+L8: .string ""
+.entry L27
+.string """.;b:y"
+L11: .string "."#":cy"
+L12: mov L20, r2
+.data 1 , K , -5
+.string "c#"
+L15: .string "z" "00x"
+L16: mov L15, r2
+.string "axy":c#:#ca9" "b.0;1;1"
+prn #K
+.string "z1"
+L20: .string "1bz;b"c9ac"
+L21: .string "z#;1zb"
+L22: .data 1 , K , -5
+L23: .data 1 , K , -5
+L24: mov L38, r2
+.entry L18
+L26: .string ";x1#b:9c;:xc"
+.string "yab.0#:1z9"
+prn #K
+.data 1 , K , -5
+L30: mov L13, r2
+L31: .string "#xc#zx09;;aa"
+.string "c;abc9a#by", "0;:"cza;z9"
+.data 1 , K , -5
+.data 1 , K , -5
+mov L9, r2
+L36: .string ".x#:zc:":b"
+mov L15, r2
+.string ""
+L39: .data 1 , K , -5
+ hlt
@@ -0,0 +1,42 @@
+.define K = 3
+L0: .string "ca"
+L1: .string ""
+L2: prn #K
+L3: .string "a0"
+L4: .string ":1c9"
+.string "zxc"
+L6: .string "c:" ""
+L7: .string "xb"
+.string "x9"##.ax#" ""
+L9: mov L40, r2
+.entry L14
+L11: .string ";y", "#9#".;9"
+.string ""
+.string ":;ya9#"
+L14: mov L15, r2
+L15: .string "#0x" "azyb10"zxab#"
+L16: .string ";"yc"
+L17: prn #K
+.string "c;1"
+L19: mov L12, r2
+.string "y::x0cy01""
+L21: .string "0:;z"a"1" ";0c#c0.za#z;"
+L22: .string "y"9;yz;.z."
+L23: .string "cb:"
+L24: .string "yc;#y1c10"
+.entry L8
+L26: .string "9y" "."
+L27: .string ";z:"yb#c"
+.string "by"
+L29: .string ":.9#zyybc", "19"z"
+.string ";a.a#x0";" "z9c119yz:;zb"
+.string "baay"yxzc;"
+.entry L14
+L33: .data 1 , K , -5
+.string ""
+L35: .string ""
+L36: .string "10""":9.z"0:"
+L37: mov L38, r2
+.string "1#1:9"
+.string "x9bz":y"
+ hlt
@@ -0,0 +1,42 @@
+.define K = 3
+L0: .string "acxaa#:c".z", "1.zy0"
+.string "#zxy."
+L2: .string "1b1;#z"
+.string "0#"#b1""
+L4: .string ".".ay91c"bb0"
+.string "y09xc99z"
+L6: .string "z01z"1#b#""
+L7: .string "00a"y.b"
+.string "c"1;"
+L9: .string "", ";"
+.string "..y:b;a"
+mov L27, r2
+.string "y;1y9"a#0"0"
+L13: .data 1 , K , -5
+L14: .string "yx"
+L15: .string ":;z" ""
+L16: mov L3, r2
+.entry L32
+L18: mov L36, r2
+.string "zb"
+.string "1;b0#;ab#"
+L21: mov L10, r2
+L22: .data 1 , K , -5
+.string "0x9:9" ".1;c".:#"
+.string ":0ayzc#yz"
+.string ";#xbb:yx.:b"
+L26: mov L14, r2
+.string ""
+.string "z#"
+L29: .string "11;c0b0" ".x:a1z0"
+.string ""
+L31: .string "1;#y01#"
+L32: .data 1 , K , -5
+.string "11z.;"
+.string "#9"
+.data 1 , K , -5
+L36: .data 1 , K , -5
+.entry L11
+L38: .string "by..xy", "yc1:"
+L39: .string "b:x#x00x", ".:1:::"
+ hlt
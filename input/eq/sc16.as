@@ -0,0 +1,42 @@
+.define K = 3
+L0: .string "x1a0":"
+L1: .string "y"z:"
+L2: mov L14, r2
+L3: .string "#;", ""
+.string "#yz" "bz109:c;y;ay"
+prn #K
+L6: .string "yy" "bc.1."a"
+.entry L30
+L8: .data 1 , K , -5
+L9: prn #K
+.data 1 , K , -5
+mov L23, r2
+L12: .string "0;z19:"#::"
+L13: .string "b9bxa0:a"b."
+.string ":.", ";a"
+L15: .string "cy00a01.11"
+.string ":y90b#"
+L17: .string "1"
+L18: prn #K
+.entry L27
+L20: .string ":1"c"" "0"a1y;yb"b"
+mov L15, r2
+L22: .string "19c19b#::" "za1b#1.#a9"
+.string "y0bxx1"
+L24: .string "0;;xa"
+L25: .data 1 , K , -5
+.string ".xx9#":""
+prn #K
+L28: .string "", "#9x1;1zc.1.."
+L29: .string ".y:":"
+L30: .string ".#.b.#xzx"
+.string "ba;cc:."
+L32: mov L22, r2
+.string "yb;0;x"
+L34: .string "x"bx0"
+L35: mov L26, r2
+mov L21, r2
+.string "a:c0x"
+L38: .string ""
+.data 1 , K , -5
+ hlt
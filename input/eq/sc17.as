@@ -0,0 +1,42 @@
+.define K = 3
+.string "yc#.." "bax0"
+.string "z:":.0c9ac"#"
+.string "#:xz9b.:"
+L3: .string ":;c:#0""
+L4: .string "a#.za1z;#"
+L5: .string "x9z"
+L6: .string ";"999cy:yzz"
+L7: .string "yzaa#za1.y1:"
+L8: .string ".1a;;9:c01."
+.string "xy", "bxa"9y#z#z"
+L10: .string "y"y:01b9b9:x", ";c#y"
+.entry L31
+L12: .string "1b1#xx1z"x"
+.string ";90a"z;c9" "zc#xy"
+L14: .string "9"
+.string "#c111"9c", "1ayyca""
+L16: .string ""
+.string "" "y;x#b#""a19"
+.string "", "b0a.9ax9yyzz"
+.string "0a9#zb" "a:."yzzbzc9""
+L20: .string "y"
+L21: .data 1 , K , -5
+L22: .string "9#;"
+L23: .string "0#9;#c:9"
+.string "#"y0b;x" "c#x09z9#1#9"
+L25: .string "9xza"
+L26: .string "9"
+.string "y"
+L28: mov L9, r2
+L29: mov L20, r2
+L30: .string "0b", "::##yxxx9"z""
+.string "0:xz"
+.entry L22
+L33: .data 1 , K , -5
+L34: .string "1#c#"
+.string ".xx#:"0b1:x"
+L36: .string "1.1":bcx0" ":00"
+.entry L15
+L38: .string ""c1"
+.string "1bc1ay1cxc"
+ hlt
@@ -0,0 +1,42 @@
+.define K = 3
+.string "xx1:1"
+.string "y.b"
+.data 1 , K , -5
+.entry L15
+L4: .string ";9x#:"
+L5: mov L19, r2
+L6: .string "x#.09z"
+.string ".y9by1;9c" ":#cxx::#0c09"
+.string "y9"z##"":"
+L9: .string "1b"
+L10: .string ":0#;"9:#9ac#"
+.entry L25
+L12: .string ".0:."
+.string "yc0.9"a;0"
+.string "0a999"19ba"
+L15: mov L25, r2
+L16: .string """#cxc"
+L17: .string "y1a#"bz#9."
+.entry L13
+L19: .string ".#xcyb;zb"
+L20: .string ".c0.0"
+L21: .string "ay0#.a;y0yb"
+L22: .string ":1bb#"z":y"
+L23: .string "bx.b"1#zc" "bxz"9:19#9#"
+L24: .string "a9:"x:xab0:#"
+L25: .string "x9c"
+.string "..1"
+.string "9cy0c1;x;y1" ".#z9a;1y#"
+.string ""
+L29: .data 1 , K , -5
+.entry L19
+L31: .string "b"9"ca", "x1b.."11xx"
+L32: .string "cx0""
+mov L35, r2
+.string "xa::." "0b"
+L35: .string "1bb", "zz"
+L36: .string "x"xc"
+.string ""
+.string "zcax:#.czy.9"
+.string "z"yyzx1z0" "9#by1c:"x1zx"
+ hlt
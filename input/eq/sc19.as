@@ -0,0 +1,42 @@
+.define K = 3
+.data 1 , K , -5
+L1: .string "z9y;c;" "0zy""
+L2: .string ";xbxb910""
+L3: prn #K
+.string ""01:y;9"c#:0"
+.string "x0xcc:1b9.1a" ";b91"91"
+.entry L0
+L7: .string "1b:.:y"
+L8: .string ".c11"
+L9: .data 1 , K , -5
+.string "0b1b191:ac0:"
+L11: .string "1"bx"
+.entry L4
+.string "a0"
+.string ""
+.string "y9z" "y:"xbxy91#9c"
+prn #K
+.string "y:.:9y:9;0"" ""
+L18: .string "9"
+.string "0:zzzc1""z."
+L20: .data 1 , K , -5
+L21: .string "bz0z1"
+L22: .string "bx0a"
+.string "b.;9b"a;"
+L24: mov L20, r2
+.string ""
+L26: .string ""1cb.1y90"
+.string "xycz19x91y"
+L28: prn #K
+.string "c09y1z1", "a;x:y9"
+L30: mov L8, r2
+L31: .data 1 , K , -5
+.string "by#01;b"
+L33: .string """b", "c.90y10"
+L34: .string "ay;#1;zxyc#b"
+L35: .string ""
+L36: .string "a", ".1yzzy"
+.string ""
+.string "zy.:1b9"
+L39: mov L38, r2
+ hlt
@@ -0,0 +1,42 @@
+.define K = 3
+.string "", ""c.#:"
+L1: .string ""
+L2: .string "#."9z9"
+.string "" "009c9"
+L4: .string "c9"
+.string "1#", "#z#;zz"1"
+mov L29, r2
+L7: .data 1 , K , -5
+L8: .string ""#z:11z;"
+L9: .string "xz"."c;y#1" "."9999:;;0y."
+.string "b#"z.a"x." ":ay;x:b#9"
+.string ""
+L12: mov L23, r2
+L13: .string ""
+L14: .string "azyc"c.c9.a", ""
+.string ""
+.data 1 , K , -5
+L17: .string ""
+.string "" "0";.c1xb::z""
+.string "9;"
+L20: .string "yy;0:"
+L21: .string "" "cc"
+L22: .data 1 , K , -5
+.string "x.1", ";"
+mov L23, r2
+L25: .string "#aca00cb"
+L26: .string ""
+L27: .string ":11y9:0x"
+L28: mov L27, r2
+L29: .string "a09;cb:#1"
+.string "zy.zya":0" "x"#:"
+L31: prn #K
+L32: .data 1 , K , -5
+.entry L0
+L34: .string "bx#1xb;z0.1"
+.string "bbb;"
+.data 1 , K , -5
+L37: .data 1 , K , -5
+.data 1 , K , -5
+L39: mov L22, r2
+ hlt
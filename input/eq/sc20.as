@@ -0,0 +1,42 @@
+.define K = 3
+.string "cy::"b"z;ca0", "b"
+L1: .string "xxz::z"
+L2: .string "0bx;xax"
+.string "y.yc"
+L4: .string """x", ""
+L5: .data 1 , K , -5
+.string ".1c:y9"0c"
+.string "c#;0zxb;a9x", ""b"
+.entry L20
+L9: .data 1 , K , -5
+.string "a":cb19zab;"
+L11: .string ":"
+.data 1 , K , -5
+L13: .string "aca:.9cy"c0"
+L14: .string ""xb"
+.string "b11acx":y0" """
+L16: .string ".baya0z.y0"
+.string ";", ""
+.string ";z.acyy;" "a"
+.string "0.;b;"z#y"
+L20: prn #K
+.data 1 , K , -5
+L22: .string "" "b;"1zx#"
+.string "x;azcb"
+.string "x9cy#.a"
+L25: .string ""
+L26: .string "0.9".y" ".y;##b:1yz"
+.string "1cz"
+.string "c:...::9"
+L29: .string ""
+L30: .string ".y"1:ccc"
+.string "#"
+.string "zbcyybcyb1"
+L33: .string ""9.:b:c".y9"
+L34: .string ":#91"cc", "bx10"
+.entry L19
+L36: .data 1 , K , -5
+.string ".y""
+.string "bz9x.#c" ""ycaz"
+L39: .string "c9bc;"99ab""
+ hlt
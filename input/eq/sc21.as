@@ -0,0 +1,42 @@
+.define K = 3
+.string "y1"x#1#9c9"
+L1: mov L37, r2
+L2: .string "xx.a0.#0;1az"
+.data 1 , K , -5
+L4: .string ""bb#a1c9.z0", ":a"
+L5: prn #K
+.string ":##;.bb919"0"
+.string "yz190z", "ya"bc."
+L8: .string "9", "x;;z9;bc"
+.data 1 , K , -5
+.string "xbcb"
+L11: .string ":a"
+.entry L26
+L13: .string ";az190:xxc9", "0#.1a"ya"y:y"
+L14: .string ":cc.."
+.string ".1ax"z#c"
+L16: .data 1 , K , -5
+.string "c9;y" "a0:c.ay;z:x"
+L18: .string "##cccb" "a:"
+.string "ycy9z01x;c"
+.entry L35
+mov L32, r2
+.entry L0
+.string "#;c".x"
+L24: .data 1 , K , -5
+L25: .string ".y"9"
+L26: .string ";a9;.z9y"
+.data 1 , K , -5
+.string "xzbz:"
+L29: .string ":"
+L30: mov L39, r2
+.string "119900bxaa:", "y.;"
+L32: mov L15, r2
+L33: .string "::b"
+L34: .string "x#1::#;:."
+.data 1 , K , -5
+.string "y;0"9."
+L37: .string "0.cb"
+L38: .string "..1bc."
+L39: .data 1 , K , -5
+ hlt
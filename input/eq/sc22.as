@@ -0,0 +1,42 @@
+.define K = 3
+L0: .string "", "c.b.:z#"
+.string ";c9:."
+L2: mov L1, r2
+L3: .string "c"b" "#;a.z;zyc0y"
+.entry L32
+.string ".c0az9a0y9"
+.entry L11
+L7: .string "ay;;9990#"
+L8: .string "zb0#0a"" "x0ab1xca"
+L9: .string ":x1ab"
+mov L12, r2
+L11: .data 1 , K , -5
+L12: .string ";1"
+.string ";y"
+L14: mov L4, r2
+L15: .data 1 , K , -5
+mov L38, r2
+L17: .string "9z"
+L18: .string ";0.ycabxz:b"
+L19: .string "c" "b;1;x0zb.9"c"
+.string ""
+mov L3, r2
+mov L29, r2
+.string "y"
+L24: .string ":z", "c;ya"1."
+L25: mov L40, r2
+L26: prn #K
+L27: .data 1 , K , -5
+L28: .string """.a"
+L29: .data 1 , K , -5
+prn #K
+.data 1 , K , -5
+.string "xyy9"
+L33: prn #K
+.data 1 , K , -5
+L35: .string "z"#b0:", ".cb"
+L36: .string "9"cx9z";"
+.string "9"
+prn #K
+L39: .string "y9"
+ hlt
@@ -0,0 +1,42 @@
+.define K = 3
+.string "a", "09zc.x"
+.string ""
+L2: .string "", "0z#ax#a;z:c"
+L3: .string ""z;y:z;b"1c.", "1::cc#c9z:"9"
+L4: .string ""
+L5: .string "zbzy9y#19", "b;"
+mov L15, r2
+L7: .string ";b0c1aa:00a"
+L8: .string "#.a"
+.string "a#01x", "19x#"
+L10: .string "9", ".9"
+L11: .string "a1"
+L12: .data 1 , K , -5
+.string "0b.":.x9y00y"
+L14: .string "ba:c" "."0xc:bz"
+L15: .string "1#1.yaz0" ".""
+L16: mov L28, r2
+mov L26, r2
+L18: .data 1 , K , -5
+L19: .data 1 , K , -5
+L20: .string "ybxa" "0#a:1;0"
+L21: .string "yzc0"
+.entry L35
+.entry L5
+.string "9z"
+L25: .string "#1a"ay#"b"
+.string "", "y"
+.string "bc.90;:zyb;." "ab"
+L28: .string ":c.y1.y;#"
+prn #K
+L30: .string "zb" "x0z"
+L31: .string ":z9:x."
+L32: mov L40, r2
+L33: .string "y"a10z.x#:9c"
+L34: .string ".01"c"
+L35: .string "a:y1""
+L36: prn #K
+L37: .string ":0";c1x:#", "1"
+L38: .string ""
+L39: .string ":.:"y.cc;b#"
+ hlt
@@ -0,0 +1,42 @@
+.define K = 3
+mov L11, r2
+L1: .string "::"
+L2: mov L18, r2
+mov L28, r2
+.string "ba9c1."1:y"
+.string "";c:", "b9:z"
+L6: .string ".bybx"
+mov L31, r2
+.entry L17
+L9: .string "#c:cz1x", "c19y9#x9#xb:"
+L10: .string "0x#"
+L11: .string "y#c.;"
+.string "aa"1."
+.string ""
+L14: .string "91;90""
+L15: .string "cz.b"
+L16: .data 1 , K , -5
+L17: .string ":00:0yy10:#"
+.entry L1
+.string "#x"
+.string "1cc" """
+L21: .string "1acz#yb"cbc"
+L22: mov L33, r2
+.string "::11"
+.string ""czbx9ccc1z"
+.entry L39
+L26: .string ":;;xy1bxx0;"
+L27: .string "1."c"acc"x.""
+L28: .string ";.;xzyxy19"
+L29: .string ";yxz"x#"#"
+L30: .string ""1z11;0"
+L31: .string ""#y:#9"b;:zx"
+mov L22, r2
+L33: .string "x9y;:.zc"
+L34: prn #K
+.entry L37
+.string "x"
+L37: .string "#1c9.x""
+.string "bz:.c:;#x;", ";0"
+mov L24, r2
+ hlt
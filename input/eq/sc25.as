@@ -0,0 +1,42 @@
+.define K = 3
+.string ""
+.entry L2
+.entry L2
+L3: .string ""b;:."x9#"
+.string "z919b"::"
+L5: .string ":c;" "0"
+L6: .string "" """
+mov L28, r2
+L8: .string ":11a""1y"
+.string ":1a1x0", "b"cbb"
+.string "xc"
+L11: mov L40, r2
+.string "91zyz111" "10z9b""
+.string ";#;x;ac.;y9"
+L14: prn #K
+L15: .string ".""
+L16: .string "bb0:;", "9z"
+.string ".", ".":"cbb;"
+L18: .string "xyb.b.bya1;y"
+L19: .string ""
+L20: .string "yayb.;cz"
+L21: .string "z"9ay1z", "cz0bxa:bc";0"
+.string "b.":zy9"#a"
+.string """
+L24: .string "#.1a##b#bx" "c#0#;y."
+L25: .data 1 , K , -5
+L26: .string "y"
+.string "cb9" "1b;:#x0c##c"
+.string "xb"10cyxzcc"
+L29: .string "x.xzy0;"""1"
+.entry L40
+L31: .string ""
+L32: .string "#;c:#az00yz""
+.entry L15
+.string "a0abzx"
+L35: .string "", "bb"::9#yb"
+L36: .string "#;"
+.string ""
+L38: .string "z.#.c#b1"
+L39: .string "919yz""0;"
+ hlt
@@ -0,0 +1,42 @@
+.define K = 3
+L0: mov L13, r2
+L1: .string "##"
+mov L10, r2
+.data 1 , K , -5
+L4: .string "#."", "ccx"
+prn #K
+.string ""
+mov L34, r2
+L8: .string ""
+L9: .data 1 , K , -5
+.string "".xayx"
+L11: .string "cabbc99."
+L12: .string "#b"9zb0#a"
+L13: mov L2, r2
+.string "bc:yz##;#:.0"
+L15: .string ""
+L16: .string ";"
+L17: .data 1 , K , -5
+.string "a#0ay0cbycb"
+.entry L27
+.string "1"z:" "0abbx1xyxc""
+L21: .string "z.b9:b.c.aac", "bxyz0"
+L22: .data 1 , K , -5
+.string "b" "#bc"
+.string ".9c#c9aa01"
+.string "cxa9a"
+.string "";.1zy#"
+.string ""1#a"y0a#"
+L28: .data 1 , K , -5
+L29: .string ";y9" ";a;.z#x1yb""
+L30: .string "", ":;#;##bc0::"
+.string "b101#"
+L32: .string "y#b:#1:bz"
+L33: .string "y"
+.string "zc"1a;#;1"
+L35: .string ".11xcby"
+.string "#x#aby#::x"
+.entry L22
+L38: .string "9xyx:b" "#c90y1:b1"
+L39: .string "c;:"" "z:19z;z":."
+ hlt
@@ -0,0 +1,42 @@
+.define K = 3
+.data 1 , K , -5
+L1: .string "y", "yz""0"
+L2: .string ".", ":b;"0#0.a"
+L3: .string "1yc;z;:x."", "0"
+.string "", "bc1.cy9a"
+L5: .string "cz;;0by1""1z", "#y"
+L6: .string "xcx#.19b"
+L7: mov L40, r2
+L8: .string "..by11y9"
+L9: .string "199:ba;az#xy"
+.entry L27
+L11: .string ""
+L12: .string "", "0x""
+prn #K
+.string ""
+.entry L8
+.string "bx;z"ya", "y9"
+L17: prn #K
+L18: .string "c..z;.axb1;;"
+L19: .string "acb0"
+L20: .string "9..ac1a;;9"""
+L21: .string "xb9;9#1z"
+L22: .string "caz" ".z0"
+L23: .string "#."a.#:ca"
+L24: .string "b:.cy:;", "z.990"z;b1z"
+L25: .string "x;#:x9."
+L26: .string "by.y:", "1y0ya""
+L27: .string "a1"x#ybbc#xy" ";"0;yy9a"c:"
+.string "#"
+mov L40, r2
+.string ""
+L31: .string "z.a0:b9"
+L32: .string "";"
+L33: .string "1":."
+L34: .string ":cz1zy."
+L35: .string "0919cb0:00":" "0z00"cbbc"
+L36: .string "cy19.0z.cyz"
+.string "c0a99a"", "cy9.1ay:#""
+.entry L35
+L39: .data 1 , K , -5
+ hlt
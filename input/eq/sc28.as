@@ -0,0 +1,42 @@
+.define K = 3
+L0: .string ".cxc:1#0x"
+.string ";x"
+L2: .string "z."cc9"
+mov L39, r2
+.string "xa"
+.string "9"
+.string "0cxzba0#"", "c0#y""
+.entry L11
+L8: .string "x..90axxa"
+.string "0b1""c.19x9#"
+.string "1"y"
+L11: .string "0:9y1c"
+L12: .data 1 , K , -5
+.string ":zbx0"
+L14: .string ":y"9;:1bc#"
+L15: .string "1"
+L16: .string "#.00#0".bzx", ";;9z9"
+.string ":"
+.string ".."
+L19: .string "1":x"
+mov L30, r2
+L21: .string "bb0", ""y1"zz0zx#a"
+mov L36, r2
+L23: mov L21, r2
+L24: .string "bb;x;", ":10:"
+L25: .string "x"", "yx0ay"19x"
+L26: .data 1 , K , -5
+L27: .string "za9z"."
+L28: .data 1 , K , -5
+.entry L34
+.string "a.0aa9z"
+.string ":;""y0yb0b1c"
+.string ":"#9x"
+L33: mov L16, r2
+L34: .data 1 , K , -5
+.entry L24
+L36: mov L13, r2
+L37: .string "xx;cyy;cx.a:"
+L38: .string "1"0##0z.:;;x"
+.entry L26
+ hlt
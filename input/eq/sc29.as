@@ -0,0 +1,42 @@
+.define K = 3
+L0: .string "yb9z00aab" "x#zb1z;90""
+L1: .string "#0:#:;"
+L2: .string "9#x"" "19c#y#y;.:10"
+prn #K
+mov L8, r2
+.string "b90c0::01y;:"
+mov L40, r2
+mov L13, r2
+L8: .data 1 , K , -5
+L9: mov L26, r2
+L10: .string "ya", ""
+L11: mov L0, r2
+L12: .string "", "#acc.1zx"
+L13: mov L1, r2
+L14: .string ""a"
+L15: .string ":"9"
+.string "a;b#.;yzx:0#"
+.entry L36
+.entry L7
+L19: .string "#a:z0cc"
+L20: .data 1 , K , -5
+L21: .string "1a1" "x"1c":9:z"
+.string ""
+.string "yabyxzxbx."", "xb#yzzaczx""
+.string "y9zz"
+.string "c#;;b:yb##b"
+L26: .string ""##z"
+L27: .string "b:#".z#..0"
+L28: .data 1 , K , -5
+L29: .string "9zc9#.c9a1x", "#0."
+L30: .string "99;"ax", "1.z"
+.string "y9."
+prn #K
+.string ":y#a:b""
+L34: .string ";.;:z0;;ybx"
+L35: prn #K
+L36: .data 1 , K , -5
+.string "zc91cbzcaa90"
+.string "0.0#x#:;;:"
+.string ".y.a"
+ hlt
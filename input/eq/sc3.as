@@ -0,0 +1,42 @@
+.define K = 3
+L0: .string ";1:;b"
+L1: .string "xx.19"91", "x:"
+L2: .string "", "c"
+L3: .string "" "1;.0"
+L4: .string ";1czbac1xy:0", "09"0"
+L5: .string "z:a" ":.c."z9;;"
+.data 1 , K , -5
+L7: .string "b", "1bz#b0cay0"
+.entry L39
+L9: mov L37, r2
+.string "9xay"
+L11: .string "0y;"
+.data 1 , K , -5
+L13: .string ""0"
+.entry L38
+L15: .data 1 , K , -5
+.string "0:..", "0y9y"
+L17: .string "za0;;:ca:"
+.string ";.y.1"
+.string "y:1y;"
+L20: .string "z";yy#0b#"a;"
+L21: .string "#yxzc:0:.b"
+L22: .string "1#""
+.string ";1y"
+L24: .string "z#""
+L25: .string "":b#;z;c0y9#"
+.string "0;0a"
+L27: .string "909.xa.1""
+mov L34, r2
+L29: .string """
+.string ""
+L31: prn #K
+.string ";aa1.b"
+.string "90a;bzcy"
+.string "" "b9""
+L35: .string "c"a1:;"0a#yx"
+L36: .string "z#"a"a#" "a"
+.string "9", "czbz0"
+L38: .string "z0b" ""
+L39: .string "az"
+ hlt
@@ -0,0 +1,42 @@
+.define K = 3
+L0: .string "" "ya0"
+L1: .string ""
+L2: .string "c", "90":z9b0a"
+L3: .string ";b:y:9" ";"
+.string "y9bc"
+.string ".9yc9:"
+L6: .data 1 , K , -5
+.entry L33
+L8: .string "b11y1y;y.:"
+L9: .string "0:xx"
+.string "y90::0y##", "1zy9c.cy9za"
+L11: .string ""
+.string "#":9a.1:ac"", ""zy1"9cc""
+.string ""ax0;" ""
+.string "x#y#y#"
+L15: .string ""
+L16: .string "#1;.cbx"
+L17: .string ".bb0bcc"
+.string ";c#"#".z99"
+L19: .string "x.;" "c1"
+L20: .string "cxcy0xya", ".ya"0""
+L21: mov L6, r2
+.string "b1bxa9:1"
+L23: .string "1"
+L24: .string "z"
+.string "1:10bx.bca;;"
+.string "a;1."
+.data 1 , K , -5
+L28: .string "a"#::b;#"
+L29: .string "yb"
+.string ";zz0ba;""
+L31: .string ":z#0:c9"
+.entry L23
+L33: .data 1 , K , -5
+.string "c"
+.string ":x#;c"c"
+L36: .string "bz9a#"#xa9a"
+L37: .string "c##""
+.string "caxz1"
+L39: mov L39, r2
+ hlt
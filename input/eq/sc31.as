@@ -0,0 +1,42 @@
+.define K = 3
+L0: .string "c:acb9"
+L1: mov L2, r2
+L2: .data 1 , K , -5
+L3: .string "x;bba#" "zxxz0z"
+.string ";:9aa""
+L5: .string "0ab.9"1:#xx#"
+L6: .string "1ay"
+L7: .string ":"zx.b##yc"
+.string "bcxa", "z.b:0yy:""
+L9: .string "z10#a9.byb":"
+L10: .string ""c1a1;#9y"z"
+L11: .string "1"
+mov L1, r2
+.string "zxab0;y"
+L14: .string "";a;x#x""", "91"
+.string "0x9x.;1y" "zczb9#z"
+.string "#ca":b.0x", "yx0.y9"
+L17: .string "", ""yy9x0".z"
+L18: .string "xxxzzy.zb#x"
+.string "11:y:c0"
+L20: .string ""aay0y#"
+.entry L19
+.string "x;c"
+L23: .string ":" "az9"
+L24: .string "y#00"
+L25: .string "a";x.x" ":zyb#9"
+L26: .string "c#ayz#"
+L27: .string "9cba1#1"
+L28: .string "a:".:zxcb1"
+L29: .string ";0x0x"
+.data 1 , K , -5
+.string "#0c".#."
+L32: .string "#b1a"
+.string "c:0" "zz0#"
+L34: .string "0zbc:xy"cb"
+.string ":#10"
+L36: .string ""11zc.01" ";zz""
+.string "." """.x99;;#"
+L38: .string ";19z";"
+L39: .string "cc.c19."."
+ hlt
@@ -0,0 +1,42 @@
+.define K = 3
+L0: .string ".x1a"
+L1: .string ""
+.string ";a9##", ""
+L3: mov L18, r2
+L4: .string "z", "b.c1a0aa"
+L5: .string "1c9"".y;;;b"
+L6: .string "bx:0"" ".b#1a""
+.string ""
+L8: .string "0a"
+L9: .string ".zz11"x;"
+L10: .string "0;.zx"" "c;:"z:zc"
+L11: .string "a", "#""
+.string "0bz0czy", "9#xc#.;y1:z"
+L13: prn #K
+L14: .string "", ".x:9#z0xb"
+.string "x;"
+.string ""
+L17: prn #K
+L18: .string "b9x:"z#:by;"
+.string "c"
+L20: .string "z.:9z"
+.string "aa99a", "bb"
+L22: .data 1 , K , -5
+L23: .string "9c1y.x"xyb" "x""az19#y:c""
+L24: .string "a"
+L25: mov L16, r2
+L26: .string ".xa.1cca#x0", "a#";:;#by"
+L27: .string "z1;a;#1"
+.string "czz9bz0;x#:"
+.data 1 , K , -5
+L30: .data 1 , K , -5
+L31: .string "ybx;"
+L32: .string ""
+.data 1 , K , -5
+L34: .data 1 , K , -5
+L35: .data 1 , K , -5
+.string "b:"
+.entry L34
+L38: mov L5, r2
+mov L35, r2
+ hlt
@@ -0,0 +1,42 @@
+.define K = 3
+.string "1:99" ";9z:911y::"
+L1: .string ""
+.entry L17
+L3: .string "xb"azyxb.z", "#x9yz"
+L4: .string "0c:baz" ":9"bbcbb#za"
+L5: .string "::0"
+L6: .string "1#"y1ba1"
+L7: mov L15, r2
+L8: .string ".z""."c"
+L9: mov L5, r2
+.entry L18
+L11: .string "0y1;#10a"
+.string "bc"
+.string "c#.z"00#z"
+.entry L37
+L15: .data 1 , K , -5
+mov L0, r2
+L17: .string "";b;"
+.entry L38
+.string "a;09:za"c0ab"
+L20: .string ""
+L21: .string "bzzb#.1"ya"
+L22: prn #K
+.string "zz9c.zbz0"
+L24: .string "9"
+L25: .string "9cc#19"
+.string ""
+L27: .string ".yxy;"
+L28: .string ";y.yx#"
+.string "bb"x:"
+L30: .string "a"x:#c"
+L31: mov L4, r2
+L32: prn #K
+mov L27, r2
+.entry L18
+mov L40, r2
+L36: .string "0#11:0bz#1c"
+L37: prn #K
+L38: .string ""0"
+.string "0c;9b#"0"
+ hlt
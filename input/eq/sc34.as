@@ -0,0 +1,42 @@
+.define K = 3
+L0: .string "a0z" "0"
+L1: .string "by"
+L2: .string "b#azy.9."
+prn #K
+.string "0zxx" ";c"
+L5: .string ":"b"
+mov L17, r2
+L7: .string "#c0"
+L8: .string "9", "0"1zc1y"
+L9: .string "9b;9"
+L10: .string "#9.#", ";""1bb.az0z"
+L11: .string "z:ya.;:"
+L12: .string "b9yb" "1#cy:.#c"
+.string ""0cb1z;c#cy"
+.string "."";;91a"
+L15: .string "ccb009"
+.string "1x0;.y1", "9;#b:xc.9:y:"
+L17: .string "11"9yx9"
+L18: .string "z"#:y"
+L19: .string "azyc091aab", "";;0"b;y""
+L20: prn #K
+L21: mov L40, r2
+.string ".cax"
+.string "z#xz"b" "cx.xb."
+L24: mov L1, r2
+L25: .string "9yz"""
+.string "1y;.9.;#z"
+L27: .string "xz"
+L28: prn #K
+L29: .string "##", "b""
+L30: mov L21, r2
+.string "0bz1" "y9b#b0#x;."
+.string ";":bz;yaa.#"
+L33: .string "ax1c", "x;c9#;c0"
+L34: .string "zb.0y";.:#"
+L35: .string "c191"
+.entry L17
+L37: .string "a#x."b9a0";1"
+.string "b"
+.data 1 , K , -5
+ hlt
@@ -0,0 +1,42 @@
+.define K = 3
+.string "z"cy0y;a.9#" "y:z#.;#bza9a"
+.string ":1aax"
+L2: .string "b1"zbyc;b"
+.string ""1z0;0a"
+.string "9#a""b:z" "b"
+.entry L0
+L6: .string "x#;"
+.string "b"
+L8: .string ";;a:19""
+L9: prn #K
+.string "a.0"9.;y99cz" "1:bz"
+L11: .string ".1:#0"
+.entry L6
+.string ":9c1b"
+L14: prn #K
+.string "z19.ac"
+L16: .string "##9b.", ".:91#"xcx0xy"
+mov L25, r2
+L18: .string "b1;9"x;"
+.string "0";yx.#xzza", ""
+L20: .string "0", "1;a"a"00azy"
+L21: mov L29, r2
+L22: .string "10ba;"
+L23: .string "#;ax"z1."
+.string "a"
+L25: mov L2, r2
+mov L14, r2
+L27: .string "b#z;z.cy1y"
+L28: .string "1#c:1cz"09c"
+L29: .string "y9x"
+.string "1c.#"
+L31: mov L31, r2
+L32: mov L19, r2
+.string "zy";ccyc0"
+L34: .string "b"
+L35: .string "1"czx;a"
+L36: .string ";b10c1.:zyac"
+.string ";:.#"
+L38: .string ".y;a#", "#x#"
+L39: .string "cc#az1yc:"
+ hlt
@@ -0,0 +1,42 @@
+.define K = 3
+L0: .data 1 , K , -5
+.data 1 , K , -5
+L2: prn #K
+L3: .data 1 , K , -5
+L4: .string "1;#y0.01c#" ""
+L5: .string ":.0";"
+L6: .data 1 , K , -5
+L7: .string "90b"
+.data 1 , K , -5
+L9: .string ""
+.string "" "..y"
+.string "ayy.x1cxy" ""
+.string ":xb1"
+L13: .string "b;"
+L14: .string "y1a;c9yc" "c0;99:azyb;"
+L15: .string "zbxbyax"
+mov L31, r2
+L17: .string "a""9:#x.""
+L18: .string ""ay;1xz#"
+L19: .string ""zb"z1b1;;"
+.string "by:za1ca..z"
+L21: .string "cc.z:xccxz"" "#by1xbabz"
+L22: .string "1#9b:9byx0", ";a0"1#yc"9"
+L23: .string "xbcx111zx#"
+L24: mov L0, r2
+L25: .string ".c"
+.string "1#aba9.ca", ";y."
+L27: .string "#yz#.01" "1:0;9;9b;"
+L28: .data 1 , K , -5
+.string ".9b90bc10""
+L30: .string ".x""
+.string "yb", "ax"bb"y"":a"
+.string ""
+prn #K
+L34: .string ":#c.#:b0"
+L35: .string "z;.9"#:"
+.string "9"10#z.9:zb:"
+L37: mov L31, r2
+prn #K
+L39: mov L37, r2
+ hlt
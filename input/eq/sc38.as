@@ -0,0 +1,42 @@
+.define K = 3
+L0: .data 1 , K , -5
+L1: mov L29, r2
+.string ";z"
+mov L19, r2
+.string "0x;b91c09"
+.string "";9ac1byb."
+L6: .string "y:cz10"
+L7: .data 1 , K , -5
+.string "zbx9.;xy.ac"
+.string "z"ba.9".;z";"
+L10: .string ":bc;;a9"
+L11: .string ""#";:..y"
+L12: .string "a#b1.9:xyyc"
+L13: .string "0ab"
+L14: .string "1;0y.:a#0y0", "1zcx0;."
+mov L10, r2
+L16: .string "x;y"
+L17: .string "a01a9"
+.data 1 , K , -5
+L19: .string "bc"9"
+.string ":"
+.string "zyzy:#"
+L22: .string "#;1xc;.z9""
+.string "yyx0", "#"
+L24: .string ";c9y"
+L25: .string "#."b"
+.string ""
+.string "0:::x0accc"
+prn #K
+L29: .string "c"
+.entry L40
+.string ".9a"19." ""
+.string "c;:9ayy##"
+L33: .string "b"
+L34: .string "1b#yxx;c;", "0;:"
+.string "", "z0cc"
+.string "9az#"
+.string "z#xbbazccaz:", ";:"
+L38: .string "9a"
+L39: .string ""
+ hlt
@@ -0,0 +1,42 @@
+.define K = 3
+L0: .string "x0."
+L1: .data 1 , K , -5
+L2: .string ""
+.entry L0
+L4: .string "#b"09;yy.b10"
+L5: .string ""a:x;;1;#:0"
+.string ":z1c90", ":#yx"
+mov L25, r2
+prn #K
+.string "0"
+mov L0, r2
+.entry L24
+.data 1 , K , -5
+mov L39, r2
+L14: .string "x9#"x".xc9"
+L15: mov L32, r2
+.string ""9x"
+L17: .string "zz" ""
+.string "" "bb#191"zy:"
+L19: .string """
+L20: .string "#"
+.string "z""
+.string "zz;"
+.string "x1za;09"
+L24: .string "#a9" "z"az0x.b"
+.data 1 , K , -5
+.string "#yy;b1#;a"" ":z"
+L27: .string "y91b"
+prn #K
+L29: .string ":cy"
+.string "y:..1xz#c" ".czzx1zz."
+L31: mov L1, r2
+.entry L27
+.string "a11x1;"
+.string "z9:"b;zy"
+.string "y#:"9"
+L36: .string "x1x1", "c"
+L37: .string "xz:.z11"
+mov L27, r2
+L39: .string "#.x""##0", "::z;z1bxyb"
+ hlt
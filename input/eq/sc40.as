@@ -0,0 +1,42 @@
+.define K = 3
+.string ""
+.data 1 , K , -5
+.string ".1"a"
+L3: mov L12, r2
+L4: .data 1 , K , -5
+L5: .string "zbyzc#9:"", "0"
+L6: prn #K
+L7: mov L9, r2
+L8: .string ""y1#c;x109b"
+.string ""
+L10: .data 1 , K , -5
+L11: prn #K
+.string ";1y"9"
+L13: .string "", "0c#.1b".0"
+L14: .string "x1#"
+L15: .string ":bc#"
+L16: mov L11, r2
+L17: .string "0:0"
+L18: .string ""
+mov L2, r2
+prn #K
+.string ""
+.string "z9.a9""
+L23: .string ":.9a" ";a;"
+L24: mov L37, r2
+.string "" "bc#c"
+.string "#xz;0"
+L27: .data 1 , K , -5
+L28: .string "1y.1x1;"
+.string ".""1ax0"
+L30: .data 1 , K , -5
+L31: .string "x;aa:c.9.zbx"
+L32: .string "ax;b#"
+.data 1 , K , -5
+L34: .string "1babyy"
+L35: .string "x;b0cb"
+L36: .string "1#0"
+L37: .data 1 , K , -5
+L38: .string "c;y11#z"
+L39: .string "9"
+ hlt
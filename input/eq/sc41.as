@@ -0,0 +1,42 @@
+.define K = 3
+L0: .string "0;"
+L1: .string "#;a#x:"a1cc"
+L2: .string ";;ab#;a0"y""
+L3: .string "c9:abbc"
+L4: .string "x;a;;", ""ay0cb:b0a::"
+L5: .string "b1"
+L6: .string "9aa:"
+.string "a.":""#"b:."
+.entry L5
+L9: .data 1 , K , -5
+prn #K
+L11: .string "1:.0#1b:y9x"
+L12: .string "z#;0#y#1.bx"
+L13: .string ":xbx9;;"
+L14: .string ".b"1;..x9#"
+.string "ac;.c", "9:c0.#ba"
+L16: .string "0yycy"0;x"" "y;;0y0#1."x"
+L17: .string "c1ybx11"
+L18: prn #K
+prn #K
+L20: mov L40, r2
+.string "z;c0""
+.string "ca:;90"
+L23: prn #K
+.string "x0.ca9z;9.c"
+.string "zcy" ":#""1a.yby0#"
+prn #K
+.data 1 , K , -5
+.string "b"
+.string "yc"
+L30: .string "zz"a"
+.string "bac.y9"#yzc", "#9#01:y"
+.data 1 , K , -5
+L33: .string "#"a" "ax":zyyy"
+L34: .string """
+L35: .string "9#.az:xz" ";:10:x"
+L36: .string "ac10."
+.string ";a".b:01:b9." ".b"#."#ab:;y"
+L38: .string ""
+mov L34, r2
+ hlt
@@ -0,0 +1,42 @@
+.define K = 3
+L0: .data 1 , K , -5
+L1: .string "b:.9b;0aabx"
+L2: .data 1 , K , -5
+mov L26, r2
+L4: .string ""a##c.0zycx#"
+L5: .string ";y#a."
+.string "9"
+.data 1 , K , -5
+L8: .string "a"
+mov L14, r2
+.entry L29
+L11: .data 1 , K , -5
+L12: .string ".::b"
+.string "10"
+.string ":z"", ""
+L15: .string "bx;."
+L16: .data 1 , K , -5
+L17: .string "cx.9", ";0;0zxc91b#"
+.string ":0;b00;19y9""
+L19: .data 1 , K , -5
+.entry L21
+L21: .string "a..y9#c"
+.string "9;xcz#c9#9"
+L23: .string "z" "yxax;bb.1"b#"
+.string "cy9";0x9"
+.data 1 , K , -5
+.string "191bx"
+L27: .string ";xa"
+L28: .data 1 , K , -5
+.string "9", "1x9c.;;1x#"
+L30: .string "0z001".a::"
+L31: .string "#"bxx"
+L32: .string "1x"b"
+.entry L3
+L34: .data 1 , K , -5
+L35: .string ""xc011x"0ac0"
+.string "1y0..#9:.1cx"
+L37: .string "a.zaa;19", "ca9b"cb;"
+.entry L36
+L39: .string "b0:;;9zyx"
+ hlt
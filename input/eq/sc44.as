@@ -0,0 +1,42 @@
+.define K = 3
+L0: .string "c"
+L1: .string "abc#9.y.:"
+.string "zbz"y"
+L3: .string "y"
+.string "az0b"
+L5: .string ".x#a", "0.a....":#"
+prn #K
+L7: .string "11#" ";"".a"
+.string "#;:99yz;x"
+L9: .string ";.a"
+mov L30, r2
+L11: .string "."a;:y:byb"
+.string ":x"""ay1yb"
+mov L21, r2
+L14: .string "1y00" "bzycc:c"
+.string "by;#cy."
+L16: prn #K
+L17: mov L4, r2
+.string "c1ycx;z9bzz" "ab"
+.string "#00;:.:91xx"
+.string "ya9.x"
+L21: .string "b"
+L22: .string "0cy"" ";.bz9;z:;""
+L23: .string "acb"
+.string "c0.y0"zx;ycy"
+.string "c1cy111y#y"
+.entry L24
+L27: .string "y;xy"x1:#cz"
+L28: .string ""
+.string "a" "yac#:x::"
+mov L21, r2
+.string ";ayc:x#;z"
+L32: .string ""
+.string "y"
+L34: .string "9az"
+L35: mov L35, r2
+L36: mov L31, r2
+L37: .string "x".91aa"
+.string "bb#;#x:;;9"
+L39: .data 1 , K , -5
+ hlt
@@ -0,0 +1,42 @@
+.define K = 3
+L0: .string "y"
+L1: .string "#by""
+.string "y#"
+.string ".0b;0c.aaczy"
+L4: mov L26, r2
+.string "#0..9"
+.entry L16
+L7: .string "xzc:#" ".;0yx00"
+L8: .string "9"
+.entry L1
+L10: .data 1 , K , -5
+.data 1 , K , -5
+L12: .string ""
+.string "a"
+L14: .string "11xz" "::9"
+L15: .string ""
+L16: .string ";x"
+.entry L8
+.string "b:", ".1""0:"y0#00"
+L19: .string ";:".0" "1;x"0"
+L20: .string ";a"":"" "#;:ax;xxaa"
+L21: mov L18, r2
+prn #K
+prn #K
+L24: .string "0:1.0;a0x"0a"
+L25: .string "c0zxa0z.", ";"
+mov L6, r2
+L27: prn #K
+.string "b.a"
+L29: .data 1 , K , -5
+.entry L40
+.string "z0;#y0xaxbb", "a;09zz1"
+L32: mov L17, r2
+.entry L23
+L34: .string ".b#"
+L35: .data 1 , K , -5
+mov L29, r2
+L37: .string "90zx9z"c0", "1:c..0x0"
+.string "ab"x;"
+L39: .data 1 , K , -5
+ hlt
@@ -0,0 +1,42 @@
+.define K = 3
+L0: .string ";zy900;"
+L1: .string "a"
+L2: .string "a"z;0xx9", "xa9z..z"
+.string "#"." ""
+L4: .string "9"yb:"x."
+.string "0;z:"y##x#9y"
+L6: .string "#0y.9#x;b" "01y"
+L7: .string "ac9:##b", "";91##0z"
+L8: .string ";9:1.:#z"a"
+L9: .string "cc1xcbc.#;z"
+L10: .string "b0bzayacc."
+.string "191;;a.bc"c9"
+.entry L15
+L13: mov L1, r2
+L14: .string "yx;.9c9;"
+.data 1 , K , -5
+L16: .string "ab00zy;""
+L17: .string "b1:#1"a0" "#b##y#.1"
+L18: mov L21, r2
+L19: .string ":"
+L20: .string ":..a9x":"
+L21: mov L24, r2
+.string ".;;19.#z"
+.string ".:b"
+.string "z9"z"b"
+.string "zaz;"a"
+L26: .data 1 , K , -5
+L27: .string """y1#1z":a"
+L28: .string "91;""yy"
+L29: .string "10x9;"
+L30: .string ":"0";;.;."
+L31: .string ".0"ac;c;b1"
+L32: .string "0a;c.b90a"
+mov L7, r2
+L34: .string "009b";c:111;" "99z0.x"
+L35: prn #K
+L36: mov L6, r2
+.string "z"
+.string "x9:x9y."#"
+L39: .string "ay.c1.x0" ""
+ hlt
@@ -0,0 +1,42 @@
+.define K = 3
+L0: .string "9y#9x.#0cc#" "1"
+L1: .string "c1xab0bc"
+L2: .string "9yz.zb"xyy:"
+.entry L40
+.string "x0"
+prn #K
+L6: .string "y;1.b#bxc"
+.string "0b#a#z00za#;"
+L8: .data 1 , K , -5
+L9: .data 1 , K , -5
+L10: .string "x":;cxccy":"
+L11: mov L33, r2
+.string "0#:."a19y" "a"
+.string "b:#";"
+.entry L28
+L15: .string "x#", ";.x"xza090"
+.data 1 , K , -5
+L17: .string "b.x1z"", "abx"c"x;bc"
+.string ":0#ab;;b0"
+L19: .string "c"bc"bb#0"
+L20: .string "10:y#" "ca:"
+L21: .string "ac0"
+.string ""
+mov L10, r2
+.string "c9#9x:#a"
+.string "baxab", "x0"
+.string ""b"
+L27: .data 1 , K , -5
+mov L26, r2
+.string "b;"9ycx.z0"
+.string "#z""x" "#1"
+mov L38, r2
+.string "y0"bx#y;10"
+.entry L16
+.string "y"
+L35: .string "z#0cy".z"::"
+mov L4, r2
+mov L0, r2
+.string "0"9cx"
+L39: .string "#czz1b0a;x"
+ hlt
@@ -0,0 +1,42 @@
+.define K = 3
+.data 1 , K , -5
+mov L33, r2
+L2: .string ":ac"
+L3: .string "b;xa.x0y"
+.entry L4
+.string "ca"
+.string ""c"
+L7: .string ":xc.x0yaz0", "yb"
+L8: prn #K
+.string "y" "1.zc"
+L10: mov L1, r2
+L11: .string "a9#0z0", ""
+mov L12, r2
+L13: .string "z9z9y#1"
+mov L18, r2
+.string "x"
+.data 1 , K , -5
+.string "by:zyc#b"
+L18: mov L30, r2
+L19: .string "90ax.;z"y"
+L20: .string "a#1z"xc.;c"
+L21: mov L27, r2
+L22: .string "yc1;"c"
+L23: .string "z1yy10cb0"9"
+L24: .data 1 , K , -5
+L25: .string "9#9""
+.string ".;:a#"
+.string "y#..yz:" ""
+L28: mov L17, r2
+.string ":#zzy:z."0"
+prn #K
+.data 1 , K , -5
+L32: .string "cx"z"1y.", ".0c;#;9:0y"
+mov L1, r2
+L34: .string ":cx#:c:.a"
+L35: .string "bz", "x9a01z0"
+L36: .string "zaz0y"0"b.""
+L37: .string "by99", "yz"c00";:"
+L38: .string ";1xc;b"
+.entry L6
+ hlt
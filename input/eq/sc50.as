@@ -0,0 +1,42 @@
+.define K = 3
+L0: .string "x.1#zb9zx:"
+L1: .string "z", "b"z"
+.entry L5
+.string ";"z#.:"0axz", ".bx1y."
+.string ";b0:;."b"
+.data 1 , K , -5
+.string "":c1;"9y"
+L7: .string ""
+.string "#":"9#x", "b"cy0#xza"
+.string "x:y901;0#""
+L10: .string ""
+L11: .string ";ayz"z9::9"
+L12: .string "b:b"
+.string ""
+mov L1, r2
+L15: .string ".y.;ac100"
+.string ";y":z0za"
+prn #K
+.string ""0.#y"
+L19: .string "a" "1"1yy#:;x#"
+.string "xyx"
+L21: .string "." "#a.y9b"
+.data 1 , K , -5
+.string ""
+L24: .string "z9xaxx#1y.:1"
+.string "x", "ax"bx"
+L26: mov L16, r2
+mov L10, r2
+L28: .string ""
+.string ";"aa01"
+L30: .string "1x1:."9"
+.string ":c9"
+.string ":;0.9;09"
+L33: .string "0yz:zz"
+L34: .string ""b"
+L35: mov L34, r2
+.string "019a0x"
+.string ":zazxcx" ""
+L38: prn #K
+L39: .string ":0z9:;z1y1:", ";0"
+ hlt
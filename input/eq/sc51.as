@@ -0,0 +1,42 @@
+.define K = 3
+L0: .string "x""
+L1: prn #K
+.entry L29
+L3: mov L40, r2
+.string "y0.a"b"
+L5: .string "z;"
+.string ":x##a1"c1aab"
+prn #K
+L8: .string "a:00xzb" "#c;z11b9"
+.data 1 , K , -5
+prn #K
+.string ""9b9#"y9"1", ""
+.string "09"yx.1;1" "az1y9:;1"
+.string "y1#c" "#cby1."
+.data 1 , K , -5
+L15: mov L32, r2
+mov L37, r2
+mov L28, r2
+L18: .string ".yc#:#00":0z"
+.string "z9109.;z1;" "0""
+L20: prn #K
+L21: .string ""
+L22: .string ""
+L23: .string "9#9cz"yb.19"
+.string "c.##b;"
+L25: mov L33, r2
+.data 1 , K , -5
+.string "1:cc"9900"
+.string "0b9aby9", ""c:"
+L29: prn #K
+L30: mov L14, r2
+mov L31, r2
+.string "9xc#0x9"
+.string """
+L34: prn #K
+L35: .string "ybc9"
+L36: mov L0, r2
+L37: .string "zbb#":#9.0ya"
+L38: prn #K
+L39: .string "" "za.9a0:"
+ hlt
@@ -0,0 +1,42 @@
+.define K = 3
+L0: .string "91"z0acc#0"", "1:aa9"
+L1: .string "1x"
+L2: .string """
+L3: .data 1 , K , -5
+L4: .string "9cc09"
+L5: mov L20, r2
+.string ";:.0;axax:.9"
+.string "cbc:;xyx9;0b"
+mov L9, r2
+.string "";1" "#x"
+prn #K
+L11: .string "xb::"ca.;a", "0"
+L12: .string ".;09":acy1a" "#c"
+.data 1 , K , -5
+L14: .string "x"cb"
+L15: .string ":", "x9z"
+.entry L10
+L17: .data 1 , K , -5
+.string ""
+.string "z#0:"
+L20: .string ".1y:b9a.b"
+.string ".y;ay#"y"9c"
+L22: .string ":"
+.string "ab"
+mov L16, r2
+mov L18, r2
+.string "1" ""
+L27: mov L21, r2
+.string "xacb:.10.cc0"
+L29: .string "1:1#.b"
+prn #K
+.string "#x:0b0", ";y.9"
+.string "0#":0"
+L33: .data 1 , K , -5
+L34: mov L0, r2
+L35: mov L31, r2
+.entry L12
+.string "199y1bb#z0"
+L38: .string "#1" ".b"
+L39: .string "b", "x9az"x"
+ hlt
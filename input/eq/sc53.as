@@ -0,0 +1,42 @@
+.define K = 3
+.data 1 , K , -5
+.string "9z.1.a"acz."
+.entry L3
+L3: .string "ccz"
+L4: .data 1 , K , -5
+.data 1 , K , -5
+L6: .string "#"
+L7: .string ":#c"
+.string "z;""
+L9: .string "b"a#109zyx"
+.string "x9"
+L11: .string "91z"
+L12: .string ":0b00byc:0x"
+.string "x#"" "0xc"x9z"
+.string ".0b"a"
+.string "#0zyx.#y" "#":z;cc"
+L16: .string "", "0#"a#:"
+L17: .string "::0:"x;#za" "9#a9;z"
+.string ";;a:"aa909#"
+.data 1 , K , -5
+L20: .string "9b0#0"
+.string ""
+L22: .string "9#a0yyxc#9", "1b;"
+.data 1 , K , -5
+.string "ycx0:y" ".x10c;x;:1c"
+.string "xcc:yzb"
+.string "0b:b"#" "ab9"zaz0y0;"
+L27: .string "1""#0;ycz#"
+L28: .string ""
+L29: .data 1 , K , -5
+L30: .string "#:"#aacy", "01"
+.string ":10:bz;a", "xx1.:#zcbz"
+.string "c1z0az1", "xcab""
+L33: .string "x9"
+prn #K
+L35: .string ".zbxz"
+prn #K
+L37: .string "z;"
+L38: .string "c#"z#1y;z"
+.string ""
+ hlt
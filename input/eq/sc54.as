@@ -0,0 +1,42 @@
+.define K = 3
+L0: .string "y110x1z;", ".xa"
+L1: mov L5, r2
+L2: .string "y9cb:y" ";a0:azy"
+L3: mov L8, r2
+.string ""
+L5: .string "xx:;a:1"
+prn #K
+L7: .string "9a""1"
+L8: prn #K
+.string "a"
+L10: .string "#1"
+L11: .string "###ab;z0000c" "10".;"
+L12: .string "#"y;:c0"
+L13: mov L32, r2
+.string ".yb1" "x"
+.string "9yc"
+L16: .data 1 , K , -5
+L17: .string "y;b9"."
+.string ""11z"
+L19: prn #K
+.entry L10
+L21: .string ";a0:;xy.za9:"
+L22: .string "0abc9##x"
+L23: .data 1 , K , -5
+L24: .string "b1:."
+L25: prn #K
+L26: .string ":#x1a;yz1"
+L27: .data 1 , K , -5
+L28: mov L11, r2
+L29: .string "c";.9", ";yb"
+L30: prn #K
+L31: .string "z90"
+L32: .string "y"
+.data 1 , K , -5
+L34: .string "#yz9c", "z;cb"
+L35: .string "1"
+L36: .string "a"
+L37: .string ""
+L38: .string "z:b"y;#x" "b#1b"
+.string "x"1", ""0."c01"
+ hlt
@@ -0,0 +1,42 @@
+.define K = 3
+.string ".y"
+L1: mov L22, r2
+.string "190090z.09", ""
+L3: .string "a;1"xa0xb9:"
+.string "cyz"ab"
+L5: .string "xx1c"cxy9"
+.string ".0"1;;.b0":"
+.string "yyzycb;0#11"
+L8: .string "y"
+L9: .string ":y" "#:."
+L10: prn #K
+.string ""
+L12: mov L20, r2
+L13: .string "0y:1x:"x"
+.string "1;:1a"
+L15: .string "yc1x::0b"
+.string "9a.:x1#;1;#x"
+L17: .string "0"
+.string "ba"#c" ""
+L19: .string "".y.".za"::9" ".x.a91ba"
+L20: .data 1 , K , -5
+.string "xycc";#;.y9"
+.string ".b019azb", "b:;a:".yb"
+.string "1"
+L24: mov L5, r2
+L25: .string "9c#10az#0.bb", ";";;b1y"."
+mov L39, r2
+L27: .string "cz"
+L28: .string "y."
+L29: .string "b:a;#;"z:1" "y.1b:z"#x"
+L30: .data 1 , K , -5
+L31: .string "c:0b.###"
+prn #K
+L33: .string ""
+L34: .string "1azxxx9xz19"
+L35: .string ""
+L36: .string "xa.yyya0y", ".;::#cy"z"
+L37: .string "1"
+.string "#z"
+.string "9##""y"
+ hlt
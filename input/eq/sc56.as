@@ -0,0 +1,42 @@
+.define K = 3
+L0: .string ":9y#90.", ";bz:y"
+.string "a;9"
+.data 1 , K , -5
+L3: .string ";"
+L4: .string "c:b#x9"
+L5: .string ".:za::a"
+L6: .string ""
+L7: .string "z1#zx9191:"
+.entry L29
+L9: .string ";y"
+L10: .string ""9c#", ""
+.entry L38
+L12: mov L3, r2
+.string "y;xa:.:0" ":;"
+L14: .string ":aaa:.1yb9c" ".c#;";#.b0.""
+L15: .string "c9c.9"
+.string ".bx#xy"
+.string "ba:", ""y;#c".;"
+L18: .data 1 , K , -5
+L19: .string ""
+.string "z"
+L21: .string "c0";z1y" ""a.0b0ayy"
+L22: .string "x0"
+.string "."#ya1;"xza#", "c0.x;b#"
+.string "c9";1"
+.string "c."", "1.bx1bz"
+.data 1 , K , -5
+.string "zx"y1;.;b"
+L28: .string ":bz9y##.zy"
+L29: .string "xyx:y:#0"
+L30: .string ";9a""
+L31: .string "cb", "xabbyx"
+L32: .string "c0.0#" "9b#"
+.string ":;9"c9yb.c#"
+.data 1 , K , -5
+L35: .string "#;"
+.data 1 , K , -5
+L37: .string ";;"
+L38: .string ";:9ay.:y#0"
+L39: .string ":"cayb."
+ hlt
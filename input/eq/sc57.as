@@ -0,0 +1,42 @@
+.define K = 3
+L0: .string ""
+L1: .string ":"0a"."
+L2: .string "b:.;:1", ";c;cc09c";"
+L3: .string "z;99xx" "0:x0"
+L4: .data 1 , K , -5
+L5: .string "19#a.", "ayayzzz:;"
+.string "a:"
+L7: .string ".0xc"
+L8: .string "ayzx:c";x:"""
+L9: .string "#." "cb1c990""
+.string "x#0c.b"
+.string ""
+mov L7, r2
+.string "y:;xz.z1009"
+L14: .string "0x0:;a.190b"
+L15: .data 1 , K , -5
+.string ""
+.data 1 , K , -5
+.data 1 , K , -5
+mov L0, r2
+.string "##"c."
+L21: .string ""
+L22: .string ".:9"1"cya"
+.string "ac1;c9#"b#"
+.string "1y."1z"cbz"
+L25: .string "caczycxzz;"
+L26: .string ""z" ".#."
+.data 1 , K , -5
+prn #K
+L29: .string "00yz:a:00y" "z:0."
+mov L6, r2
+.string ""yz.."
+.string "b:19:0.c"
+L33: .string ":.x", "0ab;yc9#"
+L34: .string ""
+L35: .string "z", "x.1"
+L36: .string ":...#:0a"
+.string "c1"
+L38: .string "zz"
+.string "#y:0#;y:"zy"
+ hlt
@@ -0,0 +1,42 @@
+.define K = 3
+L0: .string "xax10zy#y1" "y";ba1"
+L1: mov L24, r2
+L2: .data 1 , K , -5
+mov L19, r2
+.string "c;;."
+L5: .data 1 , K , -5
+L6: .string ".x"
+prn #K
+L8: .string ";y;:z;0cyy"
+.string ";;bcb1.", "11y.1c#.bca"
+L10: .string ";bb"
+L11: .string ""y:1".;zz9a"
+L12: .string "ccx:x:"z0b.#"
+.string ";x#aac;#az#"
+.entry L23
+.string ";.#01#", "bzb;#:"
+L16: mov L7, r2
+mov L24, r2
+L18: mov L13, r2
+L19: .string "y#9"
+.string "9acyb9"
+L21: .string "a#.;x1y"b"
+L22: .string "c"
+L23: .string ":x1"y9yzb"0"
+.string "", "cb.:""
+.string "1xx" "ca199"19c1c""
+.entry L20
+.string """ "1:;"
+L28: .string "0..0b"y", "#b#zbb1""
+.string ":y"
+L30: .string "cx#x19b1y"
+L31: .string "9bc#1c90y0.z"
+mov L0, r2
+.entry L25
+.entry L28
+L35: .string "a#9cc", "c1:#"
+L36: mov L14, r2
+L37: .string "0""
+L38: .string "zb"
+L39: .string ".x"
+ hlt
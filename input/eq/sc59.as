@@ -0,0 +1,42 @@
+.define K = 3
+.string "ac"y.a:"
+L1: .string "#9y#c.;", "c9bbz:a"zy"
+L2: .string "byyb:;".:"
+.entry L25
+L4: .string "99xz"
+L5: .string ";.c#", ";0;19z:."."
+L6: .string "xx:1x9;0"
+L7: .data 1 , K , -5
+L8: .string "", "z;0:ba;1#""
+L9: .string "1cy.z9" ".b#yby1..b"
+.string "1;b"
+L11: prn #K
+L12: mov L14, r2
+L13: .string ";az"
+L14: .string ""
+mov L14, r2
+L16: .string "cy;#"
+L17: .string ":"
+.data 1 , K , -5
+L19: .string "#xc.1:..b;c" "1.a11cxax:"
+L20: .string "9#91yc", "c9;9:x#a.y""
+L21: .string ";b#:x"
+.string ""
+L23: .string "#:1#ca" ":y#xb;y"
+.string ".", "#:z"
+.string "c1"azc#x" "1"
+L26: .string "999", "1"
+L27: .string "#..0z9a#""1"
+L28: .string "1x;y.baaac"
+.entry L35
+L30: .data 1 , K , -5
+L31: .string ":c9azczc:"
+.data 1 , K , -5
+L33: .string "yy"
+.entry L38
+.string ";" "0y0aac9y""
+L36: .string ":1azx9y";x0y"
+mov L31, r2
+.string ""99bx9#a" "b:zyy":.x9"
+L39: mov L3, r2
+ hlt
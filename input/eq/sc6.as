@@ -0,0 +1,42 @@
+.define K = 3
+mov L31, r2
+L1: mov L9, r2
+L2: .data 1 , K , -5
+L3: mov L1, r2
+.string ""099:bx;9.#"
+.data 1 , K , -5
+L6: .string "z"
+L7: prn #K
+L8: .string "#yba;x":z1"
+L9: .string ".#9a:zx;0y", "b"
+L10: .data 1 , K , -5
+L11: .data 1 , K , -5
+L12: mov L14, r2
+L13: .string "9ax#ca:z9:;"
+L14: .string "c:1a"
+.string "1" ";"
+.entry L24
+L17: mov L30, r2
+.string "x"
+L19: .string "caa9by;#zxy9"
+L20: .string "0;1y;1", "c.01y:#"
+L21: .string "0.;yz:01."
+L22: .string "", ""
+L23: .data 1 , K , -5
+L24: .data 1 , K , -5
+L25: .string "axcy;a0##", "1b1xbzzc"
+L26: .string ""
+L27: .string "11.b:a.9c;"
+.string "":11"
+L29: mov L12, r2
+L30: .string "119y1.;b"#yz", ""
+.entry L30
+.string ""
+.string "9.a"
+L34: .string "##x.0zbc.:b"
+.string "bcbz9ac9.c"
+L36: mov L24, r2
+mov L36, r2
+L38: mov L10, r2
+mov L35, r2
+ hlt
@@ -0,0 +1,42 @@
+.define K = 3
+L0: .string "x#11"
+L1: .string ":", "0a"
+L2: mov L10, r2
+.string ":c9;9#;a;;by"
+L4: .string "x9ybxc.y"x."", ":b9z#1z0b"
+L5: .data 1 , K , -5
+L6: .string ""0" "90.#09.""
+L7: .string "b9.;0a1"
+L8: .string "x09b90a91a0b" ":#".:xbcz"
+L9: prn #K
+L10: mov L0, r2
+.string "az."
+L12: mov L15, r2
+L13: .string "9::c9zy#"
+L14: .string "9z""
+L15: .string "xb" ".b:"x9""
+.string "09099yayc;"
+L17: mov L25, r2
+.string ""
+.entry L19
+L20: .string ""
+L21: .string "c1a.c"";zba" ":"cxc"1y.:"
+.entry L32
+mov L34, r2
+.data 1 , K , -5
+prn #K
+.string ""b;a.c0cx"
+.string "c9y9bb:1" "xyx#c01bab"
+.entry L19
+L29: .data 1 , K , -5
+L30: .string "cyc"
+L31: .data 1 , K , -5
+L32: .string "##z#:.:z" "9ac"00a:1."
+.data 1 , K , -5
+.string ":1;9x0.x"9x"
+.string "zabx#zz:9;"
+.string "."
+L37: .string "xa""
+.string "cxy"
+.string ""
+ hlt
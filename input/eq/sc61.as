@@ -0,0 +1,42 @@
+.define K = 3
+L0: .string "zyz#.a1zzb01"
+.string ".b:cza0#"
+L2: mov L18, r2
+mov L28, r2
+.string ""::c#.;y00xc", "z1a90b"y"
+L5: .string ".b0xb"
+L6: .data 1 , K , -5
+L7: .string "xcb01b"
+L8: .string "a"z.x."
+L9: .string ""911b"b.x#cb", "0x:xy"#;10z"
+L10: .string "c"
+.string ";y"
+L12: .string "bcc1"" "0x01"
+L13: .data 1 , K , -5
+.string "b#a#c"9:z#1x", ":;;aa1z1"z"
+.entry L30
+.data 1 , K , -5
+L17: .string ";:c:zyc." "y;"
+L18: .string "c1.y.#1b;:;z"
+L19: .string "xz""
+.string ""b11c:#9ax"b"
+L21: .string "c1yc" ";#;zx;1#z"
+L22: .string "y""
+.string "9:xzca;az"
+L24: .string ";0.#zx;x9"
+L25: .string "1"
+L26: .string "y"
+L27: mov L40, r2
+.string "za#x9x:11b""
+L29: .string "" ""c#"
+L30: .data 1 , K , -5
+L31: prn #K
+L32: .string ";a.x"
+L33: .string "x;9:cabbax"
+L34: .string "cz;1.y9:y9"
+.data 1 , K , -5
+.string ".xxybcb"
+L37: .data 1 , K , -5
+L38: .string "b0.zb1y"
+.entry L23
+ hlt
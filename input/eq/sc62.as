@@ -0,0 +1,42 @@
+.define K = 3
+L0: .string "1y:", "ccay:c"b"
+L1: .string ";:c.x"
+L2: .string ""
+L3: .string "z1ay"", "x.;yxc"
+L4: .string "acx"
+L5: .data 1 , K , -5
+L6: .string "z;""
+L7: .string "0z01az9"9bb"
+L8: mov L14, r2
+L9: .data 1 , K , -5
+.data 1 , K , -5
+L11: .string "yb0z", "#;z"a0b"
+.string "0.x;.c", "a:0z#01zcaa"
+.string ";xy#ac#.:;yb"
+mov L16, r2
+L15: mov L19, r2
+L16: .string "09y1cz019a" "za0c0..z;c0."
+L17: prn #K
+L18: .string ";b"#9"
+mov L14, r2
+.data 1 , K , -5
+L21: .string "a0yx:.xa#0"
+L22: .string ""#ac#", "y":.;"
+L23: .string "#b."
+.string "acz9a;" ".#y0bzc"
+L25: .string "xx1" ""
+L26: .string "9x", ";;xacxa;cy"9"
+.entry L35
+L28: .string ":.a:1;9yyzc"
+L29: .string "9ab", "z;0xa0#zz"
+.string "a.a"
+L31: prn #K
+.string "yb9bxc0"
+L33: .string "x#x."
+L34: .string "b"
+L35: .string "#ba0b#"
+L36: .string "90bx1b9y"
+.string "01c:."#:" """1zbaa"b9zb"
+L38: .string ":z" ""
+L39: .string "c:y1".0b"
+ hlt
@@ -0,0 +1,42 @@
+.define K = 3
+.string "9:axy."
+.data 1 , K , -5
+.data 1 , K , -5
+L3: .string "1x.ab0", ""
+L4: .string "yx9xb"a#1"
+.string "0z9y.z.1"
+L6: .string "xx"
+.string "a.#y""bcyx:""
+.string "xc;y01y.zc"
+L9: prn #K
+L10: .string "a"cz9y"0"
+.string ".9.aa"
+.string ""#" "9"
+L13: .data 1 , K , -5
+L14: .string "z0"
+L15: .string ";#c0c#9.x1"
+L16: .string "a0z."
+L17: mov L23, r2
+L18: .string "", "9ba.;.9;b0"
+L19: .string ""y"
+L20: .string "" "#""
+L21: .string "ay", "#c1az9"
+.string "1"zcx9xzy#"""
+.string ""
+.data 1 , K , -5
+L25: .data 1 , K , -5
+.entry L34
+L27: .string "a:0y", "za#az0y0"
+mov L4, r2
+.string "999c011#"
+L30: .string "y99acx:x0a."
+L31: .string "az9"c9:##x0"
+.string ".9".9c0a"
+L33: .string "y#c1109" "zbz#;9"
+.string "z."
+L35: .string ":" "a;"
+.string "a.abz#.1c:a" "b#x1:xac1;"
+.string ";ccb"0" ""
+L38: .string "x1;10"
+L39: .string "x1"a:a"z"
+ hlt
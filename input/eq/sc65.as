@@ -0,0 +1,42 @@
+.define K = 3
+L0: .string "119"
+.string "xb91yx", ".aybc9."c"
+L2: prn #K
+L3: .string ";x":x"
+.string "a#"zyz#yac.0"
+L5: .string ""#", "900c9#0..zxx"
+L6: .string ".":#ay:by"
+L7: mov L8, r2
+L8: .string "0;.0:z9"b#:"
+L9: .string ""1:y1z""
+L10: .data 1 , K , -5
+L11: .string "9abc9#z9.ac"
+L12: .data 1 , K , -5
+.string "xy"0"
+.string ".9y:b;;.91"
+L15: .string "#"0.yycx."
+L16: .string ".0..:9"
+L17: .string "#9;c0a;y9"
+.string "yac"" "1c0"#1z.91.:"
+.string "c:b"
+L20: .string "##"
+.string "ayx1;x.#9:bb"
+.string ";#ya"
+.string ";"
+.string ""
+.string "yc;.ac", "9c9;9xb;.0.#"
+L26: .string "b"
+mov L36, r2
+.string "y.ay09"
+mov L7, r2
+L30: .string ".:b#:0x"
+L31: .data 1 , K , -5
+L32: .string "y.#1bza", "9.c.cbxx0x"
+L33: .string "ya:0z1y:.", "1c1y."
+.string "00az9za"
+L35: .string "c:c:"
+L36: mov L1, r2
+L37: .string "yc"
+L38: .data 1 , K , -5
+L39: .string "ab#" "c"
+ hlt
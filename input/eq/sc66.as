@@ -0,0 +1,42 @@
+.define K = 3
+L0: .string "#1y"
+.entry L31
+L2: .string ".b.z.c0..1:9"
+L3: .string "za"
+mov L39, r2
+L5: .string "yxybx#z"
+.entry L25
+L7: .string "a;bz"
+.string ".b.";0z1"
+mov L13, r2
+.string "y"ay1z;.1za;"
+L11: .string "z"
+mov L1, r2
+L13: .string "9:"
+.string "9", "by.0;";x"
+L15: mov L5, r2
+L16: .string "x;b"y"
+L17: .string "#c0c:"
+L18: .string "#"
+L19: .string "9"
+.string "9#900#x.#bz" "yya.b0.19.z"
+L21: .string "x:#", "yz#;x"90"
+L22: mov L19, r2
+mov L14, r2
+L24: .string "z:.c#ycz"
+.entry L40
+L26: .string "0:91;"..;0."
+L27: .string ";1;#"a:."
+L28: .string ":x00"
+.string "1yyba"
+.string "#;19x"
+mov L0, r2
+.string ":y9cz" "cxy"#z"
+.string ".c:;"9" ".:xaz.x";xca"
+L34: .string "xz1"
+L35: .string "";"0by9xy:"
+L36: .string "c9x"
+L37: mov L34, r2
+L38: .string ""c:aaz1"
+L39: .string ""0b"za"
+ hlt
@@ -0,0 +1,42 @@
+.define K = 3
+.string "0y;01;y"
+L1: .string "ya"
+.string "yx0.;a0"
+.string "cz", "1#.#x:::0"a"
+L4: .string ""
+L5: .string ";a"
+.data 1 , K , -5
+L7: .string ""
+L8: mov L12, r2
+L9: .string ":0y9b.0by1" "a"c"
+.entry L6
+L11: .string "9.0:9#.##"
+.data 1 , K , -5
+.string "bc;y#y:"
+L14: .string "a.:y9##;"
+.string "cc1"
+prn #K
+.string "z:;"#":b;z"
+L18: .data 1 , K , -5
+L19: .string "x", "9"
+.string "a;"b"
+.data 1 , K , -5
+.data 1 , K , -5
+L23: .string "0ac"
+L24: .string "c.9bzz9b"
+.string "a0."
+L26: .string "1", "1x9zzz"
+L27: .data 1 , K , -5
+L28: .string "cbz;#aa.cx"
+L29: .string "9""
+L30: .string "xz;z;;"9y.""
+L31: .string ";a0x##a", "b;z0yaaa9"
+.string ";:yzz.z9#9y" "9.0bb9xzxb9"
+L33: .string ""
+.string "cay"9yyb#" "ybay"
+mov L28, r2
+L36: .string "9y#9;;c9x01"
+L37: .string "caxa"
+L38: mov L40, r2
+L39: mov L8, r2
+ hlt
@@ -0,0 +1,42 @@
+.define K = 3
+mov L32, r2
+L1: .string "1y.":z"
+L2: .string "###ba9.1b"" "#"
+L3: .string ""01909c."
+L4: .string "c;;zc#"ba1" ".ybx0000b"
+L5: .string "aa00"c#xb".z"
+prn #K
+L7: .string "x1011"99#"
+.entry L0
+L9: .string "1"
+L10: .string "x"z1"y:b#bb;" "c"zayc;109#z"
+L11: .string "zb.cx."
+.string ""01.";z0:"
+.string "axby;zy"
+L14: .string "1#;.9cx#y."
+mov L6, r2
+L16: .string "z"
+L17: prn #K
+.string "#0bb", ""
+.string "bc"
+.string "1zc0"
+.entry L1
+L22: .string """, "yx#"
+L23: .string ":#a"
+L24: .string "a1.ybz.b0"a9"
+L25: .string "a1x;#.;yzb" "bz;""cz"
+.string "0#"
+.string ".;."
+mov L13, r2
+prn #K
+L30: .string "c"10b0:#"
+.string ":"
+.string "1x9#x1xa:"
+.entry L5
+.string "9"
+.string "y"
+L36: .string ":yb.0a.#"
+.string "x9c;1xcb.b", "999"11:"
+.string "b"#ab"1", ";##c0;z"
+.entry L31
+ hlt
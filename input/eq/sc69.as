@@ -0,0 +1,42 @@
+.define K = 3
+L0: .data 1 , K , -5
+.string ""##"9"
+L2: prn #K
+L3: prn #K
+L4: .string "0b0ycx" "x.:#"
+L5: .string "0" "by"#.;zabbx"
+L6: .string "1:"
+mov L34, r2
+L8: .string "." ":"yc:1"
+L9: .data 1 , K , -5
+.string "0x:y01#0y:" "z:#9;0ab"
+L11: mov L23, r2
+L12: .string "00.x;y1cayb9"
+.string "x;.9#zbb0"
+.string "b#:b"..#", "91"
+mov L21, r2
+L16: .string ";#1x"
+L17: .string "a.b:"
+L18: .string "xz;;a1b9y;za"
+L19: .string "0.y1"
+L20: .string "ca.#cz::""
+L21: .string "zyb0ac", "zzc"
+L22: .string "0y"
+L23: .string "1z1:."
+.entry L1
+.string "1y"
+L26: .string "bb1z9#"
+L27: .string "z9"
+.string "y11"
+L29: .string "xbyc990" "y#b:zy#1#a"
+L30: .data 1 , K , -5
+L31: .string "y:#.", "b#x0yaa#0"
+L32: .string "bxbc"
+L33: .string "0b.#c"
+.string ""
+L35: .data 1 , K , -5
+L36: .data 1 , K , -5
+L37: .string "c0by.:by"
+L38: .string ":xy:0xcayb" "09yx"
+.string ".0".c0zz##:", ""
+ hlt
@@ -0,0 +1,42 @@
+.define K = 3
+L0: .string "ab"9bz;a9x"
+L1: .string "9"
+L2: prn #K
+.string ""
+.string ""
+L5: .string "b;y9":cb"
+L6: .data 1 , K , -5
+L7: .string "" ":90#z1;"
+L8: .string ".#"
+L9: .string ".1y;b" "c#zc10"
+.data 1 , K , -5
+.string "z.z;1" "b"by1.:"
+L12: mov L36, r2
+.string ".0:z", "zc;b1ax"
+L14: .string ""1bc10"
+.entry L35
+L16: .string ":0xcb"
+L17: .string "";cyyac"
+L18: .string ".""
+.data 1 , K , -5
+.string "":#90000b1:0"
+L21: .string "bz"
+L22: .string "bz;ab"x;"
+.data 1 , K , -5
+L24: .data 1 , K , -5
+L25: .string "11ybcb."
+.string "9a"
+L27: .string "9a#9y:"b."y", "z#"
+L28: .string "x;###"x#x"" "xx91z.aa#y1y"
+L29: .data 1 , K , -5
+prn #K
+.string "x"
+L32: .string ";;"a1:z"
+.string "#.#x1c"
+L34: .data 1 , K , -5
+.string "0.b.ccc", "1#:c;";1:"
+L36: .string ""
+.string ".c0"x""x", "y9x"
+L38: .string "a."
+L39: .string "0"9c9c99"
+ hlt
@@ -0,0 +1,42 @@
+.define K = 3
+L0: .string "1czbc":", ".:0"
+.string "z#y0#1"b"
+L2: .string "ay"
+L3: mov L4, r2
+.string ";#b"
+.string ".#.yc;zbx"c;" "b.y0bc10#y"
+.entry L6
+mov L22, r2
+prn #K
+L9: .string "#aa:xy"" ":a;"0.cb1y."
+L10: .string "9:"
+.data 1 , K , -5
+L12: .string "ab9aa0xz0"
+.string ";":;0zy.;a"
+.string ";xc", ".1a9c01;"
+L15: .string "#;"
+.entry L29
+.string "c1y:xy1"99", ""
+.entry L8
+L19: .string ":z#0#bb"#y;", ""1:a:ca;ab""
+L20: .string "9.10yya"
+L21: .string "#a.ya"
+.string "xc" "x"
+L23: .string ""#c9#yxc", "#"#:;0101z"
+L24: .string "a;;900az", "y0x9"
+.string "1z9.:0;""
+L26: .string "x9y"b#"
+L27: .string "y#.y;x;01y0c"
+L28: .string ""
+.data 1 , K , -5
+L30: .string ":b."
+.string "1"
+.string ".".xabx"
+L33: .string "x.a:", "x19:xcx9."
+.string ";#x#:", ":#aaa:"
+L35: mov L14, r2
+.entry L10
+.string ".a"
+.string "#y""
+L39: .string "x#z1:9z;"
+ hlt
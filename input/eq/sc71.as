@@ -0,0 +1,42 @@
+.define K = 3
+.string ""
+.string "ybx"
+L2: .string "9z"1#cz:caz" ":;xcz""
+.string "ax;ccx#."9", "ayzx0abbx"
+L4: .string ";;"zybxy;xc;"
+L5: .string "#.;#;y.."a" "x1z"
+L6: .string "xy"c" "91xc;bx"
+.string ""yy09."
+.string "a"0x1y:"
+.string "aa00bzxz;"", ":;9"z;1"
+L10: .string ":yy".99#y.""
+L11: prn #K
+.string ";b;1;"
+L13: mov L10, r2
+.string ";#00c1:11c"
+L15: .string ".1xc:cx1"
+L16: .string "cc.#c:#:a19"
+.string ":"
+.data 1 , K , -5
+L19: mov L20, r2
+prn #K
+L21: mov L17, r2
+.string "#:":91y"b"
+.string ":::.;y#;a;y"
+L24: .string "yxz.;"
+.string "1"x.:09z"
+L26: .string ";"9:y1999"
+L27: mov L16, r2
+.string "y0"
+.string "bxb0#:bc"
+L30: .string ";x;bx"1zx#" ""
+.string "00x9;yxx1.;1"
+L32: .string "x;cx:c":#.yc"
+.string ":9;1b"
+.entry L17
+.entry L23
+.entry L10
+.string "a.ya"
+.entry L5
+L39: .string "9a:"
+ hlt
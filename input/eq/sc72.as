@@ -0,0 +1,42 @@
+.define K = 3
+L0: .string "z."
+.string ";c..zx0c:a"
+.string "b#yb9z."
+L3: .string "zxz"1"
+L4: .string "y0"
+L5: .string "aaz" "b"cya1"
+.entry L35
+.entry L14
+.string ".by1z1ab"
+L9: .string "#"9"
+.entry L6
+.string ""
+L12: .string "x;":""
+.string "z;:"
+L14: mov L31, r2
+.entry L6
+.string "..y1;" "a"":"
+.entry L24
+prn #K
+L19: .string "9;0"
+.string "z.a.z:;#b"
+L21: .string ";.9:."
+L22: .string "a9x:bxy"0b.b"
+.string ""
+.string "a.:9z""b9:"
+.data 1 , K , -5
+.string "0"
+L27: .string "#9#:y;0yz" ".c"
+L28: .string "yc.:y9."
+.data 1 , K , -5
+prn #K
+.string ""
+L32: .string "zza.01"
+L33: .string "9ayz", "9.ax;"
+.data 1 , K , -5
+.string "9.c.#9.0", "1c.c9"
+L36: mov L35, r2
+.string ":c09"
+mov L34, r2
+mov L36, r2
+ hlt
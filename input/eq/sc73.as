@@ -0,0 +1,42 @@
+.define K = 3
+L0: .string "c1y;b1099"
+L1: .string ""a0z90190c"a"
+L2: .string ""b1.#zycxax" "yy.a#"x9c;0b"
+.data 1 , K , -5
+L4: .string "1##1".9"
+.entry L26
+L6: .string ""
+L7: .string "z#", "xb"
+L8: .string "0y.0b1" "bb:y919b:xza"
+L9: .string "#c0a:.;";0;"
+L10: .data 1 , K , -5
+.entry L33
+.string "c#0"#b"
+L13: .string "xy#1"
+L14: .string "c1yz9:"
+.string ";"
+.string "9b:z"" ".110#a"
+mov L3, r2
+.string "9#:zba9"
+L19: mov L23, r2
+L20: .string ".bx.:#:1"
+L21: .data 1 , K , -5
+L22: mov L0, r2
+mov L34, r2
+.string "1b1:z1""x""
+L25: .data 1 , K , -5
+L26: .string "xy#" "0x:"0."""
+L27: .string "x.9:"
+L28: .string "zx.cby"0#c"
+.data 1 , K , -5
+L30: .string ".0"
+.string "xy"
+L32: .string ";01cab9x9""
+L33: .string "ya#y"
+L34: .string ":z;:"
+.string "" "b"
+prn #K
+L37: .string "00"
+L38: .data 1 , K , -5
+L39: .string "y#"acy9:zx" "##caaz"
+ hlt
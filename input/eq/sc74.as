@@ -0,0 +1,42 @@
+.define K = 3
+.entry L7
+.string ""x"
+L2: .string "1czy"
+L3: .string ""x"
+L4: .string "y:"0", "":c"
+mov L21, r2
+L6: .string "0"
+L7: .string "c;c#0110;bx"
+L8: .string "c1cxy:a", "9y9.yzcz"bx"
+L9: .string ".#x:.z"
+.entry L30
+.string "y9ca"
+prn #K
+.data 1 , K , -5
+L14: .string "0", "a.."#xc:01"
+L15: .string ".c9y.9y" "0x;;"cx#y:c"
+L16: mov L38, r2
+L17: .string ";0c1b;xa#:z"
+L18: .string "xb1x0":#c"
+L19: prn #K
+.string ";yzz.9"
+L21: .string "y""
+L22: .string "1b."
+L23: .string "#";010a1"
+L24: .string "xa..0.ba"
+.string ""
+L26: .string "1:"
+prn #K
+L28: .string "bxx"
+.entry L13
+.entry L3
+mov L25, r2
+.entry L27
+L33: .string ""a#y9bcbx" "bz#9x#xy001x"
+L34: .string "y:0"
+L35: .string "c91.cxcazy0"
+L36: .string ":9z:1.y""
+L37: .string ".zx.ya#x"
+L38: .data 1 , K , -5
+L39: .string ";.b"bca9#9#0", ""
+ hlt
@@ -0,0 +1,42 @@
+.define K = 3
+L0: .string ""
+.string "::"."zb" "b#yy1"
+.data 1 , K , -5
+L3: .string "9;:1:x"
+.entry L38
+L5: .string ";.ab"
+L6: .string "b#yz9:"
+L7: .string ":x"x0:..a", "z1ya"
+mov L35, r2
+L9: .string "9.zc" "1.1.b0"
+L10: .string "by00z", ""1#z;"z0"
+L11: prn #K
+L12: .string "#;9y#xz1", "c9."
+L13: .string "z:1.x"a0#z#b", "yx"
+L14: .string "c0#bz""
+prn #K
+.entry L32
+L17: .data 1 , K , -5
+L18: .string ":9z1.a:"x0", ""
+.string "zc;9"ax.19zz"
+L20: .string ""
+L21: .string "cx.c"0b9#"
+mov L13, r2
+L23: .string "z""
+.string "a:9"
+.entry L25
+.entry L9
+L27: .string ""
+L28: .string ".xy:bc1"
+L29: .string "0#"1azx1x"
+L30: .string "by#a:9"x" "b:c#9:9:;b;c"
+L31: .string "acbx"
+.string ""
+.data 1 , K , -5
+.string "c", ":0b0"xy"z"9""
+.string ":", "aa":c;b":"
+L36: .string ""
+L37: .string ""
+L38: .string ":;c.b1zz:zaa"
+L39: .string ""z"
+ hlt
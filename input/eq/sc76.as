@@ -0,0 +1,42 @@
+.define K = 3
+.string "ya0"
+.string "1xbz"yx"
+L2: .string ";;#0.x" "ab::0cb"
+.string ".y:;b".9baa", "1c;;019"
+L4: .string "0x#1#;z", "9;"
+L5: .string "9b" ""
+L6: .string "0.b.ca"
+.entry L14
+.string ";#y1#;b"9b"
+.string "b"
+.entry L7
+L11: .string "11z;z#"
+.string "axzb.x1x"
+L13: .string "y.""19ax" "";"#10.19:."
+.string ":1bbcxy"
+L15: .string ";1y"1:9;9cb", "yc1#1.z"
+L16: mov L0, r2
+.string "0"
+L18: mov L25, r2
+L19: .string "zccc"baxa"
+L20: .data 1 , K , -5
+L21: .string "y9c0z"
+L22: .string "x:9:yxy;"
+L23: mov L8, r2
+L24: .string "#a:.9:x", "z"
+.string "yy10.y0.zz", ":b:0;"
+L26: prn #K
+L27: mov L37, r2
+L28: mov L5, r2
+.string "b0"
+prn #K
+.string "1c;.1;." "c"
+L32: .string ""z9.zazz.#z." "";"c;9;#"
+.entry L8
+L34: .string "c:9cc#zb.cx;" ".11:b;00:9z"
+L35: prn #K
+.string "9zy#";"
+prn #K
+.entry L34
+L39: .string "0"a;9c1;"yb", ""
+ hlt
@@ -0,0 +1,42 @@
+.define K = 3
+L0: prn #K
+.string ".0a:", "0#:x.109a""
+L2: mov L21, r2
+L3: .string "c#", "zax#b"
+L4: .string ""9y."c:9:."
+.string "b."9ab1:zx0"
+L6: .string "ca;#zz#99y"
+.string "ax0caab1.0" "y"
+L8: .data 1 , K , -5
+L9: .string "#x", "x1bbx;a"
+L10: .string ""y":x"
+L11: .string "a.0a1az#0x"
+L12: .string "9y"
+L13: mov L22, r2
+L14: .string "c0z190a9c""
+L15: .string "#z;19zxc"
+.data 1 , K , -5
+L17: prn #K
+L18: .string "199y9:90;"
+L19: .string "yay" """c9c"
+L20: .data 1 , K , -5
+.string "x:;1z.:9c"
+.entry L39
+.data 1 , K , -5
+.string ";ya1"":"
+L25: .string "x;zyc...#", "9c#9;ax"
+L26: .string ""
+.entry L13
+L28: .string ""110"" "09;c0yy""
+L29: .string "1"90"
+.entry L8
+L31: mov L25, r2
+.entry L30
+L33: .string ":c#bb;"a#x" "y11yz1xz#b"
+L34: .data 1 , K , -5
+L35: .string "bz1a.c...1:" ""
+.string ";"
+L37: .string "01zzx9yc;", "#ax00"
+L38: .string "xx1c0;9x"
+L39: mov L38, r2
+ hlt
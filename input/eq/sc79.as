@@ -0,0 +1,42 @@
+.define K = 3
+L0: .string "xx"
+L1: .string ""
+L2: .string "c01"", ""b0by#1a."
+.string ".ba1b:b"
+L4: .string "z1ycba;:.9z"
+L5: .string "yz#a9#.:c"9"
+L6: .string "#9za"#0b:a" ".x0:11xxz#x"
+L7: .string "c1b9"az#9c1" "c"
+.data 1 , K , -5
+L9: .string "y1.xx:"
+L10: .string "y1a#b.a.0"
+.data 1 , K , -5
+L12: .data 1 , K , -5
+L13: prn #K
+.string "#cz."
+.string "9b."
+.data 1 , K , -5
+L17: .string ";1" ":9#"b1."
+L18: .string "09y;bcb"
+.string "":19"
+L20: .string ""
+L21: .string ".:x"
+L22: .string "#1""1z:9b""
+L23: mov L25, r2
+L24: .string ":zx"
+L25: .string "y""ab" "#;"yx90"
+L26: .string "0.9;""
+.data 1 , K , -5
+.string "b"0"
+L29: .string "::" "c"""0bx9;"
+.entry L12
+mov L17, r2
+L32: .string "x".bzb;y;0"
+.string "1byz"
+.string "a", "9b"
+.string "":101z" "";;b"
+mov L24, r2
+L37: .string "9y1cc.z;#" ".c0:xccycaz"
+.string "z9.bbyyyyz"
+L39: prn #K
+ hlt
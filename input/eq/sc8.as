@@ -0,0 +1,42 @@
+.define K = 3
+.string "x."
+.string "x0:a1110"
+.string "1"
+L3: .string "10.b:y"
+L4: prn #K
+L5: prn #K
+L6: .string "1"
+L7: .string "c;b9a1.xc";1" "y9z"0cc"
+.string "z:"19;xycz9"
+.data 1 , K , -5
+.entry L34
+L11: .string ""
+L12: .string "0y"."
+L13: .string ":""
+.string "ba##"
+L15: prn #K
+L16: .string "100b;by.b", "b#99zc#91."
+L17: .data 1 , K , -5
+L18: .string ";b.yzzza:"", ""
+.string "#";ccz01bbx;"
+prn #K
+L21: .string "1:c.19.b.1;"
+L22: .string "a1b"
+mov L39, r2
+.string "9b.#;9", "x9xz90.9:"
+L25: .string "."
+L26: .string "yb90.z#."z", ""z#y:"bx1z"
+.string "y0;" "9..z":;;z:"
+L28: .string "y"
+.string "#b;""y"
+.string "y:0x"
+.string "1xx"#;9"xz1", "b0b:c#;0a#ca"
+L32: .data 1 , K , -5
+.string ";bc;"
+L34: .string "a"b"c:#z"b"x", "#zxy.zzb9"
+.string "ccy0c0", "b"
+.string ".xbaa"
+mov L35, r2
+L38: .data 1 , K , -5
+L39: .string ";"
+ hlt
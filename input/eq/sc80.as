@@ -0,0 +1,42 @@
+.define K = 3
+L0: .string ""0zz90za9#""
+L1: .string "a0xc9;ac1"
+L2: .string ";c:xy", "z"
+L3: .string "yyz;;az1"
+L4: .string "9.a1x"
+.string ".:a9a", ":"
+.string "1.a9b"
+mov L8, r2
+L8: prn #K
+L9: .string "c"#bb"c0#y"
+.string ":91x;c;9#z#""
+L11: .string "z00a"
+mov L22, r2
+L13: .string ";yz;""
+.string "#""
+L15: .string "y""a#..", ""b"
+.string ""axyz.#zbz"
+.string ""0:09b"
+L18: .string "a:ba#z1"x", ";y"
+.string ".:;c9."
+L20: .string "#", "9#yx"0;1.y"
+L21: .string "#1xczyy#b11"
+.string ":#"
+.string "b0a..x"
+L24: .string "bb"
+L25: .data 1 , K , -5
+L26: mov L33, r2
+.string "";"
+.data 1 , K , -5
+.string ""bab:a01"
+L30: .string "bcz:..cay"
+.string "x.yzbbx9zc"
+L32: mov L27, r2
+.string "y#bc19a0"
+.string ".ccy:1y0b"
+.string "#9y91xz"
+L36: .string "x"
+.string "b;xb##"
+L38: .string "yc.b0az1zyx"
+.string ".11"y:x", ":1b;1"
+ hlt
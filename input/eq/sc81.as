@@ -0,0 +1,42 @@
+.define K = 3
+L0: .string "901"acc1" "azy.zxy:c"
+.string "9c"#.zc0#"
+L2: prn #K
+L3: .string "."0zyz."y;z"
+L4: .string ":y"y"""
+.entry L14
+L6: .string "y0"aa09ccb""
+L7: .string ""a.xz"
+L8: .string "a0"xba9.:##"
+L9: .data 1 , K , -5
+L10: .string "a1"909"zxy"""
+L11: .string "9#;c;.a9ac.b", "a:#y"
+L12: .string "bx;0yz.#x#x"
+mov L6, r2
+.string "1b0b"
+.string "9;:1"
+.string ";"0x1.1by:c", ""
+L17: .string "1#xcb."
+L18: mov L19, r2
+L19: .string "xz::y"
+L20: .string "z#", "9x919b::y"
+L21: .string "ya9yzy"
+.entry L4
+L23: .string "b:b:"
+L24: .string "z9"
+L25: .string "0a""
+.entry L1
+L27: .string "z1.;.:.1", ";c00"
+L28: .data 1 , K , -5
+L29: .string "bzb##"0"###"
+L30: .data 1 , K , -5
+L31: .string "" ""
+L32: .string ""
+L33: .string ""
+L34: .string ";aa01.9."#a", "0z19yb.##0""
+L35: .string ""yz#bczay"
+.data 1 , K , -5
+.string ".#1.0#x99;1a"
+L38: .string "0b9"
+L39: .string "xza"9.c"
+ hlt
@@ -0,0 +1,42 @@
+.define K = 3
+L0: .string "y"#c#c:y"
+L1: .string ""bxy9"cb1", "#z#1b"
+L2: .string ".ya9z"
+L3: mov L24, r2
+L4: .string "yazyb.xyax"
+.string ".za0:;0ay"
+L6: .string ":b."10ab90.z" """
+.data 1 , K , -5
+L8: .string ""
+L9: .data 1 , K , -5
+.string ":9b"
+L11: .string "0:"
+.string ":cxy"
+mov L25, r2
+L14: .string "b.#;z:1y:c9", ""#"
+.string "b#." ".yz"
+.string ""#"
+L17: .string "0y.0"
+L18: .string ""
+.string "ac"
+.string "a":.1zbbx"
+L21: .string "..a0ya9"", "9"
+L22: mov L9, r2
+L23: mov L18, r2
+L24: prn #K
+L25: .string "cz0"
+L26: .string ":01"
+.data 1 , K , -5
+L28: .string "09x"
+.string "a"y"b1yazya;"
+L30: .string ".bbx9:"x"
+.data 1 , K , -5
+L32: .string "abb"
+L33: .string "b#"
+L34: .string "0.aaaz"a.0"z" "1"x0"
+L35: .data 1 , K , -5
+L36: .string "y#xczz:"
+L37: .string ":z11#z9"bx9"
+L38: .data 1 , K , -5
+L39: .string ";#"
+ hlt
@@ -0,0 +1,42 @@
+.define K = 3
+.string "c"
+.string "cyb"
+L2: .string "9#x1"
+mov L28, r2
+L4: .string "", "1z0;.c9"z11#"
+L5: .string "c#." "9c;caz1""
+L6: .string "1"
+L7: .string "yyb", "b;"
+L8: .data 1 , K , -5
+L9: prn #K
+.string "c;z:;x9"
+.string ""
+L12: .string "ba"1b;.1ca"
+L13: .string ":a0;c;"
+L14: .string "0cx"b"
+L15: .data 1 , K , -5
+.string "aya10b.a;9x" ""0:b#b"
+.string "1x9c", "#09xbz."
+.string ";.z""a."
+.string "z;.101y1cz" "y9"
+.string "#1", "0a:.bx"
+.string "a.;c:xcy"
+.string "#"99"
+.string "z"a", ""aba:"
+L24: prn #K
+.string "0y191"0;z"y", ":.:cx:.9"
+L26: mov L29, r2
+.string "1:#z"
+L28: .string "x;yy;z#xa#0#" "b.1."ca"
+L29: .string "#x9:#::#"
+.string "b", ";"x9y91""9b"
+.string "1y;:y", "b:yac;"
+mov L20, r2
+L33: .string "1byx;#x1b9"
+L34: .string ".bxa#bxc" ";."""
+.entry L37
+.string ".9###x#ab"
+.string """
+L38: .data 1 , K , -5
+L39: prn #K
+ hlt
@@ -0,0 +1,42 @@
+.define K = 3
+mov L2, r2
+L1: .string "z"x11"9#.z"
+.string "910." "c:1"
+L3: prn #K
+.string "baxx0cy."
+.string "b19ac###"
+.string ":c9;;xcycz"
+L7: .string "10c9:":a""ba" ";yb"
+L8: .string "0:;yz:"
+L9: prn #K
+L10: mov L22, r2
+.entry L19
+L12: .string "."0" "##z:"
+L13: .string "a"y"bc"
+L14: mov L30, r2
+L15: prn #K
+L16: prn #K
+.string "c""
+L18: .string "a:a";"1b0"
+L19: .data 1 , K , -5
+.string "ay.bzba:"
+L21: mov L22, r2
+L22: mov L38, r2
+.data 1 , K , -5
+.entry L21
+L25: .string "bzyx"
+L26: .string "b1.z9z."
+L27: .string "1..:;yaa#"
+L28: .string "9zb1x9"
+.string "09x0;z#yz;"
+.string "."
+L31: .data 1 , K , -5
+.string ""0b"9a1#yb";"
+L33: prn #K
+L34: .string ";yc"
+.string "zc", "y"1:9;x1yay"
+L36: mov L16, r2
+.string "1y00yx#"
+.string ":;.0y9.:b;." "";;01xx:"
+L39: .data 1 , K , -5
+ hlt
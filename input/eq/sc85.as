@@ -0,0 +1,42 @@
+.define K = 3
+.string "z"
+L1: .string ""z;x:09""9x#"
+L2: .data 1 , K , -5
+L3: .string "b01;:1#1"
+L4: .data 1 , K , -5
+.string "ca0;c"
+L6: .string "", ".z#cayb"
+.entry L35
+mov L15, r2
+.string "#y"
+L10: .string "yzxc":az09#"
+L11: .string "yzyc9ya0."
+mov L37, r2
+L13: .string "9..;yx;." "1z;::xx".0;"
+L14: .string ""z91c1:y1x"
+L15: .string """
+L16: .string ""
+L17: .string "#;", "a"
+.string "b.a#ac;"
+.entry L3
+L20: .string "cczcyb"
+L21: .string "bb""
+L22: .string ""
+.string ".xb#x#y#:.1:"
+L24: .string ".a;"
+L25: .string "x:;0;1" "9.c:900#"
+L26: .string """z01"
+L27: .data 1 , K , -5
+L28: .string "cx;".#9zb", ".1c1bbbb""
+L29: .string "by", "aay"
+.string ":aya#1:;"c"
+.string "#90"
+L32: mov L8, r2
+L33: mov L21, r2
+L34: .string "za.1x99;zcy"
+L35: .string "#"0;#00."
+.string "#c..:c"x" "z"
+L37: .string "cy#.:9.0y0"
+.string "yb"
+L39: .string "a."0#a:"
+ hlt
@@ -0,0 +1,42 @@
+.define K = 3
+L0: mov L20, r2
+mov L32, r2
+L2: mov L24, r2
+.string """
+.string "xza"
+.entry L5
+L6: .string "c"1z00#"
+.string ""
+L8: .string "zz#:0;00;#"
+.data 1 , K , -5
+L10: .string "#10ab.acb#0"
+prn #K
+.string "a9a##az1x1" "y#cz.01."
+L13: .string ".0.9.c#za."
+.string "y#ayy"
+L15: .string "901z"
+L16: .string "b0"
+L17: .string ":00"y;:x";y:"
+L18: .string "0cxx"
+mov L23, r2
+.string "aabb1"#."
+L21: .data 1 , K , -5
+L22: .string "#"
+L23: .string ".";cxy9;z", "9y"
+L24: prn #K
+.string ":9;", ";1c.10"
+.string "zc"
+L27: .string "1" ""1ycxb"
+.string ":c" "#"0;y0#"
+.entry L3
+L30: .string "9z;"99#c9z"
+.string "9"0"x#"
+L32: .string "".".z""cb"
+L33: .string ""
+L34: .string "b;#0axbz#", "b""
+L35: .string "z.;x0:"
+L36: .string "1a9;a10" ""
+L37: .string "00::z", "x09z0""
+L38: .data 1 , K , -5
+mov L30, r2
+ hlt
@@ -0,0 +1,42 @@
+.define K = 3
+L0: .string "by#z:9.z"
+.string "", "b"19;.b#:xyc"
+L2: .string "y0;.:#0z:.:", ":z""
+L3: .string ";yayby"z#" "y1;"aa9"b"
+L4: prn #K
+.string "a#9z"
+.entry L18
+.string "x"zx:zxba"
+L8: .data 1 , K , -5
+.string "yc09x;;za:#:"
+L10: .string ";ac9aa1xz"
+.string "az0zac;":"
+L12: .string ":yz:#1"
+L13: .string ":x;."
+L14: mov L17, r2
+L15: .string "z0"b.y#bb"
+.string "bcxc#xb.:z:a"
+mov L39, r2
+L18: .data 1 , K , -5
+L19: .string ":0:" "#;#y9.a;y"
+.string "x0b"cb0b:z#a" "c#bzx9bx;y0a"
+L21: .string "9"
+L22: .string ":#091#bzy", "0y0:x.9.a#"
+L23: .data 1 , K , -5
+L24: mov L28, r2
+.string "b.9b"
+L26: .string "0"
+.string "cxc:bx191b"
+L28: .string ":1c1.cx.y#"
+.string "#:0a.;a" "yzy"#"
+L30: .string "az.:y"
+L31: .data 1 , K , -5
+L32: .string ";9y99#x:zbz" "#0:0:a"
+.string "x"
+.string "bbay.ya"
+.data 1 , K , -5
+.string "az0.#.:;1"b"
+L37: .string "bayx" "9;9#:#"
+.string "9x" "b#by#;"#."
+L39: .string "c9"cxcya0"
+ hlt
@@ -0,0 +1,42 @@
+.define K = 3
+L0: .string ":a"
+.data 1 , K , -5
+L2: .data 1 , K , -5
+L3: .string ";c", ":0cyc"
+L4: prn #K
+.string "xxcax:9"
+L6: mov L31, r2
+L7: mov L30, r2
+L8: .string "acc0y." ""
+L9: .string "yz.x0z"
+.entry L36
+.string "czy:09"
+L12: mov L2, r2
+.data 1 , K , -5
+mov L22, r2
+L15: .string "91."
+L16: mov L3, r2
+L17: mov L22, r2
+L18: .string ":x.a01c:0a.9" ".#"
+.string "b.y9"
+L20: .string "aa"zcx.0;#c", "0;.".0x:":a"
+.string "zz10.:", "9z;0cyxz"c.y"
+L22: .string "#;0xa"zcac"
+prn #K
+L24: .string "1c1:x"
+L25: mov L19, r2
+L26: .string "9abycbxz;9;"
+L27: .string ""00"
+L28: .string "#cb", "b"##czax9#"
+.string "1#0bxb0y#."
+L30: .string ".yy"z"bcz"91"
+.data 1 , K , -5
+.string ".;c0a0x#"
+L33: .string ";y:y"9yza."1", ""
+.string "9z##yazz"
+.string "9c.::xyaby:1" "ccb9y0#z"
+L36: mov L16, r2
+L37: mov L40, r2
+L38: .data 1 , K , -5
+.string "yb;xb"
+ hlt
@@ -0,0 +1,42 @@
+.define K = 3
+.string "cz"b"
+.string ".:zb"
+.string "c;1"
+L3: .string "bb01b0"y.zc"
+.entry L14
+L5: mov L0, r2
+L6: mov L35, r2
+.string "9c91"
+L8: mov L35, r2
+L9: .string ""9"", "9:;#"
+prn #K
+L11: .string "9y:xz99a1cyy"
+.entry L27
+L13: .string "1.:a:".cxy#", ""
+L14: .string "0:"z"
+mov L7, r2
+.string "b9.90abcc"
+.entry L39
+L18: mov L13, r2
+.string "#"aa.ayz0"
+L20: .string "y0"
+.string "b0119cx9c#c"
+L22: prn #K
+L23: .string "y.z"c"z0x"
+L24: .string "a;0.z;"
+.string ""a.x0xcb0":"
+prn #K
+.string "c"9", "xz"
+L28: prn #K
+mov L11, r2
+L30: .data 1 , K , -5
+L31: .string "z#0xxc"a#:"
+.data 1 , K , -5
+L33: .data 1 , K , -5
+L34: .string ":0xx:x9:"
+L35: .data 1 , K , -5
+L36: .string "yz":0c#9c"
+.entry L34
+L38: .string ""
+mov L36, r2
+ hlt
@@ -0,0 +1,42 @@
+.define K = 3
+L0: .string "c""
+L1: .string "bz9;.a.0c"
+.string "cx"
+.string "b#.0#.byx"
+L4: mov L5, r2
+mov L25, r2
+.string ".a0"
+L7: .string ""
+mov L38, r2
+.string ""xz"
+L10: .string ""
+L11: .string "0b0" "b.;cc;.aay9:"
+L12: .string "ab".0xc;9"
+.string ";#.b"zb";"
+L14: .string ".a0#;za0b"
+L15: .string "y"
+.string ""
+L17: .string ".#x;." "xb#09z"9zc"
+.string "aa#c"
+L19: .string "aa"
+L20: .string "a#zyc19yc"
+L21: mov L7, r2
+L22: .string "9##0;#c:.y#"
+L23: .data 1 , K , -5
+L24: .string "c#", "c"
+L25: .string "11"
+L26: .string "1;y9b:a;" "9y999:"
+.string "yb.x.cbb"
+L28: .string ".a:;azx1xz"
+mov L15, r2
+L30: .string "a:00;bbxa"
+L31: .string ";1991"
+L32: mov L20, r2
+.string "c01"cbz:x"
+.string "b"
+.string "z"
+.string "z":"
+.string "xa1y;ab9#0"
+.string ""x:a:ycya"
+.string "ay"baz", ";z1;z""
+ hlt
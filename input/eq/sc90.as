@@ -0,0 +1,42 @@
+.define K = 3
+L0: .string ";;y:z#1;"y"
+L1: .string "ca::"0z1#bc"
+L2: .string "a" "#xbb"
+L3: .string ":c#"
+L4: prn #K
+mov L4, r2
+.string ";y"c;"
+L7: .string ";019a1z9"
+.string "c":yxya;01c"
+L9: .string "c#x9y::x:c:"
+L10: .string ""
+.entry L40
+L12: .data 1 , K , -5
+.string "c#ac#." "";.9b0z;0"
+L14: .string "0b#.xac9bbz""
+.data 1 , K , -5
+L16: .string "11"
+L17: .string "x::"by"
+L18: .string "10z;;"
+.string "c9zc.""
+L20: .string """;y.9a##x"
+L21: .string "bc.9c1xyzy1" ""zcc;;"
+L22: .string "z9x9a##;"0"
+L23: .string "z01"z"
+.string """" "yb01;""
+.string ""b;a"
+L26: prn #K
+.string "#y", "#y"
+L28: .string ";"x#:yc"c.x"
+L29: .string ""
+L30: .string ";y#bayyx1xz"
+.string "::#:9"
+L32: .string "0by", "0:"
+L33: .string ""
+.string "cyy"1#yx:z#" ";"
+L35: .string "90#.c9"" "b0:"
+.string ";zzaxc:;"
+L37: .string "cz#1yzb9a0yb", "91.a#a"
+L38: .data 1 , K , -5
+prn #K
+ hlt
@@ -0,0 +1,42 @@
+.define K = 3
+L0: .string ":c01"#.111"
+.string "#1x#x"
+.string ":1.9:y09#"z0"
+mov L35, r2
+L4: .string ":z.9"""
+L5: .string ""
+L6: .string "9"
+.data 1 , K , -5
+.string "c;";"1:z1;"x" "#za;0c."
+mov L13, r2
+.string ";b" ""
+L11: .string ""
+L12: .string "9yxzzb0"::" ";90"
+L13: .string "#9yy", "ac"
+.string "#b" ""1:z1"
+.string "y;.c:.a.;:"
+L16: .string "90z"
+.string "yybx"
+L18: .string "#c."
+.string "":;b9z9y"
+L20: .string "1#byzazc.x"
+.entry L12
+mov L12, r2
+L23: .string "."
+L24: .string "b91z#", "9z0"b9;9.;"
+L25: .string "x9:", "cb;"c.;#"
+L26: mov L37, r2
+.string ""
+L28: .string "c"
+.data 1 , K , -5
+L30: prn #K
+.entry L29
+.string "bb#yx0"
+L33: .string "bb.b9:1b";b"
+L34: .data 1 , K , -5
+L35: .string "9z:y1b" "bz:yx;9xz;y"
+.string "11yz:c0", ".z;1.1b99:"
+L37: .string "x;9#"
+L38: mov L2, r2
+.string "zxy;99"
+ hlt
@@ -0,0 +1,42 @@
+.define K = 3
+L0: .string "#;y##:##"
+L1: .string ";" "aa"a:"
+mov L10, r2
+L3: .data 1 , K , -5
+.string "c.b:"c#1b0z0"
+.string ";cx", "1#"
+L6: .data 1 , K , -5
+.string """
+L8: .string "c;;yz." "."11cyzc#zx9"
+.string "cza", ":9"
+.string "bc"9z:9#ba.9", "#9x:":"
+L11: .string "c.x#"
+.string ";0#9c;1b#9:", ";x#9""
+mov L25, r2
+.string "x#.9cz:1;b"""
+L15: mov L10, r2
+L16: .string "ba9zy0;99a;#", ":xzy.y#z"
+L17: mov L21, r2
+L18: .string "0"y011x##1", "ba:y"
+.string ":z.1y":"
+.string ";b;yb#"
+L21: .string ";axxa"#1"bcz"
+.string ""ac"yy;a."
+L23: mov L19, r2
+L24: .string "1"
+L25: .string ".0:" "9""bz;#0::"
+.string "011;c9:x:c"
+.data 1 , K , -5
+L28: prn #K
+L29: .data 1 , K , -5
+.string "":x:x0z9"
+L31: .string "c00#"9"
+L32: .string ""9#;"
+L33: .string ".cz1a";;", "yy"
+prn #K
+L35: .string "#x9"
+L36: .string "19"x1.""
+.string ""01az";.."
+.data 1 , K , -5
+.entry L26
+ hlt
@@ -0,0 +1,42 @@
+.define K = 3
+L0: .string ".zbbzcc0b", "a;9b:;"z0"
+.data 1 , K , -5
+.data 1 , K , -5
+.string ";y", "x#1bb"
+.string "b" "#ax;"
+L5: .string "".b10c." ":9"
+L6: .string ";b9ay", ""
+.string "1aa90"c9y"
+prn #K
+L9: .string "aza", "b:zx1a9z;y"
+.string "90ycaya":"
+.entry L34
+L12: .string ";zaa:":;"
+L13: .string "aybc.19#"
+.entry L27
+.string "0."
+L16: .string "" "cy:01x"
+L17: .data 1 , K , -5
+L18: .string "0x;a:zzbab;x"
+L19: .string "z:"
+L20: .string ""0cbzcca"
+.string "x#"
+L22: .data 1 , K , -5
+L23: .string ";y:"
+mov L28, r2
+L25: .data 1 , K , -5
+.entry L33
+L27: .data 1 , K , -5
+L28: .string ""x#"9c#"", ""c"
+.string "b;"
+.string "."" ";x"
+.string ";zy;ac"
+L32: .string "z##9ac1cx" "b#"
+L33: .string "9"
+L34: .string ":x911z", "19#a#"
+L35: .string "0az"aa:zc"
+.data 1 , K , -5
+L37: .string ""
+.entry L31
+L39: .string "1;z1"by.b1#"
+ hlt
@@ -0,0 +1,42 @@
+.define K = 3
+L0: .string "y0"a" "y0;"y"
+L1: .string "z1z#x:"
+.string "yc"
+L3: .string ""b#z", "za9#ay:"xa"
+L4: .string ""
+.string ";x1a.x9"
+.string ".;;yac:9::" "xa0;;;.c.xc:"
+mov L32, r2
+L8: .data 1 , K , -5
+L9: .string "c9:;"c", ":0c1""
+mov L19, r2
+.string "x;:a9" "x:"
+L12: .string "x:a10.0"
+.string "czx0bab.b"
+.string "1yby9#0:z"
+.string "#.#1#y0za"
+.string "9"
+L17: .string "1#z#1#b"
+L18: .string ""..y9bx.c9#"
+.string ";zcyz9xc:"
+L20: .data 1 , K , -5
+L21: .string ":9x:a"
+.string ":ccz"
+.string "x", "x#..ya":"
+L24: .data 1 , K , -5
+.string "#b:;10""
+L26: mov L24, r2
+L27: prn #K
+L28: mov L33, r2
+L29: .string ".b0.cy1110bz"
+.string "b."
+L31: .data 1 , K , -5
+L32: .string "zx", "z0":;9;."#za"
+L33: .data 1 , K , -5
+L34: .string "", "9z"
+L35: .string "b"
+L36: .string """y:0x"
+L37: .string ".b"z0;b;b", "y"c"
+L38: .data 1 , K , -5
+.string "#b"
+ hlt
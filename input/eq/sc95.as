@@ -0,0 +1,42 @@
+.define K = 3
+L0: mov L34, r2
+mov L31, r2
+.string "b:y#xa;.9"
+L3: .data 1 , K , -5
+.string "ccc0z"
+L5: .data 1 , K , -5
+L6: .string "b:z":1yaaz." "zyzx0;0bc"
+L7: .string ":0x"
+prn #K
+.string "::"1c;;b1#1"
+L10: .string "9xycx#"
+L11: .string "" "1:."az#y"#c."
+L12: .string ""
+L13: mov L1, r2
+L14: .data 1 , K , -5
+.string "a9#1.11"
+L16: .string "azx1" "c"
+L17: .data 1 , K , -5
+.string "#1x""z1#0"
+L19: .string "19"cb91#9bb0"
+L20: .string "9..:"
+L21: .string "z1ab19ba:xz", "aa1"
+L22: .string "ycc0x;""9a9#"
+mov L27, r2
+mov L12, r2
+L25: mov L2, r2
+.string "#x01", "x19#axy.b#"
+L27: .string ";xybz:;#."
+L28: .string "x;.x9"
+L29: .data 1 , K , -5
+L30: .string "c:a"
+.string "9c"ba#y91"
+L32: .string "b0cb9"
+L33: mov L13, r2
+L34: .string "#x1#axxbby" "#19cca0c9#"
+L35: .string "b.";"
+.entry L24
+L37: .string "";" "0bx#c;"
+.string "#y;x;9#b.""
+.string "x:";"ba"xc."
+ hlt
@@ -0,0 +1,42 @@
+.define K = 3
+.string """#a;"
+L1: mov L17, r2
+L2: .string "1:b"zxy"
+L3: mov L11, r2
+.entry L34
+.string "bb"
+.string "."
+.string "a;"
+L8: .string ";xac.a"c1a;", "a..a91."
+.string ""
+.string "9;x900z#"
+.string ";yzax"
+L12: .string "99;:.b;x"
+L13: .string "a1y9ac9"
+.string """ "xz".b9"
+L15: .string "1x"
+.string "c1c"
+L17: prn #K
+.string "a.a"
+.string "b#;1ycbay", "cbc#;c0c:#"
+L20: .string "c#:""
+L21: prn #K
+L22: .string "9c91:.", "";9."""
+L23: .string "09;x#x", ".";"
+L24: .string "cx1"
+.string "9bz#;0c#b:"
+prn #K
+L27: .string "91z1"""9.:1y"
+mov L34, r2
+L29: .string "9zxx"
+L30: .string "z..:x:", ""c9z"
+.string "yb;.x9xy"
+L32: prn #K
+.string ":9" "0x99;.x"1""
+L34: .data 1 , K , -5
+.entry L14
+L36: .string "z9a;xbaxcy1a"
+L37: .string "#ccz."zx" ";c..c#c":ac;"
+mov L25, r2
+L39: .string "ba#9x1:#z"
+ hlt
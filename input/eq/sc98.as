@@ -0,0 +1,42 @@
+.define K = 3
+.string "0a1y."
+.string "0a:" "#za###a#0#y"
+.data 1 , K , -5
+L3: .string "c0c;9"xy", "x9"
+L4: mov L33, r2
+mov L10, r2
+L6: prn #K
+.string "b#ca1.19", ":9a9a"9xzy"
+L8: .data 1 , K , -5
+L9: .data 1 , K , -5
+.string ""z0a0..:yzyx", ""
+.data 1 , K , -5
+L12: .data 1 , K , -5
+.entry L13
+L14: .data 1 , K , -5
+.string "0"
+L16: .string ":1:"
+.string ":"#00a"
+L18: .data 1 , K , -5
+.entry L9
+L20: .string "9z;c9cy1"9z", "z"
+L21: .string "xx#az10b."
+.string "a", ""#";a"
+L23: .string ";x":#1z1:a"
+.string "" "c1"
+mov L34, r2
+.string "0;9byc..", "a.cz#:0zb""
+L27: .string "1c"
+.string "0"
+.string "b;":"
+mov L5, r2
+L31: .data 1 , K , -5
+L32: .string "9x1;9ay"
+.string ".99"
+.string "yb9aba9"
+L35: .data 1 , K , -5
+L36: .string "cy0c", "a1y"
+L37: prn #K
+.string "0;xa#zzabcc:"
+mov L26, r2
+ hlt
@@ -0,0 +1,42 @@
+.define K = 3
+L0: .string "xx"
+.string ":.9b;1x0"
+.string "z"0":xc1:c";" "9:#b1z0ay9a"
+.string "1"
+L4: .string ""
+.string ".#"
+L6: .string ":cabac1:", "0"
+.string "zc90x#"
+L8: .data 1 , K , -5
+.string "z." ""
+.entry L9
+L11: .data 1 , K , -5
+L12: .string "c0"
+L13: .string "1#x"yb""zc:b"
+.string "x00z""
+.string "bcaz."0#"
+.string ".yb"..zx##"
+L17: mov L28, r2
+L18: mov L28, r2
+.string "9"
+L20: .data 1 , K , -5
+L21: .string "0y0:"
+L22: .string ";";:.1x0zx"
+.data 1 , K , -5
+L24: .string ":c#:y:0.#"", """z:0a"
+L25: .string ":.c9" "xy.".01"
+.data 1 , K , -5
+prn #K
+.string "#"
+.string "yz9:.;" "#b""
+L30: .string "zcc1""."
+.string "zy"
+.string "0c"1;:1:cb9"
+L33: .string "#1bz:"
+L34: .string "a;z0ycc;a0" "9x9#y"
+.string "x#xb1c"
+L36: .data 1 , K , -5
+.string ".z", "b.:b.c"c"
+.string "0cz"#.x;;#"
+.string "#:0xy"
+ hlt
@@ -0,0 +1,42 @@
+.define K = 3
+.string "c9x"#":0x"a:"
+L1: mov L28, r2
+.string "x,aaa	a:0
+L3: mov L28, r2
+L4: .string "11# a", "xz x,\\\q0"
+.string ":b"1:.z;" ";c#\nz\\;"a"b"
+prn #K
+.string "\ta" "	1:\r;#9	"
+L8: mov L32, r2
+L9: prn #K
+L10: .string "" "	0\\";"
+L11: .string ",#a1z	zc	9bc"
+L12: .string "919xz; czz9\t"
+L13: .data 1 , K , -5
+L14: mov L7, r2
+L15: .string "09x9\t."
+L16: .string "bz"
+L17: .string "\\1\q" ",.b y0b cc"
+.string "9ya	b0, "#z\n:0;x0."
+.string " \\a,: "
+L20: .string "y,.09x:	;
+L21: prn #K
+L22: mov L4, r2
+L23: mov L10, r2
+L24: .string ",\r;,"
+.string ""y	x,b.c:
+mov L21, r2
+L27: .string "c	1c9;
+.string "9xb aac" "b01.zx#z1zx.
+.string "	9","
+L30: .data 1 , K , -5
+.string ",#:,"
+L32: .string "#x90	";9z"
+L33: .string "9"
+L34: mov L36, r2
+.data 1 , K , -5
+L36: .string "z, 1,"
+.data 1 , K , -5
+L38: .string "1:c9	ccaa ;""
+.entry L20
+ hlt
@@ -0,0 +1,42 @@
+.define K = 3
+L0: .string "a0#"9zb\\," ";b.y;:. 9#z"
+L1: .data 1 , K , -5
+mov L28, r2
+L3: .data 1 , K , -5
+L4: .string "	;1,"
+L5: .string ",\t1.1bb" c"
+.entry L36
+.string "xx", "0;..#19y\tx9#"
+.data 1 , K , -5
+L9: .string ";,.1a	b,,1c9"
+L10: .string "1\r\\"cz"" "y.	;	:"
+L11: .string "ba#	cb"
+.string ""y#.\\,9#.,\"y"
+L13: .string ""ax
+.string " cb	x z"y;:
+L15: .string "0"
+.string "#\q.#", "09;xa0..
+.entry L4
+mov L3, r2
+L19: .string "0 # \\\r"
+L20: .data 1 , K , -5
+.string ""c	;:z."
+.string "a,,c"
+L23: .data 1 , K , -5
+L24: .string "	"
+L25: .string "c.0#a:0,0\",, "bb;:,zzx;z"
+L26: .string "c:#;b", ""##z;.,
+L27: .string "." "
+.string ".;	:bbz 1"
+.string "z b:."
+L30: mov L10, r2
+.string ",bzz.y\q
+L32: .string "1"
+L33: mov L18, r2
+.string ";" ""1	 az:1"
+L35: .data 1 , K , -5
+L36: .string " ;c "	\nc"
+.string ",zb;,"
+L38: .string "011:"
+L39: .string "ayaxabzx" "a"
+ hlt
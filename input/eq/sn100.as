@@ -0,0 +1,42 @@
+.define K = 3
+L0: .string "z:;.\n	xc#9b0"
+.string "zy0
+L2: .string ":#	"
+L3: mov L40, r2
+L4: .string "yz0za1
+mov L24, r2
+L6: .string ""
+mov L32, r2
+mov L21, r2
+L9: .string "":bx " "1.\\9"
+.data 1 , K , -5
+.string "xb1 \"0;,#ax"
+L12: prn #K
+L13: .string "x:y"	b#zb"b "zxb"
+L14: .data 1 , K , -5
+.string "b	."#,"
+.string ".y0." "9:9x01b:9"
+L17: mov L1, r2
+L18: .string ":ac", "ac;,#bzca;"
+L19: .string "aa,\\z::#00z" "	9c#y.\n y
+L20: .string "#.;ccb "ay"xc "
+L21: .string "y	"
+.string ":x",x" 1;1b
+L23: .string "y"
+.entry L22
+L25: .string " "\"9a\"xzb1#a"
+L26: .string " x  #0,cz,"
+L27: .data 1 , K , -5
+L28: .string ","
+L29: .string "#
+L30: .string "z"b	#;ac", ":y0.z0"
+L31: .string "9,a91\t"
+.string "z"
+L33: .string "\t:a#,b9"bc"
+L34: .string "# 	:;,zyz", ":.1"x\tzc1ca9"
+.string ".b9";"
+.entry L32
+.string "; 
+L38: .string "c	x9"
+L39: .string "	b" ", """
+ hlt
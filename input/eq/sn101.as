@@ -0,0 +1,42 @@
+.define K = 3
+L0: .string ";#b\t1 "0" "c90zc#	"
+L1: .string ":.0c.# 0x,"
+.entry L24
+L3: .string ".a#0	x;a;;a"
+prn #K
+L5: .string "y:;"z"\rz\qacc"
+.string "x#yz0	#
+L7: .string " ,", ""
+L8: .data 1 , K , -5
+L9: .string "c9y9#"
+.string "1x9za"
+.string "b,19"0		,,"
+L12: .string "::b1\n"
+L13: .data 1 , K , -5
+L14: .string "0;\q	0y#		,"
+L15: .string "0# b1b"
+.string "b9	0b#b"
+.string "y"bb9xc#,\qcy", "x9a1;0"
+.string "0zz0#yb0\q\tx" ""
+.string ""yxxb#c9:", "bx \nx  1z:	"
+mov L40, r2
+L21: .string ":1"1"
+L22: .string ""09a0,b"
+L23: .string "y9;#9b" "cza;"
+.string "b;b1a:", "xz.#9;
+mov L18, r2
+.entry L10
+L27: .string ".\nb" "a" #; y;"1y"
+L28: mov L39, r2
+L29: mov L34, r2
+.string ";:zc"
+.string "	\\.zb;xaz9z"
+L32: .string "1	c0yb	0"" """
+L33: .string "."bz;c9"
+.string ""
+.string ".1"
+L36: .string ",;:,1   \\
+.string "a:x\\z90#"0y"
+.string "a zy\":"
+L39: mov L5, r2
+ hlt
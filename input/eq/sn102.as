@@ -0,0 +1,42 @@
+.define K = 3
+.string "	z"
+L1: .data 1 , K , -5
+L2: .string "\t:#1\tcbz#
+prn #K
+L4: .string ""c1c,:" "..:yz;0c"
+L5: .data 1 , K , -5
+L6: .string "9,"	#\q0:10" "z	;\n:x"z"
+L7: mov L24, r2
+L8: mov L11, r2
+L9: .string "z1\\yy"	1ac"
+L10: .string "ya.9,9#.1.0 "
+L11: .data 1 , K , -5
+.string "#019cz:"ya99"
+L13: .string "zcx"
+L14: prn #K
+mov L3, r2
+.data 1 , K , -5
+L17: .string ":"c,	y##1ya", "	y"0"
+mov L28, r2
+L19: .string "z"99xz9	
+mov L7, r2
+mov L13, r2
+.string "z:1.y,"9;9#", "0:xb,;""
+L23: mov L29, r2
+L24: .string "ax \qab", ":b#0#:19,z9"
+prn #K
+.string "0 cx	9 \t0c", "	1"
+L27: .string "a0#:1z:"\n	a" "\n\t,."
+.string "."
+L29: .string "ax a,
+.string ""
+L31: .string ",	y\nc\""
+.string " ";.ba";"
+.string " x19", ";y"
+.string "z1.;z"
+.string ",y\n,	;z" "0"
+L36: .string "#y\tx	y";"az", "z.00z#,;c\r"
+L37: .string "xb,: x,\"z1,"
+L38: .string "y0 c:"
+.string "9"1\q"
+ hlt
@@ -0,0 +1,42 @@
+.define K = 3
+L0: .string "0cx:#,x"cy1", ""
+.string "\rz..11c;0", "\\9 0\\\t\rb"yy"
+L2: .string "xc "x
+.string ": a	"::#9cz" ""
+L4: .string "111
+L5: .string ":a"#,c	yb,"
+L6: .data 1 , K , -5
+L7: .string "zz9;\"b"
+.data 1 , K , -5
+L9: .data 1 , K , -5
+.string "ca:z..  	,."
+L11: .string "#,.yy##	a" ""
+L12: .string ":x9a		xbyy\r
+mov L35, r2
+L14: .string "c :" 0"
+L15: .string "1,x; \rc, ":b9"ayz"
+.string " ;:,0", ","
+prn #K
+.string "9x	:x"
+L19: .string "",\r#	9by"z.", ";.x9"
+mov L35, r2
+L21: .data 1 , K , -5
+L22: .string "0; a,9x;"
+L23: prn #K
+L24: .data 1 , K , -5
+.string " 0#"
+L26: .string "1,	z# "
+.string "z91x#"	,c0"
+L28: .string ":y,"
+.string "#ay1c:01xx\\", "ya:b:c#"
+.string "z#91a "
+mov L19, r2
+prn #K
+L33: .data 1 , K , -5
+mov L31, r2
+L35: .string "b.: a"
+mov L9, r2
+L37: prn #K
+.string "\"zc0:y1;
+.string " ,xy#.:.zb"
+ hlt
@@ -0,0 +1,42 @@
+.define K = 3
+.string "1:,ayazxyxc", ";b09:
+L1: .string ".b##", "zbxb"
+prn #K
+L3: .string ";"
+.string "b" "	"y1yz\t"
+L5: .string "0#"
+L6: .string "1xc"	.	"	0."
+prn #K
+.entry L31
+L9: .string "aa9a0"#xc01" " xzca.0z:"
+L10: .string "11c"
+L11: .data 1 , K , -5
+L12: mov L15, r2
+.string ""
+.entry L25
+L15: .string ""
+L16: .string "#9c\t\rb"
+L17: .string "", ".a9;"
+.string "z""
+.string " ac#,x1	"x"
+prn #K
+L21: .string ","#.\q"
+.string ";z"
+.string " 101x\q"
+L24: prn #K
+mov L21, r2
+.string "
+L27: .data 1 , K , -5
+L28: .string "za 	"
+L29: .string "1c.;1z\tx
+L30: .string "9.,"b#9", "b:,\qz:x,9"
+.string "b " ""
+L32: .string "b"
+.string ".y0,;"
+.entry L7
+.string ""
+L36: .string ":\"bx zc0\rx01"
+.string "	,1x,1"
+L38: .string """, ""
+L39: .data 1 , K , -5
+ hlt
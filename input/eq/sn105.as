@@ -0,0 +1,42 @@
+.define K = 3
+.entry L6
+L1: .string ", z;zyx:;z.:", "1z \rb,x"
+mov L11, r2
+.string ":	\""\\ \qx.; ", "yx	":;a	0"
+L4: .data 1 , K , -5
+L5: mov L37, r2
+L6: .string "" "c; 91;. cx
+L7: .string ",c1b 01x;"
+L8: .string "99x"\""azy", "b#,1;;;a0"
+.string "1"
+.string "0, "
+L11: .string "c,##""z"aay"
+L12: .string "1ca;0:b.c"
+.string "\n:b;#	x, "ax
+L14: .string "a" "\r9	#,x"
+.string "90:; ,a,"
+.string ":#.\r,c"
+L17: .string ".:""9.;,bc"a"
+L18: .string "#z9,.0x	9z91", "bz\n:xb#bb"
+L19: .string "zza	#"
+.string "	9;#z:.""
+L21: .string "; x
+.string "zzy,y:,xx
+.entry L24
+L24: .string "by,\tx\n ;\ncc,"
+L25: .string ""0x", "#a:	zz\"9
+L26: .string "y0 "
+L27: .string "0.10,:9, "	"
+L28: .string "a"bc	x\rax:,y " "\tz 10c"
+L29: .string "z0::y.." "0b;\n	1##\q	y1"
+L30: prn #K
+.string "9 c9	0	z1y"
+.string "91b.10#	 :" "c.c.9a:1"
+L33: mov L32, r2
+.string " 1	#,.,	0"
+.string "":c" "9:"
+.string " b	1;,"
+L37: .string "zc#zy."
+.string "1,", "ybc,  "
+.string "z9,1;
+ hlt
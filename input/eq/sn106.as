@@ -0,0 +1,42 @@
+.define K = 3
+mov L1, r2
+L1: .string "b9c0";." " 1#9"yz9;""
+L2: .string "y."
+L3: .string "z;#	 9"#.1y
+L4: .string ",	0
+.string ";	#	:0.1\r"
+.data 1 , K , -5
+L7: .data 1 , K , -5
+.string "\nx	""\q1	 ""
+prn #K
+L10: .string "0yac"
+.entry L17
+.string "a.\"0x 9", "a"0 "
+L13: .string "z\r,xb9	b"
+prn #K
+L15: .string "b;,0#1,	;:a."
+.string "y\\.9"
+.string "0,9\n"
+L18: .string "###0y#xac	"
+L19: .string ";:00x1a9."
+.string ""
+.string ":", ";#z# 1\t\q
+L22: .string ";"", "bb1x,9 :ab"
+.entry L21
+L24: .string "c
+.data 1 , K , -5
+.string "#y"
+L27: .string ";\\bxx1\\z" "1 ybc\".;#0x
+L28: .string "" "c#"
+.data 1 , K , -5
+L30: .string "0a\nx "y#,cb11z, \r"
+prn #K
+L32: .string "1"
+L33: .string "y:#z, 9\t;c:\""
+.data 1 , K , -5
+L35: .string "b1;c
+.string ".91	";#"
+L37: .string ".c\t"
+L38: mov L0, r2
+L39: .string "" "0.\t"cb9"
+ hlt
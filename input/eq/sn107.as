@@ -0,0 +1,42 @@
+.define K = 3
+L0: .string "." y.	x9 b9"
+.string "y	y"
+.string """
+L3: .string "..1c"
+L4: .string "b: z"
+.string "#00 ""	\\,a:b" "x\r9a1:
+mov L18, r2
+L7: .string ";\t:..y.#.."
+L8: .string "ya:1 ,y"ca
+L9: .string ",1: ,xyy, "y.0bxc z#
+.string "z0;9, aa#yzy"
+L11: .string ";"
+L12: mov L32, r2
+L13: .data 1 , K , -5
+.entry L23
+.string "0::"
+.string ""
+L17: .string "90x9b#99x".	" ":y,"
+L18: mov L19, r2
+L19: .string "\\.c0.#".\\,y1"
+L20: .string "	
+L21: .string "x";a1", "z.\ny"
+.string """
+L23: .string "z0:y,##:
+L24: .string "za"
+L25: .string ".\" :x9",;:c#"
+.string ""1", "za"
+L27: mov L13, r2
+L28: .string "z  xa;z,,#a;"
+L29: .data 1 , K , -5
+L30: .string "\\y1a:91by" "9.,y:y.,:,"
+prn #K
+L32: .string "	b0 ;y
+L33: .string ",abb"
+L34: mov L19, r2
+L35: mov L32, r2
+.string "#c9	y:;	a.#"
+.string "b,
+L38: .string ""b.#1	a"y"
+L39: .string "1,a0:		xx.x"
+ hlt
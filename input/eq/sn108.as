@@ -0,0 +1,42 @@
+.define K = 3
+.string ":9:0c 0z0,"
+.string "x	,:0b"
+.string "" ",10\\0ac"x:z
+L3: .string "a;z1;	za1"
+L4: .string "bz
+L5: .string ","
+L6: mov L25, r2
+L7: .string ""c \\b:#z"
+.string "y:1a,c :x#"
+.string "bx	\nc;#."
+.string "z", ".a"y.x	"
+.string "0c.:		x"
+.string "#xzc:ab	"
+.data 1 , K , -5
+L14: .string "
+L15: mov L19, r2
+L16: .string "1#b9#09b1", ".,9\nzay;yaz.
+.string "\\z, ,xy
+L18: .string "	;"9 
+L19: prn #K
+.data 1 , K , -5
+.string ";b	0#y"
+L22: mov L25, r2
+.string """, "a.,""
+mov L36, r2
+.string "1a	c;.1xy:#,"
+L26: .string "0999 #z1"
+L27: .string ""0xb, "ca09"
+L28: .string ""1", "..\q,1;	x #x,"
+L29: mov L3, r2
+L30: .string "b#"
+L31: prn #K
+.string ":1yz	""
+L33: .string "z\tz\qc"
+.string " .0"
+L35: .string ""
+L36: .string "\",c;,1
+L37: .string " cy	1#".a0"
+.string "y9"
+.entry L13
+ hlt
@@ -0,0 +1,42 @@
+.define K = 3
+L0: .string "bx1\\ \n1#"
+.string "	\rc\t"
+L2: .string "yz:
+L3: .data 1 , K , -5
+L4: .string ""
+.string ""x90#\"xb9#"
+L6: mov L1, r2
+L7: mov L30, r2
+.string ";:1"
+.string ". 0	x,xc"
+.string "y;z9y"
+L11: .string "#"1x9.cb", ""
+L12: .string "x"
+L13: .data 1 , K , -5
+.string "zx"
+L15: .string "z,a91ybc,b"
+.string "	a191999b,11"
+L17: .string "by;1:xxyx\q"
+.data 1 , K , -5
+L19: .string "\"zx,#"ab," ""
+L20: .string "	,b aaz1", "\q;cx#ba.b
+.string "  b;:bb;", ":zcz"
+.string ".a		  ,.," ".:\qb"
+L23: mov L5, r2
+prn #K
+.string "y
+.string "9	."
+prn #K
+L28: .string "x ;z"
+L29: .string "	"
+.string "900xac;#"
+mov L0, r2
+L32: .string "1,c:0:#	", "	cx:#0#;ya1\n"
+L33: .string "z y::"
+.string "a.y.""
+L35: prn #K
+L36: .string " y0"
+L37: .string ""
+.string ":1cb"
+.string "1z,
+ hlt
@@ -0,0 +1,42 @@
+.define K = 3
+L0: .string "##\"0z\\zx# yc"
+.entry L38
+.string "za\nbb01a#,", "\t ""
+.string "	c9,1\r"
+L4: .string " " ""
+L5: .string ""
+L6: .string "0", ",c ,"
+.string "1x"
+L8: .string "	0#\ty.:x:.
+.string " a0z:xby0#9a"
+L10: .string "c"
+L11: .string ";;#y"y:zy" "10z"
+L12: .string ""c.bxx", "1:9."
+L13: .string "cy" "c900ac9."
+L14: .string "\"yc;y
+.string "\"yba"; bac"", ",ycc"
+L16: .string "y,;c"c.a"a:"
+L17: .string "x
+.entry L24
+.string "##	c\"a ", "a1x""9a"
+.string "z,#"1,:9"
+.string "0:1"
+L22: .string ";bc9zx#"
+.string "\\,#,cb", "b9; ay:#0"
+L24: prn #K
+L25: .string "x#x	;c00"9"
+L26: .string "bz19;	\"z:1c"
+.entry L28
+.string ""
+.string ",#,0xx01:c 	 "9a;\nb"
+.string "a0c.bz	" "y"y\q\q#"c1#\" "
+L31: .string "	9 :0 y	" ""0.	x\n:a	
+L32: .string "x"czc	#.:91"" "."\rx0"
+L33: .string "ab0y1a ,;1""
+L34: mov L32, r2
+.data 1 , K , -5
+mov L1, r2
+L37: .string "z	0	0\t	y"
+mov L11, r2
+L39: .string "00x"
+ hlt
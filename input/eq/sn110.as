@@ -0,0 +1,42 @@
+.define K = 3
+L0: .string "1."9	c	.\r", "\n"
+L1: .data 1 , K , -5
+L2: .string "19 ;;\n.	#9
+.string "9."", "1c",,1z"
+.string "za9y"
+L5: .string "#,\";b :."
+L6: .string "c"
+.string "xbayyyx	
+.string "c1\"cab0a", "y	xc,
+L9: .string "c,0##:	
+L10: .string "z\t"	"
+L11: .string "\t#zxbz"
+L12: .string "b 91z:"
+.data 1 , K , -5
+L14: .data 1 , K , -5
+L15: .string ".c"
+.string "1:\"11.0\q	y:;
+.string "zy"
+.entry L40
+L19: .string "9	9a#,	\r99,"
+mov L10, r2
+.string "9"	a" ""
+L22: .string "x":ab"
+L23: prn #K
+L24: .string "0c"#0xy" ",#",x9"
+L25: .string "c\nb;\nb a
+L26: .string ":"
+L27: .string "\"#:,1z"
+.string ""
+.string "cyb0#by.:"
+L30: .string ""
+L31: .string ";c
+.data 1 , K , -5
+.string " "c"
+.string "
+.string ";c"
+L36: .string "a#9	., ",y"#	zc 	ca.
+L37: .string ""yay.1xz"
+.string "z."
+L39: .string "x9x9aa"x19#b"
+ hlt
@@ -0,0 +1,42 @@
+.define K = 3
+L0: prn #K
+L1: .string ".z0.	1", ".:9:1;""
+.string "#.c
+L3: mov L6, r2
+.string "1\na.\q
+.data 1 , K , -5
+L6: .string "xyaz"#	a"
+.string "	:"
+L8: .string "0yy	9;b#b "cx.;10"x\\:0x"
+L9: .string "0c", "9ba01.x"
+L10: .string "	9," "9	z:\q"
+.data 1 , K , -5
+L12: .string "	0	 xa0\\x,9"
+L13: .data 1 , K , -5
+L14: .string "a"
+L15: .data 1 , K , -5
+L16: .string ""b#;.9, 	" "
+L17: .string ""	 19#ay\"a" "091"
+.string ",:b	.#y\\###." "1"y"
+L19: .string "   "
+L20: mov L30, r2
+.entry L36
+.string "y.0.", " \q	a."
+.string "cx0b1#c#cy""
+L24: prn #K
+L25: .string " 1"
+L26: .string "c.1"
+L27: .data 1 , K , -5
+L28: .string "cb#"
+L29: .string ""
+prn #K
+L31: .string ":z9 a \r" "c"0"
+.string ":"
+.entry L16
+.string "#ab."
+L35: prn #K
+L36: .string "0xc\t9z" "c0;0," xb"
+mov L11, r2
+L38: .string "x :0:\n.#9\r"x", " ,1#,a, . a"
+.string "z"
+ hlt
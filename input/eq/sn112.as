@@ -0,0 +1,42 @@
+.define K = 3
+.string " #.z;1\\a:"
+L1: .string ";01z"
+L2: .string "9acc1 " "cac19	"a9.\t "
+.string "0"
+.string "z.:1zc,cx"
+L5: .string "\"z9ca\qa"
+L6: .string "",\t cc", ".."
+L7: .string "0.,:;yb.
+L8: .string "9 a#"9,b"
+.string " ##.##y:1	#", "  10"
+L10: .string "#"
+L11: .string "9ac1b	1,y0:"
+L12: .string "c#0#y	"
+L13: .string "xc0x;b"
+.data 1 , K , -5
+L15: .string ",xc"
+.string ":
+.string "0.zzc0 "za"
+.data 1 , K , -5
+.string "xx  	;:b"
+.string "10z;,,"y"
+L21: mov L13, r2
+.string ""0 c,y,1"" "	" ;"
+.string "zb#		x#a 0"
+L24: .string "bb:bc,;;:	"", "#,y,;.bza"
+L25: .string ",\"#c"  cc	 ," ""x#:.c01"1y"
+L26: .string "a
+.string ",\t	,,", "z:"
+.string "\rb:zyzx",a" ""
+mov L40, r2
+L30: .string ",a.cy,b
+L31: .string "09.,;\n"
+L32: .string "z"\\z01, ",#"x,9a91 "
+L33: .data 1 , K , -5
+L34: .string "#"
+.string ",1z#1\"a1,;\q"" "\\09c
+L36: .string ":c a\\"
+L37: .data 1 , K , -5
+L38: .string "".:;x:1	"
+.string ""
+ hlt
@@ -0,0 +1,42 @@
+.define K = 3
+.string "9a"	;1.ac y"
+L1: .string ",:0#: "
+L2: .string "19"#z9.90"
+L3: .string ""
+.entry L39
+L5: prn #K
+L6: .string "c\n\qx0,	", " yb#x11"0"
+prn #K
+L8: .string ";1cy
+L9: mov L38, r2
+L10: .string "1aa.0..z;0;b
+L11: .string "\\z9#1"
+L12: .string ""z "
+L13: .data 1 , K , -5
+L14: .data 1 , K , -5
+L15: .string "", ""1;"9b#;x"
+.string "0b\ry"\rb;\r9" "9, 1ax10..
+.string "x0z.y", "9,9az0b"
+.data 1 , K , -5
+L19: .string "a;."
+L20: .string "" \"1:#	;c;\n#"
+L21: .string "\q #\tx0..0\t9c"
+L22: .string ".c.#1 "
+L23: mov L37, r2
+mov L21, r2
+L25: .string "#,x" "c\n"#z;	"
+.string "a,1"
+L27: .data 1 , K , -5
+L28: .string "" ;x191" ","	#1:\"xbya#"
+L29: prn #K
+L30: .string "x9za\qcb;;cb", "":0x:a1a0x0\\"
+.string "c" "9a\r9"
+L32: .data 1 , K , -5
+L33: .string "c9:""x1\t";", "	cx#".b	b: ""
+L34: .string "9;"
+L35: .string "x9" "0z"
+L36: .string ",#za0, "90.#bbcc\ra#"
+.string ":\"#", "z9"
+L38: .string "",a 1,x" "\r1"";;:# "
+L39: .string ",.0bb ", ";:
+ hlt
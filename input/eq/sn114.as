@@ -0,0 +1,42 @@
+.define K = 3
+L0: .string "1by\"\rc	;,x"
+.string "x\r;\q.#"
+.string " xcy9", "\t",c\tx ,b0.c"
+L3: .string "cy".;;x"
+.string "" "b"ba,;9b"
+L5: .string "##9,bxy\r"
+.string "\n#.	.0#"
+L7: mov L11, r2
+.string "xb,##."
+L9: .string "b"
+L10: .string "0yb a
+mov L29, r2
+L12: .data 1 , K , -5
+.string "0\q:y##c \r#
+mov L2, r2
+.string ".0acxz,0\r	
+mov L6, r2
+.string "1" "#:b0#;b
+.entry L34
+.entry L31
+.string "	ax91	c#1:
+L21: .string "z, yzc"
+.string ",;c9#bx0:"x"
+.string "a;	#	,, ."
+L24: .string "	.#a 0 "#"
+.string ""a:bz0""
+L26: .string "xc,99", "	
+L27: .string ",,c:#b1"
+.string "y;"
+mov L2, r2
+L30: .string ":b\t
+L31: .string "z::;c	:"
+.string "\"y x	.;", ":0;::"
+.data 1 , K , -5
+L34: .string " "#xx	\nz1"
+.string "19czzx0	:ya0", "	c;#,;0"0"
+L36: .string " a:b999y""x
+L37: .string "b1	ba1x.c9"
+L38: .string "aa"""
+L39: .data 1 , K , -5
+ hlt
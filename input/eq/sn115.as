@@ -0,0 +1,42 @@
+.define K = 3
+.entry L7
+L1: .string "  ,"b		y" "z"1z"
+L2: .string "y.a0\r1919.;	
+.string ":#
+L4: .string ",\r"
+L5: .data 1 , K , -5
+L6: .data 1 , K , -5
+L7: .string "
+L8: .string ":9 ;.zb\txc,", ""
+prn #K
+L10: .string ".		"" "z \",#\nybyx
+.string "	byc:"1 "a.c
+.string "\q"
+L13: prn #K
+.string "xa,a:c1x1;,"
+prn #K
+.string ";.aaz"0"
+.entry L14
+L18: .string " 	a :;c"
+.string ":".1,1"
+L20: .string ""1":#ayc#9x 
+.entry L38
+.data 1 , K , -5
+L23: prn #K
+L24: .string "	xa#"
+.string "\n, ,"9c	\t9	z
+L26: .string "#\"1b":1#9" "yy	 x:","
+L27: .string "0x"
+L28: .string "y.;a1:bx	:" "b:  "
+.string "9zy;abzybaz
+L30: .string "yaa9c \ra0zxx" ".c#bb"
+L31: .string "bz.bx"zz; " .,c"\ncz\",
+L32: .string ","\n90za90:a"
+L33: .string "x\","#\"1"
+L34: mov L25, r2
+L35: .string "	,y09xa\t\t"
+.string "1#" "",	z;1"
+L37: .string "z"
+L38: .string ";	0zba0 c	10"
+.entry L7
+ hlt
@@ -0,0 +1,42 @@
+.define K = 3
+L0: prn #K
+L1: mov L7, r2
+L2: mov L30, r2
+L3: .string ".c#c,\r"b	", ":"
+L4: .data 1 , K , -5
+L5: .string "0:	9;:b"
+L6: .data 1 , K , -5
+mov L21, r2
+mov L6, r2
+L9: .string "1;"."
+mov L2, r2
+L11: .data 1 , K , -5
+.string ""
+L13: .string "by9\\az"", ".	#:\r,:"
+mov L13, r2
+L15: .data 1 , K , -5
+L16: .string "9 90z#;"
+.string "bby;b\q099"
+L18: .string "		a	z\n"
+.string "b xx#x"
+L20: prn #K
+L21: .data 1 , K , -5
+L22: .string "0.zxy1"
+L23: .string "	 x9#" "\r1ac#:a"
+L24: .data 1 , K , -5
+.data 1 , K , -5
+L26: .string ",;b#"zz09bb9"
+.string """#c9cyy  9 "\""
+.string ""x "
+L29: .string ""
+L30: .string ":\qcc
+.data 1 , K , -5
+.data 1 , K , -5
+L33: .string "x"bbz91y,,#c"
+L34: .string "9z :0"
+.string " xyb:ca,x""
+L36: .data 1 , K , -5
+L37: .string " .c9",z 0" "ac,y01;\qbx"
+L38: .string "b."
+L39: mov L8, r2
+ hlt
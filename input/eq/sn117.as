@@ -0,0 +1,42 @@
+.define K = 3
+L0: .string "z	.x\","
+L1: prn #K
+L2: .string ".:", "az.zy""
+L3: .string "z,x"
+.string ""
+L5: .string ", :	"
+L6: .string "a9 	b"
+L7: .string "
+.data 1 , K , -5
+mov L28, r2
+L10: .string " \":ax 0: " "9,a09#1"
+.string "c\r:,b #", ",1\r1x9bcx"
+L12: .data 1 , K , -5
+.string "" ";#9\nc0:b.y"
+.string ";":\qa0"
+L15: .string "	;c
+L16: .string "1"90" ""c#ba;"x"
+L17: prn #K
+.string "; ba\rb0\\."
+mov L12, r2
+.string "c ;b9ac.;"
+L21: .string "  \t" "cb# c1x xy	"
+.string " .;a0	z"," "zx c1"
+L23: .string ".9y	;", ; # "
+L24: .string "" "ya:c\qz#b1:y#"
+L25: .string "0, "10acax"
+L26: .data 1 , K , -5
+L27: .string "0#y	by"
+.entry L31
+.string "y#"
+L30: mov L14, r2
+.string "c\"xa0	#	y	"
+.string ",", "z1x9:9"
+prn #K
+.string ":c9zy..01c" "#	b,"
+L35: .string ""
+L36: .string "", "z."
+.entry L12
+L38: mov L6, r2
+.string "", "ab;"
+ hlt
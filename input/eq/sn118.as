@@ -0,0 +1,42 @@
+.define K = 3
+L0: mov L6, r2
+L1: mov L1, r2
+.string ""\",\t\n0y: "
+.string ""
+L4: prn #K
+L5: .string "c#09a""
+.string ";:0"
+L7: prn #K
+.string "\t0xz"
+.string "	9zy,#y.x	, "xy"
+L10: .string "zb#0#0 ;,,"
+L11: mov L36, r2
+L12: .string "#by""
+.string ""b.yz.,c;""
+L14: mov L24, r2
+L15: .data 1 , K , -5
+L16: .string ";,x,\"\\aa"
+.string "x99y1a\qx " "abx#"
+L18: .data 1 , K , -5
+.string "	.\q#x#; a, ""
+.data 1 , K , -5
+.entry L11
+.string "z;" "910	\naac,1	y"
+.string " 9" "z:\qa. x
+.string "y#,";"
+L25: .string "\";c,"
+L26: .string "9,		,"
+prn #K
+.string "1"
+L29: .string "9.,"z"
+.string ""
+L31: .string "":;.  "
+.string "9z#,.#y:cxx"
+mov L23, r2
+L34: prn #K
+L35: .string ",0	" #.# ";;	.a9,ab,z#"
+L36: .string "	1,.z:b\tz	x:"
+L37: .string "bzay0y10"
+L38: .string " \n0"
+L39: .string "x9:a cb	"ba\q"
+ hlt
@@ -0,0 +1,42 @@
+.define K = 3
+L0: .string "		.xc.1z990"", "9.b,0y"
+L1: prn #K
+mov L6, r2
+L3: .string ":"		zca"
+L4: .string ",""
+L5: .data 1 , K , -5
+.string ".y:" "aa#.ab9x9\t"
+L7: .string "y.c;y9zb"
+.string "a.zy0\tcyyx" "9#a#;1z#"
+L9: mov L6, r2
+.string ""
+L11: .data 1 , K , -5
+.string " z x;a\r9y "
+L13: .string ""b0"y"x\nac.," "."
+L14: .string "a b.z	9", "b\\"
+L15: .string "#;;:y":y"
+.string "1::c#9cy"
+.string "ba01 #x0" ",a	"
+mov L17, r2
+.string "   cbc", "0axyzc\n#"c19"
+.string "1y ;\q9:" "z:
+L21: .string "9x .00ac"
+.string ""\r,b	bz9x:,"
+.entry L14
+.string "
+.data 1 , K , -5
+.entry L32
+.data 1 , K , -5
+L28: .string ".0,#\t	b0"
+L29: .string ";0,0z		."
+prn #K
+L31: .string "\\z1:", """
+L32: .string "zx	"
+L33: prn #K
+L34: .string "9c:"
+.data 1 , K , -5
+L36: .string "b"
+.string "	", ".	\n 
+mov L35, r2
+.string "#b#	ac#" "1"z0  x010\"y"
+ hlt
@@ -0,0 +1,42 @@
+.define K = 3
+.string ";y:a;"9#1	"
+.data 1 , K , -5
+L2: .string "b0c"
+prn #K
+L4: mov L3, r2
+prn #K
+.string "#x.y	,
+.string "" "c:."":	a"
+L8: .string "9;;: x91,;;\""
+L9: .string "b\n1.b:" "x	1zc9b.9"
+.data 1 , K , -5
+L11: .string " #""1 "#	"
+.string "a9,z1a\n1x
+L13: .string ", "9x1\""";9#z# "
+L14: .string "#0 \raaay"
+L15: .string "."b"
+.data 1 , K , -5
+.string ".c:0	;, ":zayabc.	0"
+L18: .string "0 9	""
+L19: .string ":1c.;,c,yc "
+.string ".;za0"#"zb"
+L21: .string "x1a;;"
+L22: .string "\t\q,"
+.string "1##b1.	:\q#b
+.string "a,"; " "1	y9"b."
+.string " :,yy9b:."
+L26: .data 1 , K , -5
+L27: mov L25, r2
+L28: prn #K
+mov L7, r2
+L30: .string ", "; y 0a	 ba"
+L31: .string " 0z 	ax;"	0#"
+L32: .string "\\ #;:.
+.string "
+.string "x.	:;cy;b1x"
+prn #K
+L36: .string "a1"0#,.	,1", ",b;y x"y9a"
+L37: .string ":,,:""
+.entry L39
+L39: .string "9y	#99"
+ hlt
@@ -0,0 +1,42 @@
+.define K = 3
+L0: .string "#c,019,;zx" " y   "
+L1: .string "." "axa
+L2: .string ".:	:caa:; 0y"
+L3: .string "9;.99:9\";b,	", ",,\r"
+prn #K
+.string "x1y"
+mov L29, r2
+L7: .string "0", ",1"0\""
+L8: .data 1 , K , -5
+prn #K
+L10: .string ""z"
+prn #K
+L12: .data 1 , K , -5
+L13: .string ""
+L14: .string " #y\r	yxzbz" "		"
+mov L14, r2
+.string ":ccy9:9#"\r"
+L17: .string ",10x:,,9z"
+L18: .data 1 , K , -5
+L19: .string "y9	\"a	0\qay1b"
+L20: .string "".:", "#c:abcby"
+L21: mov L26, r2
+.data 1 , K , -5
+L23: .string "y"
+.string "x:ya0"y	0#z;"
+.string "yc,:9";1,\qz", ""	#
+L26: .string "
+L27: .string ":y.y#9y"
+L28: .string "z\q# \q;"x:1b."
+.string "99"
+.string "	":"
+L31: .string "#\\"
+L32: .string ",1cx,  \"
+.string "ax#9;9;\t"
+L34: .string "0,"xc.x"9 ", "z	xzxb;"
+.string "0x #\ny #"
+L36: .string "		bc x"", ";b	c\\9	y.1::"
+L37: prn #K
+L38: .string "a\q:0	#:x"9"
+L39: mov L4, r2
+ hlt
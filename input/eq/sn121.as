@@ -0,0 +1,42 @@
+.define K = 3
+L0: .string "z\t, z."
+mov L38, r2
+L2: .string ".,#1y;z"
+.string ".\\z,x.ay,#"
+mov L0, r2
+.string "" "b	y0za"
+L6: .string "xaz100za;", "c,#:,9"
+L7: .string ":"a;.""
+L8: .string "::xcbc\"";""
+L9: .string "091zc"
+L10: mov L24, r2
+.string "", "0\rbba1;y	1 x"
+L12: .data 1 , K , -5
+L13: prn #K
+L14: .string "\t0"z:0,"
+L15: .string "#	"
+.entry L39
+L17: .string ";"
+.string "	9aa"
+.string "ya9y" ",
+.string "\na #:." "y."a,9:1z9"
+L21: .string "
+mov L17, r2
+L23: .string "z", "	#"
+L24: .string "y,	\"xc;1x"
+.string "1c;9\\y0"
+L26: .string "11zz.a#\\: "
+.string " .
+L28: .string "bb	01cbcza"
+L29: .data 1 , K , -5
+L30: .string "#,"
+.entry L40
+.string "c1:" ":cbaa
+.string "zcy,c" "c"
+L34: .string ".;9a0b.
+.entry L9
+L36: .string "yxzb
+L37: .string "a9,;1b" ";:."
+.string ""ab:1"y1#", "1
+mov L20, r2
+ hlt
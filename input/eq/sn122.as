@@ -0,0 +1,42 @@
+.define K = 3
+L0: .string "c;1# "zx #1	::y,"
+L1: prn #K
+L2: prn #K
+.data 1 , K , -5
+.string ";b	," ";:"
+.string ""
+.entry L19
+.string ""
+L8: .data 1 , K , -5
+L9: .string "x1b#x;c 9	1
+L10: .string "10zz:;,"z"
+L11: .string "x\".zb", "z\tx\n;x"
+.data 1 , K , -5
+.data 1 , K , -5
+.string " ", "	c# 11ab\rb"
+.data 1 , K , -5
+L16: .string "\\"
+prn #K
+L18: .string ""b0xb#cxa,0"
+L19: .string "x;:;"
+.data 1 , K , -5
+.string "0,,y" 1 ;az" "91y;;a0y #;#
+.string "1
+mov L0, r2
+.string "z.9a1:"
+.string "c\tz	
+L26: .string ","
+L27: .string ""
+L28: .string "zcba zb"
+L29: .string ",,. #"\qbc"
+L30: .string "c:z; a"
+L31: .string " .#azx9999"
+L32: .string "9.01yz0;"
+L33: .string ":"
+L34: .string "cby"
+L35: prn #K
+L36: .data 1 , K , -5
+.string "c y" "a"#x"
+L38: .string "b9.;"
+mov L39, r2
+ hlt
@@ -0,0 +1,42 @@
+.define K = 3
+L0: .string "9xb:		"
+.entry L21
+.string "a." ":ca,#xbcy"
+L3: .string ""9"b ,", "0\",a:\\	"
+.data 1 , K , -5
+.string "\nzc"9"
+L6: .string "#"
+L7: mov L37, r2
+.string "
+L9: .string "b "1	"zy, ":#bay#0"
+mov L27, r2
+L11: .data 1 , K , -5
+L12: .data 1 , K , -5
+L13: mov L0, r2
+L14: mov L34, r2
+L15: .data 1 , K , -5
+L16: .string "b	,.;az, "cy;1cb"
+L17: .string " :;y	,\nz:."
+.string "## .a"
+L19: .string "y,\n	;1,c"
+L20: .string "9:b\n0" "a091c,c,		y	"
+L21: .string "a9",:1", "a""
+.string "#;.,;" ",0z:b.:"
+L23: prn #K
+L24: .string "x9\"," "b: x#,"
+.string ";1#\"9,bzx"
+.data 1 , K , -5
+L27: .string "y,;1b#\" "
+L28: .string ":1c9 z.;.ba", "0b"
+.string "0 "#1 \nx"
+L30: .string "\n:." "xb..\ry""
+.string "", "c:a"
+L32: .data 1 , K , -5
+.string ". z x ,0\n;y"
+L34: .string ":	0:c"
+L35: .string "xyx#;	a#\r ;"
+L36: .string "x,c0:z.y"yaz", ","
+L37: .string ":bb"
+L38: .string "b;#011.,yc"
+.string "1bb	c"
+ hlt
@@ -0,0 +1,42 @@
+.define K = 3
+L0: .string "b.", "b,z: "
+L1: .string "a10x:,"
+.string ";	 :zx#\"x:"
+.string "#cy	:1z#\n"
+L4: .string ";#czc\nb1	\n""
+L5: .data 1 , K , -5
+.string ""
+L7: .string ""
+L8: .string "y"\r;cb" ":cx:"
+prn #K
+.string "ccb"
+L11: mov L10, r2
+L12: .string "b.", "abc#;cc"
+L13: .string "	.1#
+.string "\";1,#\t\q;,cx"
+.string ",, "yc\n#; "c,"
+.string "9\r9#yx9b#x1"
+.string "c:".\\0"
+L18: .data 1 , K , -5
+L19: .string "1,c#z91c"
+L20: .string "y::1a b;z	,c"
+L21: .string "y\n y"
+L22: .string "#:;c#"
+prn #K
+.data 1 , K , -5
+L25: .string ""1yax0.a;", "cxa zx.9a."
+.string "y0 \"c9b"y#	\r"
+.string "	zy0ayx.1
+L28: .string ": 1"#,a90
+L29: .string "y ..x#09\\
+L30: .string "#\tx\n"xba##"
+.string "#:,z.y:,#"
+.string "	ac0","1"
+L33: .string "9#y"
+.data 1 , K , -5
+L35: .string "x\r	"
+.string "\t"xc,,bb	;"
+L37: .data 1 , K , -5
+.string ",axy", "\\x:0;".1\q1"
+L39: .string "	;x.c,9z	,." ",	\t;cx190:a"
+ hlt
@@ -0,0 +1,42 @@
+.define K = 3
+L0: .string " z;y acy"\q.x", "z"z"
+L1: .string "	.azzcb.c:#", ""
+.data 1 , K , -5
+.string "1a.	1,"1:\r#\""
+L4: .data 1 , K , -5
+L5: .string "z#z#"
+.string "x\t;,
+L7: .string "	z0" "#"
+L8: .string "9	,#
+.string "0##", "9,1\n\\.#zc\";1"
+L10: .string "zb":\\;	"
+.string "	aay,"" "bx #0#\n#"
+L12: mov L19, r2
+L13: .data 1 , K , -5
+L14: .string ""	.
+.string "a.	cz,xb"
+.string "b"
+.string ""
+.string ".:\t,z1c,1"
+L19: .string "cay11:1y"
+L20: .string "\n"0;":;0#	"
+.string "" " c,yy,;,,z""
+.entry L2
+mov L4, r2
+L24: .string "1"
+.string "9;0. #".z#,	"
+.entry L24
+.string "a9yx, "xb#,	c9a1\rxc"
+L28: .data 1 , K , -5
+.string "c# " "c"
+L30: .string ".: 0c";,xx9c", ".1y"x ."
+L31: .string "b y.:cx", "#,#;\\	"
+L32: .string ";.9"""x	#"
+mov L1, r2
+L34: .string "y0	"zy;"
+L35: .string "	y"#z"
+.string ":a", "a1"
+.string ",0a,z9bbyx", ":a	.0"
+.string ""z"
+.string "."
+ hlt
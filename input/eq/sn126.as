@@ -0,0 +1,42 @@
+.define K = 3
+L0: .string "1z""1zy "c 	y;0""
+.string ""\nc z10"
+L2: .string ".0a"
+L3: .data 1 , K , -5
+L4: .string "
+mov L5, r2
+.string "#..\rb"
+L7: mov L9, r2
+L8: .string "a	"
+L9: mov L4, r2
+.string "x," "y	."
+L11: prn #K
+mov L38, r2
+.string ""a,	,", " .x00\\;,"
+.entry L5
+L15: .string "bxbz9#x:
+L16: .data 1 , K , -5
+L17: .string "az0\tc:#:0..b"
+L18: .string "" ";x1"
+L19: .string "\rayy.11"
+L20: .data 1 , K , -5
+L21: .string ",c"
+L22: .string ";" ":y,\n#zb#\"1"
+L23: .string ",#"y	."a"
+.string ":1x,cy\r1:"1"
+mov L1, r2
+L26: .data 1 , K , -5
+L27: .string "aa0,z, " " :"
+.string "b
+.string " 9	"z	x0\\cy"
+.string "c" "
+L31: .string ""
+mov L29, r2
+L33: prn #K
+.string "\"" 0;zbz	"
+L35: mov L10, r2
+L36: .string "#y,.\q"
+L37: .string "\":#"
+L38: .string ":#a9\nx
+L39: .string "" a.;19:"
+ hlt
@@ -0,0 +1,42 @@
+.define K = 3
+.string "xaa90.1  "
+L1: .string "x:xc;;a"
+mov L23, r2
+prn #K
+L4: .string "x9;\n90. ."
+L5: .data 1 , K , -5
+L6: prn #K
+.entry L38
+L8: .string "#0:yc#	1x 0."
+.string ":a#x1x	. "
+L10: .string "y :   ;:	#ay
+.string "baz" "\n,9
+L12: .data 1 , K , -5
+L13: .string ": ""
+L14: .string "9#\\z
+L15: .string "#x,	09.9
+L16: .string ".ya;.0#"
+.string "9"
+.string "cbz."
+.entry L18
+L20: .string ". c9" "	0,yc;ay#0\n""
+.string "zb"
+.string ":\ty	\q"0;"
+L23: .data 1 , K , -5
+L24: .string "b:;"z;\"x	.9"
+.string "# az", "9c;x;;aa;"
+L26: .string "z"
+L27: .string ""010c;", ":c; " b1,;	b"
+.string "1xayy9::x" "\n,	xzz:.x:91"
+.string "x	a"
+L30: .string "y"\tbxx0y "
+L31: .string "c ";.	cca"
+L32: .string ""
+.string "#aac#a#"	c z"
+.string "by\rza
+.data 1 , K , -5
+L36: .data 1 , K , -5
+.string "b.90	0\q \\1" "b0x9x
+.entry L22
+L39: .string "c"
+ hlt
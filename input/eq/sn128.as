@@ -0,0 +1,42 @@
+.define K = 3
+L0: .string ";y"ay,	9", "	 cxa ;x#
+L1: .string "",",\r", "90ay"
+L2: .string "#\\,."
+L3: prn #K
+L4: .string "\r,":	.1"
+.string "x9b c	z
+.entry L33
+L7: .string "\""
+.string ";0ca\t;"
+.data 1 , K , -5
+L10: .data 1 , K , -5
+.string "9bb"x	axz:# "#"
+mov L27, r2
+.entry L11
+L14: .string ""
+L15: .string "1#:y.zb1;19y", ""
+L16: .string "10"
+.data 1 , K , -5
+L18: .string "9.;a" "9ybxz0yac 
+L19: prn #K
+L20: .string "":", "x;" "
+L21: .string "	#bz,"
+L22: mov L26, r2
+L23: .string " z0"cb"
+.string "#a,\n#  "#"
+.string ".\q#.,0 	b 9", ";b0";1.z"
+.string " 	
+L27: .string "	"
+L28: .string ":
+L29: .string "	110
+L30: prn #K
+.string "9#.;;:b:x,."
+.string "z#1.	","
+.entry L15
+prn #K
+L35: mov L18, r2
+L36: .string "	" ""
+.string "bxa;c	\", ";1;1#za  .."
+L38: .string "b,bb;#:. ."
+.string ";:x	a\\#b"
+ hlt
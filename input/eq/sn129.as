@@ -0,0 +1,42 @@
+.define K = 3
+.string "b:1, "x	y"
+L1: mov L8, r2
+L2: .string "yx9c9c."
+.string ""b9" "y,"\"x"
+L4: mov L10, r2
+L5: .string ", ;#,;y\t:0a" "91	"
+L6: .data 1 , K , -5
+L7: .data 1 , K , -5
+L8: .string ""
+L9: .string "9::: 1" "a;:\t#"0"
+L10: .data 1 , K , -5
+.string "x##9	cx"
+.entry L26
+.data 1 , K , -5
+mov L35, r2
+L15: .string "#z;
+.string "	y"	a,\\0a", "
+.entry L31
+L18: .string ".a;b,\r
+.string "" "x	" x"
+.string ": 	z,;.;0:,c"
+L21: .string "zz		.xaa1"
+L22: .string ",90x  "
+L23: mov L5, r2
+.string "x"
+.string ".	#\"\t:"c"
+prn #K
+L27: .string "\"ab"
+L28: .string ".		.1;""
+L29: .string "0.b,x.,a\rxb"
+.data 1 , K , -5
+L31: .string ""
+L32: prn #K
+L33: mov L20, r2
+.string "z;y1 x";yby"
+L35: .string ";		01		"
+.string "\q""  " "1"b
+L37: .string "b"
+.string "9: ;c#
+L39: .string ".0 x\n", ""
+ hlt
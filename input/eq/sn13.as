@@ -0,0 +1,42 @@
+.define K = 3
+.string "z1y1zyc	0 "
+.string "
+L2: prn #K
+mov L16, r2
+prn #K
+.string ";1"	", ";.,x;9"
+.string "##" "0z\r9"
+L7: .string ""	"
+L8: .string "yc.#:"
+.string "y"#"
+L10: .string ";0;\q"
+.string ""0b", "b;,z 0z	x
+L12: .string "		b#,c\ny "
+L13: .string "c"\rba,,y""
+.string "0 b" "zy9.09.1;1 "
+L15: .data 1 , K , -5
+L16: .string "b"
+.string "#"	"
+L18: .string "yb"
+L19: prn #K
+L20: .string ""
+L21: .string ".b;	 yb,z
+L22: .string " "yc";c;90b1"
+L23: .string "#0:b	bxy	;	:", " 9c;baza"
+mov L21, r2
+L25: prn #K
+.data 1 , K , -5
+L27: mov L2, r2
+L28: .string "":9yy#"
+L29: .string ",11;" "".9y#	#0:"0a"
+.string "yx"
+L31: .string "\qb0.a	a"
+L32: .data 1 , K , -5
+.data 1 , K , -5
+L34: mov L16, r2
+L35: .string "1"
+L36: .string ",1b\q.1\qax;y#" ";1"
+L37: .string "yz" ""
+.string ""
+.entry L36
+ hlt
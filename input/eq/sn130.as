@@ -0,0 +1,42 @@
+.define K = 3
+L0: .string "##a;1,1,\qx	" "0;a.a;ya"."
+mov L25, r2
+L2: .string "	\"y\qy xyyc#:"
+.string "c;\ty,x"
+.string ".9" "10yy\r	#1\t b;"
+.string ""#	cx"
+L6: .string ";"
+L7: .string ";z" ":"
+L8: .string "	cz"
+L9: mov L7, r2
+.string "zb0a"
+L11: .string ":0:900x"
+L12: .data 1 , K , -5
+.string "	bb"
+.string "99y# ;:#"y,,", "z;";.ax;by"
+L15: mov L12, r2
+L16: .string "0.a9a b"
+L17: .string ""		:\\,b1,,"
+L18: .data 1 , K , -5
+.string "\t,0 x"0b	:"y" ",	
+L20: .string """x#ab".;;"
+L21: .string "1:a	z;y#;" "1c011"0y:"
+L22: .string ":		"
+L23: .data 1 , K , -5
+L24: .string "z0y#"
+.string "1#1cy	b1cy"
+.entry L37
+.string "\rax;#z"
+.string "."1a0c1#;	,
+prn #K
+.string "x;0."
+.string "x	z\"	;0.
+.entry L6
+.entry L4
+L34: .string "by:,c"
+.string ":"
+.entry L2
+.string "xz0,;1"
+L38: .string ";"
+L39: mov L22, r2
+ hlt
@@ -0,0 +1,42 @@
+.define K = 3
+.string ":"
+.string "xz1	#
+mov L34, r2
+L3: .string "0.ca"9."
+prn #K
+.string ";x	:0z",a
+.string ""
+.string "#"
+L8: .string "\\"
+L9: .string ":#y9;y"
+mov L3, r2
+.string ";#y"
+L12: .string "y\qba\r9#0"
+.string "0#;
+L14: .string ",\qz,."1"
+L15: mov L11, r2
+mov L5, r2
+L17: mov L39, r2
+L18: prn #K
+.entry L36
+.string "\rcx:\tbb a	"
+.string "x0;x"
+.string "y:.z,c#.1 " ":c.zb9cx,9  "
+L23: .string "cc,"
+.string "ca	1y10c,\q", "c" 1::"0"
+L25: .data 1 , K , -5
+.data 1 , K , -5
+L27: .string "x", """
+L28: .string "91;c	0 "
+prn #K
+L30: mov L22, r2
+L31: .string "#"
+L32: .string " \t"
+L33: .string ",;x .99a#"
+.string "c;b:b;\\a", "z,01#;:,"
+L35: prn #K
+L36: .string "\q "
+.string ",9	"
+L38: .string "y,,"
+.data 1 , K , -5
+ hlt
@@ -0,0 +1,42 @@
+.define K = 3
+L0: .string "b "
+mov L34, r2
+.string "0#z:"
+.data 1 , K , -5
+.string "		;:,0c	b"
+prn #K
+.data 1 , K , -5
+L7: .string "9;yb"
+L8: .string "#", "b,;"
+L9: .string "c9"y:y0yy"
+.string "a"	:z9#	xya1"
+L11: .string "c""0\q#", "zzy 1"
+mov L34, r2
+.string "\nbx\ry"
+L14: prn #K
+L15: .string ";x9", " ,zx""
+.string "#"
+L17: .string "#
+L18: .string ",11#\nbczxb0", ""
+L19: .string ",:9a9\r1\ny#"
+L20: mov L35, r2
+.string "	b0c9;"
+.string "	:\n
+L23: .string "	", "" xxybcbz	99"
+L24: .string "z:"", ";9c"::\t\n;."
+.string ""
+L26: .string "x,c.\"",00cz"
+.string ",	x;",0;"
+.string "\q;x1a,.c"#
+L29: prn #K
+.string " ": 	", "z	;		.x	 a"
+L31: .string "	c	0x0\r"
+.entry L2
+L33: .data 1 , K , -5
+L34: prn #K
+.data 1 , K , -5
+L36: mov L4, r2
+L37: .string ":\\\r
+L38: .string "	x	" ",0.	9	9:\ry"
+.string ".;xaz"0cy\ncb
+ hlt
@@ -0,0 +1,42 @@
+.define K = 3
+L0: .string ",	bc 9 0a:\\z"
+.entry L26
+.string " c"
+L3: .string ",c,9"cc\\"1z"
+L4: .string ":		b
+L5: .string "z#91:.9:" "	a11;"
+L6: .string "x00,1"z9, "
+mov L27, r2
+.string "	"
+.string "cz#\\.91	zx"
+L10: .string "	,"
+L11: .string "1," ""
+L12: .string ",0;"
+.string "".y,x.b:;#"
+.string "\".bc1;x,;9" "0z		y;	.,#"
+L15: .string " a1,z"
+L16: .data 1 , K , -5
+.entry L34
+L18: .string "z	 "
+L19: .string "9":ay9 ""#y", x"
+L20: .string ",b0..9\t9"
+.string "a 1: \t9"
+L22: .string " : a;x:91y" "09z	y"
+L23: .string "9b. c	##0x	"
+L24: .string "b\t#"" "\\b...":#1#x"
+L25: .string ":\tzx\qx1	\n0"
+L26: .string "y:", ""
+L27: .data 1 , K , -5
+L28: .data 1 , K , -5
+L29: .string "#x.", "z,"b;#0ab "
+L30: .string "z0#,0bxxa""
+L31: mov L5, r2
+.string "90:"
+L33: mov L5, r2
+.string "\tbc 		\\,b"
+L35: .data 1 , K , -5
+.string "., ";yc\"	0a
+L37: .string "1,a1\ty0"
+L38: .string ";\r.#. 	\n\qc"
+.string "b\n"
+ hlt
@@ -0,0 +1,42 @@
+.define K = 3
+L0: .string "ya"x:1"1"
+.string " ", "9 c9:;9;y\\  "
+L2: .string "11yxzx "9,."
+.string "a:z0;c\"czc"
+L4: .string "\"x"
+L5: mov L24, r2
+.string "acz."", "b"
+L7: .string "a1", "9"b"
+.string "\qcb9x\r,9" ". ;1##1#"  c"
+mov L37, r2
+.data 1 , K , -5
+.string "bz\\a9by\r", "bc0#a"
+L12: .string "9	0."\tab	z.1, ""
+.string ":"
+L14: .string ";#9"
+.string "c\\"1.,#b \q	1"
+.string "xxyc.0c"	 ;"
+L17: .string "	" "a;"
+L18: .string "xb	\r;yy" "a1z:"
+L19: .string "b , #z bz 00", ""
+.string "\r"
+L21: .string "1b .c9b0,y\n""
+.string "",ba9xb	zx:#", ""
+L23: prn #K
+.string "y"0"x	ab "b"0"
+prn #K
+L26: .string "011\\z, "	0a9 91\ra;,"
+L27: .string ",yb0, z"
+mov L19, r2
+L29: .string "##.;:\\#,	"
+L30: mov L3, r2
+L31: mov L0, r2
+L32: .string "acxz10	;"
+L33: .string ".	. y#z"
+L34: .data 1 , K , -5
+.data 1 , K , -5
+L36: .data 1 , K , -5
+.entry L25
+L38: .string ",b .##."
+L39: .string "b	 .,9ayx", "  ;;.b9bcczx"
+ hlt
@@ -0,0 +1,42 @@
+.define K = 3
+.data 1 , K , -5
+L1: .string "x# ay;9;; 9" "99b0"
+L2: .string " "
+mov L4, r2
+.string "1"
+.string "xb". z"
+L6: mov L15, r2
+L7: .string ",9cz c0z:b"c
+L8: .data 1 , K , -5
+.string ";y0":;0"
+L10: .data 1 , K , -5
+.string "#zy	a",#c.c9"
+L12: mov L37, r2
+L13: .string "\n9,.,;00""
+.entry L34
+L15: .string ".",c1 
+L16: .string "c"," "#  ,\\9"
+.string "z,"
+L18: mov L8, r2
+L19: .string "0,, 1#" "y	10z0b";9"
+L20: .string "y#	"
+L21: mov L27, r2
+L22: .string ""
+.string ";",#"." "a	x b"
+L24: .string ""
+.string ".\\0."
+.string "", "xz,:c"";bx"
+L27: .string "09;a0,;""
+L28: .string "\\#x:\t#a99"
+.data 1 , K , -5
+.string ".,x,;1y::\"bc", "	;y"
+L31: .string "x9ab;	"
+L32: .string "y zzzcz", "y"
+.string ""
+L34: .string ".c \t:z;b"
+L35: .string ",."
+L36: .string "9x0cz	.1\\	z"
+L37: .string ""y#y\r..y"
+mov L1, r2
+L39: .string "y"
+ hlt
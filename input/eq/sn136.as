@@ -0,0 +1,42 @@
+.define K = 3
+L0: .string ""0.yz"" ""
+L1: .string "9;:"ac9	a"
+.string "\r099.
+.data 1 , K , -5
+L4: prn #K
+L5: .data 1 , K , -5
+L6: .string " "11	,y\n"#cy
+.string ".##"
+L8: .string "y,:"
+.string ""b#"
+.string "\n,;a,"09"
+L11: .string ""
+.string "b.:	9x
+.string ";.0	b		#ca
+L14: .string "c	"#;\t\\0b\\x"
+.string "0;,	z"", "1	.1,c:##"
+.string "1c0
+L17: .string "0;\\#a0"
+.string "0c", "00#"z1zccx:"
+L19: .string ",xx"	axzx	" "c	,"; 1".a"
+prn #K
+.string "b 1b;", "10yb;"
+L22: .string "	
+.string ":.	,1	;:1"
+L24: .string " "
+L25: .string "0a#1"
+L26: .string "#a9za9x"9"
+.string ",1\na1	"
+L28: .string ";9xx"	xz0":"
+L29: .string "yy:.\\zz;"
+.data 1 , K , -5
+L31: .string "0;10,""
+L32: mov L22, r2
+.string "ay:xcb1\q1\n"
+mov L11, r2
+prn #K
+L36: .string ""
+.string "01\\
+L38: .string "b1	a9 ;a::"
+.string "9.1:bz,b
+ hlt
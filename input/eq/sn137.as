@@ -0,0 +1,42 @@
+.define K = 3
+L0: .string "1";"
+.string ":\\y.\""
+.data 1 , K , -5
+L3: .data 1 , K , -5
+L4: .string "":,"
+L5: .string ";"
+L6: .string "		,b1"
+L7: .string "a0,11	#y.1"9"
+.string ":	:\ny.xbyx" "zx ##0zx0:"
+.string "9:;bb;"
+L10: .string ",,:a", ",a#b0:	#byaz"
+L11: prn #K
+.string "	."
+.string ",; ,"
+.string ": :;" "a;:9,:9:1x9c"
+L15: .string "\\c	9xc1"
+L16: .string "09 :11#z\" "
+L17: mov L16, r2
+L18: mov L24, r2
+L19: .string "
+L20: .string ": x#c:#\""
+.string "1".ay\\"
+L22: .string "  x#9	:"", "0,bx\"\"ccy;bx"
+mov L4, r2
+L24: mov L14, r2
+L25: .data 1 , K , -5
+L26: .string "0b:	\".   ""
+prn #K
+L28: .string ",#,	xz1:"
+L29: .string "ba	 .b.\q\\0"\n"
+L30: .string "zzz,,\q
+.string "":"
+.string ",, \r, ::" "0y;"
+L33: .string ":#ab"
+L34: .string ";bby#0y..:by"
+.string "" "  a."
+L36: .string ";x\t:0"
+L37: .string "", ";zc"
+L38: .string "90#a0
+L39: .string "b;yb ," " 0"
+ hlt
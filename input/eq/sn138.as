@@ -0,0 +1,42 @@
+.define K = 3
+L0: .string " 0\r1zy#z,0c"
+.string "cy1y,a;1"
+.string "y :\n:\n:b\na", ""1bx:a,\t"
+prn #K
+.string "z0"
+L5: .string ",c9:: 1,\""", "9.:	#""
+L6: .string "1\n0c##x9	cz
+L7: mov L29, r2
+L8: .string ""	::,\ta	."
+L9: .string ""\\\t:	"
+L10: .string "c"
+.string "0c"
+L12: .string "c;,,"""
+.string "\t1xc\n
+L14: .string ",z"#c0."", "yc#:\"	yx	0"
+.string "x.#;;cc1x"
+.string "xy"
+L17: .string "x#c ,b"
+prn #K
+.string "9y00"yb" ""
+L20: .string "9a: :: x\",,."
+L21: .string ";"
+.string ";;0 :\q1#	a"
+.string "1,"\t:.c.c	,a"
+L24: .string ""
+.string "", "axb1cxx"
+.string ". 	ca1x";,c"
+L27: .string "z.,"a bcc\t\"," "z.ybx1 "
+L28: .data 1 , K , -5
+L29: .string " zz\qy\\0z"
+.string ",#;"
+.string ""
+L32: prn #K
+L33: .string "z"bb9."
+mov L15, r2
+L35: .string "#,bac"
+L36: .string ".z#cbz"
+L37: .string "c01	" 0,0b9" "xyzxc0x ; :b"
+L38: mov L10, r2
+L39: .string "\\:#.
+ hlt
@@ -0,0 +1,42 @@
+.define K = 3
+.string " 	a\r9;y9"
+.string ",\n" "	;cx	"
+.string "", "	b1\n
+L3: .string "::a ;\q"
+.string " 
+L5: .string "";x:0c0";a0
+L6: .string ";.	y,9	 bba"
+.entry L11
+.string "xb1"
+prn #K
+L10: .string ":9""b1", "#"zca	10	a#y"
+mov L13, r2
+L12: .data 1 , K , -5
+L13: .data 1 , K , -5
+L14: .string "	bz:y"
+.string "1"1.11", "yba:0xb\"z	zb
+L16: .string ";"x:;a90
+L17: .string "9:	z91a" ""
+L18: .string ",", "."
+.string "91"
+.string "yy.azc,", "#cc\\0\qca1b9"
+mov L38, r2
+L22: mov L20, r2
+L23: .string ":,y;a..9 bx#"
+L24: .string "x\ra9a00"bc:b"
+mov L27, r2
+L26: .string ";:z:# 1:,\t, "::a1"
+.string ",b;a0", ":0c"a1"
+L28: .string "c#x "
+.entry L16
+.string "\rz	,191
+.string ""##", "\q"
+mov L33, r2
+L33: mov L5, r2
+.string "" "		cb,xa1a:\r"
+L35: prn #K
+L36: mov L25, r2
+L37: .string "ba\t", "axy,z,,,\\"
+.string "a:zaa"
+L39: .string "z z"
+ hlt
@@ -0,0 +1,42 @@
+.define K = 3
+.string "\t99 c# #::"
+L1: .string ";9;\tz"
+L2: .data 1 , K , -5
+L3: .data 1 , K , -5
+L4: .string "::#
+.string ";"
+.string "09#0" \rx"
+L7: .string "a", "x\"c."z"
+L8: .string ".x9":1"
+L9: .data 1 , K , -5
+L10: .string "#a:." ";"9; \tb	"9x"
+L11: .string ""
+.string "9xby0"
+L13: .string "10"
+L14: .string ";b	z\q0;":1:	", ""b1.""
+.string "0b"
+L16: .string "y	:bx9;"
+L17: .string "y"
+L18: .string ";	b"
+.string "c;b	x
+.string "b"
+L21: .string " by:ya##"\n c, " \n	
+.string "xx::#"
+L23: mov L16, r2
+.string " 0\"#ac#,:.9.
+L25: mov L30, r2
+.string "1"
+.string "1"
+.string ""
+.data 1 , K , -5
+.data 1 , K , -5
+L31: .string "ccz;#0:x;"0"
+L32: .string "bz#y
+L33: prn #K
+L34: .string ""
+L35: .data 1 , K , -5
+L36: .data 1 , K , -5
+L37: .string "a0\ny1 :";z;1, ";,\\xab 9"
+.string "\q"
+L39: .string ":"
+ hlt
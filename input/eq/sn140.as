@@ -0,0 +1,42 @@
+.define K = 3
+L0: mov L17, r2
+.string "1a\t:: bz10"
+L2: .string "b		."
+.string "	yyz:x	"0,"
+L4: .string " "
+.string "	";"";
+.string ":;;9.0;#;z	z"
+L7: .string " y"
+L8: .string "9xa:10;,0	", "9,:."
+.string "y	y \q0", " "xxx:;ya"
+L10: .string "#z11: 	"
+mov L25, r2
+.string "z;0;\"	yy9,bx"
+L13: .string ":1"
+prn #K
+L15: .data 1 , K , -5
+.string ":	;xbc;y;\"	"
+L17: .data 1 , K , -5
+L18: .string ";:z"ca1;0\q#1" ";yzc9x  y#xz"
+mov L11, r2
+L20: .string ";#:,y	b"
+.entry L18
+L22: .string ".\r9,1"
+L23: .string ",\r 	;#.\r,", ";za	"	b"
+L24: .string ""
+L25: .string "00;c\n9a 1"
+L26: .string "a\".0\\c	x:.9"
+.string ",#"
+.string "#" "#	""
+L29: .string "zx:#xbca,:x. ",b,"
+.string "	,,#c9"
+L31: .data 1 , K , -5
+.string "c #czy1"
+L33: .string "" "1;xba	a\""
+.string "\tc0;a,c0"
+L35: .string " "
+L36: .data 1 , K , -5
+.string "a\r cyc ;"
+mov L16, r2
+mov L29, r2
+ hlt
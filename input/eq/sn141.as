@@ -0,0 +1,42 @@
+.define K = 3
+L0: .string ""z#a9	a,.19\r" "	zz;;1	"
+L1: .string ".z\t;" "	"	#axa a,"
+.string ":;z#:\t" "b,,ca9a"
+.string "abc"x.	\"z;	"
+L4: .string ":0z, ;z9z "
+L5: .string " "
+L6: .string "zb0:#,aa:9	a"
+L7: .string ",#0 "
+L8: prn #K
+L9: .string "1:az"c9	zb", "  c,9	9y:	;"
+L10: .string ":zx\\a"
+mov L22, r2
+.string "00cz.x9 \t", "y0:cc:
+L13: prn #K
+.string "y"#	
+mov L12, r2
+L16: .string ";\q#c\"#"
+.string "9x""
+.string "yz"b:"
+.string "b.y01\\\r,z"
+L20: mov L22, r2
+.string "9z:	bbx	\ty1	", ";1z
+.string "\"y"
+L23: .string "9;c .##"
+L24: prn #K
+L25: .string "	:y0" ""
+.string "1a:  :"
+L27: mov L28, r2
+L28: .data 1 , K , -5
+.string ".x.,"9b ;9,
+L30: .string "\q1y"
+L31: .string ""
+.string ":,"xbb\n,"
+.string ";xxa
+L34: .string "yzy
+L35: .string "	;.9yz, "
+L36: prn #K
+mov L40, r2
+L38: mov L33, r2
+.data 1 , K , -5
+ hlt
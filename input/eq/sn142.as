@@ -0,0 +1,42 @@
+.define K = 3
+.string "z" ;;9b" "	0
+L1: .string "x,\r" """
+.data 1 , K , -5
+.string ""
+.string ",:x 9;aa1\t,"
+L5: .string " yza
+.string "b11"
+L7: .string ",0;\tzca"
+L8: .string ". "b"c "byxbc#\"0y,0""
+L9: .data 1 , K , -5
+L10: .string "999"
+L11: .string "" ""
+.string ".#c"
+.string ""
+.string ": 11#1	xz"
+.data 1 , K , -5
+.string "c;
+L17: .string ":;a,#b;:"
+L18: .string ":,\""
+L19: .string "z.a" "1"9y#9zc	"
+.data 1 , K , -5
+.string "	1:.c	y"
+L22: .string "", ",:	,;y"
+L23: .string "1x"
+L24: mov L16, r2
+L25: .string ";"x0b19y ,"
+L26: .string "cyx9	0#c#"
+.data 1 , K , -5
+L28: .string "ba		1:z#:ayz"
+L29: .string "0\rbz\nx.c	y"
+L30: .string ";a\q#c;a\r"
+L31: prn #K
+.string "\tyyyay"bx"
+mov L6, r2
+L34: .string ":: .acx1"
+.string " y#a:;1.9"#"
+L36: .string "yx#bc0	b\"", "	,ab;\nc,";.1
+L37: .string "1\\b bb"
+L38: .data 1 , K , -5
+L39: .string ".
+ hlt
@@ -0,0 +1,42 @@
+.define K = 3
+.string "", "1c"
+L1: .string "c .x9":x  ;#"
+L2: .string "0	"01"
+.string "0;99:;y	\"cxy" ""
+L4: .string ";a ba#"a\\"
+L5: mov L28, r2
+L6: .string "	""ac91#ay,c"
+L7: .string ".", " 	c"
+L8: mov L21, r2
+.entry L6
+L10: mov L32, r2
+mov L34, r2
+prn #K
+L13: .data 1 , K , -5
+L14: .string "9, 0:,x"
+L15: mov L5, r2
+.entry L33
+L17: .string " "0;c ,bz"1:" ";\"9#1#.x;"
+L18: .string "b\n:xz."
+L19: .data 1 , K , -5
+mov L39, r2
+.entry L2
+L22: .string "0."
+L23: .string "z" "ccb ba.0\tyy;"
+mov L36, r2
+.string "c1010"1."
+L26: .string "" ,b ;xzayy,"
+L27: .string ", x."
+.string "c"	:"
+.entry L38
+.string ":\\\"zy9,cx;" ":;.z,0#c	0;
+L31: prn #K
+.string "19by.;1.9c	", "\";"
+.string ""09#:#
+.string "#19;"
+L35: mov L28, r2
+.string ",0z.0x\\#" ""
+.string ":"
+.entry L6
+L39: .data 1 , K , -5
+ hlt
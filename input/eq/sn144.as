@@ -0,0 +1,42 @@
+.define K = 3
+L0: .string "z:c."1#y1.b"
+.string "19b:", ";01.c#.0"
+L2: .data 1 , K , -5
+L3: .string ":b,99	;"
+.string "a,:z0:."
+L5: .string "y\"	#\\xb;" "b9y0	;	zb9.#
+L6: .string "#\tx"	"
+L7: .string ""
+.string "\tc cc# #za	:"
+L9: prn #K
+L10: .string ",	110"
+L11: .string "c"
+.string "\"a#y"
+L13: .data 1 , K , -5
+L14: prn #K
+.string "1zc"0\tc.x"
+.string ":1"x;;	xbyb"
+.string "1z"
+L18: mov L21, r2
+.data 1 , K , -5
+L20: .string ".y cb;z9 x", "0x	x	"
+.string "\q:a0,0;b1bb:, "00#:#yc"
+L22: .string "y#,"
+L23: .string "#	#c#"
+.string ";by9.1, b." ",0xcca"
+L25: .string "#x:1	 19.9\\"
+L26: .string ".,	."za "
+.entry L38
+L28: .string ""
+L29: .string "	a	:cc01991y" "cy1z,	b0\\yz"
+.string "y#19:", "9	z:1"
+L31: mov L25, r2
+L32: .string ""x" "z,z"xay "
+.data 1 , K , -5
+mov L11, r2
+L35: .data 1 , K , -5
+L36: .string "	y\";,y" "x"";90#	xa","
+prn #K
+L38: .string "1	1c;" "1b\r,1b.9:"
+.entry L37
+ hlt
@@ -0,0 +1,42 @@
+.define K = 3
+.entry L33
+L1: .string ""\rx9z"
+L2: .string "999:z,a\\b
+L3: mov L3, r2
+L4: .string ".#	 .;:" ": "
+.string "9\n::1c1\\#.\r"
+mov L11, r2
+.string "9c.1bbaa;0"
+.string "x1,11#c.", "z:"
+.string "ya"	\\	ax"
+L10: .string "b#;0#:x,c	x1"
+L11: .string "1;x:"00""
+L12: .data 1 , K , -5
+.data 1 , K , -5
+L14: prn #K
+L15: .string "	1b\rc0,"
+L16: .string ""
+L17: .string "c9"
+L18: .string ""ax"
+L19: prn #K
+mov L4, r2
+L21: mov L9, r2
+L22: .string ";y#1;	"
+L23: .string "yb,9zc xzba "
+L24: mov L6, r2
+L25: .data 1 , K , -5
+L26: .string "c"a9bcyx,	ay
+L27: .string "bc9c .0 	z;"
+mov L6, r2
+L29: mov L17, r2
+L30: .string "y"
+.data 1 , K , -5
+L32: .string "0\rz1.," ".,"c,aa,.a 	"
+L33: mov L23, r2
+L34: .string "9b9b9" "
+.string ":	ba
+L36: .string ";yxyacc\t9:\r"
+L37: .data 1 , K , -5
+L38: .string "099,y.zb, ""
+L39: prn #K
+ hlt
@@ -0,0 +1,42 @@
+.define K = 3
+.string "cz c;b0. 	.y
+L1: .string "", "b:y#0#1
+L2: .string "##";"", ",x"
+L3: .string ""y.,a"
+L4: .string "y"
+.entry L38
+.string "	"xx c"."", "\"#b 1y."
+.string "0\t#;\t.9b0""
+L8: .string "bb"
+.string "#ay\tc01"
+.entry L10
+L11: .string ""
+.entry L26
+L13: .data 1 , K , -5
+L14: .string ""\\bx y	", "".1:y""
+L15: .string "1#;z;y	" ""
+L16: .string ".b"
+L17: mov L33, r2
+.string "0b00\n	x  \r0a", "x"
+L19: .string ".9:	":a" "z#yz\t::c9	\r
+.string "0b.""
+prn #K
+L22: .string ":\qc"
+L23: .string "	#bc;;x,z\"" "9;" cc"
+L24: .string "	""
+.string ""
+L26: .string "a\r	\".1\nxb", "0:"	,1\qz""
+L27: .string "1#9 0" "1b:;"
+L28: .data 1 , K , -5
+.data 1 , K , -5
+L30: .string "" bax b10c;"
+L31: .data 1 , K , -5
+L32: .string ":0;,x91a:, "b,c.cy"
+.string ":b	a90, "	b1.x1#yz10"
+L34: .string ""
+prn #K
+L36: .string "b#za  
+L37: .string "	1x;#", "\q0:"
+L38: .string "c	c:z
+mov L38, r2
+ hlt
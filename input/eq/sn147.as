@@ -0,0 +1,42 @@
+.define K = 3
+L0: .data 1 , K , -5
+L1: .string "z .#x#;", ";;,010"
+mov L8, r2
+L3: .string "0bz" ":"0\n"
+L4: .string "0"
+L5: .string ":;.b11x;# ";y	\\##a:b\":c"
+L6: .string "0	91;9 x"
+L7: .string "\q ", "1z:;b#"
+L8: .string "\"	 #:\\91 "
+L9: .string ":,"1
+L10: .string "." ",b,:.101.1.c"
+L11: .string "1.c"ya;"	"
+L12: .string "b,1.z" "."
+mov L13, r2
+L14: .string "0,;", "x;,9,:"
+L15: .string "	bb "b.#,1, "
+L16: .string ":b.b;"1ca	c,"
+.string "09	:..y"
+L18: .string ";:#9.c"
+L19: .data 1 , K , -5
+.data 1 , K , -5
+L21: .data 1 , K , -5
+.string "#:\",yy,#y
+L23: mov L25, r2
+L24: prn #K
+L25: .string ";c:100zx", "\q;x
+L26: .string ";x"1.:b;c:, "	\"9z"
+L27: .string "#za	cy,,"b9z
+L28: .string ":.,:;za;x#: "
+mov L4, r2
+L30: .string ".," ""
+L31: .string "	#.1
+L32: .string "c0;\qa9\"", "bc.0"
+.string ":.a;;y,	1."
+L34: .string ""bxb01x 9"
+.string "b,bc,;1"
+.string "9b#c9.9xb", "\q#b"
+L37: .string "cac\\; ;x.y"
+.string "a 	#1
+.string "9#.1x.1c", "\\b;1zc.1"
+ hlt
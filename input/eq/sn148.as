@@ -0,0 +1,42 @@
+.define K = 3
+.string "
+L1: .string "x0"c
+L2: .string "1.,.a:, a", "
+L3: .string "c91..#y:" "	,a.""
+.data 1 , K , -5
+.string "#1:9", "0	\r,9a"
+L6: .string ":0:.#9 ""
+L7: .string ""
+L8: mov L3, r2
+.string "c 1;cxa #"
+mov L9, r2
+L11: .string "
+L12: .string "yxzy"
+.string "c,c0.:0x
+.string ",;b1 zyb"
+L15: .string ":#"yc91xz;"
+L16: .string ""x;xy	az;y"
+L17: .string "#;czb9yy"xz:"
+.entry L18
+L19: .string "0#x	z1yy00 b"
+mov L30, r2
+L21: .string "yx	zaa\txa#0y"
+.string "baz1zacz, "bc9:z;a;"
+L23: .string "yy#9;11,y"
+.data 1 , K , -5
+mov L15, r2
+.string ""
+L27: .data 1 , K , -5
+.string ":c"
+.string "b  0za"
+L30: .string ",; "0	y\"ba "\r:."
+L31: mov L32, r2
+.string "bca"..c"\q9" "yc::	c"
+L33: .string "\n"
+L34: .string """ ",	#,"9""
+L35: .string "y,xa.z", ":9;ycz"
+.entry L25
+L37: .string "xz::#y.:"b"
+L38: .string "a.0\\a:";9"
+prn #K
+ hlt
@@ -0,0 +1,42 @@
+.define K = 3
+L0: .string "yb"
+L1: .string ""
+L2: prn #K
+L3: .string "b:"
+L4: .string ""y\ra"
+L5: .string "y;\r", "y;"
+prn #K
+L7: .string "\r"
+L8: .data 1 , K , -5
+mov L15, r2
+L10: mov L24, r2
+.string "1cbz91x"	\tx;
+L12: .data 1 , K , -5
+L13: .string ""
+L14: .data 1 , K , -5
+L15: mov L16, r2
+L16: .string "91:0
+prn #K
+L18: .string ",1aczx"
+.string "y a:"
+.entry L9
+L21: .string "00,:y 1:y .#, "zbz		:,b".c
+L22: mov L11, r2
+.string ""
+L24: .string "b1 \" ;;
+L25: .data 1 , K , -5
+L26: .string " "
+L27: .string "y #y"
+.data 1 , K , -5
+L29: .string "\t	 a:x#;y ", "; czz .:y"
+.string "\r  czz ", ",b	bb0:z"
+L31: .string "\r;,xa;y"
+L32: .data 1 , K , -5
+.string "0,z:"
+L34: .string "190"
+.string "x"
+.entry L27
+L37: .string ".	,:,y  "";##	a"
+.entry L13
+L39: .string " .0ab0a	#"", ";0b1
+ hlt
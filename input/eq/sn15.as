@@ -0,0 +1,42 @@
+.define K = 3
+L0: .string "bz1aby;1x,#", ":9;1
+L1: .string "1 \\1#"
+L2: .string ";#,#:c"a0y	z"
+mov L1, r2
+L4: .string "x"
+.string " :\tz	\rc1"
+.string "",#c9""
+L7: .data 1 , K , -5
+L8: .string "c cb#b9z""""
+.string "#1#9cab,:"
+.string "# 	a"
+.entry L0
+.entry L39
+L13: .string "91"
+L14: .string ","," "1,bz\q
+.string ",y,x,,", "	"x:axy#z"
+L16: .string ",;:1	\qx\q#z,# ".a9,y9;zb"
+L17: .string "xc9", "c#	z1,zb;."
+L18: mov L36, r2
+L19: .string "##z.c.9
+L20: .string "", "zba##a"
+.entry L16
+.string "\nz,#",
+L23: .string "1z	" "x:,,#9z9.x"
+L24: .data 1 , K , -5
+L25: .string "y#\ty"
+L26: .string "0:." ".":""
+L27: .string ":,,xy"
+.string "cz\q 901"9, "1"
+L29: .string "0		,xb9b1b"
+L30: .string ",,;.	:a"1"
+.string "yxbcb:"
+L32: .string "0	" "y"
+L33: .string "\n#\nya#"1" "z\":11.,"bx"
+L34: .string " ,x9y\n19#" " c\\1b""
+.string "x"
+L36: .data 1 , K , -5
+.entry L8
+L38: .string "" "b;.c",z;	b"
+.string ",z1:;#:;:c"
+ hlt
@@ -0,0 +1,42 @@
+.define K = 3
+prn #K
+L1: .string "yz.c , "
+L2: .string ":byy";c ";ya", "y09"#		a#z1b"
+.string "xa9b
+L4: .data 1 , K , -5
+.string "	"
+L6: .string ":cc;;z." ""
+L7: .string " ::;y0 ac.b"
+L8: .string "a;:z\n:"
+L9: prn #K
+L10: .string "1y9.z;;0;", "
+L11: .data 1 , K , -5
+.string ""
+L13: .string "z:xz\q9z y" z"
+L14: .string ",a"#cc:", "c.\rcc.,.:"
+L15: .string ",0a#0:yb"
+L16: prn #K
+L17: .string "1x;" ""
+L18: .string ".,"
+L19: mov L12, r2
+L20: .string "	0	"
+L21: .string "9.#\\,ab	", "b#,","
+L22: .string ". ;	c		"	b "
+L23: .string "c.1.c;,	c "
+.string ".	\r.,."
+L25: .string ""\qaz :;a,#b"
+.string ",:;yz#.9za;
+.data 1 , K , -5
+.data 1 , K , -5
+.string """
+.data 1 , K , -5
+.string "x zy"
+.string ""
+prn #K
+L34: .data 1 , K , -5
+.string ",c9a : :z;0"
+L36: .string """
+L37: .string "#.z, "y#b.a9 "
+.string ",;z:,#	.", ";,\"\q,	
+.string "1 " 	"
+ hlt
@@ -0,0 +1,42 @@
+.define K = 3
+L0: .string "1#a.91"
+L1: .string "y a19"
+.string "a## 1 ;9.c"
+.string " b ca\r1"y"
+L4: .string ""a"
+.entry L30
+L6: .data 1 , K , -5
+L7: prn #K
+.data 1 , K , -5
+mov L23, r2
+L10: .string ":,"\qc1,xc	"
+.string "b
+L12: mov L40, r2
+L13: .data 1 , K , -5
+L14: .string "xxy" "b:###9"
+L15: .string "9\\x0x.x x#"
+L16: prn #K
+.entry L27
+L18: .string ""z.0." "  xc "1"
+L19: .string "y"	cx,b#"
+.string ",	zx;: :"
+L21: .string ""
+L22: .string "0b9a:by	1"
+mov L34, r2
+.data 1 , K , -5
+mov L32, r2
+.string "\t"";y#zx0ac;"
+.string "y", "x1;0.czc#"
+L28: .string "z0.b;x:.9x"
+L29: .string ";.a;0c0 "b0.	,b"
+L30: .string ".1
+L31: .string "
+.data 1 , K , -5
+L33: .data 1 , K , -5
+.entry L12
+L35: .data 1 , K , -5
+L36: .data 1 , K , -5
+L37: .string "\"", ",c"
+L38: .string " .	cyb"
+.string ",c9: "a"
+ hlt
@@ -0,0 +1,42 @@
+.define K = 3
+.string " z	9x ":.9
+prn #K
+.data 1 , K , -5
+L3: .string "0y
+.string "0,	xc .c\\y" "\ra.;b;"
+L5: .string "
+L6: .string "\rb9"
+.string "		y9 ;,z"
+L8: .string ",ab;", "9"b0 9c"a\qy"
+mov L37, r2
+L10: prn #K
+.string "x0b	 ,,bz.", " 9:"c	c	11	9"
+L12: prn #K
+.entry L31
+L14: .string "#c#01",0;a
+L15: .string " "z	1,;"
+L16: .string ";#c\n\n0, "	z###\t		"#a"
+L17: .string ",,0b9x\q"
+L18: .string "0xa#"
+L19: mov L1, r2
+.entry L27
+.string "", "99;;	.:a"
+L22: .string "b ,,x,y	1" ", "1c. "
+L23: .string "y c.#\\\"y"
+L24: .string "" .c1"
+mov L27, r2
+L26: .string "\t 1"9\t;" ","
+.string "1zc c "
+L28: mov L9, r2
+L29: mov L20, r2
+L30: .string ".x, "9100	;.:9c :
+.data 1 , K , -5
+.string "b;":.9 #z"
+L33: .string "01:c#"
+L34: .string ""#"
+L35: .string ":1::",
+L36: .data 1 , K , -5
+.string ""a", ""xz"a9"
+L38: .string "
+L39: .string "9	 :"
+ hlt
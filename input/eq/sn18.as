@@ -0,0 +1,42 @@
+.define K = 3
+.string "10""z"
+L1: .string "x,\qz
+L2: .string "0;\t", ""0 9a,:1:	;\r"
+L3: .string " " "y"z00.y."
+.string "9	," "	"c"y"y"c1"
+L5: .string ":	\nyc"::z:.y" ";y,, y"
+.data 1 , K , -5
+.entry L10
+.data 1 , K , -5
+.entry L35
+L10: .string "a" "9.:"	".y1zz;"
+L11: .string ";"
+mov L33, r2
+L13: .string "z"
+.data 1 , K , -5
+L15: .string ";c;,c9;z:"
+L16: prn #K
+.string ".b9:" " z;"
+L18: .data 1 , K , -5
+.string "9	#\"c1c#,z"
+L20: mov L34, r2
+L21: .string "\\: #a\q00ac:;", "a901	y,ay"
+L22: mov L33, r2
+.string "z9.y"19""
+.data 1 , K , -5
+.string " a0\" ""
+.string "0.c", "a#"
+L27: .string """00#,9. y0"
+.data 1 , K , -5
+L29: .data 1 , K , -5
+.string "bcy"
+.string ";0"c
+.entry L21
+L33: .string "
+L34: .string "y;"
+L35: .string "	,
+.string "z, 	,,\",9 ;"
+L37: .string "	x9#y"
+L38: prn #K
+L39: .string ""y9"
+ hlt
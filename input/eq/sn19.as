@@ -0,0 +1,42 @@
+.define K = 3
+.data 1 , K , -5
+L1: .string ";\ry9x9" "x, a"
+L2: .string "x	#"
+mov L26, r2
+L4: .string ":# \t.1"
+L5: .string ":0y" "x	#a#"x"
+L6: prn #K
+L7: .string "a1"
+L8: .string "9y" #: z##"
+L9: .data 1 , K , -5
+.string ".x#c#\\az.9cc"
+.string "0"
+.entry L4
+.string "a:"
+.string ""
+.string "9\rb" "0c0 "
+L16: mov L20, r2
+prn #K
+.string " \r\"."b1yb#x" "9"
+.data 1 , K , -5
+L20: .string "x\\.b;"
+L21: .string ";b 99c1:bzz"
+L22: mov L38, r2
+.string ".by,1		b9" " x#"
+L24: .data 1 , K , -5
+L25: .string "x19y;#	1	# "
+L26: prn #K
+.string "y:\r";#b", ""
+L28: .data 1 , K , -5
+L29: .string "y	1y#z"c9:"
+.string ""
+prn #K
+L32: .string "\\9#.ayxz.a9"
+.string "1 zc	, ""
+.string "	"
+L35: .string "" ;,9y", "bb;zx,";9"
+L36: .string "0bz9:,a0	""
+.string "1zzz:z	"
+L38: .string ""\"", "c\\;0,\t0a"
+L39: .string ".#z	"
+ hlt
@@ -0,0 +1,42 @@
+.define K = 3
+.string "", "z 90b"
+L1: .string "\r	#\rba"
+.string "\t	z11a", "y\""
+L3: .string ".\r;;#z:" "\t"9"\";#
+L4: .string "#"1,z9" "
+mov L35, r2
+.string ". 0"\rc,a0 "b"
+L7: .string "x\t910b.bb;"
+L8: .string "c"
+L9: mov L16, r2
+.string "z\qa:b1yba;x"
+L11: .string "b9:y"1c,"
+.string "\":"
+.string "99.a	
+L14: .data 1 , K , -5
+L15: .string "1\qb11#c"
+.string ";9.9\nyb:.zx\q" "x"
+L17: mov L1, r2
+L18: .string "	:00" ".\nb.\"z
+L19: .data 1 , K , -5
+.string ";"
+L21: .string ", "xx 0a#"
+L22: .data 1 , K , -5
+.entry L0
+L24: .string "c1"0x;:#y;:
+L25: .string ",:0xa"b" "
+.string ""\\.""
+L27: .string "9	.cxc;"
+.string "c "by :1,#z\rx"
+.string "x,\t\rzz", "1:;y##a:z:\n"
+.string "";	,c1"
+.string "a,#\q#z"
+.string ":0x:	090"ya"
+L33: .string "z#0c;a"	c"
+.string "#9\\ac"
+.string ":9ybz":# ya "
+L36: .string ":#0 "y"	", "c9, "
+L37: .string ":\n\q0:\t\qc b", "	1\rbxx:
+L38: .string "#;z"#
+L39: .string "#09,zx1"0;z"
+ hlt
@@ -0,0 +1,42 @@
+.define K = 3
+.string "y9x,za..cxy,", "#.00,,,.c"
+L1: prn #K
+L2: .string ""
+L3: .string "  9zxa9111ba"
+L4: .data 1 , K , -5
+L5: .data 1 , K , -5
+mov L40, r2
+.string "z:
+.entry L37
+L9: .string "b\t.zzcx a"
+mov L25, r2
+L11: .string "bzx#	,acxc,9", " ba01\"aza\t
+.entry L6
+L13: .string "1x "
+L14: .string "#"
+.string ":x 0"
+.string "a"
+.entry L18
+.string "xc"0a\n	"
+L19: .string " xab"
+.string "c; #by:	::9"
+L21: mov L37, r2
+.entry L12
+.string ":0b;y
+L24: mov L7, r2
+L25: .string "ay;;"
+L26: .string "1::	 \" "
+mov L17, r2
+L28: .string "1"y;,	y	x9"
+L29: .string "	\q " "zyy9acz,91
+L30: .data 1 , K , -5
+L31: .string "c"b\n"
+.string "xy \".z##\\yz"
+L33: .string "#c 	x0"
+L34: prn #K
+.string " ."x;\tz	"
+L36: prn #K
+L37: .string "\qy\nz"
+L38: .string ".c	0" "##.bzzx" z"
+L39: .string "	"
+ hlt
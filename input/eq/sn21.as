@@ -0,0 +1,42 @@
+.define K = 3
+.string " "0"\t\"1aa;
+L1: .string "11b..#b,	"x;"
+L2: mov L1, r2
+L3: .string ":"yzb"
+L4: prn #K
+.string "cx	"	:0,y	. "
+L6: .string ":9acz"a"
+.string ",	x" ";,"
+L8: .string "z" ".;"
+L9: .string "1.za;"\\11z"
+L10: .string ""b b9 b.1z:"
+.string ""b"
+L12: .string ""a0;y;."" y", "ya:y
+L13: .string "1.9:yyyx:x"
+.data 1 , K , -5
+L15: .string "y 	,"
+.entry L11
+L17: .string "	b\qba:#c:z1"
+L18: .data 1 , K , -5
+L19: .string " \""x"
+L20: .string "\r \"0c"
+L21: .string ","
+.string "c#\"a#"\"::c"
+L23: .string "9:."
+L24: .string "1cb"z";"
+.entry L40
+.data 1 , K , -5
+mov L16, r2
+.string " :\qaz,"
+.entry L5
+L30: .string ":#xz" ",;0"
+L31: .string "y\t19", ":#"
+.string "z:9x00b;;a"
+L33: .string "#1a	yx " "a;zy."
+L34: .string "	11#ac"
+.entry L12
+L36: .string "	"",y9y;"
+L37: .data 1 , K , -5
+prn #K
+L39: .string ";9;"
+ hlt
@@ -0,0 +1,42 @@
+.define K = 3
+L0: .string "", "zx;c19b"
+.data 1 , K , -5
+.data 1 , K , -5
+L3: mov L1, r2
+L4: .string "zx\q" "b,,9z: \t9"
+L5: .data 1 , K , -5
+L6: .string ""
+L7: .string ":z ;:a"
+L8: .string "\\cc#;x" "b0\t:ax"
+L9: .string ";z,;0#"
+.string "0xb0.xy#bx" "y ""c;x9
+L11: .string "c,xz.9zbc0"
+L12: .string ""cza"
+L13: .string ":;x"
+.string "", "b00":b.#9"
+L15: .string "z"
+L16: .string "", "9b"a9a0#1"
+L17: .string "a:xz"
+.string ";9\r099\t;\\"", "0":,c:\tz"
+L19: .string "", "0	"
+L20: .string "ax\qbc", "z"
+L21: .string "\q	,,b1"
+L22: .data 1 , K , -5
+L23: .string ""
+.string "xx#,z"
+L25: .string ": "
+.string "b#9\"0"
+prn #K
+L28: .string "1yx	" "z\\c,0:y#.	b:"
+prn #K
+L30: .string "
+.string "c0"9yaz 	10,"
+.string ":#	.9011\r b1"
+L33: .string ";x1;.;yyb	\rx"
+.data 1 , K , -5
+L35: .string "\q9aaz"
+L36: prn #K
+L37: .string "x9", "zzc\q9#	"
+L38: .data 1 , K , -5
+L39: .string "bx;ca\".,.x"
+ hlt
@@ -0,0 +1,42 @@
+.define K = 3
+.string "a", ":\ry09#"
+.data 1 , K , -5
+.string ".a\q.;b0"
+.string "0;; ,c"z"" "zzz	,\tx"
+L4: .string "9,x; 	 #	"
+.string """
+.string "x:z#bb.:a" "a1b"
+.string "a:"0b", "	0# 0cx"
+.data 1 , K , -5
+L9: .string "." ""
+.string ".c"
+prn #K
+L12: .string " 		b x"
+.string ".1zc,		x1	""
+L14: .string ":ay:0", ""
+L15: .string "."
+.string "	z\" 9c1b
+.string "#. ,.; 9,z"
+.string "	9	9c:0
+L19: .string "x#x9#", ""
+.entry L36
+L21: .data 1 , K , -5
+L22: prn #K
+L23: .string "cz\\; czbxzay"
+.string " bbx,ay"
+L25: .string ",1	.;	"
+mov L19, r2
+.string "y;: b":;0	"
+L28: .string ""
+.string ".;1,b #z:"
+.string ".z#0.c#a" "9bb.:;
+mov L17, r2
+L32: mov L4, r2
+mov L29, r2
+L34: .string "." " x"
+mov L34, r2
+.data 1 , K , -5
+L37: mov L18, r2
+.string "	 ,a1	ycyx 9"
+L39: prn #K
+ hlt
@@ -0,0 +1,42 @@
+.define K = 3
+mov L11, r2
+L1: .string "cy"
+.string ""
+.entry L7
+L4: .string "# "c9z,
+.string "b0,,c x1y"
+.string "c"y"
+L7: .string "y"\r\t	1cy9"
+L8: .string " :c" "9z.,1
+.string ",##cbc,.:	""
+L10: .string "  ;"
+.string "a9	a.:: 9#:;"
+L12: mov L1, r2
+.string "1y"
+.entry L28
+.string "c"
+L16: .string ""bz, xzxy\n\\", "9##:"
+.string ",c", "zy"
+.string "y1x"
+mov L15, r2
+L20: .string "0:"", "#ybzz01a19 ""
+L21: mov L21, r2
+L22: .string "	 a1; 1"
+.string "\\,cc;##;#".1"
+L24: .string " 	c;00;yx\t\r;"
+L25: .string " y" "
+L26: .string ""
+mov L31, r2
+L28: .string ";xx"
+mov L14, r2
+L30: .string ".1, "":	b"
+L31: .string "1z	a9y	c\"\q1"
+prn #K
+L33: .string "a;", ""byz,9.0x1. 
+L34: mov L14, r2
+L35: .string "\"1"
+L36: .string "ay;.y\n;z.	 " "c0x."
+L37: .string "1
+.string ""xbx9..\\x", ".::zy x"aya"
+.string "b9cz :z", "9"
+ hlt
@@ -0,0 +1,42 @@
+.define K = 3
+.string ""
+.entry L2
+.entry L2
+L3: .string "x0\",z	;\\\n
+prn #K
+L5: .data 1 , K , -5
+.string "#cc:c\qyb	"
+L7: prn #K
+L8: .string ""\q"#b""
+L9: .string "#a"1.;
+L10: prn #K
+L11: .string "y1y;0z	\\; "
+L12: .string "#:;\n9."
+.string "1az9\n9bb\tb9z"
+L14: .string "y	;y9cc0	"
+.data 1 , K , -5
+.string ""
+.string "ccx "
+.string " 99bz" "b\ra cy"
+L19: .string "#;\n #, 
+L20: mov L4, r2
+.string ":\n"
+.entry L40
+.string "bc;xx	bx"bcc"
+.string ":9z:;	xbc \"	"
+L25: .string "#c1:zy\t ".0"
+.entry L8
+L27: .string "z."
+.string "0,9"
+prn #K
+L30: .string ";"b"
+L31: .data 1 , K , -5
+.string "ya;..9,bc
+L33: .string "9:a.ac,0"
+L34: .string "", "xx\rx\\".\tz"
+.entry L24
+L36: .string ";yx",9ab", "#	9;.	b\n"
+L37: .string "	,\q", "y,\r9"
+L38: .data 1 , K , -5
+L39: .string "0;ay.a1; x:"
+ hlt
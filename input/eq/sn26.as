@@ -0,0 +1,42 @@
+.define K = 3
+L0: mov L13, r2
+L1: .string ""b"
+L2: .data 1 , K , -5
+L3: .string ".0a1yy0":;1"
+.string "		x\n"
+.string ",..0b
+.string ".\tbxcy"
+L7: mov L26, r2
+L8: .string "	"
+L9: .string "#cb;x1"
+.string ";.;\\", "bbya\n"bzba."
+L11: .string "zxcb, ".	a9",	:ax"
+L12: .string "y\\:"
+L13: .string "cybay:1,c0"
+L14: .string "1a\qxxa0"
+L15: .string "b	"
+L16: .string ""
+L17: .string "0,z1b	a 9.0"
+L18: .string ",99 "b9"
+.entry L38
+L20: mov L18, r2
+L21: .string "\q.a,"
+L22: .string ""
+.string "" "cy:c;x":"0"
+L24: .string "x"c;#19yx 	1
+L25: .data 1 , K , -5
+L26: .string ""
+L27: .data 1 , K , -5
+L28: .string "#"0zc9c"
+.string "0bx91#xz;.#." "0xy	"
+.string "\"b y;"\r"
+.entry L36
+.data 1 , K , -5
+.string "aa;z;;1y\n\r.", "ya1\q""zy	x::"
+L34: .data 1 , K , -5
+L35: .string "0b#9z1yy;
+L36: .string "xz;;,:""
+L37: prn #K
+mov L18, r2
+.string "	9:9""; b;"
+ hlt
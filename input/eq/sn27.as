@@ -0,0 +1,42 @@
+.define K = 3
+.data 1 , K , -5
+L1: .string "9", "9;:z1
+L2: .string "c..b#;a"9y"
+.string "\tx: b\nz#y9	
+.string ""
+.string ".c ##;a;z"
+L6: .string "b\tz0"	c,"
+L7: .string " "
+.string "## \n" "0"		
+L9: .data 1 , K , -5
+.string "xb	."
+L11: .string "a01:0
+mov L4, r2
+.string "cc"
+L14: .string "x1;9a"z"
+.string " 0\t,b1"
+.data 1 , K , -5
+L17: .string "byx:
+L18: .string "	az#b\\b19	0x"
+.string ",\t:0z" "\t,:"
+L20: .string "byb"	c#xy"
+L21: .string ",\":,c";;" "" "1\q	11;x  z:""
+.string "\\"
+L23: mov L15, r2
+mov L7, r2
+L25: .string ".99	bzb#
+.string "	,yxa1a	9",a"
+L27: .string "xxzy"
+L28: .string "b;x"y,#,90" "0.\\	"
+.string ":,..zc"
+L30: .string "y ", ":,z9,cxc"z."
+L31: .string "" "9\q"
+L32: .string ""x"	.	::,,	1", "a#a."
+L33: .data 1 , K , -5
+.string ".	b\"90yy"
+.entry L31
+L36: .string "0c:z0"9", "#\\b""
+.string "x 9" "ybxx;#.		":1"
+L38: .data 1 , K , -5
+L39: .string ""b\n	"a"c9zz9"
+ hlt
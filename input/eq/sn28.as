@@ -0,0 +1,42 @@
+.define K = 3
+L0: .string "z1y#.00y:"
+.string "a.1", ",yz\"91
+L2: .string " 9c\"9x.z0;cb"
+L3: prn #K
+.string "\qz1z 0"
+.string "0b," ":x"y"\t	#.z."
+.entry L14
+L7: .string ".	9#y\"
+L8: .data 1 , K , -5
+L9: .data 1 , K , -5
+L10: .string "yx \"#cy0z"
+.entry L20
+L12: .string ":::c,1\r\r\n,x", " :#yc:"
+L13: .string "0ay"a#a1cx
+L14: .string "",,:"
+mov L22, r2
+.data 1 , K , -5
+L17: .string "xx;cc0z	"
+.string "\t1;:90:"
+L19: prn #K
+.string ";\t.,"
+.string ",:z"
+L22: .string ""a:ab\r\n" " "9.9x:c"zc# ,"
+L23: mov L29, r2
+L24: mov L16, r2
+L25: .data 1 , K , -5
+.entry L24
+L27: mov L13, r2
+L28: .string "00z99y1b 1\t1
+mov L24, r2
+mov L20, r2
+L31: mov L15, r2
+.string ";.a9"
+L33: .string "zb1 "1b1ay"
+.string "9xx	1x"
+L35: prn #K
+L36: .string ""
+.string "":9; "y9c,9ab"
+.string ".	"
+L39: prn #K
+ hlt
@@ -0,0 +1,42 @@
+.define K = 3
+L0: .string " c\r:.abx#" ";c",	.0#z1.."
+L1: .data 1 , K , -5
+L2: .string "\t."\t" " ":x;y9y,c	:"
+L3: .data 1 , K , -5
+.string ",0"
+.string ".	y.y 
+.string "b xa\nb\nyz#;", ""
+L7: .string "xzb"
+L8: .string "	1,"
+L9: prn #K
+.string ",1.b
+L11: .string " ."
+L12: .string "a,:yyz;"
+L13: .string ","
+L14: .string "1#z
+L15: .string "b#" "# bx 1,1"
+mov L12, r2
+L17: .string "ay;01"
+L18: .string ",,:# 0xz", "c9cx10yb9
+prn #K
+L20: mov L4, r2
+L21: .string ",.;x; x	;y\qz"
+L22: .string ".00"
+L23: .string ""
+L24: .string ",\r\"09", "101"
+.string "bx.ya9,: c1c"
+.string "zz:,
+L27: .string "yab\\z" "\q"
+L28: .string ",0x99ac,9c"
+L29: .data 1 , K , -5
+L30: .string "y#0,;10,0910" ";9"
+.string ""
+.string "x;"
+L33: .string " a .\"	\n."
+L34: mov L8, r2
+L35: .string "ab0	9\t1c	"
+.entry L5
+.string "0,c;1"
+.string "y:z
+.string ""99,;c,"
+ hlt
@@ -0,0 +1,42 @@
+.define K = 3
+L0: .string ""ca"9"
+.string "	":y1y\\a"
+.string "b a9":.:#
+L3: .string ""
+.string " .\\;	."
+.string ", "z,	x09 xc"
+L6: .data 1 , K , -5
+L7: .string "a "
+L8: .string "b:,	9\tb a"
+L9: .string ". 9" "
+L10: .string "::"
+.string "	x\r.1 .9\r" ""
+L12: .string "yb,#;;", ""aba
+L13: .string ",z;z,;9 :"
+prn #K
+L15: .data 1 , K , -5
+.string "1,z." "x"
+.string "#zc", "0#91xb\t,z9"
+L18: prn #K
+L19: .data 1 , K , -5
+L20: .string "#;. "
+.string "0a"
+prn #K
+L23: .string "1b#\r	,1c x1" "\t.ba"xz\r1a\"."
+L24: .string "9	", "b;10x	xz19ya"
+L25: .string "919\".b",abyb" ""
+.entry L32
+L27: .string ";"
+L28: .string "0,.x"
+.string "czb;#	:b.b;""
+.string "#a10	9"
+L31: .string "ya,;	9"
+.data 1 , K , -5
+mov L33, r2
+mov L20, r2
+L35: .string "a"y1:b\nx:" ""
+.entry L7
+.data 1 , K , -5
+L38: .string "cb\"1x	x	b	,z", "z1#"
+L39: mov L23, r2
+ hlt
@@ -0,0 +1,42 @@
+.define K = 3
+L0: .string "" "9b:"
+L1: .string "
+L2: .string "z, "\\;	c:a19."
+.data 1 , K , -5
+.entry L31
+L5: .string " 9\ny", "xa.\rz"
+.string "#,\rcax"""
+L7: .string "zzz\r.10";. "
+.string " "; \tz
+L9: .string "0x,	b	9:	b#" "";"
+L10: prn #K
+.entry L4
+L12: mov L1, r2
+L13: .string "ay.c:1 "
+mov L20, r2
+L15: .string "x;""zx1"
+L16: .string "xx:xzz\r"
+L17: .data 1 , K , -5
+mov L23, r2
+L19: .string ";y10yy#x1" "y0z .0 a"
+L20: .string "9x"9x."
+L21: .string "1"
+L22: .string "ayx", "9a	c;z\\,"#.c"
+L23: .string "acx,z a#;"
+L24: .string "\nx. 9x:z", ":"
+L25: .string ".cbz""
+.string ":z\qz\r1,9aacy"
+.string "1yyy1cx"
+.string "1b\n,\\x\t9z9x,"
+L29: .string "zb11y0;	0,\"", ""0 
+.string "ax#b1"""z " ".zyzca .:1"
+.entry L9
+L32: .string "#x" "9;z.c
+L33: .string "#,;y"
+L34: .string "bx"
+.string ",z#:	x"
+L36: .string ":"9.;:", " ,xx\\.aa	"c\\
+.string "xb;"
+L38: .string ",.a:,"".c", "cbc10xa.""
+.string "1c,\qx;:1\\0"
+ hlt
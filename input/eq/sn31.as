@@ -0,0 +1,42 @@
+.define K = 3
+L0: .string "ybyx	1"
+.string ""
+L2: .string "\\0cxa:,"
+L3: .string "00."
+.string ";y" ":ac\\00.;0,1""
+L5: .string "",0x z"
+.string "cz0a, ";x:  0x#0"
+.string "x9xx00,z"
+.entry L31
+L9: .data 1 , K , -5
+.entry L31
+L11: .data 1 , K , -5
+L12: .string ""a9"";1ax: "
+L13: .string "b00 z	#	\"", ":1\t# #,y"
+L14: .string " :z" "x.0y1: 0. "
+.string "bb"99	0.;0:"
+.string "0,;"
+L17: .string "c1", "9z.bc"y"
+L18: .string ""
+L19: .string " :1"
+.string ",x0a;	" "\r :"
+.string ".b11b.,9x	b,"
+.string "b "
+L23: .string "#	yca""#"
+mov L0, r2
+.string ",1zc#;b:,:0", ""
+L26: prn #K
+L27: mov L25, r2
+.string "\r.1	9c#by 0y"
+L29: .string ".,9#."
+L30: .string "zxx "
+L31: mov L5, r2
+L32: .string """;y."yb" ", 	b,"
+mov L14, r2
+L34: .string "z9y	 :#	,9cz" ""	"
+mov L27, r2
+L36: .string "\t;:"0","
+.string "y" z0x#";yc"
+L38: .string "cx", ""
+L39: .string ";"
+ hlt
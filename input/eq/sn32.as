@@ -0,0 +1,42 @@
+.define K = 3
+L0: .string "1"ab"
+.string "";a	y\n"0" "#c,"
+L2: .string "#a", ""
+L3: .string ""z	 cb 1 ,c"
+.string "c"az#z"
+L5: .string "9b	 y:b0b""
+.string """1,\"", "::;"
+L7: prn #K
+.data 1 , K , -5
+L9: .data 1 , K , -5
+L10: .string ""
+.string ",.
+L12: .string ".z; c
+.string "9"" ":cbza"
+L14: .string ",:1x:,0y" "b#aa#9a"
+L15: .string "\t
+.entry L4
+L17: .string "\nxz
+L18: .string ";\rza;"
+L19: .string "xc" "1:"b\t#900 "
+L20: .string ""
+.string "y0" ", "a"
+L22: mov L16, r2
+L23: .string "1a#yyb1.1ca", "c y :\\;"a"
+prn #K
+.string "y;;\n;:0xa;a
+L26: .string "# ." "x:;bc	a;.0"
+.string "	"
+.string "z"
+.string "y." ":zz y#	a"
+prn #K
+L31: .string "y;"y	.c;.x1"
+.string "	"
+L33: .string "9b1"
+.string "c#0ca9;"
+L35: .string "0c"b:#.b
+.string ",#", "#9;c b9
+L37: .data 1 , K , -5
+L38: .string "b b"
+L39: .string ""
+ hlt
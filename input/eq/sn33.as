@@ -0,0 +1,42 @@
+.define K = 3
+.string ""	\t\r ""# c . \\
+mov L27, r2
+L2: prn #K
+.string "xb,
+L4: .string ";"
+L5: .string ",a;\q"
+L6: .string "b"
+.data 1 , K , -5
+.entry L5
+L9: .string ""
+.string ":#";	# "ca"
+.string "1"
+L12: .string "z""bc " #9.\\9"":a:"
+L13: .string ", , ";."
+prn #K
+.entry L37
+L16: .data 1 , K , -5
+mov L0, r2
+L18: .string "cx00"
+L19: .data 1 , K , -5
+L20: .data 1 , K , -5
+L21: .string "ay.ac"
+L22: .string ""
+L23: .string "x,;c" aaa"
+L24: .data 1 , K , -5
+L25: .string ":"#90
+.string "xz.\t" "	##,1aa"
+L27: .string "91 a"#: 91b"
+L28: .string "x"
+.string ",1:b1y"
+L30: mov L4, r2
+L31: prn #K
+mov L27, r2
+.entry L18
+mov L40, r2
+L35: .string ":##:x;#z90b"
+L36: .string ".y"
+L37: .string ".y\n:x\\:a"
+mov L31, r2
+.string "		"
+ hlt
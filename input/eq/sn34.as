@@ -0,0 +1,42 @@
+.define K = 3
+L0: .string "a:; ".
+L1: .string "x9"
+L2: .string "cb;9	b:z"
+L3: .data 1 , K , -5
+L4: .string "zy:	.11x"
+mov L17, r2
+L6: .string "z:,"
+L7: .string ".#;y#9y", " c \n"
+.string " 	;#cc"
+L9: .string "z.,";9a9\"bz9"
+L10: .string "	#y9y#z;:y"
+L11: .string "9#"
+.entry L38
+.string "" "":zyc::
+.string "##0. #9	"
+L15: .string "\q x9ax#""	 "
+L16: .string ",", " ;b, z:\\bacx"
+L17: .data 1 , K , -5
+.string ".bz#"
+.data 1 , K , -5
+.entry L11
+.string ".;0,x#:z
+L22: mov L35, r2
+L23: .data 1 , K , -5
+L24: .data 1 , K , -5
+L25: .string " ;#z	 #9", ",;#1cby1"
+L26: .string "0	"z9yc"z9"
+.string ":x;"" "9\nx:0xzc; "
+mov L19, r2
+.string ""
+L30: .string "y\"y"
+L31: .string ",c: 	xxc y"
+L32: .string "b;9:ca0x	"
+.string "xxc";	, "1ac#9.\t.\t.0"
+.string "x.\t01",x"
+L35: .string ",.:,1b"
+L36: .string "9x:".\r0b;;
+.string "\r	,"0:"
+prn #K
+L39: .string ";1zy zy	:a
+ hlt
@@ -0,0 +1,42 @@
+.define K = 3
+.string ",y .9b\r;x;a ""
+.string ""ba1,"
+L2: .string ";c zcy	"
+.string "::b9#"
+mov L7, r2
+L5: .data 1 , K , -5
+L6: .string "#:a"
+L7: .string "zacxxzay"a#\t" " 	#:b:\q9"
+.string ""x;	"
+L9: .string ":a##x1;" "z#x1 x1.
+L10: .string "azx",\n\t	#1y"
+.string "	\\#0y#x#	0a
+.entry L36
+.string ";;b"
+L14: .string "xc:"
+L15: .string ".a;9ay"
+L16: .string " "
+L17: .string "	cy;\r	b0,
+mov L24, r2
+L19: mov L7, r2
+L20: .string "b" "1c: c;"
+L21: mov L31, r2
+L22: .string ";c"z"y;
+.string "b01" "a	z"
+.entry L18
+L25: mov L31, r2
+L26: mov L19, r2
+.string ";9zz y:00"
+L28: .string "zy"
+L29: .string "a"#"
+.string """
+.string "by"1"
+.data 1 , K , -5
+.string "c, "y; a0c01"
+L34: mov L38, r2
+L35: .string "a,#9zb#		":," "ca"."
+L36: .string "	:c1	 ;#
+L37: .string "0	0\\c" "y0yy	#z"
+.data 1 , K , -5
+L39: .string "\"19	:#. 0"
+ hlt
@@ -0,0 +1,42 @@
+.define K = 3
+.string " ca\qz19.;	9	"
+L1: .string ";:1:zx"
+L2: mov L18, r2
+.string "	za:""
+.entry L23
+prn #K
+.string "9b1\\\r#c1 0zz", ";.	"
+L7: .string "9cx#01;y"
+L8: .string "c"99 a	 	b", "c:x .:z"
+prn #K
+L10: .string "z
+.string "	#bz"
+L12: .data 1 , K , -5
+L13: .string ";y;; x"
+.string "cz\";za"
+L15: .data 1 , K , -5
+.string "yx#x"	\"aa\q", ":z:x"1"
+L17: prn #K
+L18: .string "zz:#:9\tc\\;a"
+L19: .string "" "y\q0x"
+L20: .string "ya1z"
+.string ":9\qa "
+L22: .string "#"
+mov L20, r2
+L24: .string "0,y	cy	
+L25: .string ":x:,z "	x#9"
+L26: .data 1 , K , -5
+.string "cc0"",;x\r ;"
+L28: .data 1 , K , -5
+.data 1 , K , -5
+L30: .string "1#x""y"
+.string "b1a;" "0:; xc c:"91"
+mov L8, r2
+L33: .string "xza":,9,;x;"
+L34: .string "\taby,aaa	.0"
+L35: .string """
+.string "a\qc;#99",0"
+L37: prn #K
+L38: .string "z,;;x	1a09\\
+L39: .data 1 , K , -5
+ hlt
@@ -0,0 +1,42 @@
+.define K = 3
+L0: .data 1 , K , -5
+.data 1 , K , -5
+L2: prn #K
+L3: .data 1 , K , -5
+L4: .string "# :.#ybc.c" ".;b\"0"
+L5: .string ";c1a,;\ta"
+.entry L19
+L7: .data 1 , K , -5
+.string "90"y", "b##x	a91c"
+L9: .string "y"
+L10: .string "\r"a"
+L11: .string "xz." "a;9cb1z:"
+L12: .string "b01#
+L13: mov L35, r2
+L14: .string "0 a9\n9#1"
+mov L13, r2
+.entry L7
+L17: prn #K
+L18: .string "	zc ,b"yb"
+L19: .string "c"zy;0zz1
+L20: prn #K
+prn #K
+L22: .string "
+L23: .string "z,"	c	c 1:1"
+L24: .string "9z\"a#	0 "1""
+.string "y"
+L26: .data 1 , K , -5
+L27: .string "y""
+L28: .string "b\q"
+.string "11" ;:"""
+L30: .data 1 , K , -5
+.string "\t,";	x\\cz"
+.string " y#11"
+L33: .data 1 , K , -5
+L34: mov L24, r2
+L35: .string "xc  "bb91b"9:;b"
+L36: .data 1 , K , -5
+L37: mov L10, r2
+L38: prn #K
+.string "\q90	".;\q;"
+ hlt
@@ -0,0 +1,42 @@
+.define K = 3
+L0: .data 1 , K , -5
+L1: mov L29, r2
+.string ";,"
+.string ":1c\\y.\t"
+L4: .string "\ny"x9xy#cx"
+L5: .string "." 9z.9"
+L6: .string "\q1 "
+.string "1;ca\q;
+L8: .string "y#czb	" ""
+L9: .string "90b,9ac#	0 9"
+L10: .string "1:bx\"c	#: a"
+L11: .string ""#,z0:x,9z"
+.string " cz ";"
+.string ""101;9"
+.entry L16
+.string "bb\\,9;9.x."
+.string "1z;\t#99", "xc;" 9"
+L17: .string "" "9xy"b"
+L18: .string "c	.1.bzzz;
+.data 1 , K , -5
+.string " ." "\q	#\n#\q9ya9
+.string "\n9"
+L22: mov L0, r2
+.string "c", ":y#x 0"
+L24: .string ":ca"
+L25: .string "z ", " \n,9"
+L26: prn #K
+L27: .string ""
+L28: .string ";ayy0y	b:\r"
+.string "" ".z"b"
+L30: prn #K
+L31: .string "yz,a	1, ""
+L32: mov L21, r2
+.data 1 , K , -5
+.string "x".1.cc"
+.string "\n\\b	,"" "bxyz.;;"
+L36: .string "	.aa "
+L37: .string "c :,z0\", "19;"yy"
+.string "xx1 0":1" "c\qb:zbaxb:#x
+L39: .data 1 , K , -5
+ hlt
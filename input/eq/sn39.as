@@ -0,0 +1,42 @@
+.define K = 3
+L0: .string "1:a"
+L1: .string "a "
+L2: prn #K
+L3: .string "x:\" 9c#.9,ab"
+.string ":, :;"y", "z"
+L5: .data 1 , K , -5
+mov L6, r2
+.string "\n.ba.a:"
+.string "1x	#0\t1y", "",\r0\tyzz;"
+L9: .string "c1bxxx#	#"
+L10: .string "z 	cc"
+L11: .string "z0:y"y,y0#0,"
+L12: .string "", "1#,a:\"c"
+.string ""
+L14: .data 1 , K , -5
+L15: .string "c"by\qb99c#b
+L16: .data 1 , K , -5
+.string ",x  "
+L18: .string ";"
+L19: .string "z9:a\na "0;" "y,;0#;;"
+L20: .string "aa."", "a"#0"."
+L21: .string "\qc;90", ";9	xcz\r0""
+L22: .string ":cac"0;,"
+.string ":"
+.string "1: ;,"c0"
+.string "1b,9	 by"
+.string ""1yb"	.b: #"
+L27: .string "az 	"
+L28: .string ""
+.string "", "	 9x1a9;"
+.string "9\n\q. ;;.y.b	", ";.c01cac	:1"
+.string "	, "	0b9
+L32: .string "x0.x19	1#\r0"
+.entry L32
+.string ""x"
+L35: .string "#" ":.9\\.b;;	99"
+.string ""
+.entry L15
+L38: .string "11 y9z	xx""
+L39: .string "", "9#\qa1:\ny"
+ hlt
@@ -0,0 +1,42 @@
+.define K = 3
+L0: .string ""ycca:"
+.string ""
+L2: .string "x9" ""
+prn #K
+L4: .string ";c,:\tz1"9c
+prn #K
+L6: prn #K
+.string "\t.. "
+L8: .string "bcb#9\"",y0c.
+L9: .data 1 , K , -5
+L10: .string ",	0,xb191"
+L11: .string "", "c ,a, ,y.c "
+.entry L16
+.string "a;b#z"
+prn #K
+L15: .string ".0x" ""
+.string "b	"1,bx\r." ""01"
+L17: .string "1.0"0bb"
+L18: .string ".9y"
+.entry L7
+L20: .string "b":c.0z, "", ",.\t9,:"c90"
+.entry L17
+L22: .data 1 , K , -5
+.string ""::0a0za9"
+prn #K
+.entry L12
+.string ""\\acbx"	
+L27: .data 1 , K , -5
+.string "a ;cc	#:"
+L29: .string "":xcx;\\.#c0 , ".x	z;zz"
+.string "	aza"
+L31: .string ""\n\t. ;1zab,	
+.string "\\#:y"
+.string "y.cyz" "0;cc:"
+L34: .string ",z aa", "c;xzz"cxz"1 
+.data 1 , K , -5
+L36: .string " ;1"
+L37: .string ":\\, #.a" "#	;::ay\n"
+.string " c9"1", "cy1c yb"
+mov L35, r2
+ hlt
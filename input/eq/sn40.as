@@ -0,0 +1,42 @@
+.define K = 3
+.string ""
+.data 1 , K , -5
+.string "#a\qy"
+.string ""
+L4: .data 1 , K , -5
+L5: .string "\n.b,,1y ", " #z0"
+L6: .string "ac#" "0"
+L7: .string ",# 	1cby:z"
+L8: mov L26, r2
+L9: .string "\t1#0zz 
+L10: .data 1 , K , -5
+.string ""
+L12: .string "..""
+L13: .string ":bzz a ;:." "b	\r"9	a\tb; "
+L14: .string "a a9xzza"
+mov L21, r2
+L16: .string "", " a"
+L17: .string "9"1#:,	
+L18: .string ""a0.;y:.b	0, ""
+.string ",x0	,.;a"
+L20: .string "z:" "c"
+L21: .string " "
+L22: .string ".1"
+L23: .string "b#	1#:\"x "
+L24: .data 1 , K , -5
+L25: .string ";.1bxc	"
+.string "" 1:z"0". "
+L27: .string ";".0,,:yx.c
+.string "0y,.x"
+L29: .string "#";0"" "0,#zb
+L30: .string "by		:\r:yz "
+L31: prn #K
+L32: .string "z9c:,c"
+L33: .string ",#z9xx;1#b:", "ay111#1	0b#"
+.entry L33
+L35: .string "#y"
+L36: .string "0;#			#
+L37: .string " "cc"
+.string "b.9#1c"b	#", " .\r"
+L39: .string "0" "x #.,xy"
+ hlt
@@ -0,0 +1,42 @@
+.define K = 3
+L0: .string ": "
+.string "a1a#yy,z9"
+L2: .data 1 , K , -5
+L3: mov L18, r2
+L4: prn #K
+mov L8, r2
+L6: .string "y" "b9"
+.data 1 , K , -5
+.string ""
+.string "a":1ac"
+.string "	9	aa#"
+L11: .string ""
+.data 1 , K , -5
+prn #K
+mov L26, r2
+.data 1 , K , -5
+L16: .data 1 , K , -5
+prn #K
+L18: .string "#.#c9	019:,"
+.data 1 , K , -5
+L20: .string "0"
+L21: .string "1c1	y","
+.string "0	":;9;"
+.string "y\"z.cb\q;0: " y9:"
+prn #K
+L25: .string ":"1x"
+L26: .string "" " "":b	a0."
+L27: .string ".a"
+.entry L9
+L29: .string "a19a	\q"
+L30: mov L20, r2
+.string "c	b0;z9" "#a x :c	,#;\t"
+L32: .string "z9zcca,"
+L33: .string "", "xay9\r;
+mov L33, r2
+L35: mov L16, r2
+.data 1 , K , -5
+L37: mov L10, r2
+L38: .string "", "b0,  9 9"
+L39: .string " y:		a;1;
+ hlt
@@ -0,0 +1,42 @@
+.define K = 3
+L0: .data 1 , K , -5
+L1: .string "x	c.bac01\"a"
+mov L26, r2
+L3: .string "az.,9y0,xc:x"
+L4: .string ""
+.string "c	 ;0c" " c1
+L6: .string "z;;09"
+L7: .data 1 , K , -5
+L8: .data 1 , K , -5
+L9: .string "	1,b"
+L10: .string "c0,0"
+.string "y9y1		9"
+L12: .string "1y\\cb
+L13: .string ".c::#\r	ax	"
+L14: mov L18, r2
+L15: .string "9\t\n \"0y;z	\n"
+L16: .string " 1b1c"
+L17: .string "	yy"	z9\".0	0"
+.string "#\\x11"
+L19: .string "1acb1cb,c"
+L20: .string "y"1".0xx"
+L21: .string "bxb:,x100	#"
+L22: .string "#"
+.entry L34
+prn #K
+.string "."", "bz:a:9
+L26: mov L35, r2
+L27: .data 1 , K , -5
+L28: .string ""
+.string "" "\"zb\nzcc"
+L30: .string "1bc.\r90,1"
+.string ",ca#xc	"
+.string "1"
+.string " \n	 xy9xx	y"
+.data 1 , K , -5
+.string "\\9bc"
+L36: prn #K
+L37: .string "z#	."
+.string "y	b;	y.yb ;
+mov L22, r2
+ hlt
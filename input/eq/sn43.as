@@ -0,0 +1,42 @@
+.define K = 3
+.string "#;"
+L1: mov L31, r2
+L2: .data 1 , K , -5
+.string ".:zbxx:y" ""y:\rz:cb"
+L4: .string " 9
+L5: .string "bx#,,\q#zy" ",b9;zc	x ";."
+.string ";", "y"
+.string "#byaxx"
+.string ",x	"9#,:cbc0"
+L9: .data 1 , K , -5
+L10: .string ".,:;bz	z0", ""
+L11: .string "0::", "\nxaa	\"\n"
+L12: .string ":y1ax1x.0:.x"
+L13: .string "	y	y"
+L14: .string ""9c""
+L15: .string "0"y # "# 	""
+.data 1 , K , -5
+L17: .string "yax" "c100\n9z"#."
+L18: .string ""yx,"
+.string "#, 01#z; .1"
+.string " y"
+L21: .string "\q09":\t9x\ry"
+L22: .string "xy\\b"
+L23: .string "	xa""c "
+L24: mov L5, r2
+L25: .data 1 , K , -5
+.string "ac9,b"
+L27: .string "" ",x."
+.string "x00"
+L29: mov L7, r2
+L30: .string "\q199:zz,""
+.string ",#;0#."
+.string "y#bzxc#c", "a"
+.string "\\1"a1,;x"
+.string "cx.bc0x		
+prn #K
+.string "; .	a"
+L37: mov L0, r2
+L38: .string "	 a;"
+.string " 9,c;b"
+ hlt
@@ -0,0 +1,42 @@
+.define K = 3
+L0: .string "z"
+L1: .string "axz\q ::,;"
+prn #K
+L3: .string "9
+.string "b;:x"
+L5: .string "1bb.", ",;"#	y1"#;b"
+.string "		 ;0:x;,"
+.string "b"xyza"
+.string "ca.9"
+.string "" "c\",	"
+L10: .string ": 	#c,"
+.string "#", "#c9y9"
+L12: .string "" ""c\r.y#9y"
+L13: .string ","yac "::\\11z"
+L14: mov L19, r2
+.string "yz0	acxx:"
+.string "y9zc,	"
+.string "ab0x"
+L18: .string "z
+L19: .data 1 , K , -5
+L20: .string "9y 9:zz"z"
+L21: .string " #":", "9"
+L22: .string "z;b;1.. b9"
+L23: mov L14, r2
+L24: prn #K
+.string ",,#"ab z1,"
+L26: .string ""
+.string " "
+L28: .string "\n;c
+L29: .string "	,"x	,#1	"ab"
+.string "cx1	.	b:"\q
+L31: .string "x\t0x99"
+prn #K
+.string "	a,0.a"
+L34: .string "100,.,"
+L35: .string "#		9;"
+.string "x9 1 \t#ac0""
+.string ",z9" "c."	11	0"
+L38: .string ": ", ":;\n;9cbc
+L39: .string ":	";zaz9".b9" ""
+ hlt
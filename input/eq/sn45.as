@@ -0,0 +1,42 @@
+.define K = 3
+L0: .string " "
+L1: .string "x bc"
+mov L13, r2
+.string "c.ybbz", ",x.ca"
+L4: .string "\q	9b";0;ya1"
+L5: .data 1 , K , -5
+.string "#	"
+.string "a	\r, zza9"
+L8: .string ";9##0,91\q", ""
+.string "xz0cccy
+L10: mov L28, r2
+.entry L17
+L12: .string "z\nc,.1"
+L13: .string "\"a.b#b"
+.string "" "; ,#\q:b:#"
+L15: .string ":bc"
+L16: .data 1 , K , -5
+L17: .string "a.," "c.x	y1cay "
+.entry L40
+.string ",:9:1a0xx	b", ""
+L20: .string "\r99a.;y"	 " "z"
+.string "#xc\\;0\ry.x\\y"
+L22: .string "a;bx"
+.string "\q#;y;b," "0z	 b "\"z"
+L24: .data 1 , K , -5
+L25: .string ":"
+.string "xz.;", "##"
+.string ":y"x9x9c 9c" "
+.string "
+.string "1#.z\"9"
+L30: .data 1 , K , -5
+.string ""	xz#,;"
+L32: .string "0 1yyay#9"	"
+L33: .string "	"
+.entry L28
+L35: .string "1.\ty 9 ;a"
+L36: .string "#\n,0,\rc1"0" "#1 	z1zz""
+.string """#: \"..1
+L38: .string "		"b"1,"
+prn #K
+ hlt
@@ -0,0 +1,42 @@
+.define K = 3
+.entry L37
+.string "\t	bac,bay	 ",c:";y"#"
+.string "x.1,\\9yx;
+L3: .data 1 , K , -5
+L4: .string "0x1,c"
+L5: prn #K
+L6: .string "z	0c:x,zaz
+.string ""
+L8: mov L15, r2
+L9: .string "#zy:	9"
+.string ": "
+L11: .string "x:,"
+.data 1 , K , -5
+L13: .string "19:"  " "a,:"
+.string ""b, .	ac"
+L15: prn #K
+L16: .string "zaa	"
+L17: mov L14, r2
+L18: mov L23, r2
+L19: mov L9, r2
+L20: .string ""9"
+.string ",1"
+.string "c""	91.".
+L23: .string "c1.yyc.b,c0" "\n"
+L24: .string " .#y1, " ";0z;a
+.data 1 , K , -5
+prn #K
+.string "y"
+L28: .string "1z" ";xa"
+L29: .string ":\q :;,x,;"
+L30: .string "z", " ;:; cby,9:a"
+.data 1 , K , -5
+L32: .string ":\". " 9b:9b"
+L33: .string "bz  bb;.0b,,", ".;"
+L34: .string "\t1x,,\qz,"
+.entry L11
+.string ";		"\\"
+.string "1b" ";:	9x ""
+.string "x."xy1
+L39: prn #K
+ hlt
@@ -0,0 +1,42 @@
+.define K = 3
+L0: .string ",9\\:b.a
+.string ""	a,.11\";#1b"
+L2: mov L21, r2
+.string "by," ":\"9x1,0"x"
+.data 1 , K , -5
+.string "	9;"
+L6: .string ":9\tx0:"9	y#a
+.string "c" "	".;b9\q","
+L8: .string "zz"0yx" ";\\x9#ax.c;a9"
+L9: .string "0"\\aczy
+.string "1b:xac b	"
+.data 1 , K , -5
+L12: .string "c",	"
+L13: .string ""yc\n
+L14: .data 1 , K , -5
+.string "c "\n1;,z"
+.string "9	a	0 b" "":cx\q"	;"
+.string "cx\r"
+.string "c
+L19: mov L22, r2
+L20: .string "990 0# "##,b"
+L21: .string "\\9 x xz"
+.string "\r,	a:#	z"
+L23: .string "zc".b1#z:"
+L24: .string "a:"#;x"
+.string "	xz""#"
+L26: .string ".0,:c"
+L27: mov L6, r2
+.string ";
+.string "1\q0\r \"x	b"
+.string ""a:1	;"
+L31: .string "x1zcy\tzcc"
+L32: .string " 	1;c,"
+L33: .string "c,.\";"
+.string "."a0,b" "x#xx,."
+.string "z."\\\n10a	",y"
+L36: mov L38, r2
+.string "a9;0	0;;y0
+.data 1 , K , -5
+L39: prn #K
+ hlt
@@ -0,0 +1,42 @@
+.define K = 3
+L0: .string "	 \t.zyx"10\" ""0"
+L1: .string "zyb	 ,,x19"
+.string "y;.z"
+mov L38, r2
+L4: .string " "xx"
+L5: .string ",.xa;..,a:", "9y;0#1z1y"
+.string ".\":.a#\rbxaaa", ";c#\\x
+L7: .string "0c, "01;b:	.b9a"
+L8: .string "c1#,xb", "0x"
+L9: .string ".b"
+L10: .string "a9yxycx:" "#,#:  "0"
+L11: .data 1 , K , -5
+L12: .string "" ","
+L13: .string "z0,	y\"0bb#y"
+L14: .string "acb"
+L15: .string ""zxx c	
+.string "c	9z1"
+L17: .string ",;;0z"\n1
+L18: mov L19, r2
+.string "9"."
+.entry L16
+.string " "
+L22: .string ";.z9,z	:cb	"
+.string ".\t1  "
+.string ","c.b"
+L25: .string "	 .;;" ""
+prn #K
+.entry L29
+.string "10a:", "c"a;cz"
+.string ""
+L30: .string "x"9cb"\t#\qx,"
+.string "y"
+.string ""ax#a"
+.data 1 , K , -5
+L34: .string "9#c"c11991, ";y#aaxxc
+prn #K
+L36: .string "bzc
+mov L27, r2
+L38: .string "z"
+.string ".0b"0xa.y1#" ";	0:;:xx	c
+ hlt
@@ -0,0 +1,42 @@
+.define K = 3
+L0: .string ","
+L1: .string "" "y#b	"
+.entry L36
+L3: .string "yx.:,;9:b.	
+.string "9"
+L5: .string ",9. "":9	a	y"
+.string "cb;b", "c"0. "
+L7: .string "x"
+L8: .string "c"
+L9: .string "az;;xxz9"
+L10: .string ";\qy#x#y:a9\n,", ".\"	1a"
+L11: .string "	a.\r
+.string "
+L13: .string "z91z1  "bx."
+.string ".0\q990"#"
+.string ""
+.data 1 , K , -5
+.data 1 , K , -5
+L18: .string ","
+.string "b1;", "y"
+.entry L14
+L21: .string "1"
+L22: .string "0 	bz" #cc#"
+.string "yab\n z:xzz,", ""
+.string "91: b0"a"z ""
+L25: .string ":.x"
+L26: .string "a	bzc ,\n0\q", "c9	z":b
+L27: .data 1 , K , -5
+L28: .string "1	11", ":1a\q"
+mov L33, r2
+L30: .string ""
+L31: mov L22, r2
+L32: .data 1 , K , -5
+.data 1 , K , -5
+L34: .string "1 010	z	a	99"
+mov L8, r2
+L36: .string "\rc :	"
+L37: mov L28, r2
+.string "1 ,#	a	#  ", ",c.c,,"
+L39: .string "" ".;c9;"#x		"
+ hlt
@@ -0,0 +1,42 @@
+.define K = 3
+.data 1 , K , -5
+mov L33, r2
+L2: .string "bzx"
+.entry L6
+L4: .string ".9z ":zcy#yyaa00z
+.string "0z0: a;."
+L6: .string "a,c "
+.string """"
+.string "
+L9: .string ".;:a#bz0"
+.string ";\r\r#x; "
+L11: .string "\";y,9, "c , zcy 
+L12: .string "	:b1;9#.y"
+L13: .string ",0yy.xz", "b."
+.string "\\""
+L15: .string ":yx:	z"
+L16: .string "	\rc;b ;	"
+L17: .string " ,za"	9,9# \q"
+L18: .string ".;z#;
+L19: .string "0; " c.z\q. "
+mov L1, r2
+L21: .string "z1zb"1zby"
+L22: .string "b.#;:c01", "a;:9.
+L23: .data 1 , K , -5
+L24: .string "x 	\r, ";y.."
+L25: .data 1 , K , -5
+L26: .string ""0yc;a:x,"
+L27: .data 1 , K , -5
+.data 1 , K , -5
+L29: .string "" "
+.string "9 "
+L31: .string "" y""
+.data 1 , K , -5
+L33: .string ":a"
+L34: .string "b1"9y  " "\qxay  	"
+.data 1 , K , -5
+L36: .string "yba9	#x	0a"
+L37: prn #K
+.data 1 , K , -5
+.data 1 , K , -5
+ hlt
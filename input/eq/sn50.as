@@ -0,0 +1,42 @@
+.define K = 3
+L0: .string "1",c	,1	cy"
+L1: .string "0c,
+.entry L5
+.string ",.a1,9.x0#9, "#y90	x.x	"
+.entry L8
+.string "c;\ta"
+.string "	1zxy9:", "b\nc19"
+L7: .string ""c:x;b"
+L8: .string "a ,;	\\c z."
+.string "", "
+.string "az\n1 "
+L11: .string ";	y1a\""
+.data 1 , K , -5
+L13: .string " yx,:9\""
+L14: .string ""#9 " "19101 1b	"
+.string ":a 	xz.1":	
+L16: .string "z," ""
+L17: mov L29, r2
+.data 1 , K , -5
+prn #K
+L20: .string "
+.entry L6
+L22: mov L16, r2
+mov L10, r2
+L24: .string ""
+.string "ab:",."
+L26: .string "	\nx1y	a" " \q:	:\tyb\t::9"
+L27: .string ""yxc
+.data 1 , K , -5
+.string "."	a.0"
+.string ",b,1z1\r" ";1x\\.,\q,# "
+L31: .data 1 , K , -5
+.entry L25
+L33: mov L21, r2
+.string "b.,1xb"
+.data 1 , K , -5
+L36: .string "	"z9."90a ", ","
+mov L3, r2
+L38: .string " "
+mov L8, r2
+ hlt
@@ -0,0 +1,42 @@
+.define K = 3
+L0: .string "11"
+.string "#	\q,;:9:"
+L2: .string "9b"z; ;#"
+.string "a#z", "
+prn #K
+L5: prn #K
+.string "a..0;x"
+L7: .string "#"x\\a "b"\q	x\r	#"
+L8: .string "."
+.entry L30
+L10: .string "b,# 	#0	" " 9"y	.zx #a"
+L11: .string "	"
+mov L37, r2
+mov L28, r2
+L14: .string "9y:::,,:,	#."
+L15: .string "a "0.9b:	"
+L16: .string "a #c""
+.entry L22
+L18: prn #K
+mov L37, r2
+L20: prn #K
+L21: mov L6, r2
+.entry L0
+.data 1 , K , -5
+L24: mov L37, r2
+L25: .string "	..0"b##"
+L26: .string "\n0yc" "0#;1"1cc"
+L27: .string "0	1xz	" ""\na0a, "
+.string " xyazb",cx	"
+.string ",b#zba"
+.string ""
+L31: .string ""x."b
+prn #K
+L33: .string "zz""c. \n"
+L34: .string "1, #bb1"
+L35: .string "", "0z ;00.c:; "
+L36: .string ",x
+L37: .string ""
+.data 1 , K , -5
+L39: .string "..1,"
+ hlt
@@ -0,0 +1,42 @@
+.define K = 3
+L0: .string "\\;.byz.z;#a", "#a1czz"
+L1: .data 1 , K , -5
+L2: .string "
+.entry L36
+.string "	yy:\q"
+L5: .string ".."
+L6: .string "\\#yzxzcy0 0"
+L7: .string "0y\t#y1\q:\q0c"
+L8: prn #K
+L9: .data 1 , K , -5
+L10: .string "\tx"
+L11: .data 1 , K , -5
+L12: .data 1 , K , -5
+L13: .string "yyyc1,0;"
+L14: prn #K
+L15: mov L5, r2
+.entry L12
+L17: .string "; az:"
+.string ""
+.string ";.	""
+.string ""9x\nx"#0c9b" "\ta,\t"
+L21: .data 1 , K , -5
+L22: .string "bc"
+mov L16, r2
+mov L18, r2
+.string "#" ""
+L26: mov L21, r2
+.string "0azx".yz.,0c
+L28: .string "c"":1.x" " "
+.data 1 , K , -5
+.string ":.9z	"
+L31: mov L0, r2
+L32: mov L31, r2
+.entry L12
+.string ""		9"xx,.."
+L35: .string "#zzx .a#cx09"
+L36: .string "0xx" "by..\\zy:9"
+.string ",.b1 		ab,"
+L38: .string ":;:a"
+L39: .string ",:"
+ hlt
@@ -0,0 +1,42 @@
+.define K = 3
+.data 1 , K , -5
+.string "\r#abz;y9bzb"
+L2: .string ";\q
+L3: .string "" "c	"
+L4: .string "yb#"1;1ycbxb"
+L5: .string "1b:.", "0	"
+L6: .string "\\;z"
+L7: .data 1 , K , -5
+L8: .data 1 , K , -5
+L9: .string ":1#1 10""."
+L10: prn #K
+L11: .string ",.xa1c	"
+L12: .string "9",zz	;cb	:."
+.string "#"y:0;b1"
+L14: .string ",a,9c:bbb" "b"\t;\n:.a
+L15: .string ".0\q	b:9 " "	: 0"x"1.b\q:"
+.string ";1#.y1""
+L17: .string "1yz9,c,"
+L18: .string "cxbx\ra"
+L19: .string "0xc#:9z; zay"
+.string "9\qba"
+L21: .string "#:\q#:x;"
+.string "0",
+L23: .string "y"z#,:b;".0"
+.entry L24
+L25: .string "0\"
+L26: .string ",b"
+L27: mov L20, r2
+.entry L39
+.string ""
+.data 1 , K , -5
+L31: .data 1 , K , -5
+.string ""9,by9#a	z,y
+L33: .string "\qz 	yb..b", "y"
+L34: prn #K
+L35: .string "1b;\\x;\t	z"
+L36: .string " ": .,:c",0,
+L37: .data 1 , K , -5
+L38: prn #K
+.data 1 , K , -5
+ hlt
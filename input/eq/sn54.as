@@ -0,0 +1,42 @@
+.define K = 3
+L0: .string " "":1#,:, "0b"
+L1: .string ",\r.9	yx9 "b:a;9a1"
+.string ":1
+L3: .string "z#11a""
+prn #K
+L5: .string "	a"# "
+L6: .string ""
+L7: .string "";"
+.string "bx,::.:y.;,""
+mov L9, r2
+L10: .string "9y.,9y\"  x#x "xyz1	9y00"
+L11: .string ".9"
+.string "", "z #",#,c1b
+.string "x.#"
+L14: .string "1 ;b	1:a." ".acz	1:;"
+L15: .string "9x"
+.string "b,1c0#a9", ""
+.string "\t,#;z	..
+L18: .string "" " y0;\\b"
+L19: .string "9;,: "
+L20: .string ":z"
+.string "x:" "c"x	zcab;"
+.string "z.	,c 01 ", "c	b00"x"
+L23: prn #K
+L24: prn #K
+L25: .string "#01" ";,\\"
+L26: .string "z";:y1z""
+L27: .string "	 y 
+L28: mov L11, r2
+L29: .string "" " "90,1:xa##b1c"
+.entry L14
+L31: .string ".;bb1a#cx"
+L32: .string "ba 910b;.,"
+L33: .string "1z	z0,b10y#" " b#a"
+.entry L36
+.string "xxa	;a
+.entry L33
+prn #K
+L38: .string ""
+.string " , ",	,;:cx	c
+ hlt
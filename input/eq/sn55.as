@@ -0,0 +1,42 @@
+.define K = 3
+.string " c"
+L1: .string ""	::\\,.	b9b
+L2: .string "1b:1c\q." "0.z ,ax. ,;0"
+L3: .string "	z#0"
+.string ""x:c9b"
+L5: .data 1 , K , -5
+L6: .string "#""c"9"
+L7: .string "."z9b1;."
+.string ""
+L9: mov L20, r2
+L10: .string ":9"01z	0"
+L11: .data 1 , K , -5
+L12: .data 1 , K , -5
+L13: .string "\rz"0.x.0 , "\n1""
+.string ".a;"
+L15: .string ":,cby.ya"
+L16: .string "9;b	c.	1a\\cb" "a.\q19yy 	\q
+L17: .data 1 , K , -5
+L18: .string ""
+.string "b"
+L20: .string "zc", "#9ac:c	y":b,"
+L21: mov L4, r2
+.string "x"  0:azy ";"ay9"\q"
+.data 1 , K , -5
+.string "# 99" ";1xxy,a#:\"
+L25: .data 1 , K , -5
+mov L5, r2
+.string "" ""
+L28: mov L13, r2
+L29: .string ""	\r\n	"
+L30: mov L39, r2
+.string "  a:"
+mov L40, r2
+L33: .data 1 , K , -5
+L34: prn #K
+L35: .string ""
+L36: .string "y;# 1.:\r9"." "x\q 9x,"
+mov L10, r2
+.data 1 , K , -5
+L39: .string " ;\n
+ hlt
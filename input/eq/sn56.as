@@ -0,0 +1,42 @@
+.define K = 3
+L0: .string "\r	.1x;c", "0a0b
+L1: .string " "1zx0	0"
+L2: mov L4, r2
+L3: mov L11, r2
+L4: .string ";ab;aa\""
+.string ";0\\	"b0"
+L6: mov L0, r2
+L7: .string "#aya"
+L8: .string "\nb :1b\\	 0b."
+.string "y\qabb"9x\tb9y"
+.string "x:10x,y	y	x1", "x01 xc
+L11: .string "	 y	::"
+mov L28, r2
+L13: .string ";"
+L14: .string "y.;# 0	" ""
+L15: .string "91b.
+.string "x9b#1;aa"
+L17: .string "xz;.z",y	
+L18: .string "0y""x0"
+L19: .string ":,"c:,1 ""
+L20: .string "b	;x,	9" ";90z, y	1 0"
+L21: .data 1 , K , -5
+.string " 	azy,;"
+L23: .string "0bxc91"
+L24: .string "z..1	" "a	z\r"
+mov L37, r2
+L26: .string ""
+L27: .string "abcb yyz."
+.string "\n9 .cb0z#"
+.string "xaz0"
+L30: .string "\"y"
+.string "y\q99#"b"
+.data 1 , K , -5
+.string "a	"
+.entry L0
+L35: .data 1 , K , -5
+.data 1 , K , -5
+L37: .string "\r\n;1"
+L38: .string "acc1 a
+L39: .string "\t#	y9ayac", " 1#";" 09\q1"
+ hlt
@@ -0,0 +1,42 @@
+.define K = 3
+L0: .string ""
+L1: .string ":az\";:"
+.string ""	9yyy:	y"
+L3: .string ".;", "119:0.#a"
+.string ""
+.string "#	a a ;;;9a"
+L6: .string ".9za9.1ybx
+L7: .string "y1b	zaxz#	
+L8: .string "	:z.\\1:y", "b1yaa#xa90;,"
+L9: .string ",;:0.a
+.entry L7
+.string "ac9\nac"
+mov L40, r2
+L13: .string ";z1:aa	b:1  "
+mov L33, r2
+.entry L16
+L16: .string "yay", "	x
+L17: .string "	#9#,zx;010", "by"
+L18: .string "	 1\t,"1z1"
+mov L13, r2
+L20: .string ":. ;a::9x9" "9y#x,y"
+L21: .string "c ,0c	x"	.y"
+L22: .string "1	.", "9z\q9.b	,	"
+L23: .string ""y""
+.string ":bz1:9yz"1"
+L25: .string ";	#c "
+L26: mov L23, r2
+L27: .string "9a:cy"aa"
+L28: .string ",,\q x.		x" ""
+.string "zy"
+.string "xy" "z1 "
+L31: .string " y;c	\",:a"
+L32: .data 1 , K , -5
+.string "	:"
+.string " b ""
+L35: .data 1 , K , -5
+.entry L4
+mov L19, r2
+mov L25, r2
+.entry L20
+ hlt
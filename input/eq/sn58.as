@@ -0,0 +1,42 @@
+.define K = 3
+L0: .string "0b0#:; 9#." "xa"0"c#	:"
+.string "y bz  z1cz0#"
+.string ""
+.string "\q9,:y 9"
+.string "czc" ,#", ""ycyb\tb bb0"
+L5: .string ""
+L6: mov L31, r2
+prn #K
+L8: .string "cyy00"
+L9: .string ""y00abyb;.;""
+mov L33, r2
+.string ":#.c,x0:yxz:"
+.string "\\"
+L13: .string "
+L14: mov L3, r2
+L15: .string "x.a#"
+L16: mov L31, r2
+L17: .string "y1xxy"
+L18: .string "0# 	9;c:,ay
+L19: .string ",\t\t"11;1ya
+L20: .string "	y#zazy"
+.string "y" ",.\\:.x9a\n,"
+L22: .string "1:z \t"
+L23: .string "0#\n"
+L24: .string "	cz"y\\ :", "	aza:
+L25: .string "b;a	, "\r9"
+L26: .data 1 , K , -5
+L27: mov L14, r2
+L28: .string ":a"
+L29: prn #K
+.string "b"
+L31: mov L32, r2
+L32: .data 1 , K , -5
+.string "9;;z,z"
+L34: .string ":y "
+prn #K
+mov L30, r2
+mov L1, r2
+L38: .string "\\b#b;x0b:ac" "9,y1a;c#:0\n"
+L39: .string "bc9xx:1;"
+ hlt
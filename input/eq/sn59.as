@@ -0,0 +1,42 @@
+.define K = 3
+.string "ay aa":"
+L1: .string ",z, "xx;b, cb"
+.string "9"
+.data 1 , K , -5
+mov L21, r2
+.string "" " 	\t,\q: "
+.string ":#\r9;y	y"	"
+L7: .data 1 , K , -5
+L8: .string "\r\n;a,;:xa#" "1"
+L9: .string " ,
+L10: .string "x c "c"z11#" ","
+L11: .string ";", "b,9.,.a1a"
+L12: .string "z1yxcz		 "
+L13: mov L30, r2
+.data 1 , K , -5
+L15: .string ""a#"y1a0.z ";."
+L16: .string "z\"" "a9a"
+.string "x1:z:a	:1"
+.data 1 , K , -5
+L19: .string "91c9#x x0;"
+.string "y#b,z1c"" "a1\"\""x#:"c.
+mov L21, r2
+.string "\".1,"09" ""
+L23: .string "	a1. .y	b;z"
+L24: .data 1 , K , -5
+L25: .string ";yy  :.#"
+L26: .data 1 , K , -5
+L27: .string ":9.aaz\rzz 0", "#a;1	90: y.""
+L28: .data 1 , K , -5
+L29: .string "0" ""
+.data 1 , K , -5
+.string "0\n,0b"0; bx"
+L32: .string "." c
+L33: .string ""," "cy"
+.string "#:"xxa
+.data 1 , K , -5
+.string ","
+L37: .string "9by	aa"
+L38: .string "0y"
+.string "9x910	a	", """
+ hlt
@@ -0,0 +1,42 @@
+.define K = 3
+mov L31, r2
+L1: mov L9, r2
+L2: .data 1 , K , -5
+L3: mov L1, r2
+.string ".		x0	9c.,c"
+L5: .string "x0 xb0;"0\"\n"
+L6: .string "xc\q\tx"
+.string ""1y0\n0"
+L8: .string " ;:\\ y"bz."
+L9: .string "1c##:c\\", ".c09#"zaa	x"
+L10: prn #K
+L11: .string "9.."9"""" "" #,;z
+L12: .string "9,:"z 	a#, "ax"
+.string "b0y9a.\\"
+L14: .string "1,"
+L15: .data 1 , K , -5
+.string "ca	ycz9
+.entry L1
+L18: mov L12, r2
+L19: .string "##	9"c ; ;bc", "99"."
+.string "1	b"
+L21: .string "0.,czx:	y#""
+L22: .string ""
+L23: mov L9, r2
+.string "11y.z,1	a:0, "#a:\"y1	;"
+L25: .string "y:cbab"bx	x"
+L26: .string ".1 " "b"
+L27: .data 1 , K , -5
+.string ""
+.string ". 9#10	09a9"
+mov L21, r2
+L31: mov L38, r2
+L32: .data 1 , K , -5
+L33: .data 1 , K , -5
+L34: mov L21, r2
+.string ""
+L36: .string "a#9c91y"
+L37: .string ":.\q"99y b0" "z"
+.string "zxy:""\q	", "0:y#a,."
+L39: .string ";1a zc.1c0"
+ hlt
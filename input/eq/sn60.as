@@ -0,0 +1,42 @@
+.define K = 3
+L0: .string "1"#,
+.string "z"
+.string ""
+L3: mov L39, r2
+.data 1 , K , -5
+L5: .string "bx ya1 1	" "y90"
+.entry L7
+.string ":c\qxb" "ccz:,		::	z"
+L8: .string "\q"
+L9: .string "yx1.	c	."
+L10: .string "b"
+mov L13, r2
+.entry L26
+L13: prn #K
+L14: mov L0, r2
+.string "a,9"
+.string ",1		"
+L17: .string "bz:"
+.string "\nxy" ""
+L19: .data 1 , K , -5
+L20: prn #K
+L21: prn #K
+L22: .string ".	:		 a z;"
+L23: .string "zb:.y ", "b"
+.string "z"by,xazy0z#" "x1\qc	..1a9"
+L25: .string ".y"
+L26: .string "\t	 	cc"	0" "y."caxz 0"1:"
+.string "	"
+L28: .string ";;1	bz.: "",b	:c\q#	1"
+.string "	x9", ";bc0,,	y x"
+.string "00a#xz"0z0 " ""
+L31: .string "\n;	\r"
+L32: .string "#,a9bxx", ",,a#zcc	ac,,"
+.data 1 , K , -5
+L34: .string "\tc	y.zaay\qa"
+L35: .data 1 , K , -5
+L36: .string "\t"#z11;,a:	,"
+.string "9",b.bax\t	a0"
+.string "zc ,9:1,"
+L39: .string ";9"
+ hlt
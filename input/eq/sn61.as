@@ -0,0 +1,42 @@
+.define K = 3
+L0: .string ", ,a";;c:#,z"
+L1: .string "z"
+L2: .string ":  ,#,;z9.."
+L3: .string "a	:c a."
+.string "0x;,b""
+.entry L4
+L6: .string " ".a;0;z\\#"
+L7: .string "xa"
+L8: .string "#.,"c91zxz:#"
+.entry L37
+.string "yy;xyz"c.9"
+.string ":\nby\q,"0\tb"
+L12: .string "	9" y"
+L13: .string "y; zz9.xy\t"
+.string ";"
+L15: .string "0;#"
+.data 1 , K , -5
+L17: prn #K
+.string "b0c		\n	9", "za;,"
+L19: .string "a\rz 9,"
+L20: .data 1 , K , -5
+.string ""
+L22: .string ";
+.string ",00	"czc#,,z "c ac0z"
+.string ";a0	1"#x	ya"
+.entry L10
+L26: .string "y"\n ayx1 b"
+L27: mov L0, r2
+L28: .string "yaxca1a0 "y,#9\q9	1c0"
+.string "9xy
+.string "19;""
+L31: .string "x"9;z"
+.entry L1
+.string "09;1"
+.string "10x"#	91x:cb" " ,xc"
+.string "9:01cx
+.string ""#":"1", "cxz#	,"
+L37: .string ""
+L38: .string "0"
+L39: .string "y.x", "01.1"
+ hlt
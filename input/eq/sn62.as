@@ -0,0 +1,42 @@
+.define K = 3
+L0: .string "# ;", "za
+L1: .string "a", "a,z0c,	#"
+.data 1 , K , -5
+L3: .string "a  .190"
+L4: mov L37, r2
+L5: .string "x;"
+L6: .string ";z,"
+L7: .string ""a;	\nx "#x1\r,y.x99x
+.string ",b:c#9:", "zz	"
+L9: .string ".";ybaz c 1 "
+.string " x"\r:; \rz\q"
+L11: .string "#\n1;a."
+L12: mov L9, r2
+L13: .string "z.	\","
+.string ";19b9z\qa", "0a:"
+L15: .string "ay\q;9, "zx\t1x;	#:bz
+.string "#9:x" "9	\r10"
+L17: .string ";xz\tc"
+.data 1 , K , -5
+L19: .string "bz9", "0;	"\qa"	  ,y"
+L20: .string "	bc", ",:0a.,;00"
+L21: mov L0, r2
+.data 1 , K , -5
+L23: .string "" c\n"
+.string "x0900 "99\nc"
+.entry L0
+L26: .string ""
+.entry L22
+mov L34, r2
+L29: .string "	"
+.string "\\#z;#;xaac\r" "\q	y;	b,#\t"
+.string ","
+mov L22, r2
+L33: .string " c#c	:z":" ""
+L34: mov L27, r2
+mov L11, r2
+.string "9:"
+.string "x\\"za"
+.string "c c1;c1y
+L39: .string "yy	99"9\rc0
+ hlt
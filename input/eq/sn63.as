@@ -0,0 +1,42 @@
+.define K = 3
+L0: .string ""c:c"
+L1: .string " b1y,19abz"
+L2: .data 1 , K , -5
+L3: .data 1 , K , -5
+.string "
+.data 1 , K , -5
+L6: .string "a:", ""
+L7: .string "9
+mov L34, r2
+L9: .string ".#zb;0:,	"
+.string "y;yy b"
+L11: .string ": "
+L12: .string """ "a	:"c"
+.data 1 , K , -5
+.entry L10
+.string "z;;	"
+L16: .string ".#", "9.b";;.;"
+mov L25, r2
+L18: .string ",1z .cx
+L19: prn #K
+L20: .string "a	x:z "
+L21: .string "az#,.0	:.	z"
+.string "#9:0b\r9c,." "x.1""
+.string "\\9c1 ;" " "
+L24: prn #K
+L25: .string ""
+L26: .string "yaz" ""xc" ;  x"
+.data 1 , K , -5
+L28: .string ","
+L29: .string "xz, \t". ;.
+L30: .string ":y	.c "	
+.string ""
+.entry L2
+L33: .string "a"x	"
+L34: .string "" ".b"
+L35: .data 1 , K , -5
+mov L4, r2
+L37: .data 1 , K , -5
+L38: .data 1 , K , -5
+.string ".,.c#x\q", "xc0"0."
+ hlt
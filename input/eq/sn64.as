@@ -0,0 +1,42 @@
+.define K = 3
+.string "	a090y"
+L1: .string ""
+L2: .data 1 , K , -5
+L3: .string "
+L4: .string "a"
+L5: .string "y	.;\r;"\tba1"
+L6: .string "01a 
+L7: .string "11y"
+L8: .string ";z9yz bybxx
+L9: .string "	9."b"
+L10: .string ""
+L11: .data 1 , K , -5
+.entry L6
+L13: .string "y::;y,.a" "z:z\q"
+L14: .string " 9a.;"
+L15: .string ";"xb	\na\"x."
+L16: .string " ;
+.string "1y:c0"
+L18: .string ".y"a
+L19: .string "#,y0	0,9	z"" "a,"
+.string "0 "
+.string "a.9#
+.string ".9:az"
+L23: .string ""
+L24: .string "###a;:9" ""
+L25: .data 1 , K , -5
+L26: mov L28, r2
+L27: .string "	y	1:"
+.string "\q\t.b cb:"
+.string """"
+L30: mov L6, r2
+.string "#.y;	9cxa"
+L32: .string ""aax;#ya
+.data 1 , K , -5
+.string "
+.string "\t.zzc:"
+.string ""
+L37: .string ".:1zb	1"
+L38: .string "9yy0""
+.string "19	"x
+ hlt
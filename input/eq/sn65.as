@@ -0,0 +1,42 @@
+.define K = 3
+L0: .string "##\\"
+.string "c	#"
+.data 1 , K , -5
+L3: .string "yxy;;;11"
+.string "a,9,9az.c9	a"
+L5: prn #K
+L6: .string ".,11 	;0" "a c9 #zyy"
+L7: mov L25, r2
+.data 1 , K , -5
+.entry L36
+L10: .data 1 , K , -5
+.string " ",\q y", "acz\r	bz9"
+L12: prn #K
+.data 1 , K , -5
+.string ".y"
+.entry L32
+L16: .string "	"9111\":9"
+L17: .string ";9z:"
+mov L6, r2
+L19: .data 1 , K , -5
+.data 1 , K , -5
+L21: .string ".a" ";0b99bz""
+.entry L23
+.entry L16
+L24: .string "yxy", "y	""z"
+L25: .string "	cc"
+.string " bzc"
+.string "", ""
+.string " yay#0, "z	\tx.."9"
+L29: .string "xb9. a :\" 	"
+L30: .string "#"
+.string "0		c;	"
+.string ";"
+.string "zyc00:10y99"
+L34: .string "0,#z# xc;:
+L35: .string ",ab.z;a "
+L36: .string ""az\\y zy9x1c"
+L37: .string "y"
+mov L14, r2
+.string "b"bbz#""
+ hlt
@@ -0,0 +1,42 @@
+.define K = 3
+L0: .string "# 9
+L1: mov L31, r2
+L2: .string "c;z.#\n\n:y;aa"
+.data 1 , K , -5
+L4: .string " 0 c0,;"
+L5: .string "9ax;"."
+.string ".,";;0za, a"
+.entry L29
+.string "z ,x,b;xa:"
+L9: mov L11, r2
+L10: mov L27, r2
+L11: .string ":1cb"cz	";0"
+L12: prn #K
+L13: .string "z:z0y"
+.string ":", "	"
+.string "\":.1x,,  9a" ""\q;	x0"
+.data 1 , K , -5
+L17: .string "1	:0c.x  10	", ",z9y; c:"
+L18: .string "	:\\.c", "\"#b"
+L19: mov L20, r2
+.string "0.:c"c,"9 "
+L21: .string ","\ta a	\r9"
+.string "0 
+mov L35, r2
+prn #K
+L25: mov L38, r2
+L26: prn #K
+mov L2, r2
+.string "0ya", "01;"a"
+L29: .string ".x 	1 ##," "
+L30: .string ".y9	"1x#zba,"
+.string "::x,a\q x" "az"
+L32: .data 1 , K , -5
+mov L7, r2
+L34: .string "#", ","xyb""
+L35: .string ":;b\".0"
+L36: .string "y09"
+L37: .string ".ya,:9""z"
+L38: .string ";	cz,cz:9	a:"
+L39: .string ",:	a"
+ hlt
@@ -0,0 +1,42 @@
+.define K = 3
+.string ".9."90b"
+L1: .string "xx"
+.string "a:\qzy;\n#1"
+L3: .string ", ".	"
+.string "1ayaz"
+L5: mov L25, r2
+L6: .string ""y0\"a. 	x:c , "1ay\\"1"
+L7: .string "\q:\q;bx9c\q"
+.string " 1	b#	a9\" b1"
+L9: .string "\ryx;c;b"
+L10: .string "0", "	"
+.string "ax##"
+prn #K
+L13: .string "1:az,aa	z", ";"
+.entry L4
+L15: mov L3, r2
+.string "b.c#,."0	,"
+.string "\r#"
+L18: .string "baz1,.z		y\".
+L19: .string ";	9y  ";"b.0a#c"
+L20: .string ""
+L21: .string "9;,,		"
+L22: mov L25, r2
+L23: .string "0;0x	b#b", ""
+.string "ya9\r xa\r9" ""
+.data 1 , K , -5
+.entry L21
+.string "\"y	0"
+L28: .string " ", "a z"
+L29: mov L8, r2
+L30: .string "0:ba#0c0 aa\n", ""
+.string ";", ":"
+.string "
+.entry L38
+L34: .string "a;.1y" "1cz99"1z#"
+L35: .string "	#\r."
+L36: .data 1 , K , -5
+L37: .data 1 , K , -5
+.data 1 , K , -5
+L39: .string ";" ":1x#a0:y,09"
+ hlt
@@ -0,0 +1,42 @@
+.define K = 3
+mov L32, r2
+L1: .string ""9,#	;"
+.data 1 , K , -5
+L3: .string "x,bcz00"
+L4: prn #K
+L5: .string "	ay;yxa": "
+L6: .string "9"
+L7: .data 1 , K , -5
+L8: .string "1c, ";91":"
+L9: prn #K
+.string "aa\n#
+L11: .string "0;" xxc9z;a " ".	,;x9."
+L12: .string ".,1.";.x#9"", "x9,"
+L13: mov L36, r2
+L14: .data 1 , K , -5
+L15: .data 1 , K , -5
+.string " :cxc9"x;,x"
+L17: .data 1 , K , -5
+L18: mov L4, r2
+L19: .string ","yxy; "
+L20: .string " ca,z"
+L21: .string "\tb0" ""
+L22: .string "b"9x;c:a\r#\t""
+L23: .string " ,cc"c,z;y:y"
+L24: .string "0x#c0y1\r9	y#"
+.string "#zcac
+L26: .string "0"0azcyc"
+L27: .string " "
+L28: .string " x:acz0\t"
+.entry L5
+L30: .string "#\"	", "a\q#cbc""
+.string ":,"
+.entry L31
+L33: .string "c9a ""
+L34: .string "yyc;\t"
+.string "01;y#z0\n,0	,"
+L36: .string ":#yy	,9", "	.z1"
+.string "":cb:;9"
+L38: .string "1y#\\9byax0"
+.string "c.""
+ hlt
@@ -0,0 +1,42 @@
+.define K = 3
+L0: .data 1 , K , -5
+.string "	.#.#"
+L2: .string "y.:c. y"
+L3: .string "\txx:c9;bcx", "11"
+.entry L5
+mov L34, r2
+L6: .string "x" "9y""09	z:0"
+.string "c	;\""
+L8: .string "yx;"0a
+prn #K
+.string "9#yb x	\n""
+L11: .string "	,cx:z	cc "#y	"	,x::\r""
+prn #K
+L13: .string "cy90x 0;a"x"
+L14: .string ": 	 :9":" ""zby,0#;"
+L15: .string ",0"
+.string " ,y.91,"
+.string "#;"az
+.string "c", "" 
+L19: .string "xx#;\t1"
+L20: .string ""
+L21: .string "9\n,1#0x"
+L22: .string "9" "; #b;b9x"x"
+.data 1 , K , -5
+L24: mov L39, r2
+L25: .string "9aa.9#"
+L26: .string "9c
+L27: .string "z c;ca\",ac."
+.entry L10
+L29: .string "c ;	9cb1 .0", "x"# "
+L30: .string ":y:"
+mov L23, r2
+L32: prn #K
+L33: .string "b ;c1\"." "x"
+.string "	, a0:1ax0" "y1y\";"
+.data 1 , K , -5
+L36: mov L32, r2
+L37: .string ","\t1b#90\r", ",	,"
+L38: .string "0"\\0.:"
+L39: .string ":"
+ hlt
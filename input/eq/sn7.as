@@ -0,0 +1,42 @@
+.define K = 3
+L0: .string "bc	x;b\tbc."
+L1: .string ""
+L2: .string "b:b1b	y .y"
+L3: .string "zx0;x	cb0"" ",##; 1"
+L4: .data 1 , K , -5
+L5: .string "# cx\\" "y".bc"
+.string ",;"#c" ""cb "
+.string ":;a#", "x"b0 y1::
+L8: .string "	9y.	9"
+.string "1yczy1", ""
+L10: .string "" ";,y\"b#	:"
+L11: .string "b0c0#z"
+L12: .data 1 , K , -5
+L13: .string "ac0:y" ";"xx"
+L14: .string "y"
+L15: .string "z\n0\ry	a\rc9\r
+L16: .string "\r101:10\\"
+L17: .string ""90;"
+.string "c1x1"", ""a"
+.string "x:0"z.,c:#"
+.string "ya", "y";y		y"
+mov L6, r2
+.string "00a90 " ",9	.yb;#\\\t	y"
+L23: .string "ay"
+.string "b,\"	"x	b"
+.string "#	ac#,\"\t"
+L26: .string "\t\r	0#y."
+L27: .string ".c0"
+mov L9, r2
+.string "y9y#1", ":
+.string "z.\\"
+L31: .string ";a,	##a:,\" "
+.string "1xc99bz9y.9:"
+L33: .string ",c9bz.c9ac9", "c9x"
+L34: .string "yb\q1
+L35: .string "0 ", "0 #\qz9;a
+L36: .string "	0\\1#x.""
+.entry L19
+.data 1 , K , -5
+.string "y:;byac9.zb"
+ hlt
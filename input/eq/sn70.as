@@ -0,0 +1,42 @@
+.define K = 3
+L0: .string "#y,xy0.", ":c\r"
+.string "c"
+.string ""
+mov L31, r2
+prn #K
+L5: prn #K
+L6: .string "cb\\b y;x0y	c", "xy".9	"
+.string "9;czxc#bb09x" "b.yc# c0:,\t"
+.string "b\rbx	", "1,.1"c"
+prn #K
+L10: .data 1 , K , -5
+L11: .string "\t0yb"	#a\t:"."
+L12: .string "		;#z# 1 #\"\", "y#y,1
+.data 1 , K , -5
+L14: .string " y#bzbac0cxc"
+.string "9 a.#;" "a b"\\
+.entry L6
+L17: .string "1\t"
+L18: .string ":":#,x0y,	"
+L19: .string "a;. 9:" ""b	"
+.string "xz9;":, "9c,1 91:"
+L21: .string "b:b0x11"
+.string "	ax".yc"0ax"
+L23: .string ""
+mov L4, r2
+L25: .data 1 , K , -5
+L26: .data 1 , K , -5
+.string ";0#.", ""
+L28: .data 1 , K , -5
+.string "za:zb1"
+L30: .data 1 , K , -5
+.string "b#z\t;#\r#"
+.data 1 , K , -5
+L33: .string "19" "x:#b;"
+prn #K
+L35: mov L29, r2
+L36: .string ":0zx"
+prn #K
+L38: .string ".;axz\q\"
+.data 1 , K , -5
+ hlt
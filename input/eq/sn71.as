@@ -0,0 +1,42 @@
+.define K = 3
+.string ""
+.string "9c0"
+L2: .string "\r#y;zb;a:0y" "#xa1yy"
+L3: mov L19, r2
+L4: .string ":ac" " "
+.string "; x0 0z#""
+.string "9ab01",\" 19
+L7: .string "1yc0#9#", " :	,"
+.string " "0# \q a"
+L9: .string "y#	;""
+L10: .string "  	\ra9:,.9;
+L11: .string "c9"z".:"
+L12: .data 1 , K , -5
+L13: .data 1 , K , -5
+L14: .string "#1yz0#a;ya" "yy"
+.data 1 , K , -5
+L16: .string ""
+.string "9	,a9;90	#"
+.string " b91, "
+L19: .string ""c91\\0:	,"
+L20: .string "	 "	\".99c"
+L21: .string "	c1"
+.string "z\t", "1c0";0"bz"
+prn #K
+L24: .string "11#""
+L25: .string "0z1z z	,#.;\""
+.string "9,", "	 z  "
+L27: .string "c.	#"
+.string "a;0	b"#""
+L29: .string "1c#;b,"
+L30: .string ""
+L31: .string "y1;x"y"
+L32: .string "z9"
+L33: .string "c 0#\nxzc;\"" " ;\n#z
+.string "cb\nb1:a"
+.string "0"
+L36: .string "z;9:y 0:.zy"
+.string " ,"
+mov L29, r2
+L39: .string ",919;c.1cbb"
+ hlt
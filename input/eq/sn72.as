@@ -0,0 +1,42 @@
+.define K = 3
+L0: .string ";	"
+.string "y,1:ya1#a"
+L2: mov L20, r2
+mov L16, r2
+L4: .string ""1;"z"
+.string "y#0bb"
+L6: .string " b
+.string ""	:1x"	c"
+L8: .string " "
+L9: .data 1 , K , -5
+prn #K
+.string "x. ""
+.string ""
+.data 1 , K , -5
+L14: mov L28, r2
+L15: .string "0a\""y:x, "z9"
+L16: prn #K
+.entry L24
+prn #K
+L19: .string "\".;"
+L20: .string "a;cyx" "b"
+L21: .string ",;ab\tx09:cc", "1yax"
+.string "	,c	y#c1#x.", ".	\q . ;y
+L23: .string "9\\9y \q	"1"
+mov L4, r2
+L25: mov L20, r2
+.string "0c 	a9;
+.string ":.9
+.string "\qy\q:x#,"", "	y"
+L29: mov L6, r2
+.string "z:\n:"	byy	, "0;
+.entry L31
+L32: .string ""xxzac,#:.1	" "cy#9#x0y:#"
+.entry L10
+L34: .string "a0 "
+L35: .string "0a 	a"
+.string ""
+L37: .string "9:0"yx\\."
+.data 1 , K , -5
+mov L5, r2
+ hlt
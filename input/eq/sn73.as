@@ -0,0 +1,42 @@
+.define K = 3
+L0: .string "z# c":\"0#"
+.string ""
+L2: .string "zb90c#" " y1a0
+prn #K
+mov L15, r2
+.string "ccc0y	" ""	1; 0b"
+L6: prn #K
+.string ";"
+L8: .string "1x"
+L9: .string ".9.c"b" "x
+.entry L35
+.string "b1xb ", "y.a:ya0y\t:y"
+L12: prn #K
+L13: .data 1 , K , -5
+L14: .string "";y#.":z" ;\q"
+.string "\\"
+L16: mov L5, r2
+L17: .data 1 , K , -5
+L18: .string "#.ab0xb" "9"\q,xa\\;";aa"
+.string "#:z", "aa;x	.1x""
+.data 1 , K , -5
+L21: prn #K
+mov L21, r2
+.string "09b"
+.string "0y".90	ax1z"
+L25: .data 1 , K , -5
+L26: mov L27, r2
+L27: mov L39, r2
+L28: .string "	y:,9. "z1 a0:#.#zb"
+L29: .string ""
+L30: .string "a9, "
+.string " ,a,c"
+.string "ybz:.a9\""
+.string ""
+.string "1..ya" "\":9\"
+L35: .string "1..yx	" "	 0#xy:11 "
+L36: .string "	 y"\q
+L37: .string ",b\q.;:; 0";,"
+L38: .string "zz\t1,"
+L39: .string "#c1yy"az", ""c#\rxz"
+ hlt
@@ -0,0 +1,42 @@
+.define K = 3
+.entry L7
+.string "0;"
+L2: prn #K
+L3: .string "\"a\ny
+L4: .string ".199.a	0z"
+mov L21, r2
+L6: .string ":"
+L7: .string "zz.##:x1zb#"
+L8: .string "a 	 "
+L9: .string "0"
+L10: .string "1,cx"0"
+L11: prn #K
+.string ""c "c:b0"
+.string "y#y\r\r#	."
+L14: .data 1 , K , -5
+L15: .string "0:"
+L16: .string ":z"x1a,y0by"
+L17: .data 1 , K , -5
+.string "yaz1x:x	: ,;"
+L19: .string "cz "
+L20: prn #K
+.entry L13
+.string "	:#.b"9":#	"
+.string "xac;:"", "bxy"01"
+L24: .string "0,a"
+.entry L13
+.entry L3
+mov L25, r2
+.entry L27
+L29: .string "a9	xyx1x," "19:"
+L30: .string " 1 . ""
+.string "#y1za,9:"
+L32: .string "	;# ccy\q
+L33: .string "01	xcza	\\.0a"
+L34: prn #K
+.data 1 , K , -5
+.string "#0	99	a0 """
+L37: .string "y;b.0#z0"
+.string "0b0c,z#yx "
+L39: .string "\\c#;"
+ hlt
@@ -0,0 +1,42 @@
+.define K = 3
+L0: .string ""
+.string ";x,c99"" ";"9.a:	#0y"
+L2: .string "z#a bcb9,"
+L3: .string " ;\qx#  01:aa
+L4: .string "", "		#a9	,z;9.""
+L5: mov L23, r2
+L6: .string "x ::,", "",;.c;ya"
+mov L18, r2
+L8: prn #K
+L9: .string "1b.#,"0a", "c;yy9"
+L10: .string ":y"
+.string "0a	"
+L12: .data 1 , K , -5
+L13: .string ";y	"
+mov L13, r2
+L15: .string "c:"
+L16: .string "\n0"\r,z,\tb"
+L17: .string "z0z:x\r".0"
+L18: .string "y#190"
+L19: .string ":xxyc	b;b0z" "#"
+L20: .string ".9xa.#a"
+L21: .string "#0x\n b	1"
+mov L35, r2
+.data 1 , K , -5
+L24: .string ";zbx9azx0; 
+.string "xzy,:c.0 ;\"b "x"abzc.c;"
+.string " aa"
+L27: .string "zc",,,bbz c."
+L28: prn #K
+.string ",;1.\t,a.c"y"
+L30: .string "."
+.string "x1.0y91	0	", "
+prn #K
+.string "" yy#xa;" "y1190a9,#"
+L34: .string "yz;x::x9,z,#"
+L35: .string "c"
+L36: .string ""z0#,1"0"b\q"
+L37: .data 1 , K , -5
+L38: .string "\qb1#\t1a0 a#"
+.string "yb 9""
+ hlt
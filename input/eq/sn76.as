@@ -0,0 +1,42 @@
+.define K = 3
+.string " b."
+.string ""1c, 1,"
+.string ":1,	#ac:y"
+.data 1 , K , -5
+.string "x\naa0""z.#"
+L5: .string "":0#;.y	za"
+.string "yc\":::xyb
+.entry L14
+.string " #c\nb,,xx.
+L9: .string ".:"#,", "b :	b1,x1"0."
+L10: prn #K
+.string "\n0	"."\q" "."
+.data 1 , K , -5
+L13: .string " 0\""
+L14: mov L28, r2
+.data 1 , K , -5
+L16: .string "9z#",1y
+L17: .string "c. a:c91;z"
+.entry L0
+.data 1 , K , -5
+L20: .string ""
+L21: .string ";y	\"1	
+L22: .string ""
+.string """" "\q1yx, z9 #"
+.string ";,9,c. y9.c", "cbbccazc."
+prn #K
+.string ""y"\nyx\r ",b,,,1\"y	y	"
+mov L33, r2
+.string "xz1x:"
+.string "..	,1c\r,,"
+L30: .data 1 , K , -5
+.string "y:;	1 :
+L32: .string " c1b,x1" "":,	"a##\n"
+mov L20, r2
+L34: .string ",z\tz,"
+L35: prn #K
+L36: .string "z0"
+.entry L16
+.entry L3
+.string "\t\"9y x:a"
+ hlt
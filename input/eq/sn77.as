@@ -0,0 +1,42 @@
+.define K = 3
+L0: mov L15, r2
+.string ""	1y"
+L2: .data 1 , K , -5
+.string "z0\\z,,x"
+L4: mov L13, r2
+L5: .string "	#	"
+prn #K
+mov L5, r2
+L8: .string "	
+.string "x;\n:\t1":"
+L10: mov L2, r2
+.string ";.x9\""b"xy "
+L12: .string ".ab"y"
+L13: mov L0, r2
+.string "x:"xy19"
+L15: prn #K
+L16: .string "\\.""
+.string ". 	9 #0" "cbayacx"
+.data 1 , K , -5
+.string " #"	:0
+.data 1 , K , -5
+.string "\r"
+L22: .string ""\\\":9"
+L23: mov L19, r2
+L24: .string "y", "b0	b\nxy9z,b\q"
+L25: .string " c;#ab#y":	, "."
+.string "
+L27: .data 1 , K , -5
+L28: .string "	c" ":\qcz"0	,"
+L29: .string ":	0:x0"
+.data 1 , K , -5
+L31: .data 1 , K , -5
+L32: .string "\r09;1z;y", "#  "1x"c"
+L33: .string "..\"."
+.entry L28
+L35: prn #K
+.string "::
+.string "
+L38: .string "#ac:,;9x"
+L39: .string "zb"
+ hlt
@@ -0,0 +1,42 @@
+.define K = 3
+L0: prn #K
+.string ".by:", "":	"
+.string ".,.zz", ";b0x0"
+L3: .string "9z\q:c\nx#"
+.string ".0ya;,"
+L5: .string "\qb0:zaax" "yc 0##"
+L6: .string "0.", "xc0a ,1
+.entry L14
+.entry L5
+L9: .string "a"b,:1" "c"z	 #"
+L10: .string ""zy.;"
+L11: .string "c"		,#	,0y"
+.data 1 , K , -5
+L13: prn #K
+L14: .string ""		9\q\\.	0"
+L15: .string "y\t,.."
+L16: .data 1 , K , -5
+.string "\tzc  "
+.string " b#a	a1
+L19: .string "##"	y\"b1#;x", "b,0.0"
+L20: .string "":c\\\"y:" ""
+.string "	.,  y."
+.string ""	,ycca1 "" "
+.string "y;,	9#:x"
+.string ""b1;c .;.#;"
+L25: .string "\r" ".:#"
+L26: .data 1 , K , -5
+L27: .string "	100;byx:"
+.string "," "		.y.z;	zzz:"
+L29: prn #K
+.data 1 , K , -5
+L31: mov L25, r2
+.string "0c9 	"#	1	"
+.string ","
+L34: .string ""
+L35: .string ",#a0yx.c
+L36: .string "z9cc#9ax	:", "	""\\;9.aa"\r
+.string "y	1x"
+mov L25, r2
+L39: .string ""
+ hlt
@@ -0,0 +1,42 @@
+.define K = 3
+L0: .string "11"
+L1: .string ""
+L2: .string "z.";", ":"
+L3: mov L21, r2
+mov L5, r2
+L5: .string "x1z:9;1,#9", ""
+L6: mov L3, r2
+L7: .string "9,a\qz\"\qa	;a
+.string "a", "1:#"10;1		0"
+L9: mov L34, r2
+prn #K
+L11: prn #K
+L12: .string ""0xy .9#1" "991zxb9"ax
+L13: .string " ;,:	9 \r y,"
+L14: mov L14, r2
+.string "\r	y"#	" """
+.string "#:	 cyc.y;"
+.string "#\qc "0b,: "
+.string "#0,"
+L19: .data 1 , K , -5
+.entry L33
+L21: .string "1:zx;0;1.y	b"
+L22: .string ""
+.data 1 , K , -5
+L24: .string ".1,z,.	," "#,9	1c:y,a"z"
+.data 1 , K , -5
+.string "c1	#\n0"
+L27: mov L8, r2
+.string "x;x :	;;.9""
+.entry L20
+.string "b", "\n	"
+.string "#.",#,9x0:" "\r#yy"
+.data 1 , K , -5
+L33: .data 1 , K , -5
+L34: .data 1 , K , -5
+L35: .string " ,;;	", "9"
+.string "\\;cx"
+L37: .string "#c"
+L38: .string ""	1z"
+L39: .string "0by#;0#c:;0\\" ":\n"c	1b
+ hlt
@@ -0,0 +1,42 @@
+.define K = 3
+.string "0b"
+.string ":a#"
+L2: .string "c"1a9\\"
+.string "9xc::xb,1c", "\tyc	b"0y##"
+.string "zx"
+L5: .string ""\"0 y;\r\qc\q"
+.string ",19b"
+.string "z:xza0
+L8: .string ":,z.1y.#..cc"
+L9: .string "\""
+L10: prn #K
+mov L4, r2
+.string ":x ;,
+.string "bbz"
+L14: .string "0", ""y:xx#y"
+L15: .string ":;#1b0b" "0"
+mov L1, r2
+.data 1 , K , -5
+.string "\q0\t,\\\q0a  c" "1 c	.;"
+L19: mov L19, r2
+.data 1 , K , -5
+L21: mov L6, r2
+L22: .string " 0 ::\q;;."
+L23: prn #K
+L24: .string "9.x9 9\r"
+.entry L23
+L26: .string "#11\t;"xx"
+.data 1 , K , -5
+.string "ya09cx## cy;, "c,bcy;c1b,"
+mov L4, r2
+L30: .string ";.zz9:y.cx	" "z,0x
+.string "z	"
+L32: .string ""xcyy1,0"
+.string ""
+.string "..;"
+mov L11, r2
+.string "y9"\"\r0\\"
+prn #K
+L38: .string "
+L39: .string "ayacz#" ".x"
+ hlt
@@ -0,0 +1,42 @@
+.define K = 3
+L0: .string ".;;	:;a	:1b"
+L1: .string ""
+.data 1 , K , -5
+L3: .string "09"
+L4: .string ""
+L5: .string "a,"x1"
+L6: .string "" ",";a"
+L7: .string "xazb9;"a	c
+mov L8, r2
+L9: prn #K
+L10: .string "yxcy:9\r 		
+L11: .string "	,"
+L12: .string "a ;:.a1c;"
+L13: .string ";zx0"
+.string "x#"
+L15: .string ""zxx0b09,,c", "1,"
+L16: .string "#
+L17: .string "
+.string "0y  9,."
+.string "#1	zx;a	", ":#9"
+L20: .string ""1z, 9x""zz"
+L21: mov L6, r2
+.string "", "b1:., "
+L23: .string "x.1x\ryzx9\n"
+L24: .data 1 , K , -5
+L25: .string "cz;za"
+.string "0 ;xc1\rz:;", " 	"
+L27: .string ""
+L28: .string "y"
+L29: .string "x1ba  "
+L30: .string ",b;" ";x1yy"
+.entry L39
+.string " ;:y9zc:"
+L33: .string "xc;"
+.string "0 ,""
+L35: .string "xz\n#0b.1""
+L36: mov L24, r2
+L37: .string "",x,cz 0yy"
+L38: .string "00zy 	x"
+L39: .string ";;.:y1 z"
+ hlt
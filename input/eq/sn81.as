@@ -0,0 +1,42 @@
+.define K = 3
+L0: .string "	:"azy#a ";1 y"
+.string "	z,z:1#1#"
+.string "; ;9;x", " 9z1#x"
+.string ":ba:"
+.string ":1b;a1"
+L5: .string "b.0xa\q"
+L6: mov L12, r2
+L7: .string "a"\\\r09:9."
+L8: .string "b\nzc19b \t" "zc1: ;0
+L9: .string "\n : ""
+.string "09\"#y"
+L11: .string ".1#"x z"b"
+L12: .string "#1yx##"
+L13: .string "1;9z1
+L14: .string "1#	1\\\n9;za;,"
+L15: .string ""y.b"
+mov L4, r2
+.data 1 , K , -5
+L18: .string "y;\t99\t:b,:
+L19: .string "b	"
+L20: .string ""a9y::;.:#"
+.string ","
+L22: mov L38, r2
+L23: .data 1 , K , -5
+L24: .string " ""
+L25: .string ""
+L26: .string ""
+L27: .string "ba.#	a,.,#	", "..0cy	 ,cz,"
+.string "a;#:0		#a;"
+L29: .string "x\t1	a;", ";a\q"
+L30: mov L23, r2
+.string ""
+.entry L39
+.string "xyca0:a"
+.entry L39
+L35: .string ""x\t"
+.data 1 , K , -5
+L37: .data 1 , K , -5
+L38: mov L6, r2
+L39: .string ""
+ hlt
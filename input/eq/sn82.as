@@ -0,0 +1,42 @@
+.define K = 3
+L0: .string " zz9zb.""
+L1: .string "x""
+L2: .string "c"za1; "
+.string ".: :9a;"
+.string "b0a;", ",
+.string "a ;	0c"
+.string "\\"
+L7: .string "c.#::" ""
+L8: .data 1 , K , -5
+.string "\nb:"
+L10: .string ".\t;9z09#1:
+.string "," y	,z#:" 
+.string "09;\"bzy b,9"
+L13: .string "1:bax0"
+.entry L19
+mov L39, r2
+.entry L30
+L17: .string "9a."
+L18: mov L16, r2
+.string "x	\""
+L20: .string "0"
+.string ".0b0y,:a", "1"
+.string "xxc90.\t9;a9"
+L23: .string "", "azb,
+.string "1"
+L25: prn #K
+.data 1 , K , -5
+L27: .string "acx"
+L28: .string "c\q"
+mov L1, r2
+L30: .string ""
+.entry L19
+L32: .string ""z;0#"
+L33: .string ". ;1c"
+L34: .data 1 , K , -5
+.string "c1\\z"  #", ":bc0"a\q.z
+L36: .data 1 , K , -5
+L37: .string "	" "a"
+L38: prn #K
+L39: .string "1;
+ hlt
@@ -0,0 +1,42 @@
+.define K = 3
+.string "y"
+.string "z c"
+L2: .string "	0"1"
+L3: .string "", "#;:z	,"#,#1y
+mov L35, r2
+L5: .string ""
+prn #K
+.data 1 , K , -5
+L8: .string "y099x,"
+L9: .string "cz9#9,."z"
+L10: .string " a\\#:xb#"
+L11: mov L30, r2
+.string ":b.y#:c "
+L13: .string "b"
+L14: .string "\qb9b".xb	1."
+.data 1 , K , -5
+L16: mov L35, r2
+.entry L13
+L18: .string ".	1x,1;" "#;az\";""
+.string "y 	19"
+L20: .string "..b"
+.data 1 , K , -5
+L22: .string "z	ay0", "."
+L23: .string "	az0,b#z", ""
+L24: .data 1 , K , -5
+L25: prn #K
+.data 1 , K , -5
+L27: .string ":,9\qz0	"
+L28: mov L29, r2
+.string "";bb"
+mov L16, r2
+.string "" "a0"x#zb"\t\n\t\q"
+.data 1 , K , -5
+.string "x", "0\r	"	c,,# 9"
+L34: prn #K
+L35: .string ",#z1"
+L36: .string "1#x\n	:	c1bc1"
+L37: .string "1"xa:\"\tac\\1" "xc#""
+L38: .string "\r ,a\q0"
+.string "" ""	 	"
+ hlt
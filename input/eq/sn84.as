@@ -0,0 +1,42 @@
+.define K = 3
+mov L2, r2
+L1: .string ",0#"	;y	9\\"
+.entry L14
+.string ""
+L4: .string " 	xa10.y"
+L5: .string "x	c#	ay"ay	"
+L6: .string ",;", ""."
+.string ", "a"
+L8: .string "y"
+L9: .data 1 , K , -5
+L10: .data 1 , K , -5
+.string "xa ;, "	 c1:9,9\r"a"
+.entry L8
+.string ""1"
+L14: prn #K
+.string "y1
+L16: .string ""
+.entry L31
+L18: .string "0;;a#	a9x,"
+L19: .string ";;	xa#,#9\rx"
+L20: .string "z:"x#,	
+.data 1 , K , -5
+.data 1 , K , -5
+.string " bbacxx:\r"
+L24: .string ";#b.	1:,"
+L25: .string ""
+.string ":	,",", "x	a# x"
+.data 1 , K , -5
+L28: .string "19y
+.string ",y", " #	0" a9:"."
+.string ""9..91""
+.data 1 , K , -5
+mov L26, r2
+L33: .string "c\"."10#yc,\\"
+L34: .string ", "y;;.;c."
+.string "	\ta0	"
+L36: .string "cb\\,	by:#\t1	" "0 \\ac,0"
+mov L12, r2
+.entry L25
+.string " y	y.y909"
+ hlt
@@ -0,0 +1,42 @@
+.define K = 3
+.string ",
+L1: .string ";1:		1#.xa	c"
+L2: .data 1 , K , -5
+.string "1y.x;za:y\q", "
+L4: .string "zb9x.zz;.	z1"
+.data 1 , K , -5
+L6: .string "#xzb9,0
+prn #K
+.string "	yzyy ;9z	9b"
+.data 1 , K , -5
+L10: .string "\"	", "91.#,11." 1"
+L11: .data 1 , K , -5
+L12: .string "9#0z0",0,c "0,xbay.cb"
+.string "caazc9y"
+.string "y,, "x c "
+.string ",zx\ny#9x1x1"
+mov L30, r2
+L17: .data 1 , K , -5
+L18: .string "ac".:1."\"	y"
+.string "1,091"
+L20: prn #K
+.string ".y9y0	
+L22: .string ""z"cxcxz01 "
+.string ""
+L24: .string "a9a#" "9x"
+.string ";" :yc"
+L26: .string ",a#1	\";z9", "1	b\\:"
+L27: .string "#	zy1#1x;y1\q"
+.string ".9:01y x"
+L29: .string "b.a,,01"
+.string ";	;009"
+L31: .string "#:""
+L32: .string "\\:.#:"0 	 b0" "9 9y,	\na:,,"
+L33: .string ":a\r"ba#1"
+L34: .string "z#";yc#", ":"
+L35: .string """.a	"
+L36: .string "x1y1 \\;", " b1y\""
+L37: prn #K
+L38: .string "\"0a:,x11:;"
+L39: .string ";:aa0""
+ hlt
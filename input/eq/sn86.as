@@ -0,0 +1,42 @@
+.define K = 3
+L0: mov L20, r2
+mov L32, r2
+L2: mov L24, r2
+.string "."
+.string ";bz" """
+L5: .string ";..:00b"
+L6: .string ";;:..9z"\q#"
+.string "x:, "	a	"
+L8: prn #K
+.string " z,:"1\"\q"
+mov L21, r2
+.string "c,9a"
+L12: .string " 	.#"
+.string "zc."
+L14: .string "..919y"b\" :y"
+.string ";b:	baxc#9\q;" "z,"
+prn #K
+L17: .string "y1 \",	y\r1"y"
+.string "\"y:, "y":.1,1"
+L19: .string "	;", "c"x;:"9y1"
+.string "zy	#"
+L21: .string " ay#by", "	,\"y\ryzya:"
+L22: .string ".0"
+mov L21, r2
+L24: prn #K
+.entry L29
+L26: .string ",yc.b0x"
+mov L5, r2
+L28: prn #K
+.string "1:;1c ""a	b".#"
+.string ",:."
+L31: .string ":\r.
+L32: .string "z	"":#c	1 ;9"
+.data 1 , K , -5
+L34: .string "a\r;"y"
+.data 1 , K , -5
+.string ""01a\"b"
+.string "y :cc:0a0z."
+.entry L0
+L39: .data 1 , K , -5
+ hlt
@@ -0,0 +1,42 @@
+.define K = 3
+L0: .string "x9,	,x;a"
+mov L32, r2
+.data 1 , K , -5
+L3: mov L11, r2
+.data 1 , K , -5
+.string ".,#0;0"
+.data 1 , K , -5
+L7: .string "x ,a" ""bb	
+mov L19, r2
+L9: .string "9a	,y:", "11;1,0
+L10: .string ";01	. y.\t,
+.data 1 , K , -5
+L12: .string "ay\nb"0; 1", "b;.,b"
+L13: prn #K
+L14: .string " ;"zy "
+L15: .string ""9zx9x	#c;.
+mov L5, r2
+L17: .string ""
+L18: .string "0x;a# za.	x;"
+L19: .string ". 	a9z\n1:x"
+L20: .string "b0"yc"
+L21: .string ".a0"" "0c	#\"."
+.string "9x:9:", "\qa"\n#9 x	cy"
+.data 1 , K , -5
+L24: .string "z0"
+L25: .string ""x;.	"y"", "9"b"
+L26: .string ".ab0; , \r#", ";a"
+.data 1 , K , -5
+L28: .data 1 , K , -5
+L29: .string "	9\"0;x;c:.. "a"c:c1"
+.string "xxa  ax"
+.string ""b,:"x	.x19c"
+L32: .string "	\q.  1"
+.string "cc ##y	z0" ""
+mov L14, r2
+L35: .data 1 , K , -5
+L36: .string "1y	x: ;	;", ""
+L37: .string "c#"
+.entry L38
+L39: .string ",z1:b0y;y9ca"
+ hlt
@@ -0,0 +1,42 @@
+.define K = 3
+L0: .string "a\q"
+L1: .string "xyz"
+L2: .string "zx#,"
+L3: .string "1za, "\\\n":\\"\n"y:"
+.string "ayx	\n: ,0.;"
+.entry L36
+.string "z; .\","
+L7: .string "1.;bb,
+.string " c	b yb;	01a" "y:b\qy" "
+L9: .data 1 , K , -5
+L10: .data 1 , K , -5
+L11: .string "ab,z" "z"\q::1"
+L12: .data 1 , K , -5
+.string ";;#::	", "z 0;z "
+L14: .string ".0a,yazx#:"
+.string "y"10z z"
+L16: .data 1 , K , -5
+L17: .string ",	."
+.string ":.a \ty
+.string "y,b0\r.##.x1x"
+mov L15, r2
+L21: .string "  ,xz;\\0, c", "\qz:"
+L22: .string "a#  "
+L23: .string ""0,a;, "		,"
+L24: .string ";\q	z09b"
+L25: .data 1 , K , -5
+L26: .string " .;z"19," "1a"99;9c0c"
+L27: .data 1 , K , -5
+L28: .string "\n, "1z1#"#0"b
+.string "y:11c9"
+.string "zz.;",a0.""\r" ":#1aa\\z9:,"
+.data 1 , K , -5
+L32: .string "9" b,y.z#::"
+.string " 	by\t:b :", "1b "
+L34: prn #K
+L35: .string "1z\rzz1xxa", ",y1a."
+.string "c.a; 	z"a#"
+L37: .string "c"a9"
+L38: mov L14, r2
+mov L6, r2
+ hlt
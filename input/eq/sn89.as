@@ -0,0 +1,42 @@
+.define K = 3
+.string "y;cy"
+L1: .string ",cz#a1y#b	,
+L2: .string ":"
+mov L0, r2
+.string "1cy,a;	z"
+L5: prn #K
+L6: .string "",	\r0	\r\q1;.9" " 1;		b#y
+L7: .string "c	.0"
+.entry L3
+.data 1 , K , -5
+.string "#a\n#09:,b9x.", "x\q\\bcyy9a"
+L11: .string "bb"
+L12: .string "."#y"
+L13: .string "x."#\t0	z"
+.data 1 , K , -5
+L15: .string " ,y,.1" "9"
+L16: .string ","	b0.0zx:#"
+L17: .string "	0y
+.string "0;", "	"
+.data 1 , K , -5
+.string "99"
+L21: .string "zb,"
+mov L26, r2
+L23: .string "\q:100	;"
+.string ":9;.y	z" "	;#\nbxc:yab"
+L25: prn #K
+.string ":,;1,"
+L27: mov L36, r2
+L28: .string ", 9.b;,,b#9"
+L29: .string "bz;,:.0zaz"
+L30: .string "z	"
+.string "19,"
+L32: .string "9#xzy1"
+.entry L6
+.string " zz01ay"
+mov L17, r2
+L36: mov L8, r2
+.string ".zc"#c:"
+L38: .string "xbb90;"
+L39: mov L5, r2
+ hlt
@@ -0,0 +1,42 @@
+.define K = 3
+L0: .string "za"
+.string "	b:z#
+L2: .string ""
+.string "c:x 01.c9 "9,b0a."
+L4: .string ""
+mov L38, r2
+.string "0,a
+.string "c"	0.c:0"
+L8: .string "bb"
+.data 1 , K , -5
+mov L36, r2
+L11: .string ":1z\n;\"c;x;#", "a:,"
+L12: .string ",c  "
+L13: mov L35, r2
+L14: prn #K
+L15: mov L4, r2
+L16: .string ":\r	;y z9abz9
+.string "", "0: a; y"
+.string "	 xc.#y	:z9"
+.entry L6
+L20: .string "zc", "1a0z"#		:cz	"
+L21: .string "a.	 \"	c	 c", "yxx"#b"ba;1
+.string ""1bcb..cc0b"
+L23: .string ""		"a"
+L24: .string "a##y:
+L25: prn #K
+L26: .string "y01xxbxcc;xa"
+L27: .string "c1a9\q0a#9a ".b9",1b9"
+L28: .string ":a xa"
+.string ";:.0c9 "
+L30: .data 1 , K , -5
+L31: .string "b,cz,	"
+L32: .string "c,
+L33: .string ":0	,ca	."1, "\"x#a 
+L34: .string "bcy,z"
+.string "::\t\q;; ",:z"
+L36: mov L10, r2
+.string ""
+.string "c9 y\\"" "z,y"
+.string "9;az	x#y"
+ hlt
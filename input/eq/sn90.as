@@ -0,0 +1,42 @@
+.define K = 3
+L0: .string " ;# 9"9;c	"
+.string ";#xy	\t"
+L2: .string "0xx."
+L3: .string "a	"
+mov L4, r2
+.string "9z; #
+.data 1 , K , -5
+L7: .string "b",	".	z "90 b:"zx	y"
+.string "1	" "0z; 9:x;b "
+.data 1 , K , -5
+L10: .data 1 , K , -5
+.string "yay.\n:" "ac 	.x"
+L12: .string "c"
+.entry L10
+L14: prn #K
+L15: .string "b#:1c9."
+.string ".,yx"9:, ",z;:;z9\n"
+L17: .string "0cz\t"
+L18: .string ".:;"
+L19: .data 1 , K , -5
+L20: .string ",	1\n.90""a"
+.entry L20
+L22: mov L8, r2
+.entry L25
+.string ":	c9ca;"
+mov L35, r2
+L26: mov L16, r2
+L27: .data 1 , K , -5
+.string ";019zy"
+L29: .data 1 , K , -5
+L30: .string "x.b "
+L31: .string "1"1,"
+.string "\"aa:1"
+L33: .string "ac9ca#"
+prn #K
+L35: .string "91, #c,"
+L36: .string ":y	1c.b,, "	;;b1z"ab
+.string ";c\n:"
+L38: mov L29, r2
+.data 1 , K , -5
+ hlt
@@ -0,0 +1,42 @@
+.define K = 3
+L0: .string "z:####910;"
+.string "cc#	 :"
+L2: .string "	.z,z:;	09b", "
+L3: .string "	"
+.data 1 , K , -5
+.string "y#,#0;#;b.z\r" "	yx.ba,	z"
+L6: .data 1 , K , -5
+L7: .string ";;x", "11\\0: \r9zb"
+.data 1 , K , -5
+L9: .string "#"
+.entry L30
+L11: .string "9zb", ":cz0\\;,"	x"
+L12: .string "xx	#0y,ay\qx	"
+L13: .string ",#c9"
+.string ""
+L15: .string "x0zz.xa:0;c" ";\r.x	"
+.string "09y900\q9\t" "##"
+.string "
+L18: .string "y
+.data 1 , K , -5
+L20: prn #K
+.entry L29
+.string "cc91:	"
+.string "x"
+.string "c" ";	1\\\r "cc;
+.string ", c"
+L26: .string "z.y;#"
+L27: .string "b		x91	9", ""
+L28: prn #K
+.string "\"1:y,\r99."
+.string ","\tzx,"
+.string ".0x::#\t", "1:byz1.
+L32: .string "bc	;,"ac"
+prn #K
+.string "10#:00" "	
+mov L26, r2
+L36: .string "##"	xxb# bb"
+L37: .string ":x" "9a:x"
+L38: .string "", "9x. .zcx0b"
+L39: .string "yc,:"
+ hlt
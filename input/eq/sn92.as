@@ -0,0 +1,42 @@
+.define K = 3
+L0: .string "9x\\zc,bb
+.data 1 , K , -5
+L2: .string "z."zxy#c."
+.string "z1z1y"a:   "
+L4: mov L36, r2
+L5: .string " ," """
+L6: .string ";1"
+.string "0z,abcy", ";"xcz\r	xa"
+L8: .string "01;#.	 z"
+prn #K
+.string ":	z#c	,z,"
+mov L2, r2
+mov L25, r2
+.string "0	y,#c0.,z::"
+L14: .string " .\"a;", ",9 "
+.string "a,y0. "##0##9"
+L16: .data 1 , K , -5
+.entry L30
+.data 1 , K , -5
+.entry L13
+L20: .string "", " "
+L21: .string "ba11b""
+L22: .string "0#a"
+L23: .string "1b  :acc#ay"
+L24: .string "a	x,:	"
+.data 1 , K , -5
+L26: .string "1z#.:a9	"
+L27: mov L14, r2
+.data 1 , K , -5
+L29: .string ", ".z::"
+L30: .string "01 	" "	;	y;#ay "
+.string "." "0	,;z;##\t#\t""
+prn #K
+L33: .string "x.c::a.1y
+L34: mov L18, r2
+L35: .string " ;# "\\
+L36: mov L1, r2
+.string "9a;,c1"b9:a:, "
+L38: .string ":y"
+L39: .data 1 , K , -5
+ hlt
@@ -0,0 +1,42 @@
+.define K = 3
+L0: .string ";xc;yz:xz", "	x;:xc01""
+L1: .string ""cc"
+.string "c "a00:"
+.string "c":z	y	c9;c"
+.string "\na#aa\\
+.string " 	y91b;b", "c,0"b	;9z.
+L6: .string "a9" ":\nz	;"a,\";"
+.data 1 , K , -5
+L8: .string "	" "xy#	"
+L9: .string ".z0y.\t1#b""
+L10: .string ""0:#.c", "b.1a,;"
+L11: .string "00z,9"
+L12: .data 1 , K , -5
+.entry L4
+L14: .string "b0", "y"
+mov L24, r2
+L16: .data 1 , K , -5
+L17: .data 1 , K , -5
+.string "# a;", "y;x;\t	yy"
+L19: mov L8, r2
+L20: .string " zcy1.c":"
+.string "b\n
+.string "
+L23: .string "yc90c\tz
+L24: .string "	#"
+L25: .data 1 , K , -5
+L26: .string " :.#" "b;aa;y"
+.data 1 , K , -5
+L28: .string ""
+.entry L31
+L30: .string "",#x c"c1xb
+L31: .string ".".999;;;9ba"
+.string " axy	0.a09,\n", "0;0 0;"
+L33: .data 1 , K , -5
+L34: .string "	a	cz"9"
+L35: mov L33, r2
+.string ",	a", "xzz9y#xax
+.string "#"
+L38: .string "cy10bb ,\".a""
+.data 1 , K , -5
+ hlt
@@ -0,0 +1,42 @@
+.define K = 3
+L0: .string " .a"" ".9	a"
+L1: mov L29, r2
+L2: .string "b.#z9yc "9c"
+.string ""
+L4: mov L14, r2
+L5: .string "9zb
+.string "0"a0	\n "
+.data 1 , K , -5
+.string ""
+.data 1 , K , -5
+mov L10, r2
+L11: .data 1 , K , -5
+L12: .string ".0,;.y\qy,., "y	,, \n,"
+L13: .data 1 , K , -5
+L14: .string "yy "#0a#::"
+.string "y;1:cbxxb"
+mov L17, r2
+.string ".;#az" .,a	c
+mov L34, r2
+L19: .string ""","c#x "
+.string "9	c0z	:90:,"
+.entry L14
+.string ""0:	";\tb1y."
+.string ",x"
+L24: .string "0 a:"b.c"
+.string ":.	:0	""
+L26: prn #K
+.string ":"
+L28: .string "c,	9bz
+.string "1#a#.z;0;:
+L30: .string ";a	"09z:9b1", ";bc,	xc:"
+.string ".0c\r"
+.string ";", "c
+.string "a9"
+L34: prn #K
+L35: prn #K
+mov L25, r2
+.entry L27
+L38: .string ":"
+mov L3, r2
+ hlt
@@ -0,0 +1,42 @@
+.define K = 3
+L0: mov L34, r2
+mov L31, r2
+.string "c90b\"0x;9"
+L3: .string ":,"
+L4: .data 1 , K , -5
+L5: .string "x;" aa;\"; ;" ":xycaa0:1"
+prn #K
+.string "#yx##0, :\t9"
+L8: mov L38, r2
+.string "#a;"
+.entry L25
+L11: .string ";	ya .;."
+.string "##x\r09b,1#y" "y"
+L13: .data 1 , K , -5
+.string "#0,":\r0c "
+L15: .string ""	xc:#	#" "9,b,"ac""
+L16: .string ""
+L17: .string ":  yy.0", "a	.c.#0z"
+L18: .string "a 0:"1#\n09c.", "09c,11"
+L19: .string "1\\xc	 \n0z"
+L20: .string "	zxa 	";b,"
+L21: .string ";00 z0#b"
+L22: .string "#\tzb.y	0yx"
+.string "., "y y::.c1"
+L24: .data 1 , K , -5
+.entry L17
+.string "x ,1xa1y" "::aab11x0	z#"
+.string "9:" "
+L28: .string "9c9a"
+L29: .string "a\q,
+L30: .string "9"
+mov L30, r2
+L32: .string ";a90\r91"	x#"
+.string "" z;" 	"
+L34: .string ""
+.string "b"
+.string "9ab\"x	"9;:1#"
+L37: .data 1 , K , -5
+L38: .string "#1#"
+L39: .string "11\" :.0" "9cb1c		z 1x\t
+ hlt
@@ -0,0 +1,42 @@
+.define K = 3
+.string "0x,baz"
+L1: .string ";9y\n"
+L2: .string ";\",azbx#\t;c
+L3: .string " 990..b9 "..c0#
+L4: mov L2, r2
+L5: .string "z ." "zc"
+.string "zb;zc\r0yzax0"
+mov L5, r2
+L8: .string "1" "# "
+L9: .string "bx\\,.yb0a.."
+L10: .string "	aacy1."
+L11: .string "00	9;"
+L12: .string " ,	#cy".
+L13: .string "zc,"
+.string "y0\"#\"z", "y"
+.string "10yy19. y"
+L16: .string ":", "
+.string "1;:ba9z:9z"0"
+.string ""\r,:\n01
+.string ""	,\q9#1" " x01:c1"
+L20: .data 1 , K , -5
+.string ".zcc;9" "" 9"
+.string ";1\"y;1b01x
+L23: .data 1 , K , -5
+L24: .string "a;"
+L25: .string "y9#x
+.string "9b#\n	;" "zz""
+L27: .string "z#x\"9;:ax"
+.string ";x\t"x	;"
+L29: .string "9"
+L30: .data 1 , K , -5
+L31: mov L2, r2
+L32: .string ".,"
+L33: .string "x0x:"c", " "
+L34: .string "	z;;,y,9,0", "\n; 
+L35: .string "\""#	x\nzbb
+L36: mov L14, r2
+.string "c0 yzy	1., ":x\tx	";1.b
+.string ":\":c" ", b z01"
+L39: .string ".10.,1	#	a1\"
+ hlt
@@ -0,0 +1,42 @@
+.define K = 3
+.string "ba	ba
+L1: prn #K
+L2: .string "x,1 z9.	0z
+L3: .string "y"
+L4: .string "cb#c1zay\t;c1"
+L5: .data 1 , K , -5
+.entry L37
+L7: mov L3, r2
+L8: .string "xb\nb		" "	.."
+L9: .string "; ,b01z, c\""
+.string "0"ca	#a# ", "	 
+L11: prn #K
+.entry L12
+.string "z:\ny#0\q."
+L14: .string "c:"
+L15: mov L2, r2
+L16: .string "09c"", "b
+.string "y" ".y"
+L18: prn #K
+L19: .string "xz1y.a"::	y\\
+mov L25, r2
+.entry L28
+L22: .string ":	11# , "#""z0z0#1#0"
+L23: mov L23, r2
+L24: prn #K
+mov L10, r2
+.entry L6
+.string ","\q"9#	", ""
+L28: .string ",c:" ",0a,9y"
+L29: .string "\rc0\t 9x1 \t"
+.string "", "1		1"	"
+L31: .string "11.,x;"
+L32: .string "y9#" "	:	zz"
+L33: mov L36, r2
+.string "zbyxya:yy	9c"
+L35: .string ";xab1ay#,c" " ;"
+L36: .string "c	b;;:.z "
+.string ""
+mov L27, r2
+L39: .string "09\n"1#", "a,bzbz90b"
+ hlt
@@ -0,0 +1,42 @@
+.define K = 3
+.string ".b" 	"
+L1: .string ""
+prn #K
+.string ""
+L4: mov L31, r2
+.string ":z"
+L6: prn #K
+L7: .string "0.	x\t:z," " \n
+L8: .string ""\r	a	b	"
+L9: .string "bxb#
+.data 1 , K , -5
+L11: .string "9,90a,a,x.0"
+L12: .string "x..1#1"# :"""
+prn #K
+L14: .string "bzby9"	;z"
+L15: .string ";x,z,,\q1", ""
+.string "xbz,b"
+L17: .string "1#,"b0\nx#y"
+prn #K
+L19: mov L0, r2
+L20: prn #K
+L21: .string "z#.b" ".;ca:"
+L22: .string " ;z#x"
+mov L6, r2
+.string "cy,az1"	0#"
+L25: .string ":0\"."
+.string "x	bx" "1x.a	#9z"
+L27: .string ""
+.string "09.1a,,b"
+.string "cz.;#.0	.:1"
+.entry L2
+L31: .string ";:\q;1"", "1c;0xay.\t"
+.data 1 , K , -5
+L33: .string "c"a.9" "	\r;0.y9,x y"
+.string "	" "yc""
+prn #K
+L36: .string "z\\0 "
+L37: .string "yybxxz1 x""
+.string ""
+.string " ;#	", "9yx"
+ hlt
@@ -0,0 +1,42 @@
+.define K = 3
+L0: .string "11"
+.string "	c"0.0;:
+L2: .string ",c
+.string ",:b9	a." "c#\t#b;y0
+mov L28, r2
+.string "zbxaz".c "cy a:,y\\0b"
+L6: .string "y;"byy.xxxy "
+L7: .string "	,""
+L8: prn #K
+L9: prn #K
+L10: .string "b,0::,::."
+L11: .string " ":#1 1 x,01:"
+L12: mov L28, r2
+.string "\r
+.entry L34
+.string " .z :#"
+L16: .string ""
+.data 1 , K , -5
+.string "9."
+.entry L22
+L20: .data 1 , K , -5
+L21: .string " z\\09.#	" " 0ax cbb."
+.string " 0x::z9#,yy, ":.	z;909#:z"
+L23: .string ""zc	1#\nx,"", "a	9a,.9zyb"
+L24: .string " z#b.10x"
+.string "	
+L26: mov L22, r2
+.data 1 , K , -5
+.string "yyy	cb\q:z;1"
+mov L21, r2
+mov L40, r2
+L31: .string "xy"\qa1:x1#c
+.string "#;"
+L33: .string "" "ya
+L34: prn #K
+L35: .string "b"
+L36: .data 1 , K , -5
+L37: .string ""
+L38: .string "a "
+.string "1z\\b019zx.aa"
+ hlt
@@ -0,0 +1,8 @@
+.define sz = 2 * (3 + 1)
+.define k = sz - 1
+LIST: .data 1, sz*2, -(k+1), 7/2
+mov #k+1, r1
+mov LIST[sz-1], r2
+mov #(2*3), LIST[1+1]
+.fill 3, k*2
+hlt
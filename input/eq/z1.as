@@ -0,0 +1,3 @@
+.define c1 = 3
+mov #c1, r6
+hlt
@@ -0,0 +1,9 @@
+.define k = 7
+L: .data 1, 2, 3, 4, 5, 6, 7, 8, 9
+mov #k+1, r1
+mov L[k-5], r2
+prn #(k*2)/-3
+.data k/2, 10-k
+.define m = k * (k - 1)
+prn #m
+hlt
@@ -0,0 +1,9 @@
+.define k = 7
+L: .data 1, 2, 3, 4, 5, 6, 7, 8, 9
+mov #8, r1
+mov L[2], r2
+prn #-4
+.data 3, 3
+.define m = 42
+prn #m
+hlt
@@ -0,0 +1,9 @@
+.define a = b+1
+.define b = 2
+.define z = b-2
+L: .data 5/z
+mov #L+1, r1
+.define j = $$
+.define c = (1
+mov L[b*], r2
+hlt
@@ -0,0 +1,15 @@
+MAIN:   mov #10, r1
+ clr r2
+LOOP: jsr SUM
+ dec r1
+ cmp r1, #0
+ bne LOOP
+ mov ARR[2], r3
+ jmp END
+END: prn r2
+ hlt
+SUM: add r1, r2
+ inc CNT
+ rts
+ARR: .data 7, -8, 9
+CNT: .data 0
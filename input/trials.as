@@ -0,0 +1,26 @@
+; Hashes every line of the input with a key, the same for every line, that
+; takes a few thousand steps to compute before the first line is read.
+MAIN:   clr r2
+        mov #1, r3
+        mov #2000, r4
+SETUP:  mov r3, r5
+        add r2, r3
+        mov r5, r2
+        add r3, KEY
+        dec r4
+        cmp r4, #0
+        bne SETUP
+        clr HASH
+READ:   red r6
+        cmp r6, #-1
+        bne MIX
+        prn HASH
+        hlt
+MIX:    add r6, HASH
+        add KEY, HASH
+        mov HASH, r7
+        add r7, HASH
+        add r7, HASH
+        jmp READ
+KEY:    .data 0
+HASH:   .data 0
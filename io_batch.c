@@ -0,0 +1,811 @@
+#define _GNU_SOURCE
+#include "io_batch.h"
+#include "errors.h"
+#include "parallel.h"
+#include <errno.h>
+#include <fcntl.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#ifdef __linux__
+#include <sys/syscall.h>
+#endif
+
+#if defined(__linux__) && defined(__NR_io_uring_setup)
+#define HAS_IO_URING 1
+#include <linux/io_uring.h>
+#endif
+
+/* The number of threads of the blocking backend */
+#define IO_THREADS_COUNT 8
+
+/**
+ * @struct IoWorker
+ * @brief The files a thread of the blocking backend handles.
+ */
+typedef struct {
+  IoFile *files;  /**< The files of the batch. */
+  int count;      /**< The number of files of the batch. */
+  int first;      /**< The first file of the thread. */
+  bool is_write;  /**< Whether the files are written rather than read. */
+} IoWorker;
+
+static bool read_whole_file(IoFile *file) {
+  struct stat status;
+  long size = 0;
+  int fd = open(file->file_name, O_RDONLY);
+
+  if (fd < 0) {
+    return false;
+  }
+
+  if (fstat(fd, &status) != 0) {
+    close(fd);
+    return false;
+  }
+
+  file->text = (char *)malloc(status.st_size + 1);
+
+  if (file->text == NULL) {
+    fprintf(stderr, ERROR_OUT_OF_MEMORY);
+    exit(EXIT_FAILURE);
+  }
+
+  while (size < status.st_size) {
+    ssize_t length = read(fd, file->text + size, status.st_size - size);
+
+    if (length <= 0) {
+      break;
+    }
+
+    size += length;
+  }
+
+  close(fd);
+  file->text[size] = '\0';
+  file->size = size;
+
+  return true;
+}
+
+static bool write_whole_file(const IoFile *file) {
+  long size = 0;
+  int fd = open(file->file_name, O_WRONLY | O_CREAT | O_TRUNC, 0666);
+
+  if (fd < 0) {
+    return false;
+  }
+
+  while (size < file->size) {
+    ssize_t length = write(fd, file->text + size, file->size - size);
+
+    if (length <= 0) {
+      close(fd);
+      return false;
+    }
+
+    size += length;
+  }
+
+  return close(fd) == 0;
+}
+
+static void *run_worker(void *arg) {
+  IoWorker *worker = (IoWorker *)arg;
+  int i = 0;
+
+  for (i = worker->first; i < worker->count; i += IO_THREADS_COUNT) {
+    IoFile *file = &worker->files[i];
+
+    if (worker->is_write) {
+      file->is_done = write_whole_file(file);
+    } else {
+      file->is_done = read_whole_file(file);
+    }
+  }
+
+  return NULL;
+}
+
+/* Spreads the files over the threads, every thread taking one file in so many */
+static void run_workers(IoFile *files, int count, bool is_write) {
+  IoWorker workers[IO_THREADS_COUNT];
+  int workers_count = count < IO_THREADS_COUNT ? count : IO_THREADS_COUNT;
+  int i = 0;
+
+  for (i = 0; i < workers_count; i++) {
+    workers[i].files = files;
+    workers[i].count = count;
+    workers[i].first = i;
+    workers[i].is_write = is_write;
+  }
+
+  run_parallel(run_worker, workers, sizeof(IoWorker), workers_count);
+}
+
+#ifdef HAS_IO_URING
+
+/* The number of operations submitted at once */
+#define RING_ENTRIES 64
+
+/**
+ * @struct IoRing
+ * @brief The queues shared with the kernel, mapped into memory.
+ */
+struct IoRing {
+  int fd;                    /**< The file descriptor of the ring. */
+  unsigned entries;          /**< The number of submission slots. */
+  unsigned *sq_head;         /**< The submissions taken by the kernel. */
+  unsigned *sq_tail;         /**< The submissions made. */
+  unsigned *sq_mask;         /**< The mask of the submission slots. */
+  unsigned *sq_array;        /**< The slots of the submission queue. */
+  struct io_uring_sqe *sqes; /**< The submissions. */
+  unsigned *cq_head;         /**< The completions taken. */
+  unsigned *cq_tail;         /**< The completions made by the kernel. */
+  unsigned *cq_mask;         /**< The mask of the completion slots. */
+  struct io_uring_cqe *cqes; /**< The completions. */
+  void *sq_ring;             /**< The mapping of the submission queue. */
+  size_t sq_ring_size;       /**< The size of that mapping. */
+  void *cq_ring;             /**< The mapping of the completion queue. */
+  size_t cq_ring_size;       /**< The size of that mapping. */
+  size_t sqes_size;          /**< The size of the mapping of submissions. */
+};
+
+/**
+ * @struct IoOperation
+ * @brief An operation on a file, and its outcome.
+ */
+typedef struct {
+  unsigned char opcode; /**< The operation. */
+  int fd;               /**< The file descriptor it works on. */
+  void *address;        /**< The name of the file, or the buffer. */
+  unsigned length;      /**< The mode of the file, or the buffer size. */
+  int flags;            /**< The flags of the opened file. */
+  int result;           /**< What the operation returned, or -errno. */
+} IoOperation;
+
+static int ring_enter(IoRing *ring, unsigned to_submit, unsigned min_complete,
+                      unsigned flags) {
+  return (int)syscall(__NR_io_uring_enter, ring->fd, to_submit, min_complete,
+                      flags, NULL, 0);
+}
+
+static void free_ring(IoRing *ring) {
+  if (ring->sqes != NULL && ring->sqes != MAP_FAILED) {
+    munmap(ring->sqes, ring->sqes_size);
+  }
+
+  if (ring->cq_ring != NULL && ring->cq_ring != MAP_FAILED &&
+      ring->cq_ring != ring->sq_ring) {
+    munmap(ring->cq_ring, ring->cq_ring_size);
+  }
+
+  if (ring->sq_ring != NULL && ring->sq_ring != MAP_FAILED) {
+    munmap(ring->sq_ring, ring->sq_ring_size);
+  }
+
+  close(ring->fd);
+  free(ring);
+}
+
+/* Checks that the kernel knows every operation the batches submit */
+static bool has_operations(IoRing *ring) {
+  static const unsigned char needed[] = {IORING_OP_OPENAT, IORING_OP_READ,
+                                         IORING_OP_WRITE, IORING_OP_CLOSE};
+  struct io_uring_probe *probe = NULL;
+  size_t size =
+      sizeof(struct io_uring_probe) + 256 * sizeof(struct io_uring_probe_op);
+  bool is_supported = true;
+  size_t i = 0;
+
+  probe = (struct io_uring_probe *)calloc(1, size);
+
+  if (probe == NULL) {
+    fprintf(stderr, ERROR_OUT_OF_MEMORY);
+    exit(EXIT_FAILURE);
+  }
+
+  if (syscall(__NR_io_uring_register, ring->fd, IORING_REGISTER_PROBE, probe,
+              256) < 0) {
+    is_supported = false;
+  }
+
+  for (i = 0; is_supported && i < sizeof(needed); i++) {
+    is_supported = needed[i] <= probe->last_op &&
+                   (probe->ops[needed[i]].flags & IO_URING_OP_SUPPORTED);
+  }
+
+  free(probe);
+
+  return is_supported;
+}
+
+static IoRing *create_ring(void) {
+  struct io_uring_params params;
+  IoRing *ring = NULL;
+  int fd = 0;
+
+  memset(&params, 0, sizeof(params));
+  fd = (int)syscall(__NR_io_uring_setup, RING_ENTRIES, &params);
+
+  if (fd < 0) {
+    return NULL;
+  }
+
+  ring = (IoRing *)calloc(1, sizeof(IoRing));
+
+  if (ring == NULL) {
+    fprintf(stderr, ERROR_OUT_OF_MEMORY);
+    exit(EXIT_FAILURE);
+  }
+
+  ring->fd = fd;
+  ring->entries = params.sq_entries;
+  ring->sq_ring_size = params.sq_off.array + params.sq_entries * sizeof(unsigned);
+  ring->cq_ring_size =
+      params.cq_off.cqes + params.cq_entries * sizeof(struct io_uring_cqe);
+  ring->sqes_size = params.sq_entries * sizeof(struct io_uring_sqe);
+
+  /* Newer kernels map both queues at once */
+  if (params.features & IORING_FEAT_SINGLE_MMAP) {
+    if (ring->cq_ring_size > ring->sq_ring_size) {
+      ring->sq_ring_size = ring->cq_ring_size;
+    }
+
+    ring->cq_ring_size = ring->sq_ring_size;
+  }
+
+  ring->sq_ring = mmap(NULL, ring->sq_ring_size, PROT_READ | PROT_WRITE,
+                       MAP_SHARED | MAP_POPULATE, fd, IORING_OFF_SQ_RING);
+
+  if (params.features & IORING_FEAT_SINGLE_MMAP) {
+    ring->cq_ring = ring->sq_ring;
+  } else {
+    ring->cq_ring = mmap(NULL, ring->cq_ring_size, PROT_READ | PROT_WRITE,
+                         MAP_SHARED | MAP_POPULATE, fd, IORING_OFF_CQ_RING);
+  }
+
+  ring->sqes = (struct io_uring_sqe *)mmap(
+      NULL, ring->sqes_size, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE,
+      fd, IORING_OFF_SQES);
+
+  if (ring->sq_ring == MAP_FAILED || ring->cq_ring == MAP_FAILED ||
+      ring->sqes == MAP_FAILED || !has_operations(ring)) {
+    free_ring(ring);
+    return NULL;
+  }
+
+  ring->sq_head = (unsigned *)((char *)ring->sq_ring + params.sq_off.head);
+  ring->sq_tail = (unsigned *)((char *)ring->sq_ring + params.sq_off.tail);
+  ring->sq_mask = (unsigned *)((char *)ring->sq_ring + params.sq_off.ring_mask);
+  ring->sq_array = (unsigned *)((char *)ring->sq_ring + params.sq_off.array);
+  ring->cq_head = (unsigned *)((char *)ring->cq_ring + params.cq_off.head);
+  ring->cq_tail = (unsigned *)((char *)ring->cq_ring + params.cq_off.tail);
+  ring->cq_mask = (unsigned *)((char *)ring->cq_ring + params.cq_off.ring_mask);
+  ring->cqes = (struct io_uring_cqe *)((char *)ring->cq_ring +
+                                       params.cq_off.cqes);
+
+  return ring;
+}
+
+static void prepare_operation(IoRing *ring, const IoOperation *operation,
+                              unsigned long index) {
+  unsigned tail = *ring->sq_tail;
+  unsigned slot = tail & *ring->sq_mask;
+  struct io_uring_sqe *sqe = &ring->sqes[slot];
+
+  memset(sqe, 0, sizeof(*sqe));
+  sqe->opcode = operation->opcode;
+  sqe->fd = operation->fd;
+  sqe->addr = (unsigned long)operation->address;
+  sqe->len = operation->length;
+  sqe->user_data = index;
+
+  if (operation->opcode == IORING_OP_OPENAT) {
+    sqe->open_flags = operation->flags;
+  } else if (operation->opcode == IORING_OP_READ ||
+             operation->opcode == IORING_OP_WRITE) {
+    /* The whole file is handled from its start */
+    sqe->off = 0;
+  }
+
+  ring->sq_array[slot] = slot;
+  __atomic_store_n(ring->sq_tail, tail + 1, __ATOMIC_RELEASE);
+}
+
+/* Takes the completions made so far, and returns how many there were */
+static int reap_completions(IoRing *ring, IoOperation *operations) {
+  unsigned head = *ring->cq_head;
+  unsigned tail = __atomic_load_n(ring->cq_tail, __ATOMIC_ACQUIRE);
+  int reaped = 0;
+
+  for (; head != tail; head++, reaped++) {
+    const struct io_uring_cqe *cqe = &ring->cqes[head & *ring->cq_mask];
+
+    operations[cqe->user_data].result = cqe->res;
+  }
+
+  __atomic_store_n(ring->cq_head, head, __ATOMIC_RELEASE);
+
+  return reaped;
+}
+
+/*
+ * Runs operations on the ring, as many at once as it has slots, and waits for
+ * all of them. The operations the kernel refuses to take get -errno.
+ */
+static void run_operations(IoRing *ring, IoOperation *operations, int count) {
+  int next = 0;
+
+  while (next < count) {
+    int prepared = 0;
+    int submitted = 0;
+    int completed = 0;
+
+    for (; next + prepared < count && prepared < (int)ring->entries;
+         prepared++) {
+      prepare_operation(ring, &operations[next + prepared], next + prepared);
+    }
+
+    while (submitted < prepared) {
+      int result = ring_enter(ring, prepared - submitted, 0, 0);
+
+      if (result >= 0) {
+        submitted += result;
+      } else if (errno != EINTR && errno != EAGAIN && errno != EBUSY) {
+        int error = errno;
+        int i = 0;
+
+        for (i = next + submitted; i < next + prepared; i++) {
+          operations[i].result = -error;
+        }
+
+        /* Forget the submissions the kernel did not take */
+        __atomic_store_n(ring->sq_tail, *ring->sq_head, __ATOMIC_RELEASE);
+        break;
+      }
+    }
+
+    completed = reap_completions(ring, operations);
+
+    while (completed < submitted) {
+      if (ring_enter(ring, 0, 1, IORING_ENTER_GETEVENTS) < 0 &&
+          errno != EINTR) {
+        /* The buffers of the operations still running cannot be freed */
+        fprintf(stderr, "ERROR: io_uring wait failed: %s\n", strerror(errno));
+        exit(EXIT_FAILURE);
+      }
+
+      completed += reap_completions(ring, operations);
+    }
+
+    next += prepared;
+  }
+}
+
+/* Opens the files on the ring, leaving their descriptors in fds */
+static void open_files(IoRing *ring, IoFile *files, int count, int flags,
+                       IoOperation *operations, int *fds) {
+  int i = 0;
+
+  for (i = 0; i < count; i++) {
+    operations[i].opcode = IORING_OP_OPENAT;
+    operations[i].fd = AT_FDCWD;
+    operations[i].address = files[i].file_name;
+    operations[i].length = 0666;
+    operations[i].flags = flags;
+  }
+
+  run_operations(ring, operations, count);
+
+  for (i = 0; i < count; i++) {
+    fds[i] = operations[i].result;
+  }
+}
+
+/* Closes the files opened on the ring */
+static void close_files(IoRing *ring, int count, IoOperation *operations,
+                        int *fds) {
+  int closed = 0;
+  int i = 0;
+
+  for (i = 0; i < count; i++) {
+    if (fds[i] >= 0) {
+      operations[closed].opcode = IORING_OP_CLOSE;
+      operations[closed].fd = fds[i];
+      operations[closed].address = NULL;
+      operations[closed].length = 0;
+      operations[closed].flags = 0;
+      closed++;
+    }
+  }
+
+  run_operations(ring, operations, closed);
+}
+
+/*
+ * Transfers the content of the opened files in a single operation each, and
+ * marks the files whose transfer was complete.
+ */
+static void transfer_files(IoRing *ring, IoFile *files, int count,
+                           unsigned char opcode, IoOperation *operations,
+                           const int *fds) {
+  int *indexes = (int *)malloc(count * sizeof(int));
+  int transfers = 0;
+  int i = 0;
+
+  if (indexes == NULL) {
+    fprintf(stderr, ERROR_OUT_OF_MEMORY);
+    exit(EXIT_FAILURE);
+  }
+
+  for (i = 0; i < count; i++) {
+    if (fds[i] >= 0 && files[i].size > 0) {
+      operations[transfers].opcode = opcode;
+      operations[transfers].fd = fds[i];
+      operations[transfers].address = files[i].text;
+      operations[transfers].length = (unsigned)files[i].size;
+      operations[transfers].flags = 0;
+      indexes[transfers++] = i;
+    } else {
+      files[i].is_done = fds[i] >= 0;
+    }
+  }
+
+  run_operations(ring, operations, transfers);
+
+  for (i = 0; i < transfers; i++) {
+    files[indexes[i]].is_done = operations[i].result == files[indexes[i]].size;
+  }
+
+  free(indexes);
+}
+
+/*
+ * Sizes the opened files, allocates their contents, and leaves the files too
+ * large for a single read to the blocking calls.
+ */
+static void size_files(IoFile *files, int count, int *fds) {
+  int i = 0;
+
+  for (i = 0; i < count; i++) {
+    struct stat status;
+
+    files[i].size = 0;
+
+    if (fds[i] < 0) {
+      continue;
+    }
+
+    if (fstat(fds[i], &status) != 0 || status.st_size > 0x7fffffffL) {
+      close(fds[i]);
+      fds[i] = -1;
+      continue;
+    }
+
+    files[i].size = status.st_size;
+    files[i].text = (char *)malloc(files[i].size + 1);
+
+    if (files[i].text == NULL) {
+      fprintf(stderr, ERROR_OUT_OF_MEMORY);
+      exit(EXIT_FAILURE);
+    }
+  }
+}
+
+static void read_ring_files(IoRing *ring, IoFile *files, int count,
+                            IoOperation *operations, int *fds) {
+  int i = 0;
+
+  open_files(ring, files, count, O_RDONLY, operations, fds);
+  size_files(files, count, fds);
+  transfer_files(ring, files, count, IORING_OP_READ, operations, fds);
+  close_files(ring, count, operations, fds);
+
+  for (i = 0; i < count; i++) {
+    if (files[i].is_done) {
+      files[i].text[files[i].size] = '\0';
+    } else {
+      free(files[i].text);
+      files[i].text = NULL;
+      files[i].size = 0;
+    }
+  }
+}
+
+static void write_ring_files(IoRing *ring, IoFile *files, int count,
+                             IoOperation *operations, int *fds) {
+  int i = 0;
+
+  open_files(ring, files, count, O_WRONLY | O_CREAT | O_TRUNC, operations,
+             fds);
+
+  for (i = 0; i < count; i++) {
+    /* A single write cannot take a larger content */
+    if (fds[i] >= 0 && files[i].size > 0x7fffffffL) {
+      close(fds[i]);
+      fds[i] = -1;
+    }
+  }
+
+  transfer_files(ring, files, count, IORING_OP_WRITE, operations, fds);
+  close_files(ring, count, operations, fds);
+}
+
+/*
+ * Every file is opened, transferred and closed by three rounds of operations
+ * on the ring. The files the ring could not handle, missing ones included,
+ * are tried again with blocking calls.
+ */
+static void run_ring(IoRing *ring, IoFile *files, int count, bool is_write) {
+  IoOperation *operations =
+      (IoOperation *)malloc(count * sizeof(IoOperation));
+  int *fds = (int *)malloc(count * sizeof(int));
+  int i = 0;
+
+  if (operations == NULL || fds == NULL) {
+    fprintf(stderr, ERROR_OUT_OF_MEMORY);
+    exit(EXIT_FAILURE);
+  }
+
+  if (is_write) {
+    write_ring_files(ring, files, count, operations, fds);
+  } else {
+    read_ring_files(ring, files, count, operations, fds);
+  }
+
+  for (i = 0; i < count; i++) {
+    if (!files[i].is_done) {
+      files[i].is_done =
+          is_write ? write_whole_file(&files[i]) : read_whole_file(&files[i]);
+    }
+  }
+
+  free(operations);
+  free(fds);
+}
+
+#endif
+
+static void run_batch(IoBatch *batch, IoFile *files, int count,
+                      bool is_write) {
+  int i = 0;
+
+  for (i = 0; i < count; i++) {
+    files[i].is_done = false;
+
+    if (!is_write) {
+      files[i].text = NULL;
+      files[i].size = 0;
+    }
+  }
+
+#ifdef HAS_IO_URING
+  if (batch->ring) {
+    run_ring(batch->ring, files, count, is_write);
+    return;
+  }
+#endif
+
+  if (batch->backend == IO_BACKEND_THREADS) {
+    run_workers(files, count, is_write);
+    return;
+  }
+
+  for (i = 0; i < count; i++) {
+    files[i].is_done =
+        is_write ? write_whole_file(&files[i]) : read_whole_file(&files[i]);
+  }
+}
+
+/* Removes a file, and returns whether there was one to remove */
+static bool remove_file(const IoFile *file) {
+  return unlink(file->file_name) == 0;
+}
+
+/*
+ * Whether a file already holds a content: the sizes are compared first, and
+ * only a file of the same size is mapped and compared byte for byte.
+ */
+static bool is_unchanged(const IoFile *file) {
+  struct stat status;
+  void *mapped = NULL;
+  bool is_same = false;
+  int fd = open(file->file_name, O_RDONLY);
+
+  if (fd < 0) {
+    return false;
+  }
+
+  if (fstat(fd, &status) != 0 || !S_ISREG(status.st_mode) ||
+      status.st_size != file->size) {
+    close(fd);
+    return false;
+  }
+
+  if (file->size == 0) {
+    close(fd);
+    return true;
+  }
+
+  mapped = mmap(NULL, file->size, PROT_READ, MAP_PRIVATE, fd, 0);
+  close(fd);
+
+  if (mapped == MAP_FAILED) {
+    return false;
+  }
+
+  is_same = memcmp(mapped, file->text, file->size) == 0;
+  munmap(mapped, file->size);
+
+  return is_same;
+}
+
+IoBackend init_io_batch(IoBatch *batch, IoBackend backend) {
+  batch->backend = backend == IO_BACKEND_SYNC ? IO_BACKEND_SYNC
+                                              : IO_BACKEND_THREADS;
+  batch->ring = NULL;
+  batch->writes_count = 0;
+  batch->written_count = 0;
+  batch->unchanged_count = 0;
+  batch->removed_count = 0;
+  batch->writes = (IoFile *)malloc(IO_BATCH_FILES * sizeof(IoFile));
+
+  if (batch->writes == NULL) {
+    fprintf(stderr, ERROR_OUT_OF_MEMORY);
+    exit(EXIT_FAILURE);
+  }
+
+#ifdef HAS_IO_URING
+  if (backend == IO_BACKEND_URING) {
+    batch->ring = create_ring();
+
+    if (batch->ring) {
+      batch->backend = IO_BACKEND_URING;
+    }
+  }
+#endif
+
+  return batch->backend;
+}
+
+void read_files(IoBatch *batch, IoFile *files, int count) {
+  run_batch(batch, files, count, false);
+}
+
+/*
+ * Queues a file to be written, or removed when it has no content. A file
+ * queued again only keeps its last content, as the files of a batch are not
+ * handled in order.
+ */
+static void queue_file(IoBatch *batch, const char *file_name, char *text,
+                       long size) {
+  IoFile *file = NULL;
+  int i = 0;
+
+  for (i = 0; i < batch->writes_count; i++) {
+    if (strcmp(batch->writes[i].file_name, file_name) == 0) {
+      file = &batch->writes[i];
+      free(file->text);
+      break;
+    }
+  }
+
+  if (file == NULL) {
+    file = &batch->writes[batch->writes_count++];
+    file->file_name = strdup(file_name);
+
+    if (file->file_name == NULL) {
+      fprintf(stderr, ERROR_OUT_OF_MEMORY);
+      exit(EXIT_FAILURE);
+    }
+  }
+
+  file->text = text;
+  file->size = size;
+
+  if (batch->backend == IO_BACKEND_SYNC ||
+      batch->writes_count == IO_BATCH_FILES) {
+    flush_writes(batch);
+  }
+}
+
+bool write_output(IoBatch *batch, const char *file_name, char *text,
+                  long size) {
+  IoFile single;
+
+  if (batch) {
+    queue_file(batch, file_name, text, size);
+    return true;
+  }
+
+  single.file_name = (char *)file_name;
+  single.text = text;
+  single.size = size;
+  single.is_done = is_unchanged(&single) || write_whole_file(&single);
+
+  if (!single.is_done) {
+    fprintf(stderr, ERROR_CANNOT_WRITE, file_name);
+  }
+
+  free(text);
+
+  return single.is_done;
+}
+
+void remove_output(IoBatch *batch, const char *file_name) {
+  IoFile single;
+
+  if (batch) {
+    queue_file(batch, file_name, NULL, 0);
+  } else {
+    single.file_name = (char *)file_name;
+    remove_file(&single);
+  }
+}
+
+void flush_writes(IoBatch *batch) {
+  IoFile *changed = NULL;
+  int changed_count = 0;
+  int i = 0;
+
+  if (batch->writes_count == 0) {
+    return;
+  }
+
+  changed = (IoFile *)malloc(batch->writes_count * sizeof(IoFile));
+
+  if (changed == NULL) {
+    fprintf(stderr, ERROR_OUT_OF_MEMORY);
+    exit(EXIT_FAILURE);
+  }
+
+  /* Only the files whose content changed are written */
+  for (i = 0; i < batch->writes_count; i++) {
+    IoFile *file = &batch->writes[i];
+
+    if (file->text == NULL) {
+      batch->removed_count += remove_file(file);
+    } else if (is_unchanged(file)) {
+      batch->unchanged_count++;
+    } else {
+      changed[changed_count++] = *file;
+    }
+  }
+
+  run_batch(batch, changed, changed_count, true);
+
+  for (i = 0; i < changed_count; i++) {
+    if (changed[i].is_done) {
+      batch->written_count++;
+    } else {
+      fprintf(stderr, ERROR_CANNOT_WRITE, changed[i].file_name);
+    }
+  }
+
+  for (i = 0; i < batch->writes_count; i++) {
+    free(batch->writes[i].file_name);
+    free(batch->writes[i].text);
+  }
+
+  free(changed);
+  batch->writes_count = 0;
+}
+
+void free_io_batch(IoBatch *batch) {
+  flush_writes(batch);
+  free(batch->writes);
+
+#ifdef HAS_IO_URING
+  if (batch->ring) {
+    free_ring(batch->ring);
+  }
+#endif
+
+  batch->writes = NULL;
+  batch->ring = NULL;
+}
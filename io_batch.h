@@ -0,0 +1,136 @@
+#ifndef __IO_BATCH__H__
+#define __IO_BATCH__H__
+
+/**
+ * @file io_batch.h
+ * @brief This file contains the batched file I/O used when many small files
+ * are assembled at once.
+ *
+ * Instead of opening, reading or writing, and closing the files one after the
+ * other, a batch hands the operations of many files to the kernel at once. On
+ * Linux they go through an io_uring; where it is not available, they are
+ * spread over a few threads doing blocking I/O.
+ *
+ * A file is only written when its content changed, so that its modification
+ * time, and everything built from it, stay as they were otherwise.
+ */
+
+#include <stdbool.h>
+
+/* The number of files read or written together */
+#define IO_BATCH_FILES 64
+
+/**
+ * @brief The ways a batch can do its I/O.
+ */
+typedef enum {
+  IO_BACKEND_SYNC,    /**< Every file is handled right away, on its own. */
+  IO_BACKEND_URING,   /**< The operations are submitted to an io_uring. */
+  IO_BACKEND_THREADS  /**< The operations are blocking calls on a few
+                         threads. */
+} IoBackend;
+
+/**
+ * @struct IoFile
+ * @brief A file read or written by a batch.
+ */
+typedef struct {
+  char *file_name; /**< The name of the file. */
+  char *text;      /**< The content of the file, followed by a null
+                      character when it was read. A file written without
+                      a content is removed. */
+  long size;       /**< The number of characters of the content. */
+  bool is_done;    /**< Whether the file could be read or written. */
+} IoFile;
+
+/**
+ * @struct IoRing
+ * @brief The io_uring of a batch, defined by the Linux backend.
+ */
+typedef struct IoRing IoRing;
+
+/**
+ * @struct IoBatch
+ * @brief The backend of a batch and the writes waiting to be done.
+ *
+ * A batch is used by one thread at a time.
+ */
+typedef struct {
+  IoBackend backend;   /**< The backend actually used. */
+  IoRing *ring;        /**< The io_uring, or NULL. */
+  IoFile *writes;      /**< The files waiting to be written. */
+  int writes_count;    /**< The number of files waiting to be written. */
+  int written_count;   /**< The number of files written. */
+  int unchanged_count; /**< The number of files not written, as they already
+                          had their content. */
+  int removed_count;   /**< The number of stale files removed. */
+} IoBatch;
+
+/**
+ * @brief Initializes a batch.
+ *
+ * When an io_uring is asked for but cannot be set up, or lacks one of the
+ * operations the batch needs, the batch uses threads instead.
+ *
+ * @param batch The batch to initialize.
+ * @param backend The backend to use.
+ * @return The backend actually used.
+ */
+IoBackend init_io_batch(IoBatch *batch, IoBackend backend);
+
+/**
+ * @brief Reads whole files together.
+ *
+ * The content of every file read is allocated on the heap, and belongs to the
+ * caller.
+ *
+ * @param batch The batch.
+ * @param files The files, of which the names are read and the rest filled.
+ * @param count The number of files.
+ */
+void read_files(IoBatch *batch, IoFile *files, int count);
+
+/**
+ * @brief Writes a file, or queues it until the batch is full.
+ *
+ * The content is freed once written. Without a batch, or with a batch of the
+ * IO_BACKEND_SYNC backend, the file is written right away. A file that
+ * already has the content is left untouched. If the file cannot be written,
+ * an error is printed.
+ *
+ * @param batch The batch, or NULL.
+ * @param file_name The name of the file.
+ * @param text The content of the file, allocated on the heap.
+ * @param size The number of characters of the content.
+ * @return false if the file was not written, true if it was written or
+ * queued.
+ */
+bool write_output(IoBatch *batch, const char *file_name, char *text,
+                  long size);
+
+/**
+ * @brief Removes a stale file, if it exists, or queues its removal until the
+ * batch is full.
+ *
+ * @param batch The batch, or NULL.
+ * @param file_name The name of the file.
+ */
+void remove_output(IoBatch *batch, const char *file_name);
+
+/**
+ * @brief Writes the files queued in a batch, and removes the ones queued for
+ * removal.
+ *
+ * @param batch The batch.
+ */
+void flush_writes(IoBatch *batch);
+
+/**
+ * @brief Writes the files still queued and frees the memory allocated for a
+ * batch.
+ *
+ * @param batch The batch to free.
+ */
+void free_io_batch(IoBatch *batch);
+
+#endif
@@ -0,0 +1,293 @@
+#include "layout.h"
+#include "errors.h"
+
+/* Makes room for one more element at the end of a growing array */
+static void *reserve(void *array, int count, int *capacity, size_t size) {
+  if (count == *capacity) {
+    *capacity = *capacity ? 2 * *capacity : 64;
+    array = realloc(array, *capacity * size);
+
+    if (array == NULL) {
+      fprintf(stderr, ERROR_OUT_OF_MEMORY);
+      exit(EXIT_FAILURE);
+    }
+  }
+
+  return array;
+}
+
+static int add_name(LayoutChunk *chunk, const char *name) {
+  int length = strlen(name) + 1;
+  int offset = chunk->names_size;
+
+  if (chunk->names_size + length > chunk->names_capacity) {
+    int capacity = chunk->names_capacity ? 2 * chunk->names_capacity : 1024;
+    char *temp = NULL;
+
+    while (chunk->names_size + length > capacity) {
+      capacity *= 2;
+    }
+
+    temp = (char *)realloc(chunk->names, capacity);
+
+    if (temp == NULL) {
+      fprintf(stderr, ERROR_OUT_OF_MEMORY);
+      exit(EXIT_FAILURE);
+    }
+
+    chunk->names = temp;
+    chunk->names_capacity = capacity;
+  }
+
+  memcpy(chunk->names + offset, name, length);
+  chunk->names_size += length;
+
+  return offset;
+}
+
+static void add_pending(LayoutChunk *chunk, LineLayout *line, PendingType type,
+                        const char *name) {
+  PendingWord *word = NULL;
+
+  chunk->pending = (PendingWord *)reserve(
+      chunk->pending, chunk->pending_count, &chunk->pending_capacity,
+      sizeof(PendingWord));
+
+  word = &chunk->pending[chunk->pending_count++];
+  word->type = type;
+  word->name = name ? add_name(chunk, name) : -1;
+  line->pending_count++;
+}
+
+/* Records the words of an operand, as code_inst_operand() encodes them */
+static void layout_operand(LayoutChunk *chunk, LineLayout *line, AST *node,
+                           int index) {
+  switch (node->ASTOpt.Inst.InstOperands[index].OperandType) {
+  case IMMEDIATE:
+    if (node->ASTOpt.Inst.InstOperands[index]
+            .OperandOpt.Immediate.ImmediateType == IMLABEL) {
+      add_pending(chunk, line, PENDING_DEFINE,
+                  node->ASTOpt.Inst.InstOperands[index]
+                      .OperandOpt.Immediate.ImmediateOpt.label);
+    } else {
+      line->size++;
+    }
+    break;
+  case DIRECT:
+    add_pending(chunk, line, PENDING_SYMBOL,
+                node->ASTOpt.Inst.InstOperands[index].OperandOpt.label);
+    break;
+  case INDEXED:
+    add_pending(chunk, line, PENDING_SYMBOL,
+                node->ASTOpt.Inst.InstOperands[index].OperandOpt.Index.label);
+
+    if (node->ASTOpt.Inst.InstOperands[index].OperandOpt.Index.IndexType ==
+        INLABEL) {
+      add_pending(chunk, line, PENDING_INDEX_DEFINE,
+                  node->ASTOpt.Inst.InstOperands[index]
+                      .OperandOpt.Index.IndexOpt.label);
+    } else {
+      add_pending(chunk, line, PENDING_INDEX_NUMBER, NULL);
+    }
+    break;
+  case REGISTER:
+    line->size++;
+    break;
+  }
+}
+
+void init_layout(Layout *layout, int chunks_count) {
+  layout->chunks = (LayoutChunk *)calloc(chunks_count, sizeof(LayoutChunk));
+  layout->chunks_count = chunks_count;
+  layout->size = 0;
+
+  if (layout->chunks == NULL) {
+    fprintf(stderr, ERROR_OUT_OF_MEMORY);
+    exit(EXIT_FAILURE);
+  }
+}
+
+static void add_entry(LayoutChunk *chunk, const char *name, int line_number) {
+  EntryLayout *entry = NULL;
+
+  chunk->entries =
+      (EntryLayout *)reserve(chunk->entries, chunk->entries_count,
+                             &chunk->entries_capacity, sizeof(EntryLayout));
+
+  entry = &chunk->entries[chunk->entries_count++];
+  entry->line = line_number;
+  entry->name = add_name(chunk, name);
+}
+
+static LineLayout *add_line(LayoutChunk *chunk, int line_number,
+                            bool is_instruction) {
+  LineLayout *line = NULL;
+
+  chunk->lines = (LineLayout *)reserve(chunk->lines, chunk->lines_count,
+                                       &chunk->lines_capacity,
+                                       sizeof(LineLayout));
+
+  line = &chunk->lines[chunk->lines_count++];
+  line->line = line_number;
+  line->is_instruction = is_instruction;
+  line->size = 0;
+  line->offset = 0;
+  line->pending = chunk->pending_count;
+  line->pending_count = 0;
+
+  return line;
+}
+
+void layout_line(LayoutChunk *chunk, AST *node, int line_number) {
+  LineLayout *line = NULL;
+  int i = 0;
+
+  if (node->ASTType == DIRECTIVE && node->ASTOpt.Dir.DirOpt == ENTRY) {
+    add_entry(chunk, node->ASTOpt.Dir.ParamsOpt.label, line_number);
+    return;
+  }
+
+  if (node->ASTType != INSTRUCTION &&
+      !(node->ASTType == DIRECTIVE && (node->ASTOpt.Dir.DirOpt == DATA ||
+                                       node->ASTOpt.Dir.DirOpt == STRING))) {
+    return;
+  }
+
+  line = add_line(chunk, line_number, node->ASTType == INSTRUCTION);
+
+  if (node->ASTType == DIRECTIVE) {
+    if (node->ASTOpt.Dir.DirOpt == DATA) {
+      char **names = node->ASTOpt.Dir.ParamsOpt.Data.names;
+
+      /* Every repeat of a name is pending on it */
+      for (i = 0; i < get_data_size(node); i++) {
+        int element = i % node->ASTOpt.Dir.ParamsOpt.Data.count;
+
+        if (names == NULL || names[element] == NULL) {
+          line->size++;
+        } else {
+          add_pending(chunk, line, PENDING_SYMBOL, names[element]);
+        }
+      }
+    } else {
+      line->size = strlen(node->ASTOpt.Dir.ParamsOpt.string) + 1;
+    }
+
+    return;
+  }
+
+  /* The first word, then the operands as handle_instruction() encodes them */
+  line->size = 1;
+
+  switch (node->ASTOpt.Inst.InstType) {
+  case RTS:
+  case HLT:
+    break;
+
+  case NOT:
+  case CLR:
+  case INC:
+  case DEC:
+  case JMP:
+  case BNE:
+  case RED:
+  case PRN:
+  case JSR:
+    layout_operand(chunk, line, node, 1);
+    break;
+
+  case MOV:
+  case CMP:
+  case ADD:
+  case SUB:
+  case LEA:
+    if (node->ASTOpt.Inst.InstOperands[0].OperandType == REGISTER &&
+        node->ASTOpt.Inst.InstOperands[1].OperandType == REGISTER) {
+      line->size++;
+    } else {
+      layout_operand(chunk, line, node, 0);
+      layout_operand(chunk, line, node, 1);
+    }
+    break;
+  }
+}
+
+void layout_scanned_line(LayoutChunk *chunk, const ScannedLine *scanned,
+                         int line_number) {
+  LineLayout *line = NULL;
+
+  switch (scanned->type) {
+  case SCAN_ENTRY:
+    add_entry(chunk, scanned->name, line_number);
+    break;
+  case SCAN_INSTRUCTION:
+  case SCAN_DATA:
+  case SCAN_STRING:
+    line = add_line(chunk, line_number, scanned->type == SCAN_INSTRUCTION);
+    line->size = scanned->size;
+    break;
+  default:
+    break;
+  }
+}
+
+void resolve_layout_chunk(LayoutChunk *chunk, const SymbolIndex *index) {
+  int offset = 0;
+  int i = 0;
+  int j = 0;
+
+  chunk->instructions_end = -1;
+
+  for (i = 0; i < chunk->lines_count; i++) {
+    LineLayout *line = &chunk->lines[i];
+    Symbol *previous = NULL;
+
+    for (j = 0; j < line->pending_count; j++) {
+      PendingWord *word = &chunk->pending[line->pending + j];
+      Symbol *symbol =
+          word->name >= 0 ? index_lookup(index, chunk->names + word->name)
+                          : NULL;
+
+      switch (word->type) {
+      case PENDING_SYMBOL:
+        line->size += symbol != NULL;
+        previous = symbol;
+        break;
+      case PENDING_DEFINE:
+        line->size += symbol && attribute_at(symbol, line->line) == MDEFINE;
+        break;
+      case PENDING_INDEX_NUMBER:
+        line->size += previous != NULL;
+        break;
+      case PENDING_INDEX_DEFINE:
+        line->size += previous && symbol &&
+                      attribute_at(symbol, line->line) == MDEFINE;
+        break;
+      }
+    }
+
+    line->offset = offset;
+    offset += line->size;
+
+    if (line->is_instruction) {
+      chunk->instructions_end = offset;
+    }
+  }
+
+  chunk->size = offset;
+}
+
+void free_layout(Layout *layout) {
+  int i = 0;
+
+  for (i = 0; i < layout->chunks_count; i++) {
+    free(layout->chunks[i].lines);
+    free(layout->chunks[i].pending);
+    free(layout->chunks[i].entries);
+    free(layout->chunks[i].names);
+  }
+
+  free(layout->chunks);
+  layout->chunks = NULL;
+  layout->chunks_count = 0;
+}
@@ -0,0 +1,143 @@
+#ifndef __LAYOUT__H__
+#define __LAYOUT__H__
+
+/**
+ * @file layout.h
+ * @brief This file contains the definition and manipulation functions for the
+ * layout of the code image, the place of every line in it.
+ *
+ * The layout is recorded by the first pass for every chunk of lines it parses.
+ * The number of words of a line is known then, except for the words of its
+ * symbol operands: an undefined symbol encodes to no word and so does a label
+ * used as an immediate or an index when it is not a define. Those words are
+ * recorded as pending and resolved once the symbol table is complete, after
+ * which every line has a fixed slot in the code image and the chunks can be
+ * encoded independently.
+ */
+
+#include "parser.h"
+#include "scanner.h"
+#include "symbol_index.h"
+
+/**
+ * @brief The kinds of words whose presence depends on a symbol.
+ */
+typedef enum {
+  PENDING_SYMBOL,       /**< Present if the symbol is defined. */
+  PENDING_DEFINE,       /**< Present if the symbol is a define on the line. */
+  PENDING_INDEX_NUMBER, /**< Present if the previous symbol is defined. */
+  PENDING_INDEX_DEFINE  /**< Present if the previous symbol is defined and
+                             the symbol is a define on the line. */
+} PendingType;
+
+/**
+ * @struct PendingWord
+ * @brief A word of a line whose presence depends on a symbol.
+ */
+typedef struct {
+  PendingType type; /**< The condition of the word. */
+  int name;         /**< The offset of the symbol name, -1 if none. */
+} PendingWord;
+
+/**
+ * @struct LineLayout
+ * @brief The place of a line encoding to words in the code image.
+ */
+typedef struct {
+  int line;            /**< The line number. */
+  bool is_instruction; /**< Whether the line is an instruction. */
+  int size;            /**< The number of words of the line. */
+  int offset;          /**< The offset of the line in its chunk. */
+  int pending;         /**< The index of the first pending word. */
+  int pending_count;   /**< The number of pending words. */
+} LineLayout;
+
+/**
+ * @struct EntryLayout
+ * @brief A .entry line of a chunk.
+ */
+typedef struct {
+  int line; /**< The line number. */
+  int name; /**< The offset of the symbol name. */
+} EntryLayout;
+
+/**
+ * @struct LayoutChunk
+ * @brief The layout of a range of lines.
+ */
+typedef struct {
+  int first_line;         /**< The index of the first line of the chunk. */
+  int end_line;           /**< The index past the last line of the chunk. */
+  LineLayout *lines;      /**< The lines encoding to words, in order. */
+  int lines_count;        /**< The number of lines. */
+  int lines_capacity;     /**< The number of allocated lines. */
+  PendingWord *pending;   /**< The pending words of the lines. */
+  int pending_count;      /**< The number of pending words. */
+  int pending_capacity;   /**< The number of allocated pending words. */
+  EntryLayout *entries;   /**< The .entry lines of the chunk. */
+  int entries_count;      /**< The number of .entry lines. */
+  int entries_capacity;   /**< The number of allocated .entry lines. */
+  char *names;            /**< The symbol names, one after another. */
+  int names_size;         /**< The number of used characters in names. */
+  int names_capacity;     /**< The number of allocated characters. */
+  int size;               /**< The number of words, once resolved. */
+  int instructions_end;   /**< The end of the last instruction, or -1. */
+  int offset;             /**< The offset of the chunk in the code image. */
+} LayoutChunk;
+
+/**
+ * @struct Layout
+ * @brief The layout of the code image of a file split into chunks.
+ */
+typedef struct {
+  LayoutChunk *chunks; /**< The chunks, in source order. */
+  int chunks_count;    /**< The number of chunks. */
+  int size;            /**< The number of words, once resolved. */
+} Layout;
+
+/**
+ * @brief Initializes an empty layout with a number of chunks.
+ *
+ * @param layout The layout to initialize.
+ * @param chunks_count The number of chunks.
+ */
+void init_layout(Layout *layout, int chunks_count);
+
+/**
+ * @brief Records the place of a parsed line in the layout of its chunk.
+ *
+ * @param chunk The chunk of the line.
+ * @param node The parsed line.
+ * @param line The line number.
+ */
+void layout_line(LayoutChunk *chunk, AST *node, int line);
+
+/**
+ * @brief Records the place of a scanned line in the layout of its chunk.
+ *
+ * The line must not refer to symbols, so that its size is final.
+ *
+ * @param chunk The chunk of the line.
+ * @param scanned The scanned line.
+ * @param line The line number.
+ */
+void layout_scanned_line(LayoutChunk *chunk, const ScannedLine *scanned,
+                         int line);
+
+/**
+ * @brief Resolves the pending words of a chunk against a complete symbol
+ * table, fixing the size and the offset of its lines.
+ *
+ * @param chunk The chunk to resolve.
+ * @param index The index of the symbol table.
+ */
+void resolve_layout_chunk(LayoutChunk *chunk, const SymbolIndex *index);
+
+/**
+ * @brief Frees the memory allocated for a layout.
+ *
+ * @param layout The layout to free.
+ */
+void free_layout(Layout *layout);
+
+#endif
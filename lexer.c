@@ -5,12 +5,25 @@
 #include <stdlib.h>
 #include <string.h>
 
+static void reserve_tokens(Tokens *tokens, int count) {
+  tokens->tokens = (char **)realloc(tokens->tokens, count * sizeof(char *));
+  tokens->columns = (int *)realloc(tokens->columns, count * sizeof(int));
+
+  if (tokens->tokens == NULL || tokens->columns == NULL) {
+    fprintf(stderr, ERROR_OUT_OF_MEMORY);
+    exit(EXIT_FAILURE);
+  }
+}
+
 Tokens *split_line_to_tokens(char *line) {
   int strings_count = 0;
   char *str = NULL;
+  char *line_start = line;
 
   Tokens *tokens = (Tokens *)malloc(sizeof(Tokens));
   tokens->tokens = NULL;
+  tokens->columns = NULL;
+  tokens->count = 0;
 
   while (isspace(*line)) {
     line++;
@@ -29,13 +42,21 @@ Tokens *split_line_to_tokens(char *line) {
     line[strlen(line) - 1] = '\0';
   }
 
-  str = strtok(line, " \t");
+  str = line + strspn(line, " \t");
 
-  while (str != NULL) {
-    char *comma = strchr(str, ',');
+  while (*str != '\0') {
+    /* A closed string literal is part of one token, spaces and commas too */
+    const char *quote = *str == '"' ? find_string_end(str) : NULL;
+    char *rest = quote ? (char *)quote + 1 : str;
+    char *end = rest + strcspn(rest, " \t");
+    char *next = *end == '\0' ? end : end + 1;
+    char *comma = NULL;
     int commas_count = 0;
     int i = 0;
 
+    *end = '\0';
+    comma = strchr(rest, ',');
+
     if (comma) {
       for (i = 0; i < strlen(comma); i++) {
         commas_count++;
@@ -44,34 +65,24 @@ Tokens *split_line_to_tokens(char *line) {
     }
 
     if (str[0] != '\0') {
-      tokens->tokens = (char **)realloc(tokens->tokens,
-                                        (strings_count + 1) * sizeof(char *));
-      if (tokens->tokens == NULL) {
-        fprintf(stderr, ERROR_OUT_OF_MEMORY);
-        exit(EXIT_FAILURE);
-      }
+      reserve_tokens(tokens, strings_count + 1);
 
       tokens->tokens[strings_count] = strdup(str);
+      tokens->columns[strings_count] = str - line_start + 1;
       strings_count++;
     }
 
     if (comma) {
-      tokens->tokens = (char **)realloc(
-          tokens->tokens, (strings_count + commas_count) * sizeof(char *));
-      if (tokens->tokens == NULL) {
-        fprintf(stderr, ERROR_OUT_OF_MEMORY);
-        exit(EXIT_FAILURE);
-      }
+      reserve_tokens(tokens, strings_count + commas_count);
 
       for (i = 0; i < commas_count; i++) {
         tokens->tokens[strings_count] = strdup(",");
+        tokens->columns[strings_count] = comma - line_start + 1 + i;
         strings_count++;
       }
-
-      str = strtok(NULL, " \t");
-    } else {
-      str = strtok(NULL, " \t");
     }
+
+    str = next + strspn(next, " \t");
   }
 
   tokens->count = strings_count;
@@ -84,26 +95,17 @@ void remove_token(Tokens *t, const char *token_to_remove) {
 
   for (i = 0; i < t->count; i++) {
     if (strcmp((t->tokens)[i], token_to_remove) == 0) {
-      char **temp = NULL;
-
+      free(t->tokens[i]);
       t->tokens[i] = NULL;
 
       for (j = i; j < t->count - 1; j++) {
         (t->tokens)[j] = (t->tokens)[j + 1];
+        (t->columns)[j] = (t->columns)[j + 1];
       }
 
       (t->tokens)[t->count - 1] = NULL;
       t->count--;
 
-      temp = realloc(t->tokens, t->count * sizeof(char *));
-
-      if (temp == NULL) {
-        fprintf(stderr, ERROR_OUT_OF_MEMORY);
-        exit(EXIT_FAILURE);
-      }
-
-      t->tokens = temp;
-
       break;
     }
   }
@@ -113,11 +115,11 @@ void free_tokens(Tokens *tokens) {
   int i = 0;
 
   for (i = 0; i < tokens->count; i++) {
-    if (tokens->tokens[i] != NULL) {
-      tokens->tokens[i] = NULL;
-    }
+    free(tokens->tokens[i]);
+    tokens->tokens[i] = NULL;
   }
 
   free(tokens->tokens);
+  free(tokens->columns);
   free(tokens);
 }
\ No newline at end of file
@@ -23,11 +23,16 @@
  * Member 'tokens' is a pointer to an array of strings, each representing a
  * token.
  *
+ * @param columns
+ * Member 'columns' is a pointer to an array of integers, each representing the
+ * column where the matching token starts in the line.
+ *
  * @param count
  * Member 'count' is an integer that represents the number of tokens.
  */
 typedef struct Tokens {
   char **tokens;
+  int *columns;
   int count;
 } Tokens;
 
@@ -35,10 +40,11 @@ typedef struct Tokens {
  * @brief Splits a line into tokens.
  *
  * This function takes a line of text and splits it into tokens based on
- * whitespace and commas. Each token is stored in a dynamically allocated array
- * of strings. The function also counts the number of tokens and stores it in
- * the Tokens structure. If memory allocation fails, the function prints an
- * error message and exits the program.
+ * whitespace and commas. A string literal in quotes is kept in a single token
+ * with its spaces and commas, its escaped quotes not closing it. Each token is
+ * stored in a dynamically allocated array of strings. The function also counts
+ * the number of tokens and stores it in the Tokens structure. If memory
+ * allocation fails, the function prints an error message and exits the program.
  *
  * @param line The line of text to split into tokens.
  * @return A Tokens structure containing the tokens and the count of tokens.
@@ -49,10 +55,8 @@ Tokens* split_line_to_tokens(char *line);
  * @brief Removes a specific token from a Tokens structure.
  *
  * This function takes a Tokens structure and a token, and removes the first
- * occurrence of the token from the Tokens structure. The function also
- * reallocates the memory for the tokens array in the Tokens structure to match
- * the new number of tokens. If memory allocation fails, the function prints an
- * error message and exits the program.
+ * occurrence of the token from the Tokens structure, freeing its string. The
+ * tokens after it are moved back by one place.
  *
  * @param t A pointer to the Tokens structure.
  * @param token_to_remove The token to remove.
@@ -62,9 +66,8 @@ void remove_token(Tokens *t, const char *token_to_remove);
 /**
  * @brief Frees the memory allocated for a Tokens structure.
  *
- * This function takes a pointer to a Tokens structure and frees the memory
- * allocated for the tokens array in the structure. It also sets the pointers in
- * the tokens array and the tokens array itself to NULL.
+ * This function takes a pointer to a Tokens structure and frees the strings of
+ * the tokens, the tokens array and the structure itself.
  *
  * @param tokens A pointer to the Tokens structure to free.
  */
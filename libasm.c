@@ -0,0 +1,210 @@
+#include "libasm.h"
+#include "assembler.h"
+#include "errors.h"
+#include "preprocessor.h"
+
+void asm_init_context(AsmContext *context) {
+  context->symbol_table = NULL;
+  context->instruction_counter = 0;
+  context->data_counter = 0;
+}
+
+void asm_free_context(AsmContext *context) {
+  free_table(context->symbol_table);
+  asm_init_context(context);
+}
+
+void asm_copy_context(AsmContext *copy, const AsmContext *context) {
+  const Symbol *symbol = NULL;
+  Symbol **last = &copy->symbol_table;
+
+  *copy = *context;
+  copy->symbol_table = NULL;
+
+  for (symbol = context->symbol_table; symbol; symbol = symbol->next) {
+    *last = (Symbol *)malloc(sizeof(Symbol));
+
+    if (*last == NULL) {
+      fprintf(stderr, ERROR_OUT_OF_MEMORY);
+      exit(EXIT_FAILURE);
+    }
+
+    **last = *symbol;
+    last = &(*last)->next;
+  }
+
+  *last = NULL;
+}
+
+bool asm_same_context(const AsmContext *context, const AsmContext *other) {
+  const Symbol *symbol = context->symbol_table;
+  const Symbol *other_symbol = other->symbol_table;
+
+  if (context->instruction_counter != other->instruction_counter ||
+      context->data_counter != other->data_counter) {
+    return false;
+  }
+
+  for (; symbol && other_symbol;
+       symbol = symbol->next, other_symbol = other_symbol->next) {
+    if (strcmp(symbol->symbol_name, other_symbol->symbol_name) != 0 ||
+        symbol->attribute != other_symbol->attribute ||
+        symbol->value != other_symbol->value ||
+        symbol->entry_line != other_symbol->entry_line) {
+      return false;
+    }
+  }
+
+  return symbol == NULL && other_symbol == NULL;
+}
+
+/* Runs both passes over the expanded source, leaving the state in context */
+static void assemble_source(AsmContext *context, const AsmOptions *options,
+                            AsmResult *result) {
+  Translator *translator = NULL;
+  SourceFile *source = &result->source;
+  SourceFile optimized;
+  Layout layout;
+  bool has_error = false;
+
+  /* The passes read the optimized copy, the result keeps the expanded source */
+  if ((options->optimize || options->strip) && !options->check_only &&
+      optimize_source(&result->source, context->symbol_table,
+                      options->optimize, options->strip, &optimized,
+                      &result->optimizations)) {
+    source = &optimized;
+  }
+
+  if (options->threads_count > 0) {
+    has_error = do_parallel_first_pass(&context->symbol_table, source,
+                                       &result->diagnostics,
+                                       options->threads_count,
+                                       options->check_only ? NULL : &layout);
+  } else {
+    has_error =
+        do_first_pass(&context->symbol_table, source, &result->diagnostics);
+  }
+
+  result->first_pass_diagnostics = result->diagnostics.count;
+
+  if (has_error) {
+    result->status = ASM_FIRST_PASS_FAILED;
+  } else if (options->check_only) {
+    has_error =
+        do_check_pass(&context->symbol_table, source, &result->diagnostics);
+    result->status = has_error ? ASM_SECOND_PASS_FAILED : ASM_OK;
+  } else {
+    if (options->threads_count > 0) {
+      has_error = do_parallel_second_pass(
+          &translator, &context->symbol_table, source, &layout,
+          &context->instruction_counter, &context->data_counter,
+          &result->diagnostics);
+    } else {
+      has_error = do_second_pass(&translator, &context->symbol_table, source,
+                                 &context->instruction_counter,
+                                 &context->data_counter, &result->diagnostics);
+    }
+
+    result->status = has_error ? ASM_SECOND_PASS_FAILED : ASM_OK;
+  }
+
+  if (options->threads_count > 0 && !options->check_only) {
+    free_layout(&layout);
+  }
+
+  if (translator) {
+    /* The result takes over the code image and the symbol lists */
+    result->words = translator->code_image->words;
+    result->words_count = translator->code_image->count;
+    result->entries = translator->internal_symbols;
+    result->externals = translator->external_symbols;
+    translator->code_image->words = NULL;
+    translator->internal_symbols = NULL;
+    translator->external_symbols = NULL;
+
+    if (options->line_table) {
+      map_line_table(&translator->lines, source, &result->origins);
+      result->lines = translator->lines;
+      init_line_table(&translator->lines);
+    }
+
+    free_translator(translator);
+  }
+
+  if (source != &result->source) {
+    free_source(source);
+  }
+
+  result->instructions_count = context->instruction_counter;
+  result->data_count = context->data_counter;
+}
+
+bool asm_expand(const char *name, const char *text, long size,
+                AsmResult *result) {
+  char *expanded = NULL;
+  long expanded_size = 0;
+
+  result->status = ASM_OK;
+  result->words = NULL;
+  result->words_count = 0;
+  result->instructions_count = 0;
+  result->data_count = 0;
+  result->entries = NULL;
+  result->externals = NULL;
+  result->first_pass_diagnostics = 0;
+  init_peephole_report(&result->optimizations);
+  init_source_map(&result->origins);
+  init_line_table(&result->lines);
+  init_diagnostics(&result->diagnostics, name);
+
+  if (!expand_macros(text, size, &expanded, &expanded_size, &result->origins,
+                     &result->diagnostics)) {
+    result->status = ASM_PREPROCESS_FAILED;
+  }
+
+  init_source(&result->source, expanded, expanded_size);
+  result->first_pass_diagnostics = result->diagnostics.count;
+
+  return result->status == ASM_OK;
+}
+
+bool asm_assemble_expanded(AsmContext *context, const AsmOptions *options,
+                           AsmResult *result) {
+  AsmContext own_context;
+
+  if (result->status != ASM_OK) {
+    return false;
+  }
+
+  if (context) {
+    assemble_source(context, options, result);
+  } else {
+    asm_init_context(&own_context);
+    assemble_source(&own_context, options, result);
+    asm_free_context(&own_context);
+  }
+
+  return result->status == ASM_OK;
+}
+
+bool asm_assemble(AsmContext *context, const char *name, const char *text,
+                  long size, const AsmOptions *options, AsmResult *result) {
+  asm_expand(name, text, size, result);
+
+  return asm_assemble_expanded(context, options, result);
+}
+
+void asm_free_result(AsmResult *result) {
+  free(result->words);
+  free_table(result->entries);
+  free_table(result->externals);
+  free_diagnostics(&result->diagnostics);
+  free_peephole_report(&result->optimizations);
+  free_source_map(&result->origins);
+  free_line_table(&result->lines);
+  free_source(&result->source);
+
+  result->words = NULL;
+  result->entries = NULL;
+  result->externals = NULL;
+}
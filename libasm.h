@@ -0,0 +1,180 @@
+#ifndef __LIBASM__H__
+#define __LIBASM__H__
+
+/**
+ * @file libasm.h
+ * @brief This file contains the definition of the embeddable assembler
+ * library.
+ *
+ * The library assembles a source held in memory into a result object, without
+ * touching any file and without any global or static state: everything an
+ * assembly reads or writes is reached from its arguments. Several assemblies
+ * can therefore run at once on different threads, as long as they do not share
+ * a context.
+ */
+
+#include "diagnostics.h"
+#include "line_table.h"
+#include "peephole.h"
+#include "source.h"
+#include "symbol_table.h"
+#include <stdbool.h>
+
+/**
+ * @brief The outcome of an assembly.
+ */
+typedef enum {
+  ASM_OK,                  /**< The machine code was generated. */
+  ASM_PREPROCESS_FAILED,   /**< A macro is invalid. */
+  ASM_FIRST_PASS_FAILED,   /**< The first pass found errors. */
+  ASM_SECOND_PASS_FAILED   /**< The second pass found errors. */
+} AsmStatus;
+
+/**
+ * @struct AsmOptions
+ * @brief The options of an assembly.
+ */
+typedef struct {
+  int threads_count; /**< The threads of the chunked passes, 0 to run the
+                        sequential ones. */
+  bool check_only;   /**< Whether to stop once the references are validated,
+                        without encoding the machine code. The result then
+                        has diagnostics but no words or symbol lists. */
+  bool optimize;     /**< Whether to remove the redundant instructions before
+                        the passes, see optimize_source(). */
+  bool strip;        /**< Whether to remove the code and the data that the
+                        entries and the first instruction do not reach
+                        before the passes. */
+  bool line_table;   /**< Whether to keep the table of the lines the words
+                        of the code image come from. */
+} AsmOptions;
+
+/**
+ * @struct AsmContext
+ * @brief The state shared by the assemblies of several sources.
+ *
+ * The command line assembler keeps the symbol table and the counters from one
+ * file to the next, so the symbols of a file are visible to the files after
+ * it. An assembly given a context starts from that state and leaves its own in
+ * it; an assembly without a context starts from scratch.
+ */
+typedef struct {
+  Symbol *symbol_table;    /**< The symbols defined so far. */
+  int instruction_counter; /**< The instruction counter of the last file. */
+  int data_counter;        /**< The number of data words encoded so far. */
+} AsmContext;
+
+/**
+ * @struct AsmResult
+ * @brief The result of an assembly.
+ */
+typedef struct {
+  AsmStatus status;           /**< The outcome of the assembly. */
+  SourceFile source;          /**< The source after the macro expansion. */
+  int *words;                 /**< The words of the code image. */
+  int words_count;            /**< The number of words of the code image. */
+  int instructions_count;     /**< The instruction count of the header. */
+  int data_count;             /**< The data count of the header. */
+  Symbol *entries;            /**< The internal symbols and their addresses. */
+  Symbol *externals;          /**< The uses of the external symbols. */
+  DiagnosticList diagnostics; /**< The diagnostics of all the stages. */
+  int first_pass_diagnostics; /**< The number of diagnostics recorded by the
+                                 macro expansion and the first pass, before
+                                 the ones of the second pass. */
+  PeepholeReport optimizations; /**< The lines removed when optimizing or
+                                   stripping. The source keeps them. */
+  SourceMap origins;            /**< The lines of the assembly source the
+                                   lines of the expanded source come from. */
+  LineTable lines;              /**< The lines of the assembly source the
+                                   words come from, when asked for. */
+} AsmResult;
+
+/**
+ * @brief Initializes an empty context.
+ *
+ * @param context The context to initialize.
+ */
+void asm_init_context(AsmContext *context);
+
+/**
+ * @brief Frees the memory allocated for a context.
+ *
+ * @param context The context to free.
+ */
+void asm_free_context(AsmContext *context);
+
+/**
+ * @brief Copies a context, so that assemblies can later start again from the
+ * state it holds now.
+ *
+ * @param copy The context to initialize as a copy, freed with
+ * asm_free_context().
+ * @param context The context to copy.
+ */
+void asm_copy_context(AsmContext *copy, const AsmContext *context);
+
+/**
+ * @brief Tells whether two contexts hold the same state, in which case an
+ * assembly started from either has the same result.
+ *
+ * @param context The first context.
+ * @param other The second context.
+ * @return true if both have the same symbols, in the same order, and the same
+ * counters.
+ */
+bool asm_same_context(const AsmContext *context, const AsmContext *other);
+
+/**
+ * @brief Assembles a source held in memory.
+ *
+ * @param context The state shared with other assemblies, or NULL for an
+ * independent assembly.
+ * @param name The name reported in the diagnostics. It must outlive the
+ * result.
+ * @param text The source, followed by a null character.
+ * @param size The number of characters of the source.
+ * @param options The options of the assembly.
+ * @param result The result to fill, freed with asm_free_result().
+ * @return true if the machine code was generated, false otherwise.
+ */
+bool asm_assemble(AsmContext *context, const char *name, const char *text,
+                  long size, const AsmOptions *options, AsmResult *result);
+
+/**
+ * @brief Expands the macros of a source held in memory, the first step of
+ * asm_assemble().
+ *
+ * Takes no context, so the sources of several assemblies can be expanded
+ * ahead of the assemblies sharing a context.
+ *
+ * @param name The name reported in the diagnostics. It must outlive the
+ * result.
+ * @param text The source, followed by a null character.
+ * @param size The number of characters of the source.
+ * @param result The result to fill, freed with asm_free_result().
+ * @return true if the source was expanded, false if a macro is invalid.
+ */
+bool asm_expand(const char *name, const char *text, long size,
+                AsmResult *result);
+
+/**
+ * @brief Assembles a source expanded by asm_expand(), the second step of
+ * asm_assemble().
+ *
+ * @param context The state shared with other assemblies, or NULL for an
+ * independent assembly.
+ * @param options The options of the assembly.
+ * @param result The result of asm_expand() to complete.
+ * @return true if the machine code was generated, false otherwise.
+ */
+bool asm_assemble_expanded(AsmContext *context, const AsmOptions *options,
+                           AsmResult *result);
+
+/**
+ * @brief Frees the memory allocated for a result.
+ *
+ * @param result The result to free.
+ */
+void asm_free_result(AsmResult *result);
+
+#endif
@@ -0,0 +1,144 @@
+#include "line_table.h"
+#include "errors.h"
+#include <stdio.h>
+#include <stdlib.h>
+
+void init_source_map(SourceMap *map) {
+  map->origins = NULL;
+  map->count = 0;
+  map->capacity = 0;
+}
+
+void add_source_origin(SourceMap *map, long start, int line, int call_line) {
+  if (map->count == map->capacity) {
+    int capacity = map->capacity ? 2 * map->capacity : 8;
+    SourceOrigin *temp =
+        realloc(map->origins, capacity * sizeof(SourceOrigin));
+
+    if (temp == NULL) {
+      fprintf(stderr, ERROR_OUT_OF_MEMORY);
+      exit(EXIT_FAILURE);
+    }
+
+    map->origins = temp;
+    map->capacity = capacity;
+  }
+
+  map->origins[map->count].start = start;
+  map->origins[map->count].line = line;
+  map->origins[map->count].call_line = call_line;
+  map->count++;
+}
+
+void free_source_map(SourceMap *map) {
+  free(map->origins);
+  init_source_map(map);
+}
+
+void init_line_table(LineTable *table) {
+  table->runs = NULL;
+  table->count = 0;
+  table->capacity = 0;
+}
+
+void add_line_run(LineTable *table, int address, int line) {
+  if (table->count > 0 && table->runs[table->count - 1].line == line) {
+    return;
+  }
+
+  append_line_run(table, address, line, 0);
+}
+
+void append_line_run(LineTable *table, int address, int line, int call_line) {
+  if (table->count == table->capacity) {
+    int capacity = table->capacity ? 2 * table->capacity : 16;
+    LineRun *temp = realloc(table->runs, capacity * sizeof(LineRun));
+
+    if (temp == NULL) {
+      fprintf(stderr, ERROR_OUT_OF_MEMORY);
+      exit(EXIT_FAILURE);
+    }
+
+    table->runs = temp;
+    table->capacity = capacity;
+  }
+
+  table->runs[table->count].address = address;
+  table->runs[table->count].line = line;
+  table->runs[table->count].call_line = call_line;
+  table->count++;
+}
+
+const LineRun *find_line_run(const LineTable *table, int address) {
+  int low = 0;
+  int high = table->count - 1;
+
+  if (table->count == 0 || address < table->runs[0].address) {
+    return NULL;
+  }
+
+  /* The last run starting at or before the address */
+  while (low < high) {
+    int middle = (low + high + 1) / 2;
+
+    if (table->runs[middle].address <= address) {
+      low = middle;
+    } else {
+      high = middle - 1;
+    }
+  }
+
+  return &table->runs[low];
+}
+
+void map_line_table(LineTable *table, const SourceFile *source,
+                    const SourceMap *map) {
+  const SourceOrigin *origin = map->origins;
+  const SourceOrigin *end = map->origins + map->count;
+  long position = 0;
+  int newlines = 0;
+  int count = 0;
+  int i = 0;
+
+  if (map->count == 0) {
+    return;
+  }
+
+  position = origin->start;
+
+  /* The runs are in source order, so the text is only walked once */
+  for (i = 0; i < table->count; i++) {
+    LineRun run = table->runs[i];
+    long offset = source->line_starts[run.line - 1];
+
+    while (origin + 1 < end && origin[1].start <= offset) {
+      origin++;
+      position = origin->start;
+      newlines = 0;
+    }
+
+    for (; position < offset; position++) {
+      if (source->text[position] == '\n') {
+        newlines++;
+      }
+    }
+
+    run.line = origin->line + newlines;
+    run.call_line = origin->call_line;
+
+    /* A line split by the length limit maps to the line it was split from */
+    if (count > 0 && table->runs[count - 1].line == run.line &&
+        table->runs[count - 1].call_line == run.call_line) {
+      continue;
+    }
+
+    table->runs[count++] = run;
+  }
+
+  table->count = count;
+}
+
+void free_line_table(LineTable *table) {
+  free(table->runs);
+  init_line_table(table);
+}
@@ -0,0 +1,146 @@
+#ifndef __LINE_TABLE__H__
+#define __LINE_TABLE__H__
+
+/**
+ * @file line_table.h
+ * @brief This file contains the definition of the table mapping the addresses
+ * of the code image back to the lines of the assembly file.
+ *
+ * The passes number the lines of the expanded source, which the macro
+ * expansion shifts. The preprocessor records where the lines of the expanded
+ * source come from as runs of consecutive lines, and the second pass records
+ * the first word of every line encoding words. Mapping the lines recorded by
+ * the second pass through the runs of the preprocessor gives a table of
+ * address runs, each naming the line of the assembly file its words come
+ * from and the macro call that expanded it.
+ */
+
+#include "source.h"
+
+/**
+ * @struct SourceOrigin
+ * @brief A run of lines of the expanded source coming from consecutive lines
+ * of the assembly file.
+ */
+typedef struct {
+  long start;    /**< The offset of the first line in the expanded source. */
+  int line;      /**< The line of the assembly file of the first line. */
+  int call_line; /**< The line of the macro call the lines were expanded
+                    from, 0 outside of macros. */
+} SourceOrigin;
+
+/**
+ * @struct SourceMap
+ * @brief The origins of the lines of an expanded source, in source order.
+ */
+typedef struct {
+  SourceOrigin *origins; /**< The runs of lines. */
+  int count;             /**< The number of runs. */
+  int capacity;          /**< The number of allocated runs. */
+} SourceMap;
+
+/**
+ * @struct LineRun
+ * @brief The words of the code image coming from a single line.
+ */
+typedef struct {
+  int address;   /**< The index of the first word in the code image. */
+  int line;      /**< The line the words come from. */
+  int call_line; /**< The line of the macro call it was expanded from, 0
+                    outside of macros. */
+} LineRun;
+
+/**
+ * @struct LineTable
+ * @brief The runs of words of a code image, in address order.
+ *
+ * A run ends where the next one starts, the last one at the end of the code
+ * image.
+ */
+typedef struct {
+  LineRun *runs; /**< The runs of words. */
+  int count;     /**< The number of runs. */
+  int capacity;  /**< The number of allocated runs. */
+} LineTable;
+
+/**
+ * @brief Initializes an empty source map.
+ *
+ * @param map The map to initialize.
+ */
+void init_source_map(SourceMap *map);
+
+/**
+ * @brief Starts a run of lines of an expanded source, at a line that does not
+ * follow the last line of the last run in the assembly file.
+ *
+ * @param map The map to add the run to.
+ * @param start The offset of the line in the expanded source.
+ * @param line The line of the assembly file it comes from.
+ * @param call_line The line of the macro call it was expanded from, or 0.
+ */
+void add_source_origin(SourceMap *map, long start, int line, int call_line);
+
+/**
+ * @brief Frees the memory allocated for a source map.
+ *
+ * @param map The map to free.
+ */
+void free_source_map(SourceMap *map);
+
+/**
+ * @brief Initializes an empty line table.
+ *
+ * @param table The table to initialize.
+ */
+void init_line_table(LineTable *table);
+
+/**
+ * @brief Records the words a line encoded, unless the last run is already
+ * the one of that line.
+ *
+ * @param table The table to record the words in.
+ * @param address The index of the first word of the line in the code image.
+ * @param line The line of the expanded source.
+ */
+void add_line_run(LineTable *table, int address, int line);
+
+/**
+ * @brief Adds a run after the last one of a table, as read back from a map
+ * file.
+ *
+ * @param table The table to add the run to.
+ * @param address The index of the first word of the run in the code image.
+ * @param line The line of the assembly file the words come from.
+ * @param call_line The line of the macro call it was expanded from, or 0.
+ */
+void append_line_run(LineTable *table, int address, int line, int call_line);
+
+/**
+ * @brief Finds the run holding a word of the code image.
+ *
+ * @param table The table to search.
+ * @param address The index of the word in the code image.
+ * @return The last run starting at or before the word, NULL if there is none.
+ */
+const LineRun *find_line_run(const LineTable *table, int address);
+
+/**
+ * @brief Maps the lines of the expanded source of a table to the lines of
+ * the assembly file, joining the runs that then come from the same line.
+ *
+ * @param table The table, whose lines are the ones of the expanded source.
+ * @param source The expanded source.
+ * @param map The origins of the lines of the expanded source.
+ */
+void map_line_table(LineTable *table, const SourceFile *source,
+                    const SourceMap *map);
+
+/**
+ * @brief Frees the memory allocated for a line table.
+ *
+ * @param table The table to free.
+ */
+void free_line_table(LineTable *table);
+
+#endif
@@ -0,0 +1,666 @@
+#include "machine.h"
+#include "converter.h"
+#include "cost_model.h"
+#include "coverage.h"
+#include "errors.h"
+#include "profiler.h"
+#include "trace.h"
+#include <string.h>
+
+extern Instruction inst_table[INST_TABLE_SIZE];
+
+const int opcode_accesses[INST_TABLE_SIZE] = {
+    ACCESS_READS_SOURCE | ACCESS_WRITES_DESTINATION,
+    ACCESS_READS_SOURCE | ACCESS_READS_DESTINATION,
+    ACCESS_READS_SOURCE | ACCESS_READS_DESTINATION | ACCESS_WRITES_DESTINATION,
+    ACCESS_READS_SOURCE | ACCESS_READS_DESTINATION | ACCESS_WRITES_DESTINATION,
+    ACCESS_READS_DESTINATION | ACCESS_WRITES_DESTINATION,
+    ACCESS_WRITES_DESTINATION,
+    ACCESS_WRITES_DESTINATION,
+    ACCESS_READS_DESTINATION | ACCESS_WRITES_DESTINATION,
+    ACCESS_READS_DESTINATION | ACCESS_WRITES_DESTINATION,
+    0,
+    0,
+    ACCESS_WRITES_DESTINATION,
+    ACCESS_READS_DESTINATION,
+    0,
+    0,
+    0};
+
+int word_value(int word) {
+  word = to_word(word);
+
+  return word & 0x2000 ? word - 0x4000 : word;
+}
+
+/* Gets the signed value of the 12 bits of an operand word above the A,R,E */
+static int operand_value(int word) {
+  word = to_word(word) >> 2;
+
+  return word & 0x800 ? word - 0x1000 : word;
+}
+
+static void stop_invalid_instruction(Machine *machine,
+                                     const DecodedInstruction *instruction) {
+  machine->status = MACHINE_INVALID_INSTRUCTION;
+}
+
+static void stop_outside_image(Machine *machine,
+                               const DecodedInstruction *instruction) {
+  machine->status = MACHINE_OUTSIDE_IMAGE;
+}
+
+static void stop_invalid_address(Machine *machine,
+                                 const DecodedInstruction *instruction) {
+  machine->status = MACHINE_INVALID_ADDRESS;
+}
+
+static void stop_unresolved_external(Machine *machine,
+                                     const DecodedInstruction *instruction) {
+  machine->status = MACHINE_UNRESOLVED_EXTERNAL;
+}
+
+static void stop_at_breakpoint(Machine *machine,
+                               const DecodedInstruction *instruction) {
+  machine->status = MACHINE_BREAKPOINT;
+}
+
+/* Decodes an instruction written since it was, keeping its breakpoint */
+static void decode_again(Machine *machine, int address) {
+  DecodedInstruction *decoded = &machine->decoded[address];
+
+  decode_instruction(machine, address, decoded);
+
+  if (machine->is_breakpoint[address]) {
+    decoded->handler = stop_at_breakpoint;
+  }
+}
+
+static void execute_undecoded(Machine *machine,
+                              const DecodedInstruction *instruction) {
+  DecodedInstruction *decoded = &machine->decoded[machine->pc];
+
+  decode_again(machine, machine->pc);
+  decoded->handler(machine, decoded);
+}
+
+static int read_operand(const Machine *machine,
+                        const MachineOperand *operand) {
+  switch (operand->mode) {
+  case MODE_IMMEDIATE:
+    return to_word(operand->value);
+  case MODE_REGISTER:
+    return machine->registers[operand->value];
+  default:
+    return machine->memory[operand->value];
+  }
+}
+
+/* Adds the page of an address to the pages written since the snapshot */
+static void mark_page_dirty(Machine *machine, int address) {
+  int page = address / MACHINE_PAGE_SIZE;
+
+  if (!machine->is_page_dirty[page]) {
+    machine->is_page_dirty[page] = true;
+    machine->dirty_pages[machine->dirty_pages_count++] = page;
+  }
+}
+
+static void write_operand(Machine *machine, const MachineOperand *operand,
+                          int word) {
+  int address = operand->value;
+  int first = address - MACHINE_MAX_INSTRUCTION_SIZE + 1;
+
+  if (operand->mode == MODE_REGISTER) {
+    machine->registers[operand->value] = to_word(word);
+    return;
+  }
+
+  machine->memory[address] = to_word(word);
+  mark_page_dirty(machine, address);
+
+  if (address >= machine->image_end) {
+    return;
+  }
+
+  /* The instructions the word can belong to are decoded again */
+  first = first < IMAGE_START ? IMAGE_START : first;
+  mark_page_dirty(machine, first);
+
+  for (; first <= address; first++) {
+    machine->decoded[first].handler = execute_undecoded;
+  }
+}
+
+/* Moves the program counter to the address a jump names */
+static bool jump(Machine *machine, const MachineOperand *operand) {
+  int target = operand->value;
+
+  if (operand->mode == MODE_REGISTER) {
+    target = machine->registers[operand->value];
+  }
+
+  if (target >= MAX_MEMORY_SIZE) {
+    machine->status = MACHINE_INVALID_ADDRESS;
+    return false;
+  }
+
+  machine->pc = target;
+
+  return true;
+}
+
+static void execute_mov(Machine *machine,
+                        const DecodedInstruction *instruction) {
+  write_operand(machine, &instruction->operands[1],
+                read_operand(machine, &instruction->operands[0]));
+  machine->pc += instruction->size;
+}
+
+static void execute_cmp(Machine *machine,
+                        const DecodedInstruction *instruction) {
+  machine->is_zero =
+      to_word(read_operand(machine, &instruction->operands[0]) -
+              read_operand(machine, &instruction->operands[1])) == 0;
+  machine->pc += instruction->size;
+}
+
+static void execute_add(Machine *machine,
+                        const DecodedInstruction *instruction) {
+  write_operand(machine, &instruction->operands[1],
+                read_operand(machine, &instruction->operands[1]) +
+                    read_operand(machine, &instruction->operands[0]));
+  machine->pc += instruction->size;
+}
+
+static void execute_sub(Machine *machine,
+                        const DecodedInstruction *instruction) {
+  write_operand(machine, &instruction->operands[1],
+                read_operand(machine, &instruction->operands[1]) -
+                    read_operand(machine, &instruction->operands[0]));
+  machine->pc += instruction->size;
+}
+
+static void execute_not(Machine *machine,
+                        const DecodedInstruction *instruction) {
+  write_operand(machine, &instruction->operands[1],
+                ~read_operand(machine, &instruction->operands[1]));
+  machine->pc += instruction->size;
+}
+
+static void execute_clr(Machine *machine,
+                        const DecodedInstruction *instruction) {
+  write_operand(machine, &instruction->operands[1], 0);
+  machine->pc += instruction->size;
+}
+
+static void execute_lea(Machine *machine,
+                        const DecodedInstruction *instruction) {
+  write_operand(machine, &instruction->operands[1],
+                instruction->operands[0].value);
+  machine->pc += instruction->size;
+}
+
+static void execute_inc(Machine *machine,
+                        const DecodedInstruction *instruction) {
+  write_operand(machine, &instruction->operands[1],
+                read_operand(machine, &instruction->operands[1]) + 1);
+  machine->pc += instruction->size;
+}
+
+static void execute_dec(Machine *machine,
+                        const DecodedInstruction *instruction) {
+  write_operand(machine, &instruction->operands[1],
+                read_operand(machine, &instruction->operands[1]) - 1);
+  machine->pc += instruction->size;
+}
+
+static void execute_jmp(Machine *machine,
+                        const DecodedInstruction *instruction) {
+  jump(machine, &instruction->operands[1]);
+}
+
+static void execute_bne(Machine *machine,
+                        const DecodedInstruction *instruction) {
+  if (machine->is_zero) {
+    machine->pc += instruction->size;
+  } else {
+    jump(machine, &instruction->operands[1]);
+  }
+}
+
+static void execute_red(Machine *machine,
+                        const DecodedInstruction *instruction) {
+  int c = getc(machine->input);
+
+  write_operand(machine, &instruction->operands[1], c == EOF ? -1 : c);
+  machine->pc += instruction->size;
+}
+
+static void execute_prn(Machine *machine,
+                        const DecodedInstruction *instruction) {
+  fprintf(machine->output, "%d\n",
+          word_value(read_operand(machine, &instruction->operands[1])));
+  machine->pc += instruction->size;
+}
+
+static void execute_jsr(Machine *machine,
+                        const DecodedInstruction *instruction) {
+  int return_address = machine->pc + instruction->size;
+
+  if (machine->stack_count == MACHINE_STACK_SIZE) {
+    machine->status = MACHINE_STACK_OVERFLOW;
+    return;
+  }
+
+  if (jump(machine, &instruction->operands[1])) {
+    machine->stack[machine->stack_count++] = return_address;
+  }
+}
+
+static void execute_rts(Machine *machine,
+                        const DecodedInstruction *instruction) {
+  /* Returning from the program ends it */
+  if (machine->stack_count == 0) {
+    machine->status = MACHINE_HALTED;
+    return;
+  }
+
+  machine->pc = machine->stack[--machine->stack_count];
+}
+
+static void execute_hlt(Machine *machine,
+                        const DecodedInstruction *instruction) {
+  machine->status = MACHINE_HALTED;
+}
+
+/* The handlers, by opcode */
+static const InstructionHandler handlers[INST_TABLE_SIZE] = {
+    execute_mov, execute_cmp, execute_add, execute_sub,
+    execute_not, execute_clr, execute_lea, execute_inc,
+    execute_dec, execute_jmp, execute_bne, execute_red,
+    execute_prn, execute_jsr, execute_rts, execute_hlt};
+
+/* Checks a mode against the modes of the instruction table, none for "" */
+static bool is_mode_allowed(const char *modes, int mode) {
+  if (modes[0] == '\0') {
+    return mode == 0;
+  }
+
+  return strchr(modes, '0' + mode) != NULL;
+}
+
+/* Decodes the words of an operand, as the second pass encodes them */
+static MachineStatus decode_operand(const Machine *machine, int *next,
+                                    AddressingMode mode, int reg_offset,
+                                    MachineOperand *operand) {
+  int word = 0;
+
+  if (*next >= machine->image_end) {
+    return MACHINE_INVALID_INSTRUCTION;
+  }
+
+  word = machine->memory[(*next)++];
+  operand->mode = mode;
+
+  switch (mode) {
+  case MODE_IMMEDIATE:
+    operand->value = operand_value(word);
+    return MACHINE_RUNNING;
+  case MODE_REGISTER:
+    operand->value = (word >> reg_offset) & 7;
+    return MACHINE_RUNNING;
+  default:
+    break;
+  }
+
+  /* An external symbol is relocatable from address 0 */
+  if (word == 2) {
+    return MACHINE_UNRESOLVED_EXTERNAL;
+  }
+
+  operand->value = word >> 2;
+
+  if (mode == MODE_INDEXED) {
+    if (*next >= machine->image_end) {
+      return MACHINE_INVALID_INSTRUCTION;
+    }
+
+    operand->value += operand_value(machine->memory[(*next)++]);
+
+    if (operand->value < 0 || operand->value >= MAX_MEMORY_SIZE) {
+      return MACHINE_INVALID_ADDRESS;
+    }
+  }
+
+  return MACHINE_RUNNING;
+}
+
+void decode_instruction(const Machine *machine, int address,
+                        DecodedInstruction *instruction) {
+  const Instruction *entry = NULL;
+  MachineStatus status = MACHINE_RUNNING;
+  int next = address + 1;
+  int word = 0;
+  int source = 0;
+  int destination = 0;
+
+  memset(instruction, 0, sizeof(DecodedInstruction));
+  instruction->handler = stop_invalid_instruction;
+  instruction->opcode = -1;
+  instruction->size = 1;
+
+  if (address < IMAGE_START || address >= machine->image_end) {
+    instruction->handler = stop_outside_image;
+    return;
+  }
+
+  /* The first word has the opcode in bits 6-9, the modes in bits 2-5 */
+  word = machine->memory[address];
+  entry = &inst_table[(word >> 6) & 15];
+  source = (word >> 4) & 3;
+  destination = (word >> 2) & 3;
+
+  if ((word & 3) != 0 || (word >> 10) != 0 ||
+      !is_mode_allowed(entry->source_operand, source) ||
+      !is_mode_allowed(entry->destination_operand, destination)) {
+    return;
+  }
+
+  if (entry->source_operand[0] != '\0') {
+    /* Two registers share a word, the source in bits 5-7 */
+    if (source == MODE_REGISTER && destination == MODE_REGISTER) {
+      status = decode_operand(machine, &next, MODE_REGISTER, 5,
+                              &instruction->operands[0]);
+      instruction->operands[1].mode = MODE_REGISTER;
+      instruction->operands[1].value = (machine->memory[next - 1] >> 2) & 7;
+    } else {
+      status = decode_operand(machine, &next, source, 5,
+                              &instruction->operands[0]);
+
+      if (status == MACHINE_RUNNING) {
+        status = decode_operand(machine, &next, destination, 2,
+                                &instruction->operands[1]);
+      }
+    }
+  } else if (entry->destination_operand[0] != '\0') {
+    /* The register of a single operand is in bits 0-2 */
+    status = decode_operand(machine, &next, destination, 0,
+                            &instruction->operands[1]);
+  }
+
+  switch (status) {
+  case MACHINE_RUNNING:
+    instruction->handler = handlers[entry->opcode];
+    instruction->opcode = entry->opcode;
+    instruction->size = next - address;
+    break;
+  case MACHINE_INVALID_ADDRESS:
+    instruction->handler = stop_invalid_address;
+    break;
+  case MACHINE_UNRESOLVED_EXTERNAL:
+    instruction->handler = stop_unresolved_external;
+    break;
+  default:
+    break;
+  }
+}
+
+bool load_machine(Machine *machine, const ObjectFile *object,
+                  const char *file_name) {
+  int address = 0;
+
+  /* The program counter can stop right after the image */
+  if (object->words_count >= MAX_MEMORY_SIZE - IMAGE_START) {
+    fprintf(stderr, ERROR_IMAGE_TOO_LARGE, file_name, MAX_MEMORY_SIZE);
+    return false;
+  }
+
+  memset(machine->memory, 0, sizeof(machine->memory));
+  memcpy(machine->memory + IMAGE_START, object->words,
+         object->words_count * sizeof(int));
+  memset(machine->registers, 0, sizeof(machine->registers));
+  machine->stack_count = 0;
+  machine->pc = IMAGE_START;
+  machine->is_zero = false;
+  machine->image_end = IMAGE_START + object->words_count;
+  machine->status = MACHINE_RUNNING;
+  machine->steps = 0;
+  machine->step_limit = MACHINE_STEP_LIMIT;
+  machine->input = stdin;
+  machine->output = stdout;
+  machine->profile = NULL;
+  machine->stats = NULL;
+  machine->tracer = NULL;
+  machine->coverage = NULL;
+  memset(machine->is_breakpoint, 0, sizeof(machine->is_breakpoint));
+  memset(machine->is_page_dirty, 0, sizeof(machine->is_page_dirty));
+  machine->dirty_pages_count = 0;
+
+  for (address = 0; address < MAX_MEMORY_SIZE; address++) {
+    decode_instruction(machine, address, &machine->decoded[address]);
+  }
+
+  return true;
+}
+
+/* Runs the program counting nothing but the steps */
+static void run_uncounted(Machine *machine) {
+  const DecodedInstruction *instruction = NULL;
+
+  while (machine->status == MACHINE_RUNNING) {
+    if (machine->steps == machine->step_limit) {
+      machine->status = MACHINE_STEP_LIMIT_REACHED;
+      return;
+    }
+
+    machine->steps++;
+    instruction = &machine->decoded[machine->pc];
+    instruction->handler(machine, instruction);
+  }
+
+  /* An instruction stopping the machine on an error is not executed */
+  if (machine->status != MACHINE_HALTED) {
+    machine->steps--;
+  }
+}
+
+/* Updates the counters of the machine after an executed instruction */
+static void record_instruction(Machine *machine,
+                               const DecodedInstruction *instruction,
+                               int address) {
+  if (machine->profile) {
+    profile_instruction(machine->profile, instruction, address, machine->pc);
+  }
+
+  if (machine->stats) {
+    count_instruction(machine->stats, instruction, address, machine->pc);
+  }
+
+  if (machine->tracer) {
+    trace_instruction(machine->tracer, machine, instruction, address);
+  }
+
+  if (machine->coverage) {
+    cover_instruction(machine->coverage, instruction, address, machine->pc);
+  }
+}
+
+/* Runs the program updating the counters after every instruction */
+static void run_counted(Machine *machine) {
+  while (machine->status == MACHINE_RUNNING) {
+    int address = machine->pc;
+    const DecodedInstruction *instruction = &machine->decoded[address];
+
+    if (machine->steps == machine->step_limit) {
+      machine->status = MACHINE_STEP_LIMIT_REACHED;
+      break;
+    }
+
+    instruction->handler(machine, instruction);
+
+    if (machine->status != MACHINE_RUNNING &&
+        machine->status != MACHINE_HALTED) {
+      break;
+    }
+
+    machine->steps++;
+    record_instruction(machine, instruction, address);
+  }
+}
+
+MachineStatus run_machine(Machine *machine) {
+  if (machine->profile || machine->stats || machine->tracer ||
+      machine->coverage) {
+    run_counted(machine);
+  } else {
+    run_uncounted(machine);
+  }
+
+  return machine->status;
+}
+
+MachineStatus run_machine_to(Machine *machine, int address) {
+  DecodedInstruction *instruction = NULL;
+  int from = 0;
+
+  while (machine->status == MACHINE_RUNNING) {
+    from = machine->pc;
+    instruction = &machine->decoded[from];
+
+    /* An instruction written over is decoded to know whether it is a red */
+    if (instruction->handler == execute_undecoded) {
+      decode_again(machine, machine->pc);
+    }
+
+    if (machine->pc == address ||
+        (address == MACHINE_FIRST_INPUT && instruction->opcode == OPCODE_RED)) {
+      return MACHINE_RUNNING;
+    }
+
+    if (machine->steps == machine->step_limit) {
+      machine->status = MACHINE_STEP_LIMIT_REACHED;
+      return machine->status;
+    }
+
+    machine->steps++;
+    instruction->handler(machine, instruction);
+
+    if (machine->status == MACHINE_RUNNING ||
+        machine->status == MACHINE_HALTED) {
+      record_instruction(machine, instruction, from);
+    }
+  }
+
+  if (machine->status != MACHINE_HALTED) {
+    machine->steps--;
+  }
+
+  return machine->status;
+}
+
+MachineStatus step_machine(Machine *machine) {
+  DecodedInstruction instruction;
+
+  if (machine->status == MACHINE_BREAKPOINT) {
+    machine->status = MACHINE_RUNNING;
+  }
+
+  if (machine->status != MACHINE_RUNNING) {
+    return machine->status;
+  }
+
+  if (machine->steps == machine->step_limit) {
+    machine->status = MACHINE_STEP_LIMIT_REACHED;
+    return machine->status;
+  }
+
+  /* Decoded apart, so that the breakpoint at the address does not stop it */
+  decode_instruction(machine, machine->pc, &instruction);
+  machine->steps++;
+  instruction.handler(machine, &instruction);
+
+  if (machine->status != MACHINE_RUNNING &&
+      machine->status != MACHINE_HALTED) {
+    machine->steps--;
+  }
+
+  return machine->status;
+}
+
+void set_breakpoint(Machine *machine, int address) {
+  machine->is_breakpoint[address] = true;
+  machine->decoded[address].handler = stop_at_breakpoint;
+}
+
+void clear_breakpoint(Machine *machine, int address) {
+  machine->is_breakpoint[address] = false;
+  decode_instruction(machine, address, &machine->decoded[address]);
+}
+
+void snapshot_machine(Machine *machine, MachineSnapshot *snapshot) {
+  memcpy(snapshot->memory, machine->memory, sizeof(machine->memory));
+  memcpy(snapshot->decoded, machine->decoded, sizeof(machine->decoded));
+  memcpy(snapshot->registers, machine->registers, sizeof(machine->registers));
+  memcpy(snapshot->stack, machine->stack,
+         machine->stack_count * sizeof(int));
+  snapshot->stack_count = machine->stack_count;
+  snapshot->pc = machine->pc;
+  snapshot->is_zero = machine->is_zero;
+  snapshot->steps = machine->steps;
+
+  memset(machine->is_page_dirty, 0, sizeof(machine->is_page_dirty));
+  machine->dirty_pages_count = 0;
+}
+
+void restore_machine(Machine *machine, const MachineSnapshot *snapshot) {
+  int i = 0;
+
+  for (i = 0; i < machine->dirty_pages_count; i++) {
+    int start = machine->dirty_pages[i] * MACHINE_PAGE_SIZE;
+
+    memcpy(machine->memory + start, snapshot->memory + start,
+           MACHINE_PAGE_SIZE * sizeof(int));
+    memcpy(machine->decoded + start, snapshot->decoded + start,
+           MACHINE_PAGE_SIZE * sizeof(DecodedInstruction));
+    machine->is_page_dirty[machine->dirty_pages[i]] = false;
+  }
+
+  machine->dirty_pages_count = 0;
+  memcpy(machine->registers, snapshot->registers, sizeof(machine->registers));
+  memcpy(machine->stack, snapshot->stack,
+         snapshot->stack_count * sizeof(int));
+  machine->stack_count = snapshot->stack_count;
+  machine->pc = snapshot->pc;
+  machine->is_zero = snapshot->is_zero;
+  machine->steps = snapshot->steps;
+  machine->status = MACHINE_RUNNING;
+}
+
+void print_machine_status(const Machine *machine, const char *file_name,
+                          FILE *out) {
+  switch (machine->status) {
+  case MACHINE_INVALID_INSTRUCTION:
+    fprintf(out, ERROR_EXECUTED_INVALID_INSTRUCTION, machine->pc, file_name);
+    break;
+  case MACHINE_OUTSIDE_IMAGE:
+    fprintf(out, ERROR_EXECUTED_OUTSIDE_IMAGE, machine->pc, file_name);
+    break;
+  case MACHINE_INVALID_ADDRESS:
+    fprintf(out, ERROR_EXECUTED_INVALID_ADDRESS, machine->pc, file_name);
+    break;
+  case MACHINE_UNRESOLVED_EXTERNAL:
+    fprintf(out, ERROR_EXECUTED_EXTERNAL, machine->pc, file_name);
+    break;
+  case MACHINE_STACK_OVERFLOW:
+    fprintf(out, ERROR_EXECUTED_STACK_OVERFLOW, machine->pc,
+            MACHINE_STACK_SIZE, file_name);
+    break;
+  case MACHINE_STEP_LIMIT_REACHED:
+    fprintf(out, WARN_EXECUTION_STOPPED, machine->pc, machine->steps,
+            file_name);
+    break;
+  default:
+    break;
+  }
+}
@@ -0,0 +1,310 @@
+#ifndef __MACHINE__H__
+#define __MACHINE__H__
+
+/**
+ * @file machine.h
+ * @brief This file contains the definition of the machine that executes the
+ * images of the object files.
+ *
+ * The machine has eight registers and a memory of MAX_MEMORY_SIZE words of 14
+ * bits, into which the image is loaded from address 100. The execution starts
+ * at address 100 and goes on until a hlt, or a rts with no call to return
+ * from. The cmp instruction sets the zero flag that bne tests, and the other
+ * instructions leave it as it is. The jsr instruction pushes the address after
+ * it on a stack of MACHINE_STACK_SIZE calls kept apart from the memory. The
+ * red instruction reads a character of the input, -1 at its end, and the prn
+ * instruction prints its operand as a signed number on a line of the output.
+ *
+ * Every address of the image is decoded when it is loaded, into the handler of
+ * its opcode and its operands, with the addresses they name computed, so the
+ * execution of an instruction is a single indirect call. A word written into
+ * the image has the instructions it belongs to decoded again the next time
+ * they are executed. A machine with neither a profile, execution counters, a
+ * trace nor a coverage runs in a loop that counts nothing but the steps.
+ *
+ * A snapshot of a machine is restored by copying back only the pages of
+ * MACHINE_PAGE_SIZE words written since it was taken, which the machine keeps
+ * a list of, so that a program is run again and again from the same point at
+ * the cost of what each run changes rather than of the whole memory.
+ *
+ * A breakpoint replaces the handler of the instruction at its address by one
+ * stopping the machine, so the loops the machine runs in check nothing for it
+ * and the program runs at full speed until it reaches one.
+ */
+
+#include "consts.h"
+#include "object_file.h"
+#include <stdbool.h>
+#include <stdio.h>
+
+#define MACHINE_REGISTERS_COUNT 8
+#define MACHINE_STACK_SIZE 256
+#define MACHINE_MAX_INSTRUCTION_SIZE 5
+#define MACHINE_STEP_LIMIT 100000000UL
+#define MACHINE_PAGE_SIZE 64
+#define MACHINE_PAGES_COUNT (MAX_MEMORY_SIZE / MACHINE_PAGE_SIZE)
+
+/* The point run_machine_to stops at to stop before the first red */
+#define MACHINE_FIRST_INPUT -1
+
+/**
+ * @brief The opcodes, in the order of the instruction table.
+ */
+typedef enum {
+  OPCODE_MOV,
+  OPCODE_CMP,
+  OPCODE_ADD,
+  OPCODE_SUB,
+  OPCODE_NOT,
+  OPCODE_CLR,
+  OPCODE_LEA,
+  OPCODE_INC,
+  OPCODE_DEC,
+  OPCODE_JMP,
+  OPCODE_BNE,
+  OPCODE_RED,
+  OPCODE_PRN,
+  OPCODE_JSR,
+  OPCODE_RTS,
+  OPCODE_HLT
+} Opcode;
+
+/**
+ * @brief The addressing modes, as encoded in the instruction word.
+ */
+typedef enum {
+  MODE_IMMEDIATE,
+  MODE_DIRECT,
+  MODE_INDEXED,
+  MODE_REGISTER
+} AddressingMode;
+
+/* How an opcode accesses its operands, as flags */
+#define ACCESS_READS_SOURCE 1
+#define ACCESS_READS_DESTINATION 2
+#define ACCESS_WRITES_DESTINATION 4
+
+/**
+ * @brief The accesses of every opcode to its operands.
+ */
+extern const int opcode_accesses[INST_TABLE_SIZE];
+
+/**
+ * @brief The state of the machine, and the reason it stopped when it did.
+ */
+typedef enum {
+  MACHINE_RUNNING,             /**< The program has not ended. */
+  MACHINE_HALTED,              /**< The program ended. */
+  MACHINE_INVALID_INSTRUCTION, /**< The word at the program counter is not an
+                                  instruction. */
+  MACHINE_OUTSIDE_IMAGE,       /**< The program counter left the image. */
+  MACHINE_INVALID_ADDRESS,     /**< An operand or a jump named an address
+                                  outside of the memory. */
+  MACHINE_UNRESOLVED_EXTERNAL, /**< An operand named an external symbol. */
+  MACHINE_STACK_OVERFLOW,      /**< A call found the stack full. */
+  MACHINE_STEP_LIMIT_REACHED,  /**< The step limit was reached. */
+  MACHINE_BREAKPOINT           /**< The program counter reached a breakpoint,
+                                  whose instruction is not executed yet. */
+} MachineStatus;
+
+/**
+ * @struct MachineOperand
+ * @brief A decoded operand.
+ */
+typedef struct {
+  AddressingMode mode; /**< The addressing mode. */
+  int value;           /**< The number of an immediate operand, the register
+                          of a register operand, the address of the
+                          others. */
+} MachineOperand;
+
+typedef struct Machine Machine;
+typedef struct DecodedInstruction DecodedInstruction;
+
+/**
+ * @brief Executes a decoded instruction, at the program counter.
+ */
+typedef void (*InstructionHandler)(Machine *machine,
+                                   const DecodedInstruction *instruction);
+
+/**
+ * @struct DecodedInstruction
+ * @brief The instruction starting at an address of the image.
+ */
+struct DecodedInstruction {
+  InstructionHandler handler; /**< Executes the instruction. */
+  int opcode;                 /**< The opcode, -1 if the address does not
+                                 start an instruction. */
+  int size;                   /**< The number of words of the instruction. */
+  MachineOperand operands[2]; /**< The source and destination operands. */
+};
+
+/**
+ * @struct Machine
+ * @brief The state of the machine executing an image.
+ */
+struct Machine {
+  int memory[MAX_MEMORY_SIZE];                   /**< The words of memory. */
+  DecodedInstruction decoded[MAX_MEMORY_SIZE];   /**< The instruction at
+                                                    every address. */
+  int registers[MACHINE_REGISTERS_COUNT];        /**< The registers. */
+  int stack[MACHINE_STACK_SIZE];                 /**< The return addresses. */
+  int stack_count;                               /**< The pending calls. */
+  int pc;                                        /**< The program counter. */
+  bool is_zero;                                  /**< The zero flag. */
+  int image_end;                                 /**< The address after the
+                                                    image. */
+  MachineStatus status;                          /**< The state. */
+  unsigned long steps;                           /**< The instructions
+                                                    executed. */
+  unsigned long step_limit;                      /**< The instructions to
+                                                    execute at most. */
+  FILE *input;                                   /**< Read by red. */
+  FILE *output;                                  /**< Written by prn. */
+  struct Profile *profile;                       /**< The counters of every
+                                                    address, or NULL. */
+  struct ExecutionStats *stats;                  /**< The counters of the
+                                                    cost model, or NULL. */
+  struct Tracer *tracer;                         /**< The trace of the
+                                                    execution, or NULL. */
+  struct Coverage *coverage;                     /**< The instructions and
+                                                    branches covered, or
+                                                    NULL. */
+  bool is_breakpoint[MAX_MEMORY_SIZE];           /**< Whether the machine
+                                                    stops before every
+                                                    address. */
+  bool is_page_dirty[MACHINE_PAGES_COUNT];       /**< Whether every page was
+                                                    written since the last
+                                                    snapshot. */
+  int dirty_pages[MACHINE_PAGES_COUNT];          /**< The pages written since
+                                                    the last snapshot. */
+  int dirty_pages_count;                         /**< The number of pages
+                                                    written. */
+};
+
+/**
+ * @struct MachineSnapshot
+ * @brief The state of a machine at a point of its execution.
+ */
+typedef struct {
+  int memory[MAX_MEMORY_SIZE];                 /**< The words of memory. */
+  DecodedInstruction decoded[MAX_MEMORY_SIZE]; /**< The instruction at every
+                                                  address. */
+  int registers[MACHINE_REGISTERS_COUNT];      /**< The registers. */
+  int stack[MACHINE_STACK_SIZE];               /**< The return addresses. */
+  int stack_count;                             /**< The pending calls. */
+  int pc;                                      /**< The program counter. */
+  bool is_zero;                                /**< The zero flag. */
+  unsigned long steps;                         /**< The instructions
+                                                  executed. */
+} MachineSnapshot;
+
+/**
+ * @brief Loads the image of an object file into a machine ready to run it.
+ *
+ * An error is printed when the image does not fit in the memory.
+ *
+ * @param machine The machine to load.
+ * @param object The object file.
+ * @param file_name The name of the object file reported in the error.
+ * @return true if the image was loaded, false otherwise.
+ */
+bool load_machine(Machine *machine, const ObjectFile *object,
+                  const char *file_name);
+
+/**
+ * @brief Decodes the instruction starting at an address of the image.
+ *
+ * An address that does not start a valid instruction is decoded into one
+ * stopping the machine, with an opcode of -1.
+ *
+ * @param machine The machine.
+ * @param address The address.
+ * @param instruction The decoded instruction.
+ */
+void decode_instruction(const Machine *machine, int address,
+                        DecodedInstruction *instruction);
+
+/**
+ * @brief Runs the program of a machine until it stops.
+ *
+ * @param machine The machine.
+ * @return The reason the machine stopped.
+ */
+MachineStatus run_machine(Machine *machine);
+
+/**
+ * @brief Runs the program of a machine until it is about to execute the
+ * instruction at an address, or until it stops first. The instructions
+ * executed update the counters of the machine as run_machine() does.
+ *
+ * @param machine The machine.
+ * @param address The address, or MACHINE_FIRST_INPUT to stop before the first
+ * red instruction.
+ * @return MACHINE_RUNNING if the machine reached the address, otherwise the
+ * reason it stopped.
+ */
+MachineStatus run_machine_to(Machine *machine, int address);
+
+/**
+ * @brief Executes the instruction at the program counter, even when a
+ * breakpoint is set at its address.
+ *
+ * @param machine The machine, running or stopped at a breakpoint.
+ * @return The state of the machine after the instruction.
+ */
+MachineStatus step_machine(Machine *machine);
+
+/**
+ * @brief Sets a breakpoint, stopping the machine before it executes the
+ * instruction at an address.
+ *
+ * @param machine The machine.
+ * @param address The address.
+ */
+void set_breakpoint(Machine *machine, int address);
+
+/**
+ * @brief Clears the breakpoint at an address.
+ *
+ * @param machine The machine.
+ * @param address The address.
+ */
+void clear_breakpoint(Machine *machine, int address);
+
+/**
+ * @brief Takes a snapshot of a running machine.
+ *
+ * @param machine The machine, whose list of written pages is emptied.
+ * @param snapshot The snapshot.
+ */
+void snapshot_machine(Machine *machine, MachineSnapshot *snapshot);
+
+/**
+ * @brief Brings a machine back to the state of its last snapshot, copying the
+ * pages written since and the registers.
+ *
+ * @param machine The machine.
+ * @param snapshot The last snapshot taken of the machine.
+ */
+void restore_machine(Machine *machine, const MachineSnapshot *snapshot);
+
+/**
+ * @brief Gets the signed value of a word.
+ *
+ * @param word The 14-bit word.
+ * @return The value of the word in two's complement.
+ */
+int word_value(int word);
+
+/**
+ * @brief Prints why a machine stopped, unless its program ended.
+ *
+ * @param machine The machine.
+ * @param file_name The name of the file reported in the message.
+ * @param out The stream to write the message to.
+ */
+void print_machine_status(const Machine *machine, const char *file_name,
+                          FILE *out);
+
+#endif
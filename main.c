@@ -8,73 +8,659 @@
  * @date 25.04.2024
  */
 
-#include "assembler.h"
+#define _POSIX_C_SOURCE 200809L
 #include "backend.h"
 #include "errors.h"
-#include "preprocessor.h"
+#include "io_batch.h"
+#include "libasm.h"
+#include "parallel.h"
+#include "pipeline.h"
+#include "watch.h"
+#include <limits.h>
+#include <sys/stat.h>
+#include <time.h>
+#include <unistd.h>
+
+#define FILE_STAGES_COUNT 4
+
+/* The number of files a stage of the pipeline can get ahead of the next */
+#define PIPELINE_QUEUE_CAPACITY 4
+
+/**
+ * @struct FileJob
+ * @brief An assembly file on its way through the stages of the assembler.
+ */
+typedef struct {
+  const char *base_name;  /**< The name of the file without its extension. */
+  char *as_file_name;     /**< The name of the assembly file. */
+  char *am_file_name;     /**< The name of the preprocessed file. */
+  SourceFile as_source;   /**< The content of the assembly file. */
+  bool is_read;           /**< Whether the assembly file could be read. */
+  AsmResult result;       /**< The result of the assembly. */
+  AsmContext *context;    /**< Where to keep the context the file is
+                             assembled in, or NULL. */
+} FileJob;
+
+/**
+ * @struct AssemblyArgs
+ * @brief What the assembly stage shares between the files.
+ */
+typedef struct {
+  AsmContext *context;       /**< The context the files are assembled in. */
+  const AsmOptions *options; /**< The options of the assemblies. */
+} AssemblyArgs;
+
+/**
+ * @struct ReadArgs
+ * @brief What the read stage needs to read the files ahead in batches.
+ */
+typedef struct {
+  IoBatch *batch; /**< The batch the files are read through, or NULL to read
+                     every file on its own. */
+  FileJob *jobs;  /**< The files, in order. */
+  int count;      /**< The number of files. */
+  int read_count; /**< The number of files read so far. */
+} ReadArgs;
+
+/**
+ * @struct CheckWorker
+ * @brief A thread checking its share of the files.
+ */
+typedef struct {
+  FileJob *jobs;             /**< The files, in order. */
+  int count;                 /**< The number of files. */
+  int first;                 /**< The first file of the thread. */
+  int step;                  /**< The number of threads, so that the thread
+                                takes every step-th file. */
+  const AsmOptions *options; /**< The options of the checks. */
+} CheckWorker;
+
+static void name_files(FileJob *job) {
+  job->as_file_name = STR_CAT_WITH_MALLOC(job->base_name, ".as");
+  job->am_file_name = STR_CAT_WITH_MALLOC(job->base_name, ".am");
+}
+
+/* Reads the files from a given one on, as many as a batch takes */
+static void read_ahead(ReadArgs *args, int first) {
+  IoFile files[IO_BATCH_FILES];
+  int count = args->count - first;
+  int i = 0;
+
+  if (count > IO_BATCH_FILES) {
+    count = IO_BATCH_FILES;
+  }
+
+  for (i = 0; i < count; i++) {
+    name_files(&args->jobs[first + i]);
+    files[i].file_name = args->jobs[first + i].as_file_name;
+  }
+
+  read_files(args->batch, files, count);
+
+  for (i = 0; i < count; i++) {
+    FileJob *job = &args->jobs[first + i];
+
+    job->is_read = files[i].is_done;
+
+    if (job->is_read) {
+      init_source(&job->as_source, files[i].text, files[i].size);
+    }
+  }
+
+  args->read_count = first + count;
+}
+
+static void read_file(void *item, void *arg) {
+  FileJob *job = (FileJob *)item;
+  ReadArgs *args = (ReadArgs *)arg;
+  int index = job - args->jobs;
+
+  if (args->batch == NULL) {
+    name_files(job);
+    job->is_read = load_source(&job->as_source, job->as_file_name);
+  } else if (index >= args->read_count) {
+    read_ahead(args, index);
+  }
+}
+
+static void expand_file(void *item, void *arg) {
+  FileJob *job = (FileJob *)item;
+
+  if (job->is_read) {
+    asm_expand(job->am_file_name, job->as_source.text, job->as_source.size,
+               &job->result);
+    free_source(&job->as_source);
+  }
+}
+
+static void assemble_file(void *item, void *arg) {
+  FileJob *job = (FileJob *)item;
+  AssemblyArgs *args = (AssemblyArgs *)arg;
+
+  if (job->context) {
+    asm_free_context(job->context);
+    asm_copy_context(job->context, args->context);
+  }
+
+  if (job->is_read) {
+    asm_assemble_expanded(args->context, args->options, &job->result);
+  }
+}
+
+/* Writes the outputs of a file and prints its diagnostics and progress */
+static void write_file(void *item, void *arg) {
+  FileJob *job = (FileJob *)item;
+  IoBatch *batch = (IoBatch *)arg;
+  AsmResult *result = &job->result;
+
+  if (!job->is_read) {
+    fprintf(stderr, ERROR_CANNOT_READ, job->as_file_name);
+    free(job->as_file_name);
+    free(job->am_file_name);
+    return;
+  }
+
+  /* The expanded source goes to the .am file */
+  write_output(batch, job->am_file_name, result->source.text,
+               result->source.size);
+  result->source.text = NULL;
+
+  print_diagnostics(&result->diagnostics, 0, result->first_pass_diagnostics,
+                    stdout);
+
+  if (result->status == ASM_OK || result->status == ASM_SECOND_PASS_FAILED) {
+    printf("First pass completed.\n");
+    print_diagnostics(&result->diagnostics, result->first_pass_diagnostics,
+                      result->diagnostics.count -
+                          result->first_pass_diagnostics,
+                      stdout);
+  }
+
+  if (result->status == ASM_OK) {
+    printf("Second pass completed.\n");
+    print_peephole_report(&result->optimizations, job->am_file_name, stdout);
+
+    print_ob_file(batch, job->am_file_name, result->words,
+                  result->words_count, result->instructions_count,
+                  result->data_count);
+    printf("Object file created.\n");
+
+    /* Without symbols or lines to list, the file of an earlier run is
+     * removed */
+    print_ent_file(batch, job->am_file_name, result->entries);
+    print_ext_file(batch, job->am_file_name, result->externals);
+    print_map_file(batch, job->am_file_name, job->as_file_name,
+                   &result->lines);
+
+    if (result->entries) {
+      printf("Entry file created.\n");
+    }
+
+    if (result->externals) {
+      printf("External file created.\n");
+    }
+
+    if (result->lines.count > 0) {
+      printf("Map file created.\n");
+    }
+  }
+
+  asm_free_result(result);
+  free(job->as_file_name);
+  free(job->am_file_name);
+}
+
+/* Checks the share of the files of a thread, every file on its own */
+static void *check_files(void *arg) {
+  CheckWorker *worker = (CheckWorker *)arg;
+  int j = 0;
+
+  for (j = worker->first; j < worker->count; j += worker->step) {
+    FileJob *job = &worker->jobs[j];
+
+    name_files(job);
+    job->is_read = load_source(&job->as_source, job->as_file_name);
+
+    if (job->is_read) {
+      asm_expand(job->am_file_name, job->as_source.text, job->as_source.size,
+                 &job->result);
+      free_source(&job->as_source);
+      asm_assemble_expanded(NULL, worker->options, &job->result);
+
+      /* Only the diagnostics are kept until the file is reported */
+      free_source(&job->result.source);
+    }
+  }
+
+  return NULL;
+}
+
+/**
+ * @brief Checks files on several threads, without writing any output, and
+ * prints their diagnostics in the order of the files.
+ *
+ * @param jobs The files.
+ * @param count The number of files.
+ * @param threads_count The number of files checked at once, 0 for one per
+ * processor.
+ * @return The number of files that are not valid.
+ */
+static int check_all_files(FileJob *jobs, int count, int threads_count) {
+  CheckWorker *workers = NULL;
+  AsmOptions options;
+  int invalid_count = 0;
+  int j = 0;
+
+  options.threads_count = 0;
+  options.check_only = true;
+  options.optimize = false;
+  options.strip = false;
+  options.line_table = false;
+
+  if (threads_count <= 0) {
+    threads_count = (int)sysconf(_SC_NPROCESSORS_ONLN);
+  }
+
+  threads_count = threads_count < 1 ? 1 : threads_count;
+  threads_count = threads_count > count ? count : threads_count;
+  workers = (CheckWorker *)malloc(threads_count * sizeof(CheckWorker));
+
+  if (workers == NULL) {
+    fprintf(stderr, ERROR_OUT_OF_MEMORY);
+    exit(EXIT_FAILURE);
+  }
+
+  for (j = 0; j < threads_count; j++) {
+    workers[j].jobs = jobs;
+    workers[j].count = count;
+    workers[j].first = j;
+    workers[j].step = threads_count;
+    workers[j].options = &options;
+  }
+
+  run_parallel(check_files, workers, sizeof(CheckWorker), threads_count);
+
+  for (j = 0; j < count; j++) {
+    if (!jobs[j].is_read) {
+      fprintf(stderr, ERROR_CANNOT_READ, jobs[j].as_file_name);
+      invalid_count++;
+    } else {
+      print_diagnostics(&jobs[j].result.diagnostics, 0,
+                        jobs[j].result.diagnostics.count, stdout);
+      invalid_count += jobs[j].result.status != ASM_OK;
+      asm_free_result(&jobs[j].result);
+    }
+
+    free(jobs[j].as_file_name);
+    free(jobs[j].am_file_name);
+  }
+
+  free(workers);
+
+  return invalid_count;
+}
+
+/* The wall clock, which the modification times of the files are on */
+static double wall_clock_seconds(void) {
+  struct timespec now;
+
+  clock_gettime(CLOCK_REALTIME, &now);
+
+  return now.tv_sec + now.tv_nsec / 1e9;
+}
+
+/* Returns the time the latest of the changed files was saved */
+static double saved_seconds(char **as_file_names, const bool *changed,
+                            int count) {
+  double latest = 0;
+  int i = 0;
+
+  for (i = 0; i < count; i++) {
+    struct stat status;
+
+    if (changed[i] && stat(as_file_names[i], &status) == 0) {
+      double saved = status.st_mtim.tv_sec + status.st_mtim.tv_nsec / 1e9;
+
+      latest = saved > latest ? saved : latest;
+    }
+  }
+
+  return latest;
+}
+
+/**
+ * @brief Reassembles the saved files, and the files after them that no longer
+ * start from the context they were assembled in.
+ *
+ * A file is assembled in the context left by the files before it, so a file
+ * that was not saved, and whose context is the same as before, still has the
+ * right outputs, and so do the files after it up to the next saved one.
+ *
+ * @param stages The stages a file goes through.
+ * @param jobs The files, in order.
+ * @param count The number of files.
+ * @param changed Whether every file was saved.
+ * @param context The context the files are assembled in.
+ * @param contexts The context every file was assembled in, followed by the
+ * context left by the last one.
+ */
+static void reassemble(const PipelineStage *stages, FileJob *jobs, int count,
+                       const bool *changed, AsmContext *context,
+                       AsmContext *contexts) {
+  bool is_current = false;
+  int stage = 0;
+  int j = 0;
+
+  for (j = 0; j < count; j++) {
+    if (!changed[j] &&
+        (!is_current || asm_same_context(context, &contexts[j]))) {
+      is_current = false;
+      continue;
+    }
+
+    if (!is_current) {
+      asm_free_context(context);
+      asm_copy_context(context, &contexts[j]);
+      is_current = true;
+    }
+
+    for (stage = 0; stage < FILE_STAGES_COUNT; stage++) {
+      stages[stage].run(&jobs[j], stages[stage].arg);
+    }
+  }
+
+  if (is_current) {
+    asm_free_context(&contexts[count]);
+    asm_copy_context(&contexts[count], context);
+  }
+}
+
+/**
+ * @brief Keeps reassembling the files as they are saved, until the watch
+ * fails.
+ *
+ * @param stages The stages a file goes through.
+ * @param jobs The files, in order, assembled once already.
+ * @param count The number of files.
+ * @param context The context the files are assembled in.
+ * @param contexts The context every file was assembled in, followed by the
+ * context left by the last one.
+ * @param batch The batch the outputs are written through.
+ */
+static void watch_files(const PipelineStage *stages, FileJob *jobs, int count,
+                        AsmContext *context, AsmContext *contexts,
+                        IoBatch *batch) {
+  char **as_file_names = (char **)malloc(count * sizeof(char *));
+  bool *changed = (bool *)malloc(count * sizeof(bool));
+  Watcher watcher;
+  int j = 0;
+
+  if (as_file_names == NULL || changed == NULL) {
+    fprintf(stderr, ERROR_OUT_OF_MEMORY);
+    exit(EXIT_FAILURE);
+  }
+
+  for (j = 0; j < count; j++) {
+    as_file_names[j] = STR_CAT_WITH_MALLOC(jobs[j].base_name, ".as");
+  }
+
+  if (!init_watcher(&watcher, as_file_names, count)) {
+    fprintf(stderr, ERROR_CANNOT_WATCH);
+  } else {
+    printf("Watching %d files for changes.\n", count);
+    fflush(stdout);
+
+    while (wait_for_changes(&watcher, changed) > 0) {
+      double seen = wall_clock_seconds();
+      double saved = saved_seconds(as_file_names, changed, count);
+      double written = 0;
+
+      batch->written_count = 0;
+      batch->unchanged_count = 0;
+      batch->removed_count = 0;
+
+      reassemble(stages, jobs, count, changed, context, contexts);
+      flush_writes(batch);
+      written = wall_clock_seconds();
+
+      printf("Output files: %d written, %d unchanged, %d removed.\n",
+             batch->written_count, batch->unchanged_count,
+             batch->removed_count);
+      printf("Outputs written %.2f ms after the save, %.2f ms after it was "
+             "seen.\n",
+             1000 * (written - saved), 1000 * (written - seen));
+      fflush(stdout);
+    }
+
+    free_watcher(&watcher);
+  }
+
+  for (j = 0; j < count; j++) {
+    free(as_file_names[j]);
+  }
+
+  free(as_file_names);
+  free(changed);
+}
 
 /**
  * @brief The main function for the assembler simulator program.
  *
- * @details This function reads the assembly files, preprocesses them, and then
- * performs the first and second passes of the assembler. It then prints the
- * object file, entry file, and external file for the translated assembly code.
+ * @details This function reads the assembly files and assembles them with the
+ * assembler library, one after the other in a single context. It writes the
+ * preprocessed file of every assembly file, prints its diagnostics, and then
+ * prints the object file, entry file, and external file for the translated
+ * assembly code. An output file whose content did not change is left as it
+ * was, and the run ends with the number of output files written, left
+ * unchanged, and removed as stale.
  * @note The main function takes the assembly file names as command-line
+ * arguments, optionally preceded by "-j <threads>" to run the passes of every
+ * file over chunks handled on that many threads, and by "-p" to overlap the
+ * reading, the preprocessing, the assembly and the writing of successive
+ * files in a pipeline, whose stage occupancy is reported on stderr, and by
+ * "-i <uring|threads>" to read and write the files in batches, through an
+ * io_uring or on a few threads doing blocking I/O. With "--watch", the program
+ * then stays resident and reassembles the files as they are saved. With
+ * "--check", the files are only checked: each is preprocessed and goes
+ * through the first pass and the reference checks of the second pass on its
+ * own, as if it were the only file, on as many threads as "-j" tells or one
+ * per processor. No machine code is encoded and no file is written, and the
+ * program fails if a file is not valid. With "-O", the redundant instructions
+ * of every file are removed before it is assembled, and the ones removed are
+ * reported with the words saved. With "--strip", the code and the data not
+ * reached from the first instruction and the .entry labels are removed and
+ * reported in the same way. The .am file keeps the removed lines. With "-g",
+ * a map file is also written for every file, giving the line of the assembly
+ * file and the macro call the words at every address come from.
  * @param argc The number of command-line arguments.
  * @param argv The array of command-line arguments.
  * @return The exit status of the program.
  */
 int main(int argc, char **argv) {
   int i = 0;
-  char *am_file_name = NULL;
-  FILE *am_file = NULL;
+  int j = 0;
+  bool is_pipelined = false;
+  bool is_batched = false;
+  bool is_watching = false;
+  bool is_checking = false;
+  IoBackend backend = IO_BACKEND_URING;
+  IoBatch read_batch;
+  IoBatch write_batch;
+  AsmContext context;
+  AsmOptions options;
+  AssemblyArgs assembly_args;
+  ReadArgs read_args;
+  FileJob *jobs = NULL;
+  AsmContext *contexts = NULL;
+  PipelineStage stages[FILE_STAGES_COUNT];
 
-  Translator *translator = NULL;
-  Symbol *symbol_table = NULL;
+  options.threads_count = 0;
+  options.check_only = false;
+  options.optimize = false;
+  options.strip = false;
+  options.line_table = false;
 
-  int instruction_counter = 0;
-  int data_counter = 0;
+  /* -j <threads> splits both passes of every file over several threads, -p
+   * overlaps the files in a pipeline, -i <uring|threads> reads and writes the
+   * files in batches, --watch reassembles them as they are saved, --check
+   * only validates them, -O removes the redundant instructions, --strip the
+   * unreached code and data, -g writes the line table of every file */
+  for (i = 1; i < argc; i++) {
+    if (i + 1 < argc && strcmp(argv[i], "-j") == 0) {
+      char *end = NULL;
+      long threads_count = strtol(argv[++i], &end, 10);
+
+      if (end == argv[i] || *end != '\0' || threads_count < 1 ||
+          threads_count > INT_MAX) {
+        fprintf(stderr, ERROR_INVALID_THREADS_COUNT, argv[i]);
+        return EXIT_FAILURE;
+      }
 
-  if (argc < 2) {
+      options.threads_count = (int)threads_count;
+    } else if (strcmp(argv[i], "-p") == 0) {
+      is_pipelined = true;
+    } else if (i + 1 < argc && strcmp(argv[i], "-i") == 0) {
+      is_batched = true;
+      i++;
+
+      if (strcmp(argv[i], "threads") == 0) {
+        backend = IO_BACKEND_THREADS;
+      } else if (strcmp(argv[i], "uring") == 0) {
+        backend = IO_BACKEND_URING;
+      } else {
+        fprintf(stderr, ERROR_INVALID_IO_BACKEND, argv[i]);
+        return EXIT_FAILURE;
+      }
+    } else if (strcmp(argv[i], "--watch") == 0) {
+      is_watching = true;
+    } else if (strcmp(argv[i], "--check") == 0) {
+      is_checking = true;
+    } else if (strcmp(argv[i], "-O") == 0) {
+      options.optimize = true;
+    } else if (strcmp(argv[i], "--strip") == 0) {
+      options.strip = true;
+    } else if (strcmp(argv[i], "-g") == 0) {
+      options.line_table = true;
+    } else {
+      break;
+    }
+  }
+
+  if (i >= argc) {
     fprintf(stderr, ERROR_MISSING_FILE_NAME);
+    return 0;
   }
 
-  for (i = 1; i < argc; i++) {
-    am_file_name = preprocess(argv[i]);
-
-    if (am_file_name) {
-      am_file = fopen(am_file_name, "r");
-      if (am_file) {
-        if (!do_first_pass(&symbol_table, am_file, am_file_name)) {
-          printf("First pass completed.\n");
-          rewind(am_file);
-          if (!do_second_pass(&translator, &symbol_table, am_file_name, am_file,
-                              &instruction_counter, &data_counter, argv[i])) {
-            printf("Second pass completed.\n");
-
-            print_ob_file(translator, am_file_name, &instruction_counter,
-                          &data_counter);
-            printf("Object file created.\n");
-
-            if (translator->internal_symbols) {
-              print_ent_file(translator, am_file_name);
-              printf("Entry file created.\n");
-            }
-
-            if (translator->external_symbols) {
-              print_ext_file(translator, am_file_name);
-              printf("External file created.\n");
-            }
-          }
-        }
-
-        fclose(am_file);
+  jobs = (FileJob *)calloc(argc - i, sizeof(FileJob));
+
+  if (jobs == NULL) {
+    fprintf(stderr, ERROR_OUT_OF_MEMORY);
+    exit(EXIT_FAILURE);
+  }
+
+  if (is_checking) {
+    for (j = i; j < argc; j++) {
+      jobs[j - i].base_name = argv[j];
+    }
+
+    j = check_all_files(jobs, argc - i, options.threads_count);
+    printf("Files checked: %d valid, %d not valid.\n", argc - i - j, j);
+    free(jobs);
+
+    return j > 0 ? EXIT_FAILURE : EXIT_SUCCESS;
+  }
+
+  /* Watching keeps the context of every file, to start again from it */
+  if (is_watching) {
+    contexts = (AsmContext *)malloc((argc - i + 1) * sizeof(AsmContext));
+
+    if (contexts == NULL) {
+      fprintf(stderr, ERROR_OUT_OF_MEMORY);
+      exit(EXIT_FAILURE);
+    }
+  }
+
+  for (j = i; j < argc; j++) {
+    jobs[j - i].base_name = argv[j];
+    jobs[j - i].context = contexts ? &contexts[j - i] : NULL;
+
+    if (contexts) {
+      asm_init_context(&contexts[j - i]);
+    }
+  }
+
+  asm_init_context(&context);
+  assembly_args.context = &context;
+  assembly_args.options = &options;
+  read_args.batch = NULL;
+  read_args.jobs = jobs;
+  read_args.count = argc - i;
+  read_args.read_count = 0;
+
+  if (is_batched) {
+    init_io_batch(&read_batch, backend);
+    init_io_batch(&write_batch, backend);
+    read_args.batch = &read_batch;
+  } else {
+    init_io_batch(&write_batch, IO_BACKEND_SYNC);
+  }
+
+  stages[0].name = "read";
+  stages[0].run = read_file;
+  stages[0].arg = &read_args;
+  stages[1].name = "preprocess";
+  stages[1].run = expand_file;
+  stages[1].arg = NULL;
+  stages[2].name = "assemble";
+  stages[2].run = assemble_file;
+  stages[2].arg = &assembly_args;
+  stages[3].name = "write";
+  stages[3].run = write_file;
+  stages[3].arg = &write_batch;
+
+  if (is_pipelined) {
+    StageStats stats[FILE_STAGES_COUNT];
+    double seconds = 0;
+
+    seconds = run_pipeline(stages, stats, FILE_STAGES_COUNT, jobs,
+                           sizeof(FileJob), argc - i, PIPELINE_QUEUE_CAPACITY);
+    fflush(stdout);
+    print_pipeline_stats(stages, stats, FILE_STAGES_COUNT, seconds, stderr);
+  } else {
+    for (j = 0; j < argc - i; j++) {
+      int stage = 0;
+
+      for (stage = 0; stage < FILE_STAGES_COUNT; stage++) {
+        stages[stage].run(&jobs[j], stages[stage].arg);
       }
+    }
+  }
 
-      free(am_file_name);
-    } else {
-      fprintf(stderr, ERROR_CANNOT_READ, am_file_name);
+  if (is_batched) {
+    free_io_batch(&read_batch);
+  }
+
+  flush_writes(&write_batch);
+  printf("Output files: %d written, %d unchanged, %d removed.\n",
+         write_batch.written_count, write_batch.unchanged_count,
+         write_batch.removed_count);
+
+  if (is_watching) {
+    /* The files are read on their own from now on */
+    read_args.batch = NULL;
+    asm_copy_context(&contexts[argc - i], &context);
+    watch_files(stages, jobs, argc - i, &context, contexts, &write_batch);
+
+    for (j = 0; j <= argc - i; j++) {
+      asm_free_context(&contexts[j]);
     }
+
+    free(contexts);
   }
+
+  free_io_batch(&write_batch);
+  free(jobs);
+  asm_free_context(&context);
+
   return 0;
-}
\ No newline at end of file
+}
@@ -0,0 +1,224 @@
+#include "object_file.h"
+#include "converter.h"
+#include "errors.h"
+#include <ctype.h>
+
+void init_object_file(ObjectFile *object) {
+  object->words = NULL;
+  object->words_count = 0;
+  object->instructions = 0;
+  object->data = 0;
+  object->entries = NULL;
+  object->externals = NULL;
+  init_line_table(&object->lines);
+  object->source_file_name = NULL;
+}
+
+/* Adds a symbol read from a file after the last one */
+static void append_symbol(Symbol ***next, const char *name,
+                          Attribute attribute, int value) {
+  Symbol *symbol = (Symbol *)malloc(sizeof(Symbol));
+
+  if (symbol == NULL) {
+    fprintf(stderr, ERROR_OUT_OF_MEMORY);
+    exit(EXIT_FAILURE);
+  }
+
+  strcpy(symbol->symbol_name, name);
+  symbol->attribute = attribute;
+  symbol->value = value;
+  symbol->entry_line = 0;
+  symbol->next = NULL;
+
+  **next = symbol;
+  *next = &symbol->next;
+}
+
+/* Adds a word after the last one of the image */
+static void add_image_word(ObjectFile *object, int word, int *capacity) {
+  if (object->words_count == *capacity) {
+    int *temp = NULL;
+
+    *capacity = *capacity ? 2 * *capacity : 256;
+    temp = (int *)realloc(object->words, *capacity * sizeof(int));
+
+    if (temp == NULL) {
+      fprintf(stderr, ERROR_OUT_OF_MEMORY);
+      exit(EXIT_FAILURE);
+    }
+
+    object->words = temp;
+  }
+
+  object->words[object->words_count++] = word;
+}
+
+/* Reads the header and the words of the object file */
+static bool read_image(ObjectFile *object, const char *file_name) {
+  char line[MAX_LINE_LENGTH + 2];
+  char *text = NULL;
+  FILE *file = fopen(file_name, "r");
+  int capacity = 0;
+  int current_line = 1;
+  int address = 0;
+  int word = 0;
+
+  if (file == NULL) {
+    fprintf(stderr, ERROR_CANNOT_READ, file_name);
+    return false;
+  }
+
+  if (fgets(line, sizeof(line), file) == NULL ||
+      sscanf(line, "%d %d", &object->instructions, &object->data) != 2) {
+    fprintf(stderr, ERROR_INVALID_OBJECT_FILE, file_name, current_line);
+    fclose(file);
+    return false;
+  }
+
+  /* Every word is on its own line, after its address, read without sscanf()
+     since every tool reads the images */
+  while (fgets(line, sizeof(line), file)) {
+    current_line++;
+    address = (int)strtol(line, &text, 10);
+
+    while (text != line && (*text == ' ' || *text == '\t')) {
+      text++;
+    }
+
+    if (text == line || address != IMAGE_START + object->words_count ||
+        !from_base4_encrypted(text, &word) ||
+        (text[ENCRYPTED_WORD_LENGTH] != '\0' &&
+         !isspace((unsigned char)text[ENCRYPTED_WORD_LENGTH]))) {
+      fprintf(stderr, ERROR_INVALID_OBJECT_FILE, file_name, current_line);
+      fclose(file);
+      return false;
+    }
+
+    add_image_word(object, word, &capacity);
+  }
+
+  fclose(file);
+
+  return true;
+}
+
+/* Reads the name and address lines of an entry or external file, if any */
+static void read_symbols(Symbol **symbols, const char *file_name,
+                         Attribute attribute) {
+  char line[MAX_LINE_LENGTH + 2];
+  char name[MAX_LABEL_LENGTH];
+  FILE *file = fopen(file_name, "r");
+  int value = 0;
+
+  if (file == NULL) {
+    return;
+  }
+
+  /* The width is MAX_LABEL_LENGTH - 1 */
+  while (fgets(line, sizeof(line), file)) {
+    if (sscanf(line, "%30s %d", name, &value) == 2) {
+      append_symbol(&symbols, name, attribute, value);
+    }
+  }
+
+  fclose(file);
+}
+
+/* Reads the source file name and the runs of a map file, if any */
+static void read_map(ObjectFile *object, const char *file_name) {
+  char line[FILENAME_MAX + 2];
+  FILE *file = fopen(file_name, "r");
+  int address = 0;
+  int source_line = 0;
+  int call_line = 0;
+  int count = 0;
+
+  if (file == NULL) {
+    return;
+  }
+
+  if (fgets(line, sizeof(line), file)) {
+    line[strcspn(line, "\r\n")] = '\0';
+    object->source_file_name = (char *)malloc(strlen(line) + 1);
+
+    if (object->source_file_name == NULL) {
+      fprintf(stderr, ERROR_OUT_OF_MEMORY);
+      exit(EXIT_FAILURE);
+    }
+
+    strcpy(object->source_file_name, line);
+  }
+
+  while (fgets(line, sizeof(line), file)) {
+    call_line = 0;
+    count = sscanf(line, "%d %d %d", &address, &source_line, &call_line);
+
+    if (count >= 2) {
+      append_line_run(&object->lines, address - IMAGE_START, source_line,
+                      call_line);
+    }
+  }
+
+  fclose(file);
+}
+
+bool read_object_file(ObjectFile *object, const char *base_name) {
+  char *file_name = STR_CAT_WITH_MALLOC(base_name, ".ob");
+  bool is_read = read_image(object, file_name);
+
+  free(file_name);
+
+  if (!is_read) {
+    return false;
+  }
+
+  file_name = STR_CAT_WITH_MALLOC(base_name, ".ent");
+  read_symbols(&object->entries, file_name, INTERNAL);
+  free(file_name);
+
+  file_name = STR_CAT_WITH_MALLOC(base_name, ".ext");
+  read_symbols(&object->externals, file_name, EXTERNAL);
+  free(file_name);
+
+  file_name = STR_CAT_WITH_MALLOC(base_name, ".map");
+  read_map(object, file_name);
+  free(file_name);
+
+  return true;
+}
+
+const Symbol *find_entry_label(const ObjectFile *object, int address) {
+  const Symbol *label = NULL;
+  const Symbol *entry = object->entries;
+
+  for (; entry; entry = entry->next) {
+    if (entry->value <= address &&
+        (label == NULL || entry->value > label->value)) {
+      label = entry;
+    }
+  }
+
+  return label;
+}
+
+void format_location(const ObjectFile *object, int address,
+                     char location[LOCATION_LENGTH]) {
+  const Symbol *label = find_entry_label(object, address);
+
+  if (label == NULL) {
+    strcpy(location, "-");
+  } else if (label->value == address) {
+    strcpy(location, label->symbol_name);
+  } else {
+    sprintf(location, "%s+%d", label->symbol_name, address - label->value);
+  }
+}
+
+void free_object_file(ObjectFile *object) {
+  free(object->words);
+  free_table(object->entries);
+  free_table(object->externals);
+  free_line_table(&object->lines);
+  free(object->source_file_name);
+  init_object_file(object);
+}
@@ -0,0 +1,87 @@
+#ifndef __OBJECT_FILE__H__
+#define __OBJECT_FILE__H__
+
+/**
+ * @file object_file.h
+ * @brief This file contains the definition of the reader of the files the
+ * assembler writes for a source, for the tools working on assembled programs.
+ *
+ * The object file (.ob) holds the image, from address 100. The entry file
+ * (.ent) names the addresses of the .entry labels, the external file (.ext)
+ * the words using an external symbol, and the map file (.map) written with -g
+ * the lines the words come from. Only the object file is required, the others
+ * are read when they exist.
+ */
+
+#include "line_table.h"
+#include "symbol_table.h"
+#include <stdbool.h>
+
+#define IMAGE_START 100
+#define LOCATION_LENGTH (MAX_LABEL_LENGTH + 12)
+
+/**
+ * @struct ObjectFile
+ * @brief The files the assembler wrote for a source.
+ */
+typedef struct {
+  int *words;             /**< The words of the image. */
+  int words_count;        /**< The number of words of the image. */
+  int instructions;       /**< The number of code words, as the header says. */
+  int data;               /**< The number of data words, as the header says. */
+  Symbol *entries;        /**< The .entry labels, with their addresses. */
+  Symbol *externals;      /**< The uses of the external symbols, with the
+                             addresses of the words using them. */
+  LineTable lines;        /**< The runs of the map file, empty without one. */
+  char *source_file_name; /**< The assembly file the map file names, NULL
+                             without one. */
+} ObjectFile;
+
+/**
+ * @brief Initializes an empty object file.
+ *
+ * @param object The object file to initialize.
+ */
+void init_object_file(ObjectFile *object);
+
+/**
+ * @brief Reads the files the assembler wrote for a source.
+ *
+ * An error is printed when the object file cannot be read or is not one the
+ * assembler writes.
+ *
+ * @param object The object file to read into.
+ * @param base_name The name of the files without their extension.
+ * @return true if the object file was read, false otherwise.
+ */
+bool read_object_file(ObjectFile *object, const char *base_name);
+
+/**
+ * @brief Finds the .entry label an address follows.
+ *
+ * @param object The object file.
+ * @param address The address.
+ * @return The label with the highest address not above the address, NULL if
+ * there is none.
+ */
+const Symbol *find_entry_label(const ObjectFile *object, int address);
+
+/**
+ * @brief Names an address by the .entry label it follows, as LABEL or
+ * LABEL+offset, or '-' when it follows none.
+ *
+ * @param object The object file.
+ * @param address The address.
+ * @param location The name of the address.
+ */
+void format_location(const ObjectFile *object, int address,
+                     char location[LOCATION_LENGTH]);
+
+/**
+ * @brief Frees the memory allocated for an object file.
+ *
+ * @param object The object file to free.
+ */
+void free_object_file(ObjectFile *object);
+
+#endif
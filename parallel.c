@@ -0,0 +1,41 @@
+#include "parallel.h"
+#include "errors.h"
+#include <pthread.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+void run_parallel(void *(*task)(void *), void *elements, size_t element_size,
+                  int count) {
+  pthread_t *threads = NULL;
+  bool *started = NULL;
+  int i = 0;
+
+  if (count <= 0) {
+    return;
+  }
+
+  threads = (pthread_t *)malloc(count * sizeof(pthread_t));
+  started = (bool *)calloc(count, sizeof(bool));
+
+  if (threads == NULL || started == NULL) {
+    fprintf(stderr, ERROR_OUT_OF_MEMORY);
+    exit(EXIT_FAILURE);
+  }
+
+  for (i = 1; i < count; i++) {
+    started[i] = pthread_create(&threads[i], NULL, task,
+                                (char *)elements + i * element_size) == 0;
+  }
+
+  for (i = 0; i < count; i++) {
+    if (started[i]) {
+      pthread_join(threads[i], NULL);
+    } else {
+      task((char *)elements + i * element_size);
+    }
+  }
+
+  free(threads);
+  free(started);
+}
@@ -0,0 +1,27 @@
+#ifndef __PARALLEL__H__
+#define __PARALLEL__H__
+
+/**
+ * @file parallel.h
+ * @brief This file contains the helper running the tasks of the chunked passes
+ * on several threads.
+ */
+
+#include <stddef.h>
+
+/**
+ * @brief Runs a task on every element of an array, each on its own thread,
+ * and waits for all of them.
+ *
+ * The task of the first element runs on the calling thread, as does the task
+ * of any element whose thread cannot be created.
+ *
+ * @param task The task, called with a pointer to its element.
+ * @param elements The array of elements.
+ * @param element_size The size of an element.
+ * @param count The number of elements.
+ */
+void run_parallel(void *(*task)(void *), void *elements, size_t element_size,
+                  int count);
+
+#endif
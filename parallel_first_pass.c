@@ -0,0 +1,496 @@
+/**
+ * @file parallel_first_pass.c
+ * @brief The first pass of the assembler over chunks of lines parsed on several
+ * threads.
+ *
+ * The lines of the file are split into contiguous chunks. Every chunk is parsed
+ * and sized on its own thread into the list of the symbols it defines, with
+ * addresses relative to the start of the chunk. The address of a chunk is the
+ * prefix sum of the sizes of the chunks before it, and the symbols are then
+ * merged into the symbol table in source order, so that redefinitions and the
+ * other symbol errors are reported exactly as by do_first_pass().
+ *
+ * When a layout is requested, every chunk also records where its lines go in
+ * the code image, so that the second pass can encode the same chunks in
+ * parallel.
+ */
+
+#include "assembler.h"
+#include "errors.h"
+#include "parallel.h"
+#include "scanner.h"
+#include "source.h"
+
+/**
+ * @struct ChunkSymbol
+ * @brief A symbol defined by a line of a chunk.
+ */
+typedef struct {
+  Attribute attribute;             /**< MDEFINE, MDATA, EXTERNAL or CODE. */
+  int line;                        /**< The line defining the symbol. */
+  char name[MAX_LABEL_LENGTH + 1]; /**< The name of the symbol. */
+  int value;    /**< The define value, or the offset in the chunk. */
+  int size;     /**< The number of data words of a data label. */
+  int elements; /**< The offset of the data element names in the chunk. */
+  int elements_count; /**< The number of data element names to check, or of
+                           the expressions of a define or of an unnamed
+                           symbol standing for the expressions of a line. */
+} ChunkSymbol;
+
+/**
+ * @struct Chunk
+ * @brief A range of lines of the source and the result of parsing it.
+ */
+typedef struct {
+  const SourceFile *source; /**< The source the lines belong to. */
+  int first_line;           /**< The index of the first line of the chunk. */
+  int end_line;             /**< The index past the last line of the chunk. */
+  ChunkSymbol *symbols;     /**< The symbols defined in the chunk. */
+  int symbols_count;        /**< The number of symbols. */
+  int symbols_capacity;     /**< The number of allocated symbols. */
+  char *names;              /**< The data element names, one after another. */
+  int names_size;           /**< The number of used characters in names. */
+  int names_capacity;       /**< The number of allocated characters. */
+  int size;                 /**< The number of words of the chunk. */
+  long words; /**< The words of the chunk in the image, labeled or not. */
+  bool has_error;           /**< Whether a line of the chunk has an error. */
+  DiagnosticList diagnostics; /**< The diagnostics of the parsed lines. */
+  LayoutChunk *layout; /**< The layout of the chunk, NULL if not requested. */
+} Chunk;
+
+static ChunkSymbol *add_chunk_symbol(Chunk *chunk, Attribute attribute,
+                                     const char *name, int line, int value) {
+  ChunkSymbol *symbol = NULL;
+
+  if (chunk->symbols_count == chunk->symbols_capacity) {
+    int capacity = chunk->symbols_capacity ? 2 * chunk->symbols_capacity : 64;
+    ChunkSymbol *temp = (ChunkSymbol *)realloc(
+        chunk->symbols, capacity * sizeof(ChunkSymbol));
+
+    if (temp == NULL) {
+      fprintf(stderr, ERROR_OUT_OF_MEMORY);
+      exit(EXIT_FAILURE);
+    }
+
+    chunk->symbols = temp;
+    chunk->symbols_capacity = capacity;
+  }
+
+  symbol = &chunk->symbols[chunk->symbols_count++];
+  symbol->attribute = attribute;
+  symbol->line = line;
+  strncpy(symbol->name, name, MAX_LABEL_LENGTH);
+  symbol->name[MAX_LABEL_LENGTH] = '\0';
+  symbol->value = value;
+  symbol->size = 0;
+  symbol->elements = chunk->names_size;
+  symbol->elements_count = 0;
+
+  return symbol;
+}
+
+static void add_element_name(Chunk *chunk, ChunkSymbol *symbol,
+                             const char *name) {
+  int length = strlen(name) + 1;
+
+  if (chunk->names_size + length > chunk->names_capacity) {
+    int capacity = chunk->names_capacity ? 2 * chunk->names_capacity : 1024;
+    char *temp = NULL;
+
+    while (chunk->names_size + length > capacity) {
+      capacity *= 2;
+    }
+
+    temp = (char *)realloc(chunk->names, capacity);
+
+    if (temp == NULL) {
+      fprintf(stderr, ERROR_OUT_OF_MEMORY);
+      exit(EXIT_FAILURE);
+    }
+
+    chunk->names = temp;
+    chunk->names_capacity = capacity;
+  }
+
+  memcpy(chunk->names + chunk->names_size, name, length);
+  chunk->names_size += length;
+  symbol->elements_count++;
+}
+
+/* Records the symbol a line defines and the words it takes, as do_first_pass */
+static void size_line(Chunk *chunk, AST *node, int line) {
+  ChunkSymbol *symbol = NULL;
+  int i = 0;
+
+  chunk->words += get_line_size(node);
+
+  /* The expressions naming defines are folded once the defines are merged */
+  if (node->ASTType != DEFINE && node->expressions_count > 0) {
+    symbol = add_chunk_symbol(chunk, CODE, "", line, 0);
+
+    for (i = 0; i < node->expressions_count; i++) {
+      add_element_name(chunk, symbol, node->expressions[i].text);
+    }
+  }
+
+  if (node->ASTType == DEFINE) {
+    symbol = add_chunk_symbol(chunk, MDEFINE, node->ASTOpt.Define.name, line,
+                              node->ASTOpt.Define.number);
+
+    if (node->expressions_count > 0) {
+      add_element_name(chunk, symbol, node->expressions[0].text);
+    }
+  } else if (node->ASTType == DIRECTIVE) {
+    if ((node->ASTOpt.Dir.DirOpt == DATA ||
+         node->ASTOpt.Dir.DirOpt == STRING) &&
+        strcmp(node->label_name, "") != 0) {
+      symbol =
+          add_chunk_symbol(chunk, MDATA, node->label_name, line, chunk->size);
+
+      if (node->ASTOpt.Dir.DirOpt == DATA) {
+        char **names = node->ASTOpt.Dir.ParamsOpt.Data.names;
+
+        symbol->size = get_data_size(node);
+
+        for (i = 0; names && i < node->ASTOpt.Dir.ParamsOpt.Data.count; i++) {
+          if (names[i]) {
+            add_element_name(chunk, symbol, names[i]);
+          }
+        }
+      } else {
+        symbol->size = strlen(node->ASTOpt.Dir.ParamsOpt.string) + 1;
+      }
+
+      chunk->size += symbol->size;
+    } else if (node->ASTOpt.Dir.DirOpt == DATA ||
+               node->ASTOpt.Dir.DirOpt == STRING) {
+      chunk->size += get_line_size(node);
+    } else if (node->ASTOpt.Dir.DirOpt == EXTERN) {
+      add_chunk_symbol(chunk, EXTERNAL, node->ASTOpt.Dir.ParamsOpt.label, line,
+                       0);
+    }
+  } else if (node->ASTType == INSTRUCTION) {
+    if (strcmp(node->label_name, "") != 0) {
+      add_chunk_symbol(chunk, CODE, node->label_name, line, chunk->size);
+    }
+
+    chunk->size += get_tokens_count(&node);
+  }
+}
+
+/* Records the symbol a scanned line defines and the words it takes */
+static void size_scanned_line(Chunk *chunk, ScannedLine *scanned, int line) {
+  ChunkSymbol *symbol = NULL;
+  const char *element = scanned->elements;
+  int i = 0;
+
+  if (scanned->type == SCAN_DATA || scanned->type == SCAN_STRING ||
+      scanned->type == SCAN_INSTRUCTION) {
+    chunk->words += scanned->size;
+  }
+
+  switch (scanned->type) {
+  case SCAN_DEFINE:
+    add_chunk_symbol(chunk, MDEFINE, scanned->name, line, scanned->value);
+    break;
+  case SCAN_EXTERN:
+    add_chunk_symbol(chunk, EXTERNAL, scanned->name, line, 0);
+    break;
+  case SCAN_DATA:
+  case SCAN_STRING:
+    if (scanned->label[0] != '\0') {
+      symbol = add_chunk_symbol(chunk, MDATA, scanned->label, line,
+                                chunk->size);
+      symbol->size = scanned->size;
+      chunk->size += symbol->size;
+
+      for (i = 0; i < scanned->elements_count; i++) {
+        add_element_name(chunk, symbol, element);
+        element += strlen(element) + 1;
+      }
+    } else {
+      chunk->size += scanned->size;
+    }
+    break;
+  case SCAN_INSTRUCTION:
+    if (scanned->label[0] != '\0') {
+      add_chunk_symbol(chunk, CODE, scanned->label, line, chunk->size);
+    }
+
+    chunk->size += scanned->size;
+    break;
+  default:
+    break;
+  }
+}
+
+static void *parse_chunk(void *arg) {
+  Chunk *chunk = (Chunk *)arg;
+  char line[MAX_LINE_LENGTH];
+  ScannedLine scanned;
+  int i = 0;
+
+  for (i = chunk->first_line; i < chunk->end_line; i++) {
+    Tokens *tokens = NULL;
+    AST *node = NULL;
+
+    read_source_line(chunk->source, i, line);
+
+    /* The layout needs the symbol operands and elements from the parser */
+    if (scan_line(line, &scanned) &&
+        !(chunk->layout && scanned.refers_to_symbols)) {
+      size_scanned_line(chunk, &scanned, i + 1);
+
+      if (chunk->layout) {
+        layout_scanned_line(chunk->layout, &scanned, i + 1);
+      }
+
+      continue;
+    }
+
+    tokens = split_line_to_tokens(line);
+    node = parse_tokens(tokens, i + 1);
+
+    if (node->ASTType != EMPTY && node->ASTType != COMMENT) {
+      add_diagnostic(&chunk->diagnostics, &node->warning);
+
+      if (node->ASTType == ERROR) {
+        add_diagnostic(&chunk->diagnostics, &node->error);
+        chunk->has_error = true;
+      } else {
+        size_line(chunk, node, i + 1);
+
+        if (chunk->layout) {
+          layout_line(chunk->layout, node, i + 1);
+        }
+      }
+    }
+
+    free_ast(node);
+    free(node);
+    free_tokens(tokens);
+  }
+
+  return NULL;
+}
+
+/* Checks the data element names of a data label, as do_first_pass does */
+static bool check_elements(const Chunk *chunk, const ChunkSymbol *symbol,
+                           const SymbolIndex *index,
+                           DiagnosticList *diagnostics) {
+  const char *name = chunk->names + symbol->elements;
+  bool has_error = false;
+  int i = 0;
+
+  for (i = 0; i < symbol->elements_count; i++) {
+    Symbol *symbol_to_find = index_lookup(index, name);
+
+    if (symbol_to_find == NULL) {
+      report_diagnostic(diagnostics, DIAG_UNDEFINED_DATA_SYMBOL_ELEMENT,
+                        symbol->line, 0, name);
+      has_error = true;
+    } else if (symbol_to_find->attribute != MDEFINE) {
+      report_diagnostic(diagnostics, DIAG_INVALID_DATA_ELEMENT_TYPE,
+                        symbol->line, 0, name);
+      has_error = true;
+    }
+
+    name += strlen(name) + 1;
+  }
+
+  return has_error;
+}
+
+/*
+ * Folds the expressions of a define or of the line of an unnamed symbol with
+ * the defines merged so far, reporting the first one failing as
+ * fold_expressions() does. The value of a define is its expression.
+ */
+static bool fold_elements(const Chunk *chunk, ChunkSymbol *symbol,
+                          const SymbolIndex *index,
+                          DiagnosticList *diagnostics) {
+  const char *text = chunk->names + symbol->elements;
+  char name[MAX_LABEL_LENGTH];
+  ConstantScope constants;
+  bool has_error = false;
+  int i = 0;
+
+  constants.index = index;
+  constants.table = NULL;
+  constants.is_strict = true;
+
+  for (i = 0; i < symbol->elements_count; i++) {
+    ExpressionStatus status = evaluate_expression(
+        text, resolve_constant, &constants, &symbol->value, name);
+
+    if (status == EXPRESSION_UNRESOLVED && !has_error) {
+      report_diagnostic(diagnostics, DIAG_UNDEFINED_CONSTANT, symbol->line, 0,
+                        name, text);
+    } else if (status == EXPRESSION_DIVISION_BY_ZERO && !has_error) {
+      report_diagnostic(diagnostics, DIAG_DIVISION_BY_ZERO, symbol->line, 0,
+                        text);
+    } else if (status == EXPRESSION_OUT_OF_RANGE && !has_error) {
+      report_diagnostic(diagnostics, DIAG_EXPRESSION_OUT_OF_RANGE, symbol->line,
+                        0, text, (int)MAX_EXPRESSION_VALUE);
+    }
+
+    has_error = has_error || status != EXPRESSION_FOLDED;
+    text += strlen(text) + 1;
+  }
+
+  return has_error;
+}
+
+/*
+ * Adds the symbols of the chunks to the table in source order. The chunk
+ * offsets are the prefix sums of the chunk sizes, less the words of the data
+ * labels dropped as redefinitions, which the first pass does not count.
+ */
+static bool merge_chunks(Chunk *chunks, int chunks_count, Symbol **symbol_table,
+                         DiagnosticList *diagnostics) {
+  SymbolIndex index;
+  bool has_error = false;
+  int chunk_start = 100;
+  int dropped = 0;
+  int i = 0;
+  int j = 0;
+
+  init_symbol_index(&index, *symbol_table);
+
+  for (i = 0; i < chunks_count; i++) {
+    for (j = 0; j < chunks[i].symbols_count; j++) {
+      ChunkSymbol *symbol = &chunks[i].symbols[j];
+      int value = symbol->value;
+
+      if ((symbol->name[0] == '\0' || symbol->attribute == MDEFINE) &&
+          symbol->elements_count > 0) {
+        if (fold_elements(&chunks[i], symbol, &index, diagnostics)) {
+          has_error = true;
+        }
+
+        value = symbol->value;
+      }
+
+      if (symbol->name[0] == '\0') {
+        continue;
+      }
+
+      if (symbol->attribute == MDATA || symbol->attribute == CODE) {
+        value += chunk_start - dropped;
+      }
+
+      if (index_lookup(&index, symbol->name)) {
+        report_diagnostic(diagnostics, DIAG_REDEFINITION_OF_SYMBOL,
+                          symbol->line, 0, symbol->name);
+        has_error = true;
+
+        if (symbol->attribute == MDATA) {
+          dropped += symbol->size;
+        }
+
+        continue;
+      }
+
+      if (symbol->attribute == MDATA &&
+          check_elements(&chunks[i], symbol, &index, diagnostics)) {
+        has_error = true;
+      }
+
+      index_add_symbol(&index, symbol->name, symbol->attribute, value,
+                       symbol_table);
+    }
+
+    chunk_start += chunks[i].size;
+  }
+
+  free_symbol_index(&index);
+
+  return has_error;
+}
+
+bool do_parallel_first_pass(Symbol **symbol_table, const SourceFile *source,
+                            DiagnosticList *diagnostics, int threads_count,
+                            Layout *layout) {
+  int max_lines = MAX_MEMORY_SIZE / MAX_WORD_SIZE;
+  Chunk *chunks = NULL;
+  bool has_error = false;
+  long image_size = 0;
+  int lines_count = 0;
+  int i = 0;
+  int j = 0;
+
+  /* Like do_first_pass, stop before the line that overflows the memory */
+  lines_count = source->lines_count < max_lines ? source->lines_count
+                                                : max_lines - 1;
+
+  if (threads_count < 1) {
+    threads_count = 1;
+  }
+
+  chunks = (Chunk *)calloc(threads_count, sizeof(Chunk));
+
+  if (chunks == NULL) {
+    fprintf(stderr, ERROR_OUT_OF_MEMORY);
+    exit(EXIT_FAILURE);
+  }
+
+  if (layout) {
+    init_layout(layout, threads_count);
+  }
+
+  for (i = 0; i < threads_count; i++) {
+    chunks[i].source = source;
+    chunks[i].first_line = (long)lines_count * i / threads_count;
+    chunks[i].end_line = (long)lines_count * (i + 1) / threads_count;
+    init_diagnostics(&chunks[i].diagnostics, diagnostics->file_name);
+
+    if (layout) {
+      chunks[i].layout = &layout->chunks[i];
+      chunks[i].layout->first_line = chunks[i].first_line;
+      chunks[i].layout->end_line = chunks[i].end_line;
+    }
+  }
+
+  run_parallel(parse_chunk, chunks, sizeof(Chunk), threads_count);
+
+  for (i = 0; i < threads_count; i++) {
+    for (j = 0; j < chunks[i].diagnostics.count; j++) {
+      add_diagnostic(diagnostics, &chunks[i].diagnostics.diagnostics[j]);
+    }
+
+    has_error = has_error || chunks[i].has_error;
+  }
+
+  if (merge_chunks(chunks, threads_count, symbol_table, diagnostics)) {
+    has_error = true;
+  }
+
+  if (source->lines_count >= max_lines) {
+    report_diagnostic(diagnostics, DIAG_MEMORY_OVERFLOW, max_lines, 0,
+                      max_lines);
+    has_error = true;
+  }
+
+  for (i = 0; i < threads_count; i++) {
+    image_size += chunks[i].words;
+  }
+
+  /* Reported on the line do_first_pass stops at */
+  if (image_size > MAX_IMAGE_SIZE) {
+    report_diagnostic(diagnostics, DIAG_IMAGE_OVERFLOW,
+                      source->lines_count < max_lines ? source->lines_count
+                                                      : max_lines,
+                      0, MAX_IMAGE_SIZE);
+    has_error = true;
+  }
+
+  for (i = 0; i < threads_count; i++) {
+    free(chunks[i].symbols);
+    free(chunks[i].names);
+    free_diagnostics(&chunks[i].diagnostics);
+  }
+
+  free(chunks);
+
+  return has_error;
+}
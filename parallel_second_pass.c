@@ -0,0 +1,300 @@
+/**
+ * @file parallel_second_pass.c
+ * @brief The second pass of the assembler over the chunks of lines laid out by
+ * the chunked first pass, encoded on several threads.
+ *
+ * Once the symbol table is complete, the words of every line depend only on
+ * that line, the symbol table and the .entry lines before it. The pending
+ * words of the layout are resolved, the chunks are given their offset in the
+ * code image by a prefix sum of their sizes, and every chunk is then encoded
+ * by the functions of the sequential second pass straight into its slot of a
+ * code image allocated once. The external uses of every chunk are kept apart
+ * and joined in source order, which is also the order of their addresses.
+ */
+
+#include "assembler.h"
+#include "errors.h"
+#include "parallel.h"
+#include "source.h"
+
+/**
+ * @struct EncodeTask
+ * @brief The encoding of a chunk of lines on its own thread.
+ */
+typedef struct {
+  LayoutChunk *layout;        /**< The layout of the chunk. */
+  const SourceFile *source;   /**< The source the lines belong to. */
+  const SymbolIndex *index;   /**< The index of the frozen symbol table. */
+  Symbol *symbol_table;       /**< The frozen symbol table. */
+  CodeImage code_image;       /**< The view of the slot of the chunk. */
+  Translator translator;      /**< The translator encoding the chunk. */
+  int instruction_counter;    /**< The counter after the last instruction. */
+  int data_counter;           /**< The number of data words encoded. */
+  bool has_error;             /**< Whether a line of the chunk has an error. */
+  DiagnosticList diagnostics; /**< The diagnostics of the encoded lines. */
+} EncodeTask;
+
+static void *resolve_chunk(void *arg) {
+  EncodeTask *task = (EncodeTask *)arg;
+
+  resolve_layout_chunk(task->layout, task->index);
+
+  return NULL;
+}
+
+/* Opens the slot of a line, as laid out by the first pass */
+static void open_slot(EncodeTask *task, LineLayout **next, LineLayout *end,
+                      int line) {
+  if (*next < end && (*next)->line == line) {
+    task->code_image.count = task->layout->offset + (*next)->offset;
+    task->code_image.capacity = task->code_image.count + (*next)->size;
+    (*next)++;
+  } else {
+    task->code_image.capacity = task->code_image.count;
+  }
+}
+
+static void *encode_chunk(void *arg) {
+  EncodeTask *task = (EncodeTask *)arg;
+  LineLayout *next = task->layout->lines;
+  LineLayout *end = next + task->layout->lines_count;
+  char line[MAX_LINE_LENGTH];
+  int current_line = 0;
+  int i = 0;
+
+  for (i = task->layout->first_line; i < task->layout->end_line; i++) {
+    Tokens *tokens = NULL;
+    AST *node = NULL;
+    ScannedLine scanned;
+    bool encodes = false;
+
+    read_source_line(task->source, i, line);
+    current_line = i + 1;
+
+    /* The lines referring to no symbol are encoded without an AST, the
+     * .entry lines being applied before encoding */
+    if (scan_line(line, &scanned) && !scanned.refers_to_symbols &&
+        scanned.type != SCAN_INSTRUCTION) {
+      if (scanned.type == SCAN_DATA || scanned.type == SCAN_STRING) {
+        open_slot(task, &next, end, current_line);
+        handle_scanned_line(&task->translator, &scanned, &task->symbol_table,
+                            &task->data_counter);
+      }
+
+      continue;
+    }
+
+    tokens = split_line_to_tokens(line);
+    node = parse_tokens(tokens, current_line);
+
+    if (node->expressions_count > 0) {
+      ConstantScope constants;
+
+      constants.index = task->translator.symbol_index;
+      constants.table = task->symbol_table;
+      constants.is_strict = false;
+
+      if (fold_constants(node, &constants, current_line, &task->diagnostics)) {
+        task->has_error = true;
+      }
+    }
+
+    encodes = node->ASTType == INSTRUCTION ||
+              (node->ASTType == DIRECTIVE &&
+               (node->ASTOpt.Dir.DirOpt == DATA ||
+                node->ASTOpt.Dir.DirOpt == STRING));
+
+    if (encodes) {
+      open_slot(task, &next, end, current_line);
+    } else {
+      task->code_image.capacity = task->code_image.count;
+    }
+
+    if (node->ASTType == INSTRUCTION) {
+      handle_instruction(&task->translator, node, &task->symbol_table,
+                         &task->instruction_counter, 0, &current_line,
+                         &task->has_error, &task->diagnostics);
+    } else if (node->ASTType == DIRECTIVE &&
+               node->ASTOpt.Dir.DirOpt != ENTRY) {
+      /* The .entry lines were applied to the symbols before encoding */
+      handle_directive(&task->translator, node, &task->symbol_table,
+                       &task->data_counter, &current_line, &task->has_error,
+                       &task->diagnostics);
+    }
+
+    free_ast(node);
+    free(node);
+    free_tokens(tokens);
+  }
+
+  return NULL;
+}
+
+/* Marks the symbols of the .entry lines with the first line declaring them */
+static void mark_entries(Layout *layout, const SymbolIndex *index) {
+  int i = 0;
+  int j = 0;
+
+  for (i = 0; i < layout->chunks_count; i++) {
+    LayoutChunk *chunk = &layout->chunks[i];
+
+    for (j = 0; j < chunk->entries_count; j++) {
+      Symbol *symbol =
+          index_lookup(index, chunk->names + chunk->entries[j].name);
+
+      if (symbol && symbol->entry_line == 0) {
+        symbol->entry_line = chunk->entries[j].line;
+      }
+    }
+  }
+}
+
+/* Makes the marked symbols internal, as the .entry lines would have done */
+static void apply_entries(Layout *layout, const SymbolIndex *index) {
+  int i = 0;
+  int j = 0;
+
+  for (i = 0; i < layout->chunks_count; i++) {
+    LayoutChunk *chunk = &layout->chunks[i];
+
+    for (j = 0; j < chunk->entries_count; j++) {
+      Symbol *symbol =
+          index_lookup(index, chunk->names + chunk->entries[j].name);
+
+      if (symbol) {
+        symbol->attribute = INTERNAL;
+        symbol->entry_line = 0;
+      }
+    }
+  }
+}
+
+bool do_parallel_second_pass(Translator **translator, Symbol **symbol_table,
+                             const SourceFile *source, Layout *layout,
+                             int *instruction_counter, int *data_counter,
+                             DiagnosticList *diagnostics) {
+  SymbolIndex index;
+  EncodeTask *tasks = NULL;
+  CodeImage *code_image = NULL;
+  Symbol **next_external = NULL;
+  bool has_error = false;
+  int i = 0;
+  int j = 0;
+
+  init_symbol_index(&index, *symbol_table);
+  mark_entries(layout, &index);
+
+  tasks = (EncodeTask *)calloc(
+      layout->chunks_count > 0 ? layout->chunks_count : 1, sizeof(EncodeTask));
+
+  if (tasks == NULL) {
+    fprintf(stderr, ERROR_OUT_OF_MEMORY);
+    exit(EXIT_FAILURE);
+  }
+
+  for (i = 0; i < layout->chunks_count; i++) {
+    tasks[i].layout = &layout->chunks[i];
+    tasks[i].index = &index;
+  }
+
+  run_parallel(resolve_chunk, tasks, sizeof(EncodeTask), layout->chunks_count);
+
+  /* The offset of every chunk is the sum of the sizes of the chunks before */
+  code_image = (CodeImage *)malloc(sizeof(CodeImage));
+
+  if (code_image == NULL) {
+    fprintf(stderr, ERROR_OUT_OF_MEMORY);
+    exit(EXIT_FAILURE);
+  }
+
+  layout->size = 0;
+
+  for (i = 0; i < layout->chunks_count; i++) {
+    LayoutChunk *chunk = &layout->chunks[i];
+
+    chunk->offset = layout->size;
+    tasks[i].instruction_counter = *instruction_counter;
+    layout->size += chunk->size;
+
+    if (chunk->instructions_end >= 0) {
+      *instruction_counter = chunk->offset + chunk->instructions_end;
+    }
+  }
+
+  code_image->words = (int *)calloc(layout->size + 1, sizeof(int));
+  code_image->count = layout->size;
+  code_image->capacity = layout->size;
+  code_image->preassigned = false;
+
+  if (code_image->words == NULL) {
+    fprintf(stderr, ERROR_OUT_OF_MEMORY);
+    exit(EXIT_FAILURE);
+  }
+
+  for (i = 0; i < layout->chunks_count; i++) {
+    tasks[i].source = source;
+    tasks[i].symbol_table = *symbol_table;
+    tasks[i].code_image.words = code_image->words;
+    tasks[i].code_image.count = layout->chunks[i].offset;
+    tasks[i].code_image.capacity = layout->chunks[i].offset;
+    tasks[i].code_image.preassigned = true;
+    tasks[i].translator.code_image = &tasks[i].code_image;
+    tasks[i].translator.symbol_index = &index;
+    init_diagnostics(&tasks[i].diagnostics, diagnostics->file_name);
+  }
+
+  run_parallel(encode_chunk, tasks, sizeof(EncodeTask), layout->chunks_count);
+
+  *translator = (Translator *)malloc(sizeof(Translator));
+
+  if (*translator == NULL) {
+    fprintf(stderr, ERROR_OUT_OF_MEMORY);
+    exit(EXIT_FAILURE);
+  }
+
+  (*translator)->code_image = code_image;
+  (*translator)->external_symbols = NULL;
+  (*translator)->last_external_symbol = NULL;
+  (*translator)->internal_symbols = NULL;
+  (*translator)->symbol_index = NULL;
+  init_line_table(&(*translator)->lines);
+  next_external = &(*translator)->external_symbols;
+
+  for (i = 0; i < layout->chunks_count; i++) {
+    for (j = 0; j < tasks[i].diagnostics.count; j++) {
+      add_diagnostic(diagnostics, &tasks[i].diagnostics.diagnostics[j]);
+    }
+
+    if (tasks[i].translator.external_symbols) {
+      *next_external = tasks[i].translator.external_symbols;
+      next_external = &tasks[i].translator.last_external_symbol->next;
+      (*translator)->last_external_symbol =
+          tasks[i].translator.last_external_symbol;
+    }
+
+    *data_counter += tasks[i].data_counter;
+    has_error = has_error || tasks[i].has_error;
+    free_diagnostics(&tasks[i].diagnostics);
+  }
+
+  /* The lines encoding words are where the first pass laid them out */
+  for (i = 0; i < layout->chunks_count; i++) {
+    LayoutChunk *chunk = &layout->chunks[i];
+
+    for (j = 0; j < chunk->lines_count; j++) {
+      if (chunk->lines[j].size > 0) {
+        add_line_run(&(*translator)->lines,
+                     chunk->offset + chunk->lines[j].offset,
+                     chunk->lines[j].line);
+      }
+    }
+  }
+
+  apply_entries(layout, &index);
+  add_internal_symbols(*translator, *symbol_table);
+
+  free(tasks);
+  free_symbol_index(&index);
+
+  return has_error;
+}
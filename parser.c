@@ -1,7 +1,6 @@
 #include "parser.h"
 #include "errors.h"
 #include "lexer.h"
-#include <stdarg.h>
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
@@ -9,8 +8,131 @@
 extern Instruction inst_table[INST_TABLE_SIZE];
 extern char *keywords[KEYWORDS_COUNT];
 
-AST *parse_tokens(Tokens *tokens, int line_number,
-                  const char *input_file_name) {
+/* The column of a token, or of the last token when the index is past it */
+static int token_column(Tokens *tokens, int index) {
+  if (tokens->count == 0) {
+    return 0;
+  }
+
+  return tokens->columns[index < tokens->count ? index : tokens->count - 1];
+}
+
+/* Joins the tokens from the index to the end of the line with spaces */
+static char *join_tokens(Tokens *tokens, int index) {
+  size_t length = 1;
+  char *joined = NULL;
+  int i;
+
+  for (i = index; i < tokens->count; i++) {
+    length += strlen(tokens->tokens[i]) + 1;
+  }
+
+  joined = (char *)malloc(length);
+
+  if (joined == NULL) {
+    fprintf(stderr, ERROR_OUT_OF_MEMORY);
+    exit(EXIT_FAILURE);
+  }
+
+  joined[0] = '\0';
+
+  for (i = index; i < tokens->count; i++) {
+    if (i > index) {
+      strcat(joined, " ");
+    }
+
+    strcat(joined, tokens->tokens[i]);
+  }
+
+  return joined;
+}
+
+/* Allocates the values of a data line for at most capacity elements */
+static void init_data(AST *ast, int capacity, int repeat) {
+  ast->ASTOpt.Dir.ParamsOpt.Data.values =
+      (int *)malloc((capacity > 0 ? capacity : 1) * sizeof(int));
+
+  if (ast->ASTOpt.Dir.ParamsOpt.Data.values == NULL) {
+    fprintf(stderr, ERROR_OUT_OF_MEMORY);
+    exit(EXIT_FAILURE);
+  }
+
+  ast->ASTOpt.Dir.ParamsOpt.Data.names = NULL;
+  ast->ASTOpt.Dir.ParamsOpt.Data.count = 0;
+  ast->ASTOpt.Dir.ParamsOpt.Data.repeat = repeat;
+}
+
+/* Adds an expression to fold into a number of the AST, taking its text */
+static void add_expression(AST *ast, char *text, int *value) {
+  ConstantExpression *temp = (ConstantExpression *)realloc(
+      ast->expressions,
+      (ast->expressions_count + 1) * sizeof(ConstantExpression));
+
+  if (temp == NULL) {
+    fprintf(stderr, ERROR_OUT_OF_MEMORY);
+    exit(EXIT_FAILURE);
+  }
+
+  *value = 0;
+  ast->expressions = temp;
+  ast->expressions[ast->expressions_count].text = text;
+  ast->expressions[ast->expressions_count].value = value;
+  ast->expressions_count++;
+}
+
+/* Adds an element to a data line, converting a number once and for all */
+static void add_data_element(AST *ast, const char *element, int capacity) {
+  int index = ast->ASTOpt.Dir.ParamsOpt.Data.count++;
+
+  if (is_integer(element)) {
+    ast->ASTOpt.Dir.ParamsOpt.Data.values[index] = atoi(element);
+    return;
+  }
+
+  if (is_expression(element)) {
+    add_expression(ast, strdup(element),
+                   &ast->ASTOpt.Dir.ParamsOpt.Data.values[index]);
+    return;
+  }
+
+  /* Only the lines naming symbols keep names */
+  if (ast->ASTOpt.Dir.ParamsOpt.Data.names == NULL) {
+    ast->ASTOpt.Dir.ParamsOpt.Data.names =
+        (char **)calloc(capacity, sizeof(char *));
+
+    if (ast->ASTOpt.Dir.ParamsOpt.Data.names == NULL) {
+      fprintf(stderr, ERROR_OUT_OF_MEMORY);
+      exit(EXIT_FAILURE);
+    }
+  }
+
+  ast->ASTOpt.Dir.ParamsOpt.Data.values[index] = 0;
+  ast->ASTOpt.Dir.ParamsOpt.Data.names[index] = strdup(element);
+}
+
+/* Frees the data elements, also when a .data line turned out invalid */
+static void free_data_elements(AST *ast) {
+  int i = 0;
+
+  if (ast->ASTOpt.Dir.ParamsOpt.Data.names) {
+    for (i = 0; i < ast->ASTOpt.Dir.ParamsOpt.Data.count; i++) {
+      free(ast->ASTOpt.Dir.ParamsOpt.Data.names[i]);
+    }
+  }
+
+  free(ast->ASTOpt.Dir.ParamsOpt.Data.names);
+  free(ast->ASTOpt.Dir.ParamsOpt.Data.values);
+  ast->ASTOpt.Dir.ParamsOpt.Data.names = NULL;
+  ast->ASTOpt.Dir.ParamsOpt.Data.values = NULL;
+  ast->ASTOpt.Dir.ParamsOpt.Data.count = 0;
+}
+
+/*
+ * Parses the tokens of a line. The name of a .define is also stored in
+ * define_name, since the tokens after it can still turn the line into
+ * another kind of line, which overwrites it.
+ */
+static AST *parse_line(Tokens *tokens, int line_number, char **define_name) {
   int tokenIndex = 0;
   int operandIndex = 0;
   char *label = NULL;
@@ -38,8 +160,8 @@ AST *parse_tokens(Tokens *tokens, int line_number,
     if (tokens->tokens[tokenIndex] != NULL) {
 
       if (strcmp(tokens->tokens[tokenIndex], ",") == 0) {
-        write_error_message(ast, ERROR_UNEXPECTED_COMMA, line_number,
-                            input_file_name);
+        set_diagnostic(&ast->error, DIAG_UNEXPECTED_COMMA, line_number,
+                       token_column(tokens, tokenIndex));
 
         ast->ASTType = ERROR;
         return ast;
@@ -49,16 +171,17 @@ AST *parse_tokens(Tokens *tokens, int line_number,
         ast->ASTType = COMMENT;
         return ast;
       } else if (tokens->count > 1 && strcmp(tokens->tokens[1], ":") == 0) {
-        write_error_message(ast, ERROR_WHITESPACE_AFTER_LABEL, line_number,
-                            input_file_name);
+        set_diagnostic(&ast->error, DIAG_WHITESPACE_AFTER_LABEL, line_number,
+                       token_column(tokens, tokenIndex));
 
         ast->ASTType = ERROR;
         return ast;
       } else if (tokens->tokens[tokenIndex][strlen(tokens->tokens[tokenIndex]) -
                                             1] == ':') {
-        label = strtok(tokens->tokens[tokenIndex], ":");
+        label = first_token(tokens->tokens[tokenIndex], ":");
 
-        if (is_label_valid(ast, label, line_number, input_file_name)) {
+        if (is_label_valid(&ast->error, label, line_number,
+                           token_column(tokens, tokenIndex))) {
           strcpy(ast->label_name, label);
           remove_token(tokens, label);
           tokenIndex--;
@@ -71,14 +194,12 @@ AST *parse_tokens(Tokens *tokens, int line_number,
         tokenIndex++; /* Move to the next token, which should be the name */
 
         if (tokens->tokens[tokenIndex]) {
-          if (!is_label_valid(ast, tokens->tokens[tokenIndex], line_number,
-                              input_file_name)) {
+          if (!is_label_valid(&ast->error, tokens->tokens[tokenIndex],
+                              line_number, token_column(tokens, tokenIndex))) {
             ast->ASTType = ERROR;
             return ast;
           }
 
-          ast->ASTOpt.Define.name = strdup(tokens->tokens[tokenIndex]);
-
           tokenIndex++; /* Move to the next token, which should be the '=' sign
                          */
 
@@ -88,94 +209,119 @@ AST *parse_tokens(Tokens *tokens, int line_number,
                            */
 
             if (tokens->tokens[tokenIndex]) {
-              ast->ASTOpt.Define.number = atoi(tokens->tokens[tokenIndex]);
+              char *value = join_tokens(tokens, tokenIndex);
+              char *name = tokens->tokens[tokenIndex - 2];
+              int number = 0;
+
+              if (evaluate_expression(value, NULL, NULL, &number, NULL) !=
+                  EXPRESSION_INVALID) {
+                /* The expression takes the rest of the line */
+                add_expression(ast, value, &ast->ASTOpt.Define.number);
+                tokenIndex = tokens->count - 1;
+              } else if (is_number_valid(tokens->tokens[tokenIndex])) {
+                /* A number followed by other tokens, which are ignored */
+                ast->ASTOpt.Define.number = atoi(tokens->tokens[tokenIndex]);
+                free(value);
+              } else {
+                set_diagnostic(&ast->error, DIAG_INVALID_DEFINE_DEFINITION,
+                               line_number, token_column(tokens, tokenIndex),
+                               ERROR_EXPECTED_EXPRESSION_AFTER_EQUAL_SIGN);
+                free(value);
+                ast->ASTType = ERROR;
+                return ast;
+              }
+
+              free(*define_name);
+              *define_name = strdup(name);
+              ast->ASTOpt.Define.name = *define_name;
               ast->ASTType = DEFINE;
             } else {
-              write_error_message(ast, ERROR_INVALID_DEFINE_DEFINITION,
-                                  ERROR_EXPECTED_NUMBER_AFTER_EQUAL_SIGN,
-                                  line_number, input_file_name);
+              set_diagnostic(&ast->error, DIAG_INVALID_DEFINE_DEFINITION,
+                             line_number, token_column(tokens, tokenIndex),
+                             ERROR_EXPECTED_NUMBER_AFTER_EQUAL_SIGN);
               ast->ASTType = ERROR;
               return ast;
             }
           } else {
-            write_error_message(ast, ERROR_INVALID_DEFINE_DEFINITION,
-                                ERROR_EXPECTED_EQUAL_SIGN_AFTER_DEFINE_NAME,
-                                line_number, input_file_name);
+            set_diagnostic(&ast->error, DIAG_INVALID_DEFINE_DEFINITION,
+                           line_number, token_column(tokens, tokenIndex),
+                           ERROR_EXPECTED_EQUAL_SIGN_AFTER_DEFINE_NAME);
 
             ast->ASTType = ERROR;
             return ast;
           }
         } else {
-          write_error_message(ast, ERROR_INVALID_DEFINE_DEFINITION,
-                              ERROR_EXPECTED_NAME_AFTER_DEFINE, line_number,
-                              input_file_name);
+          set_diagnostic(&ast->error, DIAG_INVALID_DEFINE_DEFINITION,
+                         line_number, token_column(tokens, tokenIndex),
+                         ERROR_EXPECTED_NAME_AFTER_DEFINE);
           ast->ASTType = ERROR;
           return ast;
         }
       } else if (strcmp(tokens->tokens[tokenIndex], ".data") == 0) {
-        /* This is a data directive */
+        /* This is a data directive, of at most the tokens after it */
+        int capacity = tokens->count - tokenIndex - 1;
 
         tokenIndex++; /* Move to the next token, which should be the data */
 
+        if (tokenIndex >= tokens->count) {
+          set_diagnostic(&ast->error, DIAG_INVALID_BLOCK_DIRECTIVE,
+                         line_number, token_column(tokens, tokenIndex - 1),
+                         tokens->tokens[tokenIndex - 1], USAGE_DATA);
+          ast->ASTType = ERROR;
+          return ast;
+        }
+
         if (strcmp(tokens->tokens[tokenIndex], ",") == 0) {
-          write_error_message(ast, ERROR_UNEXPECTED_COMMA_AFTER_KEYWORD,
-                              tokens->tokens[tokenIndex - 1], line_number,
-                              input_file_name);
+          set_diagnostic(&ast->error, DIAG_UNEXPECTED_COMMA_AFTER_KEYWORD,
+                         line_number, token_column(tokens, tokenIndex),
+                         tokens->tokens[tokenIndex - 1]);
           ast->ASTType = ERROR;
           return ast;
         }
 
         if (strcmp(tokens->tokens[tokens->count - 1], ",") == 0) {
-          write_error_message(ast, ERROR_UNEXPECTED_COMMA_AFTER_DIRECTIVE,
-                              line_number, input_file_name);
+          set_diagnostic(&ast->error, DIAG_UNEXPECTED_COMMA_AFTER_DIRECTIVE,
+                         line_number, token_column(tokens, tokens->count - 1));
           ast->ASTType = ERROR;
           return ast;
         }
 
+        init_data(ast, capacity, 1);
+
         while (tokenIndex < tokens->count) {
           if ((strcmp(tokens->tokens[tokenIndex], ",") != 0) &&
               (is_number_valid(tokens->tokens[tokenIndex]) ||
-               is_label_valid(ast, tokens->tokens[tokenIndex], line_number,
-                              input_file_name))) {
-            char **temp = NULL;
+               is_label_valid(NULL, tokens->tokens[tokenIndex], line_number,
+                              0) ||
+               is_expression(tokens->tokens[tokenIndex]))) {
             if (tokenIndex + 1 < tokens->count &&
                 tokens->tokens[tokenIndex + 1] &&
                 strcmp(tokens->tokens[tokenIndex + 1], ",") != 0) {
-              write_error_message(ast, ERROR_MISSING_COMMA_BETWEEN_NUMBERS,
-                                  tokens->tokens[tokenIndex],
-                                  tokens->tokens[tokenIndex + 1], line_number,
-                                  input_file_name);
+              set_diagnostic(&ast->error, DIAG_MISSING_COMMA_BETWEEN_NUMBERS,
+                             line_number, token_column(tokens, tokenIndex + 1),
+                             tokens->tokens[tokenIndex],
+                             tokens->tokens[tokenIndex + 1]);
+              free_data_elements(ast);
               ast->ASTType = ERROR;
               return ast;
             }
 
-            temp = (char **)realloc(ast->ASTOpt.Dir.ParamsOpt.Data.elements,
-                                    (ast->ASTOpt.Dir.ParamsOpt.Data.count + 1) *
-                                        sizeof(char *));
-
-            if (temp == NULL) {
-              fprintf(stderr, ERROR_OUT_OF_MEMORY);
-              exit(EXIT_FAILURE);
-            }
-            ast->ASTOpt.Dir.ParamsOpt.Data.elements = temp;
-
-            ast->ASTOpt.Dir.ParamsOpt.Data
-                .elements[ast->ASTOpt.Dir.ParamsOpt.Data.count] =
-                tokens->tokens[tokenIndex];
-            ast->ASTOpt.Dir.ParamsOpt.Data.count++;
+            add_data_element(ast, tokens->tokens[tokenIndex], capacity);
           } else if (strcmp(tokens->tokens[tokenIndex], ",") == 0) {
             if (!tokens->tokens[tokenIndex + 1] ||
                 strcmp(tokens->tokens[tokenIndex + 1], ",") == 0) {
-              write_error_message(ast, ERROR_EXTRA_COMMA_AFTER_NUMBER,
-                                  tokens->tokens[tokenIndex - 1], line_number,
-                                  input_file_name);
+              set_diagnostic(&ast->error, DIAG_EXTRA_COMMA_AFTER_NUMBER,
+                             line_number, token_column(tokens, tokenIndex),
+                             tokens->tokens[tokenIndex - 1]);
+              free_data_elements(ast);
               ast->ASTType = ERROR;
               return ast;
             }
           } else {
-            write_error_message(ast, ERROR_INVALID_DATA_ELEMENT,
-                                tokens->tokens[tokenIndex], line_number,
-                                input_file_name);
+            set_diagnostic(&ast->error, DIAG_INVALID_DATA_ELEMENT, line_number,
+                           token_column(tokens, tokenIndex),
+                           tokens->tokens[tokenIndex]);
+            free_data_elements(ast);
             ast->ASTType = ERROR;
             return ast;
           }
@@ -188,6 +334,53 @@ AST *parse_tokens(Tokens *tokens, int line_number,
 
         return ast;
 
+      } else if (strcmp(tokens->tokens[tokenIndex], ".fill") == 0 ||
+                 strcmp(tokens->tokens[tokenIndex], ".space") == 0) {
+        /* A block of one element repeated, .space being a block of zeros */
+        bool is_fill = strcmp(tokens->tokens[tokenIndex], ".fill") == 0;
+        char *size = NULL;
+        long words = 0;
+
+        if (tokens->count - tokenIndex != (is_fill ? 4 : 2) ||
+            (is_fill && strcmp(tokens->tokens[tokenIndex + 2], ",") != 0)) {
+          set_diagnostic(&ast->error, DIAG_INVALID_BLOCK_DIRECTIVE,
+                         line_number, token_column(tokens, tokenIndex),
+                         tokens->tokens[tokenIndex],
+                         is_fill ? USAGE_FILL : USAGE_SPACE);
+          ast->ASTType = ERROR;
+          return ast;
+        }
+
+        size = tokens->tokens[tokenIndex + 1];
+        words = is_integer(size) ? strtol(size, NULL, 10) : 0;
+
+        if (words < 1 || words > MAX_IMAGE_SIZE) {
+          set_diagnostic(&ast->error, DIAG_INVALID_BLOCK_SIZE, line_number,
+                         token_column(tokens, tokenIndex + 1), size,
+                         MAX_IMAGE_SIZE);
+          ast->ASTType = ERROR;
+          return ast;
+        }
+
+        if (is_fill && !is_number_valid(tokens->tokens[tokenIndex + 3]) &&
+            !is_label_valid(NULL, tokens->tokens[tokenIndex + 3], line_number,
+                            0) &&
+            !is_expression(tokens->tokens[tokenIndex + 3])) {
+          set_diagnostic(&ast->error, DIAG_INVALID_DATA_ELEMENT, line_number,
+                         token_column(tokens, tokenIndex + 3),
+                         tokens->tokens[tokenIndex + 3]);
+          ast->ASTType = ERROR;
+          return ast;
+        }
+
+        init_data(ast, 1, words);
+        add_data_element(ast, is_fill ? tokens->tokens[tokenIndex + 3] : "0",
+                         1);
+
+        ast->ASTType = DIRECTIVE;
+        ast->ASTOpt.Dir.DirOpt = DATA;
+
+        return ast;
       } else if (strcmp(tokens->tokens[tokenIndex], ".string") == 0) {
         /* This is a string directive */
         tokenIndex++; /* Move to the next token, which should be the string */
@@ -196,53 +389,50 @@ AST *parse_tokens(Tokens *tokens, int line_number,
           int len = strlen(tokens->tokens[tokenIndex]);
 
           if (strcmp(tokens->tokens[tokenIndex], ",") == 0) {
-            write_error_message(ast, ERROR_UNEXPECTED_COMMA_AFTER_DIRECTIVE,
-                                tokens->tokens[tokenIndex - 1], line_number,
-                                input_file_name);
+            set_diagnostic(&ast->error, DIAG_UNEXPECTED_COMMA_AFTER_DIRECTIVE,
+                           line_number, token_column(tokens, tokenIndex));
             ast->ASTType = ERROR;
             return ast;
           }
 
-          if (tokens->tokens[tokenIndex][0] == '"' &&
+          if (len >= 2 && tokens->tokens[tokenIndex][0] == '"' &&
               tokens->tokens[tokenIndex][len - 1] == '"') {
+            /* The escapes only shorten the string */
+            char *string = (char *)malloc((len - 1) * sizeof(char));
 
-            char *str_without_quotes = (char *)malloc((len - 1) * sizeof(char));
-
-            if (str_without_quotes == NULL) {
+            if (string == NULL) {
               fprintf(stderr, ERROR_OUT_OF_MEMORY);
               exit(EXIT_FAILURE);
             }
 
-            strncpy(str_without_quotes, tokens->tokens[tokenIndex] + 1,
-                    len - 2);
-            str_without_quotes[len - 2] = '\0';
+            if (decode_string(tokens->tokens[tokenIndex] + 1, len - 2,
+                              string) < 0) {
+              free(string);
+              set_diagnostic(&ast->error, DIAG_INVALID_STRING_DEFINITION,
+                             line_number, token_column(tokens, tokenIndex),
+                             ERROR_INVALID_STRING_ESCAPE);
 
-            if (ast->ASTOpt.Dir.ParamsOpt.string != NULL) {
-              free(ast->ASTOpt.Dir.ParamsOpt.string);
+              ast->ASTType = ERROR;
+              return ast;
             }
 
-            ast->ASTOpt.Dir.ParamsOpt.string =
-                (char *)malloc((strlen(str_without_quotes) + 1) * sizeof(char));
-
-            if (ast->ASTOpt.Dir.ParamsOpt.string == NULL) {
-              fprintf(stderr, ERROR_OUT_OF_MEMORY);
-              exit(EXIT_FAILURE);
+            if (ast->ASTOpt.Dir.ParamsOpt.string != NULL) {
+              free(ast->ASTOpt.Dir.ParamsOpt.string);
             }
 
-            strcpy(ast->ASTOpt.Dir.ParamsOpt.string, str_without_quotes);
-            free(str_without_quotes);
+            ast->ASTOpt.Dir.ParamsOpt.string = string;
           } else {
-            write_error_message(ast, ERROR_INVALID_STRING_DEFINITION,
-                                ERROR_EXPECTED_STRING_QUOTES, line_number,
-                                input_file_name);
+            set_diagnostic(&ast->error, DIAG_INVALID_STRING_DEFINITION,
+                           line_number, token_column(tokens, tokenIndex),
+                           ERROR_EXPECTED_STRING_QUOTES);
 
             ast->ASTType = ERROR;
             return ast;
           }
         } else {
-          write_error_message(ast, ERROR_INVALID_STRING_DEFINITION,
-                              ERROR_EXPECTED_NAME_AFTER_STRING, line_number,
-                              input_file_name);
+          set_diagnostic(&ast->error, DIAG_INVALID_STRING_DEFINITION,
+                         line_number, token_column(tokens, tokenIndex),
+                         ERROR_EXPECTED_NAME_AFTER_STRING);
 
           ast->ASTType = ERROR;
           return ast;
@@ -256,9 +446,8 @@ AST *parse_tokens(Tokens *tokens, int line_number,
                  strcmp(tokens->tokens[tokenIndex], ".extern") == 0) {
         int i = 0;
         if (ast->label_name[0] != '\0') {
-          write_error_message(ast, WARN_LABEL_IGNORED, ast->label_name,
-                              line_number, input_file_name);
-          printf("%s", ast->syntax_error);
+          set_diagnostic(&ast->warning, DIAG_LABEL_IGNORED, line_number,
+                         token_column(tokens, tokenIndex), ast->label_name);
 
           for (i = 0; i < MAX_LABEL_LENGTH; i++) {
             ast->label_name[i] = 0;
@@ -269,15 +458,15 @@ AST *parse_tokens(Tokens *tokens, int line_number,
 
         if (tokens->tokens[tokenIndex]) {
           if (strcmp(tokens->tokens[tokenIndex], ",") == 0) {
-            write_error_message(ast, ERROR_UNEXPECTED_COMMA_AFTER_KEYWORD,
-                                tokens->tokens[tokenIndex - 1], line_number,
-                                input_file_name);
+            set_diagnostic(&ast->error, DIAG_UNEXPECTED_COMMA_AFTER_KEYWORD,
+                           line_number, token_column(tokens, tokenIndex),
+                           tokens->tokens[tokenIndex - 1]);
             ast->ASTType = ERROR;
             return ast;
           }
 
-          if (is_label_valid(ast, tokens->tokens[tokenIndex], line_number,
-                             input_file_name)) {
+          if (is_label_valid(&ast->error, tokens->tokens[tokenIndex],
+                             line_number, token_column(tokens, tokenIndex))) {
             strcpy(ast->ASTOpt.Dir.ParamsOpt.label, tokens->tokens[tokenIndex]);
             ast->ASTType = DIRECTIVE;
 
@@ -292,17 +481,17 @@ AST *parse_tokens(Tokens *tokens, int line_number,
           }
 
         } else {
-          write_error_message(ast, ERROR_EXPECTED_LABEL,
-                              tokens->tokens[tokenIndex - 1], line_number,
-                              input_file_name);
+          set_diagnostic(&ast->error, DIAG_EXPECTED_LABEL, line_number,
+                         token_column(tokens, tokenIndex),
+                         tokens->tokens[tokenIndex - 1]);
           ast->ASTType = ERROR;
           return ast;
         }
       } else if (is_instruction_valid(tokens->tokens[tokenIndex], &instIndex)) {
         if (strcmp(tokens->tokens[tokens->count - 1], ",") == 0) {
-          write_error_message(ast, ERROR_UNEXPECTED_COMMA_AFTER_INSTRUCTION,
-                              tokens->tokens[tokenIndex], line_number,
-                              input_file_name);
+          set_diagnostic(&ast->error, DIAG_UNEXPECTED_COMMA_AFTER_INSTRUCTION,
+                         line_number, token_column(tokens, tokenIndex),
+                         tokens->tokens[tokenIndex]);
 
           ast->ASTType = ERROR;
           return ast;
@@ -318,10 +507,10 @@ AST *parse_tokens(Tokens *tokens, int line_number,
           if (operandsCount > 1) {
             if (tokenIndex + 2 < tokens->count) {
               if (strcmp(tokens->tokens[tokenIndex + 2], ",") != 0) {
-                write_error_message(ast, ERROR_EXPECTED_COMMA_AFTER_OPERAND,
-                                    tokens->tokens[tokenIndex],
-                                    tokens->tokens[tokenIndex + 1], line_number,
-                                    input_file_name);
+                set_diagnostic(&ast->error, DIAG_EXPECTED_COMMA_AFTER_OPERAND,
+                               line_number, token_column(tokens, tokenIndex),
+                               tokens->tokens[tokenIndex],
+                               tokens->tokens[tokenIndex + 1]);
 
                 ast->ASTType = ERROR;
                 return ast;
@@ -330,11 +519,11 @@ AST *parse_tokens(Tokens *tokens, int line_number,
               if (tokenIndex + 3 < tokens->count) {
                 if ((strcmp(tokens->tokens[tokenIndex + 2], ",") == 0) &&
                     (strcmp(tokens->tokens[tokenIndex + 3], ",") == 0)) {
-                  write_error_message(ast,
-                                      ERROR_UNEXPECTED_COMMAS_AFTER_OPERAND,
-                                      tokens->tokens[tokenIndex],
-                                      tokens->tokens[tokenIndex + 1],
-                                      line_number, input_file_name);
+                  set_diagnostic(&ast->error,
+                                 DIAG_UNEXPECTED_COMMAS_AFTER_OPERAND,
+                                 line_number, token_column(tokens, tokenIndex),
+                                 tokens->tokens[tokenIndex],
+                                 tokens->tokens[tokenIndex + 1]);
 
                   ast->ASTType = ERROR;
                   return ast;
@@ -345,22 +534,22 @@ AST *parse_tokens(Tokens *tokens, int line_number,
             if (tokens->count > 2 &&
                 strcmp(tokens->tokens[tokenIndex + 2], ",") == 0) {
               if (tokens->count == 3) {
-                write_error_message(ast, ERROR_UNEXPECTED_COMMA_AFTER_OPERAND,
-                                    tokens->tokens[tokenIndex],
-                                    tokens->tokens[tokenIndex + 1], line_number,
-                                    input_file_name);
+                set_diagnostic(&ast->error, DIAG_UNEXPECTED_COMMA_AFTER_OPERAND,
+                               line_number, token_column(tokens, tokenIndex),
+                               tokens->tokens[tokenIndex],
+                               tokens->tokens[tokenIndex + 1]);
               } else if (tokens->count > 3) {
                 if (strcmp(tokens->tokens[tokenIndex + 3], ",") == 0) {
-                  write_error_message(ast,
-                                      ERROR_UNEXPECTED_COMMAS_AFTER_OPERAND,
-                                      tokens->tokens[tokenIndex],
-                                      tokens->tokens[tokenIndex + 1],
-                                      line_number, input_file_name);
+                  set_diagnostic(&ast->error,
+                                 DIAG_UNEXPECTED_COMMAS_AFTER_OPERAND,
+                                 line_number, token_column(tokens, tokenIndex),
+                                 tokens->tokens[tokenIndex],
+                                 tokens->tokens[tokenIndex + 1]);
                 } else {
-                  write_error_message(
-                      ast, ERROR_UNEXPECTED_OPERANDS_AFTER_INSTRUCTION,
-                      tokens->tokens[tokenIndex], operandsCount, line_number,
-                      input_file_name);
+                  set_diagnostic(&ast->error,
+                                 DIAG_UNEXPECTED_OPERANDS_AFTER_INSTRUCTION,
+                                 line_number, token_column(tokens, tokenIndex),
+                                 tokens->tokens[tokenIndex], operandsCount);
                 }
               }
 
@@ -374,17 +563,18 @@ AST *parse_tokens(Tokens *tokens, int line_number,
           }
 
           if (operandsCount > tokens->count - 1) {
-            write_error_message(ast, ERROR_EXPECTED_OPERANDS_AFTER_INSTRUCTION,
-                                tokens->tokens[tokenIndex], operandsCount,
-                                line_number, input_file_name);
+            set_diagnostic(&ast->error,
+                           DIAG_EXPECTED_OPERANDS_AFTER_INSTRUCTION,
+                           line_number, token_column(tokens, tokenIndex),
+                           tokens->tokens[tokenIndex], operandsCount);
 
             ast->ASTType = ERROR;
             return ast;
           } else if (operandsCount < tokens->count - 1) {
-            write_error_message(ast,
-                                ERROR_UNEXPECTED_OPERANDS_AFTER_INSTRUCTION,
-                                tokens->tokens[tokenIndex], operandsCount,
-                                line_number, input_file_name);
+            set_diagnostic(&ast->error,
+                           DIAG_UNEXPECTED_OPERANDS_AFTER_INSTRUCTION,
+                           line_number, token_column(tokens, tokenIndex),
+                           tokens->tokens[tokenIndex], operandsCount);
 
             ast->ASTType = ERROR;
             return ast;
@@ -397,31 +587,30 @@ AST *parse_tokens(Tokens *tokens, int line_number,
               operandIndex = 1;
             }
 
-            operandType = identify_operand(operand, operandIndex, ast,
-                                           line_number, input_file_name);
+            operandType = identify_operand(operand, operandIndex, ast);
 
             if (operandType != -1) {
               if (operand[0] == '#') {
-                operand = strtok(operand, "#");
+                operand = first_token(operand, "#");
               }
 
               if (is_operand_type_valid(ast, operandIndex)) {
                 ast->ASTOpt.Inst.InstOperands[operandIndex].OperandType =
                     operandType;
-                choose_operand_option(ast, operandIndex, operandType, operand,
-                                      line_number, input_file_name);
+                choose_operand_option(ast, operandIndex, operandType, operand);
               } else {
-                write_error_message(ast, ERROR_INVALID_OPERAND_TYPE,
-                                    OPERAND(operandIndex), operand,
-                                    tokens->tokens[tokenIndex - 1], line_number,
-                                    input_file_name);
+                set_diagnostic(&ast->error, DIAG_INVALID_OPERAND_TYPE,
+                               line_number, token_column(tokens, tokenIndex),
+                               OPERAND(operandIndex), operand,
+                               tokens->tokens[tokenIndex - 1]);
 
                 ast->ASTType = ERROR;
                 return ast;
               }
             } else {
-              write_error_message(ast, ERROR_INVALID_OPERAND, tokens->tokens[0],
-                                  operand, line_number, input_file_name);
+              set_diagnostic(&ast->error, DIAG_INVALID_OPERAND, line_number,
+                             token_column(tokens, tokenIndex),
+                             tokens->tokens[0], operand);
 
               ast->ASTType = ERROR;
               return ast;
@@ -429,18 +618,18 @@ AST *parse_tokens(Tokens *tokens, int line_number,
           }
         } else {
           if (tokens->count > 1) {
-            write_error_message(ast, ERROR_UNEXPECTED_INSTRUCTION_OPERANDS,
-                                tokens->tokens[tokenIndex], line_number,
-                                input_file_name);
+            set_diagnostic(&ast->error, DIAG_UNEXPECTED_INSTRUCTION_OPERANDS,
+                           line_number, token_column(tokens, tokenIndex),
+                           tokens->tokens[tokenIndex]);
 
             ast->ASTType = ERROR;
             return ast;
           }
         }
       } else {
-        write_error_message(ast, ERROR_INVALID_INSTRUCTION,
-                            tokens->tokens[tokenIndex], line_number,
-                            input_file_name);
+        set_diagnostic(&ast->error, DIAG_INVALID_INSTRUCTION, line_number,
+                       token_column(tokens, tokenIndex),
+                       tokens->tokens[tokenIndex]);
 
         ast->ASTType = ERROR;
         return ast;
@@ -450,52 +639,82 @@ AST *parse_tokens(Tokens *tokens, int line_number,
   return ast;
 }
 
-void write_error_message(AST *ast, const char *message, ...) {
-  va_list args;
-  va_start(args, message);
+AST *parse_tokens(Tokens *tokens, int line_number) {
+  char *define_name = NULL;
+  AST *ast = parse_line(tokens, line_number, &define_name);
 
-  if (ast->syntax_error != NULL) {
-    free(ast->syntax_error);
-    ast->syntax_error = NULL;
+  /* The expressions of numbers only are folded right away */
+  if (ast != NULL && ast->ASTType != ERROR && ast->expressions_count > 0 &&
+      !fold_expressions(ast, NULL, NULL, &ast->error, line_number)) {
+    if (ast->ASTType == DIRECTIVE && ast->ASTOpt.Dir.DirOpt == DATA) {
+      free_data_elements(ast);
+    }
+
+    ast->ASTType = ERROR;
   }
 
-  ast->syntax_error = (char *)malloc(MAX_ERROR_LENGTH * sizeof(char));
+  if (ast == NULL || ast->ASTType != DEFINE) {
+    free(define_name);
+  }
 
-  if (ast->syntax_error == NULL) {
-    fprintf(stderr, ERROR_OUT_OF_MEMORY);
-    va_end(args);
-    exit(EXIT_FAILURE);
-    return;
+  return ast;
+}
+
+bool fold_expressions(AST *ast, ConstantResolver resolve, void *context,
+                      Diagnostic *error, int line_number) {
+  char name[MAX_LABEL_LENGTH];
+  bool is_folded = true;
+  int kept = 0;
+  int i;
+
+  for (i = 0; i < ast->expressions_count; i++) {
+    ConstantExpression *expression = &ast->expressions[i];
+    ExpressionStatus status = evaluate_expression(
+        expression->text, resolve, context, expression->value, name);
+
+    if (status == EXPRESSION_UNRESOLVED && resolve == NULL) {
+      ast->expressions[kept++] = *expression;
+      continue;
+    }
+
+    if (status == EXPRESSION_UNRESOLVED && is_folded) {
+      set_diagnostic(error, DIAG_UNDEFINED_CONSTANT, line_number, 0, name,
+                     expression->text);
+    } else if (status == EXPRESSION_DIVISION_BY_ZERO && is_folded) {
+      set_diagnostic(error, DIAG_DIVISION_BY_ZERO, line_number, 0,
+                     expression->text);
+    } else if (status == EXPRESSION_OUT_OF_RANGE && is_folded) {
+      set_diagnostic(error, DIAG_EXPRESSION_OUT_OF_RANGE, line_number, 0,
+                     expression->text, (int)MAX_EXPRESSION_VALUE);
+    }
+
+    is_folded = is_folded && status == EXPRESSION_FOLDED;
+    free(expression->text);
   }
 
-  vsprintf(ast->syntax_error, message, args);
-  va_end(args);
+  ast->expressions_count = kept;
+
+  return is_folded;
 }
 
 void free_ast(AST *ast) {
-  int i = 0;
+  int i;
 
   if (ast == NULL) {
     return;
   }
 
-  if (ast->syntax_error != NULL) {
-    if (strcmp(ast->syntax_error, "") != 0) {
-      free(ast->syntax_error);
-      ast->syntax_error = NULL;
-    }
+  for (i = 0; i < ast->expressions_count; i++) {
+    free(ast->expressions[i].text);
   }
 
+  free(ast->expressions);
+  ast->expressions = NULL;
+  ast->expressions_count = 0;
+
   if (ast->ASTType == DIRECTIVE) {
     if (ast->ASTOpt.Dir.DirOpt == DATA) {
-      for (i = 0; i < ast->ASTOpt.Dir.ParamsOpt.Data.count; i++) {
-        free(ast->ASTOpt.Dir.ParamsOpt.Data.elements[i]);
-        ast->ASTOpt.Dir.ParamsOpt.Data.elements[i] = NULL;
-      }
-
-      ast->ASTOpt.Dir.ParamsOpt.Data.count = 0;
-      free(ast->ASTOpt.Dir.ParamsOpt.Data.elements);
-      ast->ASTOpt.Dir.ParamsOpt.Data.elements = NULL;
+      free_data_elements(ast);
     } else if (ast->ASTOpt.Dir.DirOpt == STRING) {
       free(ast->ASTOpt.Dir.ParamsOpt.string);
       ast->ASTOpt.Dir.ParamsOpt.string = NULL;
@@ -515,35 +734,35 @@ void free_ast(AST *ast) {
   ast = NULL;
 }
 
-bool is_label_valid(AST *ast, char *label, int line_number,
-                    const char *input_file_name) {
+bool is_label_valid(Diagnostic *diagnostic, char *label, int line_number,
+                    int column) {
   int i;
 
   if (strlen(label) > MAX_LABEL_LENGTH) {
-    write_error_message(ast, ERROR_LABEL_NAME_TOO_LONG, label, MAX_LABEL_LENGTH,
-                        line_number, input_file_name);
+    set_diagnostic(diagnostic, DIAG_LABEL_NAME_TOO_LONG, line_number, column,
+                   label, MAX_LABEL_LENGTH);
     return false;
   }
 
   for (i = 0; i < KEYWORDS_COUNT; i++) {
     if (strcmp(label, keywords[i]) == 0) {
-      write_error_message(ast, ERROR_LABEL_NAME_IS_KEYWORD, keywords[i],
-                          line_number, input_file_name);
+      set_diagnostic(diagnostic, DIAG_LABEL_NAME_IS_KEYWORD, line_number,
+                     column, keywords[i]);
       return false;
     }
   }
 
   if (label) {
     if (!isalpha(label[0])) {
-      write_error_message(ast, ERROR_LABEL_CANNOT_START_WITH_NUM, line_number,
-                          input_file_name);
+      set_diagnostic(diagnostic, DIAG_LABEL_CANNOT_START_WITH_NUM, line_number,
+                     column);
       return false;
     }
 
     for (i = 1; i < strlen(label); i++) {
       if (!isalnum(label[i])) {
-        write_error_message(ast, ERROR_LABEL_NAME_NOT_LETTER_OR_NUM,
-                            line_number, input_file_name);
+        set_diagnostic(diagnostic, DIAG_LABEL_NAME_NOT_LETTER_OR_NUM,
+                       line_number, column + i);
         return false;
       }
     }
@@ -612,6 +831,11 @@ bool is_number_valid(char *str) {
   return true;
 }
 
+int get_data_size(AST *ast) {
+  return ast->ASTOpt.Dir.ParamsOpt.Data.count *
+         ast->ASTOpt.Dir.ParamsOpt.Data.repeat;
+}
+
 bool is_has_operand(AST *ast) {
   return get_operands_count(ast) > 0 ? true : false;
 }
@@ -642,8 +866,7 @@ int get_operands_count(AST *ast) {
   return -1;
 }
 
-int identify_operand(char *operand, int index, AST *ast, int line_number,
-                     const char *input_file_name) {
+int identify_operand(char *operand, int index, AST *ast) {
   char *ptr = NULL;
   char *operand_copy = strdup(operand);
 
@@ -657,8 +880,10 @@ int identify_operand(char *operand, int index, AST *ast, int line_number,
     return -1;
 
   /* Starts with a digit = fail */
-  if (isdigit(operand_copy[0]))
+  if (isdigit(operand_copy[0])) {
+    free(operand_copy);
     return -1;
+  }
 
   if (IS_REGISTER(operand_copy)) {
     ast->ASTOpt.Inst.InstOperands[index].OperandType = REGISTER;
@@ -678,6 +903,7 @@ int identify_operand(char *operand, int index, AST *ast, int line_number,
       } else {
         ast->ASTOpt.Inst.InstOperands[index].OperandType = DIRECT;
 
+        free(operand_copy);
         return DIRECT;
       }
     }
@@ -686,9 +912,10 @@ int identify_operand(char *operand, int index, AST *ast, int line_number,
   ptr = operand_copy + 1;
   /* '#' + number = immediate */
   if (operand_copy[0] == '#' &&
-      (is_number_valid(ptr) ||
-       is_label_valid(ast, ptr, line_number, input_file_name))) {
+      (is_number_valid(ptr) || is_label_valid(NULL, ptr, 0, 0) ||
+       is_expression(ptr))) {
     ast->ASTOpt.Inst.InstOperands[index].OperandType = IMMEDIATE;
+    free(operand_copy);
     return IMMEDIATE;
   }
 
@@ -700,6 +927,7 @@ int identify_operand(char *operand, int index, AST *ast, int line_number,
         ptr++;
       } else if (*(ptr++) == '[' && *(ptr += strlen(ptr) - 1) == ']') {
         ast->ASTOpt.Inst.InstOperands[index].OperandType = INDEXED;
+        free(operand_copy);
         return INDEXED;
       } else {
         break;
@@ -708,12 +936,12 @@ int identify_operand(char *operand, int index, AST *ast, int line_number,
   }
 
   /* Default = fail */
+  free(operand_copy);
   return -1;
 }
 
 void choose_operand_option(AST *ast, int index, int operand_type,
-                           char *operand_value, int line_number,
-                           const char *input_file_name) {
+                           char *operand_value) {
   char *ptr = NULL;
   char *open_bracket_ptr = NULL;
   char *operand_value_copy = NULL;
@@ -726,19 +954,24 @@ void choose_operand_option(AST *ast, int index, int operand_type,
           .OperandOpt.Immediate.ImmediateOpt.number = atoi(operand_value);
       ast->ASTOpt.Inst.InstOperands[index].OperandOpt.Immediate.ImmediateType =
           IMNUMBER;
-    } else if (is_label_valid(ast, operand_value, line_number,
-                              input_file_name)) {
+    } else if (is_label_valid(NULL, operand_value, 0, 0)) {
       strcpy(ast->ASTOpt.Inst.InstOperands[index]
                  .OperandOpt.Immediate.ImmediateOpt.label,
              operand_value);
       ast->ASTOpt.Inst.InstOperands[index].OperandOpt.Immediate.ImmediateType =
           IMLABEL;
+    } else {
+      add_expression(ast, strdup(operand_value),
+                     &ast->ASTOpt.Inst.InstOperands[index]
+                          .OperandOpt.Immediate.ImmediateOpt.number);
+      ast->ASTOpt.Inst.InstOperands[index].OperandOpt.Immediate.ImmediateType =
+          IMNUMBER;
     }
 
     break;
   case DIRECT:
     strcpy(ast->ASTOpt.Inst.InstOperands[index].OperandOpt.label,
-           strtok(operand_value, ","));
+           first_token(operand_value, ","));
     break;
   case INDEXED:
     operand_value_copy = strdup(operand_value);
@@ -750,11 +983,19 @@ void choose_operand_option(AST *ast, int index, int operand_type,
 
     strcpy(ast->ASTOpt.Inst.InstOperands[index].OperandOpt.Index.label,
            operand_value_copy);
+    free(operand_value_copy);
 
     operand_value_copy = strdup(operand_value);
     open_bracket_ptr = strchr(operand_value_copy, '[');
+    operand_value_copy[strlen(operand_value_copy) - 1] = '\0';
 
-    if ((sscanf(open_bracket_ptr, "[%d]", &number) == 1)) {
+    if (is_expression(open_bracket_ptr + 1)) {
+      add_expression(ast, strdup(open_bracket_ptr + 1),
+                     &ast->ASTOpt.Inst.InstOperands[index]
+                          .OperandOpt.Index.IndexOpt.number);
+      ast->ASTOpt.Inst.InstOperands[index].OperandOpt.Index.IndexType =
+          INNUMBER;
+    } else if ((sscanf(open_bracket_ptr, "[%d", &number) == 1)) {
       ast->ASTOpt.Inst.InstOperands[index].OperandOpt.Index.IndexOpt.number =
           number;
       ast->ASTOpt.Inst.InstOperands[index].OperandOpt.Index.IndexType =
@@ -763,18 +1004,19 @@ void choose_operand_option(AST *ast, int index, int operand_type,
       strcpy(
           ast->ASTOpt.Inst.InstOperands[index].OperandOpt.Index.IndexOpt.label,
           (open_bracket_ptr + 1));
-      strtok(
+      first_token(
           ast->ASTOpt.Inst.InstOperands[index].OperandOpt.Index.IndexOpt.label,
           "]");
       ast->ASTOpt.Inst.InstOperands[index].OperandOpt.Index.IndexType = INLABEL;
     }
 
+    free(operand_value_copy);
     operand_value_copy = NULL;
     open_bracket_ptr = NULL;
     break;
   case REGISTER:
     ptr = operand_value + 1;
-    ptr = strtok(ptr, ",");
+    ptr = first_token(ptr, ",");
     ast->ASTOpt.Inst.InstOperands[index].OperandOpt.reg = atoi(ptr);
     break;
   default:
@@ -8,6 +8,8 @@
  */
 
 #include "consts.h"
+#include "diagnostics.h"
+#include "expression.h"
 #include "lexer.h"
 
 /**
@@ -15,18 +17,24 @@
  * It represents the parsed line of the assembly code and its type. It can be an
  * instruction, directive, comment, define, empty line or syntax error. It also
  * contains the label name, if it exists. The label name is used to reference
- * the line in the code. The AST structure contains a union of the different
- * types of lines that can be parsed.
+ * the line in the code. A line that fails to parse records why in 'error', and
+ * a line that parses with a remark records it in 'warning'. The AST structure
+ * contains a union of the different types of lines that can be parsed.
  * INST: Represents an instruction line. It contains the instruction type and
  * its operands. DIR: Represents a directive line. It contains the directive
  * type and its operands. COMM: Represents a comment line. It contains the
  * comment string. DEFINE: Represents a define line. It contains the define name
  * and its value. EMPTY: Represents an empty line. ERROR: Represents a syntax
- * error. It contains the syntax error string.
+ * error. It contains the syntax error string. The constant expressions naming
+ * defines are listed in 'expressions' until they are folded into the numbers
+ * they are the value of.
  */
 typedef struct AST {
-  char *syntax_error;
+  Diagnostic error;
+  Diagnostic warning;
   char label_name[MAX_LABEL_LENGTH];
+  ConstantExpression *expressions;
+  int expressions_count;
 
   enum { INSTRUCTION, DIRECTIVE, COMMENT, DEFINE, ERROR, EMPTY } ASTType;
 
@@ -97,9 +105,13 @@ typedef struct AST {
       enum { DATA, STRING, ENTRY, EXTERN } DirOpt;
 
       union {
+        /* .data, and .fill and .space which repeat a single element */
         struct {
-          char **elements;
+          int *values;  /* The elements, 0 for the names until resolved */
+          char **names; /* The names of the elements, NULL for the numbers,
+                           or NULL when all are numbers */
           int count;
+          int repeat; /* The times the elements are repeated, 1 for .data */
         } Data;
 
         char *string;
@@ -123,10 +135,26 @@ typedef struct AST {
  *
  * @param tokens The tokens to parse.
  * @param line_number The line number for error reporting.
- * @param input_file_name The name of the input file for error reporting.
  * @return A pointer to the AST.
  */
-AST *parse_tokens(Tokens *tokens, int line_number, const char *input_file_name);
+AST *parse_tokens(Tokens *tokens, int line_number);
+
+/**
+ * @brief Folds the constant expressions of an AST into its numbers.
+ *
+ * The expressions folded are removed from the AST. Without a resolver the
+ * expressions naming a define are kept, to be folded once the defines are
+ * known, and only a division by zero is an error.
+ *
+ * @param ast The AST to fold.
+ * @param resolve The resolver of the names of the expressions, or NULL.
+ * @param context The context passed to the resolver.
+ * @param error Where to record the first expression that cannot be folded.
+ * @param line_number The line number for error reporting.
+ * @return true if no expression failed to fold, false otherwise.
+ */
+bool fold_expressions(AST *ast, ConstantResolver resolve, void *context,
+                      Diagnostic *error, int line_number);
 
 /**
  * @brief Frees the memory allocated for an AST.
@@ -161,6 +189,14 @@ void parse_instruction(char *inst, AST *ast);
  */
 int get_operands_count(AST *ast);
 
+/**
+ * @brief Gets the number of words of a data directive.
+ *
+ * @param ast The AST of the directive.
+ * @return The number of words, its elements times their repeat count.
+ */
+int get_data_size(AST *ast);
+
 /**
  * @brief Checks if an AST has an operand.
  *
@@ -185,12 +221,9 @@ bool is_operand_type_valid(AST *ast, int index);
  * @param index The index of the operand to modify.
  * @param operand_type The type of the operand.
  * @param operand_value The value of the operand.
- * @param line_number The line number for error reporting.
- * @param input_file_name The name of the input file for error reporting.
  */
 void choose_operand_option(AST *ast, int index, int operand_type,
-                           char *operand_value, int line_number,
-                           const char *input_file_name);
+                           char *operand_value);
 
 /**
  * @brief Identifies an operand in an AST.
@@ -198,24 +231,22 @@ void choose_operand_option(AST *ast, int index, int operand_type,
  * @param operand The operand to identify.
  * @param index The index of the operand.
  * @param ast The AST to modify.
- * @param line_number The line number for error reporting.
- * @param input_file_name The name of the input file for error reporting.
  * @return The type of the operand.
  */
-int identify_operand(char *operand, int index, AST *ast, int line_number,
-                     const char *input_file_name);
+int identify_operand(char *operand, int index, AST *ast);
 
 /**
- * @brief Checks if a label in an AST is valid.
+ * @brief Checks if a label is valid.
  *
- * @param ast The AST to check.
+ * @param diagnostic Where to record why the label is invalid, or NULL when the
+ * check is only a probe and the reason is not needed.
  * @param label The label to check.
  * @param line_number The line number for error reporting.
- * @param input_file_name The name of the input file for error reporting.
+ * @param column The column of the label for error reporting.
  * @return true if the label is valid, false otherwise.
  */
-bool is_label_valid(AST *ast, char *label, int line_number,
-                    const char *input_file_name);
+bool is_label_valid(Diagnostic *diagnostic, char *label, int line_number,
+                    int column);
 
 /**
  * @brief Check if a string is a digit
@@ -228,13 +259,4 @@ bool is_label_valid(AST *ast, char *label, int line_number,
  */
 bool is_number_valid(char *str);
 
-/**
- * @brief Writes an error message.
- *
- * @param ast The AST for context.
- * @param message The error message.
- * @param ... Variable arguments for the error message.
- */
-void write_error_message(AST *ast, const char *message, ...);
-
 #endif
\ No newline at end of file
@@ -0,0 +1,655 @@
+#include "peephole.h"
+#include "assembler.h"
+#include "errors.h"
+#include "lexer.h"
+#include "source.h"
+#include "symbol_index.h"
+#include "symbol_table.h"
+
+/* The reason each rule gives for the lines it removes */
+static const char *const reasons[] = {
+    "a move of a register to itself",
+    "a comparison replaced by the next one",
+    "a jump to the next line",
+    "an increment and a decrement cancelling out",
+    "code that no entry or instruction reaches",
+    "data that no entry or reached instruction names"};
+
+/**
+ * @struct PeepholeWindow
+ * @brief The parsed lines of a source and the names they declare.
+ */
+typedef struct {
+  AST **nodes;       /**< The AST of every line. */
+  bool *is_removed;  /**< Whether every line was removed. */
+  bool *is_pinned;   /**< Whether every line declares a name declared again,
+                        which keeps it. */
+  bool *is_reached;  /**< Whether every line is reached, when stripping. */
+  int *owners;       /**< The labeled line starting the data block of every
+                        data line, -1 for a data line without one. */
+  int *pending;      /**< The reached lines still to follow. */
+  int pending_count; /**< The number of reached lines still to follow. */
+  int count;         /**< The number of lines. */
+  Symbol *declared;  /**< The names declared by the lines, a label having the
+                        index of its line as value. */
+  SymbolIndex index; /**< The index of the declared names. */
+  Symbol *context;   /**< The names declared by the files before. */
+} PeepholeWindow;
+
+void init_peephole_report(PeepholeReport *report) {
+  report->changes = NULL;
+  report->count = 0;
+  report->capacity = 0;
+  report->words_saved = 0;
+}
+
+void free_peephole_report(PeepholeReport *report) {
+  free(report->changes);
+  init_peephole_report(report);
+}
+
+/* Whether a name is declared, as a define or as a label */
+static bool is_declared(const PeepholeWindow *window, char *name,
+                        bool is_define) {
+  Symbol *symbol = index_lookup(&window->index, name);
+
+  if (symbol == NULL) {
+    symbol = lookup(name, window->context);
+  }
+
+  return symbol && (symbol->attribute == MDEFINE) == is_define;
+}
+
+/* Whether the names of an operand are declared, so it encodes without error */
+static bool is_operand_resolved(const PeepholeWindow *window, AST *node,
+                                int operand) {
+  switch (node->ASTOpt.Inst.InstOperands[operand].OperandType) {
+  case IMMEDIATE:
+    return node->ASTOpt.Inst.InstOperands[operand]
+               .OperandOpt.Immediate.ImmediateType == IMNUMBER;
+
+  case DIRECT:
+    return is_declared(
+        window, node->ASTOpt.Inst.InstOperands[operand].OperandOpt.label,
+        false);
+
+  case INDEXED:
+    return is_declared(
+               window,
+               node->ASTOpt.Inst.InstOperands[operand].OperandOpt.Index.label,
+               false) &&
+           (node->ASTOpt.Inst.InstOperands[operand]
+                    .OperandOpt.Index.IndexType == INNUMBER ||
+            is_declared(window,
+                        node->ASTOpt.Inst.InstOperands[operand]
+                            .OperandOpt.Index.IndexOpt.label,
+                        true));
+
+  default:
+    return true;
+  }
+}
+
+/* The first operand an instruction uses, the destination being the last */
+static int first_operand(AST *node) { return 2 - get_operands_count(node); }
+
+/*
+ * Whether a line can be removed without changing the diagnostics: it encodes
+ * without a remark and no other line declares its label
+ */
+static bool is_clean(const PeepholeWindow *window, int line) {
+  AST *node = window->nodes[line];
+  int i = 0;
+
+  if (window->is_pinned[line] || node->expressions_count > 0 ||
+      node->warning.code != DIAG_NONE) {
+    return false;
+  }
+
+  if (node->ASTType == INSTRUCTION) {
+    for (i = first_operand(node); i < 2; i++) {
+      if (!is_operand_resolved(window, node, i)) {
+        return false;
+      }
+    }
+  } else if (node->ASTType == DIRECTIVE && node->ASTOpt.Dir.DirOpt == DATA &&
+             node->ASTOpt.Dir.ParamsOpt.Data.names) {
+    for (i = 0; i < node->ASTOpt.Dir.ParamsOpt.Data.count; i++) {
+      if (node->ASTOpt.Dir.ParamsOpt.Data.names[i] &&
+          !is_declared(window, node->ASTOpt.Dir.ParamsOpt.Data.names[i],
+                       true)) {
+        return false;
+      }
+    }
+  }
+
+  return true;
+}
+
+/* Whether the instruction of a line can be removed, nothing jumping to it */
+static bool is_removable(const PeepholeWindow *window, int line) {
+  AST *node = window->nodes[line];
+
+  return !window->is_removed[line] && node->ASTType == INSTRUCTION &&
+         node->label_name[0] == '\0' && is_clean(window, line);
+}
+
+static bool is_data(AST *node) {
+  return node->ASTType == DIRECTIVE && (node->ASTOpt.Dir.DirOpt == DATA ||
+                                        node->ASTOpt.Dir.DirOpt == STRING);
+}
+
+/* The next line that encodes words, or -1 if there is none */
+static int next_encoded_line(const PeepholeWindow *window, int line) {
+  for (line++; line < window->count; line++) {
+    if (!window->is_removed[line] &&
+        (window->nodes[line]->ASTType == INSTRUCTION ||
+         is_data(window->nodes[line]))) {
+      return line;
+    }
+  }
+
+  return -1;
+}
+
+static bool is_instruction(const PeepholeWindow *window, int line, int type) {
+  return line >= 0 && window->nodes[line]->ASTType == INSTRUCTION &&
+         (int)window->nodes[line]->ASTOpt.Inst.InstType == type;
+}
+
+/* Whether the destinations of two instructions are the same operand */
+static bool is_same_destination(AST *first, AST *second) {
+  if (first->ASTOpt.Inst.InstOperands[1].OperandType !=
+      second->ASTOpt.Inst.InstOperands[1].OperandType) {
+    return false;
+  }
+
+  switch (first->ASTOpt.Inst.InstOperands[1].OperandType) {
+  case REGISTER:
+    return first->ASTOpt.Inst.InstOperands[1].OperandOpt.reg ==
+           second->ASTOpt.Inst.InstOperands[1].OperandOpt.reg;
+
+  case DIRECT:
+    return strcmp(first->ASTOpt.Inst.InstOperands[1].OperandOpt.label,
+                  second->ASTOpt.Inst.InstOperands[1].OperandOpt.label) == 0;
+
+  case INDEXED:
+    if (strcmp(first->ASTOpt.Inst.InstOperands[1].OperandOpt.Index.label,
+               second->ASTOpt.Inst.InstOperands[1].OperandOpt.Index.label) !=
+            0 ||
+        first->ASTOpt.Inst.InstOperands[1].OperandOpt.Index.IndexType !=
+            second->ASTOpt.Inst.InstOperands[1].OperandOpt.Index.IndexType) {
+      return false;
+    }
+
+    if (first->ASTOpt.Inst.InstOperands[1].OperandOpt.Index.IndexType ==
+        INNUMBER) {
+      return first->ASTOpt.Inst.InstOperands[1]
+                 .OperandOpt.Index.IndexOpt.number ==
+             second->ASTOpt.Inst.InstOperands[1]
+                 .OperandOpt.Index.IndexOpt.number;
+    }
+
+    return strcmp(
+               first->ASTOpt.Inst.InstOperands[1].OperandOpt.Index.IndexOpt.label,
+               second->ASTOpt.Inst.InstOperands[1]
+                   .OperandOpt.Index.IndexOpt.label) == 0;
+
+  default:
+    return false;
+  }
+}
+
+static void add_change(PeepholeReport *report, const SourceFile *source,
+                       PeepholeWindow *window, int line, PeepholeRule rule) {
+  PeepholeChange *change = NULL;
+  char text[MAX_LINE_LENGTH];
+  char *start = text;
+  size_t length = 0;
+
+  if (report->count == report->capacity) {
+    int capacity = report->capacity ? 2 * report->capacity : 8;
+    PeepholeChange *temp =
+        realloc(report->changes, capacity * sizeof(PeepholeChange));
+
+    if (temp == NULL) {
+      fprintf(stderr, ERROR_OUT_OF_MEMORY);
+      exit(EXIT_FAILURE);
+    }
+
+    report->changes = temp;
+    report->capacity = capacity;
+  }
+
+  read_source_line(source, line, text);
+
+  while (isspace((unsigned char)*start)) {
+    start++;
+  }
+
+  length = strlen(start);
+
+  while (length > 0 && isspace((unsigned char)start[length - 1])) {
+    length--;
+  }
+
+  start[length] = '\0';
+
+  change = &report->changes[report->count++];
+  change->line = line + 1;
+  change->rule = rule;
+  strcpy(change->text, start);
+
+  if (window->nodes[line]->ASTType == INSTRUCTION) {
+    change->words = get_tokens_count(&window->nodes[line]);
+  } else if (window->nodes[line]->ASTOpt.Dir.DirOpt == DATA) {
+    change->words = get_data_size(window->nodes[line]);
+  } else {
+    change->words =
+        strlen(window->nodes[line]->ASTOpt.Dir.ParamsOpt.string) + 1;
+  }
+
+  report->words_saved += change->words;
+  window->is_removed[line] = true;
+}
+
+/* Applies the rules to the instruction of a line */
+static bool apply_rules(const SourceFile *source, PeepholeWindow *window,
+                        int line, PeepholeReport *report) {
+  AST *node = window->nodes[line];
+  int next = 0;
+
+  if (!is_removable(window, line)) {
+    return false;
+  }
+
+  next = next_encoded_line(window, line);
+
+  switch (node->ASTOpt.Inst.InstType) {
+  case MOV:
+    if (node->ASTOpt.Inst.InstOperands[0].OperandType == REGISTER &&
+        node->ASTOpt.Inst.InstOperands[1].OperandType == REGISTER &&
+        node->ASTOpt.Inst.InstOperands[0].OperandOpt.reg ==
+            node->ASTOpt.Inst.InstOperands[1].OperandOpt.reg) {
+      add_change(report, source, window, line, PEEPHOLE_SELF_MOVE);
+      return true;
+    }
+
+    break;
+
+  case CMP:
+    /* Only the flags of the last comparison reach the next branch */
+    if (is_instruction(window, next, CMP)) {
+      add_change(report, source, window, line, PEEPHOLE_DEAD_COMPARE);
+      return true;
+    }
+
+    break;
+
+  case JMP:
+    if (next >= 0 && window->nodes[next]->ASTType == INSTRUCTION &&
+        node->ASTOpt.Inst.InstOperands[1].OperandType == DIRECT &&
+        strcmp(node->ASTOpt.Inst.InstOperands[1].OperandOpt.label,
+               window->nodes[next]->label_name) == 0) {
+      add_change(report, source, window, line, PEEPHOLE_JUMP_TO_NEXT);
+      return true;
+    }
+
+    break;
+
+  case INC:
+  case DEC:
+    if (is_instruction(window, next,
+                       node->ASTOpt.Inst.InstType == INC ? DEC : INC) &&
+        is_removable(window, next) &&
+        is_same_destination(node, window->nodes[next])) {
+      add_change(report, source, window, line, PEEPHOLE_CANCELLING_STEP);
+      add_change(report, source, window, next, PEEPHOLE_CANCELLING_STEP);
+      return true;
+    }
+
+    break;
+
+  default:
+    break;
+  }
+
+  return false;
+}
+
+static void reach_line(PeepholeWindow *window, int line) {
+  if (line >= 0 && !window->is_reached[line]) {
+    window->is_reached[line] = true;
+    window->pending[window->pending_count++] = line;
+  }
+}
+
+/* Reaches the line of a label of the source */
+static void reach_label(PeepholeWindow *window, const char *name) {
+  Symbol *symbol = index_lookup(&window->index, name);
+
+  if (symbol && (symbol->attribute == CODE || symbol->attribute == MDATA)) {
+    reach_line(window, symbol->value);
+  }
+}
+
+/* Reaches the lines an instruction names and the ones it can run next */
+static void follow_instruction(PeepholeWindow *window, int line) {
+  AST *node = window->nodes[line];
+  int type = node->ASTOpt.Inst.InstType;
+  int next = 0;
+  int i = 0;
+
+  for (i = first_operand(node); i < 2; i++) {
+    if (node->ASTOpt.Inst.InstOperands[i].OperandType == DIRECT) {
+      reach_label(window, node->ASTOpt.Inst.InstOperands[i].OperandOpt.label);
+    } else if (node->ASTOpt.Inst.InstOperands[i].OperandType == INDEXED) {
+      reach_label(window,
+                  node->ASTOpt.Inst.InstOperands[i].OperandOpt.Index.label);
+    }
+  }
+
+  /* A jump to an address held in a register can reach any instruction */
+  if ((type == JMP || type == BNE || type == JSR) &&
+      node->ASTOpt.Inst.InstOperands[1].OperandType != DIRECT) {
+    for (i = 0; i < window->count; i++) {
+      if (!window->is_removed[i] && window->nodes[i]->ASTType == INSTRUCTION) {
+        reach_line(window, i);
+      }
+    }
+  }
+
+  if (type == JMP || type == RTS || type == HLT) {
+    return;
+  }
+
+  /* The data placed between two instructions runs as code */
+  next = next_encoded_line(window, line);
+
+  while (next >= 0 && is_data(window->nodes[next])) {
+    reach_line(window, next);
+    next = next_encoded_line(window, next);
+  }
+
+  reach_line(window, next);
+}
+
+/* Reaches the whole data block of a data line */
+static void follow_data(PeepholeWindow *window, int line) {
+  int next = 0;
+
+  if (window->owners[line] != line) {
+    reach_line(window, window->owners[line]);
+    return;
+  }
+
+  for (next = next_encoded_line(window, line);
+       next >= 0 && window->owners[next] == line;
+       next = next_encoded_line(window, next)) {
+    reach_line(window, next);
+  }
+}
+
+/* Groups the data lines in blocks, each starting at a labeled data line */
+static void find_owners(PeepholeWindow *window) {
+  int owner = -1;
+  int i = 0;
+
+  for (i = 0; i < window->count; i++) {
+    AST *node = window->nodes[i];
+
+    if (window->is_removed[i]) {
+      continue;
+    }
+
+    if (node->ASTType == INSTRUCTION) {
+      owner = -1;
+    } else if (is_data(node)) {
+      if (node->label_name[0] != '\0') {
+        owner = i;
+      }
+
+      window->owners[i] = owner;
+    }
+  }
+}
+
+/*
+ * Removes the lines not reached from the roots: the first instruction, the
+ * labels of the .entry directives, and the lines that cannot be removed
+ */
+static bool strip_unreached(const SourceFile *source, PeepholeWindow *window,
+                            PeepholeReport *report) {
+  bool is_changed = false;
+  bool is_first = true;
+  int i = 0;
+
+  memset(window->is_reached, 0, window->count * sizeof(bool));
+  window->pending_count = 0;
+  find_owners(window);
+
+  for (i = 0; i < window->count; i++) {
+    AST *node = window->nodes[i];
+
+    if (window->is_removed[i]) {
+      continue;
+    }
+
+    if (node->ASTType == INSTRUCTION) {
+      if (is_first || !is_clean(window, i)) {
+        reach_line(window, i);
+      }
+
+      is_first = false;
+    } else if (is_data(node)) {
+      /* A data line without a label before it cannot be named */
+      if (window->owners[i] < 0 || !is_clean(window, i)) {
+        reach_line(window, i);
+      }
+    } else if (node->ASTType == DIRECTIVE && node->ASTOpt.Dir.DirOpt == ENTRY) {
+      reach_label(window, node->ASTOpt.Dir.ParamsOpt.label);
+    }
+  }
+
+  while (window->pending_count > 0) {
+    int line = window->pending[--window->pending_count];
+
+    if (window->nodes[line]->ASTType == INSTRUCTION) {
+      follow_instruction(window, line);
+    } else {
+      follow_data(window, line);
+    }
+  }
+
+  for (i = 0; i < window->count; i++) {
+    AST *node = window->nodes[i];
+
+    if (window->is_removed[i] || window->is_reached[i]) {
+      continue;
+    }
+
+    if (node->ASTType == INSTRUCTION) {
+      add_change(report, source, window, i, PEEPHOLE_UNREACHABLE_CODE);
+      is_changed = true;
+    } else if (is_data(node)) {
+      add_change(report, source, window, i, PEEPHOLE_UNREFERENCED_DATA);
+      is_changed = true;
+    }
+  }
+
+  return is_changed;
+}
+
+/* Parses the lines and indexes the names they declare */
+static bool open_window(const SourceFile *source, Symbol *table,
+                        PeepholeWindow *window) {
+  char line[MAX_LINE_LENGTH];
+  bool is_valid = true;
+  int i = 0;
+
+  window->count = source->lines_count;
+  window->nodes = malloc((window->count + 1) * sizeof(AST *));
+  window->is_removed = calloc(window->count + 1, sizeof(bool));
+  window->is_pinned = calloc(window->count + 1, sizeof(bool));
+  window->is_reached = calloc(window->count + 1, sizeof(bool));
+  window->owners = malloc((window->count + 1) * sizeof(int));
+  window->pending = malloc((window->count + 1) * sizeof(int));
+  window->pending_count = 0;
+  window->declared = NULL;
+  window->context = table;
+
+  if (window->nodes == NULL || window->is_removed == NULL ||
+      window->is_pinned == NULL || window->is_reached == NULL ||
+      window->owners == NULL || window->pending == NULL) {
+    fprintf(stderr, ERROR_OUT_OF_MEMORY);
+    exit(EXIT_FAILURE);
+  }
+
+  init_symbol_index(&window->index, NULL);
+
+  for (i = 0; i < window->count; i++) {
+    Tokens *tokens = NULL;
+    AST *node = NULL;
+    char *name = NULL;
+    Attribute attribute = CODE;
+
+    read_source_line(source, i, line);
+    tokens = split_line_to_tokens(line);
+    node = parse_tokens(tokens, i + 1);
+    free_tokens(tokens);
+    window->nodes[i] = node;
+
+    if (node->ASTType == ERROR) {
+      is_valid = false;
+    } else if (node->ASTType == DEFINE) {
+      name = node->ASTOpt.Define.name;
+      attribute = MDEFINE;
+    } else if (node->ASTType == INSTRUCTION) {
+      name = node->label_name;
+    } else if (node->ASTType == DIRECTIVE) {
+      if (node->ASTOpt.Dir.DirOpt == EXTERN) {
+        name = node->ASTOpt.Dir.ParamsOpt.label;
+        attribute = EXTERNAL;
+      } else if (node->ASTOpt.Dir.DirOpt != ENTRY) {
+        name = node->label_name;
+        attribute = MDATA;
+      }
+    }
+
+    /* A name declared twice keeps the first declaration, and both lines are
+     * kept for the first pass to report it */
+    if (name && name[0] != '\0') {
+      Symbol *symbol = index_lookup(&window->index, name);
+
+      if (symbol) {
+        window->is_pinned[symbol->value] = true;
+        window->is_pinned[i] = true;
+      } else {
+        index_add_symbol(&window->index, name, attribute, i,
+                         &window->declared);
+        window->is_pinned[i] = lookup(name, table) != NULL;
+      }
+    }
+  }
+
+  return is_valid;
+}
+
+static void close_window(PeepholeWindow *window) {
+  int i = 0;
+
+  for (i = 0; i < window->count; i++) {
+    free_ast(window->nodes[i]);
+    free(window->nodes[i]);
+  }
+
+  free(window->nodes);
+  free(window->is_removed);
+  free(window->is_pinned);
+  free(window->is_reached);
+  free(window->owners);
+  free(window->pending);
+  free_symbol_index(&window->index);
+  free_table(window->declared);
+}
+
+static int compare_by_line(const void *a, const void *b) {
+  const PeepholeChange *first = (const PeepholeChange *)a;
+  const PeepholeChange *second = (const PeepholeChange *)b;
+
+  return first->line - second->line;
+}
+
+bool optimize_source(const SourceFile *source, Symbol *table,
+                     bool is_peephole, bool is_stripping,
+                     SourceFile *optimized, PeepholeReport *report) {
+  PeepholeWindow window;
+  bool is_changed = true;
+  int first = report->count;
+  int i = 0;
+
+  if (open_window(source, table, &window)) {
+    /* Removing an instruction can bring two others together, or leave the
+     * lines it named unreferenced */
+    while (is_changed) {
+      is_changed = is_stripping && strip_unreached(source, &window, report);
+
+      for (i = 0; is_peephole && i < window.count; i++) {
+        if (apply_rules(source, &window, i, report)) {
+          is_changed = true;
+        }
+      }
+    }
+  }
+
+  if (report->count > first) {
+    char *text = malloc(source->size + 1);
+
+    if (text == NULL) {
+      fprintf(stderr, ERROR_OUT_OF_MEMORY);
+      exit(EXIT_FAILURE);
+    }
+
+    memcpy(text, source->text, source->size);
+    text[source->size] = '\0';
+
+    /* Blanking the lines keeps the numbers of the lines after them */
+    for (i = 0; i < window.count; i++) {
+      if (window.is_removed[i]) {
+        long offset = source->line_starts[i];
+
+        for (; offset < source->line_starts[i + 1]; offset++) {
+          if (text[offset] != '\n') {
+            text[offset] = ' ';
+          }
+        }
+      }
+    }
+
+    init_source(optimized, text, source->size);
+    qsort(report->changes + first, report->count - first,
+          sizeof(PeepholeChange), compare_by_line);
+  }
+
+  close_window(&window);
+
+  return report->count > first;
+}
+
+void print_peephole_report(const PeepholeReport *report,
+                           const char *file_name, FILE *out) {
+  int i = 0;
+
+  if (report->count == 0) {
+    return;
+  }
+
+  for (i = 0; i < report->count; i++) {
+    fprintf(out, "Optimizer: removed '%s' on line '%d' in file '%s', %s.\n",
+            report->changes[i].text, report->changes[i].line, file_name,
+            reasons[report->changes[i].rule]);
+  }
+
+  fprintf(out, "Optimizer: %d lines removed, %d words saved in file '%s'.\n",
+          report->count, report->words_saved, file_name);
+}
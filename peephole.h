@@ -0,0 +1,113 @@
+#ifndef __PEEPHOLE__H__
+#define __PEEPHOLE__H__
+
+/**
+ * @file peephole.h
+ * @brief This file contains the definition of the optimizer, which removes
+ * redundant instructions and unused code and data from a source before it is
+ * assembled.
+ *
+ * The optimizer works on the parsed lines of the expanded source. A line is
+ * only removed when it is free of errors and warnings, every symbol it names
+ * is declared, and no other line declares its label, so that the assembly of
+ * the optimized source reports the same diagnostics as the one of the source.
+ * The removed lines are blanked rather than deleted, so the lines keep their
+ * numbers and the first pass recomputes the addresses of the labels after
+ * them.
+ *
+ * The peephole rules remove instructions without a label. Stripping removes
+ * the instructions and the data blocks not reached from the first
+ * instruction and the labels of the .entry directives. An instruction reaches
+ * the labels it names and the instruction after it, unless it is a jmp, rts
+ * or hlt, and a jump through a register reaches every instruction. A data
+ * block is a labeled .data or .string line with the unlabeled ones following
+ * it, and naming the label reaches the whole block. A label the files after
+ * the source name must therefore be exported with .entry.
+ */
+
+#include "source.h"
+#include "symbol_table.h"
+#include <stdio.h>
+
+/**
+ * @brief The reasons the optimizer removes a line for.
+ */
+typedef enum {
+  PEEPHOLE_SELF_MOVE,        /**< A mov of a register to itself. */
+  PEEPHOLE_DEAD_COMPARE,     /**< A cmp whose flags the next cmp replaces. */
+  PEEPHOLE_JUMP_TO_NEXT,     /**< A jmp to the label of the next line. */
+  PEEPHOLE_CANCELLING_STEP,  /**< An inc and a dec of the same operand in a
+                                row, in either order. */
+  PEEPHOLE_UNREACHABLE_CODE, /**< An instruction no root reaches. */
+  PEEPHOLE_UNREFERENCED_DATA /**< A data line no root reaches. */
+} PeepholeRule;
+
+/**
+ * @struct PeepholeChange
+ * @brief A line removed by the optimizer.
+ */
+typedef struct {
+  int line;                   /**< The number of the line. */
+  PeepholeRule rule;          /**< The reason the line was removed. */
+  int words;                  /**< The number of words it took. */
+  char text[MAX_LINE_LENGTH]; /**< The line as written. */
+} PeepholeChange;
+
+/**
+ * @struct PeepholeReport
+ * @brief The lines removed from a source, ordered by line.
+ */
+typedef struct {
+  PeepholeChange *changes; /**< The removed lines. */
+  int count;               /**< The number of removed lines. */
+  int capacity;            /**< The number of allocated changes. */
+  int words_saved;         /**< The words of the removed lines. */
+} PeepholeReport;
+
+/**
+ * @brief Initializes an empty report.
+ *
+ * @param report The report to initialize.
+ */
+void init_peephole_report(PeepholeReport *report);
+
+/**
+ * @brief Frees the memory allocated for a report.
+ *
+ * @param report The report to free.
+ */
+void free_peephole_report(PeepholeReport *report);
+
+/**
+ * @brief Removes the redundant instructions and the unused lines of a source.
+ *
+ * Both are removed again and again until none is left, since removing an
+ * instruction can bring two others together, or leave the lines it named
+ * unreferenced. Nothing is removed from a source with a line that does not
+ * parse.
+ *
+ * @param source The expanded source.
+ * @param table The symbols of the files assembled before, which the source
+ * can name.
+ * @param is_peephole Whether to remove the patterns of the peephole rules.
+ * @param is_stripping Whether to remove the lines not reached from the roots.
+ * @param optimized The source to initialize with the instructions removed,
+ * only when one was. It is freed with free_source().
+ * @param report The report to add the removed lines to.
+ * @return true if a line was removed, false otherwise.
+ */
+bool optimize_source(const SourceFile *source, Symbol *table,
+                     bool is_peephole, bool is_stripping,
+                     SourceFile *optimized, PeepholeReport *report);
+
+/**
+ * @brief Prints the removed lines and the words saved.
+ *
+ * @param report The report to print.
+ * @param file_name The name of the file reported in the messages.
+ * @param out The stream to write the messages to.
+ */
+void print_peephole_report(const PeepholeReport *report,
+                           const char *file_name, FILE *out);
+
+#endif
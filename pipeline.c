@@ -0,0 +1,239 @@
+#define _POSIX_C_SOURCE 200809L
+#include "pipeline.h"
+#include "errors.h"
+#include "utils.h"
+#include <pthread.h>
+#include <sched.h>
+#include <stdbool.h>
+#include <stdlib.h>
+#include <time.h>
+
+/*
+ * A waiting stage yields a few times, then sleeps for longer and longer, so
+ * that it does not take the processor from the stage it waits for.
+ */
+#define SPINS_BEFORE_SLEEP 16
+#define FIRST_SLEEP_NANOSECONDS 10000
+#define MAX_SLEEP_NANOSECONDS 1000000
+
+/**
+ * @struct Queue
+ * @brief A bounded queue with a single producer and a single consumer.
+ *
+ * Only the producer writes tail and only the consumer writes head. An item is
+ * stored before tail is released past it, and its slot is reused only after
+ * head is released past it, so no lock is needed.
+ */
+typedef struct {
+  void **items;           /**< The slots of the queue. */
+  unsigned long capacity; /**< The number of slots. */
+  unsigned long head;     /**< The number of items taken out. */
+  unsigned long tail;     /**< The number of items put in. */
+} Queue;
+
+/**
+ * @struct StageRunner
+ * @brief A stage running on its own thread.
+ */
+typedef struct {
+  const PipelineStage *stage; /**< The stage. */
+  StageStats *stats;          /**< The statistics of the stage. */
+  Queue *input;               /**< The queue from the previous stage. */
+  Queue *output;              /**< The queue to the next stage, or NULL. */
+  int count;                  /**< The number of items to handle. */
+} StageRunner;
+
+static bool queue_push(Queue *queue, void *item) {
+  unsigned long head = __atomic_load_n(&queue->head, __ATOMIC_ACQUIRE);
+
+  if (queue->tail - head == queue->capacity) {
+    return false;
+  }
+
+  queue->items[queue->tail % queue->capacity] = item;
+  __atomic_store_n(&queue->tail, queue->tail + 1, __ATOMIC_RELEASE);
+
+  return true;
+}
+
+static void *queue_pop(Queue *queue) {
+  unsigned long tail = __atomic_load_n(&queue->tail, __ATOMIC_ACQUIRE);
+  void *item = NULL;
+
+  if (queue->head == tail) {
+    return NULL;
+  }
+
+  item = queue->items[queue->head % queue->capacity];
+  __atomic_store_n(&queue->head, queue->head + 1, __ATOMIC_RELEASE);
+
+  return item;
+}
+
+/* Lets the other stages run while a stage waits on a queue */
+static void pause_stage(int *tries) {
+  struct timespec pause;
+  long sleep = FIRST_SLEEP_NANOSECONDS;
+  int i = 0;
+
+  if ((*tries)++ < SPINS_BEFORE_SLEEP) {
+    sched_yield();
+    return;
+  }
+
+  for (i = SPINS_BEFORE_SLEEP + 1; i < *tries && sleep < MAX_SLEEP_NANOSECONDS;
+       i++) {
+    sleep *= 2;
+  }
+
+  pause.tv_sec = 0;
+  pause.tv_nsec = sleep < MAX_SLEEP_NANOSECONDS ? sleep : MAX_SLEEP_NANOSECONDS;
+  nanosleep(&pause, NULL);
+}
+
+static void push_item(Queue *queue, void *item, StageStats *stats) {
+  double start = now_seconds();
+  int tries = 0;
+
+  while (!queue_push(queue, item)) {
+    pause_stage(&tries);
+  }
+
+  stats->blocked_seconds += now_seconds() - start;
+}
+
+static void run_item(const PipelineStage *stage, void *item,
+                     StageStats *stats) {
+  double start = now_seconds();
+
+  stage->run(item, stage->arg);
+  stats->busy_seconds += now_seconds() - start;
+}
+
+static void *run_stage(void *arg) {
+  StageRunner *runner = (StageRunner *)arg;
+  int i = 0;
+
+  for (i = 0; i < runner->count; i++) {
+    double start = now_seconds();
+    void *item = NULL;
+    int tries = 0;
+
+    while ((item = queue_pop(runner->input)) == NULL) {
+      pause_stage(&tries);
+    }
+
+    runner->stats->starved_seconds += now_seconds() - start;
+    run_item(runner->stage, item, runner->stats);
+
+    if (runner->output) {
+      push_item(runner->output, item, runner->stats);
+    }
+  }
+
+  return NULL;
+}
+
+double run_pipeline(const PipelineStage *stages, StageStats *stats,
+                    int stages_count, void *elements, size_t element_size,
+                    int count, int queue_capacity) {
+  double start = now_seconds();
+  StageRunner *runners = NULL;
+  pthread_t *threads = NULL;
+  Queue *queues = NULL;
+  int head_stages = 1;
+  int i = 0;
+  int j = 0;
+
+  if (queue_capacity < 1) {
+    queue_capacity = 1;
+  }
+
+  runners = (StageRunner *)calloc(stages_count, sizeof(StageRunner));
+  threads = (pthread_t *)calloc(stages_count, sizeof(pthread_t));
+  queues = (Queue *)calloc(stages_count, sizeof(Queue));
+
+  if (runners == NULL || threads == NULL || queues == NULL) {
+    fprintf(stderr, ERROR_OUT_OF_MEMORY);
+    exit(EXIT_FAILURE);
+  }
+
+  for (i = 0; i < stages_count; i++) {
+    stats[i].busy_seconds = 0;
+    stats[i].starved_seconds = 0;
+    stats[i].blocked_seconds = 0;
+    queues[i].capacity = queue_capacity;
+    queues[i].items = (void **)malloc(queue_capacity * sizeof(void *));
+
+    if (queues[i].items == NULL) {
+      fprintf(stderr, ERROR_OUT_OF_MEMORY);
+      exit(EXIT_FAILURE);
+    }
+  }
+
+  /* Queue i takes the items from stage i to stage i + 1 */
+  for (i = stages_count - 1; i > 0; i--) {
+    runners[i].stage = &stages[i];
+    runners[i].stats = &stats[i];
+    runners[i].input = &queues[i - 1];
+    runners[i].output = i + 1 < stages_count ? &queues[i] : NULL;
+    runners[i].count = count;
+
+    if (pthread_create(&threads[i], NULL, run_stage, &runners[i]) != 0) {
+      head_stages = i + 1;
+      break;
+    }
+  }
+
+  /* The stages without a thread run on this one, feeding the first thread */
+  for (i = 0; i < count; i++) {
+    void *item = (char *)elements + i * element_size;
+
+    for (j = 0; j < head_stages; j++) {
+      run_item(&stages[j], item, &stats[j]);
+    }
+
+    if (head_stages < stages_count) {
+      push_item(&queues[head_stages - 1], item, &stats[head_stages - 1]);
+    }
+  }
+
+  for (i = head_stages; i < stages_count; i++) {
+    pthread_join(threads[i], NULL);
+  }
+
+  for (i = 0; i < stages_count; i++) {
+    free(queues[i].items);
+  }
+
+  free(queues);
+  free(threads);
+  free(runners);
+
+  return now_seconds() - start;
+}
+
+void print_pipeline_stats(const PipelineStage *stages, const StageStats *stats,
+                          int stages_count, double seconds, FILE *out) {
+  int busiest = 0;
+  int i = 0;
+
+  fprintf(out, "%-12s %10s %10s %10s %10s\n", "stage", "busy", "starved",
+          "blocked", "occupancy");
+
+  for (i = 0; i < stages_count; i++) {
+    fprintf(out, "%-12s %9.3fs %9.3fs %9.3fs %9.1f%%\n", stages[i].name,
+            stats[i].busy_seconds, stats[i].starved_seconds,
+            stats[i].blocked_seconds,
+            seconds > 0 ? 100 * stats[i].busy_seconds / seconds : 0);
+
+    if (stats[i].busy_seconds > stats[busiest].busy_seconds) {
+      busiest = i;
+    }
+  }
+
+  if (stages_count > 0) {
+    fprintf(out, "total %.3fs, bottleneck: %s\n", seconds,
+            stages[busiest].name);
+  }
+}
@@ -0,0 +1,72 @@
+#ifndef __PIPELINE__H__
+#define __PIPELINE__H__
+
+/**
+ * @file pipeline.h
+ * @brief This file contains the helper running a sequence of stages over a
+ * stream of items, every stage on its own thread.
+ *
+ * The stages are connected by bounded queues, each written by a single stage
+ * and read by the next one, without locks. Every stage handles the items in
+ * their order, so the last stage sees them in the order they were given,
+ * while the earlier stages already work on the items after them.
+ */
+
+#include <stddef.h>
+#include <stdio.h>
+
+/**
+ * @struct PipelineStage
+ * @brief A stage of a pipeline.
+ */
+typedef struct {
+  const char *name;                /**< The name of the stage in the report. */
+  void (*run)(void *item, void *); /**< Handles an item, given the argument. */
+  void *arg;                       /**< The argument passed to run. */
+} PipelineStage;
+
+/**
+ * @struct StageStats
+ * @brief Where the time of a stage went during a run of a pipeline.
+ */
+typedef struct {
+  double busy_seconds;    /**< The time spent handling items. */
+  double starved_seconds; /**< The time spent waiting for the previous stage. */
+  double blocked_seconds; /**< The time spent waiting for the next stage. */
+} StageStats;
+
+/**
+ * @brief Runs the stages of a pipeline over every element of an array.
+ *
+ * The stages are started from the last one. When the thread of a stage cannot
+ * be created, it and every stage before it run on the calling thread, one
+ * element at a time.
+ *
+ * @param stages The stages, in order.
+ * @param stats The statistics of every stage, filled by the run.
+ * @param stages_count The number of stages.
+ * @param elements The array of elements.
+ * @param element_size The size of an element.
+ * @param count The number of elements.
+ * @param queue_capacity The number of elements a queue between two stages
+ * holds at most.
+ * @return The time the run took, in seconds.
+ */
+double run_pipeline(const PipelineStage *stages, StageStats *stats,
+                    int stages_count, void *elements, size_t element_size,
+                    int count, int queue_capacity);
+
+/**
+ * @brief Prints the occupancy of every stage of a run, the share of the run
+ * it spent handling items, and names the busiest one.
+ *
+ * @param stages The stages, in order.
+ * @param stats The statistics of every stage.
+ * @param stages_count The number of stages.
+ * @param seconds The time the run took.
+ * @param out The stream to write the report to.
+ */
+void print_pipeline_stats(const PipelineStage *stages, const StageStats *stats,
+                          int stages_count, double seconds, FILE *out);
+
+#endif
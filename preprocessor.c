@@ -1,115 +1,253 @@
-/* TODO: remove strdup and getline functions and use the ones from the standard
- * library instead.*/
 #include "consts.h"
 #include "errors.h"
-#define _POSIX_C_SOURCE 200809L
 #include "preprocessor.h"
+#include "source.h"
 #include "utils.h"
 #include <stdio.h>
 #include <stdlib.h>
-#include <sys/types.h>
 
 extern char *keywords[KEYWORDS_COUNT];
 
-char *preprocess(const char *file_name) {
+/**
+ * @struct Buffer
+ * @brief A growing buffer the expanded source is written to.
+ */
+typedef struct {
+  char *text;    /**< The characters written so far. */
+  long size;     /**< The number of characters written. */
+  long capacity; /**< The number of characters allocated. */
+} Buffer;
+
+static void append(Buffer *buffer, const char *text, long length) {
+  if (buffer->size + length + 1 > buffer->capacity) {
+    long capacity = buffer->capacity ? buffer->capacity : 256;
+    char *temp = NULL;
+
+    while (buffer->size + length + 1 > capacity) {
+      capacity *= 2;
+    }
 
-  char *line_buffer = NULL;
-  size_t len = 0;
-  ssize_t read;
-  Macro *macro_list = NULL;
-  int line_number = 1;
+    temp = (char *)realloc(buffer->text, capacity);
 
-  FILE *as_file = NULL;
-  FILE *am_file = NULL;
+    if (temp == NULL) {
+      fprintf(stderr, ERROR_OUT_OF_MEMORY);
+      exit(EXIT_FAILURE);
+    }
 
-  char *as_file_name = NULL;
-  char *am_file_name = NULL;
+    buffer->text = temp;
+    buffer->capacity = capacity;
+  }
 
-  as_file_name = STR_CAT_WITH_MALLOC(file_name, ".as");
-  am_file_name = STR_CAT_WITH_MALLOC(file_name, ".am");
+  memcpy(buffer->text + buffer->size, text, length);
+  buffer->size += length;
+  buffer->text[buffer->size] = '\0';
+}
 
-  as_file = fopen(as_file_name, "r");
-  am_file = fopen(am_file_name, "w");
+/*
+ * Copies the line starting at an offset of the text into a buffer, with its
+ * newline, as getline() would, and returns the offset of the next line.
+ */
+static long read_line(const char *text, long size, long start,
+                      Buffer *line) {
+  long end = start;
 
-  if (!as_file || !am_file) {
-    return NULL;
+  while (end < size && text[end++] != '\n') {
+  }
+
+  line->size = 0;
+  append(line, text + start, end - start);
+
+  return end;
+}
+
+/* Adds a line to the body of a macro */
+static void add_body_line(Macro *macro, const char *line) {
+  char **temp = (char **)realloc(macro->body,
+                                 (macro->num_lines + 1) * sizeof(char *));
+
+  if (temp == NULL) {
+    fprintf(stderr, ERROR_OUT_OF_MEMORY);
+    exit(EXIT_FAILURE);
+  }
+
+  macro->body = temp;
+  macro->body[macro->num_lines] = strdup(line);
+
+  if (macro->body[macro->num_lines] == NULL) {
+    fprintf(stderr, ERROR_OUT_OF_MEMORY);
+    exit(EXIT_FAILURE);
   }
 
-  while ((read = getline(&line_buffer, &len, as_file)) != -1) {
-    size_t leading_spaces = strspn(line_buffer, " ");
+  macro->num_lines++;
+}
+
+bool expand_macros(const char *text, long size, char **expanded,
+                   long *expanded_size, SourceMap *map,
+                   DiagnosticList *diagnostics) {
+  Buffer output = {NULL, 0, 0};
+  Buffer line = {NULL, 0, 0};
+  Macro *macro_list = NULL;
+  bool has_error = false;
+  int line_number = 0;
+  int next_line = 0; /* The line continuing the last run of the map */
+  long start = 0;
+
+  while (start < size) {
+    size_t leading_spaces = 0;
+
+    start = read_line(text, size, start, &line);
+    line_number++;
+    leading_spaces = strspn(line.text, " ");
+
+    if (strncmp(line.text + leading_spaces, "mcr", 3) == 0) {
+      Macro *new_macro = get_macro(line.text, line_number, diagnostics);
 
-    if (strncmp(line_buffer + leading_spaces, "mcr", 3) == 0) {
-      Macro *new_macro = get_macro(line_buffer, &line_number);
+      /* The body of an invalid macro is skipped all the same */
+      while (start < size) {
+        start = read_line(text, size, start, &line);
+        line_number++;
 
-      while ((read = getline(&line_buffer, &len, as_file)) != -1 &&
-             strstr(line_buffer, "endmcr") == NULL) {
-        new_macro->body = realloc(new_macro->body,
-                                  (new_macro->num_lines + 1) * sizeof(char *));
-        new_macro->body[new_macro->num_lines] = strdup(line_buffer);
-        new_macro->num_lines++;
+        if (strstr(line.text, "endmcr") != NULL) {
+          break;
+        }
+
+        if (new_macro) {
+          add_body_line(new_macro, line.text);
+        }
       }
 
-      add_macro(&macro_list, new_macro);
+      if (new_macro) {
+        add_macro(&macro_list, new_macro);
+      } else {
+        has_error = true;
+      }
     } else {
-      Macro *macro = find_macro(macro_list, line_buffer);
+      Macro *macro = find_macro(macro_list, line.text);
 
       if (macro) {
         int i;
 
+        if (map && macro->num_lines > 0) {
+          add_source_origin(map, output.size, macro->first_line, line_number);
+        }
+
         for (i = 0; i < macro->num_lines; i++) {
-          fprintf(am_file, "%s", macro->body[i]);
+          append(&output, macro->body[i], strlen(macro->body[i]));
         }
 
+        next_line = 0;
       } else {
-        fprintf(am_file, "%s", line_buffer);
+        if (map && line_number != next_line) {
+          add_source_origin(map, output.size, line_number, 0);
+        }
+
+        append(&output, line.text, strlen(line.text));
+        next_line = line_number + 1;
       }
     }
+  }
 
-    line_number++;
+  /* An empty source still expands to an empty string */
+  if (output.text == NULL) {
+    append(&output, "", 0);
   }
 
-  free(line_buffer);
+  free(line.text);
   free_macro_list(macro_list);
 
-  fclose(am_file);
-  fclose(as_file);
+  *expanded = output.text;
+  *expanded_size = output.size;
+
+  return !has_error;
+}
+
+char *preprocess(IoBatch *batch, const char *file_name) {
+  SourceFile as_source;
+  DiagnosticList diagnostics;
+  char *expanded = NULL;
+  long expanded_size = 0;
+  bool is_expanded = false;
+  bool is_written = false;
+
+  char *as_file_name = NULL;
+  char *am_file_name = NULL;
 
+  as_file_name = STR_CAT_WITH_MALLOC(file_name, ".as");
+  am_file_name = STR_CAT_WITH_MALLOC(file_name, ".am");
+
+  if (!load_source(&as_source, as_file_name)) {
+    free(as_file_name);
+    free(am_file_name);
+    return NULL;
+  }
+
+  init_diagnostics(&diagnostics, as_file_name);
+  is_expanded = expand_macros(as_source.text, as_source.size, &expanded,
+                              &expanded_size, NULL, &diagnostics);
+  flush_diagnostics(&diagnostics, stdout);
+  free_diagnostics(&diagnostics);
+  free_source(&as_source);
   free(as_file_name);
 
+  is_written = write_output(batch, am_file_name, expanded, expanded_size);
+
+  if (!is_written || !is_expanded) {
+    free(am_file_name);
+    return NULL;
+  }
+
   return am_file_name;
 }
 
-Macro *get_macro(char *line_buffer, int *line_number) {
-  char *name = NULL;
-  Macro *new_macro = (Macro *)malloc(sizeof(Macro));
-  new_macro->next = NULL;
+Macro *get_macro(const char *line, int line_number,
+                 DiagnosticList *diagnostics) {
+  const char *name = line;
+  size_t name_length = 0;
+  Macro *new_macro = NULL;
+  int i;
+
+  /* The name is the second word of the line, without its last character */
+  name += strspn(name, " ");
+  name += strcspn(name, " ");
+  name += strspn(name, " ");
+  name_length = strcspn(name, " ");
+
+  if (name_length == 0) {
+    report_diagnostic(diagnostics, DIAG_MISSING_MACRO_NAME, line_number, 0);
+    return NULL;
+  }
 
-  name = strtok(line_buffer, " ");
-  name = strtok(NULL, " ");
+  new_macro = (Macro *)malloc(sizeof(Macro));
 
-  name[strlen(name) - 1] = '\0';
+  if (new_macro == NULL) {
+    fprintf(stderr, ERROR_OUT_OF_MEMORY);
+    exit(EXIT_FAILURE);
+  }
 
-  new_macro->name = malloc(strlen(name) + 1);
-  if (new_macro->name != NULL) {
-    int i;
+  new_macro->name = malloc(name_length);
 
-    for (i = 0; i < KEYWORDS_COUNT; i++) {
-      if (strcmp(name, keywords[i]) == 0) {
-        printf(ERROR_MACRO_NAME, name, *line_number, "file");
-        free(new_macro->name);
-        free(new_macro);
-      }
-    }
+  if (new_macro->name == NULL) {
+    fprintf(stderr, ERROR_OUT_OF_MEMORY);
+    exit(EXIT_FAILURE);
+  }
 
-    strcpy(new_macro->name, name);
-  } else {
-    free(new_macro);
-    return NULL;
+  memcpy(new_macro->name, name, name_length - 1);
+  new_macro->name[name_length - 1] = '\0';
+
+  for (i = 0; i < KEYWORDS_COUNT; i++) {
+    if (strcmp(new_macro->name, keywords[i]) == 0) {
+      report_diagnostic(diagnostics, DIAG_MACRO_NAME, line_number, 0,
+                        new_macro->name);
+      free(new_macro->name);
+      free(new_macro);
+      return NULL;
+    }
   }
 
   new_macro->body = NULL;
   new_macro->next = NULL;
   new_macro->num_lines = 0;
+  new_macro->first_line = line_number + 1;
 
   return new_macro;
 }
@@ -127,12 +265,23 @@ void add_macro(Macro **macro_list, Macro *new_macro) {
 }
 
 Macro *find_macro(Macro *macro_list, const char *name) {
-  char *macro_name = strdup(name);
+  char *macro_name = NULL;
   Macro *current_macro = macro_list;
 
-  while (current_macro != NULL) {
-    macro_name[strlen(macro_name) - 1] = '\0';
+  if (name[0] == '\0') {
+    return NULL;
+  }
 
+  macro_name = strdup(name);
+
+  if (macro_name == NULL) {
+    fprintf(stderr, ERROR_OUT_OF_MEMORY);
+    exit(EXIT_FAILURE);
+  }
+
+  macro_name[strlen(macro_name) - 1] = '\0';
+
+  while (current_macro != NULL) {
     if (strcmp(current_macro->name, macro_name + strspn(name, " ")) == 0) {
       free(macro_name);
       return current_macro;
@@ -162,4 +311,4 @@ void free_macro_list(Macro *macro_list) {
 
     current_macro = next_macro;
   }
-}
\ No newline at end of file
+}
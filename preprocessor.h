@@ -7,6 +7,10 @@
  * preprocessor.
  */
 
+#include "diagnostics.h"
+#include "io_batch.h"
+#include "line_table.h"
+#include <stdbool.h>
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
@@ -32,6 +36,10 @@
  * Member 'num_lines' is an integer that represents the number of lines in the
  * body of the macro.
  *
+ * @param first_line
+ * Member 'first_line' is the line of the source where the body of the macro
+ * starts.
+ *
  * @param Macro
  * Member 'next' is a pointer to the next macro in a linked list of macros.
  */
@@ -39,6 +47,7 @@ typedef struct Macro {
   char *name;
   char **body;
   int num_lines;
+  int first_line;
   struct Macro *next;
 } Macro;
 
@@ -47,22 +56,53 @@ typedef struct Macro {
  * @brief This file contains the definitions for preprocessing an assembly file.
  */
 
+/**
+ * @brief Expands the macros of an assembly source held in memory.
+ *
+ * The source is read line by line as getline() would read it. A line starting
+ * with "mcr" after its leading spaces defines a macro, whose body runs up to
+ * the next line containing "endmcr", and a line holding only the name of a
+ * macro is replaced by its body. Nothing outside the arguments is touched, so
+ * several sources can be expanded at once on different threads.
+ *
+ * @param text The source, followed by a null character.
+ * @param size The number of characters of the source.
+ * @param expanded Set to the expanded source, allocated with malloc() and
+ * followed by a null character.
+ * @param expanded_size Set to the number of characters of the expanded source.
+ * @param map The map to record the lines of the source the lines of the
+ * expanded source come from in, or NULL.
+ * @param diagnostics The list collecting the diagnostics of the source.
+ * @return true if the source was expanded, false if a macro is invalid.
+ */
+bool expand_macros(const char *text, long size, char **expanded,
+                   long *expanded_size, SourceMap *map,
+                   DiagnosticList *diagnostics);
+
 /**
  * @brief Preprocesses an assembly file.
  *
- * @param file_name The name of the file to preprocess.
- * @return The name of the preprocessed file.
+ * Expands the macros of the file with the ".as" extension into the file with
+ * the ".am" extension, printing the diagnostics of the macros. Given a batch,
+ * the ".am" file is queued in it rather than written right away.
+ *
+ * @param batch The batch the ".am" file is written through, or NULL.
+ * @param file_name The name of the file to preprocess, without its extension.
+ * @return The name of the preprocessed file, or NULL if the file could not be
+ * read or written, or a macro is invalid.
  */
-char *preprocess(const char *file_name);
+char *preprocess(IoBatch *batch, const char *file_name);
 
 /**
- * @brief Gets a macro from a line buffer.
+ * @brief Gets a macro from the line defining it.
  *
- * @param line_buffer The line buffer to get the macro from.
+ * @param line The line defining the macro.
  * @param line_number The line number for error reporting.
- * @return A pointer to the macro.
+ * @param diagnostics The list the invalid macro names are reported to.
+ * @return A pointer to the macro, or NULL if its name is invalid.
  */
-Macro *get_macro(char *line, int *line_number);
+Macro *get_macro(const char *line, int line_number,
+                 DiagnosticList *diagnostics);
 
 /**
  * @brief Adds a macro to a macro list.
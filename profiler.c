@@ -0,0 +1,193 @@
+#include "profiler.h"
+#include "errors.h"
+#include "utils.h"
+#include <stdlib.h>
+#include <string.h>
+
+extern Instruction inst_table[INST_TABLE_SIZE];
+
+/**
+ * @struct Hotness
+ * @brief A counter to sort, with what it counts.
+ */
+typedef struct {
+  unsigned long count; /**< The value of the counter. */
+  int key;             /**< The address, opcode or run counted. */
+} Hotness;
+
+void init_profile(Profile *profile) { memset(profile, 0, sizeof(Profile)); }
+
+void profile_instruction(Profile *profile,
+                         const DecodedInstruction *instruction, int address,
+                         int next_address) {
+  profile->executions[address]++;
+  profile->opcodes[instruction->opcode]++;
+
+  if (instruction->opcode == OPCODE_BNE) {
+    if (next_address == address + instruction->size) {
+      profile->not_taken[address]++;
+    } else {
+      profile->taken[address]++;
+    }
+  } else if (instruction->opcode == OPCODE_JSR) {
+    profile->calls[next_address]++;
+  }
+}
+
+/* Orders the counters from the highest, then by what they count */
+static int compare_hotness(const void *first, const void *second) {
+  const Hotness *a = (const Hotness *)first;
+  const Hotness *b = (const Hotness *)second;
+
+  if (a->count != b->count) {
+    return a->count > b->count ? -1 : 1;
+  }
+
+  return a->key - b->key;
+}
+
+/* Sorts the counters above zero, returning how many there are */
+static int sort_hotness(const unsigned long *counts, int size,
+                        Hotness *sorted) {
+  int count = 0;
+  int i = 0;
+
+  for (i = 0; i < size; i++) {
+    if (counts[i] > 0) {
+      sorted[count].count = counts[i];
+      sorted[count].key = i;
+      count++;
+    }
+  }
+
+  qsort(sorted, count, sizeof(Hotness), compare_hotness);
+
+  return count;
+}
+
+static double share(unsigned long count, unsigned long total) {
+  return total > 0 ? 100.0 * count / total : 0;
+}
+
+void print_profile(const Profile *profile, const Machine *machine,
+                   const ObjectFile *object, const SourceFile *source,
+                   const char *file_name, double seconds, FILE *out) {
+  char location[LOCATION_LENGTH];
+  Hotness *sorted = (Hotness *)allocate(MAX_MEMORY_SIZE * sizeof(Hotness));
+  unsigned long *counts =
+      (unsigned long *)allocate(MAX_MEMORY_SIZE * sizeof(unsigned long));
+  unsigned long total = machine->steps;
+  long *starts = NULL;
+  int lines_count = 0;
+  int count = 0;
+  int i = 0;
+
+  if (source) {
+    starts = find_physical_lines(source, &lines_count);
+  }
+
+  fprintf(out, "Profile of '%s': %lu instructions in %.6f seconds.\n",
+          file_name, total, seconds);
+
+  fprintf(out, "\nOpcodes:\n");
+  count = sort_hotness(profile->opcodes, INST_TABLE_SIZE, sorted);
+
+  for (i = 0; i < count; i++) {
+    fprintf(out, "  %-4s %14lu %7.2f%%\n", inst_table[sorted[i].key].name,
+            sorted[i].count, share(sorted[i].count, total));
+  }
+
+  fprintf(out, "\nAddresses:\n");
+  count = sort_hotness(profile->executions, MAX_MEMORY_SIZE, sorted);
+
+  for (i = 0; i < count; i++) {
+    int address = sorted[i].key;
+    const LineRun *run =
+        find_line_run(&object->lines, address - IMAGE_START);
+    /* An instruction written over since it ran may no longer decode */
+    int opcode = machine->decoded[address].opcode;
+
+    format_location(object, address, location);
+    fprintf(out, "  %04d %14lu %7.2f%%  %-4s %-24s ", address,
+            sorted[i].count, share(sorted[i].count, total),
+            opcode >= 0 ? inst_table[opcode].name : "?", location);
+
+    if (run) {
+      fprintf(out, "%5d  ", run->line);
+      print_physical_line(source, starts, lines_count, run->line, out);
+      fprintf(out, "\n");
+    } else {
+      fprintf(out, "    -\n");
+    }
+  }
+
+  /* The counts of the addresses add up in the run of their line */
+  if (object->lines.count > 0) {
+    unsigned long *line_counts = (unsigned long *)allocate(
+        object->lines.count * sizeof(unsigned long));
+    Hotness *sorted_lines =
+        (Hotness *)allocate(object->lines.count * sizeof(Hotness));
+
+    for (i = 0; i < MAX_MEMORY_SIZE; i++) {
+      const LineRun *run = find_line_run(&object->lines, i - IMAGE_START);
+
+      if (profile->executions[i] > 0 && run) {
+        line_counts[run - object->lines.runs] += profile->executions[i];
+      }
+    }
+
+    fprintf(out, "\nLines:\n");
+    count = sort_hotness(line_counts, object->lines.count, sorted_lines);
+
+    for (i = 0; i < count; i++) {
+      const LineRun *run = &object->lines.runs[sorted_lines[i].key];
+
+      fprintf(out, "  %5d ", run->line);
+
+      if (run->call_line > 0) {
+        fprintf(out, "%5d", run->call_line);
+      } else {
+        fprintf(out, "    -");
+      }
+
+      fprintf(out, " %14lu %7.2f%%  ", sorted_lines[i].count,
+              share(sorted_lines[i].count, total));
+      print_physical_line(source, starts, lines_count, run->line, out);
+      fprintf(out, "\n");
+    }
+
+    free(sorted_lines);
+    free(line_counts);
+  }
+
+  fprintf(out, "\nBranches:\n");
+
+  for (i = 0; i < MAX_MEMORY_SIZE; i++) {
+    counts[i] = profile->taken[i] + profile->not_taken[i];
+  }
+
+  count = sort_hotness(counts, MAX_MEMORY_SIZE, sorted);
+
+  for (i = 0; i < count; i++) {
+    int address = sorted[i].key;
+
+    format_location(object, address, location);
+    fprintf(out, "  %04d %-24s taken %14lu, not taken %14lu, %7.2f%% taken\n",
+            address, location, profile->taken[address],
+            profile->not_taken[address],
+            share(profile->taken[address], sorted[i].count));
+  }
+
+  fprintf(out, "\nCalls:\n");
+  count = sort_hotness(profile->calls, MAX_MEMORY_SIZE, sorted);
+
+  for (i = 0; i < count; i++) {
+    format_location(object, sorted[i].key, location);
+    fprintf(out, "  %04d %-24s %14lu\n", sorted[i].key, location,
+            sorted[i].count);
+  }
+
+  free(starts);
+  free(counts);
+  free(sorted);
+}
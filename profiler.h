@@ -0,0 +1,77 @@
+#ifndef __PROFILER__H__
+#define __PROFILER__H__
+
+/**
+ * @file profiler.h
+ * @brief This file contains the definition of the profile of an execution,
+ * counting how often every instruction of the image runs.
+ *
+ * The counters are flat arrays indexed by address, updated in constant time
+ * after every instruction the machine executes. The report sorts them from the
+ * hottest, naming every address by the .entry label before it and, when the
+ * program was assembled with -g, by the line of the assembly file it comes
+ * from.
+ */
+
+#include "machine.h"
+#include "object_file.h"
+#include "source.h"
+#include <stdio.h>
+
+/**
+ * @struct Profile
+ * @brief The counters of an execution.
+ */
+typedef struct Profile {
+  unsigned long executions[MAX_MEMORY_SIZE]; /**< The executions of the
+                                                instruction at every
+                                                address. */
+  unsigned long taken[MAX_MEMORY_SIZE];      /**< The jumps of the bne at
+                                                every address. */
+  unsigned long not_taken[MAX_MEMORY_SIZE];  /**< The fall throughs of the
+                                                bne at every address. */
+  unsigned long calls[MAX_MEMORY_SIZE];      /**< The calls to every
+                                                address. */
+  unsigned long opcodes[INST_TABLE_SIZE];    /**< The executions of every
+                                                opcode. */
+} Profile;
+
+/**
+ * @brief Initializes a profile with every counter at zero.
+ *
+ * @param profile The profile to initialize.
+ */
+void init_profile(Profile *profile);
+
+/**
+ * @brief Counts an executed instruction.
+ *
+ * @param profile The profile.
+ * @param instruction The instruction.
+ * @param address The address of the instruction.
+ * @param next_address The program counter after the instruction.
+ */
+void profile_instruction(Profile *profile,
+                         const DecodedInstruction *instruction, int address,
+                         int next_address);
+
+/**
+ * @brief Prints the report of a profile.
+ *
+ * The report gives the executions of every opcode, then of every address, of
+ * every line when the object file has a line table, the branches of every bne
+ * and the calls to every address, each from the hottest.
+ *
+ * @param profile The profile.
+ * @param machine The machine that ran the program.
+ * @param object The object file of the program.
+ * @param source The assembly file the line table names, or NULL.
+ * @param file_name The name of the object file reported.
+ * @param seconds The time the execution took.
+ * @param out The stream to write the report to.
+ */
+void print_profile(const Profile *profile, const Machine *machine,
+                   const ObjectFile *object, const SourceFile *source,
+                   const char *file_name, double seconds, FILE *out);
+
+#endif
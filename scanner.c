@@ -0,0 +1,470 @@
+#include "scanner.h"
+#include "parser.h"
+#include "utils.h"
+#include <ctype.h>
+#include <stdlib.h>
+#include <string.h>
+
+extern Instruction inst_table[INST_TABLE_SIZE];
+extern char *keywords[KEYWORDS_COUNT];
+
+/**
+ * @struct Word
+ * @brief A token of a line, as a range of its characters.
+ */
+typedef struct {
+  const char *text; /**< The first character of the token. */
+  int length;       /**< The number of characters of the token. */
+} Word;
+
+static bool is_word(const Word *word, const char *text) {
+  return (int)strlen(text) == word->length &&
+         strncmp(word->text, text, word->length) == 0;
+}
+
+/*
+ * Splits a line into tokens like split_line_to_tokens(). The lexer drops what
+ * follows a comma inside a token, so only a comma ending a token is accepted.
+ */
+static int split_words(const char *line, Word words[MAX_LINE_LENGTH]) {
+  int count = 0;
+
+  while (*line != '\0') {
+    const char *start = NULL;
+    const char *quote = NULL;
+    const char *comma = NULL;
+
+    while (*line == ' ' || *line == '\t') {
+      line++;
+    }
+
+    start = line;
+    quote = *line == '"' ? find_string_end(line) : NULL;
+
+    /* A closed string literal is a part of one word, as for the lexer */
+    if (quote) {
+      line = quote + 1;
+    }
+
+    while (*line != '\0' && *line != ' ' && *line != '\t') {
+      if (!isprint((unsigned char)*line)) {
+        if (*line != '\n' || line[1] != '\0') {
+          return -1;
+        }
+
+        break;
+      }
+
+      if (*line == ',' && comma == NULL) {
+        comma = line;
+      }
+
+      line++;
+    }
+
+    if (comma && comma != line - 1) {
+      return -1;
+    }
+
+    if ((comma ? comma : line) > start) {
+      words[count].text = start;
+      words[count].length = (comma ? comma : line) - start;
+      count++;
+    }
+
+    if (comma) {
+      words[count].text = comma;
+      words[count].length = 1;
+      count++;
+    }
+
+    if (*line == '\n') {
+      break;
+    }
+  }
+
+  return count;
+}
+
+/* A name the parser accepts as a label, short enough to be copied safely */
+static bool is_name(const Word *word) {
+  int i = 0;
+
+  if (word->length == 0 || word->length >= MAX_LABEL_LENGTH ||
+      !isalpha((unsigned char)word->text[0])) {
+    return false;
+  }
+
+  for (i = 1; i < word->length; i++) {
+    if (!isalnum((unsigned char)word->text[i])) {
+      return false;
+    }
+  }
+
+  for (i = 0; i < KEYWORDS_COUNT; i++) {
+    if (is_word(word, keywords[i])) {
+      return false;
+    }
+  }
+
+  return true;
+}
+
+/* A number both is_number_valid() and is_integer() accept */
+static bool is_number(const char *text, int length) {
+  int i = 0;
+
+  if (length > 0 && (text[0] == '+' || text[0] == '-')) {
+    if (length == 1 || text[1] == '0') {
+      return false;
+    }
+
+    i = 1;
+  }
+
+  if (i == length) {
+    return false;
+  }
+
+  for (; i < length; i++) {
+    if (!isdigit((unsigned char)text[i])) {
+      return false;
+    }
+  }
+
+  return true;
+}
+
+static void copy_word(char *destination, const Word *word) {
+  memcpy(destination, word->text, word->length);
+  destination[word->length] = '\0';
+}
+
+/* Converts a number is_number() accepts as the parser does */
+static int word_value(const Word *word) {
+  char number[MAX_LINE_LENGTH];
+
+  copy_word(number, word);
+
+  return atoi(number);
+}
+
+/*
+ * Identifies an operand as identify_operand() does, returning -1 when it is
+ * not one of the shapes the parser handles without surprises.
+ */
+static int scan_operand(const Word *word, bool *is_symbol) {
+  Word base = *word;
+  int i = 0;
+
+  if (word->length == 2 && word->text[0] == 'r' && word->text[1] >= '0' &&
+      word->text[1] <= '7') {
+    return REGISTER;
+  }
+
+  if (word->length > 1 && word->text[0] == '#') {
+    base.text++;
+    base.length--;
+
+    if (is_number(base.text, base.length)) {
+      return IMMEDIATE;
+    }
+
+    if (is_name(&base)) {
+      *is_symbol = true;
+      return IMMEDIATE;
+    }
+
+    return -1;
+  }
+
+  if (word->length == 0 || !isalpha((unsigned char)word->text[0])) {
+    return -1;
+  }
+
+  while (i < word->length && isalnum((unsigned char)word->text[i])) {
+    i++;
+  }
+
+  *is_symbol = true;
+
+  if (i == word->length) {
+    return i < MAX_LABEL_LENGTH ? DIRECT : -1;
+  }
+
+  if (i < MAX_LABEL_LENGTH && word->text[i] == '[' &&
+      word->text[word->length - 1] == ']') {
+    Word index;
+
+    index.text = word->text + i + 1;
+    index.length = word->length - i - 2;
+
+    if (is_number(index.text, index.length) || is_name(&index)) {
+      return INDEXED;
+    }
+  }
+
+  return -1;
+}
+
+static bool scan_instruction(const Word *words, int count, int opcode,
+                             ScannedLine *scanned) {
+  const char *modes[2];
+  int types[2];
+  int operands_count = 0;
+  int i = 0;
+
+  modes[0] = inst_table[opcode].source_operand;
+  modes[1] = inst_table[opcode].destination_operand;
+  operands_count = (modes[0][0] != '\0') + (modes[1][0] != '\0');
+
+  if (operands_count == 0) {
+    scanned->size = 1;
+    return count == 1;
+  }
+
+  if (operands_count == 1) {
+    if (count != 2) {
+      return false;
+    }
+
+    types[0] = -1;
+    types[1] = scan_operand(&words[1], &scanned->refers_to_symbols);
+  } else {
+    if (count != 4 || !is_word(&words[2], ",")) {
+      return false;
+    }
+
+    types[0] = scan_operand(&words[1], &scanned->refers_to_symbols);
+    types[1] = scan_operand(&words[3], &scanned->refers_to_symbols);
+
+    if (types[0] == -1 || strchr(modes[0], '0' + types[0]) == NULL) {
+      return false;
+    }
+  }
+
+  if (types[1] == -1 || strchr(modes[1], '0' + types[1]) == NULL) {
+    return false;
+  }
+
+  /* The sizes of get_tokens_count() */
+  if (types[0] == REGISTER && types[1] == REGISTER) {
+    scanned->size = 2;
+  } else {
+    scanned->size = 1;
+
+    for (i = 0; i < 2; i++) {
+      if (types[i] != -1) {
+        scanned->size += types[i] == INDEXED ? 2 : 1;
+      }
+    }
+  }
+
+  return true;
+}
+
+/* Adds a data element, a number or the name of a symbol */
+static bool scan_element(const Word *word, char **element,
+                         ScannedLine *scanned) {
+  int *value = &scanned->values[scanned->values_count++];
+
+  if (is_name(word)) {
+    copy_word(*element, word);
+    *element += word->length + 1;
+    *value = 0;
+    scanned->elements_count++;
+    scanned->refers_to_symbols = true;
+
+    return true;
+  }
+
+  if (!is_number(word->text, word->length)) {
+    return false;
+  }
+
+  *value = word_value(word);
+
+  return true;
+}
+
+static bool scan_data(const Word *words, int count, ScannedLine *scanned) {
+  char *element = scanned->elements;
+  int i = 0;
+
+  /* Numbers and names separated by single commas */
+  if (count < 2 || count % 2 != 0) {
+    return false;
+  }
+
+  for (i = 1; i < count; i++) {
+    if (i % 2 == 0) {
+      if (!is_word(&words[i], ",")) {
+        return false;
+      }
+    } else if (!scan_element(&words[i], &element, scanned)) {
+      return false;
+    }
+  }
+
+  scanned->repeat = 1;
+  scanned->size = count / 2;
+
+  return true;
+}
+
+/* Scans a .fill or a .space line, one element repeated a number of times */
+static bool scan_block(const Word *words, int count, bool is_fill,
+                       ScannedLine *scanned) {
+  char *element = scanned->elements;
+  long repeat = 0;
+  int i = 0;
+
+  if (count != (is_fill ? 4 : 2) || (is_fill && !is_word(&words[2], ","))) {
+    return false;
+  }
+
+  /* A plain count, leaving the ones out of range to the parser */
+  for (i = 0; i < words[1].length; i++) {
+    if (!isdigit((unsigned char)words[1].text[i]) || i >= 9) {
+      return false;
+    }
+
+    repeat = 10 * repeat + (words[1].text[i] - '0');
+  }
+
+  if (repeat < 1 || repeat > MAX_IMAGE_SIZE) {
+    return false;
+  }
+
+  if (is_fill) {
+    if (!scan_element(&words[3], &element, scanned)) {
+      return false;
+    }
+  } else {
+    scanned->values[scanned->values_count++] = 0;
+  }
+
+  scanned->repeat = repeat;
+  scanned->size = repeat;
+
+  return true;
+}
+
+bool scan_line(const char *line, ScannedLine *scanned) {
+  Word words[MAX_LINE_LENGTH];
+  const Word *first = words;
+  int count = 0;
+  int i = 0;
+
+  scanned->type = SCAN_EMPTY;
+  scanned->label[0] = '\0';
+  scanned->name[0] = '\0';
+  scanned->value = 0;
+  scanned->size = 0;
+  scanned->elements_count = 0;
+  scanned->values_count = 0;
+  scanned->repeat = 0;
+  scanned->refers_to_symbols = false;
+
+  while (isspace((unsigned char)*line)) {
+    line++;
+  }
+
+  if (*line == '\0' || *line == ';') {
+    return true;
+  }
+
+  count = split_words(line, words);
+
+  if (count < 1) {
+    return false;
+  }
+
+  if (first->text[first->length - 1] == ':') {
+    Word label = *first;
+
+    label.length--;
+
+    if (!is_name(&label)) {
+      return false;
+    }
+
+    copy_word(scanned->label, &label);
+    first++;
+    count--;
+
+    if (count < 1 || first->text[first->length - 1] == ':') {
+      return false;
+    }
+  }
+
+  if (is_word(first, ".data")) {
+    scanned->type = SCAN_DATA;
+    return scan_data(first, count, scanned);
+  }
+
+  if (is_word(first, ".fill") || is_word(first, ".space")) {
+    scanned->type = SCAN_DATA;
+    return scan_block(first, count, is_word(first, ".fill"), scanned);
+  }
+
+  if (is_word(first, ".string")) {
+    int length = 0;
+
+    scanned->type = SCAN_STRING;
+
+    /* A single literal, decoded into elements */
+    if (count != 2 || first[1].text[0] != '"' ||
+        find_string_end(first[1].text) !=
+            first[1].text + first[1].length - 1) {
+      return false;
+    }
+
+    length = decode_string(first[1].text + 1, first[1].length - 2,
+                           scanned->elements);
+    scanned->size = length + 1;
+
+    return length >= 0;
+  }
+
+  for (i = 0; i < INST_TABLE_SIZE; i++) {
+    if (is_word(first, inst_table[i].name)) {
+      scanned->type = SCAN_INSTRUCTION;
+      return scan_instruction(first, count, inst_table[i].opcode, scanned);
+    }
+  }
+
+  /* The parser drops the label of the other lines, warning about some */
+  if (scanned->label[0] != '\0') {
+    return false;
+  }
+
+  if (is_word(first, ".entry") || is_word(first, ".extern")) {
+    if (count != 2 || !is_name(&first[1])) {
+      return false;
+    }
+
+    scanned->type = is_word(first, ".entry") ? SCAN_ENTRY : SCAN_EXTERN;
+    copy_word(scanned->name, &first[1]);
+
+    return true;
+  }
+
+  if (is_word(first, ".define")) {
+    char number[MAX_LINE_LENGTH];
+
+    if (count != 4 || !is_name(&first[1]) || !is_word(&first[2], "=") ||
+        !is_number(first[3].text, first[3].length)) {
+      return false;
+    }
+
+    scanned->type = SCAN_DEFINE;
+    copy_word(scanned->name, &first[1]);
+    copy_word(number, &first[3]);
+    scanned->value = atoi(number);
+
+    return true;
+  }
+
+  return false;
+}
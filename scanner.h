@@ -0,0 +1,69 @@
+#ifndef __SCANNER__H__
+#define __SCANNER__H__
+
+/**
+ * @file scanner.h
+ * @brief This file contains the definition of the fast line scanner used by
+ * the first pass.
+ *
+ * The first pass needs no more of a line than its label, its kind, the symbol
+ * it defines and the number of words it takes. The scanner reads those
+ * straight from the characters of the line, from the mnemonic and the shape of
+ * the operands, without splitting it into tokens or building an AST. It only
+ * accepts the well-formed lines it can size exactly as the parser would, and
+ * leaves every other line, and every line that would produce a diagnostic, to
+ * parse_tokens().
+ *
+ * The values of the data elements are converted as well, so that the second
+ * pass adds the words of a data line naming no symbol without parsing it.
+ */
+
+#include "consts.h"
+#include <stdbool.h>
+
+/**
+ * @brief The kinds of lines the scanner recognizes.
+ */
+typedef enum {
+  SCAN_EMPTY,       /**< An empty line or a comment. */
+  SCAN_INSTRUCTION, /**< An instruction. */
+  SCAN_DATA,        /**< A .data, .fill or .space directive. */
+  SCAN_STRING,      /**< A .string directive. */
+  SCAN_ENTRY,       /**< A .entry directive. */
+  SCAN_EXTERN,      /**< A .extern directive. */
+  SCAN_DEFINE       /**< A .define line. */
+} ScanType;
+
+/**
+ * @struct ScannedLine
+ * @brief What the first pass needs to know about a line.
+ */
+typedef struct {
+  ScanType type;                  /**< The kind of the line. */
+  char label[MAX_LABEL_LENGTH];   /**< The label of the line, empty if none. */
+  char name[MAX_LABEL_LENGTH];    /**< The name of a directive or a define. */
+  int value;                      /**< The value of a define. */
+  int size;                       /**< The number of words of the line. */
+  char elements[MAX_LINE_LENGTH]; /**< The data elements naming symbols, or
+                                       the decoded text of a string. */
+  int elements_count;             /**< The number of names in elements. */
+  int values[MAX_LINE_LENGTH];    /**< The data elements, 0 for the names. */
+  int values_count;               /**< The number of data elements. */
+  int repeat; /**< The times the data elements are repeated. */
+  bool refers_to_symbols; /**< Whether an operand or element is a symbol. */
+} ScannedLine;
+
+/**
+ * @brief Scans a line for the first pass without parsing it.
+ *
+ * The line is left untouched, so that it can still be split into tokens and
+ * parsed when the scanner gives up on it. The size of an instruction is the
+ * one get_tokens_count() computes.
+ *
+ * @param line The line, as read by fgets().
+ * @param scanned The description of the line to fill.
+ * @return true if the line was scanned, false if it must be parsed.
+ */
+bool scan_line(const char *line, ScannedLine *scanned);
+
+#endif
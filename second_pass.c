@@ -1,17 +1,88 @@
 #include "assembler.h"
 #include "converter.h"
 #include "errors.h"
+#include "source.h"
 #include <stdlib.h>
 
-void reallocate_instructions(Translator *translator) {
-  translator->code_image->instructions =
-      (char **)realloc(translator->code_image->instructions,
-                       (translator->code_image->count + 1) * MAX_WORD_SIZE);
+void add_word(CodeImage *code_image, int word) {
+  if (code_image->count == code_image->capacity) {
+    int capacity = code_image->capacity ? 2 * code_image->capacity : 64;
+    int *temp = NULL;
 
-  if (translator->code_image->instructions == NULL) {
-    fprintf(stderr, ERROR_OUT_OF_MEMORY);
-    exit(EXIT_FAILURE);
+    /* A preassigned slot is sized exactly and must not grow into the next */
+    if (code_image->preassigned) {
+      return;
+    }
+
+    temp = (int *)realloc(code_image->words, capacity * sizeof(int));
+
+    if (temp == NULL) {
+      fprintf(stderr, ERROR_OUT_OF_MEMORY);
+      exit(EXIT_FAILURE);
+    }
+
+    code_image->words = temp;
+    code_image->capacity = capacity;
+  }
+
+  code_image->words[code_image->count++] = word;
+}
+
+/*
+ * Grows the code image once for the words to add, returning where they end.
+ * A preassigned slot is not grown, the words past it being dropped.
+ */
+static int *reserve_words(CodeImage *code_image, long count) {
+  long needed = code_image->count + count;
+
+  if (needed > code_image->capacity && !code_image->preassigned) {
+    int capacity = code_image->capacity ? 2 * code_image->capacity : 64;
+    int *temp = NULL;
+
+    while (capacity < needed) {
+      capacity *= 2;
+    }
+
+    temp = (int *)realloc(code_image->words, capacity * sizeof(int));
+
+    if (temp == NULL) {
+      fprintf(stderr, ERROR_OUT_OF_MEMORY);
+      exit(EXIT_FAILURE);
+    }
+
+    code_image->words = temp;
+    code_image->capacity = capacity;
   }
+
+  return code_image->words +
+         (needed < code_image->capacity ? needed : code_image->capacity);
+}
+
+void add_data_words(CodeImage *code_image, const int *values, int count,
+                    int repeat) {
+  int *end = reserve_words(code_image, (long)count * repeat);
+  int *word = code_image->words + code_image->count;
+  int i = 0;
+
+  while (word < end) {
+    for (i = 0; i < count && word < end; i++) {
+      *word++ = to_word(values[i]);
+    }
+  }
+
+  code_image->count = end - code_image->words;
+}
+
+void add_string_words(CodeImage *code_image, const char *string) {
+  int *end = reserve_words(code_image, (long)strlen(string) + 1);
+  int *word = code_image->words + code_image->count;
+
+  /* The terminating zero is a word of the string too */
+  while (word < end) {
+    *word++ = to_word(*string++);
+  }
+
+  code_image->count = end - code_image->words;
 }
 
 void add_to_table(char symbol_name[MAX_LABEL_LENGTH], Attribute attribute,
@@ -26,6 +97,7 @@ void add_to_table(char symbol_name[MAX_LABEL_LENGTH], Attribute attribute,
   strcpy(new_symbol->symbol_name, symbol_name);
   new_symbol->attribute = attribute;
   new_symbol->value = value;
+  new_symbol->entry_line = 0;
   new_symbol->next = NULL;
 
   if (*table == NULL) {
@@ -41,198 +113,147 @@ void add_to_table(char symbol_name[MAX_LABEL_LENGTH], Attribute attribute,
   new_symbol = NULL;
 }
 
+/* Adds a use of an external symbol after the last one in constant time */
+static void add_external_symbol(Translator *translator, char *symbol_name,
+                                int address) {
+  Symbol **next = translator->last_external_symbol
+                      ? &translator->last_external_symbol->next
+                      : &translator->external_symbols;
+
+  add_to_table(symbol_name, EXTERNAL, address, next);
+  translator->last_external_symbol = *next;
+}
+
+static Symbol *find_symbol(Translator *translator, char *symbol_name,
+                           Symbol *symbol_table) {
+  if (translator->symbol_index) {
+    return index_lookup(translator->symbol_index, symbol_name);
+  }
+
+  return lookup(symbol_name, symbol_table);
+}
+
 void code_immediate_operand(Translator *translator, AST *current_node,
                             Symbol **symbol_table, int operand_index, int *line,
-                            bool *has_error, const char *input_file_name) {
+                            bool *has_error, DiagnosticList *diagnostics) {
   if (current_node->ASTOpt.Inst.InstOperands[operand_index]
           .OperandOpt.Immediate.ImmediateType == IMLABEL) {
     Symbol *symbol_to_find =
-        lookup(current_node->ASTOpt.Inst.InstOperands[1]
-                   .OperandOpt.Immediate.ImmediateOpt.label,
-               *symbol_table);
+        find_symbol(translator,
+                    current_node->ASTOpt.Inst.InstOperands[operand_index]
+                        .OperandOpt.Immediate.ImmediateOpt.label,
+                    *symbol_table);
 
     if (symbol_to_find) {
-      if (symbol_to_find->attribute == MDEFINE) {
-        char *res = NULL;
-        char *temp = NULL;
-        reallocate_instructions(translator);
-
-        res = shift_left(to_binary14(symbol_to_find->value), 2);
-
-        temp = to_base4_encrypted(res);
-
-        translator->code_image->instructions[translator->code_image->count] =
-            temp;
-
-        translator->code_image->count++;
-        temp = NULL;
-        res = NULL;
+      if (attribute_at(symbol_to_find, *line) == MDEFINE) {
+        add_word(translator->code_image,
+                 rotate_left(symbol_to_find->value, 2));
       }
     } else {
-      printf(ERROR_UNDEFIND_SYMBOL,
-             current_node->ASTOpt.Inst.InstOperands[operand_index]
-                 .OperandOpt.Immediate.ImmediateOpt.label,
-             *line, input_file_name);
+      report_diagnostic(diagnostics, DIAG_UNDEFINED_SYMBOL, *line, 0,
+                        current_node->ASTOpt.Inst.InstOperands[operand_index]
+                            .OperandOpt.Immediate.ImmediateOpt.label);
       *has_error = true;
     }
   } else {
-    char *res = NULL;
-    char *temp = NULL;
-
-    reallocate_instructions(translator);
-
-    res = shift_left(
-        to_binary14(current_node->ASTOpt.Inst.InstOperands[operand_index]
-                        .OperandOpt.Immediate.ImmediateOpt.number),
-        2);
-
-    res[strlen(res) - 1] = '0';
-    res[strlen(res) - 2] = '0';
-
-    temp = to_base4_encrypted(res);
-
-    translator->code_image->instructions[translator->code_image->count] = temp;
-
-    translator->code_image->count++;
-
-    temp = NULL;
-    res = NULL;
+    /* The two least significant bits are the A,R,E field, 00 (absolute) */
+    add_word(translator->code_image,
+             rotate_left(current_node->ASTOpt.Inst.InstOperands[operand_index]
+                             .OperandOpt.Immediate.ImmediateOpt.number,
+                         2) &
+                 ~3);
   }
 }
 
 void code_direct_operand(Translator *translator, AST *current_node,
                          Symbol **symbol_table, int *instruction_counter,
                          int operand_index, int *line, bool *has_error,
-                         const char *input_file_name) {
-  Symbol *symbol_to_find = lookup(
+                         DiagnosticList *diagnostics) {
+  Symbol *symbol_to_find = find_symbol(
+      translator,
       current_node->ASTOpt.Inst.InstOperands[operand_index].OperandOpt.label,
       *symbol_table);
 
   if (symbol_to_find) {
-    char *res = NULL;
-    char *temp = NULL;
+    Attribute attribute = attribute_at(symbol_to_find, *line);
+    int word = rotate_left(symbol_to_find->value, 2);
 
-    reallocate_instructions(translator);
-
-    res = shift_left(to_binary14(symbol_to_find->value), 2);
-
-    if (symbol_to_find->attribute == INTERNAL) {
-      res = add_binary_numbers(res, "01");
+    if (attribute == INTERNAL) {
+      word = to_word(word + 1);
     } else {
-      res = add_binary_numbers(res, "10");
+      word = to_word(word + 2);
     }
 
-    while (*symbol_table != NULL) {
-      if ((*symbol_table)->attribute == EXTERNAL &&
-          (strcmp((*symbol_table)->symbol_name,
-                  current_node->ASTOpt.Inst.InstOperands[operand_index]
-                      .OperandOpt.label) == 0)) {
-
-        int address = *instruction_counter + 101;
-
-        add_to_table(current_node->ASTOpt.Inst.InstOperands[operand_index]
-                         .OperandOpt.label,
-                     EXTERNAL, address, &translator->external_symbols);
-      }
+    if (attribute == EXTERNAL) {
+      int address = *instruction_counter + 101;
 
-      symbol_table = &(*symbol_table)->next;
+      add_external_symbol(translator,
+                          current_node->ASTOpt.Inst.InstOperands[operand_index]
+                              .OperandOpt.label,
+                          address);
     }
 
-    temp = to_base4_encrypted(res);
-    translator->code_image->instructions[translator->code_image->count] = temp;
-
-    translator->code_image->count++;
+    add_word(translator->code_image, word);
   } else {
-    printf(
-        ERROR_UNDEFIND_SYMBOL,
-        current_node->ASTOpt.Inst.InstOperands[operand_index].OperandOpt.label,
-        *line, input_file_name);
+    report_diagnostic(
+        diagnostics, DIAG_UNDEFINED_SYMBOL, *line, 0,
+        current_node->ASTOpt.Inst.InstOperands[operand_index].OperandOpt.label);
     *has_error = true;
   }
 }
 
 void code_register_operand(Translator *translator, AST *current_node,
                            int operand_index, int reg_offset) {
-  char *reg = NULL;
-
-  reallocate_instructions(translator);
-
-  reg = shift_left(
-      to_binary14(
-          current_node->ASTOpt.Inst.InstOperands[operand_index].OperandOpt.reg),
-      reg_offset);
-
-  translator->code_image->instructions[translator->code_image->count] =
-      to_base4_encrypted(reg);
-
-  translator->code_image->count++;
+  add_word(
+      translator->code_image,
+      rotate_left(
+          current_node->ASTOpt.Inst.InstOperands[operand_index].OperandOpt.reg,
+          reg_offset));
 }
 
 void code_indexed_operand(Translator *translator, AST *current_node,
                           Symbol **symbol_table, int operand_index, int *line,
-                          bool *has_error, const char *input_file_name) {
-  char *res = NULL;
-
+                          bool *has_error, DiagnosticList *diagnostics) {
   Symbol *symbol_to_find =
-      lookup(current_node->ASTOpt.Inst.InstOperands[operand_index]
-                 .OperandOpt.Index.label,
-             *symbol_table);
+      find_symbol(translator,
+                  current_node->ASTOpt.Inst.InstOperands[operand_index]
+                      .OperandOpt.Index.label,
+                  *symbol_table);
 
   if (symbol_to_find) {
-    reallocate_instructions(translator);
-
-    res = add_binary_numbers(shift_left(to_binary14(symbol_to_find->value), 2),
-                             "10");
-
-    translator->code_image->instructions[translator->code_image->count] =
-        to_base4_encrypted(res);
-
-    translator->code_image->count++;
+    add_word(translator->code_image,
+             to_word(rotate_left(symbol_to_find->value, 2) + 2));
 
     if (current_node->ASTOpt.Inst.InstOperands[operand_index]
             .OperandOpt.Index.IndexType == INLABEL) {
       Symbol *symbol_to_find =
-          lookup(current_node->ASTOpt.Inst.InstOperands[operand_index]
-                     .OperandOpt.Index.IndexOpt.label,
-                 *symbol_table);
+          find_symbol(translator,
+                      current_node->ASTOpt.Inst.InstOperands[operand_index]
+                          .OperandOpt.Index.IndexOpt.label,
+                      *symbol_table);
 
       if (symbol_to_find) {
-        if (symbol_to_find->attribute == MDEFINE) {
-          reallocate_instructions(translator);
-
-          res = shift_left(to_binary14(symbol_to_find->value), 2);
-
-          translator->code_image->instructions[translator->code_image->count] =
-              to_base4_encrypted(res);
-
-          translator->code_image->count++;
+        if (attribute_at(symbol_to_find, *line) == MDEFINE) {
+          add_word(translator->code_image,
+                   rotate_left(symbol_to_find->value, 2));
         }
       } else {
-        printf(ERROR_UNDEFIND_SYMBOL,
-               current_node->ASTOpt.Inst.InstOperands[operand_index]
-                   .OperandOpt.Index.IndexOpt.label,
-               *line, input_file_name);
+        report_diagnostic(diagnostics, DIAG_UNDEFINED_SYMBOL, *line, 0,
+                          current_node->ASTOpt.Inst.InstOperands[operand_index]
+                              .OperandOpt.Index.IndexOpt.label);
         *has_error = true;
       }
     } else if (current_node->ASTOpt.Inst.InstOperands[operand_index]
                    .OperandOpt.Index.IndexType == INNUMBER) {
-      reallocate_instructions(translator);
-
-      res = shift_left(
-          to_binary14(current_node->ASTOpt.Inst.InstOperands[operand_index]
-                          .OperandOpt.Index.IndexOpt.number),
-          2);
-
-      translator->code_image->instructions[translator->code_image->count] =
-          to_base4_encrypted(res);
-
-      translator->code_image->count++;
+      add_word(translator->code_image,
+               rotate_left(current_node->ASTOpt.Inst.InstOperands[operand_index]
+                               .OperandOpt.Index.IndexOpt.number,
+                           2));
     }
   } else {
-    printf(ERROR_UNDEFIND_SYMBOL,
-           current_node->ASTOpt.Inst.InstOperands[operand_index]
-               .OperandOpt.Index.label,
-           *line, input_file_name);
+    report_diagnostic(diagnostics, DIAG_UNDEFINED_SYMBOL, *line, 0,
+                      current_node->ASTOpt.Inst.InstOperands[operand_index]
+                          .OperandOpt.Index.label);
     *has_error = true;
   }
 }
@@ -240,94 +261,125 @@ void code_indexed_operand(Translator *translator, AST *current_node,
 void code_inst_operand(Translator *translator, AST *current_node,
                        Symbol **symbol_table, int *instruction_counter,
                        int operand_index, int reg_offset, int *line,
-                       bool *has_error, const char *input_file_name) {
+                       bool *has_error, DiagnosticList *diagnostics) {
   if (current_node->ASTOpt.Inst.InstOperands[operand_index].OperandType ==
       IMMEDIATE) {
     code_immediate_operand(translator, current_node, symbol_table,
-                           operand_index, line, has_error, input_file_name);
+                           operand_index, line, has_error, diagnostics);
   } else if (current_node->ASTOpt.Inst.InstOperands[operand_index]
                  .OperandType == DIRECT) {
     code_direct_operand(translator, current_node, symbol_table,
                         instruction_counter, operand_index, line, has_error,
-                        input_file_name);
+                        diagnostics);
   } else if (current_node->ASTOpt.Inst.InstOperands[operand_index]
                  .OperandType == REGISTER) {
     code_register_operand(translator, current_node, operand_index, reg_offset);
   } else if (current_node->ASTOpt.Inst.InstOperands[operand_index]
                  .OperandType == INDEXED) {
     code_indexed_operand(translator, current_node, symbol_table, operand_index,
-                         line, has_error, input_file_name);
+                         line, has_error, diagnostics);
   }
 }
 
 void handle_directive(Translator *translator, AST *current_node,
                       Symbol **symbol_table, int *data_counter, int *line,
-                      bool *has_error, const char *input_file_name) {
+                      bool *has_error, DiagnosticList *diagnostics) {
   int i = 0;
   if (current_node->ASTOpt.Dir.DirOpt == ENTRY) {
-    Symbol *symbol_to_find =
-        lookup(current_node->ASTOpt.Dir.ParamsOpt.label, *symbol_table);
+    Symbol *symbol_to_find = find_symbol(
+        translator, current_node->ASTOpt.Dir.ParamsOpt.label, *symbol_table);
     if (symbol_to_find) {
       symbol_to_find->attribute = INTERNAL;
     }
   } else if (current_node->ASTOpt.Dir.DirOpt == DATA) {
-    for (i = 0; i < current_node->ASTOpt.Dir.ParamsOpt.Data.count; i++) {
-      reallocate_instructions(translator);
-      if (!is_integer(current_node->ASTOpt.Dir.ParamsOpt.Data.elements[i])) {
-        Symbol *symbol_to_find = lookup(
-            current_node->ASTOpt.Dir.ParamsOpt.Data.elements[i], *symbol_table);
+    int *values = current_node->ASTOpt.Dir.ParamsOpt.Data.values;
+    char **names = current_node->ASTOpt.Dir.ParamsOpt.Data.names;
+    int count = current_node->ASTOpt.Dir.ParamsOpt.Data.count;
+    int repeat = current_node->ASTOpt.Dir.ParamsOpt.Data.repeat;
+    bool is_resolved = true;
+    int j = 0;
+
+    /* The names are resolved into the values, then added all at once */
+    for (i = 0; names && i < count; i++) {
+      if (names[i]) {
+        Symbol *symbol_to_find = find_symbol(translator, names[i],
+                                             *symbol_table);
+
         if (symbol_to_find) {
-          translator->code_image->instructions[translator->code_image->count] =
-              to_base4_encrypted(to_binary14(symbol_to_find->value));
-          translator->code_image->count++;
-          (*data_counter)++;
+          values[i] = symbol_to_find->value;
         } else {
-          printf(ERROR_UNDEFIND_SYMBOL,
-                 current_node->ASTOpt.Dir.ParamsOpt.Data.elements[i], *line,
-                 input_file_name);
+          report_diagnostic(diagnostics, DIAG_UNDEFINED_SYMBOL, *line, 0,
+                            names[i]);
           *has_error = true;
+          is_resolved = false;
+        }
+      }
+    }
+
+    if (is_resolved) {
+      add_data_words(translator->code_image, values, count, repeat);
+      *data_counter += count * repeat;
+      return;
+    }
+
+    /* The undefined names take no word */
+    for (j = 0; j < repeat; j++) {
+      for (i = 0; i < count; i++) {
+        if (names[i] == NULL ||
+            find_symbol(translator, names[i], *symbol_table)) {
+          add_word(translator->code_image, to_word(values[i]));
+          (*data_counter)++;
         }
-      } else {
-        translator->code_image->instructions[translator->code_image->count] =
-            to_base4_encrypted(to_binary14(
-                atoi(current_node->ASTOpt.Dir.ParamsOpt.Data.elements[i])));
-        translator->code_image->count++;
-        (*data_counter)++;
       }
     }
   } else if (current_node->ASTOpt.Dir.DirOpt == STRING) {
-    for (i = 0; i <= strlen(current_node->ASTOpt.Dir.ParamsOpt.string); i++) {
-      reallocate_instructions(translator);
-      translator->code_image->instructions[translator->code_image->count] =
-          to_base4_encrypted(
-              to_binary14(current_node->ASTOpt.Dir.ParamsOpt.string[i]));
-      translator->code_image->count++;
-      (*data_counter)++;
+    add_string_words(translator->code_image,
+                     current_node->ASTOpt.Dir.ParamsOpt.string);
+    *data_counter += strlen(current_node->ASTOpt.Dir.ParamsOpt.string) + 1;
+  }
+}
+
+bool handle_scanned_line(Translator *translator, ScannedLine *scanned,
+                         Symbol **symbol_table, int *data_counter) {
+  Symbol *symbol_to_find = NULL;
+
+  switch (scanned->type) {
+  case SCAN_EMPTY:
+  case SCAN_DEFINE:
+  case SCAN_EXTERN:
+    return true;
+  case SCAN_DATA:
+    add_data_words(translator->code_image, scanned->values,
+                   scanned->values_count, scanned->repeat);
+    *data_counter += scanned->size;
+    return true;
+  case SCAN_STRING:
+    add_string_words(translator->code_image, scanned->elements);
+    *data_counter += scanned->size;
+    return true;
+  case SCAN_ENTRY:
+    symbol_to_find = find_symbol(translator, scanned->name, *symbol_table);
+
+    if (symbol_to_find) {
+      symbol_to_find->attribute = INTERNAL;
     }
+    return true;
+  default:
+    return false;
   }
 }
 
 void handle_instruction(Translator *translator, AST *current_node,
                         Symbol **symbol_table, int *instruction_counter,
                         int reg_offset, int *line, bool *has_error,
-                        const char *input_file_name) {
-
-  char *binary_inst_code = NULL;
-  char *res = NULL;
+                        DiagnosticList *diagnostics) {
+  int inst_code = rotate_left(current_node->ASTOpt.Inst.InstType, 6);
   int i = 0;
 
-  reallocate_instructions(translator);
-
-  binary_inst_code =
-      shift_left(to_binary14(current_node->ASTOpt.Inst.InstType), 6);
-
   switch (current_node->ASTOpt.Inst.InstType) {
   case RTS:
   case HLT: {
-    translator->code_image->instructions[translator->code_image->count] =
-        to_base4_encrypted(binary_inst_code);
-
-    translator->code_image->count++;
+    add_word(translator->code_image, inst_code);
     break;
   }
 
@@ -340,15 +392,10 @@ void handle_instruction(Translator *translator, AST *current_node,
   case RED:
   case PRN:
   case JSR: {
-    char *binary_operand_code = shift_left(
-        to_binary14(current_node->ASTOpt.Inst.InstOperands[1].OperandType), 2);
-
-    res = to_base4_encrypted(
-        add_binary_numbers(binary_inst_code, binary_operand_code));
-
-    translator->code_image->instructions[translator->code_image->count] = res;
-    translator->code_image->count++;
+    int operand_code =
+        rotate_left(current_node->ASTOpt.Inst.InstOperands[1].OperandType, 2);
 
+    add_word(translator->code_image, to_word(inst_code + operand_code));
     break;
   }
 
@@ -357,19 +404,13 @@ void handle_instruction(Translator *translator, AST *current_node,
   case ADD:
   case SUB:
   case LEA: {
-    char *operand1 = shift_left(
-        to_binary14(current_node->ASTOpt.Inst.InstOperands[0].OperandType), 4);
-
-    char *operand2 = shift_left(
-        to_binary14(current_node->ASTOpt.Inst.InstOperands[1].OperandType), 2);
-
-    char *sum_operands = add_binary_numbers(operand1, operand2);
-    res = add_binary_numbers(binary_inst_code, sum_operands);
-    res = to_base4_encrypted(res);
-
-    translator->code_image->instructions[translator->code_image->count] = res;
+    int operand1 =
+        rotate_left(current_node->ASTOpt.Inst.InstOperands[0].OperandType, 4);
+    int operand2 =
+        rotate_left(current_node->ASTOpt.Inst.InstOperands[1].OperandType, 2);
 
-    translator->code_image->count++;
+    add_word(translator->code_image,
+             to_word(inst_code + to_word(operand1 + operand2)));
     break;
   }
   }
@@ -390,7 +431,7 @@ void handle_instruction(Translator *translator, AST *current_node,
   case JSR: {
     code_inst_operand(translator, current_node, symbol_table,
                       instruction_counter, 1, reg_offset, line, has_error,
-                      input_file_name);
+                      diagnostics);
     break;
   }
   case MOV:
@@ -400,24 +441,19 @@ void handle_instruction(Translator *translator, AST *current_node,
   case LEA: {
     if (current_node->ASTOpt.Inst.InstOperands[0].OperandType == REGISTER &&
         current_node->ASTOpt.Inst.InstOperands[1].OperandType == REGISTER) {
-      void *source_reg = shift_left(
-          to_binary14(current_node->ASTOpt.Inst.InstOperands[0].OperandOpt.reg),
-          5);
-      void *dest_reg = shift_left(
-          to_binary14(current_node->ASTOpt.Inst.InstOperands[1].OperandOpt.reg),
-          2);
-
-      res = add_binary_numbers(source_reg, dest_reg);
-      translator->code_image->instructions[translator->code_image->count] =
-          to_base4_encrypted(res);
-      translator->code_image->count++;
+      int source_reg = rotate_left(
+          current_node->ASTOpt.Inst.InstOperands[0].OperandOpt.reg, 5);
+      int dest_reg = rotate_left(
+          current_node->ASTOpt.Inst.InstOperands[1].OperandOpt.reg, 2);
+
+      add_word(translator->code_image, to_word(source_reg + dest_reg));
     } else {
       reg_offset = 5;
 
       for (i = 0; i < 2; i++) {
         code_inst_operand(translator, current_node, symbol_table,
                           instruction_counter, i, reg_offset, line, has_error,
-                          input_file_name);
+                          diagnostics);
 
         reg_offset = 2;
       }
@@ -430,10 +466,44 @@ void handle_instruction(Translator *translator, AST *current_node,
   *instruction_counter = translator->code_image->count;
 }
 
+void add_internal_symbols(Translator *translator, Symbol *symbol_table) {
+  Symbol **next = &translator->internal_symbols;
+
+  for (; symbol_table != NULL; symbol_table = symbol_table->next) {
+    if (symbol_table->attribute == INTERNAL) {
+      add_to_table(symbol_table->symbol_name, INTERNAL, symbol_table->value,
+                   next);
+      next = &(*next)->next;
+    }
+  }
+}
+
+void free_translator(Translator *translator) {
+  if (translator == NULL) {
+    return;
+  }
+
+  if (translator->code_image) {
+    free(translator->code_image->words);
+    free(translator->code_image);
+  }
+
+  free_table(translator->internal_symbols);
+  free_table(translator->external_symbols);
+  free_line_table(&translator->lines);
+  free(translator);
+}
+
+/* Records the words a line added to the code image from a given one on */
+static void record_line(Translator *translator, int first_word, int line) {
+  if (translator->code_image->count > first_word) {
+    add_line_run(&translator->lines, first_word, line);
+  }
+}
+
 bool do_second_pass(Translator **translator, Symbol **symbol_table,
-                    const char *am_file_name, FILE *am_file,
-                    int *instruction_counter, int *data_counter,
-                    const char *input_file_name) {
+                    const SourceFile *source, int *instruction_counter,
+                    int *data_counter, DiagnosticList *diagnostics) {
   char line[MAX_LINE_LENGTH] = {0};
   bool has_error = false;
   int current_line = 0;
@@ -441,50 +511,238 @@ bool do_second_pass(Translator **translator, Symbol **symbol_table,
 
   Tokens *tokens = NULL;
   AST *current_node = NULL;
+  ScannedLine scanned;
+  SymbolIndex index;
 
   *translator = (Translator *)malloc(sizeof(Translator));
+
+  if (*translator == NULL) {
+    fprintf(stderr, ERROR_OUT_OF_MEMORY);
+    exit(EXIT_FAILURE);
+  }
+
   (*translator)->code_image = (CodeImage *)malloc(sizeof(CodeImage));
-  (*translator)->code_image->instructions = NULL;
+
+  if ((*translator)->code_image == NULL) {
+    fprintf(stderr, ERROR_OUT_OF_MEMORY);
+    exit(EXIT_FAILURE);
+  }
+
+  (*translator)->code_image->words = NULL;
   (*translator)->code_image->count = 0;
+  (*translator)->code_image->capacity = 0;
+  (*translator)->code_image->preassigned = false;
 
   (*translator)->external_symbols = NULL;
+  (*translator)->last_external_symbol = NULL;
   (*translator)->internal_symbols = NULL;
+  init_line_table(&(*translator)->lines);
+
+  /* Every operand naming a symbol is looked up, so through an index */
+  init_symbol_index(&index, *symbol_table);
+  (*translator)->symbol_index = &index;
+
+  while (current_line < source->lines_count) {
+    int first_word = (*translator)->code_image->count;
+
+    read_source_line(source, current_line, line);
+
+    /* The lines referring to no symbol are encoded without an AST */
+    if (scan_line(line, &scanned) && !scanned.refers_to_symbols &&
+        handle_scanned_line(*translator, &scanned, symbol_table,
+                            data_counter)) {
+      current_line++;
+      record_line(*translator, first_word, current_line);
+      continue;
+    }
 
-  while (fgets(line, sizeof(line), am_file)) {
     tokens = split_line_to_tokens(line);
 
     current_line++;
-    current_node = parse_tokens(tokens, current_line, input_file_name);
+    current_node = parse_tokens(tokens, current_line);
 
-    if (current_node->ASTType == EMPTY || current_node->ASTType == COMMENT) {
-      continue;
+    /* The first pass checked the names, only their values are needed */
+    if (current_node->expressions_count > 0) {
+      ConstantScope constants;
+
+      constants.index = (*translator)->symbol_index;
+      constants.table = *symbol_table;
+      constants.is_strict = false;
+
+      if (fold_constants(current_node, &constants, current_line,
+                         diagnostics)) {
+        has_error = true;
+      }
     }
 
     if (current_node->ASTType == DIRECTIVE) {
       handle_directive(*translator, current_node, symbol_table, data_counter,
-                       &current_line, &has_error, input_file_name);
+                       &current_line, &has_error, diagnostics);
     } else if (current_node->ASTType == INSTRUCTION) {
       handle_instruction(*translator, current_node, symbol_table,
                          instruction_counter, reg_offset, &current_line,
-                         &has_error, input_file_name);
+                         &has_error, diagnostics);
     }
 
+    record_line(*translator, first_word, current_line);
     free_ast(current_node);
+    free(current_node);
     free_tokens(tokens);
     current_node = NULL;
     tokens = NULL;
   }
 
-  while (*symbol_table != NULL) {
-    if ((*symbol_table)->attribute == INTERNAL) {
-      reallocate_instructions(*translator);
+  add_internal_symbols(*translator, *symbol_table);
+
+  /* The index lives on the stack, the translator outlives it */
+  (*translator)->symbol_index = NULL;
+  free_symbol_index(&index);
+
+  return has_error;
+}
+
+/* Looks up a symbol the second pass needs, reporting it when it is undefined */
+static Symbol *check_symbol(const SymbolIndex *index, char *name,
+                            char *reported_name, int line, bool *has_error,
+                            DiagnosticList *diagnostics) {
+  Symbol *symbol = index_lookup(index, name);
+
+  if (symbol == NULL) {
+    report_diagnostic(diagnostics, DIAG_UNDEFINED_SYMBOL, line, 0,
+                      reported_name);
+    *has_error = true;
+  }
+
+  return symbol;
+}
+
+/* Makes the lookups code_inst_operand() makes for an operand */
+static void check_operand(const SymbolIndex *index, AST *current_node,
+                          int operand_index, int line, bool *has_error,
+                          DiagnosticList *diagnostics) {
+  if (current_node->ASTOpt.Inst.InstOperands[operand_index].OperandType ==
+          IMMEDIATE &&
+      current_node->ASTOpt.Inst.InstOperands[operand_index]
+              .OperandOpt.Immediate.ImmediateType == IMLABEL) {
+    check_symbol(index,
+                 current_node->ASTOpt.Inst.InstOperands[operand_index]
+                     .OperandOpt.Immediate.ImmediateOpt.label,
+                 current_node->ASTOpt.Inst.InstOperands[operand_index]
+                     .OperandOpt.Immediate.ImmediateOpt.label,
+                 line, has_error, diagnostics);
+  } else if (current_node->ASTOpt.Inst.InstOperands[operand_index]
+                 .OperandType == DIRECT) {
+    check_symbol(
+        index,
+        current_node->ASTOpt.Inst.InstOperands[operand_index].OperandOpt.label,
+        current_node->ASTOpt.Inst.InstOperands[operand_index].OperandOpt.label,
+        line, has_error, diagnostics);
+  } else if (current_node->ASTOpt.Inst.InstOperands[operand_index]
+                     .OperandType == INDEXED &&
+             check_symbol(index,
+                          current_node->ASTOpt.Inst.InstOperands[operand_index]
+                              .OperandOpt.Index.label,
+                          current_node->ASTOpt.Inst.InstOperands[operand_index]
+                              .OperandOpt.Index.label,
+                          line, has_error, diagnostics) &&
+             current_node->ASTOpt.Inst.InstOperands[operand_index]
+                     .OperandOpt.Index.IndexType == INLABEL) {
+    check_symbol(index,
+                 current_node->ASTOpt.Inst.InstOperands[operand_index]
+                     .OperandOpt.Index.IndexOpt.label,
+                 current_node->ASTOpt.Inst.InstOperands[operand_index]
+                     .OperandOpt.Index.IndexOpt.label,
+                 line, has_error, diagnostics);
+  }
+}
+
+/* Makes the lookups handle_directive() and handle_instruction() make */
+static void check_line(const SymbolIndex *index, AST *current_node, int line,
+                       bool *has_error, DiagnosticList *diagnostics) {
+  Symbol *symbol = NULL;
+  int i = 0;
+
+  if (current_node->ASTType == DIRECTIVE) {
+    if (current_node->ASTOpt.Dir.DirOpt == ENTRY) {
+      symbol = index_lookup(index, current_node->ASTOpt.Dir.ParamsOpt.label);
 
-      add_to_table((*symbol_table)->symbol_name, INTERNAL,
-                   (*symbol_table)->value, &(*translator)->internal_symbols);
+      if (symbol) {
+        symbol->attribute = INTERNAL;
+      }
+    } else if (current_node->ASTOpt.Dir.DirOpt == DATA) {
+      char **names = current_node->ASTOpt.Dir.ParamsOpt.Data.names;
+
+      for (i = 0; names && i < current_node->ASTOpt.Dir.ParamsOpt.Data.count;
+           i++) {
+        if (names[i]) {
+          check_symbol(index, names[i], names[i], line, has_error,
+                       diagnostics);
+        }
+      }
     }
+  } else if (current_node->ASTType == INSTRUCTION) {
+    switch (current_node->ASTOpt.Inst.InstType) {
+    case RTS:
+    case HLT:
+      break;
+
+    case MOV:
+    case CMP:
+    case ADD:
+    case SUB:
+    case LEA:
+      if (current_node->ASTOpt.Inst.InstOperands[0].OperandType != REGISTER ||
+          current_node->ASTOpt.Inst.InstOperands[1].OperandType != REGISTER) {
+        check_operand(index, current_node, 0, line, has_error, diagnostics);
+        check_operand(index, current_node, 1, line, has_error, diagnostics);
+      }
+      break;
 
-    symbol_table = &(*symbol_table)->next;
+    default:
+      check_operand(index, current_node, 1, line, has_error, diagnostics);
+      break;
+    }
   }
+}
+
+bool do_check_pass(Symbol **symbol_table, const SourceFile *source,
+                   DiagnosticList *diagnostics) {
+  char line[MAX_LINE_LENGTH] = {0};
+  ScannedLine scanned;
+  SymbolIndex index;
+  bool has_error = false;
+  int current_line = 0;
+  Symbol *symbol = NULL;
+
+  Tokens *tokens = NULL;
+  AST *current_node = NULL;
+
+  init_symbol_index(&index, *symbol_table);
+
+  for (current_line = 0; current_line < source->lines_count; current_line++) {
+    read_source_line(source, current_line, line);
+
+    /* A line naming no symbol has nothing to look up, but a .entry */
+    if (scan_line(line, &scanned) && !scanned.refers_to_symbols) {
+      if (scanned.type == SCAN_ENTRY &&
+          (symbol = index_lookup(&index, scanned.name)) != NULL) {
+        symbol->attribute = INTERNAL;
+      }
+
+      continue;
+    }
+
+    tokens = split_line_to_tokens(line);
+    current_node = parse_tokens(tokens, current_line + 1);
+    check_line(&index, current_node, current_line + 1, &has_error,
+               diagnostics);
+
+    free_ast(current_node);
+    free(current_node);
+    free_tokens(tokens);
+  }
+
+  free_symbol_index(&index);
 
   return has_error;
-}
\ No newline at end of file
+}
@@ -0,0 +1,157 @@
+#include "source.h"
+#include "errors.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+bool load_source(SourceFile *source, const char *file_name) {
+  FILE *file = fopen(file_name, "rb");
+  char *text = NULL;
+  long size = 0;
+
+  source->text = NULL;
+  source->size = 0;
+  source->line_starts = NULL;
+  source->lines_count = 0;
+
+  if (!file) {
+    return false;
+  }
+
+  fseek(file, 0, SEEK_END);
+  size = ftell(file);
+  rewind(file);
+
+  text = (char *)malloc(size + 1);
+
+  if (text == NULL) {
+    fprintf(stderr, ERROR_OUT_OF_MEMORY);
+    exit(EXIT_FAILURE);
+  }
+
+  size = fread(text, 1, size, file);
+  text[size] = '\0';
+  fclose(file);
+
+  init_source(source, text, size);
+
+  return true;
+}
+
+void init_source(SourceFile *source, char *text, long size) {
+  long capacity = size / 16 + 2;
+  long start = 0;
+  long i = 0;
+
+  source->text = text;
+  source->size = size;
+  source->lines_count = 0;
+  source->line_starts = (long *)malloc(capacity * sizeof(long));
+
+  if (source->line_starts == NULL) {
+    fprintf(stderr, ERROR_OUT_OF_MEMORY);
+    exit(EXIT_FAILURE);
+  }
+
+  /* A line ends after a newline or when the fgets() buffer would be full */
+  while (start < source->size) {
+    if (source->lines_count + 2 > capacity) {
+      long *temp = NULL;
+
+      capacity *= 2;
+      temp = (long *)realloc(source->line_starts, capacity * sizeof(long));
+
+      if (temp == NULL) {
+        fprintf(stderr, ERROR_OUT_OF_MEMORY);
+        exit(EXIT_FAILURE);
+      }
+
+      source->line_starts = temp;
+    }
+
+    source->line_starts[source->lines_count++] = start;
+
+    for (i = start; i < source->size && i - start < MAX_LINE_LENGTH - 1; i++) {
+      if (source->text[i] == '\n') {
+        i++;
+        break;
+      }
+    }
+
+    start = i;
+  }
+
+  source->line_starts[source->lines_count] = source->size;
+}
+
+void read_source_line(const SourceFile *source, int index,
+                      char line[MAX_LINE_LENGTH]) {
+  long start = source->line_starts[index];
+  long length = source->line_starts[index + 1] - start;
+
+  memcpy(line, source->text + start, length);
+  line[length] = '\0';
+}
+
+long *find_physical_lines(const SourceFile *source, int *lines_count) {
+  long *starts = NULL;
+  long position = 0;
+  int count = 1;
+
+  for (position = 0; position < source->size; position++) {
+    count += source->text[position] == '\n';
+  }
+
+  starts = (long *)malloc((count + 1) * sizeof(long));
+
+  if (starts == NULL) {
+    fprintf(stderr, ERROR_OUT_OF_MEMORY);
+    exit(EXIT_FAILURE);
+  }
+
+  starts[0] = 0;
+  count = 1;
+
+  for (position = 0; position < source->size; position++) {
+    if (source->text[position] == '\n') {
+      starts[count++] = position + 1;
+    }
+  }
+
+  starts[count] = source->size;
+  *lines_count = count;
+
+  return starts;
+}
+
+void print_physical_line(const SourceFile *source, const long *starts,
+                         int lines_count, int line, FILE *out) {
+  const char *text = NULL;
+  int length = 0;
+
+  if (source == NULL || line < 1 || line > lines_count) {
+    return;
+  }
+
+  text = source->text + starts[line - 1];
+  length = (int)(starts[line] - starts[line - 1]);
+
+  while (length > 0 && (*text == ' ' || *text == '\t')) {
+    text++;
+    length--;
+  }
+
+  while (length > 0 && (text[length - 1] == '\n' || text[length - 1] == '\r')) {
+    length--;
+  }
+
+  fprintf(out, "%.*s", length, text);
+}
+
+void free_source(SourceFile *source) {
+  free(source->text);
+  free(source->line_starts);
+  source->text = NULL;
+  source->line_starts = NULL;
+  source->lines_count = 0;
+}
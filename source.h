@@ -0,0 +1,92 @@
+#ifndef __SOURCE__H__
+#define __SOURCE__H__
+
+/**
+ * @file source.h
+ * @brief This file contains the definition and manipulation functions for a
+ * source file loaded into memory.
+ *
+ * The file is split into lines exactly as successive fgets() calls with a
+ * buffer of MAX_LINE_LENGTH characters would split it, so that any line can be
+ * read on its own and the line numbers match the ones of the sequential passes.
+ */
+
+#include "consts.h"
+#include <stdbool.h>
+#include <stdio.h>
+
+/**
+ * @struct SourceFile
+ * @brief A source file loaded into memory with the start of every line.
+ */
+typedef struct {
+  char *text;        /**< The content of the file. */
+  long size;         /**< The number of characters in the file. */
+  long *line_starts; /**< The offset of every line, plus the end of the file. */
+  int lines_count;   /**< The number of lines in the file. */
+} SourceFile;
+
+/**
+ * @brief Loads a source file into memory and indexes its lines.
+ *
+ * @param source The source file to fill.
+ * @param file_name The name of the file to load.
+ * @return true if the file was loaded, false if it could not be read.
+ */
+bool load_source(SourceFile *source, const char *file_name);
+
+/**
+ * @brief Indexes the lines of a source already in memory.
+ *
+ * @param source The source file to fill.
+ * @param text The content of the source, allocated with malloc() and followed
+ * by a null character. The source takes ownership of it.
+ * @param size The number of characters in the content.
+ */
+void init_source(SourceFile *source, char *text, long size);
+
+/**
+ * @brief Copies a line of a source file into a buffer.
+ *
+ * The buffer receives the same content fgets() would have stored for the line,
+ * including the newline character when there is one.
+ *
+ * @param source The source file.
+ * @param index The index of the line, starting from 0.
+ * @param line The buffer to copy the line into.
+ */
+void read_source_line(const SourceFile *source, int index,
+                      char line[MAX_LINE_LENGTH]);
+
+/**
+ * @brief Finds the start of every line of a source file as its newlines end
+ * them, the way the lines are numbered in the map files.
+ *
+ * @param source The source file.
+ * @param lines_count Set to the number of lines.
+ * @return The offset of every line, plus the end of the file, to free.
+ */
+long *find_physical_lines(const SourceFile *source, int *lines_count);
+
+/**
+ * @brief Prints a line of a source file without its indentation and newline.
+ *
+ * @param source The source file, or NULL to print nothing.
+ * @param starts The lines of the source file, as find_physical_lines() finds
+ * them.
+ * @param lines_count The number of lines.
+ * @param line The number of the line, starting from 1. Nothing is printed for
+ * a line the file does not have.
+ * @param out The stream to print the line to.
+ */
+void print_physical_line(const SourceFile *source, const long *starts,
+                         int lines_count, int line, FILE *out);
+
+/**
+ * @brief Frees the memory allocated for a source file.
+ *
+ * @param source The source file to free.
+ */
+void free_source(SourceFile *source);
+
+#endif
@@ -0,0 +1,115 @@
+#include "symbol_index.h"
+#include "errors.h"
+
+static unsigned long hash_name(const char *name) {
+  unsigned long hash = 2166136261UL;
+
+  while (*name != '\0') {
+    hash = ((hash ^ (unsigned char)*name++) * 16777619UL) & 0xFFFFFFFFUL;
+  }
+
+  return hash;
+}
+
+static Symbol **find_slot(const SymbolIndex *index, const char *symbol_name) {
+  unsigned long mask = index->capacity - 1;
+  unsigned long slot = hash_name(symbol_name) & mask;
+
+  while (index->slots[slot] != NULL &&
+         strcmp(index->slots[slot]->symbol_name, symbol_name) != 0) {
+    slot = (slot + 1) & mask;
+  }
+
+  return &index->slots[slot];
+}
+
+static void grow_index(SymbolIndex *index) {
+  Symbol **old_slots = index->slots;
+  int old_capacity = index->capacity;
+  int i = 0;
+
+  index->capacity = old_capacity ? 2 * old_capacity : 64;
+  index->slots = (Symbol **)calloc(index->capacity, sizeof(Symbol *));
+
+  if (index->slots == NULL) {
+    fprintf(stderr, ERROR_OUT_OF_MEMORY);
+    exit(EXIT_FAILURE);
+  }
+
+  for (i = 0; i < old_capacity; i++) {
+    if (old_slots[i] != NULL) {
+      *find_slot(index, old_slots[i]->symbol_name) = old_slots[i];
+    }
+  }
+
+  free(old_slots);
+}
+
+static void index_symbol(SymbolIndex *index, Symbol *symbol) {
+  Symbol **slot = NULL;
+
+  if (2 * (index->count + 1) > index->capacity) {
+    grow_index(index);
+  }
+
+  slot = find_slot(index, symbol->symbol_name);
+
+  /* Like lookup(), the index keeps the first symbol defined with a name */
+  if (*slot == NULL) {
+    *slot = symbol;
+    index->count++;
+  }
+}
+
+void init_symbol_index(SymbolIndex *index, Symbol *table) {
+  index->slots = NULL;
+  index->capacity = 0;
+  index->count = 0;
+  index->last = NULL;
+
+  grow_index(index);
+
+  for (; table != NULL; table = table->next) {
+    index_symbol(index, table);
+    index->last = table;
+  }
+}
+
+Symbol *index_lookup(const SymbolIndex *index, const char *symbol_name) {
+  return *find_slot(index, symbol_name);
+}
+
+Symbol *index_add_symbol(SymbolIndex *index, const char *symbol_name,
+                         Attribute attribute, int value, Symbol **table) {
+  Symbol *new_symbol = (Symbol *)malloc(sizeof(Symbol));
+
+  if (new_symbol == NULL) {
+    fprintf(stderr, ERROR_OUT_OF_MEMORY);
+    exit(EXIT_FAILURE);
+  }
+
+  strcpy(new_symbol->symbol_name, symbol_name);
+  new_symbol->attribute = attribute;
+  new_symbol->value = value;
+  new_symbol->entry_line = 0;
+  new_symbol->next = NULL;
+
+  if (index->last == NULL) {
+    *table = new_symbol;
+  } else {
+    index->last->next = new_symbol;
+  }
+
+  index->last = new_symbol;
+  index_symbol(index, new_symbol);
+
+  return new_symbol;
+}
+
+void free_symbol_index(SymbolIndex *index) {
+  free(index->slots);
+  index->slots = NULL;
+  index->capacity = 0;
+  index->count = 0;
+  index->last = NULL;
+}
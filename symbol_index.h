@@ -0,0 +1,64 @@
+#ifndef __SYMBOL_INDEX__H__
+#define __SYMBOL_INDEX__H__
+
+/**
+ * @file symbol_index.h
+ * @brief This file contains the definition and manipulation functions for a
+ * hash index over the symbol table.
+ *
+ * The symbol table stays a linked list in definition order. The index only
+ * maps the names to the symbols of the list, so that looking a symbol up does
+ * not have to walk the whole table.
+ */
+
+#include "symbol_table.h"
+
+/**
+ * @struct SymbolIndex
+ * @brief An open addressing hash table of the symbols of a symbol table.
+ */
+typedef struct {
+  Symbol **slots; /**< The indexed symbols, NULL for an empty slot. */
+  int capacity;   /**< The number of slots, always a power of two. */
+  int count;      /**< The number of indexed symbols. */
+  Symbol *last;   /**< The last symbol of the indexed table. */
+} SymbolIndex;
+
+/**
+ * @brief Builds an index over the symbols already in a symbol table.
+ *
+ * @param index The index to build.
+ * @param table The symbol table to index.
+ */
+void init_symbol_index(SymbolIndex *index, Symbol *table);
+
+/**
+ * @brief Looks up a symbol by name in the index.
+ *
+ * @param index The index.
+ * @param symbol_name The name of the symbol to look up.
+ * @return A pointer to the symbol if found, NULL otherwise.
+ */
+Symbol *index_lookup(const SymbolIndex *index, const char *symbol_name);
+
+/**
+ * @brief Adds a new symbol to the end of a symbol table and to its index.
+ *
+ * @param index The index of the table.
+ * @param symbol_name The name of the symbol.
+ * @param attribute The attribute of the symbol.
+ * @param value The value of the symbol.
+ * @param table The indexed symbol table.
+ * @return The added symbol.
+ */
+Symbol *index_add_symbol(SymbolIndex *index, const char *symbol_name,
+                         Attribute attribute, int value, Symbol **table);
+
+/**
+ * @brief Frees the memory allocated for an index, not for its symbols.
+ *
+ * @param index The index to free.
+ */
+void free_symbol_index(SymbolIndex *index);
+
+#endif
@@ -24,6 +24,8 @@ typedef struct Symbol {
   char symbol_name[MAX_LABEL_LENGTH]; /**< The name of the symbol. */
   Attribute attribute;                /**< The attribute of the symbol. */
   int value;                          /**< The value of the symbol. */
+  int entry_line; /**< The line of its first .entry when the lines are encoded
+                     out of order, 0 otherwise. */
   struct Symbol *next; /**< A pointer to the next symbol in the table. */
 } Symbol;
 
@@ -46,6 +48,18 @@ Symbol *lookup(char symbol_name[MAX_LABEL_LENGTH], Symbol *table);
 void add_symbol(char *label, Attribute attribute, int value, Symbol *new_symbol,
                 Symbol **table);
 
+/** @brief Gets the attribute of a symbol as seen by a line.
+ *
+ *  A symbol becomes internal at its first .entry line. When the lines are
+ *  encoded in order the .entry line has already changed its attribute; when
+ *  they are not, its entry_line tells from which line on it is internal.
+ *
+ *  @param symbol The symbol.
+ *  @param line The line using the symbol.
+ *  @return The attribute of the symbol on that line.
+ */
+Attribute attribute_at(const Symbol *symbol, int line);
+
 /** @brief Frees the memory allocated for the symbol table.
  *
  *  @param table The symbol table.
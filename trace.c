@@ -0,0 +1,457 @@
+#define _POSIX_C_SOURCE 200809L
+#include "trace.h"
+#include "errors.h"
+#include <pthread.h>
+#include <sched.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+/*
+ * The thread writing the file yields a few times, then sleeps for longer and
+ * longer while the ring is empty. Its sleep is short next to the time the
+ * machine takes to fill the ring.
+ */
+#define SPINS_BEFORE_SLEEP 16
+#define FIRST_SLEEP_NANOSECONDS 10000
+#define MAX_SLEEP_NANOSECONDS 100000
+
+/* The bytes of the buffer the records are compressed into before a write */
+#define WRITE_BUFFER_SIZE 65536
+
+/* The bytes apart the fields written by different threads are kept */
+#define CACHE_LINE_SIZE 64
+
+/* The most bytes a compressed record takes */
+#define MAX_ENCODED_RECORD_SIZE 12
+
+/*
+ * The first byte of a compressed record: what the record repeats of the last
+ * record of its address, the zero flag, and the change of the value written
+ * when it is below CHANGE_FOLLOWS.
+ */
+#define SAME_PC 0x01
+#define SAME_ACCESSES 0x02
+#define SAME_ADDRESS 0x04
+#define ZERO 0x08
+#define CHANGE_SHIFT 4
+#define CHANGE_FOLLOWS 15
+
+/* The accesses of a record, without the zero flag */
+#define ACCESSES_MASK 0x3F
+
+/* The bits of a word */
+#define WORD_MASK 0x3FFF
+
+/**
+ * @struct Tracer
+ * @brief The ring of the records, between the thread running the machine and
+ * the thread writing the file.
+ *
+ * Only the thread running the machine writes tail, pending and cached_head,
+ * and only the thread writing the file writes head and the state it compresses
+ * against. A record is stored before tail is released past it, and its slot is
+ * reused only after head is released past it, so no lock is needed.
+ */
+struct Tracer {
+  TraceRecord records[TRACE_RING_SIZE]; /**< The slots of the ring. */
+  unsigned long pending;     /**< The number of records put in. */
+  unsigned long cached_head; /**< The head seen last by the machine. */
+  bool is_threaded;          /**< Whether the file is written by a thread. */
+  pthread_t thread;          /**< The thread writing the file. */
+  char pad[CACHE_LINE_SIZE]; /**< Keeps tail on a cache line of its own. */
+  unsigned long tail;        /**< The number of records published. */
+  int is_done;               /**< Whether no record is put in anymore. */
+  char pad_after[CACHE_LINE_SIZE]; /**< Keeps head off the line of tail. */
+  unsigned long head;        /**< The number of records written. */
+  FILE *file;                /**< The trace file. */
+  bool is_failed;            /**< Whether a write to the file failed. */
+  unsigned long bytes;       /**< The bytes written to the file. */
+  TraceHistory history;      /**< The records written so far. */
+  unsigned char buffer[WRITE_BUFFER_SIZE]; /**< The compressed records. */
+};
+
+static void pause_writer(int *tries) {
+  struct timespec pause;
+  long sleep = FIRST_SLEEP_NANOSECONDS;
+  int i = 0;
+
+  if ((*tries)++ < SPINS_BEFORE_SLEEP) {
+    sched_yield();
+    return;
+  }
+
+  for (i = SPINS_BEFORE_SLEEP + 1; i < *tries && sleep < MAX_SLEEP_NANOSECONDS;
+       i++) {
+    sleep *= 2;
+  }
+
+  pause.tv_sec = 0;
+  pause.tv_nsec = sleep < MAX_SLEEP_NANOSECONDS ? sleep : MAX_SLEEP_NANOSECONDS;
+  nanosleep(&pause, NULL);
+}
+
+/* Maps the small differences of either sign to small numbers */
+static unsigned long zigzag(long difference) {
+  return difference < 0 ? ((unsigned long)-difference << 1) - 1
+                        : (unsigned long)difference << 1;
+}
+
+static long unzigzag(unsigned long number) {
+  return number & 1 ? -(long)((number + 1) >> 1) : (long)(number >> 1);
+}
+
+/* Writes a number 7 bits a byte from the lowest, returning the bytes taken */
+static int put_number(unsigned char *out, unsigned long number) {
+  int size = 0;
+
+  while (number >= 0x80) {
+    out[size++] = (unsigned char)(number | 0x80);
+    number >>= 7;
+  }
+
+  out[size++] = (unsigned char)number;
+
+  return size;
+}
+
+static void init_history(TraceHistory *history) {
+  memset(history, 0, sizeof(TraceHistory));
+  /* No record has the opcode of an address that never ran */
+  memset(history->opcodes, 0xFF, sizeof(history->opcodes));
+  history->pc = IMAGE_START;
+}
+
+/* Gets the change of a word as a signed difference of 14 bits */
+static long word_change(int from, int to) {
+  int change = (to - from) & WORD_MASK;
+
+  return change & 0x2000 ? change - 0x4000 : change;
+}
+
+/* Compresses a record against its history, returning the bytes taken */
+static int encode_record(TraceHistory *history, const TraceRecord *record,
+                         unsigned char *out) {
+  int pc = record->pc;
+  int accesses = record->flags & ACCESSES_MASK;
+  unsigned long change = 0;
+  int first = 0;
+  int size = 1;
+
+  first |= record->flags & TRACE_ZERO ? ZERO : 0;
+
+  if (history->next_pcs[history->pc] == pc) {
+    first |= SAME_PC;
+  } else {
+    size += put_number(out + size, zigzag((long)pc - history->pc));
+    history->next_pcs[history->pc] = (unsigned short)pc;
+  }
+
+  if (history->opcodes[pc] == record->opcode &&
+      history->flags[pc] == accesses) {
+    first |= SAME_ACCESSES;
+  } else {
+    out[size++] = record->opcode;
+    out[size++] = (unsigned char)accesses;
+    history->opcodes[pc] = record->opcode;
+    history->flags[pc] = (unsigned char)accesses;
+  }
+
+  if (accesses & (TRACE_MEMORY_READ | TRACE_MEMORY_WRITTEN)) {
+    if (history->addresses[pc] == record->address) {
+      first |= SAME_ADDRESS;
+    } else {
+      size += put_number(out + size, zigzag((long)record->address -
+                                            history->addresses[pc]));
+      history->addresses[pc] = record->address;
+    }
+  }
+
+  if (accesses & (TRACE_REGISTER_WRITTEN | TRACE_MEMORY_WRITTEN)) {
+    change = zigzag(word_change(history->values[pc], record->value));
+    history->values[pc] = record->value;
+
+    if (change < CHANGE_FOLLOWS) {
+      first |= (int)change << CHANGE_SHIFT;
+    } else {
+      first |= CHANGE_FOLLOWS << CHANGE_SHIFT;
+      size += put_number(out + size, change);
+    }
+  }
+
+  out[0] = (unsigned char)first;
+  history->pc = pc;
+
+  return size;
+}
+
+static void write_buffer(Tracer *tracer, size_t size) {
+  if (fwrite(tracer->buffer, 1, size, tracer->file) != size) {
+    tracer->is_failed = true;
+  }
+
+  tracer->bytes += size;
+}
+
+/* Writes the records up to a tail to the file, then frees their slots */
+static void write_records(Tracer *tracer, unsigned long tail) {
+  unsigned long position = tracer->head;
+  size_t size = 0;
+
+  for (; position != tail; position++) {
+    if (size > WRITE_BUFFER_SIZE - MAX_ENCODED_RECORD_SIZE) {
+      write_buffer(tracer, size);
+      size = 0;
+    }
+
+    size += encode_record(&tracer->history,
+                          &tracer->records[position % TRACE_RING_SIZE],
+                          tracer->buffer + size);
+  }
+
+  write_buffer(tracer, size);
+  __atomic_store_n(&tracer->head, tail, __ATOMIC_RELEASE);
+}
+
+static void *run_writer(void *arg) {
+  Tracer *tracer = (Tracer *)arg;
+  int tries = 0;
+
+  while (true) {
+    /* Done is read first, so that the records put in before it are seen */
+    int is_done = __atomic_load_n(&tracer->is_done, __ATOMIC_ACQUIRE);
+    unsigned long tail = __atomic_load_n(&tracer->tail, __ATOMIC_ACQUIRE);
+
+    if (tail != tracer->head) {
+      write_records(tracer, tail);
+      tries = 0;
+    } else if (is_done) {
+      return NULL;
+    } else {
+      pause_writer(&tries);
+    }
+  }
+}
+
+Tracer *open_tracer(const char *file_name) {
+  Tracer *tracer = (Tracer *)malloc(sizeof(Tracer));
+
+  if (tracer == NULL) {
+    fprintf(stderr, ERROR_OUT_OF_MEMORY);
+    exit(EXIT_FAILURE);
+  }
+
+  memset(tracer, 0, sizeof(Tracer));
+  init_history(&tracer->history);
+  tracer->file = fopen(file_name, "wb");
+
+  if (tracer->file == NULL) {
+    fprintf(stderr, ERROR_CANNOT_WRITE, file_name);
+    free(tracer);
+    return NULL;
+  }
+
+  memcpy(tracer->buffer, TRACE_MAGIC, TRACE_MAGIC_LENGTH);
+  write_buffer(tracer, TRACE_MAGIC_LENGTH);
+  tracer->is_threaded =
+      pthread_create(&tracer->thread, NULL, run_writer, tracer) == 0;
+
+  return tracer;
+}
+
+/* Waits until the thread writing the file frees a slot of the ring */
+static void wait_for_slot(Tracer *tracer) {
+  int tries = 0;
+
+  __atomic_store_n(&tracer->tail, tracer->pending, __ATOMIC_RELEASE);
+
+  if (!tracer->is_threaded) {
+    write_records(tracer, tracer->pending);
+    tracer->cached_head = tracer->head;
+    return;
+  }
+
+  while (tracer->pending - tracer->cached_head == TRACE_RING_SIZE) {
+    pause_writer(&tries);
+    tracer->cached_head = __atomic_load_n(&tracer->head, __ATOMIC_ACQUIRE);
+  }
+}
+
+static bool is_in_memory(const MachineOperand *operand) {
+  return operand->mode == MODE_DIRECT || operand->mode == MODE_INDEXED;
+}
+
+void trace_instruction(Tracer *tracer, const Machine *machine,
+                       const DecodedInstruction *instruction, int address) {
+  const MachineOperand *source = &instruction->operands[0];
+  const MachineOperand *destination = &instruction->operands[1];
+  int accesses = opcode_accesses[instruction->opcode];
+  TraceRecord *record = NULL;
+
+  if (tracer->pending - tracer->cached_head == TRACE_RING_SIZE) {
+    wait_for_slot(tracer);
+  }
+
+  record = &tracer->records[tracer->pending % TRACE_RING_SIZE];
+  record->pc = (unsigned short)address;
+  record->opcode = (unsigned char)instruction->opcode;
+  record->flags = machine->is_zero ? TRACE_ZERO : 0;
+  record->value = 0;
+  record->address = 0;
+
+  /* The word written is recorded rather than the words read to compute it */
+  if ((accesses & ACCESS_WRITES_DESTINATION) &&
+      destination->mode == MODE_REGISTER) {
+    record->flags |= TRACE_REGISTER_WRITTEN | destination->value;
+    record->value = (unsigned short)machine->registers[destination->value];
+  } else if (accesses & ACCESS_WRITES_DESTINATION) {
+    record->flags |= TRACE_MEMORY_WRITTEN;
+    record->address = (unsigned short)destination->value;
+    record->value = (unsigned short)machine->memory[destination->value];
+  } else if ((accesses & ACCESS_READS_DESTINATION) &&
+             is_in_memory(destination)) {
+    record->flags |= TRACE_MEMORY_READ;
+    record->address = (unsigned short)destination->value;
+  } else if ((accesses & ACCESS_READS_SOURCE) && is_in_memory(source)) {
+    record->flags |= TRACE_MEMORY_READ;
+    record->address = (unsigned short)source->value;
+  }
+
+  /* The thread writing the file sees the records a batch at a time */
+  if (++tracer->pending % TRACE_BATCH_SIZE == 0) {
+    __atomic_store_n(&tracer->tail, tracer->pending, __ATOMIC_RELEASE);
+  }
+}
+
+bool close_tracer(Tracer *tracer, unsigned long *records,
+                  unsigned long *bytes) {
+  bool is_ok = false;
+
+  __atomic_store_n(&tracer->tail, tracer->pending, __ATOMIC_RELEASE);
+  __atomic_store_n(&tracer->is_done, 1, __ATOMIC_RELEASE);
+
+  if (tracer->is_threaded) {
+    pthread_join(tracer->thread, NULL);
+  } else {
+    write_records(tracer, tracer->pending);
+  }
+
+  is_ok = fclose(tracer->file) == 0 && !tracer->is_failed;
+  *records = tracer->pending;
+  *bytes = tracer->bytes;
+  free(tracer);
+
+  return is_ok;
+}
+
+bool open_trace_reader(TraceReader *reader, FILE *file) {
+  char magic[TRACE_MAGIC_LENGTH];
+
+  reader->file = file;
+  init_history(&reader->history);
+
+  return fread(magic, 1, TRACE_MAGIC_LENGTH, file) == TRACE_MAGIC_LENGTH &&
+         memcmp(magic, TRACE_MAGIC, TRACE_MAGIC_LENGTH) == 0;
+}
+
+/* Reads a number written by put_number, returning whether it was whole */
+static bool get_number(FILE *file, unsigned long *number) {
+  int shift = 0;
+  int c = 0;
+
+  *number = 0;
+
+  while (shift < 28 && (c = getc(file)) != EOF) {
+    *number |= (unsigned long)(c & 0x7F) << shift;
+
+    if ((c & 0x80) == 0) {
+      return true;
+    }
+
+    shift += 7;
+  }
+
+  return false;
+}
+
+/* Reads an address written as a difference, returning whether it is valid */
+static bool get_address(FILE *file, int from, int *address) {
+  unsigned long number = 0;
+
+  if (!get_number(file, &number)) {
+    return false;
+  }
+
+  *address = from + (int)unzigzag(number);
+
+  return *address >= 0 && *address < MAX_MEMORY_SIZE;
+}
+
+int read_trace_record(TraceReader *reader, TraceRecord *record) {
+  TraceHistory *history = &reader->history;
+  unsigned long change = 0;
+  int address = 0;
+  int first = getc(reader->file);
+  int pc = history->next_pcs[history->pc];
+  int c = 0;
+
+  if (first == EOF) {
+    return 0;
+  }
+
+  if (!(first & SAME_PC)) {
+    if (!get_address(reader->file, history->pc, &pc)) {
+      return -1;
+    }
+
+    history->next_pcs[history->pc] = (unsigned short)pc;
+  }
+
+  if (!(first & SAME_ACCESSES)) {
+    if ((c = getc(reader->file)) == EOF) {
+      return -1;
+    }
+
+    history->opcodes[pc] = (unsigned char)c;
+
+    if ((c = getc(reader->file)) == EOF) {
+      return -1;
+    }
+
+    history->flags[pc] = (unsigned char)(c & ACCESSES_MASK);
+  }
+
+  record->pc = (unsigned short)pc;
+  record->opcode = history->opcodes[pc];
+  record->flags = history->flags[pc] | (first & ZERO ? TRACE_ZERO : 0);
+  record->address = 0;
+  record->value = 0;
+
+  if (record->flags & (TRACE_MEMORY_READ | TRACE_MEMORY_WRITTEN)) {
+    if (!(first & SAME_ADDRESS)) {
+      if (!get_address(reader->file, history->addresses[pc], &address)) {
+        return -1;
+      }
+
+      history->addresses[pc] = (unsigned short)address;
+    }
+
+    record->address = history->addresses[pc];
+  }
+
+  if (record->flags & (TRACE_REGISTER_WRITTEN | TRACE_MEMORY_WRITTEN)) {
+    change = (unsigned long)first >> CHANGE_SHIFT;
+
+    if (change == CHANGE_FOLLOWS && !get_number(reader->file, &change)) {
+      return -1;
+    }
+
+    history->values[pc] =
+        (unsigned short)((history->values[pc] + unzigzag(change)) & WORD_MASK);
+    record->value = history->values[pc];
+  }
+
+  history->pc = pc;
+
+  return 1;
+}
@@ -0,0 +1,145 @@
+#ifndef __TRACE__H__
+#define __TRACE__H__
+
+/**
+ * @file trace.h
+ * @brief This file contains the definition of the trace of an execution, a
+ * record of every instruction the machine executes written to a trace file.
+ *
+ * A record has a fixed size: the address of the instruction, its opcode, the
+ * register or the word of memory it wrote with the value written, the word of
+ * memory it read otherwise, and the zero flag after it. The machine puts the
+ * records into a ring buffer of the tracer, which is only ever written by the
+ * thread running the machine, and a thread of the tracer takes them out and
+ * writes them to the file, so the execution waits for the file only when the
+ * ring is full. The buffer is lock free: the thread running the machine
+ * publishes the records it put in every TRACE_BATCH_SIZE of them, and the
+ * thread writing the file publishes the records it took out once it wrote
+ * them.
+ *
+ * The file starts with TRACE_MAGIC, followed by the records compressed
+ * against what the instruction at the same address did the last time it ran,
+ * which the reader remembers as the writer does: the address it went on to,
+ * its opcode and accesses, the address it accessed and the value it wrote. A
+ * record that repeats them is a single byte, holding the zero flag and the
+ * change of the value written when it is small, and every part that differs
+ * follows it in as few bytes of 7 bits as it fits.
+ */
+
+#include "machine.h"
+#include <stdbool.h>
+#include <stdio.h>
+
+#define TRACE_MAGIC "ASMTRC1\n"
+#define TRACE_MAGIC_LENGTH 8
+#define TRACE_RING_SIZE 65536
+#define TRACE_BATCH_SIZE 256
+
+/* The flags of a record, with the register written in the bits of 0x07 */
+#define TRACE_REGISTER_MASK 0x07
+#define TRACE_REGISTER_WRITTEN 0x08
+#define TRACE_MEMORY_READ 0x10
+#define TRACE_MEMORY_WRITTEN 0x20
+#define TRACE_ZERO 0x40
+
+/**
+ * @struct TraceRecord
+ * @brief An executed instruction.
+ */
+typedef struct {
+  unsigned short pc;      /**< The address of the instruction. */
+  unsigned char opcode;   /**< The opcode of the instruction. */
+  unsigned char flags;    /**< What the instruction accessed, and the zero
+                             flag after it. */
+  unsigned short value;   /**< The word written to the register or to
+                             memory. */
+  unsigned short address; /**< The address of memory read or written. */
+} TraceRecord;
+
+/**
+ * @struct TraceHistory
+ * @brief What the instructions at every address did the last time they ran,
+ * which the records are compressed against.
+ */
+typedef struct {
+  int pc;                                      /**< The address of the
+                                                  record before. */
+  unsigned short next_pcs[MAX_MEMORY_SIZE];    /**< The address executed
+                                                  after every address. */
+  unsigned char opcodes[MAX_MEMORY_SIZE];      /**< The opcode at every
+                                                  address. */
+  unsigned char flags[MAX_MEMORY_SIZE];        /**< The accesses of every
+                                                  address. */
+  unsigned short addresses[MAX_MEMORY_SIZE];   /**< The address of memory
+                                                  every address accessed. */
+  unsigned short values[MAX_MEMORY_SIZE];      /**< The value every address
+                                                  wrote. */
+} TraceHistory;
+
+/**
+ * @struct TraceReader
+ * @brief The state of the reading of a trace file.
+ */
+typedef struct {
+  FILE *file;           /**< The trace file. */
+  TraceHistory history; /**< The records read so far. */
+} TraceReader;
+
+/**
+ * @brief The writer of the trace of an execution.
+ */
+typedef struct Tracer Tracer;
+
+/**
+ * @brief Creates a trace file and starts the thread writing it.
+ *
+ * An error is printed when the file cannot be created. The records are written
+ * on the thread putting them in when no thread can be started.
+ *
+ * @param file_name The name of the trace file.
+ * @return The tracer, or NULL if the file cannot be created.
+ */
+Tracer *open_tracer(const char *file_name);
+
+/**
+ * @brief Records an executed instruction.
+ *
+ * @param tracer The tracer.
+ * @param machine The machine, after the instruction.
+ * @param instruction The instruction.
+ * @param address The address of the instruction.
+ */
+void trace_instruction(Tracer *tracer, const Machine *machine,
+                       const DecodedInstruction *instruction, int address);
+
+/**
+ * @brief Writes the records left, closes the trace file and frees a tracer.
+ *
+ * @param tracer The tracer.
+ * @param records Set to the number of records written.
+ * @param bytes Set to the size of the trace file.
+ * @return true if the whole trace was written, false otherwise.
+ */
+bool close_tracer(Tracer *tracer, unsigned long *records, unsigned long *bytes);
+
+/**
+ * @brief Starts reading a trace file.
+ *
+ * @param reader The reader to initialize.
+ * @param file The trace file, opened for reading in binary mode.
+ * @return true if the file starts as a trace file does, false otherwise.
+ */
+bool open_trace_reader(TraceReader *reader, FILE *file);
+
+/**
+ * @brief Reads the next record of a trace file.
+ *
+ * @param reader The reader.
+ * @param record Set to the record, with address 0 when the instruction did not
+ * access memory.
+ * @return 1 if a record was read, 0 at the end of the file, and -1 if the
+ * file ends in the middle of a record.
+ */
+int read_trace_record(TraceReader *reader, TraceRecord *record);
+
+#endif
@@ -0,0 +1,111 @@
+/**
+ * @file trace_reader.c
+ * @brief Prints the traces the emulator writes with -t.
+ *
+ * Every record is printed on a line of its own: its number, the address of
+ * the instruction and its opcode, then the register or the word of memory it
+ * wrote with the value written as a signed number, or the word of memory it
+ * read. The zero flag is printed after cmp, which sets it, and bne, which
+ * tests it.
+ *
+ * Usage:
+ *   trace_reader [-n records] file.trace...
+ */
+
+#include "consts.h"
+#include "errors.h"
+#include "trace.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+extern Instruction inst_table[INST_TABLE_SIZE];
+
+/* The number of records to print at most per file */
+static unsigned long record_limit = (unsigned long)-1;
+
+static void print_record(unsigned long number, const TraceRecord *record) {
+  char access[32] = "";
+  int opcode = record->opcode;
+
+  if (record->flags & TRACE_REGISTER_WRITTEN) {
+    sprintf(access, "  r%d = %d", record->flags & TRACE_REGISTER_MASK,
+            word_value(record->value));
+  } else if (record->flags & TRACE_MEMORY_WRITTEN) {
+    sprintf(access, "  [%04d] = %d", record->address,
+            word_value(record->value));
+  } else if (record->flags & TRACE_MEMORY_READ) {
+    sprintf(access, "  [%04d]", record->address);
+  }
+
+  if (opcode == OPCODE_CMP || opcode == OPCODE_BNE) {
+    strcat(access, record->flags & TRACE_ZERO ? "  zero" : "  not zero");
+  }
+
+  printf(access[0] ? "%10lu  %04d  %-4s%s\n" : "%10lu  %04d  %s%s\n", number,
+         record->pc, opcode < INST_TABLE_SIZE ? inst_table[opcode].name : "?",
+         access);
+}
+
+/* Prints the records of a trace file, returning whether it was read whole */
+static bool print_trace(const char *file_name) {
+  FILE *file = fopen(file_name, "rb");
+  TraceReader reader;
+  TraceRecord record;
+  unsigned long count = 0;
+  int result = 0;
+
+  if (file == NULL) {
+    fprintf(stderr, ERROR_CANNOT_READ, file_name);
+    return false;
+  }
+
+  if (!open_trace_reader(&reader, file)) {
+    fprintf(stderr, ERROR_INVALID_TRACE_FILE, file_name, count);
+    fclose(file);
+    return false;
+  }
+
+  while (count < record_limit &&
+         (result = read_trace_record(&reader, &record)) > 0) {
+    print_record(++count, &record);
+  }
+
+  if (result < 0) {
+    fprintf(stderr, ERROR_INVALID_TRACE_FILE, file_name, count);
+  }
+
+  fclose(file);
+
+  return result >= 0;
+}
+
+static void usage(void) {
+  fprintf(stderr, "usage: trace_reader [-n records] file.trace...\n");
+  exit(EXIT_FAILURE);
+}
+
+int main(int argc, char **argv) {
+  int failures = 0;
+  int i = 1;
+
+  for (; i < argc && argv[i][0] == '-'; i++) {
+    if (i + 1 < argc && strcmp(argv[i], "-n") == 0) {
+      record_limit = strtoul(argv[++i], NULL, 10);
+    } else {
+      usage();
+    }
+  }
+
+  if (i >= argc) {
+    usage();
+  }
+
+  for (; i < argc; i++) {
+    if (!print_trace(argv[i])) {
+      failures++;
+    }
+  }
+
+  return failures > 0 ? EXIT_FAILURE : EXIT_SUCCESS;
+}
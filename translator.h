@@ -6,8 +6,10 @@
  * @brief This file contains the definition of the CodeImage and Translator structures used in translation.
  */
 
-#include "symbol_table.h"
+#include "line_table.h"
+#include "symbol_index.h"
 #include <ctype.h>
+#include <stdbool.h>
 #include <stdlib.h>
 #include <string.h>
 
@@ -15,21 +17,31 @@
  * @struct CodeImage
  * @brief A structure to represent a code image.
  *
- * This structure represents a code image, which is a collection of
- * instructions. The structure contains an array of instructions and a count of
- * the number of instructions.
+ * This structure represents a code image, which is a collection of 14-bit
+ * machine words. The structure contains an array of words and a count of the
+ * number of words.
  *
- * @param instructions
- * Member 'instructions' is a pointer to an array of strings, each representing
- * an instruction.
+ * @param words
+ * Member 'words' is a pointer to an array of integers, each representing a
+ * machine word.
  *
  * @param count
- * Member 'count' is an integer that represents the number of instructions in
- * the code image.
+ * Member 'count' is an integer that represents the number of words in the code
+ * image.
+ *
+ * @param capacity
+ * Member 'capacity' is an integer that represents the number of words
+ * allocated for the code image.
+ *
+ * @param preassigned
+ * Member 'preassigned' tells that the words between 'count' and 'capacity' are
+ * a slot of a code image allocated at its final size, which never grows.
  */
 typedef struct {
-  char **instructions;
+  int *words;
   int count;
+  int capacity;
+  bool preassigned;
 } CodeImage;
 
 /**
@@ -51,11 +63,26 @@ typedef struct {
  * @param external_symbols
  * Member 'external_symbols' is a pointer to a Symbol structure that represents
  * the symbol table for external symbols.
+ *
+ * @param last_external_symbol
+ * Member 'last_external_symbol' is a pointer to the last symbol of the external
+ * symbols, after which the next one is added.
+ *
+ * @param symbol_index
+ * Member 'symbol_index' is a pointer to an index of the symbol table used to
+ * look the symbols up, or NULL to walk the symbol table.
+ *
+ * @param lines
+ * Member 'lines' is the table of the lines of the source the words of the code
+ * image come from, numbered as in the source the second pass encodes.
  */
 typedef struct {
   CodeImage *code_image;
   Symbol *internal_symbols;
   Symbol *external_symbols;
+  Symbol *last_external_symbol;
+  const SymbolIndex *symbol_index;
+  LineTable lines;
 } Translator;
 
 #endif
\ No newline at end of file
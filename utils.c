@@ -1,8 +1,10 @@
+#define _POSIX_C_SOURCE 200809L
 #include "utils.h"
 #include "errors.h"
 #include "stdio.h"
 #include "stdlib.h"
 #include "string.h"
+#include <time.h>
 
 bool isDigitInString(const char *str, int digit) {
   int i;
@@ -38,10 +40,95 @@ char *strdup(const char *str) {
   return duplicate;
 }
 
+char *first_token(char *str, const char *delimiters) {
+  str += strspn(str, delimiters);
+
+  if (*str == '\0') {
+    return NULL;
+  }
+
+  str[strcspn(str, delimiters)] = '\0';
+
+  return str;
+}
+
+const char *find_string_end(const char *literal) {
+  literal++;
+
+  while (*literal != '\0' && *literal != '"') {
+    if (*literal == '\\' && literal[1] != '\0') {
+      literal++;
+    }
+
+    literal++;
+  }
+
+  return *literal == '"' ? literal : NULL;
+}
+
+int decode_string(const char *text, int length, char *decoded) {
+  const char *end = text + length;
+  char *start = decoded;
+
+  while (text < end) {
+    if (*text != '\\') {
+      *decoded++ = *text++;
+      continue;
+    }
+
+    if (++text == end) {
+      return -1;
+    }
+
+    switch (*text++) {
+    case 'n':
+      *decoded++ = '\n';
+      break;
+    case 't':
+      *decoded++ = '\t';
+      break;
+    case 'r':
+      *decoded++ = '\r';
+      break;
+    case '\\':
+      *decoded++ = '\\';
+      break;
+    case '"':
+      *decoded++ = '"';
+      break;
+    default:
+      return -1;
+    }
+  }
+
+  *decoded = '\0';
+
+  return decoded - start;
+}
+
 void removeSubstring(char *str, const char *sub) {
   char *match = strstr(str, sub);
   size_t len = strlen(sub);
   if (match) {
     memmove(match, match + len, 1 + strlen(match + len));
   }
-}
\ No newline at end of file
+}
+
+void *allocate(size_t size) {
+  void *memory = calloc(1, size);
+
+  if (memory == NULL) {
+    fprintf(stderr, ERROR_OUT_OF_MEMORY);
+    exit(EXIT_FAILURE);
+  }
+
+  return memory;
+}
+
+double now_seconds(void) {
+  struct timespec now;
+
+  clock_gettime(CLOCK_MONOTONIC, &now);
+
+  return now.tv_sec + now.tv_nsec / 1e9;
+}
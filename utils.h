@@ -8,6 +8,7 @@
  */
 
 #include <stdbool.h>
+#include <stddef.h>
 
 /**
  * @brief Checks if a digit is present in a string.
@@ -42,4 +43,56 @@ bool is_integer(const char *str);
  */
 char *strdup(const char *str);
 
+/**
+ * @brief Splits the first token off a string.
+ *
+ * Behaves like a single strtok() call on the string, without keeping any state
+ * between calls, so it is safe to use from several threads at once.
+ *
+ * @param str The string to split, modified in place.
+ * @param delimiters The characters that separate the tokens.
+ * @return A pointer to the first token, or NULL if there is none.
+ */
+char *first_token(char *str, const char *delimiters);
+
+/**
+ * @brief Finds the closing quote of a string literal.
+ *
+ * A quote preceded by a backslash is part of the literal and does not close
+ * it.
+ *
+ * @param literal The opening quote of the literal.
+ * @return A pointer to the closing quote, or NULL if the literal is not closed.
+ */
+const char *find_string_end(const char *literal);
+
+/**
+ * @brief Decodes the characters of a string literal, replacing its escapes.
+ *
+ * The escapes are \n, \t, \r, \\ and \", the other characters are copied
+ * as they are.
+ *
+ * @param text The characters between the quotes of the literal.
+ * @param length The number of characters between the quotes.
+ * @param decoded Where to store the decoded string, of at least length + 1
+ * characters.
+ * @return The length of the decoded string, or -1 if an escape is invalid.
+ */
+int decode_string(const char *text, int length, char *decoded);
+
+/**
+ * @brief Allocates zeroed memory, ending the program when there is none.
+ *
+ * @param size The number of bytes to allocate.
+ * @return A pointer to the memory, to be freed with free().
+ */
+void *allocate(size_t size);
+
+/**
+ * @brief Gets the time of a monotonic clock, to measure how long things take.
+ *
+ * @return The time in seconds.
+ */
+double now_seconds(void);
+
 #endif
\ No newline at end of file
@@ -0,0 +1,147 @@
+#define _GNU_SOURCE
+#include "watch.h"
+#include "errors.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#ifdef __linux__
+#include <errno.h>
+#include <poll.h>
+#include <sys/inotify.h>
+#include <unistd.h>
+
+/* A file is saved when it is written and closed, or moved into place */
+#define SAVE_EVENTS (IN_CLOSE_WRITE | IN_MOVED_TO)
+
+#define EVENTS_BUFFER_SIZE 4096
+
+bool init_watcher(Watcher *watcher, char **file_names, int count) {
+  int i = 0;
+
+  watcher->count = count;
+  watcher->fd = inotify_init1(IN_NONBLOCK | IN_CLOEXEC);
+  watcher->watches = (int *)malloc(count * sizeof(int));
+  watcher->names = (const char **)malloc(count * sizeof(char *));
+
+  if (watcher->watches == NULL || watcher->names == NULL) {
+    fprintf(stderr, ERROR_OUT_OF_MEMORY);
+    exit(EXIT_FAILURE);
+  }
+
+  if (watcher->fd < 0) {
+    free_watcher(watcher);
+    return false;
+  }
+
+  for (i = 0; i < count; i++) {
+    const char *slash = strrchr(file_names[i], '/');
+    char *directory = NULL;
+
+    if (slash) {
+      directory = strndup(file_names[i], slash - file_names[i] + 1);
+      watcher->names[i] = slash + 1;
+    } else {
+      directory = strdup(".");
+      watcher->names[i] = file_names[i];
+    }
+
+    if (directory == NULL) {
+      fprintf(stderr, ERROR_OUT_OF_MEMORY);
+      exit(EXIT_FAILURE);
+    }
+
+    /* A directory watched twice keeps the same watch */
+    watcher->watches[i] = inotify_add_watch(watcher->fd, directory, SAVE_EVENTS);
+    free(directory);
+
+    if (watcher->watches[i] < 0) {
+      free_watcher(watcher);
+      return false;
+    }
+  }
+
+  return true;
+}
+
+/* Marks the files named by the events read so far */
+static int read_events(Watcher *watcher, bool *changed) {
+  char buffer[EVENTS_BUFFER_SIZE]
+      __attribute__((aligned(__alignof__(struct inotify_event))));
+  int changed_count = 0;
+  ssize_t length = 0;
+
+  while ((length = read(watcher->fd, buffer, sizeof(buffer))) > 0) {
+    char *next = buffer;
+
+    while (next < buffer + length) {
+      const struct inotify_event *event = (const struct inotify_event *)next;
+      int i = 0;
+
+      for (i = 0; event->len > 0 && i < watcher->count; i++) {
+        if (!changed[i] && watcher->watches[i] == event->wd &&
+            strcmp(watcher->names[i], event->name) == 0) {
+          changed[i] = true;
+          changed_count++;
+        }
+      }
+
+      next += sizeof(struct inotify_event) + event->len;
+    }
+  }
+
+  return changed_count;
+}
+
+int wait_for_changes(Watcher *watcher, bool *changed) {
+  struct pollfd poll_fd;
+  int changed_count = 0;
+  int i = 0;
+
+  for (i = 0; i < watcher->count; i++) {
+    changed[i] = false;
+  }
+
+  poll_fd.fd = watcher->fd;
+  poll_fd.events = POLLIN;
+
+  /* Events about other files of the directories are skipped */
+  while (changed_count == 0) {
+    if (poll(&poll_fd, 1, -1) < 0 && errno != EINTR) {
+      return -1;
+    }
+
+    changed_count = read_events(watcher, changed);
+  }
+
+  return changed_count;
+}
+
+void free_watcher(Watcher *watcher) {
+  if (watcher->fd >= 0) {
+    close(watcher->fd);
+  }
+
+  free(watcher->watches);
+  free(watcher->names);
+  watcher->watches = NULL;
+  watcher->names = NULL;
+  watcher->fd = -1;
+}
+
+#else
+
+bool init_watcher(Watcher *watcher, char **file_names, int count) {
+  watcher->fd = -1;
+  watcher->watches = NULL;
+  watcher->names = NULL;
+  watcher->count = 0;
+
+  return false;
+}
+
+int wait_for_changes(Watcher *watcher, bool *changed) { return -1; }
+
+void free_watcher(Watcher *watcher) {}
+
+#endif
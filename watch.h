@@ -0,0 +1,52 @@
+#ifndef __WATCH__H__
+#define __WATCH__H__
+
+/**
+ * @file watch.h
+ * @brief This file contains the watcher telling which source files were saved.
+ *
+ * The directories of the files are watched rather than the files themselves,
+ * so that a file an editor saves by replacing it is still seen.
+ */
+
+#include <stdbool.h>
+
+/**
+ * @struct Watcher
+ * @brief The files being watched.
+ */
+typedef struct {
+  int fd;             /**< The inotify instance. */
+  int *watches;       /**< The watch of the directory of every file. */
+  const char **names; /**< The name of every file within its directory. */
+  int count;          /**< The number of files. */
+} Watcher;
+
+/**
+ * @brief Starts watching files.
+ *
+ * @param watcher The watcher to initialize.
+ * @param file_names The names of the files. They must outlive the watcher.
+ * @param count The number of files.
+ * @return true if the files are watched, false if watching is not supported
+ * or a directory cannot be watched.
+ */
+bool init_watcher(Watcher *watcher, char **file_names, int count);
+
+/**
+ * @brief Waits until some of the files are saved.
+ *
+ * @param watcher The watcher.
+ * @param changed Set for every file saved, and cleared for the others.
+ * @return The number of files saved, or -1 if the wait failed.
+ */
+int wait_for_changes(Watcher *watcher, bool *changed);
+
+/**
+ * @brief Stops watching and frees the memory allocated for a watcher.
+ *
+ * @param watcher The watcher to free.
+ */
+void free_watcher(Watcher *watcher);
+
+#endif
@@ -0,0 +1,596 @@
+/**
+ * @file workload_gen.c
+ * @brief Synthetic workload generator for the assembler benchmarks.
+ *
+ * Produces large, valid assembly sources with a controllable mix of line
+ * kinds (instructions, data, strings, macros, defines, comments), addressing
+ * modes and entry/extern density. A few profiles cover the pathological cases
+ * the assembler has to scale to: every line labeled, and very long macro
+ * bodies expanded many times.
+ *
+ * Usage:
+ *   workload_gen [-n lines] [-s seed] [-p profile] [-k kind=weight,...]
+ *                [-i opcode=weight,...] [-a mode=weight,...]
+ *                [-l label%] [-e entry%] [-x extern%] [-b body_lines]
+ *                output.as
+ *
+ * Profiles: mixed (default), labels, macros, data.
+ * Line kinds: inst, data, string, macro, define, comment, empty.
+ * Addressing modes: imm, dir, idx, reg.
+ */
+
+#include "consts.h"
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define KIND_COUNT 7
+#define MODE_COUNT 4
+#define MAX_DATA_ITEMS 8
+#define MAX_STRING_CHARS 24
+
+extern Instruction inst_table[INST_TABLE_SIZE];
+
+typedef enum {
+  KIND_INST,
+  KIND_DATA,
+  KIND_STRING,
+  KIND_MACRO,
+  KIND_DEFINE,
+  KIND_COMMENT,
+  KIND_EMPTY
+} LineKind;
+
+static const char *kind_names[KIND_COUNT] = {
+    "inst", "data", "string", "macro", "define", "comment", "empty"};
+static const char *mode_names[MODE_COUNT] = {"imm", "dir", "idx", "reg"};
+
+/**
+ * @struct WorkloadOptions
+ * @brief The knobs that shape a generated workload.
+ */
+typedef struct {
+  long lines;                         /**< Number of source lines to emit. */
+  unsigned long seed;                 /**< Seed of the random generator. */
+  int kind_weights[KIND_COUNT];       /**< Relative weights of line kinds. */
+  int opcode_weights[INST_TABLE_SIZE]; /**< Relative weights of opcodes. */
+  int mode_weights[MODE_COUNT];       /**< Relative weights of modes. */
+  int label_percent;  /**< Chance that an instruction is labeled. */
+  int entry_percent;  /**< Chance that a label is exported by .entry. */
+  int extern_percent; /**< Chance that a direct operand is an extern. */
+  int macro_count;    /**< Number of macros defined up front. */
+  int macro_body;     /**< Number of lines in each macro body. */
+} WorkloadOptions;
+
+/**
+ * @struct Generator
+ * @brief The state of a generation run.
+ */
+typedef struct {
+  FILE *out;
+  WorkloadOptions *options;
+  unsigned long state;
+  long emitted;
+  long code_labels;
+  long data_labels;
+  long defines;
+  long externs;
+  long entries;
+} Generator;
+
+static unsigned long next_random(Generator *gen) {
+  gen->state = (gen->state * 1103515245UL + 12345UL) & 0xFFFFFFFFUL;
+  return gen->state >> 8;
+}
+
+static long random_below(Generator *gen, long bound) {
+  return bound > 0 ? (long)(next_random(gen) % (unsigned long)bound) : 0;
+}
+
+static int pick_weighted(Generator *gen, const int *weights, int count) {
+  long total = 0;
+  long roll = 0;
+  int i = 0;
+
+  for (i = 0; i < count; i++) {
+    total += weights[i];
+  }
+
+  if (total <= 0) {
+    return 0;
+  }
+
+  roll = random_below(gen, total);
+
+  for (i = 0; i < count; i++) {
+    if (roll < weights[i]) {
+      return i;
+    }
+    roll -= weights[i];
+  }
+
+  return count - 1;
+}
+
+static void emit_line(Generator *gen, const char *text) {
+  fprintf(gen->out, "%s\n", text);
+  gen->emitted++;
+}
+
+static void append_define(Generator *gen, char *buffer) {
+  sprintf(buffer, "K%ld", random_below(gen, gen->defines));
+}
+
+static void append_number(Generator *gen, char *buffer, long range) {
+  long value = random_below(gen, 2 * range) - range;
+
+  if (value == 0) {
+    value = 1;
+  }
+
+  sprintf(buffer, "%ld", value);
+}
+
+/* Picks a label that is already defined, or an extern when allowed. */
+static bool pick_symbol(Generator *gen, char *buffer, bool allow_extern) {
+  long labels = gen->code_labels + gen->data_labels;
+
+  if (allow_extern && gen->externs > 0 &&
+      random_below(gen, 100) < gen->options->extern_percent) {
+    sprintf(buffer, "X%ld", random_below(gen, gen->externs));
+    return true;
+  }
+
+  if (labels == 0) {
+    return false;
+  }
+
+  if (random_below(gen, labels) < gen->code_labels) {
+    sprintf(buffer, "L%ld", random_below(gen, gen->code_labels));
+  } else {
+    sprintf(buffer, "D%ld", random_below(gen, gen->data_labels));
+  }
+
+  return true;
+}
+
+/*
+ * Writes an operand for the given slot. Immediate labels are only used in the
+ * destination slot and indices only use defines, as that is what the second
+ * pass encodes. Returns false when no allowed mode can be satisfied.
+ */
+static bool write_operand(Generator *gen, char *buffer, const char *allowed,
+                          int slot, bool in_macro) {
+  int weights[MODE_COUNT];
+  char symbol[MAX_LABEL_LENGTH + 1];
+  int attempt = 0;
+  int i = 0;
+
+  for (i = 0; i < MODE_COUNT; i++) {
+    weights[i] = strchr(allowed, '0' + i) ? gen->options->mode_weights[i] : 0;
+  }
+
+  for (attempt = 0; attempt < 8; attempt++) {
+    switch (pick_weighted(gen, weights, MODE_COUNT)) {
+    case 0:
+      if (weights[0] == 0) {
+        break;
+      }
+      if (slot == 1 && gen->defines > 0 && random_below(gen, 2) == 0) {
+        buffer[0] = '#';
+        append_define(gen, buffer + 1);
+      } else {
+        buffer[0] = '#';
+        append_number(gen, buffer + 1, 2000);
+      }
+      return true;
+    case 1:
+      if (weights[1] == 0 || in_macro || !pick_symbol(gen, symbol, true)) {
+        break;
+      }
+      strcpy(buffer, symbol);
+      return true;
+    case 2:
+      if (weights[2] == 0 || in_macro || !pick_symbol(gen, symbol, false)) {
+        break;
+      }
+      if (gen->defines > 0 && random_below(gen, 2) == 0) {
+        sprintf(buffer, "%s[K%ld]", symbol, random_below(gen, gen->defines));
+      } else {
+        sprintf(buffer, "%s[%ld]", symbol, random_below(gen, 16));
+      }
+      return true;
+    case 3:
+      if (weights[3] == 0) {
+        break;
+      }
+      sprintf(buffer, "r%ld", random_below(gen, 8));
+      return true;
+    }
+  }
+
+  if (weights[3] > 0 || strchr(allowed, '3')) {
+    sprintf(buffer, "r%ld", random_below(gen, 8));
+    return true;
+  }
+
+  return false;
+}
+
+static void write_instruction(Generator *gen, char *line, bool in_macro) {
+  char source[MAX_LINE_LENGTH];
+  char destination[MAX_LINE_LENGTH];
+  int attempt = 0;
+
+  for (attempt = 0; attempt < 16; attempt++) {
+    Instruction *inst = &inst_table[pick_weighted(
+        gen, gen->options->opcode_weights, INST_TABLE_SIZE)];
+
+    if (inst->destination_operand[0] == '\0') {
+      strcat(line, inst->name);
+      return;
+    }
+
+    if (!write_operand(gen, destination, inst->destination_operand, 1,
+                       in_macro)) {
+      continue;
+    }
+
+    if (inst->source_operand[0] == '\0') {
+      sprintf(line + strlen(line), "%s  %s", inst->name, destination);
+      return;
+    }
+
+    if (!write_operand(gen, source, inst->source_operand, 0, in_macro)) {
+      continue;
+    }
+
+    sprintf(line + strlen(line), "%s  %s, %s", inst->name, source,
+            destination);
+    return;
+  }
+
+  strcat(line, "hlt");
+}
+
+static void write_code_line(Generator *gen) {
+  char line[MAX_LINE_LENGTH * 2];
+  bool labeled = random_below(gen, 100) < gen->options->label_percent;
+
+  line[0] = '\0';
+
+  if (labeled) {
+    sprintf(line, "L%ld:   ", gen->code_labels);
+  } else {
+    strcpy(line, "        ");
+  }
+
+  write_instruction(gen, line, false);
+  emit_line(gen, line);
+
+  if (labeled) {
+    gen->code_labels++;
+  }
+}
+
+static void write_data_line(Generator *gen) {
+  char line[MAX_LINE_LENGTH * 2];
+  long items = 1 + random_below(gen, MAX_DATA_ITEMS);
+  long i = 0;
+
+  sprintf(line, "D%ld:   .data ", gen->data_labels);
+
+  for (i = 0; i < items; i++) {
+    if (i > 0) {
+      strcat(line, ", ");
+    }
+
+    if (gen->defines > 0 && random_below(gen, 4) == 0) {
+      append_define(gen, line + strlen(line));
+    } else {
+      append_number(gen, line + strlen(line), 8000);
+    }
+  }
+
+  emit_line(gen, line);
+  gen->data_labels++;
+}
+
+static void write_string_line(Generator *gen) {
+  char line[MAX_LINE_LENGTH * 2];
+  long length = 1 + random_below(gen, MAX_STRING_CHARS);
+  long i = 0;
+  char *cursor = NULL;
+
+  sprintf(line, "D%ld:   .string \"", gen->data_labels);
+  cursor = line + strlen(line);
+
+  for (i = 0; i < length; i++) {
+    *cursor++ = 'a' + (char)random_below(gen, 26);
+  }
+
+  *cursor++ = '"';
+  *cursor = '\0';
+
+  emit_line(gen, line);
+  gen->data_labels++;
+}
+
+static void write_define_line(Generator *gen) {
+  char line[MAX_LINE_LENGTH];
+
+  sprintf(line, ".define K%ld = %ld", gen->defines, 1 + random_below(gen, 64));
+  emit_line(gen, line);
+  gen->defines++;
+}
+
+static void write_entry_line(Generator *gen) {
+  char line[MAX_LINE_LENGTH];
+  long labels = gen->code_labels + gen->data_labels;
+
+  if (gen->entries >= labels) {
+    return;
+  }
+
+  if (gen->entries % 2 == 0 && gen->entries / 2 < gen->code_labels) {
+    sprintf(line, ".entry L%ld", gen->entries / 2);
+  } else if (gen->entries / 2 < gen->data_labels) {
+    sprintf(line, ".entry D%ld", gen->entries / 2);
+  } else {
+    return;
+  }
+
+  emit_line(gen, line);
+  gen->entries++;
+}
+
+static void write_macros(Generator *gen) {
+  char line[MAX_LINE_LENGTH * 2];
+  int i = 0;
+  int j = 0;
+
+  for (i = 0; i < gen->options->macro_count; i++) {
+    sprintf(line, "mcr m%d", i);
+    emit_line(gen, line);
+
+    for (j = 0; j < gen->options->macro_body; j++) {
+      strcpy(line, "    ");
+      write_instruction(gen, line, true);
+      emit_line(gen, line);
+    }
+
+    emit_line(gen, "endmcr");
+  }
+}
+
+static void generate(Generator *gen) {
+  WorkloadOptions *options = gen->options;
+  char line[MAX_LINE_LENGTH];
+  long extern_count = 0;
+  long i = 0;
+
+  for (i = 0; i < 4; i++) {
+    write_define_line(gen);
+  }
+
+  if (options->extern_percent > 0) {
+    extern_count = 1 + options->lines / 200;
+
+    for (i = 0; i < extern_count; i++) {
+      sprintf(line, ".extern X%ld", i);
+      emit_line(gen, line);
+      gen->externs++;
+    }
+  }
+
+  write_macros(gen);
+
+  emit_line(gen, "MAIN:   mov  r0, r1");
+
+  while (gen->emitted < options->lines) {
+    switch (pick_weighted(gen, options->kind_weights, KIND_COUNT)) {
+    case KIND_INST:
+      write_code_line(gen);
+      break;
+    case KIND_DATA:
+      write_data_line(gen);
+      break;
+    case KIND_STRING:
+      write_string_line(gen);
+      break;
+    case KIND_MACRO:
+      if (options->macro_count > 0) {
+        sprintf(line, "        m%ld", random_below(gen, options->macro_count));
+        emit_line(gen, line);
+      }
+      break;
+    case KIND_DEFINE:
+      write_define_line(gen);
+      break;
+    case KIND_COMMENT:
+      emit_line(gen, "; generated comment line");
+      break;
+    case KIND_EMPTY:
+      emit_line(gen, "");
+      break;
+    }
+
+    if (random_below(gen, 100) < options->entry_percent) {
+      write_entry_line(gen);
+    }
+  }
+
+  emit_line(gen, "END:    hlt");
+}
+
+static void set_profile(WorkloadOptions *options, const char *profile) {
+  static const int mixed[KIND_COUNT] = {60, 12, 6, 5, 3, 8, 6};
+  static const int labels[KIND_COUNT] = {100, 0, 0, 0, 0, 0, 0};
+  static const int macros[KIND_COUNT] = {200, 10, 0, 1, 0, 5, 0};
+  static const int data[KIND_COUNT] = {10, 55, 30, 0, 2, 3, 0};
+  const int *kinds = mixed;
+  int i = 0;
+
+  options->label_percent = 20;
+  options->entry_percent = 2;
+  options->extern_percent = 3;
+  options->macro_count = 8;
+  options->macro_body = 6;
+
+  if (strcmp(profile, "labels") == 0) {
+    kinds = labels;
+    options->label_percent = 100;
+    options->macro_count = 0;
+  } else if (strcmp(profile, "macros") == 0) {
+    kinds = macros;
+    options->macro_count = 4;
+    options->macro_body = 1000;
+  } else if (strcmp(profile, "data") == 0) {
+    kinds = data;
+    options->macro_count = 0;
+  } else if (strcmp(profile, "mixed") != 0) {
+    fprintf(stderr, "workload_gen: unknown profile '%s'\n", profile);
+    exit(EXIT_FAILURE);
+  }
+
+  for (i = 0; i < KIND_COUNT; i++) {
+    options->kind_weights[i] = kinds[i];
+  }
+}
+
+/* Parses "name=weight,name=weight" into the weights of the matching names. */
+static void parse_weights(const char *spec, const char **names,
+                          int names_count, int *weights) {
+  char *copy = malloc(strlen(spec) + 1);
+  char *item = NULL;
+  int i = 0;
+
+  if (copy == NULL) {
+    exit(EXIT_FAILURE);
+  }
+
+  strcpy(copy, spec);
+
+  for (item = strtok(copy, ","); item != NULL; item = strtok(NULL, ",")) {
+    char *equal = strchr(item, '=');
+
+    if (equal == NULL) {
+      fprintf(stderr, "workload_gen: expected name=weight in '%s'\n", item);
+      exit(EXIT_FAILURE);
+    }
+
+    *equal = '\0';
+
+    for (i = 0; i < names_count; i++) {
+      if (strcmp(item, names[i]) == 0) {
+        weights[i] = atoi(equal + 1);
+        break;
+      }
+    }
+
+    if (i == names_count) {
+      fprintf(stderr, "workload_gen: unknown name '%s'\n", item);
+      exit(EXIT_FAILURE);
+    }
+  }
+
+  free(copy);
+}
+
+static void usage(void) {
+  fprintf(stderr,
+          "usage: workload_gen [-n lines] [-s seed] [-p profile]\n"
+          "                    [-k kind=weight,...] [-i opcode=weight,...]\n"
+          "                    [-a mode=weight,...] [-l label%%] [-e entry%%]\n"
+          "                    [-x extern%%] [-b body_lines] output.as\n");
+  exit(EXIT_FAILURE);
+}
+
+int main(int argc, char **argv) {
+  WorkloadOptions options;
+  Generator gen;
+  const char *opcode_names[INST_TABLE_SIZE];
+  const char *output = NULL;
+  int i = 0;
+
+  memset(&options, 0, sizeof(options));
+  options.lines = 10000;
+  options.seed = 1;
+  set_profile(&options, "mixed");
+
+  for (i = 0; i < INST_TABLE_SIZE; i++) {
+    opcode_names[i] = inst_table[i].name;
+    options.opcode_weights[i] = 1;
+  }
+
+  for (i = 0; i < MODE_COUNT; i++) {
+    options.mode_weights[i] = 1;
+  }
+
+  for (i = 1; i < argc; i++) {
+    if (argv[i][0] != '-' || argv[i][1] == '\0') {
+      output = argv[i];
+      continue;
+    }
+
+    if (i + 1 >= argc) {
+      usage();
+    }
+
+    switch (argv[i][1]) {
+    case 'n':
+      options.lines = atol(argv[++i]);
+      break;
+    case 's':
+      options.seed = strtoul(argv[++i], NULL, 10);
+      break;
+    case 'p':
+      set_profile(&options, argv[++i]);
+      break;
+    case 'k':
+      parse_weights(argv[++i], kind_names, KIND_COUNT, options.kind_weights);
+      break;
+    case 'i':
+      parse_weights(argv[++i], opcode_names, INST_TABLE_SIZE,
+                    options.opcode_weights);
+      break;
+    case 'a':
+      parse_weights(argv[++i], mode_names, MODE_COUNT, options.mode_weights);
+      break;
+    case 'l':
+      options.label_percent = atoi(argv[++i]);
+      break;
+    case 'e':
+      options.entry_percent = atoi(argv[++i]);
+      break;
+    case 'x':
+      options.extern_percent = atoi(argv[++i]);
+      break;
+    case 'b':
+      options.macro_body = atoi(argv[++i]);
+      break;
+    default:
+      usage();
+    }
+  }
+
+  if (output == NULL) {
+    usage();
+  }
+
+  memset(&gen, 0, sizeof(gen));
+  gen.options = &options;
+  gen.state = options.seed;
+  gen.out = fopen(output, "w");
+
+  if (gen.out == NULL) {
+    fprintf(stderr, "workload_gen: cannot write '%s'\n", output);
+    return EXIT_FAILURE;
+  }
+
+  generate(&gen);
+  fclose(gen.out);
+
+  return EXIT_SUCCESS;
+}